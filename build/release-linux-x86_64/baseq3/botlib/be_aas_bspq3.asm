@@ -0,0 +1,1534 @@
+export AAS_Trace
+code
+proc AAS_Trace 64 28
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 botimport+8
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 64
+LABELV $25
+endproc AAS_Trace 64 28
+export AAS_PointContents
+proc AAS_PointContents 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botimport+16
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $28
+endproc AAS_PointContents 4 4
+export AAS_EntityCollision
+proc AAS_EntityCollision 64 28
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 botimport+12
+INDIRP4
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+GEF4 $32
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTU4 64
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $30
+JUMPV
+LABELV $32
+CNSTI4 0
+RETI4
+LABELV $30
+endproc AAS_EntityCollision 64 28
+export AAS_inPVS
+proc AAS_inPVS 4 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botimport+20
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $35
+endproc AAS_inPVS 4 8
+export AAS_inPHS
+proc AAS_inPHS 0 0
+CNSTI4 1
+RETI4
+LABELV $37
+endproc AAS_inPHS 0 0
+export AAS_BSPModelMinsMaxsOrigin
+proc AAS_BSPModelMinsMaxsOrigin 0 20
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 botimport+28
+INDIRP4
+CALLV
+pop
+LABELV $38
+endproc AAS_BSPModelMinsMaxsOrigin 0 20
+export AAS_UnlinkFromBSPLeaves
+proc AAS_UnlinkFromBSPLeaves 0 0
+LABELV $40
+endproc AAS_UnlinkFromBSPLeaves 0 0
+export AAS_BSPLinkEntity
+proc AAS_BSPLinkEntity 0 0
+CNSTP4 0
+RETP4
+LABELV $41
+endproc AAS_BSPLinkEntity 0 0
+export AAS_BoxEntities
+proc AAS_BoxEntities 0 0
+CNSTI4 0
+RETI4
+LABELV $42
+endproc AAS_BoxEntities 0 0
+export AAS_NextBSPEntity
+proc AAS_NextBSPEntity 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $44
+ADDRFP4 0
+INDIRI4
+ADDRGP4 bspworld+4
+INDIRI4
+GEI4 $44
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $43
+JUMPV
+LABELV $44
+CNSTI4 0
+RETI4
+LABELV $43
+endproc AAS_NextBSPEntity 4 0
+export AAS_BSPEntityInRange
+proc AAS_BSPEntityInRange 4 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $51
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bspworld+4
+INDIRI4
+LTI4 $48
+LABELV $51
+CNSTI4 1
+ARGI4
+ADDRGP4 $53
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $47
+JUMPV
+LABELV $48
+CNSTI4 1
+RETI4
+LABELV $47
+endproc AAS_BSPEntityInRange 4 8
+export AAS_ValueForBSPEpairKey
+proc AAS_ValueForBSPEpairKey 12 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 AAS_BSPEntityInRange
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $55
+CNSTI4 0
+RETI4
+ADDRGP4 $54
+JUMPV
+LABELV $55
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 bspworld+8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $60
+JUMPV
+LABELV $57
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $62
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+CNSTI4 1
+RETI4
+ADDRGP4 $54
+JUMPV
+LABELV $62
+LABELV $58
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $60
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $57
+CNSTI4 0
+RETI4
+LABELV $54
+endproc AAS_ValueForBSPEpairKey 12 12
+export AAS_VectorForBSPEpairKey
+proc AAS_VectorForBSPEpairKey 156 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 144
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 148
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $65
+CNSTI4 0
+RETI4
+ADDRGP4 $64
+JUMPV
+LABELV $65
+ADDRLP4 152
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 $67
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $64
+endproc AAS_VectorForBSPEpairKey 156 20
+export AAS_FloatForBSPEpairKey
+proc AAS_FloatForBSPEpairKey 136 16
+ADDRFP4 8
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 128
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $69
+CNSTI4 0
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $69
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 132
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $68
+endproc AAS_FloatForBSPEpairKey 136 16
+export AAS_IntForBSPEpairKey
+proc AAS_IntForBSPEpairKey 136 16
+ADDRFP4 8
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 128
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $72
+CNSTI4 0
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $72
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $71
+endproc AAS_IntForBSPEpairKey 136 16
+export AAS_FreeBSPEntities
+proc AAS_FreeBSPEntities 20 4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $78
+JUMPV
+LABELV $75
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 bspworld+8
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $84
+JUMPV
+LABELV $81
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $85
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $85
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $87
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $87
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $82
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $84
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $81
+LABELV $76
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $78
+ADDRLP4 8
+INDIRI4
+ADDRGP4 bspworld+4
+INDIRI4
+LTI4 $75
+ADDRGP4 bspworld+4
+CNSTI4 0
+ASGNI4
+LABELV $74
+endproc AAS_FreeBSPEntities 20 4
+export AAS_ParseBSPEntities
+proc AAS_ParseBSPEntities 2096 12
+ADDRGP4 bspworld+4
+CNSTI4 1
+ASGNI4
+ADDRLP4 2056
+CNSTI4 0
+ASGNI4
+ADDRGP4 $93
+JUMPV
+LABELV $92
+ADDRLP4 2056
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2060
+ADDRGP4 botimport+24
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 2060
+INDIRI4
+CNSTI4 0
+NEI4 $95
+ADDRGP4 $94
+JUMPV
+LABELV $95
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $98
+ADDRGP4 AAS_FreeBSPEntities
+CALLV
+pop
+CNSTI4 3
+ARGI4
+ADDRGP4 $101
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $94
+JUMPV
+LABELV $98
+ADDRGP4 bspworld+4
+INDIRI4
+CNSTI4 2048
+LTI4 $102
+CNSTI4 2
+ARGI4
+ADDRGP4 $106
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $94
+JUMPV
+LABELV $102
+ADDRLP4 2052
+ADDRGP4 bspworld+4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 bspworld+8
+ADDP4
+ASGNP4
+ADDRLP4 2064
+ADDRGP4 bspworld+4
+ASGNP4
+ADDRLP4 2064
+INDIRP4
+ADDRLP4 2064
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 2052
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $111
+JUMPV
+LABELV $110
+ADDRLP4 2056
+ARGP4
+ADDRLP4 1028
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2068
+ADDRGP4 botimport+24
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $113
+ADDRGP4 AAS_FreeBSPEntities
+CALLV
+pop
+CNSTI4 3
+ARGI4
+ADDRGP4 $117
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $90
+JUMPV
+LABELV $113
+ADDRLP4 1028
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $118
+ADDRGP4 $112
+JUMPV
+LABELV $118
+ADDRLP4 2056
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2072
+ADDRGP4 botimport+24
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 2072
+INDIRI4
+CNSTI4 0
+NEI4 $120
+ADDRGP4 AAS_FreeBSPEntities
+CALLV
+pop
+CNSTI4 3
+ARGI4
+ADDRGP4 $117
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $90
+JUMPV
+LABELV $120
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $124
+ADDRGP4 AAS_FreeBSPEntities
+CALLV
+pop
+CNSTI4 3
+ARGI4
+ADDRGP4 $127
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $90
+JUMPV
+LABELV $124
+CNSTU4 12
+ARGU4
+ADDRLP4 2076
+ADDRGP4 GetClearedHunkMemory
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2076
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 2052
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 2080
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 2080
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRLP4 2084
+ADDRGP4 GetHunkMemory
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 2084
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 2088
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 2088
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRLP4 2092
+ADDRGP4 GetHunkMemory
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 2092
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $111
+ADDRGP4 $110
+JUMPV
+LABELV $112
+LABELV $93
+ADDRGP4 $92
+JUMPV
+LABELV $94
+LABELV $90
+endproc AAS_ParseBSPEntities 2096 12
+export AAS_BSPTraceLight
+proc AAS_BSPTraceLight 0 0
+CNSTI4 0
+RETI4
+LABELV $128
+endproc AAS_BSPTraceLight 0 0
+export AAS_DumpBSPData
+proc AAS_DumpBSPData 0 12
+ADDRGP4 AAS_FreeBSPEntities
+CALLV
+pop
+ADDRGP4 bspworld
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 8200
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $129
+endproc AAS_DumpBSPData 0 12
+export AAS_LoadBSPFile
+proc AAS_LoadBSPFile 0 0
+ADDRGP4 AAS_DumpBSPData
+CALLV
+pop
+ADDRGP4 AAS_ParseBSPEntities
+CALLV
+pop
+ADDRGP4 bspworld
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+LABELV $130
+endproc AAS_LoadBSPFile 0 0
+bss
+export bspworld
+align 4
+LABELV bspworld
+skip 8200
+import aassettings
+import AAS_PrintFreeBSPLinks
+import AAS_FileInfo
+import AAS_DumpAASData
+import AAS_FreeAASLump
+import AAS_WriteCompactAASFile
+import AAS_WriteAASFile
+import AAS_LoadCompactAASFile
+import AAS_LoadAASFile
+import AAS_ShutdownAlternativeRouting
+import AAS_InitAlternativeRouting
+import AAS_RoutingCacheInfo
+import AAS_RoutingInfo
+import AAS_ReadRouteTables
+import AAS_WriteRouteTables
+import AAS_WriteRouteCache
+import AAS_CreateAllRoutingCache
+import AAS_FreeRoutingCaches
+import AAS_InitRouting
+import AAS_BestReachableLinkArea
+import AAS_ContinueInitReachability
+import AAS_InitReachability
+import AAS_SetViewPortalsAsClusterPortals
+import AAS_InitClustering
+import AAS_SampleBenchmark
+import AAS_FreeFlatNodes
+import AAS_InitFlatNodes
+import AAS_FreeReachabilityAreaGrid
+import AAS_InitReachabilityAreaGrid
+import AAS_UnlinkFromAreas
+import AAS_InsideFace
+import AAS_PointInsideFace
+import AAS_LinkEntityClientBBox
+import AAS_AASLinkEntity
+import AAS_PlaneFromNum
+import AAS_TraceEndFace
+import AAS_AreaGroundFace
+import AAS_FreeAASLinkedEntities
+import AAS_FreeAASLinkHeap
+import AAS_InitAASLinkedEntities
+import AAS_InitAASLinkHeap
+import AAS_UpdateEntities
+import AAS_UpdateEntity
+import AAS_ResetEntityLinks
+import AAS_UnlinkInvalidEntities
+import AAS_InvalidateEntities
+import AAS_StartFrame
+import AAS_LoadMap
+import AAS_Shutdown
+import AAS_Setup
+import AAS_SetInitialized
+import AAS_Error
+import aasworld
+import botDeveloper
+import botimport
+import botlibglobals
+import AAS_InitSettings
+import AAS_DropToFloor
+import AAS_SetMovedir
+import AAS_HorizontalVelocityForJump
+import AAS_BFGJumpZVelocity
+import AAS_RocketJumpZVelocity
+import AAS_AgainstLadder
+import AAS_JumpReachRunStart
+import AAS_Swimming
+import AAS_OnGround
+import AAS_PlayerMovementHitBBox
+import AAS_PredictPlayerMovement
+import AAS_AreasConnected
+import AAS_Optimize
+import AAS_FloodAreas
+import AAS_ShowReachableAreas
+import AAS_ShowReachability
+import AAS_DrawArrow
+import AAS_PrintTravelType
+import AAS_DrawCross
+import AAS_ShowAreaPolygons
+import AAS_ShowArea
+import AAS_ShowFace
+import AAS_ShowBoundingBox
+import AAS_DrawPlaneCross
+import AAS_DrawPermanentCross
+import AAS_PermanentLine
+import AAS_DebugLine
+import AAS_ClearShownPolygons
+import AAS_ClearShownDebugLines
+import AAS_AlternativeRouteGoals
+import AAS_PredictRoute
+import AAS_AreaTravelTimeToGoalArea
+import AAS_AreaTravelTime
+import AAS_EnableRoutingArea
+import AAS_RandomGoalArea
+import AAS_ReachabilityFromNum
+import AAS_NextAreaReachability
+import AAS_AreaContentsTravelFlags
+import AAS_TravelFlagForType
+import AAS_AreaDoNotEnter
+import AAS_AreaJumpPad
+import AAS_AreaLadder
+import AAS_AreaGrounded
+import AAS_AreaSlime
+import AAS_AreaLava
+import AAS_AreaLiquid
+import AAS_AreaSwim
+import AAS_AreaCrouch
+import AAS_AreaGroundFaceArea
+import AAS_NextModelReachability
+import AAS_BestReachableFromJumpPadArea
+import AAS_BestReachableArea
+import AAS_AreaReachability
+import AAS_FacePlane
+import AAS_PointReachabilityAreaIndex
+import AAS_PointAreaNum
+import AAS_AreaInfo
+import AAS_PointInsideArea
+import AAS_BBoxReachabilityAreas
+import AAS_BBoxAreas
+import AAS_TraceAreas
+import AAS_TracePlayerBBox
+import AAS_PointPresenceType
+import AAS_AreaPresenceType
+import AAS_AreaCluster
+import AAS_PresenceTypeBoundingBox
+import AAS_ProjectPointOntoVector
+import AAS_Time
+import AAS_Loaded
+import AAS_Initialized
+import GetBotLibAPI
+import DumpMemory
+import MemoryByteSize
+import PrintMemoryLabels
+import PrintUsedMemorySize
+import AvailableMemory
+import FreeMemory
+import GetClearedHunkMemory
+import GetHunkMemory
+import GetClearedMemory
+import GetMemory
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $127
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 66
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 10
+byte 1 0
+align 1
+LABELV $117
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 66
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 69
+byte 1 79
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $106
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 66
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 66
+byte 1 83
+byte 1 80
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $101
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 66
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 123
+byte 1 10
+byte 1 0
+align 1
+LABELV $67
+byte 1 37
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $53
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
@@ -0,0 +1,5184 @@
+export AAS_ClearShownPolygons
+code
+proc AAS_ClearShownPolygons 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $26
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debugpolygons
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $30
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debugpolygons
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 botimport+88
+INDIRP4
+CALLV
+pop
+LABELV $30
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debugpolygons
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $27
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+LTI4 $26
+LABELV $25
+endproc AAS_ClearShownPolygons 4 4
+export AAS_ShowPolygon
+proc AAS_ShowPolygon 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $34
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debugpolygons
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $38
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 botimport+84
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debugpolygons
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $36
+JUMPV
+LABELV $38
+LABELV $35
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+LTI4 $34
+LABELV $36
+LABELV $33
+endproc AAS_ShowPolygon 8 12
+export AAS_ClearShownDebugLines
+proc AAS_ClearShownDebugLines 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $42
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglines
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $46
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglines
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 botimport+76
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglines
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglinevisible
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $46
+LABELV $43
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $42
+LABELV $41
+endproc AAS_ClearShownDebugLines 4 4
+export AAS_DebugLine
+proc AAS_DebugLine 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $50
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglines
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $54
+ADDRLP4 4
+ADDRGP4 botimport+72
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglines
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglinevisible
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRGP4 numdebuglines
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $54
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglinevisible
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $57
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglines
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 botimport+80
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglinevisible
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $49
+JUMPV
+LABELV $57
+LABELV $51
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $50
+LABELV $49
+endproc AAS_DebugLine 12 16
+export AAS_PermanentLine
+proc AAS_PermanentLine 8 16
+ADDRLP4 4
+ADDRGP4 botimport+72
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 botimport+80
+INDIRP4
+CALLV
+pop
+LABELV $60
+endproc AAS_PermanentLine 8 16
+export AAS_DrawPermanentCross
+proc AAS_DrawPermanentCross 44 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $64
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 AAS_DebugLine
+CALLV
+pop
+ADDRLP4 40
+ADDRGP4 botimport+72
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 botimport+80
+INDIRP4
+CALLV
+pop
+LABELV $65
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $64
+LABELV $63
+endproc AAS_DrawPermanentCross 44 16
+export AAS_DrawPlaneCross
+proc AAS_DrawPlaneCross 224 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 84
+CNSTI4 3
+ASGNI4
+ADDRLP4 24
+ADDRFP4 12
+INDIRI4
+ADDRLP4 84
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 84
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 88
+CNSTI4 2
+ASGNI4
+ADDRLP4 12
+ADDRFP4 12
+INDIRI4
+ADDRLP4 88
+INDIRI4
+ADDI4
+ADDRLP4 84
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 8
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LSHI4
+ADDRLP4 28
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 28
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+ASGNF4
+ADDRLP4 100
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 40
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDF4
+ASGNF4
+ADDRLP4 104
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 40
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 52
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 52
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 64
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 64
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDF4
+ASGNF4
+ADDRLP4 124
+CNSTI4 2
+ASGNI4
+ADDRLP4 128
+ADDRLP4 24
+INDIRI4
+ADDRLP4 124
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 8
+INDIRI4
+ADDRLP4 124
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 12
+INDIRI4
+ADDRLP4 124
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ADDRLP4 28
+ADDP4
+ADDRFP4 8
+INDIRF4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 28
+ADDP4
+INDIRF4
+ADDRLP4 132
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 140
+INDIRI4
+ADDRLP4 28
+ADDP4
+INDIRF4
+ADDRLP4 140
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ADDRLP4 128
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 144
+CNSTI4 2
+ASGNI4
+ADDRLP4 148
+ADDRLP4 24
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 8
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 12
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+ADDRLP4 40
+ADDP4
+ADDRFP4 8
+INDIRF4
+ADDRLP4 152
+INDIRI4
+ADDRLP4 40
+ADDP4
+INDIRF4
+ADDRLP4 152
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 160
+INDIRI4
+ADDRLP4 40
+ADDP4
+INDIRF4
+ADDRLP4 160
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ADDRLP4 148
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 164
+CNSTI4 2
+ASGNI4
+ADDRLP4 168
+ADDRLP4 24
+INDIRI4
+ADDRLP4 164
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 172
+ADDRLP4 8
+INDIRI4
+ADDRLP4 164
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 12
+INDIRI4
+ADDRLP4 164
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ADDRLP4 52
+ADDP4
+ADDRFP4 8
+INDIRF4
+ADDRLP4 172
+INDIRI4
+ADDRLP4 52
+ADDP4
+INDIRF4
+ADDRLP4 172
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 52
+ADDP4
+INDIRF4
+ADDRLP4 180
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ADDRLP4 168
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 184
+CNSTI4 2
+ASGNI4
+ADDRLP4 188
+ADDRLP4 24
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 8
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 200
+ADDRLP4 12
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+ADDRLP4 64
+ADDP4
+ADDRFP4 8
+INDIRF4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 64
+ADDP4
+INDIRF4
+ADDRLP4 192
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 200
+INDIRI4
+ADDRLP4 64
+ADDP4
+INDIRF4
+ADDRLP4 200
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ADDRLP4 188
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 204
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRGP4 $74
+JUMPV
+LABELV $71
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglines
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $75
+ADDRLP4 208
+ADDRGP4 botimport+72
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglines
+ADDP4
+ADDRLP4 208
+INDIRI4
+ASGNI4
+ADDRLP4 212
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 212
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 216
+CNSTI4 2
+ASGNI4
+ADDRLP4 212
+INDIRI4
+ADDRLP4 216
+INDIRI4
+LSHI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 216
+INDIRI4
+LSHI4
+ADDRGP4 debuglines
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglinevisible
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 220
+ADDRGP4 numdebuglines
+ASGNP4
+ADDRLP4 220
+INDIRP4
+ADDRLP4 220
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $76
+JUMPV
+LABELV $75
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglinevisible
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $78
+ADDRLP4 208
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 208
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 212
+CNSTI4 2
+ASGNI4
+ADDRLP4 208
+INDIRI4
+ADDRLP4 212
+INDIRI4
+LSHI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 212
+INDIRI4
+LSHI4
+ADDRGP4 debuglines
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglinevisible
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $78
+LABELV $76
+LABELV $72
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $74
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+GEI4 $80
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $71
+LABELV $80
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 botimport+80
+INDIRP4
+CALLV
+pop
+ADDRLP4 16+4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 botimport+80
+INDIRP4
+CALLV
+pop
+LABELV $70
+endproc AAS_DrawPlaneCross 224 16
+export AAS_ShowBoundingBox
+proc AAS_ShowBoundingBox 196 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 128
+CNSTI4 4
+ASGNI4
+ADDRLP4 24+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 132
+CNSTI4 8
+ASGNI4
+ADDRLP4 24+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 24+12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 136
+CNSTI4 4
+ASGNI4
+ADDRLP4 24+12+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 140
+CNSTI4 8
+ASGNI4
+ADDRLP4 24+12+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 24+24
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 144
+CNSTI4 4
+ASGNI4
+ADDRLP4 24+24+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 148
+CNSTI4 8
+ASGNI4
+ADDRLP4 24+24+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 24+36
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 152
+CNSTI4 4
+ASGNI4
+ADDRLP4 24+36+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 152
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 152
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 156
+CNSTI4 8
+ASGNI4
+ADDRLP4 24+36+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 24+48
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTU4 48
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $103
+ADDRLP4 160
+CNSTI4 8
+ASGNI4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 24+48+8
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $104
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+LTI4 $103
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $109
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRGP4 $116
+JUMPV
+LABELV $113
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglines
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $117
+ADDRLP4 168
+ADDRGP4 botimport+72
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglines
+ADDP4
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 172
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 176
+CNSTI4 2
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ADDRLP4 176
+INDIRI4
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 176
+INDIRI4
+LSHI4
+ADDRGP4 debuglines
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglinevisible
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 180
+ADDRGP4 numdebuglines
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ADDRLP4 180
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $118
+JUMPV
+LABELV $117
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglinevisible
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $120
+ADDRLP4 168
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 172
+CNSTI4 2
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ADDRLP4 172
+INDIRI4
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 172
+INDIRI4
+LSHI4
+ADDRGP4 debuglines
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglinevisible
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $120
+LABELV $118
+LABELV $114
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $116
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+GEI4 $122
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $113
+LABELV $122
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 168
+CNSTI4 12
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 24
+ADDP4
+ARGP4
+ADDRLP4 176
+CNSTI4 1
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 176
+INDIRI4
+ADDI4
+CNSTI4 3
+BANDI4
+MULI4
+ADDRLP4 24
+ADDP4
+ARGP4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRGP4 botimport+80
+INDIRP4
+CALLV
+pop
+ADDRLP4 12+4
+INDIRI4
+ARGI4
+ADDRLP4 180
+CNSTI4 12
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 24+48
+ADDP4
+ARGP4
+ADDRLP4 188
+CNSTI4 1
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 188
+INDIRI4
+ADDI4
+CNSTI4 3
+BANDI4
+MULI4
+ADDRLP4 24+48
+ADDP4
+ARGP4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRGP4 botimport+80
+INDIRP4
+CALLV
+pop
+ADDRLP4 12+8
+INDIRI4
+ARGI4
+ADDRLP4 192
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 24
+ADDP4
+ARGP4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 24+48
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 botimport+80
+INDIRP4
+CALLV
+pop
+LABELV $110
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+LTI4 $109
+LABELV $84
+endproc AAS_ShowBoundingBox 196 16
+export AAS_ShowFace
+proc AAS_ShowFace 64 12
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRGP4 aasworld+200
+INDIRI4
+LTI4 $132
+CNSTI4 3
+ARGI4
+ADDRGP4 $136
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $132
+ADDRLP4 16
+CNSTI4 24
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $141
+JUMPV
+LABELV $138
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 aasworld+184
+INDIRI4
+LTI4 $143
+CNSTI4 3
+ARGI4
+ADDRGP4 $147
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $143
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $149
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $150
+JUMPV
+LABELV $149
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $151
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRGP4 $152
+JUMPV
+LABELV $151
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+NEI4 $153
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $154
+JUMPV
+LABELV $153
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $154
+LABELV $152
+LABELV $150
+ADDRLP4 52
+CNSTI4 12
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 AAS_DebugLine
+CALLV
+pop
+LABELV $139
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $141
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $138
+ADDRLP4 32
+CNSTI4 20
+ADDRLP4 16
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 12
+ADDRLP4 8
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 56
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 36
+ADDRLP4 20
+INDIRF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 20+4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 20+8
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AAS_DebugLine
+CALLV
+pop
+LABELV $131
+endproc AAS_ShowFace 64 12
+export AAS_ShowFacePolygon
+proc AAS_ShowFacePolygon 1572 12
+ADDRFP4 0
+INDIRI4
+ADDRGP4 aasworld+200
+INDIRI4
+LTI4 $166
+CNSTI4 3
+ARGI4
+ADDRGP4 $136
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $166
+ADDRLP4 16
+CNSTI4 24
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 1556
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1556
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 1556
+INDIRI4
+EQI4 $171
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $176
+JUMPV
+LABELV $173
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1564
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 1564
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $181
+ADDRLP4 1560
+CNSTI4 1
+ASGNI4
+ADDRGP4 $182
+JUMPV
+LABELV $181
+ADDRLP4 1560
+CNSTI4 0
+ASGNI4
+LABELV $182
+ADDRLP4 1568
+CNSTI4 12
+ASGNI4
+ADDRLP4 1568
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 20
+ADDP4
+ADDRLP4 1568
+INDIRI4
+ADDRLP4 1560
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $174
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $176
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $173
+ADDRGP4 $172
+JUMPV
+LABELV $171
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $186
+JUMPV
+LABELV $183
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1564
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 1564
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $191
+ADDRLP4 1560
+CNSTI4 1
+ASGNI4
+ADDRGP4 $192
+JUMPV
+LABELV $191
+ADDRLP4 1560
+CNSTI4 0
+ASGNI4
+LABELV $192
+ADDRLP4 1568
+CNSTI4 12
+ASGNI4
+ADDRLP4 1568
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 20
+ADDP4
+ADDRLP4 1568
+INDIRI4
+ADDRLP4 1560
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $184
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $186
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $183
+LABELV $172
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 AAS_ShowPolygon
+CALLV
+pop
+LABELV $165
+endproc AAS_ShowFacePolygon 1572 12
+export AAS_ShowArea
+proc AAS_ShowArea 4160 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4120
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $197
+ADDRFP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $194
+LABELV $197
+CNSTI4 3
+ARGI4
+ADDRGP4 $199
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 aasworld+216
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $193
+JUMPV
+LABELV $194
+ADDRLP4 4136
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4128
+CNSTI4 0
+ASGNI4
+ADDRGP4 $205
+JUMPV
+LABELV $202
+ADDRLP4 4136
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 4128
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4144
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 4124
+ADDRLP4 4144
+INDIRI4
+ASGNI4
+ADDRLP4 4124
+INDIRI4
+ADDRGP4 aasworld+200
+INDIRI4
+LTI4 $207
+CNSTI4 3
+ARGI4
+ADDRGP4 $136
+ARGP4
+ADDRLP4 4124
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $207
+ADDRLP4 4116
+CNSTI4 24
+ADDRLP4 4124
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $212
+ADDRLP4 4116
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 6
+BANDI4
+CNSTI4 0
+NEI4 $214
+ADDRGP4 $203
+JUMPV
+LABELV $214
+LABELV $212
+ADDRLP4 4112
+CNSTI4 0
+ASGNI4
+ADDRGP4 $219
+JUMPV
+LABELV $216
+ADDRLP4 4116
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4112
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4148
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4148
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 aasworld+184
+INDIRI4
+LTI4 $221
+CNSTI4 3
+ARGI4
+ADDRGP4 $147
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $221
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $228
+JUMPV
+LABELV $225
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $229
+ADDRGP4 $227
+JUMPV
+LABELV $229
+LABELV $226
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $228
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $225
+LABELV $227
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $231
+ADDRLP4 8
+INDIRI4
+CNSTI4 1024
+GEI4 $231
+ADDRLP4 4156
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4156
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4156
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $231
+LABELV $217
+ADDRLP4 4112
+ADDRLP4 4112
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $219
+ADDRLP4 4112
+INDIRI4
+ADDRLP4 4116
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $216
+LABELV $203
+ADDRLP4 4128
+ADDRLP4 4128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $205
+ADDRLP4 4128
+INDIRI4
+ADDRLP4 4136
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $202
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $236
+JUMPV
+LABELV $233
+ADDRLP4 4108
+CNSTI4 0
+ASGNI4
+LABELV $237
+ADDRLP4 4108
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglines
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $241
+ADDRLP4 4144
+ADDRGP4 botimport+72
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 4108
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglines
+ADDP4
+ADDRLP4 4144
+INDIRI4
+ASGNI4
+ADDRLP4 4108
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglinevisible
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4148
+ADDRGP4 numdebuglines
+ASGNP4
+ADDRLP4 4148
+INDIRP4
+ADDRLP4 4148
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $241
+ADDRLP4 4108
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglinevisible
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $244
+ADDRGP4 $239
+JUMPV
+LABELV $244
+LABELV $238
+ADDRLP4 4108
+ADDRLP4 4108
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4108
+INDIRI4
+CNSTI4 1024
+LTI4 $237
+LABELV $239
+ADDRLP4 4108
+INDIRI4
+CNSTI4 1024
+LTI4 $246
+ADDRGP4 $193
+JUMPV
+LABELV $246
+ADDRLP4 4132
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4120
+INDIRI4
+CNSTI4 1
+NEI4 $249
+ADDRLP4 4120
+CNSTI4 4
+ASGNI4
+ADDRGP4 $250
+JUMPV
+LABELV $249
+ADDRLP4 4120
+INDIRI4
+CNSTI4 4
+NEI4 $251
+ADDRLP4 4120
+CNSTI4 2
+ASGNI4
+ADDRGP4 $252
+JUMPV
+LABELV $251
+ADDRLP4 4120
+INDIRI4
+CNSTI4 2
+NEI4 $253
+ADDRLP4 4120
+CNSTI4 3
+ASGNI4
+ADDRGP4 $254
+JUMPV
+LABELV $253
+ADDRLP4 4120
+CNSTI4 1
+ASGNI4
+LABELV $254
+LABELV $252
+LABELV $250
+ADDRLP4 4108
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglines
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4144
+CNSTI4 12
+ASGNI4
+ADDRLP4 4144
+INDIRI4
+ADDRLP4 4132
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 4144
+INDIRI4
+ADDRLP4 4132
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 4120
+INDIRI4
+ARGI4
+ADDRGP4 botimport+80
+INDIRP4
+CALLV
+pop
+ADDRLP4 4108
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 debuglinevisible
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $234
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $236
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $233
+LABELV $193
+endproc AAS_ShowArea 4160 16
+export AAS_ShowAreaPolygons
+proc AAS_ShowAreaPolygons 28 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $262
+ADDRFP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $259
+LABELV $262
+CNSTI4 3
+ARGI4
+ADDRGP4 $199
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 aasworld+216
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $258
+JUMPV
+LABELV $259
+ADDRLP4 12
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $269
+JUMPV
+LABELV $266
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+200
+INDIRI4
+LTI4 $271
+CNSTI4 3
+ARGI4
+ADDRGP4 $136
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $271
+ADDRLP4 8
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $276
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 6
+BANDI4
+CNSTI4 0
+NEI4 $278
+ADDRGP4 $267
+JUMPV
+LABELV $278
+LABELV $276
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $281
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $281
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $282
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 AAS_ShowFacePolygon
+CALLV
+pop
+LABELV $267
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $269
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $266
+LABELV $258
+endproc AAS_ShowAreaPolygons 28 16
+export AAS_DrawCross
+proc AAS_DrawCross 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $284
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 AAS_DebugLine
+CALLV
+pop
+LABELV $285
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $284
+LABELV $283
+endproc AAS_DrawCross 36 12
+export AAS_PrintTravelType
+proc AAS_PrintTravelType 12 12
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16777215
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LTI4 $289
+ADDRLP4 4
+INDIRI4
+CNSTI4 19
+GTI4 $289
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $332-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $332
+address $292
+address $294
+address $296
+address $298
+address $300
+address $302
+address $304
+address $306
+address $308
+address $310
+address $312
+address $314
+address $316
+address $318
+address $320
+address $322
+address $324
+address $326
+address $328
+code
+LABELV $292
+ADDRLP4 0
+ADDRGP4 $293
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $294
+ADDRLP4 0
+ADDRGP4 $295
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $296
+ADDRLP4 0
+ADDRGP4 $297
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $298
+ADDRLP4 0
+ADDRGP4 $299
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $300
+ADDRLP4 0
+ADDRGP4 $301
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $302
+ADDRLP4 0
+ADDRGP4 $303
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $304
+ADDRLP4 0
+ADDRGP4 $305
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $306
+ADDRLP4 0
+ADDRGP4 $307
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $308
+ADDRLP4 0
+ADDRGP4 $309
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $310
+ADDRLP4 0
+ADDRGP4 $311
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $312
+ADDRLP4 0
+ADDRGP4 $313
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $314
+ADDRLP4 0
+ADDRGP4 $315
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $316
+ADDRLP4 0
+ADDRGP4 $317
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $318
+ADDRLP4 0
+ADDRGP4 $319
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $320
+ADDRLP4 0
+ADDRGP4 $321
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $322
+ADDRLP4 0
+ADDRGP4 $323
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $324
+ADDRLP4 0
+ADDRGP4 $325
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $326
+ADDRLP4 0
+ADDRGP4 $327
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $328
+ADDRLP4 0
+ADDRGP4 $329
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $289
+CNSTI4 1
+ARGI4
+ADDRGP4 $331
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16777215
+BANDI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $288
+JUMPV
+LABELV $290
+CNSTI4 1
+ARGI4
+ADDRGP4 $335
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $288
+endproc AAS_PrintTravelType 12 12
+lit
+align 4
+LABELV $337
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export AAS_DrawArrow
+code
+proc AAS_DrawArrow 100 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRGP4 $337
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 72
+CNSTI4 4
+ASGNI4
+ADDRLP4 12+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 76
+CNSTI4 8
+ASGNI4
+ADDRLP4 12+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 60
+ADDRLP4 12
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 48+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 48+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1065185444
+GTF4 $346
+ADDRLP4 60
+INDIRF4
+CNSTF4 3212669092
+GEF4 $344
+LABELV $346
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $345
+JUMPV
+LABELV $344
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+LABELV $345
+ADDRLP4 88
+CNSTF4 3233808384
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 92
+CNSTF4 1086324736
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 92
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+CNSTF4 3233808384
+ASGNF4
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 36+4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 36+8
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 AAS_DebugLine
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 AAS_DebugLine
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 AAS_DebugLine
+CALLV
+pop
+LABELV $336
+endproc AAS_DrawArrow 100 12
+export AAS_ShowReachability
+proc AAS_ShowReachability 192 56
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 AAS_ShowAreaPolygons
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 AAS_DrawArrow
+CALLV
+pop
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 16777215
+BANDI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 5
+EQI4 $368
+ADDRLP4 152
+INDIRI4
+CNSTI4 7
+NEI4 $366
+LABELV $368
+ADDRGP4 aassettings+76
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 AAS_HorizontalVelocityForJump
+CALLI4
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 168
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRF4
+ADDRLP4 168
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 168
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 172
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+ADDRGP4 aassettings+76
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 176
+CNSTI4 1
+ASGNI4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 3
+ARGI4
+CNSTI4 30
+ARGI4
+CNSTF4 1036831949
+ARGF4
+CNSTI4 61
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 AAS_PredictPlayerMovement
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 16777215
+BANDI4
+CNSTI4 5
+NEI4 $367
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 AAS_JumpReachRunStart
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTF4 1082130432
+ARGF4
+CNSTI4 4
+ARGI4
+ADDRGP4 AAS_DrawCross
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $366
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 16777215
+BANDI4
+CNSTI4 12
+NEI4 $383
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 AAS_RocketJumpZVelocity
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 AAS_HorizontalVelocityForJump
+CALLI4
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 172
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRF4
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 176
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 176
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 176
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 184
+CNSTI4 1
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 188
+CNSTI4 30
+ASGNI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+CNSTF4 1036831949
+ARGF4
+CNSTI4 1212
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 184
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 AAS_PredictPlayerMovement
+CALLI4
+pop
+ADDRGP4 $384
+JUMPV
+LABELV $383
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 16777215
+BANDI4
+CNSTI4 18
+NEI4 $394
+ADDRLP4 156
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 0
+INDIRF4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 24+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 40
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 176
+CNSTI4 1
+ASGNI4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 180
+CNSTI4 30
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRLP4 180
+INDIRI4
+ARGI4
+CNSTF4 1036831949
+ARGF4
+CNSTI4 1212
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 AAS_PredictPlayerMovement
+CALLI4
+pop
+LABELV $394
+LABELV $384
+LABELV $367
+LABELV $365
+endproc AAS_ShowReachability 192 56
+bss
+align 4
+LABELV $407
+skip 44
+align 4
+LABELV $408
+skip 4
+align 4
+LABELV $409
+skip 4
+align 4
+LABELV $410
+skip 4
+export AAS_ShowReachableAreas
+code
+proc AAS_ShowReachableAreas 16 12
+ADDRFP4 0
+INDIRI4
+ADDRGP4 $409
+INDIRI4
+EQI4 $411
+ADDRGP4 $408
+CNSTI4 0
+ASGNI4
+ADDRGP4 $409
+ADDRFP4 0
+INDIRI4
+ASGNI4
+LABELV $411
+ADDRLP4 0
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $414
+ADDRGP4 $406
+JUMPV
+LABELV $414
+ADDRGP4 $408
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+LTI4 $416
+ADDRGP4 $408
+CNSTI4 0
+ASGNI4
+LABELV $416
+ADDRLP4 4
+ADDRGP4 AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 $410
+INDIRF4
+SUBF4
+CNSTF4 1069547520
+LEF4 $418
+ADDRGP4 $407
+ARGP4
+CNSTI4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRGP4 $408
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ARGP4
+CNSTU4 44
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 8
+ADDRGP4 $408
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 AAS_Time
+CALLF4
+ASGNF4
+ADDRGP4 $410
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 $407+36
+INDIRI4
+CNSTI4 16777215
+BANDI4
+ARGI4
+ADDRGP4 AAS_PrintTravelType
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $423
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $418
+ADDRGP4 $407
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 AAS_ShowReachability
+CALLV
+pop
+LABELV $406
+endproc AAS_ShowReachableAreas 16 12
+export AAS_FloodAreas_r
+proc AAS_FloodAreas_r 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 AAS_ShowAreaPolygons
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $430
+JUMPV
+LABELV $427
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 24
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $433
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $434
+JUMPV
+LABELV $433
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $434
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $435
+ADDRGP4 $428
+JUMPV
+LABELV $435
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $437
+ADDRGP4 $428
+JUMPV
+LABELV $437
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $439
+ADDRGP4 $428
+JUMPV
+LABELV $439
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 AAS_AreaCluster
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $442
+ADDRGP4 $428
+JUMPV
+LABELV $442
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FloodAreas_r
+CALLV
+pop
+LABELV $428
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $430
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $427
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $444
+ADDRLP4 24
+CNSTI4 44
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $449
+ADDRGP4 $445
+JUMPV
+LABELV $449
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $451
+ADDRGP4 $445
+JUMPV
+LABELV $451
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $453
+ADDRGP4 $445
+JUMPV
+LABELV $453
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 AAS_AreaCluster
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $456
+ADDRGP4 $445
+JUMPV
+LABELV $456
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FloodAreas_r
+CALLV
+pop
+LABELV $445
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $447
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+LTI4 $444
+LABELV $424
+endproc AAS_FloodAreas_r 44 12
+export AAS_FloodAreas
+proc AAS_FloodAreas 24 12
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ARGU4
+ADDRLP4 12
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 AAS_AreaCluster
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FloodAreas_r
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $458
+endproc AAS_FloodAreas 24 12
+bss
+align 4
+LABELV debugpolygons
+skip 32768
+export numdebuglines
+align 4
+LABELV numdebuglines
+skip 4
+export debuglinevisible
+align 4
+LABELV debuglinevisible
+skip 4096
+export debuglines
+align 4
+LABELV debuglines
+skip 4096
+import aassettings
+import AAS_PrintFreeBSPLinks
+import AAS_EntityCollision
+import AAS_BSPLinkEntity
+import AAS_UnlinkFromBSPLeaves
+import AAS_DumpBSPData
+import AAS_LoadBSPFile
+import AAS_FileInfo
+import AAS_DumpAASData
+import AAS_FreeAASLump
+import AAS_WriteCompactAASFile
+import AAS_WriteAASFile
+import AAS_LoadCompactAASFile
+import AAS_LoadAASFile
+import AAS_ShutdownAlternativeRouting
+import AAS_InitAlternativeRouting
+import AAS_RoutingCacheInfo
+import AAS_RoutingInfo
+import AAS_ReadRouteTables
+import AAS_WriteRouteTables
+import AAS_WriteRouteCache
+import AAS_CreateAllRoutingCache
+import AAS_FreeRoutingCaches
+import AAS_InitRouting
+import AAS_BestReachableLinkArea
+import AAS_ContinueInitReachability
+import AAS_InitReachability
+import AAS_SetViewPortalsAsClusterPortals
+import AAS_InitClustering
+import AAS_SampleBenchmark
+import AAS_FreeFlatNodes
+import AAS_InitFlatNodes
+import AAS_FreeReachabilityAreaGrid
+import AAS_InitReachabilityAreaGrid
+import AAS_UnlinkFromAreas
+import AAS_InsideFace
+import AAS_PointInsideFace
+import AAS_LinkEntityClientBBox
+import AAS_AASLinkEntity
+import AAS_PlaneFromNum
+import AAS_TraceEndFace
+import AAS_AreaGroundFace
+import AAS_FreeAASLinkedEntities
+import AAS_FreeAASLinkHeap
+import AAS_InitAASLinkedEntities
+import AAS_InitAASLinkHeap
+import AAS_UpdateEntities
+import AAS_UpdateEntity
+import AAS_ResetEntityLinks
+import AAS_UnlinkInvalidEntities
+import AAS_InvalidateEntities
+import AAS_StartFrame
+import AAS_LoadMap
+import AAS_Shutdown
+import AAS_Setup
+import AAS_SetInitialized
+import AAS_Error
+import aasworld
+import AAS_InitSettings
+import AAS_DropToFloor
+import AAS_SetMovedir
+import AAS_HorizontalVelocityForJump
+import AAS_BFGJumpZVelocity
+import AAS_RocketJumpZVelocity
+import AAS_AgainstLadder
+import AAS_JumpReachRunStart
+import AAS_Swimming
+import AAS_OnGround
+import AAS_PlayerMovementHitBBox
+import AAS_PredictPlayerMovement
+import AAS_IntForBSPEpairKey
+import AAS_FloatForBSPEpairKey
+import AAS_VectorForBSPEpairKey
+import AAS_ValueForBSPEpairKey
+import AAS_NextBSPEntity
+import AAS_BSPModelMinsMaxsOrigin
+import AAS_BoxEntities
+import AAS_AreasConnected
+import AAS_inPHS
+import AAS_inPVS
+import AAS_PointContents
+import AAS_Trace
+import AAS_Optimize
+import AAS_AlternativeRouteGoals
+import AAS_PredictRoute
+import AAS_AreaTravelTimeToGoalArea
+import AAS_AreaTravelTime
+import AAS_EnableRoutingArea
+import AAS_RandomGoalArea
+import AAS_ReachabilityFromNum
+import AAS_NextAreaReachability
+import AAS_AreaContentsTravelFlags
+import AAS_TravelFlagForType
+import AAS_AreaDoNotEnter
+import AAS_AreaJumpPad
+import AAS_AreaLadder
+import AAS_AreaGrounded
+import AAS_AreaSlime
+import AAS_AreaLava
+import AAS_AreaLiquid
+import AAS_AreaSwim
+import AAS_AreaCrouch
+import AAS_AreaGroundFaceArea
+import AAS_NextModelReachability
+import AAS_BestReachableFromJumpPadArea
+import AAS_BestReachableArea
+import AAS_AreaReachability
+import AAS_FacePlane
+import AAS_PointReachabilityAreaIndex
+import AAS_PointAreaNum
+import AAS_AreaInfo
+import AAS_PointInsideArea
+import AAS_BBoxReachabilityAreas
+import AAS_BBoxAreas
+import AAS_TraceAreas
+import AAS_TracePlayerBBox
+import AAS_PointPresenceType
+import AAS_AreaPresenceType
+import AAS_AreaCluster
+import AAS_PresenceTypeBoundingBox
+import AAS_ProjectPointOntoVector
+import AAS_Time
+import AAS_Loaded
+import AAS_Initialized
+import botDeveloper
+import botimport
+import botlibglobals
+import GetBotLibAPI
+import DumpMemory
+import MemoryByteSize
+import PrintMemoryLabels
+import PrintUsedMemorySize
+import AvailableMemory
+import FreeMemory
+import GetClearedHunkMemory
+import GetHunkMemory
+import GetClearedMemory
+import GetMemory
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $423
+byte 1 10
+byte 1 0
+align 1
+LABELV $335
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $331
+byte 1 94
+byte 1 49
+byte 1 85
+byte 1 78
+byte 1 75
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 78
+byte 1 32
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 32
+byte 1 84
+byte 1 89
+byte 1 80
+byte 1 69
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $329
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 70
+byte 1 85
+byte 1 78
+byte 1 67
+byte 1 66
+byte 1 79
+byte 1 66
+byte 1 0
+align 1
+LABELV $327
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 80
+byte 1 65
+byte 1 68
+byte 1 0
+align 1
+LABELV $325
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 70
+byte 1 69
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 0
+align 1
+LABELV $323
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 77
+byte 1 80
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 0
+align 1
+LABELV $321
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 68
+byte 1 79
+byte 1 85
+byte 1 66
+byte 1 76
+byte 1 69
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 0
+align 1
+LABELV $319
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 80
+byte 1 80
+byte 1 76
+byte 1 69
+byte 1 72
+byte 1 79
+byte 1 79
+byte 1 75
+byte 1 0
+align 1
+LABELV $317
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 0
+align 1
+LABELV $315
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 82
+byte 1 79
+byte 1 67
+byte 1 75
+byte 1 69
+byte 1 84
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 0
+align 1
+LABELV $313
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 86
+byte 1 65
+byte 1 84
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $311
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 0
+align 1
+LABELV $309
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 0
+align 1
+LABELV $307
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 87
+byte 1 73
+byte 1 77
+byte 1 0
+align 1
+LABELV $305
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 76
+byte 1 75
+byte 1 79
+byte 1 70
+byte 1 70
+byte 1 76
+byte 1 69
+byte 1 68
+byte 1 71
+byte 1 69
+byte 1 0
+align 1
+LABELV $303
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 65
+byte 1 68
+byte 1 68
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $301
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 0
+align 1
+LABELV $299
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 82
+byte 1 82
+byte 1 73
+byte 1 69
+byte 1 82
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 0
+align 1
+LABELV $297
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 67
+byte 1 82
+byte 1 79
+byte 1 85
+byte 1 67
+byte 1 72
+byte 1 0
+align 1
+LABELV $295
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 76
+byte 1 75
+byte 1 0
+align 1
+LABELV $293
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 86
+byte 1 65
+byte 1 76
+byte 1 73
+byte 1 68
+byte 1 0
+align 1
+LABELV $199
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 91
+byte 1 48
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $147
+byte 1 101
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $136
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
@@ -0,0 +1,876 @@
+export AAS_UpdateEntity
+code
+proc AAS_UpdateEntity 24 16
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $26
+CNSTI4 1
+ARGI4
+ADDRGP4 $29
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 3
+RETI4
+ADDRGP4 $25
+JUMPV
+LABELV $26
+ADDRLP4 0
+CNSTI4 12
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+312
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $31
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkFromAreas
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkFromBSPLeaves
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTP4 0
+ASGNP4
+CNSTI4 0
+RETI4
+ADDRGP4 $25
+JUMPV
+LABELV $31
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 aasworld+20
+INDIRI4
+CNSTI4 1
+NEI4 $33
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $34
+JUMPV
+LABELV $33
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $34
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $36
+ADDRFP4 0
+INDIRI4
+CNSTI4 4094
+EQI4 $38
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkFromAreas
+CALLV
+pop
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 12
+ADDRGP4 AAS_LinkEntityClientBBox
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkFromBSPLeaves
+CALLV
+pop
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 AAS_BSPLinkEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+LABELV $38
+LABELV $36
+CNSTI4 0
+RETI4
+LABELV $25
+endproc AAS_UpdateEntity 24 16
+export AAS_UpdateEntities
+proc AAS_UpdateEntities 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $41
+CNSTI4 1
+ARGI4
+ADDRGP4 $44
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 3
+RETI4
+ADDRGP4 $40
+JUMPV
+LABELV $41
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $48
+JUMPV
+LABELV $45
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 AAS_UpdateEntity
+CALLI4
+pop
+LABELV $46
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $48
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRI4
+LTI4 $45
+ADDRGP4 AAS_UnlinkInvalidEntities
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $40
+endproc AAS_UpdateEntities 8 8
+export AAS_ResetEntityLinks
+proc AAS_ResetEntityLinks 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $53
+JUMPV
+LABELV $50
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+312
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+CNSTP4 0
+ASGNP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+312
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $51
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $53
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+304
+INDIRI4
+LTI4 $50
+LABELV $49
+endproc AAS_ResetEntityLinks 4 0
+export AAS_InvalidateEntities
+proc AAS_InvalidateEntities 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $61
+JUMPV
+LABELV $58
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+312
+INDIRP4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $59
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $61
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+304
+INDIRI4
+LTI4 $58
+LABELV $57
+endproc AAS_InvalidateEntities 4 0
+export AAS_UnlinkInvalidEntities
+proc AAS_UnlinkInvalidEntities 8 4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $68
+JUMPV
+LABELV $65
+ADDRLP4 0
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+312
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $71
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkFromAreas
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkFromBSPLeaves
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $71
+LABELV $66
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $68
+ADDRLP4 4
+INDIRI4
+ADDRGP4 aasworld+304
+INDIRI4
+LTI4 $65
+LABELV $64
+endproc AAS_UnlinkInvalidEntities 8 4
+export AAS_NextEntity
+proc AAS_NextEntity 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $74
+CNSTI4 0
+RETI4
+ADDRGP4 $73
+JUMPV
+LABELV $74
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $79
+ADDRFP4 0
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $79
+JUMPV
+LABELV $78
+CNSTI4 12
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+312
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $82
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $73
+JUMPV
+LABELV $82
+LABELV $79
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+304
+INDIRI4
+LTI4 $78
+CNSTI4 0
+RETI4
+LABELV $73
+endproc AAS_NextEntity 4 0
+import aassettings
+import AAS_PrintFreeBSPLinks
+import AAS_EntityCollision
+import AAS_BSPLinkEntity
+import AAS_UnlinkFromBSPLeaves
+import AAS_DumpBSPData
+import AAS_LoadBSPFile
+import AAS_FileInfo
+import AAS_DumpAASData
+import AAS_FreeAASLump
+import AAS_WriteCompactAASFile
+import AAS_WriteAASFile
+import AAS_LoadCompactAASFile
+import AAS_LoadAASFile
+import AAS_ShutdownAlternativeRouting
+import AAS_InitAlternativeRouting
+import AAS_RoutingCacheInfo
+import AAS_RoutingInfo
+import AAS_ReadRouteTables
+import AAS_WriteRouteTables
+import AAS_WriteRouteCache
+import AAS_CreateAllRoutingCache
+import AAS_FreeRoutingCaches
+import AAS_InitRouting
+import AAS_BestReachableLinkArea
+import AAS_ContinueInitReachability
+import AAS_InitReachability
+import AAS_SetViewPortalsAsClusterPortals
+import AAS_InitClustering
+import AAS_SampleBenchmark
+import AAS_FreeFlatNodes
+import AAS_InitFlatNodes
+import AAS_FreeReachabilityAreaGrid
+import AAS_InitReachabilityAreaGrid
+import AAS_UnlinkFromAreas
+import AAS_InsideFace
+import AAS_PointInsideFace
+import AAS_LinkEntityClientBBox
+import AAS_AASLinkEntity
+import AAS_PlaneFromNum
+import AAS_TraceEndFace
+import AAS_AreaGroundFace
+import AAS_FreeAASLinkedEntities
+import AAS_FreeAASLinkHeap
+import AAS_InitAASLinkedEntities
+import AAS_InitAASLinkHeap
+import AAS_StartFrame
+import AAS_LoadMap
+import AAS_Shutdown
+import AAS_Setup
+import AAS_SetInitialized
+import AAS_Error
+import aasworld
+import botDeveloper
+import botimport
+import botlibglobals
+import AAS_InitSettings
+import AAS_DropToFloor
+import AAS_SetMovedir
+import AAS_HorizontalVelocityForJump
+import AAS_BFGJumpZVelocity
+import AAS_RocketJumpZVelocity
+import AAS_AgainstLadder
+import AAS_JumpReachRunStart
+import AAS_Swimming
+import AAS_OnGround
+import AAS_PlayerMovementHitBBox
+import AAS_PredictPlayerMovement
+import AAS_IntForBSPEpairKey
+import AAS_FloatForBSPEpairKey
+import AAS_VectorForBSPEpairKey
+import AAS_ValueForBSPEpairKey
+import AAS_NextBSPEntity
+import AAS_BSPModelMinsMaxsOrigin
+import AAS_BoxEntities
+import AAS_AreasConnected
+import AAS_inPHS
+import AAS_inPVS
+import AAS_PointContents
+import AAS_Trace
+import AAS_Optimize
+import AAS_FloodAreas
+import AAS_ShowReachableAreas
+import AAS_ShowReachability
+import AAS_DrawArrow
+import AAS_PrintTravelType
+import AAS_DrawCross
+import AAS_ShowAreaPolygons
+import AAS_ShowArea
+import AAS_ShowFace
+import AAS_ShowBoundingBox
+import AAS_DrawPlaneCross
+import AAS_DrawPermanentCross
+import AAS_PermanentLine
+import AAS_DebugLine
+import AAS_ClearShownPolygons
+import AAS_ClearShownDebugLines
+import AAS_AlternativeRouteGoals
+import AAS_PredictRoute
+import AAS_AreaTravelTimeToGoalArea
+import AAS_AreaTravelTime
+import AAS_EnableRoutingArea
+import AAS_RandomGoalArea
+import AAS_ReachabilityFromNum
+import AAS_NextAreaReachability
+import AAS_AreaContentsTravelFlags
+import AAS_TravelFlagForType
+import AAS_AreaDoNotEnter
+import AAS_AreaJumpPad
+import AAS_AreaLadder
+import AAS_AreaGrounded
+import AAS_AreaSlime
+import AAS_AreaLava
+import AAS_AreaLiquid
+import AAS_AreaSwim
+import AAS_AreaCrouch
+import AAS_AreaGroundFaceArea
+import AAS_NextModelReachability
+import AAS_BestReachableFromJumpPadArea
+import AAS_BestReachableArea
+import AAS_AreaReachability
+import AAS_FacePlane
+import AAS_PointReachabilityAreaIndex
+import AAS_PointAreaNum
+import AAS_AreaInfo
+import AAS_PointInsideArea
+import AAS_BBoxReachabilityAreas
+import AAS_BBoxAreas
+import AAS_TraceAreas
+import AAS_TracePlayerBBox
+import AAS_PointPresenceType
+import AAS_AreaPresenceType
+import AAS_AreaCluster
+import AAS_PresenceTypeBoundingBox
+import AAS_ProjectPointOntoVector
+import AAS_Time
+import AAS_Loaded
+import AAS_Initialized
+import GetBotLibAPI
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $44
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 85
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $29
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 85
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
@@ -0,0 +1,7184 @@
+export AAS_SwapAASData
+code
+proc AAS_SwapAASData 88 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $29
+JUMPV
+LABELV $26
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+164
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+164
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+164
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+164
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $35
+ADDRLP4 28
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 aasworld+164
+INDIRP4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 LittleFloatPtr
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 aasworld+164
+INDIRP4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 20
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 aasworld+164
+INDIRP4
+ADDP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 LittleFloatPtr
+CALLF4
+ASGNF4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 aasworld+164
+INDIRP4
+ADDP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+LABELV $36
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $35
+LABELV $27
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $29
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+160
+INDIRI4
+LTI4 $26
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $46
+JUMPV
+LABELV $43
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $48
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 LittleFloatPtr
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ADDP4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $49
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $48
+LABELV $44
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $46
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+168
+INDIRI4
+LTI4 $43
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $57
+JUMPV
+LABELV $54
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $59
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 LittleFloatPtr
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ADDP4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $60
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $59
+ADDRLP4 20
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 12
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 LittleFloatPtr
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 16
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $55
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $57
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+176
+INDIRI4
+LTI4 $54
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $72
+JUMPV
+LABELV $69
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $70
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $72
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+184
+INDIRI4
+LTI4 $69
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $81
+JUMPV
+LABELV $78
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $79
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $81
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+192
+INDIRI4
+LTI4 $78
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $88
+JUMPV
+LABELV $85
+ADDRLP4 8
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 12
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 16
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 20
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+LABELV $86
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $88
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+200
+INDIRI4
+LTI4 $85
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $105
+JUMPV
+LABELV $102
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $103
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $105
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+208
+INDIRI4
+LTI4 $102
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $112
+JUMPV
+LABELV $109
+ADDRLP4 8
+CNSTI4 48
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 48
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 48
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $120
+ADDRLP4 40
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 48
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 12
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 LittleFloatPtr
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 60
+CNSTI4 48
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 24
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 LittleFloatPtr
+CALLF4
+ASGNF4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 48
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 36
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 LittleFloatPtr
+CALLF4
+ASGNF4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 84
+INDIRF4
+ASGNF4
+LABELV $121
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $120
+LABELV $110
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $112
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $109
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $133
+JUMPV
+LABELV $130
+ADDRLP4 8
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 12
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 16
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 20
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 24
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+LABELV $131
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $133
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+224
+INDIRI4
+LTI4 $130
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $152
+JUMPV
+LABELV $149
+ADDRLP4 8
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $160
+ADDRLP4 40
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 12
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 LittleFloatPtr
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 60
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 24
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 LittleFloatPtr
+CALLF4
+ASGNF4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+LABELV $161
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $160
+ADDRLP4 40
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 36
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 40
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRU2
+CVUI4 2
+CVII2 4
+CVII4 2
+ARGI4
+ADDRLP4 60
+ADDRGP4 LittleShort
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRLP4 60
+INDIRI4
+CVII2 4
+CVII4 2
+CVIU4 4
+CVUU2 4
+ASGNU2
+LABELV $150
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $152
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+232
+INDIRI4
+LTI4 $149
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $175
+JUMPV
+LABELV $172
+ADDRLP4 8
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+244
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+244
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+244
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+244
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 aasworld+244
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 aasworld+244
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+LABELV $173
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $175
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+240
+INDIRI4
+LTI4 $172
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $186
+JUMPV
+LABELV $183
+ADDRLP4 8
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 12
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 16
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+LABELV $184
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $186
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+256
+INDIRI4
+LTI4 $183
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $201
+JUMPV
+LABELV $198
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+268
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+268
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $199
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $201
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+264
+INDIRI4
+LTI4 $198
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $208
+JUMPV
+LABELV $205
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 12
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $206
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $208
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+272
+INDIRI4
+LTI4 $205
+LABELV $25
+endproc AAS_SwapAASData 88 4
+export AAS_FreeAASLump
+proc AAS_FreeAASLump 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $219
+ADDRGP4 $218
+JUMPV
+LABELV $219
+ADDRGP4 aasworld+152
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $221
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 0
+INDIRU4
+ADDRGP4 aasworld+152
+INDIRP4
+CVPU4 4
+LTU4 $221
+ADDRLP4 0
+INDIRU4
+ADDRGP4 aasworld+156
+INDIRI4
+ADDRGP4 aasworld+152
+INDIRP4
+ADDP4
+CVPU4 4
+GEU4 $221
+ADDRGP4 $218
+JUMPV
+LABELV $221
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $218
+endproc AAS_FreeAASLump 4 4
+export AAS_DumpAASData
+proc AAS_DumpAASData 4 4
+ADDRGP4 aasworld+160
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+164
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+164
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+168
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+172
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+172
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+176
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+180
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+180
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+184
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+188
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+188
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+192
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+196
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+196
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+200
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+204
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+204
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+208
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+212
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+212
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+216
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+220
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+220
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+224
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+228
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+228
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+232
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+236
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+236
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+240
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+244
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+244
+CNSTP4 0
+ASGNP4
+ADDRGP4 AAS_FreeFlatNodes
+CALLV
+pop
+ADDRGP4 aasworld+256
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+260
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+260
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+256
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+268
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+268
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+264
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+276
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+276
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+272
+CNSTI4 0
+ASGNI4
+ADDRGP4 AAS_FreeReachabilityAreaGrid
+CALLV
+pop
+ADDRGP4 aasworld+152
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $271
+ADDRGP4 aasworld+152
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $271
+ADDRGP4 aasworld+152
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+156
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld+4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld+8
+CNSTI4 0
+ASGNI4
+LABELV $227
+endproc AAS_DumpAASData 4 4
+export AAS_LoadAASLump
+proc AAS_LoadAASLump 12 12
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $280
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+ARGU4
+ADDRLP4 4
+ADDRGP4 GetClearedHunkMemory
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+RETP4
+ADDRGP4 $279
+JUMPV
+LABELV $280
+ADDRFP4 4
+INDIRI4
+ADDRFP4 12
+INDIRP4
+INDIRI4
+EQI4 $282
+CNSTI4 2
+ARGI4
+ADDRGP4 $285
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+ADDRGP4 botimport+68
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $286
+ADDRGP4 $289
+ARGP4
+ADDRGP4 AAS_Error
+CALLV
+pop
+ADDRGP4 AAS_DumpAASData
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $279
+JUMPV
+LABELV $286
+LABELV $282
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+ARGU4
+ADDRLP4 4
+ADDRGP4 GetClearedHunkMemory
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $291
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 botimport+56
+INDIRP4
+CALLI4
+pop
+ADDRLP4 8
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $291
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $279
+endproc AAS_LoadAASLump 12 12
+export AAS_DData
+proc AAS_DData 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $298
+JUMPV
+LABELV $295
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU1
+CVUI4 1
+CNSTI4 119
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUU1 4
+CVUI4 1
+MULI4
+BXORI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+LABELV $296
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $298
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $295
+LABELV $294
+endproc AAS_DData 12 0
+export AAS_LoadAASFile
+proc AAS_LoadAASFile 328 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRGP4 $301
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 AAS_DumpAASData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 132
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 botimport+52
+INDIRP4
+CALLI4
+pop
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $303
+ADDRGP4 $305
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_Error
+CALLV
+pop
+CNSTI4 4
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $303
+ADDRLP4 4
+ARGP4
+CNSTI4 124
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 botimport+56
+INDIRP4
+CALLI4
+pop
+ADDRLP4 136
+CNSTI4 124
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1396785477
+EQI4 $307
+ADDRGP4 $309
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_Error
+CALLV
+pop
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+CNSTI4 5
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $307
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 4+4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 4
+EQI4 $313
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 5
+EQI4 $313
+ADDRGP4 $317
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4+4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 AAS_Error
+CALLV
+pop
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+CNSTI4 6
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $313
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 5
+NEI4 $320
+ADDRLP4 4+8
+ARGP4
+CNSTI4 116
+ARGI4
+ADDRGP4 AAS_DData
+CALLV
+pop
+LABELV $320
+ADDRGP4 $325
+ARGP4
+ADDRLP4 148
+ADDRGP4 LibVarGetString
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 aasworld+12
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 4+8
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+ADDRGP4 aasworld+12
+INDIRI4
+EQI4 $326
+ADDRGP4 $330
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_Error
+CALLV
+pop
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+CNSTI4 6
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $326
+ADDRLP4 4+12
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 4+12+4
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 168
+ADDRGP4 AAS_LoadAASLump
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+164
+ADDRLP4 168
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+160
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTI4 5
+RSHU4
+CVUI4 4
+ASGNI4
+ADDRGP4 aasworld+160
+INDIRI4
+CNSTI4 0
+EQI4 $337
+ADDRGP4 aasworld+164
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $337
+CNSTI4 7
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $337
+ADDRLP4 4+12+8
+INDIRI4
+ARGI4
+ADDRLP4 172
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 4+12+8+4
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRLP4 180
+ADDRGP4 AAS_LoadAASLump
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+172
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+168
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 12
+DIVU4
+CVUI4 4
+ASGNI4
+ADDRGP4 aasworld+168
+INDIRI4
+CNSTI4 0
+EQI4 $348
+ADDRGP4 aasworld+172
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $348
+CNSTI4 7
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $348
+ADDRLP4 4+12+16
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 4+12+16+4
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRLP4 192
+ADDRGP4 AAS_LoadAASLump
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+180
+ADDRLP4 192
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+176
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 20
+DIVU4
+CVUI4 4
+ASGNI4
+ADDRGP4 aasworld+176
+INDIRI4
+CNSTI4 0
+EQI4 $359
+ADDRGP4 aasworld+180
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $359
+CNSTI4 7
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $359
+ADDRLP4 4+12+24
+INDIRI4
+ARGI4
+ADDRLP4 196
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRLP4 4+12+24+4
+INDIRI4
+ARGI4
+ADDRLP4 200
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 204
+ADDRGP4 AAS_LoadAASLump
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+188
+ADDRLP4 204
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+184
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTI4 3
+RSHU4
+CVUI4 4
+ASGNI4
+ADDRGP4 aasworld+184
+INDIRI4
+CNSTI4 0
+EQI4 $370
+ADDRGP4 aasworld+188
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $370
+CNSTI4 7
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $370
+ADDRLP4 4+12+32
+INDIRI4
+ARGI4
+ADDRLP4 208
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 208
+INDIRI4
+ASGNI4
+ADDRLP4 4+12+32+4
+INDIRI4
+ARGI4
+ADDRLP4 212
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 216
+ADDRGP4 AAS_LoadAASLump
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+196
+ADDRLP4 216
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+192
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTI4 2
+RSHU4
+CVUI4 4
+ASGNI4
+ADDRGP4 aasworld+192
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRGP4 aasworld+196
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $381
+CNSTI4 7
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $381
+ADDRLP4 4+12+40
+INDIRI4
+ARGI4
+ADDRLP4 220
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 220
+INDIRI4
+ASGNI4
+ADDRLP4 4+12+40+4
+INDIRI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 224
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 24
+ARGI4
+ADDRLP4 228
+ADDRGP4 AAS_LoadAASLump
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+204
+ADDRLP4 228
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+200
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 24
+DIVU4
+CVUI4 4
+ASGNI4
+ADDRGP4 aasworld+200
+INDIRI4
+CNSTI4 0
+EQI4 $392
+ADDRGP4 aasworld+204
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $392
+CNSTI4 7
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $392
+ADDRLP4 4+12+48
+INDIRI4
+ARGI4
+ADDRLP4 232
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 232
+INDIRI4
+ASGNI4
+ADDRLP4 4+12+48+4
+INDIRI4
+ARGI4
+ADDRLP4 236
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 240
+ADDRGP4 AAS_LoadAASLump
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+212
+ADDRLP4 240
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+208
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTI4 2
+RSHU4
+CVUI4 4
+ASGNI4
+ADDRGP4 aasworld+208
+INDIRI4
+CNSTI4 0
+EQI4 $403
+ADDRGP4 aasworld+212
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $403
+CNSTI4 7
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $403
+ADDRLP4 4+12+56
+INDIRI4
+ARGI4
+ADDRLP4 244
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRLP4 4+12+56+4
+INDIRI4
+ARGI4
+ADDRLP4 248
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 48
+ARGI4
+ADDRLP4 252
+ADDRGP4 AAS_LoadAASLump
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+220
+ADDRLP4 252
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+216
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 48
+DIVU4
+CVUI4 4
+ASGNI4
+ADDRGP4 aasworld+216
+INDIRI4
+CNSTI4 0
+EQI4 $414
+ADDRGP4 aasworld+220
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $414
+CNSTI4 7
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $414
+ADDRLP4 4+12+64
+INDIRI4
+ARGI4
+ADDRLP4 256
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRLP4 4+12+64+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 28
+ARGI4
+ADDRLP4 264
+ADDRGP4 AAS_LoadAASLump
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+228
+ADDRLP4 264
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+224
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 28
+DIVU4
+CVUI4 4
+ASGNI4
+ADDRGP4 aasworld+224
+INDIRI4
+CNSTI4 0
+EQI4 $425
+ADDRGP4 aasworld+228
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $425
+CNSTI4 7
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $425
+ADDRLP4 4+12+72
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 4+12+72+4
+INDIRI4
+ARGI4
+ADDRLP4 272
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 44
+ARGI4
+ADDRLP4 276
+ADDRGP4 AAS_LoadAASLump
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+236
+ADDRLP4 276
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+232
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 44
+DIVU4
+CVUI4 4
+ASGNI4
+ADDRGP4 aasworld+232
+INDIRI4
+CNSTI4 0
+EQI4 $436
+ADDRGP4 aasworld+236
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $436
+CNSTI4 7
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $436
+ADDRLP4 4+12+80
+INDIRI4
+ARGI4
+ADDRLP4 280
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRLP4 4+12+80+4
+INDIRI4
+ARGI4
+ADDRLP4 284
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRLP4 288
+ADDRGP4 AAS_LoadAASLump
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+244
+ADDRLP4 288
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+240
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 12
+DIVU4
+CVUI4 4
+ASGNI4
+ADDRGP4 aasworld+240
+INDIRI4
+CNSTI4 0
+EQI4 $447
+ADDRGP4 aasworld+244
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $447
+CNSTI4 7
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $447
+ADDRLP4 4+12+88
+INDIRI4
+ARGI4
+ADDRLP4 292
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 4+12+88+4
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRLP4 300
+ADDRGP4 AAS_LoadAASLump
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+260
+ADDRLP4 300
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+256
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 20
+DIVU4
+CVUI4 4
+ASGNI4
+ADDRGP4 aasworld+256
+INDIRI4
+CNSTI4 0
+EQI4 $458
+ADDRGP4 aasworld+260
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $458
+CNSTI4 7
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $458
+ADDRLP4 4+12+96
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRLP4 4+12+96+4
+INDIRI4
+ARGI4
+ADDRLP4 308
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 312
+ADDRGP4 AAS_LoadAASLump
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+268
+ADDRLP4 312
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+264
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTI4 2
+RSHU4
+CVUI4 4
+ASGNI4
+ADDRGP4 aasworld+264
+INDIRI4
+CNSTI4 0
+EQI4 $469
+ADDRGP4 aasworld+268
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $469
+CNSTI4 7
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $469
+ADDRLP4 4+12+104
+INDIRI4
+ARGI4
+ADDRLP4 316
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRLP4 4+12+104+4
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRLP4 324
+ADDRGP4 AAS_LoadAASLump
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+276
+ADDRLP4 324
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+272
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTI4 4
+RSHU4
+CVUI4 4
+ASGNI4
+ADDRGP4 aasworld+272
+INDIRI4
+CNSTI4 0
+EQI4 $480
+ADDRGP4 aasworld+276
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $480
+CNSTI4 7
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $480
+ADDRGP4 AAS_SwapAASData
+CALLV
+pop
+ADDRGP4 aasworld
+CNSTI4 1
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $299
+endproc AAS_LoadAASFile 328 20
+proc AAS_LumpInfo 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ADDRGP4 aasworld+164
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 aasworld+160
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 32
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 aasworld+172
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 aasworld+168
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 aasworld+180
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 aasworld+176
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 20
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 aasworld+188
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRGP4 aasworld+184
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRGP4 aasworld+196
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 aasworld+192
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 aasworld+204
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 aasworld+200
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 24
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRGP4 aasworld+212
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRGP4 aasworld+208
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 aasworld+220
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 aasworld+216
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 48
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 aasworld+228
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRGP4 aasworld+224
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 28
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRGP4 aasworld+236
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 aasworld+232
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTI4 44
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRGP4 aasworld+244
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRGP4 aasworld+240
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRGP4 aasworld+260
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRGP4 aasworld+256
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+CNSTI4 20
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRGP4 aasworld+268
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRGP4 aasworld+264
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRGP4 aasworld+276
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRGP4 aasworld+272
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 16
+ASGNI4
+LABELV $485
+endproc AAS_LumpInfo 0 0
+proc AAS_CompactLumpPacked 8 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+EQI4 $518
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+NEI4 $516
+LABELV $518
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $517
+JUMPV
+LABELV $516
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $517
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $514
+endproc AAS_CompactLumpPacked 8 0
+proc AAS_PackIntegers 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTU4 0
+ASGNU4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $523
+JUMPV
+LABELV $520
+ADDRLP4 24
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CVIU4 4
+ADDRLP4 16
+INDIRU4
+SUBU4
+ASGNU4
+ADDRLP4 16
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 12
+INDIRU4
+CNSTI4 1
+LSHU4
+ADDRLP4 12
+INDIRU4
+CVUI4 4
+CNSTI4 31
+RSHI4
+CVIU4 4
+BXORU4
+ASGNU4
+ADDRGP4 $525
+JUMPV
+LABELV $524
+ADDRLP4 32
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRU4
+CNSTU4 128
+BORU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ADDRLP4 0
+INDIRU4
+CNSTI4 7
+RSHU4
+ASGNU4
+LABELV $525
+ADDRLP4 0
+INDIRU4
+CNSTU4 128
+GEU4 $524
+ADDRLP4 32
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $521
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $523
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $520
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $519
+endproc AAS_PackIntegers 36 0
+proc AAS_UnpackIntegers 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTU4 0
+ASGNU4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $531
+JUMPV
+LABELV $528
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $532
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+GEI4 $538
+ADDRLP4 0
+INDIRI4
+CNSTI4 28
+LEI4 $536
+LABELV $538
+CNSTI4 0
+RETI4
+ADDRGP4 $527
+JUMPV
+LABELV $536
+ADDRLP4 24
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 8
+INDIRU4
+ADDRLP4 28
+INDIRP4
+INDIRU1
+CVUI4 1
+CNSTI4 127
+BANDI4
+CVIU4 4
+ADDRLP4 0
+INDIRI4
+LSHU4
+BORU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+INDIRU1
+CVUI4 1
+CNSTI4 128
+BANDI4
+CNSTI4 0
+NEI4 $539
+ADDRGP4 $534
+JUMPV
+LABELV $539
+LABELV $533
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+ADDI4
+ASGNI4
+ADDRGP4 $532
+JUMPV
+LABELV $534
+ADDRLP4 16
+ADDRLP4 16
+INDIRU4
+ADDRLP4 8
+INDIRU4
+CNSTI4 1
+RSHU4
+ADDRLP4 8
+INDIRU4
+CNSTU4 1
+BANDU4
+CVUI4 4
+NEGI4
+CVIU4 4
+BXORU4
+ADDU4
+ASGNU4
+ADDRLP4 16
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 28
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $529
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $531
+ADDRLP4 12
+INDIRI4
+ADDRFP4 12
+INDIRI4
+LTI4 $528
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $542
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $543
+JUMPV
+LABELV $542
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $543
+ADDRLP4 24
+INDIRI4
+RETI4
+LABELV $527
+endproc AAS_UnpackIntegers 32 4
+proc AAS_AASFileStamp 212 16
+ADDRLP4 144
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $545
+ARGP4
+ADDRGP4 aasworld+88
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 144
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 208
+ADDRGP4 botimport+52
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 208
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $548
+CNSTI4 0
+RETI4
+ADDRGP4 $544
+JUMPV
+LABELV $548
+ADDRLP4 20
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 124
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 20
+ARGP4
+CNSTI4 124
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 botimport+56
+INDIRP4
+CALLI4
+pop
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+CNSTU4 2166136261
+ASGNU4
+ADDRLP4 8
+ADDRLP4 20
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $552
+ADDRLP4 4
+CNSTU4 16777619
+ADDRLP4 4
+INDIRU4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRU1
+CVUI4 1
+CVIU4 4
+BXORU4
+MULU4
+ASGNU4
+LABELV $553
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 124
+LTI4 $552
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $556
+ADDRLP4 4
+CNSTU4 16777619
+ADDRLP4 4
+INDIRU4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+RSHI4
+CNSTI4 255
+BANDI4
+CVIU4 4
+BXORU4
+MULU4
+ASGNU4
+LABELV $557
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $556
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $544
+endproc AAS_AASFileStamp 212 16
+export AAS_LoadCompactAASFile
+proc AAS_LoadCompactAASFile 292 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRGP4 $301
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 AAS_DumpAASData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 204
+ADDRGP4 botimport+52
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 188
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+NEI4 $563
+CNSTI4 4
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $563
+ADDRLP4 188
+INDIRI4
+CNSTI4 244
+GEI4 $565
+CNSTI4 2
+ARGI4
+ADDRGP4 $568
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRLP4 196
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+CNSTI4 5
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $565
+ADDRLP4 188
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRLP4 208
+ADDRGP4 GetHunkMemory
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+152
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+156
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld+152
+INDIRP4
+ARGP4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 196
+INDIRI4
+ARGI4
+ADDRLP4 212
+ADDRGP4 botimport+56
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $572
+CNSTI4 2
+ARGI4
+ADDRGP4 $577
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 AAS_DumpAASData
+CALLV
+pop
+ADDRLP4 196
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+CNSTI4 7
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $572
+ADDRLP4 196
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 aasworld+152
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 216
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 1129529665
+EQI4 $581
+CNSTI4 2
+ARGI4
+ADDRGP4 $568
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 AAS_DumpAASData
+CALLV
+pop
+CNSTI4 5
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $581
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 220
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 2
+NEI4 $586
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $584
+LABELV $586
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 228
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 232
+CNSTI4 2
+ASGNI4
+ADDRLP4 232
+INDIRI4
+ARGI4
+ADDRGP4 $588
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 228
+INDIRI4
+ARGI4
+ADDRLP4 232
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 AAS_DumpAASData
+CALLV
+pop
+CNSTI4 6
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $584
+ADDRGP4 $325
+ARGP4
+ADDRLP4 228
+ADDRGP4 LibVarGetString
+CALLP4
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 aasworld+12
+ADDRLP4 232
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 236
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+ADDRGP4 aasworld+12
+INDIRI4
+EQI4 $590
+CNSTI4 2
+ARGI4
+ADDRGP4 $594
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 AAS_DumpAASData
+CALLV
+pop
+CNSTI4 6
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $590
+ADDRLP4 200
+ARGP4
+ADDRLP4 240
+ADDRGP4 AAS_AASFileStamp
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+EQI4 $595
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 244
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+ADDRLP4 200
+INDIRI4
+EQI4 $595
+CNSTI4 2
+ARGI4
+ADDRGP4 $598
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 AAS_DumpAASData
+CALLV
+pop
+CNSTI4 6
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $595
+ADDRLP4 16
+ARGP4
+ADDRGP4 AAS_LumpInfo
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $599
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 248
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 252
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 252
+INDIRI4
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 256
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 244
+LTI4 $610
+ADDRLP4 272
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+BANDI4
+ADDRLP4 272
+INDIRI4
+NEI4 $610
+ADDRLP4 184
+INDIRI4
+ADDRLP4 272
+INDIRI4
+LTI4 $610
+ADDRLP4 184
+INDIRI4
+ADDRLP4 188
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+GTI4 $610
+ADDRLP4 4
+INDIRI4
+ADDRLP4 272
+INDIRI4
+LTI4 $610
+ADDRLP4 4
+INDIRI4
+CNSTI4 2147483647
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 16+8
+ADDP4
+INDIRI4
+DIVI4
+LEI4 $603
+LABELV $610
+ADDRGP4 $601
+JUMPV
+LABELV $603
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $611
+ADDRLP4 284
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+ADDRLP4 16+8
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+ARGU4
+ADDRLP4 288
+ADDRGP4 GetClearedHunkMemory
+CALLP4
+ASGNP4
+ADDRLP4 284
+INDIRI4
+ADDRLP4 16
+ADDP4
+INDIRP4
+ADDRLP4 288
+INDIRP4
+ASGNP4
+ADDRGP4 $612
+JUMPV
+LABELV $611
+ADDRLP4 192
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $614
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 16+8
+ADDP4
+INDIRI4
+CVIU4 4
+CNSTU4 4
+EQU4 $616
+ADDRGP4 $601
+JUMPV
+LABELV $616
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ARGU4
+ADDRLP4 284
+ADDRGP4 GetHunkMemory
+CALLP4
+ASGNP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 16
+ADDP4
+INDIRP4
+ADDRLP4 284
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 aasworld+152
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 184
+INDIRI4
+ARGI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 16
+ADDP4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 288
+ADDRGP4 AAS_UnpackIntegers
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+NEI4 $615
+ADDRGP4 $601
+JUMPV
+LABELV $614
+ADDRLP4 184
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 16+8
+ADDP4
+INDIRI4
+MULI4
+EQI4 $622
+ADDRGP4 $601
+JUMPV
+LABELV $622
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 16
+ADDP4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 aasworld+152
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $615
+LABELV $612
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 16+4
+ADDP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $600
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $599
+LABELV $601
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+GEI4 $627
+CNSTI4 2
+ARGI4
+ADDRGP4 $630
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 AAS_DumpAASData
+CALLV
+pop
+CNSTI4 7
+RETI4
+ADDRGP4 $560
+JUMPV
+LABELV $627
+ADDRGP4 aasworld
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+LABELV $560
+endproc AAS_LoadCompactAASFile 292 20
+export AAS_WriteAASLump
+proc AAS_WriteAASLump 16 12
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+ASGNP4
+ADDRGP4 AAS_WriteAASLump_offset
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+LEI4 $632
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 botimport+60
+INDIRP4
+CALLI4
+pop
+LABELV $632
+ADDRLP4 12
+ADDRGP4 AAS_WriteAASLump_offset
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $631
+endproc AAS_WriteAASLump 16 12
+export AAS_WriteAASFile
+proc AAS_WriteAASFile 200 20
+CNSTI4 1
+ARGI4
+ADDRGP4 $637
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 AAS_SwapAASData
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 124
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 1396785477
+ARGI4
+ADDRLP4 128
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 128
+INDIRI4
+ASGNI4
+CNSTI4 5
+ARGI4
+ADDRLP4 132
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld+12
+INDIRI4
+ARGI4
+ADDRLP4 136
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 124
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 botimport+52
+INDIRP4
+CALLI4
+pop
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+NEI4 $642
+CNSTI4 3
+ARGI4
+ADDRGP4 $645
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $642
+ADDRLP4 0
+ARGP4
+CNSTI4 124
+ARGI4
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRGP4 botimport+60
+INDIRP4
+CALLI4
+pop
+ADDRGP4 AAS_WriteAASLump_offset
+CNSTI4 124
+ASGNI4
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 aasworld+164
+INDIRP4
+ARGP4
+ADDRGP4 aasworld+160
+INDIRI4
+CVIU4 4
+CNSTI4 5
+LSHU4
+CVUI4 4
+ARGI4
+ADDRLP4 140
+ADDRGP4 AAS_WriteAASLump
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $647
+CNSTI4 0
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $647
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 aasworld+172
+INDIRP4
+ARGP4
+CNSTU4 12
+ADDRGP4 aasworld+168
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRLP4 144
+ADDRGP4 AAS_WriteAASLump
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $651
+CNSTI4 0
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $651
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 aasworld+180
+INDIRP4
+ARGP4
+CNSTU4 20
+ADDRGP4 aasworld+176
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRLP4 148
+ADDRGP4 AAS_WriteAASLump
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $655
+CNSTI4 0
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $655
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+CNSTI4 3
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRGP4 aasworld+188
+INDIRP4
+ARGP4
+ADDRGP4 aasworld+184
+INDIRI4
+CVIU4 4
+ADDRLP4 152
+INDIRI4
+LSHU4
+CVUI4 4
+ARGI4
+ADDRLP4 156
+ADDRGP4 AAS_WriteAASLump
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $659
+CNSTI4 0
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $659
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 aasworld+196
+INDIRP4
+ARGP4
+ADDRGP4 aasworld+192
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+CVUI4 4
+ARGI4
+ADDRLP4 160
+ADDRGP4 AAS_WriteAASLump
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $663
+CNSTI4 0
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $663
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRGP4 aasworld+204
+INDIRP4
+ARGP4
+CNSTU4 24
+ADDRGP4 aasworld+200
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRLP4 164
+ADDRGP4 AAS_WriteAASLump
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $667
+CNSTI4 0
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $667
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRGP4 aasworld+212
+INDIRP4
+ARGP4
+ADDRGP4 aasworld+208
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+CVUI4 4
+ARGI4
+ADDRLP4 168
+ADDRGP4 AAS_WriteAASLump
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $671
+CNSTI4 0
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $671
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 7
+ARGI4
+ADDRGP4 aasworld+220
+INDIRP4
+ARGP4
+CNSTU4 48
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRLP4 172
+ADDRGP4 AAS_WriteAASLump
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+NEI4 $675
+CNSTI4 0
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $675
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 aasworld+228
+INDIRP4
+ARGP4
+CNSTU4 28
+ADDRGP4 aasworld+224
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRLP4 176
+ADDRGP4 AAS_WriteAASLump
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+NEI4 $679
+CNSTI4 0
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $679
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 9
+ARGI4
+ADDRGP4 aasworld+236
+INDIRP4
+ARGP4
+CNSTU4 44
+ADDRGP4 aasworld+232
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRLP4 180
+ADDRGP4 AAS_WriteAASLump
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $683
+CNSTI4 0
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $683
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRGP4 aasworld+244
+INDIRP4
+ARGP4
+CNSTU4 12
+ADDRGP4 aasworld+240
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRLP4 184
+ADDRGP4 AAS_WriteAASLump
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+NEI4 $687
+CNSTI4 0
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $687
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 aasworld+260
+INDIRP4
+ARGP4
+CNSTU4 20
+ADDRGP4 aasworld+256
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRLP4 188
+ADDRGP4 AAS_WriteAASLump
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $691
+CNSTI4 0
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $691
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRGP4 aasworld+268
+INDIRP4
+ARGP4
+ADDRGP4 aasworld+264
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+CVUI4 4
+ARGI4
+ADDRLP4 192
+ADDRGP4 AAS_WriteAASLump
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $695
+CNSTI4 0
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $695
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 13
+ARGI4
+ADDRGP4 aasworld+276
+INDIRP4
+ARGP4
+ADDRGP4 aasworld+272
+INDIRI4
+CVIU4 4
+CNSTI4 4
+LSHU4
+CVUI4 4
+ARGI4
+ADDRLP4 196
+ADDRGP4 AAS_WriteAASLump
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+NEI4 $699
+CNSTI4 0
+RETI4
+ADDRGP4 $635
+JUMPV
+LABELV $699
+ADDRLP4 124
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 botimport+68
+INDIRP4
+CALLI4
+pop
+ADDRLP4 0+8
+ARGP4
+CNSTI4 116
+ARGI4
+ADDRGP4 AAS_DData
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 124
+ARGI4
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRGP4 botimport+60
+INDIRP4
+CALLI4
+pop
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $635
+endproc AAS_WriteAASFile 200 20
+bss
+align 1
+LABELV $708
+skip 16
+export AAS_WriteCompactAASFile
+code
+proc AAS_WriteCompactAASFile 536 12
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $709
+CNSTI4 3
+ARGI4
+ADDRGP4 $712
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $707
+JUMPV
+LABELV $709
+CNSTI4 1
+ARGI4
+ADDRGP4 $637
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 488
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 botimport+52
+INDIRP4
+CALLI4
+pop
+ADDRLP4 488
+INDIRI4
+CNSTI4 0
+NEI4 $715
+CNSTI4 3
+ARGI4
+ADDRGP4 $645
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $707
+JUMPV
+LABELV $715
+ADDRLP4 256
+ARGP4
+ADDRGP4 AAS_LumpInfo
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 244
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 484
+CNSTI4 244
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $718
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 424
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 496
+ADDRGP4 AAS_CompactLumpPacked
+CALLI4
+ASGNI4
+ADDRLP4 500
+CNSTI4 0
+ASGNI4
+ADDRLP4 496
+INDIRI4
+ADDRLP4 500
+INDIRI4
+EQI4 $722
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 256+4
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 500
+INDIRI4
+EQI4 $722
+CNSTI4 5
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 256+4
+ADDP4
+INDIRP4
+INDIRI4
+MULI4
+CVIU4 4
+ARGU4
+ADDRLP4 508
+ADDRGP4 GetMemory
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 424
+ADDP4
+ADDRLP4 508
+INDIRP4
+ASGNP4
+ADDRLP4 516
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+ADDRLP4 256
+ADDP4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 516
+INDIRI4
+ADDRLP4 256+4
+ADDP4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 424
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 520
+ADDRGP4 AAS_PackIntegers
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 520
+INDIRI4
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 524
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 12+20+12
+ADDP4
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRGP4 $723
+JUMPV
+LABELV $722
+ADDRLP4 504
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 504
+INDIRI4
+ADDRLP4 256+4
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 504
+INDIRI4
+ADDRLP4 256+8
+ADDP4
+INDIRI4
+MULI4
+ASGNI4
+LABELV $723
+ADDRLP4 484
+INDIRI4
+ARGI4
+ADDRLP4 504
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 12+20
+ADDP4
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 508
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 12+20+4
+ADDP4
+ADDRLP4 508
+INDIRI4
+ASGNI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 256+4
+ADDP4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 516
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 12+20+8
+ADDP4
+ADDRLP4 516
+INDIRI4
+ASGNI4
+ADDRLP4 484
+ADDRLP4 484
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 16
+ADDI4
+CNSTI4 1
+SUBI4
+CNSTI4 -16
+BANDI4
+ADDI4
+ASGNI4
+LABELV $719
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $718
+CNSTI4 1129529665
+ARGI4
+ADDRLP4 496
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 496
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 500
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld+12
+INDIRI4
+ARGI4
+ADDRLP4 504
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 12+8
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+ARGI4
+ADDRLP4 508
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 12+12
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRLP4 492
+ARGP4
+ADDRLP4 512
+ADDRGP4 AAS_AASFileStamp
+CALLI4
+ASGNI4
+ADDRLP4 512
+INDIRI4
+CNSTI4 0
+NEI4 $741
+ADDRLP4 492
+CNSTI4 0
+ASGNI4
+LABELV $741
+ADDRLP4 492
+INDIRI4
+ARGI4
+ADDRLP4 516
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 12+16
+ADDRLP4 516
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ARGP4
+CNSTI4 244
+ARGI4
+ADDRLP4 488
+INDIRI4
+ARGI4
+ADDRGP4 botimport+60
+INDIRP4
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $745
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 12+20+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 520
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 424
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $751
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 424
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 488
+INDIRI4
+ARGI4
+ADDRGP4 botimport+60
+INDIRP4
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 424
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+ADDRGP4 $752
+JUMPV
+LABELV $751
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $754
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $754
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRLP4 524
+ADDRGP4 GetMemory
+CALLP4
+ASGNP4
+ADDRLP4 480
+ADDRLP4 524
+INDIRP4
+ASGNP4
+ADDRLP4 480
+INDIRP4
+ARGP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 256
+ADDP4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $759
+JUMPV
+LABELV $756
+CNSTI4 8
+ARGI4
+ADDRLP4 528
+ADDRGP4 LittleLong
+CALLI4
+ASGNI4
+ADDRLP4 532
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 480
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 532
+INDIRP4
+ADDRLP4 532
+INDIRP4
+INDIRI4
+ADDRLP4 528
+INDIRI4
+BCOMI4
+BANDI4
+ASGNI4
+LABELV $757
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $759
+ADDRLP4 4
+INDIRI4
+ADDRGP4 aasworld+224
+INDIRI4
+LTI4 $756
+ADDRLP4 480
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 488
+INDIRI4
+ARGI4
+ADDRGP4 botimport+60
+INDIRP4
+CALLI4
+pop
+ADDRLP4 480
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+ADDRGP4 $755
+JUMPV
+LABELV $754
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $762
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 256
+ADDP4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 488
+INDIRI4
+ARGI4
+ADDRGP4 botimport+60
+INDIRP4
+CALLI4
+pop
+LABELV $762
+LABELV $755
+LABELV $752
+ADDRLP4 8
+INDIRI4
+CNSTI4 15
+BANDI4
+CNSTI4 0
+EQI4 $765
+ADDRGP4 $708
+ARGP4
+CNSTI4 16
+ADDRLP4 8
+INDIRI4
+CNSTI4 15
+BANDI4
+SUBI4
+ARGI4
+ADDRLP4 488
+INDIRI4
+ARGI4
+ADDRGP4 botimport+60
+INDIRP4
+CALLI4
+pop
+LABELV $765
+LABELV $746
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $745
+ADDRLP4 488
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $707
+endproc AAS_WriteCompactAASFile 536 12
+bss
+align 4
+LABELV AAS_WriteAASLump_offset
+skip 4
+import aassettings
+import AAS_PrintFreeBSPLinks
+import AAS_EntityCollision
+import AAS_BSPLinkEntity
+import AAS_UnlinkFromBSPLeaves
+import AAS_DumpBSPData
+import AAS_LoadBSPFile
+import AAS_FileInfo
+import AAS_ShutdownAlternativeRouting
+import AAS_InitAlternativeRouting
+import AAS_RoutingCacheInfo
+import AAS_RoutingInfo
+import AAS_ReadRouteTables
+import AAS_WriteRouteTables
+import AAS_WriteRouteCache
+import AAS_CreateAllRoutingCache
+import AAS_FreeRoutingCaches
+import AAS_InitRouting
+import AAS_BestReachableLinkArea
+import AAS_ContinueInitReachability
+import AAS_InitReachability
+import AAS_SetViewPortalsAsClusterPortals
+import AAS_InitClustering
+import AAS_SampleBenchmark
+import AAS_FreeFlatNodes
+import AAS_InitFlatNodes
+import AAS_FreeReachabilityAreaGrid
+import AAS_InitReachabilityAreaGrid
+import AAS_UnlinkFromAreas
+import AAS_InsideFace
+import AAS_PointInsideFace
+import AAS_LinkEntityClientBBox
+import AAS_AASLinkEntity
+import AAS_PlaneFromNum
+import AAS_TraceEndFace
+import AAS_AreaGroundFace
+import AAS_FreeAASLinkedEntities
+import AAS_FreeAASLinkHeap
+import AAS_InitAASLinkedEntities
+import AAS_InitAASLinkHeap
+import AAS_UpdateEntities
+import AAS_UpdateEntity
+import AAS_ResetEntityLinks
+import AAS_UnlinkInvalidEntities
+import AAS_InvalidateEntities
+import AAS_StartFrame
+import AAS_LoadMap
+import AAS_Shutdown
+import AAS_Setup
+import AAS_SetInitialized
+import AAS_Error
+import aasworld
+import botDeveloper
+import botimport
+import botlibglobals
+import AAS_InitSettings
+import AAS_DropToFloor
+import AAS_SetMovedir
+import AAS_HorizontalVelocityForJump
+import AAS_BFGJumpZVelocity
+import AAS_RocketJumpZVelocity
+import AAS_AgainstLadder
+import AAS_JumpReachRunStart
+import AAS_Swimming
+import AAS_OnGround
+import AAS_PlayerMovementHitBBox
+import AAS_PredictPlayerMovement
+import AAS_IntForBSPEpairKey
+import AAS_FloatForBSPEpairKey
+import AAS_VectorForBSPEpairKey
+import AAS_ValueForBSPEpairKey
+import AAS_NextBSPEntity
+import AAS_BSPModelMinsMaxsOrigin
+import AAS_BoxEntities
+import AAS_AreasConnected
+import AAS_inPHS
+import AAS_inPVS
+import AAS_PointContents
+import AAS_Trace
+import AAS_Optimize
+import AAS_FloodAreas
+import AAS_ShowReachableAreas
+import AAS_ShowReachability
+import AAS_DrawArrow
+import AAS_PrintTravelType
+import AAS_DrawCross
+import AAS_ShowAreaPolygons
+import AAS_ShowArea
+import AAS_ShowFace
+import AAS_ShowBoundingBox
+import AAS_DrawPlaneCross
+import AAS_DrawPermanentCross
+import AAS_PermanentLine
+import AAS_DebugLine
+import AAS_ClearShownPolygons
+import AAS_ClearShownDebugLines
+import AAS_AlternativeRouteGoals
+import AAS_PredictRoute
+import AAS_AreaTravelTimeToGoalArea
+import AAS_AreaTravelTime
+import AAS_EnableRoutingArea
+import AAS_RandomGoalArea
+import AAS_ReachabilityFromNum
+import AAS_NextAreaReachability
+import AAS_AreaContentsTravelFlags
+import AAS_TravelFlagForType
+import AAS_AreaDoNotEnter
+import AAS_AreaJumpPad
+import AAS_AreaLadder
+import AAS_AreaGrounded
+import AAS_AreaSlime
+import AAS_AreaLava
+import AAS_AreaLiquid
+import AAS_AreaSwim
+import AAS_AreaCrouch
+import AAS_AreaGroundFaceArea
+import AAS_NextModelReachability
+import AAS_BestReachableFromJumpPadArea
+import AAS_BestReachableArea
+import AAS_AreaReachability
+import AAS_FacePlane
+import AAS_PointReachabilityAreaIndex
+import AAS_PointAreaNum
+import AAS_AreaInfo
+import AAS_PointInsideArea
+import AAS_BBoxReachabilityAreas
+import AAS_BBoxAreas
+import AAS_TraceAreas
+import AAS_TracePlayerBBox
+import AAS_PointPresenceType
+import AAS_AreaPresenceType
+import AAS_AreaCluster
+import AAS_PresenceTypeBoundingBox
+import AAS_ProjectPointOntoVector
+import AAS_Time
+import AAS_Loaded
+import AAS_Initialized
+import GetBotLibAPI
+import LibVarSetNotModified
+import LibVarChanged
+import LibVarSet
+import LibVarString
+import LibVarValue
+import LibVar
+import LibVarGetValue
+import LibVarGetString
+import LibVarGet
+import LibVarDeAllocAll
+import DumpMemory
+import MemoryByteSize
+import PrintMemoryLabels
+import PrintUsedMemorySize
+import AvailableMemory
+import FreeMemory
+import GetClearedHunkMemory
+import GetHunkMemory
+import GetClearedMemory
+import GetMemory
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $712
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $645
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $637
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $630
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $598
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $594
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $588
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $577
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $568
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $545
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 0
+align 1
+LABELV $330
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $325
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $317
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $309
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $305
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $301
+byte 1 116
+byte 1 114
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $289
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $285
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 10
+byte 1 0
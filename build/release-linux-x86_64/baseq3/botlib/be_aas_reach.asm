@@ -0,0 +1,27687 @@
+export AAS_FaceArea
+code
+proc AAS_FaceArea 120 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+GEI4 $28
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+ADDRGP4 $29
+JUMPV
+LABELV $28
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $29
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 64
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRGP4 $35
+JUMPV
+LABELV $32
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+GEI4 $38
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $39
+JUMPV
+LABELV $38
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $39
+ADDRLP4 0
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 72
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 76
+CNSTI4 12
+ASGNI4
+ADDRLP4 80
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 76
+INDIRI4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 88
+CNSTI4 4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 92
+CNSTI4 8
+ASGNI4
+ADDRLP4 12+8
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $54
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+ADDRGP4 $55
+JUMPV
+LABELV $54
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+LABELV $55
+ADDRLP4 24
+CNSTI4 12
+ADDRLP4 96
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $56
+ADDRLP4 100
+CNSTI4 1
+ASGNI4
+ADDRGP4 $57
+JUMPV
+LABELV $56
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+LABELV $57
+ADDRLP4 108
+CNSTI4 4
+ASGNI4
+ADDRLP4 24+4
+CNSTI4 12
+ADDRLP4 100
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $58
+ADDRLP4 104
+CNSTI4 1
+ASGNI4
+ADDRGP4 $59
+JUMPV
+LABELV $58
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+LABELV $59
+ADDRLP4 112
+CNSTI4 8
+ASGNI4
+ADDRLP4 24+8
+CNSTI4 12
+ADDRLP4 104
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 44
+ARGP4
+ADDRLP4 116
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 56
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 116
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $33
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $35
+ADDRLP4 40
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+LTI4 $32
+ADDRLP4 56
+INDIRF4
+RETF4
+LABELV $25
+endproc AAS_FaceArea 120 12
+export AAS_AreaVolume
+proc AAS_AreaVolume 84 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 24
+ADDRLP4 56
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 60
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 12
+ADDRLP4 52
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $70
+JUMPV
+LABELV $67
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 24
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $74
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $75
+JUMPV
+LABELV $74
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $75
+ADDRLP4 32
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 20
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+BXORI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+NEGF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 AAS_FaceArea
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 44
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $68
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $70
+ADDRLP4 8
+INDIRI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $67
+ADDRLP4 44
+ADDRLP4 44
+INDIRF4
+CNSTF4 1077936128
+DIVF4
+ASGNF4
+ADDRLP4 44
+INDIRF4
+RETF4
+LABELV $60
+endproc AAS_AreaVolume 84 4
+export AAS_BestReachableLinkArea
+proc AAS_BestReachableLinkArea 12 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $83
+JUMPV
+LABELV $80
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 AAS_AreaGrounded
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $86
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 AAS_AreaSwim
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $84
+LABELV $86
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $79
+JUMPV
+LABELV $84
+LABELV $81
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $83
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $80
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $90
+JUMPV
+LABELV $87
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $91
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $79
+JUMPV
+LABELV $91
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $93
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $79
+JUMPV
+LABELV $93
+LABELV $88
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $90
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $87
+CNSTI4 0
+RETI4
+LABELV $79
+endproc AAS_BestReachableLinkArea 12 4
+export AAS_GetJumpPadInfo
+proc AAS_GetJumpPadInfo 604 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $96
+ARGP4
+ADDRLP4 376
+ARGP4
+ADDRGP4 AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 376
+INDIRF4
+CNSTF4 0
+NEF4 $97
+ADDRLP4 376
+CNSTF4 1148846080
+ASGNF4
+LABELV $97
+ADDRLP4 520
+CNSTF4 0
+ASGNF4
+ADDRLP4 292+8
+ADDRLP4 520
+INDIRF4
+ASGNF4
+ADDRLP4 292+4
+ADDRLP4 520
+INDIRF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 520
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $101
+ARGP4
+ADDRLP4 380
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 380
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $102
+ADDRLP4 380+1
+ARGP4
+ADDRLP4 524
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 508
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRGP4 $103
+JUMPV
+LABELV $102
+ADDRLP4 508
+CNSTI4 0
+ASGNI4
+LABELV $103
+ADDRLP4 508
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 AAS_BSPModelMinsMaxsOrigin
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 532
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 532
+INDIRP4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 532
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 536
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 536
+INDIRP4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 536
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 544
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 544
+INDIRP4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 544
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 548
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 548
+INDIRP4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 548
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 560
+CNSTI4 4
+ASGNI4
+ADDRLP4 4+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 560
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 560
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 564
+CNSTI4 8
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 564
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 564
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 568
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4
+ADDRLP4 568
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 568
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1056964608
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 364
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 364+8
+ADDRLP4 364+8
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+ASGNF4
+ADDRLP4 304
+ARGP4
+ADDRLP4 364
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $116
+CNSTI4 1
+ARGI4
+ADDRGP4 $119
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRGP4 $117
+JUMPV
+LABELV $116
+ADDRFP4 4
+INDIRP4
+ADDRLP4 304+8
+INDIRB
+ASGNB 12
+LABELV $117
+ADDRLP4 572
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 572
+INDIRP4
+ADDRLP4 572
+INDIRP4
+INDIRF4
+CNSTF4 1040187392
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $121
+ARGP4
+ADDRLP4 144
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 576
+ADDRGP4 AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 576
+INDIRI4
+ASGNI4
+ADDRGP4 $125
+JUMPV
+LABELV $122
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $128
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 580
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 580
+INDIRI4
+CNSTI4 0
+NEI4 $126
+ADDRGP4 $123
+JUMPV
+LABELV $126
+ADDRLP4 16
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 584
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 584
+INDIRI4
+CNSTI4 0
+NEI4 $129
+ADDRGP4 $124
+JUMPV
+LABELV $129
+LABELV $123
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 580
+ADDRGP4 AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 580
+INDIRI4
+ASGNI4
+LABELV $125
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $122
+LABELV $124
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $131
+CNSTI4 1
+ARGI4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $95
+JUMPV
+LABELV $131
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $135
+ARGP4
+ADDRLP4 276
+ARGP4
+ADDRGP4 AAS_VectorForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 512
+ADDRLP4 276+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 360
+ADDRGP4 aassettings+20
+INDIRF4
+ASGNF4
+ADDRLP4 512
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 360
+INDIRF4
+MULF4
+DIVF4
+ARGF4
+ADDRLP4 584
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 288
+ADDRLP4 584
+INDIRF4
+ASGNF4
+ADDRLP4 288
+INDIRF4
+CNSTF4 0
+NEF4 $139
+CNSTI4 1
+ARGI4
+ADDRGP4 $142
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $95
+JUMPV
+LABELV $139
+ADDRFP4 16
+INDIRP4
+ADDRLP4 276
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 276+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 276+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 588
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 516
+ADDRLP4 588
+INDIRF4
+ASGNF4
+ADDRLP4 272
+ADDRLP4 516
+INDIRF4
+ADDRLP4 288
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 272
+CNSTF4 1066192077
+ADDRLP4 272
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 596
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 596
+INDIRP4
+ADDRLP4 596
+INDIRP4
+INDIRF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 600
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 600
+INDIRP4
+ADDRLP4 600
+INDIRP4
+INDIRF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 288
+INDIRF4
+ADDRLP4 360
+INDIRF4
+MULF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $95
+endproc AAS_GetJumpPadInfo 604 24
+export AAS_BestReachableFromJumpPadArea
+proc AAS_BestReachableFromJumpPadArea 416 56
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $148
+ARGP4
+ADDRGP4 $149
+ARGP4
+ADDRLP4 344
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRLP4 340
+ADDRLP4 344
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 356
+CNSTI4 4
+ASGNI4
+ADDRLP4 316+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 356
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 356
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 360
+CNSTI4 8
+ASGNI4
+ADDRLP4 316+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 360
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 360
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 328
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 372
+CNSTI4 4
+ASGNI4
+ADDRLP4 328+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 372
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 372
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 376
+CNSTI4 8
+ASGNI4
+ADDRLP4 328+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 376
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 376
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 0
+ARGI4
+ADDRLP4 380
+ADDRGP4 AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $157
+JUMPV
+LABELV $154
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 $160
+ARGP4
+ADDRLP4 188
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 384
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 384
+INDIRI4
+CNSTI4 0
+NEI4 $158
+ADDRGP4 $155
+JUMPV
+LABELV $158
+ADDRLP4 188
+ARGP4
+ADDRGP4 $163
+ARGP4
+ADDRLP4 388
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 0
+EQI4 $161
+ADDRGP4 $155
+JUMPV
+LABELV $161
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 164
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRLP4 392
+ADDRGP4 AAS_GetJumpPadInfo
+CALLI4
+ASGNI4
+ADDRLP4 392
+INDIRI4
+CNSTI4 0
+NEI4 $164
+ADDRGP4 $155
+JUMPV
+LABELV $164
+ADDRLP4 152
+ARGP4
+ADDRLP4 164
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 396
+ADDRGP4 AAS_LinkEntityClientBBox
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 396
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRGP4 $169
+JUMPV
+LABELV $166
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 400
+ADDRGP4 AAS_AreaJumpPad
+CALLI4
+ASGNI4
+ADDRLP4 400
+INDIRI4
+CNSTI4 0
+EQI4 $170
+ADDRGP4 $168
+JUMPV
+LABELV $170
+LABELV $167
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $169
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $166
+LABELV $168
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $172
+CNSTI4 1
+ARGI4
+ADDRGP4 $175
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkFromAreas
+CALLV
+pop
+ADDRGP4 $155
+JUMPV
+LABELV $172
+ADDRLP4 400
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ADDRLP4 400
+INDIRF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 400
+INDIRF4
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 36
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 104
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 36
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 140
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 404
+CNSTI4 0
+ASGNI4
+ADDRLP4 404
+INDIRI4
+ARGI4
+ADDRLP4 176
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 404
+INDIRI4
+ARGI4
+CNSTI4 30
+ARGI4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 316
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRLP4 340
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 AAS_PlayerMovementHitBBox
+CALLI4
+pop
+ADDRLP4 36+100
+INDIRI4
+CNSTI4 30
+GEI4 $178
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRGP4 $184
+JUMPV
+LABELV $181
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 408
+ADDRGP4 AAS_AreaJumpPad
+CALLI4
+ASGNI4
+ADDRLP4 408
+INDIRI4
+CNSTI4 0
+NEI4 $185
+ADDRGP4 $182
+JUMPV
+LABELV $185
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ADDRGP4 AAS_AreaVolume
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 412
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LTF4 $187
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $187
+LABELV $182
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $184
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $181
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkFromAreas
+CALLV
+pop
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $147
+JUMPV
+LABELV $178
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkFromAreas
+CALLV
+pop
+LABELV $155
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 384
+ADDRGP4 AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 384
+INDIRI4
+ASGNI4
+LABELV $157
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $154
+CNSTI4 0
+RETI4
+LABELV $147
+endproc AAS_BestReachableFromJumpPadArea 416 56
+export AAS_BestReachableArea
+proc AAS_BestReachableArea 172 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $190
+CNSTI4 3
+ARGI4
+ADDRGP4 $193
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $189
+JUMPV
+LABELV $190
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRLP4 128
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 $197
+JUMPV
+LABELV $194
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $201
+JUMPV
+LABELV $198
+ADDRLP4 24
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $205
+JUMPV
+LABELV $202
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $209
+JUMPV
+LABELV $206
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 132
+CNSTF4 1082130432
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 136
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 136
+INDIRI4
+ASGNI4
+LABELV $207
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $209
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+GTI4 $212
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $206
+LABELV $212
+LABELV $203
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $205
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+GTI4 $213
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $202
+LABELV $213
+LABELV $199
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $201
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+GEI4 $214
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $198
+LABELV $214
+LABELV $195
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $197
+ADDRLP4 28
+INDIRI4
+CNSTI4 5
+GEI4 $215
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $194
+LABELV $215
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $216
+ADDRLP4 116
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1048576000
+ADDF4
+ASGNF4
+ADDRLP4 116+8
+ADDRLP4 116+8
+INDIRF4
+CNSTF4 1112014848
+SUBF4
+ASGNF4
+ADDRLP4 60
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 116
+ARGP4
+CNSTI4 4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $220
+ADDRLP4 60+8
+ARGP4
+ADDRLP4 132
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 60+8
+INDIRB
+ASGNB 12
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $221
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $189
+JUMPV
+LABELV $220
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $189
+JUMPV
+LABELV $221
+LABELV $216
+ADDRFP4 12
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 140
+CNSTI4 4
+ASGNI4
+ADDRLP4 32+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 144
+CNSTI4 8
+ASGNI4
+ADDRLP4 32+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 156
+CNSTI4 4
+ASGNI4
+ADDRLP4 44+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 160
+CNSTI4 8
+ASGNI4
+ADDRLP4 44+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 164
+ADDRGP4 AAS_LinkEntityClientBBox
+CALLP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 AAS_BestReachableLinkArea
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkFromAreas
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $189
+endproc AAS_BestReachableArea 172 24
+export AAS_SetupReachabilityHeap
+proc AAS_SetupReachabilityHeap 20 4
+CNSTU4 3145728
+ARGU4
+ADDRLP4 4
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRGP4 reachabilityheap
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $231
+ADDRLP4 8
+CNSTI4 48
+ASGNI4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 reachabilityheap
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRP4
+ADDP4
+CNSTI4 44
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ADDRLP4 16
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $232
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 65535
+LTI4 $231
+ADDRGP4 reachabilityheap
+INDIRP4
+CNSTI4 3145724
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 nextreachability
+ADDRGP4 reachabilityheap
+INDIRP4
+ASGNP4
+ADDRGP4 numlreachabilities
+CNSTI4 0
+ASGNI4
+LABELV $230
+endproc AAS_SetupReachabilityHeap 20 4
+export AAS_ShutDownReachabilityHeap
+proc AAS_ShutDownReachabilityHeap 0 4
+ADDRGP4 reachabilityheap
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+ADDRGP4 numlreachabilities
+CNSTI4 0
+ASGNI4
+LABELV $235
+endproc AAS_ShutDownReachabilityHeap 0 4
+export AAS_AllocReachability
+proc AAS_AllocReachability 16 4
+ADDRGP4 nextreachability
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $237
+CNSTP4 0
+RETP4
+ADDRGP4 $236
+JUMPV
+LABELV $237
+ADDRGP4 nextreachability
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $239
+ADDRGP4 $241
+ARGP4
+ADDRGP4 AAS_Error
+CALLV
+pop
+LABELV $239
+ADDRLP4 4
+ADDRGP4 nextreachability
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 numlreachabilities
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $236
+endproc AAS_AllocReachability 16 4
+export AAS_FreeReachability
+proc AAS_FreeReachability 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 48
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRGP4 nextreachability
+INDIRP4
+ASGNP4
+ADDRGP4 nextreachability
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 numlreachabilities
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $242
+endproc AAS_FreeReachability 4 12
+export AAS_AreaReachability
+proc AAS_AreaReachability 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $247
+ADDRFP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $244
+LABELV $247
+ADDRGP4 $248
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 AAS_Error
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $243
+JUMPV
+LABELV $244
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+RETI4
+LABELV $243
+endproc AAS_AreaReachability 4 8
+export AAS_AreaGroundFaceArea
+proc AAS_AreaGroundFaceArea 28 4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $255
+JUMPV
+LABELV $252
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 24
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $258
+ADDRGP4 $253
+JUMPV
+LABELV $258
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 AAS_FaceArea
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $253
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $255
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $252
+ADDRLP4 12
+INDIRF4
+RETF4
+LABELV $250
+endproc AAS_AreaGroundFaceArea 28 4
+export AAS_FaceCenter
+proc AAS_FaceCenter 68 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 24
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $265
+JUMPV
+LABELV $262
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 8
+ASGNI4
+ADDRLP4 44
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 4
+ASGNI4
+ADDRLP4 56
+ADDRFP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+CNSTI4 8
+ASGNI4
+ADDRLP4 64
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $263
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $265
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $262
+ADDRLP4 12
+CNSTF4 1056964608
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+LABELV $260
+endproc AAS_FaceCenter 68 4
+export AAS_FallDamageDistance
+proc AAS_FallDamageDistance 24 4
+CNSTF4 1217559552
+ARGF4
+ADDRLP4 12
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 aassettings+20
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 4
+INDIRF4
+MULF4
+CVFI4 4
+RETI4
+LABELV $274
+endproc AAS_FallDamageDistance 24 4
+export AAS_FallDelta
+proc AAS_FallDelta 24 4
+ADDRLP4 4
+ADDRGP4 aassettings+20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+CNSTF4 1073741824
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+CNSTF4 953267991
+ADDRLP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+MULF4
+RETF4
+LABELV $276
+endproc AAS_FallDelta 24 4
+export AAS_MaxJumpHeight
+proc AAS_MaxJumpHeight 12 0
+ADDRLP4 0
+ADDRGP4 aassettings+20
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+MULF4
+RETF4
+LABELV $278
+endproc AAS_MaxJumpHeight 12 0
+export AAS_MaxJumpDistance
+proc AAS_MaxJumpDistance 16 4
+ADDRLP4 0
+ADDRGP4 aassettings+20
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 aassettings+32
+INDIRF4
+ASGNF4
+ADDRGP4 aassettings+156
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRF4
+MULF4
+DIVF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+DIVF4
+ADDF4
+MULF4
+RETF4
+LABELV $280
+endproc AAS_MaxJumpDistance 16 4
+export AAS_AreaCrouch
+proc AAS_AreaCrouch 0 0
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $285
+CNSTI4 1
+RETI4
+ADDRGP4 $284
+JUMPV
+LABELV $285
+CNSTI4 0
+RETI4
+LABELV $284
+endproc AAS_AreaCrouch 0 0
+export AAS_AreaSwim
+proc AAS_AreaSwim 4 0
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $289
+CNSTI4 1
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $289
+CNSTI4 0
+RETI4
+LABELV $288
+endproc AAS_AreaSwim 4 0
+export AAS_AreaLiquid
+proc AAS_AreaLiquid 4 0
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $293
+CNSTI4 1
+RETI4
+ADDRGP4 $292
+JUMPV
+LABELV $293
+CNSTI4 0
+RETI4
+LABELV $292
+endproc AAS_AreaLiquid 4 0
+export AAS_AreaLava
+proc AAS_AreaLava 0 0
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+RETI4
+LABELV $296
+endproc AAS_AreaLava 0 0
+export AAS_AreaSlime
+proc AAS_AreaSlime 0 0
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+RETI4
+LABELV $298
+endproc AAS_AreaSlime 0 0
+export AAS_AreaGrounded
+proc AAS_AreaGrounded 0 0
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+RETI4
+LABELV $300
+endproc AAS_AreaGrounded 0 0
+export AAS_AreaLadder
+proc AAS_AreaLadder 0 0
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+RETI4
+LABELV $302
+endproc AAS_AreaLadder 0 0
+export AAS_AreaJumpPad
+proc AAS_AreaJumpPad 0 0
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+RETI4
+LABELV $304
+endproc AAS_AreaJumpPad 0 0
+export AAS_AreaTeleporter
+proc AAS_AreaTeleporter 0 0
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+RETI4
+LABELV $306
+endproc AAS_AreaTeleporter 0 0
+export AAS_AreaClusterPortal
+proc AAS_AreaClusterPortal 0 0
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+RETI4
+LABELV $308
+endproc AAS_AreaClusterPortal 0 0
+export AAS_AreaDoNotEnter
+proc AAS_AreaDoNotEnter 0 0
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+RETI4
+LABELV $310
+endproc AAS_AreaDoNotEnter 0 0
+export AAS_BarrierJumpTravelTime
+proc AAS_BarrierJumpTravelTime 12 0
+ADDRLP4 4
+ADDRGP4 aassettings+76
+INDIRF4
+CNSTF4 1036831949
+ADDRGP4 aassettings+20
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LTF4 $316
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $317
+JUMPV
+LABELV $316
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $317
+ADDRLP4 0
+INDIRU4
+CVUU2 4
+CVUI4 2
+RETI4
+LABELV $312
+endproc AAS_BarrierJumpTravelTime 12 0
+export AAS_ReachabilityExists
+proc AAS_ReachabilityExists 4 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $322
+JUMPV
+LABELV $319
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $323
+CNSTI4 1
+RETI4
+ADDRGP4 $318
+JUMPV
+LABELV $323
+LABELV $320
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $322
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $319
+CNSTI4 0
+RETI4
+LABELV $318
+endproc AAS_ReachabilityExists 4 0
+export AAS_NearbySolidOrGap
+proc AAS_NearbySolidOrGap 76 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 48
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1111490560
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 52
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $333
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $336
+CNSTI4 1
+RETI4
+ADDRGP4 $325
+JUMPV
+LABELV $336
+LABELV $333
+ADDRLP4 60
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1115684864
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 64
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $342
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 AAS_AreaSwim
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $344
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 AAS_AreaGrounded
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $344
+CNSTI4 1
+RETI4
+ADDRGP4 $325
+JUMPV
+LABELV $344
+LABELV $342
+CNSTI4 0
+RETI4
+LABELV $325
+endproc AAS_NearbySolidOrGap 76 4
+export AAS_Reachability_Swim
+proc AAS_Reachability_Swim 112 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 AAS_AreaSwim
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $349
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 AAS_AreaSwim
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $347
+LABELV $349
+CNSTI4 0
+RETI4
+ADDRGP4 $346
+JUMPV
+LABELV $347
+CNSTI4 28
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $350
+CNSTI4 0
+RETI4
+ADDRGP4 $346
+JUMPV
+LABELV $350
+ADDRLP4 60
+CNSTI4 48
+ASGNI4
+ADDRLP4 44
+ADDRLP4 60
+INDIRI4
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 60
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+LABELV $355
+ADDRLP4 64
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+LEF4 $359
+CNSTI4 0
+RETI4
+ADDRGP4 $346
+JUMPV
+LABELV $359
+ADDRLP4 68
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 68
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+GEF4 $361
+CNSTI4 0
+RETI4
+ADDRGP4 $346
+JUMPV
+LABELV $361
+LABELV $356
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 3
+LTI4 $355
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 $366
+JUMPV
+LABELV $363
+ADDRLP4 8
+ADDRLP4 44
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $369
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $370
+JUMPV
+LABELV $369
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+LABELV $370
+ADDRLP4 48
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $374
+JUMPV
+LABELV $371
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $376
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 AAS_FaceCenter
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+ADDRLP4 76
+ADDRGP4 AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $378
+ADDRLP4 40
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 80
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $381
+CNSTI4 0
+RETI4
+ADDRGP4 $346
+JUMPV
+LABELV $381
+ADDRLP4 0
+INDIRP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 20
+INDIRB
+ASGNB 12
+ADDRLP4 32
+CNSTI4 20
+ADDRLP4 40
+INDIRP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+BXORI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 32
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTU2 1
+ASGNU2
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 AAS_AreaVolume
+CALLF4
+ASGNF4
+ADDRLP4 96
+INDIRF4
+CNSTF4 1145569280
+GEF4 $384
+ADDRLP4 100
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRU2
+CVUI4 2
+CNSTI4 200
+ADDI4
+CVIU4 4
+CVUU2 4
+ASGNU2
+LABELV $384
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 104
+ADDRGP4 reach_swim
+ASGNP4
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+ADDRLP4 108
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+RETI4
+ADDRGP4 $346
+JUMPV
+LABELV $378
+LABELV $376
+LABELV $372
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $374
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $371
+LABELV $364
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $366
+ADDRLP4 36
+INDIRI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $363
+CNSTI4 0
+RETI4
+LABELV $346
+endproc AAS_Reachability_Swim 112 8
+lit
+align 4
+LABELV $387
+byte 4 0
+byte 4 0
+byte 4 3212836864
+export AAS_Reachability_EqualFloorHeight
+code
+proc AAS_Reachability_EqualFloorHeight 376 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 192
+ADDRGP4 $387
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 AAS_AreaGrounded
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+EQI4 $390
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 208
+ADDRGP4 AAS_AreaGrounded
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+NEI4 $388
+LABELV $390
+CNSTI4 0
+RETI4
+ADDRGP4 $386
+JUMPV
+LABELV $388
+ADDRLP4 212
+CNSTI4 48
+ASGNI4
+ADDRLP4 184
+ADDRLP4 212
+INDIRI4
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRLP4 212
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+LABELV $393
+ADDRLP4 216
+ADDRLP4 180
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+ADDRLP4 184
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 216
+INDIRI4
+ADDRLP4 176
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+LEF4 $397
+CNSTI4 0
+RETI4
+ADDRGP4 $386
+JUMPV
+LABELV $397
+ADDRLP4 220
+ADDRLP4 180
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+ADDRLP4 184
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 220
+INDIRI4
+ADDRLP4 176
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+GEF4 $399
+CNSTI4 0
+RETI4
+ADDRGP4 $386
+JUMPV
+LABELV $399
+LABELV $394
+ADDRLP4 180
+ADDRLP4 180
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 2
+LTI4 $393
+ADDRLP4 176
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 184
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+LEF4 $401
+CNSTI4 0
+RETI4
+ADDRGP4 $386
+JUMPV
+LABELV $401
+ADDRLP4 132
+ADDRLP4 192
+INDIRB
+ASGNB 12
+ADDRLP4 132
+ARGP4
+ADDRGP4 VectorInverse
+CALLV
+pop
+ADDRLP4 144
+CNSTF4 1203982208
+ASGNF4
+ADDRLP4 164
+CNSTF4 0
+ASGNF4
+ADDRLP4 216
+CNSTI4 0
+ASGNI4
+ADDRLP4 168
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ARGP4
+ADDRLP4 216
+INDIRI4
+ARGI4
+CNSTU4 48
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+ADDRGP4 $406
+JUMPV
+LABELV $403
+ADDRLP4 184
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 180
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 220
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 156
+CNSTI4 24
+ADDRLP4 220
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 224
+CNSTI4 4
+ASGNI4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 224
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 224
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $409
+ADDRGP4 $404
+JUMPV
+LABELV $409
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRGP4 $414
+JUMPV
+LABELV $411
+ADDRLP4 176
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 172
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 228
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 128
+CNSTI4 24
+ADDRLP4 228
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 232
+CNSTI4 4
+ASGNI4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 232
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 232
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $417
+ADDRGP4 $412
+JUMPV
+LABELV $417
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRGP4 $422
+JUMPV
+LABELV $419
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRGP4 $426
+JUMPV
+LABELV $423
+ADDRLP4 156
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 236
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 124
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 240
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+ADDRLP4 240
+INDIRI4
+EQI4 $427
+ADDRGP4 $424
+JUMPV
+LABELV $427
+ADDRLP4 116
+ADDRLP4 156
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+GEI4 $433
+ADDRLP4 244
+CNSTI4 1
+ASGNI4
+ADDRGP4 $434
+JUMPV
+LABELV $433
+ADDRLP4 244
+CNSTI4 0
+ASGNI4
+LABELV $434
+ADDRLP4 40
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 248
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 248
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 252
+CNSTI4 12
+ASGNI4
+ADDRLP4 260
+CNSTI4 4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 12
+INDIRP4
+ADDRLP4 260
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 252
+INDIRI4
+ADDRLP4 264
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 252
+INDIRI4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44+4
+ADDRLP4 252
+INDIRI4
+ADDRLP4 264
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ADDRLP4 260
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 252
+INDIRI4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ADDRLP4 260
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268
+CNSTI4 12
+ASGNI4
+ADDRLP4 276
+CNSTI4 8
+ASGNI4
+ADDRLP4 44+8
+ADDRLP4 268
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ADDRLP4 276
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 268
+INDIRI4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ADDRLP4 276
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44
+ARGP4
+ADDRLP4 280
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 284
+CNSTI4 12
+ASGNI4
+ADDRLP4 292
+CNSTI4 4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 12
+INDIRP4
+ADDRLP4 292
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 284
+INDIRI4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 284
+INDIRI4
+ADDRLP4 296
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 284
+INDIRI4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ADDRLP4 292
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 284
+INDIRI4
+ADDRLP4 296
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ADDRLP4 292
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 300
+CNSTI4 12
+ASGNI4
+ADDRLP4 308
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 300
+INDIRI4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 300
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ADDRLP4 308
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 312
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 312
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 312
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $467
+ADDRLP4 316
+CNSTI4 1
+ASGNI4
+ADDRGP4 $468
+JUMPV
+LABELV $467
+ADDRLP4 316
+CNSTI4 0
+ASGNI4
+LABELV $468
+ADDRLP4 332
+CNSTI4 12
+ASGNI4
+ADDRLP4 336
+CNSTI4 2
+ASGNI4
+ADDRLP4 56
+ADDRLP4 332
+INDIRI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 332
+INDIRI4
+ADDRLP4 316
+INDIRI4
+ADDRLP4 336
+INDIRI4
+LSHI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $469
+ADDRLP4 320
+CNSTI4 1
+ASGNI4
+ADDRGP4 $470
+JUMPV
+LABELV $469
+ADDRLP4 320
+CNSTI4 0
+ASGNI4
+LABELV $470
+ADDRLP4 348
+CNSTI4 12
+ASGNI4
+ADDRLP4 56+4
+ADDRLP4 348
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 336
+INDIRI4
+LSHI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 348
+INDIRI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $471
+ADDRLP4 324
+CNSTI4 1
+ASGNI4
+ADDRGP4 $472
+JUMPV
+LABELV $471
+ADDRLP4 324
+CNSTI4 0
+ASGNI4
+LABELV $472
+ADDRLP4 356
+CNSTI4 12
+ASGNI4
+ADDRLP4 56+8
+ADDRLP4 356
+INDIRI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 356
+INDIRI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160
+CNSTI4 20
+ADDRLP4 128
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 360
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 360
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 360
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 28+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 364
+CNSTF4 1036831949
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 364
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 364
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 28+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+CNSTF4 1040187392
+ADDF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 132
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 132+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 132+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 144
+INDIRF4
+LTF4 $493
+ADDRLP4 120
+INDIRF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+GEF4 $491
+ADDRLP4 148
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LEF4 $491
+LABELV $493
+ADDRLP4 144
+ADDRLP4 120
+INDIRF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 148
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 68+4
+CNSTI4 0
+ASGNI4
+ADDRLP4 68+8
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 68+12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 68+24
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRLP4 68+36
+CNSTI4 2
+ASGNI4
+ADDRLP4 68+40
+CNSTU2 1
+ASGNU2
+ADDRLP4 168
+CNSTI4 1
+ASGNI4
+LABELV $491
+LABELV $424
+ADDRLP4 124
+ADDRLP4 124
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $426
+ADDRLP4 124
+INDIRI4
+ADDRLP4 128
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $423
+LABELV $420
+ADDRLP4 152
+ADDRLP4 152
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $422
+ADDRLP4 152
+INDIRI4
+ADDRLP4 156
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $419
+LABELV $412
+ADDRLP4 172
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $414
+ADDRLP4 172
+INDIRI4
+ADDRLP4 176
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $411
+LABELV $404
+ADDRLP4 180
+ADDRLP4 180
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $406
+ADDRLP4 180
+INDIRI4
+ADDRLP4 184
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $403
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $500
+ADDRLP4 220
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 188
+ADDRLP4 220
+INDIRP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $502
+CNSTI4 0
+RETI4
+ADDRGP4 $386
+JUMPV
+LABELV $502
+ADDRLP4 188
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 188
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 68+4
+INDIRI4
+ASGNI4
+ADDRLP4 188
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 68+8
+INDIRI4
+ASGNI4
+ADDRLP4 188
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 68+12
+INDIRB
+ASGNB 12
+ADDRLP4 188
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 68+24
+INDIRB
+ASGNB 12
+ADDRLP4 188
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 68+36
+INDIRI4
+ASGNI4
+ADDRLP4 188
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 68+40
+INDIRU2
+ASGNU2
+ADDRLP4 188
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 188
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 AAS_AreaCrouch
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $510
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 228
+ADDRGP4 AAS_AreaCrouch
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+EQI4 $510
+ADDRLP4 236
+ADDRLP4 188
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 240
+ADDRLP4 236
+INDIRP4
+INDIRU2
+CVUI4 2
+CVIF4 4
+ADDRGP4 aassettings+104
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 244
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 240
+INDIRF4
+ADDRLP4 244
+INDIRF4
+LTF4 $514
+ADDRLP4 232
+ADDRLP4 240
+INDIRF4
+ADDRLP4 244
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $515
+JUMPV
+LABELV $514
+ADDRLP4 232
+ADDRLP4 240
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $515
+ADDRLP4 236
+INDIRP4
+ADDRLP4 232
+INDIRU4
+CVUU2 4
+ASGNU2
+LABELV $510
+ADDRLP4 232
+ADDRGP4 reach_equalfloor
+ASGNP4
+ADDRLP4 236
+CNSTI4 1
+ASGNI4
+ADDRLP4 232
+INDIRP4
+ADDRLP4 232
+INDIRP4
+INDIRI4
+ADDRLP4 236
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+RETI4
+ADDRGP4 $386
+JUMPV
+LABELV $500
+CNSTI4 0
+RETI4
+LABELV $386
+endproc AAS_Reachability_EqualFloorHeight 376 12
+lit
+align 4
+LABELV $517
+byte 4 0
+byte 4 0
+byte 4 0
+align 4
+LABELV $518
+byte 4 0
+byte 4 0
+byte 4 0
+align 4
+LABELV $519
+byte 4 0
+byte 4 0
+byte 4 0
+align 4
+LABELV $520
+byte 4 0
+byte 4 0
+byte 4 0
+align 4
+LABELV $521
+byte 4 0
+byte 4 0
+byte 4 0
+align 4
+LABELV $522
+byte 4 0
+byte 4 0
+byte 4 0
+align 4
+LABELV $523
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export AAS_Reachability_Step_Barrier_WaterJump_WalkOffLedge
+code
+proc AAS_Reachability_Step_Barrier_WaterJump_WalkOffLedge 716 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 340
+ADDRGP4 $517
+INDIRB
+ASGNB 12
+ADDRLP4 304
+ADDRGP4 $518
+INDIRB
+ASGNB 12
+ADDRLP4 292
+ADDRGP4 $519
+INDIRB
+ASGNB 12
+ADDRLP4 364
+ADDRGP4 $520
+INDIRB
+ASGNB 12
+ADDRLP4 316
+ADDRGP4 $521
+INDIRB
+ASGNB 12
+ADDRLP4 328
+ADDRGP4 $522
+INDIRB
+ASGNB 12
+ADDRLP4 260
+ADDRGP4 $523
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 544
+ADDRGP4 AAS_AreaGrounded
+CALLI4
+ASGNI4
+ADDRLP4 544
+INDIRI4
+CNSTI4 0
+NEI4 $524
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 548
+ADDRGP4 AAS_AreaSwim
+CALLI4
+ASGNI4
+ADDRLP4 548
+INDIRI4
+CNSTI4 0
+NEI4 $524
+CNSTI4 0
+RETI4
+ADDRGP4 $516
+JUMPV
+LABELV $524
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 552
+ADDRGP4 AAS_AreaGrounded
+CALLI4
+ASGNI4
+ADDRLP4 552
+INDIRI4
+CNSTI4 0
+NEI4 $526
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 556
+ADDRGP4 AAS_AreaSwim
+CALLI4
+ASGNI4
+ADDRLP4 556
+INDIRI4
+CNSTI4 0
+NEI4 $526
+CNSTI4 0
+RETI4
+ADDRGP4 $516
+JUMPV
+LABELV $526
+ADDRLP4 560
+CNSTI4 48
+ASGNI4
+ADDRLP4 412
+ADDRLP4 560
+INDIRI4
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 376
+ADDRLP4 560
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 568
+ADDRGP4 AAS_AreaSwim
+CALLI4
+ASGNI4
+ADDRLP4 428
+ADDRLP4 568
+INDIRI4
+ASGNI4
+ADDRLP4 404
+CNSTI4 0
+ASGNI4
+LABELV $530
+ADDRLP4 572
+ADDRLP4 404
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 572
+INDIRI4
+ADDRLP4 412
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 572
+INDIRI4
+ADDRLP4 376
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+LEF4 $534
+CNSTI4 0
+RETI4
+ADDRGP4 $516
+JUMPV
+LABELV $534
+ADDRLP4 576
+ADDRLP4 404
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 576
+INDIRI4
+ADDRLP4 412
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 576
+INDIRI4
+ADDRLP4 376
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+GEF4 $536
+CNSTI4 0
+RETI4
+ADDRGP4 $516
+JUMPV
+LABELV $536
+LABELV $531
+ADDRLP4 404
+ADDRLP4 404
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 404
+INDIRI4
+CNSTI4 2
+LTI4 $530
+ADDRLP4 572
+CNSTI4 0
+ASGNI4
+ADDRLP4 288
+ADDRLP4 572
+INDIRI4
+ASGNI4
+ADDRLP4 576
+CNSTF4 1203982208
+ASGNF4
+ADDRLP4 248
+ADDRLP4 576
+INDIRF4
+ASGNF4
+ADDRLP4 580
+CNSTF4 0
+ASGNF4
+ADDRLP4 272
+ADDRLP4 580
+INDIRF4
+ASGNF4
+ADDRLP4 356
+ADDRLP4 572
+INDIRI4
+ASGNI4
+ADDRLP4 352
+ADDRLP4 572
+INDIRI4
+ASGNI4
+ADDRLP4 252
+ADDRLP4 576
+INDIRF4
+ASGNF4
+ADDRLP4 276
+ADDRLP4 580
+INDIRF4
+ASGNF4
+ADDRLP4 360
+ADDRLP4 572
+INDIRI4
+ASGNI4
+ADDRLP4 404
+ADDRLP4 572
+INDIRI4
+ASGNI4
+ADDRGP4 $541
+JUMPV
+LABELV $538
+ADDRLP4 416
+ADDRLP4 412
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 404
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 416
+INDIRI4
+CNSTI4 0
+GEI4 $544
+ADDRLP4 584
+CNSTI4 1
+ASGNI4
+ADDRGP4 $545
+JUMPV
+LABELV $544
+ADDRLP4 584
+CNSTI4 0
+ASGNI4
+LABELV $545
+ADDRLP4 408
+ADDRLP4 584
+INDIRI4
+ASGNI4
+ADDRLP4 416
+INDIRI4
+ARGI4
+ADDRLP4 588
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 256
+CNSTI4 24
+ADDRLP4 588
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 592
+CNSTI4 4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+ADDRLP4 592
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 592
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $547
+ADDRLP4 428
+INDIRI4
+CNSTI4 0
+EQI4 $539
+ADDRLP4 408
+INDIRI4
+CNSTI4 0
+NEI4 $553
+ADDRLP4 596
+CNSTI4 1
+ASGNI4
+ADDRGP4 $554
+JUMPV
+LABELV $553
+ADDRLP4 596
+CNSTI4 0
+ASGNI4
+LABELV $554
+ADDRLP4 420
+CNSTI4 20
+ADDRLP4 256
+INDIRP4
+INDIRI4
+ADDRLP4 596
+INDIRI4
+BXORI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 420
+INDIRP4
+INDIRF4
+ADDRLP4 260
+INDIRF4
+MULF4
+ADDRLP4 420
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 260+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 420
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 260+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1060320051
+GEF4 $550
+ADDRGP4 $539
+JUMPV
+LABELV $550
+LABELV $547
+ADDRLP4 396
+CNSTI4 0
+ASGNI4
+ADDRGP4 $562
+JUMPV
+LABELV $559
+ADDRLP4 280
+ADDRLP4 256
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 396
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+GEI4 $565
+ADDRLP4 596
+CNSTI4 1
+ASGNI4
+ADDRGP4 $566
+JUMPV
+LABELV $565
+ADDRLP4 596
+CNSTI4 0
+ASGNI4
+LABELV $566
+ADDRLP4 380
+ADDRLP4 596
+INDIRI4
+ASGNI4
+ADDRLP4 600
+CNSTI4 4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+ADDRLP4 600
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 600
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $567
+ADDRLP4 380
+INDIRI4
+ADDRLP4 408
+INDIRI4
+NEI4 $570
+ADDRLP4 604
+CNSTI4 1
+ASGNI4
+ADDRGP4 $571
+JUMPV
+LABELV $570
+ADDRLP4 604
+CNSTI4 0
+ASGNI4
+LABELV $571
+ADDRLP4 380
+ADDRLP4 604
+INDIRI4
+ASGNI4
+LABELV $567
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRLP4 608
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 608
+INDIRI4
+ASGNI4
+ADDRLP4 400
+ADDRLP4 280
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 380
+INDIRI4
+CNSTI4 0
+NEI4 $575
+ADDRLP4 612
+CNSTI4 1
+ASGNI4
+ADDRGP4 $576
+JUMPV
+LABELV $575
+ADDRLP4 612
+CNSTI4 0
+ASGNI4
+LABELV $576
+ADDRLP4 616
+CNSTI4 2
+ASGNI4
+ADDRLP4 64
+CNSTI4 12
+ADDRLP4 612
+INDIRI4
+ADDRLP4 616
+INDIRI4
+LSHI4
+ADDRLP4 400
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 76
+CNSTI4 12
+ADDRLP4 380
+INDIRI4
+ADDRLP4 616
+INDIRI4
+LSHI4
+ADDRLP4 400
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 384
+ADDRLP4 76
+INDIRF4
+ADDRLP4 64
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 384+4
+ADDRLP4 76+4
+INDIRF4
+ADDRLP4 64+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 384+8
+ADDRLP4 76+8
+INDIRF4
+ADDRLP4 64+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 384
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 52
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 116
+ADDRLP4 52
+INDIRF4
+ADDRLP4 64
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 64+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 64+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 284
+CNSTI4 0
+ASGNI4
+ADDRGP4 $591
+JUMPV
+LABELV $588
+ADDRLP4 376
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 284
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 624
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 224
+CNSTI4 24
+ADDRLP4 624
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 628
+CNSTI4 4
+ASGNI4
+ADDRLP4 224
+INDIRP4
+ADDRLP4 628
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 628
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $594
+ADDRGP4 $589
+JUMPV
+LABELV $594
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRGP4 $599
+JUMPV
+LABELV $596
+ADDRLP4 224
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 188
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 632
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 228
+ADDRLP4 632
+INDIRI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 228
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 636
+CNSTI4 12
+ASGNI4
+ADDRLP4 12
+ADDRLP4 636
+INDIRI4
+ADDRLP4 192
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ADDRLP4 636
+INDIRI4
+ADDRLP4 192
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 88
+ADDRLP4 52
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 116
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 88
+INDIRF4
+CNSTF4 3184315597
+LTF4 $610
+ADDRLP4 88
+INDIRF4
+CNSTF4 1036831949
+LEF4 $608
+LABELV $610
+ADDRGP4 $597
+JUMPV
+LABELV $608
+ADDRLP4 88
+ADDRLP4 52
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 116
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 88
+INDIRF4
+CNSTF4 3184315597
+LTF4 $617
+ADDRLP4 88
+INDIRF4
+CNSTF4 1036831949
+LEF4 $615
+LABELV $617
+ADDRGP4 $597
+JUMPV
+LABELV $615
+ADDRLP4 260
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 652
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 652
+INDIRF4
+ADDRLP4 652
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 64+8
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 76+8
+INDIRF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 12+8
+INDIRF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 24+8
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 64
+INDIRF4
+ADDRLP4 652
+INDIRF4
+MULF4
+ADDRLP4 64+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 64+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 144
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 76
+INDIRF4
+ADDRLP4 652
+INDIRF4
+MULF4
+ADDRLP4 76+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 76+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 144
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 12
+INDIRF4
+ADDRLP4 652
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 144
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 24
+INDIRF4
+ADDRLP4 652
+INDIRF4
+MULF4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 144
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 44
+INDIRF4
+LEF4 $642
+ADDRLP4 152
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRLP4 152
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRLP4 232
+ADDRLP4 64
+INDIRB
+ASGNB 12
+ADDRLP4 64
+ADDRLP4 76
+INDIRB
+ASGNB 12
+ADDRLP4 76
+ADDRLP4 232
+INDIRB
+ASGNB 12
+LABELV $642
+ADDRLP4 40
+INDIRF4
+ADDRLP4 48
+INDIRF4
+LEF4 $644
+ADDRLP4 152
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRLP4 152
+ADDRLP4 176
+INDIRF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 184
+INDIRF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRLP4 232
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRLP4 24
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ADDRLP4 232
+INDIRB
+ASGNB 12
+LABELV $644
+ADDRLP4 44
+INDIRF4
+ADDRLP4 40
+INDIRF4
+LEF4 $648
+ADDRLP4 48
+INDIRF4
+ADDRLP4 36
+INDIRF4
+GTF4 $646
+LABELV $648
+ADDRGP4 $597
+JUMPV
+LABELV $646
+ADDRLP4 664
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 664
+INDIRF4
+SUBF4
+ADDRLP4 40
+INDIRF4
+GEF4 $649
+ADDRLP4 48
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 664
+INDIRF4
+ADDF4
+GEF4 $649
+ADDRLP4 40
+INDIRF4
+ADDRLP4 664
+INDIRF4
+SUBF4
+ADDRLP4 36
+INDIRF4
+GEF4 $649
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 664
+INDIRF4
+ADDF4
+GEF4 $649
+ADDRLP4 148
+ADDRLP4 176
+INDIRF4
+ADDRLP4 172
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 168
+ADDRLP4 184
+INDIRF4
+ADDRLP4 180
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 64
+INDIRB
+ASGNB 12
+ADDRLP4 208
+ADDRLP4 76
+INDIRB
+ASGNB 12
+ADDRLP4 92
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 104
+ADDRLP4 24
+INDIRB
+ASGNB 12
+ADDRGP4 $650
+JUMPV
+LABELV $649
+ADDRLP4 688
+CNSTF4 1036831949
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 688
+INDIRF4
+SUBF4
+LEF4 $651
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 688
+INDIRF4
+ADDF4
+GEF4 $651
+ADDRLP4 148
+ADDRLP4 176
+INDIRF4
+ADDRLP4 172
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 64
+INDIRB
+ASGNB 12
+ADDRLP4 92
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRGP4 $652
+JUMPV
+LABELV $651
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+GEF4 $653
+ADDRLP4 244
+ADDRLP4 172
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+DIVF4
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 176
+INDIRF4
+ADDRLP4 244
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 196+8
+ADDRLP4 244
+INDIRF4
+ASGNF4
+ADDRLP4 92
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRGP4 $654
+JUMPV
+LABELV $653
+ADDRLP4 244
+ADDRLP4 176
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ADDRLP4 184
+INDIRF4
+ADDRLP4 176
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+DIVF4
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 244
+INDIRF4
+ADDRLP4 172
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 64
+INDIRB
+ASGNB 12
+ADDRLP4 92
+ADDRLP4 64
+INDIRB
+ASGNB 12
+ADDRLP4 92+8
+ADDRLP4 244
+INDIRF4
+ASGNF4
+LABELV $654
+LABELV $652
+ADDRLP4 700
+CNSTF4 1036831949
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 700
+INDIRF4
+SUBF4
+LEF4 $657
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 700
+INDIRF4
+ADDF4
+GEF4 $657
+ADDRLP4 168
+ADDRLP4 184
+INDIRF4
+ADDRLP4 180
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 208
+ADDRLP4 76
+INDIRB
+ASGNB 12
+ADDRLP4 104
+ADDRLP4 24
+INDIRB
+ASGNB 12
+ADDRGP4 $658
+JUMPV
+LABELV $657
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+GEF4 $659
+ADDRLP4 244
+ADDRLP4 176
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ADDRLP4 184
+INDIRF4
+ADDRLP4 176
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+DIVF4
+ADDF4
+ASGNF4
+ADDRLP4 168
+ADDRLP4 244
+INDIRF4
+ADDRLP4 180
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 208
+ADDRLP4 76
+INDIRB
+ASGNB 12
+ADDRLP4 104
+ADDRLP4 76
+INDIRB
+ASGNB 12
+ADDRLP4 104+8
+ADDRLP4 244
+INDIRF4
+ASGNF4
+ADDRGP4 $660
+JUMPV
+LABELV $659
+ADDRLP4 244
+ADDRLP4 172
+INDIRF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 172
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+DIVF4
+ADDF4
+ASGNF4
+ADDRLP4 168
+ADDRLP4 184
+INDIRF4
+ADDRLP4 244
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 208
+ADDRLP4 24
+INDIRB
+ASGNB 12
+ADDRLP4 208+8
+ADDRLP4 244
+INDIRF4
+ASGNF4
+ADDRLP4 104
+ADDRLP4 24
+INDIRB
+ASGNB 12
+LABELV $660
+LABELV $658
+LABELV $650
+ADDRLP4 688
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 148
+INDIRF4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 688
+INDIRF4
+SUBF4
+LEF4 $663
+ADDRLP4 148
+INDIRF4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 688
+INDIRF4
+ADDF4
+GEF4 $663
+ADDRLP4 116
+ADDRLP4 148
+INDIRF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 196
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 196+4
+INDIRF4
+ADDRLP4 208+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 196+8
+INDIRF4
+ADDRLP4 208+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 692
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 120
+ADDRLP4 692
+INDIRF4
+ADDRLP4 120
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 692
+INDIRF4
+ADDRLP4 120+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 120+8
+CNSTF4 1056964608
+ADDRLP4 120+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 92
+INDIRF4
+ADDRLP4 104
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 92+4
+INDIRF4
+ADDRLP4 104+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 92+8
+INDIRF4
+ADDRLP4 104+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 696
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 132
+ADDRLP4 696
+INDIRF4
+ADDRLP4 132
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 696
+INDIRF4
+ADDRLP4 132+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 132+8
+CNSTF4 1056964608
+ADDRLP4 132+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $664
+JUMPV
+LABELV $663
+ADDRLP4 148
+INDIRF4
+ADDRLP4 168
+INDIRF4
+GEF4 $685
+ADDRLP4 116
+ADDRLP4 148
+INDIRF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 196
+INDIRB
+ASGNB 12
+ADDRLP4 132
+ADDRLP4 92
+INDIRB
+ASGNB 12
+ADDRGP4 $686
+JUMPV
+LABELV $685
+ADDRLP4 116
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 208
+INDIRB
+ASGNB 12
+ADDRLP4 132
+ADDRLP4 104
+INDIRB
+ASGNB 12
+LABELV $686
+LABELV $664
+ADDRLP4 156
+ADDRLP4 104
+INDIRF4
+ADDRLP4 92
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156+4
+ADDRLP4 104+4
+INDIRF4
+ADDRLP4 92+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156+8
+ADDRLP4 104+8
+INDIRF4
+ADDRLP4 92+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+ARGP4
+ADDRLP4 692
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 220
+ADDRLP4 692
+INDIRF4
+ASGNF4
+ADDRLP4 696
+CNSTI4 4
+ASGNI4
+ADDRLP4 256
+INDIRP4
+ADDRLP4 696
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 696
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $693
+ADDRLP4 116
+INDIRF4
+ADDRLP4 248
+INDIRF4
+LTF4 $697
+ADDRLP4 116
+INDIRF4
+ADDRLP4 248
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+GEF4 $694
+ADDRLP4 220
+INDIRF4
+ADDRLP4 272
+INDIRF4
+LEF4 $694
+LABELV $697
+ADDRLP4 248
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 272
+ADDRLP4 220
+INDIRF4
+ASGNF4
+ADDRLP4 288
+CNSTI4 1
+ASGNI4
+ADDRLP4 356
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRLP4 340
+ADDRLP4 120
+INDIRB
+ASGNB 12
+ADDRLP4 292
+ADDRLP4 52
+INDIRB
+ASGNB 12
+ADDRLP4 304
+ADDRLP4 132
+INDIRB
+ASGNB 12
+ADDRGP4 $694
+JUMPV
+LABELV $693
+ADDRLP4 116
+INDIRF4
+ADDRLP4 252
+INDIRF4
+LTF4 $700
+ADDRLP4 116
+INDIRF4
+ADDRLP4 252
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+GEF4 $698
+ADDRLP4 220
+INDIRF4
+ADDRLP4 276
+INDIRF4
+LEF4 $698
+LABELV $700
+ADDRLP4 252
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 276
+ADDRLP4 220
+INDIRF4
+ASGNF4
+ADDRLP4 352
+CNSTI4 1
+ASGNI4
+ADDRLP4 360
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRLP4 364
+ADDRLP4 120
+INDIRB
+ASGNB 12
+ADDRLP4 328
+ADDRLP4 52
+INDIRB
+ASGNB 12
+ADDRLP4 316
+ADDRLP4 132
+INDIRB
+ASGNB 12
+LABELV $698
+LABELV $694
+LABELV $597
+ADDRLP4 188
+ADDRLP4 188
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $599
+ADDRLP4 188
+INDIRI4
+ADDRLP4 224
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $596
+LABELV $589
+ADDRLP4 284
+ADDRLP4 284
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $591
+ADDRLP4 284
+INDIRI4
+ADDRLP4 376
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $588
+LABELV $560
+ADDRLP4 396
+ADDRLP4 396
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $562
+ADDRLP4 396
+INDIRI4
+ADDRLP4 256
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $559
+LABELV $539
+ADDRLP4 404
+ADDRLP4 404
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $541
+ADDRLP4 404
+INDIRI4
+ADDRLP4 412
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $538
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $701
+ADDRLP4 248
+INDIRF4
+CNSTF4 0
+LTF4 $703
+ADDRLP4 248
+INDIRF4
+ADDRGP4 aassettings+60
+INDIRF4
+GEF4 $703
+ADDRLP4 588
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 424
+ADDRLP4 588
+INDIRP4
+ASGNP4
+ADDRLP4 424
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $706
+CNSTI4 0
+RETI4
+ADDRGP4 $516
+JUMPV
+LABELV $706
+ADDRLP4 424
+INDIRP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 424
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 424
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRLP4 424
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 340
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 340+4
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 292+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 340+8
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 292+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 304
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 304+4
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 292+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 304+8
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 292+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 424
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTU2 0
+ASGNU2
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 592
+ADDRGP4 AAS_AreaCrouch
+CALLI4
+ASGNI4
+ADDRLP4 592
+INDIRI4
+CNSTI4 0
+NEI4 $716
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 596
+ADDRGP4 AAS_AreaCrouch
+CALLI4
+ASGNI4
+ADDRLP4 596
+INDIRI4
+CNSTI4 0
+EQI4 $716
+ADDRLP4 604
+ADDRLP4 424
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 608
+ADDRLP4 604
+INDIRP4
+INDIRU2
+CVUI4 2
+CVIF4 4
+ADDRGP4 aassettings+104
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 612
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+LTF4 $720
+ADDRLP4 600
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $721
+JUMPV
+LABELV $720
+ADDRLP4 600
+ADDRLP4 608
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $721
+ADDRLP4 604
+INDIRP4
+ADDRLP4 600
+INDIRU4
+CVUU2 4
+ASGNU2
+LABELV $716
+ADDRLP4 424
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 424
+INDIRP4
+ASGNP4
+ADDRLP4 600
+ADDRGP4 reach_step
+ASGNP4
+ADDRLP4 604
+CNSTI4 1
+ASGNI4
+ADDRLP4 600
+INDIRP4
+ADDRLP4 600
+INDIRP4
+INDIRI4
+ADDRLP4 604
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 604
+INDIRI4
+RETI4
+ADDRGP4 $516
+JUMPV
+LABELV $703
+LABELV $701
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $722
+ADDRLP4 584
+CNSTF4 3221225472
+ASGNF4
+ADDRLP4 432
+ADDRLP4 316
+INDIRF4
+ADDRLP4 584
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 432+4
+ADDRLP4 316+4
+INDIRF4
+ADDRLP4 584
+INDIRF4
+ADDRLP4 328+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 432+8
+ADDRLP4 316+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 328+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 432+8
+ADDRLP4 432+8
+INDIRF4
+ADDRGP4 aassettings+68
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 432
+ARGP4
+ADDRLP4 588
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 592
+CNSTI4 4
+ASGNI4
+CNSTI4 28
+ADDRLP4 588
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 592
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 592
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $732
+ADDRLP4 252
+INDIRF4
+ADDRGP4 aassettings+68
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+GEF4 $735
+ADDRLP4 596
+CNSTI4 28
+ASGNI4
+ADDRLP4 600
+CNSTI4 8
+ASGNI4
+ADDRLP4 604
+CNSTI4 2
+ASGNI4
+ADDRLP4 608
+CNSTI4 0
+ASGNI4
+ADDRLP4 596
+INDIRI4
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 600
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 604
+INDIRI4
+BANDI4
+ADDRLP4 608
+INDIRI4
+EQI4 $738
+ADDRLP4 596
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 600
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 604
+INDIRI4
+BANDI4
+ADDRLP4 608
+INDIRI4
+EQI4 $738
+ADDRLP4 612
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 424
+ADDRLP4 612
+INDIRP4
+ASGNP4
+ADDRLP4 424
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $742
+CNSTI4 0
+RETI4
+ADDRGP4 $516
+JUMPV
+LABELV $742
+ADDRLP4 424
+INDIRP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 424
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 424
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRLP4 424
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 364
+INDIRB
+ASGNB 12
+ADDRLP4 424
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 316
+INDIRF4
+CNSTF4 1097859072
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 316+4
+INDIRF4
+CNSTF4 1097859072
+ADDRLP4 328+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 316+8
+INDIRF4
+CNSTF4 1097859072
+ADDRLP4 328+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRLP4 620
+ADDRGP4 aassettings+92
+INDIRF4
+ASGNF4
+ADDRLP4 624
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+LTF4 $750
+ADDRLP4 616
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $751
+JUMPV
+LABELV $750
+ADDRLP4 616
+ADDRLP4 620
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $751
+ADDRLP4 424
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 616
+INDIRU4
+CVUU2 4
+ASGNU2
+ADDRLP4 424
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 424
+INDIRP4
+ASGNP4
+ADDRLP4 628
+ADDRGP4 reach_waterjump
+ASGNP4
+ADDRLP4 632
+CNSTI4 1
+ASGNI4
+ADDRLP4 628
+INDIRP4
+ADDRLP4 628
+INDIRP4
+INDIRI4
+ADDRLP4 632
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+RETI4
+ADDRGP4 $516
+JUMPV
+LABELV $738
+LABELV $735
+LABELV $732
+LABELV $722
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $752
+ADDRLP4 248
+INDIRF4
+CNSTF4 0
+LEF4 $754
+ADDRLP4 248
+INDIRF4
+ADDRGP4 aassettings+72
+INDIRF4
+GEF4 $754
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $759
+ADDRLP4 248
+INDIRF4
+ADDRLP4 252
+INDIRF4
+SUBF4
+CNSTF4 1098907648
+GEF4 $757
+LABELV $759
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 588
+ADDRGP4 AAS_AreaCrouch
+CALLI4
+ASGNI4
+ADDRLP4 588
+INDIRI4
+CNSTI4 0
+NEI4 $760
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 592
+ADDRGP4 AAS_AreaCrouch
+CALLI4
+ASGNI4
+ADDRLP4 592
+INDIRI4
+CNSTI4 0
+NEI4 $760
+ADDRLP4 596
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 424
+ADDRLP4 596
+INDIRP4
+ASGNP4
+ADDRLP4 424
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $762
+CNSTI4 0
+RETI4
+ADDRGP4 $516
+JUMPV
+LABELV $762
+ADDRLP4 424
+INDIRP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 424
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 424
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRLP4 424
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 340
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 340+4
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 292+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 340+8
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 292+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 304
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 304+4
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 292+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 304+8
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 292+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 604
+ADDRGP4 aassettings+100
+INDIRF4
+ASGNF4
+ADDRLP4 608
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 604
+INDIRF4
+ADDRLP4 608
+INDIRF4
+LTF4 $774
+ADDRLP4 600
+ADDRLP4 604
+INDIRF4
+ADDRLP4 608
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $775
+JUMPV
+LABELV $774
+ADDRLP4 600
+ADDRLP4 604
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $775
+ADDRLP4 424
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 600
+INDIRU4
+CVUU2 4
+ASGNU2
+ADDRLP4 424
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 424
+INDIRP4
+ASGNP4
+ADDRLP4 612
+ADDRGP4 reach_barrier
+ASGNP4
+ADDRLP4 616
+CNSTI4 1
+ASGNI4
+ADDRLP4 612
+INDIRP4
+ADDRLP4 612
+INDIRP4
+INDIRI4
+ADDRLP4 616
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 616
+INDIRI4
+RETI4
+ADDRGP4 $516
+JUMPV
+LABELV $760
+LABELV $757
+LABELV $754
+LABELV $752
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $776
+ADDRLP4 248
+INDIRF4
+CNSTF4 0
+GEF4 $778
+ADDRLP4 248
+INDIRF4
+ADDRGP4 aassettings+60
+INDIRF4
+NEGF4
+LEF4 $780
+ADDRLP4 584
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 424
+ADDRLP4 584
+INDIRP4
+ASGNP4
+ADDRLP4 424
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $783
+CNSTI4 0
+RETI4
+ADDRGP4 $516
+JUMPV
+LABELV $783
+ADDRLP4 424
+INDIRP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 424
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 424
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRLP4 424
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 340
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 340+4
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 292+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 340+8
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 292+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 304
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 304+4
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 292+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 304+8
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 292+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 424
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTU2 1
+ASGNU2
+ADDRLP4 424
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 424
+INDIRP4
+ASGNP4
+ADDRLP4 588
+ADDRGP4 reach_walk
+ASGNP4
+ADDRLP4 592
+CNSTI4 1
+ASGNI4
+ADDRLP4 588
+INDIRP4
+ADDRLP4 588
+INDIRP4
+INDIRI4
+ADDRLP4 592
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 592
+INDIRI4
+RETI4
+ADDRGP4 $516
+JUMPV
+LABELV $780
+ADDRGP4 aassettings+152
+INDIRF4
+CNSTF4 0
+EQF4 $797
+ADDRLP4 248
+INDIRF4
+ARGF4
+ADDRLP4 584
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 584
+INDIRF4
+ADDRGP4 aassettings+152
+INDIRF4
+GEF4 $793
+LABELV $797
+ADDRLP4 588
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 304
+ADDRLP4 304
+INDIRF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 304+4
+ADDRLP4 304+4
+INDIRF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 292+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 304+8
+ADDRLP4 304+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 292+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 304
+INDIRB
+ASGNB 12
+ADDRLP4 120+8
+ADDRLP4 340+8
+INDIRF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 304
+INDIRB
+ASGNB 12
+ADDRLP4 132+8
+ADDRLP4 132+8
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ASGNF4
+ADDRLP4 444
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRLP4 132
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 444
+INDIRI4
+CNSTI4 0
+NEI4 $807
+ADDRLP4 444+4
+INDIRF4
+CNSTF4 1065353216
+LTF4 $807
+ADDRLP4 444+8+8
+ADDRLP4 444+8+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 444+8
+ARGP4
+ADDRLP4 592
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 592
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $812
+ADDRLP4 120
+ARGP4
+ADDRLP4 132
+ARGP4
+ADDRLP4 500
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 596
+ADDRGP4 AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 540
+ADDRLP4 596
+INDIRI4
+ASGNI4
+ADDRLP4 404
+CNSTI4 0
+ASGNI4
+ADDRGP4 $818
+JUMPV
+LABELV $815
+ADDRLP4 404
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 500
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 600
+ADDRGP4 AAS_AreaClusterPortal
+CALLI4
+ASGNI4
+ADDRLP4 600
+INDIRI4
+CNSTI4 0
+EQI4 $819
+ADDRGP4 $817
+JUMPV
+LABELV $819
+LABELV $816
+ADDRLP4 404
+ADDRLP4 404
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $818
+ADDRLP4 404
+INDIRI4
+ADDRLP4 540
+INDIRI4
+LTI4 $815
+LABELV $817
+ADDRLP4 404
+INDIRI4
+ADDRLP4 540
+INDIRI4
+LTI4 $821
+ADDRLP4 604
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 424
+ADDRLP4 604
+INDIRP4
+ASGNP4
+ADDRLP4 424
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $823
+CNSTI4 0
+RETI4
+ADDRGP4 $516
+JUMPV
+LABELV $823
+ADDRLP4 424
+INDIRP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 424
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 424
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRLP4 424
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 340
+INDIRB
+ASGNB 12
+ADDRLP4 424
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 304
+INDIRB
+ASGNB 12
+ADDRLP4 424
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRLP4 248
+INDIRF4
+ARGF4
+ADDRLP4 612
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 616
+ADDRGP4 aassettings+112
+INDIRF4
+CNSTF4 1112014848
+ADDRLP4 612
+INDIRF4
+MULF4
+ADDRGP4 aassettings+20
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+ADDRLP4 620
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 616
+INDIRF4
+ADDRLP4 620
+INDIRF4
+LTF4 $828
+ADDRLP4 608
+ADDRLP4 616
+INDIRF4
+ADDRLP4 620
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $829
+JUMPV
+LABELV $828
+ADDRLP4 608
+ADDRLP4 616
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $829
+ADDRLP4 424
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 608
+INDIRU4
+CVUU2 4
+ASGNU2
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 624
+ADDRGP4 AAS_AreaSwim
+CALLI4
+ASGNI4
+ADDRLP4 624
+INDIRI4
+CNSTI4 0
+NEI4 $830
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 628
+ADDRGP4 AAS_AreaJumpPad
+CALLI4
+ASGNI4
+ADDRLP4 628
+INDIRI4
+CNSTI4 0
+NEI4 $830
+ADDRLP4 248
+INDIRF4
+ARGF4
+ADDRLP4 632
+ADDRGP4 AAS_FallDelta
+CALLF4
+ASGNF4
+ADDRLP4 632
+INDIRF4
+ADDRGP4 aassettings+80
+INDIRF4
+LEF4 $832
+ADDRLP4 640
+ADDRLP4 424
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 644
+ADDRLP4 640
+INDIRP4
+INDIRU2
+CVUI4 2
+CVIF4 4
+ADDRGP4 aassettings+144
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 648
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 644
+INDIRF4
+ADDRLP4 648
+INDIRF4
+LTF4 $837
+ADDRLP4 636
+ADDRLP4 644
+INDIRF4
+ADDRLP4 648
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $838
+JUMPV
+LABELV $837
+ADDRLP4 636
+ADDRLP4 644
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $838
+ADDRLP4 640
+INDIRP4
+ADDRLP4 636
+INDIRU4
+CVUU2 4
+ASGNU2
+LABELV $832
+ADDRLP4 248
+INDIRF4
+ARGF4
+ADDRLP4 636
+ADDRGP4 AAS_FallDelta
+CALLF4
+ASGNF4
+ADDRLP4 636
+INDIRF4
+ADDRGP4 aassettings+84
+INDIRF4
+LEF4 $839
+ADDRLP4 644
+ADDRLP4 424
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 648
+ADDRLP4 644
+INDIRP4
+INDIRU2
+CVUI4 2
+CVIF4 4
+ADDRGP4 aassettings+148
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 652
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 648
+INDIRF4
+ADDRLP4 652
+INDIRF4
+LTF4 $844
+ADDRLP4 640
+ADDRLP4 648
+INDIRF4
+ADDRLP4 652
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $845
+JUMPV
+LABELV $844
+ADDRLP4 640
+ADDRLP4 648
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $845
+ADDRLP4 644
+INDIRP4
+ADDRLP4 640
+INDIRU4
+CVUU2 4
+ASGNU2
+LABELV $839
+LABELV $830
+ADDRLP4 424
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 424
+INDIRP4
+ASGNP4
+ADDRLP4 632
+ADDRGP4 reach_walkoffledge
+ASGNP4
+ADDRLP4 636
+CNSTI4 1
+ASGNI4
+ADDRLP4 632
+INDIRP4
+ADDRLP4 632
+INDIRP4
+INDIRI4
+ADDRLP4 636
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+RETI4
+ADDRGP4 $516
+JUMPV
+LABELV $821
+LABELV $812
+LABELV $807
+LABELV $793
+LABELV $778
+LABELV $776
+CNSTI4 0
+RETI4
+LABELV $516
+endproc AAS_Reachability_Step_Barrier_WaterJump_WalkOffLedge 716 24
+export VectorDistance
+proc VectorDistance 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+RETF4
+LABELV $846
+endproc VectorDistance 32 4
+export VectorBetweenVectors
+proc VectorBetweenVectors 60 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 4
+ASGNI4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 8
+ASGNI4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GTF4 $859
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $860
+JUMPV
+LABELV $859
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $860
+ADDRLP4 56
+INDIRI4
+RETI4
+LABELV $849
+endproc VectorBetweenVectors 60 0
+export VectorMiddle
+proc VectorMiddle 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTF4 1056964608
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 12
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 16
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $861
+endproc VectorMiddle 20 0
+export AAS_ClosestEdgePoints
+proc AAS_ClosestEdgePoints 220 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRP4
+ASGNP4
+ADDRFP4 32
+ADDRFP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 36
+ADDRFP4 36
+INDIRP4
+ASGNP4
+ADDRFP4 40
+ADDRFP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 112
+CNSTI4 4
+ASGNI4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 116
+CNSTI4 8
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+CNSTI4 4
+ASGNI4
+ADDRLP4 16+4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132
+CNSTI4 8
+ASGNI4
+ADDRLP4 16+8
+ADDRFP4 12
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+EQF4 $869
+ADDRLP4 136
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 92
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 136
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 144
+CNSTI4 4
+ASGNI4
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 92
+INDIRF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ADDRLP4 136
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 92
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDRLP4 156
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 164
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 92
+INDIRF4
+ADDRLP4 164
+INDIRF4
+MULF4
+ADDRLP4 172
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ADDRLP4 164
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40+4
+ADDRLP4 92
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 172
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $870
+JUMPV
+LABELV $869
+ADDRLP4 28
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 28+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 40+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $870
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+EQF4 $882
+ADDRLP4 136
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 88
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 136
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 144
+CNSTI4 4
+ASGNI4
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ADDRLP4 136
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 52+4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ADDRLP4 156
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 164
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 164
+INDIRF4
+MULF4
+ADDRLP4 172
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ADDRLP4 164
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 64
+INDIRF4
+MULF4
+ADDRLP4 172
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $883
+JUMPV
+LABELV $882
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 52+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 64+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $883
+ADDRLP4 28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 40+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 64+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 140
+ADDRFP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28+8
+ADDRFP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 20
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 140
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ADDRLP4 140
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 148
+ADDRFP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 40+8
+ADDRFP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 20
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 40+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 148
+INDIRF4
+ADDRLP4 40+8
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ADDRLP4 148
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 156
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 52+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 52+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 52+8
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ADDRLP4 156
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 164
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 64+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 64
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 64+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 164
+INDIRF4
+ADDRLP4 64+8
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ADDRLP4 164
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 VectorBetweenVectors
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $911
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 172
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 184
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 40
+INDIRF4
+ADDRLP4 184
+INDIRF4
+SUBF4
+LEF4 $913
+ADDRLP4 0
+INDIRF4
+ADDRFP4 40
+INDIRF4
+ADDRLP4 184
+INDIRF4
+ADDF4
+GEF4 $913
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 80
+INDIRF4
+LEF4 $915
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 196
+INDIRF4
+LEF4 $916
+ADDRFP4 32
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 $916
+JUMPV
+LABELV $915
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 196
+INDIRF4
+LEF4 $919
+ADDRFP4 24
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $919
+LABELV $916
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 196
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 200
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 80
+INDIRF4
+LEF4 $921
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 204
+INDIRF4
+LEF4 $914
+ADDRFP4 36
+INDIRP4
+ADDRLP4 28
+INDIRB
+ASGNB 12
+ADDRGP4 $914
+JUMPV
+LABELV $921
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 204
+INDIRF4
+LEF4 $914
+ADDRFP4 28
+INDIRP4
+ADDRLP4 28
+INDIRB
+ASGNB 12
+ADDRGP4 $914
+JUMPV
+LABELV $913
+ADDRLP4 0
+INDIRF4
+ADDRFP4 40
+INDIRF4
+GEF4 $927
+ADDRFP4 40
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 24
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 32
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 28
+INDIRP4
+ADDRLP4 28
+INDIRB
+ASGNB 12
+ADDRFP4 36
+INDIRP4
+ADDRLP4 28
+INDIRB
+ASGNB 12
+LABELV $927
+LABELV $914
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+LABELV $911
+ADDRLP4 40
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 VectorBetweenVectors
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $929
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 176
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 176
+INDIRF4
+ASGNF4
+ADDRLP4 188
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 40
+INDIRF4
+ADDRLP4 188
+INDIRF4
+SUBF4
+LEF4 $931
+ADDRLP4 0
+INDIRF4
+ADDRFP4 40
+INDIRF4
+ADDRLP4 188
+INDIRF4
+ADDF4
+GEF4 $931
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 80
+INDIRF4
+LEF4 $933
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 200
+INDIRF4
+LEF4 $934
+ADDRFP4 32
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 $934
+JUMPV
+LABELV $933
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 200
+INDIRF4
+LEF4 $937
+ADDRFP4 24
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $937
+LABELV $934
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 200
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 204
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 80
+INDIRF4
+LEF4 $939
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 208
+INDIRF4
+LEF4 $932
+ADDRFP4 36
+INDIRP4
+ADDRLP4 40
+INDIRB
+ASGNB 12
+ADDRGP4 $932
+JUMPV
+LABELV $939
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 208
+INDIRF4
+LEF4 $932
+ADDRFP4 28
+INDIRP4
+ADDRLP4 40
+INDIRB
+ASGNB 12
+ADDRGP4 $932
+JUMPV
+LABELV $931
+ADDRLP4 0
+INDIRF4
+ADDRFP4 40
+INDIRF4
+GEF4 $945
+ADDRFP4 40
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 24
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 32
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 28
+INDIRP4
+ADDRLP4 40
+INDIRB
+ASGNB 12
+ADDRFP4 36
+INDIRP4
+ADDRLP4 40
+INDIRB
+ASGNB 12
+LABELV $945
+LABELV $932
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+LABELV $929
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 VectorBetweenVectors
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $947
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 180
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 192
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 40
+INDIRF4
+ADDRLP4 192
+INDIRF4
+SUBF4
+LEF4 $949
+ADDRLP4 0
+INDIRF4
+ADDRFP4 40
+INDIRF4
+ADDRLP4 192
+INDIRF4
+ADDF4
+GEF4 $949
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 196
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 200
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 80
+INDIRF4
+LEF4 $951
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 204
+INDIRF4
+LEF4 $952
+ADDRFP4 32
+INDIRP4
+ADDRLP4 52
+INDIRB
+ASGNB 12
+ADDRGP4 $952
+JUMPV
+LABELV $951
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 204
+INDIRF4
+LEF4 $955
+ADDRFP4 24
+INDIRP4
+ADDRLP4 52
+INDIRB
+ASGNB 12
+LABELV $955
+LABELV $952
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 208
+INDIRF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 80
+INDIRF4
+LEF4 $957
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRLP4 212
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 212
+INDIRF4
+LEF4 $950
+ADDRFP4 36
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 $950
+JUMPV
+LABELV $957
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRLP4 212
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 212
+INDIRF4
+LEF4 $950
+ADDRFP4 28
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 $950
+JUMPV
+LABELV $949
+ADDRLP4 0
+INDIRF4
+ADDRFP4 40
+INDIRF4
+GEF4 $963
+ADDRFP4 40
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 24
+INDIRP4
+ADDRLP4 52
+INDIRB
+ASGNB 12
+ADDRFP4 32
+INDIRP4
+ADDRLP4 52
+INDIRB
+ASGNB 12
+ADDRFP4 28
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 36
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $963
+LABELV $950
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+LABELV $947
+ADDRLP4 64
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 VectorBetweenVectors
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $965
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 184
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 184
+INDIRF4
+ASGNF4
+ADDRLP4 196
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 40
+INDIRF4
+ADDRLP4 196
+INDIRF4
+SUBF4
+LEF4 $967
+ADDRLP4 0
+INDIRF4
+ADDRFP4 40
+INDIRF4
+ADDRLP4 196
+INDIRF4
+ADDF4
+GEF4 $967
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 200
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 204
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 80
+INDIRF4
+LEF4 $969
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 208
+INDIRF4
+LEF4 $970
+ADDRFP4 32
+INDIRP4
+ADDRLP4 64
+INDIRB
+ASGNB 12
+ADDRGP4 $970
+JUMPV
+LABELV $969
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 208
+INDIRF4
+LEF4 $973
+ADDRFP4 24
+INDIRP4
+ADDRLP4 64
+INDIRB
+ASGNB 12
+LABELV $973
+LABELV $970
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 208
+INDIRF4
+ASGNF4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 212
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 212
+INDIRF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 80
+INDIRF4
+LEF4 $975
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 216
+INDIRF4
+LEF4 $968
+ADDRFP4 36
+INDIRP4
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 $968
+JUMPV
+LABELV $975
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 216
+INDIRF4
+LEF4 $968
+ADDRFP4 28
+INDIRP4
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 $968
+JUMPV
+LABELV $967
+ADDRLP4 0
+INDIRF4
+ADDRFP4 40
+INDIRF4
+GEF4 $981
+ADDRFP4 40
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 24
+INDIRP4
+ADDRLP4 64
+INDIRB
+ASGNB 12
+ADDRFP4 32
+INDIRP4
+ADDRLP4 64
+INDIRB
+ASGNB 12
+ADDRFP4 28
+INDIRP4
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 36
+INDIRP4
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $981
+LABELV $968
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+LABELV $965
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $983
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 184
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 40
+INDIRF4
+GEF4 $985
+ADDRFP4 40
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 24
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 32
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 28
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 36
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $985
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 40
+INDIRF4
+GEF4 $987
+ADDRFP4 40
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 24
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 32
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 28
+INDIRP4
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 36
+INDIRP4
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $987
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 40
+INDIRF4
+GEF4 $989
+ADDRFP4 40
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 24
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 32
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 28
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 36
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $989
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 40
+INDIRF4
+GEF4 $991
+ADDRFP4 40
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 24
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 32
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 28
+INDIRP4
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 36
+INDIRP4
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $991
+LABELV $983
+ADDRFP4 40
+INDIRF4
+RETF4
+LABELV $862
+endproc AAS_ClosestEdgePoints 220 12
+lit
+align 4
+LABELV $994
+byte 4 0
+skip 8
+align 4
+LABELV $995
+byte 4 0
+skip 8
+export AAS_ClosestGroundEdgePoints
+code
+proc AAS_ClosestGroundEdgePoints 160 44
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRGP4 $994
+INDIRB
+ASGNB 12
+ADDRLP4 64
+ADDRGP4 $995
+INDIRB
+ASGNB 12
+ADDRLP4 108
+CNSTI4 48
+ASGNI4
+ADDRLP4 100
+ADDRLP4 108
+INDIRI4
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 108
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTF4 1232348144
+ASGNF4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1001
+JUMPV
+LABELV $998
+ADDRLP4 104
+ADDRLP4 100
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 24
+ADDRLP4 112
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 116
+CNSTI4 4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 116
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $1004
+ADDRGP4 $999
+JUMPV
+LABELV $1004
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1009
+JUMPV
+LABELV $1006
+ADDRLP4 92
+ADDRLP4 88
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 24
+ADDRLP4 120
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 124
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 124
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $1012
+ADDRGP4 $1007
+JUMPV
+LABELV $1012
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1017
+JUMPV
+LABELV $1014
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 80
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1023
+JUMPV
+LABELV $1020
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 136
+CNSTI4 12
+ASGNI4
+ADDRLP4 24
+ADDRLP4 136
+INDIRI4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 144
+CNSTI4 4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 136
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 136
+INDIRI4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 136
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 152
+CNSTI4 20
+ASGNI4
+ADDRLP4 40
+ADDRLP4 152
+INDIRI4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 152
+INDIRI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 156
+ADDRGP4 AAS_ClosestEdgePoints
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 156
+INDIRF4
+ASGNF4
+LABELV $1021
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1023
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $1020
+LABELV $1015
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1017
+ADDRLP4 76
+INDIRI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $1014
+LABELV $1007
+ADDRLP4 84
+ADDRLP4 84
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1009
+ADDRLP4 84
+INDIRI4
+ADDRLP4 88
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $1006
+LABELV $999
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1001
+ADDRLP4 96
+INDIRI4
+ADDRLP4 100
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $998
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 VectorMiddle
+CALLV
+pop
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 VectorMiddle
+CALLV
+pop
+ADDRLP4 16
+INDIRF4
+RETF4
+LABELV $993
+endproc AAS_ClosestGroundEdgePoints 160 44
+export AAS_JumpEdgePoints
+proc AAS_JumpEdgePoints 64 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 AAS_AreaGrounded
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $1035
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 AAS_AreaGrounded
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $1033
+LABELV $1035
+CNSTI4 0
+RETI4
+ADDRGP4 $1032
+JUMPV
+LABELV $1033
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 AAS_AreaCrouch
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $1038
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 AAS_AreaCrouch
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $1036
+LABELV $1038
+CNSTI4 0
+RETI4
+ADDRGP4 $1032
+JUMPV
+LABELV $1036
+ADDRLP4 40
+CNSTI4 48
+ASGNI4
+ADDRLP4 8
+ADDRLP4 40
+INDIRI4
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 40
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 aassettings+76
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 AAS_MaxJumpDistance
+CALLF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1073741824
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 AAS_MaxJumpHeight
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1042
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+LEF4 $1046
+CNSTI4 0
+RETI4
+ADDRGP4 $1032
+JUMPV
+LABELV $1046
+ADDRLP4 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+GEF4 $1048
+CNSTI4 0
+RETI4
+ADDRGP4 $1032
+JUMPV
+LABELV $1048
+LABELV $1043
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $1042
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDF4
+LEF4 $1050
+CNSTI4 0
+RETI4
+ADDRGP4 $1032
+JUMPV
+LABELV $1050
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 AAS_ClosestGroundEdgePoints
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1082130432
+LEF4 $1053
+ADDRLP4 60
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $1053
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1054
+JUMPV
+LABELV $1053
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $1054
+ADDRLP4 56
+INDIRI4
+RETI4
+LABELV $1032
+endproc AAS_JumpEdgePoints 64 16
+lit
+align 4
+LABELV $1056
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export AAS_Reachability_JumpEdgePoints
+code
+proc AAS_Reachability_JumpEdgePoints 456 56
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 300
+ADDRGP4 $1056
+INDIRB
+ASGNB 12
+ADDRLP4 320
+ADDRGP4 aassettings+76
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1111490560
+GTF4 $1058
+ADDRLP4 324
+CNSTI4 8
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 324
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 324
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 328
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 328
+INDIRF4
+CNSTF4 1090519040
+GEF4 $1058
+ADDRLP4 204
+CNSTF4 1137180672
+ASGNF4
+ADDRLP4 296
+CNSTI4 7
+ASGNI4
+ADDRGP4 $1059
+JUMPV
+LABELV $1058
+CNSTF4 0
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 204
+ARGP4
+ADDRLP4 332
+ADDRGP4 AAS_HorizontalVelocityForJump
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $1060
+ADDRLP4 204
+CNSTF4 1067030938
+ADDRLP4 204
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 296
+CNSTI4 7
+ASGNI4
+ADDRGP4 $1061
+JUMPV
+LABELV $1060
+ADDRLP4 320
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 204
+ARGP4
+ADDRLP4 336
+ADDRGP4 AAS_HorizontalVelocityForJump
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+NEI4 $1062
+CNSTI4 0
+RETI4
+ADDRGP4 $1055
+JUMPV
+LABELV $1062
+ADDRLP4 204
+CNSTF4 1065772646
+ADDRLP4 204
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 296
+CNSTI4 5
+ASGNI4
+ADDRLP4 4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 348
+CNSTI4 4
+ASGNI4
+ADDRLP4 4+4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 348
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 348
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 352
+CNSTI4 8
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 16
+INDIRP4
+ADDRLP4 352
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 352
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 356
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 356
+INDIRF4
+CNSTF4 1092616192
+GEF4 $1067
+CNSTI4 0
+RETI4
+ADDRGP4 $1055
+JUMPV
+LABELV $1067
+LABELV $1061
+LABELV $1059
+ADDRLP4 4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 344
+CNSTI4 4
+ASGNI4
+ADDRLP4 4+4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 344
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 344
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 348
+CNSTI4 8
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 16
+INDIRP4
+ADDRLP4 348
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 348
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 356
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 176
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 356
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 176+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 356
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 176+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 176
+INDIRB
+ASGNB 12
+ADDRLP4 164+8
+ADDRLP4 164+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 240
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRLP4 164
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+EQI4 $1076
+CNSTI4 0
+RETI4
+ADDRGP4 $1055
+JUMPV
+LABELV $1076
+ADDRLP4 240+4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1078
+ADDRLP4 312
+CNSTI4 20
+ADDRLP4 240+32
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+INDIRF4
+ADDRLP4 300
+INDIRF4
+MULF4
+ADDRLP4 312
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 300+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 312
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 300+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1060320051
+LTF4 $1083
+ADDRLP4 240+8
+ARGP4
+ADDRLP4 364
+ADDRGP4 AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 24
+BANDI4
+CNSTI4 0
+NEI4 $1087
+ADDRLP4 176+8
+INDIRF4
+ADDRLP4 240+8+8
+INDIRF4
+SUBF4
+ADDRGP4 aassettings+72
+INDIRF4
+GTF4 $1090
+CNSTI4 0
+RETI4
+ADDRGP4 $1055
+JUMPV
+LABELV $1090
+LABELV $1087
+LABELV $1083
+LABELV $1078
+ADDRLP4 364
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 176
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 364
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 176+4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 364
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 176+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 3212836864
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 176
+INDIRB
+ASGNB 12
+ADDRLP4 164+8
+ADDRLP4 164+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 240
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRLP4 164
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+EQI4 $1101
+CNSTI4 0
+RETI4
+ADDRGP4 $1055
+JUMPV
+LABELV $1101
+ADDRLP4 240+4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1103
+ADDRLP4 312
+CNSTI4 20
+ADDRLP4 240+32
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+INDIRF4
+ADDRLP4 300
+INDIRF4
+MULF4
+ADDRLP4 312
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 300+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 312
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 300+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1060320051
+LTF4 $1108
+ADDRLP4 240+8
+ARGP4
+ADDRLP4 372
+ADDRGP4 AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 24
+BANDI4
+CNSTI4 0
+NEI4 $1112
+ADDRLP4 176+8
+INDIRF4
+ADDRLP4 240+8+8
+INDIRF4
+SUBF4
+ADDRGP4 aassettings+72
+INDIRF4
+GTF4 $1115
+CNSTI4 0
+RETI4
+ADDRGP4 $1055
+JUMPV
+LABELV $1115
+LABELV $1112
+LABELV $1108
+LABELV $1103
+ADDRLP4 368
+CNSTF4 0
+ASGNF4
+ADDRLP4 220+8
+ADDRLP4 368
+INDIRF4
+ASGNF4
+ADDRLP4 220+4
+ADDRLP4 368
+INDIRF4
+ASGNF4
+ADDRLP4 220
+ADDRLP4 368
+INDIRF4
+ASGNF4
+ADDRLP4 296
+INDIRI4
+CNSTI4 16777215
+BANDI4
+CNSTI4 5
+NEI4 $1123
+ADDRLP4 220+8
+ADDRGP4 aassettings+76
+INDIRF4
+ASGNF4
+ADDRGP4 $1124
+JUMPV
+LABELV $1123
+ADDRLP4 220+8
+CNSTF4 0
+ASGNF4
+LABELV $1124
+ADDRLP4 4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 380
+CNSTI4 4
+ASGNI4
+ADDRLP4 4+4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 380
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 380
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 384
+CNSTI4 8
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 16
+INDIRP4
+ADDRLP4 384
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 384
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 300
+ARGP4
+ADDRLP4 208
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 232
+CNSTI4 61
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 388
+ADDRGP4 AAS_AreaClusterPortal
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 0
+NEI4 $1131
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 392
+ADDRGP4 AAS_AreaClusterPortal
+CALLI4
+ASGNI4
+ADDRLP4 392
+INDIRI4
+CNSTI4 0
+NEI4 $1131
+ADDRLP4 232
+ADDRLP4 232
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $1131
+ADDRLP4 200
+CNSTI4 0
+ASGNI4
+LABELV $1133
+ADDRLP4 200
+INDIRI4
+CNSTI4 1
+NEI4 $1137
+ADDRLP4 164
+ADDRLP4 164
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 164+4
+ADDRLP4 164+4
+INDIRF4
+ADDRLP4 208+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 164+8
+ADDRLP4 164+8
+INDIRF4
+ADDRLP4 208+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1138
+JUMPV
+LABELV $1137
+ADDRLP4 200
+INDIRI4
+CNSTI4 2
+NEI4 $1145
+ADDRLP4 164
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 208
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 208+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 208+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $1146
+JUMPV
+LABELV $1145
+ADDRLP4 164
+ADDRFP4 16
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $1146
+LABELV $1138
+ADDRLP4 4
+ADDRLP4 164
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 164+4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 164+8
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 404
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 4
+INDIRF4
+ADDRLP4 404
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 188+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 404
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 188+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 204
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 60
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 188
+ARGP4
+ADDRLP4 220
+ARGP4
+CNSTI4 3
+ARGI4
+CNSTI4 30
+ARGI4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 232
+INDIRI4
+ARGI4
+ADDRLP4 408
+CNSTI4 0
+ASGNI4
+ADDRLP4 408
+INDIRI4
+ARGI4
+ADDRLP4 408
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 AAS_PredictPlayerMovement
+CALLI4
+pop
+ADDRLP4 60+100
+INDIRI4
+CNSTI4 30
+LTI4 $1160
+CNSTI4 0
+RETI4
+ADDRGP4 $1055
+JUMPV
+LABELV $1160
+ADDRLP4 60+88
+INDIRI4
+CNSTI4 24
+BANDI4
+CNSTI4 0
+EQI4 $1163
+CNSTI4 0
+RETI4
+ADDRGP4 $1055
+JUMPV
+LABELV $1163
+ADDRLP4 60+88
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1166
+CNSTI4 0
+RETI4
+ADDRGP4 $1055
+JUMPV
+LABELV $1166
+ADDRLP4 412
+CNSTF4 3263168512
+ASGNF4
+ADDRLP4 176
+ADDRLP4 60
+INDIRF4
+ADDRLP4 412
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 176+4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 412
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 176+8
+ADDRLP4 60+8
+INDIRF4
+CNSTF4 3263168512
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 176+8
+ADDRLP4 176+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 60
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 416
+ADDRGP4 AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1179
+JUMPV
+LABELV $1176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1180
+ADDRGP4 $1178
+JUMPV
+LABELV $1180
+LABELV $1177
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1179
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LTI4 $1176
+LABELV $1178
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+GEI4 $1182
+ADDRGP4 $1135
+JUMPV
+LABELV $1182
+LABELV $1134
+ADDRLP4 200
+ADDRLP4 200
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 3
+LTI4 $1133
+LABELV $1135
+ADDRLP4 200
+INDIRI4
+CNSTI4 3
+LTI4 $1184
+CNSTI4 0
+RETI4
+ADDRGP4 $1055
+JUMPV
+LABELV $1184
+ADDRLP4 396
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 236
+ADDRLP4 396
+INDIRP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1186
+CNSTI4 0
+RETI4
+ADDRGP4 $1055
+JUMPV
+LABELV $1186
+ADDRLP4 236
+INDIRP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 236
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 236
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 236
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 236
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 16
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 236
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 408
+CNSTI4 4
+ASGNI4
+ADDRLP4 4+4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 408
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 408
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 412
+CNSTI4 8
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 16
+INDIRP4
+ADDRLP4 412
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 412
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 316
+ADDRLP4 4+8
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 296
+INDIRI4
+CNSTI4 16777215
+BANDI4
+CNSTI4 7
+NEI4 $1192
+ADDRLP4 4
+ARGP4
+ADDRLP4 416
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 316
+INDIRF4
+ADDRLP4 416
+INDIRF4
+LEF4 $1192
+ADDRLP4 424
+ADDRGP4 aassettings+112
+INDIRF4
+CNSTF4 1112014848
+ADDRLP4 316
+INDIRF4
+MULF4
+ADDRGP4 aassettings+20
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+ADDRLP4 428
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 424
+INDIRF4
+ADDRLP4 428
+INDIRF4
+LTF4 $1197
+ADDRLP4 420
+ADDRLP4 424
+INDIRF4
+ADDRLP4 428
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1198
+JUMPV
+LABELV $1197
+ADDRLP4 420
+ADDRLP4 424
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1198
+ADDRLP4 236
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 420
+INDIRU4
+CVUU2 4
+ASGNU2
+ADDRGP4 $1193
+JUMPV
+LABELV $1192
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 424
+ADDRGP4 VectorDistance
+CALLF4
+ASGNF4
+ADDRLP4 428
+ADDRGP4 aassettings+116
+INDIRF4
+CNSTF4 1131413504
+ADDRLP4 424
+INDIRF4
+MULF4
+ADDRGP4 aassettings+36
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+ADDRLP4 432
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 428
+INDIRF4
+ADDRLP4 432
+INDIRF4
+LTF4 $1202
+ADDRLP4 420
+ADDRLP4 428
+INDIRF4
+ADDRLP4 432
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1203
+JUMPV
+LABELV $1202
+ADDRLP4 420
+ADDRLP4 428
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1203
+ADDRLP4 236
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 420
+INDIRU4
+CVUU2 4
+ASGNU2
+LABELV $1193
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 420
+ADDRGP4 AAS_AreaJumpPad
+CALLI4
+ASGNI4
+ADDRLP4 420
+INDIRI4
+CNSTI4 0
+NEI4 $1204
+ADDRLP4 424
+CNSTI4 8
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 424
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 424
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 428
+ADDRGP4 AAS_FallDelta
+CALLF4
+ASGNF4
+ADDRLP4 428
+INDIRF4
+ADDRGP4 aassettings+80
+INDIRF4
+LEF4 $1206
+ADDRLP4 436
+ADDRLP4 236
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 440
+ADDRLP4 436
+INDIRP4
+INDIRU2
+CVUI4 2
+CVIF4 4
+ADDRGP4 aassettings+144
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 444
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 440
+INDIRF4
+ADDRLP4 444
+INDIRF4
+LTF4 $1211
+ADDRLP4 432
+ADDRLP4 440
+INDIRF4
+ADDRLP4 444
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1212
+JUMPV
+LABELV $1211
+ADDRLP4 432
+ADDRLP4 440
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1212
+ADDRLP4 436
+INDIRP4
+ADDRLP4 432
+INDIRU4
+CVUU2 4
+ASGNU2
+ADDRGP4 $1207
+JUMPV
+LABELV $1206
+ADDRLP4 432
+CNSTI4 8
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 432
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 432
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 436
+ADDRGP4 AAS_FallDelta
+CALLF4
+ASGNF4
+ADDRLP4 436
+INDIRF4
+ADDRGP4 aassettings+84
+INDIRF4
+LEF4 $1213
+ADDRLP4 444
+ADDRLP4 236
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 448
+ADDRLP4 444
+INDIRP4
+INDIRU2
+CVUI4 2
+CVIF4 4
+ADDRGP4 aassettings+148
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 452
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 448
+INDIRF4
+ADDRLP4 452
+INDIRF4
+LTF4 $1218
+ADDRLP4 440
+ADDRLP4 448
+INDIRF4
+ADDRLP4 452
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1219
+JUMPV
+LABELV $1218
+ADDRLP4 440
+ADDRLP4 448
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1219
+ADDRLP4 444
+INDIRP4
+ADDRLP4 440
+INDIRU4
+CVUU2 4
+ASGNU2
+LABELV $1213
+LABELV $1207
+LABELV $1204
+ADDRLP4 236
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 236
+INDIRP4
+ASGNP4
+ADDRLP4 296
+INDIRI4
+CNSTI4 16777215
+BANDI4
+CNSTI4 5
+NEI4 $1220
+ADDRLP4 424
+ADDRGP4 reach_jump
+ASGNP4
+ADDRLP4 424
+INDIRP4
+ADDRLP4 424
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1221
+JUMPV
+LABELV $1220
+ADDRLP4 428
+ADDRGP4 reach_walkoffledge
+ASGNP4
+ADDRLP4 428
+INDIRP4
+ADDRLP4 428
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1221
+CNSTI4 0
+RETI4
+LABELV $1055
+endproc AAS_Reachability_JumpEdgePoints 456 56
+lit
+align 4
+LABELV $1223
+byte 4 0
+skip 8
+align 4
+LABELV $1224
+byte 4 0
+skip 8
+export AAS_Reachability_Jump
+code
+proc AAS_Reachability_Jump 36 20
+ADDRLP4 0
+ADDRGP4 $1223
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRGP4 $1224
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 28
+ADDRGP4 AAS_JumpEdgePoints
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $1225
+CNSTI4 0
+RETI4
+ADDRGP4 $1222
+JUMPV
+LABELV $1225
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 32
+ADDRGP4 AAS_Reachability_JumpEdgePoints
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+RETI4
+LABELV $1222
+endproc AAS_Reachability_Jump 36 20
+lit
+align 4
+LABELV $1228
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV $1229
+byte 4 0
+byte 4 0
+skip 4
+export AAS_Reachability_Ladder
+code
+proc AAS_Reachability_Ladder 488 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 212
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+CNSTF4 3323739136
+ASGNF4
+ADDRLP4 32
+CNSTF4 3323739136
+ASGNF4
+ADDRLP4 136
+ADDRGP4 $1228
+INDIRB
+ASGNB 12
+ADDRLP4 160
+ADDRGP4 $1229
+INDIRB
+ASGNB 12
+ADDRLP4 48
+CNSTP4 0
+ASGNP4
+ADDRLP4 56
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 316
+ADDRGP4 AAS_AreaLadder
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $1232
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 AAS_AreaLadder
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+NEI4 $1230
+LABELV $1232
+CNSTI4 0
+RETI4
+ADDRGP4 $1227
+JUMPV
+LABELV $1230
+ADDRLP4 216
+ADDRGP4 aassettings+76
+INDIRF4
+ASGNF4
+ADDRLP4 216
+INDIRF4
+ARGF4
+ADDRLP4 324
+ADDRGP4 AAS_MaxJumpHeight
+CALLF4
+ASGNF4
+ADDRLP4 300
+ADDRLP4 324
+INDIRF4
+ASGNF4
+ADDRLP4 328
+CNSTI4 48
+ASGNI4
+ADDRLP4 92
+ADDRLP4 328
+INDIRI4
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 328
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1239
+JUMPV
+LABELV $1236
+ADDRLP4 44
+ADDRLP4 92
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 332
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 24
+ADDRLP4 332
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $1242
+ADDRGP4 $1237
+JUMPV
+LABELV $1242
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1247
+JUMPV
+LABELV $1244
+ADDRLP4 40
+ADDRLP4 72
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 336
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 24
+ADDRLP4 336
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $1250
+ADDRGP4 $1245
+JUMPV
+LABELV $1250
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1255
+JUMPV
+LABELV $1252
+ADDRLP4 12
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1260
+JUMPV
+LABELV $1257
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 340
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 344
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+ADDRLP4 344
+INDIRI4
+NEI4 $1262
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 AAS_FaceArea
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 348
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 AAS_FaceArea
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+LEF4 $1259
+ADDRLP4 20
+INDIRF4
+ADDRLP4 32
+INDIRF4
+LEF4 $1259
+ADDRLP4 28
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $1259
+JUMPV
+LABELV $1262
+LABELV $1258
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1260
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $1257
+LABELV $1259
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+EQI4 $1266
+ADDRGP4 $1254
+JUMPV
+LABELV $1266
+LABELV $1253
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1255
+ADDRLP4 36
+INDIRI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $1252
+LABELV $1254
+LABELV $1245
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1247
+ADDRLP4 68
+INDIRI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $1244
+LABELV $1237
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1239
+ADDRLP4 76
+INDIRI4
+ADDRLP4 92
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $1236
+ADDRLP4 332
+CNSTU4 0
+ASGNU4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+ADDRLP4 332
+INDIRU4
+EQU4 $1268
+ADDRLP4 56
+INDIRP4
+CVPU4 4
+ADDRLP4 332
+INDIRU4
+EQU4 $1268
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 344
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 240
+ADDRLP4 344
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+GEI4 $1272
+ADDRLP4 336
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1273
+JUMPV
+LABELV $1272
+ADDRLP4 336
+CNSTI4 0
+ASGNI4
+LABELV $1273
+ADDRLP4 236
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRLP4 348
+CNSTI4 12
+ASGNI4
+ADDRLP4 352
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 100
+ADDRLP4 348
+INDIRI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 240
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+NEI4 $1277
+ADDRLP4 340
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1278
+JUMPV
+LABELV $1277
+ADDRLP4 340
+CNSTI4 0
+ASGNI4
+LABELV $1278
+ADDRLP4 112
+ADDRLP4 348
+INDIRI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 240
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 124
+ADDRLP4 100
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 100+4
+INDIRF4
+ADDRLP4 112+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 100+8
+INDIRF4
+ADDRLP4 112+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 356
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 124
+ADDRLP4 356
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 356
+INDIRF4
+ADDRLP4 124+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 124+8
+CNSTF4 1056964608
+ADDRLP4 124+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 124
+INDIRB
+ASGNB 12
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+GEI4 $1291
+ADDRLP4 360
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1292
+JUMPV
+LABELV $1291
+ADDRLP4 360
+CNSTI4 0
+ASGNI4
+LABELV $1292
+ADDRLP4 156
+CNSTI4 20
+ADDRLP4 48
+INDIRP4
+INDIRI4
+ADDRLP4 360
+INDIRI4
+BXORI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+GEI4 $1295
+ADDRLP4 364
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1296
+JUMPV
+LABELV $1295
+ADDRLP4 364
+CNSTI4 0
+ASGNI4
+LABELV $1296
+ADDRLP4 148
+CNSTI4 20
+ADDRLP4 56
+INDIRP4
+INDIRI4
+ADDRLP4 364
+INDIRI4
+BXORI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 196
+ADDRLP4 112
+INDIRF4
+ADDRLP4 100
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 196+4
+ADDRLP4 112+4
+INDIRF4
+ADDRLP4 100+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 196+8
+ADDRLP4 112+8
+INDIRF4
+ADDRLP4 100+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRLP4 184
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 184
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 368
+CNSTF4 3254779904
+ASGNF4
+ADDRLP4 124
+ADDRLP4 124
+INDIRF4
+ADDRLP4 368
+INDIRF4
+ADDRLP4 184
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 124+4
+INDIRF4
+ADDRLP4 368
+INDIRF4
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 124+8
+INDIRF4
+CNSTF4 3254779904
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 372
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 172
+ADDRLP4 172
+INDIRF4
+ADDRLP4 372
+INDIRF4
+ADDRLP4 184
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 172+4
+ADDRLP4 172+4
+INDIRF4
+ADDRLP4 372
+INDIRF4
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 172+8
+ADDRLP4 172+8
+INDIRF4
+CNSTF4 1107296256
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ADDRLP4 156
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 136+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 156
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 136+8
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 388
+ADDRGP4 fabsf
+CALLF4
+ASGNF4
+ADDRLP4 388
+INDIRF4
+CNSTF4 1036831949
+GEF4 $1318
+ADDRLP4 376
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1319
+JUMPV
+LABELV $1318
+ADDRLP4 376
+CNSTI4 0
+ASGNI4
+LABELV $1319
+ADDRLP4 208
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRP4
+INDIRF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ADDRLP4 148
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 136+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 148
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 136+8
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 396
+ADDRGP4 fabsf
+CALLF4
+ASGNF4
+ADDRLP4 396
+INDIRF4
+CNSTF4 1036831949
+GEF4 $1323
+ADDRLP4 380
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1324
+JUMPV
+LABELV $1323
+ADDRLP4 380
+CNSTI4 0
+ASGNI4
+LABELV $1324
+ADDRLP4 232
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRLP4 400
+CNSTI4 0
+ASGNI4
+ADDRLP4 208
+INDIRI4
+ADDRLP4 400
+INDIRI4
+NEI4 $1325
+ADDRLP4 232
+INDIRI4
+ADDRLP4 400
+INDIRI4
+NEI4 $1325
+CNSTI4 0
+RETI4
+ADDRGP4 $1227
+JUMPV
+LABELV $1325
+ADDRLP4 404
+CNSTI4 0
+ASGNI4
+ADDRLP4 208
+INDIRI4
+ADDRLP4 404
+INDIRI4
+EQI4 $1327
+ADDRLP4 232
+INDIRI4
+ADDRLP4 404
+INDIRI4
+EQI4 $1327
+ADDRLP4 416
+CNSTI4 4
+ASGNI4
+ADDRLP4 420
+CNSTI4 8
+ASGNI4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+ADDRLP4 148
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 416
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 416
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 420
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 420
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1060320051
+LEF4 $1327
+ADDRLP4 196
+INDIRF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ADDRLP4 196+4
+INDIRF4
+ADDRLP4 136+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 196+8
+INDIRF4
+ADDRLP4 136+8
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 424
+ADDRGP4 fabsf
+CALLF4
+ASGNF4
+ADDRLP4 424
+INDIRF4
+CNSTF4 1060320051
+GEF4 $1327
+ADDRLP4 428
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 428
+INDIRP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1333
+CNSTI4 0
+RETI4
+ADDRGP4 $1227
+JUMPV
+LABELV $1333
+ADDRLP4 96
+INDIRP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 432
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 124
+INDIRB
+ASGNB 12
+ADDRLP4 96
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 172
+INDIRF4
+CNSTF4 3225419776
+ADDRLP4 156
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 172+4
+INDIRF4
+CNSTF4 3225419776
+ADDRLP4 156
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 172+8
+INDIRF4
+CNSTF4 3225419776
+ADDRLP4 156
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTU2 10
+ASGNU2
+ADDRLP4 96
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 436
+ADDRGP4 reach_ladder
+ASGNP4
+ADDRLP4 436
+INDIRP4
+ADDRLP4 436
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 440
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 440
+INDIRP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1337
+CNSTI4 0
+RETI4
+ADDRGP4 $1227
+JUMPV
+LABELV $1337
+ADDRLP4 96
+INDIRP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 444
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 172
+INDIRB
+ASGNB 12
+ADDRLP4 96
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 124
+INDIRF4
+CNSTF4 3225419776
+ADDRLP4 156
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 124+4
+INDIRF4
+CNSTF4 3225419776
+ADDRLP4 156
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 124+8
+INDIRF4
+CNSTF4 3225419776
+ADDRLP4 156
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTU2 10
+ASGNU2
+ADDRLP4 96
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 448
+ADDRGP4 reach_ladder
+ASGNP4
+ADDRLP4 452
+CNSTI4 1
+ASGNI4
+ADDRLP4 448
+INDIRP4
+ADDRLP4 448
+INDIRP4
+INDIRI4
+ADDRLP4 452
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 452
+INDIRI4
+RETI4
+ADDRGP4 $1227
+JUMPV
+LABELV $1327
+ADDRLP4 428
+CNSTI4 0
+ASGNI4
+ADDRLP4 208
+INDIRI4
+ADDRLP4 428
+INDIRI4
+EQI4 $1341
+ADDRLP4 432
+CNSTI4 4
+ASGNI4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 432
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 432
+INDIRI4
+BANDI4
+ADDRLP4 428
+INDIRI4
+EQI4 $1341
+ADDRLP4 436
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 436
+INDIRP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1343
+CNSTI4 0
+RETI4
+ADDRGP4 $1227
+JUMPV
+LABELV $1343
+ADDRLP4 96
+INDIRP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 440
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 124
+INDIRB
+ASGNB 12
+ADDRLP4 96
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 172
+INDIRB
+ASGNB 12
+ADDRLP4 444
+ADDRLP4 96
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 444
+INDIRP4
+ADDRLP4 444
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 448
+ADDRLP4 96
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 448
+INDIRP4
+ADDRLP4 448
+INDIRP4
+INDIRF4
+CNSTF4 3245342720
+ADDRLP4 156
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 452
+ADDRLP4 96
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 452
+INDIRP4
+ADDRLP4 452
+INDIRP4
+INDIRF4
+CNSTF4 3245342720
+ADDRLP4 156
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 456
+ADDRLP4 96
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 456
+INDIRP4
+ADDRLP4 456
+INDIRP4
+INDIRF4
+CNSTF4 3245342720
+ADDRLP4 156
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTU2 10
+ASGNU2
+ADDRLP4 96
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 460
+ADDRGP4 reach_ladder
+ASGNP4
+ADDRLP4 460
+INDIRP4
+ADDRLP4 460
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 464
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 464
+INDIRP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1345
+CNSTI4 0
+RETI4
+ADDRGP4 $1227
+JUMPV
+LABELV $1345
+ADDRLP4 96
+INDIRP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 468
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 172
+INDIRB
+ASGNB 12
+ADDRLP4 96
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 124
+INDIRB
+ASGNB 12
+ADDRLP4 96
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTU2 10
+ASGNU2
+ADDRLP4 96
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 472
+ADDRGP4 reach_walkoffledge
+ASGNP4
+ADDRLP4 476
+CNSTI4 1
+ASGNI4
+ADDRLP4 472
+INDIRP4
+ADDRLP4 472
+INDIRP4
+INDIRI4
+ADDRLP4 476
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+RETI4
+ADDRGP4 $1227
+JUMPV
+LABELV $1341
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $1347
+ADDRLP4 160+8
+CNSTF4 1203982208
+ASGNF4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1353
+JUMPV
+LABELV $1350
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 436
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 440
+CNSTI4 12
+ASGNI4
+ADDRLP4 100
+ADDRLP4 440
+INDIRI4
+ADDRLP4 152
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 112
+ADDRLP4 440
+INDIRI4
+ADDRLP4 152
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 80
+ADDRLP4 100
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 100+4
+INDIRF4
+ADDRLP4 112+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 100+8
+INDIRF4
+ADDRLP4 112+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 448
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 80
+ADDRLP4 448
+INDIRF4
+ADDRLP4 80
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 448
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 80+8
+CNSTF4 1056964608
+ADDRLP4 80+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 80+8
+INDIRF4
+ADDRLP4 160+8
+INDIRF4
+GEF4 $1368
+ADDRLP4 160
+ADDRLP4 80
+INDIRB
+ASGNB 12
+ADDRLP4 212
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $1368
+LABELV $1351
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1353
+ADDRLP4 76
+INDIRI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $1350
+ADDRLP4 156
+CNSTI4 20
+ADDRLP4 48
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 436
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 220
+ADDRLP4 160
+INDIRF4
+ADDRLP4 436
+INDIRF4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 220+4
+ADDRLP4 160+4
+INDIRF4
+ADDRLP4 436
+INDIRF4
+ADDRLP4 156
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 220+8
+ADDRLP4 160+8
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 156
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 304
+ADDRLP4 220
+INDIRB
+ASGNB 12
+ADDRLP4 220+8
+ADDRLP4 220+8
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+ADDRLP4 304+8
+ADDRLP4 304+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 244
+ARGP4
+ADDRLP4 220
+ARGP4
+ADDRLP4 304
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 244+8+8
+ADDRLP4 244+8+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 244+8
+ARGP4
+ADDRLP4 444
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRFP4 4
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 48
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1386
+JUMPV
+LABELV $1383
+ADDRLP4 40
+ADDRLP4 72
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 448
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 24
+ADDRLP4 448
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1389
+ADDRLP4 148
+CNSTI4 20
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+INDIRF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ADDRLP4 148
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 136+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 148
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 136+8
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 456
+ADDRGP4 fabsf
+CALLF4
+ASGNF4
+ADDRLP4 456
+INDIRF4
+CNSTF4 1036831949
+GEF4 $1392
+ADDRGP4 $1385
+JUMPV
+LABELV $1392
+LABELV $1389
+LABELV $1384
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1386
+ADDRLP4 76
+INDIRI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $1383
+LABELV $1385
+ADDRLP4 76
+INDIRI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $1396
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $1396
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 456
+ADDRGP4 AAS_ReachabilityExists
+CALLI4
+ASGNI4
+ADDRLP4 456
+INDIRI4
+CNSTI4 0
+NEI4 $1396
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 460
+ADDRGP4 AAS_ReachabilityExists
+CALLI4
+ASGNI4
+ADDRLP4 460
+INDIRI4
+CNSTI4 0
+NEI4 $1396
+ADDRLP4 220+8
+INDIRF4
+ADDRLP4 244+8+8
+INDIRF4
+SUBF4
+ADDRLP4 300
+INDIRF4
+GEF4 $1398
+ADDRLP4 464
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 464
+INDIRP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1403
+CNSTI4 0
+RETI4
+ADDRGP4 $1227
+JUMPV
+LABELV $1403
+ADDRLP4 96
+INDIRP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 160
+INDIRB
+ASGNB 12
+ADDRLP4 96
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 244+8
+INDIRB
+ASGNB 12
+ADDRLP4 96
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTU2 10
+ASGNU2
+ADDRLP4 96
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 468
+ADDRGP4 reach_ladder
+ASGNP4
+ADDRLP4 468
+INDIRP4
+ADDRLP4 468
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 472
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 472
+INDIRP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1406
+CNSTI4 0
+RETI4
+ADDRGP4 $1227
+JUMPV
+LABELV $1406
+ADDRLP4 96
+INDIRP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 244+8
+INDIRB
+ASGNB 12
+ADDRLP4 96
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 160
+INDIRF4
+CNSTF4 3231711232
+ADDRLP4 156
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 160+4
+INDIRF4
+CNSTF4 3231711232
+ADDRLP4 156
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 160+8
+INDIRF4
+CNSTF4 3231711232
+ADDRLP4 156
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 476
+ADDRLP4 96
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 476
+INDIRP4
+ADDRLP4 476
+INDIRP4
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+ADDRLP4 96
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTU2 10
+ASGNU2
+ADDRLP4 96
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 480
+ADDRGP4 reach_jump
+ASGNP4
+ADDRLP4 484
+CNSTI4 1
+ASGNI4
+ADDRLP4 480
+INDIRP4
+ADDRLP4 480
+INDIRP4
+INDIRI4
+ADDRLP4 484
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+RETI4
+ADDRGP4 $1227
+JUMPV
+LABELV $1398
+LABELV $1396
+LABELV $1347
+LABELV $1268
+CNSTI4 0
+RETI4
+LABELV $1227
+endproc AAS_Reachability_Ladder 488 24
+export AAS_TravelFlagsForTeam
+proc AAS_TravelFlagsForTeam 8 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1414
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 AAS_IntForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1412
+CNSTI4 0
+RETI4
+ADDRGP4 $1411
+JUMPV
+LABELV $1412
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $1415
+CNSTI4 16777216
+RETI4
+ADDRGP4 $1411
+JUMPV
+LABELV $1415
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $1417
+CNSTI4 33554432
+RETI4
+ADDRGP4 $1411
+JUMPV
+LABELV $1417
+CNSTI4 0
+RETI4
+LABELV $1411
+endproc AAS_TravelFlagsForTeam 8 12
+export AAS_Reachability_Teleport
+proc AAS_Reachability_Teleport 892 56
+CNSTI4 0
+ARGI4
+ADDRLP4 812
+ADDRGP4 AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 812
+INDIRI4
+ASGNI4
+ADDRGP4 $1423
+JUMPV
+LABELV $1420
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRGP4 $160
+ARGP4
+ADDRLP4 176
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 816
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 816
+INDIRI4
+CNSTI4 0
+NEI4 $1424
+ADDRGP4 $1421
+JUMPV
+LABELV $1424
+ADDRLP4 176
+ARGP4
+ADDRGP4 $1428
+ARGP4
+ADDRLP4 820
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 820
+INDIRI4
+CNSTI4 0
+NEI4 $1426
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRGP4 $101
+ARGP4
+ADDRLP4 496
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $1430
+ARGP4
+ADDRLP4 496
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRLP4 824
+CNSTF4 0
+ASGNF4
+ADDRLP4 468+8
+ADDRLP4 824
+INDIRF4
+ASGNF4
+ADDRLP4 468+4
+ADDRLP4 824
+INDIRF4
+ASGNF4
+ADDRLP4 468
+ADDRLP4 824
+INDIRF4
+ASGNF4
+ADDRLP4 496+1
+ARGP4
+ADDRLP4 828
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 828
+INDIRI4
+ARGI4
+ADDRLP4 468
+ARGP4
+ADDRLP4 304
+ARGP4
+ADDRLP4 316
+ARGP4
+ADDRLP4 456
+ARGP4
+ADDRGP4 AAS_BSPModelMinsMaxsOrigin
+CALLV
+pop
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRGP4 $121
+ARGP4
+ADDRLP4 328
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 832
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 832
+INDIRI4
+CNSTI4 0
+NEI4 $1434
+CNSTI4 3
+ARGI4
+ADDRGP4 $1437
+ARGP4
+ADDRLP4 456
+INDIRF4
+ARGF4
+ADDRLP4 456+4
+INDIRF4
+ARGF4
+ADDRLP4 456+8
+INDIRF4
+ARGF4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1421
+JUMPV
+LABELV $1434
+CNSTI4 0
+ARGI4
+ADDRLP4 836
+ADDRGP4 AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 836
+INDIRI4
+ASGNI4
+ADDRGP4 $1443
+JUMPV
+LABELV $1440
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $160
+ARGP4
+ADDRLP4 176
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 840
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 840
+INDIRI4
+CNSTI4 0
+NEI4 $1444
+ADDRGP4 $1441
+JUMPV
+LABELV $1444
+ADDRLP4 176
+ARGP4
+ADDRGP4 $1448
+ARGP4
+ADDRLP4 844
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 844
+INDIRI4
+CNSTI4 0
+NEI4 $1446
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $128
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 848
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 848
+INDIRI4
+CNSTI4 0
+NEI4 $1449
+ADDRGP4 $1441
+JUMPV
+LABELV $1449
+ADDRLP4 16
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRLP4 852
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 852
+INDIRI4
+CNSTI4 0
+NEI4 $1451
+ADDRGP4 $1442
+JUMPV
+LABELV $1451
+LABELV $1446
+LABELV $1441
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 840
+ADDRGP4 AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 840
+INDIRI4
+ASGNI4
+LABELV $1443
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1440
+LABELV $1442
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1453
+ADDRGP4 $1421
+JUMPV
+LABELV $1453
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $121
+ARGP4
+ADDRLP4 328
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 844
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 844
+INDIRI4
+CNSTI4 0
+NEI4 $1427
+CNSTI4 3
+ARGI4
+ADDRGP4 $1458
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1421
+JUMPV
+LABELV $1426
+ADDRLP4 176
+ARGP4
+ADDRGP4 $1461
+ARGP4
+ADDRLP4 824
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 824
+INDIRI4
+CNSTI4 0
+NEI4 $1421
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRGP4 $101
+ARGP4
+ADDRLP4 496
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $1463
+ARGP4
+ADDRLP4 496
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRLP4 828
+CNSTF4 0
+ASGNF4
+ADDRLP4 468+8
+ADDRLP4 828
+INDIRF4
+ASGNF4
+ADDRLP4 468+4
+ADDRLP4 828
+INDIRF4
+ASGNF4
+ADDRLP4 468
+ADDRLP4 828
+INDIRF4
+ASGNF4
+ADDRLP4 496+1
+ARGP4
+ADDRLP4 832
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 832
+INDIRI4
+ARGI4
+ADDRLP4 468
+ARGP4
+ADDRLP4 304
+ARGP4
+ADDRLP4 316
+ARGP4
+ADDRLP4 456
+ARGP4
+ADDRGP4 AAS_BSPModelMinsMaxsOrigin
+CALLV
+pop
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRGP4 $121
+ARGP4
+ADDRLP4 328
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 836
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 836
+INDIRI4
+CNSTI4 0
+NEI4 $1460
+CNSTI4 3
+ARGI4
+ADDRGP4 $1470
+ARGP4
+ADDRLP4 456
+INDIRF4
+ARGF4
+ADDRLP4 456+4
+INDIRF4
+ARGF4
+ADDRLP4 456+8
+INDIRF4
+ARGF4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1421
+JUMPV
+LABELV $1460
+LABELV $1427
+CNSTI4 0
+ARGI4
+ADDRLP4 828
+ADDRGP4 AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 828
+INDIRI4
+ASGNI4
+ADDRGP4 $1476
+JUMPV
+LABELV $1473
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $128
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 832
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 832
+INDIRI4
+CNSTI4 0
+EQI4 $1477
+ADDRLP4 16
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRLP4 836
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 836
+INDIRI4
+CNSTI4 0
+NEI4 $1479
+ADDRGP4 $1475
+JUMPV
+LABELV $1479
+LABELV $1477
+LABELV $1474
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 832
+ADDRGP4 AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 832
+INDIRI4
+ASGNI4
+LABELV $1476
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1473
+LABELV $1475
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1481
+CNSTI4 3
+ARGI4
+ADDRGP4 $1484
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1421
+JUMPV
+LABELV $1481
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $135
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRLP4 836
+ADDRGP4 AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 836
+INDIRI4
+CNSTI4 0
+NEI4 $1485
+CNSTI4 3
+ARGI4
+ADDRGP4 $1488
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1421
+JUMPV
+LABELV $1485
+ADDRLP4 160
+ARGP4
+ADDRLP4 840
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 172
+ADDRLP4 840
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 844
+ADDRGP4 AAS_AreaTeleporter
+CALLI4
+ASGNI4
+ADDRLP4 844
+INDIRI4
+CNSTI4 0
+NEI4 $1489
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 848
+ADDRGP4 AAS_AreaJumpPad
+CALLI4
+ASGNI4
+ADDRLP4 848
+INDIRI4
+CNSTI4 0
+NEI4 $1489
+ADDRLP4 740
+ADDRLP4 160
+INDIRB
+ASGNB 12
+ADDRLP4 740+8
+ADDRLP4 740+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 752
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRLP4 740
+ARGP4
+CNSTI4 4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 752
+INDIRI4
+CNSTI4 0
+EQI4 $1492
+CNSTI4 3
+ARGI4
+ADDRGP4 $1495
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1421
+JUMPV
+LABELV $1492
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1496
+ARGP4
+ADDRLP4 808
+ARGP4
+ADDRGP4 AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 808
+INDIRF4
+CNSTF4 0
+EQF4 $1497
+ADDRLP4 468
+CNSTF4 0
+ASGNF4
+ADDRLP4 468+4
+ADDRLP4 808
+INDIRF4
+ASGNF4
+ADDRLP4 468+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 468
+ARGP4
+ADDRLP4 484
+ARGP4
+ADDRLP4 852
+CNSTP4 0
+ASGNP4
+ADDRLP4 852
+INDIRP4
+ARGP4
+ADDRLP4 852
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 856
+CNSTF4 1137180672
+ASGNF4
+ADDRLP4 484
+ADDRLP4 856
+INDIRF4
+ADDRLP4 484
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 484+4
+ADDRLP4 856
+INDIRF4
+ADDRLP4 484+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 484+8
+CNSTF4 1137180672
+ADDRLP4 484+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $1498
+JUMPV
+LABELV $1497
+ADDRLP4 852
+CNSTF4 0
+ASGNF4
+ADDRLP4 484+8
+ADDRLP4 852
+INDIRF4
+ASGNF4
+ADDRLP4 484+4
+ADDRLP4 852
+INDIRF4
+ASGNF4
+ADDRLP4 484
+ADDRLP4 852
+INDIRF4
+ASGNF4
+LABELV $1498
+ADDRLP4 852
+CNSTF4 0
+ASGNF4
+ADDRLP4 624+8
+ADDRLP4 852
+INDIRF4
+ASGNF4
+ADDRLP4 624+4
+ADDRLP4 852
+INDIRF4
+ASGNF4
+ADDRLP4 624
+ADDRLP4 852
+INDIRF4
+ASGNF4
+ADDRLP4 636
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 160
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 856
+CNSTI4 0
+ASGNI4
+ADDRLP4 856
+INDIRI4
+ARGI4
+ADDRLP4 484
+ARGP4
+ADDRLP4 624
+ARGP4
+ADDRLP4 856
+INDIRI4
+ARGI4
+CNSTI4 30
+ARGI4
+CNSTF4 1036831949
+ARGF4
+CNSTI4 445
+ARGI4
+ADDRLP4 856
+INDIRI4
+ARGI4
+ADDRLP4 856
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 AAS_PredictPlayerMovement
+CALLI4
+pop
+ADDRLP4 636
+ARGP4
+ADDRLP4 860
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 172
+ADDRLP4 860
+INDIRI4
+ASGNI4
+ADDRLP4 636+88
+INDIRI4
+CNSTI4 24
+BANDI4
+CNSTI4 0
+EQI4 $1509
+CNSTI4 2
+ARGI4
+ADDRGP4 $1513
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $1509
+ADDRLP4 160
+ADDRLP4 636
+INDIRB
+ASGNB 12
+LABELV $1489
+ADDRLP4 304
+ADDRLP4 456
+INDIRF4
+ADDRLP4 304
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 304+4
+ADDRLP4 456+4
+INDIRF4
+ADDRLP4 304+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 304+8
+ADDRLP4 456+8
+INDIRF4
+ADDRLP4 304+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 316
+ADDRLP4 456
+INDIRF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 316+4
+ADDRLP4 456+4
+INDIRF4
+ADDRLP4 316+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 316+8
+ADDRLP4 456+8
+INDIRF4
+ADDRLP4 316+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 304
+INDIRF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 304+4
+INDIRF4
+ADDRLP4 316+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 304+8
+INDIRF4
+ADDRLP4 316+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 852
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 144
+ADDRLP4 852
+INDIRF4
+ADDRLP4 144
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 852
+INDIRF4
+ADDRLP4 144+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 144+8
+CNSTF4 1056964608
+ADDRLP4 144+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 304
+ARGP4
+ADDRLP4 316
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 856
+ADDRGP4 AAS_LinkEntityClientBBox
+CALLP4
+ASGNP4
+ADDRLP4 480
+ADDRLP4 856
+INDIRP4
+ASGNP4
+ADDRLP4 480
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1536
+CNSTI4 1
+ARGI4
+ADDRGP4 $1539
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $1536
+ADDRLP4 8
+ADDRLP4 480
+INDIRP4
+ASGNP4
+ADDRGP4 $1543
+JUMPV
+LABELV $1540
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 860
+ADDRGP4 AAS_AreaTeleporter
+CALLI4
+ASGNI4
+ADDRLP4 860
+INDIRI4
+CNSTI4 0
+NEI4 $1544
+ADDRGP4 $1541
+JUMPV
+LABELV $1544
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 864
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 864
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1546
+ADDRGP4 $1542
+JUMPV
+LABELV $1546
+ADDRLP4 0
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 144
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 160
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRLP4 868
+ADDRGP4 AAS_TravelFlagsForTeam
+CALLI4
+ASGNI4
+ADDRLP4 872
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 872
+INDIRP4
+ADDRLP4 872
+INDIRP4
+INDIRI4
+ADDRLP4 868
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 880
+ADDRGP4 aassettings+96
+INDIRF4
+ASGNF4
+ADDRLP4 884
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 880
+INDIRF4
+ADDRLP4 884
+INDIRF4
+LTF4 $1550
+ADDRLP4 876
+ADDRLP4 880
+INDIRF4
+ADDRLP4 884
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1551
+JUMPV
+LABELV $1550
+ADDRLP4 876
+ADDRLP4 880
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1551
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 876
+INDIRU4
+CVUU2 4
+ASGNU2
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 888
+ADDRGP4 reach_teleport
+ASGNP4
+ADDRLP4 888
+INDIRP4
+ADDRLP4 888
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1541
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1543
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1540
+LABELV $1542
+ADDRLP4 480
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkFromAreas
+CALLV
+pop
+LABELV $1421
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRLP4 816
+ADDRGP4 AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 816
+INDIRI4
+ASGNI4
+LABELV $1423
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $1420
+LABELV $1419
+endproc AAS_Reachability_Teleport 892 56
+lit
+align 4
+LABELV $1553
+byte 4 0
+byte 4 0
+byte 4 0
+export AAS_Reachability_Elevator
+code
+proc AAS_Reachability_Elevator 756 24
+ADDRLP4 652
+ADDRGP4 $1553
+INDIRB
+ASGNB 12
+CNSTI4 0
+ARGI4
+ADDRLP4 664
+ADDRGP4 AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 276
+ADDRLP4 664
+INDIRI4
+ASGNI4
+ADDRGP4 $1557
+JUMPV
+LABELV $1554
+ADDRLP4 276
+INDIRI4
+ARGI4
+ADDRGP4 $160
+ARGP4
+ADDRLP4 380
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 668
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 668
+INDIRI4
+CNSTI4 0
+NEI4 $1558
+ADDRGP4 $1555
+JUMPV
+LABELV $1558
+ADDRLP4 380
+ARGP4
+ADDRGP4 $1562
+ARGP4
+ADDRLP4 672
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 672
+INDIRI4
+CNSTI4 0
+NEI4 $1560
+ADDRLP4 276
+INDIRI4
+ARGI4
+ADDRGP4 $101
+ARGP4
+ADDRLP4 512
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 676
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 676
+INDIRI4
+CNSTI4 0
+NEI4 $1563
+CNSTI4 3
+ARGI4
+ADDRGP4 $1566
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1555
+JUMPV
+LABELV $1563
+ADDRLP4 512+1
+ARGP4
+ADDRLP4 680
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 680
+INDIRI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+GTI4 $1568
+CNSTI4 3
+ARGI4
+ADDRGP4 $1571
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1555
+JUMPV
+LABELV $1568
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRLP4 652
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 AAS_BSPModelMinsMaxsOrigin
+CALLV
+pop
+ADDRLP4 276
+INDIRI4
+ARGI4
+ADDRGP4 $135
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 AAS_VectorForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 640
+ADDRLP4 32
+INDIRB
+ASGNB 12
+ADDRLP4 368
+ADDRLP4 32
+INDIRB
+ASGNB 12
+ADDRLP4 276
+INDIRI4
+ARGI4
+ADDRGP4 $1572
+ARGP4
+ADDRLP4 508
+ARGP4
+ADDRGP4 AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 508
+INDIRF4
+CNSTF4 0
+NEF4 $1573
+ADDRLP4 508
+CNSTF4 1090519040
+ASGNF4
+LABELV $1573
+ADDRLP4 276
+INDIRI4
+ARGI4
+ADDRGP4 $1575
+ARGP4
+ADDRLP4 204
+ARGP4
+ADDRGP4 AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 204
+INDIRF4
+CNSTF4 0
+NEF4 $1576
+ADDRLP4 204
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 64+8
+INDIRF4
+SUBF4
+ADDRLP4 508
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $1576
+ADDRLP4 276
+INDIRI4
+ARGI4
+ADDRGP4 $96
+ARGP4
+ADDRLP4 284
+ARGP4
+ADDRGP4 AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 284
+INDIRF4
+CNSTF4 0
+NEF4 $1580
+ADDRLP4 284
+CNSTF4 1128792064
+ASGNF4
+LABELV $1580
+ADDRLP4 368+8
+ADDRLP4 368+8
+INDIRF4
+ADDRLP4 204
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 288
+ADDRLP4 64
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 288+4
+ADDRLP4 64+4
+INDIRF4
+ADDRLP4 52+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 288+8
+ADDRLP4 64+8
+INDIRF4
+ADDRLP4 52+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 684
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 192
+ADDRLP4 368
+INDIRF4
+ADDRLP4 684
+INDIRF4
+ADDRLP4 288
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 192+4
+ADDRLP4 368+4
+INDIRF4
+ADDRLP4 684
+INDIRF4
+ADDRLP4 288+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 192+8
+ADDRLP4 368+8
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 288+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 192+8
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 640+8
+INDIRF4
+ADDRLP4 368+8
+INDIRF4
+SUBF4
+SUBF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRLP4 288
+ADDRLP4 64
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 288+4
+ADDRLP4 64+4
+INDIRF4
+ADDRLP4 52+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 288+8
+ADDRLP4 64+8
+INDIRF4
+ADDRLP4 52+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 688
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 180
+ADDRLP4 368
+INDIRF4
+ADDRLP4 688
+INDIRF4
+ADDRLP4 288
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 180+4
+ADDRLP4 368+4
+INDIRF4
+ADDRLP4 688
+INDIRF4
+ADDRLP4 288+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 180+8
+ADDRLP4 368+8
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 288+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 180+8
+ADDRLP4 52+8
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRLP4 300
+CNSTI4 0
+ASGNI4
+LABELV $1613
+ADDRLP4 692
+ADDRLP4 300
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 64
+ADDP4
+ASGNP4
+ADDRLP4 692
+INDIRP4
+ADDRLP4 692
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 696
+ADDRLP4 300
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 52
+ADDP4
+ASGNP4
+ADDRLP4 696
+INDIRP4
+ADDRLP4 696
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $1614
+ADDRLP4 300
+ADDRLP4 300
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LTI4 $1613
+ADDRLP4 288
+ADDRLP4 64
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 288+4
+ADDRLP4 64+4
+INDIRF4
+ADDRLP4 52+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 288+8
+ADDRLP4 64+8
+INDIRF4
+ADDRLP4 52+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 692
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 288
+ADDRLP4 692
+INDIRF4
+ADDRLP4 288
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 288+4
+ADDRLP4 692
+INDIRF4
+ADDRLP4 288+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 288+8
+CNSTF4 1056964608
+ADDRLP4 288+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 304
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 304+4
+ADDRLP4 288
+INDIRF4
+ASGNF4
+ADDRLP4 304+8
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 304+12
+ADDRLP4 288
+INDIRF4
+ASGNF4
+ADDRLP4 336
+ADDRLP4 288+4
+INDIRF4
+ASGNF4
+ADDRLP4 336+4
+ADDRLP4 52+4
+INDIRF4
+ASGNF4
+ADDRLP4 336+8
+ADDRLP4 288+4
+INDIRF4
+ASGNF4
+ADDRLP4 336+12
+ADDRLP4 64+4
+INDIRF4
+ASGNF4
+ADDRLP4 304+16
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 304+20
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 304+24
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 304+28
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 336+16
+ADDRLP4 52+4
+INDIRF4
+ASGNF4
+ADDRLP4 336+20
+ADDRLP4 52+4
+INDIRF4
+ASGNF4
+ADDRLP4 336+24
+ADDRLP4 64+4
+INDIRF4
+ASGNF4
+ADDRLP4 336+28
+ADDRLP4 64+4
+INDIRF4
+ASGNF4
+ADDRLP4 300
+CNSTI4 0
+ASGNI4
+LABELV $1649
+ADDRLP4 300
+INDIRI4
+CNSTI4 8
+GEI4 $1653
+ADDRLP4 696
+ADDRLP4 300
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 32
+INDIRF4
+ADDRLP4 696
+INDIRI4
+ADDRLP4 304
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 156+4
+ADDRLP4 32+4
+INDIRF4
+ADDRLP4 696
+INDIRI4
+ADDRLP4 336
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 156+8
+ADDRLP4 192+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 156
+ARGP4
+ADDRLP4 700
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 172
+ADDRLP4 700
+INDIRI4
+ASGNI4
+ADDRLP4 168
+CNSTI4 0
+ASGNI4
+LABELV $1659
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $1663
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 704
+ADDRGP4 AAS_AreaGrounded
+CALLI4
+ASGNI4
+ADDRLP4 704
+INDIRI4
+CNSTI4 0
+NEI4 $1667
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 708
+ADDRGP4 AAS_AreaSwim
+CALLI4
+ASGNI4
+ADDRLP4 708
+INDIRI4
+CNSTI4 0
+EQI4 $1665
+LABELV $1667
+ADDRGP4 $1661
+JUMPV
+LABELV $1665
+LABELV $1663
+ADDRLP4 156+8
+ADDRLP4 156+8
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ASGNF4
+ADDRLP4 156
+ARGP4
+ADDRLP4 704
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 172
+ADDRLP4 704
+INDIRI4
+ASGNI4
+LABELV $1660
+ADDRLP4 168
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 16
+LTI4 $1659
+LABELV $1661
+ADDRLP4 168
+INDIRI4
+CNSTI4 16
+LTI4 $1654
+ADDRGP4 $1650
+JUMPV
+LABELV $1653
+ADDRLP4 156
+ADDRLP4 180
+INDIRB
+ASGNB 12
+ADDRLP4 156+8
+ADDRLP4 156+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 156
+ARGP4
+ADDRLP4 696
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 172
+ADDRLP4 696
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+NEI4 $1672
+ADDRGP4 $1650
+JUMPV
+LABELV $1672
+ADDRLP4 156
+ADDRLP4 192
+INDIRB
+ASGNB 12
+ADDRLP4 156+8
+ADDRLP4 156+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+LABELV $1654
+ADDRLP4 272
+CNSTI4 0
+ASGNI4
+LABELV $1675
+ADDRLP4 168
+CNSTI4 0
+ASGNI4
+LABELV $1679
+ADDRLP4 696
+ADDRLP4 168
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 64
+ADDP4
+ASGNP4
+ADDRLP4 696
+INDIRP4
+ADDRLP4 696
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+ADDRLP4 700
+ADDRLP4 168
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 52
+ADDP4
+ASGNP4
+ADDRLP4 700
+INDIRP4
+ADDRLP4 700
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ASGNF4
+LABELV $1680
+ADDRLP4 168
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 3
+LTI4 $1679
+ADDRLP4 208
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 208+4
+ADDRLP4 288
+INDIRF4
+ASGNF4
+ADDRLP4 208+8
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 208+12
+ADDRLP4 288
+INDIRF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 288+4
+INDIRF4
+ASGNF4
+ADDRLP4 240+4
+ADDRLP4 52+4
+INDIRF4
+ASGNF4
+ADDRLP4 240+8
+ADDRLP4 288+4
+INDIRF4
+ASGNF4
+ADDRLP4 240+12
+ADDRLP4 64+4
+INDIRF4
+ASGNF4
+ADDRLP4 208+16
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 208+20
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 208+24
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 208+28
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 240+16
+ADDRLP4 52+4
+INDIRF4
+ASGNF4
+ADDRLP4 240+20
+ADDRLP4 52+4
+INDIRF4
+ASGNF4
+ADDRLP4 240+24
+ADDRLP4 64+4
+INDIRF4
+ASGNF4
+ADDRLP4 240+28
+ADDRLP4 64+4
+INDIRF4
+ASGNF4
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+LABELV $1705
+ADDRLP4 696
+ADDRLP4 176
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 32
+INDIRF4
+ADDRLP4 696
+INDIRI4
+ADDRLP4 208
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 32+4
+INDIRF4
+ADDRLP4 696
+INDIRI4
+ADDRLP4 240
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 20+8
+ADDRLP4 180+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 700
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 700
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+LABELV $1713
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1717
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 704
+ADDRGP4 AAS_AreaGrounded
+CALLI4
+ASGNI4
+ADDRLP4 704
+INDIRI4
+CNSTI4 0
+NEI4 $1721
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 708
+ADDRGP4 AAS_AreaSwim
+CALLI4
+ASGNI4
+ADDRLP4 708
+INDIRI4
+CNSTI4 0
+EQI4 $1719
+LABELV $1721
+ADDRLP4 76
+ADDRLP4 180
+INDIRB
+ASGNB 12
+ADDRLP4 76+8
+ADDRLP4 76+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 88
+ADDRLP4 20
+INDIRB
+ASGNB 12
+ADDRLP4 88+8
+ADDRLP4 88+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 100
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 88
+ARGP4
+CNSTI4 4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 100+4
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1724
+ADDRGP4 $1715
+JUMPV
+LABELV $1724
+LABELV $1719
+LABELV $1717
+ADDRLP4 20+8
+ADDRLP4 20+8
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ASGNF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 704
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 704
+INDIRI4
+ASGNI4
+LABELV $1714
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 16
+LTI4 $1713
+LABELV $1715
+ADDRLP4 44
+INDIRI4
+CNSTI4 16
+LTI4 $1728
+ADDRGP4 $1706
+JUMPV
+LABELV $1728
+ADDRLP4 4
+INDIRI4
+ADDRLP4 172
+INDIRI4
+NEI4 $1730
+ADDRGP4 $1706
+JUMPV
+LABELV $1730
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 704
+ADDRGP4 AAS_AreaGrounded
+CALLI4
+ASGNI4
+ADDRLP4 704
+INDIRI4
+CNSTI4 0
+NEI4 $1732
+ADDRGP4 $1706
+JUMPV
+LABELV $1732
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 708
+ADDRGP4 AAS_ReachabilityExists
+CALLI4
+ASGNI4
+ADDRLP4 708
+INDIRI4
+CNSTI4 0
+EQI4 $1734
+ADDRGP4 $1706
+JUMPV
+LABELV $1734
+ADDRLP4 8
+ADDRLP4 156
+INDIRF4
+ADDRLP4 192
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 156+4
+INDIRF4
+ADDRLP4 192+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 156+8
+INDIRF4
+ADDRLP4 192+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 712
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 8
+ADDRLP4 156
+INDIRF4
+ADDRLP4 712
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 156+4
+INDIRF4
+ADDRLP4 712
+INDIRF4
+ADDRLP4 8+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 156+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1747
+ADDRLP4 716
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 720
+ADDRLP4 716
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 724
+ADDRLP4 716
+INDIRI4
+ADDRLP4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 720
+INDIRF4
+ADDRLP4 724
+INDIRF4
+ADDRLP4 716
+INDIRI4
+ADDRLP4 64
+ADDP4
+INDIRF4
+ADDF4
+LTF4 $1753
+ADDRLP4 720
+INDIRF4
+ADDRLP4 724
+INDIRF4
+ADDRLP4 716
+INDIRI4
+ADDRLP4 52
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $1751
+LABELV $1753
+ADDRGP4 $1749
+JUMPV
+LABELV $1751
+LABELV $1748
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1747
+LABELV $1749
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1754
+ADDRGP4 $1706
+JUMPV
+LABELV $1754
+ADDRLP4 728
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 728
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1756
+ADDRGP4 $1706
+JUMPV
+LABELV $1756
+ADDRLP4 48
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 204
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 48
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 20
+INDIRB
+ASGNB 12
+ADDRLP4 48
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 11
+ASGNI4
+ADDRLP4 276
+INDIRI4
+ARGI4
+ADDRLP4 732
+ADDRGP4 AAS_TravelFlagsForTeam
+CALLI4
+ASGNI4
+ADDRLP4 736
+ADDRLP4 48
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 736
+INDIRP4
+ADDRLP4 736
+INDIRP4
+INDIRI4
+ADDRLP4 732
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 744
+ADDRGP4 aassettings+140
+INDIRF4
+CNSTF4 1120403456
+ADDRLP4 204
+INDIRF4
+MULF4
+ADDRLP4 284
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+ADDRLP4 748
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 744
+INDIRF4
+ADDRLP4 748
+INDIRF4
+LTF4 $1760
+ADDRLP4 740
+ADDRLP4 744
+INDIRF4
+ADDRLP4 748
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1761
+JUMPV
+LABELV $1760
+ADDRLP4 740
+ADDRLP4 744
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1761
+ADDRLP4 48
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 740
+INDIRU4
+CVUU2 4
+ASGNU2
+ADDRLP4 48
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 172
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 172
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 272
+CNSTI4 9999
+ASGNI4
+ADDRLP4 752
+ADDRGP4 reach_elevator
+ASGNP4
+ADDRLP4 752
+INDIRP4
+ADDRLP4 752
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1706
+ADDRLP4 176
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 8
+LTI4 $1705
+LABELV $1676
+ADDRLP4 272
+ADDRLP4 272
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 3
+LTI4 $1675
+LABELV $1650
+ADDRLP4 300
+ADDRLP4 300
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 9
+LTI4 $1649
+LABELV $1560
+LABELV $1555
+ADDRLP4 276
+INDIRI4
+ARGI4
+ADDRLP4 668
+ADDRGP4 AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 276
+ADDRLP4 668
+INDIRI4
+ASGNI4
+LABELV $1557
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $1554
+LABELV $1552
+endproc AAS_Reachability_Elevator 756 24
+lit
+align 4
+LABELV $1763
+byte 4 0
+skip 8
+align 4
+LABELV $1764
+byte 4 0
+skip 8
+align 4
+LABELV $1765
+byte 4 0
+skip 8
+align 4
+LABELV $1766
+byte 4 0
+skip 8
+export AAS_FindFaceReachabilities
+code
+proc AAS_FindFaceReachabilities 208 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 $1763
+INDIRB
+ASGNB 12
+ADDRLP4 56
+ADDRGP4 $1764
+INDIRB
+ASGNB 12
+ADDRLP4 44
+ADDRGP4 $1765
+INDIRB
+ASGNB 12
+ADDRLP4 68
+ADDRGP4 $1766
+INDIRB
+ASGNB 12
+ADDRLP4 152
+CNSTP4 0
+ASGNP4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+CNSTP4 0
+ASGNP4
+ADDRLP4 144
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1770
+JUMPV
+LABELV $1767
+ADDRLP4 112
+CNSTI4 48
+ADDRLP4 144
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 1232348144
+ASGNF4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1776
+JUMPV
+LABELV $1773
+ADDRLP4 80
+ADDRLP4 112
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 108
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 172
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 24
+ADDRLP4 172
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 176
+CNSTI4 4
+ASGNI4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 176
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $1779
+ADDRGP4 $1774
+JUMPV
+LABELV $1779
+ADDRLP4 20
+CNSTI4 20
+ADDRLP4 100
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1785
+JUMPV
+LABELV $1782
+ADDRLP4 100
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 92
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 104
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 184
+CNSTI4 12
+ASGNI4
+ADDRLP4 24
+ADDRLP4 184
+INDIRI4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 184
+INDIRI4
+ADDRLP4 96
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1793
+JUMPV
+LABELV $1790
+ADDRLP4 192
+CNSTI4 12
+ASGNI4
+ADDRLP4 12
+ADDRLP4 192
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 192
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 4
+INDIRI4
+MODI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 AAS_ClosestEdgePoints
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $1794
+ADDRLP4 88
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 84
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $1794
+LABELV $1791
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1793
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $1790
+LABELV $1783
+ADDRLP4 92
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1785
+ADDRLP4 92
+INDIRI4
+ADDRLP4 100
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $1782
+LABELV $1774
+ADDRLP4 108
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1776
+ADDRLP4 108
+INDIRI4
+ADDRLP4 112
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $1773
+ADDRLP4 4
+INDIRF4
+CNSTF4 1128267776
+LEF4 $1796
+ADDRGP4 $1768
+JUMPV
+LABELV $1796
+ADDRLP4 32
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 VectorMiddle
+CALLV
+pop
+ADDRLP4 44
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 VectorMiddle
+CALLV
+pop
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1798
+ADDRLP4 156
+ADDRLP4 32
+INDIRB
+ASGNB 12
+ADDRLP4 32
+ADDRLP4 44
+INDIRB
+ASGNB 12
+ADDRLP4 44
+ADDRLP4 156
+INDIRB
+ASGNB 12
+LABELV $1798
+ADDRLP4 120
+ADDRLP4 44
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 32+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 32+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 120
+ARGP4
+ADDRLP4 172
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRGP4 aassettings+76
+INDIRF4
+ARGF4
+ADDRLP4 176
+ADDRGP4 AAS_MaxJumpDistance
+CALLF4
+ASGNF4
+ADDRLP4 148
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 176
+INDIRF4
+MULF4
+LEF4 $1807
+ADDRGP4 $1768
+JUMPV
+LABELV $1807
+ADDRLP4 44+8
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ADDRLP4 32+8
+INDIRF4
+LEF4 $1810
+ADDRGP4 $1768
+JUMPV
+LABELV $1810
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 32+8
+INDIRF4
+CNSTF4 1124073472
+SUBF4
+GEF4 $1814
+ADDRGP4 $1768
+JUMPV
+LABELV $1814
+ADDRLP4 148
+INDIRF4
+CNSTF4 1107296256
+LEF4 $1818
+CNSTF4 0
+ARGF4
+ADDRLP4 32
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 168
+ARGP4
+ADDRLP4 180
+ADDRGP4 AAS_HorizontalVelocityForJump
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $1820
+ADDRGP4 $1768
+JUMPV
+LABELV $1820
+LABELV $1818
+ADDRLP4 32+8
+ADDRLP4 32+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 44+8
+ADDRLP4 44+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1824
+ADDRLP4 132
+ADDRLP4 44
+INDIRB
+ASGNB 12
+ADDRGP4 $1825
+JUMPV
+LABELV $1824
+ADDRLP4 132
+ADDRLP4 32
+INDIRB
+ASGNB 12
+LABELV $1825
+ADDRLP4 84
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1826
+ADDRLP4 184
+ADDRLP4 84
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 132+8
+ADDRLP4 84
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ADDRLP4 132
+INDIRF4
+MULF4
+ADDRLP4 84
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 132+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 184
+INDIRF4
+ADDRLP4 132+8
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ADDRLP4 184
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $1827
+JUMPV
+LABELV $1826
+ADDRLP4 132+8
+CNSTF4 0
+ASGNF4
+LABELV $1827
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 188
+ADDRGP4 AAS_PointInsideFace
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $1832
+ADDRLP4 44+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ADDRLP4 32+8
+INDIRF4
+LEF4 $1834
+ADDRGP4 $1768
+JUMPV
+LABELV $1834
+LABELV $1832
+ADDRLP4 192
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 116
+ADDRLP4 192
+INDIRP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1838
+ADDRLP4 152
+INDIRP4
+RETP4
+ADDRGP4 $1762
+JUMPV
+LABELV $1838
+ADDRLP4 116
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 116
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 32
+INDIRB
+ASGNB 12
+ADDRLP4 116
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 44
+INDIRB
+ASGNB 12
+ADDRLP4 116
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTU2 0
+ASGNU2
+ADDRLP4 116
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 152
+ADDRLP4 116
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1840
+ADDRLP4 116
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 116
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AAS_PermanentLine
+CALLV
+pop
+ADDRGP4 $1841
+JUMPV
+LABELV $1840
+ADDRLP4 116
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 116
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 AAS_PermanentLine
+CALLV
+pop
+LABELV $1841
+LABELV $1768
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1770
+ADDRLP4 144
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $1767
+ADDRLP4 152
+INDIRP4
+RETP4
+LABELV $1762
+endproc AAS_FindFaceReachabilities 208 44
+lit
+align 4
+LABELV $1843
+byte 4 0
+byte 4 0
+byte 4 0
+export AAS_Reachability_FuncBobbing
+code
+proc AAS_Reachability_FuncBobbing 904 32
+ADDRLP4 752
+ADDRGP4 $1843
+INDIRB
+ASGNB 12
+CNSTI4 0
+ARGI4
+ADDRLP4 764
+ADDRGP4 AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 224
+ADDRLP4 764
+INDIRI4
+ASGNI4
+ADDRGP4 $1847
+JUMPV
+LABELV $1844
+ADDRLP4 224
+INDIRI4
+ARGI4
+ADDRGP4 $160
+ARGP4
+ADDRLP4 496
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 768
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 768
+INDIRI4
+CNSTI4 0
+NEI4 $1848
+ADDRGP4 $1845
+JUMPV
+LABELV $1848
+ADDRLP4 496
+ARGP4
+ADDRGP4 $1852
+ARGP4
+ADDRLP4 772
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 772
+INDIRI4
+CNSTI4 0
+EQI4 $1850
+ADDRGP4 $1845
+JUMPV
+LABELV $1850
+ADDRLP4 224
+INDIRI4
+ARGI4
+ADDRGP4 $1575
+ARGP4
+ADDRLP4 492
+ARGP4
+ADDRGP4 AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 492
+INDIRF4
+CNSTF4 0
+NEF4 $1853
+ADDRLP4 492
+CNSTF4 1107296256
+ASGNF4
+LABELV $1853
+ADDRLP4 224
+INDIRI4
+ARGI4
+ADDRGP4 $101
+ARGP4
+ADDRLP4 624
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 776
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 776
+INDIRI4
+CNSTI4 0
+NEI4 $1855
+CNSTI4 3
+ARGI4
+ADDRGP4 $1858
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1845
+JUMPV
+LABELV $1855
+ADDRLP4 624+1
+ARGP4
+ADDRLP4 780
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 228
+ADDRLP4 780
+INDIRI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+GTI4 $1860
+CNSTI4 3
+ARGI4
+ADDRGP4 $1863
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1845
+JUMPV
+LABELV $1860
+ADDRLP4 224
+INDIRI4
+ARGI4
+ADDRGP4 $135
+ARGP4
+ADDRLP4 480
+ARGP4
+ADDRLP4 784
+ADDRGP4 AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 784
+INDIRI4
+CNSTI4 0
+NEI4 $1864
+ADDRLP4 788
+CNSTF4 0
+ASGNF4
+ADDRLP4 480
+ADDRLP4 788
+INDIRF4
+ASGNF4
+ADDRLP4 480+4
+ADDRLP4 788
+INDIRF4
+ASGNF4
+ADDRLP4 480+8
+CNSTF4 0
+ASGNF4
+LABELV $1864
+ADDRLP4 228
+INDIRI4
+ARGI4
+ADDRLP4 752
+ARGP4
+ADDRLP4 428
+ARGP4
+ADDRLP4 412
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 AAS_BSPModelMinsMaxsOrigin
+CALLV
+pop
+ADDRLP4 428
+ADDRLP4 428
+INDIRF4
+ADDRLP4 480
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 428+4
+ADDRLP4 428+4
+INDIRF4
+ADDRLP4 480+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 428+8
+ADDRLP4 428+8
+INDIRF4
+ADDRLP4 480+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 412
+ADDRLP4 412
+INDIRF4
+ADDRLP4 480
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 412+4
+ADDRLP4 412+4
+INDIRF4
+ADDRLP4 480+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 412+8
+ADDRLP4 412+8
+INDIRF4
+ADDRLP4 480+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 400
+ADDRLP4 428
+INDIRF4
+ADDRLP4 412
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 400+4
+ADDRLP4 428+4
+INDIRF4
+ADDRLP4 412+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 400+8
+ADDRLP4 428+8
+INDIRF4
+ADDRLP4 412+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 792
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 400
+ADDRLP4 792
+INDIRF4
+ADDRLP4 400
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 400+4
+ADDRLP4 792
+INDIRF4
+ADDRLP4 400+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 400+8
+CNSTF4 1056964608
+ADDRLP4 400+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 480
+ADDRLP4 400
+INDIRB
+ASGNB 12
+ADDRLP4 200
+ADDRLP4 480
+INDIRB
+ASGNB 12
+ADDRLP4 212
+ADDRLP4 480
+INDIRB
+ASGNB 12
+ADDRLP4 224
+INDIRI4
+ARGI4
+ADDRGP4 $1890
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRGP4 AAS_IntForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 196
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1891
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1892
+JUMPV
+LABELV $1891
+ADDRLP4 196
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1893
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1894
+JUMPV
+LABELV $1893
+ADDRLP4 72
+CNSTI4 2
+ASGNI4
+LABELV $1894
+LABELV $1892
+ADDRLP4 796
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 212
+ADDP4
+ASGNP4
+ADDRLP4 796
+INDIRP4
+ADDRLP4 796
+INDIRP4
+INDIRF4
+ADDRLP4 492
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 800
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 200
+ADDP4
+ASGNP4
+ADDRLP4 800
+INDIRP4
+ADDRLP4 800
+INDIRP4
+INDIRF4
+ADDRLP4 492
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1895
+ARGP4
+ADDRLP4 228
+INDIRI4
+ARGI4
+ADDRLP4 212
+INDIRF4
+ARGF4
+ADDRLP4 212+4
+INDIRF4
+ARGF4
+ADDRLP4 212+8
+INDIRF4
+ARGF4
+ADDRLP4 200
+INDIRF4
+ARGF4
+ADDRLP4 200+4
+INDIRF4
+ARGF4
+ADDRLP4 200+8
+INDIRF4
+ARGF4
+ADDRGP4 Log_Write
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $1900
+CNSTI4 12
+ADDRLP4 68
+INDIRI4
+MULI4
+ADDRLP4 304
+ADDP4
+ADDRLP4 212
+INDIRB
+ASGNB 12
+ADDRLP4 804
+CNSTI4 12
+ADDRLP4 68
+INDIRI4
+MULI4
+ADDRLP4 304+8
+ADDP4
+ASGNP4
+ADDRLP4 804
+INDIRP4
+ADDRLP4 804
+INDIRP4
+INDIRF4
+ADDRLP4 412+8
+INDIRF4
+ADDRLP4 400+8
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 808
+CNSTI4 12
+ADDRLP4 68
+INDIRI4
+MULI4
+ADDRLP4 304+8
+ADDP4
+ASGNP4
+ADDRLP4 808
+INDIRP4
+ADDRLP4 808
+INDIRP4
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+LABELV $1901
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 4
+LTI4 $1900
+ADDRLP4 304
+ADDRLP4 304
+INDIRF4
+ADDRLP4 412
+INDIRF4
+ADDRLP4 400
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 304+4
+ADDRLP4 304+4
+INDIRF4
+ADDRLP4 412+4
+INDIRF4
+ADDRLP4 400+4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 304+12
+ADDRLP4 304+12
+INDIRF4
+ADDRLP4 412
+INDIRF4
+ADDRLP4 400
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 304+12+4
+ADDRLP4 304+12+4
+INDIRF4
+ADDRLP4 428+4
+INDIRF4
+ADDRLP4 400+4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 304+24
+ADDRLP4 304+24
+INDIRF4
+ADDRLP4 428
+INDIRF4
+ADDRLP4 400
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 304+24+4
+ADDRLP4 304+24+4
+INDIRF4
+ADDRLP4 428+4
+INDIRF4
+ADDRLP4 400+4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 304+36
+ADDRLP4 304+36
+INDIRF4
+ADDRLP4 428
+INDIRF4
+ADDRLP4 400
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 304+36+4
+ADDRLP4 304+36+4
+INDIRF4
+ADDRLP4 412+4
+INDIRF4
+ADDRLP4 400+4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 440+12
+ADDRLP4 304+8
+INDIRF4
+ASGNF4
+ADDRLP4 804
+CNSTF4 0
+ASGNF4
+ADDRLP4 440
+ADDRLP4 804
+INDIRF4
+ASGNF4
+ADDRLP4 440+4
+ADDRLP4 804
+INDIRF4
+ASGNF4
+ADDRLP4 440+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $1930
+CNSTI4 12
+ADDRLP4 68
+INDIRI4
+MULI4
+ADDRLP4 352
+ADDP4
+ADDRLP4 200
+INDIRB
+ASGNB 12
+ADDRLP4 808
+CNSTI4 12
+ADDRLP4 68
+INDIRI4
+MULI4
+ADDRLP4 352+8
+ADDP4
+ASGNP4
+ADDRLP4 808
+INDIRP4
+ADDRLP4 808
+INDIRP4
+INDIRF4
+ADDRLP4 412+8
+INDIRF4
+ADDRLP4 400+8
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 812
+CNSTI4 12
+ADDRLP4 68
+INDIRI4
+MULI4
+ADDRLP4 352+8
+ADDP4
+ASGNP4
+ADDRLP4 812
+INDIRP4
+ADDRLP4 812
+INDIRP4
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+LABELV $1931
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 4
+LTI4 $1930
+ADDRLP4 352
+ADDRLP4 352
+INDIRF4
+ADDRLP4 412
+INDIRF4
+ADDRLP4 400
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 352+4
+ADDRLP4 352+4
+INDIRF4
+ADDRLP4 412+4
+INDIRF4
+ADDRLP4 400+4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 352+12
+ADDRLP4 352+12
+INDIRF4
+ADDRLP4 412
+INDIRF4
+ADDRLP4 400
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 352+12+4
+ADDRLP4 352+12+4
+INDIRF4
+ADDRLP4 428+4
+INDIRF4
+ADDRLP4 400+4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 352+24
+ADDRLP4 352+24
+INDIRF4
+ADDRLP4 428
+INDIRF4
+ADDRLP4 400
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 352+24+4
+ADDRLP4 352+24+4
+INDIRF4
+ADDRLP4 428+4
+INDIRF4
+ADDRLP4 400+4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 352+36
+ADDRLP4 352+36
+INDIRF4
+ADDRLP4 428
+INDIRF4
+ADDRLP4 400
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 352+36+4
+ADDRLP4 352+36+4
+INDIRF4
+ADDRLP4 412+4
+INDIRF4
+ADDRLP4 400+4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 460+12
+ADDRLP4 352+8
+INDIRF4
+ASGNF4
+ADDRLP4 808
+CNSTF4 0
+ASGNF4
+ADDRLP4 460
+ADDRLP4 808
+INDIRF4
+ASGNF4
+ADDRLP4 460+4
+ADDRLP4 808
+INDIRF4
+ASGNF4
+ADDRLP4 460+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 272
+ADDRLP4 212
+INDIRB
+ASGNB 12
+ADDRLP4 272+8
+ADDRLP4 272+8
+INDIRF4
+ADDRLP4 412+8
+INDIRF4
+ADDRLP4 400+8
+INDIRF4
+SUBF4
+CNSTF4 1103101952
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 284
+ADDRLP4 200
+INDIRB
+ASGNB 12
+ADDRLP4 284+8
+ADDRLP4 284+8
+INDIRF4
+ADDRLP4 412+8
+INDIRF4
+ADDRLP4 400+8
+INDIRF4
+SUBF4
+CNSTF4 1103101952
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 272
+ARGP4
+ADDRLP4 812
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 812
+INDIRI4
+CNSTI4 0
+NEI4 $1966
+ADDRGP4 $1845
+JUMPV
+LABELV $1966
+ADDRLP4 284
+ARGP4
+ADDRLP4 816
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 816
+INDIRI4
+CNSTI4 0
+NEI4 $1968
+ADDRGP4 $1845
+JUMPV
+LABELV $1968
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $1970
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $1974
+ADDRLP4 304
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 440
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 820
+ADDRGP4 AAS_FindFaceReachabilities
+CALLP4
+ASGNP4
+ADDRLP4 424
+ADDRLP4 820
+INDIRP4
+ASGNP4
+ADDRLP4 352
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 460
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 824
+ADDRGP4 AAS_FindFaceReachabilities
+CALLP4
+ASGNP4
+ADDRLP4 300
+ADDRLP4 824
+INDIRP4
+ASGNP4
+ADDRGP4 $1975
+JUMPV
+LABELV $1974
+ADDRLP4 352
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 460
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 820
+ADDRGP4 AAS_FindFaceReachabilities
+CALLP4
+ASGNP4
+ADDRLP4 424
+ADDRLP4 820
+INDIRP4
+ASGNP4
+ADDRLP4 304
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 440
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 824
+ADDRGP4 AAS_FindFaceReachabilities
+CALLP4
+ASGNP4
+ADDRLP4 300
+ADDRLP4 824
+INDIRP4
+ASGNP4
+LABELV $1975
+ADDRLP4 0
+ADDRLP4 424
+INDIRP4
+ASGNP4
+ADDRGP4 $1979
+JUMPV
+LABELV $1976
+ADDRLP4 296
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 300
+INDIRP4
+ASGNP4
+ADDRGP4 $1983
+JUMPV
+LABELV $1980
+ADDRLP4 64
+ADDRLP4 20
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1984
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Log_Write
+CALLV
+pop
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $1985
+ADDRLP4 48
+ADDRLP4 272
+INDIRB
+ASGNB 12
+ADDRGP4 $1986
+JUMPV
+LABELV $1985
+ADDRLP4 48
+ADDRLP4 284
+INDIRB
+ASGNB 12
+LABELV $1986
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 48+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 48+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 832
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 832
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 836
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24
+ADDRLP4 832
+INDIRP4
+INDIRF4
+ADDRLP4 836
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 836
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 844
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 844
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 844
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 36+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 232
+ARGP4
+ADDRLP4 76
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 848
+ADDRGP4 AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 848
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+GTI4 $2002
+ADDRGP4 $1981
+JUMPV
+LABELV $2002
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+LEI4 $2004
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 76+12
+INDIRB
+ASGNB 12
+ADDRGP4 $2005
+JUMPV
+LABELV $2004
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 36
+INDIRB
+ASGNB 12
+LABELV $2005
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 852
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 852
+INDIRI4
+CNSTI4 0
+NEI4 $2007
+ADDRGP4 $1981
+JUMPV
+LABELV $2007
+ADDRLP4 20
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 856
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 856
+INDIRI4
+CNSTI4 0
+NEI4 $2009
+ADDRGP4 $1981
+JUMPV
+LABELV $2009
+ADDRLP4 860
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 860
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $2011
+ADDRLP4 864
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 864
+INDIRI4
+ADDRLP4 212
+ADDP4
+INDIRF4
+CVFI4 4
+CNSTI4 16
+LSHI4
+ADDRLP4 864
+INDIRI4
+ADDRLP4 200
+ADDP4
+INDIRF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+BORI4
+ASGNI4
+ADDRGP4 $2012
+JUMPV
+LABELV $2011
+ADDRLP4 868
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 868
+INDIRI4
+ADDRLP4 200
+ADDP4
+INDIRF4
+CVFI4 4
+CNSTI4 16
+LSHI4
+ADDRLP4 868
+INDIRI4
+ADDRLP4 212
+ADDP4
+INDIRF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+BORI4
+ASGNI4
+LABELV $2012
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 196
+INDIRI4
+CNSTI4 16
+LSHI4
+ADDRLP4 228
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 872
+CNSTI4 12
+ASGNI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 872
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 872
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 876
+CNSTI4 24
+ASGNI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 876
+INDIRI4
+ADDP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 876
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 19
+ASGNI4
+ADDRLP4 224
+INDIRI4
+ARGI4
+ADDRLP4 880
+ADDRGP4 AAS_TravelFlagsForTeam
+CALLI4
+ASGNI4
+ADDRLP4 884
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 884
+INDIRP4
+ADDRLP4 884
+INDIRP4
+INDIRI4
+ADDRLP4 880
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 892
+ADDRGP4 aassettings+136
+INDIRF4
+ASGNF4
+ADDRLP4 896
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 892
+INDIRF4
+ADDRLP4 896
+INDIRF4
+LTF4 $2015
+ADDRLP4 888
+ADDRLP4 892
+INDIRF4
+ADDRLP4 896
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2016
+JUMPV
+LABELV $2015
+ADDRLP4 888
+ADDRLP4 892
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2016
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 888
+INDIRU4
+CVUU2 4
+ASGNU2
+ADDRLP4 900
+ADDRGP4 reach_funcbob
+ASGNP4
+ADDRLP4 900
+INDIRP4
+ADDRLP4 900
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $1981
+ADDRLP4 20
+ADDRLP4 64
+INDIRP4
+ASGNP4
+LABELV $1983
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1980
+LABELV $1977
+ADDRLP4 0
+ADDRLP4 296
+INDIRP4
+ASGNP4
+LABELV $1979
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1976
+ADDRLP4 0
+ADDRLP4 424
+INDIRP4
+ASGNP4
+ADDRGP4 $2020
+JUMPV
+LABELV $2017
+ADDRLP4 296
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeReachability
+CALLV
+pop
+LABELV $2018
+ADDRLP4 0
+ADDRLP4 296
+INDIRP4
+ASGNP4
+LABELV $2020
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2017
+ADDRLP4 20
+ADDRLP4 300
+INDIRP4
+ASGNP4
+ADDRGP4 $2024
+JUMPV
+LABELV $2021
+ADDRLP4 64
+ADDRLP4 20
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeReachability
+CALLV
+pop
+LABELV $2022
+ADDRLP4 20
+ADDRLP4 64
+INDIRP4
+ASGNP4
+LABELV $2024
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2021
+ADDRLP4 820
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRLP4 824
+CNSTI4 0
+ASGNI4
+ADDRLP4 820
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 824
+INDIRI4
+NEI4 $2025
+ADDRLP4 820
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 824
+INDIRI4
+NEI4 $2025
+ADDRGP4 $1972
+JUMPV
+LABELV $2025
+LABELV $1971
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LTI4 $1970
+LABELV $1972
+LABELV $1845
+ADDRLP4 224
+INDIRI4
+ARGI4
+ADDRLP4 768
+ADDRGP4 AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 224
+ADDRLP4 768
+INDIRI4
+ASGNI4
+LABELV $1847
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $1844
+LABELV $1842
+endproc AAS_Reachability_FuncBobbing 904 32
+export AAS_Reachability_JumpPad
+proc AAS_Reachability_JumpPad 476 56
+ADDRGP4 $148
+ARGP4
+ADDRGP4 $149
+ARGP4
+ADDRLP4 372
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRLP4 216
+ADDRLP4 372
+INDIRF4
+CVFI4 4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 376
+ADDRGP4 AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 204
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 $2031
+JUMPV
+LABELV $2028
+ADDRLP4 204
+INDIRI4
+ARGI4
+ADDRGP4 $160
+ARGP4
+ADDRLP4 244
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 380
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 380
+INDIRI4
+CNSTI4 0
+NEI4 $2032
+ADDRGP4 $2029
+JUMPV
+LABELV $2032
+ADDRLP4 244
+ARGP4
+ADDRGP4 $163
+ARGP4
+ADDRLP4 384
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 384
+INDIRI4
+CNSTI4 0
+EQI4 $2034
+ADDRGP4 $2029
+JUMPV
+LABELV $2034
+ADDRLP4 204
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+ADDRLP4 220
+ARGP4
+ADDRLP4 232
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRLP4 388
+ADDRGP4 AAS_GetJumpPadInfo
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 0
+NEI4 $2036
+ADDRGP4 $2029
+JUMPV
+LABELV $2036
+ADDRLP4 220
+ARGP4
+ADDRLP4 232
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 392
+ADDRGP4 AAS_LinkEntityClientBBox
+CALLP4
+ASGNP4
+ADDRLP4 208
+ADDRLP4 392
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRGP4 $2041
+JUMPV
+LABELV $2038
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 396
+ADDRGP4 AAS_AreaJumpPad
+CALLI4
+ASGNI4
+ADDRLP4 396
+INDIRI4
+CNSTI4 0
+EQI4 $2042
+ADDRGP4 $2040
+JUMPV
+LABELV $2042
+LABELV $2039
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2041
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2038
+LABELV $2040
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2044
+CNSTI4 1
+ARGI4
+ADDRGP4 $175
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRLP4 208
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkFromAreas
+CALLV
+pop
+ADDRGP4 $2029
+JUMPV
+LABELV $2044
+CNSTI4 1
+ARGI4
+ADDRGP4 $2048
+ARGP4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 172+4
+INDIRF4
+ARGF4
+ADDRLP4 172+8
+INDIRF4
+ARGF4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRLP4 396
+CNSTF4 0
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ADDRLP4 396
+INDIRF4
+NEF4 $2054
+ADDRLP4 172+4
+INDIRF4
+ADDRLP4 396
+INDIRF4
+EQF4 $2051
+LABELV $2054
+ADDRLP4 400
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+ADDRLP4 400
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 400
+INDIRF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 104
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 404
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRLP4 168
+ADDRLP4 404
+INDIRI4
+ASGNI4
+LABELV $2057
+ADDRLP4 20
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 408
+CNSTI4 0
+ASGNI4
+ADDRLP4 408
+INDIRI4
+ARGI4
+ADDRLP4 172
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 408
+INDIRI4
+ARGI4
+CNSTI4 30
+ARGI4
+CNSTF4 1036831949
+ARGF4
+CNSTI4 445
+ARGI4
+ADDRLP4 408
+INDIRI4
+ARGI4
+ADDRLP4 216
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 AAS_PredictPlayerMovement
+CALLI4
+pop
+ADDRLP4 148
+ADDRLP4 20+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRGP4 $2065
+JUMPV
+LABELV $2062
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ADDRGP4 AAS_AreaJumpPad
+CALLI4
+ASGNI4
+ADDRLP4 412
+INDIRI4
+CNSTI4 0
+NEI4 $2066
+ADDRGP4 $2063
+JUMPV
+LABELV $2066
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 148
+INDIRI4
+NEI4 $2068
+ADDRGP4 $2064
+JUMPV
+LABELV $2068
+LABELV $2063
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2065
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2062
+LABELV $2064
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2070
+ADDRGP4 $2059
+JUMPV
+LABELV $2070
+ADDRLP4 136
+ADDRLP4 20
+INDIRB
+ASGNB 12
+ADDRLP4 172
+ADDRLP4 20+16
+INDIRB
+ASGNB 12
+LABELV $2058
+ADDRLP4 168
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 20
+LTI4 $2057
+LABELV $2059
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $2073
+ADDRLP4 168
+INDIRI4
+CNSTI4 20
+GEI4 $2073
+ADDRLP4 0
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRGP4 $2078
+JUMPV
+LABELV $2075
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 408
+ADDRGP4 AAS_AreaJumpPad
+CALLI4
+ASGNI4
+ADDRLP4 408
+INDIRI4
+CNSTI4 0
+NEI4 $2079
+ADDRGP4 $2076
+JUMPV
+LABELV $2079
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 412
+ADDRGP4 AAS_ReachabilityExists
+CALLI4
+ASGNI4
+ADDRLP4 412
+INDIRI4
+CNSTI4 0
+EQI4 $2081
+ADDRGP4 $2076
+JUMPV
+LABELV $2081
+ADDRLP4 416
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 416
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2083
+ADDRLP4 208
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkFromAreas
+CALLV
+pop
+ADDRGP4 $2027
+JUMPV
+LABELV $2083
+ADDRLP4 4
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 172+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 420
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 420
+INDIRF4
+ADDRLP4 420
+INDIRF4
+MULF4
+ADDRLP4 172+4
+INDIRF4
+ADDRLP4 172+4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 424
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 424
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 136
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 20
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 18
+ASGNI4
+ADDRLP4 204
+INDIRI4
+ARGI4
+ADDRLP4 428
+ADDRGP4 AAS_TravelFlagsForTeam
+CALLI4
+ASGNI4
+ADDRLP4 432
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 432
+INDIRP4
+ADDRLP4 432
+INDIRP4
+INDIRI4
+ADDRLP4 428
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 440
+ADDRGP4 aassettings+128
+INDIRF4
+ASGNF4
+ADDRLP4 444
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 440
+INDIRF4
+ADDRLP4 444
+INDIRF4
+LTF4 $2090
+ADDRLP4 436
+ADDRLP4 440
+INDIRF4
+ADDRLP4 444
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2091
+JUMPV
+LABELV $2090
+ADDRLP4 436
+ADDRLP4 440
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2091
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 436
+INDIRU4
+CVUU2 4
+ASGNU2
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 448
+ADDRGP4 reach_jumppad
+ASGNP4
+ADDRLP4 448
+INDIRP4
+ADDRLP4 448
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2076
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2078
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2075
+LABELV $2073
+LABELV $2051
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 400
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 400
+INDIRF4
+CNSTF4 1120403456
+GTF4 $2095
+ADDRLP4 172+4
+INDIRF4
+ARGF4
+ADDRLP4 404
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 404
+INDIRF4
+CNSTF4 1120403456
+LEF4 $2092
+LABELV $2095
+ADDRGP4 $2029
+JUMPV
+LABELV $2092
+ADDRLP4 148
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2099
+JUMPV
+LABELV $2096
+ADDRLP4 212
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRGP4 $2104
+JUMPV
+LABELV $2101
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 408
+ADDRGP4 AAS_ReachabilityExists
+CALLI4
+ASGNI4
+ADDRLP4 408
+INDIRI4
+CNSTI4 0
+EQI4 $2105
+ADDRGP4 $2103
+JUMPV
+LABELV $2105
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ADDRGP4 AAS_AreaJumpPad
+CALLI4
+ASGNI4
+ADDRLP4 412
+INDIRI4
+CNSTI4 0
+EQI4 $2107
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 148
+INDIRI4
+NEI4 $2109
+ADDRGP4 $2103
+JUMPV
+LABELV $2109
+LABELV $2107
+LABELV $2102
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2104
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2101
+LABELV $2103
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2111
+ADDRGP4 $2097
+JUMPV
+LABELV $2111
+ADDRLP4 188
+CNSTI4 48
+ADDRLP4 148
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 168
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2117
+JUMPV
+LABELV $2114
+ADDRLP4 184
+ADDRLP4 188
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 168
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ARGI4
+ADDRLP4 408
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 200
+CNSTI4 24
+ADDRLP4 408
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 412
+CNSTI4 4
+ASGNI4
+ADDRLP4 200
+INDIRP4
+ADDRLP4 412
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 412
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $2120
+ADDRGP4 $2115
+JUMPV
+LABELV $2120
+ADDRLP4 184
+INDIRI4
+ARGI4
+ADDRLP4 124
+ARGP4
+ADDRGP4 AAS_FaceCenter
+CALLV
+pop
+ADDRLP4 124+8
+INDIRF4
+ADDRLP4 136+8
+INDIRF4
+GEF4 $2122
+ADDRGP4 $2115
+JUMPV
+LABELV $2122
+ADDRLP4 196
+ADDRLP4 172+8
+INDIRF4
+ASGNF4
+ADDRLP4 196
+INDIRF4
+ARGF4
+ADDRLP4 136
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 416
+ADDRGP4 AAS_HorizontalVelocityForJump
+CALLI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $2127
+ADDRLP4 152
+INDIRF4
+CNSTF4 1125515264
+GEF4 $2127
+ADDRLP4 156
+ADDRLP4 124
+INDIRF4
+ADDRLP4 136
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156+4
+ADDRLP4 124+4
+INDIRF4
+ADDRLP4 136+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156+8
+ADDRLP4 124+8
+INDIRF4
+ADDRLP4 136+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 420
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 156
+INDIRF4
+ADDRLP4 420
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 156+4
+INDIRF4
+ADDRLP4 420
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 156+8
+INDIRF4
+ADDRLP4 152
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 136
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 172
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 424
+CNSTI4 30
+ASGNI4
+ADDRLP4 424
+INDIRI4
+ARGI4
+ADDRLP4 424
+INDIRI4
+ARGI4
+CNSTF4 1036831949
+ARGF4
+CNSTI4 1468
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 212
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 AAS_PredictPlayerMovement
+CALLI4
+pop
+ADDRLP4 20+100
+INDIRI4
+CNSTI4 30
+GEI4 $2140
+ADDRLP4 428
+CNSTI4 0
+ASGNI4
+ADDRLP4 20+88
+INDIRI4
+CNSTI4 56
+BANDI4
+ADDRLP4 428
+INDIRI4
+NEI4 $2140
+ADDRLP4 20+88
+INDIRI4
+CNSTI4 1408
+BANDI4
+ADDRLP4 428
+INDIRI4
+EQI4 $2140
+ADDRLP4 0
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRGP4 $2148
+JUMPV
+LABELV $2145
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 20+12
+INDIRI4
+NEI4 $2149
+ADDRGP4 $2147
+JUMPV
+LABELV $2149
+LABELV $2146
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2148
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2145
+LABELV $2147
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2152
+ADDRLP4 0
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRGP4 $2157
+JUMPV
+LABELV $2154
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 432
+ADDRGP4 AAS_AreaJumpPad
+CALLI4
+ASGNI4
+ADDRLP4 432
+INDIRI4
+CNSTI4 0
+NEI4 $2158
+ADDRGP4 $2155
+JUMPV
+LABELV $2158
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 436
+ADDRGP4 AAS_ReachabilityExists
+CALLI4
+ASGNI4
+ADDRLP4 436
+INDIRI4
+CNSTI4 0
+EQI4 $2160
+ADDRGP4 $2155
+JUMPV
+LABELV $2160
+ADDRLP4 440
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 440
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2162
+ADDRLP4 208
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkFromAreas
+CALLV
+pop
+ADDRGP4 $2027
+JUMPV
+LABELV $2162
+ADDRLP4 4
+INDIRP4
+ADDRLP4 20+12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 172+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 444
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 444
+INDIRF4
+ADDRLP4 444
+INDIRF4
+MULF4
+ADDRLP4 8+4
+INDIRF4
+ADDRLP4 8+4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 448
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 448
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 136
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 124
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 18
+ASGNI4
+ADDRLP4 204
+INDIRI4
+ARGI4
+ADDRLP4 452
+ADDRGP4 AAS_TravelFlagsForTeam
+CALLI4
+ASGNI4
+ADDRLP4 456
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 456
+INDIRP4
+ADDRLP4 456
+INDIRP4
+INDIRI4
+ADDRLP4 452
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 464
+ADDRGP4 aassettings+132
+INDIRF4
+ASGNF4
+ADDRLP4 468
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 464
+INDIRF4
+ADDRLP4 468
+INDIRF4
+LTF4 $2170
+ADDRLP4 460
+ADDRLP4 464
+INDIRF4
+ADDRLP4 468
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2171
+JUMPV
+LABELV $2170
+ADDRLP4 460
+ADDRLP4 464
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2171
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 460
+INDIRU4
+CVUU2 4
+ASGNU2
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 472
+ADDRGP4 reach_jumppad
+ASGNP4
+ADDRLP4 472
+INDIRP4
+ADDRLP4 472
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2155
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2157
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2154
+LABELV $2152
+LABELV $2140
+LABELV $2127
+LABELV $2115
+ADDRLP4 168
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2117
+ADDRLP4 168
+INDIRI4
+ADDRLP4 188
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $2114
+LABELV $2097
+ADDRLP4 148
+ADDRLP4 148
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2099
+ADDRLP4 148
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $2096
+ADDRLP4 208
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkFromAreas
+CALLV
+pop
+LABELV $2029
+ADDRLP4 204
+INDIRI4
+ARGI4
+ADDRLP4 380
+ADDRGP4 AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 204
+ADDRLP4 380
+INDIRI4
+ASGNI4
+LABELV $2031
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+NEI4 $2028
+LABELV $2027
+endproc AAS_Reachability_JumpPad 476 56
+lit
+align 4
+LABELV $2173
+byte 4 0
+byte 4 0
+byte 4 3212836864
+export AAS_GrappleFace
+code
+proc AAS_GrappleFace 108 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRGP4 $2173
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 24
+ADDRLP4 44
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2175
+CNSTI4 0
+RETI4
+ADDRGP4 $2172
+JUMPV
+LABELV $2175
+ADDRLP4 48
+CNSTI4 12
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 48
+INDIRI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 32
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 72
+CNSTI4 20
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 72
+INDIRI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 72
+INDIRI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+LEF4 $2182
+CNSTI4 0
+RETI4
+ADDRGP4 $2172
+JUMPV
+LABELV $2182
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FaceCenter
+CALLV
+pop
+ADDRLP4 76
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+GEF4 $2189
+CNSTI4 0
+RETI4
+ADDRGP4 $2172
+JUMPV
+LABELV $2189
+ADDRLP4 80
+CNSTI4 20
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDRLP4 80
+INDIRI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 20+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 80
+INDIRI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 20+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $2191
+CNSTI4 0
+RETI4
+ADDRGP4 $2172
+JUMPV
+LABELV $2191
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 92
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 0+8
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 100
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+NEF4 $2202
+CNSTI4 0
+RETI4
+ADDRGP4 $2172
+JUMPV
+LABELV $2202
+ADDRLP4 16
+INDIRF4
+CNSTF4 1157234688
+LEF4 $2204
+CNSTI4 0
+RETI4
+ADDRGP4 $2172
+JUMPV
+LABELV $2204
+ADDRLP4 36
+CNSTF4 1097859072
+ASGNF4
+CNSTF4 1086918619
+ADDRLP4 36
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+ARGF4
+ADDRLP4 104
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ADDRLP4 104
+INDIRF4
+GEF4 $2206
+CNSTI4 0
+RETI4
+ADDRGP4 $2172
+JUMPV
+LABELV $2206
+CNSTI4 1
+RETI4
+LABELV $2172
+endproc AAS_GrappleFace 108 8
+lit
+align 4
+LABELV $2209
+byte 4 0
+byte 4 0
+byte 4 0
+export AAS_Reachability_Grapple
+code
+proc AAS_Reachability_Grapple 408 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 172
+ADDRGP4 $2209
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 AAS_AreaGrounded
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+NEI4 $2210
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 AAS_AreaSwim
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+NEI4 $2210
+CNSTI4 0
+RETI4
+ADDRGP4 $2208
+JUMPV
+LABELV $2210
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 AAS_AreaPresenceType
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $2212
+CNSTI4 0
+RETI4
+ADDRGP4 $2208
+JUMPV
+LABELV $2212
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 308
+ADDRGP4 AAS_AreaSwim
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $2214
+CNSTI4 0
+RETI4
+ADDRGP4 $2208
+JUMPV
+LABELV $2214
+ADDRLP4 312
+CNSTI4 48
+ASGNI4
+ADDRLP4 292
+ADDRLP4 312
+INDIRI4
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 288
+ADDRLP4 312
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 288
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 292
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+GEF4 $2218
+CNSTI4 0
+RETI4
+ADDRGP4 $2208
+JUMPV
+LABELV $2218
+ADDRLP4 196
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 AAS_AreaSwim
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+NEI4 $2221
+ADDRLP4 196
+ARGP4
+ADDRLP4 324
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+NEI4 $2223
+ADDRGP4 $2225
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 196
+INDIRF4
+ARGF4
+ADDRLP4 196+4
+INDIRF4
+ARGF4
+ADDRLP4 196+8
+INDIRF4
+ARGF4
+ADDRGP4 Log_Write
+CALLV
+pop
+LABELV $2223
+ADDRLP4 184
+ADDRLP4 196
+INDIRB
+ASGNB 12
+ADDRLP4 184+8
+ADDRLP4 184+8
+INDIRF4
+CNSTF4 1148846080
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRLP4 184
+ARGP4
+CNSTI4 4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2229
+CNSTI4 0
+RETI4
+ADDRGP4 $2208
+JUMPV
+LABELV $2229
+ADDRLP4 172
+ADDRLP4 24+8
+INDIRB
+ASGNB 12
+ADDRGP4 $2222
+JUMPV
+LABELV $2221
+ADDRLP4 196
+ARGP4
+ADDRLP4 324
+ADDRGP4 AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $2232
+CNSTI4 0
+RETI4
+ADDRGP4 $2208
+JUMPV
+LABELV $2232
+LABELV $2222
+ADDRLP4 284
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2237
+JUMPV
+LABELV $2234
+ADDRLP4 276
+ADDRLP4 288
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 284
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+ARGI4
+ADDRLP4 324
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 280
+CNSTI4 24
+ADDRLP4 324
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 276
+INDIRI4
+ARGI4
+ADDRLP4 172
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRLP4 328
+ADDRGP4 AAS_GrappleFace
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+NEI4 $2240
+ADDRGP4 $2235
+JUMPV
+LABELV $2240
+ADDRLP4 196
+ADDRLP4 160
+INDIRB
+ASGNB 12
+ADDRLP4 332
+CNSTF4 3287941120
+ASGNF4
+ADDRLP4 336
+CNSTI4 20
+ASGNI4
+ADDRLP4 184
+ADDRLP4 160
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 336
+INDIRI4
+ADDRLP4 280
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 160+4
+INDIRF4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 336
+INDIRI4
+ADDRLP4 280
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 184+8
+ADDRLP4 160+8
+INDIRF4
+CNSTF4 3287941120
+CNSTI4 20
+ADDRLP4 280
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 208
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRLP4 344
+CNSTP4 0
+ASGNP4
+ADDRLP4 344
+INDIRP4
+ARGP4
+ADDRLP4 344
+INDIRP4
+ARGP4
+ADDRLP4 184
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 AAS_Trace
+CALLV
+pop
+ADDRLP4 208+48
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $2253
+CNSTF4 1140457472
+ADDRLP4 208+8
+INDIRF4
+MULF4
+CNSTF4 1107296256
+LEF4 $2249
+LABELV $2253
+ADDRGP4 $2235
+JUMPV
+LABELV $2249
+ADDRLP4 8
+ADDRLP4 160
+INDIRF4
+ADDRLP4 172
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 160+4
+INDIRF4
+ADDRLP4 172+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 160+8
+INDIRF4
+ADDRLP4 172+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 348
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 196
+ADDRLP4 172
+INDIRF4
+ADDRLP4 348
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 196+4
+ADDRLP4 172+4
+INDIRF4
+ADDRLP4 348
+INDIRF4
+ADDRLP4 8+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 196+8
+ADDRLP4 172+8
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 8+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 208+12
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRLP4 184
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 160
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 24+8+4
+INDIRF4
+ADDRLP4 160+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 24+8+8
+INDIRF4
+ADDRLP4 160+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 352
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 352
+INDIRF4
+CNSTF4 1103101952
+LEF4 $2276
+ADDRGP4 $2235
+JUMPV
+LABELV $2276
+ADDRLP4 196
+ADDRLP4 24+8
+INDIRB
+ASGNB 12
+ADDRLP4 184
+ADDRLP4 24+8
+INDIRB
+ASGNB 12
+ADDRLP4 356
+ADDRGP4 AAS_FallDamageDistance
+CALLI4
+ASGNI4
+ADDRLP4 184+8
+ADDRLP4 184+8
+INDIRF4
+ADDRLP4 356
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 196
+ARGP4
+ADDRLP4 184
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 24+4
+INDIRF4
+CNSTF4 1065353216
+LTF4 $2281
+ADDRGP4 $2235
+JUMPV
+LABELV $2281
+ADDRLP4 24+8
+ARGP4
+ADDRLP4 360
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 360
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 272
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 6
+BANDI4
+CNSTI4 0
+EQI4 $2285
+ADDRGP4 $2235
+JUMPV
+LABELV $2285
+ADDRLP4 272
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $2288
+ADDRGP4 $2235
+JUMPV
+LABELV $2288
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 364
+ADDRGP4 AAS_ReachabilityExists
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+EQI4 $2290
+ADDRGP4 $2235
+JUMPV
+LABELV $2290
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 368
+ADDRGP4 AAS_AreaGrounded
+CALLI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 0
+NEI4 $2292
+ADDRGP4 $2235
+JUMPV
+LABELV $2292
+ADDRLP4 172
+ARGP4
+ADDRLP4 208+12
+ARGP4
+ADDRLP4 80
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRLP4 372
+ADDRGP4 AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 20
+LTI4 $2295
+ADDRGP4 $2235
+JUMPV
+LABELV $2295
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2300
+JUMPV
+LABELV $2297
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 80
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $2301
+ADDRGP4 $2299
+JUMPV
+LABELV $2301
+LABELV $2298
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2300
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $2297
+LABELV $2299
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GEI4 $2304
+ADDRGP4 $2235
+JUMPV
+LABELV $2304
+ADDRLP4 376
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 376
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2306
+CNSTI4 0
+RETI4
+ADDRGP4 $2208
+JUMPV
+LABELV $2306
+ADDRLP4 4
+INDIRP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 172
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 208+12
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 14
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 392
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 396
+ADDRGP4 aassettings+108
+INDIRF4
+CNSTF4 1048576000
+ADDRLP4 392
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 400
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 396
+INDIRF4
+ADDRLP4 400
+INDIRF4
+LTF4 $2313
+ADDRLP4 388
+ADDRLP4 396
+INDIRF4
+ADDRLP4 400
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2314
+JUMPV
+LABELV $2313
+ADDRLP4 388
+ADDRLP4 396
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2314
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 388
+INDIRU4
+CVUU2 4
+ASGNU2
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 404
+ADDRGP4 reach_grapple
+ASGNP4
+ADDRLP4 404
+INDIRP4
+ADDRLP4 404
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2235
+ADDRLP4 284
+ADDRLP4 284
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2237
+ADDRLP4 284
+INDIRI4
+ADDRLP4 288
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $2234
+CNSTI4 0
+RETI4
+LABELV $2208
+endproc AAS_Reachability_Grapple 408 28
+lit
+align 4
+LABELV $2316
+byte 4 3245342720
+byte 4 3245342720
+byte 4 3245342720
+align 4
+LABELV $2317
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1097859072
+export AAS_SetWeaponJumpAreaFlags
+code
+proc AAS_SetWeaponJumpAreaFlags 256 24
+ADDRLP4 160
+ADDRGP4 $2316
+INDIRB
+ASGNB 12
+ADDRLP4 172
+ADDRGP4 $2317
+INDIRB
+ASGNB 12
+ADDRLP4 184
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRGP4 $2321
+JUMPV
+LABELV $2318
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 $160
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 192
+ADDRGP4 AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $2322
+ADDRGP4 $2319
+JUMPV
+LABELV $2322
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2326
+ARGP4
+ADDRLP4 196
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $2348
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2327
+ARGP4
+ADDRLP4 200
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $2348
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2328
+ARGP4
+ADDRLP4 204
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+EQI4 $2348
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2329
+ARGP4
+ADDRLP4 208
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $2348
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2330
+ARGP4
+ADDRLP4 212
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+EQI4 $2348
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2331
+ARGP4
+ADDRLP4 216
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+EQI4 $2348
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2332
+ARGP4
+ADDRLP4 220
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+EQI4 $2348
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2333
+ARGP4
+ADDRLP4 224
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+EQI4 $2348
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2334
+ARGP4
+ADDRLP4 228
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+EQI4 $2348
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2335
+ARGP4
+ADDRLP4 232
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+EQI4 $2348
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2336
+ARGP4
+ADDRLP4 236
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 0
+EQI4 $2348
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2337
+ARGP4
+ADDRLP4 240
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+NEI4 $2324
+LABELV $2348
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 $135
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 244
+ADDRGP4 AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+EQI4 $2349
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 $1890
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRGP4 AAS_IntForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 152
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2351
+ADDRLP4 136
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRLP4 172
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 248
+ADDRGP4 AAS_DropToFloor
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+NEI4 $2353
+CNSTI4 1
+ARGI4
+ADDRGP4 $2356
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRLP4 136+4
+INDIRF4
+ARGF4
+ADDRLP4 136+8
+INDIRF4
+ARGF4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $2353
+LABELV $2351
+ADDRLP4 136
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRLP4 248
+ADDRGP4 AAS_BestReachableArea
+CALLI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 252
+CNSTI4 28
+ADDRLP4 156
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 252
+INDIRP4
+ADDRLP4 252
+INDIRP4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+ADDRLP4 148
+ADDRLP4 148
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2349
+LABELV $2324
+LABELV $2319
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 192
+ADDRGP4 AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 192
+INDIRI4
+ASGNI4
+LABELV $2321
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $2318
+ADDRLP4 132
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2363
+JUMPV
+LABELV $2360
+CNSTI4 28
+ADDRLP4 132
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $2365
+ADDRLP4 196
+CNSTI4 28
+ADDRLP4 132
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ADDRLP4 196
+INDIRP4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+ADDRLP4 148
+ADDRLP4 148
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2365
+LABELV $2361
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2363
+ADDRLP4 132
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $2360
+CNSTI4 1
+ARGI4
+ADDRGP4 $2370
+ARGP4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $2315
+endproc AAS_SetWeaponJumpAreaFlags 256 24
+export AAS_Reachability_WeaponJump
+proc AAS_Reachability_WeaponJump 360 56
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 288
+ADDRGP4 AAS_AreaGrounded
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $2374
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 292
+ADDRGP4 AAS_AreaSwim
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $2372
+LABELV $2374
+CNSTI4 0
+RETI4
+ADDRGP4 $2371
+JUMPV
+LABELV $2372
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 AAS_AreaGrounded
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+NEI4 $2375
+CNSTI4 0
+RETI4
+ADDRGP4 $2371
+JUMPV
+LABELV $2375
+CNSTI4 28
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+NEI4 $2377
+CNSTI4 0
+RETI4
+ADDRGP4 $2371
+JUMPV
+LABELV $2377
+ADDRLP4 300
+CNSTI4 48
+ASGNI4
+ADDRLP4 284
+ADDRLP4 300
+INDIRI4
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 196
+ADDRLP4 300
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 284
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+GEF4 $2382
+CNSTI4 0
+RETI4
+ADDRGP4 $2371
+JUMPV
+LABELV $2382
+ADDRLP4 204
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 204
+ARGP4
+ADDRLP4 304
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+NEI4 $2385
+ADDRGP4 $2225
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 204
+INDIRF4
+ARGF4
+ADDRLP4 204+4
+INDIRF4
+ARGF4
+ADDRLP4 204+8
+INDIRF4
+ARGF4
+ADDRGP4 Log_Write
+CALLV
+pop
+LABELV $2385
+ADDRLP4 272
+ADDRLP4 204
+INDIRB
+ASGNB 12
+ADDRLP4 272+8
+ADDRLP4 272+8
+INDIRF4
+CNSTF4 1148846080
+SUBF4
+ASGNF4
+ADDRLP4 216
+ARGP4
+ADDRLP4 204
+ARGP4
+ADDRLP4 272
+ARGP4
+CNSTI4 4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+EQI4 $2390
+CNSTI4 0
+RETI4
+ADDRGP4 $2371
+JUMPV
+LABELV $2390
+ADDRLP4 0
+ADDRLP4 216+8
+INDIRB
+ASGNB 12
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2396
+JUMPV
+LABELV $2393
+ADDRLP4 192
+ADDRLP4 196
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 188
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+ARGI4
+ADDRLP4 308
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 200
+CNSTI4 24
+ADDRLP4 308
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 312
+CNSTI4 4
+ASGNI4
+ADDRLP4 200
+INDIRP4
+ADDRLP4 312
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 312
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $2399
+ADDRGP4 $2394
+JUMPV
+LABELV $2399
+ADDRLP4 192
+INDIRI4
+ARGI4
+ADDRLP4 32
+ARGP4
+ADDRGP4 AAS_FaceCenter
+CALLV
+pop
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+GEF4 $2401
+ADDRGP4 $2394
+JUMPV
+LABELV $2401
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $2405
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2409
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 316
+ADDRGP4 AAS_BFGJumpZVelocity
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 316
+INDIRF4
+ASGNF4
+ADDRGP4 $2410
+JUMPV
+LABELV $2409
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 320
+ADDRGP4 AAS_RocketJumpZVelocity
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 320
+INDIRF4
+ASGNF4
+LABELV $2410
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 324
+ADDRGP4 AAS_HorizontalVelocityForJump
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 324
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $2411
+ADDRLP4 12
+INDIRF4
+CNSTF4 1133903872
+GEF4 $2411
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 32+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 328
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 16
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 332
+CNSTF4 0
+ASGNF4
+ADDRLP4 68
+ADDRLP4 332
+INDIRF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 332
+INDIRF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 68
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 336
+CNSTI4 30
+ASGNI4
+ADDRLP4 336
+INDIRI4
+ARGI4
+ADDRLP4 336
+INDIRI4
+ARGI4
+CNSTF4 1036831949
+ARGF4
+CNSTI4 1213
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 184
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 AAS_PredictPlayerMovement
+CALLI4
+pop
+ADDRLP4 80+100
+INDIRI4
+CNSTI4 30
+GEI4 $2426
+ADDRLP4 340
+CNSTI4 0
+ASGNI4
+ADDRLP4 80+88
+INDIRI4
+CNSTI4 56
+BANDI4
+ADDRLP4 340
+INDIRI4
+NEI4 $2426
+ADDRLP4 80+88
+INDIRI4
+CNSTI4 1152
+BANDI4
+ADDRLP4 340
+INDIRI4
+EQI4 $2426
+ADDRLP4 344
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 344
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2431
+CNSTI4 0
+RETI4
+ADDRGP4 $2371
+JUMPV
+LABELV $2431
+ADDRLP4 44
+INDIRP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 44
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 32
+INDIRB
+ASGNB 12
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2433
+ADDRLP4 44
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 13
+ASGNI4
+ADDRLP4 352
+ADDRGP4 aassettings+124
+INDIRF4
+ASGNF4
+ADDRLP4 356
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 352
+INDIRF4
+ADDRLP4 356
+INDIRF4
+LTF4 $2437
+ADDRLP4 348
+ADDRLP4 352
+INDIRF4
+ADDRLP4 356
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2438
+JUMPV
+LABELV $2437
+ADDRLP4 348
+ADDRLP4 352
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2438
+ADDRLP4 44
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 348
+INDIRU4
+CVUU2 4
+ASGNU2
+ADDRGP4 $2434
+JUMPV
+LABELV $2433
+ADDRLP4 44
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRLP4 352
+ADDRGP4 aassettings+120
+INDIRF4
+ASGNF4
+ADDRLP4 356
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 352
+INDIRF4
+ADDRLP4 356
+INDIRF4
+LTF4 $2441
+ADDRLP4 348
+ADDRLP4 352
+INDIRF4
+ADDRLP4 356
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2442
+JUMPV
+LABELV $2441
+ADDRLP4 348
+ADDRLP4 352
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2442
+ADDRLP4 44
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 348
+INDIRU4
+CVUU2 4
+ASGNU2
+LABELV $2434
+ADDRLP4 44
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 348
+ADDRGP4 reach_rocketjump
+ASGNP4
+ADDRLP4 352
+CNSTI4 1
+ASGNI4
+ADDRLP4 348
+INDIRP4
+ADDRLP4 348
+INDIRP4
+INDIRI4
+ADDRLP4 352
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+RETI4
+ADDRGP4 $2371
+JUMPV
+LABELV $2426
+LABELV $2411
+LABELV $2406
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+LTI4 $2405
+LABELV $2394
+ADDRLP4 188
+ADDRLP4 188
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2396
+ADDRLP4 188
+INDIRI4
+ADDRLP4 196
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $2393
+CNSTI4 0
+RETI4
+LABELV $2371
+endproc AAS_Reachability_WeaponJump 360 56
+export AAS_Reachability_WalkOffLedge
+proc AAS_Reachability_WalkOffLedge 432 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 256
+ADDRGP4 AAS_AreaGrounded
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+EQI4 $2446
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ADDRGP4 AAS_AreaSwim
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+EQI4 $2444
+LABELV $2446
+ADDRGP4 $2443
+JUMPV
+LABELV $2444
+ADDRLP4 240
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 248
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2451
+JUMPV
+LABELV $2448
+ADDRLP4 252
+ADDRLP4 240
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 248
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 232
+CNSTI4 24
+ADDRLP4 264
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 268
+CNSTI4 4
+ASGNI4
+ADDRLP4 232
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 268
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $2454
+ADDRGP4 $2449
+JUMPV
+LABELV $2454
+ADDRLP4 244
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2459
+JUMPV
+LABELV $2456
+ADDRLP4 12
+ADDRLP4 232
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 244
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 236
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2464
+JUMPV
+LABELV $2461
+ADDRLP4 172
+ADDRLP4 240
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 236
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 272
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 164
+CNSTI4 24
+ADDRLP4 272
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 276
+CNSTI4 4
+ASGNI4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 276
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 276
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $2467
+ADDRGP4 $2462
+JUMPV
+LABELV $2467
+ADDRLP4 168
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2472
+JUMPV
+LABELV $2469
+ADDRLP4 188
+ADDRLP4 164
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 168
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 280
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRLP4 284
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+ADDRLP4 284
+INDIRI4
+NEI4 $2474
+ADDRLP4 164
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $2476
+ADDRLP4 216
+ADDRLP4 164
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2477
+JUMPV
+LABELV $2476
+ADDRLP4 216
+ADDRLP4 164
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2477
+ADDRLP4 92
+CNSTI4 48
+ADDRLP4 216
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+CNSTI4 28
+ADDRLP4 216
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2479
+ADDRLP4 292
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRGP4 $2485
+JUMPV
+LABELV $2482
+ADDRLP4 40
+ADDRLP4 92
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 300
+INDIRI4
+NEI4 $2487
+ADDRGP4 $2483
+JUMPV
+LABELV $2487
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 24
+ADDRLP4 304
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2493
+JUMPV
+LABELV $2490
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 308
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 312
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+ADDRLP4 312
+INDIRI4
+NEI4 $2495
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2497
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2492
+JUMPV
+LABELV $2497
+ADDRLP4 316
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 316
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 316
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $2499
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2492
+JUMPV
+LABELV $2499
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2492
+JUMPV
+LABELV $2495
+LABELV $2491
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2493
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $2490
+LABELV $2492
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+GEI4 $2501
+ADDRGP4 $2484
+JUMPV
+LABELV $2501
+LABELV $2483
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2485
+ADDRLP4 36
+INDIRI4
+ADDRLP4 92
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $2482
+LABELV $2484
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $2503
+ADDRGP4 $2471
+JUMPV
+LABELV $2503
+LABELV $2479
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 224
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $2507
+ADDRLP4 292
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2508
+JUMPV
+LABELV $2507
+ADDRLP4 292
+CNSTI4 0
+ASGNI4
+LABELV $2508
+ADDRLP4 220
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 304
+CNSTI4 12
+ASGNI4
+ADDRLP4 156
+ADDRLP4 304
+INDIRI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 224
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+NEI4 $2512
+ADDRLP4 296
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2513
+JUMPV
+LABELV $2512
+ADDRLP4 296
+CNSTI4 0
+ASGNI4
+LABELV $2513
+ADDRLP4 160
+ADDRLP4 304
+INDIRI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 224
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 228
+CNSTI4 20
+ADDRLP4 232
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 192
+ADDRLP4 160
+INDIRP4
+INDIRF4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 320
+CNSTI4 4
+ASGNI4
+ADDRLP4 192+4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 320
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 324
+CNSTI4 8
+ASGNI4
+ADDRLP4 192+8
+ADDRLP4 160
+INDIRP4
+ADDRLP4 324
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 324
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 176
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 24
+ADDRLP4 156
+INDIRP4
+INDIRF4
+ADDRLP4 160
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 336
+CNSTI4 4
+ASGNI4
+ADDRLP4 24+4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 336
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 336
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 340
+CNSTI4 8
+ASGNI4
+ADDRLP4 24+8
+ADDRLP4 156
+INDIRP4
+ADDRLP4 340
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 340
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 344
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 24
+ADDRLP4 344
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 344
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 1056964608
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 348
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 348
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 348
+INDIRF4
+ADDRLP4 176+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1090519040
+ADDRLP4 176+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 204
+ADDRLP4 24
+INDIRB
+ASGNB 12
+ADDRLP4 204+8
+ADDRLP4 204+8
+INDIRF4
+CNSTF4 1148846080
+SUBF4
+ASGNF4
+ADDRLP4 100
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 204
+ARGP4
+CNSTI4 4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $2530
+ADDRGP4 $2471
+JUMPV
+LABELV $2530
+ADDRLP4 100+8
+ARGP4
+ADDRLP4 352
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $2533
+ADDRGP4 $2471
+JUMPV
+LABELV $2533
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 356
+ADDRGP4 AAS_ReachabilityExists
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $2535
+ADDRGP4 $2471
+JUMPV
+LABELV $2535
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 360
+ADDRGP4 AAS_AreaGrounded
+CALLI4
+ASGNI4
+ADDRLP4 360
+INDIRI4
+CNSTI4 0
+NEI4 $2537
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 364
+ADDRGP4 AAS_AreaSwim
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+NEI4 $2537
+ADDRGP4 $2471
+JUMPV
+LABELV $2537
+CNSTI4 28
+ADDRLP4 96
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 6
+BANDI4
+CNSTI4 0
+EQI4 $2539
+ADDRGP4 $2471
+JUMPV
+LABELV $2539
+ADDRLP4 24
+ARGP4
+ADDRLP4 204
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 368
+ADDRGP4 AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 84
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2545
+JUMPV
+LABELV $2542
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 372
+ADDRGP4 AAS_AreaClusterPortal
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 0
+EQI4 $2546
+ADDRGP4 $2544
+JUMPV
+LABELV $2546
+LABELV $2543
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2545
+ADDRLP4 20
+INDIRI4
+ADDRLP4 84
+INDIRI4
+LTI4 $2542
+LABELV $2544
+ADDRLP4 20
+INDIRI4
+ADDRLP4 84
+INDIRI4
+GEI4 $2548
+ADDRGP4 $2471
+JUMPV
+LABELV $2548
+ADDRGP4 aassettings+152
+INDIRF4
+CNSTF4 0
+EQF4 $2550
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 100+8+8
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 376
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 376
+INDIRF4
+ADDRGP4 aassettings+152
+INDIRF4
+LEF4 $2550
+ADDRGP4 $2471
+JUMPV
+LABELV $2550
+ADDRLP4 380
+ADDRGP4 AAS_AllocReachability
+CALLP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 380
+INDIRP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2557
+ADDRGP4 $2471
+JUMPV
+LABELV $2557
+ADDRLP4 88
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 24
+INDIRB
+ASGNB 12
+ADDRLP4 88
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 100+8
+INDIRB
+ASGNB 12
+ADDRLP4 88
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 100+8+8
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 388
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 392
+ADDRGP4 aassettings+112
+INDIRF4
+CNSTF4 1112014848
+ADDRLP4 388
+INDIRF4
+MULF4
+ADDRGP4 aassettings+20
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+ADDRLP4 396
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 392
+INDIRF4
+ADDRLP4 396
+INDIRF4
+LTF4 $2566
+ADDRLP4 384
+ADDRLP4 392
+INDIRF4
+ADDRLP4 396
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2567
+JUMPV
+LABELV $2566
+ADDRLP4 384
+ADDRLP4 392
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2567
+ADDRLP4 88
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 384
+INDIRU4
+CVUU2 4
+ASGNU2
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 400
+ADDRGP4 AAS_AreaSwim
+CALLI4
+ASGNI4
+ADDRLP4 400
+INDIRI4
+CNSTI4 0
+NEI4 $2568
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 404
+ADDRGP4 AAS_AreaJumpPad
+CALLI4
+ASGNI4
+ADDRLP4 404
+INDIRI4
+CNSTI4 0
+NEI4 $2568
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 100+8+8
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 408
+ADDRGP4 AAS_FallDelta
+CALLF4
+ASGNF4
+ADDRLP4 408
+INDIRF4
+ADDRGP4 aassettings+80
+INDIRF4
+LEF4 $2570
+ADDRLP4 416
+ADDRLP4 88
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 420
+ADDRLP4 416
+INDIRP4
+INDIRU2
+CVUI4 2
+CVIF4 4
+ADDRGP4 aassettings+144
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 424
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 420
+INDIRF4
+ADDRLP4 424
+INDIRF4
+LTF4 $2578
+ADDRLP4 412
+ADDRLP4 420
+INDIRF4
+ADDRLP4 424
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2579
+JUMPV
+LABELV $2578
+ADDRLP4 412
+ADDRLP4 420
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2579
+ADDRLP4 416
+INDIRP4
+ADDRLP4 412
+INDIRU4
+CVUU2 4
+ASGNU2
+ADDRGP4 $2571
+JUMPV
+LABELV $2570
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 100+8+8
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 412
+ADDRGP4 AAS_FallDelta
+CALLF4
+ASGNF4
+ADDRLP4 412
+INDIRF4
+ADDRGP4 aassettings+84
+INDIRF4
+LEF4 $2580
+ADDRLP4 420
+ADDRLP4 88
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 424
+ADDRLP4 420
+INDIRP4
+INDIRU2
+CVUI4 2
+CVIF4 4
+ADDRGP4 aassettings+148
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 428
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 424
+INDIRF4
+ADDRLP4 428
+INDIRF4
+LTF4 $2588
+ADDRLP4 416
+ADDRLP4 424
+INDIRF4
+ADDRLP4 428
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $2589
+JUMPV
+LABELV $2588
+ADDRLP4 416
+ADDRLP4 424
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $2589
+ADDRLP4 420
+INDIRP4
+ADDRLP4 416
+INDIRU4
+CVUU2 4
+ASGNU2
+LABELV $2580
+LABELV $2571
+LABELV $2568
+ADDRLP4 88
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 408
+ADDRGP4 reach_walkoffledge
+ASGNP4
+ADDRLP4 408
+INDIRP4
+ADDRLP4 408
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2474
+LABELV $2470
+ADDRLP4 168
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2472
+ADDRLP4 168
+INDIRI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $2469
+LABELV $2471
+LABELV $2462
+ADDRLP4 236
+ADDRLP4 236
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2464
+ADDRLP4 236
+INDIRI4
+ADDRLP4 240
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $2461
+LABELV $2457
+ADDRLP4 244
+ADDRLP4 244
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2459
+ADDRLP4 244
+INDIRI4
+ADDRLP4 232
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $2456
+LABELV $2449
+ADDRLP4 248
+ADDRLP4 248
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2451
+ADDRLP4 248
+INDIRI4
+ADDRLP4 240
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $2448
+LABELV $2443
+endproc AAS_Reachability_WalkOffLedge 432 24
+export AAS_StoreReachability
+proc AAS_StoreReachability 52 4
+ADDRGP4 aasworld+236
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+CNSTU4 44
+ADDRGP4 numlreachabilities
+INDIRI4
+CNSTI4 10
+ADDI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRLP4 16
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+236
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+232
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2597
+JUMPV
+LABELV $2594
+ADDRLP4 8
+CNSTI4 28
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 aasworld+232
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 areareachability
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2604
+JUMPV
+LABELV $2601
+ADDRLP4 4
+CNSTI4 44
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 12
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 36
+CNSTI4 24
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+CNSTI4 36
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 40
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRU2
+ASGNU2
+ADDRLP4 48
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2602
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2604
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2601
+ADDRLP4 20
+ADDRGP4 aasworld+232
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $2595
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2597
+ADDRLP4 12
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $2594
+LABELV $2590
+endproc AAS_StoreReachability 52 4
+export AAS_AreaReachabilities
+proc AAS_AreaReachabilities 76 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $2608
+ADDRGP4 $2607
+JUMPV
+LABELV $2608
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2614
+JUMPV
+LABELV $2611
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $2616
+ADDRGP4 $2612
+JUMPV
+LABELV $2616
+ADDRLP4 16
+CNSTU4 0
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+EQU4 $2618
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+RSHI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+INDIRP4
+ADDP4
+INDIRU4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+CNSTI4 31
+BANDI4
+LSHI4
+CVIU4 4
+BANDU4
+ADDRLP4 16
+INDIRU4
+NEU4 $2618
+ADDRGP4 $2612
+JUMPV
+LABELV $2618
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 192
+BANDI4
+CNSTI4 0
+EQI4 $2620
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 192
+BANDI4
+CNSTI4 0
+NEI4 $2623
+ADDRGP4 $2612
+JUMPV
+LABELV $2623
+LABELV $2620
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 AAS_ReachabilityExists
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2626
+ADDRGP4 $2612
+JUMPV
+LABELV $2626
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 AAS_Reachability_Swim
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2628
+ADDRGP4 $2612
+JUMPV
+LABELV $2628
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 AAS_Reachability_EqualFloorHeight
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $2630
+ADDRGP4 $2612
+JUMPV
+LABELV $2630
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 AAS_Reachability_Step_Barrier_WaterJump_WalkOffLedge
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $2632
+ADDRGP4 $2612
+JUMPV
+LABELV $2632
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 AAS_Reachability_Ladder
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $2634
+ADDRGP4 $2612
+JUMPV
+LABELV $2634
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2638
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $2642
+LABELV $2638
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 AAS_Reachability_Jump
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $2637
+ADDRGP4 $2612
+JUMPV
+LABELV $2641
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2642
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+GEI4 $2644
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $2641
+LABELV $2644
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+GEI4 $2647
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $2645
+LABELV $2647
+ADDRGP4 $2612
+JUMPV
+LABELV $2645
+ADDRLP4 64
+CNSTI4 8
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 AAS_Reachability_JumpEdgePoints
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $2648
+LABELV $2648
+LABELV $2637
+LABELV $2612
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2614
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $2611
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 192
+BANDI4
+CNSTI4 0
+EQI4 $2650
+ADDRGP4 $2607
+JUMPV
+LABELV $2650
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2656
+JUMPV
+LABELV $2653
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $2658
+ADDRGP4 $2654
+JUMPV
+LABELV $2658
+ADDRLP4 16
+CNSTU4 0
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+EQU4 $2660
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+RSHI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+INDIRU4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+CNSTI4 31
+BANDI4
+LSHI4
+CVIU4 4
+BANDU4
+ADDRLP4 16
+INDIRU4
+NEU4 $2660
+ADDRGP4 $2654
+JUMPV
+LABELV $2660
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 AAS_ReachabilityExists
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2662
+ADDRGP4 $2654
+JUMPV
+LABELV $2662
+ADDRGP4 calcgrapplereach
+INDIRI4
+CNSTI4 0
+EQI4 $2664
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 AAS_Reachability_Grapple
+CALLI4
+pop
+LABELV $2664
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 AAS_Reachability_WeaponJump
+CALLI4
+pop
+LABELV $2654
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2656
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $2653
+LABELV $2607
+endproc AAS_AreaReachabilities 76 20
+bss
+align 4
+LABELV $2667
+skip 4
+align 4
+LABELV $2668
+skip 4
+align 4
+LABELV $2669
+skip 4
+export AAS_ContinueInitReachability
+code
+proc AAS_ContinueInitReachability 24 12
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $2670
+CNSTI4 0
+RETI4
+ADDRGP4 $2666
+JUMPV
+LABELV $2670
+ADDRGP4 aasworld+280
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+CNSTI4 2
+ADDI4
+LTI4 $2672
+CNSTI4 0
+RETI4
+ADDRGP4 $2666
+JUMPV
+LABELV $2672
+ADDRGP4 aasworld+280
+INDIRI4
+CNSTI4 1
+NEI4 $2676
+CNSTI4 1
+ARGI4
+ADDRGP4 $2680
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $2669
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2667
+CNSTF4 1157234688
+ASGNF4
+ADDRGP4 $2668
+CNSTF4 1148846080
+ASGNF4
+LABELV $2676
+ADDRLP4 4
+ADDRGP4 aasworld+280
+INDIRI4
+ADDRGP4 $2667
+INDIRF4
+CVFI4 4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 botimport
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 aasworld+280
+INDIRI4
+ASGNI4
+ADDRGP4 $2685
+JUMPV
+LABELV $2682
+ADDRLP4 16
+ADDRGP4 aasworld+280
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 AAS_AreaReachabilities
+CALLV
+pop
+ADDRLP4 20
+ADDRGP4 botimport
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ADDRGP4 $2668
+INDIRF4
+CVFI4 4
+LEI4 $2689
+ADDRGP4 $2684
+JUMPV
+LABELV $2689
+CNSTI4 1000
+ADDRGP4 aasworld+280
+INDIRI4
+MULI4
+ADDRGP4 aasworld+216
+INDIRI4
+DIVI4
+ADDRGP4 $2669
+INDIRI4
+LEI4 $2691
+ADDRGP4 $2684
+JUMPV
+LABELV $2691
+LABELV $2683
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2685
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+GEI4 $2695
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $2682
+LABELV $2695
+LABELV $2684
+ADDRGP4 aasworld+280
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+NEI4 $2696
+CNSTI4 1
+ARGI4
+ADDRGP4 $2701
+ARGP4
+CNSTF4 1120403456
+ARGF4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $2703
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRLP4 12
+ADDRGP4 aasworld+280
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2697
+JUMPV
+LABELV $2696
+ADDRGP4 aasworld+280
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+CNSTI4 1
+ADDI4
+NEI4 $2705
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2712
+JUMPV
+LABELV $2709
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $2714
+ADDRGP4 $2710
+JUMPV
+LABELV $2714
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 AAS_Reachability_WalkOffLedge
+CALLV
+pop
+LABELV $2710
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2712
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $2709
+ADDRGP4 AAS_Reachability_JumpPad
+CALLV
+pop
+ADDRGP4 AAS_Reachability_Teleport
+CALLV
+pop
+ADDRGP4 AAS_Reachability_Elevator
+CALLV
+pop
+ADDRGP4 AAS_Reachability_FuncBobbing
+CALLV
+pop
+ADDRGP4 AAS_StoreReachability
+CALLV
+pop
+ADDRGP4 AAS_ShutDownReachabilityHeap
+CALLV
+pop
+ADDRGP4 areareachability
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+ADDRLP4 12
+ADDRGP4 aasworld+280
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRGP4 $2719
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $2706
+JUMPV
+LABELV $2705
+ADDRLP4 12
+ADDRGP4 $2669
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 1000
+ADDRGP4 aasworld+280
+INDIRI4
+MULI4
+ADDRGP4 aasworld+216
+INDIRI4
+DIVI4
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRGP4 $2701
+ARGP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+CNSTF4 1092616192
+DIVF4
+ARGF4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $2706
+LABELV $2697
+CNSTI4 1
+RETI4
+LABELV $2666
+endproc AAS_ContinueInitReachability 24 12
+export AAS_InitReachability
+proc AAS_InitReachability 12 8
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $2724
+ADDRGP4 $2723
+JUMPV
+LABELV $2724
+ADDRGP4 aasworld+232
+INDIRI4
+CNSTI4 0
+EQI4 $2726
+ADDRGP4 $2731
+ARGP4
+ADDRLP4 0
+ADDRGP4 LibVarGetValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+CNSTI4 0
+NEI4 $2729
+ADDRGP4 aasworld+280
+ADDRGP4 aasworld+216
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $2723
+JUMPV
+LABELV $2729
+LABELV $2726
+ADDRGP4 $2734
+ARGP4
+ADDRLP4 0
+ADDRGP4 LibVarGetValue
+CALLF4
+ASGNF4
+ADDRGP4 calcgrapplereach
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $2735
+ARGP4
+ADDRGP4 $149
+ARGP4
+ADDRLP4 4
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 reachabilitythreads
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 aasworld+8
+CNSTI4 1
+ASGNI4
+ADDRGP4 aasworld+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 AAS_SetupReachabilityHeap
+CALLV
+pop
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ARGU4
+ADDRLP4 8
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRGP4 areareachability
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 AAS_SetWeaponJumpAreaFlags
+CALLV
+pop
+LABELV $2723
+endproc AAS_InitReachability 12 8
+bss
+export numlreachabilities
+align 4
+LABELV numlreachabilities
+skip 4
+export areareachability
+align 4
+LABELV areareachability
+skip 4
+export nextreachability
+align 4
+LABELV nextreachability
+skip 4
+export reachabilityheap
+align 4
+LABELV reachabilityheap
+skip 4
+export reachabilitythreads
+align 4
+LABELV reachabilitythreads
+skip 4
+export calcgrapplereach
+align 4
+LABELV calcgrapplereach
+skip 4
+export reach_jumppad
+align 4
+LABELV reach_jumppad
+skip 4
+export reach_bfgjump
+align 4
+LABELV reach_bfgjump
+skip 4
+export reach_rocketjump
+align 4
+LABELV reach_rocketjump
+skip 4
+export reach_strafejump
+align 4
+LABELV reach_strafejump
+skip 4
+export reach_rampjump
+align 4
+LABELV reach_rampjump
+skip 4
+export reach_doublejump
+align 4
+LABELV reach_doublejump
+skip 4
+export reach_grapple
+align 4
+LABELV reach_grapple
+skip 4
+export reach_funcbob
+align 4
+LABELV reach_funcbob
+skip 4
+export reach_elevator
+align 4
+LABELV reach_elevator
+skip 4
+export reach_teleport
+align 4
+LABELV reach_teleport
+skip 4
+export reach_ladder
+align 4
+LABELV reach_ladder
+skip 4
+export reach_jump
+align 4
+LABELV reach_jump
+skip 4
+export reach_walkoffledge
+align 4
+LABELV reach_walkoffledge
+skip 4
+export reach_waterjump
+align 4
+LABELV reach_waterjump
+skip 4
+export reach_barrier
+align 4
+LABELV reach_barrier
+skip 4
+export reach_walk
+align 4
+LABELV reach_walk
+skip 4
+export reach_step
+align 4
+LABELV reach_step
+skip 4
+export reach_equalfloor
+align 4
+LABELV reach_equalfloor
+skip 4
+export reach_swim
+align 4
+LABELV reach_swim
+skip 4
+import aassettings
+import AAS_PrintFreeBSPLinks
+import AAS_EntityCollision
+import AAS_BSPLinkEntity
+import AAS_UnlinkFromBSPLeaves
+import AAS_DumpBSPData
+import AAS_LoadBSPFile
+import AAS_FileInfo
+import AAS_DumpAASData
+import AAS_FreeAASLump
+import AAS_WriteCompactAASFile
+import AAS_WriteAASFile
+import AAS_LoadCompactAASFile
+import AAS_LoadAASFile
+import AAS_ShutdownAlternativeRouting
+import AAS_InitAlternativeRouting
+import AAS_RoutingCacheInfo
+import AAS_RoutingInfo
+import AAS_ReadRouteTables
+import AAS_WriteRouteTables
+import AAS_WriteRouteCache
+import AAS_CreateAllRoutingCache
+import AAS_FreeRoutingCaches
+import AAS_InitRouting
+import AAS_SetViewPortalsAsClusterPortals
+import AAS_InitClustering
+import AAS_SampleBenchmark
+import AAS_FreeFlatNodes
+import AAS_InitFlatNodes
+import AAS_FreeReachabilityAreaGrid
+import AAS_InitReachabilityAreaGrid
+import AAS_UnlinkFromAreas
+import AAS_InsideFace
+import AAS_PointInsideFace
+import AAS_LinkEntityClientBBox
+import AAS_AASLinkEntity
+import AAS_PlaneFromNum
+import AAS_TraceEndFace
+import AAS_AreaGroundFace
+import AAS_FreeAASLinkedEntities
+import AAS_FreeAASLinkHeap
+import AAS_InitAASLinkedEntities
+import AAS_InitAASLinkHeap
+import AAS_UpdateEntities
+import AAS_UpdateEntity
+import AAS_ResetEntityLinks
+import AAS_UnlinkInvalidEntities
+import AAS_InvalidateEntities
+import AAS_StartFrame
+import AAS_LoadMap
+import AAS_Shutdown
+import AAS_Setup
+import AAS_SetInitialized
+import AAS_Error
+import aasworld
+import botDeveloper
+import botimport
+import botlibglobals
+import AAS_InitSettings
+import AAS_DropToFloor
+import AAS_SetMovedir
+import AAS_HorizontalVelocityForJump
+import AAS_BFGJumpZVelocity
+import AAS_RocketJumpZVelocity
+import AAS_AgainstLadder
+import AAS_JumpReachRunStart
+import AAS_Swimming
+import AAS_OnGround
+import AAS_PlayerMovementHitBBox
+import AAS_PredictPlayerMovement
+import AAS_IntForBSPEpairKey
+import AAS_FloatForBSPEpairKey
+import AAS_VectorForBSPEpairKey
+import AAS_ValueForBSPEpairKey
+import AAS_NextBSPEntity
+import AAS_BSPModelMinsMaxsOrigin
+import AAS_BoxEntities
+import AAS_AreasConnected
+import AAS_inPHS
+import AAS_inPVS
+import AAS_PointContents
+import AAS_Trace
+import AAS_Optimize
+import AAS_FloodAreas
+import AAS_ShowReachableAreas
+import AAS_ShowReachability
+import AAS_DrawArrow
+import AAS_PrintTravelType
+import AAS_DrawCross
+import AAS_ShowAreaPolygons
+import AAS_ShowArea
+import AAS_ShowFace
+import AAS_ShowBoundingBox
+import AAS_DrawPlaneCross
+import AAS_DrawPermanentCross
+import AAS_PermanentLine
+import AAS_DebugLine
+import AAS_ClearShownPolygons
+import AAS_ClearShownDebugLines
+import AAS_AlternativeRouteGoals
+import AAS_PredictRoute
+import AAS_AreaTravelTimeToGoalArea
+import AAS_AreaTravelTime
+import AAS_EnableRoutingArea
+import AAS_RandomGoalArea
+import AAS_ReachabilityFromNum
+import AAS_NextAreaReachability
+import AAS_AreaContentsTravelFlags
+import AAS_TravelFlagForType
+import AAS_NextModelReachability
+import AAS_FacePlane
+import AAS_PointReachabilityAreaIndex
+import AAS_PointAreaNum
+import AAS_AreaInfo
+import AAS_PointInsideArea
+import AAS_BBoxReachabilityAreas
+import AAS_BBoxAreas
+import AAS_TraceAreas
+import AAS_TracePlayerBBox
+import AAS_PointPresenceType
+import AAS_AreaPresenceType
+import AAS_AreaCluster
+import AAS_PresenceTypeBoundingBox
+import AAS_ProjectPointOntoVector
+import AAS_Time
+import AAS_Loaded
+import AAS_Initialized
+import GetBotLibAPI
+import LibVarSetNotModified
+import LibVarChanged
+import LibVarSet
+import LibVarString
+import LibVarValue
+import LibVar
+import LibVarGetValue
+import LibVarGetString
+import LibVarGet
+import LibVarDeAllocAll
+import DumpMemory
+import MemoryByteSize
+import PrintMemoryLabels
+import PrintUsedMemorySize
+import AvailableMemory
+import FreeMemory
+import GetClearedHunkMemory
+import GetHunkMemory
+import GetClearedMemory
+import GetMemory
+import Log_Flush
+import Log_FileHandle
+import Log_WriteTimeStamped
+import Log_Write
+import Log_Shutdown
+import Log_Close
+import Log_Open
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $2735
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $2734
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $2731
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $2719
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $2703
+byte 1 10
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $2701
+byte 1 13
+byte 1 37
+byte 1 54
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 37
+byte 1 37
+byte 1 0
+align 1
+LABELV $2680
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $2370
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2356
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $2337
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $2336
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $2335
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $2334
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $2333
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $2332
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $2331
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $2330
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2329
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2328
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2327
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2326
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $2225
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 63
+byte 1 13
+byte 1 10
+byte 1 0
+align 1
+LABELV $2048
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1984
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1895
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 123
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 125
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 123
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 125
+byte 1 10
+byte 1 0
+align 1
+LABELV $1890
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $1863
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 98
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $1858
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 98
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $1852
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 98
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1575
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1572
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $1571
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $1566
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $1562
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $1539
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 10
+byte 1 0
+align 1
+LABELV $1513
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1496
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1495
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1488
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $1484
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $1470
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1463
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $1461
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $1458
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1448
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1437
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1430
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $1428
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1414
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $248
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $241
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 66
+byte 1 73
+byte 1 76
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 83
+byte 1 73
+byte 1 90
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $193
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 66
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $175
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 10
+byte 1 0
+align 1
+LABELV $163
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $160
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $149
+byte 1 48
+byte 1 0
+align 1
+LABELV $148
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $142
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $135
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $134
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $128
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $121
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $119
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $96
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
@@ -0,0 +1,16913 @@
+export AAS_RoutingInfo
+code
+proc AAS_RoutingInfo 12 16
+CNSTI4 1
+ARGI4
+ADDRGP4 $27
+ARGP4
+ADDRGP4 numareacacheupdates
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $29
+ARGP4
+ADDRGP4 numareacacherelaxations
+INDIRI4
+ARGI4
+ADDRGP4 numareacacheupdates
+INDIRI4
+CNSTI4 0
+EQI4 $31
+ADDRLP4 0
+ADDRGP4 numareacacherelaxations
+INDIRI4
+CVIF4 4
+ADDRGP4 numareacacheupdates
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRGP4 $32
+JUMPV
+LABELV $31
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $32
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $34
+ARGP4
+ADDRGP4 numportalcacheupdates
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $36
+ARGP4
+ADDRGP4 numportalcacherelaxations
+INDIRI4
+ARGI4
+ADDRGP4 numportalcacheupdates
+INDIRI4
+CNSTI4 0
+EQI4 $38
+ADDRLP4 4
+ADDRGP4 numportalcacherelaxations
+INDIRI4
+CVIF4 4
+ADDRGP4 numportalcacheupdates
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRGP4 $39
+JUMPV
+LABELV $38
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+LABELV $39
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $41
+ARGP4
+ADDRGP4 routingqueuesorted
+INDIRI4
+CNSTI4 0
+EQI4 $45
+ADDRLP4 8
+ADDRGP4 $42
+ASGNP4
+ADDRGP4 $46
+JUMPV
+LABELV $45
+ADDRLP4 8
+ADDRGP4 $43
+ASGNP4
+LABELV $46
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $48
+ARGP4
+ADDRGP4 routingcachesize
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $25
+endproc AAS_RoutingInfo 12 16
+export AAS_RoutingCacheInfo
+proc AAS_RoutingCacheInfo 36 20
+ADDRLP4 16
+ADDRGP4 routingcachehits
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ADDRGP4 routingcachemisses
+INDIRI4
+ADDI4
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRGP4 $51
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $53
+ADDRLP4 12
+CNSTI4 100
+ADDRGP4 routingcachehits
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $54
+JUMPV
+LABELV $53
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $54
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $56
+ARGP4
+ADDRGP4 routingcachemisses
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $58
+ARGP4
+ADDRGP4 routingcacheevictions
+INDIRI4
+ARGI4
+ADDRGP4 routingcacheevictedbytes
+INDIRI4
+CNSTI4 10
+RSHI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $60
+ARGP4
+ADDRLP4 20
+CNSTI4 10
+ASGNI4
+ADDRGP4 routingcachesize
+INDIRI4
+ADDRLP4 20
+INDIRI4
+RSHI4
+ARGI4
+ADDRGP4 max_routingcachesize
+INDIRI4
+ADDRLP4 20
+INDIRI4
+RSHI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $62
+ARGP4
+ADDRGP4 routingcacheslabsize
+INDIRI4
+CNSTI4 10
+RSHI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $63
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 routingcacheclasses
+ADDP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $67
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $67
+ADDRGP4 $64
+JUMPV
+LABELV $67
+CNSTI4 1
+ARGI4
+ADDRGP4 $70
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $64
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 104
+LTI4 $63
+LABELV $49
+endproc AAS_RoutingCacheInfo 36 20
+proc AAS_RoutingCacheClass 16 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $72
+ADDRFP4 0
+CNSTI4 64
+ASGNI4
+LABELV $72
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $75
+JUMPV
+LABELV $74
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $75
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+RSHI4
+CNSTI4 0
+NEI4 $74
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+SUBI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+RSHI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 24
+SUBI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+CNSTI4 5
+SUBI4
+RETI4
+LABELV $71
+endproc AAS_RoutingCacheClass 16 0
+proc AAS_LinkRoutingCacheChunk 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+NEU4 $80
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+NEU4 $78
+LABELV $80
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $81
+ADDRLP4 8
+CNSTI4 12
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $81
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $79
+JUMPV
+LABELV $78
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $86
+JUMPV
+LABELV $83
+LABELV $84
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $86
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $83
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $79
+LABELV $77
+endproc AAS_LinkRoutingCacheChunk 12 0
+proc AAS_UnlinkRoutingCacheChunk 16 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $88
+ADDRLP4 4
+CNSTI4 16
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $89
+JUMPV
+LABELV $88
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $89
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $90
+ADDRLP4 12
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $90
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $87
+endproc AAS_UnlinkRoutingCacheChunk 16 0
+export AAS_AllocRoutingCacheMemory
+proc AAS_AllocRoutingCacheMemory 76 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 36
+ADDRGP4 AAS_RoutingCacheClass
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 28
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 routingcacheclasses
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 44
+INDIRU4
+EQU4 $95
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 44
+INDIRU4
+NEU4 $93
+LABELV $95
+ADDRLP4 20
+CNSTI4 65504
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+ADDI4
+DIVI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+GEI4 $96
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+LABELV $96
+ADDRLP4 32
+ADDRLP4 20
+INDIRI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+ADDI4
+MULI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRLP4 48
+ADDRGP4 GetMemory
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 52
+ADDRGP4 routingcacheslabsize
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $101
+JUMPV
+LABELV $98
+ADDRLP4 8
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $99
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+ADDI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $101
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $98
+ADDRLP4 56
+ADDRLP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_LinkRoutingCacheChunk
+CALLV
+pop
+LABELV $93
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 48
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 68
+INDIRU4
+NEU4 $102
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 68
+INDIRU4
+EQU4 $102
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkRoutingCacheChunk
+CALLV
+pop
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_LinkRoutingCacheChunk
+CALLV
+pop
+LABELV $102
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRGP4 routingcachesize
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $92
+endproc AAS_AllocRoutingCacheMemory 76 12
+export AAS_FreeRoutingCacheMemory
+proc AAS_FreeRoutingCacheMemory 60 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 20
+ADDRGP4 AAS_RoutingCacheClass
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 routingcacheclasses
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 -16
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRGP4 routingcachesize
+ASGNP4
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $106
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $107
+JUMPV
+LABELV $106
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $107
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $108
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkRoutingCacheChunk
+CALLV
+pop
+ADDRLP4 48
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 32
+SUBI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 16
+ADDI4
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 routingcacheslabsize
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+ADDRGP4 $109
+JUMPV
+LABELV $108
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $110
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $110
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkRoutingCacheChunk
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_LinkRoutingCacheChunk
+CALLV
+pop
+LABELV $110
+LABELV $109
+LABELV $104
+endproc AAS_FreeRoutingCacheMemory 60 8
+export AAS_FreeRoutingCacheChunks
+proc AAS_FreeRoutingCacheChunks 16 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $113
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 routingcacheclasses+12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $120
+JUMPV
+LABELV $117
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $118
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $120
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $117
+LABELV $114
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 104
+LTI4 $113
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 routingcacheslabsize
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 routingcacheclasses
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTU4 1664
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $112
+endproc AAS_FreeRoutingCacheChunks 16 12
+proc AAS_ClusterAreaNum 12 0
+ADDRLP4 0
+CNSTI4 28
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $124
+CNSTI4 28
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $122
+JUMPV
+LABELV $124
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+NEGI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $129
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $129
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $130
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+NEGI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRI4
+RETI4
+LABELV $122
+endproc AAS_ClusterAreaNum 12 0
+export AAS_InitTravelFlagFromType
+proc AAS_InitTravelFlagFromType 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $133
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+316
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $134
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $133
+ADDRGP4 aasworld+316+4
+CNSTI4 1
+ASGNI4
+ADDRGP4 aasworld+316+8
+CNSTI4 2
+ASGNI4
+ADDRGP4 aasworld+316+12
+CNSTI4 4
+ASGNI4
+ADDRGP4 aasworld+316+16
+CNSTI4 8
+ASGNI4
+ADDRGP4 aasworld+316+20
+CNSTI4 16
+ASGNI4
+ADDRGP4 aasworld+316+24
+CNSTI4 32
+ASGNI4
+ADDRGP4 aasworld+316+28
+CNSTI4 128
+ASGNI4
+ADDRGP4 aasworld+316+32
+CNSTI4 256
+ASGNI4
+ADDRGP4 aasworld+316+36
+CNSTI4 512
+ASGNI4
+ADDRGP4 aasworld+316+40
+CNSTI4 1024
+ASGNI4
+ADDRGP4 aasworld+316+44
+CNSTI4 2048
+ASGNI4
+ADDRGP4 aasworld+316+48
+CNSTI4 4096
+ASGNI4
+ADDRGP4 aasworld+316+52
+CNSTI4 8192
+ASGNI4
+ADDRGP4 aasworld+316+56
+CNSTI4 16384
+ASGNI4
+ADDRGP4 aasworld+316+60
+CNSTI4 32768
+ASGNI4
+ADDRGP4 aasworld+316+64
+CNSTI4 65536
+ASGNI4
+ADDRGP4 aasworld+316+68
+CNSTI4 131072
+ASGNI4
+ADDRGP4 aasworld+316+72
+CNSTI4 262144
+ASGNI4
+ADDRGP4 aasworld+316+76
+CNSTI4 16777216
+ASGNI4
+LABELV $132
+endproc AAS_InitTravelFlagFromType 4 0
+proc AAS_TravelFlagForType_inline 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16777216
+BANDI4
+CNSTI4 0
+EQI4 $177
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 134217728
+BORI4
+ASGNI4
+LABELV $177
+ADDRFP4 0
+INDIRI4
+CNSTI4 33554432
+BANDI4
+CNSTI4 0
+EQI4 $179
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 268435456
+BORI4
+ASGNI4
+LABELV $179
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 16777215
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $183
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $181
+LABELV $183
+CNSTI4 1
+RETI4
+ADDRGP4 $176
+JUMPV
+LABELV $181
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+316
+ADDP4
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $176
+endproc AAS_TravelFlagForType_inline 8 0
+export AAS_TravelFlagForType
+proc AAS_TravelFlagForType 4 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 AAS_TravelFlagForType_inline
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $185
+endproc AAS_TravelFlagForType 4 4
+export AAS_UnlinkCache
+proc AAS_UnlinkCache 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $187
+ADDRLP4 4
+CNSTI4 48
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $188
+JUMPV
+LABELV $187
+ADDRGP4 aasworld+480
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $188
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $190
+ADDRLP4 12
+CNSTI4 52
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $191
+JUMPV
+LABELV $190
+ADDRGP4 aasworld+476
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $191
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $186
+endproc AAS_UnlinkCache 16 0
+export AAS_LinkCache
+proc AAS_LinkCache 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+480
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $194
+ADDRGP4 aasworld+480
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRGP4 aasworld+480
+INDIRP4
+ASGNP4
+ADDRGP4 $195
+JUMPV
+LABELV $194
+ADDRGP4 aasworld+476
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $195
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+480
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $193
+endproc AAS_LinkCache 0 0
+export AAS_FreeRoutingCache
+proc AAS_FreeRoutingCache 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkCache
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeRoutingCacheMemory
+CALLV
+pop
+LABELV $201
+endproc AAS_FreeRoutingCache 0 4
+export AAS_RemoveRoutingCacheInCluster
+proc AAS_RemoveRoutingCacheInCluster 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld+468
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $203
+ADDRGP4 $202
+JUMPV
+LABELV $203
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $210
+JUMPV
+LABELV $207
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+468
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $214
+JUMPV
+LABELV $211
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeRoutingCache
+CALLV
+pop
+LABELV $212
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $214
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $211
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+468
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $208
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $210
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+LTI4 $207
+LABELV $202
+endproc AAS_RemoveRoutingCacheInCluster 24 4
+export AAS_RemoveRoutingCacheUsingArea
+proc AAS_RemoveRoutingCacheUsingArea 20 4
+ADDRLP4 12
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $219
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 AAS_RemoveRoutingCacheInCluster
+CALLV
+pop
+ADDRGP4 $220
+JUMPV
+LABELV $219
+CNSTI4 20
+ADDRLP4 12
+INDIRI4
+NEGI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 AAS_RemoveRoutingCacheInCluster
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 12
+INDIRI4
+NEGI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 AAS_RemoveRoutingCacheInCluster
+CALLV
+pop
+LABELV $220
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $226
+JUMPV
+LABELV $223
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+472
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $231
+JUMPV
+LABELV $228
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeRoutingCache
+CALLV
+pop
+LABELV $229
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $231
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $228
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+472
+INDIRP4
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $224
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $226
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $223
+LABELV $217
+endproc AAS_RemoveRoutingCacheUsingArea 20 4
+proc AAS_CountDisabledArea 20 0
+ADDRLP4 8
+ADDRGP4 aasworld+504
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $237
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+508
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $238
+JUMPV
+LABELV $237
+ADDRLP4 4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+NEGI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+508
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+508
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $238
+LABELV $234
+endproc AAS_CountDisabledArea 20 0
+export AAS_EnableRoutingArea
+proc AAS_EnableRoutingArea 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $247
+ADDRFP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $244
+LABELV $247
+ADDRGP4 botDeveloper
+INDIRI4
+CNSTI4 0
+EQI4 $248
+CNSTI4 3
+ARGI4
+ADDRGP4 $251
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $248
+CNSTI4 0
+RETI4
+ADDRGP4 $243
+JUMPV
+LABELV $244
+ADDRLP4 0
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $253
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $256
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $257
+JUMPV
+LABELV $256
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $257
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $243
+JUMPV
+LABELV $253
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $258
+ADDRLP4 12
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+ADDRGP4 $259
+JUMPV
+LABELV $258
+ADDRLP4 16
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $259
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+BANDI4
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+BANDI4
+EQI4 $262
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $266
+ADDRLP4 24
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $267
+JUMPV
+LABELV $266
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+LABELV $267
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 AAS_CountDisabledArea
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 AAS_RemoveRoutingCacheUsingArea
+CALLV
+pop
+LABELV $262
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $269
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $270
+JUMPV
+LABELV $269
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $270
+ADDRLP4 24
+INDIRI4
+RETI4
+LABELV $243
+endproc AAS_EnableRoutingArea 28 12
+proc AAS_RoutingTime 4 0
+ADDRLP4 0
+ADDRGP4 AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $271
+endproc AAS_RoutingTime 4 0
+export AAS_GetAreaContentsTravelFlags
+proc AAS_GetAreaContentsTravelFlags 12 0
+ADDRLP4 0
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $274
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1048576
+BORI4
+ASGNI4
+ADDRGP4 $275
+JUMPV
+LABELV $274
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $276
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2097152
+BORI4
+ASGNI4
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $278
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4194304
+BORI4
+ASGNI4
+ADDRGP4 $279
+JUMPV
+LABELV $278
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 524288
+BORI4
+ASGNI4
+LABELV $279
+LABELV $277
+LABELV $275
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $280
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8388608
+BORI4
+ASGNI4
+LABELV $280
+ADDRLP4 0
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $282
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 134217728
+BORI4
+ASGNI4
+LABELV $282
+ADDRLP4 0
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $284
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 268435456
+BORI4
+ASGNI4
+LABELV $284
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $286
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 67108864
+BORI4
+ASGNI4
+LABELV $286
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $272
+endproc AAS_GetAreaContentsTravelFlags 12 0
+proc AAS_AreaContentsTravelFlags_inline 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+444
+INDIRP4
+ADDP4
+INDIRI4
+RETI4
+LABELV $289
+endproc AAS_AreaContentsTravelFlags_inline 0 0
+export AAS_AreaContentsTravelFlags
+proc AAS_AreaContentsTravelFlags 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+444
+INDIRP4
+ADDP4
+INDIRI4
+RETI4
+LABELV $291
+endproc AAS_AreaContentsTravelFlags 0 0
+export AAS_InitAreaContentsTravelFlags
+proc AAS_InitAreaContentsTravelFlags 16 4
+ADDRGP4 aasworld+444
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $294
+ADDRGP4 aasworld+444
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $294
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ARGU4
+ADDRLP4 4
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+444
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $303
+JUMPV
+LABELV $300
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 AAS_GetAreaContentsTravelFlags
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+444
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $301
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $303
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $300
+LABELV $293
+endproc AAS_InitAreaContentsTravelFlags 16 4
+export AAS_CreateReversedReachability
+proc AAS_CreateReversedReachability 36 12
+ADDRGP4 aasworld+460
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $307
+ADDRGP4 aasworld+460
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $307
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+CNSTI4 3
+LSHU4
+CNSTU4 12
+ADDRGP4 aasworld+232
+INDIRI4
+CVIU4 4
+MULU4
+ADDU4
+ARGU4
+ADDRLP4 24
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+460
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+CNSTI4 3
+LSHU4
+ADDRLP4 16
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $318
+JUMPV
+LABELV $315
+ADDRLP4 12
+CNSTI4 28
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 128
+LTI4 $321
+CNSTI4 2
+ARGI4
+ADDRGP4 $324
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $321
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $328
+JUMPV
+LABELV $325
+ADDRLP4 8
+CNSTI4 44
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 16
+INDIRP4
+CNSTU4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+460
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+460
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+460
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $326
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $328
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+GEI4 $333
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $325
+LABELV $333
+LABELV $316
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $318
+ADDRLP4 20
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $315
+LABELV $306
+endproc AAS_CreateReversedReachability 36 12
+export AAS_AreaTravelTime
+proc AAS_AreaTravelTime 48 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 AAS_AreaCrouch
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $337
+ADDRLP4 16
+CNSTF4 1067869798
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $338
+JUMPV
+LABELV $337
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 AAS_AreaSwim
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $339
+ADDRLP4 16
+CNSTF4 1065353216
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $340
+JUMPV
+LABELV $339
+ADDRLP4 16
+CNSTF4 1051260355
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+LABELV $340
+LABELV $338
+ADDRLP4 12
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GTI4 $341
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+LABELV $341
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+CVUU2 4
+CVUI4 2
+RETI4
+LABELV $334
+endproc AAS_AreaTravelTime 48 4
+export AAS_CalculateAreaTravelTimes
+proc AAS_CalculateAreaTravelTimes 76 12
+ADDRGP4 aasworld+464
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $344
+ADDRGP4 aasworld+464
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $344
+ADDRLP4 44
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $352
+JUMPV
+LABELV $349
+ADDRLP4 36
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+460
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 32
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CVIU4 4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CVIU4 4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CVIU4 4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CVIU4 4
+CNSTU4 4
+ADDU4
+CNSTU4 1
+SUBU4
+CNSTU4 4294967292
+BANDU4
+MULU4
+CNSTI4 1
+LSHU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $350
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $352
+ADDRLP4 4
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $349
+ADDRLP4 44
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRLP4 48
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+464
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ADDRLP4 40
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $361
+JUMPV
+LABELV $358
+ADDRLP4 36
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+460
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+464
+INDIRP4
+ADDP4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 32
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ADDRLP4 40
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $369
+JUMPV
+LABELV $366
+ADDRLP4 56
+CNSTI4 2
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+464
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CVIU4 4
+CNSTU4 4
+ADDU4
+CNSTU4 1
+SUBU4
+CNSTU4 4294967292
+BANDU4
+CNSTI4 1
+LSHU4
+ADDRLP4 40
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 44
+ADDRLP4 32
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $375
+JUMPV
+LABELV $372
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 AAS_AreaTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+464
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 68
+INDIRI4
+CVIU4 4
+CVUU2 4
+ASGNU2
+LABELV $373
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $375
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $372
+LABELV $367
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $369
+ADDRLP4 24
+INDIRI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+LTI4 $366
+LABELV $359
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $361
+ADDRLP4 4
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $358
+LABELV $343
+endproc AAS_CalculateAreaTravelTimes 76 12
+export AAS_PortalMaxTravelTime
+proc AAS_PortalMaxTravelTime 44 0
+ADDRLP4 20
+CNSTI4 20
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+460
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 28
+ADDRLP4 20
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $385
+JUMPV
+LABELV $382
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $389
+JUMPV
+LABELV $386
+ADDRLP4 40
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LSHI4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+464
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+INDIRU2
+CVUI4 2
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $391
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $391
+LABELV $387
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $389
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $386
+LABELV $383
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $385
+ADDRLP4 16
+INDIRI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+LTI4 $382
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $378
+endproc AAS_PortalMaxTravelTime 44 0
+export AAS_InitPortalMaxTravelTimes
+proc AAS_InitPortalMaxTravelTimes 16 4
+ADDRGP4 aasworld+484
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $394
+ADDRGP4 aasworld+484
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $394
+ADDRGP4 aasworld+256
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ARGU4
+ADDRLP4 4
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+484
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $403
+JUMPV
+LABELV $400
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 AAS_PortalMaxTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+484
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $401
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $403
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+256
+INDIRI4
+LTI4 $400
+LABELV $393
+endproc AAS_InitPortalMaxTravelTimes 16 4
+proc AAS_EvictCache 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRU1
+CVUI4 1
+CNSTI4 1
+NEI4 $407
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 AAS_ClusterAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $409
+ADDRLP4 16
+CNSTI4 44
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $410
+JUMPV
+LABELV $409
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+468
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $410
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $408
+ADDRLP4 32
+CNSTI4 40
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $408
+JUMPV
+LABELV $407
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $414
+ADDRLP4 8
+CNSTI4 44
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $415
+JUMPV
+LABELV $414
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+472
+INDIRP4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $415
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $417
+ADDRLP4 20
+CNSTI4 40
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $417
+LABELV $408
+ADDRLP4 4
+ADDRGP4 routingcacheevictions
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 routingcacheevictedbytes
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeRoutingCache
+CALLV
+pop
+LABELV $406
+endproc AAS_EvictCache 36 8
+export AAS_FreeOldestCache
+proc AAS_FreeOldestCache 8 4
+ADDRLP4 0
+ADDRGP4 aasworld+476
+INDIRP4
+ASGNP4
+ADDRGP4 $423
+JUMPV
+LABELV $420
+ADDRLP4 0
+INDIRP4
+INDIRU1
+CVUI4 1
+CNSTI4 1
+NEI4 $422
+CNSTI4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $422
+LABELV $421
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $423
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $420
+LABELV $422
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $428
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_EvictCache
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $419
+JUMPV
+LABELV $428
+CNSTI4 0
+RETI4
+LABELV $419
+endproc AAS_FreeOldestCache 8 4
+export AAS_FreeOldestCaches
+proc AAS_FreeOldestCaches 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 aasworld+476
+INDIRP4
+ASGNP4
+ADDRGP4 $434
+JUMPV
+LABELV $431
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRU1
+CVUI4 1
+CNSTI4 1
+NEI4 $436
+CNSTI4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $436
+ADDRGP4 $432
+JUMPV
+LABELV $436
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_EvictCache
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $432
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $434
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $439
+ADDRGP4 routingcachesize
+INDIRI4
+ADDRFP4 0
+INDIRI4
+GTI4 $431
+LABELV $439
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $430
+endproc AAS_FreeOldestCaches 16 4
+export AAS_AllocRoutingCache
+proc AAS_AllocRoutingCache 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 8
+INDIRU4
+CNSTI4 1
+LSHU4
+CNSTU4 64
+ADDU4
+CNSTU4 1
+ADDRLP4 8
+INDIRU4
+MULU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 AAS_AllocRoutingCacheMemory
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRFP4 0
+INDIRI4
+CVIU4 4
+CNSTI4 1
+LSHU4
+ADDRLP4 0
+INDIRP4
+CNSTU4 64
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $440
+endproc AAS_AllocRoutingCache 20 4
+export AAS_FreeAllClusterAreaCache
+proc AAS_FreeAllClusterAreaCache 28 4
+ADDRGP4 aasworld+468
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $442
+ADDRGP4 $441
+JUMPV
+LABELV $442
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $448
+JUMPV
+LABELV $445
+ADDRLP4 16
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $454
+JUMPV
+LABELV $451
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+468
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $458
+JUMPV
+LABELV $455
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeRoutingCache
+CALLV
+pop
+LABELV $456
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $458
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $455
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+468
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $452
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $454
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+LTI4 $451
+LABELV $446
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $448
+ADDRLP4 12
+INDIRI4
+ADDRGP4 aasworld+272
+INDIRI4
+LTI4 $445
+ADDRGP4 aasworld+468
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+ADDRGP4 aasworld+468
+CNSTP4 0
+ASGNP4
+LABELV $441
+endproc AAS_FreeAllClusterAreaCache 28 4
+export AAS_InitClusterAreaCache
+proc AAS_InitClusterAreaCache 24 4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $467
+JUMPV
+LABELV $464
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $465
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $467
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+272
+INDIRI4
+LTI4 $464
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRGP4 aasworld+272
+INDIRI4
+CVIU4 4
+ADDRLP4 16
+INDIRI4
+LSHU4
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+ADDRLP4 16
+INDIRI4
+LSHU4
+ADDU4
+ARGU4
+ADDRLP4 20
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+468
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 aasworld+272
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $476
+JUMPV
+LABELV $473
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+468
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $474
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $476
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+272
+INDIRI4
+LTI4 $473
+LABELV $463
+endproc AAS_InitClusterAreaCache 24 4
+export AAS_FreeAllPortalCache
+proc AAS_FreeAllPortalCache 16 4
+ADDRGP4 aasworld+472
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $481
+ADDRGP4 $480
+JUMPV
+LABELV $481
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $487
+JUMPV
+LABELV $484
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+472
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $492
+JUMPV
+LABELV $489
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeRoutingCache
+CALLV
+pop
+LABELV $490
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $492
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $489
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+472
+INDIRP4
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $485
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $487
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $484
+ADDRGP4 aasworld+472
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+ADDRGP4 aasworld+472
+CNSTP4 0
+ASGNP4
+LABELV $480
+endproc AAS_FreeAllPortalCache 16 4
+export AAS_InitPortalCache
+proc AAS_InitPortalCache 4 4
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ARGU4
+ADDRLP4 0
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+472
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $497
+endproc AAS_InitPortalCache 4 4
+export AAS_InitRoutingUpdate
+proc AAS_InitRoutingUpdate 20 4
+ADDRGP4 aasworld+448
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $501
+ADDRGP4 aasworld+448
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $501
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $508
+JUMPV
+LABELV $505
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $510
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $510
+LABELV $506
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $508
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+272
+INDIRI4
+LTI4 $505
+CNSTU4 44
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRLP4 12
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+448
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+452
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $515
+ADDRGP4 aasworld+452
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $515
+CNSTU4 44
+ADDRGP4 aasworld+256
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRLP4 16
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+452
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $500
+endproc AAS_InitRoutingUpdate 20 4
+export AAS_CreateAllRoutingCache
+proc AAS_CreateAllRoutingCache 20 16
+ADDRGP4 aasworld+4
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRGP4 $524
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $528
+JUMPV
+LABELV $525
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $530
+ADDRGP4 $526
+JUMPV
+LABELV $530
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $535
+JUMPV
+LABELV $532
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $537
+ADDRGP4 $533
+JUMPV
+LABELV $537
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $539
+ADDRGP4 $533
+JUMPV
+LABELV $539
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 48
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 AAS_AreaTravelTimeToGoalArea
+CALLI4
+pop
+LABELV $533
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $535
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $532
+LABELV $526
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $528
+ADDRLP4 4
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $525
+ADDRGP4 aasworld+4
+CNSTI4 0
+ASGNI4
+LABELV $521
+endproc AAS_CreateAllRoutingCache 20 16
+export AAS_WriteRouteCache
+proc AAS_WriteRouteCache 156 16
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRGP4 $547
+JUMPV
+LABELV $544
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+472
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $552
+JUMPV
+LABELV $549
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $550
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $552
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $549
+LABELV $545
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $547
+ADDRLP4 20
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $544
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRGP4 $557
+JUMPV
+LABELV $554
+ADDRLP4 24
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $563
+JUMPV
+LABELV $560
+ADDRLP4 136
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LSHI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+468
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $567
+JUMPV
+LABELV $564
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $565
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $567
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $564
+LABELV $561
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $563
+ADDRLP4 16
+INDIRI4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+LTI4 $560
+LABELV $555
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $557
+ADDRLP4 20
+INDIRI4
+ADDRGP4 aasworld+272
+INDIRI4
+LTI4 $554
+ADDRLP4 64
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $569
+ARGP4
+ADDRGP4 aasworld+88
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 64
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 botimport+52
+INDIRP4
+CALLI4
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $572
+ADDRGP4 $574
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 AAS_Error
+CALLV
+pop
+ADDRGP4 $543
+JUMPV
+LABELV $572
+ADDRLP4 32
+CNSTI4 1129465165
+ASGNI4
+ADDRLP4 32+4
+CNSTI4 2
+ASGNI4
+ADDRLP4 32+8
+ADDRGP4 aasworld+216
+INDIRI4
+ASGNI4
+ADDRLP4 32+12
+ADDRGP4 aasworld+272
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld+220
+INDIRP4
+ARGP4
+CNSTU4 48
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRLP4 136
+ADDRGP4 CRC_ProcessString
+CALLI4
+ASGNI4
+ADDRLP4 32+16
+ADDRLP4 136
+INDIRI4
+CVIU4 4
+CVUU2 4
+CVUI4 2
+ASGNI4
+ADDRGP4 aasworld+276
+INDIRP4
+ARGP4
+ADDRGP4 aasworld+272
+INDIRI4
+CVIU4 4
+CNSTI4 4
+LSHU4
+CVUI4 4
+ARGI4
+ADDRLP4 140
+ADDRGP4 CRC_ProcessString
+CALLI4
+ASGNI4
+ADDRLP4 32+20
+ADDRLP4 140
+INDIRI4
+CVIU4 4
+CVUU2 4
+CVUI4 2
+ASGNI4
+ADDRLP4 32+24
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 32+28
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 botimport+60
+INDIRP4
+CALLI4
+pop
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRGP4 $592
+JUMPV
+LABELV $589
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+472
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $597
+JUMPV
+LABELV $594
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 botimport+60
+INDIRP4
+CALLI4
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $595
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $597
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $594
+LABELV $590
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $592
+ADDRLP4 20
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $589
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $603
+JUMPV
+LABELV $600
+ADDRLP4 24
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $606
+ADDRLP4 148
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ADDRLP4 148
+INDIRI4
+LSHI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 148
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+468
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $613
+JUMPV
+LABELV $610
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 botimport+60
+INDIRP4
+CALLI4
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $611
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $613
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $610
+LABELV $607
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $609
+ADDRLP4 16
+INDIRI4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+LTI4 $606
+LABELV $601
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $603
+ADDRLP4 20
+INDIRI4
+ADDRGP4 aasworld+272
+INDIRI4
+LTI4 $600
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $618
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $620
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $543
+endproc AAS_WriteRouteCache 156 16
+export AAS_ReadCache
+proc AAS_ReadCache 24 12
+ADDRLP4 0
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 botimport+56
+INDIRP4
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 AAS_AllocRoutingCacheMemory
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTU4 4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 12
+INDIRU4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ADDRLP4 12
+INDIRU4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 botimport+56
+INDIRP4
+CALLI4
+pop
+ADDRLP4 20
+CNSTU4 64
+ASGNU4
+ADDRLP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ADDRLP4 20
+INDIRU4
+SUBU4
+CNSTU4 2
+ADDU4
+CNSTU4 3
+DIVU4
+CNSTI4 1
+LSHU4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 20
+INDIRU4
+CNSTI4 -2
+ADDU4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $621
+endproc AAS_ReadCache 24 12
+export AAS_ReadRouteCache
+proc AAS_ReadRouteCache 160 16
+ADDRLP4 48
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $569
+ARGP4
+ADDRGP4 aasworld+88
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 48
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 botimport+52
+INDIRP4
+CALLI4
+pop
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $627
+CNSTI4 0
+RETI4
+ADDRGP4 $624
+JUMPV
+LABELV $627
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 botimport+56
+INDIRP4
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 1129465165
+EQI4 $630
+ADDRGP4 $632
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 AAS_Error
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $624
+JUMPV
+LABELV $630
+ADDRLP4 12+4
+INDIRI4
+CNSTI4 2
+EQI4 $633
+ADDRGP4 $636
+ARGP4
+ADDRLP4 12+4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 AAS_Error
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $624
+JUMPV
+LABELV $633
+ADDRLP4 12+8
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+EQI4 $638
+CNSTI4 0
+RETI4
+ADDRGP4 $624
+JUMPV
+LABELV $638
+ADDRLP4 12+12
+INDIRI4
+ADDRGP4 aasworld+272
+INDIRI4
+EQI4 $642
+CNSTI4 0
+RETI4
+ADDRGP4 $624
+JUMPV
+LABELV $642
+ADDRGP4 aasworld+220
+INDIRP4
+ARGP4
+CNSTU4 48
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRLP4 112
+ADDRGP4 CRC_ProcessString
+CALLI4
+ASGNI4
+ADDRLP4 12+16
+INDIRI4
+ADDRLP4 112
+INDIRI4
+CVIU4 4
+CVUU2 4
+CVUI4 2
+EQI4 $646
+CNSTI4 0
+RETI4
+ADDRGP4 $624
+JUMPV
+LABELV $646
+ADDRGP4 aasworld+276
+INDIRP4
+ARGP4
+ADDRGP4 aasworld+272
+INDIRI4
+CVIU4 4
+CNSTI4 4
+LSHU4
+CVUI4 4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CRC_ProcessString
+CALLI4
+ASGNI4
+ADDRLP4 12+20
+INDIRI4
+ADDRLP4 116
+INDIRI4
+CVIU4 4
+CVUU2 4
+CVUI4 2
+EQI4 $651
+CNSTI4 0
+RETI4
+ADDRGP4 $624
+JUMPV
+LABELV $651
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $659
+JUMPV
+LABELV $656
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 AAS_ReadCache
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+472
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+472
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $662
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+472
+INDIRP4
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $662
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+472
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $657
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $659
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12+24
+INDIRI4
+LTI4 $656
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $670
+JUMPV
+LABELV $667
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 AAS_ReadCache
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 AAS_ClusterAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 136
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+468
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 140
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+468
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $673
+ADDRLP4 144
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+468
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $673
+ADDRLP4 152
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+468
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $668
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $670
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12+28
+INDIRI4
+LTI4 $667
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $624
+endproc AAS_ReadRouteCache 160 16
+export AAS_InitReachabilityAreas
+proc AAS_InitReachabilityAreas 220 20
+ADDRGP4 aasworld+492
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $680
+ADDRGP4 aasworld+492
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $680
+ADDRGP4 aasworld+488
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $684
+ADDRGP4 aasworld+488
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $684
+ADDRGP4 aasworld+232
+INDIRI4
+CVIU4 4
+CNSTI4 3
+LSHU4
+ARGU4
+ADDRLP4 172
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+492
+ADDRLP4 172
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+232
+INDIRI4
+CNSTI4 5
+LSHI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ARGU4
+ADDRLP4 176
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+488
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRGP4 $695
+JUMPV
+LABELV $692
+ADDRLP4 144
+CNSTI4 44
+ADDRLP4 140
+INDIRI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 184
+ADDRLP4 144
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 16777215
+BANDI4
+ASGNI4
+ADDRLP4 192
+CNSTI4 2
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ADDRLP4 192
+INDIRI4
+LTI4 $699
+ADDRLP4 184
+INDIRI4
+CNSTI4 19
+GTI4 $699
+ADDRLP4 184
+INDIRI4
+ADDRLP4 192
+INDIRI4
+LSHI4
+ADDRGP4 $717-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $717
+address $699
+address $699
+address $701
+address $699
+address $699
+address $703
+address $699
+address $701
+address $699
+address $699
+address $699
+address $699
+address $705
+address $699
+address $699
+address $699
+address $699
+address $699
+code
+LABELV $701
+ADDRLP4 160
+ADDRLP4 144
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 160+8
+ADDRLP4 144
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 144
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 200
+ADDRGP4 AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRGP4 $699
+JUMPV
+LABELV $703
+ADDRLP4 148
+ADDRLP4 144
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 148+8
+ADDRLP4 144
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 148
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 208
+ADDRGP4 AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 208
+INDIRI4
+ASGNI4
+ADDRGP4 $699
+JUMPV
+LABELV $705
+ADDRLP4 144
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 216
+ADDRGP4 AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 216
+INDIRI4
+ASGNI4
+LABELV $699
+ADDRLP4 140
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+492
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+492
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $724
+JUMPV
+LABELV $721
+ADDRLP4 196
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 196
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 200
+CNSTI4 2
+ASGNI4
+ADDRLP4 196
+INDIRI4
+ADDRLP4 200
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+488
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 200
+INDIRI4
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $722
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $724
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $721
+LABELV $693
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $695
+ADDRLP4 140
+INDIRI4
+ADDRGP4 aasworld+232
+INDIRI4
+LTI4 $692
+LABELV $679
+endproc AAS_InitReachabilityAreas 220 20
+export AAS_InitRouting
+proc AAS_InitRouting 28 8
+ADDRGP4 AAS_InitTravelFlagFromType
+CALLV
+pop
+ADDRGP4 AAS_InitAreaContentsTravelFlags
+CALLV
+pop
+ADDRGP4 AAS_InitRoutingUpdate
+CALLV
+pop
+ADDRGP4 AAS_CreateReversedReachability
+CALLV
+pop
+ADDRGP4 AAS_InitClusterAreaCache
+CALLV
+pop
+ADDRGP4 AAS_InitPortalCache
+CALLV
+pop
+ADDRGP4 AAS_CalculateAreaTravelTimes
+CALLV
+pop
+ADDRGP4 AAS_InitPortalMaxTravelTimes
+CALLV
+pop
+ADDRGP4 AAS_InitReachabilityAreas
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 numareacacheupdates
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 numportalcacheupdates
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 numareacacherelaxations
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 numportalcacherelaxations
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 routingcachesize
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $727
+ARGP4
+ADDRGP4 $728
+ARGP4
+ADDRLP4 8
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 max_routingcachesize
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 routingcachehits
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 routingcachemisses
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 routingcacheevictions
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 routingcacheevictedbytes
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $729
+ARGP4
+ADDRGP4 $730
+ARGP4
+ADDRLP4 16
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 routingqueuesorted
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 aasworld+504
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+272
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ARGU4
+ADDRLP4 20
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+508
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $737
+JUMPV
+LABELV $734
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $739
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 AAS_CountDisabledArea
+CALLV
+pop
+LABELV $739
+LABELV $735
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $737
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $734
+ADDRGP4 AAS_ReadRouteCache
+CALLI4
+pop
+ADDRGP4 $744
+ARGP4
+ADDRGP4 $730
+ARGP4
+ADDRLP4 24
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+CNSTI4 0
+EQI4 $742
+ADDRGP4 AAS_ReadRouteTables
+CALLI4
+pop
+LABELV $742
+LABELV $726
+endproc AAS_InitRouting 28 8
+export AAS_FreeRoutingCaches
+proc AAS_FreeRoutingCaches 0 4
+ADDRGP4 AAS_FreeAllClusterAreaCache
+CALLV
+pop
+ADDRGP4 AAS_FreeAllPortalCache
+CALLV
+pop
+ADDRGP4 AAS_FreeRoutingCacheChunks
+CALLV
+pop
+ADDRGP4 aasworld+464
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $746
+ADDRGP4 aasworld+464
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $746
+ADDRGP4 aasworld+464
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+484
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $751
+ADDRGP4 aasworld+484
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $751
+ADDRGP4 aasworld+484
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+460
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $756
+ADDRGP4 aasworld+460
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $756
+ADDRGP4 aasworld+460
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+448
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $761
+ADDRGP4 aasworld+448
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $761
+ADDRGP4 aasworld+448
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+452
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $766
+ADDRGP4 aasworld+452
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $766
+ADDRGP4 aasworld+452
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+492
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $771
+ADDRGP4 aasworld+492
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $771
+ADDRGP4 aasworld+492
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+488
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $776
+ADDRGP4 aasworld+488
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $776
+ADDRGP4 aasworld+488
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+444
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $781
+ADDRGP4 aasworld+444
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $781
+ADDRGP4 aasworld+444
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+500
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $786
+ADDRGP4 aasworld+500
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $786
+ADDRGP4 aasworld+500
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+496
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+508
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $792
+ADDRGP4 aasworld+508
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $792
+ADDRGP4 aasworld+508
+CNSTP4 0
+ASGNP4
+LABELV $745
+endproc AAS_FreeRoutingCaches 0 4
+proc AAS_RoutingQueueBucket 12 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CVIU4 4
+CVUU2 4
+ASGNU2
+ADDRFP4 4
+INDIRU2
+CVUI4 2
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU2
+CVUI4 2
+GTI4 $798
+CNSTI4 0
+RETI4
+ADDRGP4 $797
+JUMPV
+LABELV $798
+ADDRLP4 0
+ADDRFP4 4
+INDIRU2
+CVUI4 2
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU2
+CVUI4 2
+BXORI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 65280
+BANDI4
+CNSTI4 0
+EQI4 $800
+ADDRLP4 8
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+RSHI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $800
+ADDRLP4 0
+INDIRI4
+CNSTI4 240
+BANDI4
+CNSTI4 0
+EQI4 $802
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+RSHI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $802
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+BANDI4
+CNSTI4 0
+EQI4 $804
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+RSHI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $804
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $806
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $806
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $797
+endproc AAS_RoutingQueueBucket 12 0
+proc AAS_RoutingQueueLinkBucket 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $809
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $809
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $808
+endproc AAS_RoutingQueueLinkBucket 0 0
+proc AAS_RoutingQueueUnlinkBucket 20 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $812
+ADDRLP4 4
+CNSTI4 36
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $813
+JUMPV
+LABELV $812
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $813
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $814
+ADDRLP4 16
+CNSTI4 40
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $814
+LABELV $811
+endproc AAS_RoutingQueueUnlinkBucket 20 0
+proc AAS_InitRoutingQueue 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 84
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ADDRGP4 routingqueuesorted
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRU2
+ASGNU2
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $817
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $818
+JUMPV
+LABELV $817
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $818
+LABELV $816
+endproc AAS_InitRoutingQueue 0 12
+proc AAS_RoutingQueueUpdate 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $820
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRU2
+CVUI4 2
+ARGI4
+ADDRLP4 4
+ADDRGP4 AAS_RoutingQueueBucket
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $822
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $824
+ADDRGP4 $819
+JUMPV
+LABELV $824
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 AAS_RoutingQueueUnlinkBucket
+CALLV
+pop
+LABELV $822
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 AAS_RoutingQueueLinkBucket
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $819
+JUMPV
+LABELV $820
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $826
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $828
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $829
+JUMPV
+LABELV $828
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $829
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $826
+LABELV $819
+endproc AAS_RoutingQueueUpdate 8 12
+proc AAS_RoutingQueueRemoveFirst 32 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $831
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $833
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $835
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $839
+ADDRGP4 $837
+JUMPV
+LABELV $839
+LABELV $836
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 17
+LTI4 $835
+LABELV $837
+ADDRLP4 4
+INDIRI4
+CNSTI4 17
+LTI4 $841
+CNSTP4 0
+RETP4
+ADDRGP4 $830
+JUMPV
+LABELV $841
+ADDRLP4 16
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRU2
+ASGNU2
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $846
+JUMPV
+LABELV $843
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRU2
+CVUI4 2
+ADDRLP4 12
+INDIRU2
+CVUI4 2
+GEI4 $847
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRU2
+ASGNU2
+LABELV $847
+LABELV $844
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $846
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $843
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRU2
+ASGNU2
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $852
+JUMPV
+LABELV $849
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRU2
+CVUI4 2
+ARGI4
+ADDRLP4 28
+ADDRGP4 AAS_RoutingQueueBucket
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 AAS_RoutingQueueLinkBucket
+CALLV
+pop
+LABELV $850
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $852
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $849
+LABELV $833
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_RoutingQueueUnlinkBucket
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $830
+JUMPV
+LABELV $831
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $853
+CNSTP4 0
+RETP4
+ADDRGP4 $830
+JUMPV
+LABELV $853
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $855
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $856
+JUMPV
+LABELV $855
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $856
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $830
+endproc AAS_RoutingQueueRemoveFirst 32 12
+export AAS_UpdateAreaRoutingCache
+proc AAS_UpdateAreaRoutingCache 492 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 392
+ADDRGP4 numareacacheupdates
+ASGNP4
+ADDRLP4 396
+CNSTI4 1
+ASGNI4
+ADDRLP4 392
+INDIRP4
+ADDRLP4 392
+INDIRP4
+INDIRI4
+ADDRLP4 396
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 400
+CNSTI4 4
+ASGNI4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 400
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 400
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 404
+ADDRGP4 aasworld+456
+ASGNP4
+ADDRLP4 404
+INDIRP4
+ADDRLP4 404
+INDIRP4
+INDIRI4
+ADDRLP4 396
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+BCOMI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ADDRGP4 AAS_ClusterAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LTI4 $860
+ADDRGP4 $857
+JUMPV
+LABELV $860
+ADDRLP4 136
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 256
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 32
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+448
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 136
+ASGNP4
+ADDRLP4 420
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 424
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 420
+INDIRF4
+ADDRLP4 424
+INDIRF4
+LTF4 $864
+ADDRLP4 416
+ADDRLP4 420
+INDIRF4
+ADDRLP4 424
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $865
+JUMPV
+LABELV $864
+ADDRLP4 416
+ADDRLP4 420
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $865
+ADDRLP4 32
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 416
+INDIRU4
+CVUU2 4
+ASGNU2
+ADDRLP4 436
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 440
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 436
+INDIRF4
+ADDRLP4 440
+INDIRF4
+LTF4 $867
+ADDRLP4 428
+ADDRLP4 436
+INDIRF4
+ADDRLP4 440
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $868
+JUMPV
+LABELV $867
+ADDRLP4 428
+ADDRLP4 436
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $868
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDP4
+ADDRLP4 428
+INDIRU4
+CVUU2 4
+ASGNU2
+ADDRLP4 48
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 AAS_InitRoutingQueue
+CALLV
+pop
+ADDRGP4 $870
+JUMPV
+LABELV $869
+ADDRLP4 444
+CNSTI4 4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 32
+INDIRP4
+ADDRLP4 444
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+460
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 444
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $876
+JUMPV
+LABELV $873
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 448
+ADDRGP4 AAS_TravelFlagForType_inline
+CALLI4
+ASGNI4
+ADDRLP4 448
+INDIRI4
+ADDRLP4 40
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $878
+ADDRGP4 $874
+JUMPV
+LABELV $878
+CNSTI4 28
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $880
+ADDRGP4 $874
+JUMPV
+LABELV $880
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 452
+ADDRGP4 AAS_AreaContentsTravelFlags_inline
+CALLI4
+ASGNI4
+ADDRLP4 452
+INDIRI4
+ADDRLP4 40
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $883
+ADDRGP4 $874
+JUMPV
+LABELV $883
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 28
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LEI4 $886
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+EQI4 $886
+ADDRGP4 $874
+JUMPV
+LABELV $886
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 460
+ADDRGP4 AAS_ClusterAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LTI4 $888
+ADDRGP4 $874
+JUMPV
+LABELV $888
+ADDRLP4 24
+ADDRLP4 32
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRU2
+CVUI4 2
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ADDP4
+INDIRU2
+CVUI4 2
+ADDI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRU2
+CVUI4 2
+ADDI4
+CVIU4 4
+CVUU2 4
+ASGNU2
+ADDRLP4 468
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDP4
+INDIRU2
+CVUI4 2
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+EQI4 $892
+ADDRLP4 468
+INDIRI4
+ADDRLP4 24
+INDIRU2
+CVUI4 2
+LEI4 $890
+LABELV $892
+ADDRLP4 472
+ADDRGP4 numareacacherelaxations
+ASGNP4
+ADDRLP4 476
+CNSTI4 1
+ASGNI4
+ADDRLP4 472
+INDIRP4
+ADDRLP4 472
+INDIRP4
+INDIRI4
+ADDRLP4 476
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 476
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDP4
+ADDRLP4 24
+INDIRU2
+ASGNU2
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 28
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+INDIRI4
+SUBI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 28
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+448
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 24
+INDIRU2
+ASGNU2
+ADDRLP4 480
+CNSTI4 24
+ASGNI4
+ADDRLP4 488
+CNSTI4 2
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 480
+INDIRI4
+ADDP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 28
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 480
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 488
+INDIRI4
+LSHI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 488
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+464
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 AAS_RoutingQueueUpdate
+CALLV
+pop
+LABELV $890
+LABELV $874
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $876
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $873
+LABELV $870
+ADDRLP4 48
+ARGP4
+ADDRLP4 444
+ADDRGP4 AAS_RoutingQueueRemoveFirst
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 444
+INDIRP4
+ASGNP4
+ADDRLP4 444
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $869
+LABELV $857
+endproc AAS_UpdateAreaRoutingCache 492 12
+export AAS_GetAreaRoutingCache
+proc AAS_GetAreaRoutingCache 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 AAS_ClusterAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+468
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $902
+JUMPV
+LABELV $899
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+NEI4 $903
+ADDRGP4 $901
+JUMPV
+LABELV $903
+LABELV $900
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $902
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $899
+LABELV $901
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $905
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 AAS_AllocRoutingCache
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 48
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $909
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $909
+ADDRLP4 28
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+468
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UpdateAreaRoutingCache
+CALLV
+pop
+ADDRLP4 32
+ADDRGP4 routingcachemisses
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $906
+JUMPV
+LABELV $905
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkCache
+CALLV
+pop
+ADDRLP4 20
+ADDRGP4 routingcachehits
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $906
+ADDRLP4 20
+ADDRGP4 AAS_RoutingTime
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTU1 1
+ASGNU1
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_LinkCache
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $897
+endproc AAS_GetAreaRoutingCache 36 8
+proc AAS_RouteTableForTravelFlags 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $916
+JUMPV
+LABELV $913
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+500
+INDIRP4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $918
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+500
+INDIRP4
+ADDP4
+RETP4
+ADDRGP4 $912
+JUMPV
+LABELV $918
+LABELV $914
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $916
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+496
+INDIRI4
+LTI4 $913
+CNSTP4 0
+RETP4
+LABELV $912
+endproc AAS_RouteTableForTravelFlags 4 0
+proc AAS_ClusterAreaRoute 32 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 AAS_RouteTableForTravelFlags
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $923
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+508
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $923
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 AAS_ClusterAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GEI4 $927
+ADDRFP4 12
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $922
+JUMPV
+LABELV $927
+LABELV $923
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 AAS_GetAreaRoutingCache
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $922
+endproc AAS_ClusterAreaRoute 32 12
+export AAS_UpdatePortalRoutingCache
+proc AAS_UpdatePortalRoutingCache 168 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 128
+ADDRGP4 numportalcacheupdates
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 44
+ADDRGP4 aasworld+256
+INDIRI4
+MULI4
+ADDRGP4 aasworld+452
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 140
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+LTF4 $933
+ADDRLP4 132
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $934
+JUMPV
+LABELV $933
+ADDRLP4 132
+ADDRLP4 136
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $934
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 132
+INDIRU4
+CVUU2 4
+ASGNU2
+ADDRLP4 124
+CNSTI4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+GEI4 $936
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 156
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 156
+INDIRF4
+LTF4 $939
+ADDRLP4 144
+ADDRLP4 152
+INDIRF4
+ADDRLP4 156
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $940
+JUMPV
+LABELV $939
+ADDRLP4 144
+ADDRLP4 152
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $940
+ADDRLP4 124
+INDIRI4
+NEGI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDP4
+ADDRLP4 144
+INDIRU4
+CVUU2 4
+ASGNU2
+LABELV $936
+ADDRLP4 36
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 AAS_InitRoutingQueue
+CALLV
+pop
+ADDRGP4 $942
+JUMPV
+LABELV $941
+ADDRLP4 148
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRLP4 148
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRGP4 AAS_ClusterAreaRoute
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $948
+JUMPV
+LABELV $945
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+268
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+NEI4 $951
+ADDRGP4 $946
+JUMPV
+LABELV $951
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 AAS_ClusterAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $953
+ADDRGP4 $946
+JUMPV
+LABELV $953
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 32
+INDIRP4
+ADDP4
+INDIRU2
+ASGNU2
+ADDRLP4 4
+INDIRU2
+CVUI4 2
+CNSTI4 0
+NEI4 $955
+ADDRGP4 $946
+JUMPV
+LABELV $955
+ADDRLP4 4
+ADDRLP4 4
+INDIRU2
+CVUI4 2
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRU2
+CVUI4 2
+ADDI4
+CVIU4 4
+CVUU2 4
+ASGNU2
+ADDRLP4 156
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDP4
+INDIRU2
+CVUI4 2
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $959
+ADDRLP4 156
+INDIRI4
+ADDRLP4 4
+INDIRU2
+CVUI4 2
+LEI4 $957
+LABELV $959
+ADDRLP4 160
+ADDRGP4 numportalcacherelaxations
+ASGNP4
+ADDRLP4 164
+CNSTI4 1
+ASGNI4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+ADDRLP4 164
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 164
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRU2
+ASGNU2
+ADDRLP4 28
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+452
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+NEI4 $961
+ADDRLP4 28
+INDIRP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $962
+JUMPV
+LABELV $961
+ADDRLP4 28
+INDIRP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $962
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4
+INDIRU2
+CVUI4 2
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+484
+INDIRP4
+ADDP4
+INDIRI4
+ADDI4
+CVIU4 4
+CVUU2 4
+ASGNU2
+ADDRLP4 36
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 AAS_RoutingQueueUpdate
+CALLV
+pop
+LABELV $957
+LABELV $946
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $948
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $945
+LABELV $942
+ADDRLP4 36
+ARGP4
+ADDRLP4 144
+ADDRGP4 AAS_RoutingQueueRemoveFirst
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $941
+LABELV $929
+endproc AAS_UpdatePortalRoutingCache 168 20
+export AAS_GetPortalRoutingCache
+proc AAS_GetPortalRoutingCache 12 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+472
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $968
+JUMPV
+LABELV $965
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+NEI4 $970
+ADDRGP4 $967
+JUMPV
+LABELV $970
+LABELV $966
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $968
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $965
+LABELV $967
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $972
+ADDRGP4 aasworld+256
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 AAS_AllocRoutingCache
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 48
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+472
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+472
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $977
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+472
+INDIRP4
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $977
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+472
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UpdatePortalRoutingCache
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 routingcachemisses
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $973
+JUMPV
+LABELV $972
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkCache
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 routingcachehits
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $973
+ADDRLP4 4
+ADDRGP4 AAS_RoutingTime
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_LinkCache
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $964
+endproc AAS_GetPortalRoutingCache 12 4
+lit
+align 4
+LABELV routetabletravelflags
+byte 4 18616254
+byte 4 27004862
+code
+proc AAS_RouteTableSize 20 0
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $986
+JUMPV
+LABELV $983
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+CNSTU4 3
+ADDRLP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CVIU4 4
+MULU4
+CNSTU4 4
+ADDU4
+CNSTU4 1
+SUBU4
+CNSTU4 4294967292
+BANDU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $984
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $986
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+272
+INDIRI4
+LTI4 $983
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+ADDRGP4 aasworld+256
+INDIRI4
+ADDRGP4 aasworld+256
+INDIRI4
+MULI4
+CVIU4 4
+CNSTI4 1
+LSHU4
+CNSTU4 4
+ADDU4
+CNSTU4 1
+SUBU4
+CNSTU4 4294967292
+BANDU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $982
+endproc AAS_RouteTableSize 20 0
+proc AAS_ClusterReachabilityAreas 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $996
+JUMPV
+LABELV $993
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $998
+ADDRGP4 $994
+JUMPV
+LABELV $998
+ADDRLP4 4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+GEI4 $1002
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1002
+LABELV $994
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $996
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $993
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1007
+JUMPV
+LABELV $1004
+ADDRLP4 20
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+268
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 20
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $1011
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1012
+JUMPV
+LABELV $1011
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $1012
+ADDRLP4 16
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+GEI4 $1013
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ASGNI4
+LABELV $1013
+LABELV $1005
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1007
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $1004
+LABELV $991
+endproc AAS_ClusterReachabilityAreas 28 0
+proc AAS_PortalToPortalTravelTimes 36 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 20
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 aasworld+256
+INDIRI4
+CVIU4 4
+CNSTI4 1
+LSHU4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 aasworld+256
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 AAS_AllocRoutingCache
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $1019
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 aasworld+256
+INDIRI4
+CVIU4 4
+CNSTI4 1
+LSHU4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1025
+ADDRLP4 20
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1025
+ADDRLP4 20
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1026
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 48
+ADDRLP4 8
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UpdatePortalRoutingCache
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1031
+JUMPV
+LABELV $1028
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDP4
+INDIRU2
+CVUI4 2
+CNSTI4 0
+NEI4 $1033
+ADDRGP4 $1029
+JUMPV
+LABELV $1033
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRU2
+CVUI4 2
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $1037
+ADDRLP4 24
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDP4
+INDIRU2
+CVUI4 2
+ADDRLP4 28
+INDIRI4
+GEI4 $1035
+LABELV $1037
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDP4
+INDIRU2
+ASGNU2
+LABELV $1035
+LABELV $1029
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1031
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+256
+INDIRI4
+LTI4 $1028
+LABELV $1020
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LTI4 $1019
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeRoutingCacheMemory
+CALLV
+pop
+LABELV $1015
+endproc AAS_PortalToPortalTravelTimes 36 12
+export AAS_WriteRouteTables
+proc AAS_WriteRouteTables 192 16
+ADDRGP4 aasworld+4
+INDIRI4
+CNSTI4 0
+NEI4 $1039
+CNSTI4 3
+ARGI4
+ADDRGP4 $1043
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1038
+JUMPV
+LABELV $1039
+ADDRGP4 aasworld+504
+INDIRI4
+CNSTI4 0
+EQI4 $1044
+CNSTI4 3
+ARGI4
+ADDRGP4 $1048
+ARGP4
+ADDRGP4 aasworld+504
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1038
+JUMPV
+LABELV $1044
+ADDRLP4 140
+ADDRGP4 botimport
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $1050
+ARGP4
+ADDRGP4 aasworld+88
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 72
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 botimport+52
+INDIRP4
+CALLI4
+pop
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $1053
+ADDRGP4 $574
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 AAS_Error
+CALLV
+pop
+ADDRGP4 $1038
+JUMPV
+LABELV $1053
+ADDRLP4 40
+CNSTI4 1111577682
+ASGNI4
+ADDRLP4 40+4
+CNSTI4 1
+ASGNI4
+ADDRLP4 40+8
+ADDRGP4 aasworld+216
+INDIRI4
+ASGNI4
+ADDRLP4 40+12
+ADDRGP4 aasworld+272
+INDIRI4
+ASGNI4
+ADDRLP4 40+16
+ADDRGP4 aasworld+256
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld+220
+INDIRP4
+ARGP4
+CNSTU4 48
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRLP4 144
+ADDRGP4 CRC_ProcessString
+CALLI4
+ASGNI4
+ADDRLP4 40+20
+ADDRLP4 144
+INDIRI4
+CVIU4 4
+CVUU2 4
+CVUI4 2
+ASGNI4
+ADDRGP4 aasworld+276
+INDIRP4
+ARGP4
+ADDRGP4 aasworld+272
+INDIRI4
+CVIU4 4
+CNSTI4 4
+LSHU4
+CVUI4 4
+ARGI4
+ADDRLP4 148
+ADDRGP4 CRC_ProcessString
+CALLI4
+ASGNI4
+ADDRLP4 40+24
+ADDRLP4 148
+INDIRI4
+CVIU4 4
+CVUU2 4
+CVUI4 2
+ASGNI4
+ADDRLP4 40+28
+CNSTI4 2
+ASGNI4
+ADDRLP4 40
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 botimport+60
+INDIRP4
+CALLI4
+pop
+ADDRGP4 routetabletravelflags
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 botimport+60
+INDIRP4
+CALLI4
+pop
+ADDRLP4 152
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+ADDRGP4 aasworld+256
+INDIRI4
+ADDRGP4 aasworld+256
+INDIRI4
+MULI4
+CVIU4 4
+ADDRLP4 152
+INDIRI4
+LSHU4
+CNSTU4 4
+ADDU4
+CNSTU4 1
+SUBU4
+CNSTU4 4294967292
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRGP4 $1076
+JUMPV
+LABELV $1073
+ADDRLP4 156
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ADDRLP4 156
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTU4 3
+ADDRLP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+CVIU4 4
+MULU4
+CNSTU4 4
+ADDU4
+CNSTU4 1
+SUBU4
+CNSTU4 4294967292
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $1079
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1079
+LABELV $1074
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1076
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+272
+INDIRI4
+LTI4 $1073
+ADDRLP4 28
+INDIRI4
+CVIU4 4
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ADDU4
+ARGU4
+ADDRLP4 156
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRGP4 $1085
+JUMPV
+LABELV $1082
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1089
+JUMPV
+LABELV $1086
+ADDRLP4 164
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ADDRLP4 164
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTU4 3
+ADDRLP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+CVIU4 4
+MULU4
+CNSTU4 4
+ADDU4
+CNSTU4 1
+SUBU4
+CNSTU4 4294967292
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 AAS_ClusterReachabilityAreas
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1095
+JUMPV
+LABELV $1092
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 172
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 172
+INDIRI4
+LSHI4
+ADDRLP4 24
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 172
+INDIRI4
+LSHI4
+ADDRGP4 routetabletravelflags
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 AAS_GetAreaRoutingCache
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 184
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+CVIU4 4
+ADDRLP4 184
+INDIRI4
+LSHU4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ADDRLP4 184
+INDIRI4
+LSHU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+CVIU4 4
+CNSTI4 1
+LSHU4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1093
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1095
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $1092
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 botimport+60
+INDIRP4
+CALLI4
+pop
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 AAS_RemoveRoutingCacheInCluster
+CALLV
+pop
+LABELV $1087
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1089
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+272
+INDIRI4
+LTI4 $1086
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1100
+JUMPV
+LABELV $1097
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 routetabletravelflags
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+256
+INDIRI4
+MULI4
+CNSTI4 1
+LSHI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 AAS_PortalToPortalTravelTimes
+CALLV
+pop
+ADDRGP4 routingcachesize
+INDIRI4
+ADDRGP4 max_routingcachesize
+INDIRI4
+LEI4 $1106
+ADDRLP4 168
+ADDRGP4 max_routingcachesize
+INDIRI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 8
+DIVI4
+SUBI4
+ARGI4
+ADDRGP4 AAS_FreeOldestCaches
+CALLI4
+pop
+ADDRGP4 $1106
+JUMPV
+LABELV $1105
+ADDRLP4 168
+ADDRGP4 AAS_FreeOldestCache
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $1108
+ADDRGP4 $1107
+JUMPV
+LABELV $1108
+LABELV $1106
+ADDRLP4 168
+ADDRGP4 AvailableMemory
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 1048576
+LTI4 $1105
+LABELV $1107
+LABELV $1098
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1100
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+256
+INDIRI4
+LTI4 $1097
+ADDRLP4 28
+ADDRGP4 aasworld+256
+INDIRI4
+ADDRGP4 aasworld+256
+INDIRI4
+MULI4
+CVIU4 4
+CNSTI4 1
+LSHU4
+CNSTU4 4
+ADDU4
+CNSTU4 1
+SUBU4
+CNSTU4 4294967292
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 botimport+60
+INDIRP4
+CALLI4
+pop
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1083
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1085
+ADDRLP4 20
+INDIRI4
+CVIU4 4
+CNSTU4 2
+LTU4 $1082
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $1115
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRLP4 164
+ADDRGP4 botimport
+INDIRP4
+CALLI4
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRGP4 $1117
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 164
+INDIRI4
+ADDRLP4 136
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $1038
+endproc AAS_WriteRouteTables 192 16
+export AAS_ReadRouteTables
+proc AAS_ReadRouteTables 176 16
+ADDRLP4 68
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $1050
+ARGP4
+ADDRGP4 aasworld+88
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 68
+ARGP4
+ADDRLP4 60
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 140
+ADDRGP4 botimport+52
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $1121
+CNSTI4 0
+RETI4
+ADDRGP4 $1118
+JUMPV
+LABELV $1121
+ADDRLP4 20
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 botimport+56
+INDIRP4
+CALLI4
+pop
+ADDRLP4 20
+INDIRI4
+CNSTI4 1111577682
+EQI4 $1124
+ADDRGP4 $1126
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 AAS_Error
+CALLV
+pop
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1118
+JUMPV
+LABELV $1124
+ADDRLP4 20+4
+INDIRI4
+CNSTI4 1
+EQI4 $1128
+ADDRGP4 $1131
+ARGP4
+ADDRLP4 20+4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 AAS_Error
+CALLV
+pop
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1118
+JUMPV
+LABELV $1128
+ADDRLP4 20+8
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+NEI4 $1155
+ADDRLP4 20+12
+INDIRI4
+ADDRGP4 aasworld+272
+INDIRI4
+NEI4 $1155
+ADDRLP4 20+16
+INDIRI4
+ADDRGP4 aasworld+256
+INDIRI4
+NEI4 $1155
+ADDRLP4 20+28
+INDIRI4
+CNSTI4 0
+LEI4 $1155
+ADDRLP4 20+28
+INDIRI4
+CVIU4 4
+CNSTU4 2
+GTU4 $1155
+ADDRGP4 aasworld+220
+INDIRP4
+ARGP4
+CNSTU4 48
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRLP4 144
+ADDRGP4 CRC_ProcessString
+CALLI4
+ASGNI4
+ADDRLP4 20+20
+INDIRI4
+ADDRLP4 144
+INDIRI4
+CVIU4 4
+CVUU2 4
+CVUI4 2
+NEI4 $1155
+ADDRGP4 aasworld+276
+INDIRP4
+ARGP4
+ADDRGP4 aasworld+272
+INDIRI4
+CVIU4 4
+CNSTI4 4
+LSHU4
+CVUI4 4
+ARGI4
+ADDRLP4 148
+ADDRGP4 CRC_ProcessString
+CALLI4
+ASGNI4
+ADDRLP4 20+24
+INDIRI4
+ADDRLP4 148
+INDIRI4
+CVIU4 4
+CVUU2 4
+CVUI4 2
+EQI4 $1134
+LABELV $1155
+CNSTI4 2
+ARGI4
+ADDRGP4 $1157
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1118
+JUMPV
+LABELV $1134
+ADDRLP4 152
+ADDRGP4 AAS_RouteTableSize
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CVIU4 4
+ADDRLP4 20+28
+INDIRI4
+CVIU4 4
+ADDRLP4 132
+INDIRI4
+CVIU4 4
+CNSTU4 4
+ADDU4
+MULU4
+CNSTU4 32
+ADDU4
+EQU4 $1159
+CNSTI4 2
+ARGI4
+ADDRGP4 $1163
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1118
+JUMPV
+LABELV $1159
+ADDRLP4 52
+ARGP4
+ADDRLP4 20+28
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+CVUI4 4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 botimport+56
+INDIRP4
+CALLI4
+pop
+ADDRLP4 64
+ADDRLP4 20+28
+INDIRI4
+CVIU4 4
+ADDRGP4 aasworld+272
+INDIRI4
+CVIU4 4
+CNSTI4 3
+LSHU4
+CNSTU4 16
+ADDU4
+MULU4
+CVUI4 4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 64
+INDIRI4
+CVIU4 4
+CNSTU4 4
+ADDU4
+CNSTU4 1
+SUBU4
+CNSTU4 4294967292
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 20+28
+INDIRI4
+ADDRLP4 132
+INDIRI4
+MULI4
+ADDI4
+CVIU4 4
+ARGU4
+ADDRLP4 156
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 20+28
+INDIRI4
+ADDRLP4 132
+INDIRI4
+MULI4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 botimport+56
+INDIRP4
+CALLI4
+pop
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+ADDRGP4 aasworld+500
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+496
+ADDRLP4 20+28
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20+28
+INDIRI4
+CVIU4 4
+CNSTI4 4
+LSHU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1180
+JUMPV
+LABELV $1177
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+500
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 52
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 aasworld+272
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 aasworld+272
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $1178
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1180
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+496
+INDIRI4
+LTI4 $1177
+ADDRLP4 8
+ADDRLP4 64
+INDIRI4
+ADDRGP4 aasworld+500
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1189
+JUMPV
+LABELV $1186
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+500
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1195
+JUMPV
+LABELV $1192
+ADDRLP4 164
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 164
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CVIU4 4
+CNSTI4 1
+LSHU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTU4 3
+ADDRLP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+CVIU4 4
+MULU4
+CNSTU4 4
+ADDU4
+CNSTU4 1
+SUBU4
+CNSTU4 4294967292
+BANDU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $1193
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1195
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+272
+INDIRI4
+LTI4 $1192
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 aasworld+256
+INDIRI4
+ADDRGP4 aasworld+256
+INDIRI4
+MULI4
+CVIU4 4
+CNSTI4 1
+LSHU4
+CNSTU4 4
+ADDU4
+CNSTU4 1
+SUBU4
+CNSTU4 4294967292
+BANDU4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $1187
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1189
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+496
+INDIRI4
+LTI4 $1186
+CNSTI4 0
+ARGI4
+ADDRGP4 $1201
+ARGP4
+ADDRGP4 aasworld+496
+INDIRI4
+ARGI4
+ADDRLP4 68
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1118
+endproc AAS_ReadRouteTables 176 16
+proc AAS_RouteTablePortalTravelTime 68 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1204
+ADDRLP4 36
+CNSTI4 12
+ASGNI4
+CNSTI4 28
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+NEGI4
+ADDRGP4 aasworld+256
+INDIRI4
+MULI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRP4
+ADDP4
+INDIRU2
+CVUI4 2
+RETI4
+ADDRGP4 $1203
+JUMPV
+LABELV $1204
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 20
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 AAS_ClusterAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $1210
+CNSTI4 0
+RETI4
+ADDRGP4 $1203
+JUMPV
+LABELV $1210
+ADDRLP4 24
+ADDRLP4 32
+INDIRI4
+ADDRLP4 28
+INDIRI4
+MULI4
+CNSTI4 1
+LSHI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $1215
+JUMPV
+LABELV $1212
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+268
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 AAS_ClusterAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $1218
+ADDRGP4 $1213
+JUMPV
+LABELV $1218
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 24
+INDIRP4
+ADDP4
+INDIRU2
+CVUI4 2
+CNSTI4 0
+NEI4 $1220
+ADDRGP4 $1213
+JUMPV
+LABELV $1220
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LSHI4
+ADDRLP4 24
+INDIRP4
+ADDP4
+INDIRU2
+CVUI4 2
+ADDRLP4 56
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 12
+INDIRI4
+EQI4 $1222
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+256
+INDIRI4
+MULI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ADDP4
+INDIRU2
+CVUI4 2
+CNSTI4 0
+NEI4 $1224
+ADDRGP4 $1213
+JUMPV
+LABELV $1224
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+484
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+256
+INDIRI4
+MULI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+ADDRLP4 64
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ADDP4
+INDIRU2
+CVUI4 2
+ADDI4
+ADDRLP4 64
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+LABELV $1222
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1231
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GEI4 $1229
+LABELV $1231
+ADDRLP4 16
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $1229
+LABELV $1213
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1215
+ADDRLP4 8
+INDIRI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $1212
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $1203
+endproc AAS_RouteTablePortalTravelTime 68 8
+proc AAS_RouteTableClusterExit 84 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+CNSTI4 -1
+ASGNI4
+ADDRLP4 56
+CNSTI4 4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 AAS_ClusterAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $1234
+CNSTI4 0
+RETI4
+ADDRGP4 $1232
+JUMPV
+LABELV $1234
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1239
+JUMPV
+LABELV $1236
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+268
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+NEI4 $1242
+ADDRGP4 $1237
+JUMPV
+LABELV $1242
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 AAS_ClusterAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $1244
+ADDRGP4 $1237
+JUMPV
+LABELV $1244
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+CNSTI4 1
+LSHI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+INDIRU2
+CVUI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1246
+ADDRGP4 $1237
+JUMPV
+LABELV $1246
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 AAS_RouteTablePortalTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $1248
+ADDRGP4 $1237
+JUMPV
+LABELV $1248
+ADDRLP4 72
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+484
+INDIRP4
+ADDP4
+INDIRI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+INDIRU1
+CVUI4 1
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1251
+ADDRLP4 44
+CNSTI4 44
+CNSTI4 28
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 AAS_AreaTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 80
+INDIRI4
+CVIU4 4
+CVUU2 4
+CVUI4 2
+ADDI4
+ASGNI4
+LABELV $1251
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $1257
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GEI4 $1255
+LABELV $1257
+ADDRLP4 48
+CNSTI4 28
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1255
+LABELV $1237
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1239
+ADDRLP4 16
+INDIRI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $1236
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+GEI4 $1259
+CNSTI4 0
+RETI4
+ADDRGP4 $1232
+JUMPV
+LABELV $1259
+ADDRFP4 28
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 24
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $1232
+endproc AAS_RouteTableClusterExit 84 16
+proc AAS_RouteTableRouteToGoalArea 92 32
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 28
+ASGNI4
+ADDRLP4 48
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+ADDRLP4 44
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 12
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 52
+INDIRI4
+GEI4 $1264
+ADDRLP4 4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $1264
+ADDRLP4 8
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+NEGI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1269
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1265
+LABELV $1269
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1265
+JUMPV
+LABELV $1264
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LEI4 $1270
+ADDRLP4 4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+GEI4 $1270
+ADDRLP4 8
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+NEGI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $1275
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1273
+LABELV $1275
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1273
+LABELV $1270
+LABELV $1265
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+LEI4 $1276
+ADDRLP4 4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+LEI4 $1276
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+508
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1278
+CNSTI4 -1
+RETI4
+ADDRGP4 $1261
+JUMPV
+LABELV $1278
+ADDRLP4 76
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 AAS_ClusterAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $1282
+CNSTI4 0
+RETI4
+ADDRGP4 $1261
+JUMPV
+LABELV $1282
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 AAS_ClusterAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GEI4 $1284
+ADDRLP4 36
+ADDRLP4 20
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+INDIRU2
+CVUI4 2
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $1286
+ADDRFP4 20
+INDIRP4
+CNSTI4 28
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ADDP4
+INDIRU1
+CVUI4 1
+ADDI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1289
+ADDRLP4 40
+CNSTI4 44
+ADDRFP4 20
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 AAS_AreaTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 88
+INDIRI4
+CVIU4 4
+CVUU2 4
+CVUI4 2
+ADDI4
+ASGNI4
+LABELV $1289
+ADDRFP4 16
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1261
+JUMPV
+LABELV $1286
+LABELV $1284
+LABELV $1276
+ADDRGP4 aasworld+504
+INDIRI4
+CNSTI4 0
+EQI4 $1292
+CNSTI4 -1
+RETI4
+ADDRGP4 $1261
+JUMPV
+LABELV $1292
+ADDRLP4 72
+CNSTI4 28
+ASGNI4
+ADDRLP4 76
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+ADDRLP4 72
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 72
+INDIRI4
+ADDRFP4 12
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1297
+ADDRLP4 8
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+NEGI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1297
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1300
+ADDRLP4 8
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+NEGI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 80
+ADDRGP4 AAS_RouteTableClusterExit
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $1303
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 AAS_RouteTableClusterExit
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+RETI4
+ADDRGP4 $1261
+JUMPV
+LABELV $1303
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 AAS_RouteTableClusterExit
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $1307
+ADDRLP4 24
+INDIRI4
+ADDRFP4 16
+INDIRP4
+INDIRI4
+GEI4 $1305
+LABELV $1307
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $1305
+CNSTI4 1
+RETI4
+ADDRGP4 $1261
+JUMPV
+LABELV $1300
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 AAS_RouteTableClusterExit
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+RETI4
+LABELV $1261
+endproc AAS_RouteTableRouteToGoalArea 92 32
+proc AAS_CacheRouteToGoalArea 116 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 routingcachesize
+INDIRI4
+ADDRGP4 max_routingcachesize
+INDIRI4
+LEI4 $1312
+ADDRLP4 56
+ADDRGP4 max_routingcachesize
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 8
+DIVI4
+SUBI4
+ARGI4
+ADDRGP4 AAS_FreeOldestCaches
+CALLI4
+pop
+ADDRGP4 $1312
+JUMPV
+LABELV $1311
+ADDRLP4 56
+ADDRGP4 AAS_FreeOldestCache
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $1314
+ADDRGP4 $1313
+JUMPV
+LABELV $1314
+LABELV $1312
+ADDRLP4 56
+ADDRGP4 AvailableMemory
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 1048576
+LTI4 $1311
+LABELV $1313
+ADDRLP4 60
+CNSTI4 28
+ASGNI4
+ADDRLP4 64
+CNSTI4 12
+ASGNI4
+ADDRLP4 16
+ADDRLP4 60
+INDIRI4
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 60
+INDIRI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 68
+INDIRI4
+GEI4 $1318
+ADDRLP4 48
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LEI4 $1318
+ADDRLP4 32
+CNSTI4 20
+ADDRLP4 16
+INDIRI4
+NEGI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $1323
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $1319
+LABELV $1323
+ADDRLP4 16
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $1319
+JUMPV
+LABELV $1318
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LEI4 $1324
+ADDRLP4 48
+INDIRI4
+ADDRLP4 72
+INDIRI4
+GEI4 $1324
+ADDRLP4 32
+CNSTI4 20
+ADDRLP4 48
+INDIRI4
+NEGI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $1329
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $1327
+LABELV $1329
+ADDRLP4 48
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $1327
+LABELV $1324
+LABELV $1319
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LEI4 $1330
+ADDRLP4 48
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LEI4 $1330
+ADDRLP4 16
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $1330
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRGP4 AAS_ClusterAreaRoute
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 AAS_ClusterAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 92
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ADDRLP4 92
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+LTI4 $1333
+CNSTI4 0
+RETI4
+ADDRGP4 $1308
+JUMPV
+LABELV $1333
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 20
+INDIRP4
+ADDP4
+INDIRU2
+CVUI4 2
+CNSTI4 0
+EQI4 $1335
+ADDRFP4 20
+INDIRP4
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+ADDP4
+INDIRU1
+CVUI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1338
+ADDRFP4 16
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 20
+INDIRP4
+ADDP4
+INDIRU2
+CVUI4 2
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1308
+JUMPV
+LABELV $1338
+ADDRLP4 44
+CNSTI4 44
+ADDRFP4 20
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 AAS_AreaTravelTime
+CALLI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 20
+INDIRP4
+ADDP4
+INDIRU2
+CVUI4 2
+ADDRLP4 96
+INDIRI4
+CVIU4 4
+CVUU2 4
+CVUI4 2
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1308
+JUMPV
+LABELV $1335
+LABELV $1330
+ADDRLP4 88
+CNSTI4 28
+ASGNI4
+ADDRLP4 92
+CNSTI4 12
+ASGNI4
+ADDRLP4 16
+ADDRLP4 88
+INDIRI4
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 88
+INDIRI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+GEI4 $1343
+ADDRLP4 32
+CNSTI4 20
+ADDRLP4 48
+INDIRI4
+NEGI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1343
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 AAS_GetPortalRoutingCache
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+GEI4 $1346
+ADDRFP4 16
+INDIRP4
+ADDRLP4 16
+INDIRI4
+NEGI4
+CNSTI4 1
+LSHI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDP4
+INDIRU2
+CVUI4 2
+ASGNI4
+ADDRFP4 20
+INDIRP4
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEGI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRP4
+ADDP4
+INDIRU1
+CVUI4 1
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1308
+JUMPV
+LABELV $1346
+ADDRLP4 28
+CNSTU2 0
+ASGNU2
+ADDRLP4 52
+CNSTI4 -1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1353
+JUMPV
+LABELV $1350
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+268
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDP4
+INDIRU2
+CVUI4 2
+CNSTI4 0
+NEI4 $1355
+ADDRGP4 $1351
+JUMPV
+LABELV $1355
+ADDRLP4 32
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRGP4 AAS_ClusterAreaRoute
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 AAS_ClusterAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $1358
+ADDRGP4 $1351
+JUMPV
+LABELV $1358
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 20
+INDIRP4
+ADDP4
+INDIRU2
+CVUI4 2
+CNSTI4 0
+NEI4 $1360
+ADDRGP4 $1351
+JUMPV
+LABELV $1360
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LSHI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDP4
+INDIRU2
+CVUI4 2
+ADDRLP4 4
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LSHI4
+ADDRLP4 20
+INDIRP4
+ADDP4
+INDIRU2
+CVUI4 2
+ADDI4
+CVIU4 4
+CVUU2 4
+ASGNU2
+ADDRLP4 8
+ADDRLP4 8
+INDIRU2
+CVUI4 2
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+484
+INDIRP4
+ADDP4
+INDIRI4
+ADDI4
+CVIU4 4
+CVUU2 4
+ASGNU2
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1363
+ADDRFP4 20
+INDIRP4
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+ADDP4
+INDIRU1
+CVUI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 44
+ADDRFP4 20
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 AAS_AreaTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRU2
+CVUI4 2
+ADDRLP4 112
+INDIRI4
+CVIU4 4
+CVUU2 4
+CVUI4 2
+ADDI4
+CVIU4 4
+CVUU2 4
+ASGNU2
+LABELV $1363
+ADDRLP4 112
+ADDRLP4 28
+INDIRU2
+CVUI4 2
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+EQI4 $1369
+ADDRLP4 8
+INDIRU2
+CVUI4 2
+ADDRLP4 112
+INDIRI4
+GEI4 $1367
+LABELV $1369
+ADDRLP4 52
+ADDRFP4 20
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 8
+INDIRU2
+ASGNU2
+LABELV $1367
+LABELV $1351
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1353
+ADDRLP4 24
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $1350
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+GEI4 $1370
+CNSTI4 0
+RETI4
+ADDRGP4 $1308
+JUMPV
+LABELV $1370
+ADDRFP4 20
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 28
+INDIRU2
+CVUI4 2
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $1308
+endproc AAS_CacheRouteToGoalArea 116 20
+export AAS_AreaRouteToGoalArea
+proc AAS_AreaRouteToGoalArea 44 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld+4
+INDIRI4
+CNSTI4 0
+NEI4 $1373
+CNSTI4 0
+RETI4
+ADDRGP4 $1372
+JUMPV
+LABELV $1373
+ADDRFP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+NEI4 $1376
+ADDRFP4 16
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1372
+JUMPV
+LABELV $1376
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $1381
+ADDRFP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $1378
+LABELV $1381
+ADDRGP4 botDeveloper
+INDIRI4
+CNSTI4 0
+EQI4 $1382
+CNSTI4 3
+ARGI4
+ADDRGP4 $1385
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $1382
+CNSTI4 0
+RETI4
+ADDRGP4 $1372
+JUMPV
+LABELV $1378
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $1389
+ADDRFP4 8
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $1386
+LABELV $1389
+ADDRGP4 botDeveloper
+INDIRI4
+CNSTI4 0
+EQI4 $1390
+CNSTI4 3
+ARGI4
+ADDRGP4 $1393
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $1390
+CNSTI4 0
+RETI4
+ADDRGP4 $1372
+JUMPV
+LABELV $1386
+ADDRLP4 16
+CNSTI4 28
+ASGNI4
+ADDRLP4 20
+CNSTI4 20
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $1398
+ADDRLP4 16
+INDIRI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $1394
+LABELV $1398
+CNSTI4 0
+RETI4
+ADDRGP4 $1372
+JUMPV
+LABELV $1394
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 AAS_AreaDoNotEnter
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $1401
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 AAS_AreaDoNotEnter
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $1399
+LABELV $1401
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+CNSTI4 8388608
+BORI4
+ASGNI4
+LABELV $1399
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 AAS_RouteTableForTravelFlags
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1402
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 AAS_RouteTableRouteToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1404
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1372
+JUMPV
+LABELV $1404
+LABELV $1402
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 AAS_CacheRouteToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1372
+endproc AAS_AreaRouteToGoalArea 44 24
+export AAS_AreaTravelTimeToGoalArea
+proc AAS_AreaTravelTimeToGoalArea 12 24
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 AAS_AreaRouteToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1407
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $1406
+JUMPV
+LABELV $1407
+CNSTI4 0
+RETI4
+LABELV $1406
+endproc AAS_AreaTravelTimeToGoalArea 12 24
+export AAS_AreaReachabilityToGoalArea
+proc AAS_AreaReachabilityToGoalArea 12 24
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 AAS_AreaRouteToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1410
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1409
+JUMPV
+LABELV $1410
+CNSTI4 0
+RETI4
+LABELV $1409
+endproc AAS_AreaReachabilityToGoalArea 12 24
+export AAS_PredictRoute
+proc AAS_PredictRoute 68 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 32
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 36
+ADDRFP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 40
+ADDRFP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1416
+JUMPV
+LABELV $1413
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 AAS_AreaReachabilityToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1418
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $1412
+JUMPV
+LABELV $1418
+ADDRLP4 8
+CNSTI4 44
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1421
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 AAS_TravelFlagForType_inline
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 36
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $1423
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 28
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 AAS_TravelFlagForType_inline
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 1
+RETI4
+ADDRGP4 $1412
+JUMPV
+LABELV $1423
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 AAS_AreaContentsTravelFlags_inline
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRFP4 36
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $1426
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 28
+ADDRLP4 8
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 AAS_AreaContentsTravelFlags_inline
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 AAS_AreaTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+CVIU4 4
+CVUU2 4
+CVUI4 2
+ADDI4
+ASGNI4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRU2
+CVUI4 2
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1412
+JUMPV
+LABELV $1426
+LABELV $1421
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+492
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1433
+JUMPV
+LABELV $1430
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $1434
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1435
+JUMPV
+LABELV $1434
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+488
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1435
+ADDRFP4 28
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1437
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+ADDRFP4 32
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $1439
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 AAS_AreaTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+CVIU4 4
+CVUU2 4
+CVUI4 2
+ADDI4
+ASGNI4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRU2
+CVUI4 2
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1412
+JUMPV
+LABELV $1439
+LABELV $1437
+ADDRFP4 28
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $1443
+ADDRLP4 4
+INDIRI4
+ADDRFP4 40
+INDIRI4
+NEI4 $1445
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 1
+RETI4
+ADDRGP4 $1412
+JUMPV
+LABELV $1445
+LABELV $1443
+LABELV $1431
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1433
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+LTI4 $1430
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 AAS_AreaTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+CVIU4 4
+CVUU2 4
+CVUI4 2
+ADDI4
+ASGNI4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRU2
+CVUI4 2
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 28
+ADDRLP4 8
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 AAS_TravelFlagForType_inline
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $1449
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRFP4 24
+INDIRI4
+LEI4 $1449
+ADDRGP4 $1415
+JUMPV
+LABELV $1449
+LABELV $1414
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1416
+ADDRLP4 20
+INDIRI4
+ADDRFP4 12
+INDIRI4
+EQI4 $1452
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1453
+ADDRLP4 24
+INDIRI4
+ADDRFP4 20
+INDIRI4
+GEI4 $1452
+LABELV $1453
+ADDRLP4 24
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $1413
+LABELV $1452
+LABELV $1415
+ADDRLP4 20
+INDIRI4
+ADDRFP4 12
+INDIRI4
+EQI4 $1454
+CNSTI4 0
+RETI4
+ADDRGP4 $1412
+JUMPV
+LABELV $1454
+CNSTI4 1
+RETI4
+LABELV $1412
+endproc AAS_PredictRoute 68 16
+export AAS_BridgeWalkable
+proc AAS_BridgeWalkable 0 0
+CNSTI4 0
+RETI4
+LABELV $1456
+endproc AAS_BridgeWalkable 0 0
+export AAS_ReachabilityFromNum
+proc AAS_ReachabilityFromNum 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld+4
+INDIRI4
+CNSTI4 0
+NEI4 $1458
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 44
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $1457
+JUMPV
+LABELV $1458
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1464
+ADDRFP4 0
+INDIRI4
+ADDRGP4 aasworld+232
+INDIRI4
+LTI4 $1461
+LABELV $1464
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 44
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $1457
+JUMPV
+LABELV $1461
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 44
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ARGP4
+CNSTU4 44
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1457
+endproc AAS_ReachabilityFromNum 4 12
+export AAS_NextAreaReachability
+proc AAS_NextAreaReachability 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld+4
+INDIRI4
+CNSTI4 0
+NEI4 $1467
+CNSTI4 0
+RETI4
+ADDRGP4 $1466
+JUMPV
+LABELV $1467
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $1473
+ADDRFP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $1470
+LABELV $1473
+CNSTI4 3
+ARGI4
+ADDRGP4 $1475
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1466
+JUMPV
+LABELV $1470
+ADDRLP4 0
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1477
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $1466
+JUMPV
+LABELV $1477
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+GEI4 $1479
+CNSTI4 4
+ARGI4
+ADDRGP4 $1482
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1466
+JUMPV
+LABELV $1479
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDI4
+LTI4 $1483
+CNSTI4 0
+RETI4
+ADDRGP4 $1466
+JUMPV
+LABELV $1483
+ADDRFP4 4
+INDIRI4
+RETI4
+LABELV $1466
+endproc AAS_NextAreaReachability 12 12
+export AAS_NextModelReachability
+proc AAS_NextModelReachability 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $1486
+ADDRFP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1487
+JUMPV
+LABELV $1486
+ADDRFP4 0
+INDIRI4
+ADDRGP4 aasworld+232
+INDIRI4
+LTI4 $1488
+CNSTI4 0
+RETI4
+ADDRGP4 $1485
+JUMPV
+LABELV $1488
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1487
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $1494
+JUMPV
+LABELV $1491
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 16777215
+BANDI4
+CNSTI4 11
+NEI4 $1496
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1497
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1485
+JUMPV
+LABELV $1496
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 16777215
+BANDI4
+CNSTI4 19
+NEI4 $1502
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 65535
+BANDI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1505
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1485
+JUMPV
+LABELV $1505
+LABELV $1502
+LABELV $1497
+LABELV $1492
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1494
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+232
+INDIRI4
+LTI4 $1491
+CNSTI4 0
+RETI4
+LABELV $1485
+endproc AAS_NextModelReachability 4 0
+export AAS_RandomGoalArea
+proc AAS_RandomGoalArea 128 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $1509
+CNSTI4 0
+RETI4
+ADDRGP4 $1508
+JUMPV
+LABELV $1509
+ADDRLP4 96
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 aasworld+216
+INDIRI4
+CVIF4 4
+ADDRLP4 96
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1515
+JUMPV
+LABELV $1512
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $1517
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1517
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $1519
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1519
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $1522
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+LEI4 $1525
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 AAS_AreaSwim
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+EQI4 $1527
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 48
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 1
+RETI4
+ADDRGP4 $1508
+JUMPV
+LABELV $1527
+ADDRLP4 8
+CNSTI4 48
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ARGP4
+ADDRLP4 116
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+NEI4 $1531
+ADDRGP4 $1533
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8+4
+INDIRF4
+ARGF4
+ADDRLP4 8+8
+INDIRF4
+ARGF4
+ADDRGP4 Log_Write
+CALLV
+pop
+LABELV $1531
+ADDRLP4 80
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 80+8
+ADDRLP4 80+8
+INDIRF4
+CNSTF4 1133903872
+SUBF4
+ASGNF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 80
+ARGP4
+CNSTI4 4
+ARGI4
+CNSTI4 -1
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $1537
+ADDRLP4 20+4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1537
+ADDRLP4 20+8
+ARGP4
+ADDRLP4 120
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1537
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 AAS_AreaGroundFaceArea
+CALLF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 1133903872
+LEF4 $1541
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 20+8
+INDIRB
+ASGNB 12
+CNSTI4 1
+RETI4
+ADDRGP4 $1508
+JUMPV
+LABELV $1541
+LABELV $1537
+LABELV $1525
+LABELV $1522
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1513
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1515
+ADDRLP4 4
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $1512
+CNSTI4 0
+RETI4
+LABELV $1508
+endproc AAS_RandomGoalArea 128 24
+export AAS_AreaVisible
+proc AAS_AreaVisible 0 0
+CNSTI4 0
+RETI4
+LABELV $1544
+endproc AAS_AreaVisible 0 0
+export DistancePointToLine
+proc DistancePointToLine 32 16
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AAS_ProjectPointOntoVector
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+RETF4
+LABELV $1545
+endproc DistancePointToLine 32 16
+bss
+align 4
+LABELV $1551
+skip 4
+export AAS_NearestHideArea
+code
+proc AAS_NearestHideArea 196 16
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $1551
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1552
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+CNSTI4 1
+LSHU4
+ARGU4
+ADDRLP4 100
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRGP4 $1551
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRGP4 $1553
+JUMPV
+LABELV $1552
+ADDRGP4 $1551
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+CNSTI4 1
+LSHU4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $1553
+ADDRLP4 68
+CNSTU2 0
+ASGNU2
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+ADDRLP4 76
+ADDRFP4 24
+INDIRI4
+BCOMI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 44
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRGP4 aasworld+448
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+464
+INDIRP4
+ADDP4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTU2 0
+ASGNU2
+ADDRLP4 20
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 92
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $1559
+JUMPV
+LABELV $1558
+ADDRLP4 20
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1561
+ADDRLP4 20
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $1562
+JUMPV
+LABELV $1561
+ADDRLP4 88
+CNSTP4 0
+ASGNP4
+LABELV $1562
+ADDRLP4 92
+ADDRLP4 20
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 112
+CNSTI4 28
+ASGNI4
+ADDRLP4 116
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 112
+INDIRI4
+ADDRLP4 116
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 44
+ADDRLP4 112
+INDIRI4
+ADDRLP4 116
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1569
+JUMPV
+LABELV $1566
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 AAS_TravelFlagForType_inline
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRLP4 76
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $1570
+ADDRGP4 $1567
+JUMPV
+LABELV $1570
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 AAS_AreaContentsTravelFlags_inline
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+ADDRLP4 76
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $1572
+ADDRGP4 $1567
+JUMPV
+LABELV $1572
+ADDRLP4 24
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 20
+INDIRI4
+NEI4 $1574
+ADDRGP4 $1567
+JUMPV
+LABELV $1574
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 AAS_AreaTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 20
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRU2
+CVUI4 2
+ADDRLP4 132
+INDIRI4
+CVIU4 4
+CVUU2 4
+CVUI4 2
+ADDI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRU2
+CVUI4 2
+ADDI4
+CVIU4 4
+CVUU2 4
+ASGNU2
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 AAS_ProjectPointOntoVector
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1576
+ADDRLP4 140
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 140
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+ADDRLP4 140
+INDIRI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDP4
+INDIRF4
+LEF4 $1583
+ADDRLP4 144
+INDIRF4
+ADDRLP4 140
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRF4
+GTF4 $1582
+LABELV $1583
+ADDRLP4 148
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 148
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 148
+INDIRI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDP4
+INDIRF4
+GEF4 $1580
+ADDRLP4 152
+INDIRF4
+ADDRLP4 148
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRF4
+GEF4 $1580
+LABELV $1582
+ADDRGP4 $1578
+JUMPV
+LABELV $1580
+LABELV $1577
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1576
+LABELV $1578
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+GEI4 $1584
+ADDRLP4 44
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44+4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $1585
+JUMPV
+LABELV $1584
+ADDRLP4 44
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44+4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $1585
+ADDRLP4 44
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1109393408
+GEF4 $1592
+ADDRGP4 $1567
+JUMPV
+LABELV $1592
+ADDRLP4 32
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32+4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+ARGP4
+ADDRLP4 168
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 64
+INDIRF4
+GEF4 $1596
+ADDRLP4 176
+ADDRLP4 28
+INDIRU2
+CVUI4 2
+CVIF4 4
+CNSTF4 1092616192
+ADDRLP4 64
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 180
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+LTF4 $1599
+ADDRLP4 172
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1600
+JUMPV
+LABELV $1599
+ADDRLP4 172
+ADDRLP4 176
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1600
+ADDRLP4 28
+ADDRLP4 172
+INDIRU4
+CVUU2 4
+ASGNU2
+LABELV $1596
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $1601
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 172
+ADDRGP4 AAS_AreaVisible
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $1601
+ADDRGP4 $1567
+JUMPV
+LABELV $1601
+ADDRLP4 176
+ADDRLP4 68
+INDIRU2
+CVUI4 2
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $1603
+ADDRLP4 28
+INDIRU2
+CVUI4 2
+ADDRLP4 176
+INDIRI4
+LTI4 $1603
+ADDRGP4 $1567
+JUMPV
+LABELV $1603
+ADDRLP4 180
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRGP4 $1551
+INDIRP4
+ADDP4
+INDIRU2
+CVUI4 2
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $1607
+ADDRLP4 180
+INDIRI4
+ADDRLP4 28
+INDIRU2
+CVUI4 2
+LEI4 $1605
+LABELV $1607
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 AAS_AreaVisible
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+NEI4 $1608
+ADDRLP4 68
+ADDRLP4 28
+INDIRU2
+ASGNU2
+ADDRLP4 96
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $1608
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRGP4 $1551
+INDIRP4
+ADDP4
+ADDRLP4 28
+INDIRU2
+ASGNU2
+ADDRLP4 56
+CNSTI4 44
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 aasworld+448
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 28
+INDIRU2
+ASGNU2
+ADDRLP4 56
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 56
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1611
+ADDRLP4 56
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1613
+ADDRLP4 88
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $1614
+JUMPV
+LABELV $1613
+ADDRLP4 92
+ADDRLP4 56
+INDIRP4
+ASGNP4
+LABELV $1614
+ADDRLP4 88
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1611
+LABELV $1605
+LABELV $1567
+ADDRLP4 72
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+LABELV $1569
+ADDRLP4 72
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LTI4 $1566
+LABELV $1559
+ADDRLP4 92
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1558
+ADDRLP4 96
+INDIRI4
+RETI4
+LABELV $1550
+endproc AAS_NearestHideArea 196 16
+bss
+export routingqueuesorted
+align 4
+LABELV routingqueuesorted
+skip 4
+export routingcacheevictedbytes
+align 4
+LABELV routingcacheevictedbytes
+skip 4
+export routingcacheevictions
+align 4
+LABELV routingcacheevictions
+skip 4
+export routingcachemisses
+align 4
+LABELV routingcachemisses
+skip 4
+export routingcachehits
+align 4
+LABELV routingcachehits
+skip 4
+export routingcacheslabsize
+align 4
+LABELV routingcacheslabsize
+skip 4
+export max_routingcachesize
+align 4
+LABELV max_routingcachesize
+skip 4
+export routingcachesize
+align 4
+LABELV routingcachesize
+skip 4
+export numportalcacherelaxations
+align 4
+LABELV numportalcacherelaxations
+skip 4
+export numareacacherelaxations
+align 4
+LABELV numareacacherelaxations
+skip 4
+export numportalcacheupdates
+align 4
+LABELV numportalcacheupdates
+skip 4
+export numareacacheupdates
+align 4
+LABELV numareacacheupdates
+skip 4
+export routingcacheclasses
+align 4
+LABELV routingcacheclasses
+skip 1664
+import aassettings
+import AAS_PrintFreeBSPLinks
+import AAS_EntityCollision
+import AAS_BSPLinkEntity
+import AAS_UnlinkFromBSPLeaves
+import AAS_DumpBSPData
+import AAS_LoadBSPFile
+import AAS_FileInfo
+import AAS_DumpAASData
+import AAS_FreeAASLump
+import AAS_WriteCompactAASFile
+import AAS_WriteAASFile
+import AAS_LoadCompactAASFile
+import AAS_LoadAASFile
+import AAS_ShutdownAlternativeRouting
+import AAS_InitAlternativeRouting
+import AAS_BestReachableLinkArea
+import AAS_ContinueInitReachability
+import AAS_InitReachability
+import AAS_SetViewPortalsAsClusterPortals
+import AAS_InitClustering
+import AAS_SampleBenchmark
+import AAS_FreeFlatNodes
+import AAS_InitFlatNodes
+import AAS_FreeReachabilityAreaGrid
+import AAS_InitReachabilityAreaGrid
+import AAS_UnlinkFromAreas
+import AAS_InsideFace
+import AAS_PointInsideFace
+import AAS_LinkEntityClientBBox
+import AAS_AASLinkEntity
+import AAS_PlaneFromNum
+import AAS_TraceEndFace
+import AAS_AreaGroundFace
+import AAS_FreeAASLinkedEntities
+import AAS_FreeAASLinkHeap
+import AAS_InitAASLinkedEntities
+import AAS_InitAASLinkHeap
+import AAS_UpdateEntities
+import AAS_UpdateEntity
+import AAS_ResetEntityLinks
+import AAS_UnlinkInvalidEntities
+import AAS_InvalidateEntities
+import AAS_StartFrame
+import AAS_LoadMap
+import AAS_Shutdown
+import AAS_Setup
+import AAS_SetInitialized
+import AAS_Error
+import aasworld
+import botDeveloper
+import botimport
+import botlibglobals
+import AAS_InitSettings
+import AAS_DropToFloor
+import AAS_SetMovedir
+import AAS_HorizontalVelocityForJump
+import AAS_BFGJumpZVelocity
+import AAS_RocketJumpZVelocity
+import AAS_AgainstLadder
+import AAS_JumpReachRunStart
+import AAS_Swimming
+import AAS_OnGround
+import AAS_PlayerMovementHitBBox
+import AAS_PredictPlayerMovement
+import AAS_IntForBSPEpairKey
+import AAS_FloatForBSPEpairKey
+import AAS_VectorForBSPEpairKey
+import AAS_ValueForBSPEpairKey
+import AAS_NextBSPEntity
+import AAS_BSPModelMinsMaxsOrigin
+import AAS_BoxEntities
+import AAS_AreasConnected
+import AAS_inPHS
+import AAS_inPVS
+import AAS_PointContents
+import AAS_Trace
+import AAS_Optimize
+import AAS_FloodAreas
+import AAS_ShowReachableAreas
+import AAS_ShowReachability
+import AAS_DrawArrow
+import AAS_PrintTravelType
+import AAS_DrawCross
+import AAS_ShowAreaPolygons
+import AAS_ShowArea
+import AAS_ShowFace
+import AAS_ShowBoundingBox
+import AAS_DrawPlaneCross
+import AAS_DrawPermanentCross
+import AAS_PermanentLine
+import AAS_DebugLine
+import AAS_ClearShownPolygons
+import AAS_ClearShownDebugLines
+import AAS_AlternativeRouteGoals
+import AAS_AreaDoNotEnter
+import AAS_AreaJumpPad
+import AAS_AreaLadder
+import AAS_AreaGrounded
+import AAS_AreaSlime
+import AAS_AreaLava
+import AAS_AreaLiquid
+import AAS_AreaSwim
+import AAS_AreaCrouch
+import AAS_AreaGroundFaceArea
+import AAS_BestReachableFromJumpPadArea
+import AAS_BestReachableArea
+import AAS_AreaReachability
+import AAS_FacePlane
+import AAS_PointReachabilityAreaIndex
+import AAS_PointAreaNum
+import AAS_AreaInfo
+import AAS_PointInsideArea
+import AAS_BBoxReachabilityAreas
+import AAS_BBoxAreas
+import AAS_TraceAreas
+import AAS_TracePlayerBBox
+import AAS_PointPresenceType
+import AAS_AreaPresenceType
+import AAS_AreaCluster
+import AAS_PresenceTypeBoundingBox
+import AAS_ProjectPointOntoVector
+import AAS_Time
+import AAS_Loaded
+import AAS_Initialized
+import GetBotLibAPI
+import LibVarSetNotModified
+import LibVarChanged
+import LibVarSet
+import LibVarString
+import LibVarValue
+import LibVar
+import LibVarGetValue
+import LibVarGetString
+import LibVarGet
+import LibVarDeAllocAll
+import CRC_ContinueProcessString
+import CRC_ProcessString
+import CRC_Value
+import CRC_ProcessByte
+import CRC_Init
+import Log_Flush
+import Log_FileHandle
+import Log_WriteTimeStamped
+import Log_Write
+import Log_Shutdown
+import Log_Close
+import Log_Open
+import DumpMemory
+import MemoryByteSize
+import PrintMemoryLabels
+import PrintUsedMemorySize
+import AvailableMemory
+import FreeMemory
+import GetClearedHunkMemory
+import GetHunkMemory
+import GetClearedMemory
+import GetMemory
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1533
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 63
+byte 1 0
+align 1
+LABELV $1482
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 78
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 45
+byte 1 62
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 0
+align 1
+LABELV $1475
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 78
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1393
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 111
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1385
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 111
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1201
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1163
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1157
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1131
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1126
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1117
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 10
+byte 1 0
+align 1
+LABELV $1115
+byte 1 10
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1050
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 114
+byte 1 116
+byte 1 98
+byte 1 0
+align 1
+LABELV $1048
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1043
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $744
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $730
+byte 1 49
+byte 1 0
+align 1
+LABELV $729
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 113
+byte 1 117
+byte 1 101
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $728
+byte 1 52
+byte 1 48
+byte 1 57
+byte 1 54
+byte 1 0
+align 1
+LABELV $727
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $636
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $632
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $620
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $618
+byte 1 10
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $574
+byte 1 85
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $569
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 114
+byte 1 99
+byte 1 100
+byte 1 0
+align 1
+LABELV $524
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 67
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $324
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 50
+byte 1 56
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $251
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 69
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 82
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $70
+byte 1 37
+byte 1 56
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 53
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 53
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $62
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 75
+byte 1 66
+byte 1 10
+byte 1 0
+align 1
+LABELV $60
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 75
+byte 1 66
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 75
+byte 1 66
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $58
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 75
+byte 1 66
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $56
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $51
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 37
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $48
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $43
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $42
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $41
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $36
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 120
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $34
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $29
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 120
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $27
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
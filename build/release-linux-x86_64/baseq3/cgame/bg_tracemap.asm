@@ -0,0 +1,5429 @@
+data
+align 4
+LABELV $97
+byte 4 0
+align 4
+LABELV $98
+byte 4 0
+export BG_GenerateTracemap
+code
+proc BG_GenerateTracemap 1308 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $99
+ARGP4
+ADDRLP4 208
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 208
+ARGP4
+ADDRLP4 1232
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1232
+INDIRI4
+CNSTI4 0
+NEI4 $100
+ADDRGP4 $102
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $96
+JUMPV
+LABELV $100
+ADDRLP4 1244
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1244
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 1244
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+EQF4 $103
+ADDRGP4 $105
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $96
+JUMPV
+LABELV $103
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRGP4 $106
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 tracemap
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 786460
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 128
+CNSTI4 -65536
+ASGNI4
+ADDRLP4 108
+CNSTI4 65536
+ASGNI4
+ADDRLP4 1256
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 140
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ADDRLP4 1256
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 1260
+CNSTI4 4
+ASGNI4
+ADDRLP4 112
+ADDRFP4 8
+INDIRP4
+ADDRLP4 1260
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1260
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 1256
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $107
+ADDRLP4 1264
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 1264
+INDIRF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 1264
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $111
+ADDRLP4 1268
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 112
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 1268
+INDIRF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 1268
+INDIRF4
+ASGNF4
+ADDRLP4 72+8
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 84+8
+CNSTF4 3347054592
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 1272
+CNSTP4 0
+ASGNP4
+ADDRLP4 1272
+INDIRP4
+ARGP4
+ADDRLP4 1272
+INDIRP4
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTI4 4095
+ARGI4
+CNSTI4 57
+ARGI4
+ADDRFP4 12
+INDIRP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 72+8
+ADDRLP4 4+12+8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 1276
+ADDRGP4 $98
+ASGNP4
+ADDRLP4 1276
+INDIRP4
+ADDRLP4 1276
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $123
+JUMPV
+LABELV $122
+ADDRLP4 72+8
+INDIRF4
+CNSTF4 3347054592
+GTF4 $125
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $124
+JUMPV
+LABELV $125
+ADDRLP4 84+8
+INDIRF4
+CNSTF4 3347054592
+GTF4 $129
+ADDRLP4 84+8
+CNSTF4 3347054336
+ASGNF4
+LABELV $129
+ADDRLP4 4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 1280
+CNSTP4 0
+ASGNP4
+ADDRLP4 1280
+INDIRP4
+ARGP4
+ADDRLP4 1280
+INDIRP4
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTI4 4095
+ARGI4
+CNSTI4 57
+ARGI4
+ADDRFP4 12
+INDIRP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1284
+ADDRGP4 $98
+ASGNP4
+ADDRLP4 1284
+INDIRP4
+ADDRLP4 1284
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+EQI4 $133
+ADDRLP4 72+8
+ADDRLP4 72+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRGP4 $134
+JUMPV
+LABELV $133
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $137
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $124
+JUMPV
+LABELV $137
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ADDRLP4 4+12+8
+INDIRF4
+ASGNF4
+ADDRLP4 4+48
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+NEI4 $124
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRI4
+CVIF4 4
+LEF4 $147
+ADDRLP4 128
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $147
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+GEF4 $124
+ADDRLP4 108
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $124
+JUMPV
+LABELV $134
+LABELV $123
+ADDRGP4 $122
+JUMPV
+LABELV $124
+ADDRLP4 1280
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 100
+ADDRLP4 1280
+INDIRI4
+ASGNI4
+ADDRLP4 1284
+ADDRGP4 $97
+INDIRI4
+ASGNI4
+ADDRLP4 1284
+INDIRI4
+ADDRLP4 100
+INDIRI4
+GTI4 $157
+ADDRLP4 1284
+INDIRI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 500
+SUBI4
+GTI4 $155
+LABELV $157
+ADDRGP4 $97
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 1292
+ADDRLP4 68
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 1292
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1292
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $98
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $155
+LABELV $112
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $111
+LABELV $108
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 256
+LTI4 $107
+ADDRGP4 $158
+ARGP4
+ADDRLP4 1264
+ADDRLP4 68
+INDIRI4
+CNSTI4 8
+LSHI4
+ASGNI4
+ADDRLP4 1264
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1264
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $98
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $159
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 124
+CNSTI4 -65536
+ASGNI4
+ADDRLP4 116
+CNSTI4 65536
+ASGNI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $160
+ADDRLP4 1268
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 1268
+INDIRF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 1268
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $164
+ADDRLP4 1272
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 112
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 1272
+INDIRF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 1272
+INDIRF4
+ASGNF4
+ADDRLP4 72+8
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 84+8
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 72+8
+INDIRF4
+CNSTF4 3347054592
+NEF4 $178
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRGP4 $174
+JUMPV
+LABELV $177
+ADDRLP4 72+8
+INDIRF4
+CNSTF4 1199570944
+LTF4 $180
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRGP4 $179
+JUMPV
+LABELV $180
+ADDRLP4 84+8
+INDIRF4
+CNSTF4 1199570944
+LTF4 $184
+ADDRLP4 84+8
+CNSTF4 1199570688
+ASGNF4
+LABELV $184
+ADDRLP4 4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 1276
+CNSTP4 0
+ASGNP4
+ADDRLP4 1276
+INDIRP4
+ARGP4
+ADDRLP4 1276
+INDIRP4
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTI4 4095
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRFP4 12
+INDIRP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1280
+ADDRGP4 $98
+ASGNP4
+ADDRLP4 1280
+INDIRP4
+ADDRLP4 1280
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+EQI4 $188
+ADDRLP4 4+48
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $191
+ADDRLP4 4+12
+ARGP4
+CNSTI4 4095
+ARGI4
+ADDRLP4 1284
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1284
+INDIRI4
+CNSTI4 57
+BANDI4
+CNSTI4 0
+NEI4 $194
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 4+12+8
+INDIRF4
+ASGNF4
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 124
+INDIRI4
+CVIF4 4
+LEF4 $200
+ADDRLP4 124
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $200
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRI4
+CVIF4 4
+GEF4 $179
+ADDRLP4 116
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $179
+JUMPV
+LABELV $194
+ADDRLP4 72+8
+ADDRLP4 4+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRGP4 $189
+JUMPV
+LABELV $191
+ADDRLP4 72+8
+ADDRLP4 4+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRGP4 $189
+JUMPV
+LABELV $188
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $214
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRGP4 $179
+JUMPV
+LABELV $214
+ADDRLP4 4+48
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $218
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 4+12+8
+INDIRF4
+ASGNF4
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 124
+INDIRI4
+CVIF4 4
+LEF4 $224
+ADDRLP4 124
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $224
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRI4
+CVIF4 4
+GEF4 $179
+ADDRLP4 116
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $179
+JUMPV
+LABELV $218
+ADDRLP4 72+8
+ADDRLP4 4+12+8
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+ASGNF4
+LABELV $189
+LABELV $178
+ADDRGP4 $177
+JUMPV
+LABELV $179
+LABELV $174
+ADDRLP4 1276
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 100
+ADDRLP4 1276
+INDIRI4
+ASGNI4
+ADDRLP4 1280
+ADDRGP4 $97
+INDIRI4
+ASGNI4
+ADDRLP4 1280
+INDIRI4
+ADDRLP4 100
+INDIRI4
+GTI4 $237
+ADDRLP4 1280
+INDIRI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 500
+SUBI4
+GTI4 $235
+LABELV $237
+ADDRGP4 $97
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 1288
+ADDRLP4 68
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 1288
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1288
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $98
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $235
+LABELV $165
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $164
+LABELV $161
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 256
+LTI4 $160
+ADDRGP4 $158
+ARGP4
+ADDRLP4 1268
+ADDRLP4 68
+INDIRI4
+CNSTI4 8
+LSHI4
+ASGNI4
+ADDRLP4 1268
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1268
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $98
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $238
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 120
+CNSTI4 65536
+ASGNI4
+ADDRLP4 136
+CNSTI4 -65536
+ASGNI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $239
+ADDRLP4 1272
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 1272
+INDIRF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 1272
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $243
+ADDRLP4 1276
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 112
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 1276
+INDIRF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 1276
+INDIRF4
+ASGNF4
+ADDRLP4 72+8
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 84+8
+CNSTF4 3347054592
+ASGNF4
+ADDRLP4 1280
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1284
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1280
+INDIRI4
+ADDRLP4 1284
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+NEF4 $251
+ADDRLP4 1280
+INDIRI4
+ADDRLP4 1284
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+EQF4 $251
+ADDRLP4 4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 1288
+CNSTP4 0
+ASGNP4
+ADDRLP4 1288
+INDIRP4
+ARGP4
+ADDRLP4 1288
+INDIRP4
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTI4 4095
+ARGI4
+CNSTI4 57
+ARGI4
+ADDRFP4 12
+INDIRP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1292
+ADDRGP4 $98
+ASGNP4
+ADDRLP4 1292
+INDIRP4
+ADDRLP4 1292
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $255
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $252
+JUMPV
+LABELV $255
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 4+12+8
+INDIRF4
+ASGNF4
+ADDRGP4 $252
+JUMPV
+LABELV $251
+ADDRLP4 1288
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1292
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1288
+INDIRI4
+ADDRLP4 1292
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 1288
+INDIRI4
+ADDRLP4 1292
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $252
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+EQF4 $264
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 136
+INDIRI4
+CVIF4 4
+LEF4 $267
+ADDRLP4 136
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $267
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 120
+INDIRI4
+CVIF4 4
+GEF4 $271
+ADDRLP4 120
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $271
+LABELV $264
+ADDRLP4 1288
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 100
+ADDRLP4 1288
+INDIRI4
+ASGNI4
+ADDRLP4 1292
+ADDRGP4 $97
+INDIRI4
+ASGNI4
+ADDRLP4 1292
+INDIRI4
+ADDRLP4 100
+INDIRI4
+GTI4 $277
+ADDRLP4 1292
+INDIRI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 500
+SUBI4
+GTI4 $275
+LABELV $277
+ADDRGP4 $97
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 1300
+ADDRLP4 68
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 1300
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1300
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $98
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $275
+LABELV $244
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $243
+LABELV $240
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 256
+LTI4 $239
+ADDRGP4 $158
+ARGP4
+ADDRLP4 1272
+ADDRLP4 68
+INDIRI4
+CNSTI4 8
+LSHI4
+ASGNI4
+ADDRLP4 1272
+INDIRI4
+ARGI4
+CNSTI4 65536
+ARGI4
+CNSTF4 1120403456
+ADDRLP4 1272
+INDIRI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+MULF4
+ARGF4
+ADDRGP4 $98
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 132
+CNSTF4 1132331008
+ADDRLP4 128
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+CNSTF4 0
+NEF4 $278
+ADDRLP4 132
+CNSTF4 1065353216
+ASGNF4
+LABELV $278
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $280
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $284
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+LTF4 $288
+ADDRLP4 1276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1280
+ADDRLP4 68
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1276
+INDIRI4
+ADDRLP4 1280
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ADDRLP4 1276
+INDIRI4
+ADDRLP4 1280
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 132
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $288
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $293
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $294
+JUMPV
+LABELV $293
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $297
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 1132396544
+ASGNF4
+LABELV $297
+LABELV $294
+LABELV $285
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $284
+LABELV $281
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 256
+LTI4 $280
+ADDRLP4 132
+CNSTF4 1132331008
+ADDRLP4 136
+INDIRI4
+ADDRLP4 120
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+CNSTF4 0
+NEF4 $301
+ADDRLP4 132
+CNSTF4 1065353216
+ASGNF4
+LABELV $301
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $303
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $307
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 120
+INDIRI4
+CVIF4 4
+LTF4 $311
+ADDRLP4 1276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1280
+ADDRLP4 68
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1276
+INDIRI4
+ADDRLP4 1280
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 1276
+INDIRI4
+ADDRLP4 1280
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 120
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 132
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $311
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $316
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $317
+JUMPV
+LABELV $316
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $320
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1132396544
+ASGNF4
+LABELV $320
+LABELV $317
+LABELV $308
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $307
+LABELV $304
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 256
+LTI4 $303
+ADDRLP4 124
+INDIRI4
+ADDRLP4 116
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $324
+ADDRLP4 132
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $325
+JUMPV
+LABELV $324
+ADDRLP4 132
+CNSTF4 1132331008
+ADDRLP4 124
+INDIRI4
+ADDRLP4 116
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $325
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $326
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $330
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+NEF4 $334
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $335
+JUMPV
+LABELV $334
+ADDRLP4 1276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1280
+ADDRLP4 68
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1276
+INDIRI4
+ADDRLP4 1280
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 1276
+INDIRI4
+ADDRLP4 1280
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRLP4 132
+INDIRF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $335
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $340
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $341
+JUMPV
+LABELV $340
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $344
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1132396544
+ASGNF4
+LABELV $344
+LABELV $341
+LABELV $331
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $330
+LABELV $327
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 256
+LTI4 $326
+ADDRLP4 144
+ARGP4
+ADDRLP4 1276
+ADDRGP4 Q_strlwr
+CALLP4
+ASGNP4
+ADDRGP4 $348
+ARGP4
+ADDRLP4 1276
+INDIRP4
+ARGP4
+ADDRLP4 1280
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1280
+INDIRP4
+ARGP4
+ADDRLP4 104
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 0
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 0
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 2
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 0
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 0
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 0
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 0
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 0
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 0
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 0
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 0
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 0
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 0
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 1
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 0
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 1
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 32
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 0
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $349
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $353
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $357
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GEI4 $357
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $354
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+GTI4 $354
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $367
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $367
+address $361
+address $362
+address $363
+address $364
+address $365
+address $366
+code
+LABELV $361
+ADDRLP4 108
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRGP4 $354
+JUMPV
+LABELV $362
+ADDRLP4 128
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRGP4 $354
+JUMPV
+LABELV $363
+ADDRLP4 120
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRGP4 $354
+JUMPV
+LABELV $364
+ADDRLP4 136
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRGP4 $354
+JUMPV
+LABELV $365
+ADDRLP4 116
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRGP4 $354
+JUMPV
+LABELV $366
+ADDRLP4 124
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRGP4 $354
+JUMPV
+LABELV $357
+ADDRLP4 1288
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 68
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1292
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1288
+INDIRF4
+ADDRLP4 1292
+INDIRF4
+LTF4 $370
+ADDRLP4 1284
+ADDRLP4 1288
+INDIRF4
+ADDRLP4 1292
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $371
+JUMPV
+LABELV $370
+ADDRLP4 1284
+ADDRLP4 1288
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $371
+ADDRLP4 96
+ADDRLP4 1284
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 68
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+NEF4 $372
+ADDRLP4 96
+CNSTU1 0
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRGP4 $373
+JUMPV
+LABELV $372
+ADDRLP4 1300
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 68
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1304
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1300
+INDIRF4
+ADDRLP4 1304
+INDIRF4
+LTF4 $377
+ADDRLP4 1296
+ADDRLP4 1300
+INDIRF4
+ADDRLP4 1304
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $378
+JUMPV
+LABELV $377
+ADDRLP4 1296
+ADDRLP4 1300
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $378
+ADDRLP4 96
+ADDRLP4 1296
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+LABELV $373
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 68
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+NEF4 $379
+ADDRLP4 96
+CNSTU1 0
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 0
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRGP4 $380
+JUMPV
+LABELV $379
+ADDRLP4 1300
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 68
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1304
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 1300
+INDIRF4
+ADDRLP4 1304
+INDIRF4
+LTF4 $384
+ADDRLP4 1296
+ADDRLP4 1300
+INDIRF4
+ADDRLP4 1304
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $385
+JUMPV
+LABELV $384
+ADDRLP4 1296
+ADDRLP4 1300
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $385
+ADDRLP4 96
+ADDRLP4 1296
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 96
+CNSTU1 255
+ASGNU1
+ADDRLP4 96
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+LABELV $380
+LABELV $354
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $353
+LABELV $350
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 256
+LTI4 $349
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRGP4 $386
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLI4
+pop
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $96
+endproc BG_GenerateTracemap 1308 28
+export BG_LoadTraceMap
+proc BG_LoadTraceMap 1180 12
+ADDRLP4 1132
+CNSTI4 -65536
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1132
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1132
+INDIRI4
+ASGNI4
+ADDRLP4 1136
+CNSTI4 65536
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1136
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1136
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1136
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1136
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 1068
+ARGP4
+ADDRLP4 1140
+ADDRGP4 Q_strlwr
+CALLP4
+ASGNP4
+ADDRGP4 $348
+ARGP4
+ADDRLP4 1140
+INDIRP4
+ARGP4
+ADDRLP4 1144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1148
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 1148
+INDIRI4
+CNSTI4 0
+LTI4 $388
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $390
+ADDRLP4 1056
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLI4
+pop
+LABELV $391
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+LTI4 $390
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $394
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $398
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $402
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GEI4 $402
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $404
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+GTI4 $404
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $430
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $430
+address $406
+address $410
+address $414
+address $418
+address $422
+address $426
+code
+LABELV $406
+ADDRLP4 1156
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $405
+JUMPV
+LABELV $410
+ADDRLP4 1160
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $405
+JUMPV
+LABELV $414
+ADDRLP4 1164
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1164
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $405
+JUMPV
+LABELV $418
+ADDRLP4 1168
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1168
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1168
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1168
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1168
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $405
+JUMPV
+LABELV $422
+ADDRLP4 1172
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1172
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1172
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1172
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1172
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $405
+JUMPV
+LABELV $426
+ADDRLP4 1176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1176
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+ADDRLP4 1176
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 1176
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 1176
+INDIRI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+LABELV $404
+LABELV $405
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+ADDRGP4 $399
+JUMPV
+LABELV $402
+ADDRLP4 1152
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $435
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+LABELV $435
+ADDRLP4 1156
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+INDIRI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 1156
+INDIRI4
+ADDRLP4 8+1
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $441
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+LABELV $441
+ADDRLP4 1160
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ADDRLP4 1160
+INDIRI4
+ADDRLP4 8+2
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $447
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+LABELV $447
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8+3
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 0
+NEI4 $451
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 255
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+CNSTF4 3347054592
+ASGNF4
+LABELV $451
+LABELV $399
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $398
+LABELV $395
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $394
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 1052
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $456
+ADDRLP4 1032
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $457
+JUMPV
+LABELV $456
+ADDRLP4 1032
+CNSTF4 1132331008
+ADDRLP4 1052
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $457
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $458
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $462
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3347054592
+EQF4 $466
+ADDRLP4 1152
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 1032
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+LABELV $466
+LABELV $463
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $462
+LABELV $459
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $458
+ADDRLP4 1064
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $471
+ADDRLP4 1032
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $472
+JUMPV
+LABELV $471
+ADDRLP4 1032
+CNSTF4 1132331008
+ADDRLP4 1064
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $472
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $473
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $477
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+EQF4 $481
+ADDRLP4 1152
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+ADDRLP4 1044
+INDIRI4
+CVIF4 4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 1032
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+LABELV $481
+LABELV $478
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $477
+LABELV $474
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $473
+ADDRLP4 1060
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+SUBI4
+CNSTI4 0
+NEI4 $486
+ADDRLP4 1032
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $487
+JUMPV
+LABELV $486
+ADDRLP4 1032
+CNSTF4 1132331008
+ADDRLP4 1060
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $487
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $488
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $492
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1199570944
+EQF4 $496
+ADDRLP4 1152
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1156
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ADDRLP4 1152
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 1032
+INDIRF4
+DIVF4
+ADDF4
+ASGNF4
+LABELV $496
+LABELV $493
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $492
+LABELV $489
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 256
+LTI4 $488
+ADDRGP4 $389
+JUMPV
+LABELV $388
+ADDRLP4 1068
+ARGP4
+ADDRLP4 1152
+ADDRGP4 Q_strlwr
+CALLP4
+ASGNP4
+ADDRGP4 $348
+ARGP4
+ADDRLP4 1152
+INDIRP4
+ARGP4
+ADDRLP4 1156
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $501
+ARGP4
+ADDRLP4 1156
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 1160
+CNSTI4 0
+ASGNI4
+ADDRGP4 tracemap
+ADDRLP4 1160
+INDIRI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+RETI4
+ADDRGP4 $387
+JUMPV
+LABELV $389
+ADDRGP4 tracemap+786436
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 tracemap+786436+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 tracemap+786444
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 tracemap+786444+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1152
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 1156
+CNSTF4 1132462080
+ASGNF4
+ADDRGP4 one_over_mapgrid_factor
+ADDRLP4 1152
+INDIRF4
+ADDRGP4 tracemap+786444
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRLP4 1156
+INDIRF4
+DIVF4
+DIVF4
+ASGNF4
+ADDRGP4 one_over_mapgrid_factor+4
+ADDRLP4 1152
+INDIRF4
+ADDRGP4 tracemap+786444+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRLP4 1156
+INDIRF4
+DIVF4
+DIVF4
+ASGNF4
+ADDRGP4 tracemap+786452
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRGP4 tracemap+786456
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRLP4 1160
+CNSTI4 1
+ASGNI4
+ADDRGP4 tracemap
+ADDRLP4 1160
+INDIRI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+RETI4
+LABELV $387
+endproc BG_LoadTraceMap 1180 12
+proc BG_ClampPointToTracemapExtends 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+GEF4 $518
+ADDRFP4 4
+INDIRP4
+ADDRGP4 tracemap+786436
+INDIRF4
+ASGNF4
+ADDRGP4 $519
+JUMPV
+LABELV $518
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 tracemap+786444
+INDIRF4
+LEF4 $522
+ADDRFP4 4
+INDIRP4
+ADDRGP4 tracemap+786444
+INDIRF4
+ASGNF4
+ADDRGP4 $523
+JUMPV
+LABELV $522
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $523
+LABELV $519
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 tracemap+786444+4
+INDIRF4
+GEF4 $526
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 tracemap+786444+4
+INDIRF4
+ASGNF4
+ADDRGP4 $527
+JUMPV
+LABELV $526
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+LEF4 $532
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+ASGNF4
+ADDRGP4 $533
+JUMPV
+LABELV $532
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $533
+LABELV $527
+LABELV $517
+endproc BG_ClampPointToTracemapExtends 4 0
+export BG_GetSkyHeightAtPoint
+proc BG_GetSkyHeightAtPoint 16 8
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $539
+CNSTF4 1199570944
+RETF4
+ADDRGP4 $538
+JUMPV
+LABELV $539
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_ClampPointToTracemapExtends
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor+4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 etpro_FinalizeTracemapClamp
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+4
+ADDP4
+ADDP4
+INDIRF4
+RETF4
+LABELV $538
+endproc BG_GetSkyHeightAtPoint 16 8
+export BG_GetSkyGroundHeightAtPoint
+proc BG_GetSkyGroundHeightAtPoint 16 8
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $548
+CNSTF4 1199570944
+RETF4
+ADDRGP4 $547
+JUMPV
+LABELV $548
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_ClampPointToTracemapExtends
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor+4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 etpro_FinalizeTracemapClamp
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+262148
+ADDP4
+ADDP4
+INDIRF4
+RETF4
+LABELV $547
+endproc BG_GetSkyGroundHeightAtPoint 16 8
+export BG_GetGroundHeightAtPoint
+proc BG_GetGroundHeightAtPoint 16 8
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $557
+CNSTF4 3347054592
+RETF4
+ADDRGP4 $556
+JUMPV
+LABELV $557
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_ClampPointToTracemapExtends
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRGP4 tracemap+786436
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8+4
+INDIRF4
+ADDRGP4 tracemap+786436+4
+INDIRF4
+SUBF4
+ADDRGP4 one_over_mapgrid_factor+4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 etpro_FinalizeTracemapClamp
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 tracemap+524292
+ADDP4
+ADDP4
+INDIRF4
+RETF4
+LABELV $556
+endproc BG_GetGroundHeightAtPoint 16 8
+export BG_GetTracemapGroundFloor
+proc BG_GetTracemapGroundFloor 0 0
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $566
+CNSTI4 -65536
+RETI4
+ADDRGP4 $565
+JUMPV
+LABELV $566
+ADDRGP4 tracemap+786452
+INDIRI4
+RETI4
+LABELV $565
+endproc BG_GetTracemapGroundFloor 0 0
+export BG_GetTracemapGroundCeil
+proc BG_GetTracemapGroundCeil 0 0
+ADDRGP4 tracemap
+INDIRI4
+CNSTI4 0
+NEI4 $570
+CNSTI4 65536
+RETI4
+ADDRGP4 $569
+JUMPV
+LABELV $570
+ADDRGP4 tracemap+786456
+INDIRI4
+RETI4
+LABELV $569
+endproc BG_GetTracemapGroundCeil 0 0
+export etpro_FinalizeTracemapClamp
+proc etpro_FinalizeTracemapClamp 0 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $574
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $575
+JUMPV
+LABELV $574
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 255
+LEI4 $576
+ADDRFP4 0
+INDIRP4
+CNSTI4 255
+ASGNI4
+LABELV $576
+LABELV $575
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $578
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $579
+JUMPV
+LABELV $578
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 255
+LEI4 $580
+ADDRFP4 4
+INDIRP4
+CNSTI4 255
+ASGNI4
+LABELV $580
+LABELV $579
+LABELV $573
+endproc etpro_FinalizeTracemapClamp 0 0
+bss
+align 4
+LABELV one_over_mapgrid_factor
+skip 8
+align 4
+LABELV tracemap
+skip 786460
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_drawScores
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $501
+byte 1 68
+byte 1 69
+byte 1 66
+byte 1 85
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $386
+byte 1 84
+byte 1 82
+byte 1 85
+byte 1 69
+byte 1 86
+byte 1 73
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 45
+byte 1 88
+byte 1 70
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 46
+byte 1 0
+byte 1 0
+align 1
+LABELV $348
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $238
+byte 1 71
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $159
+byte 1 71
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $158
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 99
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 37
+byte 1 37
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $106
+byte 1 71
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $105
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 99
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $102
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $99
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
@@ -0,0 +1,5894 @@
+code
+proc CG_AddPolyToPool 64 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+CNSTI4 3
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_PB_FindFreePolyBuffer
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $98
+ADDRGP4 $97
+JUMPV
+LABELV $98
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 53304
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 28700
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $100
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 4
+LSHI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 3
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16400
+ADDP4
+ADDP4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 3
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16400
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24600
+ADDP4
+ADDP4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24600
+ADDP4
+ADDP4
+CNSTI4 1
+ADDP4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 21
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 52
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ADDRLP4 52
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24600
+ADDP4
+ADDP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 22
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24600
+ADDP4
+ADDP4
+CNSTI4 3
+ADDP4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 23
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28704
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $101
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $100
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+CNSTI4 53304
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 3
+ADDI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 4
+INDIRP4
+CNSTI4 28700
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 3
+ADDI4
+ASGNI4
+LABELV $97
+endproc CG_AddPolyToPool 64 12
+export CG_AtmosphericKludge
+proc CG_AtmosphericKludge 8 0
+ADDRGP4 kludgeChecked
+INDIRI4
+CNSTI4 0
+EQI4 $105
+ADDRGP4 kludgeResult
+INDIRI4
+RETI4
+ADDRGP4 $104
+JUMPV
+LABELV $105
+ADDRGP4 kludgeChecked
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 kludgeResult
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $104
+endproc CG_AtmosphericKludge 8 0
+proc CG_SetParticleActive 4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $110
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $111
+JUMPV
+LABELV $110
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $111
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $108
+endproc CG_SetParticleActive 4 0
+proc CG_RainParticleGenerate 76 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+CNSTF4 1148846080
+ADDRLP4 20
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRGP4 cg+512444+24
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+512444+24+4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 BG_GetSkyHeightAtPoint
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1199570944
+NEF4 $118
+CNSTI4 0
+RETI4
+ADDRGP4 $112
+JUMPV
+LABELV $118
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BG_GetSkyGroundHeightAtPoint
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+LTF4 $120
+CNSTI4 0
+RETI4
+ADDRGP4 $112
+JUMPV
+LABELV $120
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_atmFx+272088
+INDIRI4
+CNSTI4 0
+LEI4 $122
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 cg+512444+24+8
+INDIRF4
+SUBF4
+ADDRGP4 cg_atmFx+272088
+INDIRI4
+CVIF4 4
+LEF4 $125
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+512444+24+8
+INDIRF4
+ADDRGP4 cg_atmFx+272088
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+GEF4 $135
+CNSTI4 0
+RETI4
+ADDRGP4 $112
+JUMPV
+LABELV $135
+LABELV $125
+LABELV $122
+ADDRLP4 48
+CNSTI4 10000
+ASGNI4
+ADDRLP4 44
+CNSTF4 1056964608
+ADDRGP4 cg_atmFx+272028
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 981668463
+ADDRGP4 cg_atmFx+272028
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+ADDRLP4 48
+INDIRI4
+MODI4
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_atmFx+272148
+INDIRI4
+CVIF4 4
+ADDRLP4 44
+INDIRF4
+LEF4 $140
+CNSTI4 0
+RETI4
+ADDRGP4 $112
+JUMPV
+LABELV $140
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_SetParticleActive
+CALLI4
+pop
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1132396544
+CNSTF4 1045220557
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1132396544
+CNSTF4 1045220557
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1132396544
+CNSTF4 1045220557
+ADDRLP4 52
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 VectorNormalizeFast
+CALLV
+pop
+ADDRLP4 68
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 68
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1125515264
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 cg_atmFx+272092
+INDIRI4
+CNSTI4 1
+LEI4 $143
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 72
+INDIRI4
+ADDRGP4 cg_atmFx+272092
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_atmFx+272000
+ADDP4
+ASGNP4
+ADDRGP4 $144
+JUMPV
+LABELV $143
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 cg_atmFx+272000
+ASGNP4
+LABELV $144
+CNSTI4 1
+RETI4
+LABELV $112
+endproc CG_RainParticleGenerate 76 8
+proc CG_RainParticleCheckVisible 56 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $152
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $150
+LABELV $152
+CNSTI4 0
+RETI4
+ADDRGP4 $149
+JUMPV
+LABELV $150
+ADDRLP4 8
+CNSTF4 981668463
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg_atmFx+272024
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 BG_GetSkyGroundHeightAtPoint
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 40
+INDIRF4
+GEF4 $155
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_SetParticleActive
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+RETI4
+ADDRGP4 $149
+JUMPV
+LABELV $155
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 cg+512444+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 cg+512444+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1232348160
+LEF4 $163
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_SetParticleActive
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+RETI4
+ADDRGP4 $149
+JUMPV
+LABELV $163
+CNSTI4 1
+RETI4
+LABELV $149
+endproc CG_RainParticleCheckVisible 56 8
+proc CG_RainParticleRender 312 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $168
+ADDRGP4 $167
+JUMPV
+LABELV $168
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 CG_CullPoint
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $170
+ADDRGP4 $167
+JUMPV
+LABELV $170
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+512444+24
+ARGP4
+ADDRLP4 148
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 148
+INDIRF4
+ASGNF4
+ADDRLP4 84
+ARGP4
+ADDRLP4 152
+ADDRGP4 BG_GetSkyGroundHeightAtPoint
+CALLF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRLP4 116
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 136
+INDIRF4
+GTF4 $174
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 116
+ADDRLP4 160
+INDIRP4
+INDIRF4
+ADDRLP4 136
+INDIRF4
+SUBF4
+ADDRLP4 84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 84
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRLP4 160
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 84+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRLP4 160
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 84+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $174
+ADDRLP4 116
+INDIRF4
+CNSTF4 0
+GTF4 $182
+ADDRGP4 $167
+JUMPV
+LABELV $182
+ADDRLP4 120
+INDIRF4
+CNSTF4 1182793728
+GEF4 $184
+ADDRLP4 120
+CNSTF4 1061158912
+ADDRLP4 120
+INDIRF4
+CNSTF4 1182793728
+DIVF4
+MULF4
+CNSTF4 1048576000
+ADDF4
+ASGNF4
+ADDRGP4 $185
+JUMPV
+LABELV $184
+ADDRLP4 120
+CNSTF4 1065353216
+ASGNF4
+LABELV $185
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 156
+ADDRLP4 116
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 84
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 116
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 160
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 160
+INDIRF4
+ADDRGP4 cg+512444+36+12
+INDIRF4
+MULF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg+512444+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg+512444+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 108+4
+ADDRLP4 160
+INDIRF4
+ADDRGP4 cg+512444+36+24
+INDIRF4
+MULF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg+512444+36+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg+512444+36+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+ADDRGP4 cg+512444+36+12
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72+4
+ADDRGP4 cg+512444+36+12+4
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72+8
+ADDRGP4 cg+512444+36+12+8
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 108
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 72
+INDIRF4
+ADDRGP4 cg+512444+36+24
+INDIRF4
+ADDRLP4 164
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 72+4
+INDIRF4
+ADDRGP4 cg+512444+36+24+4
+INDIRF4
+ADDRLP4 164
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+8
+ADDRLP4 72+8
+INDIRF4
+ADDRGP4 cg+512444+36+24+8
+INDIRF4
+ADDRLP4 108
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+ADDRLP4 124
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 176
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ADDRLP4 176
+INDIRF4
+LTF4 $255
+ADDRLP4 168
+ADDRLP4 172
+INDIRF4
+ADDRLP4 176
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $256
+JUMPV
+LABELV $255
+ADDRLP4 168
+ADDRLP4 172
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $256
+ADDRLP4 0+20
+ADDRLP4 168
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 188
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 184
+INDIRF4
+ADDRLP4 188
+INDIRF4
+LTF4 $260
+ADDRLP4 180
+ADDRLP4 184
+INDIRF4
+ADDRLP4 188
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $261
+JUMPV
+LABELV $260
+ADDRLP4 180
+ADDRLP4 184
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $261
+ADDRLP4 0+20+1
+ADDRLP4 180
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 200
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 196
+INDIRF4
+ADDRLP4 200
+INDIRF4
+LTF4 $265
+ADDRLP4 192
+ADDRLP4 196
+INDIRF4
+ADDRLP4 200
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $266
+JUMPV
+LABELV $265
+ADDRLP4 192
+ADDRLP4 196
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $266
+ADDRLP4 0+20+2
+ADDRLP4 192
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 208
+CNSTF4 1120403456
+ADDRLP4 120
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 212
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 212
+INDIRF4
+LTF4 $270
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+ADDRLP4 212
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $271
+JUMPV
+LABELV $270
+ADDRLP4 204
+ADDRLP4 208
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $271
+ADDRLP4 0+20+3
+ADDRLP4 204
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+24
+ADDRLP4 84
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 220
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 224
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 224
+INDIRF4
+LTF4 $289
+ADDRLP4 216
+ADDRLP4 220
+INDIRF4
+ADDRLP4 224
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $290
+JUMPV
+LABELV $289
+ADDRLP4 216
+ADDRLP4 220
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $290
+ADDRLP4 0+24+20
+ADDRLP4 216
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 232
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 236
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+LTF4 $295
+ADDRLP4 228
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $296
+JUMPV
+LABELV $295
+ADDRLP4 228
+ADDRLP4 232
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $296
+ADDRLP4 0+24+20+1
+ADDRLP4 228
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 244
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 248
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 248
+INDIRF4
+LTF4 $301
+ADDRLP4 240
+ADDRLP4 244
+INDIRF4
+ADDRLP4 248
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $302
+JUMPV
+LABELV $301
+ADDRLP4 240
+ADDRLP4 244
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $302
+ADDRLP4 0+48+20+2
+ADDRLP4 240
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 256
+CNSTF4 1128792064
+ADDRLP4 120
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 260
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 256
+INDIRF4
+ADDRLP4 260
+INDIRF4
+LTF4 $307
+ADDRLP4 252
+ADDRLP4 256
+INDIRF4
+ADDRLP4 260
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $308
+JUMPV
+LABELV $307
+ADDRLP4 252
+ADDRLP4 256
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $308
+ADDRLP4 0+24+20+3
+ADDRLP4 252
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+48
+ADDRLP4 84
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 268
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 272
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+LTF4 $326
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $327
+JUMPV
+LABELV $326
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $327
+ADDRLP4 0+48+20
+ADDRLP4 264
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 280
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 284
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 280
+INDIRF4
+ADDRLP4 284
+INDIRF4
+LTF4 $332
+ADDRLP4 276
+ADDRLP4 280
+INDIRF4
+ADDRLP4 284
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $333
+JUMPV
+LABELV $332
+ADDRLP4 276
+ADDRLP4 280
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $333
+ADDRLP4 0+48+20+1
+ADDRLP4 276
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 296
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+LTF4 $338
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $339
+JUMPV
+LABELV $338
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $339
+ADDRLP4 0+48+20+2
+ADDRLP4 288
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 304
+CNSTF4 1128792064
+ADDRLP4 120
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 308
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 304
+INDIRF4
+ADDRLP4 308
+INDIRF4
+LTF4 $344
+ADDRLP4 300
+ADDRLP4 304
+INDIRF4
+ADDRLP4 308
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $345
+JUMPV
+LABELV $344
+ADDRLP4 300
+ADDRLP4 304
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $345
+ADDRLP4 0+48+20+3
+ADDRLP4 300
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddPolyToPool
+CALLV
+pop
+LABELV $167
+endproc CG_RainParticleRender 312 8
+proc CG_SnowParticleGenerate 68 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+CNSTF4 1148846080
+ADDRLP4 20
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRGP4 cg+512444+24
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+512444+24+4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 BG_GetSkyHeightAtPoint
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1199570944
+NEF4 $352
+CNSTI4 0
+RETI4
+ADDRGP4 $346
+JUMPV
+LABELV $352
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BG_GetSkyGroundHeightAtPoint
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+LTF4 $354
+CNSTI4 0
+RETI4
+ADDRGP4 $346
+JUMPV
+LABELV $354
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_atmFx+272088
+INDIRI4
+CNSTI4 0
+LEI4 $356
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 cg+512444+24+8
+INDIRF4
+SUBF4
+ADDRGP4 cg_atmFx+272088
+INDIRI4
+CVIF4 4
+LEF4 $359
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+512444+24+8
+INDIRF4
+ADDRGP4 cg_atmFx+272088
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+GEF4 $369
+CNSTI4 0
+RETI4
+ADDRGP4 $346
+JUMPV
+LABELV $369
+LABELV $359
+LABELV $356
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_SetParticleActive
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+CNSTF4 1103626240
+CNSTF4 1073741824
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 VectorNormalizeFast
+CALLV
+pop
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1077936128
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg_atmFx+272092
+INDIRI4
+CNSTI4 1
+LEI4 $371
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg_atmFx+272092
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_atmFx+272000
+ADDP4
+ASGNP4
+ADDRGP4 $372
+JUMPV
+LABELV $371
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 cg_atmFx+272000
+ASGNP4
+LABELV $372
+CNSTI4 1
+RETI4
+LABELV $346
+endproc CG_SnowParticleGenerate 68 8
+proc CG_SnowParticleCheckVisible 56 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $380
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $378
+LABELV $380
+CNSTI4 0
+RETI4
+ADDRGP4 $377
+JUMPV
+LABELV $378
+ADDRLP4 8
+CNSTF4 981668463
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg_atmFx+272024
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 BG_GetSkyGroundHeightAtPoint
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+GEF4 $383
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_SetParticleActive
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+RETI4
+ADDRGP4 $377
+JUMPV
+LABELV $383
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 cg+512444+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 cg+512444+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1232348160
+LEF4 $391
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_SetParticleActive
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+RETI4
+ADDRGP4 $377
+JUMPV
+LABELV $391
+CNSTI4 1
+RETI4
+LABELV $377
+endproc CG_SnowParticleCheckVisible 56 8
+proc CG_SnowParticleRender 212 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $396
+ADDRGP4 $395
+JUMPV
+LABELV $396
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 CG_CullPoint
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $398
+ADDRGP4 $395
+JUMPV
+LABELV $398
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+CNSTF4 1023410176
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 160
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 160
+INDIRF4
+ASGNF4
+CNSTF4 1023410176
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 168
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 172
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 176
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 84
+INDIRF4
+ADDRLP4 172
+INDIRF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 144
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 172
+INDIRF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ARGP4
+ADDRLP4 184
+ADDRGP4 BG_GetSkyGroundHeightAtPoint
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 184
+INDIRF4
+ASGNF4
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 140
+INDIRF4
+GTF4 $401
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 120
+ADDRLP4 192
+INDIRP4
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+ADDRLP4 84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 84
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 192
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 84+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 192
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 84+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $401
+ADDRLP4 120
+INDIRF4
+CNSTF4 0
+GTF4 $409
+ADDRGP4 $395
+JUMPV
+LABELV $409
+ADDRLP4 108
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 cg+512444+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 cg+512444+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+512444+24
+ARGP4
+ADDRLP4 192
+ADDRGP4 DistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+CNSTF4 1215570944
+LEF4 $419
+ADDRLP4 136
+CNSTF4 908576172
+ADDRLP4 136
+INDIRF4
+CNSTF4 1215570944
+SUBF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRGP4 $420
+JUMPV
+LABELV $419
+ADDRLP4 136
+CNSTF4 1065353216
+ASGNF4
+LABELV $420
+ADDRLP4 120
+ADDRLP4 120
+INDIRF4
+ADDRLP4 136
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 196
+ADDRLP4 120
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 84
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 196
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 196
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 120
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 200
+INDIRF4
+ADDRGP4 cg+512444+36+12
+INDIRF4
+MULF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg+512444+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg+512444+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 108+4
+ADDRLP4 200
+INDIRF4
+ADDRGP4 cg+512444+36+24
+INDIRF4
+MULF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg+512444+36+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg+512444+36+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+ADDRGP4 cg+512444+36+12
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72+4
+ADDRGP4 cg+512444+36+12+4
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72+8
+ADDRGP4 cg+512444+36+12+8
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 204
+ADDRLP4 108
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 72
+INDIRF4
+ADDRGP4 cg+512444+36+24
+INDIRF4
+ADDRLP4 204
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 72+4
+INDIRF4
+ADDRGP4 cg+512444+36+24+4
+INDIRF4
+ADDRLP4 204
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72+8
+ADDRLP4 72+8
+INDIRF4
+ADDRGP4 cg+512444+36+24+8
+INDIRF4
+ADDRLP4 108
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 116
+ADDRLP4 136
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 208
+ADDRLP4 116
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 124
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 208
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 124+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 208
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 124+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 116
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24
+ADDRLP4 84
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 116
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 116
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48
+ADDRLP4 84
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 116
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddPolyToPool
+CALLV
+pop
+LABELV $395
+endproc CG_SnowParticleRender 212 8
+proc CG_EffectGust 32 0
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg_atmFx+272044
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg_atmFx+272064
+INDIRI4
+ADDI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg_atmFx+272068
+INDIRI4
+ADDRGP4 cg_atmFx+272064
+INDIRI4
+SUBI4
+MODI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg_atmFx+272060
+INDIRI4
+ADDRGP4 cg_atmFx+272056
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $563
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $564
+JUMPV
+LABELV $563
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $564
+ADDRGP4 cg_atmFx+272032
+ADDRGP4 cg_atmFx+272044
+INDIRI4
+ADDRGP4 cg_atmFx+272056
+INDIRI4
+ADDI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg_atmFx+272052
+INDIRI4
+ADDRGP4 cg_atmFx+272048
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $571
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $572
+JUMPV
+LABELV $571
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $572
+ADDRGP4 cg_atmFx+272036
+ADDRGP4 cg_atmFx+272032
+INDIRI4
+ADDRGP4 cg_atmFx+272048
+INDIRI4
+ADDI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg_atmFx+272060
+INDIRI4
+ADDRGP4 cg_atmFx+272056
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $579
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 28
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $580
+JUMPV
+LABELV $579
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $580
+ADDRGP4 cg_atmFx+272040
+ADDRGP4 cg_atmFx+272036
+INDIRI4
+ADDRGP4 cg_atmFx+272056
+INDIRI4
+ADDI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $551
+endproc CG_EffectGust 32 0
+proc CG_EffectGustCurrent 16 0
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg_atmFx+272044
+INDIRI4
+GEI4 $582
+ADDRFP4 0
+INDIRP4
+ADDRGP4 cg_atmFx+272096
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+ADDRGP4 cg_atmFx+272072
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRGP4 cg_atmFx+272080
+INDIRI4
+ASGNI4
+ADDRGP4 $583
+JUMPV
+LABELV $582
+ADDRLP4 0
+ADDRGP4 cg_atmFx+272108
+INDIRF4
+ADDRGP4 cg_atmFx+272096
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRGP4 cg_atmFx+272108+4
+INDIRF4
+ADDRGP4 cg_atmFx+272096+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 cg_atmFx+272108+8
+INDIRF4
+ADDRGP4 cg_atmFx+272096+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg_atmFx+272032
+INDIRI4
+GEI4 $601
+ADDRLP4 12
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg_atmFx+272044
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg_atmFx+272032
+INDIRI4
+ADDRGP4 cg_atmFx+272044
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRGP4 cg_atmFx+272096
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg_atmFx+272096+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg_atmFx+272096+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRGP4 cg_atmFx+272072
+INDIRF4
+ADDRGP4 cg_atmFx+272076
+INDIRF4
+ADDRGP4 cg_atmFx+272072
+INDIRF4
+SUBF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRGP4 cg_atmFx+272080
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_atmFx+272084
+INDIRI4
+ADDRGP4 cg_atmFx+272080
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $602
+JUMPV
+LABELV $601
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg_atmFx+272036
+INDIRI4
+GEI4 $622
+ADDRFP4 0
+INDIRP4
+ADDRGP4 cg_atmFx+272108
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+ADDRGP4 cg_atmFx+272076
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRGP4 cg_atmFx+272084
+INDIRI4
+ASGNI4
+ADDRGP4 $623
+JUMPV
+LABELV $622
+ADDRLP4 12
+CNSTF4 1065353216
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg_atmFx+272036
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg_atmFx+272040
+INDIRI4
+ADDRGP4 cg_atmFx+272036
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRGP4 cg_atmFx+272096
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg_atmFx+272096+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg_atmFx+272096+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRGP4 cg_atmFx+272072
+INDIRF4
+ADDRGP4 cg_atmFx+272076
+INDIRF4
+ADDRGP4 cg_atmFx+272072
+INDIRF4
+SUBF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRGP4 cg_atmFx+272080
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_atmFx+272084
+INDIRI4
+ADDRGP4 cg_atmFx+272080
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg_atmFx+272040
+INDIRI4
+LTI4 $646
+CNSTI4 1
+RETI4
+ADDRGP4 $581
+JUMPV
+LABELV $646
+LABELV $623
+LABELV $602
+LABELV $583
+CNSTI4 0
+RETI4
+LABELV $581
+endproc CG_EffectGustCurrent 16 0
+proc CG_EP_ParseFloats 84 12
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $654
+JUMPV
+LABELV $651
+LABELV $652
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $654
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $655
+ADDRLP4 68
+INDIRI4
+CNSTI4 32
+NEI4 $651
+LABELV $655
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $656
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRGP4 $657
+JUMPV
+LABELV $656
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+LABELV $657
+LABELV $650
+endproc CG_EP_ParseFloats 84 12
+proc CG_EP_ParseInts 84 12
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $662
+JUMPV
+LABELV $659
+LABELV $660
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $662
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $663
+ADDRLP4 68
+INDIRI4
+CNSTI4 32
+NEI4 $659
+LABELV $663
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $664
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 80
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $665
+JUMPV
+LABELV $664
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 72
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+LABELV $665
+LABELV $658
+endproc CG_EP_ParseInts 84 12
+export CG_EffectParse
+proc CG_EffectParse 252 12
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 188
+ADDRGP4 CG_AtmosphericKludge
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $667
+ADDRGP4 $666
+JUMPV
+LABELV $667
+ADDRLP4 192
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg_atmFx+272096+4
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRGP4 cg_atmFx+272096
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRLP4 196
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 cg_atmFx+272108+4
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRGP4 cg_atmFx+272108
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 28
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 200
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 168
+CNSTF4 0
+ASGNF4
+ADDRLP4 172
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 204
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 180
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRGP4 cg_atmFx+272072
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 cg_atmFx+272076
+CNSTF4 1069547520
+ASGNF4
+ADDRLP4 184
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 40
+ASGNP4
+ADDRGP4 $680
+JUMPV
+LABELV $677
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $684
+JUMPV
+LABELV $681
+LABELV $682
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $684
+ADDRLP4 208
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $686
+ADDRLP4 208
+INDIRI4
+CNSTI4 61
+EQI4 $686
+ADDRLP4 208
+INDIRI4
+CNSTI4 44
+NEI4 $681
+LABELV $686
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $687
+ADDRGP4 $679
+JUMPV
+LABELV $687
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 44
+NEI4 $689
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $678
+JUMPV
+LABELV $689
+ADDRLP4 212
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 212
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $694
+JUMPV
+LABELV $691
+LABELV $692
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $694
+ADDRLP4 216
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+EQI4 $695
+ADDRLP4 216
+INDIRI4
+CNSTI4 44
+NEI4 $691
+LABELV $695
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $696
+ADDRLP4 220
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 220
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $696
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $698
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $702
+ARGP4
+ADDRLP4 220
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+EQI4 $700
+ADDRGP4 cg_atmFx+272028
+CNSTI4 0
+ASGNI4
+ADDRGP4 $704
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $666
+JUMPV
+LABELV $700
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $707
+ARGP4
+ADDRLP4 224
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $705
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg_atmFx+272132
+ADDRGP4 CG_RainParticleCheckVisible
+ASGNP4
+ADDRGP4 cg_atmFx+272136
+ADDRGP4 CG_RainParticleGenerate
+ASGNP4
+ADDRGP4 cg_atmFx+272140
+ADDRGP4 CG_RainParticleRender
+ASGNP4
+ADDRLP4 228
+CNSTF4 3294363648
+ASGNF4
+ADDRGP4 cg_atmFx+272108+8
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRGP4 cg_atmFx+272096+8
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRGP4 $699
+JUMPV
+LABELV $705
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $717
+ARGP4
+ADDRLP4 228
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+NEI4 $715
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg_atmFx+272132
+ADDRGP4 CG_SnowParticleCheckVisible
+ASGNP4
+ADDRGP4 cg_atmFx+272136
+ADDRGP4 CG_SnowParticleGenerate
+ASGNP4
+ADDRGP4 cg_atmFx+272140
+ADDRGP4 CG_SnowParticleRender
+ASGNP4
+ADDRLP4 232
+CNSTF4 3265265664
+ASGNF4
+ADDRGP4 cg_atmFx+272108+8
+ADDRLP4 232
+INDIRF4
+ASGNF4
+ADDRGP4 cg_atmFx+272096+8
+ADDRLP4 232
+INDIRF4
+ASGNF4
+ADDRGP4 $699
+JUMPV
+LABELV $715
+ADDRGP4 cg_atmFx+272028
+CNSTI4 0
+ASGNI4
+ADDRGP4 $726
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $666
+JUMPV
+LABELV $698
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $729
+ARGP4
+ADDRLP4 220
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+NEI4 $727
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_EP_ParseFloats
+CALLV
+pop
+ADDRGP4 $728
+JUMPV
+LABELV $727
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $732
+ARGP4
+ADDRLP4 224
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $730
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 CG_EP_ParseFloats
+CALLV
+pop
+ADDRGP4 $731
+JUMPV
+LABELV $730
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $735
+ARGP4
+ADDRLP4 228
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+NEI4 $733
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRGP4 CG_EP_ParseFloats
+CALLV
+pop
+ADDRGP4 $734
+JUMPV
+LABELV $733
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $738
+ARGP4
+ADDRLP4 232
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+NEI4 $736
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg_atmFx+272096
+ARGP4
+ADDRGP4 cg_atmFx+272096+4
+ARGP4
+ADDRGP4 CG_EP_ParseFloats
+CALLV
+pop
+ADDRGP4 $737
+JUMPV
+LABELV $736
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $744
+ARGP4
+ADDRLP4 236
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 0
+NEI4 $742
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg_atmFx+272108
+ARGP4
+ADDRGP4 cg_atmFx+272108+4
+ARGP4
+ADDRGP4 CG_EP_ParseFloats
+CALLV
+pop
+ADDRGP4 $743
+JUMPV
+LABELV $742
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $750
+ARGP4
+ADDRLP4 240
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+NEI4 $748
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg_atmFx+272072
+ARGP4
+ADDRGP4 cg_atmFx+272076
+ARGP4
+ADDRGP4 CG_EP_ParseFloats
+CALLV
+pop
+ADDRGP4 $749
+JUMPV
+LABELV $748
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $755
+ARGP4
+ADDRLP4 244
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+NEI4 $753
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRLP4 180
+ARGP4
+ADDRGP4 CG_EP_ParseFloats
+CALLV
+pop
+ADDRGP4 $754
+JUMPV
+LABELV $753
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $758
+ARGP4
+ADDRLP4 248
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+NEI4 $756
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ARGP4
+ADDRLP4 184
+ARGP4
+ADDRGP4 CG_EP_ParseInts
+CALLV
+pop
+ADDRGP4 $757
+JUMPV
+LABELV $756
+ADDRGP4 $759
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $757
+LABELV $754
+LABELV $749
+LABELV $743
+LABELV $737
+LABELV $734
+LABELV $731
+LABELV $728
+LABELV $699
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $678
+LABELV $680
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $677
+LABELV $679
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $765
+ADDRGP4 cgs+56120
+ARGP4
+ADDRGP4 cg+515544
+ARGP4
+ADDRGP4 cg+515552
+ARGP4
+ADDRLP4 208
+ADDRGP4 BG_LoadTraceMap
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+NEI4 $760
+LABELV $765
+ADDRGP4 cg_atmFx+272028
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $666
+JUMPV
+LABELV $760
+ADDRGP4 cg_atmFx+272088
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRGP4 cg_atmFx+272088
+INDIRI4
+CNSTI4 0
+GEI4 $768
+ADDRGP4 cg_atmFx+272088
+CNSTI4 0
+ASGNI4
+LABELV $768
+ADDRGP4 cg_atmFx+272064
+CNSTF4 1148846080
+ADDRLP4 24
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg_atmFx+272068
+CNSTF4 1148846080
+ADDRLP4 28
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg_atmFx+272056
+CNSTF4 1148846080
+ADDRLP4 32
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg_atmFx+272060
+CNSTF4 1148846080
+ADDRLP4 36
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg_atmFx+272048
+CNSTF4 1148846080
+ADDRLP4 168
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg_atmFx+272052
+CNSTF4 1148846080
+ADDRLP4 172
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg_atmFx+272080
+ADDRLP4 176
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg_atmFx+272084
+ADDRLP4 180
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg_atmFx+272080
+INDIRI4
+ADDRGP4 cg_atmFx+272084
+INDIRI4
+LEI4 $786
+ADDRLP4 212
+ADDRGP4 cg_atmFx+272080
+INDIRI4
+ASGNI4
+ADDRGP4 $787
+JUMPV
+LABELV $786
+ADDRLP4 212
+ADDRGP4 cg_atmFx+272084
+INDIRI4
+ASGNI4
+LABELV $787
+ADDRGP4 cg_atmFx+272028
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRGP4 cg_atmFx+272028
+INDIRI4
+CNSTI4 4000
+LEI4 $788
+ADDRGP4 cg_atmFx+272028
+CNSTI4 4000
+ASGNI4
+LABELV $788
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $792
+ADDRGP4 $795
+ARGP4
+ADDRLP4 216
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cg_atmFx+272000
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRGP4 cg_atmFx+272092
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+LABELV $797
+ADDRGP4 $802
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 224
+INDIRP4
+ARGP4
+ADDRLP4 228
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_atmFx+272000
+ADDP4
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_atmFx+272000
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $793
+ADDRLP4 232
+ADDRGP4 cg_atmFx+272092
+ASGNP4
+ADDRLP4 232
+INDIRP4
+ADDRLP4 232
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $804
+LABELV $798
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 6
+LTI4 $797
+ADDRGP4 $793
+JUMPV
+LABELV $792
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $807
+ADDRGP4 $810
+ARGP4
+ADDRLP4 216
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cg_atmFx+272000
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRGP4 cg_atmFx+272092
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+LABELV $812
+ADDRGP4 $817
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 224
+INDIRP4
+ARGP4
+ADDRLP4 228
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_atmFx+272000
+ADDP4
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_atmFx+272000
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $808
+ADDRLP4 232
+ADDRGP4 cg_atmFx+272092
+ASGNP4
+ADDRLP4 232
+INDIRP4
+ADDRLP4 232
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $819
+LABELV $813
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 6
+LTI4 $812
+ADDRGP4 $808
+JUMPV
+LABELV $807
+ADDRGP4 cg_atmFx+272092
+CNSTI4 0
+ASGNI4
+LABELV $808
+LABELV $793
+ADDRGP4 cg_atmFx+272000
+INDIRI4
+CNSTI4 0
+NEI4 $823
+ADDRGP4 cg_atmFx+272000
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg_atmFx+272092
+CNSTI4 0
+ASGNI4
+LABELV $823
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $831
+JUMPV
+LABELV $828
+ADDRLP4 216
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 220
+CNSTI4 1000
+ASGNI4
+CNSTI4 68
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 cg_atmFx+60
+ADDP4
+ADDRLP4 216
+INDIRI4
+ADDRLP4 220
+INDIRI4
+MODI4
+ADDRLP4 220
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $829
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $831
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg_atmFx+272028
+INDIRI4
+LTI4 $828
+ADDRGP4 CG_EffectGust
+CALLV
+pop
+LABELV $666
+endproc CG_EffectParse 252 12
+export CG_AddAtmosphericEffects
+proc CG_AddAtmosphericEffects 60 12
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_atmFx+272028
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $841
+ADDRGP4 cg_atmFx+272092
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $841
+ADDRGP4 cg_atmosphericEffects+8
+INDIRF4
+CNSTF4 0
+GTF4 $835
+LABELV $841
+ADDRGP4 $834
+JUMPV
+LABELV $835
+ADDRGP4 cg_atmosphericEffects+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $847
+ADDRLP4 36
+ADDRGP4 cg_atmosphericEffects+8
+INDIRF4
+ADDRGP4 cg_atmFx+272028
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRGP4 $848
+JUMPV
+LABELV $847
+ADDRLP4 36
+ADDRGP4 cg_atmFx+272028
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $848
+ADDRLP4 8
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_EffectGustCurrent
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $849
+ADDRGP4 CG_EffectGust
+CALLV
+pop
+LABELV $849
+ADDRGP4 cg_atmFx+272148
+ADDRGP4 cg_atmFx+272144
+INDIRI4
+ASGNI4
+ADDRGP4 cg_atmFx+272144
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_atmFx+272160
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 cg_atmFx+272156
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 cg_atmFx+272152
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 cg_atmFx+272120
+ADDRGP4 cg+512444+36
+INDIRF4
+ASGNF4
+ADDRGP4 cg_atmFx+272120+4
+ADDRGP4 cg+512444+36+4
+INDIRF4
+ASGNF4
+ADDRGP4 cg_atmFx+272120+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $870
+JUMPV
+LABELV $867
+ADDRLP4 0
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_atmFx
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 cg_atmFx+272132
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $871
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 cg_atmFx+272136
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $874
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRGP4 $868
+JUMPV
+LABELV $874
+ADDRLP4 56
+ADDRGP4 cg_atmFx+272156
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $871
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg_atmFx+272140
+INDIRP4
+CALLV
+pop
+ADDRLP4 52
+ADDRGP4 cg_atmFx+272144
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $868
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $870
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $867
+ADDRGP4 cg_atmFx+272024
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $834
+endproc CG_AddAtmosphericEffects 60 12
+bss
+align 4
+LABELV cg_atmFx
+skip 272164
+align 4
+LABELV kludgeResult
+skip 4
+align 4
+LABELV kludgeChecked
+skip 4
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_drawScores
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $817
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 115
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $810
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 115
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $802
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $795
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $759
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $758
+byte 1 72
+byte 1 0
+align 1
+LABELV $755
+byte 1 68
+byte 1 0
+align 1
+LABELV $750
+byte 1 87
+byte 1 0
+align 1
+LABELV $744
+byte 1 71
+byte 1 86
+byte 1 0
+align 1
+LABELV $738
+byte 1 66
+byte 1 86
+byte 1 0
+align 1
+LABELV $735
+byte 1 71
+byte 1 0
+align 1
+LABELV $732
+byte 1 67
+byte 1 0
+align 1
+LABELV $729
+byte 1 66
+byte 1 0
+align 1
+LABELV $726
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 101
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 39
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 39
+byte 1 115
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 39
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $717
+byte 1 83
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 0
+align 1
+LABELV $707
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 0
+align 1
+LABELV $704
+byte 1 65
+byte 1 116
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 112
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 101
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $702
+byte 1 84
+byte 1 0
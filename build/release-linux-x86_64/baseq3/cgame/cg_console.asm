@@ -0,0 +1,4315 @@
+data
+export g_console_field_width
+align 4
+LABELV g_console_field_width
+byte 4 78
+export Con_ClearConsole_f
+code
+proc Con_ClearConsole_f 8 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $98
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 con+4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $99
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 512
+LTI4 $98
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 con+65548
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 con+65556
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 con+65544
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 con+65540
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $97
+endproc Con_ClearConsole_f 8 0
+export Con_ToggleConsole_f
+proc Con_ToggleConsole_f 8 4
+ADDRGP4 cg
+INDIRI4
+CNSTI4 1
+NEI4 $108
+ADDRLP4 0
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $108
+ADDRGP4 $107
+JUMPV
+LABELV $108
+ADDRGP4 con_autoclear+12
+INDIRI4
+CNSTI4 0
+EQI4 $110
+ADDRGP4 g_consoleField
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+LABELV $110
+ADDRGP4 g_consoleField+8
+ADDRGP4 g_console_field_width
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+BXORI4
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+LABELV $107
+endproc Con_ToggleConsole_f 8 4
+export Con_LineFeed
+proc Con_LineFeed 24 0
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $115
+ADDRLP4 0
+ADDRGP4 con+65548
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $120
+JUMPV
+LABELV $117
+ADDRLP4 12
+CNSTI4 512
+ASGNI4
+ADDRLP4 16
+CNSTI4 7
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 con+65540
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 con+4
+ADDP4
+ADDP4
+CVPU4 4
+CNSTU4 0
+EQU4 $122
+ADDRLP4 0
+INDIRI4
+ADDRGP4 con+65540
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 con+4
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $122
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 con+65540
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 con+4
+ADDP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $122
+ADDRLP4 0
+INDIRI4
+ADDRGP4 con+65540
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 con+4
+ADDP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+LTI4 $122
+ADDRLP4 0
+INDIRI4
+ADDRGP4 con+65540
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 con+4
+ADDP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 55
+GTI4 $122
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRGP4 con+65540
+INDIRI4
+CNSTI4 512
+MODI4
+CNSTI4 7
+LSHI4
+ADDRGP4 con+4
+ADDP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRGP4 $119
+JUMPV
+LABELV $122
+LABELV $118
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $120
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $117
+LABELV $119
+LABELV $115
+ADDRGP4 con+65544
+INDIRI4
+ADDRGP4 con+65540
+INDIRI4
+NEI4 $136
+ADDRLP4 8
+ADDRGP4 con+65544
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $136
+ADDRLP4 8
+ADDRGP4 con+65540
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $142
+ADDRLP4 12
+INDIRI4
+CNSTI4 55
+EQI4 $142
+ADDRGP4 con+65540
+INDIRI4
+CNSTI4 512
+MODI4
+CNSTI4 7
+LSHI4
+ADDRGP4 con+4
+ADDP4
+CNSTI1 94
+ASGNI1
+ADDRGP4 con+65540
+INDIRI4
+CNSTI4 512
+MODI4
+CNSTI4 7
+LSHI4
+ADDRGP4 con+4+1
+ADDP4
+ADDRLP4 4
+INDIRI1
+ASGNI1
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRGP4 con+65552
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 con+65548
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $143
+JUMPV
+LABELV $142
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 con+65552
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 con+65548
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $143
+ADDRGP4 con+65548
+INDIRI4
+ADDRGP4 con+65540
+INDIRI4
+CNSTI4 512
+MODI4
+CNSTI4 7
+LSHI4
+ADDRGP4 con+4
+ADDP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 con+65540
+INDIRI4
+CNSTI4 512
+GEI4 $156
+ADDRGP4 con+65556
+ADDRGP4 con+65540
+INDIRI4
+ASGNI4
+LABELV $156
+ADDRGP4 con+65656
+ADDRFP4 0
+INDIRI4
+ASGNI4
+LABELV $114
+endproc Con_LineFeed 24 0
+export CG_ConsolePrint
+proc CG_ConsolePrint 196 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $164
+JUMPV
+LABELV $163
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 13
+NEI4 $166
+ADDRGP4 con+65548
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $164
+JUMPV
+LABELV $166
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $169
+CNSTI4 0
+ARGI4
+ADDRGP4 Con_LineFeed
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $164
+JUMPV
+LABELV $169
+ADDRGP4 con+65540
+INDIRI4
+CNSTI4 512
+MODI4
+CNSTI4 7
+LSHI4
+ADDRGP4 con+4
+ADDP4
+ARGP4
+CNSTI4 1536
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRLP4 156
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $173
+ADDRLP4 160
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $177
+ADDRLP4 160
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $177
+ADDRLP4 164
+ADDRLP4 160
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $177
+ADDRLP4 164
+INDIRI4
+CNSTI4 48
+LTI4 $177
+ADDRLP4 164
+INDIRI4
+CNSTI4 55
+GTI4 $177
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $174
+JUMPV
+LABELV $177
+ADDRLP4 168
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $182
+ADDRLP4 168
+INDIRI4
+CNSTI4 13
+EQI4 $182
+ADDRLP4 168
+INDIRI4
+CNSTI4 10
+NEI4 $179
+LABELV $182
+ADDRGP4 $175
+JUMPV
+LABELV $179
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $183
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $183
+ADDRGP4 $175
+JUMPV
+LABELV $183
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $185
+ADDRLP4 180
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 47
+EQI4 $187
+ADDRLP4 180
+INDIRI4
+CNSTI4 92
+NEI4 $185
+LABELV $187
+ADDRGP4 $175
+JUMPV
+LABELV $185
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+CNSTI4 1536
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 184
+ADDRGP4 CG_DrawStrlenMaxChars
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 184
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ADDRGP4 con+65652
+INDIRI4
+ADDRGP4 con+65648
+INDIRI4
+CNSTI4 1
+LSHI4
+SUBI4
+CVIF4 4
+LTF4 $188
+ADDRGP4 $175
+JUMPV
+LABELV $188
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 Q_UTF8_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 192
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $174
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $173
+LABELV $175
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $194
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+NEI4 $192
+LABELV $194
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $193
+JUMPV
+LABELV $192
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $193
+ADDRGP4 con+65548
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+CNSTI4 128
+GTI4 $200
+ADDRLP4 20
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ADDRGP4 con+65652
+INDIRI4
+ADDRGP4 con+65648
+INDIRI4
+CNSTI4 1
+LSHI4
+SUBI4
+CVIF4 4
+LTF4 $195
+LABELV $200
+ADDRGP4 con+65656
+INDIRI4
+CNSTI4 0
+EQI4 $201
+ADDRGP4 con+65548
+INDIRI4
+ADDRGP4 con+65552
+INDIRI4
+LEI4 $201
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRGP4 con+65548
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $209
+JUMPV
+LABELV $206
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRGP4 con+65540
+INDIRI4
+CNSTI4 512
+MODI4
+CNSTI4 7
+LSHI4
+ADDRGP4 con+4
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $212
+ADDRLP4 164
+CNSTI4 1
+ASGNI4
+ADDRGP4 $208
+JUMPV
+LABELV $212
+LABELV $207
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $209
+ADDRLP4 12
+INDIRI4
+ADDRGP4 con+65552
+INDIRI4
+GTI4 $206
+LABELV $208
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $216
+ADDRLP4 24
+ARGP4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 con+65540
+INDIRI4
+CNSTI4 512
+MODI4
+CNSTI4 7
+LSHI4
+ADDRGP4 con+4
+ADDP4
+ADDP4
+ARGP4
+ADDRGP4 con+65548
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 con+65548
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 con+65548
+INDIRI4
+ADDRGP4 con+65540
+INDIRI4
+CNSTI4 512
+MODI4
+CNSTI4 7
+LSHI4
+ADDRGP4 con+4
+ADDP4
+ADDP4
+CNSTI1 0
+ASGNI1
+CNSTI4 1
+ARGI4
+ADDRGP4 Con_LineFeed
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRLP4 172
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 con+65548
+INDIRI4
+ADDRGP4 con+65540
+INDIRI4
+CNSTI4 512
+MODI4
+CNSTI4 7
+LSHI4
+ADDRGP4 con+4
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 172
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRLP4 176
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 180
+ADDRGP4 con+65548
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ADDRLP4 180
+INDIRP4
+INDIRI4
+CVIU4 4
+ADDRLP4 176
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $202
+JUMPV
+LABELV $216
+CNSTI4 1
+ARGI4
+ADDRGP4 Con_LineFeed
+CALLV
+pop
+ADDRGP4 $202
+JUMPV
+LABELV $201
+CNSTI4 1
+ARGI4
+ADDRGP4 Con_LineFeed
+CALLV
+pop
+LABELV $202
+LABELV $195
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRGP4 con+65656
+INDIRI4
+ADDRLP4 164
+INDIRI4
+EQI4 $229
+ADDRGP4 con+65548
+INDIRI4
+ADDRGP4 con+65552
+INDIRI4
+NEI4 $229
+ADDRLP4 0
+INDIRI4
+ADDRLP4 164
+INDIRI4
+NEI4 $229
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $229
+ADDRGP4 $230
+JUMPV
+LABELV $229
+ADDRGP4 con+65548
+INDIRI4
+ADDRGP4 con+65540
+INDIRI4
+CNSTI4 512
+MODI4
+CNSTI4 7
+LSHI4
+ADDRGP4 con+4
+ADDP4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 168
+ADDRGP4 con+65548
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $230
+ADDRFP4 0
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $164
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $163
+LABELV $162
+endproc CG_ConsolePrint 196 12
+export Con_DrawInput
+proc Con_DrawInput 16 24
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $239
+ADDRLP4 4
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $239
+ADDRGP4 $238
+JUMPV
+LABELV $239
+CNSTI4 1536
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LSHI4
+SUBI4
+ASGNI4
+ADDRGP4 con+65648
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $242
+ARGP4
+CNSTI4 1536
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRGP4 $242
+ARGP4
+CNSTI4 1536
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRGP4 g_consoleField
+ARGP4
+ADDRGP4 con+65648
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 1536
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_MField_Draw
+CALLV
+pop
+LABELV $238
+endproc Con_DrawInput 16 24
+export Con_DrawSolidConsole
+proc Con_DrawSolidConsole 84 20
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $245
+ADDRFP4 4
+CNSTF4 1065353216
+ASGNF4
+LABELV $245
+ADDRLP4 40
+ADDRGP4 cgs+20100+35884
+INDIRI4
+CVIF4 4
+ADDRFP4 4
+INDIRF4
+MULF4
+ADDRGP4 cgs+56020
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+GTI4 $250
+ADDRGP4 $244
+JUMPV
+LABELV $250
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 4
+CNSTF4 1139802112
+ADDRFP4 4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+GEI4 $252
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $253
+JUMPV
+LABELV $252
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+679680+123340
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $253
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1065353216
+ASGNF4
+CNSTF4 0
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+CNSTI4 3
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+CNSTI4 1536
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 48
+INDIRI4
+ASGNI4
+CNSTI4 640
+ADDRGP4 con+65648
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 con+65568
+ARGP4
+CNSTI4 1539
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+CNSTI4 2
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 40
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+ADDRLP4 16
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRGP4 con+65544
+INDIRI4
+ADDRGP4 con+65540
+INDIRI4
+EQI4 $261
+ADDRLP4 64
+ADDRGP4 $265
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+CNSTI4 1536
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 76
+CNSTI4 20
+ASGNI4
+ADDRLP4 68
+ADDRGP4 con+65652
+INDIRI4
+ADDRGP4 con+65648
+INDIRI4
+CNSTI4 1
+LSHI4
+SUBI4
+CVIF4 4
+ADDRLP4 72
+INDIRF4
+SUBF4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 con+65648
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $271
+JUMPV
+LABELV $268
+ADDRLP4 60
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRP4
+ARGP4
+CNSTI4 1536
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $269
+ADDRLP4 60
+ADDRLP4 60
+INDIRF4
+ADDRLP4 68
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $271
+ADDRLP4 60
+INDIRF4
+ADDRGP4 con+65652
+INDIRI4
+CVIF4 4
+LTF4 $268
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $261
+ADDRLP4 0
+ADDRGP4 con+65544
+INDIRI4
+ASGNI4
+ADDRGP4 con+65548
+INDIRI4
+CNSTI4 0
+NEI4 $275
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $275
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $281
+JUMPV
+LABELV $278
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $282
+ADDRGP4 $280
+JUMPV
+LABELV $282
+ADDRGP4 con+65540
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 512
+LTI4 $284
+ADDRGP4 $279
+JUMPV
+LABELV $284
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 512
+MODI4
+CNSTI4 7
+LSHI4
+ADDRGP4 con+4
+ADDP4
+ASGNP4
+ADDRGP4 con+65648
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 1536
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $279
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 60
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 60
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $281
+ADDRLP4 8
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $278
+LABELV $280
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 Con_DrawInput
+CALLV
+pop
+LABELV $244
+endproc Con_DrawSolidConsole 84 20
+export Con_DrawConsole
+proc Con_DrawConsole 4 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $290
+ADDRLP4 0
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $292
+ADDRGP4 CG_ClearViewport
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 Con_DrawSolidConsole
+CALLV
+pop
+ADDRGP4 $289
+JUMPV
+LABELV $292
+LABELV $290
+ADDRGP4 con+65560
+INDIRF4
+CNSTF4 0
+EQF4 $294
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 con+65560
+INDIRF4
+ARGF4
+ADDRGP4 Con_DrawSolidConsole
+CALLV
+pop
+LABELV $294
+LABELV $289
+endproc Con_DrawConsole 4 8
+export CG_RunConsole
+proc CG_RunConsole 8 4
+ADDRLP4 0
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $299
+ADDRGP4 con+65564
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $300
+JUMPV
+LABELV $299
+ADDRGP4 con+65564
+CNSTF4 0
+ASGNF4
+LABELV $300
+ADDRGP4 con+65564
+INDIRF4
+ADDRGP4 con+65560
+INDIRF4
+GEF4 $303
+ADDRLP4 4
+ADDRGP4 con+65560
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+CNSTF4 981668463
+ADDRGP4 con_conspeed+8
+INDIRF4
+ADDRGP4 cg+512312
+INDIRI4
+CVIF4 4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 con+65564
+INDIRF4
+ADDRGP4 con+65560
+INDIRF4
+LEF4 $304
+ADDRGP4 con+65560
+ADDRGP4 con+65564
+INDIRF4
+ASGNF4
+ADDRGP4 $304
+JUMPV
+LABELV $303
+ADDRGP4 con+65564
+INDIRF4
+ADDRGP4 con+65560
+INDIRF4
+LEF4 $316
+ADDRLP4 4
+ADDRGP4 con+65560
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+CNSTF4 981668463
+ADDRGP4 con_conspeed+8
+INDIRF4
+ADDRGP4 cg+512312
+INDIRI4
+CVIF4 4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 con+65564
+INDIRF4
+ADDRGP4 con+65560
+INDIRF4
+GEF4 $323
+ADDRGP4 con+65560
+ADDRGP4 con+65564
+INDIRF4
+ASGNF4
+LABELV $323
+LABELV $316
+LABELV $304
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Con_DrawConsole
+CALLV
+pop
+LABELV $298
+endproc CG_RunConsole 8 4
+export Con_PageUp
+proc Con_PageUp 4 0
+ADDRLP4 0
+ADDRGP4 con+65544
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRGP4 con+65540
+INDIRI4
+ADDRGP4 con+65544
+INDIRI4
+SUBI4
+ADDRGP4 con+65556
+INDIRI4
+LTI4 $331
+ADDRGP4 con+65544
+ADDRGP4 con+65540
+INDIRI4
+ADDRGP4 con+65556
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $331
+LABELV $329
+endproc Con_PageUp 4 0
+export Con_PageDown
+proc Con_PageDown 4 0
+ADDRLP4 0
+ADDRGP4 con+65544
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 con+65544
+INDIRI4
+ADDRGP4 con+65540
+INDIRI4
+LEI4 $341
+ADDRGP4 con+65544
+ADDRGP4 con+65540
+INDIRI4
+ASGNI4
+LABELV $341
+LABELV $339
+endproc Con_PageDown 4 0
+export Con_Top
+proc Con_Top 0 0
+ADDRGP4 con+65544
+ADDRGP4 con+65556
+INDIRI4
+ASGNI4
+ADDRGP4 con+65540
+INDIRI4
+ADDRGP4 con+65544
+INDIRI4
+SUBI4
+ADDRGP4 con+65556
+INDIRI4
+LTI4 $350
+ADDRGP4 con+65544
+ADDRGP4 con+65540
+INDIRI4
+ADDRGP4 con+65556
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $350
+LABELV $347
+endproc Con_Top 0 0
+export Con_Bottom
+proc Con_Bottom 0 0
+ADDRGP4 con+65544
+ADDRGP4 con+65540
+INDIRI4
+ASGNI4
+LABELV $358
+endproc Con_Bottom 0 0
+export CG_CloseConsole
+proc CG_CloseConsole 4 4
+ADDRGP4 g_consoleField
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -2
+BANDI4
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+ADDRGP4 con+65564
+CNSTF4 0
+ASGNF4
+ADDRGP4 con+65560
+CNSTF4 0
+ASGNF4
+LABELV $361
+endproc CG_CloseConsole 4 4
+export Console_Key
+proc Console_Key 1052 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $365
+ADDRGP4 $364
+JUMPV
+LABELV $365
+ADDRFP4 0
+INDIRI4
+CNSTI4 2147483648
+BANDI4
+CNSTI4 0
+EQI4 $367
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2147483647
+BANDI4
+ASGNI4
+ADDRGP4 g_consoleField
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 MField_CharEvent
+CALLV
+pop
+ADDRGP4 $364
+JUMPV
+LABELV $367
+ADDRFP4 0
+INDIRI4
+CNSTI4 108
+NEI4 $369
+CNSTI4 137
+ARGI4
+ADDRLP4 0
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $371
+CNSTI4 138
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $369
+LABELV $371
+CNSTI4 2
+ARGI4
+ADDRGP4 $372
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $364
+JUMPV
+LABELV $369
+ADDRFP4 0
+INDIRI4
+CNSTI4 13
+EQI4 $375
+ADDRFP4 0
+INDIRI4
+CNSTI4 175
+NEI4 $373
+LABELV $375
+ADDRGP4 g_consoleField
+ARGP4
+ADDRLP4 16
+ADDRGP4 MField_Buffer
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRGP4 cg
+INDIRI4
+CNSTI4 7
+EQI4 $376
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 con_autochat+12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $376
+ADDRLP4 24
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $376
+ADDRLP4 24
+INDIRI4
+CNSTI4 92
+EQI4 $376
+ADDRLP4 24
+INDIRI4
+CNSTI4 47
+EQI4 $376
+ADDRLP4 28
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $379
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 g_consoleField
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 MField_SetText
+CALLV
+pop
+LABELV $376
+ADDRGP4 $380
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 28
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 92
+EQI4 $383
+ADDRLP4 28
+INDIRI4
+CNSTI4 47
+NEI4 $381
+LABELV $383
+CNSTI4 2
+ARGI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $384
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $382
+JUMPV
+LABELV $381
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $385
+ADDRGP4 $364
+JUMPV
+LABELV $385
+ADDRGP4 con_autochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $387
+CNSTI4 2
+ARGI4
+ADDRGP4 $390
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $387
+CNSTI4 2
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $384
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $382
+CNSTI4 1044
+ADDRGP4 nextHistoryLine
+INDIRI4
+CNSTI4 32
+MODI4
+MULI4
+ADDRGP4 historyEditLines
+ADDP4
+ADDRGP4 g_consoleField
+INDIRB
+ASGNB 1044
+ADDRLP4 32
+ADDRGP4 nextHistoryLine
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 historyLine
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_consoleField
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRGP4 g_consoleField+8
+ADDRGP4 g_console_field_width
+INDIRI4
+ASGNI4
+ADDRGP4 CG_SaveConsoleHistory
+CALLV
+pop
+ADDRGP4 cg
+INDIRI4
+CNSTI4 1
+NEI4 $364
+ADDRGP4 trap_UpdateScreen
+CALLV
+pop
+ADDRGP4 $364
+JUMPV
+LABELV $373
+ADDRFP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $394
+ADDRGP4 g_consoleField
+ARGP4
+ADDRLP4 1040
+ADDRGP4 MField_Buffer
+CALLP4
+ASGNP4
+ADDRLP4 1036
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cmd_AutoComplete
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $364
+ADDRGP4 g_consoleField
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 MField_SetText
+CALLV
+pop
+ADDRGP4 $364
+JUMPV
+LABELV $394
+ADDRFP4 0
+INDIRI4
+CNSTI4 189
+NEI4 $401
+CNSTI4 139
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $404
+CNSTI4 140
+ARGI4
+ADDRLP4 16
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $404
+LABELV $401
+ADDRFP4 0
+INDIRI4
+CNSTI4 131
+EQI4 $404
+ADDRFP4 0
+INDIRI4
+CNSTI4 167
+EQI4 $404
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 112
+NEI4 $398
+CNSTI4 137
+ARGI4
+ADDRLP4 28
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $404
+CNSTI4 138
+ARGI4
+ADDRLP4 32
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $398
+LABELV $404
+ADDRLP4 36
+ADDRGP4 historyLine
+INDIRI4
+ASGNI4
+ADDRGP4 nextHistoryLine
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+CNSTI4 32
+GEI4 $405
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LEI4 $405
+ADDRLP4 40
+ADDRGP4 historyLine
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $405
+ADDRGP4 g_consoleField
+CNSTI4 1044
+ADDRGP4 historyLine
+INDIRI4
+CNSTI4 32
+MODI4
+MULI4
+ADDRGP4 historyEditLines
+ADDP4
+INDIRB
+ASGNB 1044
+ADDRGP4 $364
+JUMPV
+LABELV $398
+ADDRFP4 0
+INDIRI4
+CNSTI4 190
+NEI4 $410
+CNSTI4 139
+ARGI4
+ADDRLP4 36
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $413
+CNSTI4 140
+ARGI4
+ADDRLP4 40
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $413
+LABELV $410
+ADDRFP4 0
+INDIRI4
+CNSTI4 132
+EQI4 $413
+ADDRFP4 0
+INDIRI4
+CNSTI4 173
+EQI4 $413
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 110
+NEI4 $407
+CNSTI4 137
+ARGI4
+ADDRLP4 52
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $413
+CNSTI4 138
+ARGI4
+ADDRLP4 56
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $407
+LABELV $413
+ADDRLP4 60
+ADDRGP4 historyLine
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+ADDRGP4 nextHistoryLine
+INDIRI4
+LTI4 $414
+ADDRGP4 historyLine
+ADDRGP4 nextHistoryLine
+INDIRI4
+ASGNI4
+ADDRGP4 g_consoleField
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRGP4 g_consoleField+8
+ADDRGP4 g_console_field_width
+INDIRI4
+ASGNI4
+ADDRGP4 $364
+JUMPV
+LABELV $414
+ADDRGP4 g_consoleField
+CNSTI4 1044
+ADDRGP4 historyLine
+INDIRI4
+CNSTI4 32
+MODI4
+MULI4
+ADDRGP4 historyEditLines
+ADDP4
+INDIRB
+ASGNB 1044
+ADDRGP4 $364
+JUMPV
+LABELV $407
+ADDRFP4 0
+INDIRI4
+CNSTI4 148
+EQI4 $419
+ADDRFP4 0
+INDIRI4
+CNSTI4 168
+NEI4 $417
+LABELV $419
+ADDRGP4 Con_PageUp
+CALLV
+pop
+ADDRGP4 $364
+JUMPV
+LABELV $417
+ADDRFP4 0
+INDIRI4
+CNSTI4 147
+EQI4 $422
+ADDRFP4 0
+INDIRI4
+CNSTI4 174
+NEI4 $420
+LABELV $422
+ADDRGP4 Con_PageDown
+CALLV
+pop
+ADDRGP4 $364
+JUMPV
+LABELV $420
+ADDRFP4 0
+INDIRI4
+CNSTI4 189
+NEI4 $423
+ADDRGP4 Con_PageUp
+CALLV
+pop
+CNSTI4 137
+ARGI4
+ADDRLP4 68
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $427
+CNSTI4 138
+ARGI4
+ADDRLP4 72
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $364
+LABELV $427
+ADDRGP4 Con_PageUp
+CALLV
+pop
+ADDRGP4 Con_PageUp
+CALLV
+pop
+ADDRGP4 $364
+JUMPV
+LABELV $423
+ADDRFP4 0
+INDIRI4
+CNSTI4 190
+NEI4 $428
+ADDRGP4 Con_PageDown
+CALLV
+pop
+CNSTI4 137
+ARGI4
+ADDRLP4 68
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $432
+CNSTI4 138
+ARGI4
+ADDRLP4 72
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $364
+LABELV $432
+ADDRGP4 Con_PageDown
+CALLV
+pop
+ADDRGP4 Con_PageDown
+CALLV
+pop
+ADDRGP4 $364
+JUMPV
+LABELV $428
+ADDRFP4 0
+INDIRI4
+CNSTI4 149
+EQI4 $435
+ADDRFP4 0
+INDIRI4
+CNSTI4 166
+NEI4 $433
+LABELV $435
+CNSTI4 137
+ARGI4
+ADDRLP4 72
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $436
+CNSTI4 138
+ARGI4
+ADDRLP4 76
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $433
+LABELV $436
+ADDRGP4 Con_Top
+CALLV
+pop
+ADDRGP4 $364
+JUMPV
+LABELV $433
+ADDRFP4 0
+INDIRI4
+CNSTI4 150
+EQI4 $439
+ADDRFP4 0
+INDIRI4
+CNSTI4 172
+NEI4 $437
+LABELV $439
+CNSTI4 137
+ARGI4
+ADDRLP4 84
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $440
+CNSTI4 138
+ARGI4
+ADDRLP4 88
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $437
+LABELV $440
+ADDRGP4 Con_Bottom
+CALLV
+pop
+ADDRGP4 $364
+JUMPV
+LABELV $437
+ADDRGP4 g_consoleField
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 MField_KeyDownEvent
+CALLV
+pop
+LABELV $364
+endproc Console_Key 1052 16
+data
+align 4
+LABELV consoleSaveBufferSize
+byte 4 0
+export CG_LoadConsoleHistory
+code
+proc CG_LoadConsoleHistory 1096 12
+ADDRLP4 1048
+CNSTI4 0
+ASGNI4
+ADDRGP4 $442
+ARGP4
+ADDRLP4 1052
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1056
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRGP4 consoleSaveBufferSize
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $443
+ADDRGP4 $445
+ARGP4
+ADDRGP4 $442
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $441
+JUMPV
+LABELV $443
+ADDRLP4 1060
+ADDRGP4 consoleSaveBufferSize
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 1024
+GEI4 $446
+ADDRGP4 consoleSaveBuffer
+ARGP4
+ADDRLP4 1060
+INDIRI4
+ARGI4
+ADDRLP4 1052
+INDIRI4
+ARGI4
+ADDRLP4 1064
+ADDRGP4 trap_FS_Read
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+ADDRGP4 consoleSaveBufferSize
+INDIRI4
+NEI4 $446
+ADDRGP4 consoleSaveBufferSize
+INDIRI4
+ADDRGP4 consoleSaveBuffer
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+ADDRGP4 consoleSaveBuffer
+ASGNP4
+ADDRLP4 0
+CNSTI4 31
+ASGNI4
+LABELV $448
+ADDRLP4 4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1068
+INDIRP4
+ASGNP4
+ADDRLP4 1068
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $452
+ADDRGP4 $450
+JUMPV
+LABELV $452
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1076
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1076
+INDIRP4
+ASGNP4
+ADDRLP4 1076
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $454
+ADDRGP4 $450
+JUMPV
+LABELV $454
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1084
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1084
+INDIRP4
+ASGNP4
+ADDRLP4 1084
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $456
+ADDRGP4 $450
+JUMPV
+LABELV $456
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1088
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 consoleSaveBuffer
+ARGP4
+ADDRLP4 1092
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+ADDRLP4 1092
+INDIRU4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 consoleSaveBuffer
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+SUBU4
+LEU4 $458
+ADDRGP4 $460
+ARGP4
+ADDRGP4 Com_DPrintf
+CALLV
+pop
+ADDRGP4 $450
+JUMPV
+LABELV $458
+ADDRLP4 16
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+ADDP4
+CNSTI1 0
+ASGNI1
+CNSTI4 1044
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 historyEditLines
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 MField_SetText
+CALLV
+pop
+CNSTI4 1044
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 historyEditLines
+ADDP4
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+CNSTI4 1044
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 historyEditLines+4
+ADDP4
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 1048
+ADDRLP4 1048
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $449
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $448
+LABELV $450
+ADDRGP4 historyEditLines
+ARGP4
+CNSTI4 1044
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 historyEditLines+1044
+ADDP4
+ARGP4
+CNSTU4 1044
+ADDRLP4 1048
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRLP4 0
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRGP4 $466
+JUMPV
+LABELV $463
+CNSTI4 1044
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 historyEditLines
+ADDP4
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+LABELV $464
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $466
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $463
+ADDRGP4 nextHistoryLine
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRGP4 historyLine
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $446
+ADDRGP4 $445
+ARGP4
+ADDRGP4 $442
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $447
+ADDRLP4 1052
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $441
+endproc CG_LoadConsoleHistory 1096 12
+export CG_SaveConsoleHistory
+proc CG_SaveConsoleHistory 48 20
+ADDRGP4 consoleSaveBuffer
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRGP4 nextHistoryLine
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 32
+MODI4
+ASGNI4
+LABELV $468
+CNSTI4 1044
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 historyEditLines+12
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $471
+CNSTI4 1044
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 historyEditLines
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 MField_Buffer
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 28
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 consoleSaveBuffer
+ARGP4
+ADDRLP4 32
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+ADDRLP4 32
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $474
+ARGP4
+ADDRLP4 36
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 16
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ADDRLP4 36
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+CNSTI4 1024
+GEI4 $470
+ADDRGP4 $477
+ARGP4
+ADDRLP4 40
+CNSTI4 1044
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 historyEditLines
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 historyEditLines+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 consoleSaveBuffer
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $476
+LABELV $471
+ADDRLP4 24
+CNSTI4 32
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ADDRLP4 24
+INDIRI4
+MODI4
+ASGNI4
+LABELV $469
+ADDRLP4 0
+INDIRI4
+ADDRGP4 nextHistoryLine
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 32
+MODI4
+NEI4 $468
+LABELV $470
+ADDRGP4 consoleSaveBuffer
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 consoleSaveBufferSize
+ADDRLP4 24
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $442
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $479
+ADDRGP4 $481
+ARGP4
+ADDRGP4 $442
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $467
+JUMPV
+LABELV $479
+ADDRGP4 consoleSaveBuffer
+ARGP4
+ADDRGP4 consoleSaveBufferSize
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 trap_FS_Write
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 consoleSaveBufferSize
+INDIRI4
+GEI4 $482
+ADDRGP4 $481
+ARGP4
+ADDRGP4 $442
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $482
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $467
+endproc CG_SaveConsoleHistory 48 20
+export CG_ConsoleInit
+proc CG_ConsoleInit 268 20
+ADDRGP4 cg_consoleFont+16
+ARGP4
+ADDRGP4 cg_consoleFontSize+12
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 cgs+679680+102780
+ARGP4
+ADDRLP4 264
+ADDRGP4 CG_InitTrueTypeFont
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $485
+ADDRGP4 cgs+679680+102780
+ARGP4
+ADDRGP4 cg_consoleFontSize+12
+INDIRI4
+ARGI4
+ADDRGP4 cg_consoleFontSize+12
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 CG_InitBitmapFont
+CALLV
+pop
+LABELV $485
+ADDRGP4 $495
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $496
+ADDRGP4 $498
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+LABELV $496
+ADDRLP4 260
+ADDRGP4 $499
+ASGNP4
+ADDRGP4 con+65568
+ARGP4
+CNSTI4 80
+ARGI4
+ADDRGP4 $502
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 con+65648
+ADDRGP4 cg_consoleFontSize+12
+INDIRI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRGP4 g_consoleField
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $505
+CNSTI4 1044
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 historyEditLines
+ADDP4
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+LABELV $506
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $505
+ADDRGP4 CG_ConsoleResized
+CALLV
+pop
+ADDRGP4 CG_LoadConsoleHistory
+CALLV
+pop
+LABELV $484
+endproc CG_ConsoleInit 268 20
+export CG_ConsoleResized
+proc CG_ConsoleResized 8 0
+ADDRGP4 con+65652
+ADDRGP4 cgs+20100+35880
+INDIRI4
+CVIF4 4
+ADDRGP4 cgs+56016
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 g_console_field_width
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRGP4 con+65652
+INDIRI4
+ADDRGP4 con+65648
+INDIRI4
+CNSTI4 1
+LSHI4
+SUBI4
+ADDRGP4 cg_consoleFontSize+12
+INDIRI4
+CNSTI4 2
+DIVI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 256
+LEI4 $517
+ADDRGP4 g_console_field_width
+CNSTI4 256
+ASGNI4
+LABELV $517
+ADDRGP4 g_consoleField+8
+ADDRGP4 g_console_field_width
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $520
+CNSTI4 1044
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 historyEditLines+8
+ADDP4
+ADDRGP4 g_console_field_width
+INDIRI4
+ASGNI4
+LABELV $521
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $520
+LABELV $509
+endproc CG_ConsoleResized 8 0
+bss
+align 1
+LABELV consoleSaveBuffer
+skip 1024
+export g_consoleField
+align 4
+LABELV g_consoleField
+skip 1044
+export historyLine
+align 4
+LABELV historyLine
+skip 4
+export nextHistoryLine
+align 4
+LABELV nextHistoryLine
+skip 4
+export historyEditLines
+align 4
+LABELV historyEditLines
+skip 33408
+export con
+align 4
+LABELV con
+skip 65660
+import Q_Unicode_ToLower
+import Q_Unicode_ToUpper
+import Q_Unicode_IsAlphaOrIdeoOrDigit
+import Q_Unicode_IsAlphaOrIdeo
+import Q_Unicode_IsIdeo
+import Q_Unicode_IsLower
+import Q_Unicode_IsUpper
+import Q_Unicode_IsAlpha
+import Q_UTF8_Unstore
+import Q_UTF8_Store
+import Q_UTF8_Encode
+import Q_UTF8_CodePoint
+import Q_UTF8_ContByte
+import Q_UTF8_PrintStrlen
+import Q_UTF8_Strlen
+import Q_UTF8_WidthCP
+import Q_UTF8_Width
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_drawScores
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $502
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $499
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 51
+byte 1 32
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 46
+byte 1 51
+byte 1 43
+byte 1 50
+byte 1 48
+byte 1 50
+byte 1 54
+byte 1 49
+byte 1 48
+byte 1 49
+byte 1 56
+byte 1 43
+byte 1 55
+byte 1 50
+byte 1 51
+byte 1 51
+byte 1 101
+byte 1 57
+byte 1 99
+byte 1 0
+align 1
+LABELV $498
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $495
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $481
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $477
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 0
+align 1
+LABELV $474
+byte 1 57
+byte 1 57
+byte 1 57
+byte 1 32
+byte 1 57
+byte 1 57
+byte 1 57
+byte 1 32
+byte 1 57
+byte 1 57
+byte 1 57
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $460
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $445
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $442
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 46
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $390
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 0
+align 1
+LABELV $384
+byte 1 10
+byte 1 0
+align 1
+LABELV $380
+byte 1 93
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $379
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $372
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $265
+byte 1 94
+byte 1 0
+align 1
+LABELV $242
+byte 1 93
+byte 1 0
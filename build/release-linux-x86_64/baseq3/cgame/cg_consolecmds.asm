@@ -0,0 +1,8794 @@
+export CG_TargetCommand_f
+code
+proc CG_TargetCommand_f 24 16
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $97
+ADDRGP4 $96
+JUMPV
+LABELV $97
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $100
+ARGP4
+ADDRLP4 12
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 $99
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $96
+endproc CG_TargetCommand_f 24 16
+proc CG_SizeUp_f 4 12
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 10
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $102
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $101
+endproc CG_SizeUp_f 4 12
+proc CG_SizeDown_f 4 12
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 10
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $102
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $104
+endproc CG_SizeDown_f 4 12
+export CG_MessageMode_f
+proc CG_MessageMode_f 4 12
+ADDRGP4 cg+517696
+ARGP4
+ADDRGP4 $108
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+517728
+ARGP4
+ADDRGP4 $111
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+517792
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRGP4 cg+517792+8
+CNSTI4 30
+ASGNI4
+ADDRLP4 0
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BXORI4
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+LABELV $106
+endproc CG_MessageMode_f 4 12
+export CG_MessageMode2_f
+proc CG_MessageMode2_f 4 12
+ADDRGP4 cg+517696
+ARGP4
+ADDRGP4 $118
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+517728
+ARGP4
+ADDRGP4 $121
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+517792
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRGP4 cg+517792+8
+CNSTI4 25
+ASGNI4
+ADDRLP4 0
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BXORI4
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+LABELV $116
+endproc CG_MessageMode2_f 4 12
+export CG_MessageMode3_f
+proc CG_MessageMode3_f 16 16
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $129
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $127
+LABELV $129
+ADDRGP4 $126
+JUMPV
+LABELV $127
+ADDRGP4 cg+517696
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $132
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 cg+517728
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $135
+ARGP4
+CNSTI4 2044
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+4
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 cg+517792
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRGP4 cg+517792+8
+CNSTI4 30
+ASGNI4
+ADDRLP4 12
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+BXORI4
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+LABELV $126
+endproc CG_MessageMode3_f 16 16
+export CG_MessageMode4_f
+proc CG_MessageMode4_f 16 16
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $144
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $142
+LABELV $144
+ADDRGP4 $141
+JUMPV
+LABELV $142
+ADDRGP4 cg+517696
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $132
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 cg+517728
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $135
+ARGP4
+CNSTI4 2044
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+4
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 cg+517792
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRGP4 cg+517792+8
+CNSTI4 30
+ASGNI4
+ADDRLP4 12
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+BXORI4
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+LABELV $141
+endproc CG_MessageMode4_f 16 16
+export CG_CenterEcho_f
+proc CG_CenterEcho_f 1024 16
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 92
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRGP4 CG_ReplaceCharacter
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTF4 1056964608
+ARGF4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $154
+endproc CG_CenterEcho_f 1024 16
+proc CG_Viewpos_f 4 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $156
+ARGP4
+ADDRLP4 0
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+522872+35972
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+522872+35972+4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+522872+35972+8
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+522872+35984+4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $155
+endproc CG_Viewpos_f 4 20
+proc CG_ScoresDown_f 12 8
+ADDRLP4 0
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+ASGNP4
+ADDRGP4 cg+518836
+INDIRI4
+CNSTI4 2000
+ADDI4
+ADDRGP4 cg+512320
+INDIRI4
+GEI4 $170
+ADDRGP4 cg+518836
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRGP4 $176
+ARGP4
+ADDRGP4 cg+518840
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 CG_AnyScoreboardShowing
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $178
+ADDRGP4 cg+518844
+CNSTI4 0
+ASGNI4
+LABELV $178
+ADDRLP4 0
+INDIRP4
+CNSTI4 35996
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $171
+JUMPV
+LABELV $170
+ADDRLP4 0
+INDIRP4
+CNSTI4 35996
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $171
+LABELV $168
+endproc CG_ScoresDown_f 12 8
+proc CG_ScoresUp_f 4 0
+ADDRLP4 0
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35996
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $183
+ADDRLP4 0
+INDIRP4
+CNSTI4 35996
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36004
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $183
+LABELV $181
+endproc CG_ScoresUp_f 4 0
+export CG_SetModel_f
+proc CG_SetModel_f 304 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $187
+ARGP4
+ADDRLP4 292
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 292
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRLP4 296
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 296
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $188
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $190
+ARGP4
+ADDRLP4 300
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $189
+JUMPV
+LABELV $188
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $191
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $189
+LABELV $186
+endproc CG_SetModel_f 304 12
+export CG_SetHeadmodel_f
+proc CG_SetHeadmodel_f 300 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $190
+ARGP4
+ADDRLP4 292
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 292
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRLP4 296
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 296
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $193
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $194
+JUMPV
+LABELV $193
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $191
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $194
+LABELV $192
+endproc CG_SetHeadmodel_f 300 12
+export CG_SetTeamModel_f
+proc CG_SetTeamModel_f 304 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $196
+ARGP4
+ADDRLP4 292
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 292
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRLP4 296
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 296
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $197
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $199
+ARGP4
+ADDRLP4 300
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $198
+JUMPV
+LABELV $197
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $191
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $198
+LABELV $195
+endproc CG_SetTeamModel_f 304 12
+export CG_SetTeamHeadmodel_f
+proc CG_SetTeamHeadmodel_f 300 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $199
+ARGP4
+ADDRLP4 292
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 292
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRLP4 296
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 296
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $201
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $202
+JUMPV
+LABELV $201
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $191
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $202
+LABELV $200
+endproc CG_SetTeamHeadmodel_f 300 12
+proc CG_Field_CompletePlayerModel 12648 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 8376
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 8364
+CNSTI4 0
+ASGNI4
+ADDRGP4 $205
+JUMPV
+LABELV $204
+ADDRLP4 8364
+ADDRLP4 8364
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $205
+ADDRLP4 12548
+ADDRLP4 8364
+INDIRI4
+ADDRLP4 8376
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12548
+INDIRI4
+CNSTI4 0
+EQI4 $207
+ADDRLP4 12548
+INDIRI4
+CNSTI4 47
+NEI4 $204
+LABELV $207
+ADDRLP4 8364
+INDIRI4
+ADDRLP4 8376
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8288
+CNSTI1 0
+ASGNI1
+ADDRLP4 8288
+ARGP4
+ADDRLP4 12568
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 72
+ADDRLP4 12568
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $211
+ADDRLP4 12552
+ADDRGP4 $208
+ASGNP4
+ADDRGP4 $212
+JUMPV
+LABELV $211
+ADDRLP4 12552
+ADDRGP4 $209
+ASGNP4
+LABELV $212
+ADDRLP4 8352
+ADDRLP4 12552
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $214
+ADDRLP4 12556
+CNSTI4 5
+ASGNI4
+ADDRGP4 $215
+JUMPV
+LABELV $214
+ADDRLP4 12556
+CNSTI4 6
+ASGNI4
+LABELV $215
+ADDRLP4 76
+ADDRLP4 12556
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $219
+ADDRLP4 12560
+ADDRGP4 $216
+ASGNP4
+ADDRGP4 $220
+JUMPV
+LABELV $219
+ADDRLP4 12560
+ADDRGP4 $217
+ASGNP4
+LABELV $220
+ADDRLP4 8440
+ADDRLP4 12560
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $222
+ADDRLP4 12564
+CNSTI4 5
+ASGNI4
+ADDRGP4 $223
+JUMPV
+LABELV $222
+ADDRLP4 12564
+CNSTI4 6
+ASGNI4
+LABELV $223
+ADDRLP4 8372
+ADDRLP4 12564
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 8192
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 8356
+CNSTI4 0
+ASGNI4
+ADDRLP4 12572
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12572
+INDIRI4
+EQI4 $227
+ADDRLP4 8364
+INDIRI4
+ADDRLP4 12572
+INDIRI4
+EQI4 $227
+ADDRLP4 8376
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $224
+LABELV $227
+ADDRGP4 $228
+ARGP4
+ADDRGP4 $229
+ARGP4
+ADDRLP4 10500
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 12576
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 10496
+ADDRLP4 12576
+INDIRI4
+ASGNI4
+ADDRLP4 8280
+ADDRLP4 10500
+ASGNP4
+ADDRLP4 8444
+CNSTI4 0
+ASGNI4
+ADDRGP4 $233
+JUMPV
+LABELV $230
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 12580
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8368
+ADDRLP4 12580
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8368
+INDIRI4
+CNSTI4 0
+NEI4 $234
+ADDRGP4 $231
+JUMPV
+LABELV $234
+ADDRLP4 8368
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8280
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $236
+ADDRLP4 8368
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8280
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $236
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRGP4 $240
+ARGP4
+ADDRLP4 12584
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12584
+INDIRI4
+CNSTI4 0
+EQI4 $244
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRGP4 $241
+ARGP4
+ADDRLP4 12588
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12588
+INDIRI4
+CNSTI4 0
+EQI4 $244
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRGP4 $242
+ARGP4
+ADDRLP4 12592
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12592
+INDIRI4
+CNSTI4 0
+NEI4 $238
+LABELV $244
+ADDRGP4 $231
+JUMPV
+LABELV $238
+ADDRLP4 8364
+INDIRI4
+CNSTI4 0
+LEI4 $245
+ADDRLP4 8376
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 8364
+INDIRI4
+ARGI4
+ADDRLP4 12600
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 12600
+INDIRI4
+CNSTI4 0
+EQI4 $245
+ADDRGP4 $231
+JUMPV
+LABELV $245
+ADDRGP4 $247
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 12604
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12604
+INDIRP4
+ARGP4
+ADDRGP4 $248
+ARGP4
+ADDRLP4 8448
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 12608
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 8284
+ADDRLP4 12608
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 8448
+ASGNP4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRGP4 $252
+JUMPV
+LABELV $249
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 12612
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 84
+ADDRLP4 12612
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+LEI4 $253
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8288
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 12620
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 12620
+INDIRI4
+CNSTI4 0
+NEI4 $253
+ADDRLP4 0
+ADDRLP4 72
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $253
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8352
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 12624
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 12624
+INDIRI4
+CNSTI4 0
+EQI4 $255
+ADDRGP4 $250
+JUMPV
+LABELV $255
+ADDRLP4 76
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12628
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12628
+INDIRI4
+CNSTI4 0
+NEI4 $257
+ADDRLP4 88
+ARGP4
+CNSTU4 8192
+ARGU4
+ADDRLP4 8356
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddStringToList
+CALLV
+pop
+ADDRGP4 $258
+JUMPV
+LABELV $257
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $259
+ADDRLP4 4
+ARGP4
+ADDRLP4 12632
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8360
+ADDRLP4 12632
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8360
+INDIRI4
+ADDRLP4 76
+INDIRI4
+SUBI4
+ADDRLP4 8372
+INDIRI4
+LEI4 $260
+ADDRLP4 4
+ARGP4
+ADDRLP4 8440
+INDIRP4
+ARGP4
+ADDRLP4 12636
+ADDRGP4 COM_CompareExtension
+CALLI4
+ASGNI4
+ADDRLP4 12636
+INDIRI4
+CNSTI4 0
+EQI4 $260
+ADDRLP4 8360
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8372
+INDIRI4
+SUBI4
+ADDRLP4 4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $263
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12640
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+ARGP4
+CNSTU4 8192
+ARGU4
+ADDRLP4 8356
+ARGP4
+ADDRLP4 12640
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddStringToList
+CALLV
+pop
+ADDRGP4 $260
+JUMPV
+LABELV $259
+ADDRGP4 $263
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12632
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+ARGP4
+CNSTU4 8192
+ARGU4
+ADDRLP4 8356
+ARGP4
+ADDRLP4 12632
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddStringToList
+CALLV
+pop
+LABELV $260
+LABELV $258
+LABELV $250
+ADDRLP4 12612
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+ADDRLP4 12612
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 84
+INDIRI4
+ADDRLP4 12612
+INDIRI4
+ADDI4
+ADDRLP4 68
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $252
+ADDRLP4 80
+INDIRI4
+ADDRLP4 8284
+INDIRI4
+LTI4 $249
+LABELV $231
+ADDRLP4 12580
+CNSTI4 1
+ASGNI4
+ADDRLP4 8444
+ADDRLP4 8444
+INDIRI4
+ADDRLP4 12580
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8280
+ADDRLP4 8368
+INDIRI4
+ADDRLP4 12580
+INDIRI4
+ADDI4
+ADDRLP4 8280
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $233
+ADDRLP4 8444
+INDIRI4
+ADDRLP4 10496
+INDIRI4
+LTI4 $230
+LABELV $224
+ADDRLP4 12576
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12576
+INDIRI4
+EQI4 $264
+ADDRLP4 8364
+INDIRI4
+ADDRLP4 12576
+INDIRI4
+EQI4 $266
+ADDRLP4 8376
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $264
+LABELV $266
+ADDRGP4 $267
+ARGP4
+ADDRGP4 $229
+ARGP4
+ADDRLP4 10500
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 12580
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 10496
+ADDRLP4 12580
+INDIRI4
+ASGNI4
+ADDRLP4 8280
+ADDRLP4 10500
+ASGNP4
+ADDRLP4 8444
+CNSTI4 0
+ASGNI4
+ADDRGP4 $271
+JUMPV
+LABELV $268
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 12584
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8368
+ADDRLP4 12584
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8368
+INDIRI4
+CNSTI4 0
+NEI4 $272
+ADDRGP4 $269
+JUMPV
+LABELV $272
+ADDRLP4 8368
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8280
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $274
+ADDRLP4 8368
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8280
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $274
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRGP4 $240
+ARGP4
+ADDRLP4 12588
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12588
+INDIRI4
+CNSTI4 0
+EQI4 $278
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRGP4 $241
+ARGP4
+ADDRLP4 12592
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12592
+INDIRI4
+CNSTI4 0
+NEI4 $276
+LABELV $278
+ADDRGP4 $269
+JUMPV
+LABELV $276
+ADDRLP4 12600
+CNSTI4 1
+ASGNI4
+ADDRLP4 8364
+INDIRI4
+ADDRLP4 12600
+INDIRI4
+LEI4 $279
+ADDRLP4 8376+1
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 8364
+INDIRI4
+ADDRLP4 12600
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 12604
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 12604
+INDIRI4
+CNSTI4 0
+EQI4 $279
+ADDRGP4 $269
+JUMPV
+LABELV $279
+ADDRGP4 $282
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 12608
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12608
+INDIRP4
+ARGP4
+ADDRGP4 $248
+ARGP4
+ADDRLP4 8448
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 12612
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 8284
+ADDRLP4 12612
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 8448
+ASGNP4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRGP4 $286
+JUMPV
+LABELV $283
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 12616
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 84
+ADDRLP4 12616
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+LEI4 $287
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8288
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 12624
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 12624
+INDIRI4
+CNSTI4 0
+NEI4 $287
+ADDRLP4 0
+ADDRLP4 72
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $287
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8352
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 12628
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 12628
+INDIRI4
+CNSTI4 0
+EQI4 $289
+ADDRGP4 $284
+JUMPV
+LABELV $289
+ADDRLP4 76
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12632
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12632
+INDIRI4
+CNSTI4 0
+NEI4 $291
+ADDRGP4 $293
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 12636
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+ARGP4
+CNSTU4 8192
+ARGU4
+ADDRLP4 8356
+ARGP4
+ADDRLP4 12636
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddStringToList
+CALLV
+pop
+ADDRGP4 $292
+JUMPV
+LABELV $291
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $294
+ADDRLP4 4
+ARGP4
+ADDRLP4 12636
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8360
+ADDRLP4 12636
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8360
+INDIRI4
+ADDRLP4 76
+INDIRI4
+SUBI4
+ADDRLP4 8372
+INDIRI4
+LEI4 $295
+ADDRLP4 4
+ARGP4
+ADDRLP4 8440
+INDIRP4
+ARGP4
+ADDRLP4 12640
+ADDRGP4 COM_CompareExtension
+CALLI4
+ASGNI4
+ADDRLP4 12640
+INDIRI4
+CNSTI4 0
+EQI4 $295
+ADDRLP4 8360
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8372
+INDIRI4
+SUBI4
+ADDRLP4 4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $298
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12644
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+ARGP4
+CNSTU4 8192
+ARGU4
+ADDRLP4 8356
+ARGP4
+ADDRLP4 12644
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddStringToList
+CALLV
+pop
+ADDRGP4 $295
+JUMPV
+LABELV $294
+ADDRGP4 $298
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12636
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+ARGP4
+CNSTU4 8192
+ARGU4
+ADDRLP4 8356
+ARGP4
+ADDRLP4 12636
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddStringToList
+CALLV
+pop
+LABELV $295
+LABELV $292
+LABELV $284
+ADDRLP4 12616
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+ADDRLP4 12616
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 84
+INDIRI4
+ADDRLP4 12616
+INDIRI4
+ADDI4
+ADDRLP4 68
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $286
+ADDRLP4 80
+INDIRI4
+ADDRLP4 8284
+INDIRI4
+LTI4 $283
+LABELV $269
+ADDRLP4 12584
+CNSTI4 1
+ASGNI4
+ADDRLP4 8444
+ADDRLP4 8444
+INDIRI4
+ADDRLP4 12584
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8280
+ADDRLP4 8368
+INDIRI4
+ADDRLP4 12584
+INDIRI4
+ADDI4
+ADDRLP4 8280
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $271
+ADDRLP4 8444
+INDIRI4
+ADDRLP4 10496
+INDIRI4
+LTI4 $268
+LABELV $264
+ADDRLP4 8356
+INDIRI4
+CNSTI4 0
+LEI4 $299
+ADDRLP4 12580
+ADDRLP4 8356
+INDIRI4
+ASGNI4
+ADDRLP4 8356
+ADDRLP4 12580
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12580
+INDIRI4
+ADDRLP4 88
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 88
+ARGP4
+ADDRGP4 trap_Field_CompleteList
+CALLV
+pop
+LABELV $299
+LABELV $203
+endproc CG_Field_CompletePlayerModel 12648 16
+proc CG_ModelComplete 4 16
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $302
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $304
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Field_CompletePlayerModel
+CALLV
+pop
+LABELV $302
+LABELV $301
+endproc CG_ModelComplete 4 16
+proc CG_HeadmodelComplete 0 16
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $306
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 $304
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_Field_CompletePlayerModel
+CALLV
+pop
+LABELV $306
+LABELV $305
+endproc CG_HeadmodelComplete 0 16
+proc CG_TeamModelComplete 0 16
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $309
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 $311
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Field_CompletePlayerModel
+CALLV
+pop
+LABELV $309
+LABELV $308
+endproc CG_TeamModelComplete 0 16
+proc CG_TeamHeadmodelComplete 4 16
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $313
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $311
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Field_CompletePlayerModel
+CALLV
+pop
+LABELV $313
+LABELV $312
+endproc CG_TeamHeadmodelComplete 4 16
+proc CG_CameraOrbit 4 0
+ADDRLP4 0
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35960
+ADDP4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35964
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35968
+ADDP4
+CNSTF4 1120403456
+ASGNF4
+LABELV $315
+endproc CG_CameraOrbit 4 0
+proc CG_TellTarget_f 328 24
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $318
+ADDRGP4 $317
+JUMPV
+LABELV $318
+ADDRLP4 170
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $321
+ARGP4
+ADDRLP4 324
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 166
+ARGI4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 170
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $317
+endproc CG_TellTarget_f 328 24
+proc CG_TellAttacker_f 328 24
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $323
+ADDRGP4 $322
+JUMPV
+LABELV $323
+ADDRLP4 170
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $321
+ARGP4
+ADDRLP4 324
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 166
+ARGI4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 170
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $322
+endproc CG_TellAttacker_f 328 24
+proc CG_VstrDown_f 16 8
+ADDRLP4 4
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+GEI4 $326
+ADDRGP4 $328
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $325
+JUMPV
+LABELV $326
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $329
+ADDRGP4 $331
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $329
+LABELV $325
+endproc CG_VstrDown_f 16 8
+proc CG_VstrUp_f 16 8
+ADDRLP4 4
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+GEI4 $333
+ADDRGP4 $335
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $332
+JUMPV
+LABELV $333
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $336
+ADDRGP4 $331
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $336
+LABELV $332
+endproc CG_VstrUp_f 16 8
+proc CG_VstrComplete 12 12
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $341
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $339
+LABELV $341
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 $342
+ARGP4
+ADDRLP4 8
+ADDRGP4 Com_SkipTokens
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+LEU4 $343
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Field_CompleteCommand
+CALLV
+pop
+LABELV $343
+LABELV $339
+LABELV $338
+endproc CG_VstrComplete 12 12
+proc CG_StartOrbit_f 4 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $346
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+35960
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $350
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 CG_CameraOrbit
+CALLV
+pop
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTF4 1106247680
+ARGF4
+ADDRGP4 CG_CameraOrbit
+CALLV
+pop
+LABELV $351
+LABELV $347
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $346
+LABELV $345
+endproc CG_StartOrbit_f 4 8
+export CG_GenerateTracemap
+proc CG_GenerateTracemap 8 16
+ADDRGP4 cg+515560
+INDIRI4
+CNSTI4 0
+NEI4 $355
+ADDRGP4 $358
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $354
+JUMPV
+LABELV $355
+ADDRLP4 0
+ADDRGP4 CG_Trace
+ASGNP4
+ADDRLP4 0+4
+ADDRGP4 CG_PointContents
+ASGNP4
+ADDRGP4 cgs+56120
+ARGP4
+ADDRGP4 cg+515544
+ARGP4
+ADDRGP4 cg+515552
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BG_GenerateTracemap
+CALLV
+pop
+LABELV $354
+endproc CG_GenerateTracemap 8 16
+proc CG_RemapShader_f 220 12
+ADDRGP4 cg+4
+INDIRI4
+CNSTI4 0
+EQI4 $364
+ADDRGP4 $367
+ARGP4
+ADDRLP4 192
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $364
+CNSTI4 0
+ARGI4
+ADDRLP4 196
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $368
+ARGP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $363
+JUMPV
+LABELV $364
+ADDRLP4 196
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 2
+LTI4 $371
+ADDRLP4 200
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 4
+LEI4 $369
+LABELV $371
+CNSTI4 0
+ARGI4
+ADDRLP4 204
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $372
+ARGP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $363
+JUMPV
+LABELV $369
+CNSTI4 1
+ARGI4
+ADDRLP4 204
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 208
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 208
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 212
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 212
+INDIRU4
+CNSTU4 0
+NEU4 $373
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $373
+CNSTI4 3
+ARGI4
+ADDRLP4 216
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 128
+ARGP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRGP4 trap_R_RemapShader
+CALLV
+pop
+LABELV $363
+endproc CG_RemapShader_f 220 12
+export CG_Play_f
+proc CG_Play_f 24 8
+ADDRLP4 12
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+GEI4 $376
+ADDRGP4 $378
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $375
+JUMPV
+LABELV $376
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $382
+JUMPV
+LABELV $379
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $383
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $383
+LABELV $380
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $382
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $379
+LABELV $375
+endproc CG_Play_f 24 8
+proc CG_PlayComplete 4 16
+ADDRGP4 $386
+ARGP4
+ADDRGP4 $387
+ARGP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_Field_CompleteFilename
+CALLV
+pop
+LABELV $385
+endproc CG_PlayComplete 4 16
+export CG_Music_f
+proc CG_Music_f 160 16
+ADDRLP4 140
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $391
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LEI4 $389
+LABELV $391
+ADDRGP4 $392
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $388
+JUMPV
+LABELV $389
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 68
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 148
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 132
+ADDRLP4 148
+INDIRF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 148
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LEI4 $393
+CNSTI4 3
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 156
+INDIRF4
+ASGNF4
+LABELV $393
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LEI4 $395
+CNSTI4 4
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 156
+INDIRF4
+ASGNF4
+LABELV $395
+ADDRLP4 4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRGP4 trap_S_StartBackgroundTrack
+CALLV
+pop
+LABELV $388
+endproc CG_Music_f 160 16
+proc CG_MusicComplete 8 16
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $400
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $398
+LABELV $400
+ADDRGP4 $386
+ARGP4
+ADDRGP4 $387
+ARGP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Field_CompleteFilename
+CALLV
+pop
+LABELV $398
+LABELV $397
+endproc CG_MusicComplete 8 16
+export CG_StopMusic_f
+proc CG_StopMusic_f 0 0
+ADDRGP4 trap_S_StopBackgroundTrack
+CALLV
+pop
+LABELV $401
+endproc CG_StopMusic_f 0 0
+export CG_StopCinematic_f
+proc CG_StopCinematic_f 0 4
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+NEI4 $403
+ADDRGP4 $402
+JUMPV
+LABELV $403
+ADDRGP4 trap_S_StopAllSounds
+CALLV
+pop
+ADDRGP4 cg+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+ADDRGP4 cg+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+12
+CNSTI4 0
+ASGNI4
+LABELV $402
+endproc CG_StopCinematic_f 0 4
+export CG_Cinematic_f
+proc CG_Cinematic_f 132 24
+ADDRLP4 88
+CNSTI4 1
+ASGNI4
+ADDRLP4 96
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 2
+LTI4 $412
+ADDRLP4 92
+INDIRI4
+CNSTI4 3
+LEI4 $410
+LABELV $412
+ADDRGP4 $413
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $409
+JUMPV
+LABELV $410
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $414
+ADDRGP4 CG_StopCinematic_f
+CALLV
+pop
+LABELV $414
+CNSTI4 1
+ARGI4
+ADDRLP4 6
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 49
+EQI4 $424
+ADDRLP4 0
+ARGP4
+ADDRGP4 $419
+ARGP4
+ADDRLP4 104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+EQI4 $424
+ADDRLP4 6
+ARGP4
+ADDRGP4 $420
+ARGP4
+ADDRLP4 108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+EQI4 $424
+ADDRLP4 6
+ARGP4
+ADDRGP4 $421
+ARGP4
+ADDRLP4 112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+NEI4 $417
+LABELV $424
+ADDRLP4 88
+ADDRLP4 88
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $417
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 50
+EQI4 $428
+ADDRLP4 0
+ARGP4
+ADDRGP4 $427
+ARGP4
+ADDRLP4 116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+NEI4 $425
+LABELV $428
+ADDRLP4 88
+ADDRLP4 88
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $425
+ADDRGP4 trap_S_StopAllSounds
+CALLV
+pop
+ADDRLP4 120
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+ADDRLP4 120
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 120
+INDIRF4
+ASGNF4
+ADDRLP4 80
+CNSTF4 1142947840
+ASGNF4
+ADDRLP4 84
+CNSTF4 1139802112
+ASGNF4
+ADDRLP4 124
+CNSTI4 1
+ASGNI4
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 72
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 6
+ARGP4
+ADDRLP4 72
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 80
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 84
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRGP4 cg+16
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRGP4 cg+16
+INDIRI4
+CNSTI4 0
+LTI4 $430
+ADDRGP4 cg+12
+CNSTI4 1
+ASGNI4
+LABELV $430
+LABELV $409
+endproc CG_Cinematic_f 132 24
+proc CG_CinematicComplete 4 16
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $435
+ADDRGP4 $386
+ARGP4
+ADDRGP4 $437
+ARGP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_Field_CompleteFilename
+CALLV
+pop
+LABELV $435
+LABELV $434
+endproc CG_CinematicComplete 4 16
+export CG_ToggleMenu_f
+proc CG_ToggleMenu_f 12 24
+ADDRLP4 0
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+CNSTI4 27
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 cg
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+CNSTI4 27
+ARGI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 cg
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+LABELV $438
+endproc CG_ToggleMenu_f 12 24
+proc CG_ForwardToServer_f 8196 8
+ADDRGP4 cg+4
+INDIRI4
+CNSTI4 0
+EQI4 $440
+ADDRLP4 8192
+ADDRGP4 trap_GetDemoState
+CALLI4
+ASGNI4
+ADDRLP4 8192
+INDIRI4
+CNSTI4 1
+EQI4 $440
+ADDRLP4 0
+ARGP4
+CNSTI4 8192
+ARGI4
+ADDRGP4 trap_LiteralArgs
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $440
+LABELV $439
+endproc CG_ForwardToServer_f 8196 8
+proc CG_Field_CompletePlayerName 4192 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $444
+ADDRGP4 $443
+JUMPV
+LABELV $444
+ADDRLP4 72
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4096
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4172
+CNSTI4 0
+ASGNI4
+ADDRLP4 4168
+ADDRLP4 4172
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 4172
+INDIRI4
+ASGNI4
+ADDRGP4 $450
+JUMPV
+LABELV $447
+ADDRLP4 0
+CNSTI4 2044
+ADDRLP4 68
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $453
+ADDRGP4 $448
+JUMPV
+LABELV $453
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1
+EQI4 $455
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $458
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $457
+LABELV $458
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $455
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $455
+LABELV $457
+ADDRGP4 $448
+JUMPV
+LABELV $455
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $459
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 4180
+ADDRGP4 CG_LocalPlayerState
+CALLP4
+ASGNP4
+ADDRLP4 4180
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $459
+ADDRGP4 $448
+JUMPV
+LABELV $459
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 4184
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4184
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $461
+ADDRGP4 $463
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 4188
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 72
+ARGP4
+CNSTU4 4096
+ARGU4
+ADDRLP4 4168
+ARGP4
+ADDRLP4 4188
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddStringToList
+CALLV
+pop
+ADDRGP4 $462
+JUMPV
+LABELV $461
+ADDRLP4 72
+ARGP4
+CNSTU4 4096
+ARGU4
+ADDRLP4 4168
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_AddStringToList
+CALLV
+pop
+LABELV $462
+LABELV $448
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $450
+ADDRLP4 68
+INDIRI4
+ADDRGP4 cgs+56116
+INDIRI4
+LTI4 $447
+ADDRLP4 4168
+INDIRI4
+CNSTI4 0
+LEI4 $464
+ADDRLP4 4176
+ADDRLP4 4168
+INDIRI4
+ASGNI4
+ADDRLP4 4168
+ADDRLP4 4176
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 72
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 72
+ARGP4
+ADDRGP4 trap_Field_CompleteList
+CALLV
+pop
+LABELV $464
+LABELV $443
+endproc CG_Field_CompletePlayerName 4192 16
+proc CG_TellComplete 4 12
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $467
+CNSTI4 -1
+ARGI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Field_CompletePlayerName
+CALLV
+pop
+LABELV $467
+LABELV $466
+endproc CG_TellComplete 4 12
+lit
+align 1
+LABELV $470
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 0
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+byte 1 0
+code
+proc CG_GiveComplete 2172 16
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 2076
+ADDRGP4 $470
+INDIRB
+ASGNB 80
+ADDRLP4 20
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2048
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 2072
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $471
+ADDRLP4 20
+ARGP4
+ADDRLP4 2076
+ARGP4
+CNSTU4 79
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 2072
+CNSTI4 79
+ASGNI4
+LABELV $471
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 2156
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 2156
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $473
+ADDRLP4 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 2160
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 2068
+ADDRLP4 2160
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $474
+JUMPV
+LABELV $473
+ADDRLP4 2068
+CNSTI4 0
+ASGNI4
+LABELV $474
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $478
+JUMPV
+LABELV $475
+ADDRLP4 16
+CNSTI4 48
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $479
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2068
+INDIRI4
+ARGI4
+ADDRLP4 2164
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 2164
+INDIRI4
+CNSTI4 0
+EQI4 $479
+ADDRGP4 $476
+JUMPV
+LABELV $479
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $484
+JUMPV
+LABELV $481
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 2168
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2168
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $485
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $485
+LABELV $482
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $484
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+SUBI4
+GEI4 $487
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $481
+LABELV $487
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $488
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $488
+ADDRLP4 20
+ARGP4
+CNSTU4 2048
+ARGU4
+ADDRLP4 2072
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddStringToList
+CALLV
+pop
+LABELV $488
+LABELV $476
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $478
+ADDRLP4 8
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $475
+ADDRLP4 2072
+INDIRI4
+CNSTI4 0
+LEI4 $490
+ADDRLP4 2160
+ADDRLP4 2072
+INDIRI4
+ASGNI4
+ADDRLP4 2072
+ADDRLP4 2160
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 2160
+INDIRI4
+ADDRLP4 20
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 20
+ARGP4
+ADDRGP4 trap_Field_CompleteList
+CALLV
+pop
+LABELV $490
+LABELV $469
+endproc CG_GiveComplete 2172 16
+proc CG_FollowComplete 4 12
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $493
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Field_CompletePlayerName
+CALLV
+pop
+LABELV $493
+LABELV $492
+endproc CG_FollowComplete 4 12
+proc CG_TeamComplete 0 4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $496
+ADDRGP4 $498
+ARGP4
+ADDRGP4 trap_Field_CompleteList
+CALLV
+pop
+LABELV $496
+LABELV $495
+endproc CG_TeamComplete 0 4
+proc CG_CallVoteComplete 16 16
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $500
+ADDRGP4 $502
+ARGP4
+ADDRGP4 trap_Field_CompleteList
+CALLV
+pop
+LABELV $500
+ADDRFP4 8
+INDIRI4
+CNSTI4 3
+NEI4 $503
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $505
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $503
+CNSTI4 -1
+ARGI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Field_CompletePlayerName
+CALLV
+pop
+LABELV $503
+ADDRFP4 8
+INDIRI4
+CNSTI4 3
+NEI4 $506
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $508
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $506
+ADDRGP4 $509
+ARGP4
+ADDRGP4 $510
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Field_CompleteFilename
+CALLV
+pop
+LABELV $506
+LABELV $499
+endproc CG_CallVoteComplete 16 16
+proc CG_VoteComplete 0 4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $512
+ADDRGP4 $514
+ARGP4
+ADDRGP4 trap_Field_CompleteList
+CALLV
+pop
+LABELV $512
+LABELV $511
+endproc CG_VoteComplete 0 4
+proc CG_CallTeamVoteComplete 28 12
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $516
+ADDRGP4 $515
+JUMPV
+LABELV $516
+ADDRLP4 4
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $520
+ADDRGP4 $515
+JUMPV
+LABELV $520
+ADDRLP4 8
+CNSTI4 2044
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $523
+ADDRGP4 $515
+JUMPV
+LABELV $523
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $525
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $525
+ADDRGP4 $515
+JUMPV
+LABELV $525
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $527
+ADDRGP4 $529
+ARGP4
+ADDRGP4 trap_Field_CompleteList
+CALLV
+pop
+LABELV $527
+ADDRFP4 8
+INDIRI4
+CNSTI4 3
+NEI4 $530
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $532
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $530
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_Field_CompletePlayerName
+CALLV
+pop
+LABELV $530
+LABELV $515
+endproc CG_CallTeamVoteComplete 28 12
+data
+align 4
+LABELV cg_commands
+address $533
+address CG_VstrDown_f
+byte 4 0
+address CG_VstrComplete
+address $534
+address CG_VstrUp_f
+byte 4 0
+address CG_VstrComplete
+address $535
+address CG_TestGun_f
+byte 4 1
+address CG_TestModelComplete
+address $536
+address CG_TestModel_f
+byte 4 1
+address CG_TestModelComplete
+address $537
+address CG_TestModelNextFrame_f
+byte 4 1
+skip 4
+address $538
+address CG_TestModelPrevFrame_f
+byte 4 1
+skip 4
+address $539
+address CG_TestModelNextSkin_f
+byte 4 1
+skip 4
+address $540
+address CG_TestModelPrevSkin_f
+byte 4 1
+skip 4
+address $541
+address CG_SizeUp_f
+byte 4 0
+skip 4
+address $542
+address CG_SizeDown_f
+byte 4 0
+skip 4
+address $543
+address CG_StartOrbit_f
+byte 4 1
+skip 4
+address $544
+address CG_LoadDeferredPlayers
+byte 4 1
+skip 4
+address $545
+address CG_GenerateTracemap
+byte 4 1
+skip 4
+address $546
+address CG_RemapShader_f
+byte 4 0
+skip 4
+address $547
+address CG_Play_f
+byte 4 0
+address CG_PlayComplete
+address $548
+address CG_Music_f
+byte 4 0
+address CG_MusicComplete
+address $549
+address CG_StopMusic_f
+byte 4 0
+skip 4
+address $550
+address CG_Cinematic_f
+byte 4 0
+address CG_CinematicComplete
+address $551
+address CG_StopCinematic_f
+byte 4 0
+skip 4
+address $552
+address CG_MessageMode_f
+skip 8
+address $553
+address CG_MessageMode2_f
+skip 8
+address $554
+address CG_MessageMode3_f
+skip 8
+address $555
+address CG_MessageMode4_f
+skip 8
+address $556
+address Con_ClearConsole_f
+skip 8
+address $557
+address Con_ToggleConsole_f
+skip 8
+address $558
+address CG_ToggleMenu_f
+skip 8
+align 4
+LABELV cg_numCommands
+byte 4 26
+align 4
+LABELV playerCommands
+address $560
+address IN_Button0Down
+byte 4 0
+skip 4
+address $561
+address IN_Button0Up
+byte 4 0
+skip 4
+address $562
+address IN_BackDown
+byte 4 0
+skip 4
+address $563
+address IN_BackUp
+byte 4 0
+skip 4
+address $564
+address IN_Button0Down
+byte 4 0
+skip 4
+address $565
+address IN_Button0Up
+byte 4 0
+skip 4
+address $566
+address IN_Button10Down
+byte 4 0
+skip 4
+address $567
+address IN_Button10Up
+byte 4 0
+skip 4
+address $568
+address IN_Button11Down
+byte 4 0
+skip 4
+address $569
+address IN_Button11Up
+byte 4 0
+skip 4
+address $570
+address IN_Button12Down
+byte 4 0
+skip 4
+address $571
+address IN_Button12Up
+byte 4 0
+skip 4
+address $572
+address IN_Button13Down
+byte 4 0
+skip 4
+address $573
+address IN_Button13Up
+byte 4 0
+skip 4
+address $574
+address IN_Button14Down
+byte 4 0
+skip 4
+address $575
+address IN_Button14Up
+byte 4 0
+skip 4
+address $576
+address IN_Button1Down
+byte 4 0
+skip 4
+address $577
+address IN_Button1Up
+byte 4 0
+skip 4
+address $578
+address IN_Button2Down
+byte 4 0
+skip 4
+address $579
+address IN_Button2Up
+byte 4 0
+skip 4
+address $580
+address IN_Button3Down
+byte 4 0
+skip 4
+address $581
+address IN_Button3Up
+byte 4 0
+skip 4
+address $582
+address IN_Button4Down
+byte 4 0
+skip 4
+address $583
+address IN_Button4Up
+byte 4 0
+skip 4
+address $584
+address IN_Button5Down
+byte 4 0
+skip 4
+address $585
+address IN_Button5Up
+byte 4 0
+skip 4
+address $586
+address IN_Button6Down
+byte 4 0
+skip 4
+address $587
+address IN_Button6Up
+byte 4 0
+skip 4
+address $588
+address IN_Button7Down
+byte 4 0
+skip 4
+address $589
+address IN_Button7Up
+byte 4 0
+skip 4
+address $590
+address IN_Button8Down
+byte 4 0
+skip 4
+address $591
+address IN_Button8Up
+byte 4 0
+skip 4
+address $592
+address IN_Button9Down
+byte 4 0
+skip 4
+address $593
+address IN_Button9Up
+byte 4 0
+skip 4
+address $594
+address IN_ForwardDown
+byte 4 0
+skip 4
+address $595
+address IN_ForwardUp
+byte 4 0
+skip 4
+address $596
+address IN_Button3Down
+byte 4 0
+skip 4
+address $597
+address IN_Button3Up
+byte 4 0
+skip 4
+address $598
+address IN_LeftDown
+byte 4 0
+skip 4
+address $599
+address IN_LeftUp
+byte 4 0
+skip 4
+address $600
+address IN_LookdownDown
+byte 4 0
+skip 4
+address $601
+address IN_LookdownUp
+byte 4 0
+skip 4
+address $602
+address IN_LookupDown
+byte 4 0
+skip 4
+address $603
+address IN_LookupUp
+byte 4 0
+skip 4
+address $604
+address IN_MLookDown
+byte 4 0
+skip 4
+address $605
+address IN_MLookUp
+byte 4 0
+skip 4
+address $606
+address IN_DownDown
+byte 4 0
+skip 4
+address $607
+address IN_DownUp
+byte 4 0
+skip 4
+address $608
+address IN_MoveleftDown
+byte 4 0
+skip 4
+address $609
+address IN_MoveleftUp
+byte 4 0
+skip 4
+address $610
+address IN_MoverightDown
+byte 4 0
+skip 4
+address $611
+address IN_MoverightUp
+byte 4 0
+skip 4
+address $612
+address IN_UpDown
+byte 4 0
+skip 4
+address $613
+address IN_UpUp
+byte 4 0
+skip 4
+address $614
+address IN_RightDown
+byte 4 0
+skip 4
+address $615
+address IN_RightUp
+byte 4 0
+skip 4
+address $616
+address CG_ScoresDown_f
+byte 4 1
+skip 4
+address $617
+address CG_ScoresUp_f
+byte 4 1
+skip 4
+address $618
+address IN_SpeedDown
+byte 4 0
+skip 4
+address $619
+address IN_SpeedUp
+byte 4 0
+skip 4
+address $620
+address IN_StrafeDown
+byte 4 0
+skip 4
+address $621
+address IN_StrafeUp
+byte 4 0
+skip 4
+address $622
+address IN_Button2Down
+byte 4 0
+skip 4
+address $623
+address IN_Button2Up
+byte 4 0
+skip 4
+address $624
+address CG_ZoomDown_f
+byte 4 1
+skip 4
+address $625
+address CG_ZoomUp_f
+byte 4 1
+skip 4
+address $626
+address CG_CenterEcho_f
+byte 4 1
+skip 4
+address $627
+address IN_CenterView
+byte 4 0
+skip 4
+address $190
+address CG_SetHeadmodel_f
+byte 4 0
+address CG_HeadmodelComplete
+address $628
+address CG_TargetCommand_f
+byte 4 1
+skip 4
+address $196
+address CG_SetTeamModel_f
+byte 4 0
+address CG_TeamModelComplete
+address $199
+address CG_SetTeamHeadmodel_f
+byte 4 0
+address CG_TeamHeadmodelComplete
+address $629
+address CG_TellTarget_f
+byte 4 1
+skip 4
+address $630
+address CG_TellAttacker_f
+byte 4 1
+skip 4
+address $187
+address CG_SetModel_f
+byte 4 0
+address CG_ModelComplete
+address $631
+address CG_Viewpos_f
+byte 4 1
+skip 4
+address $632
+address CG_NextWeapon_f
+byte 4 1
+skip 4
+address $633
+address CG_PrevWeapon_f
+byte 4 1
+skip 4
+address $634
+address CG_Weapon_f
+byte 4 1
+skip 4
+address $635
+address CG_WeaponToggle_f
+byte 4 1
+skip 4
+address $108
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $118
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $321
+address CG_ForwardToServer_f
+byte 4 1
+address CG_TellComplete
+address $636
+address CG_ForwardToServer_f
+byte 4 1
+address CG_GiveComplete
+address $637
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $638
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $639
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $640
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $641
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $642
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $643
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $644
+address CG_ForwardToServer_f
+byte 4 1
+address CG_FollowComplete
+address $645
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $646
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $647
+address CG_ForwardToServer_f
+byte 4 1
+address CG_TeamComplete
+address $648
+address CG_ForwardToServer_f
+byte 4 1
+address CG_CallVoteComplete
+address $649
+address CG_ForwardToServer_f
+byte 4 1
+address CG_VoteComplete
+address $650
+address CG_ForwardToServer_f
+byte 4 1
+address CG_CallTeamVoteComplete
+address $651
+address CG_ForwardToServer_f
+byte 4 1
+address CG_VoteComplete
+address $652
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $653
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+align 4
+LABELV numPlayerCommands
+byte 4 101
+code
+proc CG_CheckCmdFlags 4 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $655
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $655
+ADDRGP4 $658
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $654
+JUMPV
+LABELV $655
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 0
+INDIRI4
+EQI4 $659
+ADDRGP4 cg+4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $659
+ADDRGP4 $662
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $654
+JUMPV
+LABELV $659
+CNSTI4 0
+RETI4
+LABELV $654
+endproc CG_CheckCmdFlags 4 8
+export CG_ConsoleCommand
+proc CG_ConsoleCommand 36 8
+ADDRGP4 cg
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ConsoleCommand
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Com_LocalPlayerForCvarName
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Com_LocalPlayerBaseCvarName
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $667
+JUMPV
+LABELV $664
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 playerCommands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $668
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 playerCommands+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_CheckCmdFlags
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $670
+CNSTI4 1
+RETI4
+ADDRGP4 $663
+JUMPV
+LABELV $670
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 playerCommands+4
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $663
+JUMPV
+LABELV $668
+LABELV $665
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $667
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numPlayerCommands
+INDIRI4
+LTI4 $664
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $674
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $679
+JUMPV
+LABELV $676
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 cg_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $680
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 cg_commands+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_CheckCmdFlags
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $682
+CNSTI4 1
+RETI4
+ADDRGP4 $663
+JUMPV
+LABELV $682
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 cg_commands+4
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $663
+JUMPV
+LABELV $680
+LABELV $677
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $679
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg_numCommands
+INDIRI4
+LTI4 $676
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $689
+JUMPV
+LABELV $686
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 ui_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $690
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 ui_commands+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_CheckCmdFlags
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $692
+CNSTI4 1
+RETI4
+ADDRGP4 $663
+JUMPV
+LABELV $692
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 ui_commands+4
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $663
+JUMPV
+LABELV $690
+LABELV $687
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $689
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numCommands
+INDIRI4
+LTI4 $686
+LABELV $674
+CNSTI4 0
+RETI4
+LABELV $663
+endproc CG_ConsoleCommand 36 8
+export CG_ConsoleCompleteArgument
+proc CG_ConsoleCompleteArgument 9244 12
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg
+ADDRFP4 0
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1028
+ARGP4
+CNSTI4 8192
+ARGI4
+ADDRGP4 trap_LiteralArgs
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 9228
+ADDRGP4 Com_LocalPlayerForCvarName
+CALLI4
+ASGNI4
+ADDRLP4 9224
+ADDRLP4 9228
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 9232
+ADDRGP4 Com_LocalPlayerBaseCvarName
+CALLP4
+ASGNP4
+ADDRLP4 9220
+ADDRLP4 9232
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $700
+JUMPV
+LABELV $697
+ADDRLP4 9236
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 9236
+INDIRI4
+ADDRGP4 playerCommands+12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $701
+ADDRLP4 9220
+INDIRP4
+ARGP4
+ADDRLP4 9236
+INDIRI4
+ADDRGP4 playerCommands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 9240
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 9240
+INDIRI4
+CNSTI4 0
+NEI4 $701
+ADDRLP4 9224
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 playerCommands+12
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $696
+JUMPV
+LABELV $701
+LABELV $698
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $700
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numPlayerCommands
+INDIRI4
+LTI4 $697
+ADDRLP4 9224
+INDIRI4
+CNSTI4 0
+NEI4 $705
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $710
+JUMPV
+LABELV $707
+ADDRLP4 9236
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 9236
+INDIRI4
+ADDRGP4 cg_commands+12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $711
+ADDRLP4 4
+ARGP4
+ADDRLP4 9236
+INDIRI4
+ADDRGP4 cg_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 9240
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 9240
+INDIRI4
+CNSTI4 0
+NEI4 $711
+ADDRLP4 1028
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 cg_commands+12
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $696
+JUMPV
+LABELV $711
+LABELV $708
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $710
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg_numCommands
+INDIRI4
+LTI4 $707
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $718
+JUMPV
+LABELV $715
+ADDRLP4 9236
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 9236
+INDIRI4
+ADDRGP4 ui_commands+12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $719
+ADDRLP4 4
+ARGP4
+ADDRLP4 9236
+INDIRI4
+ADDRGP4 ui_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 9240
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 9240
+INDIRI4
+CNSTI4 0
+NEI4 $719
+ADDRLP4 1028
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 ui_commands+12
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $696
+JUMPV
+LABELV $719
+LABELV $716
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $718
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numCommands
+INDIRI4
+LTI4 $715
+LABELV $705
+CNSTI4 0
+RETI4
+LABELV $696
+endproc CG_ConsoleCompleteArgument 9244 12
+export CG_InitConsoleCommands
+proc CG_InitConsoleCommands 12 8
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $727
+JUMPV
+LABELV $724
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 cg_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+LABELV $725
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $727
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg_numCommands
+INDIRI4
+LTI4 $724
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $731
+JUMPV
+LABELV $728
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 ui_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+LABELV $729
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $731
+ADDRLP4 4
+INDIRI4
+ADDRGP4 ui_numCommands
+INDIRI4
+LTI4 $728
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $735
+JUMPV
+LABELV $732
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $739
+JUMPV
+LABELV $736
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 playerCommands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+LABELV $737
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $739
+ADDRLP4 8
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $736
+LABELV $733
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $735
+ADDRLP4 4
+INDIRI4
+ADDRGP4 numPlayerCommands
+INDIRI4
+LTI4 $732
+LABELV $723
+endproc CG_InitConsoleCommands 12 8
+import UI_DrawProportionalString
+import UI_WindowResized
+import UI_WantsBindKeys
+import UI_DrawConnectScreen
+import UI_ConsoleCommand
+import UI_SetActiveMenu
+import UI_Refresh
+import UI_IsFullscreen
+import UI_SetCursorPos
+import UI_GetCursorPos
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import ui_numCommands
+import ui_commands
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_drawScores
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $662
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $658
+byte 1 77
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $653
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $652
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $651
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $650
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $649
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $648
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $647
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $646
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $645
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $644
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $643
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $642
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $641
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $640
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $639
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $638
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $637
+byte 1 103
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $636
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $635
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 84
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $634
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $633
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $632
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $631
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $630
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $629
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $628
+byte 1 116
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 0
+align 1
+LABELV $627
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $626
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 0
+align 1
+LABELV $625
+byte 1 45
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $624
+byte 1 43
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $623
+byte 1 45
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $622
+byte 1 43
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $621
+byte 1 45
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 102
+byte 1 101
+byte 1 0
+align 1
+LABELV $620
+byte 1 43
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 102
+byte 1 101
+byte 1 0
+align 1
+LABELV $619
+byte 1 45
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $618
+byte 1 43
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $617
+byte 1 45
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $616
+byte 1 43
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $615
+byte 1 45
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $614
+byte 1 43
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $613
+byte 1 45
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $612
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $611
+byte 1 45
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $610
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $609
+byte 1 45
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $608
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $607
+byte 1 45
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $606
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $605
+byte 1 45
+byte 1 109
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $604
+byte 1 43
+byte 1 109
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $603
+byte 1 45
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $602
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $601
+byte 1 45
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $600
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $599
+byte 1 45
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $598
+byte 1 43
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $597
+byte 1 45
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $596
+byte 1 43
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $595
+byte 1 45
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $594
+byte 1 43
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $593
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 57
+byte 1 0
+align 1
+LABELV $592
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 57
+byte 1 0
+align 1
+LABELV $591
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 56
+byte 1 0
+align 1
+LABELV $590
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 56
+byte 1 0
+align 1
+LABELV $589
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 55
+byte 1 0
+align 1
+LABELV $588
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 55
+byte 1 0
+align 1
+LABELV $587
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 54
+byte 1 0
+align 1
+LABELV $586
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 54
+byte 1 0
+align 1
+LABELV $585
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 53
+byte 1 0
+align 1
+LABELV $584
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 53
+byte 1 0
+align 1
+LABELV $583
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 52
+byte 1 0
+align 1
+LABELV $582
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 52
+byte 1 0
+align 1
+LABELV $581
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $580
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $579
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 50
+byte 1 0
+align 1
+LABELV $578
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 50
+byte 1 0
+align 1
+LABELV $577
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 0
+align 1
+LABELV $576
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 0
+align 1
+LABELV $575
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 52
+byte 1 0
+align 1
+LABELV $574
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 52
+byte 1 0
+align 1
+LABELV $573
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $572
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $571
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $570
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $569
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $568
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $567
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $566
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $565
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 48
+byte 1 0
+align 1
+LABELV $564
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 48
+byte 1 0
+align 1
+LABELV $563
+byte 1 45
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $562
+byte 1 43
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $561
+byte 1 45
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $560
+byte 1 43
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $558
+byte 1 116
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $557
+byte 1 116
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $556
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $555
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 52
+byte 1 0
+align 1
+LABELV $554
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $553
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $552
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $551
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $550
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $549
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $548
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $547
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $546
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $545
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $544
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $543
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $542
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $541
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $540
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $539
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $538
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $537
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $536
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $535
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $534
+byte 1 45
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 0
+align 1
+LABELV $533
+byte 1 43
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 0
+align 1
+LABELV $532
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $529
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+byte 1 0
+align 1
+LABELV $514
+byte 1 110
+byte 1 111
+byte 1 0
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+byte 1 0
+align 1
+LABELV $510
+byte 1 46
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $509
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $508
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $505
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $502
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 0
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 0
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+byte 1 0
+align 1
+LABELV $498
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 49
+byte 1 0
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 50
+byte 1 0
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 0
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+byte 1 0
+align 1
+LABELV $463
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $437
+byte 1 36
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $427
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $421
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 114
+byte 1 111
+byte 1 113
+byte 1 0
+align 1
+LABELV $420
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 114
+byte 1 111
+byte 1 113
+byte 1 0
+align 1
+LABELV $419
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $413
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 60
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 124
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $392
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 60
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 118
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 118
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $387
+byte 1 36
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $386
+byte 1 0
+align 1
+LABELV $378
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 60
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $372
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 60
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $368
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $367
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $358
+byte 1 78
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 99
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $342
+byte 1 32
+byte 1 0
+align 1
+LABELV $335
+byte 1 45
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 60
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $331
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $328
+byte 1 43
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 60
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $321
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $320
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $311
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $304
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $298
+byte 1 42
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $293
+byte 1 42
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $282
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $267
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $263
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $248
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $247
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $242
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $241
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $240
+byte 1 46
+byte 1 0
+align 1
+LABELV $229
+byte 1 47
+byte 1 0
+align 1
+LABELV $228
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $217
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $216
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $209
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 0
+align 1
+LABELV $208
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 0
+align 1
+LABELV $199
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $196
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $191
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $190
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $187
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $176
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $156
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $135
+byte 1 84
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $132
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $121
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 83
+byte 1 97
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $118
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $111
+byte 1 83
+byte 1 97
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $108
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $102
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $100
+byte 1 103
+byte 1 99
+byte 1 0
+align 1
+LABELV $99
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
@@ -0,0 +1,12780 @@
+data
+export drawTeamOverlayModificationCount
+align 4
+LABELV drawTeamOverlayModificationCount
+byte 4 -1
+code
+proc CG_DrawField 52 20
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+GEI4 $97
+ADDRGP4 $96
+JUMPV
+LABELV $97
+ADDRFP4 12
+INDIRI4
+CNSTI4 5
+LEI4 $99
+ADDRFP4 12
+CNSTI4 5
+ASGNI4
+LABELV $99
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+LTI4 $101
+ADDRFP4 12
+INDIRI4
+CNSTI4 4
+GTI4 $101
+ADDRFP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $131-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $131
+address $103
+address $110
+address $117
+address $124
+code
+LABELV $103
+ADDRFP4 16
+INDIRI4
+CNSTI4 9
+LEI4 $105
+ADDRLP4 20
+CNSTI4 9
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $105
+ADDRLP4 20
+ADDRFP4 16
+INDIRI4
+ASGNI4
+LABELV $106
+ADDRFP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+GEI4 $108
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $109
+JUMPV
+LABELV $108
+ADDRLP4 24
+ADDRFP4 16
+INDIRI4
+ASGNI4
+LABELV $109
+ADDRFP4 16
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $102
+JUMPV
+LABELV $110
+ADDRFP4 16
+INDIRI4
+CNSTI4 99
+LEI4 $112
+ADDRLP4 28
+CNSTI4 99
+ASGNI4
+ADDRGP4 $113
+JUMPV
+LABELV $112
+ADDRLP4 28
+ADDRFP4 16
+INDIRI4
+ASGNI4
+LABELV $113
+ADDRFP4 16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+CNSTI4 -9
+GEI4 $115
+ADDRLP4 32
+CNSTI4 -9
+ASGNI4
+ADDRGP4 $116
+JUMPV
+LABELV $115
+ADDRLP4 32
+ADDRFP4 16
+INDIRI4
+ASGNI4
+LABELV $116
+ADDRFP4 16
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $102
+JUMPV
+LABELV $117
+ADDRFP4 16
+INDIRI4
+CNSTI4 999
+LEI4 $119
+ADDRLP4 36
+CNSTI4 999
+ASGNI4
+ADDRGP4 $120
+JUMPV
+LABELV $119
+ADDRLP4 36
+ADDRFP4 16
+INDIRI4
+ASGNI4
+LABELV $120
+ADDRFP4 16
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+CNSTI4 -99
+GEI4 $122
+ADDRLP4 40
+CNSTI4 -99
+ASGNI4
+ADDRGP4 $123
+JUMPV
+LABELV $122
+ADDRLP4 40
+ADDRFP4 16
+INDIRI4
+ASGNI4
+LABELV $123
+ADDRFP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $102
+JUMPV
+LABELV $124
+ADDRFP4 16
+INDIRI4
+CNSTI4 9999
+LEI4 $126
+ADDRLP4 44
+CNSTI4 9999
+ASGNI4
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRLP4 44
+ADDRFP4 16
+INDIRI4
+ASGNI4
+LABELV $127
+ADDRFP4 16
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+CNSTI4 -999
+GEI4 $129
+ADDRLP4 48
+CNSTI4 -999
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $129
+ADDRLP4 48
+ADDRFP4 16
+INDIRI4
+ASGNI4
+LABELV $130
+ADDRFP4 16
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $101
+LABELV $102
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $133
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+ADDI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 394499
+BORI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $96
+endproc CG_DrawField 52 20
+export CG_Draw3DModelEx
+proc CG_Draw3DModelEx 684 16
+ADDRFP4 32
+ADDRFP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 676
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 676
+INDIRI4
+EQI4 $139
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 676
+INDIRI4
+NEI4 $135
+LABELV $139
+ADDRGP4 $134
+JUMPV
+LABELV $135
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 448
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 448
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 228
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 448+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 448+68
+ADDRFP4 24
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 448+8
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 680
+ADDRGP4 CG_AddSkinToFrame
+CALLI4
+ASGNI4
+ADDRLP4 448+116
+ADDRLP4 680
+INDIRI4
+ASGNI4
+ADDRLP4 448+4
+CNSTI4 64
+ASGNI4
+ADDRFP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $145
+ADDRLP4 448+124
+ADDRFP4 32
+INDIRP4
+INDIRU1
+ASGNU1
+ADDRLP4 448+124+1
+ADDRFP4 32
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 448+124+2
+ADDRFP4 32
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 448+124+3
+ADDRFP4 32
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+ASGNU1
+LABELV $145
+ADDRLP4 0+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0+16
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0+20
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+72
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRLP4 448
+ARGP4
+ADDRGP4 CG_AddRefEntityWithMinLight
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $134
+endproc CG_Draw3DModelEx 684 16
+export CG_Draw3DModel
+proc CG_Draw3DModel 0 36
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModelEx
+CALLV
+pop
+LABELV $163
+endproc CG_Draw3DModel 0 36
+export CG_DrawHead
+proc CG_DrawHead 60 36
+ADDRLP4 0
+CNSTI4 2044
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $166
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $169
+ADDRGP4 $164
+JUMPV
+LABELV $169
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_R_ModelBounds
+CALLI4
+pop
+ADDRLP4 4+8
+CNSTF4 3204448256
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1056964608
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 44
+CNSTF4 1060320051
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ARGP4
+ADDRGP4 CG_Draw3DModelEx
+CALLV
+pop
+ADDRGP4 $167
+JUMPV
+LABELV $166
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $183
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 876
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $183
+LABELV $167
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $186
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 cgs+679680+124648
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $186
+LABELV $164
+endproc CG_DrawHead 60 36
+export CG_DrawFlagModel
+proc CG_DrawFlagModel 76 32
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $191
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $191
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 cgs+679680+123352
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_R_ModelBounds
+CALLI4
+pop
+ADDRLP4 12+8
+CNSTF4 3204448256
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1056964608
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 1056964608
+ADDRLP4 36+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 52
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRGP4 cg+512320
+INDIRI4
+CVIF4 4
+CNSTF4 1157234688
+DIVF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 1114636288
+ADDRLP4 72
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $208
+ADDRLP4 56
+ADDRGP4 cgs+679680+123352
+INDIRI4
+ASGNI4
+ADDRGP4 $209
+JUMPV
+LABELV $208
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $212
+ADDRLP4 56
+ADDRGP4 cgs+679680+123356
+INDIRI4
+ASGNI4
+ADDRGP4 $213
+JUMPV
+LABELV $212
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $190
+ADDRLP4 56
+ADDRGP4 cgs+679680+123360
+INDIRI4
+ASGNI4
+LABELV $217
+LABELV $213
+LABELV $209
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $192
+JUMPV
+LABELV $191
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $220
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $223
+CNSTI4 7
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $224
+JUMPV
+LABELV $223
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $225
+CNSTI4 8
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $226
+JUMPV
+LABELV $225
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $190
+CNSTI4 9
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+LABELV $228
+LABELV $226
+LABELV $224
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $229
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 48
+DIVI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $229
+LABELV $220
+LABELV $192
+LABELV $190
+endproc CG_DrawFlagModel 76 32
+proc CG_DrawStatusBarHead 68 24
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 35868
+ASGNI4
+ADDRGP4 cg+522860
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $235
+ADDRGP4 cg+512320
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+522860
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+GEF4 $235
+ADDRLP4 0
+ADDRGP4 cg+512320
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35868
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+DIVF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1114636288
+ASGNF4
+ADDRLP4 36
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+CNSTF4 1069547520
+ADDRLP4 36
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 35872
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRF4
+ADDRGP4 cg+522860
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+MULF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35900
+ADDP4
+CNSTF4 1110704128
+ADDRGP4 cg+522860
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35888
+ADDP4
+CNSTF4 1101004800
+ADDRLP4 52
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35884
+ADDP4
+CNSTF4 1084227584
+ADDRLP4 60
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35904
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35892
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+CNSTF4 1157234688
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $236
+JUMPV
+LABELV $235
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35892
+ADDP4
+INDIRI4
+LTI4 $251
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35900
+ADDP4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35888
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35896
+ADDP4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35884
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35904
+ADDP4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35892
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35892
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+CNSTF4 1157234688
+ADDRLP4 32
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 36
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35888
+ADDP4
+CNSTF4 1101004800
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35884
+ADDP4
+CNSTF4 1084227584
+ADDRLP4 48
+INDIRF4
+MULF4
+ASGNF4
+LABELV $251
+ADDRLP4 16
+CNSTF4 1114636288
+ASGNF4
+LABELV $236
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35904
+ADDP4
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+LEI4 $265
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35904
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $265
+ADDRLP4 32
+CNSTI4 35904
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35892
+ADDP4
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1077936128
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 35900
+ASGNI4
+ADDRLP4 4+4
+ADDRGP4 cg+522860
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35888
+ADDP4
+INDIRF4
+ADDRGP4 cg+522860
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 35896
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+522860
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35884
+ADDP4
+INDIRF4
+ADDRGP4 cg+522860
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+CNSTF4 1139802112
+ADDRLP4 16
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+LABELV $232
+endproc CG_DrawStatusBarHead 68 24
+proc CG_DrawStatusBarFlag 4 24
+ADDRFP4 0
+INDIRF4
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 0
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+LABELV $283
+endproc CG_DrawStatusBarFlag 4 24
+export CG_DrawTeamBackground
+proc CG_DrawTeamBackground 20 20
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $286
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRFP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $284
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $291
+LABELV $287
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 CG_GetScreenVerticalPlacement
+CALLI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+679680+124644
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 CG_PopScreenPlacement
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $284
+endproc CG_DrawTeamBackground 20 20
+data
+align 4
+LABELV $297
+byte 4 1065353216
+byte 4 1060152279
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1045220557
+byte 4 1045220557
+byte 4 1065353216
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+code
+proc CG_DrawStatusBar 68 32
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+CNSTI4 0
+NEI4 $298
+ADDRGP4 $296
+JUMPV
+LABELV $298
+CNSTI4 1
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 cg+522864
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 852
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+CNSTI4 0
+ARGI4
+CNSTI4 420
+ARGI4
+CNSTI4 640
+ARGI4
+CNSTI4 60
+ARGI4
+CNSTF4 1051260355
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $304
+ADDRLP4 48
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 cg_weapons+76
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $304
+ADDRLP4 24
+CNSTF4 1116471296
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+512320
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1101004800
+ADDRLP4 56
+INDIRF4
+MULF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+CNSTF4 1120403456
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 60
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 cg_weapons+76
+ADDP4
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $304
+CNSTF4 1133412352
+ARGF4
+ADDRGP4 CG_DrawStatusBarHead
+CALLV
+pop
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $312
+CNSTF4 1134985216
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawStatusBarFlag
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $315
+CNSTF4 1134985216
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_DrawStatusBarFlag
+CALLV
+pop
+ADDRGP4 $316
+JUMPV
+LABELV $315
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 392
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $318
+CNSTF4 1134985216
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStatusBarFlag
+CALLV
+pop
+LABELV $318
+LABELV $316
+LABELV $313
+ADDRLP4 4
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $321
+ADDRLP4 24
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 3240099840
+ASGNF4
+ADDRLP4 12+4
+CNSTI4 360
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+CNSTF4 1139474432
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 56
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cgs+679680+124636
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $321
+ADDRLP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $329
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 412
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+LEI4 $331
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $333
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 100
+LEI4 $333
+ADDRLP4 36
+CNSTI4 2
+ASGNI4
+ADDRGP4 $334
+JUMPV
+LABELV $333
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+LABELV $334
+CNSTI4 0
+ARGI4
+CNSTI4 480
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 $297
+ADDP4
+ARGP4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $337
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $337
+ADDRLP4 60
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 cg_weapons+72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $343
+CNSTF4 1120403456
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 64
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $343
+LABELV $337
+LABELV $331
+LABELV $329
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+LEI4 $345
+ADDRLP4 36
+CNSTI4 3
+ASGNI4
+ADDRGP4 $346
+JUMPV
+LABELV $345
+ADDRLP4 0
+INDIRI4
+CNSTI4 25
+LEI4 $347
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 $348
+JUMPV
+LABELV $347
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $349
+ADDRLP4 36
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 8
+RSHI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRGP4 $350
+JUMPV
+LABELV $349
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+LABELV $350
+LABELV $348
+LABELV $346
+CNSTI4 185
+ARGI4
+CNSTI4 480
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 $297
+ADDP4
+ARGP4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $352
+CNSTI4 370
+ARGI4
+CNSTI4 480
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $297
+ARGP4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $354
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $354
+CNSTF4 1139474432
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 60
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRGP4 cgs+679680+124640
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $354
+LABELV $352
+LABELV $296
+endproc CG_DrawStatusBar 68 32
+proc CG_DrawAttacker 72 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $361
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $360
+JUMPV
+LABELV $361
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35640
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $364
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $360
+JUMPV
+LABELV $364
+ADDRLP4 0
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $372
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $372
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+NEI4 $368
+LABELV $372
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $360
+JUMPV
+LABELV $368
+CNSTI4 2044
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $373
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35640
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $360
+JUMPV
+LABELV $373
+ADDRLP4 36
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35640
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 10000
+LEI4 $379
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35640
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $360
+JUMPV
+LABELV $379
+ADDRLP4 4
+CNSTF4 1114636288
+ASGNF4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 1127481344
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+CNSTF4 1142947840
+ADDRLP4 4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 $384
+ARGP4
+ADDRLP4 60
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 8+12
+CNSTF4 1056964608
+ASGNF4
+CNSTI4 635
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+CNSTI4 4611
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+CNSTI4 512
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ADDF4
+RETF4
+LABELV $360
+endproc CG_DrawAttacker 72 24
+proc CG_DrawSnapshot 12 20
+ADDRGP4 $389
+ARGP4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+40
+INDIRI4
+ARGI4
+ADDRGP4 cgs+56048
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+CNSTI4 635
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 4611
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+CNSTI4 512
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ADDF4
+RETF4
+LABELV $388
+endproc CG_DrawSnapshot 12 20
+bss
+align 4
+LABELV $394
+skip 16
+align 4
+LABELV $395
+skip 4
+align 4
+LABELV $396
+skip 4
+code
+proc CG_DrawFPS 48 20
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 0
+EQI4 $397
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $393
+JUMPV
+LABELV $397
+ADDRLP4 24
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 $396
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $395
+INDIRI4
+CNSTI4 4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $394
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 $395
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 4
+LEI4 $400
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $402
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $394
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $403
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $402
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $406
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $406
+ADDRLP4 20
+CNSTF4 1165623296
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $408
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 44
+INDIRP4
+ASGNP4
+CNSTI4 635
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 4611
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $400
+CNSTI4 512
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ADDF4
+RETF4
+LABELV $393
+endproc CG_DrawFPS 48 20
+proc CG_DrawTimer 40 24
+ADDRLP4 0
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cgs+59304
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 60
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1000
+DIVI4
+ADDRLP4 24
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 60000
+DIVI4
+ADDRLP4 24
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 3600000
+DIVI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $412
+ADDRGP4 $414
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+GEI4 $419
+ADDRLP4 28
+ADDRGP4 $415
+ASGNP4
+ADDRGP4 $420
+JUMPV
+LABELV $419
+ADDRLP4 28
+ADDRGP4 $416
+ASGNP4
+LABELV $420
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+GEI4 $421
+ADDRLP4 32
+ADDRGP4 $415
+ASGNP4
+ADDRGP4 $422
+JUMPV
+LABELV $421
+ADDRLP4 32
+ADDRGP4 $416
+ASGNP4
+LABELV $422
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRGP4 $413
+JUMPV
+LABELV $412
+ADDRGP4 $423
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+GEI4 $425
+ADDRLP4 28
+ADDRGP4 $415
+ASGNP4
+ADDRGP4 $426
+JUMPV
+LABELV $425
+ADDRLP4 28
+ADDRGP4 $416
+ASGNP4
+LABELV $426
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+LABELV $413
+CNSTI4 635
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 4611
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+CNSTI4 512
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ADDF4
+RETF4
+LABELV $409
+endproc CG_DrawTimer 40 24
+proc CG_DrawTeamOverlay 164 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 0
+NEI4 $428
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $427
+JUMPV
+LABELV $428
+ADDRLP4 24
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+EQI4 $432
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+EQI4 $432
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $427
+JUMPV
+LABELV $432
+ADDRGP4 cg+512320
+INDIRI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayersTime
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 5000
+LEI4 $434
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $427
+JUMPV
+LABELV $434
+CNSTI4 1024
+ARGI4
+ADDRLP4 120
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRGP4 $437
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 128
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+CNSTI4 8
+LEI4 $439
+ADDRLP4 124
+CNSTI4 8
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $439
+ADDRLP4 124
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $440
+ADDRLP4 68
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $444
+JUMPV
+LABELV $441
+ADDRLP4 4
+CNSTI4 2044
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $446
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $446
+ADDRLP4 88
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 144
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 144
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LEI4 $448
+ADDRLP4 80
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $448
+LABELV $446
+LABELV $442
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $444
+ADDRLP4 8
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $441
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $450
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $427
+JUMPV
+LABELV $450
+ADDRLP4 80
+INDIRI4
+CNSTI4 96
+LEI4 $452
+ADDRLP4 80
+CNSTI4 96
+ASGNI4
+LABELV $452
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $454
+ADDRLP4 8
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $458
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $458
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 148
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LEI4 $460
+ADDRLP4 72
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $460
+LABELV $458
+LABELV $455
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $454
+ADDRLP4 72
+INDIRI4
+CNSTI4 128
+LEI4 $462
+ADDRLP4 72
+CNSTI4 128
+ASGNI4
+LABELV $462
+ADDRLP4 100
+ADDRLP4 80
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ADDRLP4 96
+INDIRI4
+ADDI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+CNSTI4 5
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $464
+ADDRLP4 84
+CNSTI4 640
+ADDRLP4 100
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $465
+JUMPV
+LABELV $464
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+LABELV $465
+ADDRLP4 104
+ADDRLP4 88
+INDIRI4
+ADDRLP4 92
+INDIRI4
+MULI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $466
+ADDRLP4 108
+ADDRFP4 0
+INDIRF4
+ADDRLP4 104
+INDIRI4
+CVIF4 4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $467
+JUMPV
+LABELV $466
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 104
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 108
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $467
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+NEI4 $468
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 32+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 32+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $469
+JUMPV
+LABELV $468
+ADDRLP4 140
+CNSTF4 0
+ASGNF4
+ADDRLP4 32
+ADDRLP4 140
+INDIRF4
+ASGNF4
+ADDRLP4 32+4
+ADDRLP4 140
+INDIRF4
+ASGNF4
+ADDRLP4 32+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32+12
+CNSTF4 1051260355
+ASGNF4
+LABELV $469
+ADDRLP4 32
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 104
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+679680+124644
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $481
+JUMPV
+LABELV $478
+ADDRLP4 4
+CNSTI4 2044
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $483
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $483
+ADDRLP4 144
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32+12
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 32+8
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 32+4
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 84
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 148
+CNSTF4 0
+ASGNF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+CNSTI4 12
+ARGI4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $488
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $492
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $490
+LABELV $492
+ADDRLP4 28
+ADDRGP4 $493
+ASGNP4
+LABELV $490
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 160
+CNSTF4 0
+ASGNF4
+ADDRLP4 160
+INDIRF4
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRLP4 160
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $488
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ARGP4
+ADDRGP4 CG_GetColorForHealth
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 48
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $494
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 48
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 32
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 96
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $495
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $496
+JUMPV
+LABELV $495
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+679680+124648
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $496
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 48
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $494
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 48
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 32
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $501
+ADDRLP4 12
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRGP4 $502
+JUMPV
+LABELV $501
+ADDRLP4 12
+ADDRLP4 84
+INDIRI4
+ADDRLP4 100
+INDIRI4
+ADDI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $502
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $503
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $507
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $509
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 160
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $511
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $512
+JUMPV
+LABELV $511
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $512
+LABELV $509
+LABELV $507
+LABELV $504
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LEI4 $503
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $483
+LABELV $479
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $481
+ADDRLP4 8
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $478
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+RETF4
+LABELV $427
+endproc CG_DrawTeamOverlay 164 32
+proc CG_DrawUpperRight 16 12
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+CNSTI4 3
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+LTI4 $514
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 1
+NEI4 $514
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_DrawTeamOverlay
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $514
+ADDRGP4 cg_drawSnapshot+12
+INDIRI4
+CNSTI4 0
+EQI4 $518
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_DrawSnapshot
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $518
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawFPS+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $521
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $524
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $521
+LABELV $524
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 CG_DrawFPS
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $521
+ADDRGP4 cg_drawTimer+12
+INDIRI4
+CNSTI4 0
+EQI4 $525
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 CG_DrawTimer
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $525
+ADDRGP4 cg_drawAttacker+12
+INDIRI4
+CNSTI4 0
+EQI4 $528
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawAttacker
+CALLF4
+pop
+LABELV $528
+LABELV $513
+endproc CG_DrawUpperRight 16 12
+proc CG_DrawScores 96 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg_drawScores+12
+INDIRI4
+CNSTI4 0
+NEI4 $532
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $531
+JUMPV
+LABELV $532
+ADDRLP4 32
+ADDRGP4 cgs+59308
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 cgs+59312
+INDIRI4
+ASGNI4
+CNSTI4 512
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 56
+INDIRI4
+CNSTI4 6
+ADDI4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+LTI4 $537
+ADDRLP4 16
+CNSTI4 640
+ASGNI4
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $543
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 68
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $544
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+679680+124732
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $544
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+NEI4 $549
+CNSTI4 8
+ARGI4
+ADDRLP4 76
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $552
+ADDRLP4 40
+ADDRFP4 0
+INDIRF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRGP4 cgs+59320
+INDIRI4
+CNSTI4 0
+LTI4 $554
+ADDRGP4 cgs+59320
+INDIRI4
+CNSTI4 2
+GTI4 $554
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+59320
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+123376
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $554
+LABELV $552
+LABELV $549
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $543
+ARGP4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 80
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $564
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+679680+124732
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $564
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+NEI4 $569
+CNSTI4 7
+ARGI4
+ADDRLP4 88
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $572
+ADDRLP4 40
+ADDRFP4 0
+INDIRF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRGP4 cgs+59316
+INDIRI4
+CNSTI4 0
+LTI4 $574
+ADDRGP4 cgs+59316
+INDIRI4
+CNSTI4 2
+GTI4 $574
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+59316
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+123364
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $574
+LABELV $572
+LABELV $569
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+LTI4 $581
+ADDRLP4 48
+ADDRGP4 cgs+56108
+INDIRI4
+ASGNI4
+ADDRGP4 $582
+JUMPV
+LABELV $581
+ADDRLP4 48
+ADDRGP4 cgs+56104
+INDIRI4
+ASGNI4
+LABELV $582
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $538
+ADDRGP4 $543
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 92
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 $538
+JUMPV
+LABELV $537
+ADDRLP4 16
+CNSTI4 640
+ASGNI4
+ADDRLP4 44
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $591
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $592
+JUMPV
+LABELV $591
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+LABELV $592
+ADDRLP4 60
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $593
+ADDRLP4 36
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $593
+ADDRLP4 36
+INDIRI4
+CNSTI4 -9999
+EQI4 $595
+ADDRGP4 $543
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 72
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $597
+ADDRLP4 76
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $597
+ADDRLP4 76
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $597
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+679680+124732
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $598
+JUMPV
+LABELV $597
+ADDRLP4 80
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $598
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $595
+ADDRLP4 32
+INDIRI4
+CNSTI4 -9999
+EQI4 $607
+ADDRGP4 $543
+ARGP4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 72
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $609
+ADDRLP4 44
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $609
+ADDRLP4 76
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+679680+124732
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $610
+JUMPV
+LABELV $609
+ADDRLP4 76
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $610
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $607
+ADDRGP4 cgs+56104
+INDIRI4
+CNSTI4 0
+EQI4 $619
+ADDRGP4 $543
+ARGP4
+ADDRGP4 cgs+56104
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 72
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $619
+LABELV $538
+ADDRLP4 40
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+RETF4
+LABELV $531
+endproc CG_DrawScores 96 20
+data
+align 4
+LABELV $624
+byte 4 1045220557
+byte 4 1065353216
+byte 4 1045220557
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1045220557
+byte 4 1045220557
+byte 4 1065353216
+code
+proc CG_DrawPowerups 212 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 148
+ADDRGP4 cg+522864
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $626
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $623
+JUMPV
+LABELV $626
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 172
+INDIRI4
+ASGNI4
+LABELV $628
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $632
+ADDRGP4 $629
+JUMPV
+LABELV $632
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 2147483647
+NEI4 $634
+ADDRGP4 $629
+JUMPV
+LABELV $634
+ADDRLP4 140
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GTI4 $637
+ADDRGP4 $629
+JUMPV
+LABELV $637
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $642
+JUMPV
+LABELV $639
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $643
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $648
+JUMPV
+LABELV $645
+ADDRLP4 176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+ADDRLP4 68+4
+ADDP4
+ADDRLP4 176
+INDIRI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $646
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $648
+ADDRLP4 0
+INDIRI4
+ADDRLP4 132
+INDIRI4
+GEI4 $645
+ADDRGP4 $641
+JUMPV
+LABELV $643
+LABELV $640
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $642
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $639
+LABELV $641
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $629
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 16
+LTI4 $628
+ADDRLP4 168
+CNSTI4 528
+ASGNI4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRGP4 $654
+JUMPV
+LABELV $651
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 152
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $655
+ADDRLP4 164
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1111490560
+SUBF4
+ASGNF4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+CVFI4 4
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRLP4 180
+CNSTI4 2
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ADDRLP4 180
+INDIRI4
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+CNSTI4 1000
+DIVI4
+ARGI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 $624
+ADDP4
+ARGP4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+ADDRLP4 184
+CNSTI4 2
+ASGNI4
+ADDRLP4 140
+ADDRLP4 144
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LSHI4
+ADDRLP4 148
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+SUBI4
+CNSTI4 5000
+LTI4 $657
+ADDRGP4 $658
+JUMPV
+LABELV $657
+ADDRLP4 160
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 160
+ADDRLP4 160
+INDIRF4
+ADDRLP4 160
+INDIRF4
+CVFI4 4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 188+12
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 188+8
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 188+4
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $658
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35632
+ADDP4
+INDIRI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+NEI4 $664
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35636
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 200
+GEI4 $664
+ADDRLP4 188
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 160
+ADDRLP4 188
+INDIRF4
+ADDRGP4 cg+512320
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35636
+ADDP4
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+CNSTF4 1111490560
+CNSTF4 1056964608
+ADDRLP4 160
+INDIRF4
+MULF4
+ADDRLP4 188
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 $665
+JUMPV
+LABELV $664
+ADDRLP4 156
+CNSTF4 1111490560
+ASGNF4
+LABELV $665
+ADDRLP4 152
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+CNSTF4 1142947840
+ADDRLP4 156
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ADDRLP4 156
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $655
+LABELV $652
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $654
+ADDRLP4 144
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $651
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $623
+endproc CG_DrawPowerups 212 24
+proc CG_DrawLowerRight 8 12
+ADDRLP4 0
+CNSTF4 1138229248
+ASGNF4
+CNSTI4 3
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+LTI4 $672
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 2
+NEI4 $672
+ADDRLP4 0
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_DrawTeamOverlay
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $672
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_DrawScores
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawPowerups
+CALLF4
+pop
+LABELV $671
+endproc CG_DrawLowerRight 8 12
+proc CG_DrawPickupItem 16 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawPickupItems+12
+INDIRI4
+CNSTI4 0
+NEI4 $677
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $676
+JUMPV
+LABELV $677
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $680
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $676
+JUMPV
+LABELV $680
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35840
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $684
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35844
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $687
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTF4 1090519040
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 24
+ADDI4
+ARGI4
+CNSTI4 48
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+28
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 4640
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $687
+LABELV $684
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $676
+endproc CG_DrawPickupItem 16 20
+proc CG_DrawLowerLeft 16 12
+ADDRLP4 0
+CNSTF4 1138229248
+ASGNF4
+CNSTI4 2
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRGP4 cgs+56096
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $692
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $692
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_DrawTeamOverlay
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $692
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 CG_DrawPickupItem
+CALLI4
+pop
+LABELV $691
+endproc CG_DrawLowerLeft 16 12
+proc CG_DrawTeamInfo 56 20
+ADDRLP4 28
+CNSTI4 2044
+ADDRGP4 cg+522860
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+LTI4 $702
+ADDRLP4 28
+INDIRI4
+CNSTI4 4
+LTI4 $700
+LABELV $702
+ADDRGP4 $696
+JUMPV
+LABELV $700
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+CNSTI4 8
+GEI4 $703
+ADDRLP4 20
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+ASGNI4
+ADDRGP4 $704
+JUMPV
+LABELV $703
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+LABELV $704
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GTI4 $707
+ADDRGP4 $696
+JUMPV
+LABELV $707
+CNSTI4 2
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+CNSTI4 1024
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 39068
+ADDP4
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 39064
+ADDP4
+INDIRI4
+EQI4 $709
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 39068
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 39032
+ADDP4
+ADDP4
+INDIRI4
+SUBI4
+ADDRGP4 cg_teamChatTime+12
+INDIRI4
+LEI4 $713
+ADDRLP4 44
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 39068
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $713
+ADDRLP4 32
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 39064
+ADDP4
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 39068
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 24
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+NEI4 $722
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $723
+JUMPV
+LABELV $722
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+NEI4 $727
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $728
+JUMPV
+LABELV $727
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1051260355
+ASGNF4
+LABELV $728
+LABELV $723
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 44
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 420
+ADDRLP4 44
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+679680+124644
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 48
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 39064
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $743
+JUMPV
+LABELV $740
+CNSTI4 8
+ARGI4
+CNSTI4 420
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 39064
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ADDRLP4 24
+INDIRI4
+MULI4
+SUBI4
+ARGI4
+CNSTI4 241
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 37104
+ADDP4
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $741
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $743
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 39068
+ADDP4
+INDIRI4
+GEI4 $740
+LABELV $709
+LABELV $696
+endproc CG_DrawTeamInfo 56 20
+proc CG_DrawHoldableItem 8 20
+CNSTI4 3
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $750
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+CNSTF4 1142161408
+ARGF4
+CNSTF4 1129840640
+ARGF4
+ADDRLP4 4
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $750
+LABELV $748
+endproc CG_DrawHoldableItem 8 20
+proc CG_DrawReward 72 20
+ADDRGP4 cg_drawRewards+12
+INDIRI4
+CNSTI4 0
+NEI4 $754
+ADDRGP4 $753
+JUMPV
+LABELV $754
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35704
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $758
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35700
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $753
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $766
+JUMPV
+LABELV $763
+ADDRLP4 60
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35788
+ADDP4
+ADDP4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35792
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35748
+ADDP4
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35752
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35708
+ADDP4
+ADDP4
+ADDRLP4 68
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35712
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $764
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $766
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35700
+ADDP4
+INDIRI4
+LTI4 $763
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35704
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35700
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35704
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35788
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $761
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35788
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $761
+LABELV $758
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35708
+ADDP4
+INDIRI4
+CNSTI4 10
+LTI4 $782
+ADDRLP4 8
+CNSTF4 1113587712
+ASGNF4
+ADDRLP4 4
+CNSTF4 1133838336
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 60
+CNSTF4 1110441984
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35748
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $786
+ARGP4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35708
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 320
+ARGI4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+ARGP4
+CNSTI4 4354
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRGP4 $783
+JUMPV
+LABELV $782
+ADDRLP4 12
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35708
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 1113587712
+ASGNF4
+ADDRLP4 60
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+CNSTI4 320
+CNSTI4 48
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRLP4 60
+INDIRI4
+DIVI4
+SUBI4
+ADDRLP4 60
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $792
+JUMPV
+LABELV $789
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 64
+CNSTF4 1110441984
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35748
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+LABELV $790
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $792
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $789
+LABELV $783
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $753
+endproc CG_DrawReward 72 20
+export CG_AddLagometerFrameInfo
+proc CG_AddLagometerFrameInfo 8 0
+ADDRLP4 0
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+44
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 lagometer+512
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 lagometer+512
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $795
+endproc CG_AddLagometerFrameInfo 8 0
+export CG_AddLagometerSnapshotInfo
+proc CG_AddLagometerSnapshotInfo 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $801
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 lagometer+1540
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $800
+JUMPV
+LABELV $801
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+516
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 lagometer+1540
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $800
+endproc CG_AddLagometerSnapshotInfo 4 0
+proc CG_DrawDisconnect 64 20
+ADDRLP4 44
+ADDRGP4 trap_GetCurrentCmdNumber
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 44
+INDIRI4
+CNSTI4 64
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+522868
+INDIRI4
+ARGI4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+522864
+INDIRP4
+INDIRI4
+LEI4 $817
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+LEI4 $813
+LABELV $817
+ADDRGP4 $811
+JUMPV
+LABELV $813
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 40
+ADDRGP4 $818
+ASGNP4
+CNSTI4 320
+ARGI4
+CNSTI4 100
+ARGI4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 9
+RSHI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $819
+ADDRGP4 $811
+JUMPV
+LABELV $819
+CNSTI4 3
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 28
+CNSTF4 1142161408
+ASGNF4
+ADDRLP4 32
+CNSTF4 1138229248
+ASGNF4
+ADDRGP4 $822
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 60
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $811
+endproc CG_DrawDisconnect 64 20
+proc CG_DrawLagometer 76 36
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawLagometer+12
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $828
+ADDRGP4 cgs+56060
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $824
+LABELV $828
+ADDRGP4 CG_DrawDisconnect
+CALLV
+pop
+ADDRGP4 $823
+JUMPV
+LABELV $824
+CNSTI4 3
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 44
+CNSTI4 592
+ASGNI4
+ADDRLP4 48
+CNSTI4 432
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 56
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cgs+679680+124784
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 12
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 20
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+CNSTF4 1077936128
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 36
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 16
+INDIRF4
+CNSTF4 1133903872
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $834
+JUMPV
+LABELV $831
+ADDRLP4 8
+ADDRGP4 lagometer+512
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $836
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+EQI4 $838
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_color_table+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $838
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $841
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $841
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+679680+123336
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $837
+JUMPV
+LABELV $836
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $845
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+EQI4 $847
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRGP4 g_color_table+64
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $847
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $850
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $850
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRGP4 cgs+679680+123336
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $845
+LABELV $837
+LABELV $832
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $834
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+LTF4 $831
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 16
+INDIRF4
+CNSTF4 1147207680
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $857
+JUMPV
+LABELV $854
+ADDRLP4 8
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $860
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+516
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $862
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+EQI4 $863
+ADDRLP4 20
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_color_table+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $863
+JUMPV
+LABELV $862
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+EQI4 $868
+ADDRLP4 20
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_color_table+32
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $868
+LABELV $863
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $871
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $871
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+679680+123336
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $861
+JUMPV
+LABELV $860
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $875
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+EQI4 $877
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRGP4 g_color_table+16
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $877
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+679680+123336
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $875
+LABELV $861
+LABELV $855
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $857
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+LTF4 $854
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $886
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $882
+LABELV $886
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 $887
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $882
+ADDRGP4 CG_DrawDisconnect
+CALLV
+pop
+LABELV $823
+endproc CG_DrawLagometer 76 36
+export CG_DrawVoipMeter
+proc CG_DrawVoipMeter 304 20
+ADDRGP4 cg_voipShowMeter+12
+INDIRI4
+CNSTI4 0
+NEI4 $889
+ADDRGP4 $888
+JUMPV
+LABELV $889
+ADDRGP4 cg+522860
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 288
+ADDRGP4 trap_GetVoipTime
+CALLI4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $896
+ADDRLP4 280
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 250
+SUBI4
+GEI4 $893
+LABELV $896
+ADDRGP4 $888
+JUMPV
+LABELV $893
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 cg+522860
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 trap_GetVoipPower
+CALLF4
+ASGNF4
+ADDRLP4 284
+ADDRLP4 296
+INDIRF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1092616192
+ADDRLP4 284
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 10
+LEI4 $898
+ADDRLP4 20
+CNSTI4 10
+ASGNI4
+LABELV $898
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $903
+JUMPV
+LABELV $900
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+CNSTI1 42
+ASGNI1
+LABELV $901
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $903
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $900
+ADDRGP4 $905
+JUMPV
+LABELV $904
+ADDRLP4 300
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 300
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+ADDRLP4 4
+ADDP4
+CNSTI1 32
+ASGNI1
+LABELV $905
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $904
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 24
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $907
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 24
+ARGP4
+CNSTI4 5122
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $888
+endproc CG_DrawVoipMeter 304 20
+export CG_CenterPrint
+proc CG_CenterPrint 4 12
+ADDRLP4 0
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+ASGNP4
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 1
+EQI4 $910
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ADDRGP4 cg_splitviewTextScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $911
+JUMPV
+LABELV $910
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ADDRGP4 cg_hudTextScale+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $911
+ADDRLP4 0
+INDIRP4
+CNSTI4 34596
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 34584
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 34592
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 34588
+ADDP4
+ADDRFP4 12
+INDIRF4
+ASGNF4
+LABELV $908
+endproc CG_CenterPrint 4 12
+proc CG_DrawCenterString 16 36
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 34584
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $917
+ADDRGP4 $916
+JUMPV
+LABELV $917
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 34584
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1148846080
+ADDRGP4 cg_centertime+8
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $922
+ADDRGP4 $916
+JUMPV
+LABELV $922
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+CNSTI4 320
+ARGI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 34592
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 34596
+ADDP4
+ARGP4
+CNSTI4 267042
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 34588
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 cgs+56040
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ARGF4
+ADDRGP4 CG_DrawStringAutoWrap
+CALLV
+pop
+LABELV $916
+endproc CG_DrawCenterString 16 36
+export CG_GlobalCenterPrint
+proc CG_GlobalCenterPrint 0 12
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 1
+EQI4 $929
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ADDRGP4 cg_splitviewTextScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $930
+JUMPV
+LABELV $929
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ADDRGP4 cg_hudTextScale+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $930
+ADDRGP4 cg+516672
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+516660
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRGP4 cg+516668
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+516664
+ADDRFP4 8
+INDIRF4
+ASGNF4
+LABELV $928
+endproc CG_GlobalCenterPrint 0 12
+proc CG_DrawGlobalCenterString 16 36
+ADDRGP4 cg+516660
+INDIRI4
+CNSTI4 0
+NEI4 $941
+ADDRGP4 $940
+JUMPV
+LABELV $941
+ADDRGP4 cg+516660
+INDIRI4
+ARGI4
+CNSTF4 1148846080
+ADDRGP4 cg_centertime+8
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $946
+ADDRGP4 $940
+JUMPV
+LABELV $946
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+CNSTI4 320
+ARGI4
+ADDRGP4 cg+516668
+INDIRI4
+ARGI4
+ADDRGP4 cg+516672
+ARGP4
+CNSTI4 267042
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+516664
+INDIRF4
+ARGF4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 cgs+56040
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ARGF4
+ADDRGP4 CG_DrawStringAutoWrap
+CALLV
+pop
+LABELV $940
+endproc CG_DrawGlobalCenterString 16 36
+proc CG_DrawCrosshair 48 20
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $953
+ADDRGP4 $952
+JUMPV
+LABELV $953
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $956
+ADDRGP4 $952
+JUMPV
+LABELV $956
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35944
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $959
+ADDRGP4 $952
+JUMPV
+LABELV $959
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 cg_crosshairHealth+12
+INDIRI4
+CNSTI4 0
+EQI4 $962
+ADDRLP4 32
+ARGP4
+ADDRGP4 CG_ColorForHealth
+CALLV
+pop
+ADDRLP4 32
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $962
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 1
+LEI4 $965
+ADDRLP4 32
+CNSTF4 1073741824
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 $966
+JUMPV
+LABELV $965
+ADDRLP4 32
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+LABELV $966
+ADDRLP4 0
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35848
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $972
+ADDRLP4 0
+INDIRF4
+CNSTF4 1128792064
+GEF4 $972
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+LABELV $972
+ADDRLP4 20
+ADDRGP4 cg_crosshairX+12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 cg_crosshairY+12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $977
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $977
+ADDRLP4 16
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+124744
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1142947840
+ADDRLP4 4
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 20
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1139802112
+ADDRLP4 8
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $952
+endproc CG_DrawCrosshair 48 20
+proc CG_DrawCrosshair3D 552 28
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $982
+ADDRGP4 $981
+JUMPV
+LABELV $982
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $985
+ADDRGP4 $981
+JUMPV
+LABELV $985
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35944
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $988
+ADDRGP4 $981
+JUMPV
+LABELV $988
+ADDRGP4 cg_crosshairHealth+12
+INDIRI4
+CNSTI4 0
+EQI4 $991
+ADDRLP4 228
+ARGP4
+ADDRGP4 CG_ColorForHealth
+CALLV
+pop
+ADDRGP4 $992
+JUMPV
+LABELV $991
+ADDRLP4 480
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 228+12
+ADDRLP4 480
+INDIRF4
+ASGNF4
+ADDRLP4 228+8
+ADDRLP4 480
+INDIRF4
+ASGNF4
+ADDRLP4 228+4
+ADDRLP4 480
+INDIRF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 480
+INDIRF4
+ASGNF4
+LABELV $992
+ADDRLP4 468
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 380
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35848
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 380
+INDIRF4
+CNSTF4 0
+LEF4 $1000
+ADDRLP4 380
+INDIRF4
+CNSTF4 1128792064
+GEF4 $1000
+ADDRLP4 380
+ADDRLP4 380
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRLP4 468
+ADDRLP4 468
+INDIRF4
+ADDRLP4 380
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+MULF4
+ASGNF4
+LABELV $1000
+ADDRLP4 396
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+ADDRLP4 396
+INDIRI4
+CNSTI4 0
+GEI4 $1003
+ADDRLP4 396
+CNSTI4 0
+ASGNI4
+LABELV $1003
+ADDRLP4 472
+ADDRLP4 396
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+124744
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1007
+ARGP4
+ADDRLP4 244
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 244
+ARGP4
+ADDRLP4 484
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 372
+ADDRLP4 484
+INDIRF4
+ASGNF4
+ADDRGP4 $1008
+ARGP4
+ADDRLP4 244
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 244
+ARGP4
+ADDRLP4 488
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 476
+ADDRLP4 372
+INDIRF4
+ADDRLP4 488
+INDIRF4
+DIVF4
+ASGNF4
+CNSTF4 1078530011
+ADDRGP4 cg+512444+16
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+ARGF4
+ADDRLP4 492
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 464
+ADDRLP4 372
+INDIRF4
+ADDRLP4 492
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 376
+ADDRGP4 cgs+20100+35880
+INDIRI4
+CVIF4 4
+ADDRLP4 476
+INDIRF4
+MULF4
+ADDRLP4 372
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 464
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 384
+ADDRGP4 cg+512444+24
+INDIRF4
+ADDRGP4 cg+512444+36
+INDIRF4
+ADDRLP4 376
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 384+4
+ADDRGP4 cg+512444+24+4
+INDIRF4
+ADDRGP4 cg+512444+36+4
+INDIRF4
+ADDRLP4 376
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 384+8
+ADDRGP4 cg+512444+24+8
+INDIRF4
+ADDRGP4 cg+512444+36+8
+INDIRF4
+ADDRLP4 376
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 400
+ARGP4
+ADDRGP4 cg+512444+24
+ARGP4
+ADDRLP4 500
+CNSTP4 0
+ASGNP4
+ADDRLP4 500
+INDIRP4
+ARGP4
+ADDRLP4 500
+INDIRP4
+ARGP4
+ADDRLP4 384
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 228
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 24
+ASGNI4
+ADDRLP4 508
+CNSTF4 1132396544
+ADDRLP4 228
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 512
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 508
+INDIRF4
+ADDRLP4 512
+INDIRF4
+LTF4 $1036
+ADDRLP4 504
+ADDRLP4 508
+INDIRF4
+ADDRLP4 512
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1037
+JUMPV
+LABELV $1036
+ADDRLP4 504
+ADDRLP4 508
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1037
+ADDRLP4 0+124
+ADDRLP4 504
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 520
+CNSTF4 1132396544
+ADDRLP4 228+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 524
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 520
+INDIRF4
+ADDRLP4 524
+INDIRF4
+LTF4 $1042
+ADDRLP4 516
+ADDRLP4 520
+INDIRF4
+ADDRLP4 524
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1043
+JUMPV
+LABELV $1042
+ADDRLP4 516
+ADDRLP4 520
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1043
+ADDRLP4 0+124+1
+ADDRLP4 516
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 532
+CNSTF4 1132396544
+ADDRLP4 228+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 536
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 532
+INDIRF4
+ADDRLP4 536
+INDIRF4
+LTF4 $1048
+ADDRLP4 528
+ADDRLP4 532
+INDIRF4
+ADDRLP4 536
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1049
+JUMPV
+LABELV $1048
+ADDRLP4 528
+ADDRLP4 532
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1049
+ADDRLP4 0+124+2
+ADDRLP4 528
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 544
+CNSTF4 1132396544
+ADDRLP4 228+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 548
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 544
+INDIRF4
+ADDRLP4 548
+INDIRF4
+LTF4 $1054
+ADDRLP4 540
+ADDRLP4 544
+INDIRF4
+ADDRLP4 548
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1055
+JUMPV
+LABELV $1054
+ADDRLP4 540
+ADDRLP4 544
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1055
+ADDRLP4 0+124+3
+ADDRLP4 540
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+68
+ADDRLP4 400+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+152
+ADDRLP4 468
+INDIRF4
+CNSTF4 1142947840
+DIVF4
+ADDRLP4 464
+INDIRF4
+MULF4
+ADDRLP4 400+8
+INDIRF4
+MULF4
+ADDRLP4 376
+INDIRF4
+MULF4
+ADDRLP4 372
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0+120
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $981
+endproc CG_DrawCrosshair3D 552 28
+proc CG_DrawThirdPersonCrosshair 428 28
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $1062
+ADDRGP4 $1061
+JUMPV
+LABELV $1062
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1065
+ADDRGP4 $1061
+JUMPV
+LABELV $1065
+ADDRLP4 356
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35944
+ADDP4
+INDIRI4
+ADDRLP4 356
+INDIRI4
+EQI4 $1073
+CNSTI4 272
+ADDRGP4 cg+522868
+INDIRI4
+MULI4
+ADDRGP4 cg_thirdPerson+12
+ADDP4
+INDIRI4
+ADDRLP4 356
+INDIRI4
+NEI4 $1068
+LABELV $1073
+ADDRGP4 $1061
+JUMPV
+LABELV $1068
+ADDRGP4 cg_crosshairHealth+12
+INDIRI4
+CNSTI4 0
+EQI4 $1074
+ADDRLP4 228
+ARGP4
+ADDRGP4 CG_ColorForHealth
+CALLV
+pop
+ADDRGP4 $1075
+JUMPV
+LABELV $1074
+ADDRLP4 360
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 228+12
+ADDRLP4 360
+INDIRF4
+ASGNF4
+ADDRLP4 228+8
+ADDRLP4 360
+INDIRF4
+ASGNF4
+ADDRLP4 228+4
+ADDRLP4 360
+INDIRF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 360
+INDIRF4
+ASGNF4
+LABELV $1075
+ADDRLP4 284
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 244
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35848
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 244
+INDIRF4
+CNSTF4 0
+LEF4 $1083
+ADDRLP4 244
+INDIRF4
+CNSTF4 1128792064
+GEF4 $1083
+ADDRLP4 244
+ADDRLP4 244
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRLP4 284
+ADDRLP4 284
+INDIRF4
+ADDRLP4 244
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+MULF4
+ASGNF4
+LABELV $1083
+ADDRLP4 276
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+GEI4 $1086
+ADDRLP4 276
+CNSTI4 0
+ASGNI4
+LABELV $1086
+ADDRLP4 288
+ADDRLP4 276
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+124744
+ADDP4
+INDIRI4
+ASGNI4
+CNSTF4 1078530011
+ADDRGP4 cg+512444+16
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+ARGF4
+ADDRLP4 364
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 280
+ADDRLP4 364
+INDIRF4
+ASGNF4
+ADDRLP4 272
+ADDRGP4 cgs+20100+35880
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+ADDRLP4 280
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 248
+ADDRGP4 cg+512908
+INDIRF4
+ADDRGP4 cg+512932
+INDIRF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 248+4
+ADDRGP4 cg+512908+4
+INDIRF4
+ADDRGP4 cg+512932+4
+INDIRF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 248+8
+ADDRGP4 cg+512908+8
+INDIRF4
+ADDRGP4 cg+512932+8
+INDIRF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRGP4 cg+512908
+ARGP4
+ADDRLP4 372
+CNSTP4 0
+ASGNP4
+ADDRLP4 372
+INDIRP4
+ARGP4
+ADDRLP4 372
+INDIRP4
+ARGP4
+ADDRLP4 248
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 228
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 24
+ASGNI4
+ADDRLP4 380
+CNSTF4 1132396544
+ADDRLP4 228
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 384
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 380
+INDIRF4
+ADDRLP4 384
+INDIRF4
+LTF4 $1110
+ADDRLP4 376
+ADDRLP4 380
+INDIRF4
+ADDRLP4 384
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1111
+JUMPV
+LABELV $1110
+ADDRLP4 376
+ADDRLP4 380
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1111
+ADDRLP4 0+124
+ADDRLP4 376
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 392
+CNSTF4 1132396544
+ADDRLP4 228+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 396
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 392
+INDIRF4
+ADDRLP4 396
+INDIRF4
+LTF4 $1116
+ADDRLP4 388
+ADDRLP4 392
+INDIRF4
+ADDRLP4 396
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1117
+JUMPV
+LABELV $1116
+ADDRLP4 388
+ADDRLP4 392
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1117
+ADDRLP4 0+124+1
+ADDRLP4 388
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 404
+CNSTF4 1132396544
+ADDRLP4 228+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 408
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 404
+INDIRF4
+ADDRLP4 408
+INDIRF4
+LTF4 $1122
+ADDRLP4 400
+ADDRLP4 404
+INDIRF4
+ADDRLP4 408
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1123
+JUMPV
+LABELV $1122
+ADDRLP4 400
+ADDRLP4 404
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1123
+ADDRLP4 0+124+2
+ADDRLP4 400
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 416
+CNSTF4 1132396544
+ADDRLP4 228+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 420
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 416
+INDIRF4
+ADDRLP4 420
+INDIRF4
+LTF4 $1128
+ADDRLP4 412
+ADDRLP4 416
+INDIRF4
+ADDRLP4 420
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1129
+JUMPV
+LABELV $1128
+ADDRLP4 412
+ADDRLP4 416
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1129
+ADDRLP4 0+124+3
+ADDRLP4 412
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+68
+ADDRLP4 292+12
+INDIRB
+ASGNB 12
+ADDRLP4 260
+ADDRGP4 cg+512444+24
+INDIRF4
+ADDRLP4 0+68
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRGP4 cg+512444+24+4
+INDIRF4
+ADDRLP4 0+68+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRGP4 cg+512444+24+8
+INDIRF4
+ADDRLP4 0+68+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 424
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 0+152
+ADDRLP4 284
+INDIRF4
+CNSTF4 1142947840
+DIVF4
+ADDRLP4 280
+INDIRF4
+MULF4
+ADDRLP4 424
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+120
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1061
+endproc CG_DrawThirdPersonCrosshair 428 28
+proc CG_ScanForCrosshairEntity 104 28
+ADDRLP4 64
+ADDRGP4 cg+512444+24
+INDIRB
+ASGNB 12
+ADDRLP4 92
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 76
+ADDRLP4 64
+INDIRF4
+ADDRLP4 92
+INDIRF4
+ADDRGP4 cg+512444+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 64+4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+ADDRGP4 cg+512444+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76+8
+ADDRLP4 64+8
+INDIRF4
+CNSTF4 1207959552
+ADDRGP4 cg+512444+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 96
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33554433
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0+56
+INDIRI4
+CNSTI4 64
+LTI4 $1165
+ADDRGP4 $1149
+JUMPV
+LABELV $1165
+ADDRLP4 0+12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $1169
+ADDRGP4 $1149
+JUMPV
+LABELV $1169
+CNSTI4 852
+ADDRLP4 0+56
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+228
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1171
+ADDRGP4 $1149
+JUMPV
+LABELV $1171
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35624
+ADDP4
+ADDRLP4 0+56
+INDIRI4
+ASGNI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35628
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $1149
+endproc CG_ScanForCrosshairEntity 104 28
+proc CG_DrawCrosshairNames 340 32
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $1180
+ADDRGP4 $1179
+JUMPV
+LABELV $1180
+ADDRGP4 cg_drawCrosshairNames+12
+INDIRI4
+CNSTI4 0
+NEI4 $1183
+ADDRGP4 $1179
+JUMPV
+LABELV $1183
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35944
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1186
+ADDRGP4 $1179
+JUMPV
+LABELV $1186
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 CG_ScanForCrosshairEntity
+CALLV
+pop
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35628
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1000
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1190
+ADDRGP4 $1179
+JUMPV
+LABELV $1190
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 1
+LEI4 $1192
+ADDRLP4 16
+CNSTF4 1073741824
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1193
+JUMPV
+LABELV $1192
+ADDRLP4 16
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $1193
+CNSTI4 512
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 480
+ADDRLP4 16
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+SUBI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 2044
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35624
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+4
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 32
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+CNSTI4 320
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 4610
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 cg_voipShowCrosshairMeter+12
+INDIRI4
+CNSTI4 0
+EQI4 $1200
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35624
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_GetVoipPower
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35624
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 trap_GetVoipTime
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRF4
+CNSTF4 0
+LEF4 $1205
+ADDRLP4 52
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+LEI4 $1205
+ADDRLP4 52
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 250
+SUBI4
+LTI4 $1205
+ADDRLP4 76
+CNSTF4 1092616192
+ADDRLP4 40
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 10
+LEI4 $1208
+ADDRLP4 76
+CNSTI4 10
+ASGNI4
+LABELV $1208
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1213
+JUMPV
+LABELV $1210
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+ADDP4
+CNSTI1 42
+ASGNI1
+LABELV $1211
+ADDRLP4 56
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1213
+ADDRLP4 56
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LTI4 $1210
+ADDRGP4 $1215
+JUMPV
+LABELV $1214
+ADDRLP4 336
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 336
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+ADDRLP4 60
+ADDP4
+CNSTI1 32
+ASGNI1
+LABELV $1215
+ADDRLP4 56
+INDIRI4
+CNSTI4 10
+LTI4 $1214
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 80
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $907
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 320
+ARGI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 80
+ARGP4
+CNSTI4 4610
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1205
+LABELV $1200
+LABELV $1179
+endproc CG_DrawCrosshairNames 340 32
+lit
+align 4
+LABELV $1218
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+code
+proc CG_DrawShaderInfo 284 36
+ADDRLP4 232
+ADDRGP4 $1218
+INDIRB
+ASGNB 16
+ADDRGP4 cg_drawShaderInfo+12
+INDIRI4
+CNSTI4 0
+NEI4 $1219
+ADDRGP4 $1217
+JUMPV
+LABELV $1219
+ADDRLP4 252
+CNSTF4 1124073472
+ASGNF4
+ADDRLP4 228
+ADDRLP4 252
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 252
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+512444+24
+INDIRB
+ASGNB 12
+ADDRLP4 256
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 80
+ADDRLP4 0
+INDIRF4
+ADDRLP4 256
+INDIRF4
+ADDRGP4 cg+512444+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 256
+INDIRF4
+ADDRGP4 cg+512444+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1207959552
+ADDRGP4 cg+512444+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 260
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 92
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 268
+CNSTI4 0
+ASGNI4
+ADDRLP4 92+44
+INDIRI4
+ADDRLP4 268
+INDIRI4
+LEI4 $1238
+ADDRLP4 92+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+LTF4 $1244
+ADDRLP4 12+44
+INDIRI4
+ADDRLP4 268
+INDIRI4
+GTI4 $1238
+LABELV $1244
+ADDRLP4 12
+ARGP4
+ADDRLP4 92
+ARGP4
+CNSTU4 64
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1238
+ADDRLP4 12+44
+INDIRI4
+CNSTI4 0
+GTI4 $1245
+ADDRGP4 $1217
+JUMPV
+LABELV $1245
+ADDRLP4 12+44
+INDIRI4
+ARGI4
+CNSTI4 -4
+ARGI4
+ADDRLP4 272
+ADDRGP4 trap_R_GetSurfaceShader
+CALLI4
+ASGNI4
+ADDRLP4 248
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+ARGI4
+ADDRLP4 156
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_R_GetShaderName
+CALLV
+pop
+CNSTI4 2
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 232+12
+CNSTF4 1056964608
+ADDRLP4 232+12
+INDIRF4
+MULF4
+ASGNF4
+CNSTI4 0
+ARGI4
+CNSTF4 1139802112
+ADDRLP4 76
+INDIRF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 156
+ARGP4
+CNSTI4 4656
+ARGI4
+ADDRLP4 232
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRLP4 220
+CNSTF4 0
+ASGNF4
+ADDRLP4 224
+CNSTF4 1139802112
+ADDRLP4 76
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 220
+ARGP4
+ADDRLP4 224
+ARGP4
+ADDRLP4 228
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 220
+INDIRF4
+ARGF4
+ADDRLP4 224
+INDIRF4
+ARGF4
+ADDRLP4 228
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 276
+CNSTF4 0
+ASGNF4
+ADDRLP4 276
+INDIRF4
+ARGF4
+ADDRLP4 276
+INDIRF4
+ARGF4
+ADDRLP4 280
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 280
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRF4
+ARGF4
+ADDRLP4 248
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $1217
+endproc CG_DrawShaderInfo 284 36
+proc CG_DrawSpectator 12 20
+CNSTI4 1
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+CNSTI4 512
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 480
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+SUBI4
+ASGNI4
+CNSTI4 320
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1251
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 1
+NEI4 $1252
+CNSTI4 320
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1255
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRGP4 $1253
+JUMPV
+LABELV $1252
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+LTI4 $1256
+CNSTI4 320
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1259
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $1256
+LABELV $1253
+LABELV $1250
+endproc CG_DrawSpectator 12 20
+proc CG_DrawVote 160 20
+ADDRGP4 cgs+56184
+INDIRI4
+CNSTI4 0
+NEI4 $1261
+ADDRGP4 $1260
+JUMPV
+LABELV $1261
+CNSTI4 2
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 cgs+56196
+INDIRI4
+CNSTI4 0
+EQI4 $1264
+ADDRGP4 cgs+56196
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+679680+126208
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1264
+ADDRLP4 4
+CNSTI4 30000
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cgs+56184
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1272
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1272
+ADDRGP4 cg+522868
+INDIRI4
+ARGI4
+ADDRGP4 $1275
+ARGP4
+ADDRLP4 140
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_KeysStringForBinding
+CALLV
+pop
+ADDRGP4 cg+522868
+INDIRI4
+ARGI4
+ADDRGP4 $1277
+ARGP4
+ADDRLP4 144
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 72
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_KeysStringForBinding
+CALLV
+pop
+CNSTI4 256
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRGP4 $1278
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 cgs+56200
+ARGP4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 152
+INDIRP4
+ASGNP4
+CNSTI4 2
+ARGI4
+CNSTI4 58
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+ADDRGP4 $1280
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 cgs+56188
+INDIRI4
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRGP4 cgs+56192
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 58
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+LABELV $1260
+endproc CG_DrawVote 160 20
+proc CG_DrawTeamVote 24 20
+CNSTI4 2044
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1284
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1285
+JUMPV
+LABELV $1284
+CNSTI4 2044
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1283
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1290
+LABELV $1285
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+57224
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1294
+ADDRGP4 $1283
+JUMPV
+LABELV $1294
+CNSTI4 2
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+57248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1297
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+57248
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+679680+126208
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1297
+ADDRLP4 4
+CNSTI4 30000
+ADDRGP4 cg+512320
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+57224
+ADDP4
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1305
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1305
+ADDRGP4 $1307
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cgs+57256
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cgs+57232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cgs+57240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+CNSTI4 90
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+LABELV $1283
+endproc CG_DrawTeamVote 24 20
+export CG_AnyScoreboardShowing
+proc CG_AnyScoreboardShowing 8 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1315
+JUMPV
+LABELV $1312
+ADDRLP4 4
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+522872
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1316
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+522872+36000
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1316
+CNSTI4 1
+RETI4
+ADDRGP4 $1311
+JUMPV
+LABELV $1316
+LABELV $1313
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1315
+ADDRLP4 4
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $1312
+CNSTI4 0
+RETI4
+LABELV $1311
+endproc CG_AnyScoreboardShowing 8 0
+proc CG_DrawScoreboard 4 0
+ADDRLP4 0
+ADDRGP4 CG_DrawOldScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1321
+endproc CG_DrawScoreboard 4 0
+proc CG_DrawIntermission 4 0
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 2
+NEI4 $1323
+ADDRGP4 CG_DrawCenterString
+CALLV
+pop
+ADDRGP4 $1322
+JUMPV
+LABELV $1323
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 36004
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 36000
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1322
+endproc CG_DrawIntermission 4 0
+proc CG_DrawBotInfo 56 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $1330
+CNSTI4 0
+RETI4
+ADDRGP4 $1329
+JUMPV
+LABELV $1330
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 864
+ADDI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1334
+CNSTI4 0
+RETI4
+ADDRGP4 $1329
+JUMPV
+LABELV $1334
+CNSTI4 512
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $384
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1336
+ADDRGP4 $1338
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+CNSTI4 320
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1336
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1339
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1340
+CNSTI4 320
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1340
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1342
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1343
+ADDRLP4 4
+ADDRGP4 $1345
+ASGNP4
+CNSTI4 320
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1343
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1346
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1347
+ADDRGP4 $1349
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 52
+INDIRP4
+ASGNP4
+CNSTI4 320
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $1347
+CNSTI4 1
+RETI4
+LABELV $1329
+endproc CG_DrawBotInfo 56 20
+proc CG_DrawFollow 16 20
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $1351
+CNSTI4 0
+RETI4
+ADDRGP4 $1350
+JUMPV
+LABELV $1351
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 24
+ASGNI4
+CNSTI4 320
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1354
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+CNSTI4 512
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 2044
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+4
+ADDP4
+ASGNP4
+CNSTI4 320
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 4866
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+CNSTI4 768
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawBotInfo
+CALLI4
+pop
+CNSTI4 1
+RETI4
+LABELV $1350
+endproc CG_DrawFollow 16 20
+proc CG_DrawAmmoWarning 4 20
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1359
+ADDRGP4 $1358
+JUMPV
+LABELV $1359
+ADDRGP4 cg_drawAmmoWarning+12
+INDIRI4
+CNSTI4 0
+NEI4 $1362
+ADDRGP4 $1358
+JUMPV
+LABELV $1362
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1365
+ADDRGP4 $1358
+JUMPV
+LABELV $1365
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35620
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1368
+ADDRLP4 0
+ADDRGP4 $1371
+ASGNP4
+ADDRGP4 $1369
+JUMPV
+LABELV $1368
+ADDRLP4 0
+ADDRGP4 $1372
+ASGNP4
+LABELV $1369
+CNSTI4 320
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $1358
+endproc CG_DrawAmmoWarning 4 20
+proc CG_DrawWarmup 44 32
+ADDRLP4 4
+ADDRGP4 cg+522544
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1375
+ADDRGP4 $1373
+JUMPV
+LABELV $1375
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1377
+ADDRLP4 12
+ADDRGP4 $1379
+ASGNP4
+CNSTI4 320
+ARGI4
+CNSTI4 24
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRGP4 cg+522548
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1373
+JUMPV
+LABELV $1377
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 1
+NEI4 $1381
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1387
+JUMPV
+LABELV $1384
+ADDRLP4 32
+CNSTI4 2044
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cgs+77768
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $1389
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1389
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1394
+ADDRLP4 8
+CNSTI4 2044
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRGP4 $1395
+JUMPV
+LABELV $1394
+ADDRLP4 16
+CNSTI4 2044
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+LABELV $1395
+LABELV $1389
+LABELV $1385
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1387
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+56116
+INDIRI4
+LTI4 $1384
+ADDRLP4 32
+CNSTU4 0
+ASGNU4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $1382
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $1382
+ADDRGP4 $1400
+ARGP4
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 40
+INDIRP4
+ASGNP4
+CNSTI4 320
+ARGI4
+CNSTI4 25
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 4866
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTF4 1059760811
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $1382
+JUMPV
+LABELV $1381
+ADDRLP4 12
+ADDRGP4 cgs+56064
+ASGNP4
+CNSTI4 320
+ARGI4
+CNSTI4 25
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 4866
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTF4 1059760811
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1382
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1403
+ADDRGP4 cg+522544
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1403
+ADDRGP4 $1406
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+522548
+INDIRI4
+EQI4 $1407
+ADDRGP4 cg+522548
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1413
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $1416
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $1419
+ADDRGP4 $1412
+JUMPV
+LABELV $1413
+ADDRGP4 cgs+679680+126424
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1412
+JUMPV
+LABELV $1416
+ADDRGP4 cgs+679680+126420
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1412
+JUMPV
+LABELV $1419
+ADDRGP4 cgs+679680+126416
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1412
+LABELV $1407
+ADDRLP4 32
+ADDRGP4 cg+522548
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $1425
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+EQI4 $1426
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+EQI4 $1427
+ADDRGP4 $1422
+JUMPV
+LABELV $1425
+ADDRLP4 20
+CNSTF4 1058362709
+ASGNF4
+ADDRLP4 24
+CNSTI4 768
+ASGNI4
+ADDRGP4 $1423
+JUMPV
+LABELV $1426
+ADDRLP4 20
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 24
+CNSTI4 768
+ASGNI4
+ADDRGP4 $1423
+JUMPV
+LABELV $1427
+ADDRLP4 20
+CNSTF4 1054168405
+ASGNF4
+ADDRLP4 24
+CNSTI4 768
+ASGNI4
+ADDRGP4 $1423
+JUMPV
+LABELV $1422
+ADDRLP4 20
+CNSTF4 1051372203
+ASGNF4
+ADDRLP4 24
+CNSTI4 512
+ASGNI4
+LABELV $1423
+CNSTI4 320
+ARGI4
+CNSTI4 70
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 4098
+BORI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1373
+endproc CG_DrawWarmup 44 32
+export CG_DrawNotify
+proc CG_DrawNotify 12 36
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+CNSTI4 2
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 36044
+ADDP4
+ARGP4
+CNSTI4 256
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 cgs+56040
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1115684864
+SUBF4
+ARGF4
+ADDRGP4 CG_DrawStringAutoWrap
+CALLV
+pop
+LABELV $1428
+endproc CG_DrawNotify 12 36
+proc CG_Draw2D 4 4
+ADDRGP4 cg+24
+INDIRI4
+CNSTI4 0
+EQI4 $1432
+ADDRGP4 $1431
+JUMPV
+LABELV $1432
+ADDRGP4 cg+515628
+INDIRI4
+CNSTI4 0
+EQI4 $1435
+ADDRGP4 $1431
+JUMPV
+LABELV $1435
+ADDRGP4 cg_draw2D+12
+INDIRI4
+CNSTI4 0
+NEI4 $1438
+ADDRGP4 $1431
+JUMPV
+LABELV $1438
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1441
+ADDRGP4 CG_DrawIntermission
+CALLV
+pop
+ADDRGP4 $1431
+JUMPV
+LABELV $1441
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1444
+ADDRGP4 CG_DrawSpectator
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1447
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+LABELV $1447
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 $1445
+JUMPV
+LABELV $1444
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35996
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1449
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $1449
+ADDRGP4 CG_DrawStatusBar
+CALLV
+pop
+ADDRGP4 CG_DrawAmmoWarning
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1453
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+LABELV $1453
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 CG_DrawWeaponSelect
+CALLV
+pop
+ADDRGP4 CG_DrawHoldableItem
+CALLV
+pop
+ADDRGP4 CG_DrawReward
+CALLV
+pop
+LABELV $1449
+LABELV $1445
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+LTI4 $1455
+ADDRGP4 CG_DrawTeamInfo
+CALLV
+pop
+LABELV $1455
+ADDRGP4 CG_DrawVote
+CALLV
+pop
+ADDRGP4 CG_DrawTeamVote
+CALLV
+pop
+ADDRGP4 CG_DrawLagometer
+CALLV
+pop
+ADDRGP4 CG_DrawVoipMeter
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawUpperRight
+CALLV
+pop
+ADDRGP4 CG_DrawLowerRight
+CALLV
+pop
+ADDRGP4 CG_DrawLowerLeft
+CALLV
+pop
+ADDRGP4 CG_DrawShaderInfo
+CALLV
+pop
+ADDRGP4 CG_DrawFollow
+CALLI4
+pop
+ADDRLP4 0
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 36000
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 36000
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1459
+ADDRGP4 CG_DrawCenterString
+CALLV
+pop
+LABELV $1459
+LABELV $1431
+endproc CG_Draw2D 4 4
+export CG_FogView
+proc CG_FogView 8 28
+ADDRLP4 0
+ADDRGP4 cg+512444+76
+INDIRI4
+CNSTI4 2
+BANDI4
+ASGNI4
+ADDRGP4 cg+512444+24
+ARGP4
+ADDRGP4 cg+512444+368
+ARGP4
+ADDRGP4 cg+512444+372
+ARGP4
+ADDRGP4 cg+512444+384
+ARGP4
+ADDRGP4 cg+512444+388
+ARGP4
+ADDRGP4 cg+512444+436
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_GetViewFog
+CALLV
+pop
+ADDRGP4 cg+512444+368
+INDIRI4
+CNSTI4 0
+NEI4 $1477
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+512444+372
+INDIRF4
+ADDRLP4 4
+INDIRF4
+NEF4 $1490
+ADDRGP4 cg+512444+372+4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+NEF4 $1490
+ADDRGP4 cg+512444+372+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+EQF4 $1477
+LABELV $1490
+ADDRGP4 cg+512444+368
+ADDRGP4 cgs+208612
+INDIRI4
+ASGNI4
+ADDRGP4 cg+512444+384
+ADDRGP4 cgs+208628
+INDIRF4
+ASGNF4
+ADDRGP4 cg+512444+388
+ADDRGP4 cgs+208632
+INDIRF4
+ASGNF4
+ADDRGP4 cg+512444+436
+ADDRGP4 cgs+208636
+INDIRF4
+ASGNF4
+ADDRGP4 $1478
+JUMPV
+LABELV $1477
+ADDRGP4 cg+512444+368
+INDIRI4
+CNSTI4 0
+NEI4 $1503
+ADDRGP4 cg+512444+368
+ADDRGP4 cgs+208612
+INDIRI4
+ASGNI4
+ADDRGP4 cg+512444+384
+ADDRGP4 cgs+208628
+INDIRF4
+ASGNF4
+ADDRGP4 cg+512444+388
+ADDRGP4 cgs+208632
+INDIRF4
+ASGNF4
+ADDRGP4 cg+512444+436
+ADDRGP4 cgs+208636
+INDIRF4
+ASGNF4
+ADDRGP4 cg+512444+372
+ADDRGP4 cgs+208616
+INDIRB
+ASGNB 12
+LABELV $1503
+LABELV $1478
+LABELV $1462
+endproc CG_FogView 8 28
+export CG_DrawMiscGamemodels
+proc CG_DrawMiscGamemodels 248 12
+ADDRLP4 236
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 228
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 8+4
+CNSTI4 64
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1528
+JUMPV
+LABELV $1525
+CNSTI4 460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+208640+456
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1530
+ADDRLP4 240
+CNSTI4 460
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+ADDRGP4 cgs+208640+408
+ADDP4
+ARGP4
+ADDRLP4 240
+INDIRI4
+ADDRGP4 cgs+208640+456
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 244
+ADDRGP4 CG_CullPointAndRadius
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+EQI4 $1534
+ADDRGP4 $1526
+JUMPV
+LABELV $1534
+LABELV $1530
+ADDRGP4 cg+512444+24
+ARGP4
+CNSTI4 460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+208640+408
+ADDP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 trap_R_inPVS
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+NEI4 $1540
+ADDRGP4 $1526
+JUMPV
+LABELV $1540
+ADDRLP4 8+68
+CNSTI4 460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+208640+408
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8+88
+CNSTI4 460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+208640+408
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8+12
+CNSTI4 460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+208640+408
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1555
+ADDRLP4 244
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+ADDRLP4 8+28
+ADDP4
+ADDRLP4 244
+INDIRI4
+CNSTI4 460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+208640+420
+ADDP4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1556
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1555
+ADDRLP4 8+8
+CNSTI4 460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+208640
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+208640+4
+ADDP4
+ARGP4
+ADDRLP4 244
+ADDRGP4 CG_AddSkinToFrame
+CALLI4
+ASGNI4
+ADDRLP4 8+116
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 236
+ADDRLP4 236
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1526
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1528
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+515564
+INDIRI4
+LTI4 $1525
+LABELV $1522
+endproc CG_DrawMiscGamemodels 248 12
+export CG_DrawActive
+proc CG_DrawActive 4 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1568
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 $1567
+JUMPV
+LABELV $1568
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1571
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1571
+ADDRGP4 CG_DrawTourneyScoreboard
+CALLV
+pop
+ADDRGP4 $1567
+JUMPV
+LABELV $1571
+ADDRGP4 CG_TileClear
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1575
+ADDRGP4 CG_DrawCrosshair3D
+CALLV
+pop
+LABELV $1575
+ADDRGP4 CG_DrawThirdPersonCrosshair
+CALLV
+pop
+ADDRGP4 CG_PB_RenderPolyBuffers
+CALLV
+pop
+ADDRGP4 CG_DrawMiscGamemodels
+CALLV
+pop
+ADDRGP4 CG_FogView
+CALLV
+pop
+ADDRGP4 cg+512444+432
+ADDRGP4 cg+515600
+INDIRF4
+ASGNF4
+ADDRGP4 cg+512444
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_Draw2D
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawNotify
+CALLV
+pop
+LABELV $1567
+endproc CG_DrawActive 4 8
+export CG_DrawDemoRecording
+proc CG_DrawDemoRecording 1104 20
+ADDRLP4 1092
+ADDRGP4 trap_GetDemoState
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 2
+EQI4 $1582
+ADDRGP4 $1581
+JUMPV
+LABELV $1582
+ADDRLP4 1024
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_GetDemoName
+CALLV
+pop
+ADDRLP4 1096
+ADDRGP4 trap_GetDemoPos
+CALLI4
+ASGNI4
+ADDRLP4 1088
+ADDRLP4 1096
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1100
+CNSTI4 1024
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+ARGI4
+ADDRGP4 $1584
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 1088
+INDIRI4
+ADDRLP4 1100
+INDIRI4
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 20
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 5122
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $1581
+endproc CG_DrawDemoRecording 1104 20
+export CG_DrawMessageMode
+proc CG_DrawMessageMode 8 24
+ADDRLP4 0
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1586
+ADDRGP4 $1585
+JUMPV
+LABELV $1586
+CNSTI4 2
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+CNSTI4 8
+ARGI4
+CNSTI4 232
+ARGI4
+ADDRGP4 cg+517728
+ARGP4
+CNSTI4 4608
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRGP4 cg+517728
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRGP4 cg+517792
+ARGP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+CVFI4 4
+ARGI4
+CNSTI4 232
+ARGI4
+CNSTI4 4608
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_MField_Draw
+CALLV
+pop
+LABELV $1585
+endproc CG_DrawMessageMode 8 24
+export CG_DrawScreen2D
+proc CG_DrawScreen2D 0 0
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1592
+ADDRGP4 $1591
+JUMPV
+LABELV $1592
+ADDRGP4 cg+24
+INDIRI4
+CNSTI4 0
+EQI4 $1595
+ADDRGP4 $1591
+JUMPV
+LABELV $1595
+ADDRGP4 cg_draw2D+12
+INDIRI4
+CNSTI4 0
+NEI4 $1598
+ADDRGP4 $1591
+JUMPV
+LABELV $1598
+ADDRGP4 CG_DrawWarmup
+CALLV
+pop
+ADDRGP4 cg+515628
+INDIRI4
+CNSTI4 0
+EQI4 $1601
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+pop
+ADDRGP4 $1602
+JUMPV
+LABELV $1601
+ADDRGP4 CG_DrawGlobalCenterString
+CALLV
+pop
+LABELV $1602
+ADDRGP4 CG_DrawDemoRecording
+CALLV
+pop
+ADDRGP4 CG_DrawMessageMode
+CALLV
+pop
+LABELV $1591
+endproc CG_DrawScreen2D 0 0
+bss
+export lagometer
+align 4
+LABELV lagometer
+skip 1544
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+export teamChat2
+align 1
+LABELV teamChat2
+skip 256
+export teamChat1
+align 1
+LABELV teamChat1
+skip 256
+export systemChat
+align 1
+LABELV systemChat
+skip 256
+export sortedTeamPlayersTime
+align 4
+LABELV sortedTeamPlayersTime
+skip 16
+export numSortedTeamPlayers
+align 4
+LABELV numSortedTeamPlayers
+skip 16
+export sortedTeamPlayers
+align 4
+LABELV sortedTeamPlayers
+skip 512
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_drawScores
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1584
+byte 1 82
+byte 1 69
+byte 1 67
+byte 1 79
+byte 1 82
+byte 1 68
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 107
+byte 1 0
+align 1
+LABELV $1406
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1400
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1379
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $1372
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 32
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 0
+align 1
+LABELV $1371
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 32
+byte 1 79
+byte 1 70
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $1354
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1349
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1346
+byte 1 99
+byte 1 0
+align 1
+LABELV $1345
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1342
+byte 1 108
+byte 1 0
+align 1
+LABELV $1339
+byte 1 97
+byte 1 0
+align 1
+LABELV $1338
+byte 1 65
+byte 1 73
+byte 1 32
+byte 1 78
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1307
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1280
+byte 1 89
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1278
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1277
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 0
+align 1
+LABELV $1275
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1259
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 74
+byte 1 79
+byte 1 73
+byte 1 78
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $1255
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $1251
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1008
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 111
+byte 1 83
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1007
+byte 1 114
+byte 1 95
+byte 1 122
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 0
+align 1
+LABELV $907
+byte 1 86
+byte 1 111
+byte 1 73
+byte 1 80
+byte 1 58
+byte 1 32
+byte 1 91
+byte 1 37
+byte 1 115
+byte 1 93
+byte 1 0
+align 1
+LABELV $887
+byte 1 115
+byte 1 110
+byte 1 99
+byte 1 0
+align 1
+LABELV $822
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $818
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $786
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $543
+byte 1 37
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $494
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 0
+align 1
+LABELV $493
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $437
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $423
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $416
+byte 1 0
+align 1
+LABELV $415
+byte 1 48
+byte 1 0
+align 1
+LABELV $414
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $408
+byte 1 37
+byte 1 105
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $389
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $384
+byte 1 110
+byte 1 0
+align 1
+LABELV $133
+byte 1 37
+byte 1 105
+byte 1 0
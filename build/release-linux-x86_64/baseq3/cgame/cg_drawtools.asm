@@ -0,0 +1,4504 @@
+data
+align 4
+LABELV cg_horizontalPlacement
+byte 4 1
+align 4
+LABELV cg_verticalPlacement
+byte 4 1
+align 4
+LABELV cg_lastHorizontalPlacement
+byte 4 1
+align 4
+LABELV cg_lastVerticalPlacement
+byte 4 1
+export CG_SetScreenPlacement
+code
+proc CG_SetScreenPlacement 8 0
+ADDRLP4 0
+ADDRGP4 cg_horizontalPlacement
+ASGNP4
+ADDRGP4 cg_lastHorizontalPlacement
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg_verticalPlacement
+ASGNP4
+ADDRGP4 cg_lastVerticalPlacement
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+LABELV $96
+endproc CG_SetScreenPlacement 8 0
+export CG_PopScreenPlacement
+proc CG_PopScreenPlacement 0 0
+ADDRGP4 cg_horizontalPlacement
+ADDRGP4 cg_lastHorizontalPlacement
+INDIRI4
+ASGNI4
+ADDRGP4 cg_verticalPlacement
+ADDRGP4 cg_lastVerticalPlacement
+INDIRI4
+ASGNI4
+LABELV $97
+endproc CG_PopScreenPlacement 0 0
+export CG_GetScreenHorizontalPlacement
+proc CG_GetScreenHorizontalPlacement 0 0
+ADDRGP4 cg_horizontalPlacement
+INDIRI4
+RETI4
+LABELV $98
+endproc CG_GetScreenHorizontalPlacement 0 0
+export CG_GetScreenVerticalPlacement
+proc CG_GetScreenVerticalPlacement 0 0
+ADDRGP4 cg_verticalPlacement
+INDIRI4
+RETI4
+LABELV $99
+endproc CG_GetScreenVerticalPlacement 0 0
+export CG_AdjustFrom640
+proc CG_AdjustFrom640 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 1
+EQI4 $101
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+EQU4 $101
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+NEU4 $105
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+EQU4 $101
+LABELV $105
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 2
+NEI4 $106
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 1
+NEI4 $107
+ADDRGP4 cg_splitviewVertical+12
+INDIRI4
+CNSTI4 0
+EQI4 $112
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $107
+JUMPV
+LABELV $112
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $107
+JUMPV
+LABELV $106
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 3
+NEI4 $115
+ADDRGP4 cg_splitviewThirdEqual+12
+INDIRI4
+CNSTI4 0
+NEI4 $115
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 2
+NEI4 $119
+ADDRGP4 cg_splitviewVertical+12
+INDIRI4
+CNSTI4 0
+EQI4 $122
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $116
+JUMPV
+LABELV $122
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $116
+JUMPV
+LABELV $119
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 1
+NEI4 $116
+ADDRGP4 cg_splitviewVertical+12
+INDIRI4
+CNSTI4 0
+NEI4 $128
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $116
+JUMPV
+LABELV $128
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $116
+JUMPV
+LABELV $115
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 4
+GTI4 $131
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 1
+EQI4 $138
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 3
+NEI4 $134
+LABELV $138
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+LABELV $134
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 2
+EQI4 $143
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 3
+NEI4 $139
+LABELV $143
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $139
+LABELV $131
+LABELV $116
+LABELV $107
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $144
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $146
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1142947840
+ADDF4
+ASGNF4
+LABELV $146
+LABELV $144
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $148
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $150
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1139802112
+ADDF4
+ASGNF4
+LABELV $150
+LABELV $148
+LABELV $101
+ADDRGP4 cg_horizontalPlacement
+INDIRI4
+CNSTI4 0
+NEI4 $152
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $154
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+56032
+INDIRF4
+MULF4
+ASGNF4
+LABELV $154
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $153
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+56032
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $153
+JUMPV
+LABELV $152
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $160
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+56016
+INDIRF4
+MULF4
+ASGNF4
+LABELV $160
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $163
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+56016
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg_horizontalPlacement
+INDIRI4
+CNSTI4 1
+NEI4 $166
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+56024
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $167
+JUMPV
+LABELV $166
+ADDRGP4 cg_horizontalPlacement
+INDIRI4
+CNSTI4 3
+NEI4 $169
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRGP4 cgs+56024
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $169
+LABELV $167
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+56024
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $163
+LABELV $153
+ADDRGP4 cg_verticalPlacement
+INDIRI4
+CNSTI4 0
+NEI4 $173
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $175
+ADDRLP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+56036
+INDIRF4
+MULF4
+ASGNF4
+LABELV $175
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $174
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+56036
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $174
+JUMPV
+LABELV $173
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $181
+ADDRLP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+56020
+INDIRF4
+MULF4
+ASGNF4
+LABELV $181
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $184
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+56020
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg_verticalPlacement
+INDIRI4
+CNSTI4 1
+NEI4 $187
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+56028
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $188
+JUMPV
+LABELV $187
+ADDRGP4 cg_verticalPlacement
+INDIRI4
+CNSTI4 5
+NEI4 $190
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRGP4 cgs+56028
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $190
+LABELV $188
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+56028
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $184
+LABELV $174
+LABELV $100
+endproc CG_AdjustFrom640 24 0
+export CG_FillRect
+proc CG_FillRect 4 36
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+679680+123336
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $194
+endproc CG_FillRect 4 36
+export CG_DrawSides
+proc CG_DrawSides 12 36
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRGP4 cg_horizontalPlacement
+INDIRI4
+CNSTI4 0
+NEI4 $198
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ADDRGP4 cgs+56032
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $199
+JUMPV
+LABELV $198
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ADDRGP4 cgs+56016
+INDIRF4
+MULF4
+ASGNF4
+LABELV $199
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+679680+123336
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ADDRFP4 16
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 cgs+679680+123336
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $197
+endproc CG_DrawSides 12 36
+export CG_DrawTopBottom
+proc CG_DrawTopBottom 12 36
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRGP4 cg_verticalPlacement
+INDIRI4
+CNSTI4 0
+NEI4 $207
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ADDRGP4 cgs+56036
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $208
+JUMPV
+LABELV $207
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ADDRGP4 cgs+56020
+INDIRF4
+MULF4
+ASGNF4
+LABELV $208
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+679680+123336
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRFP4 16
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 cgs+679680+123336
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $206
+endproc CG_DrawTopBottom 12 36
+export CG_DrawRect
+proc CG_DrawRect 4 20
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawTopBottom
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 16
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+CNSTF4 1073741824
+ADDRFP4 16
+INDIRF4
+MULF4
+SUBF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawSides
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $215
+endproc CG_DrawRect 4 20
+export CG_ClearViewport
+proc CG_ClearViewport 4 36
+ADDRGP4 g_color_table
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cg+515612
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+515616
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+515620
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg+515624
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+679680+123336
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $216
+endproc CG_ClearViewport 4 36
+export CG_DrawPic
+proc CG_DrawPic 16 36
+ADDRFP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $224
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $225
+JUMPV
+LABELV $224
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+LABELV $225
+ADDRFP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $226
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRGP4 $227
+JUMPV
+LABELV $226
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+LABELV $227
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $223
+endproc CG_DrawPic 16 36
+export CG_DrawNamedPic
+proc CG_DrawNamedPic 4 20
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $228
+endproc CG_DrawNamedPic 4 20
+export CG_DrawPicColor
+proc CG_DrawPicColor 0 20
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $229
+endproc CG_DrawPicColor 0 20
+export CG_SetClipRegion
+proc CG_SetClipRegion 16 16
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetClipRegion
+CALLV
+pop
+LABELV $230
+endproc CG_SetClipRegion 16 16
+export CG_ClearClipRegion
+proc CG_ClearClipRegion 0 4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetClipRegion
+CALLV
+pop
+LABELV $234
+endproc CG_ClearClipRegion 0 4
+export CG_LerpColor
+proc CG_LerpColor 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $236
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $240
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $241
+JUMPV
+LABELV $240
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $242
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $242
+LABELV $241
+LABELV $237
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $236
+LABELV $235
+endproc CG_LerpColor 12 0
+export CG_FontForStyle
+proc CG_FontForStyle 32 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 3840
+BANDI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 768
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $256
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GTI4 $266
+LABELV $265
+ADDRLP4 20
+CNSTI4 256
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $250
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $245
+LABELV $267
+ADDRLP4 4
+INDIRI4
+CNSTI4 512
+EQI4 $253
+ADDRGP4 $245
+JUMPV
+LABELV $266
+ADDRLP4 28
+CNSTI4 1280
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $259
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GTI4 $269
+LABELV $268
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+EQI4 $248
+ADDRGP4 $245
+JUMPV
+LABELV $269
+ADDRLP4 4
+INDIRI4
+CNSTI4 1536
+EQI4 $262
+ADDRGP4 $245
+JUMPV
+LABELV $248
+ADDRLP4 0
+ADDRGP4 cgs+679680
+ASGNP4
+ADDRGP4 $246
+JUMPV
+LABELV $250
+ADDRLP4 0
+ADDRGP4 cgs+679680+20556
+ASGNP4
+ADDRGP4 $246
+JUMPV
+LABELV $253
+LABELV $245
+ADDRLP4 0
+ADDRGP4 cgs+679680+41112
+ASGNP4
+ADDRGP4 $246
+JUMPV
+LABELV $256
+ADDRLP4 0
+ADDRGP4 cgs+679680+61668
+ASGNP4
+ADDRGP4 $246
+JUMPV
+LABELV $259
+ADDRLP4 0
+ADDRGP4 cgs+679680+82224
+ASGNP4
+ADDRGP4 $246
+JUMPV
+LABELV $262
+ADDRLP4 0
+ADDRGP4 cgs+679680+102780
+ASGNP4
+LABELV $246
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $244
+endproc CG_FontForStyle 32 0
+export CG_DrawString
+proc CG_DrawString 12 52
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_FontForStyle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawStringCommon
+CALLV
+pop
+LABELV $270
+endproc CG_DrawString 12 52
+export CG_DrawStringWithCursor
+proc CG_DrawStringWithCursor 4 52
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawStringCommon
+CALLV
+pop
+LABELV $271
+endproc CG_DrawStringWithCursor 4 52
+export CG_DrawStringExt
+proc CG_DrawStringExt 12 52
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_FontForStyle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawStringCommon
+CALLV
+pop
+LABELV $272
+endproc CG_DrawStringExt 12 52
+export CG_DrawStringAutoWrap
+proc CG_DrawStringAutoWrap 8 52
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_FontForStyle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRLP4 4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawStringCommon
+CALLV
+pop
+LABELV $273
+endproc CG_DrawStringAutoWrap 8 52
+export CG_DrawStringCommon
+proc CG_DrawStringCommon 72 60
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 32
+ADDRFP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $275
+ADDRGP4 $274
+JUMPV
+LABELV $275
+ADDRFP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $277
+ADDRFP4 20
+ADDRGP4 colorWhite
+ASGNP4
+LABELV $277
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 8192
+BANDI4
+ADDRLP4 44
+INDIRI4
+EQI4 $279
+ADDRGP4 cg+512308
+INDIRI4
+CNSTI4 200
+DIVI4
+CNSTI4 1
+BANDI4
+ADDRLP4 44
+INDIRI4
+EQI4 $279
+ADDRGP4 $274
+JUMPV
+LABELV $279
+ADDRFP4 12
+INDIRI4
+CNSTI4 3840
+BANDI4
+CNSTI4 1280
+NEI4 $282
+ADDRFP4 16
+INDIRP4
+CNSTI4 7776
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $284
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+CNSTI4 -131073
+BANDI4
+ASGNI4
+LABELV $284
+LABELV $282
+ADDRLP4 0
+ADDRFP4 16
+INDIRP4
+CNSTI4 20548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 32
+INDIRF4
+CNSTF4 0
+NEF4 $286
+ADDRFP4 12
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $286
+ADDRFP4 32
+CNSTF4 1073741824
+ASGNF4
+LABELV $286
+ADDRFP4 36
+INDIRF4
+CNSTF4 0
+NEF4 $288
+ADDRFP4 12
+INDIRI4
+CNSTI4 131072
+BANDI4
+CNSTI4 0
+EQI4 $288
+ADDRFP4 36
+CNSTF4 1053609165
+ASGNF4
+LABELV $288
+ADDRFP4 24
+INDIRF4
+CNSTF4 0
+GTF4 $290
+ADDRFP4 24
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1111490560
+DIVF4
+ASGNF4
+ADDRGP4 $291
+JUMPV
+LABELV $290
+ADDRLP4 0
+CNSTF4 1111490560
+ADDRFP4 24
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $291
+ADDRFP4 12
+INDIRI4
+CNSTI4 262144
+BANDI4
+CNSTI4 0
+NEI4 $292
+ADDRGP4 cg+522860
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $292
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 1
+EQI4 $295
+ADDRFP4 32
+ADDRFP4 32
+INDIRF4
+ADDRGP4 cg_splitviewTextScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRF4
+ADDRGP4 cg_splitviewTextScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_splitviewTextScale+8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $296
+JUMPV
+LABELV $295
+ADDRFP4 32
+ADDRFP4 32
+INDIRF4
+ADDRGP4 cg_hudTextScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRF4
+ADDRGP4 cg_hudTextScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_hudTextScale+8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $296
+LABELV $292
+ADDRFP4 12
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $304
+ADDRLP4 48
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 8
+ADDRLP4 48
+INDIRF4
+ADDRFP4 20
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 48
+INDIRF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 1061997773
+ADDRFP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+12
+CNSTF4 1061997773
+ADDRFP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+512308
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 56
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 CG_LerpColor
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 28
+ASGNP4
+ADDRGP4 $305
+JUMPV
+LABELV $304
+ADDRLP4 24
+ADDRFP4 20
+INDIRP4
+ASGNP4
+LABELV $305
+ADDRFP4 48
+INDIRF4
+CNSTF4 0
+GTF4 $310
+ADDRLP4 48
+ADDRFP4 12
+INDIRI4
+CNSTI4 15
+BANDI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+EQI4 $313
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+EQI4 $315
+ADDRLP4 48
+INDIRI4
+CNSTI4 3
+EQI4 $316
+ADDRGP4 $313
+JUMPV
+LABELV $315
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 56
+ADDRGP4 Text_Width
+CALLF4
+ASGNF4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $313
+JUMPV
+LABELV $316
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 60
+ADDRGP4 Text_Width
+CALLF4
+ASGNF4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 60
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $313
+ADDRLP4 56
+ADDRFP4 12
+INDIRI4
+CNSTI4 240
+BANDI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 32
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $321
+ADDRLP4 56
+INDIRI4
+ADDRLP4 64
+INDIRI4
+GTI4 $325
+LABELV $324
+ADDRLP4 56
+INDIRI4
+CNSTI4 16
+EQI4 $319
+ADDRGP4 $319
+JUMPV
+LABELV $325
+ADDRLP4 56
+INDIRI4
+CNSTI4 48
+EQI4 $322
+ADDRGP4 $319
+JUMPV
+LABELV $321
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $319
+JUMPV
+LABELV $322
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $319
+LABELV $310
+ADDRLP4 4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8244
+ADDP4
+INDIRI4
+NEGI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8240
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CVIF4 4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRFP4 24
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $326
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1098907648
+DIVF4
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $326
+ADDRFP4 44
+INDIRI4
+CNSTI4 0
+LTI4 $328
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 40
+INDIRI4
+ARGI4
+ADDRFP4 44
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $332
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $333
+JUMPV
+LABELV $332
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $333
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $334
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+ADDRGP4 $335
+JUMPV
+LABELV $334
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $335
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintWithCursor
+CALLV
+pop
+ADDRGP4 $329
+JUMPV
+LABELV $328
+ADDRFP4 48
+INDIRF4
+CNSTF4 0
+LEF4 $336
+ADDRFP4 12
+INDIRI4
+CNSTI4 262144
+BORI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 60
+INDIRI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 20548
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 262144
+BANDI4
+CNSTI4 0
+NEI4 $338
+ADDRGP4 cg+522860
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $338
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 1
+EQI4 $341
+ADDRLP4 56
+ADDRLP4 56
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_splitviewTextScale+8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $342
+JUMPV
+LABELV $341
+ADDRLP4 56
+ADDRLP4 56
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_hudTextScale+8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $342
+LABELV $338
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $348
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+LABELV $349
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $350
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $351
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRFP4 48
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint_AutoWrapped
+CALLV
+pop
+ADDRGP4 $337
+JUMPV
+LABELV $336
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $354
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $355
+JUMPV
+LABELV $354
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $355
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $356
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+ADDRGP4 $357
+JUMPV
+LABELV $356
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $357
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $337
+LABELV $329
+LABELV $274
+endproc CG_DrawStringCommon 72 60
+export CG_DrawBigString
+proc CG_DrawBigString 20 20
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 4608
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $358
+endproc CG_DrawBigString 20 20
+export CG_DrawBigStringColor
+proc CG_DrawBigStringColor 0 20
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 70144
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $362
+endproc CG_DrawBigStringColor 0 20
+export CG_DrawSmallString
+proc CG_DrawSmallString 20 20
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $363
+endproc CG_DrawSmallString 20 20
+export CG_DrawSmallStringColor
+proc CG_DrawSmallStringColor 0 20
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 65792
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $367
+endproc CG_DrawSmallStringColor 0 20
+export CG_DrawStrlenCommon
+proc CG_DrawStrlenCommon 8 16
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+CNSTI4 20548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 262144
+BANDI4
+CNSTI4 0
+NEI4 $369
+ADDRGP4 cg+522860
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $369
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 1
+EQI4 $372
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_splitviewTextScale+8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $373
+JUMPV
+LABELV $372
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_hudTextScale+8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $373
+LABELV $369
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1111490560
+DIVF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+RETF4
+LABELV $368
+endproc CG_DrawStrlenCommon 8 16
+export CG_DrawStrlenMaxChars
+proc CG_DrawStrlenMaxChars 8 16
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_FontForStyle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_DrawStrlenCommon
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+RETF4
+LABELV $377
+endproc CG_DrawStrlenMaxChars 8 16
+export CG_DrawStrlen
+proc CG_DrawStrlen 8 16
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_FontForStyle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_DrawStrlenCommon
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+RETF4
+LABELV $378
+endproc CG_DrawStrlen 8 16
+export CG_DrawStringLineHeight
+proc CG_DrawStringLineHeight 44 0
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRI4
+CNSTI4 3840
+BANDI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 768
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $391
+ADDRLP4 16
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $405
+LABELV $404
+ADDRLP4 32
+CNSTI4 256
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $385
+ADDRLP4 16
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $380
+LABELV $406
+ADDRLP4 16
+INDIRI4
+CNSTI4 512
+EQI4 $388
+ADDRGP4 $380
+JUMPV
+LABELV $405
+ADDRLP4 40
+CNSTI4 1280
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $394
+ADDRLP4 16
+INDIRI4
+ADDRLP4 40
+INDIRI4
+GTI4 $408
+LABELV $407
+ADDRLP4 16
+INDIRI4
+CNSTI4 1024
+EQI4 $383
+ADDRGP4 $380
+JUMPV
+LABELV $408
+ADDRLP4 16
+INDIRI4
+CNSTI4 1536
+EQI4 $397
+ADDRGP4 $380
+JUMPV
+LABELV $383
+ADDRLP4 12
+ADDRGP4 cgs+679680
+ASGNP4
+ADDRGP4 $381
+JUMPV
+LABELV $385
+ADDRLP4 12
+ADDRGP4 cgs+679680+20556
+ASGNP4
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $381
+JUMPV
+LABELV $388
+LABELV $380
+ADDRLP4 12
+ADDRGP4 cgs+679680+41112
+ASGNP4
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $381
+JUMPV
+LABELV $391
+ADDRLP4 12
+ADDRGP4 cgs+679680+61668
+ASGNP4
+ADDRLP4 4
+CNSTI4 6
+ASGNI4
+ADDRGP4 $381
+JUMPV
+LABELV $394
+ADDRLP4 12
+ADDRGP4 cgs+679680+82224
+ASGNP4
+ADDRGP4 $381
+JUMPV
+LABELV $397
+ADDRLP4 12
+ADDRGP4 cgs+679680+102780
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 20548
+ADDP4
+INDIRI4
+CNSTI4 16
+LTI4 $400
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $381
+JUMPV
+LABELV $400
+ADDRLP4 12
+INDIRP4
+CNSTI4 20548
+ADDP4
+INDIRI4
+CNSTI4 12
+LTI4 $402
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $381
+JUMPV
+LABELV $402
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $381
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+CNSTI4 20548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 262144
+BANDI4
+CNSTI4 0
+NEI4 $409
+ADDRGP4 cg+522860
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $409
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 1
+EQI4 $412
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_splitviewTextScale+8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $413
+JUMPV
+LABELV $412
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_hudTextScale+8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $413
+LABELV $409
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $379
+endproc CG_DrawStringLineHeight 44 0
+export CG_MField_Draw
+proc CG_MField_Draw 4 28
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_FontForStyle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 MField_Draw
+CALLV
+pop
+LABELV $417
+endproc CG_MField_Draw 4 28
+proc CG_TileClearBox 44 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $418
+endproc CG_TileClearBox 44 36
+export CG_TileClear
+proc CG_TileClear 56 20
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $424
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 100
+LTI4 $420
+LABELV $424
+ADDRGP4 $419
+JUMPV
+LABELV $420
+ADDRLP4 8
+ADDRGP4 cg+515612
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 cg+515616
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg+515620
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 cg+515624
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+512444+4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+512444+12
+INDIRI4
+ADDI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cg+512444
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+512444+8
+INDIRI4
+ADDI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgs+679680+124788
+INDIRI4
+ARGI4
+ADDRGP4 CG_TileClearBox
+CALLV
+pop
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRGP4 cgs+679680+124788
+INDIRI4
+ARGI4
+ADDRGP4 CG_TileClearBox
+CALLV
+pop
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 cgs+679680+124788
+INDIRI4
+ARGI4
+ADDRGP4 CG_TileClearBox
+CALLV
+pop
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 cgs+679680+124788
+INDIRI4
+ARGI4
+ADDRGP4 CG_TileClearBox
+CALLV
+pop
+LABELV $419
+endproc CG_TileClear 56 20
+bss
+align 4
+LABELV $445
+skip 16
+export CG_FadeColor
+code
+proc CG_FadeColor 8 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $446
+CNSTP4 0
+RETP4
+ADDRGP4 $444
+JUMPV
+LABELV $446
+ADDRLP4 0
+ADDRGP4 cg+512320
+INDIRI4
+ADDRFP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $449
+CNSTP4 0
+RETP4
+ADDRGP4 $444
+JUMPV
+LABELV $449
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 200
+GEI4 $451
+ADDRGP4 $445+12
+CNSTF4 1065353216
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRGP4 $452
+JUMPV
+LABELV $451
+ADDRGP4 $445+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $452
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $445+8
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $445+4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $445
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $445
+RETP4
+LABELV $444
+endproc CG_FadeColor 8 0
+data
+align 4
+LABELV $458
+byte 4 1065353216
+byte 4 1045220557
+byte 4 1045220557
+byte 4 1065353216
+align 4
+LABELV $459
+byte 4 1045220557
+byte 4 1045220557
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $460
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $461
+byte 4 1060320051
+byte 4 1060320051
+byte 4 1060320051
+byte 4 1065353216
+export CG_TeamColor
+code
+proc CG_TeamColor 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $464
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $465
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+EQI4 $466
+ADDRGP4 $462
+JUMPV
+LABELV $464
+ADDRGP4 $458
+RETP4
+ADDRGP4 $457
+JUMPV
+LABELV $465
+ADDRGP4 $459
+RETP4
+ADDRGP4 $457
+JUMPV
+LABELV $466
+ADDRGP4 $461
+RETP4
+ADDRGP4 $457
+JUMPV
+LABELV $462
+ADDRGP4 $460
+RETP4
+LABELV $457
+endproc CG_TeamColor 4 0
+export CG_GetColorForHealth
+proc CG_GetColorForHealth 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $468
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $467
+JUMPV
+LABELV $468
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1059648963
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1051595899
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GEI4 $470
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $470
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 100
+LTI4 $472
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $473
+JUMPV
+LABELV $472
+ADDRFP4 0
+INDIRI4
+CNSTI4 66
+GEI4 $474
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $475
+JUMPV
+LABELV $474
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 66
+SUBI4
+CVIF4 4
+CNSTF4 1107558400
+DIVF4
+ASGNF4
+LABELV $475
+LABELV $473
+ADDRFP4 0
+INDIRI4
+CNSTI4 60
+LEI4 $476
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $477
+JUMPV
+LABELV $476
+ADDRFP4 0
+INDIRI4
+CNSTI4 30
+GEI4 $478
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $479
+JUMPV
+LABELV $478
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 30
+SUBI4
+CVIF4 4
+CNSTF4 1106247680
+DIVF4
+ASGNF4
+LABELV $479
+LABELV $477
+LABELV $467
+endproc CG_GetColorForHealth 16 0
+export CG_ColorForHealth
+proc CG_ColorForHealth 0 12
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_GetColorForHealth
+CALLV
+pop
+LABELV $480
+endproc CG_ColorForHealth 0 12
+export CG_KeysStringForBinding
+proc CG_KeysStringForBinding 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $487
+JUMPV
+LABELV $484
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 trap_Key_GetKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $485
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $487
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LTI4 $484
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+NEI4 $488
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $490
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $483
+JUMPV
+LABELV $488
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 32
+ADDRFP4 8
+INDIRI4
+GEI4 $492
+ADDRLP4 52
+CNSTI4 32
+ASGNI4
+ADDRGP4 $493
+JUMPV
+LABELV $492
+ADDRLP4 52
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $493
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 trap_Key_KeynumToStringBuf
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 8+4
+INDIRI4
+CNSTI4 -1
+EQI4 $494
+ADDRLP4 8+4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Key_KeynumToStringBuf
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $498
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $494
+LABELV $483
+endproc CG_KeysStringForBinding 56 12
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_drawScores
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $498
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 0
+align 1
+LABELV $490
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
@@ -0,0 +1,8194 @@
+bss
+align 1
+LABELV $97
+skip 64
+export CG_PlaceString
+code
+proc CG_PlaceString 12 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $98
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 $100
+ASGNP4
+ADDRGP4 $99
+JUMPV
+LABELV $98
+ADDRLP4 4
+ADDRGP4 $101
+ASGNP4
+LABELV $99
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $102
+ADDRLP4 0
+ADDRGP4 $104
+ASGNP4
+ADDRGP4 $103
+JUMPV
+LABELV $102
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $105
+ADDRLP4 0
+ADDRGP4 $107
+ASGNP4
+ADDRGP4 $106
+JUMPV
+LABELV $105
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $108
+ADDRLP4 0
+ADDRGP4 $110
+ASGNP4
+ADDRGP4 $109
+JUMPV
+LABELV $108
+ADDRFP4 0
+INDIRI4
+CNSTI4 11
+NEI4 $111
+ADDRLP4 0
+ADDRGP4 $113
+ASGNP4
+ADDRGP4 $112
+JUMPV
+LABELV $111
+ADDRFP4 0
+INDIRI4
+CNSTI4 12
+NEI4 $114
+ADDRLP4 0
+ADDRGP4 $116
+ASGNP4
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRFP4 0
+INDIRI4
+CNSTI4 13
+NEI4 $117
+ADDRLP4 0
+ADDRGP4 $119
+ASGNP4
+ADDRGP4 $118
+JUMPV
+LABELV $117
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 1
+NEI4 $120
+ADDRGP4 $122
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $121
+JUMPV
+LABELV $120
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+NEI4 $123
+ADDRGP4 $125
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $124
+JUMPV
+LABELV $123
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 3
+NEI4 $126
+ADDRGP4 $128
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRGP4 $129
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $127
+LABELV $124
+LABELV $121
+LABELV $118
+LABELV $115
+LABELV $112
+LABELV $109
+LABELV $106
+LABELV $103
+ADDRGP4 $97
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $130
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $97
+RETP4
+LABELV $96
+endproc CG_PlaceString 12 20
+proc CG_Obituary 148 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $134
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $132
+LABELV $134
+ADDRGP4 $135
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $132
+ADDRLP4 96
+CNSTI4 2044
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $139
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $137
+LABELV $139
+ADDRLP4 4
+CNSTI4 4094
+ASGNI4
+ADDRLP4 88
+CNSTP4 0
+ASGNP4
+ADDRGP4 $138
+JUMPV
+LABELV $137
+ADDRLP4 4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 116
+INDIRP4
+ASGNP4
+LABELV $138
+ADDRLP4 8
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 116
+INDIRP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $140
+ADDRGP4 $131
+JUMPV
+LABELV $140
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 $142
+ARGP4
+ADDRLP4 120
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+CNSTI4 30
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 $143
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 92
+ADDRGP4 $101
+ASGNP4
+ADDRLP4 80
+INDIRI4
+CNSTI4 14
+LTI4 $144
+ADDRLP4 80
+INDIRI4
+CNSTI4 22
+GTI4 $144
+ADDRLP4 80
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $162-56
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $162
+address $152
+address $154
+address $156
+address $150
+address $144
+address $148
+address $146
+address $158
+address $160
+code
+LABELV $146
+ADDRLP4 76
+ADDRGP4 $147
+ASGNP4
+ADDRGP4 $145
+JUMPV
+LABELV $148
+ADDRLP4 76
+ADDRGP4 $149
+ASGNP4
+ADDRGP4 $145
+JUMPV
+LABELV $150
+ADDRLP4 76
+ADDRGP4 $151
+ASGNP4
+ADDRGP4 $145
+JUMPV
+LABELV $152
+ADDRLP4 76
+ADDRGP4 $153
+ASGNP4
+ADDRGP4 $145
+JUMPV
+LABELV $154
+ADDRLP4 76
+ADDRGP4 $155
+ASGNP4
+ADDRGP4 $145
+JUMPV
+LABELV $156
+ADDRLP4 76
+ADDRGP4 $157
+ASGNP4
+ADDRGP4 $145
+JUMPV
+LABELV $158
+ADDRLP4 76
+ADDRGP4 $159
+ASGNP4
+ADDRGP4 $145
+JUMPV
+LABELV $160
+ADDRLP4 76
+ADDRGP4 $161
+ASGNP4
+ADDRGP4 $145
+JUMPV
+LABELV $144
+ADDRLP4 76
+CNSTP4 0
+ASGNP4
+LABELV $145
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $164
+ADDRLP4 100
+ADDRLP4 96
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 5
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ADDRLP4 132
+INDIRI4
+EQI4 $168
+ADDRLP4 80
+INDIRI4
+CNSTI4 7
+EQI4 $176
+ADDRLP4 80
+INDIRI4
+CNSTI4 9
+EQI4 $184
+ADDRLP4 80
+INDIRI4
+ADDRLP4 132
+INDIRI4
+LTI4 $166
+LABELV $201
+ADDRLP4 80
+INDIRI4
+CNSTI4 13
+EQI4 $192
+ADDRGP4 $166
+JUMPV
+LABELV $168
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+NEI4 $169
+ADDRLP4 76
+ADDRGP4 $171
+ASGNP4
+ADDRGP4 $167
+JUMPV
+LABELV $169
+ADDRLP4 100
+INDIRI4
+CNSTI4 2
+NEI4 $172
+ADDRLP4 76
+ADDRGP4 $174
+ASGNP4
+ADDRGP4 $167
+JUMPV
+LABELV $172
+ADDRLP4 76
+ADDRGP4 $175
+ASGNP4
+ADDRGP4 $167
+JUMPV
+LABELV $176
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+NEI4 $177
+ADDRLP4 76
+ADDRGP4 $179
+ASGNP4
+ADDRGP4 $167
+JUMPV
+LABELV $177
+ADDRLP4 100
+INDIRI4
+CNSTI4 2
+NEI4 $180
+ADDRLP4 76
+ADDRGP4 $182
+ASGNP4
+ADDRGP4 $167
+JUMPV
+LABELV $180
+ADDRLP4 76
+ADDRGP4 $183
+ASGNP4
+ADDRGP4 $167
+JUMPV
+LABELV $184
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+NEI4 $185
+ADDRLP4 76
+ADDRGP4 $187
+ASGNP4
+ADDRGP4 $167
+JUMPV
+LABELV $185
+ADDRLP4 100
+INDIRI4
+CNSTI4 2
+NEI4 $188
+ADDRLP4 76
+ADDRGP4 $190
+ASGNP4
+ADDRGP4 $167
+JUMPV
+LABELV $188
+ADDRLP4 76
+ADDRGP4 $191
+ASGNP4
+ADDRGP4 $167
+JUMPV
+LABELV $192
+ADDRLP4 76
+ADDRGP4 $193
+ASGNP4
+ADDRGP4 $167
+JUMPV
+LABELV $166
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+NEI4 $194
+ADDRLP4 76
+ADDRGP4 $196
+ASGNP4
+ADDRGP4 $167
+JUMPV
+LABELV $194
+ADDRLP4 100
+INDIRI4
+CNSTI4 2
+NEI4 $197
+ADDRLP4 76
+ADDRGP4 $199
+ASGNP4
+ADDRGP4 $167
+JUMPV
+LABELV $197
+ADDRLP4 76
+ADDRGP4 $200
+ASGNP4
+LABELV $167
+LABELV $164
+ADDRLP4 76
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $202
+ADDRGP4 $204
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $131
+JUMPV
+LABELV $202
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_LocalPlayerState
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $205
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $210
+JUMPV
+LABELV $207
+ADDRLP4 4
+INDIRI4
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+EQI4 $211
+ADDRGP4 $208
+JUMPV
+LABELV $211
+ADDRLP4 136
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+ASGNP4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+GEI4 $215
+ADDRLP4 136
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 136
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRGP4 $216
+JUMPV
+LABELV $215
+ADDRGP4 $219
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 140
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 132
+ADDRLP4 140
+INDIRP4
+ASGNP4
+LABELV $216
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTF4 1056964608
+ARGF4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $208
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $210
+ADDRLP4 140
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $207
+LABELV $205
+ADDRLP4 88
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $220
+ADDRLP4 4
+CNSTI4 4094
+ASGNI4
+ADDRLP4 44
+ARGP4
+ADDRGP4 $222
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $221
+JUMPV
+LABELV $220
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 $142
+ARGP4
+ADDRLP4 132
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+CNSTI4 30
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 44
+ARGP4
+ADDRGP4 $143
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $226
+JUMPV
+LABELV $223
+ADDRLP4 8
+INDIRI4
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+NEI4 $227
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+36008
+ADDP4
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $227
+LABELV $224
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $226
+ADDRLP4 136
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $223
+LABELV $221
+ADDRLP4 4
+INDIRI4
+CNSTI4 4094
+EQI4 $234
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+LTI4 $236
+ADDRLP4 80
+INDIRI4
+CNSTI4 23
+GTI4 $236
+ADDRLP4 80
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $271-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $271
+address $244
+address $240
+address $242
+address $246
+address $249
+address $252
+address $254
+address $256
+address $259
+address $260
+address $262
+address $264
+address $264
+address $236
+address $236
+address $236
+address $236
+address $267
+address $236
+address $236
+address $236
+address $236
+address $238
+code
+LABELV $238
+ADDRLP4 76
+ADDRGP4 $239
+ASGNP4
+ADDRGP4 $237
+JUMPV
+LABELV $240
+ADDRLP4 76
+ADDRGP4 $241
+ASGNP4
+ADDRGP4 $237
+JUMPV
+LABELV $242
+ADDRLP4 76
+ADDRGP4 $243
+ASGNP4
+ADDRGP4 $237
+JUMPV
+LABELV $244
+ADDRLP4 76
+ADDRGP4 $245
+ASGNP4
+ADDRGP4 $237
+JUMPV
+LABELV $246
+ADDRLP4 76
+ADDRGP4 $247
+ASGNP4
+ADDRLP4 92
+ADDRGP4 $248
+ASGNP4
+ADDRGP4 $237
+JUMPV
+LABELV $249
+ADDRLP4 76
+ADDRGP4 $250
+ASGNP4
+ADDRLP4 92
+ADDRGP4 $251
+ASGNP4
+ADDRGP4 $237
+JUMPV
+LABELV $252
+ADDRLP4 76
+ADDRGP4 $247
+ASGNP4
+ADDRLP4 92
+ADDRGP4 $253
+ASGNP4
+ADDRGP4 $237
+JUMPV
+LABELV $254
+ADDRLP4 76
+ADDRGP4 $255
+ASGNP4
+ADDRLP4 92
+ADDRGP4 $253
+ASGNP4
+ADDRGP4 $237
+JUMPV
+LABELV $256
+ADDRLP4 76
+ADDRGP4 $257
+ASGNP4
+ADDRLP4 92
+ADDRGP4 $258
+ASGNP4
+ADDRGP4 $237
+JUMPV
+LABELV $259
+ADDRLP4 76
+ADDRGP4 $257
+ASGNP4
+ADDRLP4 92
+ADDRGP4 $258
+ASGNP4
+ADDRGP4 $237
+JUMPV
+LABELV $260
+ADDRLP4 76
+ADDRGP4 $261
+ASGNP4
+ADDRGP4 $237
+JUMPV
+LABELV $262
+ADDRLP4 76
+ADDRGP4 $263
+ASGNP4
+ADDRGP4 $237
+JUMPV
+LABELV $264
+ADDRLP4 76
+ADDRGP4 $265
+ASGNP4
+ADDRLP4 92
+ADDRGP4 $266
+ASGNP4
+ADDRGP4 $237
+JUMPV
+LABELV $267
+ADDRLP4 76
+ADDRGP4 $268
+ASGNP4
+ADDRLP4 92
+ADDRGP4 $269
+ASGNP4
+ADDRGP4 $237
+JUMPV
+LABELV $236
+ADDRLP4 76
+ADDRGP4 $270
+ASGNP4
+LABELV $237
+ADDRLP4 76
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $273
+ADDRGP4 $275
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $131
+JUMPV
+LABELV $273
+LABELV $234
+ADDRGP4 $276
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $131
+endproc CG_Obituary 148 20
+proc CG_UseItem 40 16
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+CNSTI4 24
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $280
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+LEI4 $278
+LABELV $280
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $278
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $284
+JUMPV
+LABELV $281
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+EQI4 $285
+ADDRGP4 $282
+JUMPV
+LABELV $285
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $288
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $290
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTF4 1056964608
+ARGF4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $289
+JUMPV
+LABELV $288
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 BG_FindItemForHoldable
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 $291
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTF4 1056964608
+ARGF4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $289
+LABELV $282
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $284
+ADDRLP4 28
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $281
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $294
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $293
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $298
+ADDRGP4 $292
+JUMPV
+LABELV $292
+LABELV $294
+CNSTP4 0
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+679680+126024
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $293
+JUMPV
+LABELV $298
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $299
+ADDRLP4 36
+INDIRI4
+CNSTI4 64
+GEI4 $299
+ADDRLP4 20
+CNSTI4 2044
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $299
+CNSTP4 0
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+679680+126340
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $293
+LABELV $277
+endproc CG_UseItem 40 16
+proc CG_ItemPickup 8 0
+ADDRLP4 0
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 48
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35840
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35844
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35848
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $309
+CNSTI4 272
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_autoswitch+12
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $311
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $311
+ADDRLP4 0
+INDIRP4
+CNSTI4 35852
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 34568
+ADDP4
+CNSTI4 48
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $311
+LABELV $309
+LABELV $305
+endproc CG_ItemPickup 8 0
+export CG_WaterLevel
+proc CG_WaterLevel 56 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 13
+EQI4 $319
+ADDRLP4 16
+INDIRI4
+CNSTI4 23
+NEI4 $317
+LABELV $319
+ADDRLP4 24
+CNSTI4 12
+ASGNI4
+ADDRGP4 $318
+JUMPV
+LABELV $317
+ADDRLP4 24
+CNSTI4 26
+ASGNI4
+LABELV $318
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $322
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+CNSTI4 -24
+SUBI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $325
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 748
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $328
+ADDRLP4 20
+CNSTI4 3
+ASGNI4
+LABELV $328
+LABELV $325
+LABELV $322
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $316
+endproc CG_WaterLevel 56 8
+export CG_PainEvent
+proc CG_PainEvent 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+512320
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 500
+GEI4 $331
+ADDRGP4 $330
+JUMPV
+LABELV $331
+ADDRFP4 4
+INDIRI4
+CNSTI4 25
+GEI4 $334
+ADDRLP4 0
+ADDRGP4 $336
+ASGNP4
+ADDRGP4 $335
+JUMPV
+LABELV $334
+ADDRFP4 4
+INDIRI4
+CNSTI4 50
+GEI4 $337
+ADDRLP4 0
+ADDRGP4 $339
+ASGNP4
+ADDRGP4 $338
+JUMPV
+LABELV $337
+ADDRFP4 4
+INDIRI4
+CNSTI4 75
+GEI4 $340
+ADDRLP4 0
+ADDRGP4 $342
+ASGNP4
+ADDRGP4 $341
+JUMPV
+LABELV $340
+ADDRLP4 0
+ADDRGP4 $343
+ASGNP4
+LABELV $341
+LABELV $338
+LABELV $335
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_WaterLevel
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $344
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $346
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $348
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $345
+JUMPV
+LABELV $346
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $349
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $345
+JUMPV
+LABELV $344
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $345
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+LABELV $330
+endproc CG_PainEvent 16 16
+lit
+align 4
+LABELV $509
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export CG_EntityEvent
+code
+proc CG_EntityEvent 164 48
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $352
+ADDRGP4 $355
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $352
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $356
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $351
+ADDRGP4 $361
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $351
+JUMPV
+LABELV $356
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $364
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $362
+LABELV $364
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $362
+ADDRLP4 16
+CNSTI4 2044
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+LTI4 $366
+ADDRLP4 12
+INDIRI4
+CNSTI4 74
+GTI4 $366
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $991-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $991
+address $368
+address $378
+address $389
+address $400
+address $411
+address $477
+address $477
+address $477
+address $477
+address $422
+address $441
+address $458
+address $504
+address $516
+address $527
+address $534
+address $541
+address $548
+address $554
+address $578
+address $595
+address $607
+address $614
+address $619
+address $619
+address $619
+address $619
+address $619
+address $619
+address $619
+address $619
+address $619
+address $619
+address $619
+address $619
+address $619
+address $619
+address $619
+address $619
+address $645
+address $638
+address $624
+address $631
+address $653
+address $745
+address $754
+address $763
+address $735
+address $730
+address $669
+address $674
+address $679
+address $684
+address $740
+address $886
+address $893
+address $893
+address $893
+address $914
+address $919
+address $938
+address $957
+address $664
+address $366
+address $366
+address $366
+address $366
+address $366
+address $366
+address $366
+address $366
+address $981
+address $976
+address $521
+code
+LABELV $368
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $369
+ADDRGP4 $372
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $369
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $367
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 cgs+679680+126032
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $378
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $379
+ADDRGP4 $382
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $379
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $367
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+126032+80
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $389
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $390
+ADDRGP4 $393
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $390
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $367
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+126032+96
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $400
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $401
+ADDRGP4 $404
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $401
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $367
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+126032+96
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $411
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $412
+ADDRGP4 $415
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $412
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $367
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+126032+96
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $422
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $423
+ADDRGP4 $426
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $423
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+679680+126212
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $432
+JUMPV
+LABELV $429
+ADDRLP4 8
+INDIRI4
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+NEI4 $433
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+34480
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+34484
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $433
+LABELV $430
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $432
+ADDRLP4 44
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LTI4 $429
+ADDRGP4 $367
+JUMPV
+LABELV $441
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $442
+ADDRGP4 $445
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $442
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $343
+ARGP4
+ADDRLP4 48
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $446
+ADDRLP4 8
+INDIRI4
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+NEI4 $450
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+34480
+ADDP4
+CNSTF4 3246391296
+ASGNF4
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+34484
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $450
+LABELV $447
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $449
+ADDRLP4 52
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LTI4 $446
+ADDRGP4 $367
+JUMPV
+LABELV $458
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $459
+ADDRGP4 $462
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $459
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $463
+ARGP4
+ADDRLP4 56
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $468
+JUMPV
+LABELV $465
+ADDRLP4 8
+INDIRI4
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+NEI4 $469
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+34480
+ADDP4
+CNSTF4 3250585600
+ASGNF4
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+34484
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $469
+LABELV $466
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $468
+ADDRLP4 60
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LTI4 $465
+ADDRGP4 $367
+JUMPV
+LABELV $477
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $478
+ADDRGP4 $481
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $478
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $485
+JUMPV
+LABELV $482
+ADDRLP4 64
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+ASGNP4
+ADDRLP4 68
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+EQI4 $488
+ADDRGP4 $483
+JUMPV
+LABELV $488
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+20
+INDIRI4
+ADDRLP4 88
+INDIRI4
+NEI4 $497
+ADDRLP4 68
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 88
+INDIRI4
+NEI4 $497
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 88
+INDIRI4
+NEI4 $497
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 88
+INDIRI4
+EQI4 $490
+LABELV $497
+ADDRGP4 $483
+JUMPV
+LABELV $490
+ADDRLP4 72
+ADDRGP4 cg+512320
+INDIRI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 34468
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 200
+GEI4 $499
+ADDRLP4 76
+ADDRLP4 64
+INDIRP4
+CNSTI4 34464
+ADDP4
+INDIRF4
+CNSTI4 200
+ADDRLP4 72
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRGP4 $500
+JUMPV
+LABELV $499
+ADDRLP4 76
+CNSTF4 0
+ASGNF4
+LABELV $500
+ADDRLP4 80
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 24
+SUBI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 34464
+ADDP4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 34464
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+LEF4 $501
+ADDRLP4 64
+INDIRP4
+CNSTI4 34464
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+LABELV $501
+ADDRLP4 64
+INDIRP4
+CNSTI4 34468
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $483
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $485
+ADDRLP4 84
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 84
+INDIRI4
+LTI4 $482
+ADDRGP4 $367
+JUMPV
+LABELV $504
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $505
+ADDRGP4 $508
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $505
+ADDRLP4 64
+ADDRGP4 $509
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ARGP4
+ADDRLP4 64
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRLP4 76
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+CNSTF4 1148846080
+ARGF4
+ADDRGP4 cg+512320
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cgs+679680+124796
+INDIRI4
+ARGI4
+ADDRGP4 CG_SmokePuff
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 cgs+679680+126220
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $515
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $516
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $517
+ADDRGP4 $520
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $517
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $515
+ARGP4
+ADDRLP4 68
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $521
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $522
+ADDRGP4 $525
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $522
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $526
+ARGP4
+ADDRLP4 72
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $527
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $528
+ADDRGP4 $531
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $528
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+679680+126324
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $534
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $535
+ADDRGP4 $538
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $535
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+679680+126328
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $541
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $542
+ADDRGP4 $545
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $542
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+679680+126332
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $548
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $549
+ADDRGP4 $552
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $549
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 76
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $554
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $555
+ADDRGP4 $558
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $555
+ADDRLP4 80
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+LTI4 $561
+ADDRLP4 88
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $559
+LABELV $561
+ADDRGP4 $367
+JUMPV
+LABELV $559
+ADDRLP4 84
+CNSTI4 48
+ADDRLP4 80
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 84
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 5
+EQI4 $564
+ADDRLP4 92
+INDIRI4
+CNSTI4 8
+NEI4 $562
+LABELV $564
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+679680+126444
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $563
+JUMPV
+LABELV $562
+ADDRLP4 84
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $567
+ADDRGP4 $568
+JUMPV
+LABELV $567
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+124988
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $568
+LABELV $563
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $574
+JUMPV
+LABELV $571
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+NEI4 $575
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 CG_ItemPickup
+CALLV
+pop
+LABELV $575
+LABELV $572
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $574
+ADDRLP4 96
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LTI4 $571
+ADDRGP4 $367
+JUMPV
+LABELV $578
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $579
+ADDRGP4 $582
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $579
+ADDRLP4 80
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 84
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 1
+LTI4 $585
+ADDRLP4 84
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $583
+LABELV $585
+ADDRGP4 $367
+JUMPV
+LABELV $583
+ADDRLP4 80
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+124988
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $591
+JUMPV
+LABELV $588
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+NEI4 $592
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 CG_ItemPickup
+CALLV
+pop
+LABELV $592
+LABELV $589
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $591
+ADDRLP4 88
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LTI4 $588
+ADDRGP4 $367
+JUMPV
+LABELV $595
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $596
+ADDRGP4 $599
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $596
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $603
+JUMPV
+LABELV $600
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+NEI4 $604
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_OutOfAmmoChange
+CALLV
+pop
+LABELV $604
+LABELV $601
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $603
+ADDRLP4 80
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LTI4 $600
+ADDRGP4 $367
+JUMPV
+LABELV $607
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $608
+ADDRGP4 $611
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $608
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+679680+126020
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $614
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $615
+ADDRGP4 $618
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $615
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FireWeapon
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $619
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $620
+ADDRGP4 $623
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 24
+SUBI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $620
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $624
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $625
+ADDRGP4 $628
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $625
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+679680+126192
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SpawnEffect
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $631
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $632
+ADDRGP4 $635
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $632
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+679680+126196
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SpawnEffect
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $638
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $639
+ADDRGP4 $642
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $639
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+679680+126204
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $645
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $646
+ADDRGP4 $649
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $646
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+679680+126204
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $653
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $654
+ADDRGP4 $657
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $654
+ADDRLP4 84
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $658
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+679680+126448
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $658
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+679680+126452
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $664
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $665
+ADDRGP4 $668
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $665
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRP4
+CNSTI4 740
+ADDP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ScorePlum
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $669
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $670
+ADDRGP4 $673
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $670
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitPlayer
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $674
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $675
+ADDRGP4 $678
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $675
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $679
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $680
+ADDRGP4 $683
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $680
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $684
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $685
+ADDRGP4 $688
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $685
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRLP4 100
+ADDRLP4 4
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+LTI4 $689
+ADDRLP4 100
+INDIRI4
+CNSTI4 64
+GEI4 $689
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $694
+JUMPV
+LABELV $691
+ADDRLP4 4
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+NEI4 $695
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+35944
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $695
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_drawGun+12
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $700
+ADDRLP4 108
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+512444+36+12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+512444+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+512444+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $693
+JUMPV
+LABELV $700
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_drawGun+12
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $693
+ADDRLP4 120
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 cg+512444+36+12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 cg+512444+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 cg+512444+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $693
+JUMPV
+LABELV $695
+LABELV $692
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $694
+ADDRLP4 104
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 104
+INDIRI4
+LTI4 $691
+LABELV $693
+LABELV $689
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+ADDRGP4 CG_RailTrail
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 255
+EQI4 $367
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $730
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $731
+ADDRGP4 $734
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $731
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 4094
+ARGI4
+ADDRGP4 CG_Bullet
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $735
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $736
+ADDRGP4 $739
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $736
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Bullet
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $740
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $741
+ADDRGP4 $744
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $741
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_ShotgunFire
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $745
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $746
+ADDRGP4 $749
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $746
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+60356
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $750
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+60356
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $750
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 116
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $754
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $755
+ADDRGP4 $758
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $755
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+60356
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $759
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+60356
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $759
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 116
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $763
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $764
+ADDRGP4 $767
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $764
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $771
+JUMPV
+LABELV $768
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $772
+ADDRGP4 $769
+JUMPV
+LABELV $772
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $775
+ADDRLP4 116
+CNSTI4 1
+ASGNI4
+LABELV $775
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $778
+ADDRLP4 120
+CNSTI4 1
+ASGNI4
+LABELV $778
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 380
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $781
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+LABELV $781
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 376
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $784
+ADDRLP4 132
+CNSTI4 1
+ASGNI4
+LABELV $784
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $787
+ADDRLP4 124
+CNSTI4 1
+ASGNI4
+LABELV $787
+LABELV $769
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $771
+ADDRLP4 136
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $768
+ADDRLP4 140
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+LTI4 $367
+ADDRLP4 140
+INDIRI4
+CNSTI4 12
+GTI4 $367
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $885
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $885
+address $793
+address $800
+address $807
+address $816
+address $825
+address $840
+address $367
+address $367
+address $855
+address $858
+address $861
+address $869
+address $877
+code
+LABELV $793
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+EQI4 $794
+ADDRGP4 cgs+679680+126368
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $794
+ADDRGP4 cgs+679680+126372
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $800
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+EQI4 $801
+ADDRGP4 cgs+679680+126368
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $801
+ADDRGP4 cgs+679680+126372
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $807
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+EQI4 $808
+ADDRGP4 cgs+679680+126376
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $809
+JUMPV
+LABELV $808
+ADDRGP4 cgs+679680+126380
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $809
+ADDRGP4 cgs+679680+126396
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $816
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+EQI4 $817
+ADDRGP4 cgs+679680+126376
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $818
+JUMPV
+LABELV $817
+ADDRGP4 cgs+679680+126380
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $818
+ADDRGP4 cgs+679680+126392
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $825
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ADDRLP4 148
+INDIRI4
+NEI4 $828
+ADDRLP4 124
+INDIRI4
+ADDRLP4 148
+INDIRI4
+EQI4 $826
+LABELV $828
+ADDRGP4 $367
+JUMPV
+LABELV $826
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRLP4 152
+INDIRI4
+EQI4 $831
+ADDRLP4 116
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $367
+LABELV $831
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+EQI4 $832
+ADDRGP4 cgs+679680+126400
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $832
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+EQI4 $367
+ADDRGP4 cgs+679680+126404
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $840
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 156
+INDIRI4
+NEI4 $843
+ADDRLP4 124
+INDIRI4
+ADDRLP4 156
+INDIRI4
+EQI4 $841
+LABELV $843
+ADDRGP4 $367
+JUMPV
+LABELV $841
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRLP4 160
+INDIRI4
+EQI4 $846
+ADDRLP4 116
+INDIRI4
+ADDRLP4 160
+INDIRI4
+NEI4 $367
+LABELV $846
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+EQI4 $847
+ADDRGP4 cgs+679680+126400
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $847
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+EQI4 $367
+ADDRGP4 cgs+679680+126404
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $855
+ADDRGP4 cgs+679680+126348
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $858
+ADDRGP4 cgs+679680+126352
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $861
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+NEI4 $866
+ADDRGP4 cg_teamDmLeadAnnouncements+12
+INDIRI4
+CNSTI4 0
+EQI4 $367
+LABELV $866
+ADDRGP4 cgs+679680+126356
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $869
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+NEI4 $874
+ADDRGP4 cg_teamDmLeadAnnouncements+12
+INDIRI4
+CNSTI4 0
+EQI4 $367
+LABELV $874
+ADDRGP4 cgs+679680+126360
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $877
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+NEI4 $882
+ADDRGP4 cg_teamDmLeadAnnouncements+12
+INDIRI4
+CNSTI4 0
+EQI4 $367
+LABELV $882
+ADDRGP4 cgs+679680+126364
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $886
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $887
+ADDRGP4 $890
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $887
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_LocalPlayerState
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $367
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_PainEvent
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $893
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $894
+ADDRGP4 $897
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $894
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $898
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ARGP4
+ADDRGP4 CG_GibPlayer
+CALLV
+pop
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_blood+12
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $900
+ADDRGP4 cg_gibs+12
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $900
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+NEI4 $367
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+679680+126176
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $900
+ADDRLP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $908
+ADDRGP4 $367
+JUMPV
+LABELV $908
+LABELV $898
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 CG_WaterLevel
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 3
+NEI4 $910
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $912
+ARGP4
+ADDRLP4 124
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $910
+ADDRGP4 $913
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $914
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $915
+ADDRGP4 $918
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $915
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Obituary
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $919
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $920
+ADDRGP4 $923
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $920
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $927
+JUMPV
+LABELV $924
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+NEI4 $928
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+35632
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+35636
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $928
+LABELV $925
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $927
+ADDRLP4 124
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 124
+INDIRI4
+LTI4 $924
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+679680+126012
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $938
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $939
+ADDRGP4 $942
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $939
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $946
+JUMPV
+LABELV $943
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+NEI4 $947
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+35632
+ADDP4
+CNSTI4 2
+ASGNI4
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+35636
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $947
+LABELV $944
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $946
+ADDRLP4 128
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LTI4 $943
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+679680+126440
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $957
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $958
+ADDRGP4 $961
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $958
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $965
+JUMPV
+LABELV $962
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+NEI4 $966
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+35632
+ADDP4
+CNSTI4 5
+ASGNI4
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+35636
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $966
+LABELV $963
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $965
+ADDRLP4 132
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 132
+INDIRI4
+LTI4 $962
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+679680+126436
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $976
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $977
+ADDRGP4 $980
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $977
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StopLoopingSound
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $367
+JUMPV
+LABELV $981
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $982
+ADDRGP4 $985
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $982
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Beam
+CALLV
+pop
+ADDRGP4 $367
+JUMPV
+LABELV $366
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $986
+ADDRGP4 $989
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $986
+ADDRGP4 $990
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $367
+LABELV $351
+endproc CG_EntityEvent 164 48
+export CG_CheckEvents
+proc CG_CheckEvents 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 14
+LEI4 $994
+ADDRFP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $996
+ADDRGP4 $993
+JUMPV
+LABELV $996
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $998
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $998
+ADDRFP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 14
+SUBI4
+ASGNI4
+ADDRGP4 $995
+JUMPV
+LABELV $994
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+NEI4 $1000
+ADDRGP4 $993
+JUMPV
+LABELV $1000
+ADDRFP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+CNSTI4 0
+NEI4 $1002
+ADDRGP4 $993
+JUMPV
+LABELV $1002
+LABELV $995
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetEntitySoundPosition
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ARGP4
+ADDRGP4 CG_EntityEvent
+CALLV
+pop
+LABELV $993
+endproc CG_CheckEvents 8 12
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_drawScores
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $990
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $989
+byte 1 85
+byte 1 78
+byte 1 75
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $985
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 66
+byte 1 85
+byte 1 71
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $980
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 79
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 80
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $961
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $942
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 85
+byte 1 73
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $923
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 81
+byte 1 85
+byte 1 65
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $918
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 73
+byte 1 84
+byte 1 85
+byte 1 65
+byte 1 82
+byte 1 89
+byte 1 10
+byte 1 0
+align 1
+LABELV $913
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $912
+byte 1 42
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $897
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 72
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $890
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $767
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $758
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $749
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $744
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 84
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $739
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 70
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $734
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $688
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $683
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $678
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $673
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $668
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 67
+byte 1 79
+byte 1 82
+byte 1 69
+byte 1 80
+byte 1 76
+byte 1 85
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $657
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 95
+byte 1 66
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 67
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $649
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 87
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $642
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $635
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $628
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $623
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $618
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 73
+byte 1 82
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $611
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 78
+byte 1 71
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $599
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 78
+byte 1 79
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 10
+byte 1 0
+align 1
+LABELV $582
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $558
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $553
+byte 1 42
+byte 1 103
+byte 1 97
+byte 1 115
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $552
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 67
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $545
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $538
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $531
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 79
+byte 1 85
+byte 1 67
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $526
+byte 1 42
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $525
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $520
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $515
+byte 1 42
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $508
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $481
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $463
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $462
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $445
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 68
+byte 1 73
+byte 1 85
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $426
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $415
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 87
+byte 1 73
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $404
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 87
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $393
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $382
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $372
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $361
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 69
+byte 1 86
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $355
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 0
+align 1
+LABELV $349
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $348
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $343
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $342
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 55
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $339
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 53
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $336
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $291
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $290
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $276
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $275
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $270
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $269
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $268
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $266
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 0
+align 1
+LABELV $265
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $263
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $261
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $258
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $257
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $255
+byte 1 97
+byte 1 108
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $253
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $251
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $250
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $248
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $247
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $245
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $243
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $241
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $239
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $222
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $219
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $218
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $204
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $200
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $199
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $196
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $193
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $191
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $190
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $187
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $183
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $182
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $179
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $175
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $174
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $171
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $161
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $159
+byte 1 115
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $157
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 0
+align 1
+LABELV $155
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $153
+byte 1 115
+byte 1 97
+byte 1 110
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $151
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $149
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $147
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $143
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $142
+byte 1 110
+byte 1 0
+align 1
+LABELV $135
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $130
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $129
+byte 1 37
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $128
+byte 1 37
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $125
+byte 1 37
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $122
+byte 1 37
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $119
+byte 1 49
+byte 1 51
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $116
+byte 1 49
+byte 1 50
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $113
+byte 1 49
+byte 1 49
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $110
+byte 1 94
+byte 1 51
+byte 1 51
+byte 1 114
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $107
+byte 1 94
+byte 1 49
+byte 1 50
+byte 1 110
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $104
+byte 1 94
+byte 1 52
+byte 1 49
+byte 1 115
+byte 1 116
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $101
+byte 1 0
+align 1
+LABELV $100
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 0
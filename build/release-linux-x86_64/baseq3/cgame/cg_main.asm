@@ -0,0 +1,19766 @@
+data
+export forceModelModificationCount
+align 4
+LABELV forceModelModificationCount
+byte 4 -1
+export vmMain
+code
+proc vmMain 56 28
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 100
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $99
+ADDRLP4 0
+INDIRI4
+CNSTI4 101
+EQI4 $101
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $97
+LABELV $131
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 200
+LTI4 $97
+ADDRLP4 8
+INDIRI4
+CNSTI4 221
+GTI4 $97
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $132-800
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $132
+address $102
+address $103
+address $104
+address $105
+address $106
+address $107
+address $108
+address $109
+address $110
+address $111
+address $112
+address $122
+address $123
+address $124
+address $116
+address $117
+address $118
+address $125
+address $126
+address $127
+address $128
+address $129
+code
+LABELV $99
+ADDRGP4 $100
+CVPU4 4
+CVUI4 4
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $101
+CNSTI4 65536
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $102
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Init
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $103
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRGP4 CG_Ingame_Init
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $104
+ADDRGP4 UI_Shutdown
+CALLV
+pop
+ADDRGP4 CG_Shutdown
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $105
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_ConsoleCommand
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $106
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_Refresh
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $107
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $108
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $109
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_VoIPString
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CVUI4 4
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $110
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRFP4 16
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $111
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_DistributeCharEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $112
+ADDRGP4 cg+4
+INDIRI4
+CNSTI4 0
+EQI4 $113
+ADDRLP4 28
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $113
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_MouseEvent
+CALLV
+pop
+ADDRGP4 $114
+JUMPV
+LABELV $113
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_MouseEvent
+CALLV
+pop
+LABELV $114
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $116
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_MousePosition
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $117
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetMousePosition
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $118
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_SetActiveMenu
+CALLV
+pop
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $119
+ADDRGP4 cg+12
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $119
+ADDRGP4 CG_StopCinematic_f
+CALLV
+pop
+LABELV $119
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $122
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_JoystickAxisEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $123
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_JoystickButtonEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $124
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_JoystickHatEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $125
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddNotifyText
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $126
+ADDRGP4 CG_CloseConsole
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $127
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 IntAsFloat
+CALLF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 IntAsFloat
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_CreateUserCmd
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CVUI4 4
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $128
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_UpdateGlconfig
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $129
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_ConsoleCompleteArgument
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $97
+ADDRGP4 $130
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $98
+CNSTI4 -1
+RETI4
+LABELV $96
+endproc vmMain 56 28
+data
+align 4
+LABELV cgameCvarTable
+byte 4 0
+address $136
+address $137
+byte 4 64
+byte 4 0
+byte 4 0
+byte 4 0
+address con_conspeed
+address $138
+address $139
+byte 4 0
+byte 4 1036831949
+byte 4 1120403456
+byte 4 0
+address con_autochat
+address $140
+address $141
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address con_autoclear
+address $142
+address $141
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_dedicated
+address $143
+address $141
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_ignore
+address $144
+address $141
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_zoomFov
+address $145
+address $146
+byte 4 1
+byte 4 1065353216
+byte 4 1126170624
+byte 4 0
+address cg_fov
+address $147
+address $148
+byte 4 1
+byte 4 1065353216
+byte 4 1126170624
+byte 4 0
+address cg_weaponFov
+address $149
+address $148
+byte 4 1
+byte 4 0
+byte 4 1126170624
+byte 4 0
+address cg_viewsize
+address $150
+address $151
+byte 4 1
+byte 4 1106247680
+byte 4 1120403456
+byte 4 1
+address cg_shadows
+address $152
+address $153
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_gibs
+address $154
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_draw2D
+address $155
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawStatus
+address $156
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawTimer
+address $157
+address $141
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawFPS
+address $158
+address $141
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawSnapshot
+address $159
+address $141
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_draw3dIcons
+address $160
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawIcons
+address $161
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawAmmoWarning
+address $162
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawAttacker
+address $163
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawCrosshair
+address $164
+address $165
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_drawCrosshairNames
+address $166
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawRewards
+address $167
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawLagometer
+address $168
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_crosshairSize
+address $169
+address $170
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_crosshairHealth
+address $171
+address $141
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_crosshairX
+address $172
+address $141
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_crosshairY
+address $173
+address $141
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_brassTime
+address $174
+address $175
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_simpleItems
+address $176
+address $141
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_addMarks
+address $177
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_railTrailTime
+address $178
+address $179
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_gun_x
+address $180
+address $141
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_gun_y
+address $181
+address $141
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_gun_z
+address $182
+address $141
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_centertime
+address $183
+address $139
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_viewbob
+address $184
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_viewkick
+address $185
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_runpitch
+address $186
+address $187
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_runroll
+address $188
+address $189
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_bobup
+address $190
+address $189
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_bobpitch
+address $191
+address $187
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_bobroll
+address $192
+address $187
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_swingSpeed
+address $193
+address $194
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_animSpeed
+address $195
+address $153
+byte 4 512
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_debugAnim
+address $196
+address $141
+byte 4 512
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_debugPosition
+address $197
+address $141
+byte 4 512
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_debugEvents
+address $198
+address $141
+byte 4 512
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_errorDecay
+address $199
+address $151
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_nopredict
+address $200
+address $141
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_noPlayerAnims
+address $201
+address $141
+byte 4 512
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_showmiss
+address $202
+address $141
+byte 4 0
+byte 4 0
+byte 4 1073741824
+byte 4 1
+address cg_optimizePrediction
+address $203
+address $153
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_showTraceTests
+address $204
+address $141
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_showPolyBuffers
+address $205
+address $141
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_footsteps
+address $206
+address $153
+byte 4 512
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_tracerChance
+address $207
+address $208
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_tracerWidth
+address $209
+address $153
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_tracerLength
+address $210
+address $151
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_splitviewVertical
+address $211
+address $141
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_splitviewThirdEqual
+address $212
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_splitviewTextScale
+address $213
+address $214
+byte 4 1
+byte 4 1036831949
+byte 4 1084227584
+byte 4 0
+address cg_hudTextScale
+address $215
+address $153
+byte 4 1
+byte 4 1036831949
+byte 4 1084227584
+byte 4 0
+address cg_teamChatTime
+address $216
+address $217
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_teamChatHeight
+address $218
+address $141
+byte 4 1
+byte 4 0
+byte 4 1090519040
+byte 4 1
+address cg_forceModel
+address $219
+address $141
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_predictItems
+address $220
+address $153
+byte 4 114691
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_deferPlayers
+address $221
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawTeamOverlay
+address $222
+address $141
+byte 4 1
+byte 4 0
+byte 4 1077936128
+byte 4 1
+address cg_teamOverlayUserinfo
+address $223
+address $141
+byte 4 114754
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_stats
+address $224
+address $141
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_drawFriend
+address $225
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_teamChatsOnly
+address $226
+address $141
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_buildScript
+address $227
+address $141
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_paused
+address $228
+address $141
+byte 4 64
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_blood
+address $229
+address $153
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address $230
+address $141
+byte 4 38
+byte 4 0
+byte 4 1082130432
+byte 4 1
+address cg_synchronousClients
+address $231
+address $141
+byte 4 8
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_singlePlayer
+address $232
+address $141
+byte 4 72
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_timescaleFadeEnd
+address $233
+address $153
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_timescaleFadeSpeed
+address $234
+address $141
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_timescale
+address $235
+address $153
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_scorePlum
+address $236
+address $153
+byte 4 3
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_smoothClients
+address $237
+address $141
+byte 4 3
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_cameraMode
+address $238
+address $141
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address pmove_overbounce
+address $239
+address $141
+byte 4 8
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address pmove_fixed
+address $240
+address $141
+byte 4 8
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address pmove_msec
+address $241
+address $242
+byte 4 8
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_noProjectileTrail
+address $243
+address $141
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_oldRail
+address $244
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_oldRocket
+address $245
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_oldPlasma
+address $246
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_trueLightning
+address $247
+address $248
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_railWidth
+address $249
+address $250
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_railCoreWidth
+address $251
+address $252
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_railSegmentLength
+address $253
+address $254
+byte 4 1
+byte 4 1065353216
+byte 4 1148846080
+byte 4 0
+address cg_atmosphericEffects
+address $255
+address $153
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_teamDmLeadAnnouncements
+address $256
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_voipShowMeter
+address $257
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_voipShowCrosshairMeter
+address $258
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_consoleLatency
+address $259
+address $217
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_drawShaderInfo
+address $260
+address $141
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_coronafardist
+address $261
+address $262
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_coronas
+address $263
+address $153
+byte 4 1
+byte 4 0
+byte 4 1077936128
+byte 4 1
+address cg_fovAspectAdjust
+address $264
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_fadeExplosions
+address $265
+address $141
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_skybox
+address $266
+address $153
+byte 4 1
+byte 4 0
+byte 4 1073741824
+byte 4 1
+address cg_drawScores
+address $267
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawPickupItems
+address $268
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_oldBubbles
+address $269
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_smoothBodySink
+address $270
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_antiLag
+address $271
+address $141
+byte 4 114691
+byte 4 0
+byte 4 1073741824
+byte 4 1
+address cg_forceBitmapFonts
+address $272
+address $141
+byte 4 33
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawGrappleHook
+address $273
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawBBox
+address $274
+address $141
+byte 4 512
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_consoleFont
+address $275
+address $276
+byte 4 33
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_consoleFontSize
+address $277
+address $242
+byte 4 33
+byte 4 1082130432
+byte 4 1103101952
+byte 4 1
+address cg_hudFont
+address $278
+address $279
+byte 4 33
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_hudFontBorder
+address $280
+address $214
+byte 4 33
+byte 4 0
+byte 4 1092616192
+byte 4 0
+address cg_numberFont
+address $281
+address $282
+byte 4 33
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_numberFontBorder
+address $283
+address $141
+byte 4 33
+byte 4 0
+byte 4 1092616192
+byte 4 0
+address cg_defaultModelGender
+address $284
+address $285
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_defaultMaleModel
+address $286
+address $287
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_defaultMaleHeadModel
+address $288
+address $287
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_defaultFemaleModel
+address $289
+address $290
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_defaultFemaleHeadModel
+address $291
+address $290
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_defaultTeamModelGender
+address $292
+address $285
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_defaultMaleTeamModel
+address $293
+address $287
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_defaultMaleTeamHeadModel
+address $294
+address $287
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_defaultFemaleTeamModel
+address $295
+address $290
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_defaultFemaleTeamHeadModel
+address $296
+address $290
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_introPlayed
+address $297
+address $141
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_joystickDebug
+address $298
+address $141
+byte 4 256
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address ui_stretch
+address $299
+address $141
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+align 4
+LABELV userCvarTable
+address cg_color1
+address $300
+address $165
+byte 4 3
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_color2
+address $301
+address $302
+byte 4 3
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_handicap
+address $303
+address $151
+byte 4 3
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_teamtask
+address $304
+address $141
+byte 4 2
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_teampref
+address $305
+address $282
+byte 4 2
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_autoswitch
+address $306
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_cyclePastGauntlet
+address $307
+address $153
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawGun
+address $308
+address $153
+byte 4 1
+byte 4 0
+byte 4 1077936128
+byte 4 1
+address cg_thirdPerson
+address $309
+address $141
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_thirdPersonRange
+address $310
+address $311
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_thirdPersonAngle
+address $312
+address $141
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_thirdPersonHeight
+address $313
+address $170
+byte 4 0
+byte 4 0
+byte 4 1107296256
+byte 4 1
+address cg_thirdPersonSmooth
+address $314
+address $141
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+align 4
+LABELV cgameCvarTableSize
+byte 4 135
+align 4
+LABELV userCvarTableSize
+byte 4 13
+export CG_RegisterCvar
+code
+proc CG_RegisterCvar 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+NEF4 $318
+ADDRFP4 20
+INDIRF4
+ADDRLP4 0
+INDIRF4
+EQF4 $316
+LABELV $318
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_CheckRange
+CALLV
+pop
+LABELV $316
+LABELV $315
+endproc CG_RegisterCvar 4 16
+export CG_RegisterCgameCvars
+proc CG_RegisterCgameCvars 12 28
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgameCvarTable
+ASGNP4
+ADDRGP4 $323
+JUMPV
+LABELV $320
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterCvar
+CALLV
+pop
+LABELV $321
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+LABELV $323
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgameCvarTableSize
+INDIRI4
+LTI4 $320
+LABELV $319
+endproc CG_RegisterCgameCvars 12 28
+lit
+align 4
+LABELV $325
+byte 4 2
+byte 4 16384
+byte 4 32768
+byte 4 65536
+align 4
+LABELV $326
+address $287
+address $327
+address $290
+address $328
+align 4
+LABELV $329
+address $287
+address $327
+address $290
+address $328
+align 4
+LABELV $330
+address $287
+address $327
+address $290
+address $328
+align 4
+LABELV $331
+address $287
+address $327
+address $290
+address $328
+export CG_RegisterUserCvars
+code
+proc CG_RegisterUserCvars 140 28
+ADDRLP4 20
+ADDRGP4 $325
+INDIRB
+ASGNB 16
+ADDRLP4 40
+ADDRGP4 $326
+INDIRB
+ASGNB 16
+ADDRLP4 56
+ADDRGP4 $329
+INDIRB
+ASGNB 16
+ADDRLP4 72
+ADDRGP4 $330
+INDIRB
+ASGNB 16
+ADDRLP4 88
+ADDRGP4 $331
+INDIRB
+ASGNB 16
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 userCvarTable
+ASGNP4
+ADDRGP4 $335
+JUMPV
+LABELV $332
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $339
+JUMPV
+LABELV $336
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $340
+ADDRLP4 12
+CNSTI4 272
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $341
+JUMPV
+LABELV $340
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+LABELV $341
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $342
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+BORI4
+ASGNI4
+LABELV $342
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterCvar
+CALLV
+pop
+LABELV $337
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $339
+ADDRLP4 104
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+LTI4 $336
+LABELV $333
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+LABELV $335
+ADDRLP4 16
+INDIRI4
+ADDRGP4 userCvarTableSize
+INDIRI4
+LTI4 $332
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $347
+JUMPV
+LABELV $344
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $348
+ADDRLP4 36
+ADDRGP4 $350
+ASGNP4
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRGP4 $351
+ARGP4
+ADDRGP4 $350
+ARGP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 104
+INDIRP4
+ASGNP4
+LABELV $349
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 $352
+ARGP4
+ADDRLP4 104
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BORI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 $353
+ARGP4
+ADDRLP4 108
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ADDRLP4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BORI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 $354
+ARGP4
+ADDRLP4 116
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRLP4 56
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 120
+INDIRI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BORI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 $355
+ARGP4
+ADDRLP4 124
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ADDRLP4 72
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BORI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 $356
+ARGP4
+ADDRLP4 132
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ADDRLP4 88
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 136
+INDIRI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BORI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $345
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $347
+ADDRLP4 104
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 104
+INDIRI4
+LTI4 $344
+LABELV $324
+endproc CG_RegisterUserCvars 140 28
+export CG_RegisterCvars
+proc CG_RegisterCvars 1028 12
+ADDRGP4 CG_RegisterCgameCvars
+CALLV
+pop
+ADDRGP4 CG_RegisterUserCvars
+CALLV
+pop
+ADDRGP4 CG_RegisterInputCvars
+CALLV
+pop
+ADDRGP4 $358
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+56060
+ADDRLP4 1024
+INDIRI4
+ASGNI4
+ADDRGP4 forceModelModificationCount
+ADDRGP4 cg_forceModel+4
+INDIRI4
+ASGNI4
+LABELV $357
+endproc CG_RegisterCvars 1028 12
+proc CG_ForceModelChange 12 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $362
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $366
+ADDRGP4 $363
+JUMPV
+LABELV $366
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewPlayerInfo
+CALLV
+pop
+LABELV $363
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $362
+LABELV $361
+endproc CG_ForceModelChange 12 4
+export CG_UpdateCgameCvars
+proc CG_UpdateCgameCvars 8 4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgameCvarTable
+ASGNP4
+ADDRGP4 $372
+JUMPV
+LABELV $369
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $373
+ADDRGP4 $370
+JUMPV
+LABELV $373
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $370
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+LABELV $372
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgameCvarTableSize
+INDIRI4
+LTI4 $369
+LABELV $368
+endproc CG_UpdateCgameCvars 8 4
+export CG_UpdateUserCvars
+proc CG_UpdateUserCvars 16 4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 userCvarTable
+ASGNP4
+ADDRGP4 $379
+JUMPV
+LABELV $376
+ADDRLP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $380
+ADDRGP4 $377
+JUMPV
+LABELV $380
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $385
+JUMPV
+LABELV $382
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $383
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $385
+ADDRLP4 12
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $382
+LABELV $377
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+LABELV $379
+ADDRLP4 8
+INDIRI4
+ADDRGP4 userCvarTableSize
+INDIRI4
+LTI4 $376
+LABELV $375
+endproc CG_UpdateUserCvars 16 4
+export CG_UpdateCvars
+proc CG_UpdateCvars 0 8
+ADDRGP4 CG_UpdateCgameCvars
+CALLV
+pop
+ADDRGP4 CG_UpdateUserCvars
+CALLV
+pop
+ADDRGP4 CG_UpdateInputCvars
+CALLV
+pop
+ADDRGP4 cg+4
+INDIRI4
+CNSTI4 0
+NEI4 $387
+ADDRGP4 $386
+JUMPV
+LABELV $387
+ADDRGP4 drawTeamOverlayModificationCount
+INDIRI4
+ADDRGP4 cg_drawTeamOverlay+4
+INDIRI4
+EQI4 $390
+ADDRGP4 drawTeamOverlayModificationCount
+ADDRGP4 cg_drawTeamOverlay+4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 0
+LEI4 $394
+ADDRGP4 $223
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $395
+JUMPV
+LABELV $394
+ADDRGP4 $223
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $395
+LABELV $390
+ADDRGP4 forceModelModificationCount
+INDIRI4
+ADDRGP4 cg_forceModel+4
+INDIRI4
+EQI4 $397
+ADDRGP4 forceModelModificationCount
+ADDRGP4 cg_forceModel+4
+INDIRI4
+ASGNI4
+ADDRGP4 CG_ForceModelChange
+CALLV
+pop
+LABELV $397
+LABELV $386
+endproc CG_UpdateCvars 0 8
+export CG_CrosshairPlayer
+proc CG_CrosshairPlayer 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $406
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $406
+ADDRLP4 4
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $402
+LABELV $406
+CNSTI4 -1
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $402
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+35628
+ADDP4
+INDIRI4
+CNSTI4 1000
+ADDI4
+LEI4 $407
+CNSTI4 -1
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $407
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+35624
+ADDP4
+INDIRI4
+RETI4
+LABELV $401
+endproc CG_CrosshairPlayer 8 0
+export CG_LastAttacker
+proc CG_LastAttacker 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $419
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $419
+ADDRLP4 4
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $415
+LABELV $419
+CNSTI4 -1
+RETI4
+ADDRGP4 $414
+JUMPV
+LABELV $415
+ADDRLP4 8
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+522872+35640
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $425
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+522872
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $420
+LABELV $425
+CNSTI4 -1
+RETI4
+ADDRGP4 $414
+JUMPV
+LABELV $420
+CNSTI4 500
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRI4
+RETI4
+LABELV $414
+endproc CG_LastAttacker 12 0
+export CG_RemoveNotifyLine
+proc CG_RemoveNotifyLine 52 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $430
+ADDRFP4 0
+INDIRP4
+CNSTI4 37100
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $428
+LABELV $430
+ADDRGP4 $427
+JUMPV
+LABELV $428
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 37072
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36044
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 20
+INDIRU4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $434
+JUMPV
+LABELV $431
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 36044
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $432
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $434
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $431
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $435
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 37068
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRI4
+CNSTI4 8
+SUBI4
+ADDRLP4 36
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 8
+LABELV $436
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $438
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 37100
+ADDP4
+INDIRI4
+LTI4 $435
+ADDRFP4 0
+INDIRP4
+CNSTI4 37100
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 8
+SUBI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 37068
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 37100
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 8
+SUBI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 37068
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 37100
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $427
+endproc CG_RemoveNotifyLine 52 4
+export CG_AddNotifyText
+proc CG_AddNotifyText 1104 12
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LiteralArgs
+CALLV
+pop
+ADDRLP4 20
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $440
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $445
+JUMPV
+LABELV $442
+CNSTI4 39072
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+36044
+ADDP4
+CNSTI1 0
+ASGNI1
+CNSTI4 39072
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+37100
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $443
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $445
+ADDRLP4 1048
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+LTI4 $442
+ADDRGP4 $439
+JUMPV
+LABELV $440
+ADDRLP4 12
+ADDRLP4 20
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $452
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRLP4 1048
+ADDRGP4 Q_strncmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $450
+ADDRLP4 1044
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+LABELV $450
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_ConsolePrint
+CALLV
+pop
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+NEI4 $456
+ADDRFP4 4
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+NEI4 $456
+ADDRLP4 1056
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $453
+LABELV $456
+ADDRGP4 $439
+JUMPV
+LABELV $453
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $459
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 1060
+ADDRGP4 Q_strncmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $457
+ADDRLP4 1068
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 49
+LTI4 $457
+ADDRLP4 1068
+INDIRI4
+CNSTI4 53
+GEI4 $457
+ADDRLP4 12
+INDIRP4
+CNSTI4 9
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 93
+NEI4 $457
+ADDRLP4 16
+CNSTI4 1
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 49
+SUBI4
+LSHI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 10
+ADDP4
+ASGNP4
+ADDRGP4 $458
+JUMPV
+LABELV $457
+ADDRLP4 16
+CNSTI4 -1
+ASGNI4
+LABELV $458
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 1072
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $463
+JUMPV
+LABELV $460
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDRLP4 8
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $464
+ADDRGP4 $461
+JUMPV
+LABELV $464
+ADDRLP4 0
+CNSTI4 39072
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 13
+NEI4 $480
+ADDRLP4 1084
+CNSTI4 0
+ASGNI4
+ADDRLP4 1080
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1076
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRGP4 $472
+JUMPV
+LABELV $469
+ADDRLP4 1080
+ADDRLP4 1080
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37068
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $470
+ADDRLP4 1076
+ADDRLP4 1076
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $472
+ADDRLP4 1076
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37100
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+LTI4 $469
+ADDRLP4 1080
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36044
+ADDP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI4 37100
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $476
+ADDRLP4 1088
+ADDRLP4 0
+INDIRP4
+CNSTI4 37100
+ADDP4
+ASGNP4
+ADDRLP4 1088
+INDIRP4
+ADDRLP4 1088
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $476
+JUMPV
+LABELV $475
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_RemoveNotifyLine
+CALLV
+pop
+LABELV $476
+ADDRLP4 0
+INDIRP4
+CNSTI4 36044
+ADDP4
+ARGP4
+ADDRLP4 1088
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1088
+INDIRU4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ADDU4
+CNSTU4 1024
+GTU4 $475
+ADDRLP4 0
+INDIRP4
+CNSTI4 36044
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 37100
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37068
+ADDP4
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37100
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37068
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 1100
+ADDRLP4 0
+INDIRP4
+CNSTI4 37100
+ADDP4
+ASGNP4
+ADDRLP4 1100
+INDIRP4
+ADDRLP4 1100
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $461
+JUMPV
+LABELV $479
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_RemoveNotifyLine
+CALLV
+pop
+LABELV $480
+ADDRLP4 0
+INDIRP4
+CNSTI4 36044
+ADDP4
+ARGP4
+ADDRLP4 1076
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1076
+INDIRU4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ADDU4
+CNSTU4 1024
+GTU4 $479
+ADDRLP4 0
+INDIRP4
+CNSTI4 37100
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $482
+ADDRLP4 0
+INDIRP4
+CNSTI4 36044
+ADDP4
+ARGP4
+ADDRLP4 1084
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1084
+INDIRU4
+CNSTU4 1
+SUBU4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36044
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+EQI4 $482
+ADDRLP4 0
+INDIRP4
+CNSTI4 36044
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 37100
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 8
+SUBI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37068
+ADDP4
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 1096
+ADDRLP4 0
+INDIRP4
+CNSTI4 37100
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 8
+SUBI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37068
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 1096
+INDIRP4
+ADDRLP4 1096
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $461
+JUMPV
+LABELV $482
+ADDRLP4 0
+INDIRP4
+CNSTI4 37100
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $485
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_RemoveNotifyLine
+CALLV
+pop
+LABELV $485
+ADDRLP4 0
+INDIRP4
+CNSTI4 37100
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $487
+ADDRGP4 $461
+JUMPV
+LABELV $487
+ADDRLP4 0
+INDIRP4
+CNSTI4 36044
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 37100
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37068
+ADDP4
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37100
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37068
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 1096
+ADDRLP4 0
+INDIRP4
+CNSTI4 37100
+ADDP4
+ASGNP4
+ADDRLP4 1096
+INDIRP4
+ADDRLP4 1096
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $461
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $463
+ADDRLP4 1076
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+LTI4 $460
+LABELV $439
+endproc CG_AddNotifyText 1104 12
+export CG_NotifyPrintf
+proc CG_NotifyPrintf 1044 16
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $491
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1032
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1024
+ADDRLP4 1032
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 1028
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 0
+ADDP4
+ARGP4
+CNSTU4 1024
+ADDRLP4 1024
+INDIRI4
+CVIU4 4
+SUBU4
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 1028
+CNSTP4 0
+ASGNP4
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 0
+ADDP4
+ARGP4
+ADDRGP4 $452
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRLP4 1040
+ADDRGP4 Q_strncmp
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $493
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $452
+ARGP4
+CNSTU4 12
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $493
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $490
+endproc CG_NotifyPrintf 1044 16
+export CG_NotifyBitsPrintf
+proc CG_NotifyBitsPrintf 1036 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 1028
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $501
+JUMPV
+LABELV $498
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $502
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $504
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_NotifyPrintf
+CALLV
+pop
+LABELV $502
+LABELV $499
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $501
+ADDRLP4 1032
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+LTI4 $498
+LABELV $496
+endproc CG_NotifyBitsPrintf 1036 16
+export CG_DPrintf
+proc CG_DPrintf 2056 16
+ADDRGP4 $506
+ARGP4
+ADDRLP4 1028
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 1028
+ARGP4
+ADDRLP4 2052
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 0
+NEI4 $507
+ADDRGP4 $505
+JUMPV
+LABELV $507
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $505
+endproc CG_DPrintf 2056 16
+export CG_Printf
+proc CG_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $510
+endproc CG_Printf 1028 16
+export CG_Error
+proc CG_Error 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $512
+endproc CG_Error 1028 16
+export Com_Error
+proc Com_Error 1028 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $514
+endproc Com_Error 1028 16
+export Com_Printf
+proc Com_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $516
+endproc Com_Printf 1028 16
+export Com_DPrintf
+proc Com_DPrintf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $504
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_DPrintf
+CALLV
+pop
+LABELV $518
+endproc Com_DPrintf 1028 16
+bss
+align 1
+LABELV $521
+skip 1024
+export CG_Argv
+code
+proc CG_Argv 0 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $521
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRGP4 $521
+RETP4
+LABELV $520
+endproc CG_Argv 0 12
+bss
+align 1
+LABELV $523
+skip 1024
+export CG_Cvar_VariableString
+code
+proc CG_Cvar_VariableString 0 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $523
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $523
+RETP4
+LABELV $522
+endproc CG_Cvar_VariableString 0 12
+export CG_MaxSplitView
+proc CG_MaxSplitView 0 0
+ADDRGP4 cgs+56044
+INDIRI4
+RETI4
+LABELV $524
+endproc CG_MaxSplitView 0 0
+export CG_SetupDlightstyles
+proc CG_SetupDlightstyles 84 12
+ADDRGP4 cg+516656
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+LABELV $528
+ADDRLP4 20
+INDIRI4
+CNSTI4 736
+ADDI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 28
+INDIRU4
+CNSTU4 0
+NEU4 $532
+ADDRGP4 $530
+JUMPV
+LABELV $532
+ADDRLP4 12
+ARGP4
+ADDRLP4 32
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $536
+ADDRLP4 16
+INDIRI4
+CNSTI4 4096
+LTI4 $534
+LABELV $536
+ADDRGP4 $529
+JUMPV
+LABELV $534
+ADDRLP4 0
+CNSTI4 852
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 44
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 764
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 764
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $537
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+ADDRLP4 64
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $537
+ADDRLP4 12
+ARGP4
+ADDRLP4 60
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 844
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 68
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 848
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $542
+JUMPV
+LABELV $539
+ADDRLP4 80
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 0
+INDIRP4
+CNSTI4 848
+ADDP4
+INDIRI4
+ADDI4
+CVII1 4
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 97
+GEI4 $543
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ADDP4
+CNSTI1 97
+ASGNI1
+LABELV $543
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 122
+LEI4 $545
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ADDP4
+CNSTI1 122
+ASGNI1
+LABELV $545
+LABELV $540
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $542
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ADDRLP4 76
+INDIRU4
+LTU4 $539
+ADDRLP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $529
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 128
+LTI4 $528
+LABELV $530
+LABELV $526
+endproc CG_SetupDlightstyles 84 12
+proc CG_RegisterItemSounds 96 12
+ADDRLP4 76
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $549
+ADDRLP4 76
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+124988
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+LABELV $549
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $555
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $557
+LABELV $555
+ADDRGP4 $548
+JUMPV
+LABELV $556
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $560
+JUMPV
+LABELV $559
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $560
+ADDRLP4 84
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $562
+ADDRLP4 84
+INDIRI4
+CNSTI4 32
+NEI4 $559
+LABELV $562
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 72
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $565
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+GEI4 $563
+LABELV $565
+ADDRGP4 $566
+ARGP4
+ADDRLP4 76
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $548
+JUMPV
+LABELV $563
+ADDRLP4 8
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $567
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $567
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8-3
+ADDP4
+ARGP4
+ADDRGP4 $572
+ARGP4
+ADDRLP4 92
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $569
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+LABELV $569
+LABELV $557
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $556
+LABELV $548
+endproc CG_RegisterItemSounds 96 12
+proc CG_RegisterSounds 544 16
+ADDRGP4 $576
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 332
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126224
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 $579
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 336
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126228
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRGP4 $582
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 340
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126232
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRGP4 $585
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 344
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126244
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRGP4 $588
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 348
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126240
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 $591
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 352
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126236
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRGP4 $594
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 356
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126416
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $597
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 360
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126420
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRGP4 $600
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 364
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126424
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRGP4 $603
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 368
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126428
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRGP4 $606
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126432
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+GEI4 $611
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $607
+LABELV $611
+ADDRGP4 $614
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 376
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126356
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 $617
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 380
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126360
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $620
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 384
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126364
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $623
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126260
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $626
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126348
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $629
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126352
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $632
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 400
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126368
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $635
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 404
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126372
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $638
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 408
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126376
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $641
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 412
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126380
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $644
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 416
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126384
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $647
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 420
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126388
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+EQI4 $652
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $648
+LABELV $652
+ADDRGP4 $655
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 424
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126392
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $658
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126396
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $661
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126400
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $664
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 436
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126404
+ADDRLP4 436
+INDIRI4
+ASGNI4
+LABELV $648
+ADDRGP4 $667
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 424
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126408
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $670
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126412
+ADDRLP4 428
+INDIRI4
+ASGNI4
+LABELV $607
+ADDRGP4 $673
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 376
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126016
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 $676
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 380
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126020
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $679
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 384
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126028
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $682
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126024
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $685
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126176
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $688
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126180
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $691
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 400
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126184
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $694
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 404
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126188
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $697
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 408
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126192
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $700
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 412
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126196
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $703
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 416
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126204
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $706
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 420
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126200
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $709
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 424
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126208
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $712
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126212
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $715
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126248
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $718
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 436
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126264
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $721
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 440
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126268
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $724
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 444
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126272
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRGP4 $727
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 448
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126276
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRGP4 $730
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 452
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126280
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $733
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 456
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126284
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $736
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 460
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126300
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $739
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 464
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126304
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $742
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 468
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126308
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $745
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 472
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126324
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $748
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126328
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $751
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 480
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126332
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $754
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 484
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126220
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $755
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $759
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 488
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+126032
+ADDP4
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $762
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 492
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+126032+16
+ADDP4
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $766
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 496
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+126032+32
+ADDP4
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $770
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 500
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+126032+48
+ADDP4
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $774
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 504
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+126032+64
+ADDP4
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $778
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 508
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+126032+96
+ADDP4
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $782
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 512
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+126032+80
+ADDP4
+ADDRLP4 512
+INDIRI4
+ASGNI4
+LABELV $756
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $755
+CNSTI4 27
+ARGI4
+ADDRLP4 488
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 488
+INDIRP4
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $789
+JUMPV
+LABELV $786
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemSounds
+CALLV
+pop
+LABELV $787
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $789
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $786
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $790
+ADDRLP4 0
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 492
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 492
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $794
+ADDRGP4 $792
+JUMPV
+LABELV $794
+ADDRLP4 68
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $796
+ADDRGP4 $791
+JUMPV
+LABELV $796
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 496
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+60356
+ADDP4
+ADDRLP4 496
+INDIRI4
+ASGNI4
+LABELV $791
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $790
+LABELV $792
+ADDRGP4 $801
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 492
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126336
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRGP4 $804
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 496
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126340
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRGP4 $807
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 500
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126012
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 $810
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 504
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126156
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRGP4 $813
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 508
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126160
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRGP4 $816
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 512
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126164
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRGP4 $819
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 516
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126168
+ADDRLP4 516
+INDIRI4
+ASGNI4
+ADDRGP4 $822
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 520
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126172
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRGP4 $825
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 524
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126436
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRGP4 $828
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 528
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126440
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRGP4 $831
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 532
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126444
+ADDRLP4 532
+INDIRI4
+ASGNI4
+ADDRGP4 $834
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 536
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126448
+ADDRLP4 536
+INDIRI4
+ASGNI4
+ADDRGP4 $837
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 540
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+126452
+ADDRLP4 540
+INDIRI4
+ASGNI4
+LABELV $573
+endproc CG_RegisterSounds 544 16
+proc CG_RegisterGraphics 588 24
+ADDRGP4 cg+512444
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 448
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRGP4 cgs+56120
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 cgs+56120
+ARGP4
+ADDRGP4 trap_R_LoadWorldMap
+CALLV
+pop
+ADDRGP4 $843
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_ParseEntitiesFromString
+CALLV
+pop
+ADDRGP4 $844
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 $847
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124820
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $851
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124820+4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRGP4 $855
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124820+8
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRGP4 $859
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124820+12
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRGP4 $863
+ARGP4
+ADDRLP4 280
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124820+16
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRGP4 $866
+ARGP4
+ADDRLP4 284
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124736
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRGP4 $869
+ARGP4
+ADDRLP4 288
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124648
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRGP4 $872
+ARGP4
+ADDRLP4 292
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124948
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRGP4 $875
+ARGP4
+ADDRLP4 296
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124952
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRGP4 $878
+ARGP4
+ADDRLP4 300
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124956
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRGP4 $881
+ARGP4
+ADDRLP4 304
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124960
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRGP4 $884
+ARGP4
+ADDRLP4 308
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124796
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRGP4 $887
+ARGP4
+ADDRLP4 312
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124800
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRGP4 $890
+ARGP4
+ADDRLP4 316
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124804
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRGP4 $893
+ARGP4
+ADDRLP4 320
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124812
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRGP4 $896
+ARGP4
+ADDRLP4 324
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124784
+ADDRLP4 324
+INDIRI4
+ASGNI4
+ADDRGP4 $899
+ARGP4
+ADDRLP4 328
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124724
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRGP4 $902
+ARGP4
+ADDRLP4 332
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124808
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 $905
+ARGP4
+ADDRLP4 336
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124740
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRGP4 $908
+ARGP4
+ADDRLP4 340
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124732
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $909
+ADDRGP4 $915
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+ADDI4
+ARGI4
+ADDRLP4 348
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 348
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+679680+124744
+ADDP4
+ADDRLP4 352
+INDIRI4
+ASGNI4
+LABELV $910
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $909
+ADDRGP4 $918
+ARGP4
+ADDRLP4 344
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124788
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRGP4 $921
+ARGP4
+ADDRLP4 348
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124792
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 $924
+ARGP4
+ADDRLP4 352
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124864
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRGP4 $927
+ARGP4
+ADDRLP4 356
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124872
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $930
+ARGP4
+ADDRLP4 360
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124884
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRGP4 $933
+ARGP4
+ADDRLP4 364
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124888
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRGP4 $936
+ARGP4
+ADDRLP4 368
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124876
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRGP4 $939
+ARGP4
+ADDRLP4 372
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124880
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRGP4 $942
+ARGP4
+ADDRLP4 376
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124892
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+EQI4 $947
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $943
+LABELV $947
+ADDRGP4 $950
+ARGP4
+ADDRLP4 380
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+123352
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $953
+ARGP4
+ADDRLP4 384
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+123356
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $956
+ARGP4
+ADDRLP4 388
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+123364
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $960
+ARGP4
+ADDRLP4 392
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+123364+4
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $964
+ARGP4
+ADDRLP4 396
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+123364+8
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $967
+ARGP4
+ADDRLP4 400
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+123376
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $971
+ARGP4
+ADDRLP4 404
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+123376+4
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $975
+ARGP4
+ADDRLP4 408
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+123376+8
+ADDRLP4 408
+INDIRI4
+ASGNI4
+LABELV $943
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+GEI4 $980
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $976
+LABELV $980
+ADDRGP4 $983
+ARGP4
+ADDRLP4 380
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124716
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $986
+ARGP4
+ADDRLP4 384
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124868
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $989
+ARGP4
+ADDRLP4 388
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124644
+ADDRLP4 388
+INDIRI4
+ASGNI4
+LABELV $976
+ADDRGP4 $992
+ARGP4
+ADDRLP4 380
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124636
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $995
+ARGP4
+ADDRLP4 384
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124640
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $998
+ARGP4
+ADDRLP4 388
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124696
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $1001
+ARGP4
+ADDRLP4 392
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124700
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $1004
+ARGP4
+ADDRLP4 396
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124652
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $1007
+ARGP4
+ADDRLP4 400
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124656
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $1010
+ARGP4
+ADDRLP4 404
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124660
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $1013
+ARGP4
+ADDRLP4 408
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124664
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $1016
+ARGP4
+ADDRLP4 412
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124668
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $1019
+ARGP4
+ADDRLP4 416
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124672
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $1022
+ARGP4
+ADDRLP4 420
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124676
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $1025
+ARGP4
+ADDRLP4 424
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124680
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $1028
+ARGP4
+ADDRLP4 428
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124684
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $1031
+ARGP4
+ADDRLP4 432
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124688
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $1001
+ARGP4
+ADDRLP4 436
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124692
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $1036
+ARGP4
+ADDRLP4 440
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124720
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $1039
+ARGP4
+ADDRLP4 444
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124728
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRGP4 $1042
+ARGP4
+ADDRLP4 448
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124936
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRGP4 $1045
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124896
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $1048
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124900
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $1051
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124904
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1054
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124940
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $1057
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124944
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $1060
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124964
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $1063
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124968
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $1066
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124972
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $1069
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124976
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRGP4 $1072
+ARGP4
+ADDRLP4 488
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124980
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRGP4 $1075
+ARGP4
+ADDRLP4 492
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124984
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRGP4 cg_items
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 6144
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_weapons
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2048
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 27
+ARGI4
+ADDRLP4 496
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 496
+INDIRP4
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1079
+JUMPV
+LABELV $1076
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 49
+EQI4 $1083
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1080
+LABELV $1083
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingItem
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+LABELV $1080
+LABELV $1077
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1079
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $1076
+ADDRGP4 $1086
+ARGP4
+ADDRLP4 500
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124848
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 $1089
+ARGP4
+ADDRLP4 504
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124852
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRGP4 $1092
+ARGP4
+ADDRLP4 508
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124856
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRGP4 $1095
+ARGP4
+ADDRLP4 512
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124860
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRGP4 $1098
+ARGP4
+ADDRLP4 516
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124816
+ADDRLP4 516
+INDIRI4
+ASGNI4
+ADDRGP4 $1101
+ARGP4
+ADDRLP4 520
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124840
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRGP4 $1104
+ARGP4
+ADDRLP4 524
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+124844
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRLP4 528
+ADDRGP4 trap_CM_NumInlineModels
+CALLI4
+ASGNI4
+ADDRGP4 cgs+61380
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+61380
+INDIRI4
+CNSTI4 1024
+LEI4 $1106
+ADDRGP4 $1109
+ARGP4
+ADDRLP4 532
+CNSTI4 1024
+ASGNI4
+ADDRLP4 532
+INDIRI4
+ARGI4
+ADDRGP4 cgs+61380
+INDIRI4
+ADDRLP4 532
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1106
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1114
+JUMPV
+LABELV $1111
+ADDRLP4 560
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRGP4 $1116
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 560
+ARGP4
+ADDRLP4 572
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+61384
+ADDP4
+ADDRLP4 572
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+61384
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 536
+ARGP4
+ADDRLP4 548
+ARGP4
+ADDRLP4 576
+CNSTI4 0
+ASGNI4
+ADDRLP4 576
+INDIRI4
+ARGI4
+ADDRLP4 576
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_R_ModelBounds
+CALLI4
+pop
+ADDRLP4 532
+CNSTI4 0
+ASGNI4
+LABELV $1119
+ADDRLP4 580
+ADDRLP4 532
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 584
+ADDRLP4 580
+INDIRI4
+ADDRLP4 536
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 580
+INDIRI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+65480
+ADDP4
+ADDP4
+ADDRLP4 584
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 580
+INDIRI4
+ADDRLP4 548
+ADDP4
+INDIRF4
+ADDRLP4 584
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1120
+ADDRLP4 532
+ADDRLP4 532
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 532
+INDIRI4
+CNSTI4 3
+LTI4 $1119
+LABELV $1112
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1114
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+61380
+INDIRI4
+LTI4 $1111
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1124
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ARGI4
+ADDRLP4 536
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 532
+ADDRLP4 536
+INDIRP4
+ASGNP4
+ADDRLP4 532
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1128
+ADDRGP4 $1126
+JUMPV
+LABELV $1128
+ADDRLP4 532
+INDIRP4
+ARGP4
+ADDRLP4 540
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+59332
+ADDP4
+ADDRLP4 540
+INDIRI4
+ASGNI4
+LABELV $1125
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $1124
+LABELV $1126
+ADDRGP4 CG_ClearParticles
+CALLV
+pop
+LABELV $838
+endproc CG_RegisterGraphics 588 24
+export CG_LocalPlayerAdded
+proc CG_LocalPlayerAdded 4 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1134
+ADDRFP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $1132
+LABELV $1134
+ADDRGP4 $1131
+JUMPV
+LABELV $1132
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 CG_LoadDeferredPlayers
+CALLV
+pop
+LABELV $1131
+endproc CG_LocalPlayerAdded 4 0
+export CG_LocalPlayerRemoved
+proc CG_LocalPlayerRemoved 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1137
+ADDRGP4 $1136
+JUMPV
+LABELV $1137
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 39072
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1136
+endproc CG_LocalPlayerRemoved 0 12
+proc CG_RegisterPlayers 28 4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1147
+JUMPV
+LABELV $1144
+CNSTI4 39072
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1148
+ADDRGP4 $1145
+JUMPV
+LABELV $1148
+CNSTI4 39072
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingPlayer
+CALLV
+pop
+CNSTI4 39072
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewPlayerInfo
+CALLV
+pop
+LABELV $1145
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1147
+ADDRLP4 8
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $1144
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1153
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1160
+JUMPV
+LABELV $1157
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1161
+ADDRGP4 $1159
+JUMPV
+LABELV $1161
+LABELV $1158
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1160
+ADDRLP4 16
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $1157
+LABELV $1159
+ADDRLP4 20
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $1164
+ADDRGP4 $1154
+JUMPV
+LABELV $1164
+ADDRLP4 4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1166
+ADDRGP4 $1154
+JUMPV
+LABELV $1166
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingPlayer
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewPlayerInfo
+CALLV
+pop
+LABELV $1154
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $1153
+LABELV $1143
+endproc CG_RegisterPlayers 28 4
+export CG_ConfigString
+proc CG_ConfigString 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1171
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $1169
+LABELV $1171
+ADDRGP4 $1172
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1169
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs
+ADDP4
+INDIRI4
+ADDRGP4 cgs+4096
+ADDP4
+RETP4
+LABELV $1168
+endproc CG_ConfigString 4 8
+export CG_StartMusic
+proc CG_StartMusic 148 16
+CNSTI4 2
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 136
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 144
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRGP4 trap_S_StartBackgroundTrack
+CALLV
+pop
+LABELV $1174
+endproc CG_StartMusic 148 16
+export CG_ClearState
+proc CG_ClearState 8 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1176
+ADDRGP4 cgs
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 806152
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTF4 1065353216
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 cgs+56044
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $1176
+ADDRGP4 cg
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 679160
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_entities
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 3489792
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_weapons
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2048
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_items
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 6144
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1182
+JUMPV
+LABELV $1179
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1180
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1182
+ADDRLP4 4
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $1179
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_UpdateGlconfig
+CALLV
+pop
+LABELV $1175
+endproc CG_ClearState 8 12
+export CG_SetConnectionState
+proc CG_SetConnectionState 16 4
+ADDRGP4 cg
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $1185
+ADDRGP4 $1184
+JUMPV
+LABELV $1185
+ADDRGP4 cg
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+LEI4 $1189
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+EQI4 $1189
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1190
+JUMPV
+LABELV $1189
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1190
+ADDRGP4 cg+4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1194
+JUMPV
+LABELV $1191
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_UpdateMouseState
+CALLV
+pop
+LABELV $1192
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1194
+ADDRLP4 12
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $1191
+LABELV $1184
+endproc CG_SetConnectionState 16 4
+export CG_Init
+proc CG_Init 16 12
+ADDRGP4 Swap_Init
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearState
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetConnectionState
+CALLV
+pop
+ADDRGP4 CG_RegisterCvars
+CALLV
+pop
+ADDRGP4 CG_InitConsoleCommands
+CALLV
+pop
+ADDRGP4 $1198
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+123336
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $1201
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+123340
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1204
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderEx
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+123344
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $1198
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderEx
+CALLI4
+ASGNI4
+ADDRGP4 cgs+679680+123348
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 CG_ConsoleInit
+CALLV
+pop
+ADDRGP4 cg_dedicated+12
+INDIRI4
+CNSTI4 0
+EQI4 $1207
+CNSTI4 1
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+ADDRGP4 $1195
+JUMPV
+LABELV $1207
+ADDRGP4 cg+4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_Init
+CALLV
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $1211
+CNSTI4 0
+ARGI4
+ADDRGP4 $1213
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 cg_introPlayed+12
+INDIRI4
+CNSTI4 0
+NEI4 $1214
+ADDRGP4 $297
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1217
+ARGP4
+ADDRGP4 $1218
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1214
+LABELV $1211
+LABELV $1195
+endproc CG_Init 16 12
+export CG_Ingame_Init
+proc CG_Ingame_Init 60 32
+CNSTF4 1065353216
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 cgs+56044
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg+515604
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4+4
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4+12
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1228
+JUMPV
+LABELV $1225
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $305
+ARGP4
+ADDRLP4 28
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $282
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LTI4 $1231
+ADDRLP4 32
+INDIRI4
+CNSTI4 64
+LTI4 $1229
+LABELV $1231
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $1226
+JUMPV
+LABELV $1229
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+34572
+ADDP4
+ARGP4
+ADDRGP4 trap_GetViewAngles
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_LocalPlayerAdded
+CALLV
+pop
+LABELV $1226
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1228
+ADDRLP4 28
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $1225
+ADDRGP4 cgs+56052
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+56048
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1240
+JUMPV
+LABELV $1237
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+34568
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $1238
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1240
+ADDRLP4 32
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $1237
+ADDRLP4 36
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cgs+59320
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+59316
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+59324
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cgs
+ARGP4
+ADDRGP4 trap_GetGameState
+CALLV
+pop
+CNSTI4 20
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $1248
+ARGP4
+ADDRLP4 44
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $1246
+ADDRGP4 $1249
+ARGP4
+ADDRGP4 $1248
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1246
+ADDRGP4 CG_HudTextInit
+CALLV
+pop
+CNSTI4 21
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+59304
+ADDRLP4 52
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetMapTitle
+CALLV
+pop
+CNSTI4 248
+ARGI4
+CNSTI4 244
+ARGI4
+ADDRGP4 bg_entityStateFields
+ARGP4
+ADDRGP4 bg_numEntityStateFields
+INDIRI4
+ARGI4
+CNSTI4 500
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 bg_playerStateFields
+ARGP4
+ADDRGP4 bg_numPlayerStateFields
+INDIRI4
+ARGI4
+ADDRGP4 trap_SetNetFields
+CALLV
+pop
+ADDRGP4 CG_ParseServerinfo
+CALLV
+pop
+ADDRGP4 $1251
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 cgs+56120
+ARGP4
+ADDRGP4 trap_CM_LoadMap
+CALLV
+pop
+ADDRGP4 cg+32
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1254
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_RegisterSounds
+CALLV
+pop
+ADDRGP4 $1255
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_RegisterGraphics
+CALLV
+pop
+ADDRGP4 $1256
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_RegisterPlayers
+CALLV
+pop
+ADDRGP4 cg+32
+CNSTI4 0
+ASGNI4
+ADDRGP4 CG_InitLocalEntities
+CALLV
+pop
+ADDRGP4 CG_InitMarkPolys
+CALLV
+pop
+ADDRGP4 cg+515632
+CNSTI1 0
+ASGNI1
+ADDRGP4 CG_SetConfigValues
+CALLV
+pop
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+ADDRGP4 cg+516656
+CNSTI4 0
+ASGNI4
+ADDRGP4 $282
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_ShaderStateChanged
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+ADDRGP4 CG_RestoreSnapshot
+CALLV
+pop
+LABELV $1219
+endproc CG_Ingame_Init 60 32
+export CG_KillServer
+proc CG_KillServer 0 8
+ADDRGP4 cgs+56060
+INDIRI4
+CNSTI4 0
+NEI4 $1261
+ADDRGP4 $1260
+JUMPV
+LABELV $1261
+ADDRGP4 $1264
+ARGP4
+ADDRGP4 trap_SV_Shutdown
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+56044
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearState
+CALLV
+pop
+ADDRGP4 cgs+56060
+CNSTI4 0
+ASGNI4
+LABELV $1260
+endproc CG_KillServer 0 8
+export CG_Shutdown
+proc CG_Shutdown 8 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1271
+JUMPV
+LABELV $1268
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+34572
+ADDP4
+ARGP4
+ADDRGP4 trap_SetViewAngles
+CALLV
+pop
+LABELV $1269
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1271
+ADDRLP4 4
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $1268
+LABELV $1267
+endproc CG_Shutdown 8 8
+export CG_Refresh
+proc CG_Refresh 36 20
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetConnectionState
+CALLV
+pop
+ADDRGP4 cg+512312
+ADDRFP4 16
+INDIRI4
+ADDRGP4 cg+512308
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cg+512308
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1281
+JUMPV
+LABELV $1278
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_UpdateMouseState
+CALLV
+pop
+LABELV $1279
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1281
+ADDRLP4 4
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $1278
+ADDRGP4 CG_UpdateCvars
+CALLV
+pop
+ADDRFP4 12
+INDIRI4
+CNSTI4 8
+NEI4 $1282
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $1282
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1142947840
+ASGNF4
+ADDRLP4 20
+CNSTF4 1139802112
+ASGNF4
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRGP4 cg+16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 trap_CIN_SetExtents
+CALLV
+pop
+ADDRGP4 CG_ClearViewport
+CALLV
+pop
+ADDRGP4 cg+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_DrawCinematic
+CALLV
+pop
+ADDRGP4 cg+16
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+NEI4 $1287
+ADDRGP4 CG_StopCinematic_f
+CALLV
+pop
+LABELV $1287
+LABELV $1282
+ADDRGP4 cg_dedicated+12
+INDIRI4
+CNSTI4 0
+NEI4 $1290
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $1290
+ADDRLP4 8
+ADDRGP4 UI_IsFullscreen
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1290
+ADDRGP4 trap_S_StopAllSounds
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_SetActiveMenu
+CALLV
+pop
+LABELV $1290
+ADDRFP4 12
+INDIRI4
+CNSTI4 5
+LTI4 $1293
+ADDRFP4 12
+INDIRI4
+CNSTI4 8
+EQI4 $1293
+ADDRLP4 16
+ADDRGP4 UI_IsFullscreen
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1293
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawActiveFrame
+CALLV
+pop
+LABELV $1293
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+LEI4 $1298
+ADDRFP4 12
+INDIRI4
+CNSTI4 5
+LEI4 $1297
+LABELV $1298
+ADDRLP4 24
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1295
+LABELV $1297
+ADDRGP4 ui_stretch+12
+INDIRI4
+CNSTI4 0
+EQI4 $1299
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 $1300
+JUMPV
+LABELV $1299
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+LABELV $1300
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 UI_Refresh
+CALLV
+pop
+LABELV $1295
+ADDRFP4 12
+INDIRI4
+CNSTI4 2
+LTI4 $1302
+ADDRFP4 12
+INDIRI4
+CNSTI4 7
+GEI4 $1302
+ADDRFP4 12
+INDIRI4
+CNSTI4 5
+LTI4 $1305
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1306
+JUMPV
+LABELV $1305
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+LABELV $1306
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawConnectScreen
+CALLV
+pop
+LABELV $1302
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_RunConsole
+CALLV
+pop
+LABELV $1274
+endproc CG_Refresh 36 20
+proc CG_BindUICommand 12 8
+ADDRLP4 0
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1308
+CNSTI4 0
+RETI4
+ADDRGP4 $1307
+JUMPV
+LABELV $1308
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1312
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1310
+CNSTI4 1
+RETI4
+ADDRGP4 $1307
+JUMPV
+LABELV $1310
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1315
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1313
+CNSTI4 1
+RETI4
+ADDRGP4 $1307
+JUMPV
+LABELV $1313
+CNSTI4 0
+RETI4
+LABELV $1307
+endproc CG_BindUICommand 12 8
+export CG_ParseBinding
+proc CG_ParseBinding 2088 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+ASGNP4
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $1317
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1317
+ADDRGP4 $1316
+JUMPV
+LABELV $1317
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Key_GetBindingBuf
+CALLV
+pop
+ADDRLP4 16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1319
+ADDRGP4 $1316
+JUMPV
+LABELV $1319
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1322
+ADDRLP4 1040
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1323
+JUMPV
+LABELV $1322
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+LABELV $1323
+ADDRLP4 8
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $1325
+ADDRLP4 1044
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1326
+JUMPV
+LABELV $1325
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+LABELV $1326
+ADDRLP4 12
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRGP4 $1328
+JUMPV
+LABELV $1330
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1331
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 32
+EQI4 $1330
+ADDRLP4 1048
+INDIRI4
+CNSTI4 12
+EQI4 $1330
+ADDRLP4 1048
+INDIRI4
+CNSTI4 10
+EQI4 $1330
+ADDRLP4 1048
+INDIRI4
+CNSTI4 13
+EQI4 $1330
+ADDRLP4 1048
+INDIRI4
+CNSTI4 9
+EQI4 $1330
+ADDRLP4 1048
+INDIRI4
+CNSTI4 11
+EQI4 $1330
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 59
+ARGI4
+ADDRLP4 1052
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1333
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $1333
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 43
+NEI4 $1335
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+NEI4 $1339
+ADDRLP4 12
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+EQI4 $1336
+ADDRFP4 4
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+NEI4 $1336
+LABELV $1339
+ADDRLP4 1060
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $1340
+ARGP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1342
+ADDRLP4 2084
+CNSTI4 43
+ASGNI4
+ADDRGP4 $1343
+JUMPV
+LABELV $1342
+ADDRLP4 2084
+CNSTI4 45
+ASGNI4
+LABELV $1343
+ADDRLP4 2084
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 1060
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $1336
+JUMPV
+LABELV $1335
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1344
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1348
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 CG_BindUICommand
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $1346
+LABELV $1348
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $1349
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $1346
+LABELV $1344
+LABELV $1336
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1350
+ADDRGP4 $1329
+JUMPV
+LABELV $1350
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1328
+ADDRGP4 $1331
+JUMPV
+LABELV $1329
+LABELV $1316
+endproc CG_ParseBinding 2088 36
+export Message_Key
+proc Message_Key 1036 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1353
+ADDRGP4 $1352
+JUMPV
+LABELV $1353
+ADDRFP4 0
+INDIRI4
+CNSTI4 2147483648
+BANDI4
+CNSTI4 0
+EQI4 $1355
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2147483647
+BANDI4
+ASGNI4
+ADDRGP4 cg+517792
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 MField_CharEvent
+CALLV
+pop
+ADDRGP4 $1352
+JUMPV
+LABELV $1355
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+NEI4 $1358
+ADDRLP4 1024
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 -5
+BANDI4
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+ADDRGP4 cg+517792
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRGP4 $1352
+JUMPV
+LABELV $1358
+ADDRFP4 0
+INDIRI4
+CNSTI4 13
+EQI4 $1363
+ADDRFP4 0
+INDIRI4
+CNSTI4 175
+NEI4 $1361
+LABELV $1363
+ADDRLP4 1028
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+517792+12
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+EQI4 $1364
+ADDRGP4 cg+4
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+EQI4 $1364
+ADDRGP4 cg+517792
+ARGP4
+ADDRLP4 1032
+ADDRGP4 MField_Buffer
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $1369
+ARGP4
+ADDRGP4 cg+517696
+ARGP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $1364
+ADDRLP4 1032
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 -5
+BANDI4
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+ADDRGP4 cg+517792
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRGP4 $1352
+JUMPV
+LABELV $1361
+ADDRGP4 cg+517792
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 MField_KeyDownEvent
+CALLV
+pop
+LABELV $1352
+endproc Message_Key 1036 20
+export CG_DistributeKeyEvent
+proc CG_DistributeKeyEvent 40 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetConnectionState
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 166
+LTI4 $1376
+ADDRFP4 0
+INDIRI4
+CNSTI4 183
+GTI4 $1376
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1380-664
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1380
+address $1377
+address $1377
+address $1377
+address $1377
+address $1377
+address $1377
+address $1377
+address $1377
+address $1377
+address $1376
+address $1377
+address $1377
+address $1376
+address $1376
+address $1376
+address $1376
+address $1376
+address $1377
+code
+LABELV $1377
+ADDRLP4 8
+ADDRGP4 UI_WantsBindKeys
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1376
+ADDRLP4 12
+ADDRGP4 trap_Key_GetNumLockMode
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1376
+ADDRGP4 $1374
+JUMPV
+LABELV $1376
+ADDRFP4 0
+INDIRI4
+CNSTI4 575
+EQI4 $1385
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+NEI4 $1382
+CNSTI4 139
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1385
+CNSTI4 140
+ARGI4
+ADDRLP4 16
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1382
+LABELV $1385
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1374
+ADDRGP4 Con_ToggleConsole_f
+CALLV
+pop
+ADDRGP4 $1374
+JUMPV
+LABELV $1382
+ADDRLP4 20
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $1394
+ADDRFP4 0
+INDIRI4
+CNSTI4 184
+EQI4 $1394
+ADDRFP4 0
+INDIRI4
+CNSTI4 193
+EQI4 $1394
+ADDRFP4 0
+INDIRI4
+CNSTI4 218
+EQI4 $1394
+ADDRFP4 0
+INDIRI4
+CNSTI4 243
+EQI4 $1394
+ADDRFP4 0
+INDIRI4
+CNSTI4 268
+NEI4 $1388
+LABELV $1394
+ADDRLP4 28
+ADDRGP4 trap_GetDemoState
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $1395
+ADDRFP4 12
+INDIRI4
+CNSTI4 8
+NEI4 $1388
+LABELV $1395
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1388
+ADDRGP4 cg_cameraMode+12
+INDIRI4
+CNSTI4 0
+NEI4 $1396
+ADDRGP4 $1399
+ARGP4
+ADDRGP4 $282
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRFP4 0
+CNSTI4 27
+ASGNI4
+LABELV $1396
+LABELV $1388
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+NEI4 $1400
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $1402
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+BANDI4
+ADDRLP4 32
+INDIRI4
+NEI4 $1402
+ADDRFP4 12
+INDIRI4
+CNSTI4 7
+NEI4 $1404
+ADDRLP4 36
+ADDRGP4 trap_GetDemoState
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+EQI4 $1404
+CNSTI4 2
+ARGI4
+ADDRGP4 UI_SetActiveMenu
+CALLV
+pop
+ADDRGP4 $1374
+JUMPV
+LABELV $1404
+ADDRFP4 12
+INDIRI4
+CNSTI4 8
+NEI4 $1406
+ADDRGP4 CG_StopCinematic_f
+CALLV
+pop
+ADDRGP4 $1374
+JUMPV
+LABELV $1406
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $1374
+CNSTI4 2
+ARGI4
+ADDRGP4 $1410
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $1374
+JUMPV
+LABELV $1402
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 $1401
+JUMPV
+LABELV $1400
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_ParseBinding
+CALLV
+pop
+LABELV $1401
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1411
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Console_Key
+CALLV
+pop
+ADDRGP4 $1412
+JUMPV
+LABELV $1411
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1413
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Message_Key
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1413
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $1415
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 32
+INDIRI4
+EQI4 $1415
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_KeyEvent
+CALLV
+pop
+ADDRGP4 $1416
+JUMPV
+LABELV $1415
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1418
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_KeyEvent
+CALLV
+pop
+ADDRGP4 $1419
+JUMPV
+LABELV $1418
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $1420
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Console_Key
+CALLV
+pop
+LABELV $1420
+LABELV $1419
+LABELV $1416
+LABELV $1414
+LABELV $1412
+LABELV $1374
+endproc CG_DistributeKeyEvent 40 28
+export CG_DistributeCharEvent
+proc CG_DistributeCharEvent 16 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetConnectionState
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2147483648
+BORI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1423
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Console_Key
+CALLV
+pop
+ADDRGP4 $1424
+JUMPV
+LABELV $1423
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1425
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Message_Key
+CALLV
+pop
+ADDRGP4 $1426
+JUMPV
+LABELV $1425
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1427
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1427
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_KeyEvent
+CALLV
+pop
+ADDRGP4 $1428
+JUMPV
+LABELV $1427
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1430
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_KeyEvent
+CALLV
+pop
+ADDRGP4 $1431
+JUMPV
+LABELV $1430
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $1432
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Console_Key
+CALLV
+pop
+LABELV $1432
+LABELV $1431
+LABELV $1428
+LABELV $1426
+LABELV $1424
+LABELV $1422
+endproc CG_DistributeCharEvent 16 8
+export CG_UpdateMouseState
+proc CG_UpdateMouseState 16 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1435
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $1435
+ADDRLP4 8
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1437
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 $1438
+JUMPV
+LABELV $1437
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+20
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $1445
+ADDRGP4 cg
+INDIRI4
+CNSTI4 7
+NEI4 $1445
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1439
+CNSTI4 500
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 12288
+BANDI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1439
+LABELV $1445
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $1440
+JUMPV
+LABELV $1439
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1446
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1446
+LABELV $1440
+LABELV $1438
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_Mouse_SetState
+CALLV
+pop
+LABELV $1434
+endproc CG_UpdateMouseState 16 8
+data
+align 4
+LABELV keyCatchers
+byte 4 0
+export Key_GetCatcher
+code
+proc Key_GetCatcher 0 0
+ADDRGP4 keyCatchers
+INDIRI4
+RETI4
+LABELV $1448
+endproc Key_GetCatcher 0 0
+export Key_SetCatcher
+proc Key_SetCatcher 4 4
+ADDRFP4 0
+INDIRI4
+ADDRGP4 keyCatchers
+INDIRI4
+EQI4 $1450
+ADDRGP4 trap_Key_ClearStates
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1453
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1454
+JUMPV
+LABELV $1453
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1454
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_Key_SetRepeat
+CALLV
+pop
+LABELV $1450
+ADDRGP4 keyCatchers
+ADDRFP4 0
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_UpdateMouseState
+CALLV
+pop
+LABELV $1449
+endproc Key_SetCatcher 4 4
+export CG_EventHandling
+proc CG_EventHandling 0 0
+LABELV $1455
+endproc CG_EventHandling 0 0
+export CG_KeyEvent
+proc CG_KeyEvent 0 0
+LABELV $1456
+endproc CG_KeyEvent 0 0
+export CG_MouseEvent
+proc CG_MouseEvent 0 0
+LABELV $1457
+endproc CG_MouseEvent 0 0
+proc CG_MousePosition 60 16
+ADDRGP4 ui_stretch+12
+INDIRI4
+CNSTI4 0
+EQI4 $1459
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 $1460
+JUMPV
+LABELV $1459
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+LABELV $1460
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 44
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 UI_GetCursorPos
+CALLV
+pop
+ADDRLP4 52
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 32
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+CNSTF4 1142947840
+ADDF4
+DIVF4
+ADDRGP4 cgs+20100+35880
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+ADDF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+CNSTF4 1139802112
+ADDF4
+DIVF4
+ADDRGP4 cgs+20100+35884
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 16
+LSHI4
+BORI4
+RETI4
+LABELV $1458
+endproc CG_MousePosition 60 16
+proc CG_SetMousePosition 52 16
+ADDRGP4 ui_stretch+12
+INDIRI4
+CNSTI4 0
+EQI4 $1467
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 $1468
+JUMPV
+LABELV $1467
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+LABELV $1468
+ADDRLP4 32
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 24
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDRGP4 cgs+20100+35880
+INDIRI4
+CVIF4 4
+DIVF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+CNSTF4 1142947840
+ADDF4
+MULF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ADDRGP4 cgs+20100+35884
+INDIRI4
+CVIF4 4
+DIVF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+CNSTF4 1139802112
+ADDF4
+MULF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 UI_SetCursorPos
+CALLV
+pop
+LABELV $1466
+endproc CG_SetMousePosition 52 16
+export CG_JoystickEvent
+proc CG_JoystickEvent 32 12
+ADDRGP4 cg_joystickDebug+12
+INDIRI4
+CNSTI4 0
+EQI4 $1475
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_JoyEventToString
+CALLV
+pop
+ADDRGP4 $1478
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1475
+LABELV $1474
+endproc CG_JoystickEvent 32 12
+export CG_JoystickAxisEvent
+proc CG_JoystickAxisEvent 88 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1482
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $1480
+LABELV $1482
+ADDRGP4 $1479
+JUMPV
+LABELV $1480
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1485
+ADDRFP4 4
+INDIRI4
+CNSTI4 16
+LTI4 $1483
+LABELV $1485
+ADDRGP4 $1486
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1483
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0+4+4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_GetKeyForJoyEvent
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 12+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12+4+4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_GetKeyForJoyEvent
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 52
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 cg+522872+34488
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 cg+522872+34488
+ADDP4
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $1501
+ADDRFP4 8
+INDIRI4
+ADDRLP4 72
+INDIRI4
+GEI4 $1502
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1503
+JUMPV
+LABELV $1502
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $1503
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+GEI4 $1504
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1505
+JUMPV
+LABELV $1504
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+LABELV $1505
+ADDRLP4 60
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $1497
+LABELV $1501
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+GEI4 $1506
+ADDRLP4 28
+INDIRI4
+CNSTI4 -1
+EQI4 $1507
+ADDRLP4 28
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRU4
+ARGU4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+NEGI4
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+ADDRGP4 $1507
+JUMPV
+LABELV $1506
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+LEI4 $1510
+ADDRLP4 32
+INDIRI4
+CNSTI4 -1
+EQI4 $1512
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRU4
+ARGU4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+LABELV $1512
+LABELV $1510
+LABELV $1507
+LABELV $1497
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 76
+INDIRI4
+GEI4 $1514
+ADDRLP4 24
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LTI4 $1514
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_JoystickEvent
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+CNSTI4 -1
+EQI4 $1515
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 80
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRU4
+ARGU4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+NEGI4
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+ADDRGP4 $1515
+JUMPV
+LABELV $1514
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LEI4 $1518
+ADDRLP4 24
+INDIRI4
+ADDRLP4 80
+INDIRI4
+GTI4 $1518
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_JoystickEvent
+CALLV
+pop
+ADDRLP4 32
+INDIRI4
+CNSTI4 -1
+EQI4 $1520
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRU4
+ARGU4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+LABELV $1520
+LABELV $1518
+LABELV $1515
+LABELV $1479
+endproc CG_JoystickAxisEvent 88 24
+export CG_JoystickButtonEvent
+proc CG_JoystickButtonEvent 28 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1525
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $1523
+LABELV $1525
+ADDRGP4 $1522
+JUMPV
+LABELV $1523
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1528
+ADDRFP4 4
+INDIRI4
+CNSTI4 16
+LTI4 $1526
+LABELV $1528
+ADDRGP4 $1529
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1526
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_GetKeyForJoyEvent
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1531
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_JoystickEvent
+CALLV
+pop
+LABELV $1531
+ADDRLP4 12
+INDIRI4
+CNSTI4 -1
+EQI4 $1533
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRU4
+ARGU4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+LABELV $1533
+LABELV $1522
+endproc CG_JoystickButtonEvent 28 24
+export CG_JoystickHatEvent
+proc CG_JoystickHatEvent 124 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRU4
+ASGNU4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1538
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $1536
+LABELV $1538
+ADDRGP4 $1535
+JUMPV
+LABELV $1536
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1541
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $1539
+LABELV $1541
+ADDRGP4 $1542
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1539
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4+4+4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_GetKeyForJoyEvent
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 4+12
+CNSTI4 3
+ASGNI4
+ADDRLP4 4+12+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4+12+4+4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_GetKeyForJoyEvent
+CALLI4
+ASGNI4
+ADDRLP4 56+4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 4+24
+CNSTI4 3
+ASGNI4
+ADDRLP4 4+24+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4+24+4+4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4+24
+ARGP4
+ADDRLP4 88
+ADDRGP4 trap_GetKeyForJoyEvent
+CALLI4
+ASGNI4
+ADDRLP4 56+8
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 4+36
+CNSTI4 3
+ASGNI4
+ADDRLP4 4+36+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4+36+4+4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4+36
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_GetKeyForJoyEvent
+CALLI4
+ASGNI4
+ADDRLP4 56+12
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 52
+ADDRFP4 4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+ADDRGP4 cg+522872+34552
+ADDP4
+ADDP4
+INDIRU1
+CVUI4 1
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+ADDRGP4 cg+522872+34552
+ADDP4
+ADDP4
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1574
+ADDRLP4 104
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 104
+INDIRI4
+BANDI4
+ADDRLP4 108
+INDIRI4
+EQI4 $1578
+ADDRFP4 8
+INDIRI4
+ADDRLP4 104
+INDIRI4
+BANDI4
+ADDRLP4 108
+INDIRI4
+NEI4 $1578
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 56
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1580
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRU4
+ARGU4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+LABELV $1580
+LABELV $1578
+LABELV $1575
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $1574
+ADDRLP4 108
+CNSTI4 3
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 108
+INDIRI4
+EQI4 $1584
+ADDRFP4 8
+INDIRI4
+CNSTI4 6
+EQI4 $1584
+ADDRFP4 8
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LTI4 $1583
+LABELV $1587
+ADDRFP4 8
+INDIRI4
+CNSTI4 9
+EQI4 $1584
+ADDRFP4 8
+INDIRI4
+CNSTI4 12
+EQI4 $1584
+ADDRGP4 $1583
+JUMPV
+LABELV $1584
+ADDRLP4 116
+ADDRGP4 UI_WantsBindKeys
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+EQI4 $1583
+ADDRGP4 $1535
+JUMPV
+LABELV $1583
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1588
+ADDRLP4 116
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 116
+INDIRI4
+BANDI4
+ADDRLP4 120
+INDIRI4
+NEI4 $1592
+ADDRFP4 8
+INDIRI4
+ADDRLP4 116
+INDIRI4
+BANDI4
+ADDRLP4 120
+INDIRI4
+EQI4 $1592
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRGP4 CG_JoystickEvent
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 56
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1594
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 56
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRFP4 12
+INDIRU4
+ARGU4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+LABELV $1594
+LABELV $1592
+LABELV $1589
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $1588
+LABELV $1535
+endproc CG_JoystickHatEvent 124 24
+bss
+align 1
+LABELV $1597
+skip 256
+code
+proc CG_VoIPString 304 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1602
+ADDRLP4 260
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 260
+INDIRI4
+GTI4 $1602
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1598
+LABELV $1602
+CNSTP4 0
+RETP4
+ADDRGP4 $1596
+JUMPV
+LABELV $1598
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1605
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 264
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $1603
+ADDRLP4 280
+CNSTI4 0
+ASGNI4
+ADDRLP4 268
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRGP4 $1609
+JUMPV
+LABELV $1606
+CNSTI4 2044
+ADDRLP4 268
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1615
+ADDRLP4 268
+INDIRI4
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+INDIRI4
+NEI4 $1611
+LABELV $1615
+ADDRGP4 $1607
+JUMPV
+LABELV $1611
+ADDRLP4 288
+CNSTI4 2044
+ASGNI4
+ADDRLP4 288
+INDIRI4
+ADDRLP4 268
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+EQI4 $1616
+ADDRGP4 $1607
+JUMPV
+LABELV $1616
+ADDRLP4 272
+INDIRI4
+ADDRGP4 $1597
+ADDP4
+ARGP4
+CNSTU4 256
+ADDRLP4 272
+INDIRI4
+CVIU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 $351
+ARGP4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+LEI4 $1625
+ADDRLP4 292
+ADDRGP4 $1623
+ASGNP4
+ADDRGP4 $1626
+JUMPV
+LABELV $1625
+ADDRLP4 292
+ADDRGP4 $282
+ASGNP4
+LABELV $1626
+ADDRLP4 292
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 Com_sprintf
+CALLI4
+ASGNI4
+ADDRLP4 276
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+ADDRLP4 276
+INDIRI4
+ADDI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+CNSTU4 256
+LTU4 $1627
+ADDRGP4 $1629
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $1608
+JUMPV
+LABELV $1627
+ADDRLP4 272
+ADDRLP4 272
+INDIRI4
+ADDRLP4 276
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1607
+ADDRLP4 268
+ADDRLP4 268
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1609
+ADDRLP4 268
+INDIRI4
+ADDRGP4 cgs+56116
+INDIRI4
+LTI4 $1606
+LABELV $1608
+ADDRLP4 272
+INDIRI4
+ADDRGP4 $1597
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $1604
+JUMPV
+LABELV $1603
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1632
+ARGP4
+CNSTI4 9
+ARGI4
+ADDRLP4 268
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+NEI4 $1630
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 272
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRGP4 $1597
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $1633
+ARGP4
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1631
+JUMPV
+LABELV $1630
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1636
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 276
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $1634
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 280
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRGP4 $1597
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $1633
+ARGP4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1635
+JUMPV
+LABELV $1634
+CNSTP4 0
+RETP4
+ADDRGP4 $1596
+JUMPV
+LABELV $1635
+LABELV $1631
+LABELV $1604
+ADDRGP4 $1597
+RETP4
+LABELV $1596
+endproc CG_VoIPString 304 20
+proc CG_UpdateGlconfig 20 4
+ADDRLP4 4
+ADDRGP4 cgs+20100+35880
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cgs+20100+35884
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+20100
+ARGP4
+ADDRGP4 trap_GetGlconfig
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1648
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+20100+35880
+INDIRI4
+NEI4 $1650
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cgs+20100+35884
+INDIRI4
+EQI4 $1648
+LABELV $1650
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1649
+JUMPV
+LABELV $1648
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $1649
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $1653
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $1651
+ADDRGP4 cg
+INDIRI4
+CNSTI4 7
+EQI4 $1651
+LABELV $1653
+ADDRGP4 cg+515608
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+515604
+CNSTI4 1
+ASGNI4
+ADDRGP4 CG_CalcVrect
+CALLV
+pop
+LABELV $1651
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1656
+ADDRGP4 CG_ConsoleResized
+CALLV
+pop
+ADDRGP4 UI_WindowResized
+CALLV
+pop
+LABELV $1656
+LABELV $1637
+endproc CG_UpdateGlconfig 20 4
+bss
+export cg_joystickDebug
+align 4
+LABELV cg_joystickDebug
+skip 272
+export cg_introPlayed
+align 4
+LABELV cg_introPlayed
+skip 272
+export cg_pmove_msec
+align 4
+LABELV cg_pmove_msec
+skip 272
+export cg_hudFiles
+align 4
+LABELV cg_hudFiles
+skip 272
+import UI_DrawProportionalString
+import UI_WindowResized
+import UI_WantsBindKeys
+import UI_DrawConnectScreen
+import UI_ConsoleCommand
+import UI_SetActiveMenu
+import UI_Refresh
+import UI_IsFullscreen
+import UI_SetCursorPos
+import UI_GetCursorPos
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import ui_numCommands
+import ui_commands
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_HudMenuHacks
+import CG_LoadMenus
+export cg_thirdPersonSmooth
+align 4
+LABELV cg_thirdPersonSmooth
+skip 1088
+export cg_thirdPersonHeight
+align 4
+LABELV cg_thirdPersonHeight
+skip 1088
+export cg_thirdPersonAngle
+align 4
+LABELV cg_thirdPersonAngle
+skip 1088
+export cg_thirdPersonRange
+align 4
+LABELV cg_thirdPersonRange
+skip 1088
+export cg_thirdPerson
+align 4
+LABELV cg_thirdPerson
+skip 1088
+export cg_drawGun
+align 4
+LABELV cg_drawGun
+skip 1088
+export cg_cyclePastGauntlet
+align 4
+LABELV cg_cyclePastGauntlet
+skip 1088
+export cg_autoswitch
+align 4
+LABELV cg_autoswitch
+skip 1088
+export cg_teampref
+align 4
+LABELV cg_teampref
+skip 1088
+export cg_teamtask
+align 4
+LABELV cg_teamtask
+skip 1088
+export cg_handicap
+align 4
+LABELV cg_handicap
+skip 1088
+export cg_color2
+align 4
+LABELV cg_color2
+skip 1088
+export cg_color1
+align 4
+LABELV cg_color1
+skip 1088
+export cg_defaultFemaleTeamHeadModel
+align 4
+LABELV cg_defaultFemaleTeamHeadModel
+skip 272
+export cg_defaultFemaleTeamModel
+align 4
+LABELV cg_defaultFemaleTeamModel
+skip 272
+export cg_defaultMaleTeamHeadModel
+align 4
+LABELV cg_defaultMaleTeamHeadModel
+skip 272
+export cg_defaultMaleTeamModel
+align 4
+LABELV cg_defaultMaleTeamModel
+skip 272
+export cg_defaultTeamModelGender
+align 4
+LABELV cg_defaultTeamModelGender
+skip 272
+export cg_defaultFemaleHeadModel
+align 4
+LABELV cg_defaultFemaleHeadModel
+skip 272
+export cg_defaultFemaleModel
+align 4
+LABELV cg_defaultFemaleModel
+skip 272
+export cg_defaultMaleHeadModel
+align 4
+LABELV cg_defaultMaleHeadModel
+skip 272
+export cg_defaultMaleModel
+align 4
+LABELV cg_defaultMaleModel
+skip 272
+export cg_defaultModelGender
+align 4
+LABELV cg_defaultModelGender
+skip 272
+export ui_stretch
+align 4
+LABELV ui_stretch
+skip 272
+export cg_numberFontBorder
+align 4
+LABELV cg_numberFontBorder
+skip 272
+export cg_numberFont
+align 4
+LABELV cg_numberFont
+skip 272
+export cg_hudFontBorder
+align 4
+LABELV cg_hudFontBorder
+skip 272
+export cg_hudFont
+align 4
+LABELV cg_hudFont
+skip 272
+export cg_consoleFontSize
+align 4
+LABELV cg_consoleFontSize
+skip 272
+export cg_consoleFont
+align 4
+LABELV cg_consoleFont
+skip 272
+export cg_drawBBox
+align 4
+LABELV cg_drawBBox
+skip 272
+export cg_drawGrappleHook
+align 4
+LABELV cg_drawGrappleHook
+skip 272
+export cg_forceBitmapFonts
+align 4
+LABELV cg_forceBitmapFonts
+skip 272
+export cg_antiLag
+align 4
+LABELV cg_antiLag
+skip 272
+export cg_smoothBodySink
+align 4
+LABELV cg_smoothBodySink
+skip 272
+export cg_oldBubbles
+align 4
+LABELV cg_oldBubbles
+skip 272
+export cg_drawPickupItems
+align 4
+LABELV cg_drawPickupItems
+skip 272
+export cg_drawScores
+align 4
+LABELV cg_drawScores
+skip 272
+export cg_skybox
+align 4
+LABELV cg_skybox
+skip 272
+export cg_fadeExplosions
+align 4
+LABELV cg_fadeExplosions
+skip 272
+export cg_fovAspectAdjust
+align 4
+LABELV cg_fovAspectAdjust
+skip 272
+export cg_coronas
+align 4
+LABELV cg_coronas
+skip 272
+export cg_coronafardist
+align 4
+LABELV cg_coronafardist
+skip 272
+export cg_drawShaderInfo
+align 4
+LABELV cg_drawShaderInfo
+skip 272
+export cg_consoleLatency
+align 4
+LABELV cg_consoleLatency
+skip 272
+export cg_voipShowCrosshairMeter
+align 4
+LABELV cg_voipShowCrosshairMeter
+skip 272
+export cg_voipShowMeter
+align 4
+LABELV cg_voipShowMeter
+skip 272
+export cg_teamDmLeadAnnouncements
+align 4
+LABELV cg_teamDmLeadAnnouncements
+skip 272
+export cg_atmosphericEffects
+align 4
+LABELV cg_atmosphericEffects
+skip 272
+export cg_railSegmentLength
+align 4
+LABELV cg_railSegmentLength
+skip 272
+export cg_railCoreWidth
+align 4
+LABELV cg_railCoreWidth
+skip 272
+export cg_railWidth
+align 4
+LABELV cg_railWidth
+skip 272
+export cg_trueLightning
+align 4
+LABELV cg_trueLightning
+skip 272
+export cg_oldPlasma
+align 4
+LABELV cg_oldPlasma
+skip 272
+export cg_oldRocket
+align 4
+LABELV cg_oldRocket
+skip 272
+export cg_oldRail
+align 4
+LABELV cg_oldRail
+skip 272
+export cg_noProjectileTrail
+align 4
+LABELV cg_noProjectileTrail
+skip 272
+export cg_cameraMode
+align 4
+LABELV cg_cameraMode
+skip 272
+export cg_timescale
+align 4
+LABELV cg_timescale
+skip 272
+export cg_timescaleFadeSpeed
+align 4
+LABELV cg_timescaleFadeSpeed
+skip 272
+export cg_timescaleFadeEnd
+align 4
+LABELV cg_timescaleFadeEnd
+skip 272
+export pmove_msec
+align 4
+LABELV pmove_msec
+skip 272
+export pmove_fixed
+align 4
+LABELV pmove_fixed
+skip 272
+export pmove_overbounce
+align 4
+LABELV pmove_overbounce
+skip 272
+export cg_smoothClients
+align 4
+LABELV cg_smoothClients
+skip 272
+export cg_scorePlum
+align 4
+LABELV cg_scorePlum
+skip 272
+export cg_teamChatsOnly
+align 4
+LABELV cg_teamChatsOnly
+skip 272
+export cg_drawFriend
+align 4
+LABELV cg_drawFriend
+skip 272
+export cg_deferPlayers
+align 4
+LABELV cg_deferPlayers
+skip 272
+export cg_predictItems
+align 4
+LABELV cg_predictItems
+skip 272
+export cg_blood
+align 4
+LABELV cg_blood
+skip 272
+export cg_paused
+align 4
+LABELV cg_paused
+skip 272
+export cg_buildScript
+align 4
+LABELV cg_buildScript
+skip 272
+export cg_forceModel
+align 4
+LABELV cg_forceModel
+skip 272
+export cg_stats
+align 4
+LABELV cg_stats
+skip 272
+export cg_teamChatHeight
+align 4
+LABELV cg_teamChatHeight
+skip 272
+export cg_teamChatTime
+align 4
+LABELV cg_teamChatTime
+skip 272
+export cg_singlePlayer
+align 4
+LABELV cg_singlePlayer
+skip 272
+export cg_synchronousClients
+align 4
+LABELV cg_synchronousClients
+skip 272
+export cg_drawAttacker
+align 4
+LABELV cg_drawAttacker
+skip 272
+export cg_drawLagometer
+align 4
+LABELV cg_drawLagometer
+skip 272
+export cg_hudTextScale
+align 4
+LABELV cg_hudTextScale
+skip 272
+export cg_splitviewTextScale
+align 4
+LABELV cg_splitviewTextScale
+skip 272
+export cg_splitviewThirdEqual
+align 4
+LABELV cg_splitviewThirdEqual
+skip 272
+export cg_splitviewVertical
+align 4
+LABELV cg_splitviewVertical
+skip 272
+export cg_weaponFov
+align 4
+LABELV cg_weaponFov
+skip 272
+export cg_zoomFov
+align 4
+LABELV cg_zoomFov
+skip 272
+export cg_fov
+align 4
+LABELV cg_fov
+skip 272
+export cg_simpleItems
+align 4
+LABELV cg_simpleItems
+skip 272
+export cg_ignore
+align 4
+LABELV cg_ignore
+skip 272
+export cg_tracerLength
+align 4
+LABELV cg_tracerLength
+skip 272
+export cg_tracerWidth
+align 4
+LABELV cg_tracerWidth
+skip 272
+export cg_tracerChance
+align 4
+LABELV cg_tracerChance
+skip 272
+export cg_viewsize
+align 4
+LABELV cg_viewsize
+skip 272
+export cg_gun_z
+align 4
+LABELV cg_gun_z
+skip 272
+export cg_gun_y
+align 4
+LABELV cg_gun_y
+skip 272
+export cg_gun_x
+align 4
+LABELV cg_gun_x
+skip 272
+export cg_gun_frame
+align 4
+LABELV cg_gun_frame
+skip 272
+export cg_brassTime
+align 4
+LABELV cg_brassTime
+skip 272
+export cg_addMarks
+align 4
+LABELV cg_addMarks
+skip 272
+export cg_footsteps
+align 4
+LABELV cg_footsteps
+skip 272
+export cg_showPolyBuffers
+align 4
+LABELV cg_showPolyBuffers
+skip 272
+export cg_showTraceTests
+align 4
+LABELV cg_showTraceTests
+skip 272
+export cg_optimizePrediction
+align 4
+LABELV cg_optimizePrediction
+skip 272
+export cg_showmiss
+align 4
+LABELV cg_showmiss
+skip 272
+export cg_noPlayerAnims
+align 4
+LABELV cg_noPlayerAnims
+skip 272
+export cg_nopredict
+align 4
+LABELV cg_nopredict
+skip 272
+export cg_errorDecay
+align 4
+LABELV cg_errorDecay
+skip 272
+export cg_railTrailTime
+align 4
+LABELV cg_railTrailTime
+skip 272
+export cg_debugEvents
+align 4
+LABELV cg_debugEvents
+skip 272
+export cg_debugPosition
+align 4
+LABELV cg_debugPosition
+skip 272
+export cg_debugAnim
+align 4
+LABELV cg_debugAnim
+skip 272
+export cg_animSpeed
+align 4
+LABELV cg_animSpeed
+skip 272
+export cg_draw2D
+align 4
+LABELV cg_draw2D
+skip 272
+export cg_drawStatus
+align 4
+LABELV cg_drawStatus
+skip 272
+export cg_crosshairHealth
+align 4
+LABELV cg_crosshairHealth
+skip 272
+export cg_crosshairSize
+align 4
+LABELV cg_crosshairSize
+skip 272
+export cg_crosshairY
+align 4
+LABELV cg_crosshairY
+skip 272
+export cg_crosshairX
+align 4
+LABELV cg_crosshairX
+skip 272
+export cg_teamOverlayUserinfo
+align 4
+LABELV cg_teamOverlayUserinfo
+skip 272
+export cg_drawTeamOverlay
+align 4
+LABELV cg_drawTeamOverlay
+skip 272
+export cg_drawRewards
+align 4
+LABELV cg_drawRewards
+skip 272
+export cg_drawCrosshairNames
+align 4
+LABELV cg_drawCrosshairNames
+skip 272
+export cg_drawCrosshair
+align 4
+LABELV cg_drawCrosshair
+skip 272
+export cg_drawAmmoWarning
+align 4
+LABELV cg_drawAmmoWarning
+skip 272
+export cg_drawIcons
+align 4
+LABELV cg_drawIcons
+skip 272
+export cg_draw3dIcons
+align 4
+LABELV cg_draw3dIcons
+skip 272
+export cg_drawSnapshot
+align 4
+LABELV cg_drawSnapshot
+skip 272
+export cg_drawFPS
+align 4
+LABELV cg_drawFPS
+skip 272
+export cg_drawTimer
+align 4
+LABELV cg_drawTimer
+skip 272
+export cg_gibs
+align 4
+LABELV cg_gibs
+skip 272
+export cg_shadows
+align 4
+LABELV cg_shadows
+skip 272
+export cg_swingSpeed
+align 4
+LABELV cg_swingSpeed
+skip 272
+export cg_bobroll
+align 4
+LABELV cg_bobroll
+skip 272
+export cg_bobpitch
+align 4
+LABELV cg_bobpitch
+skip 272
+export cg_bobup
+align 4
+LABELV cg_bobup
+skip 272
+export cg_runroll
+align 4
+LABELV cg_runroll
+skip 272
+export cg_runpitch
+align 4
+LABELV cg_runpitch
+skip 272
+export cg_viewkick
+align 4
+LABELV cg_viewkick
+skip 272
+export cg_viewbob
+align 4
+LABELV cg_viewbob
+skip 272
+export cg_centertime
+align 4
+LABELV cg_centertime
+skip 272
+export cg_dedicated
+align 4
+LABELV cg_dedicated
+skip 272
+export con_autoclear
+align 4
+LABELV con_autoclear
+skip 272
+export con_autochat
+align 4
+LABELV con_autochat
+skip 272
+export con_conspeed
+align 4
+LABELV con_conspeed
+skip 272
+import cg_markPolys
+export cg_items
+align 4
+LABELV cg_items
+skip 6144
+export cg_weapons
+align 4
+LABELV cg_weapons
+skip 2048
+export cg_entities
+align 4
+LABELV cg_entities
+skip 3489792
+export cg
+align 4
+LABELV cg
+skip 679160
+export cgs
+align 4
+LABELV cgs
+skip 806152
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1636
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1633
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1632
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $1629
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1623
+byte 1 44
+byte 1 0
+align 1
+LABELV $1605
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1542
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 74
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 72
+byte 1 97
+byte 1 116
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1529
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 74
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 66
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1486
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 74
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 120
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1478
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1410
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1399
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $1369
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1349
+byte 1 10
+byte 1 0
+align 1
+LABELV $1340
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1315
+byte 1 116
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1312
+byte 1 116
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1264
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1256
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $1255
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $1254
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $1251
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $1249
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1248
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 51
+byte 1 45
+byte 1 52
+byte 1 0
+align 1
+LABELV $1218
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 46
+byte 1 82
+byte 1 111
+byte 1 81
+byte 1 0
+align 1
+LABELV $1217
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $1213
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 46
+byte 1 82
+byte 1 111
+byte 1 81
+byte 1 10
+byte 1 0
+align 1
+LABELV $1204
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 0
+align 1
+LABELV $1201
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1198
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $1172
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1116
+byte 1 42
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1109
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 83
+byte 1 85
+byte 1 66
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 76
+byte 1 83
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1104
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1101
+byte 1 119
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 0
+align 1
+LABELV $1098
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $1095
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1092
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1089
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1086
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1075
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $1072
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $1069
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1066
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1063
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1060
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $1057
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 69
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $1054
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1051
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 48
+byte 1 49
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1048
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 48
+byte 1 50
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1045
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1042
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1039
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1036
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $1031
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1028
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1025
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1022
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1019
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1016
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1013
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1010
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1007
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1004
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 98
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1001
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $998
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $995
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $992
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $989
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $986
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $983
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 101
+byte 1 0
+align 1
+LABELV $975
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 51
+byte 1 0
+align 1
+LABELV $971
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 50
+byte 1 0
+align 1
+LABELV $967
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 49
+byte 1 0
+align 1
+LABELV $964
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $960
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 50
+byte 1 0
+align 1
+LABELV $956
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 49
+byte 1 0
+align 1
+LABELV $953
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $950
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $942
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $939
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $936
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $933
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $930
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $927
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $924
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $921
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $918
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $915
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 37
+byte 1 99
+byte 1 0
+align 1
+LABELV $908
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $905
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $902
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 66
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $899
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $896
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $893
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $890
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 49
+byte 1 0
+align 1
+LABELV $887
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $884
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $881
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $878
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $875
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $872
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $869
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $866
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 66
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 66
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $863
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 53
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $859
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 52
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $855
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 51
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $851
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 50
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $847
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $844
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 97
+byte 1 0
+align 1
+LABELV $843
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $837
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 98
+byte 1 50
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $834
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 98
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $831
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $828
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $825
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $822
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 120
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $819
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 108
+byte 1 120
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $816
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $813
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $810
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $807
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $804
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $801
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $782
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 107
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $778
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $774
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 121
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $770
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $766
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $762
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $759
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $754
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $751
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 95
+byte 1 117
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $748
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 95
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $745
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $742
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $739
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $736
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $733
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $730
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $727
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $724
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $721
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $718
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $715
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $712
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $709
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $706
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $703
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $700
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $697
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $694
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $691
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $688
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $685
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 116
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $682
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $679
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $676
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $673
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 98
+byte 1 121
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $670
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 121
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $667
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $664
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $661
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $658
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $655
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $647
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $644
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $641
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $638
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $635
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $632
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $629
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $626
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $623
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $620
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $617
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $614
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $606
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $603
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $600
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $597
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $594
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $591
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 51
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $588
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 50
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $585
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 49
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $582
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 115
+byte 1 117
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $579
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 53
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $576
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 49
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $572
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $566
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $506
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $504
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $491
+byte 1 91
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 0
+align 1
+LABELV $459
+byte 1 91
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 0
+align 1
+LABELV $452
+byte 1 91
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 93
+byte 1 0
+align 1
+LABELV $358
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $356
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $355
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $354
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $353
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $352
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $351
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $350
+byte 1 85
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $328
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $327
+byte 1 103
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $314
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $313
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $312
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $311
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $310
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $309
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $308
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $307
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 80
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $306
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $305
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $304
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $303
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $302
+byte 1 53
+byte 1 0
+align 1
+LABELV $301
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $300
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $299
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $298
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 68
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 0
+align 1
+LABELV $297
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $296
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $295
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $294
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $293
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $292
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $291
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $290
+byte 1 109
+byte 1 97
+byte 1 106
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $289
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $288
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $287
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $286
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $285
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $284
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $283
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 66
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $282
+byte 1 0
+align 1
+LABELV $281
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $280
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 66
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $279
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 76
+byte 1 105
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 45
+byte 1 66
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $278
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $277
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $276
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 76
+byte 1 105
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 77
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 45
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $275
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $274
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 66
+byte 1 66
+byte 1 111
+byte 1 120
+byte 1 0
+align 1
+LABELV $273
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 72
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $272
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 66
+byte 1 105
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $271
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 76
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $270
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 66
+byte 1 111
+byte 1 100
+byte 1 121
+byte 1 83
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 0
+align 1
+LABELV $269
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 66
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $268
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $267
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $266
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 0
+align 1
+LABELV $265
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $264
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 65
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 65
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $263
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 0
+align 1
+LABELV $262
+byte 1 49
+byte 1 53
+byte 1 51
+byte 1 54
+byte 1 0
+align 1
+LABELV $261
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 102
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $260
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $259
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 76
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 121
+byte 1 0
+align 1
+LABELV $258
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 77
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $257
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 77
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $256
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 68
+byte 1 109
+byte 1 76
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $255
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 112
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 69
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $254
+byte 1 51
+byte 1 50
+byte 1 0
+align 1
+LABELV $253
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 83
+byte 1 101
+byte 1 103
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 76
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $252
+byte 1 54
+byte 1 0
+align 1
+LABELV $251
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 67
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $250
+byte 1 49
+byte 1 54
+byte 1 0
+align 1
+LABELV $249
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $248
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $247
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $246
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 0
+align 1
+LABELV $245
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $244
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $243
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $242
+byte 1 56
+byte 1 0
+align 1
+LABELV $241
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $240
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $239
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $238
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $237
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $236
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $235
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $234
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $233
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $232
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $231
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $230
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $229
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $228
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $227
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $226
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $225
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $224
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $223
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $222
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $221
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $220
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $219
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $218
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $217
+byte 1 51
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $216
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $215
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $214
+byte 1 50
+byte 1 0
+align 1
+LABELV $213
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $212
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 84
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 69
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $211
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 86
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $210
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $209
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $208
+byte 1 48
+byte 1 46
+byte 1 52
+byte 1 0
+align 1
+LABELV $207
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $206
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $205
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 80
+byte 1 111
+byte 1 108
+byte 1 121
+byte 1 66
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $204
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $203
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $202
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $201
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $200
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $199
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $198
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $197
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $196
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 0
+align 1
+LABELV $195
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $194
+byte 1 48
+byte 1 46
+byte 1 51
+byte 1 0
+align 1
+LABELV $193
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $192
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $191
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $190
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $189
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 48
+byte 1 53
+byte 1 0
+align 1
+LABELV $188
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $187
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 48
+byte 1 50
+byte 1 0
+align 1
+LABELV $186
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $185
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $184
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 0
+align 1
+LABELV $183
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $182
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 90
+byte 1 0
+align 1
+LABELV $181
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 89
+byte 1 0
+align 1
+LABELV $180
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 88
+byte 1 0
+align 1
+LABELV $179
+byte 1 52
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $178
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $177
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $176
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $175
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $174
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $173
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 89
+byte 1 0
+align 1
+LABELV $172
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 88
+byte 1 0
+align 1
+LABELV $171
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $170
+byte 1 50
+byte 1 52
+byte 1 0
+align 1
+LABELV $169
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $168
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 76
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $167
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $166
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $165
+byte 1 52
+byte 1 0
+align 1
+LABELV $164
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $163
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $162
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $161
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $160
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 51
+byte 1 100
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $159
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $158
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 0
+align 1
+LABELV $157
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $156
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $155
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 50
+byte 1 68
+byte 1 0
+align 1
+LABELV $154
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 0
+align 1
+LABELV $153
+byte 1 49
+byte 1 0
+align 1
+LABELV $152
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 0
+align 1
+LABELV $151
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $150
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $149
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 70
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $148
+byte 1 57
+byte 1 48
+byte 1 0
+align 1
+LABELV $147
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $146
+byte 1 50
+byte 1 50
+byte 1 46
+byte 1 53
+byte 1 0
+align 1
+LABELV $145
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $144
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $143
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $142
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $141
+byte 1 48
+byte 1 0
+align 1
+LABELV $140
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $139
+byte 1 51
+byte 1 0
+align 1
+LABELV $138
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $137
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 51
+byte 1 32
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 46
+byte 1 51
+byte 1 43
+byte 1 50
+byte 1 48
+byte 1 50
+byte 1 54
+byte 1 49
+byte 1 48
+byte 1 49
+byte 1 56
+byte 1 43
+byte 1 55
+byte 1 50
+byte 1 51
+byte 1 51
+byte 1 101
+byte 1 57
+byte 1 99
+byte 1 32
+byte 1 113
+byte 1 51
+byte 1 118
+byte 1 109
+byte 1 45
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 49
+byte 1 56
+byte 1 32
+byte 1 50
+byte 1 48
+byte 1 50
+byte 1 54
+byte 1 0
+align 1
+LABELV $136
+byte 1 99
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $130
+byte 1 99
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 109
+byte 1 77
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $100
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 67
+byte 1 71
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 0
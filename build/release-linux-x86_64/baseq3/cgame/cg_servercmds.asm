@@ -0,0 +1,6510 @@
+code
+proc CG_ParseScore 124 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 56
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 56
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 56
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+8
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 56
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+12
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 56
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+16
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 5
+ADDI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+ADDI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 56
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+20
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 7
+ADDI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 56
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+24
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 56
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+28
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 9
+ADDI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 56
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+32
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 10
+ADDI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 56
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+36
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 11
+ADDI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 56
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+40
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 12
+ADDI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 56
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+48
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 13
+ADDI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 56
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+44
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 116
+CNSTI4 56
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+ADDRGP4 cg+518860
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $126
+ADDRLP4 116
+INDIRI4
+ADDRGP4 cg+518860
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $122
+LABELV $126
+CNSTI4 56
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $122
+ADDRLP4 120
+CNSTI4 56
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+CNSTI4 2044
+ADDRLP4 120
+INDIRI4
+ADDRGP4 cg+518860
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+108
+ADDP4
+ADDRLP4 120
+INDIRI4
+ADDRGP4 cg+518860+4
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 2044
+CNSTI4 56
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+148
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $96
+endproc CG_ParseScore 124 4
+proc CG_ParseScores 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+518844
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+518844
+INDIRI4
+CNSTI4 64
+LEI4 $138
+ADDRGP4 cg+518844
+CNSTI4 64
+ASGNI4
+LABELV $138
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+518852
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+518852+4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cg+518860
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 3584
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $150
+JUMPV
+LABELV $147
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 14
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 CG_ParseScore
+CALLV
+pop
+ADDRLP4 32
+CNSTI4 56
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cg+518860+52
+ADDP4
+CNSTI4 2044
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cg+518860
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $148
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $150
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+518844
+INDIRI4
+LTI4 $147
+CNSTI4 14
+ADDRGP4 cg+518844
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+518840
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $136
+endproc CG_ParseScores 36 12
+proc CG_ParseScoresDelta 84 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+518840
+INDIRI4
+EQI4 $160
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+518840
+INDIRI4
+NEI4 $163
+ADDRGP4 $159
+JUMPV
+LABELV $163
+ADDRGP4 cg+518840
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+518836
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRGP4 $169
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+ADDRGP4 $159
+JUMPV
+LABELV $160
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+518844
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 cg+518844
+INDIRI4
+CNSTI4 64
+LEI4 $171
+ADDRGP4 cg+518844
+CNSTI4 64
+ASGNI4
+LABELV $171
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+518852
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 5
+ADDI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+518852+4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+ADDI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $181
+JUMPV
+LABELV $178
+ADDRLP4 8
+CNSTI4 15
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 7
+ADDI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $185
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+518844
+INDIRI4
+LTI4 $182
+LABELV $185
+ADDRGP4 $179
+JUMPV
+LABELV $182
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 CG_ParseScore
+CALLV
+pop
+LABELV $179
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $181
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $178
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $189
+JUMPV
+LABELV $186
+ADDRLP4 72
+CNSTI4 56
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRGP4 cg+518860+52
+ADDP4
+CNSTI4 2044
+ADDRLP4 72
+INDIRI4
+ADDRGP4 cg+518860
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $187
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $189
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+518844
+INDIRI4
+LTI4 $186
+ADDRGP4 cg+518840
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $159
+endproc CG_ParseScoresDelta 84 8
+proc CG_ParseTeamInfoEntry 56 8
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $200
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $198
+LABELV $200
+ADDRGP4 $201
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $197
+JUMPV
+LABELV $198
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 2044
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+112
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 2044
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+116
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 2044
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+120
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 2044
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+124
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 5
+ADDI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 2044
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+148
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $197
+endproc CG_ParseTeamInfoEntry 56 8
+proc CG_ParseTeamInfo 48 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $215
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $213
+LABELV $215
+ADDRGP4 $216
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $212
+JUMPV
+LABELV $213
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayersTime
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LTI4 $220
+ADDRLP4 32
+INDIRI4
+CNSTI4 32
+LEI4 $218
+LABELV $220
+ADDRGP4 $221
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $212
+JUMPV
+LABELV $218
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $225
+JUMPV
+LABELV $222
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 6
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 3
+ADDI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_ParseTeamInfoEntry
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $226
+ADDRGP4 $212
+JUMPV
+LABELV $226
+LABELV $223
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $225
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+LTI4 $222
+ADDRLP4 36
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+CNSTI4 6
+ADDRLP4 36
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+CNSTI4 3
+ADDI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 teamInfoVersion
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $212
+endproc CG_ParseTeamInfo 48 12
+proc CG_ParseTeamInfoDelta 92 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $231
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+LTI4 $229
+LABELV $231
+ADDRGP4 $232
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $228
+JUMPV
+LABELV $229
+ADDRLP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 teamInfoVersion
+ADDP4
+INDIRI4
+EQI4 $233
+ADDRGP4 $228
+JUMPV
+LABELV $233
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayersTime
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+LTI4 $238
+ADDRLP4 60
+INDIRI4
+CNSTI4 32
+LEI4 $236
+LABELV $238
+ADDRGP4 $239
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $228
+JUMPV
+LABELV $236
+ADDRFP4 0
+INDIRI4
+CNSTI4 5
+ADDI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $243
+JUMPV
+LABELV $240
+CNSTI4 7
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 6
+ADDI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $246
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+LTI4 $244
+LABELV $246
+ADDRGP4 $241
+JUMPV
+LABELV $244
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 84
+CNSTI4 7
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 84
+INDIRI4
+ADDI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_ParseTeamInfoEntry
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $247
+ADDRGP4 $228
+JUMPV
+LABELV $247
+LABELV $241
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $243
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $240
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 teamInfoVersion
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $228
+endproc CG_ParseTeamInfoDelta 92 12
+export CG_ParseServerinfo
+proc CG_ParseServerinfo 68 16
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $251
+ARGP4
+ADDRLP4 12
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 cgs+56064
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $254
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+56096
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $254
+ARGP4
+ADDRGP4 cgs+56096
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $257
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+56100
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $259
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+56104
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $261
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+56108
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $263
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+56112
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $265
+ARGP4
+ADDRLP4 56
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+56116
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $266
+ARGP4
+ADDRLP4 64
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+56120
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $249
+endproc CG_ParseServerinfo 68 16
+proc CG_ParseWarmup 24 8
+CNSTI4 5
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+522548
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $272
+ADDRGP4 cg+522544
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $272
+ADDRGP4 $273
+JUMPV
+LABELV $272
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $275
+ADDRGP4 cg+522544
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $275
+ADDRGP4 cgs+679680+126432
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $275
+LABELV $273
+ADDRGP4 cg+522544
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $270
+endproc CG_ParseWarmup 24 8
+export CG_SetConfigValues
+proc CG_SetConfigValues 36 4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+59308
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 7
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+59312
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 21
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+59304
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+NEI4 $285
+CNSTI4 23
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+59316
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 cgs+59320
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+LABELV $285
+CNSTI4 5
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+522544
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $281
+endproc CG_SetConfigValues 36 4
+export CG_ShaderStateChanged
+proc CG_ShaderStateChanged 188 20
+CNSTI4 24
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRGP4 $293
+JUMPV
+LABELV $292
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $295
+ARGP4
+ADDRLP4 160
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $294
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $294
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $298
+ARGP4
+ADDRLP4 172
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 172
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $294
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $294
+ADDRLP4 76
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 76
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $300
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $301
+ARGP4
+ADDRLP4 180
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $297
+ADDRLP4 140
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 140
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_RemapShader
+CALLV
+pop
+LABELV $297
+LABELV $293
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $304
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $292
+LABELV $304
+LABELV $294
+ADDRGP4 cgs+208612
+ARGP4
+ADDRGP4 cgs+208616
+ARGP4
+ADDRGP4 cgs+208628
+ARGP4
+ADDRGP4 cgs+208632
+ARGP4
+ADDRGP4 cgs+208636
+ARGP4
+ADDRGP4 trap_R_GetGlobalFog
+CALLV
+pop
+LABELV $291
+endproc CG_ShaderStateChanged 188 20
+proc CG_ConfigStringModified 52 12
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cgs
+ARGP4
+ADDRGP4 trap_GetGameState
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $311
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+ADDRGP4 $312
+JUMPV
+LABELV $311
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $313
+ADDRGP4 CG_ParseServerinfo
+CALLV
+pop
+ADDRGP4 $314
+JUMPV
+LABELV $313
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+NEI4 $315
+ADDRGP4 CG_ParseWarmup
+CALLV
+pop
+ADDRGP4 $316
+JUMPV
+LABELV $315
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+NEI4 $317
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+59308
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $318
+JUMPV
+LABELV $317
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $320
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+59312
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $321
+JUMPV
+LABELV $320
+ADDRLP4 0
+INDIRI4
+CNSTI4 21
+NEI4 $323
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+59304
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $324
+JUMPV
+LABELV $323
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $326
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+56184
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+56196
+CNSTI4 1
+ASGNI4
+ADDRGP4 $327
+JUMPV
+LABELV $326
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $330
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+56188
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+56196
+CNSTI4 1
+ASGNI4
+ADDRGP4 $331
+JUMPV
+LABELV $330
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+NEI4 $334
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+56192
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+56196
+CNSTI4 1
+ASGNI4
+ADDRGP4 $335
+JUMPV
+LABELV $334
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $338
+ADDRGP4 cgs+56200
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $339
+JUMPV
+LABELV $338
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $342
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $342
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+57224-48
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+57248-48
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $343
+JUMPV
+LABELV $342
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $348
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+GTI4 $348
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+57232-64
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+57248-64
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+LTI4 $354
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+GTI4 $354
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+57240-72
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+57248-72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $355
+JUMPV
+LABELV $354
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $360
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+GTI4 $360
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cgs+57256-14336
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $361
+JUMPV
+LABELV $360
+ADDRLP4 0
+INDIRI4
+CNSTI4 22
+NEI4 $365
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+36
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $366
+JUMPV
+LABELV $365
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $368
+ADDRLP4 0
+INDIRI4
+CNSTI4 288
+GEI4 $368
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+59332-128
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $369
+JUMPV
+LABELV $368
+ADDRLP4 0
+INDIRI4
+CNSTI4 288
+LTI4 $372
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+GEI4 $372
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $373
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+60356-1152
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $373
+JUMPV
+LABELV $372
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+LTI4 $378
+ADDRLP4 0
+INDIRI4
+CNSTI4 608
+GEI4 $378
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+SUBI4
+ARGI4
+ADDRGP4 CG_NewPlayerInfo
+CALLV
+pop
+ADDRGP4 $379
+JUMPV
+LABELV $378
+ADDRLP4 0
+INDIRI4
+CNSTI4 736
+LTI4 $380
+ADDRLP4 0
+INDIRI4
+CNSTI4 864
+GEI4 $380
+ADDRGP4 $381
+JUMPV
+LABELV $380
+ADDRLP4 0
+INDIRI4
+CNSTI4 23
+NEI4 $382
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+NEI4 $383
+ADDRGP4 cgs+59316
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 cgs+59320
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 $383
+JUMPV
+LABELV $382
+ADDRLP4 0
+INDIRI4
+CNSTI4 24
+NEI4 $389
+ADDRGP4 CG_ShaderStateChanged
+CALLV
+pop
+ADDRGP4 $390
+JUMPV
+LABELV $389
+ADDRLP4 0
+INDIRI4
+CNSTI4 25
+NEI4 $391
+ADDRGP4 cg+522444
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_ClientListParse
+CALLV
+pop
+LABELV $391
+LABELV $390
+LABELV $383
+LABELV $381
+LABELV $379
+LABELV $373
+LABELV $369
+LABELV $366
+LABELV $361
+LABELV $355
+LABELV $349
+LABELV $343
+LABELV $339
+LABELV $335
+LABELV $331
+LABELV $327
+LABELV $324
+LABELV $321
+LABELV $318
+LABELV $316
+LABELV $314
+LABELV $312
+LABELV $310
+endproc CG_ConfigStringModified 52 12
+proc CG_AddToPlayerChatBox 64 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+ASGNP4
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+CNSTI4 8
+GEI4 $396
+ADDRLP4 16
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+ASGNI4
+ADDRGP4 $397
+JUMPV
+LABELV $396
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+LABELV $397
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $403
+ADDRGP4 cg_teamChatTime+12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $400
+LABELV $403
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 39068
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 39064
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $394
+JUMPV
+LABELV $400
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 241
+ADDRLP4 4
+INDIRP4
+CNSTI4 39064
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+MODI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 37104
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 20
+CNSTI4 55
+ASGNI4
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRGP4 $405
+JUMPV
+LABELV $404
+ADDRLP4 8
+INDIRI4
+CNSTI4 79
+LEI4 $407
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $409
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+SUBP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+SUBP4
+ASGNP4
+LABELV $409
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 39064
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 39032
+ADDP4
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 4
+INDIRP4
+CNSTI4 39064
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 241
+ADDRLP4 4
+INDIRP4
+CNSTI4 39064
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+MODI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 37104
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI1 94
+ASGNI1
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 48
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 20
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+LABELV $407
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $412
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $412
+ADDRLP4 36
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $412
+ADDRLP4 36
+INDIRI4
+CNSTI4 48
+LTI4 $412
+ADDRLP4 36
+INDIRI4
+CNSTI4 55
+GTI4 $412
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 44
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 56
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 56
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 52
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $405
+JUMPV
+LABELV $412
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $414
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $414
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 44
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $405
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $404
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 39064
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 39032
+ADDP4
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 4
+INDIRP4
+CNSTI4 39064
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 39064
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 39068
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 16
+INDIRI4
+LEI4 $417
+ADDRLP4 4
+INDIRP4
+CNSTI4 39068
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 39064
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $417
+CNSTI4 1
+RETI4
+LABELV $394
+endproc CG_AddToPlayerChatBox 64 0
+export CG_TeamName
+proc CG_TeamName 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $420
+ADDRGP4 $422
+RETP4
+ADDRGP4 $419
+JUMPV
+LABELV $420
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $423
+ADDRGP4 $425
+RETP4
+ADDRGP4 $419
+JUMPV
+LABELV $423
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $426
+ADDRGP4 $428
+RETP4
+ADDRGP4 $419
+JUMPV
+LABELV $426
+ADDRGP4 $429
+RETP4
+LABELV $419
+endproc CG_TeamName 0 0
+proc CG_AddToTeamChat 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_LocalPlayerBitsForTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $434
+JUMPV
+LABELV $431
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $435
+ADDRGP4 $432
+JUMPV
+LABELV $435
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $437
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 CG_AddToPlayerChatBox
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $437
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $438
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $441
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $437
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $442
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_NotifyPrintf
+CALLV
+pop
+LABELV $438
+LABELV $432
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $434
+ADDRLP4 16
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $431
+LABELV $430
+endproc CG_AddToTeamChat 28 12
+proc CG_MapRestart 8 12
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $444
+ADDRGP4 $447
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $444
+ADDRGP4 CG_InitLocalEntities
+CALLV
+pop
+ADDRGP4 CG_InitMarkPolys
+CALLV
+pop
+ADDRGP4 CG_ClearParticles
+CALLV
+pop
+ADDRGP4 cg+512340
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+512336
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+36
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+56184
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+516656
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+512344
+CNSTI4 1
+ASGNI4
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+ADDRGP4 cg+522544
+INDIRI4
+CNSTI4 0
+NEI4 $455
+ADDRGP4 cgs+679680+126428
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 CG_NumLocalPlayers
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LEI4 $460
+ADDRGP4 $462
+ARGP4
+CNSTI4 240
+ARGI4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 CG_GlobalCenterPrint
+CALLV
+pop
+ADDRGP4 $461
+JUMPV
+LABELV $460
+ADDRGP4 $462
+ARGP4
+CNSTI4 136
+ARGI4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 CG_GlobalCenterPrint
+CALLV
+pop
+LABELV $461
+LABELV $455
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $466
+JUMPV
+LABELV $463
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+35704
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+35700
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872+35960
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $464
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $466
+ADDRLP4 4
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $463
+LABELV $443
+endproc CG_MapRestart 8 12
+proc CG_RemoveChatEscapeChar 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $477
+JUMPV
+LABELV $474
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 25
+NEI4 $478
+ADDRGP4 $475
+JUMPV
+LABELV $478
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $475
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $477
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $474
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $473
+endproc CG_RemoveChatEscapeChar 20 0
+export CG_LocalPlayerBitsForTeam
+proc CG_LocalPlayerBitsForTeam 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $484
+JUMPV
+LABELV $481
+ADDRLP4 8
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+NEI4 $486
+ADDRGP4 $482
+JUMPV
+LABELV $486
+ADDRLP4 4
+CNSTI4 2044
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $489
+ADDRGP4 $482
+JUMPV
+LABELV $489
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1
+EQI4 $493
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $491
+LABELV $493
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+LABELV $491
+LABELV $482
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $484
+ADDRLP4 20
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $481
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $480
+endproc CG_LocalPlayerBitsForTeam 24 0
+export CG_ReplaceCharacter
+proc CG_ReplaceCharacter 12 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $496
+JUMPV
+LABELV $495
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI1
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $496
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $495
+LABELV $494
+endproc CG_ReplaceCharacter 12 8
+proc CG_ServerCommand 464 16
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 168
+CNSTI4 -1
+ASGNI4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $499
+ADDRGP4 $498
+JUMPV
+LABELV $499
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $503
+ARGP4
+ADDRLP4 180
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $501
+ADDRLP4 168
+CNSTI4 1
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 CG_LocalPlayerBitsForTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 188
+INDIRP4
+ASGNP4
+ADDRGP4 $502
+JUMPV
+LABELV $501
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $506
+ARGP4
+ADDRLP4 184
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+NEI4 $504
+ADDRLP4 168
+CNSTI4 2
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 CG_LocalPlayerBitsForTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 192
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 192
+INDIRP4
+ASGNP4
+ADDRGP4 $505
+JUMPV
+LABELV $504
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $509
+ARGP4
+ADDRLP4 188
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $507
+ADDRLP4 168
+CNSTI4 3
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRLP4 192
+ADDRGP4 CG_LocalPlayerBitsForTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 196
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRGP4 $508
+JUMPV
+LABELV $507
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $512
+ARGP4
+ADDRLP4 192
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $510
+ADDRLP4 168
+CNSTI4 0
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRLP4 196
+ADDRGP4 CG_LocalPlayerBitsForTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 200
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 200
+INDIRP4
+ASGNP4
+ADDRGP4 $511
+JUMPV
+LABELV $510
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 108
+NEI4 $513
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 99
+NEI4 $513
+ADDRLP4 200
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 48
+LTI4 $513
+ADDRLP4 200
+INDIRI4
+CNSTI4 57
+GTI4 $513
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 204
+ADDRLP4 208
+INDIRI4
+ASGNI4
+ADDRLP4 212
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+LTI4 $517
+ADDRLP4 216
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+ADDRLP4 216
+INDIRI4
+LEI4 $515
+LABELV $517
+ADDRGP4 $498
+JUMPV
+LABELV $515
+ADDRLP4 220
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 168
+CNSTI4 2044
+CNSTI4 39072
+ADDRLP4 220
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 224
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 224
+INDIRI4
+ADDRLP4 220
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 224
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 228
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 228
+INDIRP4
+ASGNP4
+LABELV $513
+LABELV $511
+LABELV $508
+LABELV $505
+LABELV $502
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $523
+ARGP4
+ADDRLP4 204
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+NEI4 $521
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 208
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 208
+INDIRP4
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 212
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 212
+INDIRU4
+CNSTU4 1
+LEU4 $524
+ADDRLP4 16
+ARGP4
+ADDRLP4 216
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 216
+INDIRU4
+CNSTU4 1
+SUBU4
+ADDRLP4 16
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $524
+ADDRLP4 16
+ARGP4
+ADDRLP4 220
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 220
+INDIRU4
+CNSTU4 1
+SUBU4
+ADDRLP4 16
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $524
+ADDRLP4 16
+ARGP4
+CNSTI4 10
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 CG_ReplaceCharacter
+CALLV
+pop
+ADDRGP4 $526
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $530
+JUMPV
+LABELV $527
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+EQI4 $533
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDRLP4 4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $531
+LABELV $533
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 224
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTF4 1056964608
+ARGF4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $531
+LABELV $528
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $530
+ADDRLP4 220
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 220
+INDIRI4
+LTI4 $527
+ADDRGP4 $498
+JUMPV
+LABELV $521
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $536
+ARGP4
+ADDRLP4 208
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+NEI4 $534
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+EQI4 $537
+ADDRGP4 $498
+JUMPV
+LABELV $537
+ADDRGP4 CG_ConfigStringModified
+CALLV
+pop
+ADDRGP4 $498
+JUMPV
+LABELV $534
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $541
+ARGP4
+ADDRLP4 212
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+NEI4 $539
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+NEI4 $539
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 216
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $542
+ARGP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $498
+JUMPV
+LABELV $539
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $541
+ARGP4
+ADDRLP4 216
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+NEI4 $543
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 220
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $542
+ARGP4
+ADDRLP4 220
+INDIRP4
+ARGP4
+ADDRGP4 CG_NotifyBitsPrintf
+CALLV
+pop
+ADDRGP4 $498
+JUMPV
+LABELV $543
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $547
+ARGP4
+ADDRLP4 220
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+NEI4 $545
+ADDRLP4 224
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+ADDI4
+LEI4 $548
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 228
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 172
+ADDRLP4 232
+INDIRI4
+ASGNI4
+ADDRGP4 $549
+JUMPV
+LABELV $548
+ADDRLP4 172
+CNSTI4 -2
+ASGNI4
+LABELV $549
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+LTI4 $550
+ADDRGP4 cg_teamChatsOnly+12
+INDIRI4
+CNSTI4 0
+EQI4 $550
+ADDRLP4 172
+INDIRI4
+CNSTI4 -1
+EQI4 $550
+ADDRGP4 $498
+JUMPV
+LABELV $550
+ADDRGP4 cgs+679680+126208
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 228
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_RemoveChatEscapeChar
+CALLV
+pop
+ADDRGP4 $442
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $498
+JUMPV
+LABELV $545
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $558
+ARGP4
+ADDRLP4 224
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $556
+ADDRGP4 cgs+679680+126208
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 228
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 232
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+ADDI4
+LEI4 $561
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 236
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 172
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRGP4 $562
+JUMPV
+LABELV $561
+ADDRLP4 172
+CNSTI4 -2
+ASGNI4
+LABELV $562
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_RemoveChatEscapeChar
+CALLV
+pop
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+LTI4 $563
+ADDRLP4 172
+INDIRI4
+CNSTI4 64
+GEI4 $563
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 2044
+ADDRLP4 172
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_AddToTeamChat
+CALLV
+pop
+ADDRGP4 $498
+JUMPV
+LABELV $563
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $442
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_NotifyBitsPrintf
+CALLV
+pop
+ADDRGP4 $498
+JUMPV
+LABELV $556
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $569
+ARGP4
+ADDRLP4 228
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+NEI4 $567
+ADDRGP4 cgs+679680+126208
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 232
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 236
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+ADDI4
+LEI4 $572
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 240
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 240
+INDIRP4
+ARGP4
+ADDRLP4 244
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 172
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRGP4 $573
+JUMPV
+LABELV $572
+ADDRLP4 172
+CNSTI4 -2
+ASGNI4
+LABELV $573
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_RemoveChatEscapeChar
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 CG_AddToTeamChat
+CALLV
+pop
+ADDRGP4 $498
+JUMPV
+LABELV $567
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $576
+ARGP4
+ADDRLP4 232
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+NEI4 $574
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_ParseScores
+CALLV
+pop
+ADDRGP4 $498
+JUMPV
+LABELV $574
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $579
+ARGP4
+ADDRLP4 236
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 0
+NEI4 $577
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_ParseScoresDelta
+CALLV
+pop
+ADDRGP4 $498
+JUMPV
+LABELV $577
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $582
+ARGP4
+ADDRLP4 240
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+NEI4 $580
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_ParseTeamInfo
+CALLV
+pop
+ADDRGP4 $498
+JUMPV
+LABELV $580
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $585
+ARGP4
+ADDRLP4 244
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+NEI4 $583
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_ParseTeamInfoDelta
+CALLV
+pop
+ADDRGP4 $498
+JUMPV
+LABELV $583
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $588
+ARGP4
+ADDRLP4 248
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+NEI4 $586
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+EQI4 $589
+ADDRGP4 $498
+JUMPV
+LABELV $589
+ADDRGP4 CG_MapRestart
+CALLV
+pop
+ADDRGP4 $498
+JUMPV
+LABELV $586
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $593
+ARGP4
+ADDRLP4 252
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+NEI4 $591
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+EQI4 $594
+ADDRGP4 $498
+JUMPV
+LABELV $594
+ADDRLP4 256
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 4
+NEI4 $498
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 452
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 452
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 456
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 324
+ARGP4
+ADDRLP4 456
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 460
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 388
+ARGP4
+ADDRLP4 460
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 260
+ARGP4
+ADDRLP4 324
+ARGP4
+ADDRLP4 388
+ARGP4
+ADDRGP4 trap_R_RemapShader
+CALLV
+pop
+ADDRGP4 $498
+JUMPV
+LABELV $591
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $600
+ARGP4
+ADDRLP4 256
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+NEI4 $598
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+EQI4 $601
+ADDRGP4 $498
+JUMPV
+LABELV $601
+ADDRGP4 CG_LoadDeferredPlayers
+CALLV
+pop
+ADDRGP4 $498
+JUMPV
+LABELV $598
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $605
+ARGP4
+ADDRLP4 260
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $603
+ADDRGP4 cg+24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $498
+JUMPV
+LABELV $603
+ADDRGP4 $607
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $498
+endproc CG_ServerCommand 464 16
+export CG_ExecuteNewServerCommands
+proc CG_ExecuteNewServerCommands 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $609
+ADDRLP4 0
+ADDRGP4 cgs+56048
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_GetServerCommand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $613
+ADDRGP4 CG_ServerCommand
+CALLV
+pop
+LABELV $613
+LABELV $610
+ADDRGP4 cgs+56048
+INDIRI4
+ADDRFP4 0
+INDIRI4
+LTI4 $609
+LABELV $608
+endproc CG_ExecuteNewServerCommands 12 4
+bss
+align 4
+LABELV teamInfoVersion
+skip 16
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_drawScores
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $607
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $605
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 76
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $600
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $593
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $588
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $585
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $582
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $579
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $576
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $569
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $558
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $547
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $542
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $541
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $536
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $526
+byte 1 91
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 93
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $523
+byte 1 99
+byte 1 112
+byte 1 0
+align 1
+LABELV $512
+byte 1 91
+byte 1 70
+byte 1 82
+byte 1 69
+byte 1 69
+byte 1 93
+byte 1 0
+align 1
+LABELV $509
+byte 1 91
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 65
+byte 1 84
+byte 1 79
+byte 1 82
+byte 1 93
+byte 1 0
+align 1
+LABELV $506
+byte 1 91
+byte 1 66
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 93
+byte 1 0
+align 1
+LABELV $503
+byte 1 91
+byte 1 82
+byte 1 69
+byte 1 68
+byte 1 93
+byte 1 0
+align 1
+LABELV $462
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 33
+byte 1 0
+align 1
+LABELV $447
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $442
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $441
+byte 1 91
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 93
+byte 1 91
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 93
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $429
+byte 1 70
+byte 1 82
+byte 1 69
+byte 1 69
+byte 1 0
+align 1
+LABELV $428
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 65
+byte 1 84
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $425
+byte 1 66
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 0
+align 1
+LABELV $422
+byte 1 82
+byte 1 69
+byte 1 68
+byte 1 0
+align 1
+LABELV $301
+byte 1 64
+byte 1 0
+align 1
+LABELV $298
+byte 1 58
+byte 1 0
+align 1
+LABELV $295
+byte 1 61
+byte 1 0
+align 1
+LABELV $269
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $266
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $265
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $263
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $261
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $259
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $257
+byte 1 100
+byte 1 109
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $254
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $251
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $239
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 97
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $232
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 97
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $221
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $216
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $201
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $169
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
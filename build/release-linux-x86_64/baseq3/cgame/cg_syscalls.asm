@@ -0,0 +1,4366 @@
+export PASSFLOAT
+code
+proc PASSFLOAT 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $69
+endproc PASSFLOAT 4 0
+export trap_Print
+proc trap_Print 0 8
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $70
+endproc trap_Print 0 8
+export trap_Error
+proc trap_Error 0 8
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $71
+endproc trap_Error 0 8
+export trap_Milliseconds
+proc trap_Milliseconds 4 4
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $72
+endproc trap_Milliseconds 4 4
+export trap_Cvar_Register
+proc trap_Cvar_Register 0 20
+CNSTI4 12
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $73
+endproc trap_Cvar_Register 0 20
+export trap_Cvar_Update
+proc trap_Cvar_Update 0 8
+CNSTI4 13
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $74
+endproc trap_Cvar_Update 0 8
+export trap_Cvar_Set
+proc trap_Cvar_Set 0 12
+CNSTI4 14
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $75
+endproc trap_Cvar_Set 0 12
+export trap_Cvar_SetValue
+proc trap_Cvar_SetValue 4 12
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 15
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $76
+endproc trap_Cvar_SetValue 4 12
+export trap_Cvar_Reset
+proc trap_Cvar_Reset 0 8
+CNSTI4 16
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $77
+endproc trap_Cvar_Reset 0 8
+export trap_Cvar_VariableValue
+proc trap_Cvar_VariableValue 8 8
+CNSTI4 17
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $78
+endproc trap_Cvar_VariableValue 8 8
+export trap_Cvar_VariableIntegerValue
+proc trap_Cvar_VariableIntegerValue 4 8
+CNSTI4 18
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $79
+endproc trap_Cvar_VariableIntegerValue 4 8
+export trap_Cvar_VariableStringBuffer
+proc trap_Cvar_VariableStringBuffer 0 16
+CNSTI4 19
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $80
+endproc trap_Cvar_VariableStringBuffer 0 16
+export trap_Cvar_LatchedVariableStringBuffer
+proc trap_Cvar_LatchedVariableStringBuffer 0 16
+CNSTI4 20
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $81
+endproc trap_Cvar_LatchedVariableStringBuffer 0 16
+export trap_Cvar_DefaultVariableStringBuffer
+proc trap_Cvar_DefaultVariableStringBuffer 0 16
+CNSTI4 21
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $82
+endproc trap_Cvar_DefaultVariableStringBuffer 0 16
+export trap_Cvar_InfoStringBuffer
+proc trap_Cvar_InfoStringBuffer 0 16
+CNSTI4 22
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $83
+endproc trap_Cvar_InfoStringBuffer 0 16
+export trap_Cvar_CheckRange
+proc trap_Cvar_CheckRange 8 20
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 23
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $84
+endproc trap_Cvar_CheckRange 8 20
+export trap_Argc
+proc trap_Argc 4 4
+CNSTI4 5
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $85
+endproc trap_Argc 4 4
+export trap_Argv
+proc trap_Argv 0 16
+CNSTI4 6
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $86
+endproc trap_Argv 0 16
+export trap_Args
+proc trap_Args 0 12
+CNSTI4 7
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $87
+endproc trap_Args 0 12
+export trap_LiteralArgs
+proc trap_LiteralArgs 0 12
+CNSTI4 8
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $88
+endproc trap_LiteralArgs 0 12
+export trap_FS_FOpenFile
+proc trap_FS_FOpenFile 4 16
+CNSTI4 24
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $89
+endproc trap_FS_FOpenFile 4 16
+export trap_FS_Read
+proc trap_FS_Read 4 16
+CNSTI4 25
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $90
+endproc trap_FS_Read 4 16
+export trap_FS_Write
+proc trap_FS_Write 4 16
+CNSTI4 26
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $91
+endproc trap_FS_Write 4 16
+export trap_FS_Seek
+proc trap_FS_Seek 4 16
+CNSTI4 27
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $92
+endproc trap_FS_Seek 4 16
+export trap_FS_Tell
+proc trap_FS_Tell 4 8
+CNSTI4 28
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $93
+endproc trap_FS_Tell 4 8
+export trap_FS_FCloseFile
+proc trap_FS_FCloseFile 0 8
+CNSTI4 29
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $94
+endproc trap_FS_FCloseFile 0 8
+export trap_FS_GetFileList
+proc trap_FS_GetFileList 4 20
+CNSTI4 30
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $95
+endproc trap_FS_GetFileList 4 20
+export trap_FS_Delete
+proc trap_FS_Delete 4 8
+CNSTI4 31
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $96
+endproc trap_FS_Delete 4 8
+export trap_FS_Rename
+proc trap_FS_Rename 4 12
+CNSTI4 32
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $97
+endproc trap_FS_Rename 4 12
+export trap_Cmd_ExecuteText
+proc trap_Cmd_ExecuteText 0 12
+CNSTI4 11
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $98
+endproc trap_Cmd_ExecuteText 0 12
+export trap_AddCommand
+proc trap_AddCommand 0 8
+CNSTI4 9
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $99
+endproc trap_AddCommand 0 8
+export trap_RemoveCommand
+proc trap_RemoveCommand 0 8
+CNSTI4 10
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $100
+endproc trap_RemoveCommand 0 8
+export trap_SendClientCommand
+proc trap_SendClientCommand 0 8
+CNSTI4 156
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $101
+endproc trap_SendClientCommand 0 8
+export trap_UpdateScreen
+proc trap_UpdateScreen 0 4
+CNSTI4 103
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $102
+endproc trap_UpdateScreen 0 4
+export trap_CM_LoadMap
+proc trap_CM_LoadMap 0 8
+CNSTI4 200
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $103
+endproc trap_CM_LoadMap 0 8
+export trap_CM_NumInlineModels
+proc trap_CM_NumInlineModels 4 4
+CNSTI4 201
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $104
+endproc trap_CM_NumInlineModels 4 4
+export trap_CM_InlineModel
+proc trap_CM_InlineModel 4 8
+CNSTI4 202
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $105
+endproc trap_CM_InlineModel 4 8
+export trap_CM_TempBoxModel
+proc trap_CM_TempBoxModel 4 16
+CNSTI4 206
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $106
+endproc trap_CM_TempBoxModel 4 16
+export trap_CM_TempCapsuleModel
+proc trap_CM_TempCapsuleModel 4 16
+CNSTI4 209
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $107
+endproc trap_CM_TempCapsuleModel 4 16
+export trap_CM_PointContents
+proc trap_CM_PointContents 4 12
+CNSTI4 204
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $108
+endproc trap_CM_PointContents 4 12
+export trap_CM_TransformedPointContents
+proc trap_CM_TransformedPointContents 4 20
+CNSTI4 205
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $109
+endproc trap_CM_TransformedPointContents 4 20
+export trap_CM_BoxTrace
+proc trap_CM_BoxTrace 0 32
+CNSTI4 207
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $110
+endproc trap_CM_BoxTrace 0 32
+export trap_CM_CapsuleTrace
+proc trap_CM_CapsuleTrace 0 32
+CNSTI4 210
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $111
+endproc trap_CM_CapsuleTrace 0 32
+export trap_CM_TransformedBoxTrace
+proc trap_CM_TransformedBoxTrace 0 40
+CNSTI4 208
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $112
+endproc trap_CM_TransformedBoxTrace 0 40
+export trap_CM_TransformedCapsuleTrace
+proc trap_CM_TransformedCapsuleTrace 0 40
+CNSTI4 211
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $113
+endproc trap_CM_TransformedCapsuleTrace 0 40
+export trap_CM_BiSphereTrace
+proc trap_CM_BiSphereTrace 8 32
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 212
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $114
+endproc trap_CM_BiSphereTrace 8 32
+export trap_CM_TransformedBiSphereTrace
+proc trap_CM_TransformedBiSphereTrace 8 36
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 213
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $115
+endproc trap_CM_TransformedBiSphereTrace 8 36
+export trap_CM_MarkFragments
+proc trap_CM_MarkFragments 4 32
+CNSTI4 203
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $116
+endproc trap_CM_MarkFragments 4 32
+export trap_S_StartSound
+proc trap_S_StartSound 0 20
+CNSTI4 450
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $117
+endproc trap_S_StartSound 0 20
+export trap_S_StartLocalSound
+proc trap_S_StartLocalSound 0 12
+CNSTI4 402
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $118
+endproc trap_S_StartLocalSound 0 12
+export trap_S_StopLoopingSound
+proc trap_S_StopLoopingSound 0 8
+CNSTI4 456
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $119
+endproc trap_S_StopLoopingSound 0 8
+export trap_S_ClearLoopingSounds
+proc trap_S_ClearLoopingSounds 0 8
+CNSTI4 451
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $120
+endproc trap_S_ClearLoopingSounds 0 8
+export trap_S_AddLoopingSound
+proc trap_S_AddLoopingSound 0 20
+CNSTI4 452
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $121
+endproc trap_S_AddLoopingSound 0 20
+export trap_S_AddRealLoopingSound
+proc trap_S_AddRealLoopingSound 0 20
+CNSTI4 455
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $122
+endproc trap_S_AddRealLoopingSound 0 20
+export trap_S_UpdateEntityPosition
+proc trap_S_UpdateEntityPosition 0 12
+CNSTI4 453
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $123
+endproc trap_S_UpdateEntityPosition 0 12
+export trap_S_Respatialize
+proc trap_S_Respatialize 0 24
+CNSTI4 454
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $124
+endproc trap_S_Respatialize 0 24
+export trap_S_RegisterSound
+proc trap_S_RegisterSound 4 12
+CNSTI4 400
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $125
+endproc trap_S_RegisterSound 4 12
+export trap_S_SoundDuration
+proc trap_S_SoundDuration 4 8
+CNSTI4 401
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $126
+endproc trap_S_SoundDuration 4 8
+export trap_S_StartBackgroundTrack
+proc trap_S_StartBackgroundTrack 8 20
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 403
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $127
+endproc trap_S_StartBackgroundTrack 8 20
+export trap_S_StopBackgroundTrack
+proc trap_S_StopBackgroundTrack 0 4
+CNSTI4 404
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $128
+endproc trap_S_StopBackgroundTrack 0 4
+export trap_S_StartStreamingSound
+proc trap_S_StartStreamingSound 4 20
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 405
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $129
+endproc trap_S_StartStreamingSound 4 20
+export trap_S_StopStreamingSound
+proc trap_S_StopStreamingSound 0 8
+CNSTI4 406
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $130
+endproc trap_S_StopStreamingSound 0 8
+export trap_S_QueueStreamingSound
+proc trap_S_QueueStreamingSound 4 16
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 407
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $131
+endproc trap_S_QueueStreamingSound 4 16
+export trap_S_GetStreamPlayCount
+proc trap_S_GetStreamPlayCount 4 8
+CNSTI4 408
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $132
+endproc trap_S_GetStreamPlayCount 4 8
+export trap_S_SetStreamVolume
+proc trap_S_SetStreamVolume 4 12
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 409
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $133
+endproc trap_S_SetStreamVolume 4 12
+export trap_S_StopAllSounds
+proc trap_S_StopAllSounds 0 4
+CNSTI4 410
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $134
+endproc trap_S_StopAllSounds 0 4
+export trap_R_LoadWorldMap
+proc trap_R_LoadWorldMap 0 8
+CNSTI4 350
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $135
+endproc trap_R_LoadWorldMap 0 8
+export trap_GetEntityToken
+proc trap_GetEntityToken 4 16
+CNSTI4 351
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $136
+endproc trap_GetEntityToken 4 16
+export trap_R_RegisterModel
+proc trap_R_RegisterModel 4 8
+CNSTI4 300
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $137
+endproc trap_R_RegisterModel 4 8
+export trap_R_RegisterShaderEx
+proc trap_R_RegisterShaderEx 4 16
+CNSTI4 301
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $138
+endproc trap_R_RegisterShaderEx 4 16
+export trap_R_RegisterShader
+proc trap_R_RegisterShader 4 8
+CNSTI4 302
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $139
+endproc trap_R_RegisterShader 4 8
+export trap_R_RegisterShaderNoMip
+proc trap_R_RegisterShaderNoMip 4 8
+CNSTI4 303
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $140
+endproc trap_R_RegisterShaderNoMip 4 8
+export trap_R_RegisterFont
+proc trap_R_RegisterFont 4 28
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 304
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+CNSTU4 20556
+ARGU4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $141
+endproc trap_R_RegisterFont 4 28
+export trap_R_AllocSkinSurface
+proc trap_R_AllocSkinSurface 4 12
+CNSTI4 328
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $142
+endproc trap_R_AllocSkinSurface 4 12
+export trap_R_AddSkinToFrame
+proc trap_R_AddSkinToFrame 4 12
+CNSTI4 329
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $143
+endproc trap_R_AddSkinToFrame 4 12
+export trap_R_ClearScene
+proc trap_R_ClearScene 0 4
+CNSTI4 305
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $144
+endproc trap_R_ClearScene 0 4
+export trap_R_AddPolyRefEntityToScene
+proc trap_R_AddPolyRefEntityToScene 0 24
+CNSTI4 330
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTU4 228
+ARGU4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $145
+endproc trap_R_AddPolyRefEntityToScene 0 24
+export trap_R_AddRefEntityToScene
+proc trap_R_AddRefEntityToScene 4 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 CG_AddCustomSurface
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $147
+ADDRGP4 $146
+JUMPV
+LABELV $147
+CNSTI4 306
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTU4 228
+ARGU4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $146
+endproc trap_R_AddRefEntityToScene 4 12
+export trap_R_AddPolyToScene
+proc trap_R_AddPolyToScene 0 24
+CNSTI4 307
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $149
+endproc trap_R_AddPolyToScene 0 24
+export trap_R_AddPolysToScene
+proc trap_R_AddPolysToScene 0 28
+CNSTI4 326
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $150
+endproc trap_R_AddPolysToScene 0 28
+export trap_R_AddPolyBufferToScene
+proc trap_R_AddPolyBufferToScene 0 8
+CNSTI4 327
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $151
+endproc trap_R_AddPolyBufferToScene 0 8
+export trap_R_AddLightToScene
+proc trap_R_AddLightToScene 20 32
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 308
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $152
+endproc trap_R_AddLightToScene 20 32
+export trap_R_AddAdditiveLightToScene
+proc trap_R_AddAdditiveLightToScene 20 28
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 309
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $153
+endproc trap_R_AddAdditiveLightToScene 20 28
+export trap_R_AddVertexLightToScene
+proc trap_R_AddVertexLightToScene 20 28
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 310
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $154
+endproc trap_R_AddVertexLightToScene 20 28
+export trap_R_AddJuniorLightToScene
+proc trap_R_AddJuniorLightToScene 20 28
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 311
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $155
+endproc trap_R_AddJuniorLightToScene 20 28
+export trap_R_AddDirectedLightToScene
+proc trap_R_AddDirectedLightToScene 16 24
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 312
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $156
+endproc trap_R_AddDirectedLightToScene 16 24
+export trap_R_AddCoronaToScene
+proc trap_R_AddCoronaToScene 16 36
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 313
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $157
+endproc trap_R_AddCoronaToScene 16 36
+export trap_R_LightForPoint
+proc trap_R_LightForPoint 4 20
+CNSTI4 352
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $158
+endproc trap_R_LightForPoint 4 20
+export trap_R_RenderScene
+proc trap_R_RenderScene 0 12
+CNSTI4 314
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTU4 448
+ARGU4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $159
+endproc trap_R_RenderScene 0 12
+export trap_R_SetColor
+proc trap_R_SetColor 0 8
+CNSTI4 315
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $160
+endproc trap_R_SetColor 0 8
+export trap_R_SetClipRegion
+proc trap_R_SetClipRegion 0 8
+CNSTI4 322
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $161
+endproc trap_R_SetClipRegion 0 8
+export trap_R_DrawStretchPic
+proc trap_R_DrawStretchPic 32 40
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 316
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $162
+endproc trap_R_DrawStretchPic 32 40
+export trap_R_DrawRotatedPic
+proc trap_R_DrawRotatedPic 36 44
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 323
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $163
+endproc trap_R_DrawRotatedPic 36 44
+export trap_R_DrawStretchPicGradient
+proc trap_R_DrawStretchPicGradient 32 44
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 324
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $164
+endproc trap_R_DrawStretchPicGradient 32 44
+export trap_R_Add2dPolys
+proc trap_R_Add2dPolys 0 16
+CNSTI4 325
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $165
+endproc trap_R_Add2dPolys 0 16
+export trap_R_ModelBounds
+proc trap_R_ModelBounds 8 28
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 320
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $166
+endproc trap_R_ModelBounds 8 28
+export trap_R_LerpTag
+proc trap_R_LerpTag 8 28
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 317
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $167
+endproc trap_R_LerpTag 8 28
+export trap_R_LerpTagFrameModel
+proc trap_R_LerpTagFrameModel 8 40
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 318
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $168
+endproc trap_R_LerpTagFrameModel 8 40
+export trap_R_LerpTagTorso
+proc trap_R_LerpTagTorso 12 64
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 56
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 319
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRFP4 40
+INDIRI4
+ARGI4
+ADDRFP4 44
+INDIRI4
+ARGI4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $169
+endproc trap_R_LerpTagTorso 12 64
+export trap_R_RemapShader
+proc trap_R_RemapShader 0 16
+CNSTI4 321
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $170
+endproc trap_R_RemapShader 0 16
+export trap_R_inPVS
+proc trap_R_inPVS 4 12
+CNSTI4 353
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $171
+endproc trap_R_inPVS 4 12
+export trap_R_GetGlobalFog
+proc trap_R_GetGlobalFog 0 24
+CNSTI4 354
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $172
+endproc trap_R_GetGlobalFog 0 24
+export trap_R_GetViewFog
+proc trap_R_GetViewFog 0 32
+CNSTI4 355
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $173
+endproc trap_R_GetViewFog 0 32
+export trap_R_SetSurfaceShader
+proc trap_R_SetSurfaceShader 0 12
+CNSTI4 356
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $174
+endproc trap_R_SetSurfaceShader 0 12
+export trap_R_GetSurfaceShader
+proc trap_R_GetSurfaceShader 4 12
+CNSTI4 357
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $175
+endproc trap_R_GetSurfaceShader 4 12
+export trap_R_GetShaderFromModel
+proc trap_R_GetShaderFromModel 4 16
+CNSTI4 358
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $176
+endproc trap_R_GetShaderFromModel 4 16
+export trap_R_GetShaderName
+proc trap_R_GetShaderName 0 16
+CNSTI4 359
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $177
+endproc trap_R_GetShaderName 0 16
+export trap_GetClipboardData
+proc trap_GetClipboardData 0 12
+CNSTI4 100
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $178
+endproc trap_GetClipboardData 0 12
+export trap_GetGlconfig
+proc trap_GetGlconfig 0 12
+CNSTI4 101
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTU4 35916
+ARGU4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $179
+endproc trap_GetGlconfig 0 12
+export trap_GetVoipTime
+proc trap_GetVoipTime 4 8
+CNSTI4 104
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $180
+endproc trap_GetVoipTime 4 8
+export trap_GetVoipPower
+proc trap_GetVoipPower 8 8
+CNSTI4 105
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $181
+endproc trap_GetVoipPower 8 8
+export trap_GetVoipGain
+proc trap_GetVoipGain 8 8
+CNSTI4 106
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $182
+endproc trap_GetVoipGain 8 8
+export trap_GetVoipMute
+proc trap_GetVoipMute 4 8
+CNSTI4 107
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $183
+endproc trap_GetVoipMute 4 8
+export trap_GetVoipMuteAll
+proc trap_GetVoipMuteAll 4 4
+CNSTI4 108
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $184
+endproc trap_GetVoipMuteAll 4 4
+export trap_Cmd_AutoComplete
+proc trap_Cmd_AutoComplete 0 16
+CNSTI4 109
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $185
+endproc trap_Cmd_AutoComplete 0 16
+export trap_SV_Shutdown
+proc trap_SV_Shutdown 0 8
+CNSTI4 110
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $186
+endproc trap_SV_Shutdown 0 8
+export trap_GetGameState
+proc trap_GetGameState 0 12
+CNSTI4 150
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTU4 20100
+ARGU4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $187
+endproc trap_GetGameState 0 12
+export trap_GetCurrentSnapshotNumber
+proc trap_GetCurrentSnapshotNumber 0 12
+CNSTI4 151
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $188
+endproc trap_GetCurrentSnapshotNumber 0 12
+export trap_GetSnapshot
+proc trap_GetSnapshot 4 28
+CNSTI4 152
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTU4 168
+ARGU4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $189
+endproc trap_GetSnapshot 4 28
+export trap_GetServerCommand
+proc trap_GetServerCommand 4 8
+CNSTI4 153
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $190
+endproc trap_GetServerCommand 4 8
+export trap_GetCurrentCmdNumber
+proc trap_GetCurrentCmdNumber 4 4
+CNSTI4 154
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $191
+endproc trap_GetCurrentCmdNumber 4 4
+export trap_GetUserCmd
+proc trap_GetUserCmd 4 16
+CNSTI4 155
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $192
+endproc trap_GetUserCmd 4 16
+export trap_SetNetFields
+proc trap_SetNetFields 0 36
+CNSTI4 157
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $193
+endproc trap_SetNetFields 0 36
+export trap_GetDemoState
+proc trap_GetDemoState 4 4
+CNSTI4 158
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $194
+endproc trap_GetDemoState 4 4
+export trap_GetDemoPos
+proc trap_GetDemoPos 4 4
+CNSTI4 159
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $195
+endproc trap_GetDemoPos 4 4
+export trap_GetDemoName
+proc trap_GetDemoName 0 12
+CNSTI4 160
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $196
+endproc trap_GetDemoName 0 12
+export trap_GetDemoLength
+proc trap_GetDemoLength 4 4
+CNSTI4 161
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $197
+endproc trap_GetDemoLength 4 4
+export trap_GetDemoFileInfo
+proc trap_GetDemoFileInfo 4 28
+CNSTI4 165
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $198
+endproc trap_GetDemoFileInfo 4 28
+export trap_GetClientState
+proc trap_GetClientState 0 12
+CNSTI4 190
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTU4 3080
+ARGU4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $199
+endproc trap_GetClientState 0 12
+export trap_GetConfigString
+proc trap_GetConfigString 4 16
+CNSTI4 191
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $200
+endproc trap_GetConfigString 4 16
+export trap_SetMapTitle
+proc trap_SetMapTitle 0 8
+CNSTI4 162
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $201
+endproc trap_SetMapTitle 0 8
+export trap_SetViewAngles
+proc trap_SetViewAngles 0 12
+CNSTI4 163
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $202
+endproc trap_SetViewAngles 0 12
+export trap_GetViewAngles
+proc trap_GetViewAngles 0 12
+CNSTI4 164
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $203
+endproc trap_GetViewAngles 0 12
+export trap_MemoryRemaining
+proc trap_MemoryRemaining 4 4
+CNSTI4 102
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $204
+endproc trap_MemoryRemaining 4 4
+export trap_Key_IsDown
+proc trap_Key_IsDown 4 8
+CNSTI4 503
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $205
+endproc trap_Key_IsDown 4 8
+export trap_Key_ClearStates
+proc trap_Key_ClearStates 0 4
+CNSTI4 508
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $206
+endproc trap_Key_ClearStates 0 4
+export trap_Key_GetKey
+proc trap_Key_GetKey 4 12
+CNSTI4 509
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $207
+endproc trap_Key_GetKey 4 12
+export trap_Key_SetRepeat
+proc trap_Key_SetRepeat 0 8
+CNSTI4 510
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $208
+endproc trap_Key_SetRepeat 0 8
+export trap_Key_KeynumToStringBuf
+proc trap_Key_KeynumToStringBuf 0 16
+CNSTI4 500
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $209
+endproc trap_Key_KeynumToStringBuf 0 16
+export trap_Key_GetBindingBuf
+proc trap_Key_GetBindingBuf 0 16
+CNSTI4 501
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $210
+endproc trap_Key_GetBindingBuf 0 16
+export trap_Key_SetBinding
+proc trap_Key_SetBinding 0 12
+CNSTI4 502
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $211
+endproc trap_Key_SetBinding 0 12
+export trap_Key_SetOverstrikeMode
+proc trap_Key_SetOverstrikeMode 0 8
+CNSTI4 507
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $212
+endproc trap_Key_SetOverstrikeMode 0 8
+export trap_Key_GetOverstrikeMode
+proc trap_Key_GetOverstrikeMode 4 4
+CNSTI4 506
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $213
+endproc trap_Key_GetOverstrikeMode 4 4
+export trap_Key_GetCapsLockMode
+proc trap_Key_GetCapsLockMode 4 4
+CNSTI4 504
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $214
+endproc trap_Key_GetCapsLockMode 4 4
+export trap_Key_GetNumLockMode
+proc trap_Key_GetNumLockMode 4 4
+CNSTI4 505
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $215
+endproc trap_Key_GetNumLockMode 4 4
+export trap_Mouse_GetState
+proc trap_Mouse_GetState 4 8
+CNSTI4 511
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $216
+endproc trap_Mouse_GetState 4 8
+export trap_Mouse_SetState
+proc trap_Mouse_SetState 0 12
+CNSTI4 512
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $217
+endproc trap_Mouse_SetState 0 12
+export trap_SetKeyForJoyEvent
+proc trap_SetKeyForJoyEvent 4 16
+CNSTI4 513
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $218
+endproc trap_SetKeyForJoyEvent 4 16
+export trap_GetKeyForJoyEvent
+proc trap_GetKeyForJoyEvent 4 12
+CNSTI4 514
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $219
+endproc trap_GetKeyForJoyEvent 4 12
+export trap_GetJoyEventForKey
+proc trap_GetJoyEventForKey 4 20
+CNSTI4 515
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $220
+endproc trap_GetJoyEventForKey 4 20
+export trap_JoyEventToString
+proc trap_JoyEventToString 0 16
+CNSTI4 516
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $221
+endproc trap_JoyEventToString 0 16
+export trap_LAN_GetPingQueueCount
+proc trap_LAN_GetPingQueueCount 4 4
+CNSTI4 600
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $222
+endproc trap_LAN_GetPingQueueCount 4 4
+export trap_LAN_ClearPing
+proc trap_LAN_ClearPing 0 8
+CNSTI4 601
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $223
+endproc trap_LAN_ClearPing 0 8
+export trap_LAN_GetPing
+proc trap_LAN_GetPing 0 20
+CNSTI4 602
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $224
+endproc trap_LAN_GetPing 0 20
+export trap_LAN_GetPingInfo
+proc trap_LAN_GetPingInfo 0 16
+CNSTI4 603
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $225
+endproc trap_LAN_GetPingInfo 0 16
+export trap_LAN_GetServerCount
+proc trap_LAN_GetServerCount 4 8
+CNSTI4 604
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $226
+endproc trap_LAN_GetServerCount 4 8
+export trap_LAN_GetServerAddressString
+proc trap_LAN_GetServerAddressString 0 20
+CNSTI4 605
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $227
+endproc trap_LAN_GetServerAddressString 0 20
+export trap_LAN_GetServerInfo
+proc trap_LAN_GetServerInfo 0 20
+CNSTI4 606
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $228
+endproc trap_LAN_GetServerInfo 0 20
+export trap_LAN_GetServerPing
+proc trap_LAN_GetServerPing 4 12
+CNSTI4 615
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $229
+endproc trap_LAN_GetServerPing 4 12
+export trap_LAN_ServerStatus
+proc trap_LAN_ServerStatus 4 16
+CNSTI4 614
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $230
+endproc trap_LAN_ServerStatus 4 16
+export trap_LAN_SaveCachedServers
+proc trap_LAN_SaveCachedServers 0 4
+CNSTI4 611
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $231
+endproc trap_LAN_SaveCachedServers 0 4
+export trap_LAN_LoadCachedServers
+proc trap_LAN_LoadCachedServers 0 4
+CNSTI4 610
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $232
+endproc trap_LAN_LoadCachedServers 0 4
+export trap_LAN_ResetPings
+proc trap_LAN_ResetPings 0 8
+CNSTI4 609
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $233
+endproc trap_LAN_ResetPings 0 8
+export trap_LAN_MarkServerVisible
+proc trap_LAN_MarkServerVisible 0 16
+CNSTI4 607
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $234
+endproc trap_LAN_MarkServerVisible 0 16
+export trap_LAN_ServerIsVisible
+proc trap_LAN_ServerIsVisible 4 12
+CNSTI4 616
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $235
+endproc trap_LAN_ServerIsVisible 4 12
+export trap_LAN_UpdateVisiblePings
+proc trap_LAN_UpdateVisiblePings 4 8
+CNSTI4 608
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $236
+endproc trap_LAN_UpdateVisiblePings 4 8
+export trap_LAN_AddServer
+proc trap_LAN_AddServer 4 16
+CNSTI4 612
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $237
+endproc trap_LAN_AddServer 4 16
+export trap_LAN_RemoveServer
+proc trap_LAN_RemoveServer 0 12
+CNSTI4 613
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $238
+endproc trap_LAN_RemoveServer 0 12
+export trap_LAN_CompareServers
+proc trap_LAN_CompareServers 4 24
+CNSTI4 617
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $239
+endproc trap_LAN_CompareServers 4 24
+export trap_LAN_ServerIsInFavoriteList
+proc trap_LAN_ServerIsInFavoriteList 4 12
+CNSTI4 618
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $240
+endproc trap_LAN_ServerIsInFavoriteList 4 12
+export trap_PC_AddGlobalDefine
+proc trap_PC_AddGlobalDefine 4 8
+CNSTI4 33
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $241
+endproc trap_PC_AddGlobalDefine 4 8
+export trap_PC_RemoveGlobalDefine
+proc trap_PC_RemoveGlobalDefine 4 8
+CNSTI4 34
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $242
+endproc trap_PC_RemoveGlobalDefine 4 8
+export trap_PC_RemoveAllGlobalDefines
+proc trap_PC_RemoveAllGlobalDefines 0 4
+CNSTI4 35
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $243
+endproc trap_PC_RemoveAllGlobalDefines 0 4
+export trap_PC_LoadSource
+proc trap_PC_LoadSource 4 12
+CNSTI4 36
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $244
+endproc trap_PC_LoadSource 4 12
+export trap_PC_FreeSource
+proc trap_PC_FreeSource 4 8
+CNSTI4 37
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $245
+endproc trap_PC_FreeSource 4 8
+export trap_PC_AddDefine
+proc trap_PC_AddDefine 4 12
+CNSTI4 38
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $246
+endproc trap_PC_AddDefine 4 12
+export trap_PC_ReadToken
+proc trap_PC_ReadToken 4 12
+CNSTI4 39
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $247
+endproc trap_PC_ReadToken 4 12
+export trap_PC_UnreadToken
+proc trap_PC_UnreadToken 0 8
+CNSTI4 40
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $248
+endproc trap_PC_UnreadToken 0 8
+export trap_PC_SourceFileAndLine
+proc trap_PC_SourceFileAndLine 4 16
+CNSTI4 41
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $249
+endproc trap_PC_SourceFileAndLine 4 16
+export trap_HeapMalloc
+proc trap_HeapMalloc 4 8
+CNSTI4 42
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUP4 4
+RETP4
+LABELV $250
+endproc trap_HeapMalloc 4 8
+export trap_HeapAvailable
+proc trap_HeapAvailable 4 4
+CNSTI4 43
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $251
+endproc trap_HeapAvailable 4 4
+export trap_HeapFree
+proc trap_HeapFree 0 8
+CNSTI4 44
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $252
+endproc trap_HeapFree 0 8
+export trap_Field_CompleteFilename
+proc trap_Field_CompleteFilename 0 20
+CNSTI4 45
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $253
+endproc trap_Field_CompleteFilename 0 20
+export trap_Field_CompleteCommand
+proc trap_Field_CompleteCommand 0 16
+CNSTI4 46
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $254
+endproc trap_Field_CompleteCommand 0 16
+export trap_Field_CompleteList
+proc trap_Field_CompleteList 0 8
+CNSTI4 47
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $255
+endproc trap_Field_CompleteList 0 8
+export trap_RealTime
+proc trap_RealTime 4 8
+CNSTI4 3
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $256
+endproc trap_RealTime 4 8
+export trap_SnapVector
+proc trap_SnapVector 0 8
+CNSTI4 4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $257
+endproc trap_SnapVector 0 8
+export trap_CIN_PlayCinematic
+proc trap_CIN_PlayCinematic 4 28
+CNSTI4 700
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $258
+endproc trap_CIN_PlayCinematic 4 28
+export trap_CIN_StopCinematic
+proc trap_CIN_StopCinematic 4 8
+CNSTI4 701
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $259
+endproc trap_CIN_StopCinematic 4 8
+export trap_CIN_RunCinematic
+proc trap_CIN_RunCinematic 4 8
+CNSTI4 702
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $260
+endproc trap_CIN_RunCinematic 4 8
+export trap_CIN_DrawCinematic
+proc trap_CIN_DrawCinematic 0 8
+CNSTI4 703
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $261
+endproc trap_CIN_DrawCinematic 0 8
+export trap_CIN_SetExtents
+proc trap_CIN_SetExtents 0 24
+CNSTI4 704
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $262
+endproc trap_CIN_SetExtents 0 24
+import syscall
+import CG_AddCustomSurface
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
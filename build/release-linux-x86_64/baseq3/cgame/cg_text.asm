@@ -0,0 +1,5825 @@
+data
+align 4
+LABELV lastTextColor
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export CG_HudTextInit
+code
+proc CG_HudTextInit 20 16
+ADDRGP4 cg_hudFont+16
+ARGP4
+CNSTI4 8
+ARGI4
+CNSTF4 1056964608
+ADDRGP4 cg_hudFontBorder+8
+INDIRF4
+MULF4
+ARGF4
+ADDRGP4 cgs+679680
+ARGP4
+ADDRLP4 0
+ADDRGP4 CG_InitTrueTypeFont
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $97
+ADDRGP4 cgs+679680
+ARGP4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_InitBitmapFont
+CALLV
+pop
+LABELV $97
+ADDRGP4 cg_hudFont+16
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 cg_hudFontBorder+8
+INDIRF4
+ARGF4
+ADDRGP4 cgs+679680+20556
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_InitTrueTypeFont
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $103
+ADDRGP4 cgs+679680+20556
+ARGP4
+CNSTI4 16
+ARGI4
+CNSTI4 8
+ARGI4
+ADDRGP4 CG_InitBitmapFont
+CALLV
+pop
+LABELV $103
+ADDRGP4 cg_hudFont+16
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 cg_hudFontBorder+8
+INDIRF4
+ARGF4
+ADDRGP4 cgs+679680+41112
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_InitTrueTypeFont
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $111
+ADDRGP4 cgs+679680+41112
+ARGP4
+ADDRLP4 12
+CNSTI4 16
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_InitBitmapFont
+CALLV
+pop
+LABELV $111
+ADDRGP4 cg_hudFont+16
+ARGP4
+CNSTI4 48
+ARGI4
+CNSTF4 1073741824
+ADDRGP4 cg_hudFontBorder+8
+INDIRF4
+MULF4
+ARGF4
+ADDRGP4 cgs+679680+61668
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_InitTrueTypeFont
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $119
+ADDRGP4 cgs+679680+61668
+ARGP4
+CNSTI4 48
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 CG_InitBitmapFont
+CALLV
+pop
+LABELV $119
+ADDRGP4 cg_numberFont+16
+ARGP4
+CNSTI4 48
+ARGI4
+ADDRGP4 cg_numberFontBorder+8
+INDIRF4
+ARGF4
+ADDRGP4 cgs+679680+82224
+ARGP4
+ADDRLP4 16
+ADDRGP4 CG_InitTrueTypeFont
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $127
+ADDRGP4 cgs+679680+82224
+ARGP4
+CNSTI4 48
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 CG_InitBitmapNumberFont
+CALLV
+pop
+LABELV $127
+LABELV $96
+endproc CG_HudTextInit 20 16
+export CG_InitBitmapFont
+proc CG_InitBitmapFont 40 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 $136
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20484
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $137
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 20480
+ADDP4
+CNSTF4 1077936128
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20548
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20552
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $138
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+BANDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+RSHI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+BANDI4
+ASGNI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 16
+ASGNI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+CNSTI4 16
+ASGNI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+CNSTF4 1098907648
+ADDRLP4 4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+CNSTF4 1098907648
+ADDRLP4 4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTF4 1098907648
+ADDRLP4 4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 16
+ASGNI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 28
+ADDP4
+CNSTF4 1031798784
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 32
+ADDP4
+CNSTF4 1031798784
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1031798784
+ASGNF4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1031798784
+ASGNF4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 40
+ADDP4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 44
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $139
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $138
+LABELV $135
+endproc CG_InitBitmapFont 40 20
+data
+align 4
+LABELV $143
+address $144
+address $145
+address $146
+address $147
+address $148
+address $149
+address $150
+address $151
+address $152
+address $153
+address $154
+export CG_InitBitmapNumberFont
+code
+proc CG_InitBitmapNumberFont 24 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 20556
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 20484
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $155
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 20480
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20548
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20552
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $156
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $143
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+NEI4 $160
+ADDRLP4 0
+CNSTI4 45
+ASGNI4
+ADDRGP4 $161
+JUMPV
+LABELV $160
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 48
+ADDI4
+ASGNI4
+LABELV $161
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 48
+ASGNI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+CNSTI4 48
+ASGNI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+CNSTF4 1111490560
+ADDRLP4 8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+CNSTF4 1111490560
+ADDRLP4 8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTF4 1111490560
+ADDRLP4 8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 48
+ASGNI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 32
+ADDP4
+CNSTF4 0
+ASGNF4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 44
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $157
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 11
+LTI4 $156
+LABELV $142
+endproc CG_InitBitmapNumberFont 24 20
+export CG_InitTrueTypeFont
+proc CG_InitTrueTypeFont 48 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_forceBitmapFonts+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $167
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $167
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $163
+LABELV $167
+CNSTI4 0
+RETI4
+ADDRGP4 $162
+JUMPV
+LABELV $163
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterFont
+CALLV
+pop
+ADDRFP4 12
+INDIRP4
+CNSTI4 20484
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $168
+CNSTI4 0
+RETI4
+ADDRGP4 $162
+JUMPV
+LABELV $168
+ADDRFP4 12
+INDIRP4
+CNSTI4 20552
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $170
+ADDRFP4 12
+INDIRP4
+CNSTI4 1040
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4960
+ADDP4
+ARGP4
+CNSTU4 80
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $170
+ADDRFP4 12
+INDIRP4
+CNSTI4 880
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 9920
+ADDP4
+ARGP4
+CNSTU4 80
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 12
+INDIRP4
+CNSTI4 924
+ADDP4
+ADDRGP4 cgs+679680+123336
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CNSTI4 900
+ADDP4
+CNSTF4 1056964608
+ADDRFP4 12
+INDIRP4
+CNSTI4 904
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CNSTI4 908
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 912
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 916
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 920
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 800
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 9920
+ADDP4
+ARGP4
+CNSTU4 80
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 12
+INDIRP4
+CNSTI4 844
+ADDP4
+ADDRGP4 cgs+679680+123336
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CNSTI4 820
+ADDP4
+CNSTF4 1056964608
+ADDRFP4 12
+INDIRP4
+CNSTI4 824
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CNSTI4 828
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 832
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 836
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 840
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 28
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 824
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 20548
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1111490560
+DIVF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+DIVF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 44
+ADDRFP4 12
+INDIRP4
+CNSTI4 804
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+ADDRFP4 12
+INDIRP4
+CNSTI4 824
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+SUBI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CNSTI4 824
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $162
+endproc CG_InitTrueTypeFont 48 20
+export Text_GetGlyph
+proc Text_GetGlyph 4 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRU4
+ASGNU4
+ADDRFP4 4
+INDIRU4
+CNSTU4 0
+EQU4 $179
+ADDRFP4 4
+INDIRU4
+CNSTU4 256
+LTU4 $177
+LABELV $179
+ADDRFP4 0
+INDIRP4
+CNSTI4 3680
+ADDP4
+RETP4
+ADDRGP4 $176
+JUMPV
+LABELV $177
+CNSTU4 80
+ADDRFP4 4
+INDIRU4
+MULU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+RETP4
+LABELV $176
+endproc Text_GetGlyph 4 0
+export Text_Width
+proc Text_Width 48 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $181
+CNSTF4 0
+RETF4
+ADDRGP4 $180
+JUMPV
+LABELV $181
+ADDRLP4 20
+ADDRFP4 8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_UTF8_PrintStrlen
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+LEI4 $183
+ADDRLP4 12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $183
+ADDRLP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $183
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $186
+JUMPV
+LABELV $185
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $188
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $188
+ADDRLP4 36
+ADDRLP4 32
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $188
+ADDRLP4 36
+INDIRI4
+CNSTI4 48
+LTI4 $188
+ADDRLP4 36
+INDIRI4
+CNSTI4 55
+GTI4 $188
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $186
+JUMPV
+LABELV $188
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_UTF8_CodePoint
+CALLU4
+ASGNU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRU4
+ARGU4
+ADDRLP4 44
+ADDRGP4 Text_GetGlyph
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $186
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $191
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $191
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $185
+LABELV $191
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+RETF4
+LABELV $180
+endproc Text_Width 48 8
+export Text_Height
+proc Text_Height 48 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $193
+CNSTF4 0
+RETF4
+ADDRGP4 $192
+JUMPV
+LABELV $193
+ADDRLP4 20
+ADDRFP4 8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_UTF8_PrintStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+LEI4 $195
+ADDRLP4 16
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $195
+ADDRLP4 16
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $195
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $198
+JUMPV
+LABELV $197
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $200
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $200
+ADDRLP4 36
+ADDRLP4 32
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $200
+ADDRLP4 36
+INDIRI4
+CNSTI4 48
+LTI4 $200
+ADDRLP4 36
+INDIRI4
+CNSTI4 55
+GTI4 $200
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $198
+JUMPV
+LABELV $200
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_UTF8_CodePoint
+CALLU4
+ASGNU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRU4
+ARGU4
+ADDRLP4 44
+ADDRGP4 Text_GetGlyph
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CVIF4 4
+GEF4 $202
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $202
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $198
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $205
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $205
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $197
+LABELV $205
+ADDRLP4 12
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+RETF4
+LABELV $192
+endproc Text_Height 48 8
+export Text_PaintGlyph
+proc Text_PaintGlyph 4 40
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $207
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_DrawStretchPicGradient
+CALLV
+pop
+ADDRGP4 $208
+JUMPV
+LABELV $207
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $208
+LABELV $206
+endproc Text_PaintGlyph 4 40
+export Text_Paint
+proc Text_Paint 164 24
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 36
+ADDRFP4 36
+INDIRF4
+ASGNF4
+ADDRFP4 40
+ADDRFP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $210
+ADDRGP4 $209
+JUMPV
+LABELV $210
+ADDRLP4 80
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 72
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 84
+ADDRFP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 88
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 84
+INDIRF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 92
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 84
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+CNSTI4 20480
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 96
+INDIRF4
+ADDRLP4 100
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 96
+INDIRF4
+ADDRLP4 100
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $212
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 104
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRFP4 0
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 108
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRFP4 4
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 112
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 116
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 116
+INDIRF4
+ASGNF4
+LABELV $212
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 8
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor+4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 36
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 112
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 112
+INDIRF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8+4
+INDIRF4
+ADDRFP4 36
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 116
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 40+4
+ADDRLP4 116
+INDIRF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8+8
+INDIRF4
+ADDRFP4 36
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 120
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 40+8
+ADDRLP4 120
+INDIRF4
+ASGNF4
+ADDRLP4 40+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 Q_UTF8_PrintStrlen
+CALLI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+LEI4 $225
+ADDRLP4 68
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LEI4 $225
+ADDRLP4 68
+ADDRFP4 28
+INDIRI4
+ASGNI4
+LABELV $225
+ADDRLP4 0
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 $228
+JUMPV
+LABELV $227
+ADDRLP4 132
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $230
+ADDRLP4 132
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $230
+ADDRLP4 136
+ADDRLP4 132
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $230
+ADDRLP4 136
+INDIRI4
+CNSTI4 48
+LTI4 $230
+ADDRLP4 136
+INDIRI4
+CNSTI4 55
+GTI4 $230
+ADDRFP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $232
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 lastTextColor
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor+4
+ADDRLP4 8+4
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor+8
+ADDRLP4 8+8
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor+12
+ADDRLP4 8+12
+INDIRF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 36
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 140
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 140
+INDIRF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8+4
+INDIRF4
+ADDRFP4 36
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 144
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 40+4
+ADDRLP4 144
+INDIRF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8+8
+INDIRF4
+ADDRFP4 36
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 148
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 40+8
+ADDRLP4 148
+INDIRF4
+ASGNF4
+ADDRLP4 40+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $232
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $228
+JUMPV
+LABELV $230
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ADDRGP4 Q_UTF8_CodePoint
+CALLU4
+ASGNU4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRU4
+ARGU4
+ADDRLP4 144
+ADDRGP4 Text_GetGlyph
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 28
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 24
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 152
+CNSTF4 0
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 152
+INDIRF4
+NEF4 $248
+ADDRLP4 64
+INDIRF4
+ADDRLP4 152
+INDIRF4
+EQF4 $246
+LABELV $248
+ADDRGP4 colorBlack+12
+ADDRLP4 8+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ADDRLP4 60
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ADDRLP4 64
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 Text_PaintGlyph
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 colorBlack+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $246
+ADDRFP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRF4
+CNSTF4 0
+EQF4 $253
+ADDRLP4 156
+ADDRLP4 40
+ASGNP4
+ADDRGP4 $254
+JUMPV
+LABELV $253
+ADDRLP4 156
+CNSTP4 0
+ASGNP4
+LABELV $254
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRGP4 Text_PaintGlyph
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRFP4 24
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $228
+ADDRLP4 132
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $256
+ADDRLP4 132
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $256
+ADDRLP4 56
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $227
+LABELV $256
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $209
+endproc Text_Paint 164 24
+export Text_PaintWithCursor
+proc Text_PaintWithCursor 188 24
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 32
+ADDRFP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 44
+ADDRFP4 44
+INDIRF4
+ASGNF4
+ADDRFP4 48
+ADDRFP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $258
+ADDRGP4 $257
+JUMPV
+LABELV $258
+ADDRLP4 84
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 76
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 88
+ADDRFP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 92
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 88
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 88
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 32
+ADDRFP4 32
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 100
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+CNSTI4 20480
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 100
+INDIRF4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 100
+INDIRF4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $260
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 108
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRFP4 0
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 112
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRFP4 4
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 116
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 120
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 120
+INDIRF4
+ASGNF4
+LABELV $260
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 8
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor+4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 44
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 116
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 116
+INDIRF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8+4
+INDIRF4
+ADDRFP4 44
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 120
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 44+4
+ADDRLP4 120
+INDIRF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8+8
+INDIRF4
+ADDRFP4 44
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 124
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 44+8
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 44+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 Q_UTF8_Strlen
+CALLI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRFP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+LEI4 $273
+ADDRLP4 72
+INDIRI4
+ADDRLP4 132
+INDIRI4
+LEI4 $273
+ADDRLP4 72
+ADDRFP4 36
+INDIRI4
+ASGNI4
+LABELV $273
+ADDRLP4 4
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRI1
+CVII4 1
+CVIU4 4
+ARGU4
+ADDRLP4 136
+ADDRGP4 Text_GetGlyph
+CALLP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRGP4 $276
+JUMPV
+LABELV $275
+ADDRLP4 140
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $278
+ADDRLP4 140
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $278
+ADDRLP4 144
+ADDRLP4 140
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $278
+ADDRLP4 144
+INDIRI4
+CNSTI4 48
+LTI4 $278
+ADDRLP4 144
+INDIRI4
+CNSTI4 55
+GTI4 $278
+ADDRFP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $280
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 lastTextColor
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor+4
+ADDRLP4 8+4
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor+8
+ADDRLP4 8+8
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor+12
+ADDRLP4 8+12
+INDIRF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 44
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 148
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 148
+INDIRF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8+4
+INDIRF4
+ADDRFP4 44
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 152
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 44+4
+ADDRLP4 152
+INDIRF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8+8
+INDIRF4
+ADDRFP4 44
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 156
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 44+8
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 44+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $280
+LABELV $278
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 Q_UTF8_CodePoint
+CALLU4
+ASGNU4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRU4
+ARGU4
+ADDRLP4 152
+ADDRGP4 Text_GetGlyph
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 24
+INDIRI4
+NEI4 $294
+ADDRGP4 cg+512308
+INDIRI4
+CNSTI4 200
+DIVI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $294
+ADDRLP4 36
+ADDRLP4 32
+INDIRF4
+ADDRLP4 60
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 60
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 Text_PaintGlyph
+CALLV
+pop
+LABELV $294
+ADDRLP4 36
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 28
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 160
+CNSTF4 0
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 160
+INDIRF4
+NEF4 $299
+ADDRLP4 68
+INDIRF4
+ADDRLP4 160
+INDIRF4
+EQF4 $297
+LABELV $299
+ADDRGP4 colorBlack+12
+ADDRLP4 8+12
+INDIRF4
+ASGNF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ADDRLP4 64
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ADDRLP4 68
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 Text_PaintGlyph
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 colorBlack+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $297
+ADDRLP4 24
+INDIRI4
+ADDRFP4 24
+INDIRI4
+NEI4 $303
+ADDRGP4 cg+512308
+INDIRI4
+CNSTI4 200
+DIVI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $303
+ADDRFP4 28
+INDIRI1
+CVII4 1
+CNSTI4 11
+NEI4 $303
+ADDRLP4 180
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 164
+ADDRLP4 180
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 8+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+8
+CNSTF4 1065353216
+ADDRLP4 8+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 164+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 164
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 Text_PaintGlyph
+CALLV
+pop
+ADDRGP4 $304
+JUMPV
+LABELV $303
+ADDRFP4 0
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 44
+INDIRF4
+CNSTF4 0
+EQF4 $312
+ADDRLP4 164
+ADDRLP4 44
+ASGNP4
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRLP4 164
+CNSTP4 0
+ASGNP4
+LABELV $313
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRGP4 Text_PaintGlyph
+CALLV
+pop
+LABELV $304
+ADDRLP4 24
+INDIRI4
+ADDRFP4 24
+INDIRI4
+NEI4 $314
+ADDRGP4 cg+512308
+INDIRI4
+CNSTI4 200
+DIVI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $314
+ADDRFP4 28
+INDIRI1
+CVII4 1
+CNSTI4 11
+NEI4 $314
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $314
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDRFP4 32
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $276
+ADDRLP4 140
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $318
+ADDRLP4 140
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $318
+ADDRLP4 24
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LTI4 $275
+LABELV $318
+ADDRFP4 24
+INDIRI4
+ADDRLP4 72
+INDIRI4
+NEI4 $319
+ADDRGP4 cg+512308
+INDIRI4
+CNSTI4 200
+DIVI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $319
+ADDRLP4 36
+ADDRLP4 32
+INDIRF4
+ADDRLP4 60
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 60
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 60
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 Text_PaintGlyph
+CALLV
+pop
+LABELV $319
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $257
+endproc Text_PaintWithCursor 188 24
+export Text_Paint_Limit
+proc Text_Paint_Limit 128 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 64
+CNSTU4 0
+ASGNU4
+ADDRFP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 64
+INDIRU4
+EQU4 $325
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 64
+INDIRU4
+NEU4 $323
+LABELV $325
+ADDRGP4 $322
+JUMPV
+LABELV $323
+ADDRLP4 68
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 56
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 52
+ARGP4
+ADDRLP4 72
+CNSTP4 0
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRFP4 28
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 48
+ARGP4
+ADDRLP4 76
+CNSTP4 0
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 80
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 84
+ADDRFP4 12
+INDIRP4
+CNSTI4 20480
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 80
+INDIRF4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 80
+INDIRF4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 60
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $326
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRFP4 4
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 92
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRFP4 8
+ADDRLP4 92
+INDIRF4
+ASGNF4
+LABELV $326
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 lastTextColor
+ADDRFP4 20
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor+4
+ADDRFP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor+8
+ADDRFP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor+12
+ADDRFP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 Q_UTF8_PrintStrlen
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+LEI4 $331
+ADDRLP4 44
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LEI4 $331
+ADDRLP4 44
+ADDRFP4 32
+INDIRI4
+ASGNI4
+LABELV $331
+ADDRLP4 0
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 $334
+JUMPV
+LABELV $333
+ADDRLP4 100
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $336
+ADDRLP4 100
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $336
+ADDRLP4 104
+ADDRLP4 100
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+EQI4 $336
+ADDRLP4 104
+INDIRI4
+CNSTI4 48
+LTI4 $336
+ADDRLP4 104
+INDIRI4
+CNSTI4 55
+GTI4 $336
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+12
+ADDRFP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 lastTextColor
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor+4
+ADDRLP4 12+4
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor+8
+ADDRLP4 12+8
+INDIRF4
+ASGNF4
+ADDRGP4 lastTextColor+12
+ADDRLP4 12+12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $334
+JUMPV
+LABELV $336
+ADDRLP4 0
+ARGP4
+ADDRLP4 108
+ADDRGP4 Q_UTF8_CodePoint
+CALLU4
+ASGNU4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 108
+INDIRU4
+ARGU4
+ADDRLP4 112
+ADDRGP4 Text_GetGlyph
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 112
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 48
+INDIRF4
+LEF4 $345
+ADDRFP4 4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRGP4 $335
+JUMPV
+LABELV $345
+ADDRLP4 36
+ADDRLP4 32
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 8
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 8
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 Text_PaintGlyph
+CALLV
+pop
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDRFP4 28
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $334
+ADDRLP4 100
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $348
+ADDRLP4 100
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $348
+ADDRLP4 28
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LTI4 $333
+LABELV $348
+LABELV $335
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+ADDRLP4 56
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $322
+endproc Text_Paint_Limit 128 24
+export Text_Paint_AutoWrapped
+proc Text_Paint_AutoWrapped 7276 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 32
+ADDRFP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 36
+ADDRFP4 36
+INDIRF4
+ASGNF4
+ADDRFP4 40
+ADDRFP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 44
+ADDRFP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 48
+ADDRFP4 48
+INDIRF4
+ASGNF4
+ADDRFP4 52
+ADDRFP4 52
+INDIRF4
+ASGNF4
+ADDRFP4 56
+ADDRFP4 56
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $352
+ADDRFP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $350
+LABELV $352
+ADDRGP4 $349
+JUMPV
+LABELV $350
+ADDRLP4 2084
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 2084
+ASGNP4
+ADDRLP4 32
+ADDRLP4 2084
+ASGNP4
+ADDRLP4 3112
+ADDRLP4 2084
+ASGNP4
+ADDRLP4 36
+CNSTI1 0
+ASGNI1
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $354
+JUMPV
+LABELV $353
+LABELV $356
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 7224
+ADDRGP4 Q_UTF8_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 7224
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $357
+ADDRLP4 7224
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 7224
+INDIRI4
+CNSTI4 10
+EQI4 $360
+ADDRLP4 7224
+INDIRI4
+CNSTI4 32
+EQI4 $360
+ADDRLP4 7224
+INDIRI4
+CNSTI4 0
+NEI4 $356
+LABELV $360
+ADDRLP4 3108
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 3112
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 7232
+ADDRGP4 Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 3116
+ADDRLP4 7232
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 3108
+INDIRI1
+ASGNI1
+ADDRLP4 3116
+INDIRI4
+CVIF4 4
+ADDRFP4 48
+INDIRF4
+LEF4 $361
+ADDRLP4 3112
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+NEU4 $363
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $363
+ADDRLP4 32
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 36
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 3112
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRGP4 $365
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 24
+INDIRI4
+CNSTI4 1024
+GEI4 $366
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 3120
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $366
+ADDRLP4 3108
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $368
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 7236
+ADDRGP4 Q_UTF8_Width
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 7236
+INDIRI4
+ADDRLP4 32
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 7240
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 7240
+INDIRI4
+CNSTI4 0
+EQI4 $355
+ADDRLP4 7240
+INDIRI4
+CNSTI4 10
+EQI4 $355
+ADDRLP4 36
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRGP4 $365
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 24
+INDIRI4
+CNSTI4 1024
+GEI4 $355
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 3120
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $355
+JUMPV
+LABELV $368
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 7236
+ADDRGP4 Q_UTF8_Width
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 7236
+INDIRI4
+ADDRLP4 32
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 3112
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 $362
+JUMPV
+LABELV $361
+ADDRLP4 3108
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $374
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 36
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 3112
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRGP4 $365
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 24
+INDIRI4
+CNSTI4 1024
+GEI4 $376
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 3120
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $376
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 7236
+ADDRGP4 Q_UTF8_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 7236
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 3112
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $375
+ADDRGP4 $355
+JUMPV
+LABELV $374
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 3108
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $380
+ADDRLP4 36
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 3112
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRGP4 $365
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 24
+INDIRI4
+CNSTI4 1024
+GEI4 $355
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 3120
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $355
+JUMPV
+LABELV $380
+LABELV $375
+LABELV $362
+LABELV $354
+ADDRGP4 $353
+JUMPV
+LABELV $355
+ADDRLP4 7224
+ADDRFP4 56
+INDIRI4
+CNSTI4 240
+BANDI4
+ASGNI4
+ADDRLP4 7232
+CNSTI4 32
+ASGNI4
+ADDRLP4 7224
+INDIRI4
+ADDRLP4 7232
+INDIRI4
+EQI4 $387
+ADDRLP4 7224
+INDIRI4
+ADDRLP4 7232
+INDIRI4
+GTI4 $391
+LABELV $390
+ADDRLP4 7224
+INDIRI4
+CNSTI4 16
+EQI4 $385
+ADDRGP4 $385
+JUMPV
+LABELV $391
+ADDRLP4 7224
+INDIRI4
+CNSTI4 48
+EQI4 $388
+ADDRGP4 $385
+JUMPV
+LABELV $387
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ADDRFP4 52
+INDIRF4
+MULF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $385
+JUMPV
+LABELV $388
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ADDRFP4 52
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $385
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 36
+ASGNP4
+ADDRLP4 36
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 7240
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 7240
+INDIRP4
+ASGNP4
+ADDRGP4 $396
+JUMPV
+LABELV $395
+ADDRLP4 2084
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 2084
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 7248
+ADDRFP4 56
+INDIRI4
+CNSTI4 15
+BANDI4
+ASGNI4
+ADDRLP4 7248
+INDIRI4
+CNSTI4 1
+EQI4 $403
+ADDRLP4 7248
+INDIRI4
+CNSTI4 2
+EQI4 $401
+ADDRLP4 7248
+INDIRI4
+CNSTI4 3
+EQI4 $402
+ADDRGP4 $398
+JUMPV
+LABELV $401
+ADDRLP4 2084
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 7256
+ADDRGP4 Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 7216
+ADDRFP4 0
+INDIRF4
+ADDRLP4 7256
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $399
+JUMPV
+LABELV $402
+ADDRLP4 2084
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 7260
+ADDRGP4 Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 7216
+ADDRFP4 0
+INDIRF4
+ADDRLP4 7260
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $399
+JUMPV
+LABELV $403
+LABELV $398
+ADDRLP4 7216
+ADDRFP4 0
+INDIRF4
+ASGNF4
+LABELV $399
+ADDRLP4 7216
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 2084
+ARGP4
+ADDRFP4 24
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 32
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRFP4 40
+INDIRI4
+ARGI4
+ADDRFP4 44
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 52
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1024
+GEI4 $406
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 3120
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $404
+LABELV $406
+ADDRLP4 8
+ADDRGP4 lastTextColor
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRGP4 lastTextColor+4
+INDIRF4
+ASGNF4
+ADDRLP4 8+8
+ADDRGP4 lastTextColor+8
+INDIRF4
+ASGNF4
+ADDRLP4 8+12
+ADDRGP4 lastTextColor+12
+INDIRF4
+ASGNF4
+ADDRGP4 $405
+JUMPV
+LABELV $404
+ADDRLP4 8
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $405
+ADDRLP4 7260
+CNSTI4 1
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 7260
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 7260
+INDIRI4
+ADDP4
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 7272
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 7272
+INDIRP4
+ASGNP4
+LABELV $396
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $416
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $395
+LABELV $416
+LABELV $349
+endproc Text_Paint_AutoWrapped 7276 48
+import Q_Unicode_ToLower
+import Q_Unicode_ToUpper
+import Q_Unicode_IsAlphaOrIdeoOrDigit
+import Q_Unicode_IsAlphaOrIdeo
+import Q_Unicode_IsIdeo
+import Q_Unicode_IsLower
+import Q_Unicode_IsUpper
+import Q_Unicode_IsAlpha
+import Q_UTF8_Unstore
+import Q_UTF8_Store
+import Q_UTF8_Encode
+import Q_UTF8_CodePoint
+import Q_UTF8_ContByte
+import Q_UTF8_PrintStrlen
+import Q_UTF8_Strlen
+import Q_UTF8_WidthCP
+import Q_UTF8_Width
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import CG_FontForScale
+import CG_AnyScoreboardShowing
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_drawScores
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $365
+byte 1 10
+byte 1 0
+align 1
+LABELV $155
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 95
+byte 1 37
+byte 1 100
+byte 1 120
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $154
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $153
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $152
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $151
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $150
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 105
+byte 1 120
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $149
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $148
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $147
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $146
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $145
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $144
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $137
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 95
+byte 1 37
+byte 1 100
+byte 1 120
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $136
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 0
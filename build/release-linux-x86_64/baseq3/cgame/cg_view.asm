@@ -0,0 +1,5839 @@
+export CG_TestModel_f
+code
+proc CG_TestModel_f 36 12
+ADDRGP4 cg+522856
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+522564
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 228
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 12
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+GEI4 $100
+ADDRGP4 $96
+JUMPV
+LABELV $100
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 cg+522792
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+522792
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cg+522564+8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 3
+NEI4 $106
+CNSTI4 2
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+522564+108
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 cg+522564+80
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+522564+100
+CNSTI4 0
+ASGNI4
+LABELV $106
+ADDRGP4 cg+522564+8
+INDIRI4
+CNSTI4 0
+NEI4 $114
+ADDRGP4 $118
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $96
+JUMPV
+LABELV $114
+ADDRGP4 cg+522564+68
+ADDRGP4 cg+512444+24
+INDIRF4
+CNSTF4 1120403456
+ADDRGP4 cg+512444+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+522564+68+4
+ADDRGP4 cg+512444+24+4
+INDIRF4
+CNSTF4 1120403456
+ADDRGP4 cg+512444+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+522564+68+8
+ADDRGP4 cg+512444+24+8
+INDIRF4
+CNSTF4 1120403456
+ADDRGP4 cg+512444+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+ADDRGP4 cg+512892+4
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+522564+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $96
+endproc CG_TestModel_f 36 12
+export CG_TestModelComplete
+proc CG_TestModelComplete 4 16
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $150
+ADDRGP4 $152
+ARGP4
+ADDRGP4 $153
+ARGP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_Field_CompleteFilename
+CALLV
+pop
+LABELV $150
+LABELV $149
+endproc CG_TestModelComplete 4 16
+export CG_TestGun_f
+proc CG_TestGun_f 0 0
+ADDRGP4 CG_TestModel_f
+CALLV
+pop
+ADDRGP4 cg+522564+8
+INDIRI4
+CNSTI4 0
+NEI4 $155
+ADDRGP4 $154
+JUMPV
+LABELV $155
+ADDRGP4 cg+522856
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+522564+4
+CNSTI4 12
+ASGNI4
+LABELV $154
+endproc CG_TestGun_f 0 0
+export CG_TestModelNextFrame_f
+proc CG_TestModelNextFrame_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+522564+80
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $165
+ARGP4
+ADDRGP4 cg+522564+80
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $162
+endproc CG_TestModelNextFrame_f 4 8
+export CG_TestModelPrevFrame_f
+proc CG_TestModelPrevFrame_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+522564+80
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+522564+80
+INDIRI4
+CNSTI4 0
+GEI4 $171
+ADDRGP4 cg+522564+80
+CNSTI4 0
+ASGNI4
+LABELV $171
+ADDRGP4 $165
+ARGP4
+ADDRGP4 cg+522564+80
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $168
+endproc CG_TestModelPrevFrame_f 4 8
+export CG_TestModelNextSkin_f
+proc CG_TestModelNextSkin_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+522564+112
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $182
+ARGP4
+ADDRGP4 cg+522564+112
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $179
+endproc CG_TestModelNextSkin_f 4 8
+export CG_TestModelPrevSkin_f
+proc CG_TestModelPrevSkin_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+522564+112
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+522564+112
+INDIRI4
+CNSTI4 0
+GEI4 $188
+ADDRGP4 cg+522564+112
+CNSTI4 0
+ASGNI4
+LABELV $188
+ADDRGP4 $182
+ARGP4
+ADDRGP4 cg+522564+112
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $185
+endproc CG_TestModelPrevSkin_f 4 8
+proc CG_AddTestModel 32 4
+ADDRGP4 cg+522792
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cg+522564+8
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+522564+8
+INDIRI4
+CNSTI4 0
+NEI4 $200
+ADDRGP4 $118
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $196
+JUMPV
+LABELV $200
+ADDRGP4 cg+522856
+INDIRI4
+CNSTI4 0
+EQI4 $204
+ADDRGP4 cg+522564+68
+ADDRGP4 cg+512444+24
+INDIRB
+ASGNB 12
+ADDRGP4 cg+522564+28
+ADDRGP4 cg+512444+36
+INDIRB
+ASGNB 12
+ADDRGP4 cg+522564+28+12
+ADDRGP4 cg+512444+36+12
+INDIRB
+ASGNB 12
+ADDRGP4 cg+522564+28+24
+ADDRGP4 cg+512444+36+24
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $227
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+522564+68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+512444+36
+ADDP4
+INDIRF4
+ADDRGP4 cg_gun_x+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+522564+68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+512444+36+12
+ADDP4
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+522564+68
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+512444+36+24
+ADDP4
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $228
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $227
+LABELV $204
+ADDRGP4 cg+522564
+ARGP4
+ADDRGP4 CG_AddRefEntityWithMinLight
+CALLV
+pop
+LABELV $196
+endproc CG_AddTestModel 32 4
+export CG_CalcVrect
+proc CG_CalcVrect 20 0
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+515616
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+515612
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+515620
+ADDRGP4 cgs+20100+35880
+INDIRI4
+ASGNI4
+ADDRGP4 cg+515624
+ADDRGP4 cgs+20100+35884
+INDIRI4
+ASGNI4
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 2
+NEI4 $258
+ADDRGP4 cg_splitviewVertical+12
+INDIRI4
+CNSTI4 0
+EQI4 $261
+ADDRLP4 8
+ADDRGP4 cg+515620
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 1
+NEI4 $259
+ADDRLP4 12
+ADDRGP4 cg+515612
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRGP4 cg+515620
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $259
+JUMPV
+LABELV $261
+ADDRLP4 8
+ADDRGP4 cg+515624
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 1
+NEI4 $259
+ADDRLP4 12
+ADDRGP4 cg+515616
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRGP4 cg+515624
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $259
+JUMPV
+LABELV $258
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 3
+NEI4 $276
+ADDRGP4 cg_splitviewThirdEqual+12
+INDIRI4
+CNSTI4 0
+NEI4 $276
+ADDRGP4 cg_splitviewVertical+12
+INDIRI4
+CNSTI4 0
+EQI4 $280
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 2
+NEI4 $283
+ADDRLP4 8
+ADDRGP4 cg+515620
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+515612
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRGP4 cg+515620
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $277
+JUMPV
+LABELV $283
+ADDRLP4 8
+ADDRGP4 cg+515620
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+515624
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 1
+NEI4 $277
+ADDRLP4 16
+ADDRGP4 cg+515616
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ADDRGP4 cg+515624
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $277
+JUMPV
+LABELV $280
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 2
+NEI4 $296
+ADDRLP4 8
+ADDRGP4 cg+515624
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+515616
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRGP4 cg+515624
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $277
+JUMPV
+LABELV $296
+ADDRLP4 8
+ADDRGP4 cg+515620
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+515624
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 1
+NEI4 $277
+ADDRLP4 16
+ADDRGP4 cg+515612
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ADDRGP4 cg+515620
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 1
+LEI4 $309
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 4
+GTI4 $309
+ADDRLP4 8
+ADDRGP4 cg+515620
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+515624
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 1
+EQI4 $319
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 3
+NEI4 $315
+LABELV $319
+ADDRLP4 16
+ADDRGP4 cg+515612
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ADDRGP4 cg+515620
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $315
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 2
+EQI4 $326
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 3
+NEI4 $322
+LABELV $326
+ADDRLP4 16
+ADDRGP4 cg+515616
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ADDRGP4 cg+515624
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $322
+LABELV $309
+LABELV $277
+LABELV $259
+ADDRGP4 cgs+56032
+CNSTF4 986500301
+ADDRGP4 cg+515620
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRGP4 cgs+56036
+CNSTF4 990414985
+ADDRGP4 cg+515624
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+CNSTI4 480
+ADDRGP4 cg+515620
+INDIRI4
+MULI4
+CNSTI4 640
+ADDRGP4 cg+515624
+INDIRI4
+MULI4
+LEI4 $333
+ADDRGP4 cgs+56016
+ADDRGP4 cgs+56032
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+56020
+ADDRGP4 cgs+56036
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+56024
+CNSTF4 1056964608
+ADDRGP4 cg+515620
+INDIRI4
+CVIF4 4
+CNSTF4 1068149419
+ADDRGP4 cg+515624
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRGP4 cgs+56016
+ADDRGP4 cgs+56020
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+56028
+CNSTF4 0
+ASGNF4
+ADDRGP4 $334
+JUMPV
+LABELV $333
+ADDRGP4 cgs+56016
+ADDRGP4 cgs+56032
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+56020
+ADDRGP4 cgs+56036
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+56028
+CNSTF4 1056964608
+ADDRGP4 cg+515624
+INDIRI4
+CVIF4 4
+CNSTF4 1061158912
+ADDRGP4 cg+515620
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRGP4 cgs+56020
+ADDRGP4 cgs+56016
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+56024
+CNSTF4 0
+ASGNF4
+LABELV $334
+ADDRGP4 cgs+56040
+ADDRGP4 cg+515620
+INDIRI4
+CVIF4 4
+ADDRGP4 cgs+56016
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 cg+522864
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $364
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $360
+LABELV $364
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+ADDRGP4 $361
+JUMPV
+LABELV $360
+ADDRLP4 0
+ADDRGP4 cg_viewsize+12
+INDIRI4
+ASGNI4
+LABELV $361
+ADDRGP4 cg+512444+8
+ADDRGP4 cg+515620
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 100
+DIVI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg+512444+8
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 cg+512444+12
+ADDRGP4 cg+515624
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 100
+DIVI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+512444+12
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 cg+512444
+ADDRGP4 cg+515612
+INDIRI4
+ADDRGP4 cg+515620
+INDIRI4
+ADDRGP4 cg+512444+8
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ADDI4
+ASGNI4
+ADDRGP4 cg+512444+4
+ADDRGP4 cg+515616
+INDIRI4
+ADDRGP4 cg+515624
+INDIRI4
+ADDRGP4 cg+512444+12
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ADDI4
+ASGNI4
+LABELV $249
+endproc CG_CalcVrect 20 0
+export CG_StepOffset
+proc CG_StepOffset 8 0
+ADDRLP4 0
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 34468
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 200
+GEI4 $390
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 34464
+ADDP4
+INDIRF4
+CNSTI4 200
+ADDRLP4 0
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+ASGNF4
+LABELV $390
+LABELV $387
+endproc CG_StepOffset 8 0
+data
+align 4
+LABELV $394
+byte 4 3231711232
+byte 4 3231711232
+byte 4 3231711232
+align 4
+LABELV $395
+byte 4 1084227584
+byte 4 1084227584
+byte 4 1084227584
+code
+proc CG_OffsetThirdPersonView 204 28
+ADDRLP4 156
+ADDRGP4 cg+512444+24+8
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 cg+512892
+INDIRB
+ASGNB 12
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35960
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $401
+ADDRLP4 72
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35964
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35968
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 160
+CNSTF4 0
+ASGNF4
+ADDRLP4 40
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRGP4 cg+512892
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRGP4 $402
+JUMPV
+LABELV $401
+ADDRLP4 160
+CNSTI4 272
+ASGNI4
+ADDRLP4 72
+ADDRLP4 160
+INDIRI4
+ADDRGP4 cg+522868
+INDIRI4
+MULI4
+ADDRGP4 cg_thirdPersonAngle+8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 160
+INDIRI4
+ADDRGP4 cg+522868
+INDIRI4
+MULI4
+ADDRGP4 cg_thirdPersonRange+8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $411
+ADDRLP4 40+4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 cg+512892+4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $411
+LABELV $402
+ADDRLP4 40
+INDIRF4
+CNSTF4 1110704128
+LEF4 $419
+ADDRLP4 40
+CNSTF4 1110704128
+ASGNF4
+LABELV $419
+ADDRLP4 40
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 160
+CNSTP4 0
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+CNSTI4 272
+ADDRGP4 cg+522868
+INDIRI4
+MULI4
+ADDRGP4 cg_thirdPersonSmooth+12
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $421
+ADDRGP4 cg+512444+24
+ARGP4
+ADDRGP4 CG_StepOffset
+CALLV
+pop
+LABELV $421
+ADDRLP4 164
+CNSTF4 1140850688
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg+512444+24
+INDIRF4
+ADDRLP4 164
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRGP4 cg+512444+24+4
+INDIRF4
+ADDRLP4 164
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRGP4 cg+512444+24+8
+INDIRF4
+CNSTF4 1140850688
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+512444+24
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTI4 272
+ADDRGP4 cg+522868
+INDIRI4
+MULI4
+ADDRGP4 cg_thirdPersonHeight+8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 168
+ADDRGP4 cg+512892
+ASGNP4
+ADDRLP4 168
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 168
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+512892
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+CNSTF4 1078530011
+ADDRLP4 72
+INDIRF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 172
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 172
+INDIRF4
+ASGNF4
+CNSTF4 1078530011
+ADDRLP4 72
+INDIRF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 176
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 176
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 36
+INDIRF4
+NEGF4
+ADDRLP4 64
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+NEGF4
+ADDRLP4 64
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 36
+INDIRF4
+NEGF4
+ADDRLP4 68
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 184
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 184
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+NEGF4
+ADDRLP4 68
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_cameraMode+12
+INDIRI4
+CNSTI4 0
+NEI4 $458
+ADDRLP4 80
+ARGP4
+ADDRGP4 cg+512444+24
+ARGP4
+ADDRGP4 $394
+ARGP4
+ADDRGP4 $395
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 80+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $464
+ADDRLP4 0
+ADDRLP4 80+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1107296256
+CNSTF4 1065353216
+ADDRLP4 80+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+ARGP4
+ADDRGP4 cg+512444+24
+ARGP4
+ADDRGP4 $394
+ARGP4
+ADDRGP4 $395
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 80+12
+INDIRB
+ASGNB 12
+LABELV $464
+LABELV $458
+ADDRGP4 cg+512444+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg+512444+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRGP4 cg+512444+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+ADDRGP4 cg+512444+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 188
+INDIRF4
+ADDRLP4 188
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 192
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+CNSTF4 1065353216
+GEF4 $490
+ADDRLP4 76
+CNSTF4 1065353216
+ASGNF4
+LABELV $490
+ADDRLP4 12+8
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 196
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRGP4 cg+512892
+CNSTF4 3261411041
+ADDRLP4 196
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 200
+ADDRGP4 cg+512892+4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ADDRLP4 200
+INDIRP4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $393
+endproc CG_OffsetThirdPersonView 204 28
+proc CG_OffsetFirstPersonView 76 4
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $497
+ADDRGP4 $496
+JUMPV
+LABELV $497
+ADDRGP4 cg+512908
+ADDRGP4 cg+512444+24
+INDIRB
+ASGNB 12
+ADDRGP4 cg+512920
+ADDRGP4 cg+512892
+INDIRB
+ASGNB 12
+ADDRLP4 4
+ADDRGP4 cg+512908
+ASGNP4
+ADDRLP4 8
+ADDRGP4 cg+512920
+ASGNP4
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $507
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTF4 3245342720
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 $496
+JUMPV
+LABELV $507
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35868
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $512
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35944
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $512
+ADDRGP4 cg_viewkick+12
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $512
+ADDRLP4 24
+ADDRGP4 cg+512320
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35868
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1120403456
+GEF4 $519
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35912
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35916
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $520
+JUMPV
+LABELV $519
+ADDRLP4 24
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+CNSTF4 1137180672
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 0
+LEF4 $523
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35912
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35916
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $523
+LABELV $520
+LABELV $512
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35944
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $527
+ADDRGP4 cg_viewbob+12
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $527
+ADDRLP4 12
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg+512444+36
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRGP4 cg+512444+36+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+8
+INDIRF4
+ADDRGP4 cg+512444+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg_runpitch+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg+512444+36+12
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRGP4 cg+512444+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+8
+INDIRF4
+ADDRGP4 cg+512444+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg_runroll+8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+522560
+INDIRF4
+CNSTF4 1128792064
+LEF4 $560
+ADDRLP4 60
+ADDRGP4 cg+522560
+INDIRF4
+ASGNF4
+ADDRGP4 $561
+JUMPV
+LABELV $560
+ADDRLP4 60
+CNSTF4 1128792064
+ASGNF4
+LABELV $561
+ADDRLP4 36
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+522552
+INDIRF4
+ADDRGP4 cg_bobpitch+8
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $564
+ADDRLP4 0
+CNSTF4 1077936128
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $564
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+522552
+INDIRF4
+ADDRGP4 cg_bobroll+8
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $569
+ADDRLP4 0
+CNSTF4 1077936128
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $569
+ADDRGP4 cg+522556
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $572
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $572
+ADDRLP4 68
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRGP4 cg+522552
+INDIRF4
+ADDRGP4 cg+522560
+INDIRF4
+MULF4
+ADDRGP4 cg_bobup+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1086324736
+LEF4 $578
+ADDRLP4 32
+CNSTF4 1086324736
+ASGNF4
+LABELV $578
+ADDRLP4 72
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $527
+ADDRLP4 52
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 34476
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 100
+GEI4 $583
+ADDRLP4 56
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 34472
+ADDP4
+INDIRF4
+CNSTI4 100
+ADDRLP4 28
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1120403456
+DIVF4
+SUBF4
+ASGNF4
+LABELV $583
+ADDRLP4 0
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 34484
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1125515264
+GEF4 $588
+ADDRLP4 40
+ADDRLP4 0
+INDIRF4
+CNSTF4 1125515264
+DIVF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 34480
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $589
+JUMPV
+LABELV $588
+ADDRLP4 0
+INDIRF4
+CNSTF4 1138819072
+GEF4 $591
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1125515264
+SUBF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRF4
+CNSTF4 1133903872
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 34480
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $591
+LABELV $589
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_StepOffset
+CALLV
+pop
+LABELV $496
+endproc CG_OffsetFirstPersonView 76 4
+export CG_ZoomDown_f
+proc CG_ZoomDown_f 4 0
+ADDRLP4 0
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35828
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $596
+ADDRGP4 $594
+JUMPV
+LABELV $596
+ADDRLP4 0
+INDIRP4
+CNSTI4 35828
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35832
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $594
+endproc CG_ZoomDown_f 4 0
+export CG_ZoomUp_f
+proc CG_ZoomUp_f 4 0
+ADDRLP4 0
+CNSTI4 39072
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35828
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $601
+ADDRGP4 $599
+JUMPV
+LABELV $601
+ADDRLP4 0
+INDIRP4
+CNSTI4 35828
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35832
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $599
+endproc CG_ZoomUp_f 4 0
+proc CG_CalcFov2 52 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $605
+ADDRLP4 28
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 0
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 $606
+JUMPV
+LABELV $605
+ADDRGP4 cgs+56100
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $608
+ADDRLP4 28
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 0
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 $609
+JUMPV
+LABELV $608
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $609
+ADDRLP4 24
+ADDRGP4 cg_zoomFov+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35828
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $612
+ADDRLP4 16
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35832
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1125515264
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $617
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $613
+JUMPV
+LABELV $617
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $613
+JUMPV
+LABELV $612
+ADDRLP4 16
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35832
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1125515264
+DIVF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+GTF4 $621
+ADDRLP4 28
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 28
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $621
+LABELV $613
+LABELV $606
+ADDRGP4 cg_fovAspectAdjust+12
+INDIRI4
+CNSTI4 0
+EQI4 $623
+ADDRLP4 28
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 0
+INDIRF4
+ASGNF4
+CNSTF4 1078530011
+ADDRLP4 36
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 atan
+CALLF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1135869952
+ADDRLP4 48
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+LABELV $623
+CNSTF4 1078530011
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1135869952
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $626
+ADDRLP4 20
+CNSTF4 1073741824
+CNSTF4 1078530011
+CNSTF4 1053609165
+ADDRGP4 cg+512320
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+MULF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1065353216
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $626
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $604
+endproc CG_CalcFov2 52 8
+proc CG_CalcFov 16 16
+ADDRGP4 cg+512444+24
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $632
+ADDRLP4 12
+ADDRGP4 cg+512444+76
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 $633
+JUMPV
+LABELV $632
+ADDRLP4 12
+ADDRGP4 cg+512444+76
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $633
+ADDRLP4 0
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg+512444
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+512444+16
+ARGP4
+ADDRGP4 cg+512444+20
+ARGP4
+ADDRGP4 CG_CalcFov2
+CALLV
+pop
+ADDRGP4 cg_weaponFov+8
+INDIRF4
+CNSTF4 0
+EQF4 $649
+ADDRLP4 12
+ADDRGP4 cg_weaponFov+8
+INDIRF4
+ASGNF4
+ADDRGP4 $650
+JUMPV
+LABELV $649
+ADDRLP4 12
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+LABELV $650
+ADDRGP4 cg+512904
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 cg+512444
+ARGP4
+ADDRGP4 cg+512904
+ARGP4
+ADDRGP4 cg+512444+440
+ARGP4
+ADDRGP4 cg+512444+444
+ARGP4
+ADDRGP4 CG_CalcFov2
+CALLV
+pop
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35828
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $657
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35836
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $658
+JUMPV
+LABELV $657
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35836
+ADDP4
+ADDRGP4 cg+512444+20
+INDIRF4
+CNSTF4 1117126656
+DIVF4
+ASGNF4
+LABELV $658
+ADDRGP4 cg+512444+76
+INDIRI4
+CNSTI4 2
+BANDI4
+RETI4
+LABELV $629
+endproc CG_CalcFov 16 16
+export CG_DrawSkyBoxPortal
+proc CG_DrawSkyBoxPortal 456 4
+ADDRLP4 448
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_skybox+12
+INDIRI4
+ADDRLP4 448
+INDIRI4
+EQI4 $671
+ADDRGP4 cg+515568
+INDIRI4
+ADDRLP4 448
+INDIRI4
+NEI4 $667
+LABELV $671
+ADDRGP4 $666
+JUMPV
+LABELV $667
+ADDRLP4 0
+ADDRGP4 cg+512444
+INDIRB
+ASGNB 448
+ADDRGP4 cg+512444+24
+ADDRGP4 cg+515572
+INDIRB
+ASGNB 12
+ADDRGP4 cg+515596
+INDIRI4
+CNSTI4 0
+LEI4 $676
+ADDRGP4 cg+512444+368
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg+512444+388
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 cg+512444+384
+ADDRGP4 cg+515596
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 cg+512444+436
+CNSTF4 0
+ASGNF4
+LABELV $676
+ADDRGP4 cg+512444+372
+ADDRGP4 cg+515584
+INDIRB
+ASGNB 12
+ADDRGP4 cg+512444+432
+ADDRGP4 cg+515600
+INDIRF4
+ASGNF4
+ADDRGP4 cg+512444+72
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRGP4 cg_skybox+12
+INDIRI4
+CNSTI4 2
+NEI4 $697
+ADDRLP4 452
+ADDRGP4 cg+512444+76
+ASGNP4
+ADDRLP4 452
+INDIRP4
+ADDRLP4 452
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $697
+ADDRGP4 cg+512444
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+ADDRGP4 cg+512444
+ADDRLP4 0
+INDIRB
+ASGNB 448
+ADDRLP4 452
+ADDRGP4 cg+512444+76
+ASGNP4
+ADDRLP4 452
+INDIRP4
+ADDRLP4 452
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $666
+endproc CG_DrawSkyBoxPortal 456 4
+proc CG_DamageBlendBlob 252 12
+ADDRGP4 cg_blood+12
+INDIRI4
+CNSTI4 0
+NEI4 $707
+ADDRGP4 $706
+JUMPV
+LABELV $707
+ADDRGP4 cgs+679680+124736
+INDIRI4
+CNSTI4 0
+NEI4 $710
+ADDRGP4 $706
+JUMPV
+LABELV $710
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35880
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $714
+ADDRGP4 $706
+JUMPV
+LABELV $714
+ADDRLP4 232
+CNSTI4 500
+ASGNI4
+ADDRLP4 228
+ADDRGP4 cg+512320
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35868
+ADDP4
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+LEI4 $721
+ADDRLP4 228
+INDIRI4
+ADDRLP4 232
+INDIRI4
+LTI4 $719
+LABELV $721
+ADDRGP4 $706
+JUMPV
+LABELV $719
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 228
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+68
+ADDRGP4 cg+512444+24
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+512444+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRGP4 cg+512444+24+4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+512444+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRGP4 cg+512444+24+8
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+512444+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+512444+36+12
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35872
+ADDP4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+512444+36+12+4
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35872
+ADDP4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+512444+36+12+8
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35872
+ADDP4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+512444+36+24
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35876
+ADDP4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+512444+36+24+4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35876
+ADDP4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+512444+36+24+8
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35876
+ADDP4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+152
+CNSTF4 1077936128
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35880
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+120
+ADDRGP4 cgs+679680+124736
+INDIRI4
+ASGNI4
+ADDRLP4 0+124
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+124+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+124+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 244
+CNSTF4 1128792064
+CNSTF4 1065353216
+ADDRLP4 228
+INDIRI4
+CVIF4 4
+ADDRLP4 232
+INDIRI4
+CVIF4 4
+DIVF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 248
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 248
+INDIRF4
+LTF4 $805
+ADDRLP4 240
+ADDRLP4 244
+INDIRF4
+ADDRLP4 248
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $806
+JUMPV
+LABELV $805
+ADDRLP4 240
+ADDRLP4 244
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $806
+ADDRLP4 0+124+3
+ADDRLP4 240
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $706
+endproc CG_DamageBlendBlob 252 12
+proc CG_CalcViewValues 40 12
+ADDRGP4 cg+512444
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 448
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 CG_CalcVrect
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $811
+ADDRGP4 cg+512444+24
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+512892
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+512892
+ARGP4
+ADDRGP4 cg+512444+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 CG_CalcFov
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $807
+JUMPV
+LABELV $811
+ADDRGP4 cg+522556
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 7
+RSHI4
+ASGNI4
+CNSTF4 1078530011
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 127
+BANDI4
+CVIF4 4
+CNSTF4 1123942400
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 cg+522552
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRGP4 cg+522560
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 cg+512444+24
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+512892
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35960
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $825
+ADDRLP4 28
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35964
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 981668463
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35960
+ADDP4
+INDIRF4
+ADDRGP4 cg+512316
+INDIRI4
+CVIF4 4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $825
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+CNSTF4 0
+LEF4 $831
+ADDRLP4 32
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 1364
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 0
+LEF4 $838
+ADDRLP4 36
+INDIRF4
+CNSTF4 1065353216
+GEF4 $838
+ADDRGP4 cg+512444+24
+ADDRGP4 cg+512444+24
+INDIRF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 1368
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+512444+24+4
+ADDRGP4 cg+512444+24+4
+INDIRF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 1372
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+512444+24+8
+ADDRGP4 cg+512444+24+8
+INDIRF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 1376
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $839
+JUMPV
+LABELV $838
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 1364
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $839
+LABELV $831
+ADDRGP4 CG_OffsetFirstPersonView
+CALLV
+pop
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35944
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $860
+ADDRGP4 CG_OffsetThirdPersonView
+CALLV
+pop
+ADDRGP4 $861
+JUMPV
+LABELV $860
+ADDRGP4 cg+512444+24
+ADDRGP4 cg+512908
+INDIRB
+ASGNB 12
+ADDRGP4 cg+512892
+ADDRGP4 cg+512920
+INDIRB
+ASGNB 12
+LABELV $861
+ADDRGP4 cg+512892
+ARGP4
+ADDRGP4 cg+512444+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg+512920
+ARGP4
+ADDRGP4 cg+512932
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $873
+ADDRLP4 28
+ADDRGP4 cg+512444+76
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 5
+BORI4
+ASGNI4
+LABELV $873
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35972
+ADDP4
+ADDRGP4 cg+512444+24
+INDIRF4
+ASGNF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35976
+ADDP4
+ADDRGP4 cg+512444+24+4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35980
+ADDP4
+ADDRGP4 cg+512444+24+8
+INDIRF4
+ASGNF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35988
+ADDP4
+ADDRGP4 cg+512892+4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35984
+ADDP4
+ADDRGP4 cg+512892
+INDIRF4
+ASGNF4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35992
+ADDP4
+ADDRGP4 cg+512892+8
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 CG_CalcFov
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+LABELV $807
+endproc CG_CalcViewValues 40 12
+proc CG_PowerupTimerSounds 16 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $898
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+GTI4 $903
+ADDRGP4 $899
+JUMPV
+LABELV $903
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+SUBI4
+CNSTI4 5000
+LTI4 $906
+ADDRGP4 $899
+JUMPV
+LABELV $906
+ADDRLP4 12
+CNSTI4 1000
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+512324
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+EQI4 $909
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+679680+126028
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $909
+LABELV $899
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+LTI4 $898
+LABELV $897
+endproc CG_PowerupTimerSounds 16 16
+export CG_AddBufferedSound
+proc CG_AddBufferedSound 4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $917
+ADDRGP4 $916
+JUMPV
+LABELV $917
+ADDRGP4 cg+522452
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+522464
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+522452
+ADDRGP4 cg+522452
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 20
+MODI4
+ASGNI4
+ADDRGP4 cg+522452
+INDIRI4
+ADDRGP4 cg+522456
+INDIRI4
+NEI4 $923
+ADDRLP4 0
+ADDRGP4 cg+522456
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $923
+LABELV $916
+endproc CG_AddBufferedSound 4 0
+proc CG_PlayBufferedSounds 0 8
+ADDRGP4 cg+522460
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+GEI4 $929
+ADDRGP4 cg+522456
+INDIRI4
+ADDRGP4 cg+522452
+INDIRI4
+EQI4 $933
+ADDRGP4 cg+522456
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+522464
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $933
+ADDRGP4 cg+522456
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+522464
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 cg+522456
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+522464
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+522456
+ADDRGP4 cg+522456
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 20
+MODI4
+ASGNI4
+ADDRGP4 cg+522460
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 750
+ADDI4
+ASGNI4
+LABELV $933
+LABELV $929
+LABELV $928
+endproc CG_PlayBufferedSounds 0 8
+export CG_SetupFrustum
+proc CG_SetupFrustum 48 4
+ADDRLP4 12
+CNSTF4 1056964608
+CNSTF4 1078530011
+ADDRGP4 cg+512444+16
+INDIRF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRGP4 frustum
+ADDRGP4 cg+512444+36
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+4
+ADDRGP4 cg+512444+36+4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+8
+ADDRGP4 cg+512444+36+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 frustum
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRGP4 cg+512444+36+12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+4
+ADDRGP4 frustum+4
+INDIRF4
+ADDRGP4 cg+512444+36+12+4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+8
+ADDRGP4 frustum+8
+INDIRF4
+ADDRGP4 cg+512444+36+12+8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+16
+ADDRGP4 cg+512444+36
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+16+4
+ADDRGP4 cg+512444+36+4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+16+8
+ADDRGP4 cg+512444+36+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+16
+ADDRGP4 frustum+16
+INDIRF4
+ADDRGP4 cg+512444+36+12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+16+4
+ADDRGP4 frustum+16+4
+INDIRF4
+ADDRGP4 cg+512444+36+12+4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+16+8
+ADDRGP4 frustum+16+8
+INDIRF4
+ADDRGP4 cg+512444+36+12+8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1056964608
+CNSTF4 1078530011
+ADDRGP4 cg+512444+20
+INDIRF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRGP4 frustum+32
+ADDRGP4 cg+512444+36
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+32+4
+ADDRGP4 cg+512444+36+4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+32+8
+ADDRGP4 cg+512444+36+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+32
+ADDRGP4 frustum+32
+INDIRF4
+ADDRGP4 cg+512444+36+24
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+32+4
+ADDRGP4 frustum+32+4
+INDIRF4
+ADDRGP4 cg+512444+36+24+4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+32+8
+ADDRGP4 frustum+32+8
+INDIRF4
+ADDRGP4 cg+512444+36+24+8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+48
+ADDRGP4 cg+512444+36
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+48+4
+ADDRGP4 cg+512444+36+4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+48+8
+ADDRGP4 cg+512444+36+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 frustum+48
+ADDRGP4 frustum+48
+INDIRF4
+ADDRGP4 cg+512444+36+24
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+48+4
+ADDRGP4 frustum+48+4
+INDIRF4
+ADDRGP4 cg+512444+36+24+4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 frustum+48+8
+ADDRGP4 frustum+48+8
+INDIRF4
+ADDRGP4 cg+512444+36+24+8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1079
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 frustum+12
+ADDP4
+ADDRGP4 cg+512444+24
+INDIRF4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 frustum
+ADDP4
+INDIRF4
+MULF4
+ADDRGP4 cg+512444+24+4
+INDIRF4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 frustum+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRGP4 cg+512444+24+8
+INDIRF4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 frustum+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1080
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $1079
+LABELV $947
+endproc CG_SetupFrustum 48 4
+export CG_CullPoint
+proc CG_CullPoint 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1095
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+ADDRGP4 frustum
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 0
+GEF4 $1099
+CNSTI4 1
+RETI4
+ADDRGP4 $1094
+JUMPV
+LABELV $1099
+LABELV $1096
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $1095
+CNSTI4 0
+RETI4
+LABELV $1094
+endproc CG_CullPoint 24 0
+export CG_CullPointAndRadius
+proc CG_CullPointAndRadius 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1102
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+ADDRGP4 frustum
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRF4
+NEGF4
+GEF4 $1106
+CNSTI4 1
+RETI4
+ADDRGP4 $1101
+JUMPV
+LABELV $1106
+LABELV $1103
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $1102
+CNSTI4 0
+RETI4
+LABELV $1101
+endproc CG_CullPointAndRadius 24 0
+export CG_DrawActiveFrame
+proc CG_DrawActiveFrame 72 20
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+512320
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+20
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+515632
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1111
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 $1108
+JUMPV
+LABELV $1111
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRGP4 CG_PB_ClearPolyBuffers
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_ProcessSnapshots
+CALLV
+pop
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1118
+ADDRGP4 cg+48
+INDIRP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1114
+LABELV $1118
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 $1108
+JUMPV
+LABELV $1114
+ADDRGP4 cg+516656
+INDIRI4
+CNSTI4 0
+NEI4 $1119
+ADDRGP4 CG_SetupDlightstyles
+CALLV
+pop
+LABELV $1119
+ADDRLP4 24
+ADDRGP4 cg+8
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1126
+JUMPV
+LABELV $1123
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1127
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $1127
+ADDRGP4 $1125
+JUMPV
+LABELV $1127
+LABELV $1124
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1126
+ADDRLP4 28
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $1123
+LABELV $1125
+ADDRLP4 36
+ADDRGP4 CG_NumLocalPlayers
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+LEI4 $1133
+ADDRLP4 40
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $1133
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1134
+JUMPV
+LABELV $1133
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+LABELV $1134
+ADDRGP4 cg+515628
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 cg+515604
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1139
+JUMPV
+LABELV $1136
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1140
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1137
+JUMPV
+LABELV $1140
+ADDRGP4 cg+522868
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+522860
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+ASGNP4
+ADDRGP4 cg+522864
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+ASGNP4
+ADDRGP4 cg+515628
+INDIRI4
+CNSTI4 0
+EQI4 $1148
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 1
+LTI4 $1148
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1149
+JUMPV
+LABELV $1148
+ADDRLP4 44
+ADDRGP4 cg+515604
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1149
+ADDRGP4 CG_PredictPlayerState
+CALLV
+pop
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 37068
+ADDP4
+INDIRI4
+ADDRGP4 cg_consoleLatency+12
+INDIRI4
+ADDI4
+ADDRGP4 cg+512320
+INDIRI4
+GEI4 $1153
+ADDRGP4 cg_consoleLatency+12
+INDIRI4
+CNSTI4 0
+LEI4 $1153
+ADDRGP4 cg+522860
+INDIRP4
+ARGP4
+ADDRGP4 CG_RemoveNotifyLine
+CALLV
+pop
+LABELV $1153
+LABELV $1137
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1139
+ADDRLP4 44
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LTI4 $1136
+ADDRGP4 cg+522868
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg+522860
+CNSTP4 0
+ASGNP4
+ADDRGP4 cg+522864
+CNSTP4 0
+ASGNP4
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 0
+NEI4 $1163
+ADDRGP4 cg+515604
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $1163
+ADDRGP4 CG_CheckGameSounds
+CALLV
+pop
+ADDRGP4 CG_PlayBufferedSounds
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+515608
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $1170
+JUMPV
+LABELV $1167
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1172
+ADDRGP4 $1168
+JUMPV
+LABELV $1172
+ADDRLP4 48
+ADDRGP4 cg+515608
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg+522868
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+522860
+CNSTI4 39072
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+522872
+ADDP4
+ASGNP4
+ADDRGP4 cg+522864
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+ASGNP4
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $1187
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+CNSTI4 272
+ADDRGP4 cg+522868
+INDIRI4
+MULI4
+ADDRGP4 cg_thirdPerson+12
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $1190
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LEI4 $1190
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35960
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1187
+LABELV $1190
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1188
+JUMPV
+LABELV $1187
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+LABELV $1188
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35944
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRGP4 CG_CalcViewValues
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 CG_SetupFrustum
+CALLV
+pop
+ADDRGP4 CG_DrawSkyBoxPortal
+CALLV
+pop
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35944
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1191
+ADDRGP4 CG_DamageBlendBlob
+CALLV
+pop
+LABELV $1191
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1194
+ADDRGP4 CG_AddPacketEntities
+CALLV
+pop
+ADDRGP4 CG_AddMarks
+CALLV
+pop
+ADDRGP4 CG_AddParticles
+CALLV
+pop
+ADDRGP4 CG_AddLocalEntities
+CALLV
+pop
+ADDRGP4 CG_AddAtmosphericEffects
+CALLV
+pop
+LABELV $1194
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRGP4 CG_AddViewWeapon
+CALLV
+pop
+ADDRGP4 cg+522564+8
+INDIRI4
+CNSTI4 0
+EQI4 $1198
+ADDRGP4 CG_AddTestModel
+CALLV
+pop
+LABELV $1198
+ADDRGP4 cg+512444+72
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRGP4 cg+512444+80
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+ARGP4
+CNSTU4 32
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 CG_PowerupTimerSounds
+CALLV
+pop
+ADDRGP4 cg+522864
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+512444+24
+ARGP4
+ADDRGP4 cg+512444+36
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 cg+522860
+INDIRP4
+CNSTI4 35944
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1217
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1218
+JUMPV
+LABELV $1217
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+LABELV $1218
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_Respatialize
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $1219
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 0
+NEI4 $1219
+ADDRGP4 cg+512316
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+512324
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cg+512316
+INDIRI4
+CNSTI4 0
+GEI4 $1225
+ADDRGP4 cg+512316
+CNSTI4 0
+ASGNI4
+LABELV $1225
+ADDRGP4 cg+512324
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRGP4 CG_AddLagometerFrameInfo
+CALLV
+pop
+LABELV $1219
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+EQF4 $1231
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+GEF4 $1235
+ADDRLP4 68
+ADDRGP4 cg_timescale+8
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRGP4 cg_timescaleFadeSpeed+8
+INDIRF4
+ADDRGP4 cg+512316
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1148846080
+DIVF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+LEF4 $1236
+ADDRGP4 cg_timescale+8
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+ASGNF4
+ADDRGP4 $1236
+JUMPV
+LABELV $1235
+ADDRLP4 68
+ADDRGP4 cg_timescale+8
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRGP4 cg_timescaleFadeSpeed+8
+INDIRF4
+ADDRGP4 cg+512316
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1148846080
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+GEF4 $1251
+ADDRGP4 cg_timescale+8
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+ASGNF4
+LABELV $1251
+LABELV $1236
+ADDRGP4 cg_timescaleFadeSpeed+8
+INDIRF4
+CNSTF4 0
+EQF4 $1257
+ADDRGP4 $1260
+ARGP4
+ADDRGP4 cg_timescale+8
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $1257
+LABELV $1231
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawActive
+CALLV
+pop
+LABELV $1168
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1170
+ADDRLP4 48
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $1167
+ADDRGP4 cg+522868
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg+522860
+CNSTP4 0
+ASGNP4
+ADDRGP4 cg+522864
+CNSTP4 0
+ASGNP4
+ADDRLP4 52
+ADDRGP4 CG_AnyScoreboardShowing
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $1265
+ADDRGP4 cg+28
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1266
+JUMPV
+LABELV $1265
+ADDRLP4 56
+ADDRGP4 cg+28
+ASGNP4
+ADDRLP4 60
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LEI4 $1268
+ADDRGP4 CG_LoadDeferredPlayers
+CALLV
+pop
+LABELV $1268
+LABELV $1266
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 3
+NEI4 $1271
+ADDRGP4 cg_splitviewThirdEqual+12
+INDIRI4
+CNSTI4 0
+EQI4 $1271
+ADDRGP4 cg+515604
+CNSTI4 4
+ASGNI4
+ADDRGP4 cg+515608
+CNSTI4 3
+ASGNI4
+ADDRGP4 CG_CalcVrect
+CALLV
+pop
+ADDRGP4 CG_ClearViewport
+CALLV
+pop
+ADDRGP4 CG_DrawTourneyScoreboard
+CALLV
+pop
+LABELV $1271
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 1
+EQI4 $1277
+ADDRGP4 cg+515604
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+515608
+CNSTI4 0
+ASGNI4
+ADDRGP4 CG_CalcVrect
+CALLV
+pop
+LABELV $1277
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawScreen2D
+CALLV
+pop
+ADDRGP4 cg_stats+12
+INDIRI4
+CNSTI4 0
+EQI4 $1282
+ADDRGP4 $1285
+ARGP4
+ADDRGP4 cg+8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1282
+LABELV $1108
+endproc CG_DrawActiveFrame 72 20
+bss
+align 4
+LABELV frustum
+skip 64
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_drawScores
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1285
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $1260
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $182
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $165
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $153
+byte 1 36
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $152
+byte 1 0
+align 1
+LABELV $118
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 10
+byte 1 0
@@ -0,0 +1,5290 @@
+export BotCharacterFromHandle
+code
+proc BotCharacterFromHandle 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $65
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LEI4 $63
+LABELV $65
+CNSTI4 4
+ARGI4
+ADDRGP4 $66
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $62
+JUMPV
+LABELV $63
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $67
+CNSTI4 4
+ARGI4
+ADDRGP4 $69
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $62
+JUMPV
+LABELV $67
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+INDIRP4
+RETP4
+LABELV $62
+endproc BotCharacterFromHandle 4 12
+export BotDumpCharacter
+proc BotDumpCharacter 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $71
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Log_Write
+CALLV
+pop
+ADDRGP4 $72
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Log_Write
+CALLV
+pop
+ADDRGP4 $73
+ARGP4
+ADDRGP4 Log_Write
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $74
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $81
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $83
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $85
+ADDRGP4 $78
+JUMPV
+LABELV $81
+ADDRGP4 $82
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Log_Write
+CALLV
+pop
+ADDRGP4 $79
+JUMPV
+LABELV $83
+ADDRGP4 $84
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Log_Write
+CALLV
+pop
+ADDRGP4 $79
+JUMPV
+LABELV $85
+ADDRGP4 $86
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Log_Write
+CALLV
+pop
+LABELV $78
+LABELV $79
+LABELV $75
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 49
+LTI4 $74
+ADDRGP4 $87
+ARGP4
+ADDRGP4 Log_Write
+CALLV
+pop
+LABELV $70
+endproc BotDumpCharacter 24 12
+export BotFreeCharacterStrings
+proc BotFreeCharacterStrings 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $89
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $93
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+LABELV $93
+LABELV $90
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 49
+LTI4 $89
+LABELV $88
+endproc BotFreeCharacterStrings 8 4
+export BotFreeCharacter2
+proc BotFreeCharacter2 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $98
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LEI4 $96
+LABELV $98
+CNSTI4 4
+ARGI4
+ADDRGP4 $66
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $95
+JUMPV
+LABELV $96
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $99
+CNSTI4 4
+ARGI4
+ADDRGP4 $69
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $95
+JUMPV
+LABELV $99
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeCharacterStrings
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $95
+endproc BotFreeCharacter2 4 12
+export BotFreeCharacter
+proc BotFreeCharacter 0 4
+ADDRGP4 bot_reloadcharacters+12
+INDIRI4
+CNSTI4 0
+NEI4 $102
+ADDRGP4 $101
+JUMPV
+LABELV $102
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotFreeCharacter2
+CALLV
+pop
+LABELV $101
+endproc BotFreeCharacter 0 4
+export BotDefaultCharacteristics
+proc BotDefaultCharacteristics 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $106
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $110
+ADDRGP4 $107
+JUMPV
+LABELV $110
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 2
+NEI4 $112
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI1 2
+ASGNI1
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 68
+ASGNI4
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $113
+JUMPV
+LABELV $112
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 1
+NEI4 $114
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI1 1
+ASGNI1
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 68
+ASGNI4
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $116
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI1 3
+ASGNI1
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 68
+ASGNI4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 20
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 24
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 68
+ASGNI4
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $116
+LABELV $115
+LABELV $113
+LABELV $107
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 49
+LTI4 $106
+LABELV $105
+endproc BotDefaultCharacteristics 40 8
+export BotLoadCharacterFromFile
+proc BotLoadCharacterFromFile 1104 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $119
+ARGP4
+ADDRLP4 1060
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $120
+CNSTI4 3
+ARGI4
+ADDRGP4 $122
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $118
+JUMPV
+LABELV $120
+CNSTI4 468
+ARGI4
+ADDRLP4 1064
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1064
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $124
+JUMPV
+LABELV $123
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $129
+ARGP4
+ADDRLP4 1068
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $126
+ADDRLP4 1044
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1072
+ADDRGP4 PC_ExpectTokenType
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $130
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeCharacterStrings
+CALLV
+pop
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $118
+JUMPV
+LABELV $130
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $132
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeCharacterStrings
+CALLV
+pop
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $118
+JUMPV
+LABELV $132
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $138
+ADDRLP4 0+8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $135
+LABELV $138
+ADDRLP4 1056
+CNSTI4 1
+ASGNI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 0+8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $141
+JUMPV
+LABELV $140
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $146
+ARGP4
+ADDRLP4 1084
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $143
+ADDRGP4 $125
+JUMPV
+LABELV $143
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $150
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $147
+LABELV $150
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 $151
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeCharacterStrings
+CALLV
+pop
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $118
+JUMPV
+LABELV $147
+ADDRLP4 1048
+ADDRLP4 0+8
+INDIRI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+LTI4 $156
+ADDRLP4 1048
+INDIRI4
+CNSTI4 49
+LEI4 $154
+LABELV $156
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 $157
+ARGP4
+CNSTI4 49
+ARGI4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeCharacterStrings
+CALLV
+pop
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $118
+JUMPV
+LABELV $154
+ADDRLP4 1048
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $158
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 $160
+ARGP4
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeCharacterStrings
+CALLV
+pop
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $118
+JUMPV
+LABELV $158
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1092
+ADDRGP4 PC_ExpectAnyToken
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $161
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeCharacterStrings
+CALLV
+pop
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $118
+JUMPV
+LABELV $161
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $163
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $165
+ADDRLP4 1048
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0+12
+INDIRF4
+ASGNF4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI1 2
+ASGNI1
+ADDRGP4 $164
+JUMPV
+LABELV $165
+ADDRLP4 1048
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0+8
+INDIRI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI1 1
+ASGNI1
+ADDRGP4 $164
+JUMPV
+LABELV $163
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $170
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1096
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1096
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 1100
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 1100
+INDIRP4
+ASGNP4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 1048
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI1 3
+ASGNI1
+ADDRGP4 $171
+JUMPV
+LABELV $170
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 $174
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeCharacterStrings
+CALLV
+pop
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $118
+JUMPV
+LABELV $171
+LABELV $164
+LABELV $141
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1084
+ADDRGP4 PC_ExpectAnyToken
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $140
+ADDRGP4 $125
+JUMPV
+LABELV $135
+ADDRLP4 1052
+CNSTI4 1
+ASGNI4
+ADDRGP4 $177
+JUMPV
+LABELV $176
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1084
+ADDRGP4 PC_ExpectAnyToken
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $179
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeCharacterStrings
+CALLV
+pop
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $118
+JUMPV
+LABELV $179
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 1088
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $181
+ADDRLP4 1052
+ADDRLP4 1052
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $182
+JUMPV
+LABELV $181
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $146
+ARGP4
+ADDRLP4 1092
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $184
+ADDRLP4 1052
+ADDRLP4 1052
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $184
+LABELV $182
+LABELV $177
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $176
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 $187
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeCharacterStrings
+CALLV
+pop
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $118
+JUMPV
+LABELV $127
+LABELV $124
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1068
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $123
+LABELV $125
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $189
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeCharacterStrings
+CALLV
+pop
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $118
+JUMPV
+LABELV $189
+ADDRLP4 1040
+INDIRP4
+RETP4
+LABELV $118
+endproc BotLoadCharacterFromFile 1104 16
+export BotFindCachedCharacter
+proc BotFindCachedCharacter 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $192
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $196
+ADDRGP4 $193
+JUMPV
+LABELV $196
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $198
+ADDRFP4 4
+INDIRF4
+CNSTF4 0
+LTF4 $200
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1008981770
+GEF4 $198
+LABELV $200
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $191
+JUMPV
+LABELV $198
+LABELV $193
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LEI4 $192
+CNSTI4 0
+RETI4
+LABELV $191
+endproc BotFindCachedCharacter 16 8
+export BotLoadCachedCharacter
+proc BotLoadCachedCharacter 32 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $202
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $206
+ADDRGP4 $204
+JUMPV
+LABELV $206
+LABELV $203
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LEI4 $202
+LABELV $204
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LEI4 $208
+CNSTI4 0
+RETI4
+ADDRGP4 $201
+JUMPV
+LABELV $208
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $210
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 BotFindCachedCharacter
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $212
+CNSTI4 0
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $201
+JUMPV
+LABELV $212
+LABELV $210
+ADDRLP4 12
+ADDRFP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 BotLoadCharacterFromFile
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $215
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRGP4 $217
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $201
+JUMPV
+LABELV $215
+CNSTI4 2
+ARGI4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $219
+ADDRGP4 $221
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 BotFindCachedCharacter
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $222
+CNSTI4 1
+ARGI4
+ADDRGP4 $224
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $201
+JUMPV
+LABELV $222
+LABELV $219
+ADDRGP4 $221
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 BotLoadCharacterFromFile
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $225
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRGP4 $227
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $201
+JUMPV
+LABELV $225
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $228
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 3212836864
+ARGF4
+ADDRLP4 24
+ADDRGP4 BotFindCachedCharacter
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $230
+CNSTI4 0
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $201
+JUMPV
+LABELV $230
+LABELV $228
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 24
+ADDRGP4 BotLoadCharacterFromFile
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $232
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRGP4 $234
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $201
+JUMPV
+LABELV $232
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $235
+ADDRGP4 $221
+ARGP4
+CNSTF4 3212836864
+ARGF4
+ADDRLP4 28
+ADDRGP4 BotFindCachedCharacter
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $237
+CNSTI4 1
+ARGI4
+ADDRGP4 $239
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $201
+JUMPV
+LABELV $237
+LABELV $235
+ADDRGP4 $221
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 28
+ADDRGP4 BotLoadCharacterFromFile
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $240
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRGP4 $242
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $201
+JUMPV
+LABELV $240
+CNSTI4 2
+ARGI4
+ADDRGP4 $243
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $201
+endproc BotLoadCachedCharacter 32 16
+export BotLoadCharacterSkill
+proc BotLoadCharacterSkill 28 12
+ADDRGP4 $221
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 BotLoadCachedCharacter
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 bot_reloadcharacters+12
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 BotLoadCachedCharacter
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $246
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $246
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 24
+ADDRGP4 botcharacters
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRLP4 24
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRLP4 24
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotDefaultCharacteristics
+CALLV
+pop
+LABELV $246
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $244
+endproc BotLoadCharacterSkill 28 12
+export BotInterpolateCharacters
+proc BotInterpolateCharacters 96 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 BotCharacterFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 BotCharacterFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTU4 0
+ASGNU4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $251
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+NEU4 $249
+LABELV $251
+CNSTI4 0
+RETI4
+ADDRGP4 $248
+JUMPV
+LABELV $249
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $252
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $256
+ADDRGP4 $254
+JUMPV
+LABELV $256
+LABELV $253
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LEI4 $252
+LABELV $254
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LEI4 $258
+CNSTI4 0
+RETI4
+ADDRGP4 $248
+JUMPV
+LABELV $258
+CNSTI4 468
+ARGI4
+ADDRLP4 36
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 64
+ASGNI4
+ADDRLP4 44
+ADDRLP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 8
+INDIRF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $260
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 68
+ASGNI4
+ADDRLP4 56
+CNSTI4 2
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 56
+INDIRI4
+NEI4 $264
+ADDRLP4 48
+INDIRI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 56
+INDIRI4
+NEI4 $264
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI1 2
+ASGNI1
+ADDRLP4 60
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 68
+ASGNI4
+ADDRLP4 68
+CNSTI4 4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 60
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $265
+JUMPV
+LABELV $264
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 1
+NEI4 $266
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI1 1
+ASGNI1
+ADDRLP4 60
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 68
+ASGNI4
+ADDRLP4 68
+CNSTI4 4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $267
+JUMPV
+LABELV $266
+ADDRLP4 60
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 60
+INDIRI4
+NEI4 $268
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI1 3
+ASGNI1
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 68
+ASGNI4
+ADDRLP4 72
+CNSTI4 4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 76
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 80
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 88
+CNSTI4 68
+ASGNI4
+ADDRLP4 92
+CNSTI4 4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 84
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $268
+LABELV $267
+LABELV $265
+LABELV $261
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 49
+LTI4 $260
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $248
+endproc BotInterpolateCharacters 96 8
+export BotLoadCharacter
+proc BotLoadCharacter 28 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $271
+ADDRFP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $272
+JUMPV
+LABELV $271
+ADDRFP4 4
+INDIRF4
+CNSTF4 1084227584
+LEF4 $273
+ADDRFP4 4
+CNSTF4 1084227584
+ASGNF4
+LABELV $273
+LABELV $272
+ADDRFP4 4
+INDIRF4
+CNSTF4 1065353216
+EQF4 $278
+ADDRFP4 4
+INDIRF4
+CNSTF4 1082130432
+EQF4 $278
+ADDRFP4 4
+INDIRF4
+CNSTF4 1084227584
+NEF4 $275
+LABELV $278
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 BotLoadCharacterSkill
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $275
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 BotFindCachedCharacter
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $279
+CNSTI4 0
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $279
+ADDRFP4 4
+INDIRF4
+CNSTF4 1082130432
+GEF4 $281
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 20
+ADDRGP4 BotLoadCharacterSkill
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $283
+CNSTI4 0
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $283
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 24
+ADDRGP4 BotLoadCharacterSkill
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $282
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $281
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 20
+ADDRGP4 BotLoadCharacterSkill
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $287
+CNSTI4 0
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $287
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1084227584
+ARGF4
+ADDRLP4 24
+ADDRGP4 BotLoadCharacterSkill
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $289
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $289
+LABELV $282
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 BotInterpolateCharacters
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $291
+CNSTI4 0
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $291
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotDumpCharacter
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $270
+endproc BotLoadCharacter 28 16
+export CheckCharacteristicIndex
+proc CheckCharacteristicIndex 12 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotCharacterFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $294
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $294
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $298
+ADDRFP4 4
+INDIRI4
+CNSTI4 49
+LTI4 $296
+LABELV $298
+CNSTI4 3
+ARGI4
+ADDRGP4 $299
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $296
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $300
+CNSTI4 3
+ARGI4
+ADDRGP4 $302
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $300
+CNSTI4 1
+RETI4
+LABELV $293
+endproc CheckCharacteristicIndex 12 12
+export Characteristic_Float
+proc Characteristic_Float 12 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotCharacterFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $304
+CNSTF4 0
+RETF4
+ADDRGP4 $303
+JUMPV
+LABELV $304
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CheckCharacteristicIndex
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $306
+CNSTF4 0
+RETF4
+ADDRGP4 $303
+JUMPV
+LABELV $306
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 1
+NEI4 $308
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $303
+JUMPV
+LABELV $308
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 2
+NEI4 $310
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+RETF4
+ADDRGP4 $303
+JUMPV
+LABELV $310
+CNSTI4 3
+ARGI4
+ADDRGP4 $312
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTF4 0
+RETF4
+LABELV $303
+endproc Characteristic_Float 12 12
+export Characteristic_BFloat
+proc Characteristic_BFloat 16 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 BotCharacterFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $314
+CNSTF4 0
+RETF4
+ADDRGP4 $313
+JUMPV
+LABELV $314
+ADDRFP4 8
+INDIRF4
+ADDRFP4 12
+INDIRF4
+LEF4 $316
+CNSTI4 3
+ARGI4
+ADDRGP4 $318
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTF4 0
+RETF4
+ADDRGP4 $313
+JUMPV
+LABELV $316
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 Characteristic_Float
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+GEF4 $319
+ADDRFP4 8
+INDIRF4
+RETF4
+ADDRGP4 $313
+JUMPV
+LABELV $319
+ADDRLP4 0
+INDIRF4
+ADDRFP4 12
+INDIRF4
+LEF4 $321
+ADDRFP4 12
+INDIRF4
+RETF4
+ADDRGP4 $313
+JUMPV
+LABELV $321
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $313
+endproc Characteristic_BFloat 16 20
+export Characteristic_Integer
+proc Characteristic_Integer 12 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotCharacterFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $324
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $324
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CheckCharacteristicIndex
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $326
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $326
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 1
+NEI4 $328
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $328
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 2
+NEI4 $330
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CVFI4 4
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $330
+CNSTI4 3
+ARGI4
+ADDRGP4 $332
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $323
+endproc Characteristic_Integer 12 12
+export Characteristic_BInteger
+proc Characteristic_BInteger 16 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 BotCharacterFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $334
+CNSTI4 0
+RETI4
+ADDRGP4 $333
+JUMPV
+LABELV $334
+ADDRFP4 8
+INDIRI4
+ADDRFP4 12
+INDIRI4
+LEI4 $336
+CNSTI4 3
+ARGI4
+ADDRGP4 $338
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $333
+JUMPV
+LABELV $336
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 Characteristic_Integer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+GEI4 $339
+ADDRFP4 8
+INDIRI4
+RETI4
+ADDRGP4 $333
+JUMPV
+LABELV $339
+ADDRLP4 0
+INDIRI4
+ADDRFP4 12
+INDIRI4
+LEI4 $341
+ADDRFP4 12
+INDIRI4
+RETI4
+ADDRGP4 $333
+JUMPV
+LABELV $341
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $333
+endproc Characteristic_BInteger 16 20
+export Characteristic_String
+proc Characteristic_String 16 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotCharacterFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $344
+ADDRGP4 $343
+JUMPV
+LABELV $344
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CheckCharacteristicIndex
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $346
+ADDRGP4 $343
+JUMPV
+LABELV $346
+ADDRLP4 12
+CNSTI4 3
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+NEI4 $348
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $349
+JUMPV
+LABELV $348
+CNSTI4 3
+ARGI4
+ADDRGP4 $350
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $349
+LABELV $343
+endproc Characteristic_String 16 12
+export BotShutdownCharacters
+proc BotShutdownCharacters 4 4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $352
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botcharacters
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $356
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotFreeCharacter2
+CALLV
+pop
+LABELV $356
+LABELV $353
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LEI4 $352
+LABELV $351
+endproc BotShutdownCharacters 4 4
+bss
+export botcharacters
+align 4
+LABELV botcharacters
+skip 260
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotTeamAI
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import ctf_blueflag
+import ctf_redflag
+import bot_offhandgrapple
+import bot_droppedweight
+import bot_challenge
+import bot_testrchat
+import bot_testichat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxplayers
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import PlayerOnSameTeamFromName
+import PlayerFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckBlockedTeammates
+import BotCheckAttack
+import BotAimAtEnemy
+import BotVisibilityStats
+import BotEndVisibilityFrame
+import BotBeginVisibilityFrame
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotCountTeamMates
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import BotCanCamp
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanGrapple
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import EasyPlayerName
+import PlayerName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityIsShooting
+import SenseCarriesCubes
+import SenseIsInvisible
+import EntityIsInvisible
+import PowerupsCarryFlag
+import PlayerCarriesFlag
+import PlayerIsDead
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotPlayerStateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import bot_reloadcharacters
+import bot_showteamgoals
+import bot_shownodechanges
+import bot_developer
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetPlayerState
+import BotAI_DebugLineShow
+import BotAI_DebugLineDelete
+import BotAI_DebugLineCreate
+import BotAI_InPVS
+import BotAI_PointContents
+import BotAI_EntityTrace
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotLibVarGetValue
+import BotNextEntity
+import BotSense
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotShutdownWeights
+import InterbreedWeightConfigs
+import EvolveWeightConfig
+import ScaleBalanceRange
+import ScaleWeight
+import CompileWeightConfig
+import FuzzyWeightTree
+import FuzzyWeights
+import FuzzyWeightUndecided
+import FuzzyWeight
+import FindFuzzyWeight
+import WriteWeightConfig
+import FreeWeightConfig
+import ReadWeightConfig
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotInitPhysicsSettings
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotRoutingAreaChanged
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotPrepareItemWeights
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotMatchTemplatesContainsString
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatchLinear
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import Log_Flush
+import Log_FileHandle
+import Log_WriteTimeStamped
+import Log_Write
+import Log_Shutdown
+import Log_Close
+import Log_Open
+import GetBotLibAPI
+import g_instagib
+import g_playerCapsule
+import g_proxMineTimeout
+import g_singlePlayer
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGamePlayers
+import g_maxplayers
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import trap_AAS_DropToFloor
+import trap_AAS_HorizontalVelocityForJump
+import trap_AAS_AgainstLadder
+import trap_AAS_JumpReachRunStart
+import trap_AAS_Swimming
+import trap_AAS_OnGround
+import trap_AAS_PredictPlayerMovement
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaTravelTime
+import trap_AAS_EnableRoutingArea
+import trap_AAS_RandomGoalArea
+import trap_AAS_ReachabilityFromNum
+import trap_AAS_NextAreaReachability
+import trap_AAS_AreaContentsTravelFlags
+import trap_AAS_TravelFlagForType
+import trap_AAS_AreaDoNotEnter
+import trap_AAS_AreaJumpPad
+import trap_AAS_AreaLadder
+import trap_AAS_AreaGrounded
+import trap_AAS_AreaSlime
+import trap_AAS_AreaLava
+import trap_AAS_AreaLiquid
+import trap_AAS_AreaSwim
+import trap_AAS_AreaCrouch
+import trap_AAS_AreaGroundFaceArea
+import trap_AAS_NextModelReachability
+import trap_AAS_BestReachableFromJumpPadArea
+import trap_AAS_BestReachableArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_TracePlayerBBox
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_FloodAreas
+import trap_AAS_ShowReachableAreas
+import trap_AAS_ShowReachability
+import trap_AAS_DrawArrow
+import trap_AAS_PrintTravelType
+import trap_AAS_DrawCross
+import trap_AAS_ShowAreaPolygons
+import trap_AAS_ShowArea
+import trap_AAS_ShowFace
+import trap_AAS_ShowBoundingBox
+import trap_AAS_DrawPlaneCross
+import trap_AAS_DrawPermanentCross
+import trap_AAS_PermanentLine
+import trap_AAS_DebugLine
+import trap_AAS_ClearShownPolygons
+import trap_AAS_ClearShownDebugLines
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_Loaded
+import trap_AAS_PointInsideArea
+import trap_AAS_BBoxReachabilityAreas
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_RegisterModel
+import trap_DebugPolygonDelete
+import trap_DebugPolygonShow
+import trap_DebugPolygonCreate
+import trap_ClientCommand
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_ClipToEntitiesCapsule
+import trap_ClipToEntities
+import trap_TraceCapsule
+import trap_Trace
+import trap_GetBrushBounds
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_SetConfigstringRestrictions
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommandEx
+import trap_DropPlayer
+import trap_SetNetFields
+import trap_LocateGameData
+import Pickup_Team
+import Svcmd_TeamInfoStats_f
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_BuildLocationTree
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotWeightBench_f
+import Svcmd_BotThinkReport_f
+import Svcmd_BotMatchBench_f
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownPlayer
+import BotAISetupPlayer
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import G_BotInitBotLib
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBotComplete
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunPlayer
+import PlayerEndFrame
+import PlayerThink
+import PlayerHandicap
+import ClientCommand
+import PlayerBegin
+import PlayerDisconnect
+import PlayerUserinfoChanged
+import PlayerConnect
+import G_Error
+import G_Printf
+import G_DPrintf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MovePlayerToIntermission
+import StringIsInteger
+import ConcatArgs
+import G_ScoreboardChanged
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import G_RegisterCommands
+import G_ConsoleCompleteArgument
+import G_ConsoleCommand
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import PlayerSpawn
+import InitBodyQue
+import BeginIntermission
+import PlayerRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetPlayerViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossPlayerCubes
+import TossPlayerGametypeItems
+import TossPlayerItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_SetBrushModel
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import trap_SendServerCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import FinishSpawningItem
+import G_SpawnItem
+import LaunchItem
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $350
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $338
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 119
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $332
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $318
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 119
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $312
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $302
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $299
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $243
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $242
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $239
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $234
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $227
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $224
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $221
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 99
+byte 1 46
+byte 1 99
+byte 1 0
+align 1
+LABELV $218
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $217
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $214
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $187
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $174
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $160
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $157
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 91
+byte 1 48
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 0
+align 1
+LABELV $151
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $146
+byte 1 125
+byte 1 0
+align 1
+LABELV $134
+byte 1 123
+byte 1 0
+align 1
+LABELV $129
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $122
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $119
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $87
+byte 1 125
+byte 1 10
+byte 1 0
+align 1
+LABELV $86
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $84
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $82
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $73
+byte 1 123
+byte 1 10
+byte 1 0
+align 1
+LABELV $72
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $71
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $69
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $66
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
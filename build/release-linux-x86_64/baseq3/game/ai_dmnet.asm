@@ -0,0 +1,16278 @@
+export BotResetNodeSwitches
+code
+proc BotResetNodeSwitches 0 0
+ADDRGP4 numnodeswitches
+CNSTI4 0
+ASGNI4
+LABELV $62
+endproc BotResetNodeSwitches 0 0
+export BotDumpNodeSwitches
+proc BotDumpNodeSwitches 40 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 PlayerName
+CALLP4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $64
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+CNSTI4 50
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $68
+JUMPV
+LABELV $65
+CNSTI4 1
+ARGI4
+ADDRGP4 $69
+ARGP4
+CNSTI4 144
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 nodeswitch
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $66
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $68
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numnodeswitches
+INDIRI4
+LTI4 $65
+CNSTI4 4
+ARGI4
+ADDRGP4 $70
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $63
+endproc BotDumpNodeSwitches 40 20
+export BotRecordNodeSwitch
+proc BotRecordNodeSwitch 44 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 PlayerName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 17120
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 36
+CNSTI4 144
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 numnodeswitches
+INDIRI4
+MULI4
+ADDRGP4 nodeswitch
+ADDP4
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 $72
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 bot_shownodechanges+12
+INDIRI4
+CNSTI4 0
+EQI4 $73
+CNSTI4 1
+ARGI4
+ADDRGP4 $69
+ARGP4
+CNSTI4 144
+ADDRGP4 numnodeswitches
+INDIRI4
+MULI4
+ADDRGP4 nodeswitch
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $73
+ADDRLP4 40
+ADDRGP4 numnodeswitches
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $71
+endproc BotRecordNodeSwitch 44 32
+lit
+align 4
+LABELV $77
+byte 4 3245342720
+byte 4 3245342720
+byte 4 3221225472
+align 4
+LABELV $78
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1073741824
+export BotGetAirGoal
+code
+proc BotGetAirGoal 120 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 $77
+INDIRB
+ASGNB 12
+ADDRLP4 88
+ADDRGP4 $78
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1148846080
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 12+12
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 56
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 0
+LEF4 $81
+ADDRLP4 12+12
+ARGP4
+ADDRLP4 112
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 100
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $85
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12+12
+INDIRB
+ASGNB 12
+ADDRLP4 116
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $76
+JUMPV
+LABELV $85
+LABELV $81
+CNSTI4 0
+RETI4
+LABELV $76
+endproc BotGetAirGoal 120 28
+export BotGoForAir
+proc BotGoForAir 68 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18432
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+GEF4 $89
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotGetAirGoal
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $94
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotPushGoal
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $88
+JUMPV
+LABELV $93
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotGetTopGoal
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $96
+CNSTI4 1
+RETI4
+ADDRGP4 $88
+JUMPV
+LABELV $96
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotPopGoal
+CALLV
+pop
+LABELV $94
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17200
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 BotChooseNBGItem
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $93
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetAvoidGoals
+CALLV
+pop
+LABELV $89
+CNSTI4 0
+RETI4
+LABELV $88
+endproc BotGoForAir 68 24
+export BotNearbyGoal
+proc BotNearbyGoal 20 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 BotGoForAir
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $99
+CNSTI4 1
+RETI4
+ADDRGP4 $98
+JUMPV
+LABELV $99
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $101
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18888
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 16
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 300
+GEI4 $103
+ADDRFP4 12
+CNSTF4 1112014848
+ASGNF4
+LABELV $103
+LABELV $101
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17200
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 BotChooseNBGItem
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $98
+endproc BotNearbyGoal 20 24
+export BotReachedGoal
+proc BotReachedGoal 40 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $106
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $108
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $110
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 3212836864
+ARGF4
+ADDRGP4 BotSetAvoidGoalTime
+CALLV
+pop
+LABELV $110
+CNSTI4 1
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $108
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotItemGoalInVisButNotVisible
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $112
+CNSTI4 1
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $112
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $107
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $107
+ADDRLP4 12
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $107
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $107
+ADDRLP4 24
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $107
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $107
+CNSTI4 1
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $106
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $122
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $124
+CNSTI4 1
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $124
+ADDRFP4 0
+INDIRP4
+CNSTI4 18432
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+LEF4 $123
+CNSTI4 1
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $122
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $128
+CNSTI4 1
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $128
+LABELV $123
+LABELV $107
+CNSTI4 0
+RETI4
+LABELV $105
+endproc BotReachedGoal 40 16
+export BotGetItemLongTermGoal
+proc BotGetItemLongTermGoal 144 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $131
+ADDRFP4 0
+INDIRP4
+CNSTI4 18324
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $132
+JUMPV
+LABELV $131
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $133
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18324
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $133
+LABELV $132
+ADDRFP4 0
+INDIRP4
+CNSTI4 18324
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $135
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17200
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 BotChooseLTGItem
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $137
+ADDRFP4 0
+INDIRP4
+CNSTI4 18324
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRGP4 $138
+JUMPV
+LABELV $137
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 PlayerName
+CALLP4
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 $139
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckBlockedTeammates
+CALLV
+pop
+LABELV $138
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $130
+JUMPV
+LABELV $135
+CNSTI4 1
+RETI4
+LABELV $130
+endproc BotGetItemLongTermGoal 144 16
+export BotGetLongTermGoal
+proc BotGetLongTermGoal 392 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $141
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $141
+ADDRLP4 336
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 336
+INDIRF4
+CNSTF4 0
+EQF4 $143
+ADDRLP4 336
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $143
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 340
+ADDRGP4 EasyPlayerName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $145
+ARGP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $146
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $143
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $147
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $147
+ADDRFP4 0
+INDIRP4
+CNSTI4 19000
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+GEF4 $149
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $149
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 340
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 272
+ADDRLP4 340
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 348
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 348
+INDIRF4
+CNSTF4 0
+EQF4 $151
+ADDRLP4 260
+ADDRLP4 272
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 272
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 272
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 360
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 360
+INDIRF4
+CNSTF4 1176256512
+GEF4 $152
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckBlockedTeammates
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $151
+ADDRFP4 0
+INDIRP4
+CNSTI4 19000
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $152
+ADDRLP4 272
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $157
+ADDRLP4 316
+ADDRLP4 272
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 352
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $159
+ADDRLP4 352
+INDIRI4
+ARGI4
+ADDRLP4 356
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $159
+ADDRFP4 0
+INDIRP4
+CNSTI4 18916
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18888
+ADDP4
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ADDRLP4 272
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 18892
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18896
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18900
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18904
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18908
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18912
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $159
+LABELV $157
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $141
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $161
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $161
+ADDRLP4 336
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 336
+INDIRF4
+CNSTF4 0
+EQF4 $163
+ADDRLP4 336
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $163
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 340
+ADDRGP4 EasyPlayerName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $146
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $163
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $166
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 340
+ADDRGP4 EasyPlayerName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $168
+ARGP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $166
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 340
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 272
+ADDRLP4 340
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRLP4 272
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 272
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 272
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1132462080
+ARGF4
+ADDRLP4 352
+ADDRGP4 BotCountTeamMates
+CALLI4
+ASGNI4
+ADDRLP4 276
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRLP4 260
+ARGP4
+ADDRLP4 356
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 360
+ADDRFP4 0
+INDIRP4
+CNSTI4 19268
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 364
+ADDRLP4 360
+INDIRF4
+ADDRLP4 276
+INDIRI4
+CVIF4 4
+ADDRLP4 360
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 356
+INDIRF4
+ADDRLP4 364
+INDIRF4
+ADDRLP4 364
+INDIRF4
+MULF4
+GEF4 $171
+ADDRFP4 0
+INDIRP4
+CNSTI4 18376
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $173
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 368
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 368
+INDIRF4
+ASGNF4
+ADDRLP4 372
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17152
+ADDP4
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+GEF4 $175
+ADDRFP4 0
+INDIRP4
+CNSTI4 18376
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $175
+LABELV $173
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRLP4 368
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 0
+EQI4 $177
+ADDRFP4 0
+INDIRP4
+CNSTI4 18376
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $177
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 376
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 376
+INDIRF4
+CNSTF4 0
+EQF4 $179
+ADDRFP4 0
+INDIRP4
+CNSTI4 19000
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18428
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $181
+ADDRFP4 0
+INDIRP4
+CNSTI4 18428
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $183
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Gesture
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 380
+ADDRGP4 EasyPlayerName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $185
+ARGP4
+ADDRLP4 380
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18428
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $184
+JUMPV
+LABELV $183
+ADDRFP4 0
+INDIRP4
+CNSTI4 18376
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $186
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Crouch
+CALLV
+pop
+ADDRGP4 $187
+JUMPV
+LABELV $186
+ADDRLP4 380
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 380
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1028443341
+ADDRFP4 0
+INDIRP4
+CNSTI4 17152
+ADDP4
+INDIRF4
+MULF4
+GEF4 $188
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Gesture
+CALLV
+pop
+LABELV $188
+LABELV $187
+LABELV $184
+LABELV $181
+ADDRFP4 0
+INDIRP4
+CNSTI4 18428
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $190
+ADDRLP4 260
+ADDRLP4 272
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 272
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 272
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 388
+ADDRFP4 0
+INDIRP4
+CNSTI4 18836
+ADDP4
+ASGNP4
+ADDRLP4 388
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 388
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $190
+LABELV $179
+ADDRLP4 380
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 380
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 17152
+ADDP4
+INDIRF4
+MULF4
+GEF4 $194
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 260
+ADDRLP4 320
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 320+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 320+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 388
+ADDRFP4 0
+INDIRP4
+CNSTI4 18836
+ADDP4
+ASGNP4
+ADDRLP4 388
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 388
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $194
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 388
+ADDRGP4 BotGoForAir
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 0
+EQI4 $200
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $202
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $200
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckBlockedTeammates
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $171
+ADDRLP4 272
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $203
+ADDRLP4 316
+ADDRLP4 272
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 368
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 0
+EQI4 $205
+ADDRLP4 368
+INDIRI4
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 0
+EQI4 $205
+ADDRFP4 0
+INDIRP4
+CNSTI4 18916
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18888
+ADDP4
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ADDRLP4 272
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 18892
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18896
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18900
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18904
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18908
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18912
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $205
+LABELV $203
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 19000
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+GEF4 $207
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 368
+ADDRGP4 EasyPlayerName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $209
+ARGP4
+ADDRLP4 368
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19000
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $207
+CNSTI4 1
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $161
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $210
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18888
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 340
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18404
+ADDP4
+INDIRF4
+LEF4 $212
+ADDRFP4 0
+INDIRP4
+CNSTI4 18400
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $212
+LABELV $210
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $214
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $214
+ADDRFP4 0
+INDIRP4
+CNSTI4 18400
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $214
+ADDRLP4 340
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 340
+INDIRF4
+CNSTF4 0
+EQF4 $216
+ADDRLP4 340
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $216
+ADDRFP4 0
+INDIRP4
+CNSTI4 18920
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $219
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $216
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $220
+ADDRFP4 0
+INDIRP4
+CNSTI4 18920
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $222
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $220
+ADDRLP4 260
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 352
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 352
+INDIRF4
+CNSTF4 1167663104
+GEF4 $225
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetAvoidReach
+CALLV
+pop
+ADDRLP4 356
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 360
+CNSTF4 1077936128
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18400
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 360
+INDIRF4
+ADDF4
+ADDRLP4 360
+INDIRF4
+ADDRLP4 356
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 BotHasPersistantPowerupAndWeapon
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+EQI4 $227
+ADDRFP4 0
+INDIRP4
+CNSTI4 18404
+ADDP4
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 $228
+JUMPV
+LABELV $227
+ADDRFP4 0
+INDIRP4
+CNSTI4 18404
+ADDP4
+CNSTF4 1135542272
+ASGNF4
+LABELV $228
+LABELV $225
+CNSTI4 1
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $214
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 11
+NEI4 $229
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $229
+ADDRLP4 340
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 340
+INDIRF4
+CNSTF4 0
+EQF4 $231
+ADDRLP4 340
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $231
+ADDRFP4 0
+INDIRP4
+CNSTI4 18916
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyPlayerName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $233
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $231
+ADDRFP4 0
+INDIRP4
+CNSTI4 18424
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+SUBF4
+LEF4 $234
+ADDRFP4 0
+INDIRP4
+CNSTI4 18240
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18916
+ADDP4
+INDIRI4
+NEI4 $234
+ADDRFP4 0
+INDIRP4
+CNSTI4 18916
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyPlayerName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $236
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $234
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $237
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $237
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $229
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $239
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $239
+ADDRLP4 340
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 340
+INDIRF4
+CNSTF4 0
+EQF4 $241
+ADDRLP4 340
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $241
+ADDRFP4 0
+INDIRP4
+CNSTI4 18920
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $243
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $146
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $241
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $244
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $244
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 BotItemGoalInVisButNotVisible
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $246
+ADDRFP4 0
+INDIRP4
+CNSTI4 18920
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $248
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $247
+JUMPV
+LABELV $246
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $249
+ADDRFP4 0
+INDIRP4
+CNSTI4 18920
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $251
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $249
+LABELV $247
+CNSTI4 1
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $239
+ADDRLP4 340
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 7
+EQI4 $254
+ADDRLP4 340
+INDIRI4
+CNSTI4 8
+NEI4 $252
+LABELV $254
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $252
+ADDRLP4 344
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 344
+INDIRF4
+CNSTF4 0
+EQF4 $255
+ADDRLP4 344
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $255
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 348
+ADDRGP4 EasyPlayerName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $259
+ARGP4
+ADDRLP4 348
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $146
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 EA_Action
+CALLV
+pop
+LABELV $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $255
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $260
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $262
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+LABELV $262
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $260
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $265
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 BotCanCamp
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+NEI4 $267
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $267
+LABELV $265
+ADDRLP4 260
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1132462080
+ARGF4
+ADDRLP4 356
+ADDRGP4 BotCountTeamMates
+CALLI4
+ASGNI4
+ADDRLP4 276
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRLP4 260
+ARGP4
+ADDRLP4 360
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 364
+CNSTI4 60
+ASGNI4
+ADDRLP4 368
+ADDRLP4 364
+INDIRI4
+ADDRLP4 276
+INDIRI4
+MULI4
+ADDRLP4 364
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 360
+INDIRF4
+ADDRLP4 368
+INDIRI4
+ADDRLP4 368
+INDIRI4
+MULI4
+CVIF4 4
+GEF4 $271
+ADDRFP4 0
+INDIRP4
+CNSTI4 18428
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $273
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $275
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 372
+ADDRGP4 EasyPlayerName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $277
+ARGP4
+ADDRLP4 372
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $278
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+LABELV $275
+ADDRFP4 0
+INDIRP4
+CNSTI4 18428
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $273
+ADDRLP4 372
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 17152
+ADDP4
+INDIRF4
+MULF4
+GEF4 $279
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 260
+ADDRLP4 320
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 320+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 320+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 380
+ADDRFP4 0
+INDIRP4
+CNSTI4 18836
+ADDP4
+ASGNP4
+ADDRLP4 380
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 380
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $279
+ADDRFP4 0
+INDIRP4
+CNSTI4 18376
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $285
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 376
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 376
+INDIRF4
+ASGNF4
+ADDRLP4 380
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 380
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17152
+ADDP4
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+GEF4 $287
+ADDRFP4 0
+INDIRP4
+CNSTI4 18376
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $287
+LABELV $285
+ADDRFP4 0
+INDIRP4
+CNSTI4 18376
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $289
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Crouch
+CALLV
+pop
+LABELV $289
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRLP4 376
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 376
+INDIRI4
+CNSTI4 0
+EQI4 $291
+ADDRFP4 0
+INDIRP4
+CNSTI4 18376
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $291
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 384
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 384
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $293
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $295
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $297
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $297
+LABELV $295
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $293
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckBlockedTeammates
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $271
+CNSTI4 1
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $252
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $299
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $299
+ADDRLP4 344
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 344
+INDIRF4
+CNSTF4 0
+EQF4 $301
+ADDRLP4 344
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $301
+ADDRLP4 4
+ARGP4
+ADDRGP4 $70
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 21264
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $306
+JUMPV
+LABELV $303
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $307
+ADDRLP4 4
+ARGP4
+ADDRGP4 $309
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $307
+LABELV $304
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $306
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $303
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $310
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $146
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $301
+ADDRFP4 0
+INDIRP4
+CNSTI4 21268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $311
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $311
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 21268
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $313
+ADDRFP4 0
+INDIRP4
+CNSTI4 21272
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $315
+ADDRFP4 0
+INDIRP4
+CNSTI4 21268
+ADDP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $317
+ADDRLP4 356
+ADDRFP4 0
+INDIRP4
+CNSTI4 21268
+ADDP4
+ASGNP4
+ADDRLP4 356
+INDIRP4
+ADDRLP4 356
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $316
+JUMPV
+LABELV $317
+ADDRLP4 356
+ADDRFP4 0
+INDIRP4
+CNSTI4 21268
+ADDP4
+ASGNP4
+ADDRLP4 356
+INDIRP4
+ADDRLP4 356
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 360
+ADDRFP4 0
+INDIRP4
+CNSTI4 21272
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ADDRLP4 360
+INDIRP4
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+ADDRGP4 $316
+JUMPV
+LABELV $315
+ADDRFP4 0
+INDIRP4
+CNSTI4 21268
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $319
+ADDRLP4 356
+ADDRFP4 0
+INDIRP4
+CNSTI4 21268
+ADDP4
+ASGNP4
+ADDRLP4 356
+INDIRP4
+ADDRLP4 356
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $320
+JUMPV
+LABELV $319
+ADDRLP4 356
+ADDRFP4 0
+INDIRP4
+CNSTI4 21268
+ADDP4
+ASGNP4
+ADDRLP4 356
+INDIRP4
+ADDRLP4 356
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 360
+ADDRFP4 0
+INDIRP4
+CNSTI4 21272
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ADDRLP4 360
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $320
+LABELV $316
+LABELV $313
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $321
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $323
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $321
+ADDRFP4 0
+INDIRP4
+CNSTI4 21268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $324
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $324
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 21268
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $299
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $326
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $328
+ADDRLP4 344
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 344
+INDIRF4
+CNSTF4 0
+EQF4 $330
+ADDRLP4 344
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $330
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $332
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $333
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $330
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 348
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 1
+EQI4 $337
+ADDRLP4 348
+INDIRI4
+CNSTI4 2
+EQI4 $338
+ADDRGP4 $334
+JUMPV
+LABELV $337
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $335
+JUMPV
+LABELV $338
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $335
+JUMPV
+LABELV $334
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $335
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 360
+ADDRGP4 BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 360
+INDIRI4
+CNSTI4 0
+EQI4 $339
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 368
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 364
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 1
+EQI4 $344
+ADDRLP4 364
+INDIRI4
+CNSTI4 2
+EQI4 $345
+ADDRGP4 $341
+JUMPV
+LABELV $344
+ADDRFP4 0
+INDIRP4
+CNSTI4 19212
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $342
+JUMPV
+LABELV $345
+ADDRFP4 0
+INDIRP4
+CNSTI4 19208
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $341
+LABELV $342
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $339
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $346
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $346
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $328
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $348
+ADDRFP4 0
+INDIRP4
+CNSTI4 18408
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $348
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 348
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 1
+EQI4 $353
+ADDRLP4 348
+INDIRI4
+CNSTI4 2
+EQI4 $354
+ADDRGP4 $350
+JUMPV
+LABELV $353
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $351
+JUMPV
+LABELV $354
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $351
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 360
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 360
+INDIRI4
+CNSTI4 0
+NEI4 $355
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $355
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $357
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $357
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+EQI4 $359
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 368
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 0
+EQI4 $361
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetAvoidReach
+CALLV
+pop
+ADDRLP4 372
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18408
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 372
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $362
+JUMPV
+LABELV $361
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $362
+LABELV $359
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $348
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $363
+ADDRLP4 348
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 348
+INDIRF4
+CNSTF4 0
+EQF4 $365
+ADDRLP4 348
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $365
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $367
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $368
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $365
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 356
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 352
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 1
+EQI4 $372
+ADDRLP4 352
+INDIRI4
+CNSTI4 2
+EQI4 $373
+ADDRGP4 $369
+JUMPV
+LABELV $372
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $370
+JUMPV
+LABELV $373
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $370
+JUMPV
+LABELV $369
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $370
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+EQI4 $374
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $374
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $376
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $376
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $363
+LABELV $326
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+RETI4
+LABELV $140
+endproc BotGetLongTermGoal 392 20
+export BotLongTermGoal
+proc BotLongTermGoal 320 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19136
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $379
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $379
+ADDRFP4 0
+INDIRP4
+CNSTI4 19136
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $381
+ADDRFP4 0
+INDIRP4
+CNSTI4 19076
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 280
+ADDRGP4 EasyPlayerName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $383
+ARGP4
+ADDRLP4 280
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 19136
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 BotGetLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+RETI4
+ADDRGP4 $378
+JUMPV
+LABELV $381
+ADDRLP4 280
+ADDRFP4 0
+INDIRP4
+CNSTI4 19144
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 280
+INDIRF4
+CNSTF4 0
+GEF4 $384
+ADDRLP4 280
+INDIRF4
+NEGF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $384
+ADDRFP4 0
+INDIRP4
+CNSTI4 19076
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 284
+ADDRGP4 EasyPlayerName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $386
+ARGP4
+ADDRLP4 284
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 19144
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $384
+ADDRFP4 0
+INDIRP4
+CNSTI4 19076
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 284
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 284
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $387
+ADDRLP4 276
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 288
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $389
+ADDRLP4 288
+INDIRI4
+ARGI4
+ADDRLP4 292
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $389
+ADDRFP4 0
+INDIRP4
+CNSTI4 19120
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19076
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19092
+ADDP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19080
+ADDP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 19096
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19100
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19104
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19108
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19112
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19116
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $389
+LABELV $387
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19076
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 292
+INDIRF4
+CNSTF4 0
+EQF4 $391
+ADDRFP4 0
+INDIRP4
+CNSTI4 19140
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $391
+ADDRFP4 0
+INDIRP4
+CNSTI4 19140
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $393
+ADDRFP4 0
+INDIRP4
+CNSTI4 19148
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+LABELV $393
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19080
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19084
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19088
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 304
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 272
+ADDRLP4 304
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19148
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $397
+ADDRFP4 0
+INDIRP4
+CNSTI4 19144
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+GEF4 $399
+ADDRFP4 0
+INDIRP4
+CNSTI4 19076
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 EasyPlayerName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $386
+ARGP4
+ADDRLP4 308
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 19144
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $399
+ADDRLP4 272
+INDIRF4
+CNSTF4 1176256512
+GEF4 $401
+ADDRFP4 0
+INDIRP4
+CNSTI4 19148
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $401
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19080
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $378
+JUMPV
+LABELV $397
+ADDRLP4 272
+INDIRF4
+CNSTF4 1215570944
+LEF4 $403
+ADDRFP4 0
+INDIRP4
+CNSTI4 19144
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+GEF4 $405
+ADDRFP4 0
+INDIRP4
+CNSTI4 19076
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 EasyPlayerName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $386
+ARGP4
+ADDRLP4 308
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 19144
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $405
+ADDRLP4 308
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 308
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 308
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 18836
+ADDP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 316
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $378
+JUMPV
+LABELV $403
+LABELV $379
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 BotGetLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+RETI4
+LABELV $378
+endproc BotLongTermGoal 320 20
+export AIEnter_Intermission
+proc AIEnter_Intermission 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $410
+ARGP4
+ADDRGP4 $70
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotResetState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotChat_EndLevel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $411
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18300
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+LABELV $411
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+ADDRGP4 AINode_Intermission
+ASGNP4
+LABELV $409
+endproc AIEnter_Intermission 8 16
+export AINode_Intermission
+proc AINode_Intermission 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $414
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotChat_StartLevel
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $416
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 18352
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $417
+JUMPV
+LABELV $416
+ADDRFP4 0
+INDIRP4
+CNSTI4 18352
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+LABELV $417
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $418
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+LABELV $414
+CNSTI4 1
+RETI4
+LABELV $413
+endproc AINode_Intermission 16 8
+export AIEnter_Observer
+proc AIEnter_Observer 0 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $420
+ARGP4
+ADDRGP4 $70
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotResetState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+ADDRGP4 AINode_Observer
+ASGNP4
+LABELV $419
+endproc AIEnter_Observer 0 16
+export AINode_Observer
+proc AINode_Observer 4 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $422
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $424
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+LABELV $422
+CNSTI4 1
+RETI4
+LABELV $421
+endproc AINode_Observer 4 8
+export AIEnter_Stand
+proc AIEnter_Stand 0 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $426
+ARGP4
+ADDRGP4 $70
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18368
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+ADDRGP4 AINode_Stand
+ASGNP4
+LABELV $425
+endproc AIEnter_Stand 0 16
+export AINode_Stand
+proc AINode_Stand 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18292
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+LEI4 $428
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotChat_HitTalking
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $430
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18368
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+CNSTF4 1036831949
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18352
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDF4
+CNSTF4 1036831949
+ADDF4
+ASGNF4
+LABELV $430
+LABELV $428
+ADDRFP4 0
+INDIRP4
+CNSTI4 18368
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $432
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $434
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $436
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $427
+JUMPV
+LABELV $434
+ADDRFP4 0
+INDIRP4
+CNSTI4 18368
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $432
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Talk
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18352
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $437
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18300
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $439
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $427
+JUMPV
+LABELV $437
+CNSTI4 1
+RETI4
+LABELV $427
+endproc AINode_Stand 24 12
+export AIEnter_Respawn
+proc AIEnter_Respawn 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $441
+ARGP4
+ADDRGP4 $70
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetMoveState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetGoalState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotChat_Death
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $442
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18332
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18336
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $443
+JUMPV
+LABELV $442
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18332
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18336
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $443
+ADDRFP4 0
+INDIRP4
+CNSTI4 18232
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+ADDRGP4 AINode_Respawn
+ASGNP4
+LABELV $440
+endproc AIEnter_Respawn 12 16
+export AINode_Respawn
+proc AINode_Respawn 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18232
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $445
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $447
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $449
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+ADDRGP4 $446
+JUMPV
+LABELV $447
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Respawn
+CALLV
+pop
+ADDRGP4 $446
+JUMPV
+LABELV $445
+ADDRFP4 0
+INDIRP4
+CNSTI4 18332
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $450
+ADDRFP4 0
+INDIRP4
+CNSTI4 18232
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Respawn
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18336
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $452
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18300
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $452
+LABELV $450
+LABELV $446
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 18336
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $454
+ADDRLP4 0
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+GEF4 $454
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Talk
+CALLV
+pop
+LABELV $454
+CNSTI4 1
+RETI4
+LABELV $444
+endproc AINode_Respawn 4 12
+export BotSelectActivateWeapon
+proc BotSelectActivateWeapon 64 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17224
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $457
+ADDRFP4 0
+INDIRP4
+CNSTI4 17276
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $457
+CNSTI4 2
+RETI4
+ADDRGP4 $456
+JUMPV
+LABELV $457
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17220
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $459
+ADDRFP4 0
+INDIRP4
+CNSTI4 17272
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $459
+CNSTI4 3
+RETI4
+ADDRGP4 $456
+JUMPV
+LABELV $459
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17244
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $461
+ADDRFP4 0
+INDIRP4
+CNSTI4 17284
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $461
+CNSTI4 8
+RETI4
+ADDRGP4 $456
+JUMPV
+LABELV $461
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17236
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 17288
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $463
+CNSTI4 6
+RETI4
+ADDRGP4 $456
+JUMPV
+LABELV $463
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17228
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LEI4 $465
+ADDRFP4 0
+INDIRP4
+CNSTI4 17280
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LEI4 $465
+CNSTI4 4
+RETI4
+ADDRGP4 $456
+JUMPV
+LABELV $465
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17240
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $467
+ADDRFP4 0
+INDIRP4
+CNSTI4 17296
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $467
+CNSTI4 7
+RETI4
+ADDRGP4 $456
+JUMPV
+LABELV $467
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17232
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $469
+ADDRFP4 0
+INDIRP4
+CNSTI4 17292
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $469
+CNSTI4 5
+RETI4
+ADDRGP4 $456
+JUMPV
+LABELV $469
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17252
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LEI4 $471
+ADDRFP4 0
+INDIRP4
+CNSTI4 17300
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LEI4 $471
+CNSTI4 9
+RETI4
+ADDRGP4 $456
+JUMPV
+LABELV $471
+CNSTI4 -1
+RETI4
+LABELV $456
+endproc BotSelectActivateWeapon 64 0
+export BotClearPath
+proc BotClearPath 396 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18508
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $474
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 17
+BANDI4
+CNSTI4 0
+NEI4 $476
+ADDRFP4 0
+INDIRP4
+CNSTI4 18508
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 276
+ADDRLP4 12+72+12
+INDIRB
+ASGNB 12
+ADDRLP4 276+8
+ADDRLP4 276+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 276
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 276+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17188
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 276+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17192
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 356
+ADDRGP4 BotSelectActivateWeapon
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $485
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $485
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $487
+ADDRLP4 360
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ADDRLP4 360
+INDIRP4
+INDIRI4
+CNSTI4 17
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+NEI4 $489
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+EQI4 $491
+ADDRLP4 288
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRLP4 372
+CNSTP4 0
+ASGNP4
+ADDRLP4 372
+INDIRP4
+ARGP4
+ADDRLP4 372
+INDIRP4
+ARGP4
+ADDRLP4 276
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 288+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $497
+ADDRLP4 288+56
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $493
+LABELV $497
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Attack
+CALLV
+pop
+LABELV $493
+LABELV $491
+LABELV $489
+LABELV $487
+LABELV $476
+LABELV $474
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $498
+ADDRFP4 0
+INDIRP4
+CNSTI4 18460
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $498
+ADDRFP4 0
+INDIRP4
+CNSTI4 18460
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $500
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 17
+BANDI4
+CNSTI4 0
+NEI4 $500
+ADDRLP4 268
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 272
+CNSTI4 -1
+ASGNI4
+ADDRLP4 260
+CNSTI4 0
+ASGNI4
+ADDRGP4 $505
+JUMPV
+LABELV $502
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18512
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 12+72+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+72+12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+72+12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 356
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 264
+ADDRLP4 356
+INDIRF4
+ASGNF4
+ADDRLP4 264
+INDIRF4
+ADDRLP4 268
+INDIRF4
+GEF4 $516
+ADDRLP4 268
+ADDRLP4 264
+INDIRF4
+ASGNF4
+ADDRLP4 272
+ADDRLP4 260
+INDIRI4
+ASGNI4
+LABELV $516
+LABELV $503
+ADDRLP4 260
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $505
+ADDRLP4 260
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18768
+ADDP4
+INDIRI4
+LTI4 $502
+ADDRLP4 272
+INDIRI4
+CNSTI4 -1
+EQI4 $518
+ADDRLP4 272
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18512
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 276
+ADDRLP4 12+72+12
+INDIRB
+ASGNB 12
+ADDRLP4 276+8
+ADDRLP4 276+8
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 276
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 276+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17188
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 276+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17192
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 360
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17244
+ADDP4
+INDIRI4
+ADDRLP4 360
+INDIRI4
+LEI4 $527
+ADDRFP4 0
+INDIRP4
+CNSTI4 17284
+ADDP4
+INDIRI4
+ADDRLP4 360
+INDIRI4
+LEI4 $527
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRGP4 $528
+JUMPV
+LABELV $527
+ADDRLP4 368
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17232
+ADDP4
+INDIRI4
+ADDRLP4 368
+INDIRI4
+LEI4 $529
+ADDRFP4 0
+INDIRP4
+CNSTI4 17292
+ADDP4
+INDIRI4
+ADDRLP4 368
+INDIRI4
+LEI4 $529
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRGP4 $530
+JUMPV
+LABELV $529
+ADDRLP4 376
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17252
+ADDP4
+INDIRI4
+ADDRLP4 376
+INDIRI4
+LEI4 $531
+ADDRFP4 0
+INDIRP4
+CNSTI4 17300
+ADDP4
+INDIRI4
+ADDRLP4 376
+INDIRI4
+LEI4 $531
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRGP4 $532
+JUMPV
+LABELV $531
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $532
+LABELV $530
+LABELV $528
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $533
+ADDRLP4 380
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 380
+INDIRP4
+ADDRLP4 380
+INDIRP4
+INDIRI4
+CNSTI4 17
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+NEI4 $535
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 384
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 384
+INDIRI4
+CNSTI4 0
+EQI4 $537
+ADDRLP4 288
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRLP4 392
+CNSTP4 0
+ASGNP4
+ADDRLP4 392
+INDIRP4
+ARGP4
+ADDRLP4 392
+INDIRP4
+ARGP4
+ADDRLP4 276
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 288+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $543
+ADDRLP4 288+56
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $539
+LABELV $543
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Attack
+CALLV
+pop
+LABELV $539
+LABELV $537
+LABELV $535
+LABELV $533
+LABELV $518
+LABELV $500
+LABELV $473
+endproc BotClearPath 396 28
+export AIEnter_Seek_ActivateEntity
+proc AIEnter_Seek_ActivateEntity 0 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $545
+ARGP4
+ADDRGP4 $70
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+ADDRGP4 AINode_Seek_ActivateEntity
+ASGNP4
+LABELV $544
+endproc AIEnter_Seek_ActivateEntity 0 16
+export AINode_Seek_ActivateEntity
+proc AINode_Seek_ActivateEntity 360 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $547
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $549
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $546
+JUMPV
+LABELV $547
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $550
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $552
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $546
+JUMPV
+LABELV $550
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $553
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $555
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $546
+JUMPV
+LABELV $553
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotCanGrapple
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $556
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ADDRLP4 312
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $556
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $558
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 320
+INDIRP4
+ADDRLP4 320
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $558
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $560
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $562
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $546
+JUMPV
+LABELV $560
+ADDRLP4 324
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 324
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 324
+INDIRP4
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 328
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRLP4 324
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 328
+INDIRI4
+EQI4 $563
+ADDRLP4 76
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRLP4 336
+CNSTP4 0
+ASGNP4
+ADDRLP4 336
+INDIRP4
+ARGP4
+ADDRLP4 336
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 80
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 76+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $569
+ADDRLP4 76+56
+INDIRI4
+ADDRLP4 52
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $565
+LABELV $569
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+NEI4 $570
+ADDRLP4 348
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 348
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 348
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17188
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17192
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 284
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 284
+ARGP4
+ADDRLP4 356
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $574
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Attack
+CALLV
+pop
+LABELV $574
+LABELV $570
+LABELV $565
+LABELV $563
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $576
+ADDRLP4 52
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 144
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 144+24
+ARGP4
+ADDRLP4 332
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+NEI4 $578
+CNSTI4 0
+ARGI4
+ADDRGP4 $581
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+LABELV $578
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $582
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $584
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $546
+JUMPV
+LABELV $584
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $586
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $588
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+LABELV $588
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $590
+ARGP4
+ADDRLP4 140
+INDIRP4
+CALLV
+pop
+ADDRGP4 $587
+JUMPV
+LABELV $586
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $591
+ARGP4
+ADDRLP4 140
+INDIRP4
+CALLV
+pop
+LABELV $587
+CNSTI4 0
+RETI4
+ADDRGP4 $546
+JUMPV
+LABELV $582
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 52
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $577
+JUMPV
+LABELV $576
+ADDRLP4 52
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $592
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $593
+JUMPV
+LABELV $592
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $594
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 332
+ADDRGP4 BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $596
+CNSTI4 0
+ARGI4
+ADDRGP4 $598
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+LABELV $596
+LABELV $594
+LABELV $593
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $599
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $601
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $546
+JUMPV
+LABELV $601
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $603
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $605
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+LABELV $605
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $590
+ARGP4
+ADDRLP4 140
+INDIRP4
+CALLV
+pop
+ADDRGP4 $604
+JUMPV
+LABELV $603
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $591
+ARGP4
+ADDRLP4 140
+INDIRP4
+CALLV
+pop
+LABELV $604
+CNSTI4 0
+RETI4
+ADDRGP4 $546
+JUMPV
+LABELV $599
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 AIEnter_Seek_ActivateEntity
+ARGP4
+ADDRLP4 332
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $607
+CNSTI4 0
+RETI4
+ADDRGP4 $546
+JUMPV
+LABELV $607
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $609
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $609
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AIEnter_Seek_ActivateEntity
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+LABELV $577
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $611
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $613
+ADDRLP4 336
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 336
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 336
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17188
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17192
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 0+40
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $613
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $620
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotSelectActivateWeapon
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $624
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $624
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $620
+LABELV $611
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $627
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $628
+JUMPV
+LABELV $627
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $631
+ADDRLP4 332
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 17152
+ADDP4
+INDIRF4
+MULF4
+GEF4 $632
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 56
+ADDRLP4 272
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 272+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 272+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 340
+ADDRFP4 0
+INDIRP4
+CNSTI4 18836
+ADDP4
+ASGNP4
+ADDRLP4 340
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 340
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $632
+JUMPV
+LABELV $631
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $640
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 272
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+EQI4 $642
+ADDRLP4 56
+ADDRLP4 272
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 272+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 272+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $643
+JUMPV
+LABELV $642
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $643
+ADDRLP4 340
+ADDRFP4 0
+INDIRP4
+CNSTI4 18836
+ADDP4
+ASGNP4
+ADDRLP4 340
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 340
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $640
+LABELV $632
+LABELV $628
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $649
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $649
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 332
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $653
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+EQI4 $655
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $657
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+ADDRGP4 $656
+JUMPV
+LABELV $655
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $657
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+LABELV $656
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+LABELV $653
+CNSTI4 1
+RETI4
+LABELV $546
+endproc AINode_Seek_ActivateEntity 360 28
+export AIEnter_Seek_NBG
+proc AIEnter_Seek_NBG 204 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ADDRGP4 BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $659
+ADDRLP4 0+44
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $662
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRGP4 $660
+JUMPV
+LABELV $659
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $662
+ARGP4
+ADDRGP4 $663
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+LABELV $660
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+ADDRGP4 AINode_Seek_NBG
+ASGNP4
+LABELV $658
+endproc AIEnter_Seek_NBG 204 16
+export AINode_Seek_NBG
+proc AINode_Seek_NBG 196 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $665
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $667
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $664
+JUMPV
+LABELV $665
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $668
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $670
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $664
+JUMPV
+LABELV $668
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $671
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $673
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $664
+JUMPV
+LABELV $671
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotCanGrapple
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $674
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $674
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $676
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $676
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $678
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 164
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $678
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $680
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $681
+JUMPV
+LABELV $680
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $682
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $682
+LABELV $681
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $684
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18348
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1028443341
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $686
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $664
+JUMPV
+LABELV $684
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $687
+CNSTI4 0
+RETI4
+ADDRGP4 $664
+JUMPV
+LABELV $687
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $689
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $689
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $691
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $692
+JUMPV
+LABELV $691
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $695
+ADDRLP4 180
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 17152
+ADDP4
+INDIRF4
+MULF4
+GEF4 $696
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 120
+ADDRLP4 108
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 108+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 188
+ADDRFP4 0
+INDIRP4
+CNSTI4 18836
+ADDP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 188
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $696
+JUMPV
+LABELV $695
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $704
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotGetSecondGoal
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $706
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRGP4 BotGetTopGoal
+CALLI4
+pop
+LABELV $706
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 108
+ARGP4
+ADDRLP4 188
+ADDRGP4 BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $708
+ADDRLP4 120
+ADDRLP4 108
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 108+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $709
+JUMPV
+LABELV $708
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $709
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 18836
+ADDP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 192
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $704
+LABELV $696
+LABELV $692
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $715
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $715
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 180
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $719
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $721
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $723
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+ADDRGP4 $722
+JUMPV
+LABELV $721
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $723
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+LABELV $722
+LABELV $719
+CNSTI4 1
+RETI4
+LABELV $664
+endproc AINode_Seek_NBG 196 20
+export AIEnter_Seek_LTG
+proc AIEnter_Seek_LTG 204 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ADDRGP4 BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $725
+ADDRLP4 0+44
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $728
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRGP4 $726
+JUMPV
+LABELV $725
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $728
+ARGP4
+ADDRGP4 $663
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+LABELV $726
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+ADDRGP4 AINode_Seek_LTG
+ASGNP4
+LABELV $724
+endproc AIEnter_Seek_LTG 204 16
+export AINode_Seek_LTG
+proc AINode_Seek_LTG 216 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $730
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $732
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $729
+JUMPV
+LABELV $730
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $733
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $735
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $729
+JUMPV
+LABELV $733
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $736
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $738
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $729
+JUMPV
+LABELV $736
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 BotChat_Random
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $739
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18352
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $741
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $729
+JUMPV
+LABELV $739
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotCanGrapple
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $742
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $742
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $744
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 164
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $744
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $746
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 172
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $746
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18424
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $748
+ADDRLP4 172
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17152
+ADDP4
+INDIRF4
+GEF4 $750
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Gesture
+CALLV
+pop
+LABELV $750
+LABELV $748
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 172
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $752
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $754
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $756
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $729
+JUMPV
+LABELV $754
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $756
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $729
+JUMPV
+LABELV $752
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotTeamGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $757
+CNSTI4 1
+RETI4
+ADDRGP4 $729
+JUMPV
+LABELV $757
+ADDRFP4 0
+INDIRP4
+CNSTI4 18348
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $759
+ADDRFP4 0
+INDIRP4
+CNSTI4 18348
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotWantsToCamp
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $761
+ADDRLP4 108
+CNSTI4 400
+ASGNI4
+ADDRGP4 $762
+JUMPV
+LABELV $761
+ADDRLP4 108
+CNSTI4 150
+ASGNI4
+LABELV $762
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $763
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $765
+ADDRLP4 108
+CNSTI4 50
+ASGNI4
+LABELV $765
+LABELV $763
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 188
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $767
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CNSTF4 1008981770
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $769
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $729
+JUMPV
+LABELV $767
+LABELV $759
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $770
+CNSTI4 0
+RETI4
+ADDRGP4 $729
+JUMPV
+LABELV $770
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $772
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18324
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $772
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $774
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $775
+JUMPV
+LABELV $774
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $778
+ADDRLP4 192
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 17152
+ADDP4
+INDIRF4
+MULF4
+GEF4 $779
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 200
+ADDRFP4 0
+INDIRP4
+CNSTI4 18836
+ADDP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 200
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $779
+JUMPV
+LABELV $778
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $787
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 112
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $789
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $790
+JUMPV
+LABELV $789
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 200
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 200
+INDIRF4
+CNSTF4 0
+EQF4 $795
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $796
+JUMPV
+LABELV $795
+ADDRLP4 204
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 17152
+ADDP4
+INDIRF4
+MULF4
+GEF4 $799
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 212
+ADDRFP4 0
+INDIRP4
+CNSTI4 18836
+ADDP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 212
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $799
+LABELV $796
+LABELV $790
+ADDRLP4 208
+ADDRFP4 0
+INDIRP4
+CNSTI4 18836
+ADDP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 208
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $787
+LABELV $779
+LABELV $775
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $805
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $805
+CNSTI4 1
+RETI4
+LABELV $729
+endproc AINode_Seek_LTG 216 20
+export AIEnter_Battle_Fight
+proc AIEnter_Battle_Fight 4 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $810
+ARGP4
+ADDRGP4 $70
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+ADDRGP4 AINode_Battle_Fight
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -65
+BANDI4
+ASGNI4
+LABELV $809
+endproc AIEnter_Battle_Fight 4 16
+export AIEnter_Battle_SuicidalFight
+proc AIEnter_Battle_SuicidalFight 4 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $810
+ARGP4
+ADDRGP4 $70
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+ADDRGP4 AINode_Battle_Fight
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $811
+endproc AIEnter_Battle_SuicidalFight 4 16
+export AINode_Battle_Fight
+proc AINode_Battle_Fight 280 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $813
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $815
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $812
+JUMPV
+LABELV $813
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $816
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $818
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $812
+JUMPV
+LABELV $816
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+EQI4 $819
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $821
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $812
+JUMPV
+LABELV $819
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 212
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+EQI4 $822
+LABELV $822
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $824
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $826
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $812
+JUMPV
+LABELV $824
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18392
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $827
+ADDRFP4 0
+INDIRP4
+CNSTI4 18392
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $828
+ADDRFP4 0
+INDIRP4
+CNSTI4 18392
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18260
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $831
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChat_EnemySuicide
+CALLI4
+pop
+LABELV $831
+ADDRFP4 0
+INDIRP4
+CNSTI4 18240
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+NEI4 $833
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 220
+ADDRGP4 BotChat_Kill
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 0
+EQI4 $833
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 228
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18352
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 228
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $835
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+ADDRGP4 $834
+JUMPV
+LABELV $833
+ADDRFP4 0
+INDIRP4
+CNSTI4 18324
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $835
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+LABELV $834
+CNSTI4 0
+RETI4
+ADDRGP4 $812
+JUMPV
+LABELV $827
+ADDRLP4 56
+ARGP4
+ADDRLP4 216
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+EQI4 $836
+ADDRFP4 0
+INDIRP4
+CNSTI4 18392
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $836
+LABELV $828
+ADDRLP4 56
+ARGP4
+ADDRLP4 216
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+EQI4 $838
+ADDRLP4 220
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1045220557
+GEF4 $840
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $842
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $812
+JUMPV
+LABELV $840
+LABELV $838
+ADDRLP4 184
+ADDRLP4 56+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $844
+LABELV $844
+ADDRLP4 184
+ARGP4
+ADDRLP4 220
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 220
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $846
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 228
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+EQI4 $846
+ADDRFP4 0
+INDIRP4
+CNSTI4 18800
+ADDP4
+ADDRLP4 184
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 18796
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+LABELV $846
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18292
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+LEI4 $848
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 BotChat_HitNoDeath
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+EQI4 $850
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18352
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $852
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $812
+JUMPV
+LABELV $850
+LABELV $848
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18296
+ADDP4
+INDIRI4
+LEI4 $853
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 244
+ADDRGP4 BotChat_HitNoKill
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+EQI4 $855
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 252
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18352
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $857
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $812
+JUMPV
+LABELV $855
+LABELV $853
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 248
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 248
+INDIRF4
+CNSTF4 0
+NEF4 $858
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 252
+ADDRGP4 BotWantsToChase
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+EQI4 $860
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $862
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $812
+JUMPV
+LABELV $860
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $862
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $812
+JUMPV
+LABELV $858
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotBattleUseItems
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 252
+ADDRGP4 BotCanGrapple
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+EQI4 $863
+ADDRLP4 256
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 256
+INDIRP4
+ADDRLP4 256
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $863
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+EQI4 $865
+ADDRLP4 264
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ADDRLP4 264
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $865
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+EQI4 $867
+ADDRLP4 272
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+ADDRLP4 272
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $867
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAttackMove
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $869
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18324
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $869
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+NEI4 $871
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $873
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $875
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $812
+JUMPV
+LABELV $873
+LABELV $871
+CNSTI4 1
+RETI4
+LABELV $812
+endproc AINode_Battle_Fight 280 20
+export AIEnter_Battle_Chase
+proc AIEnter_Battle_Chase 0 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $877
+ARGP4
+ADDRGP4 $70
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18340
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+ADDRGP4 AINode_Battle_Chase
+ASGNP4
+LABELV $876
+endproc AIEnter_Battle_Chase 0 16
+export AINode_Battle_Chase
+proc AINode_Battle_Chase 212 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $879
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $881
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $878
+JUMPV
+LABELV $879
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $882
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $884
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $878
+JUMPV
+LABELV $882
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $885
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $887
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $878
+JUMPV
+LABELV $885
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $888
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $890
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $878
+JUMPV
+LABELV $888
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 152
+INDIRF4
+CNSTF4 0
+EQF4 $891
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $877
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $878
+JUMPV
+LABELV $891
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 156
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $893
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $895
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $878
+JUMPV
+LABELV $893
+ADDRFP4 0
+INDIRP4
+CNSTI4 18796
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $896
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $898
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $878
+JUMPV
+LABELV $896
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotCanGrapple
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $899
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 164
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $899
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $901
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 172
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $901
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $903
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ADDRLP4 180
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $903
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRLP4 0+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 18796
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 18800
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $917
+ADDRFP4 0
+INDIRP4
+CNSTI4 18340
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $917
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 18340
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 184
+INDIRF4
+CNSTF4 0
+EQF4 $921
+ADDRLP4 184
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+GEF4 $919
+LABELV $921
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $922
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $878
+JUMPV
+LABELV $919
+ADDRFP4 0
+INDIRP4
+CNSTI4 18348
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $923
+ADDRFP4 0
+INDIRP4
+CNSTI4 18348
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 108
+CNSTF4 1125515264
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 192
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $925
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 108
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $927
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $878
+JUMPV
+LABELV $925
+LABELV $923
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+ARGP4
+ADDRLP4 192
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $928
+CNSTI4 0
+RETI4
+ADDRGP4 $878
+JUMPV
+LABELV $928
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotMoveToGoal
+CALLV
+pop
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $930
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18324
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $930
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRLP4 56+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $932
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ADDRLP4 56+40
+INDIRB
+ASGNB 12
+ADDRGP4 $933
+JUMPV
+LABELV $932
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $936
+ADDRFP4 0
+INDIRP4
+CNSTI4 18340
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $938
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $939
+JUMPV
+LABELV $938
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 112
+ARGP4
+ADDRLP4 204
+ADDRGP4 BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+EQI4 $940
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $941
+JUMPV
+LABELV $940
+ADDRLP4 56+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $941
+LABELV $939
+ADDRLP4 200
+ADDRFP4 0
+INDIRP4
+CNSTI4 18836
+ADDP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 200
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $936
+LABELV $933
+ADDRLP4 56+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $947
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+ADDRLP4 56+24
+INDIRI4
+ASGNI4
+LABELV $947
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18796
+ADDP4
+INDIRI4
+NEI4 $951
+ADDRFP4 0
+INDIRP4
+CNSTI4 18340
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $951
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+EQI4 $953
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $955
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $878
+JUMPV
+LABELV $953
+CNSTI4 1
+RETI4
+LABELV $878
+endproc AINode_Battle_Chase 212 20
+export AIEnter_Battle_Retreat
+proc AIEnter_Battle_Retreat 0 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $957
+ARGP4
+ADDRGP4 $70
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+ADDRGP4 AINode_Battle_Retreat
+ASGNP4
+LABELV $956
+endproc AIEnter_Battle_Retreat 0 16
+export AINode_Battle_Retreat
+proc AINode_Battle_Retreat 364 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $959
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $961
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $958
+JUMPV
+LABELV $959
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $962
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $964
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $958
+JUMPV
+LABELV $962
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $965
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $967
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $958
+JUMPV
+LABELV $965
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $968
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $970
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $958
+JUMPV
+LABELV $968
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 108
+ARGP4
+ADDRLP4 284
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $971
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $973
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $958
+JUMPV
+LABELV $971
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $974
+LABELV $974
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 BotCanGrapple
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $976
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $976
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $978
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ADDRLP4 308
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $978
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 BotWantsToChase
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $980
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $982
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $958
+JUMPV
+LABELV $980
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 324
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 324
+INDIRF4
+CNSTF4 0
+EQF4 $983
+ADDRFP4 0
+INDIRP4
+CNSTI4 18344
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 108+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $986
+LABELV $986
+ADDRLP4 240
+ARGP4
+ADDRLP4 328
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 236
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRLP4 332
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+EQI4 $988
+ADDRLP4 332
+INDIRI4
+ARGI4
+ADDRLP4 336
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+EQI4 $988
+ADDRFP4 0
+INDIRP4
+CNSTI4 18800
+ADDP4
+ADDRLP4 240
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 18796
+ADDP4
+ADDRLP4 236
+INDIRI4
+ASGNI4
+LABELV $988
+LABELV $983
+ADDRFP4 0
+INDIRP4
+CNSTI4 18344
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+GEF4 $990
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $992
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $958
+JUMPV
+LABELV $990
+ADDRFP4 0
+INDIRP4
+CNSTI4 18344
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $993
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 328
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+EQI4 $995
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $997
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $958
+JUMPV
+LABELV $995
+LABELV $993
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotTeamGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotBattleUseItems
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 332
+ADDRGP4 BotLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 0
+NEI4 $998
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1000
+ARGP4
+ADDRGP4 AIEnter_Battle_SuicidalFight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $958
+JUMPV
+LABELV $998
+ADDRFP4 0
+INDIRP4
+CNSTI4 18348
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1001
+ADDRFP4 0
+INDIRP4
+CNSTI4 18348
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 252
+CNSTF4 1125515264
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $1003
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+EQI4 $1005
+ADDRLP4 252
+CNSTF4 1112014848
+ASGNF4
+LABELV $1005
+LABELV $1003
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 252
+INDIRF4
+ARGF4
+ADDRLP4 340
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+EQI4 $1007
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 252
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1009
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $958
+JUMPV
+LABELV $1007
+LABELV $1001
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+EQI4 $1010
+CNSTI4 0
+RETI4
+ADDRGP4 $958
+JUMPV
+LABELV $1010
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1012
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18324
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1012
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $1014
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1015
+JUMPV
+LABELV $1014
+ADDRLP4 344
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 344
+INDIRI4
+NEI4 $1018
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+ADDRLP4 344
+INDIRI4
+NEI4 $1018
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 348
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 256
+ADDRLP4 348
+INDIRF4
+ASGNF4
+ADDRLP4 256
+INDIRF4
+CNSTF4 1050253722
+LEF4 $1021
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1022
+JUMPV
+LABELV $1021
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 240
+ARGP4
+ADDRLP4 356
+ADDRGP4 BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $1023
+ADDRLP4 260
+ADDRLP4 240
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 240+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 240+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1024
+JUMPV
+LABELV $1023
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $1024
+ADDRLP4 360
+ADDRFP4 0
+INDIRP4
+CNSTI4 18836
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 360
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1022
+LABELV $1018
+LABELV $1015
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1030
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $1030
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $958
+endproc AINode_Battle_Retreat 364 20
+export AIEnter_Battle_NBG
+proc AIEnter_Battle_NBG 0 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1035
+ARGP4
+ADDRGP4 $70
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+ADDRGP4 AINode_Battle_NBG
+ASGNP4
+LABELV $1034
+endproc AIEnter_Battle_NBG 0 16
+export AINode_Battle_NBG
+proc AINode_Battle_NBG 352 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+EQI4 $1037
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1039
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1036
+JUMPV
+LABELV $1037
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $1040
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1042
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1036
+JUMPV
+LABELV $1040
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+EQI4 $1043
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1045
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1036
+JUMPV
+LABELV $1043
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1046
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1048
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1036
+JUMPV
+LABELV $1046
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 108
+ARGP4
+ADDRLP4 280
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $1049
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1051
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1036
+JUMPV
+LABELV $1049
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotCanGrapple
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $1052
+ADDRLP4 288
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 288
+INDIRP4
+ADDRLP4 288
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $1052
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1054
+ADDRLP4 296
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+ADDRLP4 296
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $1054
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $1056
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $1056
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 308
+INDIRF4
+CNSTF4 0
+EQF4 $1058
+ADDRFP4 0
+INDIRP4
+CNSTI4 18344
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 108+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1061
+LABELV $1061
+ADDRLP4 240
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 236
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRLP4 316
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $1063
+ADDRLP4 316
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+EQI4 $1063
+ADDRFP4 0
+INDIRP4
+CNSTI4 18800
+ADDP4
+ADDRLP4 240
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 18796
+ADDP4
+ADDRLP4 236
+INDIRI4
+ASGNI4
+LABELV $1063
+LABELV $1058
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+NEI4 $1065
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1066
+JUMPV
+LABELV $1065
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 316
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $1067
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1067
+LABELV $1066
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1069
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+EQI4 $1071
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1073
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+ADDRGP4 $1072
+JUMPV
+LABELV $1071
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1073
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+LABELV $1072
+CNSTI4 0
+RETI4
+ADDRGP4 $1036
+JUMPV
+LABELV $1069
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+EQI4 $1074
+CNSTI4 0
+RETI4
+ADDRGP4 $1036
+JUMPV
+LABELV $1074
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1076
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1076
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+ARGP4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $1078
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1079
+JUMPV
+LABELV $1078
+ADDRLP4 332
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 332
+INDIRI4
+NEI4 $1082
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+ADDRLP4 332
+INDIRI4
+NEI4 $1082
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 336
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 336
+INDIRF4
+ASGNF4
+ADDRLP4 252
+INDIRF4
+CNSTF4 1050253722
+LEF4 $1085
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1086
+JUMPV
+LABELV $1085
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 240
+ARGP4
+ADDRLP4 344
+ADDRGP4 BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $1087
+ADDRLP4 256
+ADDRLP4 240
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256+4
+ADDRLP4 240+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256+8
+ADDRLP4 240+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 256
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1088
+JUMPV
+LABELV $1087
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $1088
+ADDRLP4 348
+ADDRFP4 0
+INDIRP4
+CNSTI4 18836
+ADDP4
+ASGNP4
+ADDRLP4 348
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 348
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1086
+LABELV $1082
+LABELV $1079
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1094
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $1094
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1036
+endproc AINode_Battle_NBG 352 20
+bss
+export nodeswitch
+align 1
+LABELV nodeswitch
+skip 7344
+export numnodeswitches
+align 4
+LABELV numnodeswitches
+skip 4
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotTeamAI
+import AIEnter_Seek_Camp
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import ctf_blueflag
+import ctf_redflag
+import bot_offhandgrapple
+import bot_droppedweight
+import bot_challenge
+import bot_testrchat
+import bot_testichat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxplayers
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import PlayerOnSameTeamFromName
+import PlayerFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckBlockedTeammates
+import BotCheckAttack
+import BotAimAtEnemy
+import BotVisibilityStats
+import BotEndVisibilityFrame
+import BotBeginVisibilityFrame
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotCountTeamMates
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import BotCanCamp
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanGrapple
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import EasyPlayerName
+import PlayerName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityIsShooting
+import SenseCarriesCubes
+import SenseIsInvisible
+import EntityIsInvisible
+import PowerupsCarryFlag
+import PlayerCarriesFlag
+import PlayerIsDead
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotPlayerStateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import bot_reloadcharacters
+import bot_showteamgoals
+import bot_shownodechanges
+import bot_developer
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetPlayerState
+import BotAI_DebugLineShow
+import BotAI_DebugLineDelete
+import BotAI_DebugLineCreate
+import BotAI_InPVS
+import BotAI_PointContents
+import BotAI_EntityTrace
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotLibVarGetValue
+import BotNextEntity
+import BotSense
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotInitPhysicsSettings
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotRoutingAreaChanged
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotPrepareItemWeights
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotMatchTemplatesContainsString
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatchLinear
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import GetBotLibAPI
+import g_instagib
+import g_playerCapsule
+import g_proxMineTimeout
+import g_singlePlayer
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGamePlayers
+import g_maxplayers
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import trap_AAS_DropToFloor
+import trap_AAS_HorizontalVelocityForJump
+import trap_AAS_AgainstLadder
+import trap_AAS_JumpReachRunStart
+import trap_AAS_Swimming
+import trap_AAS_OnGround
+import trap_AAS_PredictPlayerMovement
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaTravelTime
+import trap_AAS_EnableRoutingArea
+import trap_AAS_RandomGoalArea
+import trap_AAS_ReachabilityFromNum
+import trap_AAS_NextAreaReachability
+import trap_AAS_AreaContentsTravelFlags
+import trap_AAS_TravelFlagForType
+import trap_AAS_AreaDoNotEnter
+import trap_AAS_AreaJumpPad
+import trap_AAS_AreaLadder
+import trap_AAS_AreaGrounded
+import trap_AAS_AreaSlime
+import trap_AAS_AreaLava
+import trap_AAS_AreaLiquid
+import trap_AAS_AreaSwim
+import trap_AAS_AreaCrouch
+import trap_AAS_AreaGroundFaceArea
+import trap_AAS_NextModelReachability
+import trap_AAS_BestReachableFromJumpPadArea
+import trap_AAS_BestReachableArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_TracePlayerBBox
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_FloodAreas
+import trap_AAS_ShowReachableAreas
+import trap_AAS_ShowReachability
+import trap_AAS_DrawArrow
+import trap_AAS_PrintTravelType
+import trap_AAS_DrawCross
+import trap_AAS_ShowAreaPolygons
+import trap_AAS_ShowArea
+import trap_AAS_ShowFace
+import trap_AAS_ShowBoundingBox
+import trap_AAS_DrawPlaneCross
+import trap_AAS_DrawPermanentCross
+import trap_AAS_PermanentLine
+import trap_AAS_DebugLine
+import trap_AAS_ClearShownPolygons
+import trap_AAS_ClearShownDebugLines
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_Loaded
+import trap_AAS_PointInsideArea
+import trap_AAS_BBoxReachabilityAreas
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_RegisterModel
+import trap_DebugPolygonDelete
+import trap_DebugPolygonShow
+import trap_DebugPolygonCreate
+import trap_ClientCommand
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_ClipToEntitiesCapsule
+import trap_ClipToEntities
+import trap_TraceCapsule
+import trap_Trace
+import trap_GetBrushBounds
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_SetConfigstringRestrictions
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommandEx
+import trap_DropPlayer
+import trap_SetNetFields
+import trap_LocateGameData
+import Pickup_Team
+import Svcmd_TeamInfoStats_f
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_BuildLocationTree
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotWeightBench_f
+import Svcmd_BotThinkReport_f
+import Svcmd_BotMatchBench_f
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownPlayer
+import BotAISetupPlayer
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import G_BotInitBotLib
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBotComplete
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunPlayer
+import PlayerEndFrame
+import PlayerThink
+import PlayerHandicap
+import ClientCommand
+import PlayerBegin
+import PlayerDisconnect
+import PlayerUserinfoChanged
+import PlayerConnect
+import G_Error
+import G_Printf
+import G_DPrintf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MovePlayerToIntermission
+import StringIsInteger
+import ConcatArgs
+import G_ScoreboardChanged
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import G_RegisterCommands
+import G_ConsoleCompleteArgument
+import G_ConsoleCommand
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import PlayerSpawn
+import InitBodyQue
+import BeginIntermission
+import PlayerRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetPlayerViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossPlayerCubes
+import TossPlayerGametypeItems
+import TossPlayerItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_SetBrushModel
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import trap_SendServerCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import FinishSpawningItem
+import G_SpawnItem
+import LaunchItem
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1073
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $1051
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1048
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1045
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1042
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1039
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1035
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 0
+align 1
+LABELV $1009
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $1000
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $997
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $992
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $982
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $973
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $970
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $967
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $964
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $961
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $957
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $955
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $927
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $922
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $898
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 0
+align 1
+LABELV $895
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $890
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $887
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $884
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $881
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $877
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $875
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $862
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $857
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $852
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $842
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $835
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $826
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $821
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $818
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $815
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $810
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $769
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $756
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $741
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $738
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $735
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $732
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $728
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 0
+align 1
+LABELV $723
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $686
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $673
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $670
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $667
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $663
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $662
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 0
+align 1
+LABELV $657
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $598
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $591
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $590
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $581
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $562
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $555
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $552
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $549
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $545
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $449
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $441
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $439
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $436
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $426
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $424
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $420
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $418
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $410
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $386
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $383
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $368
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $367
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $333
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $332
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $323
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $310
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $309
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 0
+align 1
+LABELV $278
+byte 1 105
+byte 1 110
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $277
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $264
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $259
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $251
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $248
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $243
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $236
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $233
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $222
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $219
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $218
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $209
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $202
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 76
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 84
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $185
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $168
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $165
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $146
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $145
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $139
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 32
+byte 1 40
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 117
+byte 1 99
+byte 1 107
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $72
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 50
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $70
+byte 1 0
+align 1
+LABELV $69
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $64
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 73
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
@@ -0,0 +1,25997 @@
+export BotSetUserInfo
+code
+proc BotSetUserInfo 1024 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 PlayerUserinfoChanged
+CALLV
+pop
+LABELV $62
+endproc BotSetUserInfo 1024 12
+export BotCTFCarryingFlag
+proc BotCTFCarryingFlag 0 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+EQI4 $64
+CNSTI4 0
+RETI4
+ADDRGP4 $63
+JUMPV
+LABELV $64
+ADDRFP4 0
+INDIRP4
+CNSTI4 17380
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $66
+CNSTI4 1
+RETI4
+ADDRGP4 $63
+JUMPV
+LABELV $66
+ADDRFP4 0
+INDIRP4
+CNSTI4 17384
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $68
+CNSTI4 2
+RETI4
+ADDRGP4 $63
+JUMPV
+LABELV $68
+CNSTI4 0
+RETI4
+LABELV $63
+endproc BotCTFCarryingFlag 0 0
+export BotTeam
+proc BotTeam 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $73
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $71
+LABELV $73
+CNSTI4 0
+RETI4
+ADDRGP4 $70
+JUMPV
+LABELV $71
+CNSTI4 1528
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $74
+CNSTI4 1
+RETI4
+ADDRGP4 $70
+JUMPV
+LABELV $74
+CNSTI4 1528
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $76
+CNSTI4 2
+RETI4
+ADDRGP4 $70
+JUMPV
+LABELV $76
+CNSTI4 0
+RETI4
+LABELV $70
+endproc BotTeam 4 0
+export BotOppositeTeam
+proc BotOppositeTeam 12 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $82
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $83
+ADDRGP4 $79
+JUMPV
+LABELV $82
+CNSTI4 2
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $83
+CNSTI4 1
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $79
+CNSTI4 0
+RETI4
+LABELV $78
+endproc BotOppositeTeam 12 4
+export BotEnemyFlag
+proc BotEnemyFlag 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $85
+ADDRGP4 ctf_blueflag
+RETP4
+ADDRGP4 $84
+JUMPV
+LABELV $85
+ADDRGP4 ctf_redflag
+RETP4
+LABELV $84
+endproc BotEnemyFlag 4 4
+export BotTeamFlag
+proc BotTeamFlag 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $88
+ADDRGP4 ctf_redflag
+RETP4
+ADDRGP4 $87
+JUMPV
+LABELV $88
+ADDRGP4 ctf_blueflag
+RETP4
+LABELV $87
+endproc BotTeamFlag 4 4
+export EntityIsDead
+proc EntityIsDead 4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 PlayerIsDead
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $90
+endproc EntityIsDead 4 4
+export PlayerIsDead
+proc PlayerIsDead 12 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $92
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $92
+ADDRLP4 0
+CNSTI4 720
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $96
+ADDRLP4 8
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $94
+LABELV $96
+CNSTI4 0
+RETI4
+ADDRGP4 $91
+JUMPV
+LABELV $94
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $97
+CNSTI4 1
+RETI4
+ADDRGP4 $91
+JUMPV
+LABELV $97
+LABELV $92
+CNSTI4 0
+RETI4
+LABELV $91
+endproc PlayerIsDead 12 0
+export EntityCarriesFlag
+proc EntityCarriesFlag 4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 PowerupsCarryFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $99
+endproc EntityCarriesFlag 4 4
+export PlayerCarriesFlag
+proc PlayerCarriesFlag 4 4
+CNSTI4 720
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+84+228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 PowerupsCarryFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $100
+endproc PlayerCarriesFlag 4 4
+export PowerupsCarryFlag
+proc PowerupsCarryFlag 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $104
+CNSTI4 1
+RETI4
+ADDRGP4 $103
+JUMPV
+LABELV $104
+ADDRFP4 0
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $106
+CNSTI4 1
+RETI4
+ADDRGP4 $103
+JUMPV
+LABELV $106
+CNSTI4 0
+RETI4
+LABELV $103
+endproc PowerupsCarryFlag 0 0
+export EntityIsShooting
+proc EntityIsShooting 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $109
+CNSTI4 1
+RETI4
+ADDRGP4 $108
+JUMPV
+LABELV $109
+CNSTI4 0
+RETI4
+LABELV $108
+endproc EntityIsShooting 0 0
+export EntityIsChatting
+proc EntityIsChatting 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $112
+CNSTI4 1
+RETI4
+ADDRGP4 $111
+JUMPV
+LABELV $112
+CNSTI4 0
+RETI4
+LABELV $111
+endproc EntityIsChatting 0 0
+export EntityHasQuad
+proc EntityHasQuad 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $115
+CNSTI4 1
+RETI4
+ADDRGP4 $114
+JUMPV
+LABELV $115
+CNSTI4 0
+RETI4
+LABELV $114
+endproc EntityHasQuad 0 0
+export EntityIsInvisible
+proc EntityIsInvisible 8 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $118
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $120
+CNSTI4 0
+RETI4
+ADDRGP4 $117
+JUMPV
+LABELV $120
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $122
+CNSTI4 0
+RETI4
+ADDRGP4 $117
+JUMPV
+LABELV $122
+CNSTI4 1
+RETI4
+ADDRGP4 $117
+JUMPV
+LABELV $118
+CNSTI4 0
+RETI4
+LABELV $117
+endproc EntityIsInvisible 8 4
+export SenseIsInvisible
+proc SenseIsInvisible 4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $125
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $127
+CNSTI4 0
+RETI4
+ADDRGP4 $124
+JUMPV
+LABELV $127
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 PowerupsCarryFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $129
+CNSTI4 0
+RETI4
+ADDRGP4 $124
+JUMPV
+LABELV $129
+CNSTI4 1
+RETI4
+ADDRGP4 $124
+JUMPV
+LABELV $125
+CNSTI4 0
+RETI4
+LABELV $124
+endproc SenseIsInvisible 4 4
+export BotRememberLastOrderedTask
+proc BotRememberLastOrderedTask 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $132
+ADDRGP4 $131
+JUMPV
+LABELV $132
+ADDRFP4 0
+INDIRP4
+CNSTI4 19008
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19020
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 19016
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $131
+endproc BotRememberLastOrderedTask 16 12
+export BotSetTeamStatus
+proc BotSetTeamStatus 0 0
+LABELV $134
+endproc BotSetTeamStatus 0 0
+export BotSetLastOrderedTask
+proc BotSetLastOrderedTask 60 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $136
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $138
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $140
+ADDRFP4 0
+INDIRP4
+CNSTI4 19208
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $141
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $141
+JUMPV
+LABELV $140
+ADDRFP4 0
+INDIRP4
+CNSTI4 19212
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $144
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $144
+LABELV $141
+LABELV $138
+LABELV $136
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $146
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19008
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19020
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19016
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1133903872
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $148
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $150
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 BotTeamFlag
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotEnemyFlag
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 52
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $152
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+LABELV $152
+LABELV $150
+LABELV $148
+CNSTI4 1
+RETI4
+ADDRGP4 $135
+JUMPV
+LABELV $146
+CNSTI4 0
+RETI4
+LABELV $135
+endproc BotSetLastOrderedTask 60 16
+export BotRefuseOrder
+proc BotRefuseOrder 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $155
+ADDRGP4 $154
+JUMPV
+LABELV $155
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 18868
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $157
+ADDRLP4 0
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+LEF4 $157
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2097152
+ARGI4
+ADDRGP4 EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $159
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18868
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $157
+LABELV $154
+endproc BotRefuseOrder 8 12
+export BotCTFSeekGoals
+proc BotCTFSeekGoals 228 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $161
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $163
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18408
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 168
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+EQI4 $168
+ADDRLP4 168
+INDIRI4
+CNSTI4 2
+EQI4 $173
+ADDRGP4 $165
+JUMPV
+LABELV $168
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ADDRGP4 ctf_blueflag
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ADDRGP4 ctf_blueflag+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+ADDRGP4 ctf_blueflag+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $166
+JUMPV
+LABELV $173
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ADDRGP4 ctf_redflag
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ADDRGP4 ctf_redflag+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+ADDRGP4 ctf_redflag+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $166
+JUMPV
+LABELV $165
+ADDRLP4 188
+CNSTF4 1148829696
+ASGNF4
+ADDRLP4 148
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 148+4
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 148+8
+CNSTF4 1148829696
+ASGNF4
+LABELV $166
+ADDRLP4 148
+ARGP4
+ADDRLP4 180
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 180
+INDIRF4
+CNSTF4 1124073472
+GEF4 $180
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRGP4 $181
+JUMPV
+LABELV $180
+ADDRFP4 0
+INDIRP4
+CNSTI4 18944
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $181
+ADDRGP4 $183
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 184
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $182
+ARGP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $184
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $160
+JUMPV
+LABELV $163
+ADDRFP4 0
+INDIRP4
+CNSTI4 18408
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $160
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 1
+NEI4 $187
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 19208
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $188
+JUMPV
+LABELV $187
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 19212
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $188
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $160
+ADDRFP4 0
+INDIRP4
+CNSTI4 18408
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $160
+JUMPV
+LABELV $161
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $191
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $191
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 168
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $193
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $193
+LABELV $191
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+NEI4 $195
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 19208
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19212
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $196
+JUMPV
+LABELV $195
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 19212
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19208
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $196
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $197
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $160
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $205
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 18920
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ADDRGP4 ctf_redflag+44
+INDIRI4
+EQI4 $160
+ADDRLP4 184
+INDIRI4
+ADDRGP4 ctf_blueflag+44
+INDIRI4
+EQI4 $160
+LABELV $205
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+LTI4 $160
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $208
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ADDRLP4 192
+INDIRI4
+EQI4 $160
+LABELV $208
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19000
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18428
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $209
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19268
+ADDP4
+CNSTF4 1124073472
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $160
+JUMPV
+LABELV $197
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $210
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $160
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+LTI4 $214
+LABELV $214
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 4
+EQI4 $160
+ADDRLP4 184
+INDIRI4
+CNSTI4 6
+EQI4 $160
+ADDRLP4 184
+INDIRI4
+CNSTI4 1
+EQI4 $160
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+EQI4 $160
+ADDRLP4 184
+INDIRI4
+CNSTI4 8
+EQI4 $160
+ADDRLP4 184
+INDIRI4
+CNSTI4 9
+EQI4 $160
+ADDRLP4 184
+INDIRI4
+CNSTI4 10
+EQI4 $160
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 192
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $218
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $219
+JUMPV
+LABELV $218
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 6
+ASGNI4
+LABELV $219
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $160
+JUMPV
+LABELV $210
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $220
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $160
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 6
+EQI4 $160
+ADDRLP4 180
+INDIRI4
+CNSTI4 2
+EQI4 $160
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+LTI4 $226
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19000
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18428
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $209
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19268
+ADDP4
+CNSTF4 1124073472
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $160
+JUMPV
+LABELV $226
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 192
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 192
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $160
+JUMPV
+LABELV $220
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $228
+ADDRGP4 $160
+JUMPV
+LABELV $228
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $230
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ADDRLP4 184
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $230
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+INDIRI4
+ADDRLP4 188
+INDIRI4
+NEI4 $232
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $232
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $232
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 1
+EQI4 $243
+ADDRLP4 192
+INDIRI4
+CNSTI4 2
+EQI4 $243
+ADDRLP4 192
+INDIRI4
+CNSTI4 3
+EQI4 $243
+ADDRLP4 192
+INDIRI4
+CNSTI4 4
+EQI4 $243
+ADDRLP4 192
+INDIRI4
+CNSTI4 5
+EQI4 $243
+ADDRLP4 192
+INDIRI4
+CNSTI4 6
+EQI4 $243
+ADDRLP4 192
+INDIRI4
+CNSTI4 8
+EQI4 $243
+ADDRLP4 192
+INDIRI4
+CNSTI4 9
+EQI4 $243
+ADDRLP4 192
+INDIRI4
+CNSTI4 10
+NEI4 $234
+LABELV $243
+ADDRGP4 $160
+JUMPV
+LABELV $234
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $244
+ADDRGP4 $160
+JUMPV
+LABELV $244
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $246
+ADDRGP4 $160
+JUMPV
+LABELV $246
+ADDRFP4 0
+INDIRP4
+CNSTI4 18420
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $248
+ADDRGP4 $160
+JUMPV
+LABELV $248
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 200
+INDIRF4
+CNSTF4 1112014848
+GEF4 $250
+ADDRGP4 $160
+JUMPV
+LABELV $250
+ADDRLP4 204
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 204
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19004
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $252
+ADDRFP4 0
+INDIRP4
+CNSTI4 19004
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $254
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $255
+JUMPV
+LABELV $254
+ADDRLP4 8
+CNSTF4 1045220557
+ASGNF4
+LABELV $255
+ADDRLP4 12
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $253
+JUMPV
+LABELV $252
+ADDRLP4 8
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 12
+CNSTF4 1060320051
+ASGNF4
+LABELV $253
+ADDRLP4 208
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 208
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $256
+ADDRLP4 212
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 212
+INDIRI4
+EQI4 $256
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 212
+INDIRI4
+EQI4 $256
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 220
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 220
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $257
+JUMPV
+LABELV $256
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $260
+ADDRLP4 216
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 216
+INDIRI4
+EQI4 $260
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 216
+INDIRI4
+EQI4 $260
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 224
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 1
+NEI4 $264
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $265
+JUMPV
+LABELV $264
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $265
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18400
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $261
+JUMPV
+LABELV $260
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18420
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $261
+LABELV $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPrintTeamGoal
+CALLV
+pop
+LABELV $160
+endproc BotCTFSeekGoals 228 12
+export BotCTFRetreatGoals
+proc BotCTFRetreatGoals 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $267
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $269
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18408
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $269
+LABELV $267
+LABELV $266
+endproc BotCTFRetreatGoals 8 4
+export BotTeamGoals
+proc BotTeamGoals 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $272
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $273
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFRetreatGoals
+CALLV
+pop
+ADDRGP4 $273
+JUMPV
+LABELV $272
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $276
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFSeekGoals
+CALLV
+pop
+LABELV $276
+LABELV $273
+ADDRFP4 0
+INDIRP4
+CNSTI4 18868
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $271
+endproc BotTeamGoals 0 4
+export BotPointAreaNum
+proc BotPointAreaNum 68 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $279
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $278
+JUMPV
+LABELV $279
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 64
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LEI4 $282
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $278
+JUMPV
+LABELV $282
+CNSTI4 0
+RETI4
+LABELV $278
+endproc BotPointAreaNum 68 20
+export PlayerName
+proc PlayerName 1032 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $287
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $285
+LABELV $287
+CNSTI4 3
+ARGI4
+ADDRGP4 $288
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $289
+RETP4
+ADDRGP4 $284
+JUMPV
+LABELV $285
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $290
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $284
+endproc PlayerName 1032 12
+export PlayerFromName
+proc PlayerFromName 1036 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1024
+CNSTI4 0
+ASGNI4
+ADDRGP4 $295
+JUMPV
+LABELV $292
+ADDRLP4 1024
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $290
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $297
+ADDRLP4 1024
+INDIRI4
+RETI4
+ADDRGP4 $291
+JUMPV
+LABELV $297
+LABELV $293
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $295
+ADDRLP4 1024
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $292
+CNSTI4 -1
+RETI4
+LABELV $291
+endproc PlayerFromName 1036 12
+export PlayerOnSameTeamFromName
+proc PlayerOnSameTeamFromName 1040 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $303
+JUMPV
+LABELV $300
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+NEI4 $305
+ADDRGP4 $301
+JUMPV
+LABELV $305
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $290
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $307
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $299
+JUMPV
+LABELV $307
+LABELV $301
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $303
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $300
+CNSTI4 -1
+RETI4
+LABELV $299
+endproc PlayerOnSameTeamFromName 1040 12
+export stristr
+proc stristr 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $311
+JUMPV
+LABELV $310
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $316
+JUMPV
+LABELV $313
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $317
+ADDRGP4 $315
+JUMPV
+LABELV $317
+LABELV $314
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $316
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+EQI4 $319
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+NEI4 $313
+LABELV $319
+LABELV $315
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $320
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $309
+JUMPV
+LABELV $320
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $311
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $310
+CNSTP4 0
+RETP4
+LABELV $309
+endproc stristr 12 4
+lit
+align 1
+LABELV $323
+byte 1 0
+skip 127
+export EasyPlayerName
+code
+proc EasyPlayerName 196 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 5
+ADDRGP4 $323
+INDIRB
+ASGNB 128
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 5
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 PlayerName
+CALLP4
+pop
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRGP4 $327
+JUMPV
+LABELV $324
+ADDRLP4 148
+ADDRLP4 136
+INDIRI4
+ADDRLP4 5
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+CVII1 4
+ASGNI1
+LABELV $325
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $327
+ADDRLP4 136
+INDIRI4
+ADDRLP4 5
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $324
+ADDRLP4 5
+ARGP4
+ADDRGP4 $332
+ARGP4
+ADDRLP4 152
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRGP4 $331
+JUMPV
+LABELV $328
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 156
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $329
+ADDRLP4 5
+ARGP4
+ADDRGP4 $332
+ARGP4
+ADDRLP4 156
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+LABELV $331
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $328
+ADDRLP4 5
+ARGP4
+ADDRGP4 $333
+ARGP4
+ADDRLP4 160
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 5
+ARGP4
+ADDRGP4 $334
+ARGP4
+ADDRLP4 164
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 144
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 168
+CNSTU4 0
+ASGNU4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+ADDRLP4 168
+INDIRU4
+EQU4 $335
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+ADDRLP4 168
+INDIRU4
+EQU4 $335
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+LEU4 $337
+ADDRLP4 144
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 172
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $338
+JUMPV
+LABELV $337
+ADDRLP4 140
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 176
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $338
+LABELV $335
+ADDRLP4 172
+ADDRLP4 5
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 109
+EQI4 $343
+ADDRLP4 172
+INDIRI4
+CNSTI4 77
+NEI4 $339
+LABELV $343
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 114
+EQI4 $344
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 82
+NEI4 $339
+LABELV $344
+ADDRLP4 5+2
+ARGP4
+ADDRLP4 176
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5
+ARGP4
+ADDRLP4 5+2
+ARGP4
+ADDRLP4 176
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $339
+ADDRLP4 0
+ADDRLP4 5
+ASGNP4
+ADDRGP4 $348
+JUMPV
+LABELV $347
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 176
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 97
+LTI4 $353
+ADDRLP4 176
+INDIRI4
+CNSTI4 122
+LEI4 $354
+LABELV $353
+ADDRLP4 180
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 48
+LTI4 $355
+ADDRLP4 180
+INDIRI4
+CNSTI4 57
+LEI4 $354
+LABELV $355
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 95
+NEI4 $350
+LABELV $354
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRLP4 184
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 65
+LTI4 $356
+ADDRLP4 184
+INDIRI4
+CNSTI4 90
+GTI4 $356
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+ADDI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $357
+JUMPV
+LABELV $356
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 188
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $357
+LABELV $351
+LABELV $348
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $347
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 5
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $322
+endproc EasyPlayerName 196 12
+export BotSynonymContext
+proc BotSynonymContext 8 4
+ADDRLP4 0
+CNSTI4 1027
+ASGNI4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $359
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $361
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $362
+JUMPV
+LABELV $361
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $362
+LABELV $359
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $358
+endproc BotSynonymContext 8 4
+export BotChooseWeapon
+proc BotChooseWeapon 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $366
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $364
+LABELV $366
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_SelectWeapon
+CALLV
+pop
+ADDRGP4 $365
+JUMPV
+LABELV $364
+ADDRFP4 0
+INDIRP4
+CNSTI4 18788
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17200
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotChooseBestFightWeapon
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $367
+ADDRFP4 0
+INDIRP4
+CNSTI4 18444
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $367
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_SelectWeapon
+CALLV
+pop
+LABELV $365
+LABELV $363
+endproc BotChooseWeapon 20 8
+export BotWantsToWalk
+proc BotWantsToWalk 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18312
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+GTF4 $370
+CNSTI4 0
+RETI4
+ADDRGP4 $369
+JUMPV
+LABELV $370
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $372
+CNSTI4 0
+RETI4
+ADDRGP4 $369
+JUMPV
+LABELV $372
+ADDRFP4 0
+INDIRP4
+CNSTI4 17348
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $374
+CNSTI4 0
+RETI4
+ADDRGP4 $369
+JUMPV
+LABELV $374
+CNSTI4 1
+RETI4
+LABELV $369
+endproc BotWantsToWalk 4 4
+export BotSetupForMovement
+proc BotSetupForMovement 96 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 68
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+36
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+44
+ADDRFP4 0
+INDIRP4
+CNSTI4 17152
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 4095
+EQI4 $388
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $388
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+ADDRLP4 80
+INDIRI4
+EQI4 $391
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LEI4 $391
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $391
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 88
+INDIRI4
+EQI4 $394
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LEI4 $394
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $394
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $397
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $397
+CNSTI4 720
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+332
+ADDP4
+INDIRP4
+CNSTI4 1512
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $400
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+LABELV $400
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $404
+ADDRLP4 0+48
+CNSTI4 4
+ASGNI4
+ADDRGP4 $405
+JUMPV
+LABELV $404
+ADDRLP4 0+48
+CNSTI4 2
+ASGNI4
+LABELV $405
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 BotWantsToWalk
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+EQI4 $408
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+LABELV $408
+ADDRFP4 0
+INDIRP4
+CNSTI4 18312
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+LEF4 $411
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $411
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+LABELV $411
+ADDRLP4 0+52
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotInitMoveState
+CALLV
+pop
+LABELV $376
+endproc BotSetupForMovement 96 12
+export BotCheckItemPickup
+proc BotCheckItemPickup 0 0
+LABELV $416
+endproc BotCheckItemPickup 0 0
+export BotPlayerStateInventory
+proc BotPlayerStateInventory 84 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $419
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $420
+JUMPV
+LABELV $419
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $420
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $422
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $423
+JUMPV
+LABELV $422
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $423
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $425
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $426
+JUMPV
+LABELV $425
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $426
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $428
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $429
+JUMPV
+LABELV $428
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $429
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 32
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $431
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $432
+JUMPV
+LABELV $431
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $432
+ADDRFP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $434
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $435
+JUMPV
+LABELV $434
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $435
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $437
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $437
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $438
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $440
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRGP4 $441
+JUMPV
+LABELV $440
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+LABELV $441
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $443
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $444
+JUMPV
+LABELV $443
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+LABELV $444
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $446
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $446
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+LABELV $447
+ADDRFP4 8
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 420
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 428
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 432
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI4
+CNSTI4 26
+NEI4 $449
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 $450
+JUMPV
+LABELV $449
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+LABELV $450
+ADDRFP4 8
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI4
+CNSTI4 27
+NEI4 $452
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRGP4 $453
+JUMPV
+LABELV $452
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+LABELV $453
+ADDRFP4 8
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $455
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $456
+JUMPV
+LABELV $455
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+LABELV $456
+ADDRFP4 8
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $458
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $459
+JUMPV
+LABELV $458
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $459
+ADDRFP4 8
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 360
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $461
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+ADDRGP4 $462
+JUMPV
+LABELV $461
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $462
+ADDRFP4 8
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 364
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $464
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $465
+JUMPV
+LABELV $464
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+LABELV $465
+ADDRFP4 8
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 368
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $467
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $468
+JUMPV
+LABELV $467
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $468
+ADDRFP4 8
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 372
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $470
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRGP4 $471
+JUMPV
+LABELV $470
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+LABELV $471
+ADDRFP4 8
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 376
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $473
+ADDRLP4 76
+CNSTI4 1
+ASGNI4
+ADDRGP4 $474
+JUMPV
+LABELV $473
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+LABELV $474
+ADDRFP4 8
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 380
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $476
+ADDRLP4 80
+CNSTI4 1
+ASGNI4
+ADDRGP4 $477
+JUMPV
+LABELV $476
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+LABELV $477
+ADDRFP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+LABELV $417
+endproc BotPlayerStateInventory 84 0
+export BotUpdateInventory
+proc BotUpdateInventory 1028 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17200
+ADDP4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17200
+ADDP4
+ARGP4
+ADDRGP4 BotPlayerStateInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckItemPickup
+CALLV
+pop
+LABELV $478
+endproc BotUpdateInventory 1028 12
+export BotUpdateBattleInventory
+proc BotUpdateBattleInventory 148 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18004
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18000
+ADDP4
+ADDRLP4 144
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $479
+endproc BotUpdateBattleInventory 148 8
+export BotBattleUseItems
+proc BotBattleUseItems 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $490
+ADDRFP4 0
+INDIRP4
+CNSTI4 17320
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $492
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $494
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Use
+CALLV
+pop
+LABELV $494
+LABELV $492
+LABELV $490
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $496
+ADDRFP4 0
+INDIRP4
+CNSTI4 17324
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $498
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Use
+CALLV
+pop
+LABELV $498
+LABELV $496
+LABELV $489
+endproc BotBattleUseItems 4 4
+export BotSetTeleportTime
+proc BotSetTeleportTime 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $501
+ADDRFP4 0
+INDIRP4
+CNSTI4 18436
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $501
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $500
+endproc BotSetTeleportTime 8 0
+export BotIsDead
+proc BotIsDead 4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $505
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $506
+JUMPV
+LABELV $505
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $506
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $503
+endproc BotIsDead 4 0
+export BotIsObserver
+proc BotIsObserver 1032 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $508
+CNSTI4 1
+RETI4
+ADDRGP4 $507
+JUMPV
+LABELV $508
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $512
+ARGP4
+ADDRLP4 1024
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 3
+NEI4 $510
+CNSTI4 1
+RETI4
+ADDRGP4 $507
+JUMPV
+LABELV $510
+CNSTI4 0
+RETI4
+LABELV $507
+endproc BotIsObserver 1032 12
+export BotIntermission
+proc BotIntermission 8 0
+ADDRGP4 level+9148
+INDIRI4
+CNSTI4 0
+EQI4 $514
+CNSTI4 1
+RETI4
+ADDRGP4 $513
+JUMPV
+LABELV $514
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+EQI4 $520
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+NEI4 $518
+LABELV $520
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $519
+JUMPV
+LABELV $518
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $519
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $513
+endproc BotIntermission 8 0
+export BotInLavaOrSlime
+proc BotInLavaOrSlime 16 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1102577664
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 24
+BANDI4
+RETI4
+LABELV $521
+endproc BotInLavaOrSlime 16 4
+lit
+align 4
+LABELV $524
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $525
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export BotCreateWayPoint
+code
+proc BotCreateWayPoint 32 12
+ADDRLP4 4
+ADDRGP4 $524
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRGP4 $525
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $526
+CNSTI4 2
+ARGI4
+ADDRGP4 $528
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $523
+JUMPV
+LABELV $526
+ADDRLP4 28
+ADDRGP4 botai_freewaypoints
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $523
+endproc BotCreateWayPoint 32 12
+export BotFindWayPoint
+proc BotFindWayPoint 8 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $533
+JUMPV
+LABELV $530
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $534
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $529
+JUMPV
+LABELV $534
+LABELV $531
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $533
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $530
+CNSTP4 0
+RETP4
+LABELV $529
+endproc BotFindWayPoint 8 8
+export BotFreeWaypoints
+proc BotFreeWaypoints 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $540
+JUMPV
+LABELV $537
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRGP4 botai_freewaypoints
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $538
+ADDRFP4 0
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $540
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $537
+LABELV $536
+endproc BotFreeWaypoints 8 0
+export BotInitWaypoints
+proc BotInitWaypoints 4 0
+ADDRGP4 botai_freewaypoints
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $542
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botai_waypoints+92
+ADDP4
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRGP4 botai_freewaypoints
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botai_waypoints
+ADDP4
+ASGNP4
+LABELV $543
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $542
+LABELV $541
+endproc BotInitWaypoints 4 0
+export TeamPlayIsOn
+proc TeamPlayIsOn 4 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+LTI4 $549
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $550
+JUMPV
+LABELV $549
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $550
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $547
+endproc TeamPlayIsOn 4 0
+export BotCanCamp
+proc BotCanCamp 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $552
+ADDRFP4 0
+INDIRP4
+CNSTI4 18308
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18304
+ADDP4
+INDIRI4
+GEI4 $552
+CNSTI4 0
+RETI4
+ADDRGP4 $551
+JUMPV
+LABELV $552
+ADDRFP4 0
+INDIRP4
+CNSTI4 18004
+ADDP4
+INDIRI4
+CNSTI4 200
+LEI4 $555
+CNSTI4 0
+RETI4
+ADDRGP4 $551
+JUMPV
+LABELV $555
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $557
+CNSTI4 0
+RETI4
+ADDRGP4 $551
+JUMPV
+LABELV $557
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $559
+ADDRFP4 0
+INDIRP4
+CNSTI4 17204
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $561
+CNSTI4 0
+RETI4
+ADDRGP4 $551
+JUMPV
+LABELV $561
+LABELV $559
+ADDRFP4 0
+INDIRP4
+CNSTI4 17340
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $563
+CNSTI4 0
+RETI4
+ADDRGP4 $551
+JUMPV
+LABELV $563
+ADDRFP4 0
+INDIRP4
+CNSTI4 17352
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $565
+CNSTI4 0
+RETI4
+ADDRGP4 $551
+JUMPV
+LABELV $565
+ADDRFP4 0
+INDIRP4
+CNSTI4 17356
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $567
+CNSTI4 0
+RETI4
+ADDRGP4 $551
+JUMPV
+LABELV $567
+ADDRFP4 0
+INDIRP4
+CNSTI4 17348
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $569
+CNSTI4 0
+RETI4
+ADDRGP4 $551
+JUMPV
+LABELV $569
+ADDRFP4 0
+INDIRP4
+CNSTI4 17232
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $573
+ADDRFP4 0
+INDIRP4
+CNSTI4 17292
+ADDP4
+INDIRI4
+CNSTI4 10
+GTI4 $571
+LABELV $573
+ADDRFP4 0
+INDIRP4
+CNSTI4 17240
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $574
+ADDRFP4 0
+INDIRP4
+CNSTI4 17296
+ADDP4
+INDIRI4
+CNSTI4 10
+GTI4 $571
+LABELV $574
+ADDRFP4 0
+INDIRP4
+CNSTI4 17244
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $575
+ADDRFP4 0
+INDIRP4
+CNSTI4 17284
+ADDP4
+INDIRI4
+CNSTI4 80
+GTI4 $571
+LABELV $575
+ADDRFP4 0
+INDIRP4
+CNSTI4 17252
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $576
+ADDRFP4 0
+INDIRP4
+CNSTI4 17300
+ADDP4
+INDIRI4
+CNSTI4 10
+GTI4 $571
+LABELV $576
+CNSTI4 0
+RETI4
+ADDRGP4 $551
+JUMPV
+LABELV $571
+CNSTI4 1
+RETI4
+LABELV $551
+endproc BotCanCamp 20 0
+export BotAggression
+proc BotAggression 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17340
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $578
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $582
+ADDRFP4 0
+INDIRP4
+CNSTI4 18000
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $580
+LABELV $582
+CNSTF4 1116471296
+RETF4
+ADDRGP4 $577
+JUMPV
+LABELV $580
+LABELV $578
+ADDRFP4 0
+INDIRP4
+CNSTI4 18004
+ADDP4
+INDIRI4
+CNSTI4 200
+LEI4 $583
+CNSTF4 0
+RETF4
+ADDRGP4 $577
+JUMPV
+LABELV $583
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $585
+CNSTF4 0
+RETF4
+ADDRGP4 $577
+JUMPV
+LABELV $585
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $587
+ADDRFP4 0
+INDIRP4
+CNSTI4 17204
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $589
+CNSTF4 0
+RETF4
+ADDRGP4 $577
+JUMPV
+LABELV $589
+LABELV $587
+ADDRFP4 0
+INDIRP4
+CNSTI4 17252
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $591
+ADDRFP4 0
+INDIRP4
+CNSTI4 17300
+ADDP4
+INDIRI4
+CNSTI4 7
+LEI4 $591
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $577
+JUMPV
+LABELV $591
+ADDRFP4 0
+INDIRP4
+CNSTI4 17240
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $593
+ADDRFP4 0
+INDIRP4
+CNSTI4 17296
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $593
+CNSTF4 1119748096
+RETF4
+ADDRGP4 $577
+JUMPV
+LABELV $593
+ADDRFP4 0
+INDIRP4
+CNSTI4 17236
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $595
+ADDRFP4 0
+INDIRP4
+CNSTI4 17288
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $595
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $577
+JUMPV
+LABELV $595
+ADDRFP4 0
+INDIRP4
+CNSTI4 17232
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $597
+ADDRFP4 0
+INDIRP4
+CNSTI4 17292
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $597
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $577
+JUMPV
+LABELV $597
+ADDRFP4 0
+INDIRP4
+CNSTI4 17244
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $599
+ADDRFP4 0
+INDIRP4
+CNSTI4 17284
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $599
+CNSTF4 1118437376
+RETF4
+ADDRGP4 $577
+JUMPV
+LABELV $599
+ADDRFP4 0
+INDIRP4
+CNSTI4 17228
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $601
+ADDRFP4 0
+INDIRP4
+CNSTI4 17280
+ADDP4
+INDIRI4
+CNSTI4 10
+LEI4 $601
+CNSTF4 1117782016
+RETF4
+ADDRGP4 $577
+JUMPV
+LABELV $601
+ADDRFP4 0
+INDIRP4
+CNSTI4 17220
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $603
+ADDRFP4 0
+INDIRP4
+CNSTI4 17272
+ADDP4
+INDIRI4
+CNSTI4 10
+LEI4 $603
+CNSTF4 1112014848
+RETF4
+ADDRGP4 $577
+JUMPV
+LABELV $603
+CNSTF4 0
+RETF4
+LABELV $577
+endproc BotAggression 28 0
+export BotFeelingBad
+proc BotFeelingBad 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $606
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $605
+JUMPV
+LABELV $606
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $608
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $605
+JUMPV
+LABELV $608
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $610
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $605
+JUMPV
+LABELV $610
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $612
+CNSTF4 1117782016
+RETF4
+ADDRGP4 $605
+JUMPV
+LABELV $612
+CNSTF4 0
+RETF4
+LABELV $605
+endproc BotFeelingBad 0 0
+export BotWantsToRetreat
+proc BotWantsToRetreat 132 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $615
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $617
+CNSTI4 1
+RETI4
+ADDRGP4 $614
+JUMPV
+LABELV $617
+LABELV $615
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $619
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 128
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $621
+CNSTI4 0
+RETI4
+ADDRGP4 $614
+JUMPV
+LABELV $621
+LABELV $619
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $623
+CNSTI4 1
+RETI4
+ADDRGP4 $614
+JUMPV
+LABELV $623
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+CNSTF4 1112014848
+GEF4 $625
+CNSTI4 1
+RETI4
+ADDRGP4 $614
+JUMPV
+LABELV $625
+CNSTI4 0
+RETI4
+LABELV $614
+endproc BotWantsToRetreat 132 8
+export BotWantsToChase
+proc BotWantsToChase 136 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $628
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $630
+CNSTI4 0
+RETI4
+ADDRGP4 $627
+JUMPV
+LABELV $630
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $632
+CNSTI4 1
+RETI4
+ADDRGP4 $627
+JUMPV
+LABELV $632
+LABELV $628
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $634
+CNSTI4 0
+RETI4
+ADDRGP4 $627
+JUMPV
+LABELV $634
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+CNSTF4 1112014848
+LEF4 $636
+CNSTI4 1
+RETI4
+ADDRGP4 $627
+JUMPV
+LABELV $636
+CNSTI4 0
+RETI4
+LABELV $627
+endproc BotWantsToChase 136 8
+export BotWantsToHelp
+proc BotWantsToHelp 0 0
+CNSTI4 1
+RETI4
+LABELV $638
+endproc BotWantsToHelp 0 0
+export BotCanAndWantsToRocketJump
+proc BotCanAndWantsToRocketJump 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_rocketjump+12
+INDIRI4
+CNSTI4 0
+NEI4 $640
+CNSTI4 0
+RETI4
+ADDRGP4 $639
+JUMPV
+LABELV $640
+ADDRFP4 0
+INDIRP4
+CNSTI4 17232
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $643
+CNSTI4 0
+RETI4
+ADDRGP4 $639
+JUMPV
+LABELV $643
+ADDRFP4 0
+INDIRP4
+CNSTI4 17292
+ADDP4
+INDIRI4
+CNSTI4 3
+GEI4 $645
+CNSTI4 0
+RETI4
+ADDRGP4 $639
+JUMPV
+LABELV $645
+ADDRFP4 0
+INDIRP4
+CNSTI4 17340
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $647
+CNSTI4 0
+RETI4
+ADDRGP4 $639
+JUMPV
+LABELV $647
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $649
+CNSTI4 0
+RETI4
+ADDRGP4 $639
+JUMPV
+LABELV $649
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 90
+GEI4 $651
+ADDRFP4 0
+INDIRP4
+CNSTI4 17204
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $653
+CNSTI4 0
+RETI4
+ADDRGP4 $639
+JUMPV
+LABELV $653
+LABELV $651
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 38
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 4
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1056964608
+GEF4 $655
+CNSTI4 0
+RETI4
+ADDRGP4 $639
+JUMPV
+LABELV $655
+CNSTI4 1
+RETI4
+LABELV $639
+endproc BotCanAndWantsToRocketJump 8 16
+export BotCanGrapple
+proc BotCanGrapple 4 0
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+NEI4 $658
+CNSTI4 0
+RETI4
+ADDRGP4 $657
+JUMPV
+LABELV $658
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 bot_offhandgrapple+12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $661
+ADDRFP4 0
+INDIRP4
+CNSTI4 17256
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GTI4 $661
+CNSTI4 0
+RETI4
+ADDRGP4 $657
+JUMPV
+LABELV $661
+CNSTI4 1
+RETI4
+LABELV $657
+endproc BotCanGrapple 4 0
+export BotHasPersistantPowerupAndWeapon
+proc BotHasPersistantPowerupAndWeapon 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $665
+CNSTI4 0
+RETI4
+ADDRGP4 $664
+JUMPV
+LABELV $665
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $667
+ADDRFP4 0
+INDIRP4
+CNSTI4 17204
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $669
+CNSTI4 0
+RETI4
+ADDRGP4 $664
+JUMPV
+LABELV $669
+LABELV $667
+ADDRFP4 0
+INDIRP4
+CNSTI4 17252
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $671
+ADDRFP4 0
+INDIRP4
+CNSTI4 17300
+ADDP4
+INDIRI4
+CNSTI4 7
+LEI4 $671
+CNSTI4 1
+RETI4
+ADDRGP4 $664
+JUMPV
+LABELV $671
+ADDRFP4 0
+INDIRP4
+CNSTI4 17240
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $673
+ADDRFP4 0
+INDIRP4
+CNSTI4 17296
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $673
+CNSTI4 1
+RETI4
+ADDRGP4 $664
+JUMPV
+LABELV $673
+ADDRFP4 0
+INDIRP4
+CNSTI4 17236
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $675
+ADDRFP4 0
+INDIRP4
+CNSTI4 17288
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $675
+CNSTI4 1
+RETI4
+ADDRGP4 $664
+JUMPV
+LABELV $675
+ADDRFP4 0
+INDIRP4
+CNSTI4 17232
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $677
+ADDRFP4 0
+INDIRP4
+CNSTI4 17292
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $677
+CNSTI4 1
+RETI4
+ADDRGP4 $664
+JUMPV
+LABELV $677
+ADDRFP4 0
+INDIRP4
+CNSTI4 17260
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $679
+ADDRFP4 0
+INDIRP4
+CNSTI4 17304
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $679
+CNSTI4 1
+RETI4
+ADDRGP4 $664
+JUMPV
+LABELV $679
+ADDRFP4 0
+INDIRP4
+CNSTI4 17264
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $681
+ADDRFP4 0
+INDIRP4
+CNSTI4 17308
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $681
+CNSTI4 1
+RETI4
+ADDRGP4 $664
+JUMPV
+LABELV $681
+ADDRFP4 0
+INDIRP4
+CNSTI4 17268
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $683
+ADDRFP4 0
+INDIRP4
+CNSTI4 17312
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $683
+CNSTI4 1
+RETI4
+ADDRGP4 $664
+JUMPV
+LABELV $683
+ADDRFP4 0
+INDIRP4
+CNSTI4 17244
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $685
+ADDRFP4 0
+INDIRP4
+CNSTI4 17284
+ADDP4
+INDIRI4
+CNSTI4 20
+LEI4 $685
+CNSTI4 1
+RETI4
+ADDRGP4 $664
+JUMPV
+LABELV $685
+CNSTI4 0
+RETI4
+LABELV $664
+endproc BotHasPersistantPowerupAndWeapon 32 0
+export BotGoCamp
+proc BotGoCamp 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 44
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065185444
+LEF4 $688
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1203982208
+ADDF4
+ASGNF4
+ADDRGP4 $689
+JUMPV
+LABELV $688
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+CNSTF4 1127481344
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 12
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $689
+ADDRFP4 0
+INDIRP4
+CNSTI4 18440
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18428
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $687
+endproc BotGoCamp 16 16
+export BotWantsToCamp
+proc BotWantsToCamp 160 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 44
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 128
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 1036831949
+GEF4 $691
+CNSTI4 0
+RETI4
+ADDRGP4 $690
+JUMPV
+LABELV $691
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+EQI4 $701
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+EQI4 $701
+ADDRLP4 132
+INDIRI4
+CNSTI4 3
+EQI4 $701
+ADDRLP4 132
+INDIRI4
+CNSTI4 4
+EQI4 $701
+ADDRLP4 132
+INDIRI4
+CNSTI4 5
+EQI4 $701
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+EQI4 $701
+ADDRLP4 132
+INDIRI4
+CNSTI4 8
+EQI4 $701
+ADDRLP4 132
+INDIRI4
+CNSTI4 9
+NEI4 $693
+LABELV $701
+CNSTI4 0
+RETI4
+ADDRGP4 $690
+JUMPV
+LABELV $693
+ADDRFP4 0
+INDIRP4
+CNSTI4 18440
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+CNSTF4 1133903872
+CNSTF4 1065353216
+ADDRLP4 124
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+LEF4 $702
+CNSTI4 0
+RETI4
+ADDRGP4 $690
+JUMPV
+LABELV $702
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 124
+INDIRF4
+LEF4 $704
+ADDRFP4 0
+INDIRP4
+CNSTI4 18440
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $690
+JUMPV
+LABELV $704
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotCanCamp
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $706
+CNSTI4 0
+RETI4
+ADDRGP4 $690
+JUMPV
+LABELV $706
+ADDRLP4 64
+CNSTI4 99999
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotGetNextCampSpotGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRGP4 $711
+JUMPV
+LABELV $708
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRLP4 8+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 152
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $713
+ADDRLP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+GEI4 $713
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $713
+LABELV $709
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 148
+ADDRGP4 BotGetNextCampSpotGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+LABELV $711
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $708
+ADDRLP4 64
+INDIRI4
+CNSTI4 150
+LEI4 $715
+CNSTI4 0
+RETI4
+ADDRGP4 $690
+JUMPV
+LABELV $715
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 BotGoCamp
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $690
+endproc BotWantsToCamp 160 16
+export BotDontAvoid
+proc BotDontAvoid 68 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $719
+JUMPV
+LABELV $718
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4+44
+INDIRI4
+ARGI4
+ADDRGP4 BotRemoveFromAvoidGoals
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $719
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $718
+LABELV $717
+endproc BotDontAvoid 68 12
+export BotGoForPowerups
+proc BotGoForPowerups 0 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $723
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $724
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $725
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $726
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $727
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18324
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $722
+endproc BotGoForPowerups 0 8
+export BotRoamGoal
+proc BotRoamGoal 160 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+LABELV $729
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 116
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 116
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 92
+INDIRF4
+CNSTF4 1048576000
+LEF4 $733
+ADDRLP4 120
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $735
+ADDRLP4 124
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 124
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 $736
+JUMPV
+LABELV $735
+ADDRLP4 128
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 128
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ADDF4
+ASGNF4
+LABELV $736
+LABELV $733
+ADDRLP4 92
+INDIRF4
+CNSTF4 1061158912
+GEF4 $737
+ADDRLP4 120
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $739
+ADDRLP4 124
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 124
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 $740
+JUMPV
+LABELV $739
+ADDRLP4 128
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 128
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ADDF4
+ASGNF4
+LABELV $740
+LABELV $737
+ADDRLP4 120
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1119879168
+CNSTF4 1073741824
+ADDRLP4 120
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRLP4 128
+CNSTP4 0
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 24+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24+12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24+12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 136
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 88
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRLP4 88
+INDIRF4
+CNSTF4 1128792064
+LEF4 $751
+ADDRLP4 144
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDRLP4 144
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDRLP4 144
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+CNSTF4 1109393408
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 100
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 100+4
+ADDRLP4 12+4
+INDIRF4
+ASGNF4
+ADDRLP4 100+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1145569280
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 152
+CNSTP4 0
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 24+4
+INDIRI4
+CNSTI4 0
+NEI4 $768
+ADDRLP4 24+12+8
+ADDRLP4 24+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 24+12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 24
+BANDI4
+CNSTI4 0
+NEI4 $774
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRGP4 $728
+JUMPV
+LABELV $774
+LABELV $768
+LABELV $751
+LABELV $730
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 10
+LTI4 $729
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+LABELV $728
+endproc BotRoamGoal 160 28
+lit
+align 4
+LABELV $778
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotAttackMove
+code
+proc BotAttackMove 464 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRGP4 $778
+INDIRB
+ASGNB 12
+ADDRLP4 320
+ADDRFP4 4
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 18380
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $779
+ADDRLP4 136+40
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 136+12
+ADDRFP4 4
+INDIRP4
+CNSTI4 18796
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+CNSTI4 18800
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 136+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 136+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 136+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 136+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 136+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 136+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 80
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 BotMoveToGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $776
+JUMPV
+LABELV $779
+ADDRLP4 80
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 52
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 416
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 416
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 37
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 420
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 328
+ADDRLP4 420
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 424
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 408
+ADDRLP4 424
+INDIRF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+CNSTF4 1045220557
+GEF4 $793
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckBlockedTeammates
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $776
+JUMPV
+LABELV $793
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 320
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 192+24
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 192+24+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 192+24+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 432
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 432
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 24
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 24+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 24+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 18376
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $806
+ADDRLP4 436
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 436
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 328
+INDIRF4
+GEF4 $808
+ADDRLP4 52
+CNSTI4 4
+ASGNI4
+ADDRGP4 $809
+JUMPV
+LABELV $808
+ADDRFP4 4
+INDIRP4
+CNSTI4 18376
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $810
+ADDRLP4 440
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 440
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 408
+INDIRF4
+GEF4 $810
+ADDRFP4 4
+INDIRP4
+CNSTI4 18376
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 408
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $810
+LABELV $809
+LABELV $806
+ADDRFP4 4
+INDIRP4
+CNSTI4 18376
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $812
+ADDRLP4 332
+ADDRFP4 4
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+ASGNF4
+ADDRLP4 344
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 436
+CNSTP4 0
+ASGNP4
+ADDRLP4 436
+INDIRP4
+ARGP4
+ADDRLP4 436
+INDIRP4
+ARGP4
+ADDRLP4 192+24
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 344+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $820
+ADDRLP4 344+56
+INDIRI4
+ADDRLP4 320
+INDIRI4
+NEI4 $816
+LABELV $820
+ADDRLP4 52
+CNSTI4 2
+ASGNI4
+LABELV $816
+LABELV $812
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+NEI4 $821
+ADDRFP4 4
+INDIRP4
+CNSTI4 18384
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $823
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $824
+JUMPV
+LABELV $823
+ADDRFP4 4
+INDIRP4
+CNSTI4 18384
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $824
+LABELV $821
+ADDRFP4 4
+INDIRP4
+CNSTI4 312
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $825
+ADDRLP4 436
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+ADDRLP4 436
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 436
+INDIRF4
+ASGNF4
+ADDRGP4 $826
+JUMPV
+LABELV $825
+ADDRLP4 72
+CNSTF4 1124859904
+ASGNF4
+ADDRLP4 76
+CNSTF4 1109393408
+ASGNF4
+LABELV $826
+ADDRLP4 132
+INDIRF4
+CNSTF4 1053609165
+GTF4 $827
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDF4
+LEF4 $829
+ADDRFP4 4
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 436
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 436
+INDIRI4
+CNSTI4 0
+EQI4 $831
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $776
+JUMPV
+LABELV $831
+LABELV $829
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+SUBF4
+GEF4 $833
+ADDRFP4 4
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 436
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 436
+INDIRI4
+CNSTI4 0
+EQI4 $835
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $776
+JUMPV
+LABELV $835
+LABELV $833
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $776
+JUMPV
+LABELV $827
+ADDRLP4 440
+ADDRFP4 4
+INDIRP4
+CNSTI4 18372
+ADDP4
+ASGNP4
+ADDRLP4 440
+INDIRP4
+ADDRLP4 440
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 17152
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 324
+CNSTF4 1045220557
+CNSTF4 1065353216
+ADDRLP4 132
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1053609165
+ADDF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+CNSTF4 1060320051
+LEF4 $837
+ADDRLP4 448
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 324
+ADDRLP4 324
+INDIRF4
+CNSTF4 1045220557
+CNSTF4 1073741824
+ADDRLP4 448
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $837
+ADDRFP4 4
+INDIRP4
+CNSTI4 18372
+ADDP4
+INDIRF4
+ADDRLP4 324
+INDIRF4
+LEF4 $839
+ADDRLP4 452
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 452
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1064262697
+LEF4 $841
+ADDRLP4 456
+ADDRFP4 4
+INDIRP4
+CNSTI4 18228
+ADDP4
+ASGNP4
+ADDRLP4 456
+INDIRP4
+ADDRLP4 456
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 18372
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $841
+LABELV $839
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+LABELV $843
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 24+4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 18228
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $850
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $850
+ADDRLP4 452
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 452
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1063675494
+LEF4 $856
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $857
+JUMPV
+LABELV $856
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDF4
+LEF4 $864
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $865
+JUMPV
+LABELV $864
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+SUBF4
+GEF4 $872
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $872
+LABELV $865
+LABELV $857
+ADDRFP4 4
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 456
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 456
+INDIRI4
+CNSTI4 0
+EQI4 $880
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $776
+JUMPV
+LABELV $880
+ADDRLP4 460
+ADDRFP4 4
+INDIRP4
+CNSTI4 18228
+ADDP4
+ASGNP4
+ADDRLP4 460
+INDIRP4
+ADDRLP4 460
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 18372
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $844
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+LTI4 $843
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+LABELV $776
+endproc BotAttackMove 464 28
+export BotSameTeam
+proc BotSameTeam 20 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $885
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $883
+LABELV $885
+CNSTI4 0
+RETI4
+ADDRGP4 $882
+JUMPV
+LABELV $883
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $888
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $886
+LABELV $888
+CNSTI4 0
+RETI4
+ADDRGP4 $882
+JUMPV
+LABELV $886
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+LTI4 $889
+ADDRLP4 8
+CNSTI4 1528
+ASGNI4
+ADDRLP4 12
+ADDRGP4 level
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 636
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $891
+CNSTI4 1
+RETI4
+ADDRGP4 $882
+JUMPV
+LABELV $891
+LABELV $889
+CNSTI4 0
+RETI4
+LABELV $882
+endproc BotSameTeam 20 0
+export InFieldOfVision
+proc InFieldOfVision 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $894
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $898
+ADDRLP4 4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $899
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+ADDRGP4 $899
+JUMPV
+LABELV $898
+ADDRLP4 4
+INDIRF4
+CNSTF4 3274964992
+GEF4 $902
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $902
+LABELV $899
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+LEF4 $904
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+MULF4
+LEF4 $905
+CNSTI4 0
+RETI4
+ADDRGP4 $893
+JUMPV
+LABELV $904
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+NEGF4
+MULF4
+GEF4 $908
+CNSTI4 0
+RETI4
+ADDRGP4 $893
+JUMPV
+LABELV $908
+LABELV $905
+LABELV $895
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $894
+CNSTI4 1
+RETI4
+LABELV $893
+endproc InFieldOfVision 32 4
+proc BotEntityLineOfSight 264 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 64
+ADDRFP4 12
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 204
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 64
+ADDRLP4 204
+INDIRF4
+ADDRLP4 64
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 204
+INDIRF4
+ADDRLP4 64+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 64+8
+CNSTF4 1056964608
+ADDRLP4 64+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 64
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 64
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 64+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 64+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 64
+INDIRB
+ASGNB 12
+ADDRLP4 136+12
+ADDRLP4 64
+INDIRB
+ASGNB 12
+ADDRLP4 136+12+8
+ADDRLP4 136+12+8
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 136+24
+ADDRLP4 136+12
+INDIRB
+ASGNB 12
+ADDRLP4 136+24+8
+ADDRLP4 136+24+8
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRLP4 188
+ADDRLP4 192
+INDIRI4
+CNSTI4 64
+BANDI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 192
+INDIRI4
+CNSTI4 56
+BANDI4
+ASGNI4
+ADDRLP4 132
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+LABELV $928
+ADDRLP4 64
+CNSTI4 12
+ADDRLP4 80
+INDIRI4
+MULI4
+ADDRLP4 136
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 224
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $932
+ADDRLP4 228
+ADDRGP4 botvisstats+12
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ADDRLP4 228
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $929
+JUMPV
+LABELV $932
+ADDRLP4 76
+CNSTI4 65537
+ASGNI4
+ADDRLP4 108
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 112
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 84
+ADDRLP4 64
+INDIRB
+ASGNB 12
+ADDRLP4 64
+ARGP4
+ADDRLP4 228
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $935
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 56
+BORI4
+ASGNI4
+LABELV $935
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $937
+ADDRLP4 76
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $939
+ADDRLP4 108
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 112
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 64
+INDIRB
+ASGNB 12
+ADDRLP4 84
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $939
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 56
+BXORI4
+ASGNI4
+LABELV $937
+ADDRLP4 0
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRLP4 232
+CNSTP4 0
+ASGNP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 236
+ADDRGP4 botvisstats+16
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ADDRLP4 236
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $942
+ADDRLP4 0+56
+INDIRI4
+ADDRFP4 8
+INDIRI4
+EQI4 $942
+ADDRLP4 0+56
+INDIRI4
+CNSTI4 64
+GEI4 $942
+ADDRFP4 16
+INDIRP4
+CNSTI4 1
+ASGNI4
+LABELV $942
+ADDRLP4 176
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $951
+ADDRLP4 0+56
+INDIRI4
+ADDRLP4 112
+INDIRI4
+NEI4 $947
+LABELV $951
+ADDRLP4 64
+ARGP4
+ADDRLP4 240
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 240
+INDIRI4
+CNSTI4 64
+BANDI4
+ASGNI4
+ADDRLP4 244
+CNSTI4 0
+ASGNI4
+ADDRLP4 188
+INDIRI4
+ADDRLP4 244
+INDIRI4
+EQI4 $952
+ADDRLP4 180
+INDIRI4
+ADDRLP4 244
+INDIRI4
+EQI4 $952
+ADDRLP4 120
+ADDRLP4 0+12
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 0+12+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 0+12+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+ARGP4
+ADDRLP4 252
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 252
+INDIRF4
+ASGNF4
+ADDRGP4 $953
+JUMPV
+LABELV $952
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $961
+ADDRLP4 96
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRLP4 248
+CNSTP4 0
+ASGNP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 252
+ADDRGP4 botvisstats+16
+ASGNP4
+ADDRLP4 252
+INDIRP4
+ADDRLP4 252
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 120
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+ARGP4
+ADDRLP4 260
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRGP4 $962
+JUMPV
+LABELV $961
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $972
+ADDRLP4 84
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 248
+CNSTP4 0
+ASGNP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 252
+ADDRGP4 botvisstats+16
+ASGNP4
+ADDRLP4 252
+INDIRP4
+ADDRLP4 252
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 84
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+ARGP4
+ADDRLP4 256
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 256
+INDIRF4
+ASGNF4
+ADDRGP4 $973
+JUMPV
+LABELV $972
+ADDRLP4 172
+CNSTF4 0
+ASGNF4
+LABELV $973
+LABELV $962
+LABELV $953
+ADDRLP4 252
+CNSTF4 1065353216
+ASGNF4
+CNSTF4 981668463
+ADDRLP4 172
+INDIRF4
+MULF4
+ADDRLP4 252
+INDIRF4
+GEF4 $986
+ADDRLP4 248
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $987
+JUMPV
+LABELV $986
+ADDRLP4 248
+CNSTF4 981668463
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+LABELV $987
+ADDRLP4 116
+ADDRLP4 252
+INDIRF4
+ADDRLP4 248
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 116
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 116
+INDIRF4
+ADDRLP4 132
+INDIRF4
+LEF4 $988
+ADDRLP4 132
+ADDRLP4 116
+INDIRF4
+ASGNF4
+LABELV $988
+ADDRLP4 132
+INDIRF4
+CNSTF4 1064514355
+LTF4 $990
+ADDRLP4 132
+INDIRF4
+RETF4
+ADDRGP4 $910
+JUMPV
+LABELV $990
+LABELV $947
+LABELV $929
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 3
+LTI4 $928
+ADDRLP4 132
+INDIRF4
+RETF4
+LABELV $910
+endproc BotEntityLineOfSight 264 28
+export BotBeginVisibilityFrame
+proc BotBeginVisibilityFrame 8 0
+ADDRLP4 0
+ADDRGP4 botvisframe
+ASGNP4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 botvisframeactive
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $992
+endproc BotBeginVisibilityFrame 8 0
+export BotEndVisibilityFrame
+proc BotEndVisibilityFrame 0 0
+ADDRGP4 botvisframeactive
+CNSTI4 0
+ASGNI4
+LABELV $993
+endproc BotEndVisibilityFrame 0 0
+export BotVisibilityStats
+proc BotVisibilityStats 0 28
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $995
+ADDRGP4 botvisstats
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 20
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $994
+JUMPV
+LABELV $995
+CNSTI4 1
+ARGI4
+ADDRGP4 $997
+ARGP4
+ADDRGP4 botvisstats
+INDIRI4
+ARGI4
+ADDRGP4 botvisstats+4
+INDIRI4
+ARGI4
+ADDRGP4 botvisstats+8
+INDIRI4
+ARGI4
+ADDRGP4 botvisstats+12
+INDIRI4
+ARGI4
+ADDRGP4 botvisstats+16
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $994
+endproc BotVisibilityStats 0 28
+export BotEntityVisible
+proc BotEntityVisible 124 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $1006
+ADDRFP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $1003
+LABELV $1006
+CNSTI4 4
+ARGI4
+ADDRGP4 $1007
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTF4 0
+RETF4
+ADDRGP4 $1002
+JUMPV
+LABELV $1003
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1008
+CNSTF4 0
+RETF4
+ADDRGP4 $1002
+JUMPV
+LABELV $1008
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 32
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 32
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 88
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1056964608
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 32
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40+4
+ADDRLP4 4+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40+8
+ADDRLP4 4+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 60
+ARGP4
+ADDRLP4 100
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $1024
+CNSTF4 0
+RETF4
+ADDRGP4 $1002
+JUMPV
+LABELV $1024
+ADDRLP4 104
+ADDRGP4 botvisstats
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 botvisframeactive
+INDIRI4
+CNSTI4 0
+NEI4 $1026
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 108
+ADDRGP4 BotEntityLineOfSight
+CALLF4
+ASGNF4
+ADDRLP4 108
+INDIRF4
+RETF4
+ADDRGP4 $1002
+JUMPV
+LABELV $1026
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 trap_AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $1028
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 112
+ADDRGP4 BotEntityLineOfSight
+CALLF4
+ASGNF4
+ADDRLP4 112
+INDIRF4
+RETF4
+ADDRGP4 $1002
+JUMPV
+LABELV $1028
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1030
+ADDRLP4 112
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+DIVF4
+ARGF4
+ADDRLP4 116
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 112
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 116
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $1031
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1030
+ADDRLP4 28
+CNSTI4 73856093
+ADDRLP4 16
+INDIRI4
+MULI4
+CNSTI4 19349663
+ADDRLP4 16+4
+INDIRI4
+MULI4
+BXORI4
+CNSTI4 83492791
+ADDRLP4 16+8
+INDIRI4
+MULI4
+BXORI4
+CNSTI4 31
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDI4
+CNSTI4 67
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDI4
+CNSTI4 4095
+BANDI4
+CNSTI4 5
+LSHI4
+ADDRGP4 botviscache
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ADDRGP4 botvisframe
+INDIRI4
+NEI4 $1036
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRFP4 16
+INDIRI4
+NEI4 $1036
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1036
+ADDRLP4 28
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $1036
+ADDRLP4 28
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 16+4
+INDIRI4
+NEI4 $1036
+ADDRLP4 28
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 16+8
+INDIRI4
+NEI4 $1036
+ADDRLP4 116
+ADDRGP4 botvisstats+4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $1041
+ADDRLP4 120
+ADDRGP4 botvisstats+8
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1041
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+RETF4
+ADDRGP4 $1002
+JUMPV
+LABELV $1036
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 116
+ADDRGP4 BotEntityLineOfSight
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $1044
+ADDRLP4 56
+INDIRF4
+RETF4
+ADDRGP4 $1002
+JUMPV
+LABELV $1044
+ADDRLP4 28
+INDIRP4
+ADDRGP4 botvisframe
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+RETF4
+LABELV $1002
+endproc BotEntityVisible 124 20
+export BotFindEnemy
+proc BotFindEnemy 176 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 46
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 64
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 45
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 68
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18236
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+LEI4 $1048
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1049
+JUMPV
+LABELV $1048
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+LABELV $1049
+ADDRLP4 24
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18236
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1050
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 PowerupsCarryFlag
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $1052
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $1052
+CNSTI4 0
+RETI4
+ADDRGP4 $1046
+JUMPV
+LABELV $1052
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18284
+ADDP4
+INDIRI4
+NEI4 $1054
+ADDRFP4 0
+INDIRP4
+CNSTI4 18288
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1054
+CNSTI4 0
+RETI4
+ADDRGP4 $1046
+JUMPV
+LABELV $1054
+ADDRLP4 100
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 100
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 100
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 60
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 108
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRGP4 $1051
+JUMPV
+LABELV $1050
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+LABELV $1051
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1061
+JUMPV
+LABELV $1058
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $1063
+ADDRGP4 $1059
+JUMPV
+LABELV $1063
+ADDRLP4 16
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1065
+ADDRGP4 $1059
+JUMPV
+LABELV $1065
+CNSTI4 720
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 g_entities+352
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1067
+ADDRGP4 $1059
+JUMPV
+LABELV $1067
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $1070
+ADDRGP4 $1059
+JUMPV
+LABELV $1070
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1072
+ADDRGP4 $1059
+JUMPV
+LABELV $1072
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 PlayerIsDead
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+EQI4 $1074
+ADDRGP4 $1059
+JUMPV
+LABELV $1074
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 104
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 108
+CNSTF4 1165623296
+ADDRLP4 28
+INDIRF4
+MULF4
+CNSTF4 1147207680
+ADDF4
+ASGNF4
+ADDRLP4 104
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 108
+INDIRF4
+MULF4
+LEF4 $1078
+ADDRGP4 $1059
+JUMPV
+LABELV $1078
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+NEI4 $1080
+ADDRGP4 $1059
+JUMPV
+LABELV $1080
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 SenseIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+EQI4 $1082
+ADDRGP4 $1059
+JUMPV
+LABELV $1082
+ADDRLP4 40
+INDIRF4
+CNSTF4 1056964608
+GEF4 $1084
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1084
+ADDRGP4 $1059
+JUMPV
+LABELV $1084
+ADDRGP4 lastteleport_time
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+SUBF4
+LEF4 $1086
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 lastteleport_origin
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRGP4 lastteleport_origin+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRGP4 lastteleport_origin+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 120
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 120
+INDIRF4
+CNSTF4 1167663104
+GEF4 $1092
+ADDRGP4 $1059
+JUMPV
+LABELV $1092
+LABELV $1086
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 124
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 PowerupsCarryFlag
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $1096
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1098
+ADDRLP4 20
+INDIRF4
+ADDRLP4 56
+INDIRF4
+LEF4 $1098
+ADDRGP4 $1059
+JUMPV
+LABELV $1098
+LABELV $1096
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 132
+INDIRI4
+GEI4 $1100
+ADDRLP4 24
+INDIRI4
+ADDRLP4 132
+INDIRI4
+NEI4 $1102
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 132
+INDIRI4
+EQI4 $1100
+LABELV $1102
+ADDRLP4 32
+CNSTF4 1135869952
+ASGNF4
+ADDRGP4 $1101
+JUMPV
+LABELV $1100
+ADDRLP4 32
+CNSTF4 1126170624
+ASGNF4
+LABELV $1101
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 140
+INDIRF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 0
+GTF4 $1103
+ADDRGP4 $1059
+JUMPV
+LABELV $1103
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 144
+INDIRI4
+GEI4 $1105
+ADDRLP4 20
+INDIRF4
+CNSTF4 1176256512
+LEF4 $1105
+ADDRLP4 24
+INDIRI4
+ADDRLP4 144
+INDIRI4
+NEI4 $1105
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 PowerupsCarryFlag
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $1105
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 SenseIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $1107
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1107
+ADDRGP4 $1059
+JUMPV
+LABELV $1107
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_ActivateEntity
+CVPU4 4
+NEU4 $1109
+ADDRGP4 $1059
+JUMPV
+LABELV $1109
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTF4 1119092736
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRLP4 168
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $1113
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $1115
+ADDRGP4 $1059
+JUMPV
+LABELV $1115
+LABELV $1113
+LABELV $1105
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1117
+ADDRFP4 0
+INDIRP4
+CNSTI4 18388
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRGP4 $1118
+JUMPV
+LABELV $1117
+ADDRFP4 0
+INDIRP4
+CNSTI4 18388
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1118
+ADDRFP4 0
+INDIRP4
+CNSTI4 18260
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18392
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18344
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $1046
+JUMPV
+LABELV $1059
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1061
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $1058
+CNSTI4 0
+RETI4
+LABELV $1046
+endproc BotFindEnemy 176 20
+export BotTeamFlagCarrierVisible
+proc BotTeamFlagCarrierVisible 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1123
+JUMPV
+LABELV $1120
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $1125
+ADDRGP4 $1121
+JUMPV
+LABELV $1125
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1127
+ADDRGP4 $1121
+JUMPV
+LABELV $1127
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 PlayerCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1129
+ADDRGP4 $1121
+JUMPV
+LABELV $1129
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1131
+ADDRGP4 $1121
+JUMPV
+LABELV $1131
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GTF4 $1133
+ADDRGP4 $1121
+JUMPV
+LABELV $1133
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1119
+JUMPV
+LABELV $1121
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1123
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $1120
+CNSTI4 -1
+RETI4
+LABELV $1119
+endproc BotTeamFlagCarrierVisible 28 20
+export BotTeamFlagCarrier
+proc BotTeamFlagCarrier 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1139
+JUMPV
+LABELV $1136
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $1141
+ADDRGP4 $1137
+JUMPV
+LABELV $1141
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1143
+ADDRGP4 $1137
+JUMPV
+LABELV $1143
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 PlayerCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1145
+ADDRGP4 $1137
+JUMPV
+LABELV $1145
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1147
+ADDRGP4 $1137
+JUMPV
+LABELV $1147
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1135
+JUMPV
+LABELV $1137
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1139
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $1136
+CNSTI4 -1
+RETI4
+LABELV $1135
+endproc BotTeamFlagCarrier 16 8
+export BotEnemyFlagCarrierVisible
+proc BotEnemyFlagCarrierVisible 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1153
+JUMPV
+LABELV $1150
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $1155
+ADDRGP4 $1151
+JUMPV
+LABELV $1155
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1157
+ADDRGP4 $1151
+JUMPV
+LABELV $1157
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 PlayerCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1159
+ADDRGP4 $1151
+JUMPV
+LABELV $1159
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1161
+ADDRGP4 $1151
+JUMPV
+LABELV $1161
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GTF4 $1163
+ADDRGP4 $1151
+JUMPV
+LABELV $1163
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1149
+JUMPV
+LABELV $1151
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1153
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $1150
+CNSTI4 -1
+RETI4
+LABELV $1149
+endproc BotEnemyFlagCarrierVisible 28 20
+export BotVisibleTeamMatesAndEnemies
+proc BotVisibleTeamMatesAndEnemies 64 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1166
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1166
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1168
+ADDRFP4 8
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1168
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1173
+JUMPV
+LABELV $1170
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $1175
+ADDRGP4 $1171
+JUMPV
+LABELV $1175
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1177
+ADDRGP4 $1171
+JUMPV
+LABELV $1177
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 PlayerCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $1179
+ADDRGP4 $1171
+JUMPV
+LABELV $1179
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 4+4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 4+8
+ADDRLP4 36
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+LEF4 $1183
+ADDRGP4 $1171
+JUMPV
+LABELV $1183
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+GTF4 $1185
+ADDRGP4 $1171
+JUMPV
+LABELV $1185
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $1187
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1188
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1188
+JUMPV
+LABELV $1187
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1191
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1191
+LABELV $1188
+LABELV $1171
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1173
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $1170
+LABELV $1165
+endproc BotVisibleTeamMatesAndEnemies 64 20
+export BotCountTeamMates
+proc BotCountTeamMates 52 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $1197
+JUMPV
+LABELV $1194
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $1199
+ADDRGP4 $1195
+JUMPV
+LABELV $1199
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1201
+ADDRGP4 $1195
+JUMPV
+LABELV $1201
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+LEF4 $1205
+ADDRGP4 $1195
+JUMPV
+LABELV $1205
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $1207
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1207
+LABELV $1195
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1197
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $1194
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $1193
+endproc BotCountTeamMates 52 8
+lit
+align 4
+LABELV $1210
+byte 4 3229614080
+byte 4 3229614080
+byte 4 3229614080
+align 4
+LABELV $1211
+byte 4 1082130432
+byte 4 1082130432
+byte 4 1082130432
+export BotAimAtEnemy
+code
+proc BotAimAtEnemy 1136 56
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 828
+ADDRGP4 $1210
+INDIRB
+ASGNB 12
+ADDRLP4 840
+ADDRGP4 $1211
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1212
+ADDRGP4 $1209
+JUMPV
+LABELV $1212
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1214
+ADDRLP4 796
+ADDRLP4 12+24
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 796
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 796+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17188
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 796+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17192
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18472
+ADDP4
+ADDRLP4 796
+INDIRB
+ASGNB 12
+ADDRGP4 $1209
+JUMPV
+LABELV $1214
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 952
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 724
+ADDRLP4 952
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 956
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 956
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18788
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+ARGP4
+ADDRGP4 BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 2
+NEI4 $1221
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 964
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 964
+INDIRF4
+ASGNF4
+ADDRGP4 $1222
+JUMPV
+LABELV $1221
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 3
+NEI4 $1224
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 9
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 964
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 964
+INDIRF4
+ASGNF4
+ADDRGP4 $1225
+JUMPV
+LABELV $1224
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 4
+NEI4 $1227
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 11
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 964
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 964
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 968
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 724
+ADDRLP4 968
+INDIRF4
+ASGNF4
+ADDRGP4 $1228
+JUMPV
+LABELV $1227
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 5
+NEI4 $1230
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 964
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 964
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 17
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 968
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 724
+ADDRLP4 968
+INDIRF4
+ASGNF4
+ADDRGP4 $1231
+JUMPV
+LABELV $1230
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 6
+NEI4 $1233
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 964
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 964
+INDIRF4
+ASGNF4
+ADDRGP4 $1234
+JUMPV
+LABELV $1233
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 7
+NEI4 $1236
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 14
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 964
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 964
+INDIRF4
+ASGNF4
+ADDRGP4 $1237
+JUMPV
+LABELV $1236
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 8
+NEI4 $1239
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 964
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 964
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 19
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 968
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 724
+ADDRLP4 968
+INDIRF4
+ASGNF4
+ADDRGP4 $1240
+JUMPV
+LABELV $1239
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 9
+NEI4 $1242
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 15
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 964
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 964
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 20
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 968
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 724
+ADDRLP4 968
+INDIRF4
+ASGNF4
+LABELV $1242
+LABELV $1240
+LABELV $1237
+LABELV $1234
+LABELV $1231
+LABELV $1228
+LABELV $1225
+LABELV $1222
+ADDRLP4 724
+INDIRF4
+CNSTF4 1064514355
+LEF4 $1245
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 964
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 824
+CNSTF4 1056964608
+ADDRLP4 964
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18388
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 824
+INDIRF4
+SUBF4
+LEF4 $1247
+ADDRGP4 $1209
+JUMPV
+LABELV $1247
+ADDRFP4 0
+INDIRP4
+CNSTI4 18436
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 824
+INDIRF4
+SUBF4
+LEF4 $1249
+ADDRGP4 $1209
+JUMPV
+LABELV $1249
+LABELV $1245
+ADDRLP4 144
+INDIRF4
+CNSTF4 0
+GTF4 $1251
+ADDRLP4 144
+CNSTF4 953267991
+ASGNF4
+LABELV $1251
+ADDRLP4 12
+ARGP4
+ADDRLP4 964
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 964
+INDIRI4
+CNSTI4 0
+EQI4 $1253
+ADDRLP4 968
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 968
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1036831949
+LEF4 $1255
+ADDRLP4 144
+CNSTF4 1053609165
+ADDRLP4 144
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1255
+LABELV $1253
+ADDRLP4 700
+ADDRLP4 12+24
+INDIRF4
+ADDRLP4 12+48
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 700+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRLP4 12+48+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 700+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRLP4 12+48+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 968
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 700
+ADDRLP4 700
+INDIRF4
+ADDRLP4 968
+INDIRF4
+ADDRLP4 12+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 700+4
+ADDRLP4 700+4
+INDIRF4
+ADDRLP4 968
+INDIRF4
+ADDRLP4 12+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 700+8
+ADDRLP4 700+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 12+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18396
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1276
+ADDRFP4 0
+INDIRP4
+CNSTI4 18396
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18484
+ADDP4
+ADDRLP4 700
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 18496
+ADDP4
+ADDRLP4 12+24
+INDIRB
+ASGNB 12
+LABELV $1276
+ADDRLP4 724
+INDIRF4
+CNSTF4 1063675494
+GEF4 $1279
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18496
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18500
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18504
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 976
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 976
+INDIRF4
+CNSTF4 1158676480
+LEF4 $1288
+ADDRFP4 0
+INDIRP4
+CNSTI4 18484
+ADDP4
+INDIRF4
+ADDRLP4 700
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18488
+ADDP4
+INDIRF4
+ADDRLP4 700+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18492
+ADDP4
+INDIRF4
+ADDRLP4 700+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $1290
+ADDRLP4 144
+CNSTF4 1060320051
+ADDRLP4 144
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1290
+LABELV $1288
+LABELV $1279
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 976
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 792
+ADDRLP4 976
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 792
+INDIRI4
+CNSTI4 0
+EQI4 $1294
+ADDRLP4 712
+ADDRLP4 12+24
+INDIRB
+ASGNB 12
+ADDRLP4 712+8
+ADDRLP4 712+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 812
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 812+8
+ADDRLP4 812+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 812+8
+ADDRLP4 812+8
+INDIRF4
+ADDRLP4 148+292+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 728
+ARGP4
+ADDRLP4 812
+ARGP4
+ADDRLP4 828
+ARGP4
+ADDRLP4 840
+ARGP4
+ADDRLP4 712
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 728+8
+INDIRF4
+CNSTF4 1065353216
+GTF4 $1302
+ADDRLP4 728+56
+INDIRI4
+ADDRLP4 12+20
+INDIRI4
+EQI4 $1302
+ADDRLP4 712+8
+ADDRLP4 712+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+LABELV $1302
+ADDRLP4 148+272
+INDIRF4
+CNSTF4 0
+EQF4 $1308
+ADDRLP4 0
+ADDRLP4 712
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 712+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 712+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 988
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 808
+ADDRLP4 988
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18496
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18500
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18504
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 808
+INDIRF4
+CNSTF4 1120403456
+LEF4 $1324
+ADDRLP4 0
+ARGP4
+ADDRLP4 996
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 996
+INDIRF4
+CNSTF4 1149239296
+LTF4 $1322
+LABELV $1324
+ADDRLP4 724
+INDIRF4
+CNSTF4 1061997773
+LEF4 $1325
+ADDRFP4 0
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1325
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1120
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 808
+ADDRLP4 1120
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRLP4 12+48
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRLP4 12+48+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRLP4 12+48+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1124
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 1124
+INDIRF4
+ADDRLP4 12+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 1124
+INDIRF4
+ADDRLP4 12+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 12+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 1000
+ADDRLP4 12+24
+INDIRB
+ASGNB 12
+ADDRLP4 1000+8
+ADDRLP4 1000+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 1128
+CNSTF4 0
+ASGNF4
+ADDRLP4 936+8
+ADDRLP4 1128
+INDIRF4
+ASGNF4
+ADDRLP4 936+4
+ADDRLP4 1128
+INDIRF4
+ASGNF4
+ADDRLP4 936
+ADDRLP4 1128
+INDIRF4
+ASGNF4
+ADDRLP4 1012
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1000
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 1132
+CNSTI4 0
+ASGNI4
+ADDRLP4 1132
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 936
+ARGP4
+ADDRLP4 1132
+INDIRI4
+ARGI4
+CNSTF4 1092616192
+ADDRLP4 808
+INDIRF4
+MULF4
+ADDRLP4 148+272
+INDIRF4
+DIVF4
+CVFI4 4
+ARGI4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 1132
+INDIRI4
+ARGI4
+ADDRLP4 1132
+INDIRI4
+ARGI4
+ADDRLP4 1132
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 trap_AAS_PredictPlayerMovement
+CALLI4
+pop
+ADDRLP4 712
+ADDRLP4 1012
+INDIRB
+ASGNB 12
+ADDRGP4 $1326
+JUMPV
+LABELV $1325
+ADDRLP4 724
+INDIRF4
+CNSTF4 1053609165
+LEF4 $1358
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1004
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 808
+ADDRLP4 1004
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRLP4 12+48
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRLP4 12+48+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRLP4 12+48+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1008
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 948
+ADDRLP4 1008
+INDIRF4
+ADDRLP4 12+16
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 1012
+ADDRLP4 808
+INDIRF4
+ASGNF4
+ADDRLP4 1016
+ADDRLP4 948
+INDIRF4
+ASGNF4
+ADDRLP4 712
+ADDRLP4 12+24
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 1012
+INDIRF4
+ADDRLP4 148+272
+INDIRF4
+DIVF4
+ADDRLP4 1016
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 712+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 1012
+INDIRF4
+ADDRLP4 148+272
+INDIRF4
+DIVF4
+ADDRLP4 1016
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 712+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 808
+INDIRF4
+ADDRLP4 148+272
+INDIRF4
+DIVF4
+ADDRLP4 948
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1358
+LABELV $1326
+LABELV $1322
+LABELV $1308
+ADDRLP4 724
+INDIRF4
+CNSTF4 1058642330
+LEF4 $1393
+ADDRLP4 148+344+180
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1393
+ADDRLP4 148+344+172
+INDIRF4
+CNSTF4 1112014848
+LEF4 $1393
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+GEF4 $1399
+ADDRLP4 12+24
+ARGP4
+ADDRLP4 984
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $1399
+ADDRLP4 924
+ADDRLP4 12+24
+INDIRB
+ASGNB 12
+ADDRLP4 924+8
+ADDRLP4 924+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 728
+ARGP4
+ADDRLP4 12+24
+ARGP4
+ADDRLP4 988
+CNSTP4 0
+ASGNP4
+ADDRLP4 988
+INDIRP4
+ARGP4
+ADDRLP4 988
+INDIRP4
+ARGP4
+ADDRLP4 924
+ARGP4
+ADDRLP4 12+20
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 912
+ADDRLP4 712
+INDIRB
+ASGNB 12
+ADDRLP4 728+4
+INDIRI4
+CNSTI4 0
+EQI4 $1408
+ADDRLP4 912+8
+ADDRLP4 12+24+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRGP4 $1409
+JUMPV
+LABELV $1408
+ADDRLP4 912+8
+ADDRLP4 728+12+8
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+LABELV $1409
+ADDRLP4 728
+ARGP4
+ADDRLP4 812
+ARGP4
+ADDRLP4 992
+CNSTP4 0
+ASGNP4
+ADDRLP4 992
+INDIRP4
+ARGP4
+ADDRLP4 992
+INDIRP4
+ARGP4
+ADDRLP4 912
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 728+12+8
+INDIRF4
+ADDRLP4 912+8
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 996
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 996
+INDIRF4
+CNSTF4 1112014848
+GEF4 $1417
+ADDRLP4 0
+ADDRLP4 728+12
+INDIRF4
+ADDRLP4 912
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 728+12+4
+INDIRF4
+ADDRLP4 912+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 728+12+8
+INDIRF4
+ADDRLP4 912+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1000
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1000
+INDIRF4
+CNSTF4 1163984896
+GEF4 $1431
+ADDRLP4 0
+ADDRLP4 728+12
+INDIRF4
+ADDRLP4 812
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 728+12+4
+INDIRF4
+ADDRLP4 812+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 728+12+8
+INDIRF4
+ADDRLP4 812+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1004
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1004
+INDIRF4
+CNSTF4 1176256512
+LEF4 $1442
+ADDRLP4 728+12+8
+ADDRLP4 728+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 728
+ARGP4
+ADDRLP4 728+12
+ARGP4
+ADDRLP4 1008
+CNSTP4 0
+ASGNP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+ADDRLP4 12+24
+ARGP4
+ADDRLP4 12+20
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 728+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1449
+ADDRLP4 712
+ADDRLP4 912
+INDIRB
+ASGNB 12
+LABELV $1449
+LABELV $1442
+LABELV $1431
+LABELV $1417
+LABELV $1399
+LABELV $1393
+ADDRLP4 984
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 712
+ADDRLP4 712
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 984
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 144
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 988
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 712+4
+ADDRLP4 712+4
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 988
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 144
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 992
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 712+8
+ADDRLP4 712+8
+INDIRF4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 992
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 144
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1295
+JUMPV
+LABELV $1294
+ADDRLP4 712
+ADDRFP4 0
+INDIRP4
+CNSTI4 18800
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 712+8
+ADDRLP4 712+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 724
+INDIRF4
+CNSTF4 1056964608
+LEF4 $1455
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 9
+EQI4 $1463
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 5
+EQI4 $1463
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 4
+NEI4 $1457
+LABELV $1463
+ADDRLP4 852+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 852+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 852
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 852+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 852+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 852+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 852+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 852+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 852+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18800
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18796
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 852
+ARGP4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 796
+ARGP4
+ADDRLP4 984
+ADDRGP4 BotPredictVisiblePosition
+CALLI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+CNSTI4 0
+EQI4 $1476
+ADDRLP4 0
+ADDRLP4 796
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 796+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17188
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 796+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17192
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 992
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 992
+INDIRF4
+CNSTF4 1170735104
+LEF4 $1482
+ADDRLP4 712
+ADDRLP4 796
+INDIRB
+ASGNB 12
+ADDRLP4 712+8
+ADDRLP4 712+8
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+LABELV $1482
+LABELV $1476
+ADDRLP4 144
+CNSTF4 1065353216
+ASGNF4
+LABELV $1457
+LABELV $1455
+LABELV $1295
+ADDRLP4 792
+INDIRI4
+CNSTI4 0
+EQI4 $1485
+ADDRLP4 728
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRLP4 984
+CNSTP4 0
+ASGNP4
+ADDRLP4 984
+INDIRP4
+ARGP4
+ADDRLP4 984
+INDIRP4
+ARGP4
+ADDRLP4 712
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18472
+ADDP4
+ADDRLP4 728+12
+INDIRB
+ASGNB 12
+ADDRGP4 $1486
+JUMPV
+LABELV $1485
+ADDRFP4 0
+INDIRP4
+CNSTI4 18472
+ADDP4
+ADDRLP4 712
+INDIRB
+ASGNB 12
+LABELV $1486
+ADDRLP4 0
+ADDRLP4 712
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 712+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17188
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 712+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17192
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 2
+EQI4 $1500
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 3
+EQI4 $1500
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 6
+EQI4 $1500
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 7
+NEI4 $1492
+LABELV $1500
+ADDRLP4 0
+ARGP4
+ADDRLP4 984
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 808
+ADDRLP4 984
+INDIRF4
+ASGNF4
+ADDRLP4 808
+INDIRF4
+CNSTF4 1125515264
+LEF4 $1501
+ADDRLP4 808
+CNSTF4 1125515264
+ASGNF4
+LABELV $1501
+ADDRLP4 908
+CNSTF4 1053609165
+ADDRLP4 808
+INDIRF4
+CNSTF4 1125515264
+DIVF4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 144
+INDIRF4
+ADDRLP4 908
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1492
+ADDRLP4 144
+INDIRF4
+CNSTF4 1061997773
+GEF4 $1503
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+LABELV $1505
+ADDRLP4 984
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 988
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+ASGNP4
+ADDRLP4 988
+INDIRP4
+ADDRLP4 988
+INDIRP4
+INDIRF4
+CNSTF4 1050253722
+CNSTF4 1073741824
+ADDRLP4 984
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 144
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1506
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 3
+LTI4 $1505
+LABELV $1503
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 984
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 988
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ASGNP4
+ADDRLP4 988
+INDIRP4
+ADDRLP4 988
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 148+268
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 984
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 144
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 992
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ASGNP4
+ADDRLP4 992
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 996
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 992
+INDIRP4
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRLP4 1000
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1004
+ADDRFP4 0
+INDIRP4
+CNSTI4 18832
+ADDP4
+ASGNP4
+ADDRLP4 1004
+INDIRP4
+ADDRLP4 1004
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 148+264
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 1000
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 144
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1008
+ADDRFP4 0
+INDIRP4
+CNSTI4 18832
+ADDP4
+ASGNP4
+ADDRLP4 1008
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1012
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1008
+INDIRP4
+ADDRLP4 1012
+INDIRF4
+ASGNF4
+ADDRGP4 bot_challenge+12
+INDIRI4
+CNSTI4 0
+EQI4 $1511
+ADDRLP4 144
+INDIRF4
+CNSTF4 1063675494
+LEF4 $1514
+ADDRFP4 0
+INDIRP4
+CNSTI4 18388
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1514
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $1516
+ADDRLP4 1016
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ASGNP4
+ADDRLP4 1016
+INDIRP4
+ADDRLP4 1016
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $1516
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+ADDRGP4 EA_View
+CALLV
+pop
+LABELV $1514
+LABELV $1511
+LABELV $1209
+endproc BotAimAtEnemy 1136 56
+lit
+align 4
+LABELV $1519
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $1520
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export BotCheckAttack
+code
+proc BotCheckAttack 980 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 768
+ADDRGP4 $1519
+INDIRB
+ASGNB 12
+ADDRLP4 780
+ADDRGP4 $1520
+INDIRB
+ASGNB 12
+ADDRLP4 576
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 576
+INDIRI4
+ARGI4
+ADDRLP4 792
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 576
+INDIRI4
+CNSTI4 64
+LTI4 $1521
+LABELV $1521
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 924
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 680
+ADDRLP4 924
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18388
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 680
+INDIRF4
+SUBF4
+LEF4 $1523
+ADDRGP4 $1518
+JUMPV
+LABELV $1523
+ADDRFP4 0
+INDIRP4
+CNSTI4 18436
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 680
+INDIRF4
+SUBF4
+LEF4 $1525
+ADDRGP4 $1518
+JUMPV
+LABELV $1525
+ADDRFP4 0
+INDIRP4
+CNSTI4 18444
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+SUBF4
+LEF4 $1527
+ADDRGP4 $1518
+JUMPV
+LABELV $1527
+ADDRFP4 0
+INDIRP4
+CNSTI4 18448
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1529
+ADDRGP4 $1518
+JUMPV
+LABELV $1529
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 47
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 928
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 752
+ADDRLP4 928
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18452
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1531
+ADDRLP4 932
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 932
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 752
+INDIRF4
+LEF4 $1533
+ADDRFP4 0
+INDIRP4
+CNSTI4 18448
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 752
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18452
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1534
+JUMPV
+LABELV $1533
+ADDRFP4 0
+INDIRP4
+CNSTI4 18452
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ADDRLP4 752
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18448
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1534
+LABELV $1531
+ADDRLP4 580
+ADDRFP4 0
+INDIRP4
+CNSTI4 18472
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 580+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18476
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17188
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 580+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 18480
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17192
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1537
+ADDRLP4 580
+ARGP4
+ADDRLP4 940
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 940
+INDIRF4
+CNSTF4 1163984896
+LEF4 $1539
+ADDRGP4 $1518
+JUMPV
+LABELV $1539
+LABELV $1537
+ADDRLP4 580
+ARGP4
+ADDRLP4 940
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 940
+INDIRF4
+CNSTF4 1176256512
+GEF4 $1541
+ADDRLP4 748
+CNSTF4 1123024896
+ASGNF4
+ADDRGP4 $1542
+JUMPV
+LABELV $1541
+ADDRLP4 748
+CNSTF4 1112014848
+ASGNF4
+LABELV $1542
+ADDRLP4 580
+ARGP4
+ADDRLP4 756
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+ADDRLP4 748
+INDIRF4
+ARGF4
+ADDRLP4 756
+ARGP4
+ADDRLP4 944
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 944
+INDIRI4
+CNSTI4 0
+NEI4 $1543
+ADDRGP4 $1518
+JUMPV
+LABELV $1543
+ADDRLP4 684
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRLP4 952
+CNSTP4 0
+ASGNP4
+ADDRLP4 952
+INDIRP4
+ARGP4
+ADDRLP4 952
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18472
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 684+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1545
+ADDRLP4 684+56
+INDIRI4
+ADDRLP4 576
+INDIRI4
+EQI4 $1545
+ADDRGP4 $1518
+JUMPV
+LABELV $1545
+ADDRFP4 0
+INDIRP4
+CNSTI4 18788
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 656
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 656
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 656+4
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 656+8
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 24+292+8
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 964
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 668
+ADDRLP4 0
+INDIRF4
+ADDRLP4 964
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 668+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 964
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 668+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 968
+CNSTF4 3242196992
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 968
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 968
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3242196992
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 592
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 768
+ARGP4
+ADDRLP4 780
+ARGP4
+ADDRLP4 668
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 592+56
+INDIRI4
+CNSTI4 0
+LTI4 $1579
+ADDRLP4 592+56
+INDIRI4
+CNSTI4 64
+GEI4 $1579
+ADDRLP4 592+56
+INDIRI4
+ADDRLP4 576
+INDIRI4
+EQI4 $1583
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 592+56
+INDIRI4
+ARGI4
+ADDRLP4 972
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 972
+INDIRI4
+CNSTI4 0
+EQI4 $1586
+ADDRGP4 $1518
+JUMPV
+LABELV $1586
+LABELV $1583
+LABELV $1579
+ADDRLP4 592+56
+INDIRI4
+ADDRLP4 576
+INDIRI4
+NEI4 $1592
+ADDRLP4 576
+INDIRI4
+CNSTI4 64
+LTI4 $1589
+LABELV $1592
+ADDRLP4 24+344+180
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1593
+CNSTF4 1148846080
+ADDRLP4 592+8
+INDIRF4
+MULF4
+ADDRLP4 24+344+172
+INDIRF4
+GEF4 $1597
+ADDRLP4 976
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 920
+ADDRLP4 976
+INDIRF4
+ADDRLP4 24+344+168
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+ADDRLP4 976
+INDIRF4
+ADDRLP4 592+8
+INDIRF4
+MULF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 920
+INDIRF4
+CNSTF4 0
+LEF4 $1605
+ADDRGP4 $1518
+JUMPV
+LABELV $1605
+LABELV $1597
+LABELV $1593
+LABELV $1589
+ADDRLP4 24+176
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1607
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1608
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Attack
+CALLV
+pop
+ADDRGP4 $1608
+JUMPV
+LABELV $1607
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Attack
+CALLV
+pop
+LABELV $1608
+ADDRLP4 976
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+ASGNP4
+ADDRLP4 976
+INDIRP4
+ADDRLP4 976
+INDIRP4
+INDIRI4
+CNSTI4 2
+BXORI4
+ASGNI4
+LABELV $1518
+endproc BotCheckAttack 980 28
+lit
+align 4
+LABELV $1622
+byte 4 1143832576
+byte 4 1128792064
+byte 4 1139802112
+align 4
+LABELV $1623
+byte 4 1148321792
+byte 4 1139539968
+byte 4 1143603200
+align 4
+LABELV $1624
+byte 4 1134034944
+byte 4 1135607808
+byte 4 1147535360
+export BotMapScripts
+code
+proc BotMapScripts 1424 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRLP4 260
+ARGP4
+ADDRGP4 $1613
+ARGP4
+ADDRLP4 1304
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 132
+ARGP4
+ADDRLP4 1304
+INDIRP4
+ARGP4
+CNSTU4 127
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 132+127
+CNSTI1 0
+ASGNI1
+ADDRLP4 132
+ARGP4
+ADDRGP4 $1617
+ARGP4
+ADDRLP4 1308
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1308
+INDIRI4
+CNSTI4 0
+EQI4 $1621
+ADDRLP4 132
+ARGP4
+ADDRGP4 $1618
+ARGP4
+ADDRLP4 1312
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1312
+INDIRI4
+CNSTI4 0
+EQI4 $1621
+ADDRLP4 132
+ARGP4
+ADDRGP4 $1619
+ARGP4
+ADDRLP4 1316
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1316
+INDIRI4
+CNSTI4 0
+NEI4 $1615
+LABELV $1621
+ADDRLP4 1320
+ADDRGP4 $1622
+INDIRB
+ASGNB 12
+ADDRLP4 1332
+ADDRGP4 $1623
+INDIRB
+ASGNB 12
+ADDRLP4 1344
+ADDRGP4 $1624
+INDIRB
+ASGNB 12
+ADDRLP4 1356
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 1356
+INDIRP4
+ADDRLP4 1356
+INDIRP4
+INDIRI4
+CNSTI4 -16777217
+BANDI4
+ASGNI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 $1619
+ARGP4
+ADDRLP4 1360
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1360
+INDIRI4
+CNSTI4 0
+NEI4 $1625
+ADDRLP4 1320+8
+ADDRLP4 1320+8
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+ASGNF4
+ADDRLP4 1332+8
+ADDRLP4 1332+8
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+ASGNF4
+LABELV $1625
+ADDRLP4 1364
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1364
+INDIRF4
+ADDRLP4 1320
+INDIRF4
+LEF4 $1629
+ADDRLP4 1364
+INDIRF4
+ADDRLP4 1332
+INDIRF4
+GEF4 $1629
+ADDRLP4 1368
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1368
+INDIRF4
+ADDRLP4 1320+4
+INDIRF4
+LEF4 $1631
+ADDRLP4 1368
+INDIRF4
+ADDRLP4 1332+4
+INDIRF4
+GEF4 $1631
+ADDRLP4 1372
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1372
+INDIRF4
+ADDRLP4 1320+8
+INDIRF4
+LEF4 $1635
+ADDRLP4 1372
+INDIRF4
+ADDRLP4 1332+8
+INDIRF4
+GEF4 $1635
+ADDRGP4 $1612
+JUMPV
+LABELV $1635
+LABELV $1631
+LABELV $1629
+ADDRLP4 1368
+CNSTI4 0
+ASGNI4
+ADDRLP4 1284
+ADDRLP4 1368
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 1368
+INDIRI4
+ASGNI4
+ADDRGP4 $1642
+JUMPV
+LABELV $1639
+ADDRLP4 128
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $1644
+ADDRGP4 $1640
+JUMPV
+LABELV $1644
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1646
+ADDRGP4 $1640
+JUMPV
+LABELV $1646
+ADDRLP4 0
+ARGP4
+ADDRLP4 1372
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 1372
+INDIRI4
+CNSTI4 0
+NEI4 $1651
+ADDRLP4 0+20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+NEI4 $1648
+LABELV $1651
+ADDRGP4 $1640
+JUMPV
+LABELV $1648
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 1320
+INDIRF4
+LEF4 $1652
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 1332
+INDIRF4
+GEF4 $1652
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 1320+4
+INDIRF4
+LEF4 $1656
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 1332+4
+INDIRF4
+GEF4 $1656
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 1320+8
+INDIRF4
+LEF4 $1664
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 1332+8
+INDIRF4
+GEF4 $1664
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 1376
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1376
+INDIRI4
+CNSTI4 0
+EQI4 $1672
+ADDRLP4 1284
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1641
+JUMPV
+LABELV $1672
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+LTI4 $1676
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ADDRLP4 128
+INDIRI4
+NEI4 $1674
+LABELV $1676
+ADDRLP4 1284
+CNSTI4 1
+ASGNI4
+LABELV $1674
+LABELV $1664
+LABELV $1656
+LABELV $1652
+LABELV $1640
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1642
+ADDRLP4 128
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $1639
+LABELV $1641
+ADDRLP4 1284
+INDIRI4
+CNSTI4 0
+EQI4 $1677
+ADDRLP4 1372
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+ASGNP4
+ADDRLP4 1372
+INDIRP4
+ADDRLP4 1372
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRLP4 1288
+ADDRLP4 1344
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1288+4
+ADDRLP4 1344+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17188
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1288+8
+ADDRLP4 1344+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17192
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1288
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1380
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 1300
+ADDRLP4 1380
+INDIRF4
+ASGNF4
+ADDRLP4 1384
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1388
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ASGNP4
+ADDRLP4 1388
+INDIRP4
+ADDRLP4 1388
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+CNSTF4 1073741824
+ADDRLP4 1384
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 1300
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1392
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ASGNP4
+ADDRLP4 1392
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1396
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1392
+INDIRP4
+ADDRLP4 1396
+INDIRF4
+ASGNF4
+ADDRLP4 1400
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1404
+ADDRFP4 0
+INDIRP4
+CNSTI4 18832
+ADDP4
+ASGNP4
+ADDRLP4 1404
+INDIRP4
+ADDRLP4 1404
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+CNSTF4 1073741824
+ADDRLP4 1400
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 1300
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1408
+ADDRFP4 0
+INDIRP4
+CNSTI4 18832
+ADDP4
+ASGNP4
+ADDRLP4 1408
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1412
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1408
+INDIRP4
+ADDRLP4 1412
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRLP4 1420
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 1420
+INDIRI4
+CNSTI4 0
+EQI4 $1683
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Attack
+CALLV
+pop
+LABELV $1683
+LABELV $1677
+LABELV $1615
+LABELV $1612
+endproc BotMapScripts 1424 16
+data
+align 4
+LABELV VEC_UP
+byte 4 0
+byte 4 3212836864
+byte 4 0
+align 4
+LABELV MOVEDIR_UP
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV VEC_DOWN
+byte 4 0
+byte 4 3221225472
+byte 4 0
+align 4
+LABELV MOVEDIR_DOWN
+byte 4 0
+byte 4 0
+byte 4 3212836864
+export BotSetMovedir
+code
+proc BotSetMovedir 12 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 VEC_UP
+ARGP4
+ADDRLP4 0
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1686
+ADDRFP4 4
+INDIRP4
+ADDRGP4 MOVEDIR_UP
+INDIRB
+ASGNB 12
+ADDRGP4 $1687
+JUMPV
+LABELV $1686
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 VEC_DOWN
+ARGP4
+ADDRLP4 4
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1688
+ADDRFP4 4
+INDIRP4
+ADDRGP4 MOVEDIR_DOWN
+INDIRB
+ASGNB 12
+ADDRGP4 $1689
+JUMPV
+LABELV $1688
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $1689
+LABELV $1687
+LABELV $1685
+endproc BotSetMovedir 12 16
+export BotModelMinsMaxs
+proc BotModelMinsMaxs 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1694
+JUMPV
+LABELV $1691
+ADDRLP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1696
+ADDRGP4 $1692
+JUMPV
+LABELV $1696
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1698
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $1698
+ADDRGP4 $1692
+JUMPV
+LABELV $1698
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1700
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+EQI4 $1700
+ADDRGP4 $1692
+JUMPV
+LABELV $1700
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $1702
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1704
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1704
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1706
+ADDRFP4 16
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1706
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $1690
+JUMPV
+LABELV $1702
+LABELV $1692
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+ASGNP4
+LABELV $1694
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $1691
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1708
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $1708
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1710
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+LABELV $1710
+CNSTI4 0
+RETI4
+LABELV $1690
+endproc BotModelMinsMaxs 40 0
+lit
+align 4
+LABELV $1713
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $1714
+byte 4 3212836864
+byte 4 3212836864
+byte 4 3212836864
+export BotFuncButtonActivateGoal
+code
+proc BotFuncButtonActivateGoal 624 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 308
+ADDRGP4 $1713
+INDIRB
+ASGNB 12
+ADDRLP4 320
+ADDRGP4 $1714
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 544
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 544
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 544
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 544
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1715
+ARGP4
+ADDRLP4 148
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1716
+CNSTI4 0
+RETI4
+ADDRGP4 $1712
+JUMPV
+LABELV $1716
+ADDRLP4 148+1
+ARGP4
+ADDRLP4 548
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 292
+ADDRLP4 548
+INDIRI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+NEI4 $1719
+CNSTI4 0
+RETI4
+ADDRGP4 $1712
+JUMPV
+LABELV $1719
+ADDRLP4 292
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 552
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 344
+ADDRLP4 552
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1721
+ARGP4
+ADDRLP4 288
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 288
+INDIRF4
+CNSTF4 0
+NEF4 $1722
+ADDRLP4 288
+CNSTF4 1082130432
+ASGNF4
+LABELV $1722
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1724
+ARGP4
+ADDRLP4 352
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 276
+CNSTF4 0
+ASGNF4
+ADDRLP4 276+4
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRLP4 276+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 276
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotSetMovedir
+CALLV
+pop
+ADDRLP4 100
+ADDRLP4 84
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 72
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 556
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16
+ADDRLP4 556
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 556
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 1056964608
+ADDRLP4 16+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 560
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+INDIRF4
+ARGF4
+ADDRLP4 564
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4+8
+INDIRF4
+ARGF4
+ADDRLP4 568
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 560
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ADDRLP4 564
+INDIRF4
+ADDRLP4 100+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 568
+INDIRF4
+ADDRLP4 100+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 288
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1747
+ARGP4
+ADDRLP4 348
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 348
+INDIRF4
+CNSTF4 0
+EQF4 $1748
+ADDRLP4 572
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 572
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 572
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 112
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 356
+ARGP4
+ADDRLP4 576
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 576
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRLP4 580
+CNSTP4 0
+ASGNP4
+ADDRLP4 580
+INDIRP4
+ARGP4
+ADDRLP4 580
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 576
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 356+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1760
+ADDRLP4 356+56
+INDIRI4
+ADDRLP4 344
+INDIRI4
+NEI4 $1756
+LABELV $1760
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $1712
+JUMPV
+LABELV $1756
+CNSTI4 4
+ARGI4
+ADDRLP4 124
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1761
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $1765
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 584
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 588
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 584
+INDIRF4
+ADDRLP4 588
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1766
+JUMPV
+LABELV $1765
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 592
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 124
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 596
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 592
+INDIRF4
+ADDRLP4 596
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1766
+LABELV $1762
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1761
+ADDRLP4 584
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 584
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 584
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 296
+ADDRLP4 112
+INDIRB
+ASGNB 12
+ADDRLP4 296+8
+ADDRLP4 296+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 296
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1140850688
+SUBF4
+ASGNF4
+ADDRLP4 296
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 420
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 588
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 588
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1778
+JUMPV
+LABELV $1775
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 592
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 592
+INDIRI4
+CNSTI4 0
+EQI4 $1779
+ADDRGP4 $1777
+JUMPV
+LABELV $1779
+LABELV $1776
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1778
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1775
+LABELV $1777
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1781
+LABELV $1781
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1783
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 420
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1785
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $1789
+ADDRLP4 592
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 592
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 596
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 320
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 600
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 604
+ADDRLP4 592
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 604
+INDIRP4
+ADDRLP4 604
+INDIRP4
+INDIRF4
+ADDRLP4 596
+INDIRF4
+ADDRLP4 600
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1790
+JUMPV
+LABELV $1789
+ADDRLP4 608
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 608
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 612
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 308
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 616
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 620
+ADDRLP4 608
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 620
+INDIRP4
+ADDRLP4 620
+INDIRP4
+INDIRF4
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1790
+LABELV $1786
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1785
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1712
+JUMPV
+LABELV $1783
+CNSTI4 0
+RETI4
+ADDRGP4 $1712
+JUMPV
+LABELV $1748
+CNSTI4 4
+ARGI4
+ADDRLP4 124
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1791
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $1795
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 572
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 576
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 572
+INDIRF4
+ADDRLP4 576
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1796
+JUMPV
+LABELV $1795
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 580
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 124
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 584
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 580
+INDIRF4
+ADDRLP4 584
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1796
+LABELV $1792
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1791
+ADDRLP4 572
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 572
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 572
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 296
+ADDRLP4 112
+INDIRB
+ASGNB 12
+ADDRLP4 296+8
+ADDRLP4 296+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 296
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 296
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 576
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 576
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1808
+JUMPV
+LABELV $1805
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 580
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 580
+INDIRI4
+CNSTI4 0
+EQI4 $1809
+ADDRGP4 $1807
+JUMPV
+LABELV $1809
+LABELV $1806
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1808
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LTI4 $1805
+LABELV $1807
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+GEI4 $1811
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1821
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $1825
+ADDRLP4 580
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 580
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 584
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 320
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 588
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 592
+ADDRLP4 580
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 592
+INDIRP4
+ADDRLP4 592
+INDIRP4
+INDIRF4
+ADDRLP4 584
+INDIRF4
+ADDRLP4 588
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1826
+JUMPV
+LABELV $1825
+ADDRLP4 596
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 596
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 600
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 308
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 604
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 608
+ADDRLP4 596
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 608
+INDIRP4
+ADDRLP4 608
+INDIRP4
+INDIRF4
+ADDRLP4 600
+INDIRF4
+ADDRLP4 604
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1826
+LABELV $1822
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1821
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1712
+JUMPV
+LABELV $1811
+CNSTI4 0
+RETI4
+LABELV $1712
+endproc BotFuncButtonActivateGoal 624 28
+export BotFuncDoorActivateGoal
+proc BotFuncDoorActivateGoal 1080 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1715
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1828
+CNSTI4 0
+RETI4
+ADDRGP4 $1827
+JUMPV
+LABELV $1828
+ADDRLP4 12+1
+ARGP4
+ADDRLP4 1068
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $1831
+CNSTI4 0
+RETI4
+ADDRGP4 $1827
+JUMPV
+LABELV $1831
+ADDRLP4 1060
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1048
+ARGP4
+ADDRLP4 1072
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRF4
+ADDRLP4 1048
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 1036+4
+INDIRF4
+ADDRLP4 1048+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 1036+8
+INDIRF4
+ADDRLP4 1048+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 1076
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1076
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 1076
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $1827
+endproc BotFuncDoorActivateGoal 1080 20
+export BotTriggerMultipleActivateGoal
+proc BotTriggerMultipleActivateGoal 284 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 260
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1715
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 84
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1844
+CNSTI4 0
+RETI4
+ADDRGP4 $1843
+JUMPV
+LABELV $1844
+ADDRLP4 84+1
+ARGP4
+ADDRLP4 264
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 224
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $1847
+CNSTI4 0
+RETI4
+ADDRGP4 $1843
+JUMPV
+LABELV $1847
+ADDRLP4 224
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1073741824
+ARGI4
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 252
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 272
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1056964608
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 212
+ADDRLP4 240
+INDIRB
+ASGNB 12
+ADDRLP4 212+8
+ADDRLP4 212+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 212
+INDIRB
+ASGNB 12
+ADDRLP4 228+8
+ADDRLP4 228+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 212
+ARGP4
+ADDRLP4 228
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 276
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1864
+JUMPV
+LABELV $1861
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $1865
+ADDRGP4 $1863
+JUMPV
+LABELV $1865
+LABELV $1862
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1864
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $1861
+LABELV $1863
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GEI4 $1867
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1843
+JUMPV
+LABELV $1867
+CNSTI4 0
+RETI4
+LABELV $1843
+endproc BotTriggerMultipleActivateGoal 284 20
+export BotPopFromActivateGoalStack
+proc BotPopFromActivateGoalStack 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1878
+CNSTI4 0
+RETI4
+ADDRGP4 $1877
+JUMPV
+LABELV $1878
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $1877
+endproc BotPopFromActivateGoalStack 4 8
+export BotPushOntoActivateGoalStack
+proc BotPushOntoActivateGoalStack 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1176255488
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1881
+CNSTI4 248
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1885
+CNSTI4 248
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $1887
+ADDRLP4 4
+CNSTI4 248
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1887
+LABELV $1885
+LABELV $1882
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $1881
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+EQI4 $1889
+CNSTI4 248
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTU4 248
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 248
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 248
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+CNSTI4 244
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+CNSTI4 248
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $1880
+JUMPV
+LABELV $1889
+CNSTI4 0
+RETI4
+LABELV $1880
+endproc BotPushOntoActivateGoalStack 20 12
+export BotClearActivateGoalStack
+proc BotClearActivateGoalStack 0 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1893
+JUMPV
+LABELV $1892
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+LABELV $1893
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1892
+LABELV $1891
+endproc BotClearActivateGoalStack 0 4
+export BotEnableActivateGoalAreas
+proc BotEnableActivateGoalAreas 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1899
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1900
+JUMPV
+LABELV $1899
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1900
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1896
+ADDRGP4 $1895
+JUMPV
+LABELV $1896
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1904
+JUMPV
+LABELV $1901
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_EnableRoutingArea
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $1905
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotRoutingAreaChanged
+CALLV
+pop
+LABELV $1905
+LABELV $1902
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1904
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+LTI4 $1901
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1908
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1909
+JUMPV
+LABELV $1908
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $1909
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $1895
+endproc BotEnableActivateGoalAreas 12 8
+export BotIsGoingToActivateEntity
+proc BotIsGoingToActivateEntity 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1914
+JUMPV
+LABELV $1911
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1915
+ADDRGP4 $1912
+JUMPV
+LABELV $1915
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1917
+CNSTI4 1
+RETI4
+ADDRGP4 $1910
+JUMPV
+LABELV $1917
+LABELV $1912
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1914
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1911
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1919
+CNSTI4 248
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1923
+ADDRGP4 $1920
+JUMPV
+LABELV $1923
+CNSTI4 248
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1925
+CNSTI4 248
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $1927
+CNSTI4 1
+RETI4
+ADDRGP4 $1910
+JUMPV
+LABELV $1927
+LABELV $1925
+LABELV $1920
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $1919
+CNSTI4 0
+RETI4
+LABELV $1910
+endproc BotIsGoingToActivateEntity 8 0
+export BotGetActivateGoal
+proc BotGetActivateGoal 3296 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 248
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 3052
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 1712
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $1930
+ARGP4
+ADDRLP4 3052+92
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 3228
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3228
+INDIRI4
+ASGNI4
+ADDRGP4 $1935
+JUMPV
+LABELV $1932
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1715
+ARGP4
+ADDRLP4 1584
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3232
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3232
+INDIRI4
+CNSTI4 0
+NEI4 $1936
+ADDRGP4 $1933
+JUMPV
+LABELV $1936
+ADDRLP4 1712
+ARGP4
+ADDRLP4 1584
+ARGP4
+ADDRLP4 3236
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3236
+INDIRI4
+CNSTI4 0
+NEI4 $1938
+ADDRGP4 $1934
+JUMPV
+LABELV $1938
+LABELV $1933
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3232
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3232
+INDIRI4
+ASGNI4
+LABELV $1935
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1932
+LABELV $1934
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1940
+CNSTI4 3
+ARGI4
+ADDRGP4 $1942
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1929
+JUMPV
+LABELV $1940
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1943
+ARGP4
+ADDRLP4 1456
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 1456
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1944
+CNSTI4 3
+ARGI4
+ADDRGP4 $1946
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1929
+JUMPV
+LABELV $1944
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $1949
+ARGP4
+ADDRLP4 3236
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3236
+INDIRI4
+CNSTI4 0
+NEI4 $1947
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1747
+ARGP4
+ADDRLP4 3196
+ARGP4
+ADDRLP4 3240
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3240
+INDIRI4
+CNSTI4 0
+EQI4 $1950
+ADDRLP4 3196
+INDIRF4
+CNSTF4 0
+EQF4 $1952
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotFuncDoorActivateGoal
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1929
+JUMPV
+LABELV $1952
+LABELV $1950
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1954
+ARGP4
+ADDRLP4 3192
+ARGP4
+ADDRGP4 trap_AAS_IntForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 3192
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1955
+CNSTI4 0
+RETI4
+ADDRGP4 $1929
+JUMPV
+LABELV $1955
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1959
+ARGP4
+ADDRLP4 3180
+ARGP4
+ADDRLP4 3244
+ADDRGP4 trap_AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3244
+INDIRI4
+CNSTI4 0
+NEI4 $1957
+ADDRLP4 3248
+CNSTF4 0
+ASGNF4
+ADDRLP4 3180+8
+ADDRLP4 3248
+INDIRF4
+ASGNF4
+ADDRLP4 3180+4
+ADDRLP4 3248
+INDIRF4
+ASGNF4
+ADDRLP4 3180
+ADDRLP4 3248
+INDIRF4
+ASGNF4
+LABELV $1957
+ADDRLP4 3180
+ARGP4
+ADDRLP4 3052+24
+ARGP4
+ADDRLP4 3248
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 3248
+INDIRI4
+CNSTI4 0
+NEI4 $1962
+CNSTI4 0
+RETI4
+ADDRGP4 $1929
+JUMPV
+LABELV $1962
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1715
+ARGP4
+ADDRLP4 1712
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 1712
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1965
+ADDRLP4 1712+1
+ARGP4
+ADDRLP4 3252
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3200
+ADDRLP4 3252
+INDIRI4
+ASGNI4
+ADDRLP4 3200
+INDIRI4
+CNSTI4 0
+EQI4 $1968
+ADDRLP4 3200
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 3204
+ARGP4
+ADDRLP4 3216
+ARGP4
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+pop
+ADDRLP4 3204
+ARGP4
+ADDRLP4 3216
+ARGP4
+ADDRLP4 2740
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 3256
+ADDRGP4 trap_AAS_BBoxAreas
+CALLI4
+ASGNI4
+ADDRLP4 3048
+ADDRLP4 3256
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1973
+JUMPV
+LABELV $1970
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $1974
+ADDRGP4 $1972
+JUMPV
+LABELV $1974
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3260
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+NEI4 $1976
+ADDRGP4 $1971
+JUMPV
+LABELV $1976
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2996
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 2996
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1978
+ADDRLP4 3268
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+ASGNP4
+ADDRLP4 3264
+ADDRLP4 3268
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 3268
+INDIRP4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 3272
+CNSTI4 2
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+ADDRLP4 3272
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3272
+INDIRI4
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1978
+LABELV $1971
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1973
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3048
+INDIRI4
+LTI4 $1970
+LABELV $1972
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1983
+JUMPV
+LABELV $1980
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $1984
+ADDRGP4 $1982
+JUMPV
+LABELV $1984
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3260
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+EQI4 $1986
+ADDRGP4 $1981
+JUMPV
+LABELV $1986
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2996
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 2996
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1988
+ADDRLP4 3268
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+ASGNP4
+ADDRLP4 3264
+ADDRLP4 3268
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 3268
+INDIRP4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 3272
+CNSTI4 2
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+ADDRLP4 3272
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3272
+INDIRI4
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1988
+LABELV $1981
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1983
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3048
+INDIRI4
+LTI4 $1980
+LABELV $1982
+LABELV $1968
+LABELV $1965
+LABELV $1947
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $1992
+ARGP4
+ADDRLP4 3240
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3240
+INDIRI4
+CNSTI4 0
+NEI4 $1990
+CNSTI4 0
+RETI4
+ADDRGP4 $1929
+JUMPV
+LABELV $1990
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1995
+ARGP4
+ADDRLP4 136
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3244
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3244
+INDIRI4
+CNSTI4 0
+NEI4 $1993
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $1996
+CNSTI4 3
+ARGI4
+ADDRGP4 $1999
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1996
+CNSTI4 0
+RETI4
+ADDRGP4 $1929
+JUMPV
+LABELV $1993
+CNSTI4 0
+ARGI4
+ADDRLP4 3248
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 1416
+ADDRLP4 3248
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2003
+JUMPV
+LABELV $2000
+ADDRLP4 0
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2007
+JUMPV
+LABELV $2004
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2010
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3252
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3252
+INDIRI4
+CNSTI4 0
+NEI4 $2008
+ADDRGP4 $2005
+JUMPV
+LABELV $2008
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 3256
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3256
+INDIRI4
+CNSTI4 0
+NEI4 $2011
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3260
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+ADDRLP4 3260
+INDIRI4
+ASGNI4
+ADDRGP4 $2006
+JUMPV
+LABELV $2011
+LABELV $2005
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3252
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3252
+INDIRI4
+ASGNI4
+LABELV $2007
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2004
+LABELV $2006
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2013
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $2015
+CNSTI4 3
+ARGI4
+ADDRGP4 $2018
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2015
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2001
+JUMPV
+LABELV $2013
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1943
+ARGP4
+ADDRLP4 1456
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3256
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3256
+INDIRI4
+CNSTI4 0
+NEI4 $2019
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $2001
+CNSTI4 3
+ARGI4
+ADDRGP4 $2024
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2001
+JUMPV
+LABELV $2019
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $1992
+ARGP4
+ADDRLP4 3260
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+NEI4 $2025
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 3264
+ADDRGP4 BotFuncButtonActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 0
+NEI4 $2027
+ADDRGP4 $2001
+JUMPV
+LABELV $2027
+ADDRLP4 3268
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 3268
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2029
+ADDRLP4 3268
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2029
+ADDRLP4 3272
+CNSTI4 44
+ASGNI4
+ADDRLP4 3268
+INDIRP4
+ADDRLP4 3272
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 3272
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $2029
+ADDRLP4 3276
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 3268
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 3276
+INDIRF4
+LEF4 $2029
+ADDRLP4 3268
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 3276
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $2029
+ADDRGP4 $2001
+JUMPV
+LABELV $2029
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3280
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3280
+INDIRI4
+CNSTI4 0
+EQI4 $2031
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3288
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 2736
+ADDRLP4 3288
+INDIRI4
+ASGNI4
+ADDRLP4 2736
+INDIRI4
+CNSTI4 0
+NEI4 $2033
+ADDRGP4 $2001
+JUMPV
+LABELV $2033
+ADDRFP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 2736
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $2031
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1929
+JUMPV
+LABELV $2025
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2037
+ARGP4
+ADDRLP4 3264
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 0
+NEI4 $2035
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 3268
+ADDRGP4 BotTriggerMultipleActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 3268
+INDIRI4
+CNSTI4 0
+NEI4 $2038
+ADDRGP4 $2001
+JUMPV
+LABELV $2038
+ADDRLP4 3272
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 3272
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2040
+ADDRLP4 3272
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2040
+ADDRLP4 3276
+CNSTI4 44
+ASGNI4
+ADDRLP4 3272
+INDIRP4
+ADDRLP4 3276
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 3276
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $2040
+ADDRLP4 3280
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 3272
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 3280
+INDIRF4
+LEF4 $2040
+ADDRLP4 3272
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 3280
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $2040
+ADDRGP4 $2001
+JUMPV
+LABELV $2040
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3284
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3284
+INDIRI4
+CNSTI4 0
+EQI4 $2042
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3292
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 2736
+ADDRLP4 3292
+INDIRI4
+ASGNI4
+ADDRLP4 2736
+INDIRI4
+CNSTI4 0
+NEI4 $2044
+ADDRGP4 $2001
+JUMPV
+LABELV $2044
+ADDRFP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 2736
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $2042
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1929
+JUMPV
+LABELV $2035
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2048
+ARGP4
+ADDRLP4 3268
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3268
+INDIRI4
+CNSTI4 0
+NEI4 $2046
+ADDRGP4 $2001
+JUMPV
+LABELV $2046
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2051
+ARGP4
+ADDRLP4 3272
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3272
+INDIRI4
+CNSTI4 0
+EQI4 $2053
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2052
+ARGP4
+ADDRLP4 3276
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3276
+INDIRI4
+CNSTI4 0
+NEI4 $2049
+LABELV $2053
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1995
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136+128
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3280
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3280
+INDIRI4
+CNSTI4 0
+EQI4 $2054
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 3284
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+ADDRLP4 3284
+INDIRI4
+ASGNI4
+LABELV $2054
+LABELV $2049
+LABELV $2001
+LABELV $2003
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+LTI4 $2057
+ADDRLP4 132
+INDIRI4
+CNSTI4 10
+LTI4 $2000
+LABELV $2057
+CNSTI4 0
+RETI4
+LABELV $1929
+endproc BotGetActivateGoal 3296 20
+export BotGoForActivateGoal
+proc BotGoForActivateGoal 132 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $2059
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+LABELV $2059
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 240
+ADDP4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotPushOntoActivateGoalStack
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $2062
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2064
+ARGP4
+ADDRGP4 AIEnter_Seek_ActivateEntity
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2058
+JUMPV
+LABELV $2062
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $2058
+endproc BotGoForActivateGoal 132 8
+export BotPrintActivateGoalInfo
+proc BotPrintActivateGoalInfo 296 36
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 PlayerName
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $1943
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2066
+ADDRLP4 164
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $2068
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $2067
+JUMPV
+LABELV $2066
+ADDRLP4 164
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $2069
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $2067
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 164
+ARGP4
+ADDRGP4 EA_Say
+CALLV
+pop
+LABELV $2065
+endproc BotPrintActivateGoalInfo 296 36
+export BotRandomMove
+proc BotRandomMove 40 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1135869952
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $2073
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 36
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $2077
+ADDRGP4 $2075
+JUMPV
+LABELV $2077
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+CVFI4 4
+CNSTI4 45
+ADDI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+LABELV $2074
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+LTI4 $2073
+LABELV $2075
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+NEI4 $2082
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2083
+JUMPV
+LABELV $2082
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+LABELV $2083
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+LABELV $2070
+endproc BotRandomMove 40 16
+lit
+align 4
+LABELV $2085
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotCheckBlockedTeammates
+code
+proc BotCheckBlockedTeammates 408 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 284
+ADDRGP4 $2085
+INDIRB
+ASGNB 12
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+GEI4 $2086
+ADDRGP4 $2084
+JUMPV
+LABELV $2086
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $2089
+ADDRGP4 $2084
+JUMPV
+LABELV $2089
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2094
+JUMPV
+LABELV $2091
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $2096
+ADDRGP4 $2092
+JUMPV
+LABELV $2096
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 352
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+NEI4 $2098
+ADDRGP4 $2092
+JUMPV
+LABELV $2098
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $2100
+ADDRGP4 $2092
+JUMPV
+LABELV $2100
+ADDRLP4 28
+ARGP4
+ADDRLP4 356
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+NEI4 $2105
+ADDRLP4 28+20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+NEI4 $2102
+LABELV $2105
+ADDRGP4 $2092
+JUMPV
+LABELV $2102
+ADDRLP4 280
+CNSTI4 1
+ASGNI4
+ADDRLP4 156
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 252
+CNSTF4 1128792064
+ASGNF4
+ADDRLP4 236
+CNSTI4 720
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 360
+CNSTI4 8
+ASGNI4
+ADDRLP4 236
+INDIRP4
+ADDRLP4 360
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 360
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $2108
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1119092736
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 368
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 368
+INDIRF4
+CNSTF4 0
+EQF4 $2106
+LABELV $2108
+ADDRLP4 156
+CNSTF4 1107296256
+ASGNF4
+LABELV $2106
+ADDRLP4 28
+ARGP4
+ADDRLP4 372
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 0
+EQI4 $2109
+ADDRLP4 156
+CNSTF4 1124073472
+ASGNF4
+ADDRLP4 252
+CNSTF4 1137180672
+ASGNF4
+LABELV $2109
+ADDRLP4 156
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19268
+ADDP4
+INDIRF4
+LTF4 $2111
+ADDRLP4 376
+ADDRFP4 0
+INDIRP4
+CNSTI4 19268
+ADDP4
+ASGNP4
+ADDRLP4 376
+INDIRP4
+CNSTF4 1073741824
+ADDRLP4 376
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2111
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 28+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 28+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 28+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 256
+ARGP4
+ADDRLP4 268
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 160+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 160+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 172
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 268
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33619969
+ARGI4
+ADDRGP4 trap_ClipToEntities
+CALLV
+pop
+ADDRLP4 172+56
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $2125
+ADDRLP4 172+4
+INDIRI4
+CNSTI4 0
+NEI4 $2130
+ADDRLP4 172+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $2125
+LABELV $2130
+ADDRFP4 0
+INDIRP4
+CNSTI4 18376
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 284
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 240+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 240
+ADDRLP4 236
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 240
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 240+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 240+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 3259498496
+LEF4 $2132
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $2132
+ADDRLP4 392
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 392
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 392
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 3212836864
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 252
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRLP4 396
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 396
+INDIRI4
+CNSTI4 0
+NEI4 $2148
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 252
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRLP4 400
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 400
+INDIRI4
+CNSTI4 0
+NEI4 $2154
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 252
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRLP4 404
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 404
+INDIRI4
+CNSTI4 0
+NEI4 $2156
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+ARGP4
+ADDRLP4 252
+INDIRF4
+ARGF4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+LABELV $2156
+LABELV $2154
+LABELV $2148
+LABELV $2125
+LABELV $2092
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2094
+ADDRLP4 24
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $2091
+LABELV $2084
+endproc BotCheckBlockedTeammates 408 28
+lit
+align 4
+LABELV $2159
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotAIBlocked
+code
+proc BotAIBlocked 604 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 200
+ADDRGP4 $2159
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2160
+ADDRFP4 0
+INDIRP4
+CNSTI4 18456
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $2158
+JUMPV
+LABELV $2160
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 564
+ADDRGP4 BotWantsToWalk
+CALLI4
+ASGNI4
+ADDRLP4 564
+INDIRI4
+CNSTI4 0
+NEI4 $2162
+ADDRLP4 168
+CNSTF4 1137180672
+ASGNF4
+ADDRGP4 $2163
+JUMPV
+LABELV $2162
+ADDRLP4 168
+CNSTF4 1128792064
+ASGNF4
+LABELV $2163
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $2164
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+ADDRGP4 $2158
+JUMPV
+LABELV $2164
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 164
+CNSTI4 720
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 36+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 36+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 36+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 164
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2173
+ADDRLP4 164
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 176
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 176+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 176+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GTF4 $2181
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 572
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 572
+INDIRI4
+CNSTI4 0
+NEI4 $2175
+LABELV $2181
+CNSTI4 2
+ARGI4
+ADDRLP4 224
+ARGP4
+ADDRLP4 236
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 580
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 212
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ADDRLP4 580
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 212+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ADDRLP4 580
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 212+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+CNSTF4 1103101952
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 248
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRLP4 224
+ARGP4
+ADDRLP4 236
+ARGP4
+ADDRLP4 212
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33619969
+ARGI4
+ADDRGP4 trap_ClipToEntities
+CALLV
+pop
+ADDRLP4 248+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $2186
+ADDRGP4 $2158
+JUMPV
+LABELV $2186
+LABELV $2175
+ADDRLP4 576
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+ASGNP4
+ADDRLP4 576
+INDIRP4
+ADDRLP4 576
+INDIRP4
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+ADDRGP4 $2174
+JUMPV
+LABELV $2173
+ADDRLP4 36+92
+INDIRI4
+CNSTI4 0
+LEI4 $2189
+ADDRLP4 36+92
+INDIRI4
+ADDRGP4 max_bspmodelindex
+INDIRI4
+GTI4 $2189
+ADDRLP4 164
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $1949
+ARGP4
+ADDRLP4 572
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 576
+CNSTI4 0
+ASGNI4
+ADDRLP4 572
+INDIRI4
+ADDRLP4 576
+INDIRI4
+NEI4 $2193
+ADDRLP4 164
+INDIRP4
+CNSTI4 392
+ADDP4
+INDIRI4
+ADDRLP4 576
+INDIRI4
+NEI4 $2193
+ADDRLP4 164
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2195
+ADDRLP4 164
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2195
+ADDRGP4 $2158
+JUMPV
+LABELV $2195
+LABELV $2193
+ADDRLP4 164
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $1992
+ARGP4
+ADDRLP4 580
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 584
+CNSTI4 0
+ASGNI4
+ADDRLP4 580
+INDIRI4
+ADDRLP4 584
+INDIRI4
+NEI4 $2197
+ADDRLP4 164
+INDIRP4
+CNSTI4 392
+ADDP4
+INDIRI4
+ADDRLP4 584
+INDIRI4
+NEI4 $2197
+ADDRGP4 $2158
+JUMPV
+LABELV $2197
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2199
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36+20
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+ADDRLP4 588
+ADDRGP4 BotGetActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 560
+ADDRLP4 588
+INDIRI4
+ASGNI4
+ADDRLP4 560
+INDIRI4
+CNSTI4 0
+EQI4 $2202
+ADDRLP4 592
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 592
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2204
+ADDRLP4 592
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $2204
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2204
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 312+4+40
+INDIRI4
+ARGI4
+ADDRLP4 596
+ADDRGP4 BotIsGoingToActivateEntity
+CALLI4
+ASGNI4
+ADDRLP4 596
+INDIRI4
+CNSTI4 0
+NEI4 $2206
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 312
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotGoForActivateGoal
+CALLI4
+pop
+LABELV $2206
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $2203
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 600
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 600
+INDIRI4
+CNSTI4 0
+EQI4 $2203
+ADDRGP4 $2158
+JUMPV
+LABELV $2202
+ADDRLP4 312
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+LABELV $2203
+LABELV $2199
+LABELV $2189
+LABELV $2174
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 576
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 576
+INDIRF4
+CNSTF4 1036831949
+GEF4 $2214
+ADDRLP4 188
+CNSTF4 0
+ASGNF4
+ADDRLP4 580
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 188+4
+CNSTF4 1135869952
+ADDRLP4 580
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 188+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 188
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 584
+CNSTP4 0
+ASGNP4
+ADDRLP4 584
+INDIRP4
+ARGP4
+ADDRLP4 584
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $2214
+ADDRLP4 172
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2218
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 24+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $2218
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 580
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 580
+INDIRI4
+CNSTI4 0
+NEI4 $2224
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 584
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 584
+INDIRI4
+CNSTI4 0
+NEI4 $2226
+ADDRLP4 588
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+ASGNP4
+ADDRLP4 588
+INDIRP4
+ADDRLP4 588
+INDIRP4
+INDIRI4
+CNSTI4 16
+BXORI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 24+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 592
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 592
+INDIRI4
+CNSTI4 0
+NEI4 $2232
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+LABELV $2232
+LABELV $2226
+LABELV $2224
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2234
+ADDRFP4 0
+INDIRP4
+CNSTI4 18456
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1053609165
+SUBF4
+GEF4 $2236
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_NBG
+CVPU4 4
+NEU4 $2238
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2239
+JUMPV
+LABELV $2238
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_LTG
+CVPU4 4
+NEU4 $2240
+ADDRFP4 0
+INDIRP4
+CNSTI4 18324
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2240
+LABELV $2239
+LABELV $2236
+LABELV $2234
+LABELV $2158
+endproc BotAIBlocked 604 28
+export BotAIPredictObstacles
+proc BotAIPredictObstacles 328 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 bot_predictobstacles+12
+INDIRI4
+CNSTI4 0
+NEI4 $2243
+CNSTI4 0
+RETI4
+ADDRGP4 $2242
+JUMPV
+LABELV $2243
+ADDRFP4 0
+INDIRP4
+CNSTI4 18468
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $2246
+ADDRFP4 0
+INDIRP4
+CNSTI4 18464
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+LEF4 $2246
+CNSTI4 0
+RETI4
+ADDRGP4 $2242
+JUMPV
+LABELV $2246
+ADDRFP4 0
+INDIRP4
+CNSTI4 18468
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18464
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100
+ARGI4
+CNSTI4 1000
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTI4 1024
+ARGI4
+CNSTI4 67108864
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_AAS_PredictRoute
+CALLI4
+pop
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $2248
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2249
+ADDRLP4 304
+CNSTI4 24
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 255
+ADDRLP4 304
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 304
+INDIRI4
+RSHI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $2249
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 308
+CNSTP4 0
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $2249
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 48
+ARGP4
+ADDRLP4 316
+ADDRGP4 BotGetActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $2249
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 320
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2261
+ADDRLP4 320
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $2261
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2261
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48+4+40
+INDIRI4
+ARGI4
+ADDRLP4 324
+ADDRGP4 BotIsGoingToActivateEntity
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+NEI4 $2263
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotGoForActivateGoal
+CALLI4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2242
+JUMPV
+LABELV $2263
+ADDRLP4 48
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRGP4 $2249
+JUMPV
+LABELV $2248
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2267
+ADDRLP4 0+24
+INDIRI4
+CNSTI4 67108864
+BANDI4
+CNSTI4 0
+EQI4 $2270
+LABELV $2270
+LABELV $2267
+LABELV $2249
+CNSTI4 0
+RETI4
+LABELV $2242
+endproc BotAIPredictObstacles 328 44
+export BotCheckConsoleMessages
+proc BotCheckConsoleMessages 1016 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 912
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 PlayerName
+CALLP4
+pop
+ADDRGP4 $2275
+JUMPV
+LABELV $2274
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 952
+ADDRGP4 BotNumConsoleMessages
+CALLI4
+ASGNI4
+ADDRLP4 952
+INDIRI4
+CNSTI4 10
+GEI4 $2277
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $2279
+ADDRLP4 956
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 956
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1065353216
+ADDF4
+SUBF4
+LEF4 $2279
+ADDRGP4 $2276
+JUMPV
+LABELV $2279
+LABELV $2277
+ADDRLP4 280
+ADDRLP4 0+12
+ASGNP4
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $2284
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 292
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRLP4 956
+ADDRGP4 BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 956
+INDIRI4
+CNSTI4 0
+EQI4 $2287
+ADDRLP4 280
+ADDRLP4 292+264+16
+INDIRI1
+CVII4 1
+ADDRLP4 0+12
+ADDP4
+ASGNP4
+LABELV $2287
+LABELV $2284
+ADDRLP4 280
+INDIRP4
+ARGP4
+ADDRGP4 UnifyWhiteSpaces
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 956
+ADDRGP4 BotSynonymContext
+CALLI4
+ASGNI4
+ADDRLP4 288
+ADDRLP4 956
+INDIRI4
+ASGNI4
+ADDRLP4 280
+INDIRP4
+ARGP4
+ADDRLP4 288
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 BotReplaceSynonyms
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 960
+ADDRGP4 BotMatchMessage
+CALLI4
+ASGNI4
+ADDRLP4 960
+INDIRI4
+CNSTI4 0
+NEI4 $2293
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $2296
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+NEI4 $2296
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 292
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRLP4 964
+ADDRGP4 BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 964
+INDIRI4
+CNSTI4 0
+NEI4 $2300
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRGP4 BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $2275
+JUMPV
+LABELV $2300
+ADDRLP4 292+260
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $2303
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRGP4 BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $2275
+JUMPV
+LABELV $2303
+ADDRLP4 292
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 876
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 BotMatchVariable
+CALLV
+pop
+ADDRLP4 292
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 620
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 BotMatchVariable
+CALLV
+pop
+ADDRLP4 876
+ARGP4
+ADDRLP4 968
+ADDRGP4 PlayerFromName
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRLP4 968
+INDIRI4
+NEI4 $2306
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRGP4 BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $2275
+JUMPV
+LABELV $2306
+ADDRLP4 620
+ARGP4
+ADDRGP4 UnifyWhiteSpaces
+CALLV
+pop
+ADDRGP4 bot_testrchat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testrchat+12
+INDIRI4
+CNSTI4 0
+EQI4 $2308
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 620
+ARGP4
+ADDRLP4 288
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 972
+CNSTP4 0
+ASGNP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRLP4 912
+ARGP4
+ADDRLP4 876
+ARGP4
+ADDRLP4 976
+ADDRGP4 BotReplyChat
+CALLI4
+ASGNI4
+ADDRLP4 976
+INDIRI4
+CNSTI4 0
+EQI4 $2311
+CNSTI4 1
+ARGI4
+ADDRGP4 $2313
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2309
+JUMPV
+LABELV $2311
+CNSTI4 1
+ARGI4
+ADDRGP4 $2314
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2309
+JUMPV
+LABELV $2308
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Stand
+CVPU4 4
+EQU4 $2315
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 976
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 976
+INDIRI4
+CNSTI4 0
+EQI4 $2315
+ADDRLP4 980
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 980
+INDIRI4
+CNSTI4 0
+NEI4 $2315
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 35
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 984
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 948
+ADDRLP4 984
+INDIRF4
+ASGNF4
+ADDRLP4 988
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 992
+ADDRGP4 NumBots
+CALLI4
+ASGNI4
+ADDRLP4 988
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1069547520
+ADDRLP4 992
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+DIVF4
+GEF4 $2317
+ADDRLP4 996
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 996
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 948
+INDIRF4
+GEF4 $2317
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 620
+ARGP4
+ADDRLP4 288
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 1000
+CNSTP4 0
+ASGNP4
+ADDRLP4 1000
+INDIRP4
+ARGP4
+ADDRLP4 1000
+INDIRP4
+ARGP4
+ADDRLP4 1000
+INDIRP4
+ARGP4
+ADDRLP4 1000
+INDIRP4
+ARGP4
+ADDRLP4 1000
+INDIRP4
+ARGP4
+ADDRLP4 1000
+INDIRP4
+ARGP4
+ADDRLP4 912
+ARGP4
+ADDRLP4 876
+ARGP4
+ADDRLP4 1004
+ADDRGP4 BotReplyChat
+CALLI4
+ASGNI4
+ADDRLP4 1004
+INDIRI4
+CNSTI4 0
+EQI4 $2319
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRGP4 BotRemoveConsoleMessage
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1012
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18352
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 1012
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2321
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+ADDRGP4 $2276
+JUMPV
+LABELV $2319
+LABELV $2317
+LABELV $2315
+LABELV $2309
+LABELV $2296
+LABELV $2293
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRGP4 BotRemoveConsoleMessage
+CALLV
+pop
+LABELV $2275
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 952
+ADDRGP4 BotNextConsoleMessage
+CALLI4
+ASGNI4
+ADDRLP4 284
+ADDRLP4 952
+INDIRI4
+ASGNI4
+ADDRLP4 952
+INDIRI4
+CNSTI4 0
+NEI4 $2274
+LABELV $2276
+LABELV $2273
+endproc BotCheckConsoleMessages 1016 48
+export BotCheckForGrenades
+proc BotCheckForGrenades 4 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2325
+ADDRFP4 4
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 4
+EQI4 $2323
+LABELV $2325
+ADDRGP4 $2322
+JUMPV
+LABELV $2323
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+CNSTF4 1126170624
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAddAvoidSpot
+CALLV
+pop
+LABELV $2322
+endproc BotCheckForGrenades 4 16
+export BotCheckEvents
+proc BotCheckEvents 180 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 132
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 720
+ADDRLP4 132
+INDIRI4
+MULI4
+ADDRGP4 g_entities+368
+ADDP4
+INDIRI4
+NEI4 $2327
+ADDRGP4 $2326
+JUMPV
+LABELV $2327
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+ADDP4
+CNSTI4 720
+ADDRLP4 136
+INDIRI4
+MULI4
+ADDRGP4 g_entities+368
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 14
+LEI4 $2331
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 14
+SUBI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+ADDRGP4 $2332
+JUMPV
+LABELV $2331
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+LABELV $2332
+ADDRLP4 140
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+LTI4 $2333
+ADDRLP4 140
+INDIRI4
+CNSTI4 74
+GTI4 $2333
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2400-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2400
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2334
+address $2333
+address $2333
+address $2385
+address $2333
+address $2333
+address $2386
+address $2364
+address $2372
+address $2333
+address $2333
+address $2333
+address $2333
+address $2333
+address $2333
+address $2333
+address $2333
+address $2333
+address $2333
+address $2333
+address $2335
+address $2333
+address $2333
+address $2333
+address $2333
+address $2333
+address $2333
+address $2333
+address $2333
+address $2333
+address $2333
+address $2333
+address $2333
+address $2333
+address $2333
+address $2334
+code
+LABELV $2335
+ADDRLP4 144
+ADDRFP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 148
+ADDRFP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 152
+ADDRFP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 level+92
+INDIRI4
+CNSTI4 3
+GEI4 $2336
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2337
+JUMPV
+LABELV $2336
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 43
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 168
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 160
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 176
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 160
+INDIRF4
+GEF4 $2340
+ADDRLP4 172
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2341
+JUMPV
+LABELV $2340
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+LABELV $2341
+ADDRLP4 156
+ADDRLP4 172
+INDIRI4
+ASGNI4
+LABELV $2337
+ADDRLP4 144
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $2342
+ADDRFP4 0
+INDIRP4
+CNSTI4 18248
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18244
+ADDP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 168
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ADDRLP4 148
+INDIRI4
+EQI4 $2347
+ADDRLP4 168
+INDIRI4
+CNSTI4 4095
+EQI4 $2347
+ADDRLP4 168
+INDIRI4
+CNSTI4 4094
+NEI4 $2344
+LABELV $2347
+ADDRFP4 0
+INDIRP4
+CNSTI4 18256
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2345
+JUMPV
+LABELV $2344
+ADDRFP4 0
+INDIRP4
+CNSTI4 18256
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2345
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 18276
+ADDP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 172
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18256
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2334
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $2350
+ADDRLP4 148
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18284
+ADDP4
+INDIRI4
+EQI4 $2352
+ADDRFP4 0
+INDIRP4
+CNSTI4 18284
+ADDP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18288
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2352
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+CNSTI4 18288
+ADDP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ADDRLP4 176
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2334
+JUMPV
+LABELV $2350
+ADDRFP4 0
+INDIRP4
+CNSTI4 18284
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18288
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2334
+JUMPV
+LABELV $2342
+ADDRLP4 148
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $2354
+ADDRFP4 0
+INDIRP4
+CNSTI4 18252
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18240
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18424
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 18280
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18284
+ADDP4
+INDIRI4
+NEI4 $2334
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $2358
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 18288
+ADDP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 172
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2359
+JUMPV
+LABELV $2358
+ADDRFP4 0
+INDIRP4
+CNSTI4 18288
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2359
+ADDRFP4 0
+INDIRP4
+CNSTI4 18288
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $2334
+ADDRFP4 0
+INDIRP4
+CNSTI4 18284
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $2334
+JUMPV
+LABELV $2354
+ADDRLP4 168
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+NEI4 $2334
+ADDRLP4 144
+INDIRI4
+ADDRLP4 168
+INDIRI4
+NEI4 $2334
+ADDRFP4 0
+INDIRP4
+CNSTI4 18260
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2334
+JUMPV
+LABELV $2364
+ADDRLP4 144
+ADDRFP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+LTI4 $2367
+ADDRLP4 144
+INDIRI4
+CNSTI4 256
+LTI4 $2365
+LABELV $2367
+CNSTI4 3
+ARGI4
+ADDRGP4 $2368
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2334
+JUMPV
+LABELV $2365
+ADDRFP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $2371
+ARGP4
+ADDRLP4 148
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $2334
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoForPowerups
+CALLV
+pop
+ADDRGP4 $2334
+JUMPV
+LABELV $2372
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $2334
+ADDRLP4 144
+ADDRFP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+LTI4 $2334
+ADDRLP4 144
+INDIRI4
+CNSTI4 5
+GTI4 $2334
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2384
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2384
+address $2378
+address $2379
+address $2380
+address $2381
+address $2382
+address $2383
+code
+LABELV $2378
+ADDRFP4 0
+INDIRP4
+CNSTI4 19212
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19208
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2334
+JUMPV
+LABELV $2379
+ADDRFP4 0
+INDIRP4
+CNSTI4 19212
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19208
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2334
+JUMPV
+LABELV $2380
+ADDRFP4 0
+INDIRP4
+CNSTI4 19212
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2334
+JUMPV
+LABELV $2381
+ADDRFP4 0
+INDIRP4
+CNSTI4 19208
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2334
+JUMPV
+LABELV $2382
+ADDRFP4 0
+INDIRP4
+CNSTI4 19212
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2334
+JUMPV
+LABELV $2383
+ADDRFP4 0
+INDIRP4
+CNSTI4 19208
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2334
+JUMPV
+LABELV $2385
+ADDRGP4 lastteleport_origin
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 lastteleport_time
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $2334
+JUMPV
+LABELV $2386
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $2334
+ADDRLP4 144
+ADDRFP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+LTI4 $2391
+ADDRLP4 144
+INDIRI4
+CNSTI4 256
+LTI4 $2389
+LABELV $2391
+CNSTI4 3
+ARGI4
+ADDRGP4 $2392
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2334
+JUMPV
+LABELV $2389
+ADDRFP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $2395
+ARGP4
+ADDRLP4 148
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $2334
+ADDRFP4 0
+INDIRP4
+CNSTI4 17320
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2334
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Use
+CALLV
+pop
+LABELV $2333
+LABELV $2334
+LABELV $2326
+endproc BotCheckEvents 180 16
+export BotCheckSnapshot
+proc BotCheckSnapshot 256 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAddAvoidSpot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18508
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18768
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 248
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2404
+JUMPV
+LABELV $2403
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckEvents
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckForGrenades
+CALLV
+pop
+LABELV $2404
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 248
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 252
+ADDRGP4 BotAI_GetSnapshotEntity
+CALLI4
+ASGNI4
+ADDRLP4 248
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 -1
+NEI4 $2403
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 0+212
+ADDRFP4 0
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+216
+ADDRFP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckEvents
+CALLV
+pop
+LABELV $2402
+endproc BotCheckSnapshot 256 16
+export BotCheckTeamScores
+proc BotCheckTeamScores 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $2412
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $2417
+ADDRGP4 $2408
+JUMPV
+LABELV $2412
+ADDRFP4 0
+INDIRP4
+CNSTI4 18304
+ADDP4
+ADDRGP4 level+56+8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18308
+ADDP4
+ADDRGP4 level+56+4
+INDIRI4
+ASGNI4
+ADDRGP4 $2410
+JUMPV
+LABELV $2417
+ADDRFP4 0
+INDIRP4
+CNSTI4 18304
+ADDP4
+ADDRGP4 level+56+4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18308
+ADDP4
+ADDRGP4 level+56+8
+INDIRI4
+ASGNI4
+LABELV $2410
+LABELV $2408
+endproc BotCheckTeamScores 8 0
+export BotCheckAir
+proc BotCheckAir 4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17344
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $2423
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $2425
+ADDRGP4 $2422
+JUMPV
+LABELV $2425
+LABELV $2423
+ADDRFP4 0
+INDIRP4
+CNSTI4 18432
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $2422
+endproc BotCheckAir 4 4
+export BotAlternateRoute
+proc BotAlternateRoute 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18944
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2428
+ADDRFP4 0
+INDIRP4
+CNSTI4 18988
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $2430
+ADDRFP4 4
+INDIRP4
+RETP4
+ADDRGP4 $2427
+JUMPV
+LABELV $2430
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18944
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2432
+ADDRLP4 12
+INDIRI4
+CNSTI4 20
+GEI4 $2432
+ADDRFP4 0
+INDIRP4
+CNSTI4 18988
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $2432
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18932
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18932
+ADDP4
+RETP4
+ADDRGP4 $2427
+JUMPV
+LABELV $2428
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $2427
+endproc BotAlternateRoute 16 16
+export BotGetAlternateRouteGoal
+proc BotGetAlternateRouteGoal 28 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $2435
+ADDRLP4 12
+ADDRGP4 red_altroutegoals
+ASGNP4
+ADDRLP4 4
+ADDRGP4 red_numaltroutegoals
+INDIRI4
+ASGNI4
+ADDRGP4 $2436
+JUMPV
+LABELV $2435
+ADDRLP4 12
+ADDRGP4 blue_altroutegoals
+ASGNP4
+ADDRLP4 4
+ADDRGP4 blue_numaltroutegoals
+INDIRI4
+ASGNI4
+LABELV $2436
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2437
+CNSTI4 0
+RETI4
+ADDRGP4 $2434
+JUMPV
+LABELV $2437
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $2439
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2439
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 18932
+ADDP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18988
+ADDP4
+CNSTF4 0
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $2434
+endproc BotGetAlternateRouteGoal 28 0
+export BotSetupAlternativeRouteGoals
+proc BotSetupAlternativeRouteGoals 0 0
+ADDRGP4 altroutegoals_setup
+INDIRI4
+CNSTI4 0
+EQI4 $2442
+ADDRGP4 $2441
+JUMPV
+LABELV $2442
+ADDRGP4 altroutegoals_setup
+CNSTI4 1
+ASGNI4
+LABELV $2441
+endproc BotSetupAlternativeRouteGoals 0 0
+export BotDeathmatchAI
+proc BotDeathmatchAI 324 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18264
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2445
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 18264
+ADDP4
+ASGNP4
+ADDRLP4 292
+INDIRP4
+ADDRLP4 292
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18264
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2447
+ADDRGP4 $2444
+JUMPV
+LABELV $2447
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 148
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 Characteristic_String
+CALLV
+pop
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 109
+NEI4 $2449
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotSetChatGender
+CALLV
+pop
+ADDRGP4 $2450
+JUMPV
+LABELV $2449
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 102
+NEI4 $2451
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotSetChatGender
+CALLV
+pop
+ADDRGP4 $2452
+JUMPV
+LABELV $2451
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotSetChatGender
+CALLV
+pop
+LABELV $2452
+LABELV $2450
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 PlayerName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSetChatName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18292
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18296
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18264
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 BotSetupAlternativeRouteGoals
+CALLV
+pop
+LABELV $2445
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+ASGNP4
+ADDRLP4 292
+INDIRP4
+ADDRLP4 292
+INDIRP4
+INDIRI4
+CNSTI4 -33
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+NEI4 $2453
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeleportTime
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotUpdateInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckSnapshot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAir
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckTeamScores
+CALLV
+pop
+LABELV $2453
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckConsoleMessages
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+NEI4 $2455
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+NEI4 $2455
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotTeamAI
+CALLV
+pop
+LABELV $2455
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2457
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2459
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+LABELV $2457
+ADDRFP4 0
+INDIRP4
+CNSTI4 18272
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2460
+ADDRFP4 0
+INDIRP4
+CNSTI4 18320
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+LEF4 $2460
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotChat_EnterGame
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $2462
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18352
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 320
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2464
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+LABELV $2462
+ADDRFP4 0
+INDIRP4
+CNSTI4 18272
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $2460
+ADDRGP4 BotResetNodeSwitches
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2465
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $2469
+ADDRGP4 $2467
+JUMPV
+LABELV $2469
+LABELV $2466
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+LTI4 $2465
+LABELV $2467
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $2471
+ADDRGP4 $2444
+JUMPV
+LABELV $2471
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+LTI4 $2473
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotDumpGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotDumpAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotDumpNodeSwitches
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 PlayerName
+CALLP4
+pop
+CNSTI4 3
+ARGI4
+ADDRGP4 $2475
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+CNSTI4 50
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2473
+ADDRFP4 0
+INDIRP4
+CNSTI4 18292
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18296
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2444
+endproc BotDeathmatchAI 324 20
+export BotSetEntityNumForGoalWithModel
+proc BotSetEntityNumForGoalWithModel 44 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 G_ModelIndex
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2480
+JUMPV
+LABELV $2477
+ADDRLP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2482
+ADDRGP4 $2478
+JUMPV
+LABELV $2482
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2484
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $2484
+ADDRGP4 $2478
+JUMPV
+LABELV $2484
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2486
+ADDRGP4 $2478
+JUMPV
+LABELV $2486
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1120403456
+GEF4 $2490
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2490
+LABELV $2478
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+ASGNP4
+LABELV $2480
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $2477
+LABELV $2476
+endproc BotSetEntityNumForGoalWithModel 44 4
+export BotSetEntityNumForGoal
+proc BotSetEntityNumForGoal 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2496
+JUMPV
+LABELV $2493
+ADDRLP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2498
+ADDRGP4 $2494
+JUMPV
+LABELV $2498
+ADDRLP4 0
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $2500
+ADDRGP4 $2494
+JUMPV
+LABELV $2500
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1120403456
+GEF4 $2504
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $2492
+JUMPV
+LABELV $2504
+LABELV $2494
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+ASGNP4
+LABELV $2496
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $2493
+LABELV $2492
+endproc BotSetEntityNumForGoal 36 8
+export BotSetEntityNumForGoalWithActivator
+proc BotSetEntityNumForGoalWithActivator 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2510
+JUMPV
+LABELV $2507
+ADDRLP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2514
+ADDRLP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2512
+LABELV $2514
+ADDRGP4 $2508
+JUMPV
+LABELV $2512
+ADDRLP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2515
+ADDRGP4 $2508
+JUMPV
+LABELV $2515
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1120403456
+GEF4 $2519
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $2506
+JUMPV
+LABELV $2519
+LABELV $2508
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+ASGNP4
+LABELV $2510
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $2507
+LABELV $2506
+endproc BotSetEntityNumForGoalWithActivator 40 8
+export BotGoalForBSPEntity
+proc BotGoalForBSPEntity 1128 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 1108
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRGP4 $2525
+JUMPV
+LABELV $2522
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1943
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $2526
+ADDRGP4 $2523
+JUMPV
+LABELV $2526
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1116
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $2528
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1959
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1120
+ADDRGP4 trap_AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $2530
+CNSTI4 0
+RETI4
+ADDRGP4 $2521
+JUMPV
+LABELV $2530
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1040
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1040+8
+ADDRLP4 1040+8
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 1052
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1052+8
+ADDRLP4 1052+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1052
+ARGP4
+ADDRLP4 1068
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 1124
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1124
+INDIRI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $2534
+CNSTI4 0
+RETI4
+ADDRGP4 $2521
+JUMPV
+LABELV $2534
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2521
+JUMPV
+LABELV $2528
+LABELV $2523
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+LABELV $2525
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2522
+CNSTI4 0
+RETI4
+LABELV $2521
+endproc BotGoalForBSPEntity 1128 20
+export BotSetupDeathmatchAI
+proc BotSetupDeathmatchAI 156 16
+ADDRGP4 $2537
+ARGP4
+ADDRLP4 136
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 gametype
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRGP4 bot_rocketjump
+ARGP4
+ADDRGP4 $2538
+ARGP4
+ADDRGP4 $2539
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_grapple
+ARGP4
+ADDRGP4 $2540
+ARGP4
+ADDRGP4 $2539
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_fastchat
+ARGP4
+ADDRGP4 $2541
+ARGP4
+ADDRGP4 $2542
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_nochat
+ARGP4
+ADDRGP4 $2543
+ARGP4
+ADDRGP4 $2542
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_testichat
+ARGP4
+ADDRGP4 $2544
+ARGP4
+ADDRGP4 $2542
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_testrchat
+ARGP4
+ADDRGP4 $2545
+ARGP4
+ADDRGP4 $2542
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_challenge
+ARGP4
+ADDRGP4 $2546
+ARGP4
+ADDRGP4 $2542
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_predictobstacles
+ARGP4
+ADDRGP4 $2547
+ARGP4
+ADDRGP4 $2539
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_offhandgrapple
+ARGP4
+ADDRGP4 $2548
+ARGP4
+ADDRGP4 $2542
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_droppedweight
+ARGP4
+ADDRGP4 $2549
+ARGP4
+ADDRGP4 $2550
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 g_spSkill
+ARGP4
+ADDRGP4 $2551
+ARGP4
+ADDRGP4 $2552
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $2553
+CNSTI4 -1
+ARGI4
+ADDRGP4 $2557
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $2555
+CNSTI4 2
+ARGI4
+ADDRGP4 $2558
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2555
+CNSTI4 -1
+ARGI4
+ADDRGP4 $2561
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $2559
+CNSTI4 2
+ARGI4
+ADDRGP4 $2562
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2559
+LABELV $2553
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 max_bspmodelindex
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRGP4 $2566
+JUMPV
+LABELV $2563
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1715
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $2567
+ADDRGP4 $2564
+JUMPV
+LABELV $2567
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $2569
+ADDRLP4 4+1
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ADDRGP4 max_bspmodelindex
+INDIRI4
+LEI4 $2572
+ADDRGP4 max_bspmodelindex
+ADDRLP4 132
+INDIRI4
+ASGNI4
+LABELV $2572
+LABELV $2569
+LABELV $2564
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 148
+INDIRI4
+ASGNI4
+LABELV $2566
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2563
+ADDRGP4 BotInitWaypoints
+CALLV
+pop
+LABELV $2536
+endproc BotSetupDeathmatchAI 156 16
+export BotShutdownDeathmatchAI
+proc BotShutdownDeathmatchAI 0 0
+ADDRGP4 altroutegoals_setup
+CNSTI4 0
+ASGNI4
+LABELV $2574
+endproc BotShutdownDeathmatchAI 0 0
+bss
+export botvisstats
+align 4
+LABELV botvisstats
+skip 20
+export botvisframeactive
+align 4
+LABELV botvisframeactive
+skip 4
+export botvisframe
+align 4
+LABELV botvisframe
+skip 4
+export botviscache
+align 4
+LABELV botviscache
+skip 131072
+export blue_numaltroutegoals
+align 4
+LABELV blue_numaltroutegoals
+skip 4
+export blue_altroutegoals
+align 4
+LABELV blue_altroutegoals
+skip 768
+export red_numaltroutegoals
+align 4
+LABELV red_numaltroutegoals
+skip 4
+export red_altroutegoals
+align 4
+LABELV red_altroutegoals
+skip 768
+export altroutegoals_setup
+align 4
+LABELV altroutegoals_setup
+skip 4
+export max_bspmodelindex
+align 4
+LABELV max_bspmodelindex
+skip 4
+export lastteleport_time
+align 4
+LABELV lastteleport_time
+skip 4
+export lastteleport_origin
+align 4
+LABELV lastteleport_origin
+skip 12
+export g_spSkill
+align 4
+LABELV g_spSkill
+skip 272
+export bot_predictobstacles
+align 4
+LABELV bot_predictobstacles
+skip 272
+export botai_freewaypoints
+align 4
+LABELV botai_freewaypoints
+skip 4
+export botai_waypoints
+align 4
+LABELV botai_waypoints
+skip 12800
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotTeamAI
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+export ctf_blueflag
+align 4
+LABELV ctf_blueflag
+skip 56
+export ctf_redflag
+align 4
+LABELV ctf_redflag
+skip 56
+export bot_offhandgrapple
+align 4
+LABELV bot_offhandgrapple
+skip 272
+export bot_droppedweight
+align 4
+LABELV bot_droppedweight
+skip 272
+export bot_challenge
+align 4
+LABELV bot_challenge
+skip 272
+export bot_testrchat
+align 4
+LABELV bot_testrchat
+skip 272
+export bot_testichat
+align 4
+LABELV bot_testichat
+skip 272
+export bot_nochat
+align 4
+LABELV bot_nochat
+skip 272
+export bot_fastchat
+align 4
+LABELV bot_fastchat
+skip 272
+export bot_rocketjump
+align 4
+LABELV bot_rocketjump
+skip 272
+export bot_grapple
+align 4
+LABELV bot_grapple
+skip 272
+import maxplayers
+export gametype
+align 4
+LABELV gametype
+skip 4
+import SenseCarriesCubes
+import bot_reloadcharacters
+import bot_showteamgoals
+import bot_shownodechanges
+import bot_developer
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetPlayerState
+import BotAI_DebugLineShow
+import BotAI_DebugLineDelete
+import BotAI_DebugLineCreate
+import BotAI_InPVS
+import BotAI_PointContents
+import BotAI_EntityTrace
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotLibVarGetValue
+import BotNextEntity
+import BotSense
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotInitPhysicsSettings
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotRoutingAreaChanged
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotPrepareItemWeights
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotMatchTemplatesContainsString
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatchLinear
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import GetBotLibAPI
+import g_instagib
+import g_playerCapsule
+import g_proxMineTimeout
+import g_singlePlayer
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGamePlayers
+import g_maxplayers
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import trap_AAS_DropToFloor
+import trap_AAS_HorizontalVelocityForJump
+import trap_AAS_AgainstLadder
+import trap_AAS_JumpReachRunStart
+import trap_AAS_Swimming
+import trap_AAS_OnGround
+import trap_AAS_PredictPlayerMovement
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaTravelTime
+import trap_AAS_EnableRoutingArea
+import trap_AAS_RandomGoalArea
+import trap_AAS_ReachabilityFromNum
+import trap_AAS_NextAreaReachability
+import trap_AAS_AreaContentsTravelFlags
+import trap_AAS_TravelFlagForType
+import trap_AAS_AreaDoNotEnter
+import trap_AAS_AreaJumpPad
+import trap_AAS_AreaLadder
+import trap_AAS_AreaGrounded
+import trap_AAS_AreaSlime
+import trap_AAS_AreaLava
+import trap_AAS_AreaLiquid
+import trap_AAS_AreaSwim
+import trap_AAS_AreaCrouch
+import trap_AAS_AreaGroundFaceArea
+import trap_AAS_NextModelReachability
+import trap_AAS_BestReachableFromJumpPadArea
+import trap_AAS_BestReachableArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_TracePlayerBBox
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_FloodAreas
+import trap_AAS_ShowReachableAreas
+import trap_AAS_ShowReachability
+import trap_AAS_DrawArrow
+import trap_AAS_PrintTravelType
+import trap_AAS_DrawCross
+import trap_AAS_ShowAreaPolygons
+import trap_AAS_ShowArea
+import trap_AAS_ShowFace
+import trap_AAS_ShowBoundingBox
+import trap_AAS_DrawPlaneCross
+import trap_AAS_DrawPermanentCross
+import trap_AAS_PermanentLine
+import trap_AAS_DebugLine
+import trap_AAS_ClearShownPolygons
+import trap_AAS_ClearShownDebugLines
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_Loaded
+import trap_AAS_PointInsideArea
+import trap_AAS_BBoxReachabilityAreas
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_RegisterModel
+import trap_DebugPolygonDelete
+import trap_DebugPolygonShow
+import trap_DebugPolygonCreate
+import trap_ClientCommand
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_ClipToEntitiesCapsule
+import trap_ClipToEntities
+import trap_TraceCapsule
+import trap_Trace
+import trap_GetBrushBounds
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_SetConfigstringRestrictions
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommandEx
+import trap_DropPlayer
+import trap_SetNetFields
+import trap_LocateGameData
+import Pickup_Team
+import Svcmd_TeamInfoStats_f
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_BuildLocationTree
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotWeightBench_f
+import Svcmd_BotThinkReport_f
+import Svcmd_BotMatchBench_f
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownPlayer
+import BotAISetupPlayer
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import G_BotInitBotLib
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBotComplete
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunPlayer
+import PlayerEndFrame
+import PlayerThink
+import PlayerHandicap
+import ClientCommand
+import PlayerBegin
+import PlayerDisconnect
+import PlayerUserinfoChanged
+import PlayerConnect
+import G_Error
+import G_Printf
+import G_DPrintf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MovePlayerToIntermission
+import StringIsInteger
+import ConcatArgs
+import G_ScoreboardChanged
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import G_RegisterCommands
+import G_ConsoleCompleteArgument
+import G_ConsoleCommand
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import PlayerSpawn
+import InitBodyQue
+import BeginIntermission
+import PlayerRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetPlayerViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossPlayerCubes
+import TossPlayerGametypeItems
+import TossPlayerItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_SetBrushModel
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import trap_SendServerCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import FinishSpawningItem
+import G_SpawnItem
+import LaunchItem
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $2562
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $2561
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $2558
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $2557
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $2552
+byte 1 50
+byte 1 0
+align 1
+LABELV $2551
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $2550
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $2549
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 119
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $2548
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2547
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $2546
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $2545
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2544
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2543
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2542
+byte 1 48
+byte 1 0
+align 1
+LABELV $2541
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2540
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2539
+byte 1 49
+byte 1 0
+align 1
+LABELV $2538
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $2537
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2475
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 73
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2464
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2459
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $2395
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2392
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2371
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2368
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2321
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2314
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 10
+byte 1 0
+align 1
+LABELV $2313
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $2069
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2068
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2064
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 111
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $2052
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $2051
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $2048
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2037
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2024
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2018
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $2010
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1999
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1995
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1992
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1959
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1954
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $1949
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1946
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1943
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1942
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1930
+byte 1 42
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1747
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $1724
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1721
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $1715
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1619
+byte 1 109
+byte 1 112
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 0
+align 1
+LABELV $1618
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $1617
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 0
+align 1
+LABELV $1613
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1007
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 86
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $997
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 80
+byte 1 86
+byte 1 83
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $727
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $726
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $725
+byte 1 66
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $724
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $723
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $528
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 87
+byte 1 97
+byte 1 121
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $512
+byte 1 116
+byte 1 0
+align 1
+LABELV $334
+byte 1 93
+byte 1 0
+align 1
+LABELV $333
+byte 1 91
+byte 1 0
+align 1
+LABELV $332
+byte 1 32
+byte 1 0
+align 1
+LABELV $290
+byte 1 110
+byte 1 0
+align 1
+LABELV $289
+byte 1 91
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 93
+byte 1 0
+align 1
+LABELV $288
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $209
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $184
+byte 1 105
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $183
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $182
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $159
+byte 1 110
+byte 1 111
+byte 1 0
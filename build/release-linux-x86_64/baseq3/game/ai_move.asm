@@ -0,0 +1,20627 @@
+export BotMoveStateFromHandle
+code
+proc BotMoveStateFromHandle 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $65
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LEI4 $63
+LABELV $65
+CNSTI4 4
+ARGI4
+ADDRGP4 $66
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $62
+JUMPV
+LABELV $63
+CNSTI4 1560
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 botmovestates
+ADDP4
+RETP4
+LABELV $62
+endproc BotMoveStateFromHandle 4 12
+export BotInitMoveState
+proc BotInitMoveState 96 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotMoveStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $68
+ADDRGP4 $67
+JUMPV
+LABELV $68
+ADDRLP4 0
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+CNSTI4 24
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+CNSTI4 36
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 40
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 44
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 48
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 52
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $70
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $70
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 -33
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $72
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $72
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $74
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $74
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 -1025
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $76
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+LABELV $76
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 -2049
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $78
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+LABELV $78
+ADDRLP4 76
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 -65
+BANDI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 64
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $80
+ADDRLP4 84
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $80
+ADDRLP4 88
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $82
+ADDRLP4 92
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+LABELV $82
+LABELV $67
+endproc BotInitMoveState 96 4
+export BotAreaPresenceType
+proc BotAreaPresenceType 52 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 0+8
+INDIRI4
+RETI4
+LABELV $84
+endproc BotAreaPresenceType 52 8
+export AngleDiff
+proc AngleDiff 12 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $87
+ADDRLP4 0
+INDIRF4
+CNSTF4 1127481344
+LEF4 $88
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+ADDRGP4 $88
+JUMPV
+LABELV $87
+ADDRLP4 0
+INDIRF4
+CNSTF4 3274964992
+GEF4 $91
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $91
+LABELV $88
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $86
+endproc AngleDiff 12 0
+proc BotFuzzyTraceNearAreas 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+GEI4 $94
+CNSTI4 1
+RETI4
+ADDRGP4 $93
+JUMPV
+LABELV $94
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $99
+JUMPV
+LABELV $96
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $100
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $104
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $104
+ADDRGP4 $102
+JUMPV
+LABELV $104
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 16
+INDIRI4
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LEF4 $106
+ADDRLP4 16
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LEF4 $106
+ADDRGP4 $102
+JUMPV
+LABELV $106
+LABELV $101
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $100
+LABELV $102
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $108
+CNSTI4 1
+RETI4
+ADDRGP4 $93
+JUMPV
+LABELV $108
+LABELV $97
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $99
+ADDRLP4 4
+INDIRI4
+ADDRFP4 16
+INDIRI4
+LTI4 $96
+CNSTI4 0
+RETI4
+LABELV $93
+endproc BotFuzzyTraceNearAreas 24 0
+proc BotPlayerFuzzyPointReachabilityArea 1264 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $111
+ADDRFP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $111
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botpointareas
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1208
+ADDRGP4 trap_AAS_PointInsideArea
+CALLI4
+ASGNI4
+ADDRLP4 1208
+INDIRI4
+CNSTI4 0
+EQI4 $111
+ADDRLP4 1200
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botpointareas
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $112
+JUMPV
+LABELV $111
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1212
+ADDRGP4 trap_AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 1200
+ADDRLP4 1212
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $113
+ADDRFP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $113
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botpointareas
+ADDP4
+ADDRLP4 1200
+INDIRI4
+ASGNI4
+LABELV $113
+LABELV $112
+ADDRLP4 1200
+INDIRI4
+CNSTI4 0
+EQI4 $115
+ADDRLP4 56
+ADDRLP4 1200
+INDIRI4
+ASGNI4
+ADDRLP4 1200
+INDIRI4
+ARGI4
+ADDRLP4 1216
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 1216
+INDIRI4
+CNSTI4 0
+EQI4 $117
+ADDRLP4 1200
+INDIRI4
+RETI4
+ADDRGP4 $110
+JUMPV
+LABELV $117
+LABELV $115
+ADDRLP4 1216
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 1176
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 1216
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1176+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 1216
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1176+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1094713344
+SUBF4
+ASGNF4
+ADDRLP4 1224
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 1188
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 1224
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 1188+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 1224
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 1188+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+ASGNF4
+ADDRLP4 1176
+ARGP4
+ADDRLP4 1188
+ARGP4
+ADDRLP4 1048
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 1228
+ADDRGP4 trap_AAS_BBoxReachabilityAreas
+CALLI4
+ASGNI4
+ADDRLP4 220
+ADDRLP4 1228
+INDIRI4
+ASGNI4
+ADDRLP4 220
+INDIRI4
+CNSTI4 32
+LTI4 $123
+ADDRLP4 220
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $124
+JUMPV
+LABELV $123
+ADDRLP4 1232
+CNSTI4 0
+ASGNI4
+ADDRLP4 220
+INDIRI4
+ADDRLP4 1232
+INDIRI4
+NEI4 $125
+ADDRLP4 56
+INDIRI4
+ADDRLP4 1232
+INDIRI4
+EQI4 $125
+ADDRLP4 56
+INDIRI4
+RETI4
+ADDRGP4 $110
+JUMPV
+LABELV $125
+ADDRLP4 992
+CNSTI4 0
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $127
+ADDRLP4 992
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1048
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 996
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+CNSTI4 12
+ADDRLP4 992
+INDIRI4
+MULI4
+ADDRLP4 224
+ADDP4
+ADDRLP4 996+16
+INDIRB
+ASGNB 12
+CNSTI4 12
+ADDRLP4 992
+INDIRI4
+MULI4
+ADDRLP4 608
+ADDP4
+ADDRLP4 996+28
+INDIRB
+ASGNB 12
+LABELV $128
+ADDRLP4 992
+ADDRLP4 992
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $130
+ADDRLP4 992
+INDIRI4
+ADDRLP4 220
+INDIRI4
+LTI4 $127
+LABELV $124
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 192+8
+ADDRLP4 192+8
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRLP4 224
+ARGP4
+ADDRLP4 608
+ARGP4
+ADDRLP4 220
+INDIRI4
+ARGI4
+ADDRLP4 1232
+ADDRGP4 BotFuzzyTraceNearAreas
+CALLI4
+ASGNI4
+ADDRLP4 1232
+INDIRI4
+CNSTI4 0
+EQI4 $134
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 60
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 1236
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 1236
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $139
+JUMPV
+LABELV $136
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1240
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 1240
+INDIRI4
+CNSTI4 0
+EQI4 $140
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $110
+JUMPV
+LABELV $140
+LABELV $137
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $139
+ADDRLP4 0
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LTI4 $136
+LABELV $134
+ADDRLP4 188
+CNSTF4 1232348144
+ASGNF4
+ADDRLP4 208
+CNSTI4 0
+ASGNI4
+ADDRLP4 216
+CNSTI4 1
+ASGNI4
+LABELV $142
+ADDRLP4 212
+CNSTI4 1
+ASGNI4
+LABELV $146
+ADDRLP4 204
+CNSTI4 1
+ASGNI4
+LABELV $150
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 1236
+CNSTI4 3
+ASGNI4
+ADDRLP4 192
+ADDRLP4 192
+INDIRF4
+ADDRLP4 212
+INDIRI4
+ADDRLP4 1236
+INDIRI4
+LSHI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 192+4
+ADDRLP4 192+4
+INDIRF4
+ADDRLP4 204
+INDIRI4
+ADDRLP4 1236
+INDIRI4
+LSHI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 192+8
+ADDRLP4 192+8
+INDIRF4
+CNSTI4 12
+ADDRLP4 216
+INDIRI4
+MULI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $156
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRLP4 224
+ARGP4
+ADDRLP4 608
+ARGP4
+ADDRLP4 220
+INDIRI4
+ARGI4
+ADDRLP4 1240
+ADDRGP4 BotFuzzyTraceNearAreas
+CALLI4
+ASGNI4
+ADDRLP4 1240
+INDIRI4
+CNSTI4 0
+NEI4 $156
+ADDRGP4 $151
+JUMPV
+LABELV $156
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 60
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 1244
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 1244
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $161
+JUMPV
+LABELV $158
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1248
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 1248
+INDIRI4
+CNSTI4 0
+EQI4 $162
+ADDRLP4 1252
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1252
+INDIRI4
+ADDRLP4 60
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 1252
+INDIRI4
+ADDRLP4 60+4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 60+8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1260
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 1260
+INDIRF4
+ASGNF4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 188
+INDIRF4
+GEF4 $168
+ADDRLP4 208
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 188
+ADDRLP4 180
+INDIRF4
+ASGNF4
+LABELV $168
+LABELV $162
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $170
+ADDRLP4 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $170
+LABELV $159
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $161
+ADDRLP4 0
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LTI4 $158
+LABELV $151
+ADDRLP4 204
+ADDRLP4 204
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 -1
+GEI4 $150
+LABELV $147
+ADDRLP4 212
+ADDRLP4 212
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 -1
+GEI4 $146
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $172
+ADDRLP4 208
+INDIRI4
+RETI4
+ADDRGP4 $110
+JUMPV
+LABELV $172
+LABELV $143
+ADDRLP4 216
+ADDRLP4 216
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 -1
+GEI4 $142
+ADDRLP4 56
+INDIRI4
+RETI4
+LABELV $110
+endproc BotPlayerFuzzyPointReachabilityArea 1264 20
+export BotFuzzyPointReachabilityArea
+proc BotFuzzyPointReachabilityArea 4 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 0
+ADDRGP4 BotPlayerFuzzyPointReachabilityArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $174
+endproc BotFuzzyPointReachabilityArea 4 8
+lit
+align 4
+LABELV $176
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotReachabilityArea
+code
+proc BotReachabilityArea 272 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRGP4 $176
+INDIRB
+ASGNB 12
+CNSTI4 4
+ARGI4
+ADDRLP4 100
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 244
+CNSTF4 3225419776
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 76
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 76+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 3225419776
+ADDRLP4 76+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 12+4
+INDIRI4
+CNSTI4 0
+NEI4 $181
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $181
+ADDRLP4 12+56
+INDIRI4
+CNSTI4 4095
+EQI4 $181
+ADDRLP4 12+56
+INDIRI4
+CNSTI4 4094
+NEI4 $186
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 248
+ADDRGP4 BotPlayerFuzzyPointReachabilityArea
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+RETI4
+ADDRGP4 $175
+JUMPV
+LABELV $186
+ADDRLP4 132
+CNSTI4 720
+ADDRLP4 12+56
+INDIRI4
+MULI4
+ADDRGP4 g_entities+84+12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 modeltypes
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 248
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 1
+EQI4 $194
+ADDRLP4 248
+INDIRI4
+CNSTI4 2
+NEI4 $192
+LABELV $194
+CNSTI4 0
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 252
+ADDRGP4 trap_AAS_NextModelReachability
+CALLI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $195
+ADDRLP4 192
+INDIRI4
+ARGI4
+ADDRLP4 196
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRLP4 196
+INDIRI4
+RETI4
+ADDRGP4 $175
+JUMPV
+LABELV $195
+LABELV $192
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 252
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+EQI4 $197
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 256
+ADDRGP4 BotPlayerFuzzyPointReachabilityArea
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+RETI4
+ADDRGP4 $175
+JUMPV
+LABELV $197
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 256
+ADDRGP4 BotPlayerFuzzyPointReachabilityArea
+CALLI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+EQI4 $199
+ADDRLP4 260
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+EQI4 $199
+ADDRLP4 124
+INDIRI4
+RETI4
+ADDRGP4 $175
+JUMPV
+LABELV $199
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 88
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1145569280
+SUBF4
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 trap_AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $202
+ADDRLP4 88
+ADDRLP4 136+8
+INDIRB
+ASGNB 12
+LABELV $202
+ADDRLP4 88
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 BotPlayerFuzzyPointReachabilityArea
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+RETI4
+ADDRGP4 $175
+JUMPV
+LABELV $181
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 248
+ADDRGP4 BotPlayerFuzzyPointReachabilityArea
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+RETI4
+LABELV $175
+endproc BotReachabilityArea 272 28
+export BotBSPModelMinsMaxsOrigin
+proc BotBSPModelMinsMaxsOrigin 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $209
+JUMPV
+LABELV $206
+ADDRLP4 4
+CNSTI4 720
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level+4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $212
+ADDRLP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $214
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $216
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $216
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $218
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $218
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $220
+ADDRFP4 12
+INDIRP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $220
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $222
+ADDRFP4 16
+INDIRP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $222
+CNSTI4 1
+RETI4
+ADDRGP4 $205
+JUMPV
+LABELV $214
+LABELV $212
+LABELV $207
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $209
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $206
+CNSTI4 0
+RETI4
+LABELV $205
+endproc BotBSPModelMinsMaxsOrigin 8 0
+lit
+align 4
+LABELV $225
+byte 4 0
+byte 4 0
+byte 4 0
+align 4
+LABELV $226
+byte 4 3246391296
+byte 4 3246391296
+byte 4 3238002688
+align 4
+LABELV $227
+byte 4 1098907648
+byte 4 1098907648
+byte 4 1090519040
+export BotOnMover
+code
+proc BotOnMover 180 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 132
+ADDRGP4 $225
+INDIRB
+ASGNB 12
+ADDRLP4 144
+ADDRGP4 $226
+INDIRB
+ASGNB 12
+ADDRLP4 156
+ADDRGP4 $227
+INDIRB
+ASGNB 12
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotBSPModelMinsMaxsOrigin
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $228
+CNSTI4 1
+ARGI4
+ADDRGP4 $230
+ARGP4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $224
+JUMPV
+LABELV $228
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $231
+ADDRLP4 172
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 172
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ADDRLP4 172
+INDIRI4
+ADDRLP4 28
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+ADDF4
+LEF4 $235
+CNSTI4 0
+RETI4
+ADDRGP4 $224
+JUMPV
+LABELV $235
+ADDRLP4 176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 176
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ADDRLP4 176
+INDIRI4
+ADDRLP4 16
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+GEF4 $237
+CNSTI4 0
+RETI4
+ADDRGP4 $224
+JUMPV
+LABELV $237
+LABELV $232
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $231
+ADDRLP4 108
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 108+8
+ADDRLP4 108+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 120+8
+ADDRLP4 120+8
+INDIRF4
+CNSTF4 1111490560
+SUBF4
+ASGNF4
+ADDRLP4 40
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 156
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRLP4 40+4
+INDIRI4
+ADDRLP4 172
+INDIRI4
+NEI4 $241
+ADDRLP4 40
+INDIRI4
+ADDRLP4 172
+INDIRI4
+NEI4 $241
+ADDRLP4 40+56
+INDIRI4
+CNSTI4 4095
+EQI4 $244
+CNSTI4 720
+ADDRLP4 40+56
+INDIRI4
+MULI4
+ADDRGP4 g_entities+84+12
+ADDP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+NEI4 $244
+CNSTI4 1
+RETI4
+ADDRGP4 $224
+JUMPV
+LABELV $244
+LABELV $241
+CNSTI4 0
+RETI4
+LABELV $224
+endproc BotOnMover 180 28
+lit
+align 4
+LABELV $251
+byte 4 0
+byte 4 0
+byte 4 0
+export MoverDown
+code
+proc MoverDown 56 20
+ADDRLP4 28
+ADDRGP4 $251
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotBSPModelMinsMaxsOrigin
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $252
+CNSTI4 1
+ARGI4
+ADDRGP4 $230
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $250
+JUMPV
+LABELV $252
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+GEF4 $254
+CNSTI4 1
+RETI4
+ADDRGP4 $250
+JUMPV
+LABELV $254
+CNSTI4 0
+RETI4
+LABELV $250
+endproc MoverDown 56 20
+export BotSetBrushModelTypes
+proc BotSetBrushModelTypes 308 16
+ADDRGP4 modeltypes
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4096
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 264
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $262
+JUMPV
+LABELV $259
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $265
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 268
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+NEI4 $263
+ADDRGP4 $260
+JUMPV
+LABELV $263
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $268
+ARGP4
+ADDRLP4 136
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 272
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+NEI4 $266
+ADDRGP4 $260
+JUMPV
+LABELV $266
+ADDRLP4 136
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $269
+ADDRLP4 136+1
+ARGP4
+ADDRLP4 276
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRGP4 $270
+JUMPV
+LABELV $269
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $270
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $274
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+LTI4 $272
+LABELV $274
+CNSTI4 1
+ARGI4
+ADDRGP4 $275
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $260
+JUMPV
+LABELV $272
+ADDRLP4 8
+ARGP4
+ADDRGP4 $278
+ARGP4
+ADDRLP4 284
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+NEI4 $276
+ADDRLP4 288
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 288
+INDIRI4
+LSHI4
+ADDRGP4 modeltypes
+ADDP4
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRLP4 8
+ARGP4
+ADDRGP4 $281
+ARGP4
+ADDRLP4 292
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+NEI4 $279
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 modeltypes
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $280
+JUMPV
+LABELV $279
+ADDRLP4 8
+ARGP4
+ADDRGP4 $284
+ARGP4
+ADDRLP4 296
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+NEI4 $282
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 modeltypes
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $283
+JUMPV
+LABELV $282
+ADDRLP4 8
+ARGP4
+ADDRGP4 $287
+ARGP4
+ADDRLP4 300
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+NEI4 $285
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 modeltypes
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $286
+JUMPV
+LABELV $285
+ADDRLP4 8
+ARGP4
+ADDRGP4 $290
+ARGP4
+ADDRLP4 304
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+NEI4 $288
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 modeltypes
+ADDP4
+CNSTI4 5
+ASGNI4
+LABELV $288
+LABELV $286
+LABELV $283
+LABELV $280
+LABELV $277
+LABELV $260
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 268
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 268
+INDIRI4
+ASGNI4
+LABELV $262
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $259
+LABELV $258
+endproc BotSetBrushModelTypes 308 16
+lit
+align 4
+LABELV $292
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotOnTopOfEntity
+code
+proc BotOnTopOfEntity 124 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 $292
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 116
+CNSTF4 3225419776
+ASGNF4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRLP4 76
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+ADDRLP4 76+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 3225419776
+ADDRLP4 76+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+NEI4 $297
+ADDRLP4 0+56
+INDIRI4
+CNSTI4 4094
+EQI4 $297
+ADDRLP4 0+56
+INDIRI4
+CNSTI4 4095
+EQI4 $297
+ADDRLP4 0+56
+INDIRI4
+RETI4
+ADDRGP4 $291
+JUMPV
+LABELV $297
+CNSTI4 -1
+RETI4
+LABELV $291
+endproc BotOnTopOfEntity 124 28
+export BotValidTravel
+proc BotValidTravel 8 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 trap_AAS_TravelFlagForType
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+BCOMI4
+BANDI4
+CNSTI4 0
+EQI4 $304
+CNSTI4 0
+RETI4
+ADDRGP4 $303
+JUMPV
+LABELV $304
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_AAS_AreaContentsTravelFlags
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+BCOMI4
+BANDI4
+CNSTI4 0
+EQI4 $306
+CNSTI4 0
+RETI4
+ADDRGP4 $303
+JUMPV
+LABELV $306
+CNSTI4 1
+RETI4
+LABELV $303
+endproc BotValidTravel 8 4
+export BotAddToAvoidReach
+proc BotAddToAvoidReach 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $309
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $313
+ADDRLP4 4
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+LEF4 $315
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $316
+JUMPV
+LABELV $315
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $316
+ADDRLP4 12
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $308
+JUMPV
+LABELV $313
+LABELV $310
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $309
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $317
+ADDRLP4 4
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $321
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $308
+JUMPV
+LABELV $321
+LABELV $318
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $317
+LABELV $308
+endproc BotAddToAvoidReach 16 0
+export ProjectPointOntoVector
+proc ProjectPointOntoVector 68 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 56
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+CNSTI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 8
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $323
+endproc ProjectPointOntoVector 68 4
+export DistanceFromLineSquared
+proc DistanceFromLineSquared 96 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 ProjectPointOntoVector
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $343
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 28
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+LEF4 $350
+ADDRLP4 32
+INDIRF4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+GTF4 $349
+LABELV $350
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 36
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+GEF4 $347
+ADDRLP4 40
+INDIRF4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+GEF4 $347
+LABELV $349
+ADDRGP4 $345
+JUMPV
+LABELV $347
+LABELV $344
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $343
+LABELV $345
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+GEI4 $351
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 56
+INDIRF4
+GEF4 $353
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 4
+ASGNI4
+ADDRLP4 16+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 72
+CNSTI4 8
+ASGNI4
+ADDRLP4 16+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $354
+JUMPV
+LABELV $353
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 84
+CNSTI4 4
+ASGNI4
+ADDRLP4 16+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 88
+CNSTI4 8
+ASGNI4
+ADDRLP4 16+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $354
+ADDRLP4 16
+ARGP4
+ADDRLP4 92
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 92
+INDIRF4
+RETF4
+ADDRGP4 $342
+JUMPV
+LABELV $351
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 48
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+RETF4
+LABELV $342
+endproc DistanceFromLineSquared 96 16
+export VectorDistanceSquared
+proc VectorDistanceSquared 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+RETF4
+LABELV $363
+endproc VectorDistanceSquared 32 4
+export BotAvoidSpots
+proc BotAvoidSpots 68 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 16777215
+BANDI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 2
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $367
+ADDRLP4 20
+INDIRI4
+CNSTI4 19
+GTI4 $367
+ADDRLP4 20
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LSHI4
+ADDRGP4 $385-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $385
+address $370
+address $371
+address $372
+address $375
+address $373
+address $374
+address $376
+address $377
+address $378
+address $379
+address $381
+address $382
+address $380
+address $367
+address $367
+address $367
+address $383
+address $384
+code
+LABELV $370
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $371
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $372
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $373
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $374
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $375
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $376
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $377
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $378
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $379
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $380
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $381
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $382
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $383
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $384
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $367
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $368
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $390
+JUMPV
+LABELV $387
+ADDRLP4 36
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 12
+ASGNI4
+ADDRLP4 44
+ADDRLP4 36
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 44
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 DistanceFromLineSquared
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $391
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 VectorDistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 4
+INDIRF4
+LEF4 $391
+ADDRLP4 12
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $392
+JUMPV
+LABELV $391
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $393
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 DistanceFromLineSquared
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $394
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 VectorDistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 4
+INDIRF4
+LEF4 $394
+ADDRLP4 12
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $394
+JUMPV
+LABELV $393
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 VectorDistanceSquared
+CALLF4
+pop
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $397
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 VectorDistanceSquared
+CALLF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 4
+INDIRF4
+LEF4 $397
+ADDRLP4 12
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $397
+LABELV $394
+LABELV $392
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $399
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $366
+JUMPV
+LABELV $399
+LABELV $388
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $390
+ADDRLP4 0
+INDIRI4
+ADDRFP4 12
+INDIRI4
+LTI4 $387
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $366
+endproc BotAvoidSpots 68 12
+export BotAddAvoidSpot
+proc BotAddAvoidSpot 24 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotMoveStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $402
+ADDRGP4 $401
+JUMPV
+LABELV $402
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $404
+ADDRLP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $401
+JUMPV
+LABELV $404
+ADDRLP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $406
+ADDRGP4 $401
+JUMPV
+LABELV $406
+CNSTI4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+CNSTI4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+CNSTI4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+CNSTI4 16
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $401
+endproc BotAddAvoidSpot 24 4
+export BotGetReachabilityToGoal
+proc BotGetReachabilityToGoal 96 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRP4
+ASGNP4
+ADDRFP4 32
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 36
+ADDRFP4 36
+INDIRP4
+ASGNP4
+ADDRFP4 40
+ADDRFP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 44
+ADDRFP4 44
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $409
+CNSTI4 0
+RETI4
+ADDRGP4 $408
+JUMPV
+LABELV $409
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 trap_AAS_AreaDoNotEnter
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $413
+ADDRFP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 trap_AAS_AreaDoNotEnter
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $411
+LABELV $413
+ADDRFP4 32
+ADDRFP4 32
+INDIRI4
+CNSTI4 8388608
+BORI4
+ASGNI4
+LABELV $411
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 trap_AAS_NextAreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 $417
+JUMPV
+LABELV $414
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $418
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $420
+ADDRLP4 80
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ADDRFP4 16
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $424
+ADDRLP4 84
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 80
+INDIRI4
+ADDRFP4 20
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+LTF4 $424
+ADDRGP4 $422
+JUMPV
+LABELV $424
+LABELV $421
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $420
+LABELV $422
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $426
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 24
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 4
+LEI4 $426
+ADDRGP4 $415
+JUMPV
+LABELV $426
+LABELV $418
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRFP4 8
+INDIRI4
+ADDRFP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $428
+ADDRLP4 8
+INDIRI4
+ADDRFP4 12
+INDIRI4
+NEI4 $428
+ADDRGP4 $415
+JUMPV
+LABELV $428
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 BotValidTravel
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $430
+ADDRGP4 $415
+JUMPV
+LABELV $430
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8+24
+ARGP4
+ADDRFP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $433
+ADDRGP4 $415
+JUMPV
+LABELV $433
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRFP4 40
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 BotAvoidSpots
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $435
+ADDRFP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $415
+ADDRFP4 44
+INDIRP4
+ADDRFP4 44
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+ADDRGP4 $415
+JUMPV
+LABELV $435
+ADDRLP4 52
+ADDRLP4 52
+INDIRI4
+ADDRLP4 8+40
+INDIRU2
+CVUI4 2
+ADDI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $442
+ADDRLP4 52
+INDIRI4
+ADDRLP4 56
+INDIRI4
+GEI4 $440
+LABELV $442
+ADDRLP4 56
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $440
+LABELV $415
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 trap_AAS_NextAreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+LABELV $417
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $414
+ADDRLP4 60
+INDIRI4
+RETI4
+LABELV $408
+endproc BotGetReachabilityToGoal 96 16
+export BotContinueCorridor
+proc BotContinueCorridor 80 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $444
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 4
+SUBI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1048
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $448
+ADDRGP4 $446
+JUMPV
+LABELV $448
+ADDRLP4 48
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 4
+SUBI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 60
+CNSTP4 0
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotGetReachabilityToGoal
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $451
+ADDRGP4 $446
+JUMPV
+LABELV $451
+ADDRFP4 4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+GEI4 $453
+ADDRLP4 72
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $453
+ADDRLP4 72
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1304
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $453
+ADDRLP4 72
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1048
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $453
+ADDRGP4 $443
+JUMPV
+LABELV $453
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1048
+ADDP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1304
+ADDP4
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $445
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $447
+ADDRFP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $444
+LABELV $446
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+LABELV $443
+endproc BotContinueCorridor 80 48
+export BotCorridorValid
+proc BotCorridorValid 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $457
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $457
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+NEI4 $457
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+INDIRI4
+ADDRGP4 botcorridorrouting
+INDIRI4
+NEI4 $457
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $458
+JUMPV
+LABELV $457
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $458
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $455
+endproc BotCorridorValid 8 0
+export BotCorridorReachability
+proc BotCorridorReachability 76 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 BotCorridorValid
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $460
+CNSTI4 0
+RETI4
+ADDRGP4 $459
+JUMPV
+LABELV $460
+ADDRFP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $462
+CNSTI4 0
+RETI4
+ADDRGP4 $459
+JUMPV
+LABELV $462
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $467
+JUMPV
+LABELV $464
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+NEI4 $468
+ADDRGP4 $466
+JUMPV
+LABELV $468
+LABELV $465
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $467
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+LTI4 $464
+LABELV $466
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+LTI4 $470
+CNSTI4 0
+RETI4
+ADDRGP4 $459
+JUMPV
+LABELV $470
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $473
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $474
+JUMPV
+LABELV $473
+ADDRLP4 60
+CNSTI4 -1
+ASGNI4
+LABELV $474
+ADDRLP4 8
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1304
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $475
+CNSTI4 0
+RETI4
+ADDRGP4 $459
+JUMPV
+LABELV $475
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1048
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $477
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $481
+ADDRLP4 72
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 64
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+LTF4 $481
+ADDRGP4 $479
+JUMPV
+LABELV $481
+LABELV $478
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $477
+LABELV $479
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $483
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 4
+LEI4 $483
+CNSTI4 0
+RETI4
+ADDRGP4 $459
+JUMPV
+LABELV $483
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 BotValidTravel
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $485
+CNSTI4 0
+RETI4
+ADDRGP4 $459
+JUMPV
+LABELV $485
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $459
+endproc BotCorridorReachability 76 12
+export BotRepairCorridor
+proc BotRepairCorridor 84 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $490
+ADDRFP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $488
+LABELV $490
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $487
+JUMPV
+LABELV $488
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 BotCorridorValid
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $491
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $496
+JUMPV
+LABELV $493
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $497
+ADDRGP4 $495
+JUMPV
+LABELV $497
+LABELV $494
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $496
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+LTI4 $493
+LABELV $495
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+GEI4 $499
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 63
+LEI4 $501
+ADDRLP4 48
+CNSTI4 63
+ASGNI4
+LABELV $501
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+ARGP4
+ADDRLP4 64
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 48
+INDIRI4
+CVIU4 4
+ADDRLP4 64
+INDIRI4
+LSHU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+ARGP4
+ADDRLP4 72
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1048
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 48
+INDIRI4
+CVIU4 4
+ADDRLP4 72
+INDIRI4
+LSHU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1308
+ADDP4
+ARGP4
+ADDRLP4 80
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1304
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 48
+INDIRI4
+CVIU4 4
+ADDRLP4 80
+INDIRI4
+LSHU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $499
+LABELV $491
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ADDRGP4 botcorridorrouting
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 792
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1048
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $504
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $505
+JUMPV
+LABELV $504
+ADDRLP4 64
+CNSTI4 -1
+ASGNI4
+LABELV $505
+ADDRFP4 0
+INDIRP4
+CNSTI4 1304
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 BotContinueCorridor
+CALLV
+pop
+LABELV $487
+endproc BotRepairCorridor 84 16
+export BotRoutingAreaChanged
+proc BotRoutingAreaChanged 60 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $507
+ADDRLP4 12
+ADDRGP4 botcorridorrouting
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $506
+JUMPV
+LABELV $507
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $509
+ADDRLP4 4
+CNSTI4 1560
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 botmovestates
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $516
+JUMPV
+LABELV $513
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 792
+ADDP4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $517
+ADDRGP4 $515
+JUMPV
+LABELV $517
+LABELV $514
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $516
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+LTI4 $513
+LABELV $515
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+GEI4 $519
+ADDRLP4 4
+INDIRP4
+CNSTI4 784
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $510
+JUMPV
+LABELV $519
+ADDRLP4 4
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $521
+ADDRLP4 4
+INDIRP4
+CNSTI4 784
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $510
+JUMPV
+LABELV $521
+ADDRLP4 4
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $523
+ADDRLP4 4
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 4
+SUBI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1048
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $525
+ADDRLP4 4
+INDIRP4
+CNSTI4 784
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $525
+LABELV $523
+LABELV $510
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LEI4 $509
+LABELV $506
+endproc BotRoutingAreaChanged 60 8
+export BotAddToTarget
+proc BotAddToTarget 44 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRFP4 8
+INDIRF4
+GEF4 $530
+ADDRFP4 16
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 12
+INDIRP4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $527
+JUMPV
+LABELV $530
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 8
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $527
+endproc BotAddToTarget 44 4
+export BotMovementViewTarget
+proc BotMovementViewTarget 96 48
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 BotMoveStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $535
+CNSTI4 0
+RETI4
+ADDRGP4 $534
+JUMPV
+LABELV $535
+ADDRLP4 44
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $539
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $537
+LABELV $539
+CNSTI4 0
+RETI4
+ADDRGP4 $534
+JUMPV
+LABELV $537
+ADDRLP4 48
+ADDRLP4 44
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 44
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 52
+ADDRLP4 44
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+ADDRGP4 $541
+JUMPV
+LABELV $540
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRLP4 60
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 BotAddToTarget
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+EQI4 $543
+CNSTI4 1
+RETI4
+ADDRGP4 $534
+JUMPV
+LABELV $543
+ADDRLP4 0+36
+INDIRI4
+CNSTI4 16777215
+BANDI4
+CNSTI4 10
+NEI4 $546
+CNSTI4 1
+RETI4
+ADDRGP4 $534
+JUMPV
+LABELV $546
+ADDRLP4 0+36
+INDIRI4
+CNSTI4 16777215
+BANDI4
+CNSTI4 12
+NEI4 $549
+CNSTI4 1
+RETI4
+ADDRGP4 $534
+JUMPV
+LABELV $549
+ADDRLP4 0+36
+INDIRI4
+CNSTI4 16777215
+BANDI4
+CNSTI4 13
+NEI4 $552
+CNSTI4 1
+RETI4
+ADDRGP4 $534
+JUMPV
+LABELV $552
+ADDRLP4 84
+CNSTI4 16777215
+ASGNI4
+ADDRLP4 0+36
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BANDI4
+CNSTI4 18
+EQI4 $555
+ADDRLP4 0+36
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BANDI4
+CNSTI4 11
+EQI4 $555
+ADDRLP4 0+36
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BANDI4
+CNSTI4 19
+EQI4 $555
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 BotAddToTarget
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $560
+CNSTI4 1
+RETI4
+ADDRGP4 $534
+JUMPV
+LABELV $560
+LABELV $555
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 120
+ADDP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 92
+ADDRGP4 BotGetReachabilityToGoal
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $566
+ADDRLP4 0+24
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 BotAddToTarget
+CALLI4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $534
+JUMPV
+LABELV $566
+LABELV $541
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $569
+ADDRLP4 56
+INDIRF4
+ADDRFP4 12
+INDIRF4
+LTF4 $540
+LABELV $569
+CNSTI4 0
+RETI4
+LABELV $534
+endproc BotMovementViewTarget 96 48
+export BotVisible
+proc BotVisible 68 28
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 64
+CNSTP4 0
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $571
+CNSTI4 1
+RETI4
+ADDRGP4 $570
+JUMPV
+LABELV $571
+CNSTI4 0
+RETI4
+LABELV $570
+endproc BotVisible 68 28
+export BotPredictVisiblePosition
+proc BotPredictVisiblePosition 104 48
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $575
+CNSTI4 0
+RETI4
+ADDRGP4 $574
+JUMPV
+LABELV $575
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $577
+CNSTI4 0
+RETI4
+ADDRGP4 $574
+JUMPV
+LABELV $577
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $579
+CNSTI4 0
+RETI4
+ADDRGP4 $574
+JUMPV
+LABELV $579
+ADDRLP4 72
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 68
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 $584
+JUMPV
+LABELV $581
+ADDRLP4 56
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 84
+ADDRGP4 BotGetReachabilityToGoal
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $585
+CNSTI4 0
+RETI4
+ADDRGP4 $574
+JUMPV
+LABELV $585
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 92
+ADDRGP4 BotVisible
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+EQI4 $587
+ADDRFP4 16
+INDIRP4
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+CNSTI4 1
+RETI4
+ADDRGP4 $574
+JUMPV
+LABELV $587
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 100
+ADDRGP4 BotVisible
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+EQI4 $591
+ADDRFP4 16
+INDIRP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+CNSTI4 1
+RETI4
+ADDRGP4 $574
+JUMPV
+LABELV $591
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $595
+ADDRFP4 16
+INDIRP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+CNSTI4 1
+RETI4
+ADDRGP4 $574
+JUMPV
+LABELV $595
+ADDRLP4 48
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+LABELV $582
+ADDRLP4 52
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $584
+ADDRLP4 52
+INDIRI4
+CNSTI4 20
+GEI4 $599
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $581
+LABELV $599
+CNSTI4 0
+RETI4
+LABELV $574
+endproc BotPredictVisiblePosition 104 48
+export MoverBottomCenter
+proc MoverBottomCenter 68 20
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotBSPModelMinsMaxsOrigin
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $601
+CNSTI4 1
+ARGI4
+ADDRGP4 $230
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $600
+JUMPV
+LABELV $601
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 36+4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 36+8
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $600
+endproc MoverBottomCenter 68 20
+export BotGapDistance
+proc BotGapDistance 112 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 trap_AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 28+4
+INDIRF4
+CNSTF4 1065353216
+LTF4 $615
+CNSTF4 1065353216
+RETF4
+ADDRGP4 $613
+JUMPV
+LABELV $615
+ADDRLP4 84
+ADDRLP4 28+8+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+LABELV $620
+ADDRLP4 96
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 100
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 104
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 84
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+ADDRGP4 phys_maxbarrier
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 trap_AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $628
+ADDRLP4 28+8+8
+INDIRF4
+ADDRLP4 84
+INDIRF4
+CNSTF4 1099956224
+SUBF4
+CNSTF4 1090519040
+SUBF4
+GEF4 $630
+ADDRLP4 16
+ADDRLP4 28+8
+INDIRB
+ASGNB 12
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 108
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $636
+ADDRGP4 $622
+JUMPV
+LABELV $636
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $613
+JUMPV
+LABELV $630
+ADDRLP4 84
+ADDRLP4 28+8+8
+INDIRF4
+ASGNF4
+LABELV $628
+LABELV $621
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 100
+LEI4 $620
+LABELV $622
+CNSTF4 0
+RETF4
+LABELV $613
+endproc BotGapDistance 112 24
+export BotCheckBarrierCrouch
+proc BotCheckBarrierCrouch 112 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 88
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 92
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 92
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 92
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 trap_AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $647
+CNSTI4 0
+RETI4
+ADDRGP4 $640
+JUMPV
+LABELV $647
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1065353216
+LTF4 $649
+CNSTI4 0
+RETI4
+ADDRGP4 $640
+JUMPV
+LABELV $649
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 trap_AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $652
+CNSTI4 0
+RETI4
+ADDRGP4 $640
+JUMPV
+LABELV $652
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $654
+CNSTI4 0
+RETI4
+ADDRGP4 $640
+JUMPV
+LABELV $654
+CNSTI4 1
+RETI4
+LABELV $640
+endproc BotCheckBarrierCrouch 112 24
+export BotCheckBarrierJump
+proc BotCheckBarrierJump 124 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 56+8
+ADDRLP4 56+8
+INDIRF4
+ADDRGP4 phys_maxbarrier
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 trap_AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $659
+CNSTI4 0
+RETI4
+ADDRGP4 $657
+JUMPV
+LABELV $659
+ADDRLP4 0+8+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1099956224
+GEF4 $661
+CNSTI4 0
+RETI4
+ADDRGP4 $657
+JUMPV
+LABELV $661
+ADDRLP4 96
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 96
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 96
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 68+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 68
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 104
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 108
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 104
+INDIRF4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 68+4
+INDIRF4
+ADDRLP4 104
+INDIRF4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 68+8
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 0+8
+INDIRB
+ASGNB 12
+ADDRLP4 56+8
+ADDRLP4 0+8+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 trap_AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $675
+CNSTI4 0
+RETI4
+ADDRGP4 $657
+JUMPV
+LABELV $675
+ADDRLP4 80
+ADDRLP4 0+8
+INDIRB
+ASGNB 12
+ADDRLP4 56
+ADDRLP4 0+8
+INDIRB
+ASGNB 12
+ADDRLP4 56+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 trap_AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $680
+CNSTI4 0
+RETI4
+ADDRGP4 $657
+JUMPV
+LABELV $680
+ADDRLP4 0+4
+INDIRF4
+CNSTF4 1065353216
+LTF4 $682
+CNSTI4 0
+RETI4
+ADDRGP4 $657
+JUMPV
+LABELV $682
+ADDRLP4 0+8+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1099956224
+GEF4 $685
+CNSTI4 0
+RETI4
+ADDRGP4 $657
+JUMPV
+LABELV $685
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $689
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Jump
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $689
+CNSTI4 1
+RETI4
+LABELV $657
+endproc BotCheckBarrierJump 124 24
+export BotCheckRunToGoal
+proc BotCheckRunToGoal 40 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+NEI4 $692
+CNSTI4 1
+RETI4
+ADDRGP4 $691
+JUMPV
+LABELV $692
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+NEI4 $694
+CNSTI4 0
+RETI4
+ADDRGP4 $691
+JUMPV
+LABELV $694
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 20
+INDIRI4
+EQI4 $698
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 20
+INDIRI4
+EQI4 $696
+LABELV $698
+CNSTI4 0
+RETI4
+ADDRGP4 $691
+JUMPV
+LABELV $696
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $700
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $701
+JUMPV
+LABELV $700
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+LABELV $701
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1132462080
+LTF4 $704
+CNSTI4 0
+RETI4
+ADDRGP4 $691
+JUMPV
+LABELV $704
+CNSTI4 1
+RETI4
+LABELV $691
+endproc BotCheckRunToGoal 40 4
+export BotSwimInDirection
+proc BotSwimInDirection 12 12
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $706
+endproc BotSwimInDirection 12 12
+export BotWalkInDirection
+proc BotWalkInDirection 244 56
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRLP4 196
+ADDRGP4 trap_AAS_OnGround
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $708
+ADDRLP4 200
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ADDRLP4 200
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $708
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $710
+ADDRLP4 200
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ADDRLP4 200
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 204
+ADDRGP4 BotCheckBarrierJump
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+EQI4 $712
+ADDRFP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 128
+CNSTI4 1
+ASGNI4
+ADDRGP4 $713
+JUMPV
+LABELV $712
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 BotCheckBarrierCrouch
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $714
+ADDRFP4 12
+CNSTI4 2
+ASGNI4
+LABELV $714
+LABELV $713
+ADDRLP4 212
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 212
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 212
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 12
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $718
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 220
+ADDRGP4 BotGapDistance
+CALLF4
+ASGNF4
+ADDRLP4 220
+INDIRF4
+CNSTF4 0
+LEF4 $720
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $720
+LABELV $718
+ADDRLP4 220
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 220
+INDIRI4
+EQI4 $722
+ADDRFP4 12
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 220
+INDIRI4
+NEI4 $722
+ADDRLP4 156
+CNSTI4 4
+ASGNI4
+ADDRGP4 $723
+JUMPV
+LABELV $722
+ADDRLP4 156
+CNSTI4 2
+ASGNI4
+LABELV $723
+ADDRLP4 116
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 116+4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 116+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 12
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $728
+ADDRLP4 116+8
+CNSTF4 1137180672
+ASGNF4
+ADDRLP4 160
+CNSTI4 30
+ASGNI4
+ADDRLP4 176
+CNSTI4 1
+ASGNI4
+ADDRLP4 180
+CNSTI4 61
+ASGNI4
+ADDRGP4 $729
+JUMPV
+LABELV $728
+ADDRFP4 12
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $731
+ADDRLP4 116+8
+CNSTF4 3284664320
+ASGNF4
+LABELV $731
+ADDRLP4 228
+CNSTI4 2
+ASGNI4
+ADDRLP4 160
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRLP4 180
+CNSTI4 124
+ASGNI4
+LABELV $729
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 144+8
+ADDRLP4 144+8
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 144
+ARGP4
+ADDRLP4 156
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 164
+ARGP4
+ADDRLP4 116
+ARGP4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRLP4 160
+INDIRI4
+ARGI4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRLP4 228
+CNSTI4 0
+ASGNI4
+ADDRLP4 228
+INDIRI4
+ARGI4
+ADDRLP4 228
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRLP4 232
+ADDRGP4 trap_AAS_PredictPlayerMovement
+CALLI4
+ASGNI4
+ADDRLP4 188
+ADDRLP4 232
+INDIRI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $735
+CNSTI4 0
+RETI4
+ADDRGP4 $707
+JUMPV
+LABELV $735
+ADDRLP4 12+100
+INDIRI4
+ADDRLP4 160
+INDIRI4
+LTI4 $737
+ADDRFP4 12
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $737
+CNSTI4 0
+RETI4
+ADDRGP4 $707
+JUMPV
+LABELV $737
+ADDRLP4 12+88
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $740
+CNSTI4 0
+RETI4
+ADDRGP4 $707
+JUMPV
+LABELV $740
+ADDRLP4 12+88
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $743
+CNSTI4 0
+RETI4
+ADDRGP4 $707
+JUMPV
+LABELV $743
+ADDRLP4 12+88
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $746
+ADDRLP4 12+16
+ARGP4
+ADDRLP4 132
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 132
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 236
+ADDRGP4 BotGapDistance
+CALLF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 236
+INDIRF4
+ASGNF4
+ADDRLP4 184
+INDIRF4
+CNSTF4 0
+LEF4 $750
+CNSTI4 0
+RETI4
+ADDRGP4 $707
+JUMPV
+LABELV $750
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 240
+ADDRGP4 BotGapDistance
+CALLF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 240
+INDIRF4
+ASGNF4
+ADDRLP4 184
+INDIRF4
+CNSTF4 0
+LEF4 $752
+CNSTI4 0
+RETI4
+ADDRGP4 $707
+JUMPV
+LABELV $752
+LABELV $746
+ADDRFP4 12
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $754
+ADDRLP4 132
+ADDRLP4 12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+4
+ADDRLP4 12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 132+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 132
+ARGP4
+ADDRLP4 240
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 240
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+MULF4
+MULF4
+GEF4 $759
+CNSTI4 0
+RETI4
+ADDRGP4 $707
+JUMPV
+LABELV $759
+LABELV $754
+ADDRFP4 12
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $761
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Jump
+CALLV
+pop
+LABELV $761
+ADDRFP4 12
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $763
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Crouch
+CALLV
+pop
+LABELV $763
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ADDRLP4 236
+INDIRP4
+INDIRI4
+ADDRLP4 128
+INDIRI4
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $707
+JUMPV
+LABELV $710
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $765
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+CNSTF4 1112014848
+GEF4 $767
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+LABELV $767
+LABELV $765
+CNSTI4 1
+RETI4
+LABELV $707
+endproc BotWalkInDirection 244 56
+lit
+align 4
+LABELV $770
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotCheckBlocked
+code
+proc BotCheckBlocked 180 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 $770
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 76
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 76+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 76+8
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 120
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 120
+INDIRF4
+CNSTF4 1060320051
+GEF4 $771
+ADDRLP4 88+8
+ADDRLP4 88+8
+INDIRF4
+CNSTF4 1099956224
+ADDF4
+ASGNF4
+LABELV $771
+ADDRLP4 128
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 136
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+CNSTF4 1077936128
+ADDRFP4 4
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33619969
+ARGI4
+ADDRGP4 trap_ClipToEntities
+CALLV
+pop
+ADDRLP4 12+4
+INDIRI4
+CNSTI4 0
+NEI4 $778
+ADDRLP4 12+56
+INDIRI4
+CNSTI4 4095
+EQI4 $778
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 12+56
+INDIRI4
+ASGNI4
+ADDRGP4 $779
+JUMPV
+LABELV $778
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $783
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $783
+ADDRLP4 156
+CNSTF4 3225419776
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 76
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 76+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 3225419776
+ADDRLP4 76+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 trap_ClipToEntities
+CALLV
+pop
+ADDRLP4 12+4
+INDIRI4
+CNSTI4 0
+NEI4 $784
+ADDRLP4 12+56
+INDIRI4
+CNSTI4 4095
+EQI4 $784
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 12+56
+INDIRI4
+ASGNI4
+ADDRLP4 164
+ADDRFP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 164
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRGP4 $784
+JUMPV
+LABELV $783
+ADDRLP4 160
+CNSTI4 4
+ASGNI4
+ADDRLP4 164
+ADDRFP4 4
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 164
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168
+ADDRLP4 112
+INDIRF4
+CNSTF4 1077936128
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 168
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 164
+INDIRP4
+INDIRF4
+ADDRLP4 168
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 172
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+CNSTF4 1077936128
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33619969
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 12+4
+INDIRI4
+CNSTI4 0
+NEI4 $796
+ADDRLP4 12+56
+INDIRI4
+CNSTI4 4095
+EQI4 $796
+ADDRLP4 12+56
+INDIRI4
+CNSTI4 4094
+EQI4 $796
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 12+56
+INDIRI4
+ASGNI4
+LABELV $796
+LABELV $784
+LABELV $779
+LABELV $769
+endproc BotCheckBlocked 180 28
+export BotMoveInDirection
+proc BotMoveInDirection 112 16
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 BotMoveStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $803
+CNSTI4 0
+RETI4
+ADDRGP4 $802
+JUMPV
+LABELV $803
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $805
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 BotSwimInDirection
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $806
+JUMPV
+LABELV $805
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 BotWalkInDirection
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $806
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $807
+ADDRLP4 16
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 52
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+ARGP4
+ADDRGP4 EA_GetInput
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68+4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRLP4 16+8
+INDIRI4
+CNSTI4 0
+EQI4 $810
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $810
+LABELV $807
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $802
+endproc BotMoveInDirection 112 16
+lit
+align 4
+LABELV $815
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotTravel_Walk
+code
+proc BotTravel_Walk 100 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 $815
+INDIRB
+ASGNB 52
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 80
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1092616192
+GEF4 $818
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 92
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 92
+INDIRF4
+ASGNF4
+LABELV $818
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 BotAreaPresenceType
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $822
+ADDRLP4 12
+INDIRF4
+CNSTF4 1101004800
+GEF4 $824
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Crouch
+CALLV
+pop
+LABELV $824
+LABELV $822
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 BotGapDistance
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 BotCheckRunToGoal
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+NEI4 $826
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+LEF4 $828
+ADDRLP4 68
+CNSTF4 1128792064
+CNSTF4 1127481344
+CNSTF4 1065353216
+ADDRLP4 12
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRGP4 $827
+JUMPV
+LABELV $828
+ADDRLP4 68
+CNSTF4 1128792064
+ASGNF4
+ADDRGP4 $827
+JUMPV
+LABELV $826
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+LEF4 $830
+ADDRLP4 68
+CNSTF4 1137180672
+CNSTF4 1135869952
+CNSTF4 1073741824
+ADDRLP4 12
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRGP4 $831
+JUMPV
+LABELV $830
+ADDRLP4 68
+CNSTF4 1137180672
+ASGNF4
+LABELV $831
+LABELV $827
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRLP4 16+28
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRB
+ASGNB 52
+LABELV $813
+endproc BotTravel_Walk 100 16
+lit
+align 4
+LABELV $835
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotTravel_Crouch
+code
+proc BotTravel_Crouch 76 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 $835
+INDIRB
+ASGNB 52
+ADDRLP4 64
+CNSTF4 1137180672
+ASGNF4
+ADDRLP4 68
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 68
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Crouch
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRLP4 12+28
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+LABELV $833
+endproc BotTravel_Crouch 76 16
+lit
+align 4
+LABELV $841
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotTravel_BarrierJump
+code
+proc BotTravel_BarrierJump 88 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 $841
+INDIRB
+ASGNB 52
+ADDRLP4 72
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 72
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 80
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRLP4 64
+INDIRF4
+CNSTF4 1091567616
+GEF4 $844
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Jump
+CALLV
+pop
+ADDRGP4 $845
+JUMPV
+LABELV $844
+ADDRLP4 64
+INDIRF4
+CNSTF4 1114636288
+LEF4 $846
+ADDRLP4 64
+CNSTF4 1114636288
+ASGNF4
+LABELV $846
+ADDRLP4 84
+CNSTF4 1135869952
+ASGNF4
+ADDRLP4 68
+ADDRLP4 84
+INDIRF4
+ADDRLP4 84
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 64
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+LABELV $845
+ADDRLP4 12+28
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+LABELV $839
+endproc BotTravel_BarrierJump 88 16
+lit
+align 4
+LABELV $851
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotFinishTravel_BarrierJump
+code
+proc BotFinishTravel_BarrierJump 72 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 $851
+INDIRB
+ASGNB 52
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+CNSTF4 1132068864
+GEF4 $852
+ADDRLP4 64
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 64
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 64
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRLP4 12+28
+ADDRLP4 0
+INDIRB
+ASGNB 12
+LABELV $852
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+LABELV $849
+endproc BotFinishTravel_BarrierJump 72 16
+lit
+align 4
+LABELV $859
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotTravel_Swim
+code
+proc BotTravel_Swim 72 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 $859
+INDIRB
+ASGNB 52
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRLP4 12+28
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRLP4 12+40
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 12+20
+ADDRLP4 12+20
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+LABELV $857
+endproc BotTravel_Swim 72 16
+lit
+align 4
+LABELV $867
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotTravel_WaterJump
+code
+proc BotTravel_WaterJump 96 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 $867
+INDIRB
+ASGNB 52
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 64+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 88
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1109393408
+CNSTF4 1073741824
+ADDRLP4 88
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1097859072
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 64
+ARGP4
+ADDRLP4 92
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_MoveForward
+CALLV
+pop
+ADDRLP4 76
+INDIRF4
+CNSTF4 1109393408
+GEF4 $872
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_MoveUp
+CALLV
+pop
+LABELV $872
+ADDRLP4 0
+ARGP4
+ADDRLP4 12+40
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 12+20
+ADDRLP4 12+20
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRLP4 12+28
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+LABELV $865
+endproc BotTravel_WaterJump 96 8
+lit
+align 4
+LABELV $879
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotFinishTravel_WaterJump
+code
+proc BotFinishTravel_WaterJump 100 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 $879
+INDIRB
+ASGNB 52
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $880
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+ADDRGP4 $877
+JUMPV
+LABELV $880
+ADDRLP4 64
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 64+8
+ADDRLP4 64+8
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 64
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $883
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+ADDRGP4 $877
+JUMPV
+LABELV $883
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 88
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 88
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 92
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 92
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 96
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1116471296
+ADDF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 12+40
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 12+20
+ADDRLP4 12+20
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRLP4 12+28
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+LABELV $877
+endproc BotFinishTravel_WaterJump 100 12
+lit
+align 4
+LABELV $894
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotTravel_WalkOffLedge
+code
+proc BotTravel_WalkOffLedge 136 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRGP4 $894
+INDIRB
+ASGNB 52
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 104
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 116
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+CNSTF4 1111490560
+GEF4 $902
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 84
+INDIRF4
+CNSTF4 1101004800
+GEF4 $906
+ADDRLP4 80
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 $903
+JUMPV
+LABELV $906
+CNSTF4 0
+ARGF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_AAS_HorizontalVelocityForJump
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $903
+ADDRLP4 80
+CNSTF4 1137180672
+ASGNF4
+ADDRGP4 $903
+JUMPV
+LABELV $902
+ADDRLP4 84
+INDIRF4
+CNSTF4 1101004800
+GEF4 $910
+ADDRLP4 76
+INDIRF4
+CNSTF4 1115684864
+LEF4 $912
+ADDRLP4 76
+CNSTF4 1115684864
+ASGNF4
+LABELV $912
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 BotCheckRunToGoal
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $914
+ADDRLP4 80
+CNSTF4 1128792064
+CNSTF4 1124073472
+CNSTF4 1073741824
+ADDRLP4 76
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRGP4 $911
+JUMPV
+LABELV $914
+ADDRLP4 80
+CNSTF4 1137180672
+CNSTF4 1132462080
+CNSTF4 1082130432
+ADDRLP4 76
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRGP4 $911
+JUMPV
+LABELV $910
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 BotCheckRunToGoal
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $916
+ADDRLP4 80
+CNSTF4 1128792064
+ASGNF4
+ADDRGP4 $917
+JUMPV
+LABELV $916
+ADDRLP4 80
+CNSTF4 1137180672
+ASGNF4
+LABELV $917
+LABELV $911
+LABELV $903
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRLP4 24+28
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRB
+ASGNB 52
+LABELV $892
+endproc BotTravel_WalkOffLedge 136 16
+export BotAirControl
+proc BotAirControl 60 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+CNSTF4 1036831949
+ASGNF4
+ADDRLP4 0
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1036831949
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $922
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1008981770
+ADDRGP4 g_gravity+8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 0
+GEF4 $928
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+GEF4 $928
+ADDRLP4 40
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+SUBF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+SUBF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+SUBF4
+ADDRLP4 0+8
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 8
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1107296256
+LEF4 $951
+ADDRLP4 28
+CNSTF4 1107296256
+ASGNF4
+LABELV $951
+ADDRLP4 56
+CNSTF4 1137180672
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1095761920
+ADDRLP4 28
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $919
+JUMPV
+LABELV $928
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $923
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 50
+LTI4 $922
+ADDRFP4 12
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTF4 1137180672
+ASGNF4
+CNSTI4 0
+RETI4
+LABELV $919
+endproc BotAirControl 60 4
+lit
+align 4
+LABELV $961
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotFinishTravel_WalkOffLedge
+code
+proc BotFinishTravel_WalkOffLedge 144 20
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRGP4 $961
+INDIRB
+ASGNB 52
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 124
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 104
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 104
+INDIRF4
+CNSTF4 1098907648
+LEF4 $967
+ADDRLP4 132
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 88+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 88+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $968
+JUMPV
+LABELV $967
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $968
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotAirControl
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $973
+ADDRLP4 24
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 100
+CNSTF4 1137180672
+ASGNF4
+LABELV $973
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRLP4 36+28
+ADDRLP4 24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRB
+ASGNB 52
+LABELV $959
+endproc BotFinishTravel_WalkOffLedge 144 20
+lit
+align 4
+LABELV $979
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotTravel_Jump
+code
+proc BotTravel_Jump 192 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 $979
+INDIRB
+ASGNB 52
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 65537
+ARGI4
+ADDRGP4 trap_AAS_JumpReachRunStart
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 40
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 40+4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 28
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 28+8
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 148
+CNSTF4 1117782016
+ASGNF4
+ADDRLP4 40
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+CNSTF4 1117782016
+ADDRLP4 16+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $988
+ADDRLP4 152
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 152
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 28+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 152
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+ADDI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 156
+ADDRGP4 trap_AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+EQI4 $999
+ADDRGP4 $990
+JUMPV
+LABELV $999
+LABELV $989
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 80
+LTI4 $988
+LABELV $990
+ADDRLP4 0
+INDIRI4
+CNSTI4 80
+GEI4 $1001
+ADDRLP4 156
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1001
+ADDRLP4 52
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 52
+ARGP4
+ADDRLP4 168
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 40+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 40+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 64
+ARGP4
+ADDRLP4 176
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 176
+INDIRF4
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 64
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 64+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 64+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 3209481421
+LTF4 $1021
+ADDRLP4 128
+INDIRF4
+CNSTF4 1084227584
+GEF4 $1015
+LABELV $1021
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRLP4 132
+INDIRF4
+CNSTF4 1103101952
+GEF4 $1024
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Jump
+CALLV
+pop
+ADDRGP4 $1025
+JUMPV
+LABELV $1024
+ADDRLP4 132
+INDIRF4
+CNSTF4 1107296256
+GEF4 $1026
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_DelayedJump
+CALLV
+pop
+LABELV $1026
+LABELV $1025
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTF4 1142292480
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1016
+JUMPV
+LABELV $1015
+ADDRLP4 16
+ADDRLP4 40
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 40+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRLP4 128
+INDIRF4
+CNSTF4 1117782016
+LEF4 $1031
+ADDRLP4 128
+CNSTF4 1117782016
+ASGNF4
+LABELV $1031
+ADDRLP4 184
+CNSTF4 1137180672
+ASGNF4
+ADDRLP4 136
+ADDRLP4 184
+INDIRF4
+ADDRLP4 184
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 128
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+LABELV $1016
+ADDRLP4 76+28
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 76
+INDIRB
+ASGNB 52
+LABELV $977
+endproc BotTravel_Jump 192 16
+lit
+align 4
+LABELV $1036
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotFinishTravel_Jump
+code
+proc BotFinishTravel_Jump 100 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRGP4 $1036
+INDIRB
+ASGNB 52
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1037
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRB
+ASGNB 52
+ADDRGP4 $1034
+JUMPV
+LABELV $1037
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 92
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 3204448256
+GEF4 $1043
+ADDRLP4 80
+INDIRF4
+CNSTF4 1103101952
+GEF4 $1043
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRB
+ASGNB 52
+ADDRGP4 $1034
+JUMPV
+LABELV $1043
+ADDRLP4 76
+CNSTF4 1145569280
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRLP4 24+28
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRB
+ASGNB 52
+LABELV $1034
+endproc BotFinishTravel_Jump 100 12
+lit
+align 4
+LABELV $1052
+byte 4 0
+byte 4 0
+byte 4 0
+align 4
+LABELV $1053
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotTravel_Ladder
+code
+proc BotTravel_Ladder 96 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 $1052
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRGP4 $1053
+INDIRB
+ASGNB 52
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 64
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 0+4
+INDIRF4
+ASGNF4
+ADDRLP4 64+8
+CNSTF4 1077936128
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 64
+ARGP4
+ADDRLP4 12+40
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_MoveForward
+CALLV
+pop
+ADDRLP4 12+20
+ADDRLP4 12+20
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRLP4 12+28
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+LABELV $1050
+endproc BotTravel_Ladder 96 12
+lit
+align 4
+LABELV $1065
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotTravel_Teleport
+code
+proc BotTravel_Teleport 80 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 $1065
+INDIRB
+ASGNB 52
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1066
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+ADDRGP4 $1063
+JUMPV
+LABELV $1066
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1070
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+LABELV $1070
+ADDRLP4 0
+ARGP4
+ADDRLP4 76
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRLP4 64
+INDIRF4
+CNSTF4 1106247680
+GEF4 $1073
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1128792064
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRGP4 $1074
+JUMPV
+LABELV $1073
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+LABELV $1074
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1075
+ADDRLP4 12+20
+ADDRLP4 12+20
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $1075
+ADDRLP4 12+28
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+LABELV $1063
+endproc BotTravel_Teleport 80 16
+lit
+align 4
+LABELV $1081
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotTravel_Elevator
+code
+proc BotTravel_Elevator 200 20
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $1081
+INDIRB
+ASGNB 52
+ADDRLP4 120
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRLP4 132
+CNSTP4 0
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 BotBSPModelMinsMaxsOrigin
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+NEI4 $1082
+ADDRFP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 52
+ADDRGP4 $1079
+JUMPV
+LABELV $1082
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotOnMover
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $1084
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 148
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CVIF4 4
+ADDRGP4 phys_maxbarrier
+INDIRF4
+GEF4 $1086
+ADDRLP4 92
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 92+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 92+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 92+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 92
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 92
+ARGP4
+CNSTF4 1120403456
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotCheckBarrierJump
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $1091
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+LABELV $1091
+ADDRLP4 0+28
+ADDRLP4 92
+INDIRB
+ASGNB 12
+ADDRGP4 $1085
+JUMPV
+LABELV $1086
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRGP4 MoverBottomCenter
+CALLI4
+pop
+ADDRLP4 92
+ADDRLP4 104
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 92+4
+ADDRLP4 104+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 92+8
+ADDRLP4 104+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 92+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 92
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 1092616192
+LEF4 $1085
+ADDRLP4 64
+INDIRF4
+CNSTF4 1120403456
+LEF4 $1101
+ADDRLP4 64
+CNSTF4 1120403456
+ASGNF4
+LABELV $1101
+ADDRLP4 160
+CNSTF4 1137180672
+ASGNF4
+ADDRLP4 124
+ADDRLP4 160
+INDIRF4
+ADDRLP4 160
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 64
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ARGP4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRLP4 0+28
+ADDRLP4 92
+INDIRB
+ASGNB 12
+ADDRGP4 $1085
+JUMPV
+LABELV $1084
+ADDRLP4 52
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 1115684864
+GEF4 $1106
+ADDRLP4 64
+INDIRF4
+CNSTF4 1114636288
+LEF4 $1108
+ADDRLP4 64
+CNSTF4 1114636288
+ASGNF4
+LABELV $1108
+ADDRLP4 160
+CNSTF4 1135869952
+ASGNF4
+ADDRLP4 124
+ADDRLP4 160
+INDIRF4
+ADDRLP4 160
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 64
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1112
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+CNSTF4 1112014848
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 168
+ADDRGP4 BotCheckBarrierJump
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $1110
+LABELV $1112
+ADDRLP4 64
+INDIRF4
+CNSTF4 1084227584
+LEF4 $1113
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+LABELV $1113
+LABELV $1110
+ADDRLP4 0+28
+ADDRLP4 52
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1116
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $1116
+ADDRFP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 52
+ADDRGP4 $1079
+JUMPV
+LABELV $1106
+ADDRLP4 68
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 68+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 68+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1121
+ADDRLP4 68+8
+CNSTF4 0
+ASGNF4
+LABELV $1121
+ADDRLP4 68
+ARGP4
+ADDRLP4 168
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 MoverDown
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+NEI4 $1124
+ADDRLP4 64
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 68
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRLP4 64
+INDIRF4
+CNSTF4 1114636288
+LEF4 $1126
+ADDRLP4 64
+CNSTF4 1114636288
+ASGNF4
+LABELV $1126
+ADDRLP4 176
+CNSTF4 1135869952
+ASGNF4
+ADDRLP4 124
+ADDRLP4 176
+INDIRF4
+ADDRLP4 176
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 64
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1128
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+CNSTF4 1112014848
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 184
+ADDRGP4 BotCheckBarrierJump
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+NEI4 $1128
+ADDRLP4 64
+INDIRF4
+CNSTF4 1084227584
+LEF4 $1130
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+LABELV $1130
+LABELV $1128
+ADDRLP4 0+28
+ADDRLP4 52
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1133
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $1133
+ADDRLP4 0+4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 52
+ADDRGP4 $1079
+JUMPV
+LABELV $1124
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRGP4 MoverBottomCenter
+CALLI4
+pop
+ADDRLP4 80
+ADDRLP4 104
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 104+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 104+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1142
+ADDRLP4 80+8
+CNSTF4 0
+ASGNF4
+LABELV $1142
+ADDRLP4 80
+ARGP4
+ADDRLP4 180
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 184
+INDIRF4
+CNSTF4 1101004800
+LTF4 $1152
+ADDRLP4 128
+INDIRF4
+ADDRLP4 184
+INDIRF4
+LTF4 $1152
+ADDRLP4 68
+INDIRF4
+ADDRLP4 80
+INDIRF4
+MULF4
+ADDRLP4 68+4
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 68+8
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $1145
+LABELV $1152
+ADDRLP4 64
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 80
+INDIRB
+ASGNB 12
+ADDRGP4 $1146
+JUMPV
+LABELV $1145
+ADDRLP4 64
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 68
+INDIRB
+ASGNB 12
+LABELV $1146
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRLP4 64
+INDIRF4
+CNSTF4 1114636288
+LEF4 $1153
+ADDRLP4 64
+CNSTF4 1114636288
+ASGNF4
+LABELV $1153
+ADDRLP4 188
+CNSTF4 1137180672
+ASGNF4
+ADDRLP4 124
+ADDRLP4 188
+INDIRF4
+ADDRLP4 188
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 64
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1155
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+CNSTF4 1112014848
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 196
+ADDRGP4 BotCheckBarrierJump
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+NEI4 $1155
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+LABELV $1155
+ADDRLP4 0+28
+ADDRLP4 52
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1158
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $1158
+LABELV $1085
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 52
+LABELV $1079
+endproc BotTravel_Elevator 200 20
+lit
+align 4
+LABELV $1163
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotFinishTravel_Elevator
+code
+proc BotFinishTravel_Elevator 112 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRGP4 $1163
+INDIRB
+ASGNB 52
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 88
+ADDRGP4 MoverBottomCenter
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $1164
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRB
+ASGNB 52
+ADDRGP4 $1161
+JUMPV
+LABELV $1164
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 104
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 12+8
+INDIRF4
+ARGF4
+ADDRLP4 108
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 104
+INDIRF4
+ADDRLP4 108
+INDIRF4
+GEF4 $1172
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1133903872
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRGP4 $1173
+JUMPV
+LABELV $1172
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTF4 1133903872
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+LABELV $1173
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRB
+ASGNB 52
+LABELV $1161
+endproc BotFinishTravel_Elevator 112 12
+lit
+align 4
+LABELV $1177
+byte 4 0
+byte 4 0
+byte 4 0
+export BotFuncBobStartEnd
+code
+proc BotFuncBobStartEnd 84 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRGP4 $1177
+INDIRB
+ASGNB 12
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotBSPModelMinsMaxsOrigin
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $1178
+CNSTI4 1
+ARGI4
+ADDRGP4 $1180
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1176
+JUMPV
+LABELV $1178
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 68
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 76
+CNSTI4 16
+ASGNI4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+RSHI4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+RSHI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 32767
+LEI4 $1191
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CVIU4 4
+CNSTU4 4294901760
+BORU4
+CVUI4 4
+ASGNI4
+LABELV $1191
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+LEI4 $1193
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CVIU4 4
+CNSTU4 4294901760
+BORU4
+CVUI4 4
+ASGNI4
+LABELV $1193
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1195
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0+4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ASGNF4
+ADDRGP4 $1196
+JUMPV
+LABELV $1195
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1199
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ASGNF4
+ADDRGP4 $1200
+JUMPV
+LABELV $1199
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0+4
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1200
+LABELV $1196
+CNSTI4 1
+RETI4
+LABELV $1176
+endproc BotFuncBobStartEnd 84 20
+lit
+align 4
+LABELV $1207
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotTravel_FuncBobbing
+code
+proc BotTravel_FuncBobbing 228 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 $1207
+INDIRB
+ASGNB 52
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotFuncBobStartEnd
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $1208
+ADDRFP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+ADDRGP4 $1205
+JUMPV
+LABELV $1208
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotOnMover
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $1210
+ADDRLP4 0
+ADDRLP4 92
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 92+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 92+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 176
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 176
+INDIRF4
+CNSTF4 1103101952
+GEF4 $1218
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 104+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 104+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 104+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 104
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 104
+ARGP4
+CNSTF4 1120403456
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 188
+ADDRGP4 BotCheckBarrierJump
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $1223
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+LABELV $1223
+ADDRLP4 12+28
+ADDRLP4 104
+INDIRB
+ASGNB 12
+ADDRGP4 $1211
+JUMPV
+LABELV $1218
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 116
+ARGP4
+ADDRGP4 MoverBottomCenter
+CALLI4
+pop
+ADDRLP4 104
+ADDRLP4 116
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 104+4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 104+8
+ADDRLP4 116+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 104+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 104
+ARGP4
+ADDRLP4 184
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 184
+INDIRF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 1092616192
+LEF4 $1211
+ADDRLP4 64
+INDIRF4
+CNSTF4 1120403456
+LEF4 $1233
+ADDRLP4 64
+CNSTF4 1120403456
+ASGNF4
+LABELV $1233
+ADDRLP4 188
+CNSTF4 1137180672
+ASGNF4
+ADDRLP4 156
+ADDRLP4 188
+INDIRF4
+ADDRLP4 188
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 64
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+ARGP4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRLP4 12+28
+ADDRLP4 104
+INDIRB
+ASGNB 12
+ADDRGP4 $1211
+JUMPV
+LABELV $1210
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 184
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 184
+INDIRF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 1115684864
+GEF4 $1238
+ADDRLP4 64
+INDIRF4
+CNSTF4 1114636288
+LEF4 $1240
+ADDRLP4 64
+CNSTF4 1114636288
+ASGNF4
+LABELV $1240
+ADDRLP4 188
+CNSTF4 1135869952
+ASGNF4
+ADDRLP4 156
+ADDRLP4 188
+INDIRF4
+ADDRLP4 188
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 64
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1244
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 1112014848
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 196
+ADDRGP4 BotCheckBarrierJump
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+NEI4 $1242
+LABELV $1244
+ADDRLP4 64
+INDIRF4
+CNSTF4 1084227584
+LEF4 $1245
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+LABELV $1245
+LABELV $1242
+ADDRLP4 12+28
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1248
+ADDRLP4 12+20
+ADDRLP4 12+20
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $1248
+ADDRFP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+ADDRGP4 $1205
+JUMPV
+LABELV $1238
+ADDRLP4 68
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 68+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 68+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1253
+ADDRLP4 68+8
+CNSTF4 0
+ASGNF4
+LABELV $1253
+ADDRLP4 68
+ARGP4
+ADDRLP4 196
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 152
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 92
+INDIRF4
+ADDRLP4 128
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 92+4
+INDIRF4
+ADDRLP4 128+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 92+8
+INDIRF4
+ADDRLP4 128+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 200
+INDIRF4
+CNSTF4 1098907648
+LEF4 $1262
+ADDRLP4 64
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 68
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRLP4 64
+INDIRF4
+CNSTF4 1114636288
+LEF4 $1264
+ADDRLP4 64
+CNSTF4 1114636288
+ASGNF4
+LABELV $1264
+ADDRLP4 204
+CNSTF4 1135869952
+ASGNF4
+ADDRLP4 156
+ADDRLP4 204
+INDIRF4
+ADDRLP4 204
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 64
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1266
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 1112014848
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 212
+ADDRGP4 BotCheckBarrierJump
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+NEI4 $1266
+ADDRLP4 64
+INDIRF4
+CNSTF4 1084227584
+LEF4 $1268
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+LABELV $1268
+LABELV $1266
+ADDRLP4 12+28
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1271
+ADDRLP4 12+20
+ADDRLP4 12+20
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $1271
+ADDRLP4 12+4
+CNSTI4 2
+ASGNI4
+ADDRLP4 12+20
+ADDRLP4 12+20
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+ADDRGP4 $1205
+JUMPV
+LABELV $1262
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 116
+ARGP4
+ADDRGP4 MoverBottomCenter
+CALLI4
+pop
+ADDRLP4 80
+ADDRLP4 116
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 116+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 116+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1280
+ADDRLP4 80+8
+CNSTF4 0
+ASGNF4
+LABELV $1280
+ADDRLP4 80
+ARGP4
+ADDRLP4 208
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 160
+ADDRLP4 208
+INDIRF4
+ASGNF4
+ADDRLP4 212
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRLP4 212
+INDIRF4
+CNSTF4 1101004800
+LTF4 $1290
+ADDRLP4 160
+INDIRF4
+ADDRLP4 212
+INDIRF4
+LTF4 $1290
+ADDRLP4 68
+INDIRF4
+ADDRLP4 80
+INDIRF4
+MULF4
+ADDRLP4 68+4
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 68+8
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $1283
+LABELV $1290
+ADDRLP4 64
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 80
+INDIRB
+ASGNB 12
+ADDRGP4 $1284
+JUMPV
+LABELV $1283
+ADDRLP4 64
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 68
+INDIRB
+ASGNB 12
+LABELV $1284
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRLP4 64
+INDIRF4
+CNSTF4 1114636288
+LEF4 $1291
+ADDRLP4 64
+CNSTF4 1114636288
+ASGNF4
+LABELV $1291
+ADDRLP4 216
+CNSTF4 1137180672
+ASGNF4
+ADDRLP4 156
+ADDRLP4 216
+INDIRF4
+ADDRLP4 216
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 64
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1293
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 1112014848
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 224
+ADDRGP4 BotCheckBarrierJump
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $1293
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+LABELV $1293
+ADDRLP4 12+28
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1296
+ADDRLP4 12+20
+ADDRLP4 12+20
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $1296
+LABELV $1211
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+LABELV $1205
+endproc BotTravel_FuncBobbing 228 16
+lit
+align 4
+LABELV $1301
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotFinishTravel_FuncBobbing
+code
+proc BotFinishTravel_FuncBobbing 160 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRGP4 $1301
+INDIRB
+ASGNB 52
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 132
+ADDRGP4 BotFuncBobStartEnd
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $1302
+ADDRFP4 0
+INDIRP4
+ADDRLP4 52
+INDIRB
+ASGNB 52
+ADDRGP4 $1299
+JUMPV
+LABELV $1302
+ADDRLP4 16
+ADDRLP4 28
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 28+4
+INDIRF4
+ADDRLP4 40+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 40+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 136
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1098907648
+GEF4 $1310
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1314
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+LABELV $1314
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 148
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1114636288
+LEF4 $1317
+ADDRLP4 0
+CNSTF4 1114636288
+ASGNF4
+LABELV $1317
+ADDRLP4 152
+CNSTF4 1135869952
+ASGNF4
+ADDRLP4 116
+ADDRLP4 152
+INDIRF4
+ADDRLP4 152
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1084227584
+LEF4 $1319
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 116
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+LABELV $1319
+ADDRLP4 52+28
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1311
+ADDRLP4 52+20
+ADDRLP4 52+20
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 $1311
+JUMPV
+LABELV $1310
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRGP4 MoverBottomCenter
+CALLI4
+pop
+ADDRLP4 4
+ADDRLP4 104
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 104+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 104+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1329
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+LABELV $1329
+ADDRLP4 4
+ARGP4
+ADDRLP4 144
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1084227584
+LEF4 $1332
+ADDRLP4 0
+INDIRF4
+CNSTF4 1120403456
+LEF4 $1334
+ADDRLP4 0
+CNSTF4 1120403456
+ASGNF4
+LABELV $1334
+ADDRLP4 148
+CNSTF4 1137180672
+ASGNF4
+ADDRLP4 116
+ADDRLP4 148
+INDIRF4
+ADDRLP4 148
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 116
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRLP4 52+28
+ADDRLP4 4
+INDIRB
+ASGNB 12
+LABELV $1332
+LABELV $1311
+ADDRFP4 0
+INDIRP4
+ADDRLP4 52
+INDIRB
+ASGNB 52
+LABELV $1299
+endproc BotFinishTravel_FuncBobbing 160 16
+export GrappleState
+proc GrappleState 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $1338
+CNSTI4 2
+RETI4
+ADDRGP4 $1337
+JUMPV
+LABELV $1338
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $1340
+CNSTI4 1
+RETI4
+ADDRGP4 $1337
+JUMPV
+LABELV $1340
+CNSTI4 0
+RETI4
+LABELV $1337
+endproc GrappleState 0 0
+export BotResetGrapple
+proc BotResetGrapple 52 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRLP4 0+36
+INDIRI4
+CNSTI4 16777215
+BANDI4
+CNSTI4 14
+EQI4 $1343
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+NEI4 $1348
+ADDRLP4 44
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1346
+LABELV $1348
+ADDRGP4 bot_offhandgrapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $1349
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1352
+ARGP4
+ADDRGP4 EA_Command
+CALLV
+pop
+LABELV $1349
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1346
+LABELV $1343
+LABELV $1342
+endproc BotResetGrapple 52 8
+lit
+align 4
+LABELV $1355
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotTravel_Grapple
+code
+proc BotTravel_Grapple 236 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 $1355
+INDIRB
+ASGNB 52
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $1356
+ADDRGP4 bot_offhandgrapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $1358
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1352
+ARGP4
+ADDRGP4 EA_Command
+CALLV
+pop
+LABELV $1358
+ADDRLP4 168
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+ADDRGP4 $1353
+JUMPV
+LABELV $1356
+ADDRGP4 bot_offhandgrapple+12
+INDIRI4
+CNSTI4 0
+NEI4 $1361
+ADDRLP4 12+24
+CNSTI4 10
+ASGNI4
+ADDRLP4 12+20
+ADDRLP4 12+20
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $1361
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1366
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 GrappleState
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 180
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+EQI4 $1371
+ADDRLP4 76
+INDIRF4
+CNSTF4 1111490560
+GEF4 $1371
+ADDRFP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+ADDRLP4 76
+INDIRF4
+SUBF4
+CNSTF4 1065353216
+GEF4 $1372
+ADDRGP4 bot_offhandgrapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $1375
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1352
+ARGP4
+ADDRGP4 EA_Command
+CALLV
+pop
+LABELV $1375
+ADDRLP4 184
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ADDRLP4 184
+INDIRP4
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+ADDRLP4 188
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ADDRLP4 188
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+ADDRGP4 $1353
+JUMPV
+LABELV $1371
+ADDRLP4 184
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $1380
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+NEI4 $1378
+ADDRLP4 76
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $1378
+LABELV $1380
+ADDRLP4 188
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ADDRLP4 188
+INDIRF4
+CNSTF4 1053609165
+SUBF4
+GEF4 $1379
+ADDRGP4 bot_offhandgrapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $1383
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1352
+ARGP4
+ADDRGP4 EA_Command
+CALLV
+pop
+LABELV $1383
+ADDRLP4 192
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ADDRLP4 192
+INDIRP4
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+ADDRLP4 196
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ADDRLP4 196
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+ADDRGP4 $1353
+JUMPV
+LABELV $1378
+ADDRLP4 188
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRLP4 188
+INDIRF4
+ASGNF4
+LABELV $1379
+LABELV $1372
+ADDRGP4 bot_offhandgrapple+12
+INDIRI4
+CNSTI4 0
+NEI4 $1386
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Attack
+CALLV
+pop
+LABELV $1386
+ADDRFP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRGP4 $1367
+JUMPV
+LABELV $1366
+ADDRLP4 168
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1391
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+LABELV $1391
+ADDRLP4 64
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 64
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 64+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 64+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 192
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ARGP4
+ADDRLP4 12+40
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 12+20
+ADDRLP4 12+20
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRLP4 76
+INDIRF4
+CNSTF4 1084227584
+GEF4 $1402
+ADDRLP4 12+40
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 196
+ADDRGP4 AngleDiff
+CALLF4
+ASGNF4
+ADDRLP4 196
+INDIRF4
+ARGF4
+ADDRLP4 200
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 200
+INDIRF4
+CNSTF4 1073741824
+GEF4 $1402
+ADDRLP4 12+40+4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 204
+ADDRGP4 AngleDiff
+CALLF4
+ASGNF4
+ADDRLP4 204
+INDIRF4
+ARGF4
+ADDRLP4 208
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 208
+INDIRF4
+CNSTF4 1073741824
+GEF4 $1402
+ADDRLP4 64
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 100
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 220
+CNSTP4 0
+ASGNP4
+ADDRLP4 220
+INDIRP4
+ARGP4
+ADDRLP4 220
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 100+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 100+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 100+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 228
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 228
+INDIRF4
+CNSTF4 1098907648
+LEF4 $1416
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+ADDRGP4 $1353
+JUMPV
+LABELV $1416
+ADDRGP4 bot_offhandgrapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $1418
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1421
+ARGP4
+ADDRGP4 EA_Command
+CALLV
+pop
+ADDRGP4 $1419
+JUMPV
+LABELV $1418
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Attack
+CALLV
+pop
+LABELV $1419
+ADDRLP4 232
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 232
+INDIRP4
+ADDRLP4 232
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1232348144
+ASGNF4
+ADDRGP4 $1403
+JUMPV
+LABELV $1402
+ADDRLP4 76
+INDIRF4
+CNSTF4 1116471296
+GEF4 $1422
+ADDRLP4 212
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 164
+ADDRLP4 212
+INDIRF4
+ADDRLP4 212
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 76
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRGP4 $1423
+JUMPV
+LABELV $1422
+ADDRLP4 164
+CNSTF4 1137180672
+ASGNF4
+LABELV $1423
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 164
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRLP4 12+28
+ADDRLP4 0
+INDIRB
+ASGNB 12
+LABELV $1403
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 212
+ADDRGP4 trap_AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 216
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+EQI4 $1425
+ADDRLP4 216
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+EQI4 $1425
+ADDRFP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1425
+LABELV $1367
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+LABELV $1353
+endproc BotTravel_Grapple 236 28
+lit
+align 4
+LABELV $1429
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotTravel_RocketJump
+code
+proc BotTravel_RocketJump 112 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $1429
+INDIRB
+ASGNB 52
+ADDRLP4 52
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 52
+ARGP4
+ADDRLP4 80
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ARGP4
+ADDRLP4 0+40
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0+40
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 1084227584
+GEF4 $1434
+ADDRLP4 0+40
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 AngleDiff
+CALLF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 88
+INDIRF4
+CNSTF4 1084227584
+GEF4 $1434
+ADDRLP4 0+40+4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 92
+ADDRGP4 AngleDiff
+CALLF4
+ASGNF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 96
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 96
+INDIRF4
+CNSTF4 1084227584
+GEF4 $1434
+ADDRLP4 52
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 52
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Jump
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Attack
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+CNSTF4 1145569280
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1435
+JUMPV
+LABELV $1434
+ADDRLP4 64
+INDIRF4
+CNSTF4 1117782016
+LEF4 $1441
+ADDRLP4 64
+CNSTF4 1117782016
+ASGNF4
+LABELV $1441
+ADDRLP4 100
+CNSTF4 1137180672
+ASGNF4
+ADDRLP4 68
+ADDRLP4 100
+INDIRF4
+ADDRLP4 100
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 64
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+LABELV $1435
+ADDRLP4 52
+ARGP4
+ADDRLP4 0+40
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0+40
+CNSTF4 1119092736
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0+40
+ARGP4
+ADDRGP4 EA_View
+CALLV
+pop
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 EA_SelectWeapon
+CALLV
+pop
+ADDRLP4 0+24
+CNSTI4 5
+ASGNI4
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 0+28
+ADDRLP4 52
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 52
+LABELV $1427
+endproc BotTravel_RocketJump 112 12
+lit
+align 4
+LABELV $1452
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotTravel_BFGJump
+code
+proc BotTravel_BFGJump 112 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $1452
+INDIRB
+ASGNB 52
+ADDRLP4 52
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 52
+ARGP4
+ADDRLP4 80
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 1084227584
+GEF4 $1455
+ADDRLP4 0+40
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 AngleDiff
+CALLF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 88
+INDIRF4
+CNSTF4 1084227584
+GEF4 $1455
+ADDRLP4 0+40+4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 92
+ADDRGP4 AngleDiff
+CALLF4
+ASGNF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 96
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 96
+INDIRF4
+CNSTF4 1084227584
+GEF4 $1455
+ADDRLP4 52
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 52
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Jump
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Attack
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+CNSTF4 1145569280
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1456
+JUMPV
+LABELV $1455
+ADDRLP4 64
+INDIRF4
+CNSTF4 1117782016
+LEF4 $1462
+ADDRLP4 64
+CNSTF4 1117782016
+ASGNF4
+LABELV $1462
+ADDRLP4 100
+CNSTF4 1137180672
+ASGNF4
+ADDRLP4 68
+ADDRLP4 100
+INDIRF4
+ADDRLP4 100
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 64
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+LABELV $1456
+ADDRLP4 52
+ARGP4
+ADDRLP4 0+40
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0+40
+CNSTF4 1119092736
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0+40
+ARGP4
+ADDRGP4 EA_View
+CALLV
+pop
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 9
+ARGI4
+ADDRGP4 EA_SelectWeapon
+CALLV
+pop
+ADDRLP4 0+24
+CNSTI4 9
+ASGNI4
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 0+28
+ADDRLP4 52
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 52
+LABELV $1450
+endproc BotTravel_BFGJump 112 12
+lit
+align 4
+LABELV $1473
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotFinishTravel_WeaponJump
+code
+proc BotFinishTravel_WeaponJump 84 20
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 $1473
+INDIRB
+ASGNB 52
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1474
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+ADDRGP4 $1471
+JUMPV
+LABELV $1474
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 72
+ADDRGP4 BotAirControl
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $1476
+ADDRLP4 76
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 76
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 64
+CNSTF4 1137180672
+ASGNF4
+LABELV $1476
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRLP4 12+28
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+LABELV $1471
+endproc BotFinishTravel_WeaponJump 84 20
+lit
+align 4
+LABELV $1484
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotTravel_JumpPad
+code
+proc BotTravel_JumpPad 72 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 $1484
+INDIRB
+ASGNB 52
+ADDRLP4 64
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 64
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 64
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRLP4 12+28
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+LABELV $1482
+endproc BotTravel_JumpPad 72 16
+lit
+align 4
+LABELV $1490
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotFinishTravel_JumpPad
+code
+proc BotFinishTravel_JumpPad 84 20
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 $1490
+INDIRB
+ASGNB 52
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 72
+ADDRGP4 BotAirControl
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $1491
+ADDRLP4 76
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 76
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 64
+CNSTF4 1137180672
+ASGNF4
+LABELV $1491
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRLP4 12+28
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+LABELV $1488
+endproc BotFinishTravel_JumpPad 84 20
+export BotReachabilityTime
+proc BotReachabilityTime 12 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 16777215
+BANDI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $1497
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+GTI4 $1497
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+ADDRGP4 $1516-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1516
+address $1500
+address $1501
+address $1502
+address $1505
+address $1503
+address $1504
+address $1506
+address $1507
+address $1508
+address $1509
+address $1511
+address $1512
+address $1510
+address $1497
+address $1497
+address $1497
+address $1513
+address $1514
+code
+LABELV $1500
+CNSTI4 5
+RETI4
+ADDRGP4 $1496
+JUMPV
+LABELV $1501
+CNSTI4 5
+RETI4
+ADDRGP4 $1496
+JUMPV
+LABELV $1502
+CNSTI4 5
+RETI4
+ADDRGP4 $1496
+JUMPV
+LABELV $1503
+CNSTI4 6
+RETI4
+ADDRGP4 $1496
+JUMPV
+LABELV $1504
+CNSTI4 5
+RETI4
+ADDRGP4 $1496
+JUMPV
+LABELV $1505
+CNSTI4 5
+RETI4
+ADDRGP4 $1496
+JUMPV
+LABELV $1506
+CNSTI4 5
+RETI4
+ADDRGP4 $1496
+JUMPV
+LABELV $1507
+CNSTI4 5
+RETI4
+ADDRGP4 $1496
+JUMPV
+LABELV $1508
+CNSTI4 5
+RETI4
+ADDRGP4 $1496
+JUMPV
+LABELV $1509
+CNSTI4 10
+RETI4
+ADDRGP4 $1496
+JUMPV
+LABELV $1510
+CNSTI4 8
+RETI4
+ADDRGP4 $1496
+JUMPV
+LABELV $1511
+CNSTI4 6
+RETI4
+ADDRGP4 $1496
+JUMPV
+LABELV $1512
+CNSTI4 6
+RETI4
+ADDRGP4 $1496
+JUMPV
+LABELV $1513
+CNSTI4 10
+RETI4
+ADDRGP4 $1496
+JUMPV
+LABELV $1514
+CNSTI4 10
+RETI4
+ADDRGP4 $1496
+JUMPV
+LABELV $1497
+CNSTI4 3
+ARGI4
+ADDRGP4 $1515
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 8
+RETI4
+LABELV $1496
+endproc BotReachabilityTime 12 12
+lit
+align 4
+LABELV $1520
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export BotMoveInGoalArea
+code
+proc BotMoveInGoalArea 96 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 $1520
+INDIRB
+ASGNB 52
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1522
+ADDRLP4 84
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+16
+CNSTI4 8
+ASGNI4
+ADDRGP4 $1523
+JUMPV
+LABELV $1522
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+16
+CNSTI4 2
+ASGNI4
+LABELV $1523
+ADDRLP4 0
+ARGP4
+ADDRLP4 84
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 1120403456
+LEF4 $1528
+ADDRLP4 64
+CNSTF4 1120403456
+ASGNF4
+LABELV $1528
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 BotCheckRunToGoal
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $1530
+ADDRLP4 92
+CNSTF4 1128792064
+ASGNF4
+ADDRLP4 68
+ADDRLP4 92
+INDIRF4
+ADDRLP4 92
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 64
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+ADDRGP4 $1531
+JUMPV
+LABELV $1530
+ADDRLP4 92
+CNSTF4 1137180672
+ASGNF4
+ADDRLP4 68
+ADDRLP4 92
+INDIRF4
+ADDRLP4 92
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 64
+INDIRF4
+MULF4
+SUBF4
+SUBF4
+ASGNF4
+LABELV $1531
+ADDRLP4 68
+INDIRF4
+CNSTF4 1092616192
+GEF4 $1532
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+LABELV $1532
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotCheckBlocked
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRGP4 EA_Move
+CALLV
+pop
+ADDRLP4 12+28
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1535
+ADDRLP4 0
+ARGP4
+ADDRLP4 12+40
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 12+20
+ADDRLP4 12+20
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $1535
+ADDRFP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 52
+LABELV $1518
+endproc BotMoveInGoalArea 96 16
+export BotMoveToGoal
+proc BotMoveToGoal 952 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 BotMoveStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 112
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1540
+ADDRGP4 $1539
+JUMPV
+LABELV $1540
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotResetGrapple
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1542
+CNSTI4 0
+ARGI4
+ADDRGP4 $1544
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1539
+JUMPV
+LABELV $1542
+ADDRLP4 116
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRI4
+CNSTI4 -13
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRLP4 124
+ADDRGP4 trap_AAS_OnGround
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+EQI4 $1545
+ADDRLP4 128
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $1545
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1547
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 BotOnTopOfEntity
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 -1
+EQI4 $1549
+ADDRLP4 128
+CNSTI4 720
+ADDRLP4 60
+INDIRI4
+MULI4
+ADDRGP4 g_entities+84+12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+LTI4 $1553
+ADDRLP4 140
+INDIRI4
+CNSTI4 1024
+GEI4 $1553
+ADDRLP4 132
+ADDRLP4 128
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 modeltypes
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+NEI4 $1555
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRLP4 8+36
+INDIRI4
+CNSTI4 16777215
+BANDI4
+CNSTI4 11
+NEI4 $1561
+ADDRLP4 8+4
+INDIRI4
+CNSTI4 65535
+BANDI4
+ADDRLP4 128
+INDIRI4
+EQI4 $1557
+LABELV $1561
+CNSTI4 0
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 trap_AAS_NextModelReachability
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $1562
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 148
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotReachabilityTime
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 148
+INDIRF4
+ADDRLP4 152
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 $1563
+JUMPV
+LABELV $1562
+CNSTI4 0
+ARGI4
+ADDRGP4 $1564
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRGP4 $1539
+JUMPV
+LABELV $1563
+LABELV $1557
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 144
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRGP4 $1556
+JUMPV
+LABELV $1555
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+NEI4 $1565
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRLP4 8+36
+INDIRI4
+CNSTI4 16777215
+BANDI4
+CNSTI4 19
+NEI4 $1571
+ADDRLP4 8+4
+INDIRI4
+CNSTI4 65535
+BANDI4
+ADDRLP4 128
+INDIRI4
+EQI4 $1567
+LABELV $1571
+CNSTI4 0
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 trap_AAS_NextModelReachability
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $1572
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 148
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotReachabilityTime
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 148
+INDIRF4
+ADDRLP4 152
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 $1573
+JUMPV
+LABELV $1572
+CNSTI4 0
+ARGI4
+ADDRGP4 $1574
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRGP4 $1539
+JUMPV
+LABELV $1573
+LABELV $1567
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 144
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRGP4 $1566
+JUMPV
+LABELV $1565
+ADDRLP4 144
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 4
+EQI4 $1577
+ADDRLP4 144
+INDIRI4
+CNSTI4 3
+NEI4 $1575
+LABELV $1577
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 BotPlayerFuzzyPointReachabilityArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $1576
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRGP4 $1539
+JUMPV
+LABELV $1575
+ADDRLP4 132
+INDIRI4
+CNSTI4 5
+NEI4 $1580
+ADDRGP4 $1581
+JUMPV
+LABELV $1580
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRGP4 $1539
+JUMPV
+LABELV $1581
+LABELV $1576
+LABELV $1566
+LABELV $1556
+LABELV $1553
+LABELV $1549
+LABELV $1547
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $1582
+ADDRLP4 132
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $1582
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 trap_AAS_AgainstLadder
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $1584
+ADDRLP4 140
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $1584
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 14
+BANDI4
+CNSTI4 0
+EQI4 $1586
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 BotPlayerFuzzyPointReachabilityArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1588
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRGP4 $1539
+JUMPV
+LABELV $1588
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $1590
+ADDRLP4 152
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotMoveInGoalArea
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 152
+INDIRB
+ASGNB 52
+ADDRGP4 $1539
+JUMPV
+LABELV $1590
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $1592
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRLP4 8+36
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 trap_AAS_TravelFlagForType
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ADDRFP4 12
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $1594
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1595
+JUMPV
+LABELV $1594
+ADDRLP4 8+36
+INDIRI4
+CNSTI4 16777215
+BANDI4
+CNSTI4 14
+NEI4 $1597
+ADDRLP4 156
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+LTF4 $1602
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $1598
+LABELV $1602
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1598
+JUMPV
+LABELV $1597
+ADDRLP4 156
+CNSTI4 16777215
+ASGNI4
+ADDRLP4 8+36
+INDIRI4
+ADDRLP4 156
+INDIRI4
+BANDI4
+CNSTI4 11
+EQI4 $1607
+ADDRLP4 8+36
+INDIRI4
+ADDRLP4 156
+INDIRI4
+BANDI4
+CNSTI4 19
+NEI4 $1603
+LABELV $1607
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 128
+BANDI4
+ADDRLP4 164
+INDIRI4
+NEI4 $1610
+ADDRLP4 160
+INDIRI4
+CNSTI4 64
+BANDI4
+ADDRLP4 164
+INDIRI4
+EQI4 $1608
+LABELV $1610
+ADDRLP4 168
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 168
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $1608
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $1613
+ADDRLP4 172
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ADDRLP4 172
+INDIRF4
+GEF4 $1604
+LABELV $1613
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1604
+JUMPV
+LABELV $1603
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $1614
+ADDRLP4 160
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ADDRLP4 160
+INDIRF4
+GEF4 $1617
+CNSTI4 1
+ARGI4
+ADDRGP4 $1619
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 8+36
+INDIRI4
+CNSTI4 16777215
+BANDI4
+ARGI4
+ADDRGP4 trap_AAS_PrintTravelType
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $1621
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1617
+LABELV $1614
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $1625
+ADDRLP4 164
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LTF4 $1625
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+EQI4 $1622
+LABELV $1625
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+LABELV $1622
+LABELV $1604
+LABELV $1598
+LABELV $1595
+LABELV $1592
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $1626
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $1628
+CNSTI4 0
+ARGI4
+ADDRGP4 $1630
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1628
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotCorridorReachability
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $1631
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotGetReachabilityToGoal
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 BotRepairCorridor
+CALLV
+pop
+LABELV $1631
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 168
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CNSTI4 -513
+BANDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $1633
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRLP4 172
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotReachabilityTime
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 172
+INDIRF4
+ADDRLP4 176
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRI4
+ARGI4
+CNSTF4 1086324736
+ARGF4
+ADDRGP4 BotAddToAvoidReach
+CALLV
+pop
+ADDRGP4 $1634
+JUMPV
+LABELV $1633
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $1635
+CNSTI4 1
+ARGI4
+ADDRGP4 $1638
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1635
+LABELV $1634
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $1639
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $1642
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $1644
+CNSTI4 1
+ARGI4
+ADDRGP4 $1646
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1644
+LABELV $1642
+LABELV $1639
+LABELV $1626
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $1647
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 8+36
+INDIRI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 8+36
+INDIRI4
+CNSTI4 16777215
+BANDI4
+ASGNI4
+ADDRLP4 168
+CNSTI4 2
+ASGNI4
+ADDRLP4 160
+INDIRI4
+ADDRLP4 168
+INDIRI4
+LTI4 $1650
+ADDRLP4 160
+INDIRI4
+CNSTI4 19
+GTI4 $1650
+ADDRLP4 160
+INDIRI4
+ADDRLP4 168
+INDIRI4
+LSHI4
+ADDRGP4 $1670-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1670
+address $1654
+address $1655
+address $1656
+address $1659
+address $1657
+address $1658
+address $1660
+address $1661
+address $1662
+address $1663
+address $1665
+address $1666
+address $1664
+address $1650
+address $1650
+address $1650
+address $1667
+address $1668
+code
+LABELV $1654
+ADDRLP4 172
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotTravel_Walk
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 172
+INDIRB
+ASGNB 52
+ADDRGP4 $1651
+JUMPV
+LABELV $1655
+ADDRLP4 224
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotTravel_Crouch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 224
+INDIRB
+ASGNB 52
+ADDRGP4 $1651
+JUMPV
+LABELV $1656
+ADDRLP4 276
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotTravel_BarrierJump
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 276
+INDIRB
+ASGNB 52
+ADDRGP4 $1651
+JUMPV
+LABELV $1657
+ADDRLP4 328
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotTravel_Ladder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 328
+INDIRB
+ASGNB 52
+ADDRGP4 $1651
+JUMPV
+LABELV $1658
+ADDRLP4 380
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotTravel_WalkOffLedge
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 380
+INDIRB
+ASGNB 52
+ADDRGP4 $1651
+JUMPV
+LABELV $1659
+ADDRLP4 432
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotTravel_Jump
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 432
+INDIRB
+ASGNB 52
+ADDRGP4 $1651
+JUMPV
+LABELV $1660
+ADDRLP4 484
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotTravel_Swim
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 484
+INDIRB
+ASGNB 52
+ADDRGP4 $1651
+JUMPV
+LABELV $1661
+ADDRLP4 536
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotTravel_WaterJump
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 536
+INDIRB
+ASGNB 52
+ADDRGP4 $1651
+JUMPV
+LABELV $1662
+ADDRLP4 588
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotTravel_Teleport
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 588
+INDIRB
+ASGNB 52
+ADDRGP4 $1651
+JUMPV
+LABELV $1663
+ADDRLP4 640
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotTravel_Elevator
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 640
+INDIRB
+ASGNB 52
+ADDRGP4 $1651
+JUMPV
+LABELV $1664
+ADDRLP4 692
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotTravel_Grapple
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 692
+INDIRB
+ASGNB 52
+ADDRGP4 $1651
+JUMPV
+LABELV $1665
+ADDRLP4 744
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotTravel_RocketJump
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 744
+INDIRB
+ASGNB 52
+ADDRGP4 $1651
+JUMPV
+LABELV $1666
+ADDRLP4 796
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotTravel_BFGJump
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 796
+INDIRB
+ASGNB 52
+ADDRGP4 $1651
+JUMPV
+LABELV $1667
+ADDRLP4 848
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotTravel_JumpPad
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 848
+INDIRB
+ASGNB 52
+ADDRGP4 $1651
+JUMPV
+LABELV $1668
+ADDRLP4 900
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotTravel_FuncBobbing
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 900
+INDIRB
+ASGNB 52
+ADDRGP4 $1651
+JUMPV
+LABELV $1650
+CNSTI4 4
+ARGI4
+ADDRGP4 $1515
+ARGP4
+ADDRLP4 8+36
+INDIRI4
+CNSTI4 16777215
+BANDI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1651
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 8+36
+INDIRI4
+ASGNI4
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 172
+INDIRP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+BORI4
+ASGNI4
+ADDRGP4 $1648
+JUMPV
+LABELV $1647
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 44
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $1648
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $1587
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1587
+CNSTI4 1
+ARGI4
+ADDRGP4 $1678
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 8+36
+INDIRI4
+CNSTI4 16777215
+BANDI4
+ARGI4
+ADDRGP4 trap_AAS_PrintTravelType
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $1621
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $1587
+JUMPV
+LABELV $1586
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 232
+CNSTF4 3221225472
+ASGNF4
+ADDRLP4 236
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 212
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRP4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 212+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRP4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 212+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 212
+ARGP4
+ADDRLP4 148
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRLP4 244
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 224
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 224
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1685
+JUMPV
+LABELV $1682
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 248
+ADDRGP4 trap_AAS_AreaJumpPad
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+EQI4 $1686
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRLP4 212
+ARGP4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 262144
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 256
+ADDRGP4 BotGetReachabilityToGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1688
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1684
+JUMPV
+LABELV $1688
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 260
+ADDRGP4 trap_AAS_NextAreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRGP4 $1693
+JUMPV
+LABELV $1690
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRLP4 8+36
+INDIRI4
+CNSTI4 16777215
+BANDI4
+CNSTI4 18
+NEI4 $1694
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1694
+LABELV $1691
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 trap_AAS_NextAreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+LABELV $1693
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1690
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1697
+ADDRGP4 $1684
+JUMPV
+LABELV $1697
+LABELV $1686
+LABELV $1683
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1685
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $1682
+LABELV $1684
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $1699
+ADDRLP4 248
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 248
+INDIRI4
+EQI4 $1702
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ADDRLP4 248
+INDIRI4
+NEI4 $1702
+CNSTI4 1
+ARGI4
+ADDRGP4 $1704
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1702
+LABELV $1699
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1705
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 8+36
+INDIRI4
+ASGNI4
+ADDRLP4 248
+ADDRLP4 8+36
+INDIRI4
+CNSTI4 16777215
+BANDI4
+ASGNI4
+ADDRLP4 256
+CNSTI4 2
+ASGNI4
+ADDRLP4 248
+INDIRI4
+ADDRLP4 256
+INDIRI4
+LTI4 $1708
+ADDRLP4 248
+INDIRI4
+CNSTI4 19
+GTI4 $1708
+ADDRLP4 248
+INDIRI4
+ADDRLP4 256
+INDIRI4
+LSHI4
+ADDRGP4 $1728-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1728
+address $1712
+address $1709
+address $1714
+address $1717
+address $1715
+address $1716
+address $1718
+address $1719
+address $1709
+address $1721
+address $1723
+address $1723
+address $1722
+address $1708
+address $1708
+address $1708
+address $1724
+address $1725
+code
+LABELV $1712
+ADDRLP4 260
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotTravel_Walk
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 260
+INDIRB
+ASGNB 52
+ADDRGP4 $1709
+JUMPV
+LABELV $1714
+ADDRLP4 312
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotFinishTravel_BarrierJump
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 312
+INDIRB
+ASGNB 52
+ADDRGP4 $1709
+JUMPV
+LABELV $1715
+ADDRLP4 364
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotTravel_Ladder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 364
+INDIRB
+ASGNB 52
+ADDRGP4 $1709
+JUMPV
+LABELV $1716
+ADDRLP4 416
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotFinishTravel_WalkOffLedge
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 416
+INDIRB
+ASGNB 52
+ADDRGP4 $1709
+JUMPV
+LABELV $1717
+ADDRLP4 468
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotFinishTravel_Jump
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 468
+INDIRB
+ASGNB 52
+ADDRGP4 $1709
+JUMPV
+LABELV $1718
+ADDRLP4 520
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotTravel_Swim
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 520
+INDIRB
+ASGNB 52
+ADDRGP4 $1709
+JUMPV
+LABELV $1719
+ADDRLP4 572
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotFinishTravel_WaterJump
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 572
+INDIRB
+ASGNB 52
+ADDRGP4 $1709
+JUMPV
+LABELV $1721
+ADDRLP4 624
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotFinishTravel_Elevator
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 624
+INDIRB
+ASGNB 52
+ADDRGP4 $1709
+JUMPV
+LABELV $1722
+ADDRLP4 676
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotTravel_Grapple
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 676
+INDIRB
+ASGNB 52
+ADDRGP4 $1709
+JUMPV
+LABELV $1723
+ADDRLP4 728
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotFinishTravel_WeaponJump
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 728
+INDIRB
+ASGNB 52
+ADDRGP4 $1709
+JUMPV
+LABELV $1724
+ADDRLP4 780
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotFinishTravel_JumpPad
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 780
+INDIRB
+ASGNB 52
+ADDRGP4 $1709
+JUMPV
+LABELV $1725
+ADDRLP4 832
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotFinishTravel_FuncBobbing
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 832
+INDIRB
+ASGNB 52
+ADDRGP4 $1709
+JUMPV
+LABELV $1708
+CNSTI4 4
+ARGI4
+ADDRGP4 $1726
+ARGP4
+ADDRLP4 8+36
+INDIRI4
+CNSTI4 16777215
+BANDI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1709
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 8+36
+INDIRI4
+ASGNI4
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $1731
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1734
+CNSTI4 1
+ARGI4
+ADDRGP4 $1736
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 8+36
+INDIRI4
+CNSTI4 16777215
+BANDI4
+ARGI4
+ADDRGP4 trap_AAS_PrintTravelType
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $1621
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1734
+LABELV $1731
+LABELV $1705
+LABELV $1587
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1738
+ADDRLP4 148
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRF4
+CNSTF4 1092616192
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $1738
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $1539
+endproc BotMoveToGoal 952 48
+export BotResetAvoidReach
+proc BotResetAvoidReach 8 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotMoveStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1741
+ADDRGP4 $1740
+JUMPV
+LABELV $1741
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $1740
+endproc BotResetAvoidReach 8 12
+export BotResetLastAvoidReach
+proc BotResetLastAvoidReach 28 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 BotMoveStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1744
+ADDRGP4 $1743
+JUMPV
+LABELV $1744
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $1746
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $1750
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1750
+LABELV $1747
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $1746
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+EQF4 $1752
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1754
+ADDRLP4 24
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1754
+LABELV $1752
+LABELV $1743
+endproc BotResetLastAvoidReach 28 4
+export BotResetMoveState
+proc BotResetMoveState 8 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotMoveStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1757
+ADDRGP4 $1756
+JUMPV
+LABELV $1757
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1560
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $1756
+endproc BotResetMoveState 8 12
+export BotSetupMoveAI
+proc BotSetupMoveAI 4 12
+ADDRGP4 BotSetBrushModelTypes
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 botcorridorrouting
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 botpointareas
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 256
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 0
+RETI4
+LABELV $1759
+endproc BotSetupMoveAI 4 12
+export BotInitPhysicsSettings
+proc BotInitPhysicsSettings 4 4
+ADDRGP4 $1761
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotLibVarGetValue
+CALLF4
+ASGNF4
+ADDRGP4 phys_maxbarrier
+ADDRLP4 0
+INDIRF4
+ASGNF4
+LABELV $1760
+endproc BotInitPhysicsSettings 4 4
+export BotShutdownMoveAI
+proc BotShutdownMoveAI 0 0
+LABELV $1762
+endproc BotShutdownMoveAI 0 0
+bss
+align 4
+LABELV botpointareas
+skip 256
+align 4
+LABELV botcorridorrouting
+skip 4
+align 4
+LABELV botmovestates
+skip 101400
+export modeltypes
+align 4
+LABELV modeltypes
+skip 4096
+export phys_maxbarrier
+align 4
+LABELV phys_maxbarrier
+skip 4
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotTeamAI
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import ctf_blueflag
+import ctf_redflag
+import bot_offhandgrapple
+import bot_droppedweight
+import bot_challenge
+import bot_testrchat
+import bot_testichat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxplayers
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import PlayerOnSameTeamFromName
+import PlayerFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckBlockedTeammates
+import BotCheckAttack
+import BotAimAtEnemy
+import BotVisibilityStats
+import BotEndVisibilityFrame
+import BotBeginVisibilityFrame
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotCountTeamMates
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import BotCanCamp
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanGrapple
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import EasyPlayerName
+import PlayerName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityIsShooting
+import SenseCarriesCubes
+import SenseIsInvisible
+import EntityIsInvisible
+import PowerupsCarryFlag
+import PlayerCarriesFlag
+import PlayerIsDead
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotPlayerStateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import bot_reloadcharacters
+import bot_showteamgoals
+import bot_shownodechanges
+import bot_developer
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetPlayerState
+import BotAI_DebugLineShow
+import BotAI_DebugLineDelete
+import BotAI_DebugLineCreate
+import BotAI_InPVS
+import BotAI_PointContents
+import BotAI_EntityTrace
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotLibVarGetValue
+import BotNextEntity
+import BotSense
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotShutdownWeights
+import InterbreedWeightConfigs
+import EvolveWeightConfig
+import ScaleBalanceRange
+import ScaleWeight
+import CompileWeightConfig
+import FuzzyWeightTree
+import FuzzyWeights
+import FuzzyWeightUndecided
+import FuzzyWeight
+import FindFuzzyWeight
+import WriteWeightConfig
+import FreeWeightConfig
+import ReadWeightConfig
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotPrepareItemWeights
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotMatchTemplatesContainsString
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatchLinear
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import GetBotLibAPI
+import g_instagib
+import g_playerCapsule
+import g_proxMineTimeout
+import g_singlePlayer
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGamePlayers
+import g_maxplayers
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import trap_AAS_DropToFloor
+import trap_AAS_HorizontalVelocityForJump
+import trap_AAS_AgainstLadder
+import trap_AAS_JumpReachRunStart
+import trap_AAS_Swimming
+import trap_AAS_OnGround
+import trap_AAS_PredictPlayerMovement
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaTravelTime
+import trap_AAS_EnableRoutingArea
+import trap_AAS_RandomGoalArea
+import trap_AAS_ReachabilityFromNum
+import trap_AAS_NextAreaReachability
+import trap_AAS_AreaContentsTravelFlags
+import trap_AAS_TravelFlagForType
+import trap_AAS_AreaDoNotEnter
+import trap_AAS_AreaJumpPad
+import trap_AAS_AreaLadder
+import trap_AAS_AreaGrounded
+import trap_AAS_AreaSlime
+import trap_AAS_AreaLava
+import trap_AAS_AreaLiquid
+import trap_AAS_AreaSwim
+import trap_AAS_AreaCrouch
+import trap_AAS_AreaGroundFaceArea
+import trap_AAS_NextModelReachability
+import trap_AAS_BestReachableFromJumpPadArea
+import trap_AAS_BestReachableArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_TracePlayerBBox
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_FloodAreas
+import trap_AAS_ShowReachableAreas
+import trap_AAS_ShowReachability
+import trap_AAS_DrawArrow
+import trap_AAS_PrintTravelType
+import trap_AAS_DrawCross
+import trap_AAS_ShowAreaPolygons
+import trap_AAS_ShowArea
+import trap_AAS_ShowFace
+import trap_AAS_ShowBoundingBox
+import trap_AAS_DrawPlaneCross
+import trap_AAS_DrawPermanentCross
+import trap_AAS_PermanentLine
+import trap_AAS_DebugLine
+import trap_AAS_ClearShownPolygons
+import trap_AAS_ClearShownDebugLines
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_Loaded
+import trap_AAS_PointInsideArea
+import trap_AAS_BBoxReachabilityAreas
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_RegisterModel
+import trap_DebugPolygonDelete
+import trap_DebugPolygonShow
+import trap_DebugPolygonCreate
+import trap_ClientCommand
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_ClipToEntitiesCapsule
+import trap_ClipToEntities
+import trap_TraceCapsule
+import trap_Trace
+import trap_GetBrushBounds
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_SetConfigstringRestrictions
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommandEx
+import trap_DropPlayer
+import trap_SetNetFields
+import trap_LocateGameData
+import Pickup_Team
+import Svcmd_TeamInfoStats_f
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_BuildLocationTree
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotWeightBench_f
+import Svcmd_BotThinkReport_f
+import Svcmd_BotMatchBench_f
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownPlayer
+import BotAISetupPlayer
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import G_BotInitBotLib
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBotComplete
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunPlayer
+import PlayerEndFrame
+import PlayerThink
+import PlayerHandicap
+import ClientCommand
+import PlayerBegin
+import PlayerDisconnect
+import PlayerUserinfoChanged
+import PlayerConnect
+import G_Error
+import G_Printf
+import G_DPrintf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MovePlayerToIntermission
+import StringIsInteger
+import ConcatArgs
+import G_ScoreboardChanged
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import G_RegisterCommands
+import G_ConsoleCompleteArgument
+import G_ConsoleCommand
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import PlayerSpawn
+import InitBodyQue
+import BeginIntermission
+import PlayerRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetPlayerViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossPlayerCubes
+import TossPlayerGametypeItems
+import TossPlayerItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_SetBrushModel
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import trap_SendServerCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import FinishSpawningItem
+import G_SpawnItem
+import LaunchItem
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1761
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1736
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 0
+align 1
+LABELV $1726
+byte 1 40
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 41
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1704
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1678
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 0
+align 1
+LABELV $1646
+byte 1 115
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 44
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 10
+byte 1 0
+align 1
+LABELV $1638
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1630
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1621
+byte 1 10
+byte 1 0
+align 1
+LABELV $1619
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 0
+align 1
+LABELV $1574
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 98
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1564
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $1544
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 116
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $1515
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1421
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1352
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $1180
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 70
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 66
+byte 1 111
+byte 1 98
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 69
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $290
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $287
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $284
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $281
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $278
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 98
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $275
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $268
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $265
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $230
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $66
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
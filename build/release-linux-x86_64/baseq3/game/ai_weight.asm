@@ -0,0 +1,6229 @@
+export ReadValue
+code
+proc ReadValue 1052 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1040
+ADDRGP4 PC_ExpectAnyToken
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $63
+CNSTI4 0
+RETI4
+ADDRGP4 $62
+JUMPV
+LABELV $63
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $68
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $65
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $69
+ARGP4
+ADDRGP4 PC_SourceWarning
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 PC_ExpectAnyToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $70
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $72
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $62
+JUMPV
+LABELV $70
+LABELV $65
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+EQI4 $73
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $75
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $62
+JUMPV
+LABELV $73
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+12
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $62
+endproc ReadValue 1052 12
+export ReadFuzzyWeight
+proc ReadFuzzyWeight 32 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $81
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_CheckTokenString
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $79
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $84
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $82
+CNSTI4 0
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $82
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 ReadValue
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $85
+CNSTI4 0
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $85
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $89
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $87
+CNSTI4 0
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $87
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 ReadValue
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $90
+CNSTI4 0
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $90
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $89
+ARGP4
+ADDRLP4 20
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $92
+CNSTI4 0
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $92
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 ReadValue
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $94
+CNSTI4 0
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $94
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $98
+ARGP4
+ADDRLP4 28
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $80
+CNSTI4 0
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $79
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 ReadValue
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $99
+CNSTI4 0
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $99
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $80
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $103
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $101
+CNSTI4 0
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $101
+CNSTI4 1
+RETI4
+LABELV $78
+endproc ReadFuzzyWeight 32 8
+export FreeFuzzySeperators_r
+proc FreeFuzzySeperators_r 0 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $105
+ADDRGP4 $104
+JUMPV
+LABELV $105
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $107
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 FreeFuzzySeperators_r
+CALLV
+pop
+LABELV $107
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $109
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 FreeFuzzySeperators_r
+CALLV
+pop
+LABELV $109
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+LABELV $104
+endproc FreeFuzzySeperators_r 0 4
+export FreeWeightConfig2
+proc FreeWeightConfig2 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $115
+JUMPV
+LABELV $112
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 FreeFuzzySeperators_r
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $116
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+LABELV $116
+LABELV $113
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $115
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+LTI4 $112
+ADDRFP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $118
+ADDRFP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+LABELV $118
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+LABELV $111
+endproc FreeWeightConfig2 8 4
+export FreeWeightConfig
+proc FreeWeightConfig 0 4
+ADDRGP4 bot_reloadcharacters+12
+INDIRI4
+CNSTI4 0
+NEI4 $121
+ADDRGP4 $120
+JUMPV
+LABELV $121
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FreeWeightConfig2
+CALLV
+pop
+LABELV $120
+endproc FreeWeightConfig 0 4
+export ReadFuzzySeperators_r
+proc ReadFuzzySeperators_r 1132 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+CNSTI4 0
+ASGNI4
+ADDRLP4 1068
+CNSTP4 0
+ASGNP4
+ADDRLP4 1048
+ADDRLP4 1068
+INDIRP4
+ASGNP4
+ADDRLP4 1052
+ADDRLP4 1068
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $84
+ARGP4
+ADDRLP4 1072
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $125
+CNSTP4 0
+RETP4
+ADDRGP4 $124
+JUMPV
+LABELV $125
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+CNSTI4 4096
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_ExpectTokenType
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $127
+CNSTP4 0
+RETP4
+ADDRGP4 $124
+JUMPV
+LABELV $127
+ADDRLP4 1064
+ADDRLP4 0+8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $98
+ARGP4
+ADDRLP4 1080
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $130
+CNSTP4 0
+RETP4
+ADDRGP4 $124
+JUMPV
+LABELV $130
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 1084
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $132
+CNSTP4 0
+RETP4
+ADDRGP4 $124
+JUMPV
+LABELV $132
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1088
+ADDRGP4 PC_ExpectAnyToken
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $135
+CNSTP4 0
+RETP4
+ADDRGP4 $124
+JUMPV
+LABELV $135
+LABELV $137
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $141
+ARGP4
+ADDRLP4 1096
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+NEI4 $143
+ADDRLP4 1092
+CNSTI4 1
+ASGNI4
+ADDRGP4 $144
+JUMPV
+LABELV $143
+ADDRLP4 1092
+CNSTI4 0
+ASGNI4
+LABELV $144
+ADDRLP4 1044
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $149
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $148
+ARGP4
+ADDRLP4 1100
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $145
+LABELV $149
+CNSTI4 32
+ARGI4
+ADDRLP4 1104
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1104
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $150
+ADDRLP4 1052
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRGP4 $151
+JUMPV
+LABELV $150
+ADDRLP4 1048
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+LABELV $151
+ADDRLP4 1052
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $152
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $154
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 FreeFuzzySeperators_r
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $124
+JUMPV
+LABELV $154
+ADDRLP4 1040
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 999999
+ASGNI4
+ADDRLP4 1060
+CNSTI4 1
+ASGNI4
+ADDRGP4 $153
+JUMPV
+LABELV $152
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+CNSTI4 4096
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1108
+ADDRGP4 PC_ExpectTokenType
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $157
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 FreeFuzzySeperators_r
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $124
+JUMPV
+LABELV $157
+ADDRLP4 1040
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0+8
+INDIRI4
+ASGNI4
+LABELV $153
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRLP4 1108
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+EQI4 $163
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1112
+ADDRGP4 PC_ExpectAnyToken
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $160
+LABELV $163
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 FreeFuzzySeperators_r
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $124
+JUMPV
+LABELV $160
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 1116
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $164
+ADDRLP4 1056
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1120
+ADDRGP4 PC_ExpectAnyToken
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $167
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 FreeFuzzySeperators_r
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $124
+JUMPV
+LABELV $167
+LABELV $164
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $172
+ARGP4
+ADDRLP4 1120
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $169
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1124
+ADDRGP4 ReadFuzzyWeight
+CALLI4
+ASGNI4
+ADDRLP4 1124
+INDIRI4
+CNSTI4 0
+NEI4 $170
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 FreeFuzzySeperators_r
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $124
+JUMPV
+LABELV $169
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $178
+ARGP4
+ADDRLP4 1124
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1124
+INDIRI4
+CNSTI4 0
+NEI4 $175
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1128
+ADDRGP4 ReadFuzzySeperators_r
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 1128
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $176
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 FreeFuzzySeperators_r
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $124
+JUMPV
+LABELV $175
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $181
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $124
+JUMPV
+LABELV $176
+LABELV $170
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $146
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $187
+ARGP4
+ADDRLP4 1128
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+CNSTI4 0
+NEI4 $146
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 FreeFuzzySeperators_r
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $124
+JUMPV
+LABELV $145
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 FreeFuzzySeperators_r
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $181
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $124
+JUMPV
+LABELV $146
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1104
+ADDRGP4 PC_ExpectAnyToken
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $189
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 FreeFuzzySeperators_r
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $124
+JUMPV
+LABELV $189
+LABELV $138
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $187
+ARGP4
+ADDRLP4 1092
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $137
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $192
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $194
+ARGP4
+ADDRGP4 PC_SourceWarning
+CALLV
+pop
+CNSTI4 32
+ARGI4
+ADDRLP4 1096
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1096
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 999999
+ASGNI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $195
+ADDRLP4 1052
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRGP4 $196
+JUMPV
+LABELV $195
+ADDRLP4 1048
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+LABELV $196
+LABELV $192
+ADDRLP4 1048
+INDIRP4
+RETP4
+LABELV $124
+endproc ReadFuzzySeperators_r 1132 16
+export ReadWeightConfig
+proc ReadWeightConfig 1136 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1060
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 1068
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRGP4 bot_reloadcharacters+12
+INDIRI4
+CNSTI4 0
+NEI4 $198
+ADDRLP4 1060
+CNSTI4 -1
+ASGNI4
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+LABELV $201
+ADDRLP4 0
+ADDRLP4 1052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 weightFileList
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $205
+ADDRLP4 1060
+INDIRI4
+CNSTI4 -1
+NEI4 $202
+ADDRLP4 1060
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRGP4 $202
+JUMPV
+LABELV $205
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1028
+ADDP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $209
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $197
+JUMPV
+LABELV $209
+LABELV $202
+ADDRLP4 1052
+ADDRLP4 1052
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 128
+LTI4 $201
+ADDRLP4 1060
+INDIRI4
+CNSTI4 -1
+NEI4 $211
+CNSTI4 3
+ARGI4
+ADDRGP4 $213
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $197
+JUMPV
+LABELV $211
+LABELV $198
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $214
+ARGP4
+ADDRLP4 1072
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $215
+CNSTI4 3
+ARGI4
+ADDRGP4 $217
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $197
+JUMPV
+LABELV $215
+CNSTI4 1612
+ARGI4
+ADDRLP4 1076
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1076
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1092
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1028
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $219
+JUMPV
+LABELV $218
+ADDRLP4 4+16
+ARGP4
+ADDRGP4 $224
+ARGP4
+ADDRLP4 1080
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $221
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 128
+LTI4 $225
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 $227
+ARGP4
+ADDRGP4 PC_SourceWarning
+CALLV
+pop
+ADDRGP4 $220
+JUMPV
+LABELV $225
+ADDRLP4 1044
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1084
+ADDRGP4 PC_ExpectTokenType
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $228
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FreeWeightConfig
+CALLV
+pop
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $197
+JUMPV
+LABELV $228
+ADDRLP4 4+16
+ARGP4
+ADDRLP4 1088
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1088
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 1092
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ADDRLP4 1092
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4+16
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1104
+ADDRGP4 PC_ExpectAnyToken
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $232
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FreeWeightConfig
+CALLV
+pop
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $197
+JUMPV
+LABELV $232
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+ADDRLP4 4+16
+ARGP4
+ADDRGP4 $134
+ARGP4
+ADDRLP4 1108
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $234
+ADDRLP4 1056
+CNSTI4 1
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1112
+ADDRGP4 PC_ExpectAnyToken
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $237
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FreeWeightConfig
+CALLV
+pop
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $197
+JUMPV
+LABELV $237
+LABELV $234
+ADDRLP4 4+16
+ARGP4
+ADDRGP4 $178
+ARGP4
+ADDRLP4 1112
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $239
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRLP4 1116
+ADDRGP4 ReadFuzzySeperators_r
+CALLP4
+ASGNP4
+ADDRLP4 1048
+ADDRLP4 1116
+INDIRP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $242
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FreeWeightConfig
+CALLV
+pop
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $197
+JUMPV
+LABELV $242
+ADDRLP4 1124
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1124
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 1124
+INDIRI4
+ADDP4
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+ADDRGP4 $240
+JUMPV
+LABELV $239
+ADDRLP4 4+16
+ARGP4
+ADDRGP4 $172
+ARGP4
+ADDRLP4 1116
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $244
+CNSTI4 32
+ARGI4
+ADDRLP4 1120
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 1048
+ADDRLP4 1120
+INDIRP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 1048
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 999999
+ASGNI4
+ADDRLP4 1048
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRLP4 1124
+ADDRGP4 ReadFuzzyWeight
+CALLI4
+ASGNI4
+ADDRLP4 1124
+INDIRI4
+CNSTI4 0
+NEI4 $247
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FreeWeightConfig
+CALLV
+pop
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $197
+JUMPV
+LABELV $247
+ADDRLP4 1132
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 1132
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 1132
+INDIRI4
+ADDP4
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+ADDRGP4 $245
+JUMPV
+LABELV $244
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 $181
+ARGP4
+ADDRLP4 4+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FreeWeightConfig
+CALLV
+pop
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $197
+JUMPV
+LABELV $245
+LABELV $240
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $250
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 $187
+ARGP4
+ADDRLP4 1120
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $252
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FreeWeightConfig
+CALLV
+pop
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $197
+JUMPV
+LABELV $252
+LABELV $250
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $222
+JUMPV
+LABELV $221
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 $181
+ARGP4
+ADDRLP4 4+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FreeWeightConfig
+CALLV
+pop
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $197
+JUMPV
+LABELV $222
+LABELV $219
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1080
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $218
+LABELV $220
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CompileWeightConfig
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 $255
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 1084
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRGP4 $256
+ARGP4
+ADDRLP4 1084
+INDIRI4
+ADDRLP4 1064
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 bot_reloadcharacters+12
+INDIRI4
+CNSTI4 0
+NEI4 $257
+ADDRLP4 1060
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 weightFileList
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $257
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $197
+endproc ReadWeightConfig 1136 16
+export NumFuzzySeperators_r
+proc NumFuzzySeperators_r 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $264
+JUMPV
+LABELV $261
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $265
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 NumFuzzySeperators_r
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $265
+LABELV $262
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $264
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $261
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $260
+endproc NumFuzzySeperators_r 8 4
+export CompileFuzzySeperators_r
+proc CompileFuzzySeperators_r 24 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $271
+JUMPV
+LABELV $268
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 28
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $273
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $274
+JUMPV
+LABELV $273
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $274
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $269
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $271
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $268
+ADDRLP4 4
+CNSTI4 28
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $278
+JUMPV
+LABELV $275
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $279
+ADDRGP4 $276
+JUMPV
+LABELV $279
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CompileFuzzySeperators_r
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $276
+ADDRLP4 12
+CNSTI4 28
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $278
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $275
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $267
+endproc CompileFuzzySeperators_r 24 12
+export CompileWeightConfig
+proc CompileWeightConfig 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $285
+JUMPV
+LABELV $282
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 NumFuzzySeperators_r
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $283
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $285
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+LTI4 $282
+ADDRFP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $286
+ADDRFP4 0
+INDIRP4
+CNSTI4 1092
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $286
+ADDRFP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $286
+ADDRFP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $288
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $288
+CNSTU4 28
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRLP4 16
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $288
+ADDRFP4 0
+INDIRP4
+CNSTI4 1092
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $293
+JUMPV
+LABELV $290
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $294
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1100
+ADDP4
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $291
+JUMPV
+LABELV $294
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1100
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CompileFuzzySeperators_r
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $291
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $293
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+LTI4 $290
+LABELV $281
+endproc CompileWeightConfig 36 12
+export FindFuzzyWeight
+proc FindFuzzyWeight 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $300
+JUMPV
+LABELV $297
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $301
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $296
+JUMPV
+LABELV $301
+LABELV $298
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $300
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+LTI4 $297
+CNSTI4 -1
+RETI4
+LABELV $296
+endproc FindFuzzyWeight 8 8
+export FuzzyWeight_r
+proc FuzzyWeight_r 44 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+GEI4 $304
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $306
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 FuzzyWeight_r
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+RETF4
+ADDRGP4 $303
+JUMPV
+LABELV $306
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+RETF4
+ADDRGP4 $303
+JUMPV
+LABELV $304
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $308
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+GEI4 $310
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $312
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 FuzzyWeight_r
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $313
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $314
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 FuzzyWeight_r
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $315
+JUMPV
+LABELV $314
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $315
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 999999
+NEI4 $316
+ADDRLP4 4
+INDIRF4
+RETF4
+ADDRGP4 $303
+JUMPV
+LABELV $316
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 0
+INDIRF4
+ASGNF4
+CNSTF4 1065353216
+ADDRLP4 40
+INDIRF4
+SUBF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+RETF4
+ADDRGP4 $303
+JUMPV
+LABELV $310
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 FuzzyWeight_r
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+RETF4
+ADDRGP4 $303
+JUMPV
+LABELV $308
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+RETF4
+LABELV $303
+endproc FuzzyWeight_r 44 8
+export FuzzyWeightNodes
+proc FuzzyWeightNodes 836 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $319
+CNSTF4 0
+RETF4
+ADDRGP4 $318
+JUMPV
+LABELV $319
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 36
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 548
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 292
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $322
+JUMPV
+LABELV $321
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 804
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 804
+INDIRI4
+ADDRLP4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 804
+INDIRI4
+ADDRLP4 548
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 804
+INDIRI4
+ADDRLP4 292
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $325
+JUMPV
+LABELV $324
+ADDRLP4 0
+CNSTI4 28
+ADDRLP4 32
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+GEI4 $327
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $329
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $325
+JUMPV
+LABELV $329
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $331
+ADDRLP4 812
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 812
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $332
+JUMPV
+LABELV $331
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $332
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $326
+JUMPV
+LABELV $327
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $333
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $326
+JUMPV
+LABELV $333
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $335
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $325
+JUMPV
+LABELV $335
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 999999
+NEI4 $337
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $339
+ADDRLP4 32
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $325
+JUMPV
+LABELV $339
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $341
+ADDRLP4 812
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 812
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $342
+JUMPV
+LABELV $341
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $342
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $326
+JUMPV
+LABELV $337
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+CNSTI4 64
+LEI4 $343
+CNSTI4 3
+ARGI4
+ADDRGP4 $345
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $326
+JUMPV
+LABELV $343
+ADDRLP4 812
+CNSTI4 4
+ASGNI4
+ADDRLP4 816
+ADDRLP4 0
+INDIRP4
+ADDRLP4 812
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ADDRLP4 816
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 812
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 816
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $346
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 36
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 548
+ADDP4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 292
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $347
+JUMPV
+LABELV $346
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $349
+ADDRLP4 828
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 824
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 828
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $350
+JUMPV
+LABELV $349
+ADDRLP4 824
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $350
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 824
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $347
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $351
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 36
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 548
+ADDP4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 12
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 292
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $326
+JUMPV
+LABELV $351
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $354
+ADDRLP4 828
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 824
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 828
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $355
+JUMPV
+LABELV $354
+ADDRLP4 824
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $355
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 12
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 824
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $326
+JUMPV
+LABELV $325
+ADDRGP4 $324
+JUMPV
+LABELV $326
+LABELV $322
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $321
+ADDRLP4 28
+INDIRF4
+RETF4
+LABELV $318
+endproc FuzzyWeightNodes 836 8
+export FuzzyWeight
+proc FuzzyWeight 8 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1100
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 FuzzyWeightNodes
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+RETF4
+LABELV $356
+endproc FuzzyWeight 8 16
+export FuzzyWeightUndecided
+proc FuzzyWeightUndecided 8 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1100
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 FuzzyWeightNodes
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+RETF4
+LABELV $357
+endproc FuzzyWeightUndecided 8 16
+export FuzzyWeights
+proc FuzzyWeights 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $362
+JUMPV
+LABELV $359
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1096
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1100
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 FuzzyWeightNodes
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $360
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $362
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+LTI4 $359
+LABELV $358
+endproc FuzzyWeights 16 16
+export FuzzyWeightTree
+proc FuzzyWeightTree 12 8
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $364
+CNSTF4 0
+RETF4
+ADDRGP4 $363
+JUMPV
+LABELV $364
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 FuzzyWeight_r
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+RETF4
+LABELV $363
+endproc FuzzyWeightTree 12 8
+export EvolveFuzzySeperator_r
+proc EvolveFuzzySeperator_r 44 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $367
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 EvolveFuzzySeperator_r
+CALLV
+pop
+ADDRGP4 $368
+JUMPV
+LABELV $367
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $369
+ADDRLP4 0
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1008981770
+GEF4 $371
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 4
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $372
+JUMPV
+LABELV $371
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1056964608
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $372
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+GEF4 $373
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $374
+JUMPV
+LABELV $373
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+LEF4 $375
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $375
+LABELV $374
+LABELV $369
+LABELV $368
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $377
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 EvolveFuzzySeperator_r
+CALLV
+pop
+LABELV $377
+LABELV $366
+endproc EvolveFuzzySeperator_r 44 4
+export EvolveWeightConfig
+proc EvolveWeightConfig 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $383
+JUMPV
+LABELV $380
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 EvolveFuzzySeperator_r
+CALLV
+pop
+LABELV $381
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $383
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+LTI4 $380
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CompileWeightConfig
+CALLV
+pop
+LABELV $379
+endproc EvolveWeightConfig 8 4
+export ScaleFuzzySeperator_r
+proc ScaleFuzzySeperator_r 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $385
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 ScaleFuzzySeperator_r
+CALLV
+pop
+ADDRGP4 $386
+JUMPV
+LABELV $385
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $387
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+GEF4 $389
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $390
+JUMPV
+LABELV $389
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+LEF4 $391
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $391
+LABELV $390
+LABELV $387
+LABELV $386
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $393
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 ScaleFuzzySeperator_r
+CALLV
+pop
+LABELV $393
+LABELV $384
+endproc ScaleFuzzySeperator_r 20 8
+export ScaleWeight
+proc ScaleWeight 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $396
+ADDRFP4 8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $397
+JUMPV
+LABELV $396
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+LEF4 $398
+ADDRFP4 8
+CNSTF4 1065353216
+ASGNF4
+LABELV $398
+LABELV $397
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $403
+JUMPV
+LABELV $400
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $404
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRGP4 ScaleFuzzySeperator_r
+CALLV
+pop
+ADDRGP4 $402
+JUMPV
+LABELV $404
+LABELV $401
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $403
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+LTI4 $400
+LABELV $402
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CompileWeightConfig
+CALLV
+pop
+LABELV $395
+endproc ScaleWeight 12 8
+export ScaleFuzzySeperatorBalanceRange_r
+proc ScaleFuzzySeperatorBalanceRange_r 32 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $407
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 ScaleFuzzySeperatorBalanceRange_r
+CALLV
+pop
+ADDRGP4 $408
+JUMPV
+LABELV $407
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $409
+ADDRLP4 0
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+GEF4 $411
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $411
+LABELV $409
+LABELV $408
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $413
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 ScaleFuzzySeperatorBalanceRange_r
+CALLV
+pop
+LABELV $413
+LABELV $406
+endproc ScaleFuzzySeperatorBalanceRange_r 32 8
+export ScaleFuzzyBalanceRange
+proc ScaleFuzzyBalanceRange 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+CNSTF4 0
+GEF4 $416
+ADDRFP4 4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $417
+JUMPV
+LABELV $416
+ADDRFP4 4
+INDIRF4
+CNSTF4 1120403456
+LEF4 $418
+ADDRFP4 4
+CNSTF4 1120403456
+ASGNF4
+LABELV $418
+LABELV $417
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $423
+JUMPV
+LABELV $420
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 ScaleFuzzySeperatorBalanceRange_r
+CALLV
+pop
+LABELV $421
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $423
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+LTI4 $420
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CompileWeightConfig
+CALLV
+pop
+LABELV $415
+endproc ScaleFuzzyBalanceRange 8 8
+export InterbreedFuzzySeperator_r
+proc InterbreedFuzzySeperator_r 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $425
+ADDRLP4 0
+CNSTI4 24
+ASGNI4
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $429
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+NEU4 $427
+LABELV $429
+CNSTI4 3
+ARGI4
+ADDRGP4 $430
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $424
+JUMPV
+LABELV $427
+ADDRLP4 8
+CNSTI4 24
+ASGNI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 InterbreedFuzzySeperator_r
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $426
+CNSTI4 0
+RETI4
+ADDRGP4 $424
+JUMPV
+LABELV $425
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $433
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $437
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $435
+LABELV $437
+CNSTI4 3
+ARGI4
+ADDRGP4 $438
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $424
+JUMPV
+LABELV $435
+ADDRLP4 8
+CNSTI4 12
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+LEF4 $439
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $439
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+LEF4 $441
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $441
+LABELV $433
+LABELV $426
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $443
+ADDRLP4 0
+CNSTI4 28
+ASGNI4
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $447
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+NEU4 $445
+LABELV $447
+CNSTI4 3
+ARGI4
+ADDRGP4 $448
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $424
+JUMPV
+LABELV $445
+ADDRLP4 8
+CNSTI4 28
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 InterbreedFuzzySeperator_r
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $449
+CNSTI4 0
+RETI4
+ADDRGP4 $424
+JUMPV
+LABELV $449
+LABELV $443
+CNSTI4 1
+RETI4
+LABELV $424
+endproc InterbreedFuzzySeperator_r 28 12
+export InterbreedWeightConfigs
+proc InterbreedWeightConfigs 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+NEI4 $454
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+EQI4 $452
+LABELV $454
+CNSTI4 3
+ARGI4
+ADDRGP4 $455
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $451
+JUMPV
+LABELV $452
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $459
+JUMPV
+LABELV $456
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 InterbreedFuzzySeperator_r
+CALLI4
+pop
+LABELV $457
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $459
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+LTI4 $456
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CompileWeightConfig
+CALLV
+pop
+LABELV $451
+endproc InterbreedWeightConfigs 16 12
+export BotShutdownWeights
+proc BotShutdownWeights 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $461
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 weightFileList
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $465
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 weightFileList
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 FreeWeightConfig2
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 weightFileList
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $465
+LABELV $462
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $461
+LABELV $460
+endproc BotShutdownWeights 4 4
+bss
+export weightFileList
+align 4
+LABELV weightFileList
+skip 512
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotTeamAI
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import ctf_blueflag
+import ctf_redflag
+import bot_offhandgrapple
+import bot_droppedweight
+import bot_challenge
+import bot_testrchat
+import bot_testichat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxplayers
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import PlayerOnSameTeamFromName
+import PlayerFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckBlockedTeammates
+import BotCheckAttack
+import BotAimAtEnemy
+import BotVisibilityStats
+import BotEndVisibilityFrame
+import BotBeginVisibilityFrame
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotCountTeamMates
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import BotCanCamp
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanGrapple
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import EasyPlayerName
+import PlayerName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityIsShooting
+import SenseCarriesCubes
+import SenseIsInvisible
+import EntityIsInvisible
+import PowerupsCarryFlag
+import PlayerCarriesFlag
+import PlayerIsDead
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotPlayerStateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import bot_reloadcharacters
+import bot_showteamgoals
+import bot_shownodechanges
+import bot_developer
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetPlayerState
+import BotAI_DebugLineShow
+import BotAI_DebugLineDelete
+import BotAI_DebugLineCreate
+import BotAI_InPVS
+import BotAI_PointContents
+import BotAI_EntityTrace
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotLibVarGetValue
+import BotNextEntity
+import BotSense
+import BotEntityInfo
+import NumBots
+import BotResetState
+import ScaleBalanceRange
+import WriteWeightConfig
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotInitPhysicsSettings
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotRoutingAreaChanged
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotPrepareItemWeights
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotMatchTemplatesContainsString
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatchLinear
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import GetBotLibAPI
+import g_instagib
+import g_playerCapsule
+import g_proxMineTimeout
+import g_singlePlayer
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGamePlayers
+import g_maxplayers
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import trap_AAS_DropToFloor
+import trap_AAS_HorizontalVelocityForJump
+import trap_AAS_AgainstLadder
+import trap_AAS_JumpReachRunStart
+import trap_AAS_Swimming
+import trap_AAS_OnGround
+import trap_AAS_PredictPlayerMovement
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaTravelTime
+import trap_AAS_EnableRoutingArea
+import trap_AAS_RandomGoalArea
+import trap_AAS_ReachabilityFromNum
+import trap_AAS_NextAreaReachability
+import trap_AAS_AreaContentsTravelFlags
+import trap_AAS_TravelFlagForType
+import trap_AAS_AreaDoNotEnter
+import trap_AAS_AreaJumpPad
+import trap_AAS_AreaLadder
+import trap_AAS_AreaGrounded
+import trap_AAS_AreaSlime
+import trap_AAS_AreaLava
+import trap_AAS_AreaLiquid
+import trap_AAS_AreaSwim
+import trap_AAS_AreaCrouch
+import trap_AAS_AreaGroundFaceArea
+import trap_AAS_NextModelReachability
+import trap_AAS_BestReachableFromJumpPadArea
+import trap_AAS_BestReachableArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_TracePlayerBBox
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_FloodAreas
+import trap_AAS_ShowReachableAreas
+import trap_AAS_ShowReachability
+import trap_AAS_DrawArrow
+import trap_AAS_PrintTravelType
+import trap_AAS_DrawCross
+import trap_AAS_ShowAreaPolygons
+import trap_AAS_ShowArea
+import trap_AAS_ShowFace
+import trap_AAS_ShowBoundingBox
+import trap_AAS_DrawPlaneCross
+import trap_AAS_DrawPermanentCross
+import trap_AAS_PermanentLine
+import trap_AAS_DebugLine
+import trap_AAS_ClearShownPolygons
+import trap_AAS_ClearShownDebugLines
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_Loaded
+import trap_AAS_PointInsideArea
+import trap_AAS_BBoxReachabilityAreas
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_RegisterModel
+import trap_DebugPolygonDelete
+import trap_DebugPolygonShow
+import trap_DebugPolygonCreate
+import trap_ClientCommand
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_ClipToEntitiesCapsule
+import trap_ClipToEntities
+import trap_TraceCapsule
+import trap_Trace
+import trap_GetBrushBounds
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_SetConfigstringRestrictions
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommandEx
+import trap_DropPlayer
+import trap_SetNetFields
+import trap_LocateGameData
+import Pickup_Team
+import Svcmd_TeamInfoStats_f
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_BuildLocationTree
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotWeightBench_f
+import Svcmd_BotThinkReport_f
+import Svcmd_BotMatchBench_f
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownPlayer
+import BotAISetupPlayer
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import G_BotInitBotLib
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBotComplete
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunPlayer
+import PlayerEndFrame
+import PlayerThink
+import PlayerHandicap
+import ClientCommand
+import PlayerBegin
+import PlayerDisconnect
+import PlayerUserinfoChanged
+import PlayerConnect
+import G_Error
+import G_Printf
+import G_DPrintf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MovePlayerToIntermission
+import StringIsInteger
+import ConcatArgs
+import G_ScoreboardChanged
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import G_RegisterCommands
+import G_ConsoleCompleteArgument
+import G_ConsoleCommand
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import PlayerSpawn
+import InitBodyQue
+import BeginIntermission
+import PlayerRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetPlayerViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossPlayerCubes
+import TossPlayerGametypeItems
+import TossPlayerItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_SetBrushModel
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import trap_SendServerCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import FinishSpawningItem
+import G_SpawnItem
+import LaunchItem
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $455
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 119
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $448
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $438
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $430
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 101
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $345
+byte 1 102
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $256
+byte 1 119
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 10
+byte 1 0
+align 1
+LABELV $255
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $227
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $224
+byte 1 119
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $217
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $214
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $213
+byte 1 119
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $194
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $187
+byte 1 125
+byte 1 0
+align 1
+LABELV $181
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $178
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $172
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 0
+align 1
+LABELV $162
+byte 1 58
+byte 1 0
+align 1
+LABELV $156
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $148
+byte 1 99
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $141
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $134
+byte 1 123
+byte 1 0
+align 1
+LABELV $103
+byte 1 59
+byte 1 0
+align 1
+LABELV $98
+byte 1 41
+byte 1 0
+align 1
+LABELV $89
+byte 1 44
+byte 1 0
+align 1
+LABELV $84
+byte 1 40
+byte 1 0
+align 1
+LABELV $81
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $75
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $72
+byte 1 77
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $69
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 0
+align 1
+LABELV $68
+byte 1 45
+byte 1 0
@@ -0,0 +1,4797 @@
+export P_DamageFeedback
+code
+proc P_DamageFeedback 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $61
+ADDRGP4 $60
+JUMPV
+LABELV $61
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1436
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1432
+ADDP4
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $63
+ADDRGP4 $60
+JUMPV
+LABELV $63
+ADDRLP4 4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $65
+ADDRLP4 4
+CNSTF4 1132396544
+ASGNF4
+LABELV $65
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $67
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1456
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $68
+JUMPV
+LABELV $67
+ADDRLP4 0
+INDIRP4
+CNSTI4 1444
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+CNSTF4 1132462080
+ADDRLP4 8
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+CNSTF4 1132462080
+ADDRLP4 8+4
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $68
+ADDRGP4 level+40
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+LEI4 $70
+ADDRFP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $70
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 700
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 55
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $70
+ADDRLP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1436
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1432
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1440
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $60
+endproc P_DamageFeedback 36 12
+export P_WorldEffects
+proc P_WorldEffects 36 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $75
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1500
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 12000
+ADDI4
+ASGNI4
+ADDRGP4 $74
+JUMPV
+LABELV $75
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRI4
+ADDRGP4 level+40
+INDIRI4
+LEI4 $80
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $81
+JUMPV
+LABELV $80
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $81
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $82
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $84
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1500
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+LABELV $84
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1500
+ADDP4
+INDIRI4
+ADDRGP4 level+40
+INDIRI4
+GEI4 $83
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1500
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $83
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+CNSTI4 15
+LEI4 $92
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+CNSTI4 15
+ASGNI4
+LABELV $92
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTI4 14
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRGP4 $83
+JUMPV
+LABELV $82
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1500
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 12000
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $83
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $96
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRI4
+CNSTI4 24
+BANDI4
+ADDRLP4 16
+INDIRI4
+EQI4 $96
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $98
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRGP4 level+40
+INDIRI4
+GTI4 $98
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $101
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 61
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 $102
+JUMPV
+LABELV $101
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $103
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 30
+ADDRLP4 0
+INDIRI4
+MULI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $103
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $105
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 10
+ADDRLP4 0
+INDIRI4
+MULI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 15
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $105
+LABELV $102
+LABELV $98
+LABELV $96
+LABELV $74
+endproc P_WorldEffects 36 32
+export G_SetPlayerSound
+proc G_SetPlayerSound 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $108
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRI4
+CNSTI4 24
+BANDI4
+ADDRLP4 4
+INDIRI4
+EQI4 $108
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 480
+ADDP4
+ADDRGP4 level+360
+INDIRI4
+ASGNI4
+ADDRGP4 $109
+JUMPV
+LABELV $108
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $109
+LABELV $107
+endproc G_SetPlayerSound 8 0
+export PlayerImpacts
+proc PlayerImpacts 88 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 64
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $115
+JUMPV
+LABELV $112
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $119
+JUMPV
+LABELV $116
+ADDRLP4 76
+CNSTI4 2
+ASGNI4
+ADDRLP4 80
+ADDRFP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LSHI4
+ADDRLP4 80
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LSHI4
+ADDRLP4 80
+INDIRP4
+ADDP4
+INDIRI4
+NEI4 $120
+ADDRGP4 $118
+JUMPV
+LABELV $120
+LABELV $117
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $119
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $116
+LABELV $118
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $122
+ADDRGP4 $113
+JUMPV
+LABELV $122
+ADDRLP4 8
+CNSTI4 720
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 80
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $124
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $124
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $124
+ADDRLP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $126
+ADDRGP4 $113
+JUMPV
+LABELV $126
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $113
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $115
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+LTI4 $112
+LABELV $111
+endproc PlayerImpacts 88 12
+data
+align 4
+LABELV $129
+byte 4 1109393408
+byte 4 1109393408
+byte 4 1112539136
+export G_TouchTriggers
+code
+proc G_TouchTriggers 16540 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $130
+ADDRGP4 $128
+JUMPV
+LABELV $130
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $132
+ADDRGP4 $128
+JUMPV
+LABELV $132
+ADDRLP4 16484
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 16484
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 $129
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 16484
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 $129+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 72+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRGP4 $129+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16488
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 16488
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 $129
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 16488
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 $129+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRGP4 $129+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 100
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRLP4 16492
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 16492
+INDIRI4
+ASGNI4
+ADDRLP4 16500
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 16500
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 72+4
+ADDRLP4 16500
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 72+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16512
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 16512
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 16512
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $149
+JUMPV
+LABELV $146
+ADDRLP4 0
+CNSTI4 720
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 100
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 16520
+CNSTI4 516
+ASGNI4
+ADDRLP4 16524
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16520
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 16524
+INDIRU4
+NEU4 $150
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16520
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 16524
+INDIRU4
+NEU4 $150
+ADDRGP4 $147
+JUMPV
+LABELV $150
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 1073741824
+BANDI4
+CNSTI4 0
+NEI4 $152
+ADDRGP4 $147
+JUMPV
+LABELV $152
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $154
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 9
+EQI4 $156
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 Touch_DoorTrigger
+CVPU4 4
+EQU4 $156
+ADDRGP4 $147
+JUMPV
+LABELV $156
+LABELV $154
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $158
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+ADDRGP4 level+40
+INDIRI4
+ARGI4
+ADDRLP4 16528
+ADDRGP4 BG_PlayerTouchesItem
+CALLI4
+ASGNI4
+ADDRLP4 16528
+INDIRI4
+CNSTI4 0
+NEI4 $159
+ADDRGP4 $147
+JUMPV
+LABELV $158
+ADDRLP4 72
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16528
+ADDRGP4 trap_EntityContact
+CALLI4
+ASGNI4
+ADDRLP4 16528
+INDIRI4
+CNSTI4 0
+NEI4 $163
+ADDRGP4 $147
+JUMPV
+LABELV $163
+LABELV $159
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 64
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $165
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $165
+ADDRLP4 16532
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16532
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 16532
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $167
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $167
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $167
+LABELV $147
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $149
+ADDRLP4 4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LTI4 $146
+ADDRLP4 16520
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16520
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRI4
+ADDRLP4 16520
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+EQI4 $169
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 492
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $169
+LABELV $128
+endproc G_TouchTriggers 16540 16
+export SpectatorThink
+proc SpectatorThink 240 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $174
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $172
+LABELV $174
+ADDRLP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $175
+ADDRLP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $177
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $176
+JUMPV
+LABELV $177
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $176
+JUMPV
+LABELV $175
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 4
+ASGNI4
+LABELV $176
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 400
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 216
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 28
+ADDRLP4 4+32
+CNSTI4 65537
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $181
+ADDRLP4 4+208
+ADDRGP4 trap_TraceCapsule
+ASGNP4
+ADDRGP4 $182
+JUMPV
+LABELV $181
+ADDRLP4 4+208
+ADDRGP4 trap_Trace
+ASGNP4
+LABELV $182
+ADDRLP4 4+212
+ADDRGP4 trap_PointContents
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Pmove
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_TouchTriggers
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+LABELV $172
+ADDRLP4 0
+INDIRP4
+CNSTI4 1412
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1408
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1408
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 232
+CNSTI4 1
+ASGNI4
+ADDRLP4 236
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1408
+ADDP4
+INDIRI4
+ADDRLP4 232
+INDIRI4
+BANDI4
+ADDRLP4 236
+INDIRI4
+EQI4 $186
+ADDRLP4 0
+INDIRP4
+CNSTI4 1412
+ADDP4
+INDIRI4
+ADDRLP4 232
+INDIRI4
+BANDI4
+ADDRLP4 236
+INDIRI4
+NEI4 $186
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Cmd_FollowCycle_f
+CALLV
+pop
+LABELV $186
+LABELV $171
+endproc SpectatorThink 240 12
+export PlayerInactivityTimer
+proc PlayerInactivityTimer 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 g_inactivity+12
+INDIRI4
+CNSTI4 0
+NEI4 $189
+ADDRFP4 0
+INDIRP4
+CNSTI4 1488
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 60000
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1492
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $190
+JUMPV
+LABELV $189
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $197
+ADDRFP4 0
+INDIRP4
+CNSTI4 537
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $197
+ADDRFP4 0
+INDIRP4
+CNSTI4 538
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $197
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 4
+INDIRI4
+EQI4 $193
+LABELV $197
+ADDRFP4 0
+INDIRP4
+CNSTI4 1488
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_inactivity+12
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1492
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $194
+JUMPV
+LABELV $193
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $200
+ADDRGP4 level+40
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1488
+ADDP4
+INDIRI4
+LEI4 $202
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1528
+DIVI4
+ARGI4
+ADDRGP4 $205
+ARGP4
+ADDRGP4 trap_DropPlayer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $188
+JUMPV
+LABELV $202
+ADDRGP4 level+40
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1488
+ADDP4
+INDIRI4
+CNSTI4 10000
+SUBI4
+LEI4 $206
+ADDRFP4 0
+INDIRP4
+CNSTI4 1492
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $206
+ADDRFP4 0
+INDIRP4
+CNSTI4 1492
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1528
+DIVI4
+ARGI4
+ADDRGP4 $209
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $206
+LABELV $200
+LABELV $194
+LABELV $190
+CNSTI4 1
+RETI4
+LABELV $188
+endproc PlayerInactivityTimer 12 8
+export PlayerTimerActions
+proc PlayerTimerActions 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 1520
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $212
+JUMPV
+LABELV $211
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 1520
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1000
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 368
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $214
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $215
+JUMPV
+LABELV $214
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $215
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $216
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $218
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 15
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1066192077
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+LEF4 $220
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+CNSTF4 1066192077
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $220
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 62
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 $217
+JUMPV
+LABELV $218
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+GEI4 $217
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 5
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+LEI4 $224
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+LABELV $224
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 62
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 $217
+JUMPV
+LABELV $216
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+LEI4 $226
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $226
+LABELV $217
+ADDRLP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+LEI4 $228
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $228
+LABELV $212
+ADDRLP4 0
+INDIRP4
+CNSTI4 1520
+ADDP4
+INDIRI4
+CNSTI4 1000
+GEI4 $211
+LABELV $210
+endproc PlayerTimerActions 24 12
+export PlayerIntermissionThink
+proc PlayerIntermissionThink 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -4097
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1412
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1408
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1408
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 1408
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+BANDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1412
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+BXORI4
+BANDI4
+CNSTI4 0
+EQI4 $231
+ADDRFP4 0
+INDIRP4
+CNSTI4 664
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $231
+LABELV $230
+endproc PlayerIntermissionThink 24 0
+export PlayerEvents
+proc PlayerEvents 64 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+GEI4 $234
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $234
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $236
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 11
+LTI4 $241
+ADDRLP4 4
+INDIRI4
+CNSTI4 39
+GTI4 $241
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $258-44
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $258
+address $242
+address $242
+address $241
+address $241
+address $241
+address $241
+address $241
+address $241
+address $241
+address $241
+address $241
+address $241
+address $251
+address $252
+address $252
+address $252
+address $252
+address $252
+address $252
+address $252
+address $252
+address $252
+address $252
+address $252
+address $252
+address $252
+address $252
+address $252
+address $252
+code
+LABELV $242
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $243
+ADDRGP4 $241
+JUMPV
+LABELV $243
+ADDRGP4 g_dmflags+12
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $245
+ADDRGP4 $241
+JUMPV
+LABELV $245
+ADDRLP4 4
+INDIRI4
+CNSTI4 12
+NEI4 $248
+ADDRLP4 12
+CNSTI4 10
+ASGNI4
+ADDRGP4 $249
+JUMPV
+LABELV $248
+ADDRLP4 12
+CNSTI4 5
+ASGNI4
+LABELV $249
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+CNSTP4 0
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+CNSTP4 0
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 19
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRGP4 $241
+JUMPV
+LABELV $251
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FireWeapon
+CALLV
+pop
+ADDRGP4 $241
+JUMPV
+LABELV $252
+ADDRLP4 52
+ADDRLP4 4
+INDIRI4
+CNSTI4 -769
+BANDI4
+CNSTI4 24
+SUBI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $241
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+EQI4 $256
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+EQI4 $257
+ADDRGP4 $241
+JUMPV
+LABELV $256
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 TossPlayerGametypeItems
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 SelectSpawnPoint
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 TeleportPlayer
+CALLV
+pop
+ADDRGP4 $241
+JUMPV
+LABELV $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 25
+ADDI4
+ASGNI4
+LABELV $241
+LABELV $237
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $239
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+LTI4 $236
+LABELV $233
+endproc PlayerEvents 64 32
+export SendPendingPredictableEvents
+proc SendPendingPredictableEvents 64 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+GEI4 $261
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 8
+LSHI4
+BORI4
+ASGNI4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 40
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 48
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 14
+ADDI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 8
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 Com_ClientListAll
+CALLV
+pop
+ADDRLP4 60
+CNSTI4 20
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRI4
+CNSTI4 1528
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 500
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level+16
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $267
+JUMPV
+LABELV $264
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_ClientListRemove
+CALLV
+pop
+LABELV $265
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $267
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+LTI4 $264
+ADDRFP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $261
+LABELV $260
+endproc SendPendingPredictableEvents 64 12
+export PlayerThink_real
+proc PlayerThink_real 296 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $269
+ADDRGP4 $268
+JUMPV
+LABELV $269
+ADDRLP4 232
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1396
+ADDP4
+ADDRLP4 232
+INDIRI4
+ADDRGP4 level+52
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 220
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+INDIRI4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 200
+ADDI4
+LEI4 $272
+ADDRLP4 220
+INDIRP4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+LABELV $272
+ADDRLP4 220
+INDIRP4
+INDIRI4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 1000
+SUBI4
+GEI4 $276
+ADDRLP4 220
+INDIRP4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 1000
+SUBI4
+ASGNI4
+LABELV $276
+ADDRLP4 0
+INDIRP4
+CNSTI4 1400
+ADDP4
+ADDRLP4 220
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 224
+ADDRLP4 220
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 1
+GEI4 $280
+ADDRLP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $280
+ADDRGP4 $268
+JUMPV
+LABELV $280
+ADDRLP4 224
+INDIRI4
+CNSTI4 200
+LEI4 $282
+ADDRLP4 224
+CNSTI4 200
+ASGNI4
+LABELV $282
+ADDRGP4 pmove_msec+12
+INDIRI4
+CNSTI4 8
+GEI4 $284
+ADDRGP4 $287
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 pmove_msec
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 $285
+JUMPV
+LABELV $284
+ADDRGP4 pmove_msec+12
+INDIRI4
+CNSTI4 33
+LEI4 $288
+ADDRGP4 $287
+ARGP4
+CNSTF4 1107558400
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 pmove_msec
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $288
+LABELV $285
+ADDRLP4 236
+CNSTI4 0
+ASGNI4
+ADDRGP4 pmove_fixed+12
+INDIRI4
+ADDRLP4 236
+INDIRI4
+NEI4 $294
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+ADDRLP4 236
+INDIRI4
+EQI4 $291
+LABELV $294
+ADDRLP4 220
+INDIRP4
+ADDRLP4 220
+INDIRP4
+INDIRI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+DIVI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+MULI4
+ASGNI4
+LABELV $291
+ADDRGP4 level+9148
+INDIRI4
+CNSTI4 0
+EQI4 $298
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 PlayerIntermissionThink
+CALLV
+pop
+ADDRGP4 $268
+JUMPV
+LABELV $298
+ADDRLP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $301
+ADDRLP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $303
+ADDRGP4 $268
+JUMPV
+LABELV $303
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 220
+INDIRP4
+ARGP4
+ADDRGP4 SpectatorThink
+CALLV
+pop
+ADDRGP4 $268
+JUMPV
+LABELV $301
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 PlayerInactivityTimer
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+NEI4 $305
+ADDRGP4 $268
+JUMPV
+LABELV $305
+ADDRGP4 level+40
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1496
+ADDP4
+INDIRI4
+LEI4 $307
+ADDRLP4 244
+ADDRLP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+ADDRLP4 244
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+LABELV $307
+ADDRLP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $310
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $311
+JUMPV
+LABELV $310
+ADDRLP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $312
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $313
+LABELV $311
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRGP4 g_gravity+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRGP4 g_speed+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 360
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $316
+ADDRLP4 244
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+CNSTF4 1067869798
+ADDRLP4 244
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $316
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $318
+ADDRLP4 0
+INDIRP4
+CNSTI4 1512
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $318
+ADDRLP4 220
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $318
+ADDRLP4 0
+INDIRP4
+CNSTI4 1512
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_HookFree
+CALLV
+pop
+LABELV $318
+ADDRLP4 228
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 216
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 252
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ADDRLP4 252
+INDIRI4
+NEI4 $320
+ADDRLP4 256
+ADDRLP4 220
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 260
+CNSTI4 0
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 8192
+BANDI4
+ADDRLP4 260
+INDIRI4
+NEI4 $320
+ADDRLP4 256
+INDIRI4
+ADDRLP4 252
+INDIRI4
+BANDI4
+ADDRLP4 260
+INDIRI4
+EQI4 $320
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ADDRLP4 260
+INDIRI4
+GTI4 $320
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 CheckGauntletAttack
+CALLI4
+ASGNI4
+ADDRLP4 4+44
+ADDRLP4 264
+INDIRI4
+ASGNI4
+LABELV $320
+ADDRFP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $323
+ADDRLP4 264
+ADDRFP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ADDRLP4 264
+INDIRP4
+INDIRI4
+CNSTI4 -32769
+BANDI4
+ASGNI4
+ADDRLP4 268
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 528
+ADDP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 268
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $323
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4+4
+ADDRLP4 220
+INDIRP4
+INDIRB
+ASGNB 28
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $326
+ADDRLP4 4+32
+CNSTI4 65537
+ASGNI4
+ADDRGP4 $327
+JUMPV
+LABELV $326
+ADDRLP4 264
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 264
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 264
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $329
+ADDRLP4 4+32
+CNSTI4 37814273
+ASGNI4
+ADDRGP4 $330
+JUMPV
+LABELV $329
+ADDRLP4 4+32
+CNSTI4 33619969
+ASGNI4
+LABELV $330
+LABELV $327
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $333
+ADDRLP4 4+208
+ADDRGP4 trap_TraceCapsule
+ASGNP4
+ADDRGP4 $334
+JUMPV
+LABELV $333
+ADDRLP4 4+208
+ADDRGP4 trap_Trace
+ASGNP4
+LABELV $334
+ADDRLP4 4+212
+ADDRGP4 trap_PointContents
+ASGNP4
+ADDRLP4 4+36
+ADDRGP4 g_debugMove+12
+INDIRI4
+ASGNI4
+ADDRGP4 g_dmflags+12
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+LEI4 $343
+ADDRLP4 268
+CNSTI4 1
+ASGNI4
+ADDRGP4 $344
+JUMPV
+LABELV $343
+ADDRLP4 268
+CNSTI4 0
+ASGNI4
+LABELV $344
+ADDRLP4 4+40
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 4+200
+ADDRGP4 pmove_fixed+12
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 4+204
+ADDRGP4 pmove_msec+12
+INDIRI4
+ASGNI4
+ADDRLP4 4+196
+ADDRGP4 pmove_overbounce+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1420
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+ARGP4
+ADDRGP4 Pmove
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ADDRLP4 228
+INDIRI4
+EQI4 $351
+ADDRFP4 0
+INDIRP4
+CNSTI4 368
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+ASGNI4
+LABELV $351
+ADDRGP4 g_smoothClients+12
+INDIRI4
+CNSTI4 0
+EQI4 $354
+ADDRLP4 280
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 280
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+ADDRLP4 280
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityStateExtraPolate
+CALLV
+pop
+ADDRGP4 $355
+JUMPV
+LABELV $354
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+LABELV $355
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 SendPendingPredictableEvents
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+NEI4 $357
+ADDRLP4 0
+INDIRP4
+CNSTI4 1508
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $357
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+ADDRLP4 4+188
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+ADDRLP4 4+184
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 228
+INDIRI4
+ARGI4
+ADDRGP4 PlayerEvents
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 668
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $361
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_TouchTriggers
+CALLV
+pop
+LABELV $361
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRGP4 BotTestAAS
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 PlayerImpacts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ADDRLP4 228
+INDIRI4
+EQI4 $363
+ADDRFP4 0
+INDIRP4
+CNSTI4 368
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+ASGNI4
+LABELV $363
+ADDRLP4 0
+INDIRP4
+CNSTI4 1412
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1408
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1408
+ADDP4
+ADDRLP4 220
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 292
+ADDRLP4 0
+INDIRP4
+CNSTI4 1416
+ADDP4
+ASGNP4
+ADDRLP4 292
+INDIRP4
+ADDRLP4 292
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1408
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1412
+ADDP4
+INDIRI4
+BCOMI4
+BANDI4
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $366
+ADDRGP4 level+40
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1484
+ADDP4
+INDIRI4
+LEI4 $268
+ADDRGP4 g_forcerespawn+12
+INDIRI4
+CNSTI4 0
+LEI4 $371
+ADDRGP4 level+40
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1484
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 1000
+ADDRGP4 g_forcerespawn+12
+INDIRI4
+MULI4
+LEI4 $371
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 PlayerRespawn
+CALLV
+pop
+ADDRGP4 $268
+JUMPV
+LABELV $371
+ADDRLP4 220
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 5
+BANDI4
+CNSTI4 0
+EQI4 $268
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 PlayerRespawn
+CALLV
+pop
+ADDRGP4 $268
+JUMPV
+LABELV $366
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 224
+INDIRI4
+ARGI4
+ADDRGP4 PlayerTimerActions
+CALLV
+pop
+LABELV $268
+endproc PlayerThink_real 296 16
+export PlayerThink
+proc PlayerThink 16 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 720
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 trap_GetUsercmd
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1404
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 8
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+ADDRLP4 12
+INDIRI4
+NEI4 $380
+ADDRGP4 g_synchronousClients+12
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $380
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 PlayerThink_real
+CALLV
+pop
+LABELV $380
+LABELV $378
+endproc PlayerThink 16 8
+export G_RunPlayer
+proc G_RunPlayer 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BANDI4
+ADDRLP4 4
+INDIRI4
+NEI4 $384
+ADDRGP4 g_synchronousClients+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $384
+ADDRGP4 $383
+JUMPV
+LABELV $384
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 PlayerThink_real
+CALLV
+pop
+LABELV $383
+endproc G_RunPlayer 8 4
+export SpectatorPlayerEndFrame
+proc SpectatorPlayerEndFrame 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $389
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $391
+ADDRLP4 4
+ADDRGP4 level+352
+INDIRI4
+ASGNI4
+ADDRGP4 $392
+JUMPV
+LABELV $391
+ADDRLP4 4
+INDIRI4
+CNSTI4 -2
+NEI4 $394
+ADDRLP4 4
+ADDRGP4 level+356
+INDIRI4
+ASGNI4
+LABELV $394
+LABELV $392
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $397
+ADDRLP4 0
+CNSTI4 1528
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $399
+ADDRLP4 12
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $399
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 220
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 -540673
+BANDI4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 540672
+BANDI4
+BORI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRB
+ASGNB 500
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 220
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $388
+JUMPV
+LABELV $399
+LABELV $397
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $401
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $403
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 644
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $403
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1528
+DIVI4
+ARGI4
+ADDRGP4 PlayerBegin
+CALLV
+pop
+LABELV $401
+LABELV $389
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $405
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+ADDRGP4 $406
+JUMPV
+LABELV $405
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 116
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -8193
+BANDI4
+ASGNI4
+LABELV $406
+LABELV $388
+endproc SpectatorPlayerEndFrame 32 4
+export PlayerEndFrame
+proc PlayerEndFrame 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $408
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 SpectatorPlayerEndFrame
+CALLV
+pop
+ADDRGP4 $407
+JUMPV
+LABELV $408
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $410
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+40
+INDIRI4
+GEI4 $414
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $414
+LABELV $411
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $410
+ADDRGP4 level+9148
+INDIRI4
+CNSTI4 0
+EQI4 $417
+ADDRGP4 $407
+JUMPV
+LABELV $417
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 P_WorldEffects
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 P_DamageFeedback
+CALLV
+pop
+ADDRGP4 level+40
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1404
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 1000
+LEI4 $420
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 220
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $420
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 220
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -8193
+BANDI4
+ASGNI4
+LABELV $421
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 284
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_SetPlayerSound
+CALLV
+pop
+ADDRGP4 g_smoothClients+12
+INDIRI4
+CNSTI4 0
+EQI4 $423
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityStateExtraPolate
+CALLV
+pop
+ADDRGP4 $424
+JUMPV
+LABELV $423
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+LABELV $424
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 SendPendingPredictableEvents
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_StoreHistory
+CALLV
+pop
+LABELV $407
+endproc PlayerEndFrame 16 16
+import BotTestSolid
+import g_instagib
+import g_playerCapsule
+import g_proxMineTimeout
+import g_singlePlayer
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGamePlayers
+import g_maxplayers
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import trap_AAS_DropToFloor
+import trap_AAS_HorizontalVelocityForJump
+import trap_AAS_AgainstLadder
+import trap_AAS_JumpReachRunStart
+import trap_AAS_Swimming
+import trap_AAS_OnGround
+import trap_AAS_PredictPlayerMovement
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaTravelTime
+import trap_AAS_EnableRoutingArea
+import trap_AAS_RandomGoalArea
+import trap_AAS_ReachabilityFromNum
+import trap_AAS_NextAreaReachability
+import trap_AAS_AreaContentsTravelFlags
+import trap_AAS_TravelFlagForType
+import trap_AAS_AreaDoNotEnter
+import trap_AAS_AreaJumpPad
+import trap_AAS_AreaLadder
+import trap_AAS_AreaGrounded
+import trap_AAS_AreaSlime
+import trap_AAS_AreaLava
+import trap_AAS_AreaLiquid
+import trap_AAS_AreaSwim
+import trap_AAS_AreaCrouch
+import trap_AAS_AreaGroundFaceArea
+import trap_AAS_NextModelReachability
+import trap_AAS_BestReachableFromJumpPadArea
+import trap_AAS_BestReachableArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_TracePlayerBBox
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_FloodAreas
+import trap_AAS_ShowReachableAreas
+import trap_AAS_ShowReachability
+import trap_AAS_DrawArrow
+import trap_AAS_PrintTravelType
+import trap_AAS_DrawCross
+import trap_AAS_ShowAreaPolygons
+import trap_AAS_ShowArea
+import trap_AAS_ShowFace
+import trap_AAS_ShowBoundingBox
+import trap_AAS_DrawPlaneCross
+import trap_AAS_DrawPermanentCross
+import trap_AAS_PermanentLine
+import trap_AAS_DebugLine
+import trap_AAS_ClearShownPolygons
+import trap_AAS_ClearShownDebugLines
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_Loaded
+import trap_AAS_PointInsideArea
+import trap_AAS_BBoxReachabilityAreas
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_RegisterModel
+import trap_DebugPolygonDelete
+import trap_DebugPolygonShow
+import trap_DebugPolygonCreate
+import trap_ClientCommand
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_ClipToEntitiesCapsule
+import trap_ClipToEntities
+import trap_TraceCapsule
+import trap_Trace
+import trap_GetBrushBounds
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_SetConfigstringRestrictions
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommandEx
+import trap_DropPlayer
+import trap_SetNetFields
+import trap_LocateGameData
+import Pickup_Team
+import Svcmd_TeamInfoStats_f
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_BuildLocationTree
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotWeightBench_f
+import Svcmd_BotThinkReport_f
+import Svcmd_BotMatchBench_f
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownPlayer
+import BotAISetupPlayer
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import G_BotInitBotLib
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBotComplete
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import PlayerHandicap
+import ClientCommand
+import PlayerBegin
+import PlayerDisconnect
+import PlayerUserinfoChanged
+import PlayerConnect
+import G_Error
+import G_Printf
+import G_DPrintf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MovePlayerToIntermission
+import StringIsInteger
+import ConcatArgs
+import G_ScoreboardChanged
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import G_RegisterCommands
+import G_ConsoleCompleteArgument
+import G_ConsoleCommand
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import PlayerSpawn
+import InitBodyQue
+import BeginIntermission
+import PlayerRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetPlayerViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossPlayerCubes
+import TossPlayerGametypeItems
+import TossPlayerItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_SetBrushModel
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import trap_SendServerCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import FinishSpawningItem
+import G_SpawnItem
+import LaunchItem
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $287
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $209
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 33
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $205
+byte 1 68
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
@@ -0,0 +1,2740 @@
+code
+proc BotImport_BSPModelMinsMaxsOrigin 48 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 trap_GetBrushBounds
+CALLV
+pop
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+NEF4 $64
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+NEF4 $64
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+EQF4 $61
+LABELV $64
+ADDRLP4 8
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 40
+ADDRGP4 RadiusFromBounds
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $65
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $66
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $65
+LABELV $61
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $69
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRB
+ASGNB 12
+LABELV $69
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $71
+ADDRFP4 12
+INDIRP4
+ADDRLP4 20
+INDIRB
+ASGNB 12
+LABELV $71
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $73
+ADDRLP4 40
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+LABELV $73
+LABELV $60
+endproc BotImport_BSPModelMinsMaxsOrigin 48 12
+proc BotImport_GetMemory 4 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $75
+endproc BotImport_GetMemory 4 4
+proc BotImport_AvailableMemory 4 0
+ADDRLP4 0
+ADDRGP4 trap_HeapAvailable
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $76
+endproc BotImport_AvailableMemory 4 0
+proc BotImport_FreeMemory 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+LABELV $77
+endproc BotImport_FreeMemory 0 4
+proc BotImport_HunkAlloc 4 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $78
+endproc BotImport_HunkAlloc 4 4
+export G_BotInitBotLib
+proc G_BotInitBotLib 96 8
+ADDRLP4 0
+ADDRGP4 trap_Milliseconds
+ASGNP4
+ADDRLP4 0+4
+ADDRGP4 BotAI_Print
+ASGNP4
+ADDRLP4 0+8
+ADDRGP4 BotAI_Trace
+ASGNP4
+ADDRLP4 0+12
+ADDRGP4 BotAI_EntityTrace
+ASGNP4
+ADDRLP4 0+16
+ADDRGP4 BotAI_PointContents
+ASGNP4
+ADDRLP4 0+20
+ADDRGP4 BotAI_InPVS
+ASGNP4
+ADDRLP4 0+24
+ADDRGP4 trap_GetEntityToken
+ASGNP4
+ADDRLP4 0+28
+ADDRGP4 BotImport_BSPModelMinsMaxsOrigin
+ASGNP4
+ADDRLP4 0+32
+ADDRGP4 trap_ClientCommand
+ASGNP4
+ADDRLP4 0+36
+ADDRGP4 BotImport_GetMemory
+ASGNP4
+ADDRLP4 0+40
+ADDRGP4 BotImport_FreeMemory
+ASGNP4
+ADDRLP4 0+44
+ADDRGP4 BotImport_AvailableMemory
+ASGNP4
+ADDRLP4 0+48
+ADDRGP4 BotImport_HunkAlloc
+ASGNP4
+ADDRLP4 0+52
+ADDRGP4 trap_FS_FOpenFile
+ASGNP4
+ADDRLP4 0+56
+ADDRGP4 trap_FS_Read
+ASGNP4
+ADDRLP4 0+60
+ADDRGP4 trap_FS_Write
+ASGNP4
+ADDRLP4 0+64
+ADDRGP4 trap_FS_FCloseFile
+ASGNP4
+ADDRLP4 0+68
+ADDRGP4 trap_FS_Seek
+ASGNP4
+ADDRLP4 0+72
+ADDRGP4 BotAI_DebugLineCreate
+ASGNP4
+ADDRLP4 0+76
+ADDRGP4 BotAI_DebugLineDelete
+ASGNP4
+ADDRLP4 0+80
+ADDRGP4 BotAI_DebugLineShow
+ASGNP4
+ADDRLP4 0+84
+ADDRGP4 trap_DebugPolygonCreate
+ASGNP4
+ADDRLP4 0+88
+ADDRGP4 trap_DebugPolygonDelete
+ASGNP4
+CNSTI4 5
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 92
+ADDRGP4 GetBotLibAPI
+CALLP4
+ASGNP4
+ADDRGP4 botlib_export
+ADDRLP4 92
+INDIRP4
+ASGNP4
+LABELV $79
+endproc G_BotInitBotLib 96 8
+proc G_BotLibSetup 3080 12
+ADDRGP4 $105
+ARGP4
+ADDRLP4 3072
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 3072
+INDIRI4
+CNSTI4 0
+NEI4 $103
+CNSTI4 0
+RETI4
+ADDRGP4 $102
+JUMPV
+LABELV $103
+ADDRGP4 botlib_export
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $106
+ADDRGP4 $108
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 -1
+RETI4
+ADDRGP4 $102
+JUMPV
+LABELV $106
+ADDRGP4 $109
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $110
+ARGP4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $111
+ARGP4
+ADDRLP4 2048
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $112
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CALLI4
+pop
+ADDRGP4 $113
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CALLI4
+pop
+ADDRGP4 $114
+ARGP4
+ADDRLP4 2048
+ARGP4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CALLI4
+pop
+ADDRLP4 3076
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 3076
+INDIRI4
+RETI4
+LABELV $102
+endproc G_BotLibSetup 3080 12
+proc G_BotLibShutdown 4 0
+ADDRGP4 botlib_export
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $116
+CNSTI4 -1
+RETI4
+ADDRGP4 $115
+JUMPV
+LABELV $116
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $115
+endproc G_BotLibShutdown 4 0
+export trap_BotLibSetup
+proc trap_BotLibSetup 4 0
+ADDRLP4 0
+ADDRGP4 G_BotLibSetup
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $118
+endproc trap_BotLibSetup 4 0
+export trap_BotLibShutdown
+proc trap_BotLibShutdown 4 0
+ADDRLP4 0
+ADDRGP4 G_BotLibShutdown
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $119
+endproc trap_BotLibShutdown 4 0
+export trap_BotLibVarSet
+proc trap_BotLibVarSet 4 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $120
+endproc trap_BotLibVarSet 4 8
+export trap_BotLibVarGet
+proc trap_BotLibVarGet 4 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $121
+endproc trap_BotLibVarGet 4 12
+export trap_BotLibStartFrame
+proc trap_BotLibStartFrame 4 4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $122
+endproc trap_BotLibStartFrame 4 4
+export trap_BotLibLoadMap
+proc trap_BotLibLoadMap 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $123
+endproc trap_BotLibLoadMap 4 4
+export trap_BotLibUpdateEntity
+proc trap_BotLibUpdateEntity 4 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $124
+endproc trap_BotLibUpdateEntity 4 8
+export trap_BotLibUpdateEntities
+proc trap_BotLibUpdateEntities 4 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $125
+endproc trap_BotLibUpdateEntities 4 12
+export trap_AAS_Loaded
+proc trap_AAS_Loaded 4 0
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $126
+endproc trap_AAS_Loaded 4 0
+export trap_AAS_Initialized
+proc trap_AAS_Initialized 4 0
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $127
+endproc trap_AAS_Initialized 4 0
+export trap_AAS_PresenceTypeBoundingBox
+proc trap_AAS_PresenceTypeBoundingBox 0 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $128
+endproc trap_AAS_PresenceTypeBoundingBox 0 12
+export trap_AAS_Time
+proc trap_AAS_Time 4 0
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $129
+endproc trap_AAS_Time 4 0
+export trap_AAS_ClearShownDebugLines
+proc trap_AAS_ClearShownDebugLines 0 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $130
+endproc trap_AAS_ClearShownDebugLines 0 0
+export trap_AAS_ClearShownPolygons
+proc trap_AAS_ClearShownPolygons 0 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $131
+endproc trap_AAS_ClearShownPolygons 0 0
+export trap_AAS_DebugLine
+proc trap_AAS_DebugLine 0 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $132
+endproc trap_AAS_DebugLine 0 12
+export trap_AAS_PermanentLine
+proc trap_AAS_PermanentLine 0 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $133
+endproc trap_AAS_PermanentLine 0 12
+export trap_AAS_DrawPermanentCross
+proc trap_AAS_DrawPermanentCross 0 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $134
+endproc trap_AAS_DrawPermanentCross 0 12
+export trap_AAS_DrawPlaneCross
+proc trap_AAS_DrawPlaneCross 0 20
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $135
+endproc trap_AAS_DrawPlaneCross 0 20
+export trap_AAS_ShowBoundingBox
+proc trap_AAS_ShowBoundingBox 0 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $136
+endproc trap_AAS_ShowBoundingBox 0 12
+export trap_AAS_ShowFace
+proc trap_AAS_ShowFace 0 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $137
+endproc trap_AAS_ShowFace 0 4
+export trap_AAS_ShowArea
+proc trap_AAS_ShowArea 0 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $138
+endproc trap_AAS_ShowArea 0 8
+export trap_AAS_ShowAreaPolygons
+proc trap_AAS_ShowAreaPolygons 0 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $139
+endproc trap_AAS_ShowAreaPolygons 0 12
+export trap_AAS_DrawCross
+proc trap_AAS_DrawCross 0 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $140
+endproc trap_AAS_DrawCross 0 12
+export trap_AAS_PrintTravelType
+proc trap_AAS_PrintTravelType 0 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $141
+endproc trap_AAS_PrintTravelType 0 4
+export trap_AAS_DrawArrow
+proc trap_AAS_DrawArrow 0 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $142
+endproc trap_AAS_DrawArrow 0 16
+export trap_AAS_ShowReachability
+proc trap_AAS_ShowReachability 0 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $143
+endproc trap_AAS_ShowReachability 0 8
+export trap_AAS_ShowReachableAreas
+proc trap_AAS_ShowReachableAreas 0 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $144
+endproc trap_AAS_ShowReachableAreas 0 8
+export trap_AAS_FloodAreas
+proc trap_AAS_FloodAreas 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $145
+endproc trap_AAS_FloodAreas 0 4
+export trap_AAS_PointAreaNum
+proc trap_AAS_PointAreaNum 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $146
+endproc trap_AAS_PointAreaNum 4 4
+export trap_AAS_PointReachabilityAreaIndex
+proc trap_AAS_PointReachabilityAreaIndex 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $147
+endproc trap_AAS_PointReachabilityAreaIndex 4 4
+export trap_AAS_TracePlayerBBox
+proc trap_AAS_TracePlayerBBox 0 24
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $148
+endproc trap_AAS_TracePlayerBBox 0 24
+export trap_AAS_TraceAreas
+proc trap_AAS_TraceAreas 4 20
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $149
+endproc trap_AAS_TraceAreas 4 20
+export trap_AAS_BBoxAreas
+proc trap_AAS_BBoxAreas 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $150
+endproc trap_AAS_BBoxAreas 4 16
+export trap_AAS_AreaInfo
+proc trap_AAS_AreaInfo 4 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $151
+endproc trap_AAS_AreaInfo 4 8
+export trap_AAS_BBoxReachabilityAreas
+proc trap_AAS_BBoxReachabilityAreas 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $152
+endproc trap_AAS_BBoxReachabilityAreas 4 16
+export trap_AAS_PointInsideArea
+proc trap_AAS_PointInsideArea 4 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $153
+endproc trap_AAS_PointInsideArea 4 8
+export trap_AAS_PointContents
+proc trap_AAS_PointContents 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $154
+endproc trap_AAS_PointContents 4 4
+export trap_AAS_NextBSPEntity
+proc trap_AAS_NextBSPEntity 4 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $155
+endproc trap_AAS_NextBSPEntity 4 4
+export trap_AAS_ValueForBSPEpairKey
+proc trap_AAS_ValueForBSPEpairKey 4 16
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $156
+endproc trap_AAS_ValueForBSPEpairKey 4 16
+export trap_AAS_VectorForBSPEpairKey
+proc trap_AAS_VectorForBSPEpairKey 4 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $157
+endproc trap_AAS_VectorForBSPEpairKey 4 12
+export trap_AAS_FloatForBSPEpairKey
+proc trap_AAS_FloatForBSPEpairKey 4 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $158
+endproc trap_AAS_FloatForBSPEpairKey 4 12
+export trap_AAS_IntForBSPEpairKey
+proc trap_AAS_IntForBSPEpairKey 4 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $159
+endproc trap_AAS_IntForBSPEpairKey 4 12
+export trap_AAS_AreaReachability
+proc trap_AAS_AreaReachability 4 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $160
+endproc trap_AAS_AreaReachability 4 4
+export trap_AAS_BestReachableArea
+proc trap_AAS_BestReachableArea 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $161
+endproc trap_AAS_BestReachableArea 4 16
+export trap_AAS_BestReachableFromJumpPadArea
+proc trap_AAS_BestReachableFromJumpPadArea 4 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $162
+endproc trap_AAS_BestReachableFromJumpPadArea 4 12
+export trap_AAS_NextModelReachability
+proc trap_AAS_NextModelReachability 4 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $163
+endproc trap_AAS_NextModelReachability 4 8
+export trap_AAS_AreaGroundFaceArea
+proc trap_AAS_AreaGroundFaceArea 4 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $164
+endproc trap_AAS_AreaGroundFaceArea 4 4
+export trap_AAS_AreaCrouch
+proc trap_AAS_AreaCrouch 4 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $165
+endproc trap_AAS_AreaCrouch 4 4
+export trap_AAS_AreaSwim
+proc trap_AAS_AreaSwim 4 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $166
+endproc trap_AAS_AreaSwim 4 4
+export trap_AAS_AreaLiquid
+proc trap_AAS_AreaLiquid 4 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $167
+endproc trap_AAS_AreaLiquid 4 4
+export trap_AAS_AreaLava
+proc trap_AAS_AreaLava 4 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $168
+endproc trap_AAS_AreaLava 4 4
+export trap_AAS_AreaSlime
+proc trap_AAS_AreaSlime 4 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $169
+endproc trap_AAS_AreaSlime 4 4
+export trap_AAS_AreaGrounded
+proc trap_AAS_AreaGrounded 4 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $170
+endproc trap_AAS_AreaGrounded 4 4
+export trap_AAS_AreaLadder
+proc trap_AAS_AreaLadder 4 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $171
+endproc trap_AAS_AreaLadder 4 4
+export trap_AAS_AreaJumpPad
+proc trap_AAS_AreaJumpPad 4 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $172
+endproc trap_AAS_AreaJumpPad 4 4
+export trap_AAS_AreaDoNotEnter
+proc trap_AAS_AreaDoNotEnter 4 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $173
+endproc trap_AAS_AreaDoNotEnter 4 4
+export trap_AAS_TravelFlagForType
+proc trap_AAS_TravelFlagForType 4 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $174
+endproc trap_AAS_TravelFlagForType 4 4
+export trap_AAS_AreaContentsTravelFlags
+proc trap_AAS_AreaContentsTravelFlags 4 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $175
+endproc trap_AAS_AreaContentsTravelFlags 4 4
+export trap_AAS_NextAreaReachability
+proc trap_AAS_NextAreaReachability 4 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $176
+endproc trap_AAS_NextAreaReachability 4 8
+export trap_AAS_ReachabilityFromNum
+proc trap_AAS_ReachabilityFromNum 0 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $177
+endproc trap_AAS_ReachabilityFromNum 0 8
+export trap_AAS_RandomGoalArea
+proc trap_AAS_RandomGoalArea 4 20
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $178
+endproc trap_AAS_RandomGoalArea 4 20
+export trap_AAS_EnableRoutingArea
+proc trap_AAS_EnableRoutingArea 4 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $179
+endproc trap_AAS_EnableRoutingArea 4 8
+export trap_AAS_AreaTravelTime
+proc trap_AAS_AreaTravelTime 4 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUU2 4
+CVUI4 2
+RETI4
+LABELV $180
+endproc trap_AAS_AreaTravelTime 4 12
+export trap_AAS_AreaTravelTimeToGoalArea
+proc trap_AAS_AreaTravelTimeToGoalArea 4 16
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $181
+endproc trap_AAS_AreaTravelTimeToGoalArea 4 16
+export trap_AAS_PredictRoute
+proc trap_AAS_PredictRoute 4 44
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRFP4 36
+INDIRI4
+ARGI4
+ADDRFP4 40
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $182
+endproc trap_AAS_PredictRoute 4 44
+export trap_AAS_AlternativeRouteGoals
+proc trap_AAS_AlternativeRouteGoals 4 32
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $183
+endproc trap_AAS_AlternativeRouteGoals 4 32
+export trap_AAS_PredictPlayerMovement
+proc trap_AAS_PredictPlayerMovement 4 56
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRFP4 40
+INDIRI4
+ARGI4
+ADDRFP4 44
+INDIRI4
+ARGI4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $184
+endproc trap_AAS_PredictPlayerMovement 4 56
+export trap_AAS_OnGround
+proc trap_AAS_OnGround 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $185
+endproc trap_AAS_OnGround 4 16
+export trap_AAS_Swimming
+proc trap_AAS_Swimming 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $186
+endproc trap_AAS_Swimming 4 4
+export trap_AAS_JumpReachRunStart
+proc trap_AAS_JumpReachRunStart 0 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $187
+endproc trap_AAS_JumpReachRunStart 0 12
+export trap_AAS_AgainstLadder
+proc trap_AAS_AgainstLadder 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $188
+endproc trap_AAS_AgainstLadder 4 4
+export trap_AAS_HorizontalVelocityForJump
+proc trap_AAS_HorizontalVelocityForJump 4 16
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 252
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $189
+endproc trap_AAS_HorizontalVelocityForJump 4 16
+export trap_AAS_DropToFloor
+proc trap_AAS_DropToFloor 4 20
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 botlib_export
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $190
+endproc trap_AAS_DropToFloor 4 20
+bss
+export botlib_export
+align 4
+LABELV botlib_export
+skip 4
+import bot_reloadcharacters
+import bot_showteamgoals
+import bot_shownodechanges
+import bot_developer
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetPlayerState
+import BotAI_DebugLineShow
+import BotAI_DebugLineDelete
+import BotAI_DebugLineCreate
+import BotAI_InPVS
+import BotAI_PointContents
+import BotAI_EntityTrace
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotLibVarGetValue
+import BotNextEntity
+import BotSense
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotPrepareItemWeights
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GetBotLibAPI
+import g_instagib
+import g_playerCapsule
+import g_proxMineTimeout
+import g_singlePlayer
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGamePlayers
+import g_maxplayers
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_RegisterModel
+import trap_DebugPolygonDelete
+import trap_DebugPolygonShow
+import trap_DebugPolygonCreate
+import trap_ClientCommand
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_ClipToEntitiesCapsule
+import trap_ClipToEntities
+import trap_TraceCapsule
+import trap_Trace
+import trap_GetBrushBounds
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_SetConfigstringRestrictions
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommandEx
+import trap_DropPlayer
+import trap_SetNetFields
+import trap_LocateGameData
+import Pickup_Team
+import Svcmd_TeamInfoStats_f
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_BuildLocationTree
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotWeightBench_f
+import Svcmd_BotThinkReport_f
+import Svcmd_BotMatchBench_f
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownPlayer
+import BotAISetupPlayer
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBotComplete
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunPlayer
+import PlayerEndFrame
+import PlayerThink
+import PlayerHandicap
+import ClientCommand
+import PlayerBegin
+import PlayerDisconnect
+import PlayerUserinfoChanged
+import PlayerConnect
+import G_Error
+import G_Printf
+import G_DPrintf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MovePlayerToIntermission
+import StringIsInteger
+import ConcatArgs
+import G_ScoreboardChanged
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import G_RegisterCommands
+import G_ConsoleCompleteArgument
+import G_ConsoleCommand
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import PlayerSpawn
+import InitBodyQue
+import BeginIntermission
+import PlayerRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetPlayerViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossPlayerCubes
+import TossPlayerGametypeItems
+import TossPlayerItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_SetBrushModel
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import trap_SendServerCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import FinishSpawningItem
+import G_SpawnItem
+import LaunchItem
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $114
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $113
+byte 1 104
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $112
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $111
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $110
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $109
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $108
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 71
+byte 1 95
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 76
+byte 1 105
+byte 1 98
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 71
+byte 1 95
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 76
+byte 1 105
+byte 1 98
+byte 1 10
+byte 1 0
+align 1
+LABELV $105
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
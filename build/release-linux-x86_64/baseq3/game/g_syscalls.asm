@@ -0,0 +1,2290 @@
+export PASSFLOAT
+code
+proc PASSFLOAT 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $60
+endproc PASSFLOAT 4 0
+export trap_Print
+proc trap_Print 0 8
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $61
+endproc trap_Print 0 8
+export trap_Error
+proc trap_Error 0 8
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $62
+endproc trap_Error 0 8
+export trap_Milliseconds
+proc trap_Milliseconds 4 4
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $63
+endproc trap_Milliseconds 4 4
+export trap_Argc
+proc trap_Argc 4 4
+CNSTI4 5
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $64
+endproc trap_Argc 4 4
+export trap_Argv
+proc trap_Argv 0 16
+CNSTI4 6
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $65
+endproc trap_Argv 0 16
+export trap_Args
+proc trap_Args 0 12
+CNSTI4 7
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $66
+endproc trap_Args 0 12
+export trap_LiteralArgs
+proc trap_LiteralArgs 0 12
+CNSTI4 8
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $67
+endproc trap_LiteralArgs 0 12
+export trap_FS_FOpenFile
+proc trap_FS_FOpenFile 4 16
+CNSTI4 24
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $68
+endproc trap_FS_FOpenFile 4 16
+export trap_FS_Read
+proc trap_FS_Read 4 16
+CNSTI4 25
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $69
+endproc trap_FS_Read 4 16
+export trap_FS_Write
+proc trap_FS_Write 4 16
+CNSTI4 26
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $70
+endproc trap_FS_Write 4 16
+export trap_FS_Seek
+proc trap_FS_Seek 4 16
+CNSTI4 27
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $71
+endproc trap_FS_Seek 4 16
+export trap_FS_Tell
+proc trap_FS_Tell 4 8
+CNSTI4 28
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $72
+endproc trap_FS_Tell 4 8
+export trap_FS_FCloseFile
+proc trap_FS_FCloseFile 0 8
+CNSTI4 29
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $73
+endproc trap_FS_FCloseFile 0 8
+export trap_FS_GetFileList
+proc trap_FS_GetFileList 4 20
+CNSTI4 30
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $74
+endproc trap_FS_GetFileList 4 20
+export trap_FS_Delete
+proc trap_FS_Delete 4 8
+CNSTI4 31
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $75
+endproc trap_FS_Delete 4 8
+export trap_FS_Rename
+proc trap_FS_Rename 4 12
+CNSTI4 32
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $76
+endproc trap_FS_Rename 4 12
+export trap_Cmd_ExecuteText
+proc trap_Cmd_ExecuteText 0 12
+CNSTI4 11
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $77
+endproc trap_Cmd_ExecuteText 0 12
+export trap_Cvar_Register
+proc trap_Cvar_Register 0 20
+CNSTI4 12
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $78
+endproc trap_Cvar_Register 0 20
+export trap_Cvar_Update
+proc trap_Cvar_Update 0 8
+CNSTI4 13
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $79
+endproc trap_Cvar_Update 0 8
+export trap_Cvar_Set
+proc trap_Cvar_Set 0 12
+CNSTI4 14
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $80
+endproc trap_Cvar_Set 0 12
+export trap_Cvar_SetValue
+proc trap_Cvar_SetValue 4 12
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 15
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $81
+endproc trap_Cvar_SetValue 4 12
+export trap_Cvar_VariableValue
+proc trap_Cvar_VariableValue 8 8
+CNSTI4 17
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $82
+endproc trap_Cvar_VariableValue 8 8
+export trap_Cvar_VariableIntegerValue
+proc trap_Cvar_VariableIntegerValue 4 8
+CNSTI4 18
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $83
+endproc trap_Cvar_VariableIntegerValue 4 8
+export trap_Cvar_VariableStringBuffer
+proc trap_Cvar_VariableStringBuffer 0 16
+CNSTI4 19
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $84
+endproc trap_Cvar_VariableStringBuffer 0 16
+export trap_Cvar_LatchedVariableStringBuffer
+proc trap_Cvar_LatchedVariableStringBuffer 0 16
+CNSTI4 20
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $85
+endproc trap_Cvar_LatchedVariableStringBuffer 0 16
+export trap_Cvar_DefaultVariableStringBuffer
+proc trap_Cvar_DefaultVariableStringBuffer 0 16
+CNSTI4 21
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $86
+endproc trap_Cvar_DefaultVariableStringBuffer 0 16
+export trap_Cvar_InfoStringBuffer
+proc trap_Cvar_InfoStringBuffer 0 16
+CNSTI4 22
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $87
+endproc trap_Cvar_InfoStringBuffer 0 16
+export trap_Cvar_CheckRange
+proc trap_Cvar_CheckRange 8 20
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 23
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $88
+endproc trap_Cvar_CheckRange 8 20
+export trap_LocateGameData
+proc trap_LocateGameData 0 24
+CNSTI4 100
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $89
+endproc trap_LocateGameData 0 24
+export trap_SetNetFields
+proc trap_SetNetFields 0 36
+CNSTI4 133
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $90
+endproc trap_SetNetFields 0 36
+export trap_DropPlayer
+proc trap_DropPlayer 0 12
+CNSTI4 101
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $91
+endproc trap_DropPlayer 0 12
+export trap_SendServerCommandEx
+proc trap_SendServerCommandEx 0 16
+CNSTI4 102
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $92
+endproc trap_SendServerCommandEx 0 16
+export trap_SetConfigstring
+proc trap_SetConfigstring 0 12
+CNSTI4 103
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $93
+endproc trap_SetConfigstring 0 12
+export trap_GetConfigstring
+proc trap_GetConfigstring 0 16
+CNSTI4 104
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $94
+endproc trap_GetConfigstring 0 16
+export trap_SetConfigstringRestrictions
+proc trap_SetConfigstringRestrictions 0 12
+CNSTI4 105
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $95
+endproc trap_SetConfigstringRestrictions 0 12
+export trap_GetUserinfo
+proc trap_GetUserinfo 0 16
+CNSTI4 106
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $96
+endproc trap_GetUserinfo 0 16
+export trap_SetUserinfo
+proc trap_SetUserinfo 0 12
+CNSTI4 107
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $97
+endproc trap_SetUserinfo 0 12
+export trap_GetServerinfo
+proc trap_GetServerinfo 0 12
+CNSTI4 108
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $98
+endproc trap_GetServerinfo 0 12
+export trap_GetBrushBounds
+proc trap_GetBrushBounds 0 16
+CNSTI4 109
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $99
+endproc trap_GetBrushBounds 0 16
+export trap_Trace
+proc trap_Trace 0 32
+CNSTI4 110
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $100
+endproc trap_Trace 0 32
+export trap_TraceCapsule
+proc trap_TraceCapsule 0 32
+CNSTI4 131
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $101
+endproc trap_TraceCapsule 0 32
+export trap_ClipToEntities
+proc trap_ClipToEntities 0 32
+CNSTI4 139
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $102
+endproc trap_ClipToEntities 0 32
+export trap_ClipToEntitiesCapsule
+proc trap_ClipToEntitiesCapsule 0 32
+CNSTI4 140
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $103
+endproc trap_ClipToEntitiesCapsule 0 32
+export trap_PointContents
+proc trap_PointContents 4 12
+CNSTI4 111
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $104
+endproc trap_PointContents 4 12
+export trap_InPVS
+proc trap_InPVS 4 12
+CNSTI4 112
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $105
+endproc trap_InPVS 4 12
+export trap_InPVSIgnorePortals
+proc trap_InPVSIgnorePortals 4 12
+CNSTI4 113
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $106
+endproc trap_InPVSIgnorePortals 4 12
+export trap_AdjustAreaPortalState
+proc trap_AdjustAreaPortalState 0 12
+CNSTI4 114
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $107
+endproc trap_AdjustAreaPortalState 0 12
+export trap_AreasConnected
+proc trap_AreasConnected 4 12
+CNSTI4 115
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $108
+endproc trap_AreasConnected 4 12
+export trap_LinkEntity
+proc trap_LinkEntity 0 8
+CNSTI4 116
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $109
+endproc trap_LinkEntity 0 8
+export trap_UnlinkEntity
+proc trap_UnlinkEntity 0 8
+CNSTI4 117
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $110
+endproc trap_UnlinkEntity 0 8
+export trap_EntitiesInBox
+proc trap_EntitiesInBox 4 20
+CNSTI4 118
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $111
+endproc trap_EntitiesInBox 4 20
+export trap_EntityContact
+proc trap_EntityContact 4 16
+CNSTI4 119
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $112
+endproc trap_EntityContact 4 16
+export trap_EntityContactCapsule
+proc trap_EntityContactCapsule 4 16
+CNSTI4 132
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $113
+endproc trap_EntityContactCapsule 4 16
+export trap_BotAllocateClient
+proc trap_BotAllocateClient 4 4
+CNSTI4 120
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $114
+endproc trap_BotAllocateClient 4 4
+export trap_BotFreeClient
+proc trap_BotFreeClient 0 8
+CNSTI4 121
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $115
+endproc trap_BotFreeClient 0 8
+export trap_GetUsercmd
+proc trap_GetUsercmd 0 12
+CNSTI4 126
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $116
+endproc trap_GetUsercmd 0 12
+export trap_GetEntityToken
+proc trap_GetEntityToken 4 16
+CNSTI4 127
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $117
+endproc trap_GetEntityToken 4 16
+export trap_DebugPolygonCreate
+proc trap_DebugPolygonCreate 4 16
+CNSTI4 128
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $118
+endproc trap_DebugPolygonCreate 4 16
+export trap_DebugPolygonShow
+proc trap_DebugPolygonShow 0 20
+CNSTI4 129
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $119
+endproc trap_DebugPolygonShow 0 20
+export trap_DebugPolygonDelete
+proc trap_DebugPolygonDelete 0 8
+CNSTI4 130
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $120
+endproc trap_DebugPolygonDelete 0 8
+export trap_RealTime
+proc trap_RealTime 4 8
+CNSTI4 3
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $121
+endproc trap_RealTime 4 8
+export trap_SnapVector
+proc trap_SnapVector 0 8
+CNSTI4 4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $122
+endproc trap_SnapVector 0 8
+export trap_AddCommand
+proc trap_AddCommand 0 8
+CNSTI4 9
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $123
+endproc trap_AddCommand 0 8
+export trap_RemoveCommand
+proc trap_RemoveCommand 0 8
+CNSTI4 10
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $124
+endproc trap_RemoveCommand 0 8
+export trap_R_RegisterModel
+proc trap_R_RegisterModel 4 8
+CNSTI4 134
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $125
+endproc trap_R_RegisterModel 4 8
+export trap_R_LerpTag
+proc trap_R_LerpTag 8 28
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 135
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $126
+endproc trap_R_LerpTag 8 28
+export trap_R_LerpTagFrameModel
+proc trap_R_LerpTagFrameModel 8 40
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 136
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $127
+endproc trap_R_LerpTagFrameModel 8 40
+export trap_R_LerpTagTorso
+proc trap_R_LerpTagTorso 12 64
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+ADDRFP4 56
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 137
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRFP4 40
+INDIRI4
+ARGI4
+ADDRFP4 44
+INDIRI4
+ARGI4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $128
+endproc trap_R_LerpTagTorso 12 64
+export trap_R_ModelBounds
+proc trap_R_ModelBounds 8 28
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 PASSFLOAT
+CALLI4
+ASGNI4
+CNSTI4 138
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $129
+endproc trap_R_ModelBounds 8 28
+export trap_ClientCommand
+proc trap_ClientCommand 0 12
+CNSTI4 125
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $130
+endproc trap_ClientCommand 0 12
+export trap_BotGetSnapshotEntity
+proc trap_BotGetSnapshotEntity 4 12
+CNSTI4 122
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $131
+endproc trap_BotGetSnapshotEntity 4 12
+export trap_BotGetServerCommand
+proc trap_BotGetServerCommand 4 16
+CNSTI4 123
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $132
+endproc trap_BotGetServerCommand 4 16
+export trap_BotUserCommand
+proc trap_BotUserCommand 0 12
+CNSTI4 124
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $133
+endproc trap_BotUserCommand 0 12
+export trap_PC_AddGlobalDefine
+proc trap_PC_AddGlobalDefine 4 8
+CNSTI4 33
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $134
+endproc trap_PC_AddGlobalDefine 4 8
+export trap_PC_RemoveGlobalDefine
+proc trap_PC_RemoveGlobalDefine 4 8
+CNSTI4 34
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $135
+endproc trap_PC_RemoveGlobalDefine 4 8
+export trap_PC_RemoveAllGlobalDefines
+proc trap_PC_RemoveAllGlobalDefines 0 4
+CNSTI4 35
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $136
+endproc trap_PC_RemoveAllGlobalDefines 0 4
+export trap_PC_LoadSource
+proc trap_PC_LoadSource 4 12
+CNSTI4 36
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $137
+endproc trap_PC_LoadSource 4 12
+export trap_PC_FreeSource
+proc trap_PC_FreeSource 4 8
+CNSTI4 37
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $138
+endproc trap_PC_FreeSource 4 8
+export trap_PC_AddDefine
+proc trap_PC_AddDefine 4 12
+CNSTI4 38
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $139
+endproc trap_PC_AddDefine 4 12
+export trap_PC_ReadToken
+proc trap_PC_ReadToken 4 12
+CNSTI4 39
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $140
+endproc trap_PC_ReadToken 4 12
+export trap_PC_UnreadToken
+proc trap_PC_UnreadToken 0 8
+CNSTI4 40
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $141
+endproc trap_PC_UnreadToken 0 8
+export trap_PC_SourceFileAndLine
+proc trap_PC_SourceFileAndLine 4 16
+CNSTI4 41
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $142
+endproc trap_PC_SourceFileAndLine 4 16
+export trap_HeapMalloc
+proc trap_HeapMalloc 4 8
+CNSTI4 42
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUP4 4
+RETP4
+LABELV $143
+endproc trap_HeapMalloc 4 8
+export trap_HeapAvailable
+proc trap_HeapAvailable 4 4
+CNSTI4 43
+ARGI4
+ADDRLP4 0
+ADDRGP4 syscall
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $144
+endproc trap_HeapAvailable 4 4
+export trap_HeapFree
+proc trap_HeapFree 0 8
+CNSTI4 44
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $145
+endproc trap_HeapFree 0 8
+export trap_Field_CompleteFilename
+proc trap_Field_CompleteFilename 0 20
+CNSTI4 45
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $146
+endproc trap_Field_CompleteFilename 0 20
+export trap_Field_CompleteCommand
+proc trap_Field_CompleteCommand 0 16
+CNSTI4 46
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $147
+endproc trap_Field_CompleteCommand 0 16
+export trap_Field_CompleteList
+proc trap_Field_CompleteList 0 8
+CNSTI4 47
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 syscall
+CALLI4
+pop
+LABELV $148
+endproc trap_Field_CompleteList 0 8
+import syscall
+import g_instagib
+import g_playerCapsule
+import g_proxMineTimeout
+import g_singlePlayer
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGamePlayers
+import g_maxplayers
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import trap_AAS_DropToFloor
+import trap_AAS_HorizontalVelocityForJump
+import trap_AAS_AgainstLadder
+import trap_AAS_JumpReachRunStart
+import trap_AAS_Swimming
+import trap_AAS_OnGround
+import trap_AAS_PredictPlayerMovement
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaTravelTime
+import trap_AAS_EnableRoutingArea
+import trap_AAS_RandomGoalArea
+import trap_AAS_ReachabilityFromNum
+import trap_AAS_NextAreaReachability
+import trap_AAS_AreaContentsTravelFlags
+import trap_AAS_TravelFlagForType
+import trap_AAS_AreaDoNotEnter
+import trap_AAS_AreaJumpPad
+import trap_AAS_AreaLadder
+import trap_AAS_AreaGrounded
+import trap_AAS_AreaSlime
+import trap_AAS_AreaLava
+import trap_AAS_AreaLiquid
+import trap_AAS_AreaSwim
+import trap_AAS_AreaCrouch
+import trap_AAS_AreaGroundFaceArea
+import trap_AAS_NextModelReachability
+import trap_AAS_BestReachableFromJumpPadArea
+import trap_AAS_BestReachableArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_TracePlayerBBox
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_FloodAreas
+import trap_AAS_ShowReachableAreas
+import trap_AAS_ShowReachability
+import trap_AAS_DrawArrow
+import trap_AAS_PrintTravelType
+import trap_AAS_DrawCross
+import trap_AAS_ShowAreaPolygons
+import trap_AAS_ShowArea
+import trap_AAS_ShowFace
+import trap_AAS_ShowBoundingBox
+import trap_AAS_DrawPlaneCross
+import trap_AAS_DrawPermanentCross
+import trap_AAS_PermanentLine
+import trap_AAS_DebugLine
+import trap_AAS_ClearShownPolygons
+import trap_AAS_ClearShownDebugLines
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_Loaded
+import trap_AAS_PointInsideArea
+import trap_AAS_BBoxReachabilityAreas
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import Pickup_Team
+import Svcmd_TeamInfoStats_f
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_BuildLocationTree
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotWeightBench_f
+import Svcmd_BotThinkReport_f
+import Svcmd_BotMatchBench_f
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownPlayer
+import BotAISetupPlayer
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import G_BotInitBotLib
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBotComplete
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunPlayer
+import PlayerEndFrame
+import PlayerThink
+import PlayerHandicap
+import ClientCommand
+import PlayerBegin
+import PlayerDisconnect
+import PlayerUserinfoChanged
+import PlayerConnect
+import G_Error
+import G_Printf
+import G_DPrintf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MovePlayerToIntermission
+import StringIsInteger
+import ConcatArgs
+import G_ScoreboardChanged
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import G_RegisterCommands
+import G_ConsoleCompleteArgument
+import G_ConsoleCommand
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import PlayerSpawn
+import InitBodyQue
+import BeginIntermission
+import PlayerRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetPlayerViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossPlayerCubes
+import TossPlayerGametypeItems
+import TossPlayerItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_SetBrushModel
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import trap_SendServerCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import FinishSpawningItem
+import G_SpawnItem
+import LaunchItem
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import trap_Cvar_Reset
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
@@ -0,0 +1,7670 @@
+export Team_InitGame
+code
+proc Team_InitGame 0 12
+ADDRGP4 teamgame
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 36
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+EQI4 $64
+ADDRGP4 $62
+JUMPV
+LABELV $64
+ADDRGP4 teamgame+8
+CNSTI4 -1
+ASGNI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRGP4 teamgame+12
+CNSTI4 -1
+ASGNI4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+LABELV $62
+LABELV $60
+endproc Team_InitGame 0 12
+export OtherTeam
+proc OtherTeam 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $68
+CNSTI4 2
+RETI4
+ADDRGP4 $67
+JUMPV
+LABELV $68
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $70
+CNSTI4 1
+RETI4
+ADDRGP4 $67
+JUMPV
+LABELV $70
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $67
+endproc OtherTeam 0 0
+export TeamName
+proc TeamName 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $73
+ADDRGP4 $75
+RETP4
+ADDRGP4 $72
+JUMPV
+LABELV $73
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $76
+ADDRGP4 $78
+RETP4
+ADDRGP4 $72
+JUMPV
+LABELV $76
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $79
+ADDRGP4 $81
+RETP4
+ADDRGP4 $72
+JUMPV
+LABELV $79
+ADDRGP4 $82
+RETP4
+LABELV $72
+endproc TeamName 0 0
+export TeamColorString
+proc TeamColorString 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $84
+ADDRGP4 $86
+RETP4
+ADDRGP4 $83
+JUMPV
+LABELV $84
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $87
+ADDRGP4 $89
+RETP4
+ADDRGP4 $83
+JUMPV
+LABELV $87
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $90
+ADDRGP4 $92
+RETP4
+ADDRGP4 $83
+JUMPV
+LABELV $90
+ADDRGP4 $93
+RETP4
+LABELV $83
+endproc TeamColorString 0 0
+proc PrintMsg 1048 16
+ADDRLP4 1028
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_vsnprintf
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CVIU4 4
+CNSTU4 1024
+LTU4 $96
+ADDRGP4 $98
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $96
+ADDRLP4 1028
+CNSTP4 0
+ASGNP4
+ADDRGP4 $100
+JUMPV
+LABELV $99
+ADDRLP4 0
+INDIRP4
+CNSTI1 39
+ASGNI1
+LABELV $100
+ADDRLP4 4
+ARGP4
+CNSTI4 34
+ARGI4
+ADDRLP4 1036
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $99
+ADDRGP4 $103
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $104
+ADDRLP4 1040
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $105
+JUMPV
+LABELV $104
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 720
+DIVI4
+ASGNI4
+LABELV $105
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $94
+endproc PrintMsg 1048 16
+export AddTeamScore
+proc AddTeamScore 52 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $107
+ADDRGP4 $106
+JUMPV
+LABELV $107
+ADDRLP4 4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 OtherTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 level+56
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 level+56
+ADDP4
+INDIRI4
+NEI4 $109
+ADDRLP4 4
+CNSTI4 12
+ASGNI4
+ADDRGP4 $110
+JUMPV
+LABELV $109
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 24
+ADDRFP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 level+56
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 level+56
+ADDP4
+INDIRI4
+LTI4 $113
+ADDRLP4 24
+INDIRI4
+ADDRGP4 level+56
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 level+56
+ADDP4
+INDIRI4
+GEI4 $113
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $120
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRGP4 $121
+JUMPV
+LABELV $120
+ADDRLP4 32
+CNSTI4 11
+ASGNI4
+LABELV $121
+ADDRLP4 4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $114
+JUMPV
+LABELV $113
+ADDRLP4 32
+CNSTI4 2
+ASGNI4
+ADDRLP4 36
+ADDRFP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 level+56
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 level+56
+ADDP4
+INDIRI4
+GTI4 $122
+ADDRLP4 36
+INDIRI4
+ADDRGP4 level+56
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 level+56
+ADDP4
+INDIRI4
+LEI4 $122
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $129
+ADDRLP4 44
+CNSTI4 10
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $129
+ADDRLP4 44
+CNSTI4 11
+ASGNI4
+LABELV $130
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $123
+JUMPV
+LABELV $122
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $131
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+EQI4 $131
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $135
+ADDRLP4 44
+CNSTI4 8
+ASGNI4
+ADDRGP4 $136
+JUMPV
+LABELV $135
+ADDRLP4 44
+CNSTI4 9
+ASGNI4
+LABELV $136
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $131
+LABELV $123
+LABELV $114
+LABELV $110
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $137
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 44
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 300
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $137
+ADDRLP4 44
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+56
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $106
+endproc AddTeamScore 52 8
+export OnSameTeam
+proc OnSameTeam 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $145
+ADDRLP4 8
+CNSTI4 332
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $145
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $145
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+NEU4 $141
+LABELV $145
+CNSTI4 0
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $141
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+GEI4 $146
+CNSTI4 0
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $146
+ADDRLP4 16
+CNSTI4 332
+ASGNI4
+ADDRLP4 20
+CNSTI4 636
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $149
+CNSTI4 1
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $149
+CNSTI4 0
+RETI4
+LABELV $140
+endproc OnSameTeam 24 0
+data
+align 1
+LABELV ctfFlagStatusRemap
+byte 1 48
+byte 1 49
+byte 1 42
+byte 1 42
+byte 1 50
+align 1
+LABELV oneFlagStatusRemap
+byte 1 48
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+export Team_SetFlagStatus
+code
+proc Team_SetFlagStatus 16 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $164
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $154
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $159
+ADDRGP4 $152
+JUMPV
+LABELV $154
+ADDRGP4 teamgame+8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $153
+ADDRGP4 teamgame+8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $153
+JUMPV
+LABELV $159
+ADDRGP4 teamgame+12
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $153
+ADDRGP4 teamgame+12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $153
+JUMPV
+LABELV $164
+ADDRGP4 teamgame+16
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $153
+ADDRGP4 teamgame+16
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $152
+LABELV $153
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $169
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $171
+ADDRLP4 12
+ADDRGP4 ctfFlagStatusRemap
+ASGNP4
+ADDRLP4 8
+ADDRGP4 teamgame+8
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8+1
+ADDRGP4 teamgame+12
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8+2
+CNSTI1 0
+ASGNI1
+ADDRGP4 $172
+JUMPV
+LABELV $171
+ADDRLP4 8
+ADDRGP4 teamgame+16
+INDIRI4
+ADDRGP4 oneFlagStatusRemap
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8+1
+CNSTI1 0
+ASGNI1
+LABELV $172
+CNSTI4 23
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $169
+LABELV $151
+endproc Team_SetFlagStatus 16 8
+export Team_CheckDroppedItem
+proc Team_CheckDroppedItem 0 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $181
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRGP4 $182
+JUMPV
+LABELV $181
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $183
+CNSTI4 2
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRGP4 $184
+JUMPV
+LABELV $183
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $185
+CNSTI4 0
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+LABELV $185
+LABELV $184
+LABELV $182
+LABELV $180
+endproc Team_CheckDroppedItem 0 8
+export Team_ForceGesture
+proc Team_ForceGesture 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $188
+ADDRLP4 0
+CNSTI4 720
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $192
+ADDRGP4 $189
+JUMPV
+LABELV $192
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $194
+ADDRGP4 $189
+JUMPV
+LABELV $194
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $196
+ADDRGP4 $189
+JUMPV
+LABELV $196
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32768
+BORI4
+ASGNI4
+LABELV $189
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $188
+LABELV $187
+endproc Team_ForceGesture 12 0
+export Team_FragBonuses
+proc Team_FragBonuses 272 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 64
+CNSTI4 332
+ASGNI4
+ADDRLP4 68
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 68
+INDIRU4
+EQU4 $203
+ADDRFP4 8
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 68
+INDIRU4
+EQU4 $203
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $203
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $199
+LABELV $203
+ADDRGP4 $198
+JUMPV
+LABELV $199
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+ASGNP4
+ADDRLP4 84
+CNSTI4 636
+ASGNI4
+ADDRLP4 52
+ADDRLP4 80
+INDIRP4
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 80
+INDIRP4
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 OtherTeam
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+GEI4 $204
+ADDRGP4 $198
+JUMPV
+LABELV $204
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+NEI4 $206
+ADDRLP4 16
+CNSTI4 7
+ASGNI4
+ADDRLP4 56
+CNSTI4 8
+ASGNI4
+ADDRGP4 $207
+JUMPV
+LABELV $206
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRLP4 56
+CNSTI4 7
+ASGNI4
+LABELV $207
+ADDRLP4 56
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $208
+ADDRFP4 8
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 620
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $211
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 560
+ADDP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $215
+JUMPV
+LABELV $212
+ADDRLP4 12
+CNSTI4 720
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $217
+ADDRLP4 12
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $217
+ADDRLP4 12
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 612
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $217
+LABELV $213
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $215
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxplayers+12
+INDIRI4
+LTI4 $212
+ADDRGP4 $198
+JUMPV
+LABELV $208
+ADDRLP4 92
+CNSTI4 332
+ASGNI4
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96
+INDIRF4
+CNSTF4 0
+EQF4 $219
+ADDRGP4 level+40
+INDIRI4
+CVIF4 4
+ADDRLP4 96
+INDIRF4
+SUBF4
+CNSTF4 1174011904
+GEF4 $219
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $219
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 612
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 88
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 220
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 108
+ADDRFP4 8
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 220
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRI4
+CNSTI4 65536
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1496
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRGP4 $198
+JUMPV
+LABELV $219
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+EQI4 $226
+ADDRLP4 100
+INDIRI4
+CNSTI4 2
+EQI4 $228
+ADDRGP4 $198
+JUMPV
+LABELV $226
+ADDRLP4 20
+ADDRGP4 $227
+ASGNP4
+ADDRGP4 $224
+JUMPV
+LABELV $228
+ADDRLP4 20
+ADDRGP4 $229
+ASGNP4
+LABELV $224
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $233
+JUMPV
+LABELV $230
+ADDRLP4 0
+CNSTI4 720
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+ADDRLP4 112
+INDIRI4
+EQI4 $235
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 112
+INDIRI4
+EQI4 $235
+ADDRGP4 $232
+JUMPV
+LABELV $235
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+LABELV $231
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $233
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxplayers+12
+INDIRI4
+LTI4 $230
+LABELV $232
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRGP4 $238
+JUMPV
+LABELV $237
+ADDRLP4 8
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $240
+ADDRGP4 $239
+JUMPV
+LABELV $240
+LABELV $238
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 340
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 108
+INDIRP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $237
+LABELV $239
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $242
+ADDRGP4 $198
+JUMPV
+LABELV $242
+ADDRLP4 116
+CNSTI4 44
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+CNSTI4 48
+ASGNI4
+ADDRLP4 28+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 128
+CNSTI4 52
+ASGNI4
+ADDRLP4 28+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+CNSTI4 44
+ASGNI4
+ADDRLP4 40
+ADDRFP4 8
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+CNSTI4 48
+ASGNI4
+ADDRLP4 40+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148
+CNSTI4 52
+ASGNI4
+ADDRLP4 40+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 152
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 152
+INDIRF4
+CNSTF4 1148846080
+GEF4 $251
+ADDRLP4 156
+CNSTI4 44
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $250
+LABELV $251
+ADDRLP4 40
+ARGP4
+ADDRLP4 164
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 164
+INDIRF4
+CNSTF4 1148846080
+GEF4 $248
+ADDRLP4 168
+CNSTI4 44
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 168
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 168
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $248
+LABELV $250
+ADDRLP4 176
+CNSTI4 332
+ASGNI4
+ADDRLP4 180
+CNSTI4 636
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 180
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 180
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $248
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 184
+ADDRFP4 8
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 88
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ADDRLP4 184
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 188
+ADDRFP4 8
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 220
+ADDP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ADDRLP4 188
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 192
+ADDRFP4 8
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 220
+ADDP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ADDRLP4 192
+INDIRP4
+INDIRI4
+CNSTI4 65536
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1496
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRGP4 $198
+JUMPV
+LABELV $248
+ADDRLP4 184
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 184
+INDIRU4
+CNSTU4 0
+EQU4 $253
+ADDRLP4 184
+INDIRU4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $253
+ADDRLP4 192
+CNSTI4 44
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ADDRLP4 192
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 192
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 200
+CNSTI4 48
+ASGNI4
+ADDRLP4 28+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 200
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 200
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 204
+CNSTI4 52
+ASGNI4
+ADDRLP4 28+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 212
+CNSTI4 44
+ASGNI4
+ADDRLP4 40
+ADDRFP4 8
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 220
+CNSTI4 48
+ASGNI4
+ADDRLP4 40+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 220
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 220
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 224
+CNSTI4 52
+ASGNI4
+ADDRLP4 40+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 224
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 224
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 228
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 228
+INDIRF4
+CNSTF4 1148846080
+GEF4 $262
+ADDRLP4 232
+CNSTI4 44
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 232
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 232
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 236
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 0
+NEI4 $261
+LABELV $262
+ADDRLP4 40
+ARGP4
+ADDRLP4 240
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 240
+INDIRF4
+CNSTF4 1148846080
+GEF4 $259
+ADDRLP4 244
+CNSTI4 44
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 244
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 244
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+EQI4 $259
+LABELV $261
+ADDRLP4 252
+CNSTI4 332
+ASGNI4
+ADDRLP4 256
+CNSTI4 636
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 256
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 252
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 256
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $259
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 260
+ADDRFP4 8
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 88
+ADDP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ADDRLP4 260
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 264
+ADDRFP4 8
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 220
+ADDP4
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ADDRLP4 264
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 268
+ADDRFP4 8
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 220
+ADDP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 268
+INDIRP4
+INDIRI4
+CNSTI4 65536
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1496
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $259
+LABELV $253
+LABELV $198
+endproc Team_FragBonuses 272 16
+export Team_CheckHurtCarrier
+proc Team_CheckHurtCarrier 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 332
+ASGNI4
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+EQU4 $267
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+NEU4 $265
+LABELV $267
+ADDRGP4 $264
+JUMPV
+LABELV $265
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $268
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRGP4 $269
+JUMPV
+LABELV $268
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+LABELV $269
+ADDRLP4 12
+CNSTI4 332
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $270
+ADDRLP4 20
+CNSTI4 636
+ASGNI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $270
+ADDRFP4 4
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 612
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $270
+ADDRLP4 24
+CNSTI4 332
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $273
+ADDRLP4 32
+CNSTI4 636
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $273
+ADDRFP4 4
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 612
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $273
+LABELV $264
+endproc Team_CheckHurtCarrier 36 0
+export Team_ResetFlag
+proc Team_ResetFlag 20 12
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $281
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $279
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $280
+ADDRGP4 $277
+JUMPV
+LABELV $279
+ADDRLP4 4
+ADDRGP4 $227
+ASGNP4
+ADDRGP4 $278
+JUMPV
+LABELV $280
+ADDRLP4 4
+ADDRGP4 $229
+ASGNP4
+ADDRGP4 $278
+JUMPV
+LABELV $281
+ADDRLP4 4
+ADDRGP4 $282
+ASGNP4
+ADDRGP4 $278
+JUMPV
+LABELV $277
+CNSTP4 0
+RETP4
+ADDRGP4 $276
+JUMPV
+LABELV $278
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $284
+JUMPV
+LABELV $283
+ADDRLP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $286
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 RespawnItem
+CALLV
+pop
+LABELV $287
+LABELV $284
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 340
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $283
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+RETP4
+LABELV $276
+endproc Team_ResetFlag 20 12
+export Team_ResetFlags
+proc Team_ResetFlags 0 4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $289
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_ResetFlag
+CALLP4
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 Team_ResetFlag
+CALLP4
+pop
+LABELV $289
+LABELV $288
+endproc Team_ResetFlags 0 4
+export Team_ReturnFlagSound
+proc Team_ReturnFlagSound 12 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $293
+ADDRGP4 $295
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $292
+JUMPV
+LABELV $293
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $296
+ADDRLP4 0
+INDIRP4
+CNSTI4 300
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $297
+JUMPV
+LABELV $296
+ADDRLP4 0
+INDIRP4
+CNSTI4 300
+ADDP4
+CNSTI4 3
+ASGNI4
+LABELV $297
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $292
+endproc Team_ReturnFlagSound 12 8
+export Team_TakeFlagSound
+proc Team_TakeFlagSound 16 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $299
+ADDRGP4 $301
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $298
+JUMPV
+LABELV $299
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $304
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $314
+ADDRGP4 $302
+JUMPV
+LABELV $304
+ADDRGP4 teamgame+12
+INDIRI4
+CNSTI4 0
+EQI4 $305
+ADDRGP4 teamgame+24
+INDIRI4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 10000
+SUBI4
+LEI4 $308
+ADDRGP4 $298
+JUMPV
+LABELV $308
+LABELV $305
+ADDRGP4 teamgame+24
+ADDRGP4 level+40
+INDIRI4
+ASGNI4
+ADDRGP4 $303
+JUMPV
+LABELV $314
+ADDRGP4 teamgame+8
+INDIRI4
+CNSTI4 0
+EQI4 $315
+ADDRGP4 teamgame+20
+INDIRI4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 10000
+SUBI4
+LEI4 $318
+ADDRGP4 $298
+JUMPV
+LABELV $318
+LABELV $315
+ADDRGP4 teamgame+20
+ADDRGP4 level+40
+INDIRI4
+ASGNI4
+LABELV $302
+LABELV $303
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 8
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $324
+ADDRLP4 0
+INDIRP4
+CNSTI4 300
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $325
+JUMPV
+LABELV $324
+ADDRLP4 0
+INDIRP4
+CNSTI4 300
+ADDP4
+CNSTI4 5
+ASGNI4
+LABELV $325
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $298
+endproc Team_TakeFlagSound 16 8
+export Team_CaptureFlagSound
+proc Team_CaptureFlagSound 12 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $327
+ADDRGP4 $329
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $326
+JUMPV
+LABELV $327
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $330
+ADDRLP4 0
+INDIRP4
+CNSTI4 300
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $331
+JUMPV
+LABELV $330
+ADDRLP4 0
+INDIRP4
+CNSTI4 300
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $331
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $326
+endproc Team_CaptureFlagSound 12 8
+export Team_ReturnFlag
+proc Team_ReturnFlag 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 Team_ResetFlag
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Team_ReturnFlagSound
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $333
+CNSTP4 0
+ARGP4
+ADDRGP4 $335
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRGP4 $334
+JUMPV
+LABELV $333
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+LABELV $334
+LABELV $332
+endproc Team_ReturnFlag 8 12
+export Team_FreeEntity
+proc Team_FreeEntity 0 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $338
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRGP4 $339
+JUMPV
+LABELV $338
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $340
+CNSTI4 2
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRGP4 $341
+JUMPV
+LABELV $340
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $342
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+LABELV $342
+LABELV $341
+LABELV $339
+LABELV $337
+endproc Team_FreeEntity 0 4
+export Team_DroppedFlagThink
+proc Team_DroppedFlagThink 8 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $345
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $346
+JUMPV
+LABELV $345
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $347
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $348
+JUMPV
+LABELV $347
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $349
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $349
+LABELV $348
+LABELV $346
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 Team_ResetFlag
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Team_ReturnFlagSound
+CALLV
+pop
+LABELV $344
+endproc Team_DroppedFlagThink 8 8
+export Team_TouchOurFlag
+proc Team_TouchOurFlag 64 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $352
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRGP4 $353
+JUMPV
+LABELV $352
+ADDRLP4 12
+CNSTI4 7
+ASGNI4
+LABELV $353
+ADDRFP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $354
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $356
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 560
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Team_ResetFlag
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Team_ReturnFlagSound
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $351
+JUMPV
+LABELV $354
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $358
+CNSTI4 0
+RETI4
+ADDRGP4 $351
+JUMPV
+LABELV $358
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 OtherTeam
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+ADDRGP4 $360
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 560
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 teamgame
+ADDRGP4 level+40
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 teamgame+4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddTeamScore
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Team_ForceGesture
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 220
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 220
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1496
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 4
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 100
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Team_CaptureFlagSound
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $367
+JUMPV
+LABELV $364
+ADDRLP4 0
+CNSTI4 720
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $371
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+NEU4 $369
+LABELV $371
+ADDRGP4 $365
+JUMPV
+LABELV $369
+ADDRLP4 44
+CNSTI4 636
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $372
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 612
+ADDP4
+CNSTF4 3231711232
+ASGNF4
+ADDRGP4 $373
+JUMPV
+LABELV $372
+ADDRLP4 48
+CNSTI4 636
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $374
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRF4
+CNSTF4 1176256512
+ADDF4
+ADDRGP4 level+40
+INDIRI4
+CVIF4 4
+LEF4 $376
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 220
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 220
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 131072
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1496
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $376
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRF4
+CNSTF4 1176256512
+ADDF4
+ADDRGP4 level+40
+INDIRI4
+CVIF4 4
+LEF4 $380
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 220
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 220
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 131072
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1496
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $380
+LABELV $374
+LABELV $373
+LABELV $365
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $367
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxplayers+12
+INDIRI4
+LTI4 $364
+ADDRGP4 Team_ResetFlags
+CALLV
+pop
+ADDRGP4 CalculateRanks
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $351
+endproc Team_TouchOurFlag 64 16
+export Team_TouchEnemyFlag
+proc Team_TouchEnemyFlag 8 16
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $385
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 560
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $386
+ADDRLP4 0
+INDIRP4
+CNSTI4 376
+ADDP4
+CNSTI4 2147483647
+ASGNI4
+ADDRGP4 $387
+JUMPV
+LABELV $386
+ADDRLP4 0
+INDIRP4
+CNSTI4 380
+ADDP4
+CNSTI4 2147483647
+ASGNI4
+LABELV $387
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Team_TakeFlagSound
+CALLV
+pop
+CNSTI4 -1
+RETI4
+LABELV $384
+endproc Team_TouchEnemyFlag 8 16
+export Pickup_Team
+proc Pickup_Team 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $227
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $389
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $390
+JUMPV
+LABELV $389
+ADDRFP4 0
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $229
+ARGP4
+ADDRLP4 12
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $391
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $392
+JUMPV
+LABELV $391
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $393
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $388
+JUMPV
+LABELV $392
+LABELV $390
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+NEI4 $394
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 Team_TouchOurFlag
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $388
+JUMPV
+LABELV $394
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 Team_TouchEnemyFlag
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $388
+endproc Pickup_Team 20 12
+proc Team_LocationCompare 24 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 locationSortAxis
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRF4
+GEF4 $399
+CNSTI4 -1
+RETI4
+ADDRGP4 $398
+JUMPV
+LABELV $399
+ADDRLP4 12
+ADDRGP4 locationSortAxis
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRF4
+LEF4 $401
+CNSTI4 1
+RETI4
+ADDRGP4 $398
+JUMPV
+LABELV $401
+ADDRLP4 16
+CNSTI4 16
+ASGNI4
+ADDRLP4 20
+CNSTI4 84
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+RETI4
+LABELV $398
+endproc Team_LocationCompare 24 0
+proc Team_BuildLocationTree_r 48 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+SUBI4
+CNSTI4 1
+GTI4 $404
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+LEI4 $403
+CNSTI4 20
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 locationNodes+12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $403
+JUMPV
+LABELV $404
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ClearBounds
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $412
+JUMPV
+LABELV $409
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 locationNodes
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 AddPointToBounds
+CALLV
+pop
+LABELV $410
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $412
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $409
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $413
+ADDRLP4 36
+CNSTI4 2
+ASGNI4
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 28
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 16
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 16
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+SUBF4
+LEF4 $417
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $417
+LABELV $414
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $413
+ADDRGP4 locationSortAxis
+ADDRLP4 28
+INDIRI4
+ASGNI4
+CNSTI4 20
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 locationNodes
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+SUBI4
+CVIU4 4
+ARGU4
+CNSTU4 20
+ARGU4
+ADDRGP4 Team_LocationCompare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRLP4 32
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+CNSTI4 2
+DIVI4
+ASGNI4
+CNSTI4 20
+ADDRLP4 32
+INDIRI4
+MULI4
+ADDRGP4 locationNodes+12
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 Team_BuildLocationTree_r
+CALLV
+pop
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Team_BuildLocationTree_r
+CALLV
+pop
+LABELV $403
+endproc Team_BuildLocationTree_r 48 16
+export Team_BuildLocationTree
+proc Team_BuildLocationTree 8 8
+ADDRGP4 numLocationNodes
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 level+9192
+INDIRP4
+ASGNP4
+ADDRGP4 $424
+JUMPV
+LABELV $421
+CNSTI4 20
+ADDRGP4 numLocationNodes
+INDIRI4
+MULI4
+ADDRGP4 locationNodes
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 20
+ADDRGP4 numLocationNodes
+INDIRI4
+MULI4
+ADDRGP4 locationNodes+16
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 numLocationNodes
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $422
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 420
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $424
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $421
+CNSTI4 0
+ARGI4
+ADDRGP4 numLocationNodes
+INDIRI4
+ARGI4
+ADDRGP4 Team_BuildLocationTree_r
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 locationTreeCount
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $420
+endproc Team_BuildLocationTree 8 8
+proc Team_NearestLocation_r 76 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $428
+ADDRGP4 $427
+JUMPV
+LABELV $428
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 20
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 locationNodes
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GEF4 $430
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Team_NearestLocation_r
+CALLV
+pop
+ADDRGP4 $431
+JUMPV
+LABELV $430
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Team_NearestLocation_r
+CALLV
+pop
+LABELV $431
+ADDRLP4 36
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRLP4 44
+ADDRFP4 8
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 8
+ASGNI4
+ADDRLP4 52
+ADDRFP4 8
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 36
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 60
+INDIRF4
+LTF4 $435
+ADDRLP4 12
+INDIRF4
+ADDRLP4 60
+INDIRF4
+NEF4 $432
+ADDRLP4 64
+ADDRFP4 12
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $435
+ADDRLP4 68
+CNSTI4 84
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $432
+LABELV $435
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $436
+ADDRFP4 16
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $436
+LABELV $432
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+GTF4 $438
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GEF4 $440
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Team_NearestLocation_r
+CALLV
+pop
+ADDRGP4 $441
+JUMPV
+LABELV $440
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Team_NearestLocation_r
+CALLV
+pop
+LABELV $441
+LABELV $438
+LABELV $427
+endproc Team_NearestLocation_r 76 20
+export Team_GetLocation
+proc Team_GetLocation 48 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $443
+CNSTP4 0
+RETP4
+ADDRGP4 $442
+JUMPV
+LABELV $443
+ADDRGP4 level+9188
+INDIRI4
+CNSTI4 0
+NEI4 $445
+CNSTP4 0
+RETP4
+ADDRGP4 $442
+JUMPV
+LABELV $445
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $448
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 1115684864
+DIVF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $449
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $448
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 64
+GEI4 $452
+ADDRLP4 28
+CNSTI4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 locationCache
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ADDRGP4 locationTreeCount
+INDIRI4
+NEI4 $454
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $454
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 16+4
+INDIRI4
+NEI4 $454
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 16+8
+INDIRI4
+NEI4 $454
+ADDRLP4 28
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $442
+JUMPV
+LABELV $454
+LABELV $452
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+ADDRLP4 36
+CNSTF4 1296039936
+ASGNF4
+CNSTI4 0
+ARGI4
+ADDRGP4 numLocationNodes
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 Team_NearestLocation_r
+CALLV
+pop
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $458
+ADDRLP4 28
+INDIRP4
+ADDRGP4 locationTreeCount
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRLP4 28
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 32
+INDIRP4
+ASGNP4
+LABELV $458
+ADDRLP4 32
+INDIRP4
+RETP4
+LABELV $442
+endproc Team_GetLocation 48 20
+export Team_GetLocationMsg
+proc Team_GetLocationMsg 12 24
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Team_GetLocation
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $461
+CNSTI4 0
+RETI4
+ADDRGP4 $460
+JUMPV
+LABELV $461
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $463
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $465
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $465
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRI4
+CNSTI4 7
+LEI4 $467
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $467
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $469
+ARGP4
+CNSTI4 94
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRI4
+CNSTI4 48
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $464
+JUMPV
+LABELV $463
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $470
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $464
+CNSTI4 1
+RETI4
+LABELV $460
+endproc Team_GetLocationMsg 12 24
+export SelectRandomTeamSpawnPoint
+proc SelectRandomTeamSpawnPoint 152 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $472
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $474
+ADDRLP4 8
+ADDRGP4 $476
+ASGNP4
+ADDRGP4 $473
+JUMPV
+LABELV $474
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $477
+ADDRLP4 8
+ADDRGP4 $479
+ASGNP4
+ADDRGP4 $473
+JUMPV
+LABELV $477
+CNSTP4 0
+RETP4
+ADDRGP4 $471
+JUMPV
+LABELV $472
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $480
+ADDRLP4 8
+ADDRGP4 $482
+ASGNP4
+ADDRGP4 $481
+JUMPV
+LABELV $480
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $483
+ADDRLP4 8
+ADDRGP4 $485
+ASGNP4
+ADDRGP4 $484
+JUMPV
+LABELV $483
+CNSTP4 0
+RETP4
+ADDRGP4 $471
+JUMPV
+LABELV $484
+LABELV $481
+LABELV $473
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $487
+JUMPV
+LABELV $486
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 SpotWouldTelefrag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $489
+ADDRGP4 $487
+JUMPV
+LABELV $489
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 32
+NEI4 $491
+ADDRGP4 $488
+JUMPV
+LABELV $491
+LABELV $487
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 340
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $486
+LABELV $488
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $493
+CNSTP4 0
+ARGP4
+CNSTI4 340
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+RETP4
+ADDRGP4 $471
+JUMPV
+LABELV $493
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 148
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRP4
+RETP4
+LABELV $471
+endproc SelectRandomTeamSpawnPoint 152 12
+export SelectCTFSpawnPoint
+proc SelectCTFSpawnPoint 12 16
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 SelectRandomTeamSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $496
+ADDRGP4 vec3_origin
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 SelectSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+RETP4
+ADDRGP4 $495
+JUMPV
+LABELV $496
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $495
+endproc SelectCTFSpawnPoint 12 16
+proc Team_BuildTeamInfo 1100 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+CNSTI4 17952
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 teamInfos
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 8972
+ADDRLP4 1060
+INDIRP4
+CNSTI4 17948
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 1060
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+INDIRI4
+ADDRGP4 level+40
+INDIRI4
+NEI4 $501
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $501
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $500
+JUMPV
+LABELV $501
+ADDRLP4 1060
+INDIRP4
+ADDRGP4 level+40
+INDIRI4
+ASGNI4
+ADDRGP4 teamInfoVersion
+INDIRI4
+CNSTI4 0
+NEI4 $505
+ADDRLP4 1068
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRGP4 teamInfoVersion
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+LABELV $505
+ADDRLP4 8
+CNSTI4 8972
+ADDRLP4 1060
+INDIRP4
+CNSTI4 17948
+ADDP4
+INDIRI4
+CNSTI4 1
+BXORI4
+MULI4
+ADDRLP4 1060
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 780
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+INDIRP4
+CNSTI4 776
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 1072
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRGP4 $510
+JUMPV
+LABELV $507
+ADDRLP4 16
+CNSTI4 720
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $512
+ADDRLP4 16
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $512
+ADDRLP4 1080
+ADDRLP4 16
+INDIRP4
+CNSTI4 332
+ADDP4
+ASGNP4
+ADDRLP4 1052
+ADDRLP4 1080
+INDIRP4
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+ADDRLP4 1080
+INDIRP4
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+GEI4 $514
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+LABELV $514
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+GEI4 $516
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+LABELV $516
+ADDRLP4 12
+CNSTI4 24
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 608
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 312
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $518
+ARGP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 1088
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 1088
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CVIU4 4
+CNSTU4 8192
+LTU4 $519
+ADDRGP4 $509
+JUMPV
+LABELV $519
+ADDRLP4 8
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 780
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 1096
+ADDRLP4 8
+INDIRP4
+CNSTI4 776
+ADDP4
+ASGNP4
+ADDRLP4 1096
+INDIRP4
+ADDRLP4 1096
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $512
+LABELV $508
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $510
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxplayers+12
+INDIRI4
+GEI4 $521
+ADDRLP4 24
+INDIRI4
+CNSTI4 32
+LTI4 $507
+LABELV $521
+LABELV $509
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $522
+ADDRLP4 1080
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 1080
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 1080
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $522
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $527
+JUMPV
+LABELV $524
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $528
+ADDRLP4 1084
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1088
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 1092
+CNSTI4 8
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+ADDRLP4 1088
+INDIRI4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 1092
+INDIRI4
+ADDP4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 1084
+INDIRI4
+ADDRLP4 1088
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 1092
+INDIRI4
+ADDP4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $532
+ADDRGP4 $530
+JUMPV
+LABELV $532
+LABELV $529
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $528
+LABELV $530
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+GEI4 $534
+ADDRGP4 $526
+JUMPV
+LABELV $534
+LABELV $525
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $527
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $524
+LABELV $526
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+NEI4 $536
+ADDRLP4 20
+INDIRP4
+RETP4
+ADDRGP4 $500
+JUMPV
+LABELV $536
+LABELV $522
+ADDRLP4 1084
+ADDRGP4 teamInfoVersion
+ASGNP4
+ADDRLP4 1088
+ADDRLP4 1084
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1084
+INDIRP4
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRLP4 1092
+ADDRLP4 1060
+INDIRP4
+CNSTI4 17948
+ADDP4
+ASGNP4
+ADDRLP4 1092
+INDIRP4
+ADDRLP4 1092
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+RETP4
+LABELV $500
+endproc Team_BuildTeamInfo 1100 36
+proc Team_TeamInfoDeltaMessage 2092 40
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+CNSTI1 0
+ASGNI1
+ADDRLP4 2072
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 2072
+INDIRI4
+ASGNI4
+ADDRLP4 2068
+ADDRLP4 2072
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 2072
+INDIRI4
+ASGNI4
+ADDRGP4 $542
+JUMPV
+LABELV $539
+ADDRLP4 4
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+GEI4 $543
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $545
+ADDRLP4 2080
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 2080
+INDIRI4
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 2080
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRI4
+EQI4 $549
+ADDRGP4 $547
+JUMPV
+LABELV $549
+LABELV $546
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $545
+LABELV $547
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+NEI4 $551
+ADDRGP4 $540
+JUMPV
+LABELV $551
+LABELV $543
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 2084
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1040
+ADDRLP4 2084
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 2088
+ADDRLP4 12
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 2088
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRI4
+GEI4 $556
+ADDRLP4 2088
+INDIRI4
+CVIU4 4
+CNSTU4 1024
+LTU4 $554
+LABELV $556
+CNSTI4 0
+RETI4
+ADDRGP4 $538
+JUMPV
+LABELV $554
+ADDRLP4 12
+INDIRI4
+ADDRLP4 1044
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 2068
+ADDRLP4 2068
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $540
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $542
+ADDRLP4 8
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $539
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 $557
+ARGP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2068
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 1
+RETI4
+LABELV $538
+endproc Team_TeamInfoDeltaMessage 2092 40
+export TeamplayInfoMessage
+proc TeamplayInfoMessage 1112 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $559
+ADDRGP4 $558
+JUMPV
+LABELV $559
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $561
+ADDRLP4 1052
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $565
+ADDRLP4 1052
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $563
+LABELV $565
+ADDRGP4 $558
+JUMPV
+LABELV $563
+ADDRLP4 8
+CNSTI4 720
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+332
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $562
+JUMPV
+LABELV $561
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $562
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $567
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+EQI4 $567
+ADDRGP4 $558
+JUMPV
+LABELV $567
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ADDRGP4 Team_BuildTeamInfo
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+CNSTI4 17952
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 teamInfos
+ADDP4
+ASGNP4
+ADDRLP4 1068
+CNSTI4 4
+ASGNI4
+ADDRLP4 1048
+CNSTI4 8972
+ADDRLP4 1044
+INDIRP4
+CNSTI4 17948
+ADDP4
+INDIRI4
+CNSTI4 1
+BXORI4
+MULI4
+ADDRLP4 1044
+INDIRP4
+ADDRLP4 1068
+INDIRI4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 720
+DIVI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 teamInfoSentVersion
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $569
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 1068
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 780
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 1076
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 1076
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1084
+ADDRGP4 teamInfoBytesFull
+ASGNP4
+ADDRLP4 1084
+INDIRP4
+ADDRLP4 1084
+INDIRP4
+INDIRI4
+CVIU4 4
+ADDRLP4 1080
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+NEI4 $570
+ADDRGP4 level+40
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 teamInfoSentTime
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 3000
+GEI4 $570
+ADDRLP4 1088
+ADDRGP4 teamInfoSkippedCommands
+ASGNP4
+ADDRLP4 1088
+INDIRP4
+ADDRLP4 1088
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $558
+JUMPV
+LABELV $570
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 teamInfoSentVersion
+ADDP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 level+40
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 teamInfoSentTime
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 3000
+GEI4 $573
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $573
+ADDRLP4 16
+INDIRI4
+ADDRLP4 1048
+INDIRP4
+INDIRI4
+NEI4 $573
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1096
+ADDRGP4 Team_TeamInfoDeltaMessage
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+EQI4 $573
+ADDRLP4 1100
+ADDRGP4 teamInfoDeltaCommands
+ASGNP4
+ADDRLP4 1100
+INDIRP4
+ADDRLP4 1100
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 1104
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1108
+ADDRGP4 teamInfoBytesSent
+ASGNP4
+ADDRLP4 1108
+INDIRP4
+ADDRLP4 1108
+INDIRP4
+INDIRI4
+CVIU4 4
+ADDRLP4 1104
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $558
+JUMPV
+LABELV $573
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 teamInfoSentTime
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+ASGNI4
+ADDRLP4 1100
+ADDRGP4 teamInfoFullCommands
+ASGNP4
+ADDRLP4 1100
+INDIRP4
+ADDRLP4 1100
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 1104
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1108
+ADDRGP4 teamInfoBytesSent
+ASGNP4
+ADDRLP4 1108
+INDIRP4
+ADDRLP4 1108
+INDIRP4
+INDIRI4
+CVIU4 4
+ADDRLP4 1104
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $558
+endproc TeamplayInfoMessage 1112 20
+export Svcmd_TeamInfoStats_f
+proc Svcmd_TeamInfoStats_f 12 16
+ADDRLP4 0
+ADDRGP4 teamInfoFullCommands
+INDIRI4
+ADDRGP4 teamInfoDeltaCommands
+INDIRI4
+ADDI4
+ADDRGP4 teamInfoSkippedCommands
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $578
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $579
+ARGP4
+ADDRGP4 teamInfoFullCommands
+INDIRI4
+ARGI4
+ADDRGP4 teamInfoDeltaCommands
+INDIRI4
+ARGI4
+ADDRGP4 teamInfoSkippedCommands
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $580
+ARGP4
+ADDRLP4 4
+ADDRGP4 teamInfoBytesSent
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 teamInfoBytesFull
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $577
+endproc Svcmd_TeamInfoStats_f 12 16
+export CheckTeamStatus
+proc CheckTeamStatus 24 4
+ADDRGP4 level+40
+INDIRI4
+ADDRGP4 level+72
+INDIRI4
+SUBI4
+CNSTI4 1000
+LEI4 $582
+ADDRGP4 level+72
+ADDRGP4 level+40
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $591
+JUMPV
+LABELV $588
+ADDRLP4 0
+CNSTI4 720
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $593
+ADDRGP4 $589
+JUMPV
+LABELV $593
+ADDRLP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $595
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+EQI4 $597
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $595
+LABELV $597
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Team_GetLocation
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $598
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 608
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $599
+JUMPV
+LABELV $598
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 608
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $599
+LABELV $595
+LABELV $589
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $591
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxplayers+12
+INDIRI4
+LTI4 $588
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $603
+JUMPV
+LABELV $600
+ADDRLP4 0
+CNSTI4 720
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $605
+ADDRGP4 $601
+JUMPV
+LABELV $605
+ADDRLP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $607
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 TeamplayInfoMessage
+CALLV
+pop
+LABELV $607
+LABELV $601
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $603
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxplayers+12
+INDIRI4
+LTI4 $600
+LABELV $582
+LABELV $581
+endproc CheckTeamStatus 24 4
+export SP_team_CTF_redplayer
+proc SP_team_CTF_redplayer 0 0
+LABELV $609
+endproc SP_team_CTF_redplayer 0 0
+export SP_team_CTF_blueplayer
+proc SP_team_CTF_blueplayer 0 0
+LABELV $610
+endproc SP_team_CTF_blueplayer 0 0
+export SP_team_CTF_redspawn
+proc SP_team_CTF_redspawn 0 0
+LABELV $611
+endproc SP_team_CTF_redspawn 0 0
+export SP_team_CTF_bluespawn
+proc SP_team_CTF_bluespawn 0 0
+LABELV $612
+endproc SP_team_CTF_bluespawn 0 0
+bss
+align 4
+LABELV teamInfoBytesFull
+skip 4
+align 4
+LABELV teamInfoBytesSent
+skip 4
+align 4
+LABELV teamInfoSkippedCommands
+skip 4
+align 4
+LABELV teamInfoDeltaCommands
+skip 4
+align 4
+LABELV teamInfoFullCommands
+skip 4
+align 4
+LABELV teamInfoSentTime
+skip 256
+align 4
+LABELV teamInfoSentVersion
+skip 256
+align 4
+LABELV teamInfoVersion
+skip 4
+align 4
+LABELV teamInfos
+skip 71808
+align 4
+LABELV locationCache
+skip 1280
+align 4
+LABELV locationSortAxis
+skip 4
+align 4
+LABELV locationTreeCount
+skip 4
+align 4
+LABELV numLocationNodes
+skip 4
+align 4
+LABELV locationNodes
+skip 81920
+export neutralObelisk
+align 4
+LABELV neutralObelisk
+skip 4
+export teamgame
+align 4
+LABELV teamgame
+skip 36
+import g_instagib
+import g_playerCapsule
+import g_proxMineTimeout
+import g_singlePlayer
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGamePlayers
+import g_maxplayers
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import trap_AAS_DropToFloor
+import trap_AAS_HorizontalVelocityForJump
+import trap_AAS_AgainstLadder
+import trap_AAS_JumpReachRunStart
+import trap_AAS_Swimming
+import trap_AAS_OnGround
+import trap_AAS_PredictPlayerMovement
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaTravelTime
+import trap_AAS_EnableRoutingArea
+import trap_AAS_RandomGoalArea
+import trap_AAS_ReachabilityFromNum
+import trap_AAS_NextAreaReachability
+import trap_AAS_AreaContentsTravelFlags
+import trap_AAS_TravelFlagForType
+import trap_AAS_AreaDoNotEnter
+import trap_AAS_AreaJumpPad
+import trap_AAS_AreaLadder
+import trap_AAS_AreaGrounded
+import trap_AAS_AreaSlime
+import trap_AAS_AreaLava
+import trap_AAS_AreaLiquid
+import trap_AAS_AreaSwim
+import trap_AAS_AreaCrouch
+import trap_AAS_AreaGroundFaceArea
+import trap_AAS_NextModelReachability
+import trap_AAS_BestReachableFromJumpPadArea
+import trap_AAS_BestReachableArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_TracePlayerBBox
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_FloodAreas
+import trap_AAS_ShowReachableAreas
+import trap_AAS_ShowReachability
+import trap_AAS_DrawArrow
+import trap_AAS_PrintTravelType
+import trap_AAS_DrawCross
+import trap_AAS_ShowAreaPolygons
+import trap_AAS_ShowArea
+import trap_AAS_ShowFace
+import trap_AAS_ShowBoundingBox
+import trap_AAS_DrawPlaneCross
+import trap_AAS_DrawPermanentCross
+import trap_AAS_PermanentLine
+import trap_AAS_DebugLine
+import trap_AAS_ClearShownPolygons
+import trap_AAS_ClearShownDebugLines
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_Loaded
+import trap_AAS_PointInsideArea
+import trap_AAS_BBoxReachabilityAreas
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_RegisterModel
+import trap_DebugPolygonDelete
+import trap_DebugPolygonShow
+import trap_DebugPolygonCreate
+import trap_ClientCommand
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_ClipToEntitiesCapsule
+import trap_ClipToEntities
+import trap_TraceCapsule
+import trap_Trace
+import trap_GetBrushBounds
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_SetConfigstringRestrictions
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommandEx
+import trap_DropPlayer
+import trap_SetNetFields
+import trap_LocateGameData
+import Svcmd_BotWeightBench_f
+import Svcmd_BotThinkReport_f
+import Svcmd_BotMatchBench_f
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownPlayer
+import BotAISetupPlayer
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import G_BotInitBotLib
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBotComplete
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import CheckObeliskAttack
+import G_RunPlayer
+import PlayerEndFrame
+import PlayerThink
+import PlayerHandicap
+import ClientCommand
+import PlayerBegin
+import PlayerDisconnect
+import PlayerUserinfoChanged
+import PlayerConnect
+import G_Error
+import G_Printf
+import G_DPrintf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MovePlayerToIntermission
+import StringIsInteger
+import ConcatArgs
+import G_ScoreboardChanged
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import G_RegisterCommands
+import G_ConsoleCompleteArgument
+import G_ConsoleCommand
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import PlayerSpawn
+import InitBodyQue
+import BeginIntermission
+import PlayerRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetPlayerViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossPlayerCubes
+import TossPlayerGametypeItems
+import TossPlayerItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_SetBrushModel
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import trap_SendServerCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import FinishSpawningItem
+import G_SpawnItem
+import LaunchItem
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $580
+byte 1 32
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $579
+byte 1 32
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 97
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $578
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $569
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $557
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $553
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $518
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $485
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $482
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $479
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $476
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $470
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $469
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $393
+byte 1 68
+byte 1 111
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $385
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $360
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 10
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $356
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $336
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $335
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $329
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $301
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 84
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $295
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $282
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $229
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $227
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $211
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $103
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $98
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 77
+byte 1 115
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $93
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $92
+byte 1 94
+byte 1 51
+byte 1 0
+align 1
+LABELV $89
+byte 1 94
+byte 1 52
+byte 1 0
+align 1
+LABELV $86
+byte 1 94
+byte 1 49
+byte 1 0
+align 1
+LABELV $82
+byte 1 70
+byte 1 82
+byte 1 69
+byte 1 69
+byte 1 0
+align 1
+LABELV $81
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 65
+byte 1 84
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $78
+byte 1 66
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 0
+align 1
+LABELV $75
+byte 1 82
+byte 1 69
+byte 1 68
+byte 1 0
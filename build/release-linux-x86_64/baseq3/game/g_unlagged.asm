@@ -0,0 +1,3827 @@
+export G_ResetHistory
+code
+proc G_ResetHistory 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 672
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 level+40
+INDIRI4
+ASGNI4
+ADDRGP4 $64
+JUMPV
+LABELV $61
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ADDP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ADDP4
+CNSTI4 36
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $62
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+SUBI4
+ASGNI4
+LABELV $64
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $61
+LABELV $60
+endproc G_ResetHistory 20 0
+export G_StoreHistory
+proc G_StoreHistory 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 672
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRI4
+CNSTI4 17
+LTI4 $67
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 672
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $67
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ADDP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ADDP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 28
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ADDP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 32
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ADDP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ADDP4
+CNSTI4 36
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+ASGNI4
+LABELV $66
+endproc G_StoreHistory 36 0
+proc TimeShiftLerp 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRLP4 16
+INDIRF4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $70
+endproc TimeShiftLerp 20 0
+export G_TimeShiftClient
+proc G_TimeShiftClient 2172 80
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 2056
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 2056
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2056
+INDIRI4
+ASGNI4
+LABELV $72
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ADDP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+GTI4 $75
+ADDRGP4 $74
+JUMPV
+LABELV $75
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $77
+ADDRLP4 0
+CNSTI4 16
+ASGNI4
+LABELV $77
+LABELV $73
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRI4
+NEI4 $72
+LABELV $74
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $79
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1392
+ADDP4
+INDIRI4
+ADDRGP4 level+40
+INDIRI4
+EQI4 $81
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1356
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1368
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1380
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1392
+ADDP4
+ADDRGP4 level+40
+INDIRI4
+ASGNI4
+LABELV $81
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRI4
+EQI4 $85
+ADDRLP4 2064
+CNSTI4 40
+ASGNI4
+ADDRLP4 2068
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ASGNP4
+ADDRLP4 2072
+CNSTI4 36
+ASGNI4
+ADDRLP4 2076
+ADDRLP4 2064
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 2068
+INDIRP4
+ADDP4
+ADDRLP4 2072
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 2060
+ADDRFP4 4
+INDIRI4
+ADDRLP4 2076
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 2064
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 2068
+INDIRP4
+ADDP4
+ADDRLP4 2072
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 2076
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 2060
+INDIRF4
+ARGF4
+ADDRLP4 2080
+CNSTI4 40
+ASGNI4
+ADDRLP4 2088
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ASGNP4
+ADDRLP4 2092
+CNSTI4 24
+ASGNI4
+ADDRLP4 2080
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 2088
+INDIRP4
+ADDP4
+ADDRLP4 2092
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 2080
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 2088
+INDIRP4
+ADDP4
+ADDRLP4 2092
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ARGP4
+ADDRGP4 TimeShiftLerp
+CALLV
+pop
+ADDRLP4 2060
+INDIRF4
+ARGF4
+ADDRLP4 2096
+CNSTI4 40
+ASGNI4
+ADDRLP4 2104
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ASGNP4
+ADDRLP4 2096
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 2104
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 2096
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 2104
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ARGP4
+ADDRGP4 TimeShiftLerp
+CALLV
+pop
+ADDRLP4 2060
+INDIRF4
+ARGF4
+ADDRLP4 2108
+CNSTI4 40
+ASGNI4
+ADDRLP4 2116
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ASGNP4
+ADDRLP4 2120
+CNSTI4 12
+ASGNI4
+ADDRLP4 2108
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 2116
+INDIRP4
+ADDP4
+ADDRLP4 2120
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 2108
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 2116
+INDIRP4
+ADDP4
+ADDRLP4 2120
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRGP4 TimeShiftLerp
+CALLV
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $87
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $87
+ADDRLP4 8
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRGP4 $89
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 2128
+CNSTI4 40
+ASGNI4
+ADDRLP4 2136
+CNSTI4 332
+ASGNI4
+ADDRLP4 2140
+ADDRFP4 0
+INDIRP4
+ADDRLP4 2136
+INDIRI4
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ASGNP4
+ADDRLP4 2144
+ADDRLP4 2128
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 2140
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 2148
+CNSTI4 36
+ASGNI4
+ADDRLP4 2144
+INDIRP4
+ADDRLP4 2148
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2152
+ADDRLP4 2128
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 2140
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 2152
+INDIRP4
+ADDRLP4 2148
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 2060
+INDIRF4
+ARGF4
+ADDRLP4 2156
+CNSTI4 24
+ASGNI4
+ADDRLP4 2144
+INDIRP4
+ADDRLP4 2156
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 2160
+CNSTI4 28
+ASGNI4
+ADDRLP4 2144
+INDIRP4
+ADDRLP4 2160
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 2164
+CNSTI4 32
+ASGNI4
+ADDRLP4 2144
+INDIRP4
+ADDRLP4 2164
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 2152
+INDIRP4
+ADDRLP4 2156
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 2152
+INDIRP4
+ADDRLP4 2160
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 2152
+INDIRP4
+ADDRLP4 2164
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 level+40
+INDIRI4
+ARGI4
+ADDRLP4 2168
+ADDRFP4 12
+INDIRP4
+ADDRLP4 2136
+INDIRI4
+ADDP4
+INDIRP4
+CNSTI4 1396
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 level+40
+INDIRI4
+ADDRLP4 2168
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 level+40
+INDIRI4
+ADDRFP4 4
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 level+40
+INDIRI4
+ADDRLP4 2168
+INDIRI4
+ADDI4
+ADDRFP4 4
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 720
+DIVI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $87
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRGP4 $80
+JUMPV
+LABELV $85
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 40
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ADDP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 40
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTI4 40
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 676
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRGP4 $80
+JUMPV
+LABELV $79
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $94
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $94
+ADDRLP4 8
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRGP4 $96
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 level+40
+INDIRI4
+ARGI4
+ADDRGP4 level+40
+INDIRI4
+ARGI4
+ADDRLP4 2068
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 2068
+INDIRF4
+ARGF4
+ADDRLP4 2072
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 2072
+INDIRF4
+ARGF4
+ADDRLP4 2076
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 2076
+INDIRF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRLP4 2068
+INDIRF4
+ARGF4
+ADDRLP4 2072
+INDIRF4
+ARGF4
+ADDRLP4 2076
+INDIRF4
+ARGF4
+ADDRLP4 2068
+INDIRF4
+ARGF4
+ADDRLP4 2072
+INDIRF4
+ARGF4
+ADDRLP4 2076
+INDIRF4
+ARGF4
+ADDRGP4 level+40
+INDIRI4
+ARGI4
+ADDRLP4 2080
+ADDRFP4 12
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1396
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 level+40
+INDIRI4
+ADDRLP4 2080
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 level+40
+INDIRI4
+ADDRFP4 4
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 level+40
+INDIRI4
+ADDRLP4 2080
+INDIRI4
+ADDI4
+ADDRFP4 4
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 720
+DIVI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $94
+LABELV $80
+LABELV $71
+endproc G_TimeShiftClient 2172 80
+export G_TimeShiftAllClients
+proc G_TimeShiftAllClients 20 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $104
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $108
+ADDRLP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $108
+ADDRLP4 16
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 3
+GEI4 $108
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+EQU4 $108
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_TimeShiftClient
+CALLV
+pop
+LABELV $108
+LABELV $105
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $104
+LABELV $103
+endproc G_TimeShiftAllClients 20 16
+export G_DoTimeShiftFor
+proc G_DoTimeShiftFor 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $114
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $114
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $111
+LABELV $114
+ADDRGP4 $110
+JUMPV
+LABELV $111
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+EQI4 $118
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+EQI4 $120
+ADDRGP4 $110
+JUMPV
+LABELV $118
+ADDRLP4 0
+ADDRGP4 level+44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1396
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $116
+JUMPV
+LABELV $120
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1400
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $116
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_TimeShiftAllClients
+CALLV
+pop
+LABELV $110
+endproc G_DoTimeShiftFor 24 8
+export G_UnTimeShiftClient
+proc G_UnTimeShiftClient 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1392
+ADDP4
+INDIRI4
+ADDRGP4 level+40
+INDIRI4
+NEI4 $122
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1356
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1368
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1380
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 1392
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $122
+LABELV $121
+endproc G_UnTimeShiftClient 12 4
+export G_UnTimeShiftAllClients
+proc G_UnTimeShiftAllClients 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $126
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $130
+ADDRLP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $130
+ADDRLP4 12
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 3
+GEI4 $130
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $130
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_UnTimeShiftClient
+CALLV
+pop
+LABELV $130
+LABELV $127
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $126
+LABELV $125
+endproc G_UnTimeShiftAllClients 16 4
+export G_UndoTimeShiftFor
+proc G_UndoTimeShiftFor 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $136
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $136
+ADDRLP4 8
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+ADDRLP4 4
+INDIRI4
+EQI4 $133
+LABELV $136
+ADDRGP4 $132
+JUMPV
+LABELV $133
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_UnTimeShiftAllClients
+CALLV
+pop
+LABELV $132
+endproc G_UndoTimeShiftFor 12 4
+export G_PredictPlayerClipVelocity
+proc G_PredictPlayerClipVelocity 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $138
+ADDRLP4 0
+CNSTF4 1065361605
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $139
+JUMPV
+LABELV $138
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065361605
+DIVF4
+ASGNF4
+LABELV $139
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $137
+endproc G_PredictPlayerClipVelocity 28 0
+export G_PredictPlayerSlideMove
+proc G_PredictPlayerSlideMove 324 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 240
+CNSTI4 4
+ASGNI4
+ADDRLP4 244
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 76
+ADDRLP4 244
+INDIRB
+ASGNB 12
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140
+ADDRLP4 76
+INDIRB
+ASGNB 12
+ADDRLP4 220
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 260
+CNSTI4 0
+ASGNI4
+ADDRLP4 108
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRLP4 236
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRGP4 $144
+JUMPV
+LABELV $141
+ADDRLP4 224
+ADDRLP4 112
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 220
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 224+4
+ADDRLP4 112+4
+INDIRF4
+ADDRLP4 76+4
+INDIRF4
+ADDRLP4 220
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 224+8
+ADDRLP4 112+8
+INDIRF4
+ADDRLP4 76+8
+INDIRF4
+ADDRLP4 220
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 152
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 224
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $151
+ADDRLP4 272
+CNSTF4 0
+ASGNF4
+ADDRLP4 76+8
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRLP4 112
+INDIRB
+ASGNB 12
+CNSTI4 1
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $151
+ADDRLP4 152+8
+INDIRF4
+CNSTF4 0
+LEF4 $155
+ADDRLP4 112
+ADDRLP4 152+12
+INDIRB
+ASGNB 12
+LABELV $155
+ADDRLP4 152+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $159
+ADDRGP4 $143
+JUMPV
+LABELV $159
+ADDRLP4 220
+ADDRLP4 220
+INDIRF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 152+8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 108
+INDIRI4
+CNSTI4 5
+LTI4 $163
+ADDRLP4 276
+CNSTF4 0
+ASGNF4
+ADDRLP4 76+8
+ADDRLP4 276
+INDIRF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 276
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 276
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRLP4 112
+INDIRB
+ASGNB 12
+CNSTI4 1
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $163
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 $170
+JUMPV
+LABELV $167
+ADDRLP4 276
+CNSTI4 12
+ADDRLP4 92
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 152+24
+INDIRF4
+ADDRLP4 276
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 152+24+4
+INDIRF4
+ADDRLP4 276
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 152+24+8
+INDIRF4
+ADDRLP4 276
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1065185444
+LEF4 $171
+ADDRLP4 76
+ADDRLP4 152+24
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 152+24+4
+INDIRF4
+ADDRLP4 76+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76+8
+ADDRLP4 152+24+8
+INDIRF4
+ADDRLP4 76+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $169
+JUMPV
+LABELV $171
+LABELV $168
+ADDRLP4 92
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $170
+ADDRLP4 92
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LTI4 $167
+LABELV $169
+ADDRLP4 92
+INDIRI4
+ADDRLP4 108
+INDIRI4
+GEI4 $189
+ADDRGP4 $142
+JUMPV
+LABELV $189
+CNSTI4 12
+ADDRLP4 108
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 152+24
+INDIRB
+ASGNB 12
+ADDRLP4 108
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 $195
+JUMPV
+LABELV $192
+ADDRLP4 276
+CNSTI4 12
+ADDRLP4 92
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 216
+ADDRLP4 76
+INDIRF4
+ADDRLP4 276
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 76+4
+INDIRF4
+ADDRLP4 276
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 76+8
+INDIRF4
+ADDRLP4 276
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 216
+INDIRF4
+CNSTF4 1036831949
+LTF4 $200
+ADDRGP4 $193
+JUMPV
+LABELV $200
+ADDRLP4 76
+ARGP4
+CNSTI4 12
+ADDRLP4 92
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 G_PredictPlayerClipVelocity
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+CNSTI4 12
+ADDRLP4 92
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRGP4 G_PredictPlayerClipVelocity
+CALLV
+pop
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRGP4 $205
+JUMPV
+LABELV $202
+ADDRLP4 88
+INDIRI4
+ADDRLP4 92
+INDIRI4
+NEI4 $206
+ADDRGP4 $203
+JUMPV
+LABELV $206
+ADDRLP4 280
+CNSTI4 12
+ADDRLP4 88
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 280
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 64+4
+INDIRF4
+ADDRLP4 280
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 64+8
+INDIRF4
+ADDRLP4 280
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1036831949
+LTF4 $208
+ADDRGP4 $203
+JUMPV
+LABELV $208
+ADDRLP4 64
+ARGP4
+CNSTI4 12
+ADDRLP4 88
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 G_PredictPlayerClipVelocity
+CALLV
+pop
+ADDRLP4 128
+ARGP4
+CNSTI4 12
+ADDRLP4 88
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRGP4 G_PredictPlayerClipVelocity
+CALLV
+pop
+ADDRLP4 284
+CNSTI4 12
+ADDRLP4 92
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 284
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 64+4
+INDIRF4
+ADDRLP4 284
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 64+8
+INDIRF4
+ADDRLP4 284
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+LTF4 $214
+ADDRGP4 $203
+JUMPV
+LABELV $214
+ADDRLP4 288
+CNSTI4 12
+ASGNI4
+ADDRLP4 288
+INDIRI4
+ADDRLP4 92
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 288
+INDIRI4
+ADDRLP4 88
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 96
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 292
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 292
+INDIRF4
+ADDRLP4 76
+INDIRF4
+MULF4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 76+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 76+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 292
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 64+8
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 300
+CNSTI4 12
+ASGNI4
+ADDRLP4 300
+INDIRI4
+ADDRLP4 92
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 300
+INDIRI4
+ADDRLP4 88
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 96
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 304
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 304
+INDIRF4
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 304
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $236
+ADDRLP4 0
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $242
+ADDRLP4 0
+INDIRI4
+ADDRLP4 88
+INDIRI4
+NEI4 $240
+LABELV $242
+ADDRGP4 $237
+JUMPV
+LABELV $240
+ADDRLP4 316
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 316
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 64+4
+INDIRF4
+ADDRLP4 316
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 64+8
+INDIRF4
+ADDRLP4 316
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1036831949
+LTF4 $243
+ADDRGP4 $237
+JUMPV
+LABELV $243
+ADDRLP4 320
+CNSTF4 0
+ASGNF4
+ADDRLP4 76+8
+ADDRLP4 320
+INDIRF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 320
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 320
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRLP4 112
+INDIRB
+ASGNB 12
+CNSTI4 1
+RETI4
+ADDRGP4 $140
+JUMPV
+LABELV $237
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $239
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LTI4 $236
+LABELV $203
+ADDRLP4 88
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $205
+ADDRLP4 88
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LTI4 $202
+ADDRLP4 76
+ADDRLP4 64
+INDIRB
+ASGNB 12
+ADDRLP4 140
+ADDRLP4 128
+INDIRB
+ASGNB 12
+ADDRGP4 $194
+JUMPV
+LABELV $193
+ADDRLP4 92
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $195
+ADDRLP4 92
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LTI4 $192
+LABELV $194
+LABELV $142
+ADDRLP4 236
+ADDRLP4 236
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $144
+ADDRLP4 236
+INDIRI4
+ADDRLP4 240
+INDIRI4
+LTI4 $141
+LABELV $143
+ADDRLP4 76
+ADDRLP4 140
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRLP4 112
+INDIRB
+ASGNB 12
+ADDRLP4 236
+INDIRI4
+CNSTI4 0
+EQI4 $252
+ADDRLP4 264
+CNSTI4 1
+ASGNI4
+ADDRGP4 $253
+JUMPV
+LABELV $252
+ADDRLP4 264
+CNSTI4 0
+ASGNI4
+LABELV $253
+ADDRLP4 264
+INDIRI4
+RETI4
+LABELV $140
+endproc G_PredictPlayerSlideMove 324 28
+export G_PredictPlayerStepSlideMove
+proc G_PredictPlayerStepSlideMove 136 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 100
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 120
+ADDRGP4 G_PredictPlayerSlideMove
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+NEI4 $255
+ADDRGP4 $254
+JUMPV
+LABELV $255
+ADDRLP4 88
+ADDRLP4 64
+INDIRB
+ASGNB 12
+ADDRLP4 88+8
+ADDRLP4 88+8
+INDIRF4
+CNSTF4 1099956224
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $258
+ADDRGP4 $254
+JUMPV
+LABELV $258
+ADDRLP4 112
+ADDRLP4 0+12+8
+INDIRF4
+ADDRLP4 64+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 100
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 G_PredictPlayerSlideMove
+CALLI4
+pop
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 76+8
+ADDRLP4 76+8
+INDIRF4
+ADDRLP4 112
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $265
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+LABELV $265
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $268
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRGP4 G_PredictPlayerClipVelocity
+CALLV
+pop
+LABELV $268
+LABELV $254
+endproc G_PredictPlayerStepSlideMove 136 28
+export G_PredictPlayerMove
+proc G_PredictPlayerMove 0 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 G_PredictPlayerStepSlideMove
+CALLV
+pop
+LABELV $272
+endproc G_PredictPlayerMove 0 8
+import g_instagib
+import g_playerCapsule
+import g_proxMineTimeout
+import g_singlePlayer
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGamePlayers
+import g_maxplayers
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import trap_AAS_DropToFloor
+import trap_AAS_HorizontalVelocityForJump
+import trap_AAS_AgainstLadder
+import trap_AAS_JumpReachRunStart
+import trap_AAS_Swimming
+import trap_AAS_OnGround
+import trap_AAS_PredictPlayerMovement
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaTravelTime
+import trap_AAS_EnableRoutingArea
+import trap_AAS_RandomGoalArea
+import trap_AAS_ReachabilityFromNum
+import trap_AAS_NextAreaReachability
+import trap_AAS_AreaContentsTravelFlags
+import trap_AAS_TravelFlagForType
+import trap_AAS_AreaDoNotEnter
+import trap_AAS_AreaJumpPad
+import trap_AAS_AreaLadder
+import trap_AAS_AreaGrounded
+import trap_AAS_AreaSlime
+import trap_AAS_AreaLava
+import trap_AAS_AreaLiquid
+import trap_AAS_AreaSwim
+import trap_AAS_AreaCrouch
+import trap_AAS_AreaGroundFaceArea
+import trap_AAS_NextModelReachability
+import trap_AAS_BestReachableFromJumpPadArea
+import trap_AAS_BestReachableArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_TracePlayerBBox
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_FloodAreas
+import trap_AAS_ShowReachableAreas
+import trap_AAS_ShowReachability
+import trap_AAS_DrawArrow
+import trap_AAS_PrintTravelType
+import trap_AAS_DrawCross
+import trap_AAS_ShowAreaPolygons
+import trap_AAS_ShowArea
+import trap_AAS_ShowFace
+import trap_AAS_ShowBoundingBox
+import trap_AAS_DrawPlaneCross
+import trap_AAS_DrawPermanentCross
+import trap_AAS_PermanentLine
+import trap_AAS_DebugLine
+import trap_AAS_ClearShownPolygons
+import trap_AAS_ClearShownDebugLines
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_Loaded
+import trap_AAS_PointInsideArea
+import trap_AAS_BBoxReachabilityAreas
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_RegisterModel
+import trap_DebugPolygonDelete
+import trap_DebugPolygonShow
+import trap_DebugPolygonCreate
+import trap_ClientCommand
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_ClipToEntitiesCapsule
+import trap_ClipToEntities
+import trap_TraceCapsule
+import trap_Trace
+import trap_GetBrushBounds
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_SetConfigstringRestrictions
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommandEx
+import trap_DropPlayer
+import trap_SetNetFields
+import trap_LocateGameData
+import Pickup_Team
+import Svcmd_TeamInfoStats_f
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_BuildLocationTree
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotWeightBench_f
+import Svcmd_BotThinkReport_f
+import Svcmd_BotMatchBench_f
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownPlayer
+import BotAISetupPlayer
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import G_BotInitBotLib
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBotComplete
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunPlayer
+import PlayerEndFrame
+import PlayerThink
+import PlayerHandicap
+import ClientCommand
+import PlayerBegin
+import PlayerDisconnect
+import PlayerUserinfoChanged
+import PlayerConnect
+import G_Error
+import G_Printf
+import G_DPrintf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MovePlayerToIntermission
+import StringIsInteger
+import ConcatArgs
+import G_ScoreboardChanged
+import DeathmatchScoreboardMessage
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import G_RegisterCommands
+import G_ConsoleCompleteArgument
+import G_ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import PlayerSpawn
+import InitBodyQue
+import BeginIntermission
+import PlayerRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetPlayerViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossPlayerCubes
+import TossPlayerGametypeItems
+import TossPlayerItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_SetBrushModel
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import trap_SendServerCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import FinishSpawningItem
+import G_SpawnItem
+import LaunchItem
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $96
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 49
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 106
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 10
+byte 1 94
+byte 1 50
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 52
+byte 1 102
+byte 1 44
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 49
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 44
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 10
+byte 1 94
+byte 1 55
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 97
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $89
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 94
+byte 1 49
+byte 1 82
+byte 1 101
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 106
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 10
+byte 1 94
+byte 1 50
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 52
+byte 1 102
+byte 1 44
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 49
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 44
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 10
+byte 1 94
+byte 1 55
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 97
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 34
+byte 1 0
@@ -0,0 +1,2428 @@
+data
+align 4
+LABELV cinematics
+address $108
+address $109
+address $110
+address $111
+address $112
+address $113
+address $114
+address $115
+address $116
+address $117
+code
+proc UI_CinematicsMenu_BackEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $119
+ADDRGP4 $118
+JUMPV
+LABELV $119
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $118
+endproc UI_CinematicsMenu_BackEvent 0 0
+proc UI_CinematicsMenu_Event 12 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $122
+ADDRGP4 $121
+JUMPV
+LABELV $122
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 11
+SUBI4
+ASGNI4
+ADDRGP4 $125
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $124
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 uis+102864
+INDIRI4
+CNSTI4 0
+EQI4 $126
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 20
+NEI4 $126
+CNSTI4 2
+ARGI4
+ADDRGP4 $129
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRGP4 $130
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cinematics
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $127
+LABELV $121
+endproc UI_CinematicsMenu_Event 12 8
+proc UI_CinematicsMenu_Init 40 12
+ADDRGP4 UI_CinematicsMenu_Cache
+CALLV
+pop
+ADDRGP4 cinematicsMenuInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1344
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cinematicsMenuInfo+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+288+60
+ADDRGP4 $140
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+288+68
+ADDRGP4 text_banner_color
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+288+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+360
+CNSTI4 6
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+360+4
+ADDRGP4 $148
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+360+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 cinematicsMenuInfo+360+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+360+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+360+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+360+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+448
+CNSTI4 6
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+448+4
+ADDRGP4 $162
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+448+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 cinematicsMenuInfo+448+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+448+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+448+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+448+80
+CNSTI4 334
+ASGNI4
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+536
+CNSTI4 9
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+536+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 cinematicsMenuInfo+536+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+536+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+536+8
+CNSTI4 11
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+536+48
+ADDRGP4 UI_CinematicsMenu_Event
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+536+60
+ADDRGP4 $186
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+536+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+536+64
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+608
+CNSTI4 9
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+608+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 cinematicsMenuInfo+608+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+608+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+608+8
+CNSTI4 12
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+608+48
+ADDRGP4 UI_CinematicsMenu_Event
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+608+60
+ADDRGP4 $204
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+608+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+608+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 uis+102864
+INDIRI4
+CNSTI4 0
+EQI4 $209
+ADDRLP4 4
+ADDRGP4 cinematicsMenuInfo+608+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $209
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+680
+CNSTI4 9
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+680+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 cinematicsMenuInfo+680+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+680+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+680+8
+CNSTI4 13
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+680+48
+ADDRGP4 UI_CinematicsMenu_Event
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+680+60
+ADDRGP4 $227
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+680+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+680+64
+CNSTI4 2
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_CanShowTierVideo
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $232
+ADDRLP4 8
+ADDRGP4 cinematicsMenuInfo+680+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $232
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+752
+CNSTI4 9
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+752+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 cinematicsMenuInfo+752+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+752+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+752+8
+CNSTI4 14
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+752+48
+ADDRGP4 UI_CinematicsMenu_Event
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+752+60
+ADDRGP4 $249
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+752+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+752+64
+CNSTI4 2
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_CanShowTierVideo
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $254
+ADDRLP4 12
+ADDRGP4 cinematicsMenuInfo+752+44
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $254
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+824
+CNSTI4 9
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+824+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 cinematicsMenuInfo+824+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+824+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+824+8
+CNSTI4 15
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+824+48
+ADDRGP4 UI_CinematicsMenu_Event
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+824+60
+ADDRGP4 $271
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+824+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+824+64
+CNSTI4 2
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+ADDRGP4 UI_CanShowTierVideo
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $276
+ADDRLP4 16
+ADDRGP4 cinematicsMenuInfo+824+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $276
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+896
+CNSTI4 9
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+896+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 cinematicsMenuInfo+896+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+896+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+896+8
+CNSTI4 16
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+896+48
+ADDRGP4 UI_CinematicsMenu_Event
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+896+60
+ADDRGP4 $293
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+896+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+896+64
+CNSTI4 2
+ASGNI4
+CNSTI4 4
+ARGI4
+ADDRLP4 16
+ADDRGP4 UI_CanShowTierVideo
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $298
+ADDRLP4 20
+ADDRGP4 cinematicsMenuInfo+896+44
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $298
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+968
+CNSTI4 9
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+968+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 cinematicsMenuInfo+968+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+968+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+968+8
+CNSTI4 17
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+968+48
+ADDRGP4 UI_CinematicsMenu_Event
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+968+60
+ADDRGP4 $315
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+968+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+968+64
+CNSTI4 2
+ASGNI4
+CNSTI4 5
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_CanShowTierVideo
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $320
+ADDRLP4 24
+ADDRGP4 cinematicsMenuInfo+968+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $320
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1040
+CNSTI4 9
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1040+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 cinematicsMenuInfo+1040+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1040+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1040+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1040+48
+ADDRGP4 UI_CinematicsMenu_Event
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+1040+60
+ADDRGP4 $337
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+1040+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+1040+64
+CNSTI4 2
+ASGNI4
+CNSTI4 6
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_CanShowTierVideo
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $342
+ADDRLP4 28
+ADDRGP4 cinematicsMenuInfo+1040+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $342
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1112
+CNSTI4 9
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1112+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 cinematicsMenuInfo+1112+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1112+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1112+8
+CNSTI4 19
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1112+48
+ADDRGP4 UI_CinematicsMenu_Event
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+1112+60
+ADDRGP4 $359
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+1112+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+1112+64
+CNSTI4 2
+ASGNI4
+CNSTI4 7
+ARGI4
+ADDRLP4 28
+ADDRGP4 UI_CanShowTierVideo
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $364
+ADDRLP4 32
+ADDRGP4 cinematicsMenuInfo+1112+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $364
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 30
+ADDI4
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1184
+CNSTI4 9
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1184+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 cinematicsMenuInfo+1184+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1184+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1184+8
+CNSTI4 20
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1184+48
+ADDRGP4 UI_CinematicsMenu_Event
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+1184+60
+ADDRGP4 $381
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+1184+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+1184+64
+CNSTI4 2
+ASGNI4
+CNSTI4 8
+ARGI4
+ADDRLP4 32
+ADDRGP4 UI_CanShowTierVideo
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $386
+ADDRLP4 36
+ADDRGP4 cinematicsMenuInfo+1184+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $386
+ADDRGP4 cinematicsMenuInfo+1256
+CNSTI4 6
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1256+4
+ADDRGP4 $393
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+1256+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 cinematicsMenuInfo+1256+8
+CNSTI4 10
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1256+48
+ADDRGP4 UI_CinematicsMenu_BackEvent
+ASGNP4
+ADDRGP4 cinematicsMenuInfo+1256+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1256+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1256+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1256+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 cinematicsMenuInfo+1256+60
+ADDRGP4 $410
+ASGNP4
+ADDRGP4 cinematicsMenuInfo
+ARGP4
+ADDRGP4 cinematicsMenuInfo+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 cinematicsMenuInfo
+ARGP4
+ADDRGP4 cinematicsMenuInfo+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 cinematicsMenuInfo
+ARGP4
+ADDRGP4 cinematicsMenuInfo+448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 cinematicsMenuInfo
+ARGP4
+ADDRGP4 cinematicsMenuInfo+536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 cinematicsMenuInfo
+ARGP4
+ADDRGP4 cinematicsMenuInfo+608
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 cinematicsMenuInfo
+ARGP4
+ADDRGP4 cinematicsMenuInfo+680
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 cinematicsMenuInfo
+ARGP4
+ADDRGP4 cinematicsMenuInfo+752
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 cinematicsMenuInfo
+ARGP4
+ADDRGP4 cinematicsMenuInfo+824
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 cinematicsMenuInfo
+ARGP4
+ADDRGP4 cinematicsMenuInfo+896
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 cinematicsMenuInfo
+ARGP4
+ADDRGP4 cinematicsMenuInfo+968
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 cinematicsMenuInfo
+ARGP4
+ADDRGP4 cinematicsMenuInfo+1040
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 cinematicsMenuInfo
+ARGP4
+ADDRGP4 cinematicsMenuInfo+1112
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 cinematicsMenuInfo
+ARGP4
+ADDRGP4 cinematicsMenuInfo+1184
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 cinematicsMenuInfo
+ARGP4
+ADDRGP4 cinematicsMenuInfo+1256
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $131
+endproc UI_CinematicsMenu_Init 40 12
+export UI_CinematicsMenu_Cache
+proc UI_CinematicsMenu_Cache 0 4
+ADDRGP4 $393
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $410
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $148
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $162
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $425
+endproc UI_CinematicsMenu_Cache 0 4
+export UI_CinematicsMenu
+proc UI_CinematicsMenu 0 4
+ADDRGP4 UI_CinematicsMenu_Init
+CALLV
+pop
+ADDRGP4 cinematicsMenuInfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $426
+endproc UI_CinematicsMenu 0 4
+export UI_CinematicsMenu_f
+proc UI_CinematicsMenu_f 12 8
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 UI_CinematicsMenu
+CALLV
+pop
+ADDRGP4 cinematicsMenuInfo
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cinematicsMenuInfo+12+12
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Menu_SetCursorToItem
+CALLV
+pop
+LABELV $427
+endproc UI_CinematicsMenu_f 12 8
+bss
+align 4
+LABELV cinematicsMenuInfo
+skip 1344
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPMap_f
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_MaxSplitView
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_CursorInRect
+import UI_DrawChar
+import UI_MField_Draw
+import UI_DrawStrlen
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_InitPropFont
+import UI_InitBannerFont
+import UI_LerpColor
+import UI_RegisterPlayerModelname
+import UI_PlayerInfo_UpdateColor
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import Demos_Cache
+import UI_DemosMenu
+import UI_Joystick_Cache
+import UI_JoystickMenu
+import Controls_WantsBindKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_SelectPlayer_Cache
+import UI_SelectPlayerMenu
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import InSelectPlayerMenu
+import InSelectPlayer_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_small_title_color
+import text_big_color
+import text_banner_color
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_menuFontBanner
+import ui_menuFontProp
+import ui_menuFont
+import ui_ioq3
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserSeparateMasters
+import ui_browserShowBots
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserGame
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_publicServer
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import UI_DrawProportionalString
+import UI_WindowResized
+import UI_WantsBindKeys
+import UI_DrawConnectScreen
+import UI_ConsoleCommand
+import UI_SetActiveMenu
+import UI_Refresh
+import UI_IsFullscreen
+import UI_SetCursorPos
+import UI_GetCursorPos
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import ui_numCommands
+import ui_commands
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_drawScores
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $410
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $393
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $381
+byte 1 69
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $359
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 55
+byte 1 0
+align 1
+LABELV $337
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 54
+byte 1 0
+align 1
+LABELV $315
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 53
+byte 1 0
+align 1
+LABELV $293
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 52
+byte 1 0
+align 1
+LABELV $271
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 51
+byte 1 0
+align 1
+LABELV $249
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 50
+byte 1 0
+align 1
+LABELV $227
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $204
+byte 1 73
+byte 1 78
+byte 1 84
+byte 1 82
+byte 1 79
+byte 1 0
+align 1
+LABELV $186
+byte 1 73
+byte 1 68
+byte 1 32
+byte 1 76
+byte 1 79
+byte 1 71
+byte 1 79
+byte 1 0
+align 1
+LABELV $162
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $148
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 50
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $140
+byte 1 67
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 77
+byte 1 65
+byte 1 84
+byte 1 73
+byte 1 67
+byte 1 83
+byte 1 0
+align 1
+LABELV $130
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 82
+byte 1 111
+byte 1 81
+byte 1 10
+byte 1 0
+align 1
+LABELV $129
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 69
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 82
+byte 1 111
+byte 1 81
+byte 1 32
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $125
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $124
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $117
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $116
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 55
+byte 1 0
+align 1
+LABELV $115
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 54
+byte 1 0
+align 1
+LABELV $114
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 53
+byte 1 0
+align 1
+LABELV $113
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 52
+byte 1 0
+align 1
+LABELV $112
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 51
+byte 1 0
+align 1
+LABELV $111
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $110
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $109
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 0
+align 1
+LABELV $108
+byte 1 105
+byte 1 100
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 0
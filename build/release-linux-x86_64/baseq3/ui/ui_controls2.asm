@@ -0,0 +1,9398 @@
+data
+align 4
+LABELV waitingforkey
+byte 4 0
+align 4
+LABELV g_bindings
+address $111
+address $112
+byte 4 0
+byte 4 0
+byte 4 9
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $113
+address $114
+byte 4 1
+byte 4 0
+byte 4 13
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $115
+address $116
+byte 4 2
+byte 4 1
+byte 4 139
+byte 4 140
+byte 4 -1
+byte 4 -1
+address $117
+address $118
+byte 4 3
+byte 4 2
+byte 4 131
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $119
+address $120
+byte 4 4
+byte 4 3
+byte 4 132
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $121
+address $122
+byte 4 5
+byte 4 6
+byte 4 44
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $123
+address $124
+byte 4 6
+byte 4 7
+byte 4 46
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $125
+address $126
+byte 4 7
+byte 4 4
+byte 4 32
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $127
+address $128
+byte 4 8
+byte 4 5
+byte 4 99
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $129
+address $130
+byte 4 9
+byte 4 8
+byte 4 133
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $131
+address $132
+byte 4 10
+byte 4 9
+byte 4 134
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $133
+address $134
+byte 4 11
+byte 4 0
+byte 4 135
+byte 4 136
+byte 4 -1
+byte 4 -1
+address $135
+address $136
+byte 4 12
+byte 4 10
+byte 4 147
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $137
+address $138
+byte 4 13
+byte 4 11
+byte 4 146
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $139
+address $140
+byte 4 14
+byte 4 0
+byte 4 47
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $141
+address $142
+byte 4 15
+byte 4 0
+byte 4 150
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $143
+address $144
+byte 4 16
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $145
+address $146
+byte 4 17
+byte 4 12
+byte 4 49
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $147
+address $148
+byte 4 18
+byte 4 13
+byte 4 50
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $149
+address $150
+byte 4 19
+byte 4 14
+byte 4 51
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $151
+address $152
+byte 4 20
+byte 4 15
+byte 4 52
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $153
+address $154
+byte 4 21
+byte 4 16
+byte 4 53
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $155
+address $156
+byte 4 22
+byte 4 17
+byte 4 54
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $157
+address $158
+byte 4 23
+byte 4 18
+byte 4 55
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $159
+address $160
+byte 4 24
+byte 4 19
+byte 4 56
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $161
+address $162
+byte 4 25
+byte 4 20
+byte 4 57
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $163
+address $164
+byte 4 26
+byte 4 22
+byte 4 137
+byte 4 138
+byte 4 -1
+byte 4 -1
+address $165
+address $166
+byte 4 27
+byte 4 0
+byte 4 91
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $167
+address $168
+byte 4 28
+byte 4 0
+byte 4 93
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $169
+address $170
+byte 4 29
+byte 4 23
+byte 4 186
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $171
+address $172
+byte 4 30
+byte 4 25
+byte 4 116
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $173
+address $174
+byte 4 31
+byte 4 25
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $175
+address $176
+byte 4 32
+byte 4 25
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $177
+address $178
+byte 4 33
+byte 4 25
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $179
+address $180
+byte 4 34
+byte 4 0
+byte 4 27
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+align 4
+LABELV g_bindings2
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 2
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 3
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 4
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 5
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 6
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 7
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 8
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 9
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 10
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 11
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 12
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 13
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 14
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 15
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 16
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 17
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 18
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 19
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 20
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 21
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 22
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 23
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 24
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 25
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 26
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 27
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 28
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 29
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 30
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 31
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 32
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 33
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+align 4
+LABELV g_bindings3
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 2
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 3
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 4
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 5
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 6
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 7
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 8
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 9
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 10
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 11
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 12
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 13
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 14
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 15
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 16
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 17
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 18
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 19
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 20
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 21
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 22
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 23
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 24
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 25
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 26
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 27
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 28
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 29
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 30
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 31
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 32
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 33
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+align 4
+LABELV g_bindings4
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 2
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 3
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 4
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 5
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 6
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 7
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 8
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 9
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 10
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 11
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 12
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 13
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 14
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 15
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 16
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 17
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 18
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 19
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 20
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 21
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 22
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 23
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 24
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 25
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 26
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 27
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 28
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 29
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 30
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 31
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 32
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 33
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+export g_bindings_list
+align 4
+LABELV g_bindings_list
+address g_bindings
+address g_bindings2
+address g_bindings3
+address g_bindings4
+align 4
+LABELV g_movement_controls
+address s_controls+2932
+address s_controls+1524
+address s_controls+984
+address s_controls+1044
+address s_controls+1104
+address s_controls+1164
+address s_controls+1224
+address s_controls+1284
+address s_controls+1344
+address s_controls+1404
+address s_controls+1464
+byte 4 0
+align 4
+LABELV g_weapons_controls
+address s_controls+2124
+address s_controls+2244
+address s_controls+2184
+address s_controls+3056
+address s_controls+3120
+address s_controls+1644
+address s_controls+1584
+address s_controls+1704
+address s_controls+1764
+address s_controls+1824
+address s_controls+1884
+address s_controls+1944
+address s_controls+2004
+address s_controls+2064
+byte 4 0
+align 4
+LABELV g_looking_controls
+address s_controls+2792
+address s_controls+2868
+address s_controls+2728
+address s_controls+2304
+address s_controls+2364
+address s_controls+2424
+address s_controls+2484
+address s_controls+2548
+address s_controls+2608
+byte 4 0
+align 4
+LABELV g_misc_controls
+address s_controls+2996
+address s_controls+3184
+address s_controls+2668
+address s_controls+4776
+address s_controls+4836
+address s_controls+4896
+address s_controls+4956
+address s_controls+5016
+byte 4 0
+align 4
+LABELV g_joystick_controls
+address s_controls+5076
+address s_controls+5148
+address s_controls+5224
+byte 4 0
+align 4
+LABELV g_controls
+address g_movement_controls
+address g_looking_controls
+address g_weapons_controls
+address g_misc_controls
+address g_joystick_controls
+byte 4 0
+align 4
+LABELV g_looking_mini_controls
+address s_controls+2304
+address s_controls+2364
+address s_controls+2548
+address s_controls+2608
+byte 4 0
+align 4
+LABELV g_misc_mini_controls
+address s_controls+2996
+address s_controls+3184
+address s_controls+2668
+byte 4 0
+align 4
+LABELV g_unused_controls
+address s_controls+2792
+address s_controls+2868
+address s_controls+2728
+address s_controls+2424
+address s_controls+2484
+address s_controls+4776
+address s_controls+4836
+address s_controls+4896
+address s_controls+4956
+byte 4 0
+align 4
+LABELV g_mini_controls
+address g_movement_controls
+address g_looking_mini_controls
+address g_weapons_controls
+address g_misc_mini_controls
+address g_joystick_controls
+address g_unused_controls
+byte 4 0
+code
+proc Controls_GetCvarDefault 260 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_DefaultVariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 256
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 256
+INDIRF4
+RETF4
+LABELV $242
+endproc Controls_GetCvarDefault 260 12
+proc Controls_GetCvarValue 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $243
+endproc Controls_GetCvarValue 4 4
+proc Controls_UpdateModel 20 32
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 s_controls+5420+8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+5420+4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+5420
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRGP4 s_controls+5432+8
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+5432+4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+5432
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+5420+4
+CNSTF4 1125515264
+ASGNF4
+ADDRGP4 s_controls+5432+4
+ADDRGP4 s_controls+5420+4
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+5444
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_controls+5448
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_controls+5452
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_controls+5456
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $266
+ADDRLP4 8
+INDIRI4
+CNSTI4 25
+GTI4 $266
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $329-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $329
+address $267
+address $269
+address $271
+address $273
+address $275
+address $283
+address $289
+address $277
+address $280
+address $295
+address $297
+address $299
+address $301
+address $303
+address $305
+address $307
+address $309
+address $311
+address $313
+address $315
+address $317
+address $319
+address $321
+address $323
+address $327
+code
+LABELV $267
+ADDRGP4 s_controls+5444
+CNSTI4 15
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $269
+ADDRGP4 s_controls+5444
+CNSTI4 14
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $271
+ADDRGP4 s_controls+5444
+CNSTI4 16
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $273
+ADDRGP4 s_controls+5444
+CNSTI4 18
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $275
+ADDRGP4 s_controls+5444
+CNSTI4 23
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $277
+ADDRLP4 12
+ADDRGP4 s_controls+5420+4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRGP4 $266
+JUMPV
+LABELV $280
+ADDRLP4 16
+ADDRGP4 s_controls+5420+4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1119092736
+SUBF4
+ASGNF4
+ADDRGP4 $266
+JUMPV
+LABELV $283
+ADDRGP4 s_controls+5444
+CNSTI4 14
+ASGNI4
+ADDRGP4 s_controls+5432+4
+ADDRGP4 s_controls+5420+4
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRGP4 $266
+JUMPV
+LABELV $289
+ADDRGP4 s_controls+5444
+CNSTI4 14
+ASGNI4
+ADDRGP4 s_controls+5432+4
+ADDRGP4 s_controls+5420+4
+INDIRF4
+CNSTF4 1119092736
+SUBF4
+ASGNF4
+ADDRGP4 $266
+JUMPV
+LABELV $295
+ADDRGP4 s_controls+5420
+CNSTF4 3258187776
+ASGNF4
+ADDRGP4 $266
+JUMPV
+LABELV $297
+ADDRGP4 s_controls+5420
+CNSTF4 1110704128
+ASGNF4
+ADDRGP4 $266
+JUMPV
+LABELV $299
+ADDRGP4 s_controls+5452
+CNSTI4 1
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $301
+ADDRGP4 s_controls+5452
+CNSTI4 2
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $303
+ADDRGP4 s_controls+5452
+CNSTI4 3
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $305
+ADDRGP4 s_controls+5452
+CNSTI4 4
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $307
+ADDRGP4 s_controls+5452
+CNSTI4 5
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $309
+ADDRGP4 s_controls+5452
+CNSTI4 6
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $311
+ADDRGP4 s_controls+5452
+CNSTI4 7
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $313
+ADDRGP4 s_controls+5452
+CNSTI4 8
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $315
+ADDRGP4 s_controls+5452
+CNSTI4 9
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $317
+ADDRGP4 s_controls+5452
+CNSTI4 10
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $319
+ADDRGP4 s_controls+5448
+CNSTI4 7
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $321
+ADDRGP4 s_controls+5448
+CNSTI4 6
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $323
+ADDRGP4 s_controls+5444
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+5448
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+5452
+CNSTI4 0
+ASGNI4
+ADDRGP4 $266
+JUMPV
+LABELV $327
+ADDRGP4 s_controls+5456
+CNSTI4 1
+ASGNI4
+LABELV $266
+ADDRGP4 s_controls+3244
+ARGP4
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 s_controls+5444
+INDIRI4
+ARGI4
+ADDRGP4 s_controls+5448
+INDIRI4
+ARGI4
+ADDRGP4 s_controls+5420
+ARGP4
+ADDRGP4 s_controls+5432
+ARGP4
+ADDRGP4 s_controls+5452
+INDIRI4
+ARGI4
+ADDRGP4 s_controls+5456
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+LABELV $244
+endproc Controls_UpdateModel 20 32
+proc Controls_Update 96 0
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $343
+JUMPV
+LABELV $340
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+5624
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $349
+JUMPV
+LABELV $346
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $347
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $349
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $346
+LABELV $341
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $343
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+5624
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $340
+ADDRLP4 8
+ADDRGP4 s_controls+5288
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+5624
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $355
+JUMPV
+LABELV $352
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 4294938623
+BANDU4
+ASGNU4
+LABELV $353
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $355
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $352
+ADDRLP4 16
+CNSTI4 480
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $359
+JUMPV
+LABELV $356
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 320
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 168
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 488
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $357
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $359
+ADDRLP4 24
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $356
+ADDRGP4 waitingforkey
+INDIRI4
+CNSTI4 0
+EQI4 $360
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $365
+JUMPV
+LABELV $362
+ADDRLP4 28
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $363
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $365
+ADDRLP4 12
+INDIRI4
+ADDRGP4 s_controls+8
+INDIRI4
+LTI4 $362
+ADDRLP4 28
+ADDRGP4 s_controls
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 32
+ADDRGP4 s_controls+5548+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRGP4 $339
+JUMPV
+LABELV $360
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $374
+JUMPV
+LABELV $371
+ADDRLP4 28
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+LABELV $372
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $374
+ADDRLP4 12
+INDIRI4
+ADDRGP4 s_controls+8
+INDIRI4
+LTI4 $371
+ADDRLP4 28
+ADDRGP4 s_controls+696+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 32
+ADDRGP4 s_controls+624+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 s_controls+768+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 s_controls+840+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294958911
+BANDU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 s_controls+696+44
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 s_controls+624+44
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 s_controls+768+44
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 s_controls+840+44
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 s_controls+5288
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+LTI4 $393
+ADDRLP4 60
+INDIRI4
+CNSTI4 3
+GTI4 $393
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $416
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $416
+address $396
+address $401
+address $406
+address $411
+code
+LABELV $396
+ADDRLP4 64
+ADDRGP4 s_controls+624+44
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 68
+ADDRGP4 s_controls+624+44
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRU4
+CNSTU4 192
+BORU4
+ASGNU4
+ADDRGP4 $394
+JUMPV
+LABELV $401
+ADDRLP4 72
+ADDRGP4 s_controls+696+44
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 76
+ADDRGP4 s_controls+696+44
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRU4
+CNSTU4 192
+BORU4
+ASGNU4
+ADDRGP4 $394
+JUMPV
+LABELV $406
+ADDRLP4 80
+ADDRGP4 s_controls+768+44
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 84
+ADDRGP4 s_controls+768+44
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRU4
+CNSTU4 192
+BORU4
+ASGNU4
+ADDRGP4 $394
+JUMPV
+LABELV $411
+ADDRLP4 88
+ADDRGP4 s_controls+840+44
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 92
+ADDRGP4 s_controls+840+44
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRU4
+CNSTU4 192
+BORU4
+ASGNU4
+LABELV $393
+LABELV $394
+LABELV $339
+endproc Controls_Update 96 0
+proc Controls_DrawKeyBinding 124 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 100
+INDIRP4
+CVPU4 4
+NEU4 $419
+ADDRLP4 92
+CNSTI4 1
+ASGNI4
+ADDRGP4 $420
+JUMPV
+LABELV $419
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+LABELV $420
+ADDRLP4 52
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 s_controls+5628
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 48
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 -1
+NEI4 $422
+ADDRLP4 12
+ARGP4
+ADDRGP4 $424
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $423
+JUMPV
+LABELV $422
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Key_KeynumToStringBuf
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 56
+ADDRLP4 48
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 -1
+EQI4 $425
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 60
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Key_KeynumToStringBuf
+CALLV
+pop
+ADDRLP4 60
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 $427
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $425
+LABELV $423
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $428
+ADDRLP4 108
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 112
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 116
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRLP4 108
+INDIRI4
+SUBI4
+ADDRLP4 116
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 112
+INDIRI4
+SUBI4
+ADDRLP4 116
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 120
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 120
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 259
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 33025
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 waitingforkey
+INDIRI4
+CNSTI4 0
+EQI4 $431
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 61
+ARGI4
+CNSTI4 8450
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 384
+ARGI4
+ADDRGP4 $433
+ARGP4
+CNSTI4 33026
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $429
+JUMPV
+LABELV $431
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTI4 8450
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 374
+ARGI4
+ADDRGP4 $434
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 393
+ARGI4
+ADDRGP4 $435
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $429
+JUMPV
+LABELV $428
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $436
+ADDRLP4 104
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 259
+ARGI4
+ADDRGP4 text_color_disabled
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 text_color_disabled
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $437
+JUMPV
+LABELV $436
+ADDRLP4 104
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 259
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $437
+LABELV $429
+LABELV $417
+endproc Controls_DrawKeyBinding 124 20
+proc Controls_DrawSmallText 48 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+NEU4 $442
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $443
+JUMPV
+LABELV $442
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $443
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $444
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+SUBI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 259
+ARGI4
+ADDRGP4 text_color_highlight
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 384
+ARGI4
+ADDRGP4 $446
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $445
+JUMPV
+LABELV $444
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $447
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 259
+ARGI4
+ADDRGP4 text_color_disabled
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $448
+JUMPV
+LABELV $447
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 259
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $448
+LABELV $445
+LABELV $440
+endproc Controls_DrawSmallText 48 20
+proc Controls_StatusBar 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 384
+ARGI4
+ADDRGP4 $450
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $449
+endproc Controls_StatusBar 0 20
+proc Controls_DrawPlayer 152 24
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $453
+ARGP4
+ADDRLP4 132
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $455
+ARGP4
+ADDRLP4 136
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 s_controls+5292
+ARGP4
+ADDRLP4 140
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $460
+ADDRLP4 68
+ARGP4
+ADDRGP4 s_controls+5356
+ARGP4
+ADDRLP4 144
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $456
+LABELV $460
+ADDRGP4 s_controls+3244
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 68
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+ADDRGP4 s_controls+5292
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 s_controls+5356
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 Controls_UpdateModel
+CALLV
+pop
+LABELV $456
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 s_controls+3244
+ARGP4
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 UI_DrawPlayer
+CALLV
+pop
+LABELV $451
+endproc Controls_DrawPlayer 152 24
+proc Controls_GetKeyAssignment 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $467
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 trap_Key_GetKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $471
+ADDRGP4 $469
+JUMPV
+LABELV $471
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $468
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LTI4 $467
+LABELV $469
+LABELV $466
+endproc Controls_GetKeyAssignment 24 8
+proc Controls_GetConfig 80 12
+ADDRLP4 16
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $474
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $478
+ADDRGP4 $476
+JUMPV
+LABELV $478
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $480
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Controls_GetKeyAssignment
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_bindings_list
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_bindings_list
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 28
+ADDP4
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $481
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $483
+ADDRLP4 20
+ADDRGP4 UI_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $480
+LABELV $475
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $474
+JUMPV
+LABELV $476
+ADDRGP4 s_controls+5620
+INDIRI4
+CNSTI4 0
+NEI4 $485
+ADDRGP4 $490
+ARGP4
+ADDRLP4 24
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 0
+GEF4 $492
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $493
+JUMPV
+LABELV $492
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $493
+ADDRGP4 s_controls+2728+60
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $496
+ARGP4
+ADDRLP4 28
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2868+60
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $499
+ARGP4
+ADDRLP4 36
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 1073741824
+ARGF4
+CNSTF4 1106247680
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2792+68
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRGP4 $502
+ARGP4
+ADDRLP4 44
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2484+60
+ADDRLP4 48
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $485
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $506
+ARGP4
+ADDRLP4 20
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2932+60
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $510
+ARGP4
+ADDRLP4 32
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+3056+60
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $514
+ARGP4
+ADDRLP4 44
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+3120+60
+ADDRLP4 52
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $518
+ARGP4
+ADDRLP4 56
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 1028443341
+ARGF4
+CNSTF4 1061158912
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+5148+68
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $522
+ARGP4
+ADDRLP4 68
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 Controls_GetCvarValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 76
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+5224+60
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $473
+endproc Controls_GetConfig 80 12
+proc Controls_SetConfig 32 8
+ADDRLP4 8
+ADDRGP4 g_bindings
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $524
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $528
+ADDRGP4 $526
+JUMPV
+LABELV $528
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $533
+JUMPV
+LABELV $530
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_bindings_list
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $534
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_bindings_list
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_bindings_list
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $536
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_bindings_list
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+LABELV $536
+LABELV $534
+LABELV $531
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $533
+ADDRLP4 12
+ADDRGP4 UI_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $530
+LABELV $525
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $524
+JUMPV
+LABELV $526
+ADDRGP4 s_controls+5620
+INDIRI4
+CNSTI4 0
+NEI4 $538
+ADDRGP4 s_controls+2728+60
+INDIRI4
+CNSTI4 0
+EQI4 $541
+ADDRGP4 $490
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 16
+INDIRF4
+NEGF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $542
+JUMPV
+LABELV $541
+ADDRGP4 $490
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $542
+ADDRGP4 $496
+ARGP4
+ADDRGP4 s_controls+2868+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $499
+ARGP4
+ADDRGP4 s_controls+2792+68
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $502
+ARGP4
+ADDRGP4 s_controls+2484+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $538
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $506
+ARGP4
+ADDRLP4 12
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 s_controls+2932+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $510
+ARGP4
+ADDRLP4 16
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 s_controls+3056+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $514
+ARGP4
+ADDRLP4 20
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 s_controls+3120+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $518
+ARGP4
+ADDRLP4 24
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 s_controls+5148+68
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $522
+ARGP4
+ADDRLP4 28
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 s_controls+5224+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $523
+endproc Controls_SetConfig 32 8
+proc Controls_SetDefaults 56 8
+ADDRLP4 0
+ADDRGP4 s_controls+5628
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $568
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $572
+ADDRGP4 $570
+JUMPV
+LABELV $572
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $569
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $568
+JUMPV
+LABELV $570
+ADDRGP4 s_controls+5620
+INDIRI4
+CNSTI4 0
+NEI4 $575
+ADDRGP4 $490
+ARGP4
+ADDRLP4 12
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $581
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $582
+JUMPV
+LABELV $581
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $582
+ADDRGP4 s_controls+2728+60
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $496
+ARGP4
+ADDRLP4 16
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2868+60
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $499
+ARGP4
+ADDRLP4 20
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2792+68
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRGP4 $502
+ARGP4
+ADDRLP4 24
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2484+60
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $575
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $506
+ARGP4
+ADDRLP4 8
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+2932+60
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $510
+ARGP4
+ADDRLP4 16
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+3056+60
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $514
+ARGP4
+ADDRLP4 24
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+3120+60
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $599
+ARGP4
+ADDRLP4 32
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $601
+ARGP4
+ADDRLP4 36
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $518
+ARGP4
+ADDRLP4 40
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+5148+68
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $522
+ARGP4
+ADDRLP4 48
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Controls_GetCvarDefault
+CALLF4
+ASGNF4
+ADDRGP4 s_controls+5224+60
+ADDRLP4 52
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $566
+endproc Controls_SetDefaults 56 8
+proc Controls_MenuKey 52 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 waitingforkey
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $609
+ADDRLP4 28
+CNSTI4 146
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $613
+ADDRFP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GTI4 $620
+LABELV $619
+ADDRLP4 36
+CNSTI4 27
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $614
+ADDRFP4 0
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LTI4 $618
+LABELV $621
+ADDRFP4 0
+INDIRI4
+CNSTI4 127
+EQI4 $613
+ADDRGP4 $618
+JUMPV
+LABELV $620
+ADDRLP4 44
+CNSTI4 177
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $613
+ADDRFP4 0
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LTI4 $618
+LABELV $622
+ADDRFP4 0
+INDIRI4
+CNSTI4 185
+EQI4 $614
+ADDRGP4 $618
+JUMPV
+LABELV $613
+ADDRFP4 0
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $610
+JUMPV
+LABELV $614
+ADDRGP4 s_controls+4772
+INDIRI4
+CNSTI4 0
+EQI4 $618
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+ADDRGP4 $618
+JUMPV
+LABELV $609
+ADDRFP4 0
+INDIRI4
+CNSTI4 2147483648
+BANDI4
+CNSTI4 0
+EQI4 $623
+ADDRGP4 $618
+JUMPV
+LABELV $623
+ADDRLP4 28
+CNSTI4 27
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $627
+ADDRFP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $625
+LABELV $629
+ADDRFP4 0
+INDIRI4
+CNSTI4 96
+EQI4 $618
+ADDRGP4 $625
+JUMPV
+LABELV $627
+ADDRGP4 waitingforkey
+CNSTI4 0
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 menu_out_sound
+INDIRI4
+RETI4
+ADDRGP4 $608
+JUMPV
+LABELV $625
+ADDRLP4 32
+ADDRGP4 s_controls+5620
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LTI4 $630
+ADDRLP4 32
+INDIRI4
+CNSTI4 3
+GTI4 $630
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $637
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $637
+address $633
+address $634
+address $635
+address $636
+code
+LABELV $630
+LABELV $633
+ADDRLP4 16
+CNSTI4 193
+ASGNI4
+ADDRGP4 $631
+JUMPV
+LABELV $634
+ADDRLP4 16
+CNSTI4 218
+ASGNI4
+ADDRGP4 $631
+JUMPV
+LABELV $635
+ADDRLP4 16
+CNSTI4 243
+ASGNI4
+ADDRGP4 $631
+JUMPV
+LABELV $636
+ADDRLP4 16
+CNSTI4 268
+ASGNI4
+LABELV $631
+ADDRFP4 0
+INDIRI4
+CNSTI4 193
+LTI4 $638
+ADDRFP4 0
+INDIRI4
+CNSTI4 217
+GTI4 $638
+ADDRFP4 0
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+CNSTI4 193
+SUBI4
+ASGNI4
+ADDRGP4 $639
+JUMPV
+LABELV $638
+ADDRFP4 0
+INDIRI4
+CNSTI4 218
+LTI4 $640
+ADDRFP4 0
+INDIRI4
+CNSTI4 242
+GTI4 $640
+ADDRFP4 0
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+CNSTI4 218
+SUBI4
+ASGNI4
+ADDRGP4 $641
+JUMPV
+LABELV $640
+ADDRFP4 0
+INDIRI4
+CNSTI4 243
+LTI4 $642
+ADDRFP4 0
+INDIRI4
+CNSTI4 267
+GTI4 $642
+ADDRFP4 0
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+CNSTI4 243
+SUBI4
+ASGNI4
+ADDRGP4 $643
+JUMPV
+LABELV $642
+ADDRFP4 0
+INDIRI4
+CNSTI4 268
+LTI4 $644
+ADDRFP4 0
+INDIRI4
+CNSTI4 292
+GTI4 $644
+ADDRFP4 0
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+CNSTI4 268
+SUBI4
+ASGNI4
+LABELV $644
+LABELV $643
+LABELV $641
+LABELV $639
+LABELV $610
+ADDRGP4 s_controls+4772
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1
+EQI4 $647
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $652
+JUMPV
+LABELV $649
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_bindings_list
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $653
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $657
+ADDRGP4 $655
+JUMPV
+LABELV $657
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $660
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $660
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $662
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $662
+LABELV $654
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $653
+JUMPV
+LABELV $655
+LABELV $650
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $652
+ADDRLP4 28
+ADDRGP4 UI_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $649
+LABELV $647
+ADDRLP4 8
+ADDRGP4 s_controls
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_controls+12
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 s_controls+5628
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $666
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $670
+ADDRGP4 $668
+JUMPV
+LABELV $670
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $673
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $675
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $677
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $679
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $677
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $668
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $679
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $668
+JUMPV
+LABELV $675
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $682
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $668
+JUMPV
+LABELV $682
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $684
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $684
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $668
+JUMPV
+LABELV $684
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $679
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $679
+ARGP4
+ADDRGP4 trap_Key_SetBinding
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $668
+JUMPV
+LABELV $673
+LABELV $667
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $666
+JUMPV
+LABELV $668
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 waitingforkey
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $686
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 menu_out_sound
+INDIRI4
+RETI4
+ADDRGP4 $608
+JUMPV
+LABELV $686
+LABELV $618
+ADDRGP4 s_controls
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+LABELV $608
+endproc Controls_MenuKey 52 8
+proc Controls_ResetDefaults_Action 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $689
+ADDRGP4 $688
+JUMPV
+LABELV $689
+ADDRGP4 s_controls+4772
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_SetDefaults
+CALLV
+pop
+ADDRGP4 Controls_Update
+CALLV
+pop
+LABELV $688
+endproc Controls_ResetDefaults_Action 0 0
+proc Controls_ResetDefaults_Draw 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 356
+ARGI4
+ADDRGP4 $693
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 383
+ARGI4
+ADDRGP4 $694
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+LABELV $692
+endproc Controls_ResetDefaults_Draw 0 20
+proc Controls_MenuEvent 12 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 35
+LTI4 $696
+ADDRLP4 0
+INDIRI4
+CNSTI4 44
+GTI4 $743
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $744-140
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $744
+address $735
+address $735
+address $735
+address $735
+address $735
+address $735
+address $739
+address $735
+address $735
+address $735
+code
+LABELV $743
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+LTI4 $696
+ADDRLP4 0
+INDIRI4
+CNSTI4 108
+GTI4 $696
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $746-400
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $746
+address $699
+address $703
+address $707
+address $711
+address $719
+address $723
+address $729
+address $732
+address $715
+code
+LABELV $699
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $697
+ADDRGP4 s_controls+5288
+CNSTI4 0
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $697
+JUMPV
+LABELV $703
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $697
+ADDRGP4 s_controls+5288
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $697
+JUMPV
+LABELV $707
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $697
+ADDRGP4 s_controls+5288
+CNSTI4 2
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $697
+JUMPV
+LABELV $711
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $697
+ADDRGP4 s_controls+5288
+CNSTI4 3
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $697
+JUMPV
+LABELV $715
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $697
+ADDRGP4 s_controls+5288
+CNSTI4 4
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+ADDRGP4 $697
+JUMPV
+LABELV $719
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $697
+ADDRGP4 $722
+ARGP4
+ADDRGP4 Controls_ResetDefaults_Draw
+ARGP4
+ADDRGP4 Controls_ResetDefaults_Action
+ARGP4
+ADDRGP4 UI_ConfirmMenu
+CALLV
+pop
+ADDRGP4 $697
+JUMPV
+LABELV $723
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $697
+ADDRGP4 s_controls+4772
+INDIRI4
+CNSTI4 0
+EQI4 $726
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+LABELV $726
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $697
+JUMPV
+LABELV $729
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $697
+ADDRGP4 Controls_SetConfig
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $697
+JUMPV
+LABELV $732
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $697
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $697
+JUMPV
+LABELV $735
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $697
+ADDRGP4 s_controls+4772
+CNSTI4 1
+ASGNI4
+ADDRGP4 $697
+JUMPV
+LABELV $739
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $697
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 UI_JoystickMenu
+CALLV
+pop
+LABELV $696
+LABELV $697
+LABELV $695
+endproc Controls_MenuEvent 12 12
+proc Controls_ActionEvent 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $749
+CNSTI4 0
+ARGI4
+ADDRGP4 Controls_UpdateModel
+CALLV
+pop
+ADDRGP4 $750
+JUMPV
+LABELV $749
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $751
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 g_bindings+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Controls_UpdateModel
+CALLV
+pop
+ADDRGP4 $752
+JUMPV
+LABELV $751
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $754
+ADDRGP4 waitingforkey
+INDIRI4
+CNSTI4 0
+NEI4 $754
+ADDRGP4 waitingforkey
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+LABELV $754
+LABELV $752
+LABELV $750
+LABELV $748
+endproc Controls_ActionEvent 0 4
+proc Controls_InitModel 136 16
+ADDRGP4 s_controls+3244
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1528
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $453
+ARGP4
+ADDRLP4 128
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $455
+ARGP4
+ADDRLP4 132
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 s_controls+3244
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 Controls_UpdateModel
+CALLV
+pop
+LABELV $756
+endproc Controls_InitModel 136 16
+proc Controls_InitWeapons 8 4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $765
+JUMPV
+LABELV $762
+ADDRLP4 4
+CNSTI4 48
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $766
+ADDRGP4 $763
+JUMPV
+LABELV $766
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+pop
+LABELV $763
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $765
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $762
+LABELV $761
+endproc Controls_InitWeapons 8 4
+bss
+align 1
+LABELV $769
+skip 32
+code
+proc Controls_MenuInit 8 12
+ADDRGP4 s_controls
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 5632
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 s_controls+5620
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_controls+5620
+INDIRI4
+CNSTI4 0
+NEI4 $771
+ADDRGP4 s_controls+5624
+ADDRGP4 g_controls
+ASGNP4
+ADDRGP4 s_controls+5628
+ADDRGP4 g_bindings
+ASGNP4
+ADDRGP4 $772
+JUMPV
+LABELV $771
+ADDRGP4 s_controls+5624
+ADDRGP4 g_mini_controls
+ASGNP4
+ADDRGP4 s_controls+5620
+INDIRI4
+CNSTI4 1
+NEI4 $777
+ADDRGP4 s_controls+5628
+ADDRGP4 g_bindings2
+ASGNP4
+ADDRGP4 $778
+JUMPV
+LABELV $777
+ADDRGP4 s_controls+5620
+INDIRI4
+CNSTI4 2
+NEI4 $781
+ADDRGP4 s_controls+5628
+ADDRGP4 g_bindings3
+ASGNP4
+ADDRGP4 $782
+JUMPV
+LABELV $781
+ADDRGP4 s_controls+5628
+ADDRGP4 g_bindings4
+ASGNP4
+LABELV $782
+LABELV $778
+LABELV $772
+ADDRGP4 Controls_Cache
+CALLV
+pop
+ADDRGP4 s_controls+272
+ADDRGP4 Controls_MenuKey
+ASGNP4
+ADDRGP4 s_controls+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_controls+288+44
+CNSTU4 8
+ASGNU4
+ADDRGP4 s_controls+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_controls+288+60
+ADDRGP4 $798
+ASGNP4
+ADDRGP4 s_controls+288+68
+ADDRGP4 text_banner_color
+ASGNP4
+ADDRGP4 s_controls+288+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+360
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+360+4
+ADDRGP4 $806
+ASGNP4
+ADDRGP4 s_controls+360+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 s_controls+360+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+360+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_controls+360+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_controls+360+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_controls+448
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+448+4
+ADDRGP4 $820
+ASGNP4
+ADDRGP4 s_controls+448+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 s_controls+448+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_controls+448+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_controls+448+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_controls+448+80
+CNSTI4 334
+ASGNI4
+ADDRLP4 0
+CNSTI4 186
+ASGNI4
+ADDRGP4 s_controls+696
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+696+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_controls+696+8
+CNSTI4 101
+ASGNI4
+ADDRGP4 s_controls+696+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+696+12
+CNSTI4 152
+ASGNI4
+ADDRGP4 s_controls+696+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_controls+696+60
+ADDRGP4 $844
+ASGNP4
+ADDRGP4 s_controls+696+64
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_controls+696+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 27
+ADDI4
+ASGNI4
+ADDRGP4 s_controls+624
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+624+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_controls+624+8
+CNSTI4 100
+ASGNI4
+ADDRGP4 s_controls+624+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+624+12
+CNSTI4 152
+ASGNI4
+ADDRGP4 s_controls+624+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_controls+624+60
+ADDRGP4 $862
+ASGNP4
+ADDRGP4 s_controls+624+64
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_controls+624+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 27
+ADDI4
+ASGNI4
+ADDRGP4 s_controls+768
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+768+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_controls+768+8
+CNSTI4 102
+ASGNI4
+ADDRGP4 s_controls+768+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+768+12
+CNSTI4 152
+ASGNI4
+ADDRGP4 s_controls+768+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_controls+768+60
+ADDRGP4 $880
+ASGNP4
+ADDRGP4 s_controls+768+64
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_controls+768+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 27
+ADDI4
+ASGNI4
+ADDRGP4 s_controls+840
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+840+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_controls+840+8
+CNSTI4 103
+ASGNI4
+ADDRGP4 s_controls+840+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+840+12
+CNSTI4 152
+ASGNI4
+ADDRGP4 s_controls+840+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_controls+840+60
+ADDRGP4 $898
+ASGNP4
+ADDRGP4 s_controls+840+64
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_controls+840+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 27
+ADDI4
+ASGNI4
+ADDRGP4 s_controls+912
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+912+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_controls+912+8
+CNSTI4 108
+ASGNI4
+ADDRGP4 s_controls+912+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+912+12
+CNSTI4 152
+ASGNI4
+ADDRGP4 s_controls+912+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_controls+912+60
+ADDRGP4 $916
+ASGNP4
+ADDRGP4 s_controls+912+64
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_controls+912+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRGP4 s_controls+5460
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+5460+4
+ADDRGP4 $924
+ASGNP4
+ADDRGP4 s_controls+5460+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_controls+5460+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+5460+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_controls+5460+8
+CNSTI4 105
+ASGNI4
+ADDRGP4 s_controls+5460+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+5460+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_controls+5460+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_controls+5460+60
+ADDRGP4 $941
+ASGNP4
+ADDRGP4 s_controls+536
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+536+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_controls+536+56
+ADDRGP4 Controls_DrawPlayer
+ASGNP4
+ADDRGP4 s_controls+536+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_controls+536+16
+CNSTI4 -40
+ASGNI4
+ADDRGP4 s_controls+536+76
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+536+80
+CNSTI4 560
+ASGNI4
+ADDRGP4 s_controls+984
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+984+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+984+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+984+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+984+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_controls+1044
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1044+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1044+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1044+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1044+8
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_controls+1104
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1104+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1104+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1104+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1104+8
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+1164
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1164+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1164+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1164+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1164+8
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_controls+1224
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1224+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1224+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1224+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1224+8
+CNSTI4 7
+ASGNI4
+ADDRGP4 s_controls+1284
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1284+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1284+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1284+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1284+8
+CNSTI4 8
+ASGNI4
+ADDRGP4 s_controls+1344
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1344+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1344+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1344+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1344+8
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+1404
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1404+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1404+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1404+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1404+8
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_controls+1464
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1464+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1464+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1464+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1464+8
+CNSTI4 11
+ASGNI4
+ADDRGP4 s_controls+1524
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1524+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1524+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1524+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1524+8
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1644
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1644+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1644+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1644+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1644+8
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_controls+1584
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1584+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1584+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1584+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1584+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_controls+1704
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1704+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1704+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1704+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1704+8
+CNSTI4 19
+ASGNI4
+ADDRGP4 s_controls+1764
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1764+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1764+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1764+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1764+8
+CNSTI4 20
+ASGNI4
+ADDRGP4 s_controls+1824
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1824+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1824+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1824+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1824+8
+CNSTI4 21
+ASGNI4
+ADDRGP4 s_controls+1884
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1884+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1884+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1884+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1884+8
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_controls+1944
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+1944+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+1944+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+1944+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+1944+8
+CNSTI4 23
+ASGNI4
+ADDRGP4 s_controls+2004
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2004+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2004+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2004+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2004+8
+CNSTI4 24
+ASGNI4
+ADDRGP4 s_controls+2064
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2064+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2064+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2064+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2064+8
+CNSTI4 25
+ASGNI4
+ADDRGP4 s_controls+2124
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2124+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2124+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2124+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2124+8
+CNSTI4 26
+ASGNI4
+ADDRGP4 s_controls+2184
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2184+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2184+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2184+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2184+8
+CNSTI4 27
+ASGNI4
+ADDRGP4 s_controls+2244
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2244+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2244+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2244+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2244+8
+CNSTI4 28
+ASGNI4
+ADDRGP4 s_controls+2304
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2304+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2304+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2304+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2304+8
+CNSTI4 12
+ASGNI4
+ADDRGP4 s_controls+2364
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2364+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2364+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2364+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2364+8
+CNSTI4 13
+ASGNI4
+ADDRGP4 s_controls+2424
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2424+44
+CNSTU4 12420
+ASGNU4
+ADDRGP4 s_controls+2424+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2424+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2424+8
+CNSTI4 14
+ASGNI4
+ADDRGP4 s_controls+2484
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+2484+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+2484+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+2484+4
+ADDRGP4 $1187
+ASGNP4
+ADDRGP4 s_controls+2484+8
+CNSTI4 35
+ASGNI4
+ADDRGP4 s_controls+2484+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+2484+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+2548
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2548+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2548+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2548+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2548+8
+CNSTI4 15
+ASGNI4
+ADDRGP4 s_controls+2608
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2608+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2608+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2608+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2608+8
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_controls+3184
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+3184+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+3184+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+3184+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+3184+8
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+2996
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2996+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2996+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2996+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2996+8
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_controls+2728
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+2728+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+2728+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+2728+4
+ADDRGP4 $1237
+ASGNP4
+ADDRGP4 s_controls+2728+8
+CNSTI4 36
+ASGNI4
+ADDRGP4 s_controls+2728+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+2728+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+2868
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+2868+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+2868+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+2868+4
+ADDRGP4 $1251
+ASGNP4
+ADDRGP4 s_controls+2868+8
+CNSTI4 44
+ASGNI4
+ADDRGP4 s_controls+2868+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+2868+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+2932
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+2932+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+2932+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+2932+4
+ADDRGP4 $1265
+ASGNP4
+ADDRGP4 s_controls+2932+8
+CNSTI4 37
+ASGNI4
+ADDRGP4 s_controls+2932+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+2932+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+3056
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+3056+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+3056+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+3056+4
+ADDRGP4 $1279
+ASGNP4
+ADDRGP4 s_controls+3056+8
+CNSTI4 38
+ASGNI4
+ADDRGP4 s_controls+3056+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+3056+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+3120
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+3120+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+3120+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+3120+4
+ADDRGP4 $1293
+ASGNP4
+ADDRGP4 s_controls+3120+8
+CNSTI4 39
+ASGNI4
+ADDRGP4 s_controls+3120+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+3120+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+2792
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+2792+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+2792+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+2792+4
+ADDRGP4 $1307
+ASGNP4
+ADDRGP4 s_controls+2792+8
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_controls+2792+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+2792+60
+CNSTF4 1073741824
+ASGNF4
+ADDRGP4 s_controls+2792+64
+CNSTF4 1106247680
+ASGNF4
+ADDRGP4 s_controls+2792+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+2668
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+2668+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+2668+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+2668+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+2668+8
+CNSTI4 29
+ASGNI4
+ADDRGP4 s_controls+4776
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4776+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+4776+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4776+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4776+8
+CNSTI4 30
+ASGNI4
+ADDRGP4 s_controls+4836
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4836+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+4836+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4836+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4836+8
+CNSTI4 31
+ASGNI4
+ADDRGP4 s_controls+4896
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4896+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+4896+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4896+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4896+8
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_controls+4956
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+4956+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+4956+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+4956+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+4956+8
+CNSTI4 33
+ASGNI4
+ADDRGP4 s_controls+5016
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5016+44
+CNSTU4 12548
+ASGNU4
+ADDRGP4 s_controls+5016+48
+ADDRGP4 Controls_ActionEvent
+ASGNP4
+ADDRGP4 s_controls+5016+56
+ADDRGP4 Controls_DrawKeyBinding
+ASGNP4
+ADDRGP4 s_controls+5016+8
+CNSTI4 34
+ASGNI4
+ADDRGP4 s_controls+5076
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+5076+44
+CNSTU4 274
+ASGNU4
+ADDRGP4 s_controls+5076+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+5076+8
+CNSTI4 41
+ASGNI4
+ADDRGP4 s_controls+5076+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+5076+56
+ADDRGP4 Controls_DrawSmallText
+ASGNP4
+ADDRGP4 s_controls+5076+60
+ADDRGP4 $1385
+ASGNP4
+ADDRGP4 s_controls+5076+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 s_controls+5076+64
+CNSTI4 259
+ASGNI4
+ADDRGP4 s_controls+5148
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_controls+5148+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+5148+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+5148+4
+ADDRGP4 $1397
+ASGNP4
+ADDRGP4 s_controls+5148+8
+CNSTI4 42
+ASGNI4
+ADDRGP4 s_controls+5148+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+5148+60
+CNSTF4 1028443341
+ASGNF4
+ADDRGP4 s_controls+5148+64
+CNSTF4 1061158912
+ASGNF4
+ADDRGP4 s_controls+5148+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+5224
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_controls+5224+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_controls+5224+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+5224+4
+ADDRGP4 $1415
+ASGNP4
+ADDRGP4 s_controls+5224+8
+CNSTI4 43
+ASGNI4
+ADDRGP4 s_controls+5224+48
+ADDRGP4 Controls_MenuEvent
+ASGNP4
+ADDRGP4 s_controls+5224+52
+ADDRGP4 Controls_StatusBar
+ASGNP4
+ADDRGP4 s_controls+5548
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_controls+5548+44
+CNSTU4 16392
+ASGNU4
+ADDRGP4 s_controls+5548+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_controls+5548+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 s_controls+5548+60
+ADDRGP4 $769
+ASGNP4
+ADDRGP4 s_controls+5548+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_controls+5548+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5548
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+696
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+624
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+768
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+840
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+912
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2792
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2868
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2728
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2304
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2364
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2424
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2484
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2548
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2608
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5076
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5148
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5224
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2932
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1524
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+984
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1044
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1104
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1164
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1224
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1284
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1344
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1404
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1464
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2124
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2244
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2184
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+3056
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+3120
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1644
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1584
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1704
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1764
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1824
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1884
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+1944
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2004
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2064
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2996
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+3184
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+2668
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4776
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4836
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4896
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+4956
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5016
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 s_controls+5460
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_controls+5620
+INDIRI4
+ARGI4
+ADDRGP4 $1492
+ARGP4
+ADDRLP4 4
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 s_controls+5548+60
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 s_controls+5548+60
+INDIRP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRGP4 Controls_GetConfig
+CALLV
+pop
+ADDRGP4 Controls_InitModel
+CALLV
+pop
+ADDRGP4 Controls_InitWeapons
+CALLV
+pop
+ADDRGP4 s_controls+5288
+CNSTI4 1
+ASGNI4
+ADDRGP4 Controls_Update
+CALLV
+pop
+LABELV $768
+endproc Controls_MenuInit 8 12
+export Controls_WantsBindKeys
+proc Controls_WantsBindKeys 0 0
+ADDRGP4 waitingforkey
+INDIRI4
+RETI4
+LABELV $1498
+endproc Controls_WantsBindKeys 0 0
+export Controls_Cache
+proc Controls_Cache 0 4
+ADDRGP4 $924
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $941
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $806
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $820
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1499
+endproc Controls_Cache 0 4
+export UI_ControlsMenu
+proc UI_ControlsMenu 0 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Controls_MenuInit
+CALLV
+pop
+ADDRGP4 s_controls
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1500
+endproc UI_ControlsMenu 0 4
+bss
+align 4
+LABELV s_controls
+skip 5632
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPMap_f
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_MaxSplitView
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_CursorInRect
+import UI_DrawChar
+import UI_MField_Draw
+import UI_DrawStrlen
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_InitPropFont
+import UI_InitBannerFont
+import UI_LerpColor
+import UI_RegisterPlayerModelname
+import UI_PlayerInfo_UpdateColor
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import UI_Joystick_Cache
+import UI_JoystickMenu
+import UI_SelectPlayer_Cache
+import UI_SelectPlayerMenu
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import InSelectPlayerMenu
+import InSelectPlayer_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_small_title_color
+import text_big_color
+import text_banner_color
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_menuFontBanner
+import ui_menuFontProp
+import ui_menuFont
+import ui_ioq3
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserSeparateMasters
+import ui_browserShowBots
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserGame
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_publicServer
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import UI_DrawProportionalString
+import UI_WindowResized
+import UI_WantsBindKeys
+import UI_DrawConnectScreen
+import UI_ConsoleCommand
+import UI_SetActiveMenu
+import UI_Refresh
+import UI_IsFullscreen
+import UI_SetCursorPos
+import UI_GetCursorPos
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import ui_numCommands
+import ui_commands
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_drawScores
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1492
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1415
+byte 1 97
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $1397
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $1385
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $1307
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1293
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $1279
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1265
+byte 1 97
+byte 1 108
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $1251
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1237
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1187
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $941
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $924
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $916
+byte 1 74
+byte 1 79
+byte 1 89
+byte 1 0
+align 1
+LABELV $898
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 67
+byte 1 0
+align 1
+LABELV $880
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $862
+byte 1 77
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 0
+align 1
+LABELV $844
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 75
+byte 1 0
+align 1
+LABELV $820
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $806
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 50
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $798
+byte 1 67
+byte 1 79
+byte 1 78
+byte 1 84
+byte 1 82
+byte 1 79
+byte 1 76
+byte 1 83
+byte 1 0
+align 1
+LABELV $722
+byte 1 83
+byte 1 69
+byte 1 84
+byte 1 32
+byte 1 84
+byte 1 79
+byte 1 32
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 65
+byte 1 85
+byte 1 76
+byte 1 84
+byte 1 83
+byte 1 63
+byte 1 0
+align 1
+LABELV $694
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $693
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $679
+byte 1 0
+align 1
+LABELV $601
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 78
+byte 1 111
+byte 1 0
+align 1
+LABELV $599
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $522
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 65
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $518
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 84
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $514
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $510
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 80
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $506
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $502
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $499
+byte 1 115
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $496
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $490
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $455
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $453
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $450
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $446
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $435
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $434
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $433
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 65
+byte 1 80
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $427
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 0
+align 1
+LABELV $424
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $180
+byte 1 116
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $179
+byte 1 116
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $178
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $177
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 52
+byte 1 0
+align 1
+LABELV $176
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $175
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $174
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $173
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $172
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $171
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $170
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $169
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $168
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $167
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $166
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 105
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $165
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $164
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $163
+byte 1 43
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $162
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 0
+align 1
+LABELV $161
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 57
+byte 1 0
+align 1
+LABELV $160
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $159
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 56
+byte 1 0
+align 1
+LABELV $158
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $157
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 55
+byte 1 0
+align 1
+LABELV $156
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $155
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 54
+byte 1 0
+align 1
+LABELV $154
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $153
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 53
+byte 1 0
+align 1
+LABELV $152
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $151
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 52
+byte 1 0
+align 1
+LABELV $150
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $149
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 51
+byte 1 0
+align 1
+LABELV $148
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $147
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 50
+byte 1 0
+align 1
+LABELV $146
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $145
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $144
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $143
+byte 1 43
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $142
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $141
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $140
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $139
+byte 1 43
+byte 1 109
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $138
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $137
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $136
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $135
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $134
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 0
+align 1
+LABELV $133
+byte 1 43
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 102
+byte 1 101
+byte 1 0
+align 1
+LABELV $132
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 32
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $131
+byte 1 43
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $130
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $129
+byte 1 43
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $128
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $127
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $126
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $125
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $124
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 32
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $123
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $122
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $121
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $120
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $119
+byte 1 43
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $118
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $117
+byte 1 43
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $116
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 0
+align 1
+LABELV $115
+byte 1 43
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $114
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $113
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 50
+byte 1 0
+align 1
+LABELV $112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $111
+byte 1 43
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
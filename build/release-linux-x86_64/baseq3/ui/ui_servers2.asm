@@ -0,0 +1,8269 @@
+data
+align 4
+LABELV master_items
+address $107
+address $108
+address $109
+address $110
+address $111
+address $112
+address $113
+address $114
+byte 4 0
+align 4
+LABELV mod_desc_items
+address $115
+address $116
+address $117
+address $118
+address $119
+address $120
+address $121
+address $122
+byte 4 0
+align 4
+LABELV mod_dir_items
+address $123
+address $124
+address $125
+address $126
+address $127
+address $128
+address $129
+address $130
+byte 4 0
+align 4
+LABELV servertype_items
+address $115
+address $131
+address $132
+address $133
+address $134
+byte 4 0
+align 4
+LABELV sortkey_items
+address $135
+address $136
+address $137
+address $138
+address $139
+byte 4 0
+align 4
+LABELV netnames
+address $140
+address $141
+address $142
+byte 4 0
+align 1
+LABELV communityMessage
+byte 1 86
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 116
+byte 1 116
+byte 1 112
+byte 1 58
+byte 1 47
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 111
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 85
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+code
+proc ArenaServers_MaxPing 8 4
+ADDRGP4 $147
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+GEI4 $148
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+LABELV $148
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $146
+endproc ArenaServers_MaxPing 8 4
+proc ArenaServers_Compare 68 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 g_sortkey
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $151
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+GTI4 $151
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $170
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $170
+address $153
+address $154
+address $155
+address $164
+address $165
+code
+LABELV $153
+ADDRLP4 20
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $150
+JUMPV
+LABELV $154
+ADDRLP4 28
+CNSTI4 96
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $150
+JUMPV
+LABELV $155
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $156
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+LABELV $156
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 40
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $158
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+LABELV $158
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $160
+CNSTI4 1
+RETI4
+ADDRGP4 $150
+JUMPV
+LABELV $160
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+NEF4 $162
+CNSTI4 0
+RETI4
+ADDRGP4 $150
+JUMPV
+LABELV $162
+CNSTI4 -1
+RETI4
+ADDRGP4 $150
+JUMPV
+LABELV $164
+ADDRLP4 44
+CNSTI4 132
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+RETI4
+ADDRGP4 $150
+JUMPV
+LABELV $165
+ADDRLP4 52
+CNSTI4 124
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $166
+CNSTI4 -1
+RETI4
+ADDRGP4 $150
+JUMPV
+LABELV $166
+ADDRLP4 56
+CNSTI4 124
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $168
+CNSTI4 1
+RETI4
+ADDRGP4 $150
+JUMPV
+LABELV $168
+ADDRLP4 60
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+RETI4
+ADDRGP4 $150
+JUMPV
+LABELV $151
+CNSTI4 0
+RETI4
+LABELV $150
+endproc ArenaServers_Compare 68 8
+export ArenaServers_SourceForLAN
+proc ArenaServers_SourceForLAN 4 0
+ADDRLP4 0
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $172
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+GTI4 $172
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $177
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $177
+address $174
+address $175
+address $175
+address $175
+address $175
+address $175
+address $175
+address $176
+code
+LABELV $172
+LABELV $174
+CNSTI4 0
+RETI4
+ADDRGP4 $171
+JUMPV
+LABELV $175
+CNSTI4 2
+RETI4
+ADDRGP4 $171
+JUMPV
+LABELV $176
+CNSTI4 1
+RETI4
+LABELV $171
+endproc ArenaServers_SourceForLAN 4 0
+export ArenaServers_GametypeForGames
+proc ArenaServers_GametypeForGames 8 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $179
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+GTI4 $179
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $186
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $186
+address $181
+address $182
+address $184
+address $183
+address $185
+code
+LABELV $179
+LABELV $181
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $182
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $183
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $184
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $185
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+LABELV $180
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $178
+endproc ArenaServers_GametypeForGames 8 0
+proc ArenaServers_Go 8 8
+ADDRLP4 0
+ADDRGP4 g_arenaservers+936+64
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_arenaservers+4232+4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $192
+ADDRGP4 $194
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $192
+LABELV $187
+endproc ArenaServers_Go 8 8
+bss
+align 1
+LABELV $196
+skip 64
+code
+proc ArenaServers_UpdatePicture 8 16
+ADDRGP4 g_arenaservers+936+68
+INDIRI4
+CNSTI4 0
+NEI4 $197
+ADDRGP4 g_arenaservers+1032+4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $198
+JUMPV
+LABELV $197
+ADDRLP4 0
+ADDRGP4 g_arenaservers+936+64
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_arenaservers+4232+4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $196
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $207
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $196
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $208
+ADDRGP4 $196
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $208
+ADDRGP4 g_arenaservers+1032+4
+ADDRGP4 $196
+ASGNP4
+LABELV $198
+ADDRGP4 g_arenaservers+1032+68
+CNSTI4 0
+ASGNI4
+LABELV $195
+endproc ArenaServers_UpdatePicture 8 16
+proc ArenaServers_UpdateMenu 80 20
+ADDRGP4 g_arenaservers+6792
+INDIRI4
+CNSTI4 0
+LEI4 $216
+ADDRGP4 g_arenaservers+6808
+INDIRI4
+CNSTI4 0
+EQI4 $219
+ADDRGP4 g_arenaservers+6804
+INDIRI4
+ADDRGP4 g_arenaservers+6792
+INDIRI4
+GTI4 $219
+ADDRGP4 g_arenaservers+1384+60
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $226
+ARGP4
+ADDRGP4 g_arenaservers+6804
+INDIRI4
+ARGI4
+ADDRGP4 g_arenaservers+6792
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 g_arenaservers+1456+60
+ADDRGP4 $231
+ASGNP4
+ADDRGP4 g_arenaservers+6800
+INDIRP4
+ARGP4
+ADDRGP4 g_arenaservers+6796
+INDIRP4
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 156
+ARGU4
+ADDRGP4 ArenaServers_Compare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRGP4 $217
+JUMPV
+LABELV $219
+ADDRLP4 36
+ADDRGP4 g_arenaservers+456+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 g_arenaservers+552+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 g_arenaservers+648+44
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 g_arenaservers+808+44
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 g_arenaservers+744+44
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 g_arenaservers+872+44
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 g_arenaservers+936+44
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 64
+ADDRGP4 g_arenaservers+1704+44
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 68
+ADDRGP4 g_arenaservers+1968+44
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 72
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+LTI4 $252
+ADDRLP4 72
+INDIRI4
+CNSTI4 6
+GTI4 $252
+ADDRGP4 g_arenaservers+1456+60
+ADDRGP4 communityMessage
+ASGNP4
+ADDRGP4 $217
+JUMPV
+LABELV $252
+ADDRGP4 g_arenaservers+1456+60
+ADDRGP4 $123
+ASGNP4
+ADDRGP4 $217
+JUMPV
+LABELV $216
+ADDRGP4 g_arenaservers+6808
+INDIRI4
+CNSTI4 0
+EQI4 $258
+ADDRGP4 g_arenaservers+1384+60
+INDIRP4
+ARGP4
+ADDRGP4 $263
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 g_arenaservers+1456+60
+ADDRGP4 $231
+ASGNP4
+ADDRLP4 36
+ADDRGP4 g_arenaservers+456+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 g_arenaservers+552+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 g_arenaservers+648+44
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 g_arenaservers+808+44
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 g_arenaservers+744+44
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 g_arenaservers+872+44
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 g_arenaservers+936+44
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 64
+ADDRGP4 g_arenaservers+1704+44
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 68
+ADDRGP4 g_arenaservers+1968+44
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $259
+JUMPV
+LABELV $258
+ADDRGP4 g_arenaservers+6792
+INDIRI4
+CNSTI4 0
+GEI4 $284
+ADDRGP4 g_arenaservers+1384+60
+INDIRP4
+ARGP4
+ADDRGP4 $289
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $285
+JUMPV
+LABELV $284
+ADDRGP4 g_arenaservers+1384+60
+INDIRP4
+ARGP4
+ADDRGP4 $292
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $285
+ADDRLP4 36
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+LTI4 $293
+ADDRLP4 36
+INDIRI4
+CNSTI4 6
+GTI4 $293
+ADDRGP4 g_arenaservers+1456+60
+ADDRGP4 communityMessage
+ASGNP4
+ADDRGP4 $294
+JUMPV
+LABELV $293
+ADDRGP4 g_arenaservers+1456+60
+ADDRGP4 $123
+ASGNP4
+LABELV $294
+ADDRLP4 40
+ADDRGP4 g_arenaservers+360+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 g_arenaservers+456+44
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 g_arenaservers+552+44
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 g_arenaservers+648+44
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 g_arenaservers+808+44
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 g_arenaservers+744+44
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 64
+ADDRGP4 g_arenaservers+872+44
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 68
+ADDRGP4 g_arenaservers+936+44
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 72
+ADDRGP4 g_arenaservers+1704+44
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+ADDRLP4 76
+ADDRGP4 g_arenaservers+1968+44
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $259
+ADDRGP4 g_arenaservers+936+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+936+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+936+72
+CNSTI4 0
+ASGNI4
+ADDRGP4 ArenaServers_UpdatePicture
+CALLV
+pop
+ADDRGP4 $215
+JUMPV
+LABELV $217
+ADDRLP4 0
+ADDRGP4 g_arenaservers+6800
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRGP4 g_arenaservers+6796
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $330
+JUMPV
+LABELV $327
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LSHI4
+ADDRGP4 g_arenaservers+4232
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 g_showbots
+INDIRI4
+CNSTI4 0
+NEI4 $332
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $333
+JUMPV
+LABELV $332
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $333
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_emptyservers
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $334
+ADDRLP4 16
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $334
+ADDRGP4 $328
+JUMPV
+LABELV $334
+ADDRGP4 g_fullservers
+INDIRI4
+CNSTI4 0
+NEI4 $336
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+NEI4 $336
+ADDRGP4 $328
+JUMPV
+LABELV $336
+ADDRGP4 g_gametype
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 ArenaServers_GametypeForGames
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $338
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+GEI4 $338
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 bg_netGametypeNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $338
+ADDRGP4 $328
+JUMPV
+LABELV $338
+ADDRLP4 64
+ADDRGP4 g_gameIndex
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+LEI4 $340
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $340
+ADDRGP4 $328
+JUMPV
+LABELV $340
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+GEI4 $342
+ADDRLP4 28
+ADDRGP4 $344
+ASGNP4
+ADDRGP4 $343
+JUMPV
+LABELV $342
+ADDRLP4 76
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $345
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LEI4 $345
+ADDRLP4 28
+ADDRGP4 $344
+ASGNP4
+ADDRGP4 $346
+JUMPV
+LABELV $345
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 200
+GEI4 $347
+ADDRLP4 28
+ADDRGP4 $349
+ASGNP4
+ADDRGP4 $348
+JUMPV
+LABELV $347
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 400
+GEI4 $350
+ADDRLP4 28
+ADDRGP4 $352
+ASGNP4
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRLP4 28
+ADDRGP4 $353
+ASGNP4
+LABELV $351
+LABELV $348
+LABELV $346
+LABELV $343
+ADDRLP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $328
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ASGNP4
+LABELV $330
+ADDRLP4 24
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $327
+ADDRGP4 g_arenaservers+936+68
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+936+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+936+72
+CNSTI4 0
+ASGNI4
+ADDRGP4 ArenaServers_UpdatePicture
+CALLV
+pop
+LABELV $215
+endproc ArenaServers_UpdateMenu 80 20
+proc ArenaServers_Remove 32 12
+ADDRGP4 g_arenaservers+936+68
+INDIRI4
+CNSTI4 0
+NEI4 $361
+ADDRGP4 $360
+JUMPV
+LABELV $361
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 g_arenaservers+936+64
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRGP4 g_arenaservers+4232
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $371
+JUMPV
+LABELV $368
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+6824
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $373
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+7848
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $376
+ADDRLP4 24
+CNSTI4 6
+ASGNI4
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 g_arenaservers+6824
+ADDP4
+ARGP4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 g_arenaservers+6824+64
+ADDP4
+ARGP4
+ADDRGP4 g_arenaservers+7848
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+CNSTI4 64
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $376
+ADDRLP4 20
+ADDRGP4 g_arenaservers+7848
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 g_arenaservers+7848
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+6824
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 64
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $370
+JUMPV
+LABELV $373
+LABELV $369
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $371
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+7848
+INDIRI4
+LTI4 $368
+LABELV $370
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $389
+JUMPV
+LABELV $386
+CNSTI4 156
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $390
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $392
+ADDRLP4 20
+CNSTI4 156
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 g_favoriteserverlist+156
+ADDP4
+ARGP4
+CNSTU4 156
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $392
+ADDRLP4 16
+ADDRGP4 g_numfavoriteservers
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+CNSTI4 156
+ADDRLP4 16
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 156
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $388
+JUMPV
+LABELV $390
+LABELV $387
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $389
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+LTI4 $386
+LABELV $388
+ADDRGP4 g_arenaservers+6792
+ADDRGP4 g_arenaservers+7848
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+6804
+ADDRGP4 g_arenaservers+7848
+INDIRI4
+ASGNI4
+LABELV $360
+endproc ArenaServers_Remove 32 12
+proc ArenaServers_Insert 80 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 g_arenaservers+6796
+INDIRP4
+INDIRI4
+ADDRGP4 g_arenaservers+6816
+INDIRI4
+LTI4 $400
+ADDRLP4 4
+CNSTI4 156
+ADDRGP4 g_arenaservers+6796
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+6800
+INDIRP4
+ADDP4
+CNSTI4 -156
+ADDP4
+ASGNP4
+ADDRGP4 $401
+JUMPV
+LABELV $400
+ADDRLP4 4
+CNSTI4 156
+ADDRGP4 g_arenaservers+6796
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+6800
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 g_arenaservers+6796
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $401
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $409
+ARGP4
+ADDRLP4 12
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $410
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $411
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $412
+ARGP4
+ADDRLP4 28
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $413
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $414
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $415
+ARGP4
+ADDRLP4 52
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $416
+ARGP4
+ADDRLP4 60
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+LTI4 $419
+ADDRLP4 68
+INDIRI4
+CVIU4 4
+CNSTU4 3
+LTU4 $417
+LABELV $419
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $417
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $420
+ARGP4
+ADDRLP4 72
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $424
+JUMPV
+LABELV $421
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 mod_dir_items
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $425
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $423
+JUMPV
+LABELV $425
+LABELV $422
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $424
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 mod_dir_items
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $421
+LABELV $423
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 mod_dir_items
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $427
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $427
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $429
+ARGP4
+ADDRLP4 76
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+LABELV $399
+endproc ArenaServers_Insert 80 12
+export ArenaServers_LoadFavorites
+proc ArenaServers_LoadFavorites 2592 12
+ADDRLP4 2572
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+ARGP4
+ADDRGP4 g_favoriteserverlist
+ARGP4
+CNSTU4 2496
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 68
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+ASGNI4
+ADDRGP4 g_favoriteserverlist
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2496
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 2576
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_numfavoriteservers
+ADDRLP4 2576
+INDIRI4
+ASGNI4
+ADDRLP4 2568
+ADDRLP4 2576
+INDIRI4
+ASGNI4
+LABELV $431
+ADDRGP4 $435
+ARGP4
+ADDRLP4 2568
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 2580
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2580
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $436
+ADDRGP4 $432
+JUMPV
+LABELV $436
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+6824
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $442
+JUMPV
+LABELV $439
+CNSTI4 156
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 72
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2584
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2584
+INDIRI4
+CNSTI4 0
+NEI4 $443
+ADDRGP4 $441
+JUMPV
+LABELV $443
+LABELV $440
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $442
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $439
+LABELV $441
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+GEI4 $445
+ADDRLP4 2588
+CNSTI4 156
+ASGNI4
+ADDRLP4 2588
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 2588
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 72
+ADDP4
+ARGP4
+CNSTU4 156
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 2572
+CNSTI4 1
+ASGNI4
+ADDRGP4 $446
+JUMPV
+LABELV $445
+CNSTI4 156
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 2588
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+CNSTI4 156
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist+124
+ADDP4
+ADDRLP4 2588
+INDIRI4
+ASGNI4
+LABELV $446
+ADDRLP4 2588
+ADDRGP4 g_numfavoriteservers
+ASGNP4
+ADDRLP4 2588
+INDIRP4
+ADDRLP4 2588
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $432
+ADDRLP4 2568
+ADDRLP4 2568
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 2568
+INDIRI4
+CNSTI4 16
+LTI4 $431
+ADDRGP4 g_arenaservers+7848
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+ASGNI4
+ADDRLP4 2572
+INDIRI4
+CNSTI4 0
+NEI4 $449
+ADDRGP4 g_numfavoriteservers
+CNSTI4 0
+ASGNI4
+LABELV $449
+LABELV $430
+endproc ArenaServers_LoadFavorites 2592 12
+proc ArenaServers_StopRefresh 0 16
+ADDRGP4 g_arenaservers+6808
+INDIRI4
+CNSTI4 0
+NEI4 $452
+ADDRGP4 $451
+JUMPV
+LABELV $452
+ADDRGP4 g_arenaservers+6808
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+6792
+INDIRI4
+CNSTI4 0
+LTI4 $456
+ADDRGP4 g_arenaservers+6804
+ADDRGP4 g_arenaservers+6796
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+6792
+ADDRGP4 g_arenaservers+6796
+INDIRP4
+INDIRI4
+ASGNI4
+LABELV $456
+ADDRGP4 g_arenaservers+6800
+INDIRP4
+ARGP4
+ADDRGP4 g_arenaservers+6796
+INDIRP4
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 156
+ARGU4
+ADDRGP4 ArenaServers_Compare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+LABELV $451
+endproc ArenaServers_StopRefresh 0 16
+proc ArenaServers_DoRefresh 1120 16
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 g_arenaservers+6820
+INDIRI4
+GEI4 $466
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 7
+EQI4 $467
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 0
+NEI4 $472
+CNSTI4 0
+ARGI4
+ADDRLP4 1104
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $474
+ADDRGP4 $465
+JUMPV
+LABELV $474
+LABELV $472
+ADDRLP4 1104
+ADDRGP4 ArenaServers_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+ARGI4
+ADDRLP4 1108
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+GEI4 $467
+ADDRGP4 $465
+JUMPV
+LABELV $466
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 0
+NEI4 $478
+CNSTI4 0
+ARGI4
+ADDRLP4 1104
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $480
+CNSTI4 2
+ARGI4
+ADDRGP4 $482
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 g_arenaservers+6820
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRGP4 $465
+JUMPV
+LABELV $480
+LABELV $478
+LABELV $467
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 g_arenaservers+6812
+INDIRI4
+GEI4 $485
+ADDRGP4 $465
+JUMPV
+LABELV $485
+ADDRGP4 g_arenaservers+6812
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 10
+ADDI4
+ASGNI4
+ADDRLP4 1104
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+ADDRLP4 1100
+ADDRLP4 1104
+INDIRI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $491
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRGP4 trap_LAN_GetPing
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $495
+ADDRGP4 $492
+JUMPV
+LABELV $495
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $497
+ADDRLP4 4
+ARGP4
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2056
+ADDP4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $501
+ADDRGP4 $499
+JUMPV
+LABELV $501
+LABELV $498
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $497
+LABELV $499
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $504
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $506
+ADDRLP4 72
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2056+64
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 1100
+INDIRI4
+GEI4 $511
+ADDRGP4 $492
+JUMPV
+LABELV $511
+LABELV $506
+ADDRLP4 72
+INDIRI4
+ADDRLP4 1100
+INDIRI4
+LEI4 $513
+ADDRLP4 76
+CNSTI1 0
+ASGNI1
+ADDRLP4 72
+ADDRLP4 1100
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ARGP4
+ADDRGP4 $409
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 76
+ARGP4
+ADDRGP4 $420
+ARGP4
+ADDRGP4 $515
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $514
+JUMPV
+LABELV $513
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 76
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetPingInfo
+CALLV
+pop
+LABELV $514
+ADDRLP4 4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 ArenaServers_Insert
+CALLV
+pop
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2056
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $504
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 trap_LAN_ClearPing
+CALLV
+pop
+LABELV $492
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 32
+LTI4 $491
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 7
+NEI4 $517
+ADDRGP4 g_arenaservers+6792
+ADDRGP4 g_arenaservers+7848
+INDIRI4
+ASGNI4
+ADDRGP4 $518
+JUMPV
+LABELV $517
+ADDRLP4 1108
+ADDRGP4 ArenaServers_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+6792
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+LABELV $518
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $525
+JUMPV
+LABELV $522
+ADDRLP4 1108
+ADDRGP4 trap_LAN_GetPingQueueCount
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 32
+LTI4 $528
+ADDRGP4 $524
+JUMPV
+LABELV $528
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $530
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2056
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $534
+ADDRGP4 $532
+JUMPV
+LABELV $534
+LABELV $531
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $530
+LABELV $532
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $537
+ADDRGP4 $524
+JUMPV
+LABELV $537
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 7
+NEI4 $539
+ADDRLP4 4
+ARGP4
+ADDRGP4 g_arenaservers+6804
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+6824
+ADDP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $540
+JUMPV
+LABELV $539
+ADDRLP4 1112
+ADDRGP4 ArenaServers_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+ARGI4
+ADDRGP4 g_arenaservers+6804
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_LAN_GetServerAddressString
+CALLV
+pop
+LABELV $540
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2056
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2056+64
+ADDP4
+ADDRGP4 uis+4
+INDIRI4
+ASGNI4
+ADDRGP4 $548
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1112
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1112
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 1116
+ADDRGP4 g_arenaservers+6804
+ASGNP4
+ADDRLP4 1116
+INDIRP4
+ADDRLP4 1116
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $523
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $525
+ADDRLP4 68
+INDIRI4
+CNSTI4 32
+GEI4 $550
+ADDRGP4 g_arenaservers+6804
+INDIRI4
+ADDRGP4 g_arenaservers+6792
+INDIRI4
+LTI4 $522
+LABELV $550
+LABELV $524
+ADDRLP4 1108
+ADDRGP4 trap_LAN_GetPingQueueCount
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $551
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 $465
+JUMPV
+LABELV $551
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+LABELV $465
+endproc ArenaServers_DoRefresh 1120 16
+proc ArenaServers_StartRefresh 124 16
+ADDRGP4 g_arenaservers+6800
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 g_arenaservers+6816
+INDIRI4
+CVIU4 4
+CNSTI4 4
+LSHU4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $556
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+2056
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_LAN_ClearPing
+CALLV
+pop
+LABELV $557
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $556
+ADDRGP4 g_arenaservers+6808
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+6804
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+6812
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+6796
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+6792
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+6820
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 0
+NEI4 $568
+CNSTI4 2
+ARGI4
+ADDRGP4 $482
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $553
+JUMPV
+LABELV $568
+ADDRLP4 104
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 1
+LTI4 $570
+ADDRLP4 104
+INDIRI4
+CNSTI4 6
+GTI4 $570
+ADDRGP4 g_arenaservers+552+64
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 ArenaServers_GametypeForGames
+CALLI4
+ASGNI4
+ADDRLP4 100
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 -1
+EQI4 $574
+ADDRLP4 36
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $576
+ARGP4
+ADDRLP4 100
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 bg_netGametypeNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $575
+JUMPV
+LABELV $574
+ADDRLP4 36
+CNSTI1 0
+ASGNI1
+LABELV $575
+ADDRGP4 g_emptyservers
+INDIRI4
+CNSTI4 0
+EQI4 $577
+ADDRLP4 36
+ARGP4
+ADDRGP4 $579
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $577
+ADDRGP4 g_fullservers
+INDIRI4
+CNSTI4 0
+EQI4 $580
+ADDRLP4 36
+ARGP4
+ADDRGP4 $582
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $580
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $583
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 112
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 112
+INDIRU4
+CNSTU4 0
+EQU4 $584
+ADDRGP4 $586
+ARGP4
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 116
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $585
+JUMPV
+LABELV $584
+ADDRGP4 $588
+ARGP4
+ADDRLP4 116
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $587
+ARGP4
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 116
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRLP4 120
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $585
+LABELV $570
+LABELV $553
+endproc ArenaServers_StartRefresh 124 16
+export ArenaServers_SaveChanges
+proc ArenaServers_SaveChanges 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $593
+JUMPV
+LABELV $590
+ADDRGP4 $435
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+6824
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $591
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $593
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+7848
+INDIRI4
+LTI4 $590
+ADDRGP4 $599
+JUMPV
+LABELV $596
+ADDRGP4 $435
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $123
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $597
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $599
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $596
+LABELV $589
+endproc ArenaServers_SaveChanges 12 8
+export ArenaServers_Sort
+proc ArenaServers_Sort 0 16
+ADDRGP4 g_sortkey
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $601
+ADDRGP4 $600
+JUMPV
+LABELV $601
+ADDRGP4 g_sortkey
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+6800
+INDIRP4
+ARGP4
+ADDRGP4 g_arenaservers+6796
+INDIRP4
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 156
+ARGU4
+ADDRGP4 ArenaServers_Compare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $600
+endproc ArenaServers_Sort 0 16
+export ArenaServers_SetType
+proc ArenaServers_SetType 36 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $606
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+GTI4 $606
+ADDRLP4 28
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $611
+ADDRFP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 8
+MODI4
+NEI4 $609
+LABELV $611
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $613
+JUMPV
+LABELV $609
+ADDRLP4 20
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $613
+JUMPV
+LABELV $612
+ADDRGP4 ui_browserSeparateMasters+12
+INDIRI4
+CNSTI4 0
+EQI4 $615
+ADDRLP4 6
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 $618
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 6
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $619
+ADDRGP4 $614
+JUMPV
+LABELV $619
+LABELV $615
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $613
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $621
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+LEI4 $612
+LABELV $621
+LABELV $614
+LABELV $606
+ADDRGP4 g_servertype
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $622
+ADDRFP4 0
+INDIRI4
+CNSTI4 7
+GTI4 $622
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $644
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $644
+address $624
+address $630
+address $630
+address $630
+address $630
+address $630
+address $630
+address $638
+code
+LABELV $622
+LABELV $624
+ADDRLP4 8
+ADDRGP4 g_arenaservers+1528+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 g_arenaservers+6800
+ADDRGP4 g_localserverlist
+ASGNP4
+ADDRGP4 g_arenaservers+6796
+ADDRGP4 g_numlocalservers
+ASGNP4
+ADDRGP4 g_arenaservers+6816
+CNSTI4 128
+ASGNI4
+ADDRGP4 $623
+JUMPV
+LABELV $630
+ADDRLP4 12
+ADDRGP4 g_arenaservers+1528+44
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 g_arenaservers+6800
+CNSTI4 19968
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_globalserverlist-19968
+ADDP4
+ASGNP4
+ADDRGP4 g_arenaservers+6796
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_numglobalservers-4
+ADDP4
+ASGNP4
+ADDRGP4 g_arenaservers+6816
+CNSTI4 128
+ASGNI4
+ADDRGP4 $623
+JUMPV
+LABELV $638
+ADDRLP4 16
+ADDRGP4 g_arenaservers+1528+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRGP4 g_arenaservers+6800
+ADDRGP4 g_favoriteserverlist
+ASGNP4
+ADDRGP4 g_arenaservers+6796
+ADDRGP4 g_numfavoriteservers
+ASGNP4
+ADDRGP4 g_arenaservers+6816
+CNSTI4 16
+ASGNI4
+LABELV $623
+ADDRGP4 g_arenaservers+6796
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $645
+ADDRGP4 ArenaServers_StartRefresh
+CALLV
+pop
+ADDRGP4 $646
+JUMPV
+LABELV $645
+ADDRGP4 g_arenaservers+6804
+ADDRGP4 g_arenaservers+6796
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+6792
+ADDRGP4 g_arenaservers+6796
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 g_arenaservers+1384+60
+INDIRP4
+ARGP4
+ADDRGP4 $654
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $646
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $605
+endproc ArenaServers_SetType 36 16
+proc ArenaServers_Event 12 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $656
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+EQI4 $656
+ADDRGP4 $655
+JUMPV
+LABELV $656
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $658
+ADDRLP4 0
+INDIRI4
+CNSTI4 25
+GTI4 $658
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $717-40
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $717
+address $660
+address $674
+address $680
+address $686
+address $692
+address $704
+address $707
+address $709
+address $711
+address $712
+address $713
+address $714
+address $715
+address $716
+address $698
+address $668
+code
+LABELV $660
+ADDRGP4 g_arenaservers+360+64
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 ArenaServers_SetType
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+360+64
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $665
+ARGP4
+ADDRGP4 g_arenaservers+360+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $659
+JUMPV
+LABELV $668
+ADDRGP4 $669
+ARGP4
+ADDRGP4 g_arenaservers+456+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 mod_dir_items
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 g_gameIndex
+ADDRGP4 g_arenaservers+456+64
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $659
+JUMPV
+LABELV $674
+ADDRGP4 $675
+ARGP4
+ADDRGP4 g_arenaservers+552+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_gametype
+ADDRGP4 g_arenaservers+552+64
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $659
+JUMPV
+LABELV $680
+ADDRGP4 $681
+ARGP4
+ADDRGP4 g_arenaservers+648+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_arenaservers+648+64
+INDIRI4
+ARGI4
+ADDRGP4 ArenaServers_Sort
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $659
+JUMPV
+LABELV $686
+ADDRGP4 $687
+ARGP4
+ADDRGP4 g_arenaservers+744+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_fullservers
+ADDRGP4 g_arenaservers+744+60
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $659
+JUMPV
+LABELV $692
+ADDRGP4 $693
+ARGP4
+ADDRGP4 g_arenaservers+808+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_emptyservers
+ADDRGP4 g_arenaservers+808+60
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $659
+JUMPV
+LABELV $698
+ADDRGP4 $699
+ARGP4
+ADDRGP4 g_arenaservers+872+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_showbots
+ADDRGP4 g_arenaservers+872+60
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $659
+JUMPV
+LABELV $704
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $659
+ADDRGP4 ArenaServers_UpdatePicture
+CALLV
+pop
+ADDRGP4 $659
+JUMPV
+LABELV $707
+ADDRGP4 g_arenaservers+936
+ARGP4
+CNSTI4 131
+ARGI4
+ADDRGP4 ScrollList_Key
+CALLI4
+pop
+ADDRGP4 $659
+JUMPV
+LABELV $709
+ADDRGP4 g_arenaservers+936
+ARGP4
+CNSTI4 132
+ARGI4
+ADDRGP4 ScrollList_Key
+CALLI4
+pop
+ADDRGP4 $659
+JUMPV
+LABELV $711
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 ArenaServers_SaveChanges
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $659
+JUMPV
+LABELV $712
+ADDRGP4 ArenaServers_StartRefresh
+CALLV
+pop
+ADDRGP4 $659
+JUMPV
+LABELV $713
+ADDRGP4 UI_SpecifyServerMenu
+CALLV
+pop
+ADDRGP4 $659
+JUMPV
+LABELV $714
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_StartServerMenu
+CALLV
+pop
+ADDRGP4 $659
+JUMPV
+LABELV $715
+ADDRGP4 ArenaServers_Go
+CALLV
+pop
+ADDRGP4 $659
+JUMPV
+LABELV $716
+ADDRGP4 ArenaServers_Remove
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+LABELV $658
+LABELV $659
+LABELV $655
+endproc ArenaServers_Event 12 8
+proc ArenaServers_MenuDraw 0 4
+ADDRGP4 g_arenaservers+6808
+INDIRI4
+CNSTI4 0
+EQI4 $720
+ADDRGP4 ArenaServers_DoRefresh
+CALLV
+pop
+LABELV $720
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $719
+endproc ArenaServers_MenuDraw 0 4
+proc ArenaServers_MenuKey 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+NEI4 $724
+ADDRGP4 g_arenaservers+6808
+INDIRI4
+CNSTI4 0
+EQI4 $724
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $723
+JUMPV
+LABELV $724
+ADDRFP4 0
+INDIRI4
+CNSTI4 146
+EQI4 $730
+ADDRFP4 0
+INDIRI4
+CNSTI4 177
+NEI4 $727
+LABELV $730
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 7
+NEI4 $727
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRGP4 g_arenaservers+936
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $727
+ADDRGP4 ArenaServers_Remove
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $723
+JUMPV
+LABELV $727
+ADDRFP4 0
+INDIRI4
+CNSTI4 185
+EQI4 $733
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+NEI4 $731
+LABELV $733
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 ArenaServers_SaveChanges
+CALLV
+pop
+LABELV $731
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $723
+endproc ArenaServers_MenuKey 16 8
+export ArenaServers_DrawServerList
+proc ArenaServers_DrawServerList 48 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 g_arenaservers+4232
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1099956224
+ARGF4
+ADDRGP4 CG_SetClipRegion
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1099956224
+ARGF4
+ADDRGP4 CG_SetClipRegion
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 96
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 5
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRGP4 CG_ClearClipRegion
+CALLV
+pop
+ADDRGP4 $736
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1099956224
+ARGF4
+ADDRGP4 CG_SetClipRegion
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 132
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 5
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRGP4 CG_ClearClipRegion
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 netnames
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 3
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRGP4 CG_ClearClipRegion
+CALLV
+pop
+ADDRGP4 $737
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+CNSTI4 -16
+BANDI4
+CNSTI4 3
+BORI4
+ARGI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDI4
+ASGNI4
+LABELV $734
+endproc ArenaServers_DrawServerList 48 20
+export ServerList_Draw
+proc ServerList_Draw 56 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $740
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRGP4 $741
+JUMPV
+LABELV $740
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+LABELV $741
+ADDRLP4 32
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 $745
+JUMPV
+LABELV $742
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $749
+JUMPV
+LABELV $746
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+LTI4 $750
+ADDRGP4 $748
+JUMPV
+LABELV $750
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+NEI4 $752
+ADDRLP4 24
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8
+BANDU4
+CNSTU4 0
+EQU4 $754
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 2
+DIVI4
+CNSTI4 1
+ADDI4
+SUBI4
+ASGNI4
+LABELV $754
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+CVIF4 4
+ARGF4
+CNSTF4 1099956224
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $756
+ADDRLP4 8
+CNSTI4 33025
+ASGNI4
+ADDRGP4 $753
+JUMPV
+LABELV $756
+ADDRLP4 8
+CNSTI4 257
+ASGNI4
+ADDRGP4 $753
+JUMPV
+LABELV $752
+ADDRLP4 16
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRLP4 8
+CNSTI4 257
+ASGNI4
+LABELV $753
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8
+BANDU4
+CNSTU4 0
+EQU4 $758
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 -16
+BANDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $758
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 ArenaServers_DrawServerList
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $747
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $749
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDI4
+LTI4 $746
+LABELV $748
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 3
+LSHI4
+ADDI4
+ASGNI4
+LABELV $743
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $745
+ADDRLP4 36
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+LTI4 $742
+LABELV $738
+endproc ServerList_Draw 56 20
+bss
+align 1
+LABELV $761
+skip 64
+code
+proc ArenaServers_MenuInit 48 16
+ADDRGP4 g_arenaservers
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 7852
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 ArenaServers_Cache
+CALLV
+pop
+ADDRGP4 g_arenaservers+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+268
+ADDRGP4 ArenaServers_MenuDraw
+ASGNP4
+ADDRGP4 g_arenaservers+272
+ADDRGP4 ArenaServers_MenuKey
+ASGNP4
+ADDRGP4 g_arenaservers+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 g_arenaservers+288+44
+CNSTU4 8
+ASGNU4
+ADDRGP4 g_arenaservers+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 g_arenaservers+288+60
+ADDRGP4 $775
+ASGNP4
+ADDRGP4 g_arenaservers+288+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 g_arenaservers+288+68
+ADDRGP4 text_banner_color
+ASGNP4
+ADDRLP4 4
+CNSTI4 80
+ASGNI4
+ADDRGP4 g_arenaservers+360
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+360+4
+ADDRGP4 $783
+ASGNP4
+ADDRGP4 g_arenaservers+360+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+360+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+360+8
+CNSTI4 10
+ASGNI4
+ADDRGP4 g_arenaservers+360+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+360+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+360+76
+ADDRGP4 master_items
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+456
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+456+4
+ADDRGP4 $799
+ASGNP4
+ADDRGP4 g_arenaservers+456+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+456+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+456+8
+CNSTI4 25
+ASGNI4
+ADDRGP4 g_arenaservers+456+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+456+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+456+76
+ADDRGP4 mod_desc_items
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+552
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+552+4
+ADDRGP4 $815
+ASGNP4
+ADDRGP4 g_arenaservers+552+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+552+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+552+8
+CNSTI4 11
+ASGNI4
+ADDRGP4 g_arenaservers+552+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+552+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+552+76
+ADDRGP4 servertype_items
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+648
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+648+4
+ADDRGP4 $831
+ASGNP4
+ADDRGP4 g_arenaservers+648+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+648+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+648+8
+CNSTI4 12
+ASGNI4
+ADDRGP4 g_arenaservers+648+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+648+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+648+76
+ADDRGP4 sortkey_items
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+744
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_arenaservers+744+4
+ADDRGP4 $847
+ASGNP4
+ADDRGP4 g_arenaservers+744+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+744+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+744+8
+CNSTI4 13
+ASGNI4
+ADDRGP4 g_arenaservers+744+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+744+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+808
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_arenaservers+808+4
+ADDRGP4 $861
+ASGNP4
+ADDRGP4 g_arenaservers+808+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+808+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+808+8
+CNSTI4 14
+ASGNI4
+ADDRGP4 g_arenaservers+808+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+808+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+872
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_arenaservers+872+4
+ADDRGP4 $875
+ASGNP4
+ADDRGP4 g_arenaservers+872+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+872+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+872+8
+CNSTI4 24
+ASGNI4
+ADDRGP4 g_arenaservers+872+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+872+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+CNSTF4 1103101952
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+936
+CNSTI4 8
+ASGNI4
+ADDRGP4 g_arenaservers+936+44
+CNSTU4 65664
+ASGNU4
+ADDRGP4 g_arenaservers+936+8
+CNSTI4 15
+ASGNI4
+ADDRGP4 g_arenaservers+936+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+936+56
+ADDRGP4 ServerList_Draw
+ASGNP4
+ADDRGP4 g_arenaservers+936+12
+CNSTI4 72
+ASGNI4
+ADDRGP4 g_arenaservers+936+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+936+80
+CNSTI4 68
+ASGNI4
+ADDRGP4 g_arenaservers+936+84
+CNSTI4 11
+ASGNI4
+ADDRGP4 g_arenaservers+936+76
+ADDRGP4 g_arenaservers+6280
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $906
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_arenaservers+6280
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_arenaservers+4232
+ADDP4
+ASGNP4
+LABELV $907
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $906
+ADDRGP4 g_arenaservers+1032
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1032+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 g_arenaservers+1032+12
+CNSTI4 72
+ASGNI4
+ADDRGP4 g_arenaservers+1032+16
+CNSTI4 80
+ASGNI4
+ADDRGP4 g_arenaservers+1032+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1032+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 g_arenaservers+1032+64
+ADDRGP4 $925
+ASGNP4
+ADDRGP4 g_arenaservers+1120
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1120+4
+ADDRGP4 $929
+ASGNP4
+ADDRGP4 g_arenaservers+1120+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 g_arenaservers+1120+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1120+12
+CNSTI4 560
+ASGNI4
+ADDRGP4 g_arenaservers+1120+16
+CNSTI4 192
+ASGNI4
+ADDRGP4 g_arenaservers+1120+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1120+80
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1208
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1208+44
+CNSTU4 2308
+ASGNU4
+ADDRGP4 g_arenaservers+1208+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1208+8
+CNSTI4 16
+ASGNI4
+ADDRGP4 g_arenaservers+1208+12
+CNSTI4 560
+ASGNI4
+ADDRGP4 g_arenaservers+1208+16
+CNSTI4 192
+ASGNI4
+ADDRGP4 g_arenaservers+1208+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1208+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1208+60
+ADDRGP4 $959
+ASGNP4
+ADDRGP4 g_arenaservers+1296
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1296+44
+CNSTU4 2308
+ASGNU4
+ADDRGP4 g_arenaservers+1296+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1296+8
+CNSTI4 17
+ASGNI4
+ADDRGP4 g_arenaservers+1296+12
+CNSTI4 560
+ASGNI4
+ADDRGP4 g_arenaservers+1296+16
+CNSTI4 256
+ASGNI4
+ADDRGP4 g_arenaservers+1296+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1296+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1296+60
+ADDRGP4 $977
+ASGNP4
+ADDRLP4 4
+CNSTI4 376
+ASGNI4
+ADDRGP4 g_arenaservers+1384
+CNSTI4 7
+ASGNI4
+ADDRGP4 g_arenaservers+1384+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+1384+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+1384+60
+ADDRGP4 $761
+ASGNP4
+ADDRGP4 g_arenaservers+1384+64
+CNSTI4 258
+ASGNI4
+ADDRGP4 g_arenaservers+1384+68
+ADDRGP4 menu_text_color
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+1456
+CNSTI4 7
+ASGNI4
+ADDRGP4 g_arenaservers+1456+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+1456+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+1456+60
+ADDRGP4 $123
+ASGNP4
+ADDRGP4 g_arenaservers+1456+64
+CNSTI4 258
+ASGNI4
+ADDRGP4 g_arenaservers+1456+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 g_arenaservers+1528
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1528+4
+ADDRGP4 $1003
+ASGNP4
+ADDRGP4 g_arenaservers+1528+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+1528+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1528+8
+CNSTI4 23
+ASGNI4
+ADDRGP4 g_arenaservers+1528+12
+CNSTI4 450
+ASGNI4
+ADDRGP4 g_arenaservers+1528+16
+CNSTI4 86
+ASGNI4
+ADDRGP4 g_arenaservers+1528+76
+CNSTI4 96
+ASGNI4
+ADDRGP4 g_arenaservers+1528+80
+CNSTI4 48
+ASGNI4
+ADDRGP4 g_arenaservers+1528+60
+ADDRGP4 $1020
+ASGNP4
+ADDRGP4 g_arenaservers+1616
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1616+4
+ADDRGP4 $1024
+ASGNP4
+ADDRGP4 g_arenaservers+1616+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+1616+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1616+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 g_arenaservers+1616+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+1616+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+1616+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1616+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1616+60
+ADDRGP4 $1041
+ASGNP4
+ADDRGP4 g_arenaservers+1792
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1792+4
+ADDRGP4 $1045
+ASGNP4
+ADDRGP4 g_arenaservers+1792+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+1792+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1792+8
+CNSTI4 20
+ASGNI4
+ADDRGP4 g_arenaservers+1792+12
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1792+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+1792+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1792+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1792+60
+ADDRGP4 $1062
+ASGNP4
+ADDRGP4 g_arenaservers+1704
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1704+4
+ADDRGP4 $1066
+ASGNP4
+ADDRGP4 g_arenaservers+1704+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+1704+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1704+8
+CNSTI4 19
+ASGNI4
+ADDRGP4 g_arenaservers+1704+12
+CNSTI4 256
+ASGNI4
+ADDRGP4 g_arenaservers+1704+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+1704+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1704+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1704+60
+ADDRGP4 $1083
+ASGNP4
+ADDRGP4 g_arenaservers+1880
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1880+4
+ADDRGP4 $1087
+ASGNP4
+ADDRGP4 g_arenaservers+1880+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+1880+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1880+8
+CNSTI4 21
+ASGNI4
+ADDRGP4 g_arenaservers+1880+12
+CNSTI4 384
+ASGNI4
+ADDRGP4 g_arenaservers+1880+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+1880+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1880+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1880+60
+ADDRGP4 $1104
+ASGNP4
+ADDRGP4 g_arenaservers+1968
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1968+4
+ADDRGP4 $1108
+ASGNP4
+ADDRGP4 g_arenaservers+1968+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 g_arenaservers+1968+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1968+8
+CNSTI4 22
+ASGNI4
+ADDRGP4 g_arenaservers+1968+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 g_arenaservers+1968+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+1968+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1968+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1968+60
+ADDRGP4 $1125
+ASGNP4
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+456
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+552
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+648
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+744
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+808
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+872
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1032
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1384
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1456
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1120
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1208
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+936
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1528
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1616
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1792
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1704
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1880
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1968
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 ArenaServers_LoadFavorites
+CALLV
+pop
+CNSTF4 0
+ARGF4
+CNSTF4 1088421888
+ARGF4
+ADDRGP4 ui_browserMaster+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_servertype
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+360+64
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI1 0
+ASGNI1
+ADDRGP4 g_gameIndex
+ADDRLP4 16
+INDIRI1
+ASGNI1
+ADDRGP4 g_arenaservers+456+64
+ADDRLP4 16
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1155
+JUMPV
+LABELV $1152
+ADDRGP4 ui_browserGame+16
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 mod_dir_items
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $1156
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRGP4 g_gameIndex
+ADDRLP4 24
+INDIRI1
+ASGNI1
+ADDRGP4 g_arenaservers+456+64
+ADDRLP4 24
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRGP4 $1154
+JUMPV
+LABELV $1156
+LABELV $1153
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1155
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 mod_dir_items
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1152
+LABELV $1154
+CNSTF4 0
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 ui_browserGameType+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_gametype
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+552+64
+ADDRGP4 g_gametype
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 ui_browserSortKey+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_sortkey
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+648+64
+ADDRGP4 g_sortkey
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 ui_browserShowFull+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_fullservers
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+744+60
+ADDRGP4 g_fullservers
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 ui_browserShowEmpty+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_emptyservers
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+808+60
+ADDRGP4 g_emptyservers
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 ui_browserShowBots+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_showbots
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+872+60
+ADDRGP4 g_showbots
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 g_servertype
+ASGNP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 ArenaServers_SetType
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+360+64
+ADDRLP4 44
+INDIRI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 $583
+ARGP4
+ADDRGP4 $123
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $760
+endproc ArenaServers_MenuInit 48 16
+export ArenaServers_Cache
+proc ArenaServers_Cache 0 4
+ADDRGP4 $1024
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1041
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1087
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1104
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1045
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1062
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1066
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1083
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1108
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1125
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $929
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $959
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $977
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $925
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1178
+endproc ArenaServers_Cache 0 4
+export UI_ArenaServersMenu
+proc UI_ArenaServersMenu 0 4
+ADDRGP4 ArenaServers_MenuInit
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1179
+endproc UI_ArenaServersMenu 0 4
+bss
+align 4
+LABELV g_showbots
+skip 4
+align 4
+LABELV g_fullservers
+skip 4
+align 4
+LABELV g_emptyservers
+skip 4
+align 4
+LABELV g_sortkey
+skip 4
+align 4
+LABELV g_gametype
+skip 4
+align 1
+LABELV g_gameIndex
+skip 1
+align 4
+LABELV g_servertype
+skip 4
+align 4
+LABELV g_numfavoriteservers
+skip 4
+align 4
+LABELV g_favoriteserverlist
+skip 2496
+align 4
+LABELV g_numlocalservers
+skip 4
+align 4
+LABELV g_localserverlist
+skip 19968
+align 4
+LABELV g_numglobalservers
+skip 24
+align 4
+LABELV g_globalserverlist
+skip 119808
+align 4
+LABELV g_arenaservers
+skip 7852
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPMap_f
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_MaxSplitView
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_CursorInRect
+import UI_DrawChar
+import UI_MField_Draw
+import UI_DrawStrlen
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_InitPropFont
+import UI_InitBannerFont
+import UI_LerpColor
+import UI_RegisterPlayerModelname
+import UI_PlayerInfo_UpdateColor
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import UI_Joystick_Cache
+import UI_JoystickMenu
+import Controls_WantsBindKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_SelectPlayer_Cache
+import UI_SelectPlayerMenu
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import InSelectPlayerMenu
+import InSelectPlayer_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_small_title_color
+import text_big_color
+import text_banner_color
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_menuFontBanner
+import ui_menuFontProp
+import ui_menuFont
+import ui_ioq3
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserSeparateMasters
+import ui_browserShowBots
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserGame
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_publicServer
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import UI_DrawProportionalString
+import UI_WindowResized
+import UI_WantsBindKeys
+import UI_DrawConnectScreen
+import UI_ConsoleCommand
+import UI_SetActiveMenu
+import UI_Refresh
+import UI_IsFullscreen
+import UI_SetCursorPos
+import UI_GetCursorPos
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import ui_numCommands
+import ui_commands
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_drawScores
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1125
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1108
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1104
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1087
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1083
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1066
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1062
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1045
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1041
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1024
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1020
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1003
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $977
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $959
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $929
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $925
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $875
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $861
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $847
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $831
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $815
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $799
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $783
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $775
+byte 1 65
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 32
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 83
+byte 1 0
+align 1
+LABELV $737
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $736
+byte 1 37
+byte 1 100
+byte 1 47
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $699
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $693
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $687
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $681
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $675
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $669
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $665
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $654
+byte 1 72
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 85
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 0
+align 1
+LABELV $618
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $608
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $588
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $587
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $586
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $583
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $582
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $579
+byte 1 32
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $576
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 61
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $548
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $515
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $482
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $435
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $429
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $420
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $416
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $415
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $414
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $413
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $412
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $411
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $410
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $409
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $353
+byte 1 94
+byte 1 49
+byte 1 0
+align 1
+LABELV $352
+byte 1 94
+byte 1 51
+byte 1 0
+align 1
+LABELV $349
+byte 1 94
+byte 1 50
+byte 1 0
+align 1
+LABELV $344
+byte 1 94
+byte 1 52
+byte 1 0
+align 1
+LABELV $292
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $289
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $263
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $231
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 83
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $226
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $210
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $207
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $194
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $147
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $142
+byte 1 85
+byte 1 68
+byte 1 80
+byte 1 54
+byte 1 0
+align 1
+LABELV $141
+byte 1 85
+byte 1 68
+byte 1 80
+byte 1 32
+byte 1 0
+align 1
+LABELV $140
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 32
+byte 1 0
+align 1
+LABELV $139
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $138
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $137
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 112
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $136
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $135
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $134
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $133
+byte 1 84
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $132
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $131
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $130
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $129
+byte 1 116
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $128
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 113
+byte 1 51
+byte 1 0
+align 1
+LABELV $127
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 111
+byte 1 97
+byte 1 0
+align 1
+LABELV $126
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 111
+byte 1 97
+byte 1 0
+align 1
+LABELV $125
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $124
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 51
+byte 1 0
+align 1
+LABELV $123
+byte 1 0
+align 1
+LABELV $122
+byte 1 79
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $121
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 32
+byte 1 40
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 41
+byte 1 0
+align 1
+LABELV $120
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 51
+byte 1 32
+byte 1 40
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 41
+byte 1 0
+align 1
+LABELV $119
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 32
+byte 1 77
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 80
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $118
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 0
+align 1
+LABELV $117
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 0
+align 1
+LABELV $116
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 51
+byte 1 0
+align 1
+LABELV $115
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $114
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $113
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 53
+byte 1 0
+align 1
+LABELV $112
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 52
+byte 1 0
+align 1
+LABELV $111
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 51
+byte 1 0
+align 1
+LABELV $110
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $109
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $108
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $107
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 0
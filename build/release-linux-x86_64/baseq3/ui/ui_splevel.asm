@@ -0,0 +1,5541 @@
+code
+proc PlayerIcon 80 20
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 68
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $109
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $110
+JUMPV
+LABELV $109
+ADDRLP4 0
+ADDRGP4 $111
+ASGNP4
+LABELV $110
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $112
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $113
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $111
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $113
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $115
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $113
+LABELV $108
+endproc PlayerIcon 80 20
+proc PlayerIconHandle 68 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 PlayerIcon
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+RETI4
+LABELV $116
+endproc PlayerIconHandle 68 12
+proc UI_SPLevelMenu_SetBots 1068 12
+ADDRGP4 levelMenuInfo+2512
+CNSTI4 0
+ASGNI4
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $119
+ADDRGP4 $117
+JUMPV
+LABELV $119
+ADDRGP4 levelMenuInfo+1948
+INDIRP4
+ARGP4
+ADDRGP4 $122
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 12
+ASGNP4
+ADDRGP4 $124
+JUMPV
+LABELV $127
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $128
+ADDRLP4 1040
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $130
+ADDRLP4 1040
+INDIRI4
+CNSTI4 32
+EQI4 $127
+LABELV $130
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $131
+ADDRGP4 $125
+JUMPV
+LABELV $131
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $134
+JUMPV
+LABELV $133
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $134
+ADDRLP4 1044
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $136
+ADDRLP4 1044
+INDIRI4
+CNSTI4 32
+NEI4 $133
+LABELV $136
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $137
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1048
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $137
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 UI_GetBotInfoByName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $139
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+ARGI4
+ADDRLP4 1052
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+LABELV $139
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $142
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $146
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 PlayerIconHandle
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2516
+ADDP4
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $149
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1064
+CNSTI4 10
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+2544
+ADDP4
+ARGP4
+ADDRLP4 1060
+INDIRP4
+ARGP4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $143
+JUMPV
+LABELV $142
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2516
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 1052
+CNSTI4 10
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+2544
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1052
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $143
+CNSTI4 10
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+2544
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 1052
+ADDRGP4 levelMenuInfo+2512
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ADDRLP4 1052
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $124
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $157
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+CNSTI4 7
+LTI4 $128
+LABELV $157
+LABELV $125
+LABELV $117
+endproc UI_SPLevelMenu_SetBots 1068 12
+proc UI_SPLevelMenu_SetMenuArena 80 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $159
+ARGP4
+ADDRLP4 64
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 levelMenuInfo+2212
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 levelMenuInfo+2212
+ADDP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ADDRGP4 levelMenuInfo+2276
+ADDP4
+ARGP4
+ADDRLP4 68
+INDIRI4
+ADDRGP4 levelMenuInfo+2292
+ADDP4
+ARGP4
+ADDRGP4 UI_GetBestScore
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2276
+ADDP4
+INDIRI4
+CNSTI4 8
+LEI4 $165
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2276
+ADDP4
+CNSTI4 8
+ASGNI4
+LABELV $165
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 levelMenuInfo+1956
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $171
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 levelMenuInfo+1956
+ADDP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $172
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 levelMenuInfo+1956
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $177
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 levelMenuInfo+1956
+ADDP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $178
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 levelMenuInfo+1956
+ADDP4
+ARGP4
+ADDRGP4 $182
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $178
+LABELV $172
+CNSTI4 88
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $185
+ADDRLP4 76
+CNSTI4 88
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448+44
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $186
+JUMPV
+LABELV $185
+ADDRLP4 76
+CNSTI4 88
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448+44
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+LABELV $186
+ADDRLP4 76
+CNSTI4 88
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448+44
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+LABELV $158
+endproc UI_SPLevelMenu_SetMenuArena 80 16
+proc UI_SPLevelMenu_SetMenuItems 36 12
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $194
+ADDRGP4 selectedArena
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $195
+JUMPV
+LABELV $194
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+NEI4 $196
+ADDRGP4 selectedArena
+CNSTI4 0
+ASGNI4
+LABELV $196
+LABELV $195
+ADDRLP4 12
+ADDRGP4 selectedArenaSet
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 trainingTier
+INDIRI4
+EQI4 $200
+ADDRLP4 12
+INDIRI4
+ADDRGP4 finalTier
+INDIRI4
+NEI4 $198
+LABELV $200
+ADDRGP4 selectedArena
+CNSTI4 0
+ASGNI4
+LABELV $198
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+EQI4 $201
+ADDRGP4 $203
+ARGP4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 selectedArena
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $201
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 trainingTier
+INDIRI4
+NEI4 $204
+ADDRGP4 $206
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $207
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_SPLevelMenu_SetMenuArena
+CALLV
+pop
+ADDRGP4 levelMenuInfo+1948
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 levelMenuInfo+448+12
+CNSTI4 256
+ASGNI4
+ADDRGP4 levelMenuInfo+448
+ARGP4
+ADDRGP4 Bitmap_Init
+CALLV
+pop
+ADDRLP4 28
+ADDRGP4 levelMenuInfo+448+32
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 levelMenuInfo+1952
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $215
+ADDRLP4 32
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448+44
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 levelMenuInfo+1956
+ADDP4
+CNSTI1 0
+ASGNI1
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448+68
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $216
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $215
+ADDRGP4 $205
+JUMPV
+LABELV $204
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 finalTier
+INDIRI4
+NEI4 $224
+ADDRGP4 $226
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $207
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_SPLevelMenu_SetMenuArena
+CALLV
+pop
+ADDRGP4 levelMenuInfo+1948
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 levelMenuInfo+448+12
+CNSTI4 256
+ASGNI4
+ADDRGP4 levelMenuInfo+448
+ARGP4
+ADDRGP4 Bitmap_Init
+CALLV
+pop
+ADDRLP4 28
+ADDRGP4 levelMenuInfo+448+32
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 levelMenuInfo+1952
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $234
+ADDRLP4 32
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448+44
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 levelMenuInfo+1956
+ADDP4
+CNSTI1 0
+ASGNI1
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448+68
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $235
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $234
+ADDRGP4 $225
+JUMPV
+LABELV $224
+ADDRGP4 levelMenuInfo+448+12
+CNSTI4 46
+ASGNI4
+ADDRGP4 levelMenuInfo+448
+ARGP4
+ADDRGP4 Bitmap_Init
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+448+32
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 levelMenuInfo+1952
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $249
+ADDRLP4 4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_SPLevelMenu_SetMenuArena
+CALLV
+pop
+LABELV $250
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $249
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+EQI4 $253
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 selectedArena
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRGP4 levelMenuInfo+1948
+ADDRLP4 20
+INDIRP4
+ASGNP4
+LABELV $253
+LABELV $225
+LABELV $205
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 minTier
+INDIRI4
+NEI4 $256
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+360+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 $257
+JUMPV
+LABELV $256
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+360+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $257
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 maxTier
+INDIRI4
+NEI4 $262
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+800+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 $263
+JUMPV
+LABELV $262
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+800+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $263
+ADDRGP4 UI_SPLevelMenu_SetBots
+CALLV
+pop
+LABELV $193
+endproc UI_SPLevelMenu_SetMenuItems 36 12
+proc UI_SPLevelMenu_ResetDraw 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 356
+ARGI4
+ADDRGP4 $269
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 383
+ARGI4
+ADDRGP4 $270
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 410
+ARGI4
+ADDRGP4 $271
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 437
+ARGI4
+ADDRGP4 $272
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+LABELV $268
+endproc UI_SPLevelMenu_ResetDraw 0 20
+proc UI_SPLevelMenu_ResetAction 4 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $274
+ADDRGP4 $273
+JUMPV
+LABELV $274
+ADDRGP4 UI_NewGame
+CALLV
+pop
+ADDRGP4 $206
+ARGP4
+ADDRLP4 0
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $276
+ADDRGP4 $203
+ARGP4
+CNSTF4 3229614080
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRGP4 $203
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $277
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_SPLevelMenu
+CALLV
+pop
+LABELV $273
+endproc UI_SPLevelMenu_ResetAction 4 8
+proc UI_SPLevelMenu_ResetEvent 0 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $279
+ADDRGP4 $278
+JUMPV
+LABELV $279
+ADDRGP4 $281
+ARGP4
+ADDRGP4 UI_SPLevelMenu_ResetDraw
+ARGP4
+ADDRGP4 UI_SPLevelMenu_ResetAction
+ARGP4
+ADDRGP4 UI_ConfirmMenu
+CALLV
+pop
+LABELV $278
+endproc UI_SPLevelMenu_ResetEvent 0 12
+proc UI_SPLevelMenu_LevelEvent 12 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $283
+ADDRGP4 $282
+JUMPV
+LABELV $283
+ADDRLP4 0
+ADDRGP4 selectedArenaSet
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 trainingTier
+INDIRI4
+EQI4 $287
+ADDRLP4 0
+INDIRI4
+ADDRGP4 finalTier
+INDIRI4
+NEI4 $285
+LABELV $287
+ADDRGP4 $282
+JUMPV
+LABELV $285
+ADDRLP4 4
+ADDRGP4 selectedArena
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 11
+SUBI4
+ASGNI4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRGP4 levelMenuInfo+1948
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 UI_SPLevelMenu_SetBots
+CALLV
+pop
+ADDRGP4 $203
+ARGP4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 selectedArena
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $282
+endproc UI_SPLevelMenu_LevelEvent 12 8
+proc UI_SPLevelMenu_LeftArrowEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $290
+ADDRGP4 $289
+JUMPV
+LABELV $290
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 minTier
+INDIRI4
+NEI4 $292
+ADDRGP4 $289
+JUMPV
+LABELV $292
+ADDRLP4 0
+ADDRGP4 selectedArenaSet
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 UI_SPLevelMenu_SetMenuItems
+CALLV
+pop
+LABELV $289
+endproc UI_SPLevelMenu_LeftArrowEvent 4 0
+proc UI_SPLevelMenu_RightArrowEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $295
+ADDRGP4 $294
+JUMPV
+LABELV $295
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 maxTier
+INDIRI4
+NEI4 $297
+ADDRGP4 $294
+JUMPV
+LABELV $297
+ADDRLP4 0
+ADDRGP4 selectedArenaSet
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 UI_SPLevelMenu_SetMenuItems
+CALLV
+pop
+LABELV $294
+endproc UI_SPLevelMenu_RightArrowEvent 4 0
+proc UI_SPLevelMenu_PlayerEvent 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $300
+ADDRGP4 $299
+JUMPV
+LABELV $300
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_PlayerSettingsMenu
+CALLV
+pop
+LABELV $299
+endproc UI_SPLevelMenu_PlayerEvent 0 4
+proc UI_SPLevelMenu_AwardEvent 4 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $303
+ADDRGP4 $302
+JUMPV
+LABELV $303
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 17
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2488
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $302
+endproc UI_SPLevelMenu_AwardEvent 4 8
+proc UI_SPLevelMenu_NextEvent 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $307
+ADDRGP4 $306
+JUMPV
+LABELV $307
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $309
+ADDRGP4 $306
+JUMPV
+LABELV $309
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+NEI4 $311
+ADDRGP4 selectedArena
+CNSTI4 0
+ASGNI4
+LABELV $311
+ADDRGP4 levelMenuInfo+1948
+INDIRP4
+ARGP4
+ADDRGP4 UI_SPSkillMenu
+CALLV
+pop
+LABELV $306
+endproc UI_SPLevelMenu_NextEvent 0 4
+proc UI_SPLevelMenu_BackEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $315
+ADDRGP4 $314
+JUMPV
+LABELV $315
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+NEI4 $317
+ADDRGP4 selectedArena
+CNSTI4 0
+ASGNI4
+LABELV $317
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $314
+endproc UI_SPLevelMenu_BackEvent 0 0
+proc UI_SPLevelMenu_CustomEvent 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $320
+ADDRGP4 $319
+JUMPV
+LABELV $320
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_StartServerMenu
+CALLV
+pop
+LABELV $319
+endproc UI_SPLevelMenu_CustomEvent 0 4
+proc UI_SPLevelMenu_MenuDraw 1160 20
+ADDRGP4 levelMenuInfo+1944
+INDIRI4
+CNSTI4 0
+EQI4 $323
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_SPLevelMenu
+CALLV
+pop
+ADDRGP4 $322
+JUMPV
+LABELV $323
+ADDRGP4 $149
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 314
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $146
+ARGP4
+ADDRLP4 104
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 104
+ARGP4
+ADDRGP4 levelMenuInfo+2336
+ARGP4
+ADDRLP4 1128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+CNSTI4 0
+EQI4 $326
+ADDRGP4 levelMenuInfo+2336
+ARGP4
+ADDRLP4 104
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 levelMenuInfo+2336
+ARGP4
+ADDRGP4 levelMenuInfo+2400
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 PlayerIcon
+CALLV
+pop
+ADDRGP4 levelMenuInfo+888+68
+CNSTI4 0
+ASGNI4
+LABELV $326
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 340
+ASGNI4
+ADDRLP4 1132
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+ADDRLP4 1132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1132
+INDIRI4
+ASGNI4
+LABELV $336
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2464
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $341
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $343
+ADDRLP4 4
+CNSTI4 224
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 2
+DIVI4
+CNSTI4 6
+LSHI4
+SUBI4
+ASGNI4
+ADDRGP4 $344
+JUMPV
+LABELV $343
+ADDRLP4 4
+ADDRLP4 80
+INDIRI4
+CNSTI4 2
+DIVI4
+CNSTI4 6
+LSHI4
+CNSTI4 368
+ADDI4
+ASGNI4
+LABELV $344
+ADDRLP4 1136
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+ADDRLP4 1136
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 1136
+INDIRI4
+NEI4 $345
+ADDRGP4 $337
+JUMPV
+LABELV $345
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000000
+LTI4 $347
+ADDRLP4 16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $349
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000000
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $348
+JUMPV
+LABELV $347
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000
+LTI4 $350
+ADDRLP4 16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $352
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRLP4 16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $353
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $351
+LABELV $348
+ADDRLP4 4
+INDIRI4
+CNSTI4 24
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 48
+ADDI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $341
+LABELV $337
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $336
+ADDRGP4 $354
+ARGP4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1136
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 18
+ARGI4
+CNSTI4 38
+ARGI4
+ADDRLP4 1136
+INDIRP4
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $358
+JUMPV
+LABELV $355
+ADDRLP4 1140
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1140
+INDIRI4
+ADDRGP4 levelMenuInfo+448+12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1140
+INDIRI4
+ADDRGP4 levelMenuInfo+448+16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 96
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1124073472
+ARGF4
+CNSTF4 1099956224
+ARGF4
+ADDRGP4 color_black
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $356
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $358
+ADDRLP4 0
+INDIRI4
+ADDRGP4 levelMenuInfo+1952
+INDIRI4
+LTI4 $355
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $364
+CNSTI4 320
+ARGI4
+CNSTI4 216
+ARGI4
+ADDRGP4 $366
+ARGP4
+CNSTI4 514
+ARGI4
+ADDRGP4 color_red
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $322
+JUMPV
+LABELV $364
+ADDRLP4 88
+ADDRGP4 color_white
+INDIRF4
+ASGNF4
+ADDRLP4 88+4
+ADDRGP4 color_white+4
+INDIRF4
+ASGNF4
+ADDRLP4 88+8
+ADDRGP4 color_white+8
+INDIRF4
+ASGNF4
+ADDRLP4 88+12
+ADDRGP4 color_white+12
+INDIRF4
+ASGNF4
+ADDRGP4 uis+4
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 1140
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 88+12
+CNSTF4 1056964608
+ADDRLP4 1140
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $378
+JUMPV
+LABELV $375
+ADDRLP4 1148
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1148
+INDIRI4
+ADDRGP4 levelMenuInfo+448+12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1148
+INDIRI4
+ADDRGP4 levelMenuInfo+448+16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 96
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 levelMenuInfo+2212
+ADDP4
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2276
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $385
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1124073472
+ARGF4
+CNSTF4 1119879168
+ARGF4
+ADDRLP4 1152
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1152
+INDIRI4
+LSHI4
+ADDRGP4 levelMenuInfo+2292
+ADDP4
+INDIRI4
+ADDRLP4 1152
+INDIRI4
+LSHI4
+ADDRGP4 levelMenuInfo+2316-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $385
+ADDRLP4 0
+INDIRI4
+ADDRGP4 selectedArena
+INDIRI4
+NEI4 $391
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRLP4 1152
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448
+ADDP4
+CVPU4 4
+ADDRLP4 1152
+INDIRP4
+CVPU4 4
+NEU4 $393
+ADDRLP4 88
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $393
+ADDRLP4 1156
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1124204544
+ARGF4
+CNSTF4 1122500608
+ARGF4
+ADDRGP4 levelMenuInfo+2308
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $392
+JUMPV
+LABELV $391
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRLP4 1152
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448
+ADDP4
+CVPU4 4
+ADDRLP4 1152
+INDIRP4
+CVPU4 4
+NEU4 $397
+ADDRLP4 88
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 30
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1132462080
+ARGF4
+CNSTF4 1130692608
+ARGF4
+ADDRGP4 levelMenuInfo+2312
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $397
+LABELV $392
+LABELV $376
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $378
+ADDRLP4 0
+INDIRI4
+ADDRGP4 levelMenuInfo+1952
+INDIRI4
+LTI4 $375
+ADDRLP4 8
+CNSTI4 192
+ASGNI4
+ADDRGP4 levelMenuInfo+1948
+INDIRP4
+ARGP4
+ADDRGP4 $159
+ARGP4
+ADDRLP4 1144
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 104
+ARGP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 104
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 levelMenuInfo+1948
+INDIRP4
+ARGP4
+ADDRGP4 $404
+ARGP4
+ADDRLP4 1148
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $402
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRLP4 1148
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 320
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 24
+ADDI4
+ASGNI4
+ADDRLP4 84
+CNSTI4 90
+CNSTI4 7
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+SUBI4
+MULI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $409
+JUMPV
+LABELV $406
+ADDRLP4 4
+ADDRLP4 84
+INDIRI4
+CNSTI4 18
+ADDI4
+CNSTI4 90
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2516
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $411
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1156
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 1156
+INDIRF4
+ARGF4
+ADDRLP4 1156
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2516
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $412
+JUMPV
+LABELV $411
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1156
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 1156
+INDIRF4
+ARGF4
+ADDRLP4 1156
+INDIRF4
+ARGF4
+ADDRGP4 color_black
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 22
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 18
+ADDI4
+ARGI4
+ADDRGP4 $415
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+LABELV $412
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ARGI4
+CNSTI4 10
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+2544
+ADDP4
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $407
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $409
+ADDRLP4 0
+INDIRI4
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+LTI4 $406
+LABELV $322
+endproc UI_SPLevelMenu_MenuDraw 1160 20
+export UI_SPLevelMenu_Cache
+proc UI_SPLevelMenu_Cache 32 8
+ADDRGP4 $418
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $419
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $420
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $421
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $182
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $422
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $423
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $424
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $425
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $426
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $427
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $428
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $429
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $430
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $431
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $432
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $433
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $434
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $435
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_medalPicNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 ui_medalSounds
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 levelMenuInfo+2488
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $436
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $435
+ADDRGP4 $419
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $418
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2312
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $422
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2316
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $423
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2316+4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $424
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2316+8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $425
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2316+12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $426
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2316+16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $417
+endproc UI_SPLevelMenu_Cache 32 8
+proc UI_SPLevelMenu_Init 112 12
+ADDRGP4 $452
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 84
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+LTI4 $455
+ADDRLP4 80
+INDIRI4
+CNSTI4 5
+LEI4 $453
+LABELV $455
+ADDRGP4 $452
+ARGP4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $453
+ADDRGP4 levelMenuInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2616
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 levelMenuInfo+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 levelMenuInfo+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 levelMenuInfo+268
+ADDRGP4 UI_SPLevelMenu_MenuDraw
+ASGNP4
+ADDRGP4 UI_SPLevelMenu_Cache
+CALLV
+pop
+ADDRGP4 levelMenuInfo+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 levelMenuInfo+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 levelMenuInfo+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 levelMenuInfo+288+60
+ADDRGP4 $466
+ASGNP4
+ADDRGP4 levelMenuInfo+288+68
+ADDRGP4 text_banner_color
+ASGNP4
+ADDRGP4 levelMenuInfo+288+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 levelMenuInfo+360
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+360+4
+ADDRGP4 $420
+ASGNP4
+ADDRGP4 levelMenuInfo+360+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+360+12
+CNSTI4 18
+ASGNI4
+ADDRGP4 levelMenuInfo+360+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+360+48
+ADDRGP4 UI_SPLevelMenu_LeftArrowEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+360+8
+CNSTI4 10
+ASGNI4
+ADDRGP4 levelMenuInfo+360+76
+CNSTI4 16
+ASGNI4
+ADDRGP4 levelMenuInfo+360+80
+CNSTI4 114
+ASGNI4
+ADDRGP4 levelMenuInfo+360+60
+ADDRGP4 $421
+ASGNP4
+ADDRGP4 levelMenuInfo+448
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+448+4
+ADDRGP4 levelMenuInfo+1956
+ASGNP4
+ADDRGP4 levelMenuInfo+448+44
+CNSTU4 4
+ASGNU4
+ADDRGP4 levelMenuInfo+448+12
+CNSTI4 46
+ASGNI4
+ADDRGP4 levelMenuInfo+448+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+448+8
+CNSTI4 11
+ASGNI4
+ADDRGP4 levelMenuInfo+448+48
+ADDRGP4 UI_SPLevelMenu_LevelEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+448+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+448+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 levelMenuInfo+448+88
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+448+88+4
+ADDRGP4 levelMenuInfo+1956+64
+ASGNP4
+ADDRGP4 levelMenuInfo+448+88+44
+CNSTU4 4
+ASGNU4
+ADDRGP4 levelMenuInfo+448+88+12
+CNSTI4 186
+ASGNI4
+ADDRGP4 levelMenuInfo+448+88+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+448+88+8
+CNSTI4 12
+ASGNI4
+ADDRGP4 levelMenuInfo+448+88+48
+ADDRGP4 UI_SPLevelMenu_LevelEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+448+88+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+448+88+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176+4
+ADDRGP4 levelMenuInfo+1956+128
+ASGNP4
+ADDRGP4 levelMenuInfo+448+176+44
+CNSTU4 4
+ASGNU4
+ADDRGP4 levelMenuInfo+448+176+12
+CNSTI4 326
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176+8
+CNSTI4 13
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176+48
+ADDRGP4 UI_SPLevelMenu_LevelEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+448+176+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264+4
+ADDRGP4 levelMenuInfo+1956+192
+ASGNP4
+ADDRGP4 levelMenuInfo+448+264+44
+CNSTU4 4
+ASGNU4
+ADDRGP4 levelMenuInfo+448+264+12
+CNSTI4 466
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264+8
+CNSTI4 14
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264+48
+ADDRGP4 UI_SPLevelMenu_LevelEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+448+264+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 levelMenuInfo+800
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+800+4
+ADDRGP4 $420
+ASGNP4
+ADDRGP4 levelMenuInfo+800+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+800+12
+CNSTI4 606
+ASGNI4
+ADDRGP4 levelMenuInfo+800+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+800+48
+ADDRGP4 UI_SPLevelMenu_RightArrowEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+800+8
+CNSTI4 15
+ASGNI4
+ADDRGP4 levelMenuInfo+800+76
+CNSTI4 -16
+ASGNI4
+ADDRGP4 levelMenuInfo+800+80
+CNSTI4 114
+ASGNI4
+ADDRGP4 levelMenuInfo+800+60
+ADDRGP4 $421
+ASGNP4
+ADDRGP4 $146
+ARGP4
+ADDRGP4 levelMenuInfo+2336
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 levelMenuInfo+2336
+ARGP4
+ADDRGP4 levelMenuInfo+2400
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 PlayerIcon
+CALLV
+pop
+ADDRGP4 levelMenuInfo+888
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+888+4
+ADDRGP4 levelMenuInfo+2400
+ASGNP4
+ADDRGP4 levelMenuInfo+888+44
+CNSTU4 2052
+ASGNU4
+ADDRGP4 levelMenuInfo+888+12
+CNSTI4 288
+ASGNI4
+ADDRGP4 levelMenuInfo+888+16
+CNSTI4 340
+ASGNI4
+ADDRGP4 levelMenuInfo+888+8
+CNSTI4 16
+ASGNI4
+ADDRGP4 levelMenuInfo+888+48
+ADDRGP4 UI_SPLevelMenu_PlayerEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+888+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+888+80
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $634
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 UI_GetAwardLevel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2464
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $635
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $634
+ADDRLP4 92
+CNSTI4 100
+ASGNI4
+ADDRGP4 levelMenuInfo+2464+16
+ADDRLP4 92
+INDIRI4
+ADDRGP4 levelMenuInfo+2464+16
+INDIRI4
+ADDRLP4 92
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 340
+ASGNI4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $643
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2464
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $647
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $650
+ADDRLP4 8
+CNSTI4 224
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 2
+DIVI4
+CNSTI4 6
+LSHI4
+SUBI4
+ASGNI4
+ADDRGP4 $651
+JUMPV
+LABELV $650
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+CNSTI4 6
+LSHI4
+CNSTI4 368
+ADDI4
+ASGNI4
+LABELV $651
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_medalPicNames
+ADDP4
+INDIRP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+44
+ADDP4
+CNSTU4 1050628
+ASGNU4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+12
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+16
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+48
+ADDP4
+ADDRGP4 UI_SPLevelMenu_AwardEvent
+ASGNP4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+76
+ADDP4
+CNSTI4 48
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+80
+ADDP4
+CNSTI4 48
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $647
+LABELV $644
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $643
+ADDRGP4 levelMenuInfo+1504
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1504+4
+ADDRGP4 $427
+ASGNP4
+ADDRGP4 levelMenuInfo+1504+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+1504+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+1504+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 levelMenuInfo+1504+48
+ADDRGP4 UI_SPLevelMenu_BackEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+1504+8
+CNSTI4 23
+ASGNI4
+ADDRGP4 levelMenuInfo+1504+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+1504+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+1504+60
+ADDRGP4 $428
+ASGNP4
+ADDRGP4 levelMenuInfo+1592
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1592+4
+ADDRGP4 $431
+ASGNP4
+ADDRGP4 levelMenuInfo+1592+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+1592+12
+CNSTI4 170
+ASGNI4
+ADDRGP4 levelMenuInfo+1592+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 levelMenuInfo+1592+48
+ADDRGP4 UI_SPLevelMenu_ResetEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+1592+8
+CNSTI4 24
+ASGNI4
+ADDRGP4 levelMenuInfo+1592+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+1592+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+1592+60
+ADDRGP4 $432
+ASGNP4
+ADDRGP4 levelMenuInfo+1680
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1680+4
+ADDRGP4 $433
+ASGNP4
+ADDRGP4 levelMenuInfo+1680+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+1680+12
+CNSTI4 342
+ASGNI4
+ADDRGP4 levelMenuInfo+1680+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 levelMenuInfo+1680+48
+ADDRGP4 UI_SPLevelMenu_CustomEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+1680+8
+CNSTI4 25
+ASGNI4
+ADDRGP4 levelMenuInfo+1680+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+1680+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+1680+60
+ADDRGP4 $434
+ASGNP4
+ADDRGP4 levelMenuInfo+1768
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1768+4
+ADDRGP4 $429
+ASGNP4
+ADDRGP4 levelMenuInfo+1768+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 levelMenuInfo+1768+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 levelMenuInfo+1768+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 levelMenuInfo+1768+48
+ADDRGP4 UI_SPLevelMenu_NextEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+1768+8
+CNSTI4 26
+ASGNI4
+ADDRGP4 levelMenuInfo+1768+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+1768+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+1768+60
+ADDRGP4 $430
+ASGNP4
+ADDRGP4 levelMenuInfo+1856
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1856+44
+CNSTU4 1050628
+ASGNU4
+ADDRGP4 levelMenuInfo+1856+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+1856+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+1856+76
+CNSTI4 640
+ASGNI4
+ADDRGP4 levelMenuInfo+1856+80
+CNSTI4 480
+ASGNI4
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $758
+ADDRGP4 levelMenuInfo
+ARGP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 100
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448+32
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+LABELV $759
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $758
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+800
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+888
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $770
+JUMPV
+LABELV $767
+ADDRGP4 levelMenuInfo
+ARGP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $768
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $770
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $767
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1504
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1592
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1680
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1768
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1856
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 $203
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $777
+ADDRLP4 16
+ARGP4
+ADDRLP4 100
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 4
+ASGNI4
+ADDRGP4 selectedArenaSet
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 selectedArena
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $778
+JUMPV
+LABELV $777
+ADDRGP4 selectedArenaSet
+ADDRGP4 currentSet
+INDIRI4
+ASGNI4
+ADDRGP4 selectedArena
+ADDRGP4 currentGame
+INDIRI4
+ASGNI4
+LABELV $778
+ADDRGP4 UI_SPLevelMenu_SetMenuItems
+CALLV
+pop
+LABELV $451
+endproc UI_SPLevelMenu_Init 112 12
+export UI_SPLevelMenu
+proc UI_SPLevelMenu 36 8
+ADDRGP4 trainingTier
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $206
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $780
+ADDRGP4 minTier
+ADDRGP4 trainingTier
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $207
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $781
+JUMPV
+LABELV $780
+ADDRGP4 minTier
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 -2
+ASGNI4
+LABELV $781
+ADDRLP4 16
+ADDRGP4 UI_GetNumSPTiers
+CALLI4
+ASGNI4
+ADDRGP4 finalTier
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $226
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $782
+ADDRGP4 maxTier
+ADDRGP4 finalTier
+INDIRI4
+ASGNI4
+ADDRGP4 $783
+JUMPV
+LABELV $782
+ADDRLP4 24
+ADDRGP4 maxTier
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRGP4 finalTier
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ADDRGP4 minTier
+INDIRI4
+GEI4 $784
+ADDRGP4 maxTier
+ADDRGP4 minTier
+INDIRI4
+ASGNI4
+LABELV $784
+LABELV $783
+ADDRLP4 24
+ADDRGP4 UI_GetCurrentGame
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $786
+ADDRLP4 28
+ADDRGP4 UI_GetNumSPArenas
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 maxTier
+INDIRI4
+ADDRGP4 finalTier
+INDIRI4
+NEI4 $788
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $788
+LABELV $786
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $790
+ADDRGP4 currentSet
+CNSTI4 -1
+ASGNI4
+ADDRGP4 currentGame
+CNSTI4 0
+ASGNI4
+ADDRGP4 $791
+JUMPV
+LABELV $790
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRGP4 currentSet
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 currentGame
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+MODI4
+ASGNI4
+LABELV $791
+ADDRGP4 UI_SPLevelMenu_Init
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1768
+ARGP4
+ADDRGP4 Menu_SetCursorToItem
+CALLV
+pop
+LABELV $779
+endproc UI_SPLevelMenu 36 8
+export UI_SPLevelMenu_f
+proc UI_SPLevelMenu_f 0 0
+ADDRGP4 uis+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 UI_SPLevelMenu
+CALLV
+pop
+LABELV $793
+endproc UI_SPLevelMenu_f 0 0
+export UI_SPLevelMenu_ReInit
+proc UI_SPLevelMenu_ReInit 0 0
+ADDRGP4 levelMenuInfo+1944
+CNSTI4 1
+ASGNI4
+LABELV $795
+endproc UI_SPLevelMenu_ReInit 0 0
+bss
+align 4
+LABELV maxTier
+skip 4
+align 4
+LABELV minTier
+skip 4
+align 4
+LABELV finalTier
+skip 4
+align 4
+LABELV trainingTier
+skip 4
+align 4
+LABELV currentGame
+skip 4
+align 4
+LABELV currentSet
+skip 4
+align 4
+LABELV selectedArena
+skip 4
+align 4
+LABELV selectedArenaSet
+skip 4
+align 4
+LABELV levelMenuInfo
+skip 2616
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPMap_f
+import UI_SPArena_Start
+import uis
+import m_entersound
+import UI_MaxSplitView
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_CursorInRect
+import UI_DrawChar
+import UI_MField_Draw
+import UI_DrawStrlen
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_InitPropFont
+import UI_InitBannerFont
+import UI_LerpColor
+import UI_RegisterPlayerModelname
+import UI_PlayerInfo_UpdateColor
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import UI_Joystick_Cache
+import UI_JoystickMenu
+import Controls_WantsBindKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_SelectPlayer_Cache
+import UI_SelectPlayerMenu
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import InSelectPlayerMenu
+import InSelectPlayer_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_small_title_color
+import text_big_color
+import text_banner_color
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_menuFontBanner
+import ui_menuFontProp
+import ui_menuFont
+import ui_ioq3
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserSeparateMasters
+import ui_browserShowBots
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserGame
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_publicServer
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import UI_DrawProportionalString
+import UI_WindowResized
+import UI_WantsBindKeys
+import UI_DrawConnectScreen
+import UI_ConsoleCommand
+import UI_SetActiveMenu
+import UI_Refresh
+import UI_IsFullscreen
+import UI_SetCursorPos
+import UI_GetCursorPos
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import ui_numCommands
+import ui_commands
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_drawScores
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $466
+byte 1 67
+byte 1 72
+byte 1 79
+byte 1 79
+byte 1 83
+byte 1 69
+byte 1 32
+byte 1 76
+byte 1 69
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 0
+align 1
+LABELV $452
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $434
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $433
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $432
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $431
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $430
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $429
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $428
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $427
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $426
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 53
+byte 1 0
+align 1
+LABELV $425
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 52
+byte 1 0
+align 1
+LABELV $424
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $423
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $422
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 49
+byte 1 0
+align 1
+LABELV $421
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $420
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $419
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $418
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $415
+byte 1 63
+byte 1 0
+align 1
+LABELV $404
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $402
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $366
+byte 1 65
+byte 1 67
+byte 1 67
+byte 1 69
+byte 1 83
+byte 1 83
+byte 1 32
+byte 1 68
+byte 1 69
+byte 1 78
+byte 1 73
+byte 1 69
+byte 1 68
+byte 1 0
+align 1
+LABELV $354
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $353
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $352
+byte 1 37
+byte 1 105
+byte 1 107
+byte 1 0
+align 1
+LABELV $349
+byte 1 37
+byte 1 105
+byte 1 109
+byte 1 0
+align 1
+LABELV $281
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 69
+byte 1 84
+byte 1 32
+byte 1 71
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 63
+byte 1 0
+align 1
+LABELV $272
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $271
+byte 1 68
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 0
+align 1
+LABELV $270
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $269
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $226
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $207
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $206
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $203
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $182
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $177
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $171
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $159
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $149
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $146
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $122
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $115
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $112
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $111
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
@@ -0,0 +1,10966 @@
+data
+align 4
+LABELV gametype_items
+address $108
+address $109
+address $110
+address $111
+byte 4 0
+align 4
+LABELV gametype_remap
+byte 4 0
+byte 4 3
+byte 4 1
+byte 4 4
+align 4
+LABELV gametype_remap2
+byte 4 0
+byte 4 2
+byte 4 0
+byte 4 1
+byte 4 3
+code
+proc GametypeBits 36 8
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $114
+JUMPV
+LABELV $113
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $116
+ADDRGP4 $115
+JUMPV
+LABELV $116
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $120
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $118
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $114
+JUMPV
+LABELV $118
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $123
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $121
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 $114
+JUMPV
+LABELV $121
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $126
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $124
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $114
+JUMPV
+LABELV $124
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $129
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $127
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRGP4 $114
+JUMPV
+LABELV $127
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $132
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $130
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $130
+LABELV $114
+ADDRGP4 $113
+JUMPV
+LABELV $115
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $112
+endproc GametypeBits 36 8
+bss
+align 1
+LABELV $134
+skip 512
+code
+proc StartServer_Update 56 16
+ADDRLP4 20
+ADDRGP4 s_startserver+2652
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $136
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ADDRGP4 s_startserver+2648
+INDIRI4
+LTI4 $140
+ADDRGP4 $162
+JUMPV
+LABELV $140
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+2660
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 $134
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $145
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 $134
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $146
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 $134
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $148
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $146
+ADDRLP4 40
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+44
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 $134
+ADDP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1336+44
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 52
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1336+44
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+LABELV $137
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $136
+ADDRGP4 $162
+JUMPV
+LABELV $159
+ADDRLP4 28
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+44
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+4
+ADDP4
+CNSTP4 0
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1336+44
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRLP4 36
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1336+44
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $160
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $162
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $159
+ADDRGP4 s_startserver+2648
+INDIRI4
+CNSTI4 0
+NEI4 $173
+ADDRLP4 28
+ADDRGP4 s_startserver+2392+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 s_startserver+2480+60
+INDIRP4
+ARGP4
+ADDRGP4 $180
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $174
+JUMPV
+LABELV $173
+ADDRLP4 28
+ADDRGP4 s_startserver+2392+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRLP4 0
+ADDRGP4 s_startserver+2644
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $184
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+GEI4 $184
+ADDRLP4 36
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+44
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 40
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1336+44
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+LABELV $184
+ADDRGP4 s_startserver+2644
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+2660
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 s_startserver+2480+60
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $174
+ADDRGP4 s_startserver+2480+60
+INDIRP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+LABELV $133
+endproc StartServer_Update 56 16
+proc StartServer_MapEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $197
+ADDRGP4 $196
+JUMPV
+LABELV $197
+ADDRGP4 s_startserver+2644
+ADDRGP4 s_startserver+2652
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 11
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+LABELV $196
+endproc StartServer_MapEvent 0 0
+proc StartServer_GametypeEvent 48 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $202
+ADDRGP4 $201
+JUMPV
+LABELV $202
+ADDRLP4 20
+ADDRGP4 UI_GetNumArenas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+2648
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRLP4 28
+ADDRGP4 gametype_remap
+ASGNP4
+ADDRLP4 12
+CNSTI4 1
+ADDRGP4 s_startserver+536+64
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI4
+LSHI4
+ASGNI4
+ADDRGP4 s_startserver+536+64
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $207
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $207
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $214
+JUMPV
+LABELV $211
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $215
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 GametypeBits
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $216
+ADDRGP4 $212
+JUMPV
+LABELV $216
+ADDRGP4 s_startserver+2648
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+2660
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRGP4 s_startserver+2648
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $212
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $214
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $211
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRGP4 s_startserver+2656
+ADDRGP4 s_startserver+2648
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 32
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 s_startserver+2652
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+2644
+CNSTI4 0
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+LABELV $201
+endproc StartServer_GametypeEvent 48 8
+proc StartServer_MenuEvent 12 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $226
+ADDRGP4 $225
+JUMPV
+LABELV $226
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $228
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+GTI4 $228
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $248-60
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $248
+address $231
+address $236
+address $247
+address $242
+code
+LABELV $231
+ADDRGP4 s_startserver+2652
+INDIRI4
+CNSTI4 0
+LEI4 $229
+ADDRLP4 8
+ADDRGP4 s_startserver+2652
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+ADDRGP4 $229
+JUMPV
+LABELV $236
+ADDRGP4 s_startserver+2652
+INDIRI4
+ADDRGP4 s_startserver+2656
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $229
+ADDRLP4 8
+ADDRGP4 s_startserver+2652
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+ADDRGP4 $229
+JUMPV
+LABELV $242
+ADDRGP4 $243
+ARGP4
+ADDRGP4 s_startserver+536+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametype_remap
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_startserver+2640
+INDIRI4
+ARGI4
+ADDRGP4 UI_ServerOptionsMenu
+CALLV
+pop
+ADDRGP4 $229
+JUMPV
+LABELV $247
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $228
+LABELV $229
+LABELV $225
+endproc StartServer_MenuEvent 12 8
+proc StartServer_LevelshotDraw 80 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $251
+ADDRGP4 $250
+JUMPV
+LABELV $251
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $253
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $253
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $255
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $255
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $255
+LABELV $253
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $257
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $257
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+LABELV $257
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $259
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $259
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1105199104
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 64
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+DIVI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 s_startserver+2652
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 11
+SUBI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 64
+INDIRI4
+LSHI4
+ADDRGP4 s_startserver+2660
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 72
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 28
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 64
+BANDU4
+CNSTU4 0
+EQU4 $263
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $263
+LABELV $250
+endproc StartServer_LevelshotDraw 80 20
+bss
+align 1
+LABELV $266
+skip 64
+code
+proc StartServer_MenuInit 32 12
+ADDRGP4 s_startserver
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 6756
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 StartServer_Cache
+CALLV
+pop
+ADDRGP4 s_startserver+2640
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_startserver+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_startserver+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_startserver+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_startserver+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_startserver+288+60
+ADDRGP4 $277
+ASGNP4
+ADDRGP4 s_startserver+288+68
+ADDRGP4 text_banner_color
+ASGNP4
+ADDRGP4 s_startserver+288+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_startserver+360
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+360+4
+ADDRGP4 $285
+ASGNP4
+ADDRGP4 s_startserver+360+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_startserver+360+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+360+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_startserver+360+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_startserver+360+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_startserver+448
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+448+4
+ADDRGP4 $299
+ASGNP4
+ADDRGP4 s_startserver+448+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_startserver+448+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_startserver+448+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_startserver+448+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_startserver+448+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_startserver+536
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_startserver+536+4
+ADDRGP4 $313
+ASGNP4
+ADDRGP4 s_startserver+536+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_startserver+536+48
+ADDRGP4 StartServer_GametypeEvent
+ASGNP4
+ADDRGP4 s_startserver+536+8
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_startserver+536+12
+CNSTI4 296
+ASGNI4
+ADDRGP4 s_startserver+536+16
+CNSTI4 368
+ASGNI4
+ADDRGP4 s_startserver+536+76
+ADDRGP4 gametype_items
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $326
+ADDRLP4 12
+CNSTI4 136
+ASGNI4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+MODI4
+MULI4
+CNSTI4 44
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+CNSTI4 2
+MODI4
+MULI4
+CNSTI4 96
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+44
+ADDP4
+CNSTU4 16388
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+76
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+80
+ADDP4
+CNSTI4 96
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+60
+ADDP4
+ADDRGP4 $345
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+64
+ADDP4
+ADDRGP4 $348
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+56
+ADDP4
+ADDRGP4 StartServer_LevelshotDraw
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1336
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1336+44
+ADDP4
+CNSTU4 33028
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1336+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1336+48
+ADDP4
+ADDRGP4 StartServer_MapEvent
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1336+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 30
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1336+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1336+76
+ADDP4
+CNSTI4 256
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1336+80
+ADDP4
+CNSTI4 248
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1336+20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1336+24
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1336+28
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1336+32
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 128
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1336+60
+ADDP4
+ADDRGP4 $376
+ASGNP4
+LABELV $327
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $326
+ADDRGP4 s_startserver+2040
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+2040+4
+ADDRGP4 $380
+ASGNP4
+ADDRGP4 s_startserver+2040+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_startserver+2040+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 s_startserver+2040+16
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_startserver+2040+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_startserver+2040+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_startserver+2128
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+2128+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_startserver+2128+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+2128+8
+CNSTI4 15
+ASGNI4
+ADDRGP4 s_startserver+2128+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 s_startserver+2128+16
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_startserver+2128+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+2128+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_startserver+2128+60
+ADDRGP4 $408
+ASGNP4
+ADDRGP4 s_startserver+2216
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+2216+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_startserver+2216+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+2216+8
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_startserver+2216+12
+CNSTI4 321
+ASGNI4
+ADDRGP4 s_startserver+2216+16
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_startserver+2216+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+2216+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_startserver+2216+60
+ADDRGP4 $426
+ASGNP4
+ADDRGP4 s_startserver+2480
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_startserver+2480+44
+CNSTU4 16392
+ASGNU4
+ADDRGP4 s_startserver+2480+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_startserver+2480+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 s_startserver+2480+60
+ADDRGP4 $266
+ASGNP4
+ADDRGP4 s_startserver+2480+64
+CNSTI4 514
+ASGNI4
+ADDRGP4 s_startserver+2480+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 s_startserver+2304
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+2304+4
+ADDRGP4 $443
+ASGNP4
+ADDRGP4 s_startserver+2304+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_startserver+2304+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+2304+8
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_startserver+2304+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+2304+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_startserver+2304+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_startserver+2304+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+2304+60
+ADDRGP4 $460
+ASGNP4
+ADDRGP4 s_startserver+2392
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+2392+4
+ADDRGP4 $464
+ASGNP4
+ADDRGP4 s_startserver+2392+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_startserver+2392+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+2392+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_startserver+2392+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_startserver+2392+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_startserver+2392+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_startserver+2392+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+2392+60
+ADDRGP4 $481
+ASGNP4
+ADDRGP4 s_startserver+2552
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+2552+44
+CNSTU4 1050628
+ASGNU4
+ADDRGP4 s_startserver+2552+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+2552+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+2552+76
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_startserver+2552+80
+CNSTI4 480
+ASGNI4
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $497
+ADDRGP4 s_startserver
+ARGP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+1336
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $498
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $497
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2040
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2128
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2216
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2304
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2392
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2480
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+2552
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 StartServer_GametypeEvent
+CALLV
+pop
+LABELV $265
+endproc StartServer_MenuInit 32 12
+export StartServer_Cache
+proc StartServer_Cache 108 16
+ADDRGP4 $443
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $460
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $464
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $481
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $285
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $299
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $376
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $345
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $348
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $380
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $408
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $426
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $511
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 88
+ADDRLP4 92
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $512
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $517
+JUMPV
+LABELV $514
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $145
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 104
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+NEI4 $518
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $148
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $518
+LABELV $515
+ADDRLP4 64
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $517
+ADDRLP4 96
+ADDRGP4 UI_GetNumArenas
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LTI4 $514
+LABELV $512
+LABELV $510
+endproc StartServer_Cache 108 16
+export UI_StartServerMenu
+proc UI_StartServerMenu 0 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 StartServer_MenuInit
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $520
+endproc UI_StartServerMenu 0 4
+data
+align 4
+LABELV playerType_list
+address $522
+address $523
+address $524
+byte 4 0
+align 4
+LABELV humanPlayerType_list
+address $522
+address $523
+address $524
+address $525
+byte 4 0
+align 4
+LABELV playerTeam_list
+address $526
+address $527
+byte 4 0
+align 4
+LABELV botSkill_list
+address $528
+address $529
+address $530
+address $531
+address $532
+byte 4 0
+code
+proc BotAlreadySelected 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $534
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+64
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $538
+ADDRGP4 $535
+JUMPV
+LABELV $538
+ADDRGP4 s_serveroptions+8876
+INDIRI4
+CNSTI4 3
+LTI4 $542
+ADDRLP4 4
+CNSTI4 96
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7456+64
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_serveroptions+9172
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7456+64
+ADDP4
+INDIRI4
+EQI4 $542
+ADDRGP4 $535
+JUMPV
+LABELV $542
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+8976
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $550
+CNSTI4 1
+RETI4
+ADDRGP4 $533
+JUMPV
+LABELV $550
+LABELV $535
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $534
+CNSTI4 0
+RETI4
+LABELV $533
+endproc BotAlreadySelected 12 8
+proc ServerOptions_Start 208 24
+ADDRGP4 s_serveroptions+664+60
+ARGP4
+ADDRLP4 116
+ADDRGP4 MField_Buffer
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+1768+60
+ARGP4
+ADDRLP4 124
+ADDRGP4 MField_Buffer
+CALLP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 84
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+2872+60
+ARGP4
+ADDRLP4 132
+ADDRGP4 MField_Buffer
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 104
+ADDRGP4 s_serveroptions+536+60
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRGP4 s_serveroptions+600+60
+INDIRI4
+ASGNI4
+ADDRLP4 100
+ADDRGP4 s_serveroptions+3976+60
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRGP4 s_serveroptions+5144+60
+INDIRI4
+ASGNI4
+ADDRLP4 108
+ADDRGP4 s_serveroptions+5208+60
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRGP4 s_serveroptions+5272+64
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRGP4 $575
+JUMPV
+LABELV $572
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+64
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $576
+ADDRGP4 $573
+JUMPV
+LABELV $576
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+64
+ADDP4
+INDIRI4
+ADDRLP4 148
+INDIRI4
+NEI4 $580
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+8976
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 148
+INDIRI4
+NEI4 $580
+ADDRGP4 $573
+JUMPV
+LABELV $580
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $573
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $575
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $572
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRGP4 $588
+JUMPV
+LABELV $585
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+64
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $589
+ADDRGP4 $586
+JUMPV
+LABELV $589
+ADDRLP4 72
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+LABELV $586
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $588
+ADDRLP4 144
+ADDRGP4 UI_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LTI4 $585
+ADDRGP4 $593
+ARGP4
+ADDRLP4 72
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRLP4 148
+ADDRGP4 s_serveroptions+8876
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+LTI4 $594
+ADDRLP4 148
+INDIRI4
+CNSTI4 4
+GTI4 $594
+ADDRLP4 148
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $615
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $615
+address $597
+address $601
+address $594
+address $605
+address $610
+code
+LABELV $597
+LABELV $594
+ADDRGP4 $598
+ARGP4
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $599
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $600
+ARGP4
+ADDRLP4 96
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $595
+JUMPV
+LABELV $601
+ADDRGP4 $602
+ARGP4
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $603
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $604
+ARGP4
+ADDRLP4 96
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $595
+JUMPV
+LABELV $605
+ADDRGP4 $606
+ARGP4
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $607
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $608
+ARGP4
+ADDRLP4 100
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $609
+ARGP4
+ADDRLP4 96
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $595
+JUMPV
+LABELV $610
+ADDRGP4 $611
+ARGP4
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $612
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $613
+ARGP4
+ADDRLP4 100
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $614
+ARGP4
+ADDRLP4 96
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $595
+CNSTF4 0
+ARGF4
+CNSTF4 1094713344
+ARGF4
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 152
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $616
+ARGP4
+ADDRLP4 152
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_serveroptions+8872
+INDIRI4
+CNSTI4 0
+EQI4 $617
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 104
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 156
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $620
+ARGP4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 104
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 160
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $621
+ARGP4
+ADDRLP4 160
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $618
+JUMPV
+LABELV $617
+ADDRGP4 $621
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $618
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 156
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $622
+ARGP4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 160
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 160
+INDIRF4
+ARGF4
+ADDRLP4 160
+INDIRF4
+ARGF4
+ADDRLP4 164
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $623
+ARGP4
+ADDRLP4 164
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 168
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 172
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $624
+ARGP4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 176
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ARGF4
+ADDRLP4 176
+INDIRF4
+ARGF4
+ADDRLP4 180
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $625
+ARGP4
+ADDRLP4 180
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $626
+ARGP4
+ADDRLP4 100
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $627
+ARGP4
+ADDRLP4 96
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $628
+ARGP4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_serveroptions+4040+60
+ARGP4
+ADDRLP4 184
+ADDRGP4 MField_Buffer
+CALLP4
+ASGNP4
+ADDRGP4 $629
+ARGP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $632
+ADDRGP4 s_serveroptions+8876
+INDIRI4
+CNSTI4 3
+LTI4 $632
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $638
+JUMPV
+LABELV $635
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $643
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+64
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $639
+LABELV $643
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $644
+ARGP4
+ADDRLP4 192
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7456+64
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 playerTeam_list
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $639
+LABELV $636
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $638
+ADDRLP4 188
+ADDRGP4 UI_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 188
+INDIRI4
+LTI4 $635
+LABELV $632
+ADDRGP4 s_startserver+2644
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+2660
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 112
+ADDRLP4 188
+INDIRP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 192
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $649
+ARGP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $652
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 200
+INDIRF4
+CNSTF4 0
+EQF4 $650
+CNSTI4 2
+ARGI4
+ADDRGP4 $653
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $650
+CNSTI4 2
+ARGI4
+ADDRGP4 $654
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $655
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+64
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $659
+ADDRGP4 $656
+JUMPV
+LABELV $659
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+8976
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $663
+ADDRGP4 $656
+JUMPV
+LABELV $663
+ADDRGP4 s_serveroptions+8876
+INDIRI4
+CNSTI4 3
+LTI4 $666
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $669
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+8976
+ADDP4
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7456+64
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 playerTeam_list
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $667
+JUMPV
+LABELV $666
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $673
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+8976
+ADDP4
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $667
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $656
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $655
+LABELV $553
+endproc ServerOptions_Start 208 24
+proc ServerOptions_InitPlayerItems 16 12
+ADDRGP4 s_serveroptions+8872
+INDIRI4
+CNSTI4 0
+EQI4 $676
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $677
+JUMPV
+LABELV $676
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $677
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $679
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+64
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $680
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $679
+ADDRGP4 s_serveroptions+8872
+INDIRI4
+CNSTI4 0
+EQI4 $685
+ADDRGP4 s_serveroptions+8876
+INDIRI4
+CNSTI4 3
+GEI4 $685
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+LABELV $689
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+64
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $690
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $689
+LABELV $685
+ADDRGP4 s_serveroptions+600+60
+INDIRI4
+CNSTI4 0
+NEI4 $695
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $702
+JUMPV
+LABELV $699
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $703
+ARGP4
+ADDRLP4 8
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+8912
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+8912
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+64
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $709
+ADDRLP4 12
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $709
+LABELV $700
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $702
+ADDRLP4 8
+ADDRGP4 UI_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $699
+LABELV $695
+ADDRGP4 s_serveroptions+8876
+INDIRI4
+CNSTI4 3
+LTI4 $713
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $716
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7456+64
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $717
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $716
+ADDRGP4 $725
+JUMPV
+LABELV $722
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7456+64
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $723
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $725
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $722
+ADDRGP4 $714
+JUMPV
+LABELV $713
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $728
+ADDRLP4 8
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7456+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $729
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $728
+LABELV $714
+LABELV $675
+endproc ServerOptions_InitPlayerItems 16 12
+proc ServerOptions_SetPlayerItems 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+600+60
+INDIRI4
+CNSTI4 0
+NEI4 $735
+ADDRGP4 s_serveroptions+5368+60
+ADDRGP4 $525
+ASGNP4
+ADDRLP4 8
+ADDRGP4 s_serveroptions+6592+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294963199
+BANDU4
+ASGNU4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $746
+JUMPV
+LABELV $743
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+68
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $749
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1
+EQI4 $749
+ADDRGP4 $744
+JUMPV
+LABELV $749
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+64
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $751
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6592+60
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+8976
+ADDP4
+ASGNP4
+ADDRGP4 $752
+JUMPV
+LABELV $751
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+64
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $758
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6592+60
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+8912
+ADDP4
+ASGNP4
+LABELV $758
+LABELV $752
+LABELV $744
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $746
+ADDRLP4 12
+ADDRGP4 UI_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $743
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $736
+JUMPV
+LABELV $735
+ADDRGP4 s_serveroptions+5368+60
+ADDRGP4 $524
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $770
+JUMPV
+LABELV $767
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+68
+ADDP4
+CNSTI4 3
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+64
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $773
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+64
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $773
+LABELV $768
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $770
+ADDRLP4 12
+ADDRGP4 UI_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $767
+LABELV $736
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $782
+JUMPV
+LABELV $779
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+64
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $783
+ADDRLP4 8
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6592+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 12
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6592+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 4294963199
+BANDU4
+ASGNU4
+ADDRGP4 $784
+JUMPV
+LABELV $783
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+64
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $791
+ADDRLP4 8
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6592+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+ADDRGP4 $792
+JUMPV
+LABELV $791
+ADDRLP4 8
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6592+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $792
+LABELV $784
+LABELV $780
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $782
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $779
+ADDRGP4 s_serveroptions+8876
+INDIRI4
+CNSTI4 3
+GEI4 $799
+ADDRGP4 $734
+JUMPV
+LABELV $799
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $805
+JUMPV
+LABELV $802
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+64
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $806
+ADDRLP4 8
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7456+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 $807
+JUMPV
+LABELV $806
+ADDRLP4 8
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7456+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $807
+LABELV $803
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $805
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $802
+LABELV $734
+endproc ServerOptions_SetPlayerItems 20 0
+proc ServerOptions_Event 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 24
+LTI4 $815
+ADDRLP4 0
+INDIRI4
+CNSTI4 36
+GEI4 $815
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $817
+ADDRGP4 $814
+JUMPV
+LABELV $817
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 24
+SUBI4
+ARGI4
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+ADDRGP4 $814
+JUMPV
+LABELV $815
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+LTI4 $819
+ADDRLP4 4
+INDIRI4
+CNSTI4 23
+GTI4 $819
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $832-72
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $832
+address $826
+address $819
+address $822
+address $822
+address $823
+address $829
+code
+LABELV $822
+CNSTI4 -2
+ARGI4
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+ADDRGP4 $820
+JUMPV
+LABELV $823
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $824
+ADDRGP4 $820
+JUMPV
+LABELV $824
+ADDRGP4 ServerOptions_Start
+CALLV
+pop
+ADDRGP4 $820
+JUMPV
+LABELV $826
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $820
+ADDRGP4 $820
+JUMPV
+LABELV $829
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $830
+ADDRGP4 $820
+JUMPV
+LABELV $830
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $819
+LABELV $820
+LABELV $814
+endproc ServerOptions_Event 12 4
+proc ServerOptions_PlayerNameEvent 4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $835
+ADDRGP4 $834
+JUMPV
+LABELV $835
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+9172
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+8976
+ADDP4
+ARGP4
+ADDRGP4 UI_BotSelectMenu
+CALLV
+pop
+LABELV $834
+endproc ServerOptions_PlayerNameEvent 4 4
+proc ServerOptions_StatusBar 4 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $840
+JUMPV
+LABELV $840
+CNSTI4 320
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $843
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $841
+LABELV $839
+endproc ServerOptions_StatusBar 4 20
+proc ServerOptions_LevelshotDraw 20 20
+ADDRGP4 s_serveroptions+9168
+INDIRI4
+CNSTI4 0
+EQI4 $845
+ADDRGP4 s_serveroptions+9172
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+8976
+ADDP4
+ARGP4
+ADDRGP4 s_serveroptions+9176
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+9168
+CNSTI4 0
+ASGNI4
+LABELV $845
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bitmap_Draw
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1109393408
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 s_serveroptions+8880
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_serveroptions+8876
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 gametype_remap2
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 gametype_items
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $844
+endproc ServerOptions_LevelshotDraw 20 20
+proc ServerOptions_InitBotNames 1076 12
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $855
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+8976
+ADDP4
+ARGP4
+ADDRGP4 $860
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $856
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 12
+LTI4 $855
+ADDRGP4 s_serveroptions+8876
+INDIRI4
+CNSTI4 3
+LTI4 $861
+ADDRGP4 s_serveroptions+8976+16
+ARGP4
+ADDRGP4 $866
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+8976+32
+ARGP4
+ADDRGP4 $869
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+8876
+INDIRI4
+CNSTI4 3
+NEI4 $870
+ADDRGP4 s_serveroptions+8976+48
+ARGP4
+ADDRGP4 $875
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $871
+JUMPV
+LABELV $870
+ADDRGP4 s_serveroptions+5440+288+64
+CNSTI4 1
+ASGNI4
+LABELV $871
+ADDRGP4 s_serveroptions+5440+384+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+5440+480+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+8976+96
+ARGP4
+ADDRGP4 $887
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+8976+112
+ARGP4
+ADDRGP4 $866
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+8976+128
+ARGP4
+ADDRGP4 $869
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+8876
+INDIRI4
+CNSTI4 3
+NEI4 $892
+ADDRGP4 s_serveroptions+8976+144
+ARGP4
+ADDRGP4 $875
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $893
+JUMPV
+LABELV $892
+ADDRGP4 s_serveroptions+5440+864+64
+CNSTI4 1
+ASGNI4
+LABELV $893
+ADDRGP4 s_serveroptions+5440+960+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+5440+1056+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $854
+JUMPV
+LABELV $861
+ADDRLP4 1048
+ADDRGP4 UI_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+8880
+ARGP4
+ADDRLP4 1052
+ADDRGP4 UI_GetArenaInfoByMap
+CALLP4
+ASGNP4
+ADDRLP4 1044
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 $907
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20
+ASGNP4
+ADDRGP4 $909
+JUMPV
+LABELV $911
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $912
+ADDRLP4 1060
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $914
+ADDRLP4 1060
+INDIRI4
+CNSTI4 32
+EQI4 $911
+LABELV $914
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $915
+ADDRGP4 $931
+JUMPV
+LABELV $915
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $918
+JUMPV
+LABELV $917
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $918
+ADDRLP4 1064
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+EQI4 $920
+ADDRLP4 1064
+INDIRI4
+CNSTI4 32
+NEI4 $917
+LABELV $920
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $921
+ADDRLP4 1068
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1068
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1068
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $921
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 UI_GetBotInfoByName
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 1068
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $923
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1072
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 1072
+INDIRP4
+ASGNP4
+LABELV $923
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $703
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1072
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+8976
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $909
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $927
+ADDRLP4 4
+INDIRI4
+CNSTI4 12
+LTI4 $912
+LABELV $927
+ADDRGP4 $931
+JUMPV
+LABELV $928
+CNSTI4 96
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+64
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $929
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $931
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $928
+ADDRGP4 $937
+JUMPV
+LABELV $934
+CNSTI4 96
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+64
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $938
+CNSTI4 96
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+64
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $938
+LABELV $935
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $937
+ADDRLP4 4
+INDIRI4
+CNSTI4 12
+LTI4 $934
+LABELV $854
+endproc ServerOptions_InitBotNames 1076 12
+bss
+align 1
+LABELV $945
+skip 64
+code
+proc ServerOptions_SetMenuItems 168 16
+ADDRLP4 20
+ADDRGP4 s_serveroptions+8876
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $946
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+GTI4 $946
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $982
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $982
+address $949
+address $957
+address $946
+address $964
+address $973
+code
+LABELV $949
+LABELV $946
+ADDRGP4 $598
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $952
+ARGP4
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 s_serveroptions+1768+60
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 MField_SetText
+CALLV
+pop
+ADDRGP4 $599
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $952
+ARGP4
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 s_serveroptions+664+60
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 MField_SetText
+CALLV
+pop
+ADDRGP4 $600
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+5144+60
+ADDRLP4 52
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $947
+JUMPV
+LABELV $957
+ADDRGP4 $602
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $952
+ARGP4
+ADDRLP4 60
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 s_serveroptions+1768+60
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 MField_SetText
+CALLV
+pop
+ADDRGP4 $603
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $952
+ARGP4
+ADDRLP4 72
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 s_serveroptions+664+60
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 MField_SetText
+CALLV
+pop
+ADDRGP4 $604
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+5144+60
+ADDRLP4 84
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $947
+JUMPV
+LABELV $964
+ADDRGP4 $606
+ARGP4
+ADDRLP4 88
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 92
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $952
+ARGP4
+ADDRLP4 92
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 s_serveroptions+1768+60
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRGP4 MField_SetText
+CALLV
+pop
+ADDRGP4 $607
+ARGP4
+ADDRLP4 100
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 104
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $952
+ARGP4
+ADDRLP4 104
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 108
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 s_serveroptions+664+60
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRGP4 MField_SetText
+CALLV
+pop
+ADDRGP4 $608
+ARGP4
+ADDRLP4 112
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 116
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+3976+60
+ADDRLP4 116
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $609
+ARGP4
+ADDRLP4 120
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 120
+INDIRF4
+ARGF4
+ADDRLP4 124
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+5144+60
+ADDRLP4 124
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $947
+JUMPV
+LABELV $973
+ADDRGP4 $611
+ARGP4
+ADDRLP4 128
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 128
+INDIRF4
+ARGF4
+ADDRLP4 132
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $952
+ARGP4
+ADDRLP4 132
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 136
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 s_serveroptions+2872+60
+ARGP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRGP4 MField_SetText
+CALLV
+pop
+ADDRGP4 $612
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 144
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $952
+ARGP4
+ADDRLP4 144
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 148
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 s_serveroptions+664+60
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRGP4 MField_SetText
+CALLV
+pop
+ADDRGP4 $613
+ARGP4
+ADDRLP4 152
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 152
+INDIRF4
+ARGF4
+ADDRLP4 156
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+3976+60
+ADDRLP4 156
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $614
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 160
+INDIRF4
+ARGF4
+ADDRLP4 164
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+5144+60
+ADDRLP4 164
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $947
+ADDRGP4 $620
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+536+60
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $629
+ARGP4
+ADDRLP4 32
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 s_serveroptions+4040+60
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 MField_SetText
+CALLV
+pop
+ADDRGP4 $628
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+5208+60
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_startserver+2644
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+2660
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $945
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $145
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $945
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $991
+ADDRGP4 $945
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $148
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $991
+ADDRGP4 s_serveroptions+360+4
+ADDRGP4 $945
+ASGNP4
+ADDRGP4 s_serveroptions+8880
+ARGP4
+ADDRGP4 s_startserver+2480+60
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+8880
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 ServerOptions_InitPlayerItems
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+ADDRGP4 ServerOptions_InitBotNames
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+LABELV $944
+endproc ServerOptions_SetMenuItems 168 16
+proc PlayerName_Draw 48 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 256
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $1002
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1003
+JUMPV
+LABELV $1002
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $1003
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $1004
+ADDRLP4 4
+ADDRGP4 text_color_disabled
+ASGNP4
+ADDRGP4 $1005
+JUMPV
+LABELV $1004
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1006
+ADDRLP4 4
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 32768
+BORI4
+ASGNI4
+ADDRGP4 $1007
+JUMPV
+LABELV $1006
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 1
+BANDU4
+CNSTU4 0
+EQU4 $1008
+ADDRLP4 4
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+ADDRGP4 $1009
+JUMPV
+LABELV $1008
+ADDRLP4 4
+ADDRGP4 text_color_normal
+ASGNP4
+LABELV $1009
+LABELV $1007
+LABELV $1005
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1010
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+SUBI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTI4 8450
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+LABELV $1010
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+BORI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+BORI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $1000
+endproc PlayerName_Draw 48 20
+proc ServerOptions_MenuInit 60 12
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 9192
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 s_serveroptions+8872
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $1015
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+8876
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 ServerOptions_Cache
+CALLV
+pop
+ADDRGP4 s_serveroptions+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_serveroptions+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_serveroptions+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_serveroptions+288+60
+ADDRGP4 $277
+ASGNP4
+ADDRGP4 s_serveroptions+288+68
+ADDRGP4 text_banner_color
+ASGNP4
+ADDRGP4 s_serveroptions+288+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_serveroptions+360
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+360+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 s_serveroptions+360+12
+CNSTI4 352
+ASGNI4
+ADDRGP4 s_serveroptions+360+16
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_serveroptions+360+76
+CNSTI4 160
+ASGNI4
+ADDRGP4 s_serveroptions+360+80
+CNSTI4 120
+ASGNI4
+ADDRGP4 s_serveroptions+360+64
+ADDRGP4 $348
+ASGNP4
+ADDRGP4 s_serveroptions+360+56
+ADDRGP4 ServerOptions_LevelshotDraw
+ASGNP4
+ADDRGP4 s_serveroptions+448
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+448+44
+CNSTU4 16452
+ASGNU4
+ADDRGP4 s_serveroptions+448+12
+CNSTI4 314
+ASGNI4
+ADDRGP4 s_serveroptions+448+16
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_serveroptions+448+76
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_serveroptions+448+80
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_serveroptions+448+60
+ADDRGP4 $376
+ASGNP4
+ADDRLP4 4
+CNSTI4 272
+ASGNI4
+ADDRGP4 s_serveroptions+8876
+INDIRI4
+CNSTI4 3
+GTI4 $1057
+ADDRGP4 s_serveroptions+1768
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+1768+4
+ADDRGP4 $1063
+ASGNP4
+ADDRGP4 s_serveroptions+1768+44
+CNSTU4 290
+ASGNU4
+ADDRGP4 s_serveroptions+1768+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+1768+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+1768+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+1768+60+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+1768+60+1040
+CNSTI4 3
+ASGNI4
+ADDRGP4 $1058
+JUMPV
+LABELV $1057
+ADDRGP4 s_serveroptions+2872
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+2872+4
+ADDRGP4 $1081
+ASGNP4
+ADDRGP4 s_serveroptions+2872+44
+CNSTU4 290
+ASGNU4
+ADDRGP4 s_serveroptions+2872+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+2872+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+2872+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+2872+60+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+2872+60+1040
+CNSTI4 3
+ASGNI4
+LABELV $1058
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+664
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+664+4
+ADDRGP4 $1099
+ASGNP4
+ADDRGP4 s_serveroptions+664+44
+CNSTU4 290
+ASGNU4
+ADDRGP4 s_serveroptions+664+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+664+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+664+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+664+60+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+664+60+1040
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+8876
+INDIRI4
+CNSTI4 3
+LTI4 $1114
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+3976
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_serveroptions+3976+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+3976+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+3976+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+3976+4
+ADDRGP4 $1126
+ASGNP4
+LABELV $1114
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+5144
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_serveroptions+5144+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+5144+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+5144+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+5144+4
+ADDRGP4 $1136
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+5208
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_serveroptions+5208+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+5208+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+5208+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+5208+4
+ADDRGP4 $1146
+ASGNP4
+ADDRGP4 $1149
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+NEF4 $1147
+ADDRLP4 20
+ADDRGP4 s_serveroptions+5208+44
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+LABELV $1147
+ADDRGP4 s_serveroptions+8872
+INDIRI4
+CNSTI4 0
+EQI4 $1152
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+536
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_serveroptions+536+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+536+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+536+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+536+4
+ADDRGP4 $1164
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+600
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_serveroptions+600+8
+CNSTI4 21
+ASGNI4
+ADDRGP4 s_serveroptions+600+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+600+48
+ADDRGP4 ServerOptions_Event
+ASGNP4
+ADDRGP4 s_serveroptions+600+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+600+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+600+4
+ADDRGP4 $1178
+ASGNP4
+LABELV $1152
+ADDRGP4 s_serveroptions+8872
+INDIRI4
+CNSTI4 0
+EQI4 $1179
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+4040
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+4040+4
+ADDRGP4 $1185
+ASGNP4
+ADDRGP4 s_serveroptions+4040+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_serveroptions+4040+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+4040+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+4040+60+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_serveroptions+4040+60+1040
+CNSTI4 64
+ASGNI4
+LABELV $1179
+ADDRLP4 4
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_serveroptions+5272
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+5272+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+5272+4
+ADDRGP4 $1203
+ASGNP4
+ADDRGP4 s_serveroptions+5272+4
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_DrawStrlen
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+5272+12
+ADDRLP4 20
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+CNSTF4 1098907648
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+5272+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+5272+76
+ADDRGP4 botSkill_list
+ASGNP4
+ADDRGP4 s_serveroptions+5272+64
+CNSTI4 3
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+5368
+CNSTI4 7
+ASGNI4
+ADDRGP4 s_serveroptions+5368+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_serveroptions+5368+12
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_serveroptions+5368+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+5368+68
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_serveroptions+5368+64
+CNSTI4 257
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1225
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440
+ADDP4
+CNSTI4 3
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 24
+ADDI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+48
+ADDP4
+ADDRGP4 ServerOptions_Event
+ASGNP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+12
+ADDP4
+CNSTI4 32
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 UI_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GEI4 $1240
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+76
+ADDP4
+ADDRGP4 humanPlayerType_list
+ASGNP4
+ADDRGP4 $1241
+JUMPV
+LABELV $1240
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440+76
+ADDP4
+ADDRGP4 playerType_list
+ASGNP4
+LABELV $1241
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6592
+ADDP4
+CNSTI4 7
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6592+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6592+12
+ADDP4
+CNSTI4 96
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6592+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6592+48
+ADDP4
+ADDRGP4 ServerOptions_PlayerNameEvent
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6592+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6592+56
+ADDP4
+ADDRGP4 PlayerName_Draw
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6592+68
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6592+64
+ADDP4
+CNSTI4 256
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1263
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6592+60
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+8912
+ADDP4
+ASGNP4
+ADDRGP4 $1264
+JUMPV
+LABELV $1263
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6592+60
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+8976
+ADDP4
+ASGNP4
+LABELV $1264
+ADDRLP4 44
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 s_serveroptions+6592+24
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 s_serveroptions+6592+16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 s_serveroptions+6592+32
+ADDP4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 s_serveroptions+6592+16
+ADDP4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 s_serveroptions+6592+20
+ADDP4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 s_serveroptions+6592+12
+ADDP4
+INDIRI4
+CNSTI4 8
+SUBI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 s_serveroptions+6592+28
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 s_serveroptions+6592+12
+ADDP4
+INDIRI4
+CNSTI4 128
+ADDI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7456
+ADDP4
+CNSTI4 3
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7456+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7456+12
+ADDP4
+CNSTI4 240
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7456+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7456+76
+ADDP4
+ADDRGP4 playerTeam_list
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+LABELV $1226
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $1225
+ADDRGP4 s_serveroptions+8784
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+8784+4
+ADDRGP4 $443
+ASGNP4
+ADDRGP4 s_serveroptions+8784+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_serveroptions+8784+48
+ADDRGP4 ServerOptions_Event
+ASGNP4
+ADDRGP4 s_serveroptions+8784+8
+CNSTI4 23
+ASGNI4
+ADDRGP4 s_serveroptions+8784+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_serveroptions+8784+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_serveroptions+8784+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_serveroptions+8784+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_serveroptions+8784+60
+ADDRGP4 $460
+ASGNP4
+ADDRGP4 s_serveroptions+8696
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+8696+4
+ADDRGP4 $464
+ASGNP4
+ADDRGP4 s_serveroptions+8696+44
+CNSTU4 28944
+ASGNU4
+ADDRGP4 s_serveroptions+8696+48
+ADDRGP4 ServerOptions_Event
+ASGNP4
+ADDRGP4 s_serveroptions+8696+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_serveroptions+8696+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_serveroptions+8696+16
+CNSTI4 344
+ASGNI4
+ADDRGP4 s_serveroptions+8696+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+8696+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_serveroptions+8696+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_serveroptions+8696+60
+ADDRGP4 $481
+ASGNP4
+ADDRGP4 s_serveroptions+8608
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+8608+4
+ADDRGP4 $1339
+ASGNP4
+ADDRGP4 s_serveroptions+8608+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_serveroptions+8608+48
+ADDRGP4 ServerOptions_Event
+ASGNP4
+ADDRGP4 s_serveroptions+8608+8
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_serveroptions+8608+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_serveroptions+8608+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_serveroptions+8608+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_serveroptions+8608+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_serveroptions+8608+60
+ADDRGP4 $1356
+ASGNP4
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+5272
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+5368
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1362
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1366
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+5440
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1366
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+6592
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions+8876
+INDIRI4
+CNSTI4 3
+LTI4 $1370
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+7456
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1370
+LABELV $1363
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $1362
+ADDRGP4 s_serveroptions+8876
+INDIRI4
+CNSTI4 3
+GTI4 $1374
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+1768
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 $1375
+JUMPV
+LABELV $1374
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+2872
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1375
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+664
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions+8876
+INDIRI4
+CNSTI4 3
+LTI4 $1380
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+3976
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1380
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+5144
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+5208
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions+8872
+INDIRI4
+CNSTI4 0
+EQI4 $1386
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+600
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+4040
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1386
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+8784
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+8696
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+8608
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 ServerOptions_SetMenuItems
+CALLV
+pop
+LABELV $1012
+endproc ServerOptions_MenuInit 60 12
+export ServerOptions_Cache
+proc ServerOptions_Cache 0 4
+ADDRGP4 $443
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $460
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1339
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1356
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $376
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $348
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1395
+endproc ServerOptions_Cache 0 4
+proc UI_ServerOptionsMenu 0 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ServerOptions_MenuInit
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1396
+endproc UI_ServerOptionsMenu 0 4
+proc UI_BotSelectMenu_SortCompare 52 8
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $703
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $703
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $860
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $1399
+CNSTI4 -1
+RETI4
+ADDRGP4 $1398
+JUMPV
+LABELV $1399
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $860
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $1401
+CNSTI4 1
+RETI4
+ADDRGP4 $1398
+JUMPV
+LABELV $1401
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+RETI4
+LABELV $1398
+endproc UI_BotSelectMenu_SortCompare 52 8
+proc UI_BotSelectMenu_BuildList 12 16
+ADDRGP4 botSelectInfo+4772
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRGP4 botSelectInfo+4768
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 botSelectInfo+4776
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+CNSTI4 16
+DIVI4
+ASGNI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+CNSTI4 16
+MODI4
+CNSTI4 0
+EQI4 $1408
+ADDRLP4 8
+ADDRGP4 botSelectInfo+4776
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1408
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1415
+JUMPV
+LABELV $1412
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botSelectInfo+4784
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1413
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1415
+ADDRLP4 0
+INDIRI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+LTI4 $1412
+ADDRGP4 botSelectInfo+4784
+ARGP4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 4
+ARGU4
+ADDRGP4 UI_BotSelectMenu_SortCompare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $1403
+endproc UI_BotSelectMenu_BuildList 12 16
+proc ServerPlayerIcon 84 20
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1424
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $1422
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $1425
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $1421
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $1428
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1421
+JUMPV
+LABELV $1422
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 72
+ADDRGP4 strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1429
+ADDRLP4 76
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $1430
+JUMPV
+LABELV $1429
+ADDRLP4 0
+ADDRGP4 $1431
+ASGNP4
+LABELV $1430
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $1432
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $1433
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1431
+ARGP4
+ADDRLP4 80
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+EQI4 $1433
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $1435
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $1433
+LABELV $1421
+endproc ServerPlayerIcon 84 20
+proc UI_BotSelectMenu_UpdateGrid 36 12
+ADDRLP4 4
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1438
+ADDRLP4 4
+INDIRI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+GEI4 $1442
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botSelectInfo+4784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1446
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 botSelectInfo+8880
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 ServerPlayerIcon
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $703
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+9904
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+9904
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 botSelectInfo+8880
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+9904
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 BotAlreadySelected
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $1453
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+68
+ADDP4
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 $1454
+JUMPV
+LABELV $1453
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+68
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+LABELV $1454
+ADDRLP4 32
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRGP4 $1443
+JUMPV
+LABELV $1442
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+9904
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $1443
+ADDRLP4 12
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+LABELV $1439
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1438
+ADDRLP4 0
+ADDRGP4 botSelectInfo+4780
+INDIRI4
+CNSTI4 16
+MODI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+44
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 20
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRGP4 botSelectInfo+4776
+INDIRI4
+CNSTI4 1
+LEI4 $1478
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+CNSTI4 0
+LEI4 $1481
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4416+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRGP4 $1482
+JUMPV
+LABELV $1481
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4416+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $1482
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+ADDRGP4 botSelectInfo+4776
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $1488
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4504+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 4294950911
+BANDU4
+ASGNU4
+ADDRGP4 $1479
+JUMPV
+LABELV $1488
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4504+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 $1479
+JUMPV
+LABELV $1478
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4416+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 28
+ADDRGP4 botSelectInfo+4504+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $1479
+LABELV $1436
+endproc UI_BotSelectMenu_UpdateGrid 36 12
+proc UI_BotSelectMenu_Default 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1504
+JUMPV
+LABELV $1501
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $703
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $1506
+ADDRGP4 $1503
+JUMPV
+LABELV $1506
+LABELV $1502
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1504
+ADDRLP4 0
+INDIRI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+LTI4 $1501
+LABELV $1503
+ADDRLP4 0
+INDIRI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+NEI4 $1508
+ADDRGP4 botSelectInfo+4780
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1500
+JUMPV
+LABELV $1508
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1515
+JUMPV
+LABELV $1512
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botSelectInfo+4784
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1517
+ADDRGP4 $1514
+JUMPV
+LABELV $1517
+LABELV $1513
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1515
+ADDRLP4 4
+INDIRI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+LTI4 $1512
+LABELV $1514
+ADDRLP4 4
+INDIRI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+NEI4 $1520
+ADDRGP4 botSelectInfo+4780
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1500
+JUMPV
+LABELV $1520
+ADDRGP4 botSelectInfo+4780
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $1500
+endproc UI_BotSelectMenu_Default 28 8
+proc UI_BotSelectMenu_LeftEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1526
+ADDRGP4 $1525
+JUMPV
+LABELV $1526
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+CNSTI4 0
+LEI4 $1528
+ADDRLP4 0
+ADDRGP4 botSelectInfo+4772
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 botSelectInfo+4780
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_UpdateGrid
+CALLV
+pop
+LABELV $1528
+LABELV $1525
+endproc UI_BotSelectMenu_LeftEvent 4 0
+proc UI_BotSelectMenu_RightEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1535
+ADDRGP4 $1534
+JUMPV
+LABELV $1535
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+ADDRGP4 botSelectInfo+4776
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $1537
+ADDRLP4 0
+ADDRGP4 botSelectInfo+4772
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 botSelectInfo+4780
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_UpdateGrid
+CALLV
+pop
+LABELV $1537
+LABELV $1534
+endproc UI_BotSelectMenu_RightEvent 4 0
+proc UI_BotSelectMenu_BotEvent 12 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1545
+ADDRGP4 $1544
+JUMPV
+LABELV $1545
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1547
+ADDRLP4 4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+44
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294967231
+BANDU4
+ASGNU4
+ADDRLP4 8
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+LABELV $1548
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1547
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+44
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 8
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 4294967039
+BANDU4
+ASGNU4
+ADDRGP4 botSelectInfo+4780
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1544
+endproc UI_BotSelectMenu_BotEvent 12 0
+proc UI_BotSelectMenu_BackEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1562
+ADDRGP4 $1561
+JUMPV
+LABELV $1562
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $1561
+endproc UI_BotSelectMenu_BackEvent 0 0
+proc UI_BotSelectMenu_SelectEvent 4 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1565
+ADDRGP4 $1564
+JUMPV
+LABELV $1565
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 s_serveroptions+9168
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+9176
+ARGP4
+ADDRLP4 0
+CNSTI4 16
+ASGNI4
+ADDRGP4 botSelectInfo+4780
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MODI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+9904
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1564
+endproc UI_BotSelectMenu_SelectEvent 4 12
+export UI_BotSelectMenu_Cache
+proc UI_BotSelectMenu_Cache 0 4
+ADDRGP4 $443
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $460
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1572
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1573
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1574
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1575
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $380
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $408
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $426
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1571
+endproc UI_BotSelectMenu_Cache 0 4
+proc UI_BotSelectMenu_Init 36 12
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 10160
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 botSelectInfo+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 botSelectInfo+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_Cache
+CALLV
+pop
+ADDRGP4 botSelectInfo+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 botSelectInfo+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 botSelectInfo+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 botSelectInfo+288+60
+ADDRGP4 $1586
+ASGNP4
+ADDRGP4 botSelectInfo+288+68
+ADDRGP4 text_banner_color
+ASGNP4
+ADDRGP4 botSelectInfo+288+64
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+CNSTI4 80
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $1594
+JUMPV
+LABELV $1591
+ADDRLP4 4
+CNSTI4 180
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $1595
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+44
+ADDP4
+CNSTU4 16388
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 botSelectInfo+8880
+ADDP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+76
+ADDP4
+CNSTI4 64
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+80
+ADDP4
+CNSTI4 64
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+60
+ADDP4
+ADDRGP4 $1575
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+84
+ADDP4
+ADDRGP4 colorRed
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+CNSTU4 33028
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+48
+ADDP4
+ADDRGP4 UI_BotSelectMenu_BotEvent
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 16
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+24
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+28
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+32
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+76
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+80
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+60
+ADDP4
+ADDRGP4 $1574
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+84
+ADDP4
+ADDRGP4 colorRed
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176
+ADDP4
+CNSTI4 7
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+60
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+9904
+ADDP4
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+68
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+64
+ADDP4
+CNSTI4 258
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 70
+ADDI4
+ASGNI4
+LABELV $1596
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LTI4 $1595
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 86
+ADDI4
+ASGNI4
+LABELV $1592
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1594
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LTI4 $1591
+ADDRGP4 botSelectInfo+4328
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4328+4
+ADDRGP4 $380
+ASGNP4
+ADDRGP4 botSelectInfo+4328+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 botSelectInfo+4328+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 botSelectInfo+4328+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 botSelectInfo+4328+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 botSelectInfo+4328+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 botSelectInfo+4416
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4416+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 botSelectInfo+4416+48
+ADDRGP4 UI_BotSelectMenu_LeftEvent
+ASGNP4
+ADDRGP4 botSelectInfo+4416+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 botSelectInfo+4416+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 botSelectInfo+4416+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+4416+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 botSelectInfo+4416+60
+ADDRGP4 $408
+ASGNP4
+ADDRGP4 botSelectInfo+4504
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4504+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 botSelectInfo+4504+48
+ADDRGP4 UI_BotSelectMenu_RightEvent
+ASGNP4
+ADDRGP4 botSelectInfo+4504+12
+CNSTI4 321
+ASGNI4
+ADDRGP4 botSelectInfo+4504+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 botSelectInfo+4504+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+4504+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 botSelectInfo+4504+60
+ADDRGP4 $426
+ASGNP4
+ADDRGP4 botSelectInfo+4680
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4680+4
+ADDRGP4 $443
+ASGNP4
+ADDRGP4 botSelectInfo+4680+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 botSelectInfo+4680+48
+ADDRGP4 UI_BotSelectMenu_BackEvent
+ASGNP4
+ADDRGP4 botSelectInfo+4680+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 botSelectInfo+4680+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 botSelectInfo+4680+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 botSelectInfo+4680+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+4680+60
+ADDRGP4 $460
+ASGNP4
+ADDRGP4 botSelectInfo+4592
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4592+4
+ADDRGP4 $1572
+ASGNP4
+ADDRGP4 botSelectInfo+4592+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 botSelectInfo+4592+48
+ADDRGP4 UI_BotSelectMenu_SelectEvent
+ASGNP4
+ADDRGP4 botSelectInfo+4592+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 botSelectInfo+4592+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 botSelectInfo+4592+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 botSelectInfo+4592+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+4592+60
+ADDRGP4 $1573
+ASGNP4
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $1736
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 88
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 88
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 72
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1737
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+LTI4 $1736
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4328
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4416
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4504
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4680
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4592
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 UI_BotSelectMenu_BuildList
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_BotSelectMenu_Default
+CALLV
+pop
+ADDRGP4 botSelectInfo+4772
+ADDRGP4 botSelectInfo+4780
+INDIRI4
+CNSTI4 16
+DIVI4
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_UpdateGrid
+CALLV
+pop
+LABELV $1576
+endproc UI_BotSelectMenu_Init 36 12
+export UI_BotSelectMenu
+proc UI_BotSelectMenu 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_BotSelectMenu_Init
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1750
+endproc UI_BotSelectMenu 0 4
+bss
+align 4
+LABELV botSelectInfo
+skip 10160
+align 4
+LABELV s_serveroptions
+skip 9192
+align 4
+LABELV s_startserver
+skip 6756
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPMap_f
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_MaxSplitView
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_CursorInRect
+import UI_DrawChar
+import UI_MField_Draw
+import UI_DrawStrlen
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_InitPropFont
+import UI_InitBannerFont
+import UI_LerpColor
+import UI_RegisterPlayerModelname
+import UI_PlayerInfo_UpdateColor
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import UI_Joystick_Cache
+import UI_JoystickMenu
+import Controls_WantsBindKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_SelectPlayer_Cache
+import UI_SelectPlayerMenu
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import InSelectPlayerMenu
+import InSelectPlayer_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_small_title_color
+import text_big_color
+import text_banner_color
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_menuFontBanner
+import ui_menuFontProp
+import ui_menuFont
+import ui_ioq3
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserSeparateMasters
+import ui_browserShowBots
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserGame
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_publicServer
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import UI_DrawProportionalString
+import UI_WindowResized
+import UI_WantsBindKeys
+import UI_DrawConnectScreen
+import UI_ConsoleCommand
+import UI_SetActiveMenu
+import UI_Refresh
+import UI_IsFullscreen
+import UI_SetCursorPos
+import UI_GetCursorPos
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import ui_numCommands
+import ui_commands
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_drawScores
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1586
+byte 1 83
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 32
+byte 1 66
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $1575
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1574
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $1573
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1572
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1446
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1435
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1432
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1431
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $1428
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1425
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1424
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $1356
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1339
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1203
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $1185
+byte 1 72
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $1178
+byte 1 68
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 0
+align 1
+LABELV $1164
+byte 1 65
+byte 1 100
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $1149
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $1146
+byte 1 80
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $1136
+byte 1 73
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 58
+byte 1 0
+align 1
+LABELV $1126
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $1099
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $1081
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $1063
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $1015
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $952
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $907
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $887
+byte 1 83
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $875
+byte 1 86
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $869
+byte 1 77
+byte 1 97
+byte 1 106
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $866
+byte 1 71
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $860
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $843
+byte 1 48
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 79
+byte 1 32
+byte 1 76
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 0
+align 1
+LABELV $703
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $673
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $669
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $654
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 51
+byte 1 10
+byte 1 0
+align 1
+LABELV $653
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $652
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $649
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $644
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $629
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $628
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $627
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 0
+align 1
+LABELV $626
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $625
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $624
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $623
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $622
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $621
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $620
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $616
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $614
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 0
+align 1
+LABELV $613
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $612
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $611
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $609
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 0
+align 1
+LABELV $608
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $607
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $606
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $604
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 0
+align 1
+LABELV $603
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $602
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $600
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 0
+align 1
+LABELV $599
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $598
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $593
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $532
+byte 1 78
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 33
+byte 1 0
+align 1
+LABELV $531
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $530
+byte 1 72
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 77
+byte 1 101
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $529
+byte 1 66
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 73
+byte 1 116
+byte 1 32
+byte 1 79
+byte 1 110
+byte 1 0
+align 1
+LABELV $528
+byte 1 73
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 87
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $527
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $526
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $525
+byte 1 72
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $524
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $523
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 0
+align 1
+LABELV $522
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $511
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $481
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $464
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $460
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $443
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $426
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $408
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $380
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $376
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $348
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $345
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $313
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $299
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $285
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 50
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $277
+byte 1 71
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $243
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $215
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $180
+byte 1 78
+byte 1 79
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 83
+byte 1 32
+byte 1 70
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $148
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $145
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $144
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $132
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $129
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $126
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $123
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $120
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $111
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $110
+byte 1 84
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $109
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $108
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
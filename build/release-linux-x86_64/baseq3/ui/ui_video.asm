@@ -0,0 +1,7448 @@
+data
+align 4
+LABELV driverinfo_artlist
+address $107
+address $108
+address $109
+address $110
+byte 4 0
+code
+proc DriverInfo_Event 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $113
+ADDRGP4 $112
+JUMPV
+LABELV $113
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+EQI4 $118
+ADDRGP4 $115
+JUMPV
+LABELV $118
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $115
+LABELV $116
+LABELV $112
+endproc DriverInfo_Event 4 0
+proc DriverInfo_MenuDraw 12 20
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 80
+ARGI4
+ADDRGP4 $120
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 text_small_title_color
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 152
+ARGI4
+ADDRGP4 $121
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 text_small_title_color
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 192
+ARGI4
+ADDRGP4 $122
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 text_small_title_color
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 96
+ARGI4
+ADDRGP4 cgs+20100+1024
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 112
+ARGI4
+ADDRGP4 cgs+20100+2048
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 128
+ARGI4
+ADDRGP4 cgs+20100
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $128
+ARGP4
+ADDRGP4 cgs+20100+35848
+INDIRI4
+ARGI4
+ADDRGP4 cgs+20100+35852
+INDIRI4
+ARGI4
+ADDRGP4 cgs+20100+35856
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 320
+ARGI4
+CNSTI4 168
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 208
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $138
+JUMPV
+LABELV $135
+CNSTI4 316
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 259
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 324
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $136
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $138
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_driverinfo+1904
+INDIRI4
+CNSTI4 2
+DIVI4
+LTI4 $135
+ADDRGP4 s_driverinfo+1904
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $143
+CNSTI4 320
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 s_driverinfo+1904
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648-4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $143
+LABELV $119
+endproc DriverInfo_MenuDraw 12 20
+export DriverInfo_Cache
+proc DriverInfo_Cache 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $150
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 driverinfo_artlist
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $154
+ADDRGP4 $152
+JUMPV
+LABELV $154
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 driverinfo_artlist
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $151
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $150
+JUMPV
+LABELV $152
+LABELV $149
+endproc DriverInfo_Cache 4 4
+proc UI_DriverInfo_Menu 36 12
+ADDRGP4 s_driverinfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1908
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 DriverInfo_Cache
+CALLV
+pop
+ADDRGP4 s_driverinfo+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_driverinfo+268
+ADDRGP4 DriverInfo_MenuDraw
+ASGNP4
+ADDRGP4 s_driverinfo+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_driverinfo+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_driverinfo+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_driverinfo+288+60
+ADDRGP4 $166
+ASGNP4
+ADDRGP4 s_driverinfo+288+68
+ADDRGP4 text_banner_color
+ASGNP4
+ADDRGP4 s_driverinfo+288+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_driverinfo+448
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_driverinfo+448+4
+ADDRGP4 $107
+ASGNP4
+ADDRGP4 s_driverinfo+448+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_driverinfo+448+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_driverinfo+448+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_driverinfo+448+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_driverinfo+448+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_driverinfo+536
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_driverinfo+536+4
+ADDRGP4 $108
+ASGNP4
+ADDRGP4 s_driverinfo+536+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_driverinfo+536+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_driverinfo+536+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_driverinfo+536+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_driverinfo+536+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_driverinfo+360
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_driverinfo+360+4
+ADDRGP4 $109
+ASGNP4
+ADDRGP4 s_driverinfo+360+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_driverinfo+360+48
+ADDRGP4 DriverInfo_Event
+ASGNP4
+ADDRGP4 s_driverinfo+360+8
+CNSTI4 100
+ASGNI4
+ADDRGP4 s_driverinfo+360+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_driverinfo+360+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_driverinfo+360+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_driverinfo+360+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_driverinfo+360+60
+ADDRGP4 $110
+ASGNP4
+ADDRGP4 s_driverinfo+624
+ARGP4
+ADDRGP4 cgs+20100+3072
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 s_driverinfo+624
+ASGNP4
+ADDRGP4 $221
+JUMPV
+LABELV $224
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $225
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $227
+ADDRLP4 16
+INDIRI4
+CNSTI4 32
+EQI4 $224
+LABELV $227
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $233
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+EQI4 $233
+ADDRLP4 28
+ADDRGP4 s_driverinfo+1904
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $233
+JUMPV
+LABELV $232
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $233
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $235
+ADDRLP4 32
+INDIRI4
+CNSTI4 32
+NEI4 $232
+LABELV $235
+LABELV $221
+ADDRGP4 s_driverinfo+1904
+INDIRI4
+CNSTI4 40
+GEI4 $236
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $225
+LABELV $236
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $240
+JUMPV
+LABELV $237
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 12
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+LEI4 $243
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648
+ADDP4
+INDIRP4
+ADDP4
+CNSTI1 62
+ASGNI1
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648
+ADDP4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $243
+LABELV $238
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $240
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_driverinfo+1904
+INDIRI4
+LTI4 $237
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $156
+endproc UI_DriverInfo_Menu 36 12
+data
+align 4
+LABELV s_ivo_templates
+byte 4 6
+byte 4 1
+byte 4 3
+byte 4 0
+byte 4 2
+byte 4 2
+byte 4 4
+byte 4 5
+byte 4 2
+byte 4 1
+byte 4 4
+byte 4 6
+byte 4 1
+byte 4 3
+byte 4 0
+byte 4 2
+byte 4 2
+byte 4 3
+byte 4 2
+byte 4 1
+byte 4 1
+byte 4 4
+byte 4 6
+byte 4 1
+byte 4 3
+byte 4 0
+byte 4 0
+byte 4 2
+byte 4 2
+byte 4 1
+byte 4 0
+byte 4 1
+byte 4 3
+byte 4 4
+byte 4 1
+byte 4 2
+byte 4 0
+byte 4 1
+byte 4 0
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 3
+byte 4 3
+byte 4 1
+byte 4 1
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 3
+byte 4 3
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 3
+align 4
+LABELV builtinResolutions
+address $253
+address $254
+address $255
+address $256
+address $257
+address $258
+address $259
+address $260
+address $261
+address $262
+address $263
+address $264
+byte 4 0
+align 4
+LABELV knownRatios
+address $265
+address $266
+address $267
+address $268
+address $269
+address $270
+address $271
+address $272
+address $273
+address $274
+address $275
+address $276
+address $277
+address $278
+byte 4 0
+byte 4 0
+align 4
+LABELV resolutions
+address builtinResolutions
+align 4
+LABELV resolutionsDetected
+byte 4 0
+code
+proc GraphicsOptions_FindBuiltinResolution 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+NEI4 $280
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $279
+JUMPV
+LABELV $280
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $282
+CNSTI4 -2
+RETI4
+ADDRGP4 $279
+JUMPV
+LABELV $282
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $284
+CNSTI4 -1
+RETI4
+ADDRGP4 $279
+JUMPV
+LABELV $284
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $289
+JUMPV
+LABELV $286
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $290
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $279
+JUMPV
+LABELV $290
+LABELV $287
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $289
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $286
+CNSTI4 -1
+RETI4
+LABELV $279
+endproc GraphicsOptions_FindBuiltinResolution 12 8
+proc GraphicsOptions_FindDetectedResolution 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+NEI4 $293
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $292
+JUMPV
+LABELV $293
+ADDRFP4 0
+INDIRI4
+CNSTI4 -2
+NEI4 $295
+CNSTI4 0
+RETI4
+ADDRGP4 $292
+JUMPV
+LABELV $295
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $297
+CNSTI4 -1
+RETI4
+ADDRGP4 $292
+JUMPV
+LABELV $297
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $302
+JUMPV
+LABELV $299
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $303
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $292
+JUMPV
+LABELV $303
+LABELV $300
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $302
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $299
+CNSTI4 -1
+RETI4
+LABELV $292
+endproc GraphicsOptions_FindDetectedResolution 12 8
+bss
+align 1
+LABELV $306
+skip 14
+export GraphicsOptions_AspectString
+code
+proc GraphicsOptions_AspectString 8 16
+ADDRGP4 $306
+ARGP4
+CNSTI4 14
+ARGI4
+ADDRGP4 $307
+ARGP4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 4
+INDIRF4
+DIVF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $311
+JUMPV
+LABELV $308
+ADDRGP4 $306
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $312
+ADDRGP4 $306
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 14
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $310
+JUMPV
+LABELV $312
+LABELV $309
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $311
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $308
+LABELV $310
+ADDRGP4 $306
+RETP4
+LABELV $305
+endproc GraphicsOptions_AspectString 8 16
+proc GraphicsOptions_GetAspectRatios 60 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $319
+JUMPV
+LABELV $316
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resolutions
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 40
+ARGI4
+ADDRLP4 36
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $320
+ADDRLP4 24
+ADDRGP4 cgs+20100+35892
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+20100+35896
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+ADDRGP4 GraphicsOptions_AspectString
+CALLP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+CNSTI4 14
+ARGI4
+ADDRGP4 $326
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $321
+JUMPV
+LABELV $320
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resolutions
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 40
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 40
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 44
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resolutions
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 56
+ADDRGP4 GraphicsOptions_AspectString
+CALLP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTI4 14
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $321
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $330
+JUMPV
+LABELV $327
+ADDRLP4 8
+ARGP4
+CNSTI4 14
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 ratioBuf
+ADDP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $331
+ADDRGP4 $329
+JUMPV
+LABELV $331
+LABELV $328
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $330
+CNSTI4 14
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 ratioBuf
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $327
+LABELV $329
+CNSTI4 14
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 ratioBuf
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $333
+ADDRLP4 40
+CNSTI4 14
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 ratioBuf
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ratioToRes
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $333
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ratios
+ADDP4
+CNSTI4 14
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 ratioBuf
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resToRatio
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $317
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $319
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resolutions
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $316
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ratios
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $315
+endproc GraphicsOptions_GetAspectRatios 60 16
+proc GraphicsOptions_GetInitialVideo 0 0
+ADDRGP4 s_ivo+16
+ADDRGP4 s_graphicsoptions+1784+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+4
+ADDRGP4 s_graphicsoptions+1400+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+40
+ADDRGP4 s_graphicsoptions+1112+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+8
+ADDRGP4 s_graphicsoptions+1304+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+12
+ADDRGP4 s_graphicsoptions+1496+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+36
+ADDRGP4 s_graphicsoptions+1592+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+24
+ADDRGP4 s_graphicsoptions+1880+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+28
+ADDRGP4 s_graphicsoptions+1976+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+32
+ADDRGP4 s_graphicsoptions+2072+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+20
+ADDRGP4 s_graphicsoptions+1688+64
+INDIRI4
+ASGNI4
+LABELV $335
+endproc GraphicsOptions_GetInitialVideo 0 0
+bss
+align 1
+LABELV $372
+skip 64
+code
+proc GraphicsOptions_GetResolutions 24 20
+ADDRGP4 $369
+ARGP4
+ADDRGP4 resbuf
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 resbuf
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $370
+ADDRLP4 0
+ADDRGP4 resbuf
+ASGNP4
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRGP4 $372
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $373
+ARGP4
+ADDRGP4 cgs+20100+35892
+INDIRI4
+ARGI4
+ADDRGP4 cgs+20100+35896
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 8
+ADDRLP4 4
+INDIRU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 8
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 detectedResolutions
+ADDP4
+ADDRGP4 $372
+ASGNP4
+ADDRGP4 s_ivo_templates
+CNSTI4 -2
+ASGNI4
+ADDRGP4 $379
+JUMPV
+LABELV $378
+ADDRLP4 12
+ADDRLP4 4
+INDIRU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 12
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 12
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 detectedResolutions
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 16
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $381
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $381
+LABELV $379
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $383
+ADDRLP4 4
+INDIRU4
+CNSTU4 31
+LTU4 $378
+LABELV $383
+ADDRLP4 4
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 detectedResolutions
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRU4
+CNSTU4 31
+GEU4 $384
+ADDRGP4 currentResolution
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 $386
+ARGP4
+ADDRGP4 cgs+20100+35880
+INDIRI4
+ARGI4
+ADDRGP4 cgs+20100+35884
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRGP4 $394
+JUMPV
+LABELV $391
+ADDRLP4 4
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 currentResolution
+ARGP4
+ADDRLP4 12
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $395
+ADDRGP4 $393
+JUMPV
+LABELV $395
+LABELV $392
+ADDRLP4 4
+ADDRLP4 4
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+LABELV $394
+ADDRLP4 4
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $391
+LABELV $393
+ADDRLP4 4
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $397
+ADDRLP4 12
+ADDRLP4 4
+INDIRU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 12
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 12
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 detectedResolutions
+ADDP4
+ADDRGP4 currentResolution
+ASGNP4
+ADDRLP4 4
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 detectedResolutions
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $397
+LABELV $384
+ADDRGP4 resolutions
+ADDRGP4 detectedResolutions
+ASGNP4
+ADDRGP4 resolutionsDetected
+CNSTI4 1
+ASGNI4
+LABELV $370
+LABELV $368
+endproc GraphicsOptions_GetResolutions 24 20
+proc GraphicsOptions_CheckConfig 8 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $403
+JUMPV
+LABELV $400
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+16
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1784+64
+INDIRI4
+EQI4 $404
+ADDRGP4 $401
+JUMPV
+LABELV $404
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 GraphicsOptions_FindDetectedResolution
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+EQI4 $409
+ADDRGP4 $401
+JUMPV
+LABELV $409
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+40
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1112+64
+INDIRI4
+EQI4 $413
+ADDRGP4 $401
+JUMPV
+LABELV $413
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+8
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1304+64
+INDIRI4
+EQI4 $418
+ADDRGP4 $401
+JUMPV
+LABELV $418
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+12
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1496+64
+INDIRI4
+EQI4 $423
+ADDRGP4 $401
+JUMPV
+LABELV $423
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+36
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1592+64
+INDIRI4
+EQI4 $428
+ADDRGP4 $401
+JUMPV
+LABELV $428
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+24
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1880+64
+INDIRI4
+EQI4 $433
+ADDRGP4 $401
+JUMPV
+LABELV $433
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+28
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1976+64
+INDIRI4
+EQI4 $438
+ADDRGP4 $401
+JUMPV
+LABELV $438
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+32
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+2072+64
+INDIRI4
+EQI4 $443
+ADDRGP4 $401
+JUMPV
+LABELV $443
+ADDRGP4 s_graphicsoptions+824+64
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $399
+JUMPV
+LABELV $401
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $403
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 5
+LTU4 $400
+ADDRGP4 s_graphicsoptions+824+64
+CNSTI4 5
+ASGNI4
+LABELV $399
+endproc GraphicsOptions_CheckConfig 8 4
+proc GraphicsOptions_UpdateMenuItems 8 0
+ADDRGP4 s_graphicsoptions+1400+64
+INDIRI4
+CNSTI4 0
+NEI4 $453
+ADDRGP4 s_graphicsoptions+1784+64
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+1784+44
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $454
+JUMPV
+LABELV $453
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+1784+44
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 4294959103
+BANDU4
+ASGNU4
+LABELV $454
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+2240+44
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 s_ivo
+INDIRI4
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+EQI4 $465
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2240+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $465
+ADDRGP4 s_ivo+40
+INDIRI4
+ADDRGP4 s_graphicsoptions+1112+64
+INDIRI4
+EQI4 $471
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2240+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $471
+ADDRGP4 s_ivo+4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1400+64
+INDIRI4
+EQI4 $478
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2240+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $478
+ADDRGP4 s_ivo+8
+INDIRI4
+ADDRGP4 s_graphicsoptions+1304+64
+INDIRI4
+EQI4 $485
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2240+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $485
+ADDRGP4 s_ivo+12
+INDIRI4
+ADDRGP4 s_graphicsoptions+1496+64
+INDIRI4
+EQI4 $492
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2240+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $492
+ADDRGP4 s_ivo+16
+INDIRI4
+ADDRGP4 s_graphicsoptions+1784+64
+INDIRI4
+EQI4 $499
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2240+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $499
+ADDRGP4 s_ivo+36
+INDIRI4
+ADDRGP4 s_graphicsoptions+1592+64
+INDIRI4
+EQI4 $506
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2240+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $506
+ADDRGP4 s_ivo+20
+INDIRI4
+ADDRGP4 s_graphicsoptions+1688+64
+INDIRI4
+EQI4 $513
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2240+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $513
+ADDRGP4 s_ivo+24
+INDIRI4
+ADDRGP4 s_graphicsoptions+1880+64
+INDIRI4
+EQI4 $520
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2240+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $520
+ADDRGP4 s_ivo+28
+INDIRI4
+ADDRGP4 s_graphicsoptions+1976+64
+INDIRI4
+EQI4 $527
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2240+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $527
+ADDRGP4 s_ivo+32
+INDIRI4
+ADDRGP4 s_graphicsoptions+2072+64
+INDIRI4
+EQI4 $534
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+2240+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 4294946815
+BANDU4
+ASGNU4
+LABELV $534
+ADDRGP4 GraphicsOptions_CheckConfig
+CALLV
+pop
+LABELV $452
+endproc GraphicsOptions_UpdateMenuItems 8 0
+proc GraphicsOptions_ApplyChanges 52 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $542
+ADDRGP4 $541
+JUMPV
+LABELV $542
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+1688+64
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $548
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $550
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $551
+ADDRGP4 $544
+JUMPV
+LABELV $548
+ADDRGP4 $549
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $545
+JUMPV
+LABELV $550
+ADDRGP4 $549
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $545
+JUMPV
+LABELV $551
+ADDRGP4 $549
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $544
+LABELV $545
+ADDRGP4 $552
+ARGP4
+CNSTI4 3
+ADDRGP4 s_graphicsoptions+1304+64
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+EQI4 $555
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 -1
+EQI4 $563
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CVIU4 4
+CNSTU4 32
+LTU4 $557
+LABELV $563
+ADDRGP4 s_graphicsoptions+1016+64
+CNSTI4 0
+ASGNI4
+LABELV $557
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 GraphicsOptions_FindBuiltinResolution
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $568
+ADDRLP4 12
+ARGP4
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 44
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 48
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $574
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $575
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $568
+ADDRGP4 $576
+ARGP4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $556
+JUMPV
+LABELV $555
+ADDRGP4 $576
+ARGP4
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $556
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1112+64
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $579
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+GTI4 $579
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $590
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $590
+address $583
+address $586
+address $587
+address $588
+address $589
+code
+LABELV $583
+ADDRGP4 $584
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $585
+ARGP4
+CNSTF4 1123680256
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $580
+JUMPV
+LABELV $586
+ADDRGP4 $584
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $585
+ARGP4
+CNSTF4 1106247680
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $580
+JUMPV
+LABELV $587
+ADDRGP4 $584
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $585
+ARGP4
+CNSTF4 1114636288
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $580
+JUMPV
+LABELV $588
+ADDRGP4 $584
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $585
+ARGP4
+CNSTF4 1118437376
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $580
+JUMPV
+LABELV $589
+ADDRGP4 $584
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $585
+ARGP4
+CNSTF4 1123680256
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $579
+LABELV $580
+ADDRGP4 $591
+ARGP4
+ADDRGP4 s_graphicsoptions+1400+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 s_graphicsoptions+1784+64
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $598
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $602
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+EQI4 $603
+ADDRGP4 $594
+JUMPV
+LABELV $598
+ADDRGP4 $599
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $600
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $601
+ARGP4
+ADDRGP4 trap_Cvar_Reset
+CALLV
+pop
+ADDRGP4 $595
+JUMPV
+LABELV $602
+ADDRGP4 $599
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $600
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $601
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $595
+JUMPV
+LABELV $603
+ADDRGP4 $599
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $600
+ARGP4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $601
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $594
+LABELV $595
+ADDRGP4 $604
+ARGP4
+ADDRGP4 s_graphicsoptions+1496+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $607
+ARGP4
+ADDRGP4 s_graphicsoptions+1592+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_graphicsoptions+1880+64
+INDIRI4
+CNSTI4 4
+NEI4 $610
+ADDRGP4 $614
+ARGP4
+CNSTF4 3221225472
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $615
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $616
+ARGP4
+CNSTF4 1176256512
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $611
+JUMPV
+LABELV $610
+ADDRGP4 s_graphicsoptions+1880+64
+INDIRI4
+CNSTI4 3
+NEI4 $617
+ADDRGP4 $614
+ARGP4
+CNSTF4 3221225472
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $615
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $616
+ARGP4
+CNSTF4 1148846080
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $618
+JUMPV
+LABELV $617
+ADDRGP4 s_graphicsoptions+1880+64
+INDIRI4
+CNSTI4 2
+NEI4 $621
+ADDRGP4 $614
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $615
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $616
+ARGP4
+CNSTF4 1132068864
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $622
+JUMPV
+LABELV $621
+ADDRGP4 s_graphicsoptions+1880+64
+INDIRI4
+CNSTI4 1
+NEI4 $625
+ADDRGP4 $614
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $615
+ARGP4
+CNSTF4 1094713344
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $616
+ARGP4
+CNSTF4 1132068864
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $625
+ADDRGP4 $614
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $615
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $616
+ARGP4
+CNSTF4 1132068864
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $626
+LABELV $622
+LABELV $618
+LABELV $611
+ADDRGP4 s_graphicsoptions+1976+64
+INDIRI4
+CNSTI4 2
+LTI4 $629
+ADDRGP4 $633
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRLP4 12
+ADDRGP4 s_graphicsoptions+1976+64
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $634
+ADDRLP4 12
+INDIRI4
+CNSTI4 5
+GTI4 $634
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 $643-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $643
+address $638
+address $640
+address $641
+address $642
+code
+LABELV $634
+LABELV $638
+ADDRGP4 $639
+ARGP4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $630
+JUMPV
+LABELV $640
+ADDRGP4 $639
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $630
+JUMPV
+LABELV $641
+ADDRGP4 $639
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $630
+JUMPV
+LABELV $642
+ADDRGP4 $639
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $630
+JUMPV
+LABELV $629
+ADDRGP4 $633
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_graphicsoptions+1976+64
+INDIRI4
+CNSTI4 0
+EQI4 $645
+ADDRGP4 $649
+ARGP4
+ADDRGP4 $650
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $646
+JUMPV
+LABELV $645
+ADDRGP4 $649
+ARGP4
+ADDRGP4 $651
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $646
+LABELV $630
+ADDRGP4 $652
+ARGP4
+ADDRGP4 s_graphicsoptions+2072+64
+INDIRI4
+CNSTI4 1
+LSHI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $655
+ARGP4
+ADDRGP4 s_graphicsoptions+2072+64
+INDIRI4
+CNSTI4 1
+LSHI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $658
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $541
+endproc GraphicsOptions_ApplyChanges 52 12
+proc GraphicsOptions_Event 16 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $660
+ADDRGP4 $659
+JUMPV
+LABELV $660
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 101
+LTI4 $662
+ADDRLP4 4
+INDIRI4
+CNSTI4 110
+GTI4 $662
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $710-404
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $710
+address $705
+address $662
+address $675
+address $670
+address $704
+address $663
+address $707
+address $708
+address $709
+address $665
+code
+LABELV $665
+ADDRGP4 s_graphicsoptions+1016+64
+ADDRGP4 s_graphicsoptions+920+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ratioToRes
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $670
+ADDRGP4 s_graphicsoptions+920+64
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resToRatio
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $663
+JUMPV
+LABELV $675
+ADDRLP4 0
+CNSTI4 44
+ADDRGP4 s_graphicsoptions+824+64
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 GraphicsOptions_FindDetectedResolution
+CALLI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1016+64
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+920+64
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resToRatio
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1112+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1304+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1496+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1784+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1592+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1688+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1880+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1976+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2072+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1400+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $663
+JUMPV
+LABELV $704
+ADDRGP4 UI_DriverInfo_Menu
+CALLV
+pop
+ADDRGP4 $663
+JUMPV
+LABELV $705
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $663
+JUMPV
+LABELV $707
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_DisplayOptionsMenu
+CALLV
+pop
+ADDRGP4 $663
+JUMPV
+LABELV $708
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_SoundOptionsMenu
+CALLV
+pop
+ADDRGP4 $663
+JUMPV
+LABELV $709
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_NetworkOptionsMenu
+CALLV
+pop
+LABELV $662
+LABELV $663
+LABELV $659
+endproc GraphicsOptions_Event 16 4
+export GraphicsOptions_MenuDraw
+proc GraphicsOptions_MenuDraw 0 4
+ADDRGP4 GraphicsOptions_UpdateMenuItems
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $712
+endproc GraphicsOptions_MenuDraw 0 4
+proc GraphicsOptions_SetMenuItems 1060 12
+ADDRGP4 $576
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 8
+ADDRGP4 GraphicsOptions_FindDetectedResolution
+CALLI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1016+64
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 0
+GEI4 $716
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+EQI4 $720
+ADDRGP4 $574
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 1022
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1040
+INDIRU4
+CNSTU4 1
+ADDU4
+ADDRLP4 16
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 16
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1044
+INDIRU4
+ADDRLP4 16
+ADDP4
+CNSTI1 120
+ASGNI1
+ADDRLP4 16
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 16
+ARGP4
+ADDRLP4 1052
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRGP4 $575
+ARGP4
+ADDRLP4 1048
+INDIRU4
+ADDRLP4 16
+ADDP4
+ARGP4
+CNSTU4 1024
+ADDRLP4 1052
+INDIRU4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $725
+JUMPV
+LABELV $722
+ADDRLP4 16
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $726
+ADDRGP4 s_graphicsoptions+1016+64
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $724
+JUMPV
+LABELV $726
+LABELV $723
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $725
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $722
+LABELV $724
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 0
+GEI4 $721
+ADDRGP4 s_graphicsoptions+1016+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $721
+JUMPV
+LABELV $720
+ADDRGP4 s_graphicsoptions+1016+64
+CNSTI4 3
+ASGNI4
+LABELV $721
+LABELV $716
+ADDRGP4 s_graphicsoptions+920+64
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 resToRatio
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $585
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1112+64
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $584
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+EQF4 $744
+ADDRGP4 s_graphicsoptions+1112+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $745
+JUMPV
+LABELV $744
+ADDRGP4 s_graphicsoptions+1112+64
+INDIRI4
+CNSTI4 30
+GTI4 $748
+ADDRGP4 s_graphicsoptions+1112+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $749
+JUMPV
+LABELV $748
+ADDRGP4 s_graphicsoptions+1112+64
+INDIRI4
+CNSTI4 60
+GTI4 $754
+ADDRGP4 s_graphicsoptions+1112+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 $755
+JUMPV
+LABELV $754
+ADDRGP4 s_graphicsoptions+1112+64
+INDIRI4
+CNSTI4 85
+GTI4 $760
+ADDRGP4 s_graphicsoptions+1112+64
+CNSTI4 3
+ASGNI4
+ADDRGP4 $761
+JUMPV
+LABELV $760
+ADDRGP4 s_graphicsoptions+1112+64
+CNSTI4 4
+ASGNI4
+LABELV $761
+LABELV $755
+LABELV $749
+LABELV $745
+ADDRGP4 $591
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1400+64
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $552
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1304+64
+CNSTF4 1077936128
+ADDRLP4 24
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1304+64
+INDIRI4
+CNSTI4 0
+GEI4 $772
+ADDRGP4 s_graphicsoptions+1304+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $773
+JUMPV
+LABELV $772
+ADDRGP4 s_graphicsoptions+1304+64
+INDIRI4
+CNSTI4 3
+LEI4 $778
+ADDRGP4 s_graphicsoptions+1304+64
+CNSTI4 3
+ASGNI4
+LABELV $778
+LABELV $773
+ADDRGP4 $604
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+EQF4 $787
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $788
+JUMPV
+LABELV $787
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $788
+ADDRGP4 s_graphicsoptions+1496+64
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $607
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 0
+EQF4 $792
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $793
+JUMPV
+LABELV $792
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+LABELV $793
+ADDRGP4 s_graphicsoptions+1592+64
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $549
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 48
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 56
+CNSTI4 16
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $800
+ADDRLP4 44
+INDIRI4
+ADDRLP4 56
+INDIRI4
+GTI4 $807
+LABELV $806
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $797
+ADDRGP4 $794
+JUMPV
+LABELV $807
+ADDRLP4 44
+INDIRI4
+CNSTI4 32
+EQI4 $803
+ADDRGP4 $794
+JUMPV
+LABELV $794
+LABELV $797
+ADDRGP4 s_graphicsoptions+1688+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $795
+JUMPV
+LABELV $800
+ADDRGP4 s_graphicsoptions+1688+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $795
+JUMPV
+LABELV $803
+ADDRGP4 s_graphicsoptions+1688+64
+CNSTI4 2
+ASGNI4
+LABELV $795
+ADDRGP4 $633
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $808
+ADDRGP4 $639
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 68
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 76
+CNSTI4 8
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 76
+INDIRI4
+EQI4 $819
+ADDRLP4 64
+INDIRI4
+ADDRLP4 76
+INDIRI4
+GTI4 $826
+LABELV $825
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+EQI4 $813
+ADDRLP4 64
+INDIRI4
+CNSTI4 4
+EQI4 $816
+ADDRGP4 $810
+JUMPV
+LABELV $826
+ADDRLP4 64
+INDIRI4
+CNSTI4 16
+EQI4 $822
+ADDRGP4 $810
+JUMPV
+LABELV $810
+LABELV $813
+ADDRGP4 s_graphicsoptions+1976+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 $809
+JUMPV
+LABELV $816
+ADDRGP4 s_graphicsoptions+1976+64
+CNSTI4 3
+ASGNI4
+ADDRGP4 $809
+JUMPV
+LABELV $819
+ADDRGP4 s_graphicsoptions+1976+64
+CNSTI4 4
+ASGNI4
+ADDRGP4 $809
+JUMPV
+LABELV $822
+ADDRGP4 s_graphicsoptions+1976+64
+CNSTI4 5
+ASGNI4
+ADDRGP4 $809
+JUMPV
+LABELV $808
+ADDRGP4 $649
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 $651
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $827
+ADDRGP4 s_graphicsoptions+1976+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $828
+JUMPV
+LABELV $827
+ADDRGP4 s_graphicsoptions+1976+64
+CNSTI4 1
+ASGNI4
+LABELV $828
+LABELV $809
+ADDRGP4 $614
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 72
+INDIRF4
+CNSTF4 0
+LEF4 $833
+ADDRGP4 $615
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+CNSTF4 1101004800
+LTF4 $835
+ADDRGP4 s_graphicsoptions+1880+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $834
+JUMPV
+LABELV $835
+ADDRGP4 s_graphicsoptions+1880+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $834
+JUMPV
+LABELV $833
+ADDRGP4 $614
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 76
+INDIRF4
+CNSTF4 0
+NEF4 $841
+ADDRGP4 s_graphicsoptions+1880+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 $842
+JUMPV
+LABELV $841
+ADDRGP4 $615
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 80
+INDIRF4
+CNSTF4 1065353216
+NEF4 $845
+ADDRGP4 s_graphicsoptions+1880+64
+CNSTI4 4
+ASGNI4
+ADDRGP4 $846
+JUMPV
+LABELV $845
+ADDRGP4 s_graphicsoptions+1880+64
+CNSTI4 3
+ASGNI4
+LABELV $846
+LABELV $842
+LABELV $834
+ADDRGP4 $599
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 84
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 92
+CNSTI4 16
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $857
+ADDRLP4 80
+INDIRI4
+ADDRLP4 92
+INDIRI4
+GTI4 $864
+LABELV $863
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+EQI4 $854
+ADDRGP4 $851
+JUMPV
+LABELV $864
+ADDRLP4 80
+INDIRI4
+CNSTI4 32
+EQI4 $860
+ADDRGP4 $851
+JUMPV
+LABELV $851
+LABELV $854
+ADDRGP4 s_graphicsoptions+1784+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $852
+JUMPV
+LABELV $857
+ADDRGP4 s_graphicsoptions+1784+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $852
+JUMPV
+LABELV $860
+ADDRGP4 s_graphicsoptions+1784+64
+CNSTI4 2
+ASGNI4
+LABELV $852
+ADDRGP4 s_graphicsoptions+1400+64
+INDIRI4
+CNSTI4 0
+NEI4 $865
+ADDRGP4 s_graphicsoptions+1784+64
+CNSTI4 0
+ASGNI4
+LABELV $865
+ADDRGP4 $652
+ARGP4
+ADDRLP4 100
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $655
+ARGP4
+ADDRLP4 104
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+ADDRLP4 104
+INDIRI4
+LEI4 $872
+ADDRGP4 $652
+ARGP4
+ADDRLP4 108
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRGP4 $873
+JUMPV
+LABELV $872
+ADDRGP4 $655
+ARGP4
+ADDRLP4 112
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 112
+INDIRI4
+ASGNI4
+LABELV $873
+ADDRLP4 0
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+GEI4 $874
+ADDRGP4 s_graphicsoptions+2072+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $875
+JUMPV
+LABELV $874
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+GEI4 $878
+ADDRGP4 s_graphicsoptions+2072+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $879
+JUMPV
+LABELV $878
+ADDRGP4 s_graphicsoptions+2072+64
+CNSTI4 2
+ASGNI4
+LABELV $879
+LABELV $875
+LABELV $713
+endproc GraphicsOptions_SetMenuItems 1060 12
+proc GraphicsOptions_StatusBar 4 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 111
+EQI4 $888
+ADDRGP4 $886
+JUMPV
+LABELV $888
+CNSTI4 320
+ARGI4
+CNSTI4 410
+ARGI4
+ADDRGP4 $889
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 430
+ARGI4
+ADDRGP4 $890
+ARGP4
+CNSTI4 258
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $886
+LABELV $884
+endproc GraphicsOptions_StatusBar 4 20
+data
+align 4
+LABELV $892
+address $893
+address $894
+address $895
+byte 4 0
+align 4
+LABELV $896
+address $897
+address $898
+address $899
+address $900
+address $901
+address $902
+byte 4 0
+align 4
+LABELV $903
+address $904
+address $905
+address $906
+address $907
+address $908
+byte 4 0
+align 4
+LABELV $909
+address $910
+address $911
+byte 4 0
+align 4
+LABELV $912
+address $893
+address $894
+address $895
+byte 4 0
+align 4
+LABELV $913
+address $914
+address $915
+address $916
+address $917
+address $918
+address $919
+byte 4 0
+align 4
+LABELV $920
+address $921
+address $922
+address $923
+address $924
+address $925
+byte 4 0
+align 4
+LABELV $926
+address $927
+address $928
+byte 4 0
+align 4
+LABELV $929
+address $927
+address $930
+address $931
+byte 4 0
+align 4
+LABELV $932
+address $933
+address $934
+address $935
+address $936
+byte 4 0
+export GraphicsOptions_MenuInit
+code
+proc GraphicsOptions_MenuInit 4 12
+ADDRGP4 s_graphicsoptions
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2416
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 GraphicsOptions_GetResolutions
+CALLV
+pop
+ADDRGP4 GraphicsOptions_GetAspectRatios
+CALLV
+pop
+ADDRGP4 GraphicsOptions_Cache
+CALLV
+pop
+ADDRGP4 s_graphicsoptions+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+268
+ADDRGP4 GraphicsOptions_MenuDraw
+ASGNP4
+ADDRGP4 s_graphicsoptions+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_graphicsoptions+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_graphicsoptions+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_graphicsoptions+288+60
+ADDRGP4 $947
+ASGNP4
+ADDRGP4 s_graphicsoptions+288+68
+ADDRGP4 text_banner_color
+ASGNP4
+ADDRGP4 s_graphicsoptions+288+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_graphicsoptions+360
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+360+4
+ADDRGP4 $107
+ASGNP4
+ADDRGP4 s_graphicsoptions+360+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_graphicsoptions+360+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_graphicsoptions+360+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_graphicsoptions+360+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_graphicsoptions+360+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_graphicsoptions+448
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+448+4
+ADDRGP4 $108
+ASGNP4
+ADDRGP4 s_graphicsoptions+448+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_graphicsoptions+448+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_graphicsoptions+448+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_graphicsoptions+448+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_graphicsoptions+448+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_graphicsoptions+536
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+536+44
+CNSTU4 16
+ASGNU4
+ADDRGP4 s_graphicsoptions+536+8
+CNSTI4 106
+ASGNI4
+ADDRGP4 s_graphicsoptions+536+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+536+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+536+16
+CNSTI4 186
+ASGNI4
+ADDRGP4 s_graphicsoptions+536+60
+ADDRGP4 $991
+ASGNP4
+ADDRGP4 s_graphicsoptions+536+64
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+536+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRGP4 s_graphicsoptions+608
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+608+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_graphicsoptions+608+8
+CNSTI4 107
+ASGNI4
+ADDRGP4 s_graphicsoptions+608+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+608+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+608+16
+CNSTI4 213
+ASGNI4
+ADDRGP4 s_graphicsoptions+608+60
+ADDRGP4 $1009
+ASGNP4
+ADDRGP4 s_graphicsoptions+608+64
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+608+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRGP4 s_graphicsoptions+680
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+680+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_graphicsoptions+680+8
+CNSTI4 108
+ASGNI4
+ADDRGP4 s_graphicsoptions+680+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+680+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+680+16
+CNSTI4 240
+ASGNI4
+ADDRGP4 s_graphicsoptions+680+60
+ADDRGP4 $1027
+ASGNP4
+ADDRGP4 s_graphicsoptions+680+64
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+680+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRGP4 s_graphicsoptions+752
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+752+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_graphicsoptions+752+8
+CNSTI4 109
+ASGNI4
+ADDRGP4 s_graphicsoptions+752+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+752+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+752+16
+CNSTI4 267
+ASGNI4
+ADDRGP4 s_graphicsoptions+752+60
+ADDRGP4 $1045
+ASGNP4
+ADDRGP4 s_graphicsoptions+752+64
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+752+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRLP4 0
+CNSTI4 114
+ASGNI4
+ADDRGP4 s_graphicsoptions+824
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+824+4
+ADDRGP4 $1053
+ASGNP4
+ADDRGP4 s_graphicsoptions+824+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+824+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+824+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+824+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+824+8
+CNSTI4 103
+ASGNI4
+ADDRGP4 s_graphicsoptions+824+76
+ADDRGP4 $896
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 36
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+920
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+920+4
+ADDRGP4 $1069
+ASGNP4
+ADDRGP4 s_graphicsoptions+920+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+920+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+920+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+920+76
+ADDRGP4 ratios
+ASGNP4
+ADDRGP4 s_graphicsoptions+920+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+920+8
+CNSTI4 110
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1016
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1016+4
+ADDRGP4 $1085
+ASGNP4
+ADDRGP4 s_graphicsoptions+1016+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1016+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1016+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1016+76
+ADDRGP4 resolutions
+INDIRP4
+ASGNP4
+ADDRGP4 s_graphicsoptions+1016+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+1016+8
+CNSTI4 104
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1112
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1112+4
+ADDRGP4 $1101
+ASGNP4
+ADDRGP4 s_graphicsoptions+1112+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1112+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1112+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1112+76
+ADDRGP4 $903
+ASGNP4
+ADDRGP4 s_graphicsoptions+1112+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+1112+8
+CNSTI4 111
+ASGNI4
+ADDRGP4 s_graphicsoptions+1112+52
+ADDRGP4 GraphicsOptions_StatusBar
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1784
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1784+4
+ADDRGP4 $1119
+ASGNP4
+ADDRGP4 s_graphicsoptions+1784+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1784+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1784+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1784+76
+ADDRGP4 $912
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1400
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1400+4
+ADDRGP4 $1131
+ASGNP4
+ADDRGP4 s_graphicsoptions+1400+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1400+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1400+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1400+76
+ADDRGP4 $926
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2072
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+2072+4
+ADDRGP4 $1143
+ASGNP4
+ADDRGP4 s_graphicsoptions+2072+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+2072+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+2072+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2072+76
+ADDRGP4 $929
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1496
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1496+4
+ADDRGP4 $1155
+ASGNP4
+ADDRGP4 s_graphicsoptions+1496+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1496+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1496+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1496+76
+ADDRGP4 $909
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1592
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1592+4
+ADDRGP4 $1167
+ASGNP4
+ADDRGP4 s_graphicsoptions+1592+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1592+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1592+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1592+76
+ADDRGP4 $926
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1880
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1880+4
+ADDRGP4 $1179
+ASGNP4
+ADDRGP4 s_graphicsoptions+1880+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1880+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1880+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1880+76
+ADDRGP4 $920
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1304
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1304+4
+ADDRGP4 $1191
+ASGNP4
+ADDRGP4 s_graphicsoptions+1304+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1304+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1304+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1304+76
+ADDRGP4 $932
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1688
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1688+4
+ADDRGP4 $1203
+ASGNP4
+ADDRGP4 s_graphicsoptions+1688+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1688+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1688+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1688+76
+ADDRGP4 $892
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1976
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1976+4
+ADDRGP4 $1215
+ASGNP4
+ADDRGP4 s_graphicsoptions+1976+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1976+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1976+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1976+76
+ADDRGP4 $913
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2168
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+2168+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 s_graphicsoptions+2168+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+2168+8
+CNSTI4 105
+ASGNI4
+ADDRGP4 s_graphicsoptions+2168+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_graphicsoptions+2168+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2168+60
+ADDRGP4 $1237
+ASGNP4
+ADDRGP4 s_graphicsoptions+2168+64
+CNSTI4 258
+ASGNI4
+ADDRGP4 s_graphicsoptions+2168+68
+ADDRGP4 text_big_color
+ASGNP4
+ADDRGP4 s_graphicsoptions+2328
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+2328+4
+ADDRGP4 $109
+ASGNP4
+ADDRGP4 s_graphicsoptions+2328+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_graphicsoptions+2328+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+2328+8
+CNSTI4 101
+ASGNI4
+ADDRGP4 s_graphicsoptions+2328+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_graphicsoptions+2328+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_graphicsoptions+2328+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_graphicsoptions+2328+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_graphicsoptions+2328+60
+ADDRGP4 $110
+ASGNP4
+ADDRGP4 s_graphicsoptions+2240
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+2240+4
+ADDRGP4 $1264
+ASGNP4
+ADDRGP4 s_graphicsoptions+2240+44
+CNSTU4 20752
+ASGNU4
+ADDRGP4 s_graphicsoptions+2240+48
+ADDRGP4 GraphicsOptions_ApplyChanges
+ASGNP4
+ADDRGP4 s_graphicsoptions+2240+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_graphicsoptions+2240+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_graphicsoptions+2240+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_graphicsoptions+2240+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_graphicsoptions+2240+60
+ADDRGP4 $1279
+ASGNP4
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+608
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+680
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+752
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+824
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+920
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1016
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1112
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1784
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1400
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+2072
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1496
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1592
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1880
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1304
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1688
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1976
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+2168
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+2328
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+2240
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 GraphicsOptions_SetMenuItems
+CALLV
+pop
+ADDRGP4 GraphicsOptions_GetInitialVideo
+CALLV
+pop
+LABELV $891
+endproc GraphicsOptions_MenuInit 4 12
+export GraphicsOptions_Cache
+proc GraphicsOptions_Cache 0 4
+ADDRGP4 $107
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $108
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $109
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $110
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1264
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1279
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1303
+endproc GraphicsOptions_Cache 0 4
+export UI_GraphicsOptionsMenu
+proc UI_GraphicsOptionsMenu 0 8
+ADDRGP4 GraphicsOptions_MenuInit
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+536
+ARGP4
+ADDRGP4 Menu_SetCursorToItem
+CALLV
+pop
+LABELV $1304
+endproc UI_GraphicsOptionsMenu 0 8
+bss
+align 1
+LABELV currentResolution
+skip 20
+align 4
+LABELV detectedResolutions
+skip 128
+align 1
+LABELV resbuf
+skip 1024
+align 4
+LABELV resToRatio
+skip 128
+align 4
+LABELV ratioToRes
+skip 128
+align 1
+LABELV ratioBuf
+skip 448
+align 4
+LABELV ratios
+skip 128
+align 4
+LABELV s_graphicsoptions
+skip 2416
+align 4
+LABELV s_ivo
+skip 44
+align 4
+LABELV s_driverinfo
+skip 1908
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPMap_f
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_MaxSplitView
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_CursorInRect
+import UI_DrawChar
+import UI_MField_Draw
+import UI_DrawStrlen
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_InitPropFont
+import UI_InitBannerFont
+import UI_LerpColor
+import UI_RegisterPlayerModelname
+import UI_PlayerInfo_UpdateColor
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import UI_Joystick_Cache
+import UI_JoystickMenu
+import Controls_WantsBindKeys
+import Controls_Cache
+import UI_ControlsMenu
+import UI_SelectPlayer_Cache
+import UI_SelectPlayerMenu
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import InSelectPlayerMenu
+import InSelectPlayer_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_small_title_color
+import text_big_color
+import text_banner_color
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_menuFontBanner
+import ui_menuFontProp
+import ui_menuFont
+import ui_ioq3
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserSeparateMasters
+import ui_browserShowBots
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserGame
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_publicServer
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import UI_DrawProportionalString
+import UI_WindowResized
+import UI_WantsBindKeys
+import UI_DrawConnectScreen
+import UI_ConsoleCommand
+import UI_SetActiveMenu
+import UI_Refresh
+import UI_IsFullscreen
+import UI_SetCursorPos
+import UI_GetCursorPos
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import ui_numCommands
+import ui_commands
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_drawScores
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1279
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1264
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1237
+byte 1 68
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $1215
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $1203
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $1191
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $1179
+byte 1 71
+byte 1 101
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $1167
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $1155
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 0
+align 1
+LABELV $1143
+byte 1 65
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 45
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 0
+align 1
+LABELV $1131
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 0
+align 1
+LABELV $1119
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 104
+byte 1 58
+byte 1 0
+align 1
+LABELV $1101
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 82
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $1085
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 0
+align 1
+LABELV $1069
+byte 1 65
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 58
+byte 1 0
+align 1
+LABELV $1053
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $1045
+byte 1 78
+byte 1 69
+byte 1 84
+byte 1 87
+byte 1 79
+byte 1 82
+byte 1 75
+byte 1 0
+align 1
+LABELV $1027
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $1009
+byte 1 68
+byte 1 73
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 0
+align 1
+LABELV $991
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 80
+byte 1 72
+byte 1 73
+byte 1 67
+byte 1 83
+byte 1 0
+align 1
+LABELV $947
+byte 1 83
+byte 1 89
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 32
+byte 1 83
+byte 1 69
+byte 1 84
+byte 1 85
+byte 1 80
+byte 1 0
+align 1
+LABELV $936
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 37
+byte 1 0
+align 1
+LABELV $935
+byte 1 53
+byte 1 48
+byte 1 37
+byte 1 0
+align 1
+LABELV $934
+byte 1 50
+byte 1 53
+byte 1 37
+byte 1 0
+align 1
+LABELV $933
+byte 1 49
+byte 1 51
+byte 1 37
+byte 1 0
+align 1
+LABELV $931
+byte 1 52
+byte 1 120
+byte 1 32
+byte 1 77
+byte 1 83
+byte 1 65
+byte 1 65
+byte 1 0
+align 1
+LABELV $930
+byte 1 50
+byte 1 120
+byte 1 32
+byte 1 77
+byte 1 83
+byte 1 65
+byte 1 65
+byte 1 0
+align 1
+LABELV $928
+byte 1 79
+byte 1 110
+byte 1 0
+align 1
+LABELV $927
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $925
+byte 1 86
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 0
+align 1
+LABELV $924
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 0
+align 1
+LABELV $923
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $922
+byte 1 77
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $921
+byte 1 76
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $919
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 49
+byte 1 54
+byte 1 120
+byte 1 0
+align 1
+LABELV $918
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 56
+byte 1 120
+byte 1 0
+align 1
+LABELV $917
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 52
+byte 1 120
+byte 1 0
+align 1
+LABELV $916
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 50
+byte 1 120
+byte 1 0
+align 1
+LABELV $915
+byte 1 84
+byte 1 114
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $914
+byte 1 66
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $911
+byte 1 86
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 32
+byte 1 40
+byte 1 76
+byte 1 111
+byte 1 119
+byte 1 41
+byte 1 0
+align 1
+LABELV $910
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 40
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 41
+byte 1 0
+align 1
+LABELV $908
+byte 1 49
+byte 1 50
+byte 1 53
+byte 1 32
+byte 1 72
+byte 1 122
+byte 1 0
+align 1
+LABELV $907
+byte 1 56
+byte 1 53
+byte 1 32
+byte 1 72
+byte 1 122
+byte 1 0
+align 1
+LABELV $906
+byte 1 54
+byte 1 48
+byte 1 32
+byte 1 72
+byte 1 122
+byte 1 0
+align 1
+LABELV $905
+byte 1 51
+byte 1 48
+byte 1 32
+byte 1 72
+byte 1 122
+byte 1 0
+align 1
+LABELV $904
+byte 1 86
+byte 1 45
+byte 1 83
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 0
+align 1
+LABELV $902
+byte 1 67
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $901
+byte 1 70
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $900
+byte 1 70
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $899
+byte 1 78
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $898
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $897
+byte 1 86
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $895
+byte 1 51
+byte 1 50
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $894
+byte 1 49
+byte 1 54
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $893
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $890
+byte 1 49
+byte 1 50
+byte 1 53
+byte 1 72
+byte 1 122
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $889
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $658
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $655
+byte 1 114
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $652
+byte 1 114
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $651
+byte 1 71
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 80
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 95
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 0
+align 1
+LABELV $650
+byte 1 71
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 80
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 0
+align 1
+LABELV $649
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $639
+byte 1 114
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 121
+byte 1 0
+align 1
+LABELV $633
+byte 1 114
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $616
+byte 1 114
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 67
+byte 1 117
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $615
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 98
+byte 1 100
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $614
+byte 1 114
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 66
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 0
+align 1
+LABELV $607
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $604
+byte 1 114
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $601
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 105
+byte 1 108
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $600
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 104
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $599
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $591
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $585
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $584
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 119
+byte 1 97
+byte 1 112
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $576
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $575
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $574
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $552
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 109
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $549
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $386
+byte 1 37
+byte 1 100
+byte 1 120
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $373
+byte 1 65
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 120
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $369
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $326
+byte 1 65
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 0
+align 1
+LABELV $307
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $278
+byte 1 49
+byte 1 54
+byte 1 58
+byte 1 57
+byte 1 0
+align 1
+LABELV $277
+byte 1 49
+byte 1 46
+byte 1 55
+byte 1 56
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $276
+byte 1 53
+byte 1 58
+byte 1 51
+byte 1 0
+align 1
+LABELV $275
+byte 1 49
+byte 1 46
+byte 1 54
+byte 1 55
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $274
+byte 1 49
+byte 1 54
+byte 1 58
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $273
+byte 1 49
+byte 1 46
+byte 1 54
+byte 1 48
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $272
+byte 1 49
+byte 1 52
+byte 1 58
+byte 1 57
+byte 1 0
+align 1
+LABELV $271
+byte 1 49
+byte 1 46
+byte 1 53
+byte 1 54
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $270
+byte 1 51
+byte 1 58
+byte 1 50
+byte 1 0
+align 1
+LABELV $269
+byte 1 49
+byte 1 46
+byte 1 53
+byte 1 48
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $268
+byte 1 52
+byte 1 58
+byte 1 51
+byte 1 0
+align 1
+LABELV $267
+byte 1 49
+byte 1 46
+byte 1 51
+byte 1 51
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $266
+byte 1 53
+byte 1 58
+byte 1 52
+byte 1 0
+align 1
+LABELV $265
+byte 1 49
+byte 1 46
+byte 1 50
+byte 1 53
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $264
+byte 1 56
+byte 1 53
+byte 1 54
+byte 1 120
+byte 1 52
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $263
+byte 1 50
+byte 1 48
+byte 1 52
+byte 1 56
+byte 1 120
+byte 1 49
+byte 1 53
+byte 1 51
+byte 1 54
+byte 1 0
+align 1
+LABELV $262
+byte 1 49
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $261
+byte 1 49
+byte 1 50
+byte 1 56
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 48
+byte 1 50
+byte 1 52
+byte 1 0
+align 1
+LABELV $260
+byte 1 49
+byte 1 49
+byte 1 53
+byte 1 50
+byte 1 120
+byte 1 56
+byte 1 54
+byte 1 52
+byte 1 0
+align 1
+LABELV $259
+byte 1 49
+byte 1 48
+byte 1 50
+byte 1 52
+byte 1 120
+byte 1 55
+byte 1 54
+byte 1 56
+byte 1 0
+align 1
+LABELV $258
+byte 1 57
+byte 1 54
+byte 1 48
+byte 1 120
+byte 1 55
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $257
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $256
+byte 1 54
+byte 1 52
+byte 1 48
+byte 1 120
+byte 1 52
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $255
+byte 1 53
+byte 1 49
+byte 1 50
+byte 1 120
+byte 1 51
+byte 1 56
+byte 1 52
+byte 1 0
+align 1
+LABELV $254
+byte 1 52
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 51
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $253
+byte 1 51
+byte 1 50
+byte 1 48
+byte 1 120
+byte 1 50
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $166
+byte 1 68
+byte 1 82
+byte 1 73
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 73
+byte 1 78
+byte 1 70
+byte 1 79
+byte 1 0
+align 1
+LABELV $128
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 90
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 105
+byte 1 108
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 0
+align 1
+LABELV $122
+byte 1 69
+byte 1 88
+byte 1 84
+byte 1 69
+byte 1 78
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 83
+byte 1 0
+align 1
+LABELV $121
+byte 1 80
+byte 1 73
+byte 1 88
+byte 1 69
+byte 1 76
+byte 1 70
+byte 1 79
+byte 1 82
+byte 1 77
+byte 1 65
+byte 1 84
+byte 1 0
+align 1
+LABELV $120
+byte 1 86
+byte 1 69
+byte 1 78
+byte 1 68
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $110
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $109
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $108
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $107
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 50
+byte 1 95
+byte 1 108
+byte 1 0
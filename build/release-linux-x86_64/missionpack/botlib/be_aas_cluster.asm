@@ -0,0 +1,5194 @@
+data
+export nofaceflood
+align 4
+LABELV nofaceflood
+byte 4 1
+export AAS_RemoveClusterAreas
+code
+proc AAS_RemoveClusterAreas 4 0
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $29
+JUMPV
+LABELV $26
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $27
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $29
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $26
+LABELV $25
+endproc AAS_RemoveClusterAreas 4 0
+export AAS_ClearCluster
+proc AAS_ClearCluster 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $36
+JUMPV
+LABELV $33
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $38
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $38
+LABELV $34
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $36
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $33
+LABELV $32
+endproc AAS_ClearCluster 4 0
+export AAS_RemovePortalsClusterReference
+proc AAS_RemovePortalsClusterReference 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $46
+JUMPV
+LABELV $43
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $48
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $48
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $52
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $52
+LABELV $44
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $46
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+256
+INDIRI4
+LTI4 $43
+LABELV $42
+endproc AAS_RemovePortalsClusterReference 4 0
+export AAS_UpdatePortal
+proc AAS_UpdatePortal 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $60
+JUMPV
+LABELV $57
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $62
+ADDRGP4 $59
+JUMPV
+LABELV $62
+LABELV $58
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $60
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+256
+INDIRI4
+LTI4 $57
+LABELV $59
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+256
+INDIRI4
+NEI4 $65
+ADDRGP4 $68
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 AAS_Error
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $56
+JUMPV
+LABELV $65
+ADDRLP4 4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $70
+CNSTI4 1
+RETI4
+ADDRGP4 $56
+JUMPV
+LABELV $70
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $72
+CNSTI4 1
+RETI4
+ADDRGP4 $56
+JUMPV
+LABELV $72
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $74
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $75
+JUMPV
+LABELV $74
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $76
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $77
+JUMPV
+LABELV $76
+ADDRLP4 12
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+ADDRGP4 $79
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Log_Write
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $56
+JUMPV
+LABELV $77
+LABELV $75
+ADDRGP4 aasworld+264
+INDIRI4
+CNSTI4 65536
+LTI4 $80
+ADDRGP4 $83
+ARGP4
+ADDRGP4 AAS_Error
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $56
+JUMPV
+LABELV $80
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRI4
+NEGI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+268
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 aasworld+264
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $56
+endproc AAS_UpdatePortal 24 8
+export AAS_FloodClusterAreas_r
+proc AAS_FloodClusterAreas_r 32 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $92
+ADDRFP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $89
+LABELV $92
+ADDRGP4 $93
+ARGP4
+ADDRGP4 AAS_Error
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $88
+JUMPV
+LABELV $89
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $94
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $97
+CNSTI4 1
+RETI4
+ADDRGP4 $88
+JUMPV
+LABELV $97
+ADDRGP4 $100
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 AAS_Error
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $88
+JUMPV
+LABELV $94
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $102
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 AAS_UpdatePortal
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $88
+JUMPV
+LABELV $102
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 nofaceflood
+INDIRI4
+CNSTI4 0
+NEI4 $110
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $115
+JUMPV
+LABELV $112
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 24
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $118
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $119
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 AAS_FloodClusterAreas_r
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $119
+CNSTI4 0
+RETI4
+ADDRGP4 $88
+JUMPV
+LABELV $118
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $124
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 AAS_FloodClusterAreas_r
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $126
+CNSTI4 0
+RETI4
+ADDRGP4 $88
+JUMPV
+LABELV $126
+LABELV $124
+LABELV $119
+LABELV $113
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $115
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $112
+LABELV $110
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $131
+JUMPV
+LABELV $128
+CNSTI4 44
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $133
+ADDRGP4 $129
+JUMPV
+LABELV $133
+CNSTI4 44
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 AAS_FloodClusterAreas_r
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $137
+CNSTI4 0
+RETI4
+ADDRGP4 $88
+JUMPV
+LABELV $137
+LABELV $129
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $131
+ADDRLP4 0
+INDIRI4
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+LTI4 $128
+CNSTI4 1
+RETI4
+LABELV $88
+endproc AAS_FloodClusterAreas_r 32 16
+export AAS_FloodClusterAreasUsingReachabilities
+proc AAS_FloodClusterAreasUsingReachabilities 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $145
+JUMPV
+LABELV $142
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $147
+ADDRGP4 $143
+JUMPV
+LABELV $147
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $150
+ADDRGP4 $143
+JUMPV
+LABELV $150
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $156
+JUMPV
+LABELV $153
+ADDRLP4 12
+CNSTI4 28
+ASGNI4
+ADDRLP4 8
+CNSTI4 44
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $160
+ADDRGP4 $154
+JUMPV
+LABELV $160
+CNSTI4 28
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $163
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 AAS_FloodClusterAreas_r
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $166
+CNSTI4 0
+RETI4
+ADDRGP4 $141
+JUMPV
+LABELV $166
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $155
+JUMPV
+LABELV $163
+LABELV $154
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $156
+ADDRLP4 4
+INDIRI4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+LTI4 $153
+LABELV $155
+LABELV $143
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $145
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $142
+CNSTI4 1
+RETI4
+LABELV $141
+endproc AAS_FloodClusterAreasUsingReachabilities 20 8
+export AAS_NumberClusterPortals
+proc AAS_NumberClusterPortals 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $173
+JUMPV
+LABELV $170
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+268
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 20
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $176
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $177
+JUMPV
+LABELV $176
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $177
+LABELV $171
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $173
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $170
+LABELV $168
+endproc AAS_NumberClusterPortals 24 0
+export AAS_NumberClusterAreas
+proc AAS_NumberClusterAreas 40 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $184
+JUMPV
+LABELV $181
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $186
+ADDRGP4 $182
+JUMPV
+LABELV $186
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $189
+ADDRGP4 $182
+JUMPV
+LABELV $189
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $182
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $184
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $181
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $199
+JUMPV
+LABELV $196
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+268
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 20
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $202
+ADDRGP4 $197
+JUMPV
+LABELV $202
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $204
+ADDRLP4 24
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $205
+JUMPV
+LABELV $204
+ADDRLP4 24
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $205
+LABELV $197
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $199
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $196
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $211
+JUMPV
+LABELV $208
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $213
+ADDRGP4 $209
+JUMPV
+LABELV $213
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $216
+ADDRGP4 $209
+JUMPV
+LABELV $216
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $209
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $211
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $208
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $225
+JUMPV
+LABELV $222
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+268
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 20
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $228
+ADDRGP4 $223
+JUMPV
+LABELV $228
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $230
+ADDRLP4 24
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $231
+JUMPV
+LABELV $230
+ADDRLP4 24
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $231
+LABELV $223
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $225
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $222
+LABELV $178
+endproc AAS_NumberClusterAreas 40 4
+export AAS_FindClusters
+proc AAS_FindClusters 20 8
+ADDRGP4 AAS_RemoveClusterAreas
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $236
+JUMPV
+LABELV $233
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $238
+ADDRGP4 $234
+JUMPV
+LABELV $238
+ADDRGP4 nofaceflood
+INDIRI4
+CNSTI4 0
+EQI4 $241
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $243
+ADDRGP4 $234
+JUMPV
+LABELV $243
+LABELV $241
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $246
+ADDRGP4 $234
+JUMPV
+LABELV $246
+ADDRGP4 aasworld+272
+INDIRI4
+CNSTI4 65536
+LTI4 $249
+ADDRGP4 $252
+ARGP4
+ADDRGP4 AAS_Error
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $232
+JUMPV
+LABELV $249
+ADDRLP4 4
+ADDRGP4 aasworld+272
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 aasworld+264
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 aasworld+272
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 AAS_FloodClusterAreas_r
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $256
+CNSTI4 0
+RETI4
+ADDRGP4 $232
+JUMPV
+LABELV $256
+ADDRGP4 aasworld+272
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 AAS_FloodClusterAreasUsingReachabilities
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $259
+CNSTI4 0
+RETI4
+ADDRGP4 $232
+JUMPV
+LABELV $259
+ADDRGP4 aasworld+272
+INDIRI4
+ARGI4
+ADDRGP4 AAS_NumberClusterAreas
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 aasworld+272
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $234
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $236
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $233
+CNSTI4 1
+RETI4
+LABELV $232
+endproc AAS_FindClusters 20 8
+export AAS_CreatePortals
+proc AAS_CreatePortals 12 4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $268
+JUMPV
+LABELV $265
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $270
+ADDRGP4 aasworld+256
+INDIRI4
+CNSTI4 65536
+LTI4 $273
+ADDRGP4 $276
+ARGP4
+ADDRGP4 AAS_Error
+CALLV
+pop
+ADDRGP4 $264
+JUMPV
+LABELV $273
+ADDRLP4 4
+CNSTI4 20
+ADDRGP4 aasworld+256
+INDIRI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRGP4 aasworld+256
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $270
+LABELV $266
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $268
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $265
+LABELV $264
+endproc AAS_CreatePortals 12 4
+export AAS_ConnectedAreas_r
+proc AAS_ConnectedAreas_r 28 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+CNSTI4 48
+ADDRFP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $285
+JUMPV
+LABELV $282
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 24
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $288
+ADDRGP4 $283
+JUMPV
+LABELV $288
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI4
+EQI4 $290
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $291
+JUMPV
+LABELV $290
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $291
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $295
+JUMPV
+LABELV $292
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $296
+ADDRGP4 $294
+JUMPV
+LABELV $296
+LABELV $293
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $295
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $292
+LABELV $294
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $298
+ADDRGP4 $283
+JUMPV
+LABELV $298
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $300
+ADDRGP4 $283
+JUMPV
+LABELV $300
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 AAS_ConnectedAreas_r
+CALLV
+pop
+LABELV $283
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $285
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $282
+LABELV $280
+endproc AAS_ConnectedAreas_r 28 16
+export AAS_ConnectedAreas
+proc AAS_ConnectedAreas 4100 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4096
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+GEI4 $303
+CNSTI4 0
+RETI4
+ADDRGP4 $302
+JUMPV
+LABELV $303
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $305
+CNSTI4 1
+RETI4
+ADDRGP4 $302
+JUMPV
+LABELV $305
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 AAS_ConnectedAreas_r
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $310
+JUMPV
+LABELV $307
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $311
+CNSTI4 0
+RETI4
+ADDRGP4 $302
+JUMPV
+LABELV $311
+LABELV $308
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $310
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $307
+CNSTI4 1
+RETI4
+LABELV $302
+endproc AAS_ConnectedAreas 4100 16
+export AAS_GetAdjacentAreasWithLessPresenceTypes_r
+proc AAS_GetAdjacentAreasWithLessPresenceTypes_r 60 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 48
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 28
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $319
+JUMPV
+LABELV $316
+ADDRLP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 24
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $322
+ADDRGP4 $317
+JUMPV
+LABELV $322
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+EQI4 $324
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $325
+JUMPV
+LABELV $324
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $325
+ADDRLP4 16
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 16
+INDIRI4
+BCOMI4
+BANDI4
+ADDRLP4 52
+INDIRI4
+EQI4 $327
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+BCOMI4
+BANDI4
+ADDRLP4 52
+INDIRI4
+NEI4 $327
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $332
+JUMPV
+LABELV $329
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI4
+NEI4 $333
+ADDRGP4 $331
+JUMPV
+LABELV $333
+LABELV $330
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $332
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $329
+LABELV $331
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $335
+ADDRFP4 4
+INDIRI4
+CNSTI4 1024
+LTI4 $337
+ADDRGP4 $339
+ARGP4
+ADDRGP4 AAS_Error
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+RETI4
+ADDRGP4 $313
+JUMPV
+LABELV $337
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 AAS_GetAdjacentAreasWithLessPresenceTypes_r
+CALLI4
+ASGNI4
+ADDRFP4 4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+LABELV $335
+LABELV $327
+LABELV $317
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $319
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $316
+ADDRFP4 4
+INDIRI4
+RETI4
+LABELV $313
+endproc AAS_GetAdjacentAreasWithLessPresenceTypes_r 60 12
+export AAS_CheckAreaForPossiblePortals
+proc AAS_CheckAreaForPossiblePortals 28792 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $341
+CNSTI4 0
+RETI4
+ADDRGP4 $340
+JUMPV
+LABELV $341
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $344
+CNSTI4 0
+RETI4
+ADDRGP4 $340
+JUMPV
+LABELV $344
+ADDRLP4 16464
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4096
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 24660
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4096
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 28756
+CNSTI4 0
+ASGNI4
+ADDRLP4 4132
+ADDRLP4 28756
+INDIRI4
+ASGNI4
+ADDRLP4 20560
+ADDRLP4 28756
+INDIRI4
+ASGNI4
+ADDRLP4 12344
+ADDRLP4 28756
+INDIRI4
+ASGNI4
+ADDRLP4 8236
+ADDRLP4 28756
+INDIRI4
+ASGNI4
+ADDRLP4 28760
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16460
+ADDRLP4 28760
+INDIRI4
+ASGNI4
+ADDRLP4 16448
+ADDRLP4 28760
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ARGP4
+ADDRLP4 28756
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28764
+ADDRGP4 AAS_GetAdjacentAreasWithLessPresenceTypes_r
+CALLI4
+ASGNI4
+ADDRLP4 4128
+ADDRLP4 28764
+INDIRI4
+ASGNI4
+ADDRLP4 4124
+CNSTI4 0
+ASGNI4
+ADDRGP4 $350
+JUMPV
+LABELV $347
+ADDRLP4 16456
+CNSTI4 48
+ADDRLP4 4124
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 28
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $355
+JUMPV
+LABELV $352
+ADDRLP4 16456
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28768
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 12348
+ADDRLP4 28768
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 24
+ADDRLP4 12348
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $358
+ADDRGP4 $353
+JUMPV
+LABELV $358
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $363
+JUMPV
+LABELV $360
+ADDRLP4 16
+INDIRI4
+ADDRLP4 4124
+INDIRI4
+NEI4 $364
+ADDRGP4 $361
+JUMPV
+LABELV $364
+ADDRLP4 28776
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 28776
+INDIRI4
+EQI4 $368
+ADDRLP4 24
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 28776
+INDIRI4
+NEI4 $366
+LABELV $368
+ADDRGP4 $362
+JUMPV
+LABELV $366
+LABELV $361
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $363
+ADDRLP4 16
+INDIRI4
+ADDRLP4 4128
+INDIRI4
+LTI4 $360
+LABELV $362
+ADDRLP4 16
+INDIRI4
+ADDRLP4 4128
+INDIRI4
+EQI4 $369
+ADDRGP4 $353
+JUMPV
+LABELV $369
+ADDRLP4 24
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 4124
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 28
+ADDP4
+INDIRI4
+NEI4 $371
+ADDRLP4 8232
+ADDRLP4 24
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $372
+JUMPV
+LABELV $371
+ADDRLP4 8232
+ADDRLP4 24
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $372
+CNSTI4 28
+ADDRLP4 8232
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $373
+CNSTI4 0
+RETI4
+ADDRGP4 $340
+JUMPV
+LABELV $373
+ADDRLP4 12336
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRLP4 16448
+INDIRI4
+CNSTI4 0
+LTI4 $378
+ADDRLP4 12336
+INDIRI4
+ADDRLP4 16448
+INDIRI4
+NEI4 $376
+LABELV $378
+ADDRLP4 16448
+ADDRLP4 12336
+INDIRI4
+ASGNI4
+ADDRLP4 28776
+ADDRLP4 20560
+INDIRI4
+ASGNI4
+ADDRLP4 20560
+ADDRLP4 28776
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28776
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20564
+ADDP4
+ADDRLP4 12348
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $382
+JUMPV
+LABELV $379
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8240
+ADDP4
+INDIRI4
+ADDRLP4 8232
+INDIRI4
+NEI4 $383
+ADDRGP4 $381
+JUMPV
+LABELV $383
+LABELV $380
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $382
+ADDRLP4 16
+INDIRI4
+ADDRLP4 8236
+INDIRI4
+LTI4 $379
+LABELV $381
+ADDRLP4 16
+INDIRI4
+ADDRLP4 8236
+INDIRI4
+NEI4 $385
+ADDRLP4 28780
+ADDRLP4 8236
+INDIRI4
+ASGNI4
+ADDRLP4 8236
+ADDRLP4 28780
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28780
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8240
+ADDP4
+ADDRLP4 8232
+INDIRI4
+ASGNI4
+LABELV $385
+ADDRLP4 28784
+ADDRLP4 4124
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16464
+ADDP4
+ASGNP4
+ADDRLP4 28784
+INDIRP4
+ADDRLP4 28784
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $377
+JUMPV
+LABELV $376
+ADDRLP4 16460
+INDIRI4
+CNSTI4 0
+LTI4 $389
+ADDRLP4 12336
+INDIRI4
+ADDRLP4 16460
+INDIRI4
+NEI4 $387
+LABELV $389
+ADDRLP4 16460
+ADDRLP4 12336
+INDIRI4
+ASGNI4
+ADDRLP4 28780
+ADDRLP4 4132
+INDIRI4
+ASGNI4
+ADDRLP4 4132
+ADDRLP4 28780
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28780
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4136
+ADDP4
+ADDRLP4 12348
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $393
+JUMPV
+LABELV $390
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12352
+ADDP4
+INDIRI4
+ADDRLP4 8232
+INDIRI4
+NEI4 $394
+ADDRGP4 $392
+JUMPV
+LABELV $394
+LABELV $391
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $393
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12344
+INDIRI4
+LTI4 $390
+LABELV $392
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12344
+INDIRI4
+NEI4 $396
+ADDRLP4 28784
+ADDRLP4 12344
+INDIRI4
+ASGNI4
+ADDRLP4 12344
+ADDRLP4 28784
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28784
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12352
+ADDP4
+ADDRLP4 8232
+INDIRI4
+ASGNI4
+LABELV $396
+ADDRLP4 28788
+ADDRLP4 4124
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 24660
+ADDP4
+ASGNP4
+ADDRLP4 28788
+INDIRP4
+ADDRLP4 28788
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $388
+JUMPV
+LABELV $387
+CNSTI4 0
+RETI4
+ADDRGP4 $340
+JUMPV
+LABELV $388
+LABELV $377
+LABELV $353
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $355
+ADDRLP4 20
+INDIRI4
+ADDRLP4 16456
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $352
+LABELV $348
+ADDRLP4 4124
+ADDRLP4 4124
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $350
+ADDRLP4 4124
+INDIRI4
+ADDRLP4 4128
+INDIRI4
+LTI4 $347
+ADDRLP4 4124
+CNSTI4 0
+ASGNI4
+ADDRGP4 $401
+JUMPV
+LABELV $398
+ADDRLP4 28768
+ADDRLP4 4124
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28772
+CNSTI4 0
+ASGNI4
+ADDRLP4 28768
+INDIRI4
+ADDRLP4 16464
+ADDP4
+INDIRI4
+ADDRLP4 28772
+INDIRI4
+EQI4 $404
+ADDRLP4 28768
+INDIRI4
+ADDRLP4 24660
+ADDP4
+INDIRI4
+ADDRLP4 28772
+INDIRI4
+NEI4 $402
+LABELV $404
+CNSTI4 0
+RETI4
+ADDRGP4 $340
+JUMPV
+LABELV $402
+LABELV $399
+ADDRLP4 4124
+ADDRLP4 4124
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $401
+ADDRLP4 4124
+INDIRI4
+ADDRLP4 4128
+INDIRI4
+LTI4 $398
+ADDRLP4 8240
+ARGP4
+ADDRLP4 8236
+INDIRI4
+ARGI4
+ADDRLP4 28768
+ADDRGP4 AAS_ConnectedAreas
+CALLI4
+ASGNI4
+ADDRLP4 28768
+INDIRI4
+CNSTI4 0
+NEI4 $405
+CNSTI4 0
+RETI4
+ADDRGP4 $340
+JUMPV
+LABELV $405
+ADDRLP4 12352
+ARGP4
+ADDRLP4 12344
+INDIRI4
+ARGI4
+ADDRLP4 28772
+ADDRGP4 AAS_ConnectedAreas
+CALLI4
+ASGNI4
+ADDRLP4 28772
+INDIRI4
+CNSTI4 0
+NEI4 $407
+CNSTI4 0
+RETI4
+ADDRGP4 $340
+JUMPV
+LABELV $407
+ADDRLP4 4124
+CNSTI4 0
+ASGNI4
+ADDRGP4 $412
+JUMPV
+LABELV $409
+ADDRLP4 16452
+CNSTI4 24
+ADDRLP4 4124
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20564
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12340
+CNSTI4 0
+ASGNI4
+ADDRGP4 $417
+JUMPV
+LABELV $414
+ADDRLP4 16452
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 12340
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28776
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 28776
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $422
+JUMPV
+LABELV $419
+ADDRLP4 4
+CNSTI4 24
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4136
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $427
+JUMPV
+LABELV $424
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28780
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28780
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $429
+ADDRGP4 $426
+JUMPV
+LABELV $429
+LABELV $425
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $427
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $424
+LABELV $426
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+EQI4 $431
+ADDRGP4 $421
+JUMPV
+LABELV $431
+LABELV $420
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $422
+ADDRLP4 20
+INDIRI4
+ADDRLP4 4132
+INDIRI4
+LTI4 $419
+LABELV $421
+ADDRLP4 20
+INDIRI4
+ADDRLP4 4132
+INDIRI4
+EQI4 $433
+ADDRGP4 $416
+JUMPV
+LABELV $433
+LABELV $415
+ADDRLP4 12340
+ADDRLP4 12340
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $417
+ADDRLP4 12340
+INDIRI4
+ADDRLP4 16452
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $414
+LABELV $416
+ADDRLP4 12340
+INDIRI4
+ADDRLP4 16452
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+EQI4 $435
+ADDRGP4 $411
+JUMPV
+LABELV $435
+LABELV $410
+ADDRLP4 4124
+ADDRLP4 4124
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $412
+ADDRLP4 4124
+INDIRI4
+ADDRLP4 20560
+INDIRI4
+LTI4 $409
+LABELV $411
+ADDRLP4 4124
+INDIRI4
+ADDRLP4 20560
+INDIRI4
+EQI4 $437
+CNSTI4 0
+RETI4
+ADDRGP4 $340
+JUMPV
+LABELV $437
+ADDRLP4 4124
+CNSTI4 0
+ASGNI4
+ADDRGP4 $442
+JUMPV
+LABELV $439
+ADDRLP4 28776
+CNSTI4 28
+ADDRLP4 4124
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 28
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 28776
+INDIRP4
+ADDRLP4 28776
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRLP4 28780
+CNSTI4 28
+ADDRLP4 4124
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 28
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 28780
+INDIRP4
+ADDRLP4 28780
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRGP4 $445
+ARGP4
+ADDRLP4 4124
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Log_Write
+CALLV
+pop
+LABELV $440
+ADDRLP4 4124
+ADDRLP4 4124
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $442
+ADDRLP4 4124
+INDIRI4
+ADDRLP4 4128
+INDIRI4
+LTI4 $439
+ADDRLP4 4128
+INDIRI4
+RETI4
+LABELV $340
+endproc AAS_CheckAreaForPossiblePortals 28792 12
+export AAS_FindPossiblePortals
+proc AAS_FindPossiblePortals 12 12
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $450
+JUMPV
+LABELV $447
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 AAS_CheckAreaForPossiblePortals
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $448
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $450
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $447
+CNSTI4 1
+ARGI4
+ADDRGP4 $453
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $446
+endproc AAS_FindPossiblePortals 12 12
+export AAS_RemoveAllPortals
+proc AAS_RemoveAllPortals 8 0
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $458
+JUMPV
+LABELV $455
+ADDRLP4 4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+LABELV $456
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $458
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $455
+LABELV $454
+endproc AAS_RemoveAllPortals 8 0
+export AAS_TestPortals
+proc AAS_TestPortals 12 8
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $465
+JUMPV
+LABELV $462
+ADDRLP4 0
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $468
+ADDRLP4 8
+CNSTI4 28
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+ADDRGP4 $471
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Log_Write
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $461
+JUMPV
+LABELV $468
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $472
+ADDRLP4 8
+CNSTI4 28
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+ADDRGP4 $475
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Log_Write
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $461
+JUMPV
+LABELV $472
+LABELV $463
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $465
+ADDRLP4 4
+INDIRI4
+ADDRGP4 aasworld+256
+INDIRI4
+LTI4 $462
+CNSTI4 1
+RETI4
+LABELV $461
+endproc AAS_TestPortals 12 8
+export AAS_CountForcedClusterPortals
+proc AAS_CountForcedClusterPortals 8 12
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $480
+JUMPV
+LABELV $477
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $482
+ADDRGP4 $485
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Log_Write
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $482
+LABELV $478
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $480
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $477
+CNSTI4 1
+ARGI4
+ADDRGP4 $487
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $476
+endproc AAS_CountForcedClusterPortals 8 12
+export AAS_CreateViewPortals
+proc AAS_CreateViewPortals 8 0
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $492
+JUMPV
+LABELV $489
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $494
+ADDRLP4 4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $494
+LABELV $490
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $492
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $489
+LABELV $488
+endproc AAS_CreateViewPortals 8 0
+export AAS_SetViewPortalsAsClusterPortals
+proc AAS_SetViewPortalsAsClusterPortals 8 0
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $502
+JUMPV
+LABELV $499
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $504
+ADDRLP4 4
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $504
+LABELV $500
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $502
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $499
+LABELV $498
+endproc AAS_SetViewPortalsAsClusterPortals 8 0
+export AAS_InitClustering
+proc AAS_InitClustering 44 16
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $509
+ADDRGP4 $508
+JUMPV
+LABELV $509
+ADDRGP4 aasworld+272
+INDIRI4
+CNSTI4 1
+LTI4 $511
+ADDRGP4 $516
+ARGP4
+ADDRLP4 20
+ADDRGP4 LibVarGetValue
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+CNSTI4 0
+NEI4 $514
+ADDRGP4 $517
+ARGP4
+ADDRLP4 24
+ADDRGP4 LibVarGetValue
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+CNSTI4 0
+NEI4 $514
+ADDRGP4 $508
+JUMPV
+LABELV $514
+LABELV $511
+ADDRGP4 AAS_SetViewPortalsAsClusterPortals
+CALLV
+pop
+ADDRGP4 AAS_CountForcedClusterPortals
+CALLV
+pop
+ADDRGP4 AAS_RemoveClusterAreas
+CALLV
+pop
+ADDRGP4 AAS_FindPossiblePortals
+CALLV
+pop
+ADDRGP4 AAS_CreateViewPortals
+CALLV
+pop
+ADDRGP4 aasworld+260
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+CNSTU4 1310720
+ARGU4
+ADDRLP4 20
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+260
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+268
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+CNSTU4 262144
+ARGU4
+ADDRLP4 24
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+268
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+276
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+CNSTU4 1048576
+ARGU4
+ADDRLP4 28
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+276
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRGP4 $525
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $527
+JUMPV
+LABELV $526
+CNSTI4 1
+ARGI4
+ADDRGP4 $530
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 aasworld+256
+CNSTI4 1
+ASGNI4
+ADDRGP4 aasworld+264
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+272
+CNSTI4 1
+ASGNI4
+ADDRGP4 AAS_CreatePortals
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 AAS_FindClusters
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $534
+ADDRGP4 $527
+JUMPV
+LABELV $534
+ADDRLP4 36
+ADDRGP4 AAS_TestPortals
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $528
+LABELV $527
+ADDRGP4 $526
+JUMPV
+LABELV $528
+CNSTI4 1
+ARGI4
+ADDRGP4 $539
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 aasworld+8
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $544
+JUMPV
+LABELV $541
+ADDRGP4 $546
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Log_Write
+CALLV
+pop
+LABELV $542
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $544
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+256
+INDIRI4
+LTI4 $541
+CNSTI4 1
+ARGI4
+ADDRGP4 $549
+ARGP4
+ADDRGP4 aasworld+256
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $552
+ARGP4
+ADDRGP4 aasworld+272
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $557
+JUMPV
+LABELV $554
+CNSTI4 1
+ARGI4
+ADDRGP4 $560
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $555
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $557
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+272
+INDIRI4
+LTI4 $554
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $565
+JUMPV
+LABELV $562
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+LABELV $563
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $565
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+272
+INDIRI4
+LTI4 $562
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+256
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRGP4 $570
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $572
+ARGP4
+CNSTI4 3
+ADDRLP4 12
+INDIRI4
+MULI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $508
+endproc AAS_InitClustering 44 16
+import botimport
+import aassettings
+import AAS_PrintFreeBSPLinks
+import AAS_EntityCollision
+import AAS_BSPLinkEntity
+import AAS_UnlinkFromBSPLeaves
+import AAS_DumpBSPData
+import AAS_LoadBSPFile
+import AAS_FileInfo
+import AAS_DumpAASData
+import AAS_FreeAASLump
+import AAS_WriteCompactAASFile
+import AAS_WriteAASFile
+import AAS_LoadCompactAASFile
+import AAS_LoadAASFile
+import AAS_ShutdownAlternativeRouting
+import AAS_InitAlternativeRouting
+import AAS_RoutingCacheInfo
+import AAS_RoutingInfo
+import AAS_ReadRouteTables
+import AAS_WriteRouteTables
+import AAS_WriteRouteCache
+import AAS_CreateAllRoutingCache
+import AAS_FreeRoutingCaches
+import AAS_InitRouting
+import AAS_BestReachableLinkArea
+import AAS_ContinueInitReachability
+import AAS_InitReachability
+import AAS_SampleBenchmark
+import AAS_FreeFlatNodes
+import AAS_InitFlatNodes
+import AAS_FreeReachabilityAreaGrid
+import AAS_InitReachabilityAreaGrid
+import AAS_UnlinkFromAreas
+import AAS_InsideFace
+import AAS_PointInsideFace
+import AAS_LinkEntityClientBBox
+import AAS_AASLinkEntity
+import AAS_PlaneFromNum
+import AAS_TraceEndFace
+import AAS_AreaGroundFace
+import AAS_FreeAASLinkedEntities
+import AAS_FreeAASLinkHeap
+import AAS_InitAASLinkedEntities
+import AAS_InitAASLinkHeap
+import AAS_UpdateEntities
+import AAS_UpdateEntity
+import AAS_ResetEntityLinks
+import AAS_UnlinkInvalidEntities
+import AAS_InvalidateEntities
+import AAS_StartFrame
+import AAS_LoadMap
+import AAS_Shutdown
+import AAS_Setup
+import AAS_SetInitialized
+import AAS_Error
+import aasworld
+import AAS_InitSettings
+import AAS_DropToFloor
+import AAS_SetMovedir
+import AAS_HorizontalVelocityForJump
+import AAS_BFGJumpZVelocity
+import AAS_RocketJumpZVelocity
+import AAS_AgainstLadder
+import AAS_JumpReachRunStart
+import AAS_Swimming
+import AAS_OnGround
+import AAS_PlayerMovementHitBBox
+import AAS_PredictPlayerMovement
+import AAS_IntForBSPEpairKey
+import AAS_FloatForBSPEpairKey
+import AAS_VectorForBSPEpairKey
+import AAS_ValueForBSPEpairKey
+import AAS_NextBSPEntity
+import AAS_BSPModelMinsMaxsOrigin
+import AAS_BoxEntities
+import AAS_AreasConnected
+import AAS_inPHS
+import AAS_inPVS
+import AAS_PointContents
+import AAS_Trace
+import AAS_Optimize
+import AAS_FloodAreas
+import AAS_ShowReachableAreas
+import AAS_ShowReachability
+import AAS_DrawArrow
+import AAS_PrintTravelType
+import AAS_DrawCross
+import AAS_ShowAreaPolygons
+import AAS_ShowArea
+import AAS_ShowFace
+import AAS_ShowBoundingBox
+import AAS_DrawPlaneCross
+import AAS_DrawPermanentCross
+import AAS_PermanentLine
+import AAS_DebugLine
+import AAS_ClearShownPolygons
+import AAS_ClearShownDebugLines
+import AAS_AlternativeRouteGoals
+import AAS_PredictRoute
+import AAS_AreaTravelTimeToGoalArea
+import AAS_AreaTravelTime
+import AAS_EnableRoutingArea
+import AAS_RandomGoalArea
+import AAS_ReachabilityFromNum
+import AAS_NextAreaReachability
+import AAS_AreaContentsTravelFlags
+import AAS_TravelFlagForType
+import AAS_AreaDoNotEnter
+import AAS_AreaJumpPad
+import AAS_AreaLadder
+import AAS_AreaGrounded
+import AAS_AreaSlime
+import AAS_AreaLava
+import AAS_AreaLiquid
+import AAS_AreaSwim
+import AAS_AreaCrouch
+import AAS_AreaGroundFaceArea
+import AAS_NextModelReachability
+import AAS_BestReachableFromJumpPadArea
+import AAS_BestReachableArea
+import AAS_AreaReachability
+import AAS_FacePlane
+import AAS_PointReachabilityAreaIndex
+import AAS_PointAreaNum
+import AAS_AreaInfo
+import AAS_PointInsideArea
+import AAS_BBoxReachabilityAreas
+import AAS_BBoxAreas
+import AAS_TraceAreas
+import AAS_TracePlayerBBox
+import AAS_PointPresenceType
+import AAS_AreaPresenceType
+import AAS_AreaCluster
+import AAS_PresenceTypeBoundingBox
+import AAS_ProjectPointOntoVector
+import AAS_Time
+import AAS_Loaded
+import AAS_Initialized
+import GetBotLibAPI
+import LibVarSetNotModified
+import LibVarChanged
+import LibVarSet
+import LibVarString
+import LibVarValue
+import LibVar
+import LibVarGetValue
+import LibVarGetString
+import LibVarGet
+import LibVarDeAllocAll
+import Log_Flush
+import Log_FileHandle
+import Log_WriteTimeStamped
+import Log_Write
+import Log_Shutdown
+import Log_Close
+import Log_Open
+import DumpMemory
+import MemoryByteSize
+import PrintMemoryLabels
+import PrintUsedMemorySize
+import AvailableMemory
+import FreeMemory
+import GetClearedHunkMemory
+import GetHunkMemory
+import GetClearedMemory
+import GetMemory
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $572
+byte 1 37
+byte 1 54
+byte 1 105
+byte 1 32
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 47
+byte 1 67
+byte 1 80
+byte 1 85
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 40
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $570
+byte 1 37
+byte 1 54
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $560
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $552
+byte 1 37
+byte 1 54
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $549
+byte 1 37
+byte 1 54
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $546
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 13
+byte 1 10
+byte 1 0
+align 1
+LABELV $539
+byte 1 10
+byte 1 0
+align 1
+LABELV $530
+byte 1 13
+byte 1 37
+byte 1 54
+byte 1 100
+byte 1 0
+align 1
+LABELV $525
+byte 1 13
+byte 1 37
+byte 1 54
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 0
+align 1
+LABELV $517
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $516
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $487
+byte 1 37
+byte 1 54
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $485
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 13
+byte 1 10
+byte 1 0
+align 1
+LABELV $475
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 13
+byte 1 10
+byte 1 0
+align 1
+LABELV $471
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 13
+byte 1 10
+byte 1 0
+align 1
+LABELV $453
+byte 1 13
+byte 1 37
+byte 1 54
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $445
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 13
+byte 1 10
+byte 1 0
+align 1
+LABELV $339
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 65
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $276
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $252
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 67
+byte 1 76
+byte 1 85
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $100
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $93
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 67
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $83
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 68
+byte 1 69
+byte 1 88
+byte 1 83
+byte 1 73
+byte 1 90
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $79
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 13
+byte 1 10
+byte 1 0
+align 1
+LABELV $68
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
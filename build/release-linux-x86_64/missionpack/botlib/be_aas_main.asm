@@ -0,0 +1,1724 @@
+export AAS_Error
+code
+proc AAS_Error 1028 16
+ADDRLP4 1024
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 1024
+CNSTP4 0
+ASGNP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $28
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $25
+endproc AAS_Error 1028 16
+export AAS_Loaded
+proc AAS_Loaded 0 0
+ADDRGP4 aasworld
+INDIRI4
+RETI4
+LABELV $29
+endproc AAS_Loaded 0 0
+export AAS_Initialized
+proc AAS_Initialized 0 0
+ADDRGP4 aasworld+4
+INDIRI4
+RETI4
+LABELV $30
+endproc AAS_Initialized 0 0
+export AAS_SetInitialized
+proc AAS_SetInitialized 0 8
+ADDRGP4 aasworld+4
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRGP4 $35
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $32
+endproc AAS_SetInitialized 0 8
+export AAS_WriteCompactAAS
+proc AAS_WriteCompactAAS 68 16
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $37
+ARGP4
+ADDRGP4 aasworld+88
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ADDRGP4 AAS_WriteCompactAASFile
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $39
+CNSTI4 1
+ARGI4
+ADDRGP4 $42
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $40
+JUMPV
+LABELV $39
+CNSTI4 3
+ARGI4
+ADDRGP4 $44
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $40
+LABELV $36
+endproc AAS_WriteCompactAAS 68 16
+export AAS_ContinueInit
+proc AAS_ContinueInit 16 12
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $46
+ADDRGP4 $45
+JUMPV
+LABELV $46
+ADDRGP4 aasworld+4
+INDIRI4
+CNSTI4 0
+EQI4 $48
+ADDRGP4 $45
+JUMPV
+LABELV $48
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 AAS_ContinueInitReachability
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $51
+ADDRGP4 $45
+JUMPV
+LABELV $51
+ADDRGP4 AAS_InitClustering
+CALLV
+pop
+ADDRGP4 aasworld+8
+INDIRI4
+CNSTI4 0
+NEI4 $57
+ADDRGP4 $56
+ARGP4
+ADDRLP4 4
+ADDRGP4 LibVarGetValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+CNSTI4 0
+EQI4 $53
+LABELV $57
+ADDRGP4 $60
+ARGP4
+ADDRGP4 $61
+ARGP4
+ADDRLP4 8
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+CNSTI4 0
+EQI4 $58
+ADDRGP4 AAS_Optimize
+CALLV
+pop
+LABELV $58
+ADDRGP4 aasworld+152
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $62
+ADDRGP4 AAS_WriteCompactAAS
+CALLV
+pop
+LABELV $62
+ADDRGP4 aasworld+24
+ARGP4
+ADDRLP4 12
+ADDRGP4 AAS_WriteAASFile
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $65
+CNSTI4 1
+ARGI4
+ADDRGP4 $42
+ARGP4
+ADDRGP4 aasworld+24
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $66
+JUMPV
+LABELV $65
+CNSTI4 3
+ARGI4
+ADDRGP4 $44
+ARGP4
+ADDRGP4 aasworld+24
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $66
+LABELV $53
+ADDRGP4 AAS_InitReachabilityAreaGrid
+CALLV
+pop
+ADDRGP4 AAS_InitRouting
+CALLV
+pop
+ADDRGP4 AAS_SetInitialized
+CALLV
+pop
+LABELV $45
+endproc AAS_ContinueInit 16 12
+export AAS_StartFrame
+proc AAS_StartFrame 12 8
+ADDRGP4 aasworld+16
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 AAS_UnlinkInvalidEntities
+CALLV
+pop
+ADDRGP4 AAS_InvalidateEntities
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRGP4 AAS_ContinueInit
+CALLV
+pop
+ADDRGP4 aasworld+456
+CNSTI4 0
+ASGNI4
+ADDRGP4 botDeveloper
+INDIRI4
+CNSTI4 0
+EQI4 $75
+ADDRGP4 $79
+ARGP4
+ADDRLP4 0
+ADDRGP4 LibVarGetValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $77
+ADDRGP4 AAS_RoutingInfo
+CALLV
+pop
+ADDRGP4 $79
+ARGP4
+ADDRGP4 $61
+ARGP4
+ADDRGP4 LibVarSet
+CALLV
+pop
+LABELV $77
+ADDRGP4 $82
+ARGP4
+ADDRLP4 4
+ADDRGP4 LibVarGetValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+EQF4 $80
+ADDRGP4 PrintUsedMemorySize
+CALLV
+pop
+ADDRGP4 $82
+ARGP4
+ADDRGP4 $61
+ARGP4
+ADDRGP4 LibVarSet
+CALLV
+pop
+LABELV $80
+ADDRGP4 $85
+ARGP4
+ADDRLP4 8
+ADDRGP4 LibVarGetValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+EQF4 $83
+ADDRGP4 PrintMemoryLabels
+CALLV
+pop
+ADDRGP4 $85
+ARGP4
+ADDRGP4 $61
+ARGP4
+ADDRGP4 LibVarSet
+CALLV
+pop
+LABELV $83
+LABELV $75
+ADDRGP4 $88
+ARGP4
+ADDRLP4 0
+ADDRGP4 LibVarGetValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $86
+ADDRGP4 AAS_RoutingCacheInfo
+CALLV
+pop
+ADDRGP4 $88
+ARGP4
+ADDRGP4 $61
+ARGP4
+ADDRGP4 LibVarSet
+CALLV
+pop
+LABELV $86
+ADDRGP4 saveroutingcache
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $89
+ADDRGP4 AAS_WriteRouteCache
+CALLV
+pop
+ADDRGP4 $91
+ARGP4
+ADDRGP4 $61
+ARGP4
+ADDRGP4 LibVarSet
+CALLV
+pop
+LABELV $89
+ADDRGP4 bakeroutetables
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $92
+ADDRGP4 AAS_WriteRouteTables
+CALLV
+pop
+ADDRGP4 $94
+ARGP4
+ADDRGP4 $61
+ARGP4
+ADDRGP4 LibVarSet
+CALLV
+pop
+LABELV $92
+ADDRGP4 writecompactaas
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $95
+ADDRGP4 aasworld+4
+INDIRI4
+CNSTI4 0
+EQI4 $95
+ADDRGP4 AAS_WriteCompactAAS
+CALLV
+pop
+ADDRGP4 $98
+ARGP4
+ADDRGP4 $61
+ARGP4
+ADDRGP4 LibVarSet
+CALLV
+pop
+LABELV $95
+ADDRGP4 samplebenchmark
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $99
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+EQI4 $99
+ADDRGP4 AAS_SampleBenchmark
+CALLV
+pop
+ADDRGP4 $101
+ARGP4
+ADDRGP4 $61
+ARGP4
+ADDRGP4 LibVarSet
+CALLV
+pop
+LABELV $99
+ADDRLP4 4
+ADDRGP4 aasworld+20
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 0
+RETI4
+LABELV $72
+endproc AAS_StartFrame 12 8
+export AAS_Time
+proc AAS_Time 0 0
+ADDRGP4 aasworld+16
+INDIRF4
+RETF4
+LABELV $103
+endproc AAS_Time 0 0
+export AAS_ProjectPointOntoVector
+proc AAS_ProjectPointOntoVector 68 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 56
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+CNSTI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 8
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $105
+endproc AAS_ProjectPointOntoVector 68 4
+export AAS_LoadFiles
+proc AAS_LoadFiles 76 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+88
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 AAS_ResetEntityLinks
+CALLV
+pop
+ADDRGP4 AAS_LoadBSPFile
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $37
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ADDRGP4 AAS_LoadCompactAASFile
+CALLI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $127
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $129
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 AAS_LoadAASFile
+CALLI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $130
+ADDRLP4 64
+INDIRI4
+RETI4
+ADDRGP4 $124
+JUMPV
+LABELV $130
+LABELV $127
+CNSTI4 0
+ARGI4
+ADDRGP4 $133
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 AAS_InitFlatNodes
+CALLV
+pop
+ADDRGP4 aasworld+24
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $129
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 0
+RETI4
+LABELV $124
+endproc AAS_LoadFiles 76 16
+export AAS_LoadMap
+proc AAS_LoadMap 8 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $137
+CNSTI4 0
+RETI4
+ADDRGP4 $136
+JUMPV
+LABELV $137
+ADDRGP4 aasworld+4
+CNSTI4 0
+ASGNI4
+ADDRGP4 AAS_FreeRoutingCaches
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 AAS_LoadFiles
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $140
+ADDRGP4 aasworld
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $136
+JUMPV
+LABELV $140
+ADDRGP4 AAS_InitSettings
+CALLV
+pop
+ADDRGP4 AAS_InitAASLinkHeap
+CALLV
+pop
+ADDRGP4 AAS_InitAASLinkedEntities
+CALLV
+pop
+ADDRGP4 AAS_InitReachability
+CALLV
+pop
+ADDRGP4 AAS_InitAlternativeRouting
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $136
+endproc AAS_LoadMap 8 4
+export AAS_Setup
+proc AAS_Setup 28 8
+ADDRGP4 $144
+ARGP4
+ADDRGP4 $145
+ARGP4
+ADDRLP4 0
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aasworld+308
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $147
+ARGP4
+ADDRGP4 $148
+ARGP4
+ADDRLP4 4
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aasworld+304
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $91
+ARGP4
+ADDRGP4 $61
+ARGP4
+ADDRLP4 8
+ADDRGP4 LibVar
+CALLP4
+ASGNP4
+ADDRGP4 saveroutingcache
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $94
+ARGP4
+ADDRGP4 $61
+ARGP4
+ADDRLP4 12
+ADDRGP4 LibVar
+CALLP4
+ASGNP4
+ADDRGP4 bakeroutetables
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $98
+ARGP4
+ADDRGP4 $61
+ARGP4
+ADDRLP4 16
+ADDRGP4 LibVar
+CALLP4
+ASGNP4
+ADDRGP4 writecompactaas
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRGP4 $101
+ARGP4
+ADDRGP4 $61
+ARGP4
+ADDRLP4 20
+ADDRGP4 LibVar
+CALLP4
+ASGNP4
+ADDRGP4 samplebenchmark
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+312
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $149
+ADDRGP4 aasworld+312
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $149
+CNSTU4 12
+ADDRGP4 aasworld+304
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRLP4 24
+ADDRGP4 GetClearedHunkMemory
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+312
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 AAS_InvalidateEntities
+CALLV
+pop
+ADDRGP4 aasworld+20
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+LABELV $142
+endproc AAS_Setup 28 8
+export AAS_Shutdown
+proc AAS_Shutdown 0 12
+ADDRGP4 AAS_ShutdownAlternativeRouting
+CALLV
+pop
+ADDRGP4 AAS_DumpBSPData
+CALLV
+pop
+ADDRGP4 AAS_FreeRoutingCaches
+CALLV
+pop
+ADDRGP4 AAS_FreeAASLinkHeap
+CALLV
+pop
+ADDRGP4 AAS_FreeAASLinkedEntities
+CALLV
+pop
+ADDRGP4 AAS_DumpAASData
+CALLV
+pop
+ADDRGP4 aasworld+312
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $157
+ADDRGP4 aasworld+312
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $157
+ADDRGP4 aasworld
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 540
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 aasworld+4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRGP4 $163
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $156
+endproc AAS_Shutdown 0 12
+bss
+export samplebenchmark
+align 4
+LABELV samplebenchmark
+skip 4
+export writecompactaas
+align 4
+LABELV writecompactaas
+skip 4
+export bakeroutetables
+align 4
+LABELV bakeroutetables
+skip 4
+export saveroutingcache
+align 4
+LABELV saveroutingcache
+skip 4
+import aassettings
+import AAS_PrintFreeBSPLinks
+import AAS_EntityCollision
+import AAS_BSPLinkEntity
+import AAS_UnlinkFromBSPLeaves
+import AAS_DumpBSPData
+import AAS_LoadBSPFile
+import AAS_FileInfo
+import AAS_DumpAASData
+import AAS_FreeAASLump
+import AAS_WriteCompactAASFile
+import AAS_WriteAASFile
+import AAS_LoadCompactAASFile
+import AAS_LoadAASFile
+import AAS_ShutdownAlternativeRouting
+import AAS_InitAlternativeRouting
+import AAS_RoutingCacheInfo
+import AAS_RoutingInfo
+import AAS_ReadRouteTables
+import AAS_WriteRouteTables
+import AAS_WriteRouteCache
+import AAS_CreateAllRoutingCache
+import AAS_FreeRoutingCaches
+import AAS_InitRouting
+import AAS_BestReachableLinkArea
+import AAS_ContinueInitReachability
+import AAS_InitReachability
+import AAS_SetViewPortalsAsClusterPortals
+import AAS_InitClustering
+import AAS_SampleBenchmark
+import AAS_FreeFlatNodes
+import AAS_InitFlatNodes
+import AAS_FreeReachabilityAreaGrid
+import AAS_InitReachabilityAreaGrid
+import AAS_UnlinkFromAreas
+import AAS_InsideFace
+import AAS_PointInsideFace
+import AAS_LinkEntityClientBBox
+import AAS_AASLinkEntity
+import AAS_PlaneFromNum
+import AAS_TraceEndFace
+import AAS_AreaGroundFace
+import AAS_FreeAASLinkedEntities
+import AAS_FreeAASLinkHeap
+import AAS_InitAASLinkedEntities
+import AAS_InitAASLinkHeap
+import AAS_UpdateEntities
+import AAS_UpdateEntity
+import AAS_ResetEntityLinks
+import AAS_UnlinkInvalidEntities
+import AAS_InvalidateEntities
+export aasworld
+align 4
+LABELV aasworld
+skip 540
+import botDeveloper
+import botimport
+import botlibglobals
+import AAS_InitSettings
+import AAS_DropToFloor
+import AAS_SetMovedir
+import AAS_HorizontalVelocityForJump
+import AAS_BFGJumpZVelocity
+import AAS_RocketJumpZVelocity
+import AAS_AgainstLadder
+import AAS_JumpReachRunStart
+import AAS_Swimming
+import AAS_OnGround
+import AAS_PlayerMovementHitBBox
+import AAS_PredictPlayerMovement
+import AAS_IntForBSPEpairKey
+import AAS_FloatForBSPEpairKey
+import AAS_VectorForBSPEpairKey
+import AAS_ValueForBSPEpairKey
+import AAS_NextBSPEntity
+import AAS_BSPModelMinsMaxsOrigin
+import AAS_BoxEntities
+import AAS_AreasConnected
+import AAS_inPHS
+import AAS_inPVS
+import AAS_PointContents
+import AAS_Trace
+import AAS_Optimize
+import AAS_FloodAreas
+import AAS_ShowReachableAreas
+import AAS_ShowReachability
+import AAS_DrawArrow
+import AAS_PrintTravelType
+import AAS_DrawCross
+import AAS_ShowAreaPolygons
+import AAS_ShowArea
+import AAS_ShowFace
+import AAS_ShowBoundingBox
+import AAS_DrawPlaneCross
+import AAS_DrawPermanentCross
+import AAS_PermanentLine
+import AAS_DebugLine
+import AAS_ClearShownPolygons
+import AAS_ClearShownDebugLines
+import AAS_AlternativeRouteGoals
+import AAS_PredictRoute
+import AAS_AreaTravelTimeToGoalArea
+import AAS_AreaTravelTime
+import AAS_EnableRoutingArea
+import AAS_RandomGoalArea
+import AAS_ReachabilityFromNum
+import AAS_NextAreaReachability
+import AAS_AreaContentsTravelFlags
+import AAS_TravelFlagForType
+import AAS_AreaDoNotEnter
+import AAS_AreaJumpPad
+import AAS_AreaLadder
+import AAS_AreaGrounded
+import AAS_AreaSlime
+import AAS_AreaLava
+import AAS_AreaLiquid
+import AAS_AreaSwim
+import AAS_AreaCrouch
+import AAS_AreaGroundFaceArea
+import AAS_NextModelReachability
+import AAS_BestReachableFromJumpPadArea
+import AAS_BestReachableArea
+import AAS_AreaReachability
+import AAS_FacePlane
+import AAS_PointReachabilityAreaIndex
+import AAS_PointAreaNum
+import AAS_AreaInfo
+import AAS_PointInsideArea
+import AAS_BBoxReachabilityAreas
+import AAS_BBoxAreas
+import AAS_TraceAreas
+import AAS_TracePlayerBBox
+import AAS_PointPresenceType
+import AAS_AreaPresenceType
+import AAS_AreaCluster
+import AAS_PresenceTypeBoundingBox
+import GetBotLibAPI
+import LibVarSetNotModified
+import LibVarChanged
+import LibVarSet
+import LibVarString
+import LibVarValue
+import LibVar
+import LibVarGetValue
+import LibVarGetString
+import LibVarGet
+import LibVarDeAllocAll
+import DumpMemory
+import MemoryByteSize
+import PrintMemoryLabels
+import PrintUsedMemorySize
+import AvailableMemory
+import FreeMemory
+import GetClearedHunkMemory
+import GetHunkMemory
+import GetClearedMemory
+import GetMemory
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $163
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 117
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $148
+byte 1 49
+byte 1 48
+byte 1 50
+byte 1 52
+byte 1 0
+align 1
+LABELV $147
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $145
+byte 1 49
+byte 1 50
+byte 1 56
+byte 1 0
+align 1
+LABELV $144
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $133
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $129
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 0
+align 1
+LABELV $101
+byte 1 115
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 98
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $98
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 0
+align 1
+LABELV $94
+byte 1 98
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $91
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $88
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $85
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $82
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 117
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $79
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $61
+byte 1 48
+byte 1 0
+align 1
+LABELV $60
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $56
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $44
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $42
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $37
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $35
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $28
+byte 1 37
+byte 1 115
+byte 1 0
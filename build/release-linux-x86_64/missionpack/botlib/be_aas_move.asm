@@ -0,0 +1,7439 @@
+export AAS_DropToFloor
+code
+proc AAS_DropToFloor 84 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 64+8
+ADDRLP4 64+8
+INDIRF4
+CNSTF4 1166016512
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 AAS_Trace
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+EQI4 $27
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $25
+JUMPV
+LABELV $27
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+CNSTI4 1
+RETI4
+LABELV $25
+endproc AAS_DropToFloor 84 28
+export AAS_InitSettings
+proc AAS_InitSettings 152 8
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 aassettings
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 aassettings+4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 aassettings+8
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 $35
+ARGP4
+ADDRGP4 $36
+ARGP4
+ADDRLP4 4
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+12
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $38
+ARGP4
+ADDRGP4 $39
+ARGP4
+ADDRLP4 8
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+16
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $41
+ARGP4
+ADDRGP4 $42
+ARGP4
+ADDRLP4 12
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+20
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 $44
+ARGP4
+ADDRGP4 $45
+ARGP4
+ADDRLP4 16
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+24
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRGP4 $47
+ARGP4
+ADDRGP4 $48
+ARGP4
+ADDRLP4 20
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+28
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRGP4 $50
+ARGP4
+ADDRGP4 $51
+ARGP4
+ADDRLP4 24
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+32
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $53
+ARGP4
+ADDRGP4 $51
+ARGP4
+ADDRLP4 28
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+36
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 $55
+ARGP4
+ADDRGP4 $39
+ARGP4
+ADDRLP4 32
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+40
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 $57
+ARGP4
+ADDRGP4 $58
+ARGP4
+ADDRLP4 36
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+44
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRGP4 $60
+ARGP4
+ADDRGP4 $61
+ARGP4
+ADDRLP4 40
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+48
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRGP4 $63
+ARGP4
+ADDRGP4 $45
+ARGP4
+ADDRLP4 44
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+52
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 $65
+ARGP4
+ADDRGP4 $66
+ARGP4
+ADDRLP4 48
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+56
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRGP4 $68
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRLP4 52
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+60
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRGP4 $71
+ARGP4
+ADDRGP4 $72
+ARGP4
+ADDRLP4 56
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+64
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRGP4 $74
+ARGP4
+ADDRGP4 $75
+ARGP4
+ADDRLP4 60
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+68
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRGP4 $77
+ARGP4
+ADDRGP4 $78
+ARGP4
+ADDRLP4 64
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+72
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRGP4 $80
+ARGP4
+ADDRGP4 $81
+ARGP4
+ADDRLP4 68
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+76
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRGP4 $83
+ARGP4
+ADDRGP4 $84
+ARGP4
+ADDRLP4 72
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+80
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRGP4 $86
+ARGP4
+ADDRGP4 $87
+ARGP4
+ADDRLP4 76
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+84
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRGP4 $89
+ARGP4
+ADDRGP4 $45
+ARGP4
+ADDRLP4 80
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+88
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRGP4 $91
+ARGP4
+ADDRGP4 $48
+ARGP4
+ADDRLP4 84
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+92
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRGP4 $93
+ARGP4
+ADDRGP4 $94
+ARGP4
+ADDRLP4 88
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+96
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRGP4 $96
+ARGP4
+ADDRGP4 $39
+ARGP4
+ADDRLP4 92
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+100
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRGP4 $98
+ARGP4
+ADDRGP4 $99
+ARGP4
+ADDRLP4 96
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+104
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRGP4 $101
+ARGP4
+ADDRGP4 $102
+ARGP4
+ADDRLP4 100
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+108
+ADDRLP4 100
+INDIRF4
+ASGNF4
+ADDRGP4 $104
+ARGP4
+ADDRGP4 $105
+ARGP4
+ADDRLP4 104
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+112
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRGP4 $107
+ARGP4
+ADDRGP4 $99
+ARGP4
+ADDRLP4 108
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+116
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRGP4 $109
+ARGP4
+ADDRGP4 $102
+ARGP4
+ADDRLP4 112
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+120
+ADDRLP4 112
+INDIRF4
+ASGNF4
+ADDRGP4 $111
+ARGP4
+ADDRGP4 $102
+ARGP4
+ADDRLP4 116
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+124
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRGP4 $113
+ARGP4
+ADDRGP4 $114
+ARGP4
+ADDRLP4 120
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+128
+ADDRLP4 120
+INDIRF4
+ASGNF4
+ADDRGP4 $116
+ARGP4
+ADDRGP4 $99
+ARGP4
+ADDRLP4 124
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+132
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRGP4 $118
+ARGP4
+ADDRGP4 $99
+ARGP4
+ADDRLP4 128
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+136
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRGP4 $120
+ARGP4
+ADDRGP4 $94
+ARGP4
+ADDRLP4 132
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+140
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRGP4 $122
+ARGP4
+ADDRGP4 $99
+ARGP4
+ADDRLP4 136
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+144
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRGP4 $124
+ARGP4
+ADDRGP4 $102
+ARGP4
+ADDRLP4 140
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+148
+ADDRLP4 140
+INDIRF4
+ASGNF4
+ADDRGP4 $126
+ARGP4
+ADDRGP4 $127
+ARGP4
+ADDRLP4 144
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+152
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRGP4 $129
+ARGP4
+ADDRGP4 $130
+ARGP4
+ADDRLP4 148
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 aassettings+156
+ADDRLP4 148
+INDIRF4
+ASGNF4
+LABELV $31
+endproc AAS_InitSettings 152 8
+export AAS_AgainstLadder
+proc AAS_AgainstLadder 80 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 28
+ARGP4
+ADDRLP4 40
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $132
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 44
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $134
+ADDRLP4 28+4
+ADDRLP4 28+4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 48
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $137
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 52
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $139
+ADDRLP4 28+4
+ADDRLP4 28+4
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 56
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 56
+INDIRI4
+ASGNI4
+LABELV $139
+LABELV $137
+LABELV $134
+LABELV $132
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $142
+CNSTI4 0
+RETI4
+ADDRGP4 $131
+JUMPV
+LABELV $142
+CNSTI4 28
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $144
+CNSTI4 0
+RETI4
+ADDRGP4 $131
+JUMPV
+LABELV $144
+CNSTI4 28
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $147
+CNSTI4 0
+RETI4
+ADDRGP4 $131
+JUMPV
+LABELV $147
+ADDRLP4 16
+CNSTI4 48
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $154
+JUMPV
+LABELV $151
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $157
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 $158
+JUMPV
+LABELV $157
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+LABELV $158
+ADDRLP4 20
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 24
+ADDRLP4 48
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $160
+ADDRGP4 $152
+JUMPV
+LABELV $160
+ADDRLP4 0
+CNSTI4 20
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+BXORI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 60
+CNSTI4 4
+ASGNI4
+ADDRLP4 64
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 fabsf
+CALLF4
+ASGNF4
+ADDRLP4 68
+INDIRF4
+CNSTF4 1077936128
+GEF4 $163
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 76
+ADDRGP4 AAS_PointInsideFace
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $165
+CNSTI4 1
+RETI4
+ADDRGP4 $131
+JUMPV
+LABELV $165
+LABELV $163
+LABELV $152
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $154
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $151
+CNSTI4 0
+RETI4
+LABELV $131
+endproc AAS_AgainstLadder 80 12
+lit
+align 4
+LABELV $168
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export AAS_OnGround
+code
+proc AAS_OnGround 88 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRGP4 $168
+INDIRB
+ASGNB 12
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 72+8
+ADDRLP4 72+8
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $170
+CNSTI4 0
+RETI4
+ADDRGP4 $167
+JUMPV
+LABELV $170
+ADDRLP4 0+4
+INDIRF4
+CNSTF4 1065353216
+LTF4 $172
+CNSTI4 0
+RETI4
+ADDRGP4 $167
+JUMPV
+LABELV $172
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+8+8
+INDIRF4
+SUBF4
+CNSTF4 1092616192
+LEF4 $175
+CNSTI4 0
+RETI4
+ADDRGP4 $167
+JUMPV
+LABELV $175
+ADDRLP4 68
+ADDRLP4 0+36
+ASGNP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 56+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 56+8
+INDIRF4
+MULF4
+ADDF4
+ADDRGP4 aassettings+64
+INDIRF4
+GEF4 $180
+CNSTI4 0
+RETI4
+ADDRGP4 $167
+JUMPV
+LABELV $180
+CNSTI4 1
+RETI4
+LABELV $167
+endproc AAS_OnGround 88 24
+export AAS_Swimming
+proc AAS_Swimming 16 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ADDRGP4 AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $187
+CNSTI4 1
+RETI4
+ADDRGP4 $185
+JUMPV
+LABELV $187
+CNSTI4 0
+RETI4
+LABELV $185
+endproc AAS_Swimming 16 4
+data
+align 4
+LABELV $190
+byte 4 0
+byte 4 3212836864
+byte 4 0
+align 4
+LABELV $191
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV $192
+byte 4 0
+byte 4 3221225472
+byte 4 0
+align 4
+LABELV $193
+byte 4 0
+byte 4 0
+byte 4 3212836864
+export AAS_SetMovedir
+code
+proc AAS_SetMovedir 12 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $190
+ARGP4
+ADDRLP4 0
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $194
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $191
+INDIRB
+ASGNB 12
+ADDRGP4 $195
+JUMPV
+LABELV $194
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $192
+ARGP4
+ADDRLP4 4
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $196
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $193
+INDIRB
+ASGNB 12
+ADDRGP4 $197
+JUMPV
+LABELV $196
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $197
+LABELV $195
+LABELV $189
+endproc AAS_SetMovedir 12 16
+export AAS_JumpReachRunStart
+proc AAS_JumpReachRunStart 160 56
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 144
+CNSTF4 1137180672
+ASGNF4
+ADDRLP4 12
+ADDRLP4 144
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 144
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 1137180672
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 148
+CNSTI4 2
+ASGNI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 152
+CNSTI4 1
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+CNSTF4 1036831949
+ARGF4
+CNSTI4 124
+ARGI4
+ADDRLP4 156
+CNSTI4 0
+ASGNI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRLP4 156
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 AAS_PredictPlayerMovement
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRB
+ASGNB 12
+ADDRLP4 36+88
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $206
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRB
+ASGNB 12
+LABELV $206
+LABELV $198
+endproc AAS_JumpReachRunStart 160 56
+lit
+align 4
+LABELV $210
+byte 4 1090519040
+byte 4 1090519040
+byte 4 3238002688
+align 4
+LABELV $211
+byte 4 3246391296
+byte 4 3246391296
+byte 4 3250585600
+align 4
+LABELV $212
+byte 4 1098907648
+byte 4 1098907648
+byte 4 1107296256
+export AAS_WeaponJumpZVelocity
+code
+proc AAS_WeaponJumpZVelocity 240 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRGP4 $210
+INDIRB
+ASGNB 12
+ADDRLP4 184
+ADDRGP4 $211
+INDIRB
+ASGNB 12
+ADDRLP4 196
+ADDRGP4 $212
+INDIRB
+ASGNB 12
+ADDRLP4 164
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 164+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 164+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 164
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRLP4 152
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 208
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 208
+INDIRF4
+MULF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 100+4
+INDIRF4
+ADDRLP4 208
+INDIRF4
+MULF4
+ADDRLP4 152+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 100+8
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRLP4 152+8
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 24+8
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 212
+CNSTF4 1140457472
+ASGNF4
+ADDRLP4 140
+ADDRLP4 12
+INDIRF4
+ADDRLP4 212
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 212
+INDIRF4
+ADDRLP4 100+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1140457472
+ADDRLP4 100+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 216
+CNSTP4 0
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 AAS_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 184
+INDIRF4
+ADDRLP4 196
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 184+4
+INDIRF4
+ADDRLP4 196+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 184+8
+INDIRF4
+ADDRLP4 196+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 224
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36+12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 36+12+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 36+12+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 228
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRFP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 228
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 0
+GEF4 $251
+ADDRLP4 124
+CNSTF4 0
+ASGNF4
+LABELV $251
+ADDRLP4 124
+CNSTF4 1056964608
+ADDRLP4 124
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 176
+CNSTF4 1128792064
+ASGNF4
+ADDRLP4 180
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 36+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 112+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 36+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 112+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 36+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 112
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 236
+CNSTF4 1153957888
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDRLP4 176
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 128
+ADDRLP4 112
+INDIRF4
+ADDRLP4 236
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 128+4
+ADDRLP4 112+4
+INDIRF4
+ADDRLP4 236
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 112+8
+INDIRF4
+CNSTF4 1153957888
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDRLP4 176
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 128+8
+INDIRF4
+ADDRGP4 aassettings+76
+INDIRF4
+ADDF4
+RETF4
+LABELV $209
+endproc AAS_WeaponJumpZVelocity 240 28
+export AAS_RocketJumpZVelocity
+proc AAS_RocketJumpZVelocity 4 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1123024896
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 AAS_WeaponJumpZVelocity
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $266
+endproc AAS_RocketJumpZVelocity 4 12
+export AAS_BFGJumpZVelocity
+proc AAS_BFGJumpZVelocity 4 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1123024896
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 AAS_WeaponJumpZVelocity
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $267
+endproc AAS_BFGJumpZVelocity 4 12
+export AAS_Accelerate
+proc AAS_Accelerate 60 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRF4
+CNSTF4 0
+EQF4 $269
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GTF4 $271
+ADDRGP4 $268
+JUMPV
+LABELV $271
+ADDRLP4 4
+ADDRFP4 16
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $273
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $273
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $275
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 32
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $276
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $275
+ADDRGP4 $270
+JUMPV
+LABELV $269
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRFP4 16
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 28
+INDIRF4
+LEF4 $285
+ADDRLP4 24
+ADDRLP4 28
+INDIRF4
+ASGNF4
+LABELV $285
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $270
+LABELV $268
+endproc AAS_Accelerate 60 4
+export AAS_ApplyFriction
+proc AAS_ApplyFriction 40 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $290
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+GEF4 $293
+ADDRLP4 28
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $294
+JUMPV
+LABELV $293
+ADDRLP4 28
+ADDRLP4 0
+INDIRF4
+ASGNF4
+LABELV $294
+ADDRLP4 8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GEF4 $295
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+LABELV $295
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $290
+LABELV $289
+endproc AAS_ApplyFriction 40 4
+export AAS_ClipToBBox
+proc AAS_ClipToBBox 168 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRGP4 AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 20
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20+4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 88+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 88+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 20
+INDIRP4
+INDIRF4
+ADDRLP4 76
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32+4
+ADDRFP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 76+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32+8
+ADDRFP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 76+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $306
+ADDRLP4 108
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 108
+INDIRI4
+ADDRLP4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 108
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+GEF4 $310
+ADDRLP4 108
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+GEF4 $310
+CNSTI4 0
+RETI4
+ADDRGP4 $297
+JUMPV
+LABELV $310
+ADDRLP4 116
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 116
+INDIRI4
+ADDRLP4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 116
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+LEF4 $312
+ADDRLP4 116
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+LEF4 $312
+CNSTI4 0
+RETI4
+ADDRGP4 $297
+JUMPV
+LABELV $312
+LABELV $307
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $306
+ADDRLP4 44
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 116
+CNSTI4 4
+ASGNI4
+ADDRLP4 44+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+CNSTI4 8
+ASGNI4
+ADDRLP4 44+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $316
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 44
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $320
+ADDRLP4 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $321
+JUMPV
+LABELV $320
+ADDRLP4 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $321
+ADDRLP4 128
+CNSTI4 2
+ASGNI4
+ADDRLP4 132
+ADDRLP4 0
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 132
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 132
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 64
+INDIRF4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LEI4 $322
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $322
+ADDRLP4 144
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 144
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 144
+INDIRI4
+ADDRLP4 44
+ADDP4
+INDIRF4
+ADDRLP4 60
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 148
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 152
+INDIRF4
+ADDRLP4 148
+INDIRI4
+ADDRLP4 20
+ADDP4
+INDIRF4
+LEF4 $324
+ADDRLP4 152
+INDIRF4
+ADDRLP4 148
+INDIRI4
+ADDRLP4 32
+ADDP4
+INDIRF4
+GEF4 $324
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LEI4 $326
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $326
+ADDRLP4 156
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 156
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 156
+INDIRI4
+ADDRLP4 44
+ADDP4
+INDIRF4
+ADDRLP4 60
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 160
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 160
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 164
+INDIRF4
+ADDRLP4 160
+INDIRI4
+ADDRLP4 20
+ADDP4
+INDIRF4
+LEF4 $328
+ADDRLP4 164
+INDIRF4
+ADDRLP4 160
+INDIRI4
+ADDRLP4 32
+ADDP4
+INDIRF4
+GEF4 $328
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRGP4 $318
+JUMPV
+LABELV $328
+LABELV $324
+LABELV $317
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $316
+LABELV $318
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+EQI4 $330
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $333
+ADDRLP4 128
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDP4
+ADDRLP4 128
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRI4
+ADDRLP4 44
+ADDP4
+INDIRF4
+ADDRLP4 60
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $334
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 3
+LTI4 $333
+CNSTI4 1
+RETI4
+ADDRGP4 $297
+JUMPV
+LABELV $330
+CNSTI4 0
+RETI4
+LABELV $297
+endproc AAS_ClipToBBox 168 12
+lit
+align 4
+LABELV $338
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export AAS_PlayerMovementPrediction
+code
+proc AAS_PlayerMovementPrediction 836 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 32
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 36
+ADDRFP4 36
+INDIRF4
+ASGNF4
+ADDRFP4 40
+ADDRFP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 44
+ADDRFP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 48
+ADDRFP4 48
+INDIRP4
+ASGNP4
+ADDRFP4 52
+ADDRFP4 52
+INDIRP4
+ASGNP4
+ADDRFP4 56
+ADDRFP4 56
+INDIRI4
+ASGNI4
+ADDRFP4 60
+ADDRFP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 452
+ADDRGP4 $338
+INDIRB
+ASGNB 12
+ADDRFP4 36
+INDIRF4
+CNSTF4 0
+GTF4 $339
+ADDRFP4 36
+CNSTF4 1036831949
+ASGNF4
+LABELV $339
+ADDRLP4 676
+ADDRGP4 aassettings+12
+INDIRF4
+ASGNF4
+ADDRLP4 680
+ADDRGP4 aassettings+16
+INDIRF4
+ASGNF4
+ADDRLP4 628
+ADDRGP4 aassettings+20
+INDIRF4
+ASGNF4
+ADDRLP4 684
+ADDRGP4 aassettings+24
+INDIRF4
+ASGNF4
+ADDRLP4 632
+ADDRGP4 aassettings+28
+INDIRF4
+ASGNF4
+ADDRLP4 612
+ADDRGP4 aassettings+36
+INDIRF4
+ASGNF4
+ADDRLP4 708
+ADDRGP4 aassettings+40
+INDIRF4
+ASGNF4
+ADDRLP4 700
+ADDRGP4 aassettings+44
+INDIRF4
+ASGNF4
+ADDRLP4 704
+ADDRGP4 aassettings+48
+INDIRF4
+ASGNF4
+ADDRLP4 688
+ADDRGP4 aassettings+52
+INDIRF4
+ASGNF4
+ADDRLP4 696
+ADDRGP4 aassettings+56
+INDIRF4
+ASGNF4
+ADDRLP4 592
+ADDRGP4 aassettings+60
+INDIRF4
+ASGNF4
+ADDRLP4 552
+ADDRGP4 aassettings+64
+INDIRF4
+ASGNF4
+ADDRLP4 712
+ADDRGP4 aassettings+76
+INDIRF4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 692
+ADDRGP4 aassettings+88
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 104
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 100
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 172
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 172+8
+ADDRLP4 172+8
+INDIRF4
+CNSTF4 1048576000
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 20
+INDIRP4
+INDIRF4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 532
+CNSTI4 -1
+ASGNI4
+ADDRLP4 464
+CNSTP4 0
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $362
+JUMPV
+LABELV $359
+ADDRLP4 172
+ARGP4
+ADDRLP4 724
+ADDRGP4 AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 568
+ADDRLP4 724
+INDIRI4
+ASGNI4
+ADDRLP4 568
+INDIRI4
+CNSTI4 0
+EQI4 $364
+ADDRLP4 728
+ADDRLP4 632
+INDIRF4
+ASGNF4
+ADDRGP4 $365
+JUMPV
+LABELV $364
+ADDRLP4 728
+ADDRLP4 628
+INDIRF4
+ASGNF4
+LABELV $365
+ADDRLP4 604
+ADDRLP4 728
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 604
+INDIRF4
+MULF4
+ADDRFP4 36
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 732
+CNSTI4 0
+ASGNI4
+ADDRFP4 16
+INDIRI4
+ADDRLP4 732
+INDIRI4
+NEI4 $370
+ADDRLP4 568
+INDIRI4
+ADDRLP4 732
+INDIRI4
+EQI4 $368
+LABELV $370
+ADDRLP4 568
+INDIRI4
+CNSTI4 0
+EQI4 $372
+ADDRLP4 736
+ADDRLP4 684
+INDIRF4
+ASGNF4
+ADDRGP4 $373
+JUMPV
+LABELV $372
+ADDRLP4 736
+ADDRLP4 676
+INDIRF4
+ASGNF4
+LABELV $373
+ADDRLP4 648
+ADDRLP4 736
+INDIRF4
+ASGNF4
+ADDRLP4 740
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 740
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 740
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 648
+INDIRF4
+ARGF4
+ADDRLP4 680
+INDIRF4
+ARGF4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRGP4 AAS_ApplyFriction
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+LABELV $368
+ADDRLP4 736
+CNSTI4 0
+ASGNI4
+ADDRLP4 608
+ADDRLP4 736
+INDIRI4
+ASGNI4
+ADDRFP4 28
+INDIRI4
+ADDRLP4 736
+INDIRI4
+GEI4 $382
+ADDRLP4 540
+ADDRFP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 172
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 540+4
+ADDRFP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 172+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 540+8
+ADDRFP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 172+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 540
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 540
+ADDRLP4 540
+INDIRF4
+ADDRLP4 612
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 540+4
+ADDRLP4 540+4
+INDIRF4
+ADDRLP4 612
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 540+8
+ADDRLP4 540+8
+INDIRF4
+ADDRLP4 612
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 664
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+ADDRLP4 540
+INDIRF4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 540+4
+INDIRF4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 540+8
+INDIRF4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 568
+INDIRI4
+CNSTI4 0
+NEI4 $383
+ADDRLP4 4+8
+ADDRLP4 664+8
+INDIRF4
+ASGNF4
+ADDRGP4 $383
+JUMPV
+LABELV $382
+ADDRLP4 16
+INDIRI4
+ADDRFP4 28
+INDIRI4
+GEI4 $400
+ADDRLP4 656
+ADDRLP4 612
+INDIRF4
+ASGNF4
+ADDRLP4 660
+ADDRLP4 688
+INDIRF4
+ASGNF4
+ADDRLP4 540
+ADDRFP4 24
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $402
+ADDRFP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 3281387520
+GEF4 $404
+ADDRLP4 608
+CNSTI4 1
+ASGNI4
+ADDRLP4 656
+ADDRLP4 708
+INDIRF4
+ASGNF4
+LABELV $404
+ADDRLP4 568
+INDIRI4
+CNSTI4 0
+NEI4 $406
+ADDRFP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $406
+ADDRLP4 4+8
+ADDRLP4 712
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 604
+INDIRF4
+MULF4
+ADDRFP4 36
+INDIRF4
+MULF4
+SUBF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+ADDRLP4 532
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 660
+ADDRLP4 688
+INDIRF4
+ASGNF4
+ADDRGP4 $407
+JUMPV
+LABELV $406
+ADDRLP4 660
+ADDRLP4 704
+INDIRF4
+ASGNF4
+LABELV $407
+LABELV $402
+ADDRLP4 568
+INDIRI4
+CNSTI4 0
+EQI4 $409
+ADDRLP4 656
+ADDRLP4 700
+INDIRF4
+ASGNF4
+ADDRLP4 660
+ADDRLP4 696
+INDIRF4
+ASGNF4
+ADDRGP4 $410
+JUMPV
+LABELV $409
+ADDRLP4 540+8
+CNSTF4 0
+ASGNF4
+LABELV $410
+ADDRLP4 540
+ARGP4
+ADDRLP4 740
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 652
+ADDRLP4 740
+INDIRF4
+ASGNF4
+ADDRLP4 652
+INDIRF4
+ADDRLP4 656
+INDIRF4
+LEF4 $412
+ADDRLP4 652
+ADDRLP4 656
+INDIRF4
+ASGNF4
+LABELV $412
+ADDRLP4 744
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 744
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 744
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRLP4 540
+ARGP4
+ADDRLP4 652
+INDIRF4
+ARGF4
+ADDRLP4 660
+INDIRF4
+ARGF4
+ADDRLP4 692
+INDIRF4
+ARGF4
+ADDRGP4 AAS_Accelerate
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+LABELV $400
+LABELV $383
+ADDRLP4 608
+INDIRI4
+CNSTI4 0
+EQI4 $422
+ADDRFP4 12
+CNSTI4 4
+ASGNI4
+ADDRGP4 $423
+JUMPV
+LABELV $422
+ADDRFP4 12
+INDIRI4
+CNSTI4 4
+NEI4 $424
+ADDRLP4 172
+ARGP4
+ADDRLP4 740
+ADDRGP4 AAS_PointPresenceType
+CALLI4
+ASGNI4
+ADDRLP4 740
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $426
+ADDRFP4 12
+CNSTI4 2
+ASGNI4
+LABELV $426
+LABELV $424
+LABELV $423
+ADDRLP4 636
+ADDRLP4 172
+INDIRB
+ASGNB 12
+ADDRLP4 160
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 524
+CNSTI4 0
+ASGNI4
+LABELV $428
+ADDRLP4 428
+ADDRLP4 172
+INDIRF4
+ADDRLP4 160
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 428+4
+ADDRLP4 172+4
+INDIRF4
+ADDRLP4 160+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 428+8
+ADDRLP4 172+8
+INDIRF4
+ADDRLP4 160+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 100
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRLP4 428
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 60
+INDIRI4
+ARGI4
+ADDRGP4 AAS_TracePlayerBBox
+CALLV
+pop
+ADDRFP4 40
+INDIRI4
+CNSTI4 4992
+BANDI4
+CNSTI4 0
+EQI4 $437
+ADDRLP4 172
+ARGP4
+ADDRLP4 100+8
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 188
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRLP4 740
+ADDRGP4 AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 740
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $443
+JUMPV
+LABELV $440
+ADDRFP4 40
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $444
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ADDRFP4 44
+INDIRI4
+NEI4 $446
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4+4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 100
+INDIRB
+ASGNB 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 512
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $446
+LABELV $444
+ADDRLP4 744
+CNSTI4 0
+ASGNI4
+ADDRFP4 40
+INDIRI4
+CNSTI4 128
+BANDI4
+ADDRLP4 744
+INDIRI4
+EQI4 $450
+ADDRLP4 16
+INDIRI4
+ADDRLP4 744
+INDIRI4
+EQI4 $450
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $452
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4+4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 100
+INDIRB
+ASGNB 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 128
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $452
+LABELV $450
+ADDRFP4 40
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $457
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $459
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4+4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 100
+INDIRB
+ASGNB 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 256
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $459
+LABELV $457
+ADDRFP4 40
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $464
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $466
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 188
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4+4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 100
+INDIRB
+ASGNB 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 4096
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $466
+LABELV $464
+LABELV $441
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $443
+ADDRLP4 0
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LTI4 $440
+LABELV $437
+ADDRFP4 40
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $471
+ADDRLP4 100
+ARGP4
+ADDRLP4 172
+ARGP4
+ADDRLP4 100+8
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 48
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRP4
+ARGP4
+ADDRLP4 740
+ADDRGP4 AAS_ClipToBBox
+CALLI4
+ASGNI4
+ADDRLP4 740
+INDIRI4
+CNSTI4 0
+EQI4 $473
+ADDRFP4 0
+INDIRP4
+ADDRLP4 100+8
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 748
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 748
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4+4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 100
+INDIRB
+ASGNB 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 2048
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $473
+LABELV $471
+ADDRLP4 172
+ADDRLP4 100+8
+INDIRB
+ASGNB 12
+ADDRLP4 100+4
+INDIRF4
+CNSTF4 1065353216
+GEF4 $480
+ADDRLP4 156
+ADDRLP4 100+36
+ASGNP4
+ADDRFP4 40
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $484
+ADDRLP4 156
+INDIRP4
+INDIRF4
+ADDRLP4 452
+INDIRF4
+MULF4
+ADDRLP4 156
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 452+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 156
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 452+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 552
+INDIRF4
+LEF4 $486
+ADDRLP4 440
+ADDRLP4 172
+INDIRB
+ASGNB 12
+ADDRLP4 440+8
+ADDRLP4 440+8
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRLP4 440
+ARGP4
+ADDRLP4 744
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 744
+INDIRI4
+ADDRFP4 44
+INDIRI4
+NEI4 $491
+ADDRFP4 0
+INDIRP4
+ADDRLP4 440
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4+4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 100
+INDIRB
+ASGNB 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 1024
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $491
+LABELV $486
+LABELV $484
+ADDRLP4 528
+CNSTI4 0
+ASGNI4
+ADDRLP4 156
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $495
+ADDRLP4 532
+INDIRI4
+CNSTI4 0
+LTI4 $497
+ADDRLP4 16
+INDIRI4
+ADDRLP4 532
+INDIRI4
+SUBI4
+CNSTI4 2
+LEI4 $495
+LABELV $497
+ADDRLP4 744
+CNSTF4 3196059648
+ASGNF4
+ADDRLP4 440
+ADDRLP4 172
+INDIRF4
+ADDRLP4 744
+INDIRF4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 440+4
+ADDRLP4 172+4
+INDIRF4
+ADDRLP4 744
+INDIRF4
+ADDRLP4 156
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 440+8
+ADDRLP4 172+8
+INDIRF4
+CNSTF4 3196059648
+ADDRLP4 156
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 572
+ADDRLP4 440
+INDIRB
+ASGNB 12
+ADDRLP4 440+8
+ADDRLP4 440+8
+INDIRF4
+ADDRLP4 592
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 468
+ARGP4
+ADDRLP4 440
+ARGP4
+ADDRLP4 572
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 60
+INDIRI4
+ARGI4
+ADDRGP4 AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+NEI4 $503
+ADDRLP4 584
+ADDRLP4 468+36
+ASGNP4
+ADDRLP4 584
+INDIRP4
+INDIRF4
+ADDRLP4 452
+INDIRF4
+MULF4
+ADDRLP4 584
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 452+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 584
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 452+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 552
+INDIRF4
+LEF4 $506
+ADDRLP4 160
+ADDRLP4 428
+INDIRF4
+ADDRLP4 468+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+4
+ADDRLP4 428+4
+INDIRF4
+ADDRLP4 468+8+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+8
+ADDRLP4 428+8
+INDIRF4
+ADDRLP4 468+8+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 172+8
+ADDRLP4 468+8+8
+INDIRF4
+ASGNF4
+ADDRLP4 528
+CNSTI4 1
+ASGNI4
+LABELV $506
+LABELV $503
+LABELV $495
+ADDRLP4 528
+INDIRI4
+CNSTI4 0
+NEI4 $524
+ADDRLP4 744
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 752
+ADDRLP4 156
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 756
+ADDRLP4 156
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 760
+ADDRLP4 156
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 160
+ADDRLP4 744
+INDIRF4
+ADDRLP4 752
+INDIRF4
+ADDRLP4 744
+INDIRF4
+ADDRLP4 752
+INDIRF4
+MULF4
+ADDRLP4 160+4
+INDIRF4
+ADDRLP4 756
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 160+8
+INDIRF4
+ADDRLP4 760
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 764
+ADDRLP4 756
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 160+4
+ADDRLP4 160+4
+INDIRF4
+ADDRLP4 764
+INDIRF4
+ADDRLP4 160
+INDIRF4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 160+4
+INDIRF4
+ADDRLP4 764
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 160+8
+INDIRF4
+ADDRLP4 760
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 772
+ADDRLP4 156
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 160+8
+ADDRLP4 160+8
+INDIRF4
+ADDRLP4 772
+INDIRF4
+ADDRLP4 160
+INDIRF4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 160+4
+INDIRF4
+ADDRLP4 156
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 160+8
+INDIRF4
+ADDRLP4 772
+INDIRF4
+MULF4
+ADDF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 464
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $536
+ADDRLP4 784
+CNSTI4 4
+ASGNI4
+ADDRLP4 788
+CNSTI4 8
+ASGNI4
+ADDRLP4 464
+INDIRP4
+INDIRF4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 464
+INDIRP4
+ADDRLP4 784
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 784
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 464
+INDIRP4
+ADDRLP4 788
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 788
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1065185444
+LEF4 $536
+ADDRLP4 160
+ADDRLP4 156
+INDIRP4
+INDIRF4
+ADDRLP4 160
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 160+4
+ADDRLP4 156
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 160+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 160+8
+ADDRLP4 156
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 160+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $536
+ADDRLP4 464
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 556
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 796
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 800
+ADDRLP4 156
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 804
+ADDRLP4 156
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 808
+ADDRLP4 156
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 796
+INDIRF4
+ADDRLP4 800
+INDIRF4
+ADDRLP4 796
+INDIRF4
+ADDRLP4 800
+INDIRF4
+MULF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 804
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 808
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 812
+ADDRLP4 804
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 812
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 812
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 808
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 820
+ADDRLP4 156
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 820
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 156
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 820
+INDIRF4
+MULF4
+ADDF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+ADDRLP4 452
+INDIRF4
+MULF4
+ADDRLP4 156
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 452+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 156
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 452+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 552
+INDIRF4
+LEF4 $552
+ADDRFP4 16
+CNSTI4 1
+ASGNI4
+LABELV $552
+ADDRFP4 40
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $556
+ADDRLP4 536
+CNSTF4 0
+ASGNF4
+ADDRLP4 556+8
+INDIRF4
+CNSTF4 0
+GEF4 $558
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 556+8
+INDIRF4
+LEF4 $558
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $558
+ADDRLP4 536
+ADDRLP4 556+8
+INDIRF4
+ASGNF4
+ADDRGP4 $559
+JUMPV
+LABELV $558
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $564
+ADDRLP4 536
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 556+8
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $564
+LABELV $559
+ADDRLP4 536
+INDIRF4
+CNSTF4 0
+EQF4 $568
+ADDRLP4 536
+CNSTF4 1092616192
+ADDRLP4 536
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 536
+CNSTF4 953267991
+ADDRLP4 536
+INDIRF4
+ADDRLP4 536
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 568
+INDIRI4
+CNSTI4 0
+EQI4 $570
+ADDRLP4 536
+CNSTF4 0
+ASGNF4
+LABELV $570
+ADDRLP4 536
+INDIRF4
+CNSTF4 1109393408
+LEF4 $572
+ADDRFP4 0
+INDIRP4
+ADDRLP4 172
+INDIRB
+ASGNB 12
+ADDRLP4 172
+ARGP4
+ADDRLP4 832
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 832
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 100
+INDIRB
+ASGNB 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 32
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $574
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AAS_DebugLine
+CALLV
+pop
+LABELV $574
+CNSTI4 1
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $572
+LABELV $568
+LABELV $556
+LABELV $524
+LABELV $480
+ADDRLP4 740
+ADDRLP4 524
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 524
+ADDRLP4 740
+INDIRI4
+ASGNI4
+ADDRLP4 740
+INDIRI4
+CNSTI4 20
+LEI4 $576
+CNSTI4 0
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $576
+LABELV $429
+ADDRLP4 100+4
+INDIRF4
+CNSTF4 1065353216
+LTF4 $428
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1092616192
+GTF4 $579
+ADDRLP4 616
+ADDRLP4 172
+INDIRB
+ASGNB 12
+ADDRLP4 616+8
+ADDRLP4 616+8
+INDIRF4
+CNSTF4 1102053376
+SUBF4
+ASGNF4
+ADDRLP4 616
+ARGP4
+ADDRLP4 740
+ADDRGP4 AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 596
+ADDRLP4 740
+INDIRI4
+ASGNI4
+ADDRLP4 744
+CNSTI4 0
+ASGNI4
+ADDRLP4 588
+ADDRLP4 744
+INDIRI4
+ASGNI4
+ADDRLP4 596
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 744
+INDIRI4
+EQI4 $583
+ADDRLP4 588
+ADDRLP4 588
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $583
+ADDRLP4 596
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $585
+ADDRLP4 588
+ADDRLP4 588
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $585
+ADDRLP4 596
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $587
+ADDRLP4 588
+ADDRLP4 588
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $587
+ADDRLP4 172
+ARGP4
+ADDRLP4 748
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 600
+ADDRLP4 748
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 600
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $589
+ADDRLP4 588
+ADDRLP4 588
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $589
+CNSTI4 28
+ADDRLP4 600
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $592
+ADDRLP4 588
+ADDRLP4 588
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $592
+CNSTI4 28
+ADDRLP4 600
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $595
+ADDRLP4 588
+ADDRLP4 588
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $595
+ADDRLP4 588
+INDIRI4
+ADDRFP4 40
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $598
+ADDRFP4 0
+INDIRP4
+ADDRLP4 172
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 600
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4+4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 588
+INDIRI4
+ADDRFP4 40
+INDIRI4
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 596
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $602
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 AAS_DebugLine
+CALLV
+pop
+LABELV $602
+CNSTI4 1
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $598
+LABELV $579
+ADDRLP4 172
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 60
+INDIRI4
+ARGI4
+ADDRLP4 740
+ADDRGP4 AAS_OnGround
+CALLI4
+ASGNI4
+ADDRFP4 16
+ADDRLP4 740
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $604
+ADDRFP4 40
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $605
+ADDRFP4 0
+INDIRP4
+ADDRLP4 172
+INDIRB
+ASGNB 12
+ADDRLP4 172
+ARGP4
+ADDRLP4 744
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 744
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4+4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 100
+INDIRB
+ASGNB 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $604
+ADDRFP4 40
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $610
+ADDRFP4 0
+INDIRP4
+ADDRLP4 172
+INDIRB
+ASGNB 12
+ADDRLP4 172
+ARGP4
+ADDRLP4 744
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 744
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4+4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 100
+INDIRB
+ASGNB 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $610
+ADDRFP4 40
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $614
+ADDRLP4 440
+ADDRLP4 172
+INDIRB
+ASGNB 12
+ADDRLP4 428
+ADDRLP4 440
+INDIRB
+ASGNB 12
+ADDRLP4 428+8
+ADDRLP4 428+8
+INDIRF4
+ADDRGP4 aassettings+72
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+SUBF4
+ASGNF4
+ADDRLP4 744
+ARGP4
+ADDRLP4 440
+ARGP4
+ADDRLP4 428
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 60
+INDIRI4
+ARGI4
+ADDRGP4 AAS_TracePlayerBBox
+CALLV
+pop
+ADDRLP4 744
+INDIRI4
+CNSTI4 0
+NEI4 $618
+ADDRLP4 744+8+8
+INDIRF4
+ADDRLP4 172+8
+INDIRF4
+ADDRGP4 aassettings+60
+INDIRF4
+SUBF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $620
+ADDRLP4 428
+ARGP4
+ADDRLP4 800
+ADDRGP4 AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 800
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $626
+ADDRFP4 0
+INDIRP4
+ADDRLP4 636
+INDIRB
+ASGNB 12
+ADDRLP4 636
+ARGP4
+ADDRLP4 804
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 804
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4+4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 100
+INDIRB
+ASGNB 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 64
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $630
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRGP4 AAS_DebugLine
+CALLV
+pop
+LABELV $630
+CNSTI4 1
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $626
+LABELV $620
+LABELV $618
+LABELV $614
+LABELV $605
+LABELV $360
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $362
+ADDRLP4 16
+INDIRI4
+ADDRFP4 32
+INDIRI4
+LTI4 $359
+ADDRFP4 0
+INDIRP4
+ADDRLP4 172
+INDIRB
+ASGNB 12
+ADDRLP4 172
+ARGP4
+ADDRLP4 724
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 724
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4+4
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+ADDRFP4 36
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRFP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $634
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 AAS_DebugLine
+CALLV
+pop
+LABELV $634
+CNSTI4 1
+RETI4
+LABELV $337
+endproc AAS_PlayerMovementPrediction 836 24
+export AAS_PredictPlayerMovement
+proc AAS_PredictPlayerMovement 28 64
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRFP4 40
+INDIRI4
+ARGI4
+ADDRFP4 44
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 AAS_PlayerMovementPrediction
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+LABELV $636
+endproc AAS_PredictPlayerMovement 28 64
+export AAS_PlayerMovementHitBBox
+proc AAS_PlayerMovementHitBBox 4 64
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRFP4 36
+INDIRF4
+ARGF4
+CNSTI4 2048
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 40
+INDIRP4
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 AAS_PlayerMovementPrediction
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $637
+endproc AAS_PlayerMovementHitBBox 4 64
+export AAS_TestMovementPrediction
+proc AAS_TestMovementPrediction 152 56
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 128
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $641
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $641
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 136
+CNSTF4 1137180672
+ASGNF4
+ADDRLP4 0
+ADDRLP4 136
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 136
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1137180672
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1130364928
+ASGNF4
+ADDRGP4 AAS_ClearShownDebugLines
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 144
+CNSTI4 1
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+CNSTI4 13
+ASGNI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 144
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 AAS_PredictPlayerMovement
+CALLI4
+pop
+ADDRLP4 24+88
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $646
+CNSTI4 1
+ARGI4
+ADDRGP4 $650
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $646
+LABELV $638
+endproc AAS_TestMovementPrediction 152 56
+export AAS_HorizontalVelocityForJump
+proc AAS_HorizontalVelocityForJump 76 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 aassettings+20
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 aassettings+32
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 8
+ASGNI4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 32
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 0
+GEF4 $654
+ADDRFP4 12
+INDIRP4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $651
+JUMPV
+LABELV $654
+ADDRLP4 20
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRF4
+MULF4
+DIVF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 60
+CNSTI4 4
+ASGNI4
+ADDRLP4 4+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 8
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+DIVF4
+ADDF4
+CNSTF4 0
+NEF4 $658
+ADDRFP4 12
+INDIRP4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $651
+JUMPV
+LABELV $658
+ADDRLP4 68
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 68
+INDIRF4
+MULF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+DIVF4
+ADDF4
+DIVF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $662
+ADDRFP4 12
+INDIRP4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $651
+JUMPV
+LABELV $662
+CNSTI4 1
+RETI4
+LABELV $651
+endproc AAS_HorizontalVelocityForJump 76 4
+import botimport
+bss
+export aassettings
+align 4
+LABELV aassettings
+skip 160
+import AAS_PrintFreeBSPLinks
+import AAS_EntityCollision
+import AAS_BSPLinkEntity
+import AAS_UnlinkFromBSPLeaves
+import AAS_DumpBSPData
+import AAS_LoadBSPFile
+import AAS_FileInfo
+import AAS_DumpAASData
+import AAS_FreeAASLump
+import AAS_WriteCompactAASFile
+import AAS_WriteAASFile
+import AAS_LoadCompactAASFile
+import AAS_LoadAASFile
+import AAS_ShutdownAlternativeRouting
+import AAS_InitAlternativeRouting
+import AAS_RoutingCacheInfo
+import AAS_RoutingInfo
+import AAS_ReadRouteTables
+import AAS_WriteRouteTables
+import AAS_WriteRouteCache
+import AAS_CreateAllRoutingCache
+import AAS_FreeRoutingCaches
+import AAS_InitRouting
+import AAS_BestReachableLinkArea
+import AAS_ContinueInitReachability
+import AAS_InitReachability
+import AAS_SetViewPortalsAsClusterPortals
+import AAS_InitClustering
+import AAS_SampleBenchmark
+import AAS_FreeFlatNodes
+import AAS_InitFlatNodes
+import AAS_FreeReachabilityAreaGrid
+import AAS_InitReachabilityAreaGrid
+import AAS_UnlinkFromAreas
+import AAS_InsideFace
+import AAS_PointInsideFace
+import AAS_LinkEntityClientBBox
+import AAS_AASLinkEntity
+import AAS_PlaneFromNum
+import AAS_TraceEndFace
+import AAS_AreaGroundFace
+import AAS_FreeAASLinkedEntities
+import AAS_FreeAASLinkHeap
+import AAS_InitAASLinkedEntities
+import AAS_InitAASLinkHeap
+import AAS_UpdateEntities
+import AAS_UpdateEntity
+import AAS_ResetEntityLinks
+import AAS_UnlinkInvalidEntities
+import AAS_InvalidateEntities
+import AAS_StartFrame
+import AAS_LoadMap
+import AAS_Shutdown
+import AAS_Setup
+import AAS_SetInitialized
+import AAS_Error
+import aasworld
+import AAS_IntForBSPEpairKey
+import AAS_FloatForBSPEpairKey
+import AAS_VectorForBSPEpairKey
+import AAS_ValueForBSPEpairKey
+import AAS_NextBSPEntity
+import AAS_BSPModelMinsMaxsOrigin
+import AAS_BoxEntities
+import AAS_AreasConnected
+import AAS_inPHS
+import AAS_inPVS
+import AAS_PointContents
+import AAS_Trace
+import AAS_Optimize
+import AAS_FloodAreas
+import AAS_ShowReachableAreas
+import AAS_ShowReachability
+import AAS_DrawArrow
+import AAS_PrintTravelType
+import AAS_DrawCross
+import AAS_ShowAreaPolygons
+import AAS_ShowArea
+import AAS_ShowFace
+import AAS_ShowBoundingBox
+import AAS_DrawPlaneCross
+import AAS_DrawPermanentCross
+import AAS_PermanentLine
+import AAS_DebugLine
+import AAS_ClearShownPolygons
+import AAS_ClearShownDebugLines
+import AAS_AlternativeRouteGoals
+import AAS_PredictRoute
+import AAS_AreaTravelTimeToGoalArea
+import AAS_AreaTravelTime
+import AAS_EnableRoutingArea
+import AAS_RandomGoalArea
+import AAS_ReachabilityFromNum
+import AAS_NextAreaReachability
+import AAS_AreaContentsTravelFlags
+import AAS_TravelFlagForType
+import AAS_AreaDoNotEnter
+import AAS_AreaJumpPad
+import AAS_AreaLadder
+import AAS_AreaGrounded
+import AAS_AreaSlime
+import AAS_AreaLava
+import AAS_AreaLiquid
+import AAS_AreaSwim
+import AAS_AreaCrouch
+import AAS_AreaGroundFaceArea
+import AAS_NextModelReachability
+import AAS_BestReachableFromJumpPadArea
+import AAS_BestReachableArea
+import AAS_AreaReachability
+import AAS_FacePlane
+import AAS_PointReachabilityAreaIndex
+import AAS_PointAreaNum
+import AAS_AreaInfo
+import AAS_PointInsideArea
+import AAS_BBoxReachabilityAreas
+import AAS_BBoxAreas
+import AAS_TraceAreas
+import AAS_TracePlayerBBox
+import AAS_PointPresenceType
+import AAS_AreaPresenceType
+import AAS_AreaCluster
+import AAS_PresenceTypeBoundingBox
+import AAS_ProjectPointOntoVector
+import AAS_Time
+import AAS_Loaded
+import AAS_Initialized
+import GetBotLibAPI
+import LibVarSetNotModified
+import LibVarChanged
+import LibVarSet
+import LibVarString
+import LibVarValue
+import LibVar
+import LibVarGetValue
+import LibVarGetString
+import LibVarGet
+import LibVarDeAllocAll
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $650
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $130
+byte 1 52
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $129
+byte 1 114
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $127
+byte 1 48
+byte 1 0
+align 1
+LABELV $126
+byte 1 114
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $124
+byte 1 114
+byte 1 115
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $122
+byte 1 114
+byte 1 115
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 53
+byte 1 0
+align 1
+LABELV $120
+byte 1 114
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $118
+byte 1 114
+byte 1 115
+byte 1 95
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 0
+align 1
+LABELV $116
+byte 1 114
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $114
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $113
+byte 1 114
+byte 1 115
+byte 1 95
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $111
+byte 1 114
+byte 1 115
+byte 1 95
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $109
+byte 1 114
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $107
+byte 1 114
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $105
+byte 1 55
+byte 1 48
+byte 1 0
+align 1
+LABELV $104
+byte 1 114
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $102
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $101
+byte 1 114
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $99
+byte 1 51
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $98
+byte 1 114
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $96
+byte 1 114
+byte 1 115
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $94
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $93
+byte 1 114
+byte 1 115
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $91
+byte 1 114
+byte 1 115
+byte 1 95
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $89
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 102
+byte 1 101
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $87
+byte 1 54
+byte 1 48
+byte 1 0
+align 1
+LABELV $86
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 97
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $84
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $83
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 97
+byte 1 53
+byte 1 0
+align 1
+LABELV $81
+byte 1 50
+byte 1 55
+byte 1 48
+byte 1 0
+align 1
+LABELV $80
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $78
+byte 1 51
+byte 1 51
+byte 1 0
+align 1
+LABELV $77
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $75
+byte 1 49
+byte 1 56
+byte 1 0
+align 1
+LABELV $74
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $72
+byte 1 48
+byte 1 46
+byte 1 55
+byte 1 0
+align 1
+LABELV $71
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $69
+byte 1 49
+byte 1 57
+byte 1 0
+align 1
+LABELV $68
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 0
+align 1
+LABELV $66
+byte 1 52
+byte 1 0
+align 1
+LABELV $65
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $63
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $61
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $60
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $58
+byte 1 49
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $57
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 109
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $55
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 99
+byte 1 104
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $53
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 119
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $51
+byte 1 51
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $50
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $48
+byte 1 52
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $47
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $45
+byte 1 49
+byte 1 0
+align 1
+LABELV $44
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $42
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $41
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $39
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $38
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $36
+byte 1 54
+byte 1 0
+align 1
+LABELV $35
+byte 1 112
+byte 1 104
+byte 1 121
+byte 1 115
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
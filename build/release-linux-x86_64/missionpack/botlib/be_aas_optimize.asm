@@ -0,0 +1,1810 @@
+export AAS_KeepEdge
+code
+proc AAS_KeepEdge 0 0
+CNSTI4 1
+RETI4
+LABELV $25
+endproc AAS_KeepEdge 0 0
+export AAS_OptimizeEdge
+proc AAS_OptimizeEdge 56 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 AAS_KeepEdge
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $28
+CNSTI4 0
+RETI4
+ADDRGP4 $26
+JUMPV
+LABELV $28
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $30
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $32
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $26
+JUMPV
+LABELV $32
+ADDRLP4 12
+INDIRI4
+NEGI4
+RETI4
+ADDRGP4 $26
+JUMPV
+LABELV $30
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $34
+ADDRLP4 32
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $38
+ADDRLP4 36
+CNSTI4 2
+ASGNI4
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $39
+JUMPV
+LABELV $38
+ADDRLP4 36
+CNSTI4 12
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $39
+LABELV $35
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $34
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 40
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $41
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $26
+JUMPV
+LABELV $41
+ADDRLP4 12
+INDIRI4
+NEGI4
+RETI4
+LABELV $26
+endproc AAS_OptimizeEdge 56 4
+export AAS_KeepFace
+proc AAS_KeepFace 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $44
+CNSTI4 0
+RETI4
+ADDRGP4 $43
+JUMPV
+LABELV $44
+CNSTI4 1
+RETI4
+LABELV $43
+endproc AAS_KeepFace 0 0
+export AAS_OptimizeFace
+proc AAS_OptimizeFace 60 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 24
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 AAS_KeepFace
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $48
+CNSTI4 0
+RETI4
+ADDRGP4 $46
+JUMPV
+LABELV $48
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $50
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $52
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $46
+JUMPV
+LABELV $52
+ADDRLP4 20
+INDIRI4
+NEGI4
+RETI4
+ADDRGP4 $46
+JUMPV
+LABELV $50
+ADDRLP4 36
+CNSTI4 24
+ASGNI4
+ADDRLP4 16
+ADDRLP4 36
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTU4 24
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $57
+JUMPV
+LABELV $54
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 AAS_OptimizeEdge
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $59
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $59
+LABELV $55
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $57
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $54
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRP4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 52
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $61
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $46
+JUMPV
+LABELV $61
+ADDRLP4 20
+INDIRI4
+NEGI4
+RETI4
+LABELV $46
+endproc AAS_OptimizeFace 60 12
+export AAS_OptimizeArea
+proc AAS_OptimizeArea 40 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 48
+ADDRFP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTU4 48
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $68
+JUMPV
+LABELV $65
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 AAS_OptimizeFace
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $70
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $70
+LABELV $66
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $68
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $65
+LABELV $63
+endproc AAS_OptimizeArea 40 12
+export AAS_OptimizeAlloc
+proc AAS_OptimizeAlloc 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTU4 12
+ADDRGP4 aasworld+168
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRLP4 0
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+184
+INDIRI4
+CVIU4 4
+CNSTI4 3
+LSHU4
+ARGU4
+ADDRLP4 4
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 aasworld+192
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ARGU4
+ADDRLP4 8
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTU4 24
+ADDRGP4 aasworld+200
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRLP4 12
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 aasworld+208
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ARGU4
+ADDRLP4 16
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTU4 48
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRLP4 20
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRGP4 aasworld+216
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld+168
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ARGU4
+ADDRLP4 24
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+184
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ARGU4
+ADDRLP4 28
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+200
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ARGU4
+ADDRLP4 32
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 32
+INDIRP4
+ASGNP4
+LABELV $72
+endproc AAS_OptimizeAlloc 36 4
+export AAS_OptimizeStore
+proc AAS_OptimizeStore 0 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+172
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+172
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+168
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld+188
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+188
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+184
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld+196
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+196
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+192
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld+204
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+204
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+200
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld+212
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+212
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+208
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld+220
+INDIRP4
+ARGP4
+ADDRGP4 AAS_FreeAASLump
+CALLV
+pop
+ADDRGP4 aasworld+220
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+216
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $83
+endproc AAS_OptimizeStore 0 4
+export AAS_Optimize
+proc AAS_Optimize 108 8
+ADDRLP4 8
+ARGP4
+ADDRGP4 AAS_OptimizeAlloc
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $103
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 AAS_OptimizeArea
+CALLV
+pop
+LABELV $104
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $106
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $103
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $111
+JUMPV
+LABELV $108
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 16777215
+BANDI4
+CNSTI4 11
+NEI4 $113
+ADDRGP4 $109
+JUMPV
+LABELV $113
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 16777215
+BANDI4
+CNSTI4 18
+NEI4 $116
+ADDRGP4 $109
+JUMPV
+LABELV $116
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 16777215
+BANDI4
+CNSTI4 19
+NEI4 $119
+ADDRGP4 $109
+JUMPV
+LABELV $119
+ADDRLP4 68
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 68
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ADDRLP4 76
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8+56
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $126
+ADDRLP4 80
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 84
+CNSTI4 4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+ADDRLP4 80
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $126
+ADDRLP4 88
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 92
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+ADDRLP4 88
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+ADDRLP4 96
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8+52
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $134
+ADDRLP4 100
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 104
+CNSTI4 8
+ASGNI4
+ADDRLP4 100
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+ADDRLP4 100
+INDIRI4
+ADDRGP4 aasworld+236
+INDIRP4
+ADDP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $134
+LABELV $109
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $111
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+232
+INDIRI4
+LTI4 $108
+ADDRLP4 8
+ARGP4
+ADDRGP4 AAS_OptimizeStore
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $139
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $102
+endproc AAS_Optimize 108 8
+import aassettings
+import AAS_PrintFreeBSPLinks
+import AAS_EntityCollision
+import AAS_BSPLinkEntity
+import AAS_UnlinkFromBSPLeaves
+import AAS_DumpBSPData
+import AAS_LoadBSPFile
+import AAS_FileInfo
+import AAS_DumpAASData
+import AAS_FreeAASLump
+import AAS_WriteCompactAASFile
+import AAS_WriteAASFile
+import AAS_LoadCompactAASFile
+import AAS_LoadAASFile
+import AAS_ShutdownAlternativeRouting
+import AAS_InitAlternativeRouting
+import AAS_RoutingCacheInfo
+import AAS_RoutingInfo
+import AAS_ReadRouteTables
+import AAS_WriteRouteTables
+import AAS_WriteRouteCache
+import AAS_CreateAllRoutingCache
+import AAS_FreeRoutingCaches
+import AAS_InitRouting
+import AAS_BestReachableLinkArea
+import AAS_ContinueInitReachability
+import AAS_InitReachability
+import AAS_SetViewPortalsAsClusterPortals
+import AAS_InitClustering
+import AAS_SampleBenchmark
+import AAS_FreeFlatNodes
+import AAS_InitFlatNodes
+import AAS_FreeReachabilityAreaGrid
+import AAS_InitReachabilityAreaGrid
+import AAS_UnlinkFromAreas
+import AAS_InsideFace
+import AAS_PointInsideFace
+import AAS_LinkEntityClientBBox
+import AAS_AASLinkEntity
+import AAS_PlaneFromNum
+import AAS_TraceEndFace
+import AAS_AreaGroundFace
+import AAS_FreeAASLinkedEntities
+import AAS_FreeAASLinkHeap
+import AAS_InitAASLinkedEntities
+import AAS_InitAASLinkHeap
+import AAS_UpdateEntities
+import AAS_UpdateEntity
+import AAS_ResetEntityLinks
+import AAS_UnlinkInvalidEntities
+import AAS_InvalidateEntities
+import AAS_StartFrame
+import AAS_LoadMap
+import AAS_Shutdown
+import AAS_Setup
+import AAS_SetInitialized
+import AAS_Error
+import aasworld
+import botDeveloper
+import botimport
+import botlibglobals
+import AAS_InitSettings
+import AAS_DropToFloor
+import AAS_SetMovedir
+import AAS_HorizontalVelocityForJump
+import AAS_BFGJumpZVelocity
+import AAS_RocketJumpZVelocity
+import AAS_AgainstLadder
+import AAS_JumpReachRunStart
+import AAS_Swimming
+import AAS_OnGround
+import AAS_PlayerMovementHitBBox
+import AAS_PredictPlayerMovement
+import AAS_IntForBSPEpairKey
+import AAS_FloatForBSPEpairKey
+import AAS_VectorForBSPEpairKey
+import AAS_ValueForBSPEpairKey
+import AAS_NextBSPEntity
+import AAS_BSPModelMinsMaxsOrigin
+import AAS_BoxEntities
+import AAS_AreasConnected
+import AAS_inPHS
+import AAS_inPVS
+import AAS_PointContents
+import AAS_Trace
+import AAS_FloodAreas
+import AAS_ShowReachableAreas
+import AAS_ShowReachability
+import AAS_DrawArrow
+import AAS_PrintTravelType
+import AAS_DrawCross
+import AAS_ShowAreaPolygons
+import AAS_ShowArea
+import AAS_ShowFace
+import AAS_ShowBoundingBox
+import AAS_DrawPlaneCross
+import AAS_DrawPermanentCross
+import AAS_PermanentLine
+import AAS_DebugLine
+import AAS_ClearShownPolygons
+import AAS_ClearShownDebugLines
+import AAS_AlternativeRouteGoals
+import AAS_PredictRoute
+import AAS_AreaTravelTimeToGoalArea
+import AAS_AreaTravelTime
+import AAS_EnableRoutingArea
+import AAS_RandomGoalArea
+import AAS_ReachabilityFromNum
+import AAS_NextAreaReachability
+import AAS_AreaContentsTravelFlags
+import AAS_TravelFlagForType
+import AAS_AreaDoNotEnter
+import AAS_AreaJumpPad
+import AAS_AreaLadder
+import AAS_AreaGrounded
+import AAS_AreaSlime
+import AAS_AreaLava
+import AAS_AreaLiquid
+import AAS_AreaSwim
+import AAS_AreaCrouch
+import AAS_AreaGroundFaceArea
+import AAS_NextModelReachability
+import AAS_BestReachableFromJumpPadArea
+import AAS_BestReachableArea
+import AAS_AreaReachability
+import AAS_FacePlane
+import AAS_PointReachabilityAreaIndex
+import AAS_PointAreaNum
+import AAS_AreaInfo
+import AAS_PointInsideArea
+import AAS_BBoxReachabilityAreas
+import AAS_BBoxAreas
+import AAS_TraceAreas
+import AAS_TracePlayerBBox
+import AAS_PointPresenceType
+import AAS_AreaPresenceType
+import AAS_AreaCluster
+import AAS_PresenceTypeBoundingBox
+import AAS_ProjectPointOntoVector
+import AAS_Time
+import AAS_Loaded
+import AAS_Initialized
+import GetBotLibAPI
+import DumpMemory
+import MemoryByteSize
+import PrintMemoryLabels
+import PrintUsedMemorySize
+import AvailableMemory
+import FreeMemory
+import GetClearedHunkMemory
+import GetHunkMemory
+import GetClearedMemory
+import GetMemory
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $139
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
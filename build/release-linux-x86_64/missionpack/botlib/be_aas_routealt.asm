@@ -0,0 +1,1385 @@
+export AAS_AltRoutingFloodCluster_r
+code
+proc AAS_AltRoutingFloodCluster_r 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 numclusterareas
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 clusterareas
+INDIRP4
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 numclusterareas
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 midrangeareas
+INDIRP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $30
+JUMPV
+LABELV $27
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 24
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $33
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $34
+JUMPV
+LABELV $33
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $34
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $35
+ADDRGP4 $28
+JUMPV
+LABELV $35
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 midrangeareas
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $37
+ADDRGP4 $28
+JUMPV
+LABELV $37
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 AAS_AltRoutingFloodCluster_r
+CALLV
+pop
+LABELV $28
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $30
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $27
+LABELV $25
+endproc AAS_AltRoutingFloodCluster_r 24 4
+export AAS_AlternativeRouteGoals
+proc AAS_AlternativeRouteGoals 100 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $42
+ADDRFP4 12
+INDIRI4
+ADDRLP4 64
+INDIRI4
+NEI4 $40
+LABELV $42
+CNSTI4 0
+RETI4
+ADDRGP4 $39
+JUMPV
+LABELV $40
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 midrangeareas
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+CNSTI4 3
+LSHU4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $47
+JUMPV
+LABELV $44
+ADDRFP4 28
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $49
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRFP4 28
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 76
+INDIRI4
+EQI4 $54
+CNSTI4 28
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 76
+INDIRI4
+NEI4 $51
+LABELV $54
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRFP4 28
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 80
+INDIRI4
+EQI4 $58
+CNSTI4 28
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+ADDRLP4 80
+INDIRI4
+NEI4 $55
+LABELV $58
+ADDRGP4 $45
+JUMPV
+LABELV $55
+LABELV $51
+LABELV $49
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $59
+ADDRGP4 $45
+JUMPV
+LABELV $59
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $61
+ADDRGP4 $45
+JUMPV
+LABELV $61
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+CNSTF4 1066192077
+ADDRLP4 56
+INDIRI4
+CVIF4 4
+MULF4
+LEF4 $63
+ADDRGP4 $45
+JUMPV
+LABELV $63
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $65
+ADDRGP4 $45
+JUMPV
+LABELV $65
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+CNSTF4 1061997773
+ADDRLP4 56
+INDIRI4
+CVIF4 4
+MULF4
+LEF4 $67
+ADDRGP4 $45
+JUMPV
+LABELV $67
+ADDRLP4 36
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 midrangeareas
+INDIRP4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 midrangeareas
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 48
+INDIRI4
+CVIU4 4
+CVUU2 4
+ASGNU2
+ADDRLP4 36
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 midrangeareas
+INDIRP4
+ADDP4
+CNSTI4 6
+ADDP4
+ADDRLP4 52
+INDIRI4
+CVIU4 4
+CVUU2 4
+ASGNU2
+ADDRGP4 $69
+ARGP4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 Log_Write
+CALLV
+pop
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $45
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $47
+ADDRLP4 36
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $44
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $73
+JUMPV
+LABELV $70
+ADDRLP4 36
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 midrangeareas
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $75
+ADDRGP4 $71
+JUMPV
+LABELV $75
+ADDRGP4 numclusterareas
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 AAS_AltRoutingFloodCluster_r
+CALLV
+pop
+ADDRLP4 76
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $82
+JUMPV
+LABELV $79
+ADDRLP4 80
+CNSTI4 48
+ASGNI4
+ADDRLP4 84
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 clusterareas
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 80
+INDIRI4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 80
+INDIRI4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CNSTI4 48
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 clusterareas
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $80
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $82
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numclusterareas
+INDIRI4
+LTI4 $79
+ADDRLP4 80
+CNSTF4 1065353216
+ADDRGP4 numclusterareas
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 80
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 80
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1065353216
+ADDRGP4 numclusterareas
+INDIRI4
+CVIF4 4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1232348144
+ASGNF4
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRGP4 $97
+JUMPV
+LABELV $94
+ADDRLP4 88
+CNSTI4 48
+ASGNI4
+ADDRLP4 92
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 clusterareas
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 4
+INDIRF4
+ADDRLP4 88
+INDIRI4
+ADDRLP4 92
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 88
+INDIRI4
+ADDRLP4 92
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 40
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 4+8
+INDIRF4
+CNSTI4 48
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 clusterareas
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 44
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 96
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 96
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32
+INDIRF4
+GEF4 $105
+ADDRLP4 32
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 clusterareas
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $105
+LABELV $95
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $97
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numclusterareas
+INDIRI4
+LTI4 $94
+CNSTI4 24
+ADDRLP4 44
+INDIRI4
+MULI4
+ADDRFP4 20
+INDIRP4
+ADDP4
+CNSTI4 48
+ADDRLP4 40
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 24
+ADDRLP4 44
+INDIRI4
+MULI4
+ADDRFP4 20
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+CNSTI4 24
+ADDRLP4 44
+INDIRI4
+MULI4
+ADDRFP4 20
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 midrangeareas
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRU2
+ASGNU2
+CNSTI4 24
+ADDRLP4 44
+INDIRI4
+MULI4
+ADDRFP4 20
+INDIRP4
+ADDP4
+CNSTI4 18
+ADDP4
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 midrangeareas
+INDIRP4
+ADDP4
+CNSTI4 6
+ADDP4
+INDIRU2
+ASGNU2
+ADDRLP4 88
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 midrangeareas
+INDIRP4
+ADDP4
+ASGNP4
+CNSTI4 24
+ADDRLP4 44
+INDIRI4
+MULI4
+ADDRFP4 20
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+ADDRLP4 88
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU2
+CVUI4 2
+ADDRLP4 88
+INDIRP4
+CNSTI4 6
+ADDP4
+INDIRU2
+CVUI4 2
+ADDI4
+ADDRLP4 56
+INDIRI4
+SUBI4
+CVIU4 4
+CVUU2 4
+ASGNU2
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 24
+INDIRI4
+LTI4 $108
+ADDRGP4 $72
+JUMPV
+LABELV $108
+LABELV $71
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $73
+ADDRLP4 36
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $70
+LABELV $72
+ADDRLP4 44
+INDIRI4
+RETI4
+LABELV $39
+endproc AAS_AlternativeRouteGoals 100 16
+export AAS_InitAlternativeRouting
+proc AAS_InitAlternativeRouting 8 4
+ADDRGP4 midrangeareas
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $111
+ADDRGP4 midrangeareas
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $111
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+CNSTI4 3
+LSHU4
+ARGU4
+ADDRLP4 0
+ADDRGP4 GetMemory
+CALLP4
+ASGNP4
+ADDRGP4 midrangeareas
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 clusterareas
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $114
+ADDRGP4 clusterareas
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $114
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ARGU4
+ADDRLP4 4
+ADDRGP4 GetMemory
+CALLP4
+ASGNP4
+ADDRGP4 clusterareas
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $110
+endproc AAS_InitAlternativeRouting 8 4
+export AAS_ShutdownAlternativeRouting
+proc AAS_ShutdownAlternativeRouting 0 4
+ADDRGP4 midrangeareas
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $118
+ADDRGP4 midrangeareas
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $118
+ADDRGP4 midrangeareas
+CNSTP4 0
+ASGNP4
+ADDRGP4 clusterareas
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $120
+ADDRGP4 clusterareas
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $120
+ADDRGP4 clusterareas
+CNSTP4 0
+ASGNP4
+ADDRGP4 numclusterareas
+CNSTI4 0
+ASGNI4
+LABELV $117
+endproc AAS_ShutdownAlternativeRouting 0 4
+bss
+export numclusterareas
+align 4
+LABELV numclusterareas
+skip 4
+export clusterareas
+align 4
+LABELV clusterareas
+skip 4
+export midrangeareas
+align 4
+LABELV midrangeareas
+skip 4
+import aassettings
+import AAS_PrintFreeBSPLinks
+import AAS_EntityCollision
+import AAS_BSPLinkEntity
+import AAS_UnlinkFromBSPLeaves
+import AAS_DumpBSPData
+import AAS_LoadBSPFile
+import AAS_FileInfo
+import AAS_DumpAASData
+import AAS_FreeAASLump
+import AAS_WriteCompactAASFile
+import AAS_WriteAASFile
+import AAS_LoadCompactAASFile
+import AAS_LoadAASFile
+import AAS_RoutingCacheInfo
+import AAS_RoutingInfo
+import AAS_ReadRouteTables
+import AAS_WriteRouteTables
+import AAS_WriteRouteCache
+import AAS_CreateAllRoutingCache
+import AAS_FreeRoutingCaches
+import AAS_InitRouting
+import AAS_BestReachableLinkArea
+import AAS_ContinueInitReachability
+import AAS_InitReachability
+import AAS_SetViewPortalsAsClusterPortals
+import AAS_InitClustering
+import AAS_SampleBenchmark
+import AAS_FreeFlatNodes
+import AAS_InitFlatNodes
+import AAS_FreeReachabilityAreaGrid
+import AAS_InitReachabilityAreaGrid
+import AAS_UnlinkFromAreas
+import AAS_InsideFace
+import AAS_PointInsideFace
+import AAS_LinkEntityClientBBox
+import AAS_AASLinkEntity
+import AAS_PlaneFromNum
+import AAS_TraceEndFace
+import AAS_AreaGroundFace
+import AAS_FreeAASLinkedEntities
+import AAS_FreeAASLinkHeap
+import AAS_InitAASLinkedEntities
+import AAS_InitAASLinkHeap
+import AAS_UpdateEntities
+import AAS_UpdateEntity
+import AAS_ResetEntityLinks
+import AAS_UnlinkInvalidEntities
+import AAS_InvalidateEntities
+import AAS_StartFrame
+import AAS_LoadMap
+import AAS_Shutdown
+import AAS_Setup
+import AAS_SetInitialized
+import AAS_Error
+import aasworld
+import botDeveloper
+import botimport
+import botlibglobals
+import AAS_InitSettings
+import AAS_DropToFloor
+import AAS_SetMovedir
+import AAS_HorizontalVelocityForJump
+import AAS_BFGJumpZVelocity
+import AAS_RocketJumpZVelocity
+import AAS_AgainstLadder
+import AAS_JumpReachRunStart
+import AAS_Swimming
+import AAS_OnGround
+import AAS_PlayerMovementHitBBox
+import AAS_PredictPlayerMovement
+import AAS_IntForBSPEpairKey
+import AAS_FloatForBSPEpairKey
+import AAS_VectorForBSPEpairKey
+import AAS_ValueForBSPEpairKey
+import AAS_NextBSPEntity
+import AAS_BSPModelMinsMaxsOrigin
+import AAS_BoxEntities
+import AAS_AreasConnected
+import AAS_inPHS
+import AAS_inPVS
+import AAS_PointContents
+import AAS_Trace
+import AAS_Optimize
+import AAS_FloodAreas
+import AAS_ShowReachableAreas
+import AAS_ShowReachability
+import AAS_DrawArrow
+import AAS_PrintTravelType
+import AAS_DrawCross
+import AAS_ShowAreaPolygons
+import AAS_ShowArea
+import AAS_ShowFace
+import AAS_ShowBoundingBox
+import AAS_DrawPlaneCross
+import AAS_DrawPermanentCross
+import AAS_PermanentLine
+import AAS_DebugLine
+import AAS_ClearShownPolygons
+import AAS_ClearShownDebugLines
+import AAS_PredictRoute
+import AAS_AreaTravelTimeToGoalArea
+import AAS_AreaTravelTime
+import AAS_EnableRoutingArea
+import AAS_RandomGoalArea
+import AAS_ReachabilityFromNum
+import AAS_NextAreaReachability
+import AAS_AreaContentsTravelFlags
+import AAS_TravelFlagForType
+import AAS_AreaDoNotEnter
+import AAS_AreaJumpPad
+import AAS_AreaLadder
+import AAS_AreaGrounded
+import AAS_AreaSlime
+import AAS_AreaLava
+import AAS_AreaLiquid
+import AAS_AreaSwim
+import AAS_AreaCrouch
+import AAS_AreaGroundFaceArea
+import AAS_NextModelReachability
+import AAS_BestReachableFromJumpPadArea
+import AAS_BestReachableArea
+import AAS_AreaReachability
+import AAS_FacePlane
+import AAS_PointReachabilityAreaIndex
+import AAS_PointAreaNum
+import AAS_AreaInfo
+import AAS_PointInsideArea
+import AAS_BBoxReachabilityAreas
+import AAS_BBoxAreas
+import AAS_TraceAreas
+import AAS_TracePlayerBBox
+import AAS_PointPresenceType
+import AAS_AreaPresenceType
+import AAS_AreaCluster
+import AAS_PresenceTypeBoundingBox
+import AAS_ProjectPointOntoVector
+import AAS_Time
+import AAS_Loaded
+import AAS_Initialized
+import GetBotLibAPI
+import Log_Flush
+import Log_FileHandle
+import Log_WriteTimeStamped
+import Log_Write
+import Log_Shutdown
+import Log_Close
+import Log_Open
+import DumpMemory
+import MemoryByteSize
+import PrintMemoryLabels
+import PrintUsedMemorySize
+import AvailableMemory
+import FreeMemory
+import GetClearedHunkMemory
+import GetHunkMemory
+import GetClearedMemory
+import GetMemory
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $69
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
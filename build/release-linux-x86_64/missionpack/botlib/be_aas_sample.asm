@@ -0,0 +1,8801 @@
+lit
+align 4
+LABELV $26
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 3245342720
+byte 4 3245342720
+byte 4 3250585600
+byte 4 3245342720
+byte 4 3245342720
+byte 4 3250585600
+align 4
+LABELV $27
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1107296256
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1090519040
+export AAS_PresenceTypeBoundingBox
+code
+proc AAS_PresenceTypeBoundingBox 76 8
+ADDRLP4 4
+ADDRGP4 $26
+INDIRB
+ASGNB 36
+ADDRLP4 40
+ADDRGP4 $27
+INDIRB
+ASGNB 36
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $28
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $29
+JUMPV
+LABELV $28
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+NEI4 $30
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $31
+JUMPV
+LABELV $30
+CNSTI4 4
+ARGI4
+ADDRGP4 $33
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+LABELV $31
+LABELV $29
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 40
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $25
+endproc AAS_PresenceTypeBoundingBox 76 8
+export AAS_InitAASLinkHeap
+proc AAS_InitAASLinkHeap 24 8
+ADDRLP4 4
+ADDRGP4 aasworld+292
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld+288
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $36
+ADDRGP4 $39
+ARGP4
+ADDRGP4 $40
+ARGP4
+ADDRLP4 8
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $41
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $41
+ADDRGP4 aasworld+292
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTU4 24
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+MULU4
+ARGU4
+ADDRLP4 12
+ADDRGP4 GetHunkMemory
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+288
+ADDRLP4 12
+INDIRP4
+ASGNP4
+LABELV $36
+ADDRGP4 aasworld+288
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+288
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 aasworld+288
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $51
+JUMPV
+LABELV $48
+ADDRLP4 8
+CNSTI4 24
+ASGNI4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 aasworld+288
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ADDRGP4 aasworld+288
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 24
+ASGNI4
+ADDRLP4 20
+ADDRLP4 16
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 aasworld+288
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ADDRGP4 aasworld+288
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $49
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $51
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+LTI4 $48
+ADDRLP4 8
+CNSTI4 24
+ASGNI4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ADDRGP4 aasworld+288
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 48
+SUBI4
+ADDRGP4 aasworld+288
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 24
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ADDRGP4 aasworld+288
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+296
+ADDRGP4 aasworld+288
+INDIRP4
+ASGNP4
+ADDRGP4 numaaslinks
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $34
+endproc AAS_InitAASLinkHeap 24 8
+export AAS_FreeAASLinkHeap
+proc AAS_FreeAASLinkHeap 0 4
+ADDRGP4 aasworld+288
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $62
+ADDRGP4 aasworld+288
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $62
+ADDRGP4 aasworld+288
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+292
+CNSTI4 0
+ASGNI4
+LABELV $61
+endproc AAS_FreeAASLinkHeap 0 4
+export AAS_AllocAASLink
+proc AAS_AllocAASLink 8 8
+ADDRLP4 0
+ADDRGP4 aasworld+296
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $70
+ADDRGP4 botDeveloper
+INDIRI4
+CNSTI4 0
+EQI4 $72
+CNSTI4 4
+ARGI4
+ADDRGP4 $75
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $72
+CNSTP4 0
+RETP4
+ADDRGP4 $68
+JUMPV
+LABELV $70
+ADDRGP4 aasworld+296
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $76
+ADDRGP4 aasworld+296
+ADDRGP4 aasworld+296
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $76
+ADDRGP4 aasworld+296
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $81
+ADDRGP4 aasworld+296
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $81
+ADDRLP4 4
+ADDRGP4 numaaslinks
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $68
+endproc AAS_AllocAASLink 8 8
+export AAS_DeAllocAASLink
+proc AAS_DeAllocAASLink 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+296
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $86
+ADDRGP4 aasworld+296
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $86
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 aasworld+296
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+296
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 numaaslinks
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $85
+endproc AAS_DeAllocAASLink 4 0
+export AAS_InitAASLinkedEntities
+proc AAS_InitAASLinkedEntities 4 4
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $93
+ADDRGP4 $92
+JUMPV
+LABELV $93
+ADDRGP4 aasworld+300
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $95
+ADDRGP4 aasworld+300
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $95
+ADDRGP4 aasworld+216
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ARGU4
+ADDRLP4 0
+ADDRGP4 GetClearedHunkMemory
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+300
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $92
+endproc AAS_InitAASLinkedEntities 4 4
+export AAS_FreeAASLinkedEntities
+proc AAS_FreeAASLinkedEntities 0 4
+ADDRGP4 aasworld+300
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $102
+ADDRGP4 aasworld+300
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $102
+ADDRGP4 aasworld+300
+CNSTP4 0
+ASGNP4
+LABELV $101
+endproc AAS_FreeAASLinkedEntities 0 4
+export AAS_InitFlatNodes
+proc AAS_InitFlatNodes 68 8
+ADDRGP4 AAS_FreeFlatNodes
+CALLV
+pop
+ADDRGP4 aasworld+240
+INDIRI4
+CNSTI4 1
+GTI4 $108
+ADDRGP4 $107
+JUMPV
+LABELV $108
+ADDRGP4 aasworld+240
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ARGU4
+ADDRLP4 36
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+240
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ARGU4
+ADDRLP4 40
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $115
+ARGP4
+ADDRGP4 $116
+ARGP4
+ADDRLP4 44
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+CNSTI4 0
+EQI4 $113
+ADDRLP4 48
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRLP4 24
+ADDRLP4 48
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $120
+JUMPV
+LABELV $117
+ADDRLP4 8
+CNSTI4 12
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+244
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $122
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LEI4 $130
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $130
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+240
+INDIRI4
+LTI4 $126
+LABELV $130
+ADDRGP4 $123
+JUMPV
+LABELV $126
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 64
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $123
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LTI4 $122
+LABELV $118
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $120
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $117
+ADDRGP4 $114
+JUMPV
+LABELV $113
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRGP4 $134
+JUMPV
+LABELV $131
+ADDRLP4 48
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $132
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $134
+ADDRLP4 32
+INDIRI4
+ADDRGP4 aasworld+240
+INDIRI4
+LTI4 $131
+LABELV $114
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $139
+JUMPV
+LABELV $136
+ADDRLP4 52
+CNSTI4 2
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LSHI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $137
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $139
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $136
+ADDRLP4 24
+INDIRI4
+CVIU4 4
+CNSTI4 5
+LSHU4
+ARGU4
+ADDRLP4 48
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+252
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld+248
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $145
+JUMPV
+LABELV $142
+ADDRLP4 8
+CNSTI4 12
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+244
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 aasworld+252
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 20
+ADDRLP4 8
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 20
+ADDRLP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $149
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $153
+ADDRLP4 56
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LSHI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LSHI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $154
+JUMPV
+LABELV $153
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $154
+LABELV $150
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LTI4 $149
+LABELV $143
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $145
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $142
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $107
+endproc AAS_InitFlatNodes 68 8
+export AAS_FreeFlatNodes
+proc AAS_FreeFlatNodes 0 4
+ADDRGP4 aasworld+252
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $156
+ADDRGP4 aasworld+252
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $156
+ADDRGP4 aasworld+252
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+248
+CNSTI4 0
+ASGNI4
+LABELV $155
+endproc AAS_FreeFlatNodes 0 4
+proc AAS_FilePointAreaNum 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $164
+JUMPV
+LABELV $163
+ADDRLP4 16
+CNSTI4 12
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+244
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 20
+ADDRLP4 8
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+LEF4 $168
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $169
+JUMPV
+LABELV $168
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $169
+LABELV $164
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GTI4 $163
+ADDRLP4 4
+INDIRI4
+NEGI4
+RETI4
+LABELV $162
+endproc AAS_FilePointAreaNum 36 0
+export AAS_SampleBenchmark
+proc AAS_SampleBenchmark 232 24
+ADDRGP4 aasworld+216
+INDIRI4
+CNSTI4 1
+LEI4 $175
+ADDRGP4 aasworld+252
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $171
+LABELV $175
+ADDRGP4 $170
+JUMPV
+LABELV $171
+CNSTU4 12000000
+ARGU4
+ADDRLP4 188
+ADDRGP4 GetMemory
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 188
+INDIRP4
+ASGNP4
+CNSTU4 4000000
+ARGU4
+ADDRLP4 192
+ADDRGP4 GetMemory
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 192
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $176
+ADDRLP4 16
+ARGP4
+ADDRLP4 196
+ADDRGP4 Q_rand
+CALLI4
+ASGNI4
+ADDRLP4 200
+CNSTI4 1
+ASGNI4
+ADDRLP4 24
+ADDRLP4 196
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+ADDRLP4 200
+INDIRI4
+SUBI4
+MODI4
+ADDRLP4 200
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 48
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $182
+ADDRLP4 16
+ARGP4
+ADDRLP4 204
+ADDRGP4 Q_random
+CALLF4
+ASGNF4
+ADDRLP4 208
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 212
+CNSTI4 12
+ASGNI4
+ADDRLP4 216
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+ADDRLP4 212
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDP4
+ADDRLP4 208
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 204
+INDIRF4
+ADDRLP4 216
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 216
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $183
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $182
+LABELV $177
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1000000
+LTI4 $176
+ADDRLP4 196
+ADDRGP4 botimport
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $186
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 AAS_FilePointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+INDIRP4
+ADDP4
+ADDRLP4 204
+INDIRI4
+ASGNI4
+LABELV $187
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1000000
+LTI4 $186
+ADDRLP4 200
+ADDRGP4 botimport
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 200
+INDIRI4
+ADDRLP4 176
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRLP4 204
+ADDRGP4 botimport
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $190
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+INDIRP4
+ADDP4
+INDIRI4
+EQI4 $194
+ADDRLP4 172
+ADDRLP4 172
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $194
+LABELV $191
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1000000
+LTI4 $190
+ADDRLP4 208
+ADDRGP4 botimport
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 208
+INDIRI4
+ADDRLP4 180
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 212
+ADDRGP4 botimport
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $199
+JUMPV
+LABELV $196
+ADDRLP4 216
+CNSTI4 12
+ASGNI4
+ADDRLP4 220
+ADDRLP4 216
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 220
+INDIRI4
+ADDRLP4 216
+INDIRI4
+ADDI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 220
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 228
+ADDRGP4 AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+ADDRLP4 228
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $197
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+LABELV $199
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 1000000
+LTI4 $196
+ADDRLP4 216
+ADDRGP4 botimport
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 216
+INDIRI4
+ADDRLP4 184
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $201
+ARGP4
+CNSTI4 1000000
+ARGI4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $203
+ARGP4
+CNSTI4 500000
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 184
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $170
+endproc AAS_SampleBenchmark 232 24
+export AAS_PointAreaNum
+proc AAS_PointAreaNum 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $205
+CNSTI4 3
+ARGI4
+ADDRGP4 $208
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $204
+JUMPV
+LABELV $205
+ADDRGP4 aasworld+252
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $211
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $212
+JUMPV
+LABELV $211
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $212
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $214
+JUMPV
+LABELV $213
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 aasworld+252
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+LEF4 $217
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $218
+JUMPV
+LABELV $217
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $218
+LABELV $214
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GTI4 $213
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $219
+CNSTI4 0
+RETI4
+ADDRGP4 $204
+JUMPV
+LABELV $219
+ADDRLP4 4
+INDIRI4
+NEGI4
+RETI4
+LABELV $204
+endproc AAS_PointAreaNum 36 8
+export AAS_PointReachabilityAreaIndex
+proc AAS_PointReachabilityAreaIndex 40 4
+ADDRGP4 aasworld+4
+INDIRI4
+CNSTI4 0
+NEI4 $222
+CNSTI4 0
+RETI4
+ADDRGP4 $221
+JUMPV
+LABELV $222
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $225
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $230
+JUMPV
+LABELV $227
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $228
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $230
+ADDRLP4 0
+INDIRI4
+ADDRGP4 aasworld+272
+INDIRI4
+LTI4 $227
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $221
+JUMPV
+LABELV $225
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $235
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $233
+LABELV $235
+CNSTI4 0
+RETI4
+ADDRGP4 $221
+JUMPV
+LABELV $233
+ADDRLP4 28
+CNSTI4 28
+ADDRLP4 12
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 28
+INDIRI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $238
+ADDRLP4 32
+CNSTI4 20
+ASGNI4
+ADDRLP4 8
+ADDRLP4 32
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEGI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 32
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEGI4
+MULI4
+ADDRGP4 aasworld+260
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $238
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $242
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+276
+INDIRP4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $243
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $245
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $242
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $221
+endproc AAS_PointReachabilityAreaIndex 40 4
+export AAS_AreaCluster
+proc AAS_AreaCluster 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $251
+ADDRFP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $248
+LABELV $251
+CNSTI4 3
+ARGI4
+ADDRGP4 $253
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $247
+JUMPV
+LABELV $248
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+RETI4
+LABELV $247
+endproc AAS_AreaCluster 4 8
+export AAS_AreaPresenceType
+proc AAS_AreaPresenceType 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $256
+CNSTI4 0
+RETI4
+ADDRGP4 $255
+JUMPV
+LABELV $256
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $261
+ADDRFP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $258
+LABELV $261
+CNSTI4 3
+ARGI4
+ADDRGP4 $263
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $255
+JUMPV
+LABELV $258
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRI4
+RETI4
+LABELV $255
+endproc AAS_AreaPresenceType 4 8
+export AAS_PointPresenceType
+proc AAS_PointPresenceType 8 4
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $266
+CNSTI4 0
+RETI4
+ADDRGP4 $265
+JUMPV
+LABELV $266
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $268
+CNSTI4 1
+RETI4
+ADDRGP4 $265
+JUMPV
+LABELV $268
+CNSTI4 28
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRI4
+RETI4
+LABELV $265
+endproc AAS_PointPresenceType 8 4
+export AAS_BoxOriginDistanceFromPlane
+proc AAS_BoxOriginDistanceFromPlane 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $272
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $274
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 981668463
+LEF4 $278
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $279
+JUMPV
+LABELV $278
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 3129152111
+GEF4 $280
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $281
+JUMPV
+LABELV $280
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $281
+LABELV $279
+LABELV $275
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $274
+ADDRGP4 $273
+JUMPV
+LABELV $272
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $282
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 981668463
+LEF4 $286
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 3129152111
+GEF4 $288
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $289
+JUMPV
+LABELV $288
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $289
+LABELV $287
+LABELV $283
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $282
+LABELV $273
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ARGP4
+ADDRGP4 VectorInverse
+CALLV
+pop
+ADDRLP4 4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+MULF4
+ADDF4
+RETF4
+LABELV $271
+endproc AAS_BoxOriginDistanceFromPlane 36 4
+export AAS_AreaEntityCollision
+proc AAS_AreaEntityCollision 100 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 68
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 64
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+300
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $299
+JUMPV
+LABELV $296
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 16
+INDIRI4
+NEI4 $301
+ADDRGP4 $297
+JUMPV
+LABELV $301
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 96
+ADDRGP4 AAS_EntityCollision
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $303
+ADDRLP4 92
+CNSTI4 1
+ASGNI4
+LABELV $303
+LABELV $297
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $299
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $296
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+EQI4 $305
+ADDRFP4 24
+INDIRP4
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+ADDRFP4 24
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4+56
+INDIRI4
+ASGNI4
+ADDRFP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 4+12
+INDIRB
+ASGNB 12
+ADDRFP4 24
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 24
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 24
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 4+24
+INDIRB
+ASGNB 12
+ADDRFP4 24
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 4+24+12
+INDIRF4
+ASGNF4
+ADDRFP4 24
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 4+24+16
+INDIRU1
+CVUI4 1
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $294
+JUMPV
+LABELV $305
+CNSTI4 0
+RETI4
+LABELV $294
+endproc AAS_AreaEntityCollision 100 28
+export AAS_TracePlayerBBox
+proc AAS_TracePlayerBBox 4288 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $317
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRB
+ASGNB 56
+ADDRGP4 $315
+JUMPV
+LABELV $317
+ADDRLP4 0
+ADDRLP4 100
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+252
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $321
+ADDRLP4 4216
+CNSTI4 1
+ASGNI4
+ADDRGP4 $322
+JUMPV
+LABELV $321
+ADDRLP4 4216
+CNSTI4 0
+ASGNI4
+LABELV $322
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 4216
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $324
+JUMPV
+LABELV $323
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -32
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 100
+CVPU4 4
+GEU4 $326
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4+20
+CNSTI4 0
+ASGNI4
+ADDRLP4 4+28
+CNSTI4 0
+ASGNI4
+ADDRLP4 4+32
+CNSTI4 0
+ASGNI4
+ADDRLP4 4+36
+CNSTI4 20
+ADDRLP4 4+32
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 20
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRB
+ASGNB 56
+ADDRGP4 $315
+JUMPV
+LABELV $326
+ADDRLP4 76
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+GEI4 $336
+CNSTI4 28
+ADDRLP4 76
+INDIRI4
+NEGI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $338
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+NEF4 $341
+ADDRLP4 4228
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4228
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4228
+INDIRI4
+ADDP4
+INDIRF4
+NEF4 $341
+ADDRLP4 4232
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4232
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4232
+INDIRI4
+ADDP4
+INDIRF4
+NEF4 $341
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4236
+CNSTF4 0
+ASGNF4
+ADDRLP4 60+8
+ADDRLP4 4236
+INDIRF4
+ASGNF4
+ADDRLP4 60+4
+ADDRLP4 4236
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 4236
+INDIRF4
+ASGNF4
+ADDRGP4 $342
+JUMPV
+LABELV $341
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4244
+CNSTI4 4
+ASGNI4
+ADDRLP4 60+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4244
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4244
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4248
+CNSTI4 8
+ASGNI4
+ADDRLP4 60+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4248
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4248
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4180
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4260
+CNSTI4 4
+ASGNI4
+ADDRLP4 4180+4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4260
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4260
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4264
+CNSTI4 8
+ASGNI4
+ADDRLP4 4180+8
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4264
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4264
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4180
+ARGP4
+ADDRLP4 4268
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 60
+ARGP4
+ADDRLP4 4272
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4268
+INDIRF4
+ADDRLP4 4272
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+CNSTF4 3187671040
+ADDRLP4 60
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4280
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 4280
+INDIRP4
+ADDRLP4 4280
+INDIRP4
+INDIRF4
+CNSTF4 3187671040
+ADDRLP4 60+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4284
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4284
+INDIRP4
+ADDRLP4 4284
+INDIRP4
+INDIRF4
+CNSTF4 3187671040
+ADDRLP4 60+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $342
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4+20
+CNSTI4 0
+ASGNI4
+ADDRLP4 4+28
+ADDRLP4 76
+INDIRI4
+NEGI4
+ASGNI4
+ADDRLP4 4+32
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 20
+ADDRLP4 4+32
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+LEF4 $359
+ADDRLP4 4+32
+ADDRLP4 4+32
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+LABELV $359
+ADDRLP4 4+36
+CNSTI4 20
+ADDRLP4 4+32
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 20
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRB
+ASGNB 56
+ADDRGP4 $315
+JUMPV
+LABELV $338
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $367
+ADDRLP4 76
+INDIRI4
+NEGI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 4224
+ADDRGP4 AAS_AreaEntityCollision
+CALLI4
+ASGNI4
+ADDRLP4 4224
+INDIRI4
+CNSTI4 0
+EQI4 $369
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $371
+ADDRLP4 60
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4236
+CNSTI4 4
+ASGNI4
+ADDRLP4 60+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4236
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4236
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4240
+CNSTI4 8
+ASGNI4
+ADDRLP4 60+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4240
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4240
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4180
+ADDRLP4 4+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4180+4
+ADDRLP4 4+8+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4180+8
+ADDRLP4 4+8+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4180
+ARGP4
+ADDRLP4 4248
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 60
+ARGP4
+ADDRLP4 4252
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4248
+INDIRF4
+ADDRLP4 4252
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $371
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRB
+ASGNB 56
+ADDRGP4 $315
+JUMPV
+LABELV $369
+LABELV $367
+ADDRLP4 4+24
+ADDRLP4 76
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $324
+JUMPV
+LABELV $336
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $384
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+NEF4 $386
+ADDRLP4 4228
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4228
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4228
+INDIRI4
+ADDP4
+INDIRF4
+NEF4 $386
+ADDRLP4 4232
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4232
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4232
+INDIRI4
+ADDP4
+INDIRF4
+NEF4 $386
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4236
+CNSTF4 0
+ASGNF4
+ADDRLP4 60+8
+ADDRLP4 4236
+INDIRF4
+ASGNF4
+ADDRLP4 60+4
+ADDRLP4 4236
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 4236
+INDIRF4
+ASGNF4
+ADDRGP4 $387
+JUMPV
+LABELV $386
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4244
+CNSTI4 4
+ASGNI4
+ADDRLP4 60+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4244
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4244
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4248
+CNSTI4 8
+ASGNI4
+ADDRLP4 60+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4248
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4248
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4180
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4260
+CNSTI4 4
+ASGNI4
+ADDRLP4 4180+4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4260
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4260
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4264
+CNSTI4 8
+ASGNI4
+ADDRLP4 4180+8
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4264
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4264
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4180
+ARGP4
+ADDRLP4 4268
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 60
+ARGP4
+ADDRLP4 4272
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4268
+INDIRF4
+ADDRLP4 4272
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+CNSTF4 3187671040
+ADDRLP4 60
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4280
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 4280
+INDIRP4
+ADDRLP4 4280
+INDIRP4
+INDIRF4
+CNSTF4 3187671040
+ADDRLP4 60+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4284
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4284
+INDIRP4
+ADDRLP4 4284
+INDIRP4
+INDIRF4
+CNSTF4 3187671040
+ADDRLP4 60+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $387
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4+20
+CNSTI4 0
+ASGNI4
+ADDRLP4 4+28
+CNSTI4 0
+ASGNI4
+ADDRLP4 4+32
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 20
+ADDRLP4 4+32
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+LEF4 $404
+ADDRLP4 4+32
+ADDRLP4 4+32
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+LABELV $404
+ADDRLP4 4+36
+CNSTI4 20
+ADDRLP4 4+32
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 20
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRB
+ASGNB 56
+ADDRGP4 $315
+JUMPV
+LABELV $384
+ADDRLP4 80
+ADDRLP4 76
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 aasworld+252
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4168
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 72
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 4220
+ADDRLP4 72
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $413
+JUMPV
+LABELV $413
+ADDRLP4 4232
+ADDRLP4 72
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 4236
+ADDRLP4 72
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4240
+ADDRLP4 72
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 84
+INDIRF4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 4232
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 4236
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4240
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4164
+ADDRLP4 4168
+INDIRF4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 4168+4
+INDIRF4
+ADDRLP4 4232
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4168+8
+INDIRF4
+ADDRLP4 4236
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4240
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $414
+ADDRLP4 4228
+CNSTF4 0
+ASGNF4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 4228
+INDIRF4
+LTF4 $420
+ADDRLP4 4164
+INDIRF4
+ADDRLP4 4228
+INDIRF4
+LTF4 $420
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 100+4064
+CVPU4 4
+LTU4 $421
+CNSTI4 3
+ARGI4
+ADDRGP4 $426
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRB
+ASGNB 56
+ADDRGP4 $315
+JUMPV
+LABELV $420
+ADDRLP4 4232
+CNSTF4 0
+ASGNF4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 4232
+INDIRF4
+GEF4 $427
+ADDRLP4 4164
+INDIRF4
+ADDRLP4 4232
+INDIRF4
+GEF4 $427
+ADDRLP4 4236
+CNSTI4 28
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4236
+INDIRI4
+ADDP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 4236
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 100+4064
+CVPU4 4
+LTU4 $428
+CNSTI4 3
+ARGI4
+ADDRGP4 $426
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRB
+ASGNB 56
+ADDRGP4 $315
+JUMPV
+LABELV $427
+ADDRLP4 4212
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 4164
+INDIRF4
+NEF4 $433
+ADDRLP4 96
+ADDRLP4 96
+INDIRF4
+CNSTF4 981668463
+SUBF4
+ASGNF4
+LABELV $433
+ADDRLP4 96
+INDIRF4
+CNSTF4 0
+GEF4 $435
+ADDRLP4 4192
+ADDRLP4 96
+INDIRF4
+CNSTF4 1040187392
+ADDF4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 4164
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRGP4 $436
+JUMPV
+LABELV $435
+ADDRLP4 4192
+ADDRLP4 96
+INDIRF4
+CNSTF4 1040187392
+SUBF4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 4164
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+LABELV $436
+ADDRLP4 4192
+INDIRF4
+CNSTF4 0
+GEF4 $437
+ADDRLP4 4192
+CNSTF4 981668463
+ASGNF4
+ADDRGP4 $438
+JUMPV
+LABELV $437
+ADDRLP4 4192
+INDIRF4
+CNSTF4 1065353216
+LEF4 $439
+ADDRLP4 4192
+CNSTF4 1065336439
+ASGNF4
+LABELV $439
+LABELV $438
+ADDRLP4 4244
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 4196
+ADDRLP4 4244
+INDIRF4
+ADDRLP4 4168
+INDIRF4
+ADDRLP4 4244
+INDIRF4
+SUBF4
+ADDRLP4 4192
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4196+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 4168+4
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+SUBF4
+ADDRLP4 4192
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4196+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 4168+8
+INDIRF4
+ADDRLP4 84+8
+INDIRF4
+SUBF4
+ADDRLP4 4192
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+INDIRF4
+CNSTF4 0
+GEF4 $450
+ADDRLP4 4252
+CNSTI4 1
+ASGNI4
+ADDRGP4 $451
+JUMPV
+LABELV $450
+ADDRLP4 4252
+CNSTI4 0
+ASGNI4
+LABELV $451
+ADDRLP4 4208
+ADDRLP4 4252
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4196
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4208
+INDIRI4
+CNSTI4 0
+NEI4 $453
+ADDRLP4 4256
+CNSTI4 1
+ASGNI4
+ADDRGP4 $454
+JUMPV
+LABELV $453
+ADDRLP4 4256
+CNSTI4 0
+ASGNI4
+LABELV $454
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 4256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 80
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 100+4064
+CVPU4 4
+LTU4 $455
+CNSTI4 3
+ARGI4
+ADDRGP4 $426
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRB
+ASGNB 56
+ADDRGP4 $315
+JUMPV
+LABELV $455
+ADDRLP4 0
+INDIRP4
+ADDRLP4 84
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4196
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4212
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 4208
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 80
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 100+4064
+CVPU4 4
+LTU4 $459
+CNSTI4 3
+ARGI4
+ADDRGP4 $426
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRB
+ASGNB 56
+ADDRGP4 $315
+JUMPV
+LABELV $459
+LABELV $428
+LABELV $421
+LABELV $324
+ADDRGP4 $323
+JUMPV
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRB
+ASGNB 56
+LABELV $315
+endproc AAS_TracePlayerBBox 4288 28
+export AAS_TraceAreas
+proc AAS_TraceAreas 4188 8
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4140
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 4140
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4140
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $464
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $463
+JUMPV
+LABELV $464
+ADDRLP4 0
+ADDRLP4 36
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+252
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $468
+ADDRLP4 4144
+CNSTI4 1
+ASGNI4
+ADDRGP4 $469
+JUMPV
+LABELV $468
+ADDRLP4 4144
+CNSTI4 0
+ASGNI4
+LABELV $469
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 4144
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRGP4 $471
+JUMPV
+LABELV $470
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -32
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 36
+CVPU4 4
+GEU4 $473
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $463
+JUMPV
+LABELV $473
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $475
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+NEGI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $477
+CNSTI4 12
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $477
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRFP4 16
+INDIRI4
+LTI4 $471
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $463
+JUMPV
+LABELV $475
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $481
+ADDRGP4 $471
+JUMPV
+LABELV $481
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 aasworld+252
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4100
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 28
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4148
+ADDRLP4 28
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $484
+JUMPV
+LABELV $484
+ADDRLP4 4160
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 4164
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4168
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4160
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4164
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4168
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4112
+ADDRLP4 4100
+INDIRF4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 4100+4
+INDIRF4
+ADDRLP4 4160
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4100+8
+INDIRF4
+ADDRLP4 4164
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4168
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $485
+ADDRLP4 4156
+CNSTF4 0
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 4156
+INDIRF4
+LEF4 $491
+ADDRLP4 4112
+INDIRF4
+ADDRLP4 4156
+INDIRF4
+LEF4 $491
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 36+4064
+CVPU4 4
+LTU4 $492
+CNSTI4 3
+ARGI4
+ADDRGP4 $497
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $463
+JUMPV
+LABELV $491
+ADDRLP4 4160
+CNSTF4 0
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 4160
+INDIRF4
+GTF4 $498
+ADDRLP4 4112
+INDIRF4
+ADDRLP4 4160
+INDIRF4
+GTF4 $498
+ADDRLP4 4164
+CNSTI4 28
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4164
+INDIRI4
+ADDP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4164
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 36+4064
+CVPU4 4
+LTU4 $499
+CNSTI4 3
+ARGI4
+ADDRGP4 $497
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $463
+JUMPV
+LABELV $498
+ADDRLP4 4136
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+GEF4 $504
+ADDRLP4 4116
+ADDRLP4 32
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 4112
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRGP4 $505
+JUMPV
+LABELV $504
+ADDRLP4 4116
+ADDRLP4 32
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 4112
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+LABELV $505
+ADDRLP4 4116
+INDIRF4
+CNSTF4 0
+GEF4 $506
+ADDRLP4 4116
+CNSTF4 0
+ASGNF4
+ADDRGP4 $507
+JUMPV
+LABELV $506
+ADDRLP4 4116
+INDIRF4
+CNSTF4 1065353216
+LEF4 $508
+ADDRLP4 4116
+CNSTF4 1065353216
+ASGNF4
+LABELV $508
+LABELV $507
+ADDRLP4 4172
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4120
+ADDRLP4 4172
+INDIRF4
+ADDRLP4 4100
+INDIRF4
+ADDRLP4 4172
+INDIRF4
+SUBF4
+ADDRLP4 4116
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4120+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4100+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ADDRLP4 4116
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4120+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4100+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ADDRLP4 4116
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+GEF4 $519
+ADDRLP4 4180
+CNSTI4 1
+ASGNI4
+ADDRGP4 $520
+JUMPV
+LABELV $519
+ADDRLP4 4180
+CNSTI4 0
+ASGNI4
+LABELV $520
+ADDRLP4 4132
+ADDRLP4 4180
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4120
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4132
+INDIRI4
+CNSTI4 0
+NEI4 $522
+ADDRLP4 4184
+CNSTI4 1
+ASGNI4
+ADDRGP4 $523
+JUMPV
+LABELV $522
+ADDRLP4 4184
+CNSTI4 0
+ASGNI4
+LABELV $523
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 4184
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 36+4064
+CVPU4 4
+LTU4 $524
+CNSTI4 3
+ARGI4
+ADDRGP4 $497
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $463
+JUMPV
+LABELV $524
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4120
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 4136
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 4132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 36+4064
+CVPU4 4
+LTU4 $528
+CNSTI4 3
+ARGI4
+ADDRGP4 $497
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $463
+JUMPV
+LABELV $528
+LABELV $499
+LABELV $492
+LABELV $471
+ADDRGP4 $470
+JUMPV
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $463
+endproc AAS_TraceAreas 4188 8
+export AAS_InsideFace
+proc AAS_InsideFace 108 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $533
+CNSTI4 0
+RETI4
+ADDRGP4 $532
+JUMPV
+LABELV $533
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 $538
+JUMPV
+LABELV $535
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 80
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+GEI4 $542
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $543
+JUMPV
+LABELV $542
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+LABELV $543
+ADDRLP4 48
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 84
+CNSTI4 12
+ASGNI4
+ADDRLP4 12
+ADDRLP4 84
+INDIRI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 52
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $555
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $556
+JUMPV
+LABELV $555
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $556
+ADDRLP4 0
+ADDRLP4 84
+INDIRI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 52
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $557
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRGP4 $558
+JUMPV
+LABELV $557
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+LABELV $558
+ADDRLP4 0+4
+CNSTI4 12
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 52
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $559
+ADDRLP4 76
+CNSTI4 1
+ASGNI4
+ADDRGP4 $560
+JUMPV
+LABELV $559
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+LABELV $560
+ADDRLP4 0+8
+CNSTI4 12
+ADDRLP4 76
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 52
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 100
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 100
+INDIRP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 0
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 12
+INDIRF4
+NEGF4
+GEF4 $571
+CNSTI4 0
+RETI4
+ADDRGP4 $532
+JUMPV
+LABELV $571
+LABELV $536
+ADDRLP4 56
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $538
+ADDRLP4 56
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $535
+CNSTI4 1
+RETI4
+LABELV $532
+endproc AAS_InsideFace 108 4
+export AAS_PointInsideFace
+proc AAS_PointInsideFace 120 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $578
+CNSTI4 0
+RETI4
+ADDRGP4 $577
+JUMPV
+LABELV $578
+ADDRLP4 60
+CNSTI4 24
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 64
+CNSTI4 20
+ADDRLP4 60
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $585
+JUMPV
+LABELV $582
+ADDRLP4 52
+ADDRLP4 60
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+196
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 76
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 aasworld+188
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+GEI4 $589
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $590
+JUMPV
+LABELV $589
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $590
+ADDRLP4 48
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+ADDRLP4 80
+INDIRI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 56
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $594
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRGP4 $595
+JUMPV
+LABELV $594
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+LABELV $595
+ADDRLP4 16
+ADDRLP4 80
+INDIRI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 56
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+172
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96
+CNSTI4 4
+ASGNI4
+ADDRLP4 20+4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100
+CNSTI4 8
+ASGNI4
+ADDRLP4 20+8
+ADDRLP4 16
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 112
+CNSTI4 4
+ASGNI4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 116
+CNSTI4 8
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+MULF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 32+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 32+8
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+GEF4 $600
+CNSTI4 0
+RETI4
+ADDRGP4 $577
+JUMPV
+LABELV $600
+LABELV $583
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $585
+ADDRLP4 44
+INDIRI4
+ADDRLP4 60
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $582
+CNSTI4 1
+RETI4
+LABELV $577
+endproc AAS_PointInsideFace 120 12
+lit
+align 4
+LABELV $607
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export AAS_AreaGroundFace
+code
+proc AAS_AreaGroundFace 52 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRGP4 $607
+INDIRB
+ASGNB 12
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $608
+CNSTP4 0
+RETP4
+ADDRGP4 $606
+JUMPV
+LABELV $608
+ADDRLP4 8
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $614
+JUMPV
+LABELV $611
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 24
+ADDRLP4 40
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 44
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $617
+CNSTI4 20
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $619
+ADDRLP4 16
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 28+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 28+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $620
+JUMPV
+LABELV $619
+ADDRLP4 16
+ADDRLP4 28
+INDIRB
+ASGNB 12
+LABELV $620
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTF4 1008981770
+ARGF4
+ADDRLP4 48
+ADDRGP4 AAS_InsideFace
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $626
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $606
+JUMPV
+LABELV $626
+LABELV $617
+LABELV $612
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $614
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $611
+CNSTP4 0
+RETP4
+LABELV $606
+endproc AAS_AreaGroundFace 52 16
+export AAS_FacePlane
+proc AAS_FacePlane 4 0
+ADDRLP4 0
+CNSTI4 20
+CNSTI4 24
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $628
+endproc AAS_FacePlane 4 0
+export AAS_TraceEndFace
+proc AAS_TraceEndFace 36 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $632
+CNSTP4 0
+RETP4
+ADDRGP4 $631
+JUMPV
+LABELV $632
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $634
+CNSTP4 0
+RETP4
+ADDRGP4 $631
+JUMPV
+LABELV $634
+ADDRLP4 8
+CNSTI4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $640
+JUMPV
+LABELV $637
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 24
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 -2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+BANDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+BANDI4
+NEI4 $643
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+CNSTF4 1008981770
+ARGF4
+ADDRLP4 32
+ADDRGP4 AAS_InsideFace
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $645
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $631
+JUMPV
+LABELV $645
+LABELV $643
+LABELV $638
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $640
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $637
+ADDRLP4 16
+INDIRP4
+RETP4
+LABELV $631
+endproc AAS_TraceEndFace 36 16
+export AAS_BoxOnPlaneSide2
+proc AAS_BoxOnPlaneSide2 56 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $649
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $653
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 40
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $654
+JUMPV
+LABELV $653
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 4+12
+ADDP4
+ADDRLP4 40
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $654
+LABELV $650
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $649
+ADDRLP4 44
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 48
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 52
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+LTF4 $664
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+LABELV $664
+ADDRLP4 36
+INDIRF4
+CNSTF4 0
+GEF4 $666
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $666
+ADDRLP4 28
+INDIRI4
+RETI4
+LABELV $648
+endproc AAS_BoxOnPlaneSide2 56 0
+export AAS_UnlinkFromAreas
+proc AAS_UnlinkFromAreas 32 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $672
+JUMPV
+LABELV $669
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $673
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $674
+JUMPV
+LABELV $673
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+300
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $674
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $676
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $676
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AAS_DeAllocAASLink
+CALLV
+pop
+LABELV $670
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $672
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $669
+LABELV $668
+endproc AAS_UnlinkFromAreas 32 4
+export AAS_AASLinkEntity
+proc AAS_AASLinkEntity 552 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $680
+CNSTI4 3
+ARGI4
+ADDRGP4 $683
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $679
+JUMPV
+LABELV $680
+ADDRLP4 532
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+ASGNP4
+ADDRGP4 aasworld+252
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $686
+ADDRLP4 540
+CNSTI4 1
+ASGNI4
+ADDRGP4 $687
+JUMPV
+LABELV $686
+ADDRLP4 540
+CNSTI4 0
+ASGNI4
+LABELV $687
+ADDRLP4 4
+INDIRP4
+ADDRLP4 540
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRGP4 $689
+JUMPV
+LABELV $688
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 -4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+CVPU4 4
+GEU4 $691
+ADDRGP4 $690
+JUMPV
+LABELV $691
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $693
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+NEGI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+300
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $698
+JUMPV
+LABELV $695
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+NEI4 $700
+ADDRGP4 $697
+JUMPV
+LABELV $700
+LABELV $696
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $698
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $695
+LABELV $697
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $702
+ADDRGP4 $689
+JUMPV
+LABELV $702
+ADDRLP4 544
+ADDRGP4 AAS_AllocAASLink
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 544
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $704
+ADDRLP4 532
+INDIRP4
+RETP4
+ADDRGP4 $679
+JUMPV
+LABELV $704
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRI4
+NEGI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 532
+INDIRP4
+ASGNP4
+ADDRLP4 532
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $706
+ADDRLP4 532
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $706
+ADDRLP4 532
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRI4
+NEGI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+300
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+NEGI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+300
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $709
+ADDRLP4 8
+INDIRI4
+NEGI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+300
+INDIRP4
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $709
+ADDRLP4 8
+INDIRI4
+NEGI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+300
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $689
+JUMPV
+LABELV $693
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $714
+ADDRGP4 $689
+JUMPV
+LABELV $714
+ADDRLP4 528
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 aasworld+252
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 536
+ADDRLP4 528
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 536
+INDIRP4
+ARGP4
+ADDRLP4 544
+ADDRGP4 AAS_BoxOnPlaneSide2
+CALLI4
+ASGNI4
+ADDRLP4 524
+ADDRLP4 544
+INDIRI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $717
+ADDRLP4 4
+INDIRP4
+ADDRLP4 528
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+LABELV $717
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 12+508
+CVPU4 4
+LTU4 $719
+CNSTI4 3
+ARGI4
+ADDRGP4 $723
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $690
+JUMPV
+LABELV $719
+ADDRLP4 524
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $724
+ADDRLP4 4
+INDIRP4
+ADDRLP4 528
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+LABELV $724
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 12+508
+CVPU4 4
+LTU4 $726
+CNSTI4 3
+ARGI4
+ADDRGP4 $723
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $690
+JUMPV
+LABELV $726
+LABELV $689
+ADDRGP4 $688
+JUMPV
+LABELV $690
+ADDRLP4 532
+INDIRP4
+RETP4
+LABELV $679
+endproc AAS_AASLinkEntity 552 12
+export AAS_LinkEntityClientBBox
+proc AAS_LinkEntityClientBBox 60 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 AAS_AASLinkEntity
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+RETP4
+LABELV $730
+endproc AAS_LinkEntityClientBBox 60 12
+export AAS_BBoxAreas
+proc AAS_BBoxAreas 16 12
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 12
+ADDRGP4 AAS_AASLinkEntity
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $743
+JUMPV
+LABELV $740
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+LTI4 $744
+ADDRGP4 $742
+JUMPV
+LABELV $744
+LABELV $741
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $743
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $740
+LABELV $742
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AAS_UnlinkFromAreas
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $739
+endproc AAS_BBoxAreas 16 12
+export AAS_FreeReachabilityAreaGrid
+proc AAS_FreeReachabilityAreaGrid 0 4
+ADDRGP4 aasworld+532
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $747
+ADDRGP4 aasworld+532
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $747
+ADDRGP4 aasworld+532
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+536
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $752
+ADDRGP4 aasworld+536
+INDIRP4
+ARGP4
+ADDRGP4 FreeMemory
+CALLV
+pop
+LABELV $752
+ADDRGP4 aasworld+536
+CNSTP4 0
+ASGNP4
+ADDRGP4 aasworld+524
+CNSTI4 0
+ASGNI4
+ADDRGP4 aasworld+524+4
+CNSTI4 0
+ASGNI4
+LABELV $746
+endproc AAS_FreeReachabilityAreaGrid 0 4
+proc AAS_ReachabilityAreaGridCells 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $761
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 aasworld+512
+ADDP4
+INDIRF4
+SUBF4
+ADDRGP4 aasworld+520
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 aasworld+512
+ADDP4
+INDIRF4
+SUBF4
+ADDRGP4 aasworld+520
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $769
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $769
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 aasworld+524
+ADDP4
+INDIRI4
+LTI4 $771
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 aasworld+524
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $771
+LABELV $762
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $761
+LABELV $760
+endproc AAS_ReachabilityAreaGridCells 20 0
+export AAS_InitReachabilityAreaGrid
+proc AAS_InitReachabilityAreaGrid 92 16
+ADDRGP4 AAS_FreeReachabilityAreaGrid
+CALLV
+pop
+ADDRLP4 32
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 ClearBounds
+CALLV
+pop
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $779
+JUMPV
+LABELV $776
+CNSTI4 28
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $781
+ADDRGP4 $777
+JUMPV
+LABELV $781
+CNSTI4 48
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 AddPointToBounds
+CALLV
+pop
+CNSTI4 48
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 AddPointToBounds
+CALLV
+pop
+LABELV $777
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $779
+ADDRLP4 20
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $776
+ADDRLP4 32
+INDIRF4
+ADDRLP4 44
+INDIRF4
+LEF4 $786
+ADDRGP4 $775
+JUMPV
+LABELV $786
+ADDRGP4 aasworld+520
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $794
+JUMPV
+LABELV $793
+ADDRLP4 68
+ADDRGP4 aasworld+520
+ASGNP4
+ADDRLP4 68
+INDIRP4
+CNSTF4 1073741824
+ADDRLP4 68
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $794
+ADDRLP4 72
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 44
+ADDP4
+INDIRF4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 32
+ADDP4
+INDIRF4
+SUBF4
+ADDRGP4 aasworld+520
+INDIRF4
+DIVF4
+CNSTF4 1132462080
+GEF4 $793
+LABELV $790
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LTI4 $794
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $798
+ADDRLP4 68
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ADDRGP4 aasworld+512
+ADDP4
+ADDRLP4 68
+INDIRI4
+ADDRLP4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRGP4 aasworld+524
+ADDP4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 44
+ADDP4
+INDIRF4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 32
+ADDP4
+INDIRF4
+SUBF4
+ADDRGP4 aasworld+520
+INDIRF4
+DIVF4
+CVFI4 4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $799
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LTI4 $798
+ADDRLP4 60
+ADDRGP4 aasworld+524
+INDIRI4
+ADDRGP4 aasworld+524+4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+ARGU4
+ADDRLP4 68
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+532
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $812
+JUMPV
+LABELV $809
+CNSTI4 28
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $814
+ADDRGP4 $810
+JUMPV
+LABELV $814
+ADDRLP4 56
+CNSTI4 48
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 AAS_ReachabilityAreaGridCells
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 24+4
+INDIRI4
+ASGNI4
+ADDRGP4 $821
+JUMPV
+LABELV $818
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $827
+JUMPV
+LABELV $824
+ADDRLP4 76
+ADDRLP4 4
+INDIRI4
+ADDRGP4 aasworld+524
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+CNSTI4 4
+ADDI4
+ADDRGP4 aasworld+532
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $825
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $827
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $824
+LABELV $819
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $821
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8+4
+INDIRI4
+LEI4 $818
+LABELV $810
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $812
+ADDRLP4 20
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $809
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $833
+JUMPV
+LABELV $830
+ADDRLP4 72
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 72
+INDIRI4
+CNSTI4 4
+ADDI4
+ADDRGP4 aasworld+532
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDRGP4 aasworld+532
+INDIRP4
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $831
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $833
+ADDRLP4 16
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LTI4 $830
+ADDRLP4 72
+CNSTI4 2
+ASGNI4
+ADDRLP4 64
+ADDRLP4 60
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LSHI4
+ADDRGP4 aasworld+532
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+ADDRLP4 72
+INDIRI4
+LSHU4
+ARGU4
+ADDRLP4 76
+ADDRGP4 GetClearedMemory
+CALLP4
+ASGNP4
+ADDRGP4 aasworld+536
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $841
+JUMPV
+LABELV $838
+CNSTI4 28
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $843
+ADDRGP4 $839
+JUMPV
+LABELV $843
+ADDRLP4 56
+CNSTI4 48
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 AAS_ReachabilityAreaGridCells
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 24+4
+INDIRI4
+ASGNI4
+ADDRGP4 $850
+JUMPV
+LABELV $847
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $856
+JUMPV
+LABELV $853
+ADDRLP4 16
+ADDRLP4 4
+INDIRI4
+ADDRGP4 aasworld+524
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+532
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 84
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+536
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $854
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $856
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $853
+LABELV $848
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $850
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8+4
+INDIRI4
+LEI4 $847
+LABELV $839
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $841
+ADDRLP4 20
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $838
+ADDRLP4 16
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $863
+JUMPV
+LABELV $860
+ADDRLP4 80
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ADDRGP4 aasworld+532
+INDIRP4
+ADDP4
+ADDRLP4 80
+INDIRI4
+CNSTI4 4
+SUBI4
+ADDRGP4 aasworld+532
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $861
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $863
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+GTI4 $860
+ADDRGP4 aasworld+532
+INDIRP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRGP4 $868
+ARGP4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $775
+endproc AAS_InitReachabilityAreaGrid 92 16
+export AAS_BBoxReachabilityAreas
+proc AAS_BBoxReachabilityAreas 56 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 aasworld+532
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $870
+CNSTI4 0
+RETI4
+ADDRGP4 $869
+JUMPV
+LABELV $870
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 AAS_ReachabilityAreaGridCells
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+ADDRLP4 40+4
+INDIRI4
+ASGNI4
+ADDRGP4 $876
+JUMPV
+LABELV $873
+ADDRLP4 24
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $882
+JUMPV
+LABELV $879
+ADDRLP4 20
+ADDRLP4 28
+INDIRI4
+ADDRGP4 aasworld+524
+INDIRI4
+MULI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+532
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $887
+JUMPV
+LABELV $884
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+536
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 48
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $892
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDRLP4 48
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+LEF4 $896
+ADDRGP4 $894
+JUMPV
+LABELV $896
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ADDRLP4 52
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+GEF4 $898
+ADDRGP4 $894
+JUMPV
+LABELV $898
+LABELV $893
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $892
+LABELV $894
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+GEI4 $900
+ADDRGP4 $885
+JUMPV
+LABELV $900
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $905
+JUMPV
+LABELV $902
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $906
+ADDRGP4 $904
+JUMPV
+LABELV $906
+LABELV $903
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $905
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $902
+LABELV $904
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GEI4 $908
+ADDRGP4 $885
+JUMPV
+LABELV $908
+ADDRLP4 8
+INDIRI4
+ADDRFP4 12
+INDIRI4
+LTI4 $910
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $869
+JUMPV
+LABELV $910
+ADDRLP4 48
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $885
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $887
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 4
+ADDI4
+ADDRGP4 aasworld+532
+INDIRP4
+ADDP4
+INDIRI4
+LTI4 $884
+LABELV $880
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $882
+ADDRLP4 24
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $879
+LABELV $874
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $876
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32+4
+INDIRI4
+LEI4 $873
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $869
+endproc AAS_BBoxReachabilityAreas 56 16
+export AAS_PointInsideArea
+proc AAS_PointInsideArea 52 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $913
+CNSTI4 0
+RETI4
+ADDRGP4 $912
+JUMPV
+LABELV $913
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $918
+ADDRFP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $915
+LABELV $918
+CNSTI4 0
+RETI4
+ADDRGP4 $912
+JUMPV
+LABELV $915
+ADDRLP4 8
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $920
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 28
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRF4
+LEF4 $926
+ADDRLP4 32
+INDIRF4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+INDIRF4
+LTF4 $924
+LABELV $926
+CNSTI4 0
+RETI4
+ADDRGP4 $912
+JUMPV
+LABELV $924
+LABELV $921
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $920
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $930
+JUMPV
+LABELV $927
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 aasworld+212
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 24
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 aasworld+204
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 20
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 44
+CNSTI4 4
+ASGNI4
+ADDRLP4 48
+CNSTI4 8
+ASGNI4
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $934
+ADDRLP4 20
+INDIRF4
+CNSTF4 1056964608
+GEF4 $935
+CNSTI4 0
+RETI4
+ADDRGP4 $912
+JUMPV
+LABELV $934
+ADDRLP4 20
+INDIRF4
+CNSTF4 3204448256
+LEF4 $938
+CNSTI4 0
+RETI4
+ADDRGP4 $912
+JUMPV
+LABELV $938
+LABELV $935
+LABELV $928
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $930
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $927
+CNSTI4 1
+RETI4
+LABELV $912
+endproc AAS_PointInsideArea 52 4
+export AAS_AreaInfo
+proc AAS_AreaInfo 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $941
+CNSTI4 0
+RETI4
+ADDRGP4 $940
+JUMPV
+LABELV $941
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $946
+ADDRFP4 0
+INDIRI4
+ADDRGP4 aasworld+216
+INDIRI4
+LTI4 $943
+LABELV $946
+CNSTI4 3
+ARGI4
+ADDRGP4 $948
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $940
+JUMPV
+LABELV $943
+ADDRLP4 0
+CNSTI4 28
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+228
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+220
+INDIRP4
+ADDP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+CNSTI4 52
+RETI4
+LABELV $940
+endproc AAS_AreaInfo 20 12
+export AAS_PlaneFromNum
+proc AAS_PlaneFromNum 0 0
+ADDRGP4 aasworld
+INDIRI4
+CNSTI4 0
+NEI4 $954
+CNSTP4 0
+RETP4
+ADDRGP4 $953
+JUMPV
+LABELV $954
+CNSTI4 20
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 aasworld+180
+INDIRP4
+ADDP4
+RETP4
+LABELV $953
+endproc AAS_PlaneFromNum 0 0
+bss
+export numaaslinks
+align 4
+LABELV numaaslinks
+skip 4
+import aassettings
+import AAS_PrintFreeBSPLinks
+import AAS_EntityCollision
+import AAS_BSPLinkEntity
+import AAS_UnlinkFromBSPLeaves
+import AAS_DumpBSPData
+import AAS_LoadBSPFile
+import AAS_FileInfo
+import AAS_DumpAASData
+import AAS_FreeAASLump
+import AAS_WriteCompactAASFile
+import AAS_WriteAASFile
+import AAS_LoadCompactAASFile
+import AAS_LoadAASFile
+import AAS_ShutdownAlternativeRouting
+import AAS_InitAlternativeRouting
+import AAS_RoutingCacheInfo
+import AAS_RoutingInfo
+import AAS_ReadRouteTables
+import AAS_WriteRouteTables
+import AAS_WriteRouteCache
+import AAS_CreateAllRoutingCache
+import AAS_FreeRoutingCaches
+import AAS_InitRouting
+import AAS_BestReachableLinkArea
+import AAS_ContinueInitReachability
+import AAS_InitReachability
+import AAS_SetViewPortalsAsClusterPortals
+import AAS_InitClustering
+import AAS_UpdateEntities
+import AAS_UpdateEntity
+import AAS_ResetEntityLinks
+import AAS_UnlinkInvalidEntities
+import AAS_InvalidateEntities
+import AAS_StartFrame
+import AAS_LoadMap
+import AAS_Shutdown
+import AAS_Setup
+import AAS_SetInitialized
+import AAS_Error
+import aasworld
+import AAS_InitSettings
+import AAS_DropToFloor
+import AAS_SetMovedir
+import AAS_HorizontalVelocityForJump
+import AAS_BFGJumpZVelocity
+import AAS_RocketJumpZVelocity
+import AAS_AgainstLadder
+import AAS_JumpReachRunStart
+import AAS_Swimming
+import AAS_OnGround
+import AAS_PlayerMovementHitBBox
+import AAS_PredictPlayerMovement
+import AAS_IntForBSPEpairKey
+import AAS_FloatForBSPEpairKey
+import AAS_VectorForBSPEpairKey
+import AAS_ValueForBSPEpairKey
+import AAS_NextBSPEntity
+import AAS_BSPModelMinsMaxsOrigin
+import AAS_BoxEntities
+import AAS_AreasConnected
+import AAS_inPHS
+import AAS_inPVS
+import AAS_PointContents
+import AAS_Trace
+import AAS_Optimize
+import AAS_FloodAreas
+import AAS_ShowReachableAreas
+import AAS_ShowReachability
+import AAS_DrawArrow
+import AAS_PrintTravelType
+import AAS_DrawCross
+import AAS_ShowAreaPolygons
+import AAS_ShowArea
+import AAS_ShowFace
+import AAS_ShowBoundingBox
+import AAS_DrawPlaneCross
+import AAS_DrawPermanentCross
+import AAS_PermanentLine
+import AAS_DebugLine
+import AAS_ClearShownPolygons
+import AAS_ClearShownDebugLines
+import AAS_AlternativeRouteGoals
+import AAS_PredictRoute
+import AAS_AreaTravelTimeToGoalArea
+import AAS_AreaTravelTime
+import AAS_EnableRoutingArea
+import AAS_RandomGoalArea
+import AAS_ReachabilityFromNum
+import AAS_NextAreaReachability
+import AAS_AreaContentsTravelFlags
+import AAS_TravelFlagForType
+import AAS_AreaDoNotEnter
+import AAS_AreaJumpPad
+import AAS_AreaLadder
+import AAS_AreaGrounded
+import AAS_AreaSlime
+import AAS_AreaLava
+import AAS_AreaLiquid
+import AAS_AreaSwim
+import AAS_AreaCrouch
+import AAS_AreaGroundFaceArea
+import AAS_NextModelReachability
+import AAS_BestReachableFromJumpPadArea
+import AAS_BestReachableArea
+import AAS_AreaReachability
+import AAS_ProjectPointOntoVector
+import AAS_Time
+import AAS_Loaded
+import AAS_Initialized
+import botDeveloper
+import botimport
+import botlibglobals
+import GetBotLibAPI
+import LibVarSetNotModified
+import LibVarChanged
+import LibVarSet
+import LibVarString
+import LibVarValue
+import LibVar
+import LibVarGetValue
+import LibVarGetString
+import LibVarGet
+import LibVarDeAllocAll
+import DumpMemory
+import MemoryByteSize
+import PrintMemoryLabels
+import PrintUsedMemorySize
+import AvailableMemory
+import FreeMemory
+import GetClearedHunkMemory
+import GetHunkMemory
+import GetClearedMemory
+import GetMemory
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $948
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $868
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $723
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 76
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 10
+byte 1 0
+align 1
+LABELV $683
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 76
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $497
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 10
+byte 1 0
+align 1
+LABELV $426
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 66
+byte 1 111
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 10
+byte 1 0
+align 1
+LABELV $263
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $253
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 67
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $208
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $203
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 10
+byte 1 0
+align 1
+LABELV $201
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $116
+byte 1 49
+byte 1 0
+align 1
+LABELV $115
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $75
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $40
+byte 1 54
+byte 1 49
+byte 1 52
+byte 1 52
+byte 1 0
+align 1
+LABELV $39
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 95
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $33
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 95
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 66
+byte 1 111
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 10
+byte 1 0
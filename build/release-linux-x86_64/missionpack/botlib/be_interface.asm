@@ -0,0 +1,1894 @@
+data
+export botlibsetup
+align 4
+LABELV botlibsetup
+byte 4 0
+export ValidClientNumber
+code
+proc ValidClientNumber 4 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $29
+ADDRLP4 0
+INDIRI4
+ADDRGP4 botlibglobals+8
+INDIRI4
+LEI4 $26
+LABELV $29
+CNSTI4 3
+ARGI4
+ADDRGP4 $31
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 botlibglobals+8
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $25
+JUMPV
+LABELV $26
+CNSTI4 1
+RETI4
+LABELV $25
+endproc ValidClientNumber 4 20
+export ValidEntityNumber
+proc ValidEntityNumber 4 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $37
+ADDRLP4 0
+INDIRI4
+ADDRGP4 botlibglobals+4
+INDIRI4
+LEI4 $34
+LABELV $37
+CNSTI4 3
+ARGI4
+ADDRGP4 $39
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 botlibglobals+4
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $33
+JUMPV
+LABELV $34
+CNSTI4 1
+RETI4
+LABELV $33
+endproc ValidEntityNumber 4 20
+export BotLibSetup
+proc BotLibSetup 0 12
+ADDRGP4 botlibglobals
+INDIRI4
+CNSTI4 0
+NEI4 $42
+CNSTI4 3
+ARGI4
+ADDRGP4 $45
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $41
+JUMPV
+LABELV $42
+CNSTI4 1
+RETI4
+LABELV $41
+endproc BotLibSetup 0 12
+export Export_BotLibSetup
+proc Export_BotLibSetup 24 12
+ADDRGP4 $47
+ARGP4
+ADDRLP4 4
+ADDRGP4 LibVarGetValue
+CALLF4
+ASGNF4
+ADDRGP4 botDeveloper
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 botlibglobals
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 16
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 botDeveloper
+INDIRI4
+CNSTI4 0
+EQI4 $48
+ADDRGP4 $50
+ARGP4
+ADDRGP4 Log_Open
+CALLV
+pop
+LABELV $48
+CNSTI4 0
+ARGI4
+ADDRGP4 $52
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $54
+ARGP4
+ADDRGP4 $55
+ARGP4
+ADDRLP4 8
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 botlibglobals+8
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $57
+ARGP4
+ADDRGP4 $58
+ARGP4
+ADDRLP4 12
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRGP4 botlibglobals+4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 AAS_Setup
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $59
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $46
+JUMPV
+LABELV $59
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 botlibsetup
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 botlibglobals
+ADDRLP4 20
+INDIRI4
+ASGNI4
+CNSTI4 0
+RETI4
+LABELV $46
+endproc Export_BotLibSetup 24 12
+export Export_BotLibShutdown
+proc Export_BotLibShutdown 8 4
+ADDRGP4 $64
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotLibSetup
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $62
+CNSTI4 1
+RETI4
+ADDRGP4 $61
+JUMPV
+LABELV $62
+ADDRGP4 AAS_Shutdown
+CALLV
+pop
+ADDRGP4 LibVarDeAllocAll
+CALLV
+pop
+ADDRGP4 AAS_ClearShownPolygons
+CALLV
+pop
+ADDRGP4 AAS_ClearShownDebugLines
+CALLV
+pop
+ADDRGP4 Log_Shutdown
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 botlibsetup
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 botlibglobals
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $61
+endproc Export_BotLibShutdown 8 4
+export Export_BotLibVarSet
+proc Export_BotLibVarSet 0 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 LibVarSet
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $65
+endproc Export_BotLibVarSet 0 8
+export Export_BotLibVarGet
+proc Export_BotLibVarGet 8 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 LibVarGetString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+CNSTI4 0
+RETI4
+LABELV $66
+endproc Export_BotLibVarGet 8 12
+export Export_BotLibStartFrame
+proc Export_BotLibStartFrame 8 4
+ADDRGP4 $70
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotLibSetup
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $68
+CNSTI4 1
+RETI4
+ADDRGP4 $67
+JUMPV
+LABELV $68
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 AAS_StartFrame
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $67
+endproc Export_BotLibStartFrame 8 4
+export Export_BotLibLoadMap
+proc Export_BotLibLoadMap 12 8
+ADDRGP4 $74
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotLibSetup
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $72
+CNSTI4 1
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $72
+CNSTI4 0
+ARGI4
+ADDRGP4 $76
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 AAS_LoadMap
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $77
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $77
+CNSTI4 0
+ARGI4
+ADDRGP4 $80
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $71
+endproc Export_BotLibLoadMap 12 8
+export Export_BotLibUpdateEntity
+proc Export_BotLibUpdateEntity 12 8
+ADDRGP4 $84
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotLibSetup
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $82
+CNSTI4 1
+RETI4
+ADDRGP4 $81
+JUMPV
+LABELV $82
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $84
+ARGP4
+ADDRLP4 4
+ADDRGP4 ValidEntityNumber
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $85
+CNSTI4 2
+RETI4
+ADDRGP4 $81
+JUMPV
+LABELV $85
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 AAS_UpdateEntity
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $81
+endproc Export_BotLibUpdateEntity 12 8
+export Export_BotLibUpdateEntities
+proc Export_BotLibUpdateEntities 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $90
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotLibSetup
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $88
+CNSTI4 1
+RETI4
+ADDRGP4 $87
+JUMPV
+LABELV $88
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $94
+JUMPV
+LABELV $91
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $90
+ARGP4
+ADDRLP4 8
+ADDRGP4 ValidEntityNumber
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $95
+CNSTI4 2
+RETI4
+ADDRGP4 $87
+JUMPV
+LABELV $95
+LABELV $92
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $94
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRI4
+LTI4 $91
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 AAS_UpdateEntities
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $87
+endproc Export_BotLibUpdateEntities 12 12
+export Export_AAS_TracePlayerBBox
+proc Export_AAS_TracePlayerBBox 56 24
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $98
+ADDRGP4 $97
+JUMPV
+LABELV $98
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 AAS_TracePlayerBBox
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $97
+endproc Export_AAS_TracePlayerBBox 56 24
+proc Init_AAS_Export 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ADDRGP4 AAS_Loaded
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 AAS_Initialized
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 AAS_PresenceTypeBoundingBox
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 AAS_Time
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 AAS_ClearShownDebugLines
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 AAS_ClearShownPolygons
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 AAS_DebugLine
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRGP4 AAS_PermanentLine
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 AAS_DrawPermanentCross
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 AAS_DrawPlaneCross
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRGP4 AAS_ShowBoundingBox
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRGP4 AAS_ShowFace
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRGP4 AAS_ShowArea
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 AAS_ShowAreaPolygons
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRGP4 AAS_DrawCross
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 AAS_PrintTravelType
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 AAS_DrawArrow
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 AAS_ShowReachability
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRGP4 AAS_ShowReachableAreas
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRGP4 AAS_FloodAreas
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRGP4 AAS_PointAreaNum
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 AAS_PointReachabilityAreaIndex
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 Export_AAS_TracePlayerBBox
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRGP4 AAS_TraceAreas
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 AAS_BBoxAreas
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRGP4 AAS_AreaInfo
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRGP4 AAS_BBoxReachabilityAreas
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRGP4 AAS_PointInsideArea
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 AAS_PointContents
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRGP4 AAS_NextBSPEntity
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRGP4 AAS_ValueForBSPEpairKey
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRGP4 AAS_VectorForBSPEpairKey
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 AAS_FloatForBSPEpairKey
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRGP4 AAS_IntForBSPEpairKey
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRGP4 AAS_AreaReachability
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRGP4 AAS_BestReachableArea
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRGP4 AAS_BestReachableFromJumpPadArea
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRGP4 AAS_NextModelReachability
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRGP4 AAS_AreaGroundFaceArea
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRGP4 AAS_AreaCrouch
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRGP4 AAS_AreaSwim
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRGP4 AAS_AreaLiquid
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRGP4 AAS_AreaLava
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+ADDRGP4 AAS_AreaSlime
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRGP4 AAS_AreaGrounded
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRGP4 AAS_AreaLadder
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRGP4 AAS_AreaJumpPad
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRGP4 AAS_AreaDoNotEnter
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRGP4 AAS_TravelFlagForType
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRGP4 AAS_AreaContentsTravelFlags
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRGP4 AAS_NextAreaReachability
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRGP4 AAS_ReachabilityFromNum
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRGP4 AAS_RandomGoalArea
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ADDRGP4 AAS_EnableRoutingArea
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+ADDRGP4 AAS_AreaTravelTime
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ADDRGP4 AAS_AreaTravelTimeToGoalArea
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ADDRGP4 AAS_PredictRoute
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDRGP4 AAS_AlternativeRouteGoals
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRGP4 AAS_PredictPlayerMovement
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRGP4 AAS_OnGround
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+ADDRGP4 AAS_Swimming
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+ADDRGP4 AAS_JumpReachRunStart
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDRGP4 AAS_AgainstLadder
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+ADDRGP4 AAS_HorizontalVelocityForJump
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDRGP4 AAS_DropToFloor
+ASGNP4
+LABELV $100
+endproc Init_AAS_Export 0 0
+export GetBotLibAPI
+proc GetBotLibAPI 0 16
+ADDRGP4 botimport
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 92
+ADDRGP4 be_botlib_export
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 292
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 5
+EQI4 $102
+CNSTI4 3
+ARGI4
+ADDRGP4 $105
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $101
+JUMPV
+LABELV $102
+ADDRGP4 be_botlib_export
+ARGP4
+ADDRGP4 Init_AAS_Export
+CALLV
+pop
+ADDRGP4 be_botlib_export+260
+ADDRGP4 Export_BotLibSetup
+ASGNP4
+ADDRGP4 be_botlib_export+264
+ADDRGP4 Export_BotLibShutdown
+ASGNP4
+ADDRGP4 be_botlib_export+268
+ADDRGP4 Export_BotLibVarSet
+ASGNP4
+ADDRGP4 be_botlib_export+272
+ADDRGP4 Export_BotLibVarGet
+ASGNP4
+ADDRGP4 be_botlib_export+276
+ADDRGP4 Export_BotLibStartFrame
+ASGNP4
+ADDRGP4 be_botlib_export+280
+ADDRGP4 Export_BotLibLoadMap
+ASGNP4
+ADDRGP4 be_botlib_export+284
+ADDRGP4 Export_BotLibUpdateEntity
+ASGNP4
+ADDRGP4 be_botlib_export+288
+ADDRGP4 Export_BotLibUpdateEntities
+ASGNP4
+ADDRGP4 be_botlib_export
+RETP4
+LABELV $101
+endproc GetBotLibAPI 0 16
+bss
+export be_botlib_export
+align 4
+LABELV be_botlib_export
+skip 292
+export botDeveloper
+align 4
+LABELV botDeveloper
+skip 4
+export botimport
+align 4
+LABELV botimport
+skip 92
+export botlibglobals
+align 4
+LABELV botlibglobals
+skip 16
+import aassettings
+import AAS_PrintFreeBSPLinks
+import AAS_EntityCollision
+import AAS_BSPLinkEntity
+import AAS_UnlinkFromBSPLeaves
+import AAS_DumpBSPData
+import AAS_LoadBSPFile
+import AAS_FileInfo
+import AAS_DumpAASData
+import AAS_FreeAASLump
+import AAS_WriteCompactAASFile
+import AAS_WriteAASFile
+import AAS_LoadCompactAASFile
+import AAS_LoadAASFile
+import AAS_ShutdownAlternativeRouting
+import AAS_InitAlternativeRouting
+import AAS_RoutingCacheInfo
+import AAS_RoutingInfo
+import AAS_ReadRouteTables
+import AAS_WriteRouteTables
+import AAS_WriteRouteCache
+import AAS_CreateAllRoutingCache
+import AAS_FreeRoutingCaches
+import AAS_InitRouting
+import AAS_BestReachableLinkArea
+import AAS_ContinueInitReachability
+import AAS_InitReachability
+import AAS_SetViewPortalsAsClusterPortals
+import AAS_InitClustering
+import AAS_SampleBenchmark
+import AAS_FreeFlatNodes
+import AAS_InitFlatNodes
+import AAS_FreeReachabilityAreaGrid
+import AAS_InitReachabilityAreaGrid
+import AAS_UnlinkFromAreas
+import AAS_InsideFace
+import AAS_PointInsideFace
+import AAS_LinkEntityClientBBox
+import AAS_AASLinkEntity
+import AAS_PlaneFromNum
+import AAS_TraceEndFace
+import AAS_AreaGroundFace
+import AAS_FreeAASLinkedEntities
+import AAS_FreeAASLinkHeap
+import AAS_InitAASLinkedEntities
+import AAS_InitAASLinkHeap
+import AAS_UpdateEntities
+import AAS_UpdateEntity
+import AAS_ResetEntityLinks
+import AAS_UnlinkInvalidEntities
+import AAS_InvalidateEntities
+import AAS_StartFrame
+import AAS_LoadMap
+import AAS_Shutdown
+import AAS_Setup
+import AAS_SetInitialized
+import AAS_Error
+import aasworld
+import AAS_InitSettings
+import AAS_DropToFloor
+import AAS_SetMovedir
+import AAS_HorizontalVelocityForJump
+import AAS_BFGJumpZVelocity
+import AAS_RocketJumpZVelocity
+import AAS_AgainstLadder
+import AAS_JumpReachRunStart
+import AAS_Swimming
+import AAS_OnGround
+import AAS_PlayerMovementHitBBox
+import AAS_PredictPlayerMovement
+import AAS_IntForBSPEpairKey
+import AAS_FloatForBSPEpairKey
+import AAS_VectorForBSPEpairKey
+import AAS_ValueForBSPEpairKey
+import AAS_NextBSPEntity
+import AAS_BSPModelMinsMaxsOrigin
+import AAS_BoxEntities
+import AAS_AreasConnected
+import AAS_inPHS
+import AAS_inPVS
+import AAS_PointContents
+import AAS_Trace
+import AAS_Optimize
+import AAS_FloodAreas
+import AAS_ShowReachableAreas
+import AAS_ShowReachability
+import AAS_DrawArrow
+import AAS_PrintTravelType
+import AAS_DrawCross
+import AAS_ShowAreaPolygons
+import AAS_ShowArea
+import AAS_ShowFace
+import AAS_ShowBoundingBox
+import AAS_DrawPlaneCross
+import AAS_DrawPermanentCross
+import AAS_PermanentLine
+import AAS_DebugLine
+import AAS_ClearShownPolygons
+import AAS_ClearShownDebugLines
+import AAS_AlternativeRouteGoals
+import AAS_PredictRoute
+import AAS_AreaTravelTimeToGoalArea
+import AAS_AreaTravelTime
+import AAS_EnableRoutingArea
+import AAS_RandomGoalArea
+import AAS_ReachabilityFromNum
+import AAS_NextAreaReachability
+import AAS_AreaContentsTravelFlags
+import AAS_TravelFlagForType
+import AAS_AreaDoNotEnter
+import AAS_AreaJumpPad
+import AAS_AreaLadder
+import AAS_AreaGrounded
+import AAS_AreaSlime
+import AAS_AreaLava
+import AAS_AreaLiquid
+import AAS_AreaSwim
+import AAS_AreaCrouch
+import AAS_AreaGroundFaceArea
+import AAS_NextModelReachability
+import AAS_BestReachableFromJumpPadArea
+import AAS_BestReachableArea
+import AAS_AreaReachability
+import AAS_FacePlane
+import AAS_PointReachabilityAreaIndex
+import AAS_PointAreaNum
+import AAS_AreaInfo
+import AAS_PointInsideArea
+import AAS_BBoxReachabilityAreas
+import AAS_BBoxAreas
+import AAS_TraceAreas
+import AAS_TracePlayerBBox
+import AAS_PointPresenceType
+import AAS_AreaPresenceType
+import AAS_AreaCluster
+import AAS_PresenceTypeBoundingBox
+import AAS_ProjectPointOntoVector
+import AAS_Time
+import AAS_Loaded
+import AAS_Initialized
+import DumpMemory
+import MemoryByteSize
+import PrintMemoryLabels
+import PrintUsedMemorySize
+import AvailableMemory
+import FreeMemory
+import GetClearedHunkMemory
+import GetHunkMemory
+import GetClearedMemory
+import GetMemory
+import LibVarSetNotModified
+import LibVarChanged
+import LibVarSet
+import LibVarString
+import LibVarValue
+import LibVar
+import LibVarGetValue
+import LibVarGetString
+import LibVarGet
+import LibVarDeAllocAll
+import Log_Flush
+import Log_FileHandle
+import Log_WriteTimeStamped
+import Log_Write
+import Log_Shutdown
+import Log_Close
+import Log_Open
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $105
+byte 1 77
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 66
+byte 1 79
+byte 1 84
+byte 1 76
+byte 1 73
+byte 1 66
+byte 1 95
+byte 1 65
+byte 1 80
+byte 1 73
+byte 1 95
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $90
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 85
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $84
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 85
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $80
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $76
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 32
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $74
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $70
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $64
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 76
+byte 1 105
+byte 1 98
+byte 1 83
+byte 1 104
+byte 1 117
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $58
+byte 1 49
+byte 1 48
+byte 1 50
+byte 1 52
+byte 1 0
+align 1
+LABELV $57
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $55
+byte 1 49
+byte 1 50
+byte 1 56
+byte 1 0
+align 1
+LABELV $54
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $52
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 32
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 76
+byte 1 105
+byte 1 98
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $50
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 98
+byte 1 46
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $47
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $45
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $39
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 91
+byte 1 48
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $31
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 91
+byte 1 48
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 10
+byte 1 0
@@ -0,0 +1,711 @@
+data
+export crctable
+align 4
+LABELV crctable
+byte 4 0
+byte 4 4129
+byte 4 8258
+byte 4 12387
+byte 4 16516
+byte 4 20645
+byte 4 24774
+byte 4 28903
+byte 4 33032
+byte 4 37161
+byte 4 41290
+byte 4 45419
+byte 4 49548
+byte 4 53677
+byte 4 57806
+byte 4 61935
+byte 4 4657
+byte 4 528
+byte 4 12915
+byte 4 8786
+byte 4 21173
+byte 4 17044
+byte 4 29431
+byte 4 25302
+byte 4 37689
+byte 4 33560
+byte 4 45947
+byte 4 41818
+byte 4 54205
+byte 4 50076
+byte 4 62463
+byte 4 58334
+byte 4 9314
+byte 4 13379
+byte 4 1056
+byte 4 5121
+byte 4 25830
+byte 4 29895
+byte 4 17572
+byte 4 21637
+byte 4 42346
+byte 4 46411
+byte 4 34088
+byte 4 38153
+byte 4 58862
+byte 4 62927
+byte 4 50604
+byte 4 54669
+byte 4 13907
+byte 4 9842
+byte 4 5649
+byte 4 1584
+byte 4 30423
+byte 4 26358
+byte 4 22165
+byte 4 18100
+byte 4 46939
+byte 4 42874
+byte 4 38681
+byte 4 34616
+byte 4 63455
+byte 4 59390
+byte 4 55197
+byte 4 51132
+byte 4 18628
+byte 4 22757
+byte 4 26758
+byte 4 30887
+byte 4 2112
+byte 4 6241
+byte 4 10242
+byte 4 14371
+byte 4 51660
+byte 4 55789
+byte 4 59790
+byte 4 63919
+byte 4 35144
+byte 4 39273
+byte 4 43274
+byte 4 47403
+byte 4 23285
+byte 4 19156
+byte 4 31415
+byte 4 27286
+byte 4 6769
+byte 4 2640
+byte 4 14899
+byte 4 10770
+byte 4 56317
+byte 4 52188
+byte 4 64447
+byte 4 60318
+byte 4 39801
+byte 4 35672
+byte 4 47931
+byte 4 43802
+byte 4 27814
+byte 4 31879
+byte 4 19684
+byte 4 23749
+byte 4 11298
+byte 4 15363
+byte 4 3168
+byte 4 7233
+byte 4 60846
+byte 4 64911
+byte 4 52716
+byte 4 56781
+byte 4 44330
+byte 4 48395
+byte 4 36200
+byte 4 40265
+byte 4 32407
+byte 4 28342
+byte 4 24277
+byte 4 20212
+byte 4 15891
+byte 4 11826
+byte 4 7761
+byte 4 3696
+byte 4 65439
+byte 4 61374
+byte 4 57309
+byte 4 53244
+byte 4 48923
+byte 4 44858
+byte 4 40793
+byte 4 36728
+byte 4 37256
+byte 4 33193
+byte 4 45514
+byte 4 41451
+byte 4 53516
+byte 4 49453
+byte 4 61774
+byte 4 57711
+byte 4 4224
+byte 4 161
+byte 4 12482
+byte 4 8419
+byte 4 20484
+byte 4 16421
+byte 4 28742
+byte 4 24679
+byte 4 33721
+byte 4 37784
+byte 4 41979
+byte 4 46042
+byte 4 49981
+byte 4 54044
+byte 4 58239
+byte 4 62302
+byte 4 689
+byte 4 4752
+byte 4 8947
+byte 4 13010
+byte 4 16949
+byte 4 21012
+byte 4 25207
+byte 4 29270
+byte 4 46570
+byte 4 42443
+byte 4 38312
+byte 4 34185
+byte 4 62830
+byte 4 58703
+byte 4 54572
+byte 4 50445
+byte 4 13538
+byte 4 9411
+byte 4 5280
+byte 4 1153
+byte 4 29798
+byte 4 25671
+byte 4 21540
+byte 4 17413
+byte 4 42971
+byte 4 47098
+byte 4 34713
+byte 4 38840
+byte 4 59231
+byte 4 63358
+byte 4 50973
+byte 4 55100
+byte 4 9939
+byte 4 14066
+byte 4 1681
+byte 4 5808
+byte 4 26199
+byte 4 30326
+byte 4 17941
+byte 4 22068
+byte 4 55628
+byte 4 51565
+byte 4 63758
+byte 4 59695
+byte 4 39368
+byte 4 35305
+byte 4 47498
+byte 4 43435
+byte 4 22596
+byte 4 18533
+byte 4 30726
+byte 4 26663
+byte 4 6336
+byte 4 2273
+byte 4 14466
+byte 4 10403
+byte 4 52093
+byte 4 56156
+byte 4 60223
+byte 4 64286
+byte 4 35833
+byte 4 39896
+byte 4 43963
+byte 4 48026
+byte 4 19061
+byte 4 23124
+byte 4 27191
+byte 4 31254
+byte 4 2801
+byte 4 6864
+byte 4 10931
+byte 4 14994
+byte 4 64814
+byte 4 60687
+byte 4 56684
+byte 4 52557
+byte 4 48554
+byte 4 44427
+byte 4 40424
+byte 4 36297
+byte 4 31782
+byte 4 27655
+byte 4 23652
+byte 4 19525
+byte 4 15522
+byte 4 11395
+byte 4 7392
+byte 4 3265
+byte 4 61215
+byte 4 65342
+byte 4 53085
+byte 4 57212
+byte 4 44955
+byte 4 49082
+byte 4 36825
+byte 4 40952
+byte 4 28183
+byte 4 32310
+byte 4 20053
+byte 4 24180
+byte 4 11923
+byte 4 16050
+byte 4 3793
+byte 4 7920
+skip 4
+export CRC_Init
+code
+proc CRC_Init 0 0
+ADDRFP4 0
+INDIRP4
+CNSTU2 65535
+ASGNU2
+LABELV $23
+endproc CRC_Init 0 0
+export CRC_ProcessByte
+proc CRC_ProcessByte 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRU2
+CVUI4 2
+ASGNI4
+ADDRLP4 8
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+CVIU4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+RSHI4
+ADDRFP4 4
+INDIRU1
+CVUI4 1
+BXORI4
+CNSTI4 2
+LSHI4
+ADDRGP4 crctable
+ADDP4
+INDIRU4
+BXORU4
+CVUU2 4
+ASGNU2
+LABELV $24
+endproc CRC_ProcessByte 12 0
+export CRC_Value
+proc CRC_Value 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVIU4 4
+CVUU2 4
+ASGNU2
+ADDRFP4 0
+INDIRU2
+CVUI4 2
+CVIU4 4
+CVUU2 4
+CVUI4 2
+RETI4
+LABELV $25
+endproc CRC_Value 0 0
+export CRC_ProcessString
+proc CRC_ProcessString 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CRC_Init
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $30
+JUMPV
+LABELV $27
+ADDRLP4 0
+ADDRLP4 4
+INDIRU2
+CVUI4 2
+CNSTI4 8
+RSHI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRU1
+CVUI4 1
+BXORI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $33
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LEI4 $31
+LABELV $33
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $31
+ADDRLP4 4
+ADDRLP4 4
+INDIRU2
+CVUI4 2
+CNSTI4 8
+LSHI4
+CVIU4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 crctable
+ADDP4
+INDIRU4
+BXORU4
+CVUU2 4
+ASGNU2
+LABELV $28
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $30
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $27
+ADDRLP4 4
+INDIRU2
+CVUI4 2
+ARGI4
+ADDRLP4 12
+ADDRGP4 CRC_Value
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+CVUU2 4
+CVUI4 2
+RETI4
+LABELV $26
+endproc CRC_ProcessString 16 4
+export CRC_ContinueProcessString
+proc CRC_ContinueProcessString 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $38
+JUMPV
+LABELV $35
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRU2
+CVUI4 2
+ASGNI4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+CVIU4 4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+RSHI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+BXORI4
+CNSTI4 2
+LSHI4
+ADDRGP4 crctable
+ADDP4
+INDIRU4
+BXORU4
+CVUU2 4
+ASGNU2
+LABELV $36
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $38
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $35
+LABELV $34
+endproc CRC_ContinueProcessString 16 0
+import botDeveloper
+import botimport
+import botlibglobals
+import GetBotLibAPI
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
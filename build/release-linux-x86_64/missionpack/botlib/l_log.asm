@@ -0,0 +1,737 @@
+export Log_Open
+code
+proc Log_Open 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $26
+ARGP4
+ADDRGP4 $27
+ARGP4
+ADDRLP4 0
+ADDRGP4 LibVarValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+NEF4 $24
+ADDRGP4 $23
+JUMPV
+LABELV $24
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $30
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+INDIRU4
+CNSTU4 0
+NEU4 $28
+LABELV $30
+CNSTI4 1
+ARGI4
+ADDRGP4 $32
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $23
+JUMPV
+LABELV $28
+ADDRGP4 logfile+1024
+INDIRI4
+CNSTI4 0
+EQI4 $33
+CNSTI4 3
+ARGI4
+ADDRGP4 $37
+ARGP4
+ADDRGP4 logfile
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $23
+JUMPV
+LABELV $33
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 logfile+1024
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 botimport+52
+INDIRP4
+CALLI4
+pop
+ADDRGP4 logfile+1024
+INDIRI4
+CNSTI4 0
+NEI4 $40
+CNSTI4 3
+ARGI4
+ADDRGP4 $44
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $23
+JUMPV
+LABELV $40
+ADDRGP4 logfile
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $46
+ARGP4
+ADDRGP4 logfile
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $23
+endproc Log_Open 12 12
+export Log_Close
+proc Log_Close 0 12
+ADDRGP4 logfile+1024
+INDIRI4
+CNSTI4 0
+NEI4 $48
+ADDRGP4 $47
+JUMPV
+LABELV $48
+ADDRGP4 logfile+1024
+INDIRI4
+ARGI4
+ADDRGP4 botimport+64
+INDIRP4
+CALLV
+pop
+ADDRGP4 logfile+1024
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRGP4 $55
+ARGP4
+ADDRGP4 logfile
+ARGP4
+ADDRGP4 botimport+4
+INDIRP4
+CALLV
+pop
+LABELV $47
+endproc Log_Close 0 12
+export Log_Shutdown
+proc Log_Shutdown 0 0
+ADDRGP4 logfile+1024
+INDIRI4
+CNSTI4 0
+EQI4 $57
+ADDRGP4 Log_Close
+CALLV
+pop
+LABELV $57
+LABELV $56
+endproc Log_Shutdown 0 0
+export Log_Write
+proc Log_Write 1032 16
+ADDRGP4 logfile+1024
+INDIRI4
+CNSTI4 0
+NEI4 $61
+ADDRGP4 $60
+JUMPV
+LABELV $61
+ADDRLP4 1024
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 1024
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1028
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1028
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRGP4 logfile+1024
+INDIRI4
+ARGI4
+ADDRGP4 botimport+60
+INDIRP4
+CALLI4
+pop
+LABELV $60
+endproc Log_Write 1032 16
+export Log_WriteTimeStamped
+proc Log_WriteTimeStamped 1052 32
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $68
+ARGP4
+ADDRGP4 logfile+1028
+INDIRI4
+ARGI4
+ADDRLP4 1032
+CNSTF4 1114636288
+ASGNF4
+ADDRGP4 botlibglobals+12
+INDIRF4
+ADDRLP4 1032
+INDIRF4
+DIVF4
+ADDRLP4 1032
+INDIRF4
+DIVF4
+CVFI4 4
+ARGI4
+ADDRGP4 botlibglobals+12
+INDIRF4
+ADDRLP4 1032
+INDIRF4
+DIVF4
+CVFI4 4
+ARGI4
+ADDRGP4 botlibglobals+12
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTF4 1120403456
+ADDRGP4 botlibglobals+12
+INDIRF4
+MULF4
+CVFI4 4
+CNSTI4 100
+ADDRGP4 botlibglobals+12
+INDIRF4
+CVFI4 4
+MULI4
+SUBI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1028
+ADDRLP4 1036
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 1024
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 1028
+INDIRI4
+ADDRLP4 0
+ADDP4
+ARGP4
+CNSTU4 1024
+ADDRLP4 1028
+INDIRI4
+CVIU4 4
+SUBU4
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 1024
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $76
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 1044
+ADDRGP4 logfile+1028
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ADDRLP4 1044
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRGP4 logfile+1024
+INDIRI4
+ARGI4
+ADDRGP4 botimport+60
+INDIRP4
+CALLI4
+pop
+LABELV $67
+endproc Log_WriteTimeStamped 1052 32
+export Log_FileHandle
+proc Log_FileHandle 0 0
+ADDRGP4 logfile+1024
+INDIRI4
+RETI4
+LABELV $80
+endproc Log_FileHandle 0 0
+export Log_Flush
+proc Log_Flush 0 0
+LABELV $82
+endproc Log_Flush 0 0
+bss
+export logfile
+align 4
+LABELV logfile
+skip 1032
+import LibVarSetNotModified
+import LibVarChanged
+import LibVarSet
+import LibVarString
+import LibVarValue
+import LibVar
+import LibVarGetValue
+import LibVarGetString
+import LibVarGet
+import LibVarDeAllocAll
+import botDeveloper
+import botimport
+import botlibglobals
+import GetBotLibAPI
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $76
+byte 1 13
+byte 1 10
+byte 1 0
+align 1
+LABELV $68
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $55
+byte 1 67
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $46
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $44
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $37
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 32
+byte 1 60
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $27
+byte 1 48
+byte 1 0
+align 1
+LABELV $26
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
@@ -0,0 +1,416 @@
+export GetMemory
+code
+proc GetMemory 12 4
+ADDRFP4 0
+INDIRU4
+CNSTU4 4
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 8
+ADDRGP4 botimport+36
+INDIRP4
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $25
+CNSTP4 0
+RETP4
+ADDRGP4 $23
+JUMPV
+LABELV $25
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTU4 305419896
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CNSTU4 4
+ADDP4
+RETP4
+LABELV $23
+endproc GetMemory 12 4
+export GetClearedMemory
+proc GetClearedMemory 8 12
+ADDRFP4 0
+INDIRU4
+ARGU4
+ADDRLP4 4
+ADDRGP4 GetMemory
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRU4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $27
+endproc GetClearedMemory 8 12
+export GetHunkMemory
+proc GetHunkMemory 12 4
+ADDRFP4 0
+INDIRU4
+CNSTU4 4
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 8
+ADDRGP4 botimport+48
+INDIRP4
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $30
+CNSTP4 0
+RETP4
+ADDRGP4 $28
+JUMPV
+LABELV $30
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTU4 2271560481
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CNSTU4 4
+ADDP4
+RETP4
+LABELV $28
+endproc GetHunkMemory 12 4
+export GetClearedHunkMemory
+proc GetClearedHunkMemory 8 12
+ADDRFP4 0
+INDIRU4
+ARGU4
+ADDRLP4 4
+ADDRGP4 GetHunkMemory
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRU4
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $32
+endproc GetClearedHunkMemory 8 12
+export FreeMemory
+proc FreeMemory 4 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 -4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 305419896
+NEU4 $34
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 botimport+40
+INDIRP4
+CALLV
+pop
+LABELV $34
+LABELV $33
+endproc FreeMemory 4 4
+export AvailableMemory
+proc AvailableMemory 4 0
+ADDRLP4 0
+ADDRGP4 botimport+44
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $37
+endproc AvailableMemory 4 0
+export PrintUsedMemorySize
+proc PrintUsedMemorySize 0 0
+LABELV $39
+endproc PrintUsedMemorySize 0 0
+export PrintMemoryLabels
+proc PrintMemoryLabels 0 0
+LABELV $40
+endproc PrintMemoryLabels 0 0
+bss
+export numblocks
+align 4
+LABELV numblocks
+skip 4
+export totalmemorysize
+align 4
+LABELV totalmemorysize
+skip 4
+export allocatedmemory
+align 4
+LABELV allocatedmemory
+skip 4
+import botDeveloper
+import botimport
+import botlibglobals
+import DumpMemory
+import MemoryByteSize
+import Log_Flush
+import Log_FileHandle
+import Log_WriteTimeStamped
+import Log_Write
+import Log_Shutdown
+import Log_Close
+import Log_Open
+import GetBotLibAPI
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
@@ -0,0 +1,11888 @@
+export CG_TargetCommand_f
+code
+proc CG_TargetCommand_f 24 16
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $106
+ADDRGP4 $105
+JUMPV
+LABELV $106
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $109
+ARGP4
+ADDRLP4 12
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 $108
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $105
+endproc CG_TargetCommand_f 24 16
+proc CG_SizeUp_f 4 12
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 10
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $111
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $110
+endproc CG_SizeUp_f 4 12
+proc CG_SizeDown_f 4 12
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 10
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $111
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $113
+endproc CG_SizeDown_f 4 12
+export CG_MessageMode_f
+proc CG_MessageMode_f 4 12
+ADDRGP4 cg+517696
+ARGP4
+ADDRGP4 $117
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+517728
+ARGP4
+ADDRGP4 $120
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+517792
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRGP4 cg+517792+8
+CNSTI4 30
+ASGNI4
+ADDRLP4 0
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BXORI4
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+LABELV $115
+endproc CG_MessageMode_f 4 12
+export CG_MessageMode2_f
+proc CG_MessageMode2_f 4 12
+ADDRGP4 cg+517696
+ARGP4
+ADDRGP4 $127
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+517728
+ARGP4
+ADDRGP4 $130
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+517792
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRGP4 cg+517792+8
+CNSTI4 25
+ASGNI4
+ADDRLP4 0
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BXORI4
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+LABELV $125
+endproc CG_MessageMode2_f 4 12
+export CG_MessageMode3_f
+proc CG_MessageMode3_f 16 16
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $138
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $136
+LABELV $138
+ADDRGP4 $135
+JUMPV
+LABELV $136
+ADDRGP4 cg+517696
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $141
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 cg+517728
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $144
+ARGP4
+CNSTI4 2108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+4
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 cg+517792
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRGP4 cg+517792+8
+CNSTI4 30
+ASGNI4
+ADDRLP4 12
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+BXORI4
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+LABELV $135
+endproc CG_MessageMode3_f 16 16
+export CG_MessageMode4_f
+proc CG_MessageMode4_f 16 16
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $153
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $151
+LABELV $153
+ADDRGP4 $150
+JUMPV
+LABELV $151
+ADDRGP4 cg+517696
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $141
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 cg+517728
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $144
+ARGP4
+CNSTI4 2108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+4
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 cg+517792
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRGP4 cg+517792+8
+CNSTI4 30
+ASGNI4
+ADDRLP4 12
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+BXORI4
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+LABELV $150
+endproc CG_MessageMode4_f 16 16
+export CG_CenterEcho_f
+proc CG_CenterEcho_f 1024 16
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 92
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRGP4 CG_ReplaceCharacter
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTF4 1056964608
+ARGF4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $163
+endproc CG_CenterEcho_f 1024 16
+proc CG_Viewpos_f 4 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 0
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+531852+35984
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+531852+35984+4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+531852+35984+8
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+531852+35996+4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $164
+endproc CG_Viewpos_f 4 20
+proc CG_ScoresDown_f 12 8
+ADDRLP4 0
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+ASGNP4
+ADDRGP4 CG_BuildSpectatorString
+CALLV
+pop
+ADDRGP4 cg+518836
+INDIRI4
+CNSTI4 2000
+ADDI4
+ADDRGP4 cg+512320
+INDIRI4
+GEI4 $179
+ADDRGP4 cg+518836
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRGP4 $185
+ARGP4
+ADDRGP4 cg+518840
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 CG_AnyScoreboardShowing
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $187
+ADDRGP4 cg+518844
+CNSTI4 0
+ASGNI4
+LABELV $187
+ADDRLP4 0
+INDIRP4
+CNSTI4 36008
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $179
+ADDRLP4 0
+INDIRP4
+CNSTI4 36008
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $180
+LABELV $177
+endproc CG_ScoresDown_f 12 8
+proc CG_ScoresUp_f 4 0
+ADDRLP4 0
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36008
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $192
+ADDRLP4 0
+INDIRP4
+CNSTI4 36008
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36016
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $192
+LABELV $190
+endproc CG_ScoresUp_f 4 0
+export CG_SetModel_f
+proc CG_SetModel_f 304 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $196
+ARGP4
+ADDRLP4 292
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 292
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRLP4 296
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 296
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $197
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $199
+ARGP4
+ADDRLP4 300
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $198
+JUMPV
+LABELV $197
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $200
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $198
+LABELV $195
+endproc CG_SetModel_f 304 12
+export CG_SetHeadmodel_f
+proc CG_SetHeadmodel_f 300 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $199
+ARGP4
+ADDRLP4 292
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 292
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRLP4 296
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 296
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $202
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $203
+JUMPV
+LABELV $202
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $200
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $203
+LABELV $201
+endproc CG_SetHeadmodel_f 300 12
+export CG_SetTeamModel_f
+proc CG_SetTeamModel_f 304 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 292
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 292
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRLP4 296
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 296
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $206
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $208
+ARGP4
+ADDRLP4 300
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $207
+JUMPV
+LABELV $206
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $200
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $207
+LABELV $204
+endproc CG_SetTeamModel_f 304 12
+export CG_SetTeamHeadmodel_f
+proc CG_SetTeamHeadmodel_f 300 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $208
+ARGP4
+ADDRLP4 292
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 292
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRLP4 296
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 296
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $210
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $211
+JUMPV
+LABELV $210
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $200
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $211
+LABELV $209
+endproc CG_SetTeamHeadmodel_f 300 12
+proc CG_Field_CompletePlayerModel 12648 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 8376
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 8364
+CNSTI4 0
+ASGNI4
+ADDRGP4 $214
+JUMPV
+LABELV $213
+ADDRLP4 8364
+ADDRLP4 8364
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $214
+ADDRLP4 12548
+ADDRLP4 8364
+INDIRI4
+ADDRLP4 8376
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12548
+INDIRI4
+CNSTI4 0
+EQI4 $216
+ADDRLP4 12548
+INDIRI4
+CNSTI4 47
+NEI4 $213
+LABELV $216
+ADDRLP4 8364
+INDIRI4
+ADDRLP4 8376
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8288
+CNSTI1 0
+ASGNI1
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $217
+ADDRFP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $219
+ADDRLP4 8288
+ARGP4
+ADDRGP4 cg_blueTeamName+16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $220
+JUMPV
+LABELV $219
+ADDRLP4 8288
+ARGP4
+ADDRGP4 cg_redTeamName+16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $220
+LABELV $217
+ADDRLP4 8288
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $223
+ADDRLP4 8288
+ARGP4
+ADDRGP4 $225
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $223
+ADDRLP4 8288
+ARGP4
+ADDRLP4 12568
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 72
+ADDRLP4 12568
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $229
+ADDRLP4 12552
+ADDRGP4 $226
+ASGNP4
+ADDRGP4 $230
+JUMPV
+LABELV $229
+ADDRLP4 12552
+ADDRGP4 $227
+ASGNP4
+LABELV $230
+ADDRLP4 8352
+ADDRLP4 12552
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $232
+ADDRLP4 12556
+CNSTI4 5
+ASGNI4
+ADDRGP4 $233
+JUMPV
+LABELV $232
+ADDRLP4 12556
+CNSTI4 6
+ASGNI4
+LABELV $233
+ADDRLP4 76
+ADDRLP4 12556
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $237
+ADDRLP4 12560
+ADDRGP4 $234
+ASGNP4
+ADDRGP4 $238
+JUMPV
+LABELV $237
+ADDRLP4 12560
+ADDRGP4 $235
+ASGNP4
+LABELV $238
+ADDRLP4 8440
+ADDRLP4 12560
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $240
+ADDRLP4 12564
+CNSTI4 5
+ASGNI4
+ADDRGP4 $241
+JUMPV
+LABELV $240
+ADDRLP4 12564
+CNSTI4 6
+ASGNI4
+LABELV $241
+ADDRLP4 8372
+ADDRLP4 12564
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 8192
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 8356
+CNSTI4 0
+ASGNI4
+ADDRLP4 12572
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12572
+INDIRI4
+EQI4 $245
+ADDRLP4 8364
+INDIRI4
+ADDRLP4 12572
+INDIRI4
+EQI4 $245
+ADDRLP4 8376
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $242
+LABELV $245
+ADDRGP4 $246
+ARGP4
+ADDRGP4 $225
+ARGP4
+ADDRLP4 10500
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 12576
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 10496
+ADDRLP4 12576
+INDIRI4
+ASGNI4
+ADDRLP4 8280
+ADDRLP4 10500
+ASGNP4
+ADDRLP4 8444
+CNSTI4 0
+ASGNI4
+ADDRGP4 $250
+JUMPV
+LABELV $247
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 12580
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8368
+ADDRLP4 12580
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8368
+INDIRI4
+CNSTI4 0
+NEI4 $251
+ADDRGP4 $248
+JUMPV
+LABELV $251
+ADDRLP4 8368
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8280
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $253
+ADDRLP4 8368
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8280
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $253
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRGP4 $257
+ARGP4
+ADDRLP4 12584
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12584
+INDIRI4
+CNSTI4 0
+EQI4 $261
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRGP4 $258
+ARGP4
+ADDRLP4 12588
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12588
+INDIRI4
+CNSTI4 0
+EQI4 $261
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRGP4 $259
+ARGP4
+ADDRLP4 12592
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12592
+INDIRI4
+CNSTI4 0
+NEI4 $255
+LABELV $261
+ADDRGP4 $248
+JUMPV
+LABELV $255
+ADDRLP4 8364
+INDIRI4
+CNSTI4 0
+LEI4 $262
+ADDRLP4 8376
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 8364
+INDIRI4
+ARGI4
+ADDRLP4 12600
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 12600
+INDIRI4
+CNSTI4 0
+EQI4 $262
+ADDRGP4 $248
+JUMPV
+LABELV $262
+ADDRGP4 $264
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 12604
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12604
+INDIRP4
+ARGP4
+ADDRGP4 $265
+ARGP4
+ADDRLP4 8448
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 12608
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 8284
+ADDRLP4 12608
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 8448
+ASGNP4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRGP4 $269
+JUMPV
+LABELV $266
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 12612
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 84
+ADDRLP4 12612
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+LEI4 $270
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8288
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 12620
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 12620
+INDIRI4
+CNSTI4 0
+NEI4 $270
+ADDRLP4 0
+ADDRLP4 72
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $270
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8352
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 12624
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 12624
+INDIRI4
+CNSTI4 0
+EQI4 $272
+ADDRGP4 $267
+JUMPV
+LABELV $272
+ADDRLP4 76
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12628
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12628
+INDIRI4
+CNSTI4 0
+NEI4 $274
+ADDRLP4 88
+ARGP4
+CNSTU4 8192
+ARGU4
+ADDRLP4 8356
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddStringToList
+CALLV
+pop
+ADDRGP4 $275
+JUMPV
+LABELV $274
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $276
+ADDRLP4 4
+ARGP4
+ADDRLP4 12632
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8360
+ADDRLP4 12632
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8360
+INDIRI4
+ADDRLP4 76
+INDIRI4
+SUBI4
+ADDRLP4 8372
+INDIRI4
+LEI4 $277
+ADDRLP4 4
+ARGP4
+ADDRLP4 8440
+INDIRP4
+ARGP4
+ADDRLP4 12636
+ADDRGP4 COM_CompareExtension
+CALLI4
+ASGNI4
+ADDRLP4 12636
+INDIRI4
+CNSTI4 0
+EQI4 $277
+ADDRLP4 8360
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8372
+INDIRI4
+SUBI4
+ADDRLP4 4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $280
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12640
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+ARGP4
+CNSTU4 8192
+ARGU4
+ADDRLP4 8356
+ARGP4
+ADDRLP4 12640
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddStringToList
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRGP4 $280
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12632
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+ARGP4
+CNSTU4 8192
+ARGU4
+ADDRLP4 8356
+ARGP4
+ADDRLP4 12632
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddStringToList
+CALLV
+pop
+LABELV $277
+LABELV $275
+LABELV $267
+ADDRLP4 12612
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+ADDRLP4 12612
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 84
+INDIRI4
+ADDRLP4 12612
+INDIRI4
+ADDI4
+ADDRLP4 68
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $269
+ADDRLP4 80
+INDIRI4
+ADDRLP4 8284
+INDIRI4
+LTI4 $266
+LABELV $248
+ADDRLP4 12580
+CNSTI4 1
+ASGNI4
+ADDRLP4 8444
+ADDRLP4 8444
+INDIRI4
+ADDRLP4 12580
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8280
+ADDRLP4 8368
+INDIRI4
+ADDRLP4 12580
+INDIRI4
+ADDI4
+ADDRLP4 8280
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $250
+ADDRLP4 8444
+INDIRI4
+ADDRLP4 10496
+INDIRI4
+LTI4 $247
+LABELV $242
+ADDRLP4 12576
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12576
+INDIRI4
+EQI4 $281
+ADDRLP4 8364
+INDIRI4
+ADDRLP4 12576
+INDIRI4
+EQI4 $283
+ADDRLP4 8376
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $281
+LABELV $283
+ADDRGP4 $284
+ARGP4
+ADDRGP4 $225
+ARGP4
+ADDRLP4 10500
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 12580
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 10496
+ADDRLP4 12580
+INDIRI4
+ASGNI4
+ADDRLP4 8280
+ADDRLP4 10500
+ASGNP4
+ADDRLP4 8444
+CNSTI4 0
+ASGNI4
+ADDRGP4 $288
+JUMPV
+LABELV $285
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 12584
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8368
+ADDRLP4 12584
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8368
+INDIRI4
+CNSTI4 0
+NEI4 $289
+ADDRGP4 $286
+JUMPV
+LABELV $289
+ADDRLP4 8368
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8280
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $291
+ADDRLP4 8368
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8280
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $291
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRGP4 $257
+ARGP4
+ADDRLP4 12588
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12588
+INDIRI4
+CNSTI4 0
+EQI4 $295
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRGP4 $258
+ARGP4
+ADDRLP4 12592
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12592
+INDIRI4
+CNSTI4 0
+NEI4 $293
+LABELV $295
+ADDRGP4 $286
+JUMPV
+LABELV $293
+ADDRLP4 12600
+CNSTI4 1
+ASGNI4
+ADDRLP4 8364
+INDIRI4
+ADDRLP4 12600
+INDIRI4
+LEI4 $296
+ADDRLP4 8376+1
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 8364
+INDIRI4
+ADDRLP4 12600
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 12604
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 12604
+INDIRI4
+CNSTI4 0
+EQI4 $296
+ADDRGP4 $286
+JUMPV
+LABELV $296
+ADDRGP4 $299
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 12608
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12608
+INDIRP4
+ARGP4
+ADDRGP4 $265
+ARGP4
+ADDRLP4 8448
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 12612
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 8284
+ADDRLP4 12612
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 8448
+ASGNP4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRGP4 $303
+JUMPV
+LABELV $300
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 12616
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 84
+ADDRLP4 12616
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+LEI4 $304
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8288
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 12624
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 12624
+INDIRI4
+CNSTI4 0
+NEI4 $304
+ADDRLP4 0
+ADDRLP4 72
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $304
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8352
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 12628
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 12628
+INDIRI4
+CNSTI4 0
+EQI4 $306
+ADDRGP4 $301
+JUMPV
+LABELV $306
+ADDRLP4 76
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12632
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12632
+INDIRI4
+CNSTI4 0
+NEI4 $308
+ADDRGP4 $310
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 12636
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+ARGP4
+CNSTU4 8192
+ARGU4
+ADDRLP4 8356
+ARGP4
+ADDRLP4 12636
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddStringToList
+CALLV
+pop
+ADDRGP4 $309
+JUMPV
+LABELV $308
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $311
+ADDRLP4 4
+ARGP4
+ADDRLP4 12636
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8360
+ADDRLP4 12636
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8360
+INDIRI4
+ADDRLP4 76
+INDIRI4
+SUBI4
+ADDRLP4 8372
+INDIRI4
+LEI4 $312
+ADDRLP4 4
+ARGP4
+ADDRLP4 8440
+INDIRP4
+ARGP4
+ADDRLP4 12640
+ADDRGP4 COM_CompareExtension
+CALLI4
+ASGNI4
+ADDRLP4 12640
+INDIRI4
+CNSTI4 0
+EQI4 $312
+ADDRLP4 8360
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8372
+INDIRI4
+SUBI4
+ADDRLP4 4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $315
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12644
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+ARGP4
+CNSTU4 8192
+ARGU4
+ADDRLP4 8356
+ARGP4
+ADDRLP4 12644
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddStringToList
+CALLV
+pop
+ADDRGP4 $312
+JUMPV
+LABELV $311
+ADDRGP4 $315
+ARGP4
+ADDRLP4 8280
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12636
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 88
+ARGP4
+CNSTU4 8192
+ARGU4
+ADDRLP4 8356
+ARGP4
+ADDRLP4 12636
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddStringToList
+CALLV
+pop
+LABELV $312
+LABELV $309
+LABELV $301
+ADDRLP4 12616
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+ADDRLP4 12616
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 84
+INDIRI4
+ADDRLP4 12616
+INDIRI4
+ADDI4
+ADDRLP4 68
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $303
+ADDRLP4 80
+INDIRI4
+ADDRLP4 8284
+INDIRI4
+LTI4 $300
+LABELV $286
+ADDRLP4 12584
+CNSTI4 1
+ASGNI4
+ADDRLP4 8444
+ADDRLP4 8444
+INDIRI4
+ADDRLP4 12584
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8280
+ADDRLP4 8368
+INDIRI4
+ADDRLP4 12584
+INDIRI4
+ADDI4
+ADDRLP4 8280
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $288
+ADDRLP4 8444
+INDIRI4
+ADDRLP4 10496
+INDIRI4
+LTI4 $285
+LABELV $281
+ADDRLP4 8356
+INDIRI4
+CNSTI4 0
+LEI4 $316
+ADDRLP4 12580
+ADDRLP4 8356
+INDIRI4
+ASGNI4
+ADDRLP4 8356
+ADDRLP4 12580
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12580
+INDIRI4
+ADDRLP4 88
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 88
+ARGP4
+ADDRGP4 trap_Field_CompleteList
+CALLV
+pop
+LABELV $316
+LABELV $212
+endproc CG_Field_CompletePlayerModel 12648 16
+proc CG_ModelComplete 4 16
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $319
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $321
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Field_CompletePlayerModel
+CALLV
+pop
+LABELV $319
+LABELV $318
+endproc CG_ModelComplete 4 16
+proc CG_HeadmodelComplete 0 16
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $323
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 $321
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_Field_CompletePlayerModel
+CALLV
+pop
+LABELV $323
+LABELV $322
+endproc CG_HeadmodelComplete 0 16
+proc CG_TeamModelComplete 0 16
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $326
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 $328
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Field_CompletePlayerModel
+CALLV
+pop
+LABELV $326
+LABELV $325
+endproc CG_TeamModelComplete 0 16
+proc CG_TeamHeadmodelComplete 4 16
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $330
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Field_CompletePlayerModel
+CALLV
+pop
+LABELV $330
+LABELV $329
+endproc CG_TeamHeadmodelComplete 4 16
+proc CG_LoadHud_f 1028 12
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 UI_Load
+CALLV
+pop
+ADDRGP4 cgDC
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRGP4 Menu_Reset
+CALLV
+pop
+ADDRGP4 $333
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 1024
+ADDRLP4 0
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $334
+ADDRLP4 1024
+ADDRGP4 $336
+ASGNP4
+LABELV $334
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadMenus
+CALLV
+pop
+ADDRGP4 CG_HudMenuHacks
+CALLV
+pop
+ADDRGP4 menuScoreboard
+CNSTP4 0
+ASGNP4
+LABELV $332
+endproc CG_LoadHud_f 1028 12
+proc CG_ScrollScores 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+518844
+INDIRI4
+CNSTI4 0
+NEI4 $338
+CNSTI4 0
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $338
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+GEI4 $341
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $344
+ADDRFP4 0
+ADDRGP4 cg+518844
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $345
+JUMPV
+LABELV $344
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+518844
+INDIRI4
+LTI4 $347
+ADDRFP4 0
+CNSTI4 0
+ASGNI4
+LABELV $347
+LABELV $345
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $341
+ADDRLP4 4
+CNSTI4 56
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+52
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $352
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $352
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $357
+JUMPV
+LABELV $354
+CNSTI4 56
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+52
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $359
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $359
+LABELV $355
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $357
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+518844
+INDIRI4
+GEI4 $363
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $354
+LABELV $363
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+LTI4 $364
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $367
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $368
+JUMPV
+LABELV $367
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $368
+LABELV $364
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $369
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $375
+JUMPV
+LABELV $369
+ADDRLP4 0
+ADDRGP4 cg+518844
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $375
+JUMPV
+LABELV $372
+CNSTI4 56
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+52
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $377
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $377
+LABELV $373
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $375
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+518844
+INDIRI4
+GEI4 $381
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $372
+LABELV $381
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $337
+endproc CG_ScrollScores 16 0
+proc CG_ScrollScoresDown_f 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $383
+CNSTI4 500
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $383
+ADDRGP4 cg+518848
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_ScrollScores
+CALLI4
+ASGNI4
+ADDRGP4 cg+518848
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $383
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852+36012
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $389
+ADDRLP4 0
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+531852+36052
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_ScrollScores
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+531852+36052
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $389
+LABELV $382
+endproc CG_ScrollScoresDown_f 8 8
+proc CG_ScrollScoresUp_f 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $398
+CNSTI4 500
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $398
+ADDRGP4 cg+518848
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_ScrollScores
+CALLI4
+ASGNI4
+ADDRGP4 cg+518848
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $398
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852+36012
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $404
+ADDRLP4 0
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+531852+36052
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_ScrollScores
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+531852+36052
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $404
+LABELV $397
+endproc CG_ScrollScoresUp_f 8 8
+proc CG_CameraOrbit 4 0
+ADDRLP4 0
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35972
+ADDP4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35976
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35980
+ADDP4
+CNSTF4 1120403456
+ASGNF4
+LABELV $412
+endproc CG_CameraOrbit 4 0
+proc CG_spWin_f 0 12
+CNSTI4 0
+ARGI4
+CNSTF4 1106247680
+ARGF4
+ADDRGP4 CG_CameraOrbit
+CALLV
+pop
+ADDRGP4 cgs+683776+127172
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $417
+ARGP4
+CNSTI4 240
+ARGI4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 CG_GlobalCenterPrint
+CALLV
+pop
+LABELV $414
+endproc CG_spWin_f 0 12
+proc CG_spLose_f 0 12
+CNSTI4 0
+ARGI4
+CNSTF4 1106247680
+ARGF4
+ADDRGP4 CG_CameraOrbit
+CALLV
+pop
+ADDRGP4 cgs+683776+127176
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $421
+ARGP4
+CNSTI4 240
+ARGI4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 CG_GlobalCenterPrint
+CALLV
+pop
+LABELV $418
+endproc CG_spLose_f 0 12
+proc CG_TellTarget_f 328 24
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $423
+ADDRGP4 $422
+JUMPV
+LABELV $423
+ADDRLP4 170
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $426
+ARGP4
+ADDRLP4 324
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 166
+ARGI4
+ADDRGP4 $425
+ARGP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 170
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $422
+endproc CG_TellTarget_f 328 24
+proc CG_TellAttacker_f 328 24
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $428
+ADDRGP4 $427
+JUMPV
+LABELV $428
+ADDRLP4 170
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $426
+ARGP4
+ADDRLP4 324
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 166
+ARGI4
+ADDRGP4 $425
+ARGP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 170
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $427
+endproc CG_TellAttacker_f 328 24
+proc CG_VoiceTellTarget_f 328 24
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $431
+ADDRGP4 $430
+JUMPV
+LABELV $431
+ADDRLP4 170
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $433
+ARGP4
+ADDRLP4 324
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 166
+ARGI4
+ADDRGP4 $425
+ARGP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 170
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $430
+endproc CG_VoiceTellTarget_f 328 24
+proc CG_VoiceTellAttacker_f 328 24
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $435
+ADDRGP4 $434
+JUMPV
+LABELV $435
+ADDRLP4 170
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 trap_Args
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $433
+ARGP4
+ADDRLP4 324
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 166
+ARGI4
+ADDRGP4 $425
+ARGP4
+ADDRLP4 324
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 170
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $434
+endproc CG_VoiceTellAttacker_f 328 24
+proc CG_NextTeamMember_f 0 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_SelectNextPlayer
+CALLV
+pop
+LABELV $437
+endproc CG_NextTeamMember_f 0 4
+proc CG_PrevTeamMember_f 0 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_SelectPrevPlayer
+CALLV
+pop
+LABELV $438
+endproc CG_PrevTeamMember_f 0 4
+proc CG_NextOrder_f 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -1
+NEI4 $441
+ADDRGP4 $439
+JUMPV
+LABELV $441
+ADDRLP4 16
+CNSTI4 500
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 254120
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+48
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+48
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 2108
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $446
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $448
+CNSTI4 272
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $448
+ADDRGP4 $439
+JUMPV
+LABELV $448
+LABELV $446
+ADDRLP4 0
+INDIRP4
+CNSTI4 35656
+ADDP4
+INDIRI4
+CNSTI4 7
+GEI4 $451
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 35656
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35656
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $453
+ADDRLP4 28
+ADDRGP4 CG_OtherTeamHasFlag
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $455
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 35656
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $455
+LABELV $453
+ADDRLP4 0
+INDIRP4
+CNSTI4 35656
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $452
+ADDRLP4 28
+ADDRGP4 CG_YourTeamHasFlag
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $452
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 35656
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $452
+JUMPV
+LABELV $451
+ADDRLP4 0
+INDIRP4
+CNSTI4 35656
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $452
+ADDRLP4 0
+INDIRP4
+CNSTI4 35660
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35664
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 3000
+ADDI4
+ASGNI4
+LABELV $439
+endproc CG_NextOrder_f 36 0
+proc CG_ConfirmOrder_f 16 16
+ADDRLP4 0
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -1
+NEI4 $464
+ADDRGP4 $462
+JUMPV
+LABELV $464
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $433
+ARGP4
+ADDRLP4 4
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $466
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35676
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $467
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 $468
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 cg+512320
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35668
+ADDP4
+INDIRI4
+GEI4 $469
+ADDRGP4 $472
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35672
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 35668
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $469
+LABELV $462
+endproc CG_ConfirmOrder_f 16 16
+proc CG_DenyOrder_f 24 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -1
+NEI4 $475
+ADDRGP4 $473
+JUMPV
+LABELV $475
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $433
+ARGP4
+ADDRLP4 4
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $466
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35676
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $477
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $479
+ARGP4
+ADDRLP4 12
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $480
+ARGP4
+ADDRLP4 16
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $478
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 cg+512320
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35668
+ADDP4
+INDIRI4
+GEI4 $481
+ADDRLP4 0
+INDIRP4
+CNSTI4 35668
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $481
+LABELV $473
+endproc CG_DenyOrder_f 24 16
+proc CG_TaskOffense_f 8 12
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+EQI4 $489
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 5
+NEI4 $485
+LABELV $489
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $491
+ARGP4
+ADDRLP4 0
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $492
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $486
+JUMPV
+LABELV $485
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $491
+ARGP4
+ADDRLP4 0
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $493
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $486
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $495
+ARGP4
+ADDRLP4 0
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $494
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $484
+endproc CG_TaskOffense_f 8 12
+proc CG_TaskDefense_f 12 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $491
+ARGP4
+ADDRLP4 0
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $497
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $472
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $496
+endproc CG_TaskDefense_f 12 12
+proc CG_TaskPatrol_f 16 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $491
+ARGP4
+ADDRLP4 0
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $499
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $495
+ARGP4
+ADDRLP4 8
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $494
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $498
+endproc CG_TaskPatrol_f 16 12
+proc CG_TaskCamp_f 16 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $491
+ARGP4
+ADDRLP4 0
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $501
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $495
+ARGP4
+ADDRLP4 8
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $494
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 7
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $500
+endproc CG_TaskCamp_f 16 12
+proc CG_TaskFollow_f 16 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $491
+ARGP4
+ADDRLP4 0
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $503
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $495
+ARGP4
+ADDRLP4 8
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $494
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $502
+endproc CG_TaskFollow_f 16 12
+proc CG_TaskRetrieve_f 16 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $491
+ARGP4
+ADDRLP4 0
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $505
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $495
+ARGP4
+ADDRLP4 8
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $494
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $504
+endproc CG_TaskRetrieve_f 16 12
+proc CG_TaskEscort_f 16 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $491
+ARGP4
+ADDRLP4 0
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $507
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $495
+ARGP4
+ADDRLP4 8
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $494
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $506
+endproc CG_TaskEscort_f 16 12
+proc CG_TaskOwnFlag_f 8 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $491
+ARGP4
+ADDRLP4 0
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $509
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $508
+endproc CG_TaskOwnFlag_f 8 12
+proc CG_TauntKillInsult_f 8 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $511
+ARGP4
+ADDRLP4 0
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $512
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $510
+endproc CG_TauntKillInsult_f 8 12
+proc CG_TauntPraise_f 8 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $511
+ARGP4
+ADDRLP4 0
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $514
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $513
+endproc CG_TauntPraise_f 8 12
+proc CG_TauntTaunt_f 8 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $517
+ARGP4
+ADDRLP4 0
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $516
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $515
+endproc CG_TauntTaunt_f 8 8
+proc CG_TauntDeathInsult_f 8 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $511
+ARGP4
+ADDRLP4 0
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $519
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $518
+endproc CG_TauntDeathInsult_f 8 12
+proc CG_TauntGauntlet_f 8 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $511
+ARGP4
+ADDRLP4 0
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $521
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $520
+endproc CG_TauntGauntlet_f 8 12
+proc CG_TaskSuicide_f 140 20
+CNSTI4 0
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $523
+ADDRGP4 $522
+JUMPV
+LABELV $523
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $426
+ARGP4
+ADDRLP4 136
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $525
+ARGP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $522
+endproc CG_TaskSuicide_f 140 20
+proc CG_VstrDown_f 16 8
+ADDRLP4 4
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+GEI4 $527
+ADDRGP4 $529
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $527
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $530
+ADDRGP4 $532
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $530
+LABELV $526
+endproc CG_VstrDown_f 16 8
+proc CG_VstrUp_f 16 8
+ADDRLP4 4
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+GEI4 $534
+ADDRGP4 $536
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $533
+JUMPV
+LABELV $534
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $537
+ADDRGP4 $532
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $537
+LABELV $533
+endproc CG_VstrUp_f 16 8
+proc CG_VstrComplete 12 12
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $542
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $540
+LABELV $542
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 $543
+ARGP4
+ADDRLP4 8
+ADDRGP4 Com_SkipTokens
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+LEU4 $544
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Field_CompleteCommand
+CALLV
+pop
+LABELV $544
+LABELV $540
+LABELV $539
+endproc CG_VstrComplete 12 12
+proc CG_StartOrbit_f 4 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $547
+CNSTI4 39084
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852+35972
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $551
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 CG_CameraOrbit
+CALLV
+pop
+ADDRGP4 $552
+JUMPV
+LABELV $551
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTF4 1106247680
+ARGF4
+ADDRGP4 CG_CameraOrbit
+CALLV
+pop
+LABELV $552
+LABELV $548
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $547
+LABELV $546
+endproc CG_StartOrbit_f 4 8
+export CG_GenerateTracemap
+proc CG_GenerateTracemap 8 16
+ADDRGP4 cg+515560
+INDIRI4
+CNSTI4 0
+NEI4 $556
+ADDRGP4 $559
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $555
+JUMPV
+LABELV $556
+ADDRLP4 0
+ADDRGP4 CG_Trace
+ASGNP4
+ADDRLP4 0+4
+ADDRGP4 CG_PointContents
+ASGNP4
+ADDRGP4 cgs+56120
+ARGP4
+ADDRGP4 cg+515544
+ARGP4
+ADDRGP4 cg+515552
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BG_GenerateTracemap
+CALLV
+pop
+LABELV $555
+endproc CG_GenerateTracemap 8 16
+proc CG_RemapShader_f 220 12
+ADDRGP4 cg+4
+INDIRI4
+CNSTI4 0
+EQI4 $565
+ADDRGP4 $568
+ARGP4
+ADDRLP4 192
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $565
+CNSTI4 0
+ARGI4
+ADDRLP4 196
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $569
+ARGP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $564
+JUMPV
+LABELV $565
+ADDRLP4 196
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 2
+LTI4 $572
+ADDRLP4 200
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 4
+LEI4 $570
+LABELV $572
+CNSTI4 0
+ARGI4
+ADDRLP4 204
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $573
+ARGP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $564
+JUMPV
+LABELV $570
+CNSTI4 1
+ARGI4
+ADDRLP4 204
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 208
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 208
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 212
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 212
+INDIRU4
+CNSTU4 0
+NEU4 $574
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $574
+CNSTI4 3
+ARGI4
+ADDRLP4 216
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 128
+ARGP4
+ADDRLP4 216
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRGP4 trap_R_RemapShader
+CALLV
+pop
+LABELV $564
+endproc CG_RemapShader_f 220 12
+export CG_Play_f
+proc CG_Play_f 24 8
+ADDRLP4 12
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+GEI4 $577
+ADDRGP4 $579
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $576
+JUMPV
+LABELV $577
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $583
+JUMPV
+LABELV $580
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $584
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $584
+LABELV $581
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $583
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $580
+LABELV $576
+endproc CG_Play_f 24 8
+proc CG_PlayComplete 4 16
+ADDRGP4 $587
+ARGP4
+ADDRGP4 $588
+ARGP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_Field_CompleteFilename
+CALLV
+pop
+LABELV $586
+endproc CG_PlayComplete 4 16
+export CG_Music_f
+proc CG_Music_f 160 16
+ADDRLP4 140
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $592
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LEI4 $590
+LABELV $592
+ADDRGP4 $593
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $589
+JUMPV
+LABELV $590
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 68
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 148
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 132
+ADDRLP4 148
+INDIRF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 148
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LEI4 $594
+CNSTI4 3
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 156
+INDIRF4
+ASGNF4
+LABELV $594
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LEI4 $596
+CNSTI4 4
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 156
+INDIRF4
+ASGNF4
+LABELV $596
+ADDRLP4 4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRGP4 trap_S_StartBackgroundTrack
+CALLV
+pop
+LABELV $589
+endproc CG_Music_f 160 16
+proc CG_MusicComplete 8 16
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $601
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $599
+LABELV $601
+ADDRGP4 $587
+ARGP4
+ADDRGP4 $588
+ARGP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Field_CompleteFilename
+CALLV
+pop
+LABELV $599
+LABELV $598
+endproc CG_MusicComplete 8 16
+export CG_StopMusic_f
+proc CG_StopMusic_f 0 0
+ADDRGP4 trap_S_StopBackgroundTrack
+CALLV
+pop
+LABELV $602
+endproc CG_StopMusic_f 0 0
+export CG_StopCinematic_f
+proc CG_StopCinematic_f 0 4
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+NEI4 $604
+ADDRGP4 $603
+JUMPV
+LABELV $604
+ADDRGP4 trap_S_StopAllSounds
+CALLV
+pop
+ADDRGP4 cg+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+ADDRGP4 cg+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+12
+CNSTI4 0
+ASGNI4
+LABELV $603
+endproc CG_StopCinematic_f 0 4
+export CG_Cinematic_f
+proc CG_Cinematic_f 132 24
+ADDRLP4 88
+CNSTI4 1
+ASGNI4
+ADDRLP4 96
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 2
+LTI4 $613
+ADDRLP4 92
+INDIRI4
+CNSTI4 3
+LEI4 $611
+LABELV $613
+ADDRGP4 $614
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $610
+JUMPV
+LABELV $611
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $615
+ADDRGP4 CG_StopCinematic_f
+CALLV
+pop
+LABELV $615
+CNSTI4 1
+ARGI4
+ADDRLP4 6
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 49
+EQI4 $625
+ADDRLP4 0
+ARGP4
+ADDRGP4 $620
+ARGP4
+ADDRLP4 104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+EQI4 $625
+ADDRLP4 6
+ARGP4
+ADDRGP4 $621
+ARGP4
+ADDRLP4 108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+EQI4 $625
+ADDRLP4 6
+ARGP4
+ADDRGP4 $622
+ARGP4
+ADDRLP4 112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+NEI4 $618
+LABELV $625
+ADDRLP4 88
+ADDRLP4 88
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $618
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 50
+EQI4 $629
+ADDRLP4 0
+ARGP4
+ADDRGP4 $628
+ARGP4
+ADDRLP4 116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+NEI4 $626
+LABELV $629
+ADDRLP4 88
+ADDRLP4 88
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $626
+ADDRGP4 trap_S_StopAllSounds
+CALLV
+pop
+ADDRLP4 120
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+ADDRLP4 120
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 120
+INDIRF4
+ASGNF4
+ADDRLP4 80
+CNSTF4 1142947840
+ASGNF4
+ADDRLP4 84
+CNSTF4 1139802112
+ASGNF4
+ADDRLP4 124
+CNSTI4 1
+ASGNI4
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 72
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 6
+ARGP4
+ADDRLP4 72
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 80
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 84
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRGP4 cg+16
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRGP4 cg+16
+INDIRI4
+CNSTI4 0
+LTI4 $631
+ADDRGP4 cg+12
+CNSTI4 1
+ASGNI4
+LABELV $631
+LABELV $610
+endproc CG_Cinematic_f 132 24
+proc CG_CinematicComplete 4 16
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $636
+ADDRGP4 $587
+ARGP4
+ADDRGP4 $638
+ARGP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_Field_CompleteFilename
+CALLV
+pop
+LABELV $636
+LABELV $635
+endproc CG_CinematicComplete 4 16
+export CG_ToggleMenu_f
+proc CG_ToggleMenu_f 12 24
+ADDRLP4 0
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+CNSTI4 27
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 cg
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+CNSTI4 27
+ARGI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 cg
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+LABELV $639
+endproc CG_ToggleMenu_f 12 24
+proc CG_ForwardToServer_f 8196 8
+ADDRGP4 cg+4
+INDIRI4
+CNSTI4 0
+EQI4 $641
+ADDRLP4 8192
+ADDRGP4 trap_GetDemoState
+CALLI4
+ASGNI4
+ADDRLP4 8192
+INDIRI4
+CNSTI4 1
+EQI4 $641
+ADDRLP4 0
+ARGP4
+CNSTI4 8192
+ARGI4
+ADDRGP4 trap_LiteralArgs
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $641
+LABELV $640
+endproc CG_ForwardToServer_f 8196 8
+proc CG_Field_CompletePlayerName 4192 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $645
+ADDRGP4 $644
+JUMPV
+LABELV $645
+ADDRLP4 72
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 4096
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4172
+CNSTI4 0
+ASGNI4
+ADDRLP4 4168
+ADDRLP4 4172
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 4172
+INDIRI4
+ASGNI4
+ADDRGP4 $651
+JUMPV
+LABELV $648
+ADDRLP4 0
+CNSTI4 2108
+ADDRLP4 68
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $654
+ADDRGP4 $649
+JUMPV
+LABELV $654
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1
+EQI4 $656
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $659
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $658
+LABELV $659
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $656
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $656
+LABELV $658
+ADDRGP4 $649
+JUMPV
+LABELV $656
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $660
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 4180
+ADDRGP4 CG_LocalPlayerState
+CALLP4
+ASGNP4
+ADDRLP4 4180
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $660
+ADDRGP4 $649
+JUMPV
+LABELV $660
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 4184
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4184
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $662
+ADDRGP4 $664
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 4188
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 72
+ARGP4
+CNSTU4 4096
+ARGU4
+ADDRLP4 4168
+ARGP4
+ADDRLP4 4188
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddStringToList
+CALLV
+pop
+ADDRGP4 $663
+JUMPV
+LABELV $662
+ADDRLP4 72
+ARGP4
+CNSTU4 4096
+ARGU4
+ADDRLP4 4168
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_AddStringToList
+CALLV
+pop
+LABELV $663
+LABELV $649
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $651
+ADDRLP4 68
+INDIRI4
+ADDRGP4 cgs+56116
+INDIRI4
+LTI4 $648
+ADDRLP4 4168
+INDIRI4
+CNSTI4 0
+LEI4 $665
+ADDRLP4 4176
+ADDRLP4 4168
+INDIRI4
+ASGNI4
+ADDRLP4 4168
+ADDRLP4 4176
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 72
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 72
+ARGP4
+ADDRGP4 trap_Field_CompleteList
+CALLV
+pop
+LABELV $665
+LABELV $644
+endproc CG_Field_CompletePlayerName 4192 16
+proc CG_TellComplete 4 12
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $668
+CNSTI4 -1
+ARGI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Field_CompletePlayerName
+CALLV
+pop
+LABELV $668
+LABELV $667
+endproc CG_TellComplete 4 12
+proc CG_Field_CompleteVoiceChat 0 4
+ADDRGP4 $671
+ARGP4
+ADDRGP4 trap_Field_CompleteList
+CALLV
+pop
+LABELV $670
+endproc CG_Field_CompleteVoiceChat 0 4
+proc CG_VoiceSayComplete 0 0
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $673
+ADDRGP4 CG_Field_CompleteVoiceChat
+CALLV
+pop
+LABELV $673
+LABELV $672
+endproc CG_VoiceSayComplete 0 0
+proc CG_VoiceTellComplete 4 12
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $676
+CNSTI4 -1
+ARGI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Field_CompletePlayerName
+CALLV
+pop
+LABELV $676
+ADDRFP4 8
+INDIRI4
+CNSTI4 3
+NEI4 $678
+ADDRGP4 CG_Field_CompleteVoiceChat
+CALLV
+pop
+LABELV $678
+LABELV $675
+endproc CG_VoiceTellComplete 4 12
+lit
+align 1
+LABELV $681
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 0
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+byte 1 0
+code
+proc CG_GiveComplete 2172 16
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 2076
+ADDRGP4 $681
+INDIRB
+ASGNB 80
+ADDRLP4 20
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2048
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 2072
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $682
+ADDRLP4 20
+ARGP4
+ADDRLP4 2076
+ARGP4
+CNSTU4 79
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 2072
+CNSTI4 79
+ASGNI4
+LABELV $682
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 2156
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 2156
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $684
+ADDRLP4 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 2160
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 2068
+ADDRLP4 2160
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $685
+JUMPV
+LABELV $684
+ADDRLP4 2068
+CNSTI4 0
+ASGNI4
+LABELV $685
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $689
+JUMPV
+LABELV $686
+ADDRLP4 16
+CNSTI4 48
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $690
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2068
+INDIRI4
+ARGI4
+ADDRLP4 2164
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 2164
+INDIRI4
+CNSTI4 0
+EQI4 $690
+ADDRGP4 $687
+JUMPV
+LABELV $690
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $695
+JUMPV
+LABELV $692
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 2168
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2168
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $696
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $696
+LABELV $693
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $695
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+SUBI4
+GEI4 $698
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $692
+LABELV $698
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $699
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $699
+ADDRLP4 20
+ARGP4
+CNSTU4 2048
+ARGU4
+ADDRLP4 2072
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddStringToList
+CALLV
+pop
+LABELV $699
+LABELV $687
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $689
+ADDRLP4 8
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $686
+ADDRLP4 2072
+INDIRI4
+CNSTI4 0
+LEI4 $701
+ADDRLP4 2160
+ADDRLP4 2072
+INDIRI4
+ASGNI4
+ADDRLP4 2072
+ADDRLP4 2160
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 2160
+INDIRI4
+ADDRLP4 20
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 20
+ARGP4
+ADDRGP4 trap_Field_CompleteList
+CALLV
+pop
+LABELV $701
+LABELV $680
+endproc CG_GiveComplete 2172 16
+proc CG_FollowComplete 4 12
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $704
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Field_CompletePlayerName
+CALLV
+pop
+LABELV $704
+LABELV $703
+endproc CG_FollowComplete 4 12
+proc CG_TeamComplete 0 4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $707
+ADDRGP4 $709
+ARGP4
+ADDRGP4 trap_Field_CompleteList
+CALLV
+pop
+LABELV $707
+LABELV $706
+endproc CG_TeamComplete 0 4
+proc CG_CallVoteComplete 16 16
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $711
+ADDRGP4 $713
+ARGP4
+ADDRGP4 trap_Field_CompleteList
+CALLV
+pop
+LABELV $711
+ADDRFP4 8
+INDIRI4
+CNSTI4 3
+NEI4 $714
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $716
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $714
+CNSTI4 -1
+ARGI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Field_CompletePlayerName
+CALLV
+pop
+LABELV $714
+ADDRFP4 8
+INDIRI4
+CNSTI4 3
+NEI4 $717
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $719
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $717
+ADDRGP4 $720
+ARGP4
+ADDRGP4 $721
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Field_CompleteFilename
+CALLV
+pop
+LABELV $717
+LABELV $710
+endproc CG_CallVoteComplete 16 16
+proc CG_VoteComplete 0 4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $723
+ADDRGP4 $725
+ARGP4
+ADDRGP4 trap_Field_CompleteList
+CALLV
+pop
+LABELV $723
+LABELV $722
+endproc CG_VoteComplete 0 4
+proc CG_CallTeamVoteComplete 28 12
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $727
+ADDRGP4 $726
+JUMPV
+LABELV $727
+ADDRLP4 4
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $731
+ADDRGP4 $726
+JUMPV
+LABELV $731
+ADDRLP4 8
+CNSTI4 2108
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $734
+ADDRGP4 $726
+JUMPV
+LABELV $734
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $736
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $736
+ADDRGP4 $726
+JUMPV
+LABELV $736
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $738
+ADDRGP4 $740
+ARGP4
+ADDRGP4 trap_Field_CompleteList
+CALLV
+pop
+LABELV $738
+ADDRFP4 8
+INDIRI4
+CNSTI4 3
+NEI4 $741
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $743
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $741
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 CG_Field_CompletePlayerName
+CALLV
+pop
+LABELV $741
+LABELV $726
+endproc CG_CallTeamVoteComplete 28 12
+data
+align 4
+LABELV cg_commands
+address $744
+address CG_VstrDown_f
+byte 4 0
+address CG_VstrComplete
+address $745
+address CG_VstrUp_f
+byte 4 0
+address CG_VstrComplete
+address $746
+address CG_TestGun_f
+byte 4 1
+address CG_TestModelComplete
+address $747
+address CG_TestModel_f
+byte 4 1
+address CG_TestModelComplete
+address $748
+address CG_TestModelNextFrame_f
+byte 4 1
+skip 4
+address $749
+address CG_TestModelPrevFrame_f
+byte 4 1
+skip 4
+address $750
+address CG_TestModelNextSkin_f
+byte 4 1
+skip 4
+address $751
+address CG_TestModelPrevSkin_f
+byte 4 1
+skip 4
+address $752
+address CG_SizeUp_f
+byte 4 0
+skip 4
+address $753
+address CG_SizeDown_f
+byte 4 0
+skip 4
+address $754
+address CG_spWin_f
+byte 4 1
+skip 4
+address $755
+address CG_spLose_f
+byte 4 1
+skip 4
+address $756
+address CG_LoadHud_f
+byte 4 1
+skip 4
+address $757
+address CG_StartOrbit_f
+byte 4 1
+skip 4
+address $758
+address CG_LoadDeferredPlayers
+byte 4 1
+skip 4
+address $759
+address CG_GenerateTracemap
+byte 4 1
+skip 4
+address $760
+address CG_RemapShader_f
+byte 4 0
+skip 4
+address $761
+address CG_Play_f
+byte 4 0
+address CG_PlayComplete
+address $762
+address CG_Music_f
+byte 4 0
+address CG_MusicComplete
+address $763
+address CG_StopMusic_f
+byte 4 0
+skip 4
+address $764
+address CG_Cinematic_f
+byte 4 0
+address CG_CinematicComplete
+address $765
+address CG_StopCinematic_f
+byte 4 0
+skip 4
+address $766
+address CG_MessageMode_f
+skip 8
+address $767
+address CG_MessageMode2_f
+skip 8
+address $768
+address CG_MessageMode3_f
+skip 8
+address $769
+address CG_MessageMode4_f
+skip 8
+address $770
+address Con_ClearConsole_f
+skip 8
+address $771
+address Con_ToggleConsole_f
+skip 8
+address $772
+address CG_ToggleMenu_f
+skip 8
+align 4
+LABELV cg_numCommands
+byte 4 29
+align 4
+LABELV playerCommands
+address $774
+address IN_Button0Down
+byte 4 0
+skip 4
+address $775
+address IN_Button0Up
+byte 4 0
+skip 4
+address $776
+address IN_BackDown
+byte 4 0
+skip 4
+address $777
+address IN_BackUp
+byte 4 0
+skip 4
+address $778
+address IN_Button0Down
+byte 4 0
+skip 4
+address $779
+address IN_Button0Up
+byte 4 0
+skip 4
+address $780
+address IN_Button10Down
+byte 4 0
+skip 4
+address $781
+address IN_Button10Up
+byte 4 0
+skip 4
+address $782
+address IN_Button11Down
+byte 4 0
+skip 4
+address $783
+address IN_Button11Up
+byte 4 0
+skip 4
+address $784
+address IN_Button12Down
+byte 4 0
+skip 4
+address $785
+address IN_Button12Up
+byte 4 0
+skip 4
+address $786
+address IN_Button13Down
+byte 4 0
+skip 4
+address $787
+address IN_Button13Up
+byte 4 0
+skip 4
+address $788
+address IN_Button14Down
+byte 4 0
+skip 4
+address $789
+address IN_Button14Up
+byte 4 0
+skip 4
+address $790
+address IN_Button1Down
+byte 4 0
+skip 4
+address $791
+address IN_Button1Up
+byte 4 0
+skip 4
+address $792
+address IN_Button2Down
+byte 4 0
+skip 4
+address $793
+address IN_Button2Up
+byte 4 0
+skip 4
+address $794
+address IN_Button3Down
+byte 4 0
+skip 4
+address $795
+address IN_Button3Up
+byte 4 0
+skip 4
+address $796
+address IN_Button4Down
+byte 4 0
+skip 4
+address $797
+address IN_Button4Up
+byte 4 0
+skip 4
+address $798
+address IN_Button5Down
+byte 4 0
+skip 4
+address $799
+address IN_Button5Up
+byte 4 0
+skip 4
+address $479
+address IN_Button6Down
+byte 4 0
+skip 4
+address $480
+address IN_Button6Up
+byte 4 0
+skip 4
+address $800
+address IN_Button7Down
+byte 4 0
+skip 4
+address $801
+address IN_Button7Up
+byte 4 0
+skip 4
+address $802
+address IN_Button8Down
+byte 4 0
+skip 4
+address $803
+address IN_Button8Up
+byte 4 0
+skip 4
+address $804
+address IN_Button9Down
+byte 4 0
+skip 4
+address $805
+address IN_Button9Up
+byte 4 0
+skip 4
+address $806
+address IN_ForwardDown
+byte 4 0
+skip 4
+address $807
+address IN_ForwardUp
+byte 4 0
+skip 4
+address $808
+address IN_Button3Down
+byte 4 0
+skip 4
+address $809
+address IN_Button3Up
+byte 4 0
+skip 4
+address $810
+address IN_LeftDown
+byte 4 0
+skip 4
+address $811
+address IN_LeftUp
+byte 4 0
+skip 4
+address $812
+address IN_LookdownDown
+byte 4 0
+skip 4
+address $813
+address IN_LookdownUp
+byte 4 0
+skip 4
+address $814
+address IN_LookupDown
+byte 4 0
+skip 4
+address $815
+address IN_LookupUp
+byte 4 0
+skip 4
+address $816
+address IN_MLookDown
+byte 4 0
+skip 4
+address $817
+address IN_MLookUp
+byte 4 0
+skip 4
+address $818
+address IN_DownDown
+byte 4 0
+skip 4
+address $819
+address IN_DownUp
+byte 4 0
+skip 4
+address $820
+address IN_MoveleftDown
+byte 4 0
+skip 4
+address $821
+address IN_MoveleftUp
+byte 4 0
+skip 4
+address $822
+address IN_MoverightDown
+byte 4 0
+skip 4
+address $823
+address IN_MoverightUp
+byte 4 0
+skip 4
+address $824
+address IN_UpDown
+byte 4 0
+skip 4
+address $825
+address IN_UpUp
+byte 4 0
+skip 4
+address $826
+address IN_RightDown
+byte 4 0
+skip 4
+address $827
+address IN_RightUp
+byte 4 0
+skip 4
+address $828
+address CG_ScoresDown_f
+byte 4 1
+skip 4
+address $829
+address CG_ScoresUp_f
+byte 4 1
+skip 4
+address $830
+address IN_SpeedDown
+byte 4 0
+skip 4
+address $831
+address IN_SpeedUp
+byte 4 0
+skip 4
+address $832
+address IN_StrafeDown
+byte 4 0
+skip 4
+address $833
+address IN_StrafeUp
+byte 4 0
+skip 4
+address $834
+address IN_Button2Down
+byte 4 0
+skip 4
+address $835
+address IN_Button2Up
+byte 4 0
+skip 4
+address $836
+address CG_ZoomDown_f
+byte 4 1
+skip 4
+address $837
+address CG_ZoomUp_f
+byte 4 1
+skip 4
+address $838
+address CG_CenterEcho_f
+byte 4 1
+skip 4
+address $839
+address IN_CenterView
+byte 4 0
+skip 4
+address $199
+address CG_SetHeadmodel_f
+byte 4 0
+address CG_HeadmodelComplete
+address $840
+address CG_TargetCommand_f
+byte 4 1
+skip 4
+address $205
+address CG_SetTeamModel_f
+byte 4 0
+address CG_TeamModelComplete
+address $208
+address CG_SetTeamHeadmodel_f
+byte 4 0
+address CG_TeamHeadmodelComplete
+address $841
+address CG_TellTarget_f
+byte 4 1
+skip 4
+address $842
+address CG_TellAttacker_f
+byte 4 1
+skip 4
+address $843
+address CG_VoiceTellTarget_f
+byte 4 1
+address CG_VoiceSayComplete
+address $844
+address CG_VoiceTellAttacker_f
+byte 4 1
+address CG_VoiceSayComplete
+address $845
+address CG_NextTeamMember_f
+byte 4 1
+skip 4
+address $846
+address CG_PrevTeamMember_f
+byte 4 1
+skip 4
+address $847
+address CG_NextOrder_f
+byte 4 1
+skip 4
+address $848
+address CG_ConfirmOrder_f
+byte 4 1
+skip 4
+address $849
+address CG_DenyOrder_f
+byte 4 1
+skip 4
+address $850
+address CG_TaskOffense_f
+byte 4 1
+skip 4
+address $851
+address CG_TaskDefense_f
+byte 4 1
+skip 4
+address $852
+address CG_TaskPatrol_f
+byte 4 1
+skip 4
+address $853
+address CG_TaskCamp_f
+byte 4 1
+skip 4
+address $854
+address CG_TaskFollow_f
+byte 4 1
+skip 4
+address $855
+address CG_TaskRetrieve_f
+byte 4 1
+skip 4
+address $856
+address CG_TaskEscort_f
+byte 4 1
+skip 4
+address $857
+address CG_TaskSuicide_f
+byte 4 1
+skip 4
+address $858
+address CG_TaskOwnFlag_f
+byte 4 1
+skip 4
+address $859
+address CG_TauntKillInsult_f
+byte 4 1
+skip 4
+address $860
+address CG_TauntPraise_f
+byte 4 1
+skip 4
+address $861
+address CG_TauntTaunt_f
+byte 4 1
+skip 4
+address $862
+address CG_TauntDeathInsult_f
+byte 4 1
+skip 4
+address $863
+address CG_TauntGauntlet_f
+byte 4 1
+skip 4
+address $864
+address CG_ScrollScoresDown_f
+byte 4 1
+skip 4
+address $865
+address CG_ScrollScoresUp_f
+byte 4 1
+skip 4
+address $196
+address CG_SetModel_f
+byte 4 0
+address CG_ModelComplete
+address $866
+address CG_Viewpos_f
+byte 4 1
+skip 4
+address $867
+address CG_NextWeapon_f
+byte 4 1
+skip 4
+address $868
+address CG_PrevWeapon_f
+byte 4 1
+skip 4
+address $869
+address CG_Weapon_f
+byte 4 1
+skip 4
+address $870
+address CG_WeaponToggle_f
+byte 4 1
+skip 4
+address $117
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $127
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $426
+address CG_ForwardToServer_f
+byte 4 1
+address CG_TellComplete
+address $511
+address CG_ForwardToServer_f
+byte 4 1
+address CG_VoiceSayComplete
+address $491
+address CG_ForwardToServer_f
+byte 4 1
+address CG_VoiceSayComplete
+address $433
+address CG_ForwardToServer_f
+byte 4 1
+address CG_VoiceTellComplete
+address $871
+address CG_ForwardToServer_f
+byte 4 1
+address CG_VoiceSayComplete
+address $872
+address CG_ForwardToServer_f
+byte 4 1
+address CG_VoiceSayComplete
+address $873
+address CG_ForwardToServer_f
+byte 4 1
+address CG_VoiceTellComplete
+address $517
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $874
+address CG_ForwardToServer_f
+byte 4 1
+address CG_GiveComplete
+address $875
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $876
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $877
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $878
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $879
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $495
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $880
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $881
+address CG_ForwardToServer_f
+byte 4 1
+address CG_FollowComplete
+address $882
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $883
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $884
+address CG_ForwardToServer_f
+byte 4 1
+address CG_TeamComplete
+address $885
+address CG_ForwardToServer_f
+byte 4 1
+address CG_CallVoteComplete
+address $886
+address CG_ForwardToServer_f
+byte 4 1
+address CG_VoteComplete
+address $887
+address CG_ForwardToServer_f
+byte 4 1
+address CG_CallTeamVoteComplete
+address $888
+address CG_ForwardToServer_f
+byte 4 1
+address CG_VoteComplete
+address $889
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+address $890
+address CG_ForwardToServer_f
+byte 4 1
+skip 4
+align 4
+LABELV numPlayerCommands
+byte 4 131
+code
+proc CG_CheckCmdFlags 4 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $892
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $892
+ADDRGP4 $895
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $891
+JUMPV
+LABELV $892
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 0
+INDIRI4
+EQI4 $896
+ADDRGP4 cg+4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $896
+ADDRGP4 $899
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $891
+JUMPV
+LABELV $896
+CNSTI4 0
+RETI4
+LABELV $891
+endproc CG_CheckCmdFlags 4 8
+export CG_ConsoleCommand
+proc CG_ConsoleCommand 36 8
+ADDRGP4 cg
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ConsoleCommand
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Com_LocalPlayerForCvarName
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Com_LocalPlayerBaseCvarName
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $904
+JUMPV
+LABELV $901
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 playerCommands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $905
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 playerCommands+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_CheckCmdFlags
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $907
+CNSTI4 1
+RETI4
+ADDRGP4 $900
+JUMPV
+LABELV $907
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 playerCommands+4
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $900
+JUMPV
+LABELV $905
+LABELV $902
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $904
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numPlayerCommands
+INDIRI4
+LTI4 $901
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $911
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $916
+JUMPV
+LABELV $913
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 cg_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $917
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 cg_commands+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_CheckCmdFlags
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $919
+CNSTI4 1
+RETI4
+ADDRGP4 $900
+JUMPV
+LABELV $919
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 cg_commands+4
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $900
+JUMPV
+LABELV $917
+LABELV $914
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $916
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg_numCommands
+INDIRI4
+LTI4 $913
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $926
+JUMPV
+LABELV $923
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 ui_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $927
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 ui_commands+8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_CheckCmdFlags
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $929
+CNSTI4 1
+RETI4
+ADDRGP4 $900
+JUMPV
+LABELV $929
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 ui_commands+4
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $900
+JUMPV
+LABELV $927
+LABELV $924
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $926
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numCommands
+INDIRI4
+LTI4 $923
+LABELV $911
+CNSTI4 0
+RETI4
+LABELV $900
+endproc CG_ConsoleCommand 36 8
+export CG_ConsoleCompleteArgument
+proc CG_ConsoleCompleteArgument 9244 12
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg
+ADDRFP4 0
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1028
+ARGP4
+CNSTI4 8192
+ARGI4
+ADDRGP4 trap_LiteralArgs
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 9228
+ADDRGP4 Com_LocalPlayerForCvarName
+CALLI4
+ASGNI4
+ADDRLP4 9224
+ADDRLP4 9228
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 9232
+ADDRGP4 Com_LocalPlayerBaseCvarName
+CALLP4
+ASGNP4
+ADDRLP4 9220
+ADDRLP4 9232
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $937
+JUMPV
+LABELV $934
+ADDRLP4 9236
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 9236
+INDIRI4
+ADDRGP4 playerCommands+12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $938
+ADDRLP4 9220
+INDIRP4
+ARGP4
+ADDRLP4 9236
+INDIRI4
+ADDRGP4 playerCommands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 9240
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 9240
+INDIRI4
+CNSTI4 0
+NEI4 $938
+ADDRLP4 9224
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 playerCommands+12
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $933
+JUMPV
+LABELV $938
+LABELV $935
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $937
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numPlayerCommands
+INDIRI4
+LTI4 $934
+ADDRLP4 9224
+INDIRI4
+CNSTI4 0
+NEI4 $942
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $947
+JUMPV
+LABELV $944
+ADDRLP4 9236
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 9236
+INDIRI4
+ADDRGP4 cg_commands+12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $948
+ADDRLP4 4
+ARGP4
+ADDRLP4 9236
+INDIRI4
+ADDRGP4 cg_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 9240
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 9240
+INDIRI4
+CNSTI4 0
+NEI4 $948
+ADDRLP4 1028
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 cg_commands+12
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $933
+JUMPV
+LABELV $948
+LABELV $945
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $947
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg_numCommands
+INDIRI4
+LTI4 $944
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $955
+JUMPV
+LABELV $952
+ADDRLP4 9236
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 9236
+INDIRI4
+ADDRGP4 ui_commands+12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $956
+ADDRLP4 4
+ARGP4
+ADDRLP4 9236
+INDIRI4
+ADDRGP4 ui_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 9240
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 9240
+INDIRI4
+CNSTI4 0
+NEI4 $956
+ADDRLP4 1028
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 ui_commands+12
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $933
+JUMPV
+LABELV $956
+LABELV $953
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $955
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numCommands
+INDIRI4
+LTI4 $952
+LABELV $942
+CNSTI4 0
+RETI4
+LABELV $933
+endproc CG_ConsoleCompleteArgument 9244 12
+export CG_InitConsoleCommands
+proc CG_InitConsoleCommands 12 8
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $964
+JUMPV
+LABELV $961
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 cg_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+LABELV $962
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $964
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg_numCommands
+INDIRI4
+LTI4 $961
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $968
+JUMPV
+LABELV $965
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 ui_commands
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+LABELV $966
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $968
+ADDRLP4 4
+INDIRI4
+ADDRGP4 ui_numCommands
+INDIRI4
+LTI4 $965
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $972
+JUMPV
+LABELV $969
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $976
+JUMPV
+LABELV $973
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 playerCommands
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_AddCommand
+CALLV
+pop
+LABELV $974
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $976
+ADDRLP4 8
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $973
+LABELV $970
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $972
+ADDRLP4 4
+INDIRI4
+ADDRGP4 numPlayerCommands
+INDIRI4
+LTI4 $969
+LABELV $960
+endproc CG_InitConsoleCommands 12 8
+import UI_Load
+import cgDC
+import menuScoreboard
+import Controls_SetDefaults_ui_shared
+import Controls_SetConfig_ui_shared
+import Controls_GetConfig_ui_shared
+import UI_OutOfMemory
+import UI_InitMemory_ui_shared
+import UI_Alloc_ui_shared
+import Menu_FindItemByName
+import Display_ScriptExecutions
+import Display_DebugMode
+import Display_CacheAll
+import Menu_SetScreenPlacement
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_WantsBindKeys
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import Script_Compile
+import PC_CompiledScript_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import UI_DrawProportionalString
+import UI_WindowResized
+import UI_WantsBindKeys
+import UI_DrawConnectScreen
+import UI_ConsoleCommand
+import UI_SetActiveMenu
+import UI_Refresh
+import UI_IsFullscreen
+import UI_SetCursorPos
+import UI_GetCursorPos
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import ui_numCommands
+import ui_commands
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_LoadVoiceChats
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_enableBreath
+import cg_enableDust
+import cg_blueTeamName
+import cg_redTeamName
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $899
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $895
+byte 1 77
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $890
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $889
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $888
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $887
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $886
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $885
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $884
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $883
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $882
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $881
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $880
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $879
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $878
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $877
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $876
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $875
+byte 1 103
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $874
+byte 1 103
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $873
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $872
+byte 1 118
+byte 1 111
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $871
+byte 1 118
+byte 1 111
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $870
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 84
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $869
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $868
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $867
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $866
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $865
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 85
+byte 1 112
+byte 1 0
+align 1
+LABELV $864
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 68
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $863
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $862
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 73
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $861
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 84
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $860
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $859
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 73
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $858
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 79
+byte 1 119
+byte 1 110
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $857
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $856
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 69
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $855
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 82
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $854
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $853
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $852
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 80
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $851
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $850
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $849
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 121
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $848
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $847
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $846
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $845
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $844
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $843
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $842
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $841
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $840
+byte 1 116
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 0
+align 1
+LABELV $839
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $838
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 111
+byte 1 0
+align 1
+LABELV $837
+byte 1 45
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $836
+byte 1 43
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $835
+byte 1 45
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $834
+byte 1 43
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $833
+byte 1 45
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 102
+byte 1 101
+byte 1 0
+align 1
+LABELV $832
+byte 1 43
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 102
+byte 1 101
+byte 1 0
+align 1
+LABELV $831
+byte 1 45
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $830
+byte 1 43
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $829
+byte 1 45
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $828
+byte 1 43
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $827
+byte 1 45
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $826
+byte 1 43
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $825
+byte 1 45
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $824
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $823
+byte 1 45
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $822
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $821
+byte 1 45
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $820
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $819
+byte 1 45
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $818
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $817
+byte 1 45
+byte 1 109
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $816
+byte 1 43
+byte 1 109
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $815
+byte 1 45
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $814
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $813
+byte 1 45
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $812
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $811
+byte 1 45
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $810
+byte 1 43
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $809
+byte 1 45
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $808
+byte 1 43
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $807
+byte 1 45
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $806
+byte 1 43
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $805
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 57
+byte 1 0
+align 1
+LABELV $804
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 57
+byte 1 0
+align 1
+LABELV $803
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 56
+byte 1 0
+align 1
+LABELV $802
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 56
+byte 1 0
+align 1
+LABELV $801
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 55
+byte 1 0
+align 1
+LABELV $800
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 55
+byte 1 0
+align 1
+LABELV $799
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 53
+byte 1 0
+align 1
+LABELV $798
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 53
+byte 1 0
+align 1
+LABELV $797
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 52
+byte 1 0
+align 1
+LABELV $796
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 52
+byte 1 0
+align 1
+LABELV $795
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $794
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $793
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 50
+byte 1 0
+align 1
+LABELV $792
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 50
+byte 1 0
+align 1
+LABELV $791
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 0
+align 1
+LABELV $790
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 0
+align 1
+LABELV $789
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 52
+byte 1 0
+align 1
+LABELV $788
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 52
+byte 1 0
+align 1
+LABELV $787
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $786
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $785
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $784
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $783
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $782
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $781
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $780
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $779
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 48
+byte 1 0
+align 1
+LABELV $778
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 48
+byte 1 0
+align 1
+LABELV $777
+byte 1 45
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $776
+byte 1 43
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $775
+byte 1 45
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $774
+byte 1 43
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $772
+byte 1 116
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $771
+byte 1 116
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $770
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $769
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 52
+byte 1 0
+align 1
+LABELV $768
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $767
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $766
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $765
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $764
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $763
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $762
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $761
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $760
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $759
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $758
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $757
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $756
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 0
+align 1
+LABELV $755
+byte 1 115
+byte 1 112
+byte 1 76
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $754
+byte 1 115
+byte 1 112
+byte 1 87
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $753
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $752
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $751
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $750
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $749
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $748
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $747
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $746
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $745
+byte 1 45
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 0
+align 1
+LABELV $744
+byte 1 43
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 0
+align 1
+LABELV $743
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $740
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+byte 1 0
+align 1
+LABELV $725
+byte 1 110
+byte 1 111
+byte 1 0
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+byte 1 0
+align 1
+LABELV $721
+byte 1 46
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $720
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $719
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $716
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $713
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 0
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 0
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+byte 1 0
+align 1
+LABELV $709
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 49
+byte 1 0
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 50
+byte 1 0
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 0
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+byte 1 0
+align 1
+LABELV $671
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+byte 1 105
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+byte 1 105
+byte 1 110
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+byte 1 110
+byte 1 111
+byte 1 0
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+byte 1 111
+byte 1 110
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+byte 1 111
+byte 1 110
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+byte 1 119
+byte 1 104
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+byte 1 0
+align 1
+LABELV $664
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $638
+byte 1 36
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $628
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $622
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 114
+byte 1 111
+byte 1 113
+byte 1 0
+align 1
+LABELV $621
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 114
+byte 1 111
+byte 1 113
+byte 1 0
+align 1
+LABELV $620
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $614
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 60
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 124
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $593
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 60
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 118
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 118
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $588
+byte 1 36
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $587
+byte 1 0
+align 1
+LABELV $579
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 60
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $573
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 60
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $569
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $568
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $559
+byte 1 78
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 99
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $543
+byte 1 32
+byte 1 0
+align 1
+LABELV $536
+byte 1 45
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 60
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $532
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $529
+byte 1 43
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 60
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 60
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $525
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $521
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $519
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $517
+byte 1 118
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $516
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $514
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $512
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $511
+byte 1 118
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $509
+byte 1 105
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $507
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $505
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $503
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $501
+byte 1 111
+byte 1 110
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $499
+byte 1 111
+byte 1 110
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $497
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $495
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $494
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $493
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $492
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $491
+byte 1 118
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $490
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $480
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 54
+byte 1 0
+align 1
+LABELV $479
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 54
+byte 1 0
+align 1
+LABELV $478
+byte 1 37
+byte 1 115
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $477
+byte 1 110
+byte 1 111
+byte 1 0
+align 1
+LABELV $472
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $468
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 53
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 53
+byte 1 0
+align 1
+LABELV $467
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $466
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $433
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $426
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $425
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $421
+byte 1 89
+byte 1 79
+byte 1 85
+byte 1 32
+byte 1 76
+byte 1 79
+byte 1 83
+byte 1 69
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $417
+byte 1 89
+byte 1 79
+byte 1 85
+byte 1 32
+byte 1 87
+byte 1 73
+byte 1 78
+byte 1 33
+byte 1 0
+align 1
+LABELV $336
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $333
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $328
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $321
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $315
+byte 1 42
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $310
+byte 1 42
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $299
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $284
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $280
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $265
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $264
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $259
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $258
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $257
+byte 1 46
+byte 1 0
+align 1
+LABELV $246
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $235
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $234
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $227
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 0
+align 1
+LABELV $226
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 0
+align 1
+LABELV $225
+byte 1 47
+byte 1 0
+align 1
+LABELV $208
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $205
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $200
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $199
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $196
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $185
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $165
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $144
+byte 1 84
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $141
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $130
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 83
+byte 1 97
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $127
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $120
+byte 1 83
+byte 1 97
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 0
+align 1
+LABELV $117
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $111
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $109
+byte 1 103
+byte 1 99
+byte 1 0
+align 1
+LABELV $108
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
@@ -0,0 +1,10499 @@
+data
+export menuScoreboard
+align 4
+LABELV menuScoreboard
+byte 4 0
+export CG_Draw3DModelEx
+code
+proc CG_Draw3DModelEx 684 16
+ADDRFP4 32
+ADDRFP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 676
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 676
+INDIRI4
+EQI4 $110
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 676
+INDIRI4
+NEI4 $106
+LABELV $110
+ADDRGP4 $105
+JUMPV
+LABELV $106
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 448
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 448
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 228
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 448+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 448+68
+ADDRFP4 24
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 448+8
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 680
+ADDRGP4 CG_AddSkinToFrame
+CALLI4
+ASGNI4
+ADDRLP4 448+116
+ADDRLP4 680
+INDIRI4
+ASGNI4
+ADDRLP4 448+4
+CNSTI4 64
+ASGNI4
+ADDRFP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $116
+ADDRLP4 448+124
+ADDRFP4 32
+INDIRP4
+INDIRU1
+ASGNU1
+ADDRLP4 448+124+1
+ADDRFP4 32
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 448+124+2
+ADDRFP4 32
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 448+124+3
+ADDRFP4 32
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+ASGNU1
+LABELV $116
+ADDRLP4 0+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0+16
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0+20
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+72
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRLP4 448
+ARGP4
+ADDRGP4 CG_AddRefEntityWithMinLight
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $105
+endproc CG_Draw3DModelEx 684 16
+export CG_Draw3DModel
+proc CG_Draw3DModel 0 36
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModelEx
+CALLV
+pop
+LABELV $134
+endproc CG_Draw3DModel 0 36
+export CG_DrawHead
+proc CG_DrawHead 60 36
+ADDRLP4 0
+CNSTI4 2108
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $137
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $140
+ADDRGP4 $135
+JUMPV
+LABELV $140
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_R_ModelBounds
+CALLI4
+pop
+ADDRLP4 4+8
+CNSTF4 3204448256
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1056964608
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 44
+CNSTF4 1060320051
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ARGP4
+ADDRGP4 CG_Draw3DModelEx
+CALLV
+pop
+ADDRGP4 $138
+JUMPV
+LABELV $137
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $154
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 940
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $154
+LABELV $138
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $157
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 cgs+683776+125496
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $157
+LABELV $135
+endproc CG_DrawHead 60 36
+export CG_DrawFlagModel
+proc CG_DrawFlagModel 76 32
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $162
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $162
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 cgs+683776+123368
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_R_ModelBounds
+CALLI4
+pop
+ADDRLP4 12+8
+CNSTF4 3204448256
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1056964608
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 1056964608
+ADDRLP4 36+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 52
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRGP4 cg+512320
+INDIRI4
+CVIF4 4
+CNSTF4 1157234688
+DIVF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 1114636288
+ADDRLP4 72
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $179
+ADDRLP4 56
+ADDRGP4 cgs+683776+123368
+INDIRI4
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $179
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $183
+ADDRLP4 56
+ADDRGP4 cgs+683776+123372
+INDIRI4
+ASGNI4
+ADDRGP4 $184
+JUMPV
+LABELV $183
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $161
+ADDRLP4 56
+ADDRGP4 cgs+683776+123376
+INDIRI4
+ASGNI4
+LABELV $188
+LABELV $184
+LABELV $180
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $163
+JUMPV
+LABELV $162
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $191
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $194
+CNSTI4 7
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $195
+JUMPV
+LABELV $194
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $196
+CNSTI4 8
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $197
+JUMPV
+LABELV $196
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $161
+CNSTI4 9
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+LABELV $199
+LABELV $197
+LABELV $195
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $200
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 48
+DIVI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $200
+LABELV $191
+LABELV $163
+LABELV $161
+endproc CG_DrawFlagModel 76 32
+export CG_DrawTeamBackground
+proc CG_DrawTeamBackground 20 20
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $205
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $206
+JUMPV
+LABELV $205
+ADDRFP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $203
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $210
+LABELV $206
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 CG_GetScreenVerticalPlacement
+CALLI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+683776+125492
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 CG_PopScreenPlacement
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $203
+endproc CG_DrawTeamBackground 20 20
+proc CG_DrawAttacker 72 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $216
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $215
+JUMPV
+LABELV $216
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35640
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $219
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $215
+JUMPV
+LABELV $219
+ADDRLP4 0
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $227
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $227
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+NEI4 $223
+LABELV $227
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $215
+JUMPV
+LABELV $223
+CNSTI4 2108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $228
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35640
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $215
+JUMPV
+LABELV $228
+ADDRLP4 36
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35640
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 10000
+LEI4 $234
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35640
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $215
+JUMPV
+LABELV $234
+ADDRLP4 4
+CNSTF4 1114636288
+ASGNF4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 1127481344
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+CNSTF4 1142947840
+ADDRLP4 4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 $239
+ARGP4
+ADDRLP4 60
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 8+12
+CNSTF4 1056964608
+ASGNF4
+CNSTI4 635
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 44
+INDIRP4
+ARGP4
+CNSTI4 4611
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+CNSTI4 512
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ADDF4
+RETF4
+LABELV $215
+endproc CG_DrawAttacker 72 24
+proc CG_DrawSnapshot 12 20
+ADDRGP4 $244
+ARGP4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+40
+INDIRI4
+ARGI4
+ADDRGP4 cgs+56048
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+CNSTI4 635
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 4611
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+CNSTI4 512
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ADDF4
+RETF4
+LABELV $243
+endproc CG_DrawSnapshot 12 20
+bss
+align 4
+LABELV $249
+skip 16
+align 4
+LABELV $250
+skip 4
+align 4
+LABELV $251
+skip 4
+code
+proc CG_DrawFPS 48 20
+ADDRGP4 cg+515608
+INDIRI4
+CNSTI4 0
+EQI4 $252
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $248
+JUMPV
+LABELV $252
+ADDRLP4 24
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 $251
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $250
+INDIRI4
+CNSTI4 4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $249
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 $250
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 4
+LEI4 $255
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $257
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $249
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $258
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $257
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $261
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $261
+ADDRLP4 20
+CNSTF4 1165623296
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $263
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 44
+INDIRP4
+ASGNP4
+CNSTI4 635
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 4611
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $255
+CNSTI4 512
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ADDF4
+RETF4
+LABELV $248
+endproc CG_DrawFPS 48 20
+proc CG_DrawTimer 40 24
+ADDRLP4 0
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cgs+59304
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 60
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1000
+DIVI4
+ADDRLP4 24
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 60000
+DIVI4
+ADDRLP4 24
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 3600000
+DIVI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $267
+ADDRGP4 $269
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+GEI4 $274
+ADDRLP4 28
+ADDRGP4 $270
+ASGNP4
+ADDRGP4 $275
+JUMPV
+LABELV $274
+ADDRLP4 28
+ADDRGP4 $271
+ASGNP4
+LABELV $275
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+GEI4 $276
+ADDRLP4 32
+ADDRGP4 $270
+ASGNP4
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRLP4 32
+ADDRGP4 $271
+ASGNP4
+LABELV $277
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRGP4 $268
+JUMPV
+LABELV $267
+ADDRGP4 $278
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+GEI4 $280
+ADDRLP4 28
+ADDRGP4 $270
+ASGNP4
+ADDRGP4 $281
+JUMPV
+LABELV $280
+ADDRLP4 28
+ADDRGP4 $271
+ASGNP4
+LABELV $281
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+LABELV $268
+CNSTI4 635
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 4611
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+CNSTI4 512
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ADDF4
+RETF4
+LABELV $264
+endproc CG_DrawTimer 40 24
+proc CG_DrawTeamOverlay 164 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 0
+NEI4 $283
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $282
+JUMPV
+LABELV $283
+ADDRLP4 24
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+EQI4 $287
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+EQI4 $287
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $282
+JUMPV
+LABELV $287
+ADDRGP4 cg+512320
+INDIRI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayersTime
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 5000
+LEI4 $289
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $282
+JUMPV
+LABELV $289
+CNSTI4 1024
+ARGI4
+ADDRLP4 120
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRGP4 $292
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 128
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+CNSTI4 8
+LEI4 $294
+ADDRLP4 124
+CNSTI4 8
+ASGNI4
+ADDRGP4 $295
+JUMPV
+LABELV $294
+ADDRLP4 124
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $295
+ADDRLP4 68
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $299
+JUMPV
+LABELV $296
+ADDRLP4 4
+CNSTI4 2108
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $301
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $301
+ADDRLP4 88
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 144
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 144
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LEI4 $303
+ADDRLP4 80
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $303
+LABELV $301
+LABELV $297
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $299
+ADDRLP4 8
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $296
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $305
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $282
+JUMPV
+LABELV $305
+ADDRLP4 80
+INDIRI4
+CNSTI4 96
+LEI4 $307
+ADDRLP4 80
+CNSTI4 96
+ASGNI4
+LABELV $307
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $309
+ADDRLP4 8
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $313
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $313
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 148
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LEI4 $315
+ADDRLP4 72
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $315
+LABELV $313
+LABELV $310
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $309
+ADDRLP4 72
+INDIRI4
+CNSTI4 128
+LEI4 $317
+ADDRLP4 72
+CNSTI4 128
+ASGNI4
+LABELV $317
+ADDRLP4 100
+ADDRLP4 80
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ADDRLP4 96
+INDIRI4
+ADDI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+CNSTI4 5
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $319
+ADDRLP4 84
+CNSTI4 640
+ADDRLP4 100
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $320
+JUMPV
+LABELV $319
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+LABELV $320
+ADDRLP4 104
+ADDRLP4 88
+INDIRI4
+ADDRLP4 92
+INDIRI4
+MULI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $321
+ADDRLP4 108
+ADDRFP4 0
+INDIRF4
+ADDRLP4 104
+INDIRI4
+CVIF4 4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $322
+JUMPV
+LABELV $321
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 104
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 108
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $322
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+NEI4 $323
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 32+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 32+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $324
+JUMPV
+LABELV $323
+ADDRLP4 140
+CNSTF4 0
+ASGNF4
+ADDRLP4 32
+ADDRLP4 140
+INDIRF4
+ASGNF4
+ADDRLP4 32+4
+ADDRLP4 140
+INDIRF4
+ASGNF4
+ADDRLP4 32+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32+12
+CNSTF4 1051260355
+ASGNF4
+LABELV $324
+ADDRLP4 32
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 100
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 104
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+683776+125492
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $333
+ADDRLP4 4
+CNSTI4 2108
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $338
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $338
+ADDRLP4 144
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32+12
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 32+8
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 32+4
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 84
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 148
+CNSTF4 0
+ASGNF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+CNSTI4 12
+ARGI4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $343
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $347
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $345
+LABELV $347
+ADDRLP4 28
+ADDRGP4 $348
+ASGNP4
+LABELV $345
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 160
+CNSTF4 0
+ASGNF4
+ADDRLP4 160
+INDIRF4
+ARGF4
+CNSTI4 16
+ARGI4
+ADDRLP4 160
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $343
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ARGP4
+ADDRGP4 CG_GetColorForHealth
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 48
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $349
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 48
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 32
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 96
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $350
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+683776+125496
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $351
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 48
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $349
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 48
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 32
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $356
+ADDRLP4 12
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRGP4 $357
+JUMPV
+LABELV $356
+ADDRLP4 12
+ADDRLP4 84
+INDIRI4
+ADDRLP4 100
+INDIRI4
+ADDI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $357
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $358
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $362
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $364
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 160
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $366
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $367
+JUMPV
+LABELV $366
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $367
+LABELV $364
+LABELV $362
+LABELV $359
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LEI4 $358
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $338
+LABELV $334
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $336
+ADDRLP4 8
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $333
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+RETF4
+LABELV $282
+endproc CG_DrawTeamOverlay 164 32
+proc CG_DrawUpperRight 16 12
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+CNSTI4 3
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+LTI4 $369
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 1
+NEI4 $369
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_DrawTeamOverlay
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $369
+ADDRGP4 cg_drawSnapshot+12
+INDIRI4
+CNSTI4 0
+EQI4 $373
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_DrawSnapshot
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $373
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawFPS+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $376
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $379
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $376
+LABELV $379
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 CG_DrawFPS
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $376
+ADDRGP4 cg_drawTimer+12
+INDIRI4
+CNSTI4 0
+EQI4 $380
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 CG_DrawTimer
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $380
+ADDRGP4 cg_drawAttacker+12
+INDIRI4
+CNSTI4 0
+EQI4 $383
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawAttacker
+CALLF4
+pop
+LABELV $383
+LABELV $368
+endproc CG_DrawUpperRight 16 12
+proc CG_DrawPickupItem 16 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawPickupItems+12
+INDIRI4
+CNSTI4 0
+NEI4 $387
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $386
+JUMPV
+LABELV $387
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $390
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $386
+JUMPV
+LABELV $390
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $394
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35856
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $397
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTF4 1090519040
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 24
+ADDI4
+ARGI4
+CNSTI4 48
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+28
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 4640
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $397
+LABELV $394
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $386
+endproc CG_DrawPickupItem 16 20
+proc CG_DrawLowerLeft 4 8
+ADDRLP4 0
+CNSTF4 1138229248
+ASGNF4
+CNSTI4 2
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 CG_DrawPickupItem
+CALLI4
+pop
+LABELV $401
+endproc CG_DrawLowerLeft 4 8
+proc CG_DrawReward 72 20
+ADDRGP4 cg_drawRewards+12
+INDIRI4
+CNSTI4 0
+NEI4 $403
+ADDRGP4 $402
+JUMPV
+LABELV $403
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35716
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $407
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35712
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $402
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $415
+JUMPV
+LABELV $412
+ADDRLP4 60
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35800
+ADDP4
+ADDP4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35804
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35760
+ADDP4
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35764
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35720
+ADDP4
+ADDP4
+ADDRLP4 68
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35724
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $413
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $415
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35712
+ADDP4
+INDIRI4
+LTI4 $412
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35716
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35712
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35716
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35800
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $410
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35800
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $410
+LABELV $407
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35720
+ADDP4
+INDIRI4
+CNSTI4 10
+LTI4 $431
+ADDRLP4 8
+CNSTF4 1113587712
+ASGNF4
+ADDRLP4 4
+CNSTF4 1133838336
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 60
+CNSTF4 1110441984
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35760
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $435
+ARGP4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35720
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 320
+ARGI4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+ARGP4
+CNSTI4 4354
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRGP4 $432
+JUMPV
+LABELV $431
+ADDRLP4 12
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35720
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 1113587712
+ASGNF4
+ADDRLP4 60
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+CNSTI4 320
+CNSTI4 48
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRLP4 60
+INDIRI4
+DIVI4
+SUBI4
+ADDRLP4 60
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $441
+JUMPV
+LABELV $438
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 64
+CNSTF4 1110441984
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35760
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+LABELV $439
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $441
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $438
+LABELV $432
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $402
+endproc CG_DrawReward 72 20
+export CG_AddLagometerFrameInfo
+proc CG_AddLagometerFrameInfo 8 0
+ADDRLP4 0
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+44
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 lagometer+512
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 lagometer+512
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $444
+endproc CG_AddLagometerFrameInfo 8 0
+export CG_AddLagometerSnapshotInfo
+proc CG_AddLagometerSnapshotInfo 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $450
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 lagometer+1540
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $450
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+516
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 lagometer+1540
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $449
+endproc CG_AddLagometerSnapshotInfo 4 0
+proc CG_DrawDisconnect 64 20
+ADDRLP4 44
+ADDRGP4 trap_GetCurrentCmdNumber
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 44
+INDIRI4
+CNSTI4 64
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+531848
+INDIRI4
+ARGI4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+531844
+INDIRP4
+INDIRI4
+LEI4 $466
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+LEI4 $462
+LABELV $466
+ADDRGP4 $460
+JUMPV
+LABELV $462
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 40
+ADDRGP4 $467
+ASGNP4
+CNSTI4 320
+ARGI4
+CNSTI4 100
+ARGI4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 9
+RSHI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $468
+ADDRGP4 $460
+JUMPV
+LABELV $468
+CNSTI4 3
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 28
+CNSTF4 1142161408
+ASGNF4
+ADDRLP4 32
+CNSTF4 1135083520
+ASGNF4
+ADDRGP4 $471
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 60
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $460
+endproc CG_DrawDisconnect 64 20
+proc CG_DrawLagometer 76 36
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawLagometer+12
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $477
+ADDRGP4 cgs+56060
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $473
+LABELV $477
+ADDRGP4 CG_DrawDisconnect
+CALLV
+pop
+ADDRGP4 $472
+JUMPV
+LABELV $473
+CNSTI4 3
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 44
+CNSTI4 592
+ASGNI4
+ADDRLP4 48
+CNSTI4 336
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 56
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cgs+683776+125632
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 12
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 20
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+CNSTF4 1077936128
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 36
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 16
+INDIRF4
+CNSTF4 1133903872
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $480
+ADDRLP4 8
+ADDRGP4 lagometer+512
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $485
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+EQI4 $487
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_color_table+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $487
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $490
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $490
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+683776+123336
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $486
+JUMPV
+LABELV $485
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $494
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+EQI4 $496
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRGP4 g_color_table+64
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $496
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $499
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $499
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRGP4 cgs+683776+123336
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $494
+LABELV $486
+LABELV $481
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $483
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+LTF4 $480
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 16
+INDIRF4
+CNSTF4 1147207680
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $506
+JUMPV
+LABELV $503
+ADDRLP4 8
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $509
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+516
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $511
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+EQI4 $512
+ADDRLP4 20
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_color_table+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $512
+JUMPV
+LABELV $511
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+EQI4 $517
+ADDRLP4 20
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_color_table+32
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $517
+LABELV $512
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $520
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $520
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+683776+123336
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $510
+JUMPV
+LABELV $509
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $524
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+EQI4 $526
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRGP4 g_color_table+16
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $526
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+683776+123336
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $524
+LABELV $510
+LABELV $504
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $506
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+LTF4 $503
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $535
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $531
+LABELV $535
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 $536
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $531
+ADDRGP4 CG_DrawDisconnect
+CALLV
+pop
+LABELV $472
+endproc CG_DrawLagometer 76 36
+export CG_DrawVoipMeter
+proc CG_DrawVoipMeter 304 20
+ADDRGP4 cg_voipShowMeter+12
+INDIRI4
+CNSTI4 0
+NEI4 $538
+ADDRGP4 $537
+JUMPV
+LABELV $538
+ADDRGP4 cg+531840
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 288
+ADDRGP4 trap_GetVoipTime
+CALLI4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $545
+ADDRLP4 280
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 250
+SUBI4
+GEI4 $542
+LABELV $545
+ADDRGP4 $537
+JUMPV
+LABELV $542
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 cg+531840
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 trap_GetVoipPower
+CALLF4
+ASGNF4
+ADDRLP4 284
+ADDRLP4 296
+INDIRF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1092616192
+ADDRLP4 284
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 10
+LEI4 $547
+ADDRLP4 20
+CNSTI4 10
+ASGNI4
+LABELV $547
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $552
+JUMPV
+LABELV $549
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+CNSTI1 42
+ASGNI1
+LABELV $550
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $552
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $549
+ADDRGP4 $554
+JUMPV
+LABELV $553
+ADDRLP4 300
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 300
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+ADDRLP4 4
+ADDP4
+CNSTI1 32
+ASGNI1
+LABELV $554
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $553
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 24
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $556
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 24
+ARGP4
+CNSTI4 5122
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $537
+endproc CG_DrawVoipMeter 304 20
+export CG_CenterPrint
+proc CG_CenterPrint 4 12
+ADDRLP4 0
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+ASGNP4
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 1
+EQI4 $559
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ADDRGP4 cg_splitviewTextScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $560
+JUMPV
+LABELV $559
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ADDRGP4 cg_hudTextScale+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $560
+ADDRLP4 0
+INDIRP4
+CNSTI4 34596
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 34584
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 34592
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 34588
+ADDP4
+ADDRFP4 12
+INDIRF4
+ASGNF4
+LABELV $557
+endproc CG_CenterPrint 4 12
+proc CG_DrawCenterString 16 36
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 34584
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $566
+ADDRGP4 $565
+JUMPV
+LABELV $566
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 34584
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1148846080
+ADDRGP4 cg_centertime+8
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $571
+ADDRGP4 $565
+JUMPV
+LABELV $571
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+CNSTI4 320
+ARGI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 34592
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 34596
+ADDP4
+ARGP4
+CNSTI4 267042
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 34588
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 cgs+56040
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ARGF4
+ADDRGP4 CG_DrawStringAutoWrap
+CALLV
+pop
+LABELV $565
+endproc CG_DrawCenterString 16 36
+export CG_GlobalCenterPrint
+proc CG_GlobalCenterPrint 0 12
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 1
+EQI4 $578
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ADDRGP4 cg_splitviewTextScale+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $579
+JUMPV
+LABELV $578
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ADDRGP4 cg_hudTextScale+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $579
+ADDRGP4 cg+516672
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+516660
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRGP4 cg+516668
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+516664
+ADDRFP4 8
+INDIRF4
+ASGNF4
+LABELV $577
+endproc CG_GlobalCenterPrint 0 12
+proc CG_DrawGlobalCenterString 16 36
+ADDRGP4 cg+516660
+INDIRI4
+CNSTI4 0
+NEI4 $590
+ADDRGP4 $589
+JUMPV
+LABELV $590
+ADDRGP4 cg+516660
+INDIRI4
+ARGI4
+CNSTF4 1148846080
+ADDRGP4 cg_centertime+8
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $595
+ADDRGP4 $589
+JUMPV
+LABELV $595
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+CNSTI4 320
+ARGI4
+ADDRGP4 cg+516668
+INDIRI4
+ARGI4
+ADDRGP4 cg+516672
+ARGP4
+CNSTI4 267042
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+516664
+INDIRF4
+ARGF4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 cgs+56040
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ARGF4
+ADDRGP4 CG_DrawStringAutoWrap
+CALLV
+pop
+LABELV $589
+endproc CG_DrawGlobalCenterString 16 36
+proc CG_DrawCrosshair 48 20
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $602
+ADDRGP4 $601
+JUMPV
+LABELV $602
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $605
+ADDRGP4 $601
+JUMPV
+LABELV $605
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35956
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $608
+ADDRGP4 $601
+JUMPV
+LABELV $608
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 cg_crosshairHealth+12
+INDIRI4
+CNSTI4 0
+EQI4 $611
+ADDRLP4 32
+ARGP4
+ADDRGP4 CG_ColorForHealth
+CALLV
+pop
+ADDRLP4 32
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $611
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 1
+LEI4 $614
+ADDRLP4 32
+CNSTF4 1073741824
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 $615
+JUMPV
+LABELV $614
+ADDRLP4 32
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+LABELV $615
+ADDRLP4 0
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35860
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $621
+ADDRLP4 0
+INDIRF4
+CNSTF4 1128792064
+GEF4 $621
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+LABELV $621
+ADDRLP4 20
+ADDRGP4 cg_crosshairX+12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 cg_crosshairY+12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $626
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $626
+ADDRLP4 16
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+683776+125592
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1142947840
+ADDRLP4 4
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 20
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1139802112
+ADDRLP4 8
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $601
+endproc CG_DrawCrosshair 48 20
+proc CG_DrawCrosshair3D 552 28
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $631
+ADDRGP4 $630
+JUMPV
+LABELV $631
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $634
+ADDRGP4 $630
+JUMPV
+LABELV $634
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35956
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $637
+ADDRGP4 $630
+JUMPV
+LABELV $637
+ADDRGP4 cg_crosshairHealth+12
+INDIRI4
+CNSTI4 0
+EQI4 $640
+ADDRLP4 228
+ARGP4
+ADDRGP4 CG_ColorForHealth
+CALLV
+pop
+ADDRGP4 $641
+JUMPV
+LABELV $640
+ADDRLP4 480
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 228+12
+ADDRLP4 480
+INDIRF4
+ASGNF4
+ADDRLP4 228+8
+ADDRLP4 480
+INDIRF4
+ASGNF4
+ADDRLP4 228+4
+ADDRLP4 480
+INDIRF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 480
+INDIRF4
+ASGNF4
+LABELV $641
+ADDRLP4 468
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 380
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35860
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 380
+INDIRF4
+CNSTF4 0
+LEF4 $649
+ADDRLP4 380
+INDIRF4
+CNSTF4 1128792064
+GEF4 $649
+ADDRLP4 380
+ADDRLP4 380
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRLP4 468
+ADDRLP4 468
+INDIRF4
+ADDRLP4 380
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+MULF4
+ASGNF4
+LABELV $649
+ADDRLP4 396
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+ADDRLP4 396
+INDIRI4
+CNSTI4 0
+GEI4 $652
+ADDRLP4 396
+CNSTI4 0
+ASGNI4
+LABELV $652
+ADDRLP4 472
+ADDRLP4 396
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+683776+125592
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $656
+ARGP4
+ADDRLP4 244
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 244
+ARGP4
+ADDRLP4 484
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 372
+ADDRLP4 484
+INDIRF4
+ASGNF4
+ADDRGP4 $657
+ARGP4
+ADDRLP4 244
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 244
+ARGP4
+ADDRLP4 488
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 476
+ADDRLP4 372
+INDIRF4
+ADDRLP4 488
+INDIRF4
+DIVF4
+ASGNF4
+CNSTF4 1078530011
+ADDRGP4 cg+512444+16
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+ARGF4
+ADDRLP4 492
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 464
+ADDRLP4 372
+INDIRF4
+ADDRLP4 492
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 376
+ADDRGP4 cgs+20100+35880
+INDIRI4
+CVIF4 4
+ADDRLP4 476
+INDIRF4
+MULF4
+ADDRLP4 372
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 464
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 384
+ADDRGP4 cg+512444+24
+INDIRF4
+ADDRGP4 cg+512444+36
+INDIRF4
+ADDRLP4 376
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 384+4
+ADDRGP4 cg+512444+24+4
+INDIRF4
+ADDRGP4 cg+512444+36+4
+INDIRF4
+ADDRLP4 376
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 384+8
+ADDRGP4 cg+512444+24+8
+INDIRF4
+ADDRGP4 cg+512444+36+8
+INDIRF4
+ADDRLP4 376
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 400
+ARGP4
+ADDRGP4 cg+512444+24
+ARGP4
+ADDRLP4 500
+CNSTP4 0
+ASGNP4
+ADDRLP4 500
+INDIRP4
+ARGP4
+ADDRLP4 500
+INDIRP4
+ARGP4
+ADDRLP4 384
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 228
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 24
+ASGNI4
+ADDRLP4 508
+CNSTF4 1132396544
+ADDRLP4 228
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 512
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 508
+INDIRF4
+ADDRLP4 512
+INDIRF4
+LTF4 $685
+ADDRLP4 504
+ADDRLP4 508
+INDIRF4
+ADDRLP4 512
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $686
+JUMPV
+LABELV $685
+ADDRLP4 504
+ADDRLP4 508
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $686
+ADDRLP4 0+124
+ADDRLP4 504
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 520
+CNSTF4 1132396544
+ADDRLP4 228+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 524
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 520
+INDIRF4
+ADDRLP4 524
+INDIRF4
+LTF4 $691
+ADDRLP4 516
+ADDRLP4 520
+INDIRF4
+ADDRLP4 524
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $692
+JUMPV
+LABELV $691
+ADDRLP4 516
+ADDRLP4 520
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $692
+ADDRLP4 0+124+1
+ADDRLP4 516
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 532
+CNSTF4 1132396544
+ADDRLP4 228+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 536
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 532
+INDIRF4
+ADDRLP4 536
+INDIRF4
+LTF4 $697
+ADDRLP4 528
+ADDRLP4 532
+INDIRF4
+ADDRLP4 536
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $698
+JUMPV
+LABELV $697
+ADDRLP4 528
+ADDRLP4 532
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $698
+ADDRLP4 0+124+2
+ADDRLP4 528
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 544
+CNSTF4 1132396544
+ADDRLP4 228+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 548
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 544
+INDIRF4
+ADDRLP4 548
+INDIRF4
+LTF4 $703
+ADDRLP4 540
+ADDRLP4 544
+INDIRF4
+ADDRLP4 548
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $704
+JUMPV
+LABELV $703
+ADDRLP4 540
+ADDRLP4 544
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $704
+ADDRLP4 0+124+3
+ADDRLP4 540
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+68
+ADDRLP4 400+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+152
+ADDRLP4 468
+INDIRF4
+CNSTF4 1142947840
+DIVF4
+ADDRLP4 464
+INDIRF4
+MULF4
+ADDRLP4 400+8
+INDIRF4
+MULF4
+ADDRLP4 376
+INDIRF4
+MULF4
+ADDRLP4 372
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0+120
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $630
+endproc CG_DrawCrosshair3D 552 28
+proc CG_DrawThirdPersonCrosshair 428 28
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $711
+ADDRGP4 $710
+JUMPV
+LABELV $711
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $714
+ADDRGP4 $710
+JUMPV
+LABELV $714
+ADDRLP4 356
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35956
+ADDP4
+INDIRI4
+ADDRLP4 356
+INDIRI4
+EQI4 $722
+CNSTI4 272
+ADDRGP4 cg+531848
+INDIRI4
+MULI4
+ADDRGP4 cg_thirdPerson+12
+ADDP4
+INDIRI4
+ADDRLP4 356
+INDIRI4
+NEI4 $717
+LABELV $722
+ADDRGP4 $710
+JUMPV
+LABELV $717
+ADDRGP4 cg_crosshairHealth+12
+INDIRI4
+CNSTI4 0
+EQI4 $723
+ADDRLP4 228
+ARGP4
+ADDRGP4 CG_ColorForHealth
+CALLV
+pop
+ADDRGP4 $724
+JUMPV
+LABELV $723
+ADDRLP4 360
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 228+12
+ADDRLP4 360
+INDIRF4
+ASGNF4
+ADDRLP4 228+8
+ADDRLP4 360
+INDIRF4
+ASGNF4
+ADDRLP4 228+4
+ADDRLP4 360
+INDIRF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 360
+INDIRF4
+ASGNF4
+LABELV $724
+ADDRLP4 284
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 244
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35860
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 244
+INDIRF4
+CNSTF4 0
+LEF4 $732
+ADDRLP4 244
+INDIRF4
+CNSTF4 1128792064
+GEF4 $732
+ADDRLP4 244
+ADDRLP4 244
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRLP4 284
+ADDRLP4 284
+INDIRF4
+ADDRLP4 244
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+MULF4
+ASGNF4
+LABELV $732
+ADDRLP4 276
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+GEI4 $735
+ADDRLP4 276
+CNSTI4 0
+ASGNI4
+LABELV $735
+ADDRLP4 288
+ADDRLP4 276
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+683776+125592
+ADDP4
+INDIRI4
+ASGNI4
+CNSTF4 1078530011
+ADDRGP4 cg+512444+16
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+ARGF4
+ADDRLP4 364
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 280
+ADDRLP4 364
+INDIRF4
+ASGNF4
+ADDRLP4 272
+ADDRGP4 cgs+20100+35880
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+ADDRLP4 280
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 248
+ADDRGP4 cg+512908
+INDIRF4
+ADDRGP4 cg+512932
+INDIRF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 248+4
+ADDRGP4 cg+512908+4
+INDIRF4
+ADDRGP4 cg+512932+4
+INDIRF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 248+8
+ADDRGP4 cg+512908+8
+INDIRF4
+ADDRGP4 cg+512932+8
+INDIRF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRGP4 cg+512908
+ARGP4
+ADDRLP4 372
+CNSTP4 0
+ASGNP4
+ADDRLP4 372
+INDIRP4
+ARGP4
+ADDRLP4 372
+INDIRP4
+ARGP4
+ADDRLP4 248
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 228
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 24
+ASGNI4
+ADDRLP4 380
+CNSTF4 1132396544
+ADDRLP4 228
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 384
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 380
+INDIRF4
+ADDRLP4 384
+INDIRF4
+LTF4 $759
+ADDRLP4 376
+ADDRLP4 380
+INDIRF4
+ADDRLP4 384
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $760
+JUMPV
+LABELV $759
+ADDRLP4 376
+ADDRLP4 380
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $760
+ADDRLP4 0+124
+ADDRLP4 376
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 392
+CNSTF4 1132396544
+ADDRLP4 228+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 396
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 392
+INDIRF4
+ADDRLP4 396
+INDIRF4
+LTF4 $765
+ADDRLP4 388
+ADDRLP4 392
+INDIRF4
+ADDRLP4 396
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $766
+JUMPV
+LABELV $765
+ADDRLP4 388
+ADDRLP4 392
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $766
+ADDRLP4 0+124+1
+ADDRLP4 388
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 404
+CNSTF4 1132396544
+ADDRLP4 228+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 408
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 404
+INDIRF4
+ADDRLP4 408
+INDIRF4
+LTF4 $771
+ADDRLP4 400
+ADDRLP4 404
+INDIRF4
+ADDRLP4 408
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $772
+JUMPV
+LABELV $771
+ADDRLP4 400
+ADDRLP4 404
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $772
+ADDRLP4 0+124+2
+ADDRLP4 400
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 416
+CNSTF4 1132396544
+ADDRLP4 228+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 420
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 416
+INDIRF4
+ADDRLP4 420
+INDIRF4
+LTF4 $777
+ADDRLP4 412
+ADDRLP4 416
+INDIRF4
+ADDRLP4 420
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $778
+JUMPV
+LABELV $777
+ADDRLP4 412
+ADDRLP4 416
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $778
+ADDRLP4 0+124+3
+ADDRLP4 412
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0+68
+ADDRLP4 292+12
+INDIRB
+ASGNB 12
+ADDRLP4 260
+ADDRGP4 cg+512444+24
+INDIRF4
+ADDRLP4 0+68
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRGP4 cg+512444+24+4
+INDIRF4
+ADDRLP4 0+68+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRGP4 cg+512444+24+8
+INDIRF4
+ADDRLP4 0+68+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 424
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 0+152
+ADDRLP4 284
+INDIRF4
+CNSTF4 1142947840
+DIVF4
+ADDRLP4 280
+INDIRF4
+MULF4
+ADDRLP4 424
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+120
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $710
+endproc CG_DrawThirdPersonCrosshair 428 28
+proc CG_ScanForCrosshairEntity 104 28
+ADDRLP4 64
+ADDRGP4 cg+512444+24
+INDIRB
+ASGNB 12
+ADDRLP4 92
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 76
+ADDRLP4 64
+INDIRF4
+ADDRLP4 92
+INDIRF4
+ADDRGP4 cg+512444+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 64+4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+ADDRGP4 cg+512444+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76+8
+ADDRLP4 64+8
+INDIRF4
+CNSTF4 1207959552
+ADDRGP4 cg+512444+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 96
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33554433
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0+56
+INDIRI4
+CNSTI4 64
+LTI4 $814
+ADDRGP4 $798
+JUMPV
+LABELV $814
+ADDRLP4 0+12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 100
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $818
+ADDRGP4 $798
+JUMPV
+LABELV $818
+CNSTI4 852
+ADDRLP4 0+56
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+228
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $820
+ADDRGP4 $798
+JUMPV
+LABELV $820
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35624
+ADDP4
+ADDRLP4 0+56
+INDIRI4
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35628
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $798
+endproc CG_ScanForCrosshairEntity 104 28
+proc CG_DrawCrosshairNames 340 32
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $829
+ADDRGP4 $828
+JUMPV
+LABELV $829
+ADDRGP4 cg_drawCrosshairNames+12
+INDIRI4
+CNSTI4 0
+NEI4 $832
+ADDRGP4 $828
+JUMPV
+LABELV $832
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35956
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $835
+ADDRGP4 $828
+JUMPV
+LABELV $835
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 CG_ScanForCrosshairEntity
+CALLV
+pop
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35628
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1000
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $839
+ADDRGP4 $828
+JUMPV
+LABELV $839
+ADDRGP4 cg+515604
+INDIRI4
+CNSTI4 1
+LEI4 $841
+ADDRLP4 16
+CNSTF4 1073741824
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $842
+JUMPV
+LABELV $841
+ADDRLP4 16
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $842
+CNSTI4 512
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 480
+ADDRLP4 16
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+SUBI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 2108
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35624
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+4
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 32
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+CNSTI4 320
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 4610
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 cg_voipShowCrosshairMeter+12
+INDIRI4
+CNSTI4 0
+EQI4 $849
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35624
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_GetVoipPower
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35624
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 trap_GetVoipTime
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRF4
+CNSTF4 0
+LEF4 $854
+ADDRLP4 52
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+LEI4 $854
+ADDRLP4 52
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 250
+SUBI4
+LTI4 $854
+ADDRLP4 76
+CNSTF4 1092616192
+ADDRLP4 40
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 10
+LEI4 $857
+ADDRLP4 76
+CNSTI4 10
+ASGNI4
+LABELV $857
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 $862
+JUMPV
+LABELV $859
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+ADDP4
+CNSTI1 42
+ASGNI1
+LABELV $860
+ADDRLP4 56
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $862
+ADDRLP4 56
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LTI4 $859
+ADDRGP4 $864
+JUMPV
+LABELV $863
+ADDRLP4 336
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 336
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+ADDRLP4 60
+ADDP4
+CNSTI1 32
+ASGNI1
+LABELV $864
+ADDRLP4 56
+INDIRI4
+CNSTI4 10
+LTI4 $863
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 80
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $556
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 320
+ARGI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 80
+ARGP4
+CNSTI4 4610
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $854
+LABELV $849
+LABELV $828
+endproc CG_DrawCrosshairNames 340 32
+lit
+align 4
+LABELV $867
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+code
+proc CG_DrawShaderInfo 284 36
+ADDRLP4 232
+ADDRGP4 $867
+INDIRB
+ASGNB 16
+ADDRGP4 cg_drawShaderInfo+12
+INDIRI4
+CNSTI4 0
+NEI4 $868
+ADDRGP4 $866
+JUMPV
+LABELV $868
+ADDRLP4 252
+CNSTF4 1124073472
+ASGNF4
+ADDRLP4 228
+ADDRLP4 252
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 252
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+512444+24
+INDIRB
+ASGNB 12
+ADDRLP4 256
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 80
+ADDRLP4 0
+INDIRF4
+ADDRLP4 256
+INDIRF4
+ADDRGP4 cg+512444+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 256
+INDIRF4
+ADDRGP4 cg+512444+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1207959552
+ADDRGP4 cg+512444+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 260
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRP4
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 92
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+ADDRLP4 264
+INDIRP4
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 268
+CNSTI4 0
+ASGNI4
+ADDRLP4 92+44
+INDIRI4
+ADDRLP4 268
+INDIRI4
+LEI4 $887
+ADDRLP4 92+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+LTF4 $893
+ADDRLP4 12+44
+INDIRI4
+ADDRLP4 268
+INDIRI4
+GTI4 $887
+LABELV $893
+ADDRLP4 12
+ARGP4
+ADDRLP4 92
+ARGP4
+CNSTU4 64
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $887
+ADDRLP4 12+44
+INDIRI4
+CNSTI4 0
+GTI4 $894
+ADDRGP4 $866
+JUMPV
+LABELV $894
+ADDRLP4 12+44
+INDIRI4
+ARGI4
+CNSTI4 -4
+ARGI4
+ADDRLP4 272
+ADDRGP4 trap_R_GetSurfaceShader
+CALLI4
+ASGNI4
+ADDRLP4 248
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+ARGI4
+ADDRLP4 156
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_R_GetShaderName
+CALLV
+pop
+CNSTI4 2
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 232+12
+CNSTF4 1056964608
+ADDRLP4 232+12
+INDIRF4
+MULF4
+ASGNF4
+CNSTI4 0
+ARGI4
+CNSTF4 1139802112
+ADDRLP4 76
+INDIRF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 156
+ARGP4
+CNSTI4 4656
+ARGI4
+ADDRLP4 232
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRLP4 220
+CNSTF4 0
+ASGNF4
+ADDRLP4 224
+CNSTF4 1139802112
+ADDRLP4 76
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 220
+ARGP4
+ADDRLP4 224
+ARGP4
+ADDRLP4 228
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 220
+INDIRF4
+ARGF4
+ADDRLP4 224
+INDIRF4
+ARGF4
+ADDRLP4 228
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 276
+CNSTF4 0
+ASGNF4
+ADDRLP4 276
+INDIRF4
+ARGF4
+ADDRLP4 276
+INDIRF4
+ARGF4
+ADDRLP4 280
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 280
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRF4
+ARGF4
+ADDRLP4 248
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $866
+endproc CG_DrawShaderInfo 284 36
+proc CG_DrawSpectator 12 20
+CNSTI4 1
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+CNSTI4 512
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 480
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+SUBI4
+ASGNI4
+CNSTI4 320
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $900
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 1
+NEI4 $901
+CNSTI4 320
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $904
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRGP4 $902
+JUMPV
+LABELV $901
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+LTI4 $905
+CNSTI4 320
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $908
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $905
+LABELV $902
+LABELV $899
+endproc CG_DrawSpectator 12 20
+proc CG_DrawVote 160 20
+ADDRGP4 cgs+56184
+INDIRI4
+CNSTI4 0
+NEI4 $910
+ADDRGP4 $909
+JUMPV
+LABELV $910
+CNSTI4 2
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 cgs+56196
+INDIRI4
+CNSTI4 0
+EQI4 $913
+ADDRGP4 cgs+56196
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+683776+127212
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $913
+ADDRLP4 4
+CNSTI4 30000
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cgs+56184
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $921
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $921
+ADDRGP4 cg+531848
+INDIRI4
+ARGI4
+ADDRGP4 $924
+ARGP4
+ADDRLP4 140
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_KeysStringForBinding
+CALLV
+pop
+ADDRGP4 cg+531848
+INDIRI4
+ARGI4
+ADDRGP4 $926
+ARGP4
+ADDRLP4 144
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 72
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_KeysStringForBinding
+CALLV
+pop
+CNSTI4 256
+ARGI4
+ADDRLP4 148
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRGP4 $927
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 cgs+56200
+ARGP4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 152
+INDIRP4
+ASGNP4
+CNSTI4 2
+ARGI4
+CNSTI4 58
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+ADDRGP4 $929
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 cgs+56188
+INDIRI4
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRGP4 cgs+56192
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 58
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $932
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+LSHI4
+CNSTI4 58
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+LABELV $909
+endproc CG_DrawVote 160 20
+proc CG_DrawTeamVote 24 20
+CNSTI4 2108
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $934
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $935
+JUMPV
+LABELV $934
+CNSTI4 2108
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $933
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $940
+LABELV $935
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+57224
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $944
+ADDRGP4 $933
+JUMPV
+LABELV $944
+CNSTI4 2
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+57248
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $947
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+57248
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+683776+127212
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $947
+ADDRLP4 4
+CNSTI4 30000
+ADDRGP4 cg+512320
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+57224
+ADDP4
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $955
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $955
+ADDRGP4 $957
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cgs+57256
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cgs+57232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cgs+57240
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+CNSTI4 90
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+LABELV $933
+endproc CG_DrawTeamVote 24 20
+export CG_AnyScoreboardShowing
+proc CG_AnyScoreboardShowing 8 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $965
+JUMPV
+LABELV $962
+ADDRLP4 4
+CNSTI4 39084
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+531852
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $966
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+531852+36012
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $966
+CNSTI4 1
+RETI4
+ADDRGP4 $961
+JUMPV
+LABELV $966
+LABELV $963
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $965
+ADDRLP4 4
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $962
+CNSTI4 0
+RETI4
+LABELV $961
+endproc CG_AnyScoreboardShowing 8 0
+data
+align 4
+LABELV $972
+byte 4 1
+byte 4 1
+byte 4 1
+byte 4 1
+code
+proc CG_DrawScoreboard 32 16
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 menuScoreboard
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $973
+ADDRLP4 4
+ADDRGP4 menuScoreboard
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -1048577
+BANDI4
+ASGNI4
+LABELV $973
+ADDRGP4 cg_paused+12
+INDIRI4
+CNSTI4 0
+EQI4 $975
+ADDRGP4 cg+531840
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $978
+ADDRGP4 cg+531848
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $972
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $978
+CNSTI4 0
+RETI4
+ADDRGP4 $971
+JUMPV
+LABELV $975
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 2
+NEI4 $982
+ADDRGP4 cg+531840
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $982
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $982
+ADDRGP4 cg+531848
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $972
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $971
+JUMPV
+LABELV $982
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+523588
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $988
+ADDRGP4 cg+531840
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $988
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 36008
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $988
+CNSTI4 0
+RETI4
+ADDRGP4 $971
+JUMPV
+LABELV $988
+ADDRGP4 cg+531840
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1001
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 36008
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1001
+ADDRLP4 8
+CNSTI4 116
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $1001
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $993
+LABELV $1001
+ADDRGP4 $994
+JUMPV
+LABELV $993
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 36016
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 200
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1002
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 36020
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 cg+531848
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $972
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $971
+JUMPV
+LABELV $1002
+LABELV $994
+ADDRGP4 menuScoreboard
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1007
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+LTI4 $1009
+ADDRGP4 $1012
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 menuScoreboard
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $1010
+JUMPV
+LABELV $1009
+ADDRGP4 $1013
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRGP4 menuScoreboard
+ADDRLP4 12
+INDIRP4
+ASGNP4
+LABELV $1010
+LABELV $1007
+ADDRGP4 menuScoreboard
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1014
+ADDRGP4 cg+531840
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1016
+ADDRGP4 cg+531848
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $972
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1019
+ADDRGP4 cg+531848
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $972
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1026
+JUMPV
+LABELV $1023
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 56
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 cg+518860
+ADDP4
+INDIRI4
+NEI4 $1028
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 36052
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $1028
+LABELV $1024
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1026
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+518844
+INDIRI4
+LTI4 $1023
+ADDRLP4 20
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRGP4 cg+523476
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $1019
+ADDRLP4 12
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 36052
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1017
+JUMPV
+LABELV $1016
+ADDRGP4 cg+518848
+INDIRI4
+ADDRGP4 cg+518844
+INDIRI4
+LTI4 $1035
+ADDRGP4 cg+518848
+ADDRGP4 cg+518844
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1035
+ADDRLP4 12
+ADDRGP4 cg+518848
+INDIRI4
+ASGNI4
+LABELV $1017
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+LTI4 $1042
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $1048
+JUMPV
+LABELV $1045
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $1050
+ADDRGP4 $1047
+JUMPV
+LABELV $1050
+CNSTI4 56
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+52
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1052
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1053
+JUMPV
+LABELV $1052
+CNSTI4 56
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+52
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1056
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1056
+LABELV $1053
+LABELV $1046
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1048
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+518844
+INDIRI4
+LTI4 $1045
+LABELV $1047
+CNSTI4 56
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+52
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $1060
+ADDRLP4 20
+CNSTI4 -1
+ASGNI4
+LABELV $1060
+CNSTI4 56
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+52
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $1064
+ADDRLP4 24
+CNSTI4 -1
+ASGNI4
+LABELV $1064
+ADDRGP4 menuScoreboard
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 menuScoreboard
+INDIRP4
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 $1043
+JUMPV
+LABELV $1042
+ADDRGP4 menuScoreboard
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+LABELV $1043
+ADDRGP4 menuScoreboard
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_Paint
+CALLV
+pop
+LABELV $1014
+CNSTI4 1
+RETI4
+LABELV $971
+endproc CG_DrawScoreboard 32 16
+proc CG_DrawIntermission 4 0
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 36016
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 36012
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1068
+endproc CG_DrawIntermission 4 0
+proc CG_DrawBotInfo 56 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $1073
+CNSTI4 0
+RETI4
+ADDRGP4 $1072
+JUMPV
+LABELV $1073
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 864
+ADDI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1077
+CNSTI4 0
+RETI4
+ADDRGP4 $1072
+JUMPV
+LABELV $1077
+CNSTI4 512
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $239
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1079
+ADDRGP4 $1081
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+CNSTI4 320
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1079
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1082
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1083
+CNSTI4 320
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1083
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1085
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1086
+ADDRLP4 4
+ADDRGP4 $1088
+ASGNP4
+CNSTI4 320
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1086
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1089
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1090
+ADDRGP4 $1092
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 52
+INDIRP4
+ASGNP4
+CNSTI4 320
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $1090
+CNSTI4 1
+RETI4
+LABELV $1072
+endproc CG_DrawBotInfo 56 20
+proc CG_DrawFollow 16 20
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $1094
+CNSTI4 0
+RETI4
+ADDRGP4 $1093
+JUMPV
+LABELV $1094
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 24
+ASGNI4
+CNSTI4 320
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1097
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+CNSTI4 512
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 2108
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+4
+ADDP4
+ASGNP4
+CNSTI4 320
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 4866
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+CNSTI4 768
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawBotInfo
+CALLI4
+pop
+CNSTI4 1
+RETI4
+LABELV $1093
+endproc CG_DrawFollow 16 20
+proc CG_DrawAmmoWarning 4 20
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1102
+ADDRGP4 $1101
+JUMPV
+LABELV $1102
+ADDRGP4 cg_drawAmmoWarning+12
+INDIRI4
+CNSTI4 0
+NEI4 $1105
+ADDRGP4 $1101
+JUMPV
+LABELV $1105
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1108
+ADDRGP4 $1101
+JUMPV
+LABELV $1108
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35620
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1111
+ADDRLP4 0
+ADDRGP4 $1114
+ASGNP4
+ADDRGP4 $1112
+JUMPV
+LABELV $1111
+ADDRLP4 0
+ADDRGP4 $1115
+ASGNP4
+LABELV $1112
+CNSTI4 320
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $1101
+endproc CG_DrawAmmoWarning 4 20
+proc CG_DrawProxWarning 48 20
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $1117
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35652
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1116
+JUMPV
+LABELV $1117
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35652
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1121
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35652
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $1121
+ADDRLP4 0
+CNSTI4 10
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35652
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $1128
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+GTI4 $1128
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $1130
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $1129
+JUMPV
+LABELV $1128
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $1131
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $1129
+CNSTI4 512
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_DrawStringLineHeight
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 44
+INDIRI4
+ASGNI4
+CNSTI4 320
+ARGI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 64
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 4610
+ARGI4
+ADDRGP4 g_color_table+16
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $1116
+endproc CG_DrawProxWarning 48 20
+proc CG_DrawWarmup 44 32
+ADDRLP4 4
+ADDRGP4 cg+523588
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1135
+ADDRGP4 $1133
+JUMPV
+LABELV $1135
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1137
+ADDRLP4 12
+ADDRGP4 $1139
+ASGNP4
+CNSTI4 320
+ARGI4
+CNSTI4 24
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 4610
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRGP4 cg+523592
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1133
+JUMPV
+LABELV $1137
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 1
+NEI4 $1141
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1147
+JUMPV
+LABELV $1144
+ADDRLP4 32
+CNSTI4 2108
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cgs+77768
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $1149
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1149
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1154
+ADDRLP4 8
+CNSTI4 2108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRGP4 $1155
+JUMPV
+LABELV $1154
+ADDRLP4 16
+CNSTI4 2108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+LABELV $1155
+LABELV $1149
+LABELV $1145
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1147
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+56116
+INDIRI4
+LTI4 $1144
+ADDRLP4 32
+CNSTU4 0
+ASGNU4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $1142
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $1142
+ADDRGP4 $1160
+ARGP4
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 40
+INDIRP4
+ASGNP4
+CNSTI4 320
+ARGI4
+CNSTI4 25
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 4866
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTF4 1059760811
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $1142
+JUMPV
+LABELV $1141
+ADDRLP4 12
+ADDRGP4 cgs+56064
+ASGNP4
+CNSTI4 320
+ARGI4
+CNSTI4 25
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 4866
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTF4 1059760811
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1142
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1163
+ADDRGP4 cg+523588
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1163
+ADDRGP4 $1166
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+523592
+INDIRI4
+EQI4 $1167
+ADDRGP4 cg+523592
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1173
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $1176
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $1179
+ADDRGP4 $1172
+JUMPV
+LABELV $1173
+ADDRGP4 cgs+683776+127448
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1172
+JUMPV
+LABELV $1176
+ADDRGP4 cgs+683776+127444
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1172
+JUMPV
+LABELV $1179
+ADDRGP4 cgs+683776+127440
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1172
+LABELV $1167
+ADDRLP4 32
+ADDRGP4 cg+523592
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $1185
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+EQI4 $1186
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+EQI4 $1187
+ADDRGP4 $1182
+JUMPV
+LABELV $1185
+ADDRLP4 20
+CNSTF4 1058362709
+ASGNF4
+ADDRLP4 24
+CNSTI4 768
+ASGNI4
+ADDRGP4 $1183
+JUMPV
+LABELV $1186
+ADDRLP4 20
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 24
+CNSTI4 768
+ASGNI4
+ADDRGP4 $1183
+JUMPV
+LABELV $1187
+ADDRLP4 20
+CNSTF4 1054168405
+ASGNF4
+ADDRLP4 24
+CNSTI4 768
+ASGNI4
+ADDRGP4 $1183
+JUMPV
+LABELV $1182
+ADDRLP4 20
+CNSTF4 1051372203
+ASGNF4
+ADDRLP4 24
+CNSTI4 512
+ASGNI4
+LABELV $1183
+CNSTI4 320
+ARGI4
+CNSTI4 70
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 4098
+BORI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1133
+endproc CG_DrawWarmup 44 32
+export CG_DrawNotify
+proc CG_DrawNotify 12 36
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1189
+ADDRLP4 0
+CNSTI4 72
+ASGNI4
+ADDRGP4 $1190
+JUMPV
+LABELV $1189
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+LABELV $1190
+CNSTI4 2
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 36056
+ADDP4
+ARGP4
+CNSTI4 256
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 cgs+56040
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1115684864
+SUBF4
+ARGF4
+ADDRGP4 CG_DrawStringAutoWrap
+CALLV
+pop
+LABELV $1188
+endproc CG_DrawNotify 12 36
+export CG_DrawTimedMenus
+proc CG_DrawTimedMenus 4 4
+ADDRLP4 0
+CNSTI4 35644
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1194
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+LTI4 $1194
+ADDRGP4 cg+531840
+INDIRP4
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35648
+ADDP4
+INDIRI4
+EQI4 $1194
+ADDRGP4 $1201
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1195
+JUMPV
+LABELV $1194
+ADDRGP4 $1201
+ARGP4
+ADDRGP4 Menus_CloseByName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1195
+LABELV $1193
+endproc CG_DrawTimedMenus 4 4
+proc CG_Draw2D 4 8
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35660
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1203
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35664
+ADDP4
+INDIRI4
+LEI4 $1203
+ADDRGP4 cg+531848
+INDIRI4
+ARGI4
+ADDRGP4 CG_CheckOrderPending
+CALLV
+pop
+LABELV $1203
+ADDRGP4 cg+24
+INDIRI4
+CNSTI4 0
+EQI4 $1209
+ADDRGP4 $1202
+JUMPV
+LABELV $1209
+ADDRGP4 cg+515628
+INDIRI4
+CNSTI4 0
+EQI4 $1212
+ADDRGP4 $1202
+JUMPV
+LABELV $1212
+ADDRGP4 cg_draw2D+12
+INDIRI4
+CNSTI4 0
+NEI4 $1215
+ADDRGP4 $1202
+JUMPV
+LABELV $1215
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1218
+ADDRGP4 CG_DrawIntermission
+CALLV
+pop
+ADDRGP4 $1202
+JUMPV
+LABELV $1218
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1221
+ADDRGP4 CG_DrawSpectator
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1224
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+LABELV $1224
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 $1222
+JUMPV
+LABELV $1221
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 36008
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1226
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $1226
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+CNSTI4 0
+EQI4 $1230
+CNSTI4 1
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawTimedMenus
+CALLV
+pop
+ADDRGP4 Menu_PaintAll
+CALLV
+pop
+LABELV $1230
+ADDRGP4 CG_DrawAmmoWarning
+CALLV
+pop
+ADDRGP4 CG_DrawProxWarning
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1233
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+LABELV $1233
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 CG_DrawWeaponSelect
+CALLV
+pop
+ADDRGP4 CG_DrawReward
+CALLV
+pop
+LABELV $1226
+LABELV $1222
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+LTI4 $1235
+LABELV $1235
+ADDRGP4 CG_DrawVote
+CALLV
+pop
+ADDRGP4 CG_DrawTeamVote
+CALLV
+pop
+ADDRGP4 CG_DrawLagometer
+CALLV
+pop
+ADDRGP4 CG_DrawVoipMeter
+CALLV
+pop
+ADDRGP4 cg_paused+12
+INDIRI4
+CNSTI4 0
+NEI4 $1238
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawUpperRight
+CALLV
+pop
+LABELV $1238
+ADDRGP4 CG_DrawLowerLeft
+CALLV
+pop
+ADDRGP4 CG_DrawShaderInfo
+CALLV
+pop
+ADDRGP4 CG_DrawFollow
+CALLI4
+pop
+ADDRLP4 0
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 36012
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 36012
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1242
+ADDRGP4 CG_DrawCenterString
+CALLV
+pop
+LABELV $1242
+LABELV $1202
+endproc CG_Draw2D 4 8
+export CG_FogView
+proc CG_FogView 8 28
+ADDRLP4 0
+ADDRGP4 cg+512444+76
+INDIRI4
+CNSTI4 2
+BANDI4
+ASGNI4
+ADDRGP4 cg+512444+24
+ARGP4
+ADDRGP4 cg+512444+368
+ARGP4
+ADDRGP4 cg+512444+372
+ARGP4
+ADDRGP4 cg+512444+384
+ARGP4
+ADDRGP4 cg+512444+388
+ARGP4
+ADDRGP4 cg+512444+436
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_GetViewFog
+CALLV
+pop
+ADDRGP4 cg+512444+368
+INDIRI4
+CNSTI4 0
+NEI4 $1260
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+512444+372
+INDIRF4
+ADDRLP4 4
+INDIRF4
+NEF4 $1273
+ADDRGP4 cg+512444+372+4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+NEF4 $1273
+ADDRGP4 cg+512444+372+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+EQF4 $1260
+LABELV $1273
+ADDRGP4 cg+512444+368
+ADDRGP4 cgs+212708
+INDIRI4
+ASGNI4
+ADDRGP4 cg+512444+384
+ADDRGP4 cgs+212724
+INDIRF4
+ASGNF4
+ADDRGP4 cg+512444+388
+ADDRGP4 cgs+212728
+INDIRF4
+ASGNF4
+ADDRGP4 cg+512444+436
+ADDRGP4 cgs+212732
+INDIRF4
+ASGNF4
+ADDRGP4 $1261
+JUMPV
+LABELV $1260
+ADDRGP4 cg+512444+368
+INDIRI4
+CNSTI4 0
+NEI4 $1286
+ADDRGP4 cg+512444+368
+ADDRGP4 cgs+212708
+INDIRI4
+ASGNI4
+ADDRGP4 cg+512444+384
+ADDRGP4 cgs+212724
+INDIRF4
+ASGNF4
+ADDRGP4 cg+512444+388
+ADDRGP4 cgs+212728
+INDIRF4
+ASGNF4
+ADDRGP4 cg+512444+436
+ADDRGP4 cgs+212732
+INDIRF4
+ASGNF4
+ADDRGP4 cg+512444+372
+ADDRGP4 cgs+212712
+INDIRB
+ASGNB 12
+LABELV $1286
+LABELV $1261
+LABELV $1245
+endproc CG_FogView 8 28
+export CG_DrawMiscGamemodels
+proc CG_DrawMiscGamemodels 248 12
+ADDRLP4 236
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 228
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 8+4
+CNSTI4 64
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1311
+JUMPV
+LABELV $1308
+CNSTI4 460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+212736+456
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1313
+ADDRLP4 240
+CNSTI4 460
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+ADDRGP4 cgs+212736+408
+ADDP4
+ARGP4
+ADDRLP4 240
+INDIRI4
+ADDRGP4 cgs+212736+456
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 244
+ADDRGP4 CG_CullPointAndRadius
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+EQI4 $1317
+ADDRGP4 $1309
+JUMPV
+LABELV $1317
+LABELV $1313
+ADDRGP4 cg+512444+24
+ARGP4
+CNSTI4 460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+212736+408
+ADDP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 trap_R_inPVS
+CALLI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 0
+NEI4 $1323
+ADDRGP4 $1309
+JUMPV
+LABELV $1323
+ADDRLP4 8+68
+CNSTI4 460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+212736+408
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8+88
+CNSTI4 460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+212736+408
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8+12
+CNSTI4 460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+212736+408
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1338
+ADDRLP4 244
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+ADDRLP4 8+28
+ADDP4
+ADDRLP4 244
+INDIRI4
+CNSTI4 460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+212736+420
+ADDP4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1339
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1338
+ADDRLP4 8+8
+CNSTI4 460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+212736
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 460
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+212736+4
+ADDP4
+ARGP4
+ADDRLP4 244
+ADDRGP4 CG_AddSkinToFrame
+CALLI4
+ASGNI4
+ADDRLP4 8+116
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 236
+ADDRLP4 236
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1309
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1311
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+515564
+INDIRI4
+LTI4 $1308
+LABELV $1305
+endproc CG_DrawMiscGamemodels 248 12
+export CG_DrawActive
+proc CG_DrawActive 4 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1351
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 $1350
+JUMPV
+LABELV $1351
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1354
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1354
+ADDRGP4 CG_DrawTourneyScoreboard
+CALLV
+pop
+ADDRGP4 $1350
+JUMPV
+LABELV $1354
+ADDRGP4 CG_TileClear
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1358
+ADDRGP4 CG_DrawCrosshair3D
+CALLV
+pop
+LABELV $1358
+ADDRGP4 CG_DrawThirdPersonCrosshair
+CALLV
+pop
+ADDRGP4 CG_PB_RenderPolyBuffers
+CALLV
+pop
+ADDRGP4 CG_DrawMiscGamemodels
+CALLV
+pop
+ADDRGP4 CG_FogView
+CALLV
+pop
+ADDRGP4 cg+512444+432
+ADDRGP4 cg+515600
+INDIRF4
+ASGNF4
+ADDRGP4 cg+512444
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_Draw2D
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawNotify
+CALLV
+pop
+LABELV $1350
+endproc CG_DrawActive 4 8
+export CG_DrawDemoRecording
+proc CG_DrawDemoRecording 1104 20
+ADDRLP4 1092
+ADDRGP4 trap_GetDemoState
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 2
+EQI4 $1365
+ADDRGP4 $1364
+JUMPV
+LABELV $1365
+ADDRGP4 cg_recordSPDemo+12
+INDIRI4
+CNSTI4 0
+EQI4 $1367
+ADDRGP4 $1364
+JUMPV
+LABELV $1367
+ADDRLP4 1024
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_GetDemoName
+CALLV
+pop
+ADDRLP4 1096
+ADDRGP4 trap_GetDemoPos
+CALLI4
+ASGNI4
+ADDRLP4 1088
+ADDRLP4 1096
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1100
+CNSTI4 1024
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+ARGI4
+ADDRGP4 $1370
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 1088
+INDIRI4
+ADDRLP4 1100
+INDIRI4
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 20
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 5122
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $1364
+endproc CG_DrawDemoRecording 1104 20
+export CG_DrawMessageMode
+proc CG_DrawMessageMode 8 24
+ADDRLP4 0
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $1372
+ADDRGP4 $1371
+JUMPV
+LABELV $1372
+CNSTI4 2
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+CNSTI4 8
+ARGI4
+CNSTI4 232
+ARGI4
+ADDRGP4 cg+517728
+ARGP4
+CNSTI4 4608
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+ADDRGP4 cg+517728
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_DrawStrlen
+CALLF4
+ASGNF4
+ADDRGP4 cg+517792
+ARGP4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+CVFI4 4
+ARGI4
+CNSTI4 232
+ARGI4
+CNSTI4 4608
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_MField_Draw
+CALLV
+pop
+LABELV $1371
+endproc CG_DrawMessageMode 8 24
+export CG_DrawScreen2D
+proc CG_DrawScreen2D 0 0
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1378
+ADDRGP4 $1377
+JUMPV
+LABELV $1378
+ADDRGP4 cg+24
+INDIRI4
+CNSTI4 0
+EQI4 $1381
+ADDRGP4 $1377
+JUMPV
+LABELV $1381
+ADDRGP4 cg_draw2D+12
+INDIRI4
+CNSTI4 0
+NEI4 $1384
+ADDRGP4 $1377
+JUMPV
+LABELV $1384
+ADDRGP4 CG_DrawWarmup
+CALLV
+pop
+ADDRGP4 cg+515628
+INDIRI4
+CNSTI4 0
+EQI4 $1387
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+pop
+ADDRGP4 $1388
+JUMPV
+LABELV $1387
+ADDRGP4 CG_DrawGlobalCenterString
+CALLV
+pop
+LABELV $1388
+ADDRGP4 CG_DrawDemoRecording
+CALLV
+pop
+ADDRGP4 CG_DrawMessageMode
+CALLV
+pop
+LABELV $1377
+endproc CG_DrawScreen2D 0 0
+bss
+export lagometer
+align 4
+LABELV lagometer
+skip 1544
+import cgDC
+import Controls_SetDefaults_ui_shared
+import Controls_SetConfig_ui_shared
+import Controls_GetConfig_ui_shared
+import UI_OutOfMemory
+import UI_InitMemory_ui_shared
+import UI_Alloc_ui_shared
+import Menu_FindItemByName
+import Display_ScriptExecutions
+import Display_DebugMode
+import Display_CacheAll
+import Menu_SetScreenPlacement
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_WantsBindKeys
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import Script_Compile
+import PC_CompiledScript_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_LoadVoiceChats
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+export teamChat2
+align 1
+LABELV teamChat2
+skip 256
+export teamChat1
+align 1
+LABELV teamChat1
+skip 256
+export systemChat
+align 1
+LABELV systemChat
+skip 256
+import drawTeamOverlayModificationCount
+export sortedTeamPlayersTime
+align 4
+LABELV sortedTeamPlayersTime
+skip 16
+export numSortedTeamPlayers
+align 4
+LABELV numSortedTeamPlayers
+skip 16
+export sortedTeamPlayers
+align 4
+LABELV sortedTeamPlayers
+skip 512
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_enableBreath
+import cg_enableDust
+import cg_blueTeamName
+import cg_redTeamName
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1370
+byte 1 82
+byte 1 69
+byte 1 67
+byte 1 79
+byte 1 82
+byte 1 68
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 107
+byte 1 0
+align 1
+LABELV $1201
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1166
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1160
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1139
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $1131
+byte 1 89
+byte 1 79
+byte 1 85
+byte 1 32
+byte 1 72
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 32
+byte 1 66
+byte 1 69
+byte 1 69
+byte 1 78
+byte 1 32
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 68
+byte 1 0
+align 1
+LABELV $1130
+byte 1 73
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 78
+byte 1 65
+byte 1 76
+byte 1 32
+byte 1 67
+byte 1 79
+byte 1 77
+byte 1 66
+byte 1 85
+byte 1 83
+byte 1 84
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 32
+byte 1 73
+byte 1 78
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1115
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 32
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 0
+align 1
+LABELV $1114
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 32
+byte 1 79
+byte 1 70
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $1097
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1092
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1089
+byte 1 99
+byte 1 0
+align 1
+LABELV $1088
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1085
+byte 1 108
+byte 1 0
+align 1
+LABELV $1082
+byte 1 97
+byte 1 0
+align 1
+LABELV $1081
+byte 1 65
+byte 1 73
+byte 1 32
+byte 1 78
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1013
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1012
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $957
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $932
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $929
+byte 1 89
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $927
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $926
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 0
+align 1
+LABELV $924
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $908
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 74
+byte 1 79
+byte 1 73
+byte 1 78
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $904
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $900
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $657
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 111
+byte 1 83
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $656
+byte 1 114
+byte 1 95
+byte 1 122
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 0
+align 1
+LABELV $556
+byte 1 86
+byte 1 111
+byte 1 73
+byte 1 80
+byte 1 58
+byte 1 32
+byte 1 91
+byte 1 37
+byte 1 115
+byte 1 93
+byte 1 0
+align 1
+LABELV $536
+byte 1 115
+byte 1 110
+byte 1 99
+byte 1 0
+align 1
+LABELV $471
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $467
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $435
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $349
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 0
+align 1
+LABELV $348
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $292
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $278
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $271
+byte 1 0
+align 1
+LABELV $270
+byte 1 48
+byte 1 0
+align 1
+LABELV $269
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $263
+byte 1 37
+byte 1 105
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $244
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $239
+byte 1 110
+byte 1 0
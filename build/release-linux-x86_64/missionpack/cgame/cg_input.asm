@@ -0,0 +1,4891 @@
+export IN_MLookDown
+code
+proc IN_MLookDown 0 0
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+1296
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $98
+endproc IN_MLookDown 0 0
+export IN_MLookUp
+proc IN_MLookUp 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+1296
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_freelook+12
+INDIRI4
+CNSTI4 0
+NEI4 $102
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 IN_CenterView
+CALLV
+pop
+LABELV $102
+LABELV $100
+endproc IN_MLookUp 0 4
+export IN_KeyDown
+proc IN_KeyDown 76 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $106
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $107
+JUMPV
+LABELV $106
+ADDRLP4 28
+CNSTI4 -1
+ASGNI4
+LABELV $107
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+EQI4 $110
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+NEI4 $108
+LABELV $110
+ADDRGP4 $105
+JUMPV
+LABELV $108
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $112
+ADDRLP4 0
+ARGP4
+ADDRLP4 48
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $113
+JUMPV
+LABELV $112
+ADDRLP4 44
+CNSTI4 -1
+ASGNI4
+LABELV $113
+ADDRLP4 20
+ADDRLP4 44
+INDIRI4
+ASGNI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $117
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+GEI4 $117
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 16
+LTI4 $114
+LABELV $117
+ADDRLP4 20
+CNSTI4 -1
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $114
+CNSTI4 0
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 Com_LocalPlayerForCvarName
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $118
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 CL_AxisFraction
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRGP4 $119
+JUMPV
+LABELV $118
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $120
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 CL_AxisFraction
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRGP4 $121
+JUMPV
+LABELV $120
+ADDRGP4 $122
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $105
+JUMPV
+LABELV $121
+LABELV $119
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $123
+ADDRGP4 $105
+JUMPV
+LABELV $123
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 72
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $105
+endproc IN_KeyDown 76 12
+export IN_KeyUp
+proc IN_KeyUp 48 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $126
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $125
+JUMPV
+LABELV $127
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $128
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $129
+JUMPV
+LABELV $128
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $125
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $131
+LABELV $129
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $134
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $132
+LABELV $134
+ADDRGP4 $125
+JUMPV
+LABELV $132
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 36
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 20
+INDIRU4
+CNSTU4 0
+EQU4 $135
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+ADDRLP4 20
+INDIRU4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+SUBU4
+ADDU4
+ASGNU4
+ADDRGP4 $136
+JUMPV
+LABELV $135
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+ADDRGP4 in_frameMsec
+INDIRU4
+CNSTI4 1
+RSHU4
+ADDU4
+ASGNU4
+LABELV $136
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $125
+endproc IN_KeyUp 48 12
+export CL_AxisFraction
+proc CL_AxisFraction 32 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $141
+CNSTI4 272
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_joystickUseAnalog+12
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $138
+LABELV $141
+CNSTF4 1065353216
+RETF4
+ADDRGP4 $137
+JUMPV
+LABELV $138
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $142
+ADDRLP4 0
+ADDRFP4 8
+INDIRI4
+NEGI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $143
+JUMPV
+LABELV $142
+ADDRLP4 0
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $143
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $150
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $151
+JUMPV
+LABELV $150
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $151
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 39084
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+531852+34488
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $152
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $153
+JUMPV
+LABELV $152
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $153
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $144
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $154
+ARGP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $145
+JUMPV
+LABELV $144
+ADDRLP4 20
+CNSTF4 1191181824
+CNSTI4 272
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_joystickThreshold+8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 39084
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+531852+34488
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+SUBF4
+CNSTF4 1191181824
+ADDRLP4 28
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+LABELV $145
+ADDRLP4 4
+INDIRF4
+RETF4
+LABELV $137
+endproc CL_AxisFraction 32 16
+export CL_KeyStateSeparate
+proc CL_KeyStateSeparate 52 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+531852
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 39084
+DIVI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTU4 0
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $160
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+CNSTU4 0
+NEU4 $162
+ADDRLP4 28
+ADDRGP4 in_frameTime
+INDIRI4
+ASGNI4
+ADDRGP4 $163
+JUMPV
+LABELV $162
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CVIU4 4
+ADDRGP4 in_frameTime
+INDIRI4
+CVIU4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU4
+SUBU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $163
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 in_frameTime
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $164
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $168
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 CL_AxisFraction
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 $169
+JUMPV
+LABELV $168
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $169
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $165
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $164
+ADDRGP4 $161
+JUMPV
+LABELV $160
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $161
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $171
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $175
+CNSTI4 272
+ADDRLP4 40
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_joystickUseAnalog+12
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $175
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $176
+JUMPV
+LABELV $175
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $176
+LABELV $172
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $171
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+LEF4 $178
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $178
+ADDRLP4 12
+INDIRF4
+CNSTF4 1065353216
+LEF4 $180
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+LABELV $180
+ADDRLP4 40
+ADDRGP4 in_frameMsec
+INDIRU4
+ASGNU4
+ADDRLP4 24
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+ADDRLP4 40
+INDIRU4
+CNSTI4 1
+RSHU4
+CVUI4 4
+CVIF4 4
+MULF4
+ADDRLP4 40
+INDIRU4
+CNSTU4 1
+BANDU4
+CVUI4 4
+CVIF4 4
+ADDF4
+DIVF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+LABELV $158
+endproc CL_KeyStateSeparate 52 12
+export CL_KeyState
+proc CL_KeyState 12 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CL_KeyStateSeparate
+CALLV
+pop
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+RETF4
+LABELV $182
+endproc CL_KeyState 12 16
+export IN_UpDown
+proc IN_UpDown 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+480
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $183
+endproc IN_UpDown 0 4
+export IN_UpUp
+proc IN_UpUp 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+480
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $185
+endproc IN_UpUp 0 4
+export IN_DownDown
+proc IN_DownDown 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+528
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $187
+endproc IN_DownDown 0 4
+export IN_DownUp
+proc IN_DownUp 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+528
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $189
+endproc IN_DownUp 0 4
+export IN_LeftDown
+proc IN_LeftDown 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $191
+endproc IN_LeftDown 0 4
+export IN_LeftUp
+proc IN_LeftUp 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $192
+endproc IN_LeftUp 0 4
+export IN_RightDown
+proc IN_RightDown 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+48
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $193
+endproc IN_RightDown 0 4
+export IN_RightUp
+proc IN_RightUp 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+48
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $195
+endproc IN_RightUp 0 4
+export IN_ForwardDown
+proc IN_ForwardDown 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+96
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $197
+endproc IN_ForwardDown 0 4
+export IN_ForwardUp
+proc IN_ForwardUp 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+96
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $199
+endproc IN_ForwardUp 0 4
+export IN_BackDown
+proc IN_BackDown 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+144
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $201
+endproc IN_BackDown 0 4
+export IN_BackUp
+proc IN_BackUp 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+144
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $203
+endproc IN_BackUp 0 4
+export IN_LookupDown
+proc IN_LookupDown 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+192
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $205
+endproc IN_LookupDown 0 4
+export IN_LookupUp
+proc IN_LookupUp 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+192
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $207
+endproc IN_LookupUp 0 4
+export IN_LookdownDown
+proc IN_LookdownDown 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+240
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $209
+endproc IN_LookdownDown 0 4
+export IN_LookdownUp
+proc IN_LookdownUp 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+240
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $211
+endproc IN_LookdownUp 0 4
+export IN_MoveleftDown
+proc IN_MoveleftDown 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+288
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $213
+endproc IN_MoveleftDown 0 4
+export IN_MoveleftUp
+proc IN_MoveleftUp 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+288
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $215
+endproc IN_MoveleftUp 0 4
+export IN_MoverightDown
+proc IN_MoverightDown 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+336
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $217
+endproc IN_MoverightDown 0 4
+export IN_MoverightUp
+proc IN_MoverightUp 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+336
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $219
+endproc IN_MoverightUp 0 4
+export IN_SpeedDown
+proc IN_SpeedDown 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+432
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $221
+endproc IN_SpeedDown 0 4
+export IN_SpeedUp
+proc IN_SpeedUp 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+432
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $223
+endproc IN_SpeedUp 0 4
+export IN_StrafeDown
+proc IN_StrafeDown 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+384
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $225
+endproc IN_StrafeDown 0 4
+export IN_StrafeUp
+proc IN_StrafeUp 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+384
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $227
+endproc IN_StrafeUp 0 4
+export IN_Button0Down
+proc IN_Button0Down 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $229
+endproc IN_Button0Down 0 4
+export IN_Button0Up
+proc IN_Button0Up 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $231
+endproc IN_Button0Up 0 4
+export IN_Button1Down
+proc IN_Button1Down 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+48
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $233
+endproc IN_Button1Down 0 4
+export IN_Button1Up
+proc IN_Button1Up 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+48
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $236
+endproc IN_Button1Up 0 4
+export IN_Button2Down
+proc IN_Button2Down 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+96
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $239
+endproc IN_Button2Down 0 4
+export IN_Button2Up
+proc IN_Button2Up 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+96
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $242
+endproc IN_Button2Up 0 4
+export IN_Button3Down
+proc IN_Button3Down 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+144
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $245
+endproc IN_Button3Down 0 4
+export IN_Button3Up
+proc IN_Button3Up 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+144
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $248
+endproc IN_Button3Up 0 4
+export IN_Button4Down
+proc IN_Button4Down 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+192
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $251
+endproc IN_Button4Down 0 4
+export IN_Button4Up
+proc IN_Button4Up 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+192
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $254
+endproc IN_Button4Up 0 4
+export IN_Button5Down
+proc IN_Button5Down 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+240
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $257
+endproc IN_Button5Down 0 4
+export IN_Button5Up
+proc IN_Button5Up 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+240
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $260
+endproc IN_Button5Up 0 4
+export IN_Button6Down
+proc IN_Button6Down 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+288
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $263
+endproc IN_Button6Down 0 4
+export IN_Button6Up
+proc IN_Button6Up 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+288
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $266
+endproc IN_Button6Up 0 4
+export IN_Button7Down
+proc IN_Button7Down 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+336
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $269
+endproc IN_Button7Down 0 4
+export IN_Button7Up
+proc IN_Button7Up 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+336
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $272
+endproc IN_Button7Up 0 4
+export IN_Button8Down
+proc IN_Button8Down 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+384
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $275
+endproc IN_Button8Down 0 4
+export IN_Button8Up
+proc IN_Button8Up 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+384
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $278
+endproc IN_Button8Up 0 4
+export IN_Button9Down
+proc IN_Button9Down 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+432
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $281
+endproc IN_Button9Down 0 4
+export IN_Button9Up
+proc IN_Button9Up 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+432
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $284
+endproc IN_Button9Up 0 4
+export IN_Button10Down
+proc IN_Button10Down 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+480
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $287
+endproc IN_Button10Down 0 4
+export IN_Button10Up
+proc IN_Button10Up 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+480
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $290
+endproc IN_Button10Up 0 4
+export IN_Button11Down
+proc IN_Button11Down 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+528
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $293
+endproc IN_Button11Down 0 4
+export IN_Button11Up
+proc IN_Button11Up 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+528
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $296
+endproc IN_Button11Up 0 4
+export IN_Button12Down
+proc IN_Button12Down 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+576
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $299
+endproc IN_Button12Down 0 4
+export IN_Button12Up
+proc IN_Button12Up 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+576
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $302
+endproc IN_Button12Up 0 4
+export IN_Button13Down
+proc IN_Button13Down 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+624
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $305
+endproc IN_Button13Down 0 4
+export IN_Button13Up
+proc IN_Button13Up 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+624
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $308
+endproc IN_Button13Up 0 4
+export IN_Button14Down
+proc IN_Button14Down 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+672
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyDown
+CALLV
+pop
+LABELV $311
+endproc IN_Button14Down 0 4
+export IN_Button14Up
+proc IN_Button14Up 0 4
+CNSTI4 1300
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cis+576+672
+ADDP4
+ARGP4
+ADDRGP4 IN_KeyUp
+CALLV
+pop
+LABELV $314
+endproc IN_Button14Up 0 4
+export IN_CenterView
+proc IN_CenterView 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $322
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $318
+LABELV $322
+ADDRGP4 $317
+JUMPV
+LABELV $318
+ADDRLP4 0
+CNSTI4 500
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+ASGNP4
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852+34572
+ADDP4
+CNSTF4 1001652224
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+NEGF4
+ASGNF4
+LABELV $317
+endproc IN_CenterView 8 0
+export CG_AdjustAngles
+proc CG_AdjustAngles 32 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+531852
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 39084
+DIVI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $328
+ADDRLP4 4
+CNSTF4 981668463
+ADDRGP4 cg+512316
+INDIRI4
+CVIF4 4
+MULF4
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_anglespeedkey+8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $329
+JUMPV
+LABELV $328
+ADDRLP4 4
+CNSTF4 981668463
+ADDRGP4 cg+512316
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+LABELV $329
+ADDRFP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $333
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CL_KeyStateSeparate
+CALLV
+pop
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 34576
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_yawspeed+8
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 34576
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_yawspeedanalog+8
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 12
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CL_KeyStateSeparate
+CALLV
+pop
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 34576
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_yawspeed+8
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 34576
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_yawspeedanalog+8
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $333
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CL_KeyStateSeparate
+CALLV
+pop
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 34572
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_pitchspeed+8
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 34572
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_pitchspeedanalog+8
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 12
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 240
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CL_KeyStateSeparate
+CALLV
+pop
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 34572
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_pitchspeed+8
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 34572
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_pitchspeedanalog+8
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $326
+endproc CG_AdjustAngles 32 16
+export CG_KeyMove
+proc CG_KeyMove 60 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+CNSTI4 272
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 cis
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1300
+DIVI4
+MULI4
+ADDRGP4 cg_run+12
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 0
+EQI4 $344
+ADDRLP4 0
+CNSTI4 127
+ASGNI4
+ADDRLP4 20
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+ADDRGP4 $345
+JUMPV
+LABELV $344
+ADDRLP4 20
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 64
+ASGNI4
+LABELV $345
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $347
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CL_KeyState
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CL_KeyState
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+MULF4
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $347
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 336
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CL_KeyState
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 288
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CL_KeyState
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+MULF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 480
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 CL_KeyState
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 528
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 CL_KeyState
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 36
+INDIRF4
+MULF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 CL_KeyState
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 CL_KeyState
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 44
+INDIRF4
+MULF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 ClampChar
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 48
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 ClampChar
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 25
+ADDP4
+ADDRLP4 52
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 ClampChar
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 26
+ADDP4
+ADDRLP4 56
+INDIRI4
+CVII1 4
+ASGNI1
+LABELV $343
+endproc CG_KeyMove 60 8
+export CG_MouseMove
+proc CG_MouseMove 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 35848
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $350
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+CNSTI4 25
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ADDRGP4 m_side+8
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 8
+ADDRGP4 ClampChar
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 34576
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 m_yaw+8
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $351
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1296
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $357
+ADDRGP4 cg_freelook+12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $354
+LABELV $357
+ADDRFP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $354
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 34572
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 m_pitch+8
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $355
+JUMPV
+LABELV $354
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ADDRGP4 m_forward+8
+INDIRF4
+ADDRFP4 16
+INDIRF4
+MULF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+ADDRGP4 ClampChar
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRI4
+CVII1 4
+ASGNI1
+LABELV $355
+LABELV $349
+endproc CG_MouseMove 24 4
+export CG_CmdButtons
+proc CG_CmdButtons 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $361
+ADDRLP4 4
+CNSTI4 48
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $367
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $365
+LABELV $367
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+LABELV $365
+CNSTI4 48
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+ADDP4
+CNSTI4 36
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $362
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $361
+ADDRLP4 4
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $368
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+ADDRGP4 $369
+JUMPV
+LABELV $368
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $370
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32768
+BORI4
+ASGNI4
+LABELV $370
+LABELV $369
+LABELV $360
+endproc CG_CmdButtons 16 0
+export CG_FinishMove
+proc CG_FinishMove 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 34568
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BG_ComposeUserCmdValue
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $373
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+CNSTF4 1199570944
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 34572
+ADDP4
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ASGNI4
+LABELV $374
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $373
+LABELV $372
+endproc CG_FinishMove 12 4
+bss
+align 4
+LABELV $378
+skip 28
+export CG_CreateUserCmd
+code
+proc CG_CreateUserCmd 28 20
+ADDRGP4 in_frameTime
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 in_frameMsec
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRLP4 20
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 39084
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 1300
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRGP4 cis
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 34572
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_AdjustAngles
+CALLV
+pop
+ADDRGP4 $378
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 28
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $378
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_CmdButtons
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $378
+ARGP4
+ADDRGP4 CG_KeyMove
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $378
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRGP4 CG_MouseMove
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 34572
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+CNSTF4 1119092736
+LEF4 $380
+ADDRLP4 0
+INDIRP4
+CNSTI4 34572
+ADDP4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRGP4 $381
+JUMPV
+LABELV $380
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 34572
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1119092736
+LEF4 $382
+ADDRLP4 0
+INDIRP4
+CNSTI4 34572
+ADDP4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1119092736
+SUBF4
+ASGNF4
+LABELV $382
+LABELV $381
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $378
+ARGP4
+ADDRGP4 CG_FinishMove
+CALLV
+pop
+ADDRGP4 $378
+RETP4
+LABELV $377
+endproc CG_CreateUserCmd 28 20
+export CG_RegisterInputCvars
+proc CG_RegisterInputCvars 36 16
+ADDRGP4 cg_freelook
+ARGP4
+ADDRGP4 $385
+ARGP4
+ADDRGP4 $386
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 m_pitch
+ARGP4
+ADDRGP4 $387
+ARGP4
+ADDRGP4 $388
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 m_yaw
+ARGP4
+ADDRGP4 $389
+ARGP4
+ADDRGP4 $388
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 m_forward
+ARGP4
+ADDRGP4 $390
+ARGP4
+ADDRGP4 $391
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 m_side
+ARGP4
+ADDRGP4 $392
+ARGP4
+ADDRGP4 $391
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $396
+JUMPV
+LABELV $393
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $397
+ARGP4
+ADDRLP4 4
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_yawspeed
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $398
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $399
+ARGP4
+ADDRLP4 8
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_pitchspeed
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $398
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $400
+ARGP4
+ADDRLP4 12
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_yawspeedanalog
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $401
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $402
+ARGP4
+ADDRLP4 16
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_pitchspeedanalog
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $401
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $403
+ARGP4
+ADDRLP4 20
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_anglespeedkey
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $404
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $405
+ARGP4
+ADDRLP4 24
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_run
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 $386
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $406
+ARGP4
+ADDRLP4 28
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_joystickUseAnalog
+ADDP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $386
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $407
+ARGP4
+ADDRLP4 32
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_joystickThreshold
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 $408
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $394
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $396
+ADDRLP4 4
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $393
+LABELV $384
+endproc CG_RegisterInputCvars 36 16
+export CG_UpdateInputCvars
+proc CG_UpdateInputCvars 8 4
+ADDRGP4 cg_freelook
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 m_pitch
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 m_yaw
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 m_forward
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 m_side
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $413
+JUMPV
+LABELV $410
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_yawspeed
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_pitchspeed
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_yawspeedanalog
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_pitchspeedanalog
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_anglespeedkey
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_run
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_joystickUseAnalog
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_joystickThreshold
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $411
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $413
+ADDRLP4 4
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $410
+LABELV $409
+endproc CG_UpdateInputCvars 8 4
+bss
+export cis
+align 4
+LABELV cis
+skip 5200
+export cg_joystickThreshold
+align 4
+LABELV cg_joystickThreshold
+skip 1088
+export cg_joystickUseAnalog
+align 4
+LABELV cg_joystickUseAnalog
+skip 1088
+export cg_run
+align 4
+LABELV cg_run
+skip 1088
+export cg_anglespeedkey
+align 4
+LABELV cg_anglespeedkey
+skip 1088
+export cg_pitchspeedanalog
+align 4
+LABELV cg_pitchspeedanalog
+skip 1088
+export cg_yawspeedanalog
+align 4
+LABELV cg_yawspeedanalog
+skip 1088
+export cg_pitchspeed
+align 4
+LABELV cg_pitchspeed
+skip 1088
+export cg_yawspeed
+align 4
+LABELV cg_yawspeed
+skip 1088
+export m_side
+align 4
+LABELV m_side
+skip 272
+export m_forward
+align 4
+LABELV m_forward
+skip 272
+export m_yaw
+align 4
+LABELV m_yaw
+skip 272
+export m_pitch
+align 4
+LABELV m_pitch
+skip 272
+export cg_freelook
+align 4
+LABELV cg_freelook
+skip 272
+export in_frameTime
+align 4
+LABELV in_frameTime
+skip 4
+export in_frameMsec
+align 4
+LABELV in_frameMsec
+skip 4
+import CG_DrawBBox
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_LoadVoiceChats
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_enableBreath
+import cg_enableDust
+import cg_blueTeamName
+import cg_redTeamName
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $408
+byte 1 48
+byte 1 46
+byte 1 49
+byte 1 53
+byte 1 0
+align 1
+LABELV $407
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 84
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 0
+align 1
+LABELV $406
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 65
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $405
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $404
+byte 1 49
+byte 1 46
+byte 1 53
+byte 1 0
+align 1
+LABELV $403
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $402
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $401
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $400
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $399
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $398
+byte 1 49
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $397
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $392
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $391
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 53
+byte 1 0
+align 1
+LABELV $390
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $389
+byte 1 109
+byte 1 95
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 0
+align 1
+LABELV $388
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 50
+byte 1 50
+byte 1 0
+align 1
+LABELV $387
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $386
+byte 1 49
+byte 1 0
+align 1
+LABELV $385
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $154
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 67
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 97
+byte 1 120
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 120
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 48
+byte 1 44
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $122
+byte 1 84
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 33
+byte 1 10
+byte 1 0
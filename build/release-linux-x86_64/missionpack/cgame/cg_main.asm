@@ -0,0 +1,29206 @@
+data
+export forceModelModificationCount
+align 4
+LABELV forceModelModificationCount
+byte 4 -1
+export redTeamNameModificationCount
+align 4
+LABELV redTeamNameModificationCount
+byte 4 -1
+export blueTeamNameModificationCount
+align 4
+LABELV blueTeamNameModificationCount
+byte 4 -1
+export vmMain
+code
+proc vmMain 56 28
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 100
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $108
+ADDRLP4 0
+INDIRI4
+CNSTI4 101
+EQI4 $110
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $106
+LABELV $140
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 200
+LTI4 $106
+ADDRLP4 8
+INDIRI4
+CNSTI4 221
+GTI4 $106
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $141-800
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $141
+address $111
+address $112
+address $113
+address $114
+address $115
+address $116
+address $117
+address $118
+address $119
+address $120
+address $121
+address $131
+address $132
+address $133
+address $125
+address $126
+address $127
+address $134
+address $135
+address $136
+address $137
+address $138
+code
+LABELV $108
+ADDRGP4 $109
+CVPU4 4
+CVUI4 4
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $110
+CNSTI4 65536
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $111
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Init
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $112
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRGP4 CG_Ingame_Init
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $113
+ADDRGP4 UI_Shutdown
+CALLV
+pop
+ADDRGP4 CG_Shutdown
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $114
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_ConsoleCommand
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $115
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_Refresh
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $116
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $117
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $118
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_VoIPString
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CVUI4 4
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $119
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRFP4 16
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $120
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_DistributeCharEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $121
+ADDRGP4 cg+4
+INDIRI4
+CNSTI4 0
+EQI4 $122
+ADDRLP4 28
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $122
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_MouseEvent
+CALLV
+pop
+ADDRGP4 $123
+JUMPV
+LABELV $122
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_MouseEvent
+CALLV
+pop
+LABELV $123
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $125
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_MousePosition
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $126
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetMousePosition
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $127
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_SetActiveMenu
+CALLV
+pop
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $128
+ADDRGP4 cg+12
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $128
+ADDRGP4 CG_StopCinematic_f
+CALLV
+pop
+LABELV $128
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $131
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_JoystickAxisEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $132
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_JoystickButtonEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $133
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_JoystickHatEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $134
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddNotifyText
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $135
+ADDRGP4 CG_CloseConsole
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $136
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 IntAsFloat
+CALLF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 IntAsFloat
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_CreateUserCmd
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CVUI4 4
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $137
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_UpdateGlconfig
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $138
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_ConsoleCompleteArgument
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $106
+ADDRGP4 $139
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $107
+CNSTI4 -1
+RETI4
+LABELV $105
+endproc vmMain 56 28
+data
+align 4
+LABELV cgameCvarTable
+byte 4 0
+address $145
+address $146
+byte 4 64
+byte 4 0
+byte 4 0
+byte 4 0
+address con_conspeed
+address $147
+address $148
+byte 4 0
+byte 4 1036831949
+byte 4 1120403456
+byte 4 0
+address con_autochat
+address $149
+address $150
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address con_autoclear
+address $151
+address $150
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_dedicated
+address $152
+address $150
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_ignore
+address $153
+address $150
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_zoomFov
+address $154
+address $155
+byte 4 1
+byte 4 1065353216
+byte 4 1126170624
+byte 4 0
+address cg_fov
+address $156
+address $157
+byte 4 1
+byte 4 1065353216
+byte 4 1126170624
+byte 4 0
+address cg_weaponFov
+address $158
+address $157
+byte 4 1
+byte 4 0
+byte 4 1126170624
+byte 4 0
+address cg_viewsize
+address $159
+address $160
+byte 4 1
+byte 4 1106247680
+byte 4 1120403456
+byte 4 1
+address cg_shadows
+address $161
+address $162
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_gibs
+address $163
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_draw2D
+address $164
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawStatus
+address $165
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawTimer
+address $166
+address $150
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawFPS
+address $167
+address $150
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawSnapshot
+address $168
+address $150
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_draw3dIcons
+address $169
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawIcons
+address $170
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawAmmoWarning
+address $171
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawAttacker
+address $172
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawCrosshair
+address $173
+address $174
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_drawCrosshairNames
+address $175
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawRewards
+address $176
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawLagometer
+address $177
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_crosshairSize
+address $178
+address $179
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_crosshairHealth
+address $180
+address $150
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_crosshairX
+address $181
+address $150
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_crosshairY
+address $182
+address $150
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_brassTime
+address $183
+address $184
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_simpleItems
+address $185
+address $150
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_addMarks
+address $186
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_railTrailTime
+address $187
+address $188
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_gun_x
+address $189
+address $150
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_gun_y
+address $190
+address $150
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_gun_z
+address $191
+address $150
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_centertime
+address $192
+address $148
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_viewbob
+address $193
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_viewkick
+address $194
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_runpitch
+address $195
+address $196
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_runroll
+address $197
+address $198
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_bobup
+address $199
+address $198
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_bobpitch
+address $200
+address $196
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_bobroll
+address $201
+address $196
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_swingSpeed
+address $202
+address $203
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_animSpeed
+address $204
+address $162
+byte 4 512
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_debugAnim
+address $205
+address $150
+byte 4 512
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_debugPosition
+address $206
+address $150
+byte 4 512
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_debugEvents
+address $207
+address $150
+byte 4 512
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_errorDecay
+address $208
+address $160
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_nopredict
+address $209
+address $150
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_noPlayerAnims
+address $210
+address $150
+byte 4 512
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_showmiss
+address $211
+address $150
+byte 4 0
+byte 4 0
+byte 4 1073741824
+byte 4 1
+address cg_optimizePrediction
+address $212
+address $162
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_showTraceTests
+address $213
+address $150
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_showPolyBuffers
+address $214
+address $150
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_footsteps
+address $215
+address $162
+byte 4 512
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_tracerChance
+address $216
+address $217
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_tracerWidth
+address $218
+address $162
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_tracerLength
+address $219
+address $160
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_splitviewVertical
+address $220
+address $150
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_splitviewThirdEqual
+address $221
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_splitviewTextScale
+address $222
+address $223
+byte 4 1
+byte 4 1036831949
+byte 4 1084227584
+byte 4 0
+address cg_hudTextScale
+address $224
+address $162
+byte 4 1
+byte 4 1036831949
+byte 4 1084227584
+byte 4 0
+address cg_forceModel
+address $225
+address $150
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_predictItems
+address $226
+address $162
+byte 4 114691
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_deferPlayers
+address $227
+address $150
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawTeamOverlay
+address $228
+address $150
+byte 4 1
+byte 4 0
+byte 4 1077936128
+byte 4 1
+address cg_teamOverlayUserinfo
+address $229
+address $162
+byte 4 114754
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_stats
+address $230
+address $150
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_drawFriend
+address $231
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_teamChatsOnly
+address $232
+address $150
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_noVoiceChats
+address $233
+address $150
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_noVoiceText
+address $234
+address $150
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_buildScript
+address $235
+address $150
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_paused
+address $236
+address $150
+byte 4 64
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_blood
+address $237
+address $162
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address $238
+address $150
+byte 4 38
+byte 4 0
+byte 4 1088421888
+byte 4 1
+address cg_synchronousClients
+address $239
+address $150
+byte 4 8
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_singlePlayer
+address $240
+address $150
+byte 4 72
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_redTeamName
+address $241
+address $242
+byte 4 9
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_blueTeamName
+address $243
+address $244
+byte 4 9
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_enableDust
+address $245
+address $150
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_enableBreath
+address $246
+address $150
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_recordSPDemo
+address $247
+address $150
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_recordSPDemoName
+address $248
+address $249
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_obeliskRespawnDelay
+address $250
+address $251
+byte 4 8
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_hudFiles
+address $252
+address $253
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_timescaleFadeEnd
+address $254
+address $162
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_timescaleFadeSpeed
+address $255
+address $150
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_timescale
+address $256
+address $162
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_scorePlum
+address $257
+address $162
+byte 4 3
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_smoothClients
+address $258
+address $150
+byte 4 3
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_cameraMode
+address $259
+address $150
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address pmove_overbounce
+address $260
+address $150
+byte 4 8
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address pmove_fixed
+address $261
+address $150
+byte 4 8
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address pmove_msec
+address $262
+address $263
+byte 4 8
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_smallFont
+address $264
+address $265
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_bigFont
+address $266
+address $217
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_noTaunt
+address $267
+address $150
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_noProjectileTrail
+address $268
+address $150
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_oldRail
+address $269
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_oldRocket
+address $270
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_oldPlasma
+address $271
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_trueLightning
+address $272
+address $273
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_railWidth
+address $274
+address $275
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_railCoreWidth
+address $276
+address $277
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_railSegmentLength
+address $278
+address $279
+byte 4 1
+byte 4 1065353216
+byte 4 1148846080
+byte 4 0
+address cg_atmosphericEffects
+address $280
+address $162
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_teamDmLeadAnnouncements
+address $281
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_voipShowMeter
+address $282
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_voipShowCrosshairMeter
+address $283
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_consoleLatency
+address $284
+address $285
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_drawShaderInfo
+address $286
+address $150
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_coronafardist
+address $287
+address $288
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_coronas
+address $289
+address $162
+byte 4 1
+byte 4 0
+byte 4 1077936128
+byte 4 1
+address cg_fovAspectAdjust
+address $290
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_fadeExplosions
+address $291
+address $150
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_skybox
+address $292
+address $162
+byte 4 1
+byte 4 0
+byte 4 1073741824
+byte 4 1
+address cg_drawPickupItems
+address $293
+address $150
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_oldBubbles
+address $294
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_smoothBodySink
+address $295
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_antiLag
+address $296
+address $150
+byte 4 114691
+byte 4 0
+byte 4 1073741824
+byte 4 1
+address cg_forceBitmapFonts
+address $297
+address $150
+byte 4 33
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawGrappleHook
+address $298
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawBBox
+address $299
+address $150
+byte 4 512
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_consoleFont
+address $300
+address $301
+byte 4 33
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_consoleFontSize
+address $302
+address $263
+byte 4 33
+byte 4 1082130432
+byte 4 1103101952
+byte 4 1
+address cg_hudFont
+address $303
+address $304
+byte 4 33
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_hudFontBorder
+address $305
+address $223
+byte 4 33
+byte 4 0
+byte 4 1092616192
+byte 4 0
+address cg_numberFont
+address $306
+address $249
+byte 4 33
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_numberFontBorder
+address $307
+address $150
+byte 4 33
+byte 4 0
+byte 4 1092616192
+byte 4 0
+address cg_defaultModelGender
+address $308
+address $309
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_defaultMaleModel
+address $310
+address $311
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_defaultMaleHeadModel
+address $312
+address $311
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_defaultFemaleModel
+address $313
+address $314
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_defaultFemaleHeadModel
+address $315
+address $314
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_defaultTeamModelGender
+address $316
+address $309
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_defaultMaleTeamModel
+address $317
+address $318
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_defaultMaleTeamHeadModel
+address $319
+address $320
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_defaultFemaleTeamModel
+address $321
+address $322
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_defaultFemaleTeamHeadModel
+address $323
+address $324
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_introPlayed
+address $325
+address $150
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_joystickDebug
+address $326
+address $150
+byte 4 256
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address ui_stretch
+address $327
+address $150
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+align 4
+LABELV userCvarTable
+address cg_color1
+address $328
+address $174
+byte 4 3
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_color2
+address $329
+address $330
+byte 4 3
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_handicap
+address $331
+address $160
+byte 4 3
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_teamtask
+address $332
+address $150
+byte 4 2
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_teampref
+address $333
+address $249
+byte 4 2
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_autoswitch
+address $334
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_cyclePastGauntlet
+address $335
+address $162
+byte 4 1
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_drawGun
+address $336
+address $162
+byte 4 1
+byte 4 0
+byte 4 1077936128
+byte 4 1
+address cg_thirdPerson
+address $337
+address $150
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1
+address cg_thirdPersonRange
+address $338
+address $339
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_thirdPersonAngle
+address $340
+address $150
+byte 4 512
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_thirdPersonHeight
+address $341
+address $179
+byte 4 0
+byte 4 0
+byte 4 1107296256
+byte 4 1
+address cg_thirdPersonSmooth
+address $342
+address $150
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_currentSelectedPlayer
+address $343
+address $150
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+address cg_currentSelectedPlayerName
+address $344
+address $249
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+align 4
+LABELV cgameCvarTableSize
+byte 4 145
+align 4
+LABELV userCvarTableSize
+byte 4 15
+export CG_RegisterCvar
+code
+proc CG_RegisterCvar 4 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+NEF4 $348
+ADDRFP4 20
+INDIRF4
+ADDRLP4 0
+INDIRF4
+EQF4 $346
+LABELV $348
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_CheckRange
+CALLV
+pop
+LABELV $346
+LABELV $345
+endproc CG_RegisterCvar 4 16
+export CG_RegisterCgameCvars
+proc CG_RegisterCgameCvars 12 28
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgameCvarTable
+ASGNP4
+ADDRGP4 $353
+JUMPV
+LABELV $350
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterCvar
+CALLV
+pop
+LABELV $351
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+LABELV $353
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgameCvarTableSize
+INDIRI4
+LTI4 $350
+LABELV $349
+endproc CG_RegisterCgameCvars 12 28
+lit
+align 4
+LABELV $355
+byte 4 2
+byte 4 16384
+byte 4 32768
+byte 4 65536
+align 4
+LABELV $356
+address $311
+address $357
+address $314
+address $358
+align 4
+LABELV $359
+address $311
+address $357
+address $314
+address $358
+align 4
+LABELV $360
+address $318
+address $322
+address $318
+address $322
+align 4
+LABELV $361
+address $320
+address $324
+address $320
+address $324
+export CG_RegisterUserCvars
+code
+proc CG_RegisterUserCvars 140 28
+ADDRLP4 20
+ADDRGP4 $355
+INDIRB
+ASGNB 16
+ADDRLP4 40
+ADDRGP4 $356
+INDIRB
+ASGNB 16
+ADDRLP4 56
+ADDRGP4 $359
+INDIRB
+ASGNB 16
+ADDRLP4 72
+ADDRGP4 $360
+INDIRB
+ASGNB 16
+ADDRLP4 88
+ADDRGP4 $361
+INDIRB
+ASGNB 16
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 userCvarTable
+ASGNP4
+ADDRGP4 $365
+JUMPV
+LABELV $362
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $369
+JUMPV
+LABELV $366
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $370
+ADDRLP4 12
+CNSTI4 272
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $371
+JUMPV
+LABELV $370
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+LABELV $371
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $372
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+BORI4
+ASGNI4
+LABELV $372
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterCvar
+CALLV
+pop
+LABELV $367
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $369
+ADDRLP4 104
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+LTI4 $366
+LABELV $363
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+LABELV $365
+ADDRLP4 16
+INDIRI4
+ADDRGP4 userCvarTableSize
+INDIRI4
+LTI4 $362
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $377
+JUMPV
+LABELV $374
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $378
+ADDRLP4 36
+ADDRGP4 $380
+ASGNP4
+ADDRGP4 $379
+JUMPV
+LABELV $378
+ADDRGP4 $381
+ARGP4
+ADDRGP4 $380
+ARGP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 104
+INDIRP4
+ASGNP4
+LABELV $379
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 $382
+ARGP4
+ADDRLP4 104
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BORI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 $383
+ARGP4
+ADDRLP4 108
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ADDRLP4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 112
+INDIRI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BORI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 $384
+ARGP4
+ADDRLP4 116
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRLP4 56
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 120
+INDIRI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BORI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 $385
+ARGP4
+ADDRLP4 124
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ADDRLP4 72
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BORI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 $386
+ARGP4
+ADDRLP4 132
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ADDRLP4 88
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 136
+INDIRI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BORI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $375
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $377
+ADDRLP4 104
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 104
+INDIRI4
+LTI4 $374
+LABELV $354
+endproc CG_RegisterUserCvars 140 28
+export CG_RegisterCvars
+proc CG_RegisterCvars 1028 12
+ADDRGP4 CG_RegisterCgameCvars
+CALLV
+pop
+ADDRGP4 CG_RegisterUserCvars
+CALLV
+pop
+ADDRGP4 CG_RegisterInputCvars
+CALLV
+pop
+ADDRGP4 $388
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+56060
+ADDRLP4 1024
+INDIRI4
+ASGNI4
+ADDRGP4 forceModelModificationCount
+ADDRGP4 cg_forceModel+4
+INDIRI4
+ASGNI4
+ADDRGP4 redTeamNameModificationCount
+ADDRGP4 cg_redTeamName+4
+INDIRI4
+ASGNI4
+ADDRGP4 blueTeamNameModificationCount
+ADDRGP4 cg_blueTeamName+4
+INDIRI4
+ASGNI4
+LABELV $387
+endproc CG_RegisterCvars 1028 12
+proc CG_ForceModelChange 12 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $394
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $398
+ADDRGP4 $395
+JUMPV
+LABELV $398
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewPlayerInfo
+CALLV
+pop
+LABELV $395
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $394
+LABELV $393
+endproc CG_ForceModelChange 12 4
+export CG_UpdateCgameCvars
+proc CG_UpdateCgameCvars 8 4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgameCvarTable
+ASGNP4
+ADDRGP4 $404
+JUMPV
+LABELV $401
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $405
+ADDRGP4 $402
+JUMPV
+LABELV $405
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $402
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+LABELV $404
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgameCvarTableSize
+INDIRI4
+LTI4 $401
+LABELV $400
+endproc CG_UpdateCgameCvars 8 4
+export CG_UpdateUserCvars
+proc CG_UpdateUserCvars 16 4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 userCvarTable
+ASGNP4
+ADDRGP4 $411
+JUMPV
+LABELV $408
+ADDRLP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $412
+ADDRGP4 $409
+JUMPV
+LABELV $412
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $417
+JUMPV
+LABELV $414
+CNSTI4 272
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $415
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $417
+ADDRLP4 12
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $414
+LABELV $409
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+LABELV $411
+ADDRLP4 8
+INDIRI4
+ADDRGP4 userCvarTableSize
+INDIRI4
+LTI4 $408
+LABELV $407
+endproc CG_UpdateUserCvars 16 4
+export CG_UpdateCvars
+proc CG_UpdateCvars 0 0
+ADDRGP4 CG_UpdateCgameCvars
+CALLV
+pop
+ADDRGP4 CG_UpdateUserCvars
+CALLV
+pop
+ADDRGP4 CG_UpdateInputCvars
+CALLV
+pop
+ADDRGP4 cg+4
+INDIRI4
+CNSTI4 0
+NEI4 $419
+ADDRGP4 $418
+JUMPV
+LABELV $419
+ADDRGP4 forceModelModificationCount
+INDIRI4
+ADDRGP4 cg_forceModel+4
+INDIRI4
+NEI4 $428
+ADDRGP4 redTeamNameModificationCount
+INDIRI4
+ADDRGP4 cg_redTeamName+4
+INDIRI4
+NEI4 $428
+ADDRGP4 blueTeamNameModificationCount
+INDIRI4
+ADDRGP4 cg_blueTeamName+4
+INDIRI4
+EQI4 $422
+LABELV $428
+ADDRGP4 forceModelModificationCount
+ADDRGP4 cg_forceModel+4
+INDIRI4
+ASGNI4
+ADDRGP4 redTeamNameModificationCount
+ADDRGP4 cg_redTeamName+4
+INDIRI4
+ASGNI4
+ADDRGP4 blueTeamNameModificationCount
+ADDRGP4 cg_blueTeamName+4
+INDIRI4
+ASGNI4
+ADDRGP4 CG_ForceModelChange
+CALLV
+pop
+LABELV $422
+LABELV $418
+endproc CG_UpdateCvars 0 0
+export CG_CrosshairPlayer
+proc CG_CrosshairPlayer 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $437
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $437
+ADDRLP4 4
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $433
+LABELV $437
+CNSTI4 -1
+RETI4
+ADDRGP4 $432
+JUMPV
+LABELV $433
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852+35628
+ADDP4
+INDIRI4
+CNSTI4 1000
+ADDI4
+LEI4 $438
+CNSTI4 -1
+RETI4
+ADDRGP4 $432
+JUMPV
+LABELV $438
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852+35624
+ADDP4
+INDIRI4
+RETI4
+LABELV $432
+endproc CG_CrosshairPlayer 8 0
+export CG_LastAttacker
+proc CG_LastAttacker 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $450
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $450
+ADDRLP4 4
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $446
+LABELV $450
+CNSTI4 -1
+RETI4
+ADDRGP4 $445
+JUMPV
+LABELV $446
+ADDRLP4 8
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+531852+35640
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $456
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+531852
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $451
+LABELV $456
+CNSTI4 -1
+RETI4
+ADDRGP4 $445
+JUMPV
+LABELV $451
+CNSTI4 500
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRI4
+RETI4
+LABELV $445
+endproc CG_LastAttacker 12 0
+export CG_RemoveNotifyLine
+proc CG_RemoveNotifyLine 52 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $461
+ADDRFP4 0
+INDIRP4
+CNSTI4 37112
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $459
+LABELV $461
+ADDRGP4 $458
+JUMPV
+LABELV $459
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 37084
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36056
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 20
+INDIRU4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $465
+JUMPV
+LABELV $462
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 36056
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $463
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $465
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $462
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $469
+JUMPV
+LABELV $466
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 37080
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRI4
+CNSTI4 8
+SUBI4
+ADDRLP4 36
+INDIRP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 8
+LABELV $467
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $469
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 37112
+ADDP4
+INDIRI4
+LTI4 $466
+ADDRFP4 0
+INDIRP4
+CNSTI4 37112
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 8
+SUBI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 37080
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 37112
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 8
+SUBI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 37080
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 37112
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $458
+endproc CG_RemoveNotifyLine 52 4
+export CG_AddNotifyText
+proc CG_AddNotifyText 1104 12
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LiteralArgs
+CALLV
+pop
+ADDRLP4 20
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $471
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $476
+JUMPV
+LABELV $473
+CNSTI4 39084
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg+531852+36056
+ADDP4
+CNSTI1 0
+ASGNI1
+CNSTI4 39084
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg+531852+37112
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $474
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $476
+ADDRLP4 1048
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+LTI4 $473
+ADDRGP4 $470
+JUMPV
+LABELV $471
+ADDRLP4 12
+ADDRLP4 20
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $483
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRLP4 1048
+ADDRGP4 Q_strncmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $481
+ADDRLP4 1044
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+LABELV $481
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_ConsolePrint
+CALLV
+pop
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+NEI4 $487
+ADDRFP4 4
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+NEI4 $487
+ADDRLP4 1056
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $484
+LABELV $487
+ADDRGP4 $470
+JUMPV
+LABELV $484
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $490
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 1060
+ADDRGP4 Q_strncmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $488
+ADDRLP4 1068
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 49
+LTI4 $488
+ADDRLP4 1068
+INDIRI4
+CNSTI4 53
+GEI4 $488
+ADDRLP4 12
+INDIRP4
+CNSTI4 9
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 93
+NEI4 $488
+ADDRLP4 16
+CNSTI4 1
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 49
+SUBI4
+LSHI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 10
+ADDP4
+ASGNP4
+ADDRGP4 $489
+JUMPV
+LABELV $488
+ADDRLP4 16
+CNSTI4 -1
+ASGNI4
+LABELV $489
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 1072
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $491
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDRLP4 8
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $495
+ADDRGP4 $492
+JUMPV
+LABELV $495
+ADDRLP4 0
+CNSTI4 39084
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 13
+NEI4 $511
+ADDRLP4 1084
+CNSTI4 0
+ASGNI4
+ADDRLP4 1080
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1076
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRGP4 $503
+JUMPV
+LABELV $500
+ADDRLP4 1080
+ADDRLP4 1080
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37080
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $501
+ADDRLP4 1076
+ADDRLP4 1076
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $503
+ADDRLP4 1076
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37112
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+LTI4 $500
+ADDRLP4 1080
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36056
+ADDP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI4 37112
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $507
+ADDRLP4 1088
+ADDRLP4 0
+INDIRP4
+CNSTI4 37112
+ADDP4
+ASGNP4
+ADDRLP4 1088
+INDIRP4
+ADDRLP4 1088
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $507
+JUMPV
+LABELV $506
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_RemoveNotifyLine
+CALLV
+pop
+LABELV $507
+ADDRLP4 0
+INDIRP4
+CNSTI4 36056
+ADDP4
+ARGP4
+ADDRLP4 1088
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1088
+INDIRU4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ADDU4
+CNSTU4 1024
+GTU4 $506
+ADDRLP4 0
+INDIRP4
+CNSTI4 36056
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 37112
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37080
+ADDP4
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37112
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37080
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 1100
+ADDRLP4 0
+INDIRP4
+CNSTI4 37112
+ADDP4
+ASGNP4
+ADDRLP4 1100
+INDIRP4
+ADDRLP4 1100
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $492
+JUMPV
+LABELV $510
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_RemoveNotifyLine
+CALLV
+pop
+LABELV $511
+ADDRLP4 0
+INDIRP4
+CNSTI4 36056
+ADDP4
+ARGP4
+ADDRLP4 1076
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1076
+INDIRU4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ADDU4
+CNSTU4 1024
+GTU4 $510
+ADDRLP4 0
+INDIRP4
+CNSTI4 37112
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $513
+ADDRLP4 0
+INDIRP4
+CNSTI4 36056
+ADDP4
+ARGP4
+ADDRLP4 1084
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1084
+INDIRU4
+CNSTU4 1
+SUBU4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36056
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+EQI4 $513
+ADDRLP4 0
+INDIRP4
+CNSTI4 36056
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 37112
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 8
+SUBI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37080
+ADDP4
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 1096
+ADDRLP4 0
+INDIRP4
+CNSTI4 37112
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 8
+SUBI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37080
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 1096
+INDIRP4
+ADDRLP4 1096
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $492
+JUMPV
+LABELV $513
+ADDRLP4 0
+INDIRP4
+CNSTI4 37112
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $516
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_RemoveNotifyLine
+CALLV
+pop
+LABELV $516
+ADDRLP4 0
+INDIRP4
+CNSTI4 37112
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $518
+ADDRGP4 $492
+JUMPV
+LABELV $518
+ADDRLP4 0
+INDIRP4
+CNSTI4 36056
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 37112
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37080
+ADDP4
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37112
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 37080
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 1096
+ADDRLP4 0
+INDIRP4
+CNSTI4 37112
+ADDP4
+ASGNP4
+ADDRLP4 1096
+INDIRP4
+ADDRLP4 1096
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $492
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $494
+ADDRLP4 1076
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+LTI4 $491
+LABELV $470
+endproc CG_AddNotifyText 1104 12
+export CG_NotifyPrintf
+proc CG_NotifyPrintf 1044 16
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $522
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1032
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1024
+ADDRLP4 1032
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 1028
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 0
+ADDP4
+ARGP4
+CNSTU4 1024
+ADDRLP4 1024
+INDIRI4
+CVIU4 4
+SUBU4
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 1028
+CNSTP4 0
+ASGNP4
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 0
+ADDP4
+ARGP4
+ADDRGP4 $483
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRLP4 1040
+ADDRGP4 Q_strncmp
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $524
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $483
+ARGP4
+CNSTU4 12
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $524
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $521
+endproc CG_NotifyPrintf 1044 16
+export CG_NotifyBitsPrintf
+proc CG_NotifyBitsPrintf 1036 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 1028
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $532
+JUMPV
+LABELV $529
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $533
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $535
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_NotifyPrintf
+CALLV
+pop
+LABELV $533
+LABELV $530
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $532
+ADDRLP4 1032
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+LTI4 $529
+LABELV $527
+endproc CG_NotifyBitsPrintf 1036 16
+export CG_DPrintf
+proc CG_DPrintf 2056 16
+ADDRGP4 $537
+ARGP4
+ADDRLP4 1028
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 1028
+ARGP4
+ADDRLP4 2052
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 0
+NEI4 $538
+ADDRGP4 $536
+JUMPV
+LABELV $538
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $536
+endproc CG_DPrintf 2056 16
+export CG_Printf
+proc CG_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $541
+endproc CG_Printf 1028 16
+export CG_Error
+proc CG_Error 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $543
+endproc CG_Error 1028 16
+export Com_Error
+proc Com_Error 1028 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $545
+endproc Com_Error 1028 16
+export Com_Printf
+proc Com_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $547
+endproc Com_Printf 1028 16
+export Com_DPrintf
+proc Com_DPrintf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $535
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_DPrintf
+CALLV
+pop
+LABELV $549
+endproc Com_DPrintf 1028 16
+bss
+align 1
+LABELV $552
+skip 1024
+export CG_Argv
+code
+proc CG_Argv 0 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $552
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRGP4 $552
+RETP4
+LABELV $551
+endproc CG_Argv 0 12
+bss
+align 1
+LABELV $554
+skip 1024
+export CG_Cvar_VariableString
+code
+proc CG_Cvar_VariableString 0 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $554
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $554
+RETP4
+LABELV $553
+endproc CG_Cvar_VariableString 0 12
+export CG_MaxSplitView
+proc CG_MaxSplitView 0 0
+ADDRGP4 cgs+56044
+INDIRI4
+RETI4
+LABELV $555
+endproc CG_MaxSplitView 0 0
+export CG_SetupDlightstyles
+proc CG_SetupDlightstyles 84 12
+ADDRGP4 cg+516656
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+LABELV $559
+ADDRLP4 20
+INDIRI4
+CNSTI4 736
+ADDI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 28
+INDIRU4
+CNSTU4 0
+NEU4 $563
+ADDRGP4 $561
+JUMPV
+LABELV $563
+ADDRLP4 12
+ARGP4
+ADDRLP4 32
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $567
+ADDRLP4 16
+INDIRI4
+CNSTI4 4096
+LTI4 $565
+LABELV $567
+ADDRGP4 $560
+JUMPV
+LABELV $565
+ADDRLP4 0
+CNSTI4 852
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 44
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 764
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 764
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $568
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+ADDRLP4 64
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $568
+ADDRLP4 12
+ARGP4
+ADDRLP4 60
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 844
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 68
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 848
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $573
+JUMPV
+LABELV $570
+ADDRLP4 80
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 0
+INDIRP4
+CNSTI4 848
+ADDP4
+INDIRI4
+ADDI4
+CVII1 4
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 97
+GEI4 $574
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ADDP4
+CNSTI1 97
+ASGNI1
+LABELV $574
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 122
+LEI4 $576
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ADDP4
+CNSTI1 122
+ASGNI1
+LABELV $576
+LABELV $571
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $573
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ADDRLP4 76
+INDIRU4
+LTU4 $570
+ADDRLP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $560
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 128
+LTI4 $559
+LABELV $561
+LABELV $557
+endproc CG_SetupDlightstyles 84 12
+proc CG_RegisterItemSounds 96 12
+ADDRLP4 76
+CNSTI4 48
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $580
+ADDRLP4 76
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+683776+125904
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+LABELV $580
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $586
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $588
+LABELV $586
+ADDRGP4 $579
+JUMPV
+LABELV $587
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $591
+JUMPV
+LABELV $590
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $591
+ADDRLP4 84
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $593
+ADDRLP4 84
+INDIRI4
+CNSTI4 32
+NEI4 $590
+LABELV $593
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 72
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $596
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+GEI4 $594
+LABELV $596
+ADDRGP4 $597
+ARGP4
+ADDRLP4 76
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $594
+ADDRLP4 8
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $598
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $598
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8-3
+ADDP4
+ARGP4
+ADDRGP4 $603
+ARGP4
+ADDRLP4 92
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $600
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+LABELV $600
+LABELV $588
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $587
+LABELV $579
+endproc CG_RegisterItemSounds 96 12
+proc CG_RegisterSounds 704 16
+ADDRGP4 CG_LoadVoiceChats
+CALLV
+pop
+ADDRGP4 $607
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 332
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127228
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 $610
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 336
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127232
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRGP4 $613
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 340
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127236
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRGP4 $616
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 344
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127248
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRGP4 $619
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 348
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127244
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 $622
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 352
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127240
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRGP4 $625
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 356
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127440
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $628
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 360
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127444
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRGP4 $631
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 364
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127448
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRGP4 $634
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 368
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127452
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRGP4 $637
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127456
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRGP4 $640
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 376
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127492
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+GEI4 $645
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $641
+LABELV $645
+ADDRGP4 $648
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 380
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127364
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $651
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 384
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127368
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $654
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127372
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $657
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127264
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $660
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127356
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $663
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 400
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127360
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $666
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 404
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127376
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $669
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 408
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127380
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $672
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 412
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127384
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $675
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 416
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127388
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $678
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 420
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127392
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $681
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 424
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127396
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+EQI4 $686
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $682
+LABELV $686
+ADDRGP4 $689
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127400
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $692
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127404
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $695
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 436
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127412
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $698
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 440
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127416
+ADDRLP4 440
+INDIRI4
+ASGNI4
+LABELV $682
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 5
+EQI4 $703
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $699
+LABELV $703
+ADDRGP4 cgs+683776+127408
+CNSTI4 0
+ASGNI4
+ADDRGP4 $708
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127428
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $711
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127424
+ADDRLP4 432
+INDIRI4
+ASGNI4
+LABELV $699
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 5
+EQI4 $718
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+EQI4 $718
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $712
+LABELV $718
+ADDRGP4 $721
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127420
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $724
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127436
+ADDRLP4 432
+INDIRI4
+ASGNI4
+LABELV $712
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 6
+EQI4 $729
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $725
+LABELV $729
+ADDRGP4 $732
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127432
+ADDRLP4 428
+INDIRI4
+ASGNI4
+LABELV $725
+LABELV $641
+ADDRGP4 $735
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 380
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+126932
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $738
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 384
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+126936
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $741
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+126944
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $744
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+126940
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $747
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127180
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $750
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 400
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127184
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $753
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 404
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127188
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $756
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 408
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127192
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $759
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 412
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127136
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $762
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 416
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127140
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $765
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 420
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127144
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $768
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 424
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127148
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $771
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127152
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $774
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127156
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $777
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 436
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127160
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $780
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 440
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127164
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $783
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 444
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127168
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRGP4 $786
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 448
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127496
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRGP4 $789
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 452
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127500
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $792
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 456
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127504
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $795
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 460
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127508
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $798
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 464
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127196
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $801
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 468
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127200
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $804
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 472
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127208
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $807
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127204
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $810
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 480
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127212
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $813
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 484
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127216
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRGP4 $816
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 488
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127252
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRGP4 $819
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 492
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127256
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRGP4 $822
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 496
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127260
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRGP4 $825
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 500
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127268
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 $828
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 504
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127272
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRGP4 $831
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 508
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127276
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRGP4 $834
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 512
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127280
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRGP4 $837
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 516
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127284
+ADDRLP4 516
+INDIRI4
+ASGNI4
+ADDRGP4 $840
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 520
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127288
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRGP4 $843
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 524
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127292
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRGP4 $846
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 528
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127296
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRGP4 $849
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 532
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127300
+ADDRLP4 532
+INDIRI4
+ASGNI4
+ADDRGP4 $852
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 536
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127304
+ADDRLP4 536
+INDIRI4
+ASGNI4
+ADDRGP4 $855
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 540
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127308
+ADDRLP4 540
+INDIRI4
+ASGNI4
+ADDRGP4 $858
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 544
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127312
+ADDRLP4 544
+INDIRI4
+ASGNI4
+ADDRGP4 $861
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 548
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127316
+ADDRLP4 548
+INDIRI4
+ASGNI4
+ADDRGP4 $864
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 552
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127320
+ADDRLP4 552
+INDIRI4
+ASGNI4
+ADDRGP4 $867
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 556
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127324
+ADDRLP4 556
+INDIRI4
+ASGNI4
+ADDRGP4 $870
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 560
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127328
+ADDRLP4 560
+INDIRI4
+ASGNI4
+ADDRGP4 $873
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 564
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127332
+ADDRLP4 564
+INDIRI4
+ASGNI4
+ADDRGP4 $876
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 568
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127336
+ADDRLP4 568
+INDIRI4
+ASGNI4
+ADDRGP4 $879
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 572
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127224
+ADDRLP4 572
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $880
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $884
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 576
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+683776+126948
+ADDP4
+ADDRLP4 576
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $887
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 580
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+683776+126948+16
+ADDP4
+ADDRLP4 580
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $891
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 584
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+683776+126948+32
+ADDP4
+ADDRLP4 584
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $895
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 588
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+683776+126948+48
+ADDP4
+ADDRLP4 588
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $899
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 592
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+683776+126948+64
+ADDP4
+ADDRLP4 592
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $903
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 596
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+683776+126948+96
+ADDP4
+ADDRLP4 596
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $907
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 600
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+683776+126948+80
+ADDP4
+ADDRLP4 600
+INDIRI4
+ASGNI4
+LABELV $881
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $880
+CNSTI4 27
+ARGI4
+ADDRLP4 576
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 576
+INDIRP4
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $914
+JUMPV
+LABELV $911
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemSounds
+CALLV
+pop
+LABELV $912
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $914
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $911
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $915
+ADDRLP4 0
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 580
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 580
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $919
+ADDRGP4 $917
+JUMPV
+LABELV $919
+ADDRLP4 68
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $921
+ADDRGP4 $916
+JUMPV
+LABELV $921
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 584
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+60356
+ADDP4
+ADDRLP4 584
+INDIRI4
+ASGNI4
+LABELV $916
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $915
+LABELV $917
+ADDRGP4 $926
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 580
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127340
+ADDRLP4 580
+INDIRI4
+ASGNI4
+ADDRGP4 $929
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 584
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127344
+ADDRLP4 584
+INDIRI4
+ASGNI4
+ADDRGP4 $932
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 588
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+126928
+ADDRLP4 588
+INDIRI4
+ASGNI4
+ADDRGP4 $935
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 592
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127072
+ADDRLP4 592
+INDIRI4
+ASGNI4
+ADDRGP4 $938
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 596
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127076
+ADDRLP4 596
+INDIRI4
+ASGNI4
+ADDRGP4 $941
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 600
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127080
+ADDRLP4 600
+INDIRI4
+ASGNI4
+ADDRGP4 $944
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 604
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127084
+ADDRLP4 604
+INDIRI4
+ASGNI4
+ADDRGP4 $947
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 608
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127088
+ADDRLP4 608
+INDIRI4
+ASGNI4
+ADDRGP4 $950
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 612
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127092
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRGP4 $953
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 616
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127096
+ADDRLP4 616
+INDIRI4
+ASGNI4
+ADDRGP4 $956
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 620
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127100
+ADDRLP4 620
+INDIRI4
+ASGNI4
+ADDRGP4 $959
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 624
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127104
+ADDRLP4 624
+INDIRI4
+ASGNI4
+ADDRGP4 $962
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 628
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127108
+ADDRLP4 628
+INDIRI4
+ASGNI4
+ADDRGP4 $965
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 632
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127112
+ADDRLP4 632
+INDIRI4
+ASGNI4
+ADDRGP4 $968
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 636
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127116
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRGP4 $971
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 640
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127120
+ADDRLP4 640
+INDIRI4
+ASGNI4
+ADDRGP4 $974
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 644
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127348
+ADDRLP4 644
+INDIRI4
+ASGNI4
+ADDRGP4 $977
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 648
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127124
+ADDRLP4 648
+INDIRI4
+ASGNI4
+ADDRGP4 $980
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 652
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127128
+ADDRLP4 652
+INDIRI4
+ASGNI4
+ADDRGP4 $983
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 656
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127132
+ADDRLP4 656
+INDIRI4
+ASGNI4
+ADDRGP4 $986
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 660
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127172
+ADDRLP4 660
+INDIRI4
+ASGNI4
+ADDRGP4 $989
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 664
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127176
+ADDRLP4 664
+INDIRI4
+ASGNI4
+ADDRGP4 $992
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 668
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127560
+ADDRLP4 668
+INDIRI4
+ASGNI4
+ADDRGP4 $995
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 672
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127564
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRGP4 $998
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 676
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127568
+ADDRLP4 676
+INDIRI4
+ASGNI4
+ADDRGP4 $1001
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 680
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127572
+ADDRLP4 680
+INDIRI4
+ASGNI4
+ADDRGP4 $1004
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 684
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127540
+ADDRLP4 684
+INDIRI4
+ASGNI4
+ADDRGP4 $1007
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 688
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127544
+ADDRLP4 688
+INDIRI4
+ASGNI4
+ADDRGP4 $1010
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 692
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127548
+ADDRLP4 692
+INDIRI4
+ASGNI4
+ADDRGP4 $1013
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 696
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127552
+ADDRLP4 696
+INDIRI4
+ASGNI4
+ADDRGP4 $1016
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 700
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127556
+ADDRLP4 700
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+GEI4 $1021
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1017
+LABELV $1021
+ADDRGP4 cg_defaultMaleTeamModel+16
+ARGP4
+ADDRGP4 CG_CachePlayerSounds
+CALLV
+pop
+ADDRGP4 cg_defaultFemaleTeamModel+16
+ARGP4
+ADDRGP4 CG_CachePlayerSounds
+CALLV
+pop
+LABELV $1017
+LABELV $604
+endproc CG_RegisterSounds 704 16
+proc CG_RegisterGraphics 652 24
+ADDRGP4 cg+512444
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 448
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRGP4 cgs+56120
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 cgs+56120
+ARGP4
+ADDRGP4 trap_R_LoadWorldMap
+CALLV
+pop
+ADDRGP4 $1029
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_ParseEntitiesFromString
+CALLV
+pop
+ADDRGP4 $1030
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 $1033
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125676
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $1037
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125676+4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRGP4 $1041
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125676+8
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRGP4 $1045
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125676+12
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRGP4 $1049
+ARGP4
+ADDRLP4 280
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125676+16
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRGP4 $1052
+ARGP4
+ADDRLP4 284
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125584
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRGP4 $1055
+ARGP4
+ADDRLP4 288
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125496
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRGP4 $1058
+ARGP4
+ADDRLP4 292
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125864
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRGP4 $1061
+ARGP4
+ADDRLP4 296
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125868
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRGP4 $1064
+ARGP4
+ADDRLP4 300
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125872
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRGP4 $1067
+ARGP4
+ADDRLP4 304
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125876
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRGP4 $1070
+ARGP4
+ADDRLP4 308
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125644
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRGP4 $1073
+ARGP4
+ADDRLP4 312
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125648
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRGP4 $1076
+ARGP4
+ADDRLP4 316
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125664
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRGP4 $1079
+ARGP4
+ADDRLP4 320
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125668
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRGP4 $1082
+ARGP4
+ADDRLP4 324
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125652
+ADDRLP4 324
+INDIRI4
+ASGNI4
+ADDRGP4 $1085
+ARGP4
+ADDRLP4 328
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125660
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRGP4 $1088
+ARGP4
+ADDRLP4 332
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125632
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 $1091
+ARGP4
+ADDRLP4 336
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125572
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRGP4 $1094
+ARGP4
+ADDRLP4 340
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125656
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRGP4 $1097
+ARGP4
+ADDRLP4 344
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125588
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRGP4 $1100
+ARGP4
+ADDRLP4 348
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125580
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1101
+ADDRGP4 $1107
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+ADDI4
+ARGI4
+ADDRLP4 356
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 356
+INDIRP4
+ARGP4
+ADDRLP4 360
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+683776+125592
+ADDP4
+ADDRLP4 360
+INDIRI4
+ASGNI4
+LABELV $1102
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $1101
+ADDRGP4 $1110
+ARGP4
+ADDRLP4 352
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125636
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRGP4 $1113
+ARGP4
+ADDRLP4 356
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125640
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $1116
+ARGP4
+ADDRLP4 360
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125720
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRGP4 $1119
+ARGP4
+ADDRLP4 364
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125728
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRGP4 $1122
+ARGP4
+ADDRLP4 368
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125740
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRGP4 $1125
+ARGP4
+ADDRLP4 372
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125744
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRGP4 $1128
+ARGP4
+ADDRLP4 376
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125732
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 $1131
+ARGP4
+ADDRLP4 380
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125736
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $1134
+ARGP4
+ADDRLP4 384
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125748
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 7
+EQI4 $1139
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1135
+LABELV $1139
+ADDRGP4 $1142
+ARGP4
+ADDRLP4 388
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123352
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $1145
+ARGP4
+ADDRLP4 392
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123356
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $1148
+ARGP4
+ADDRLP4 396
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123360
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $1151
+ARGP4
+ADDRLP4 400
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123364
+ADDRLP4 400
+INDIRI4
+ASGNI4
+LABELV $1135
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+EQI4 $1160
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 5
+EQI4 $1160
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 7
+EQI4 $1160
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1152
+LABELV $1160
+ADDRGP4 $1163
+ARGP4
+ADDRLP4 388
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123368
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $1166
+ARGP4
+ADDRLP4 392
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123372
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $1169
+ARGP4
+ADDRLP4 396
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123380
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $1173
+ARGP4
+ADDRLP4 400
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123380+4
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $1177
+ARGP4
+ADDRLP4 404
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123380+8
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $1180
+ARGP4
+ADDRLP4 408
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123392
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $1184
+ARGP4
+ADDRLP4 412
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123392+4
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $1188
+ARGP4
+ADDRLP4 416
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123392+8
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $1191
+ARGP4
+ADDRLP4 420
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123420
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $1194
+ARGP4
+ADDRLP4 424
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123424
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $1195
+ARGP4
+ADDRGP4 cgs+683776+123428
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_RegisterSkin
+CALLI4
+pop
+ADDRGP4 $1198
+ARGP4
+ADDRGP4 cgs+683776+123832
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_RegisterSkin
+CALLI4
+pop
+ADDRGP4 $1201
+ARGP4
+ADDRGP4 cgs+683776+124236
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_RegisterSkin
+CALLI4
+pop
+ADDRGP4 $1206
+ARGP4
+ADDRLP4 428
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+124640
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $1209
+ARGP4
+ADDRLP4 432
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+124644
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $1212
+ARGP4
+ADDRLP4 436
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+124648
+ADDRLP4 436
+INDIRI4
+ASGNI4
+LABELV $1152
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 5
+EQI4 $1217
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1213
+LABELV $1217
+ADDRGP4 $1220
+ARGP4
+ADDRLP4 388
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123376
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $1223
+ARGP4
+ADDRLP4 392
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123404
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $1173
+ARGP4
+ADDRLP4 396
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123404+4
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $1184
+ARGP4
+ADDRLP4 400
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123404+8
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $1233
+ARGP4
+ADDRLP4 404
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123404+12
+ADDRLP4 404
+INDIRI4
+ASGNI4
+LABELV $1213
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 6
+EQI4 $1238
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1234
+LABELV $1238
+ADDRGP4 $1241
+ARGP4
+ADDRLP4 388
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125788
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $1244
+ARGP4
+ADDRLP4 392
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+124652
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $1247
+ARGP4
+ADDRLP4 396
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+124656
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $1250
+ARGP4
+ADDRLP4 400
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+124660
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $1253
+ARGP4
+ADDRLP4 404
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+124664
+ADDRLP4 404
+INDIRI4
+ASGNI4
+LABELV $1234
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 7
+EQI4 $1258
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1254
+LABELV $1258
+ADDRGP4 $1261
+ARGP4
+ADDRLP4 388
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+124668
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $1262
+ARGP4
+ADDRGP4 cgs+683776+124672
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_RegisterSkin
+CALLI4
+pop
+ADDRGP4 $1265
+ARGP4
+ADDRGP4 cgs+683776+125076
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_RegisterSkin
+CALLI4
+pop
+ADDRGP4 $1270
+ARGP4
+ADDRLP4 392
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125480
+ADDRLP4 392
+INDIRI4
+ASGNI4
+LABELV $1254
+ADDRGP4 $1273
+ARGP4
+ADDRLP4 388
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125752
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $1134
+ARGP4
+ADDRLP4 392
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125856
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+GEI4 $1280
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1276
+LABELV $1280
+ADDRGP4 $1283
+ARGP4
+ADDRLP4 396
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125564
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $1286
+ARGP4
+ADDRLP4 400
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125724
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $1289
+ARGP4
+ADDRLP4 404
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125492
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $1292
+ARGP4
+ADDRLP4 408
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125756
+ADDRLP4 408
+INDIRI4
+ASGNI4
+LABELV $1276
+ADDRGP4 $1295
+ARGP4
+ADDRLP4 396
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125484
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $1298
+ARGP4
+ADDRLP4 400
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125488
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $1301
+ARGP4
+ADDRLP4 404
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125544
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $1304
+ARGP4
+ADDRLP4 408
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125548
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $1307
+ARGP4
+ADDRLP4 412
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125500
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $1310
+ARGP4
+ADDRLP4 416
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125504
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $1313
+ARGP4
+ADDRLP4 420
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125508
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $1316
+ARGP4
+ADDRLP4 424
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125512
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $1319
+ARGP4
+ADDRLP4 428
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125516
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $1322
+ARGP4
+ADDRLP4 432
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125520
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $1325
+ARGP4
+ADDRLP4 436
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125524
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $1328
+ARGP4
+ADDRLP4 440
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125528
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $1331
+ARGP4
+ADDRLP4 444
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125532
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRGP4 $1334
+ARGP4
+ADDRLP4 448
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125536
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRGP4 $1304
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125540
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $1339
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125568
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $1342
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125576
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $1345
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125800
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $1348
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125760
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $1351
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125764
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $1354
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125768
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $1357
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125804
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $1360
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125812
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRGP4 $1363
+ARGP4
+ADDRLP4 488
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125816
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRGP4 $1366
+ARGP4
+ADDRLP4 492
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125820
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRGP4 $1369
+ARGP4
+ADDRLP4 496
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125824
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRGP4 $1372
+ARGP4
+ADDRLP4 500
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125828
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 $1375
+ARGP4
+ADDRLP4 504
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125832
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRGP4 $1378
+ARGP4
+ADDRLP4 508
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125836
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRGP4 $1381
+ARGP4
+ADDRLP4 512
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125840
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRGP4 $1384
+ARGP4
+ADDRLP4 516
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125844
+ADDRLP4 516
+INDIRI4
+ASGNI4
+ADDRGP4 $1387
+ARGP4
+ADDRLP4 520
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125848
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRGP4 $1390
+ARGP4
+ADDRLP4 524
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125852
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRGP4 $1393
+ARGP4
+ADDRLP4 528
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125860
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRGP4 $1396
+ARGP4
+ADDRLP4 532
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125880
+ADDRLP4 532
+INDIRI4
+ASGNI4
+ADDRGP4 $1399
+ARGP4
+ADDRLP4 536
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125884
+ADDRLP4 536
+INDIRI4
+ASGNI4
+ADDRGP4 $1402
+ARGP4
+ADDRLP4 540
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125888
+ADDRLP4 540
+INDIRI4
+ASGNI4
+ADDRGP4 $1405
+ARGP4
+ADDRLP4 544
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125892
+ADDRLP4 544
+INDIRI4
+ASGNI4
+ADDRGP4 $1408
+ARGP4
+ADDRLP4 548
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125896
+ADDRLP4 548
+INDIRI4
+ASGNI4
+ADDRGP4 $1411
+ARGP4
+ADDRLP4 552
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125900
+ADDRLP4 552
+INDIRI4
+ASGNI4
+ADDRGP4 cg_items
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 6144
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_weapons
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2048
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 27
+ARGI4
+ADDRLP4 556
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 556
+INDIRP4
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1415
+JUMPV
+LABELV $1412
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 49
+EQI4 $1419
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1416
+LABELV $1419
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingItem
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+LABELV $1416
+LABELV $1413
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1415
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $1412
+ADDRGP4 $1422
+ARGP4
+ADDRLP4 560
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125704
+ADDRLP4 560
+INDIRI4
+ASGNI4
+ADDRGP4 $1425
+ARGP4
+ADDRLP4 564
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125708
+ADDRLP4 564
+INDIRI4
+ASGNI4
+ADDRGP4 $1428
+ARGP4
+ADDRLP4 568
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125712
+ADDRLP4 568
+INDIRI4
+ASGNI4
+ADDRGP4 $1431
+ARGP4
+ADDRLP4 572
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125716
+ADDRLP4 572
+INDIRI4
+ASGNI4
+ADDRGP4 $1434
+ARGP4
+ADDRLP4 576
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125672
+ADDRLP4 576
+INDIRI4
+ASGNI4
+ADDRGP4 $1437
+ARGP4
+ADDRLP4 580
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125696
+ADDRLP4 580
+INDIRI4
+ASGNI4
+ADDRGP4 $1440
+ARGP4
+ADDRLP4 584
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+125700
+ADDRLP4 584
+INDIRI4
+ASGNI4
+ADDRLP4 588
+ADDRGP4 trap_CM_NumInlineModels
+CALLI4
+ASGNI4
+ADDRGP4 cgs+61380
+ADDRLP4 588
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+61380
+INDIRI4
+CNSTI4 1024
+LEI4 $1442
+ADDRGP4 $1445
+ARGP4
+ADDRLP4 592
+CNSTI4 1024
+ASGNI4
+ADDRLP4 592
+INDIRI4
+ARGI4
+ADDRGP4 cgs+61380
+INDIRI4
+ADDRLP4 592
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1442
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1450
+JUMPV
+LABELV $1447
+ADDRLP4 620
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRGP4 $1452
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 620
+ARGP4
+ADDRLP4 632
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+61384
+ADDP4
+ADDRLP4 632
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+61384
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 596
+ARGP4
+ADDRLP4 608
+ARGP4
+ADDRLP4 636
+CNSTI4 0
+ASGNI4
+ADDRLP4 636
+INDIRI4
+ARGI4
+ADDRLP4 636
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_R_ModelBounds
+CALLI4
+pop
+ADDRLP4 592
+CNSTI4 0
+ASGNI4
+LABELV $1455
+ADDRLP4 640
+ADDRLP4 592
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 644
+ADDRLP4 640
+INDIRI4
+ADDRLP4 596
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 640
+INDIRI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+65480
+ADDP4
+ADDP4
+ADDRLP4 644
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 640
+INDIRI4
+ADDRLP4 608
+ADDP4
+INDIRF4
+ADDRLP4 644
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1456
+ADDRLP4 592
+ADDRLP4 592
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 592
+INDIRI4
+CNSTI4 3
+LTI4 $1455
+LABELV $1448
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1450
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+61380
+INDIRI4
+LTI4 $1447
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1460
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ARGI4
+ADDRLP4 596
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 592
+ADDRLP4 596
+INDIRP4
+ASGNP4
+ADDRLP4 592
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1464
+ADDRGP4 $1462
+JUMPV
+LABELV $1464
+ADDRLP4 592
+INDIRP4
+ARGP4
+ADDRLP4 600
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+59332
+ADDP4
+ADDRLP4 600
+INDIRI4
+ASGNI4
+LABELV $1461
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $1460
+LABELV $1462
+ADDRGP4 $1469
+ARGP4
+ADDRLP4 592
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127460
+ADDRLP4 592
+INDIRI4
+ASGNI4
+ADDRGP4 $1472
+ARGP4
+ADDRLP4 596
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127464
+ADDRLP4 596
+INDIRI4
+ASGNI4
+ADDRGP4 $1475
+ARGP4
+ADDRLP4 600
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127468
+ADDRLP4 600
+INDIRI4
+ASGNI4
+ADDRGP4 $1478
+ARGP4
+ADDRLP4 604
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127472
+ADDRLP4 604
+INDIRI4
+ASGNI4
+ADDRGP4 $1481
+ARGP4
+ADDRLP4 608
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127476
+ADDRLP4 608
+INDIRI4
+ASGNI4
+ADDRGP4 $1484
+ARGP4
+ADDRLP4 612
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127480
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRGP4 $1487
+ARGP4
+ADDRLP4 616
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127484
+ADDRLP4 616
+INDIRI4
+ASGNI4
+ADDRGP4 $1490
+ARGP4
+ADDRLP4 620
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127488
+ADDRLP4 620
+INDIRI4
+ASGNI4
+ADDRGP4 $1493
+ARGP4
+ADDRLP4 624
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127512
+ADDRLP4 624
+INDIRI4
+ASGNI4
+ADDRGP4 $1496
+ARGP4
+ADDRLP4 628
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127520
+ADDRLP4 628
+INDIRI4
+ASGNI4
+ADDRGP4 $1499
+ARGP4
+ADDRLP4 632
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127516
+ADDRLP4 632
+INDIRI4
+ASGNI4
+ADDRGP4 $1502
+ARGP4
+ADDRLP4 636
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127524
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRGP4 $1505
+ARGP4
+ADDRLP4 640
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127528
+ADDRLP4 640
+INDIRI4
+ASGNI4
+ADDRGP4 $1509
+ARGP4
+ADDRLP4 644
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127528+4
+ADDRLP4 644
+INDIRI4
+ASGNI4
+ADDRGP4 $1513
+ARGP4
+ADDRLP4 648
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+127528+8
+ADDRLP4 648
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+GEI4 $1518
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $1514
+LABELV $1518
+ADDRGP4 cg_defaultMaleTeamModel+16
+ARGP4
+ADDRGP4 cg_defaultMaleTeamHeadModel+16
+ARGP4
+ADDRGP4 CG_CachePlayerModels
+CALLV
+pop
+ADDRGP4 cg_defaultFemaleTeamModel+16
+ARGP4
+ADDRGP4 cg_defaultFemaleTeamHeadModel+16
+ARGP4
+ADDRGP4 CG_CachePlayerModels
+CALLV
+pop
+LABELV $1514
+ADDRGP4 CG_ClearParticles
+CALLV
+pop
+LABELV $1024
+endproc CG_RegisterGraphics 652 24
+export CG_LocalPlayerAdded
+proc CG_LocalPlayerAdded 4 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1526
+ADDRFP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $1524
+LABELV $1526
+ADDRGP4 $1523
+JUMPV
+LABELV $1524
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 CG_LoadDeferredPlayers
+CALLV
+pop
+LABELV $1523
+endproc CG_LocalPlayerAdded 4 0
+export CG_LocalPlayerRemoved
+proc CG_LocalPlayerRemoved 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1529
+ADDRGP4 $1528
+JUMPV
+LABELV $1529
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 39084
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1528
+endproc CG_LocalPlayerRemoved 0 12
+export CG_BuildSpectatorString
+proc CG_BuildSpectatorString 12 12
+ADDRGP4 cg+522452
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1537
+ADDRLP4 4
+CNSTI4 2108
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+77768
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1541
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1541
+ADDRGP4 $1548
+ARGP4
+CNSTI4 2108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+4
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 cg+522452
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $1541
+LABELV $1538
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1537
+LABELV $1535
+endproc CG_BuildSpectatorString 12 12
+proc CG_RegisterPlayers 28 4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1555
+JUMPV
+LABELV $1552
+CNSTI4 39084
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1556
+ADDRGP4 $1553
+JUMPV
+LABELV $1556
+CNSTI4 39084
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingPlayer
+CALLV
+pop
+CNSTI4 39084
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewPlayerInfo
+CALLV
+pop
+LABELV $1553
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1555
+ADDRLP4 8
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $1552
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1561
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1568
+JUMPV
+LABELV $1565
+CNSTI4 39084
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1569
+ADDRGP4 $1567
+JUMPV
+LABELV $1569
+LABELV $1566
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1568
+ADDRLP4 16
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $1565
+LABELV $1567
+ADDRLP4 20
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $1572
+ADDRGP4 $1562
+JUMPV
+LABELV $1572
+ADDRLP4 4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1574
+ADDRGP4 $1562
+JUMPV
+LABELV $1574
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingPlayer
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewPlayerInfo
+CALLV
+pop
+LABELV $1562
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $1561
+ADDRGP4 CG_BuildSpectatorString
+CALLV
+pop
+LABELV $1551
+endproc CG_RegisterPlayers 28 4
+export CG_ConfigString
+proc CG_ConfigString 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1579
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $1577
+LABELV $1579
+ADDRGP4 $1580
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1577
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs
+ADDP4
+INDIRI4
+ADDRGP4 cgs+4096
+ADDP4
+RETP4
+LABELV $1576
+endproc CG_ConfigString 4 8
+export CG_StartMusic
+proc CG_StartMusic 148 16
+CNSTI4 2
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 136
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 144
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRGP4 trap_S_StartBackgroundTrack
+CALLV
+pop
+LABELV $1582
+endproc CG_StartMusic 148 16
+bss
+align 1
+LABELV $1584
+skip 32768
+export CG_GetMenuBuffer
+code
+proc CG_GetMenuBuffer 16 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1585
+ADDRGP4 $1587
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1583
+JUMPV
+LABELV $1585
+ADDRLP4 0
+INDIRI4
+CNSTI4 32768
+LTI4 $1588
+ADDRGP4 $1590
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 32768
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1583
+JUMPV
+LABELV $1588
+ADDRGP4 $1584
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $1584
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $1584
+RETP4
+LABELV $1583
+endproc CG_GetMenuBuffer 16 16
+export CG_Asset_Parse
+proc CG_Asset_Parse 1124 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $1592
+CNSTI4 0
+RETI4
+ADDRGP4 $1591
+JUMPV
+LABELV $1592
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1597
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+EQI4 $1599
+CNSTI4 0
+RETI4
+ADDRGP4 $1591
+JUMPV
+LABELV $1598
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $1601
+CNSTI4 0
+RETI4
+ADDRGP4 $1591
+JUMPV
+LABELV $1601
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1606
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $1603
+CNSTI4 1
+RETI4
+ADDRGP4 $1591
+JUMPV
+LABELV $1603
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1610
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $1607
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1068
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+EQI4 $1613
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1064
+ARGP4
+ADDRLP4 1072
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $1611
+LABELV $1613
+CNSTI4 0
+RETI4
+ADDRGP4 $1591
+JUMPV
+LABELV $1611
+ADDRGP4 cg_hudFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1614
+ADDRGP4 cg_hudFont+16
+ARGP4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 cgDC+232+12
+ARGP4
+ADDRLP4 1076
+ADDRGP4 CG_InitTrueTypeFont
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+EQI4 $1617
+ADDRGP4 $1622
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 cg_hudFont+16
+ARGP4
+ADDRGP4 Com_DPrintf
+CALLV
+pop
+ADDRGP4 $1599
+JUMPV
+LABELV $1617
+LABELV $1614
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 cgDC+232+12
+ARGP4
+ADDRLP4 1076
+ADDRGP4 CG_InitTrueTypeFont
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $1599
+ADDRGP4 cgDC+232+12
+ARGP4
+ADDRLP4 1080
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+ARGI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 CG_InitBitmapFont
+CALLV
+pop
+ADDRGP4 $1599
+JUMPV
+LABELV $1607
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1633
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $1630
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1072
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+EQI4 $1636
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1068
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $1634
+LABELV $1636
+CNSTI4 0
+RETI4
+ADDRGP4 $1591
+JUMPV
+LABELV $1634
+ADDRGP4 cg_hudFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1637
+ADDRGP4 cg_hudFont+16
+ARGP4
+ADDRLP4 1068
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 cgDC+232+20568
+ARGP4
+ADDRLP4 1080
+ADDRGP4 CG_InitTrueTypeFont
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+EQI4 $1640
+ADDRGP4 $1645
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 cg_hudFont+16
+ARGP4
+ADDRGP4 Com_DPrintf
+CALLV
+pop
+ADDRGP4 $1599
+JUMPV
+LABELV $1640
+LABELV $1637
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1068
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 cgDC+232+20568
+ARGP4
+ADDRLP4 1080
+ADDRGP4 CG_InitTrueTypeFont
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $1599
+ADDRGP4 cgDC+232+20568
+ARGP4
+ADDRLP4 1084
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+ARGI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 CG_InitBitmapFont
+CALLV
+pop
+ADDRGP4 $1599
+JUMPV
+LABELV $1630
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1656
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $1653
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+EQI4 $1659
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1072
+ARGP4
+ADDRLP4 1080
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $1657
+LABELV $1659
+CNSTI4 0
+RETI4
+ADDRGP4 $1591
+JUMPV
+LABELV $1657
+ADDRGP4 cg_hudFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1660
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 $1665
+ARGP4
+ADDRLP4 1084
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $1663
+ADDRLP4 1072
+INDIRI4
+CNSTI4 20
+NEI4 $1663
+ADDRGP4 cg_hudFont+16
+ARGP4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 cgDC+232+41124
+ARGP4
+ADDRLP4 1088
+ADDRGP4 CG_InitTrueTypeFont
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+EQI4 $1663
+ADDRGP4 $1669
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1072
+INDIRI4
+ARGI4
+ADDRGP4 cg_hudFont+16
+ARGP4
+ADDRGP4 Com_DPrintf
+CALLV
+pop
+ADDRGP4 $1599
+JUMPV
+LABELV $1663
+ADDRGP4 cg_hudFont+16
+ARGP4
+ADDRLP4 1072
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 cgDC+232+41124
+ARGP4
+ADDRLP4 1092
+ADDRGP4 CG_InitTrueTypeFont
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+EQI4 $1671
+ADDRGP4 $1676
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 cg_hudFont+16
+ARGP4
+ADDRGP4 Com_DPrintf
+CALLV
+pop
+ADDRGP4 $1599
+JUMPV
+LABELV $1671
+LABELV $1660
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1072
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 cgDC+232+41124
+ARGP4
+ADDRLP4 1084
+ADDRGP4 CG_InitTrueTypeFont
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $1599
+ADDRGP4 cgDC+232+41124
+ARGP4
+ADDRLP4 1088
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+ARGI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 CG_InitBitmapFont
+CALLV
+pop
+ADDRGP4 $1599
+JUMPV
+LABELV $1653
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1687
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $1684
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $1688
+CNSTI4 0
+RETI4
+ADDRGP4 $1591
+JUMPV
+LABELV $1688
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61684
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRGP4 $1599
+JUMPV
+LABELV $1684
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1695
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $1692
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1080
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $1696
+CNSTI4 0
+RETI4
+ADDRGP4 $1591
+JUMPV
+LABELV $1696
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1084
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61732
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRGP4 $1599
+JUMPV
+LABELV $1692
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1703
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $1700
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1084
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $1704
+CNSTI4 0
+RETI4
+ADDRGP4 $1591
+JUMPV
+LABELV $1704
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1088
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61736
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRGP4 $1599
+JUMPV
+LABELV $1700
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1711
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $1708
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1088
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $1712
+CNSTI4 0
+RETI4
+ADDRGP4 $1591
+JUMPV
+LABELV $1712
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1092
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61744
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRGP4 $1599
+JUMPV
+LABELV $1708
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1719
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $1716
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1092
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $1720
+CNSTI4 0
+RETI4
+ADDRGP4 $1591
+JUMPV
+LABELV $1720
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1096
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61740
+ADDRLP4 1096
+INDIRI4
+ASGNI4
+ADDRGP4 $1599
+JUMPV
+LABELV $1716
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1727
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $1724
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+232+4
+ARGP4
+ADDRLP4 1096
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+NEI4 $1728
+CNSTI4 0
+RETI4
+ADDRGP4 $1591
+JUMPV
+LABELV $1728
+ADDRGP4 cgDC+232+4
+INDIRP4
+ARGP4
+ADDRLP4 1100
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61680
+ADDRLP4 1100
+INDIRI4
+ASGNI4
+ADDRGP4 $1599
+JUMPV
+LABELV $1724
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1739
+ARGP4
+ADDRLP4 1096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+NEI4 $1736
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+232+61748
+ARGP4
+ADDRLP4 1100
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $1599
+CNSTI4 0
+RETI4
+ADDRGP4 $1591
+JUMPV
+LABELV $1736
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1747
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $1744
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+232+61752
+ARGP4
+ADDRLP4 1104
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $1599
+CNSTI4 0
+RETI4
+ADDRGP4 $1591
+JUMPV
+LABELV $1744
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1755
+ARGP4
+ADDRLP4 1104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $1752
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+232+61756
+ARGP4
+ADDRLP4 1108
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $1599
+CNSTI4 0
+RETI4
+ADDRGP4 $1591
+JUMPV
+LABELV $1752
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1763
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $1760
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+232+61760
+ARGP4
+ADDRLP4 1112
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $1599
+CNSTI4 0
+RETI4
+ADDRGP4 $1591
+JUMPV
+LABELV $1760
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1771
+ARGP4
+ADDRLP4 1112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $1768
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+232+61764
+ARGP4
+ADDRLP4 1116
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $1599
+CNSTI4 0
+RETI4
+ADDRGP4 $1591
+JUMPV
+LABELV $1768
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1779
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $1776
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgDC+232+61768
+ARGP4
+ADDRLP4 1120
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $1780
+CNSTI4 0
+RETI4
+ADDRGP4 $1591
+JUMPV
+LABELV $1780
+ADDRGP4 cgDC+232+61784
+ADDRGP4 cgDC+232+61768+12
+INDIRF4
+ASGNF4
+LABELV $1776
+LABELV $1599
+ADDRGP4 $1598
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $1591
+endproc CG_Asset_Parse 1124 16
+export CG_ParseMenu
+proc CG_ParseMenu 1064 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1790
+ADDRGP4 $1792
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+LABELV $1790
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $1796
+ADDRGP4 $1789
+JUMPV
+LABELV $1795
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $1798
+ADDRGP4 $1797
+JUMPV
+LABELV $1798
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $1800
+ADDRGP4 $1797
+JUMPV
+LABELV $1800
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1806
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $1803
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1060
+ADDRGP4 CG_Asset_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $1797
+ADDRGP4 $1796
+JUMPV
+LABELV $1803
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $1812
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $1809
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 Menu_New
+CALLV
+pop
+LABELV $1809
+LABELV $1796
+ADDRGP4 $1795
+JUMPV
+LABELV $1797
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+LABELV $1789
+endproc CG_ParseMenu 1064 8
+export CG_Load_Menu
+proc CG_Load_Menu 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $1817
+CNSTI4 0
+RETI4
+ADDRGP4 $1813
+JUMPV
+LABELV $1816
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1606
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1819
+CNSTI4 1
+RETI4
+ADDRGP4 $1813
+JUMPV
+LABELV $1819
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1821
+CNSTI4 0
+RETI4
+ADDRGP4 $1813
+JUMPV
+LABELV $1821
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_ParseMenu
+CALLV
+pop
+LABELV $1817
+ADDRGP4 $1816
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $1813
+endproc CG_Load_Menu 16 8
+bss
+align 1
+LABELV $1824
+skip 4096
+export CG_LoadMenus
+code
+proc CG_LoadMenus 44 16
+ADDRLP4 20
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cgDC
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1825
+ADDRGP4 $1827
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $253
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1828
+ADDRGP4 $1830
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1828
+LABELV $1825
+ADDRLP4 12
+INDIRI4
+CNSTI4 4096
+LTI4 $1831
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $1833
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTI4 4096
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $1823
+JUMPV
+LABELV $1831
+ADDRGP4 $1824
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLI4
+pop
+ADDRLP4 12
+INDIRI4
+ADDRGP4 $1824
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $1824
+ARGP4
+ADDRGP4 COM_Compress
+CALLI4
+pop
+ADDRGP4 Menu_Reset
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 $1824
+ASGNP4
+ADDRGP4 $1835
+JUMPV
+LABELV $1834
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 28
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1837
+ADDRGP4 $1836
+JUMPV
+LABELV $1837
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1606
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $1839
+ADDRGP4 $1836
+JUMPV
+LABELV $1839
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1843
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $1841
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_Load_Menu
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $1836
+LABELV $1841
+LABELV $1835
+ADDRGP4 $1834
+JUMPV
+LABELV $1836
+ADDRLP4 28
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRGP4 $1846
+ARGP4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 Com_DPrintf
+CALLV
+pop
+LABELV $1823
+endproc CG_LoadMenus 44 16
+proc CG_OwnerDrawHandleKey 0 0
+CNSTI4 0
+RETI4
+LABELV $1847
+endproc CG_OwnerDrawHandleKey 0 0
+proc CG_FeederCount 8 0
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1084227584
+NEF4 $1849
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1854
+JUMPV
+LABELV $1851
+CNSTI4 56
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+52
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1856
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1856
+LABELV $1852
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1854
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+518844
+INDIRI4
+LTI4 $1851
+ADDRGP4 $1850
+JUMPV
+LABELV $1849
+ADDRFP4 0
+INDIRF4
+CNSTF4 1086324736
+NEF4 $1860
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1865
+JUMPV
+LABELV $1862
+CNSTI4 56
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+52
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1867
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1867
+LABELV $1863
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1865
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+518844
+INDIRI4
+LTI4 $1862
+ADDRGP4 $1861
+JUMPV
+LABELV $1860
+ADDRFP4 0
+INDIRF4
+CNSTF4 1093664768
+NEF4 $1871
+ADDRGP4 cg+518844
+INDIRI4
+RETI4
+ADDRGP4 $1848
+JUMPV
+LABELV $1871
+LABELV $1861
+LABELV $1850
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $1848
+endproc CG_FeederCount 8 0
+proc CG_InfoFromScoreIndex 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+LTI4 $1875
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $1881
+JUMPV
+LABELV $1878
+CNSTI4 56
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860+52
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1883
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $1887
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 2108
+CNSTI4 56
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+RETP4
+ADDRGP4 $1874
+JUMPV
+LABELV $1887
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1883
+LABELV $1879
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1881
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+518844
+INDIRI4
+LTI4 $1878
+LABELV $1875
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+CNSTI4 2108
+CNSTI4 56
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+518860
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+RETP4
+LABELV $1874
+endproc CG_InfoFromScoreIndex 12 0
+proc CG_FeederItemText 48 12
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1084227584
+NEF4 $1894
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1895
+JUMPV
+LABELV $1894
+ADDRFP4 0
+INDIRF4
+CNSTF4 1086324736
+NEF4 $1896
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+LABELV $1896
+LABELV $1895
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 20
+ADDRGP4 CG_InfoFromScoreIndex
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 56
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+518860
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1899
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1899
+ADDRLP4 28
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+LTI4 $1901
+ADDRLP4 28
+INDIRI4
+CNSTI4 6
+GTI4 $1901
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1949
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1949
+address $1903
+address $1921
+address $1924
+address $1941
+address $1942
+address $1943
+address $1945
+code
+LABELV $1903
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $1904
+CNSTI4 9
+ARGI4
+ADDRLP4 32
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 24
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 48
+DIVI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1902
+JUMPV
+LABELV $1904
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $1907
+CNSTI4 7
+ARGI4
+ADDRLP4 32
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 24
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 48
+DIVI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1902
+JUMPV
+LABELV $1907
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1910
+CNSTI4 8
+ARGI4
+ADDRLP4 32
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 24
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 48
+DIVI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1902
+JUMPV
+LABELV $1910
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $1913
+ADDRLP4 32
+INDIRI4
+CNSTI4 5
+GTI4 $1913
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+683776+125676-4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1902
+JUMPV
+LABELV $1913
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $1902
+ADDRGP4 $1920
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+RETP4
+ADDRGP4 $1893
+JUMPV
+LABELV $1921
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+NEI4 $1922
+ADDRGP4 $249
+RETP4
+ADDRGP4 $1893
+JUMPV
+LABELV $1922
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $1902
+JUMPV
+LABELV $1924
+ADDRGP4 cg+522444
+ARGP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 Com_ClientListContains
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $1925
+ADDRGP4 $1928
+RETP4
+ADDRGP4 $1893
+JUMPV
+LABELV $1925
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+NEI4 $1929
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 1
+NEI4 $1931
+ADDRGP4 $1934
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+RETP4
+ADDRGP4 $1893
+JUMPV
+LABELV $1931
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1935
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1935
+ADDRGP4 $1937
+RETP4
+ADDRGP4 $1893
+JUMPV
+LABELV $1935
+ADDRGP4 $249
+RETP4
+ADDRGP4 $1893
+JUMPV
+LABELV $1929
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1902
+ADDRGP4 $1940
+RETP4
+ADDRGP4 $1893
+JUMPV
+LABELV $1941
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+RETP4
+ADDRGP4 $1893
+JUMPV
+LABELV $1942
+ADDRGP4 $1920
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+RETP4
+ADDRGP4 $1893
+JUMPV
+LABELV $1943
+ADDRGP4 $1944
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+RETP4
+ADDRGP4 $1893
+JUMPV
+LABELV $1945
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1946
+ADDRGP4 $1948
+RETP4
+ADDRGP4 $1893
+JUMPV
+LABELV $1946
+ADDRGP4 $1944
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+RETP4
+ADDRGP4 $1893
+JUMPV
+LABELV $1901
+LABELV $1902
+LABELV $1899
+ADDRGP4 $249
+RETP4
+LABELV $1893
+endproc CG_FeederItemText 48 12
+proc CG_FeederItemImage 0 0
+CNSTI4 0
+RETI4
+LABELV $1950
+endproc CG_FeederItemImage 0 0
+proc CG_FeederSelection 0 0
+LABELV $1951
+endproc CG_FeederSelection 0 0
+proc CG_Cvar_Get 132 12
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 128
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_LatchedVariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 128
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+RETF4
+LABELV $1952
+endproc CG_Cvar_Get 132 12
+proc CG_OwnerDrawWidth 48 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 39
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1956
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $1964
+LABELV $1963
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 29
+EQI4 $1959
+ADDRLP4 8
+INDIRI4
+CNSTI4 30
+EQI4 $1961
+ADDRGP4 $1954
+JUMPV
+LABELV $1964
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 49
+EQI4 $1957
+ADDRLP4 12
+INDIRI4
+CNSTI4 50
+EQI4 $1958
+ADDRGP4 $1954
+JUMPV
+LABELV $1956
+ADDRLP4 16
+ADDRGP4 CG_GameTypeString
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $1953
+JUMPV
+LABELV $1957
+ADDRLP4 24
+ADDRGP4 CG_GetGameStatusText
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+ADDRGP4 $1953
+JUMPV
+LABELV $1958
+ADDRLP4 32
+ADDRGP4 CG_GetKillerText
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+RETI4
+ADDRGP4 $1953
+JUMPV
+LABELV $1959
+ADDRGP4 cg_redTeamName+16
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+RETI4
+ADDRGP4 $1953
+JUMPV
+LABELV $1961
+ADDRGP4 cg_blueTeamName+16
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+RETI4
+ADDRGP4 $1953
+JUMPV
+LABELV $1954
+CNSTI4 0
+RETI4
+LABELV $1953
+endproc CG_OwnerDrawWidth 48 12
+proc CG_PlayCinematic 4 24
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRFP4 16
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 16
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1965
+endproc CG_PlayCinematic 4 24
+proc CG_StopCinematic 0 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+LABELV $1966
+endproc CG_StopCinematic 0 4
+proc CG_DrawCinematic 0 20
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRFP4 16
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 16
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 trap_CIN_SetExtents
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_DrawCinematic
+CALLV
+pop
+LABELV $1967
+endproc CG_DrawCinematic 0 20
+proc CG_RunCinematicFrame 0 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+pop
+LABELV $1968
+endproc CG_RunCinematicFrame 0 4
+export CG_LoadHudMenu
+proc CG_LoadHudMenu 1028 12
+ADDRGP4 cgDC
+ADDRGP4 trap_R_RegisterShaderNoMip
+ASGNP4
+ADDRGP4 cgDC+4
+ADDRGP4 trap_R_SetColor
+ASGNP4
+ADDRGP4 cgDC+8
+ADDRGP4 CG_DrawPic
+ASGNP4
+ADDRGP4 cgDC+12
+ADDRGP4 trap_R_DrawStretchPic
+ASGNP4
+ADDRGP4 cgDC+16
+ADDRGP4 CG_Text_Paint
+ASGNP4
+ADDRGP4 cgDC+20
+ADDRGP4 CG_Text_Width
+ASGNP4
+ADDRGP4 cgDC+24
+ADDRGP4 CG_Text_Height
+ASGNP4
+ADDRGP4 cgDC+28
+ADDRGP4 trap_R_RegisterModel
+ASGNP4
+ADDRGP4 cgDC+32
+ADDRGP4 trap_R_ModelBounds
+ASGNP4
+ADDRGP4 cgDC+36
+ADDRGP4 CG_FillRect
+ASGNP4
+ADDRGP4 cgDC+40
+ADDRGP4 CG_DrawRect
+ASGNP4
+ADDRGP4 cgDC+44
+ADDRGP4 CG_DrawSides
+ASGNP4
+ADDRGP4 cgDC+48
+ADDRGP4 CG_DrawTopBottom
+ASGNP4
+ADDRGP4 cgDC+52
+ADDRGP4 trap_R_ClearScene
+ASGNP4
+ADDRGP4 cgDC+56
+ADDRGP4 CG_AddRefEntityWithMinLight
+ASGNP4
+ADDRGP4 cgDC+60
+ADDRGP4 trap_R_RenderScene
+ASGNP4
+ADDRGP4 cgDC+64
+ADDRGP4 trap_R_RegisterFont
+ASGNP4
+ADDRGP4 cgDC+68
+ADDRGP4 CG_OwnerDraw
+ASGNP4
+ADDRGP4 cgDC+72
+ADDRGP4 CG_GetValue
+ASGNP4
+ADDRGP4 cgDC+76
+ADDRGP4 CG_OwnerDrawVisible
+ASGNP4
+ADDRGP4 cgDC+80
+ADDRGP4 CG_RunMenuScript
+ASGNP4
+ADDRGP4 cgDC+84
+ADDRGP4 CG_GetTeamColor
+ASGNP4
+ADDRGP4 cgDC+96
+ADDRGP4 trap_Cvar_Set
+ASGNP4
+ADDRGP4 cgDC+88
+ADDRGP4 trap_Cvar_LatchedVariableStringBuffer
+ASGNP4
+ADDRGP4 cgDC+92
+ADDRGP4 CG_Cvar_Get
+ASGNP4
+ADDRGP4 cgDC+100
+ADDRGP4 CG_Text_PaintWithCursor
+ASGNP4
+ADDRGP4 cgDC+104
+ADDRGP4 trap_Key_SetOverstrikeMode
+ASGNP4
+ADDRGP4 cgDC+108
+ADDRGP4 trap_Key_GetOverstrikeMode
+ASGNP4
+ADDRGP4 cgDC+112
+ADDRGP4 trap_S_StartLocalSound
+ASGNP4
+ADDRGP4 cgDC+116
+ADDRGP4 CG_OwnerDrawHandleKey
+ASGNP4
+ADDRGP4 cgDC+120
+ADDRGP4 CG_FeederCount
+ASGNP4
+ADDRGP4 cgDC+128
+ADDRGP4 CG_FeederItemImage
+ASGNP4
+ADDRGP4 cgDC+124
+ADDRGP4 CG_FeederItemText
+ASGNP4
+ADDRGP4 cgDC+132
+ADDRGP4 CG_FeederSelection
+ASGNP4
+ADDRGP4 cgDC+144
+ADDRGP4 trap_Key_SetBinding
+ASGNP4
+ADDRGP4 cgDC+140
+ADDRGP4 trap_Key_GetBindingBuf
+ASGNP4
+ADDRGP4 cgDC+136
+ADDRGP4 trap_Key_KeynumToStringBuf
+ASGNP4
+ADDRGP4 cgDC+148
+ADDRGP4 trap_Key_GetKey
+ASGNP4
+ADDRGP4 cgDC+152
+ADDRGP4 trap_Cmd_ExecuteText
+ASGNP4
+ADDRGP4 cgDC+156
+ADDRGP4 Com_Error
+ASGNP4
+ADDRGP4 cgDC+160
+ADDRGP4 Com_Printf
+ASGNP4
+ADDRGP4 cgDC+168
+ADDRGP4 CG_OwnerDrawWidth
+ASGNP4
+ADDRGP4 cgDC+172
+ADDRGP4 trap_S_RegisterSound
+ASGNP4
+ADDRGP4 cgDC+176
+ADDRGP4 trap_S_StartBackgroundTrack
+ASGNP4
+ADDRGP4 cgDC+180
+ADDRGP4 trap_S_StopBackgroundTrack
+ASGNP4
+ADDRGP4 cgDC+184
+ADDRGP4 CG_PlayCinematic
+ASGNP4
+ADDRGP4 cgDC+188
+ADDRGP4 CG_StopCinematic
+ASGNP4
+ADDRGP4 cgDC+192
+ADDRGP4 CG_DrawCinematic
+ASGNP4
+ADDRGP4 cgDC+196
+ADDRGP4 CG_RunCinematicFrame
+ASGNP4
+ADDRGP4 cgDC+200
+ADDRGP4 CG_AdjustFrom640
+ASGNP4
+ADDRGP4 cgDC+204
+ADDRGP4 CG_SetScreenPlacement
+ASGNP4
+ADDRGP4 cgDC+208
+ADDRGP4 CG_PopScreenPlacement
+ASGNP4
+ADDRGP4 cgDC
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRGP4 Menu_Reset
+CALLV
+pop
+ADDRGP4 $252
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2021
+ADDRLP4 0
+ADDRGP4 $253
+ASGNP4
+LABELV $2021
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadMenus
+CALLV
+pop
+ADDRGP4 CG_HudMenuHacks
+CALLV
+pop
+LABELV $1969
+endproc CG_LoadHudMenu 1028 12
+export CG_HudMenuHacks
+proc CG_HudMenuHacks 36 12
+ADDRGP4 cgDC
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRGP4 $2024
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2025
+ADDRLP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2025
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 Menu_SetScreenPlacement
+CALLV
+pop
+LABELV $2025
+ADDRGP4 $2027
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2028
+ADDRLP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2028
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2030
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menu_FindItemByName
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2031
+ADDRLP4 28
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 36
+NEI4 $2031
+ADDRLP4 28
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2031
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1134559232
+LEF4 $2033
+ADDRLP4 32
+CNSTI4 3
+ASGNI4
+ADDRGP4 $2034
+JUMPV
+LABELV $2033
+ADDRLP4 32
+CNSTI4 2
+ASGNI4
+LABELV $2034
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_SetScreenPlacement
+CALLV
+pop
+LABELV $2031
+LABELV $2028
+LABELV $2023
+endproc CG_HudMenuHacks 36 12
+export CG_AssetCache
+proc CG_AssetCache 92 4
+ADDRGP4 $2038
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61684
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $2041
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61792
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $2044
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61796
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $2048
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61796+4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $2052
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61796+8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $2056
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61796+12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $2060
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61796+16
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $2064
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61796+20
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $2068
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61796+24
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $2072
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61796+28
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $2076
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61796+32
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $2080
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61796+36
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $2084
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61796+40
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $2088
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61796+44
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $2092
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61796+48
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $2095
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61704
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $2098
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61692
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $2101
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61688
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 $2104
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61696
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRGP4 $2107
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61700
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 $2110
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61708
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRGP4 $2113
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61724
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRGP4 $2116
+ARGP4
+ADDRLP4 88
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgDC+232+61728
+ADDRLP4 88
+INDIRI4
+ASGNI4
+LABELV $2035
+endproc CG_AssetCache 92 4
+export CG_ClearState
+proc CG_ClearState 8 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2118
+ADDRGP4 cgs
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 811352
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTF4 1065353216
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 cgs+56044
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $2118
+ADDRGP4 cg
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 688188
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_entities
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 3489792
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_weapons
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2048
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_items
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 6144
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2124
+JUMPV
+LABELV $2121
+CNSTI4 39084
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $2122
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2124
+ADDRLP4 4
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $2121
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_UpdateGlconfig
+CALLV
+pop
+LABELV $2117
+endproc CG_ClearState 8 12
+export CG_SetConnectionState
+proc CG_SetConnectionState 16 4
+ADDRGP4 cg
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $2127
+ADDRGP4 $2126
+JUMPV
+LABELV $2127
+ADDRGP4 cg
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+LEI4 $2131
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+EQI4 $2131
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2132
+JUMPV
+LABELV $2131
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2132
+ADDRGP4 cg+4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2136
+JUMPV
+LABELV $2133
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_UpdateMouseState
+CALLV
+pop
+LABELV $2134
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2136
+ADDRLP4 12
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $2133
+LABELV $2126
+endproc CG_SetConnectionState 16 4
+export CG_Init
+proc CG_Init 16 12
+ADDRGP4 Swap_Init
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearState
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetConnectionState
+CALLV
+pop
+ADDRGP4 CG_RegisterCvars
+CALLV
+pop
+ADDRGP4 CG_InitConsoleCommands
+CALLV
+pop
+ADDRGP4 $2140
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123336
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $2143
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123340
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $2146
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderEx
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123344
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $2140
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderEx
+CALLI4
+ASGNI4
+ADDRGP4 cgs+683776+123348
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 CG_ConsoleInit
+CALLV
+pop
+ADDRGP4 cg_dedicated+12
+INDIRI4
+CNSTI4 0
+EQI4 $2149
+CNSTI4 1
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+ADDRGP4 $2137
+JUMPV
+LABELV $2149
+ADDRGP4 cgDC
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRGP4 String_Init
+CALLV
+pop
+ADDRGP4 cg+4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_Init
+CALLV
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $2153
+CNSTI4 0
+ARGI4
+ADDRGP4 $2155
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 cg_introPlayed+12
+INDIRI4
+CNSTI4 0
+NEI4 $2156
+ADDRGP4 $325
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2159
+ARGP4
+ADDRGP4 $2160
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $2156
+LABELV $2153
+LABELV $2137
+endproc CG_Init 16 12
+export CG_Ingame_Init
+proc CG_Ingame_Init 60 32
+CNSTF4 1065353216
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 cgs+56044
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 cg+515604
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4+4
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4+12
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2170
+JUMPV
+LABELV $2167
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $333
+ARGP4
+ADDRLP4 28
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $249
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LTI4 $2173
+ADDRLP4 32
+INDIRI4
+CNSTI4 64
+LTI4 $2171
+LABELV $2173
+CNSTI4 39084
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $2168
+JUMPV
+LABELV $2171
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 39084
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852+34572
+ADDP4
+ARGP4
+ADDRGP4 trap_GetViewAngles
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_LocalPlayerAdded
+CALLV
+pop
+LABELV $2168
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2170
+ADDRLP4 28
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $2167
+ADDRGP4 cgs+56052
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+56048
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2182
+JUMPV
+LABELV $2179
+CNSTI4 39084
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852+34568
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $2180
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2182
+ADDRLP4 32
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $2179
+ADDRLP4 36
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cgs+59320
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+59316
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+59324
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cgs
+ARGP4
+ADDRGP4 trap_GetGameState
+CALLV
+pop
+CNSTI4 20
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $2190
+ARGP4
+ADDRLP4 44
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $2188
+ADDRGP4 $2191
+ARGP4
+ADDRGP4 $2190
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $2188
+ADDRGP4 CG_HudTextInit
+CALLV
+pop
+CNSTI4 21
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+59304
+ADDRLP4 52
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetMapTitle
+CALLV
+pop
+CNSTI4 248
+ARGI4
+CNSTI4 244
+ARGI4
+ADDRGP4 bg_entityStateFields
+ARGP4
+ADDRGP4 bg_numEntityStateFields
+INDIRI4
+ARGI4
+CNSTI4 500
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 bg_playerStateFields
+ARGP4
+ADDRGP4 bg_numPlayerStateFields
+INDIRI4
+ARGI4
+ADDRGP4 trap_SetNetFields
+CALLV
+pop
+ADDRGP4 CG_ParseServerinfo
+CALLV
+pop
+ADDRGP4 $2193
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 cgs+56120
+ARGP4
+ADDRGP4 trap_CM_LoadMap
+CALLV
+pop
+ADDRGP4 cg+32
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2196
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_RegisterSounds
+CALLV
+pop
+ADDRGP4 $2197
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_RegisterGraphics
+CALLV
+pop
+ADDRGP4 $2198
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_RegisterPlayers
+CALLV
+pop
+ADDRGP4 CG_AssetCache
+CALLV
+pop
+ADDRGP4 CG_LoadHudMenu
+CALLV
+pop
+ADDRGP4 cg+32
+CNSTI4 0
+ASGNI4
+ADDRGP4 CG_InitLocalEntities
+CALLV
+pop
+ADDRGP4 CG_InitMarkPolys
+CALLV
+pop
+ADDRGP4 cg+515632
+CNSTI1 0
+ASGNI1
+ADDRGP4 CG_SetConfigValues
+CALLV
+pop
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+ADDRGP4 cg+516656
+CNSTI4 0
+ASGNI4
+ADDRGP4 $249
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_InitTeamChat
+CALLV
+pop
+ADDRGP4 CG_ShaderStateChanged
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+ADDRGP4 CG_RestoreSnapshot
+CALLV
+pop
+LABELV $2161
+endproc CG_Ingame_Init 60 32
+export CG_KillServer
+proc CG_KillServer 0 8
+ADDRGP4 cgs+56060
+INDIRI4
+CNSTI4 0
+NEI4 $2203
+ADDRGP4 $2202
+JUMPV
+LABELV $2203
+ADDRGP4 $2206
+ARGP4
+ADDRGP4 trap_SV_Shutdown
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+56044
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearState
+CALLV
+pop
+ADDRGP4 cgs+56060
+CNSTI4 0
+ASGNI4
+LABELV $2202
+endproc CG_KillServer 0 8
+export CG_Shutdown
+proc CG_Shutdown 8 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2213
+JUMPV
+LABELV $2210
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 39084
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852+34572
+ADDP4
+ARGP4
+ADDRGP4 trap_SetViewAngles
+CALLV
+pop
+LABELV $2211
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2213
+ADDRLP4 4
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $2210
+LABELV $2209
+endproc CG_Shutdown 8 8
+export CG_Refresh
+proc CG_Refresh 36 20
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetConnectionState
+CALLV
+pop
+ADDRGP4 cg+512312
+ADDRFP4 16
+INDIRI4
+ADDRGP4 cg+512308
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cg+512308
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2223
+JUMPV
+LABELV $2220
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_UpdateMouseState
+CALLV
+pop
+LABELV $2221
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2223
+ADDRLP4 4
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $2220
+ADDRGP4 CG_UpdateCvars
+CALLV
+pop
+ADDRFP4 12
+INDIRI4
+CNSTI4 8
+NEI4 $2224
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $2224
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1142947840
+ASGNF4
+ADDRLP4 20
+CNSTF4 1139802112
+ASGNF4
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRGP4 cg+16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 trap_CIN_SetExtents
+CALLV
+pop
+ADDRGP4 CG_ClearViewport
+CALLV
+pop
+ADDRGP4 cg+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_DrawCinematic
+CALLV
+pop
+ADDRGP4 cg+16
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+NEI4 $2229
+ADDRGP4 CG_StopCinematic_f
+CALLV
+pop
+LABELV $2229
+LABELV $2224
+ADDRGP4 cg_dedicated+12
+INDIRI4
+CNSTI4 0
+NEI4 $2232
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $2232
+ADDRLP4 8
+ADDRGP4 UI_IsFullscreen
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2232
+ADDRGP4 trap_S_StopAllSounds
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_SetActiveMenu
+CALLV
+pop
+LABELV $2232
+ADDRFP4 12
+INDIRI4
+CNSTI4 5
+LTI4 $2235
+ADDRFP4 12
+INDIRI4
+CNSTI4 8
+EQI4 $2235
+ADDRLP4 16
+ADDRGP4 UI_IsFullscreen
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $2235
+ADDRGP4 cgDC
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawActiveFrame
+CALLV
+pop
+LABELV $2235
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+LEI4 $2240
+ADDRFP4 12
+INDIRI4
+CNSTI4 5
+LEI4 $2239
+LABELV $2240
+ADDRLP4 24
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2237
+LABELV $2239
+ADDRGP4 ui_stretch+12
+INDIRI4
+CNSTI4 0
+EQI4 $2241
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 $2242
+JUMPV
+LABELV $2241
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+LABELV $2242
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 UI_Refresh
+CALLV
+pop
+LABELV $2237
+ADDRFP4 12
+INDIRI4
+CNSTI4 2
+LTI4 $2244
+ADDRFP4 12
+INDIRI4
+CNSTI4 7
+GEI4 $2244
+ADDRFP4 12
+INDIRI4
+CNSTI4 5
+LTI4 $2247
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2248
+JUMPV
+LABELV $2247
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+LABELV $2248
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawConnectScreen
+CALLV
+pop
+LABELV $2244
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_RunConsole
+CALLV
+pop
+LABELV $2216
+endproc CG_Refresh 36 20
+proc CG_BindUICommand 12 8
+ADDRLP4 0
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2250
+CNSTI4 0
+RETI4
+ADDRGP4 $2249
+JUMPV
+LABELV $2250
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2254
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2252
+CNSTI4 1
+RETI4
+ADDRGP4 $2249
+JUMPV
+LABELV $2252
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2257
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2255
+CNSTI4 1
+RETI4
+ADDRGP4 $2249
+JUMPV
+LABELV $2255
+CNSTI4 0
+RETI4
+LABELV $2249
+endproc CG_BindUICommand 12 8
+export CG_ParseBinding
+proc CG_ParseBinding 2088 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+ASGNP4
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $2259
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $2259
+ADDRGP4 $2258
+JUMPV
+LABELV $2259
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Key_GetBindingBuf
+CALLV
+pop
+ADDRLP4 16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2261
+ADDRGP4 $2258
+JUMPV
+LABELV $2261
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $2264
+ADDRLP4 1040
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2265
+JUMPV
+LABELV $2264
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+LABELV $2265
+ADDRLP4 8
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $2267
+ADDRLP4 1044
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2268
+JUMPV
+LABELV $2267
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+LABELV $2268
+ADDRLP4 12
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRGP4 $2270
+JUMPV
+LABELV $2272
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $2273
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 32
+EQI4 $2272
+ADDRLP4 1048
+INDIRI4
+CNSTI4 12
+EQI4 $2272
+ADDRLP4 1048
+INDIRI4
+CNSTI4 10
+EQI4 $2272
+ADDRLP4 1048
+INDIRI4
+CNSTI4 13
+EQI4 $2272
+ADDRLP4 1048
+INDIRI4
+CNSTI4 9
+EQI4 $2272
+ADDRLP4 1048
+INDIRI4
+CNSTI4 11
+EQI4 $2272
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 59
+ARGI4
+ADDRLP4 1052
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2275
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $2275
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 43
+NEI4 $2277
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+NEI4 $2281
+ADDRLP4 12
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+EQI4 $2278
+ADDRFP4 4
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+NEI4 $2278
+LABELV $2281
+ADDRLP4 1060
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2282
+ARGP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2284
+ADDRLP4 2084
+CNSTI4 43
+ASGNI4
+ADDRGP4 $2285
+JUMPV
+LABELV $2284
+ADDRLP4 2084
+CNSTI4 45
+ASGNI4
+LABELV $2285
+ADDRLP4 2084
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 1060
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2278
+JUMPV
+LABELV $2277
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2286
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2290
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 CG_BindUICommand
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $2288
+LABELV $2290
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2291
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $2288
+LABELV $2286
+LABELV $2278
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2292
+ADDRGP4 $2271
+JUMPV
+LABELV $2292
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $2270
+ADDRGP4 $2273
+JUMPV
+LABELV $2271
+LABELV $2258
+endproc CG_ParseBinding 2088 36
+export Message_Key
+proc Message_Key 1036 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2295
+ADDRGP4 $2294
+JUMPV
+LABELV $2295
+ADDRFP4 0
+INDIRI4
+CNSTI4 2147483648
+BANDI4
+CNSTI4 0
+EQI4 $2297
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2147483647
+BANDI4
+ASGNI4
+ADDRGP4 cg+517792
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 MField_CharEvent
+CALLV
+pop
+ADDRGP4 $2294
+JUMPV
+LABELV $2297
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+NEI4 $2300
+ADDRLP4 1024
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 -5
+BANDI4
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+ADDRGP4 cg+517792
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRGP4 $2294
+JUMPV
+LABELV $2300
+ADDRFP4 0
+INDIRI4
+CNSTI4 13
+EQI4 $2305
+ADDRFP4 0
+INDIRI4
+CNSTI4 175
+NEI4 $2303
+LABELV $2305
+ADDRLP4 1028
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+517792+12
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+EQI4 $2306
+ADDRGP4 cg+4
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+EQI4 $2306
+ADDRGP4 cg+517792
+ARGP4
+ADDRLP4 1032
+ADDRGP4 MField_Buffer
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2311
+ARGP4
+ADDRGP4 cg+517696
+ARGP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $2306
+ADDRLP4 1032
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 -5
+BANDI4
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+ADDRGP4 cg+517792
+ARGP4
+ADDRGP4 MField_Clear
+CALLV
+pop
+ADDRGP4 $2294
+JUMPV
+LABELV $2303
+ADDRGP4 cg+517792
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 MField_KeyDownEvent
+CALLV
+pop
+LABELV $2294
+endproc Message_Key 1036 20
+export CG_DistributeKeyEvent
+proc CG_DistributeKeyEvent 40 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetConnectionState
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 166
+LTI4 $2318
+ADDRFP4 0
+INDIRI4
+CNSTI4 183
+GTI4 $2318
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2322-664
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2322
+address $2319
+address $2319
+address $2319
+address $2319
+address $2319
+address $2319
+address $2319
+address $2319
+address $2319
+address $2318
+address $2319
+address $2319
+address $2318
+address $2318
+address $2318
+address $2318
+address $2318
+address $2319
+code
+LABELV $2319
+ADDRLP4 8
+ADDRGP4 UI_WantsBindKeys
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2318
+ADDRLP4 12
+ADDRGP4 trap_Key_GetNumLockMode
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2318
+ADDRGP4 $2316
+JUMPV
+LABELV $2318
+ADDRFP4 0
+INDIRI4
+CNSTI4 575
+EQI4 $2327
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+NEI4 $2324
+CNSTI4 139
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2327
+CNSTI4 140
+ARGI4
+ADDRLP4 16
+ADDRGP4 trap_Key_IsDown
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $2324
+LABELV $2327
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2316
+ADDRGP4 Con_ToggleConsole_f
+CALLV
+pop
+ADDRGP4 $2316
+JUMPV
+LABELV $2324
+ADDRLP4 20
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $2336
+ADDRFP4 0
+INDIRI4
+CNSTI4 184
+EQI4 $2336
+ADDRFP4 0
+INDIRI4
+CNSTI4 193
+EQI4 $2336
+ADDRFP4 0
+INDIRI4
+CNSTI4 218
+EQI4 $2336
+ADDRFP4 0
+INDIRI4
+CNSTI4 243
+EQI4 $2336
+ADDRFP4 0
+INDIRI4
+CNSTI4 268
+NEI4 $2330
+LABELV $2336
+ADDRLP4 28
+ADDRGP4 trap_GetDemoState
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $2337
+ADDRFP4 12
+INDIRI4
+CNSTI4 8
+NEI4 $2330
+LABELV $2337
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2330
+ADDRGP4 cg_cameraMode+12
+INDIRI4
+CNSTI4 0
+NEI4 $2338
+ADDRGP4 $2341
+ARGP4
+ADDRGP4 $249
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRFP4 0
+CNSTI4 27
+ASGNI4
+LABELV $2338
+LABELV $2330
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+NEI4 $2342
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $2344
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+BANDI4
+ADDRLP4 32
+INDIRI4
+NEI4 $2344
+ADDRFP4 12
+INDIRI4
+CNSTI4 7
+NEI4 $2346
+ADDRLP4 36
+ADDRGP4 trap_GetDemoState
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+EQI4 $2346
+CNSTI4 2
+ARGI4
+ADDRGP4 UI_SetActiveMenu
+CALLV
+pop
+ADDRGP4 $2316
+JUMPV
+LABELV $2346
+ADDRFP4 12
+INDIRI4
+CNSTI4 8
+NEI4 $2348
+ADDRGP4 CG_StopCinematic_f
+CALLV
+pop
+ADDRGP4 $2316
+JUMPV
+LABELV $2348
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $2316
+CNSTI4 2
+ARGI4
+ADDRGP4 $2352
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2316
+JUMPV
+LABELV $2344
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 $2343
+JUMPV
+LABELV $2342
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_ParseBinding
+CALLV
+pop
+LABELV $2343
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2353
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Console_Key
+CALLV
+pop
+ADDRGP4 $2354
+JUMPV
+LABELV $2353
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $2355
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Message_Key
+CALLV
+pop
+ADDRGP4 $2356
+JUMPV
+LABELV $2355
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $2357
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 32
+INDIRI4
+EQI4 $2357
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_KeyEvent
+CALLV
+pop
+ADDRGP4 $2358
+JUMPV
+LABELV $2357
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2360
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_KeyEvent
+CALLV
+pop
+ADDRGP4 $2361
+JUMPV
+LABELV $2360
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $2362
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Console_Key
+CALLV
+pop
+LABELV $2362
+LABELV $2361
+LABELV $2358
+LABELV $2356
+LABELV $2354
+LABELV $2316
+endproc CG_DistributeKeyEvent 40 28
+export CG_DistributeCharEvent
+proc CG_DistributeCharEvent 16 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetConnectionState
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2147483648
+BORI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2365
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Console_Key
+CALLV
+pop
+ADDRGP4 $2366
+JUMPV
+LABELV $2365
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $2367
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Message_Key
+CALLV
+pop
+ADDRGP4 $2368
+JUMPV
+LABELV $2367
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $2369
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 12
+INDIRI4
+EQI4 $2369
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_KeyEvent
+CALLV
+pop
+ADDRGP4 $2370
+JUMPV
+LABELV $2369
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2372
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_KeyEvent
+CALLV
+pop
+ADDRGP4 $2373
+JUMPV
+LABELV $2372
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $2374
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Console_Key
+CALLV
+pop
+LABELV $2374
+LABELV $2373
+LABELV $2370
+LABELV $2368
+LABELV $2366
+LABELV $2364
+endproc CG_DistributeCharEvent 16 8
+export CG_UpdateMouseState
+proc CG_UpdateMouseState 16 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2377
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $2377
+ADDRLP4 8
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2379
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 $2380
+JUMPV
+LABELV $2379
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+20
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $2387
+ADDRGP4 cg
+INDIRI4
+CNSTI4 7
+NEI4 $2387
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2381
+CNSTI4 500
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 12288
+BANDI4
+ADDRLP4 12
+INDIRI4
+EQI4 $2381
+LABELV $2387
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $2382
+JUMPV
+LABELV $2381
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2388
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $2388
+LABELV $2382
+LABELV $2380
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_Mouse_SetState
+CALLV
+pop
+LABELV $2376
+endproc CG_UpdateMouseState 16 8
+data
+align 4
+LABELV keyCatchers
+byte 4 0
+export Key_GetCatcher
+code
+proc Key_GetCatcher 0 0
+ADDRGP4 keyCatchers
+INDIRI4
+RETI4
+LABELV $2390
+endproc Key_GetCatcher 0 0
+export Key_SetCatcher
+proc Key_SetCatcher 4 4
+ADDRFP4 0
+INDIRI4
+ADDRGP4 keyCatchers
+INDIRI4
+EQI4 $2392
+ADDRGP4 trap_Key_ClearStates
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2395
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2396
+JUMPV
+LABELV $2395
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2396
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_Key_SetRepeat
+CALLV
+pop
+LABELV $2392
+ADDRGP4 keyCatchers
+ADDRFP4 0
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_UpdateMouseState
+CALLV
+pop
+LABELV $2391
+endproc Key_SetCatcher 4 4
+proc CG_MousePosition 60 16
+ADDRGP4 ui_stretch+12
+INDIRI4
+CNSTI4 0
+EQI4 $2398
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 $2399
+JUMPV
+LABELV $2398
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+LABELV $2399
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 44
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 UI_GetCursorPos
+CALLV
+pop
+ADDRLP4 52
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 32
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+CNSTF4 1142947840
+ADDF4
+DIVF4
+ADDRGP4 cgs+20100+35880
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+ADDF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+CNSTF4 1139802112
+ADDF4
+DIVF4
+ADDRGP4 cgs+20100+35884
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 16
+LSHI4
+BORI4
+RETI4
+LABELV $2397
+endproc CG_MousePosition 60 16
+proc CG_SetMousePosition 52 16
+ADDRGP4 ui_stretch+12
+INDIRI4
+CNSTI4 0
+EQI4 $2406
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+ADDRGP4 $2407
+JUMPV
+LABELV $2406
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetScreenPlacement
+CALLV
+pop
+LABELV $2407
+ADDRLP4 32
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 24
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDRGP4 cgs+20100+35880
+INDIRI4
+CVIF4 4
+DIVF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+CNSTF4 1142947840
+ADDF4
+MULF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ADDRGP4 cgs+20100+35884
+INDIRI4
+CVIF4 4
+DIVF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+CNSTF4 1139802112
+ADDF4
+MULF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 UI_SetCursorPos
+CALLV
+pop
+LABELV $2405
+endproc CG_SetMousePosition 52 16
+export CG_JoystickEvent
+proc CG_JoystickEvent 32 12
+ADDRGP4 cg_joystickDebug+12
+INDIRI4
+CNSTI4 0
+EQI4 $2414
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_JoyEventToString
+CALLV
+pop
+ADDRGP4 $2417
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $2414
+LABELV $2413
+endproc CG_JoystickEvent 32 12
+export CG_JoystickAxisEvent
+proc CG_JoystickAxisEvent 88 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2421
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2419
+LABELV $2421
+ADDRGP4 $2418
+JUMPV
+LABELV $2419
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $2424
+ADDRFP4 4
+INDIRI4
+CNSTI4 16
+LTI4 $2422
+LABELV $2424
+ADDRGP4 $2425
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $2422
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0+4+4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_GetKeyForJoyEvent
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 12+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12+4+4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_GetKeyForJoyEvent
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 52
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 cg+531852+34488
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 cg+531852+34488
+ADDP4
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $2440
+ADDRFP4 8
+INDIRI4
+ADDRLP4 72
+INDIRI4
+GEI4 $2441
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2442
+JUMPV
+LABELV $2441
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $2442
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+GEI4 $2443
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2444
+JUMPV
+LABELV $2443
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+LABELV $2444
+ADDRLP4 60
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $2436
+LABELV $2440
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+GEI4 $2445
+ADDRLP4 28
+INDIRI4
+CNSTI4 -1
+EQI4 $2446
+ADDRLP4 28
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRU4
+ARGU4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+NEGI4
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+ADDRGP4 $2446
+JUMPV
+LABELV $2445
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+LEI4 $2449
+ADDRLP4 32
+INDIRI4
+CNSTI4 -1
+EQI4 $2451
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRU4
+ARGU4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+LABELV $2451
+LABELV $2449
+LABELV $2446
+LABELV $2436
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 76
+INDIRI4
+GEI4 $2453
+ADDRLP4 24
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LTI4 $2453
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_JoystickEvent
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+CNSTI4 -1
+EQI4 $2454
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 80
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRU4
+ARGU4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+NEGI4
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+ADDRGP4 $2454
+JUMPV
+LABELV $2453
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LEI4 $2457
+ADDRLP4 24
+INDIRI4
+ADDRLP4 80
+INDIRI4
+GTI4 $2457
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_JoystickEvent
+CALLV
+pop
+ADDRLP4 32
+INDIRI4
+CNSTI4 -1
+EQI4 $2459
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRU4
+ARGU4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+LABELV $2459
+LABELV $2457
+LABELV $2454
+LABELV $2418
+endproc CG_JoystickAxisEvent 88 24
+export CG_JoystickButtonEvent
+proc CG_JoystickButtonEvent 28 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2464
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2462
+LABELV $2464
+ADDRGP4 $2461
+JUMPV
+LABELV $2462
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $2467
+ADDRFP4 4
+INDIRI4
+CNSTI4 16
+LTI4 $2465
+LABELV $2467
+ADDRGP4 $2468
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $2465
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_GetKeyForJoyEvent
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2470
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_JoystickEvent
+CALLV
+pop
+LABELV $2470
+ADDRLP4 12
+INDIRI4
+CNSTI4 -1
+EQI4 $2472
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRU4
+ARGU4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+LABELV $2472
+LABELV $2461
+endproc CG_JoystickButtonEvent 28 24
+export CG_JoystickHatEvent
+proc CG_JoystickHatEvent 124 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRU4
+ASGNU4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2477
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2475
+LABELV $2477
+ADDRGP4 $2474
+JUMPV
+LABELV $2475
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $2480
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $2478
+LABELV $2480
+ADDRGP4 $2481
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $2478
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4+4+4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_GetKeyForJoyEvent
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 4+12
+CNSTI4 3
+ASGNI4
+ADDRLP4 4+12+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4+12+4+4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_GetKeyForJoyEvent
+CALLI4
+ASGNI4
+ADDRLP4 56+4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 4+24
+CNSTI4 3
+ASGNI4
+ADDRLP4 4+24+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4+24+4+4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4+24
+ARGP4
+ADDRLP4 88
+ADDRGP4 trap_GetKeyForJoyEvent
+CALLI4
+ASGNI4
+ADDRLP4 56+8
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 4+36
+CNSTI4 3
+ASGNI4
+ADDRLP4 4+36+4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4+36+4+4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4+36
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_GetKeyForJoyEvent
+CALLI4
+ASGNI4
+ADDRLP4 56+12
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 52
+ADDRFP4 4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+ADDRGP4 cg+531852+34552
+ADDP4
+ADDP4
+INDIRU1
+CVUI4 1
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+ADDRGP4 cg+531852+34552
+ADDP4
+ADDP4
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2513
+ADDRLP4 104
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 104
+INDIRI4
+BANDI4
+ADDRLP4 108
+INDIRI4
+EQI4 $2517
+ADDRFP4 8
+INDIRI4
+ADDRLP4 104
+INDIRI4
+BANDI4
+ADDRLP4 108
+INDIRI4
+NEI4 $2517
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 56
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $2519
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRU4
+ARGU4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+LABELV $2519
+LABELV $2517
+LABELV $2514
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2513
+ADDRLP4 108
+CNSTI4 3
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 108
+INDIRI4
+EQI4 $2523
+ADDRFP4 8
+INDIRI4
+CNSTI4 6
+EQI4 $2523
+ADDRFP4 8
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LTI4 $2522
+LABELV $2526
+ADDRFP4 8
+INDIRI4
+CNSTI4 9
+EQI4 $2523
+ADDRFP4 8
+INDIRI4
+CNSTI4 12
+EQI4 $2523
+ADDRGP4 $2522
+JUMPV
+LABELV $2523
+ADDRLP4 116
+ADDRGP4 UI_WantsBindKeys
+CALLI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+EQI4 $2522
+ADDRGP4 $2474
+JUMPV
+LABELV $2522
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2527
+ADDRLP4 116
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 116
+INDIRI4
+BANDI4
+ADDRLP4 120
+INDIRI4
+NEI4 $2531
+ADDRFP4 8
+INDIRI4
+ADDRLP4 116
+INDIRI4
+BANDI4
+ADDRLP4 120
+INDIRI4
+EQI4 $2531
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRGP4 CG_JoystickEvent
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 56
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $2533
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 56
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRFP4 12
+INDIRU4
+ARGU4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DistributeKeyEvent
+CALLV
+pop
+LABELV $2533
+LABELV $2531
+LABELV $2528
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2527
+LABELV $2474
+endproc CG_JoystickHatEvent 124 24
+bss
+align 1
+LABELV $2536
+skip 256
+code
+proc CG_VoIPString 304 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2541
+ADDRLP4 260
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 260
+INDIRI4
+GTI4 $2541
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $2537
+LABELV $2541
+CNSTP4 0
+RETP4
+ADDRGP4 $2535
+JUMPV
+LABELV $2537
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2544
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 264
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $2542
+ADDRLP4 280
+CNSTI4 0
+ASGNI4
+ADDRLP4 268
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRGP4 $2548
+JUMPV
+LABELV $2545
+CNSTI4 2108
+ADDRLP4 268
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2554
+ADDRLP4 268
+INDIRI4
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+INDIRI4
+NEI4 $2550
+LABELV $2554
+ADDRGP4 $2546
+JUMPV
+LABELV $2550
+ADDRLP4 288
+CNSTI4 2108
+ASGNI4
+ADDRLP4 288
+INDIRI4
+ADDRLP4 268
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+EQI4 $2555
+ADDRGP4 $2546
+JUMPV
+LABELV $2555
+ADDRLP4 272
+INDIRI4
+ADDRGP4 $2536
+ADDP4
+ARGP4
+CNSTU4 256
+ADDRLP4 272
+INDIRI4
+CVIU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+LEI4 $2564
+ADDRLP4 292
+ADDRGP4 $2562
+ASGNP4
+ADDRGP4 $2565
+JUMPV
+LABELV $2564
+ADDRLP4 292
+ADDRGP4 $249
+ASGNP4
+LABELV $2565
+ADDRLP4 292
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 Com_sprintf
+CALLI4
+ASGNI4
+ADDRLP4 276
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+ADDRLP4 276
+INDIRI4
+ADDI4
+CNSTI4 1
+ADDI4
+CVIU4 4
+CNSTU4 256
+LTU4 $2566
+ADDRGP4 $2568
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $2547
+JUMPV
+LABELV $2566
+ADDRLP4 272
+ADDRLP4 272
+INDIRI4
+ADDRLP4 276
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $2546
+ADDRLP4 268
+ADDRLP4 268
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2548
+ADDRLP4 268
+INDIRI4
+ADDRGP4 cgs+56116
+INDIRI4
+LTI4 $2545
+LABELV $2547
+ADDRLP4 272
+INDIRI4
+ADDRGP4 $2536
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $2543
+JUMPV
+LABELV $2542
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2571
+ARGP4
+CNSTI4 9
+ARGI4
+ADDRLP4 268
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+NEI4 $2569
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 272
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRGP4 $2536
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $2572
+ARGP4
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $2570
+JUMPV
+LABELV $2569
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2575
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRLP4 276
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $2573
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 280
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRGP4 $2536
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $2572
+ARGP4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $2574
+JUMPV
+LABELV $2573
+CNSTP4 0
+RETP4
+ADDRGP4 $2535
+JUMPV
+LABELV $2574
+LABELV $2570
+LABELV $2543
+ADDRGP4 $2536
+RETP4
+LABELV $2535
+endproc CG_VoIPString 304 20
+proc CG_UpdateGlconfig 20 4
+ADDRLP4 4
+ADDRGP4 cgs+20100+35880
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cgs+20100+35884
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+20100
+ARGP4
+ADDRGP4 trap_GetGlconfig
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2587
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+20100+35880
+INDIRI4
+NEI4 $2589
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cgs+20100+35884
+INDIRI4
+EQI4 $2587
+LABELV $2589
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2588
+JUMPV
+LABELV $2587
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $2588
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $2592
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $2590
+ADDRGP4 cg
+INDIRI4
+CNSTI4 7
+EQI4 $2590
+LABELV $2592
+ADDRGP4 cg+515608
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+515604
+CNSTI4 1
+ASGNI4
+ADDRGP4 CG_CalcVrect
+CALLV
+pop
+LABELV $2590
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2595
+ADDRGP4 CG_ConsoleResized
+CALLV
+pop
+ADDRGP4 UI_WindowResized
+CALLV
+pop
+LABELV $2595
+LABELV $2576
+endproc CG_UpdateGlconfig 20 4
+bss
+export cg_joystickDebug
+align 4
+LABELV cg_joystickDebug
+skip 272
+export cg_introPlayed
+align 4
+LABELV cg_introPlayed
+skip 272
+export cg_pmove_msec
+align 4
+LABELV cg_pmove_msec
+skip 272
+export cg_hudFiles
+align 4
+LABELV cg_hudFiles
+skip 272
+export cgDC
+align 4
+LABELV cgDC
+skip 104124
+import Controls_SetDefaults_ui_shared
+import Controls_SetConfig_ui_shared
+import Controls_GetConfig_ui_shared
+import UI_OutOfMemory
+import UI_InitMemory_ui_shared
+import UI_Alloc_ui_shared
+import Menu_FindItemByName
+import Display_ScriptExecutions
+import Display_DebugMode
+import Display_CacheAll
+import Menu_SetScreenPlacement
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_WantsBindKeys
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import Script_Compile
+import PC_CompiledScript_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import UI_DrawProportionalString
+import UI_WindowResized
+import UI_WantsBindKeys
+import UI_DrawConnectScreen
+import UI_ConsoleCommand
+import UI_SetActiveMenu
+import UI_Refresh
+import UI_IsFullscreen
+import UI_SetCursorPos
+import UI_GetCursorPos
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import ui_numCommands
+import ui_commands
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_LoadVoiceChats
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+export cg_currentSelectedPlayerName
+align 4
+LABELV cg_currentSelectedPlayerName
+skip 1088
+export cg_currentSelectedPlayer
+align 4
+LABELV cg_currentSelectedPlayer
+skip 1088
+export cg_thirdPersonSmooth
+align 4
+LABELV cg_thirdPersonSmooth
+skip 1088
+export cg_thirdPersonHeight
+align 4
+LABELV cg_thirdPersonHeight
+skip 1088
+export cg_thirdPersonAngle
+align 4
+LABELV cg_thirdPersonAngle
+skip 1088
+export cg_thirdPersonRange
+align 4
+LABELV cg_thirdPersonRange
+skip 1088
+export cg_thirdPerson
+align 4
+LABELV cg_thirdPerson
+skip 1088
+export cg_drawGun
+align 4
+LABELV cg_drawGun
+skip 1088
+export cg_cyclePastGauntlet
+align 4
+LABELV cg_cyclePastGauntlet
+skip 1088
+export cg_autoswitch
+align 4
+LABELV cg_autoswitch
+skip 1088
+export cg_teampref
+align 4
+LABELV cg_teampref
+skip 1088
+export cg_teamtask
+align 4
+LABELV cg_teamtask
+skip 1088
+export cg_handicap
+align 4
+LABELV cg_handicap
+skip 1088
+export cg_color2
+align 4
+LABELV cg_color2
+skip 1088
+export cg_color1
+align 4
+LABELV cg_color1
+skip 1088
+export cg_defaultFemaleTeamHeadModel
+align 4
+LABELV cg_defaultFemaleTeamHeadModel
+skip 272
+export cg_defaultFemaleTeamModel
+align 4
+LABELV cg_defaultFemaleTeamModel
+skip 272
+export cg_defaultMaleTeamHeadModel
+align 4
+LABELV cg_defaultMaleTeamHeadModel
+skip 272
+export cg_defaultMaleTeamModel
+align 4
+LABELV cg_defaultMaleTeamModel
+skip 272
+export cg_defaultTeamModelGender
+align 4
+LABELV cg_defaultTeamModelGender
+skip 272
+export cg_defaultFemaleHeadModel
+align 4
+LABELV cg_defaultFemaleHeadModel
+skip 272
+export cg_defaultFemaleModel
+align 4
+LABELV cg_defaultFemaleModel
+skip 272
+export cg_defaultMaleHeadModel
+align 4
+LABELV cg_defaultMaleHeadModel
+skip 272
+export cg_defaultMaleModel
+align 4
+LABELV cg_defaultMaleModel
+skip 272
+export cg_defaultModelGender
+align 4
+LABELV cg_defaultModelGender
+skip 272
+export cg_obeliskRespawnDelay
+align 4
+LABELV cg_obeliskRespawnDelay
+skip 272
+export cg_recordSPDemoName
+align 4
+LABELV cg_recordSPDemoName
+skip 272
+export cg_recordSPDemo
+align 4
+LABELV cg_recordSPDemo
+skip 272
+export cg_enableBreath
+align 4
+LABELV cg_enableBreath
+skip 272
+export cg_enableDust
+align 4
+LABELV cg_enableDust
+skip 272
+export cg_blueTeamName
+align 4
+LABELV cg_blueTeamName
+skip 272
+export cg_redTeamName
+align 4
+LABELV cg_redTeamName
+skip 272
+export ui_stretch
+align 4
+LABELV ui_stretch
+skip 272
+export cg_numberFontBorder
+align 4
+LABELV cg_numberFontBorder
+skip 272
+export cg_numberFont
+align 4
+LABELV cg_numberFont
+skip 272
+export cg_hudFontBorder
+align 4
+LABELV cg_hudFontBorder
+skip 272
+export cg_hudFont
+align 4
+LABELV cg_hudFont
+skip 272
+export cg_consoleFontSize
+align 4
+LABELV cg_consoleFontSize
+skip 272
+export cg_consoleFont
+align 4
+LABELV cg_consoleFont
+skip 272
+export cg_drawBBox
+align 4
+LABELV cg_drawBBox
+skip 272
+export cg_drawGrappleHook
+align 4
+LABELV cg_drawGrappleHook
+skip 272
+export cg_forceBitmapFonts
+align 4
+LABELV cg_forceBitmapFonts
+skip 272
+export cg_antiLag
+align 4
+LABELV cg_antiLag
+skip 272
+export cg_smoothBodySink
+align 4
+LABELV cg_smoothBodySink
+skip 272
+export cg_oldBubbles
+align 4
+LABELV cg_oldBubbles
+skip 272
+export cg_drawPickupItems
+align 4
+LABELV cg_drawPickupItems
+skip 272
+export cg_skybox
+align 4
+LABELV cg_skybox
+skip 272
+export cg_fadeExplosions
+align 4
+LABELV cg_fadeExplosions
+skip 272
+export cg_fovAspectAdjust
+align 4
+LABELV cg_fovAspectAdjust
+skip 272
+export cg_coronas
+align 4
+LABELV cg_coronas
+skip 272
+export cg_coronafardist
+align 4
+LABELV cg_coronafardist
+skip 272
+export cg_drawShaderInfo
+align 4
+LABELV cg_drawShaderInfo
+skip 272
+export cg_consoleLatency
+align 4
+LABELV cg_consoleLatency
+skip 272
+export cg_voipShowCrosshairMeter
+align 4
+LABELV cg_voipShowCrosshairMeter
+skip 272
+export cg_voipShowMeter
+align 4
+LABELV cg_voipShowMeter
+skip 272
+export cg_teamDmLeadAnnouncements
+align 4
+LABELV cg_teamDmLeadAnnouncements
+skip 272
+export cg_atmosphericEffects
+align 4
+LABELV cg_atmosphericEffects
+skip 272
+export cg_railSegmentLength
+align 4
+LABELV cg_railSegmentLength
+skip 272
+export cg_railCoreWidth
+align 4
+LABELV cg_railCoreWidth
+skip 272
+export cg_railWidth
+align 4
+LABELV cg_railWidth
+skip 272
+export cg_trueLightning
+align 4
+LABELV cg_trueLightning
+skip 272
+export cg_oldPlasma
+align 4
+LABELV cg_oldPlasma
+skip 272
+export cg_oldRocket
+align 4
+LABELV cg_oldRocket
+skip 272
+export cg_oldRail
+align 4
+LABELV cg_oldRail
+skip 272
+export cg_noProjectileTrail
+align 4
+LABELV cg_noProjectileTrail
+skip 272
+export cg_noTaunt
+align 4
+LABELV cg_noTaunt
+skip 272
+export cg_bigFont
+align 4
+LABELV cg_bigFont
+skip 272
+export cg_smallFont
+align 4
+LABELV cg_smallFont
+skip 272
+export cg_cameraMode
+align 4
+LABELV cg_cameraMode
+skip 272
+export cg_timescale
+align 4
+LABELV cg_timescale
+skip 272
+export cg_timescaleFadeSpeed
+align 4
+LABELV cg_timescaleFadeSpeed
+skip 272
+export cg_timescaleFadeEnd
+align 4
+LABELV cg_timescaleFadeEnd
+skip 272
+export pmove_msec
+align 4
+LABELV pmove_msec
+skip 272
+export pmove_fixed
+align 4
+LABELV pmove_fixed
+skip 272
+export pmove_overbounce
+align 4
+LABELV pmove_overbounce
+skip 272
+export cg_smoothClients
+align 4
+LABELV cg_smoothClients
+skip 272
+export cg_scorePlum
+align 4
+LABELV cg_scorePlum
+skip 272
+export cg_noVoiceText
+align 4
+LABELV cg_noVoiceText
+skip 272
+export cg_noVoiceChats
+align 4
+LABELV cg_noVoiceChats
+skip 272
+export cg_teamChatsOnly
+align 4
+LABELV cg_teamChatsOnly
+skip 272
+export cg_drawFriend
+align 4
+LABELV cg_drawFriend
+skip 272
+export cg_deferPlayers
+align 4
+LABELV cg_deferPlayers
+skip 272
+export cg_predictItems
+align 4
+LABELV cg_predictItems
+skip 272
+export cg_blood
+align 4
+LABELV cg_blood
+skip 272
+export cg_paused
+align 4
+LABELV cg_paused
+skip 272
+export cg_buildScript
+align 4
+LABELV cg_buildScript
+skip 272
+export cg_forceModel
+align 4
+LABELV cg_forceModel
+skip 272
+export cg_stats
+align 4
+LABELV cg_stats
+skip 272
+export cg_singlePlayer
+align 4
+LABELV cg_singlePlayer
+skip 272
+export cg_synchronousClients
+align 4
+LABELV cg_synchronousClients
+skip 272
+export cg_drawAttacker
+align 4
+LABELV cg_drawAttacker
+skip 272
+export cg_drawLagometer
+align 4
+LABELV cg_drawLagometer
+skip 272
+export cg_hudTextScale
+align 4
+LABELV cg_hudTextScale
+skip 272
+export cg_splitviewTextScale
+align 4
+LABELV cg_splitviewTextScale
+skip 272
+export cg_splitviewThirdEqual
+align 4
+LABELV cg_splitviewThirdEqual
+skip 272
+export cg_splitviewVertical
+align 4
+LABELV cg_splitviewVertical
+skip 272
+export cg_weaponFov
+align 4
+LABELV cg_weaponFov
+skip 272
+export cg_zoomFov
+align 4
+LABELV cg_zoomFov
+skip 272
+export cg_fov
+align 4
+LABELV cg_fov
+skip 272
+export cg_simpleItems
+align 4
+LABELV cg_simpleItems
+skip 272
+export cg_ignore
+align 4
+LABELV cg_ignore
+skip 272
+export cg_tracerLength
+align 4
+LABELV cg_tracerLength
+skip 272
+export cg_tracerWidth
+align 4
+LABELV cg_tracerWidth
+skip 272
+export cg_tracerChance
+align 4
+LABELV cg_tracerChance
+skip 272
+export cg_viewsize
+align 4
+LABELV cg_viewsize
+skip 272
+export cg_gun_z
+align 4
+LABELV cg_gun_z
+skip 272
+export cg_gun_y
+align 4
+LABELV cg_gun_y
+skip 272
+export cg_gun_x
+align 4
+LABELV cg_gun_x
+skip 272
+export cg_gun_frame
+align 4
+LABELV cg_gun_frame
+skip 272
+export cg_brassTime
+align 4
+LABELV cg_brassTime
+skip 272
+export cg_addMarks
+align 4
+LABELV cg_addMarks
+skip 272
+export cg_footsteps
+align 4
+LABELV cg_footsteps
+skip 272
+export cg_showPolyBuffers
+align 4
+LABELV cg_showPolyBuffers
+skip 272
+export cg_showTraceTests
+align 4
+LABELV cg_showTraceTests
+skip 272
+export cg_optimizePrediction
+align 4
+LABELV cg_optimizePrediction
+skip 272
+export cg_showmiss
+align 4
+LABELV cg_showmiss
+skip 272
+export cg_noPlayerAnims
+align 4
+LABELV cg_noPlayerAnims
+skip 272
+export cg_nopredict
+align 4
+LABELV cg_nopredict
+skip 272
+export cg_errorDecay
+align 4
+LABELV cg_errorDecay
+skip 272
+export cg_railTrailTime
+align 4
+LABELV cg_railTrailTime
+skip 272
+export cg_debugEvents
+align 4
+LABELV cg_debugEvents
+skip 272
+export cg_debugPosition
+align 4
+LABELV cg_debugPosition
+skip 272
+export cg_debugAnim
+align 4
+LABELV cg_debugAnim
+skip 272
+export cg_animSpeed
+align 4
+LABELV cg_animSpeed
+skip 272
+export cg_draw2D
+align 4
+LABELV cg_draw2D
+skip 272
+export cg_drawStatus
+align 4
+LABELV cg_drawStatus
+skip 272
+export cg_crosshairHealth
+align 4
+LABELV cg_crosshairHealth
+skip 272
+export cg_crosshairSize
+align 4
+LABELV cg_crosshairSize
+skip 272
+export cg_crosshairY
+align 4
+LABELV cg_crosshairY
+skip 272
+export cg_crosshairX
+align 4
+LABELV cg_crosshairX
+skip 272
+export cg_teamOverlayUserinfo
+align 4
+LABELV cg_teamOverlayUserinfo
+skip 272
+export cg_drawTeamOverlay
+align 4
+LABELV cg_drawTeamOverlay
+skip 272
+export cg_drawRewards
+align 4
+LABELV cg_drawRewards
+skip 272
+export cg_drawCrosshairNames
+align 4
+LABELV cg_drawCrosshairNames
+skip 272
+export cg_drawCrosshair
+align 4
+LABELV cg_drawCrosshair
+skip 272
+export cg_drawAmmoWarning
+align 4
+LABELV cg_drawAmmoWarning
+skip 272
+export cg_drawIcons
+align 4
+LABELV cg_drawIcons
+skip 272
+export cg_draw3dIcons
+align 4
+LABELV cg_draw3dIcons
+skip 272
+export cg_drawSnapshot
+align 4
+LABELV cg_drawSnapshot
+skip 272
+export cg_drawFPS
+align 4
+LABELV cg_drawFPS
+skip 272
+export cg_drawTimer
+align 4
+LABELV cg_drawTimer
+skip 272
+export cg_gibs
+align 4
+LABELV cg_gibs
+skip 272
+export cg_shadows
+align 4
+LABELV cg_shadows
+skip 272
+export cg_swingSpeed
+align 4
+LABELV cg_swingSpeed
+skip 272
+export cg_bobroll
+align 4
+LABELV cg_bobroll
+skip 272
+export cg_bobpitch
+align 4
+LABELV cg_bobpitch
+skip 272
+export cg_bobup
+align 4
+LABELV cg_bobup
+skip 272
+export cg_runroll
+align 4
+LABELV cg_runroll
+skip 272
+export cg_runpitch
+align 4
+LABELV cg_runpitch
+skip 272
+export cg_viewkick
+align 4
+LABELV cg_viewkick
+skip 272
+export cg_viewbob
+align 4
+LABELV cg_viewbob
+skip 272
+export cg_centertime
+align 4
+LABELV cg_centertime
+skip 272
+export cg_dedicated
+align 4
+LABELV cg_dedicated
+skip 272
+export con_autoclear
+align 4
+LABELV con_autoclear
+skip 272
+export con_autochat
+align 4
+LABELV con_autochat
+skip 272
+export con_conspeed
+align 4
+LABELV con_conspeed
+skip 272
+import cg_markPolys
+export cg_items
+align 4
+LABELV cg_items
+skip 6144
+export cg_weapons
+align 4
+LABELV cg_weapons
+skip 2048
+export cg_entities
+align 4
+LABELV cg_entities
+skip 3489792
+export cg
+align 4
+LABELV cg
+skip 688188
+export cgs
+align 4
+LABELV cgs
+skip 811352
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $2575
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2572
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2571
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $2568
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2562
+byte 1 44
+byte 1 0
+align 1
+LABELV $2544
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $2481
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 74
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 72
+byte 1 97
+byte 1 116
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $2468
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 74
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 66
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $2425
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 74
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 120
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $2417
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2352
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $2341
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $2311
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2291
+byte 1 10
+byte 1 0
+align 1
+LABELV $2282
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2257
+byte 1 116
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $2254
+byte 1 116
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2206
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2198
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $2197
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $2196
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $2193
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $2191
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2190
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 45
+byte 1 52
+byte 1 0
+align 1
+LABELV $2160
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 46
+byte 1 82
+byte 1 111
+byte 1 81
+byte 1 0
+align 1
+LABELV $2159
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $2155
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 46
+byte 1 82
+byte 1 111
+byte 1 81
+byte 1 10
+byte 1 0
+align 1
+LABELV $2146
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 0
+align 1
+LABELV $2143
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2140
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2116
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2113
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 50
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2110
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2107
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2104
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2101
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 97
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2098
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 100
+byte 1 119
+byte 1 110
+byte 1 95
+byte 1 97
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2095
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2092
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2088
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 0
+align 1
+LABELV $2084
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 99
+byte 1 121
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $2080
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2076
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $2072
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $2068
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $2064
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $2060
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 110
+byte 1 0
+align 1
+LABELV $2056
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2052
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $2048
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 111
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $2044
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2041
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $2038
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 50
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $2030
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 0
+align 1
+LABELV $2027
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 0
+align 1
+LABELV $2024
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1948
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1944
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 0
+align 1
+LABELV $1940
+byte 1 76
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1937
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1934
+byte 1 37
+byte 1 105
+byte 1 47
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1928
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $1920
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1846
+byte 1 85
+byte 1 73
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1843
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1833
+byte 1 94
+byte 1 49
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1830
+byte 1 94
+byte 1 49
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 101
+byte 1 33
+byte 1 0
+align 1
+LABELV $1827
+byte 1 94
+byte 1 51
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1812
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $1806
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $1792
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1779
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1771
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 89
+byte 1 0
+align 1
+LABELV $1763
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 88
+byte 1 0
+align 1
+LABELV $1755
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 65
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1747
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1739
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $1727
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1719
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 66
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1711
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 70
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1703
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1695
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1687
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $1676
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 72
+byte 1 85
+byte 1 68
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1669
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 72
+byte 1 85
+byte 1 68
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 116
+byte 1 41
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 40
+byte 1 51
+byte 1 54
+byte 1 32
+byte 1 112
+byte 1 116
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $1665
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1656
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1645
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 72
+byte 1 85
+byte 1 68
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1633
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1622
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 72
+byte 1 85
+byte 1 68
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $1610
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1606
+byte 1 125
+byte 1 0
+align 1
+LABELV $1597
+byte 1 123
+byte 1 0
+align 1
+LABELV $1590
+byte 1 94
+byte 1 49
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $1587
+byte 1 94
+byte 1 49
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1580
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1548
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $1513
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1509
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1505
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1502
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1499
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1496
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1493
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 51
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $1490
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1487
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1484
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1481
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1478
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1475
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1472
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1469
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 47
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1452
+byte 1 42
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1445
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 83
+byte 1 85
+byte 1 66
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 76
+byte 1 83
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1440
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1437
+byte 1 119
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 0
+align 1
+LABELV $1434
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $1431
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1428
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1425
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1422
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $1411
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $1408
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $1405
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1402
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1399
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1396
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $1393
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1390
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1387
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 106
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1384
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1381
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1378
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1375
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1372
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1369
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1366
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 105
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1363
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1360
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 50
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1357
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1354
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 48
+byte 1 49
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1351
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 48
+byte 1 50
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1348
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1345
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1342
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1339
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $1334
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1331
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1328
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1325
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1322
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1319
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1316
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1313
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1310
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1307
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 98
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1304
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1301
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1298
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $1295
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1292
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 0
+align 1
+LABELV $1289
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1286
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $1283
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 101
+byte 1 0
+align 1
+LABELV $1273
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1270
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1265
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1262
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1261
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1253
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 121
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1250
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1247
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1244
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1241
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1233
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 51
+byte 1 0
+align 1
+LABELV $1223
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 49
+byte 1 0
+align 1
+LABELV $1220
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1212
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 47
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 108
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1209
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1206
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1201
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1198
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1195
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1194
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 112
+byte 1 51
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1191
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 50
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 112
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1188
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 51
+byte 1 0
+align 1
+LABELV $1184
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 50
+byte 1 0
+align 1
+LABELV $1180
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 49
+byte 1 0
+align 1
+LABELV $1177
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1173
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 50
+byte 1 0
+align 1
+LABELV $1169
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 49
+byte 1 0
+align 1
+LABELV $1166
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1163
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1151
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $1148
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1145
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 47
+byte 1 98
+byte 1 95
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1142
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 47
+byte 1 114
+byte 1 95
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1134
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $1131
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $1128
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $1125
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1122
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1119
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1116
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1113
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $1110
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1107
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 37
+byte 1 99
+byte 1 0
+align 1
+LABELV $1100
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $1097
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1094
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 66
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1091
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1088
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1085
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $1082
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 49
+byte 1 0
+align 1
+LABELV $1079
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 98
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $1076
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $1073
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $1070
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $1067
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1064
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1061
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1058
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1055
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1052
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 66
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 66
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $1049
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 53
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1045
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 52
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1041
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 51
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1037
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 50
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1033
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1030
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 97
+byte 1 0
+align 1
+LABELV $1029
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1016
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 98
+byte 1 50
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1013
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 98
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1010
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1007
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1004
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $1001
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 118
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $998
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $995
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $992
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $989
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $986
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $983
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $980
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $977
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $974
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $971
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $968
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $965
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $962
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $959
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $956
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $953
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 119
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $950
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 120
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 47
+byte 1 119
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $947
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 120
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $944
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 108
+byte 1 120
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $941
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $938
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $935
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $932
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $929
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $926
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $907
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 107
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $903
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $899
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 121
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $895
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $891
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $887
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $884
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $879
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $876
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 95
+byte 1 117
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $873
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 95
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $870
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $867
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $864
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $861
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $858
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $855
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $852
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $849
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $846
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $843
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $840
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $837
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $834
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $831
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $828
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $825
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $822
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 108
+byte 1 111
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $819
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $816
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $813
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $810
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $807
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $804
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $801
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $798
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $795
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $792
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $789
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $786
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $783
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $780
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $777
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $774
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $771
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 95
+byte 1 106
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $768
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $765
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $762
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $759
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 117
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $756
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $753
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $750
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $747
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 116
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $744
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $741
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $738
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $735
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 98
+byte 1 121
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $732
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $724
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 121
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $721
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $711
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 95
+byte 1 49
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $708
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 49
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $698
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $695
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $692
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $689
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $681
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $678
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $675
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $672
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $669
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $666
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $663
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $660
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $657
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $654
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $651
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $648
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $640
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $637
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $634
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $631
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $628
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $625
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $622
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 51
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $619
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 50
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $616
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 49
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $613
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 115
+byte 1 117
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $610
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 53
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $607
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 49
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $603
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $597
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $537
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $535
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $522
+byte 1 91
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 0
+align 1
+LABELV $490
+byte 1 91
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 0
+align 1
+LABELV $483
+byte 1 91
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 112
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 93
+byte 1 0
+align 1
+LABELV $388
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $386
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $385
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $384
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $383
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $382
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $381
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $380
+byte 1 85
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $358
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $357
+byte 1 103
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $344
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $343
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $342
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $341
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $340
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $339
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $338
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $337
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $336
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $335
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 80
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $334
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $333
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $332
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $331
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $330
+byte 1 53
+byte 1 0
+align 1
+LABELV $329
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $328
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $327
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $326
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 106
+byte 1 111
+byte 1 121
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 68
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 0
+align 1
+LABELV $325
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $324
+byte 1 42
+byte 1 106
+byte 1 97
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $323
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $322
+byte 1 106
+byte 1 97
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $321
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $320
+byte 1 42
+byte 1 106
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $319
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $318
+byte 1 106
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $317
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $316
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $315
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $314
+byte 1 109
+byte 1 97
+byte 1 106
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $313
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $312
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $311
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $310
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $309
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $308
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $307
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 66
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $306
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $305
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 66
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $304
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 76
+byte 1 105
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 45
+byte 1 66
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $303
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $302
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $301
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 76
+byte 1 105
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 77
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 45
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $300
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $299
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 66
+byte 1 66
+byte 1 111
+byte 1 120
+byte 1 0
+align 1
+LABELV $298
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 72
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $297
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 66
+byte 1 105
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $296
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 76
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $295
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 66
+byte 1 111
+byte 1 100
+byte 1 121
+byte 1 83
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 0
+align 1
+LABELV $294
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 66
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $293
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 80
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $292
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 107
+byte 1 121
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 0
+align 1
+LABELV $291
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $290
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 65
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 65
+byte 1 100
+byte 1 106
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $289
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 0
+align 1
+LABELV $288
+byte 1 49
+byte 1 53
+byte 1 51
+byte 1 54
+byte 1 0
+align 1
+LABELV $287
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 102
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $286
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $285
+byte 1 51
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $284
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 76
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 121
+byte 1 0
+align 1
+LABELV $283
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 77
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $282
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 112
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 77
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $281
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 68
+byte 1 109
+byte 1 76
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 65
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $280
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 116
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 112
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 69
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $279
+byte 1 51
+byte 1 50
+byte 1 0
+align 1
+LABELV $278
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 83
+byte 1 101
+byte 1 103
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 76
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $277
+byte 1 54
+byte 1 0
+align 1
+LABELV $276
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 67
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $275
+byte 1 49
+byte 1 54
+byte 1 0
+align 1
+LABELV $274
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 87
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $273
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $272
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $271
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 0
+align 1
+LABELV $270
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $269
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $268
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $267
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 84
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $266
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $265
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 53
+byte 1 0
+align 1
+LABELV $264
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $263
+byte 1 56
+byte 1 0
+align 1
+LABELV $262
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $261
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $260
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $259
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $258
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $257
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $256
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $255
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $254
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $253
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $252
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $251
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $250
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $249
+byte 1 0
+align 1
+LABELV $248
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 83
+byte 1 80
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $247
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 83
+byte 1 80
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $246
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 66
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $245
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 68
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $244
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $243
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $242
+byte 1 80
+byte 1 97
+byte 1 103
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $241
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $240
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $239
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $238
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $237
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $236
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $235
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $234
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 86
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $233
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 86
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $232
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $231
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $230
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $229
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $228
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $227
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $226
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $225
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $224
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $223
+byte 1 50
+byte 1 0
+align 1
+LABELV $222
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $221
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 84
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 69
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $220
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 86
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $219
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $218
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $217
+byte 1 48
+byte 1 46
+byte 1 52
+byte 1 0
+align 1
+LABELV $216
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $215
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $214
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 80
+byte 1 111
+byte 1 108
+byte 1 121
+byte 1 66
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $213
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $212
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $211
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $210
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $209
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $208
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $207
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $206
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $205
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 0
+align 1
+LABELV $204
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $203
+byte 1 48
+byte 1 46
+byte 1 51
+byte 1 0
+align 1
+LABELV $202
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $201
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $200
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $199
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $198
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 48
+byte 1 53
+byte 1 0
+align 1
+LABELV $197
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $196
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 48
+byte 1 50
+byte 1 0
+align 1
+LABELV $195
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $194
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $193
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 0
+align 1
+LABELV $192
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $191
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 90
+byte 1 0
+align 1
+LABELV $190
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 89
+byte 1 0
+align 1
+LABELV $189
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 88
+byte 1 0
+align 1
+LABELV $188
+byte 1 52
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $187
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $186
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $185
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $184
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $183
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $182
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 89
+byte 1 0
+align 1
+LABELV $181
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 88
+byte 1 0
+align 1
+LABELV $180
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $179
+byte 1 50
+byte 1 52
+byte 1 0
+align 1
+LABELV $178
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $177
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 76
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $176
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $175
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $174
+byte 1 52
+byte 1 0
+align 1
+LABELV $173
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $172
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $171
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $170
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $169
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 51
+byte 1 100
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $168
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $167
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 0
+align 1
+LABELV $166
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $165
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $164
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 50
+byte 1 68
+byte 1 0
+align 1
+LABELV $163
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 0
+align 1
+LABELV $162
+byte 1 49
+byte 1 0
+align 1
+LABELV $161
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 0
+align 1
+LABELV $160
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $159
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $158
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 70
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $157
+byte 1 57
+byte 1 48
+byte 1 0
+align 1
+LABELV $156
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $155
+byte 1 50
+byte 1 50
+byte 1 46
+byte 1 53
+byte 1 0
+align 1
+LABELV $154
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $153
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $152
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $151
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $150
+byte 1 48
+byte 1 0
+align 1
+LABELV $149
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $148
+byte 1 51
+byte 1 0
+align 1
+LABELV $147
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $146
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 46
+byte 1 51
+byte 1 43
+byte 1 50
+byte 1 48
+byte 1 50
+byte 1 54
+byte 1 49
+byte 1 48
+byte 1 49
+byte 1 56
+byte 1 43
+byte 1 55
+byte 1 50
+byte 1 51
+byte 1 51
+byte 1 101
+byte 1 57
+byte 1 99
+byte 1 32
+byte 1 113
+byte 1 51
+byte 1 118
+byte 1 109
+byte 1 45
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 49
+byte 1 56
+byte 1 32
+byte 1 50
+byte 1 48
+byte 1 50
+byte 1 54
+byte 1 0
+align 1
+LABELV $145
+byte 1 99
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $139
+byte 1 99
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 109
+byte 1 77
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $109
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 84
+byte 1 95
+byte 1 67
+byte 1 71
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 0
@@ -0,0 +1,12819 @@
+export CG_FontForScale
+code
+proc CG_FontForScale 4 0
+ADDRLP4 0
+ADDRGP4 cgDC+232+12
+ASGNP4
+ADDRFP4 0
+INDIRF4
+ADDRGP4 cg_smallFont+8
+INDIRF4
+GTF4 $108
+ADDRLP4 0
+ADDRGP4 cgDC+232+20568
+ASGNP4
+ADDRGP4 $109
+JUMPV
+LABELV $108
+ADDRFP4 0
+INDIRF4
+ADDRGP4 cg_bigFont+8
+INDIRF4
+LTF4 $113
+ADDRLP4 0
+ADDRGP4 cgDC+232+41124
+ASGNP4
+LABELV $113
+LABELV $109
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $105
+endproc CG_FontForScale 4 0
+export CG_Text_PaintWithCursor
+proc CG_Text_PaintWithCursor 16 56
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 32
+INDIRI4
+CNSTI4 3
+NEI4 $119
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $120
+JUMPV
+LABELV $119
+ADDRFP4 32
+INDIRI4
+CNSTI4 6
+NEI4 $121
+ADDRLP4 0
+CNSTF4 1073741824
+ASGNF4
+ADDRGP4 $122
+JUMPV
+LABELV $121
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $122
+LABELV $120
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_FontForScale
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintWithCursor
+CALLV
+pop
+LABELV $118
+endproc CG_Text_PaintWithCursor 16 56
+export CG_Text_Width
+proc CG_Text_Width 8 16
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 CG_FontForScale
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+RETI4
+LABELV $123
+endproc CG_Text_Width 8 16
+export CG_Text_Height
+proc CG_Text_Height 8 16
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 CG_FontForScale
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+RETI4
+LABELV $124
+endproc CG_Text_Height 8 16
+export CG_Text_Paint
+proc CG_Text_Paint 12 48
+ADDRFP4 28
+INDIRI4
+CNSTI4 3
+NEI4 $126
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRFP4 28
+INDIRI4
+CNSTI4 6
+NEI4 $128
+ADDRLP4 0
+CNSTF4 1073741824
+ASGNF4
+ADDRGP4 $129
+JUMPV
+LABELV $128
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $129
+LABELV $127
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_FontForScale
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $125
+endproc CG_Text_Paint 12 48
+export CG_Text_PaintGradient
+proc CG_Text_PaintGradient 12 48
+ADDRFP4 28
+INDIRI4
+CNSTI4 3
+NEI4 $131
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $132
+JUMPV
+LABELV $131
+ADDRFP4 28
+INDIRI4
+CNSTI4 6
+NEI4 $133
+ADDRLP4 0
+CNSTF4 1073741824
+ASGNF4
+ADDRGP4 $134
+JUMPV
+LABELV $133
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $134
+LABELV $132
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_FontForScale
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRF4
+ARGF4
+CNSTF4 1053609165
+ARGF4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $130
+endproc CG_Text_PaintGradient 12 48
+export CG_Text_PaintInMotion
+proc CG_Text_PaintInMotion 8 48
+ADDRFP4 28
+INDIRI4
+CNSTI4 3
+NEI4 $136
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $137
+JUMPV
+LABELV $136
+ADDRFP4 28
+INDIRI4
+CNSTI4 6
+NEI4 $138
+ADDRLP4 0
+CNSTF4 1073741824
+ASGNF4
+ADDRGP4 $139
+JUMPV
+LABELV $138
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $139
+LABELV $137
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_FontForScale
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRF4
+ARGF4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $135
+endproc CG_Text_PaintInMotion 8 48
+export CG_Text_Paint_Limit
+proc CG_Text_Paint_Limit 4 40
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 CG_FontForScale
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Text_Paint_Limit
+CALLV
+pop
+LABELV $140
+endproc CG_Text_Paint_Limit 4 40
+data
+export drawTeamOverlayModificationCount
+align 4
+LABELV drawTeamOverlayModificationCount
+byte 4 -1
+export CG_InitTeamChat
+code
+proc CG_InitTeamChat 0 12
+ADDRGP4 teamChat1
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 256
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 teamChat2
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 256
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 systemChat
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 256
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $141
+endproc CG_InitTeamChat 0 12
+export CG_SetPrintString
+proc CG_SetPrintString 0 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $143
+ADDRGP4 systemChat
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $144
+JUMPV
+LABELV $143
+ADDRGP4 teamChat2
+ARGP4
+ADDRGP4 teamChat1
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 teamChat1
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $144
+LABELV $142
+endproc CG_SetPrintString 0 8
+export CG_CheckOrderPending
+proc CG_CheckOrderPending 208 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+GEI4 $146
+ADDRGP4 $145
+JUMPV
+LABELV $146
+ADDRLP4 0
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -1
+NEI4 $150
+ADDRGP4 $145
+JUMPV
+LABELV $150
+ADDRLP4 0
+INDIRP4
+CNSTI4 35660
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $152
+ADDRLP4 156
+CNSTP4 0
+ASGNP4
+ADDRLP4 140
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 144
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 164
+CNSTI4 500
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 168
+CNSTI4 254120
+ASGNI4
+ADDRLP4 148
+ADDRLP4 164
+INDIRI4
+ADDRGP4 cg+48
+INDIRP4
+ADDRLP4 168
+INDIRI4
+ADDP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 164
+INDIRI4
+ADDRGP4 cg+48
+INDIRP4
+ADDRLP4 168
+INDIRI4
+ADDP4
+ADDP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 136
+CNSTI4 272
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 0
+INDIRP4
+CNSTI4 35656
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 1
+LTI4 $157
+ADDRLP4 152
+INDIRI4
+CNSTI4 7
+GTI4 $157
+ADDRLP4 152
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $190-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $190
+address $160
+address $166
+address $171
+address $176
+address $184
+address $187
+address $181
+code
+LABELV $160
+ADDRLP4 144
+ADDRGP4 $161
+ASGNP4
+ADDRLP4 140
+ADDRGP4 $162
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 176
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 180
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $163
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $158
+JUMPV
+LABELV $166
+ADDRLP4 144
+ADDRGP4 $167
+ASGNP4
+ADDRLP4 140
+ADDRGP4 $168
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $169
+ARGP4
+ADDRLP4 184
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $170
+ARGP4
+ADDRLP4 188
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $163
+ARGP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $158
+JUMPV
+LABELV $171
+ADDRLP4 144
+ADDRGP4 $172
+ASGNP4
+ADDRLP4 140
+ADDRGP4 $173
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $174
+ARGP4
+ADDRLP4 192
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $175
+ARGP4
+ADDRLP4 196
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $163
+ARGP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $158
+JUMPV
+LABELV $176
+ADDRLP4 144
+ADDRGP4 $177
+ASGNP4
+ADDRLP4 140
+ADDRGP4 $178
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $179
+ARGP4
+ADDRLP4 200
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $180
+ARGP4
+ADDRLP4 204
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $163
+ARGP4
+ADDRLP4 200
+INDIRP4
+ARGP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $158
+JUMPV
+LABELV $181
+ADDRLP4 144
+ADDRGP4 $182
+ASGNP4
+ADDRLP4 140
+ADDRGP4 $183
+ASGNP4
+ADDRGP4 $158
+JUMPV
+LABELV $184
+ADDRLP4 144
+ADDRGP4 $185
+ASGNP4
+ADDRLP4 140
+ADDRGP4 $186
+ASGNP4
+ADDRGP4 $158
+JUMPV
+LABELV $187
+ADDRLP4 144
+ADDRGP4 $188
+ASGNP4
+ADDRLP4 140
+ADDRGP4 $189
+ASGNP4
+LABELV $157
+LABELV $158
+ADDRLP4 136
+INDIRI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+NEI4 $192
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $195
+ARGP4
+ADDRLP4 176
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $194
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $193
+JUMPV
+LABELV $192
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 148
+INDIRI4
+NEI4 $196
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $196
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $199
+ARGP4
+ADDRLP4 176
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $198
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 35656
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $195
+ARGP4
+ADDRLP4 184
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $194
+ARGP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $197
+JUMPV
+LABELV $196
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $200
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $203
+ARGP4
+ADDRLP4 176
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRGP4 $202
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $200
+LABELV $197
+LABELV $193
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $204
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $204
+ADDRLP4 0
+INDIRP4
+CNSTI4 35660
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $152
+LABELV $145
+endproc CG_CheckOrderPending 208 20
+proc CG_SetSelectedPlayerName 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 500
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 272
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $208
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+GEI4 $208
+ADDRLP4 8
+CNSTI4 2108
+CNSTI4 272
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $209
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $216
+ARGP4
+ADDRLP4 12
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $217
+ARGP4
+ADDRLP4 16
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 272
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 39084
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+531852+35656
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $209
+JUMPV
+LABELV $208
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $216
+ARGP4
+ADDRLP4 8
+ADDRGP4 Com_LocalPlayerCvarName
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $221
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $209
+LABELV $206
+endproc CG_SetSelectedPlayerName 20 8
+export CG_GetSelectedPlayer
+proc CG_GetSelectedPlayer 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 500
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 272
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $228
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+LTI4 $224
+LABELV $228
+CNSTI4 272
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $224
+CNSTI4 272
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+INDIRI4
+RETI4
+LABELV $222
+endproc CG_GetSelectedPlayer 8 0
+export CG_SelectNextPlayer
+proc CG_SelectNextPlayer 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 500
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_CheckOrderPending
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 272
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $233
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+GEI4 $233
+ADDRLP4 12
+CNSTI4 272
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $234
+JUMPV
+LABELV $233
+CNSTI4 272
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $234
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetSelectedPlayerName
+CALLV
+pop
+LABELV $231
+endproc CG_SelectNextPlayer 16 4
+export CG_SelectPrevPlayer
+proc CG_SelectPrevPlayer 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 500
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_CheckOrderPending
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 272
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $241
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+GTI4 $241
+ADDRLP4 12
+CNSTI4 272
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $241
+CNSTI4 272
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $242
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetSelectedPlayerName
+CALLV
+pop
+LABELV $239
+endproc CG_SelectPrevPlayer 16 4
+proc CG_DrawPlayerArmorIcon 36 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+CNSTI4 0
+NEI4 $248
+ADDRGP4 $247
+JUMPV
+LABELV $248
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $255
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $251
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $251
+LABELV $255
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRGP4 cgs+683776+125488
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $252
+JUMPV
+LABELV $251
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $258
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 3240099840
+ASGNF4
+ADDRLP4 0+4
+CNSTI4 360
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+683776+125484
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $258
+LABELV $252
+LABELV $247
+endproc CG_DrawPlayerArmorIcon 36 32
+proc CG_DrawPlayerArmorValue 32 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRGP4 cg+531844
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $271
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $272
+JUMPV
+LABELV $271
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_PaintGradient
+CALLV
+pop
+LABELV $272
+LABELV $269
+endproc CG_DrawPlayerArmorValue 32 32
+proc CG_DrawPlayerAmmoIcon 52 32
+ADDRLP4 0
+CNSTI4 852
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $280
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $276
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $276
+LABELV $280
+ADDRLP4 32
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 cg_weapons+72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $277
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $285
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $288
+ADDRLP4 32
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 cg_weapons+76
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $288
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1116471296
+ASGNF4
+ADDRLP4 16+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+512320
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1101004800
+ADDRLP4 44
+INDIRF4
+MULF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 cg_weapons+76
+ADDP4
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $288
+LABELV $285
+LABELV $277
+LABELV $274
+endproc CG_DrawPlayerAmmoIcon 52 32
+proc CG_DrawPlayerAmmoValue 36 32
+ADDRLP4 0
+CNSTI4 852
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+531844
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $301
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 412
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+LEI4 $303
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $305
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $306
+JUMPV
+LABELV $305
+ADDRLP4 12
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_PaintGradient
+CALLV
+pop
+LABELV $306
+LABELV $303
+LABELV $301
+LABELV $298
+endproc CG_DrawPlayerAmmoValue 36 32
+proc CG_DrawPlayerHead 76 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 35880
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $310
+ADDRGP4 cg+512320
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+GEF4 $310
+ADDRLP4 0
+ADDRGP4 cg+512320
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35880
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+DIVF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1067450368
+ASGNF4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 24
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+MULF4
+CNSTF4 1069547520
+ADDRLP4 44
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 24
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 35884
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDRLP4 44
+INDIRF4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+MULF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35912
+ADDP4
+CNSTF4 1110704128
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35900
+ADDP4
+CNSTF4 1101004800
+ADDRLP4 60
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35896
+ADDP4
+CNSTF4 1084227584
+ADDRLP4 68
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35916
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35904
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+CNSTF4 1157234688
+ADDRLP4 72
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $311
+JUMPV
+LABELV $310
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35904
+ADDP4
+INDIRI4
+LTI4 $326
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35912
+ADDP4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35900
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35908
+ADDP4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35896
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35916
+ADDP4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35904
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35904
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+CNSTF4 1157234688
+ADDRLP4 36
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35900
+ADDP4
+CNSTF4 1101004800
+ADDRLP4 44
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35896
+ADDP4
+CNSTF4 1084227584
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+LABELV $326
+LABELV $311
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35916
+ADDP4
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+LEI4 $340
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35916
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+LABELV $340
+ADDRLP4 36
+CNSTI4 35916
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35904
+ADDP4
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1077936128
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 35912
+ASGNI4
+ADDRLP4 4+4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35900
+ADDP4
+INDIRF4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 35908
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35896
+ADDP4
+INDIRF4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+LABELV $307
+endproc CG_DrawPlayerHead 76 24
+proc CG_DrawSelectedPlayerHealth 40 32
+ADDRLP4 4
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+531848
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 2108
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $362
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $364
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $365
+JUMPV
+LABELV $364
+ADDRLP4 8
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 8
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $365
+LABELV $362
+LABELV $358
+endproc CG_DrawSelectedPlayerHealth 40 32
+proc CG_DrawSelectedPlayerArmor 40 32
+ADDRLP4 4
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+531848
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 2108
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $370
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $372
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $374
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $375
+JUMPV
+LABELV $374
+ADDRLP4 8
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 8
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $375
+LABELV $372
+LABELV $370
+LABELV $366
+endproc CG_DrawSelectedPlayerArmor 40 32
+export CG_StatusHandle
+proc CG_StatusHandle 8 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LTI4 $377
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+GTI4 $377
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $402-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $402
+address $379
+address $382
+address $385
+address $388
+address $394
+address $397
+address $391
+code
+LABELV $379
+ADDRLP4 0
+ADDRGP4 cgs+683776+127464
+INDIRI4
+ASGNI4
+ADDRGP4 $378
+JUMPV
+LABELV $382
+ADDRLP4 0
+ADDRGP4 cgs+683776+127476
+INDIRI4
+ASGNI4
+ADDRGP4 $378
+JUMPV
+LABELV $385
+ADDRLP4 0
+ADDRGP4 cgs+683776+127460
+INDIRI4
+ASGNI4
+ADDRGP4 $378
+JUMPV
+LABELV $388
+ADDRLP4 0
+ADDRGP4 cgs+683776+127472
+INDIRI4
+ASGNI4
+ADDRGP4 $378
+JUMPV
+LABELV $391
+ADDRLP4 0
+ADDRGP4 cgs+683776+127468
+INDIRI4
+ASGNI4
+ADDRGP4 $378
+JUMPV
+LABELV $394
+ADDRLP4 0
+ADDRGP4 cgs+683776+127484
+INDIRI4
+ASGNI4
+ADDRGP4 $378
+JUMPV
+LABELV $397
+ADDRLP4 0
+ADDRGP4 cgs+683776+127488
+INDIRI4
+ASGNI4
+ADDRGP4 $378
+JUMPV
+LABELV $377
+ADDRLP4 0
+ADDRGP4 cgs+683776+127464
+INDIRI4
+ASGNI4
+LABELV $378
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $376
+endproc CG_StatusHandle 8 0
+proc CG_DrawSelectedPlayerStatus 20 20
+ADDRLP4 4
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+531848
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 2108
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $408
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35660
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $410
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35664
+ADDP4
+INDIRI4
+CNSTI4 2500
+SUBI4
+LEI4 $413
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 9
+RSHI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $413
+ADDRGP4 $404
+JUMPV
+LABELV $413
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35656
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $411
+JUMPV
+LABELV $410
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $411
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $408
+LABELV $404
+endproc CG_DrawSelectedPlayerStatus 20 20
+proc CG_DrawPlayerStatus 16 20
+ADDRLP4 0
+CNSTI4 2108
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $422
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $422
+LABELV $419
+endproc CG_DrawPlayerStatus 16 20
+proc CG_DrawSelectedPlayerName 16 32
+ADDRLP4 4
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $426
+ADDRLP4 0
+CNSTI4 2108
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35648
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRGP4 $427
+JUMPV
+LABELV $426
+ADDRGP4 cg+531848
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 2108
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+LABELV $427
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $432
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $432
+LABELV $424
+endproc CG_DrawSelectedPlayerName 16 32
+proc CG_DrawSelectedPlayerLocation 28 32
+ADDRLP4 4
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+531848
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 2108
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $438
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $442
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $440
+LABELV $442
+ADDRLP4 12
+ADDRGP4 $443
+ASGNP4
+LABELV $440
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $438
+LABELV $434
+endproc CG_DrawSelectedPlayerLocation 28 32
+proc CG_DrawPlayerLocation 20 32
+ADDRLP4 0
+CNSTI4 2108
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $447
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $451
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $449
+LABELV $451
+ADDRLP4 4
+ADDRGP4 $443
+ASGNP4
+LABELV $449
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $447
+LABELV $444
+endproc CG_DrawPlayerLocation 20 32
+proc CG_DrawSelectedPlayerWeapon 16 20
+ADDRLP4 4
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+531848
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 2108
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $456
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $458
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $459
+JUMPV
+LABELV $458
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+683776+125496
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $459
+LABELV $456
+LABELV $452
+endproc CG_DrawSelectedPlayerWeapon 16 20
+proc CG_DrawPlayerScore 28 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+531844
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $465
+ADDRGP4 $464
+JUMPV
+LABELV $465
+ADDRLP4 0
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $469
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $470
+JUMPV
+LABELV $469
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $470
+LABELV $464
+endproc CG_DrawPlayerScore 28 32
+proc CG_DrawPlayerItem 36 32
+ADDRLP4 0
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $473
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $476
+JUMPV
+LABELV $475
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 16+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 3240099840
+ASGNF4
+ADDRLP4 4+4
+CNSTI4 360
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+4
+ADDP4
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $476
+LABELV $473
+LABELV $471
+endproc CG_DrawPlayerItem 36 32
+proc CG_DrawSelectedPlayerPowerup 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+531848
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 2108
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $489
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $491
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $495
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $497
+ADDRLP4 28
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $485
+JUMPV
+LABELV $497
+LABELV $495
+LABELV $492
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $491
+LABELV $489
+LABELV $485
+endproc CG_DrawSelectedPlayerPowerup 44 20
+proc CG_DrawSelectedPlayerHead 80 32
+ADDRLP4 16
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $501
+ADDRLP4 0
+CNSTI4 2108
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35648
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRGP4 $502
+JUMPV
+LABELV $501
+ADDRGP4 cg+531848
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 2108
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+LABELV $502
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $507
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $509
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $512
+ADDRGP4 $499
+JUMPV
+LABELV $512
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_R_ModelBounds
+CALLI4
+pop
+ADDRLP4 4+8
+CNSTF4 3204448256
+ADDRLP4 20+8
+INDIRF4
+ADDRLP4 32+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1056964608
+ADDRLP4 20+4
+INDIRF4
+ADDRLP4 32+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1060320051
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 20+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 44+4
+CNSTF4 1127481344
+ASGNF4
+ADDRLP4 44+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $510
+JUMPV
+LABELV $509
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $528
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 940
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $528
+LABELV $510
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $531
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+683776+125496
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $531
+LABELV $507
+LABELV $499
+endproc CG_DrawSelectedPlayerHead 80 32
+proc CG_DrawPlayerHealth 32 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+531844
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $537
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $538
+JUMPV
+LABELV $537
+ADDRLP4 8
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 8
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_PaintGradient
+CALLV
+pop
+LABELV $538
+LABELV $535
+endproc CG_DrawPlayerHealth 32 32
+proc CG_DrawRedScore 28 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+59308
+INDIRI4
+CNSTI4 -9999
+NEI4 $540
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $543
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $541
+JUMPV
+LABELV $540
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $273
+ARGP4
+ADDRGP4 cgs+59308
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $541
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $539
+endproc CG_DrawRedScore 28 32
+proc CG_DrawBlueScore 28 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+59312
+INDIRI4
+CNSTI4 -9999
+NEI4 $546
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $543
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $547
+JUMPV
+LABELV $546
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $273
+ARGP4
+ADDRGP4 cgs+59312
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $547
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $545
+endproc CG_DrawBlueScore 28 32
+proc CG_DrawRedName 4 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 cg_redTeamName+16
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $550
+endproc CG_DrawRedName 4 32
+proc CG_DrawBlueName 4 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 cg_blueTeamName+16
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $552
+endproc CG_DrawBlueName 4 32
+proc CG_DrawBlueFlagName 16 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $558
+JUMPV
+LABELV $555
+ADDRLP4 4
+CNSTI4 2108
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+77768
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $560
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $560
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+77768+148
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $560
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 2108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+4
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $554
+JUMPV
+LABELV $560
+LABELV $556
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $558
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+56116
+INDIRI4
+LTI4 $555
+LABELV $554
+endproc CG_DrawBlueFlagName 16 32
+lit
+align 4
+LABELV $577
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $584
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+code
+proc CG_DrawBlueFlagStatus 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+EQI4 $570
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 5
+EQI4 $570
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 7
+NEI4 $569
+ADDRLP4 0
+ADDRGP4 $577
+INDIRB
+ASGNB 16
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+683776+123364
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $569
+JUMPV
+LABELV $570
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $580
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $581
+JUMPV
+LABELV $580
+CNSTI4 8
+ARGI4
+ADDRLP4 4
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $582
+ADDRLP4 8
+ADDRGP4 $584
+INDIRB
+ASGNB 16
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cgs+59320
+INDIRI4
+CNSTI4 0
+LTI4 $585
+ADDRGP4 cgs+59320
+INDIRI4
+CNSTI4 2
+GTI4 $585
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+59320
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+683776+127528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $586
+JUMPV
+LABELV $585
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+683776+127528
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $586
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $582
+LABELV $581
+LABELV $569
+endproc CG_DrawBlueFlagStatus 28 20
+proc CG_DrawBlueFlagHead 36 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $598
+JUMPV
+LABELV $595
+ADDRLP4 4
+CNSTI4 2108
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+77768
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $600
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $600
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+77768+148
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $600
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 cg+512320
+INDIRI4
+CVIF4 4
+CNSTF4 1143111680
+DIVF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1101004800
+ADDRLP4 28
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRGP4 $594
+JUMPV
+LABELV $600
+LABELV $596
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $598
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+56116
+INDIRI4
+LTI4 $595
+LABELV $594
+endproc CG_DrawBlueFlagHead 36 24
+proc CG_DrawRedFlagName 16 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $615
+JUMPV
+LABELV $612
+ADDRLP4 4
+CNSTI4 2108
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+77768
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $617
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $617
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+77768+148
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $617
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 2108
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768+4
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 $611
+JUMPV
+LABELV $617
+LABELV $613
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $615
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+56116
+INDIRI4
+LTI4 $612
+LABELV $611
+endproc CG_DrawRedFlagName 16 32
+lit
+align 4
+LABELV $634
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV $641
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+code
+proc CG_DrawRedFlagStatus 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+EQI4 $627
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 5
+EQI4 $627
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 7
+NEI4 $626
+ADDRLP4 0
+ADDRGP4 $634
+INDIRB
+ASGNB 16
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+683776+123360
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $626
+JUMPV
+LABELV $627
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $637
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $638
+JUMPV
+LABELV $637
+CNSTI4 7
+ARGI4
+ADDRLP4 4
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $639
+ADDRLP4 8
+ADDRGP4 $641
+INDIRB
+ASGNB 16
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cgs+59316
+INDIRI4
+CNSTI4 0
+LTI4 $642
+ADDRGP4 cgs+59316
+INDIRI4
+CNSTI4 2
+GTI4 $642
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+59316
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+683776+127528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $643
+JUMPV
+LABELV $642
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cgs+683776+127528
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $643
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $639
+LABELV $638
+LABELV $626
+endproc CG_DrawRedFlagStatus 28 20
+proc CG_DrawRedFlagHead 36 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $655
+JUMPV
+LABELV $652
+ADDRLP4 4
+CNSTI4 2108
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+77768
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $657
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+77768+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $657
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+77768+148
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $657
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 cg+512320
+INDIRI4
+CVIF4 4
+CNSTF4 1143111680
+DIVF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1101004800
+ADDRLP4 28
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRGP4 $651
+JUMPV
+LABELV $657
+LABELV $653
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $655
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+56116
+INDIRI4
+LTI4 $652
+LABELV $651
+endproc CG_DrawRedFlagHead 36 24
+proc CG_HarvesterSkulls 72 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 7
+EQI4 $670
+ADDRGP4 $668
+JUMPV
+LABELV $670
+ADDRLP4 0
+INDIRI4
+CNSTI4 99
+LEI4 $673
+ADDRLP4 0
+CNSTI4 99
+ASGNI4
+LABELV $673
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $675
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $678
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $678
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+8
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 32+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 32+8
+CNSTF4 3240099840
+ASGNF4
+ADDRLP4 20+4
+CNSTI4 360
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $687
+ADDRLP4 44
+ADDRGP4 cgs+683776+123352
+INDIRI4
+ASGNI4
+ADDRGP4 $688
+JUMPV
+LABELV $687
+ADDRLP4 44
+ADDRGP4 cgs+683776+123356
+INDIRI4
+ASGNI4
+LABELV $688
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+CNSTF4 1108082688
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $679
+JUMPV
+LABELV $678
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $694
+ADDRLP4 44
+ADDRGP4 cgs+683776+123360
+INDIRI4
+ASGNI4
+ADDRGP4 $695
+JUMPV
+LABELV $694
+ADDRLP4 44
+ADDRGP4 cgs+683776+123364
+INDIRI4
+ASGNI4
+LABELV $695
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1077936128
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ARGF4
+ADDRLP4 64
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $679
+LABELV $675
+LABELV $668
+endproc CG_HarvesterSkulls 72 32
+lit
+align 4
+LABELV $711
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+code
+proc CG_OneFlagStatus 32 20
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 5
+EQI4 $702
+ADDRGP4 $701
+JUMPV
+LABELV $702
+CNSTI4 9
+ARGI4
+ADDRLP4 4
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $705
+ADDRGP4 cgs+59324
+INDIRI4
+CNSTI4 0
+LTI4 $707
+ADDRGP4 cgs+59324
+INDIRI4
+CNSTI4 4
+GTI4 $707
+ADDRLP4 8
+ADDRGP4 $711
+INDIRB
+ASGNB 16
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+59324
+INDIRI4
+CNSTI4 2
+NEI4 $712
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $713
+JUMPV
+LABELV $712
+ADDRGP4 cgs+59324
+INDIRI4
+CNSTI4 3
+NEI4 $717
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $718
+JUMPV
+LABELV $717
+ADDRGP4 cgs+59324
+INDIRI4
+CNSTI4 4
+NEI4 $721
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+LABELV $721
+LABELV $718
+LABELV $713
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+683776+127528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $707
+LABELV $705
+LABELV $701
+endproc CG_OneFlagStatus 32 20
+proc CG_DrawCTFPowerUp 8 20
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+GEI4 $727
+ADDRGP4 $726
+JUMPV
+LABELV $727
+ADDRLP4 0
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $731
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $731
+LABELV $726
+endproc CG_DrawCTFPowerUp 8 20
+proc CG_DrawTeamColor 8 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+CNSTI4 12
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+LABELV $734
+endproc CG_DrawTeamColor 8 24
+proc CG_DrawAreaPowerUp 240 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 148+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 148+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 148+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $742
+ADDRLP4 200
+ADDRLP4 148+4
+ASGNP4
+ADDRGP4 $743
+JUMPV
+LABELV $742
+ADDRLP4 200
+ADDRLP4 148
+ASGNP4
+LABELV $743
+ADDRLP4 192
+ADDRLP4 200
+INDIRP4
+ASGNP4
+ADDRLP4 164
+ADDRGP4 cg+531844
+INDIRP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $745
+ADDRGP4 $736
+JUMPV
+LABELV $745
+ADDRLP4 204
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 204
+INDIRI4
+ASGNI4
+LABELV $747
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $751
+ADDRGP4 $748
+JUMPV
+LABELV $751
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 2147483647
+NEI4 $753
+ADDRGP4 $748
+JUMPV
+LABELV $753
+ADDRLP4 140
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GTI4 $756
+ADDRGP4 $748
+JUMPV
+LABELV $756
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $761
+JUMPV
+LABELV $758
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $762
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $767
+JUMPV
+LABELV $764
+ADDRLP4 208
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+ADDRLP4 68+4
+ADDP4
+ADDRLP4 208
+INDIRI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 212
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 212
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $765
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $767
+ADDRLP4 0
+INDIRI4
+ADDRLP4 132
+INDIRI4
+GEI4 $764
+ADDRGP4 $760
+JUMPV
+LABELV $762
+LABELV $759
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $761
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $758
+LABELV $760
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $748
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 16
+LTI4 $747
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRGP4 $773
+JUMPV
+LABELV $770
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 208
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 168
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $774
+ADDRLP4 212
+CNSTI4 2
+ASGNI4
+ADDRLP4 140
+ADDRLP4 144
+INDIRI4
+ADDRLP4 212
+INDIRI4
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ADDRLP4 212
+INDIRI4
+LSHI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 348
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+SUBI4
+CNSTI4 5000
+LTI4 $776
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $777
+JUMPV
+LABELV $776
+ADDRLP4 188
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 188
+INDIRF4
+ADDRLP4 188
+INDIRF4
+CVFI4 4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 216+12
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 216+8
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 216+4
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 216
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 216
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $777
+ADDRLP4 168
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 148+4
+INDIRF4
+ARGF4
+CNSTF4 1061158912
+ADDRLP4 148+8
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 148+12
+INDIRF4
+ARGF4
+ADDRLP4 216
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 172
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+CNSTI4 1000
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 148
+INDIRF4
+CNSTF4 1061158912
+ADDRLP4 148+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1077936128
+ADDF4
+ARGF4
+ADDRLP4 148+4
+INDIRF4
+ADDRLP4 148+12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 172
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 220
+CNSTI4 0
+ASGNI4
+ADDRLP4 220
+INDIRI4
+ARGI4
+ADDRLP4 220
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+ADDRLP4 192
+INDIRP4
+ADDRLP4 192
+INDIRP4
+INDIRF4
+ADDRLP4 148+8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+LABELV $774
+LABELV $771
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $773
+ADDRLP4 144
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $770
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $736
+endproc CG_DrawAreaPowerUp 240 32
+export CG_GetValue
+proc CG_GetValue 44 4
+ADDRLP4 0
+ADDRGP4 cg+531844
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 852
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 20
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $804
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GTI4 $811
+LABELV $810
+ADDRLP4 20
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+EQI4 $800
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+EQI4 $805
+ADDRLP4 20
+INDIRI4
+CNSTI4 6
+EQI4 $801
+ADDRGP4 $793
+JUMPV
+LABELV $811
+ADDRLP4 24
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 27
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $808
+ADDRLP4 24
+INDIRI4
+CNSTI4 28
+EQI4 $806
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $793
+LABELV $812
+ADDRLP4 32
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 40
+EQI4 $794
+ADDRLP4 32
+INDIRI4
+CNSTI4 41
+EQI4 $797
+ADDRGP4 $793
+JUMPV
+LABELV $794
+ADDRGP4 cg+531848
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 2108
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $790
+JUMPV
+LABELV $797
+ADDRGP4 cg+531848
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_GetSelectedPlayer
+CALLI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 2108
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $790
+JUMPV
+LABELV $800
+ADDRLP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $790
+JUMPV
+LABELV $801
+ADDRLP4 4
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $793
+ADDRLP4 4
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 412
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $790
+JUMPV
+LABELV $804
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $790
+JUMPV
+LABELV $805
+ADDRLP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $790
+JUMPV
+LABELV $806
+ADDRGP4 cgs+59308
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $790
+JUMPV
+LABELV $808
+ADDRGP4 cgs+59312
+INDIRI4
+CVIF4 4
+RETF4
+ADDRGP4 $790
+JUMPV
+LABELV $793
+CNSTF4 3212836864
+RETF4
+LABELV $790
+endproc CG_GetValue 44 4
+export CG_OtherTeamHasFlag
+proc CG_OtherTeamHasFlag 8 0
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+NEI4 $814
+ADDRLP4 0
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $818
+ADDRGP4 cgs+59316
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $818
+CNSTI4 1
+RETI4
+ADDRGP4 $813
+JUMPV
+LABELV $818
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $821
+ADDRGP4 cgs+59320
+INDIRI4
+CNSTI4 1
+NEI4 $821
+CNSTI4 1
+RETI4
+ADDRGP4 $813
+JUMPV
+LABELV $821
+CNSTI4 0
+RETI4
+ADDRGP4 $813
+JUMPV
+LABELV $814
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 5
+NEI4 $824
+ADDRLP4 0
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $828
+ADDRGP4 cgs+59324
+INDIRI4
+CNSTI4 3
+NEI4 $828
+CNSTI4 1
+RETI4
+ADDRGP4 $813
+JUMPV
+LABELV $828
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $831
+ADDRGP4 cgs+59324
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $831
+CNSTI4 1
+RETI4
+ADDRGP4 $813
+JUMPV
+LABELV $831
+CNSTI4 0
+RETI4
+ADDRGP4 $813
+JUMPV
+LABELV $824
+CNSTI4 0
+RETI4
+LABELV $813
+endproc CG_OtherTeamHasFlag 8 0
+export CG_YourTeamHasFlag
+proc CG_YourTeamHasFlag 8 0
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+NEI4 $835
+ADDRLP4 0
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $839
+ADDRGP4 cgs+59320
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $839
+CNSTI4 1
+RETI4
+ADDRGP4 $834
+JUMPV
+LABELV $839
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $842
+ADDRGP4 cgs+59316
+INDIRI4
+CNSTI4 1
+NEI4 $842
+CNSTI4 1
+RETI4
+ADDRGP4 $834
+JUMPV
+LABELV $842
+CNSTI4 0
+RETI4
+ADDRGP4 $834
+JUMPV
+LABELV $835
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 5
+NEI4 $845
+ADDRLP4 0
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $849
+ADDRGP4 cgs+59324
+INDIRI4
+CNSTI4 2
+NEI4 $849
+CNSTI4 1
+RETI4
+ADDRGP4 $834
+JUMPV
+LABELV $849
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $852
+ADDRGP4 cgs+59324
+INDIRI4
+CNSTI4 3
+NEI4 $852
+CNSTI4 1
+RETI4
+ADDRGP4 $834
+JUMPV
+LABELV $852
+CNSTI4 0
+RETI4
+ADDRGP4 $834
+JUMPV
+LABELV $845
+CNSTI4 0
+RETI4
+LABELV $834
+endproc CG_YourTeamHasFlag 8 0
+export CG_OwnerDrawVisible
+proc CG_OwnerDrawVisible 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $856
+CNSTI4 272
+ADDRGP4 cg+531848
+INDIRI4
+MULI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+INDIRI4
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+NEI4 $862
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $863
+JUMPV
+LABELV $862
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $863
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $856
+ADDRFP4 0
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $864
+CNSTI4 272
+ADDRGP4 cg+531848
+INDIRI4
+MULI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+INDIRI4
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+EQI4 $870
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $871
+JUMPV
+LABELV $870
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $871
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $864
+ADDRFP4 0
+INDIRI4
+CNSTI4 131072
+BANDI4
+CNSTI4 0
+EQI4 $872
+ADDRLP4 0
+ADDRGP4 CG_OtherTeamHasFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $872
+ADDRFP4 0
+INDIRI4
+CNSTI4 262144
+BANDI4
+CNSTI4 0
+EQI4 $874
+ADDRLP4 0
+ADDRGP4 CG_YourTeamHasFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $874
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $876
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $878
+ADDRGP4 cgs+59316
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $882
+ADDRGP4 cgs+59324
+INDIRI4
+CNSTI4 2
+NEI4 $878
+LABELV $882
+CNSTI4 1
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $878
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $883
+ADDRGP4 cgs+59320
+INDIRI4
+CNSTI4 1
+EQI4 $887
+ADDRGP4 cgs+59324
+INDIRI4
+CNSTI4 3
+NEI4 $883
+LABELV $887
+CNSTI4 1
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $883
+CNSTI4 0
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $876
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $888
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+LTI4 $890
+CNSTI4 1
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $890
+LABELV $888
+ADDRFP4 0
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $893
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+GEI4 $895
+CNSTI4 1
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $895
+LABELV $893
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $898
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 7
+NEI4 $900
+CNSTI4 1
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $900
+CNSTI4 0
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $898
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $903
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 5
+NEI4 $905
+CNSTI4 1
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $905
+CNSTI4 0
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $903
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $908
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+NEI4 $910
+CNSTI4 1
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $910
+LABELV $908
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $913
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 6
+NEI4 $915
+CNSTI4 1
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $915
+CNSTI4 0
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $913
+ADDRFP4 0
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $918
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 25
+GEI4 $920
+CNSTI4 1
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $920
+LABELV $918
+ADDRFP4 0
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $923
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 25
+LTI4 $925
+CNSTI4 1
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $925
+LABELV $923
+ADDRFP4 0
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $928
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 2
+NEI4 $930
+CNSTI4 1
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $930
+LABELV $928
+ADDRFP4 0
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $933
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 1
+NEI4 $935
+CNSTI4 1
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $935
+LABELV $933
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $938
+LABELV $938
+ADDRFP4 0
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $940
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 376
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $946
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 380
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $942
+LABELV $946
+CNSTI4 1
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $942
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $947
+CNSTI4 1
+RETI4
+ADDRGP4 $855
+JUMPV
+LABELV $947
+LABELV $940
+CNSTI4 0
+RETI4
+LABELV $855
+endproc CG_OwnerDrawVisible 4 0
+proc CG_DrawPlayerHasFlag 16 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $952
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $953
+JUMPV
+LABELV $952
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+LABELV $953
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $954
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $955
+JUMPV
+LABELV $954
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $957
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $958
+JUMPV
+LABELV $957
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 392
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $960
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+LABELV $960
+LABELV $958
+LABELV $955
+LABELV $950
+endproc CG_DrawPlayerHasFlag 16 24
+proc CG_DrawAreaSystemChat 8 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 systemChat
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $963
+endproc CG_DrawAreaSystemChat 8 32
+proc CG_DrawAreaTeamChat 8 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 teamChat1
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $964
+endproc CG_DrawAreaTeamChat 8 32
+proc CG_DrawAreaChat 8 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 teamChat2
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $965
+endproc CG_DrawAreaChat 8 32
+export CG_GetKillerText
+proc CG_GetKillerText 8 8
+ADDRLP4 0
+ADDRGP4 $967
+ASGNP4
+ADDRGP4 cg+531840
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $968
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 36020
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $968
+ADDRGP4 $972
+ARGP4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 36020
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $968
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $966
+endproc CG_GetKillerText 8 8
+proc CG_DrawKiller 24 32
+ADDRGP4 cg+531840
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $975
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 36020
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $975
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 CG_GetKillerText
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 CG_GetKillerText
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $975
+LABELV $974
+endproc CG_DrawKiller 24 32
+proc CG_DrawCapFragLimit 16 32
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+LTI4 $984
+ADDRLP4 4
+ADDRGP4 cgs+56108
+INDIRI4
+ASGNI4
+ADDRGP4 $985
+JUMPV
+LABELV $984
+ADDRLP4 4
+ADDRGP4 cgs+56104
+INDIRI4
+ASGNI4
+LABELV $985
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $986
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $979
+endproc CG_DrawCapFragLimit 16 32
+proc CG_Draw1stPlace 8 32
+ADDRGP4 cgs+59308
+INDIRI4
+CNSTI4 -9999
+EQI4 $988
+ADDRGP4 $986
+ARGP4
+ADDRGP4 cgs+59308
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $988
+LABELV $987
+endproc CG_Draw1stPlace 8 32
+proc CG_Draw2ndPlace 8 32
+ADDRGP4 cgs+59312
+INDIRI4
+CNSTI4 -9999
+EQI4 $993
+ADDRGP4 $986
+ARGP4
+ADDRGP4 cgs+59312
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $993
+LABELV $992
+endproc CG_Draw2ndPlace 8 32
+export CG_GetGameStatusText
+proc CG_GetGameStatusText 12 12
+ADDRLP4 0
+ADDRGP4 $967
+ASGNP4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 3
+GEI4 $998
+ADDRGP4 cg+531844
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $999
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $999
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $1005
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $999
+JUMPV
+LABELV $998
+ADDRGP4 cg+518852
+INDIRI4
+ADDRGP4 cg+518852+4
+INDIRI4
+NEI4 $1008
+ADDRGP4 $1013
+ARGP4
+ADDRGP4 cg+518852
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $1009
+JUMPV
+LABELV $1008
+ADDRGP4 cg+518852
+INDIRI4
+ADDRGP4 cg+518852+4
+INDIRI4
+LTI4 $1015
+ADDRGP4 $1020
+ARGP4
+ADDRGP4 cg+518852
+INDIRI4
+ARGI4
+ADDRGP4 cg+518852+4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $1016
+JUMPV
+LABELV $1015
+ADDRGP4 $1024
+ARGP4
+ADDRGP4 cg+518852+4
+INDIRI4
+ARGI4
+ADDRGP4 cg+518852
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $1016
+LABELV $1009
+LABELV $999
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $997
+endproc CG_GetGameStatusText 12 12
+proc CG_DrawGameStatus 8 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 CG_GetGameStatusText
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $1028
+endproc CG_DrawGameStatus 8 32
+export CG_GameTypeString
+proc CG_GameTypeString 0 0
+ADDRGP4 cgs+56064
+RETP4
+LABELV $1029
+endproc CG_GameTypeString 0 0
+proc CG_DrawGameType 8 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 CG_GameTypeString
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $1031
+endproc CG_DrawGameType 8 32
+export CG_DrawNewTeamInfo
+proc CG_DrawNewTeamInfo 116 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+512320
+INDIRI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayersTime
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 5000
+LEI4 $1034
+ADDRGP4 $1032
+JUMPV
+LABELV $1034
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+CNSTI4 8
+LEI4 $1038
+ADDRLP4 76
+CNSTI4 8
+ASGNI4
+ADDRGP4 $1039
+JUMPV
+LABELV $1038
+ADDRLP4 76
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1039
+ADDRLP4 36
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1043
+JUMPV
+LABELV $1040
+ADDRLP4 4
+CNSTI4 2108
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1045
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $1045
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ADDRLP4 68
+INDIRF4
+LEF4 $1047
+ADDRLP4 68
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1047
+LABELV $1045
+LABELV $1041
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1043
+ADDRLP4 8
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LTI4 $1040
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $1049
+ADDRLP4 8
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1053
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1053
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 88
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ADDRLP4 72
+INDIRF4
+LEF4 $1055
+ADDRLP4 72
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1055
+LABELV $1053
+LABELV $1050
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $1049
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1060
+JUMPV
+LABELV $1057
+ADDRLP4 4
+CNSTI4 2108
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+77768
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1062
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $1062
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1064
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $1068
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1070
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 92
+CNSTF4 1094713344
+ASGNF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 12
+ADDI4
+ASGNI4
+LABELV $1070
+LABELV $1068
+LABELV $1065
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LEI4 $1064
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1108344832
+ADDF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRGP4 CG_GetColorForHealth
+CALLV
+pop
+ADDRLP4 52
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+ADDRLP4 88
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRGP4 cgs+683776+127524
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 13
+ADDI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35660
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1074
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35664
+ADDP4
+INDIRI4
+CNSTI4 2500
+SUBI4
+LEI4 $1077
+ADDRGP4 cg+512320
+INDIRI4
+CNSTI4 9
+RSHI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1077
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1075
+JUMPV
+LABELV $1077
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 35656
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRGP4 $1075
+JUMPV
+LABELV $1074
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_StatusHandle
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 92
+INDIRI4
+ASGNI4
+LABELV $1075
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $1083
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 92
+CNSTF4 1094713344
+ASGNF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $1083
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 13
+ADDI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 92
+INDIRF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1077936128
+DIVF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+ARGP4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_Text_Paint_Limit
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1087
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1085
+LABELV $1087
+ADDRLP4 20
+ADDRGP4 $443
+ASGNP4
+LABELV $1085
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1077936128
+DIVF4
+CNSTF4 1073741824
+ADDF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+ADDRLP4 40
+ARGP4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_Text_Paint_Limit
+CALLV
+pop
+ADDRLP4 108
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ADDRLP4 108
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $1088
+ADDRGP4 $1059
+JUMPV
+LABELV $1088
+LABELV $1062
+LABELV $1058
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1060
+ADDRLP4 8
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LTI4 $1057
+LABELV $1059
+LABELV $1032
+endproc CG_DrawNewTeamInfo 116 32
+proc CG_DrawTeamSpectators 60 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 cg+522452
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+LEF4 $1093
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1094
+JUMPV
+LABELV $1093
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1094
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+523476
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 CG_SetClipRegion
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 cg+523480
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1077936128
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_PaintInMotion
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRGP4 cg+523480
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1077936128
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_PaintInMotion
+CALLV
+pop
+ADDRGP4 CG_ClearClipRegion
+CALLV
+pop
+ADDRLP4 52
+ADDRGP4 cg+523480
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1100
+JUMPV
+LABELV $1099
+ADDRLP4 56
+ADDRGP4 cg+523480
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $1100
+ADDRGP4 cg+523480
+INDIRF4
+ADDRLP4 0
+INDIRF4
+GTF4 $1099
+ADDRGP4 cg+523476
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $1090
+endproc CG_DrawTeamSpectators 60 32
+export CG_DrawMedal
+proc CG_DrawMedal 32 32
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRGP4 cg+531840
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1106
+ADDRGP4 $1105
+JUMPV
+LABELV $1106
+ADDRLP4 8
+CNSTI4 56
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 36052
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg+518860
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 53
+LTI4 $1111
+ADDRLP4 12
+INDIRI4
+CNSTI4 59
+GTI4 $1121
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1122-212
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1122
+address $1113
+address $1114
+address $1115
+address $1116
+address $1117
+address $1118
+address $1119
+code
+LABELV $1121
+ADDRFP4 0
+INDIRI4
+CNSTI4 69
+EQI4 $1120
+ADDRGP4 $1111
+JUMPV
+LABELV $1113
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1112
+JUMPV
+LABELV $1114
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1112
+JUMPV
+LABELV $1115
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1112
+JUMPV
+LABELV $1116
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1112
+JUMPV
+LABELV $1117
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1112
+JUMPV
+LABELV $1118
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1112
+JUMPV
+LABELV $1119
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1112
+JUMPV
+LABELV $1120
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1111
+LABELV $1112
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $1124
+ADDRFP4 0
+INDIRI4
+CNSTI4 58
+EQI4 $1126
+ADDRFP4 0
+INDIRI4
+CNSTI4 53
+NEI4 $1128
+ADDRGP4 $1130
+ARGP4
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1112014848
+LEF4 $1127
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1127
+JUMPV
+LABELV $1128
+ADDRGP4 $273
+ARGP4
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1127
+JUMPV
+LABELV $1126
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $1133
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $1133
+ADDRLP4 4
+ADDRGP4 $1135
+ASGNP4
+LABELV $1127
+LABELV $1124
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1136
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1092616192
+ADDF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 CG_Text_Paint
+CALLV
+pop
+LABELV $1136
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1105
+endproc CG_DrawMedal 32 32
+export CG_OwnerDraw
+proc CG_OwnerDraw 20 24
+ADDRFP4 40
+ADDRFP4 40
+INDIRF4
+ASGNF4
+ADDRFP4 44
+ADDRFP4 44
+INDIRP4
+ASGNP4
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+CNSTI4 0
+NEI4 $1139
+ADDRGP4 $1138
+JUMPV
+LABELV $1139
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $1146
+ADDRLP4 16
+INDIRI4
+CNSTI4 69
+GTI4 $1146
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1204-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1204
+address $1147
+address $1149
+address $1163
+address $1166
+address $1150
+address $1152
+address $1153
+address $1159
+address $1160
+address $1156
+address $1161
+address $1162
+address $1146
+address $1146
+address $1146
+address $1146
+address $1146
+address $1146
+address $1164
+address $1165
+address $1171
+address $1172
+address $1173
+address $1174
+address $1175
+address $1176
+address $1168
+address $1167
+address $1169
+address $1170
+address $1177
+address $1179
+address $1180
+address $1181
+address $1182
+address $1183
+address $1146
+address $1185
+address $1190
+address $1157
+address $1158
+address $1184
+address $1146
+address $1146
+address $1146
+address $1187
+address $1188
+address $1189
+address $1191
+address $1192
+address $1148
+address $1151
+address $1193
+address $1193
+address $1193
+address $1193
+address $1193
+address $1193
+address $1193
+address $1194
+address $1195
+address $1154
+address $1155
+address $1186
+address $1178
+address $1201
+address $1202
+address $1203
+address $1193
+code
+LABELV $1147
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+ADDRGP4 CG_DrawPlayerArmorIcon
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1148
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawPlayerArmorIcon
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1149
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPlayerArmorValue
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1150
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+ADDRGP4 CG_DrawPlayerAmmoIcon
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1151
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawPlayerAmmoIcon
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1152
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPlayerAmmoValue
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1153
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerHead
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1154
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerHead
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1155
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerName
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1156
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawSelectedPlayerStatus
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1157
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerArmor
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1158
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerHealth
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1159
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerName
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1160
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerLocation
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1161
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawSelectedPlayerWeapon
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1162
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+ADDRGP4 CG_DrawSelectedPlayerPowerup
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1163
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+ADDRGP4 CG_DrawPlayerHead
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1164
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRI4
+CNSTI4 268435456
+BANDI4
+ARGI4
+ADDRGP4 CG_DrawPlayerItem
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1165
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPlayerScore
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1166
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPlayerHealth
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1167
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawRedScore
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1168
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawBlueScore
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1169
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawRedName
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1170
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawBlueName
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1171
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawBlueFlagHead
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1172
+ADDRLP4 0
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawBlueFlagStatus
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1173
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawBlueFlagName
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1174
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawRedFlagHead
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1175
+ADDRLP4 0
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawRedFlagStatus
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1176
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawRedFlagName
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1177
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_HarvesterSkulls
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1178
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_HarvesterSkulls
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1179
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_OneFlagStatus
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1180
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPlayerLocation
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1181
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawTeamColor
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1182
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawCTFPowerUp
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1183
+ADDRLP4 0
+ARGP4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRFP4 36
+INDIRF4
+ARGF4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawAreaPowerUp
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1184
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawPlayerStatus
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1185
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawPlayerHasFlag
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1186
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawPlayerHasFlag
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1187
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawAreaSystemChat
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1188
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawAreaTeamChat
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1189
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawAreaChat
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1190
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawGameType
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1191
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawGameStatus
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1192
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawKiller
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1193
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawMedal
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1194
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawTeamSpectators
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1195
+CNSTI4 272
+ADDRGP4 cg+531848
+INDIRI4
+MULI4
+ADDRGP4 cg_currentSelectedPlayer+12
+ADDP4
+INDIRI4
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 numSortedTeamPlayers
+ADDP4
+INDIRI4
+NEI4 $1146
+ADDRLP4 0
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawNewTeamInfo
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1201
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawCapFragLimit
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1202
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_Draw1stPlace
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1203
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 48
+INDIRI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_Draw2ndPlace
+CALLV
+pop
+LABELV $1146
+LABELV $1138
+endproc CG_OwnerDraw 20 24
+export CG_MouseEvent
+proc CG_MouseEvent 24 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1207
+ADDRGP4 $1206
+JUMPV
+LABELV $1207
+ADDRGP4 cgDC
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRGP4 cgDC+220
+ADDRGP4 cgs+212680
+INDIRI4
+ASGNI4
+ADDRGP4 cgDC+224
+ADDRGP4 cgs+212684
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+531852
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1216
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $1214
+LABELV $1216
+ADDRLP4 0
+INDIRP4
+CNSTI4 36008
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1214
+CNSTI4 0
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+ADDRGP4 $1206
+JUMPV
+LABELV $1214
+ADDRLP4 12
+ADDRGP4 cgs+212680
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cgs+212680
+INDIRI4
+CNSTI4 0
+GEI4 $1218
+ADDRGP4 cgs+212680
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1219
+JUMPV
+LABELV $1218
+ADDRGP4 cgs+212680
+INDIRI4
+CNSTI4 640
+LEI4 $1222
+ADDRGP4 cgs+212680
+CNSTI4 640
+ASGNI4
+LABELV $1222
+LABELV $1219
+ADDRLP4 16
+ADDRGP4 cgs+212684
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cgs+212684
+INDIRI4
+CNSTI4 0
+GEI4 $1227
+ADDRGP4 cgs+212684
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1228
+JUMPV
+LABELV $1227
+ADDRGP4 cgs+212684
+INDIRI4
+CNSTI4 480
+LEI4 $1231
+ADDRGP4 cgs+212684
+CNSTI4 480
+ASGNI4
+LABELV $1231
+LABELV $1228
+ADDRGP4 cgs+212680
+INDIRI4
+ARGI4
+ADDRGP4 cgs+212684
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Display_CursorType
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+212704
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $1238
+ADDRGP4 cgs+212704
+ADDRGP4 cgs+683776+127516
+INDIRI4
+ASGNI4
+ADDRGP4 $1239
+JUMPV
+LABELV $1238
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+NEI4 $1243
+ADDRGP4 cgs+212704
+ADDRGP4 cgs+683776+127520
+INDIRI4
+ASGNI4
+LABELV $1243
+LABELV $1239
+ADDRGP4 cgs+212700
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1248
+ADDRGP4 cgs+212700
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Display_MouseMove
+CALLI4
+pop
+ADDRGP4 $1249
+JUMPV
+LABELV $1248
+CNSTP4 0
+ARGP4
+ADDRGP4 cgs+212680
+INDIRI4
+ARGI4
+ADDRGP4 cgs+212684
+INDIRI4
+ARGI4
+ADDRGP4 Display_MouseMove
+CALLI4
+pop
+LABELV $1249
+LABELV $1206
+endproc CG_MouseEvent 24 12
+export CG_HideTeamMenu
+proc CG_HideTeamMenu 0 4
+ADDRGP4 cgDC
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRGP4 $1255
+ARGP4
+ADDRGP4 Menus_CloseByName
+CALLV
+pop
+ADDRGP4 $1256
+ARGP4
+ADDRGP4 Menus_CloseByName
+CALLV
+pop
+LABELV $1254
+endproc CG_HideTeamMenu 0 4
+export CG_ShowTeamMenu
+proc CG_ShowTeamMenu 0 4
+ADDRGP4 cgDC
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRGP4 $1255
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+LABELV $1257
+endproc CG_ShowTeamMenu 0 4
+export CG_EventHandling
+proc CG_EventHandling 0 0
+ADDRGP4 cgs+212688
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1260
+ADDRGP4 CG_HideTeamMenu
+CALLV
+pop
+ADDRGP4 $1261
+JUMPV
+LABELV $1260
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $1262
+ADDRGP4 $1263
+JUMPV
+LABELV $1262
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $1264
+LABELV $1264
+LABELV $1263
+LABELV $1261
+LABELV $1258
+endproc CG_EventHandling 0 0
+export CG_KeyEvent
+proc CG_KeyEvent 20 16
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1267
+ADDRGP4 $1266
+JUMPV
+LABELV $1267
+ADDRGP4 cgDC
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+NEI4 $1269
+ADDRLP4 4
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -9
+BANDI4
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_EventHandling
+CALLV
+pop
+ADDRGP4 $1266
+JUMPV
+LABELV $1269
+ADDRLP4 0
+ADDRGP4 cg+531852
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1274
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $1272
+ADDRLP4 0
+INDIRP4
+CNSTI4 36008
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $1272
+LABELV $1274
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_EventHandling
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+ADDRGP4 $1266
+JUMPV
+LABELV $1272
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 cgs+212680
+INDIRI4
+ARGI4
+ADDRGP4 cgs+212684
+INDIRI4
+ARGI4
+ADDRGP4 Display_HandleKey
+CALLV
+pop
+ADDRGP4 cgs+212700
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1277
+ADDRGP4 cgs+212700
+CNSTP4 0
+ASGNP4
+ADDRGP4 $1278
+JUMPV
+LABELV $1277
+ADDRFP4 0
+INDIRI4
+CNSTI4 185
+NEI4 $1281
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1281
+ADDRGP4 cgs+212680
+INDIRI4
+ARGI4
+ADDRGP4 cgs+212684
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 Display_CaptureItem
+CALLP4
+ASGNP4
+ADDRGP4 cgs+212700
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $1281
+LABELV $1278
+LABELV $1266
+endproc CG_KeyEvent 20 16
+export CG_RunMenuScript
+proc CG_RunMenuScript 0 0
+LABELV $1286
+endproc CG_RunMenuScript 0 0
+export CG_GetTeamColor
+proc CG_GetTeamColor 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+531844
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1288
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1288
+ADDRFP4 0
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $1289
+JUMPV
+LABELV $1288
+ADDRGP4 cg+531844
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1292
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1292
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRGP4 $1293
+JUMPV
+LABELV $1292
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1043207291
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+LABELV $1293
+LABELV $1289
+LABELV $1287
+endproc CG_GetTeamColor 8 0
+import cgDC
+import Controls_SetDefaults_ui_shared
+import Controls_SetConfig_ui_shared
+import Controls_GetConfig_ui_shared
+import UI_OutOfMemory
+import UI_InitMemory_ui_shared
+import UI_Alloc_ui_shared
+import Menu_FindItemByName
+import Display_ScriptExecutions
+import Display_DebugMode
+import Display_CacheAll
+import Menu_SetScreenPlacement
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_WantsBindKeys
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import Script_Compile
+import PC_CompiledScript_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_LoadVoiceChats
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_Draw3DModel
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_enableBreath
+import cg_enableDust
+import cg_blueTeamName
+import cg_redTeamName
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1256
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1255
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $1135
+byte 1 87
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $1130
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 37
+byte 1 0
+align 1
+LABELV $1024
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1020
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1013
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1005
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $986
+byte 1 37
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $972
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $967
+byte 1 0
+align 1
+LABELV $543
+byte 1 45
+byte 1 0
+align 1
+LABELV $443
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $273
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $221
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $217
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $216
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $203
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $202
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $199
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $198
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $195
+byte 1 118
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $194
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $189
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $188
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $186
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $185
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $183
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $182
+byte 1 111
+byte 1 110
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $180
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $179
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $178
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $177
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $175
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 57
+byte 1 0
+align 1
+LABELV $174
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 57
+byte 1 0
+align 1
+LABELV $173
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $172
+byte 1 111
+byte 1 110
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $170
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 56
+byte 1 0
+align 1
+LABELV $169
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 56
+byte 1 0
+align 1
+LABELV $168
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $167
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $165
+byte 1 45
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 55
+byte 1 0
+align 1
+LABELV $164
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 55
+byte 1 0
+align 1
+LABELV $163
+byte 1 37
+byte 1 115
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 59
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $162
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $161
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
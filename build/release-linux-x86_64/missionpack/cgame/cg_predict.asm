@@ -0,0 +1,7995 @@
+code
+proc CG_SolidStateBounds 64 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $100
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $100
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $97
+LABELV $100
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $97
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $101
+CNSTI4 0
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $101
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $103
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 RadiusFromBounds
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $105
+ADDRLP4 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 20
+ADDP4
+ADDRLP4 60
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $106
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $105
+ADDRGP4 $104
+JUMPV
+LABELV $103
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 20+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 20+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $104
+ADDRLP4 8
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 AddPointToBounds
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 AddPointToBounds
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $96
+endproc CG_SolidStateBounds 64 12
+proc CG_SolidFixedBounds 48 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 8
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $117
+ADDRFP4 0
+INDIRP4
+CNSTI4 368
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 12
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $115
+LABELV $117
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $116
+JUMPV
+LABELV $115
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $116
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 ClearBounds
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 CG_SolidStateBounds
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $118
+CNSTI4 0
+RETI4
+ADDRGP4 $113
+JUMPV
+LABELV $118
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 CG_SolidStateBounds
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $120
+CNSTI4 0
+RETI4
+ADDRGP4 $113
+JUMPV
+LABELV $120
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $113
+endproc CG_SolidFixedBounds 48 16
+proc CG_SolidCurrentBounds 48 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $123
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $125
+CNSTI4 0
+RETI4
+ADDRGP4 $122
+JUMPV
+LABELV $125
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRGP4 cg+512328
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 RadiusFromBounds
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 36
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $128
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $129
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $128
+ADDRGP4 $124
+JUMPV
+LABELV $123
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $132
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $133
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $132
+LABELV $124
+CNSTI4 1
+RETI4
+LABELV $122
+endproc CG_SolidCurrentBounds 48 12
+proc CG_SolidGridCoord 4 4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1132462080
+DIVF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+RETI4
+LABELV $136
+endproc CG_SolidGridCoord 4 4
+proc CG_LinkSolidGrid 84 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+CNSTI4 12
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_solidAbsMins
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 CG_SolidGridCoord
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 12
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_solidAbsMins+4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 CG_SolidGridCoord
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 36
+INDIRI4
+ASGNI4
+CNSTI4 12
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_solidAbsMaxs
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 CG_SolidGridCoord
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 40
+INDIRI4
+ASGNI4
+CNSTI4 12
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_solidAbsMaxs+4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 CG_SolidGridCoord
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 32
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 52
+INDIRI4
+GEI4 $144
+ADDRLP4 56
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 52
+INDIRI4
+GEI4 $144
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+ADDRLP4 64
+ADDRLP4 48
+INDIRI4
+ADDRLP4 60
+INDIRI4
+ADDI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+ADDI4
+MULI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 64
+GTI4 $144
+ADDRGP4 cg_numSolidGridLinks
+INDIRI4
+ADDRLP4 64
+INDIRI4
+ADDI4
+CNSTI4 4096
+LEI4 $140
+LABELV $144
+CNSTI4 0
+RETI4
+ADDRGP4 $137
+JUMPV
+LABELV $140
+ADDRLP4 12
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $148
+JUMPV
+LABELV $145
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $152
+JUMPV
+LABELV $149
+ADDRLP4 72
+CNSTI4 31
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+BANDI4
+CNSTI4 5
+LSHI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+BANDI4
+ADDI4
+ASGNI4
+ADDRLP4 76
+ADDRGP4 cg_numSolidGridLinks
+ASGNP4
+ADDRLP4 68
+ADDRLP4 76
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidGridLinkSolid
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LSHI4
+ADDRGP4 cg_solidGridLinkNext
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LSHI4
+ADDRGP4 cg_solidGridHeads
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidGridHeads
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $150
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $152
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LEI4 $149
+LABELV $146
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $148
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $145
+CNSTI4 1
+RETI4
+LABELV $137
+endproc CG_LinkSolidGrid 84 4
+proc CG_BuildSolidGrid 36 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $154
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidGridHeads
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $155
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $154
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_numSolidGridLinks
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_numLooseSolids
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $161
+JUMPV
+LABELV $158
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidTraceNum
+ADDP4
+ADDRGP4 cg_traceNum
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg_solidEntities
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg_solidAbsMins
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg_solidAbsMaxs
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 CG_SolidFixedBounds
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg_solidFixed
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidFixed
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $164
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_LinkSolidGrid
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $162
+LABELV $164
+ADDRGP4 cg_numLooseSolids
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_looseSolids
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 cg_numLooseSolids
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $162
+LABELV $159
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $161
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg_numSolidEntities
+INDIRI4
+LTI4 $158
+LABELV $153
+endproc CG_BuildSolidGrid 36 12
+export CG_BuildSolidList
+proc CG_BuildSolidList 44 24
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_showTraceTests+12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $166
+ADDRGP4 cg_traceCount
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $166
+ADDRGP4 $169
+ARGP4
+ADDRLP4 24
+ADDRGP4 cg_traceCount
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 cg_traceCandidates
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+DIVF4
+ARGF4
+ADDRGP4 cg_traceClips
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+DIVF4
+ARGF4
+ADDRGP4 cg_numSolidEntities
+INDIRI4
+ARGI4
+ADDRGP4 cg_numLooseSolids
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $166
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_traceCount
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cg_traceCandidates
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cg_traceClips
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cg_numSolidEntities
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cg_numTriggerEntities
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cg+52
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $170
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+512304
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $170
+ADDRGP4 cg+512300
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $170
+ADDRLP4 8
+ADDRGP4 cg+52
+INDIRP4
+ASGNP4
+ADDRGP4 $171
+JUMPV
+LABELV $170
+ADDRLP4 8
+ADDRGP4 cg+48
+INDIRP4
+ASGNP4
+LABELV $171
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $177
+ADDRLP4 4
+CNSTI4 248
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 852
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+EQI4 $184
+ADDRLP4 32
+INDIRI4
+CNSTI4 8
+EQI4 $184
+ADDRLP4 32
+INDIRI4
+CNSTI4 9
+NEI4 $181
+LABELV $184
+ADDRGP4 cg_numTriggerEntities
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_triggerEntities
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRGP4 cg_numTriggerEntities
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $178
+JUMPV
+LABELV $181
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $187
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $185
+LABELV $187
+ADDRGP4 cg_numSolidEntities
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidEntities
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRGP4 cg_numSolidEntities
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $185
+LABELV $178
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $180
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+LTI4 $177
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $191
+JUMPV
+LABELV $188
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $192
+ADDRGP4 $189
+JUMPV
+LABELV $192
+ADDRLP4 12
+CNSTI4 500
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 852
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $194
+ADDRLP4 12
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $194
+ADDRGP4 cg_numSolidEntities
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidEntities
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRGP4 cg_numSolidEntities
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $194
+LABELV $189
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $191
+ADDRLP4 32
+ADDRGP4 CG_MaxSplitView
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LTI4 $188
+ADDRGP4 CG_BuildSolidGrid
+CALLV
+pop
+LABELV $165
+endproc CG_BuildSolidList 44 24
+proc CG_ClipMoveToSolid 160 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 36
+ADDRFP4 36
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidTraceNum
+ADDP4
+INDIRI4
+ADDRGP4 cg_traceNum
+INDIRI4
+NEI4 $197
+CNSTI4 0
+RETI4
+ADDRGP4 $196
+JUMPV
+LABELV $197
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidTraceNum
+ADDP4
+ADDRGP4 cg_traceNum
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidEntities
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 28
+INDIRI4
+NEI4 $199
+CNSTI4 0
+RETI4
+ADDRGP4 $196
+JUMPV
+LABELV $199
+ADDRFP4 32
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $201
+CNSTI4 0
+RETI4
+ADDRGP4 $196
+JUMPV
+LABELV $201
+ADDRLP4 128
+ADDRGP4 cg_traceCandidates
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidFixed
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $203
+ADDRLP4 132
+CNSTI4 12
+ADDRFP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 132
+INDIRI4
+ADDRGP4 cg_solidAbsMins
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 80
+ADDRLP4 132
+INDIRI4
+ADDRGP4 cg_solidAbsMaxs
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 112
+CNSTI4 1
+ASGNI4
+ADDRGP4 $204
+JUMPV
+LABELV $203
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 132
+ADDRGP4 CG_SolidCurrentBounds
+CALLI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 132
+INDIRI4
+ASGNI4
+LABELV $204
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+EQI4 $205
+ADDRLP4 68
+INDIRF4
+ADDRFP4 24
+INDIRP4
+INDIRF4
+GTF4 $215
+ADDRLP4 136
+CNSTI4 4
+ASGNI4
+ADDRLP4 68+4
+INDIRF4
+ADDRFP4 24
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $215
+ADDRLP4 140
+CNSTI4 8
+ASGNI4
+ADDRLP4 68+8
+INDIRF4
+ADDRFP4 24
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $215
+ADDRLP4 80
+INDIRF4
+ADDRFP4 20
+INDIRP4
+INDIRF4
+LTF4 $215
+ADDRLP4 80+4
+INDIRF4
+ADDRFP4 20
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+LTF4 $215
+ADDRLP4 80+8
+INDIRF4
+ADDRFP4 20
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+GEF4 $205
+LABELV $215
+CNSTI4 0
+RETI4
+ADDRGP4 $196
+JUMPV
+LABELV $205
+ADDRLP4 148
+ADDRGP4 cg_traceClips
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $216
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 trap_CM_InlineModel
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 116
+ADDRLP4 92
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 92
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRGP4 cg+512328
+INDIRI4
+ARGI4
+ADDRLP4 100
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRGP4 $217
+JUMPV
+LABELV $216
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $219
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 trap_CM_TempCapsuleModel
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 116
+ADDRGP4 vec3_origin
+INDIRB
+ASGNB 12
+ADDRLP4 100
+ADDRLP4 92
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $220
+JUMPV
+LABELV $219
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 trap_CM_TempBoxModel
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 116
+ADDRGP4 vec3_origin
+INDIRB
+ASGNB 12
+ADDRLP4 100
+ADDRLP4 92
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $220
+LABELV $217
+ADDRFP4 40
+INDIRI4
+CNSTI4 3
+NEI4 $221
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRLP4 100
+ARGP4
+ADDRGP4 trap_CM_TransformedBiSphereTrace
+CALLV
+pop
+ADDRGP4 $222
+JUMPV
+LABELV $221
+ADDRFP4 40
+INDIRI4
+CNSTI4 2
+NEI4 $223
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRLP4 100
+ARGP4
+ADDRLP4 116
+ARGP4
+ADDRGP4 trap_CM_TransformedCapsuleTrace
+CALLV
+pop
+ADDRGP4 $224
+JUMPV
+LABELV $223
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRFP4 32
+INDIRI4
+ARGI4
+ADDRLP4 100
+ARGP4
+ADDRLP4 116
+ARGP4
+ADDRGP4 trap_CM_TransformedBoxTrace
+CALLV
+pop
+LABELV $224
+LABELV $222
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $228
+ADDRLP4 4+8
+INDIRF4
+ADDRFP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+GEF4 $225
+LABELV $228
+ADDRLP4 4+56
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 36
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 4+60
+INDIRF4
+GEF4 $230
+ADDRLP4 152
+ADDRFP4 36
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 36
+INDIRP4
+ADDRLP4 4
+INDIRB
+ASGNB 64
+ADDRFP4 36
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 152
+INDIRF4
+ASGNF4
+ADDRGP4 $226
+JUMPV
+LABELV $230
+ADDRFP4 36
+INDIRP4
+ADDRLP4 4
+INDIRB
+ASGNB 64
+ADDRGP4 $226
+JUMPV
+LABELV $225
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 0
+EQI4 $233
+ADDRFP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 36
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+LABELV $233
+LABELV $226
+ADDRFP4 36
+INDIRP4
+INDIRI4
+RETI4
+LABELV $196
+endproc CG_ClipMoveToSolid 160 36
+proc CG_ClipMoveToEntities 116 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRGP4 cg_traceNum
+ASGNP4
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 68
+ADDRGP4 cg_traceCount
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+LABELV $237
+ADDRLP4 72
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 72
+INDIRI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+INDIRF4
+GEF4 $241
+ADDRLP4 76
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 80
+INDIRI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $242
+JUMPV
+LABELV $241
+ADDRLP4 76
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 80
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $242
+LABELV $238
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 3
+LTI4 $237
+ADDRFP4 28
+INDIRI4
+CNSTI4 3
+NEI4 $243
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+LEF4 $246
+ADDRLP4 72
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 $247
+JUMPV
+LABELV $246
+ADDRLP4 72
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $247
+ADDRLP4 52
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+LABELV $248
+ADDRLP4 76
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $249
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 3
+LTI4 $248
+ADDRGP4 $244
+JUMPV
+LABELV $243
+ADDRLP4 72
+CNSTU4 0
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 72
+INDIRU4
+EQU4 $252
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 72
+INDIRU4
+EQU4 $252
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 16+4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $252
+LABELV $244
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 76
+ADDRGP4 CG_SolidGridCoord
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 4+4
+INDIRF4
+ARGF4
+ADDRLP4 80
+ADDRGP4 CG_SolidGridCoord
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 CG_SolidGridCoord
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 16+4
+INDIRF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 CG_SolidGridCoord
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 48
+INDIRI4
+ADDRLP4 56
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 96
+CNSTI4 32
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 96
+INDIRI4
+GEI4 $267
+ADDRLP4 100
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+ADDRLP4 96
+INDIRI4
+GEI4 $267
+ADDRLP4 104
+CNSTI4 1
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ADDRLP4 100
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+MULI4
+CNSTI4 64
+LEI4 $264
+LABELV $267
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 $271
+JUMPV
+LABELV $268
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_ClipMoveToSolid
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+EQI4 $272
+ADDRGP4 $236
+JUMPV
+LABELV $272
+LABELV $269
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $271
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cg_numSolidEntities
+INDIRI4
+LTI4 $268
+ADDRGP4 $236
+JUMPV
+LABELV $264
+ADDRLP4 36
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $277
+JUMPV
+LABELV $274
+ADDRLP4 28
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $281
+JUMPV
+LABELV $278
+ADDRLP4 108
+CNSTI4 31
+ASGNI4
+ADDRLP4 0
+ADDRLP4 36
+INDIRI4
+ADDRLP4 108
+INDIRI4
+BANDI4
+CNSTI4 5
+LSHI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 108
+INDIRI4
+BANDI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidGridHeads
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $285
+JUMPV
+LABELV $282
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidGridLinkSolid
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_ClipMoveToSolid
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+EQI4 $286
+ADDRGP4 $236
+JUMPV
+LABELV $286
+LABELV $283
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidGridLinkNext
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $285
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $282
+LABELV $279
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $281
+ADDRLP4 28
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LEI4 $278
+LABELV $275
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $277
+ADDRLP4 36
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LEI4 $274
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 $291
+JUMPV
+LABELV $288
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_looseSolids
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 CG_ClipMoveToSolid
+CALLI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+EQI4 $292
+ADDRGP4 $236
+JUMPV
+LABELV $292
+LABELV $289
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $291
+ADDRLP4 32
+INDIRI4
+ADDRGP4 cg_numLooseSolids
+INDIRI4
+LTI4 $288
+LABELV $236
+endproc CG_ClipMoveToEntities 116 44
+export CG_Trace
+proc CG_Trace 68 32
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $298
+ADDRLP4 64
+CNSTI4 4094
+ASGNI4
+ADDRGP4 $299
+JUMPV
+LABELV $298
+ADDRLP4 64
+CNSTI4 4095
+ASGNI4
+LABELV $299
+ADDRLP4 0+56
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_ClipMoveToEntities
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 64
+LABELV $294
+endproc CG_Trace 68 32
+export CG_TraceCapsule
+proc CG_TraceCapsule 68 32
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 trap_CM_CapsuleTrace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $304
+ADDRLP4 64
+CNSTI4 4094
+ASGNI4
+ADDRGP4 $305
+JUMPV
+LABELV $304
+ADDRLP4 64
+CNSTI4 4095
+ASGNI4
+LABELV $305
+ADDRLP4 0+56
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_ClipMoveToEntities
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 64
+LABELV $300
+endproc CG_TraceCapsule 68 32
+export CG_BiSphereTrace
+proc CG_BiSphereTrace 100 32
+ADDRLP4 88
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 92
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 trap_CM_BiSphereTrace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $310
+ADDRLP4 96
+CNSTI4 4094
+ASGNI4
+ADDRGP4 $311
+JUMPV
+LABELV $310
+ADDRLP4 96
+CNSTI4 4095
+ASGNI4
+LABELV $311
+ADDRLP4 0+56
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 CG_ClipMoveToEntities
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 64
+LABELV $306
+endproc CG_BiSphereTrace 100 32
+export CG_PointContents
+proc CG_PointContents 36 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 trap_CM_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $316
+JUMPV
+LABELV $313
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_solidEntities
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $317
+ADDRGP4 $314
+JUMPV
+LABELV $317
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $319
+ADDRGP4 $314
+JUMPV
+LABELV $319
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 trap_CM_InlineModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $321
+ADDRGP4 $314
+JUMPV
+LABELV $321
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 740
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 752
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_CM_TransformedPointContents
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 32
+INDIRI4
+BORI4
+ASGNI4
+LABELV $314
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $316
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_numSolidEntities
+INDIRI4
+LTI4 $313
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $312
+endproc CG_PointContents 36 16
+proc CG_InterpolatePlayerState 108 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRGP4 cg+48
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRGP4 cg+52
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRGP4 cg+531844
+INDIRP4
+INDIRB
+ASGNB 500
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $328
+ADDRLP4 60
+ADDRGP4 trap_GetCurrentCmdNumber
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRGP4 cg+531848
+INDIRI4
+ARGI4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 PM_UpdateViewAngles
+CALLV
+pop
+LABELV $328
+ADDRGP4 cg+512304
+INDIRI4
+CNSTI4 0
+EQI4 $331
+ADDRGP4 $323
+JUMPV
+LABELV $331
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $336
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+GTI4 $334
+LABELV $336
+ADDRGP4 $323
+JUMPV
+LABELV $334
+ADDRLP4 36
+CNSTI4 2
+ASGNI4
+ADDRLP4 40
+CNSTI4 140
+ASGNI4
+ADDRLP4 44
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cg+531848
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $341
+ADDRGP4 cg+531848
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $337
+LABELV $341
+ADDRGP4 $323
+JUMPV
+LABELV $337
+ADDRLP4 48
+CNSTI4 500
+ASGNI4
+ADDRLP4 56
+CNSTI4 254120
+ASGNI4
+ADDRLP4 4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+531848
+INDIRI4
+MULI4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+531848
+INDIRI4
+MULI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 64
+CNSTI4 8
+ASGNI4
+ADDRLP4 68
+ADDRLP4 20
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+512320
+INDIRI4
+ADDRLP4 68
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 72
+CNSTI4 112
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $345
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+ADDI4
+ASGNI4
+LABELV $345
+ADDRLP4 76
+CNSTI4 112
+ASGNI4
+ADDRLP4 80
+ADDRLP4 4
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 80
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $347
+ADDRLP4 84
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 88
+CNSTI4 4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 84
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 84
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 92
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 84
+INDIRI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $351
+ADDRLP4 96
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 24
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 96
+INDIRI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 104
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRLP4 96
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 104
+INDIRF4
+ASGNF4
+LABELV $351
+ADDRLP4 96
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 124
+ASGNI4
+ADDRLP4 104
+ADDRLP4 96
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 104
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 96
+INDIRI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 104
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $348
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $347
+LABELV $323
+endproc CG_InterpolatePlayerState 108 12
+proc CG_TouchItem 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_predictItems+12
+INDIRI4
+CNSTI4 0
+NEI4 $354
+ADDRGP4 $353
+JUMPV
+LABELV $354
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+512320
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BG_PlayerTouchesItem
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $357
+ADDRGP4 $353
+JUMPV
+LABELV $357
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+NEI4 $361
+ADDRGP4 $353
+JUMPV
+LABELV $361
+ADDRGP4 cgs+56096
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BG_CanItemBeGrabbed
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $364
+ADDRGP4 $353
+JUMPV
+LABELV $364
+ADDRLP4 0
+CNSTI4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 5
+NEI4 $368
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $371
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 9
+EQI4 $371
+ADDRGP4 $353
+JUMPV
+LABELV $371
+LABELV $368
+ADDRGP4 cgs+56096
+INDIRI4
+CNSTI4 4
+NEI4 $373
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $376
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $376
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $376
+ADDRGP4 $353
+JUMPV
+LABELV $376
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $379
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $379
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $379
+ADDRGP4 $353
+JUMPV
+LABELV $379
+LABELV $373
+CNSTI4 19
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRGP4 BG_AddPredictableEventToPlayerstate
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDRGP4 cg+512320
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $384
+ADDRLP4 16
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 300
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $387
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $387
+LABELV $384
+LABELV $353
+endproc CG_TouchItem 24 12
+proc CG_TouchTriggerPrediction 100 28
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $392
+ADDRGP4 $391
+JUMPV
+LABELV $392
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $397
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+ADDRGP4 $398
+JUMPV
+LABELV $397
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+LABELV $398
+ADDRLP4 80
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+EQI4 $399
+ADDRLP4 80
+INDIRI4
+ADDRLP4 88
+INDIRI4
+NEI4 $399
+ADDRGP4 $391
+JUMPV
+LABELV $399
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $405
+JUMPV
+LABELV $402
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_triggerEntities
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $406
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $406
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 CG_TouchItem
+CALLV
+pop
+ADDRGP4 $403
+JUMPV
+LABELV $406
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $408
+ADDRGP4 $403
+JUMPV
+LABELV $408
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 trap_CM_InlineModel
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $410
+ADDRGP4 $403
+JUMPV
+LABELV $410
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $412
+ADDRLP4 16
+ARGP4
+ADDRLP4 96
+CNSTI4 12
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 168
+ADDP4
+ARGP4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+ADDRGP4 trap_CM_CapsuleTrace
+CALLV
+pop
+ADDRGP4 $413
+JUMPV
+LABELV $412
+ADDRLP4 16
+ARGP4
+ADDRLP4 96
+CNSTI4 12
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 168
+ADDP4
+ARGP4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+LABELV $413
+ADDRLP4 16+4
+INDIRI4
+CNSTI4 0
+NEI4 $423
+ADDRGP4 $403
+JUMPV
+LABELV $423
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $426
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $427
+JUMPV
+LABELV $426
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $429
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BG_TouchJumpPad
+CALLV
+pop
+LABELV $429
+LABELV $427
+LABELV $403
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $405
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg_numTriggerEntities
+INDIRI4
+LTI4 $402
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+EQI4 $432
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 500
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 492
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $432
+LABELV $391
+endproc CG_TouchTriggerPrediction 100 28
+proc CG_CopyPmoveState 112 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+CNSTI4 124
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+CNSTI4 24
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+CNSTI4 148
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+CNSTI4 160
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+CNSTI4 172
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 28
+CNSTI4 36
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 112
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 116
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 120
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 136
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 184
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 188
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 192
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+CNSTI4 196
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 200
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 204
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 220
+ASGNI4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 -4353
+BANDI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 4352
+BANDI4
+BORI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 260
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 84
+CNSTI4 264
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+CNSTI4 288
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $439
+ADDRLP4 92
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 96
+CNSTI4 412
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 92
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $440
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $439
+ADDRLP4 92
+CNSTI4 232
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $443
+ADDRLP4 96
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 236
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 96
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 244
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $444
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $443
+ADDRLP4 96
+CNSTI4 496
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 484
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 104
+CNSTI4 492
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 488
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $438
+endproc CG_CopyPmoveState 112 0
+proc CG_PredictedStateMatches 152 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+NEI4 $469
+ADDRLP4 24
+CNSTI4 108
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $469
+ADDRLP4 28
+CNSTI4 116
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $469
+ADDRLP4 32
+CNSTI4 120
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $469
+ADDRLP4 36
+CNSTI4 112
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $469
+ADDRLP4 40
+CNSTI4 136
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $469
+ADDRLP4 44
+CNSTI4 140
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $469
+ADDRLP4 48
+CNSTI4 144
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $469
+ADDRLP4 52
+CNSTI4 184
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $469
+ADDRLP4 56
+CNSTI4 204
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $469
+ADDRLP4 60
+CNSTI4 188
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $469
+ADDRLP4 64
+CNSTI4 192
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $469
+ADDRLP4 68
+CNSTI4 196
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $469
+ADDRLP4 72
+CNSTI4 200
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $469
+ADDRLP4 76
+CNSTI4 220
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $469
+ADDRLP4 80
+CNSTI4 224
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $469
+ADDRLP4 84
+CNSTI4 228
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $469
+ADDRLP4 88
+CNSTI4 232
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $469
+ADDRLP4 92
+CNSTI4 260
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $469
+ADDRLP4 96
+CNSTI4 264
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $469
+ADDRLP4 100
+CNSTI4 36
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $448
+LABELV $469
+CNSTI4 0
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $448
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $470
+ADDRLP4 104
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 112
+CNSTI4 148
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+NEI4 $477
+ADDRLP4 120
+CNSTI4 160
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+NEF4 $477
+ADDRLP4 124
+CNSTI4 172
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+ADDP4
+INDIRF4
+EQF4 $474
+LABELV $477
+CNSTI4 0
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $474
+LABELV $471
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $470
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $478
+ADDRLP4 104
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 112
+CNSTI4 236
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+NEI4 $484
+ADDRLP4 120
+CNSTI4 244
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $482
+LABELV $484
+CNSTI4 0
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $482
+LABELV $479
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $478
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $485
+ADDRLP4 104
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 284
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $489
+CNSTI4 0
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $489
+LABELV $486
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $485
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $491
+ADDRLP4 104
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 348
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $495
+CNSTI4 0
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $495
+LABELV $492
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $491
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $497
+ADDRLP4 104
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 412
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+EQI4 $501
+CNSTI4 0
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $501
+LABELV $498
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $497
+ADDRLP4 108
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 116
+CNSTI4 8
+ASGNI4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+CNSTI4 12
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 124
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 1008981770
+LEF4 $505
+CNSTI4 0
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $505
+ADDRLP4 132
+CNSTI4 124
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 132
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+CNSTI4 128
+ASGNI4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+CNSTI4 132
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 144
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 148
+INDIRF4
+CNSTF4 1008981770
+LEF4 $509
+CNSTI4 0
+RETI4
+ADDRGP4 $447
+JUMPV
+LABELV $509
+CNSTI4 1
+RETI4
+LABELV $447
+endproc CG_PredictedStateMatches 152 4
+export CG_PredictPlayerState
+proc CG_PredictPlayerState 684 28
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 1360
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $513
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 1360
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+531844
+INDIRP4
+INDIRB
+ASGNB 500
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 34384
+ADDP4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 34380
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 34388
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 34392
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $513
+ADDRLP4 592
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+20
+INDIRI4
+ADDRLP4 592
+INDIRI4
+NEI4 $527
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 592
+INDIRI4
+EQI4 $523
+LABELV $527
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_InterpolatePlayerState
+CALLV
+pop
+ADDRGP4 $511
+JUMPV
+LABELV $523
+ADDRLP4 596
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 596
+INDIRI4
+NEI4 $532
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 596
+INDIRI4
+EQI4 $528
+LABELV $532
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_InterpolatePlayerState
+CALLV
+pop
+ADDRGP4 $511
+JUMPV
+LABELV $528
+ADDRGP4 cg_pmove
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $534
+ADDRGP4 cg_pmove+208
+ADDRGP4 CG_TraceCapsule
+ASGNP4
+ADDRGP4 $535
+JUMPV
+LABELV $534
+ADDRGP4 cg_pmove+208
+ADDRGP4 CG_Trace
+ASGNP4
+LABELV $535
+ADDRGP4 cg_pmove+212
+ADDRGP4 CG_PointContents
+ASGNP4
+ADDRGP4 cg_pmove
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $540
+ADDRGP4 cg_pmove+32
+CNSTI4 65537
+ASGNI4
+ADDRGP4 $541
+JUMPV
+LABELV $540
+ADDRGP4 cg_pmove+32
+CNSTI4 33619969
+ASGNI4
+LABELV $541
+ADDRGP4 cg+531844
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $544
+ADDRLP4 600
+ADDRGP4 cg_pmove+32
+ASGNP4
+ADDRLP4 600
+INDIRP4
+ADDRLP4 600
+INDIRP4
+INDIRI4
+CNSTI4 -33554433
+BANDI4
+ASGNI4
+LABELV $544
+ADDRGP4 cgs+56100
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+LEI4 $551
+ADDRLP4 600
+CNSTI4 1
+ASGNI4
+ADDRGP4 $552
+JUMPV
+LABELV $551
+ADDRLP4 600
+CNSTI4 0
+ASGNI4
+LABELV $552
+ADDRGP4 cg_pmove+40
+ADDRLP4 600
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRB
+ASGNB 500
+ADDRLP4 604
+ADDRGP4 trap_GetCurrentCmdNumber
+CALLI4
+ASGNI4
+ADDRLP4 516
+ADDRLP4 604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 516
+INDIRI4
+CNSTI4 64
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 564
+ARGP4
+ADDRGP4 cg+531848
+INDIRI4
+ARGI4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRLP4 608
+ADDRLP4 564
+INDIRI4
+ASGNI4
+ADDRLP4 608
+INDIRI4
+ADDRGP4 cg+531844
+INDIRP4
+INDIRI4
+LEI4 $555
+ADDRLP4 608
+INDIRI4
+ADDRGP4 cg+512320
+INDIRI4
+GEI4 $555
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $511
+ADDRGP4 $562
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $511
+JUMPV
+LABELV $555
+ADDRLP4 516
+INDIRI4
+ARGI4
+ADDRLP4 524
+ARGP4
+ADDRGP4 cg+531848
+INDIRI4
+ARGI4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRGP4 cg+52
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $564
+ADDRLP4 612
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+512304
+INDIRI4
+ADDRLP4 612
+INDIRI4
+NEI4 $564
+ADDRGP4 cg+512300
+INDIRI4
+ADDRLP4 612
+INDIRI4
+NEI4 $564
+ADDRGP4 cg+531848
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+52
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $564
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 500
+ADDRGP4 cg+531848
+INDIRI4
+MULI4
+ADDRGP4 cg+52
+INDIRP4
+CNSTI4 254120
+ADDP4
+ADDP4
+INDIRB
+ASGNB 500
+ADDRGP4 cg+512328
+ADDRGP4 cg+52
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $565
+JUMPV
+LABELV $564
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+531844
+INDIRP4
+INDIRB
+ASGNB 500
+ADDRGP4 cg+512328
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $565
+ADDRGP4 pmove_msec+12
+INDIRI4
+CNSTI4 8
+GEI4 $580
+ADDRGP4 $583
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 pmove_msec
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 $581
+JUMPV
+LABELV $580
+ADDRGP4 pmove_msec+12
+INDIRI4
+CNSTI4 33
+LEI4 $584
+ADDRGP4 $583
+ARGP4
+CNSTF4 1107558400
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 pmove_msec
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $584
+LABELV $581
+ADDRGP4 cg_pmove+200
+ADDRGP4 pmove_fixed+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_pmove+204
+ADDRGP4 pmove_msec+12
+INDIRI4
+ASGNI4
+ADDRGP4 cg_pmove+196
+ADDRGP4 pmove_overbounce+12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg+531840
+INDIRP4
+ASGNP4
+ADDRLP4 512
+ADDRLP4 516
+INDIRI4
+CNSTI4 64
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg_optimizePrediction+12
+INDIRI4
+CNSTI4 0
+EQI4 $594
+ADDRLP4 616
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+512304
+INDIRI4
+ADDRLP4 616
+INDIRI4
+NEI4 $601
+ADDRGP4 cg+512300
+INDIRI4
+ADDRLP4 616
+INDIRI4
+EQI4 $597
+LABELV $601
+ADDRLP4 8
+INDIRP4
+CNSTI4 34388
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 34384
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 34380
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $598
+JUMPV
+LABELV $597
+ADDRGP4 cg+512328
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 34392
+ADDP4
+INDIRI4
+NEI4 $602
+ADDRLP4 512
+ADDRLP4 8
+INDIRP4
+CNSTI4 34388
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $603
+JUMPV
+LABELV $602
+ADDRLP4 560
+ADDRLP4 8
+INDIRP4
+CNSTI4 34380
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $608
+JUMPV
+LABELV $605
+CNSTI4 500
+ADDRLP4 560
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1380
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $609
+ADDRGP4 $607
+JUMPV
+LABELV $609
+LABELV $606
+ADDRLP4 560
+ADDRLP4 560
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 66
+MODI4
+ASGNI4
+LABELV $608
+ADDRLP4 560
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 34384
+ADDP4
+INDIRI4
+NEI4 $605
+LABELV $607
+ADDRLP4 560
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 34384
+ADDP4
+INDIRI4
+EQI4 $611
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+CNSTI4 500
+ADDRLP4 560
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1380
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 628
+ADDRGP4 CG_PredictedStateMatches
+CALLI4
+ASGNI4
+ADDRLP4 628
+INDIRI4
+CNSTI4 0
+EQI4 $611
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+CNSTI4 500
+ADDRLP4 560
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1380
+ADDP4
+ADDP4
+ARGP4
+ADDRGP4 CG_CopyPmoveState
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 34380
+ADDP4
+ADDRLP4 560
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 66
+MODI4
+ASGNI4
+ADDRLP4 512
+ADDRLP4 8
+INDIRP4
+CNSTI4 34388
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $612
+JUMPV
+LABELV $611
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $613
+ADDRLP4 560
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 34384
+ADDP4
+INDIRI4
+EQI4 $613
+ADDRGP4 $616
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $613
+ADDRLP4 8
+INDIRP4
+CNSTI4 34388
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 34384
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 34380
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $612
+LABELV $603
+LABELV $598
+ADDRLP4 8
+INDIRP4
+CNSTI4 34392
+ADDP4
+ADDRGP4 cg+512328
+INDIRI4
+ASGNI4
+ADDRGP4 $595
+JUMPV
+LABELV $594
+ADDRLP4 8
+INDIRP4
+CNSTI4 34388
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 34384
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 34380
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 34392
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $595
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 34380
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 616
+CNSTI4 0
+ASGNI4
+ADDRLP4 552
+ADDRLP4 616
+INDIRI4
+ASGNI4
+ADDRLP4 556
+ADDRLP4 616
+INDIRI4
+ASGNI4
+ADDRLP4 520
+ADDRLP4 616
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 516
+INDIRI4
+CNSTI4 64
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $621
+JUMPV
+LABELV $618
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cg_pmove+4
+ARGP4
+ADDRGP4 cg+531848
+INDIRI4
+ARGI4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRGP4 cg_pmove+200
+INDIRI4
+CNSTI4 0
+EQI4 $624
+ADDRGP4 cg_pmove
+INDIRP4
+ARGP4
+ADDRGP4 cg_pmove+4
+ARGP4
+ADDRGP4 PM_UpdateViewAngles
+CALLV
+pop
+LABELV $624
+ADDRGP4 cg_pmove+4
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+GTI4 $628
+ADDRGP4 $619
+JUMPV
+LABELV $628
+ADDRGP4 cg_pmove+4
+INDIRI4
+ADDRLP4 524
+INDIRI4
+LEI4 $632
+ADDRGP4 $619
+JUMPV
+LABELV $632
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $635
+ADDRGP4 cg+512300
+INDIRI4
+CNSTI4 0
+EQI4 $638
+ADDRLP4 636
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 1376
+ADDP4
+ADDRLP4 636
+INDIRF4
+ASGNF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 1372
+ADDP4
+ADDRLP4 636
+INDIRF4
+ASGNF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 1368
+ADDP4
+ADDRLP4 636
+INDIRF4
+ASGNF4
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $644
+ADDRGP4 $647
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $644
+ADDRGP4 cg+512300
+CNSTI4 0
+ASGNI4
+ADDRGP4 $639
+JUMPV
+LABELV $638
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+512328
+INDIRI4
+ARGI4
+ADDRGP4 cg+512324
+INDIRI4
+ARGI4
+ADDRLP4 636
+ARGP4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 648
+ARGP4
+ADDRGP4 CG_AdjustPositionForMover
+CALLV
+pop
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $654
+ADDRLP4 12+4
+ARGP4
+ADDRLP4 636
+ARGP4
+ADDRLP4 660
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 660
+INDIRI4
+CNSTI4 0
+NEI4 $657
+ADDRGP4 $660
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $657
+LABELV $654
+ADDRLP4 620
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 636
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 620+4
+ADDRLP4 12+4+4
+INDIRF4
+ADDRLP4 636+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 620+8
+ADDRLP4 12+4+8
+INDIRF4
+ADDRLP4 636+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 620
+ARGP4
+ADDRLP4 660
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 632
+ADDRLP4 660
+INDIRF4
+ASGNF4
+ADDRLP4 632
+INDIRF4
+CNSTF4 1036831949
+LEF4 $670
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $672
+ADDRGP4 $675
+ARGP4
+ADDRLP4 632
+INDIRF4
+ARGF4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $672
+ADDRGP4 cg_errorDecay+12
+INDIRI4
+CNSTI4 0
+EQI4 $676
+ADDRLP4 668
+ADDRGP4 cg+512320
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 1364
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 664
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+ADDRLP4 668
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 664
+INDIRF4
+CNSTF4 0
+GEF4 $683
+ADDRLP4 664
+CNSTF4 0
+ASGNF4
+LABELV $683
+ADDRLP4 664
+INDIRF4
+CNSTF4 0
+LEF4 $685
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $685
+ADDRGP4 $688
+ARGP4
+ADDRLP4 664
+INDIRF4
+ARGF4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $685
+ADDRLP4 672
+CNSTI4 1368
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 672
+INDIRI4
+ADDP4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 672
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 664
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 676
+CNSTI4 1372
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 676
+INDIRI4
+ADDP4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 676
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 664
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 680
+CNSTI4 1376
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 680
+INDIRI4
+ADDP4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 680
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 664
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $677
+JUMPV
+LABELV $676
+ADDRLP4 664
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 1376
+ADDP4
+ADDRLP4 664
+INDIRF4
+ASGNF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 1372
+ADDP4
+ADDRLP4 664
+INDIRF4
+ASGNF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 1368
+ADDP4
+ADDRLP4 664
+INDIRF4
+ASGNF4
+LABELV $677
+ADDRLP4 664
+CNSTI4 1368
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 664
+INDIRI4
+ADDP4
+ADDRLP4 620
+INDIRF4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 664
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 668
+CNSTI4 1372
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 668
+INDIRI4
+ADDP4
+ADDRLP4 620+4
+INDIRF4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 668
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 672
+CNSTI4 1376
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 672
+INDIRI4
+ADDP4
+ADDRLP4 620+8
+INDIRF4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 672
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 1364
+ADDP4
+ADDRGP4 cg+512324
+INDIRI4
+ASGNI4
+LABELV $670
+LABELV $639
+LABELV $635
+ADDRGP4 cg_pmove+44
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_pmove+200
+INDIRI4
+CNSTI4 0
+EQI4 $709
+ADDRGP4 cg_pmove+4
+ADDRGP4 cg_pmove+4
+INDIRI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+DIVI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+MULI4
+ASGNI4
+LABELV $709
+ADDRLP4 0
+INDIRI4
+ADDRLP4 512
+INDIRI4
+GEI4 $717
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 34384
+ADDP4
+INDIRI4
+EQI4 $717
+CNSTI4 500
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1380
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 cg_pmove+4
+INDIRI4
+NEI4 $717
+ADDRGP4 cg_pmove
+INDIRP4
+ARGP4
+CNSTI4 500
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1380
+ADDP4
+ADDP4
+ARGP4
+ADDRGP4 CG_CopyPmoveState
+CALLV
+pop
+ADDRLP4 628
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 628
+INDIRI4
+ADDI4
+CNSTI4 66
+MODI4
+ASGNI4
+ADDRLP4 556
+ADDRLP4 556
+INDIRI4
+ADDRLP4 628
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $718
+JUMPV
+LABELV $717
+ADDRLP4 0
+INDIRI4
+ADDRLP4 512
+INDIRI4
+GEI4 $720
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $722
+ADDRGP4 $725
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $722
+ADDRLP4 512
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $720
+ADDRGP4 cg_pmove
+ARGP4
+ADDRGP4 Pmove
+CALLV
+pop
+ADDRLP4 552
+ADDRLP4 552
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 34388
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg_optimizePrediction+12
+INDIRI4
+CNSTI4 0
+EQI4 $726
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 66
+MODI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 34380
+ADDP4
+INDIRI4
+EQI4 $726
+CNSTI4 500
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1380
+ADDP4
+ADDP4
+ADDRGP4 cg_pmove
+INDIRP4
+INDIRB
+ASGNB 500
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 66
+MODI4
+ASGNI4
+LABELV $726
+ADDRLP4 8
+INDIRP4
+CNSTI4 34384
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $718
+ADDRLP4 520
+CNSTI4 1
+ASGNI4
+ADDRGP4 CG_TouchTriggerPrediction
+CALLV
+pop
+LABELV $619
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $621
+ADDRLP4 0
+INDIRI4
+ADDRLP4 516
+INDIRI4
+LEI4 $618
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 1
+LEI4 $729
+ADDRGP4 $732
+ARGP4
+ADDRGP4 cg_pmove+4
+INDIRI4
+ARGI4
+ADDRGP4 cg+512320
+INDIRI4
+ARGI4
+ADDRLP4 552
+INDIRI4
+ARGI4
+ADDRLP4 556
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $729
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $735
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $511
+ADDRGP4 $740
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $511
+JUMPV
+LABELV $735
+ADDRLP4 620
+CNSTI4 12
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 620
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+512328
+INDIRI4
+ARGI4
+ADDRGP4 cg+512320
+INDIRI4
+ARGI4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 620
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 624
+CNSTI4 32
+ASGNI4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 624
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 cg+531840
+INDIRP4
+ADDRLP4 624
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 CG_AdjustPositionForMover
+CALLV
+pop
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $748
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+ADDRLP4 12+232
+INDIRI4
+CNSTI4 2
+ADDI4
+LEI4 $751
+ADDRGP4 $755
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $751
+LABELV $748
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_TransitionPlayerState
+CALLV
+pop
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $757
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 34396
+ADDP4
+INDIRI4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+LEI4 $760
+ADDRGP4 $764
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 34396
+ADDP4
+ADDRGP4 cg+531840
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $760
+LABELV $757
+LABELV $511
+endproc CG_PredictPlayerState 684 28
+bss
+align 4
+LABELV cg_traceClips
+skip 4
+align 4
+LABELV cg_traceCandidates
+skip 4
+align 4
+LABELV cg_traceCount
+skip 4
+align 4
+LABELV cg_traceNum
+skip 4
+align 4
+LABELV cg_solidGridLinkSolid
+skip 16384
+align 4
+LABELV cg_solidGridLinkNext
+skip 16384
+align 4
+LABELV cg_numSolidGridLinks
+skip 4
+align 4
+LABELV cg_solidGridHeads
+skip 4096
+align 4
+LABELV cg_looseSolids
+skip 4112
+align 4
+LABELV cg_numLooseSolids
+skip 4
+align 4
+LABELV cg_solidTraceNum
+skip 4112
+align 4
+LABELV cg_solidFixed
+skip 4112
+align 4
+LABELV cg_solidAbsMaxs
+skip 12336
+align 4
+LABELV cg_solidAbsMins
+skip 12336
+align 4
+LABELV cg_triggerEntities
+skip 4096
+align 4
+LABELV cg_numTriggerEntities
+skip 4
+align 4
+LABELV cg_solidEntities
+skip 4112
+align 4
+LABELV cg_numSolidEntities
+skip 4
+align 4
+LABELV cg_pmove
+skip 216
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_LoadVoiceChats
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_enableBreath
+import cg_enableDust
+import cg_blueTeamName
+import cg_redTeamName
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $764
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $755
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $740
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $732
+byte 1 91
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 93
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 0
+align 1
+LABELV $725
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $688
+byte 1 68
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $675
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $660
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $647
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 84
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $616
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 10
+byte 1 0
+align 1
+LABELV $583
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $562
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $169
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 41
+byte 1 10
+byte 1 0
@@ -0,0 +1,4765 @@
+export CG_AddCustomSurface
+code
+proc CG_AddCustomSurface 8 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $97
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+GTI4 $97
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $104-24
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $104
+address $103
+address $101
+address $100
+address $102
+code
+LABELV $100
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_SurfaceRailRings
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $101
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_SurfaceRailCore
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $102
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_SurfaceLightningBolt
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $103
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_SurfaceBeam
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $97
+CNSTI4 0
+RETI4
+LABELV $96
+endproc CG_AddCustomSurface 8 4
+export CG_SurfaceSprite
+proc CG_SurfaceSprite 372 16
+ADDRLP4 100
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 228
+ADDRLP4 100
+CNSTI4 2
+ASGNI4
+ADDRLP4 100+4
+ADDRLP4 100+4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRLP4 100+156
+INDIRF4
+CNSTF4 0
+NEF4 $108
+ADDRLP4 328
+CNSTF4 0
+ASGNF4
+ADDRLP4 328+4
+ADDRLP4 100+152
+INDIRF4
+ASGNF4
+ADDRLP4 328+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 352
+CNSTF4 0
+ASGNF4
+ADDRLP4 340
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRLP4 340+4
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRLP4 340+8
+ADDRLP4 100+152
+INDIRF4
+ASGNF4
+ADDRGP4 $109
+JUMPV
+LABELV $108
+ADDRLP4 360
+CNSTF4 1078530011
+ADDRLP4 100+156
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ASGNF4
+ADDRLP4 360
+INDIRF4
+ARGF4
+ADDRLP4 364
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 352
+ADDRLP4 364
+INDIRF4
+ASGNF4
+ADDRLP4 360
+INDIRF4
+ARGF4
+ADDRLP4 368
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 356
+ADDRLP4 368
+INDIRF4
+ASGNF4
+ADDRLP4 328
+CNSTF4 0
+ASGNF4
+ADDRLP4 328+4
+ADDRLP4 356
+INDIRF4
+ADDRLP4 100+152
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 328+8
+ADDRLP4 352
+INDIRF4
+NEGF4
+ADDRLP4 100+152
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 340
+CNSTF4 0
+ASGNF4
+ADDRLP4 340+4
+ADDRLP4 352
+INDIRF4
+ADDRLP4 100+152
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 340+8
+ADDRLP4 356
+INDIRF4
+ADDRLP4 100+152
+INDIRF4
+MULF4
+ASGNF4
+LABELV $109
+ADDRLP4 4
+ADDRGP4 vec3_origin
+INDIRF4
+ADDRLP4 328
+INDIRF4
+ADDF4
+ADDRLP4 340
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRGP4 vec3_origin+4
+INDIRF4
+ADDRLP4 328+4
+INDIRF4
+ADDF4
+ADDRLP4 340+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRGP4 vec3_origin+8
+INDIRF4
+ADDRLP4 328+8
+INDIRF4
+ADDF4
+ADDRLP4 340+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+24
+ADDRGP4 vec3_origin
+INDIRF4
+ADDRLP4 328
+INDIRF4
+SUBF4
+ADDRLP4 340
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+24+4
+ADDRGP4 vec3_origin+4
+INDIRF4
+ADDRLP4 328+4
+INDIRF4
+SUBF4
+ADDRLP4 340+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+24+8
+ADDRGP4 vec3_origin+8
+INDIRF4
+ADDRLP4 328+8
+INDIRF4
+SUBF4
+ADDRLP4 340+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+48
+ADDRGP4 vec3_origin
+INDIRF4
+ADDRLP4 328
+INDIRF4
+SUBF4
+ADDRLP4 340
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+48+4
+ADDRGP4 vec3_origin+4
+INDIRF4
+ADDRLP4 328+4
+INDIRF4
+SUBF4
+ADDRLP4 340+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+48+8
+ADDRGP4 vec3_origin+8
+INDIRF4
+ADDRLP4 328+8
+INDIRF4
+SUBF4
+ADDRLP4 340+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+72
+ADDRGP4 vec3_origin
+INDIRF4
+ADDRLP4 328
+INDIRF4
+ADDF4
+ADDRLP4 340
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+72+4
+ADDRGP4 vec3_origin+4
+INDIRF4
+ADDRLP4 328+4
+INDIRF4
+ADDF4
+ADDRLP4 340+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+72+8
+ADDRGP4 vec3_origin+8
+INDIRF4
+ADDRLP4 328+8
+INDIRF4
+ADDF4
+ADDRLP4 340+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $167
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $175
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $173
+LABELV $175
+ADDRLP4 352
+CNSTI4 1
+ASGNI4
+ADDRGP4 $174
+JUMPV
+LABELV $173
+ADDRLP4 352
+CNSTI4 0
+ASGNI4
+LABELV $174
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+12
+ADDP4
+ADDRLP4 352
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+GEI4 $179
+ADDRLP4 360
+CNSTI4 1
+ASGNI4
+ADDRGP4 $180
+JUMPV
+LABELV $179
+ADDRLP4 360
+CNSTI4 0
+ASGNI4
+LABELV $180
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+12+4
+ADDP4
+ADDRLP4 360
+INDIRI4
+CVIF4 4
+ASGNF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20
+ADDP4
+ADDRLP4 100+124
+INDIRU4
+ASGNU4
+LABELV $168
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $167
+ADDRLP4 100
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_R_AddPolyRefEntityToScene
+CALLV
+pop
+LABELV $106
+endproc CG_SurfaceSprite 372 16
+proc CG_DoRailDiscs 232 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 172
+ADDRGP4 cg_railWidth+12
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+LEI4 $185
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $185
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $187
+ADDRGP4 $183
+JUMPV
+LABELV $187
+ADDRLP4 176
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+LABELV $189
+CNSTF4 1078530011
+CNSTI4 90
+ADDRLP4 148
+INDIRI4
+MULI4
+CNSTI4 45
+ADDI4
+CVIF4 4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 180
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 180
+INDIRF4
+ASGNF4
+CNSTF4 1078530011
+CNSTI4 90
+ADDRLP4 148
+INDIRI4
+MULI4
+CNSTI4 45
+ADDI4
+CVIF4 4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 184
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 168
+ADDRLP4 184
+INDIRF4
+ASGNF4
+ADDRLP4 208
+ADDRLP4 172
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 152
+ADDRFP4 20
+INDIRP4
+INDIRF4
+ADDRLP4 164
+INDIRF4
+MULF4
+ADDRFP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 168
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 208
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 212
+CNSTI4 4
+ASGNI4
+ADDRLP4 152+4
+ADDRFP4 20
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 164
+INDIRF4
+MULF4
+ADDRFP4 24
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 168
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 208
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 216
+CNSTI4 8
+ASGNI4
+ADDRLP4 152+8
+ADDRFP4 20
+INDIRP4
+ADDRLP4 216
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 164
+INDIRF4
+MULF4
+ADDRFP4 24
+INDIRP4
+ADDRLP4 216
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 168
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ADDRLP4 172
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+CNSTI4 12
+ADDRLP4 148
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 152
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 12
+ADDRLP4 148
+INDIRI4
+MULI4
+ADDRLP4 4+4
+ADDP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+ADDF4
+ASGNF4
+CNSTI4 12
+ADDRLP4 148
+INDIRI4
+MULI4
+ADDRLP4 4+8
+ADDP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 152+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+LEI4 $199
+ADDRLP4 220
+CNSTI4 12
+ADDRLP4 148
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ASGNP4
+ADDRLP4 220
+INDIRP4
+ADDRLP4 220
+INDIRP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 224
+CNSTI4 12
+ADDRLP4 148
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 224
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 228
+CNSTI4 12
+ADDRLP4 148
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+ADDRLP4 228
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $199
+LABELV $190
+ADDRLP4 148
+ADDRLP4 148
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 4
+LTI4 $189
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRGP4 $208
+JUMPV
+LABELV $205
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $209
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 52
+ADDP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $215
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+EQI4 $215
+ADDRLP4 184
+CNSTI4 1
+ASGNI4
+ADDRGP4 $216
+JUMPV
+LABELV $215
+ADDRLP4 184
+CNSTI4 0
+ASGNI4
+LABELV $216
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 52+12
+ADDP4
+ADDRLP4 184
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+GEI4 $220
+ADDRLP4 192
+CNSTI4 1
+ASGNI4
+ADDRGP4 $221
+JUMPV
+LABELV $220
+ADDRLP4 192
+CNSTI4 0
+ASGNI4
+LABELV $221
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 52+12+4
+ADDP4
+ADDRLP4 192
+INDIRI4
+CVIF4 4
+ASGNF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 52+20
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRU1
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 52+20+1
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 52+20+2
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 52+20+3
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 200
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+ADDP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ADDRLP4 200
+INDIRP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 204
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 204
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 208
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+ADDRLP4 208
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $210
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $209
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 52
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_AddPolysToScene
+CALLV
+pop
+LABELV $206
+ADDRLP4 148
+ADDRLP4 148
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $208
+ADDRLP4 148
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $205
+LABELV $183
+endproc CG_DoRailDiscs 232 24
+export CG_SurfaceRailRings
+proc CG_SurfaceRailRings 300 28
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 228
+ADDRLP4 240
+ADDRLP4 12+88
+INDIRB
+ASGNB 12
+ADDRLP4 252
+ADDRLP4 12+68
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 252
+INDIRF4
+ADDRLP4 240
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 252+4
+INDIRF4
+ADDRLP4 240+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 252+8
+INDIRF4
+ADDRLP4 240+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 268
+ADDRLP4 296
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 272
+ARGP4
+ADDRLP4 284
+ARGP4
+ADDRGP4 MakeNormalVectors
+CALLV
+pop
+ADDRLP4 264
+ADDRLP4 268
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_railSegmentLength+8
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+GTI4 $243
+ADDRLP4 264
+CNSTI4 1
+ASGNI4
+LABELV $243
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg_railSegmentLength+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 cg_railSegmentLength+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 cg_railSegmentLength+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+120
+INDIRI4
+ARGI4
+ADDRLP4 12+124
+ARGP4
+ADDRLP4 264
+INDIRI4
+ARGI4
+ADDRLP4 240
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 272
+ARGP4
+ADDRLP4 284
+ARGP4
+ADDRGP4 CG_DoRailDiscs
+CALLV
+pop
+LABELV $233
+endproc CG_SurfaceRailRings 300 28
+proc CG_DoRailCore 84 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 20
+INDIRF4
+CNSTF4 1132462080
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 24
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRFP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+CNSTF4 0
+ASGNF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+CNSTF4 1048576000
+ADDRFP4 4
+INDIRP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32
+INDIRF4
+LTF4 $256
+ADDRLP4 24
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $257
+JUMPV
+LABELV $256
+ADDRLP4 24
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $257
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+ADDRLP4 24
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 40
+CNSTF4 1048576000
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 44
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+LTF4 $259
+ADDRLP4 36
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $260
+JUMPV
+LABELV $259
+ADDRLP4 36
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $260
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRLP4 36
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 52
+CNSTF4 1048576000
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+CVUI4 1
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56
+INDIRF4
+LTF4 $262
+ADDRLP4 48
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $263
+JUMPV
+LABELV $262
+ADDRLP4 48
+ADDRLP4 52
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $263
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRLP4 48
+INDIRU4
+CVUU1 4
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 23
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+CNSTI4 4
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 8
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+CNSTF4 0
+ASGNF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRU1
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 23
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 4
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+CNSTI4 8
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRU1
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 23
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRFP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+CNSTI4 4
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+CNSTI4 8
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+CNSTF4 0
+ASGNF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRU1
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 23
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $254
+endproc CG_DoRailCore 84 0
+lit
+align 4
+LABELV $265
+byte 4 1065353216
+byte 4 0
+byte 4 0
+align 4
+LABELV $266
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export CG_SurfaceRailCore
+code
+proc CG_SurfaceRailCore 400 28
+ADDRLP4 28
+ADDRGP4 $265
+INDIRB
+ASGNB 12
+ADDRLP4 280
+ADDRGP4 $266
+INDIRB
+ASGNB 12
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 228
+ADDRLP4 40
+CNSTI4 2
+ASGNI4
+ADDRLP4 40+4
+ADDRLP4 40+4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 40+88
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRLP4 40+68
+INDIRB
+ASGNB 12
+ADDRLP4 268
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268
+ARGP4
+ADDRLP4 388
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 388
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 392
+ADDRLP4 12
+INDIRI4
+NEGI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 vec3_origin
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 392
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRGP4 vec3_origin+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+ADDRLP4 392
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 vec3_origin+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 12
+INDIRI4
+NEGI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 396
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 396
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+ADDRLP4 396
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRLP4 40+124
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 280
+ARGP4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cg_railCoreWidth+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 CG_DoRailCore
+CALLV
+pop
+ADDRLP4 40
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_R_AddPolyRefEntityToScene
+CALLV
+pop
+LABELV $264
+endproc CG_SurfaceRailCore 400 28
+lit
+align 4
+LABELV $291
+byte 4 1065353216
+byte 4 0
+byte 4 0
+align 4
+LABELV $292
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export CG_SurfaceLightningBolt
+code
+proc CG_SurfaceLightningBolt 704 28
+ADDRLP4 668
+ADDRGP4 $291
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRGP4 $292
+INDIRB
+ASGNB 12
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 228
+ADDRLP4 44
+CNSTI4 2
+ASGNI4
+ADDRLP4 44+4
+ADDRLP4 44+4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 44+88
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRLP4 44+68
+INDIRB
+ASGNB 12
+ADDRLP4 272
+ADDRLP4 32
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 272+4
+ADDRLP4 32+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 272+8
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 272
+ARGP4
+ADDRLP4 680
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 680
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 684
+ADDRLP4 28
+INDIRI4
+NEGI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 vec3_origin
+INDIRF4
+ADDRLP4 668
+INDIRF4
+ADDRLP4 684
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRGP4 vec3_origin+4
+INDIRF4
+ADDRLP4 668+4
+INDIRF4
+ADDRLP4 684
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRGP4 vec3_origin+8
+INDIRF4
+ADDRLP4 668+8
+INDIRF4
+ADDRLP4 28
+INDIRI4
+NEGI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 688
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 16
+INDIRF4
+ADDRLP4 668
+INDIRF4
+ADDRLP4 688
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 668+4
+INDIRF4
+ADDRLP4 688
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 668+8
+INDIRF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $314
+CNSTI4 24
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+MULI4
+ADDRLP4 284
+ADDP4
+ARGP4
+ADDRLP4 44+124
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 CG_DoRailCore
+CALLV
+pop
+ADDRLP4 692
+ARGP4
+ADDRLP4 272
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 1110704128
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 692
+INDIRB
+ASGNB 12
+LABELV $315
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LTI4 $314
+ADDRLP4 44
+ARGP4
+ADDRLP4 692
+CNSTI4 4
+ASGNI4
+ADDRLP4 692
+INDIRI4
+ARGI4
+ADDRLP4 284
+ARGP4
+ADDRLP4 692
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_AddPolyRefEntityToScene
+CALLV
+pop
+LABELV $290
+endproc CG_SurfaceLightningBolt 704 28
+export CG_SurfaceBeam
+proc CG_SurfaceBeam 1068 24
+ADDRLP4 780
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 228
+ADDRLP4 1008
+ADDRLP4 780+88
+INDIRF4
+ASGNF4
+ADDRLP4 1008+4
+ADDRLP4 780+88+4
+INDIRF4
+ASGNF4
+ADDRLP4 1008+8
+ADDRLP4 780+88+8
+INDIRF4
+ASGNF4
+ADDRLP4 732
+ADDRLP4 780+68
+INDIRF4
+ASGNF4
+ADDRLP4 732+4
+ADDRLP4 780+68+4
+INDIRF4
+ASGNF4
+ADDRLP4 732+8
+ADDRLP4 780+68+8
+INDIRF4
+ASGNF4
+ADDRLP4 1020
+ADDRLP4 1008
+INDIRF4
+ADDRLP4 732
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 744
+ADDRLP4 1020
+INDIRF4
+ASGNF4
+ADDRLP4 768
+ADDRLP4 1020
+INDIRF4
+ASGNF4
+ADDRLP4 1024
+ADDRLP4 1008+4
+INDIRF4
+ADDRLP4 732+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 744+4
+ADDRLP4 1024
+INDIRF4
+ASGNF4
+ADDRLP4 768+4
+ADDRLP4 1024
+INDIRF4
+ASGNF4
+ADDRLP4 1028
+ADDRLP4 1008+8
+INDIRF4
+ADDRLP4 732+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 744+8
+ADDRLP4 1028
+INDIRF4
+ASGNF4
+ADDRLP4 768+8
+ADDRLP4 1028
+INDIRF4
+ASGNF4
+ADDRLP4 768
+ARGP4
+ADDRLP4 1032
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 1032
+INDIRF4
+CNSTF4 0
+NEF4 $342
+ADDRGP4 $319
+JUMPV
+LABELV $342
+ADDRLP4 756
+ARGP4
+ADDRLP4 768
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 1036
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 756
+ADDRLP4 1036
+INDIRF4
+ADDRLP4 756
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 756+4
+ADDRLP4 1036
+INDIRF4
+ADDRLP4 756+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 756+8
+CNSTF4 1082130432
+ADDRLP4 756+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 584
+CNSTI4 0
+ASGNI4
+LABELV $348
+CNSTI4 12
+ADDRLP4 584
+INDIRI4
+MULI4
+ADDRLP4 588
+ADDP4
+ARGP4
+ADDRLP4 768
+ARGP4
+ADDRLP4 756
+ARGP4
+CNSTF4 1114636288
+ADDRLP4 584
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+ADDRLP4 1044
+CNSTI4 12
+ADDRLP4 584
+INDIRI4
+MULI4
+ADDRLP4 588
+ADDP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ADDRLP4 1044
+INDIRP4
+INDIRF4
+ADDRLP4 732
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 1048
+CNSTI4 12
+ADDRLP4 584
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 588+4
+ADDP4
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 588+4
+ADDP4
+INDIRF4
+ADDRLP4 732+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 1052
+CNSTI4 12
+ADDRLP4 584
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+ADDRLP4 588+8
+ADDP4
+ADDRLP4 1052
+INDIRI4
+ADDRLP4 588+8
+ADDP4
+INDIRF4
+ADDRLP4 732+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 1056
+CNSTI4 12
+ADDRLP4 584
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 660
+ADDP4
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 588
+ADDP4
+INDIRF4
+ADDRLP4 744
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 1060
+CNSTI4 12
+ADDRLP4 584
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+ADDRLP4 660+4
+ADDP4
+ADDRLP4 1060
+INDIRI4
+ADDRLP4 588+4
+ADDP4
+INDIRF4
+ADDRLP4 744+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 1064
+CNSTI4 12
+ADDRLP4 584
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+ADDRLP4 660+8
+ADDP4
+ADDRLP4 1064
+INDIRI4
+ADDRLP4 588+8
+ADDP4
+INDIRF4
+ADDRLP4 744+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $349
+ADDRLP4 584
+ADDRLP4 584
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 584
+INDIRI4
+CNSTI4 6
+LTI4 $348
+ADDRLP4 780+120
+ADDRGP4 cgs+683776+123336
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+ADDRLP4 584
+ADDRLP4 1040
+INDIRI4
+ASGNI4
+LABELV $367
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $371
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $375
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+EQI4 $375
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LEI4 $378
+ADDRLP4 1048
+CNSTI4 1
+ASGNI4
+ADDRGP4 $379
+JUMPV
+LABELV $378
+ADDRLP4 1048
+CNSTI4 0
+ASGNI4
+LABELV $379
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+ADDP4
+CNSTI4 12
+ADDRLP4 584
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+ADDI4
+CNSTI4 6
+MODI4
+MULI4
+ADDRLP4 660
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $376
+JUMPV
+LABELV $375
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LEI4 $381
+ADDRLP4 1052
+CNSTI4 1
+ASGNI4
+ADDRGP4 $382
+JUMPV
+LABELV $381
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+LABELV $382
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+ADDP4
+CNSTI4 12
+ADDRLP4 584
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+ADDI4
+CNSTI4 6
+MODI4
+MULI4
+ADDRLP4 588
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $376
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+GEI4 $385
+ADDRLP4 1056
+CNSTI4 1
+ASGNI4
+ADDRGP4 $386
+JUMPV
+LABELV $385
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+LABELV $386
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8+12
+ADDP4
+ADDRLP4 1056
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $390
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+EQI4 $390
+ADDRLP4 1060
+CNSTI4 1
+ASGNI4
+ADDRGP4 $391
+JUMPV
+LABELV $390
+ADDRLP4 1060
+CNSTI4 0
+ASGNI4
+LABELV $391
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8+12+4
+ADDP4
+ADDRLP4 1060
+INDIRI4
+CVIF4 4
+ASGNF4
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8+20
+ADDP4
+CNSTU1 255
+ASGNU1
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8+20+1
+ADDP4
+CNSTU1 0
+ASGNU1
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8+20+2
+ADDP4
+CNSTU1 0
+ASGNU1
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8+20+3
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $372
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $371
+LABELV $368
+ADDRLP4 584
+ADDRLP4 584
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 584
+INDIRI4
+CNSTI4 6
+LTI4 $367
+ADDRLP4 780+120
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_AddPolysToScene
+CALLV
+pop
+LABELV $319
+endproc CG_SurfaceBeam 1068 24
+export CG_SurfaceText
+proc CG_SurfaceText 532 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $401
+ADDRGP4 $400
+JUMPV
+LABELV $401
+ADDRFP4 8
+CNSTF4 1048576000
+ADDRFP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 228
+ADDRLP4 176
+CNSTI4 2
+ASGNI4
+ADDRLP4 176+88
+ADDRLP4 176+68
+INDIRB
+ASGNB 12
+ADDRLP4 136
+ADDRGP4 vec3_origin
+INDIRB
+ASGNB 12
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 416
+ADDRGP4 Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 156
+CNSTF4 0
+ADDRLP4 416
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 168
+CNSTF4 0
+ASGNF4
+ADDRLP4 152
+ADDRFP4 8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20480
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 420
+CNSTF4 1132396544
+ASGNF4
+ADDRLP4 104
+ADDRLP4 176+124
+INDIRU1
+CVUI4 1
+CVIF4 4
+ADDRLP4 420
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 104+4
+ADDRLP4 176+124+1
+INDIRU1
+CVUI4 1
+CVIF4 4
+ADDRLP4 420
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 104+8
+ADDRLP4 176+124+2
+INDIRU1
+CVUI4 1
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+ADDRLP4 104+12
+ADDRLP4 176+124+3
+INDIRU1
+CVUI4 1
+CVIF4 4
+CNSTF4 1132396544
+DIVF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 104
+INDIRF4
+ADDRFP4 24
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 424
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 424
+INDIRF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 104+4
+INDIRF4
+ADDRFP4 24
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 428
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 428
+INDIRF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 104+8
+INDIRF4
+ADDRFP4 24
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 432
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 432
+INDIRF4
+ASGNF4
+ADDRLP4 120+12
+ADDRLP4 104+12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 436
+ADDRGP4 Q_UTF8_PrintStrlen
+CALLI4
+ASGNI4
+ADDRLP4 412
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRLP4 440
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 440
+INDIRI4
+CNSTI4 0
+LEI4 $421
+ADDRLP4 412
+INDIRI4
+ADDRLP4 440
+INDIRI4
+LEI4 $421
+ADDRLP4 412
+ADDRFP4 20
+INDIRI4
+ASGNI4
+LABELV $421
+ADDRLP4 148
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 408
+CNSTI4 0
+ASGNI4
+ADDRGP4 $424
+JUMPV
+LABELV $423
+ADDRLP4 444
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRLP4 444
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $426
+ADDRLP4 444
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $426
+ADDRLP4 448
+ADDRLP4 444
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 448
+INDIRI4
+CNSTI4 0
+EQI4 $426
+ADDRLP4 448
+INDIRI4
+CNSTI4 48
+LTI4 $426
+ADDRLP4 448
+INDIRI4
+CNSTI4 55
+GTI4 $426
+ADDRFP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $428
+ADDRLP4 104
+ADDRLP4 148
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+INDIRB
+ASGNB 12
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 104
+INDIRF4
+ADDRFP4 24
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 452
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 452
+INDIRF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 104+4
+INDIRF4
+ADDRFP4 24
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 456
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 456
+INDIRF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 104+8
+INDIRF4
+ADDRFP4 24
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 460
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 460
+INDIRF4
+ASGNF4
+LABELV $428
+ADDRLP4 148
+ADDRLP4 148
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $424
+JUMPV
+LABELV $426
+ADDRLP4 148
+ARGP4
+ADDRLP4 452
+ADDRGP4 Q_UTF8_CodePoint
+CALLU4
+ASGNU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 452
+INDIRU4
+ARGU4
+ADDRLP4 456
+ADDRGP4 Text_GetGlyph
+CALLP4
+ASGNP4
+ADDRLP4 100
+ADDRLP4 456
+INDIRP4
+ASGNP4
+ADDRLP4 160
+ADDRLP4 152
+INDIRF4
+ADDRLP4 100
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 152
+INDIRF4
+ADDRLP4 100
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 100
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 152
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 404
+ADDRLP4 100
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 152
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 136
+INDIRF4
+CNSTF4 0
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 136+4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 164
+INDIRF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 136+8
+INDIRF4
+ADDRLP4 168
+INDIRF4
+ADDF4
+ADDRLP4 160
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+24
+ADDRLP4 136
+INDIRF4
+CNSTF4 0
+ADDF4
+ASGNF4
+ADDRLP4 4+24+4
+ADDRLP4 136+4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 164
+INDIRF4
+ADDF4
+ADDRLP4 172
+INDIRF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRLP4 4+24+8
+ADDRLP4 136+8
+INDIRF4
+ADDRLP4 168
+INDIRF4
+ADDF4
+ADDRLP4 160
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+48
+ADDRLP4 136
+INDIRF4
+CNSTF4 0
+ADDF4
+ASGNF4
+ADDRLP4 4+48+4
+ADDRLP4 136+4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 164
+INDIRF4
+ADDF4
+ADDRLP4 172
+INDIRF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRLP4 4+48+8
+ADDRLP4 136+8
+INDIRF4
+ADDRLP4 168
+INDIRF4
+ADDF4
+ADDRLP4 160
+INDIRF4
+ADDF4
+ADDRLP4 404
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+72
+ADDRLP4 136
+INDIRF4
+CNSTF4 0
+ADDF4
+ASGNF4
+ADDRLP4 4+72+4
+ADDRLP4 136+4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 164
+INDIRF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRLP4 4+72+8
+ADDRLP4 136+8
+INDIRF4
+ADDRLP4 168
+INDIRF4
+ADDF4
+ADDRLP4 160
+INDIRF4
+ADDF4
+ADDRLP4 404
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $459
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $467
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $465
+LABELV $467
+ADDRLP4 468
+ADDRLP4 100
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $466
+JUMPV
+LABELV $465
+ADDRLP4 468
+ADDRLP4 100
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $466
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+12
+ADDP4
+ADDRLP4 468
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+GEI4 $471
+ADDRLP4 476
+ADDRLP4 100
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $472
+JUMPV
+LABELV $471
+ADDRLP4 476
+ADDRLP4 100
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $472
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+12+4
+ADDP4
+ADDRLP4 476
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $475
+ADDRFP4 24
+INDIRF4
+CNSTF4 0
+NEF4 $473
+LABELV $475
+ADDRLP4 488
+CNSTF4 1132396544
+ADDRLP4 104
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 492
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 488
+INDIRF4
+ADDRLP4 492
+INDIRF4
+LTF4 $478
+ADDRLP4 484
+ADDRLP4 488
+INDIRF4
+ADDRLP4 492
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $479
+JUMPV
+LABELV $478
+ADDRLP4 484
+ADDRLP4 488
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $479
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20
+ADDP4
+ADDRLP4 484
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 500
+CNSTF4 1132396544
+ADDRLP4 104+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 504
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 500
+INDIRF4
+ADDRLP4 504
+INDIRF4
+LTF4 $484
+ADDRLP4 496
+ADDRLP4 500
+INDIRF4
+ADDRLP4 504
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $485
+JUMPV
+LABELV $484
+ADDRLP4 496
+ADDRLP4 500
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $485
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20+1
+ADDP4
+ADDRLP4 496
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 512
+CNSTF4 1132396544
+ADDRLP4 104+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 516
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 512
+INDIRF4
+ADDRLP4 516
+INDIRF4
+LTF4 $490
+ADDRLP4 508
+ADDRLP4 512
+INDIRF4
+ADDRLP4 516
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $491
+JUMPV
+LABELV $490
+ADDRLP4 508
+ADDRLP4 512
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $491
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20+2
+ADDP4
+ADDRLP4 508
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 524
+CNSTF4 1132396544
+ADDRLP4 104+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 528
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 524
+INDIRF4
+ADDRLP4 528
+INDIRF4
+LTF4 $496
+ADDRLP4 520
+ADDRLP4 524
+INDIRF4
+ADDRLP4 528
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $497
+JUMPV
+LABELV $496
+ADDRLP4 520
+ADDRLP4 524
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $497
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20+3
+ADDP4
+ADDRLP4 520
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $474
+JUMPV
+LABELV $473
+ADDRLP4 488
+CNSTF4 1132396544
+ADDRLP4 120
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 492
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 488
+INDIRF4
+ADDRLP4 492
+INDIRF4
+LTF4 $500
+ADDRLP4 484
+ADDRLP4 488
+INDIRF4
+ADDRLP4 492
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $501
+JUMPV
+LABELV $500
+ADDRLP4 484
+ADDRLP4 488
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $501
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20
+ADDP4
+ADDRLP4 484
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 500
+CNSTF4 1132396544
+ADDRLP4 120+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 504
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 500
+INDIRF4
+ADDRLP4 504
+INDIRF4
+LTF4 $506
+ADDRLP4 496
+ADDRLP4 500
+INDIRF4
+ADDRLP4 504
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $507
+JUMPV
+LABELV $506
+ADDRLP4 496
+ADDRLP4 500
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $507
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20+1
+ADDP4
+ADDRLP4 496
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 512
+CNSTF4 1132396544
+ADDRLP4 120+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 516
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 512
+INDIRF4
+ADDRLP4 516
+INDIRF4
+LTF4 $512
+ADDRLP4 508
+ADDRLP4 512
+INDIRF4
+ADDRLP4 516
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $513
+JUMPV
+LABELV $512
+ADDRLP4 508
+ADDRLP4 512
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $513
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20+2
+ADDP4
+ADDRLP4 508
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 524
+CNSTF4 1132396544
+ADDRLP4 120+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 528
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 524
+INDIRF4
+ADDRLP4 528
+INDIRF4
+LTF4 $518
+ADDRLP4 520
+ADDRLP4 524
+INDIRF4
+ADDRLP4 528
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $519
+JUMPV
+LABELV $518
+ADDRLP4 520
+ADDRLP4 524
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $519
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4+20+3
+ADDP4
+ADDRLP4 520
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $474
+LABELV $460
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $459
+ADDRLP4 176+120
+ADDRLP4 100
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 176+152
+ADDRLP4 172
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 176
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_R_AddPolyRefEntityToScene
+CALLV
+pop
+ADDRLP4 156
+ADDRLP4 156
+INDIRF4
+ADDRLP4 100
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 152
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 408
+ADDRLP4 408
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $424
+ADDRLP4 444
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRLP4 444
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $523
+ADDRLP4 444
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $523
+ADDRLP4 408
+INDIRI4
+ADDRLP4 412
+INDIRI4
+LTI4 $423
+LABELV $523
+LABELV $400
+endproc CG_SurfaceText 532 16
+import Q_Unicode_ToLower
+import Q_Unicode_ToUpper
+import Q_Unicode_IsAlphaOrIdeoOrDigit
+import Q_Unicode_IsAlphaOrIdeo
+import Q_Unicode_IsIdeo
+import Q_Unicode_IsLower
+import Q_Unicode_IsUpper
+import Q_Unicode_IsAlpha
+import Q_UTF8_Unstore
+import Q_UTF8_Store
+import Q_UTF8_Encode
+import Q_UTF8_CodePoint
+import Q_UTF8_ContByte
+import Q_UTF8_PrintStrlen
+import Q_UTF8_Strlen
+import Q_UTF8_WidthCP
+import Q_UTF8_Width
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_LoadVoiceChats
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_enableBreath
+import cg_enableDust
+import cg_blueTeamName
+import cg_redTeamName
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
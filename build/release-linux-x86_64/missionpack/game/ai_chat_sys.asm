@@ -0,0 +1,17309 @@
+data
+export activeconsolemessages
+align 4
+LABELV activeconsolemessages
+byte 4 0
+export freeconsolemessages
+align 4
+LABELV freeconsolemessages
+byte 4 0
+export consolemessagehandle
+align 4
+LABELV consolemessagehandle
+byte 4 1
+export matchtemplates
+align 4
+LABELV matchtemplates
+byte 4 0
+export matchautomaton
+align 4
+LABELV matchautomaton
+byte 4 0
+export synonyms
+align 4
+LABELV synonyms
+byte 4 0
+export randomstrings
+align 4
+LABELV randomstrings
+byte 4 0
+export replychats
+align 4
+LABELV replychats
+byte 4 0
+export BotChatStateFromHandle
+code
+proc BotChatStateFromHandle 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $66
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LEI4 $64
+LABELV $66
+CNSTI4 4
+ARGI4
+ADDRGP4 $67
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $63
+JUMPV
+LABELV $64
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botchatstates
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $68
+CNSTI4 4
+ARGI4
+ADDRGP4 $70
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $63
+JUMPV
+LABELV $68
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botchatstates
+ADDP4
+INDIRP4
+RETP4
+LABELV $63
+endproc BotChatStateFromHandle 4 12
+export InitConsoleMessageHeap
+proc InitConsoleMessageHeap 12 12
+ADDRGP4 consolemessageheap
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 286720
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 consolemessageheap+268
+CNSTP4 0
+ASGNP4
+ADDRGP4 consolemessageheap+272
+ADDRGP4 consolemessageheap+280
+ASGNP4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $75
+ADDRLP4 4
+CNSTI4 280
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 consolemessageheap+268
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 consolemessageheap-280
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 280
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 consolemessageheap+272
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 consolemessageheap+280
+ADDP4
+ASGNP4
+LABELV $76
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1023
+LTI4 $75
+ADDRGP4 consolemessageheap+286440+268
+ADDRGP4 consolemessageheap+286160
+ASGNP4
+ADDRGP4 consolemessageheap+286440+272
+CNSTP4 0
+ASGNP4
+ADDRGP4 freeconsolemessages
+ADDRGP4 consolemessageheap
+ASGNP4
+ADDRGP4 activeconsolemessages
+CNSTP4 0
+ASGNP4
+ADDRGP4 consolemessagehandle
+CNSTI4 1
+ASGNI4
+LABELV $71
+endproc InitConsoleMessageHeap 12 12
+export AllocConsoleMessage
+proc AllocConsoleMessage 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 activeconsolemessages
+INDIRP4
+ASGNP4
+ADDRGP4 $92
+JUMPV
+LABELV $89
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEF4 $93
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $93
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $93
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $88
+JUMPV
+LABELV $93
+LABELV $90
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $92
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $89
+ADDRLP4 4
+ADDRGP4 freeconsolemessages
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $95
+ADDRLP4 8
+ADDRGP4 freeconsolemessages
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $95
+ADDRGP4 freeconsolemessages
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $97
+ADDRGP4 freeconsolemessages
+INDIRP4
+CNSTI4 268
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $97
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $99
+ADDRLP4 12
+ADDRGP4 consolemessagehandle
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 consolemessagehandle
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LEI4 $103
+ADDRLP4 16
+INDIRI4
+CNSTI4 8192
+LEI4 $101
+LABELV $103
+ADDRGP4 consolemessagehandle
+CNSTI4 1
+ASGNI4
+LABELV $101
+ADDRLP4 0
+INDIRP4
+ADDRGP4 consolemessagehandle
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 activeconsolemessages
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $104
+ADDRGP4 activeconsolemessages
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $104
+ADDRLP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+ADDRGP4 activeconsolemessages
+INDIRP4
+ASGNP4
+ADDRGP4 activeconsolemessages
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $99
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $88
+endproc AllocConsoleMessage 20 12
+export FreeConsoleMessage
+proc FreeConsoleMessage 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $107
+ADDRGP4 $106
+JUMPV
+LABELV $107
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $109
+ADDRLP4 8
+CNSTI4 272
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $109
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $111
+ADDRLP4 16
+CNSTI4 268
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $111
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 activeconsolemessages
+INDIRP4
+CVPU4 4
+NEU4 $113
+ADDRLP4 20
+ADDRGP4 activeconsolemessages
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $113
+ADDRGP4 freeconsolemessages
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $115
+ADDRGP4 freeconsolemessages
+INDIRP4
+CNSTI4 268
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $115
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+ADDRGP4 freeconsolemessages
+INDIRP4
+ASGNP4
+ADDRGP4 freeconsolemessages
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $106
+endproc FreeConsoleMessage 24 0
+export BotRemoveConsoleMessage
+proc BotRemoveConsoleMessage 28 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 BotChatStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $118
+ADDRGP4 $117
+JUMPV
+LABELV $118
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $123
+JUMPV
+LABELV $120
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 296
+ADDP4
+ADDP4
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $124
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 296
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 FreeConsoleMessage
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1064
+ADDP4
+INDIRI4
+NEI4 $126
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 296
+ADDP4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 296
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 300
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1064
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+SUBI4
+CVIU4 4
+ADDRLP4 16
+INDIRI4
+LSHU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $127
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 1064
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $122
+JUMPV
+LABELV $124
+LABELV $121
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $123
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1064
+ADDP4
+INDIRI4
+LTI4 $120
+LABELV $122
+LABELV $117
+endproc BotRemoveConsoleMessage 28 12
+export BotQueueConsoleMessage
+proc BotQueueConsoleMessage 28 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 BotChatStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $129
+ADDRGP4 $128
+JUMPV
+LABELV $129
+ADDRLP4 0
+INDIRP4
+CNSTI4 1064
+ADDP4
+INDIRI4
+CNSTI4 192
+LTI4 $131
+CNSTI4 3
+ARGI4
+ADDRGP4 $133
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $128
+JUMPV
+LABELV $131
+ADDRLP4 12
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 AllocConsoleMessage
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $134
+CNSTI4 3
+ARGI4
+ADDRGP4 $136
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $128
+JUMPV
+LABELV $134
+ADDRLP4 0
+INDIRP4
+CNSTI4 1064
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 1064
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $128
+endproc BotQueueConsoleMessage 28 12
+export BotNextConsoleMessage
+proc BotNextConsoleMessage 24 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 BotChatStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $138
+CNSTI4 0
+RETI4
+ADDRGP4 $137
+JUMPV
+LABELV $138
+ADDRLP4 0
+INDIRP4
+CNSTI4 1064
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $140
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+INDIRI4
+RETI4
+ADDRGP4 $137
+JUMPV
+LABELV $140
+CNSTI4 0
+RETI4
+LABELV $137
+endproc BotNextConsoleMessage 24 12
+export BotNumConsoleMessages
+proc BotNumConsoleMessages 8 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotChatStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $143
+CNSTI4 0
+RETI4
+ADDRGP4 $142
+JUMPV
+LABELV $143
+ADDRLP4 0
+INDIRP4
+CNSTI4 1064
+ADDP4
+INDIRI4
+RETI4
+LABELV $142
+endproc BotNumConsoleMessages 8 4
+export IsWhiteSpace
+proc IsWhiteSpace 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRFP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $149
+ADDRLP4 0
+INDIRI4
+CNSTI4 122
+LEI4 $166
+LABELV $149
+ADDRLP4 4
+ADDRFP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 65
+LTI4 $151
+ADDRLP4 4
+INDIRI4
+CNSTI4 90
+LEI4 $166
+LABELV $151
+ADDRLP4 8
+ADDRFP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 48
+LTI4 $153
+ADDRLP4 8
+INDIRI4
+CNSTI4 57
+LEI4 $166
+LABELV $153
+ADDRLP4 12
+ADDRFP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 40
+EQI4 $166
+ADDRLP4 12
+INDIRI4
+CNSTI4 41
+EQI4 $166
+ADDRLP4 12
+INDIRI4
+CNSTI4 63
+EQI4 $166
+ADDRLP4 12
+INDIRI4
+CNSTI4 58
+EQI4 $166
+ADDRLP4 12
+INDIRI4
+CNSTI4 39
+EQI4 $166
+ADDRLP4 12
+INDIRI4
+CNSTI4 47
+EQI4 $166
+ADDRLP4 12
+INDIRI4
+CNSTI4 44
+EQI4 $166
+ADDRLP4 12
+INDIRI4
+CNSTI4 46
+EQI4 $166
+ADDRLP4 12
+INDIRI4
+CNSTI4 91
+EQI4 $166
+ADDRLP4 12
+INDIRI4
+CNSTI4 93
+EQI4 $166
+ADDRLP4 12
+INDIRI4
+CNSTI4 45
+EQI4 $166
+ADDRLP4 12
+INDIRI4
+CNSTI4 95
+EQI4 $166
+ADDRLP4 12
+INDIRI4
+CNSTI4 43
+EQI4 $166
+ADDRLP4 12
+INDIRI4
+CNSTI4 61
+NEI4 $146
+LABELV $166
+CNSTI4 0
+RETI4
+ADDRGP4 $145
+JUMPV
+LABELV $146
+CNSTI4 1
+RETI4
+LABELV $145
+endproc IsWhiteSpace 16 0
+export BotRemoveTildes
+proc BotRemoveTildes 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $171
+JUMPV
+LABELV $168
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 126
+NEI4 $172
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $172
+LABELV $169
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $171
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $168
+LABELV $167
+endproc BotRemoveTildes 16 12
+export UnifyWhiteSpaces
+proc UnifyWhiteSpaces 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $178
+JUMPV
+LABELV $179
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $180
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $182
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 IsWhiteSpace
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $179
+LABELV $182
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+LEU4 $190
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+LEU4 $185
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $185
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI1 32
+ASGNI1
+LABELV $185
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+LEU4 $190
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $190
+JUMPV
+LABELV $189
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $190
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $192
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 IsWhiteSpace
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $189
+LABELV $192
+LABELV $176
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $178
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $180
+LABELV $174
+endproc UnifyWhiteSpaces 28 12
+export StringContains
+proc StringContains 40 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+EQU4 $196
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+NEU4 $194
+LABELV $196
+CNSTI4 -1
+RETI4
+ADDRGP4 $193
+JUMPV
+LABELV $194
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+ADDRLP4 20
+INDIRU4
+ADDRLP4 24
+INDIRU4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $200
+JUMPV
+LABELV $197
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $204
+JUMPV
+LABELV $201
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $205
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+EQI4 $206
+ADDRGP4 $203
+JUMPV
+LABELV $205
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 32
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 36
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $209
+ADDRGP4 $203
+JUMPV
+LABELV $209
+LABELV $206
+LABELV $202
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $204
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $201
+LABELV $203
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $211
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $193
+JUMPV
+LABELV $211
+LABELV $198
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $200
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $197
+CNSTI4 -1
+RETI4
+LABELV $193
+endproc StringContains 40 4
+export StringContainsWord
+proc StringContainsWord 28 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 12
+INDIRU4
+ADDRLP4 16
+INDIRU4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $217
+JUMPV
+LABELV $214
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $218
+ADDRGP4 $221
+JUMPV
+LABELV $220
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $221
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $226
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+EQI4 $226
+ADDRLP4 20
+INDIRI4
+CNSTI4 46
+EQI4 $226
+ADDRLP4 20
+INDIRI4
+CNSTI4 44
+EQI4 $226
+ADDRLP4 20
+INDIRI4
+CNSTI4 33
+NEI4 $220
+LABELV $226
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $227
+ADDRGP4 $216
+JUMPV
+LABELV $227
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $218
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $232
+JUMPV
+LABELV $229
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $233
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+EQI4 $234
+ADDRGP4 $231
+JUMPV
+LABELV $233
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $237
+ADDRGP4 $231
+JUMPV
+LABELV $237
+LABELV $234
+LABELV $230
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $232
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $229
+LABELV $231
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $239
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $246
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+EQI4 $246
+ADDRLP4 20
+INDIRI4
+CNSTI4 46
+EQI4 $246
+ADDRLP4 20
+INDIRI4
+CNSTI4 44
+EQI4 $246
+ADDRLP4 20
+INDIRI4
+CNSTI4 33
+NEI4 $241
+LABELV $246
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $213
+JUMPV
+LABELV $241
+LABELV $239
+LABELV $215
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $217
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $214
+LABELV $216
+CNSTP4 0
+RETP4
+LABELV $213
+endproc StringContainsWord 28 4
+export StringReplaceWords
+proc StringReplaceWords 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 StringContainsWord
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $249
+JUMPV
+LABELV $248
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 StringContainsWord
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $252
+JUMPV
+LABELV $251
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+GTU4 $254
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 16
+INDIRU4
+ADDRLP4 20
+INDIRU4
+ADDRLP4 0
+INDIRP4
+ADDP4
+CVPU4 4
+GEU4 $254
+ADDRGP4 $253
+JUMPV
+LABELV $254
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 StringContainsWord
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+LABELV $252
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $251
+LABELV $253
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $256
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 24
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 16
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 28
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $256
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 16
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 StringContainsWord
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+LABELV $249
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $248
+LABELV $247
+endproc StringReplaceWords 36 12
+export BotLoadSynonyms
+proc BotLoadSynonyms 1296 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $259
+CNSTP4 0
+RETP4
+ADDRGP4 $258
+JUMPV
+LABELV $259
+ADDRLP4 1216
+CNSTI4 0
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1216
+INDIRI4
+ASGNI4
+ADDRLP4 1220
+CNSTP4 0
+ASGNP4
+ADDRLP4 1212
+ADDRLP4 1220
+INDIRP4
+ASGNP4
+ADDRLP4 1076
+ADDRLP4 1220
+INDIRP4
+ASGNP4
+ADDRLP4 1048
+CNSTP4 0
+ASGNP4
+ADDRLP4 1056
+ADDRLP4 1216
+INDIRI4
+ASGNI4
+LABELV $261
+ADDRLP4 1224
+CNSTI4 0
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 1224
+INDIRI4
+EQI4 $265
+ADDRLP4 1060
+INDIRI4
+ADDRLP4 1224
+INDIRI4
+EQI4 $265
+ADDRLP4 1060
+INDIRI4
+ARGI4
+ADDRLP4 1228
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 1044
+ADDRLP4 1228
+INDIRP4
+ASGNP4
+LABELV $265
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $267
+ARGP4
+ADDRLP4 1232
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1232
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $268
+CNSTI4 3
+ARGI4
+ADDRGP4 $270
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $258
+JUMPV
+LABELV $268
+ADDRLP4 1068
+CNSTU4 0
+ASGNU4
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+ADDRLP4 1236
+CNSTP4 0
+ASGNP4
+ADDRLP4 1212
+ADDRLP4 1236
+INDIRP4
+ASGNP4
+ADDRLP4 1208
+ADDRLP4 1236
+INDIRP4
+ASGNP4
+ADDRGP4 $272
+JUMPV
+LABELV $271
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $274
+ADDRLP4 1068
+ADDRLP4 1068
+INDIRU4
+ADDRLP4 4+8
+INDIRI4
+CVIU4 4
+BORU4
+ASGNU4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1080
+ADDP4
+ADDRLP4 4+8
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 1052
+ADDRLP4 1052
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 32
+LTI4 $278
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $280
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $258
+JUMPV
+LABELV $278
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $283
+ARGP4
+ADDRLP4 1240
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1240
+INDIRI4
+CNSTI4 0
+NEI4 $275
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $258
+JUMPV
+LABELV $274
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+NEI4 $284
+ADDRLP4 4+16
+ARGP4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 1240
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1240
+INDIRI4
+CNSTI4 0
+NEI4 $286
+ADDRLP4 1052
+ADDRLP4 1052
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+GEI4 $290
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $292
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $258
+JUMPV
+LABELV $290
+ADDRLP4 1068
+ADDRLP4 1068
+INDIRU4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1080
+ADDP4
+INDIRU4
+BCOMU4
+BANDU4
+ASGNU4
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRLP4 4+16
+ARGP4
+ADDRGP4 $296
+ARGP4
+ADDRLP4 1244
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1244
+INDIRI4
+CNSTI4 0
+NEI4 $293
+ADDRLP4 1060
+ADDRLP4 1060
+INDIRI4
+CVIU4 4
+CNSTU4 16
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $297
+ADDRLP4 1044
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $297
+ADDRLP4 1076
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+ADDRLP4 1044
+INDIRP4
+CNSTU4 16
+ADDP4
+ASGNP4
+ADDRLP4 1076
+INDIRP4
+ADDRLP4 1068
+INDIRU4
+ASGNU4
+ADDRLP4 1076
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 1076
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 1208
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $299
+ADDRLP4 1208
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 1076
+INDIRP4
+ASGNP4
+ADDRGP4 $300
+JUMPV
+LABELV $299
+ADDRLP4 1212
+ADDRLP4 1076
+INDIRP4
+ASGNP4
+LABELV $300
+ADDRLP4 1208
+ADDRLP4 1076
+INDIRP4
+ASGNP4
+LABELV $297
+ADDRLP4 1072
+CNSTI4 0
+ASGNI4
+ADDRLP4 1064
+CNSTP4 0
+ASGNP4
+ADDRGP4 $302
+JUMPV
+LABELV $301
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $306
+ARGP4
+ADDRLP4 1252
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1256
+CNSTI4 0
+ASGNI4
+ADDRLP4 1252
+INDIRI4
+ADDRLP4 1256
+INDIRI4
+EQI4 $307
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 1256
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1260
+ADDRGP4 PC_ExpectTokenType
+CALLI4
+ASGNI4
+ADDRLP4 1260
+INDIRI4
+CNSTI4 0
+NEI4 $304
+LABELV $307
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $258
+JUMPV
+LABELV $304
+ADDRLP4 4+16
+ARGP4
+ADDRLP4 1264
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1264
+INDIRU4
+CNSTU4 0
+NEU4 $308
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $311
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $258
+JUMPV
+LABELV $308
+ADDRLP4 4+16
+ARGP4
+ADDRLP4 1268
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1248
+ADDRLP4 1268
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 1248
+ADDRLP4 1248
+INDIRU4
+CNSTU4 4
+ADDU4
+CNSTU4 1
+SUBU4
+CNSTU4 4294967292
+BANDU4
+ASGNU4
+ADDRLP4 1060
+ADDRLP4 1060
+INDIRI4
+CVIU4 4
+ADDRLP4 1248
+INDIRU4
+CNSTU4 12
+ADDU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $313
+ADDRLP4 1044
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $313
+ADDRLP4 1048
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+ADDRLP4 1044
+INDIRP4
+CNSTU4 12
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+ADDRLP4 1248
+INDIRU4
+ADDRLP4 1044
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 4+16
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 1064
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $316
+ADDRLP4 1064
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+ADDRGP4 $317
+JUMPV
+LABELV $316
+ADDRLP4 1076
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+LABELV $317
+ADDRLP4 1064
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+LABELV $313
+ADDRLP4 1072
+ADDRLP4 1072
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 1272
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1276
+CNSTI4 0
+ASGNI4
+ADDRLP4 1272
+INDIRI4
+ADDRLP4 1276
+INDIRI4
+EQI4 $323
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 1276
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1280
+ADDRGP4 PC_ExpectTokenType
+CALLI4
+ASGNI4
+ADDRLP4 1280
+INDIRI4
+CNSTI4 0
+EQI4 $323
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $321
+ARGP4
+ADDRLP4 1284
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1284
+INDIRI4
+CNSTI4 0
+NEI4 $318
+LABELV $323
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $258
+JUMPV
+LABELV $318
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $324
+ADDRLP4 1044
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $324
+ADDRLP4 1048
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4+12
+INDIRF4
+ASGNF4
+ADDRLP4 1288
+CNSTI4 4
+ASGNI4
+ADDRLP4 1292
+ADDRLP4 1076
+INDIRP4
+ADDRLP4 1288
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 1292
+INDIRP4
+ADDRLP4 1292
+INDIRP4
+INDIRF4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1288
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $324
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 1288
+ADDRGP4 PC_CheckTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1288
+INDIRI4
+CNSTI4 0
+EQI4 $327
+ADDRGP4 $303
+JUMPV
+LABELV $327
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 1292
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1292
+INDIRI4
+CNSTI4 0
+NEI4 $330
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $258
+JUMPV
+LABELV $330
+LABELV $302
+ADDRGP4 $301
+JUMPV
+LABELV $303
+ADDRLP4 1072
+INDIRI4
+CNSTI4 2
+GEI4 $294
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $334
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $258
+JUMPV
+LABELV $293
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $335
+ARGP4
+ADDRLP4 4+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $258
+JUMPV
+LABELV $294
+LABELV $287
+LABELV $284
+LABELV $275
+LABELV $272
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1240
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1240
+INDIRI4
+CNSTI4 0
+NEI4 $271
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+LEI4 $337
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $339
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $258
+JUMPV
+LABELV $337
+LABELV $262
+ADDRLP4 1056
+ADDRLP4 1056
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 2
+LTI4 $261
+CNSTI4 0
+ARGI4
+ADDRGP4 $340
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 1212
+INDIRP4
+RETP4
+LABELV $258
+endproc BotLoadSynonyms 1296 16
+export BotReplaceSynonyms
+proc BotReplaceSynonyms 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRU4
+ASGNU4
+ADDRLP4 4
+ADDRGP4 synonyms
+INDIRP4
+ASGNP4
+ADDRGP4 $345
+JUMPV
+LABELV $342
+ADDRLP4 4
+INDIRP4
+INDIRU4
+ADDRFP4 4
+INDIRU4
+BANDU4
+CNSTU4 0
+NEU4 $346
+ADDRGP4 $343
+JUMPV
+LABELV $346
+ADDRLP4 8
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $351
+JUMPV
+LABELV $348
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 StringReplaceWords
+CALLV
+pop
+LABELV $349
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $351
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $348
+LABELV $343
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $345
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $342
+LABELV $341
+endproc BotReplaceSynonyms 12 12
+export BotReplaceWeightedSynonyms
+proc BotReplaceWeightedSynonyms 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRU4
+ASGNU4
+ADDRLP4 16
+ADDRGP4 synonyms
+INDIRP4
+ASGNP4
+ADDRGP4 $356
+JUMPV
+LABELV $353
+ADDRLP4 16
+INDIRP4
+INDIRU4
+ADDRFP4 4
+INDIRU4
+BANDU4
+CNSTU4 0
+NEU4 $357
+ADDRGP4 $354
+JUMPV
+LABELV $357
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+NEF4 $359
+ADDRGP4 $354
+JUMPV
+LABELV $359
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $364
+JUMPV
+LABELV $361
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $365
+ADDRGP4 $363
+JUMPV
+LABELV $365
+LABELV $362
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $364
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $361
+LABELV $363
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $367
+ADDRGP4 $354
+JUMPV
+LABELV $367
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $372
+JUMPV
+LABELV $369
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+NEU4 $373
+ADDRGP4 $370
+JUMPV
+LABELV $373
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 StringReplaceWords
+CALLV
+pop
+LABELV $370
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $372
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $369
+LABELV $354
+ADDRLP4 16
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $356
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $353
+LABELV $352
+endproc BotReplaceWeightedSynonyms 24 12
+export BotReplaceReplySynonyms
+proc BotReplaceReplySynonyms 64 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRU4
+ASGNU4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $379
+JUMPV
+LABELV $380
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $381
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $383
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+LEI4 $380
+LABELV $383
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $384
+ADDRGP4 $378
+JUMPV
+LABELV $384
+ADDRLP4 16
+ADDRGP4 synonyms
+INDIRP4
+ASGNP4
+ADDRGP4 $389
+JUMPV
+LABELV $386
+ADDRLP4 16
+INDIRP4
+INDIRU4
+ADDRFP4 4
+INDIRU4
+BANDU4
+CNSTU4 0
+NEU4 $390
+ADDRGP4 $387
+JUMPV
+LABELV $390
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $395
+JUMPV
+LABELV $392
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 StringContainsWord
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 32
+INDIRU4
+CNSTU4 0
+EQU4 $398
+ADDRLP4 32
+INDIRU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+EQU4 $396
+LABELV $398
+ADDRGP4 $393
+JUMPV
+LABELV $396
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+ADDRGP4 StringContainsWord
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 40
+INDIRU4
+CNSTU4 0
+EQU4 $399
+ADDRLP4 40
+INDIRU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+NEU4 $399
+ADDRGP4 $393
+JUMPV
+LABELV $399
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 52
+INDIRU4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 44
+INDIRU4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 48
+INDIRU4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 56
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRU4
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $394
+JUMPV
+LABELV $393
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $395
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $392
+LABELV $394
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $401
+ADDRGP4 $404
+JUMPV
+LABELV $401
+LABELV $387
+ADDRLP4 16
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $389
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $386
+ADDRGP4 $404
+JUMPV
+LABELV $403
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $404
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $406
+ADDRLP4 24
+INDIRI4
+CNSTI4 32
+GTI4 $403
+LABELV $406
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $407
+ADDRGP4 $378
+JUMPV
+LABELV $407
+LABELV $377
+LABELV $379
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $381
+LABELV $378
+LABELV $375
+endproc BotReplaceReplySynonyms 64 12
+export BotLoadChatMessage
+proc BotLoadChatMessage 1068 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $411
+JUMPV
+LABELV $410
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 PC_ExpectAnyToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $413
+CNSTI4 0
+RETI4
+ADDRGP4 $409
+JUMPV
+LABELV $413
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $415
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1052
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1048
+INDIRU4
+ADDRLP4 1052
+INDIRU4
+ADDU4
+CNSTU4 1
+ADDU4
+CNSTU4 256
+LEU4 $417
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $420
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $409
+JUMPV
+LABELV $417
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRGP4 $416
+JUMPV
+LABELV $415
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $422
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $422
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1048
+INDIRU4
+CNSTU4 7
+ADDU4
+CNSTU4 256
+LEU4 $425
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $420
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $409
+JUMPV
+LABELV $425
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1052
+INDIRU4
+ADDRLP4 1040
+INDIRP4
+ADDP4
+ARGP4
+CNSTU4 256
+ADDRLP4 1060
+INDIRU4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 $427
+ARGP4
+ADDRLP4 1064
+CNSTI4 1
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $423
+JUMPV
+LABELV $422
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+NEI4 $429
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1048
+INDIRU4
+CNSTU4 7
+ADDU4
+CNSTU4 256
+LEU4 $431
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $420
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $409
+JUMPV
+LABELV $431
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1052
+INDIRU4
+ADDRLP4 1040
+INDIRP4
+ADDP4
+ARGP4
+CNSTU4 256
+ADDRLP4 1060
+INDIRU4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 $433
+ARGP4
+ADDRLP4 1064
+CNSTI4 1
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $430
+JUMPV
+LABELV $429
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $435
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $409
+JUMPV
+LABELV $430
+LABELV $423
+LABELV $416
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $439
+ARGP4
+ADDRLP4 1048
+ADDRGP4 PC_CheckTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+EQI4 $437
+ADDRGP4 $412
+JUMPV
+LABELV $437
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 1052
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $440
+CNSTI4 0
+RETI4
+ADDRGP4 $409
+JUMPV
+LABELV $440
+LABELV $411
+ADDRGP4 $410
+JUMPV
+LABELV $412
+CNSTI4 1
+RETI4
+LABELV $409
+endproc BotLoadChatMessage 1068 24
+export BotLoadRandomStrings
+proc BotLoadRandomStrings 1384 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $443
+CNSTP4 0
+RETP4
+ADDRGP4 $442
+JUMPV
+LABELV $443
+ADDRLP4 1328
+CNSTI4 0
+ASGNI4
+ADDRLP4 276
+ADDRLP4 1328
+INDIRI4
+ASGNI4
+ADDRLP4 1332
+CNSTP4 0
+ASGNP4
+ADDRLP4 1324
+ADDRLP4 1332
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 1332
+INDIRP4
+ASGNP4
+ADDRLP4 272
+ADDRLP4 1328
+INDIRI4
+ASGNI4
+LABELV $445
+ADDRLP4 1336
+CNSTI4 0
+ASGNI4
+ADDRLP4 272
+INDIRI4
+ADDRLP4 1336
+INDIRI4
+EQI4 $449
+ADDRLP4 276
+INDIRI4
+ADDRLP4 1336
+INDIRI4
+EQI4 $449
+ADDRLP4 276
+INDIRI4
+ARGI4
+ADDRLP4 1340
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1340
+INDIRP4
+ASGNP4
+LABELV $449
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $267
+ARGP4
+ADDRLP4 1344
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1344
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $451
+CNSTI4 3
+ARGI4
+ADDRGP4 $270
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $442
+JUMPV
+LABELV $451
+ADDRLP4 1348
+CNSTP4 0
+ASGNP4
+ADDRLP4 1324
+ADDRLP4 1348
+INDIRP4
+ASGNP4
+ADDRLP4 1320
+ADDRLP4 1348
+INDIRP4
+ASGNP4
+ADDRGP4 $454
+JUMPV
+LABELV $453
+ADDRLP4 280
+INDIRI4
+CNSTI4 4
+EQI4 $456
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $458
+ARGP4
+ADDRLP4 280+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $442
+JUMPV
+LABELV $456
+ADDRLP4 280+16
+ARGP4
+ADDRLP4 1356
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1352
+ADDRLP4 1356
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 1352
+ADDRLP4 1352
+INDIRU4
+CNSTU4 4
+ADDU4
+CNSTU4 1
+SUBU4
+CNSTU4 4294967292
+BANDU4
+ASGNU4
+ADDRLP4 276
+ADDRLP4 276
+INDIRI4
+CVIU4 4
+ADDRLP4 1352
+INDIRU4
+CNSTU4 16
+ADDU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $461
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $461
+ADDRLP4 268
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTU4 16
+ADDP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1352
+INDIRU4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 280+16
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 268
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 268
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 1320
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $464
+ADDRLP4 1320
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 268
+INDIRP4
+ASGNP4
+ADDRGP4 $465
+JUMPV
+LABELV $464
+ADDRLP4 1324
+ADDRLP4 268
+INDIRP4
+ASGNP4
+LABELV $465
+ADDRLP4 1320
+ADDRLP4 268
+INDIRP4
+ASGNP4
+LABELV $461
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $468
+ARGP4
+ADDRLP4 1360
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1360
+INDIRI4
+CNSTI4 0
+EQI4 $469
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $283
+ARGP4
+ADDRLP4 1364
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1364
+INDIRI4
+CNSTI4 0
+NEI4 $471
+LABELV $469
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $442
+JUMPV
+LABELV $470
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1368
+ADDRGP4 BotLoadChatMessage
+CALLI4
+ASGNI4
+ADDRLP4 1368
+INDIRI4
+CNSTI4 0
+NEI4 $473
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $442
+JUMPV
+LABELV $473
+ADDRLP4 8
+ARGP4
+ADDRLP4 1372
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1352
+ADDRLP4 1372
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 1352
+ADDRLP4 1352
+INDIRU4
+CNSTU4 4
+ADDU4
+CNSTU4 1
+SUBU4
+CNSTU4 4294967292
+BANDU4
+ASGNU4
+ADDRLP4 276
+ADDRLP4 276
+INDIRI4
+CVIU4 4
+ADDRLP4 1352
+INDIRU4
+CNSTU4 8
+ADDU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $475
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $475
+ADDRLP4 264
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTU4 8
+ADDP4
+ASGNP4
+ADDRLP4 264
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1352
+INDIRU4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 264
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 1380
+ADDRLP4 268
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 1380
+INDIRP4
+ADDRLP4 1380
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 264
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 268
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 264
+INDIRP4
+ASGNP4
+LABELV $475
+LABELV $471
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 1368
+ADDRGP4 PC_CheckTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1368
+INDIRI4
+CNSTI4 0
+EQI4 $470
+LABELV $454
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 280
+ARGP4
+ADDRLP4 1352
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1352
+INDIRI4
+CNSTI4 0
+NEI4 $453
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+LABELV $446
+ADDRLP4 272
+ADDRLP4 272
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 2
+LTI4 $445
+CNSTI4 0
+ARGI4
+ADDRGP4 $340
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 1324
+INDIRP4
+RETP4
+LABELV $442
+endproc BotLoadRandomStrings 1384 12
+export RandomString
+proc RandomString 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 randomstrings
+INDIRP4
+ASGNP4
+ADDRGP4 $481
+JUMPV
+LABELV $478
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $482
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $487
+JUMPV
+LABELV $484
+ADDRLP4 24
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+GEI4 $488
+ADDRGP4 $486
+JUMPV
+LABELV $488
+LABELV $485
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $487
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $484
+LABELV $486
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $490
+ADDRLP4 0
+INDIRP4
+INDIRP4
+RETP4
+ADDRGP4 $477
+JUMPV
+LABELV $490
+LABELV $482
+LABELV $479
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $481
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $478
+CNSTP4 0
+RETP4
+LABELV $477
+endproc RandomString 28 8
+export BotFreeMatchPieces
+proc BotFreeMatchPieces 24 4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $496
+JUMPV
+LABELV $493
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 2
+NEI4 $497
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $502
+JUMPV
+LABELV $499
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+LABELV $500
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $502
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $499
+LABELV $497
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+LABELV $494
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+LABELV $496
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $493
+LABELV $492
+endproc BotFreeMatchPieces 24 4
+export BotLoadMatchPieces
+proc BotLoadMatchPieces 1092 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1068
+CNSTP4 0
+ASGNP4
+ADDRLP4 1052
+ADDRLP4 1068
+INDIRP4
+ASGNP4
+ADDRLP4 1056
+ADDRLP4 1068
+INDIRP4
+ASGNP4
+ADDRLP4 1064
+CNSTI4 0
+ASGNI4
+ADDRGP4 $505
+JUMPV
+LABELV $504
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $507
+ADDRLP4 4+4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $507
+ADDRLP4 4+8
+INDIRI4
+CNSTI4 8
+LTI4 $510
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $513
+ARGP4
+CNSTI4 8
+ARGI4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeMatchPieces
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $503
+JUMPV
+LABELV $510
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+EQI4 $514
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $516
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeMatchPieces
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $503
+JUMPV
+LABELV $514
+ADDRLP4 1064
+CNSTI4 1
+ASGNI4
+CNSTI4 16
+ARGI4
+ADDRLP4 1072
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 1044
+ADDRLP4 1072
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 1044
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 4+8
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $518
+ADDRLP4 1056
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRGP4 $519
+JUMPV
+LABELV $518
+ADDRLP4 1052
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+LABELV $519
+ADDRLP4 1056
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRGP4 $508
+JUMPV
+LABELV $507
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $520
+CNSTI4 16
+ARGI4
+ADDRLP4 1072
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 1044
+ADDRLP4 1072
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 1044
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 1044
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $522
+ADDRLP4 1056
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRGP4 $523
+JUMPV
+LABELV $522
+ADDRLP4 1052
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+LABELV $523
+ADDRLP4 1056
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRLP4 1048
+CNSTP4 0
+ASGNP4
+ADDRLP4 1060
+CNSTI4 0
+ASGNI4
+LABELV $524
+ADDRLP4 1044
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $527
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_ExpectTokenType
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $529
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeMatchPieces
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $503
+JUMPV
+LABELV $529
+LABELV $527
+ADDRLP4 4+16
+ARGP4
+ADDRLP4 1076
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1076
+INDIRU4
+CNSTU4 8
+ADDU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 1080
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1080
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTU4 8
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 4+16
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4+16
+ARGP4
+ADDRLP4 1088
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1088
+INDIRU4
+CNSTU4 0
+NEU4 $533
+ADDRLP4 1060
+CNSTI4 1
+ASGNI4
+LABELV $533
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $536
+ADDRLP4 1048
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $537
+JUMPV
+LABELV $536
+ADDRLP4 1044
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $537
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $525
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $538
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_CheckTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $524
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $521
+ADDRLP4 1064
+CNSTI4 0
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $520
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $541
+ARGP4
+ADDRLP4 4+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeMatchPieces
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $503
+JUMPV
+LABELV $521
+LABELV $508
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 PC_CheckTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+EQI4 $543
+ADDRGP4 $506
+JUMPV
+LABELV $543
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $545
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeMatchPieces
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $503
+JUMPV
+LABELV $545
+LABELV $505
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $504
+LABELV $506
+ADDRLP4 1052
+INDIRP4
+RETP4
+LABELV $503
+endproc BotLoadMatchPieces 1092 16
+export BotFreeMatchTemplates
+proc BotFreeMatchTemplates 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $551
+JUMPV
+LABELV $548
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeMatchPieces
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+LABELV $549
+ADDRFP4 0
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $551
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $548
+LABELV $547
+endproc BotFreeMatchTemplates 8 4
+export BotMatchAutomatonAddString
+proc BotMatchAutomatonAddString 48 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $556
+JUMPV
+LABELV $553
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $560
+JUMPV
+LABELV $557
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $561
+ADDRGP4 $559
+JUMPV
+LABELV $561
+LABELV $558
+ADDRLP4 0
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $560
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $557
+LABELV $559
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $563
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+CNSTI4 -1
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+CNSTI4 24
+ASGNI4
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 40
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 40
+INDIRP4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 4
+ASGNI4
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $563
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $554
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $556
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $553
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $552
+endproc BotMatchAutomatonAddString 48 4
+export BotMatchAutomatonNextNode
+proc BotMatchAutomatonNextNode 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $567
+JUMPV
+LABELV $566
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 24
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $572
+JUMPV
+LABELV $569
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+NEI4 $573
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $565
+JUMPV
+LABELV $573
+LABELV $570
+ADDRLP4 0
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $572
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $569
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $575
+ADDRGP4 $568
+JUMPV
+LABELV $575
+ADDRFP4 4
+CNSTI4 24
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $567
+ADDRGP4 $566
+JUMPV
+LABELV $568
+CNSTI4 0
+RETI4
+LABELV $565
+endproc BotMatchAutomatonNextNode 8 0
+export BotCompileMatchTemplates
+proc BotCompileMatchTemplates 132 12
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $581
+JUMPV
+LABELV $578
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 44
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $585
+JUMPV
+LABELV $582
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 2
+EQI4 $586
+ADDRGP4 $583
+JUMPV
+LABELV $586
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $591
+JUMPV
+LABELV $588
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CVIU4 4
+ADDRLP4 52
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $589
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $591
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $588
+LABELV $583
+ADDRLP4 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $585
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $582
+LABELV $579
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $581
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $578
+CNSTI4 20
+ARGI4
+ADDRLP4 52
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 52
+INDIRP4
+ASGNP4
+CNSTU4 24
+ADDRLP4 20
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRLP4 56
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+CVUI4 4
+ARGI4
+ADDRLP4 60
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $595
+JUMPV
+LABELV $592
+ADDRLP4 44
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 44
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $599
+JUMPV
+LABELV $596
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 2
+EQI4 $600
+ADDRGP4 $597
+JUMPV
+LABELV $600
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $605
+JUMPV
+LABELV $602
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 64
+INDIRU4
+CNSTU4 0
+NEU4 $606
+ADDRGP4 $604
+JUMPV
+LABELV $606
+LABELV $603
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $605
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $602
+LABELV $604
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $608
+ADDRGP4 $597
+JUMPV
+LABELV $608
+ADDRLP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $613
+JUMPV
+LABELV $610
+ADDRLP4 68
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 BotMatchAutomatonAddString
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+LABELV $611
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $613
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $610
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 4
+ADDI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $597
+ADDRLP4 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $599
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $596
+ADDRLP4 44
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $593
+ADDRLP4 44
+ADDRLP4 44
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $595
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $592
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 4
+DIVI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIU4 4
+CNSTI4 2
+LSHU4
+CVUI4 4
+ARGI4
+ADDRLP4 68
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 8
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $617
+JUMPV
+LABELV $614
+CNSTI4 24
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+INDIRP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $615
+ADDRLP4 24
+CNSTI4 24
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $617
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $614
+ADDRGP4 $619
+JUMPV
+LABELV $618
+ADDRLP4 80
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 80
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 24
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $621
+ADDRLP4 84
+CNSTI4 24
+ASGNI4
+ADDRLP4 88
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 84
+INDIRI4
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRLP4 88
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 96
+CNSTI4 16
+ASGNI4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ADDRLP4 84
+INDIRI4
+ADDRLP4 92
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 88
+INDIRP4
+ADDP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $621
+ADDRLP4 100
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+CNSTI4 24
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRP4
+ADDP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $626
+JUMPV
+LABELV $623
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 108
+CNSTI4 24
+ASGNI4
+ADDRLP4 112
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 116
+CNSTI4 12
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRLP4 112
+INDIRP4
+ADDP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+ADDRLP4 108
+INDIRI4
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRLP4 112
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 124
+ADDRGP4 BotMatchAutomatonNextNode
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+INDIRP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $624
+ADDRLP4 24
+CNSTI4 24
+ADDRLP4 24
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $626
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $623
+LABELV $619
+ADDRLP4 48
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LTI4 $618
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+RETP4
+LABELV $577
+endproc BotCompileMatchTemplates 132 12
+export BotFreeMatchAutomaton
+proc BotFreeMatchAutomaton 0 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $628
+ADDRGP4 $627
+JUMPV
+LABELV $628
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+LABELV $627
+endproc BotFreeMatchAutomaton 0 4
+export BotLoadMatchTemplates
+proc BotLoadMatchTemplates 1112 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $631
+CNSTP4 0
+RETP4
+ADDRGP4 $630
+JUMPV
+LABELV $631
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $267
+ARGP4
+ADDRLP4 1060
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $633
+CNSTI4 3
+ARGI4
+ADDRGP4 $270
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $630
+JUMPV
+LABELV $633
+ADDRLP4 1064
+CNSTP4 0
+ASGNP4
+ADDRLP4 1048
+ADDRLP4 1064
+INDIRP4
+ASGNP4
+ADDRLP4 1052
+ADDRLP4 1064
+INDIRP4
+ASGNP4
+ADDRGP4 $636
+JUMPV
+LABELV $635
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+NEI4 $641
+ADDRLP4 8+4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $638
+LABELV $641
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $642
+ARGP4
+ADDRLP4 8+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeMatchTemplates
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $630
+JUMPV
+LABELV $638
+ADDRLP4 1056
+ADDRLP4 8+8
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $283
+ARGP4
+ADDRLP4 1068
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $648
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeMatchTemplates
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $630
+JUMPV
+LABELV $647
+ADDRLP4 8+16
+ARGP4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 1072
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $650
+ADDRGP4 $649
+JUMPV
+LABELV $650
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_UnreadToken
+CALLV
+pop
+CNSTI4 24
+ARGI4
+ADDRLP4 1076
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1076
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 1056
+INDIRU4
+ASGNU4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $653
+ADDRLP4 1052
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $654
+JUMPV
+LABELV $653
+ADDRLP4 1048
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $654
+ADDRLP4 1052
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $468
+ARGP4
+ADDRLP4 1084
+ADDRGP4 BotLoadMatchPieces
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 1084
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $655
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeMatchTemplates
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $630
+JUMPV
+LABELV $655
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $306
+ARGP4
+ADDRLP4 1088
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+EQI4 $659
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+CNSTI4 4096
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1092
+ADDRGP4 PC_ExpectTokenType
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $657
+LABELV $659
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeMatchTemplates
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $630
+JUMPV
+LABELV $657
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8+8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 1096
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+EQI4 $663
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+CNSTI4 4096
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1100
+ADDRGP4 PC_ExpectTokenType
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $661
+LABELV $663
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeMatchTemplates
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $630
+JUMPV
+LABELV $661
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8+8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $321
+ARGP4
+ADDRLP4 1104
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+EQI4 $667
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $439
+ARGP4
+ADDRLP4 1108
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $665
+LABELV $667
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeMatchTemplates
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $630
+JUMPV
+LABELV $665
+LABELV $648
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1072
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $647
+LABELV $649
+LABELV $636
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1068
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $635
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 $340
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 matchautomaton
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeMatchAutomaton
+CALLV
+pop
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 BotCompileMatchTemplates
+CALLP4
+ASGNP4
+ADDRGP4 matchautomaton
+ADDRLP4 1072
+INDIRP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+RETP4
+LABELV $630
+endproc BotLoadMatchTemplates 1112 16
+export StringsMatch
+proc StringsMatch 40 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 -1
+ASGNI4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $672
+JUMPV
+LABELV $669
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 2
+NEI4 $673
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $678
+JUMPV
+LABELV $675
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 24
+INDIRU4
+CNSTU4 0
+NEU4 $679
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $677
+JUMPV
+LABELV $679
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 28
+ADDRGP4 StringContains
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $681
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $683
+ADDRLP4 36
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+SUBI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $677
+JUMPV
+LABELV $683
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $685
+ADDRGP4 $677
+JUMPV
+LABELV $685
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+LABELV $681
+LABELV $676
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $678
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $675
+LABELV $677
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $687
+CNSTI4 0
+RETI4
+ADDRGP4 $668
+JUMPV
+LABELV $687
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 24
+INDIRU4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $674
+JUMPV
+LABELV $673
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+NEI4 $689
+ADDRLP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVII1 4
+ASGNI1
+ADDRLP4 16
+ADDRLP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $689
+LABELV $674
+LABELV $670
+ADDRLP4 20
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $672
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $669
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $691
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+GEI4 $693
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 24
+INDIRU4
+CNSTU4 0
+NEU4 $691
+LABELV $693
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $694
+ADDRLP4 32
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 36
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $694
+CNSTI4 1
+RETI4
+ADDRGP4 $668
+JUMPV
+LABELV $691
+CNSTI4 0
+RETI4
+LABELV $668
+endproc StringsMatch 40 12
+export BotMatchAutomatonSearch
+proc BotMatchAutomatonSearch 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $700
+JUMPV
+LABELV $697
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 BotMatchAutomatonNextNode
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $704
+JUMPV
+LABELV $701
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+NEI4 $705
+ADDRGP4 $703
+JUMPV
+LABELV $705
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $702
+ADDRLP4 20
+CNSTI4 24
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 24
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 24
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $704
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $701
+LABELV $703
+LABELV $698
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $700
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $697
+LABELV $696
+endproc BotMatchAutomatonSearch 28 12
+export BotMatchTemplateCandidate
+proc BotMatchTemplateCandidate 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $708
+CNSTI4 1
+RETI4
+ADDRGP4 $707
+JUMPV
+LABELV $708
+ADDRLP4 16
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $713
+JUMPV
+LABELV $710
+ADDRLP4 20
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $717
+JUMPV
+LABELV $714
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+NEI4 $718
+ADDRGP4 $716
+JUMPV
+LABELV $718
+LABELV $715
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $717
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $714
+LABELV $716
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $720
+CNSTI4 0
+RETI4
+ADDRGP4 $707
+JUMPV
+LABELV $720
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $711
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $713
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GTI4 $710
+CNSTI4 1
+RETI4
+LABELV $707
+endproc BotMatchTemplateCandidate 28 0
+export BotPrepareMatchString
+proc BotPrepareMatchString 8 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTU4 256
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRGP4 $724
+JUMPV
+LABELV $723
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRU4
+CNSTU4 1
+SUBU4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $724
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRU4
+CNSTU4 0
+EQU4 $726
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+INDIRU4
+CNSTU4 1
+SUBU4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+EQI4 $723
+LABELV $726
+LABELV $722
+endproc BotPrepareMatchString 8 12
+export BotFindMatch
+proc BotFindMatch 20 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRGP4 matchautomaton
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $728
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRLP4 8
+ADDRGP4 BotFindMatchLinear
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $727
+JUMPV
+LABELV $728
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotPrepareMatchString
+CALLV
+pop
+ADDRGP4 matchautomaton
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotMatchAutomatonSearch
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 matchtemplates
+INDIRP4
+ASGNP4
+ADDRGP4 $733
+JUMPV
+LABELV $730
+ADDRLP4 4
+INDIRP4
+INDIRU4
+ADDRFP4 8
+INDIRU4
+BANDU4
+CNSTU4 0
+NEU4 $734
+ADDRGP4 $731
+JUMPV
+LABELV $734
+ADDRGP4 matchautomaton
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotMatchTemplateCandidate
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $736
+ADDRGP4 $731
+JUMPV
+LABELV $736
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $738
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDP4
+CNSTI1 -1
+ASGNI1
+LABELV $739
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $738
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 StringsMatch
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $742
+ADDRFP4 4
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $727
+JUMPV
+LABELV $742
+LABELV $731
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $733
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $730
+CNSTI4 0
+RETI4
+LABELV $727
+endproc BotFindMatch 20 12
+export BotFindMatchLinear
+proc BotFindMatchLinear 12 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotPrepareMatchString
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 matchtemplates
+INDIRP4
+ASGNP4
+ADDRGP4 $748
+JUMPV
+LABELV $745
+ADDRLP4 4
+INDIRP4
+INDIRU4
+ADDRFP4 8
+INDIRU4
+BANDU4
+CNSTU4 0
+NEU4 $749
+ADDRGP4 $746
+JUMPV
+LABELV $749
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $751
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDP4
+CNSTI1 -1
+ASGNI1
+LABELV $752
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $751
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 StringsMatch
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $755
+ADDRFP4 4
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $744
+JUMPV
+LABELV $755
+LABELV $746
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $748
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $745
+CNSTI4 0
+RETI4
+LABELV $744
+endproc BotFindMatchLinear 12 8
+export BotMatchTemplatesContainsString
+proc BotMatchTemplatesContainsString 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 matchtemplates
+INDIRP4
+ASGNP4
+ADDRGP4 $761
+JUMPV
+LABELV $758
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $765
+JUMPV
+LABELV $762
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 2
+NEI4 $766
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $771
+JUMPV
+LABELV $768
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+INDIRU4
+CNSTU4 0
+NEU4 $772
+ADDRGP4 $770
+JUMPV
+LABELV $772
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $774
+CNSTI4 1
+RETI4
+ADDRGP4 $757
+JUMPV
+LABELV $774
+LABELV $769
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $771
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $768
+LABELV $770
+LABELV $766
+LABELV $763
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $765
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $762
+LABELV $759
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $761
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $758
+CNSTI4 0
+RETI4
+LABELV $757
+endproc BotMatchTemplatesContainsString 20 8
+export BotMatchVariable
+proc BotMatchVariable 8 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $779
+ADDRFP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $777
+LABELV $779
+CNSTI4 4
+ARGI4
+ADDRGP4 $780
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $781
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $776
+JUMPV
+LABELV $777
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+LTI4 $782
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 12
+INDIRI4
+GEI4 $784
+ADDRFP4 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $784
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $783
+JUMPV
+LABELV $782
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $781
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $783
+LABELV $776
+endproc BotMatchVariable 8 12
+export BotFindStringInList
+proc BotFindStringInList 8 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $790
+JUMPV
+LABELV $787
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $791
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $786
+JUMPV
+LABELV $791
+LABELV $788
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $790
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $787
+CNSTP4 0
+RETP4
+LABELV $786
+endproc BotFindStringInList 8 8
+export BotCheckChatMessageIntegrety
+proc BotCheckChatMessageIntegrety 304 16
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $795
+JUMPV
+LABELV $794
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 1
+NEI4 $797
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 276
+CNSTI4 114
+ASGNI4
+ADDRLP4 268
+INDIRI4
+ADDRLP4 276
+INDIRI4
+EQI4 $809
+ADDRLP4 268
+INDIRI4
+ADDRLP4 276
+INDIRI4
+LTI4 $799
+LABELV $823
+ADDRLP4 268
+INDIRI4
+CNSTI4 118
+EQI4 $802
+ADDRGP4 $799
+JUMPV
+LABELV $802
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $804
+JUMPV
+LABELV $803
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $804
+ADDRLP4 280
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $806
+ADDRLP4 280
+INDIRI4
+CNSTI4 1
+NEI4 $803
+LABELV $806
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $798
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $798
+JUMPV
+LABELV $809
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $813
+JUMPV
+LABELV $810
+ADDRLP4 280
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 280
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 280
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $811
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $813
+ADDRLP4 280
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $814
+ADDRLP4 280
+INDIRI4
+CNSTI4 1
+NEI4 $810
+LABELV $814
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $815
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $815
+ADDRLP4 8
+ARGP4
+ADDRLP4 284
+ADDRGP4 RandomString
+CALLP4
+ASGNP4
+ADDRLP4 284
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $798
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 288
+ADDRGP4 BotFindStringInList
+CALLP4
+ASGNP4
+ADDRLP4 288
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $798
+CNSTI4 3
+ARGI4
+ADDRGP4 $821
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 292
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 292
+INDIRU4
+CNSTU4 8
+ADDU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 296
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 264
+ADDRLP4 296
+INDIRP4
+ASGNP4
+ADDRLP4 300
+ADDRLP4 264
+INDIRP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+CNSTU4 8
+ADDP4
+ASGNP4
+ADDRLP4 264
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 264
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 264
+INDIRP4
+ASGNP4
+ADDRGP4 $798
+JUMPV
+LABELV $799
+CNSTI4 4
+ARGI4
+ADDRGP4 $822
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $798
+JUMPV
+LABELV $797
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $798
+LABELV $795
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $794
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $793
+endproc BotCheckChatMessageIntegrety 304 16
+export BotCheckInitialChatIntegrety
+proc BotCheckInitialChatIntegrety 24 8
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $828
+JUMPV
+LABELV $825
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $832
+JUMPV
+LABELV $829
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotCheckChatMessageIntegrety
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+LABELV $830
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $832
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $829
+LABELV $826
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $828
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $825
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $836
+JUMPV
+LABELV $833
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+LABELV $834
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $836
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $833
+LABELV $824
+endproc BotCheckInitialChatIntegrety 24 8
+export BotCheckReplyChatIntegrety
+proc BotCheckReplyChatIntegrety 24 8
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $841
+JUMPV
+LABELV $838
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $845
+JUMPV
+LABELV $842
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotCheckChatMessageIntegrety
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+LABELV $843
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $845
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $842
+LABELV $839
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $841
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $838
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $849
+JUMPV
+LABELV $846
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+LABELV $847
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $849
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $846
+LABELV $837
+endproc BotCheckReplyChatIntegrety 24 8
+export BotFreeReplyChat
+proc BotFreeReplyChat 32 4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $854
+JUMPV
+LABELV $851
+ADDRLP4 20
+ADDRLP4 16
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $858
+JUMPV
+LABELV $855
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $859
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeMatchPieces
+CALLV
+pop
+LABELV $859
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $861
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+LABELV $861
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+LABELV $856
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $858
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $855
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $866
+JUMPV
+LABELV $863
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+LABELV $864
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+LABELV $866
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $863
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+LABELV $852
+ADDRLP4 16
+ADDRLP4 20
+INDIRP4
+ASGNP4
+LABELV $854
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $851
+LABELV $850
+endproc BotFreeReplyChat 32 4
+export BotCheckValidReplyChatKeySet
+proc BotCheckValidReplyChatKeySet 60 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $871
+JUMPV
+LABELV $868
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+NEI4 $872
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 32
+INDIRI4
+EQI4 $874
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $879
+JUMPV
+LABELV $876
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+NEI4 $880
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $880
+LABELV $877
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $879
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $876
+ADDRGP4 $873
+JUMPV
+LABELV $874
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $873
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $873
+JUMPV
+LABELV $872
+ADDRLP4 32
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 36
+INDIRI4
+EQI4 $884
+ADDRLP4 32
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 36
+INDIRI4
+EQI4 $884
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $889
+JUMPV
+LABELV $886
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $890
+ADDRGP4 $887
+JUMPV
+LABELV $890
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $892
+ADDRGP4 $887
+JUMPV
+LABELV $892
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $894
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $899
+JUMPV
+LABELV $896
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 2
+NEI4 $900
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $905
+JUMPV
+LABELV $902
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+ADDRGP4 StringContains
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 -1
+EQI4 $906
+ADDRGP4 $904
+JUMPV
+LABELV $906
+LABELV $903
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $905
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $902
+LABELV $904
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $901
+ADDRGP4 $898
+JUMPV
+LABELV $900
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+NEI4 $910
+ADDRGP4 $898
+JUMPV
+LABELV $910
+LABELV $901
+LABELV $897
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $899
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $896
+LABELV $898
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $912
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $914
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 PC_SourceWarning
+CALLV
+pop
+LABELV $912
+LABELV $894
+LABELV $887
+ADDRLP4 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $889
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $886
+LABELV $884
+LABELV $873
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 44
+INDIRI4
+EQI4 $915
+ADDRLP4 40
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 44
+INDIRI4
+EQI4 $915
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $920
+JUMPV
+LABELV $917
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $921
+ADDRGP4 $918
+JUMPV
+LABELV $921
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $923
+ADDRGP4 $918
+JUMPV
+LABELV $923
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $925
+ADDRLP4 48
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 52
+ADDRGP4 StringContains
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 -1
+EQI4 $926
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $929
+ARGP4
+ADDRLP4 56
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 PC_SourceWarning
+CALLV
+pop
+ADDRGP4 $926
+JUMPV
+LABELV $925
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $930
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $935
+JUMPV
+LABELV $932
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 2
+NEI4 $936
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $941
+JUMPV
+LABELV $938
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+ADDRGP4 StringContains
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 -1
+EQI4 $942
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $944
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 PC_SourceWarning
+CALLV
+pop
+LABELV $942
+LABELV $939
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $941
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $938
+LABELV $936
+LABELV $933
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $935
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $932
+LABELV $930
+LABELV $926
+LABELV $918
+ADDRLP4 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $920
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $917
+LABELV $915
+LABELV $869
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $871
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $868
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $945
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $947
+ARGP4
+ADDRGP4 PC_SourceWarning
+CALLV
+pop
+LABELV $945
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $948
+ADDRLP4 24
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $948
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $950
+ARGP4
+ADDRGP4 PC_SourceWarning
+CALLV
+pop
+LABELV $948
+LABELV $867
+endproc BotCheckValidReplyChatKeySet 60 16
+export BotLoadReplyChat
+proc BotLoadReplyChat 1664 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $952
+CNSTP4 0
+RETP4
+ADDRGP4 $951
+JUMPV
+LABELV $952
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $267
+ARGP4
+ADDRLP4 1572
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1572
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $954
+CNSTI4 3
+ARGI4
+ADDRGP4 $270
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $951
+JUMPV
+LABELV $954
+ADDRLP4 272
+CNSTP4 0
+ASGNP4
+ADDRGP4 $957
+JUMPV
+LABELV $956
+ADDRLP4 276+16
+ARGP4
+ADDRGP4 $296
+ARGP4
+ADDRLP4 1576
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1576
+INDIRI4
+CNSTI4 0
+EQI4 $959
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $962
+ARGP4
+ADDRLP4 276+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeReplyChat
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $951
+JUMPV
+LABELV $959
+CNSTI4 20
+ARGI4
+ADDRLP4 1580
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 1580
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 272
+ADDRLP4 12
+INDIRP4
+ASGNP4
+LABELV $964
+CNSTI4 16
+ARGI4
+ADDRLP4 1584
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1584
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 12
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $969
+ARGP4
+ADDRLP4 1588
+ADDRGP4 PC_CheckTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1588
+INDIRI4
+CNSTI4 0
+EQI4 $967
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $968
+JUMPV
+LABELV $967
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $972
+ARGP4
+ADDRLP4 1596
+ADDRGP4 PC_CheckTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1596
+INDIRI4
+CNSTI4 0
+EQI4 $970
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $970
+LABELV $968
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $975
+ARGP4
+ADDRLP4 1604
+ADDRGP4 PC_CheckTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1604
+INDIRI4
+CNSTI4 0
+EQI4 $973
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $974
+JUMPV
+LABELV $973
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $978
+ARGP4
+ADDRLP4 1612
+ADDRGP4 PC_CheckTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1612
+INDIRI4
+CNSTI4 0
+EQI4 $976
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRGP4 $977
+JUMPV
+LABELV $976
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $981
+ARGP4
+ADDRLP4 1620
+ADDRGP4 PC_CheckTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1620
+INDIRI4
+CNSTI4 0
+EQI4 $979
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRGP4 $980
+JUMPV
+LABELV $979
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $984
+ARGP4
+ADDRLP4 1628
+ADDRGP4 PC_CheckTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1628
+INDIRI4
+CNSTI4 0
+EQI4 $982
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+ADDRGP4 $983
+JUMPV
+LABELV $982
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $306
+ARGP4
+ADDRLP4 1636
+ADDRGP4 PC_CheckTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1636
+INDIRI4
+CNSTI4 0
+EQI4 $985
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $321
+ARGP4
+ADDRLP4 1644
+ADDRGP4 BotLoadMatchPieces
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 1644
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $986
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeReplyChat
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $951
+JUMPV
+LABELV $985
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $991
+ARGP4
+ADDRLP4 1640
+ADDRGP4 PC_CheckTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1640
+INDIRI4
+CNSTI4 0
+EQI4 $989
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRLP4 1316
+ARGP4
+ADDRGP4 $781
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $992
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 276
+ARGP4
+ADDRLP4 1648
+ADDRGP4 PC_ExpectTokenType
+CALLI4
+ASGNI4
+ADDRLP4 1648
+INDIRI4
+CNSTI4 0
+NEI4 $995
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeReplyChat
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $951
+JUMPV
+LABELV $995
+ADDRLP4 1316
+ARGP4
+ADDRLP4 1652
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1652
+INDIRU4
+CNSTU4 0
+EQU4 $997
+ADDRLP4 1316
+ARGP4
+ADDRGP4 $999
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $997
+ADDRLP4 1316
+ARGP4
+ADDRLP4 276+16
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $993
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $320
+ARGP4
+ADDRLP4 1648
+ADDRGP4 PC_CheckTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1648
+INDIRI4
+CNSTI4 0
+NEI4 $992
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1003
+ARGP4
+ADDRLP4 1652
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1652
+INDIRI4
+CNSTI4 0
+NEI4 $1001
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeReplyChat
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $951
+JUMPV
+LABELV $1001
+ADDRLP4 1316
+ARGP4
+ADDRLP4 1656
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1656
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 1660
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 1660
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1316
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $990
+JUMPV
+LABELV $989
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 276
+ARGP4
+ADDRLP4 1648
+ADDRGP4 PC_ExpectTokenType
+CALLI4
+ASGNI4
+ADDRLP4 1648
+INDIRI4
+CNSTI4 0
+NEI4 $1004
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeReplyChat
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $951
+JUMPV
+LABELV $1004
+ADDRLP4 276+16
+ARGP4
+ADDRLP4 1652
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1652
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 1656
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 1656
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 276+16
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $990
+LABELV $986
+LABELV $983
+LABELV $980
+LABELV $977
+LABELV $974
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $320
+ARGP4
+ADDRGP4 PC_CheckTokenString
+CALLI4
+pop
+LABELV $965
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 1584
+ADDRGP4 PC_CheckTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1584
+INDIRI4
+CNSTI4 0
+EQI4 $964
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckValidReplyChatKeySet
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $468
+ARGP4
+ADDRLP4 1588
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1592
+CNSTI4 0
+ASGNI4
+ADDRLP4 1588
+INDIRI4
+ADDRLP4 1592
+INDIRI4
+EQI4 $1010
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 1592
+INDIRI4
+ARGI4
+ADDRLP4 276
+ARGP4
+ADDRLP4 1596
+ADDRGP4 PC_ExpectTokenType
+CALLI4
+ASGNI4
+ADDRLP4 1596
+INDIRI4
+CNSTI4 0
+NEI4 $1008
+LABELV $1010
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeReplyChat
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $951
+JUMPV
+LABELV $1008
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 276+12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $283
+ARGP4
+ADDRLP4 1600
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1600
+INDIRI4
+CNSTI4 0
+NEI4 $1012
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeReplyChat
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $951
+JUMPV
+LABELV $1012
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1015
+JUMPV
+LABELV $1014
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 1604
+ADDRGP4 BotLoadChatMessage
+CALLI4
+ASGNI4
+ADDRLP4 1604
+INDIRI4
+CNSTI4 0
+NEI4 $1017
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeReplyChat
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $951
+JUMPV
+LABELV $1017
+ADDRLP4 16
+ARGP4
+ADDRLP4 1608
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1608
+INDIRU4
+CNSTU4 12
+ADDU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ARGI4
+ADDRLP4 1612
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1612
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+CNSTU4 12
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 3256877056
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 1620
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 1620
+INDIRP4
+ADDRLP4 1620
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1015
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 1604
+ADDRGP4 PC_CheckTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1604
+INDIRI4
+CNSTI4 0
+EQI4 $1014
+LABELV $957
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 276
+ARGP4
+ADDRLP4 1576
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1576
+INDIRI4
+CNSTI4 0
+NEI4 $956
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 $340
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $1019
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckReplyChatIntegrety
+CALLV
+pop
+LABELV $1019
+ADDRLP4 272
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1022
+CNSTI4 1
+ARGI4
+ADDRGP4 $1024
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1022
+ADDRLP4 272
+INDIRP4
+RETP4
+LABELV $951
+endproc BotLoadReplyChat 1664 16
+export BotLoadInitialChat
+proc BotLoadInitialChat 1400 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 1324
+CNSTP4 0
+ASGNP4
+ADDRLP4 268
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 1332
+CNSTI4 0
+ASGNI4
+ADDRLP4 276
+ADDRLP4 1332
+INDIRI4
+ASGNI4
+ADDRLP4 1328
+ADDRLP4 1332
+INDIRI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 1332
+INDIRI4
+ASGNI4
+LABELV $1026
+ADDRLP4 1336
+CNSTI4 0
+ASGNI4
+ADDRLP4 272
+INDIRI4
+ADDRLP4 1336
+INDIRI4
+EQI4 $1030
+ADDRLP4 276
+INDIRI4
+ADDRLP4 1336
+INDIRI4
+EQI4 $1030
+ADDRLP4 276
+INDIRI4
+ARGI4
+ADDRLP4 1340
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1340
+INDIRP4
+ASGNP4
+LABELV $1030
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $267
+ARGP4
+ADDRLP4 1344
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1344
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1032
+CNSTI4 3
+ARGI4
+ADDRGP4 $270
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1025
+JUMPV
+LABELV $1032
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $1034
+ADDRLP4 1324
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+LABELV $1034
+ADDRLP4 276
+CNSTI4 4
+ASGNI4
+ADDRGP4 $1037
+JUMPV
+LABELV $1036
+ADDRLP4 280+16
+ARGP4
+ADDRGP4 $1042
+ARGP4
+ADDRLP4 1348
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1348
+INDIRI4
+CNSTI4 0
+NEI4 $1039
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 280
+ARGP4
+ADDRLP4 1352
+ADDRGP4 PC_ExpectTokenType
+CALLI4
+ASGNI4
+ADDRLP4 1352
+INDIRI4
+CNSTI4 0
+NEI4 $1043
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1025
+JUMPV
+LABELV $1043
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $283
+ARGP4
+ADDRLP4 1356
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1356
+INDIRI4
+CNSTI4 0
+NEI4 $1045
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1025
+JUMPV
+LABELV $1045
+ADDRLP4 280+16
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1360
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1360
+INDIRI4
+CNSTI4 0
+NEI4 $1047
+ADDRLP4 1328
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1051
+JUMPV
+LABELV $1050
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 280
+ARGP4
+ADDRLP4 1364
+ADDRGP4 PC_ExpectAnyToken
+CALLI4
+ASGNI4
+ADDRLP4 1364
+INDIRI4
+CNSTI4 0
+NEI4 $1053
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1025
+JUMPV
+LABELV $1053
+ADDRLP4 280+16
+ARGP4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 1368
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1368
+INDIRI4
+CNSTI4 0
+NEI4 $1055
+ADDRGP4 $1040
+JUMPV
+LABELV $1055
+ADDRLP4 280+16
+ARGP4
+ADDRGP4 $1061
+ARGP4
+ADDRLP4 1372
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1372
+INDIRI4
+CNSTI4 0
+EQI4 $1058
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1062
+ARGP4
+ADDRLP4 280+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1025
+JUMPV
+LABELV $1058
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 280
+ARGP4
+ADDRLP4 1376
+ADDRGP4 PC_ExpectTokenType
+CALLI4
+ASGNI4
+ADDRLP4 1376
+INDIRI4
+CNSTI4 0
+EQI4 $1066
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $283
+ARGP4
+ADDRLP4 1380
+ADDRGP4 PC_ExpectTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1380
+INDIRI4
+CNSTI4 0
+NEI4 $1064
+LABELV $1066
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1025
+JUMPV
+LABELV $1064
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $1067
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1067
+ADDRLP4 268
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+ADDRLP4 280+16
+ARGP4
+CNSTU4 32
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 268
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 268
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 1324
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 1324
+INDIRP4
+ADDRLP4 268
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTU4 44
+ADDP4
+ASGNP4
+LABELV $1067
+ADDRLP4 276
+ADDRLP4 276
+INDIRI4
+CVIU4 4
+CNSTU4 44
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $1071
+JUMPV
+LABELV $1070
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 1388
+ADDRGP4 BotLoadChatMessage
+CALLI4
+ASGNI4
+ADDRLP4 1388
+INDIRI4
+CNSTI4 0
+NEI4 $1073
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1025
+JUMPV
+LABELV $1073
+ADDRLP4 12
+ARGP4
+ADDRLP4 1392
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1384
+ADDRLP4 1392
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 1384
+ADDRLP4 1384
+INDIRU4
+CNSTU4 4
+ADDU4
+CNSTU4 1
+SUBU4
+CNSTU4 4294967292
+BANDU4
+ASGNU4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $1075
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1075
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 3256877056
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 268
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTU4 12
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+ADDRLP4 1384
+INDIRU4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 1396
+ADDRLP4 268
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 1396
+INDIRP4
+ADDRLP4 1396
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1075
+ADDRLP4 276
+ADDRLP4 276
+INDIRI4
+CVIU4 4
+ADDRLP4 1384
+INDIRU4
+CNSTU4 12
+ADDU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $1071
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 1384
+ADDRGP4 PC_CheckTokenString
+CALLI4
+ASGNI4
+ADDRLP4 1384
+INDIRI4
+CNSTI4 0
+EQI4 $1070
+LABELV $1051
+ADDRGP4 $1050
+JUMPV
+ADDRGP4 $1040
+JUMPV
+LABELV $1047
+ADDRLP4 1320
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1078
+JUMPV
+LABELV $1077
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 280
+ARGP4
+ADDRLP4 1364
+ADDRGP4 PC_ExpectAnyToken
+CALLI4
+ASGNI4
+ADDRLP4 1364
+INDIRI4
+CNSTI4 0
+NEI4 $1080
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1025
+JUMPV
+LABELV $1080
+ADDRLP4 280+16
+ARGP4
+ADDRGP4 $283
+ARGP4
+ADDRLP4 1368
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1368
+INDIRI4
+CNSTI4 0
+NEI4 $1082
+ADDRLP4 1320
+ADDRLP4 1320
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1083
+JUMPV
+LABELV $1082
+ADDRLP4 280+16
+ARGP4
+ADDRGP4 $289
+ARGP4
+ADDRLP4 1372
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1372
+INDIRI4
+CNSTI4 0
+NEI4 $1085
+ADDRLP4 1320
+ADDRLP4 1320
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1085
+LABELV $1083
+LABELV $1078
+ADDRLP4 1320
+INDIRI4
+CNSTI4 0
+NEI4 $1077
+ADDRGP4 $1040
+JUMPV
+LABELV $1039
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1088
+ARGP4
+ADDRLP4 280+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1025
+JUMPV
+LABELV $1040
+LABELV $1037
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 280
+ARGP4
+ADDRLP4 1348
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1348
+INDIRI4
+CNSTI4 0
+NEI4 $1036
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+ADDRLP4 1328
+INDIRI4
+CNSTI4 0
+NEI4 $1090
+CNSTI4 3
+ARGI4
+ADDRGP4 $1092
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1025
+JUMPV
+LABELV $1090
+LABELV $1027
+ADDRLP4 272
+ADDRLP4 272
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 2
+LTI4 $1026
+CNSTI4 0
+ARGI4
+ADDRGP4 $1093
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $1094
+ADDRLP4 1324
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckInitialChatIntegrety
+CALLV
+pop
+LABELV $1094
+ADDRLP4 1324
+INDIRP4
+RETP4
+LABELV $1025
+endproc BotLoadInitialChat 1400 16
+export BotFreeChatFile
+proc BotFreeChatFile 8 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotChatStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1098
+ADDRGP4 $1097
+JUMPV
+LABELV $1098
+ADDRLP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1100
+ADDRLP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+LABELV $1100
+ADDRLP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $1097
+endproc BotFreeChatFile 8 4
+export BotLoadChatFile
+proc BotLoadChatFile 24 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 BotChatStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1103
+CNSTI4 8
+RETI4
+ADDRGP4 $1102
+JUMPV
+LABELV $1103
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotFreeChatFile
+CALLV
+pop
+ADDRGP4 bot_reloadcharacters+12
+INDIRI4
+CNSTI4 0
+NEI4 $1105
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1108
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ichatdata
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1112
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+NEI4 $1109
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1112
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ichatdata
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1116
+ADDRGP4 $1109
+JUMPV
+LABELV $1116
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ichatdata
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1118
+ADDRGP4 $1109
+JUMPV
+LABELV $1118
+ADDRLP4 4
+INDIRP4
+CNSTI4 1068
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ichatdata
+ADDP4
+INDIRP4
+INDIRP4
+ASGNP4
+CNSTI4 0
+RETI4
+ADDRGP4 $1102
+JUMPV
+LABELV $1109
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1108
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+NEI4 $1120
+CNSTI4 4
+ARGI4
+ADDRGP4 $1122
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 8
+RETI4
+ADDRGP4 $1102
+JUMPV
+LABELV $1120
+LABELV $1105
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 BotLoadInitialChat
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1068
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1068
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1123
+CNSTI4 4
+ARGI4
+ADDRGP4 $1125
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 8
+RETI4
+ADDRGP4 $1102
+JUMPV
+LABELV $1123
+ADDRGP4 bot_reloadcharacters+12
+INDIRI4
+CNSTI4 0
+NEI4 $1126
+CNSTI4 132
+ARGI4
+ADDRLP4 20
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ichatdata
+ADDP4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ichatdata
+ADDP4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1068
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ichatdata
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ichatdata
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1126
+CNSTI4 0
+RETI4
+LABELV $1102
+endproc BotLoadChatFile 24 16
+export BotExpandChatMessage
+proc BotExpandChatMessage 316 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 284
+CNSTI4 0
+ASGNI4
+ADDRLP4 280
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 272
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRGP4 $1131
+JUMPV
+LABELV $1130
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 1
+NEI4 $1133
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 288
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 296
+CNSTI4 114
+ASGNI4
+ADDRLP4 288
+INDIRI4
+ADDRLP4 296
+INDIRI4
+EQI4 $1159
+ADDRLP4 288
+INDIRI4
+ADDRLP4 296
+INDIRI4
+LTI4 $1135
+LABELV $1174
+ADDRLP4 288
+INDIRI4
+CNSTI4 118
+EQI4 $1138
+ADDRGP4 $1135
+JUMPV
+LABELV $1138
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1140
+JUMPV
+LABELV $1139
+ADDRLP4 300
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 300
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 10
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 300
+INDIRP4
+INDIRI1
+CVII4 1
+ADDI4
+CNSTI4 48
+SUBI4
+ASGNI4
+LABELV $1140
+ADDRLP4 300
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $1142
+ADDRLP4 300
+INDIRI4
+CNSTI4 1
+NEI4 $1139
+LABELV $1142
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1143
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1143
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+LEI4 $1145
+CNSTI4 3
+ARGI4
+ADDRGP4 $1147
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1129
+JUMPV
+LABELV $1145
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 12
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+LTI4 $1134
+ADDRLP4 276
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 12
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRFP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1153
+JUMPV
+LABELV $1150
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 276
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $1151
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1153
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 12
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $1150
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1154
+ADDRLP4 16
+ARGP4
+ADDRFP4 16
+INDIRU4
+ARGU4
+ADDRGP4 BotReplaceReplySynonyms
+CALLV
+pop
+ADDRGP4 $1155
+JUMPV
+LABELV $1154
+ADDRLP4 16
+ARGP4
+ADDRFP4 16
+INDIRU4
+ARGU4
+ADDRGP4 BotReplaceSynonyms
+CALLV
+pop
+LABELV $1155
+ADDRLP4 16
+ARGP4
+ADDRLP4 308
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+ADDRLP4 308
+INDIRU4
+ADDU4
+CNSTU4 256
+LTU4 $1156
+CNSTI4 3
+ARGI4
+ADDRGP4 $1158
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1129
+JUMPV
+LABELV $1156
+ADDRLP4 12
+INDIRI4
+ADDRLP4 272
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 312
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+ADDRLP4 312
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $1134
+JUMPV
+LABELV $1159
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1163
+JUMPV
+LABELV $1160
+ADDRLP4 300
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 300
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 300
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $1161
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1163
+ADDRLP4 300
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $1164
+ADDRLP4 300
+INDIRI4
+CNSTI4 1
+NEI4 $1160
+LABELV $1164
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1165
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1165
+ADDRLP4 16
+ARGP4
+ADDRLP4 304
+ADDRGP4 RandomString
+CALLP4
+ASGNP4
+ADDRLP4 276
+ADDRLP4 304
+INDIRP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1167
+CNSTI4 3
+ARGI4
+ADDRGP4 $1169
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1129
+JUMPV
+LABELV $1167
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+ADDRLP4 308
+INDIRU4
+ADDU4
+CNSTU4 256
+LTU4 $1170
+CNSTI4 3
+ARGI4
+ADDRGP4 $1172
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1129
+JUMPV
+LABELV $1170
+ADDRLP4 12
+INDIRI4
+ADDRLP4 272
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+ADDRLP4 312
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 280
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1134
+JUMPV
+LABELV $1135
+CNSTI4 4
+ARGI4
+ADDRGP4 $1173
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $1134
+JUMPV
+LABELV $1133
+ADDRLP4 288
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 296
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 288
+INDIRI4
+ADDRLP4 296
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 292
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 292
+INDIRP4
+ADDRLP4 296
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 288
+INDIRI4
+ADDRLP4 272
+INDIRP4
+ADDP4
+ADDRLP4 292
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 12
+INDIRI4
+CNSTI4 256
+LTI4 $1175
+CNSTI4 3
+ARGI4
+ADDRGP4 $1172
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $1132
+JUMPV
+LABELV $1175
+LABELV $1134
+LABELV $1131
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1130
+LABELV $1132
+ADDRLP4 12
+INDIRI4
+ADDRLP4 272
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 272
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRGP4 BotReplaceWeightedSynonyms
+CALLV
+pop
+ADDRLP4 280
+INDIRI4
+RETI4
+LABELV $1129
+endproc BotExpandChatMessage 316 16
+export BotConstructChatMessage
+proc BotConstructChatMessage 264 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRU4
+ASGNU4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1178
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRU4
+ARGU4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRU4
+ARGU4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 260
+ADDRGP4 BotExpandChatMessage
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $1182
+ADDRGP4 $1180
+JUMPV
+LABELV $1182
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $1179
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $1178
+LABELV $1180
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $1184
+CNSTI4 2
+ARGI4
+ADDRGP4 $1186
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $1187
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1184
+LABELV $1177
+endproc BotConstructChatMessage 264 24
+export BotChooseInitialChatMessage
+proc BotChooseInitialChatMessage 48 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1192
+JUMPV
+LABELV $1189
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $1193
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1198
+JUMPV
+LABELV $1195
+ADDRLP4 32
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+LEF4 $1199
+ADDRGP4 $1196
+JUMPV
+LABELV $1199
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1196
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1198
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1195
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $1201
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1206
+JUMPV
+LABELV $1203
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+EQF4 $1209
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $1207
+LABELV $1209
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1207
+LABELV $1204
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1206
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1203
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1202
+ADDRLP4 20
+INDIRP4
+INDIRP4
+RETP4
+ADDRGP4 $1188
+JUMPV
+LABELV $1201
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1215
+JUMPV
+LABELV $1212
+ADDRLP4 36
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LEF4 $1216
+ADDRGP4 $1213
+JUMPV
+LABELV $1216
+ADDRLP4 40
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+GEI4 $1218
+ADDRLP4 44
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+RETP4
+ADDRGP4 $1188
+JUMPV
+LABELV $1218
+LABELV $1213
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1215
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1212
+LABELV $1202
+CNSTP4 0
+RETP4
+ADDRGP4 $1188
+JUMPV
+LABELV $1193
+LABELV $1190
+ADDRLP4 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1192
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1189
+CNSTP4 0
+RETP4
+LABELV $1188
+endproc BotChooseInitialChatMessage 48 8
+export BotNumInitialChats
+proc BotNumInitialChats 16 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 BotChatStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1221
+CNSTI4 0
+RETI4
+ADDRGP4 $1220
+JUMPV
+LABELV $1221
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 1068
+ADDP4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1226
+JUMPV
+LABELV $1223
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1227
+ADDRGP4 bot_testichat+12
+INDIRI4
+CNSTI4 0
+EQI4 $1229
+CNSTI4 1
+ARGI4
+ADDRGP4 $1232
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $1233
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1229
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $1220
+JUMPV
+LABELV $1227
+LABELV $1224
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1226
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1223
+CNSTI4 0
+RETI4
+LABELV $1220
+endproc BotNumInitialChats 16 16
+export BotInitialChat
+proc BotInitialChat 356 24
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 340
+ADDRGP4 BotChatStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 332
+ADDRLP4 340
+INDIRP4
+ASGNP4
+ADDRLP4 332
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1235
+ADDRGP4 $1234
+JUMPV
+LABELV $1235
+ADDRLP4 332
+INDIRP4
+CNSTI4 1068
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1237
+ADDRGP4 $1234
+JUMPV
+LABELV $1237
+ADDRLP4 332
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 BotChooseInitialChatMessage
+CALLP4
+ASGNP4
+ADDRLP4 336
+ADDRLP4 344
+INDIRP4
+ASGNP4
+ADDRLP4 336
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1239
+ADDRGP4 $1234
+JUMPV
+LABELV $1239
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 328
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 328
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1241
+ADDRLP4 0
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 0+264
+ADDRLP4 328
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0+264+4
+ADDRLP4 348
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 328
+ADDRLP4 328
+INDIRI4
+CVIU4 4
+ADDRLP4 352
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $1241
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1246
+ADDRLP4 0
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 0+264+8
+ADDRLP4 328
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0+264+8+4
+ADDRLP4 348
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 328
+ADDRLP4 328
+INDIRI4
+CVIU4 4
+ADDRLP4 352
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $1246
+ADDRFP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1253
+ADDRLP4 0
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 0+264+16
+ADDRLP4 328
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0+264+16+4
+ADDRLP4 348
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 328
+ADDRLP4 328
+INDIRI4
+CVIU4 4
+ADDRLP4 352
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $1253
+ADDRFP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1260
+ADDRLP4 0
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 0+264+24
+ADDRLP4 328
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0+264+24+4
+ADDRLP4 348
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 328
+ADDRLP4 328
+INDIRI4
+CVIU4 4
+ADDRLP4 352
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $1260
+ADDRFP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1267
+ADDRLP4 0
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 0+264+32
+ADDRLP4 328
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0+264+32+4
+ADDRLP4 348
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 328
+ADDRLP4 328
+INDIRI4
+CVIU4 4
+ADDRLP4 352
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $1267
+ADDRFP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1274
+ADDRLP4 0
+ARGP4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 0+264+40
+ADDRLP4 328
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0+264+40+4
+ADDRLP4 348
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 328
+ADDRLP4 328
+INDIRI4
+CVIU4 4
+ADDRLP4 352
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $1274
+ADDRFP4 36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1281
+ADDRLP4 0
+ARGP4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 0+264+48
+ADDRLP4 328
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0+264+48+4
+ADDRLP4 348
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 328
+ADDRLP4 328
+INDIRI4
+CVIU4 4
+ADDRLP4 352
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $1281
+ADDRFP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1288
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 0+264+56
+ADDRLP4 328
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 40
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0+264+56+4
+ADDRLP4 348
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $1288
+ADDRLP4 332
+INDIRP4
+ARGP4
+ADDRLP4 336
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRLP4 0
+ARGP4
+CNSTU4 0
+ARGU4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotConstructChatMessage
+CALLV
+pop
+LABELV $1234
+endproc BotInitialChat 356 24
+export BotPrintReplyChatKeys
+proc BotPrintReplyChatKeys 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRGP4 $296
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1299
+JUMPV
+LABELV $1296
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1300
+CNSTI4 1
+ARGI4
+ADDRGP4 $969
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $1301
+JUMPV
+LABELV $1300
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1302
+CNSTI4 1
+ARGI4
+ADDRGP4 $972
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1302
+LABELV $1301
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1304
+CNSTI4 1
+ARGI4
+ADDRGP4 $975
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $1305
+JUMPV
+LABELV $1304
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $1306
+CNSTI4 1
+ARGI4
+ADDRGP4 $978
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $1307
+JUMPV
+LABELV $1306
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $1308
+CNSTI4 1
+ARGI4
+ADDRGP4 $981
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $1309
+JUMPV
+LABELV $1308
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1310
+CNSTI4 1
+ARGI4
+ADDRGP4 $984
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $1311
+JUMPV
+LABELV $1310
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1312
+CNSTI4 1
+ARGI4
+ADDRGP4 $306
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1317
+JUMPV
+LABELV $1314
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 2
+NEI4 $1318
+CNSTI4 1
+ARGI4
+ADDRGP4 $1320
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $1319
+JUMPV
+LABELV $1318
+CNSTI4 1
+ARGI4
+ADDRGP4 $1321
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1319
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1322
+CNSTI4 1
+ARGI4
+ADDRGP4 $1324
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1322
+LABELV $1315
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1317
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1314
+CNSTI4 1
+ARGI4
+ADDRGP4 $321
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $1313
+JUMPV
+LABELV $1312
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $1325
+CNSTI4 1
+ARGI4
+ADDRGP4 $1320
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1325
+LABELV $1313
+LABELV $1311
+LABELV $1309
+LABELV $1307
+LABELV $1305
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1327
+CNSTI4 1
+ARGI4
+ADDRGP4 $1324
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $1328
+JUMPV
+LABELV $1327
+CNSTI4 1
+ARGI4
+ADDRGP4 $1329
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1328
+LABELV $1297
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1299
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1296
+CNSTI4 1
+ARGI4
+ADDRGP4 $1330
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1295
+endproc BotPrintReplyChatKeys 8 12
+export BotReplyChat
+proc BotReplyChat 752 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 704
+ADDRGP4 BotChatStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 704
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1332
+CNSTI4 0
+RETI4
+ADDRGP4 $1331
+JUMPV
+LABELV $1332
+ADDRLP4 364
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 328
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 364
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 360
+CNSTI4 -1
+ASGNI4
+ADDRLP4 696
+CNSTP4 0
+ASGNP4
+ADDRLP4 700
+CNSTP4 0
+ASGNP4
+ADDRLP4 20
+ADDRGP4 replychats
+INDIRP4
+ASGNP4
+ADDRGP4 $1337
+JUMPV
+LABELV $1334
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1341
+JUMPV
+LABELV $1338
+ADDRLP4 708
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 708
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 708
+INDIRI4
+EQI4 $1342
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 716
+ADDRGP4 StringContains
+CALLI4
+ASGNI4
+ADDRLP4 716
+INDIRI4
+CNSTI4 -1
+EQI4 $1345
+ADDRLP4 712
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1346
+JUMPV
+LABELV $1345
+ADDRLP4 712
+CNSTI4 0
+ASGNI4
+LABELV $1346
+ADDRLP4 4
+ADDRLP4 712
+INDIRI4
+ASGNI4
+ADDRGP4 $1343
+JUMPV
+LABELV $1342
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1347
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 724
+ADDRGP4 StringContains
+CALLI4
+ASGNI4
+ADDRLP4 724
+INDIRI4
+CNSTI4 -1
+EQI4 $1350
+ADDRLP4 720
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1351
+JUMPV
+LABELV $1350
+ADDRLP4 720
+CNSTI4 0
+ASGNI4
+LABELV $1351
+ADDRLP4 4
+ADDRLP4 720
+INDIRI4
+ASGNI4
+ADDRGP4 $1348
+JUMPV
+LABELV $1347
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $1352
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+NEI4 $1355
+ADDRLP4 728
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1356
+JUMPV
+LABELV $1355
+ADDRLP4 728
+CNSTI4 0
+ASGNI4
+LABELV $1356
+ADDRLP4 4
+ADDRLP4 728
+INDIRI4
+ASGNI4
+ADDRGP4 $1353
+JUMPV
+LABELV $1352
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $1357
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 2
+NEI4 $1360
+ADDRLP4 732
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1361
+JUMPV
+LABELV $1360
+ADDRLP4 732
+CNSTI4 0
+ASGNI4
+LABELV $1361
+ADDRLP4 4
+ADDRLP4 732
+INDIRI4
+ASGNI4
+ADDRGP4 $1358
+JUMPV
+LABELV $1357
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1362
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1365
+ADDRLP4 736
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1366
+JUMPV
+LABELV $1365
+ADDRLP4 736
+CNSTI4 0
+ASGNI4
+LABELV $1366
+ADDRLP4 4
+ADDRLP4 736
+INDIRI4
+ASGNI4
+ADDRGP4 $1363
+JUMPV
+LABELV $1362
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1367
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 364
+ARGP4
+ADDRLP4 740
+ADDRGP4 StringsMatch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 740
+INDIRI4
+ASGNI4
+ADDRGP4 $1368
+JUMPV
+LABELV $1367
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $1369
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 748
+ADDRGP4 StringContainsWord
+CALLP4
+ASGNP4
+ADDRLP4 748
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1372
+ADDRLP4 744
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1373
+JUMPV
+LABELV $1372
+ADDRLP4 744
+CNSTI4 0
+ASGNI4
+LABELV $1373
+ADDRLP4 4
+ADDRLP4 744
+INDIRI4
+ASGNI4
+LABELV $1369
+LABELV $1368
+LABELV $1363
+LABELV $1358
+LABELV $1353
+LABELV $1348
+LABELV $1343
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1374
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1375
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1340
+JUMPV
+LABELV $1374
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1378
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1379
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1340
+JUMPV
+LABELV $1378
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1382
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $1382
+LABELV $1379
+LABELV $1375
+LABELV $1339
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1341
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1338
+LABELV $1340
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1384
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 360
+INDIRI4
+CVIF4 4
+LEF4 $1386
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1391
+JUMPV
+LABELV $1388
+ADDRLP4 708
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 708
+INDIRF4
+LEF4 $1392
+ADDRGP4 $1389
+JUMPV
+LABELV $1392
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1389
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1391
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1388
+ADDRLP4 708
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 708
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1397
+JUMPV
+LABELV $1394
+ADDRLP4 712
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 712
+INDIRI4
+ASGNI4
+ADDRLP4 712
+INDIRI4
+CNSTI4 0
+GEI4 $1398
+ADDRGP4 $1396
+JUMPV
+LABELV $1398
+ADDRLP4 716
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 716
+INDIRF4
+LEF4 $1400
+LABELV $1400
+LABELV $1395
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1397
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1394
+LABELV $1396
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1402
+ADDRLP4 32
+ARGP4
+ADDRLP4 364
+ARGP4
+CNSTU4 328
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 696
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 700
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 360
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $1402
+LABELV $1386
+LABELV $1384
+LABELV $1335
+ADDRLP4 20
+ADDRLP4 20
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1337
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1334
+ADDRLP4 696
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1404
+ADDRLP4 32
+ARGP4
+ADDRLP4 708
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 692
+ADDRLP4 708
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1406
+ADDRLP4 32
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 32+264
+ADDRLP4 692
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 712
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 32+264+4
+ADDRLP4 712
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 716
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 692
+ADDRLP4 692
+INDIRI4
+CVIU4 4
+ADDRLP4 716
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $1406
+ADDRFP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1411
+ADDRLP4 32
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 32+264+8
+ADDRLP4 692
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 712
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 32+264+8+4
+ADDRLP4 712
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 716
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 692
+ADDRLP4 692
+INDIRI4
+CVIU4 4
+ADDRLP4 716
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $1411
+ADDRFP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1418
+ADDRLP4 32
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 32+264+16
+ADDRLP4 692
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 712
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 32+264+16+4
+ADDRLP4 712
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 716
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 692
+ADDRLP4 692
+INDIRI4
+CVIU4 4
+ADDRLP4 716
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $1418
+ADDRFP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1425
+ADDRLP4 32
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 32+264+24
+ADDRLP4 692
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 712
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 32+264+24+4
+ADDRLP4 712
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 716
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 692
+ADDRLP4 692
+INDIRI4
+CVIU4 4
+ADDRLP4 716
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $1425
+ADDRFP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1432
+ADDRLP4 32
+ARGP4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 32+264+32
+ADDRLP4 692
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 712
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 32+264+32+4
+ADDRLP4 712
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 32
+INDIRP4
+ARGP4
+ADDRLP4 716
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 692
+ADDRLP4 692
+INDIRI4
+CVIU4 4
+ADDRLP4 716
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $1432
+ADDRFP4 36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1439
+ADDRLP4 32
+ARGP4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 32+264+40
+ADDRLP4 692
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRLP4 712
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 32+264+40+4
+ADDRLP4 712
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 36
+INDIRP4
+ARGP4
+ADDRLP4 716
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 692
+ADDRLP4 692
+INDIRI4
+CVIU4 4
+ADDRLP4 716
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $1439
+ADDRFP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1446
+ADDRLP4 32
+ARGP4
+ADDRFP4 40
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 32+264+48
+ADDRLP4 692
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 40
+INDIRP4
+ARGP4
+ADDRLP4 712
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 32+264+48+4
+ADDRLP4 712
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRFP4 40
+INDIRP4
+ARGP4
+ADDRLP4 716
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 692
+ADDRLP4 692
+INDIRI4
+CVIU4 4
+ADDRLP4 716
+INDIRU4
+ADDU4
+CVUI4 4
+ASGNI4
+LABELV $1446
+ADDRFP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1453
+ADDRLP4 32
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 32+264+56
+ADDRLP4 692
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRLP4 712
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 32+264+56+4
+ADDRLP4 712
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $1453
+ADDRGP4 bot_testrchat+12
+INDIRI4
+CNSTI4 0
+EQI4 $1460
+ADDRLP4 8
+ADDRLP4 700
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1466
+JUMPV
+LABELV $1463
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRLP4 32
+ARGP4
+ADDRFP4 12
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotConstructChatMessage
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 BotRemoveTildes
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $1187
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1464
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1466
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1463
+ADDRGP4 $1461
+JUMPV
+LABELV $1460
+ADDRLP4 712
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 696
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 712
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 696
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRLP4 32
+ARGP4
+ADDRFP4 12
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotConstructChatMessage
+CALLV
+pop
+LABELV $1461
+CNSTI4 1
+RETI4
+ADDRGP4 $1331
+JUMPV
+LABELV $1404
+CNSTI4 0
+RETI4
+LABELV $1331
+endproc BotReplyChat 752 24
+export BotChatLength
+proc BotChatLength 12 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotChatStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1468
+CNSTI4 0
+RETI4
+ADDRGP4 $1467
+JUMPV
+LABELV $1468
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+INDIRU4
+CVUI4 4
+RETI4
+LABELV $1467
+endproc BotChatLength 12 4
+export BotEnterChat
+proc BotEnterChat 28 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotChatStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1471
+ADDRGP4 $1470
+JUMPV
+LABELV $1471
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+INDIRU4
+CNSTU4 0
+EQU4 $1473
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 BotRemoveTildes
+CALLV
+pop
+ADDRGP4 bot_testichat+12
+INDIRI4
+CNSTI4 0
+EQI4 $1475
+CNSTI4 1
+ARGI4
+ADDRGP4 $1187
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $1476
+JUMPV
+LABELV $1475
+ADDRLP4 12
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $1480
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $1482
+ADDRGP4 $1478
+JUMPV
+LABELV $1480
+ADDRGP4 $1481
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_ClientCommand
+CALLV
+pop
+ADDRGP4 $1479
+JUMPV
+LABELV $1482
+ADDRGP4 $1483
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_ClientCommand
+CALLV
+pop
+ADDRGP4 $1479
+JUMPV
+LABELV $1478
+ADDRGP4 $1484
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_ClientCommand
+CALLV
+pop
+LABELV $1479
+LABELV $1476
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 $781
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $1473
+LABELV $1470
+endproc BotEnterChat 28 12
+export BotGetChatMessage
+proc BotGetChatMessage 8 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotChatStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1486
+ADDRGP4 $1485
+JUMPV
+LABELV $1486
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 BotRemoveTildes
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 $781
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $1485
+endproc BotGetChatMessage 8 12
+export BotSetChatGender
+proc BotSetChatGender 12 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotChatStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1489
+ADDRGP4 $1488
+JUMPV
+LABELV $1489
+ADDRLP4 8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $1493
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+EQI4 $1494
+ADDRGP4 $1491
+JUMPV
+LABELV $1493
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1492
+JUMPV
+LABELV $1494
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1492
+JUMPV
+LABELV $1491
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1492
+LABELV $1488
+endproc BotSetChatGender 12 4
+export BotSetChatName
+proc BotSetChatName 8 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotChatStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1496
+ADDRGP4 $1495
+JUMPV
+LABELV $1496
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 32
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTU4 32
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+CNSTU4 31
+ADDI4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $1495
+endproc BotSetChatName 8 12
+export BotResetChatAI
+proc BotResetChatAI 8 0
+ADDRLP4 4
+ADDRGP4 replychats
+INDIRP4
+ASGNP4
+ADDRGP4 $1502
+JUMPV
+LABELV $1499
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1506
+JUMPV
+LABELV $1503
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1504
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1506
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1503
+LABELV $1500
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1502
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1499
+LABELV $1498
+endproc BotResetChatAI 8 0
+export BotAllocChatState
+proc BotAllocChatState 8 4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1508
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botchatstates
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1512
+CNSTI4 1072
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botchatstates
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1507
+JUMPV
+LABELV $1512
+LABELV $1509
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LEI4 $1508
+CNSTI4 0
+RETI4
+LABELV $1507
+endproc BotAllocChatState 8 4
+export BotFreeChatState
+proc BotFreeChatState 296 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $1517
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LEI4 $1515
+LABELV $1517
+CNSTI4 4
+ARGI4
+ADDRGP4 $67
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $1514
+JUMPV
+LABELV $1515
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botchatstates
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1518
+CNSTI4 4
+ARGI4
+ADDRGP4 $70
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $1514
+JUMPV
+LABELV $1518
+ADDRGP4 bot_reloadcharacters+12
+INDIRI4
+CNSTI4 0
+EQI4 $1520
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotFreeChatFile
+CALLV
+pop
+LABELV $1520
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 288
+ADDRGP4 BotNextConsoleMessage
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRGP4 $1526
+JUMPV
+LABELV $1523
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotRemoveConsoleMessage
+CALLV
+pop
+LABELV $1524
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 292
+ADDRGP4 BotNextConsoleMessage
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 292
+INDIRI4
+ASGNI4
+LABELV $1526
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1523
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botchatstates
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botchatstates
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $1514
+endproc BotFreeChatState 296 12
+export BotSetupChatAI
+proc BotSetupChatAI 16 4
+ADDRGP4 $1528
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotLoadSynonyms
+CALLP4
+ASGNP4
+ADDRGP4 synonyms
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1529
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotLoadRandomStrings
+CALLP4
+ASGNP4
+ADDRGP4 randomstrings
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $1530
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotLoadMatchTemplates
+CALLP4
+ASGNP4
+ADDRGP4 matchtemplates
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+NEI4 $1531
+ADDRGP4 $1534
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotLoadReplyChat
+CALLP4
+ASGNP4
+ADDRGP4 replychats
+ADDRLP4 12
+INDIRP4
+ASGNP4
+LABELV $1531
+ADDRGP4 InitConsoleMessageHeap
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $1527
+endproc BotSetupChatAI 16 4
+export BotShutdownChatAI
+proc BotShutdownChatAI 8 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1536
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botchatstates
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1540
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotFreeChatState
+CALLV
+pop
+LABELV $1540
+LABELV $1537
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1536
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1542
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ichatdata
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1546
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ichatdata
+ADDP4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ichatdata
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ichatdata
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $1546
+LABELV $1543
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1542
+ADDRGP4 consolemessageheap
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 286720
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRGP4 activeconsolemessages
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 freeconsolemessages
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 matchtemplates
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1548
+ADDRGP4 matchtemplates
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeMatchTemplates
+CALLV
+pop
+LABELV $1548
+ADDRGP4 matchtemplates
+CNSTP4 0
+ASGNP4
+ADDRGP4 matchautomaton
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeMatchAutomaton
+CALLV
+pop
+ADDRGP4 matchautomaton
+CNSTP4 0
+ASGNP4
+ADDRGP4 randomstrings
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1550
+ADDRGP4 randomstrings
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+LABELV $1550
+ADDRGP4 randomstrings
+CNSTP4 0
+ASGNP4
+ADDRGP4 synonyms
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1552
+ADDRGP4 synonyms
+INDIRP4
+ARGP4
+ADDRGP4 trap_HeapFree
+CALLV
+pop
+LABELV $1552
+ADDRGP4 synonyms
+CNSTP4 0
+ASGNP4
+ADDRGP4 replychats
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1554
+ADDRGP4 replychats
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeReplyChat
+CALLV
+pop
+LABELV $1554
+ADDRGP4 replychats
+CNSTP4 0
+ASGNP4
+LABELV $1535
+endproc BotShutdownChatAI 8 12
+bss
+export consolemessageheap
+align 4
+LABELV consolemessageheap
+skip 286720
+export botchatstates
+align 4
+LABELV botchatstates
+skip 260
+export ichatdata
+align 4
+LABELV ichatdata
+skip 256
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotTeamAI
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import neutralobelisk
+import blueobelisk
+import redobelisk
+import ctf_neutralflag
+import ctf_blueflag
+import ctf_redflag
+import bot_offhandgrapple
+import bot_droppedweight
+import bot_challenge
+import bot_testrchat
+import bot_testichat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxplayers
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import PlayerOnSameTeamFromName
+import PlayerFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotEnemyCubeCarrierVisible
+import BotTeamCubeCarrierVisible
+import BotHarvesterRetreatGoals
+import BotHarvesterSeekGoals
+import BotGoHarvest
+import BotObeliskRetreatGoals
+import BotObeliskSeekGoals
+import Bot1FCTFRetreatGoals
+import Bot1FCTFSeekGoals
+import BotHarvesterCarryingCubes
+import Bot1FCTFCarryingFlag
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckBlockedTeammates
+import BotCheckAttack
+import BotAimAtEnemy
+import BotVisibilityStats
+import BotEndVisibilityFrame
+import BotBeginVisibilityFrame
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotCountTeamMates
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import BotCanCamp
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanGrapple
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import EasyPlayerName
+import PlayerName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityHasKamikaze
+import EntityIsShooting
+import SenseCarriesCubes
+import SenseIsInvisible
+import EntityIsInvisible
+import PowerupsCarryFlag
+import PlayerCarriesFlag
+import PlayerIsDead
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotPlayerStateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import bot_reloadcharacters
+import bot_showteamgoals
+import bot_shownodechanges
+import bot_developer
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetPlayerState
+import BotAI_DebugLineShow
+import BotAI_DebugLineDelete
+import BotAI_DebugLineCreate
+import BotAI_InPVS
+import BotAI_PointContents
+import BotAI_EntityTrace
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotLibVarGetValue
+import BotNextEntity
+import BotSense
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotInitPhysicsSettings
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotRoutingAreaChanged
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotPrepareItemWeights
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import GetBotLibAPI
+import g_instagib
+import g_playerCapsule
+import g_proxMineTimeout
+import g_singlePlayer
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGamePlayers
+import g_maxplayers
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import trap_AAS_DropToFloor
+import trap_AAS_HorizontalVelocityForJump
+import trap_AAS_AgainstLadder
+import trap_AAS_JumpReachRunStart
+import trap_AAS_Swimming
+import trap_AAS_OnGround
+import trap_AAS_PredictPlayerMovement
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaTravelTime
+import trap_AAS_EnableRoutingArea
+import trap_AAS_RandomGoalArea
+import trap_AAS_ReachabilityFromNum
+import trap_AAS_NextAreaReachability
+import trap_AAS_AreaContentsTravelFlags
+import trap_AAS_TravelFlagForType
+import trap_AAS_AreaDoNotEnter
+import trap_AAS_AreaJumpPad
+import trap_AAS_AreaLadder
+import trap_AAS_AreaGrounded
+import trap_AAS_AreaSlime
+import trap_AAS_AreaLava
+import trap_AAS_AreaLiquid
+import trap_AAS_AreaSwim
+import trap_AAS_AreaCrouch
+import trap_AAS_AreaGroundFaceArea
+import trap_AAS_NextModelReachability
+import trap_AAS_BestReachableFromJumpPadArea
+import trap_AAS_BestReachableArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_TracePlayerBBox
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_FloodAreas
+import trap_AAS_ShowReachableAreas
+import trap_AAS_ShowReachability
+import trap_AAS_DrawArrow
+import trap_AAS_PrintTravelType
+import trap_AAS_DrawCross
+import trap_AAS_ShowAreaPolygons
+import trap_AAS_ShowArea
+import trap_AAS_ShowFace
+import trap_AAS_ShowBoundingBox
+import trap_AAS_DrawPlaneCross
+import trap_AAS_DrawPermanentCross
+import trap_AAS_PermanentLine
+import trap_AAS_DebugLine
+import trap_AAS_ClearShownPolygons
+import trap_AAS_ClearShownDebugLines
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_Loaded
+import trap_AAS_PointInsideArea
+import trap_AAS_BBoxReachabilityAreas
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_RegisterModel
+import trap_DebugPolygonDelete
+import trap_DebugPolygonShow
+import trap_DebugPolygonCreate
+import trap_ClientCommand
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_ClipToEntitiesCapsule
+import trap_ClipToEntities
+import trap_TraceCapsule
+import trap_Trace
+import trap_GetBrushBounds
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_SetConfigstringRestrictions
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommandEx
+import trap_DropPlayer
+import trap_SetNetFields
+import trap_LocateGameData
+import Pickup_Team
+import Svcmd_TeamInfoStats_f
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_BuildLocationTree
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotWeightBench_f
+import Svcmd_BotThinkReport_f
+import Svcmd_BotMatchBench_f
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownPlayer
+import BotAISetupPlayer
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import G_BotInitBotLib
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBotComplete
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunPlayer
+import PlayerEndFrame
+import PlayerThink
+import PlayerHandicap
+import ClientCommand
+import PlayerBegin
+import PlayerDisconnect
+import PlayerUserinfoChanged
+import PlayerConnect
+import G_Error
+import G_Printf
+import G_DPrintf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MovePlayerToIntermission
+import StringIsInteger
+import ConcatArgs
+import G_ScoreboardChanged
+import DeathmatchScoreboardMessage
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import G_RegisterCommands
+import G_ConsoleCompleteArgument
+import G_ConsoleCommand
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import PlayerSpawn
+import InitBodyQue
+import BeginIntermission
+import PlayerRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetPlayerViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossPlayerCubes
+import TossPlayerPersistantPowerups
+import TossPlayerGametypeItems
+import TossPlayerItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_SetBrushModel
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import trap_SendServerCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import FinishSpawningItem
+import G_SpawnItem
+import LaunchItem
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1534
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 46
+byte 1 99
+byte 1 0
+align 1
+LABELV $1530
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 46
+byte 1 99
+byte 1 0
+align 1
+LABELV $1529
+byte 1 114
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 99
+byte 1 0
+align 1
+LABELV $1528
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 0
+align 1
+LABELV $1484
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1483
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1481
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1330
+byte 1 123
+byte 1 10
+byte 1 0
+align 1
+LABELV $1329
+byte 1 93
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $1324
+byte 1 44
+byte 1 32
+byte 1 0
+align 1
+LABELV $1321
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1320
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $1233
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $1232
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1187
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1186
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1173
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 99
+byte 1 116
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $1172
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 99
+byte 1 116
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $1169
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 99
+byte 1 116
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1158
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 99
+byte 1 116
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $1147
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 99
+byte 1 116
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1125
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1122
+byte 1 105
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 59
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1093
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1092
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1088
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1062
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1061
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $1042
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $1024
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1003
+byte 1 62
+byte 1 0
+align 1
+LABELV $999
+byte 1 92
+byte 1 0
+align 1
+LABELV $991
+byte 1 60
+byte 1 0
+align 1
+LABELV $984
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $981
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $978
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $975
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $972
+byte 1 33
+byte 1 0
+align 1
+LABELV $969
+byte 1 38
+byte 1 0
+align 1
+LABELV $962
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 91
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $950
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 40
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 112
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $947
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 38
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 33
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 0
+align 1
+LABELV $944
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 32
+byte 1 33
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $929
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 32
+byte 1 33
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $914
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 38
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 0
+align 1
+LABELV $822
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $821
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 123
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 125
+byte 1 32
+byte 1 47
+byte 1 47
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 32
+byte 1 82
+byte 1 65
+byte 1 78
+byte 1 68
+byte 1 79
+byte 1 77
+byte 1 13
+byte 1 10
+byte 1 0
+align 1
+LABELV $781
+byte 1 0
+align 1
+LABELV $780
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 77
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 86
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $642
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 44
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $541
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $538
+byte 1 124
+byte 1 0
+align 1
+LABELV $516
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 106
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $513
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $468
+byte 1 61
+byte 1 0
+align 1
+LABELV $458
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $439
+byte 1 59
+byte 1 0
+align 1
+LABELV $435
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $433
+byte 1 37
+byte 1 99
+byte 1 114
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 99
+byte 1 0
+align 1
+LABELV $427
+byte 1 37
+byte 1 99
+byte 1 118
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 99
+byte 1 0
+align 1
+LABELV $420
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $340
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $339
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 125
+byte 1 0
+align 1
+LABELV $335
+byte 1 117
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $334
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 121
+byte 1 109
+byte 1 32
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $329
+byte 1 93
+byte 1 0
+align 1
+LABELV $321
+byte 1 41
+byte 1 0
+align 1
+LABELV $320
+byte 1 44
+byte 1 0
+align 1
+LABELV $311
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $306
+byte 1 40
+byte 1 0
+align 1
+LABELV $296
+byte 1 91
+byte 1 0
+align 1
+LABELV $292
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 125
+byte 1 0
+align 1
+LABELV $289
+byte 1 125
+byte 1 0
+align 1
+LABELV $283
+byte 1 123
+byte 1 0
+align 1
+LABELV $280
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 51
+byte 1 50
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $270
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $267
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $136
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $133
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $70
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $67
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
@@ -0,0 +1,33705 @@
+export BotSetUserInfo
+code
+proc BotSetUserInfo 1024 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 PlayerUserinfoChanged
+CALLV
+pop
+LABELV $62
+endproc BotSetUserInfo 1024 12
+export BotCTFCarryingFlag
+proc BotCTFCarryingFlag 0 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+EQI4 $64
+CNSTI4 0
+RETI4
+ADDRGP4 $63
+JUMPV
+LABELV $64
+ADDRFP4 0
+INDIRP4
+CNSTI4 17380
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $66
+CNSTI4 1
+RETI4
+ADDRGP4 $63
+JUMPV
+LABELV $66
+ADDRFP4 0
+INDIRP4
+CNSTI4 17384
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $68
+CNSTI4 2
+RETI4
+ADDRGP4 $63
+JUMPV
+LABELV $68
+CNSTI4 0
+RETI4
+LABELV $63
+endproc BotCTFCarryingFlag 0 0
+export BotTeam
+proc BotTeam 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $73
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $71
+LABELV $73
+CNSTI4 0
+RETI4
+ADDRGP4 $70
+JUMPV
+LABELV $71
+CNSTI4 1596
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $74
+CNSTI4 1
+RETI4
+ADDRGP4 $70
+JUMPV
+LABELV $74
+CNSTI4 1596
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 636
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $76
+CNSTI4 2
+RETI4
+ADDRGP4 $70
+JUMPV
+LABELV $76
+CNSTI4 0
+RETI4
+LABELV $70
+endproc BotTeam 4 0
+export BotOppositeTeam
+proc BotOppositeTeam 12 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $82
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $83
+ADDRGP4 $79
+JUMPV
+LABELV $82
+CNSTI4 2
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $83
+CNSTI4 1
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $79
+CNSTI4 0
+RETI4
+LABELV $78
+endproc BotOppositeTeam 12 4
+export BotEnemyFlag
+proc BotEnemyFlag 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $85
+ADDRGP4 ctf_blueflag
+RETP4
+ADDRGP4 $84
+JUMPV
+LABELV $85
+ADDRGP4 ctf_redflag
+RETP4
+LABELV $84
+endproc BotEnemyFlag 4 4
+export BotTeamFlag
+proc BotTeamFlag 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $88
+ADDRGP4 ctf_redflag
+RETP4
+ADDRGP4 $87
+JUMPV
+LABELV $88
+ADDRGP4 ctf_blueflag
+RETP4
+LABELV $87
+endproc BotTeamFlag 4 4
+export EntityIsDead
+proc EntityIsDead 4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 PlayerIsDead
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $90
+endproc EntityIsDead 4 4
+export PlayerIsDead
+proc PlayerIsDead 12 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $92
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $92
+ADDRLP4 0
+CNSTI4 728
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $96
+ADDRLP4 8
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $94
+LABELV $96
+CNSTI4 0
+RETI4
+ADDRGP4 $91
+JUMPV
+LABELV $94
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $97
+CNSTI4 1
+RETI4
+ADDRGP4 $91
+JUMPV
+LABELV $97
+LABELV $92
+CNSTI4 0
+RETI4
+LABELV $91
+endproc PlayerIsDead 12 0
+export EntityCarriesFlag
+proc EntityCarriesFlag 4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 PowerupsCarryFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $99
+endproc EntityCarriesFlag 4 4
+export PlayerCarriesFlag
+proc PlayerCarriesFlag 4 4
+CNSTI4 728
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+84+228
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 PowerupsCarryFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $100
+endproc PlayerCarriesFlag 4 4
+export PowerupsCarryFlag
+proc PowerupsCarryFlag 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $104
+CNSTI4 1
+RETI4
+ADDRGP4 $103
+JUMPV
+LABELV $104
+ADDRFP4 0
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $106
+CNSTI4 1
+RETI4
+ADDRGP4 $103
+JUMPV
+LABELV $106
+ADDRFP4 0
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $108
+CNSTI4 1
+RETI4
+ADDRGP4 $103
+JUMPV
+LABELV $108
+CNSTI4 0
+RETI4
+LABELV $103
+endproc PowerupsCarryFlag 0 0
+export EntityIsShooting
+proc EntityIsShooting 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $111
+CNSTI4 1
+RETI4
+ADDRGP4 $110
+JUMPV
+LABELV $111
+CNSTI4 0
+RETI4
+LABELV $110
+endproc EntityIsShooting 0 0
+export EntityIsChatting
+proc EntityIsChatting 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $114
+CNSTI4 1
+RETI4
+ADDRGP4 $113
+JUMPV
+LABELV $114
+CNSTI4 0
+RETI4
+LABELV $113
+endproc EntityIsChatting 0 0
+export EntityHasQuad
+proc EntityHasQuad 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $117
+CNSTI4 1
+RETI4
+ADDRGP4 $116
+JUMPV
+LABELV $117
+CNSTI4 0
+RETI4
+LABELV $116
+endproc EntityHasQuad 0 0
+export EntityHasKamikaze
+proc EntityHasKamikaze 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $120
+CNSTI4 1
+RETI4
+ADDRGP4 $119
+JUMPV
+LABELV $120
+CNSTI4 0
+RETI4
+LABELV $119
+endproc EntityHasKamikaze 0 0
+export EntityCarriesCubes
+proc EntityCarriesCubes 8 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 SenseCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $122
+endproc EntityCarriesCubes 8 4
+export SenseCarriesCubes
+proc SenseCarriesCubes 0 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+EQI4 $124
+CNSTI4 0
+RETI4
+ADDRGP4 $123
+JUMPV
+LABELV $124
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $126
+CNSTI4 1
+RETI4
+ADDRGP4 $123
+JUMPV
+LABELV $126
+CNSTI4 0
+RETI4
+LABELV $123
+endproc SenseCarriesCubes 0 0
+export EntityIsInvisible
+proc EntityIsInvisible 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $129
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $131
+CNSTI4 0
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $131
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $133
+CNSTI4 0
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $133
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $135
+CNSTI4 0
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $135
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 EntityHasKamikaze
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $137
+CNSTI4 0
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $137
+CNSTI4 1
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $129
+CNSTI4 0
+RETI4
+LABELV $128
+endproc EntityIsInvisible 16 4
+export SenseIsInvisible
+proc SenseIsInvisible 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $140
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $142
+CNSTI4 0
+RETI4
+ADDRGP4 $139
+JUMPV
+LABELV $142
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 PowerupsCarryFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $144
+CNSTI4 0
+RETI4
+ADDRGP4 $139
+JUMPV
+LABELV $144
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 SenseCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $146
+CNSTI4 0
+RETI4
+ADDRGP4 $139
+JUMPV
+LABELV $146
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $148
+CNSTI4 0
+RETI4
+ADDRGP4 $139
+JUMPV
+LABELV $148
+CNSTI4 1
+RETI4
+ADDRGP4 $139
+JUMPV
+LABELV $140
+CNSTI4 0
+RETI4
+LABELV $139
+endproc SenseIsInvisible 8 4
+export Bot1FCTFCarryingFlag
+proc Bot1FCTFCarryingFlag 0 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+EQI4 $151
+CNSTI4 0
+RETI4
+ADDRGP4 $150
+JUMPV
+LABELV $151
+ADDRFP4 0
+INDIRP4
+CNSTI4 17388
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $153
+CNSTI4 1
+RETI4
+ADDRGP4 $150
+JUMPV
+LABELV $153
+CNSTI4 0
+RETI4
+LABELV $150
+endproc Bot1FCTFCarryingFlag 0 0
+export BotHarvesterCarryingCubes
+proc BotHarvesterCarryingCubes 0 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+EQI4 $156
+CNSTI4 0
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $156
+ADDRFP4 0
+INDIRP4
+CNSTI4 17392
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $158
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $158
+ADDRFP4 0
+INDIRP4
+CNSTI4 17396
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $160
+CNSTI4 1
+RETI4
+ADDRGP4 $155
+JUMPV
+LABELV $160
+CNSTI4 0
+RETI4
+LABELV $155
+endproc BotHarvesterCarryingCubes 0 0
+export BotRememberLastOrderedTask
+proc BotRememberLastOrderedTask 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $163
+ADDRGP4 $162
+JUMPV
+LABELV $163
+ADDRFP4 0
+INDIRP4
+CNSTI4 19008
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19020
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 19016
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $162
+endproc BotRememberLastOrderedTask 16 12
+export BotSetTeamStatus
+proc BotSetTeamStatus 32 12
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LTI4 $166
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+GTI4 $166
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $186-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $186
+address $167
+address $170
+address $176
+address $177
+address $178
+address $179
+address $180
+address $180
+address $181
+address $182
+address $183
+address $184
+address $185
+code
+LABELV $170
+ADDRLP4 12
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+EQI4 $175
+ADDRLP4 12
+INDIRI4
+CNSTI4 5
+NEI4 $174
+LABELV $175
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 PowerupsCarryFlag
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $173
+LABELV $174
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $171
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 SenseCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $171
+LABELV $173
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $171
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $176
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $177
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $178
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $179
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $180
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $181
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $182
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $183
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $184
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $185
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $166
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+LABELV $167
+ADDRGP4 $189
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $188
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+LABELV $165
+endproc BotSetTeamStatus 32 12
+export BotSetLastOrderedTask
+proc BotSetLastOrderedTask 60 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $191
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $193
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $195
+ADDRFP4 0
+INDIRP4
+CNSTI4 19208
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $196
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $196
+JUMPV
+LABELV $195
+ADDRFP4 0
+INDIRP4
+CNSTI4 19212
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $199
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $199
+LABELV $196
+LABELV $193
+LABELV $191
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $201
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19008
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19020
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19016
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1133903872
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $203
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $205
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 BotTeamFlag
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotEnemyFlag
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 52
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $207
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+LABELV $207
+LABELV $205
+LABELV $203
+CNSTI4 1
+RETI4
+ADDRGP4 $190
+JUMPV
+LABELV $201
+CNSTI4 0
+RETI4
+LABELV $190
+endproc BotSetLastOrderedTask 60 16
+export BotRefuseOrder
+proc BotRefuseOrder 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $210
+ADDRGP4 $209
+JUMPV
+LABELV $210
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 18868
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $212
+ADDRLP4 0
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+LEF4 $212
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2097152
+ARGI4
+ADDRGP4 EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $214
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18868
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $212
+LABELV $209
+endproc BotRefuseOrder 8 12
+export BotCTFSeekGoals
+proc BotCTFSeekGoals 228 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $216
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $218
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18408
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 168
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+EQI4 $223
+ADDRLP4 168
+INDIRI4
+CNSTI4 2
+EQI4 $228
+ADDRGP4 $220
+JUMPV
+LABELV $223
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ADDRGP4 ctf_blueflag
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ADDRGP4 ctf_blueflag+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+ADDRGP4 ctf_blueflag+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $221
+JUMPV
+LABELV $228
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ADDRGP4 ctf_redflag
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ADDRGP4 ctf_redflag+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+ADDRGP4 ctf_redflag+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $221
+JUMPV
+LABELV $220
+ADDRLP4 188
+CNSTF4 1148829696
+ASGNF4
+ADDRLP4 148
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 148+4
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 148+8
+CNSTF4 1148829696
+ASGNF4
+LABELV $221
+ADDRLP4 148
+ARGP4
+ADDRLP4 180
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 180
+INDIRF4
+CNSTF4 1124073472
+GEF4 $235
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRGP4 $236
+JUMPV
+LABELV $235
+ADDRFP4 0
+INDIRP4
+CNSTI4 18944
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $236
+ADDRGP4 $189
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 184
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $188
+ARGP4
+ADDRLP4 184
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $237
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $215
+JUMPV
+LABELV $218
+ADDRFP4 0
+INDIRP4
+CNSTI4 18408
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $215
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 1
+NEI4 $240
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 19208
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $241
+JUMPV
+LABELV $240
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 19212
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $241
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $215
+ADDRFP4 0
+INDIRP4
+CNSTI4 18408
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $215
+JUMPV
+LABELV $216
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $244
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $244
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 168
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $246
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $246
+LABELV $244
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+NEI4 $248
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 19208
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19212
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $249
+JUMPV
+LABELV $248
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 19212
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19208
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $249
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $250
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $215
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $258
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 18920
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ADDRGP4 ctf_redflag+44
+INDIRI4
+EQI4 $215
+ADDRLP4 184
+INDIRI4
+ADDRGP4 ctf_blueflag+44
+INDIRI4
+EQI4 $215
+LABELV $258
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+LTI4 $215
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $261
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ADDRLP4 192
+INDIRI4
+EQI4 $215
+LABELV $261
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19000
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18428
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $262
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19268
+ADDP4
+CNSTF4 1124073472
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $215
+JUMPV
+LABELV $250
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $263
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $215
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+LTI4 $267
+LABELV $267
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 4
+EQI4 $215
+ADDRLP4 184
+INDIRI4
+CNSTI4 6
+EQI4 $215
+ADDRLP4 184
+INDIRI4
+CNSTI4 1
+EQI4 $215
+ADDRLP4 184
+INDIRI4
+CNSTI4 2
+EQI4 $215
+ADDRLP4 184
+INDIRI4
+CNSTI4 8
+EQI4 $215
+ADDRLP4 184
+INDIRI4
+CNSTI4 9
+EQI4 $215
+ADDRLP4 184
+INDIRI4
+CNSTI4 10
+EQI4 $215
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 192
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $271
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $272
+JUMPV
+LABELV $271
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 6
+ASGNI4
+LABELV $272
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $215
+JUMPV
+LABELV $263
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $273
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $215
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 6
+EQI4 $215
+ADDRLP4 180
+INDIRI4
+CNSTI4 2
+EQI4 $215
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+LTI4 $279
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19000
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18428
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $262
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19268
+ADDP4
+CNSTF4 1124073472
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $215
+JUMPV
+LABELV $279
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 192
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 192
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $215
+JUMPV
+LABELV $273
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $281
+ADDRGP4 $215
+JUMPV
+LABELV $281
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $283
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ADDRLP4 184
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $283
+ADDRLP4 188
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+INDIRI4
+ADDRLP4 188
+INDIRI4
+NEI4 $285
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+INDIRI4
+ADDRLP4 188
+INDIRI4
+EQI4 $285
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $285
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 1
+EQI4 $296
+ADDRLP4 192
+INDIRI4
+CNSTI4 2
+EQI4 $296
+ADDRLP4 192
+INDIRI4
+CNSTI4 3
+EQI4 $296
+ADDRLP4 192
+INDIRI4
+CNSTI4 4
+EQI4 $296
+ADDRLP4 192
+INDIRI4
+CNSTI4 5
+EQI4 $296
+ADDRLP4 192
+INDIRI4
+CNSTI4 6
+EQI4 $296
+ADDRLP4 192
+INDIRI4
+CNSTI4 8
+EQI4 $296
+ADDRLP4 192
+INDIRI4
+CNSTI4 9
+EQI4 $296
+ADDRLP4 192
+INDIRI4
+CNSTI4 10
+NEI4 $287
+LABELV $296
+ADDRGP4 $215
+JUMPV
+LABELV $287
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $297
+ADDRGP4 $215
+JUMPV
+LABELV $297
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $299
+ADDRGP4 $215
+JUMPV
+LABELV $299
+ADDRFP4 0
+INDIRP4
+CNSTI4 18420
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $301
+ADDRGP4 $215
+JUMPV
+LABELV $301
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 200
+INDIRF4
+CNSTF4 1112014848
+GEF4 $303
+ADDRGP4 $215
+JUMPV
+LABELV $303
+ADDRLP4 204
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 204
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19004
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $305
+ADDRFP4 0
+INDIRP4
+CNSTI4 19004
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $307
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $308
+JUMPV
+LABELV $307
+ADDRLP4 8
+CNSTF4 1045220557
+ASGNF4
+LABELV $308
+ADDRLP4 12
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $306
+JUMPV
+LABELV $305
+ADDRLP4 8
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 12
+CNSTF4 1060320051
+ASGNF4
+LABELV $306
+ADDRLP4 208
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 208
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $309
+ADDRLP4 212
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 212
+INDIRI4
+EQI4 $309
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 212
+INDIRI4
+EQI4 $309
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 220
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 220
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $310
+JUMPV
+LABELV $309
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $313
+ADDRLP4 216
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 216
+INDIRI4
+EQI4 $313
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 216
+INDIRI4
+EQI4 $313
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 224
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 1
+NEI4 $317
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $318
+JUMPV
+LABELV $317
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $318
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18400
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $314
+JUMPV
+LABELV $313
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18420
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $314
+LABELV $310
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPrintTeamGoal
+CALLV
+pop
+LABELV $215
+endproc BotCTFSeekGoals 228 12
+export BotCTFRetreatGoals
+proc BotCTFRetreatGoals 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $320
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $322
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18408
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $322
+LABELV $320
+LABELV $319
+endproc BotCTFRetreatGoals 8 4
+export Bot1FCTFSeekGoals
+proc Bot1FCTFSeekGoals 196 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $325
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $324
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18408
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $237
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $324
+JUMPV
+LABELV $325
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $329
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $329
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 152
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $331
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $331
+LABELV $329
+ADDRFP4 0
+INDIRP4
+CNSTI4 19216
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $333
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $324
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $337
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+LTI4 $339
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19000
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18428
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $262
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19268
+ADDP4
+CNSTF4 1124073472
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $324
+JUMPV
+LABELV $339
+LABELV $337
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 1
+EQI4 $350
+ADDRLP4 152
+INDIRI4
+CNSTI4 2
+EQI4 $350
+ADDRLP4 152
+INDIRI4
+CNSTI4 3
+EQI4 $350
+ADDRLP4 152
+INDIRI4
+CNSTI4 4
+EQI4 $350
+ADDRLP4 152
+INDIRI4
+CNSTI4 5
+EQI4 $350
+ADDRLP4 152
+INDIRI4
+CNSTI4 8
+EQI4 $350
+ADDRLP4 152
+INDIRI4
+CNSTI4 9
+EQI4 $350
+ADDRLP4 152
+INDIRI4
+CNSTI4 13
+EQI4 $350
+ADDRLP4 152
+INDIRI4
+CNSTI4 10
+NEI4 $341
+LABELV $350
+ADDRGP4 $324
+JUMPV
+LABELV $341
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 13
+EQI4 $324
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 1
+NEI4 $353
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $354
+JUMPV
+LABELV $353
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $354
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 13
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $324
+JUMPV
+LABELV $333
+ADDRFP4 0
+INDIRP4
+CNSTI4 19216
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $355
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $324
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+LTI4 $359
+LABELV $359
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 1
+EQI4 $366
+ADDRLP4 156
+INDIRI4
+CNSTI4 2
+EQI4 $366
+ADDRLP4 156
+INDIRI4
+CNSTI4 8
+EQI4 $366
+ADDRLP4 156
+INDIRI4
+CNSTI4 9
+EQI4 $366
+ADDRLP4 156
+INDIRI4
+CNSTI4 10
+NEI4 $361
+LABELV $366
+ADDRGP4 $324
+JUMPV
+LABELV $361
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $324
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 1
+NEI4 $369
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $370
+JUMPV
+LABELV $369
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $370
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18400
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $324
+JUMPV
+LABELV $355
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $371
+ADDRGP4 $324
+JUMPV
+LABELV $371
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $373
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $373
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+INDIRI4
+ADDRLP4 160
+INDIRI4
+NEI4 $375
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+INDIRI4
+ADDRLP4 160
+INDIRI4
+EQI4 $375
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $375
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 1
+EQI4 $387
+ADDRLP4 164
+INDIRI4
+CNSTI4 2
+EQI4 $387
+ADDRLP4 164
+INDIRI4
+CNSTI4 3
+EQI4 $387
+ADDRLP4 164
+INDIRI4
+CNSTI4 4
+EQI4 $387
+ADDRLP4 164
+INDIRI4
+CNSTI4 5
+EQI4 $387
+ADDRLP4 164
+INDIRI4
+CNSTI4 6
+EQI4 $387
+ADDRLP4 164
+INDIRI4
+CNSTI4 8
+EQI4 $387
+ADDRLP4 164
+INDIRI4
+CNSTI4 9
+EQI4 $387
+ADDRLP4 164
+INDIRI4
+CNSTI4 13
+EQI4 $387
+ADDRLP4 164
+INDIRI4
+CNSTI4 10
+NEI4 $377
+LABELV $387
+ADDRGP4 $324
+JUMPV
+LABELV $377
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $388
+ADDRGP4 $324
+JUMPV
+LABELV $388
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $390
+ADDRGP4 $324
+JUMPV
+LABELV $390
+ADDRFP4 0
+INDIRP4
+CNSTI4 18420
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $392
+ADDRGP4 $324
+JUMPV
+LABELV $392
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+CNSTF4 1112014848
+GEF4 $394
+ADDRGP4 $324
+JUMPV
+LABELV $394
+ADDRLP4 176
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 176
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19004
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $396
+ADDRFP4 0
+INDIRP4
+CNSTI4 19004
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $398
+ADDRLP4 4
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $399
+JUMPV
+LABELV $398
+ADDRLP4 4
+CNSTF4 1045220557
+ASGNF4
+LABELV $399
+ADDRLP4 8
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $397
+JUMPV
+LABELV $396
+ADDRLP4 4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+LABELV $397
+ADDRLP4 180
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 180
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $400
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+CNSTI4 0
+EQI4 $400
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $401
+JUMPV
+LABELV $400
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $403
+ADDRLP4 184
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 184
+INDIRI4
+EQI4 $403
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 184
+INDIRI4
+EQI4 $403
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 1
+NEI4 $407
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $408
+JUMPV
+LABELV $407
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $408
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18400
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $404
+JUMPV
+LABELV $403
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18420
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $404
+LABELV $401
+ADDRFP4 0
+INDIRP4
+CNSTI4 18872
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPrintTeamGoal
+CALLV
+pop
+LABELV $324
+endproc Bot1FCTFSeekGoals 196 12
+export Bot1FCTFRetreatGoals
+proc Bot1FCTFRetreatGoals 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $410
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $412
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18408
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $412
+LABELV $410
+LABELV $409
+endproc Bot1FCTFRetreatGoals 12 8
+export BotObeliskSeekGoals
+proc BotObeliskSeekGoals 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $415
+ADDRGP4 $414
+JUMPV
+LABELV $415
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $417
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $417
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+EQI4 $429
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+EQI4 $429
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+EQI4 $429
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+EQI4 $429
+ADDRLP4 16
+INDIRI4
+CNSTI4 5
+EQI4 $429
+ADDRLP4 16
+INDIRI4
+CNSTI4 6
+EQI4 $429
+ADDRLP4 16
+INDIRI4
+CNSTI4 8
+EQI4 $429
+ADDRLP4 16
+INDIRI4
+CNSTI4 9
+EQI4 $429
+ADDRLP4 16
+INDIRI4
+CNSTI4 13
+EQI4 $429
+ADDRLP4 16
+INDIRI4
+CNSTI4 10
+NEI4 $419
+LABELV $429
+ADDRGP4 $414
+JUMPV
+LABELV $419
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $430
+ADDRGP4 $414
+JUMPV
+LABELV $430
+ADDRFP4 0
+INDIRP4
+CNSTI4 18420
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $432
+ADDRGP4 $414
+JUMPV
+LABELV $432
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1112014848
+GEF4 $434
+ADDRGP4 $414
+JUMPV
+LABELV $434
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19004
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $436
+ADDRFP4 0
+INDIRP4
+CNSTI4 19004
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $438
+ADDRLP4 4
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $439
+JUMPV
+LABELV $438
+ADDRLP4 4
+CNSTF4 1045220557
+ASGNF4
+LABELV $439
+ADDRLP4 8
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $437
+JUMPV
+LABELV $436
+ADDRLP4 4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+LABELV $437
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $440
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $440
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $440
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+NEI4 $444
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $445
+JUMPV
+LABELV $444
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $445
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 13
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $441
+JUMPV
+LABELV $440
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $446
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $446
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $446
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+NEI4 $450
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $451
+JUMPV
+LABELV $450
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $451
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18400
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $447
+JUMPV
+LABELV $446
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18420
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $447
+LABELV $441
+LABELV $414
+endproc BotObeliskSeekGoals 52 12
+export BotGoHarvest
+proc BotGoHarvest 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $453
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $454
+JUMPV
+LABELV $453
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $454
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18416
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $452
+endproc BotGoHarvest 4 12
+export BotObeliskRetreatGoals
+proc BotObeliskRetreatGoals 0 0
+LABELV $455
+endproc BotObeliskRetreatGoals 0 0
+export BotHarvesterSeekGoals
+proc BotHarvesterSeekGoals 68 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $457
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $456
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18408
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $456
+JUMPV
+LABELV $457
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $461
+ADDRGP4 $456
+JUMPV
+LABELV $461
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 SenseCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $465
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $465
+LABELV $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 19012
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $467
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $467
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $478
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+EQI4 $478
+ADDRLP4 28
+INDIRI4
+CNSTI4 3
+EQI4 $478
+ADDRLP4 28
+INDIRI4
+CNSTI4 4
+EQI4 $478
+ADDRLP4 28
+INDIRI4
+CNSTI4 8
+EQI4 $478
+ADDRLP4 28
+INDIRI4
+CNSTI4 9
+EQI4 $478
+ADDRLP4 28
+INDIRI4
+CNSTI4 13
+EQI4 $478
+ADDRLP4 28
+INDIRI4
+CNSTI4 12
+EQI4 $478
+ADDRLP4 28
+INDIRI4
+CNSTI4 10
+NEI4 $469
+LABELV $478
+ADDRGP4 $456
+JUMPV
+LABELV $469
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $479
+ADDRGP4 $456
+JUMPV
+LABELV $479
+ADDRFP4 0
+INDIRP4
+CNSTI4 18420
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $481
+ADDRGP4 $456
+JUMPV
+LABELV $481
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1112014848
+GEF4 $483
+ADDRGP4 $456
+JUMPV
+LABELV $483
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 BotEnemyCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $485
+LABELV $485
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $487
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotTeamCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $489
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19000
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18428
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $262
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19268
+ADDP4
+CNSTF4 1124073472
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $456
+JUMPV
+LABELV $489
+LABELV $487
+ADDRFP4 0
+INDIRP4
+CNSTI4 19004
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $491
+ADDRFP4 0
+INDIRP4
+CNSTI4 19004
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $493
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $494
+JUMPV
+LABELV $493
+ADDRLP4 8
+CNSTF4 1045220557
+ASGNF4
+LABELV $494
+ADDRLP4 12
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $492
+JUMPV
+LABELV $491
+ADDRLP4 8
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 12
+CNSTF4 1060320051
+ASGNF4
+LABELV $492
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $495
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $495
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $495
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoHarvest
+CALLV
+pop
+ADDRGP4 $496
+JUMPV
+LABELV $495
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $499
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRGP4 redobelisk+12
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $499
+ADDRGP4 blueobelisk+12
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $499
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+NEI4 $503
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $504
+JUMPV
+LABELV $503
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $504
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18400
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $500
+JUMPV
+LABELV $499
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18420
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $500
+LABELV $496
+LABELV $456
+endproc BotHarvesterSeekGoals 68 12
+export BotHarvesterRetreatGoals
+proc BotHarvesterRetreatGoals 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $506
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $505
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18408
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $506
+LABELV $505
+endproc BotHarvesterRetreatGoals 8 4
+export BotTeamGoals
+proc BotTeamGoals 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $511
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $513
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFRetreatGoals
+CALLV
+pop
+ADDRGP4 $512
+JUMPV
+LABELV $513
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $515
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFRetreatGoals
+CALLV
+pop
+ADDRGP4 $512
+JUMPV
+LABELV $515
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $517
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotObeliskRetreatGoals
+CALLV
+pop
+ADDRGP4 $512
+JUMPV
+LABELV $517
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $512
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotHarvesterRetreatGoals
+CALLV
+pop
+ADDRGP4 $512
+JUMPV
+LABELV $511
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $521
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFSeekGoals
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $521
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $523
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bot1FCTFSeekGoals
+CALLV
+pop
+ADDRGP4 $524
+JUMPV
+LABELV $523
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $525
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotObeliskSeekGoals
+CALLV
+pop
+ADDRGP4 $526
+JUMPV
+LABELV $525
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $527
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotHarvesterSeekGoals
+CALLV
+pop
+LABELV $527
+LABELV $526
+LABELV $524
+LABELV $522
+LABELV $512
+ADDRFP4 0
+INDIRP4
+CNSTI4 18868
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $510
+endproc BotTeamGoals 0 4
+export BotPointAreaNum
+proc BotPointAreaNum 68 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $530
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $529
+JUMPV
+LABELV $530
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 64
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LEI4 $533
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $529
+JUMPV
+LABELV $533
+CNSTI4 0
+RETI4
+LABELV $529
+endproc BotPointAreaNum 68 20
+export PlayerName
+proc PlayerName 1032 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $538
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $536
+LABELV $538
+CNSTI4 3
+ARGI4
+ADDRGP4 $539
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $540
+RETP4
+ADDRGP4 $535
+JUMPV
+LABELV $536
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $541
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $535
+endproc PlayerName 1032 12
+export PlayerFromName
+proc PlayerFromName 1036 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1024
+CNSTI4 0
+ASGNI4
+ADDRGP4 $546
+JUMPV
+LABELV $543
+ADDRLP4 1024
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $541
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $548
+ADDRLP4 1024
+INDIRI4
+RETI4
+ADDRGP4 $542
+JUMPV
+LABELV $548
+LABELV $544
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $546
+ADDRLP4 1024
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $543
+CNSTI4 -1
+RETI4
+LABELV $542
+endproc PlayerFromName 1036 12
+export PlayerOnSameTeamFromName
+proc PlayerOnSameTeamFromName 1040 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $554
+JUMPV
+LABELV $551
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+NEI4 $556
+ADDRGP4 $552
+JUMPV
+LABELV $556
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $541
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $558
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $550
+JUMPV
+LABELV $558
+LABELV $552
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $554
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $551
+CNSTI4 -1
+RETI4
+LABELV $550
+endproc PlayerOnSameTeamFromName 1040 12
+export stristr
+proc stristr 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $562
+JUMPV
+LABELV $561
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $567
+JUMPV
+LABELV $564
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $568
+ADDRGP4 $566
+JUMPV
+LABELV $568
+LABELV $565
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $567
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+EQI4 $570
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+NEI4 $564
+LABELV $570
+LABELV $566
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $571
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $560
+JUMPV
+LABELV $571
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $562
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $561
+CNSTP4 0
+RETP4
+LABELV $560
+endproc stristr 12 4
+lit
+align 1
+LABELV $574
+byte 1 0
+skip 127
+export EasyPlayerName
+code
+proc EasyPlayerName 196 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 5
+ADDRGP4 $574
+INDIRB
+ASGNB 128
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 5
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 PlayerName
+CALLP4
+pop
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRGP4 $578
+JUMPV
+LABELV $575
+ADDRLP4 148
+ADDRLP4 136
+INDIRI4
+ADDRLP4 5
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+CVII1 4
+ASGNI1
+LABELV $576
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $578
+ADDRLP4 136
+INDIRI4
+ADDRLP4 5
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $575
+ADDRLP4 5
+ARGP4
+ADDRGP4 $583
+ARGP4
+ADDRLP4 152
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRGP4 $582
+JUMPV
+LABELV $579
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 156
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $580
+ADDRLP4 5
+ARGP4
+ADDRGP4 $583
+ARGP4
+ADDRLP4 156
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+LABELV $582
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $579
+ADDRLP4 5
+ARGP4
+ADDRGP4 $584
+ARGP4
+ADDRLP4 160
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 5
+ARGP4
+ADDRGP4 $585
+ARGP4
+ADDRLP4 164
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 144
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 168
+CNSTU4 0
+ASGNU4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+ADDRLP4 168
+INDIRU4
+EQU4 $586
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+ADDRLP4 168
+INDIRU4
+EQU4 $586
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+LEU4 $588
+ADDRLP4 144
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 172
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $589
+JUMPV
+LABELV $588
+ADDRLP4 140
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 176
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $589
+LABELV $586
+ADDRLP4 172
+ADDRLP4 5
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 109
+EQI4 $594
+ADDRLP4 172
+INDIRI4
+CNSTI4 77
+NEI4 $590
+LABELV $594
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 114
+EQI4 $595
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 82
+NEI4 $590
+LABELV $595
+ADDRLP4 5+2
+ARGP4
+ADDRLP4 176
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 5
+ARGP4
+ADDRLP4 5+2
+ARGP4
+ADDRLP4 176
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $590
+ADDRLP4 0
+ADDRLP4 5
+ASGNP4
+ADDRGP4 $599
+JUMPV
+LABELV $598
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 176
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 97
+LTI4 $604
+ADDRLP4 176
+INDIRI4
+CNSTI4 122
+LEI4 $605
+LABELV $604
+ADDRLP4 180
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 48
+LTI4 $606
+ADDRLP4 180
+INDIRI4
+CNSTI4 57
+LEI4 $605
+LABELV $606
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 95
+NEI4 $601
+LABELV $605
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $602
+JUMPV
+LABELV $601
+ADDRLP4 184
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 65
+LTI4 $607
+ADDRLP4 184
+INDIRI4
+CNSTI4 90
+GTI4 $607
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+ADDI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $608
+JUMPV
+LABELV $607
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 188
+INDIRU4
+CNSTU4 1
+ADDU4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $608
+LABELV $602
+LABELV $599
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $598
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 5
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $573
+endproc EasyPlayerName 196 12
+export BotSynonymContext
+proc BotSynonymContext 12 4
+ADDRLP4 0
+CNSTI4 1027
+ASGNI4
+ADDRLP4 4
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+EQI4 $612
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+NEI4 $610
+LABELV $612
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $613
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $611
+JUMPV
+LABELV $613
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRGP4 $611
+JUMPV
+LABELV $610
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $615
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $617
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRGP4 $616
+JUMPV
+LABELV $617
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRGP4 $616
+JUMPV
+LABELV $615
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $619
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $621
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRGP4 $622
+JUMPV
+LABELV $621
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+LABELV $622
+LABELV $619
+LABELV $616
+LABELV $611
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $609
+endproc BotSynonymContext 12 4
+export BotChooseWeapon
+proc BotChooseWeapon 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $626
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $624
+LABELV $626
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_SelectWeapon
+CALLV
+pop
+ADDRGP4 $625
+JUMPV
+LABELV $624
+ADDRFP4 0
+INDIRP4
+CNSTI4 18788
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17200
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotChooseBestFightWeapon
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $627
+ADDRFP4 0
+INDIRP4
+CNSTI4 18444
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $627
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_SelectWeapon
+CALLV
+pop
+LABELV $625
+LABELV $623
+endproc BotChooseWeapon 20 8
+export BotWantsToWalk
+proc BotWantsToWalk 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18312
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+GTF4 $630
+CNSTI4 0
+RETI4
+ADDRGP4 $629
+JUMPV
+LABELV $630
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $632
+CNSTI4 0
+RETI4
+ADDRGP4 $629
+JUMPV
+LABELV $632
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $634
+CNSTI4 0
+RETI4
+ADDRGP4 $629
+JUMPV
+LABELV $634
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $636
+CNSTI4 0
+RETI4
+ADDRGP4 $629
+JUMPV
+LABELV $636
+ADDRFP4 0
+INDIRP4
+CNSTI4 17364
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $638
+CNSTI4 0
+RETI4
+ADDRGP4 $629
+JUMPV
+LABELV $638
+ADDRFP4 0
+INDIRP4
+CNSTI4 17348
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $640
+CNSTI4 0
+RETI4
+ADDRGP4 $629
+JUMPV
+LABELV $640
+CNSTI4 1
+RETI4
+LABELV $629
+endproc BotWantsToWalk 12 4
+export BotSetupForMovement
+proc BotSetupForMovement 96 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 68
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+36
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+44
+ADDRFP4 0
+INDIRP4
+CNSTI4 17152
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 4095
+EQI4 $654
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $654
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+ADDRLP4 80
+INDIRI4
+EQI4 $657
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LEI4 $657
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $657
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 88
+INDIRI4
+EQI4 $660
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LEI4 $660
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $660
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $663
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $663
+CNSTI4 728
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+332
+ADDP4
+INDIRP4
+CNSTI4 1512
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $666
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+LABELV $666
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $670
+ADDRLP4 0+48
+CNSTI4 4
+ASGNI4
+ADDRGP4 $671
+JUMPV
+LABELV $670
+ADDRLP4 0+48
+CNSTI4 2
+ASGNI4
+LABELV $671
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 BotWantsToWalk
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+EQI4 $674
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+LABELV $674
+ADDRFP4 0
+INDIRP4
+CNSTI4 18312
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+LEF4 $677
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $677
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+LABELV $677
+ADDRLP4 0+52
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotInitMoveState
+CALLV
+pop
+LABELV $642
+endproc BotSetupForMovement 96 12
+export BotCheckItemPickup
+proc BotCheckItemPickup 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+GTI4 $683
+ADDRGP4 $682
+JUMPV
+LABELV $683
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $685
+ADDRFP4 0
+INDIRP4
+CNSTI4 17328
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $685
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $685
+ADDRFP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $687
+ADDRFP4 0
+INDIRP4
+CNSTI4 17336
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $687
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $687
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17328
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $689
+ADDRFP4 0
+INDIRP4
+CNSTI4 17336
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $689
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $691
+ADDRFP4 0
+INDIRP4
+CNSTI4 17364
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $691
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $691
+ADDRFP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $693
+ADDRFP4 0
+INDIRP4
+CNSTI4 17368
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $693
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $693
+ADDRFP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $695
+ADDRFP4 0
+INDIRP4
+CNSTI4 17372
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $695
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $695
+ADDRFP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $697
+ADDRFP4 0
+INDIRP4
+CNSTI4 17376
+ADDP4
+INDIRI4
+CNSTI4 1
+LTI4 $697
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $697
+LABELV $689
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $699
+ADDRFP4 0
+INDIRP4
+CNSTI4 19152
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 PlayerFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $701
+ADDRFP4 0
+INDIRP4
+CNSTI4 19004
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+NEI4 $703
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $705
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $707
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $706
+JUMPV
+LABELV $705
+ADDRGP4 g_spSkill+12
+INDIRI4
+CNSTI4 3
+GTI4 $708
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 4
+EQI4 $711
+ADDRLP4 24
+INDIRI4
+CNSTI4 13
+EQI4 $711
+ADDRLP4 24
+INDIRI4
+CNSTI4 12
+EQI4 $711
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $715
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19208
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $713
+ADDRFP4 0
+INDIRP4
+CNSTI4 19212
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $713
+LABELV $715
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $716
+ADDRFP4 0
+INDIRP4
+CNSTI4 19216
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $713
+LABELV $716
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $707
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+LABELV $713
+LABELV $711
+LABELV $708
+LABELV $706
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 19004
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $703
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 19004
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 $702
+JUMPV
+LABELV $701
+ADDRFP4 0
+INDIRP4
+CNSTI4 19004
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $717
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $719
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $721
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $720
+JUMPV
+LABELV $719
+ADDRGP4 g_spSkill+12
+INDIRI4
+CNSTI4 3
+GTI4 $722
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $725
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $729
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19208
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $727
+ADDRFP4 0
+INDIRP4
+CNSTI4 19212
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $727
+LABELV $729
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $730
+ADDRFP4 0
+INDIRP4
+CNSTI4 19216
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $727
+LABELV $730
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $721
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+LABELV $727
+LABELV $725
+LABELV $722
+LABELV $720
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 19004
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $717
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 19004
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $702
+LABELV $699
+LABELV $682
+endproc BotCheckItemPickup 36 12
+export BotPlayerStateInventory
+proc BotPlayerStateInventory 132 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 296
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $733
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $734
+JUMPV
+LABELV $733
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $734
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $736
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $737
+JUMPV
+LABELV $736
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $737
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $739
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $740
+JUMPV
+LABELV $739
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $740
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $742
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $743
+JUMPV
+LABELV $742
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $743
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 32
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $745
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $746
+JUMPV
+LABELV $745
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $746
+ADDRFP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $748
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $749
+JUMPV
+LABELV $748
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $749
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $751
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $752
+JUMPV
+LABELV $751
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $752
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $754
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRGP4 $755
+JUMPV
+LABELV $754
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+LABELV $755
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $757
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $758
+JUMPV
+LABELV $757
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+LABELV $758
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $760
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRGP4 $761
+JUMPV
+LABELV $760
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+LABELV $761
+ADDRFP4 8
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $763
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRGP4 $764
+JUMPV
+LABELV $763
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+LABELV $764
+ADDRFP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $766
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRGP4 $767
+JUMPV
+LABELV $766
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+LABELV $767
+ADDRFP4 8
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $769
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $770
+JUMPV
+LABELV $769
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+LABELV $770
+ADDRFP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 420
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 428
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 432
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI4
+CNSTI4 26
+NEI4 $772
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $773
+JUMPV
+LABELV $772
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $773
+ADDRFP4 8
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI4
+CNSTI4 27
+NEI4 $775
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+ADDRGP4 $776
+JUMPV
+LABELV $775
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $776
+ADDRFP4 8
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI4
+CNSTI4 36
+NEI4 $778
+ADDRLP4 64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $779
+JUMPV
+LABELV $778
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+LABELV $779
+ADDRFP4 8
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI4
+CNSTI4 37
+NEI4 $781
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $782
+JUMPV
+LABELV $781
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $782
+ADDRFP4 8
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI4
+CNSTI4 38
+NEI4 $784
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRGP4 $785
+JUMPV
+LABELV $784
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+LABELV $785
+ADDRFP4 8
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $787
+ADDRLP4 76
+CNSTI4 1
+ASGNI4
+ADDRGP4 $788
+JUMPV
+LABELV $787
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+LABELV $788
+ADDRFP4 8
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $790
+ADDRLP4 80
+CNSTI4 1
+ASGNI4
+ADDRGP4 $791
+JUMPV
+LABELV $790
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+LABELV $791
+ADDRFP4 8
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 360
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $793
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+ADDRGP4 $794
+JUMPV
+LABELV $793
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+LABELV $794
+ADDRFP4 8
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 364
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $796
+ADDRLP4 88
+CNSTI4 1
+ASGNI4
+ADDRGP4 $797
+JUMPV
+LABELV $796
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+LABELV $797
+ADDRFP4 8
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 368
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $799
+ADDRLP4 92
+CNSTI4 1
+ASGNI4
+ADDRGP4 $800
+JUMPV
+LABELV $799
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+LABELV $800
+ADDRFP4 8
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 372
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $802
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+ADDRGP4 $803
+JUMPV
+LABELV $802
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+LABELV $803
+ADDRFP4 8
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRI4
+CNSTI4 42
+NEI4 $805
+ADDRLP4 100
+CNSTI4 1
+ASGNI4
+ADDRGP4 $806
+JUMPV
+LABELV $805
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+LABELV $806
+ADDRFP4 8
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRI4
+CNSTI4 43
+NEI4 $808
+ADDRLP4 104
+CNSTI4 1
+ASGNI4
+ADDRGP4 $809
+JUMPV
+LABELV $808
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+LABELV $809
+ADDRFP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRI4
+CNSTI4 44
+NEI4 $811
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRGP4 $812
+JUMPV
+LABELV $811
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+LABELV $812
+ADDRFP4 8
+INDIRP4
+CNSTI4 172
+ADDP4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRI4
+CNSTI4 45
+NEI4 $814
+ADDRLP4 112
+CNSTI4 1
+ASGNI4
+ADDRGP4 $815
+JUMPV
+LABELV $814
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+LABELV $815
+ADDRFP4 8
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 376
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $817
+ADDRLP4 116
+CNSTI4 1
+ASGNI4
+ADDRGP4 $818
+JUMPV
+LABELV $817
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+LABELV $818
+ADDRFP4 8
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 380
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $820
+ADDRLP4 120
+CNSTI4 1
+ASGNI4
+ADDRGP4 $821
+JUMPV
+LABELV $820
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+LABELV $821
+ADDRFP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $823
+ADDRLP4 124
+CNSTI4 1
+ASGNI4
+ADDRGP4 $824
+JUMPV
+LABELV $823
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+LABELV $824
+ADDRFP4 8
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+NEI4 $825
+ADDRFP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $826
+JUMPV
+LABELV $825
+ADDRFP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $826
+LABELV $731
+endproc BotPlayerStateInventory 132 4
+export BotUpdateInventory
+proc BotUpdateInventory 1028 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17200
+ADDP4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17200
+ADDP4
+ARGP4
+ADDRGP4 BotPlayerStateInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckItemPickup
+CALLV
+pop
+LABELV $827
+endproc BotUpdateInventory 1028 12
+export BotUpdateBattleInventory
+proc BotUpdateBattleInventory 148 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18004
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18000
+ADDP4
+ADDRLP4 144
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $828
+endproc BotUpdateBattleInventory 148 8
+export BotUseKamikaze
+proc BotUseKamikaze 256 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17328
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $839
+ADDRGP4 $838
+JUMPV
+LABELV $839
+ADDRFP4 0
+INDIRP4
+CNSTI4 18360
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $841
+ADDRGP4 $838
+JUMPV
+LABELV $841
+ADDRFP4 0
+INDIRP4
+CNSTI4 18360
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1045220557
+ADDF4
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $843
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+EQI4 $845
+ADDRGP4 $838
+JUMPV
+LABELV $845
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 236
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $847
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 16+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 244
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 244
+INDIRF4
+CNSTF4 1233125376
+GEF4 $856
+ADDRGP4 $838
+JUMPV
+LABELV $856
+LABELV $847
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $844
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 16+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 248
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 248
+INDIRF4
+CNSTF4 1233125376
+GEF4 $844
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Use
+CALLV
+pop
+ADDRGP4 $838
+JUMPV
+LABELV $843
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $869
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+EQI4 $871
+ADDRGP4 $838
+JUMPV
+LABELV $871
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 236
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $873
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 16+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 244
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 244
+INDIRF4
+CNSTF4 1233125376
+GEF4 $882
+ADDRGP4 $838
+JUMPV
+LABELV $882
+LABELV $873
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $870
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 16+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 248
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 248
+INDIRF4
+CNSTF4 1233125376
+GEF4 $870
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Use
+CALLV
+pop
+ADDRGP4 $838
+JUMPV
+LABELV $869
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $895
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 236
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 232
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 1
+EQI4 $900
+ADDRGP4 $897
+JUMPV
+LABELV $900
+ADDRLP4 164
+ADDRGP4 blueobelisk
+ASGNP4
+ADDRGP4 $898
+JUMPV
+LABELV $897
+ADDRLP4 164
+ADDRGP4 redobelisk
+ASGNP4
+LABELV $898
+ADDRLP4 152
+ADDRLP4 164
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 152+8
+ADDRLP4 152+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ADDRLP4 152
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+ADDRLP4 152+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 244
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 244
+INDIRF4
+CNSTF4 1229937705
+GEF4 $896
+ADDRLP4 168
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRLP4 252
+CNSTP4 0
+ASGNP4
+ADDRLP4 252
+INDIRP4
+ARGP4
+ADDRLP4 252
+INDIRP4
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 168+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $912
+ADDRLP4 168+56
+INDIRI4
+ADDRLP4 164
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $896
+LABELV $912
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Use
+CALLV
+pop
+ADDRGP4 $838
+JUMPV
+LABELV $895
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $913
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+EQI4 $915
+ADDRGP4 $838
+JUMPV
+LABELV $915
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 236
+ADDRGP4 BotTeamCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $917
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 16+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 244
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 244
+INDIRF4
+CNSTF4 1233125376
+GEF4 $926
+ADDRGP4 $838
+JUMPV
+LABELV $926
+LABELV $917
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 BotEnemyCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $928
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 16+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 248
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 248
+INDIRF4
+CNSTF4 1233125376
+GEF4 $937
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Use
+CALLV
+pop
+ADDRGP4 $838
+JUMPV
+LABELV $937
+LABELV $928
+LABELV $913
+LABELV $896
+LABELV $870
+LABELV $844
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 144
+ARGP4
+CNSTF4 1149239296
+ARGF4
+ADDRGP4 BotVisibleTeamMatesAndEnemies
+CALLV
+pop
+ADDRLP4 232
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 2
+LEI4 $939
+ADDRLP4 232
+INDIRI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 1
+ADDI4
+LEI4 $939
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Use
+CALLV
+pop
+LABELV $939
+LABELV $838
+endproc BotUseKamikaze 256 28
+export BotUseInvulnerability
+proc BotUseInvulnerability 128 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17336
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $942
+ADDRGP4 $941
+JUMPV
+LABELV $942
+ADDRFP4 0
+INDIRP4
+CNSTI4 18364
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $944
+ADDRGP4 $941
+JUMPV
+LABELV $944
+ADDRFP4 0
+INDIRP4
+CNSTI4 18364
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1045220557
+ADDF4
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $946
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $948
+ADDRGP4 $941
+JUMPV
+LABELV $948
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+LTI4 $950
+ADDRGP4 $941
+JUMPV
+LABELV $950
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 1
+EQI4 $955
+ADDRGP4 $952
+JUMPV
+LABELV $955
+ADDRLP4 28
+ADDRGP4 ctf_blueflag
+ASGNP4
+ADDRGP4 $953
+JUMPV
+LABELV $952
+ADDRLP4 28
+ADDRGP4 ctf_redflag
+ASGNP4
+LABELV $953
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 116
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 116
+INDIRF4
+CNSTF4 1193033728
+GEF4 $947
+ADDRLP4 32
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRLP4 124
+CNSTP4 0
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 32+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $967
+ADDRLP4 32+56
+INDIRI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $947
+LABELV $967
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Use
+CALLV
+pop
+ADDRGP4 $941
+JUMPV
+LABELV $946
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $968
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $970
+ADDRGP4 $941
+JUMPV
+LABELV $970
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+LTI4 $972
+ADDRGP4 $941
+JUMPV
+LABELV $972
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 1
+EQI4 $977
+ADDRGP4 $974
+JUMPV
+LABELV $977
+ADDRLP4 28
+ADDRGP4 ctf_blueflag
+ASGNP4
+ADDRGP4 $975
+JUMPV
+LABELV $974
+ADDRLP4 28
+ADDRGP4 ctf_redflag
+ASGNP4
+LABELV $975
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 116
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 116
+INDIRF4
+CNSTF4 1193033728
+GEF4 $969
+ADDRLP4 32
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRLP4 124
+CNSTP4 0
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 32+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $989
+ADDRLP4 32+56
+INDIRI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $969
+LABELV $989
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Use
+CALLV
+pop
+ADDRGP4 $941
+JUMPV
+LABELV $968
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $990
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+EQI4 $995
+ADDRGP4 $992
+JUMPV
+LABELV $995
+ADDRLP4 28
+ADDRGP4 blueobelisk
+ASGNP4
+ADDRGP4 $993
+JUMPV
+LABELV $992
+ADDRLP4 28
+ADDRGP4 redobelisk
+ASGNP4
+LABELV $993
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 108
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 108
+INDIRF4
+CNSTF4 1202702336
+GEF4 $991
+ADDRLP4 32
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRLP4 116
+CNSTP4 0
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 32+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1007
+ADDRLP4 32+56
+INDIRI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $991
+LABELV $1007
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Use
+CALLV
+pop
+ADDRGP4 $941
+JUMPV
+LABELV $990
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $1008
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $1010
+ADDRGP4 $941
+JUMPV
+LABELV $1010
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 BotEnemyCubeCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+LTI4 $1012
+ADDRGP4 $941
+JUMPV
+LABELV $1012
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 1
+EQI4 $1017
+ADDRGP4 $1014
+JUMPV
+LABELV $1017
+ADDRLP4 28
+ADDRGP4 blueobelisk
+ASGNP4
+ADDRGP4 $1015
+JUMPV
+LABELV $1014
+ADDRLP4 28
+ADDRGP4 redobelisk
+ASGNP4
+LABELV $1015
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 116
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 116
+INDIRF4
+CNSTF4 1193033728
+GEF4 $1023
+ADDRLP4 32
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRLP4 124
+CNSTP4 0
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 32+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1029
+ADDRLP4 32+56
+INDIRI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $1025
+LABELV $1029
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Use
+CALLV
+pop
+LABELV $1025
+LABELV $1023
+LABELV $1008
+LABELV $991
+LABELV $969
+LABELV $947
+LABELV $941
+endproc BotUseInvulnerability 128 28
+export BotBattleUseItems
+proc BotBattleUseItems 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1031
+ADDRFP4 0
+INDIRP4
+CNSTI4 17320
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1033
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1035
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1035
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1035
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Use
+CALLV
+pop
+LABELV $1035
+LABELV $1033
+LABELV $1031
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1037
+ADDRFP4 0
+INDIRP4
+CNSTI4 17324
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1039
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Use
+CALLV
+pop
+LABELV $1039
+LABELV $1037
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotUseKamikaze
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotUseInvulnerability
+CALLV
+pop
+LABELV $1030
+endproc BotBattleUseItems 12 4
+export BotSetTeleportTime
+proc BotSetTeleportTime 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1042
+ADDRFP4 0
+INDIRP4
+CNSTI4 18436
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1042
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1041
+endproc BotSetTeleportTime 8 0
+export BotIsDead
+proc BotIsDead 4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1046
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1047
+JUMPV
+LABELV $1046
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1047
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1044
+endproc BotIsDead 4 0
+export BotIsObserver
+proc BotIsObserver 1032 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1049
+CNSTI4 1
+RETI4
+ADDRGP4 $1048
+JUMPV
+LABELV $1049
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $1053
+ARGP4
+ADDRLP4 1024
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 3
+NEI4 $1051
+CNSTI4 1
+RETI4
+ADDRGP4 $1048
+JUMPV
+LABELV $1051
+CNSTI4 0
+RETI4
+LABELV $1048
+endproc BotIsObserver 1032 12
+export BotIntermission
+proc BotIntermission 8 0
+ADDRGP4 level+9148
+INDIRI4
+CNSTI4 0
+EQI4 $1055
+CNSTI4 1
+RETI4
+ADDRGP4 $1054
+JUMPV
+LABELV $1055
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+EQI4 $1061
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+NEI4 $1059
+LABELV $1061
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1060
+JUMPV
+LABELV $1059
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1060
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1054
+endproc BotIntermission 8 0
+export BotInLavaOrSlime
+proc BotInLavaOrSlime 16 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1102577664
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 24
+BANDI4
+RETI4
+LABELV $1062
+endproc BotInLavaOrSlime 16 4
+lit
+align 4
+LABELV $1065
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $1066
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export BotCreateWayPoint
+code
+proc BotCreateWayPoint 32 12
+ADDRLP4 4
+ADDRGP4 $1065
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRGP4 $1066
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1067
+CNSTI4 2
+ARGI4
+ADDRGP4 $1069
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $1064
+JUMPV
+LABELV $1067
+ADDRLP4 28
+ADDRGP4 botai_freewaypoints
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $1064
+endproc BotCreateWayPoint 32 12
+export BotFindWayPoint
+proc BotFindWayPoint 8 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1074
+JUMPV
+LABELV $1071
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1075
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $1070
+JUMPV
+LABELV $1075
+LABELV $1072
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1074
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1071
+CNSTP4 0
+RETP4
+LABELV $1070
+endproc BotFindWayPoint 8 8
+export BotFreeWaypoints
+proc BotFreeWaypoints 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1081
+JUMPV
+LABELV $1078
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRGP4 botai_freewaypoints
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $1079
+ADDRFP4 0
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $1081
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1078
+LABELV $1077
+endproc BotFreeWaypoints 8 0
+export BotInitWaypoints
+proc BotInitWaypoints 4 0
+ADDRGP4 botai_freewaypoints
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1083
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botai_waypoints+92
+ADDP4
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRGP4 botai_freewaypoints
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botai_waypoints
+ADDP4
+ASGNP4
+LABELV $1084
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $1083
+LABELV $1082
+endproc BotInitWaypoints 4 0
+export TeamPlayIsOn
+proc TeamPlayIsOn 4 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+LTI4 $1090
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1091
+JUMPV
+LABELV $1090
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1091
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1088
+endproc TeamPlayIsOn 4 0
+export BotCanCamp
+proc BotCanCamp 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $1093
+ADDRFP4 0
+INDIRP4
+CNSTI4 18308
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18304
+ADDP4
+INDIRI4
+GEI4 $1093
+CNSTI4 0
+RETI4
+ADDRGP4 $1092
+JUMPV
+LABELV $1093
+ADDRFP4 0
+INDIRP4
+CNSTI4 18004
+ADDP4
+INDIRI4
+CNSTI4 200
+LEI4 $1096
+CNSTI4 0
+RETI4
+ADDRGP4 $1092
+JUMPV
+LABELV $1096
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1098
+CNSTI4 0
+RETI4
+ADDRGP4 $1092
+JUMPV
+LABELV $1098
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $1100
+ADDRFP4 0
+INDIRP4
+CNSTI4 17204
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1102
+CNSTI4 0
+RETI4
+ADDRGP4 $1092
+JUMPV
+LABELV $1102
+LABELV $1100
+ADDRFP4 0
+INDIRP4
+CNSTI4 17340
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1104
+CNSTI4 0
+RETI4
+ADDRGP4 $1092
+JUMPV
+LABELV $1104
+ADDRFP4 0
+INDIRP4
+CNSTI4 17352
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1106
+CNSTI4 0
+RETI4
+ADDRGP4 $1092
+JUMPV
+LABELV $1106
+ADDRFP4 0
+INDIRP4
+CNSTI4 17356
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1108
+CNSTI4 0
+RETI4
+ADDRGP4 $1092
+JUMPV
+LABELV $1108
+ADDRFP4 0
+INDIRP4
+CNSTI4 17348
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1110
+CNSTI4 0
+RETI4
+ADDRGP4 $1092
+JUMPV
+LABELV $1110
+ADDRFP4 0
+INDIRP4
+CNSTI4 17232
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1114
+ADDRFP4 0
+INDIRP4
+CNSTI4 17292
+ADDP4
+INDIRI4
+CNSTI4 10
+GTI4 $1112
+LABELV $1114
+ADDRFP4 0
+INDIRP4
+CNSTI4 17240
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1115
+ADDRFP4 0
+INDIRP4
+CNSTI4 17296
+ADDP4
+INDIRI4
+CNSTI4 10
+GTI4 $1112
+LABELV $1115
+ADDRFP4 0
+INDIRP4
+CNSTI4 17244
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1116
+ADDRFP4 0
+INDIRP4
+CNSTI4 17284
+ADDP4
+INDIRI4
+CNSTI4 80
+GTI4 $1112
+LABELV $1116
+ADDRFP4 0
+INDIRP4
+CNSTI4 17268
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1117
+ADDRFP4 0
+INDIRP4
+CNSTI4 17312
+ADDP4
+INDIRI4
+CNSTI4 80
+GTI4 $1112
+LABELV $1117
+ADDRFP4 0
+INDIRP4
+CNSTI4 17252
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1118
+ADDRFP4 0
+INDIRP4
+CNSTI4 17300
+ADDP4
+INDIRI4
+CNSTI4 10
+GTI4 $1112
+LABELV $1118
+CNSTI4 0
+RETI4
+ADDRGP4 $1092
+JUMPV
+LABELV $1112
+CNSTI4 1
+RETI4
+LABELV $1092
+endproc BotCanCamp 24 0
+export BotAggression
+proc BotAggression 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17340
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1120
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1124
+ADDRFP4 0
+INDIRP4
+CNSTI4 18000
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $1122
+LABELV $1124
+CNSTF4 1116471296
+RETF4
+ADDRGP4 $1119
+JUMPV
+LABELV $1122
+LABELV $1120
+ADDRFP4 0
+INDIRP4
+CNSTI4 18004
+ADDP4
+INDIRI4
+CNSTI4 200
+LEI4 $1125
+CNSTF4 0
+RETF4
+ADDRGP4 $1119
+JUMPV
+LABELV $1125
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1127
+CNSTF4 0
+RETF4
+ADDRGP4 $1119
+JUMPV
+LABELV $1127
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $1129
+ADDRFP4 0
+INDIRP4
+CNSTI4 17204
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1131
+CNSTF4 0
+RETF4
+ADDRGP4 $1119
+JUMPV
+LABELV $1131
+LABELV $1129
+ADDRFP4 0
+INDIRP4
+CNSTI4 17252
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1133
+ADDRFP4 0
+INDIRP4
+CNSTI4 17300
+ADDP4
+INDIRI4
+CNSTI4 7
+LEI4 $1133
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $1119
+JUMPV
+LABELV $1133
+ADDRFP4 0
+INDIRP4
+CNSTI4 17240
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1135
+ADDRFP4 0
+INDIRP4
+CNSTI4 17296
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1135
+CNSTF4 1119748096
+RETF4
+ADDRGP4 $1119
+JUMPV
+LABELV $1135
+ADDRFP4 0
+INDIRP4
+CNSTI4 17236
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1137
+ADDRFP4 0
+INDIRP4
+CNSTI4 17288
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1137
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $1119
+JUMPV
+LABELV $1137
+ADDRFP4 0
+INDIRP4
+CNSTI4 17232
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1139
+ADDRFP4 0
+INDIRP4
+CNSTI4 17292
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1139
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $1119
+JUMPV
+LABELV $1139
+ADDRFP4 0
+INDIRP4
+CNSTI4 17244
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1141
+ADDRFP4 0
+INDIRP4
+CNSTI4 17284
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1141
+CNSTF4 1118437376
+RETF4
+ADDRGP4 $1119
+JUMPV
+LABELV $1141
+ADDRFP4 0
+INDIRP4
+CNSTI4 17228
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1143
+ADDRFP4 0
+INDIRP4
+CNSTI4 17280
+ADDP4
+INDIRI4
+CNSTI4 10
+LEI4 $1143
+CNSTF4 1117782016
+RETF4
+ADDRGP4 $1119
+JUMPV
+LABELV $1143
+ADDRFP4 0
+INDIRP4
+CNSTI4 17220
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1145
+ADDRFP4 0
+INDIRP4
+CNSTI4 17272
+ADDP4
+INDIRI4
+CNSTI4 10
+LEI4 $1145
+CNSTF4 1112014848
+RETF4
+ADDRGP4 $1119
+JUMPV
+LABELV $1145
+CNSTF4 0
+RETF4
+LABELV $1119
+endproc BotAggression 28 0
+export BotFeelingBad
+proc BotFeelingBad 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1148
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $1147
+JUMPV
+LABELV $1148
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1150
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $1147
+JUMPV
+LABELV $1150
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1152
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $1147
+JUMPV
+LABELV $1152
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1154
+CNSTF4 1117782016
+RETF4
+ADDRGP4 $1147
+JUMPV
+LABELV $1154
+CNSTF4 0
+RETF4
+LABELV $1147
+endproc BotFeelingBad 0 0
+export BotWantsToRetreat
+proc BotWantsToRetreat 140 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $1157
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $1158
+CNSTI4 1
+RETI4
+ADDRGP4 $1156
+JUMPV
+LABELV $1157
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $1161
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $1162
+CNSTI4 1
+RETI4
+ADDRGP4 $1156
+JUMPV
+LABELV $1161
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $1165
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $1167
+ADDRLP4 128
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1169
+ADDRLP4 128
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+EQI4 $1169
+CNSTI4 1
+RETI4
+ADDRGP4 $1156
+JUMPV
+LABELV $1169
+LABELV $1167
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotFeelingBad
+CALLF4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+CNSTF4 1112014848
+LEF4 $1173
+CNSTI4 1
+RETI4
+ADDRGP4 $1156
+JUMPV
+LABELV $1173
+CNSTI4 0
+RETI4
+ADDRGP4 $1156
+JUMPV
+LABELV $1165
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $1175
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $1177
+CNSTI4 1
+RETI4
+ADDRGP4 $1156
+JUMPV
+LABELV $1177
+LABELV $1175
+LABELV $1162
+LABELV $1158
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1179
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 128
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $1181
+CNSTI4 0
+RETI4
+ADDRGP4 $1156
+JUMPV
+LABELV $1181
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 SenseCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $1183
+CNSTI4 0
+RETI4
+ADDRGP4 $1156
+JUMPV
+LABELV $1183
+LABELV $1179
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1185
+CNSTI4 1
+RETI4
+ADDRGP4 $1156
+JUMPV
+LABELV $1185
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+CNSTF4 1112014848
+GEF4 $1187
+CNSTI4 1
+RETI4
+ADDRGP4 $1156
+JUMPV
+LABELV $1187
+CNSTI4 0
+RETI4
+LABELV $1156
+endproc BotWantsToRetreat 140 8
+export BotWantsToChase
+proc BotWantsToChase 140 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $1190
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $1192
+CNSTI4 0
+RETI4
+ADDRGP4 $1189
+JUMPV
+LABELV $1192
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $1191
+CNSTI4 1
+RETI4
+ADDRGP4 $1189
+JUMPV
+LABELV $1190
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $1196
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $1198
+CNSTI4 0
+RETI4
+ADDRGP4 $1189
+JUMPV
+LABELV $1198
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 132
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $1197
+CNSTI4 1
+RETI4
+ADDRGP4 $1189
+JUMPV
+LABELV $1196
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $1202
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 13
+NEI4 $1203
+ADDRLP4 128
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1203
+ADDRLP4 128
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+EQI4 $1203
+CNSTI4 0
+RETI4
+ADDRGP4 $1189
+JUMPV
+LABELV $1202
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $1210
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $1212
+CNSTI4 0
+RETI4
+ADDRGP4 $1189
+JUMPV
+LABELV $1212
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 SenseCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $1214
+CNSTI4 1
+RETI4
+ADDRGP4 $1189
+JUMPV
+LABELV $1214
+LABELV $1210
+LABELV $1203
+LABELV $1197
+LABELV $1191
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1216
+CNSTI4 0
+RETI4
+ADDRGP4 $1189
+JUMPV
+LABELV $1216
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+CNSTF4 1112014848
+LEF4 $1218
+CNSTI4 1
+RETI4
+ADDRGP4 $1189
+JUMPV
+LABELV $1218
+CNSTI4 0
+RETI4
+LABELV $1189
+endproc BotWantsToChase 140 8
+export BotWantsToHelp
+proc BotWantsToHelp 0 0
+CNSTI4 1
+RETI4
+LABELV $1220
+endproc BotWantsToHelp 0 0
+export BotCanAndWantsToRocketJump
+proc BotCanAndWantsToRocketJump 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_rocketjump+12
+INDIRI4
+CNSTI4 0
+NEI4 $1222
+CNSTI4 0
+RETI4
+ADDRGP4 $1221
+JUMPV
+LABELV $1222
+ADDRFP4 0
+INDIRP4
+CNSTI4 17232
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $1225
+CNSTI4 0
+RETI4
+ADDRGP4 $1221
+JUMPV
+LABELV $1225
+ADDRFP4 0
+INDIRP4
+CNSTI4 17292
+ADDP4
+INDIRI4
+CNSTI4 3
+GEI4 $1227
+CNSTI4 0
+RETI4
+ADDRGP4 $1221
+JUMPV
+LABELV $1227
+ADDRFP4 0
+INDIRP4
+CNSTI4 17340
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1229
+CNSTI4 0
+RETI4
+ADDRGP4 $1221
+JUMPV
+LABELV $1229
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1231
+CNSTI4 0
+RETI4
+ADDRGP4 $1221
+JUMPV
+LABELV $1231
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 90
+GEI4 $1233
+ADDRFP4 0
+INDIRP4
+CNSTI4 17204
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1235
+CNSTI4 0
+RETI4
+ADDRGP4 $1221
+JUMPV
+LABELV $1235
+LABELV $1233
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 38
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 4
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1056964608
+GEF4 $1237
+CNSTI4 0
+RETI4
+ADDRGP4 $1221
+JUMPV
+LABELV $1237
+CNSTI4 1
+RETI4
+LABELV $1221
+endproc BotCanAndWantsToRocketJump 8 16
+export BotCanGrapple
+proc BotCanGrapple 4 0
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+NEI4 $1240
+CNSTI4 0
+RETI4
+ADDRGP4 $1239
+JUMPV
+LABELV $1240
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 bot_offhandgrapple+12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1243
+ADDRFP4 0
+INDIRP4
+CNSTI4 17256
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GTI4 $1243
+CNSTI4 0
+RETI4
+ADDRGP4 $1239
+JUMPV
+LABELV $1243
+CNSTI4 1
+RETI4
+LABELV $1239
+endproc BotCanGrapple 4 0
+export BotHasPersistantPowerupAndWeapon
+proc BotHasPersistantPowerupAndWeapon 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17364
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1247
+ADDRFP4 0
+INDIRP4
+CNSTI4 17368
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1247
+ADDRFP4 0
+INDIRP4
+CNSTI4 17372
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1247
+ADDRFP4 0
+INDIRP4
+CNSTI4 17376
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1247
+CNSTI4 0
+RETI4
+ADDRGP4 $1246
+JUMPV
+LABELV $1247
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $1249
+CNSTI4 0
+RETI4
+ADDRGP4 $1246
+JUMPV
+LABELV $1249
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $1251
+ADDRFP4 0
+INDIRP4
+CNSTI4 17204
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $1253
+CNSTI4 0
+RETI4
+ADDRGP4 $1246
+JUMPV
+LABELV $1253
+LABELV $1251
+ADDRFP4 0
+INDIRP4
+CNSTI4 17252
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1255
+ADDRFP4 0
+INDIRP4
+CNSTI4 17300
+ADDP4
+INDIRI4
+CNSTI4 7
+LEI4 $1255
+CNSTI4 1
+RETI4
+ADDRGP4 $1246
+JUMPV
+LABELV $1255
+ADDRFP4 0
+INDIRP4
+CNSTI4 17240
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1257
+ADDRFP4 0
+INDIRP4
+CNSTI4 17296
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1257
+CNSTI4 1
+RETI4
+ADDRGP4 $1246
+JUMPV
+LABELV $1257
+ADDRFP4 0
+INDIRP4
+CNSTI4 17236
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1259
+ADDRFP4 0
+INDIRP4
+CNSTI4 17288
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $1259
+CNSTI4 1
+RETI4
+ADDRGP4 $1246
+JUMPV
+LABELV $1259
+ADDRFP4 0
+INDIRP4
+CNSTI4 17232
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1261
+ADDRFP4 0
+INDIRP4
+CNSTI4 17292
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1261
+CNSTI4 1
+RETI4
+ADDRGP4 $1246
+JUMPV
+LABELV $1261
+ADDRFP4 0
+INDIRP4
+CNSTI4 17260
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1263
+ADDRFP4 0
+INDIRP4
+CNSTI4 17304
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1263
+CNSTI4 1
+RETI4
+ADDRGP4 $1246
+JUMPV
+LABELV $1263
+ADDRFP4 0
+INDIRP4
+CNSTI4 17264
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1265
+ADDRFP4 0
+INDIRP4
+CNSTI4 17308
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $1265
+CNSTI4 1
+RETI4
+ADDRGP4 $1246
+JUMPV
+LABELV $1265
+ADDRFP4 0
+INDIRP4
+CNSTI4 17268
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1267
+ADDRFP4 0
+INDIRP4
+CNSTI4 17312
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $1267
+CNSTI4 1
+RETI4
+ADDRGP4 $1246
+JUMPV
+LABELV $1267
+ADDRFP4 0
+INDIRP4
+CNSTI4 17244
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1269
+ADDRFP4 0
+INDIRP4
+CNSTI4 17284
+ADDP4
+INDIRI4
+CNSTI4 20
+LEI4 $1269
+CNSTI4 1
+RETI4
+ADDRGP4 $1246
+JUMPV
+LABELV $1269
+CNSTI4 0
+RETI4
+LABELV $1246
+endproc BotHasPersistantPowerupAndWeapon 40 0
+export BotGoCamp
+proc BotGoCamp 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18860
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18992
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18876
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 44
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065185444
+LEF4 $1272
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1203982208
+ADDF4
+ASGNF4
+ADDRGP4 $1273
+JUMPV
+LABELV $1272
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18996
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+CNSTF4 1127481344
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 12
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1273
+ADDRFP4 0
+INDIRP4
+CNSTI4 18440
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18856
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18428
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $1271
+endproc BotGoCamp 16 16
+export BotWantsToCamp
+proc BotWantsToCamp 160 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 44
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 128
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 1036831949
+GEF4 $1275
+CNSTI4 0
+RETI4
+ADDRGP4 $1274
+JUMPV
+LABELV $1275
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+EQI4 $1285
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+EQI4 $1285
+ADDRLP4 132
+INDIRI4
+CNSTI4 3
+EQI4 $1285
+ADDRLP4 132
+INDIRI4
+CNSTI4 4
+EQI4 $1285
+ADDRLP4 132
+INDIRI4
+CNSTI4 5
+EQI4 $1285
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+EQI4 $1285
+ADDRLP4 132
+INDIRI4
+CNSTI4 8
+EQI4 $1285
+ADDRLP4 132
+INDIRI4
+CNSTI4 9
+NEI4 $1277
+LABELV $1285
+CNSTI4 0
+RETI4
+ADDRGP4 $1274
+JUMPV
+LABELV $1277
+ADDRFP4 0
+INDIRP4
+CNSTI4 18440
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+CNSTF4 1133903872
+CNSTF4 1065353216
+ADDRLP4 124
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+LEF4 $1286
+CNSTI4 0
+RETI4
+ADDRGP4 $1274
+JUMPV
+LABELV $1286
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 124
+INDIRF4
+LEF4 $1288
+ADDRFP4 0
+INDIRP4
+CNSTI4 18440
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $1274
+JUMPV
+LABELV $1288
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotCanCamp
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $1290
+CNSTI4 0
+RETI4
+ADDRGP4 $1274
+JUMPV
+LABELV $1290
+ADDRLP4 64
+CNSTI4 99999
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotGetNextCampSpotGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRGP4 $1295
+JUMPV
+LABELV $1292
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRLP4 8+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 152
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1297
+ADDRLP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+GEI4 $1297
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1297
+LABELV $1293
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 148
+ADDRGP4 BotGetNextCampSpotGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+LABELV $1295
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1292
+ADDRLP4 64
+INDIRI4
+CNSTI4 150
+LEI4 $1299
+CNSTI4 0
+RETI4
+ADDRGP4 $1274
+JUMPV
+LABELV $1299
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 BotGoCamp
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18864
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $1274
+endproc BotWantsToCamp 160 16
+export BotDontAvoid
+proc BotDontAvoid 68 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $1303
+JUMPV
+LABELV $1302
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4+44
+INDIRI4
+ARGI4
+ADDRGP4 BotRemoveFromAvoidGoals
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $1303
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1302
+LABELV $1301
+endproc BotDontAvoid 68 12
+export BotGoForPowerups
+proc BotGoForPowerups 0 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1307
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1308
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1309
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1310
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1311
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18324
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1306
+endproc BotGoForPowerups 0 8
+export BotRoamGoal
+proc BotRoamGoal 160 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+LABELV $1313
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 116
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 92
+ADDRLP4 116
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 92
+INDIRF4
+CNSTF4 1048576000
+LEF4 $1317
+ADDRLP4 120
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $1319
+ADDRLP4 124
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 124
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 $1320
+JUMPV
+LABELV $1319
+ADDRLP4 128
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 128
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ADDF4
+ASGNF4
+LABELV $1320
+LABELV $1317
+ADDRLP4 92
+INDIRF4
+CNSTF4 1061158912
+GEF4 $1321
+ADDRLP4 120
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $1323
+ADDRLP4 124
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 124
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 $1324
+JUMPV
+LABELV $1323
+ADDRLP4 128
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 128
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ADDF4
+ASGNF4
+LABELV $1324
+LABELV $1321
+ADDRLP4 120
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1119879168
+CNSTF4 1073741824
+ADDRLP4 120
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRLP4 128
+CNSTP4 0
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 24+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24+12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24+12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 136
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 88
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRLP4 88
+INDIRF4
+CNSTF4 1128792064
+LEF4 $1335
+ADDRLP4 144
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDRLP4 144
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDRLP4 144
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+CNSTF4 1109393408
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 100
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 100+4
+ADDRLP4 12+4
+INDIRF4
+ASGNF4
+ADDRLP4 100+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1145569280
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 152
+CNSTP4 0
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRLP4 100
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 24+4
+INDIRI4
+CNSTI4 0
+NEI4 $1352
+ADDRLP4 24+12+8
+ADDRLP4 24+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 24+12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 24
+BANDI4
+CNSTI4 0
+NEI4 $1358
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRGP4 $1312
+JUMPV
+LABELV $1358
+LABELV $1352
+LABELV $1335
+LABELV $1314
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 10
+LTI4 $1313
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+LABELV $1312
+endproc BotRoamGoal 160 28
+lit
+align 4
+LABELV $1362
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotAttackMove
+code
+proc BotAttackMove 464 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRGP4 $1362
+INDIRB
+ASGNB 12
+ADDRLP4 320
+ADDRFP4 4
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 18380
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1363
+ADDRLP4 136+40
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 136+12
+ADDRFP4 4
+INDIRP4
+CNSTI4 18796
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+CNSTI4 18800
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 136+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 136+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 136+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 136+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 136+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 136+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 80
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 BotMoveToGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $1360
+JUMPV
+LABELV $1363
+ADDRLP4 80
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 52
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 416
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 416
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 37
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 420
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 328
+ADDRLP4 420
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 424
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 408
+ADDRLP4 424
+INDIRF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+CNSTF4 1045220557
+GEF4 $1377
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckBlockedTeammates
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $1360
+JUMPV
+LABELV $1377
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 320
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 192+24
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 192+24+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 192+24+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 432
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 432
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 24
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 24+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 24+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 18376
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1390
+ADDRLP4 436
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 436
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 328
+INDIRF4
+GEF4 $1392
+ADDRLP4 52
+CNSTI4 4
+ASGNI4
+ADDRGP4 $1393
+JUMPV
+LABELV $1392
+ADDRFP4 4
+INDIRP4
+CNSTI4 18376
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1394
+ADDRLP4 440
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 440
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 408
+INDIRF4
+GEF4 $1394
+ADDRFP4 4
+INDIRP4
+CNSTI4 18376
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 408
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1394
+LABELV $1393
+LABELV $1390
+ADDRFP4 4
+INDIRP4
+CNSTI4 18376
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1396
+ADDRLP4 332
+ADDRFP4 4
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+ASGNF4
+ADDRLP4 344
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 436
+CNSTP4 0
+ASGNP4
+ADDRLP4 436
+INDIRP4
+ARGP4
+ADDRLP4 436
+INDIRP4
+ARGP4
+ADDRLP4 192+24
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 344+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1404
+ADDRLP4 344+56
+INDIRI4
+ADDRLP4 320
+INDIRI4
+NEI4 $1400
+LABELV $1404
+ADDRLP4 52
+CNSTI4 2
+ASGNI4
+LABELV $1400
+LABELV $1396
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+NEI4 $1405
+ADDRFP4 4
+INDIRP4
+CNSTI4 18384
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1407
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1408
+JUMPV
+LABELV $1407
+ADDRFP4 4
+INDIRP4
+CNSTI4 18384
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $1408
+LABELV $1405
+ADDRFP4 4
+INDIRP4
+CNSTI4 312
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1409
+ADDRLP4 436
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+ADDRLP4 436
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 436
+INDIRF4
+ASGNF4
+ADDRGP4 $1410
+JUMPV
+LABELV $1409
+ADDRLP4 72
+CNSTF4 1124859904
+ASGNF4
+ADDRLP4 76
+CNSTF4 1109393408
+ASGNF4
+LABELV $1410
+ADDRLP4 132
+INDIRF4
+CNSTF4 1053609165
+GTF4 $1411
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDF4
+LEF4 $1413
+ADDRFP4 4
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 436
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 436
+INDIRI4
+CNSTI4 0
+EQI4 $1415
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $1360
+JUMPV
+LABELV $1415
+LABELV $1413
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+SUBF4
+GEF4 $1417
+ADDRFP4 4
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 436
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 436
+INDIRI4
+CNSTI4 0
+EQI4 $1419
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $1360
+JUMPV
+LABELV $1419
+LABELV $1417
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $1360
+JUMPV
+LABELV $1411
+ADDRLP4 440
+ADDRFP4 4
+INDIRP4
+CNSTI4 18372
+ADDP4
+ASGNP4
+ADDRLP4 440
+INDIRP4
+ADDRLP4 440
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 17152
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 324
+CNSTF4 1045220557
+CNSTF4 1065353216
+ADDRLP4 132
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1053609165
+ADDF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+CNSTF4 1060320051
+LEF4 $1421
+ADDRLP4 448
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 324
+ADDRLP4 324
+INDIRF4
+CNSTF4 1045220557
+CNSTF4 1073741824
+ADDRLP4 448
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1421
+ADDRFP4 4
+INDIRP4
+CNSTI4 18372
+ADDP4
+INDIRF4
+ADDRLP4 324
+INDIRF4
+LEF4 $1423
+ADDRLP4 452
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 452
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1064262697
+LEF4 $1425
+ADDRLP4 456
+ADDRFP4 4
+INDIRP4
+CNSTI4 18228
+ADDP4
+ASGNP4
+ADDRLP4 456
+INDIRP4
+ADDRLP4 456
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 18372
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1425
+LABELV $1423
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+LABELV $1427
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 24+4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 18228
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1434
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $1434
+ADDRLP4 452
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 452
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1063675494
+LEF4 $1440
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1441
+JUMPV
+LABELV $1440
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDF4
+LEF4 $1448
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1449
+JUMPV
+LABELV $1448
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+SUBF4
+GEF4 $1456
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1456
+LABELV $1449
+LABELV $1441
+ADDRFP4 4
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 456
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 456
+INDIRI4
+CNSTI4 0
+EQI4 $1464
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $1360
+JUMPV
+LABELV $1464
+ADDRLP4 460
+ADDRFP4 4
+INDIRP4
+CNSTI4 18228
+ADDP4
+ASGNP4
+ADDRLP4 460
+INDIRP4
+ADDRLP4 460
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 18372
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1428
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+LTI4 $1427
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+LABELV $1360
+endproc BotAttackMove 464 28
+export BotSameTeam
+proc BotSameTeam 20 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1469
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1467
+LABELV $1469
+CNSTI4 0
+RETI4
+ADDRGP4 $1466
+JUMPV
+LABELV $1467
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1472
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $1470
+LABELV $1472
+CNSTI4 0
+RETI4
+ADDRGP4 $1466
+JUMPV
+LABELV $1470
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+LTI4 $1473
+ADDRLP4 8
+CNSTI4 1596
+ASGNI4
+ADDRLP4 12
+ADDRGP4 level
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 636
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $1475
+CNSTI4 1
+RETI4
+ADDRGP4 $1466
+JUMPV
+LABELV $1475
+LABELV $1473
+CNSTI4 0
+RETI4
+LABELV $1466
+endproc BotSameTeam 20 0
+export InFieldOfVision
+proc InFieldOfVision 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1478
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $1482
+ADDRLP4 4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $1483
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+ADDRGP4 $1483
+JUMPV
+LABELV $1482
+ADDRLP4 4
+INDIRF4
+CNSTF4 3274964992
+GEF4 $1486
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $1486
+LABELV $1483
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+LEF4 $1488
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+MULF4
+LEF4 $1489
+CNSTI4 0
+RETI4
+ADDRGP4 $1477
+JUMPV
+LABELV $1488
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+NEGF4
+MULF4
+GEF4 $1492
+CNSTI4 0
+RETI4
+ADDRGP4 $1477
+JUMPV
+LABELV $1492
+LABELV $1489
+LABELV $1479
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $1478
+CNSTI4 1
+RETI4
+LABELV $1477
+endproc InFieldOfVision 32 4
+proc BotEntityLineOfSight 264 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 64
+ADDRFP4 12
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 204
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 64
+ADDRLP4 204
+INDIRF4
+ADDRLP4 64
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 204
+INDIRF4
+ADDRLP4 64+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 64+8
+CNSTF4 1056964608
+ADDRLP4 64+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 64
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 64
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 64+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 64+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 64
+INDIRB
+ASGNB 12
+ADDRLP4 136+12
+ADDRLP4 64
+INDIRB
+ASGNB 12
+ADDRLP4 136+12+8
+ADDRLP4 136+12+8
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 136+24
+ADDRLP4 136+12
+INDIRB
+ASGNB 12
+ADDRLP4 136+24+8
+ADDRLP4 136+24+8
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRLP4 188
+ADDRLP4 192
+INDIRI4
+CNSTI4 64
+BANDI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 192
+INDIRI4
+CNSTI4 56
+BANDI4
+ASGNI4
+ADDRLP4 132
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+LABELV $1512
+ADDRLP4 64
+CNSTI4 12
+ADDRLP4 80
+INDIRI4
+MULI4
+ADDRLP4 136
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 224
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $1516
+ADDRLP4 228
+ADDRGP4 botvisstats+12
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ADDRLP4 228
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1513
+JUMPV
+LABELV $1516
+ADDRLP4 76
+CNSTI4 65537
+ASGNI4
+ADDRLP4 108
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 112
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 84
+ADDRLP4 64
+INDIRB
+ASGNB 12
+ADDRLP4 64
+ARGP4
+ADDRLP4 228
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $1519
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 56
+BORI4
+ASGNI4
+LABELV $1519
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $1521
+ADDRLP4 76
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $1523
+ADDRLP4 108
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 112
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 64
+INDIRB
+ASGNB 12
+ADDRLP4 84
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $1523
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 56
+BXORI4
+ASGNI4
+LABELV $1521
+ADDRLP4 0
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRLP4 232
+CNSTP4 0
+ASGNP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 236
+ADDRGP4 botvisstats+16
+ASGNP4
+ADDRLP4 236
+INDIRP4
+ADDRLP4 236
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1526
+ADDRLP4 0+56
+INDIRI4
+ADDRFP4 8
+INDIRI4
+EQI4 $1526
+ADDRLP4 0+56
+INDIRI4
+CNSTI4 64
+GEI4 $1526
+ADDRFP4 16
+INDIRP4
+CNSTI4 1
+ASGNI4
+LABELV $1526
+ADDRLP4 176
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1535
+ADDRLP4 0+56
+INDIRI4
+ADDRLP4 112
+INDIRI4
+NEI4 $1531
+LABELV $1535
+ADDRLP4 64
+ARGP4
+ADDRLP4 240
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 240
+INDIRI4
+CNSTI4 64
+BANDI4
+ASGNI4
+ADDRLP4 244
+CNSTI4 0
+ASGNI4
+ADDRLP4 188
+INDIRI4
+ADDRLP4 244
+INDIRI4
+EQI4 $1536
+ADDRLP4 180
+INDIRI4
+ADDRLP4 244
+INDIRI4
+EQI4 $1536
+ADDRLP4 120
+ADDRLP4 0+12
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 0+12+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 0+12+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+ARGP4
+ADDRLP4 252
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 252
+INDIRF4
+ASGNF4
+ADDRGP4 $1537
+JUMPV
+LABELV $1536
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $1545
+ADDRLP4 96
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRLP4 248
+CNSTP4 0
+ASGNP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 252
+ADDRGP4 botvisstats+16
+ASGNP4
+ADDRLP4 252
+INDIRP4
+ADDRLP4 252
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 120
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+ARGP4
+ADDRLP4 260
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRGP4 $1546
+JUMPV
+LABELV $1545
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $1556
+ADDRLP4 84
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 248
+CNSTP4 0
+ASGNP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 252
+ADDRGP4 botvisstats+16
+ASGNP4
+ADDRLP4 252
+INDIRP4
+ADDRLP4 252
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 84
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+ARGP4
+ADDRLP4 256
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 256
+INDIRF4
+ASGNF4
+ADDRGP4 $1557
+JUMPV
+LABELV $1556
+ADDRLP4 172
+CNSTF4 0
+ASGNF4
+LABELV $1557
+LABELV $1546
+LABELV $1537
+ADDRLP4 252
+CNSTF4 1065353216
+ASGNF4
+CNSTF4 981668463
+ADDRLP4 172
+INDIRF4
+MULF4
+ADDRLP4 252
+INDIRF4
+GEF4 $1570
+ADDRLP4 248
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $1571
+JUMPV
+LABELV $1570
+ADDRLP4 248
+CNSTF4 981668463
+ADDRLP4 172
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1571
+ADDRLP4 116
+ADDRLP4 252
+INDIRF4
+ADDRLP4 248
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 116
+ADDRLP4 116
+INDIRF4
+ADDRLP4 176
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 116
+INDIRF4
+ADDRLP4 132
+INDIRF4
+LEF4 $1572
+ADDRLP4 132
+ADDRLP4 116
+INDIRF4
+ASGNF4
+LABELV $1572
+ADDRLP4 132
+INDIRF4
+CNSTF4 1064514355
+LTF4 $1574
+ADDRLP4 132
+INDIRF4
+RETF4
+ADDRGP4 $1494
+JUMPV
+LABELV $1574
+LABELV $1531
+LABELV $1513
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 3
+LTI4 $1512
+ADDRLP4 132
+INDIRF4
+RETF4
+LABELV $1494
+endproc BotEntityLineOfSight 264 28
+export BotBeginVisibilityFrame
+proc BotBeginVisibilityFrame 8 0
+ADDRLP4 0
+ADDRGP4 botvisframe
+ASGNP4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 botvisframeactive
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $1576
+endproc BotBeginVisibilityFrame 8 0
+export BotEndVisibilityFrame
+proc BotEndVisibilityFrame 0 0
+ADDRGP4 botvisframeactive
+CNSTI4 0
+ASGNI4
+LABELV $1577
+endproc BotEndVisibilityFrame 0 0
+export BotVisibilityStats
+proc BotVisibilityStats 0 28
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1579
+ADDRGP4 botvisstats
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 20
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $1578
+JUMPV
+LABELV $1579
+CNSTI4 1
+ARGI4
+ADDRGP4 $1581
+ARGP4
+ADDRGP4 botvisstats
+INDIRI4
+ARGI4
+ADDRGP4 botvisstats+4
+INDIRI4
+ARGI4
+ADDRGP4 botvisstats+8
+INDIRI4
+ARGI4
+ADDRGP4 botvisstats+12
+INDIRI4
+ARGI4
+ADDRGP4 botvisstats+16
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1578
+endproc BotVisibilityStats 0 28
+export BotEntityVisible
+proc BotEntityVisible 124 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $1590
+ADDRFP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $1587
+LABELV $1590
+CNSTI4 4
+ARGI4
+ADDRGP4 $1591
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTF4 0
+RETF4
+ADDRGP4 $1586
+JUMPV
+LABELV $1587
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1592
+CNSTF4 0
+RETF4
+ADDRGP4 $1586
+JUMPV
+LABELV $1592
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 32
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 32
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 88
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1056964608
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 32
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40+4
+ADDRLP4 4+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40+8
+ADDRLP4 4+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 60
+ARGP4
+ADDRLP4 100
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $1608
+CNSTF4 0
+RETF4
+ADDRGP4 $1586
+JUMPV
+LABELV $1608
+ADDRLP4 104
+ADDRGP4 botvisstats
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 botvisframeactive
+INDIRI4
+CNSTI4 0
+NEI4 $1610
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 108
+ADDRGP4 BotEntityLineOfSight
+CALLF4
+ASGNF4
+ADDRLP4 108
+INDIRF4
+RETF4
+ADDRGP4 $1586
+JUMPV
+LABELV $1610
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 trap_AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $1612
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 112
+ADDRGP4 BotEntityLineOfSight
+CALLF4
+ASGNF4
+ADDRLP4 112
+INDIRF4
+RETF4
+ADDRGP4 $1586
+JUMPV
+LABELV $1612
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1614
+ADDRLP4 112
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+DIVF4
+ARGF4
+ADDRLP4 116
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 112
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 116
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $1615
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1614
+ADDRLP4 28
+CNSTI4 73856093
+ADDRLP4 16
+INDIRI4
+MULI4
+CNSTI4 19349663
+ADDRLP4 16+4
+INDIRI4
+MULI4
+BXORI4
+CNSTI4 83492791
+ADDRLP4 16+8
+INDIRI4
+MULI4
+BXORI4
+CNSTI4 31
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDI4
+CNSTI4 67
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDI4
+CNSTI4 4095
+BANDI4
+CNSTI4 5
+LSHI4
+ADDRGP4 botviscache
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ADDRGP4 botvisframe
+INDIRI4
+NEI4 $1620
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRFP4 16
+INDIRI4
+NEI4 $1620
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $1620
+ADDRLP4 28
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $1620
+ADDRLP4 28
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 16+4
+INDIRI4
+NEI4 $1620
+ADDRLP4 28
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 16+8
+INDIRI4
+NEI4 $1620
+ADDRLP4 116
+ADDRGP4 botvisstats+4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $1625
+ADDRLP4 120
+ADDRGP4 botvisstats+8
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1625
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+RETF4
+ADDRGP4 $1586
+JUMPV
+LABELV $1620
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 116
+ADDRGP4 BotEntityLineOfSight
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $1628
+ADDRLP4 56
+INDIRF4
+RETF4
+ADDRGP4 $1586
+JUMPV
+LABELV $1628
+ADDRLP4 28
+INDIRP4
+ADDRGP4 botvisframe
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+RETF4
+LABELV $1586
+endproc BotEntityVisible 124 20
+export BotFindEnemy
+proc BotFindEnemy 184 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 46
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 64
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 45
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 68
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18236
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+LEI4 $1632
+ADDRLP4 72
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1633
+JUMPV
+LABELV $1632
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+LABELV $1633
+ADDRLP4 24
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18236
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1634
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 PowerupsCarryFlag
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $1636
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $1636
+CNSTI4 0
+RETI4
+ADDRGP4 $1630
+JUMPV
+LABELV $1636
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 SenseCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $1638
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $1638
+CNSTI4 0
+RETI4
+ADDRGP4 $1630
+JUMPV
+LABELV $1638
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18284
+ADDP4
+INDIRI4
+NEI4 $1640
+ADDRFP4 0
+INDIRP4
+CNSTI4 18288
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1640
+CNSTI4 0
+RETI4
+ADDRGP4 $1630
+JUMPV
+LABELV $1640
+ADDRLP4 4
+ADDRLP4 60
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 60
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 60
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 116
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRGP4 $1635
+JUMPV
+LABELV $1634
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+LABELV $1635
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $1644
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 1
+NEI4 $1646
+ADDRLP4 84
+ADDRGP4 blueobelisk
+ASGNP4
+ADDRGP4 $1647
+JUMPV
+LABELV $1646
+ADDRLP4 84
+ADDRGP4 redobelisk
+ASGNP4
+LABELV $1647
+ADDRLP4 88
+ADDRLP4 84
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 88+8
+ADDRLP4 88+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 100
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRLP4 172
+CNSTP4 0
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 100+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1653
+ADDRLP4 100+56
+INDIRI4
+ADDRLP4 84
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $1649
+LABELV $1653
+ADDRLP4 84
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+NEI4 $1654
+CNSTI4 0
+RETI4
+ADDRGP4 $1630
+JUMPV
+LABELV $1654
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+ADDRLP4 84
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18388
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18260
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18392
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18344
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $1630
+JUMPV
+LABELV $1649
+LABELV $1644
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1659
+JUMPV
+LABELV $1656
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $1661
+ADDRGP4 $1657
+JUMPV
+LABELV $1661
+ADDRLP4 16
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1663
+ADDRGP4 $1657
+JUMPV
+LABELV $1663
+CNSTI4 728
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 g_entities+352
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1665
+ADDRGP4 $1657
+JUMPV
+LABELV $1665
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $1668
+ADDRGP4 $1657
+JUMPV
+LABELV $1668
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 88
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1670
+ADDRGP4 $1657
+JUMPV
+LABELV $1670
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 PlayerIsDead
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+EQI4 $1672
+ADDRGP4 $1657
+JUMPV
+LABELV $1672
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 104
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 108
+CNSTF4 1165623296
+ADDRLP4 28
+INDIRF4
+MULF4
+CNSTF4 1147207680
+ADDF4
+ASGNF4
+ADDRLP4 104
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 108
+INDIRF4
+MULF4
+LEF4 $1676
+ADDRGP4 $1657
+JUMPV
+LABELV $1676
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+NEI4 $1678
+ADDRGP4 $1657
+JUMPV
+LABELV $1678
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 SenseIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+EQI4 $1680
+ADDRGP4 $1657
+JUMPV
+LABELV $1680
+ADDRLP4 40
+INDIRF4
+CNSTF4 1056964608
+GEF4 $1682
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1682
+ADDRGP4 $1657
+JUMPV
+LABELV $1682
+ADDRGP4 lastteleport_time
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+SUBF4
+LEF4 $1684
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 lastteleport_origin
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRGP4 lastteleport_origin+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRGP4 lastteleport_origin+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 120
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 120
+INDIRF4
+CNSTF4 1167663104
+GEF4 $1690
+ADDRGP4 $1657
+JUMPV
+LABELV $1690
+LABELV $1684
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 124
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 PowerupsCarryFlag
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $1694
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 SenseCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+NEI4 $1694
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1696
+ADDRLP4 20
+INDIRF4
+ADDRLP4 56
+INDIRF4
+LEF4 $1696
+ADDRGP4 $1657
+JUMPV
+LABELV $1696
+LABELV $1694
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 136
+INDIRI4
+GEI4 $1698
+ADDRLP4 24
+INDIRI4
+ADDRLP4 136
+INDIRI4
+NEI4 $1700
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 136
+INDIRI4
+EQI4 $1698
+LABELV $1700
+ADDRLP4 32
+CNSTF4 1135869952
+ASGNF4
+ADDRGP4 $1699
+JUMPV
+LABELV $1698
+ADDRLP4 32
+CNSTF4 1126170624
+ASGNF4
+LABELV $1699
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 0
+GTF4 $1701
+ADDRGP4 $1657
+JUMPV
+LABELV $1701
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 148
+INDIRI4
+GEI4 $1703
+ADDRLP4 20
+INDIRF4
+CNSTF4 1176256512
+LEF4 $1703
+ADDRLP4 24
+INDIRI4
+ADDRLP4 148
+INDIRI4
+NEI4 $1703
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 PowerupsCarryFlag
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $1703
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 SenseCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $1703
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 SenseIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $1705
+ADDRFP4 0
+INDIRP4
+CNSTI4 18852
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1705
+ADDRGP4 $1657
+JUMPV
+LABELV $1705
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_ActivateEntity
+CVPU4 4
+NEU4 $1707
+ADDRGP4 $1657
+JUMPV
+LABELV $1707
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTF4 1119092736
+ARGF4
+ADDRLP4 44
+ARGP4
+ADDRLP4 176
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+NEI4 $1711
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $1713
+ADDRGP4 $1657
+JUMPV
+LABELV $1713
+LABELV $1711
+LABELV $1703
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1715
+ADDRFP4 0
+INDIRP4
+CNSTI4 18388
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRGP4 $1716
+JUMPV
+LABELV $1715
+ADDRFP4 0
+INDIRP4
+CNSTI4 18388
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1716
+ADDRFP4 0
+INDIRP4
+CNSTI4 18260
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18392
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18344
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $1630
+JUMPV
+LABELV $1657
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1659
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $1656
+CNSTI4 0
+RETI4
+LABELV $1630
+endproc BotFindEnemy 184 28
+export BotTeamFlagCarrierVisible
+proc BotTeamFlagCarrierVisible 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1721
+JUMPV
+LABELV $1718
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $1723
+ADDRGP4 $1719
+JUMPV
+LABELV $1723
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1725
+ADDRGP4 $1719
+JUMPV
+LABELV $1725
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 PlayerCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1727
+ADDRGP4 $1719
+JUMPV
+LABELV $1727
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1729
+ADDRGP4 $1719
+JUMPV
+LABELV $1729
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GTF4 $1731
+ADDRGP4 $1719
+JUMPV
+LABELV $1731
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1717
+JUMPV
+LABELV $1719
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1721
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $1718
+CNSTI4 -1
+RETI4
+LABELV $1717
+endproc BotTeamFlagCarrierVisible 28 20
+export BotTeamFlagCarrier
+proc BotTeamFlagCarrier 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1737
+JUMPV
+LABELV $1734
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $1739
+ADDRGP4 $1735
+JUMPV
+LABELV $1739
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1741
+ADDRGP4 $1735
+JUMPV
+LABELV $1741
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 PlayerCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1743
+ADDRGP4 $1735
+JUMPV
+LABELV $1743
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1745
+ADDRGP4 $1735
+JUMPV
+LABELV $1745
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1733
+JUMPV
+LABELV $1735
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1737
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $1734
+CNSTI4 -1
+RETI4
+LABELV $1733
+endproc BotTeamFlagCarrier 16 8
+export BotEnemyFlagCarrierVisible
+proc BotEnemyFlagCarrierVisible 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1751
+JUMPV
+LABELV $1748
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $1753
+ADDRGP4 $1749
+JUMPV
+LABELV $1753
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1755
+ADDRGP4 $1749
+JUMPV
+LABELV $1755
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 PlayerCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1757
+ADDRGP4 $1749
+JUMPV
+LABELV $1757
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1759
+ADDRGP4 $1749
+JUMPV
+LABELV $1759
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GTF4 $1761
+ADDRGP4 $1749
+JUMPV
+LABELV $1761
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1747
+JUMPV
+LABELV $1749
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1751
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $1748
+CNSTI4 -1
+RETI4
+LABELV $1747
+endproc BotEnemyFlagCarrierVisible 28 20
+export BotVisibleTeamMatesAndEnemies
+proc BotVisibleTeamMatesAndEnemies 64 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1764
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1764
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1766
+ADDRFP4 8
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1766
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1771
+JUMPV
+LABELV $1768
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $1773
+ADDRGP4 $1769
+JUMPV
+LABELV $1773
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1775
+ADDRGP4 $1769
+JUMPV
+LABELV $1775
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 PlayerCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $1777
+ADDRGP4 $1769
+JUMPV
+LABELV $1777
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 4+4
+ADDRLP4 32
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 4+8
+ADDRLP4 36
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+LEF4 $1781
+ADDRGP4 $1769
+JUMPV
+LABELV $1781
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+GTF4 $1783
+ADDRGP4 $1769
+JUMPV
+LABELV $1783
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $1785
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1786
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1786
+JUMPV
+LABELV $1785
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1789
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1789
+LABELV $1786
+LABELV $1769
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1771
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $1768
+LABELV $1763
+endproc BotVisibleTeamMatesAndEnemies 64 20
+export BotCountTeamMates
+proc BotCountTeamMates 52 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $1795
+JUMPV
+LABELV $1792
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $1797
+ADDRGP4 $1793
+JUMPV
+LABELV $1797
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1799
+ADDRGP4 $1793
+JUMPV
+LABELV $1799
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+LEF4 $1803
+ADDRGP4 $1793
+JUMPV
+LABELV $1803
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $1805
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1805
+LABELV $1793
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1795
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $1792
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $1791
+endproc BotCountTeamMates 52 8
+export BotTeamCubeCarrierVisible
+proc BotTeamCubeCarrierVisible 32 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1811
+JUMPV
+LABELV $1808
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $1813
+ADDRGP4 $1809
+JUMPV
+LABELV $1813
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1815
+ADDRGP4 $1809
+JUMPV
+LABELV $1815
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 SenseCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1817
+ADDRGP4 $1809
+JUMPV
+LABELV $1817
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $1819
+ADDRGP4 $1809
+JUMPV
+LABELV $1819
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GTF4 $1821
+ADDRGP4 $1809
+JUMPV
+LABELV $1821
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1807
+JUMPV
+LABELV $1809
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1811
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $1808
+CNSTI4 -1
+RETI4
+LABELV $1807
+endproc BotTeamCubeCarrierVisible 32 20
+export BotEnemyCubeCarrierVisible
+proc BotEnemyCubeCarrierVisible 32 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1827
+JUMPV
+LABELV $1824
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $1829
+ADDRGP4 $1825
+JUMPV
+LABELV $1829
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1831
+ADDRGP4 $1825
+JUMPV
+LABELV $1831
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 BotSense
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 SenseCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1833
+ADDRGP4 $1825
+JUMPV
+LABELV $1833
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1835
+ADDRGP4 $1825
+JUMPV
+LABELV $1835
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GTF4 $1837
+ADDRGP4 $1825
+JUMPV
+LABELV $1837
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1823
+JUMPV
+LABELV $1825
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1827
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $1824
+CNSTI4 -1
+RETI4
+LABELV $1823
+endproc BotEnemyCubeCarrierVisible 32 20
+lit
+align 4
+LABELV $1840
+byte 4 3229614080
+byte 4 3229614080
+byte 4 3229614080
+align 4
+LABELV $1841
+byte 4 1082130432
+byte 4 1082130432
+byte 4 1082130432
+export BotAimAtEnemy
+code
+proc BotAimAtEnemy 1136 56
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 828
+ADDRGP4 $1840
+INDIRB
+ASGNB 12
+ADDRLP4 840
+ADDRGP4 $1841
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1842
+ADDRGP4 $1839
+JUMPV
+LABELV $1842
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1844
+ADDRLP4 792
+ADDRLP4 12+24
+INDIRB
+ASGNB 12
+ADDRLP4 952
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 952
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $1851
+ADDRLP4 952
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $1847
+LABELV $1851
+ADDRLP4 792+8
+ADDRLP4 792+8
+INDIRF4
+CNSTF4 1113587712
+ADDF4
+ASGNF4
+LABELV $1847
+ADDRLP4 0
+ADDRLP4 792
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 792+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17188
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 792+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17192
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18472
+ADDP4
+ADDRLP4 792
+INDIRB
+ASGNB 12
+ADDRGP4 $1839
+JUMPV
+LABELV $1844
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 952
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 724
+ADDRLP4 952
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 956
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 956
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18788
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+ARGP4
+ADDRGP4 BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 2
+NEI4 $1857
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 964
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 964
+INDIRF4
+ASGNF4
+ADDRGP4 $1858
+JUMPV
+LABELV $1857
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 3
+NEI4 $1860
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 9
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 964
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 964
+INDIRF4
+ASGNF4
+ADDRGP4 $1861
+JUMPV
+LABELV $1860
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 4
+NEI4 $1863
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 11
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 964
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 964
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 968
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 724
+ADDRLP4 968
+INDIRF4
+ASGNF4
+ADDRGP4 $1864
+JUMPV
+LABELV $1863
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 5
+NEI4 $1866
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 964
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 964
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 17
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 968
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 724
+ADDRLP4 968
+INDIRF4
+ASGNF4
+ADDRGP4 $1867
+JUMPV
+LABELV $1866
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 6
+NEI4 $1869
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 964
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 964
+INDIRF4
+ASGNF4
+ADDRGP4 $1870
+JUMPV
+LABELV $1869
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 7
+NEI4 $1872
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 14
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 964
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 964
+INDIRF4
+ASGNF4
+ADDRGP4 $1873
+JUMPV
+LABELV $1872
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 8
+NEI4 $1875
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 964
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 964
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 19
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 968
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 724
+ADDRLP4 968
+INDIRF4
+ASGNF4
+ADDRGP4 $1876
+JUMPV
+LABELV $1875
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 9
+NEI4 $1878
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 15
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 964
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 964
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 20
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 968
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 724
+ADDRLP4 968
+INDIRF4
+ASGNF4
+LABELV $1878
+LABELV $1876
+LABELV $1873
+LABELV $1870
+LABELV $1867
+LABELV $1864
+LABELV $1861
+LABELV $1858
+ADDRLP4 724
+INDIRF4
+CNSTF4 1064514355
+LEF4 $1881
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 964
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 824
+CNSTF4 1056964608
+ADDRLP4 964
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18388
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 824
+INDIRF4
+SUBF4
+LEF4 $1883
+ADDRGP4 $1839
+JUMPV
+LABELV $1883
+ADDRFP4 0
+INDIRP4
+CNSTI4 18436
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 824
+INDIRF4
+SUBF4
+LEF4 $1885
+ADDRGP4 $1839
+JUMPV
+LABELV $1885
+LABELV $1881
+ADDRLP4 144
+INDIRF4
+CNSTF4 0
+GTF4 $1887
+ADDRLP4 144
+CNSTF4 953267991
+ASGNF4
+LABELV $1887
+ADDRLP4 12
+ARGP4
+ADDRLP4 964
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 964
+INDIRI4
+CNSTI4 0
+EQI4 $1889
+ADDRLP4 968
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 968
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1036831949
+LEF4 $1891
+ADDRLP4 144
+CNSTF4 1053609165
+ADDRLP4 144
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1891
+LABELV $1889
+ADDRLP4 700
+ADDRLP4 12+24
+INDIRF4
+ADDRLP4 12+48
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 700+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRLP4 12+48+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 700+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRLP4 12+48+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 968
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 700
+ADDRLP4 700
+INDIRF4
+ADDRLP4 968
+INDIRF4
+ADDRLP4 12+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 700+4
+ADDRLP4 700+4
+INDIRF4
+ADDRLP4 968
+INDIRF4
+ADDRLP4 12+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 700+8
+ADDRLP4 700+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 12+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18396
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1912
+ADDRFP4 0
+INDIRP4
+CNSTI4 18396
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18484
+ADDP4
+ADDRLP4 700
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 18496
+ADDP4
+ADDRLP4 12+24
+INDIRB
+ASGNB 12
+LABELV $1912
+ADDRLP4 724
+INDIRF4
+CNSTF4 1063675494
+GEF4 $1915
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18496
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18500
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18504
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 976
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 976
+INDIRF4
+CNSTF4 1158676480
+LEF4 $1924
+ADDRFP4 0
+INDIRP4
+CNSTI4 18484
+ADDP4
+INDIRF4
+ADDRLP4 700
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18488
+ADDP4
+INDIRF4
+ADDRLP4 700+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18492
+ADDP4
+INDIRF4
+ADDRLP4 700+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $1926
+ADDRLP4 144
+CNSTF4 1060320051
+ADDRLP4 144
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1926
+LABELV $1924
+LABELV $1915
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 976
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 804
+ADDRLP4 976
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 804
+INDIRI4
+CNSTI4 0
+EQI4 $1930
+ADDRLP4 712
+ADDRLP4 12+24
+INDIRB
+ASGNB 12
+ADDRLP4 712+8
+ADDRLP4 712+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 812
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 812+8
+ADDRLP4 812+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 812+8
+ADDRLP4 812+8
+INDIRF4
+ADDRLP4 148+292+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 728
+ARGP4
+ADDRLP4 812
+ARGP4
+ADDRLP4 828
+ARGP4
+ADDRLP4 840
+ARGP4
+ADDRLP4 712
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 728+8
+INDIRF4
+CNSTF4 1065353216
+GTF4 $1938
+ADDRLP4 728+56
+INDIRI4
+ADDRLP4 12+20
+INDIRI4
+EQI4 $1938
+ADDRLP4 712+8
+ADDRLP4 712+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+LABELV $1938
+ADDRLP4 148+272
+INDIRF4
+CNSTF4 0
+EQF4 $1944
+ADDRLP4 0
+ADDRLP4 712
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 712+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 712+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 988
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 808
+ADDRLP4 988
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18496
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18500
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18504
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 808
+INDIRF4
+CNSTF4 1120403456
+LEF4 $1960
+ADDRLP4 0
+ARGP4
+ADDRLP4 996
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 996
+INDIRF4
+CNSTF4 1149239296
+LTF4 $1958
+LABELV $1960
+ADDRLP4 724
+INDIRF4
+CNSTF4 1061997773
+LEF4 $1961
+ADDRFP4 0
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1961
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1120
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 808
+ADDRLP4 1120
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRLP4 12+48
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRLP4 12+48+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRLP4 12+48+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1124
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 1124
+INDIRF4
+ADDRLP4 12+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 1124
+INDIRF4
+ADDRLP4 12+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 12+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 1000
+ADDRLP4 12+24
+INDIRB
+ASGNB 12
+ADDRLP4 1000+8
+ADDRLP4 1000+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 1128
+CNSTF4 0
+ASGNF4
+ADDRLP4 936+8
+ADDRLP4 1128
+INDIRF4
+ASGNF4
+ADDRLP4 936+4
+ADDRLP4 1128
+INDIRF4
+ASGNF4
+ADDRLP4 936
+ADDRLP4 1128
+INDIRF4
+ASGNF4
+ADDRLP4 1012
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1000
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 1132
+CNSTI4 0
+ASGNI4
+ADDRLP4 1132
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 936
+ARGP4
+ADDRLP4 1132
+INDIRI4
+ARGI4
+CNSTF4 1092616192
+ADDRLP4 808
+INDIRF4
+MULF4
+ADDRLP4 148+272
+INDIRF4
+DIVF4
+CVFI4 4
+ARGI4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 1132
+INDIRI4
+ARGI4
+ADDRLP4 1132
+INDIRI4
+ARGI4
+ADDRLP4 1132
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 trap_AAS_PredictPlayerMovement
+CALLI4
+pop
+ADDRLP4 712
+ADDRLP4 1012
+INDIRB
+ASGNB 12
+ADDRGP4 $1962
+JUMPV
+LABELV $1961
+ADDRLP4 724
+INDIRF4
+CNSTF4 1053609165
+LEF4 $1994
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1004
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 808
+ADDRLP4 1004
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRLP4 12+48
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRLP4 12+48+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRLP4 12+48+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1008
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 948
+ADDRLP4 1008
+INDIRF4
+ADDRLP4 12+16
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 1012
+ADDRLP4 808
+INDIRF4
+ASGNF4
+ADDRLP4 1016
+ADDRLP4 948
+INDIRF4
+ASGNF4
+ADDRLP4 712
+ADDRLP4 12+24
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 1012
+INDIRF4
+ADDRLP4 148+272
+INDIRF4
+DIVF4
+ADDRLP4 1016
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 712+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 1012
+INDIRF4
+ADDRLP4 148+272
+INDIRF4
+DIVF4
+ADDRLP4 1016
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 712+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 808
+INDIRF4
+ADDRLP4 148+272
+INDIRF4
+DIVF4
+ADDRLP4 948
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1994
+LABELV $1962
+LABELV $1958
+LABELV $1944
+ADDRLP4 724
+INDIRF4
+CNSTF4 1058642330
+LEF4 $2029
+ADDRLP4 148+344+180
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2029
+ADDRLP4 148+344+172
+INDIRF4
+CNSTF4 1112014848
+LEF4 $2029
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+GEF4 $2035
+ADDRLP4 12+24
+ARGP4
+ADDRLP4 984
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $2035
+ADDRLP4 924
+ADDRLP4 12+24
+INDIRB
+ASGNB 12
+ADDRLP4 924+8
+ADDRLP4 924+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 728
+ARGP4
+ADDRLP4 12+24
+ARGP4
+ADDRLP4 988
+CNSTP4 0
+ASGNP4
+ADDRLP4 988
+INDIRP4
+ARGP4
+ADDRLP4 988
+INDIRP4
+ARGP4
+ADDRLP4 924
+ARGP4
+ADDRLP4 12+20
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 912
+ADDRLP4 712
+INDIRB
+ASGNB 12
+ADDRLP4 728+4
+INDIRI4
+CNSTI4 0
+EQI4 $2044
+ADDRLP4 912+8
+ADDRLP4 12+24+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRGP4 $2045
+JUMPV
+LABELV $2044
+ADDRLP4 912+8
+ADDRLP4 728+12+8
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+LABELV $2045
+ADDRLP4 728
+ARGP4
+ADDRLP4 812
+ARGP4
+ADDRLP4 992
+CNSTP4 0
+ASGNP4
+ADDRLP4 992
+INDIRP4
+ARGP4
+ADDRLP4 992
+INDIRP4
+ARGP4
+ADDRLP4 912
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 728+12+8
+INDIRF4
+ADDRLP4 912+8
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 996
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 996
+INDIRF4
+CNSTF4 1112014848
+GEF4 $2053
+ADDRLP4 0
+ADDRLP4 728+12
+INDIRF4
+ADDRLP4 912
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 728+12+4
+INDIRF4
+ADDRLP4 912+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 728+12+8
+INDIRF4
+ADDRLP4 912+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1000
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1000
+INDIRF4
+CNSTF4 1163984896
+GEF4 $2067
+ADDRLP4 0
+ADDRLP4 728+12
+INDIRF4
+ADDRLP4 812
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 728+12+4
+INDIRF4
+ADDRLP4 812+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 728+12+8
+INDIRF4
+ADDRLP4 812+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1004
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1004
+INDIRF4
+CNSTF4 1176256512
+LEF4 $2078
+ADDRLP4 728+12+8
+ADDRLP4 728+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 728
+ARGP4
+ADDRLP4 728+12
+ARGP4
+ADDRLP4 1008
+CNSTP4 0
+ASGNP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+ADDRLP4 1008
+INDIRP4
+ARGP4
+ADDRLP4 12+24
+ARGP4
+ADDRLP4 12+20
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 728+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $2085
+ADDRLP4 712
+ADDRLP4 912
+INDIRB
+ASGNB 12
+LABELV $2085
+LABELV $2078
+LABELV $2067
+LABELV $2053
+LABELV $2035
+LABELV $2029
+ADDRLP4 984
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 712
+ADDRLP4 712
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 984
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 144
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 988
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 712+4
+ADDRLP4 712+4
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 988
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 144
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 992
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 712+8
+ADDRLP4 712+8
+INDIRF4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 992
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 144
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1931
+JUMPV
+LABELV $1930
+ADDRLP4 712
+ADDRFP4 0
+INDIRP4
+CNSTI4 18800
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 712+8
+ADDRLP4 712+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 724
+INDIRF4
+CNSTF4 1056964608
+LEF4 $2091
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 9
+EQI4 $2099
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 5
+EQI4 $2099
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 4
+NEI4 $2093
+LABELV $2099
+ADDRLP4 852+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 852+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 852
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 852+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 852+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 852+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 852+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 852+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 852+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18800
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18796
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 852
+ARGP4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 792
+ARGP4
+ADDRLP4 984
+ADDRGP4 BotPredictVisiblePosition
+CALLI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+CNSTI4 0
+EQI4 $2112
+ADDRLP4 0
+ADDRLP4 792
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 792+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17188
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 792+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17192
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 992
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 992
+INDIRF4
+CNSTF4 1170735104
+LEF4 $2118
+ADDRLP4 712
+ADDRLP4 792
+INDIRB
+ASGNB 12
+ADDRLP4 712+8
+ADDRLP4 712+8
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+LABELV $2118
+LABELV $2112
+ADDRLP4 144
+CNSTF4 1065353216
+ASGNF4
+LABELV $2093
+LABELV $2091
+LABELV $1931
+ADDRLP4 804
+INDIRI4
+CNSTI4 0
+EQI4 $2121
+ADDRLP4 728
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRLP4 984
+CNSTP4 0
+ASGNP4
+ADDRLP4 984
+INDIRP4
+ARGP4
+ADDRLP4 984
+INDIRP4
+ARGP4
+ADDRLP4 712
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18472
+ADDP4
+ADDRLP4 728+12
+INDIRB
+ASGNB 12
+ADDRGP4 $2122
+JUMPV
+LABELV $2121
+ADDRFP4 0
+INDIRP4
+CNSTI4 18472
+ADDP4
+ADDRLP4 712
+INDIRB
+ASGNB 12
+LABELV $2122
+ADDRLP4 0
+ADDRLP4 712
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 712+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17188
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 712+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17192
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 2
+EQI4 $2136
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 3
+EQI4 $2136
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 6
+EQI4 $2136
+ADDRLP4 148+4
+INDIRI4
+CNSTI4 7
+NEI4 $2128
+LABELV $2136
+ADDRLP4 0
+ARGP4
+ADDRLP4 984
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 808
+ADDRLP4 984
+INDIRF4
+ASGNF4
+ADDRLP4 808
+INDIRF4
+CNSTF4 1125515264
+LEF4 $2137
+ADDRLP4 808
+CNSTF4 1125515264
+ASGNF4
+LABELV $2137
+ADDRLP4 908
+CNSTF4 1053609165
+ADDRLP4 808
+INDIRF4
+CNSTF4 1125515264
+DIVF4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 144
+INDIRF4
+ADDRLP4 908
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2128
+ADDRLP4 144
+INDIRF4
+CNSTF4 1061997773
+GEF4 $2139
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+LABELV $2141
+ADDRLP4 984
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 988
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+ASGNP4
+ADDRLP4 988
+INDIRP4
+ADDRLP4 988
+INDIRP4
+INDIRF4
+CNSTF4 1050253722
+CNSTF4 1073741824
+ADDRLP4 984
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 144
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2142
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 3
+LTI4 $2141
+LABELV $2139
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 984
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 988
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ASGNP4
+ADDRLP4 988
+INDIRP4
+ADDRLP4 988
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 148+268
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 984
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 144
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 992
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ASGNP4
+ADDRLP4 992
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 996
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 992
+INDIRP4
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRLP4 1000
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1004
+ADDRFP4 0
+INDIRP4
+CNSTI4 18832
+ADDP4
+ASGNP4
+ADDRLP4 1004
+INDIRP4
+ADDRLP4 1004
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 148+264
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 1000
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 144
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1008
+ADDRFP4 0
+INDIRP4
+CNSTI4 18832
+ADDP4
+ASGNP4
+ADDRLP4 1008
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1012
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1008
+INDIRP4
+ADDRLP4 1012
+INDIRF4
+ASGNF4
+ADDRGP4 bot_challenge+12
+INDIRI4
+CNSTI4 0
+EQI4 $2147
+ADDRLP4 144
+INDIRF4
+CNSTF4 1063675494
+LEF4 $2150
+ADDRFP4 0
+INDIRP4
+CNSTI4 18388
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $2150
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $2152
+ADDRLP4 1016
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ASGNP4
+ADDRLP4 1016
+INDIRP4
+ADDRLP4 1016
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $2152
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+ADDRGP4 EA_View
+CALLV
+pop
+LABELV $2150
+LABELV $2147
+LABELV $1839
+endproc BotAimAtEnemy 1136 56
+lit
+align 4
+LABELV $2155
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $2156
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export BotCheckAttack
+code
+proc BotCheckAttack 980 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 896
+ADDRGP4 $2155
+INDIRB
+ASGNB 12
+ADDRLP4 908
+ADDRGP4 $2156
+INDIRB
+ASGNB 12
+ADDRLP4 576
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 576
+INDIRI4
+ARGI4
+ADDRLP4 748
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 576
+INDIRI4
+CNSTI4 64
+LTI4 $2157
+ADDRLP4 748+20
+INDIRI4
+ADDRGP4 redobelisk+40
+INDIRI4
+EQI4 $2165
+ADDRLP4 748+20
+INDIRI4
+ADDRGP4 blueobelisk+40
+INDIRI4
+NEI4 $2159
+LABELV $2165
+ADDRLP4 924
+CNSTI4 728
+ASGNI4
+ADDRLP4 924
+INDIRI4
+ADDRLP4 748+20
+INDIRI4
+MULI4
+ADDRGP4 g_entities+584
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2166
+ADDRLP4 924
+INDIRI4
+ADDRLP4 748+20
+INDIRI4
+MULI4
+ADDRGP4 g_entities+584
+ADDP4
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $2166
+ADDRGP4 $2154
+JUMPV
+LABELV $2166
+LABELV $2159
+LABELV $2157
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 924
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 680
+ADDRLP4 924
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18388
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 680
+INDIRF4
+SUBF4
+LEF4 $2172
+ADDRGP4 $2154
+JUMPV
+LABELV $2172
+ADDRFP4 0
+INDIRP4
+CNSTI4 18436
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 680
+INDIRF4
+SUBF4
+LEF4 $2174
+ADDRGP4 $2154
+JUMPV
+LABELV $2174
+ADDRFP4 0
+INDIRP4
+CNSTI4 18444
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+SUBF4
+LEF4 $2176
+ADDRGP4 $2154
+JUMPV
+LABELV $2176
+ADDRFP4 0
+INDIRP4
+CNSTI4 18448
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $2178
+ADDRGP4 $2154
+JUMPV
+LABELV $2178
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 47
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 928
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 880
+ADDRLP4 928
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18452
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $2180
+ADDRLP4 932
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 932
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 880
+INDIRF4
+LEF4 $2182
+ADDRFP4 0
+INDIRP4
+CNSTI4 18448
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 880
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18452
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2183
+JUMPV
+LABELV $2182
+ADDRFP4 0
+INDIRP4
+CNSTI4 18452
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ADDRLP4 880
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18448
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2183
+LABELV $2180
+ADDRLP4 580
+ADDRFP4 0
+INDIRP4
+CNSTI4 18472
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 580+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18476
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17188
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 580+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 18480
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17192
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $2186
+ADDRLP4 580
+ARGP4
+ADDRLP4 940
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 940
+INDIRF4
+CNSTF4 1163984896
+LEF4 $2188
+ADDRGP4 $2154
+JUMPV
+LABELV $2188
+LABELV $2186
+ADDRLP4 580
+ARGP4
+ADDRLP4 940
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 940
+INDIRF4
+CNSTF4 1176256512
+GEF4 $2190
+ADDRLP4 876
+CNSTF4 1123024896
+ASGNF4
+ADDRGP4 $2191
+JUMPV
+LABELV $2190
+ADDRLP4 876
+CNSTF4 1112014848
+ASGNF4
+LABELV $2191
+ADDRLP4 580
+ARGP4
+ADDRLP4 884
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+ADDRLP4 876
+INDIRF4
+ARGF4
+ADDRLP4 884
+ARGP4
+ADDRLP4 944
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 944
+INDIRI4
+CNSTI4 0
+NEI4 $2192
+ADDRGP4 $2154
+JUMPV
+LABELV $2192
+ADDRLP4 684
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRLP4 952
+CNSTP4 0
+ASGNP4
+ADDRLP4 952
+INDIRP4
+ARGP4
+ADDRLP4 952
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18472
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 684+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $2194
+ADDRLP4 684+56
+INDIRI4
+ADDRLP4 576
+INDIRI4
+EQI4 $2194
+ADDRGP4 $2154
+JUMPV
+LABELV $2194
+ADDRFP4 0
+INDIRP4
+CNSTI4 18788
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18812
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 656
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 656
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 656+4
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 656+8
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 24+292+8
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 964
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 668
+ADDRLP4 0
+INDIRF4
+ADDRLP4 964
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 668+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 964
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 668+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 968
+CNSTF4 3242196992
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 968
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 968
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3242196992
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 592
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 896
+ARGP4
+ADDRLP4 908
+ARGP4
+ADDRLP4 668
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 592+56
+INDIRI4
+CNSTI4 0
+LTI4 $2228
+ADDRLP4 592+56
+INDIRI4
+CNSTI4 64
+GEI4 $2228
+ADDRLP4 592+56
+INDIRI4
+ADDRLP4 576
+INDIRI4
+EQI4 $2232
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 592+56
+INDIRI4
+ARGI4
+ADDRLP4 972
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 972
+INDIRI4
+CNSTI4 0
+EQI4 $2235
+ADDRGP4 $2154
+JUMPV
+LABELV $2235
+LABELV $2232
+LABELV $2228
+ADDRLP4 592+56
+INDIRI4
+ADDRLP4 576
+INDIRI4
+NEI4 $2241
+ADDRLP4 576
+INDIRI4
+CNSTI4 64
+LTI4 $2238
+LABELV $2241
+ADDRLP4 24+344+180
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2242
+CNSTF4 1148846080
+ADDRLP4 592+8
+INDIRF4
+MULF4
+ADDRLP4 24+344+172
+INDIRF4
+GEF4 $2246
+ADDRLP4 976
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 920
+ADDRLP4 976
+INDIRF4
+ADDRLP4 24+344+168
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+ADDRLP4 976
+INDIRF4
+ADDRLP4 592+8
+INDIRF4
+MULF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 920
+INDIRF4
+CNSTF4 0
+LEF4 $2254
+ADDRGP4 $2154
+JUMPV
+LABELV $2254
+LABELV $2246
+LABELV $2242
+LABELV $2238
+ADDRLP4 24+176
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2256
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2257
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Attack
+CALLV
+pop
+ADDRGP4 $2257
+JUMPV
+LABELV $2256
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Attack
+CALLV
+pop
+LABELV $2257
+ADDRLP4 976
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+ASGNP4
+ADDRLP4 976
+INDIRP4
+ADDRLP4 976
+INDIRP4
+INDIRI4
+CNSTI4 2
+BXORI4
+ASGNI4
+LABELV $2154
+endproc BotCheckAttack 980 28
+lit
+align 4
+LABELV $2271
+byte 4 1143832576
+byte 4 1128792064
+byte 4 1139802112
+align 4
+LABELV $2272
+byte 4 1148321792
+byte 4 1139539968
+byte 4 1143603200
+align 4
+LABELV $2273
+byte 4 1134034944
+byte 4 1135607808
+byte 4 1147535360
+export BotMapScripts
+code
+proc BotMapScripts 1424 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRLP4 260
+ARGP4
+ADDRGP4 $2262
+ARGP4
+ADDRLP4 1304
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 132
+ARGP4
+ADDRLP4 1304
+INDIRP4
+ARGP4
+CNSTU4 127
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 132+127
+CNSTI1 0
+ASGNI1
+ADDRLP4 132
+ARGP4
+ADDRGP4 $2266
+ARGP4
+ADDRLP4 1308
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1308
+INDIRI4
+CNSTI4 0
+EQI4 $2270
+ADDRLP4 132
+ARGP4
+ADDRGP4 $2267
+ARGP4
+ADDRLP4 1312
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1312
+INDIRI4
+CNSTI4 0
+EQI4 $2270
+ADDRLP4 132
+ARGP4
+ADDRGP4 $2268
+ARGP4
+ADDRLP4 1316
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1316
+INDIRI4
+CNSTI4 0
+NEI4 $2264
+LABELV $2270
+ADDRLP4 1320
+ADDRGP4 $2271
+INDIRB
+ASGNB 12
+ADDRLP4 1332
+ADDRGP4 $2272
+INDIRB
+ASGNB 12
+ADDRLP4 1344
+ADDRGP4 $2273
+INDIRB
+ASGNB 12
+ADDRLP4 1356
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+ASGNP4
+ADDRLP4 1356
+INDIRP4
+ADDRLP4 1356
+INDIRP4
+INDIRI4
+CNSTI4 -16777217
+BANDI4
+ASGNI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 $2268
+ARGP4
+ADDRLP4 1360
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1360
+INDIRI4
+CNSTI4 0
+NEI4 $2274
+ADDRLP4 1320+8
+ADDRLP4 1320+8
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+ASGNF4
+ADDRLP4 1332+8
+ADDRLP4 1332+8
+INDIRF4
+CNSTF4 1115684864
+ADDF4
+ASGNF4
+LABELV $2274
+ADDRLP4 1364
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1364
+INDIRF4
+ADDRLP4 1320
+INDIRF4
+LEF4 $2278
+ADDRLP4 1364
+INDIRF4
+ADDRLP4 1332
+INDIRF4
+GEF4 $2278
+ADDRLP4 1368
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1368
+INDIRF4
+ADDRLP4 1320+4
+INDIRF4
+LEF4 $2280
+ADDRLP4 1368
+INDIRF4
+ADDRLP4 1332+4
+INDIRF4
+GEF4 $2280
+ADDRLP4 1372
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1372
+INDIRF4
+ADDRLP4 1320+8
+INDIRF4
+LEF4 $2284
+ADDRLP4 1372
+INDIRF4
+ADDRLP4 1332+8
+INDIRF4
+GEF4 $2284
+ADDRGP4 $2261
+JUMPV
+LABELV $2284
+LABELV $2280
+LABELV $2278
+ADDRLP4 1368
+CNSTI4 0
+ASGNI4
+ADDRLP4 1284
+ADDRLP4 1368
+INDIRI4
+ASGNI4
+ADDRLP4 128
+ADDRLP4 1368
+INDIRI4
+ASGNI4
+ADDRGP4 $2291
+JUMPV
+LABELV $2288
+ADDRLP4 128
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $2293
+ADDRGP4 $2289
+JUMPV
+LABELV $2293
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2295
+ADDRGP4 $2289
+JUMPV
+LABELV $2295
+ADDRLP4 0
+ARGP4
+ADDRLP4 1372
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 1372
+INDIRI4
+CNSTI4 0
+NEI4 $2300
+ADDRLP4 0+20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+NEI4 $2297
+LABELV $2300
+ADDRGP4 $2289
+JUMPV
+LABELV $2297
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 1320
+INDIRF4
+LEF4 $2301
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 1332
+INDIRF4
+GEF4 $2301
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 1320+4
+INDIRF4
+LEF4 $2305
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 1332+4
+INDIRF4
+GEF4 $2305
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 1320+8
+INDIRF4
+LEF4 $2313
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 1332+8
+INDIRF4
+GEF4 $2313
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 1376
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1376
+INDIRI4
+CNSTI4 0
+EQI4 $2321
+ADDRLP4 1284
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2290
+JUMPV
+LABELV $2321
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+LTI4 $2325
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+ADDRLP4 128
+INDIRI4
+NEI4 $2323
+LABELV $2325
+ADDRLP4 1284
+CNSTI4 1
+ASGNI4
+LABELV $2323
+LABELV $2313
+LABELV $2305
+LABELV $2301
+LABELV $2289
+ADDRLP4 128
+ADDRLP4 128
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2291
+ADDRLP4 128
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $2288
+LABELV $2290
+ADDRLP4 1284
+INDIRI4
+CNSTI4 0
+EQI4 $2326
+ADDRLP4 1372
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+ASGNP4
+ADDRLP4 1372
+INDIRP4
+ADDRLP4 1372
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRLP4 1288
+ADDRLP4 1344
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1288+4
+ADDRLP4 1344+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17188
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1288+8
+ADDRLP4 1344+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17192
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1288
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1380
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 1300
+ADDRLP4 1380
+INDIRF4
+ASGNF4
+ADDRLP4 1384
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1388
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ASGNP4
+ADDRLP4 1388
+INDIRP4
+ADDRLP4 1388
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+CNSTF4 1073741824
+ADDRLP4 1384
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 1300
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1392
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ASGNP4
+ADDRLP4 1392
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1396
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1392
+INDIRP4
+ADDRLP4 1396
+INDIRF4
+ASGNF4
+ADDRLP4 1400
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1404
+ADDRFP4 0
+INDIRP4
+CNSTI4 18832
+ADDP4
+ASGNP4
+ADDRLP4 1404
+INDIRP4
+ADDRLP4 1404
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+CNSTF4 1073741824
+ADDRLP4 1400
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 1300
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1408
+ADDRFP4 0
+INDIRP4
+CNSTI4 18832
+ADDP4
+ASGNP4
+ADDRLP4 1408
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1412
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1408
+INDIRP4
+ADDRLP4 1412
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRLP4 1420
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 1420
+INDIRI4
+CNSTI4 0
+EQI4 $2332
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Attack
+CALLV
+pop
+LABELV $2332
+LABELV $2326
+LABELV $2264
+LABELV $2261
+endproc BotMapScripts 1424 16
+data
+align 4
+LABELV VEC_UP
+byte 4 0
+byte 4 3212836864
+byte 4 0
+align 4
+LABELV MOVEDIR_UP
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV VEC_DOWN
+byte 4 0
+byte 4 3221225472
+byte 4 0
+align 4
+LABELV MOVEDIR_DOWN
+byte 4 0
+byte 4 0
+byte 4 3212836864
+export BotSetMovedir
+code
+proc BotSetMovedir 12 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 VEC_UP
+ARGP4
+ADDRLP4 0
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2335
+ADDRFP4 4
+INDIRP4
+ADDRGP4 MOVEDIR_UP
+INDIRB
+ASGNB 12
+ADDRGP4 $2336
+JUMPV
+LABELV $2335
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 VEC_DOWN
+ARGP4
+ADDRLP4 4
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2337
+ADDRFP4 4
+INDIRP4
+ADDRGP4 MOVEDIR_DOWN
+INDIRB
+ASGNB 12
+ADDRGP4 $2338
+JUMPV
+LABELV $2337
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $2338
+LABELV $2336
+LABELV $2334
+endproc BotSetMovedir 12 16
+export BotModelMinsMaxs
+proc BotModelMinsMaxs 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2343
+JUMPV
+LABELV $2340
+ADDRLP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2345
+ADDRGP4 $2341
+JUMPV
+LABELV $2345
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2347
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $2347
+ADDRGP4 $2341
+JUMPV
+LABELV $2347
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2349
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+EQI4 $2349
+ADDRGP4 $2341
+JUMPV
+LABELV $2349
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $2351
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2353
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2353
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2355
+ADDRFP4 16
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $2355
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $2339
+JUMPV
+LABELV $2351
+LABELV $2341
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ASGNP4
+LABELV $2343
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $2340
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2357
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $2357
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2359
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+LABELV $2359
+CNSTI4 0
+RETI4
+LABELV $2339
+endproc BotModelMinsMaxs 40 0
+lit
+align 4
+LABELV $2362
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $2363
+byte 4 3212836864
+byte 4 3212836864
+byte 4 3212836864
+export BotFuncButtonActivateGoal
+code
+proc BotFuncButtonActivateGoal 624 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 308
+ADDRGP4 $2362
+INDIRB
+ASGNB 12
+ADDRLP4 320
+ADDRGP4 $2363
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 544
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 544
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 544
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 544
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2364
+ARGP4
+ADDRLP4 148
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2365
+CNSTI4 0
+RETI4
+ADDRGP4 $2361
+JUMPV
+LABELV $2365
+ADDRLP4 148+1
+ARGP4
+ADDRLP4 548
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 292
+ADDRLP4 548
+INDIRI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+NEI4 $2368
+CNSTI4 0
+RETI4
+ADDRGP4 $2361
+JUMPV
+LABELV $2368
+ADDRLP4 292
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 552
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 344
+ADDRLP4 552
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2370
+ARGP4
+ADDRLP4 288
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 288
+INDIRF4
+CNSTF4 0
+NEF4 $2371
+ADDRLP4 288
+CNSTF4 1082130432
+ASGNF4
+LABELV $2371
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2373
+ARGP4
+ADDRLP4 352
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 276
+CNSTF4 0
+ASGNF4
+ADDRLP4 276+4
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRLP4 276+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 276
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotSetMovedir
+CALLV
+pop
+ADDRLP4 100
+ADDRLP4 84
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 72
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 556
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16
+ADDRLP4 556
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 556
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 1056964608
+ADDRLP4 16+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 560
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+INDIRF4
+ARGF4
+ADDRLP4 564
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4+8
+INDIRF4
+ARGF4
+ADDRLP4 568
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 560
+INDIRF4
+ADDRLP4 100
+INDIRF4
+MULF4
+ADDRLP4 564
+INDIRF4
+ADDRLP4 100+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 568
+INDIRF4
+ADDRLP4 100+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 288
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2396
+ARGP4
+ADDRLP4 348
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 348
+INDIRF4
+CNSTF4 0
+EQF4 $2397
+ADDRLP4 572
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 572
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 572
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 112
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 356
+ARGP4
+ADDRLP4 576
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 576
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRLP4 580
+CNSTP4 0
+ASGNP4
+ADDRLP4 580
+INDIRP4
+ARGP4
+ADDRLP4 580
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 576
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 356+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $2409
+ADDRLP4 356+56
+INDIRI4
+ADDRLP4 344
+INDIRI4
+NEI4 $2405
+LABELV $2409
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $2361
+JUMPV
+LABELV $2405
+CNSTI4 4
+ARGI4
+ADDRLP4 124
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2410
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $2414
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 584
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 588
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 584
+INDIRF4
+ADDRLP4 588
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2415
+JUMPV
+LABELV $2414
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 592
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 124
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 596
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 592
+INDIRF4
+ADDRLP4 596
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2415
+LABELV $2411
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2410
+ADDRLP4 584
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 584
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 584
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 296
+ADDRLP4 112
+INDIRB
+ASGNB 12
+ADDRLP4 296+8
+ADDRLP4 296+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 296
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1140850688
+SUBF4
+ASGNF4
+ADDRLP4 296
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 420
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 588
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 588
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2427
+JUMPV
+LABELV $2424
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 592
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 592
+INDIRI4
+CNSTI4 0
+EQI4 $2428
+ADDRGP4 $2426
+JUMPV
+LABELV $2428
+LABELV $2425
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2427
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $2424
+LABELV $2426
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $2430
+LABELV $2430
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $2432
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 420
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2434
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $2438
+ADDRLP4 592
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 592
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 596
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 320
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 600
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 604
+ADDRLP4 592
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 604
+INDIRP4
+ADDRLP4 604
+INDIRP4
+INDIRF4
+ADDRLP4 596
+INDIRF4
+ADDRLP4 600
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2439
+JUMPV
+LABELV $2438
+ADDRLP4 608
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 608
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 612
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 308
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 616
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 620
+ADDRLP4 608
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 620
+INDIRP4
+ADDRLP4 620
+INDIRP4
+INDIRF4
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2439
+LABELV $2435
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2434
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2361
+JUMPV
+LABELV $2432
+CNSTI4 0
+RETI4
+ADDRGP4 $2361
+JUMPV
+LABELV $2397
+CNSTI4 4
+ARGI4
+ADDRLP4 124
+ARGP4
+ADDRLP4 136
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2440
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $2444
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 572
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 576
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 572
+INDIRF4
+ADDRLP4 576
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2445
+JUMPV
+LABELV $2444
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 580
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 124
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 584
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 580
+INDIRF4
+ADDRLP4 584
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2445
+LABELV $2441
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2440
+ADDRLP4 572
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 112
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 572
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 572
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 296
+ADDRLP4 112
+INDIRB
+ASGNB 12
+ADDRLP4 296+8
+ADDRLP4 296+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 296
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 296
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 576
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 576
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2457
+JUMPV
+LABELV $2454
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 580
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 580
+INDIRI4
+CNSTI4 0
+EQI4 $2458
+ADDRGP4 $2456
+JUMPV
+LABELV $2458
+LABELV $2455
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2457
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LTI4 $2454
+LABELV $2456
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+GEI4 $2460
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2470
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $2474
+ADDRLP4 580
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 580
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 584
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 320
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 588
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 592
+ADDRLP4 580
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 592
+INDIRP4
+ADDRLP4 592
+INDIRP4
+INDIRF4
+ADDRLP4 584
+INDIRF4
+ADDRLP4 588
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $2475
+JUMPV
+LABELV $2474
+ADDRLP4 596
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 596
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 600
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 308
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 604
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 608
+ADDRLP4 596
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 608
+INDIRP4
+ADDRLP4 608
+INDIRP4
+INDIRF4
+ADDRLP4 600
+INDIRF4
+ADDRLP4 604
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $2475
+LABELV $2471
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $2470
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2361
+JUMPV
+LABELV $2460
+CNSTI4 0
+RETI4
+LABELV $2361
+endproc BotFuncButtonActivateGoal 624 28
+export BotFuncDoorActivateGoal
+proc BotFuncDoorActivateGoal 1080 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2364
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2477
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2477
+ADDRLP4 12+1
+ARGP4
+ADDRLP4 1068
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $2480
+CNSTI4 0
+RETI4
+ADDRGP4 $2476
+JUMPV
+LABELV $2480
+ADDRLP4 1060
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1048
+ARGP4
+ADDRLP4 1072
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRF4
+ADDRLP4 1048
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 1036+4
+INDIRF4
+ADDRLP4 1048+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 1036+8
+INDIRF4
+ADDRLP4 1048+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 1076
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1076
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 1076
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $2476
+endproc BotFuncDoorActivateGoal 1080 20
+export BotTriggerMultipleActivateGoal
+proc BotTriggerMultipleActivateGoal 284 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 260
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 260
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2364
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 84
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2493
+CNSTI4 0
+RETI4
+ADDRGP4 $2492
+JUMPV
+LABELV $2493
+ADDRLP4 84+1
+ARGP4
+ADDRLP4 264
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 224
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $2496
+CNSTI4 0
+RETI4
+ADDRGP4 $2492
+JUMPV
+LABELV $2496
+ADDRLP4 224
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1073741824
+ARGI4
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 252
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 272
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 272
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1056964608
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 212
+ADDRLP4 240
+INDIRB
+ASGNB 12
+ADDRLP4 212+8
+ADDRLP4 212+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 212
+INDIRB
+ASGNB 12
+ADDRLP4 228+8
+ADDRLP4 228+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 212
+ARGP4
+ADDRLP4 228
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 276
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2513
+JUMPV
+LABELV $2510
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $2514
+ADDRGP4 $2512
+JUMPV
+LABELV $2514
+LABELV $2511
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2513
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $2510
+LABELV $2512
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GEI4 $2516
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2492
+JUMPV
+LABELV $2516
+CNSTI4 0
+RETI4
+LABELV $2492
+endproc BotTriggerMultipleActivateGoal 284 20
+export BotPopFromActivateGoalStack
+proc BotPopFromActivateGoalStack 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2527
+CNSTI4 0
+RETI4
+ADDRGP4 $2526
+JUMPV
+LABELV $2527
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $2526
+endproc BotPopFromActivateGoalStack 4 8
+export BotPushOntoActivateGoalStack
+proc BotPushOntoActivateGoalStack 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1176255488
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2530
+CNSTI4 248
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2534
+CNSTI4 248
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $2536
+ADDRLP4 4
+CNSTI4 248
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $2536
+LABELV $2534
+LABELV $2531
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $2530
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+EQI4 $2538
+CNSTI4 248
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTU4 248
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 248
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 248
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+CNSTI4 244
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+CNSTI4 248
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $2529
+JUMPV
+LABELV $2538
+CNSTI4 0
+RETI4
+LABELV $2529
+endproc BotPushOntoActivateGoalStack 20 12
+export BotClearActivateGoalStack
+proc BotClearActivateGoalStack 0 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $2542
+JUMPV
+LABELV $2541
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+LABELV $2542
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2541
+LABELV $2540
+endproc BotClearActivateGoalStack 0 4
+export BotEnableActivateGoalAreas
+proc BotEnableActivateGoalAreas 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2548
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2549
+JUMPV
+LABELV $2548
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2549
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2545
+ADDRGP4 $2544
+JUMPV
+LABELV $2545
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2553
+JUMPV
+LABELV $2550
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_EnableRoutingArea
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $2554
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotRoutingAreaChanged
+CALLV
+pop
+LABELV $2554
+LABELV $2551
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2553
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+LTI4 $2550
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2557
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2558
+JUMPV
+LABELV $2557
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $2558
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $2544
+endproc BotEnableActivateGoalAreas 12 8
+export BotIsGoingToActivateEntity
+proc BotIsGoingToActivateEntity 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2563
+JUMPV
+LABELV $2560
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $2564
+ADDRGP4 $2561
+JUMPV
+LABELV $2564
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $2566
+CNSTI4 1
+RETI4
+ADDRGP4 $2559
+JUMPV
+LABELV $2566
+LABELV $2561
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2563
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2560
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2568
+CNSTI4 248
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2572
+ADDRGP4 $2569
+JUMPV
+LABELV $2572
+CNSTI4 248
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $2574
+CNSTI4 248
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19276
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $2576
+CNSTI4 1
+RETI4
+ADDRGP4 $2559
+JUMPV
+LABELV $2576
+LABELV $2574
+LABELV $2569
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $2568
+CNSTI4 0
+RETI4
+LABELV $2559
+endproc BotIsGoingToActivateEntity 8 0
+export BotGetActivateGoal
+proc BotGetActivateGoal 3296 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 248
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 3052
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 1712
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2579
+ARGP4
+ADDRLP4 3052+92
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 3228
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3228
+INDIRI4
+ASGNI4
+ADDRGP4 $2584
+JUMPV
+LABELV $2581
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2364
+ARGP4
+ADDRLP4 1584
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3232
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3232
+INDIRI4
+CNSTI4 0
+NEI4 $2585
+ADDRGP4 $2582
+JUMPV
+LABELV $2585
+ADDRLP4 1712
+ARGP4
+ADDRLP4 1584
+ARGP4
+ADDRLP4 3236
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3236
+INDIRI4
+CNSTI4 0
+NEI4 $2587
+ADDRGP4 $2583
+JUMPV
+LABELV $2587
+LABELV $2582
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3232
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3232
+INDIRI4
+ASGNI4
+LABELV $2584
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2581
+LABELV $2583
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2589
+CNSTI4 3
+ARGI4
+ADDRGP4 $2591
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2578
+JUMPV
+LABELV $2589
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2592
+ARGP4
+ADDRLP4 1456
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 1456
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2593
+CNSTI4 3
+ARGI4
+ADDRGP4 $2595
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2578
+JUMPV
+LABELV $2593
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2598
+ARGP4
+ADDRLP4 3236
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3236
+INDIRI4
+CNSTI4 0
+NEI4 $2596
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2396
+ARGP4
+ADDRLP4 3196
+ARGP4
+ADDRLP4 3240
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3240
+INDIRI4
+CNSTI4 0
+EQI4 $2599
+ADDRLP4 3196
+INDIRF4
+CNSTF4 0
+EQF4 $2601
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotFuncDoorActivateGoal
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2578
+JUMPV
+LABELV $2601
+LABELV $2599
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2603
+ARGP4
+ADDRLP4 3192
+ARGP4
+ADDRGP4 trap_AAS_IntForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 3192
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2604
+CNSTI4 0
+RETI4
+ADDRGP4 $2578
+JUMPV
+LABELV $2604
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2608
+ARGP4
+ADDRLP4 3180
+ARGP4
+ADDRLP4 3244
+ADDRGP4 trap_AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3244
+INDIRI4
+CNSTI4 0
+NEI4 $2606
+ADDRLP4 3248
+CNSTF4 0
+ASGNF4
+ADDRLP4 3180+8
+ADDRLP4 3248
+INDIRF4
+ASGNF4
+ADDRLP4 3180+4
+ADDRLP4 3248
+INDIRF4
+ASGNF4
+ADDRLP4 3180
+ADDRLP4 3248
+INDIRF4
+ASGNF4
+LABELV $2606
+ADDRLP4 3180
+ARGP4
+ADDRLP4 3052+24
+ARGP4
+ADDRLP4 3248
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 3248
+INDIRI4
+CNSTI4 0
+NEI4 $2611
+CNSTI4 0
+RETI4
+ADDRGP4 $2578
+JUMPV
+LABELV $2611
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2364
+ARGP4
+ADDRLP4 1712
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 1712
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2614
+ADDRLP4 1712+1
+ARGP4
+ADDRLP4 3252
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3200
+ADDRLP4 3252
+INDIRI4
+ASGNI4
+ADDRLP4 3200
+INDIRI4
+CNSTI4 0
+EQI4 $2617
+ADDRLP4 3200
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 3204
+ARGP4
+ADDRLP4 3216
+ARGP4
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+pop
+ADDRLP4 3204
+ARGP4
+ADDRLP4 3216
+ARGP4
+ADDRLP4 2740
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 3256
+ADDRGP4 trap_AAS_BBoxAreas
+CALLI4
+ASGNI4
+ADDRLP4 3048
+ADDRLP4 3256
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2622
+JUMPV
+LABELV $2619
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2623
+ADDRGP4 $2621
+JUMPV
+LABELV $2623
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3260
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+NEI4 $2625
+ADDRGP4 $2620
+JUMPV
+LABELV $2625
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2996
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 2996
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2627
+ADDRLP4 3268
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+ASGNP4
+ADDRLP4 3264
+ADDRLP4 3268
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 3268
+INDIRP4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 3272
+CNSTI4 2
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+ADDRLP4 3272
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3272
+INDIRI4
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2627
+LABELV $2620
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2622
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3048
+INDIRI4
+LTI4 $2619
+LABELV $2621
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2632
+JUMPV
+LABELV $2629
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2633
+ADDRGP4 $2631
+JUMPV
+LABELV $2633
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3260
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+EQI4 $2635
+ADDRGP4 $2630
+JUMPV
+LABELV $2635
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2996
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 2996
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2637
+ADDRLP4 3268
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+ASGNP4
+ADDRLP4 3264
+ADDRLP4 3268
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 3268
+INDIRP4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 3272
+CNSTI4 2
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+ADDRLP4 3272
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3272
+INDIRI4
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2637
+LABELV $2630
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2632
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3048
+INDIRI4
+LTI4 $2629
+LABELV $2631
+LABELV $2617
+LABELV $2614
+LABELV $2596
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2641
+ARGP4
+ADDRLP4 3240
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3240
+INDIRI4
+CNSTI4 0
+NEI4 $2639
+CNSTI4 0
+RETI4
+ADDRGP4 $2578
+JUMPV
+LABELV $2639
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2644
+ARGP4
+ADDRLP4 136
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3244
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3244
+INDIRI4
+CNSTI4 0
+NEI4 $2642
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $2645
+CNSTI4 3
+ARGI4
+ADDRGP4 $2648
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2645
+CNSTI4 0
+RETI4
+ADDRGP4 $2578
+JUMPV
+LABELV $2642
+CNSTI4 0
+ARGI4
+ADDRLP4 3248
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 1416
+ADDRLP4 3248
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2652
+JUMPV
+LABELV $2649
+ADDRLP4 0
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2656
+JUMPV
+LABELV $2653
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2659
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3252
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3252
+INDIRI4
+CNSTI4 0
+NEI4 $2657
+ADDRGP4 $2654
+JUMPV
+LABELV $2657
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 3256
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3256
+INDIRI4
+CNSTI4 0
+NEI4 $2660
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3260
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+ADDRLP4 3260
+INDIRI4
+ASGNI4
+ADDRGP4 $2655
+JUMPV
+LABELV $2660
+LABELV $2654
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3252
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3252
+INDIRI4
+ASGNI4
+LABELV $2656
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2653
+LABELV $2655
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2662
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $2664
+CNSTI4 3
+ARGI4
+ADDRGP4 $2667
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2664
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $2650
+JUMPV
+LABELV $2662
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2592
+ARGP4
+ADDRLP4 1456
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3256
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3256
+INDIRI4
+CNSTI4 0
+NEI4 $2668
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $2650
+CNSTI4 3
+ARGI4
+ADDRGP4 $2673
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2650
+JUMPV
+LABELV $2668
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2641
+ARGP4
+ADDRLP4 3260
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+NEI4 $2674
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 3264
+ADDRGP4 BotFuncButtonActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 0
+NEI4 $2676
+ADDRGP4 $2650
+JUMPV
+LABELV $2676
+ADDRLP4 3268
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 3268
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2678
+ADDRLP4 3268
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2678
+ADDRLP4 3272
+CNSTI4 44
+ASGNI4
+ADDRLP4 3268
+INDIRP4
+ADDRLP4 3272
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 3272
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $2678
+ADDRLP4 3276
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 3268
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 3276
+INDIRF4
+LEF4 $2678
+ADDRLP4 3268
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 3276
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $2678
+ADDRGP4 $2650
+JUMPV
+LABELV $2678
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3280
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3280
+INDIRI4
+CNSTI4 0
+EQI4 $2680
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3288
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 2736
+ADDRLP4 3288
+INDIRI4
+ASGNI4
+ADDRLP4 2736
+INDIRI4
+CNSTI4 0
+NEI4 $2682
+ADDRGP4 $2650
+JUMPV
+LABELV $2682
+ADDRFP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 2736
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $2680
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2578
+JUMPV
+LABELV $2674
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2686
+ARGP4
+ADDRLP4 3264
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 0
+NEI4 $2684
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 3268
+ADDRGP4 BotTriggerMultipleActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 3268
+INDIRI4
+CNSTI4 0
+NEI4 $2687
+ADDRGP4 $2650
+JUMPV
+LABELV $2687
+ADDRLP4 3272
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 3272
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2689
+ADDRLP4 3272
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $2689
+ADDRLP4 3276
+CNSTI4 44
+ASGNI4
+ADDRLP4 3272
+INDIRP4
+ADDRLP4 3276
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 3276
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $2689
+ADDRLP4 3280
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 3272
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 3280
+INDIRF4
+LEF4 $2689
+ADDRLP4 3272
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 3280
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $2689
+ADDRGP4 $2650
+JUMPV
+LABELV $2689
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3284
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3284
+INDIRI4
+CNSTI4 0
+EQI4 $2691
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3292
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 2736
+ADDRLP4 3292
+INDIRI4
+ASGNI4
+ADDRLP4 2736
+INDIRI4
+CNSTI4 0
+NEI4 $2693
+ADDRGP4 $2650
+JUMPV
+LABELV $2693
+ADDRFP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 2736
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $2691
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $2578
+JUMPV
+LABELV $2684
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2697
+ARGP4
+ADDRLP4 3268
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3268
+INDIRI4
+CNSTI4 0
+NEI4 $2695
+ADDRGP4 $2650
+JUMPV
+LABELV $2695
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2700
+ARGP4
+ADDRLP4 3272
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3272
+INDIRI4
+CNSTI4 0
+EQI4 $2702
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $2701
+ARGP4
+ADDRLP4 3276
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3276
+INDIRI4
+CNSTI4 0
+NEI4 $2698
+LABELV $2702
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2644
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136+128
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3280
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3280
+INDIRI4
+CNSTI4 0
+EQI4 $2703
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 3284
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+ADDRLP4 3284
+INDIRI4
+ASGNI4
+LABELV $2703
+LABELV $2698
+LABELV $2650
+LABELV $2652
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+LTI4 $2706
+ADDRLP4 132
+INDIRI4
+CNSTI4 10
+LTI4 $2649
+LABELV $2706
+CNSTI4 0
+RETI4
+LABELV $2578
+endproc BotGetActivateGoal 3296 20
+export BotGoForActivateGoal
+proc BotGoForActivateGoal 132 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $2708
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+LABELV $2708
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 240
+ADDP4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 BotPushOntoActivateGoalStack
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+EQI4 $2711
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2713
+ARGP4
+ADDRGP4 AIEnter_Seek_ActivateEntity
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2707
+JUMPV
+LABELV $2711
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $2707
+endproc BotGoForActivateGoal 132 8
+export BotPrintActivateGoalInfo
+proc BotPrintActivateGoalInfo 296 36
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 PlayerName
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $2592
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2715
+ADDRLP4 164
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $2717
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $2716
+JUMPV
+LABELV $2715
+ADDRLP4 164
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $2718
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $2716
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 164
+ARGP4
+ADDRGP4 EA_Say
+CALLV
+pop
+LABELV $2714
+endproc BotPrintActivateGoalInfo 296 36
+export BotRandomMove
+proc BotRandomMove 40 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1135869952
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $2722
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 36
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $2726
+ADDRGP4 $2724
+JUMPV
+LABELV $2726
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+CVFI4 4
+CNSTI4 45
+ADDI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+LABELV $2723
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+LTI4 $2722
+LABELV $2724
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+NEI4 $2731
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2732
+JUMPV
+LABELV $2731
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+LABELV $2732
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+LABELV $2719
+endproc BotRandomMove 40 16
+lit
+align 4
+LABELV $2734
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotCheckBlockedTeammates
+code
+proc BotCheckBlockedTeammates 424 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 284
+ADDRGP4 $2734
+INDIRB
+ASGNB 12
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+GEI4 $2735
+ADDRGP4 $2733
+JUMPV
+LABELV $2735
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 348
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $2738
+ADDRGP4 $2733
+JUMPV
+LABELV $2738
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 Bot1FCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $2740
+ADDRGP4 $2733
+JUMPV
+LABELV $2740
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 356
+ADDRGP4 BotHarvesterCarryingCubes
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $2742
+ADDRGP4 $2733
+JUMPV
+LABELV $2742
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2747
+JUMPV
+LABELV $2744
+ADDRLP4 152
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $2749
+ADDRGP4 $2745
+JUMPV
+LABELV $2749
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 360
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 360
+INDIRI4
+CNSTI4 0
+NEI4 $2751
+ADDRGP4 $2745
+JUMPV
+LABELV $2751
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2753
+ADDRGP4 $2745
+JUMPV
+LABELV $2753
+ADDRLP4 12
+ARGP4
+ADDRLP4 364
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+NEI4 $2758
+ADDRLP4 12+20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+NEI4 $2755
+LABELV $2758
+ADDRGP4 $2745
+JUMPV
+LABELV $2755
+ADDRLP4 280
+CNSTI4 1
+ASGNI4
+ADDRLP4 156
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 252
+CNSTF4 1128792064
+ASGNF4
+ADDRLP4 236
+CNSTI4 728
+ADDRLP4 152
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 368
+CNSTI4 8
+ASGNI4
+ADDRLP4 236
+INDIRP4
+ADDRLP4 368
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 368
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $2761
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18816
+ADDP4
+ARGP4
+CNSTF4 1119092736
+ARGF4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 376
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 376
+INDIRF4
+CNSTF4 0
+EQF4 $2759
+LABELV $2761
+ADDRLP4 156
+CNSTF4 1107296256
+ASGNF4
+LABELV $2759
+ADDRLP4 12
+ARGP4
+ADDRLP4 380
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 380
+INDIRI4
+CNSTI4 0
+NEI4 $2767
+ADDRLP4 12
+ARGP4
+ADDRLP4 384
+ADDRGP4 EntityCarriesCubes
+CALLI4
+ASGNI4
+ADDRLP4 388
+CNSTI4 0
+ASGNI4
+ADDRLP4 384
+INDIRI4
+ADDRLP4 388
+INDIRI4
+NEI4 $2767
+ADDRFP4 0
+INDIRP4
+CNSTI4 17364
+ADDP4
+INDIRI4
+ADDRLP4 388
+INDIRI4
+NEI4 $2767
+ADDRLP4 12+8
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 388
+INDIRI4
+EQI4 $2762
+LABELV $2767
+ADDRLP4 156
+CNSTF4 1124073472
+ASGNF4
+ADDRLP4 252
+CNSTF4 1137180672
+ASGNF4
+LABELV $2762
+ADDRLP4 156
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19268
+ADDP4
+INDIRF4
+LTF4 $2768
+ADDRLP4 392
+ADDRFP4 0
+INDIRP4
+CNSTI4 19268
+ADDP4
+ASGNP4
+ADDRLP4 392
+INDIRP4
+CNSTF4 1073741824
+ADDRLP4 392
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $2768
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 256
+ARGP4
+ADDRLP4 268
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 160+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 160+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 172
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 268
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33619969
+ARGI4
+ADDRGP4 trap_ClipToEntities
+CALLV
+pop
+ADDRLP4 172+56
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $2782
+ADDRLP4 172+4
+INDIRI4
+CNSTI4 0
+NEI4 $2787
+ADDRLP4 172+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $2782
+LABELV $2787
+ADDRFP4 0
+INDIRP4
+CNSTI4 18376
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18828
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 284
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 240+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 240
+ADDRLP4 236
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 240
+INDIRF4
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDRLP4 240+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 240+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 3259498496
+LEF4 $2789
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $2789
+ADDRLP4 408
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+ADDRLP4 408
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 408
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+CNSTF4 3212836864
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+ADDRLP4 252
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRLP4 412
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 412
+INDIRI4
+CNSTI4 0
+NEI4 $2805
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+ADDRLP4 252
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRLP4 416
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 416
+INDIRI4
+CNSTI4 0
+NEI4 $2811
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 252
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRLP4 420
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 420
+INDIRI4
+CNSTI4 0
+NEI4 $2813
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+ARGP4
+ADDRLP4 252
+INDIRF4
+ARGF4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+LABELV $2813
+LABELV $2811
+LABELV $2805
+LABELV $2782
+LABELV $2745
+ADDRLP4 152
+ADDRLP4 152
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2747
+ADDRLP4 152
+INDIRI4
+ADDRGP4 level+28
+INDIRI4
+LTI4 $2744
+LABELV $2733
+endproc BotCheckBlockedTeammates 424 28
+lit
+align 4
+LABELV $2816
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotAIBlocked
+code
+proc BotAIBlocked 604 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 200
+ADDRGP4 $2816
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2817
+ADDRFP4 0
+INDIRP4
+CNSTI4 18456
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $2815
+JUMPV
+LABELV $2817
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 564
+ADDRGP4 BotWantsToWalk
+CALLI4
+ASGNI4
+ADDRLP4 564
+INDIRI4
+CNSTI4 0
+NEI4 $2819
+ADDRLP4 168
+CNSTF4 1137180672
+ASGNF4
+ADDRGP4 $2820
+JUMPV
+LABELV $2819
+ADDRLP4 168
+CNSTF4 1128792064
+ASGNF4
+LABELV $2820
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $2821
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+ADDRGP4 $2815
+JUMPV
+LABELV $2821
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 164
+CNSTI4 728
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 36+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 36+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 36+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 164
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2830
+ADDRLP4 164
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 176
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 176+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 176+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GTF4 $2838
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 572
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 572
+INDIRI4
+CNSTI4 0
+NEI4 $2832
+LABELV $2838
+CNSTI4 2
+ARGI4
+ADDRLP4 224
+ARGP4
+ADDRLP4 236
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 580
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 212
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+INDIRF4
+ADDRLP4 580
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 212+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17160
+ADDP4
+INDIRF4
+ADDRLP4 580
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 212+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 17164
+ADDP4
+INDIRF4
+CNSTF4 1103101952
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 248
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRLP4 224
+ARGP4
+ADDRLP4 236
+ARGP4
+ADDRLP4 212
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33619969
+ARGI4
+ADDRGP4 trap_ClipToEntities
+CALLV
+pop
+ADDRLP4 248+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $2843
+ADDRGP4 $2815
+JUMPV
+LABELV $2843
+LABELV $2832
+ADDRLP4 576
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+ASGNP4
+ADDRLP4 576
+INDIRP4
+ADDRLP4 576
+INDIRP4
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+ADDRGP4 $2831
+JUMPV
+LABELV $2830
+ADDRLP4 36+92
+INDIRI4
+CNSTI4 0
+LEI4 $2846
+ADDRLP4 36+92
+INDIRI4
+ADDRGP4 max_bspmodelindex
+INDIRI4
+GTI4 $2846
+ADDRLP4 164
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $2598
+ARGP4
+ADDRLP4 572
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 576
+CNSTI4 0
+ASGNI4
+ADDRLP4 572
+INDIRI4
+ADDRLP4 576
+INDIRI4
+NEI4 $2850
+ADDRLP4 164
+INDIRP4
+CNSTI4 392
+ADDP4
+INDIRI4
+ADDRLP4 576
+INDIRI4
+NEI4 $2850
+ADDRLP4 164
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2852
+ADDRLP4 164
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2852
+ADDRGP4 $2815
+JUMPV
+LABELV $2852
+LABELV $2850
+ADDRLP4 164
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $2641
+ARGP4
+ADDRLP4 580
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 584
+CNSTI4 0
+ASGNI4
+ADDRLP4 580
+INDIRI4
+ADDRLP4 584
+INDIRI4
+NEI4 $2854
+ADDRLP4 164
+INDIRP4
+CNSTI4 392
+ADDP4
+INDIRI4
+ADDRLP4 584
+INDIRI4
+NEI4 $2854
+ADDRGP4 $2815
+JUMPV
+LABELV $2854
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2856
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36+20
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+ADDRLP4 588
+ADDRGP4 BotGetActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 560
+ADDRLP4 588
+INDIRI4
+ASGNI4
+ADDRLP4 560
+INDIRI4
+CNSTI4 0
+EQI4 $2859
+ADDRLP4 592
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 592
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2861
+ADDRLP4 592
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $2861
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2861
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 312+4+40
+INDIRI4
+ARGI4
+ADDRLP4 596
+ADDRGP4 BotIsGoingToActivateEntity
+CALLI4
+ASGNI4
+ADDRLP4 596
+INDIRI4
+CNSTI4 0
+NEI4 $2863
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 312
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotGoForActivateGoal
+CALLI4
+pop
+LABELV $2863
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $2860
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 600
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 600
+INDIRI4
+CNSTI4 0
+EQI4 $2860
+ADDRGP4 $2815
+JUMPV
+LABELV $2859
+ADDRLP4 312
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+LABELV $2860
+LABELV $2856
+LABELV $2846
+LABELV $2831
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 576
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 576
+INDIRF4
+CNSTF4 1036831949
+GEF4 $2871
+ADDRLP4 188
+CNSTF4 0
+ASGNF4
+ADDRLP4 580
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 188+4
+CNSTF4 1135869952
+ADDRLP4 580
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 188+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 188
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 584
+CNSTP4 0
+ASGNP4
+ADDRLP4 584
+INDIRP4
+ARGP4
+ADDRLP4 584
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $2871
+ADDRLP4 172
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2875
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 24+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $2875
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 580
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 580
+INDIRI4
+CNSTI4 0
+NEI4 $2881
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 584
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 584
+INDIRI4
+CNSTI4 0
+NEI4 $2883
+ADDRLP4 588
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+ASGNP4
+ADDRLP4 588
+INDIRP4
+ADDRLP4 588
+INDIRP4
+INDIRI4
+CNSTI4 16
+BXORI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 24+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 172
+INDIRI4
+ARGI4
+ADDRLP4 592
+ADDRGP4 BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 592
+INDIRI4
+CNSTI4 0
+NEI4 $2889
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+LABELV $2889
+LABELV $2883
+LABELV $2881
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2891
+ADDRFP4 0
+INDIRP4
+CNSTI4 18456
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1053609165
+SUBF4
+GEF4 $2893
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_NBG
+CVPU4 4
+NEU4 $2895
+ADDRFP4 0
+INDIRP4
+CNSTI4 18328
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2896
+JUMPV
+LABELV $2895
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_LTG
+CVPU4 4
+NEU4 $2897
+ADDRFP4 0
+INDIRP4
+CNSTI4 18324
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2897
+LABELV $2896
+LABELV $2893
+LABELV $2891
+LABELV $2815
+endproc BotAIBlocked 604 28
+export BotAIPredictObstacles
+proc BotAIPredictObstacles 328 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 bot_predictobstacles+12
+INDIRI4
+CNSTI4 0
+NEI4 $2900
+CNSTI4 0
+RETI4
+ADDRGP4 $2899
+JUMPV
+LABELV $2900
+ADDRFP4 0
+INDIRP4
+CNSTI4 18468
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $2903
+ADDRFP4 0
+INDIRP4
+CNSTI4 18464
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+LEF4 $2903
+CNSTI4 0
+RETI4
+ADDRGP4 $2899
+JUMPV
+LABELV $2903
+ADDRFP4 0
+INDIRP4
+CNSTI4 18468
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18464
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100
+ARGI4
+CNSTI4 1000
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTI4 1024
+ARGI4
+CNSTI4 67108864
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_AAS_PredictRoute
+CALLI4
+pop
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $2905
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2906
+ADDRLP4 304
+CNSTI4 24
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 255
+ADDRLP4 304
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 304
+INDIRI4
+RSHI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $2906
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 308
+CNSTP4 0
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $2906
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 48
+ARGP4
+ADDRLP4 316
+ADDRGP4 BotGetActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $2906
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 320
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2918
+ADDRLP4 320
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $2918
+ADDRFP4 0
+INDIRP4
+CNSTI4 19272
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2918
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48+4+40
+INDIRI4
+ARGI4
+ADDRLP4 324
+ADDRGP4 BotIsGoingToActivateEntity
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+NEI4 $2920
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotGoForActivateGoal
+CALLI4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2899
+JUMPV
+LABELV $2920
+ADDRLP4 48
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRGP4 $2906
+JUMPV
+LABELV $2905
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2924
+ADDRLP4 0+24
+INDIRI4
+CNSTI4 67108864
+BANDI4
+CNSTI4 0
+EQI4 $2927
+LABELV $2927
+LABELV $2924
+LABELV $2906
+CNSTI4 0
+RETI4
+LABELV $2899
+endproc BotAIPredictObstacles 328 44
+export BotCheckConsoleMessages
+proc BotCheckConsoleMessages 1016 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 912
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 PlayerName
+CALLP4
+pop
+ADDRGP4 $2932
+JUMPV
+LABELV $2931
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 952
+ADDRGP4 BotNumConsoleMessages
+CALLI4
+ASGNI4
+ADDRLP4 952
+INDIRI4
+CNSTI4 10
+GEI4 $2934
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $2936
+ADDRLP4 956
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 956
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1065353216
+ADDF4
+SUBF4
+LEF4 $2936
+ADDRGP4 $2933
+JUMPV
+LABELV $2936
+LABELV $2934
+ADDRLP4 280
+ADDRLP4 0+12
+ASGNP4
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $2941
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 292
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRLP4 956
+ADDRGP4 BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 956
+INDIRI4
+CNSTI4 0
+EQI4 $2944
+ADDRLP4 280
+ADDRLP4 292+264+16
+INDIRI1
+CVII4 1
+ADDRLP4 0+12
+ADDP4
+ASGNP4
+LABELV $2944
+LABELV $2941
+ADDRLP4 280
+INDIRP4
+ARGP4
+ADDRGP4 UnifyWhiteSpaces
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 956
+ADDRGP4 BotSynonymContext
+CALLI4
+ASGNI4
+ADDRLP4 288
+ADDRLP4 956
+INDIRI4
+ASGNI4
+ADDRLP4 280
+INDIRP4
+ARGP4
+ADDRLP4 288
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 BotReplaceSynonyms
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 960
+ADDRGP4 BotMatchMessage
+CALLI4
+ASGNI4
+ADDRLP4 960
+INDIRI4
+CNSTI4 0
+NEI4 $2950
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $2953
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+NEI4 $2953
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 292
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRLP4 964
+ADDRGP4 BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 964
+INDIRI4
+CNSTI4 0
+NEI4 $2957
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRGP4 BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $2932
+JUMPV
+LABELV $2957
+ADDRLP4 292+260
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $2960
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRGP4 BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $2932
+JUMPV
+LABELV $2960
+ADDRLP4 292
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 876
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 BotMatchVariable
+CALLV
+pop
+ADDRLP4 292
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 620
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 BotMatchVariable
+CALLV
+pop
+ADDRLP4 876
+ARGP4
+ADDRLP4 968
+ADDRGP4 PlayerFromName
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRLP4 968
+INDIRI4
+NEI4 $2963
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRGP4 BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $2932
+JUMPV
+LABELV $2963
+ADDRLP4 620
+ARGP4
+ADDRGP4 UnifyWhiteSpaces
+CALLV
+pop
+ADDRGP4 bot_testrchat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testrchat+12
+INDIRI4
+CNSTI4 0
+EQI4 $2965
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 620
+ARGP4
+ADDRLP4 288
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 972
+CNSTP4 0
+ASGNP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRLP4 972
+INDIRP4
+ARGP4
+ADDRLP4 912
+ARGP4
+ADDRLP4 876
+ARGP4
+ADDRLP4 976
+ADDRGP4 BotReplyChat
+CALLI4
+ASGNI4
+ADDRLP4 976
+INDIRI4
+CNSTI4 0
+EQI4 $2968
+CNSTI4 1
+ARGI4
+ADDRGP4 $2970
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2966
+JUMPV
+LABELV $2968
+CNSTI4 1
+ARGI4
+ADDRGP4 $2971
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2966
+JUMPV
+LABELV $2965
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Stand
+CVPU4 4
+EQU4 $2972
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 976
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 976
+INDIRI4
+CNSTI4 0
+EQI4 $2972
+ADDRLP4 980
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 980
+INDIRI4
+CNSTI4 0
+NEI4 $2972
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 35
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 984
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 948
+ADDRLP4 984
+INDIRF4
+ASGNF4
+ADDRLP4 988
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 992
+ADDRGP4 NumBots
+CALLI4
+ASGNI4
+ADDRLP4 988
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1069547520
+ADDRLP4 992
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+DIVF4
+GEF4 $2974
+ADDRLP4 996
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 996
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 948
+INDIRF4
+GEF4 $2974
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 620
+ARGP4
+ADDRLP4 288
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 1000
+CNSTP4 0
+ASGNP4
+ADDRLP4 1000
+INDIRP4
+ARGP4
+ADDRLP4 1000
+INDIRP4
+ARGP4
+ADDRLP4 1000
+INDIRP4
+ARGP4
+ADDRLP4 1000
+INDIRP4
+ARGP4
+ADDRLP4 1000
+INDIRP4
+ARGP4
+ADDRLP4 1000
+INDIRP4
+ARGP4
+ADDRLP4 912
+ARGP4
+ADDRLP4 876
+ARGP4
+ADDRLP4 1004
+ADDRGP4 BotReplyChat
+CALLI4
+ASGNI4
+ADDRLP4 1004
+INDIRI4
+CNSTI4 0
+EQI4 $2976
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRGP4 BotRemoveConsoleMessage
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1012
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18352
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 1012
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2978
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+ADDRGP4 $2933
+JUMPV
+LABELV $2976
+LABELV $2974
+LABELV $2972
+LABELV $2966
+LABELV $2953
+LABELV $2950
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRGP4 BotRemoveConsoleMessage
+CALLV
+pop
+LABELV $2932
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 952
+ADDRGP4 BotNextConsoleMessage
+CALLI4
+ASGNI4
+ADDRLP4 284
+ADDRLP4 952
+INDIRI4
+ASGNI4
+ADDRLP4 952
+INDIRI4
+CNSTI4 0
+NEI4 $2931
+LABELV $2933
+LABELV $2930
+endproc BotCheckConsoleMessages 1016 48
+export BotCheckForGrenades
+proc BotCheckForGrenades 4 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2982
+ADDRFP4 4
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 4
+EQI4 $2980
+LABELV $2982
+ADDRGP4 $2979
+JUMPV
+LABELV $2980
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+CNSTF4 1126170624
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAddAvoidSpot
+CALLV
+pop
+LABELV $2979
+endproc BotCheckForGrenades 4 16
+export BotCheckForProxMines
+proc BotCheckForProxMines 40 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2986
+ADDRFP4 4
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 12
+EQI4 $2984
+LABELV $2986
+ADDRGP4 $2983
+JUMPV
+LABELV $2984
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2987
+ADDRGP4 $2983
+JUMPV
+LABELV $2987
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17244
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $2991
+ADDRFP4 0
+INDIRP4
+CNSTI4 17284
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GTI4 $2989
+LABELV $2991
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17232
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $2992
+ADDRFP4 0
+INDIRP4
+CNSTI4 17292
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $2989
+LABELV $2992
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17252
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $2993
+ADDRFP4 0
+INDIRP4
+CNSTI4 17300
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GTI4 $2989
+LABELV $2993
+ADDRGP4 $2983
+JUMPV
+LABELV $2989
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+CNSTF4 1126170624
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAddAvoidSpot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18768
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $2994
+ADDRGP4 $2983
+JUMPV
+LABELV $2994
+ADDRFP4 0
+INDIRP4
+CNSTI4 18768
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18512
+ADDP4
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 18768
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2983
+endproc BotCheckForProxMines 40 16
+export BotCheckForKamikazeBody
+proc BotCheckForKamikazeBody 0 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+NEI4 $2997
+ADDRGP4 $2996
+JUMPV
+LABELV $2997
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $2999
+ADDRGP4 $2996
+JUMPV
+LABELV $2999
+ADDRFP4 0
+INDIRP4
+CNSTI4 18508
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+LABELV $2996
+endproc BotCheckForKamikazeBody 0 0
+export BotCheckEvents
+proc BotCheckEvents 308 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 728
+ADDRLP4 260
+INDIRI4
+MULI4
+ADDRGP4 g_entities+368
+ADDP4
+INDIRI4
+NEI4 $3002
+ADDRGP4 $3001
+JUMPV
+LABELV $3002
+ADDRLP4 264
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+ADDP4
+CNSTI4 728
+ADDRLP4 264
+INDIRI4
+MULI4
+ADDRGP4 g_entities+368
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 14
+LEI4 $3006
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 14
+SUBI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+ADDRGP4 $3007
+JUMPV
+LABELV $3006
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+LABELV $3007
+ADDRLP4 268
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 1
+LTI4 $3008
+ADDRLP4 268
+INDIRI4
+CNSTI4 74
+GTI4 $3008
+ADDRLP4 268
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $3104-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3104
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3009
+address $3008
+address $3008
+address $3089
+address $3008
+address $3008
+address $3090
+address $3046
+address $3058
+address $3008
+address $3008
+address $3008
+address $3008
+address $3008
+address $3008
+address $3008
+address $3008
+address $3008
+address $3008
+address $3008
+address $3010
+address $3008
+address $3008
+address $3008
+address $3008
+address $3008
+address $3008
+address $3008
+address $3008
+address $3008
+address $3008
+address $3008
+address $3008
+address $3008
+address $3008
+address $3009
+code
+LABELV $3010
+ADDRLP4 272
+ADDRFP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 276
+ADDRFP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 280
+ADDRFP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 level+92
+INDIRI4
+CNSTI4 3
+GEI4 $3011
+ADDRLP4 284
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3012
+JUMPV
+LABELV $3011
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 43
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 296
+ADDRGP4 Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 288
+ADDRLP4 296
+INDIRF4
+ASGNF4
+ADDRLP4 304
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 288
+INDIRF4
+GEF4 $3015
+ADDRLP4 300
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3016
+JUMPV
+LABELV $3015
+ADDRLP4 300
+CNSTI4 0
+ASGNI4
+LABELV $3016
+ADDRLP4 284
+ADDRLP4 300
+INDIRI4
+ASGNI4
+LABELV $3012
+ADDRLP4 272
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $3017
+ADDRFP4 0
+INDIRP4
+CNSTI4 18248
+ADDP4
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18244
+ADDP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 276
+INDIRI4
+EQI4 $3022
+ADDRLP4 296
+INDIRI4
+CNSTI4 4095
+EQI4 $3022
+ADDRLP4 296
+INDIRI4
+CNSTI4 4094
+NEI4 $3019
+LABELV $3022
+ADDRFP4 0
+INDIRP4
+CNSTI4 18256
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3020
+JUMPV
+LABELV $3019
+ADDRFP4 0
+INDIRP4
+CNSTI4 18256
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $3020
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 18276
+ADDP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18256
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3018
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $3025
+ADDRLP4 276
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18284
+ADDP4
+INDIRI4
+EQI4 $3027
+ADDRFP4 0
+INDIRP4
+CNSTI4 18284
+ADDP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18288
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $3027
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 18288
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3018
+JUMPV
+LABELV $3025
+ADDRFP4 0
+INDIRP4
+CNSTI4 18284
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18288
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3018
+JUMPV
+LABELV $3017
+ADDRLP4 276
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $3029
+ADDRFP4 0
+INDIRP4
+CNSTI4 18252
+ADDP4
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18240
+ADDP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18424
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 296
+ADDRFP4 0
+INDIRP4
+CNSTI4 18280
+ADDP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+ADDRLP4 296
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18284
+ADDP4
+INDIRI4
+NEI4 $3030
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $3033
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 18288
+ADDP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $3034
+JUMPV
+LABELV $3033
+ADDRFP4 0
+INDIRP4
+CNSTI4 18288
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $3034
+ADDRFP4 0
+INDIRP4
+CNSTI4 18288
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $3030
+ADDRFP4 0
+INDIRP4
+CNSTI4 18284
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $3030
+JUMPV
+LABELV $3029
+ADDRLP4 296
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18792
+ADDP4
+INDIRI4
+NEI4 $3037
+ADDRLP4 272
+INDIRI4
+ADDRLP4 296
+INDIRI4
+NEI4 $3037
+ADDRFP4 0
+INDIRP4
+CNSTI4 18260
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $3037
+LABELV $3030
+LABELV $3018
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $3009
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 132
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 132+112
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $3009
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 300
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+NEI4 $3009
+ADDRFP4 0
+INDIRP4
+CNSTI4 19216
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3009
+JUMPV
+LABELV $3046
+ADDRLP4 272
+ADDRFP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+LTI4 $3049
+ADDRLP4 272
+INDIRI4
+CNSTI4 256
+LTI4 $3047
+LABELV $3049
+CNSTI4 3
+ARGI4
+ADDRGP4 $3050
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $3009
+JUMPV
+LABELV $3047
+ADDRFP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $3053
+ARGP4
+ADDRLP4 276
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $3051
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3054
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRGP4 $3009
+JUMPV
+LABELV $3051
+ADDRLP4 4
+ARGP4
+ADDRGP4 $3057
+ARGP4
+ADDRLP4 280
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+NEI4 $3009
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoForPowerups
+CALLV
+pop
+ADDRGP4 $3009
+JUMPV
+LABELV $3058
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $3059
+ADDRLP4 272
+ADDRFP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+LTI4 $3009
+ADDRLP4 272
+INDIRI4
+CNSTI4 5
+GTI4 $3009
+ADDRLP4 272
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $3070
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3070
+address $3064
+address $3065
+address $3066
+address $3067
+address $3068
+address $3069
+code
+LABELV $3064
+ADDRFP4 0
+INDIRP4
+CNSTI4 19212
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19208
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3009
+JUMPV
+LABELV $3065
+ADDRFP4 0
+INDIRP4
+CNSTI4 19212
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19208
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3009
+JUMPV
+LABELV $3066
+ADDRFP4 0
+INDIRP4
+CNSTI4 19212
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3009
+JUMPV
+LABELV $3067
+ADDRFP4 0
+INDIRP4
+CNSTI4 19208
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3009
+JUMPV
+LABELV $3068
+ADDRFP4 0
+INDIRP4
+CNSTI4 19212
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3009
+JUMPV
+LABELV $3069
+ADDRFP4 0
+INDIRP4
+CNSTI4 19208
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3009
+JUMPV
+LABELV $3059
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $3009
+ADDRLP4 272
+ADDRFP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+LTI4 $3009
+ADDRLP4 272
+INDIRI4
+CNSTI4 5
+GTI4 $3009
+ADDRLP4 272
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $3088
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3088
+address $3076
+address $3077
+address $3078
+address $3079
+address $3080
+address $3084
+code
+LABELV $3076
+ADDRFP4 0
+INDIRP4
+CNSTI4 19216
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3009
+JUMPV
+LABELV $3077
+ADDRFP4 0
+INDIRP4
+CNSTI4 19216
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3009
+JUMPV
+LABELV $3078
+ADDRFP4 0
+INDIRP4
+CNSTI4 19216
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3009
+JUMPV
+LABELV $3079
+ADDRFP4 0
+INDIRP4
+CNSTI4 19216
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3009
+JUMPV
+LABELV $3080
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 1
+NEI4 $3082
+ADDRLP4 280
+CNSTI4 2
+ASGNI4
+ADDRGP4 $3083
+JUMPV
+LABELV $3082
+ADDRLP4 280
+CNSTI4 1
+ASGNI4
+LABELV $3083
+ADDRFP4 0
+INDIRP4
+CNSTI4 19216
+ADDP4
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3009
+JUMPV
+LABELV $3084
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 2
+NEI4 $3086
+ADDRLP4 292
+CNSTI4 2
+ASGNI4
+ADDRGP4 $3087
+JUMPV
+LABELV $3086
+ADDRLP4 292
+CNSTI4 1
+ASGNI4
+LABELV $3087
+ADDRFP4 0
+INDIRP4
+CNSTI4 19216
+ADDP4
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 19220
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3009
+JUMPV
+LABELV $3089
+ADDRGP4 lastteleport_origin
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 lastteleport_time
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $3009
+JUMPV
+LABELV $3090
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+NEI4 $3009
+ADDRLP4 272
+ADDRFP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+LTI4 $3095
+ADDRLP4 272
+INDIRI4
+CNSTI4 256
+LTI4 $3093
+LABELV $3095
+CNSTI4 3
+ARGI4
+ADDRGP4 $3096
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $3009
+JUMPV
+LABELV $3093
+ADDRFP4 4
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $3099
+ARGP4
+ADDRLP4 276
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $3009
+ADDRFP4 0
+INDIRP4
+CNSTI4 17320
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $3009
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 EA_Use
+CALLV
+pop
+LABELV $3008
+LABELV $3009
+LABELV $3001
+endproc BotCheckEvents 308 16
+export BotCheckSnapshot
+proc BotCheckSnapshot 256 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18776
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAddAvoidSpot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18508
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18768
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 248
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3108
+JUMPV
+LABELV $3107
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckEvents
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckForGrenades
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckForProxMines
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckForKamikazeBody
+CALLV
+pop
+LABELV $3108
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 248
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 252
+ADDRGP4 BotAI_GetSnapshotEntity
+CALLI4
+ASGNI4
+ADDRLP4 248
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 -1
+NEI4 $3107
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 0+212
+ADDRFP4 0
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+216
+ADDRFP4 0
+INDIRP4
+CNSTI4 308
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckEvents
+CALLV
+pop
+LABELV $3106
+endproc BotCheckSnapshot 256 16
+export BotCheckTeamScores
+proc BotCheckTeamScores 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $3116
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $3121
+ADDRGP4 $3112
+JUMPV
+LABELV $3116
+ADDRFP4 0
+INDIRP4
+CNSTI4 18304
+ADDP4
+ADDRGP4 level+56+8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18308
+ADDP4
+ADDRGP4 level+56+4
+INDIRI4
+ASGNI4
+ADDRGP4 $3114
+JUMPV
+LABELV $3121
+ADDRFP4 0
+INDIRP4
+CNSTI4 18304
+ADDP4
+ADDRGP4 level+56+4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18308
+ADDP4
+ADDRGP4 level+56+8
+INDIRI4
+ASGNI4
+LABELV $3114
+LABELV $3112
+endproc BotCheckTeamScores 8 0
+export BotCheckAir
+proc BotCheckAir 4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17344
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $3127
+ADDRFP4 0
+INDIRP4
+CNSTI4 17184
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $3129
+ADDRGP4 $3126
+JUMPV
+LABELV $3129
+LABELV $3127
+ADDRFP4 0
+INDIRP4
+CNSTI4 18432
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $3126
+endproc BotCheckAir 4 4
+export BotAlternateRoute
+proc BotAlternateRoute 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18944
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3132
+ADDRFP4 0
+INDIRP4
+CNSTI4 18988
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $3134
+ADDRFP4 4
+INDIRP4
+RETP4
+ADDRGP4 $3131
+JUMPV
+LABELV $3134
+ADDRFP4 0
+INDIRP4
+CNSTI4 17196
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17156
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18944
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18224
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $3136
+ADDRLP4 12
+INDIRI4
+CNSTI4 20
+GEI4 $3136
+ADDRFP4 0
+INDIRP4
+CNSTI4 18988
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $3136
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18932
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18932
+ADDP4
+RETP4
+ADDRGP4 $3131
+JUMPV
+LABELV $3132
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $3131
+endproc BotAlternateRoute 16 16
+export BotGetAlternateRouteGoal
+proc BotGetAlternateRouteGoal 28 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $3139
+ADDRLP4 12
+ADDRGP4 red_altroutegoals
+ASGNP4
+ADDRLP4 4
+ADDRGP4 red_numaltroutegoals
+INDIRI4
+ASGNI4
+ADDRGP4 $3140
+JUMPV
+LABELV $3139
+ADDRLP4 12
+ADDRGP4 blue_altroutegoals
+ASGNP4
+ADDRLP4 4
+ADDRGP4 blue_numaltroutegoals
+INDIRI4
+ASGNI4
+LABELV $3140
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $3141
+CNSTI4 0
+RETI4
+ADDRGP4 $3138
+JUMPV
+LABELV $3141
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $3143
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $3143
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 18932
+ADDP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18988
+ADDP4
+CNSTF4 0
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $3138
+endproc BotGetAlternateRouteGoal 28 0
+export BotSetupAlternativeRouteGoals
+proc BotSetupAlternativeRouteGoals 12 32
+ADDRGP4 altroutegoals_setup
+INDIRI4
+CNSTI4 0
+EQI4 $3146
+ADDRGP4 $3145
+JUMPV
+LABELV $3146
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $3148
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3152
+ARGP4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $3150
+CNSTI4 0
+ARGI4
+ADDRGP4 $3153
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3150
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+CNSTI4 0
+EQI4 $3149
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $3149
+JUMPV
+LABELV $3148
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $3161
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3165
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $3163
+CNSTI4 2
+ARGI4
+ADDRGP4 $3166
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3163
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRGP4 ctf_neutralflag+12
+INDIRI4
+ARGI4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $3162
+JUMPV
+LABELV $3161
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $3171
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3165
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $3173
+CNSTI4 2
+ARGI4
+ADDRGP4 $3175
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3173
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 redobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 blueobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $3172
+JUMPV
+LABELV $3171
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $3180
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3165
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $3182
+CNSTI4 2
+ARGI4
+ADDRGP4 $3184
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3182
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 redobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 red_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 red_numaltroutegoals
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 neutralobelisk+12
+INDIRI4
+ARGI4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 blueobelisk+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRGP4 blue_altroutegoals
+ARGP4
+CNSTI4 32
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AlternativeRouteGoals
+CALLI4
+ASGNI4
+ADDRGP4 blue_numaltroutegoals
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $3180
+LABELV $3172
+LABELV $3162
+LABELV $3149
+ADDRGP4 altroutegoals_setup
+CNSTI4 1
+ASGNI4
+LABELV $3145
+endproc BotSetupAlternativeRouteGoals 12 32
+export BotDeathmatchAI
+proc BotDeathmatchAI 324 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18264
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $3190
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 18264
+ADDP4
+ASGNP4
+ADDRLP4 292
+INDIRP4
+ADDRLP4 292
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18264
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $3192
+ADDRGP4 $3189
+JUMPV
+LABELV $3192
+ADDRFP4 0
+INDIRP4
+CNSTI4 18772
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 148
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 Characteristic_String
+CALLV
+pop
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 109
+NEI4 $3194
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotSetChatGender
+CALLV
+pop
+ADDRGP4 $3195
+JUMPV
+LABELV $3194
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 102
+NEI4 $3196
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotSetChatGender
+CALLV
+pop
+ADDRGP4 $3197
+JUMPV
+LABELV $3196
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotSetChatGender
+CALLV
+pop
+LABELV $3197
+LABELV $3195
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 PlayerName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSetChatName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18292
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18296
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18264
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 BotSetupAlternativeRouteGoals
+CALLV
+pop
+LABELV $3190
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 18228
+ADDP4
+ASGNP4
+ADDRLP4 292
+INDIRP4
+ADDRLP4 292
+INDIRP4
+INDIRI4
+CNSTI4 -33
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+NEI4 $3198
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeleportTime
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotUpdateInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckSnapshot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAir
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckTeamScores
+CALLV
+pop
+LABELV $3198
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckConsoleMessages
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+NEI4 $3200
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 304
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+NEI4 $3200
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotTeamAI
+CALLV
+pop
+LABELV $3200
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3202
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3204
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+LABELV $3202
+ADDRFP4 0
+INDIRP4
+CNSTI4 18272
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3205
+ADDRFP4 0
+INDIRP4
+CNSTI4 18320
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+LEF4 $3205
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotChat_EnterGame
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $3207
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18352
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 320
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3209
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+LABELV $3207
+ADDRFP4 0
+INDIRP4
+CNSTI4 18272
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $3205
+ADDRGP4 BotResetNodeSwitches
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3210
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 17116
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 316
+INDIRI4
+CNSTI4 0
+EQI4 $3214
+ADDRGP4 $3212
+JUMPV
+LABELV $3214
+LABELV $3211
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+LTI4 $3210
+LABELV $3212
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $3216
+ADDRGP4 $3189
+JUMPV
+LABELV $3216
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+LTI4 $3218
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotDumpGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 18780
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotDumpAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotDumpNodeSwitches
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 PlayerName
+CALLP4
+pop
+CNSTI4 3
+ARGI4
+ADDRGP4 $3220
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+CNSTI4 50
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3218
+ADDRFP4 0
+INDIRP4
+CNSTI4 18292
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 17316
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 18296
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $3189
+endproc BotDeathmatchAI 324 20
+export BotSetEntityNumForGoalWithModel
+proc BotSetEntityNumForGoalWithModel 44 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 G_ModelIndex
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3225
+JUMPV
+LABELV $3222
+ADDRLP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3227
+ADDRGP4 $3223
+JUMPV
+LABELV $3227
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3229
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $3229
+ADDRGP4 $3223
+JUMPV
+LABELV $3229
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $3231
+ADDRGP4 $3223
+JUMPV
+LABELV $3231
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1120403456
+GEF4 $3235
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $3221
+JUMPV
+LABELV $3235
+LABELV $3223
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ASGNP4
+LABELV $3225
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $3222
+LABELV $3221
+endproc BotSetEntityNumForGoalWithModel 44 4
+export BotSetEntityNumForGoal
+proc BotSetEntityNumForGoal 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3241
+JUMPV
+LABELV $3238
+ADDRLP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3243
+ADDRGP4 $3239
+JUMPV
+LABELV $3243
+ADDRLP4 0
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $3245
+ADDRGP4 $3239
+JUMPV
+LABELV $3245
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1120403456
+GEF4 $3249
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $3237
+JUMPV
+LABELV $3249
+LABELV $3239
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ASGNP4
+LABELV $3241
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $3238
+LABELV $3237
+endproc BotSetEntityNumForGoal 36 8
+export BotSetEntityNumForGoalWithActivator
+proc BotSetEntityNumForGoalWithActivator 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3255
+JUMPV
+LABELV $3252
+ADDRLP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3259
+ADDRLP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3257
+LABELV $3259
+ADDRGP4 $3253
+JUMPV
+LABELV $3257
+ADDRLP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $3260
+ADDRGP4 $3253
+JUMPV
+LABELV $3260
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1120403456
+GEF4 $3264
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $3251
+JUMPV
+LABELV $3264
+LABELV $3253
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ASGNP4
+LABELV $3255
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $3252
+LABELV $3251
+endproc BotSetEntityNumForGoalWithActivator 40 8
+export BotGoalForBSPEntity
+proc BotGoalForBSPEntity 1128 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 1108
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRGP4 $3270
+JUMPV
+LABELV $3267
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2592
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $3271
+ADDRGP4 $3268
+JUMPV
+LABELV $3271
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1116
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $3273
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2608
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1120
+ADDRGP4 trap_AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $3275
+CNSTI4 0
+RETI4
+ADDRGP4 $3266
+JUMPV
+LABELV $3275
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1040
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1040+8
+ADDRLP4 1040+8
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 1052
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1052+8
+ADDRLP4 1052+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1052
+ARGP4
+ADDRLP4 1068
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 1124
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1124
+INDIRI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $3279
+CNSTI4 0
+RETI4
+ADDRGP4 $3266
+JUMPV
+LABELV $3279
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $3266
+JUMPV
+LABELV $3273
+LABELV $3268
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+LABELV $3270
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $3267
+CNSTI4 0
+RETI4
+LABELV $3266
+endproc BotGoalForBSPEntity 1128 20
+export BotSetupDeathmatchAI
+proc BotSetupDeathmatchAI 156 16
+ADDRGP4 $3282
+ARGP4
+ADDRLP4 136
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 gametype
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRGP4 bot_rocketjump
+ARGP4
+ADDRGP4 $3283
+ARGP4
+ADDRGP4 $3284
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_grapple
+ARGP4
+ADDRGP4 $3285
+ARGP4
+ADDRGP4 $3284
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_fastchat
+ARGP4
+ADDRGP4 $3286
+ARGP4
+ADDRGP4 $3287
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_nochat
+ARGP4
+ADDRGP4 $3288
+ARGP4
+ADDRGP4 $3287
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_testichat
+ARGP4
+ADDRGP4 $3289
+ARGP4
+ADDRGP4 $3287
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_testrchat
+ARGP4
+ADDRGP4 $3290
+ARGP4
+ADDRGP4 $3287
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_challenge
+ARGP4
+ADDRGP4 $3291
+ARGP4
+ADDRGP4 $3287
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_predictobstacles
+ARGP4
+ADDRGP4 $3292
+ARGP4
+ADDRGP4 $3284
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_offhandgrapple
+ARGP4
+ADDRGP4 $3293
+ARGP4
+ADDRGP4 $3287
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_droppedweight
+ARGP4
+ADDRGP4 $3294
+ARGP4
+ADDRGP4 $3295
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 g_spSkill
+ARGP4
+ADDRGP4 $3296
+ARGP4
+ADDRGP4 $3297
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $3298
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3302
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $3300
+CNSTI4 2
+ARGI4
+ADDRGP4 $3303
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3300
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3306
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $3299
+CNSTI4 2
+ARGI4
+ADDRGP4 $3307
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $3299
+JUMPV
+LABELV $3298
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 5
+NEI4 $3308
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3152
+ARGP4
+ADDRGP4 ctf_neutralflag
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $3310
+CNSTI4 2
+ARGI4
+ADDRGP4 $3312
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3310
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3302
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $3313
+CNSTI4 2
+ARGI4
+ADDRGP4 $3315
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3313
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3306
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRLP4 148
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+GEI4 $3309
+CNSTI4 2
+ARGI4
+ADDRGP4 $3318
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $3309
+JUMPV
+LABELV $3308
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 6
+NEI4 $3319
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3323
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $3321
+CNSTI4 2
+ARGI4
+ADDRGP4 $3324
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3321
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 $3325
+ARGP4
+ADDRGP4 BotSetEntityNumForGoalWithActivator
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3328
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $3326
+CNSTI4 2
+ARGI4
+ADDRGP4 $3329
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3326
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 $3330
+ARGP4
+ADDRGP4 BotSetEntityNumForGoalWithActivator
+CALLV
+pop
+ADDRGP4 $3320
+JUMPV
+LABELV $3319
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 7
+NEI4 $3331
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3323
+ARGP4
+ADDRGP4 redobelisk
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+GEI4 $3333
+CNSTI4 2
+ARGI4
+ADDRGP4 $3335
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3333
+ADDRGP4 redobelisk
+ARGP4
+ADDRGP4 $3325
+ARGP4
+ADDRGP4 BotSetEntityNumForGoalWithActivator
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3328
+ARGP4
+ADDRGP4 blueobelisk
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $3336
+CNSTI4 2
+ARGI4
+ADDRGP4 $3338
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3336
+ADDRGP4 blueobelisk
+ARGP4
+ADDRGP4 $3330
+ARGP4
+ADDRGP4 BotSetEntityNumForGoalWithActivator
+CALLV
+pop
+CNSTI4 -1
+ARGI4
+ADDRGP4 $3165
+ARGP4
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRLP4 148
+ADDRGP4 BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+GEI4 $3339
+CNSTI4 2
+ARGI4
+ADDRGP4 $3184
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $3339
+ADDRGP4 neutralobelisk
+ARGP4
+ADDRGP4 $3341
+ARGP4
+ADDRGP4 BotSetEntityNumForGoalWithActivator
+CALLV
+pop
+LABELV $3331
+LABELV $3320
+LABELV $3309
+LABELV $3299
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 max_bspmodelindex
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRGP4 $3345
+JUMPV
+LABELV $3342
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2364
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $3346
+ADDRGP4 $3343
+JUMPV
+LABELV $3346
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $3348
+ADDRLP4 4+1
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ADDRGP4 max_bspmodelindex
+INDIRI4
+LEI4 $3351
+ADDRGP4 max_bspmodelindex
+ADDRLP4 132
+INDIRI4
+ASGNI4
+LABELV $3351
+LABELV $3348
+LABELV $3343
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 148
+INDIRI4
+ASGNI4
+LABELV $3345
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $3342
+ADDRGP4 BotInitWaypoints
+CALLV
+pop
+LABELV $3281
+endproc BotSetupDeathmatchAI 156 16
+export BotShutdownDeathmatchAI
+proc BotShutdownDeathmatchAI 0 0
+ADDRGP4 altroutegoals_setup
+CNSTI4 0
+ASGNI4
+LABELV $3353
+endproc BotShutdownDeathmatchAI 0 0
+bss
+export botvisstats
+align 4
+LABELV botvisstats
+skip 20
+export botvisframeactive
+align 4
+LABELV botvisframeactive
+skip 4
+export botvisframe
+align 4
+LABELV botvisframe
+skip 4
+export botviscache
+align 4
+LABELV botviscache
+skip 131072
+export blue_numaltroutegoals
+align 4
+LABELV blue_numaltroutegoals
+skip 4
+export blue_altroutegoals
+align 4
+LABELV blue_altroutegoals
+skip 768
+export red_numaltroutegoals
+align 4
+LABELV red_numaltroutegoals
+skip 4
+export red_altroutegoals
+align 4
+LABELV red_altroutegoals
+skip 768
+export altroutegoals_setup
+align 4
+LABELV altroutegoals_setup
+skip 4
+export max_bspmodelindex
+align 4
+LABELV max_bspmodelindex
+skip 4
+export lastteleport_time
+align 4
+LABELV lastteleport_time
+skip 4
+export lastteleport_origin
+align 4
+LABELV lastteleport_origin
+skip 12
+export g_spSkill
+align 4
+LABELV g_spSkill
+skip 272
+export bot_predictobstacles
+align 4
+LABELV bot_predictobstacles
+skip 272
+export botai_freewaypoints
+align 4
+LABELV botai_freewaypoints
+skip 4
+export botai_waypoints
+align 4
+LABELV botai_waypoints
+skip 12800
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotTeamAI
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+export neutralobelisk
+align 4
+LABELV neutralobelisk
+skip 56
+export blueobelisk
+align 4
+LABELV blueobelisk
+skip 56
+export redobelisk
+align 4
+LABELV redobelisk
+skip 56
+export ctf_neutralflag
+align 4
+LABELV ctf_neutralflag
+skip 56
+export ctf_blueflag
+align 4
+LABELV ctf_blueflag
+skip 56
+export ctf_redflag
+align 4
+LABELV ctf_redflag
+skip 56
+export bot_offhandgrapple
+align 4
+LABELV bot_offhandgrapple
+skip 272
+export bot_droppedweight
+align 4
+LABELV bot_droppedweight
+skip 272
+export bot_challenge
+align 4
+LABELV bot_challenge
+skip 272
+export bot_testrchat
+align 4
+LABELV bot_testrchat
+skip 272
+export bot_testichat
+align 4
+LABELV bot_testichat
+skip 272
+export bot_nochat
+align 4
+LABELV bot_nochat
+skip 272
+export bot_fastchat
+align 4
+LABELV bot_fastchat
+skip 272
+export bot_rocketjump
+align 4
+LABELV bot_rocketjump
+skip 272
+export bot_grapple
+align 4
+LABELV bot_grapple
+skip 272
+import maxplayers
+export gametype
+align 4
+LABELV gametype
+skip 4
+import bot_reloadcharacters
+import bot_showteamgoals
+import bot_shownodechanges
+import bot_developer
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetPlayerState
+import BotAI_DebugLineShow
+import BotAI_DebugLineDelete
+import BotAI_DebugLineCreate
+import BotAI_InPVS
+import BotAI_PointContents
+import BotAI_EntityTrace
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotLibVarGetValue
+import BotNextEntity
+import BotSense
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotInitPhysicsSettings
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotRoutingAreaChanged
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotPrepareItemWeights
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotMatchTemplatesContainsString
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatchLinear
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import GetBotLibAPI
+import g_instagib
+import g_playerCapsule
+import g_proxMineTimeout
+import g_singlePlayer
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGamePlayers
+import g_maxplayers
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import trap_AAS_DropToFloor
+import trap_AAS_HorizontalVelocityForJump
+import trap_AAS_AgainstLadder
+import trap_AAS_JumpReachRunStart
+import trap_AAS_Swimming
+import trap_AAS_OnGround
+import trap_AAS_PredictPlayerMovement
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaTravelTime
+import trap_AAS_EnableRoutingArea
+import trap_AAS_RandomGoalArea
+import trap_AAS_ReachabilityFromNum
+import trap_AAS_NextAreaReachability
+import trap_AAS_AreaContentsTravelFlags
+import trap_AAS_TravelFlagForType
+import trap_AAS_AreaDoNotEnter
+import trap_AAS_AreaJumpPad
+import trap_AAS_AreaLadder
+import trap_AAS_AreaGrounded
+import trap_AAS_AreaSlime
+import trap_AAS_AreaLava
+import trap_AAS_AreaLiquid
+import trap_AAS_AreaSwim
+import trap_AAS_AreaCrouch
+import trap_AAS_AreaGroundFaceArea
+import trap_AAS_NextModelReachability
+import trap_AAS_BestReachableFromJumpPadArea
+import trap_AAS_BestReachableArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_TracePlayerBBox
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_FloodAreas
+import trap_AAS_ShowReachableAreas
+import trap_AAS_ShowReachability
+import trap_AAS_DrawArrow
+import trap_AAS_PrintTravelType
+import trap_AAS_DrawCross
+import trap_AAS_ShowAreaPolygons
+import trap_AAS_ShowArea
+import trap_AAS_ShowFace
+import trap_AAS_ShowBoundingBox
+import trap_AAS_DrawPlaneCross
+import trap_AAS_DrawPermanentCross
+import trap_AAS_PermanentLine
+import trap_AAS_DebugLine
+import trap_AAS_ClearShownPolygons
+import trap_AAS_ClearShownDebugLines
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_Loaded
+import trap_AAS_PointInsideArea
+import trap_AAS_BBoxReachabilityAreas
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_RegisterModel
+import trap_DebugPolygonDelete
+import trap_DebugPolygonShow
+import trap_DebugPolygonCreate
+import trap_ClientCommand
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_ClipToEntitiesCapsule
+import trap_ClipToEntities
+import trap_TraceCapsule
+import trap_Trace
+import trap_GetBrushBounds
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_SetConfigstringRestrictions
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommandEx
+import trap_DropPlayer
+import trap_SetNetFields
+import trap_LocateGameData
+import Pickup_Team
+import Svcmd_TeamInfoStats_f
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_BuildLocationTree
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotWeightBench_f
+import Svcmd_BotThinkReport_f
+import Svcmd_BotMatchBench_f
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownPlayer
+import BotAISetupPlayer
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import G_BotInitBotLib
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBotComplete
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunPlayer
+import PlayerEndFrame
+import PlayerThink
+import PlayerHandicap
+import ClientCommand
+import PlayerBegin
+import PlayerDisconnect
+import PlayerUserinfoChanged
+import PlayerConnect
+import G_Error
+import G_Printf
+import G_DPrintf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MovePlayerToIntermission
+import StringIsInteger
+import ConcatArgs
+import G_ScoreboardChanged
+import DeathmatchScoreboardMessage
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import G_RegisterCommands
+import G_ConsoleCompleteArgument
+import G_ConsoleCommand
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import PlayerSpawn
+import InitBodyQue
+import BeginIntermission
+import PlayerRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetPlayerViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossPlayerCubes
+import TossPlayerPersistantPowerups
+import TossPlayerGametypeItems
+import TossPlayerItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_SetBrushModel
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import trap_SendServerCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import FinishSpawningItem
+import G_SpawnItem
+import LaunchItem
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $3341
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $3338
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $3335
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $3330
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $3329
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $3328
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $3325
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $3324
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $3323
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $3318
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $3315
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $3312
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $3307
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $3306
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $3303
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $3302
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $3297
+byte 1 50
+byte 1 0
+align 1
+LABELV $3296
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $3295
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $3294
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 119
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $3293
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $3292
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3291
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $3290
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $3289
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $3288
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $3287
+byte 1 48
+byte 1 0
+align 1
+LABELV $3286
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $3285
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $3284
+byte 1 49
+byte 1 0
+align 1
+LABELV $3283
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $3282
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $3220
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 73
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $3209
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $3204
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $3184
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $3175
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $3166
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 10
+byte 1 0
+align 1
+LABELV $3165
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 79
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $3153
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $3152
+byte 1 78
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $3099
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $3096
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $3057
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $3054
+byte 1 75
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $3053
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $3050
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2978
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2971
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 10
+byte 1 0
+align 1
+LABELV $2970
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $2718
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2717
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $2713
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 111
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $2701
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $2700
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $2697
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2686
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2673
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2667
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $2659
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $2648
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2644
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2641
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $2608
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2603
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $2598
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2595
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2592
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2591
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2579
+byte 1 42
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2396
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $2373
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2370
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $2364
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $2268
+byte 1 109
+byte 1 112
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 0
+align 1
+LABELV $2267
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $2266
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 0
+align 1
+LABELV $2262
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1591
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 86
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1581
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 80
+byte 1 86
+byte 1 83
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1311
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $1310
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1309
+byte 1 66
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1308
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1307
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $1069
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 87
+byte 1 97
+byte 1 121
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1053
+byte 1 116
+byte 1 0
+align 1
+LABELV $721
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $707
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $585
+byte 1 93
+byte 1 0
+align 1
+LABELV $584
+byte 1 91
+byte 1 0
+align 1
+LABELV $583
+byte 1 32
+byte 1 0
+align 1
+LABELV $541
+byte 1 110
+byte 1 0
+align 1
+LABELV $540
+byte 1 91
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 93
+byte 1 0
+align 1
+LABELV $539
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $262
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $237
+byte 1 105
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $214
+byte 1 110
+byte 1 111
+byte 1 0
+align 1
+LABELV $189
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $188
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
@@ -0,0 +1,9588 @@
+data
+export iteminfo_fields
+align 4
+LABELV iteminfo_fields
+address $62
+byte 4 32
+byte 4 4
+skip 16
+address $63
+byte 4 112
+byte 4 4
+skip 16
+address $64
+byte 4 192
+byte 4 2
+skip 16
+address $65
+byte 4 196
+byte 4 2
+skip 16
+address $66
+byte 4 200
+byte 4 2
+skip 16
+address $67
+byte 4 204
+byte 4 3
+skip 16
+address $68
+byte 4 208
+byte 4 259
+byte 4 3
+skip 12
+address $69
+byte 4 220
+byte 4 259
+byte 4 3
+skip 12
+byte 4 0
+byte 4 0
+byte 4 0
+skip 16
+export iteminfo_struct
+align 4
+LABELV iteminfo_struct
+byte 4 236
+address iteminfo_fields
+export itemconfig
+align 4
+LABELV itemconfig
+byte 4 0
+export levelitemheap
+align 4
+LABELV levelitemheap
+byte 4 0
+export freelevelitems
+align 4
+LABELV freelevelitems
+byte 4 0
+export levelitems
+align 4
+LABELV levelitems
+byte 4 0
+export numlevelitems
+align 4
+LABELV numlevelitems
+byte 4 0
+export numclustereditems
+align 4
+LABELV numclustereditems
+byte 4 0
+export clustereditemsvalid
+align 4
+LABELV clustereditemsvalid
+byte 4 0
+export leveltraveltimefactor
+align 4
+LABELV leveltraveltimefactor
+byte 4 3212836864
+export campspots
+align 4
+LABELV campspots
+byte 4 0
+export BotGoalStateFromHandle
+code
+proc BotGoalStateFromHandle 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $73
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LEI4 $71
+LABELV $73
+CNSTI4 4
+ARGI4
+ADDRGP4 $74
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $70
+JUMPV
+LABELV $71
+CNSTI4 5588
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 botgoalstates
+ADDP4
+RETP4
+LABELV $70
+endproc BotGoalStateFromHandle 4 12
+export BotInterbreedGoalFuzzyLogic
+proc BotInterbreedGoalFuzzyLogic 28 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTU4 0
+ASGNU4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRU4
+EQU4 $79
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRU4
+EQU4 $79
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRU4
+NEU4 $76
+LABELV $79
+ADDRGP4 $75
+JUMPV
+LABELV $76
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 InterbreedWeightConfigs
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 3536
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $75
+endproc BotInterbreedGoalFuzzyLogic 28 12
+export BotSaveGoalFuzzyLogic
+proc BotSaveGoalFuzzyLogic 0 0
+LABELV $80
+endproc BotSaveGoalFuzzyLogic 0 0
+export BotMutateGoalFuzzyLogic
+proc BotMutateGoalFuzzyLogic 8 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $82
+ADDRGP4 $81
+JUMPV
+LABELV $82
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 EvolveWeightConfig
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 3536
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $81
+endproc BotMutateGoalFuzzyLogic 8 4
+export LoadItemConfig
+proc LoadItemConfig 1140 16
+ADDRLP4 1052
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1052
+ARGP4
+ADDRGP4 $85
+ARGP4
+ADDRLP4 1116
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1116
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $86
+CNSTI4 3
+ARGI4
+ADDRGP4 $88
+ARGP4
+ADDRLP4 1052
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $84
+JUMPV
+LABELV $86
+ADDRLP4 1044
+ADDRGP4 bot_itemconfig
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 60420
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1044
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $90
+JUMPV
+LABELV $89
+ADDRLP4 4+16
+ARGP4
+ADDRGP4 $95
+ARGP4
+ADDRLP4 1120
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $92
+ADDRLP4 1044
+INDIRP4
+INDIRI4
+CNSTI4 256
+LTI4 $96
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $98
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $84
+JUMPV
+LABELV $96
+ADDRLP4 1048
+CNSTI4 236
+ADDRLP4 1044
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 1044
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 236
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1128
+ADDRGP4 PC_ExpectTokenType
+CALLI4
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+CNSTI4 0
+NEI4 $99
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $84
+JUMPV
+LABELV $99
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRLP4 4+16
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 iteminfo_struct
+ARGP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRLP4 1132
+ADDRGP4 PC_ReadStructure
+CALLI4
+ASGNI4
+ADDRLP4 1132
+INDIRI4
+CNSTI4 0
+NEI4 $102
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $84
+JUMPV
+LABELV $102
+ADDRLP4 1048
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRLP4 1044
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRP4
+ADDRLP4 1044
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $93
+JUMPV
+LABELV $92
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $104
+ARGP4
+ADDRLP4 4+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $84
+JUMPV
+LABELV $93
+LABELV $90
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1120
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $89
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+ADDRLP4 1044
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $106
+CNSTI4 2
+ARGI4
+ADDRGP4 $108
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $106
+CNSTI4 0
+ARGI4
+ADDRGP4 $109
+ARGP4
+ADDRLP4 1052
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 1044
+INDIRP4
+RETP4
+LABELV $84
+endproc LoadItemConfig 1140 16
+export ItemWeightIndex
+proc ItemWeightIndex 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $114
+JUMPV
+LABELV $111
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 FindFuzzyWeight
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GEI4 $115
+ADDRGP4 bot_developer+12
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $115
+ADDRGP4 $118
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $115
+LABELV $112
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $114
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+LTI4 $111
+ADDRGP4 $122
+JUMPV
+LABELV $119
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $120
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $122
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $119
+LABELV $110
+endproc ItemWeightIndex 20 12
+bss
+align 4
+LABELV $124
+skip 22528
+export InitLevelItemHeap
+code
+proc InitLevelItemHeap 16 0
+ADDRGP4 levelitemheap
+ADDRGP4 $124
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $125
+ADDRLP4 4
+CNSTI4 88
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 levelitemheap
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+CNSTI4 84
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $126
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+LTI4 $125
+ADDRGP4 levelitemheap
+INDIRP4
+CNSTI4 22524
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 freelevelitems
+ADDRGP4 levelitemheap
+INDIRP4
+ASGNP4
+LABELV $123
+endproc InitLevelItemHeap 16 0
+export AllocLevelItem
+proc AllocLevelItem 8 12
+ADDRLP4 0
+ADDRGP4 freelevelitems
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $130
+CNSTI4 4
+ARGI4
+ADDRGP4 $132
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $129
+JUMPV
+LABELV $130
+ADDRLP4 4
+ADDRGP4 freelevelitems
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 88
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $129
+endproc AllocLevelItem 8 12
+export FreeLevelItem
+proc FreeLevelItem 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 freelevelitems
+INDIRP4
+ASGNP4
+ADDRGP4 freelevelitems
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $133
+endproc FreeLevelItem 0 0
+export AddLevelItemToList
+proc AddLevelItemToList 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 levelitems
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $135
+ADDRGP4 levelitems
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $135
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRGP4 levelitems
+INDIRP4
+ASGNP4
+ADDRGP4 levelitems
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 clustereditemsvalid
+CNSTI4 0
+ASGNI4
+LABELV $134
+endproc AddLevelItemToList 0 0
+export RemoveLevelItemFromList
+proc RemoveLevelItemFromList 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $138
+ADDRLP4 4
+CNSTI4 84
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $139
+JUMPV
+LABELV $138
+ADDRGP4 levelitems
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $139
+ADDRGP4 clustereditemsvalid
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $140
+ADDRLP4 12
+CNSTI4 80
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $140
+LABELV $137
+endproc RemoveLevelItemFromList 16 0
+export BotLevelItemGoalAreaInfo
+proc BotLevelItemGoalAreaInfo 60 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $143
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 0+12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 0+16
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRLP4 0+28
+INDIRB
+ASGNB 12
+ADDRGP4 $144
+JUMPV
+LABELV $143
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $144
+ADDRGP4 clustereditemsvalid
+CNSTI4 0
+ASGNI4
+LABELV $142
+endproc BotLevelItemGoalAreaInfo 60 8
+export BotClusterLevelItems
+proc BotClusterLevelItems 16 0
+ADDRGP4 numclustereditems
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRGP4 levelitems
+INDIRP4
+ASGNP4
+ADDRGP4 $152
+JUMPV
+LABELV $149
+ADDRLP4 0
+ADDRGP4 numclustereditems
+INDIRI4
+ASGNI4
+ADDRGP4 $156
+JUMPV
+LABELV $153
+ADDRLP4 12
+CNSTI4 32
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 clustereditems-4
+ADDP4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+GTI4 $157
+ADDRGP4 $155
+JUMPV
+LABELV $157
+LABELV $154
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $156
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $153
+LABELV $155
+ADDRLP4 4
+ADDRGP4 numclustereditems
+INDIRI4
+ASGNI4
+ADDRGP4 $163
+JUMPV
+LABELV $160
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 clustereditems
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 clustereditems-4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $161
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $163
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GTI4 $160
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 clustereditems
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 numclustereditems
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $150
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $152
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $165
+ADDRGP4 numclustereditems
+INDIRI4
+CNSTI4 256
+LTI4 $149
+LABELV $165
+ADDRGP4 clustereditemsvalid
+CNSTI4 1
+ASGNI4
+LABELV $148
+endproc BotClusterLevelItems 16 0
+export BotFirstClusterLevelItem
+proc BotFirstClusterLevelItem 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 clustereditemsvalid
+INDIRI4
+CNSTI4 0
+NEI4 $167
+ADDRGP4 BotClusterLevelItems
+CALLV
+pop
+LABELV $167
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRGP4 numclustereditems
+INDIRI4
+ASGNI4
+ADDRGP4 $170
+JUMPV
+LABELV $169
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+CNSTI4 1
+RSHI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 clustereditems
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+GEI4 $172
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $173
+JUMPV
+LABELV $172
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $173
+LABELV $170
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $169
+ADDRLP4 4
+INDIRI4
+ADDRGP4 numclustereditems
+INDIRI4
+LTI4 $174
+CNSTI4 0
+RETI4
+ADDRGP4 $166
+JUMPV
+LABELV $174
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $166
+endproc BotFirstClusterLevelItem 12 0
+export BotTravelTimeFactor
+proc BotTravelTimeFactor 140 8
+ADDRGP4 leveltraveltimefactor
+INDIRF4
+CNSTF4 0
+LTF4 $177
+ADDRGP4 leveltraveltimefactor
+INDIRF4
+RETF4
+ADDRGP4 $176
+JUMPV
+LABELV $177
+ADDRLP4 128
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+CNSTI4 0
+NEI4 $179
+CNSTF4 0
+RETF4
+ADDRGP4 $176
+JUMPV
+LABELV $179
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $181
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1098907648
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+CNSTF4 1056964608
+CNSTF4 1051260355
+CNSTF4 1065353216
+ADDRLP4 8
+INDIRF4
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $182
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $181
+ADDRLP4 124
+CNSTI4 1
+ASGNI4
+LABELV $185
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRGP4 trap_AAS_ReachabilityFromNum
+CALLI4
+pop
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $189
+ADDRGP4 $187
+JUMPV
+LABELV $189
+ADDRLP4 76+12
+ARGP4
+ADDRLP4 76+24
+ARGP4
+ADDRLP4 132
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 132
+INDIRF4
+ASGNF4
+ADDRLP4 120
+INDIRF4
+CNSTF4 0
+GTF4 $193
+ADDRGP4 $186
+JUMPV
+LABELV $193
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $195
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1098907648
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 76+40
+INDIRU2
+CVUI4 2
+CVIF4 4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ADDRLP4 120
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRF4
+GEF4 $200
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $200
+LABELV $196
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $195
+LABELV $186
+ADDRLP4 124
+ADDRLP4 124
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $185
+JUMPV
+LABELV $187
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $202
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+LEF4 $206
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $206
+LABELV $203
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $202
+ADDRLP4 132
+ADDRGP4 leveltraveltimefactor
+ASGNP4
+ADDRLP4 132
+INDIRP4
+CNSTF4 1065185444
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 132
+INDIRP4
+INDIRF4
+RETF4
+LABELV $176
+endproc BotTravelTimeFactor 140 8
+export BotLevelItemMinTravelTime
+proc BotLevelItemMinTravelTime 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $209
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+GEF4 $213
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $214
+JUMPV
+LABELV $213
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+LEF4 $215
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+INDIRF4
+SUBF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRGP4 $216
+JUMPV
+LABELV $215
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $216
+LABELV $214
+LABELV $210
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $209
+ADDRLP4 4
+ARGP4
+ADDRLP4 20
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 20
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+GEI4 $217
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $217
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $208
+endproc BotLevelItemMinTravelTime 36 4
+export BotUpdateItemWeights
+proc BotUpdateItemWeights 528 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 3536
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $220
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $222
+ADDRLP4 520
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 3540
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 520
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+EQI4 $226
+ADDRGP4 $224
+JUMPV
+LABELV $226
+LABELV $223
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $222
+LABELV $224
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $228
+ADDRGP4 $219
+JUMPV
+LABELV $228
+LABELV $220
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 FuzzyWeights
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $233
+JUMPV
+LABELV $230
+ADDRLP4 520
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 itemconfig
+INDIRP4
+ADDRLP4 520
+INDIRI4
+ADDP4
+ADDP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 520
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $234
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4564
+ADDP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $235
+JUMPV
+LABELV $234
+ADDRLP4 524
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 524
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4564
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 524
+INDIRI4
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $235
+LABELV $231
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $233
+ADDRLP4 0
+INDIRI4
+ADDRGP4 itemconfig
+INDIRP4
+INDIRI4
+LTI4 $230
+ADDRFP4 0
+INDIRP4
+CNSTI4 3540
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 3536
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $219
+endproc BotUpdateItemWeights 528 12
+export BotPrepareItemWeights
+proc BotPrepareItemWeights 16 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $240
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $240
+ADDRGP4 itemconfig
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+NEU4 $237
+LABELV $240
+ADDRGP4 $236
+JUMPV
+LABELV $237
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotUpdateItemWeights
+CALLV
+pop
+LABELV $236
+endproc BotPrepareItemWeights 16 8
+export BotLevelItemWeight
+proc BotLevelItemWeight 8 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4564
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $242
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 bot_droppedweight+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $242
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $245
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $245
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $241
+endproc BotLevelItemWeight 8 0
+data
+align 4
+LABELV $248
+byte 4 0
+export BotInitInfoEntities
+code
+proc BotInitInfoEntities 180 20
+ADDRGP4 $248
+INDIRI4
+CNSTI4 0
+EQI4 $249
+ADDRGP4 $247
+JUMPV
+LABELV $249
+ADDRGP4 $248
+CNSTI4 1
+ASGNI4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRGP4 $254
+JUMPV
+LABELV $251
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $257
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $255
+ADDRGP4 $252
+JUMPV
+LABELV $255
+ADDRLP4 8
+ARGP4
+ADDRGP4 $260
+ARGP4
+ADDRLP4 152
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $258
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $261
+ARGP4
+ADDRLP4 156
+ARGP4
+ADDRGP4 trap_AAS_VectorForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 156
+ARGP4
+ADDRLP4 172
+ADDRGP4 trap_AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 168
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $262
+CNSTI4 1
+ARGI4
+ADDRGP4 $264
+ARGP4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRLP4 156+4
+INDIRF4
+ARGF4
+ADDRLP4 156+8
+INDIRF4
+ARGF4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $252
+JUMPV
+LABELV $262
+CNSTI4 164
+ARGI4
+ADDRLP4 176
+ADDRGP4 trap_HeapMalloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 156
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $267
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $268
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $270
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $271
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 156
+ADDP4
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRGP4 campspots
+INDIRP4
+ASGNP4
+ADDRGP4 campspots
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $258
+LABELV $252
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 148
+INDIRI4
+ASGNI4
+LABELV $254
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $251
+CNSTI4 0
+ARGI4
+ADDRGP4 $272
+ARGP4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $247
+endproc BotInitInfoEntities 180 20
+export BotUnlinkSolidItems
+proc BotUnlinkSolidItems 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 6
+EQI4 $274
+ADDRGP4 $273
+JUMPV
+LABELV $274
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRGP4 $280
+JUMPV
+LABELV $277
+ADDRLP4 12
+CNSTI4 148
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $282
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $282
+ADDRLP4 16
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $282
+ADDRLP4 16
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $284
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $286
+ADDRLP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $285
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $282
+LABELV $286
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $287
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRGP4 $288
+JUMPV
+LABELV $287
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $288
+LABELV $282
+LABELV $278
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 728
+ADDP4
+ASGNP4
+LABELV $280
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $277
+LABELV $273
+endproc BotUnlinkSolidItems 28 8
+export BotInitLevelItems
+proc BotInitLevelItems 320 28
+ADDRGP4 BotInitInfoEntities
+CALLV
+pop
+ADDRGP4 InitLevelItemHeap
+CALLV
+pop
+ADDRGP4 levelitems
+CNSTP4 0
+ASGNP4
+ADDRLP4 244
+CNSTI4 0
+ASGNI4
+ADDRGP4 numlevelitems
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRGP4 numclustereditems
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRGP4 clustereditemsvalid
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRGP4 leveltraveltimefactor
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 4
+ADDRGP4 itemconfig
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $290
+ADDRGP4 $289
+JUMPV
+LABELV $290
+ADDRLP4 248
+ADDRGP4 trap_AAS_Loaded
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+NEI4 $292
+ADDRGP4 $289
+JUMPV
+LABELV $292
+CNSTI4 1
+ARGI4
+ADDRGP4 BotUnlinkSolidItems
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $297
+JUMPV
+LABELV $294
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $298
+CNSTI4 0
+ARGI4
+ADDRGP4 $300
+ARGP4
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $298
+LABELV $295
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $297
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+LTI4 $294
+CNSTI4 0
+ARGI4
+ADDRLP4 252
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRGP4 $304
+JUMPV
+LABELV $301
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 $257
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 256
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+NEI4 $305
+ADDRGP4 $302
+JUMPV
+LABELV $305
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 $307
+ARGP4
+ADDRLP4 160
+ARGP4
+ADDRGP4 trap_AAS_IntForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $311
+JUMPV
+LABELV $308
+ADDRLP4 12
+ARGP4
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $312
+ADDRGP4 $310
+JUMPV
+LABELV $312
+LABELV $309
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $311
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+LTI4 $308
+LABELV $310
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+LTI4 $314
+ADDRGP4 $302
+JUMPV
+LABELV $314
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 $261
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 260
+ADDRGP4 trap_AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $316
+CNSTI4 3
+ARGI4
+ADDRGP4 $318
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $302
+JUMPV
+LABELV $316
+ADDRLP4 264
+CNSTI4 0
+ASGNI4
+ADDRLP4 164
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 264
+INDIRI4
+EQI4 $319
+ADDRLP4 148
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $321
+ADDRLP4 168
+ADDRLP4 148
+INDIRB
+ASGNB 12
+ADDRLP4 168+8
+ADDRLP4 168+8
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 180
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 272
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+CNSTI4 208
+ADDP4
+ARGP4
+ADDRLP4 272
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRLP4 168
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 180+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $324
+ADDRLP4 148
+ARGP4
+ADDRLP4 276
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+CNSTI4 208
+ADDP4
+ARGP4
+ADDRLP4 276
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 trap_AAS_BestReachableFromJumpPadArea
+CALLI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 280
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRGP4 $327
+ARGP4
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 164
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $328
+ADDRGP4 $302
+JUMPV
+LABELV $328
+LABELV $324
+LABELV $321
+LABELV $319
+ADDRLP4 268
+ADDRGP4 AllocLevelItem
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 268
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $330
+ADDRGP4 $289
+JUMPV
+LABELV $330
+ADDRLP4 272
+ADDRGP4 numlevelitems
+ASGNP4
+ADDRLP4 276
+ADDRLP4 272
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 272
+INDIRP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 $332
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRGP4 trap_AAS_IntForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $333
+ADDRLP4 280
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 280
+INDIRP4
+ADDRLP4 280
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $333
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 $335
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRGP4 trap_AAS_IntForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $336
+ADDRLP4 284
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 284
+INDIRP4
+ADDRLP4 284
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $336
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 $338
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRGP4 trap_AAS_IntForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $339
+ADDRLP4 288
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 288
+INDIRP4
+ADDRLP4 288
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $339
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 $341
+ARGP4
+ADDRLP4 144
+ARGP4
+ADDRGP4 trap_AAS_IntForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $342
+ADDRLP4 292
+CNSTI4 8
+ASGNI4
+ADDRLP4 296
+ADDRLP4 8
+INDIRP4
+ADDRLP4 292
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+ADDRLP4 296
+INDIRP4
+INDIRI4
+ADDRLP4 292
+INDIRI4
+BORI4
+ASGNI4
+LABELV $342
+ADDRLP4 12
+ARGP4
+ADDRGP4 $346
+ARGP4
+ADDRLP4 300
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+NEI4 $344
+ADDRLP4 304
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRGP4 $345
+JUMPV
+LABELV $344
+ADDRGP4 g_instagib+12
+INDIRI4
+CNSTI4 0
+EQI4 $347
+ADDRLP4 12
+ARGP4
+ADDRGP4 $350
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 304
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $347
+ADDRLP4 308
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ADDRLP4 308
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $347
+LABELV $345
+ADDRLP4 160
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $351
+ADDRLP4 148
+ARGP4
+ADDRLP4 308
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+CNSTI4 208
+ADDP4
+ARGP4
+ADDRLP4 308
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 312
+ADDRGP4 trap_AAS_DropToFloor
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+NEI4 $353
+CNSTI4 1
+ARGI4
+ADDRGP4 $355
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 148+4
+INDIRF4
+ARGF4
+ADDRLP4 148+8
+INDIRF4
+ARGF4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $353
+LABELV $351
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 148
+INDIRB
+ASGNB 12
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $358
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 148
+INDIRB
+ASGNB 12
+ADDRGP4 $359
+JUMPV
+LABELV $358
+ADDRLP4 148
+ARGP4
+ADDRLP4 308
+CNSTI4 236
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+CNSTI4 208
+ADDP4
+ARGP4
+ADDRLP4 308
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 trap_AAS_BestReachableArea
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $360
+CNSTI4 1
+ARGI4
+ADDRGP4 $362
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 148+4
+INDIRF4
+ARGF4
+ADDRLP4 148+8
+INDIRF4
+ARGF4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $360
+LABELV $359
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotLevelItemGoalAreaInfo
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AddLevelItemToList
+CALLV
+pop
+LABELV $302
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 256
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 256
+INDIRI4
+ASGNI4
+LABELV $304
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $301
+CNSTI4 0
+ARGI4
+ADDRGP4 $365
+ARGP4
+ADDRGP4 numlevelitems
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 BotUnlinkSolidItems
+CALLV
+pop
+LABELV $289
+endproc BotInitLevelItems 320 28
+export BotGoalName
+proc BotGoalName 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 itemconfig
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $367
+ADDRGP4 $366
+JUMPV
+LABELV $367
+ADDRLP4 0
+ADDRGP4 levelitems
+INDIRP4
+ASGNP4
+ADDRGP4 $372
+JUMPV
+LABELV $369
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $373
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+CNSTI4 236
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 itemconfig
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $366
+JUMPV
+LABELV $373
+LABELV $370
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $372
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $369
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $375
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $366
+endproc BotGoalName 8 12
+export BotResetAvoidGoals
+proc BotResetAvoidGoals 8 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $377
+ADDRGP4 $376
+JUMPV
+LABELV $377
+ADDRLP4 0
+INDIRP4
+CNSTI4 1488
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 2512
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $376
+endproc BotResetAvoidGoals 8 12
+export BotDumpAvoidGoals
+proc BotDumpAvoidGoals 52 20
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $380
+ADDRGP4 $379
+JUMPV
+LABELV $380
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $382
+ADDRLP4 44
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2512
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+LTF4 $386
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1488
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 BotGoalName
+CALLV
+pop
+ADDRLP4 48
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+CNSTI4 0
+ARGI4
+ADDRGP4 $388
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1488
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2512
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ARGF4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $386
+LABELV $383
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $382
+LABELV $379
+endproc BotDumpAvoidGoals 52 20
+export BotAddToAvoidGoals
+proc BotAddToAvoidGoals 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $390
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1488
+ADDP4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $394
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1488
+ADDP4
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 2512
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $389
+JUMPV
+LABELV $394
+LABELV $391
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $390
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $396
+ADDRLP4 4
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 2512
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $400
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1488
+ADDP4
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 2512
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $389
+JUMPV
+LABELV $400
+LABELV $397
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $396
+LABELV $389
+endproc BotAddToAvoidGoals 12 0
+export BotRemoveFromAvoidGoals
+proc BotRemoveFromAvoidGoals 24 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $403
+ADDRGP4 $402
+JUMPV
+LABELV $403
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $405
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1488
+ADDP4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $409
+ADDRLP4 20
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2512
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LTF4 $409
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2512
+ADDP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $402
+JUMPV
+LABELV $409
+LABELV $406
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $405
+LABELV $402
+endproc BotRemoveFromAvoidGoals 24 4
+export BotAvoidGoalTime
+proc BotAvoidGoalTime 28 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $412
+CNSTF4 0
+RETF4
+ADDRGP4 $411
+JUMPV
+LABELV $412
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $414
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1488
+ADDP4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $418
+ADDRLP4 20
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2512
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LTF4 $418
+ADDRLP4 24
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2512
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+RETF4
+ADDRGP4 $411
+JUMPV
+LABELV $418
+LABELV $415
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $414
+CNSTF4 0
+RETF4
+LABELV $411
+endproc BotAvoidGoalTime 28 4
+export BotSetAvoidGoalTime
+proc BotSetAvoidGoalTime 16 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $421
+ADDRGP4 $420
+JUMPV
+LABELV $421
+ADDRFP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $423
+ADDRGP4 itemconfig
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $425
+ADDRGP4 $420
+JUMPV
+LABELV $425
+ADDRLP4 0
+ADDRGP4 levelitems
+INDIRP4
+ASGNP4
+ADDRGP4 $430
+JUMPV
+LABELV $427
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $431
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+CNSTI4 236
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 itemconfig
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 0
+NEF4 $433
+ADDRFP4 8
+CNSTF4 1106247680
+ASGNF4
+LABELV $433
+ADDRFP4 8
+INDIRF4
+CNSTF4 1092616192
+GEF4 $435
+ADDRFP4 8
+CNSTF4 1092616192
+ASGNF4
+LABELV $435
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRGP4 BotAddToAvoidGoals
+CALLV
+pop
+ADDRGP4 $420
+JUMPV
+LABELV $431
+LABELV $428
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $430
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $427
+ADDRGP4 $420
+JUMPV
+LABELV $423
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRGP4 BotAddToAvoidGoals
+CALLV
+pop
+LABELV $420
+endproc BotSetAvoidGoalTime 16 12
+export BotGetLevelItemGoal
+proc BotGetLevelItemGoal 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 itemconfig
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $438
+CNSTI4 -1
+RETI4
+ADDRGP4 $437
+JUMPV
+LABELV $438
+ADDRLP4 0
+ADDRGP4 levelitems
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $451
+ADDRGP4 $445
+JUMPV
+LABELV $442
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $446
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $451
+JUMPV
+LABELV $446
+LABELV $443
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $445
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $442
+ADDRGP4 $451
+JUMPV
+LABELV $448
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+NEI4 $452
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $455
+ADDRGP4 $449
+JUMPV
+LABELV $455
+LABELV $452
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $457
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $458
+ADDRGP4 $449
+JUMPV
+LABELV $457
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $462
+ADDRGP4 $449
+JUMPV
+LABELV $462
+LABELV $458
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $464
+ADDRGP4 $449
+JUMPV
+LABELV $464
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+CNSTI4 236
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 itemconfig
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $466
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 236
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 itemconfig
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDP4
+CNSTI4 208
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTI4 236
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 itemconfig
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDP4
+CNSTI4 220
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $468
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $468
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+RETI4
+ADDRGP4 $437
+JUMPV
+LABELV $466
+LABELV $449
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $451
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $448
+CNSTI4 -1
+RETI4
+LABELV $437
+endproc BotGetLevelItemGoal 28 8
+lit
+align 4
+LABELV $471
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $472
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export BotGetMapLocationGoal
+code
+proc BotGetMapLocationGoal 32 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $471
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRGP4 $472
+INDIRB
+ASGNB 12
+ADDRGP4 level+9188
+INDIRI4
+CNSTI4 0
+NEI4 $473
+CNSTI4 0
+RETI4
+ADDRGP4 $470
+JUMPV
+LABELV $473
+ADDRLP4 0
+ADDRGP4 level+9192
+INDIRP4
+ASGNP4
+ADDRGP4 $479
+JUMPV
+LABELV $476
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $481
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $470
+JUMPV
+LABELV $481
+LABELV $477
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 420
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $479
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $476
+CNSTI4 0
+RETI4
+LABELV $470
+endproc BotGetMapLocationGoal 32 8
+lit
+align 4
+LABELV $484
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $485
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export BotGetNextCampSpotGoal
+code
+proc BotGetNextCampSpotGoal 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 $484
+INDIRB
+ASGNB 12
+ADDRLP4 20
+ADDRGP4 $485
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $486
+ADDRFP4 0
+CNSTI4 0
+ASGNI4
+LABELV $486
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 campspots
+INDIRP4
+ASGNP4
+ADDRGP4 $491
+JUMPV
+LABELV $488
+ADDRLP4 32
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+GEI4 $492
+ADDRLP4 36
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 20
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+RETI4
+ADDRGP4 $483
+JUMPV
+LABELV $492
+LABELV $489
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $491
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $488
+CNSTI4 0
+RETI4
+LABELV $483
+endproc BotGetNextCampSpotGoal 40 0
+export BotUpdateEntityItems
+proc BotUpdateEntityItems 204 16
+ADDRLP4 0
+ADDRGP4 levelitems
+INDIRP4
+ASGNP4
+ADDRGP4 $498
+JUMPV
+LABELV $495
+ADDRLP4 160
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $499
+ADDRLP4 168
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRLP4 168
+INDIRF4
+GEF4 $501
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 RemoveLevelItemFromList
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FreeLevelItem
+CALLV
+pop
+LABELV $501
+LABELV $499
+LABELV $496
+ADDRLP4 0
+ADDRLP4 160
+INDIRP4
+ASGNP4
+LABELV $498
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $495
+ADDRLP4 164
+ADDRGP4 itemconfig
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $503
+ADDRGP4 $494
+JUMPV
+LABELV $503
+CNSTI4 0
+ARGI4
+ADDRLP4 168
+ADDRGP4 BotNextEntity
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRGP4 $508
+JUMPV
+LABELV $505
+CNSTI4 728
+ADDRLP4 144
+INDIRI4
+MULI4
+ADDRGP4 g_entities+84+64
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $509
+ADDRGP4 $506
+JUMPV
+LABELV $509
+ADDRLP4 140
+CNSTI4 728
+ADDRLP4 144
+INDIRI4
+MULI4
+ADDRGP4 g_entities+84+12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $515
+ADDRGP4 $506
+JUMPV
+LABELV $515
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 8+24
+INDIRF4
+ADDRLP4 8+48
+INDIRF4
+NEF4 $530
+ADDRLP4 8+24+4
+INDIRF4
+ADDRLP4 8+48+4
+INDIRF4
+NEF4 $530
+ADDRLP4 8+24+8
+INDIRF4
+ADDRLP4 8+48+8
+INDIRF4
+EQF4 $517
+LABELV $530
+ADDRGP4 $506
+JUMPV
+LABELV $517
+ADDRLP4 0
+ADDRGP4 levelitems
+INDIRP4
+ASGNP4
+ADDRGP4 $534
+JUMPV
+LABELV $531
+ADDRLP4 172
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $535
+ADDRLP4 172
+INDIRI4
+ADDRLP4 144
+INDIRI4
+NEI4 $535
+ADDRLP4 176
+CNSTI4 4
+ASGNI4
+CNSTI4 236
+ADDRLP4 0
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 176
+INDIRI4
+ADDP4
+ADDP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ADDRLP4 140
+INDIRI4
+EQI4 $537
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 RemoveLevelItemFromList
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FreeLevelItem
+CALLV
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $533
+JUMPV
+LABELV $537
+ADDRLP4 8+24
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+NEF4 $547
+ADDRLP4 8+24+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+NEF4 $547
+ADDRLP4 8+24+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+EQF4 $533
+LABELV $547
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 8+24
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 188
+CNSTI4 4
+ASGNI4
+ADDRLP4 192
+CNSTI4 236
+ADDRLP4 0
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+CNSTI4 208
+ADDP4
+ARGP4
+ADDRLP4 192
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 trap_AAS_BestReachableArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotLevelItemGoalAreaInfo
+CALLV
+pop
+ADDRGP4 $533
+JUMPV
+LABELV $535
+LABELV $532
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $534
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $531
+LABELV $533
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $549
+ADDRGP4 $506
+JUMPV
+LABELV $549
+ADDRLP4 0
+ADDRGP4 levelitems
+INDIRP4
+ASGNP4
+ADDRGP4 $554
+JUMPV
+LABELV $551
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $555
+ADDRGP4 $552
+JUMPV
+LABELV $555
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+NEI4 $557
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $560
+ADDRGP4 $552
+JUMPV
+LABELV $560
+LABELV $557
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $562
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $563
+ADDRGP4 $552
+JUMPV
+LABELV $562
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $567
+ADDRGP4 $552
+JUMPV
+LABELV $567
+LABELV $563
+ADDRLP4 172
+CNSTI4 4
+ASGNI4
+CNSTI4 236
+ADDRLP4 0
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 172
+INDIRI4
+ADDP4
+ADDP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ADDRLP4 140
+INDIRI4
+NEI4 $569
+ADDRLP4 148
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 8+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 8+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 8+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148
+ARGP4
+ADDRLP4 180
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 180
+INDIRF4
+CNSTF4 1106247680
+GEF4 $578
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 8+24
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+NEF4 $588
+ADDRLP4 8+24+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+NEF4 $588
+ADDRLP4 8+24+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+EQF4 $553
+LABELV $588
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 8+24
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 192
+CNSTI4 4
+ASGNI4
+ADDRLP4 196
+CNSTI4 236
+ADDRLP4 0
+INDIRP4
+ADDRLP4 192
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 192
+INDIRI4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+CNSTI4 208
+ADDP4
+ARGP4
+ADDRLP4 196
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_AAS_BestReachableArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotLevelItemGoalAreaInfo
+CALLV
+pop
+ADDRGP4 $553
+JUMPV
+LABELV $578
+LABELV $569
+LABELV $552
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $554
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $551
+LABELV $553
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $590
+ADDRGP4 $506
+JUMPV
+LABELV $590
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRGP4 $595
+JUMPV
+LABELV $592
+CNSTI4 236
+ADDRLP4 136
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ADDRLP4 140
+INDIRI4
+NEI4 $596
+ADDRGP4 $594
+JUMPV
+LABELV $596
+LABELV $593
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $595
+ADDRLP4 136
+INDIRI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+LTI4 $592
+LABELV $594
+ADDRLP4 136
+INDIRI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+LTI4 $598
+ADDRGP4 $506
+JUMPV
+LABELV $598
+ADDRLP4 172
+ADDRGP4 AllocLevelItem
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 172
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $600
+ADDRGP4 $506
+JUMPV
+LABELV $600
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 numlevelitems
+INDIRI4
+ADDRLP4 144
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 8+24
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 180
+CNSTI4 236
+ADDRLP4 136
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+CNSTI4 208
+ADDP4
+ARGP4
+ADDRLP4 180
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 trap_AAS_BestReachableArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotLevelItemGoalAreaInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 188
+ADDRGP4 trap_AAS_AreaJumpPad
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $603
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FreeLevelItem
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $603
+ADDRLP4 192
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 192
+INDIRF4
+CNSTF4 1106247680
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 AddLevelItemToList
+CALLV
+pop
+LABELV $506
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 172
+ADDRGP4 BotNextEntity
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 172
+INDIRI4
+ASGNI4
+LABELV $508
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $505
+LABELV $494
+endproc BotUpdateEntityItems 204 16
+export BotDumpGoalStack
+proc BotDumpGoalStack 44 16
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $606
+ADDRGP4 $605
+JUMPV
+LABELV $606
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $611
+JUMPV
+LABELV $608
+CNSTI4 56
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1036
+ADDP4
+ADDP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 BotGoalName
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $612
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $609
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $611
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1484
+ADDP4
+INDIRI4
+LEI4 $608
+LABELV $605
+endproc BotDumpGoalStack 44 16
+export BotPushGoal
+proc BotPushGoal 16 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $614
+ADDRGP4 $613
+JUMPV
+LABELV $614
+ADDRLP4 0
+INDIRP4
+CNSTI4 1484
+ADDP4
+INDIRI4
+CNSTI4 7
+LTI4 $616
+CNSTI4 3
+ARGI4
+ADDRGP4 $618
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotDumpGoalStack
+CALLV
+pop
+ADDRGP4 $613
+JUMPV
+LABELV $616
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 1484
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 1484
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1036
+ADDP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $613
+endproc BotPushGoal 16 12
+export BotPopGoal
+proc BotPopGoal 12 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $620
+ADDRGP4 $619
+JUMPV
+LABELV $620
+ADDRLP4 0
+INDIRP4
+CNSTI4 1484
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $622
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 1484
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $622
+LABELV $619
+endproc BotPopGoal 12 4
+export BotEmptyGoalStack
+proc BotEmptyGoalStack 8 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $625
+ADDRGP4 $624
+JUMPV
+LABELV $625
+ADDRLP4 0
+INDIRP4
+CNSTI4 1484
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $624
+endproc BotEmptyGoalStack 8 4
+export BotGetTopGoal
+proc BotGetTopGoal 12 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $628
+CNSTI4 0
+RETI4
+ADDRGP4 $627
+JUMPV
+LABELV $628
+ADDRLP4 0
+INDIRP4
+CNSTI4 1484
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $630
+CNSTI4 0
+RETI4
+ADDRGP4 $627
+JUMPV
+LABELV $630
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 1484
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1036
+ADDP4
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+LABELV $627
+endproc BotGetTopGoal 12 12
+export BotGetSecondGoal
+proc BotGetSecondGoal 16 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $633
+CNSTI4 0
+RETI4
+ADDRGP4 $632
+JUMPV
+LABELV $633
+ADDRLP4 0
+INDIRP4
+CNSTI4 1484
+ADDP4
+INDIRI4
+CNSTI4 1
+GTI4 $635
+CNSTI4 0
+RETI4
+ADDRGP4 $632
+JUMPV
+LABELV $635
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+CNSTI4 56
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1484
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1036
+ADDP4
+ADDP4
+ARGP4
+CNSTU4 56
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+LABELV $632
+endproc BotGetSecondGoal 16 12
+export BotChooseLTGItem
+proc BotChooseLTGItem 228 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $638
+CNSTI4 0
+RETI4
+ADDRGP4 $637
+JUMPV
+LABELV $638
+ADDRLP4 12
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $640
+CNSTI4 0
+RETI4
+ADDRGP4 $637
+JUMPV
+LABELV $640
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 1028
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 168
+ADDRGP4 BotReachabilityArea
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $644
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+NEI4 $642
+LABELV $644
+ADDRLP4 36
+ADDRLP4 12
+INDIRP4
+CNSTI4 1032
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $642
+ADDRLP4 12
+INDIRP4
+CNSTI4 1032
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $645
+CNSTI4 0
+RETI4
+ADDRGP4 $637
+JUMPV
+LABELV $645
+ADDRLP4 180
+ADDRGP4 itemconfig
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $647
+CNSTI4 0
+RETI4
+ADDRGP4 $637
+JUMPV
+LABELV $647
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotUpdateItemWeights
+CALLV
+pop
+ADDRLP4 100
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 44
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 112
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 112+12
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 BotFirstClusterLevelItem
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 188
+ADDRGP4 BotTravelTimeFactor
+CALLF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $653
+JUMPV
+LABELV $650
+ADDRLP4 192
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+ADDRLP4 40
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ADDRGP4 numclustereditems
+INDIRI4
+MODI4
+ADDRLP4 192
+INDIRI4
+LSHI4
+ADDRGP4 clustereditems
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 g_gametype+12
+INDIRI4
+ADDRLP4 192
+INDIRI4
+NEI4 $654
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $657
+ADDRGP4 $651
+JUMPV
+LABELV $657
+LABELV $654
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $659
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $660
+ADDRGP4 $651
+JUMPV
+LABELV $659
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $664
+ADDRGP4 $651
+JUMPV
+LABELV $664
+LABELV $660
+ADDRLP4 196
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 196
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 196
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $666
+ADDRGP4 $651
+JUMPV
+LABELV $666
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $668
+ADDRGP4 $651
+JUMPV
+LABELV $668
+ADDRLP4 204
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 204
+INDIRI4
+NEI4 $670
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 204
+INDIRI4
+NEI4 $670
+ADDRGP4 $651
+JUMPV
+LABELV $670
+ADDRLP4 208
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+CNSTI4 236
+ADDRLP4 0
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 20
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+GEI4 $672
+ADDRGP4 $651
+JUMPV
+LABELV $672
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 212
+ADDRGP4 BotLevelItemWeight
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 212
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+LEF4 $674
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 216
+ADDRGP4 BotLevelItemMinTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+MULF4
+DIVF4
+ADDRLP4 100
+INDIRF4
+GTF4 $676
+ADDRGP4 $651
+JUMPV
+LABELV $676
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 220
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 220
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LEI4 $678
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 BotAvoidGoalTime
+CALLF4
+ASGNF4
+ADDRLP4 104
+ADDRLP4 224
+INDIRF4
+ASGNF4
+ADDRLP4 104
+INDIRF4
+CNSTF4 1007908028
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+CNSTF4 0
+LEF4 $680
+ADDRGP4 $651
+JUMPV
+LABELV $680
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+LEF4 $682
+ADDRLP4 100
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $682
+LABELV $678
+LABELV $674
+LABELV $651
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $653
+ADDRLP4 8
+INDIRI4
+ADDRGP4 numclustereditems
+INDIRI4
+LTI4 $650
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $684
+CNSTI4 0
+RETI4
+ADDRGP4 $637
+JUMPV
+LABELV $684
+ADDRLP4 196
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+CNSTI4 236
+ADDRLP4 28
+INDIRP4
+ADDRLP4 196
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 196
+INDIRI4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 28
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 44+16
+ADDRLP4 20
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 44+28
+ADDRLP4 20
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 44+12
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44+40
+ADDRLP4 28
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44+44
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 44+48
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $692
+ADDRLP4 44+48
+ADDRLP4 44+48
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $692
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $695
+ADDRLP4 44+48
+ADDRLP4 44+48
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $695
+ADDRLP4 44+52
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $699
+ADDRLP4 104
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 $700
+JUMPV
+LABELV $699
+ADDRLP4 104
+ADDRLP4 20
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 104
+INDIRF4
+CNSTF4 0
+NEF4 $701
+ADDRLP4 104
+CNSTF4 1106247680
+ASGNF4
+LABELV $701
+ADDRLP4 104
+INDIRF4
+CNSTF4 1092616192
+GEF4 $703
+ADDRLP4 104
+CNSTF4 1092616192
+ASGNF4
+LABELV $703
+LABELV $700
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+INDIRF4
+ARGF4
+ADDRGP4 BotAddToAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 44
+ARGP4
+ADDRGP4 BotPushGoal
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $637
+endproc BotChooseLTGItem 228 16
+export BotChooseNBGItem
+proc BotChooseNBGItem 248 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 168
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 168
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $706
+CNSTI4 0
+RETI4
+ADDRGP4 $705
+JUMPV
+LABELV $706
+ADDRLP4 16
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $708
+CNSTI4 0
+RETI4
+ADDRGP4 $705
+JUMPV
+LABELV $708
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 1028
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 172
+ADDRGP4 BotReachabilityArea
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $712
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $710
+LABELV $712
+ADDRLP4 32
+ADDRLP4 16
+INDIRP4
+CNSTI4 1032
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $710
+ADDRLP4 16
+INDIRP4
+CNSTI4 1032
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $713
+CNSTI4 0
+RETI4
+ADDRGP4 $705
+JUMPV
+LABELV $713
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $715
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRGP4 $716
+JUMPV
+LABELV $715
+ADDRLP4 112
+CNSTI4 99999
+ASGNI4
+LABELV $716
+ADDRLP4 188
+ADDRGP4 itemconfig
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 188
+INDIRP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $717
+CNSTI4 0
+RETI4
+ADDRGP4 $705
+JUMPV
+LABELV $717
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotUpdateItemWeights
+CALLV
+pop
+ADDRLP4 100
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 44
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 56
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 116
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 116+12
+INDIRI4
+ARGI4
+ADDRLP4 192
+ADDRGP4 BotFirstClusterLevelItem
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRLP4 196
+ADDRGP4 BotTravelTimeFactor
+CALLF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $723
+JUMPV
+LABELV $720
+ADDRLP4 200
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+ADDRLP4 40
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ADDRGP4 numclustereditems
+INDIRI4
+MODI4
+ADDRLP4 200
+INDIRI4
+LSHI4
+ADDRGP4 clustereditems
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 g_gametype+12
+INDIRI4
+ADDRLP4 200
+INDIRI4
+NEI4 $724
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $727
+ADDRGP4 $721
+JUMPV
+LABELV $727
+LABELV $724
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $729
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $730
+ADDRGP4 $721
+JUMPV
+LABELV $729
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $734
+ADDRGP4 $721
+JUMPV
+LABELV $734
+LABELV $730
+ADDRLP4 204
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 204
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $736
+ADDRGP4 $721
+JUMPV
+LABELV $736
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $738
+ADDRGP4 $721
+JUMPV
+LABELV $738
+ADDRLP4 212
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 212
+INDIRI4
+NEI4 $740
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 212
+INDIRI4
+NEI4 $740
+ADDRGP4 $721
+JUMPV
+LABELV $740
+ADDRLP4 216
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+CNSTI4 236
+ADDRLP4 0
+INDIRP4
+ADDRLP4 216
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 216
+INDIRI4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 20
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 216
+INDIRI4
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+GEI4 $742
+ADDRGP4 $721
+JUMPV
+LABELV $742
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 220
+ADDRGP4 BotLevelItemWeight
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 220
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+LEF4 $744
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 224
+ADDRGP4 BotLevelItemMinTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 224
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRFP4 20
+INDIRF4
+LTF4 $746
+ADDRGP4 $721
+JUMPV
+LABELV $746
+ADDRLP4 12
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+DIVF4
+ADDRLP4 100
+INDIRF4
+GTF4 $748
+ADDRGP4 $721
+JUMPV
+LABELV $748
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 228
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $750
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRFP4 20
+INDIRF4
+GEF4 $750
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 236
+ADDRGP4 BotAvoidGoalTime
+CALLF4
+ASGNF4
+ADDRLP4 104
+ADDRLP4 236
+INDIRF4
+ASGNF4
+ADDRLP4 104
+INDIRF4
+CNSTF4 1007908028
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+CNSTF4 0
+LEF4 $752
+ADDRGP4 $721
+JUMPV
+LABELV $752
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 100
+INDIRF4
+LEF4 $754
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $756
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $756
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 244
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 244
+INDIRI4
+ASGNI4
+LABELV $756
+ADDRLP4 4
+INDIRI4
+ADDRLP4 112
+INDIRI4
+GTI4 $758
+ADDRLP4 100
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $758
+LABELV $754
+LABELV $750
+LABELV $744
+LABELV $721
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $723
+ADDRLP4 8
+INDIRI4
+ADDRGP4 numclustereditems
+INDIRI4
+LTI4 $720
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $760
+CNSTI4 0
+RETI4
+ADDRGP4 $705
+JUMPV
+LABELV $760
+ADDRLP4 204
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+CNSTI4 236
+ADDRLP4 28
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 28
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 44+16
+ADDRLP4 20
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 44+28
+ADDRLP4 20
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 44+12
+ADDRLP4 28
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44+40
+ADDRLP4 28
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44+44
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 44+48
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $768
+ADDRLP4 44+48
+ADDRLP4 44+48
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $768
+ADDRLP4 28
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $771
+ADDRLP4 44+48
+ADDRLP4 44+48
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $771
+ADDRLP4 44+52
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $775
+ADDRLP4 104
+CNSTF4 1092616192
+ASGNF4
+ADDRGP4 $776
+JUMPV
+LABELV $775
+ADDRLP4 104
+ADDRLP4 20
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 104
+INDIRF4
+CNSTF4 0
+NEF4 $777
+ADDRLP4 104
+CNSTF4 1106247680
+ASGNF4
+LABELV $777
+ADDRLP4 104
+INDIRF4
+CNSTF4 1092616192
+GEF4 $779
+ADDRLP4 104
+CNSTF4 1092616192
+ASGNF4
+LABELV $779
+LABELV $776
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+INDIRF4
+ARGF4
+ADDRGP4 BotAddToAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 44
+ARGP4
+ADDRGP4 BotPushGoal
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $705
+endproc BotChooseNBGItem 248 16
+lit
+align 4
+LABELV $782
+byte 4 0
+byte 4 0
+byte 4 0
+align 4
+LABELV $783
+byte 4 0
+byte 4 0
+byte 4 0
+export BotTouchingGoal
+code
+proc BotTouchingGoal 100 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRGP4 $782
+INDIRB
+ASGNB 12
+ADDRLP4 64
+ADDRGP4 $783
+INDIRB
+ASGNB 12
+CNSTI4 2
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 40+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 40+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 16+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 52+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 52+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 64
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 64+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 64+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $812
+ADDRLP4 92
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 92
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+LTF4 $818
+ADDRLP4 96
+INDIRF4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 16
+ADDP4
+INDIRF4
+LEF4 $816
+LABELV $818
+CNSTI4 0
+RETI4
+ADDRGP4 $781
+JUMPV
+LABELV $816
+LABELV $813
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $812
+CNSTI4 1
+RETI4
+LABELV $781
+endproc BotTouchingGoal 100 12
+export BotItemGoalInVisButNotVisible
+proc BotItemGoalInVisButNotVisible 236 28
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $820
+CNSTI4 0
+RETI4
+ADDRGP4 $819
+JUMPV
+LABELV $820
+ADDRLP4 208
+ADDRFP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 208
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 212
+ADDRFP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 212
+INDIRF4
+ADDRLP4 212
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 216
+ADDRFP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 216
+INDIRF4
+ADDRLP4 216
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 220
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 220
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 228
+CNSTP4 0
+ASGNP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRLP4 228
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $832
+ADDRFP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $835
+CNSTI4 0
+RETI4
+ADDRGP4 $819
+JUMPV
+LABELV $835
+ADDRFP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 232
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRLP4 76+12
+INDIRF4
+ADDRLP4 232
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+GEF4 $837
+CNSTI4 1
+RETI4
+ADDRGP4 $819
+JUMPV
+LABELV $837
+LABELV $832
+CNSTI4 0
+RETI4
+LABELV $819
+endproc BotItemGoalInVisButNotVisible 236 28
+export BotResetGoalState
+proc BotResetGoalState 8 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $841
+ADDRGP4 $840
+JUMPV
+LABELV $841
+ADDRLP4 0
+INDIRP4
+CNSTI4 1036
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 448
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 1484
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotResetAvoidGoals
+CALLV
+pop
+LABELV $840
+endproc BotResetGoalState 8 12
+export BotLoadItemWeights
+proc BotLoadItemWeights 16 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $844
+CNSTI4 9
+RETI4
+ADDRGP4 $843
+JUMPV
+LABELV $844
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 ReadWeightConfig
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $846
+CNSTI4 4
+ARGI4
+ADDRGP4 $848
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 9
+RETI4
+ADDRGP4 $843
+JUMPV
+LABELV $846
+ADDRGP4 itemconfig
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $849
+CNSTI4 4
+ARGI4
+ADDRGP4 $851
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 9
+RETI4
+ADDRGP4 $843
+JUMPV
+LABELV $849
+ADDRGP4 itemconfig
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 ItemWeightIndex
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 3536
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+LABELV $843
+endproc BotLoadItemWeights 16 12
+export BotFreeItemWeights
+proc BotFreeItemWeights 8 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotGoalStateFromHandle
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $853
+ADDRGP4 $852
+JUMPV
+LABELV $853
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $855
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 FreeWeightConfig
+CALLV
+pop
+LABELV $855
+LABELV $852
+endproc BotFreeItemWeights 8 4
+export BotAllocGoalState
+proc BotAllocGoalState 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+CNSTI4 5588
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 botgoalstates+5588+1028
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+RETI4
+LABELV $857
+endproc BotAllocGoalState 4 0
+export BotFreeGoalState
+proc BotFreeGoalState 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $863
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LEI4 $861
+LABELV $863
+CNSTI4 4
+ARGI4
+ADDRGP4 $74
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $860
+JUMPV
+LABELV $861
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotFreeItemWeights
+CALLV
+pop
+LABELV $860
+endproc BotFreeGoalState 4 12
+export BotSetupGoalAI
+proc BotSetupGoalAI 4 8
+ADDRGP4 $865
+ARGP4
+ADDRLP4 0
+ADDRGP4 LoadItemConfig
+CALLP4
+ASGNP4
+ADDRGP4 itemconfig
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 itemconfig
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $866
+CNSTI4 4
+ARGI4
+ADDRGP4 $868
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 10
+RETI4
+ADDRGP4 $864
+JUMPV
+LABELV $866
+CNSTI4 0
+RETI4
+LABELV $864
+endproc BotSetupGoalAI 4 8
+export BotShutdownGoalAI
+proc BotShutdownGoalAI 8 0
+ADDRGP4 itemconfig
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 levelitemheap
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 freelevelitems
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 levelitems
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 numlevelitems
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 numclustereditems
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 clustereditemsvalid
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $869
+endproc BotShutdownGoalAI 8 0
+bss
+export clustereditems
+align 4
+LABELV clustereditems
+skip 1024
+align 4
+LABELV bot_itemconfig
+skip 60420
+align 4
+LABELV botgoalstates
+skip 363220
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotTeamAI
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import neutralobelisk
+import blueobelisk
+import redobelisk
+import ctf_neutralflag
+import ctf_blueflag
+import ctf_redflag
+import bot_offhandgrapple
+import bot_droppedweight
+import bot_challenge
+import bot_testrchat
+import bot_testichat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxplayers
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import PlayerOnSameTeamFromName
+import PlayerFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotEnemyCubeCarrierVisible
+import BotTeamCubeCarrierVisible
+import BotHarvesterRetreatGoals
+import BotHarvesterSeekGoals
+import BotGoHarvest
+import BotObeliskRetreatGoals
+import BotObeliskSeekGoals
+import Bot1FCTFRetreatGoals
+import Bot1FCTFSeekGoals
+import BotHarvesterCarryingCubes
+import Bot1FCTFCarryingFlag
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckBlockedTeammates
+import BotCheckAttack
+import BotAimAtEnemy
+import BotVisibilityStats
+import BotEndVisibilityFrame
+import BotBeginVisibilityFrame
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotCountTeamMates
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import BotCanCamp
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanGrapple
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import EasyPlayerName
+import PlayerName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityHasKamikaze
+import EntityIsShooting
+import SenseCarriesCubes
+import SenseIsInvisible
+import EntityIsInvisible
+import PowerupsCarryFlag
+import PlayerCarriesFlag
+import PlayerIsDead
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotPlayerStateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import bot_reloadcharacters
+import bot_showteamgoals
+import bot_shownodechanges
+import bot_developer
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetPlayerState
+import BotAI_DebugLineShow
+import BotAI_DebugLineDelete
+import BotAI_DebugLineCreate
+import BotAI_InPVS
+import BotAI_PointContents
+import BotAI_EntityTrace
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotLibVarGetValue
+import BotNextEntity
+import BotSense
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotShutdownWeights
+import InterbreedWeightConfigs
+import EvolveWeightConfig
+import ScaleBalanceRange
+import ScaleWeight
+import CompileWeightConfig
+import FuzzyWeightTree
+import FuzzyWeights
+import FuzzyWeightUndecided
+import FuzzyWeight
+import FindFuzzyWeight
+import WriteWeightConfig
+import FreeWeightConfig
+import ReadWeightConfig
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotInitPhysicsSettings
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotRoutingAreaChanged
+import BotResetMoveState
+import GeneticParentsAndChildSelection
+import BotMatchTemplatesContainsString
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatchLinear
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import GetBotLibAPI
+import g_instagib
+import g_playerCapsule
+import g_proxMineTimeout
+import g_singlePlayer
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGamePlayers
+import g_maxplayers
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import trap_AAS_DropToFloor
+import trap_AAS_HorizontalVelocityForJump
+import trap_AAS_AgainstLadder
+import trap_AAS_JumpReachRunStart
+import trap_AAS_Swimming
+import trap_AAS_OnGround
+import trap_AAS_PredictPlayerMovement
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaTravelTime
+import trap_AAS_EnableRoutingArea
+import trap_AAS_RandomGoalArea
+import trap_AAS_ReachabilityFromNum
+import trap_AAS_NextAreaReachability
+import trap_AAS_AreaContentsTravelFlags
+import trap_AAS_TravelFlagForType
+import trap_AAS_AreaDoNotEnter
+import trap_AAS_AreaJumpPad
+import trap_AAS_AreaLadder
+import trap_AAS_AreaGrounded
+import trap_AAS_AreaSlime
+import trap_AAS_AreaLava
+import trap_AAS_AreaLiquid
+import trap_AAS_AreaSwim
+import trap_AAS_AreaCrouch
+import trap_AAS_AreaGroundFaceArea
+import trap_AAS_NextModelReachability
+import trap_AAS_BestReachableFromJumpPadArea
+import trap_AAS_BestReachableArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_TracePlayerBBox
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_FloodAreas
+import trap_AAS_ShowReachableAreas
+import trap_AAS_ShowReachability
+import trap_AAS_DrawArrow
+import trap_AAS_PrintTravelType
+import trap_AAS_DrawCross
+import trap_AAS_ShowAreaPolygons
+import trap_AAS_ShowArea
+import trap_AAS_ShowFace
+import trap_AAS_ShowBoundingBox
+import trap_AAS_DrawPlaneCross
+import trap_AAS_DrawPermanentCross
+import trap_AAS_PermanentLine
+import trap_AAS_DebugLine
+import trap_AAS_ClearShownPolygons
+import trap_AAS_ClearShownDebugLines
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_Loaded
+import trap_AAS_PointInsideArea
+import trap_AAS_BBoxReachabilityAreas
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibUpdateEntities
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_RegisterModel
+import trap_DebugPolygonDelete
+import trap_DebugPolygonShow
+import trap_DebugPolygonCreate
+import trap_ClientCommand
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_ClipToEntitiesCapsule
+import trap_ClipToEntities
+import trap_TraceCapsule
+import trap_Trace
+import trap_GetBrushBounds
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_SetConfigstringRestrictions
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommandEx
+import trap_DropPlayer
+import trap_SetNetFields
+import trap_LocateGameData
+import Pickup_Team
+import Svcmd_TeamInfoStats_f
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import Team_BuildLocationTree
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import TeamName
+import OtherTeam
+import Svcmd_BotWeightBench_f
+import Svcmd_BotThinkReport_f
+import Svcmd_BotMatchBench_f
+import Svcmd_BotTeamplayReport_f
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownPlayer
+import BotAISetupPlayer
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import G_BotInitBotLib
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBotComplete
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunPlayer
+import PlayerEndFrame
+import PlayerThink
+import PlayerHandicap
+import ClientCommand
+import PlayerBegin
+import PlayerDisconnect
+import PlayerUserinfoChanged
+import PlayerConnect
+import G_Error
+import G_Printf
+import G_DPrintf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import AddTournamentQueue
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import MovePlayerToIntermission
+import StringIsInteger
+import ConcatArgs
+import G_ScoreboardChanged
+import DeathmatchScoreboardMessage
+import G_StartKamikaze
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import G_RegisterCommands
+import G_ConsoleCompleteArgument
+import G_ConsoleCommand
+import G_PredictPlayerMove
+import G_UnTimeShiftClient
+import G_UndoTimeShiftFor
+import G_DoTimeShiftFor
+import G_UnTimeShiftAllClients
+import G_TimeShiftAllClients
+import G_StoreHistory
+import G_ResetHistory
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import PlayerSpawn
+import InitBodyQue
+import BeginIntermission
+import PlayerRespawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetPlayerViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import CalcMuzzlePoint
+import LogAccuracyHit
+import DropPortalDestination
+import DropPortalSource
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_prox
+import fire_nail
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import G_RunMissile
+import TossPlayerCubes
+import TossPlayerPersistantPowerups
+import TossPlayerGametypeItems
+import TossPlayerItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_SetBrushModel
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import trap_SendServerCommand
+import G_SoundIndex
+import G_ModelIndex
+import G_FindConfigstringIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import FinishSpawningItem
+import G_SpawnItem
+import LaunchItem
+import Drop_Item
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import G_Say
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $868
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $865
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 46
+byte 1 99
+byte 1 0
+align 1
+LABELV $851
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $848
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $618
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 10
+byte 1 0
+align 1
+LABELV $612
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $388
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $375
+byte 1 0
+align 1
+LABELV $365
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $362
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $355
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 41
+byte 1 10
+byte 1 0
+align 1
+LABELV $350
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 0
+align 1
+LABELV $346
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $341
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $338
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $335
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $332
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 0
+align 1
+LABELV $327
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 13
+byte 1 10
+byte 1 0
+align 1
+LABELV $318
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $307
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $300
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $285
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $284
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $272
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $271
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $270
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $269
+byte 1 119
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $268
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $267
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $264
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $261
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $260
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $257
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $132
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $118
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 13
+byte 1 10
+byte 1 0
+align 1
+LABELV $109
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $108
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $104
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $98
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $95
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $88
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $85
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $74
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $69
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 115
+byte 1 0
+align 1
+LABELV $68
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $67
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $66
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $65
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $64
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $63
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $62
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
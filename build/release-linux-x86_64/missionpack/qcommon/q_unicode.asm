@@ -0,0 +1,9013 @@
+export Q_UTF8_Width
+code
+proc Q_UTF8_Width 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $24
+CNSTI4 0
+RETI4
+ADDRGP4 $23
+JUMPV
+LABELV $24
+ADDRLP4 0
+INDIRP4
+INDIRU1
+CVUI4 1
+CNSTI4 127
+GTI4 $26
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $37
+JUMPV
+LABELV $26
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRU1
+CVUI4 1
+ASGNI4
+CNSTI4 194
+ADDRLP4 8
+INDIRI4
+GTI4 $28
+ADDRLP4 8
+INDIRI4
+CNSTI4 223
+GTI4 $28
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $37
+JUMPV
+LABELV $28
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+INDIRU1
+CVUI4 1
+ASGNI4
+CNSTI4 224
+ADDRLP4 12
+INDIRI4
+GTI4 $30
+ADDRLP4 12
+INDIRI4
+CNSTI4 239
+GTI4 $30
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $37
+JUMPV
+LABELV $30
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRU1
+CVUI4 1
+ASGNI4
+CNSTI4 240
+ADDRLP4 16
+INDIRI4
+GTI4 $32
+ADDRLP4 16
+INDIRI4
+CNSTI4 244
+GTI4 $32
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $37
+JUMPV
+LABELV $32
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $37
+JUMPV
+LABELV $34
+LABELV $35
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $37
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRU1
+CVUI4 1
+ADDRLP4 24
+INDIRI4
+EQI4 $38
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $34
+LABELV $38
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+RETI4
+LABELV $23
+endproc Q_UTF8_Width 28 0
+export Q_UTF8_WidthCP
+proc Q_UTF8_WidthCP 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 127
+GTI4 $40
+CNSTI4 1
+RETI4
+ADDRGP4 $39
+JUMPV
+LABELV $40
+ADDRFP4 0
+INDIRI4
+CNSTI4 2047
+GTI4 $42
+CNSTI4 2
+RETI4
+ADDRGP4 $39
+JUMPV
+LABELV $42
+ADDRFP4 0
+INDIRI4
+CNSTI4 65535
+GTI4 $44
+CNSTI4 3
+RETI4
+ADDRGP4 $39
+JUMPV
+LABELV $44
+ADDRFP4 0
+INDIRI4
+CNSTI4 1114111
+GTI4 $46
+CNSTI4 4
+RETI4
+ADDRGP4 $39
+JUMPV
+LABELV $46
+CNSTI4 0
+RETI4
+LABELV $39
+endproc Q_UTF8_WidthCP 0 0
+export Q_UTF8_Strlen
+proc Q_UTF8_Strlen 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $50
+JUMPV
+LABELV $49
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_UTF8_Width
+CALLI4
+ASGNI4
+ADDRFP4 0
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $50
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $49
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $48
+endproc Q_UTF8_Strlen 8 4
+export Q_UTF8_PrintStrlen
+proc Q_UTF8_PrintStrlen 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $54
+JUMPV
+LABELV $53
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $56
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $56
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $56
+ADDRLP4 8
+INDIRI4
+CNSTI4 48
+LTI4 $56
+ADDRLP4 8
+INDIRI4
+CNSTI4 55
+GTI4 $56
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $54
+JUMPV
+LABELV $56
+ADDRLP4 16
+CNSTI4 94
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 16
+INDIRI4
+NEI4 $58
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 16
+INDIRI4
+NEI4 $58
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $58
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_UTF8_Width
+CALLI4
+ASGNI4
+ADDRFP4 0
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $54
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $53
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $52
+endproc Q_UTF8_PrintStrlen 24 4
+export Q_UTF8_ContByte
+proc Q_UTF8_ContByte 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 4
+ADDRFP4 0
+INDIRI1
+CVII4 1
+CVIU4 4
+CVUU1 4
+CVUI4 1
+ASGNI4
+CNSTI4 128
+ADDRLP4 4
+INDIRI4
+GTI4 $62
+ADDRLP4 4
+INDIRI4
+CNSTI4 191
+GTI4 $62
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $63
+JUMPV
+LABELV $62
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $63
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $60
+endproc Q_UTF8_ContByte 8 0
+export Q_UTF8_CodePoint
+proc Q_UTF8_CodePoint 36 0
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 128
+BANDI4
+CNSTI4 0
+NEI4 $65
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CVIU4 4
+ASGNU4
+ADDRGP4 $66
+JUMPV
+LABELV $65
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 224
+BANDI4
+CNSTI4 192
+NEI4 $67
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRU4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 31
+BANDI4
+CNSTI4 6
+LSHI4
+CVIU4 4
+BORU4
+ASGNU4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRU4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 63
+BANDI4
+CVIU4 4
+BORU4
+ASGNU4
+ADDRGP4 $68
+JUMPV
+LABELV $67
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 240
+BANDI4
+CNSTI4 224
+NEI4 $69
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRU4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 15
+BANDI4
+CNSTI4 12
+LSHI4
+CVIU4 4
+BORU4
+ASGNU4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 63
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRU4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 28
+INDIRI4
+BANDI4
+CNSTI4 6
+LSHI4
+CVIU4 4
+BORU4
+ASGNU4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRU4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 28
+INDIRI4
+BANDI4
+CVIU4 4
+BORU4
+ASGNU4
+ADDRGP4 $70
+JUMPV
+LABELV $69
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 248
+BANDI4
+CNSTI4 240
+NEI4 $71
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRU4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 7
+BANDI4
+CNSTI4 18
+LSHI4
+CVIU4 4
+BORU4
+ASGNU4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 63
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRU4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 32
+INDIRI4
+BANDI4
+CNSTI4 12
+LSHI4
+CVIU4 4
+BORU4
+ASGNU4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRU4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 32
+INDIRI4
+BANDI4
+CNSTI4 6
+LSHI4
+CVIU4 4
+BORU4
+ASGNU4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRU4
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 32
+INDIRI4
+BANDI4
+CVIU4 4
+BORU4
+ASGNU4
+ADDRGP4 $72
+JUMPV
+LABELV $71
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $72
+LABELV $70
+LABELV $68
+LABELV $66
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRU4
+RETU4
+LABELV $64
+endproc Q_UTF8_CodePoint 36 0
+bss
+align 1
+LABELV $74
+skip 10
+data
+align 4
+LABELV $75
+byte 4 0
+export Q_UTF8_Encode
+code
+proc Q_UTF8_Encode 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRU4
+ASGNU4
+ADDRLP4 8
+ADDRGP4 $75
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 5
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+BANDI4
+MULI4
+ADDRGP4 $74
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRU4
+CNSTU4 127
+GTU4 $76
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRU4
+CVUI4 4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $77
+JUMPV
+LABELV $76
+CNSTU4 128
+ADDRFP4 0
+INDIRU4
+GTU4 $78
+ADDRFP4 0
+INDIRU4
+CNSTU4 2047
+GTU4 $78
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRU4
+CNSTU4 1984
+BANDU4
+CNSTI4 6
+RSHU4
+CNSTU4 192
+BORU4
+CVUI4 4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ADDRFP4 0
+INDIRU4
+CNSTU4 63
+BANDU4
+CNSTU4 128
+BORU4
+CVUI4 4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $79
+JUMPV
+LABELV $78
+CNSTU4 2048
+ADDRFP4 0
+INDIRU4
+GTU4 $80
+ADDRFP4 0
+INDIRU4
+CNSTU4 65535
+GTU4 $80
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRU4
+CNSTU4 61440
+BANDU4
+CNSTI4 12
+RSHU4
+CNSTU4 224
+BORU4
+CVUI4 4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ADDRFP4 0
+INDIRU4
+CNSTU4 4032
+BANDU4
+CNSTI4 6
+RSHU4
+CNSTU4 128
+BORU4
+CVUI4 4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ADDRFP4 0
+INDIRU4
+CNSTU4 63
+BANDU4
+CNSTU4 128
+BORU4
+CVUI4 4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $81
+JUMPV
+LABELV $80
+CNSTU4 65536
+ADDRFP4 0
+INDIRU4
+GTU4 $82
+ADDRFP4 0
+INDIRU4
+CNSTU4 1114111
+GTU4 $82
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRU4
+CNSTU4 1835008
+BANDU4
+CNSTI4 18
+RSHU4
+CNSTU4 240
+BORU4
+CVUI4 4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ADDRFP4 0
+INDIRU4
+CNSTU4 258048
+BANDU4
+CNSTI4 12
+RSHU4
+CNSTU4 128
+BORU4
+CVUI4 4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ADDRFP4 0
+INDIRU4
+CNSTU4 4032
+BANDU4
+CNSTI4 6
+RSHU4
+CNSTU4 128
+BORU4
+CVUI4 4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ADDRFP4 0
+INDIRU4
+CNSTU4 63
+BANDU4
+CNSTU4 128
+BORU4
+CVUI4 4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $83
+JUMPV
+LABELV $82
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $83
+LABELV $81
+LABELV $79
+LABELV $77
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $73
+endproc Q_UTF8_Encode 28 0
+export Q_UTF8_Store
+proc Q_UTF8_Store 12 0
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $85
+CNSTI4 0
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $85
+ADDRLP4 0
+INDIRP4
+INDIRU1
+CVUI4 1
+CNSTI4 128
+BANDI4
+CNSTI4 0
+NEI4 $87
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRU1
+CVUI4 1
+ASGNI4
+ADDRGP4 $88
+JUMPV
+LABELV $87
+ADDRLP4 0
+INDIRP4
+INDIRU1
+CVUI4 1
+CNSTI4 224
+BANDI4
+CNSTI4 192
+NEI4 $89
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRU1
+CVUI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+CVUI4 1
+CVIU4 4
+CNSTI4 8
+LSHU4
+BORU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $90
+JUMPV
+LABELV $89
+ADDRLP4 0
+INDIRP4
+INDIRU1
+CVUI4 1
+CNSTI4 240
+BANDI4
+CNSTI4 224
+NEI4 $91
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRU1
+CVUI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+CVUI4 1
+CVIU4 4
+CNSTI4 8
+LSHU4
+BORU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+CVUI4 1
+CVIU4 4
+CNSTI4 16
+LSHU4
+BORU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $92
+JUMPV
+LABELV $91
+ADDRLP4 0
+INDIRP4
+INDIRU1
+CVUI4 1
+CNSTI4 248
+BANDI4
+CNSTI4 240
+NEI4 $93
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRU1
+CVUI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+CVUI4 1
+CVIU4 4
+CNSTI4 8
+LSHU4
+BORU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+CVUI4 1
+CVIU4 4
+CNSTI4 16
+LSHU4
+BORU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+CVUI4 1
+CVIU4 4
+CNSTI4 24
+LSHU4
+BORU4
+CVUI4 4
+ASGNI4
+LABELV $93
+LABELV $92
+LABELV $90
+LABELV $88
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $84
+endproc Q_UTF8_Store 12 0
+bss
+align 1
+LABELV $96
+skip 10
+data
+align 4
+LABELV $97
+byte 4 0
+export Q_UTF8_Unstore
+code
+proc Q_UTF8_Unstore 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 $97
+ASGNP4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 5
+ADDRLP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 $96
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 255
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+RSHI4
+CNSTI4 255
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+RSHI4
+CNSTI4 255
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 3
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 24
+RSHI4
+CNSTI4 255
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $95
+endproc Q_UTF8_Unstore 12 0
+lit
+align 4
+LABELV uc_prop_uppercase
+byte 4 65
+byte 4 91
+byte 4 192
+byte 4 215
+byte 4 216
+byte 4 223
+byte 4 256
+byte 4 257
+byte 4 258
+byte 4 259
+byte 4 260
+byte 4 261
+byte 4 262
+byte 4 263
+byte 4 264
+byte 4 265
+byte 4 266
+byte 4 267
+byte 4 268
+byte 4 269
+byte 4 270
+byte 4 271
+byte 4 272
+byte 4 273
+byte 4 274
+byte 4 275
+byte 4 276
+byte 4 277
+byte 4 278
+byte 4 279
+byte 4 280
+byte 4 281
+byte 4 282
+byte 4 283
+byte 4 284
+byte 4 285
+byte 4 286
+byte 4 287
+byte 4 288
+byte 4 289
+byte 4 290
+byte 4 291
+byte 4 292
+byte 4 293
+byte 4 294
+byte 4 295
+byte 4 296
+byte 4 297
+byte 4 298
+byte 4 299
+byte 4 300
+byte 4 301
+byte 4 302
+byte 4 303
+byte 4 304
+byte 4 305
+byte 4 306
+byte 4 307
+byte 4 308
+byte 4 309
+byte 4 310
+byte 4 311
+byte 4 313
+byte 4 314
+byte 4 315
+byte 4 316
+byte 4 317
+byte 4 318
+byte 4 319
+byte 4 320
+byte 4 321
+byte 4 322
+byte 4 323
+byte 4 324
+byte 4 325
+byte 4 326
+byte 4 327
+byte 4 328
+byte 4 330
+byte 4 331
+byte 4 332
+byte 4 333
+byte 4 334
+byte 4 335
+byte 4 336
+byte 4 337
+byte 4 338
+byte 4 339
+byte 4 340
+byte 4 341
+byte 4 342
+byte 4 343
+byte 4 344
+byte 4 345
+byte 4 346
+byte 4 347
+byte 4 348
+byte 4 349
+byte 4 350
+byte 4 351
+byte 4 352
+byte 4 353
+byte 4 354
+byte 4 355
+byte 4 356
+byte 4 357
+byte 4 358
+byte 4 359
+byte 4 360
+byte 4 361
+byte 4 362
+byte 4 363
+byte 4 364
+byte 4 365
+byte 4 366
+byte 4 367
+byte 4 368
+byte 4 369
+byte 4 370
+byte 4 371
+byte 4 372
+byte 4 373
+byte 4 374
+byte 4 375
+byte 4 376
+byte 4 378
+byte 4 379
+byte 4 380
+byte 4 381
+byte 4 382
+byte 4 385
+byte 4 387
+byte 4 388
+byte 4 389
+byte 4 390
+byte 4 392
+byte 4 393
+byte 4 396
+byte 4 398
+byte 4 402
+byte 4 403
+byte 4 405
+byte 4 406
+byte 4 409
+byte 4 412
+byte 4 414
+byte 4 415
+byte 4 417
+byte 4 418
+byte 4 419
+byte 4 420
+byte 4 421
+byte 4 422
+byte 4 424
+byte 4 425
+byte 4 426
+byte 4 428
+byte 4 429
+byte 4 430
+byte 4 432
+byte 4 433
+byte 4 436
+byte 4 437
+byte 4 438
+byte 4 439
+byte 4 441
+byte 4 444
+byte 4 445
+byte 4 452
+byte 4 453
+byte 4 455
+byte 4 456
+byte 4 458
+byte 4 459
+byte 4 461
+byte 4 462
+byte 4 463
+byte 4 464
+byte 4 465
+byte 4 466
+byte 4 467
+byte 4 468
+byte 4 469
+byte 4 470
+byte 4 471
+byte 4 472
+byte 4 473
+byte 4 474
+byte 4 475
+byte 4 476
+byte 4 478
+byte 4 479
+byte 4 480
+byte 4 481
+byte 4 482
+byte 4 483
+byte 4 484
+byte 4 485
+byte 4 486
+byte 4 487
+byte 4 488
+byte 4 489
+byte 4 490
+byte 4 491
+byte 4 492
+byte 4 493
+byte 4 494
+byte 4 495
+byte 4 497
+byte 4 498
+byte 4 500
+byte 4 501
+byte 4 502
+byte 4 505
+byte 4 506
+byte 4 507
+byte 4 508
+byte 4 509
+byte 4 510
+byte 4 511
+byte 4 512
+byte 4 513
+byte 4 514
+byte 4 515
+byte 4 516
+byte 4 517
+byte 4 518
+byte 4 519
+byte 4 520
+byte 4 521
+byte 4 522
+byte 4 523
+byte 4 524
+byte 4 525
+byte 4 526
+byte 4 527
+byte 4 528
+byte 4 529
+byte 4 530
+byte 4 531
+byte 4 532
+byte 4 533
+byte 4 534
+byte 4 535
+byte 4 536
+byte 4 537
+byte 4 538
+byte 4 539
+byte 4 540
+byte 4 541
+byte 4 542
+byte 4 543
+byte 4 544
+byte 4 545
+byte 4 546
+byte 4 547
+byte 4 548
+byte 4 549
+byte 4 550
+byte 4 551
+byte 4 552
+byte 4 553
+byte 4 554
+byte 4 555
+byte 4 556
+byte 4 557
+byte 4 558
+byte 4 559
+byte 4 560
+byte 4 561
+byte 4 562
+byte 4 563
+byte 4 570
+byte 4 572
+byte 4 573
+byte 4 575
+byte 4 577
+byte 4 578
+byte 4 579
+byte 4 583
+byte 4 584
+byte 4 585
+byte 4 586
+byte 4 587
+byte 4 588
+byte 4 589
+byte 4 590
+byte 4 591
+byte 4 880
+byte 4 881
+byte 4 882
+byte 4 883
+byte 4 886
+byte 4 887
+byte 4 902
+byte 4 903
+byte 4 904
+byte 4 907
+byte 4 908
+byte 4 909
+byte 4 910
+byte 4 912
+byte 4 913
+byte 4 930
+byte 4 931
+byte 4 940
+byte 4 975
+byte 4 976
+byte 4 978
+byte 4 981
+byte 4 984
+byte 4 985
+byte 4 986
+byte 4 987
+byte 4 988
+byte 4 989
+byte 4 990
+byte 4 991
+byte 4 992
+byte 4 993
+byte 4 994
+byte 4 995
+byte 4 996
+byte 4 997
+byte 4 998
+byte 4 999
+byte 4 1000
+byte 4 1001
+byte 4 1002
+byte 4 1003
+byte 4 1004
+byte 4 1005
+byte 4 1006
+byte 4 1007
+byte 4 1012
+byte 4 1013
+byte 4 1015
+byte 4 1016
+byte 4 1017
+byte 4 1019
+byte 4 1021
+byte 4 1072
+byte 4 1120
+byte 4 1121
+byte 4 1122
+byte 4 1123
+byte 4 1124
+byte 4 1125
+byte 4 1126
+byte 4 1127
+byte 4 1128
+byte 4 1129
+byte 4 1130
+byte 4 1131
+byte 4 1132
+byte 4 1133
+byte 4 1134
+byte 4 1135
+byte 4 1136
+byte 4 1137
+byte 4 1138
+byte 4 1139
+byte 4 1140
+byte 4 1141
+byte 4 1142
+byte 4 1143
+byte 4 1144
+byte 4 1145
+byte 4 1146
+byte 4 1147
+byte 4 1148
+byte 4 1149
+byte 4 1150
+byte 4 1151
+byte 4 1152
+byte 4 1153
+byte 4 1162
+byte 4 1163
+byte 4 1164
+byte 4 1165
+byte 4 1166
+byte 4 1167
+byte 4 1168
+byte 4 1169
+byte 4 1170
+byte 4 1171
+byte 4 1172
+byte 4 1173
+byte 4 1174
+byte 4 1175
+byte 4 1176
+byte 4 1177
+byte 4 1178
+byte 4 1179
+byte 4 1180
+byte 4 1181
+byte 4 1182
+byte 4 1183
+byte 4 1184
+byte 4 1185
+byte 4 1186
+byte 4 1187
+byte 4 1188
+byte 4 1189
+byte 4 1190
+byte 4 1191
+byte 4 1192
+byte 4 1193
+byte 4 1194
+byte 4 1195
+byte 4 1196
+byte 4 1197
+byte 4 1198
+byte 4 1199
+byte 4 1200
+byte 4 1201
+byte 4 1202
+byte 4 1203
+byte 4 1204
+byte 4 1205
+byte 4 1206
+byte 4 1207
+byte 4 1208
+byte 4 1209
+byte 4 1210
+byte 4 1211
+byte 4 1212
+byte 4 1213
+byte 4 1214
+byte 4 1215
+byte 4 1216
+byte 4 1218
+byte 4 1219
+byte 4 1220
+byte 4 1221
+byte 4 1222
+byte 4 1223
+byte 4 1224
+byte 4 1225
+byte 4 1226
+byte 4 1227
+byte 4 1228
+byte 4 1229
+byte 4 1230
+byte 4 1232
+byte 4 1233
+byte 4 1234
+byte 4 1235
+byte 4 1236
+byte 4 1237
+byte 4 1238
+byte 4 1239
+byte 4 1240
+byte 4 1241
+byte 4 1242
+byte 4 1243
+byte 4 1244
+byte 4 1245
+byte 4 1246
+byte 4 1247
+byte 4 1248
+byte 4 1249
+byte 4 1250
+byte 4 1251
+byte 4 1252
+byte 4 1253
+byte 4 1254
+byte 4 1255
+byte 4 1256
+byte 4 1257
+byte 4 1258
+byte 4 1259
+byte 4 1260
+byte 4 1261
+byte 4 1262
+byte 4 1263
+byte 4 1264
+byte 4 1265
+byte 4 1266
+byte 4 1267
+byte 4 1268
+byte 4 1269
+byte 4 1270
+byte 4 1271
+byte 4 1272
+byte 4 1273
+byte 4 1274
+byte 4 1275
+byte 4 1276
+byte 4 1277
+byte 4 1278
+byte 4 1279
+byte 4 1280
+byte 4 1281
+byte 4 1282
+byte 4 1283
+byte 4 1284
+byte 4 1285
+byte 4 1286
+byte 4 1287
+byte 4 1288
+byte 4 1289
+byte 4 1290
+byte 4 1291
+byte 4 1292
+byte 4 1293
+byte 4 1294
+byte 4 1295
+byte 4 1296
+byte 4 1297
+byte 4 1298
+byte 4 1299
+byte 4 1300
+byte 4 1301
+byte 4 1302
+byte 4 1303
+byte 4 1304
+byte 4 1305
+byte 4 1306
+byte 4 1307
+byte 4 1308
+byte 4 1309
+byte 4 1310
+byte 4 1311
+byte 4 1312
+byte 4 1313
+byte 4 1314
+byte 4 1315
+byte 4 1329
+byte 4 1367
+byte 4 4256
+byte 4 4294
+byte 4 7680
+byte 4 7681
+byte 4 7682
+byte 4 7683
+byte 4 7684
+byte 4 7685
+byte 4 7686
+byte 4 7687
+byte 4 7688
+byte 4 7689
+byte 4 7690
+byte 4 7691
+byte 4 7692
+byte 4 7693
+byte 4 7694
+byte 4 7695
+byte 4 7696
+byte 4 7697
+byte 4 7698
+byte 4 7699
+byte 4 7700
+byte 4 7701
+byte 4 7702
+byte 4 7703
+byte 4 7704
+byte 4 7705
+byte 4 7706
+byte 4 7707
+byte 4 7708
+byte 4 7709
+byte 4 7710
+byte 4 7711
+byte 4 7712
+byte 4 7713
+byte 4 7714
+byte 4 7715
+byte 4 7716
+byte 4 7717
+byte 4 7718
+byte 4 7719
+byte 4 7720
+byte 4 7721
+byte 4 7722
+byte 4 7723
+byte 4 7724
+byte 4 7725
+byte 4 7726
+byte 4 7727
+byte 4 7728
+byte 4 7729
+byte 4 7730
+byte 4 7731
+byte 4 7732
+byte 4 7733
+byte 4 7734
+byte 4 7735
+byte 4 7736
+byte 4 7737
+byte 4 7738
+byte 4 7739
+byte 4 7740
+byte 4 7741
+byte 4 7742
+byte 4 7743
+byte 4 7744
+byte 4 7745
+byte 4 7746
+byte 4 7747
+byte 4 7748
+byte 4 7749
+byte 4 7750
+byte 4 7751
+byte 4 7752
+byte 4 7753
+byte 4 7754
+byte 4 7755
+byte 4 7756
+byte 4 7757
+byte 4 7758
+byte 4 7759
+byte 4 7760
+byte 4 7761
+byte 4 7762
+byte 4 7763
+byte 4 7764
+byte 4 7765
+byte 4 7766
+byte 4 7767
+byte 4 7768
+byte 4 7769
+byte 4 7770
+byte 4 7771
+byte 4 7772
+byte 4 7773
+byte 4 7774
+byte 4 7775
+byte 4 7776
+byte 4 7777
+byte 4 7778
+byte 4 7779
+byte 4 7780
+byte 4 7781
+byte 4 7782
+byte 4 7783
+byte 4 7784
+byte 4 7785
+byte 4 7786
+byte 4 7787
+byte 4 7788
+byte 4 7789
+byte 4 7790
+byte 4 7791
+byte 4 7792
+byte 4 7793
+byte 4 7794
+byte 4 7795
+byte 4 7796
+byte 4 7797
+byte 4 7798
+byte 4 7799
+byte 4 7800
+byte 4 7801
+byte 4 7802
+byte 4 7803
+byte 4 7804
+byte 4 7805
+byte 4 7806
+byte 4 7807
+byte 4 7808
+byte 4 7809
+byte 4 7810
+byte 4 7811
+byte 4 7812
+byte 4 7813
+byte 4 7814
+byte 4 7815
+byte 4 7816
+byte 4 7817
+byte 4 7818
+byte 4 7819
+byte 4 7820
+byte 4 7821
+byte 4 7822
+byte 4 7823
+byte 4 7824
+byte 4 7825
+byte 4 7826
+byte 4 7827
+byte 4 7828
+byte 4 7829
+byte 4 7838
+byte 4 7839
+byte 4 7840
+byte 4 7841
+byte 4 7842
+byte 4 7843
+byte 4 7844
+byte 4 7845
+byte 4 7846
+byte 4 7847
+byte 4 7848
+byte 4 7849
+byte 4 7850
+byte 4 7851
+byte 4 7852
+byte 4 7853
+byte 4 7854
+byte 4 7855
+byte 4 7856
+byte 4 7857
+byte 4 7858
+byte 4 7859
+byte 4 7860
+byte 4 7861
+byte 4 7862
+byte 4 7863
+byte 4 7864
+byte 4 7865
+byte 4 7866
+byte 4 7867
+byte 4 7868
+byte 4 7869
+byte 4 7870
+byte 4 7871
+byte 4 7872
+byte 4 7873
+byte 4 7874
+byte 4 7875
+byte 4 7876
+byte 4 7877
+byte 4 7878
+byte 4 7879
+byte 4 7880
+byte 4 7881
+byte 4 7882
+byte 4 7883
+byte 4 7884
+byte 4 7885
+byte 4 7886
+byte 4 7887
+byte 4 7888
+byte 4 7889
+byte 4 7890
+byte 4 7891
+byte 4 7892
+byte 4 7893
+byte 4 7894
+byte 4 7895
+byte 4 7896
+byte 4 7897
+byte 4 7898
+byte 4 7899
+byte 4 7900
+byte 4 7901
+byte 4 7902
+byte 4 7903
+byte 4 7904
+byte 4 7905
+byte 4 7906
+byte 4 7907
+byte 4 7908
+byte 4 7909
+byte 4 7910
+byte 4 7911
+byte 4 7912
+byte 4 7913
+byte 4 7914
+byte 4 7915
+byte 4 7916
+byte 4 7917
+byte 4 7918
+byte 4 7919
+byte 4 7920
+byte 4 7921
+byte 4 7922
+byte 4 7923
+byte 4 7924
+byte 4 7925
+byte 4 7926
+byte 4 7927
+byte 4 7928
+byte 4 7929
+byte 4 7930
+byte 4 7931
+byte 4 7932
+byte 4 7933
+byte 4 7934
+byte 4 7935
+byte 4 7944
+byte 4 7952
+byte 4 7960
+byte 4 7966
+byte 4 7976
+byte 4 7984
+byte 4 7992
+byte 4 8000
+byte 4 8008
+byte 4 8014
+byte 4 8025
+byte 4 8026
+byte 4 8027
+byte 4 8028
+byte 4 8029
+byte 4 8030
+byte 4 8031
+byte 4 8032
+byte 4 8040
+byte 4 8048
+byte 4 8120
+byte 4 8124
+byte 4 8136
+byte 4 8140
+byte 4 8152
+byte 4 8156
+byte 4 8168
+byte 4 8173
+byte 4 8184
+byte 4 8188
+byte 4 8450
+byte 4 8451
+byte 4 8455
+byte 4 8456
+byte 4 8459
+byte 4 8462
+byte 4 8464
+byte 4 8467
+byte 4 8469
+byte 4 8470
+byte 4 8473
+byte 4 8478
+byte 4 8484
+byte 4 8485
+byte 4 8486
+byte 4 8487
+byte 4 8488
+byte 4 8489
+byte 4 8490
+byte 4 8494
+byte 4 8496
+byte 4 8500
+byte 4 8510
+byte 4 8512
+byte 4 8517
+byte 4 8518
+byte 4 8544
+byte 4 8560
+byte 4 8579
+byte 4 8580
+byte 4 9398
+byte 4 9424
+byte 4 11264
+byte 4 11311
+byte 4 11360
+byte 4 11361
+byte 4 11362
+byte 4 11365
+byte 4 11367
+byte 4 11368
+byte 4 11369
+byte 4 11370
+byte 4 11371
+byte 4 11372
+byte 4 11373
+byte 4 11376
+byte 4 11378
+byte 4 11379
+byte 4 11381
+byte 4 11382
+byte 4 11392
+byte 4 11393
+byte 4 11394
+byte 4 11395
+byte 4 11396
+byte 4 11397
+byte 4 11398
+byte 4 11399
+byte 4 11400
+byte 4 11401
+byte 4 11402
+byte 4 11403
+byte 4 11404
+byte 4 11405
+byte 4 11406
+byte 4 11407
+byte 4 11408
+byte 4 11409
+byte 4 11410
+byte 4 11411
+byte 4 11412
+byte 4 11413
+byte 4 11414
+byte 4 11415
+byte 4 11416
+byte 4 11417
+byte 4 11418
+byte 4 11419
+byte 4 11420
+byte 4 11421
+byte 4 11422
+byte 4 11423
+byte 4 11424
+byte 4 11425
+byte 4 11426
+byte 4 11427
+byte 4 11428
+byte 4 11429
+byte 4 11430
+byte 4 11431
+byte 4 11432
+byte 4 11433
+byte 4 11434
+byte 4 11435
+byte 4 11436
+byte 4 11437
+byte 4 11438
+byte 4 11439
+byte 4 11440
+byte 4 11441
+byte 4 11442
+byte 4 11443
+byte 4 11444
+byte 4 11445
+byte 4 11446
+byte 4 11447
+byte 4 11448
+byte 4 11449
+byte 4 11450
+byte 4 11451
+byte 4 11452
+byte 4 11453
+byte 4 11454
+byte 4 11455
+byte 4 11456
+byte 4 11457
+byte 4 11458
+byte 4 11459
+byte 4 11460
+byte 4 11461
+byte 4 11462
+byte 4 11463
+byte 4 11464
+byte 4 11465
+byte 4 11466
+byte 4 11467
+byte 4 11468
+byte 4 11469
+byte 4 11470
+byte 4 11471
+byte 4 11472
+byte 4 11473
+byte 4 11474
+byte 4 11475
+byte 4 11476
+byte 4 11477
+byte 4 11478
+byte 4 11479
+byte 4 11480
+byte 4 11481
+byte 4 11482
+byte 4 11483
+byte 4 11484
+byte 4 11485
+byte 4 11486
+byte 4 11487
+byte 4 11488
+byte 4 11489
+byte 4 11490
+byte 4 11491
+byte 4 42560
+byte 4 42561
+byte 4 42562
+byte 4 42563
+byte 4 42564
+byte 4 42565
+byte 4 42566
+byte 4 42567
+byte 4 42568
+byte 4 42569
+byte 4 42570
+byte 4 42571
+byte 4 42572
+byte 4 42573
+byte 4 42574
+byte 4 42575
+byte 4 42576
+byte 4 42577
+byte 4 42578
+byte 4 42579
+byte 4 42580
+byte 4 42581
+byte 4 42582
+byte 4 42583
+byte 4 42584
+byte 4 42585
+byte 4 42586
+byte 4 42587
+byte 4 42588
+byte 4 42589
+byte 4 42590
+byte 4 42591
+byte 4 42594
+byte 4 42595
+byte 4 42596
+byte 4 42597
+byte 4 42598
+byte 4 42599
+byte 4 42600
+byte 4 42601
+byte 4 42602
+byte 4 42603
+byte 4 42604
+byte 4 42605
+byte 4 42624
+byte 4 42625
+byte 4 42626
+byte 4 42627
+byte 4 42628
+byte 4 42629
+byte 4 42630
+byte 4 42631
+byte 4 42632
+byte 4 42633
+byte 4 42634
+byte 4 42635
+byte 4 42636
+byte 4 42637
+byte 4 42638
+byte 4 42639
+byte 4 42640
+byte 4 42641
+byte 4 42642
+byte 4 42643
+byte 4 42644
+byte 4 42645
+byte 4 42646
+byte 4 42647
+byte 4 42786
+byte 4 42787
+byte 4 42788
+byte 4 42789
+byte 4 42790
+byte 4 42791
+byte 4 42792
+byte 4 42793
+byte 4 42794
+byte 4 42795
+byte 4 42796
+byte 4 42797
+byte 4 42798
+byte 4 42799
+byte 4 42802
+byte 4 42803
+byte 4 42804
+byte 4 42805
+byte 4 42806
+byte 4 42807
+byte 4 42808
+byte 4 42809
+byte 4 42810
+byte 4 42811
+byte 4 42812
+byte 4 42813
+byte 4 42814
+byte 4 42815
+byte 4 42816
+byte 4 42817
+byte 4 42818
+byte 4 42819
+byte 4 42820
+byte 4 42821
+byte 4 42822
+byte 4 42823
+byte 4 42824
+byte 4 42825
+byte 4 42826
+byte 4 42827
+byte 4 42828
+byte 4 42829
+byte 4 42830
+byte 4 42831
+byte 4 42832
+byte 4 42833
+byte 4 42834
+byte 4 42835
+byte 4 42836
+byte 4 42837
+byte 4 42838
+byte 4 42839
+byte 4 42840
+byte 4 42841
+byte 4 42842
+byte 4 42843
+byte 4 42844
+byte 4 42845
+byte 4 42846
+byte 4 42847
+byte 4 42848
+byte 4 42849
+byte 4 42850
+byte 4 42851
+byte 4 42852
+byte 4 42853
+byte 4 42854
+byte 4 42855
+byte 4 42856
+byte 4 42857
+byte 4 42858
+byte 4 42859
+byte 4 42860
+byte 4 42861
+byte 4 42862
+byte 4 42863
+byte 4 42873
+byte 4 42874
+byte 4 42875
+byte 4 42876
+byte 4 42877
+byte 4 42879
+byte 4 42880
+byte 4 42881
+byte 4 42882
+byte 4 42883
+byte 4 42884
+byte 4 42885
+byte 4 42886
+byte 4 42887
+byte 4 42891
+byte 4 42892
+byte 4 65313
+byte 4 65339
+align 4
+LABELV uc_prop_lowercase
+byte 4 97
+byte 4 123
+byte 4 170
+byte 4 171
+byte 4 181
+byte 4 182
+byte 4 186
+byte 4 187
+byte 4 223
+byte 4 247
+byte 4 248
+byte 4 256
+byte 4 257
+byte 4 258
+byte 4 259
+byte 4 260
+byte 4 261
+byte 4 262
+byte 4 263
+byte 4 264
+byte 4 265
+byte 4 266
+byte 4 267
+byte 4 268
+byte 4 269
+byte 4 270
+byte 4 271
+byte 4 272
+byte 4 273
+byte 4 274
+byte 4 275
+byte 4 276
+byte 4 277
+byte 4 278
+byte 4 279
+byte 4 280
+byte 4 281
+byte 4 282
+byte 4 283
+byte 4 284
+byte 4 285
+byte 4 286
+byte 4 287
+byte 4 288
+byte 4 289
+byte 4 290
+byte 4 291
+byte 4 292
+byte 4 293
+byte 4 294
+byte 4 295
+byte 4 296
+byte 4 297
+byte 4 298
+byte 4 299
+byte 4 300
+byte 4 301
+byte 4 302
+byte 4 303
+byte 4 304
+byte 4 305
+byte 4 306
+byte 4 307
+byte 4 308
+byte 4 309
+byte 4 310
+byte 4 311
+byte 4 313
+byte 4 314
+byte 4 315
+byte 4 316
+byte 4 317
+byte 4 318
+byte 4 319
+byte 4 320
+byte 4 321
+byte 4 322
+byte 4 323
+byte 4 324
+byte 4 325
+byte 4 326
+byte 4 327
+byte 4 328
+byte 4 330
+byte 4 331
+byte 4 332
+byte 4 333
+byte 4 334
+byte 4 335
+byte 4 336
+byte 4 337
+byte 4 338
+byte 4 339
+byte 4 340
+byte 4 341
+byte 4 342
+byte 4 343
+byte 4 344
+byte 4 345
+byte 4 346
+byte 4 347
+byte 4 348
+byte 4 349
+byte 4 350
+byte 4 351
+byte 4 352
+byte 4 353
+byte 4 354
+byte 4 355
+byte 4 356
+byte 4 357
+byte 4 358
+byte 4 359
+byte 4 360
+byte 4 361
+byte 4 362
+byte 4 363
+byte 4 364
+byte 4 365
+byte 4 366
+byte 4 367
+byte 4 368
+byte 4 369
+byte 4 370
+byte 4 371
+byte 4 372
+byte 4 373
+byte 4 374
+byte 4 375
+byte 4 376
+byte 4 378
+byte 4 379
+byte 4 380
+byte 4 381
+byte 4 382
+byte 4 385
+byte 4 387
+byte 4 388
+byte 4 389
+byte 4 390
+byte 4 392
+byte 4 393
+byte 4 396
+byte 4 398
+byte 4 402
+byte 4 403
+byte 4 405
+byte 4 406
+byte 4 409
+byte 4 412
+byte 4 414
+byte 4 415
+byte 4 417
+byte 4 418
+byte 4 419
+byte 4 420
+byte 4 421
+byte 4 422
+byte 4 424
+byte 4 425
+byte 4 426
+byte 4 428
+byte 4 429
+byte 4 430
+byte 4 432
+byte 4 433
+byte 4 436
+byte 4 437
+byte 4 438
+byte 4 439
+byte 4 441
+byte 4 443
+byte 4 445
+byte 4 448
+byte 4 454
+byte 4 455
+byte 4 457
+byte 4 458
+byte 4 460
+byte 4 461
+byte 4 462
+byte 4 463
+byte 4 464
+byte 4 465
+byte 4 466
+byte 4 467
+byte 4 468
+byte 4 469
+byte 4 470
+byte 4 471
+byte 4 472
+byte 4 473
+byte 4 474
+byte 4 475
+byte 4 476
+byte 4 478
+byte 4 479
+byte 4 480
+byte 4 481
+byte 4 482
+byte 4 483
+byte 4 484
+byte 4 485
+byte 4 486
+byte 4 487
+byte 4 488
+byte 4 489
+byte 4 490
+byte 4 491
+byte 4 492
+byte 4 493
+byte 4 494
+byte 4 495
+byte 4 497
+byte 4 499
+byte 4 500
+byte 4 501
+byte 4 502
+byte 4 505
+byte 4 506
+byte 4 507
+byte 4 508
+byte 4 509
+byte 4 510
+byte 4 511
+byte 4 512
+byte 4 513
+byte 4 514
+byte 4 515
+byte 4 516
+byte 4 517
+byte 4 518
+byte 4 519
+byte 4 520
+byte 4 521
+byte 4 522
+byte 4 523
+byte 4 524
+byte 4 525
+byte 4 526
+byte 4 527
+byte 4 528
+byte 4 529
+byte 4 530
+byte 4 531
+byte 4 532
+byte 4 533
+byte 4 534
+byte 4 535
+byte 4 536
+byte 4 537
+byte 4 538
+byte 4 539
+byte 4 540
+byte 4 541
+byte 4 542
+byte 4 543
+byte 4 544
+byte 4 545
+byte 4 546
+byte 4 547
+byte 4 548
+byte 4 549
+byte 4 550
+byte 4 551
+byte 4 552
+byte 4 553
+byte 4 554
+byte 4 555
+byte 4 556
+byte 4 557
+byte 4 558
+byte 4 559
+byte 4 560
+byte 4 561
+byte 4 562
+byte 4 563
+byte 4 570
+byte 4 572
+byte 4 573
+byte 4 575
+byte 4 577
+byte 4 578
+byte 4 579
+byte 4 583
+byte 4 584
+byte 4 585
+byte 4 586
+byte 4 587
+byte 4 588
+byte 4 589
+byte 4 590
+byte 4 591
+byte 4 660
+byte 4 661
+byte 4 697
+byte 4 704
+byte 4 706
+byte 4 736
+byte 4 741
+byte 4 837
+byte 4 838
+byte 4 881
+byte 4 882
+byte 4 883
+byte 4 884
+byte 4 887
+byte 4 888
+byte 4 890
+byte 4 894
+byte 4 912
+byte 4 913
+byte 4 940
+byte 4 975
+byte 4 976
+byte 4 978
+byte 4 981
+byte 4 984
+byte 4 985
+byte 4 986
+byte 4 987
+byte 4 988
+byte 4 989
+byte 4 990
+byte 4 991
+byte 4 992
+byte 4 993
+byte 4 994
+byte 4 995
+byte 4 996
+byte 4 997
+byte 4 998
+byte 4 999
+byte 4 1000
+byte 4 1001
+byte 4 1002
+byte 4 1003
+byte 4 1004
+byte 4 1005
+byte 4 1006
+byte 4 1007
+byte 4 1012
+byte 4 1013
+byte 4 1014
+byte 4 1016
+byte 4 1017
+byte 4 1019
+byte 4 1021
+byte 4 1072
+byte 4 1120
+byte 4 1121
+byte 4 1122
+byte 4 1123
+byte 4 1124
+byte 4 1125
+byte 4 1126
+byte 4 1127
+byte 4 1128
+byte 4 1129
+byte 4 1130
+byte 4 1131
+byte 4 1132
+byte 4 1133
+byte 4 1134
+byte 4 1135
+byte 4 1136
+byte 4 1137
+byte 4 1138
+byte 4 1139
+byte 4 1140
+byte 4 1141
+byte 4 1142
+byte 4 1143
+byte 4 1144
+byte 4 1145
+byte 4 1146
+byte 4 1147
+byte 4 1148
+byte 4 1149
+byte 4 1150
+byte 4 1151
+byte 4 1152
+byte 4 1153
+byte 4 1154
+byte 4 1163
+byte 4 1164
+byte 4 1165
+byte 4 1166
+byte 4 1167
+byte 4 1168
+byte 4 1169
+byte 4 1170
+byte 4 1171
+byte 4 1172
+byte 4 1173
+byte 4 1174
+byte 4 1175
+byte 4 1176
+byte 4 1177
+byte 4 1178
+byte 4 1179
+byte 4 1180
+byte 4 1181
+byte 4 1182
+byte 4 1183
+byte 4 1184
+byte 4 1185
+byte 4 1186
+byte 4 1187
+byte 4 1188
+byte 4 1189
+byte 4 1190
+byte 4 1191
+byte 4 1192
+byte 4 1193
+byte 4 1194
+byte 4 1195
+byte 4 1196
+byte 4 1197
+byte 4 1198
+byte 4 1199
+byte 4 1200
+byte 4 1201
+byte 4 1202
+byte 4 1203
+byte 4 1204
+byte 4 1205
+byte 4 1206
+byte 4 1207
+byte 4 1208
+byte 4 1209
+byte 4 1210
+byte 4 1211
+byte 4 1212
+byte 4 1213
+byte 4 1214
+byte 4 1215
+byte 4 1216
+byte 4 1218
+byte 4 1219
+byte 4 1220
+byte 4 1221
+byte 4 1222
+byte 4 1223
+byte 4 1224
+byte 4 1225
+byte 4 1226
+byte 4 1227
+byte 4 1228
+byte 4 1229
+byte 4 1230
+byte 4 1232
+byte 4 1233
+byte 4 1234
+byte 4 1235
+byte 4 1236
+byte 4 1237
+byte 4 1238
+byte 4 1239
+byte 4 1240
+byte 4 1241
+byte 4 1242
+byte 4 1243
+byte 4 1244
+byte 4 1245
+byte 4 1246
+byte 4 1247
+byte 4 1248
+byte 4 1249
+byte 4 1250
+byte 4 1251
+byte 4 1252
+byte 4 1253
+byte 4 1254
+byte 4 1255
+byte 4 1256
+byte 4 1257
+byte 4 1258
+byte 4 1259
+byte 4 1260
+byte 4 1261
+byte 4 1262
+byte 4 1263
+byte 4 1264
+byte 4 1265
+byte 4 1266
+byte 4 1267
+byte 4 1268
+byte 4 1269
+byte 4 1270
+byte 4 1271
+byte 4 1272
+byte 4 1273
+byte 4 1274
+byte 4 1275
+byte 4 1276
+byte 4 1277
+byte 4 1278
+byte 4 1279
+byte 4 1280
+byte 4 1281
+byte 4 1282
+byte 4 1283
+byte 4 1284
+byte 4 1285
+byte 4 1286
+byte 4 1287
+byte 4 1288
+byte 4 1289
+byte 4 1290
+byte 4 1291
+byte 4 1292
+byte 4 1293
+byte 4 1294
+byte 4 1295
+byte 4 1296
+byte 4 1297
+byte 4 1298
+byte 4 1299
+byte 4 1300
+byte 4 1301
+byte 4 1302
+byte 4 1303
+byte 4 1304
+byte 4 1305
+byte 4 1306
+byte 4 1307
+byte 4 1308
+byte 4 1309
+byte 4 1310
+byte 4 1311
+byte 4 1312
+byte 4 1313
+byte 4 1314
+byte 4 1315
+byte 4 1316
+byte 4 1377
+byte 4 1416
+byte 4 7424
+byte 4 7616
+byte 4 7681
+byte 4 7682
+byte 4 7683
+byte 4 7684
+byte 4 7685
+byte 4 7686
+byte 4 7687
+byte 4 7688
+byte 4 7689
+byte 4 7690
+byte 4 7691
+byte 4 7692
+byte 4 7693
+byte 4 7694
+byte 4 7695
+byte 4 7696
+byte 4 7697
+byte 4 7698
+byte 4 7699
+byte 4 7700
+byte 4 7701
+byte 4 7702
+byte 4 7703
+byte 4 7704
+byte 4 7705
+byte 4 7706
+byte 4 7707
+byte 4 7708
+byte 4 7709
+byte 4 7710
+byte 4 7711
+byte 4 7712
+byte 4 7713
+byte 4 7714
+byte 4 7715
+byte 4 7716
+byte 4 7717
+byte 4 7718
+byte 4 7719
+byte 4 7720
+byte 4 7721
+byte 4 7722
+byte 4 7723
+byte 4 7724
+byte 4 7725
+byte 4 7726
+byte 4 7727
+byte 4 7728
+byte 4 7729
+byte 4 7730
+byte 4 7731
+byte 4 7732
+byte 4 7733
+byte 4 7734
+byte 4 7735
+byte 4 7736
+byte 4 7737
+byte 4 7738
+byte 4 7739
+byte 4 7740
+byte 4 7741
+byte 4 7742
+byte 4 7743
+byte 4 7744
+byte 4 7745
+byte 4 7746
+byte 4 7747
+byte 4 7748
+byte 4 7749
+byte 4 7750
+byte 4 7751
+byte 4 7752
+byte 4 7753
+byte 4 7754
+byte 4 7755
+byte 4 7756
+byte 4 7757
+byte 4 7758
+byte 4 7759
+byte 4 7760
+byte 4 7761
+byte 4 7762
+byte 4 7763
+byte 4 7764
+byte 4 7765
+byte 4 7766
+byte 4 7767
+byte 4 7768
+byte 4 7769
+byte 4 7770
+byte 4 7771
+byte 4 7772
+byte 4 7773
+byte 4 7774
+byte 4 7775
+byte 4 7776
+byte 4 7777
+byte 4 7778
+byte 4 7779
+byte 4 7780
+byte 4 7781
+byte 4 7782
+byte 4 7783
+byte 4 7784
+byte 4 7785
+byte 4 7786
+byte 4 7787
+byte 4 7788
+byte 4 7789
+byte 4 7790
+byte 4 7791
+byte 4 7792
+byte 4 7793
+byte 4 7794
+byte 4 7795
+byte 4 7796
+byte 4 7797
+byte 4 7798
+byte 4 7799
+byte 4 7800
+byte 4 7801
+byte 4 7802
+byte 4 7803
+byte 4 7804
+byte 4 7805
+byte 4 7806
+byte 4 7807
+byte 4 7808
+byte 4 7809
+byte 4 7810
+byte 4 7811
+byte 4 7812
+byte 4 7813
+byte 4 7814
+byte 4 7815
+byte 4 7816
+byte 4 7817
+byte 4 7818
+byte 4 7819
+byte 4 7820
+byte 4 7821
+byte 4 7822
+byte 4 7823
+byte 4 7824
+byte 4 7825
+byte 4 7826
+byte 4 7827
+byte 4 7828
+byte 4 7829
+byte 4 7838
+byte 4 7839
+byte 4 7840
+byte 4 7841
+byte 4 7842
+byte 4 7843
+byte 4 7844
+byte 4 7845
+byte 4 7846
+byte 4 7847
+byte 4 7848
+byte 4 7849
+byte 4 7850
+byte 4 7851
+byte 4 7852
+byte 4 7853
+byte 4 7854
+byte 4 7855
+byte 4 7856
+byte 4 7857
+byte 4 7858
+byte 4 7859
+byte 4 7860
+byte 4 7861
+byte 4 7862
+byte 4 7863
+byte 4 7864
+byte 4 7865
+byte 4 7866
+byte 4 7867
+byte 4 7868
+byte 4 7869
+byte 4 7870
+byte 4 7871
+byte 4 7872
+byte 4 7873
+byte 4 7874
+byte 4 7875
+byte 4 7876
+byte 4 7877
+byte 4 7878
+byte 4 7879
+byte 4 7880
+byte 4 7881
+byte 4 7882
+byte 4 7883
+byte 4 7884
+byte 4 7885
+byte 4 7886
+byte 4 7887
+byte 4 7888
+byte 4 7889
+byte 4 7890
+byte 4 7891
+byte 4 7892
+byte 4 7893
+byte 4 7894
+byte 4 7895
+byte 4 7896
+byte 4 7897
+byte 4 7898
+byte 4 7899
+byte 4 7900
+byte 4 7901
+byte 4 7902
+byte 4 7903
+byte 4 7904
+byte 4 7905
+byte 4 7906
+byte 4 7907
+byte 4 7908
+byte 4 7909
+byte 4 7910
+byte 4 7911
+byte 4 7912
+byte 4 7913
+byte 4 7914
+byte 4 7915
+byte 4 7916
+byte 4 7917
+byte 4 7918
+byte 4 7919
+byte 4 7920
+byte 4 7921
+byte 4 7922
+byte 4 7923
+byte 4 7924
+byte 4 7925
+byte 4 7926
+byte 4 7927
+byte 4 7928
+byte 4 7929
+byte 4 7930
+byte 4 7931
+byte 4 7932
+byte 4 7933
+byte 4 7934
+byte 4 7935
+byte 4 7944
+byte 4 7952
+byte 4 7958
+byte 4 7968
+byte 4 7976
+byte 4 7984
+byte 4 7992
+byte 4 8000
+byte 4 8006
+byte 4 8016
+byte 4 8024
+byte 4 8032
+byte 4 8040
+byte 4 8048
+byte 4 8062
+byte 4 8064
+byte 4 8072
+byte 4 8080
+byte 4 8088
+byte 4 8096
+byte 4 8104
+byte 4 8112
+byte 4 8117
+byte 4 8118
+byte 4 8120
+byte 4 8126
+byte 4 8127
+byte 4 8130
+byte 4 8133
+byte 4 8134
+byte 4 8136
+byte 4 8144
+byte 4 8148
+byte 4 8150
+byte 4 8152
+byte 4 8160
+byte 4 8168
+byte 4 8178
+byte 4 8181
+byte 4 8182
+byte 4 8184
+byte 4 8305
+byte 4 8306
+byte 4 8319
+byte 4 8320
+byte 4 8336
+byte 4 8341
+byte 4 8458
+byte 4 8459
+byte 4 8462
+byte 4 8464
+byte 4 8467
+byte 4 8468
+byte 4 8495
+byte 4 8496
+byte 4 8500
+byte 4 8501
+byte 4 8505
+byte 4 8506
+byte 4 8508
+byte 4 8510
+byte 4 8518
+byte 4 8522
+byte 4 8526
+byte 4 8527
+byte 4 8560
+byte 4 8576
+byte 4 8580
+byte 4 8581
+byte 4 9424
+byte 4 9450
+byte 4 11312
+byte 4 11359
+byte 4 11361
+byte 4 11362
+byte 4 11365
+byte 4 11367
+byte 4 11368
+byte 4 11369
+byte 4 11370
+byte 4 11371
+byte 4 11372
+byte 4 11373
+byte 4 11377
+byte 4 11378
+byte 4 11379
+byte 4 11381
+byte 4 11382
+byte 4 11390
+byte 4 11393
+byte 4 11394
+byte 4 11395
+byte 4 11396
+byte 4 11397
+byte 4 11398
+byte 4 11399
+byte 4 11400
+byte 4 11401
+byte 4 11402
+byte 4 11403
+byte 4 11404
+byte 4 11405
+byte 4 11406
+byte 4 11407
+byte 4 11408
+byte 4 11409
+byte 4 11410
+byte 4 11411
+byte 4 11412
+byte 4 11413
+byte 4 11414
+byte 4 11415
+byte 4 11416
+byte 4 11417
+byte 4 11418
+byte 4 11419
+byte 4 11420
+byte 4 11421
+byte 4 11422
+byte 4 11423
+byte 4 11424
+byte 4 11425
+byte 4 11426
+byte 4 11427
+byte 4 11428
+byte 4 11429
+byte 4 11430
+byte 4 11431
+byte 4 11432
+byte 4 11433
+byte 4 11434
+byte 4 11435
+byte 4 11436
+byte 4 11437
+byte 4 11438
+byte 4 11439
+byte 4 11440
+byte 4 11441
+byte 4 11442
+byte 4 11443
+byte 4 11444
+byte 4 11445
+byte 4 11446
+byte 4 11447
+byte 4 11448
+byte 4 11449
+byte 4 11450
+byte 4 11451
+byte 4 11452
+byte 4 11453
+byte 4 11454
+byte 4 11455
+byte 4 11456
+byte 4 11457
+byte 4 11458
+byte 4 11459
+byte 4 11460
+byte 4 11461
+byte 4 11462
+byte 4 11463
+byte 4 11464
+byte 4 11465
+byte 4 11466
+byte 4 11467
+byte 4 11468
+byte 4 11469
+byte 4 11470
+byte 4 11471
+byte 4 11472
+byte 4 11473
+byte 4 11474
+byte 4 11475
+byte 4 11476
+byte 4 11477
+byte 4 11478
+byte 4 11479
+byte 4 11480
+byte 4 11481
+byte 4 11482
+byte 4 11483
+byte 4 11484
+byte 4 11485
+byte 4 11486
+byte 4 11487
+byte 4 11488
+byte 4 11489
+byte 4 11490
+byte 4 11491
+byte 4 11493
+byte 4 11520
+byte 4 11558
+byte 4 42561
+byte 4 42562
+byte 4 42563
+byte 4 42564
+byte 4 42565
+byte 4 42566
+byte 4 42567
+byte 4 42568
+byte 4 42569
+byte 4 42570
+byte 4 42571
+byte 4 42572
+byte 4 42573
+byte 4 42574
+byte 4 42575
+byte 4 42576
+byte 4 42577
+byte 4 42578
+byte 4 42579
+byte 4 42580
+byte 4 42581
+byte 4 42582
+byte 4 42583
+byte 4 42584
+byte 4 42585
+byte 4 42586
+byte 4 42587
+byte 4 42588
+byte 4 42589
+byte 4 42590
+byte 4 42591
+byte 4 42592
+byte 4 42595
+byte 4 42596
+byte 4 42597
+byte 4 42598
+byte 4 42599
+byte 4 42600
+byte 4 42601
+byte 4 42602
+byte 4 42603
+byte 4 42604
+byte 4 42605
+byte 4 42606
+byte 4 42625
+byte 4 42626
+byte 4 42627
+byte 4 42628
+byte 4 42629
+byte 4 42630
+byte 4 42631
+byte 4 42632
+byte 4 42633
+byte 4 42634
+byte 4 42635
+byte 4 42636
+byte 4 42637
+byte 4 42638
+byte 4 42639
+byte 4 42640
+byte 4 42641
+byte 4 42642
+byte 4 42643
+byte 4 42644
+byte 4 42645
+byte 4 42646
+byte 4 42647
+byte 4 42648
+byte 4 42787
+byte 4 42788
+byte 4 42789
+byte 4 42790
+byte 4 42791
+byte 4 42792
+byte 4 42793
+byte 4 42794
+byte 4 42795
+byte 4 42796
+byte 4 42797
+byte 4 42798
+byte 4 42799
+byte 4 42802
+byte 4 42803
+byte 4 42804
+byte 4 42805
+byte 4 42806
+byte 4 42807
+byte 4 42808
+byte 4 42809
+byte 4 42810
+byte 4 42811
+byte 4 42812
+byte 4 42813
+byte 4 42814
+byte 4 42815
+byte 4 42816
+byte 4 42817
+byte 4 42818
+byte 4 42819
+byte 4 42820
+byte 4 42821
+byte 4 42822
+byte 4 42823
+byte 4 42824
+byte 4 42825
+byte 4 42826
+byte 4 42827
+byte 4 42828
+byte 4 42829
+byte 4 42830
+byte 4 42831
+byte 4 42832
+byte 4 42833
+byte 4 42834
+byte 4 42835
+byte 4 42836
+byte 4 42837
+byte 4 42838
+byte 4 42839
+byte 4 42840
+byte 4 42841
+byte 4 42842
+byte 4 42843
+byte 4 42844
+byte 4 42845
+byte 4 42846
+byte 4 42847
+byte 4 42848
+byte 4 42849
+byte 4 42850
+byte 4 42851
+byte 4 42852
+byte 4 42853
+byte 4 42854
+byte 4 42855
+byte 4 42856
+byte 4 42857
+byte 4 42858
+byte 4 42859
+byte 4 42860
+byte 4 42861
+byte 4 42862
+byte 4 42863
+byte 4 42873
+byte 4 42874
+byte 4 42875
+byte 4 42876
+byte 4 42877
+byte 4 42879
+byte 4 42880
+byte 4 42881
+byte 4 42882
+byte 4 42883
+byte 4 42884
+byte 4 42885
+byte 4 42886
+byte 4 42887
+byte 4 42888
+byte 4 42892
+byte 4 42893
+byte 4 64256
+byte 4 64263
+byte 4 64275
+byte 4 64280
+byte 4 65345
+byte 4 65371
+align 4
+LABELV uc_prop_alphabetic
+byte 4 65
+byte 4 91
+byte 4 97
+byte 4 123
+byte 4 170
+byte 4 171
+byte 4 181
+byte 4 182
+byte 4 186
+byte 4 187
+byte 4 192
+byte 4 215
+byte 4 216
+byte 4 247
+byte 4 248
+byte 4 706
+byte 4 710
+byte 4 722
+byte 4 736
+byte 4 741
+byte 4 748
+byte 4 749
+byte 4 750
+byte 4 751
+byte 4 837
+byte 4 838
+byte 4 880
+byte 4 885
+byte 4 886
+byte 4 888
+byte 4 890
+byte 4 894
+byte 4 902
+byte 4 903
+byte 4 904
+byte 4 907
+byte 4 908
+byte 4 909
+byte 4 910
+byte 4 930
+byte 4 931
+byte 4 1014
+byte 4 1015
+byte 4 1154
+byte 4 1162
+byte 4 1316
+byte 4 1329
+byte 4 1367
+byte 4 1369
+byte 4 1370
+byte 4 1377
+byte 4 1416
+byte 4 1456
+byte 4 1470
+byte 4 1471
+byte 4 1472
+byte 4 1473
+byte 4 1475
+byte 4 1476
+byte 4 1478
+byte 4 1479
+byte 4 1480
+byte 4 1488
+byte 4 1515
+byte 4 1520
+byte 4 1523
+byte 4 1552
+byte 4 1563
+byte 4 1569
+byte 4 1624
+byte 4 1625
+byte 4 1631
+byte 4 1646
+byte 4 1748
+byte 4 1749
+byte 4 1757
+byte 4 1761
+byte 4 1769
+byte 4 1773
+byte 4 1776
+byte 4 1786
+byte 4 1789
+byte 4 1791
+byte 4 1792
+byte 4 1808
+byte 4 1856
+byte 4 1869
+byte 4 1970
+byte 4 1994
+byte 4 2027
+byte 4 2036
+byte 4 2038
+byte 4 2042
+byte 4 2043
+byte 4 2305
+byte 4 2362
+byte 4 2365
+byte 4 2381
+byte 4 2384
+byte 4 2385
+byte 4 2392
+byte 4 2404
+byte 4 2417
+byte 4 2419
+byte 4 2427
+byte 4 2432
+byte 4 2433
+byte 4 2436
+byte 4 2437
+byte 4 2445
+byte 4 2447
+byte 4 2449
+byte 4 2451
+byte 4 2473
+byte 4 2474
+byte 4 2481
+byte 4 2482
+byte 4 2483
+byte 4 2486
+byte 4 2490
+byte 4 2493
+byte 4 2501
+byte 4 2503
+byte 4 2505
+byte 4 2507
+byte 4 2509
+byte 4 2510
+byte 4 2511
+byte 4 2519
+byte 4 2520
+byte 4 2524
+byte 4 2526
+byte 4 2527
+byte 4 2532
+byte 4 2544
+byte 4 2546
+byte 4 2561
+byte 4 2564
+byte 4 2565
+byte 4 2571
+byte 4 2575
+byte 4 2577
+byte 4 2579
+byte 4 2601
+byte 4 2602
+byte 4 2609
+byte 4 2610
+byte 4 2612
+byte 4 2613
+byte 4 2615
+byte 4 2616
+byte 4 2618
+byte 4 2622
+byte 4 2627
+byte 4 2631
+byte 4 2633
+byte 4 2635
+byte 4 2637
+byte 4 2641
+byte 4 2642
+byte 4 2649
+byte 4 2653
+byte 4 2654
+byte 4 2655
+byte 4 2672
+byte 4 2678
+byte 4 2689
+byte 4 2692
+byte 4 2693
+byte 4 2702
+byte 4 2703
+byte 4 2706
+byte 4 2707
+byte 4 2729
+byte 4 2730
+byte 4 2737
+byte 4 2738
+byte 4 2740
+byte 4 2741
+byte 4 2746
+byte 4 2749
+byte 4 2758
+byte 4 2759
+byte 4 2762
+byte 4 2763
+byte 4 2765
+byte 4 2768
+byte 4 2769
+byte 4 2784
+byte 4 2788
+byte 4 2817
+byte 4 2820
+byte 4 2821
+byte 4 2829
+byte 4 2831
+byte 4 2833
+byte 4 2835
+byte 4 2857
+byte 4 2858
+byte 4 2865
+byte 4 2866
+byte 4 2868
+byte 4 2869
+byte 4 2874
+byte 4 2877
+byte 4 2885
+byte 4 2887
+byte 4 2889
+byte 4 2891
+byte 4 2893
+byte 4 2902
+byte 4 2904
+byte 4 2908
+byte 4 2910
+byte 4 2911
+byte 4 2916
+byte 4 2929
+byte 4 2930
+byte 4 2946
+byte 4 2948
+byte 4 2949
+byte 4 2955
+byte 4 2958
+byte 4 2961
+byte 4 2962
+byte 4 2966
+byte 4 2969
+byte 4 2971
+byte 4 2972
+byte 4 2973
+byte 4 2974
+byte 4 2976
+byte 4 2979
+byte 4 2981
+byte 4 2984
+byte 4 2987
+byte 4 2990
+byte 4 3002
+byte 4 3006
+byte 4 3011
+byte 4 3014
+byte 4 3017
+byte 4 3018
+byte 4 3021
+byte 4 3024
+byte 4 3025
+byte 4 3031
+byte 4 3032
+byte 4 3073
+byte 4 3076
+byte 4 3077
+byte 4 3085
+byte 4 3086
+byte 4 3089
+byte 4 3090
+byte 4 3113
+byte 4 3114
+byte 4 3124
+byte 4 3125
+byte 4 3130
+byte 4 3133
+byte 4 3141
+byte 4 3142
+byte 4 3145
+byte 4 3146
+byte 4 3149
+byte 4 3157
+byte 4 3159
+byte 4 3160
+byte 4 3162
+byte 4 3168
+byte 4 3172
+byte 4 3202
+byte 4 3204
+byte 4 3205
+byte 4 3213
+byte 4 3214
+byte 4 3217
+byte 4 3218
+byte 4 3241
+byte 4 3242
+byte 4 3252
+byte 4 3253
+byte 4 3258
+byte 4 3261
+byte 4 3269
+byte 4 3270
+byte 4 3273
+byte 4 3274
+byte 4 3277
+byte 4 3285
+byte 4 3287
+byte 4 3294
+byte 4 3295
+byte 4 3296
+byte 4 3300
+byte 4 3330
+byte 4 3332
+byte 4 3333
+byte 4 3341
+byte 4 3342
+byte 4 3345
+byte 4 3346
+byte 4 3369
+byte 4 3370
+byte 4 3386
+byte 4 3389
+byte 4 3397
+byte 4 3398
+byte 4 3401
+byte 4 3402
+byte 4 3405
+byte 4 3415
+byte 4 3416
+byte 4 3424
+byte 4 3428
+byte 4 3450
+byte 4 3456
+byte 4 3458
+byte 4 3460
+byte 4 3461
+byte 4 3479
+byte 4 3482
+byte 4 3506
+byte 4 3507
+byte 4 3516
+byte 4 3517
+byte 4 3518
+byte 4 3520
+byte 4 3527
+byte 4 3535
+byte 4 3541
+byte 4 3542
+byte 4 3543
+byte 4 3544
+byte 4 3552
+byte 4 3570
+byte 4 3572
+byte 4 3585
+byte 4 3643
+byte 4 3648
+byte 4 3655
+byte 4 3661
+byte 4 3662
+byte 4 3713
+byte 4 3715
+byte 4 3716
+byte 4 3717
+byte 4 3719
+byte 4 3721
+byte 4 3722
+byte 4 3723
+byte 4 3725
+byte 4 3726
+byte 4 3732
+byte 4 3736
+byte 4 3737
+byte 4 3744
+byte 4 3745
+byte 4 3748
+byte 4 3749
+byte 4 3750
+byte 4 3751
+byte 4 3752
+byte 4 3754
+byte 4 3756
+byte 4 3757
+byte 4 3770
+byte 4 3771
+byte 4 3774
+byte 4 3776
+byte 4 3781
+byte 4 3782
+byte 4 3783
+byte 4 3789
+byte 4 3790
+byte 4 3804
+byte 4 3806
+byte 4 3840
+byte 4 3841
+byte 4 3904
+byte 4 3912
+byte 4 3913
+byte 4 3949
+byte 4 3953
+byte 4 3970
+byte 4 3976
+byte 4 3980
+byte 4 3984
+byte 4 3992
+byte 4 3993
+byte 4 4029
+byte 4 4096
+byte 4 4151
+byte 4 4152
+byte 4 4153
+byte 4 4155
+byte 4 4160
+byte 4 4176
+byte 4 4195
+byte 4 4197
+byte 4 4201
+byte 4 4206
+byte 4 4231
+byte 4 4238
+byte 4 4239
+byte 4 4256
+byte 4 4294
+byte 4 4304
+byte 4 4347
+byte 4 4348
+byte 4 4349
+byte 4 4352
+byte 4 4442
+byte 4 4447
+byte 4 4515
+byte 4 4520
+byte 4 4602
+byte 4 4608
+byte 4 4681
+byte 4 4682
+byte 4 4686
+byte 4 4688
+byte 4 4695
+byte 4 4696
+byte 4 4697
+byte 4 4698
+byte 4 4702
+byte 4 4704
+byte 4 4745
+byte 4 4746
+byte 4 4750
+byte 4 4752
+byte 4 4785
+byte 4 4786
+byte 4 4790
+byte 4 4792
+byte 4 4799
+byte 4 4800
+byte 4 4801
+byte 4 4802
+byte 4 4806
+byte 4 4808
+byte 4 4823
+byte 4 4824
+byte 4 4881
+byte 4 4882
+byte 4 4886
+byte 4 4888
+byte 4 4955
+byte 4 4959
+byte 4 4960
+byte 4 4992
+byte 4 5008
+byte 4 5024
+byte 4 5109
+byte 4 5121
+byte 4 5741
+byte 4 5743
+byte 4 5751
+byte 4 5761
+byte 4 5787
+byte 4 5792
+byte 4 5867
+byte 4 5870
+byte 4 5873
+byte 4 5888
+byte 4 5901
+byte 4 5902
+byte 4 5908
+byte 4 5920
+byte 4 5940
+byte 4 5952
+byte 4 5972
+byte 4 5984
+byte 4 5997
+byte 4 5998
+byte 4 6001
+byte 4 6002
+byte 4 6004
+byte 4 6016
+byte 4 6068
+byte 4 6070
+byte 4 6089
+byte 4 6103
+byte 4 6104
+byte 4 6108
+byte 4 6109
+byte 4 6176
+byte 4 6264
+byte 4 6272
+byte 4 6315
+byte 4 6400
+byte 4 6429
+byte 4 6432
+byte 4 6444
+byte 4 6448
+byte 4 6457
+byte 4 6480
+byte 4 6510
+byte 4 6512
+byte 4 6517
+byte 4 6528
+byte 4 6570
+byte 4 6576
+byte 4 6602
+byte 4 6656
+byte 4 6684
+byte 4 6912
+byte 4 6964
+byte 4 6965
+byte 4 6980
+byte 4 6981
+byte 4 6988
+byte 4 7040
+byte 4 7082
+byte 4 7086
+byte 4 7088
+byte 4 7168
+byte 4 7222
+byte 4 7245
+byte 4 7248
+byte 4 7258
+byte 4 7294
+byte 4 7424
+byte 4 7616
+byte 4 7680
+byte 4 7958
+byte 4 7960
+byte 4 7966
+byte 4 7968
+byte 4 8006
+byte 4 8008
+byte 4 8014
+byte 4 8016
+byte 4 8024
+byte 4 8025
+byte 4 8026
+byte 4 8027
+byte 4 8028
+byte 4 8029
+byte 4 8030
+byte 4 8031
+byte 4 8062
+byte 4 8064
+byte 4 8117
+byte 4 8118
+byte 4 8125
+byte 4 8126
+byte 4 8127
+byte 4 8130
+byte 4 8133
+byte 4 8134
+byte 4 8141
+byte 4 8144
+byte 4 8148
+byte 4 8150
+byte 4 8156
+byte 4 8160
+byte 4 8173
+byte 4 8178
+byte 4 8181
+byte 4 8182
+byte 4 8189
+byte 4 8305
+byte 4 8306
+byte 4 8319
+byte 4 8320
+byte 4 8336
+byte 4 8341
+byte 4 8450
+byte 4 8451
+byte 4 8455
+byte 4 8456
+byte 4 8458
+byte 4 8468
+byte 4 8469
+byte 4 8470
+byte 4 8473
+byte 4 8478
+byte 4 8484
+byte 4 8485
+byte 4 8486
+byte 4 8487
+byte 4 8488
+byte 4 8489
+byte 4 8490
+byte 4 8494
+byte 4 8495
+byte 4 8506
+byte 4 8508
+byte 4 8512
+byte 4 8517
+byte 4 8522
+byte 4 8526
+byte 4 8527
+byte 4 8544
+byte 4 8585
+byte 4 9398
+byte 4 9450
+byte 4 11264
+byte 4 11311
+byte 4 11312
+byte 4 11359
+byte 4 11360
+byte 4 11376
+byte 4 11377
+byte 4 11390
+byte 4 11392
+byte 4 11493
+byte 4 11520
+byte 4 11558
+byte 4 11568
+byte 4 11622
+byte 4 11631
+byte 4 11632
+byte 4 11648
+byte 4 11671
+byte 4 11680
+byte 4 11687
+byte 4 11688
+byte 4 11695
+byte 4 11696
+byte 4 11703
+byte 4 11704
+byte 4 11711
+byte 4 11712
+byte 4 11719
+byte 4 11720
+byte 4 11727
+byte 4 11728
+byte 4 11735
+byte 4 11736
+byte 4 11743
+byte 4 11744
+byte 4 11776
+byte 4 11823
+byte 4 11824
+byte 4 12293
+byte 4 12296
+byte 4 12321
+byte 4 12330
+byte 4 12337
+byte 4 12342
+byte 4 12344
+byte 4 12349
+byte 4 12353
+byte 4 12439
+byte 4 12445
+byte 4 12448
+byte 4 12449
+byte 4 12539
+byte 4 12540
+byte 4 12544
+byte 4 12549
+byte 4 12590
+byte 4 12593
+byte 4 12687
+byte 4 12704
+byte 4 12728
+byte 4 12784
+byte 4 12800
+byte 4 13312
+byte 4 19894
+byte 4 19968
+byte 4 40900
+byte 4 40960
+byte 4 42125
+byte 4 42240
+byte 4 42509
+byte 4 42512
+byte 4 42528
+byte 4 42538
+byte 4 42540
+byte 4 42560
+byte 4 42592
+byte 4 42594
+byte 4 42607
+byte 4 42623
+byte 4 42648
+byte 4 42775
+byte 4 42784
+byte 4 42786
+byte 4 42889
+byte 4 42891
+byte 4 42893
+byte 4 43003
+byte 4 43010
+byte 4 43011
+byte 4 43014
+byte 4 43015
+byte 4 43019
+byte 4 43020
+byte 4 43048
+byte 4 43072
+byte 4 43124
+byte 4 43136
+byte 4 43204
+byte 4 43274
+byte 4 43307
+byte 4 43312
+byte 4 43347
+byte 4 43520
+byte 4 43575
+byte 4 43584
+byte 4 43598
+byte 4 44032
+byte 4 55204
+byte 4 63744
+byte 4 64046
+byte 4 64048
+byte 4 64107
+byte 4 64112
+byte 4 64218
+byte 4 64256
+byte 4 64263
+byte 4 64275
+byte 4 64280
+byte 4 64285
+byte 4 64297
+byte 4 64298
+byte 4 64311
+byte 4 64312
+byte 4 64317
+byte 4 64318
+byte 4 64319
+byte 4 64320
+byte 4 64322
+byte 4 64323
+byte 4 64325
+byte 4 64326
+byte 4 64434
+byte 4 64467
+byte 4 64830
+byte 4 64848
+byte 4 64912
+byte 4 64914
+byte 4 64968
+byte 4 65008
+byte 4 65020
+byte 4 65136
+byte 4 65141
+byte 4 65142
+byte 4 65277
+byte 4 65313
+byte 4 65339
+byte 4 65345
+byte 4 65371
+byte 4 65382
+byte 4 65471
+byte 4 65474
+byte 4 65480
+byte 4 65482
+byte 4 65488
+byte 4 65490
+byte 4 65496
+byte 4 65498
+byte 4 65501
+align 4
+LABELV uc_prop_ideographic
+byte 4 12294
+byte 4 12296
+byte 4 12321
+byte 4 12330
+byte 4 12344
+byte 4 12347
+byte 4 13312
+byte 4 19894
+byte 4 19968
+byte 4 40900
+byte 4 63744
+byte 4 64046
+byte 4 64048
+byte 4 64107
+byte 4 64112
+byte 4 64218
+align 4
+LABELV uc_prop_digit
+byte 4 48
+byte 4 57
+byte 4 1632
+byte 4 1641
+byte 4 1776
+byte 4 1785
+byte 4 1984
+byte 4 1993
+byte 4 2406
+byte 4 2415
+byte 4 2534
+byte 4 2543
+byte 4 2662
+byte 4 2671
+byte 4 2790
+byte 4 2799
+byte 4 2918
+byte 4 2927
+byte 4 3046
+byte 4 3055
+byte 4 3174
+byte 4 3183
+byte 4 3302
+byte 4 3311
+byte 4 3430
+byte 4 3439
+byte 4 3664
+byte 4 3673
+byte 4 3792
+byte 4 3801
+byte 4 3872
+byte 4 3881
+byte 4 4160
+byte 4 4169
+byte 4 4240
+byte 4 4249
+byte 4 4969
+byte 4 4977
+byte 4 6112
+byte 4 6121
+byte 4 6160
+byte 4 6169
+byte 4 6470
+byte 4 6479
+byte 4 6608
+byte 4 6618
+byte 4 6784
+byte 4 6793
+byte 4 6800
+byte 4 6809
+byte 4 6992
+byte 4 7001
+byte 4 7088
+byte 4 7097
+byte 4 7232
+byte 4 7241
+byte 4 7248
+byte 4 7257
+byte 4 42528
+byte 4 42537
+byte 4 43216
+byte 4 43225
+byte 4 43264
+byte 4 43273
+byte 4 43472
+byte 4 43481
+byte 4 43600
+byte 4 43609
+byte 4 44016
+byte 4 44025
+byte 4 65296
+byte 4 65305
+align 4
+LABELV uc_case_lower
+byte 4 65
+byte 4 97
+byte 4 66
+byte 4 98
+byte 4 67
+byte 4 99
+byte 4 68
+byte 4 100
+byte 4 69
+byte 4 101
+byte 4 70
+byte 4 102
+byte 4 71
+byte 4 103
+byte 4 72
+byte 4 104
+byte 4 73
+byte 4 105
+byte 4 74
+byte 4 106
+byte 4 75
+byte 4 107
+byte 4 76
+byte 4 108
+byte 4 77
+byte 4 109
+byte 4 78
+byte 4 110
+byte 4 79
+byte 4 111
+byte 4 80
+byte 4 112
+byte 4 81
+byte 4 113
+byte 4 82
+byte 4 114
+byte 4 83
+byte 4 115
+byte 4 84
+byte 4 116
+byte 4 85
+byte 4 117
+byte 4 86
+byte 4 118
+byte 4 87
+byte 4 119
+byte 4 88
+byte 4 120
+byte 4 89
+byte 4 121
+byte 4 90
+byte 4 122
+byte 4 192
+byte 4 224
+byte 4 193
+byte 4 225
+byte 4 194
+byte 4 226
+byte 4 195
+byte 4 227
+byte 4 196
+byte 4 228
+byte 4 197
+byte 4 229
+byte 4 198
+byte 4 230
+byte 4 199
+byte 4 231
+byte 4 200
+byte 4 232
+byte 4 201
+byte 4 233
+byte 4 202
+byte 4 234
+byte 4 203
+byte 4 235
+byte 4 204
+byte 4 236
+byte 4 205
+byte 4 237
+byte 4 206
+byte 4 238
+byte 4 207
+byte 4 239
+byte 4 208
+byte 4 240
+byte 4 209
+byte 4 241
+byte 4 210
+byte 4 242
+byte 4 211
+byte 4 243
+byte 4 212
+byte 4 244
+byte 4 213
+byte 4 245
+byte 4 214
+byte 4 246
+byte 4 216
+byte 4 248
+byte 4 217
+byte 4 249
+byte 4 218
+byte 4 250
+byte 4 219
+byte 4 251
+byte 4 220
+byte 4 252
+byte 4 221
+byte 4 253
+byte 4 222
+byte 4 254
+byte 4 256
+byte 4 257
+byte 4 258
+byte 4 259
+byte 4 260
+byte 4 261
+byte 4 262
+byte 4 263
+byte 4 264
+byte 4 265
+byte 4 266
+byte 4 267
+byte 4 268
+byte 4 269
+byte 4 270
+byte 4 271
+byte 4 272
+byte 4 273
+byte 4 274
+byte 4 275
+byte 4 276
+byte 4 277
+byte 4 278
+byte 4 279
+byte 4 280
+byte 4 281
+byte 4 282
+byte 4 283
+byte 4 284
+byte 4 285
+byte 4 286
+byte 4 287
+byte 4 288
+byte 4 289
+byte 4 290
+byte 4 291
+byte 4 292
+byte 4 293
+byte 4 294
+byte 4 295
+byte 4 296
+byte 4 297
+byte 4 298
+byte 4 299
+byte 4 300
+byte 4 301
+byte 4 302
+byte 4 303
+byte 4 304
+byte 4 105
+byte 4 306
+byte 4 307
+byte 4 308
+byte 4 309
+byte 4 310
+byte 4 311
+byte 4 313
+byte 4 314
+byte 4 315
+byte 4 316
+byte 4 317
+byte 4 318
+byte 4 319
+byte 4 320
+byte 4 321
+byte 4 322
+byte 4 323
+byte 4 324
+byte 4 325
+byte 4 326
+byte 4 327
+byte 4 328
+byte 4 330
+byte 4 331
+byte 4 332
+byte 4 333
+byte 4 334
+byte 4 335
+byte 4 336
+byte 4 337
+byte 4 338
+byte 4 339
+byte 4 340
+byte 4 341
+byte 4 342
+byte 4 343
+byte 4 344
+byte 4 345
+byte 4 346
+byte 4 347
+byte 4 348
+byte 4 349
+byte 4 350
+byte 4 351
+byte 4 352
+byte 4 353
+byte 4 354
+byte 4 355
+byte 4 356
+byte 4 357
+byte 4 358
+byte 4 359
+byte 4 360
+byte 4 361
+byte 4 362
+byte 4 363
+byte 4 364
+byte 4 365
+byte 4 366
+byte 4 367
+byte 4 368
+byte 4 369
+byte 4 370
+byte 4 371
+byte 4 372
+byte 4 373
+byte 4 374
+byte 4 375
+byte 4 376
+byte 4 255
+byte 4 377
+byte 4 378
+byte 4 379
+byte 4 380
+byte 4 381
+byte 4 382
+byte 4 385
+byte 4 595
+byte 4 386
+byte 4 387
+byte 4 388
+byte 4 389
+byte 4 390
+byte 4 596
+byte 4 391
+byte 4 392
+byte 4 393
+byte 4 598
+byte 4 394
+byte 4 599
+byte 4 395
+byte 4 396
+byte 4 398
+byte 4 477
+byte 4 399
+byte 4 601
+byte 4 400
+byte 4 603
+byte 4 401
+byte 4 402
+byte 4 403
+byte 4 608
+byte 4 404
+byte 4 611
+byte 4 406
+byte 4 617
+byte 4 407
+byte 4 616
+byte 4 408
+byte 4 409
+byte 4 412
+byte 4 623
+byte 4 413
+byte 4 626
+byte 4 415
+byte 4 629
+byte 4 416
+byte 4 417
+byte 4 418
+byte 4 419
+byte 4 420
+byte 4 421
+byte 4 422
+byte 4 640
+byte 4 423
+byte 4 424
+byte 4 425
+byte 4 643
+byte 4 428
+byte 4 429
+byte 4 430
+byte 4 648
+byte 4 431
+byte 4 432
+byte 4 433
+byte 4 650
+byte 4 434
+byte 4 651
+byte 4 435
+byte 4 436
+byte 4 437
+byte 4 438
+byte 4 439
+byte 4 658
+byte 4 440
+byte 4 441
+byte 4 444
+byte 4 445
+byte 4 452
+byte 4 454
+byte 4 453
+byte 4 454
+byte 4 455
+byte 4 457
+byte 4 456
+byte 4 457
+byte 4 458
+byte 4 460
+byte 4 459
+byte 4 460
+byte 4 461
+byte 4 462
+byte 4 463
+byte 4 464
+byte 4 465
+byte 4 466
+byte 4 467
+byte 4 468
+byte 4 469
+byte 4 470
+byte 4 471
+byte 4 472
+byte 4 473
+byte 4 474
+byte 4 475
+byte 4 476
+byte 4 478
+byte 4 479
+byte 4 480
+byte 4 481
+byte 4 482
+byte 4 483
+byte 4 484
+byte 4 485
+byte 4 486
+byte 4 487
+byte 4 488
+byte 4 489
+byte 4 490
+byte 4 491
+byte 4 492
+byte 4 493
+byte 4 494
+byte 4 495
+byte 4 497
+byte 4 499
+byte 4 498
+byte 4 499
+byte 4 500
+byte 4 501
+byte 4 502
+byte 4 405
+byte 4 503
+byte 4 447
+byte 4 504
+byte 4 505
+byte 4 506
+byte 4 507
+byte 4 508
+byte 4 509
+byte 4 510
+byte 4 511
+byte 4 512
+byte 4 513
+byte 4 514
+byte 4 515
+byte 4 516
+byte 4 517
+byte 4 518
+byte 4 519
+byte 4 520
+byte 4 521
+byte 4 522
+byte 4 523
+byte 4 524
+byte 4 525
+byte 4 526
+byte 4 527
+byte 4 528
+byte 4 529
+byte 4 530
+byte 4 531
+byte 4 532
+byte 4 533
+byte 4 534
+byte 4 535
+byte 4 536
+byte 4 537
+byte 4 538
+byte 4 539
+byte 4 540
+byte 4 541
+byte 4 542
+byte 4 543
+byte 4 544
+byte 4 414
+byte 4 546
+byte 4 547
+byte 4 548
+byte 4 549
+byte 4 550
+byte 4 551
+byte 4 552
+byte 4 553
+byte 4 554
+byte 4 555
+byte 4 556
+byte 4 557
+byte 4 558
+byte 4 559
+byte 4 560
+byte 4 561
+byte 4 562
+byte 4 563
+byte 4 570
+byte 4 11365
+byte 4 571
+byte 4 572
+byte 4 573
+byte 4 410
+byte 4 574
+byte 4 11366
+byte 4 577
+byte 4 578
+byte 4 579
+byte 4 384
+byte 4 580
+byte 4 649
+byte 4 581
+byte 4 652
+byte 4 582
+byte 4 583
+byte 4 584
+byte 4 585
+byte 4 586
+byte 4 587
+byte 4 588
+byte 4 589
+byte 4 590
+byte 4 591
+byte 4 880
+byte 4 881
+byte 4 882
+byte 4 883
+byte 4 886
+byte 4 887
+byte 4 902
+byte 4 940
+byte 4 904
+byte 4 941
+byte 4 905
+byte 4 942
+byte 4 906
+byte 4 943
+byte 4 908
+byte 4 972
+byte 4 910
+byte 4 973
+byte 4 911
+byte 4 974
+byte 4 913
+byte 4 945
+byte 4 914
+byte 4 946
+byte 4 915
+byte 4 947
+byte 4 916
+byte 4 948
+byte 4 917
+byte 4 949
+byte 4 918
+byte 4 950
+byte 4 919
+byte 4 951
+byte 4 920
+byte 4 952
+byte 4 921
+byte 4 953
+byte 4 922
+byte 4 954
+byte 4 923
+byte 4 955
+byte 4 924
+byte 4 956
+byte 4 925
+byte 4 957
+byte 4 926
+byte 4 958
+byte 4 927
+byte 4 959
+byte 4 928
+byte 4 960
+byte 4 929
+byte 4 961
+byte 4 931
+byte 4 963
+byte 4 932
+byte 4 964
+byte 4 933
+byte 4 965
+byte 4 934
+byte 4 966
+byte 4 935
+byte 4 967
+byte 4 936
+byte 4 968
+byte 4 937
+byte 4 969
+byte 4 938
+byte 4 970
+byte 4 939
+byte 4 971
+byte 4 975
+byte 4 983
+byte 4 984
+byte 4 985
+byte 4 986
+byte 4 987
+byte 4 988
+byte 4 989
+byte 4 990
+byte 4 991
+byte 4 992
+byte 4 993
+byte 4 994
+byte 4 995
+byte 4 996
+byte 4 997
+byte 4 998
+byte 4 999
+byte 4 1000
+byte 4 1001
+byte 4 1002
+byte 4 1003
+byte 4 1004
+byte 4 1005
+byte 4 1006
+byte 4 1007
+byte 4 1012
+byte 4 952
+byte 4 1015
+byte 4 1016
+byte 4 1017
+byte 4 1010
+byte 4 1018
+byte 4 1019
+byte 4 1021
+byte 4 891
+byte 4 1022
+byte 4 892
+byte 4 1023
+byte 4 893
+byte 4 1024
+byte 4 1104
+byte 4 1025
+byte 4 1105
+byte 4 1026
+byte 4 1106
+byte 4 1027
+byte 4 1107
+byte 4 1028
+byte 4 1108
+byte 4 1029
+byte 4 1109
+byte 4 1030
+byte 4 1110
+byte 4 1031
+byte 4 1111
+byte 4 1032
+byte 4 1112
+byte 4 1033
+byte 4 1113
+byte 4 1034
+byte 4 1114
+byte 4 1035
+byte 4 1115
+byte 4 1036
+byte 4 1116
+byte 4 1037
+byte 4 1117
+byte 4 1038
+byte 4 1118
+byte 4 1039
+byte 4 1119
+byte 4 1040
+byte 4 1072
+byte 4 1041
+byte 4 1073
+byte 4 1042
+byte 4 1074
+byte 4 1043
+byte 4 1075
+byte 4 1044
+byte 4 1076
+byte 4 1045
+byte 4 1077
+byte 4 1046
+byte 4 1078
+byte 4 1047
+byte 4 1079
+byte 4 1048
+byte 4 1080
+byte 4 1049
+byte 4 1081
+byte 4 1050
+byte 4 1082
+byte 4 1051
+byte 4 1083
+byte 4 1052
+byte 4 1084
+byte 4 1053
+byte 4 1085
+byte 4 1054
+byte 4 1086
+byte 4 1055
+byte 4 1087
+byte 4 1056
+byte 4 1088
+byte 4 1057
+byte 4 1089
+byte 4 1058
+byte 4 1090
+byte 4 1059
+byte 4 1091
+byte 4 1060
+byte 4 1092
+byte 4 1061
+byte 4 1093
+byte 4 1062
+byte 4 1094
+byte 4 1063
+byte 4 1095
+byte 4 1064
+byte 4 1096
+byte 4 1065
+byte 4 1097
+byte 4 1066
+byte 4 1098
+byte 4 1067
+byte 4 1099
+byte 4 1068
+byte 4 1100
+byte 4 1069
+byte 4 1101
+byte 4 1070
+byte 4 1102
+byte 4 1071
+byte 4 1103
+byte 4 1120
+byte 4 1121
+byte 4 1122
+byte 4 1123
+byte 4 1124
+byte 4 1125
+byte 4 1126
+byte 4 1127
+byte 4 1128
+byte 4 1129
+byte 4 1130
+byte 4 1131
+byte 4 1132
+byte 4 1133
+byte 4 1134
+byte 4 1135
+byte 4 1136
+byte 4 1137
+byte 4 1138
+byte 4 1139
+byte 4 1140
+byte 4 1141
+byte 4 1142
+byte 4 1143
+byte 4 1144
+byte 4 1145
+byte 4 1146
+byte 4 1147
+byte 4 1148
+byte 4 1149
+byte 4 1150
+byte 4 1151
+byte 4 1152
+byte 4 1153
+byte 4 1162
+byte 4 1163
+byte 4 1164
+byte 4 1165
+byte 4 1166
+byte 4 1167
+byte 4 1168
+byte 4 1169
+byte 4 1170
+byte 4 1171
+byte 4 1172
+byte 4 1173
+byte 4 1174
+byte 4 1175
+byte 4 1176
+byte 4 1177
+byte 4 1178
+byte 4 1179
+byte 4 1180
+byte 4 1181
+byte 4 1182
+byte 4 1183
+byte 4 1184
+byte 4 1185
+byte 4 1186
+byte 4 1187
+byte 4 1188
+byte 4 1189
+byte 4 1190
+byte 4 1191
+byte 4 1192
+byte 4 1193
+byte 4 1194
+byte 4 1195
+byte 4 1196
+byte 4 1197
+byte 4 1198
+byte 4 1199
+byte 4 1200
+byte 4 1201
+byte 4 1202
+byte 4 1203
+byte 4 1204
+byte 4 1205
+byte 4 1206
+byte 4 1207
+byte 4 1208
+byte 4 1209
+byte 4 1210
+byte 4 1211
+byte 4 1212
+byte 4 1213
+byte 4 1214
+byte 4 1215
+byte 4 1216
+byte 4 1231
+byte 4 1217
+byte 4 1218
+byte 4 1219
+byte 4 1220
+byte 4 1221
+byte 4 1222
+byte 4 1223
+byte 4 1224
+byte 4 1225
+byte 4 1226
+byte 4 1227
+byte 4 1228
+byte 4 1229
+byte 4 1230
+byte 4 1232
+byte 4 1233
+byte 4 1234
+byte 4 1235
+byte 4 1236
+byte 4 1237
+byte 4 1238
+byte 4 1239
+byte 4 1240
+byte 4 1241
+byte 4 1242
+byte 4 1243
+byte 4 1244
+byte 4 1245
+byte 4 1246
+byte 4 1247
+byte 4 1248
+byte 4 1249
+byte 4 1250
+byte 4 1251
+byte 4 1252
+byte 4 1253
+byte 4 1254
+byte 4 1255
+byte 4 1256
+byte 4 1257
+byte 4 1258
+byte 4 1259
+byte 4 1260
+byte 4 1261
+byte 4 1262
+byte 4 1263
+byte 4 1264
+byte 4 1265
+byte 4 1266
+byte 4 1267
+byte 4 1268
+byte 4 1269
+byte 4 1270
+byte 4 1271
+byte 4 1272
+byte 4 1273
+byte 4 1274
+byte 4 1275
+byte 4 1276
+byte 4 1277
+byte 4 1278
+byte 4 1279
+byte 4 1280
+byte 4 1281
+byte 4 1282
+byte 4 1283
+byte 4 1284
+byte 4 1285
+byte 4 1286
+byte 4 1287
+byte 4 1288
+byte 4 1289
+byte 4 1290
+byte 4 1291
+byte 4 1292
+byte 4 1293
+byte 4 1294
+byte 4 1295
+byte 4 1296
+byte 4 1297
+byte 4 1298
+byte 4 1299
+byte 4 1300
+byte 4 1301
+byte 4 1302
+byte 4 1303
+byte 4 1304
+byte 4 1305
+byte 4 1306
+byte 4 1307
+byte 4 1308
+byte 4 1309
+byte 4 1310
+byte 4 1311
+byte 4 1312
+byte 4 1313
+byte 4 1314
+byte 4 1315
+byte 4 1329
+byte 4 1377
+byte 4 1330
+byte 4 1378
+byte 4 1331
+byte 4 1379
+byte 4 1332
+byte 4 1380
+byte 4 1333
+byte 4 1381
+byte 4 1334
+byte 4 1382
+byte 4 1335
+byte 4 1383
+byte 4 1336
+byte 4 1384
+byte 4 1337
+byte 4 1385
+byte 4 1338
+byte 4 1386
+byte 4 1339
+byte 4 1387
+byte 4 1340
+byte 4 1388
+byte 4 1341
+byte 4 1389
+byte 4 1342
+byte 4 1390
+byte 4 1343
+byte 4 1391
+byte 4 1344
+byte 4 1392
+byte 4 1345
+byte 4 1393
+byte 4 1346
+byte 4 1394
+byte 4 1347
+byte 4 1395
+byte 4 1348
+byte 4 1396
+byte 4 1349
+byte 4 1397
+byte 4 1350
+byte 4 1398
+byte 4 1351
+byte 4 1399
+byte 4 1352
+byte 4 1400
+byte 4 1353
+byte 4 1401
+byte 4 1354
+byte 4 1402
+byte 4 1355
+byte 4 1403
+byte 4 1356
+byte 4 1404
+byte 4 1357
+byte 4 1405
+byte 4 1358
+byte 4 1406
+byte 4 1359
+byte 4 1407
+byte 4 1360
+byte 4 1408
+byte 4 1361
+byte 4 1409
+byte 4 1362
+byte 4 1410
+byte 4 1363
+byte 4 1411
+byte 4 1364
+byte 4 1412
+byte 4 1365
+byte 4 1413
+byte 4 1366
+byte 4 1414
+byte 4 4256
+byte 4 11520
+byte 4 4257
+byte 4 11521
+byte 4 4258
+byte 4 11522
+byte 4 4259
+byte 4 11523
+byte 4 4260
+byte 4 11524
+byte 4 4261
+byte 4 11525
+byte 4 4262
+byte 4 11526
+byte 4 4263
+byte 4 11527
+byte 4 4264
+byte 4 11528
+byte 4 4265
+byte 4 11529
+byte 4 4266
+byte 4 11530
+byte 4 4267
+byte 4 11531
+byte 4 4268
+byte 4 11532
+byte 4 4269
+byte 4 11533
+byte 4 4270
+byte 4 11534
+byte 4 4271
+byte 4 11535
+byte 4 4272
+byte 4 11536
+byte 4 4273
+byte 4 11537
+byte 4 4274
+byte 4 11538
+byte 4 4275
+byte 4 11539
+byte 4 4276
+byte 4 11540
+byte 4 4277
+byte 4 11541
+byte 4 4278
+byte 4 11542
+byte 4 4279
+byte 4 11543
+byte 4 4280
+byte 4 11544
+byte 4 4281
+byte 4 11545
+byte 4 4282
+byte 4 11546
+byte 4 4283
+byte 4 11547
+byte 4 4284
+byte 4 11548
+byte 4 4285
+byte 4 11549
+byte 4 4286
+byte 4 11550
+byte 4 4287
+byte 4 11551
+byte 4 4288
+byte 4 11552
+byte 4 4289
+byte 4 11553
+byte 4 4290
+byte 4 11554
+byte 4 4291
+byte 4 11555
+byte 4 4292
+byte 4 11556
+byte 4 4293
+byte 4 11557
+byte 4 7680
+byte 4 7681
+byte 4 7682
+byte 4 7683
+byte 4 7684
+byte 4 7685
+byte 4 7686
+byte 4 7687
+byte 4 7688
+byte 4 7689
+byte 4 7690
+byte 4 7691
+byte 4 7692
+byte 4 7693
+byte 4 7694
+byte 4 7695
+byte 4 7696
+byte 4 7697
+byte 4 7698
+byte 4 7699
+byte 4 7700
+byte 4 7701
+byte 4 7702
+byte 4 7703
+byte 4 7704
+byte 4 7705
+byte 4 7706
+byte 4 7707
+byte 4 7708
+byte 4 7709
+byte 4 7710
+byte 4 7711
+byte 4 7712
+byte 4 7713
+byte 4 7714
+byte 4 7715
+byte 4 7716
+byte 4 7717
+byte 4 7718
+byte 4 7719
+byte 4 7720
+byte 4 7721
+byte 4 7722
+byte 4 7723
+byte 4 7724
+byte 4 7725
+byte 4 7726
+byte 4 7727
+byte 4 7728
+byte 4 7729
+byte 4 7730
+byte 4 7731
+byte 4 7732
+byte 4 7733
+byte 4 7734
+byte 4 7735
+byte 4 7736
+byte 4 7737
+byte 4 7738
+byte 4 7739
+byte 4 7740
+byte 4 7741
+byte 4 7742
+byte 4 7743
+byte 4 7744
+byte 4 7745
+byte 4 7746
+byte 4 7747
+byte 4 7748
+byte 4 7749
+byte 4 7750
+byte 4 7751
+byte 4 7752
+byte 4 7753
+byte 4 7754
+byte 4 7755
+byte 4 7756
+byte 4 7757
+byte 4 7758
+byte 4 7759
+byte 4 7760
+byte 4 7761
+byte 4 7762
+byte 4 7763
+byte 4 7764
+byte 4 7765
+byte 4 7766
+byte 4 7767
+byte 4 7768
+byte 4 7769
+byte 4 7770
+byte 4 7771
+byte 4 7772
+byte 4 7773
+byte 4 7774
+byte 4 7775
+byte 4 7776
+byte 4 7777
+byte 4 7778
+byte 4 7779
+byte 4 7780
+byte 4 7781
+byte 4 7782
+byte 4 7783
+byte 4 7784
+byte 4 7785
+byte 4 7786
+byte 4 7787
+byte 4 7788
+byte 4 7789
+byte 4 7790
+byte 4 7791
+byte 4 7792
+byte 4 7793
+byte 4 7794
+byte 4 7795
+byte 4 7796
+byte 4 7797
+byte 4 7798
+byte 4 7799
+byte 4 7800
+byte 4 7801
+byte 4 7802
+byte 4 7803
+byte 4 7804
+byte 4 7805
+byte 4 7806
+byte 4 7807
+byte 4 7808
+byte 4 7809
+byte 4 7810
+byte 4 7811
+byte 4 7812
+byte 4 7813
+byte 4 7814
+byte 4 7815
+byte 4 7816
+byte 4 7817
+byte 4 7818
+byte 4 7819
+byte 4 7820
+byte 4 7821
+byte 4 7822
+byte 4 7823
+byte 4 7824
+byte 4 7825
+byte 4 7826
+byte 4 7827
+byte 4 7828
+byte 4 7829
+byte 4 7838
+byte 4 223
+byte 4 7840
+byte 4 7841
+byte 4 7842
+byte 4 7843
+byte 4 7844
+byte 4 7845
+byte 4 7846
+byte 4 7847
+byte 4 7848
+byte 4 7849
+byte 4 7850
+byte 4 7851
+byte 4 7852
+byte 4 7853
+byte 4 7854
+byte 4 7855
+byte 4 7856
+byte 4 7857
+byte 4 7858
+byte 4 7859
+byte 4 7860
+byte 4 7861
+byte 4 7862
+byte 4 7863
+byte 4 7864
+byte 4 7865
+byte 4 7866
+byte 4 7867
+byte 4 7868
+byte 4 7869
+byte 4 7870
+byte 4 7871
+byte 4 7872
+byte 4 7873
+byte 4 7874
+byte 4 7875
+byte 4 7876
+byte 4 7877
+byte 4 7878
+byte 4 7879
+byte 4 7880
+byte 4 7881
+byte 4 7882
+byte 4 7883
+byte 4 7884
+byte 4 7885
+byte 4 7886
+byte 4 7887
+byte 4 7888
+byte 4 7889
+byte 4 7890
+byte 4 7891
+byte 4 7892
+byte 4 7893
+byte 4 7894
+byte 4 7895
+byte 4 7896
+byte 4 7897
+byte 4 7898
+byte 4 7899
+byte 4 7900
+byte 4 7901
+byte 4 7902
+byte 4 7903
+byte 4 7904
+byte 4 7905
+byte 4 7906
+byte 4 7907
+byte 4 7908
+byte 4 7909
+byte 4 7910
+byte 4 7911
+byte 4 7912
+byte 4 7913
+byte 4 7914
+byte 4 7915
+byte 4 7916
+byte 4 7917
+byte 4 7918
+byte 4 7919
+byte 4 7920
+byte 4 7921
+byte 4 7922
+byte 4 7923
+byte 4 7924
+byte 4 7925
+byte 4 7926
+byte 4 7927
+byte 4 7928
+byte 4 7929
+byte 4 7930
+byte 4 7931
+byte 4 7932
+byte 4 7933
+byte 4 7934
+byte 4 7935
+byte 4 7944
+byte 4 7936
+byte 4 7945
+byte 4 7937
+byte 4 7946
+byte 4 7938
+byte 4 7947
+byte 4 7939
+byte 4 7948
+byte 4 7940
+byte 4 7949
+byte 4 7941
+byte 4 7950
+byte 4 7942
+byte 4 7951
+byte 4 7943
+byte 4 7960
+byte 4 7952
+byte 4 7961
+byte 4 7953
+byte 4 7962
+byte 4 7954
+byte 4 7963
+byte 4 7955
+byte 4 7964
+byte 4 7956
+byte 4 7965
+byte 4 7957
+byte 4 7976
+byte 4 7968
+byte 4 7977
+byte 4 7969
+byte 4 7978
+byte 4 7970
+byte 4 7979
+byte 4 7971
+byte 4 7980
+byte 4 7972
+byte 4 7981
+byte 4 7973
+byte 4 7982
+byte 4 7974
+byte 4 7983
+byte 4 7975
+byte 4 7992
+byte 4 7984
+byte 4 7993
+byte 4 7985
+byte 4 7994
+byte 4 7986
+byte 4 7995
+byte 4 7987
+byte 4 7996
+byte 4 7988
+byte 4 7997
+byte 4 7989
+byte 4 7998
+byte 4 7990
+byte 4 7999
+byte 4 7991
+byte 4 8008
+byte 4 8000
+byte 4 8009
+byte 4 8001
+byte 4 8010
+byte 4 8002
+byte 4 8011
+byte 4 8003
+byte 4 8012
+byte 4 8004
+byte 4 8013
+byte 4 8005
+byte 4 8025
+byte 4 8017
+byte 4 8027
+byte 4 8019
+byte 4 8029
+byte 4 8021
+byte 4 8031
+byte 4 8023
+byte 4 8040
+byte 4 8032
+byte 4 8041
+byte 4 8033
+byte 4 8042
+byte 4 8034
+byte 4 8043
+byte 4 8035
+byte 4 8044
+byte 4 8036
+byte 4 8045
+byte 4 8037
+byte 4 8046
+byte 4 8038
+byte 4 8047
+byte 4 8039
+byte 4 8072
+byte 4 8064
+byte 4 8073
+byte 4 8065
+byte 4 8074
+byte 4 8066
+byte 4 8075
+byte 4 8067
+byte 4 8076
+byte 4 8068
+byte 4 8077
+byte 4 8069
+byte 4 8078
+byte 4 8070
+byte 4 8079
+byte 4 8071
+byte 4 8088
+byte 4 8080
+byte 4 8089
+byte 4 8081
+byte 4 8090
+byte 4 8082
+byte 4 8091
+byte 4 8083
+byte 4 8092
+byte 4 8084
+byte 4 8093
+byte 4 8085
+byte 4 8094
+byte 4 8086
+byte 4 8095
+byte 4 8087
+byte 4 8104
+byte 4 8096
+byte 4 8105
+byte 4 8097
+byte 4 8106
+byte 4 8098
+byte 4 8107
+byte 4 8099
+byte 4 8108
+byte 4 8100
+byte 4 8109
+byte 4 8101
+byte 4 8110
+byte 4 8102
+byte 4 8111
+byte 4 8103
+byte 4 8120
+byte 4 8112
+byte 4 8121
+byte 4 8113
+byte 4 8122
+byte 4 8048
+byte 4 8123
+byte 4 8049
+byte 4 8124
+byte 4 8115
+byte 4 8136
+byte 4 8050
+byte 4 8137
+byte 4 8051
+byte 4 8138
+byte 4 8052
+byte 4 8139
+byte 4 8053
+byte 4 8140
+byte 4 8131
+byte 4 8152
+byte 4 8144
+byte 4 8153
+byte 4 8145
+byte 4 8154
+byte 4 8054
+byte 4 8155
+byte 4 8055
+byte 4 8168
+byte 4 8160
+byte 4 8169
+byte 4 8161
+byte 4 8170
+byte 4 8058
+byte 4 8171
+byte 4 8059
+byte 4 8172
+byte 4 8165
+byte 4 8184
+byte 4 8056
+byte 4 8185
+byte 4 8057
+byte 4 8186
+byte 4 8060
+byte 4 8187
+byte 4 8061
+byte 4 8188
+byte 4 8179
+byte 4 8486
+byte 4 969
+byte 4 8490
+byte 4 107
+byte 4 8491
+byte 4 229
+byte 4 8498
+byte 4 8526
+byte 4 8544
+byte 4 8560
+byte 4 8545
+byte 4 8561
+byte 4 8546
+byte 4 8562
+byte 4 8547
+byte 4 8563
+byte 4 8548
+byte 4 8564
+byte 4 8549
+byte 4 8565
+byte 4 8550
+byte 4 8566
+byte 4 8551
+byte 4 8567
+byte 4 8552
+byte 4 8568
+byte 4 8553
+byte 4 8569
+byte 4 8554
+byte 4 8570
+byte 4 8555
+byte 4 8571
+byte 4 8556
+byte 4 8572
+byte 4 8557
+byte 4 8573
+byte 4 8558
+byte 4 8574
+byte 4 8559
+byte 4 8575
+byte 4 8579
+byte 4 8580
+byte 4 9398
+byte 4 9424
+byte 4 9399
+byte 4 9425
+byte 4 9400
+byte 4 9426
+byte 4 9401
+byte 4 9427
+byte 4 9402
+byte 4 9428
+byte 4 9403
+byte 4 9429
+byte 4 9404
+byte 4 9430
+byte 4 9405
+byte 4 9431
+byte 4 9406
+byte 4 9432
+byte 4 9407
+byte 4 9433
+byte 4 9408
+byte 4 9434
+byte 4 9409
+byte 4 9435
+byte 4 9410
+byte 4 9436
+byte 4 9411
+byte 4 9437
+byte 4 9412
+byte 4 9438
+byte 4 9413
+byte 4 9439
+byte 4 9414
+byte 4 9440
+byte 4 9415
+byte 4 9441
+byte 4 9416
+byte 4 9442
+byte 4 9417
+byte 4 9443
+byte 4 9418
+byte 4 9444
+byte 4 9419
+byte 4 9445
+byte 4 9420
+byte 4 9446
+byte 4 9421
+byte 4 9447
+byte 4 9422
+byte 4 9448
+byte 4 9423
+byte 4 9449
+byte 4 11264
+byte 4 11312
+byte 4 11265
+byte 4 11313
+byte 4 11266
+byte 4 11314
+byte 4 11267
+byte 4 11315
+byte 4 11268
+byte 4 11316
+byte 4 11269
+byte 4 11317
+byte 4 11270
+byte 4 11318
+byte 4 11271
+byte 4 11319
+byte 4 11272
+byte 4 11320
+byte 4 11273
+byte 4 11321
+byte 4 11274
+byte 4 11322
+byte 4 11275
+byte 4 11323
+byte 4 11276
+byte 4 11324
+byte 4 11277
+byte 4 11325
+byte 4 11278
+byte 4 11326
+byte 4 11279
+byte 4 11327
+byte 4 11280
+byte 4 11328
+byte 4 11281
+byte 4 11329
+byte 4 11282
+byte 4 11330
+byte 4 11283
+byte 4 11331
+byte 4 11284
+byte 4 11332
+byte 4 11285
+byte 4 11333
+byte 4 11286
+byte 4 11334
+byte 4 11287
+byte 4 11335
+byte 4 11288
+byte 4 11336
+byte 4 11289
+byte 4 11337
+byte 4 11290
+byte 4 11338
+byte 4 11291
+byte 4 11339
+byte 4 11292
+byte 4 11340
+byte 4 11293
+byte 4 11341
+byte 4 11294
+byte 4 11342
+byte 4 11295
+byte 4 11343
+byte 4 11296
+byte 4 11344
+byte 4 11297
+byte 4 11345
+byte 4 11298
+byte 4 11346
+byte 4 11299
+byte 4 11347
+byte 4 11300
+byte 4 11348
+byte 4 11301
+byte 4 11349
+byte 4 11302
+byte 4 11350
+byte 4 11303
+byte 4 11351
+byte 4 11304
+byte 4 11352
+byte 4 11305
+byte 4 11353
+byte 4 11306
+byte 4 11354
+byte 4 11307
+byte 4 11355
+byte 4 11308
+byte 4 11356
+byte 4 11309
+byte 4 11357
+byte 4 11310
+byte 4 11358
+byte 4 11360
+byte 4 11361
+byte 4 11362
+byte 4 619
+byte 4 11363
+byte 4 7549
+byte 4 11364
+byte 4 637
+byte 4 11367
+byte 4 11368
+byte 4 11369
+byte 4 11370
+byte 4 11371
+byte 4 11372
+byte 4 11373
+byte 4 593
+byte 4 11374
+byte 4 625
+byte 4 11375
+byte 4 592
+byte 4 11378
+byte 4 11379
+byte 4 11381
+byte 4 11382
+byte 4 11392
+byte 4 11393
+byte 4 11394
+byte 4 11395
+byte 4 11396
+byte 4 11397
+byte 4 11398
+byte 4 11399
+byte 4 11400
+byte 4 11401
+byte 4 11402
+byte 4 11403
+byte 4 11404
+byte 4 11405
+byte 4 11406
+byte 4 11407
+byte 4 11408
+byte 4 11409
+byte 4 11410
+byte 4 11411
+byte 4 11412
+byte 4 11413
+byte 4 11414
+byte 4 11415
+byte 4 11416
+byte 4 11417
+byte 4 11418
+byte 4 11419
+byte 4 11420
+byte 4 11421
+byte 4 11422
+byte 4 11423
+byte 4 11424
+byte 4 11425
+byte 4 11426
+byte 4 11427
+byte 4 11428
+byte 4 11429
+byte 4 11430
+byte 4 11431
+byte 4 11432
+byte 4 11433
+byte 4 11434
+byte 4 11435
+byte 4 11436
+byte 4 11437
+byte 4 11438
+byte 4 11439
+byte 4 11440
+byte 4 11441
+byte 4 11442
+byte 4 11443
+byte 4 11444
+byte 4 11445
+byte 4 11446
+byte 4 11447
+byte 4 11448
+byte 4 11449
+byte 4 11450
+byte 4 11451
+byte 4 11452
+byte 4 11453
+byte 4 11454
+byte 4 11455
+byte 4 11456
+byte 4 11457
+byte 4 11458
+byte 4 11459
+byte 4 11460
+byte 4 11461
+byte 4 11462
+byte 4 11463
+byte 4 11464
+byte 4 11465
+byte 4 11466
+byte 4 11467
+byte 4 11468
+byte 4 11469
+byte 4 11470
+byte 4 11471
+byte 4 11472
+byte 4 11473
+byte 4 11474
+byte 4 11475
+byte 4 11476
+byte 4 11477
+byte 4 11478
+byte 4 11479
+byte 4 11480
+byte 4 11481
+byte 4 11482
+byte 4 11483
+byte 4 11484
+byte 4 11485
+byte 4 11486
+byte 4 11487
+byte 4 11488
+byte 4 11489
+byte 4 11490
+byte 4 11491
+byte 4 42560
+byte 4 42561
+byte 4 42562
+byte 4 42563
+byte 4 42564
+byte 4 42565
+byte 4 42566
+byte 4 42567
+byte 4 42568
+byte 4 42569
+byte 4 42570
+byte 4 42571
+byte 4 42572
+byte 4 42573
+byte 4 42574
+byte 4 42575
+byte 4 42576
+byte 4 42577
+byte 4 42578
+byte 4 42579
+byte 4 42580
+byte 4 42581
+byte 4 42582
+byte 4 42583
+byte 4 42584
+byte 4 42585
+byte 4 42586
+byte 4 42587
+byte 4 42588
+byte 4 42589
+byte 4 42590
+byte 4 42591
+byte 4 42594
+byte 4 42595
+byte 4 42596
+byte 4 42597
+byte 4 42598
+byte 4 42599
+byte 4 42600
+byte 4 42601
+byte 4 42602
+byte 4 42603
+byte 4 42604
+byte 4 42605
+byte 4 42624
+byte 4 42625
+byte 4 42626
+byte 4 42627
+byte 4 42628
+byte 4 42629
+byte 4 42630
+byte 4 42631
+byte 4 42632
+byte 4 42633
+byte 4 42634
+byte 4 42635
+byte 4 42636
+byte 4 42637
+byte 4 42638
+byte 4 42639
+byte 4 42640
+byte 4 42641
+byte 4 42642
+byte 4 42643
+byte 4 42644
+byte 4 42645
+byte 4 42646
+byte 4 42647
+byte 4 42786
+byte 4 42787
+byte 4 42788
+byte 4 42789
+byte 4 42790
+byte 4 42791
+byte 4 42792
+byte 4 42793
+byte 4 42794
+byte 4 42795
+byte 4 42796
+byte 4 42797
+byte 4 42798
+byte 4 42799
+byte 4 42802
+byte 4 42803
+byte 4 42804
+byte 4 42805
+byte 4 42806
+byte 4 42807
+byte 4 42808
+byte 4 42809
+byte 4 42810
+byte 4 42811
+byte 4 42812
+byte 4 42813
+byte 4 42814
+byte 4 42815
+byte 4 42816
+byte 4 42817
+byte 4 42818
+byte 4 42819
+byte 4 42820
+byte 4 42821
+byte 4 42822
+byte 4 42823
+byte 4 42824
+byte 4 42825
+byte 4 42826
+byte 4 42827
+byte 4 42828
+byte 4 42829
+byte 4 42830
+byte 4 42831
+byte 4 42832
+byte 4 42833
+byte 4 42834
+byte 4 42835
+byte 4 42836
+byte 4 42837
+byte 4 42838
+byte 4 42839
+byte 4 42840
+byte 4 42841
+byte 4 42842
+byte 4 42843
+byte 4 42844
+byte 4 42845
+byte 4 42846
+byte 4 42847
+byte 4 42848
+byte 4 42849
+byte 4 42850
+byte 4 42851
+byte 4 42852
+byte 4 42853
+byte 4 42854
+byte 4 42855
+byte 4 42856
+byte 4 42857
+byte 4 42858
+byte 4 42859
+byte 4 42860
+byte 4 42861
+byte 4 42862
+byte 4 42863
+byte 4 42873
+byte 4 42874
+byte 4 42875
+byte 4 42876
+byte 4 42877
+byte 4 7545
+byte 4 42878
+byte 4 42879
+byte 4 42880
+byte 4 42881
+byte 4 42882
+byte 4 42883
+byte 4 42884
+byte 4 42885
+byte 4 42886
+byte 4 42887
+byte 4 42891
+byte 4 42892
+byte 4 65313
+byte 4 65345
+byte 4 65314
+byte 4 65346
+byte 4 65315
+byte 4 65347
+byte 4 65316
+byte 4 65348
+byte 4 65317
+byte 4 65349
+byte 4 65318
+byte 4 65350
+byte 4 65319
+byte 4 65351
+byte 4 65320
+byte 4 65352
+byte 4 65321
+byte 4 65353
+byte 4 65322
+byte 4 65354
+byte 4 65323
+byte 4 65355
+byte 4 65324
+byte 4 65356
+byte 4 65325
+byte 4 65357
+byte 4 65326
+byte 4 65358
+byte 4 65327
+byte 4 65359
+byte 4 65328
+byte 4 65360
+byte 4 65329
+byte 4 65361
+byte 4 65330
+byte 4 65362
+byte 4 65331
+byte 4 65363
+byte 4 65332
+byte 4 65364
+byte 4 65333
+byte 4 65365
+byte 4 65334
+byte 4 65366
+byte 4 65335
+byte 4 65367
+byte 4 65336
+byte 4 65368
+byte 4 65337
+byte 4 65369
+byte 4 65338
+byte 4 65370
+align 4
+LABELV uc_case_upper
+byte 4 97
+byte 4 65
+byte 4 98
+byte 4 66
+byte 4 99
+byte 4 67
+byte 4 100
+byte 4 68
+byte 4 101
+byte 4 69
+byte 4 102
+byte 4 70
+byte 4 103
+byte 4 71
+byte 4 104
+byte 4 72
+byte 4 105
+byte 4 73
+byte 4 106
+byte 4 74
+byte 4 107
+byte 4 75
+byte 4 108
+byte 4 76
+byte 4 109
+byte 4 77
+byte 4 110
+byte 4 78
+byte 4 111
+byte 4 79
+byte 4 112
+byte 4 80
+byte 4 113
+byte 4 81
+byte 4 114
+byte 4 82
+byte 4 115
+byte 4 83
+byte 4 116
+byte 4 84
+byte 4 117
+byte 4 85
+byte 4 118
+byte 4 86
+byte 4 119
+byte 4 87
+byte 4 120
+byte 4 88
+byte 4 121
+byte 4 89
+byte 4 122
+byte 4 90
+byte 4 181
+byte 4 924
+byte 4 224
+byte 4 192
+byte 4 225
+byte 4 193
+byte 4 226
+byte 4 194
+byte 4 227
+byte 4 195
+byte 4 228
+byte 4 196
+byte 4 229
+byte 4 197
+byte 4 230
+byte 4 198
+byte 4 231
+byte 4 199
+byte 4 232
+byte 4 200
+byte 4 233
+byte 4 201
+byte 4 234
+byte 4 202
+byte 4 235
+byte 4 203
+byte 4 236
+byte 4 204
+byte 4 237
+byte 4 205
+byte 4 238
+byte 4 206
+byte 4 239
+byte 4 207
+byte 4 240
+byte 4 208
+byte 4 241
+byte 4 209
+byte 4 242
+byte 4 210
+byte 4 243
+byte 4 211
+byte 4 244
+byte 4 212
+byte 4 245
+byte 4 213
+byte 4 246
+byte 4 214
+byte 4 248
+byte 4 216
+byte 4 249
+byte 4 217
+byte 4 250
+byte 4 218
+byte 4 251
+byte 4 219
+byte 4 252
+byte 4 220
+byte 4 253
+byte 4 221
+byte 4 254
+byte 4 222
+byte 4 255
+byte 4 376
+byte 4 257
+byte 4 256
+byte 4 259
+byte 4 258
+byte 4 261
+byte 4 260
+byte 4 263
+byte 4 262
+byte 4 265
+byte 4 264
+byte 4 267
+byte 4 266
+byte 4 269
+byte 4 268
+byte 4 271
+byte 4 270
+byte 4 273
+byte 4 272
+byte 4 275
+byte 4 274
+byte 4 277
+byte 4 276
+byte 4 279
+byte 4 278
+byte 4 281
+byte 4 280
+byte 4 283
+byte 4 282
+byte 4 285
+byte 4 284
+byte 4 287
+byte 4 286
+byte 4 289
+byte 4 288
+byte 4 291
+byte 4 290
+byte 4 293
+byte 4 292
+byte 4 295
+byte 4 294
+byte 4 297
+byte 4 296
+byte 4 299
+byte 4 298
+byte 4 301
+byte 4 300
+byte 4 303
+byte 4 302
+byte 4 305
+byte 4 73
+byte 4 307
+byte 4 306
+byte 4 309
+byte 4 308
+byte 4 311
+byte 4 310
+byte 4 314
+byte 4 313
+byte 4 316
+byte 4 315
+byte 4 318
+byte 4 317
+byte 4 320
+byte 4 319
+byte 4 322
+byte 4 321
+byte 4 324
+byte 4 323
+byte 4 326
+byte 4 325
+byte 4 328
+byte 4 327
+byte 4 331
+byte 4 330
+byte 4 333
+byte 4 332
+byte 4 335
+byte 4 334
+byte 4 337
+byte 4 336
+byte 4 339
+byte 4 338
+byte 4 341
+byte 4 340
+byte 4 343
+byte 4 342
+byte 4 345
+byte 4 344
+byte 4 347
+byte 4 346
+byte 4 349
+byte 4 348
+byte 4 351
+byte 4 350
+byte 4 353
+byte 4 352
+byte 4 355
+byte 4 354
+byte 4 357
+byte 4 356
+byte 4 359
+byte 4 358
+byte 4 361
+byte 4 360
+byte 4 363
+byte 4 362
+byte 4 365
+byte 4 364
+byte 4 367
+byte 4 366
+byte 4 369
+byte 4 368
+byte 4 371
+byte 4 370
+byte 4 373
+byte 4 372
+byte 4 375
+byte 4 374
+byte 4 378
+byte 4 377
+byte 4 380
+byte 4 379
+byte 4 382
+byte 4 381
+byte 4 383
+byte 4 83
+byte 4 384
+byte 4 579
+byte 4 387
+byte 4 386
+byte 4 389
+byte 4 388
+byte 4 392
+byte 4 391
+byte 4 396
+byte 4 395
+byte 4 402
+byte 4 401
+byte 4 405
+byte 4 502
+byte 4 409
+byte 4 408
+byte 4 410
+byte 4 573
+byte 4 414
+byte 4 544
+byte 4 417
+byte 4 416
+byte 4 419
+byte 4 418
+byte 4 421
+byte 4 420
+byte 4 424
+byte 4 423
+byte 4 429
+byte 4 428
+byte 4 432
+byte 4 431
+byte 4 436
+byte 4 435
+byte 4 438
+byte 4 437
+byte 4 441
+byte 4 440
+byte 4 445
+byte 4 444
+byte 4 447
+byte 4 503
+byte 4 453
+byte 4 452
+byte 4 454
+byte 4 452
+byte 4 456
+byte 4 455
+byte 4 457
+byte 4 455
+byte 4 459
+byte 4 458
+byte 4 460
+byte 4 458
+byte 4 462
+byte 4 461
+byte 4 464
+byte 4 463
+byte 4 466
+byte 4 465
+byte 4 468
+byte 4 467
+byte 4 470
+byte 4 469
+byte 4 472
+byte 4 471
+byte 4 474
+byte 4 473
+byte 4 476
+byte 4 475
+byte 4 477
+byte 4 398
+byte 4 479
+byte 4 478
+byte 4 481
+byte 4 480
+byte 4 483
+byte 4 482
+byte 4 485
+byte 4 484
+byte 4 487
+byte 4 486
+byte 4 489
+byte 4 488
+byte 4 491
+byte 4 490
+byte 4 493
+byte 4 492
+byte 4 495
+byte 4 494
+byte 4 498
+byte 4 497
+byte 4 499
+byte 4 497
+byte 4 501
+byte 4 500
+byte 4 505
+byte 4 504
+byte 4 507
+byte 4 506
+byte 4 509
+byte 4 508
+byte 4 511
+byte 4 510
+byte 4 513
+byte 4 512
+byte 4 515
+byte 4 514
+byte 4 517
+byte 4 516
+byte 4 519
+byte 4 518
+byte 4 521
+byte 4 520
+byte 4 523
+byte 4 522
+byte 4 525
+byte 4 524
+byte 4 527
+byte 4 526
+byte 4 529
+byte 4 528
+byte 4 531
+byte 4 530
+byte 4 533
+byte 4 532
+byte 4 535
+byte 4 534
+byte 4 537
+byte 4 536
+byte 4 539
+byte 4 538
+byte 4 541
+byte 4 540
+byte 4 543
+byte 4 542
+byte 4 547
+byte 4 546
+byte 4 549
+byte 4 548
+byte 4 551
+byte 4 550
+byte 4 553
+byte 4 552
+byte 4 555
+byte 4 554
+byte 4 557
+byte 4 556
+byte 4 559
+byte 4 558
+byte 4 561
+byte 4 560
+byte 4 563
+byte 4 562
+byte 4 572
+byte 4 571
+byte 4 578
+byte 4 577
+byte 4 583
+byte 4 582
+byte 4 585
+byte 4 584
+byte 4 587
+byte 4 586
+byte 4 589
+byte 4 588
+byte 4 591
+byte 4 590
+byte 4 592
+byte 4 11375
+byte 4 593
+byte 4 11373
+byte 4 595
+byte 4 385
+byte 4 596
+byte 4 390
+byte 4 598
+byte 4 393
+byte 4 599
+byte 4 394
+byte 4 601
+byte 4 399
+byte 4 603
+byte 4 400
+byte 4 608
+byte 4 403
+byte 4 611
+byte 4 404
+byte 4 616
+byte 4 407
+byte 4 617
+byte 4 406
+byte 4 619
+byte 4 11362
+byte 4 623
+byte 4 412
+byte 4 625
+byte 4 11374
+byte 4 626
+byte 4 413
+byte 4 629
+byte 4 415
+byte 4 637
+byte 4 11364
+byte 4 640
+byte 4 422
+byte 4 643
+byte 4 425
+byte 4 648
+byte 4 430
+byte 4 649
+byte 4 580
+byte 4 650
+byte 4 433
+byte 4 651
+byte 4 434
+byte 4 652
+byte 4 581
+byte 4 658
+byte 4 439
+byte 4 837
+byte 4 921
+byte 4 881
+byte 4 880
+byte 4 883
+byte 4 882
+byte 4 887
+byte 4 886
+byte 4 891
+byte 4 1021
+byte 4 892
+byte 4 1022
+byte 4 893
+byte 4 1023
+byte 4 940
+byte 4 902
+byte 4 941
+byte 4 904
+byte 4 942
+byte 4 905
+byte 4 943
+byte 4 906
+byte 4 945
+byte 4 913
+byte 4 946
+byte 4 914
+byte 4 947
+byte 4 915
+byte 4 948
+byte 4 916
+byte 4 949
+byte 4 917
+byte 4 950
+byte 4 918
+byte 4 951
+byte 4 919
+byte 4 952
+byte 4 920
+byte 4 953
+byte 4 921
+byte 4 954
+byte 4 922
+byte 4 955
+byte 4 923
+byte 4 956
+byte 4 924
+byte 4 957
+byte 4 925
+byte 4 958
+byte 4 926
+byte 4 959
+byte 4 927
+byte 4 960
+byte 4 928
+byte 4 961
+byte 4 929
+byte 4 962
+byte 4 931
+byte 4 963
+byte 4 931
+byte 4 964
+byte 4 932
+byte 4 965
+byte 4 933
+byte 4 966
+byte 4 934
+byte 4 967
+byte 4 935
+byte 4 968
+byte 4 936
+byte 4 969
+byte 4 937
+byte 4 970
+byte 4 938
+byte 4 971
+byte 4 939
+byte 4 972
+byte 4 908
+byte 4 973
+byte 4 910
+byte 4 974
+byte 4 911
+byte 4 976
+byte 4 914
+byte 4 977
+byte 4 920
+byte 4 981
+byte 4 934
+byte 4 982
+byte 4 928
+byte 4 983
+byte 4 975
+byte 4 985
+byte 4 984
+byte 4 987
+byte 4 986
+byte 4 989
+byte 4 988
+byte 4 991
+byte 4 990
+byte 4 993
+byte 4 992
+byte 4 995
+byte 4 994
+byte 4 997
+byte 4 996
+byte 4 999
+byte 4 998
+byte 4 1001
+byte 4 1000
+byte 4 1003
+byte 4 1002
+byte 4 1005
+byte 4 1004
+byte 4 1007
+byte 4 1006
+byte 4 1008
+byte 4 922
+byte 4 1009
+byte 4 929
+byte 4 1010
+byte 4 1017
+byte 4 1013
+byte 4 917
+byte 4 1016
+byte 4 1015
+byte 4 1019
+byte 4 1018
+byte 4 1072
+byte 4 1040
+byte 4 1073
+byte 4 1041
+byte 4 1074
+byte 4 1042
+byte 4 1075
+byte 4 1043
+byte 4 1076
+byte 4 1044
+byte 4 1077
+byte 4 1045
+byte 4 1078
+byte 4 1046
+byte 4 1079
+byte 4 1047
+byte 4 1080
+byte 4 1048
+byte 4 1081
+byte 4 1049
+byte 4 1082
+byte 4 1050
+byte 4 1083
+byte 4 1051
+byte 4 1084
+byte 4 1052
+byte 4 1085
+byte 4 1053
+byte 4 1086
+byte 4 1054
+byte 4 1087
+byte 4 1055
+byte 4 1088
+byte 4 1056
+byte 4 1089
+byte 4 1057
+byte 4 1090
+byte 4 1058
+byte 4 1091
+byte 4 1059
+byte 4 1092
+byte 4 1060
+byte 4 1093
+byte 4 1061
+byte 4 1094
+byte 4 1062
+byte 4 1095
+byte 4 1063
+byte 4 1096
+byte 4 1064
+byte 4 1097
+byte 4 1065
+byte 4 1098
+byte 4 1066
+byte 4 1099
+byte 4 1067
+byte 4 1100
+byte 4 1068
+byte 4 1101
+byte 4 1069
+byte 4 1102
+byte 4 1070
+byte 4 1103
+byte 4 1071
+byte 4 1104
+byte 4 1024
+byte 4 1105
+byte 4 1025
+byte 4 1106
+byte 4 1026
+byte 4 1107
+byte 4 1027
+byte 4 1108
+byte 4 1028
+byte 4 1109
+byte 4 1029
+byte 4 1110
+byte 4 1030
+byte 4 1111
+byte 4 1031
+byte 4 1112
+byte 4 1032
+byte 4 1113
+byte 4 1033
+byte 4 1114
+byte 4 1034
+byte 4 1115
+byte 4 1035
+byte 4 1116
+byte 4 1036
+byte 4 1117
+byte 4 1037
+byte 4 1118
+byte 4 1038
+byte 4 1119
+byte 4 1039
+byte 4 1121
+byte 4 1120
+byte 4 1123
+byte 4 1122
+byte 4 1125
+byte 4 1124
+byte 4 1127
+byte 4 1126
+byte 4 1129
+byte 4 1128
+byte 4 1131
+byte 4 1130
+byte 4 1133
+byte 4 1132
+byte 4 1135
+byte 4 1134
+byte 4 1137
+byte 4 1136
+byte 4 1139
+byte 4 1138
+byte 4 1141
+byte 4 1140
+byte 4 1143
+byte 4 1142
+byte 4 1145
+byte 4 1144
+byte 4 1147
+byte 4 1146
+byte 4 1149
+byte 4 1148
+byte 4 1151
+byte 4 1150
+byte 4 1153
+byte 4 1152
+byte 4 1163
+byte 4 1162
+byte 4 1165
+byte 4 1164
+byte 4 1167
+byte 4 1166
+byte 4 1169
+byte 4 1168
+byte 4 1171
+byte 4 1170
+byte 4 1173
+byte 4 1172
+byte 4 1175
+byte 4 1174
+byte 4 1177
+byte 4 1176
+byte 4 1179
+byte 4 1178
+byte 4 1181
+byte 4 1180
+byte 4 1183
+byte 4 1182
+byte 4 1185
+byte 4 1184
+byte 4 1187
+byte 4 1186
+byte 4 1189
+byte 4 1188
+byte 4 1191
+byte 4 1190
+byte 4 1193
+byte 4 1192
+byte 4 1195
+byte 4 1194
+byte 4 1197
+byte 4 1196
+byte 4 1199
+byte 4 1198
+byte 4 1201
+byte 4 1200
+byte 4 1203
+byte 4 1202
+byte 4 1205
+byte 4 1204
+byte 4 1207
+byte 4 1206
+byte 4 1209
+byte 4 1208
+byte 4 1211
+byte 4 1210
+byte 4 1213
+byte 4 1212
+byte 4 1215
+byte 4 1214
+byte 4 1218
+byte 4 1217
+byte 4 1220
+byte 4 1219
+byte 4 1222
+byte 4 1221
+byte 4 1224
+byte 4 1223
+byte 4 1226
+byte 4 1225
+byte 4 1228
+byte 4 1227
+byte 4 1230
+byte 4 1229
+byte 4 1231
+byte 4 1216
+byte 4 1233
+byte 4 1232
+byte 4 1235
+byte 4 1234
+byte 4 1237
+byte 4 1236
+byte 4 1239
+byte 4 1238
+byte 4 1241
+byte 4 1240
+byte 4 1243
+byte 4 1242
+byte 4 1245
+byte 4 1244
+byte 4 1247
+byte 4 1246
+byte 4 1249
+byte 4 1248
+byte 4 1251
+byte 4 1250
+byte 4 1253
+byte 4 1252
+byte 4 1255
+byte 4 1254
+byte 4 1257
+byte 4 1256
+byte 4 1259
+byte 4 1258
+byte 4 1261
+byte 4 1260
+byte 4 1263
+byte 4 1262
+byte 4 1265
+byte 4 1264
+byte 4 1267
+byte 4 1266
+byte 4 1269
+byte 4 1268
+byte 4 1271
+byte 4 1270
+byte 4 1273
+byte 4 1272
+byte 4 1275
+byte 4 1274
+byte 4 1277
+byte 4 1276
+byte 4 1279
+byte 4 1278
+byte 4 1281
+byte 4 1280
+byte 4 1283
+byte 4 1282
+byte 4 1285
+byte 4 1284
+byte 4 1287
+byte 4 1286
+byte 4 1289
+byte 4 1288
+byte 4 1291
+byte 4 1290
+byte 4 1293
+byte 4 1292
+byte 4 1295
+byte 4 1294
+byte 4 1297
+byte 4 1296
+byte 4 1299
+byte 4 1298
+byte 4 1301
+byte 4 1300
+byte 4 1303
+byte 4 1302
+byte 4 1305
+byte 4 1304
+byte 4 1307
+byte 4 1306
+byte 4 1309
+byte 4 1308
+byte 4 1311
+byte 4 1310
+byte 4 1313
+byte 4 1312
+byte 4 1315
+byte 4 1314
+byte 4 1377
+byte 4 1329
+byte 4 1378
+byte 4 1330
+byte 4 1379
+byte 4 1331
+byte 4 1380
+byte 4 1332
+byte 4 1381
+byte 4 1333
+byte 4 1382
+byte 4 1334
+byte 4 1383
+byte 4 1335
+byte 4 1384
+byte 4 1336
+byte 4 1385
+byte 4 1337
+byte 4 1386
+byte 4 1338
+byte 4 1387
+byte 4 1339
+byte 4 1388
+byte 4 1340
+byte 4 1389
+byte 4 1341
+byte 4 1390
+byte 4 1342
+byte 4 1391
+byte 4 1343
+byte 4 1392
+byte 4 1344
+byte 4 1393
+byte 4 1345
+byte 4 1394
+byte 4 1346
+byte 4 1395
+byte 4 1347
+byte 4 1396
+byte 4 1348
+byte 4 1397
+byte 4 1349
+byte 4 1398
+byte 4 1350
+byte 4 1399
+byte 4 1351
+byte 4 1400
+byte 4 1352
+byte 4 1401
+byte 4 1353
+byte 4 1402
+byte 4 1354
+byte 4 1403
+byte 4 1355
+byte 4 1404
+byte 4 1356
+byte 4 1405
+byte 4 1357
+byte 4 1406
+byte 4 1358
+byte 4 1407
+byte 4 1359
+byte 4 1408
+byte 4 1360
+byte 4 1409
+byte 4 1361
+byte 4 1410
+byte 4 1362
+byte 4 1411
+byte 4 1363
+byte 4 1412
+byte 4 1364
+byte 4 1413
+byte 4 1365
+byte 4 1414
+byte 4 1366
+byte 4 7545
+byte 4 42877
+byte 4 7549
+byte 4 11363
+byte 4 7681
+byte 4 7680
+byte 4 7683
+byte 4 7682
+byte 4 7685
+byte 4 7684
+byte 4 7687
+byte 4 7686
+byte 4 7689
+byte 4 7688
+byte 4 7691
+byte 4 7690
+byte 4 7693
+byte 4 7692
+byte 4 7695
+byte 4 7694
+byte 4 7697
+byte 4 7696
+byte 4 7699
+byte 4 7698
+byte 4 7701
+byte 4 7700
+byte 4 7703
+byte 4 7702
+byte 4 7705
+byte 4 7704
+byte 4 7707
+byte 4 7706
+byte 4 7709
+byte 4 7708
+byte 4 7711
+byte 4 7710
+byte 4 7713
+byte 4 7712
+byte 4 7715
+byte 4 7714
+byte 4 7717
+byte 4 7716
+byte 4 7719
+byte 4 7718
+byte 4 7721
+byte 4 7720
+byte 4 7723
+byte 4 7722
+byte 4 7725
+byte 4 7724
+byte 4 7727
+byte 4 7726
+byte 4 7729
+byte 4 7728
+byte 4 7731
+byte 4 7730
+byte 4 7733
+byte 4 7732
+byte 4 7735
+byte 4 7734
+byte 4 7737
+byte 4 7736
+byte 4 7739
+byte 4 7738
+byte 4 7741
+byte 4 7740
+byte 4 7743
+byte 4 7742
+byte 4 7745
+byte 4 7744
+byte 4 7747
+byte 4 7746
+byte 4 7749
+byte 4 7748
+byte 4 7751
+byte 4 7750
+byte 4 7753
+byte 4 7752
+byte 4 7755
+byte 4 7754
+byte 4 7757
+byte 4 7756
+byte 4 7759
+byte 4 7758
+byte 4 7761
+byte 4 7760
+byte 4 7763
+byte 4 7762
+byte 4 7765
+byte 4 7764
+byte 4 7767
+byte 4 7766
+byte 4 7769
+byte 4 7768
+byte 4 7771
+byte 4 7770
+byte 4 7773
+byte 4 7772
+byte 4 7775
+byte 4 7774
+byte 4 7777
+byte 4 7776
+byte 4 7779
+byte 4 7778
+byte 4 7781
+byte 4 7780
+byte 4 7783
+byte 4 7782
+byte 4 7785
+byte 4 7784
+byte 4 7787
+byte 4 7786
+byte 4 7789
+byte 4 7788
+byte 4 7791
+byte 4 7790
+byte 4 7793
+byte 4 7792
+byte 4 7795
+byte 4 7794
+byte 4 7797
+byte 4 7796
+byte 4 7799
+byte 4 7798
+byte 4 7801
+byte 4 7800
+byte 4 7803
+byte 4 7802
+byte 4 7805
+byte 4 7804
+byte 4 7807
+byte 4 7806
+byte 4 7809
+byte 4 7808
+byte 4 7811
+byte 4 7810
+byte 4 7813
+byte 4 7812
+byte 4 7815
+byte 4 7814
+byte 4 7817
+byte 4 7816
+byte 4 7819
+byte 4 7818
+byte 4 7821
+byte 4 7820
+byte 4 7823
+byte 4 7822
+byte 4 7825
+byte 4 7824
+byte 4 7827
+byte 4 7826
+byte 4 7829
+byte 4 7828
+byte 4 7835
+byte 4 7776
+byte 4 7841
+byte 4 7840
+byte 4 7843
+byte 4 7842
+byte 4 7845
+byte 4 7844
+byte 4 7847
+byte 4 7846
+byte 4 7849
+byte 4 7848
+byte 4 7851
+byte 4 7850
+byte 4 7853
+byte 4 7852
+byte 4 7855
+byte 4 7854
+byte 4 7857
+byte 4 7856
+byte 4 7859
+byte 4 7858
+byte 4 7861
+byte 4 7860
+byte 4 7863
+byte 4 7862
+byte 4 7865
+byte 4 7864
+byte 4 7867
+byte 4 7866
+byte 4 7869
+byte 4 7868
+byte 4 7871
+byte 4 7870
+byte 4 7873
+byte 4 7872
+byte 4 7875
+byte 4 7874
+byte 4 7877
+byte 4 7876
+byte 4 7879
+byte 4 7878
+byte 4 7881
+byte 4 7880
+byte 4 7883
+byte 4 7882
+byte 4 7885
+byte 4 7884
+byte 4 7887
+byte 4 7886
+byte 4 7889
+byte 4 7888
+byte 4 7891
+byte 4 7890
+byte 4 7893
+byte 4 7892
+byte 4 7895
+byte 4 7894
+byte 4 7897
+byte 4 7896
+byte 4 7899
+byte 4 7898
+byte 4 7901
+byte 4 7900
+byte 4 7903
+byte 4 7902
+byte 4 7905
+byte 4 7904
+byte 4 7907
+byte 4 7906
+byte 4 7909
+byte 4 7908
+byte 4 7911
+byte 4 7910
+byte 4 7913
+byte 4 7912
+byte 4 7915
+byte 4 7914
+byte 4 7917
+byte 4 7916
+byte 4 7919
+byte 4 7918
+byte 4 7921
+byte 4 7920
+byte 4 7923
+byte 4 7922
+byte 4 7925
+byte 4 7924
+byte 4 7927
+byte 4 7926
+byte 4 7929
+byte 4 7928
+byte 4 7931
+byte 4 7930
+byte 4 7933
+byte 4 7932
+byte 4 7935
+byte 4 7934
+byte 4 7936
+byte 4 7944
+byte 4 7937
+byte 4 7945
+byte 4 7938
+byte 4 7946
+byte 4 7939
+byte 4 7947
+byte 4 7940
+byte 4 7948
+byte 4 7941
+byte 4 7949
+byte 4 7942
+byte 4 7950
+byte 4 7943
+byte 4 7951
+byte 4 7952
+byte 4 7960
+byte 4 7953
+byte 4 7961
+byte 4 7954
+byte 4 7962
+byte 4 7955
+byte 4 7963
+byte 4 7956
+byte 4 7964
+byte 4 7957
+byte 4 7965
+byte 4 7968
+byte 4 7976
+byte 4 7969
+byte 4 7977
+byte 4 7970
+byte 4 7978
+byte 4 7971
+byte 4 7979
+byte 4 7972
+byte 4 7980
+byte 4 7973
+byte 4 7981
+byte 4 7974
+byte 4 7982
+byte 4 7975
+byte 4 7983
+byte 4 7984
+byte 4 7992
+byte 4 7985
+byte 4 7993
+byte 4 7986
+byte 4 7994
+byte 4 7987
+byte 4 7995
+byte 4 7988
+byte 4 7996
+byte 4 7989
+byte 4 7997
+byte 4 7990
+byte 4 7998
+byte 4 7991
+byte 4 7999
+byte 4 8000
+byte 4 8008
+byte 4 8001
+byte 4 8009
+byte 4 8002
+byte 4 8010
+byte 4 8003
+byte 4 8011
+byte 4 8004
+byte 4 8012
+byte 4 8005
+byte 4 8013
+byte 4 8017
+byte 4 8025
+byte 4 8019
+byte 4 8027
+byte 4 8021
+byte 4 8029
+byte 4 8023
+byte 4 8031
+byte 4 8032
+byte 4 8040
+byte 4 8033
+byte 4 8041
+byte 4 8034
+byte 4 8042
+byte 4 8035
+byte 4 8043
+byte 4 8036
+byte 4 8044
+byte 4 8037
+byte 4 8045
+byte 4 8038
+byte 4 8046
+byte 4 8039
+byte 4 8047
+byte 4 8048
+byte 4 8122
+byte 4 8049
+byte 4 8123
+byte 4 8050
+byte 4 8136
+byte 4 8051
+byte 4 8137
+byte 4 8052
+byte 4 8138
+byte 4 8053
+byte 4 8139
+byte 4 8054
+byte 4 8154
+byte 4 8055
+byte 4 8155
+byte 4 8056
+byte 4 8184
+byte 4 8057
+byte 4 8185
+byte 4 8058
+byte 4 8170
+byte 4 8059
+byte 4 8171
+byte 4 8060
+byte 4 8186
+byte 4 8061
+byte 4 8187
+byte 4 8064
+byte 4 8072
+byte 4 8065
+byte 4 8073
+byte 4 8066
+byte 4 8074
+byte 4 8067
+byte 4 8075
+byte 4 8068
+byte 4 8076
+byte 4 8069
+byte 4 8077
+byte 4 8070
+byte 4 8078
+byte 4 8071
+byte 4 8079
+byte 4 8080
+byte 4 8088
+byte 4 8081
+byte 4 8089
+byte 4 8082
+byte 4 8090
+byte 4 8083
+byte 4 8091
+byte 4 8084
+byte 4 8092
+byte 4 8085
+byte 4 8093
+byte 4 8086
+byte 4 8094
+byte 4 8087
+byte 4 8095
+byte 4 8096
+byte 4 8104
+byte 4 8097
+byte 4 8105
+byte 4 8098
+byte 4 8106
+byte 4 8099
+byte 4 8107
+byte 4 8100
+byte 4 8108
+byte 4 8101
+byte 4 8109
+byte 4 8102
+byte 4 8110
+byte 4 8103
+byte 4 8111
+byte 4 8112
+byte 4 8120
+byte 4 8113
+byte 4 8121
+byte 4 8115
+byte 4 8124
+byte 4 8126
+byte 4 921
+byte 4 8131
+byte 4 8140
+byte 4 8144
+byte 4 8152
+byte 4 8145
+byte 4 8153
+byte 4 8160
+byte 4 8168
+byte 4 8161
+byte 4 8169
+byte 4 8165
+byte 4 8172
+byte 4 8179
+byte 4 8188
+byte 4 8526
+byte 4 8498
+byte 4 8560
+byte 4 8544
+byte 4 8561
+byte 4 8545
+byte 4 8562
+byte 4 8546
+byte 4 8563
+byte 4 8547
+byte 4 8564
+byte 4 8548
+byte 4 8565
+byte 4 8549
+byte 4 8566
+byte 4 8550
+byte 4 8567
+byte 4 8551
+byte 4 8568
+byte 4 8552
+byte 4 8569
+byte 4 8553
+byte 4 8570
+byte 4 8554
+byte 4 8571
+byte 4 8555
+byte 4 8572
+byte 4 8556
+byte 4 8573
+byte 4 8557
+byte 4 8574
+byte 4 8558
+byte 4 8575
+byte 4 8559
+byte 4 8580
+byte 4 8579
+byte 4 9424
+byte 4 9398
+byte 4 9425
+byte 4 9399
+byte 4 9426
+byte 4 9400
+byte 4 9427
+byte 4 9401
+byte 4 9428
+byte 4 9402
+byte 4 9429
+byte 4 9403
+byte 4 9430
+byte 4 9404
+byte 4 9431
+byte 4 9405
+byte 4 9432
+byte 4 9406
+byte 4 9433
+byte 4 9407
+byte 4 9434
+byte 4 9408
+byte 4 9435
+byte 4 9409
+byte 4 9436
+byte 4 9410
+byte 4 9437
+byte 4 9411
+byte 4 9438
+byte 4 9412
+byte 4 9439
+byte 4 9413
+byte 4 9440
+byte 4 9414
+byte 4 9441
+byte 4 9415
+byte 4 9442
+byte 4 9416
+byte 4 9443
+byte 4 9417
+byte 4 9444
+byte 4 9418
+byte 4 9445
+byte 4 9419
+byte 4 9446
+byte 4 9420
+byte 4 9447
+byte 4 9421
+byte 4 9448
+byte 4 9422
+byte 4 9449
+byte 4 9423
+byte 4 11312
+byte 4 11264
+byte 4 11313
+byte 4 11265
+byte 4 11314
+byte 4 11266
+byte 4 11315
+byte 4 11267
+byte 4 11316
+byte 4 11268
+byte 4 11317
+byte 4 11269
+byte 4 11318
+byte 4 11270
+byte 4 11319
+byte 4 11271
+byte 4 11320
+byte 4 11272
+byte 4 11321
+byte 4 11273
+byte 4 11322
+byte 4 11274
+byte 4 11323
+byte 4 11275
+byte 4 11324
+byte 4 11276
+byte 4 11325
+byte 4 11277
+byte 4 11326
+byte 4 11278
+byte 4 11327
+byte 4 11279
+byte 4 11328
+byte 4 11280
+byte 4 11329
+byte 4 11281
+byte 4 11330
+byte 4 11282
+byte 4 11331
+byte 4 11283
+byte 4 11332
+byte 4 11284
+byte 4 11333
+byte 4 11285
+byte 4 11334
+byte 4 11286
+byte 4 11335
+byte 4 11287
+byte 4 11336
+byte 4 11288
+byte 4 11337
+byte 4 11289
+byte 4 11338
+byte 4 11290
+byte 4 11339
+byte 4 11291
+byte 4 11340
+byte 4 11292
+byte 4 11341
+byte 4 11293
+byte 4 11342
+byte 4 11294
+byte 4 11343
+byte 4 11295
+byte 4 11344
+byte 4 11296
+byte 4 11345
+byte 4 11297
+byte 4 11346
+byte 4 11298
+byte 4 11347
+byte 4 11299
+byte 4 11348
+byte 4 11300
+byte 4 11349
+byte 4 11301
+byte 4 11350
+byte 4 11302
+byte 4 11351
+byte 4 11303
+byte 4 11352
+byte 4 11304
+byte 4 11353
+byte 4 11305
+byte 4 11354
+byte 4 11306
+byte 4 11355
+byte 4 11307
+byte 4 11356
+byte 4 11308
+byte 4 11357
+byte 4 11309
+byte 4 11358
+byte 4 11310
+byte 4 11361
+byte 4 11360
+byte 4 11365
+byte 4 570
+byte 4 11366
+byte 4 574
+byte 4 11368
+byte 4 11367
+byte 4 11370
+byte 4 11369
+byte 4 11372
+byte 4 11371
+byte 4 11379
+byte 4 11378
+byte 4 11382
+byte 4 11381
+byte 4 11393
+byte 4 11392
+byte 4 11395
+byte 4 11394
+byte 4 11397
+byte 4 11396
+byte 4 11399
+byte 4 11398
+byte 4 11401
+byte 4 11400
+byte 4 11403
+byte 4 11402
+byte 4 11405
+byte 4 11404
+byte 4 11407
+byte 4 11406
+byte 4 11409
+byte 4 11408
+byte 4 11411
+byte 4 11410
+byte 4 11413
+byte 4 11412
+byte 4 11415
+byte 4 11414
+byte 4 11417
+byte 4 11416
+byte 4 11419
+byte 4 11418
+byte 4 11421
+byte 4 11420
+byte 4 11423
+byte 4 11422
+byte 4 11425
+byte 4 11424
+byte 4 11427
+byte 4 11426
+byte 4 11429
+byte 4 11428
+byte 4 11431
+byte 4 11430
+byte 4 11433
+byte 4 11432
+byte 4 11435
+byte 4 11434
+byte 4 11437
+byte 4 11436
+byte 4 11439
+byte 4 11438
+byte 4 11441
+byte 4 11440
+byte 4 11443
+byte 4 11442
+byte 4 11445
+byte 4 11444
+byte 4 11447
+byte 4 11446
+byte 4 11449
+byte 4 11448
+byte 4 11451
+byte 4 11450
+byte 4 11453
+byte 4 11452
+byte 4 11455
+byte 4 11454
+byte 4 11457
+byte 4 11456
+byte 4 11459
+byte 4 11458
+byte 4 11461
+byte 4 11460
+byte 4 11463
+byte 4 11462
+byte 4 11465
+byte 4 11464
+byte 4 11467
+byte 4 11466
+byte 4 11469
+byte 4 11468
+byte 4 11471
+byte 4 11470
+byte 4 11473
+byte 4 11472
+byte 4 11475
+byte 4 11474
+byte 4 11477
+byte 4 11476
+byte 4 11479
+byte 4 11478
+byte 4 11481
+byte 4 11480
+byte 4 11483
+byte 4 11482
+byte 4 11485
+byte 4 11484
+byte 4 11487
+byte 4 11486
+byte 4 11489
+byte 4 11488
+byte 4 11491
+byte 4 11490
+byte 4 11520
+byte 4 4256
+byte 4 11521
+byte 4 4257
+byte 4 11522
+byte 4 4258
+byte 4 11523
+byte 4 4259
+byte 4 11524
+byte 4 4260
+byte 4 11525
+byte 4 4261
+byte 4 11526
+byte 4 4262
+byte 4 11527
+byte 4 4263
+byte 4 11528
+byte 4 4264
+byte 4 11529
+byte 4 4265
+byte 4 11530
+byte 4 4266
+byte 4 11531
+byte 4 4267
+byte 4 11532
+byte 4 4268
+byte 4 11533
+byte 4 4269
+byte 4 11534
+byte 4 4270
+byte 4 11535
+byte 4 4271
+byte 4 11536
+byte 4 4272
+byte 4 11537
+byte 4 4273
+byte 4 11538
+byte 4 4274
+byte 4 11539
+byte 4 4275
+byte 4 11540
+byte 4 4276
+byte 4 11541
+byte 4 4277
+byte 4 11542
+byte 4 4278
+byte 4 11543
+byte 4 4279
+byte 4 11544
+byte 4 4280
+byte 4 11545
+byte 4 4281
+byte 4 11546
+byte 4 4282
+byte 4 11547
+byte 4 4283
+byte 4 11548
+byte 4 4284
+byte 4 11549
+byte 4 4285
+byte 4 11550
+byte 4 4286
+byte 4 11551
+byte 4 4287
+byte 4 11552
+byte 4 4288
+byte 4 11553
+byte 4 4289
+byte 4 11554
+byte 4 4290
+byte 4 11555
+byte 4 4291
+byte 4 11556
+byte 4 4292
+byte 4 11557
+byte 4 4293
+byte 4 42561
+byte 4 42560
+byte 4 42563
+byte 4 42562
+byte 4 42565
+byte 4 42564
+byte 4 42567
+byte 4 42566
+byte 4 42569
+byte 4 42568
+byte 4 42571
+byte 4 42570
+byte 4 42573
+byte 4 42572
+byte 4 42575
+byte 4 42574
+byte 4 42577
+byte 4 42576
+byte 4 42579
+byte 4 42578
+byte 4 42581
+byte 4 42580
+byte 4 42583
+byte 4 42582
+byte 4 42585
+byte 4 42584
+byte 4 42587
+byte 4 42586
+byte 4 42589
+byte 4 42588
+byte 4 42591
+byte 4 42590
+byte 4 42595
+byte 4 42594
+byte 4 42597
+byte 4 42596
+byte 4 42599
+byte 4 42598
+byte 4 42601
+byte 4 42600
+byte 4 42603
+byte 4 42602
+byte 4 42605
+byte 4 42604
+byte 4 42625
+byte 4 42624
+byte 4 42627
+byte 4 42626
+byte 4 42629
+byte 4 42628
+byte 4 42631
+byte 4 42630
+byte 4 42633
+byte 4 42632
+byte 4 42635
+byte 4 42634
+byte 4 42637
+byte 4 42636
+byte 4 42639
+byte 4 42638
+byte 4 42641
+byte 4 42640
+byte 4 42643
+byte 4 42642
+byte 4 42645
+byte 4 42644
+byte 4 42647
+byte 4 42646
+byte 4 42787
+byte 4 42786
+byte 4 42789
+byte 4 42788
+byte 4 42791
+byte 4 42790
+byte 4 42793
+byte 4 42792
+byte 4 42795
+byte 4 42794
+byte 4 42797
+byte 4 42796
+byte 4 42799
+byte 4 42798
+byte 4 42803
+byte 4 42802
+byte 4 42805
+byte 4 42804
+byte 4 42807
+byte 4 42806
+byte 4 42809
+byte 4 42808
+byte 4 42811
+byte 4 42810
+byte 4 42813
+byte 4 42812
+byte 4 42815
+byte 4 42814
+byte 4 42817
+byte 4 42816
+byte 4 42819
+byte 4 42818
+byte 4 42821
+byte 4 42820
+byte 4 42823
+byte 4 42822
+byte 4 42825
+byte 4 42824
+byte 4 42827
+byte 4 42826
+byte 4 42829
+byte 4 42828
+byte 4 42831
+byte 4 42830
+byte 4 42833
+byte 4 42832
+byte 4 42835
+byte 4 42834
+byte 4 42837
+byte 4 42836
+byte 4 42839
+byte 4 42838
+byte 4 42841
+byte 4 42840
+byte 4 42843
+byte 4 42842
+byte 4 42845
+byte 4 42844
+byte 4 42847
+byte 4 42846
+byte 4 42849
+byte 4 42848
+byte 4 42851
+byte 4 42850
+byte 4 42853
+byte 4 42852
+byte 4 42855
+byte 4 42854
+byte 4 42857
+byte 4 42856
+byte 4 42859
+byte 4 42858
+byte 4 42861
+byte 4 42860
+byte 4 42863
+byte 4 42862
+byte 4 42874
+byte 4 42873
+byte 4 42876
+byte 4 42875
+byte 4 42879
+byte 4 42878
+byte 4 42881
+byte 4 42880
+byte 4 42883
+byte 4 42882
+byte 4 42885
+byte 4 42884
+byte 4 42887
+byte 4 42886
+byte 4 42892
+byte 4 42891
+byte 4 65345
+byte 4 65313
+byte 4 65346
+byte 4 65314
+byte 4 65347
+byte 4 65315
+byte 4 65348
+byte 4 65316
+byte 4 65349
+byte 4 65317
+byte 4 65350
+byte 4 65318
+byte 4 65351
+byte 4 65319
+byte 4 65352
+byte 4 65320
+byte 4 65353
+byte 4 65321
+byte 4 65354
+byte 4 65322
+byte 4 65355
+byte 4 65323
+byte 4 65356
+byte 4 65324
+byte 4 65357
+byte 4 65325
+byte 4 65358
+byte 4 65326
+byte 4 65359
+byte 4 65327
+byte 4 65360
+byte 4 65328
+byte 4 65361
+byte 4 65329
+byte 4 65362
+byte 4 65330
+byte 4 65363
+byte 4 65331
+byte 4 65364
+byte 4 65332
+byte 4 65365
+byte 4 65333
+byte 4 65366
+byte 4 65334
+byte 4 65367
+byte 4 65335
+byte 4 65368
+byte 4 65336
+byte 4 65369
+byte 4 65337
+byte 4 65370
+byte 4 65338
+code
+proc uc_search_range 16 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+GEU4 $102
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $103
+JUMPV
+LABELV $102
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+LTU4 $104
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $105
+JUMPV
+LABELV $104
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $105
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $103
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $99
+endproc uc_search_range 16 0
+export Q_Unicode_IsAlpha
+proc Q_Unicode_IsAlpha 8 20
+ADDRFP4 0
+ARGP4
+ADDRGP4 uc_prop_alphabetic
+ARGP4
+CNSTU4 379
+ARGU4
+CNSTU4 8
+ARGU4
+ADDRGP4 uc_search_range
+ARGP4
+ADDRLP4 4
+ADDRGP4 bsearch
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $108
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $109
+JUMPV
+LABELV $108
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $109
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $106
+endproc Q_Unicode_IsAlpha 8 20
+export Q_Unicode_IsUpper
+proc Q_Unicode_IsUpper 8 20
+ADDRFP4 0
+ARGP4
+ADDRGP4 uc_prop_uppercase
+ARGP4
+CNSTU4 561
+ARGU4
+CNSTU4 8
+ARGU4
+ADDRGP4 uc_search_range
+ARGP4
+ADDRLP4 4
+ADDRGP4 bsearch
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $112
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $113
+JUMPV
+LABELV $112
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $113
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $110
+endproc Q_Unicode_IsUpper 8 20
+export Q_Unicode_IsLower
+proc Q_Unicode_IsLower 8 20
+ADDRFP4 0
+ARGP4
+ADDRGP4 uc_prop_lowercase
+ARGP4
+CNSTU4 572
+ARGU4
+CNSTU4 8
+ARGU4
+ADDRGP4 uc_search_range
+ARGP4
+ADDRLP4 4
+ADDRGP4 bsearch
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $116
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $117
+JUMPV
+LABELV $116
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $117
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $114
+endproc Q_Unicode_IsLower 8 20
+export Q_Unicode_IsIdeo
+proc Q_Unicode_IsIdeo 12 20
+ADDRFP4 0
+ARGP4
+ADDRGP4 uc_prop_ideographic
+ARGP4
+ADDRLP4 4
+CNSTU4 8
+ASGNU4
+ADDRLP4 4
+INDIRU4
+ARGU4
+ADDRLP4 4
+INDIRU4
+ARGU4
+ADDRGP4 uc_search_range
+ARGP4
+ADDRLP4 8
+ADDRGP4 bsearch
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $120
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $121
+JUMPV
+LABELV $120
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $121
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $118
+endproc Q_Unicode_IsIdeo 12 20
+export Q_Unicode_IsDigit
+proc Q_Unicode_IsDigit 8 20
+ADDRFP4 0
+ARGP4
+ADDRGP4 uc_prop_digit
+ARGP4
+CNSTU4 36
+ARGU4
+CNSTU4 8
+ARGU4
+ADDRGP4 uc_search_range
+ARGP4
+ADDRLP4 4
+ADDRGP4 bsearch
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $124
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $125
+JUMPV
+LABELV $124
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $125
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $122
+endproc Q_Unicode_IsDigit 8 20
+export Q_Unicode_IsAlphaOrIdeo
+proc Q_Unicode_IsAlphaOrIdeo 12 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 Q_Unicode_IsAlpha
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $130
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 Q_Unicode_IsIdeo
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $128
+LABELV $130
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $129
+JUMPV
+LABELV $128
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $129
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $126
+endproc Q_Unicode_IsAlphaOrIdeo 12 4
+export Q_Unicode_IsAlphaOrIdeoOrDigit
+proc Q_Unicode_IsAlphaOrIdeoOrDigit 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 Q_Unicode_IsAlpha
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $136
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 Q_Unicode_IsIdeo
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $136
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 Q_Unicode_IsDigit
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $133
+LABELV $136
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $134
+JUMPV
+LABELV $133
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $134
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $131
+endproc Q_Unicode_IsAlphaOrIdeoOrDigit 16 4
+proc uc_search_cp 16 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+GEU4 $140
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $141
+JUMPV
+LABELV $140
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+LEU4 $142
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $143
+JUMPV
+LABELV $142
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $143
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $141
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $137
+endproc uc_search_cp 16 0
+export Q_Unicode_ToUpper
+proc Q_Unicode_ToUpper 12 20
+ADDRFP4 0
+ARGP4
+ADDRGP4 uc_case_upper
+ARGP4
+CNSTU4 991
+ARGU4
+CNSTU4 8
+ARGU4
+ADDRGP4 uc_search_cp
+ARGP4
+ADDRLP4 4
+ADDRGP4 bsearch
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $146
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+ASGNU4
+ADDRGP4 $147
+JUMPV
+LABELV $146
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+CVIU4 4
+ASGNU4
+LABELV $147
+ADDRLP4 8
+INDIRU4
+CVUI4 4
+RETI4
+LABELV $144
+endproc Q_Unicode_ToUpper 12 20
+export Q_Unicode_ToLower
+proc Q_Unicode_ToLower 12 20
+ADDRFP4 0
+ARGP4
+ADDRGP4 uc_case_lower
+ARGP4
+CNSTU4 983
+ARGU4
+CNSTU4 8
+ARGU4
+ADDRGP4 uc_search_cp
+ARGP4
+ADDRLP4 4
+ADDRGP4 bsearch
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $150
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU4
+ASGNU4
+ADDRGP4 $151
+JUMPV
+LABELV $150
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+CVIU4 4
+ASGNU4
+LABELV $151
+ADDRLP4 8
+INDIRU4
+CVUI4 4
+RETI4
+LABELV $148
+endproc Q_Unicode_ToLower 12 20
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
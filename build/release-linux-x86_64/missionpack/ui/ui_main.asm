@@ -0,0 +1,39303 @@
+data
+align 4
+LABELV MonthAbbrev
+address $118
+address $119
+address $120
+address $121
+address $122
+address $123
+address $124
+address $125
+address $126
+address $127
+address $128
+address $129
+align 4
+LABELV skillLevels
+address $130
+address $131
+address $132
+address $133
+address $134
+lit
+align 4
+LABELV numSkillLevels
+byte 4 5
+data
+align 4
+LABELV netSources
+address $135
+address $136
+address $137
+address $138
+address $139
+address $140
+address $141
+address $142
+lit
+align 4
+LABELV numNetSources
+byte 4 8
+data
+align 4
+LABELV netnames
+address $143
+address $144
+address $145
+align 4
+LABELV gamecodetoui
+byte 4 8
+byte 4 4
+byte 4 6
+byte 4 0
+byte 4 10
+byte 4 2
+byte 4 12
+byte 4 1
+byte 4 3
+byte 4 5
+byte 4 7
+byte 4 9
+byte 4 11
+align 4
+LABELV uitogamecode
+byte 4 4
+byte 4 8
+byte 4 6
+byte 4 9
+byte 4 2
+byte 4 10
+byte 4 3
+byte 4 11
+byte 4 1
+byte 4 12
+byte 4 5
+byte 4 13
+byte 4 7
+export UI_WantsBindKeys
+code
+proc UI_WantsBindKeys 4 0
+ADDRLP4 0
+ADDRGP4 Display_WantsBindKeys
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $146
+endproc UI_WantsBindKeys 4 0
+export UI_WindowResized
+proc UI_WindowResized 0 0
+LABELV $147
+endproc UI_WindowResized 0 0
+export AssetCache
+proc AssetCache 108 8
+ADDRGP4 $151
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61684
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $154
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61792
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $157
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61796
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $161
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61796+4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61796+8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $169
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61796+12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61796+16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $177
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61796+20
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $181
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61796+24
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $185
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61796+28
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $189
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61796+32
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $193
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61796+36
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $197
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61796+40
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $201
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61796+44
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61796+48
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $208
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61704
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $211
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61692
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRGP4 $214
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61688
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRGP4 $217
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61696
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 $220
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61700
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61708
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRGP4 $226
+ARGP4
+ADDRLP4 88
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61724
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRGP4 $229
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61728
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $230
+ADDRGP4 $236
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+ADDI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+232+61848
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+LABELV $231
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $230
+ADDRGP4 $238
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 96
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+151456
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $148
+endproc AssetCache 108 8
+export UI_FontForScale
+proc UI_FontForScale 4 0
+ADDRLP4 0
+ADDRGP4 uiInfo+232+12
+ASGNP4
+ADDRFP4 0
+INDIRF4
+ADDRGP4 ui_smallFont+8
+INDIRF4
+GTF4 $242
+ADDRLP4 0
+ADDRGP4 uiInfo+232+20568
+ASGNP4
+ADDRGP4 $243
+JUMPV
+LABELV $242
+ADDRFP4 0
+INDIRF4
+ADDRGP4 ui_bigFont+8
+INDIRF4
+LTF4 $247
+ADDRLP4 0
+ADDRGP4 uiInfo+232+41124
+ASGNP4
+LABELV $247
+LABELV $243
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $239
+endproc UI_FontForScale 4 0
+export UI_Text_PaintWithCursor
+proc UI_Text_PaintWithCursor 16 56
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 32
+INDIRI4
+CNSTI4 3
+NEI4 $253
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $254
+JUMPV
+LABELV $253
+ADDRFP4 32
+INDIRI4
+CNSTI4 6
+NEI4 $255
+ADDRLP4 0
+CNSTF4 1073741824
+ASGNF4
+ADDRGP4 $256
+JUMPV
+LABELV $255
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $256
+LABELV $254
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 UI_FontForScale
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Text_PaintWithCursor
+CALLV
+pop
+LABELV $252
+endproc UI_Text_PaintWithCursor 16 56
+export UI_Text_Width
+proc UI_Text_Width 8 16
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 UI_FontForScale
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 Text_Width
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+RETI4
+LABELV $257
+endproc UI_Text_Width 8 16
+export UI_Text_Height
+proc UI_Text_Height 8 16
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 UI_FontForScale
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 Text_Height
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+RETI4
+LABELV $258
+endproc UI_Text_Height 8 16
+export UI_Text_Paint
+proc UI_Text_Paint 12 48
+ADDRFP4 28
+INDIRI4
+CNSTI4 3
+NEI4 $260
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $261
+JUMPV
+LABELV $260
+ADDRFP4 28
+INDIRI4
+CNSTI4 6
+NEI4 $262
+ADDRLP4 0
+CNSTF4 1073741824
+ASGNF4
+ADDRGP4 $263
+JUMPV
+LABELV $262
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $263
+LABELV $261
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 UI_FontForScale
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $259
+endproc UI_Text_Paint 12 48
+export UI_Text_PaintInMotion
+proc UI_Text_PaintInMotion 8 48
+ADDRFP4 28
+INDIRI4
+CNSTI4 3
+NEI4 $265
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $266
+JUMPV
+LABELV $265
+ADDRFP4 28
+INDIRI4
+CNSTI4 6
+NEI4 $267
+ADDRLP4 0
+CNSTF4 1073741824
+ASGNF4
+ADDRGP4 $268
+JUMPV
+LABELV $267
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $268
+LABELV $266
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 UI_FontForScale
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRF4
+ARGF4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRF4
+ARGF4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Text_Paint
+CALLV
+pop
+LABELV $264
+endproc UI_Text_PaintInMotion 8 48
+export UI_Text_Paint_Limit
+proc UI_Text_Paint_Limit 4 40
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 UI_FontForScale
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRF4
+ARGF4
+ADDRFP4 28
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Text_Paint_Limit
+CALLV
+pop
+LABELV $269
+endproc UI_Text_Paint_Limit 4 40
+export UI_DrawProportionalString
+proc UI_DrawProportionalString 24 32
+ADDRLP4 0
+ADDRGP4 ui_bigFont+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 12
+INDIRI4
+CNSTI4 15
+BANDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $273
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+EQI4 $275
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+EQI4 $276
+ADDRGP4 $273
+JUMPV
+LABELV $275
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ADDRGP4 UI_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $276
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $273
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 20
+INDIRI4
+EQI4 $279
+ADDRLP4 16
+CNSTI4 3
+ASGNI4
+ADDRGP4 $280
+JUMPV
+LABELV $279
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $280
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $270
+endproc UI_DrawProportionalString 24 32
+export UI_ShowPostGame
+proc UI_ShowPostGame 0 4
+ADDRGP4 uiInfo+104144
+ADDRFP4 0
+INDIRI4
+ASGNI4
+CNSTI4 4
+ARGI4
+ADDRGP4 UI_SetActiveMenu
+CALLV
+pop
+LABELV $281
+endproc UI_ShowPostGame 0 4
+data
+export frameCount
+align 4
+LABELV frameCount
+byte 4 0
+bss
+align 4
+LABELV $284
+skip 4
+align 4
+LABELV $285
+skip 16
+export UI_Refresh
+code
+proc UI_Refresh 40 20
+ADDRGP4 uiInfo
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRGP4 uiInfo+216
+ADDRFP4 0
+INDIRI4
+ADDRGP4 uiInfo+212
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 uiInfo+212
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $284
+INDIRI4
+CNSTI4 4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $285
+ADDP4
+ADDRGP4 uiInfo+216
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 $284
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 4
+LEI4 $290
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $292
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $285
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $293
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $292
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $296
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $296
+ADDRGP4 uiInfo+62132
+CNSTF4 1165623296
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $290
+ADDRGP4 UI_UpdateCvars
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 UI_IsFullscreen
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $299
+ADDRGP4 CG_ClearViewport
+CALLV
+pop
+LABELV $299
+ADDRLP4 8
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $301
+ADDRGP4 Menu_PaintAll
+CALLV
+pop
+ADDRGP4 UI_DoServerRefresh
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_BuildServerStatus
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_BuildFindPlayerList
+CALLV
+pop
+LABELV $301
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 12
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $303
+ADDRLP4 16
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $303
+ADDRLP4 20
+CNSTI4 16
+ASGNI4
+ADDRGP4 uiInfo+220
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRGP4 uiInfo+224
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+232+61680
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 28
+ADDRGP4 Display_DebugMode
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $309
+ADDRGP4 $311
+ARGP4
+ADDRGP4 uiInfo+220
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+224
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 colorRed
+ARGP4
+ADDRGP4 CG_DrawString
+CALLV
+pop
+LABELV $309
+LABELV $303
+LABELV $283
+endproc UI_Refresh 40 20
+export UI_Shutdown
+proc UI_Shutdown 0 0
+ADDRGP4 trap_LAN_SaveCachedServers
+CALLV
+pop
+LABELV $314
+endproc UI_Shutdown 0 0
+data
+export defaultMenu
+align 4
+LABELV defaultMenu
+byte 4 0
+bss
+align 1
+LABELV $316
+skip 32768
+export GetMenuBuffer
+code
+proc GetMenuBuffer 16 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $317
+ADDRGP4 $319
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 defaultMenu
+INDIRP4
+RETP4
+ADDRGP4 $315
+JUMPV
+LABELV $317
+ADDRLP4 0
+INDIRI4
+CNSTI4 32768
+LTI4 $320
+ADDRGP4 $322
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 32768
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 defaultMenu
+INDIRP4
+RETP4
+ADDRGP4 $315
+JUMPV
+LABELV $320
+ADDRGP4 $316
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $316
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $316
+RETP4
+LABELV $315
+endproc GetMenuBuffer 16 16
+export Asset_Parse
+proc Asset_Parse 1124 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $324
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $324
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+EQI4 $331
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $330
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1040
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $333
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $333
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $338
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $335
+CNSTI4 1
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $335
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $342
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $339
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1068
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+EQI4 $345
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1064
+ARGP4
+ADDRLP4 1072
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $343
+LABELV $345
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $343
+ADDRGP4 ui_menuFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $346
+ADDRGP4 ui_menuFont+16
+ARGP4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 uiInfo+232+12
+ARGP4
+ADDRLP4 1076
+ADDRGP4 CG_InitTrueTypeFont
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+EQI4 $349
+ADDRGP4 $354
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 ui_menuFont+16
+ARGP4
+ADDRGP4 Com_DPrintf
+CALLV
+pop
+ADDRGP4 $331
+JUMPV
+LABELV $349
+LABELV $346
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 uiInfo+232+12
+ARGP4
+ADDRLP4 1076
+ADDRGP4 CG_InitTrueTypeFont
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $356
+ADDRGP4 uiInfo+232+12
+ARGP4
+ADDRLP4 1080
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+ARGI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 CG_InitBitmapFont
+CALLV
+pop
+LABELV $356
+ADDRGP4 uiInfo+232+61788
+CNSTI4 1
+ASGNI4
+ADDRGP4 $331
+JUMPV
+LABELV $339
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $367
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $364
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1072
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+EQI4 $370
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1068
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $368
+LABELV $370
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $368
+ADDRGP4 ui_menuFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $371
+ADDRGP4 ui_menuFont+16
+ARGP4
+ADDRLP4 1068
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 uiInfo+232+20568
+ARGP4
+ADDRLP4 1080
+ADDRGP4 CG_InitTrueTypeFont
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+EQI4 $374
+ADDRGP4 $379
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 ui_menuFont+16
+ARGP4
+ADDRGP4 Com_DPrintf
+CALLV
+pop
+ADDRGP4 $331
+JUMPV
+LABELV $374
+LABELV $371
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1068
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 uiInfo+232+20568
+ARGP4
+ADDRLP4 1080
+ADDRGP4 CG_InitTrueTypeFont
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $331
+ADDRGP4 uiInfo+232+20568
+ARGP4
+ADDRLP4 1084
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+ARGI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 CG_InitBitmapFont
+CALLV
+pop
+ADDRGP4 $331
+JUMPV
+LABELV $364
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $390
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $387
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+EQI4 $393
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1072
+ARGP4
+ADDRLP4 1080
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $391
+LABELV $393
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $391
+ADDRGP4 ui_menuFont+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $394
+ADDRGP4 ui_menuFont+16
+ARGP4
+ADDRLP4 1072
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 uiInfo+232+41124
+ARGP4
+ADDRLP4 1084
+ADDRGP4 CG_InitTrueTypeFont
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+EQI4 $397
+ADDRGP4 $402
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 ui_menuFont+16
+ARGP4
+ADDRGP4 Com_DPrintf
+CALLV
+pop
+ADDRGP4 $331
+JUMPV
+LABELV $397
+LABELV $394
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1072
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 uiInfo+232+41124
+ARGP4
+ADDRLP4 1084
+ADDRGP4 CG_InitTrueTypeFont
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $331
+ADDRGP4 uiInfo+232+41124
+ARGP4
+ADDRLP4 1088
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+ARGI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 CG_InitBitmapFont
+CALLV
+pop
+ADDRGP4 $331
+JUMPV
+LABELV $387
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $413
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $410
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1076
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $414
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $414
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61684
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRGP4 $331
+JUMPV
+LABELV $410
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $421
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $418
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1080
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $422
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $422
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1084
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61732
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRGP4 $331
+JUMPV
+LABELV $418
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $429
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $426
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1084
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $430
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $430
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1088
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61736
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRGP4 $331
+JUMPV
+LABELV $426
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $437
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $434
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1088
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $438
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $438
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1092
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61744
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRGP4 $331
+JUMPV
+LABELV $434
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $445
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $442
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1092
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $446
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $446
+ADDRLP4 1040
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1096
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61740
+ADDRLP4 1096
+INDIRI4
+ASGNI4
+ADDRGP4 $331
+JUMPV
+LABELV $442
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $453
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $450
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+232+4
+ARGP4
+ADDRLP4 1096
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+NEI4 $454
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $454
+ADDRGP4 uiInfo+232+4
+INDIRP4
+ARGP4
+ADDRLP4 1100
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+232+61680
+ADDRLP4 1100
+INDIRI4
+ASGNI4
+ADDRGP4 $331
+JUMPV
+LABELV $450
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $465
+ARGP4
+ADDRLP4 1096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+NEI4 $462
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+232+61748
+ARGP4
+ADDRLP4 1100
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $331
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $462
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $473
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $470
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+232+61752
+ARGP4
+ADDRLP4 1104
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $331
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $470
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $481
+ARGP4
+ADDRLP4 1104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $478
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+232+61756
+ARGP4
+ADDRLP4 1108
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $331
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $478
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $489
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $486
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+232+61760
+ARGP4
+ADDRLP4 1112
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $331
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $486
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $497
+ARGP4
+ADDRLP4 1112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $494
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+232+61764
+ARGP4
+ADDRLP4 1116
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $331
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $494
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $505
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $502
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+232+61768
+ARGP4
+ADDRLP4 1120
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $506
+CNSTI4 0
+RETI4
+ADDRGP4 $323
+JUMPV
+LABELV $506
+ADDRGP4 uiInfo+232+61784
+ADDRGP4 uiInfo+232+61768+12
+INDIRF4
+ASGNF4
+LABELV $502
+LABELV $331
+ADDRGP4 $330
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $323
+endproc Asset_Parse 1124 16
+export Font_Report
+proc Font_Report 8 12
+ADDRGP4 $516
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $517
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 32
+ASGNI4
+LABELV $518
+ADDRGP4 $522
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 80
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+232+12+44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $519
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 96
+LTI4 $518
+LABELV $515
+endproc Font_Report 8 12
+export UI_Report
+proc UI_Report 0 0
+ADDRGP4 String_Report
+CALLV
+pop
+LABELV $526
+endproc UI_Report 0 0
+export UI_ParseMenu
+proc UI_ParseMenu 1060 12
+ADDRGP4 $528
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_DPrintf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $532
+ADDRGP4 $527
+JUMPV
+LABELV $531
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1040
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $534
+ADDRGP4 $533
+JUMPV
+LABELV $534
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $536
+ADDRGP4 $533
+JUMPV
+LABELV $536
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $542
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $539
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ADDRGP4 Asset_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $533
+ADDRGP4 $532
+JUMPV
+LABELV $539
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $548
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $545
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 Menu_New
+CALLV
+pop
+LABELV $545
+LABELV $532
+ADDRGP4 $531
+JUMPV
+LABELV $533
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+LABELV $527
+endproc UI_ParseMenu 1060 12
+export Load_Menu
+proc Load_Menu 1048 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1040
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $550
+CNSTI4 0
+RETI4
+ADDRGP4 $549
+JUMPV
+LABELV $550
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $556
+CNSTI4 0
+RETI4
+ADDRGP4 $549
+JUMPV
+LABELV $555
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $558
+CNSTI4 0
+RETI4
+ADDRGP4 $549
+JUMPV
+LABELV $558
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $560
+CNSTI4 0
+RETI4
+ADDRGP4 $549
+JUMPV
+LABELV $560
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $563
+CNSTI4 1
+RETI4
+ADDRGP4 $549
+JUMPV
+LABELV $563
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 UI_ParseMenu
+CALLV
+pop
+LABELV $556
+ADDRGP4 $555
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $549
+endproc Load_Menu 1048 8
+export UI_LoadMenus
+proc UI_LoadMenus 1068 8
+ADDRLP4 1048
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $568
+ADDRGP4 $570
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $571
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 1056
+ADDRGP4 trap_PC_LoadSource
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $572
+ADDRGP4 $574
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $572
+LABELV $568
+ADDRGP4 ui_new+12
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $579
+ADDRGP4 Menu_Reset
+CALLV
+pop
+ADDRGP4 $579
+JUMPV
+LABELV $578
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1056
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $581
+ADDRGP4 $580
+JUMPV
+LABELV $581
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $587
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $583
+LABELV $587
+ADDRGP4 $580
+JUMPV
+LABELV $583
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $588
+ADDRGP4 $580
+JUMPV
+LABELV $588
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $594
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $591
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1064
+ADDRGP4 Load_Menu
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+EQI4 $580
+LABELV $591
+LABELV $579
+ADDRGP4 $578
+JUMPV
+LABELV $580
+ADDRLP4 1056
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRGP4 $597
+ARGP4
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 Com_DPrintf
+CALLV
+pop
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 trap_PC_FreeSource
+CALLI4
+pop
+LABELV $567
+endproc UI_LoadMenus 1068 8
+export UI_Load
+proc UI_Load 1052 12
+ADDRGP4 uiInfo
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRLP4 1032
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1032
+INDIRP4
+ASGNP4
+ADDRGP4 $599
+ARGP4
+ADDRLP4 1036
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+CNSTU4 0
+ASGNU4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 1044
+INDIRU4
+EQU4 $600
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 1044
+INDIRU4
+EQU4 $600
+ADDRLP4 8
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $601
+JUMPV
+LABELV $600
+ADDRLP4 8
+CNSTI1 0
+ASGNI1
+LABELV $601
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $604
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $602
+LABELV $604
+ADDRLP4 0
+ADDRGP4 $571
+ASGNP4
+LABELV $602
+ADDRGP4 String_Init
+CALLV
+pop
+ADDRGP4 $605
+ARGP4
+ADDRGP4 UI_ParseGameInfo
+CALLV
+pop
+ADDRGP4 UI_LoadArenas
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_LoadMenus
+CALLV
+pop
+ADDRGP4 $606
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_LoadMenus
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRLP4 8
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $607
+ADDRLP4 8
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+LABELV $607
+LABELV $598
+endproc UI_Load 1052 12
+export UI_SourceForLAN
+proc UI_SourceForLAN 4 0
+ADDRLP4 0
+ADDRGP4 ui_netSource+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $610
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+GTI4 $610
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $616
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $616
+address $613
+address $614
+address $614
+address $614
+address $614
+address $614
+address $614
+address $615
+code
+LABELV $610
+LABELV $613
+CNSTI4 0
+RETI4
+ADDRGP4 $609
+JUMPV
+LABELV $614
+CNSTI4 2
+RETI4
+ADDRGP4 $609
+JUMPV
+LABELV $615
+CNSTI4 1
+RETI4
+LABELV $609
+endproc UI_SourceForLAN 4 0
+export UI_FilterDescription
+proc UI_FilterDescription 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $621
+ADDRFP4 0
+INDIRI4
+ADDRGP4 uiInfo+128152
+INDIRI4
+LEI4 $618
+LABELV $621
+ADDRGP4 $622
+RETP4
+ADDRGP4 $617
+JUMPV
+LABELV $618
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+127640-8+4
+ADDP4
+INDIRP4
+RETP4
+LABELV $617
+endproc UI_FilterDescription 4 0
+export UI_FilterDir
+proc UI_FilterDir 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $630
+ADDRFP4 0
+INDIRI4
+ADDRGP4 uiInfo+128152
+INDIRI4
+LEI4 $627
+LABELV $630
+ADDRGP4 $631
+RETP4
+ADDRGP4 $626
+JUMPV
+LABELV $627
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+127640-8
+ADDP4
+INDIRP4
+RETP4
+LABELV $626
+endproc UI_FilterDir 4 0
+data
+align 4
+LABELV handicapValues
+address $634
+address $635
+address $636
+address $637
+address $638
+address $639
+address $640
+address $641
+address $642
+address $643
+address $644
+address $645
+address $646
+address $647
+address $648
+address $649
+address $650
+address $651
+address $652
+address $653
+byte 4 0
+code
+proc UI_DrawHandicap 20 32
+ADDRGP4 $655
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 1084227584
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 handicapValues
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $654
+endproc UI_DrawHandicap 20 32
+proc UI_DrawClanName 8 32
+ADDRGP4 $657
+ARGP4
+ADDRLP4 0
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $656
+endproc UI_DrawClanName 8 32
+proc UI_SetCapFragLimits 8 8
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRLP4 4
+CNSTI4 10
+ASGNI4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $659
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRGP4 $660
+JUMPV
+LABELV $659
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $664
+ADDRLP4 0
+CNSTI4 15
+ASGNI4
+LABELV $664
+LABELV $660
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $669
+ADDRGP4 $671
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $672
+ARGP4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $670
+JUMPV
+LABELV $669
+ADDRGP4 $673
+ARGP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $674
+ARGP4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $670
+LABELV $658
+endproc UI_SetCapFragLimits 8 8
+proc UI_DrawGameType 4 32
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $675
+endproc UI_DrawGameType 4 32
+proc UI_DrawNetGameType 4 32
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $678
+endproc UI_DrawNetGameType 4 32
+proc UI_DrawJoinGameType 4 32
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109420
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $681
+endproc UI_DrawJoinGameType 4 32
+proc UI_TeamIndexFromName 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $685
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $685
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $690
+JUMPV
+LABELV $687
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $692
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $684
+JUMPV
+LABELV $692
+LABELV $688
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $690
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+106464
+INDIRI4
+LTI4 $687
+LABELV $685
+CNSTI4 0
+RETI4
+LABELV $684
+endproc UI_TeamIndexFromName 12 8
+proc UI_DrawClanLogo 48 20
+ADDRGP4 $657
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $696
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+106464
+INDIRI4
+GEI4 $696
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $699
+ADDRLP4 16
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+106468+28
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $709
+ARGP4
+ADDRLP4 24
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 uiInfo+106468+32
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $714
+ARGP4
+ADDRLP4 36
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 uiInfo+106468+36
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $699
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $696
+LABELV $695
+endproc UI_DrawClanLogo 48 20
+proc UI_DrawClanCinematic 32 24
+ADDRGP4 $657
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $720
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+106464
+INDIRI4
+GEI4 $720
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+40
+ADDP4
+INDIRI4
+CNSTI4 -2
+LTI4 $723
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+40
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $727
+ADDRGP4 $733
+ARGP4
+ADDRLP4 16
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 28
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+106468+40
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $727
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+40
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $736
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+pop
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 UI_DrawCinematic
+CALLV
+pop
+ADDRGP4 $724
+JUMPV
+LABELV $736
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+32
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+40
+ADDP4
+CNSTI4 -2
+ASGNI4
+ADDRGP4 $724
+JUMPV
+LABELV $723
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $724
+LABELV $720
+LABELV $719
+endproc UI_DrawClanCinematic 32 24
+proc UI_DrawPreviewCinematic 16 24
+ADDRGP4 uiInfo+131248
+INDIRI4
+CNSTI4 -2
+LEI4 $751
+ADDRGP4 $733
+ARGP4
+ADDRGP4 uiInfo+131244
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+130216
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+131248
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+131248
+INDIRI4
+CNSTI4 0
+LTI4 $757
+ADDRGP4 uiInfo+131248
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+pop
+ADDRGP4 uiInfo+131248
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 UI_DrawCinematic
+CALLV
+pop
+ADDRGP4 $758
+JUMPV
+LABELV $757
+ADDRGP4 uiInfo+131248
+CNSTI4 -2
+ASGNI4
+LABELV $758
+LABELV $751
+LABELV $750
+endproc UI_DrawPreviewCinematic 16 24
+proc UI_DrawSkill 16 32
+ADDRGP4 $764
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $767
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numSkillLevels
+INDIRI4
+LEI4 $765
+LABELV $767
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $765
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 skillLevels-4
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $763
+endproc UI_DrawSkill 16 32
+proc UI_DrawTeamName 32 32
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $773
+ADDRLP4 4
+ADDRGP4 $770
+ASGNP4
+ADDRGP4 $774
+JUMPV
+LABELV $773
+ADDRLP4 4
+ADDRGP4 $771
+ASGNP4
+LABELV $774
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $775
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+106464
+INDIRI4
+GEI4 $775
+ADDRGP4 $778
+ARGP4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $783
+ADDRLP4 20
+ADDRGP4 $779
+ASGNP4
+ADDRGP4 $784
+JUMPV
+LABELV $783
+ADDRLP4 20
+ADDRGP4 $780
+ASGNP4
+LABELV $784
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $775
+LABELV $769
+endproc UI_DrawTeamName 32 32
+proc UI_DrawTeamMember 32 32
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $789
+ADDRLP4 8
+ADDRGP4 $786
+ASGNP4
+ADDRGP4 $790
+JUMPV
+LABELV $789
+ADDRLP4 8
+ADDRGP4 $787
+ASGNP4
+LABELV $790
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $791
+ADDRLP4 4
+ADDRGP4 $793
+ASGNP4
+ADDRGP4 $792
+JUMPV
+LABELV $791
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $794
+ADDRLP4 4
+ADDRGP4 $796
+ASGNP4
+ADDRGP4 $795
+JUMPV
+LABELV $794
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $797
+ADDRLP4 4
+ADDRGP4 $799
+ASGNP4
+ADDRGP4 $798
+JUMPV
+LABELV $797
+ADDRLP4 20
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $800
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+104148
+INDIRI4
+LTI4 $803
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $803
+ADDRLP4 4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $801
+JUMPV
+LABELV $800
+ADDRLP4 24
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $807
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $807
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 UI_GetBotNameByNumber
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+ASGNP4
+LABELV $801
+LABELV $798
+LABELV $795
+LABELV $792
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $785
+endproc UI_DrawTeamMember 32 32
+proc UI_DrawEffects 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 1091717413
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1096810496
+SUBF4
+ARGF4
+CNSTF4 1124073472
+ARGF4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 uiInfo+232+61792
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 uiInfo+168876
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+232+61796
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $815
+ADDRLP4 0
+ADDRGP4 uiInfo+232+61796+48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $820
+ADDRLP4 0
+ADDRGP4 uiInfo+62120
+INDIRI4
+ASGNI4
+LABELV $820
+ADDRGP4 uiInfo+168876
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uitogamecode
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_PlayerColorFromIndex
+CALLV
+pop
+ADDRLP4 12+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $815
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 uiInfo+168876
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1056964608
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 20
+CNSTF4 1098907648
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1094713344
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $809
+endproc UI_DrawEffects 28 20
+proc UI_DrawMapPreview 16 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $830
+ADDRLP4 4
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+ASGNI4
+ADDRGP4 $831
+JUMPV
+LABELV $830
+ADDRLP4 4
+ADDRGP4 ui_currentMap+12
+INDIRI4
+ASGNI4
+LABELV $831
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+92
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $832
+ADDRLP4 8
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+114192+8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+114192+92
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $832
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+92
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $840
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+92
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $841
+JUMPV
+LABELV $840
+ADDRGP4 $846
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $841
+LABELV $826
+endproc UI_DrawMapPreview 16 20
+proc UI_DrawMapTimeToBeat 28 32
+ADDRLP4 0
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 100
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+28
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 60
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $854
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $847
+endproc UI_DrawMapTimeToBeat 28 32
+proc UI_DrawMapCinematic 24 24
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $859
+ADDRLP4 4
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+ASGNI4
+ADDRGP4 $860
+JUMPV
+LABELV $859
+ADDRLP4 4
+ADDRGP4 ui_currentMap+12
+INDIRI4
+ASGNI4
+LABELV $860
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+24
+ADDP4
+INDIRI4
+CNSTI4 -1
+LTI4 $861
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+24
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $865
+ADDRGP4 $733
+ARGP4
+ADDRLP4 8
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+114192+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 20
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+114192+24
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $865
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+24
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $873
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+pop
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+24
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 UI_DrawCinematic
+CALLV
+pop
+ADDRGP4 $862
+JUMPV
+LABELV $873
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+24
+ADDP4
+CNSTI4 -2
+ASGNI4
+ADDRGP4 $862
+JUMPV
+LABELV $861
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawMapPreview
+CALLV
+pop
+LABELV $862
+LABELV $855
+endproc UI_DrawMapCinematic 24 24
+data
+align 4
+LABELV updateModel
+byte 4 1
+align 4
+LABELV q3Model
+byte 4 0
+align 4
+LABELV updateModelColor
+byte 4 1
+bss
+align 4
+LABELV $884
+skip 1696
+code
+proc UI_DrawPlayerModel 620 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $887
+ARGP4
+ADDRLP4 600
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 600
+INDIRF4
+CNSTF4 0
+EQF4 $885
+ADDRGP4 $888
+ARGP4
+ADDRLP4 604
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 604
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $889
+ARGP4
+ADDRLP4 608
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 608
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 q3Model
+INDIRI4
+CNSTI4 0
+NEI4 $890
+ADDRLP4 612
+CNSTI4 1
+ASGNI4
+ADDRGP4 q3Model
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRGP4 updateModel
+ADDRLP4 612
+INDIRI4
+ASGNI4
+LABELV $890
+ADDRLP4 320
+CNSTI1 0
+ASGNI1
+ADDRGP4 $886
+JUMPV
+LABELV $885
+ADDRGP4 $657
+ARGP4
+ADDRLP4 604
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 320
+ARGP4
+ADDRLP4 604
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $892
+ARGP4
+ADDRLP4 608
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 608
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $893
+ARGP4
+ADDRLP4 612
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 612
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 q3Model
+INDIRI4
+CNSTI4 0
+EQI4 $894
+ADDRGP4 q3Model
+CNSTI4 0
+ASGNI4
+ADDRGP4 updateModel
+CNSTI4 1
+ASGNI4
+LABELV $894
+LABELV $886
+ADDRGP4 updateModel
+INDIRI4
+CNSTI4 0
+EQI4 $896
+ADDRGP4 $884
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1696
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 576+4
+CNSTF4 1126825984
+ASGNF4
+ADDRLP4 604
+CNSTF4 0
+ASGNF4
+ADDRLP4 576
+ADDRLP4 604
+INDIRF4
+ASGNF4
+ADDRLP4 576+8
+ADDRLP4 604
+INDIRF4
+ASGNF4
+ADDRLP4 608
+CNSTF4 0
+ASGNF4
+ADDRLP4 588+8
+ADDRLP4 608
+INDIRF4
+ASGNF4
+ADDRLP4 588+4
+ADDRLP4 608
+INDIRF4
+ASGNF4
+ADDRLP4 588
+ADDRLP4 608
+INDIRF4
+ASGNF4
+ADDRGP4 $884
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 320
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+ADDRGP4 $884
+ARGP4
+ADDRLP4 612
+CNSTI4 0
+ASGNI4
+ADDRLP4 612
+INDIRI4
+ARGI4
+CNSTI4 22
+ARGI4
+CNSTI4 11
+ARGI4
+ADDRLP4 576
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 612
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+ADDRLP4 616
+CNSTI4 0
+ASGNI4
+ADDRGP4 updateModel
+ADDRLP4 616
+INDIRI4
+ASGNI4
+ADDRGP4 updateModelColor
+ADDRLP4 616
+INDIRI4
+ASGNI4
+LABELV $896
+ADDRGP4 updateModelColor
+INDIRI4
+CNSTI4 0
+EQI4 $902
+ADDRGP4 $884
+ARGP4
+ADDRGP4 UI_PlayerInfo_UpdateColor
+CALLV
+pop
+ADDRGP4 updateModelColor
+CNSTI4 0
+ASGNI4
+LABELV $902
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 $884
+ARGP4
+ADDRGP4 uiInfo+212
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 UI_DrawPlayer
+CALLV
+pop
+LABELV $883
+endproc UI_DrawPlayerModel 620 32
+proc UI_DrawNetSource 8 32
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+LTI4 $910
+ADDRGP4 ui_netSource+12
+INDIRI4
+ADDRGP4 numNetSources
+INDIRI4
+LTI4 $906
+LABELV $910
+ADDRGP4 ui_netSource+12
+CNSTI4 0
+ASGNI4
+LABELV $906
+ADDRGP4 $912
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 netSources
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $905
+endproc UI_DrawNetSource 8 32
+proc UI_DrawNetMapPreview 8 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 uiInfo+131252+10428
+INDIRI4
+CNSTI4 0
+LEI4 $915
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+131252+10428
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $916
+JUMPV
+LABELV $915
+ADDRGP4 $846
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $916
+LABELV $914
+endproc UI_DrawNetMapPreview 8 20
+proc UI_DrawNetMapCinematic 4 20
+ADDRGP4 uiInfo+131252+10432
+INDIRI4
+CNSTI4 0
+LTI4 $922
+ADDRGP4 uiInfo+131252+10432
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+pop
+ADDRGP4 uiInfo+131252+10432
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 UI_DrawCinematic
+CALLV
+pop
+ADDRGP4 $923
+JUMPV
+LABELV $922
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawNetMapPreview
+CALLV
+pop
+LABELV $923
+LABELV $921
+endproc UI_DrawNetMapCinematic 4 20
+proc UI_DrawNetFilter 12 32
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 UI_FilterDescription
+CALLP4
+ASGNP4
+ADDRGP4 $931
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $930
+endproc UI_DrawNetFilter 12 32
+proc UI_DrawTier 20 32
+ADDRGP4 $934
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $938
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+126992
+INDIRI4
+LTI4 $935
+LABELV $938
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $935
+ADDRGP4 $939
+ARGP4
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+126996
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $933
+endproc UI_DrawTier 20 32
+proc UI_DrawTierMap 28 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $934
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $945
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+126992
+INDIRI4
+LTI4 $942
+LABELV $945
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $942
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+126996+28
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $946
+ADDRGP4 $952
+ARGP4
+ADDRLP4 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+126996+4
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+126996+28
+ADDP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $946
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+126996+28
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $941
+endproc UI_DrawTierMap 28 20
+proc UI_EnglishMapName 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $961
+JUMPV
+LABELV $958
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $963
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $957
+JUMPV
+LABELV $963
+LABELV $959
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $961
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+114188
+INDIRI4
+LTI4 $958
+ADDRGP4 $631
+RETP4
+LABELV $957
+endproc UI_EnglishMapName 8 8
+proc UI_DrawTierMapName 32 32
+ADDRGP4 $934
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $972
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+126992
+INDIRI4
+LTI4 $969
+LABELV $972
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $969
+ADDRGP4 $973
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $976
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $974
+LABELV $976
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $974
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+126996+4
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 UI_EnglishMapName
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $968
+endproc UI_DrawTierMapName 32 32
+proc UI_DrawTierGameType 28 32
+ADDRGP4 $934
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $983
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+126992
+INDIRI4
+LTI4 $980
+LABELV $983
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $980
+ADDRGP4 $973
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $986
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $984
+LABELV $986
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $984
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+126996+16
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $979
+endproc UI_DrawTierGameType 28 32
+proc UI_AIFromName 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $994
+JUMPV
+LABELV $991
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+105696
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $996
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+105696+4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $990
+JUMPV
+LABELV $996
+LABELV $992
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $994
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+105692
+INDIRI4
+LTI4 $991
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1004
+JUMPV
+LABELV $1001
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1006
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $990
+JUMPV
+LABELV $1006
+LABELV $1002
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1004
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+104148
+INDIRI4
+LTI4 $1001
+ADDRGP4 $1010
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $990
+endproc UI_AIFromName 8 8
+data
+align 4
+LABELV updateOpponentModel
+byte 4 1
+bss
+align 4
+LABELV $1012
+skip 1696
+code
+proc UI_DrawOpponent 428 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 updateOpponentModel
+INDIRI4
+CNSTI4 0
+EQI4 $1013
+ADDRGP4 $1015
+ARGP4
+ADDRLP4 408
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 408
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1015
+ARGP4
+ADDRLP4 412
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 412
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 152
+CNSTI1 0
+ASGNI1
+ADDRGP4 $1012
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1696
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 128+4
+CNSTF4 1126825984
+ASGNF4
+ADDRLP4 416
+CNSTF4 0
+ASGNF4
+ADDRLP4 128
+ADDRLP4 416
+INDIRF4
+ASGNF4
+ADDRLP4 128+8
+ADDRLP4 416
+INDIRF4
+ASGNF4
+ADDRLP4 420
+CNSTF4 0
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 420
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 420
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 420
+INDIRF4
+ASGNF4
+ADDRGP4 $1012
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 $631
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+ADDRGP4 $1012
+ARGP4
+ADDRLP4 424
+CNSTI4 0
+ASGNI4
+ADDRLP4 424
+INDIRI4
+ARGI4
+CNSTI4 22
+ARGI4
+CNSTI4 11
+ARGI4
+ADDRLP4 128
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 424
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+ADDRGP4 $1012
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRGP4 UI_RegisterPlayerModelname
+CALLI4
+pop
+ADDRGP4 updateOpponentModel
+CNSTI4 0
+ASGNI4
+LABELV $1013
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 $1012
+ARGP4
+ADDRGP4 uiInfo+212
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 UI_DrawPlayer
+CALLV
+pop
+LABELV $1011
+endproc UI_DrawOpponent 428 32
+proc UI_NextOpponent 24 8
+ADDRGP4 $1022
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $657
+ARGP4
+ADDRLP4 16
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+106464
+INDIRI4
+LTI4 $1023
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1023
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1026
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+106464
+INDIRI4
+LTI4 $1028
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1028
+LABELV $1026
+ADDRGP4 $1022
+ARGP4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1021
+endproc UI_NextOpponent 24 8
+proc UI_PriorOpponent 24 8
+ADDRGP4 $1022
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $657
+ARGP4
+ADDRLP4 16
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1033
+ADDRLP4 0
+ADDRGP4 uiInfo+106464
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1033
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1036
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1038
+ADDRLP4 0
+ADDRGP4 uiInfo+106464
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1038
+LABELV $1036
+ADDRGP4 $1022
+ARGP4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1032
+endproc UI_PriorOpponent 24 8
+proc UI_DrawPlayerLogo 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $657
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1043
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+106468+28
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $709
+ARGP4
+ADDRLP4 20
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+106468+32
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $714
+ARGP4
+ADDRLP4 32
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+106468+36
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $1043
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1042
+endproc UI_DrawPlayerLogo 44 20
+proc UI_DrawPlayerLogoMetal 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $657
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1062
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+106468+28
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $709
+ARGP4
+ADDRLP4 20
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+106468+32
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $714
+ARGP4
+ADDRLP4 32
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+106468+36
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $1062
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+32
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1061
+endproc UI_DrawPlayerLogoMetal 44 20
+proc UI_DrawPlayerLogoName 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $657
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1081
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+106468+28
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $709
+ARGP4
+ADDRLP4 20
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+106468+32
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $714
+ARGP4
+ADDRLP4 32
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+106468+36
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $1081
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1080
+endproc UI_DrawPlayerLogoName 44 20
+proc UI_DrawOpponentLogo 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1022
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1100
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+106468+28
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $709
+ARGP4
+ADDRLP4 20
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+106468+32
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $714
+ARGP4
+ADDRLP4 32
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+106468+36
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $1100
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+28
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1099
+endproc UI_DrawOpponentLogo 44 20
+proc UI_DrawOpponentLogoMetal 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1022
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1119
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+106468+28
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $709
+ARGP4
+ADDRLP4 20
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+106468+32
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $714
+ARGP4
+ADDRLP4 32
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+106468+36
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $1119
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+32
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1118
+endproc UI_DrawOpponentLogoMetal 44 20
+proc UI_DrawOpponentLogoName 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1022
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+28
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1138
+ADDRLP4 12
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+106468+28
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $709
+ARGP4
+ADDRLP4 20
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 uiInfo+106468+32
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $714
+ARGP4
+ADDRLP4 32
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+106468+36
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $1138
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 44
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+36
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1137
+endproc UI_DrawOpponentLogoName 44 20
+proc UI_DrawAllMapsSelection 16 32
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1160
+ADDRLP4 4
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+ASGNI4
+ADDRGP4 $1161
+JUMPV
+LABELV $1160
+ADDRLP4 4
+ADDRGP4 ui_currentMap+12
+INDIRI4
+ASGNI4
+LABELV $1161
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1162
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+114188
+INDIRI4
+GEI4 $1162
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $1162
+LABELV $1156
+endproc UI_DrawAllMapsSelection 16 32
+proc UI_DrawOpponentName 8 32
+ADDRGP4 $1022
+ARGP4
+ADDRLP4 0
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $1166
+endproc UI_DrawOpponentName 8 32
+proc UI_OwnerDrawWidth 116 12
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 20
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 200
+LTI4 $1169
+ADDRLP4 20
+INDIRI4
+CNSTI4 247
+GTI4 $1232
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1233-800
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1233
+address $1170
+address $1169
+address $1169
+address $1171
+address $1169
+address $1172
+address $1169
+address $1175
+address $1180
+address $1185
+address $1190
+address $1190
+address $1190
+address $1190
+address $1190
+address $1200
+address $1200
+address $1200
+address $1200
+address $1200
+address $1209
+address $1169
+address $1217
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1169
+address $1229
+code
+LABELV $1232
+ADDRFP4 0
+INDIRI4
+CNSTI4 250
+EQI4 $1224
+ADDRGP4 $1169
+JUMPV
+LABELV $1170
+ADDRGP4 $655
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 1084227584
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+CNSTI4 20
+ADDRLP4 16
+INDIRI4
+CNSTI4 5
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 handicapValues
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1169
+JUMPV
+LABELV $1171
+ADDRGP4 $657
+ARGP4
+ADDRLP4 32
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 $1169
+JUMPV
+LABELV $1172
+ADDRLP4 0
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1169
+JUMPV
+LABELV $1175
+ADDRGP4 $764
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+LTI4 $1178
+ADDRLP4 40
+INDIRI4
+ADDRGP4 numSkillLevels
+INDIRI4
+LEI4 $1176
+LABELV $1178
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $1176
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 skillLevels-4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1169
+JUMPV
+LABELV $1180
+ADDRGP4 $770
+ARGP4
+ADDRLP4 44
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+LTI4 $1169
+ADDRLP4 52
+INDIRI4
+ADDRGP4 uiInfo+106464
+INDIRI4
+GEI4 $1169
+ADDRGP4 $778
+ARGP4
+ADDRGP4 $779
+ARGP4
+CNSTI4 44
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $1169
+JUMPV
+LABELV $1185
+ADDRGP4 $771
+ARGP4
+ADDRLP4 56
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+LTI4 $1169
+ADDRLP4 64
+INDIRI4
+ADDRGP4 uiInfo+106464
+INDIRI4
+GEI4 $1169
+ADDRGP4 $778
+ARGP4
+ADDRGP4 $780
+ARGP4
+CNSTI4 44
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $1169
+JUMPV
+LABELV $1190
+ADDRGP4 $786
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 210
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 72
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $1191
+ADDRLP4 12
+ADDRGP4 $793
+ASGNP4
+ADDRGP4 $1192
+JUMPV
+LABELV $1191
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $1193
+ADDRLP4 12
+ADDRGP4 $796
+ASGNP4
+ADDRGP4 $1194
+JUMPV
+LABELV $1193
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+105692
+INDIRI4
+LTI4 $1195
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $1195
+ADDRLP4 12
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+105696
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1194
+LABELV $1192
+ADDRGP4 $1199
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 210
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRGP4 $1169
+JUMPV
+LABELV $1200
+ADDRGP4 $787
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 215
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 84
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $1201
+ADDRLP4 12
+ADDRGP4 $793
+ASGNP4
+ADDRGP4 $1202
+JUMPV
+LABELV $1201
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $1203
+ADDRLP4 12
+ADDRGP4 $796
+ASGNP4
+ADDRGP4 $1204
+JUMPV
+LABELV $1203
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+105692
+INDIRI4
+LTI4 $1205
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $1205
+ADDRLP4 12
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+105696
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1204
+LABELV $1202
+ADDRGP4 $1199
+ARGP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 215
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRGP4 $1169
+JUMPV
+LABELV $1209
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+LTI4 $1214
+ADDRGP4 ui_netSource+12
+INDIRI4
+ADDRGP4 numNetSources
+INDIRI4
+LTI4 $1210
+LABELV $1214
+ADDRGP4 ui_netSource+12
+CNSTI4 0
+ASGNI4
+LABELV $1210
+ADDRGP4 $912
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 netSources
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRGP4 $1169
+JUMPV
+LABELV $1217
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 UI_FilterDescription
+CALLP4
+ASGNP4
+ADDRGP4 $931
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRGP4 $1169
+JUMPV
+LABELV $1224
+ADDRLP4 104
+ADDRGP4 Display_KeyBindPending
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+EQI4 $1225
+ADDRLP4 0
+ADDRGP4 $1227
+ASGNP4
+ADDRGP4 $1169
+JUMPV
+LABELV $1225
+ADDRLP4 0
+ADDRGP4 $1228
+ASGNP4
+ADDRGP4 $1169
+JUMPV
+LABELV $1229
+ADDRGP4 $1230
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 112
+INDIRP4
+ASGNP4
+LABELV $1169
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1235
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $1167
+JUMPV
+LABELV $1235
+CNSTI4 0
+RETI4
+LABELV $1167
+endproc UI_OwnerDrawWidth 116 12
+proc UI_DrawBotName 20 32
+ADDRLP4 4
+ADDRGP4 uiInfo+104152
+INDIRI4
+ASGNI4
+ADDRGP4 $1239
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 $631
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1240
+ADDRLP4 0
+ADDRGP4 $799
+ASGNP4
+ADDRGP4 $1241
+JUMPV
+LABELV $1240
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LTI4 $1242
+ADDRLP4 0
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156-24
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1243
+JUMPV
+LABELV $1242
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 UI_GetBotNameByNumber
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $1243
+LABELV $1241
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $1237
+endproc UI_DrawBotName 20 32
+proc UI_DrawBotSkill 4 32
+ADDRGP4 uiInfo+127636
+INDIRI4
+CNSTI4 0
+LTI4 $1247
+ADDRGP4 uiInfo+127636
+INDIRI4
+ADDRGP4 numSkillLevels
+INDIRI4
+GEI4 $1247
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+127636
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 skillLevels
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $1247
+LABELV $1246
+endproc UI_DrawBotSkill 4 32
+proc UI_DrawRedBlue 8 32
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+109548
+INDIRI4
+CNSTI4 0
+NEI4 $1255
+ADDRLP4 0
+ADDRGP4 $780
+ASGNP4
+ADDRGP4 $1256
+JUMPV
+LABELV $1255
+ADDRLP4 0
+ADDRGP4 $779
+ASGNP4
+LABELV $1256
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $1252
+endproc UI_DrawRedBlue 8 32
+proc UI_DrawCrosshair 8 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 uiInfo+151448
+INDIRI4
+CNSTI4 0
+NEI4 $1258
+ADDRGP4 $1257
+JUMPV
+LABELV $1258
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 uiInfo+151448
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+232+61848
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1257
+endproc UI_DrawCrosshair 8 20
+proc UI_BuildPlayerList 1096 12
+ADDRGP4 uiInfo+109576
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+109552
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+109556
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1272
+ADDRGP4 cg+531852
+INDIRI4
+CNSTI4 -1
+NEI4 $1268
+LABELV $1272
+ADDRGP4 $1264
+JUMPV
+LABELV $1268
+ADDRGP4 uiInfo+109572
+ADDRGP4 cg+48
+INDIRP4
+CNSTI4 254140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+109572
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $1277
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+109576
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $1278
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $1279
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRLP4 1068
+CNSTI4 0
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRGP4 $1283
+JUMPV
+LABELV $1280
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigString
+CALLI4
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1284
+ADDRLP4 4
+ARGP4
+ADDRGP4 $1288
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 uiInfo+109552
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+109580
+ADDP4
+ARGP4
+ADDRLP4 1072
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 uiInfo+109552
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+109580
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRGP4 uiInfo+109552
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+111628
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1076
+ADDRGP4 uiInfo+109552
+ASGNP4
+ADDRLP4 1076
+INDIRP4
+ADDRLP4 1076
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $1278
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1080
+INDIRP4
+ARGP4
+ADDRLP4 1084
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+NEI4 $1294
+ADDRLP4 4
+ARGP4
+ADDRGP4 $1288
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 uiInfo+109556
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+111884
+ADDP4
+ARGP4
+ADDRLP4 1088
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 uiInfo+109556
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+111884
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRGP4 uiInfo+109556
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+113932
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+109572
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1302
+ADDRLP4 1040
+ADDRGP4 uiInfo+109556
+INDIRI4
+ASGNI4
+LABELV $1302
+ADDRLP4 1092
+ADDRGP4 uiInfo+109556
+ASGNP4
+ADDRLP4 1092
+INDIRP4
+ADDRLP4 1092
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1294
+LABELV $1284
+LABELV $1281
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1283
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $1280
+ADDRGP4 uiInfo+109576
+INDIRI4
+CNSTI4 0
+NEI4 $1307
+ADDRGP4 $1310
+ARGP4
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $1307
+ADDRGP4 $1310
+ARGP4
+ADDRLP4 1072
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1072
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1314
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+109556
+INDIRI4
+LEI4 $1311
+LABELV $1314
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1311
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+109556
+INDIRI4
+GEI4 $1315
+ADDRGP4 $1318
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+111884
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1315
+LABELV $1264
+endproc UI_BuildPlayerList 1096 12
+proc UI_DrawSelectedPlayer 16 32
+ADDRGP4 uiInfo+212
+INDIRI4
+ADDRGP4 uiInfo+109564
+INDIRI4
+LEI4 $1321
+ADDRGP4 uiInfo+109564
+ADDRGP4 uiInfo+212
+INDIRI4
+CNSTI4 3000
+ADDI4
+ASGNI4
+ADDRGP4 UI_BuildPlayerList
+CALLV
+pop
+LABELV $1321
+ADDRGP4 uiInfo+109576
+INDIRI4
+CNSTI4 0
+EQI4 $1330
+ADDRGP4 $1318
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $1331
+JUMPV
+LABELV $1330
+ADDRGP4 $1328
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $1331
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $1320
+endproc UI_DrawSelectedPlayer 16 32
+proc UI_DrawServerRefreshDate 80 32
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 uiInfo+131252+2212
+INDIRI4
+CNSTI4 0
+EQI4 $1333
+ADDRLP4 32
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 0
+ADDRLP4 32
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1061997773
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1061997773
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 uiInfo+212
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRLP4 44
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRGP4 $1341
+ARGP4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+ADDRGP4 $1334
+JUMPV
+LABELV $1333
+ADDRGP4 $1230
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $1343
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $1334
+LABELV $1332
+endproc UI_DrawServerRefreshDate 80 32
+proc UI_DrawServerMOTD 56 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 uiInfo+131252+10444
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_Text_Width
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+LEF4 $1348
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1349
+JUMPV
+LABELV $1348
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1349
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 uiInfo+212
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+131252+10440
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 CG_SetClipRegion
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 uiInfo+131252+10436
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1077936128
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_PaintInMotion
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ADDRGP4 uiInfo+131252+10436
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1077936128
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_PaintInMotion
+CALLV
+pop
+ADDRGP4 CG_ClearClipRegion
+CALLV
+pop
+ADDRLP4 48
+ADDRGP4 uiInfo+131252+10436
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1360
+JUMPV
+LABELV $1359
+ADDRLP4 52
+ADDRGP4 uiInfo+131252+10436
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $1360
+ADDRGP4 uiInfo+131252+10436
+INDIRF4
+ADDRLP4 0
+INDIRF4
+GTF4 $1359
+ADDRGP4 uiInfo+131252+10440
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $1344
+endproc UI_DrawServerMOTD 56 32
+proc UI_DrawKeyBindStatus 8 32
+ADDRLP4 0
+ADDRGP4 Display_KeyBindPending
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1369
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1227
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+ADDRGP4 $1370
+JUMPV
+LABELV $1369
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1228
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $1370
+LABELV $1368
+endproc UI_DrawKeyBindStatus 8 32
+proc UI_DrawGLInfo 1336 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $1372
+ARGP4
+ADDRGP4 cgs+20100+1024
+ARGP4
+ADDRLP4 1296
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1296
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 30
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+ADDRGP4 $1375
+ARGP4
+ADDRGP4 cgs+20100+2048
+ARGP4
+ADDRGP4 cgs+20100
+ARGP4
+ADDRLP4 1304
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1097859072
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1304
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 30
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+ADDRGP4 $1379
+ARGP4
+ADDRGP4 cgs+20100+35848
+INDIRI4
+ARGI4
+ADDRGP4 cgs+20100+35852
+INDIRI4
+ARGI4
+ADDRGP4 cgs+20100+35856
+INDIRI4
+ARGI4
+ADDRLP4 1312
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1106247680
+ADDF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1312
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 30
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+ADDRLP4 272
+ARGP4
+ADDRGP4 cgs+20100+3072
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 272
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1110704128
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1389
+JUMPV
+LABELV $1391
+ADDRLP4 1320
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1320
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1320
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $1392
+ADDRLP4 1324
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 0
+EQI4 $1394
+ADDRLP4 1324
+INDIRI4
+CNSTI4 32
+EQI4 $1391
+LABELV $1394
+ADDRLP4 1328
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 0
+EQI4 $1398
+ADDRLP4 1328
+INDIRI4
+CNSTI4 32
+EQI4 $1398
+ADDRLP4 1332
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 1332
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1398
+JUMPV
+LABELV $1397
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $1398
+ADDRLP4 1332
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+CNSTI4 0
+EQI4 $1400
+ADDRLP4 1332
+INDIRI4
+CNSTI4 32
+NEI4 $1397
+LABELV $1400
+LABELV $1389
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $1401
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1392
+LABELV $1401
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1403
+JUMPV
+LABELV $1402
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1324
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1324
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 20
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GEI4 $1405
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1328
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1328
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1328
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+ADDP4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 20
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $1405
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1093664768
+SUBF4
+LEF4 $1407
+ADDRGP4 $1404
+JUMPV
+LABELV $1407
+LABELV $1403
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $1402
+LABELV $1404
+LABELV $1371
+endproc UI_DrawGLInfo 1336 32
+proc UI_OwnerDraw 24 24
+ADDRFP4 40
+ADDRFP4 40
+INDIRF4
+ASGNF4
+ADDRFP4 44
+ADDRFP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ADDRFP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 20
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 200
+LTI4 $1414
+ADDRLP4 16
+INDIRI4
+CNSTI4 256
+GTI4 $1414
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1463-800
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1463
+address $1415
+address $1416
+address $1417
+address $1418
+address $1419
+address $1422
+address $1425
+address $1429
+address $1430
+address $1431
+address $1432
+address $1432
+address $1432
+address $1432
+address $1432
+address $1433
+address $1433
+address $1433
+address $1433
+address $1433
+address $1434
+address $1435
+address $1437
+address $1438
+address $1439
+address $1440
+address $1441
+address $1442
+address $1443
+address $1446
+address $1444
+address $1447
+address $1445
+address $1448
+address $1449
+address $1450
+address $1451
+address $1453
+address $1414
+address $1454
+address $1455
+address $1456
+address $1457
+address $1458
+address $1427
+address $1423
+address $1436
+address $1459
+address $1460
+address $1461
+address $1462
+address $1420
+address $1426
+address $1424
+address $1421
+address $1428
+address $1452
+code
+LABELV $1415
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandicap
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1416
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawEffects
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1417
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_DrawPlayerModel
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1418
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawClanName
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1419
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawClanLogo
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1420
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawClanCinematic
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1421
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawPreviewCinematic
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1422
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawGameType
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1423
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawNetGameType
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1424
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawJoinGameType
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1425
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_DrawMapPreview
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1426
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawMapTimeToBeat
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1427
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_DrawMapCinematic
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1428
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_DrawMapCinematic
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1429
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawSkill
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1430
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTeamName
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1431
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTeamName
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1432
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+CNSTI4 210
+SUBI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTeamMember
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1433
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRFP4 24
+INDIRI4
+CNSTI4 215
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTeamMember
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1434
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawNetSource
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1435
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawNetMapPreview
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1436
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawNetMapCinematic
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1437
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawNetFilter
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1438
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTier
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1439
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_DrawOpponent
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1440
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_DrawTierMap
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1441
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_DrawTierMap
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1442
+ADDRLP4 0
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 UI_DrawTierMap
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1443
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawPlayerLogo
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1444
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawPlayerLogoMetal
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1445
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawPlayerLogoName
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1446
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawOpponentLogo
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1447
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawOpponentLogoMetal
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1448
+ADDRLP4 0
+ARGP4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawOpponentLogoName
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1449
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTierMapName
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1450
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawTierGameType
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1451
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_DrawAllMapsSelection
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1452
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_DrawAllMapsSelection
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1453
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawOpponentName
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1454
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawBotName
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1455
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawBotSkill
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1456
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawRedBlue
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1457
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawCrosshair
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1458
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawSelectedPlayer
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1459
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawServerRefreshDate
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1460
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawServerMOTD
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1461
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawGLInfo
+CALLV
+pop
+ADDRGP4 $1414
+JUMPV
+LABELV $1462
+ADDRLP4 0
+ARGP4
+ADDRFP4 40
+INDIRF4
+ARGF4
+ADDRFP4 44
+INDIRP4
+ARGP4
+ADDRFP4 52
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawKeyBindStatus
+CALLV
+pop
+LABELV $1414
+LABELV $1409
+endproc UI_OwnerDraw 24 24
+proc UI_OwnerDrawVisible 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1467
+JUMPV
+LABELV $1466
+ADDRFP4 0
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $1469
+ADDRGP4 $1239
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+EQF4 $1471
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1471
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+LABELV $1469
+ADDRFP4 0
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $1473
+ADDRGP4 $1239
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $1475
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1475
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -513
+BANDI4
+ASGNI4
+LABELV $1473
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1477
+ADDRGP4 uiInfo+109576
+INDIRI4
+CNSTI4 0
+NEI4 $1479
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1480
+JUMPV
+LABELV $1479
+ADDRGP4 ui_selectedPlayer+12
+INDIRI4
+ADDRGP4 uiInfo+109556
+INDIRI4
+GEI4 $1482
+ADDRGP4 ui_selectedPlayer+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+113932
+ADDP4
+INDIRI4
+ADDRGP4 uiInfo+109572
+INDIRI4
+NEI4 $1482
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1482
+LABELV $1480
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+LABELV $1477
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1489
+ADDRGP4 uiInfo+109576
+INDIRI4
+CNSTI4 0
+EQI4 $1491
+ADDRGP4 ui_selectedPlayer+12
+INDIRI4
+ADDRGP4 uiInfo+109556
+INDIRI4
+GEI4 $1501
+ADDRGP4 ui_selectedPlayer+12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+113932
+ADDP4
+INDIRI4
+ADDRGP4 uiInfo+109572
+INDIRI4
+EQI4 $1494
+LABELV $1501
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1494
+LABELV $1491
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $1489
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1502
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 7
+EQI4 $1504
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1504
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+LABELV $1502
+ADDRFP4 0
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1507
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 7
+NEI4 $1509
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1509
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -4097
+BANDI4
+ASGNI4
+LABELV $1507
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1512
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRGP4 ui_gameType+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $1514
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1514
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+LABELV $1512
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $1519
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRGP4 ui_gameType+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $1521
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1521
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+LABELV $1519
+ADDRFP4 0
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $1526
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $1528
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1528
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -2049
+BANDI4
+ASGNI4
+LABELV $1526
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1533
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $1535
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1535
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -1025
+BANDI4
+ASGNI4
+LABELV $1533
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1540
+ADDRGP4 uiInfo+104124
+INDIRI4
+ADDRGP4 uiInfo+212
+INDIRI4
+GEI4 $1542
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1543
+JUMPV
+LABELV $1542
+ADDRGP4 uiInfo+104144
+INDIRI4
+CNSTI4 0
+EQI4 $1546
+ADDRGP4 uiInfo+151456
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 uiInfo+104144
+CNSTI4 0
+ASGNI4
+LABELV $1546
+LABELV $1543
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -33
+BANDI4
+ASGNI4
+LABELV $1540
+ADDRFP4 0
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $1551
+ADDRGP4 uiInfo+104128
+INDIRI4
+ADDRGP4 uiInfo+212
+INDIRI4
+GEI4 $1553
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1553
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+LABELV $1551
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $1557
+ADDRGP4 uiInfo+104140
+INDIRI4
+CNSTI4 0
+NEI4 $1559
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1559
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -65
+BANDI4
+ASGNI4
+ADDRGP4 $1558
+JUMPV
+LABELV $1557
+ADDRFP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1558
+LABELV $1467
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1466
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1465
+endproc UI_OwnerDrawVisible 8 8
+proc UI_Handicap_HandleKey 20 12
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1563
+ADDRGP4 $655
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 1084227584
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 100
+LEI4 $1565
+ADDRLP4 8
+CNSTI4 5
+ASGNI4
+ADDRGP4 $1566
+JUMPV
+LABELV $1565
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+GEI4 $1567
+ADDRLP4 8
+CNSTI4 100
+ASGNI4
+LABELV $1567
+LABELV $1566
+ADDRGP4 $655
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1562
+JUMPV
+LABELV $1563
+CNSTI4 0
+RETI4
+LABELV $1562
+endproc UI_Handicap_HandleKey 20 12
+proc UI_Effects_HandleKey 16 8
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1570
+ADDRLP4 8
+ADDRGP4 uiInfo+168876
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+168876
+INDIRI4
+CNSTI4 12
+LEI4 $1573
+ADDRGP4 uiInfo+168876
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1574
+JUMPV
+LABELV $1573
+ADDRGP4 uiInfo+168876
+INDIRI4
+CNSTI4 0
+GEI4 $1577
+ADDRGP4 uiInfo+168876
+CNSTI4 12
+ASGNI4
+LABELV $1577
+LABELV $1574
+ADDRGP4 $1581
+ARGP4
+ADDRGP4 uiInfo+168876
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uitogamecode
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 updateModelColor
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $1569
+JUMPV
+LABELV $1570
+CNSTI4 0
+RETI4
+LABELV $1569
+endproc UI_Effects_HandleKey 16 8
+proc UI_ClanName_HandleKey 24 8
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1584
+ADDRGP4 $657
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+40
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1586
+CNSTI4 44
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+CNSTI4 44
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+40
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1586
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+106464
+INDIRI4
+LTI4 $1594
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1595
+JUMPV
+LABELV $1594
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $1597
+ADDRLP4 8
+ADDRGP4 uiInfo+106464
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1597
+LABELV $1595
+ADDRGP4 $657
+ARGP4
+CNSTI4 44
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 UI_HeadCountByTeam
+CALLI4
+pop
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_FeederSelection
+CALLV
+pop
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 updateModel
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $1583
+JUMPV
+LABELV $1584
+CNSTI4 0
+RETI4
+LABELV $1583
+endproc UI_ClanName_HandleKey 24 8
+proc UI_GameType_HandleKey 24 16
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1602
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1604
+ADDRLP4 16
+ADDRGP4 ui_gameType+12
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 2
+NEI4 $1607
+ADDRGP4 ui_gameType+12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1605
+JUMPV
+LABELV $1607
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 2
+GEI4 $1605
+ADDRGP4 ui_gameType+12
+ADDRGP4 uiInfo+109284
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1605
+JUMPV
+LABELV $1604
+ADDRLP4 16
+ADDRGP4 ui_gameType+12
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 ui_gameType+12
+INDIRI4
+ADDRGP4 uiInfo+109284
+INDIRI4
+LTI4 $1617
+ADDRGP4 ui_gameType+12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1618
+JUMPV
+LABELV $1617
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 2
+NEI4 $1622
+ADDRGP4 ui_gameType+12
+CNSTI4 3
+ASGNI4
+LABELV $1622
+LABELV $1618
+LABELV $1605
+ADDRLP4 16
+CNSTI4 3
+ASGNI4
+ADDRGP4 ui_gameType+12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GEI4 $1626
+ADDRGP4 $887
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1627
+JUMPV
+LABELV $1626
+ADDRGP4 $887
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $1627
+ADDRGP4 $1631
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_SetCapFragLimits
+CALLV
+pop
+CNSTI4 100
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_LoadBestScores
+CALLV
+pop
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1639
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $1639
+ADDRGP4 $973
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+LABELV $1639
+CNSTI4 1
+RETI4
+ADDRGP4 $1601
+JUMPV
+LABELV $1602
+CNSTI4 0
+RETI4
+LABELV $1601
+endproc UI_GameType_HandleKey 24 16
+proc UI_NetGameType_HandleKey 12 16
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1642
+ADDRLP4 8
+ADDRGP4 ui_netGameType+12
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 0
+GEI4 $1645
+ADDRGP4 ui_netGameType+12
+ADDRGP4 uiInfo+109284
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1646
+JUMPV
+LABELV $1645
+ADDRGP4 ui_netGameType+12
+INDIRI4
+ADDRGP4 uiInfo+109284
+INDIRI4
+LTI4 $1650
+ADDRGP4 ui_netGameType+12
+CNSTI4 0
+ASGNI4
+LABELV $1650
+LABELV $1646
+ADDRGP4 $1655
+ARGP4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1657
+ARGP4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1661
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1641
+JUMPV
+LABELV $1642
+CNSTI4 0
+RETI4
+LABELV $1641
+endproc UI_NetGameType_HandleKey 12 16
+proc UI_JoinGameType_HandleKey 12 8
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1663
+ADDRLP4 8
+ADDRGP4 ui_joinGameType+12
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+CNSTI4 0
+GEI4 $1666
+ADDRGP4 ui_joinGameType+12
+ADDRGP4 uiInfo+109416
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1667
+JUMPV
+LABELV $1666
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+ADDRGP4 uiInfo+109416
+INDIRI4
+LTI4 $1671
+ADDRGP4 ui_joinGameType+12
+CNSTI4 0
+ASGNI4
+LABELV $1671
+LABELV $1667
+ADDRGP4 $1676
+ARGP4
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1662
+JUMPV
+LABELV $1663
+CNSTI4 0
+RETI4
+LABELV $1662
+endproc UI_JoinGameType_HandleKey 12 8
+proc UI_Skill_HandleKey 16 8
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1679
+ADDRGP4 $764
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+GEI4 $1681
+ADDRLP4 8
+ADDRGP4 numSkillLevels
+INDIRI4
+ASGNI4
+ADDRGP4 $1682
+JUMPV
+LABELV $1681
+ADDRLP4 8
+INDIRI4
+ADDRGP4 numSkillLevels
+INDIRI4
+LEI4 $1683
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $1683
+LABELV $1682
+ADDRGP4 $764
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1678
+JUMPV
+LABELV $1679
+CNSTI4 0
+RETI4
+LABELV $1678
+endproc UI_Skill_HandleKey 16 8
+proc UI_TeamName_HandleKey 28 8
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1686
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1689
+ADDRLP4 12
+ADDRGP4 $770
+ASGNP4
+ADDRGP4 $1690
+JUMPV
+LABELV $1689
+ADDRLP4 12
+ADDRGP4 $771
+ASGNP4
+LABELV $1690
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+106464
+INDIRI4
+LTI4 $1691
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1692
+JUMPV
+LABELV $1691
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $1694
+ADDRLP4 8
+ADDRGP4 uiInfo+106464
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1694
+LABELV $1692
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1699
+ADDRLP4 24
+ADDRGP4 $770
+ASGNP4
+ADDRGP4 $1700
+JUMPV
+LABELV $1699
+ADDRLP4 24
+ADDRGP4 $771
+ASGNP4
+LABELV $1700
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTI4 44
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1685
+JUMPV
+LABELV $1686
+CNSTI4 0
+RETI4
+LABELV $1685
+endproc UI_TeamName_HandleKey 28 8
+proc UI_TeamMember_HandleKey 36 8
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1702
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1705
+ADDRLP4 16
+ADDRGP4 $786
+ASGNP4
+ADDRGP4 $1706
+JUMPV
+LABELV $1705
+ADDRLP4 16
+ADDRGP4 $787
+ASGNP4
+LABELV $1706
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LTI4 $1707
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+104148
+INDIRI4
+CNSTI4 3
+ADDI4
+LTI4 $1710
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1708
+JUMPV
+LABELV $1710
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $1708
+ADDRLP4 8
+ADDRGP4 uiInfo+104148
+INDIRI4
+CNSTI4 3
+ADDI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1708
+JUMPV
+LABELV $1707
+ADDRLP4 28
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 3
+ADDI4
+LTI4 $1716
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1717
+JUMPV
+LABELV $1716
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $1718
+ADDRLP4 32
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 32
+INDIRI4
+CNSTI4 3
+ADDI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1718
+LABELV $1717
+LABELV $1708
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1701
+JUMPV
+LABELV $1702
+CNSTI4 0
+RETI4
+LABELV $1701
+endproc UI_TeamMember_HandleKey 36 8
+proc UI_NetSource_HandleKey 32 16
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1721
+ADDRLP4 8
+ADDRGP4 ui_netSource+12
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 2
+LTI4 $1724
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 6
+GTI4 $1724
+ADDRGP4 $1730
+JUMPV
+LABELV $1729
+ADDRGP4 ui_browserSeparateMasters+12
+INDIRI4
+CNSTI4 0
+EQI4 $1734
+ADDRLP4 14
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 $1737
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 14
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1739
+ADDRGP4 $1731
+JUMPV
+LABELV $1739
+LABELV $1734
+ADDRLP4 28
+ADDRGP4 ui_netSource+12
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1730
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 2
+LTI4 $1742
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 6
+LEI4 $1729
+LABELV $1742
+LABELV $1731
+LABELV $1724
+ADDRGP4 ui_netSource+12
+INDIRI4
+ADDRGP4 numNetSources
+INDIRI4
+LTI4 $1743
+ADDRGP4 ui_netSource+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1744
+JUMPV
+LABELV $1743
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+GEI4 $1747
+ADDRGP4 ui_netSource+12
+ADDRGP4 numNetSources
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1747
+LABELV $1744
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_StartServerRefresh
+CALLV
+pop
+ADDRGP4 $1751
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1720
+JUMPV
+LABELV $1721
+CNSTI4 0
+RETI4
+LABELV $1720
+endproc UI_NetSource_HandleKey 32 16
+proc UI_NetFilter_HandleKey 12 4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1754
+ADDRLP4 8
+ADDRGP4 ui_serverFilterType+12
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+ADDRGP4 uiInfo+128152
+INDIRI4
+LEI4 $1757
+ADDRGP4 ui_serverFilterType+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1758
+JUMPV
+LABELV $1757
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+CNSTI4 0
+GEI4 $1762
+ADDRGP4 ui_serverFilterType+12
+ADDRGP4 uiInfo+128152
+INDIRI4
+ASGNI4
+LABELV $1762
+LABELV $1758
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1753
+JUMPV
+LABELV $1754
+CNSTI4 0
+RETI4
+LABELV $1753
+endproc UI_NetFilter_HandleKey 12 4
+proc UI_OpponentName_HandleKey 8 4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1768
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1770
+ADDRGP4 UI_PriorOpponent
+CALLV
+pop
+ADDRGP4 $1771
+JUMPV
+LABELV $1770
+ADDRGP4 UI_NextOpponent
+CALLV
+pop
+LABELV $1771
+CNSTI4 1
+RETI4
+ADDRGP4 $1767
+JUMPV
+LABELV $1768
+CNSTI4 0
+RETI4
+LABELV $1767
+endproc UI_OpponentName_HandleKey 8 4
+proc UI_BotName_HandleKey 32 4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1773
+ADDRGP4 $1239
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 uiInfo+104152
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+LTI4 $1776
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+104148
+INDIRI4
+CNSTI4 1
+ADDI4
+LTI4 $1778
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1777
+JUMPV
+LABELV $1778
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $1777
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRGP4 uiInfo+104148
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $1777
+JUMPV
+LABELV $1776
+ADDRLP4 20
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+LTI4 $1784
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1785
+JUMPV
+LABELV $1784
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $1786
+ADDRLP4 24
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ADDRLP4 28
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $1786
+LABELV $1785
+LABELV $1777
+ADDRGP4 uiInfo+104152
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1772
+JUMPV
+LABELV $1773
+CNSTI4 0
+RETI4
+LABELV $1772
+endproc UI_BotName_HandleKey 32 4
+proc UI_BotSkill_HandleKey 12 4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1790
+ADDRLP4 8
+ADDRGP4 uiInfo+127636
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+127636
+INDIRI4
+ADDRGP4 numSkillLevels
+INDIRI4
+LTI4 $1793
+ADDRGP4 uiInfo+127636
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1794
+JUMPV
+LABELV $1793
+ADDRGP4 uiInfo+127636
+INDIRI4
+CNSTI4 0
+GEI4 $1797
+ADDRGP4 uiInfo+127636
+ADDRGP4 numSkillLevels
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1797
+LABELV $1794
+CNSTI4 1
+RETI4
+ADDRGP4 $1789
+JUMPV
+LABELV $1790
+CNSTI4 0
+RETI4
+LABELV $1789
+endproc UI_BotSkill_HandleKey 12 4
+proc UI_RedBlue_HandleKey 12 4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1802
+ADDRLP4 8
+ADDRGP4 uiInfo+109548
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1801
+JUMPV
+LABELV $1802
+CNSTI4 0
+RETI4
+LABELV $1801
+endproc UI_RedBlue_HandleKey 12 4
+proc UI_Crosshair_HandleKey 12 8
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1806
+ADDRLP4 8
+ADDRGP4 uiInfo+151448
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+151448
+INDIRI4
+CNSTI4 10
+LTI4 $1809
+ADDRGP4 uiInfo+151448
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1810
+JUMPV
+LABELV $1809
+ADDRGP4 uiInfo+151448
+INDIRI4
+CNSTI4 0
+GEI4 $1813
+ADDRGP4 uiInfo+151448
+CNSTI4 9
+ASGNI4
+LABELV $1813
+LABELV $1810
+ADDRGP4 $1817
+ARGP4
+ADDRGP4 uiInfo+151448
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1805
+JUMPV
+LABELV $1806
+CNSTI4 0
+RETI4
+LABELV $1805
+endproc UI_Crosshair_HandleKey 12 8
+proc UI_SelectedPlayer_HandleKey 16 8
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1820
+ADDRGP4 UI_BuildPlayerList
+CALLV
+pop
+ADDRGP4 uiInfo+109576
+INDIRI4
+CNSTI4 0
+NEI4 $1822
+CNSTI4 0
+RETI4
+ADDRGP4 $1819
+JUMPV
+LABELV $1822
+ADDRGP4 $1310
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+109556
+INDIRI4
+LEI4 $1825
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1826
+JUMPV
+LABELV $1825
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $1828
+ADDRLP4 8
+ADDRGP4 uiInfo+109556
+INDIRI4
+ASGNI4
+LABELV $1828
+LABELV $1826
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+109556
+INDIRI4
+NEI4 $1831
+ADDRGP4 $1318
+ARGP4
+ADDRGP4 $1834
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1832
+JUMPV
+LABELV $1831
+ADDRGP4 $1318
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+111884
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1832
+ADDRGP4 $1310
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $1820
+CNSTI4 0
+RETI4
+LABELV $1819
+endproc UI_SelectedPlayer_HandleKey 16 8
+proc UI_OwnerDrawHandleKey 52 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 200
+LTI4 $1838
+ADDRLP4 0
+INDIRI4
+CNSTI4 253
+GTI4 $1838
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1858-800
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1858
+address $1839
+address $1840
+address $1838
+address $1841
+address $1838
+address $1842
+address $1838
+address $1845
+address $1846
+address $1847
+address $1848
+address $1848
+address $1848
+address $1848
+address $1848
+address $1849
+address $1849
+address $1849
+address $1849
+address $1849
+address $1850
+address $1838
+address $1851
+address $1838
+address $1838
+address $1838
+address $1838
+address $1838
+address $1838
+address $1838
+address $1838
+address $1838
+address $1838
+address $1838
+address $1838
+address $1838
+address $1838
+address $1852
+address $1838
+address $1853
+address $1854
+address $1855
+address $1856
+address $1857
+address $1838
+address $1843
+address $1838
+address $1838
+address $1838
+address $1838
+address $1838
+address $1838
+address $1838
+address $1844
+code
+LABELV $1839
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Handicap_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $1836
+JUMPV
+LABELV $1840
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_Effects_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $1836
+JUMPV
+LABELV $1841
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 UI_ClanName_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $1836
+JUMPV
+LABELV $1842
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 UI_GameType_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $1836
+JUMPV
+LABELV $1843
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_NetGameType_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $1836
+JUMPV
+LABELV $1844
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_JoinGameType_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $1836
+JUMPV
+LABELV $1845
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 UI_Skill_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+ADDRGP4 $1836
+JUMPV
+LABELV $1846
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 32
+ADDRGP4 UI_TeamName_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $1836
+JUMPV
+LABELV $1847
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+ADDRGP4 UI_TeamName_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+RETI4
+ADDRGP4 $1836
+JUMPV
+LABELV $1848
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 210
+SUBI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 UI_TeamMember_HandleKey
+CALLI4
+pop
+ADDRGP4 $1838
+JUMPV
+LABELV $1849
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 215
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 UI_TeamMember_HandleKey
+CALLI4
+pop
+ADDRGP4 $1838
+JUMPV
+LABELV $1850
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_NetSource_HandleKey
+CALLI4
+pop
+ADDRGP4 $1838
+JUMPV
+LABELV $1851
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_NetFilter_HandleKey
+CALLI4
+pop
+ADDRGP4 $1838
+JUMPV
+LABELV $1852
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_OpponentName_HandleKey
+CALLI4
+pop
+ADDRGP4 $1838
+JUMPV
+LABELV $1853
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 UI_BotName_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+RETI4
+ADDRGP4 $1836
+JUMPV
+LABELV $1854
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 UI_BotSkill_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+RETI4
+ADDRGP4 $1836
+JUMPV
+LABELV $1855
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_RedBlue_HandleKey
+CALLI4
+pop
+ADDRGP4 $1838
+JUMPV
+LABELV $1856
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_Crosshair_HandleKey
+CALLI4
+pop
+ADDRGP4 $1838
+JUMPV
+LABELV $1857
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 UI_SelectedPlayer_HandleKey
+CALLI4
+pop
+LABELV $1838
+CNSTI4 0
+RETI4
+LABELV $1836
+endproc UI_OwnerDrawHandleKey 52 20
+proc UI_GetValue 0 0
+CNSTF4 0
+RETF4
+LABELV $1860
+endproc UI_GetValue 0 0
+proc UI_ServersQsortCompare 8 20
+ADDRLP4 0
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+131252+2200
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+131252+2204
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_LAN_CompareServers
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $1861
+endproc UI_ServersQsortCompare 8 20
+export UI_ServersSort
+proc UI_ServersSort 8 16
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1866
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+GTI4 $1866
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1877
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1877
+address $1869
+address $1870
+address $1871
+address $1875
+address $1876
+code
+LABELV $1869
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1868
+JUMPV
+LABELV $1870
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1868
+JUMPV
+LABELV $1871
+ADDRGP4 ui_browserShowBots+12
+INDIRI4
+CNSTI4 0
+NEI4 $1872
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $1868
+JUMPV
+LABELV $1872
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1868
+JUMPV
+LABELV $1875
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $1868
+JUMPV
+LABELV $1876
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+LABELV $1868
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1878
+ADDRGP4 uiInfo+131252+2200
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1880
+ADDRGP4 $1866
+JUMPV
+LABELV $1880
+LABELV $1878
+ADDRGP4 uiInfo+131252+2200
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+131252+2220
+ARGP4
+ADDRGP4 uiInfo+131252+10412
+INDIRI4
+CVIU4 4
+ARGU4
+CNSTU4 4
+ARGU4
+ADDRGP4 UI_ServersQsortCompare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 uiInfo+131252+2216
+INDIRI4
+ARGI4
+ADDRGP4 UI_FeederSelection
+CALLV
+pop
+LABELV $1866
+endproc UI_ServersSort 8 16
+proc UI_LoadMods 2096 16
+ADDRGP4 uiInfo+128152
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1894
+ARGP4
+ADDRGP4 $631
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 2068
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 2068
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1898
+JUMPV
+LABELV $1895
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2072
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 2072
+INDIRU4
+CNSTU4 1
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2080
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRGP4 uiInfo+128152
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+127640
+ADDP4
+ADDRLP4 2080
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 2084
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRGP4 uiInfo+128152
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+127640+4
+ADDP4
+ADDRLP4 2084
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 2088
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+ADDRLP4 2088
+INDIRU4
+ADDU4
+CNSTU4 1
+ADDU4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 2092
+ADDRGP4 uiInfo+128152
+ASGNP4
+ADDRLP4 2092
+INDIRP4
+ADDRLP4 2092
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+128152
+INDIRI4
+CNSTI4 64
+LTI4 $1905
+ADDRGP4 $1897
+JUMPV
+LABELV $1905
+LABELV $1896
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1898
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $1895
+LABELV $1897
+LABELV $1892
+endproc UI_LoadMods 2096 16
+proc UI_LoadTeams 4120 16
+ADDRGP4 $631
+ARGP4
+ADDRGP4 $1909
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRLP4 4112
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 4112
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1910
+ADDRLP4 0
+ADDRLP4 16
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1915
+JUMPV
+LABELV $1912
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4116
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 4116
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_ParseTeamInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $1913
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1915
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $1912
+LABELV $1910
+LABELV $1908
+endproc UI_LoadTeams 4120 16
+proc UI_LoadMovies 4124 16
+ADDRGP4 $1918
+ARGP4
+ADDRGP4 $1919
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRLP4 4108
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+131240
+ADDRLP4 4108
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+131240
+INDIRI4
+CNSTI4 0
+EQI4 $1920
+ADDRGP4 uiInfo+131240
+INDIRI4
+CNSTI4 256
+LEI4 $1923
+ADDRGP4 uiInfo+131240
+CNSTI4 256
+ASGNI4
+LABELV $1923
+ADDRLP4 0
+ADDRLP4 12
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1930
+JUMPV
+LABELV $1927
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4112
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 4112
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4120
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+130216
+ADDP4
+ADDRLP4 4120
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $1928
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1930
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+131240
+INDIRI4
+LTI4 $1927
+LABELV $1920
+LABELV $1916
+endproc UI_LoadMovies 4124 16
+proc UI_LoadDemos 16472 32
+ADDRGP4 $1935
+ARGP4
+ADDRGP4 $1936
+ARGP4
+ADDRLP4 68
+ARGP4
+CNSTI4 16384
+ARGI4
+ADDRLP4 16452
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+130208
+ADDRLP4 16452
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 68
+ASGNP4
+ADDRGP4 uiInfo+130208
+INDIRI4
+CNSTI4 512
+LEI4 $1937
+ADDRGP4 uiInfo+130208
+CNSTI4 512
+ASGNI4
+LABELV $1937
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1944
+JUMPV
+LABELV $1941
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 16456
+ADDRGP4 trap_GetDemoFileInfo
+CALLI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 16456
+INDIRI4
+ASGNI4
+ADDRGP4 $1946
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $1949
+ADDRLP4 16460
+ADDRGP4 $631
+ASGNP4
+ADDRGP4 $1950
+JUMPV
+LABELV $1949
+ADDRLP4 16460
+ADDRGP4 $1947
+ASGNP4
+LABELV $1950
+ADDRLP4 16460
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1024
+DIVI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1000
+DIVI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16464
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 16464
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16468
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+128160
+ADDP4
+ADDRLP4 16468
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $1942
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1944
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+130208
+INDIRI4
+LTI4 $1941
+LABELV $1933
+endproc UI_LoadDemos 16472 32
+proc UI_SetNextMap 8 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1956
+JUMPV
+LABELV $1953
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+96
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1958
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 $1962
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1952
+JUMPV
+LABELV $1958
+LABELV $1954
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1956
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+114188
+INDIRI4
+LTI4 $1953
+CNSTI4 0
+RETI4
+LABELV $1952
+endproc UI_SetNextMap 8 16
+proc UI_StartSkirmish 1124 32
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1964
+ADDRGP4 $1966
+ARGP4
+ADDRLP4 1056
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1048
+ADDRLP4 1056
+INDIRF4
+CVFI4 4
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+pop
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRLP4 1052
+ARGP4
+ADDRGP4 UI_SelectedMap
+CALLP4
+pop
+ADDRLP4 1052
+INDIRI4
+ARGI4
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRLP4 1060
+ADDRGP4 UI_SetNextMap
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $1967
+ADDRGP4 $1968
+JUMPV
+LABELV $1967
+ADDRLP4 1064
+CNSTI4 0
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 184
+ARGI4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRGP4 UI_GameType_HandleKey
+CALLI4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 $1962
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+LABELV $1968
+LABELV $1964
+ADDRLP4 1040
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1239
+ARGP4
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1972
+ARGP4
+CNSTI4 100
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $764
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1044
+ADDRLP4 1052
+INDIRF4
+ASGNF4
+ADDRGP4 $1976
+ARGP4
+CNSTI4 100
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1022
+ARGP4
+ADDRLP4 1056
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRGP4 $1979
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $673
+ARGP4
+ADDRLP4 1064
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1036
+ADDRLP4 1064
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1980
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $674
+ARGP4
+ADDRLP4 1068
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1036
+ADDRLP4 1068
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1981
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_SetCapFragLimits
+CALLV
+pop
+ADDRGP4 $1982
+ARGP4
+ADDRLP4 1072
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1036
+ADDRLP4 1072
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1983
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1984
+ARGP4
+ADDRLP4 1076
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1036
+ADDRLP4 1076
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1985
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1986
+ARGP4
+ADDRLP4 1080
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1036
+ADDRLP4 1080
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1987
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1988
+ARGP4
+ADDRLP4 1084
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1036
+ADDRLP4 1084
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1989
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1990
+ARGP4
+ADDRLP4 1088
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1036
+ADDRLP4 1088
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1991
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1992
+ARGP4
+ADDRLP4 1092
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1036
+ADDRLP4 1092
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1993
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1982
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1984
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1990
+ARGP4
+CNSTF4 1097859072
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1992
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1986
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $657
+ARGP4
+ADDRLP4 1096
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $1994
+ARGP4
+ADDRLP4 1096
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1022
+ARGP4
+ADDRLP4 1100
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $1995
+ARGP4
+ADDRLP4 1100
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1998
+ARGP4
+ADDRLP4 1104
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1104
+INDIRF4
+CNSTF4 0
+EQF4 $1996
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $1999
+ARGP4
+CNSTI4 100
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $2003
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1996
+ADDRLP4 1032
+CNSTI4 500
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 1
+NEI4 $2004
+ADDRGP4 $1988
+ARGP4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2006
+ARGP4
+CNSTI4 100
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+12
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRF4
+ARGF4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2005
+JUMPV
+LABELV $2004
+ADDRLP4 1036
+CNSTI4 100
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+16
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+ADDRGP4 $1988
+ARGP4
+ADDRLP4 1036
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2016
+JUMPV
+LABELV $2013
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 1028
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+8
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1112
+ADDRGP4 UI_AIFromName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2020
+ARGP4
+ADDRLP4 1112
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRF4
+ARGF4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $2026
+ADDRLP4 1108
+ADDRGP4 $631
+ASGNP4
+ADDRGP4 $2027
+JUMPV
+LABELV $2026
+ADDRLP4 1108
+ADDRGP4 $779
+ASGNP4
+LABELV $2027
+ADDRLP4 1108
+INDIRP4
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 1028
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+8
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+LABELV $2014
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2016
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+16
+ADDP4
+INDIRI4
+LTI4 $2013
+ADDRGP4 $657
+ARGP4
+ADDRLP4 1108
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 1108
+INDIRP4
+ARGP4
+ADDRLP4 1112
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2031
+JUMPV
+LABELV $2028
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 1028
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+8
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1120
+ADDRGP4 UI_AIFromName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2020
+ARGP4
+ADDRLP4 1120
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRF4
+ARGF4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $2040
+ADDRLP4 1116
+ADDRGP4 $631
+ASGNP4
+ADDRGP4 $2041
+JUMPV
+LABELV $2040
+ADDRLP4 1116
+ADDRGP4 $780
+ASGNP4
+LABELV $2041
+ADDRLP4 1116
+INDIRP4
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 1028
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+8
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+LABELV $2029
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2031
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+16
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+LTI4 $2028
+LABELV $2005
+ADDRLP4 1040
+INDIRI4
+CNSTI4 3
+LTI4 $2042
+ADDRGP4 $2044
+ARGP4
+ADDRGP4 $2045
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $2042
+LABELV $1963
+endproc UI_StartSkirmish 1124 32
+proc UI_Update 36 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2049
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2047
+ADDRGP4 $2050
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $1328
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2048
+JUMPV
+LABELV $2047
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2053
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2051
+ADDRGP4 $2054
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1167867904
+LTF4 $2055
+ADDRGP4 $2057
+ARGP4
+CNSTF4 1106247680
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2058
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2052
+JUMPV
+LABELV $2055
+ADDRLP4 16
+INDIRF4
+CNSTF4 1165623296
+LTF4 $2059
+ADDRGP4 $2057
+ARGP4
+CNSTF4 1097859072
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2058
+ARGP4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2052
+JUMPV
+LABELV $2059
+ADDRGP4 $2057
+ARGP4
+CNSTF4 1097859072
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2058
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2052
+JUMPV
+LABELV $2051
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2063
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $2061
+ADDRGP4 $1328
+ARGP4
+ADDRLP4 20
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $2050
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2062
+JUMPV
+LABELV $2061
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2066
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $2064
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 16
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $2072
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GTI4 $2075
+LABELV $2074
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2069
+ADDRGP4 $2065
+JUMPV
+LABELV $2075
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+EQI4 $2073
+ADDRGP4 $2065
+JUMPV
+LABELV $2069
+ADDRGP4 $2070
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2071
+ARGP4
+ADDRGP4 trap_Cvar_Reset
+CALLV
+pop
+ADDRGP4 $2065
+JUMPV
+LABELV $2072
+ADDRGP4 $2070
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2071
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2065
+JUMPV
+LABELV $2073
+ADDRGP4 $2070
+ARGP4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2071
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2065
+JUMPV
+LABELV $2064
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2078
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $2076
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2081
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $2083
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+EQI4 $2084
+ADDRGP4 $2077
+JUMPV
+LABELV $2081
+ADDRGP4 $2082
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2077
+JUMPV
+LABELV $2083
+ADDRGP4 $2082
+ARGP4
+CNSTF4 1094713344
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2077
+JUMPV
+LABELV $2084
+ADDRGP4 $2082
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2077
+JUMPV
+LABELV $2076
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2087
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $2085
+ADDRLP4 32
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LTI4 $2086
+ADDRLP4 32
+INDIRI4
+CNSTI4 3
+GTI4 $2086
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2109
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2109
+address $2090
+address $2104
+address $2106
+address $2108
+code
+LABELV $2090
+ADDRGP4 $2091
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2082
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2092
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2078
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2066
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2070
+ARGP4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2071
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2093
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2094
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2095
+ARGP4
+ADDRGP4 $2096
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2097
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2098
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2099
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2100
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2101
+ARGP4
+CNSTF4 1159479296
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2102
+ARGP4
+ADDRGP4 $2103
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2086
+JUMPV
+LABELV $2104
+ADDRGP4 $2091
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2082
+ARGP4
+CNSTF4 1094713344
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2092
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2078
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2066
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2070
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2071
+ARGP4
+ADDRGP4 trap_Cvar_Reset
+CALLV
+pop
+ADDRGP4 $2093
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2094
+ARGP4
+CNSTF4 1077936128
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2095
+ARGP4
+ADDRGP4 $2105
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2097
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2098
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2099
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2101
+ARGP4
+CNSTF4 1159479296
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2102
+ARGP4
+ADDRGP4 $2103
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2100
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2086
+JUMPV
+LABELV $2106
+ADDRGP4 $2091
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2082
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2092
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2078
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2066
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2070
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2071
+ARGP4
+ADDRGP4 trap_Cvar_Reset
+CALLV
+pop
+ADDRGP4 $2093
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2094
+ARGP4
+CNSTF4 1077936128
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2095
+ARGP4
+ADDRGP4 $2105
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2097
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2100
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2098
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2099
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2101
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2102
+ARGP4
+ADDRGP4 $2107
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2086
+JUMPV
+LABELV $2108
+ADDRGP4 $2091
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2082
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2092
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2078
+ARGP4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2066
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2070
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2071
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2094
+ARGP4
+CNSTF4 1077936128
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2095
+ARGP4
+ADDRGP4 $2105
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2093
+ARGP4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2097
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2100
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2101
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2098
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2099
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2102
+ARGP4
+ADDRGP4 $2107
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2086
+JUMPV
+LABELV $2085
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2112
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $2110
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2113
+ADDRGP4 $2115
+ARGP4
+CNSTF4 1018444120
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2114
+JUMPV
+LABELV $2113
+ADDRGP4 $2115
+ARGP4
+CNSTF4 3165927768
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $2114
+LABELV $2110
+LABELV $2086
+LABELV $2077
+LABELV $2065
+LABELV $2062
+LABELV $2052
+LABELV $2048
+LABELV $2046
+endproc UI_Update 36 8
+export UI_ForceMenuOff
+proc UI_ForceMenuOff 4 8
+ADDRLP4 0
+ADDRGP4 Key_GetCatcher
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -3
+BANDI4
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+ADDRGP4 $2117
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+LABELV $2116
+endproc UI_ForceMenuOff 4 8
+export UI_EnterMenu
+proc UI_EnterMenu 0 8
+CNSTI4 2
+ARGI4
+ADDRGP4 Key_SetCatcher
+CALLV
+pop
+ADDRGP4 $2117
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $2118
+endproc UI_EnterMenu 0 8
+proc UI_RunMenuScript 1328 24
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 1032
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+EQI4 $2120
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2124
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $2122
+ADDRGP4 $1979
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 ui_dedicated+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1056
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $2125
+ARGP4
+ADDRLP4 1056
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2127
+ARGP4
+ADDRGP4 ui_dedicated+12
+INDIRI4
+CNSTI4 2
+NEI4 $2130
+ADDRLP4 1060
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2131
+JUMPV
+LABELV $2130
+ADDRLP4 1060
+CNSTI4 0
+ASGNI4
+LABELV $2131
+ADDRLP4 1060
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $1239
+ARGP4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $657
+ARGP4
+ADDRLP4 1064
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $1994
+ARGP4
+ADDRLP4 1064
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1022
+ARGP4
+ADDRLP4 1068
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 $1995
+ARGP4
+ADDRLP4 1068
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $1972
+ARGP4
+CNSTI4 100
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1072
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $764
+ARGP4
+ADDRLP4 1076
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1048
+ADDRLP4 1076
+INDIRF4
+ASGNF4
+ADDRGP4 $1988
+ARGP4
+ADDRLP4 1080
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1052
+ADDRLP4 1080
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1084
+CNSTI4 0
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+LABELV $2138
+ADDRGP4 $786
+ARGP4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1092
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1092
+INDIRP4
+ARGP4
+ADDRLP4 1096
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1088
+ADDRLP4 1096
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+LTI4 $2142
+ADDRLP4 1044
+ADDRLP4 1044
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2142
+ADDRGP4 $787
+ARGP4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1100
+INDIRP4
+ARGP4
+ADDRLP4 1104
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1088
+ADDRLP4 1104
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+LTI4 $2144
+ADDRLP4 1044
+ADDRLP4 1044
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2144
+LABELV $2139
+ADDRLP4 1040
+ADDRLP4 1040
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 5
+LTI4 $2138
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $2146
+ADDRLP4 1044
+CNSTI4 8
+ASGNI4
+LABELV $2146
+ADDRLP4 1052
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+LEI4 $2148
+ADDRLP4 1044
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+LABELV $2148
+ADDRGP4 $1988
+ARGP4
+ADDRLP4 1044
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+LABELV $2150
+ADDRGP4 $786
+ARGP4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1092
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1092
+INDIRP4
+ARGP4
+ADDRLP4 1096
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1088
+ADDRLP4 1096
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 1
+LEI4 $2154
+ADDRLP4 1088
+INDIRI4
+CNSTI4 2
+NEI4 $2156
+ADDRLP4 1024
+ADDRGP4 $2158
+ASGNP4
+ADDRGP4 $2157
+JUMPV
+LABELV $2156
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LTI4 $2159
+ADDRLP4 1024
+CNSTI4 24
+ADDRLP4 1088
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156-72
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2160
+JUMPV
+LABELV $2159
+ADDRLP4 1088
+INDIRI4
+CNSTI4 3
+SUBI4
+ARGI4
+ADDRLP4 1100
+ADDRGP4 UI_GetBotNameByNumber
+CALLP4
+ASGNP4
+ADDRLP4 1024
+ADDRLP4 1100
+INDIRP4
+ASGNP4
+LABELV $2160
+LABELV $2157
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LTI4 $2164
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2167
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1048
+INDIRF4
+ARGF4
+ADDRGP4 $779
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $2165
+JUMPV
+LABELV $2164
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2168
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1048
+INDIRF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $2165
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $2154
+ADDRGP4 $787
+ARGP4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1100
+INDIRP4
+ARGP4
+ADDRLP4 1104
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1088
+ADDRLP4 1104
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 1
+LEI4 $2169
+ADDRLP4 1088
+INDIRI4
+CNSTI4 2
+NEI4 $2171
+ADDRLP4 1024
+ADDRGP4 $2158
+ASGNP4
+ADDRGP4 $2172
+JUMPV
+LABELV $2171
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LTI4 $2173
+ADDRLP4 1024
+CNSTI4 24
+ADDRLP4 1088
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156-72
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2174
+JUMPV
+LABELV $2173
+ADDRLP4 1088
+INDIRI4
+CNSTI4 3
+SUBI4
+ARGI4
+ADDRLP4 1108
+ADDRGP4 UI_GetBotNameByNumber
+CALLP4
+ASGNP4
+ADDRLP4 1024
+ADDRLP4 1108
+INDIRP4
+ASGNP4
+LABELV $2174
+LABELV $2172
+ADDRGP4 ui_actualNetGameType+12
+INDIRI4
+CNSTI4 3
+LTI4 $2178
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2167
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1048
+INDIRF4
+ARGF4
+ADDRGP4 $780
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $2179
+JUMPV
+LABELV $2178
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $2168
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1048
+INDIRF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $2179
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $2169
+LABELV $2151
+ADDRLP4 1040
+ADDRLP4 1040
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 5
+LTI4 $2150
+ADDRGP4 $2123
+JUMPV
+LABELV $2122
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2183
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $2181
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_SetCapFragLimits
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+pop
+ADDRGP4 ui_currentMap+12
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ADDRGP4 UI_GetIndexFromSelection
+CALLI4
+ASGNI4
+ADDRGP4 ui_mapIndex+12
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRGP4 $1966
+ARGP4
+ADDRGP4 ui_mapIndex+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 ui_mapIndex+12
+INDIRI4
+ARGI4
+ADDRGP4 $1962
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRLP4 1048
+CNSTI4 0
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 184
+ARGI4
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRGP4 UI_GameType_HandleKey
+CALLI4
+pop
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+CNSTI4 185
+ARGI4
+ADDRLP4 1052
+INDIRI4
+ARGI4
+ADDRGP4 UI_GameType_HandleKey
+CALLI4
+pop
+ADDRGP4 $2182
+JUMPV
+LABELV $2181
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2190
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $2188
+CNSTI4 2
+ARGI4
+ADDRGP4 $2191
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2192
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 Controls_SetDefaults_ui_shared
+CALLV
+pop
+ADDRGP4 $2193
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2194
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2189
+JUMPV
+LABELV $2188
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2197
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $2195
+ADDRGP4 UI_LoadArenasIntoMapList
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 $2198
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 $2196
+JUMPV
+LABELV $2195
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2201
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $2199
+CNSTI4 1
+ARGI4
+ADDRGP4 Controls_SetConfig_ui_shared
+CALLV
+pop
+ADDRGP4 $2200
+JUMPV
+LABELV $2199
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2204
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $2202
+ADDRGP4 Controls_GetConfig_ui_shared
+CALLV
+pop
+ADDRGP4 $2203
+JUMPV
+LABELV $2202
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2207
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $2205
+ADDRGP4 $2208
+ARGP4
+ADDRGP4 $631
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $2206
+JUMPV
+LABELV $2205
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2211
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $2209
+ADDRGP4 $605
+ARGP4
+ADDRGP4 UI_ParseGameInfo
+CALLV
+pop
+CNSTI4 100
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_LoadBestScores
+CALLV
+pop
+ADDRGP4 $2210
+JUMPV
+LABELV $2209
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2220
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $2218
+ADDRGP4 UI_ClearScores
+CALLV
+pop
+ADDRGP4 $2219
+JUMPV
+LABELV $2218
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2223
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $2221
+ADDRLP4 1076
+CNSTI4 1
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+ARGI4
+ADDRLP4 1076
+INDIRI4
+ARGI4
+ADDRGP4 UI_StartServerRefresh
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+ADDRGP4 $2222
+JUMPV
+LABELV $2221
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2226
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $2224
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_StartServerRefresh
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+ADDRGP4 $2225
+JUMPV
+LABELV $2224
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2229
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $2227
+ADDRGP4 uiInfo+104140
+INDIRI4
+CNSTI4 0
+EQI4 $2228
+ADDRGP4 $2233
+ARGP4
+CNSTI4 100
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1084
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1084
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2228
+JUMPV
+LABELV $2227
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2242
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $2240
+ADDRGP4 UI_LoadDemos
+CALLV
+pop
+ADDRGP4 $2241
+JUMPV
+LABELV $2240
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2245
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $2243
+ADDRGP4 UI_LoadMovies
+CALLV
+pop
+ADDRGP4 $2244
+JUMPV
+LABELV $2243
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2248
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1092
+INDIRI4
+CNSTI4 0
+NEI4 $2246
+ADDRGP4 UI_LoadMods
+CALLV
+pop
+ADDRGP4 $2247
+JUMPV
+LABELV $2246
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2251
+ARGP4
+ADDRLP4 1096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+NEI4 $2249
+ADDRGP4 uiInfo+131248
+INDIRI4
+CNSTI4 0
+LTI4 $2252
+ADDRGP4 uiInfo+131248
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+LABELV $2252
+ADDRGP4 $2256
+ARGP4
+ADDRGP4 uiInfo+131244
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+130216
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1100
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1100
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2250
+JUMPV
+LABELV $2249
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2261
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+NEI4 $2259
+ADDRGP4 $2262
+ARGP4
+ADDRGP4 uiInfo+128156
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+127640
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2265
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2260
+JUMPV
+LABELV $2259
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2268
+ARGP4
+ADDRLP4 1104
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $2266
+ADDRGP4 $2269
+ARGP4
+ADDRGP4 uiInfo+130212
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+128160
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1108
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2267
+JUMPV
+LABELV $2266
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2274
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $2272
+ADDRGP4 $2262
+ARGP4
+ADDRGP4 $2275
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2265
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2273
+JUMPV
+LABELV $2272
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2278
+ARGP4
+ADDRLP4 1112
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $2276
+ADDRGP4 uiInfo+131252+2212
+INDIRI4
+CNSTI4 0
+EQI4 $2279
+ADDRGP4 UI_StopServerRefresh
+CALLV
+pop
+ADDRGP4 uiInfo+131252+10420
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+146116
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+151444
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+ADDRGP4 $2277
+JUMPV
+LABELV $2279
+ADDRGP4 $2287
+ARGP4
+ADDRGP4 Menus_CloseByName
+CALLV
+pop
+ADDRGP4 $2288
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+ADDRGP4 $2277
+JUMPV
+LABELV $2276
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2291
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $2289
+ADDRGP4 UI_StopServerRefresh
+CALLV
+pop
+ADDRGP4 uiInfo+131252+10420
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+146116
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+151444
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2290
+JUMPV
+LABELV $2289
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2298
+ARGP4
+ADDRLP4 1120
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $2296
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_StartServerRefresh
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+CNSTF4 1073741824
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_FeederSelection
+CALLV
+pop
+ADDRGP4 UI_LoadMods
+CALLV
+pop
+ADDRGP4 $2297
+JUMPV
+LABELV $2296
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2301
+ARGP4
+ADDRLP4 1124
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1124
+INDIRI4
+CNSTI4 0
+NEI4 $2299
+ADDRLP4 1128
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+131252+2216
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+131252+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+142720
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_LAN_GetServerAddressString
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerStatus
+CALLV
+pop
+ADDRGP4 $2300
+JUMPV
+LABELV $2299
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2310
+ARGP4
+ADDRLP4 1128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+CNSTI4 0
+NEI4 $2308
+ADDRGP4 uiInfo+142720
+ARGP4
+ADDRGP4 uiInfo+151436
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+149388
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerStatus
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 14
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 $2309
+JUMPV
+LABELV $2308
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2317
+ARGP4
+ADDRLP4 1132
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1132
+INDIRI4
+CNSTI4 0
+NEI4 $2315
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildFindPlayerList
+CALLV
+pop
+ADDRGP4 uiInfo+142784+3328
+CNSTI4 0
+ASGNI4
+CNSTP4 0
+ARGP4
+CNSTI4 14
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 $2316
+JUMPV
+LABELV $2315
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2322
+ARGP4
+ADDRLP4 1136
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1136
+INDIRI4
+CNSTI4 0
+NEI4 $2320
+ADDRGP4 $1979
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 uiInfo+131252+2216
+INDIRI4
+CNSTI4 0
+LTI4 $2321
+ADDRGP4 uiInfo+131252+2216
+INDIRI4
+ADDRGP4 uiInfo+131252+10412
+INDIRI4
+GEI4 $2321
+ADDRLP4 1140
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 1140
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+131252+2216
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+131252+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerAddressString
+CALLV
+pop
+ADDRGP4 $2335
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1144
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2321
+JUMPV
+LABELV $2320
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2338
+ARGP4
+ADDRLP4 1140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1140
+INDIRI4
+CNSTI4 0
+NEI4 $2336
+ADDRGP4 $1979
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 uiInfo+151436
+INDIRI4
+CNSTI4 0
+LTI4 $2337
+ADDRGP4 uiInfo+151436
+INDIRI4
+ADDRGP4 uiInfo+151440
+INDIRI4
+GEI4 $2337
+ADDRGP4 $2335
+ARGP4
+ADDRGP4 uiInfo+151436
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+149388
+ADDP4
+ARGP4
+ADDRLP4 1144
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2337
+JUMPV
+LABELV $2336
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2348
+ARGP4
+ADDRLP4 1144
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1144
+INDIRI4
+CNSTI4 0
+NEI4 $2346
+ADDRGP4 $1979
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 $2349
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2347
+JUMPV
+LABELV $2346
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2352
+ARGP4
+ADDRLP4 1148
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1148
+INDIRI4
+CNSTI4 0
+NEI4 $2350
+ADDRGP4 UI_EnterMenu
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $2353
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $2351
+JUMPV
+LABELV $2350
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2356
+ARGP4
+ADDRLP4 1152
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1152
+INDIRI4
+CNSTI4 0
+NEI4 $2354
+CNSTI4 2
+ARGI4
+ADDRGP4 $2357
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 UI_EnterMenu
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $2288
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $2355
+JUMPV
+LABELV $2354
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2360
+ARGP4
+ADDRLP4 1156
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1156
+INDIRI4
+CNSTI4 0
+NEI4 $2358
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1160
+ARGP4
+ADDRLP4 1164
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1164
+INDIRI4
+CNSTI4 0
+EQI4 $2359
+ADDRLP4 1160
+INDIRI4
+ADDRGP4 uiInfo+131252+2200
+INDIRI4
+NEI4 $2363
+ADDRGP4 uiInfo+131252+2204
+INDIRI4
+CNSTI4 0
+NEI4 $2372
+ADDRLP4 1168
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2373
+JUMPV
+LABELV $2372
+ADDRLP4 1168
+CNSTI4 0
+ASGNI4
+LABELV $2373
+ADDRGP4 uiInfo+131252+2204
+ADDRLP4 1168
+INDIRI4
+ASGNI4
+LABELV $2363
+ADDRLP4 1160
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_ServersSort
+CALLV
+pop
+ADDRGP4 $2359
+JUMPV
+LABELV $2358
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2376
+ARGP4
+ADDRLP4 1160
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1160
+INDIRI4
+CNSTI4 0
+NEI4 $2374
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_StartSkirmish
+CALLV
+pop
+ADDRGP4 $2375
+JUMPV
+LABELV $2374
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2379
+ARGP4
+ADDRLP4 1164
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1164
+INDIRI4
+CNSTI4 0
+NEI4 $2377
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_StartSkirmish
+CALLV
+pop
+ADDRGP4 $2378
+JUMPV
+LABELV $2377
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2382
+ARGP4
+ADDRLP4 1168
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1168
+INDIRI4
+CNSTI4 0
+NEI4 $2380
+ADDRGP4 UI_ForceMenuOff
+CALLV
+pop
+ADDRGP4 $2381
+JUMPV
+LABELV $2380
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2385
+ARGP4
+ADDRLP4 1172
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1172
+INDIRI4
+CNSTI4 0
+NEI4 $2383
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+CNSTI4 0
+LTI4 $2384
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+ADDRGP4 uiInfo+114188
+INDIRI4
+GEI4 $2384
+ADDRGP4 $2391
+ARGP4
+CNSTI4 100
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1176
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1176
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2384
+JUMPV
+LABELV $2383
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2397
+ARGP4
+ADDRLP4 1176
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1176
+INDIRI4
+CNSTI4 0
+NEI4 $2395
+ADDRGP4 uiInfo+109568
+INDIRI4
+CNSTI4 0
+LTI4 $2396
+ADDRGP4 uiInfo+109568
+INDIRI4
+ADDRGP4 uiInfo+109552
+INDIRI4
+GEI4 $2396
+ADDRGP4 $2403
+ARGP4
+ADDRGP4 uiInfo+109568
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+111628
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1180
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1180
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2396
+JUMPV
+LABELV $2395
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2408
+ARGP4
+ADDRLP4 1180
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1180
+INDIRI4
+CNSTI4 0
+NEI4 $2406
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 0
+LTI4 $2407
+ADDRGP4 ui_netGameType+12
+INDIRI4
+ADDRGP4 uiInfo+109284
+INDIRI4
+GEI4 $2407
+ADDRGP4 $2414
+ARGP4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1184
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1184
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2407
+JUMPV
+LABELV $2406
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2420
+ARGP4
+ADDRLP4 1184
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1184
+INDIRI4
+CNSTI4 0
+NEI4 $2418
+ADDRGP4 uiInfo+109560
+INDIRI4
+CNSTI4 0
+LTI4 $2419
+ADDRGP4 uiInfo+109560
+INDIRI4
+ADDRGP4 uiInfo+109556
+INDIRI4
+GEI4 $2419
+ADDRGP4 $2426
+ARGP4
+ADDRGP4 uiInfo+109560
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+111884
+ADDP4
+ARGP4
+ADDRLP4 1188
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1188
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2419
+JUMPV
+LABELV $2418
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2431
+ARGP4
+ADDRLP4 1188
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1188
+INDIRI4
+CNSTI4 0
+NEI4 $2429
+ADDRGP4 uiInfo+104152
+INDIRI4
+CNSTI4 0
+NEI4 $2432
+ADDRLP4 1024
+ADDRGP4 $2158
+ASGNP4
+ADDRGP4 $2433
+JUMPV
+LABELV $2432
+ADDRGP4 $1239
+ARGP4
+ADDRLP4 1192
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1192
+INDIRF4
+CNSTF4 1077936128
+LTF4 $2435
+ADDRLP4 1024
+CNSTI4 24
+ADDRGP4 uiInfo+104152
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156-24
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2436
+JUMPV
+LABELV $2435
+ADDRGP4 uiInfo+104152
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 1196
+ADDRGP4 UI_GetBotNameByNumber
+CALLP4
+ASGNP4
+ADDRLP4 1024
+ADDRLP4 1196
+INDIRP4
+ASGNP4
+LABELV $2436
+LABELV $2433
+ADDRGP4 $2441
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+127636
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 uiInfo+109548
+INDIRI4
+CNSTI4 0
+NEI4 $2446
+ADDRLP4 1196
+ADDRGP4 $2045
+ASGNP4
+ADDRGP4 $2447
+JUMPV
+LABELV $2446
+ADDRLP4 1196
+ADDRGP4 $2444
+ASGNP4
+LABELV $2447
+ADDRLP4 1196
+INDIRP4
+ARGP4
+ADDRLP4 1200
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 1200
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2430
+JUMPV
+LABELV $2429
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2450
+ARGP4
+ADDRLP4 1192
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1192
+INDIRI4
+CNSTI4 0
+NEI4 $2448
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 7
+EQI4 $2449
+ADDRLP4 1296
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 1296
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+131252+2216
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+131252+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRLP4 1300
+CNSTI1 0
+ASGNI1
+ADDRLP4 1196
+ADDRLP4 1300
+INDIRI1
+ASGNI1
+ADDRLP4 1260
+ADDRLP4 1300
+INDIRI1
+ASGNI1
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2458
+ARGP4
+ADDRLP4 1304
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1260
+ARGP4
+ADDRLP4 1304
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2459
+ARGP4
+ADDRLP4 1308
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1196
+ARGP4
+ADDRLP4 1308
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1260
+ARGP4
+ADDRLP4 1312
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1312
+INDIRU4
+CNSTU4 0
+EQU4 $2449
+ADDRLP4 1196
+ARGP4
+ADDRLP4 1316
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1316
+INDIRU4
+CNSTU4 0
+EQU4 $2449
+CNSTI4 1
+ARGI4
+ADDRLP4 1260
+ARGP4
+ADDRLP4 1196
+ARGP4
+ADDRLP4 1320
+ADDRGP4 trap_LAN_AddServer
+CALLI4
+ASGNI4
+ADDRLP4 1292
+ADDRLP4 1320
+INDIRI4
+ASGNI4
+ADDRLP4 1292
+INDIRI4
+CNSTI4 0
+NEI4 $2462
+ADDRGP4 $2464
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2449
+JUMPV
+LABELV $2462
+ADDRLP4 1292
+INDIRI4
+CNSTI4 -1
+NEI4 $2465
+ADDRGP4 $2467
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2449
+JUMPV
+LABELV $2465
+ADDRGP4 $2468
+ARGP4
+ADDRLP4 1196
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2449
+JUMPV
+LABELV $2448
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2471
+ARGP4
+ADDRLP4 1196
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1196
+INDIRI4
+CNSTI4 0
+NEI4 $2469
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 7
+NEI4 $2470
+CNSTI4 1
+ARGI4
+ADDRGP4 uiInfo+131252+2216
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+131252+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRLP4 1200
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ARGP4
+ADDRGP4 $2459
+ARGP4
+ADDRLP4 1264
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1200
+ARGP4
+ADDRLP4 1264
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1200
+ARGP4
+ADDRLP4 1268
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1268
+INDIRU4
+CNSTU4 0
+EQU4 $2470
+CNSTI4 1
+ARGI4
+ADDRLP4 1200
+ARGP4
+ADDRGP4 trap_LAN_RemoveServer
+CALLV
+pop
+ADDRGP4 $2470
+JUMPV
+LABELV $2469
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2483
+ARGP4
+ADDRLP4 1200
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1200
+INDIRI4
+CNSTI4 0
+NEI4 $2481
+ADDRLP4 1304
+CNSTI1 0
+ASGNI1
+ADDRLP4 1204
+ADDRLP4 1304
+INDIRI1
+ASGNI1
+ADDRLP4 1268
+ADDRLP4 1304
+INDIRI1
+ASGNI1
+ADDRGP4 $2484
+ARGP4
+ADDRLP4 1308
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 1268
+ARGP4
+ADDRLP4 1308
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2485
+ARGP4
+ADDRLP4 1312
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 1204
+ARGP4
+ADDRLP4 1312
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1268
+ARGP4
+ADDRLP4 1316
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1316
+INDIRU4
+CNSTU4 0
+EQU4 $2482
+ADDRLP4 1204
+ARGP4
+ADDRLP4 1320
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1320
+INDIRU4
+CNSTU4 0
+EQU4 $2482
+CNSTI4 1
+ARGI4
+ADDRLP4 1268
+ARGP4
+ADDRLP4 1204
+ARGP4
+ADDRLP4 1324
+ADDRGP4 trap_LAN_AddServer
+CALLI4
+ASGNI4
+ADDRLP4 1300
+ADDRLP4 1324
+INDIRI4
+ASGNI4
+ADDRLP4 1300
+INDIRI4
+CNSTI4 0
+NEI4 $2488
+ADDRGP4 $2464
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2482
+JUMPV
+LABELV $2488
+ADDRLP4 1300
+INDIRI4
+CNSTI4 -1
+NEI4 $2490
+ADDRGP4 $2467
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2482
+JUMPV
+LABELV $2490
+ADDRGP4 $2468
+ARGP4
+ADDRLP4 1204
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $2482
+JUMPV
+LABELV $2481
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2494
+ARGP4
+ADDRLP4 1204
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1204
+INDIRI4
+CNSTI4 0
+NEI4 $2492
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1208
+ARGP4
+ADDRLP4 1212
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1212
+INDIRI4
+CNSTI4 0
+EQI4 $2493
+ADDRGP4 $1310
+ARGP4
+ADDRLP4 1220
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1216
+ADDRLP4 1220
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1216
+INDIRI4
+ADDRGP4 uiInfo+109556
+INDIRI4
+GEI4 $2497
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1208
+INDIRP4
+ARGP4
+ADDRLP4 1216
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+113932
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2501
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $2498
+JUMPV
+LABELV $2497
+ADDRLP4 1224
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2505
+JUMPV
+LABELV $2502
+ADDRGP4 uiInfo+109572
+INDIRI4
+ADDRLP4 1224
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+113932
+ADDP4
+INDIRI4
+NEI4 $2507
+ADDRGP4 $2503
+JUMPV
+LABELV $2507
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1208
+INDIRP4
+ARGP4
+ADDRLP4 1224
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+113932
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2501
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $2503
+ADDRLP4 1224
+ADDRLP4 1224
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2505
+ADDRLP4 1224
+INDIRI4
+ADDRGP4 uiInfo+109556
+INDIRI4
+LTI4 $2502
+LABELV $2498
+ADDRGP4 UI_ForceMenuOff
+CALLV
+pop
+ADDRGP4 $2493
+JUMPV
+LABELV $2492
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2514
+ARGP4
+ADDRLP4 1208
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1208
+INDIRI4
+CNSTI4 0
+NEI4 $2512
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1212
+ARGP4
+ADDRLP4 1216
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1216
+INDIRI4
+CNSTI4 0
+EQI4 $2513
+ADDRGP4 $1310
+ARGP4
+ADDRLP4 1224
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1220
+ADDRLP4 1224
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1220
+INDIRI4
+ADDRGP4 uiInfo+109556
+INDIRI4
+NEI4 $2517
+CNSTI4 2
+ARGI4
+ADDRLP4 1212
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2501
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $2517
+ADDRGP4 UI_ForceMenuOff
+CALLV
+pop
+ADDRGP4 $2513
+JUMPV
+LABELV $2512
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2522
+ARGP4
+ADDRLP4 1212
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1212
+INDIRI4
+CNSTI4 0
+NEI4 $2520
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1216
+ARGP4
+ADDRLP4 1220
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1220
+INDIRI4
+CNSTI4 0
+EQI4 $2521
+ADDRGP4 $1310
+ARGP4
+ADDRLP4 1228
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 1224
+ADDRLP4 1228
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 1224
+INDIRI4
+ADDRGP4 uiInfo+109556
+INDIRI4
+GEI4 $2525
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1216
+INDIRP4
+ARGP4
+ADDRLP4 1224
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+113932
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $2501
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $2525
+ADDRGP4 UI_ForceMenuOff
+CALLV
+pop
+ADDRGP4 $2521
+JUMPV
+LABELV $2520
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2531
+ARGP4
+ADDRLP4 1216
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1216
+INDIRI4
+CNSTI4 0
+NEI4 $2529
+ADDRGP4 $2087
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $2530
+JUMPV
+LABELV $2529
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 $2534
+ARGP4
+ADDRLP4 1220
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1220
+INDIRI4
+CNSTI4 0
+NEI4 $2532
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1224
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1224
+INDIRI4
+CNSTI4 0
+EQI4 $2533
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 UI_Update
+CALLV
+pop
+ADDRGP4 $2533
+JUMPV
+LABELV $2532
+ADDRGP4 $2537
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2533
+LABELV $2530
+LABELV $2521
+LABELV $2513
+LABELV $2493
+LABELV $2482
+LABELV $2470
+LABELV $2449
+LABELV $2430
+LABELV $2419
+LABELV $2407
+LABELV $2396
+LABELV $2384
+LABELV $2381
+LABELV $2378
+LABELV $2375
+LABELV $2359
+LABELV $2355
+LABELV $2351
+LABELV $2347
+LABELV $2337
+LABELV $2321
+LABELV $2316
+LABELV $2309
+LABELV $2300
+LABELV $2297
+LABELV $2290
+LABELV $2277
+LABELV $2273
+LABELV $2267
+LABELV $2260
+LABELV $2250
+LABELV $2247
+LABELV $2244
+LABELV $2241
+LABELV $2228
+LABELV $2225
+LABELV $2222
+LABELV $2219
+LABELV $2210
+LABELV $2206
+LABELV $2203
+LABELV $2200
+LABELV $2196
+LABELV $2189
+LABELV $2182
+LABELV $2123
+LABELV $2120
+LABELV $2119
+endproc UI_RunMenuScript 1328 24
+proc UI_GetTeamColor 0 0
+LABELV $2538
+endproc UI_GetTeamColor 0 0
+proc UI_MapCountByGameType 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $2547
+ADDRLP4 12
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $2548
+JUMPV
+LABELV $2547
+ADDRLP4 12
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2548
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $2549
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2549
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+NEI4 $2551
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $2551
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2556
+JUMPV
+LABELV $2553
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+96
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+20
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $2560
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2564
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+20
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $2566
+ADDRGP4 $2554
+JUMPV
+LABELV $2566
+LABELV $2564
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+96
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $2560
+LABELV $2554
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2556
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+114188
+INDIRI4
+LTI4 $2553
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $2539
+endproc UI_MapCountByGameType 24 0
+export UI_hasSkinForBase
+proc UI_hasSkinForBase 68 20
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $2573
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 64
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $2574
+CNSTI4 1
+RETI4
+ADDRGP4 $2572
+JUMPV
+LABELV $2574
+CNSTI4 0
+RETI4
+LABELV $2572
+endproc UI_hasSkinForBase 68 20
+data
+align 4
+LABELV $2577
+byte 4 0
+code
+proc UI_HeadCountByTeam 44 8
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $2577
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $2578
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2583
+JUMPV
+LABELV $2580
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156+20
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2590
+JUMPV
+LABELV $2587
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156+12
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 44
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 UI_hasSkinForBase
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2592
+ADDRLP4 28
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156+20
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 8
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+LABELV $2592
+LABELV $2588
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2590
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+106464
+INDIRI4
+LTI4 $2587
+LABELV $2581
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2583
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+104148
+INDIRI4
+LTI4 $2580
+ADDRGP4 $2577
+CNSTI4 1
+ASGNI4
+LABELV $2578
+ADDRGP4 $657
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2602
+JUMPV
+LABELV $2599
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156+16
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $2606
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+8
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2610
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156+20
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 12
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $2614
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156+16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2608
+JUMPV
+LABELV $2614
+LABELV $2610
+LABELV $2607
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LTI4 $2606
+LABELV $2608
+LABELV $2600
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2602
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+104148
+INDIRI4
+LTI4 $2599
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $2620
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2627
+JUMPV
+LABELV $2624
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+105696
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2629
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+8
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+105696
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $2632
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2640
+JUMPV
+LABELV $2637
+ADDRLP4 36
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 uiInfo+104156+8
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $2642
+ADDRLP4 36
+INDIRI4
+ADDRGP4 uiInfo+104156+20
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 12
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $2642
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+105696+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 uiInfo+104156
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $2642
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156+16
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2639
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156+16
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2639
+JUMPV
+LABELV $2642
+LABELV $2638
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2640
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+104148
+INDIRI4
+LTI4 $2637
+LABELV $2639
+LABELV $2632
+LABELV $2629
+LABELV $2625
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2627
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+105692
+INDIRI4
+LTI4 $2624
+LABELV $2621
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+LTI4 $2620
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $2576
+endproc UI_HeadCountByTeam 44 8
+proc UI_InsertServerIntoDisplayList 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $2662
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+131252+10412
+INDIRI4
+LEI4 $2658
+LABELV $2662
+ADDRGP4 $2657
+JUMPV
+LABELV $2658
+ADDRLP4 8
+ADDRGP4 uiInfo+131252+10412
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 uiInfo+131252+10412
+INDIRI4
+ASGNI4
+ADDRGP4 $2668
+JUMPV
+LABELV $2665
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+131252+2220
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+131252+2220-4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2666
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2668
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+GTI4 $2665
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+131252+2220
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+131252+2216
+INDIRI4
+NEI4 $2678
+CNSTF4 1073741824
+ARGF4
+ADDRGP4 uiInfo+131252+2216
+INDIRI4
+ARGI4
+ADDRGP4 UI_FeederSelection
+CALLV
+pop
+LABELV $2678
+LABELV $2657
+endproc UI_InsertServerIntoDisplayList 16 8
+proc UI_RemoveServerFromDisplayList 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2688
+JUMPV
+LABELV $2685
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+131252+2220
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $2691
+ADDRLP4 8
+ADDRGP4 uiInfo+131252+10412
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $2700
+JUMPV
+LABELV $2697
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+131252+2220
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+131252+2220+4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2698
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2700
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+131252+10412
+INDIRI4
+LTI4 $2697
+ADDRGP4 $2684
+JUMPV
+LABELV $2691
+LABELV $2686
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2688
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+131252+10412
+INDIRI4
+LTI4 $2685
+LABELV $2684
+endproc UI_RemoveServerFromDisplayList 16 0
+proc UI_BinaryServerInsertion 32 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 uiInfo+131252+10412
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $2712
+JUMPV
+LABELV $2711
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+RSHI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+131252+2200
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+131252+2204
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+131252+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 trap_LAN_CompareServers
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2720
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 UI_InsertServerIntoDisplayList
+CALLV
+pop
+ADDRGP4 $2708
+JUMPV
+LABELV $2720
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $2722
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $2723
+JUMPV
+LABELV $2722
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $2723
+LABELV $2712
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $2711
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $2724
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2724
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_InsertServerIntoDisplayList
+CALLV
+pop
+LABELV $2708
+endproc UI_BinaryServerInsertion 32 20
+bss
+align 4
+LABELV $2727
+skip 4
+code
+proc UI_BuildServerDisplayList 1104 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2728
+ADDRGP4 uiInfo+212
+INDIRI4
+ADDRGP4 uiInfo+131252+10420
+INDIRI4
+GTI4 $2728
+ADDRGP4 $2726
+JUMPV
+LABELV $2728
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $2733
+ADDRFP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2733
+ADDRGP4 $2735
+ARGP4
+ADDRGP4 uiInfo+131252+10444
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 uiInfo+131252+10444
+ARGP4
+ADDRLP4 1056
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1052
+ADDRLP4 1056
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $2742
+ADDRGP4 uiInfo+131252+10444
+ARGP4
+ADDRGP4 $2746
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $2742
+ADDRLP4 1060
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2747
+ADDRLP4 1064
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2727
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+131252+10412
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+131252+10416
+CNSTI4 0
+ASGNI4
+CNSTP4 0
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+LABELV $2747
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1064
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 -1
+EQI4 $2756
+ADDRLP4 1072
+CNSTI4 0
+ASGNI4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ADDRLP4 1072
+INDIRI4
+NEI4 $2753
+ADDRLP4 1036
+INDIRI4
+ADDRLP4 1072
+INDIRI4
+NEI4 $2753
+LABELV $2756
+ADDRGP4 uiInfo+131252+10412
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+131252+10416
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+131252+10420
+ADDRGP4 uiInfo+212
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+ADDRGP4 $2726
+JUMPV
+LABELV $2753
+ADDRLP4 1076
+CNSTI4 0
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1076
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1076
+INDIRI4
+ASGNI4
+ADDRGP4 $2767
+JUMPV
+LABELV $2764
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1080
+ADDRGP4 trap_LAN_ServerIsVisible
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $2768
+ADDRGP4 $2765
+JUMPV
+LABELV $2768
+ADDRLP4 1044
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1084
+ADDRGP4 trap_LAN_GetServerPing
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $2773
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 7
+NEI4 $2770
+LABELV $2773
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 7
+NEI4 $2774
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 UI_RemoveServerFromDisplayList
+CALLV
+pop
+LABELV $2774
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRGP4 ui_browserShowBots+12
+INDIRI4
+CNSTI4 0
+NEI4 $2777
+ADDRLP4 12
+ARGP4
+ADDRGP4 $2780
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1088
+INDIRP4
+ARGP4
+ADDRLP4 1092
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRGP4 $2778
+JUMPV
+LABELV $2777
+ADDRLP4 12
+ARGP4
+ADDRGP4 $2781
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1088
+INDIRP4
+ARGP4
+ADDRLP4 1092
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+LABELV $2778
+ADDRGP4 ui_browserShowEmpty+12
+INDIRI4
+CNSTI4 0
+NEI4 $2782
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $2785
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $2765
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+ADDRGP4 $2765
+JUMPV
+LABELV $2785
+LABELV $2782
+ADDRGP4 ui_browserShowFull+12
+INDIRI4
+CNSTI4 0
+NEI4 $2789
+ADDRLP4 12
+ARGP4
+ADDRGP4 $1279
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1088
+INDIRP4
+ARGP4
+ADDRLP4 1092
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1048
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+NEI4 $2792
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $2765
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+ADDRGP4 $2765
+JUMPV
+LABELV $2792
+LABELV $2789
+ADDRLP4 1088
+CNSTI4 3
+ASGNI4
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+ADDRLP4 1088
+INDIRI4
+LSHI4
+ADDRGP4 uiInfo+109420+4
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $2796
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+ADDRLP4 1088
+INDIRI4
+LSHI4
+ADDRGP4 uiInfo+109420+4
+ADDP4
+INDIRI4
+CNSTI4 8
+GEI4 $2796
+ADDRLP4 12
+ARGP4
+ADDRGP4 $2806
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1092
+INDIRP4
+ARGP4
+ADDRGP4 ui_joinGameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109420+4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 bg_netGametypeNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1096
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+EQI4 $2804
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $2765
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+ADDRGP4 $2765
+JUMPV
+LABELV $2804
+LABELV $2796
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+CNSTI4 0
+LEI4 $2812
+ADDRLP4 12
+ARGP4
+ADDRGP4 $2817
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 ui_serverFilterType+12
+INDIRI4
+ARGI4
+ADDRLP4 1096
+ADDRGP4 UI_FilterDir
+CALLP4
+ASGNP4
+ADDRLP4 1092
+INDIRP4
+ARGP4
+ADDRLP4 1096
+INDIRP4
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1100
+INDIRI4
+CNSTI4 0
+EQI4 $2815
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $2765
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+ADDRGP4 $2765
+JUMPV
+LABELV $2815
+LABELV $2812
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 UI_BinaryServerInsertion
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LEI4 $2821
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+ADDRLP4 1092
+ADDRGP4 uiInfo+131252+10416
+ASGNP4
+ADDRLP4 1092
+INDIRP4
+ADDRLP4 1092
+INDIRP4
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 1096
+ADDRGP4 $2727
+ASGNP4
+ADDRLP4 1096
+INDIRP4
+ADDRLP4 1096
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2821
+LABELV $2770
+LABELV $2765
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2767
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+LTI4 $2764
+ADDRGP4 uiInfo+131252+2192
+ADDRGP4 uiInfo+212
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $2828
+LABELV $2828
+LABELV $2726
+endproc UI_BuildServerDisplayList 1104 16
+data
+export serverStatusCvars
+align 4
+LABELV serverStatusCvars
+address $2831
+address $2832
+address $2833
+address $631
+address $2262
+address $2834
+address $2835
+address $2836
+address $2837
+address $2838
+address $1239
+address $2839
+address $2840
+address $2841
+address $2842
+address $631
+address $2843
+address $631
+address $2844
+address $631
+address $2845
+address $631
+address $2846
+address $631
+address $674
+address $631
+address $673
+address $631
+byte 4 0
+byte 4 0
+code
+proc UI_SortServerStatusInfo 64 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $2851
+JUMPV
+LABELV $2848
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2855
+JUMPV
+LABELV $2852
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2858
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2856
+LABELV $2858
+ADDRGP4 $2853
+JUMPV
+LABELV $2856
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 serverStatusCvars
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $2859
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ADDRLP4 40
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 44
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 44
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LSHI4
+ADDRLP4 40
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 4
+ASGNI4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 56
+CNSTI4 12
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LSHI4
+ADDRLP4 52
+INDIRP4
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LSHI4
+ADDRLP4 52
+INDIRP4
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 serverStatusCvars+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 60
+INDIRU4
+CNSTU4 0
+EQU4 $2861
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 serverStatusCvars+4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2861
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2859
+LABELV $2853
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2855
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+LTI4 $2852
+LABELV $2849
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2851
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 serverStatusCvars
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2848
+LABELV $2847
+endproc UI_SortServerStatusInfo 64 8
+proc UI_GetServerStatusInfo 188 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2866
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 3332
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $2866
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2868
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2868
+CNSTI4 0
+RETI4
+ADDRGP4 $2865
+JUMPV
+LABELV $2868
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2870
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_ServerStatus
+CALLI4
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2865
+JUMPV
+LABELV $2870
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 2112
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 28
+ADDRGP4 trap_LAN_ServerStatus
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2872
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 2112
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRGP4 $2833
+ASGNP4
+ADDRLP4 44
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRGP4 $631
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $631
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2875
+JUMPV
+LABELV $2874
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 60
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2877
+ADDRGP4 $2876
+JUMPV
+LABELV $2877
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 64
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $2879
+ADDRGP4 $2876
+JUMPV
+LABELV $2879
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 76
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ADDRGP4 $631
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $631
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 84
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2881
+ADDRGP4 $2876
+JUMPV
+LABELV $2881
+ADDRLP4 88
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 88
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 128
+LTI4 $2883
+ADDRGP4 $2876
+JUMPV
+LABELV $2883
+LABELV $2875
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2885
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2874
+LABELV $2885
+LABELV $2876
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 125
+GEI4 $2886
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRGP4 $631
+ASGNP4
+ADDRLP4 72
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ADDRGP4 $631
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $631
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRGP4 $631
+ASGNP4
+ADDRLP4 84
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRGP4 $2888
+ASGNP4
+ADDRLP4 96
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ADDRGP4 $2889
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $2890
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRGP4 $1328
+ASGNP4
+ADDRLP4 108
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRGP4 $2892
+JUMPV
+LABELV $2891
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $2894
+ADDRLP4 116
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 116
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $2894
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 124
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 124
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2896
+ADDRGP4 $2893
+JUMPV
+LABELV $2896
+ADDRLP4 128
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 128
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 136
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2898
+ADDRGP4 $2893
+JUMPV
+LABELV $2898
+ADDRLP4 140
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 140
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3136
+ADDP4
+ADDP4
+ARGP4
+CNSTU4 192
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 $2900
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3136
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3136
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ADDRLP4 156
+INDIRU4
+CNSTU4 1
+ADDU4
+ADDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 164
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+ADDRLP4 164
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+ADDRLP4 164
+INDIRI4
+ADDP4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 176
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ADDRLP4 176
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3328
+ADDP4
+INDIRI4
+CNSTI4 128
+LTI4 $2901
+ADDRGP4 $2893
+JUMPV
+LABELV $2901
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 180
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2903
+ADDRGP4 $2893
+JUMPV
+LABELV $2903
+ADDRLP4 184
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 184
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2892
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2905
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2891
+LABELV $2905
+LABELV $2893
+LABELV $2886
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_SortServerStatusInfo
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2865
+JUMPV
+LABELV $2872
+CNSTI4 0
+RETI4
+LABELV $2865
+endproc UI_GetServerStatusInfo 188 16
+proc stristr 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $2908
+JUMPV
+LABELV $2907
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2913
+JUMPV
+LABELV $2910
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $2914
+ADDRGP4 $2912
+JUMPV
+LABELV $2914
+LABELV $2911
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2913
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+EQI4 $2916
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+NEI4 $2910
+LABELV $2916
+LABELV $2912
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2917
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $2906
+JUMPV
+LABELV $2917
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $2908
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2907
+CNSTP4 0
+RETP4
+LABELV $2906
+endproc stristr 12 4
+bss
+align 4
+LABELV $2920
+skip 4
+align 4
+LABELV $2921
+skip 4
+code
+proc UI_BuildFindPlayerList 4428 24
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2922
+ADDRGP4 uiInfo+151444
+INDIRI4
+CNSTI4 0
+EQI4 $2929
+ADDRGP4 uiInfo+151444
+INDIRI4
+ADDRGP4 uiInfo+212
+INDIRI4
+LEI4 $2923
+LABELV $2929
+ADDRGP4 $2919
+JUMPV
+LABELV $2922
+ADDRGP4 uiInfo+146120
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2244
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 uiInfo+151440
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+151436
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2934
+ARGP4
+ADDRGP4 uiInfo+148364
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 uiInfo+148364
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRGP4 uiInfo+148364
+ARGP4
+ADDRLP4 4408
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 4408
+INDIRU4
+CNSTU4 0
+NEU4 $2938
+ADDRGP4 uiInfo+151444
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2919
+JUMPV
+LABELV $2938
+ADDRLP4 4404
+ADDRGP4 ui_serverStatusTimeOut+12
+INDIRI4
+CNSTI4 2
+DIVI4
+CNSTI4 10
+SUBI4
+ASGNI4
+ADDRLP4 4404
+INDIRI4
+CNSTI4 50
+GEI4 $2943
+ADDRLP4 4404
+CNSTI4 50
+ASGNI4
+LABELV $2943
+ADDRGP4 $2945
+ARGP4
+ADDRLP4 4404
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_ServerStatus
+CALLI4
+pop
+ADDRGP4 uiInfo+151440
+CNSTI4 1
+ASGNI4
+ADDRGP4 uiInfo+151440
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+150412-64
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $2953
+ARGP4
+ADDRGP4 uiInfo+146120
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $2920
+CNSTI4 0
+ASGNI4
+ADDRLP4 4412
+ADDRGP4 $2921
+ASGNP4
+ADDRLP4 4412
+INDIRP4
+ADDRLP4 4412
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2923
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2955
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+146120+4+136
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2959
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+146120+4
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 4408
+ADDRGP4 UI_GetServerStatusInfo
+CALLI4
+ASGNI4
+ADDRLP4 4408
+INDIRI4
+CNSTI4 0
+EQI4 $2964
+ADDRLP4 4412
+ADDRGP4 $2920
+ASGNP4
+ADDRLP4 4412
+INDIRP4
+ADDRLP4 4412
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2971
+JUMPV
+LABELV $2968
+ADDRLP4 4416
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 4416
+INDIRI4
+ADDRLP4 8+64+8
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2979
+ADDRLP4 4416
+INDIRI4
+ADDRLP4 8+64+8
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2973
+LABELV $2979
+ADDRGP4 $2969
+JUMPV
+LABELV $2973
+ADDRLP4 3340
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 8+64+12
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 34
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 3340
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 3340
+ARGP4
+ADDRGP4 uiInfo+148364
+ARGP4
+ADDRLP4 4420
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 4420
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2982
+ADDRGP4 uiInfo+151440
+INDIRI4
+CNSTI4 15
+GEI4 $2985
+ADDRGP4 uiInfo+151440
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+149388-64
+ADDP4
+ARGP4
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+146120+4
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 uiInfo+151440
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+150412-64
+ADDP4
+ARGP4
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+146120+4+64
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4424
+ADDRGP4 uiInfo+151440
+ASGNP4
+ADDRLP4 4424
+INDIRP4
+ADDRLP4 4424
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2986
+JUMPV
+LABELV $2985
+ADDRGP4 uiInfo+146120
+ADDRGP4 uiInfo+131252+10412
+INDIRI4
+ASGNI4
+LABELV $2986
+LABELV $2982
+LABELV $2969
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2971
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8+3328
+INDIRI4
+LTI4 $2968
+ADDRGP4 uiInfo+151440
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+150412-64
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $3011
+ARGP4
+ADDRGP4 uiInfo+146120
+INDIRI4
+ARGI4
+ADDRGP4 $2920
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+146120+4+136
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2964
+LABELV $2959
+ADDRLP4 4408
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4408
+INDIRI4
+ADDRGP4 uiInfo+146120+4+136
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3026
+ADDRLP4 4408
+INDIRI4
+ADDRGP4 uiInfo+146120+4+128
+ADDP4
+INDIRI4
+ADDRGP4 uiInfo+212
+INDIRI4
+ADDRGP4 ui_serverStatusTimeOut+12
+INDIRI4
+SUBI4
+GEI4 $3016
+LABELV $3026
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+146120+4+136
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3027
+ADDRLP4 4412
+ADDRGP4 $2921
+ASGNP4
+ADDRLP4 4412
+INDIRP4
+ADDRLP4 4412
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3027
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+146120+4
+ADDP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 UI_GetServerStatusInfo
+CALLI4
+pop
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+146120+4+136
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+146120
+INDIRI4
+ADDRGP4 uiInfo+131252+10412
+INDIRI4
+GEI4 $3037
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+146120+4+128
+ADDP4
+ADDRGP4 uiInfo+212
+INDIRI4
+ASGNI4
+ADDRLP4 4412
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 4400
+ADDRLP4 4412
+INDIRI4
+ASGNI4
+ADDRLP4 4400
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+146120
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+131252+2220
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+146120+4
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_LAN_GetServerAddressString
+CALLV
+pop
+ADDRLP4 4400
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+146120
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+131252+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3374
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRLP4 3374
+ARGP4
+ADDRGP4 $2458
+ARGP4
+ADDRLP4 4416
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+146120+4+64
+ADDP4
+ARGP4
+ADDRLP4 4416
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+146120+4+136
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4420
+ADDRGP4 uiInfo+146120
+ASGNP4
+ADDRLP4 4420
+INDIRP4
+ADDRLP4 4420
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+151440
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+150412-64
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $3011
+ARGP4
+ADDRGP4 uiInfo+146120
+INDIRI4
+ARGI4
+ADDRGP4 $2920
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $3037
+LABELV $3016
+LABELV $2956
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $2955
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3073
+CNSTI4 140
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+146120+4+136
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3077
+ADDRGP4 $3075
+JUMPV
+LABELV $3077
+LABELV $3074
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $3073
+LABELV $3075
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+GEI4 $3082
+ADDRGP4 uiInfo+151444
+ADDRGP4 uiInfo+212
+INDIRI4
+CNSTI4 25
+ADDI4
+ASGNI4
+ADDRGP4 $3083
+JUMPV
+LABELV $3082
+ADDRGP4 uiInfo+151440
+INDIRI4
+CNSTI4 0
+NEI4 $3086
+ADDRGP4 uiInfo+151440
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+150412-64
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $3093
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $3087
+JUMPV
+LABELV $3086
+ADDRGP4 uiInfo+151440
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+150412-64
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $3098
+ARGP4
+ADDRGP4 uiInfo+151440
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 uiInfo+151440
+INDIRI4
+CNSTI4 2
+NEI4 $3104
+ADDRLP4 4408
+ADDRGP4 $631
+ASGNP4
+ADDRGP4 $3105
+JUMPV
+LABELV $3104
+ADDRLP4 4408
+ADDRGP4 $3101
+ASGNP4
+LABELV $3105
+ADDRLP4 4408
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+148364
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $3087
+ADDRGP4 uiInfo+151444
+CNSTI4 0
+ASGNI4
+CNSTF4 1096810496
+ARGF4
+ADDRGP4 uiInfo+151436
+INDIRI4
+ARGI4
+ADDRGP4 UI_FeederSelection
+CALLV
+pop
+LABELV $3083
+LABELV $2919
+endproc UI_BuildFindPlayerList 4428 24
+proc UI_BuildServerStatus 8 16
+ADDRGP4 uiInfo+151444
+INDIRI4
+CNSTI4 0
+EQI4 $3109
+ADDRGP4 $3108
+JUMPV
+LABELV $3109
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $3112
+ADDRGP4 uiInfo+146116
+INDIRI4
+CNSTI4 0
+EQI4 $3119
+ADDRGP4 uiInfo+146116
+INDIRI4
+ADDRGP4 uiInfo+212
+INDIRI4
+LEI4 $3113
+LABELV $3119
+ADDRGP4 $3108
+JUMPV
+LABELV $3112
+CNSTP4 0
+ARGP4
+CNSTI4 13
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+ADDRGP4 uiInfo+142784+3328
+CNSTI4 0
+ASGNI4
+CNSTP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_LAN_ServerStatus
+CALLI4
+pop
+LABELV $3113
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+131252+2216
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $3133
+ADDRGP4 uiInfo+131252+2216
+INDIRI4
+ADDRGP4 uiInfo+131252+10412
+INDIRI4
+GTI4 $3133
+ADDRGP4 uiInfo+131252+10412
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $3122
+LABELV $3133
+ADDRGP4 $3108
+JUMPV
+LABELV $3122
+ADDRGP4 uiInfo+142720
+ARGP4
+ADDRGP4 uiInfo+142784
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_GetServerStatusInfo
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3134
+ADDRGP4 uiInfo+146116
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+142720
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 UI_GetServerStatusInfo
+CALLI4
+pop
+ADDRGP4 $3135
+JUMPV
+LABELV $3134
+ADDRGP4 uiInfo+146116
+ADDRGP4 uiInfo+212
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+LABELV $3135
+LABELV $3108
+endproc UI_BuildServerStatus 8 16
+proc UI_FeederCount 12 4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+NEF4 $3143
+ADDRLP4 0
+ADDRGP4 UI_HeadCountByTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $3142
+JUMPV
+LABELV $3143
+ADDRFP4 0
+INDIRF4
+CNSTF4 1094713344
+NEF4 $3145
+ADDRGP4 uiInfo+151460
+INDIRI4
+RETI4
+ADDRGP4 $3142
+JUMPV
+LABELV $3145
+ADDRFP4 0
+INDIRF4
+CNSTF4 1097859072
+NEF4 $3148
+ADDRGP4 uiInfo+131240
+INDIRI4
+RETI4
+ADDRGP4 $3142
+JUMPV
+LABELV $3148
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+EQF4 $3153
+ADDRLP4 0
+INDIRF4
+CNSTF4 1082130432
+NEF4 $3151
+LABELV $3153
+ADDRFP4 0
+INDIRF4
+CNSTF4 1065353216
+NEF4 $3155
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3156
+JUMPV
+LABELV $3155
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $3156
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_MapCountByGameType
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $3142
+JUMPV
+LABELV $3151
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+NEF4 $3157
+ADDRGP4 uiInfo+131252+10412
+INDIRI4
+RETI4
+ADDRGP4 $3142
+JUMPV
+LABELV $3157
+ADDRFP4 0
+INDIRF4
+CNSTF4 1095761920
+NEF4 $3161
+ADDRGP4 uiInfo+142784+3328
+INDIRI4
+RETI4
+ADDRGP4 $3142
+JUMPV
+LABELV $3161
+ADDRFP4 0
+INDIRF4
+CNSTF4 1096810496
+NEF4 $3165
+ADDRGP4 uiInfo+151440
+INDIRI4
+RETI4
+ADDRGP4 $3142
+JUMPV
+LABELV $3165
+ADDRFP4 0
+INDIRF4
+CNSTF4 1088421888
+NEF4 $3168
+ADDRGP4 uiInfo+212
+INDIRI4
+ADDRGP4 uiInfo+109564
+INDIRI4
+LEI4 $3170
+ADDRGP4 uiInfo+109564
+ADDRGP4 uiInfo+212
+INDIRI4
+CNSTI4 3000
+ADDI4
+ASGNI4
+ADDRGP4 UI_BuildPlayerList
+CALLV
+pop
+LABELV $3170
+ADDRGP4 uiInfo+109552
+INDIRI4
+RETI4
+ADDRGP4 $3142
+JUMPV
+LABELV $3168
+ADDRFP4 0
+INDIRF4
+CNSTF4 1090519040
+NEF4 $3177
+ADDRGP4 uiInfo+212
+INDIRI4
+ADDRGP4 uiInfo+109564
+INDIRI4
+LEI4 $3179
+ADDRGP4 uiInfo+109564
+ADDRGP4 uiInfo+212
+INDIRI4
+CNSTI4 3000
+ADDI4
+ASGNI4
+ADDRGP4 UI_BuildPlayerList
+CALLV
+pop
+LABELV $3179
+ADDRGP4 uiInfo+109556
+INDIRI4
+RETI4
+ADDRGP4 $3142
+JUMPV
+LABELV $3177
+ADDRFP4 0
+INDIRF4
+CNSTF4 1091567616
+NEF4 $3186
+ADDRGP4 uiInfo+128152
+INDIRI4
+RETI4
+ADDRGP4 $3142
+JUMPV
+LABELV $3186
+ADDRFP4 0
+INDIRF4
+CNSTF4 1092616192
+NEF4 $3189
+ADDRGP4 uiInfo+130208
+INDIRI4
+RETI4
+ADDRGP4 $3142
+JUMPV
+LABELV $3189
+CNSTI4 0
+RETI4
+LABELV $3142
+endproc UI_FeederCount 12 4
+proc UI_SelectedMap 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3196
+JUMPV
+LABELV $3193
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+96
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3198
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $3202
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $3192
+JUMPV
+LABELV $3202
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3198
+LABELV $3194
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3196
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+114188
+INDIRI4
+LTI4 $3193
+ADDRGP4 $631
+RETP4
+LABELV $3192
+endproc UI_SelectedMap 12 0
+proc UI_SelectedHead 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3209
+JUMPV
+LABELV $3206
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156+16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3211
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $3215
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $3205
+JUMPV
+LABELV $3215
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3211
+LABELV $3207
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3209
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+104148
+INDIRI4
+LTI4 $3206
+ADDRGP4 $631
+RETP4
+LABELV $3205
+endproc UI_SelectedHead 12 0
+proc UI_GetIndexFromSelection 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $3222
+JUMPV
+LABELV $3219
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+96
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $3224
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $3228
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $3218
+JUMPV
+LABELV $3228
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3224
+LABELV $3220
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3222
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+114188
+INDIRI4
+LTI4 $3219
+CNSTI4 0
+RETI4
+LABELV $3218
+endproc UI_GetIndexFromSelection 12 0
+proc UI_UpdatePendingPings 4 4
+ADDRLP4 0
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_LAN_ResetPings
+CALLV
+pop
+ADDRGP4 uiInfo+131252+2212
+CNSTI4 1
+ASGNI4
+ADDRGP4 uiInfo+131252+2192
+ADDRGP4 uiInfo+212
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+LABELV $3230
+endproc UI_UpdatePendingPings 4 4
+bss
+align 1
+LABELV $3237
+skip 1024
+align 1
+LABELV $3238
+skip 1024
+align 1
+LABELV $3239
+skip 32
+data
+align 4
+LABELV $3240
+byte 4 -1
+align 4
+LABELV $3241
+byte 4 0
+code
+proc UI_FeederItemText 44 20
+ADDRFP4 12
+INDIRP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+NEF4 $3242
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_SelectedHead
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+RETP4
+ADDRGP4 $3236
+JUMPV
+LABELV $3242
+ADDRFP4 0
+INDIRF4
+CNSTF4 1094713344
+NEF4 $3244
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $3245
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+151460
+INDIRI4
+GEI4 $3245
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+151464
+ADDP4
+RETP4
+ADDRGP4 $3236
+JUMPV
+LABELV $3244
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+EQF4 $3252
+ADDRLP4 0
+INDIRF4
+CNSTF4 1082130432
+NEF4 $3250
+LABELV $3252
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 UI_SelectedMap
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+RETP4
+ADDRGP4 $3236
+JUMPV
+LABELV $3250
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+NEF4 $3253
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3254
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+131252+10412
+INDIRI4
+GEI4 $3254
+ADDRGP4 $3240
+INDIRI4
+ADDRFP4 8
+INDIRI4
+NEI4 $3262
+ADDRGP4 $3241
+INDIRI4
+ADDRGP4 uiInfo+212
+INDIRI4
+CNSTI4 5000
+ADDI4
+LEI4 $3259
+LABELV $3262
+ADDRLP4 12
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+131252+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $3237
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRGP4 $3240
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $3241
+ADDRGP4 uiInfo+212
+INDIRI4
+ASGNI4
+LABELV $3259
+ADDRGP4 $3237
+ARGP4
+ADDRGP4 $2890
+ARGP4
+ADDRLP4 12
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+NEI4 $3266
+LABELV $3266
+ADDRLP4 20
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $3254
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+GTI4 $3254
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $3293
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $3293
+address $3270
+address $3282
+address $3283
+address $3288
+address $3289
+code
+LABELV $3270
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $3271
+ADDRGP4 $3237
+ARGP4
+ADDRGP4 $2459
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+RETP4
+ADDRGP4 $3236
+JUMPV
+LABELV $3271
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+NEI4 $3273
+ADDRGP4 $3237
+ARGP4
+ADDRGP4 $3276
+ARGP4
+ADDRLP4 28
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $3279
+ADDRLP4 36
+INDIRI4
+CVIU4 4
+CNSTU4 3
+LTU4 $3277
+LABELV $3279
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $3277
+ADDRGP4 $3237
+ARGP4
+ADDRGP4 $2458
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $3238
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $3280
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 netnames
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $3238
+RETP4
+ADDRGP4 $3236
+JUMPV
+LABELV $3273
+ADDRGP4 $3237
+ARGP4
+ADDRGP4 $2458
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $3238
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $3281
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $3238
+RETP4
+ADDRGP4 $3236
+JUMPV
+LABELV $3282
+ADDRGP4 $3237
+ARGP4
+ADDRGP4 $2840
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+RETP4
+ADDRGP4 $3236
+JUMPV
+LABELV $3283
+ADDRGP4 ui_browserShowBots+12
+INDIRI4
+CNSTI4 0
+NEI4 $3284
+ADDRGP4 $3237
+ARGP4
+ADDRGP4 $2780
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 $3285
+JUMPV
+LABELV $3284
+ADDRGP4 $3237
+ARGP4
+ADDRGP4 $2781
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 32
+INDIRP4
+ASGNP4
+LABELV $3285
+ADDRGP4 $3237
+ARGP4
+ADDRGP4 $1279
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $3239
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $3287
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $3239
+RETP4
+ADDRGP4 $3236
+JUMPV
+LABELV $3288
+ADDRGP4 $3237
+ARGP4
+ADDRGP4 $2806
+ARGP4
+ADDRLP4 28
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+RETP4
+ADDRGP4 $3236
+JUMPV
+LABELV $3289
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $3290
+ADDRGP4 $3292
+RETP4
+ADDRGP4 $3236
+JUMPV
+LABELV $3290
+ADDRGP4 $3237
+ARGP4
+ADDRGP4 $2890
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+RETP4
+ADDRGP4 $3236
+JUMPV
+LABELV $3253
+ADDRFP4 0
+INDIRF4
+CNSTF4 1095761920
+NEF4 $3294
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3295
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+142784+3328
+INDIRI4
+GEI4 $3295
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $3295
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+GEI4 $3295
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 uiInfo+142784+64
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $3236
+JUMPV
+LABELV $3294
+ADDRFP4 0
+INDIRF4
+CNSTF4 1096810496
+NEF4 $3304
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3305
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+151440
+INDIRI4
+GEI4 $3305
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+150412
+ADDP4
+RETP4
+ADDRGP4 $3236
+JUMPV
+LABELV $3304
+ADDRFP4 0
+INDIRF4
+CNSTF4 1088421888
+NEF4 $3310
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3311
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+109552
+INDIRI4
+GEI4 $3311
+ADDRFP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+109580
+ADDP4
+RETP4
+ADDRGP4 $3236
+JUMPV
+LABELV $3310
+ADDRFP4 0
+INDIRF4
+CNSTF4 1090519040
+NEF4 $3316
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3317
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+109556
+INDIRI4
+GEI4 $3317
+ADDRFP4 4
+INDIRI4
+CNSTI4 5
+LSHI4
+ADDRGP4 uiInfo+111884
+ADDP4
+RETP4
+ADDRGP4 $3236
+JUMPV
+LABELV $3316
+ADDRFP4 0
+INDIRF4
+CNSTF4 1091567616
+NEF4 $3322
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3323
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+128152
+INDIRI4
+GEI4 $3323
+ADDRLP4 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+127640+4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3327
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+127640+4
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3327
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+127640+4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $3236
+JUMPV
+LABELV $3327
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+127640
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $3236
+JUMPV
+LABELV $3322
+ADDRFP4 0
+INDIRF4
+CNSTF4 1097859072
+NEF4 $3336
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3337
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+131240
+INDIRI4
+GEI4 $3337
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+130216
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $3236
+JUMPV
+LABELV $3336
+ADDRFP4 0
+INDIRF4
+CNSTF4 1092616192
+NEF4 $3342
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3344
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+130208
+INDIRI4
+GEI4 $3344
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+128160
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $3236
+JUMPV
+LABELV $3344
+LABELV $3342
+LABELV $3337
+LABELV $3323
+LABELV $3317
+LABELV $3311
+LABELV $3305
+LABELV $3295
+LABELV $3254
+LABELV $3245
+ADDRGP4 $631
+RETP4
+LABELV $3236
+endproc UI_FeederItemText 44 20
+proc UI_FeederItemImage 20 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+NEF4 $3349
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_SelectedHead
+CALLP4
+pop
+ADDRFP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3350
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+104148
+INDIRI4
+GEI4 $3350
+CNSTI4 24
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156+8
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $3354
+ADDRLP4 8
+CNSTI4 24
+ADDRFP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+104156+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 uiInfo+104156+8
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $3354
+CNSTI4 24
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156+8
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $3348
+JUMPV
+LABELV $3349
+ADDRFP4 0
+INDIRF4
+CNSTF4 1094713344
+NEF4 $3364
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3365
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+151460
+INDIRI4
+GEI4 $3365
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+167848
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $3348
+JUMPV
+LABELV $3364
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1082130432
+EQF4 $3372
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+NEF4 $3370
+LABELV $3372
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 UI_SelectedMap
+CALLP4
+pop
+ADDRFP4 4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3373
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+114188
+INDIRI4
+GEI4 $3373
+CNSTI4 100
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+92
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $3376
+ADDRLP4 12
+CNSTI4 100
+ADDRFP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+114192+8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 uiInfo+114192+92
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $3376
+CNSTI4 100
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+92
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $3348
+JUMPV
+LABELV $3373
+LABELV $3370
+LABELV $3365
+LABELV $3350
+CNSTI4 0
+RETI4
+LABELV $3348
+endproc UI_FeederItemImage 20 8
+bss
+align 1
+LABELV $3387
+skip 1024
+code
+proc UI_FeederSelection 44 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+NEF4 $3388
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 UI_SelectedHead
+CALLP4
+pop
+ADDRFP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3389
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+104148
+INDIRI4
+GEI4 $3389
+ADDRGP4 $892
+ARGP4
+CNSTI4 24
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156+12
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $3395
+ARGP4
+CNSTI4 24
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $893
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 updateModel
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3389
+JUMPV
+LABELV $3388
+ADDRFP4 0
+INDIRF4
+CNSTF4 1094713344
+NEF4 $3397
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $3398
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+151460
+INDIRI4
+GEI4 $3398
+ADDRGP4 $888
+ARGP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+151464
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $889
+ARGP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+151464
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 updateModel
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3398
+JUMPV
+LABELV $3397
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+EQF4 $3406
+ADDRLP4 0
+INDIRF4
+CNSTF4 1082130432
+NEF4 $3404
+LABELV $3406
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+NEF4 $3410
+ADDRLP4 12
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+ASGNI4
+ADDRGP4 $3411
+JUMPV
+LABELV $3410
+ADDRLP4 12
+ADDRGP4 ui_currentMap+12
+INDIRI4
+ASGNI4
+LABELV $3411
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 100
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+24
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $3412
+CNSTI4 100
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+CNSTI4 100
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+24
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $3412
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 UI_SelectedMap
+CALLP4
+pop
+ADDRGP4 $1966
+ARGP4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 ui_mapIndex+12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1065353216
+NEF4 $3421
+ADDRGP4 ui_currentMap+12
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $973
+ARGP4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $733
+ARGP4
+ADDRLP4 16
+CNSTI4 100
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 28
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+24
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+CNSTI4 100
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_LoadBestScores
+CALLV
+pop
+ADDRGP4 $1015
+ARGP4
+CNSTI4 100
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+12
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 updateOpponentModel
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3405
+JUMPV
+LABELV $3421
+ADDRGP4 ui_currentNetMap+12
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1661
+ARGP4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $733
+ARGP4
+ADDRLP4 16
+CNSTI4 100
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 28
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 ui_currentNetMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+24
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $3405
+JUMPV
+LABELV $3404
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+NEF4 $3446
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRGP4 uiInfo+131252+2216
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+131252+2220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $3387
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetServerInfo
+CALLV
+pop
+ADDRGP4 $3387
+ARGP4
+ADDRGP4 $2840
+ARGP4
+ADDRLP4 12
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $952
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+131252+10428
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+131252+10432
+INDIRI4
+CNSTI4 0
+LTI4 $3454
+ADDRGP4 uiInfo+131252+10432
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+ADDRGP4 uiInfo+131252+10432
+CNSTI4 -1
+ASGNI4
+LABELV $3454
+ADDRGP4 $3387
+ARGP4
+ADDRGP4 $2840
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3447
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3447
+ADDRGP4 $733
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 40
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+131252+10432
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $3447
+JUMPV
+LABELV $3446
+ADDRFP4 0
+INDIRF4
+CNSTF4 1095761920
+NEF4 $3466
+ADDRGP4 $3467
+JUMPV
+LABELV $3466
+ADDRFP4 0
+INDIRF4
+CNSTF4 1096810496
+NEF4 $3468
+ADDRGP4 uiInfo+151436
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRGP4 uiInfo+151440
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $3469
+ADDRGP4 uiInfo+142720
+ARGP4
+ADDRGP4 uiInfo+151436
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+149388
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 13
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Menu_SetFeederSelection
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_BuildServerStatus
+CALLV
+pop
+ADDRGP4 $3469
+JUMPV
+LABELV $3468
+ADDRFP4 0
+INDIRF4
+CNSTF4 1088421888
+NEF4 $3478
+ADDRGP4 uiInfo+109568
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $3479
+JUMPV
+LABELV $3478
+ADDRFP4 0
+INDIRF4
+CNSTF4 1090519040
+NEF4 $3481
+ADDRGP4 uiInfo+109560
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $3482
+JUMPV
+LABELV $3481
+ADDRFP4 0
+INDIRF4
+CNSTF4 1091567616
+NEF4 $3484
+ADDRGP4 uiInfo+128156
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $3485
+JUMPV
+LABELV $3484
+ADDRFP4 0
+INDIRF4
+CNSTF4 1097859072
+NEF4 $3487
+ADDRGP4 uiInfo+131244
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+131248
+INDIRI4
+CNSTI4 0
+LTI4 $3490
+ADDRGP4 uiInfo+131248
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+LABELV $3490
+ADDRGP4 uiInfo+131248
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $3488
+JUMPV
+LABELV $3487
+ADDRFP4 0
+INDIRF4
+CNSTF4 1092616192
+NEF4 $3495
+ADDRGP4 uiInfo+130212
+ADDRFP4 4
+INDIRI4
+ASGNI4
+LABELV $3495
+LABELV $3488
+LABELV $3485
+LABELV $3482
+LABELV $3479
+LABELV $3469
+LABELV $3467
+LABELV $3447
+LABELV $3405
+LABELV $3398
+LABELV $3389
+LABELV $3386
+endproc UI_FeederSelection 44 24
+proc Team_Parse 72 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $3502
+CNSTI4 0
+RETI4
+ADDRGP4 $3498
+JUMPV
+LABELV $3501
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $338
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $3504
+CNSTI4 1
+RETI4
+ADDRGP4 $3498
+JUMPV
+LABELV $3504
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3506
+CNSTI4 0
+RETI4
+ADDRGP4 $3498
+JUMPV
+LABELV $3506
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $3508
+ADDRGP4 uiInfo+106464
+INDIRI4
+CNSTI4 64
+NEI4 $3510
+ADDRLP4 24
+ADDRGP4 uiInfo+106464
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $3514
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3510
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 44
+ADDRGP4 uiInfo+106464
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $3519
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 28
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $3515
+LABELV $3519
+CNSTI4 0
+RETI4
+ADDRGP4 $3498
+JUMPV
+LABELV $3515
+CNSTI4 44
+ADDRGP4 uiInfo+106464
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 44
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+106464
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+106464
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+28
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $709
+ARGP4
+ADDRLP4 40
+CNSTI4 44
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 uiInfo+106464
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 uiInfo+106464
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+32
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $714
+ARGP4
+ADDRLP4 52
+CNSTI4 44
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 uiInfo+106464
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRGP4 uiInfo+106464
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+36
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+CNSTI4 44
+ADDRGP4 uiInfo+106464
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+40
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3544
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRGP4 uiInfo+106464
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+8
+ADDP4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRGP4 uiInfo+106464
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+8
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $3551
+CNSTI4 0
+RETI4
+ADDRGP4 $3498
+JUMPV
+LABELV $3551
+LABELV $3545
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LTI4 $3544
+ADDRGP4 $3556
+ARGP4
+CNSTI4 44
+ADDRGP4 uiInfo+106464
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_DPrintf
+CALLV
+pop
+ADDRLP4 64
+ADDRGP4 uiInfo+106464
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 68
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+EQI4 $3560
+CNSTI4 0
+RETI4
+ADDRGP4 $3498
+JUMPV
+LABELV $3560
+LABELV $3508
+LABELV $3502
+ADDRGP4 $3501
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $3498
+endproc Team_Parse 72 12
+proc Character_Parse 68 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $3566
+CNSTI4 0
+RETI4
+ADDRGP4 $3562
+JUMPV
+LABELV $3565
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $338
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $3568
+CNSTI4 1
+RETI4
+ADDRGP4 $3562
+JUMPV
+LABELV $3568
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3570
+CNSTI4 0
+RETI4
+ADDRGP4 $3562
+JUMPV
+LABELV $3570
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $3572
+ADDRGP4 uiInfo+104148
+INDIRI4
+CNSTI4 64
+NEI4 $3574
+ADDRLP4 20
+ADDRGP4 uiInfo+104148
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $3578
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3574
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 24
+ADDRGP4 uiInfo+104148
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $3583
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 24
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $3579
+LABELV $3583
+CNSTI4 0
+RETI4
+ADDRGP4 $3562
+JUMPV
+LABELV $3579
+CNSTI4 24
+ADDRGP4 uiInfo+104148
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156+8
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $3590
+ARGP4
+ADDRLP4 28
+CNSTI4 24
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 uiInfo+104148
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 uiInfo+104148
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156+4
+ADDP4
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3593
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 $3595
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $3593
+ADDRGP4 ui_defaultFemaleTeamModel+16
+ARGP4
+ADDRLP4 48
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+CNSTI4 24
+ADDRGP4 uiInfo+104148
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156+12
+ADDP4
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRGP4 $3594
+JUMPV
+LABELV $3593
+ADDRLP4 48
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3600
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $3602
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $3600
+ADDRGP4 ui_defaultMaleTeamModel+16
+ARGP4
+ADDRLP4 56
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+CNSTI4 24
+ADDRGP4 uiInfo+104148
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156+12
+ADDP4
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $3601
+JUMPV
+LABELV $3600
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+CNSTI4 24
+ADDRGP4 uiInfo+104148
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156+12
+ADDP4
+ADDRLP4 56
+INDIRP4
+ASGNP4
+LABELV $3601
+LABELV $3594
+ADDRGP4 $3610
+ARGP4
+ADDRLP4 56
+CNSTI4 24
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 uiInfo+104148
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156+12
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 uiInfo+104148
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+104156
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_DPrintf
+CALLV
+pop
+ADDRLP4 60
+ADDRGP4 uiInfo+104148
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 64
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+EQI4 $3617
+CNSTI4 0
+RETI4
+ADDRGP4 $3562
+JUMPV
+LABELV $3617
+LABELV $3572
+LABELV $3566
+ADDRGP4 $3565
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $3562
+endproc Character_Parse 68 12
+proc Alias_Parse 40 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $3623
+CNSTI4 0
+RETI4
+ADDRGP4 $3619
+JUMPV
+LABELV $3622
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $338
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $3625
+CNSTI4 1
+RETI4
+ADDRGP4 $3619
+JUMPV
+LABELV $3625
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3627
+CNSTI4 0
+RETI4
+ADDRGP4 $3619
+JUMPV
+LABELV $3627
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $3629
+ADDRGP4 uiInfo+105692
+INDIRI4
+CNSTI4 64
+NEI4 $3631
+ADDRLP4 16
+ADDRGP4 uiInfo+105692
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $3635
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3631
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 12
+ADDRGP4 uiInfo+105692
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+105696
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $3647
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 12
+ADDRGP4 uiInfo+105692
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+105696+4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $3647
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 12
+ADDRGP4 uiInfo+105692
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+105696+8
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $3636
+LABELV $3647
+CNSTI4 0
+RETI4
+ADDRGP4 $3619
+JUMPV
+LABELV $3636
+ADDRGP4 $3648
+ARGP4
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 uiInfo+105692
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+105696
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRI4
+ADDRGP4 uiInfo+105692
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+105696+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_DPrintf
+CALLV
+pop
+ADDRLP4 32
+ADDRGP4 uiInfo+105692
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 36
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+EQI4 $3655
+CNSTI4 0
+RETI4
+ADDRGP4 $3619
+JUMPV
+LABELV $3655
+LABELV $3629
+LABELV $3623
+ADDRGP4 $3622
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $3619
+endproc Alias_Parse 40 12
+proc UI_ParseTeamInfo 40 8
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 GetMenuBuffer
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3658
+ADDRGP4 $3657
+JUMPV
+LABELV $3658
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $3661
+JUMPV
+LABELV $3660
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $3665
+ADDRLP4 20
+INDIRI4
+CNSTI4 125
+NEI4 $3663
+LABELV $3665
+ADDRGP4 $3662
+JUMPV
+LABELV $3663
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $338
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $3666
+ADDRGP4 $3662
+JUMPV
+LABELV $3666
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3670
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $3668
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Team_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $3662
+ADDRGP4 $3661
+JUMPV
+LABELV $3668
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3675
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $3673
+ADDRLP4 4
+ARGP4
+ADDRGP4 Character_Parse
+CALLI4
+pop
+LABELV $3673
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3678
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $3676
+ADDRLP4 4
+ARGP4
+ADDRGP4 Alias_Parse
+CALLI4
+pop
+LABELV $3676
+LABELV $3661
+ADDRGP4 $3660
+JUMPV
+LABELV $3662
+LABELV $3657
+endproc UI_ParseTeamInfo 40 8
+export UI_ValidateTeams
+proc UI_ValidateTeams 8 4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3683
+JUMPV
+LABELV $3680
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $3685
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 44
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+8
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 UI_AIFromName
+CALLP4
+pop
+LABELV $3686
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LTI4 $3685
+LABELV $3681
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3683
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+106464
+INDIRI4
+LTI4 $3680
+LABELV $3679
+endproc UI_ValidateTeams 8 4
+proc GameType_Parse 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $3692
+CNSTI4 0
+RETI4
+ADDRGP4 $3691
+JUMPV
+LABELV $3692
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3694
+ADDRGP4 uiInfo+109416
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3699
+JUMPV
+LABELV $3694
+ADDRGP4 uiInfo+109284
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3699
+JUMPV
+LABELV $3698
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $338
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $3701
+CNSTI4 1
+RETI4
+ADDRGP4 $3691
+JUMPV
+LABELV $3701
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3703
+CNSTI4 0
+RETI4
+ADDRGP4 $3691
+JUMPV
+LABELV $3703
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $3705
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3707
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+109416
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109420
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $3716
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+109416
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109420+4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $3708
+LABELV $3716
+CNSTI4 0
+RETI4
+ADDRGP4 $3691
+JUMPV
+LABELV $3707
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+109284
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $3724
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 uiInfo+109284
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $3717
+LABELV $3724
+CNSTI4 0
+RETI4
+ADDRGP4 $3691
+JUMPV
+LABELV $3717
+LABELV $3708
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3725
+ADDRGP4 uiInfo+109416
+INDIRI4
+CNSTI4 16
+GEI4 $3727
+ADDRLP4 16
+ADDRGP4 uiInfo+109416
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3726
+JUMPV
+LABELV $3727
+ADDRGP4 $3731
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $3726
+JUMPV
+LABELV $3725
+ADDRGP4 uiInfo+109284
+INDIRI4
+CNSTI4 16
+GEI4 $3732
+ADDRLP4 16
+ADDRGP4 uiInfo+109284
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3733
+JUMPV
+LABELV $3732
+ADDRGP4 $3736
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3733
+LABELV $3726
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+EQI4 $3737
+CNSTI4 0
+RETI4
+ADDRGP4 $3691
+JUMPV
+LABELV $3737
+LABELV $3705
+LABELV $3699
+ADDRGP4 $3698
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $3691
+endproc GameType_Parse 24 8
+proc MapList_Parse 48 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $3740
+CNSTI4 0
+RETI4
+ADDRGP4 $3739
+JUMPV
+LABELV $3740
+ADDRGP4 uiInfo+114188
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3744
+JUMPV
+LABELV $3743
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $338
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $3746
+CNSTI4 1
+RETI4
+ADDRGP4 $3739
+JUMPV
+LABELV $3746
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3748
+CNSTI4 0
+RETI4
+ADDRGP4 $3739
+JUMPV
+LABELV $3748
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $3750
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 100
+ADDRGP4 uiInfo+114188
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $3763
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 100
+ADDRGP4 uiInfo+114188
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $3763
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 100
+ADDRGP4 uiInfo+114188
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+16
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $3752
+LABELV $3763
+CNSTI4 0
+RETI4
+ADDRGP4 $3739
+JUMPV
+LABELV $3752
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 100
+ADDRGP4 uiInfo+114188
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+12
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $3764
+CNSTI4 0
+RETI4
+ADDRGP4 $3739
+JUMPV
+LABELV $3764
+CNSTI4 100
+ADDRGP4 uiInfo+114188
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+20
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3773
+JUMPV
+LABELV $3772
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 32
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 48
+LTI4 $3774
+ADDRLP4 36
+INDIRI4
+CNSTI4 57
+GTI4 $3774
+ADDRLP4 40
+CNSTI4 100
+ADDRGP4 uiInfo+114188
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+20
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+LSHI4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 2
+LSHI4
+CNSTI4 192
+SUBI4
+CNSTI4 100
+ADDRGP4 uiInfo+114188
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+28
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $3776
+CNSTI4 0
+RETI4
+ADDRGP4 $3739
+JUMPV
+LABELV $3776
+LABELV $3773
+ADDRGP4 $3772
+JUMPV
+LABELV $3774
+CNSTI4 100
+ADDRGP4 uiInfo+114188
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+24
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $3791
+ARGP4
+ADDRLP4 32
+CNSTI4 100
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+114188
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ADDRGP4 uiInfo+114188
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+92
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+114188
+INDIRI4
+CNSTI4 128
+GEI4 $3795
+ADDRLP4 44
+ADDRGP4 uiInfo+114188
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3796
+JUMPV
+LABELV $3795
+ADDRGP4 $3799
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $3796
+LABELV $3750
+LABELV $3744
+ADDRGP4 $3743
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $3739
+endproc MapList_Parse 48 8
+proc UI_ParseGameInfo 40 16
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 GetMenuBuffer
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $3801
+ADDRGP4 $3800
+JUMPV
+LABELV $3801
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $3804
+JUMPV
+LABELV $3803
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $3808
+ADDRLP4 20
+INDIRI4
+CNSTI4 125
+NEI4 $3806
+LABELV $3808
+ADDRGP4 $3805
+JUMPV
+LABELV $3806
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $338
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $3809
+ADDRGP4 $3805
+JUMPV
+LABELV $3809
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3813
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $3811
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 32
+ADDRGP4 GameType_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $3805
+ADDRGP4 $3804
+JUMPV
+LABELV $3811
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3818
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $3816
+ADDRLP4 4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 36
+ADDRGP4 GameType_Parse
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $3805
+ADDRGP4 $3804
+JUMPV
+LABELV $3816
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $3823
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $3821
+ADDRLP4 4
+ARGP4
+ADDRGP4 MapList_Parse
+CALLI4
+pop
+LABELV $3821
+LABELV $3804
+ADDRGP4 $3803
+JUMPV
+LABELV $3805
+ADDRGP4 $1655
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 uiInfo+109284
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_CheckRange
+CALLV
+pop
+ADDRGP4 $1676
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 uiInfo+109416
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_CheckRange
+CALLV
+pop
+LABELV $3800
+endproc UI_ParseGameInfo 40 16
+proc UI_Pause 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $3827
+ADDRGP4 UI_EnterMenu
+CALLV
+pop
+ADDRGP4 $3828
+JUMPV
+LABELV $3827
+ADDRGP4 UI_ForceMenuOff
+CALLV
+pop
+LABELV $3828
+LABELV $3826
+endproc UI_Pause 0 0
+proc UI_PlayCinematic 4 24
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRFP4 16
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 16
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 0
+ADDRGP4 trap_CIN_PlayCinematic
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $3829
+endproc UI_PlayCinematic 4 24
+proc UI_StopCinematic 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $3831
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+ADDRGP4 $3832
+JUMPV
+LABELV $3831
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRFP4 0
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 244
+NEI4 $3833
+CNSTI4 100
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+24
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $3834
+CNSTI4 100
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+24
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+CNSTI4 100
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+24
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $3834
+JUMPV
+LABELV $3833
+ADDRFP4 0
+INDIRI4
+CNSTI4 246
+NEI4 $3846
+ADDRGP4 uiInfo+131252+10432
+INDIRI4
+CNSTI4 0
+LTI4 $3847
+ADDRGP4 uiInfo+131252+10432
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+ADDRGP4 uiInfo+131252+10432
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $3847
+JUMPV
+LABELV $3846
+ADDRFP4 0
+INDIRI4
+CNSTI4 251
+NEI4 $3856
+ADDRGP4 $657
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_TeamIndexFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $3858
+ADDRLP4 16
+INDIRI4
+ADDRGP4 uiInfo+106464
+INDIRI4
+GEI4 $3858
+CNSTI4 44
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+40
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $3861
+CNSTI4 44
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_StopCinematic
+CALLI4
+pop
+CNSTI4 44
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+106468+40
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $3861
+LABELV $3858
+LABELV $3856
+LABELV $3847
+LABELV $3834
+LABELV $3832
+LABELV $3830
+endproc UI_StopCinematic 20 4
+proc UI_DrawCinematic 0 20
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRFP4 16
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 16
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 trap_CIN_SetExtents
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_DrawCinematic
+CALLV
+pop
+LABELV $3869
+endproc UI_DrawCinematic 0 20
+proc UI_RunCinematicFrame 0 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_CIN_RunCinematic
+CALLI4
+pop
+LABELV $3870
+endproc UI_RunCinematicFrame 0 4
+proc UI_BuildQ3Model_List 4524 20
+ADDRGP4 uiInfo+151460
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3873
+ARGP4
+ADDRGP4 $3874
+ARGP4
+ADDRLP4 2408
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 4456
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 2404
+ADDRLP4 4456
+INDIRI4
+ASGNI4
+ADDRLP4 340
+ADDRLP4 2408
+ASGNP4
+ADDRLP4 352
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3878
+JUMPV
+LABELV $3875
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 4460
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 348
+ADDRLP4 4460
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $3880
+ADDRLP4 348
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 340
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $3880
+ADDRLP4 348
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 340
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $3880
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRGP4 $3884
+ARGP4
+ADDRLP4 4468
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4468
+INDIRI4
+CNSTI4 0
+EQI4 $3886
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRGP4 $3885
+ARGP4
+ADDRLP4 4472
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4472
+INDIRI4
+CNSTI4 0
+NEI4 $3882
+LABELV $3886
+ADDRGP4 $3876
+JUMPV
+LABELV $3882
+ADDRGP4 $3887
+ARGP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 4476
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4476
+INDIRP4
+ARGP4
+ADDRGP4 $3888
+ARGP4
+ADDRLP4 356
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 4480
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 344
+ADDRLP4 4480
+INDIRI4
+ASGNI4
+ADDRLP4 328
+ADDRLP4 356
+ASGNP4
+ADDRLP4 332
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3892
+JUMPV
+LABELV $3889
+ADDRLP4 328
+INDIRP4
+ARGP4
+ADDRLP4 4484
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 336
+ADDRLP4 4484
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 328
+INDIRP4
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 260
+ARGP4
+ADDRGP4 $3896
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 4488
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 4488
+INDIRI4
+CNSTI4 0
+NEI4 $3894
+ADDRLP4 260
+ARGP4
+ADDRGP4 $3897
+ARGP4
+ADDRLP4 4492
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4492
+INDIRI4
+CNSTI4 0
+EQI4 $3894
+ADDRLP4 260
+ARGP4
+ADDRGP4 $3898
+ARGP4
+ADDRLP4 4496
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4496
+INDIRI4
+CNSTI4 0
+EQI4 $3894
+ADDRLP4 260
+ARGP4
+ADDRGP4 $3901
+ARGP4
+ADDRLP4 4500
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4500
+INDIRI4
+CNSTI4 0
+NEI4 $3899
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $3281
+ARGP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $3900
+JUMPV
+LABELV $3899
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $3902
+ARGP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 260+5
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $3900
+ADDRLP4 4504
+CNSTI4 0
+ASGNI4
+ADDRLP4 324
+ADDRLP4 4504
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4504
+INDIRI4
+ASGNI4
+ADDRGP4 $3907
+JUMPV
+LABELV $3904
+ADDRLP4 4
+ARGP4
+ADDRGP4 uiInfo+151460
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+151464
+ADDP4
+ARGP4
+ADDRLP4 4508
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4508
+INDIRI4
+CNSTI4 0
+NEI4 $3909
+ADDRLP4 324
+CNSTI4 1
+ASGNI4
+ADDRGP4 $3906
+JUMPV
+LABELV $3909
+LABELV $3905
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3907
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+151460
+INDIRI4
+LTI4 $3904
+LABELV $3906
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+NEI4 $3913
+ADDRGP4 uiInfo+151460
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 uiInfo+151464
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $3281
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 4512
+ADDRGP4 uiInfo+151460
+ASGNP4
+ADDRLP4 4508
+ADDRLP4 4512
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4512
+INDIRP4
+ADDRLP4 4508
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $3921
+ARGP4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 4516
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4516
+INDIRP4
+ARGP4
+ADDRLP4 4520
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 4508
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 uiInfo+167848
+ADDP4
+ADDRLP4 4520
+INDIRI4
+ASGNI4
+LABELV $3913
+LABELV $3894
+LABELV $3890
+ADDRLP4 4484
+CNSTI4 1
+ASGNI4
+ADDRLP4 332
+ADDRLP4 332
+INDIRI4
+ADDRLP4 4484
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 328
+ADDRLP4 336
+INDIRI4
+ADDRLP4 4484
+INDIRI4
+ADDI4
+ADDRLP4 328
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $3892
+ADDRLP4 332
+INDIRI4
+ADDRLP4 344
+INDIRI4
+GEI4 $3922
+ADDRGP4 uiInfo+151460
+INDIRI4
+CNSTI4 256
+LTI4 $3889
+LABELV $3922
+LABELV $3876
+ADDRLP4 4460
+CNSTI4 1
+ASGNI4
+ADDRLP4 352
+ADDRLP4 352
+INDIRI4
+ADDRLP4 4460
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 340
+ADDRLP4 348
+INDIRI4
+ADDRLP4 4460
+INDIRI4
+ADDI4
+ADDRLP4 340
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $3878
+ADDRLP4 352
+INDIRI4
+ADDRLP4 2404
+INDIRI4
+GEI4 $3923
+ADDRGP4 uiInfo+151460
+INDIRI4
+CNSTI4 256
+LTI4 $3875
+LABELV $3923
+LABELV $3871
+endproc UI_BuildQ3Model_List 4524 20
+proc UI_Cvar_Get 132 12
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 128
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_LatchedVariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 128
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+RETF4
+LABELV $3924
+endproc UI_Cvar_Get 132 12
+export UI_Init
+proc UI_Init 52 16
+CNSTF4 1065353216
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 uiInfo+168884
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 UI_RegisterCvars
+CALLV
+pop
+ADDRGP4 UI_InitMemory_ui_shared
+CALLV
+pop
+ADDRGP4 $3927
+ARGP4
+ADDRGP4 cgs+20100+35880
+INDIRI4
+ARGI4
+ADDRGP4 cgs+20100+35884
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $2095
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $3927
+ARGP4
+ADDRGP4 cgs+20100+35880
+INDIRI4
+ARGI4
+ADDRGP4 cgs+20100+35884
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $3932
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 uiInfo
+ADDRGP4 trap_R_RegisterShaderNoMip
+ASGNP4
+ADDRGP4 uiInfo+4
+ADDRGP4 trap_R_SetColor
+ASGNP4
+ADDRGP4 uiInfo+8
+ADDRGP4 CG_DrawPic
+ASGNP4
+ADDRGP4 uiInfo+12
+ADDRGP4 trap_R_DrawStretchPic
+ASGNP4
+ADDRGP4 uiInfo+16
+ADDRGP4 UI_Text_Paint
+ASGNP4
+ADDRGP4 uiInfo+20
+ADDRGP4 UI_Text_Width
+ASGNP4
+ADDRGP4 uiInfo+24
+ADDRGP4 UI_Text_Height
+ASGNP4
+ADDRGP4 uiInfo+28
+ADDRGP4 trap_R_RegisterModel
+ASGNP4
+ADDRGP4 uiInfo+32
+ADDRGP4 trap_R_ModelBounds
+ASGNP4
+ADDRGP4 uiInfo+36
+ADDRGP4 CG_FillRect
+ASGNP4
+ADDRGP4 uiInfo+40
+ADDRGP4 CG_DrawRect
+ASGNP4
+ADDRGP4 uiInfo+44
+ADDRGP4 CG_DrawSides
+ASGNP4
+ADDRGP4 uiInfo+48
+ADDRGP4 CG_DrawTopBottom
+ASGNP4
+ADDRGP4 uiInfo+52
+ADDRGP4 trap_R_ClearScene
+ASGNP4
+ADDRGP4 uiInfo+56
+ADDRGP4 CG_AddRefEntityWithMinLight
+ASGNP4
+ADDRGP4 uiInfo+60
+ADDRGP4 trap_R_RenderScene
+ASGNP4
+ADDRGP4 uiInfo+64
+ADDRGP4 trap_R_RegisterFont
+ASGNP4
+ADDRGP4 uiInfo+68
+ADDRGP4 UI_OwnerDraw
+ASGNP4
+ADDRGP4 uiInfo+72
+ADDRGP4 UI_GetValue
+ASGNP4
+ADDRGP4 uiInfo+76
+ADDRGP4 UI_OwnerDrawVisible
+ASGNP4
+ADDRGP4 uiInfo+80
+ADDRGP4 UI_RunMenuScript
+ASGNP4
+ADDRGP4 uiInfo+84
+ADDRGP4 UI_GetTeamColor
+ASGNP4
+ADDRGP4 uiInfo+96
+ADDRGP4 trap_Cvar_Set
+ASGNP4
+ADDRGP4 uiInfo+88
+ADDRGP4 trap_Cvar_LatchedVariableStringBuffer
+ASGNP4
+ADDRGP4 uiInfo+92
+ADDRGP4 UI_Cvar_Get
+ASGNP4
+ADDRGP4 uiInfo+100
+ADDRGP4 UI_Text_PaintWithCursor
+ASGNP4
+ADDRGP4 uiInfo+104
+ADDRGP4 trap_Key_SetOverstrikeMode
+ASGNP4
+ADDRGP4 uiInfo+108
+ADDRGP4 trap_Key_GetOverstrikeMode
+ASGNP4
+ADDRGP4 uiInfo+112
+ADDRGP4 trap_S_StartLocalSound
+ASGNP4
+ADDRGP4 uiInfo+116
+ADDRGP4 UI_OwnerDrawHandleKey
+ASGNP4
+ADDRGP4 uiInfo+120
+ADDRGP4 UI_FeederCount
+ASGNP4
+ADDRGP4 uiInfo+128
+ADDRGP4 UI_FeederItemImage
+ASGNP4
+ADDRGP4 uiInfo+124
+ADDRGP4 UI_FeederItemText
+ASGNP4
+ADDRGP4 uiInfo+132
+ADDRGP4 UI_FeederSelection
+ASGNP4
+ADDRGP4 uiInfo+144
+ADDRGP4 trap_Key_SetBinding
+ASGNP4
+ADDRGP4 uiInfo+140
+ADDRGP4 trap_Key_GetBindingBuf
+ASGNP4
+ADDRGP4 uiInfo+136
+ADDRGP4 trap_Key_KeynumToStringBuf
+ASGNP4
+ADDRGP4 uiInfo+148
+ADDRGP4 trap_Key_GetKey
+ASGNP4
+ADDRGP4 uiInfo+152
+ADDRGP4 trap_Cmd_ExecuteText
+ASGNP4
+ADDRGP4 uiInfo+156
+ADDRGP4 Com_Error
+ASGNP4
+ADDRGP4 uiInfo+160
+ADDRGP4 Com_Printf
+ASGNP4
+ADDRGP4 uiInfo+164
+ADDRGP4 UI_Pause
+ASGNP4
+ADDRGP4 uiInfo+168
+ADDRGP4 UI_OwnerDrawWidth
+ASGNP4
+ADDRGP4 uiInfo+172
+ADDRGP4 trap_S_RegisterSound
+ASGNP4
+ADDRGP4 uiInfo+176
+ADDRGP4 trap_S_StartBackgroundTrack
+ASGNP4
+ADDRGP4 uiInfo+180
+ADDRGP4 trap_S_StopBackgroundTrack
+ASGNP4
+ADDRGP4 uiInfo+184
+ADDRGP4 UI_PlayCinematic
+ASGNP4
+ADDRGP4 uiInfo+188
+ADDRGP4 UI_StopCinematic
+ASGNP4
+ADDRGP4 uiInfo+192
+ADDRGP4 UI_DrawCinematic
+ASGNP4
+ADDRGP4 uiInfo+196
+ADDRGP4 UI_RunCinematicFrame
+ASGNP4
+ADDRGP4 uiInfo+200
+ADDRGP4 CG_AdjustFrom640
+ASGNP4
+ADDRGP4 uiInfo+204
+ADDRGP4 CG_SetScreenPlacement
+ASGNP4
+ADDRGP4 uiInfo+208
+ADDRGP4 CG_PopScreenPlacement
+ASGNP4
+ADDRGP4 uiInfo
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRGP4 String_Init
+CALLV
+pop
+ADDRGP4 $3990
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+62128
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $3992
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uiInfo+62120
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 AssetCache
+CALLV
+pop
+ADDRGP4 uiInfo+106464
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+104148
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+105692
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3996
+ARGP4
+ADDRGP4 UI_ParseTeamInfo
+CALLV
+pop
+ADDRGP4 UI_LoadTeams
+CALLV
+pop
+ADDRGP4 $605
+ARGP4
+ADDRGP4 UI_ParseGameInfo
+CALLV
+pop
+ADDRGP4 UI_LoadArenas
+CALLV
+pop
+ADDRGP4 UI_ValidateTeams
+CALLV
+pop
+ADDRGP4 $599
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3999
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $3997
+LABELV $3999
+ADDRLP4 0
+ADDRGP4 $571
+ASGNP4
+LABELV $3997
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_LoadMenus
+CALLV
+pop
+ADDRGP4 $606
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_LoadMenus
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 trap_LAN_LoadCachedServers
+CALLV
+pop
+CNSTI4 100
+ADDRGP4 ui_currentMap+12
+INDIRI4
+MULI4
+ADDRGP4 uiInfo+114192+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 ui_gameType+12
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 uiInfo+109288+4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_LoadBestScores
+CALLV
+pop
+ADDRGP4 UI_BuildQ3Model_List
+CALLV
+pop
+ADDRGP4 UI_LoadBots
+CALLV
+pop
+ADDRGP4 $1581
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 uiInfo+168876
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CNSTI4 2
+LSHI4
+ADDRGP4 gamecodetoui-4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1817
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 uiInfo+151448
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+CNSTI4 10
+MODI4
+ASGNI4
+ADDRGP4 uiInfo+151448
+INDIRI4
+CNSTI4 0
+GEI4 $4009
+ADDRGP4 uiInfo+151448
+CNSTI4 0
+ASGNI4
+LABELV $4009
+ADDRGP4 $2115
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 0
+LTF4 $4014
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4015
+JUMPV
+LABELV $4014
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+LABELV $4015
+ADDRGP4 $2112
+ARGP4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 uiInfo+131252+10432
+CNSTI4 -1
+ASGNI4
+ADDRGP4 uiInfo+131248
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $4021
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 48
+INDIRF4
+CNSTF4 0
+NEF4 $4019
+ADDRGP4 $4022
+ARGP4
+CNSTF4 1061997773
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $4023
+ARGP4
+CNSTF4 1056964608
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $4021
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $4019
+CNSTP4 0
+ARGP4
+ADDRGP4 $4024
+ARGP4
+ADDRGP4 $631
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 $4025
+ARGP4
+ADDRGP4 ui_netGameType+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $3925
+endproc UI_Init 52 16
+export UI_KeyEvent
+proc UI_KeyEvent 16 12
+ADDRGP4 uiInfo
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $4028
+ADDRLP4 8
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4030
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+NEI4 $4032
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $4032
+ADDRLP4 12
+ADDRGP4 Menus_AnyFullScreenVisible
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $4032
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $4031
+JUMPV
+LABELV $4032
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Menu_HandleKey
+CALLV
+pop
+ADDRGP4 $4031
+JUMPV
+LABELV $4030
+ADDRGP4 UI_ForceMenuOff
+CALLV
+pop
+LABELV $4031
+LABELV $4028
+LABELV $4027
+endproc UI_KeyEvent 16 12
+export UI_MouseEvent
+proc UI_MouseEvent 52 16
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4035
+ADDRGP4 $4034
+JUMPV
+LABELV $4035
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+NEGI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+CNSTI4 640
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 uiInfo+220
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 uiInfo+220
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+NEGI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CNSTI4 480
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 uiInfo+224
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 uiInfo+224
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 uiInfo
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRLP4 48
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+LEI4 $4041
+CNSTP4 0
+ARGP4
+ADDRGP4 uiInfo+220
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+224
+INDIRI4
+ARGI4
+ADDRGP4 Display_MouseMove
+CALLI4
+pop
+LABELV $4041
+LABELV $4034
+endproc UI_MouseEvent 52 16
+export UI_GetCursorPos
+proc UI_GetCursorPos 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4046
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4048
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $4048
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4050
+ADDRFP4 8
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $4050
+LABELV $4046
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4052
+ADDRFP4 4
+INDIRP4
+ADDRGP4 uiInfo+220
+INDIRI4
+ASGNI4
+LABELV $4052
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4055
+ADDRFP4 8
+INDIRP4
+ADDRGP4 uiInfo+224
+INDIRI4
+ASGNI4
+LABELV $4055
+LABELV $4045
+endproc UI_GetCursorPos 0 0
+export UI_SetCursorPos
+proc UI_SetCursorPos 4 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4059
+ADDRGP4 $4058
+JUMPV
+LABELV $4059
+ADDRGP4 uiInfo+220
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $4061
+ADDRGP4 uiInfo+224
+INDIRI4
+ADDRFP4 8
+INDIRI4
+NEI4 $4061
+ADDRGP4 $4058
+JUMPV
+LABELV $4061
+ADDRGP4 uiInfo+220
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo+224
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 uiInfo
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $4067
+CNSTP4 0
+ARGP4
+ADDRGP4 uiInfo+220
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+224
+INDIRI4
+ARGI4
+ADDRGP4 Display_MouseMove
+CALLI4
+pop
+LABELV $4067
+LABELV $4058
+endproc UI_SetCursorPos 4 12
+export UI_LoadNonIngame
+proc UI_LoadNonIngame 12 8
+ADDRGP4 $599
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4074
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4072
+LABELV $4074
+ADDRLP4 0
+ADDRGP4 $571
+ASGNP4
+LABELV $4072
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_LoadMenus
+CALLV
+pop
+ADDRGP4 uiInfo+168880
+CNSTI4 0
+ASGNI4
+LABELV $4071
+endproc UI_LoadNonIngame 12 8
+export UI_SetActiveMenu
+proc UI_SetActiveMenu 272 12
+ADDRGP4 uiInfo
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRLP4 256
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+GTI4 $4077
+ADDRGP4 $4076
+JUMPV
+LABELV $4077
+ADDRLP4 260
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+LTI4 $4079
+ADDRLP4 260
+INDIRI4
+CNSTI4 4
+GTI4 $4079
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $4102
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4102
+address $4082
+address $4083
+address $4099
+address $4093
+address $4094
+code
+LABELV $4082
+ADDRGP4 UI_ForceMenuOff
+CALLV
+pop
+ADDRGP4 $4076
+JUMPV
+LABELV $4083
+ADDRGP4 CG_KillServer
+CALLV
+pop
+ADDRGP4 UI_EnterMenu
+CALLV
+pop
+ADDRGP4 uiInfo+168880
+INDIRI4
+CNSTI4 0
+EQI4 $4084
+ADDRGP4 UI_LoadNonIngame
+CALLV
+pop
+LABELV $4084
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $2288
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $2208
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 268
+INDIRU4
+CNSTU4 0
+EQU4 $4076
+ADDRGP4 ui_singlePlayerActive+12
+INDIRI4
+CNSTI4 0
+NEI4 $4089
+ADDRGP4 $4092
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $4076
+JUMPV
+LABELV $4089
+ADDRGP4 $2208
+ARGP4
+ADDRGP4 $631
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $4076
+JUMPV
+LABELV $4093
+ADDRGP4 UI_EnterMenu
+CALLV
+pop
+ADDRGP4 $1909
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $4076
+JUMPV
+LABELV $4094
+ADDRGP4 CG_KillServer
+CALLV
+pop
+ADDRGP4 UI_EnterMenu
+CALLV
+pop
+ADDRGP4 uiInfo+168880
+INDIRI4
+CNSTI4 0
+EQI4 $4095
+ADDRGP4 UI_LoadNonIngame
+CALLV
+pop
+LABELV $4095
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $4098
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $4076
+JUMPV
+LABELV $4099
+ADDRGP4 UI_EnterMenu
+CALLV
+pop
+ADDRGP4 UI_BuildPlayerList
+CALLV
+pop
+ADDRGP4 Menus_CloseAll
+CALLV
+pop
+ADDRGP4 $4100
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+ADDRGP4 $4076
+JUMPV
+LABELV $4079
+ADDRGP4 $4101
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4076
+endproc UI_SetActiveMenu 272 12
+export UI_IsFullscreen
+proc UI_IsFullscreen 4 4
+ADDRGP4 uiInfo
+ARGP4
+ADDRGP4 Init_Display
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 Menus_AnyFullScreenVisible
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $4103
+endproc UI_IsFullscreen 4 4
+proc UI_ReadableSize 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1073741824
+LEI4 $4105
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2900
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1073741824
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+CVIU4 4
+ADDRLP4 8
+INDIRU4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 $4107
+ARGP4
+ADDRLP4 12
+CNSTI4 1073741824
+ASGNI4
+CNSTI4 100
+ADDRFP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+MULI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $4106
+JUMPV
+LABELV $4105
+ADDRFP4 8
+INDIRI4
+CNSTI4 1048576
+LEI4 $4108
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2900
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1048576
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 0
+INDIRU4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+CVIU4 4
+ADDRLP4 8
+INDIRU4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 $4110
+ARGP4
+ADDRLP4 12
+CNSTI4 1048576
+ASGNI4
+CNSTI4 100
+ADDRFP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+MULI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $4109
+JUMPV
+LABELV $4108
+ADDRFP4 8
+INDIRI4
+CNSTI4 1024
+LEI4 $4111
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $4113
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1024
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $4112
+JUMPV
+LABELV $4111
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $4114
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $4112
+LABELV $4109
+LABELV $4106
+LABELV $4104
+endproc UI_ReadableSize 16 16
+proc UI_PrintTime 8 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 3600
+LEI4 $4116
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $4118
+ARGP4
+ADDRLP4 4
+CNSTI4 3600
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+DIVI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MODI4
+CNSTI4 60
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $4117
+JUMPV
+LABELV $4116
+ADDRFP4 8
+INDIRI4
+CNSTI4 60
+LEI4 $4119
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $4121
+ARGP4
+ADDRLP4 4
+CNSTI4 60
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+DIVI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MODI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRGP4 $4120
+JUMPV
+LABELV $4119
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $4122
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+LABELV $4120
+LABELV $4117
+LABELV $4115
+endproc UI_PrintTime 8 20
+export UI_Text_PaintCenter
+proc UI_Text_PaintCenter 8 32
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 UI_Text_Paint
+CALLV
+pop
+LABELV $4123
+endproc UI_Text_PaintCenter 8 32
+export UI_Text_PaintCenter_AutoWrapped
+proc UI_Text_PaintCenter_AutoWrapped 1064 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4127
+ADDRFP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4125
+LABELV $4127
+ADDRGP4 $4124
+JUMPV
+LABELV $4125
+ADDRLP4 20
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+ASGNP4
+ADDRGP4 $4129
+JUMPV
+LABELV $4128
+LABELV $4131
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $4132
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 32
+EQI4 $4134
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $4131
+LABELV $4134
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 1056
+ADDRGP4 UI_Text_Width
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI1
+ASGNI1
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRFP4 8
+INDIRF4
+LEF4 $4135
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $4137
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $4137
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4139
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4130
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $4130
+JUMPV
+LABELV $4139
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $4136
+JUMPV
+LABELV $4135
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $4143
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRF4
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $4130
+JUMPV
+LABELV $4143
+LABELV $4136
+LABELV $4129
+ADDRGP4 $4128
+JUMPV
+LABELV $4130
+LABELV $4124
+endproc UI_Text_PaintCenter_AutoWrapped 1064 24
+data
+align 1
+LABELV $4146
+byte 1 68
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 0
+align 1
+LABELV $4147
+byte 1 69
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $4148
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 0
+code
+proc UI_DisplayDownloadInfo 312 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 $4149
+ARGP4
+ADDRLP4 280
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 280
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $4150
+ARGP4
+ADDRLP4 284
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 284
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $4151
+ARGP4
+ADDRLP4 288
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 288
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+CNSTI4 320
+ASGNI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1121976320
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $4146
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1128267776
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $4147
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1131937792
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $4148
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $4152
+ADDRGP4 $4154
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1120403456
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+DIVF4
+CVFI4 4
+ARGI4
+ADDRLP4 292
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 292
+INDIRP4
+ASGNP4
+ADDRGP4 $4153
+JUMPV
+LABELV $4152
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $4153
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1124597760
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ReadableSize
+CALLV
+pop
+ADDRLP4 76
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 UI_ReadableSize
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 4096
+LTI4 $4157
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $4155
+LABELV $4157
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1129840640
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $4158
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $4159
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 292
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1126170624
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 292
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $4156
+JUMPV
+LABELV $4155
+ADDRGP4 uiInfo+212
+INDIRI4
+ADDRLP4 140
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+CNSTI4 0
+EQI4 $4160
+ADDRLP4 144
+ADDRLP4 4
+INDIRI4
+ADDRGP4 uiInfo+212
+INDIRI4
+ADDRLP4 140
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+DIVI4
+ASGNI4
+ADDRGP4 $4161
+JUMPV
+LABELV $4160
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+LABELV $4161
+ADDRLP4 152
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 UI_ReadableSize
+CALLV
+pop
+ADDRLP4 292
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 292
+INDIRI4
+EQI4 $4164
+ADDRLP4 144
+INDIRI4
+ADDRLP4 292
+INDIRI4
+EQI4 $4164
+ADDRLP4 296
+ADDRLP4 0
+INDIRI4
+ADDRLP4 144
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 216
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 300
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRLP4 304
+CNSTI4 1024
+ASGNI4
+CNSTI4 1000
+ADDRLP4 300
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 304
+INDIRI4
+DIVI4
+ADDRLP4 300
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+DIVI4
+DIVI4
+SUBI4
+MULI4
+ARGI4
+ADDRGP4 UI_PrintTime
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1129840640
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 216
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $4159
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 308
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1126170624
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 308
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $4165
+JUMPV
+LABELV $4164
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1129840640
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $4158
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4166
+ADDRGP4 $4159
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 296
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1126170624
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 296
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $4167
+JUMPV
+LABELV $4166
+ADDRGP4 $4168
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 296
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1126170624
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 296
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+LABELV $4167
+LABELV $4165
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $4169
+ADDRGP4 $4171
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 296
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1132986368
+ADDF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 296
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+LABELV $4169
+LABELV $4156
+LABELV $4145
+endproc UI_DisplayDownloadInfo 312 24
+export UI_DrawConnectScreen
+proc UI_DrawConnectScreen 5444 32
+ADDRGP4 $4173
+ARGP4
+ADDRLP4 4380
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRLP4 4116
+ADDRLP4 4380
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4174
+ADDRLP4 4116
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $4174
+ADDRGP4 CG_ClearViewport
+CALLV
+pop
+ADDRLP4 4116
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_Paint
+CALLV
+pop
+LABELV $4174
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4172
+ADDRLP4 3080
+CNSTF4 1134559232
+ASGNF4
+ADDRLP4 4112
+CNSTF4 1124204544
+ASGNF4
+ADDRLP4 3084
+CNSTF4 1056964608
+ASGNF4
+LABELV $4177
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_GetClientState
+CALLV
+pop
+ADDRLP4 3088
+CNSTI1 0
+ASGNI1
+CNSTI4 0
+ARGI4
+ADDRLP4 3088
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4384
+ADDRGP4 trap_GetConfigString
+CALLI4
+ASGNI4
+ADDRLP4 4384
+INDIRI4
+CNSTI4 0
+EQI4 $4178
+ADDRLP4 3088
+ARGP4
+ADDRGP4 $2840
+ARGP4
+ADDRLP4 4388
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $4180
+ARGP4
+ADDRLP4 4388
+INDIRP4
+ARGP4
+ADDRLP4 4392
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 3080
+INDIRF4
+ARGF4
+ADDRLP4 4112
+INDIRF4
+ARGF4
+ADDRLP4 3084
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 4392
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+LABELV $4178
+ADDRLP4 0+8
+ARGP4
+ADDRGP4 $4184
+ARGP4
+ADDRLP4 4388
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4388
+INDIRI4
+CNSTI4 0
+NEI4 $4181
+ADDRLP4 3080
+INDIRF4
+ARGF4
+ADDRLP4 4112
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ARGF4
+ADDRLP4 3084
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 $4185
+ARGP4
+CNSTF4 1086324736
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+ADDRGP4 $4182
+JUMPV
+LABELV $4181
+ADDRLP4 4120
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $4186
+ARGP4
+ADDRLP4 0+8
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 3080
+INDIRF4
+ARGF4
+ADDRLP4 4112
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ARGF4
+ADDRLP4 3084
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 4120
+ARGP4
+CNSTF4 1086324736
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+LABELV $4182
+ADDRLP4 0+1032
+ARGP4
+ADDRGP4 $4189
+ARGP4
+ADDRLP4 4392
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 3080
+INDIRF4
+ARGF4
+CNSTF4 1142292480
+ARGF4
+ADDRLP4 3084
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 4392
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+GEI4 $4190
+ADDRLP4 3080
+INDIRF4
+ARGF4
+ADDRLP4 4112
+INDIRF4
+CNSTF4 1127219200
+ADDF4
+ARGF4
+CNSTF4 1142784000
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 3084
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 0+2056
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 UI_Text_PaintCenter_AutoWrapped
+CALLV
+pop
+LABELV $4190
+ADDRGP4 lastConnState
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $4193
+ADDRGP4 lastLoadingText
+CNSTI1 0
+ASGNI1
+LABELV $4193
+ADDRLP4 4400
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 lastConnState
+ADDRLP4 4400
+INDIRI4
+ASGNI4
+ADDRLP4 4396
+ADDRLP4 4400
+INDIRI4
+ASGNI4
+ADDRLP4 4408
+CNSTI4 2
+ASGNI4
+ADDRLP4 4396
+INDIRI4
+ADDRLP4 4408
+INDIRI4
+LTI4 $4172
+ADDRLP4 4396
+INDIRI4
+CNSTI4 6
+GTI4 $4172
+ADDRLP4 4396
+INDIRI4
+ADDRLP4 4408
+INDIRI4
+LSHI4
+ADDRGP4 $4211-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $4211
+address $4198
+address $4201
+address $4204
+address $4172
+address $4172
+code
+LABELV $4198
+ADDRGP4 $4199
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 4412
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4376
+ADDRLP4 4412
+INDIRP4
+ASGNP4
+ADDRGP4 $4196
+JUMPV
+LABELV $4201
+ADDRGP4 $4202
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 4416
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4376
+ADDRLP4 4416
+INDIRP4
+ASGNP4
+ADDRGP4 $4196
+JUMPV
+LABELV $4204
+ADDRGP4 $4205
+ARGP4
+ADDRLP4 4420
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4420
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $4206
+ADDRLP4 4420
+ARGP4
+ADDRLP4 3080
+INDIRF4
+ARGF4
+ADDRLP4 4112
+INDIRF4
+ARGF4
+ADDRLP4 3084
+INDIRF4
+ARGF4
+ADDRGP4 UI_DisplayDownloadInfo
+CALLV
+pop
+ADDRGP4 $4172
+JUMPV
+LABELV $4206
+ADDRLP4 4376
+ADDRGP4 $4208
+ASGNP4
+LABELV $4196
+ADDRLP4 0+8
+ARGP4
+ADDRGP4 $4184
+ARGP4
+ADDRLP4 4412
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4412
+INDIRI4
+CNSTI4 0
+EQI4 $4213
+ADDRLP4 3080
+INDIRF4
+ARGF4
+ADDRLP4 4112
+INDIRF4
+CNSTF4 1117782016
+ADDF4
+ARGF4
+ADDRLP4 3084
+INDIRF4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 4376
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 UI_Text_PaintCenter
+CALLV
+pop
+LABELV $4213
+LABELV $4172
+endproc UI_DrawConnectScreen 5444 32
+data
+align 4
+LABELV cvarTable
+address ui_arenasFile
+address $4217
+address $631
+byte 4 80
+address ui_botsFile
+address $4218
+address $631
+byte 4 80
+address ui_spSkill
+address $764
+address $4219
+byte 4 1
+address ui_browserShowFull
+address $4220
+address $4221
+byte 4 1
+address ui_browserShowEmpty
+address $4222
+address $4221
+byte 4 1
+address ui_browserShowBots
+address $4223
+address $4221
+byte 4 1
+address ui_browserSeparateMasters
+address $4224
+address $4225
+byte 4 1
+address ui_brassTime
+address $2101
+address $4226
+byte 4 1
+address ui_drawCrosshair
+address $1817
+address $4227
+byte 4 1
+address ui_drawCrosshairNames
+address $4228
+address $4221
+byte 4 1
+address ui_marks
+address $4229
+address $4221
+byte 4 1
+address ui_new
+address $4230
+address $4225
+byte 4 256
+address ui_debug
+address $4231
+address $4225
+byte 4 256
+address ui_initialized
+address $4232
+address $4225
+byte 4 256
+address ui_teamName
+address $657
+address $4233
+byte 4 1
+address ui_opponentName
+address $1022
+address $4234
+byte 4 1
+address ui_redteam
+address $4235
+address $4233
+byte 4 1
+address ui_blueteam
+address $4236
+address $4234
+byte 4 1
+address ui_dedicated
+address $4237
+address $4225
+byte 4 1
+address ui_gameType
+address $4238
+address $4239
+byte 4 1
+address ui_joinGameType
+address $4240
+address $4225
+byte 4 1
+address ui_netGameType
+address $4241
+address $4239
+byte 4 1
+address ui_actualNetGameType
+address $4242
+address $4239
+byte 4 1
+address ui_redteam1
+address $4243
+address $4225
+byte 4 1
+address ui_redteam2
+address $4244
+address $4225
+byte 4 1
+address ui_redteam3
+address $4245
+address $4225
+byte 4 1
+address ui_redteam4
+address $4246
+address $4225
+byte 4 1
+address ui_redteam5
+address $4247
+address $4225
+byte 4 1
+address ui_blueteam1
+address $4248
+address $4225
+byte 4 1
+address ui_blueteam2
+address $4249
+address $4225
+byte 4 1
+address ui_blueteam3
+address $4250
+address $4225
+byte 4 1
+address ui_blueteam4
+address $4251
+address $4225
+byte 4 1
+address ui_blueteam5
+address $4252
+address $4225
+byte 4 1
+address ui_netSource
+address $1751
+address $4221
+byte 4 1
+address ui_menuFiles
+address $599
+address $571
+byte 4 1
+address ui_currentTier
+address $934
+address $4225
+byte 4 1
+address ui_currentMap
+address $973
+address $4225
+byte 4 1
+address ui_currentNetMap
+address $1661
+address $4225
+byte 4 1
+address ui_mapIndex
+address $1966
+address $4225
+byte 4 1
+address ui_currentOpponent
+address $4253
+address $4225
+byte 4 1
+address ui_selectedPlayer
+address $1310
+address $4225
+byte 4 1
+address ui_selectedPlayerName
+address $1318
+address $631
+byte 4 1
+address ui_lastServerRefresh_0
+address $4254
+address $631
+byte 4 1
+address ui_lastServerRefresh_1
+address $4255
+address $631
+byte 4 1
+address ui_lastServerRefresh_2
+address $4256
+address $631
+byte 4 1
+address ui_lastServerRefresh_3
+address $4257
+address $631
+byte 4 1
+address ui_lastServerRefresh_4
+address $4258
+address $631
+byte 4 1
+address ui_lastServerRefresh_5
+address $4259
+address $631
+byte 4 1
+address ui_lastServerRefresh_6
+address $4260
+address $631
+byte 4 1
+address ui_singlePlayerActive
+address $1979
+address $4225
+byte 4 72
+address ui_scoreAccuracy
+address $4261
+address $4225
+byte 4 1
+address ui_scoreImpressives
+address $4262
+address $4225
+byte 4 1
+address ui_scoreExcellents
+address $4263
+address $4225
+byte 4 1
+address ui_scoreCaptures
+address $4264
+address $4225
+byte 4 1
+address ui_scoreDefends
+address $4265
+address $4225
+byte 4 1
+address ui_scoreAssists
+address $4266
+address $4225
+byte 4 1
+address ui_scoreGauntlets
+address $4267
+address $4225
+byte 4 1
+address ui_scoreScore
+address $4268
+address $4225
+byte 4 1
+address ui_scorePerfect
+address $4269
+address $4225
+byte 4 1
+address ui_scoreTeam
+address $4270
+address $4271
+byte 4 1
+address ui_scoreBase
+address $4272
+address $4225
+byte 4 1
+address ui_scoreTime
+address $4273
+address $4274
+byte 4 1
+address ui_scoreTimeBonus
+address $4275
+address $4225
+byte 4 1
+address ui_scoreSkillBonus
+address $4276
+address $4225
+byte 4 1
+address ui_scoreShutoutBonus
+address $4277
+address $4225
+byte 4 1
+address ui_fragLimit
+address $672
+address $652
+byte 4 0
+address ui_captureLimit
+address $671
+address $653
+byte 4 0
+address ui_smallFont
+address $4278
+address $4279
+byte 4 1
+address ui_bigFont
+address $4280
+address $4281
+byte 4 1
+address ui_findPlayer
+address $2934
+address $4282
+byte 4 1
+address ui_Q3Model
+address $4283
+address $4225
+byte 4 1
+address ui_hudFiles
+address $4284
+address $4285
+byte 4 1
+address ui_recordSPDemo
+address $1998
+address $4225
+byte 4 1
+address ui_teamArenaFirstRun
+address $4286
+address $4225
+byte 4 1
+byte 4 0
+address $1990
+address $650
+byte 4 1
+byte 4 0
+address $2846
+address $4225
+byte 4 1029
+byte 4 0
+address $674
+address $650
+byte 4 1029
+byte 4 0
+address $673
+address $4287
+byte 4 1029
+address ui_serverStatusTimeOut
+address $4288
+address $4289
+byte 4 1
+byte 4 0
+address $2095
+address $631
+byte 4 64
+address ui_defaultMaleTeamModel
+address $4290
+address $4291
+byte 4 1
+address ui_defaultFemaleTeamModel
+address $4292
+address $4293
+byte 4 1
+address ui_menuFont
+address $4294
+address $4295
+byte 4 33
+align 4
+LABELV cvarTableSize
+byte 4 83
+export UI_RegisterCvars
+code
+proc UI_RegisterCvars 12 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $4300
+JUMPV
+LABELV $4297
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $4298
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $4300
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $4297
+ADDRGP4 $4025
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTF4 1088421888
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Cvar_CheckRange
+CALLV
+pop
+LABELV $4296
+endproc UI_RegisterCvars 12 16
+export UI_UpdateCvars
+proc UI_UpdateCvars 8 4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $4305
+JUMPV
+LABELV $4302
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $4306
+ADDRGP4 $4303
+JUMPV
+LABELV $4306
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $4303
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $4305
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $4302
+LABELV $4301
+endproc UI_UpdateCvars 8 4
+proc UI_StopServerRefresh 16 12
+ADDRGP4 uiInfo+131252+2212
+INDIRI4
+CNSTI4 0
+NEI4 $4309
+ADDRGP4 $4308
+JUMPV
+LABELV $4309
+ADDRGP4 uiInfo+131252+2212
+CNSTI4 0
+ASGNI4
+ADDRGP4 $4315
+ARGP4
+ADDRGP4 uiInfo+131252+10412
+INDIRI4
+ARGI4
+ADDRGP4 uiInfo+131252+10416
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+131252+10412
+INDIRI4
+SUBI4
+CNSTI4 0
+LEI4 $4320
+ADDRGP4 $4327
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $4324
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 uiInfo+131252+10412
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $4320
+LABELV $4308
+endproc UI_StopServerRefresh 16 12
+proc UI_DoServerRefresh 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+131252+2212
+INDIRI4
+CNSTI4 0
+NEI4 $4329
+ADDRGP4 $4328
+JUMPV
+LABELV $4329
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 7
+EQI4 $4333
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+NEI4 $4336
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $4337
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $4337
+JUMPV
+LABELV $4336
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $4341
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $4341
+LABELV $4337
+LABELV $4333
+ADDRGP4 uiInfo+212
+INDIRI4
+ADDRGP4 uiInfo+131252+2192
+INDIRI4
+GEI4 $4343
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $4348
+ADDRGP4 $4328
+JUMPV
+LABELV $4348
+LABELV $4343
+ADDRLP4 4
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_LAN_UpdateVisiblePings
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $4350
+ADDRGP4 uiInfo+131252+2192
+ADDRGP4 uiInfo+212
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRGP4 $4351
+JUMPV
+LABELV $4350
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4355
+CNSTI4 2
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+ADDRGP4 UI_StopServerRefresh
+CALLV
+pop
+ADDRGP4 $4356
+JUMPV
+LABELV $4355
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+NEI4 $4357
+CNSTI4 0
+ARGI4
+ADDRGP4 $4360
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 uiInfo+131252+2192
+ADDRGP4 uiInfo+212
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+LABELV $4357
+LABELV $4356
+LABELV $4351
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_BuildServerDisplayList
+CALLV
+pop
+LABELV $4328
+endproc UI_DoServerRefresh 12 8
+proc UI_StartServerRefresh 72 24
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $4365
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 1
+LTI4 $4365
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 6
+GTI4 $4365
+ADDRLP4 44
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+LEI4 $4369
+ADDRGP4 $4364
+JUMPV
+LABELV $4369
+LABELV $4365
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_RealTime
+CALLI4
+pop
+ADDRGP4 $1230
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $4372
+ARGP4
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 MonthAbbrev
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0+12
+INDIRI4
+ARGI4
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1900
+ADDI4
+ARGI4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $4378
+ADDRGP4 UI_UpdatePendingPings
+CALLV
+pop
+ADDRGP4 $4364
+JUMPV
+LABELV $4378
+ADDRGP4 uiInfo+131252+2212
+CNSTI4 1
+ASGNI4
+ADDRGP4 uiInfo+131252+10420
+ADDRGP4 uiInfo+212
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRGP4 uiInfo+131252+10412
+CNSTI4 0
+ASGNI4
+ADDRGP4 uiInfo+131252+10416
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+ADDRGP4 UI_SourceForLAN
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_LAN_MarkServerVisible
+CALLV
+pop
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 trap_LAN_ResetPings
+CALLV
+pop
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 0
+NEI4 $4389
+CNSTI4 0
+ARGI4
+ADDRGP4 $4360
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 uiInfo+131252+2192
+ADDRGP4 uiInfo+212
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRGP4 $4364
+JUMPV
+LABELV $4389
+ADDRGP4 uiInfo+131252+2192
+ADDRGP4 uiInfo+212
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 1
+LTI4 $4398
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 6
+GTI4 $4398
+ADDRGP4 $4024
+ARGP4
+ADDRLP4 56
+ADDRGP4 CG_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 60
+INDIRU4
+CNSTU4 0
+EQU4 $4402
+ADDRGP4 $4404
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $4403
+JUMPV
+LABELV $4402
+ADDRGP4 $2843
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $4406
+ARGP4
+ADDRGP4 ui_netSource+12
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 64
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $4403
+LABELV $4398
+LABELV $4364
+endproc UI_StartServerRefresh 72 24
+bss
+export ui_recordSPDemo
+align 4
+LABELV ui_recordSPDemo
+skip 272
+export ui_hudFiles
+align 4
+LABELV ui_hudFiles
+skip 272
+export ui_Q3Model
+align 4
+LABELV ui_Q3Model
+skip 272
+export ui_findPlayer
+align 4
+LABELV ui_findPlayer
+skip 272
+export ui_scoreCaptures
+align 4
+LABELV ui_scoreCaptures
+skip 272
+export ui_lastServerRefresh_6
+align 4
+LABELV ui_lastServerRefresh_6
+skip 272
+export ui_lastServerRefresh_5
+align 4
+LABELV ui_lastServerRefresh_5
+skip 272
+export ui_lastServerRefresh_4
+align 4
+LABELV ui_lastServerRefresh_4
+skip 272
+export ui_teamName
+align 4
+LABELV ui_teamName
+skip 272
+export ui_blueteam5
+align 4
+LABELV ui_blueteam5
+skip 272
+export ui_blueteam4
+align 4
+LABELV ui_blueteam4
+skip 272
+export ui_blueteam3
+align 4
+LABELV ui_blueteam3
+skip 272
+export ui_blueteam2
+align 4
+LABELV ui_blueteam2
+skip 272
+export ui_blueteam1
+align 4
+LABELV ui_blueteam1
+skip 272
+export ui_blueteam
+align 4
+LABELV ui_blueteam
+skip 272
+export ui_redteam5
+align 4
+LABELV ui_redteam5
+skip 272
+export ui_redteam4
+align 4
+LABELV ui_redteam4
+skip 272
+export ui_redteam3
+align 4
+LABELV ui_redteam3
+skip 272
+export ui_redteam2
+align 4
+LABELV ui_redteam2
+skip 272
+export ui_redteam1
+align 4
+LABELV ui_redteam1
+skip 272
+export ui_redteam
+align 4
+LABELV ui_redteam
+skip 272
+align 1
+LABELV lastLoadingText
+skip 1024
+align 4
+LABELV lastConnState
+skip 4
+export startTime
+align 4
+LABELV startTime
+skip 4
+export ui_teamArenaFirstRun
+align 4
+LABELV ui_teamArenaFirstRun
+skip 272
+export ui_initialized
+align 4
+LABELV ui_initialized
+skip 272
+export ui_debug
+align 4
+LABELV ui_debug
+skip 272
+export ui_new
+align 4
+LABELV ui_new
+skip 272
+import ProcessNewUI
+import UI_GetBotNameByNumber
+import UI_LoadBots
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_LoadBestScores
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+export uiInfo
+align 4
+LABELV uiInfo
+skip 168888
+import UI_RegisterPlayerModelname
+import UI_PlayerInfo_UpdateColor
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import UI_LoadArenasIntoMapList
+import UI_LoadArenas
+import UI_ClearScores
+import UI_AdjustTimeByGame
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+export ui_menuFont
+align 4
+LABELV ui_menuFont
+skip 272
+export ui_defaultFemaleTeamModel
+align 4
+LABELV ui_defaultFemaleTeamModel
+skip 272
+export ui_defaultMaleTeamModel
+align 4
+LABELV ui_defaultMaleTeamModel
+skip 272
+export ui_serverStatusTimeOut
+align 4
+LABELV ui_serverStatusTimeOut
+skip 272
+export ui_bigFont
+align 4
+LABELV ui_bigFont
+skip 272
+export ui_smallFont
+align 4
+LABELV ui_smallFont
+skip 272
+export ui_scoreTime
+align 4
+LABELV ui_scoreTime
+skip 272
+export ui_scoreShutoutBonus
+align 4
+LABELV ui_scoreShutoutBonus
+skip 272
+export ui_scoreSkillBonus
+align 4
+LABELV ui_scoreSkillBonus
+skip 272
+export ui_scoreTimeBonus
+align 4
+LABELV ui_scoreTimeBonus
+skip 272
+export ui_scoreBase
+align 4
+LABELV ui_scoreBase
+skip 272
+export ui_scoreTeam
+align 4
+LABELV ui_scoreTeam
+skip 272
+export ui_scorePerfect
+align 4
+LABELV ui_scorePerfect
+skip 272
+export ui_scoreScore
+align 4
+LABELV ui_scoreScore
+skip 272
+export ui_scoreGauntlets
+align 4
+LABELV ui_scoreGauntlets
+skip 272
+export ui_scoreAssists
+align 4
+LABELV ui_scoreAssists
+skip 272
+export ui_scoreDefends
+align 4
+LABELV ui_scoreDefends
+skip 272
+export ui_scoreExcellents
+align 4
+LABELV ui_scoreExcellents
+skip 272
+export ui_scoreImpressives
+align 4
+LABELV ui_scoreImpressives
+skip 272
+export ui_scoreAccuracy
+align 4
+LABELV ui_scoreAccuracy
+skip 272
+export ui_singlePlayerActive
+align 4
+LABELV ui_singlePlayerActive
+skip 272
+export ui_lastServerRefresh_3
+align 4
+LABELV ui_lastServerRefresh_3
+skip 272
+export ui_lastServerRefresh_2
+align 4
+LABELV ui_lastServerRefresh_2
+skip 272
+export ui_lastServerRefresh_1
+align 4
+LABELV ui_lastServerRefresh_1
+skip 272
+export ui_lastServerRefresh_0
+align 4
+LABELV ui_lastServerRefresh_0
+skip 272
+export ui_selectedPlayerName
+align 4
+LABELV ui_selectedPlayerName
+skip 272
+export ui_selectedPlayer
+align 4
+LABELV ui_selectedPlayer
+skip 272
+export ui_currentOpponent
+align 4
+LABELV ui_currentOpponent
+skip 272
+export ui_mapIndex
+align 4
+LABELV ui_mapIndex
+skip 272
+export ui_currentNetMap
+align 4
+LABELV ui_currentNetMap
+skip 272
+export ui_currentMap
+align 4
+LABELV ui_currentMap
+skip 272
+export ui_currentTier
+align 4
+LABELV ui_currentTier
+skip 272
+export ui_menuFiles
+align 4
+LABELV ui_menuFiles
+skip 272
+export ui_opponentName
+align 4
+LABELV ui_opponentName
+skip 272
+export ui_dedicated
+align 4
+LABELV ui_dedicated
+skip 272
+export ui_serverFilterType
+align 4
+LABELV ui_serverFilterType
+skip 272
+export ui_netSource
+align 4
+LABELV ui_netSource
+skip 272
+export ui_joinGameType
+align 4
+LABELV ui_joinGameType
+skip 272
+export ui_actualNetGameType
+align 4
+LABELV ui_actualNetGameType
+skip 272
+export ui_netGameType
+align 4
+LABELV ui_netGameType
+skip 272
+export ui_gameType
+align 4
+LABELV ui_gameType
+skip 272
+export ui_fragLimit
+align 4
+LABELV ui_fragLimit
+skip 272
+export ui_captureLimit
+align 4
+LABELV ui_captureLimit
+skip 272
+export ui_marks
+align 4
+LABELV ui_marks
+skip 272
+export ui_drawCrosshairNames
+align 4
+LABELV ui_drawCrosshairNames
+skip 272
+export ui_drawCrosshair
+align 4
+LABELV ui_drawCrosshair
+skip 272
+export ui_brassTime
+align 4
+LABELV ui_brassTime
+skip 272
+export ui_browserSeparateMasters
+align 4
+LABELV ui_browserSeparateMasters
+skip 272
+export ui_browserShowBots
+align 4
+LABELV ui_browserShowBots
+skip 272
+export ui_browserShowEmpty
+align 4
+LABELV ui_browserShowEmpty
+skip 272
+export ui_browserShowFull
+align 4
+LABELV ui_browserShowFull
+skip 272
+export ui_spSkill
+align 4
+LABELV ui_spSkill
+skip 272
+export ui_botsFile
+align 4
+LABELV ui_botsFile
+skip 272
+export ui_arenasFile
+align 4
+LABELV ui_arenasFile
+skip 272
+import Controls_SetDefaults_ui_shared
+import Controls_SetConfig_ui_shared
+import Controls_GetConfig_ui_shared
+import UI_OutOfMemory
+import UI_InitMemory_ui_shared
+import UI_Alloc_ui_shared
+import Menu_FindItemByName
+import Display_ScriptExecutions
+import Display_DebugMode
+import Display_CacheAll
+import Menu_SetScreenPlacement
+import Menu_SetFeederSelection
+import Menu_Paint
+import Menus_CloseAll
+import LerpColor
+import Display_HandleKey
+import Menus_CloseByName
+import Menus_ShowByName
+import Menus_FindByName
+import Menus_OpenByName
+import Display_WantsBindKeys
+import Display_KeyBindPending
+import Display_CursorType
+import Display_MouseMove
+import Display_CaptureItem
+import Display_GetContext
+import UI_SelectForKey
+import Menus_Activate
+import Menus_AnyFullScreenVisible
+import Menu_Reset
+import Menus_ActivateByName
+import Menu_PaintAll
+import Menu_New
+import Menu_Count
+import Script_Compile
+import PC_CompiledScript_Parse
+import PC_Script_Parse
+import PC_String_Parse
+import PC_Rect_Parse
+import PC_Int_Parse
+import PC_Color_Parse
+import PC_Float_Parse
+import Script_Parse
+import String_Parse
+import Rect_Parse
+import Int_Parse
+import Color_Parse
+import Float_Parse
+import Menu_ScrollFeeder
+import Menu_HandleMouseMove
+import Menu_HandleKey
+import Menu_GetFocused
+import Menu_PostParse
+import Item_Init
+import Menu_Init
+import Display_ExpandMacros
+import Init_Display
+import String_Report
+import String_Init
+import String_Alloc
+import UI_ConsoleCommand
+import ui_numCommands
+import ui_commands
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_LoadVoiceChats
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_enableBreath
+import cg_enableDust
+import cg_blueTeamName
+import cg_redTeamName
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $4406
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $4404
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 10
+byte 1 0
+align 1
+LABELV $4372
+byte 1 37
+byte 1 115
+byte 1 45
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $4360
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $4327
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $4324
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4315
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $4295
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 76
+byte 1 105
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 83
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 45
+byte 1 66
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $4294
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $4293
+byte 1 106
+byte 1 97
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $4292
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $4291
+byte 1 106
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4290
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $4289
+byte 1 55
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $4288
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $4287
+byte 1 56
+byte 1 0
+align 1
+LABELV $4286
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $4285
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $4284
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 100
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4283
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 113
+byte 1 51
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $4282
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $4281
+byte 1 48
+byte 1 46
+byte 1 52
+byte 1 0
+align 1
+LABELV $4280
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $4279
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 53
+byte 1 0
+align 1
+LABELV $4278
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $4277
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 83
+byte 1 104
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 66
+byte 1 111
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $4276
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 66
+byte 1 111
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $4275
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 66
+byte 1 111
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $4274
+byte 1 48
+byte 1 48
+byte 1 58
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $4273
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4272
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 66
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $4271
+byte 1 48
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 48
+byte 1 0
+align 1
+LABELV $4270
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $4269
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $4268
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $4267
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $4266
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 65
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $4265
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $4264
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4263
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $4262
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4261
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 65
+byte 1 99
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 121
+byte 1 0
+align 1
+LABELV $4260
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 54
+byte 1 0
+align 1
+LABELV $4259
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 53
+byte 1 0
+align 1
+LABELV $4258
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 52
+byte 1 0
+align 1
+LABELV $4257
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 51
+byte 1 0
+align 1
+LABELV $4256
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 50
+byte 1 0
+align 1
+LABELV $4255
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $4254
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $4253
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 79
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $4252
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 53
+byte 1 0
+align 1
+LABELV $4251
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 52
+byte 1 0
+align 1
+LABELV $4250
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 51
+byte 1 0
+align 1
+LABELV $4249
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 50
+byte 1 0
+align 1
+LABELV $4248
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 49
+byte 1 0
+align 1
+LABELV $4247
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 53
+byte 1 0
+align 1
+LABELV $4246
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 52
+byte 1 0
+align 1
+LABELV $4245
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 51
+byte 1 0
+align 1
+LABELV $4244
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 50
+byte 1 0
+align 1
+LABELV $4243
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 49
+byte 1 0
+align 1
+LABELV $4242
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 78
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $4241
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $4240
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $4239
+byte 1 51
+byte 1 0
+align 1
+LABELV $4238
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $4237
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $4236
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $4235
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $4234
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $4233
+byte 1 80
+byte 1 97
+byte 1 103
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $4232
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $4231
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 0
+align 1
+LABELV $4230
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $4229
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $4228
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4227
+byte 1 52
+byte 1 0
+align 1
+LABELV $4226
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $4225
+byte 1 48
+byte 1 0
+align 1
+LABELV $4224
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $4223
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $4222
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $4221
+byte 1 49
+byte 1 0
+align 1
+LABELV $4220
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $4219
+byte 1 50
+byte 1 0
+align 1
+LABELV $4218
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4217
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $4208
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $4205
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4202
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $4199
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $4189
+byte 1 109
+byte 1 111
+byte 1 116
+byte 1 100
+byte 1 0
+align 1
+LABELV $4186
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4185
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $4184
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $4180
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $4173
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $4171
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 83
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $4168
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 112
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $4159
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 112
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $4158
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $4154
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 37
+byte 1 41
+byte 1 0
+align 1
+LABELV $4151
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4150
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $4149
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $4122
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $4121
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $4118
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $4114
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $4113
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 75
+byte 1 66
+byte 1 0
+align 1
+LABELV $4110
+byte 1 46
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 32
+byte 1 77
+byte 1 66
+byte 1 0
+align 1
+LABELV $4107
+byte 1 46
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 100
+byte 1 32
+byte 1 71
+byte 1 66
+byte 1 0
+align 1
+LABELV $4101
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $4100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4098
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 102
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4092
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $4025
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 78
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $4024
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $4023
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 99
+byte 1 118
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4022
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $4021
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 115
+byte 1 116
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $3996
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $3992
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $3990
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 51
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $3932
+byte 1 68
+byte 1 69
+byte 1 66
+byte 1 85
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $3927
+byte 1 37
+byte 1 100
+byte 1 120
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $3921
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3902
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3901
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $3898
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $3897
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $3896
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 0
+align 1
+LABELV $3888
+byte 1 36
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3887
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3885
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $3884
+byte 1 46
+byte 1 0
+align 1
+LABELV $3874
+byte 1 47
+byte 1 0
+align 1
+LABELV $3873
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $3823
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $3818
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3813
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3799
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $3791
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $3736
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $3731
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $3678
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3675
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $3670
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $3648
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $3635
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $3610
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $3602
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $3595
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $3590
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $3578
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $3556
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $3514
+byte 1 84
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $3395
+byte 1 42
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3292
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $3287
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 0
+align 1
+LABELV $3281
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3280
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 91
+byte 1 37
+byte 1 115
+byte 1 93
+byte 1 0
+align 1
+LABELV $3276
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $3101
+byte 1 115
+byte 1 0
+align 1
+LABELV $3098
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $3093
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $3011
+byte 1 115
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 47
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $2953
+byte 1 115
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $2945
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2934
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2900
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2890
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $2889
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $2888
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $2846
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $2845
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $2844
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $2843
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $2842
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $2841
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $2840
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2839
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2838
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 98
+byte 1 98
+byte 1 114
+byte 1 0
+align 1
+LABELV $2837
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 78
+byte 1 101
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2836
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2835
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2834
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2833
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $2832
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2831
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2817
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2806
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2781
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2780
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $2746
+byte 1 87
+byte 1 101
+byte 1 108
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 33
+byte 1 0
+align 1
+LABELV $2735
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 116
+byte 1 100
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $2573
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2537
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 85
+byte 1 73
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2534
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2531
+byte 1 103
+byte 1 108
+byte 1 67
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $2522
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $2514
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $2501
+byte 1 10
+byte 1 0
+align 1
+LABELV $2494
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $2485
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $2484
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2483
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2471
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2468
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2467
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $2464
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $2459
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 0
+align 1
+LABELV $2458
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2450
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2444
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $2441
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2431
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $2426
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2420
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 76
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2414
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $2408
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2403
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $2397
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 75
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $2391
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2385
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $2382
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2379
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $2376
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $2360
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $2357
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $2356
+byte 1 76
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $2353
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 50
+byte 1 0
+align 1
+LABELV $2352
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $2349
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $2348
+byte 1 81
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $2338
+byte 1 70
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 74
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2335
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2322
+byte 1 74
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2317
+byte 1 70
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2310
+byte 1 70
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $2301
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $2298
+byte 1 85
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2291
+byte 1 83
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $2288
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2287
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2278
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 74
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2275
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 51
+byte 1 0
+align 1
+LABELV $2274
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $2269
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2268
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $2265
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 59
+byte 1 0
+align 1
+LABELV $2262
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2261
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $2256
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 114
+byte 1 111
+byte 1 113
+byte 1 32
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $2251
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 77
+byte 1 111
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 0
+align 1
+LABELV $2248
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $2245
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 77
+byte 1 111
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $2242
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $2233
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $2229
+byte 1 82
+byte 1 117
+byte 1 110
+byte 1 83
+byte 1 80
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $2226
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2223
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $2220
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $2211
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $2208
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $2207
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2204
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $2201
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $2198
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2197
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 0
+align 1
+LABELV $2194
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $2193
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2192
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $2191
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $2190
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2183
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 83
+byte 1 80
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $2168
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $2167
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2158
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $2127
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $2125
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2124
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2117
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2115
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $2112
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 80
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $2107
+byte 1 71
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 80
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 95
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 0
+align 1
+LABELV $2105
+byte 1 54
+byte 1 52
+byte 1 48
+byte 1 120
+byte 1 52
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $2103
+byte 1 71
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 80
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 0
+align 1
+LABELV $2102
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $2101
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2100
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 0
+align 1
+LABELV $2099
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 86
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 0
+align 1
+LABELV $2098
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 107
+byte 1 121
+byte 1 0
+align 1
+LABELV $2097
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2096
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $2095
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $2094
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $2093
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 109
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $2092
+byte 1 114
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $2091
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $2087
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 103
+byte 1 108
+byte 1 67
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $2082
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 98
+byte 1 100
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $2078
+byte 1 114
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 98
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 0
+align 1
+LABELV $2071
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 105
+byte 1 108
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2070
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 104
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2066
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2063
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2058
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 100
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $2057
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $2054
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2053
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 82
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $2050
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2049
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2045
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2044
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $2020
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2006
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 10
+byte 1 0
+align 1
+LABELV $2003
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 83
+byte 1 80
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1999
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1998
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 83
+byte 1 80
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $1995
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1994
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1993
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $1992
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $1991
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $1990
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $1989
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $1988
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $1987
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $1986
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $1985
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $1984
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $1983
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1982
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1981
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1980
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $1979
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $1976
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $1972
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1966
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 73
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $1962
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $1947
+byte 1 32
+byte 1 40
+byte 1 117
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $1946
+byte 1 68
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 75
+byte 1 66
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 45
+byte 1 62
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1936
+byte 1 36
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $1935
+byte 1 100
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $1919
+byte 1 36
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $1918
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 0
+align 1
+LABELV $1909
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $1894
+byte 1 36
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $1834
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $1817
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $1751
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $1737
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1728
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $1676
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $1661
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 101
+byte 1 116
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $1657
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $1655
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $1631
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $1581
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $1379
+byte 1 80
+byte 1 73
+byte 1 88
+byte 1 69
+byte 1 76
+byte 1 70
+byte 1 79
+byte 1 82
+byte 1 77
+byte 1 65
+byte 1 84
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 90
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 105
+byte 1 108
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 0
+align 1
+LABELV $1375
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1372
+byte 1 86
+byte 1 69
+byte 1 78
+byte 1 68
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1343
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1341
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 41
+byte 1 0
+align 1
+LABELV $1328
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1318
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1310
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1288
+byte 1 110
+byte 1 0
+align 1
+LABELV $1279
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $1278
+byte 1 116
+byte 1 0
+align 1
+LABELV $1277
+byte 1 116
+byte 1 108
+byte 1 0
+align 1
+LABELV $1239
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $1230
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 82
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1228
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 67
+byte 1 76
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 65
+byte 1 67
+byte 1 75
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $1227
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 65
+byte 1 80
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1199
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1022
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1015
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1010
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $973
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $952
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $939
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $934
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $931
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $912
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $893
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $892
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $889
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $888
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $887
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 81
+byte 1 51
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $854
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 48
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $846
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $799
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $796
+byte 1 72
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $793
+byte 1 67
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $787
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $786
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $780
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $779
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $778
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $771
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $770
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $764
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $733
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 114
+byte 1 111
+byte 1 113
+byte 1 0
+align 1
+LABELV $714
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $709
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $674
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $673
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $672
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $671
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $657
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $655
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $653
+byte 1 53
+byte 1 0
+align 1
+LABELV $652
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $651
+byte 1 49
+byte 1 53
+byte 1 0
+align 1
+LABELV $650
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $649
+byte 1 50
+byte 1 53
+byte 1 0
+align 1
+LABELV $648
+byte 1 51
+byte 1 48
+byte 1 0
+align 1
+LABELV $647
+byte 1 51
+byte 1 53
+byte 1 0
+align 1
+LABELV $646
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $645
+byte 1 52
+byte 1 53
+byte 1 0
+align 1
+LABELV $644
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $643
+byte 1 53
+byte 1 53
+byte 1 0
+align 1
+LABELV $642
+byte 1 54
+byte 1 48
+byte 1 0
+align 1
+LABELV $641
+byte 1 54
+byte 1 53
+byte 1 0
+align 1
+LABELV $640
+byte 1 55
+byte 1 48
+byte 1 0
+align 1
+LABELV $639
+byte 1 55
+byte 1 53
+byte 1 0
+align 1
+LABELV $638
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $637
+byte 1 56
+byte 1 53
+byte 1 0
+align 1
+LABELV $636
+byte 1 57
+byte 1 48
+byte 1 0
+align 1
+LABELV $635
+byte 1 57
+byte 1 53
+byte 1 0
+align 1
+LABELV $634
+byte 1 78
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $631
+byte 1 0
+align 1
+LABELV $622
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $606
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $605
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $599
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $597
+byte 1 85
+byte 1 73
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $594
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $574
+byte 1 94
+byte 1 49
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 101
+byte 1 33
+byte 1 0
+align 1
+LABELV $571
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $570
+byte 1 94
+byte 1 51
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $548
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $542
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 71
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $528
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $522
+byte 1 71
+byte 1 108
+byte 1 121
+byte 1 112
+byte 1 104
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $517
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 10
+byte 1 0
+align 1
+LABELV $516
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 10
+byte 1 0
+align 1
+LABELV $505
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $497
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 89
+byte 1 0
+align 1
+LABELV $489
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 88
+byte 1 0
+align 1
+LABELV $481
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 65
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $473
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $465
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $453
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $445
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 66
+byte 1 117
+byte 1 122
+byte 1 122
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $437
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 70
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $429
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $421
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $413
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $402
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 85
+byte 1 73
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $390
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $379
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 85
+byte 1 73
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $367
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $354
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 85
+byte 1 73
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 10
+byte 1 0
+align 1
+LABELV $342
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $338
+byte 1 125
+byte 1 0
+align 1
+LABELV $329
+byte 1 123
+byte 1 0
+align 1
+LABELV $322
+byte 1 94
+byte 1 49
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $319
+byte 1 94
+byte 1 49
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $311
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $238
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $236
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 37
+byte 1 99
+byte 1 0
+align 1
+LABELV $229
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $226
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 50
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $223
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $220
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $217
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $214
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 117
+byte 1 112
+byte 1 95
+byte 1 97
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $211
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 100
+byte 1 119
+byte 1 110
+byte 1 95
+byte 1 97
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $208
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $205
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $201
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 0
+align 1
+LABELV $197
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 99
+byte 1 121
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $193
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $189
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $185
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $181
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $177
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $173
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 110
+byte 1 0
+align 1
+LABELV $169
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $165
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $161
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 111
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $157
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $154
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 120
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $151
+byte 1 117
+byte 1 105
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 50
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $145
+byte 1 85
+byte 1 68
+byte 1 80
+byte 1 54
+byte 1 0
+align 1
+LABELV $144
+byte 1 85
+byte 1 68
+byte 1 80
+byte 1 0
+align 1
+LABELV $143
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $142
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $141
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 53
+byte 1 0
+align 1
+LABELV $140
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 52
+byte 1 0
+align 1
+LABELV $139
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 51
+byte 1 0
+align 1
+LABELV $138
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $137
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $136
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $135
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $134
+byte 1 78
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $133
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $132
+byte 1 72
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 77
+byte 1 101
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $131
+byte 1 66
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 73
+byte 1 116
+byte 1 32
+byte 1 79
+byte 1 110
+byte 1 0
+align 1
+LABELV $130
+byte 1 73
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 87
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $129
+byte 1 68
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $128
+byte 1 78
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $127
+byte 1 79
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $126
+byte 1 83
+byte 1 101
+byte 1 112
+byte 1 0
+align 1
+LABELV $125
+byte 1 65
+byte 1 117
+byte 1 103
+byte 1 0
+align 1
+LABELV $124
+byte 1 74
+byte 1 117
+byte 1 108
+byte 1 0
+align 1
+LABELV $123
+byte 1 74
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $122
+byte 1 77
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $121
+byte 1 65
+byte 1 112
+byte 1 114
+byte 1 0
+align 1
+LABELV $120
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $119
+byte 1 70
+byte 1 101
+byte 1 98
+byte 1 0
+align 1
+LABELV $118
+byte 1 74
+byte 1 97
+byte 1 110
+byte 1 0
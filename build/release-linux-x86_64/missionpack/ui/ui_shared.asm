@@ -0,0 +1,38427 @@
+data
+align 4
+LABELV captureFunc
+byte 4 0
+align 4
+LABELV captureData
+byte 4 0
+align 4
+LABELV itemCapture
+byte 4 0
+export DC
+align 4
+LABELV DC
+byte 4 0
+align 4
+LABELV g_waitingForKey
+byte 4 0
+align 4
+LABELV g_editingField
+byte 4 0
+align 4
+LABELV g_bindItem
+byte 4 0
+align 4
+LABELV g_editItem
+byte 4 0
+align 4
+LABELV debugMode
+byte 4 0
+align 4
+LABELV lastListBoxClickTime
+byte 4 0
+align 4
+LABELV scriptExecutions
+byte 4 0
+align 4
+LABELV scriptExecutionsLastFrame
+byte 4 0
+export UI_Alloc_ui_shared
+code
+proc UI_Alloc_ui_shared 12 4
+ADDRGP4 allocPoint_ui_shared
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+CNSTI4 1179648
+LEI4 $106
+ADDRGP4 outOfMemory_ui_shared
+CNSTI4 1
+ASGNI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $108
+ADDRGP4 $110
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $108
+CNSTP4 0
+RETP4
+ADDRGP4 $105
+JUMPV
+LABELV $106
+ADDRLP4 4
+ADDRGP4 allocPoint_ui_shared
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRGP4 memoryPool_ui_shared
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 15
+ADDI4
+CNSTI4 -16
+BANDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $105
+endproc UI_Alloc_ui_shared 12 4
+export UI_InitMemory_ui_shared
+proc UI_InitMemory_ui_shared 4 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 allocPoint_ui_shared
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 outOfMemory_ui_shared
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 scriptHash
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTU4 2048
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $111
+endproc UI_InitMemory_ui_shared 4 12
+export UI_OutOfMemory
+proc UI_OutOfMemory 0 0
+ADDRGP4 outOfMemory_ui_shared
+INDIRI4
+RETI4
+LABELV $112
+endproc UI_OutOfMemory 0 0
+proc hashForString 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRU4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CVIU4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 119
+ADDI4
+CVIU4 4
+MULU4
+ADDU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $115
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $114
+ADDRLP4 8
+ADDRLP4 8
+INDIRU4
+CNSTU4 2047
+BANDU4
+ASGNU4
+ADDRLP4 8
+INDIRU4
+RETU4
+LABELV $113
+endproc hashForString 20 4
+data
+align 4
+LABELV strPoolIndex
+byte 4 0
+align 4
+LABELV strHandleCount
+byte 4 0
+align 4
+LABELV $118
+address $119
+export String_Alloc
+code
+proc String_Alloc 44 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $120
+CNSTP4 0
+RETP4
+ADDRGP4 $117
+JUMPV
+LABELV $120
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $122
+ADDRGP4 $118
+INDIRP4
+RETP4
+ADDRGP4 $117
+JUMPV
+LABELV $122
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 hashForString
+CALLU4
+ASGNU4
+ADDRLP4 8
+ADDRLP4 16
+INDIRU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 strHandle
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $125
+JUMPV
+LABELV $124
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $127
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $117
+JUMPV
+LABELV $127
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $125
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $124
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 12
+ADDRLP4 20
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 strPoolIndex
+INDIRI4
+ADDI4
+CNSTI4 1
+ADDI4
+CNSTI4 524288
+GEI4 $129
+ADDRLP4 24
+ADDRGP4 strPoolIndex
+INDIRI4
+ASGNI4
+ADDRGP4 strPoolIndex
+INDIRI4
+ADDRGP4 strPool
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 28
+ADDRGP4 strPoolIndex
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 strHandle
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $132
+JUMPV
+LABELV $131
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+LABELV $132
+ADDRLP4 36
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 36
+INDIRU4
+EQU4 $134
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRLP4 36
+INDIRU4
+NEU4 $131
+LABELV $134
+CNSTI4 8
+ARGI4
+ADDRLP4 40
+ADDRGP4 UI_Alloc_ui_shared
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $135
+CNSTP4 0
+RETP4
+ADDRGP4 $117
+JUMPV
+LABELV $135
+ADDRLP4 0
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 strPool
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $137
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $138
+JUMPV
+LABELV $137
+ADDRLP4 8
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 strHandle
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $138
+ADDRLP4 24
+INDIRI4
+ADDRGP4 strPool
+ADDP4
+RETP4
+ADDRGP4 $117
+JUMPV
+LABELV $129
+CNSTP4 0
+RETP4
+LABELV $117
+endproc String_Alloc 44 8
+export String_Report
+proc String_Report 12 16
+ADDRGP4 $140
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $141
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 strPoolIndex
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1224736768
+DIVF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1120403456
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $142
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 524288
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 allocPoint_ui_shared
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1234173952
+DIVF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1120403456
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $143
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 1179648
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $139
+endproc String_Report 12 16
+export String_Init
+proc String_Init 8 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $145
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 strHandle
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $146
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2048
+LTI4 $145
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 strHandleCount
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 strPoolIndex
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104120
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 UI_InitMemory_ui_shared
+CALLV
+pop
+ADDRGP4 Item_SetupKeywordHash
+CALLV
+pop
+ADDRGP4 Menu_SetupKeywordHash
+CALLV
+pop
+ADDRGP4 DC
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $149
+ADDRGP4 Controls_GetConfig_ui_shared
+CALLV
+pop
+LABELV $149
+LABELV $144
+endproc String_Init 8 0
+export LerpColor
+proc LerpColor 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $152
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $156
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $157
+JUMPV
+LABELV $156
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $158
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $158
+LABELV $157
+LABELV $153
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $152
+LABELV $151
+endproc LerpColor 12 0
+export Float_Parse
+proc Float_Parse 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $161
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $161
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $160
+JUMPV
+LABELV $161
+CNSTI4 0
+RETI4
+LABELV $160
+endproc Float_Parse 16 8
+export PC_Float_Parse
+proc PC_Float_Parse 1052 12
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $164
+CNSTI4 0
+RETI4
+ADDRGP4 $163
+JUMPV
+LABELV $164
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $166
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $169
+CNSTI4 0
+RETI4
+ADDRGP4 $163
+JUMPV
+LABELV $169
+ADDRLP4 1040
+CNSTI4 1
+ASGNI4
+LABELV $166
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+EQI4 $171
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $173
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $163
+JUMPV
+LABELV $171
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $175
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $176
+JUMPV
+LABELV $175
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+12
+INDIRF4
+ASGNF4
+LABELV $176
+CNSTI4 1
+RETI4
+LABELV $163
+endproc PC_Float_Parse 1052 12
+export Color_Parse
+proc Color_Parse 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $180
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $184
+CNSTI4 0
+RETI4
+ADDRGP4 $179
+JUMPV
+LABELV $184
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $181
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $180
+CNSTI4 1
+RETI4
+LABELV $179
+endproc Color_Parse 12 8
+export PC_Color_Parse
+proc PC_Color_Parse 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $187
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $191
+CNSTI4 0
+RETI4
+ADDRGP4 $186
+JUMPV
+LABELV $191
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $188
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $187
+CNSTI4 1
+RETI4
+LABELV $186
+endproc PC_Color_Parse 12 8
+export Int_Parse
+proc Int_Parse 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $194
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $194
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $193
+JUMPV
+LABELV $194
+CNSTI4 0
+RETI4
+LABELV $193
+endproc Int_Parse 16 8
+export PC_Int_Parse
+proc PC_Int_Parse 1052 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $197
+CNSTI4 0
+RETI4
+ADDRGP4 $196
+JUMPV
+LABELV $197
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $199
+CNSTI4 0
+RETI4
+ADDRGP4 $196
+JUMPV
+LABELV $199
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $201
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $204
+CNSTI4 0
+RETI4
+ADDRGP4 $196
+JUMPV
+LABELV $204
+ADDRLP4 1040
+CNSTI4 1
+ASGNI4
+LABELV $201
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+EQI4 $206
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $208
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $196
+JUMPV
+LABELV $206
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+8
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $211
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $211
+CNSTI4 1
+RETI4
+LABELV $196
+endproc PC_Int_Parse 1052 12
+export Rect_Parse
+proc Rect_Parse 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $214
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $216
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $218
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $220
+CNSTI4 1
+RETI4
+ADDRGP4 $213
+JUMPV
+LABELV $220
+LABELV $218
+LABELV $216
+LABELV $214
+CNSTI4 0
+RETI4
+LABELV $213
+endproc Rect_Parse 16 8
+export PC_Rect_Parse
+proc PC_Rect_Parse 16 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $223
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $225
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $227
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $229
+CNSTI4 1
+RETI4
+ADDRGP4 $222
+JUMPV
+LABELV $229
+LABELV $227
+LABELV $225
+LABELV $223
+CNSTI4 0
+RETI4
+LABELV $222
+endproc PC_Rect_Parse 16 8
+export String_Parse
+proc String_Parse 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $232
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $232
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $231
+JUMPV
+LABELV $232
+CNSTI4 0
+RETI4
+LABELV $231
+endproc String_Parse 16 8
+export PC_String_Parse
+proc PC_String_Parse 1048 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1040
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $235
+CNSTI4 0
+RETI4
+ADDRGP4 $234
+JUMPV
+LABELV $235
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1044
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $234
+endproc PC_String_Parse 1048 8
+export PC_Script_Parse
+proc PC_Script_Parse 2084 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 2064
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 2064
+INDIRI4
+CNSTI4 0
+NEI4 $239
+CNSTI4 0
+RETI4
+ADDRGP4 $238
+JUMPV
+LABELV $239
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $244
+ARGP4
+ADDRLP4 2068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+EQI4 $246
+CNSTI4 0
+RETI4
+ADDRGP4 $238
+JUMPV
+LABELV $245
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 2072
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 2072
+INDIRI4
+CNSTI4 0
+NEI4 $248
+CNSTI4 0
+RETI4
+ADDRGP4 $238
+JUMPV
+LABELV $248
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 2076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2076
+INDIRI4
+CNSTI4 0
+NEI4 $250
+ADDRLP4 1040
+ARGP4
+ADDRLP4 2080
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 2080
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $238
+JUMPV
+LABELV $250
+ADDRLP4 0+16+1
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $254
+ADDRGP4 $258
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 2080
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2080
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $255
+JUMPV
+LABELV $254
+ADDRLP4 1040
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $255
+ADDRLP4 1040
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $261
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $246
+ADDRGP4 $245
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $238
+endproc PC_Script_Parse 2084 12
+export PC_CompiledScript_Parse
+proc PC_CompiledScript_Parse 4 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $263
+CNSTI4 0
+RETI4
+ADDRGP4 $262
+JUMPV
+LABELV $263
+ADDRFP4 4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 Script_Compile
+CALLP4
+pop
+CNSTI4 1
+RETI4
+LABELV $262
+endproc PC_CompiledScript_Parse 4 8
+export Init_Display
+proc Init_Display 0 0
+ADDRGP4 DC
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $265
+endproc Init_Display 0 0
+export GradientBar_Paint
+proc GradientBar_Paint 12 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 61916
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $266
+endproc GradientBar_Paint 12 20
+export Window_Init
+proc Window_Init 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 180
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $267
+endproc Window_Init 8 12
+export Fade
+proc Fade 8 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 96
+BANDI4
+CNSTI4 0
+EQI4 $269
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRFP4 12
+INDIRP4
+INDIRI4
+LEI4 $271
+ADDRFP4 12
+INDIRP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $273
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $274
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 0
+GTF4 $274
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -37
+BANDI4
+ASGNI4
+ADDRGP4 $274
+JUMPV
+LABELV $273
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+LTF4 $277
+ADDRFP4 4
+INDIRP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $279
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -65
+BANDI4
+ASGNI4
+LABELV $279
+LABELV $277
+LABELV $274
+LABELV $271
+LABELV $269
+LABELV $268
+endproc Fade 8 0
+lit
+align 4
+LABELV $282
+byte 4 0
+skip 12
+export Window_Paint
+code
+proc Window_Paint 64 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 $282
+INDIRB
+ASGNB 16
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $283
+ADDRGP4 $281
+JUMPV
+LABELV $283
+ADDRGP4 debugMode
+INDIRI4
+CNSTI4 0
+EQI4 $285
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16+12
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 16
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $285
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $290
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $290
+ADDRGP4 $281
+JUMPV
+LABELV $290
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $292
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+SUBF4
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 0+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+SUBF4
+ASGNF4
+LABELV $292
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $297
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $299
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $298
+JUMPV
+LABELV $299
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $298
+JUMPV
+LABELV $297
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $307
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ARGP4
+ADDRGP4 GradientBar_Paint
+CALLV
+pop
+ADDRGP4 $308
+JUMPV
+LABELV $307
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $309
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $311
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $311
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $310
+JUMPV
+LABELV $309
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $316
+ADDRGP4 DC
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $317
+ADDRLP4 16
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRLP4 16
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $317
+JUMPV
+LABELV $316
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $323
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $325
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 DC
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $330
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 -2
+ASGNI4
+LABELV $330
+LABELV $325
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $332
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 0+12
+INDIRF4
+ARGF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $332
+LABELV $323
+LABELV $317
+LABELV $310
+LABELV $308
+LABELV $298
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $337
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $339
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+LEF4 $341
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 44
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 $342
+JUMPV
+LABELV $341
+ADDRLP4 16+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 44
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 44
+INDIRF4
+ASGNF4
+LABELV $342
+ADDRLP4 16+12
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $338
+JUMPV
+LABELV $339
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $338
+JUMPV
+LABELV $337
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $348
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $350
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $352
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 44+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 GradientBar_Paint
+CALLV
+pop
+ADDRLP4 44+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 44
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 GradientBar_Paint
+CALLV
+pop
+LABELV $352
+LABELV $351
+LABELV $349
+LABELV $338
+LABELV $281
+endproc Window_Paint 64 28
+export Item_SetScreenCoords
+proc Item_SetScreenCoords 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $357
+ADDRGP4 $356
+JUMPV
+LABELV $357
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $359
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $359
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $356
+endproc Item_SetScreenCoords 16 0
+export Item_UpdatePosition
+proc Item_UpdatePosition 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+EQU4 $364
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+NEU4 $362
+LABELV $364
+ADDRGP4 $361
+JUMPV
+LABELV $362
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $365
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $365
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 Item_SetScreenCoords
+CALLV
+pop
+LABELV $361
+endproc Item_UpdatePosition 28 12
+export Menu_UpdatePosition
+proc Menu_UpdatePosition 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $368
+ADDRGP4 $367
+JUMPV
+LABELV $368
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $370
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $370
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $375
+JUMPV
+LABELV $372
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 Item_SetScreenCoords
+CALLV
+pop
+LABELV $373
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $375
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $372
+LABELV $367
+endproc Menu_UpdatePosition 20 12
+export Menu_PostParse
+proc Menu_PostParse 0 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $377
+ADDRGP4 $376
+JUMPV
+LABELV $377
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $379
+ADDRFP4 0
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1142947840
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1139802112
+ASGNF4
+LABELV $379
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_UpdatePosition
+CALLV
+pop
+LABELV $376
+endproc Menu_PostParse 0 4
+export Menu_ClearFocus
+proc Menu_ClearFocus 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $382
+CNSTP4 0
+RETP4
+ADDRGP4 $381
+JUMPV
+LABELV $382
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $387
+JUMPV
+LABELV $384
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $388
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $388
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 260
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDP4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $390
+ADDRLP4 20
+CNSTI4 260
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $390
+LABELV $385
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $387
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $384
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $381
+endproc Menu_ClearFocus 28 8
+export IsVisible
+proc IsVisible 12 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $394
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+BANDI4
+ADDRLP4 8
+INDIRI4
+NEI4 $394
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $395
+JUMPV
+LABELV $394
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $395
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $392
+endproc IsVisible 12 0
+export Rect_ContainsPoint
+proc Rect_ContainsPoint 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $397
+ADDRLP4 0
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $399
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $399
+ADDRLP4 12
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $399
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $399
+CNSTI4 1
+RETI4
+ADDRGP4 $396
+JUMPV
+LABELV $399
+LABELV $397
+CNSTI4 0
+RETI4
+LABELV $396
+endproc Rect_ContainsPoint 20 0
+export Menu_ItemsMatchingGroup
+proc Menu_ItemsMatchingGroup 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $405
+JUMPV
+LABELV $402
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $408
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $406
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $406
+LABELV $408
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $406
+LABELV $403
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $405
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $402
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $401
+endproc Menu_ItemsMatchingGroup 20 8
+export Menu_GetMatchingItemByNumber
+proc Menu_GetMatchingItemByNumber 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $413
+JUMPV
+LABELV $410
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $416
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $414
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $414
+LABELV $416
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $417
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $409
+JUMPV
+LABELV $417
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $414
+LABELV $411
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $413
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $410
+CNSTP4 0
+RETP4
+LABELV $409
+endproc Menu_GetMatchingItemByNumber 20 8
+export Script_SetColor
+proc Script_SetColor 36 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $420
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $424
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $422
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+CNSTI4 128
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 24
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 4194304
+BORI4
+ASGNI4
+ADDRGP4 $423
+JUMPV
+LABELV $422
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $427
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $425
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 28
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+ADDRGP4 $426
+JUMPV
+LABELV $425
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $430
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $428
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ASGNP4
+LABELV $428
+LABELV $426
+LABELV $423
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $431
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $433
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $437
+ADDRGP4 $419
+JUMPV
+LABELV $437
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $434
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $433
+LABELV $431
+LABELV $420
+LABELV $419
+endproc Script_SetColor 36 8
+export Script_SetAsset
+proc Script_SetAsset 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $440
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $442
+LABELV $442
+LABELV $440
+LABELV $439
+endproc Script_SetAsset 8 8
+export Script_SetBackground
+proc Script_SetBackground 12 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $445
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $445
+LABELV $444
+endproc Script_SetBackground 12 8
+export Menu_FindItemByName
+proc Menu_FindItemByName 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $450
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+NEU4 $448
+LABELV $450
+CNSTP4 0
+RETP4
+ADDRGP4 $447
+JUMPV
+LABELV $448
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $454
+JUMPV
+LABELV $451
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $455
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $447
+JUMPV
+LABELV $455
+LABELV $452
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $454
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $451
+CNSTP4 0
+RETP4
+LABELV $447
+endproc Menu_FindItemByName 12 8
+export Script_SetTeamColor
+proc Script_SetTeamColor 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $458
+ADDRLP4 4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $460
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $461
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $460
+LABELV $458
+LABELV $457
+endproc Script_SetTeamColor 24 4
+export Script_SetItemColor
+proc Script_SetItemColor 80 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 32
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $465
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 36
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $465
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 56
+ADDRGP4 Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $467
+ADDRGP4 $464
+JUMPV
+LABELV $467
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 $472
+JUMPV
+LABELV $469
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $473
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $424
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $475
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+CNSTI4 128
+ADDP4
+ASGNP4
+ADDRGP4 $476
+JUMPV
+LABELV $475
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $427
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+NEI4 $477
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 44
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+ADDRGP4 $478
+JUMPV
+LABELV $477
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $430
+ARGP4
+ADDRLP4 72
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $479
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+CNSTI4 144
+ADDP4
+ASGNP4
+LABELV $479
+LABELV $478
+LABELV $476
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $481
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $483
+ADDRLP4 76
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $484
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $483
+LABELV $481
+LABELV $473
+LABELV $470
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $472
+ADDRLP4 40
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $469
+LABELV $465
+LABELV $464
+endproc Script_SetItemColor 80 12
+export Menu_ShowItemByName
+proc Menu_ShowItemByName 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $491
+JUMPV
+LABELV $488
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $492
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $494
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $495
+JUMPV
+LABELV $494
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $496
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $496
+LABELV $495
+LABELV $492
+LABELV $489
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $491
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $488
+LABELV $487
+endproc Menu_ShowItemByName 24 12
+export Menu_FadeItemByName
+proc Menu_FadeItemByName 32 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $502
+JUMPV
+LABELV $499
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $503
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $505
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 36
+BORI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 -65
+BANDI4
+ASGNI4
+ADDRGP4 $506
+JUMPV
+LABELV $505
+ADDRLP4 20
+CNSTI4 68
+ASGNI4
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 -33
+BANDI4
+ASGNI4
+LABELV $506
+LABELV $503
+LABELV $500
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $502
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $499
+LABELV $498
+endproc Menu_FadeItemByName 32 12
+export Menus_FindByName
+proc Menus_FindByName 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $511
+JUMPV
+LABELV $508
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $512
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+RETP4
+ADDRGP4 $507
+JUMPV
+LABELV $512
+LABELV $509
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $511
+ADDRLP4 0
+INDIRI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104120
+ADDP4
+INDIRI4
+LTI4 $508
+CNSTP4 0
+RETP4
+LABELV $507
+endproc Menus_FindByName 8 8
+export Menus_ShowByName
+proc Menus_ShowByName 8 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $515
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menus_Activate
+CALLV
+pop
+LABELV $515
+LABELV $514
+endproc Menus_ShowByName 8 4
+export Menus_OpenByName
+proc Menus_OpenByName 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menus_ActivateByName
+CALLP4
+pop
+LABELV $517
+endproc Menus_OpenByName 0 4
+proc Menu_RunCloseScript 548 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $519
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $519
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $519
+ADDRLP4 8+228
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $519
+LABELV $518
+endproc Menu_RunCloseScript 548 8
+export Menus_CloseByName
+proc Menus_CloseByName 12 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $523
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_RunCloseScript
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -7
+BANDI4
+ASGNI4
+LABELV $523
+LABELV $522
+endproc Menus_CloseByName 12 4
+export Menus_CloseAll
+proc Menus_CloseAll 8 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $529
+JUMPV
+LABELV $526
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+ARGP4
+ADDRGP4 Menu_RunCloseScript
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -7
+BANDI4
+ASGNI4
+LABELV $527
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $529
+ADDRLP4 0
+INDIRI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104120
+ADDP4
+INDIRI4
+LTI4 $526
+LABELV $525
+endproc Menus_CloseAll 8 4
+export Script_Show
+proc Script_Show 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $531
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_ShowItemByName
+CALLV
+pop
+LABELV $531
+LABELV $530
+endproc Script_Show 8 12
+export Script_Hide
+proc Script_Hide 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $534
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_ShowItemByName
+CALLV
+pop
+LABELV $534
+LABELV $533
+endproc Script_Hide 8 12
+export Script_FadeIn
+proc Script_FadeIn 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $537
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_FadeItemByName
+CALLV
+pop
+LABELV $537
+LABELV $536
+endproc Script_FadeIn 8 12
+export Script_FadeOut
+proc Script_FadeOut 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $540
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_FadeItemByName
+CALLV
+pop
+LABELV $540
+LABELV $539
+endproc Script_FadeOut 8 12
+export Script_Open
+proc Script_Open 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $543
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+LABELV $543
+LABELV $542
+endproc Script_Open 8 8
+export Script_ConditionalOpen
+proc Script_ConditionalOpen 32 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $546
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 20
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $546
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $546
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+NEF4 $548
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+ADDRGP4 $549
+JUMPV
+LABELV $548
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Menus_OpenByName
+CALLV
+pop
+LABELV $549
+LABELV $546
+LABELV $545
+endproc Script_ConditionalOpen 32 8
+export Script_Close
+proc Script_Close 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $551
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menus_CloseByName
+CALLV
+pop
+LABELV $551
+LABELV $550
+endproc Script_Close 8 8
+export Menu_TransitionItemByName
+proc Menu_TransitionItemByName 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $557
+JUMPV
+LABELV $554
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $558
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 260
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ADDRFP4 20
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 32
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ADDRFP4 20
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 40
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ADDRFP4 20
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 12
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+CVFI4 4
+ARGI4
+ADDRLP4 48
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ADDRFP4 20
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_UpdatePosition
+CALLV
+pop
+LABELV $558
+LABELV $555
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $557
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $554
+LABELV $553
+endproc Menu_TransitionItemByName 52 12
+export Script_Transition
+proc Script_Transition 96 24
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $561
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Rect_Parse
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $563
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 52
+ADDRGP4 Rect_Parse
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $563
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 56
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $563
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 60
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $563
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRLP4 4
+INDIRB
+ASGNB 16
+ADDRLP4 64
+ARGP4
+ADDRLP4 80
+ADDRLP4 20
+INDIRB
+ASGNB 16
+ADDRLP4 80
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRGP4 Menu_TransitionItemByName
+CALLV
+pop
+LABELV $563
+LABELV $561
+LABELV $560
+endproc Script_Transition 96 24
+export Menu_OrbitItemByName
+proc Menu_OrbitItemByName 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_ItemsMatchingGroup
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $569
+JUMPV
+LABELV $566
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Menu_GetMatchingItemByNumber
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $570
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 65540
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_UpdatePosition
+CALLV
+pop
+LABELV $570
+LABELV $567
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $569
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $566
+LABELV $565
+endproc Menu_OrbitItemByName 24 12
+export Script_Orbit
+proc Script_Orbit 48 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $573
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 28
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $575
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 32
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $575
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $575
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+ADDRGP4 Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $575
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 44
+ADDRGP4 Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $575
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 Menu_OrbitItemByName
+CALLV
+pop
+LABELV $575
+LABELV $573
+LABELV $572
+endproc Script_Orbit 48 28
+export Script_SetFocus
+proc Script_SetFocus 36 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $578
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Menu_FindItemByName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $580
+ADDRLP4 20
+ADDRLP4 16
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 24
+INDIRI4
+NEI4 $580
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 24
+INDIRI4
+NEI4 $580
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Menu_ClearFocus
+CALLP4
+pop
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $582
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $582
+ADDRGP4 DC
+INDIRP4
+CNSTI4 61976
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $584
+ADDRLP4 32
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 61976
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $584
+LABELV $580
+LABELV $578
+LABELV $577
+endproc Script_SetFocus 36 8
+export Script_SetPlayerModel
+proc Script_SetPlayerModel 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $587
+ADDRGP4 $589
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $587
+LABELV $586
+endproc Script_SetPlayerModel 8 8
+export Script_SetPlayerHead
+proc Script_SetPlayerHead 8 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $591
+ADDRGP4 $593
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $591
+LABELV $590
+endproc Script_SetPlayerHead 8 8
+export Script_SetCvar
+proc Script_SetCvar 16 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $595
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $595
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $595
+LABELV $594
+endproc Script_SetCvar 16 8
+export Script_Exec
+proc Script_Exec 12 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $598
+ADDRGP4 $600
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $598
+LABELV $597
+endproc Script_Exec 12 8
+export Script_Play
+proc Script_Play 12 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $602
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $602
+LABELV $601
+endproc Script_Play 12 8
+export Script_playLooped
+proc Script_playLooped 16 16
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $605
+ADDRGP4 DC
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $605
+LABELV $604
+endproc Script_playLooped 16 16
+data
+export commandList
+align 4
+LABELV commandList
+address $607
+address Script_FadeIn
+address $608
+address Script_FadeOut
+address $609
+address Script_Show
+address $610
+address Script_Hide
+address $611
+address Script_SetColor
+address $612
+address Script_Open
+address $613
+address Script_ConditionalOpen
+address $614
+address Script_Close
+address $615
+address Script_SetAsset
+address $616
+address Script_SetBackground
+address $617
+address Script_SetItemColor
+address $618
+address Script_SetTeamColor
+address $619
+address Script_SetFocus
+address $620
+address Script_SetPlayerModel
+address $621
+address Script_SetPlayerHead
+address $622
+address Script_Transition
+address $623
+address Script_SetCvar
+address $624
+address Script_Exec
+address $625
+address Script_Play
+address $626
+address Script_playLooped
+address $627
+address Script_Orbit
+export scriptCommandCount
+align 4
+LABELV scriptCommandCount
+byte 4 21
+code
+proc Script_CompileOps 1080 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $630
+JUMPV
+LABELV $629
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1052
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $632
+ADDRGP4 $631
+JUMPV
+LABELV $632
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 59
+NEI4 $634
+ADDRLP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $634
+ADDRGP4 $630
+JUMPV
+LABELV $634
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $636
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $641
+JUMPV
+LABELV $638
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commandList
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $642
+ADDRLP4 1064
+CNSTI4 3
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 1064
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 1064
+INDIRI4
+LSHI4
+ADDRGP4 commandList+4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $640
+JUMPV
+LABELV $642
+LABELV $639
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $641
+ADDRLP4 8
+INDIRI4
+ADDRGP4 scriptCommandCount
+INDIRI4
+LTI4 $638
+LABELV $640
+LABELV $636
+ADDRLP4 1060
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 1060
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 1060
+INDIRP4
+ASGNP4
+ADDRGP4 $646
+JUMPV
+LABELV $645
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1064
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1064
+INDIRP4
+ASGNP4
+ADDRLP4 1072
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1076
+CNSTI4 0
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+EQI4 $650
+ADDRLP4 1072
+INDIRI4
+CNSTI4 59
+NEI4 $648
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 1076
+INDIRI4
+NEI4 $648
+LABELV $650
+ADDRGP4 $647
+JUMPV
+LABELV $648
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $646
+ADDRGP4 $645
+JUMPV
+LABELV $647
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $651
+ADDRLP4 28
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+CVIU4 4
+CNSTU4 1024
+GEU4 $654
+ADDRLP4 1064
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+CVIU4 4
+ASGNU4
+ADDRGP4 $655
+JUMPV
+LABELV $654
+ADDRLP4 1064
+CNSTU4 1024
+ASGNU4
+LABELV $655
+ADDRLP4 1064
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 1072
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 1072
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $656
+CNSTI4 -1
+RETI4
+ADDRGP4 $628
+JUMPV
+LABELV $656
+LABELV $651
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $658
+ADDRGP4 $631
+JUMPV
+LABELV $658
+LABELV $630
+ADDRGP4 $629
+JUMPV
+LABELV $631
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $628
+endproc Script_CompileOps 1080 12
+export Script_Compile
+proc Script_Compile 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRI4
+RSHU4
+CNSTU4 511
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LSHI4
+ADDRGP4 scriptHash
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $664
+JUMPV
+LABELV $661
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $665
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $668
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRGP4 $669
+JUMPV
+LABELV $668
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $669
+ADDRLP4 12
+INDIRP4
+RETP4
+ADDRGP4 $660
+JUMPV
+LABELV $665
+LABELV $662
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $664
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $661
+ADDRGP4 outOfMemory_ui_shared
+INDIRI4
+CNSTI4 0
+EQI4 $670
+CNSTP4 0
+RETP4
+ADDRGP4 $660
+JUMPV
+LABELV $670
+CNSTI4 16
+ARGI4
+ADDRLP4 12
+ADDRGP4 UI_Alloc_ui_shared
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $672
+CNSTP4 0
+RETP4
+ADDRGP4 $660
+JUMPV
+LABELV $672
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 16
+ADDRGP4 Script_CompileOps
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $674
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIU4 4
+CNSTI4 3
+LSHU4
+CVUI4 4
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_Alloc_ui_shared
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $678
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Script_CompileOps
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+GEI4 $676
+LABELV $678
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $676
+LABELV $674
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 scriptHash
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 scriptHash
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $680
+ADDRLP4 20
+CNSTP4 0
+ASGNP4
+ADDRGP4 $681
+JUMPV
+LABELV $680
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $681
+ADDRLP4 20
+INDIRP4
+RETP4
+LABELV $660
+endproc Script_Compile 36 8
+export Item_RunScript
+proc Item_RunScript 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $686
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRU4
+EQU4 $686
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $683
+LABELV $686
+ADDRGP4 $682
+JUMPV
+LABELV $683
+ADDRLP4 20
+ADDRGP4 scriptExecutions
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Script_Compile
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $687
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScriptText
+CALLV
+pop
+ADDRGP4 $682
+JUMPV
+LABELV $687
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $692
+JUMPV
+LABELV $689
+ADDRLP4 28
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRP4
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRP4
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $693
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $696
+JUMPV
+LABELV $693
+ADDRLP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $696
+JUMPV
+LABELV $695
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $696
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $698
+ADDRLP4 36
+INDIRI4
+CNSTI4 32
+LEI4 $695
+LABELV $698
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $699
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScriptText
+CALLV
+pop
+LABELV $699
+LABELV $690
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $692
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $689
+LABELV $682
+endproc Item_RunScript 40 8
+export Item_RunScriptText
+proc Item_RunScriptText 1064 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1036
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 1036
+INDIRU4
+EQU4 $702
+ADDRLP4 1040
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CVPU4 4
+ADDRLP4 1036
+INDIRU4
+EQU4 $702
+ADDRLP4 1040
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $702
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 12
+ASGNP4
+ADDRGP4 $705
+JUMPV
+LABELV $704
+ADDRLP4 8
+ARGP4
+ADDRLP4 1044
+ARGP4
+ADDRLP4 1048
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $707
+ADDRGP4 $701
+JUMPV
+LABELV $707
+ADDRLP4 1052
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 59
+NEI4 $709
+ADDRLP4 1052
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $709
+ADDRGP4 $705
+JUMPV
+LABELV $709
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRGP4 $714
+JUMPV
+LABELV $711
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commandList
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $715
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 commandList+4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $713
+JUMPV
+LABELV $715
+LABELV $712
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $714
+ADDRLP4 0
+INDIRI4
+ADDRGP4 scriptCommandCount
+INDIRI4
+LTI4 $711
+LABELV $713
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $718
+ADDRLP4 8
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $718
+LABELV $705
+ADDRGP4 $704
+JUMPV
+LABELV $702
+LABELV $701
+endproc Item_RunScriptText 1064 12
+export Item_EnableShowViaCvar
+proc Item_EnableShowViaCvar 2088 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1032
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 1032
+INDIRU4
+EQU4 $721
+ADDRLP4 1036
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+CVPU4 4
+ADDRLP4 1032
+INDIRU4
+EQU4 $721
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+ADDRLP4 1036
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 1040
+INDIRI4
+EQI4 $721
+ADDRLP4 1044
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+CVPU4 4
+ADDRLP4 1032
+INDIRU4
+EQU4 $721
+ADDRLP4 1044
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 1040
+INDIRI4
+EQI4 $721
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $724
+JUMPV
+LABELV $723
+ADDRLP4 0
+ARGP4
+ADDRLP4 2072
+ARGP4
+ADDRLP4 2076
+ADDRGP4 String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 2076
+INDIRI4
+CNSTI4 0
+NEI4 $726
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $729
+ADDRLP4 2080
+CNSTI4 0
+ASGNI4
+ADDRGP4 $730
+JUMPV
+LABELV $729
+ADDRLP4 2080
+CNSTI4 1
+ASGNI4
+LABELV $730
+ADDRLP4 2080
+INDIRI4
+RETI4
+ADDRGP4 $720
+JUMPV
+LABELV $726
+ADDRLP4 2080
+ADDRLP4 2072
+INDIRP4
+ASGNP4
+ADDRLP4 2080
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 59
+NEI4 $731
+ADDRLP4 2080
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $731
+ADDRGP4 $724
+JUMPV
+LABELV $731
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $733
+ADDRLP4 1048
+ARGP4
+ADDRLP4 2072
+INDIRP4
+ARGP4
+ADDRLP4 2084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2084
+INDIRI4
+CNSTI4 0
+NEI4 $734
+CNSTI4 1
+RETI4
+ADDRGP4 $720
+JUMPV
+LABELV $733
+ADDRLP4 1048
+ARGP4
+ADDRLP4 2072
+INDIRP4
+ARGP4
+ADDRLP4 2084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2084
+INDIRI4
+CNSTI4 0
+NEI4 $737
+CNSTI4 0
+RETI4
+ADDRGP4 $720
+JUMPV
+LABELV $737
+LABELV $734
+LABELV $724
+ADDRGP4 $723
+JUMPV
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $740
+ADDRLP4 2072
+CNSTI4 0
+ASGNI4
+ADDRGP4 $741
+JUMPV
+LABELV $740
+ADDRLP4 2072
+CNSTI4 1
+ASGNI4
+LABELV $741
+ADDRLP4 2072
+INDIRI4
+RETI4
+ADDRGP4 $720
+JUMPV
+LABELV $721
+CNSTI4 1
+RETI4
+LABELV $720
+endproc Item_EnableShowViaCvar 2088 12
+export Item_SetFocus
+proc Item_SetFocus 80 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 61976
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $747
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 28
+INDIRI4
+NEI4 $747
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 28
+INDIRI4
+NEI4 $747
+ADDRLP4 24
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 28
+INDIRI4
+NEI4 $743
+LABELV $747
+CNSTI4 0
+RETI4
+ADDRGP4 $742
+JUMPV
+LABELV $743
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $748
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 36
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $748
+CNSTI4 0
+RETI4
+ADDRGP4 $742
+JUMPV
+LABELV $748
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 12
+BANDI4
+CNSTI4 0
+EQI4 $750
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 44
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $750
+CNSTI4 0
+RETI4
+ADDRGP4 $742
+JUMPV
+LABELV $750
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Menu_ClearFocus
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $752
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRB
+ASGNB 16
+ADDRLP4 52+4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 52+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $756
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $758
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+ASGNP4
+LABELV $758
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $753
+JUMPV
+LABELV $756
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $753
+ADDRLP4 72
+ADDRLP4 16
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $753
+ADDRLP4 76
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRGP4 $753
+JUMPV
+LABELV $752
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $764
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $764
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $766
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+ASGNP4
+LABELV $766
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+LABELV $753
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $768
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $768
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $768
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $773
+JUMPV
+LABELV $770
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $774
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $772
+JUMPV
+LABELV $774
+LABELV $771
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $773
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $770
+LABELV $772
+CNSTI4 1
+RETI4
+LABELV $742
+endproc Item_SetFocus 80 12
+export Item_ListBox_MaxScroll
+proc Item_ListBox_MaxScroll 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $777
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+DIVF4
+SUBF4
+CNSTF4 1065353216
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $778
+JUMPV
+LABELV $777
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+DIVF4
+SUBF4
+CNSTF4 1065353216
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $778
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $779
+CNSTI4 0
+RETI4
+ADDRGP4 $776
+JUMPV
+LABELV $779
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $776
+endproc Item_ListBox_MaxScroll 16 4
+export Item_ListBox_ThumbPosition
+proc Item_ListBox_ThumbPosition 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Item_ListBox_MaxScroll
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $782
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+LEF4 $784
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $785
+JUMPV
+LABELV $784
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $785
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+CNSTF4 1098907648
+ADDF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+CVFI4 4
+RETI4
+ADDRGP4 $781
+JUMPV
+LABELV $782
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+LEF4 $786
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 $787
+JUMPV
+LABELV $786
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $787
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+CNSTF4 1098907648
+ADDF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+CVFI4 4
+RETI4
+LABELV $781
+endproc Item_ListBox_ThumbPosition 20 4
+export Item_ListBox_ThumbDrawPosition
+proc Item_ListBox_ThumbDrawPosition 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 itemCapture
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $789
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $791
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1107296256
+SUBF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+ADDF4
+LTF4 $793
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+ADDF4
+GTF4 $793
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1090519040
+SUBF4
+CVFI4 4
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $793
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $791
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1107296256
+SUBF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+ADDF4
+LTF4 $795
+ADDRLP4 20
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+ADDF4
+GTF4 $795
+ADDRGP4 DC
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1090519040
+SUBF4
+CVFI4 4
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $795
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+ADDRGP4 $788
+JUMPV
+LABELV $789
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $788
+endproc Item_ListBox_ThumbDrawPosition 32 4
+export Item_Slider_ThumbPosition
+proc Item_Slider_ThumbPosition 28 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $798
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRGP4 $799
+JUMPV
+LABELV $798
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $799
+ADDRLP4 16
+CNSTU4 0
+ASGNU4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+EQU4 $802
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+NEU4 $800
+LABELV $802
+ADDRLP4 8
+INDIRF4
+RETF4
+ADDRGP4 $797
+JUMPV
+LABELV $800
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+GEF4 $803
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 $804
+JUMPV
+LABELV $803
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+LEF4 $805
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $805
+LABELV $804
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1119879168
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+RETF4
+LABELV $797
+endproc Item_Slider_ThumbPosition 28 4
+export Item_Slider_OverSlider
+proc Item_Slider_OverSlider 24 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Item_Slider_ThumbPosition
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1094713344
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $811
+CNSTI4 8192
+RETI4
+ADDRGP4 $807
+JUMPV
+LABELV $811
+CNSTI4 0
+RETI4
+LABELV $807
+endproc Item_Slider_OverSlider 24 12
+export Item_ListBox_OverLB
+proc Item_ListBox_OverLB 64 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $814
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $819
+CNSTI4 2048
+RETI4
+ADDRGP4 $813
+JUMPV
+LABELV $819
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $821
+CNSTI4 4096
+RETI4
+ADDRGP4 $813
+JUMPV
+LABELV $821
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $823
+CNSTI4 8192
+RETI4
+ADDRGP4 $813
+JUMPV
+LABELV $823
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $826
+CNSTI4 16384
+RETI4
+ADDRGP4 $813
+JUMPV
+LABELV $826
+ADDRLP4 52
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $815
+CNSTI4 32768
+RETI4
+ADDRGP4 $813
+JUMPV
+LABELV $814
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $834
+CNSTI4 2048
+RETI4
+ADDRGP4 $813
+JUMPV
+LABELV $834
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $837
+CNSTI4 4096
+RETI4
+ADDRGP4 $813
+JUMPV
+LABELV $837
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Item_ListBox_ThumbPosition
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $840
+CNSTI4 8192
+RETI4
+ADDRGP4 $813
+JUMPV
+LABELV $840
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $845
+CNSTI4 16384
+RETI4
+ADDRGP4 $813
+JUMPV
+LABELV $845
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $849
+CNSTI4 32768
+RETI4
+ADDRGP4 $813
+JUMPV
+LABELV $849
+LABELV $815
+CNSTI4 0
+RETI4
+LABELV $813
+endproc Item_ListBox_OverLB 64 12
+export Item_ListBox_MouseEnter
+proc Item_ListBox_MouseEnter 60 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 -63489
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Item_ListBox_OverLB
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $852
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 63488
+BANDI4
+CNSTI4 0
+NEI4 $853
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $853
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 8
+ASGNI4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $853
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $853
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $853
+JUMPV
+LABELV $852
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 63488
+BANDI4
+CNSTI4 0
+NEI4 $865
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 4+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $870
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ADDRLP4 44
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LEI4 $873
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $873
+LABELV $870
+LABELV $865
+LABELV $853
+LABELV $851
+endproc Item_ListBox_MouseEnter 60 12
+export Item_MouseEnter
+proc Item_MouseEnter 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $876
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRB
+ASGNB 16
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $880
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $880
+ADDRGP4 $875
+JUMPV
+LABELV $880
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 12
+BANDI4
+CNSTI4 0
+EQI4 $882
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 28
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $882
+ADDRGP4 $875
+JUMPV
+LABELV $882
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $884
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+NEI4 $886
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+LABELV $886
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $885
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $885
+JUMPV
+LABELV $884
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $890
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+LABELV $890
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $892
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $892
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $894
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRGP4 Item_ListBox_MouseEnter
+CALLV
+pop
+LABELV $894
+LABELV $885
+LABELV $876
+LABELV $875
+endproc Item_MouseEnter 44 12
+export Item_MouseLeave
+proc Item_MouseLeave 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $897
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $899
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+LABELV $899
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -6145
+BANDI4
+ASGNI4
+LABELV $897
+LABELV $896
+endproc Item_MouseLeave 8 8
+export Menu_HitTest
+proc Menu_HitTest 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $905
+JUMPV
+LABELV $902
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $906
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $901
+JUMPV
+LABELV $906
+LABELV $903
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $905
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $902
+CNSTP4 0
+RETP4
+LABELV $901
+endproc Menu_HitTest 8 12
+export Item_SetMouseOver
+proc Item_SetMouseOver 4 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $909
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $911
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $912
+JUMPV
+LABELV $911
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+LABELV $912
+LABELV $909
+LABELV $908
+endproc Item_SetMouseOver 4 0
+export Item_OwnerDraw_HandleKey
+proc Item_OwnerDraw_HandleKey 12 16
+ADDRLP4 0
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRU4
+EQU4 $914
+ADDRGP4 DC
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRU4
+EQU4 $914
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 528
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $913
+JUMPV
+LABELV $914
+CNSTI4 0
+RETI4
+LABELV $913
+endproc Item_OwnerDraw_HandleKey 12 16
+export Item_ListBox_SetSelection
+proc Item_ListBox_SetSelection 40 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Item_ListBox_MaxScroll
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $917
+ADDRFP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $918
+JUMPV
+LABELV $917
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $919
+ADDRFP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $919
+LABELV $918
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $921
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $922
+JUMPV
+LABELV $921
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+LABELV $922
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $923
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $923
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+LTI4 $925
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $925
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $927
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $927
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $929
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $929
+LABELV $916
+endproc Item_ListBox_SetSelection 40 4
+export Item_ListBox_HandleKey
+proc Item_ListBox_HandleKey 72 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $934
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $932
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 28
+INDIRI4
+EQI4 $932
+LABELV $934
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Item_ListBox_MaxScroll
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $935
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 133
+EQI4 $939
+ADDRFP4 4
+INDIRI4
+CNSTI4 169
+NEI4 $937
+LABELV $939
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $940
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $942
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $942
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $944
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $944
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $946
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $946
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $941
+JUMPV
+LABELV $940
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $948
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $948
+LABELV $941
+CNSTI4 1
+RETI4
+ADDRGP4 $931
+JUMPV
+LABELV $937
+ADDRFP4 4
+INDIRI4
+CNSTI4 134
+EQI4 $952
+ADDRFP4 4
+INDIRI4
+CNSTI4 171
+NEI4 $936
+LABELV $952
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $953
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $955
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $955
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $957
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $957
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $959
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $959
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $954
+JUMPV
+LABELV $953
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $961
+ADDRLP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $961
+LABELV $954
+CNSTI4 1
+RETI4
+ADDRGP4 $931
+JUMPV
+LABELV $935
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 131
+EQI4 $965
+ADDRFP4 4
+INDIRI4
+CNSTI4 167
+NEI4 $963
+LABELV $965
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $966
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $968
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $968
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $970
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $970
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $972
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $972
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $967
+JUMPV
+LABELV $966
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $974
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $974
+LABELV $967
+CNSTI4 1
+RETI4
+ADDRGP4 $931
+JUMPV
+LABELV $963
+ADDRFP4 4
+INDIRI4
+CNSTI4 132
+EQI4 $978
+ADDRFP4 4
+INDIRI4
+CNSTI4 173
+NEI4 $976
+LABELV $978
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $979
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $981
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $981
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $983
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $983
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $985
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $985
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $980
+JUMPV
+LABELV $979
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $987
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $987
+LABELV $980
+CNSTI4 1
+RETI4
+ADDRGP4 $931
+JUMPV
+LABELV $976
+LABELV $936
+ADDRFP4 4
+INDIRI4
+CNSTI4 189
+NEI4 $989
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+GEI4 $992
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRGP4 $993
+JUMPV
+LABELV $992
+ADDRLP4 40
+CNSTI4 3
+ASGNI4
+LABELV $993
+ADDRLP4 36
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $994
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $994
+CNSTI4 1
+RETI4
+ADDRGP4 $931
+JUMPV
+LABELV $989
+ADDRFP4 4
+INDIRI4
+CNSTI4 190
+NEI4 $996
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+GEI4 $999
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1000
+JUMPV
+LABELV $999
+ADDRLP4 40
+CNSTI4 3
+ASGNI4
+LABELV $1000
+ADDRLP4 36
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $1001
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $1001
+CNSTI4 1
+RETI4
+ADDRGP4 $931
+JUMPV
+LABELV $996
+ADDRFP4 4
+INDIRI4
+CNSTI4 184
+EQI4 $1005
+ADDRFP4 4
+INDIRI4
+CNSTI4 185
+NEI4 $1003
+LABELV $1005
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $1006
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $1007
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1007
+JUMPV
+LABELV $1006
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1010
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $1011
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $1011
+JUMPV
+LABELV $1010
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $1014
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $1015
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1015
+JUMPV
+LABELV $1014
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $1018
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $1019
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $1019
+JUMPV
+LABELV $1018
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1022
+ADDRGP4 $1023
+JUMPV
+LABELV $1022
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRGP4 lastListBoxClickTime
+INDIRI4
+GEI4 $1024
+ADDRLP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1024
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $1024
+ADDRGP4 lastListBoxClickTime
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 300
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+EQI4 $1026
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1026
+LABELV $1023
+LABELV $1019
+LABELV $1015
+LABELV $1011
+LABELV $1007
+CNSTI4 1
+RETI4
+ADDRGP4 $931
+JUMPV
+LABELV $1003
+ADDRFP4 4
+INDIRI4
+CNSTI4 149
+EQI4 $1030
+ADDRFP4 4
+INDIRI4
+CNSTI4 166
+NEI4 $1028
+LABELV $1030
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $931
+JUMPV
+LABELV $1028
+ADDRFP4 4
+INDIRI4
+CNSTI4 150
+EQI4 $1033
+ADDRFP4 4
+INDIRI4
+CNSTI4 172
+NEI4 $1031
+LABELV $1033
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $931
+JUMPV
+LABELV $1031
+ADDRFP4 4
+INDIRI4
+CNSTI4 148
+EQI4 $1036
+ADDRFP4 4
+INDIRI4
+CNSTI4 168
+NEI4 $1034
+LABELV $1036
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1037
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1039
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1039
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $1041
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1041
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $1043
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1043
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1038
+JUMPV
+LABELV $1037
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $1045
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1045
+LABELV $1038
+CNSTI4 1
+RETI4
+ADDRGP4 $931
+JUMPV
+LABELV $1034
+ADDRFP4 4
+INDIRI4
+CNSTI4 147
+EQI4 $1049
+ADDRFP4 4
+INDIRI4
+CNSTI4 174
+NEI4 $1047
+LABELV $1049
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1050
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+GEI4 $1052
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1052
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $1054
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1054
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+LTI4 $1056
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1056
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1051
+JUMPV
+LABELV $1050
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $1058
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $1058
+LABELV $1051
+CNSTI4 1
+RETI4
+ADDRGP4 $931
+JUMPV
+LABELV $1047
+LABELV $932
+CNSTI4 0
+RETI4
+LABELV $931
+endproc Item_ListBox_HandleKey 72 12
+export Item_YesNo_HandleKey
+proc Item_YesNo_HandleKey 24 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1061
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 184
+EQI4 $1066
+ADDRLP4 4
+INDIRI4
+CNSTI4 185
+EQI4 $1066
+ADDRLP4 4
+INDIRI4
+CNSTI4 186
+NEI4 $1063
+LABELV $1066
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $1064
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 16
+INDIRI4
+EQI4 $1064
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1064
+JUMPV
+LABELV $1063
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1069
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1069
+LABELV $1064
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1071
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+NEF4 $1075
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1076
+JUMPV
+LABELV $1075
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $1076
+ADDRGP4 $1073
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1060
+JUMPV
+LABELV $1071
+LABELV $1061
+CNSTI4 0
+RETI4
+LABELV $1060
+endproc Item_YesNo_HandleKey 24 12
+export Item_Multi_CountSettings
+proc Item_Multi_CountSettings 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1078
+CNSTI4 0
+RETI4
+ADDRGP4 $1077
+JUMPV
+LABELV $1078
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+RETI4
+LABELV $1077
+endproc Item_Multi_CountSettings 4 0
+export Item_Multi_FindCvarByValue
+proc Item_Multi_FindCvarByValue 1040 12
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1081
+ADDRLP4 4
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1083
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1084
+JUMPV
+LABELV $1083
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 1036
+INDIRF4
+ASGNF4
+LABELV $1084
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1088
+JUMPV
+LABELV $1085
+ADDRLP4 4
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1089
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $1090
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1080
+JUMPV
+LABELV $1089
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEF4 $1093
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1080
+JUMPV
+LABELV $1093
+LABELV $1090
+LABELV $1086
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1088
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+LTI4 $1085
+LABELV $1081
+CNSTI4 0
+RETI4
+LABELV $1080
+endproc Item_Multi_FindCvarByValue 1040 12
+export Item_Multi_Setting
+proc Item_Multi_Setting 1040 12
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1096
+ADDRLP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1098
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1099
+JUMPV
+LABELV $1098
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 1036
+INDIRF4
+ASGNF4
+LABELV $1099
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1103
+JUMPV
+LABELV $1100
+ADDRLP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1104
+ADDRLP4 12
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $1105
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1095
+JUMPV
+LABELV $1104
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEF4 $1108
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1095
+JUMPV
+LABELV $1108
+LABELV $1105
+LABELV $1101
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1103
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+LTI4 $1100
+LABELV $1096
+ADDRGP4 $119
+RETP4
+LABELV $1095
+endproc Item_Multi_Setting 1040 12
+export Item_Multi_HandleKey
+proc Item_Multi_HandleKey 76 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1111
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1113
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 184
+EQI4 $1118
+ADDRLP4 8
+INDIRI4
+CNSTI4 185
+EQI4 $1118
+ADDRLP4 8
+INDIRI4
+CNSTI4 186
+NEI4 $1115
+LABELV $1118
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $1116
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 20
+INDIRI4
+EQI4 $1116
+ADDRFP4 4
+INDIRI4
+CNSTI4 185
+NEI4 $1122
+ADDRLP4 24
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $1123
+JUMPV
+LABELV $1122
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+LABELV $1123
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $1116
+JUMPV
+LABELV $1115
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $1116
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1124
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Item_Multi_FindCvarByValue
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Item_Multi_CountSettings
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $1126
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1127
+JUMPV
+LABELV $1126
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $1128
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $1128
+LABELV $1127
+ADDRLP4 0
+INDIRP4
+CNSTI4 392
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1130
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3212836864
+EQF4 $1132
+ADDRGP4 $1073
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1134
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1133
+JUMPV
+LABELV $1132
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 52
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 52
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 56
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+ADDRLP4 56
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+CNSTU4 8
+GEU4 $1136
+ADDRLP4 48
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ASGNU4
+ADDRGP4 $1137
+JUMPV
+LABELV $1136
+ADDRLP4 48
+CNSTU4 8
+ASGNU4
+LABELV $1137
+ADDRLP4 48
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 32
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $1134
+ARGP4
+ADDRGP4 $1138
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1073
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1139
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1073
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $1140
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1133
+LABELV $1130
+ADDRLP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1141
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1142
+JUMPV
+LABELV $1141
+ADDRLP4 28
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIF4 4
+ADDRLP4 32
+INDIRF4
+NEF4 $1143
+ADDRGP4 $1073
+ARGP4
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1144
+JUMPV
+LABELV $1143
+ADDRGP4 $1145
+ARGP4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1144
+LABELV $1142
+CNSTI4 1
+RETI4
+ADDRGP4 $1110
+JUMPV
+LABELV $1124
+LABELV $1113
+LABELV $1111
+CNSTI4 0
+RETI4
+LABELV $1110
+endproc Item_Multi_HandleKey 76 12
+export Item_TextField_HandleKey
+proc Item_TextField_HandleKey 1076 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1147
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1024
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLU4
+ASGNU4
+ADDRLP4 1032
+ADDRLP4 1036
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $1149
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1040
+INDIRI4
+LEI4 $1149
+ADDRLP4 1032
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1149
+ADDRFP4 4
+INDIRI4
+CNSTI4 2147483648
+BANDI4
+CNSTI4 0
+EQI4 $1151
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2147483647
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 8
+NEI4 $1153
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1155
+ADDRLP4 1044
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 4-1
+ADDP4
+ARGP4
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 1044
+INDIRI4
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRLP4 1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1048
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+GEI4 $1158
+ADDRLP4 1052
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ADDRLP4 1052
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1158
+LABELV $1155
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1146
+JUMPV
+LABELV $1153
+ADDRFP4 4
+INDIRI4
+CNSTI4 32
+LTI4 $1162
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1160
+LABELV $1162
+CNSTI4 1
+RETI4
+ADDRGP4 $1146
+JUMPV
+LABELV $1160
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $1163
+ADDRFP4 4
+INDIRI4
+CNSTI4 48
+LTI4 $1167
+ADDRFP4 4
+INDIRI4
+CNSTI4 57
+LEI4 $1165
+LABELV $1167
+CNSTI4 0
+RETI4
+ADDRGP4 $1146
+JUMPV
+LABELV $1165
+LABELV $1163
+ADDRLP4 1044
+ADDRGP4 DC
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $1168
+ADDRLP4 1048
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 255
+EQI4 $1172
+ADDRLP4 1052
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $1170
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+LTI4 $1170
+LABELV $1172
+CNSTI4 1
+RETI4
+ADDRGP4 $1146
+JUMPV
+LABELV $1170
+ADDRLP4 1056
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 4+1
+ADDP4
+ARGP4
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRLP4 1056
+INDIRI4
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $1169
+JUMPV
+LABELV $1168
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+EQI4 $1174
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+LTI4 $1174
+CNSTI4 1
+RETI4
+ADDRGP4 $1146
+JUMPV
+LABELV $1174
+LABELV $1169
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRFP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+ADDI4
+GEI4 $1152
+ADDRLP4 1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1048
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $1152
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+LEI4 $1152
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ADDRLP4 1056
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1152
+JUMPV
+LABELV $1151
+ADDRFP4 4
+INDIRI4
+CNSTI4 146
+EQI4 $1182
+ADDRFP4 4
+INDIRI4
+CNSTI4 177
+NEI4 $1180
+LABELV $1182
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+GEI4 $1183
+ADDRLP4 1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 4
+ADDP4
+ARGP4
+ADDRLP4 1048
+INDIRI4
+ADDRLP4 4+1
+ADDP4
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+SUBI4
+CVIU4 4
+ARGU4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1183
+CNSTI4 1
+RETI4
+ADDRGP4 $1146
+JUMPV
+LABELV $1180
+ADDRFP4 4
+INDIRI4
+CNSTI4 134
+EQI4 $1188
+ADDRFP4 4
+INDIRI4
+CNSTI4 171
+NEI4 $1186
+LABELV $1188
+ADDRLP4 1052
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $1189
+ADDRLP4 1056
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+LTI4 $1189
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+GEI4 $1189
+ADDRLP4 1060
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ADDRLP4 1060
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ADDRLP4 1064
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1146
+JUMPV
+LABELV $1189
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+GEI4 $1191
+ADDRLP4 1060
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ADDRLP4 1060
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1191
+CNSTI4 1
+RETI4
+ADDRGP4 $1146
+JUMPV
+LABELV $1186
+ADDRFP4 4
+INDIRI4
+CNSTI4 133
+EQI4 $1195
+ADDRFP4 4
+INDIRI4
+CNSTI4 169
+NEI4 $1193
+LABELV $1195
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1196
+ADDRLP4 1056
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ADDRLP4 1056
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1196
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+GEI4 $1198
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ADDRLP4 1056
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1198
+CNSTI4 1
+RETI4
+ADDRGP4 $1146
+JUMPV
+LABELV $1193
+ADDRFP4 4
+INDIRI4
+CNSTI4 149
+EQI4 $1202
+ADDRFP4 4
+INDIRI4
+CNSTI4 166
+NEI4 $1200
+LABELV $1202
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1146
+JUMPV
+LABELV $1200
+ADDRFP4 4
+INDIRI4
+CNSTI4 150
+EQI4 $1205
+ADDRFP4 4
+INDIRI4
+CNSTI4 172
+NEI4 $1203
+LABELV $1205
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+LEI4 $1206
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 1032
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $1206
+CNSTI4 1
+RETI4
+ADDRGP4 $1146
+JUMPV
+LABELV $1203
+ADDRFP4 4
+INDIRI4
+CNSTI4 145
+EQI4 $1210
+ADDRFP4 4
+INDIRI4
+CNSTI4 176
+NEI4 $1208
+LABELV $1210
+ADDRLP4 1072
+ADDRGP4 DC
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $1212
+ADDRLP4 1068
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1213
+JUMPV
+LABELV $1212
+ADDRLP4 1068
+CNSTI4 0
+ASGNI4
+LABELV $1213
+ADDRLP4 1068
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1146
+JUMPV
+LABELV $1208
+LABELV $1152
+ADDRFP4 4
+INDIRI4
+CNSTI4 9
+EQI4 $1217
+ADDRFP4 4
+INDIRI4
+CNSTI4 132
+EQI4 $1217
+ADDRFP4 4
+INDIRI4
+CNSTI4 173
+NEI4 $1214
+LABELV $1217
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Menu_SetNextCursorItem
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1218
+ADDRLP4 1056
+ADDRLP4 1028
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 4
+EQI4 $1220
+ADDRLP4 1056
+INDIRI4
+CNSTI4 9
+NEI4 $1218
+LABELV $1220
+ADDRGP4 g_editItem
+ADDRLP4 1028
+INDIRP4
+ASGNP4
+LABELV $1218
+LABELV $1214
+ADDRFP4 4
+INDIRI4
+CNSTI4 131
+EQI4 $1223
+ADDRFP4 4
+INDIRI4
+CNSTI4 167
+NEI4 $1221
+LABELV $1223
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Menu_SetPrevCursorItem
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1224
+ADDRLP4 1060
+ADDRLP4 1028
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 4
+EQI4 $1226
+ADDRLP4 1060
+INDIRI4
+CNSTI4 9
+NEI4 $1224
+LABELV $1226
+ADDRGP4 g_editItem
+ADDRLP4 1028
+INDIRP4
+ASGNP4
+LABELV $1224
+LABELV $1221
+ADDRFP4 4
+INDIRI4
+CNSTI4 13
+EQI4 $1230
+ADDRFP4 4
+INDIRI4
+CNSTI4 175
+EQI4 $1230
+ADDRFP4 4
+INDIRI4
+CNSTI4 27
+NEI4 $1227
+LABELV $1230
+CNSTI4 0
+RETI4
+ADDRGP4 $1146
+JUMPV
+LABELV $1227
+CNSTI4 1
+RETI4
+ADDRGP4 $1146
+JUMPV
+LABELV $1147
+CNSTI4 0
+RETI4
+LABELV $1146
+endproc Item_TextField_HandleKey 1076 12
+proc Scroll_ListBox_AutoFunc 12 16
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+LEI4 $1232
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Item_ListBox_HandleKey
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1232
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LEI4 $1234
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 150
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 20
+LEI4 $1236
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 40
+SUBI4
+ASGNI4
+LABELV $1236
+LABELV $1234
+LABELV $1231
+endproc Scroll_ListBox_AutoFunc 12 16
+proc Scroll_ListBox_ThumbFunc 52 16
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1239
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+NEF4 $1241
+ADDRGP4 $1238
+JUMPV
+LABELV $1241
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 36
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 40
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 32
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4+4
+ADDRLP4 44
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Item_ListBox_MaxScroll
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+SUBF4
+CNSTF4 1090519040
+SUBF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GEI4 $1247
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1248
+JUMPV
+LABELV $1247
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $1249
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $1249
+LABELV $1248
+ADDRLP4 28
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1240
+JUMPV
+LABELV $1239
+ADDRGP4 DC
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+EQF4 $1251
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 32
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 44
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 32
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDF4
+ADDRLP4 44
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Item_ListBox_MaxScroll
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+CNSTF4 1090519040
+SUBF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 4+12
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GEI4 $1258
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1259
+JUMPV
+LABELV $1258
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $1260
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $1260
+LABELV $1259
+ADDRLP4 28
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1251
+LABELV $1240
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+LEI4 $1262
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Item_ListBox_HandleKey
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1262
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LEI4 $1264
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 150
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 20
+LEI4 $1266
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 40
+SUBI4
+ASGNI4
+LABELV $1266
+LABELV $1264
+LABELV $1238
+endproc Scroll_ListBox_ThumbFunc 52 16
+proc Scroll_Slider_ThumbFunc 28 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1269
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRGP4 $1270
+JUMPV
+LABELV $1269
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $1270
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $1271
+ADDRLP4 12
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $1272
+JUMPV
+LABELV $1271
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1119879168
+ADDF4
+LEF4 $1273
+ADDRLP4 12
+ADDRLP4 8
+INDIRF4
+CNSTF4 1119879168
+ADDF4
+ASGNF4
+LABELV $1273
+LABELV $1272
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1119879168
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1145
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1268
+endproc Scroll_Slider_ThumbFunc 28 8
+export Item_StartCapture
+proc Item_StartCapture 28 12
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $1276
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+GTI4 $1276
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1303-16
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1303
+address $1279
+address $1276
+address $1279
+address $1276
+address $1276
+address $1279
+address $1296
+code
+LABELV $1279
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+ADDRGP4 Item_ListBox_OverLB
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6144
+BANDI4
+CNSTI4 0
+EQI4 $1280
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+ASGNP4
+ADDRGP4 scrollInfo
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+ADDRGP4 scrollInfo+4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 150
+ADDI4
+ASGNI4
+ADDRGP4 scrollInfo+8
+CNSTI4 500
+ASGNI4
+ADDRGP4 scrollInfo+12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $1287
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1288
+JUMPV
+LABELV $1287
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $1288
+ADDRGP4 scrollInfo+28
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 scrollInfo+24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 captureData
+ADDRGP4 scrollInfo
+ASGNP4
+ADDRGP4 captureFunc
+ADDRGP4 Scroll_ListBox_AutoFunc
+ASGNP4
+ADDRGP4 itemCapture
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1277
+JUMPV
+LABELV $1280
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1277
+ADDRGP4 scrollInfo+12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 scrollInfo+24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 scrollInfo+16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 scrollInfo+20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 captureData
+ADDRGP4 scrollInfo
+ASGNP4
+ADDRGP4 captureFunc
+ADDRGP4 Scroll_ListBox_ThumbFunc
+ASGNP4
+ADDRGP4 itemCapture
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1277
+JUMPV
+LABELV $1296
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+ADDRGP4 Item_Slider_OverSlider
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1277
+ADDRGP4 scrollInfo+12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 scrollInfo+24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 scrollInfo+16
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 scrollInfo+20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 captureData
+ADDRGP4 scrollInfo
+ASGNP4
+ADDRGP4 captureFunc
+ADDRGP4 Scroll_Slider_ThumbFunc
+ASGNP4
+ADDRGP4 itemCapture
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $1276
+LABELV $1277
+LABELV $1275
+endproc Item_StartCapture 28 12
+export Item_StopCapture
+proc Item_StopCapture 0 0
+LABELV $1305
+endproc Item_StopCapture 0 0
+export Item_Slider_HandleKey
+proc Item_Slider_HandleKey 68 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1307
+ADDRLP4 16
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 184
+EQI4 $1312
+ADDRLP4 16
+INDIRI4
+CNSTI4 185
+EQI4 $1312
+ADDRLP4 16
+INDIRI4
+CNSTI4 186
+NEI4 $1309
+LABELV $1312
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1310
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $1310
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 32
+INDIRI4
+EQI4 $1310
+ADDRLP4 8
+CNSTF4 1119879168
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1315
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 52
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRGP4 $1316
+JUMPV
+LABELV $1315
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $1316
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 16
+ADDRLP4 36
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1086324736
+ASGNF4
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36+8
+CNSTF4 1120665600
+ASGNF4
+ADDRLP4 36
+ARGP4
+ADDRLP4 52
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 52
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 56
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $1310
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 60
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1145
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1306
+JUMPV
+LABELV $1309
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_SelectForKey
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1320
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1322
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+SUBF4
+CNSTF4 1101004800
+DIVF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+GEF4 $1324
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1325
+JUMPV
+LABELV $1324
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+LEF4 $1326
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1326
+LABELV $1325
+ADDRGP4 $1145
+ARGP4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1306
+JUMPV
+LABELV $1322
+LABELV $1320
+LABELV $1310
+LABELV $1307
+ADDRGP4 $1328
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $1306
+endproc Item_Slider_HandleKey 68 12
+export Item_HandleKey
+proc Item_HandleKey 32 16
+ADDRGP4 itemCapture
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1330
+ADDRGP4 itemCapture
+INDIRP4
+ARGP4
+ADDRGP4 Item_StopCapture
+CALLV
+pop
+ADDRGP4 itemCapture
+CNSTP4 0
+ASGNP4
+ADDRGP4 captureFunc
+CNSTP4 0
+ASGNP4
+ADDRGP4 captureData
+CNSTP4 0
+ASGNP4
+ADDRGP4 $1331
+JUMPV
+LABELV $1330
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1332
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 184
+EQI4 $1335
+ADDRLP4 0
+INDIRI4
+CNSTI4 185
+EQI4 $1335
+ADDRLP4 0
+INDIRI4
+CNSTI4 186
+NEI4 $1332
+LABELV $1335
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Item_StartCapture
+CALLV
+pop
+LABELV $1332
+LABELV $1331
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1336
+CNSTI4 0
+RETI4
+ADDRGP4 $1329
+JUMPV
+LABELV $1336
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $1338
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $1338
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1352-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1352
+address $1341
+address $1342
+address $1343
+address $1344
+address $1345
+address $1346
+address $1338
+address $1349
+address $1344
+address $1351
+address $1347
+address $1348
+address $1350
+code
+LABELV $1341
+CNSTI4 0
+RETI4
+ADDRGP4 $1329
+JUMPV
+LABELV $1342
+CNSTI4 0
+RETI4
+ADDRGP4 $1329
+JUMPV
+LABELV $1343
+CNSTI4 0
+RETI4
+ADDRGP4 $1329
+JUMPV
+LABELV $1344
+CNSTI4 0
+RETI4
+ADDRGP4 $1329
+JUMPV
+LABELV $1345
+CNSTI4 0
+RETI4
+ADDRGP4 $1329
+JUMPV
+LABELV $1346
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 Item_ListBox_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $1329
+JUMPV
+LABELV $1347
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 Item_YesNo_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $1329
+JUMPV
+LABELV $1348
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 Item_Multi_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $1329
+JUMPV
+LABELV $1349
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 Item_OwnerDraw_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $1329
+JUMPV
+LABELV $1350
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 Item_Bind_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $1329
+JUMPV
+LABELV $1351
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 Item_Slider_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+ADDRGP4 $1329
+JUMPV
+LABELV $1338
+CNSTI4 0
+RETI4
+LABELV $1329
+endproc Item_HandleKey 32 16
+export Item_Action
+proc Item_Action 4 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1355
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $1355
+LABELV $1354
+endproc Item_Action 4 8
+export Menu_SetPrevCursorItem
+proc Menu_SetPrevCursorItem 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1361
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1361
+JUMPV
+LABELV $1360
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GEI4 $1363
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $1363
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $1363
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Item_SetFocus
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $1365
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1357
+JUMPV
+LABELV $1365
+LABELV $1361
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -1
+GTI4 $1360
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTP4 0
+RETP4
+LABELV $1357
+endproc Menu_SetPrevCursorItem 44 12
+export Menu_SetNextCursorItem
+proc Menu_SetNextCursorItem 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1371
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1371
+JUMPV
+LABELV $1370
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $1373
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1373
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1373
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Item_SetFocus
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $1375
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $1367
+JUMPV
+LABELV $1375
+LABELV $1371
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $1370
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTP4 0
+RETP4
+LABELV $1367
+endproc Menu_SetNextCursorItem 44 12
+proc Window_CloseCinematic 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1378
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $1378
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1378
+LABELV $1377
+endproc Window_CloseCinematic 4 4
+proc Menu_CloseCinematics 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1381
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_CloseCinematic
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1386
+JUMPV
+LABELV $1383
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Window_CloseCinematic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1387
+CNSTI4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1387
+LABELV $1384
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1386
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $1383
+LABELV $1381
+LABELV $1380
+endproc Menu_CloseCinematics 4 4
+proc Display_CloseCinematics 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1393
+JUMPV
+LABELV $1390
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+ARGP4
+ADDRGP4 Menu_CloseCinematics
+CALLV
+pop
+LABELV $1391
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1393
+ADDRLP4 0
+INDIRI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104120
+ADDP4
+INDIRI4
+LTI4 $1390
+LABELV $1389
+endproc Display_CloseCinematics 4 4
+export Menus_Activate
+proc Menus_Activate 544 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 6
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1395
+ADDRLP4 4+228
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+LABELV $1395
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1398
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1398
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1398
+ADDRGP4 Display_CloseCinematics
+CALLV
+pop
+LABELV $1394
+endproc Menus_Activate 544 16
+export Display_VisibleMenuCount
+proc Display_VisibleMenuCount 12 0
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $1404
+JUMPV
+LABELV $1401
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1048580
+BANDI4
+CNSTI4 0
+EQI4 $1405
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1405
+LABELV $1402
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1404
+ADDRLP4 0
+INDIRI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104120
+ADDP4
+INDIRI4
+LTI4 $1401
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $1400
+endproc Display_VisibleMenuCount 12 0
+export Menus_HandleOOBClick
+proc Menus_HandleOOBClick 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1408
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1410
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 131072
+BANDI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1410
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_RunCloseScript
+CALLV
+pop
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -7
+BANDI4
+ASGNI4
+LABELV $1410
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1415
+JUMPV
+LABELV $1412
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Menu_OverActiveItem
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1416
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_RunCloseScript
+CALLV
+pop
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 -7
+BANDI4
+ASGNI4
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+ARGP4
+ADDRGP4 Menus_Activate
+CALLV
+pop
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Menu_HandleKey
+CALLV
+pop
+LABELV $1416
+LABELV $1413
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1415
+ADDRLP4 0
+INDIRI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104120
+ADDP4
+INDIRI4
+LTI4 $1412
+ADDRLP4 8
+ADDRGP4 Display_VisibleMenuCount
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1418
+ADDRGP4 DC
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1420
+CNSTI4 0
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1420
+LABELV $1418
+ADDRGP4 Display_CloseCinematics
+CALLV
+pop
+LABELV $1408
+LABELV $1407
+endproc Menus_HandleOOBClick 24 12
+bss
+align 4
+LABELV $1423
+skip 16
+code
+proc Item_CorrectedTextRect 4 12
+ADDRGP4 $1423
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 16
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1424
+ADDRGP4 $1423
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRB
+ASGNB 16
+ADDRGP4 $1423+8
+INDIRF4
+CNSTF4 0
+EQF4 $1426
+ADDRLP4 0
+ADDRGP4 $1423+4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 $1423+12
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $1426
+LABELV $1424
+ADDRGP4 $1423
+RETP4
+LABELV $1422
+endproc Item_CorrectedTextRect 4 12
+export UI_SelectForKey
+proc UI_SelectForKey 96 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 218
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $1434
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $1437
+LABELV $1436
+ADDRLP4 12
+CNSTI4 175
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1434
+ADDRFP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GTI4 $1439
+LABELV $1438
+ADDRFP4 0
+INDIRI4
+CNSTI4 133
+EQI4 $1435
+ADDRLP4 20
+CNSTI4 134
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $1434
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $1441
+LABELV $1440
+ADDRFP4 0
+INDIRI4
+CNSTI4 13
+EQI4 $1434
+ADDRGP4 $1432
+JUMPV
+LABELV $1441
+ADDRFP4 0
+INDIRI4
+CNSTI4 169
+EQI4 $1435
+ADDRFP4 0
+INDIRI4
+CNSTI4 171
+EQI4 $1434
+ADDRGP4 $1432
+JUMPV
+LABELV $1439
+ADDRLP4 32
+CNSTI4 193
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $1434
+ADDRFP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+GTI4 $1443
+LABELV $1442
+ADDRFP4 0
+INDIRI4
+CNSTI4 184
+EQI4 $1434
+ADDRFP4 0
+INDIRI4
+CNSTI4 185
+EQI4 $1435
+ADDRFP4 0
+INDIRI4
+CNSTI4 186
+EQI4 $1434
+ADDRGP4 $1432
+JUMPV
+LABELV $1443
+ADDRLP4 44
+CNSTI4 201
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $1434
+ADDRFP4 0
+INDIRI4
+CNSTI4 203
+EQI4 $1435
+ADDRFP4 0
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LTI4 $1432
+LABELV $1444
+ADDRFP4 0
+INDIRI4
+CNSTI4 211
+EQI4 $1434
+ADDRFP4 0
+INDIRI4
+CNSTI4 213
+EQI4 $1435
+ADDRGP4 $1432
+JUMPV
+LABELV $1437
+ADDRFP4 0
+INDIRI4
+CNSTI4 251
+EQI4 $1434
+ADDRLP4 56
+CNSTI4 253
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $1435
+ADDRFP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+GTI4 $1446
+LABELV $1445
+ADDRFP4 0
+INDIRI4
+CNSTI4 236
+EQI4 $1434
+ADDRLP4 64
+CNSTI4 238
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $1435
+ADDRFP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+GTI4 $1448
+LABELV $1447
+ADDRFP4 0
+INDIRI4
+CNSTI4 226
+EQI4 $1434
+ADDRFP4 0
+INDIRI4
+CNSTI4 228
+EQI4 $1435
+ADDRGP4 $1432
+JUMPV
+LABELV $1448
+ADDRFP4 0
+INDIRI4
+CNSTI4 243
+EQI4 $1434
+ADDRGP4 $1432
+JUMPV
+LABELV $1446
+ADDRLP4 76
+CNSTI4 268
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 76
+INDIRI4
+EQI4 $1434
+ADDRFP4 0
+INDIRI4
+ADDRLP4 76
+INDIRI4
+GTI4 $1450
+LABELV $1449
+ADDRFP4 0
+INDIRI4
+CNSTI4 261
+EQI4 $1434
+ADDRFP4 0
+INDIRI4
+CNSTI4 263
+EQI4 $1435
+ADDRGP4 $1432
+JUMPV
+LABELV $1450
+ADDRLP4 88
+CNSTI4 276
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 88
+INDIRI4
+EQI4 $1434
+ADDRFP4 0
+INDIRI4
+CNSTI4 278
+EQI4 $1435
+ADDRFP4 0
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LTI4 $1432
+LABELV $1451
+ADDRFP4 0
+INDIRI4
+CNSTI4 286
+EQI4 $1434
+ADDRFP4 0
+INDIRI4
+CNSTI4 288
+EQI4 $1435
+ADDRGP4 $1432
+JUMPV
+LABELV $1434
+CNSTI4 1
+RETI4
+ADDRGP4 $1431
+JUMPV
+LABELV $1435
+CNSTI4 -1
+RETI4
+ADDRGP4 $1431
+JUMPV
+LABELV $1432
+CNSTI4 0
+RETI4
+LABELV $1431
+endproc UI_SelectForKey 96 0
+data
+align 4
+LABELV $1471
+byte 4 0
+export Menu_HandleKey
+code
+proc Menu_HandleKey 684 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_waitingForKey
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $1453
+ADDRFP4 8
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $1453
+ADDRGP4 g_bindItem
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Item_Bind_HandleKey
+CALLI4
+pop
+ADDRGP4 $1452
+JUMPV
+LABELV $1453
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_editingField
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1455
+ADDRFP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1455
+ADDRGP4 g_editItem
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 Item_TextField_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $1457
+ADDRGP4 g_editingField
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_editItem
+CNSTP4 0
+ASGNP4
+ADDRGP4 $1452
+JUMPV
+LABELV $1457
+ADDRFP4 4
+INDIRI4
+CNSTI4 184
+EQI4 $1462
+ADDRFP4 4
+INDIRI4
+CNSTI4 185
+EQI4 $1462
+ADDRFP4 4
+INDIRI4
+CNSTI4 186
+NEI4 $1459
+LABELV $1462
+ADDRGP4 g_editingField
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_editItem
+CNSTP4 0
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRLP4 24
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Display_MouseMove
+CALLI4
+pop
+ADDRGP4 $1460
+JUMPV
+LABELV $1459
+ADDRFP4 4
+INDIRI4
+CNSTI4 9
+EQI4 $1466
+ADDRFP4 4
+INDIRI4
+CNSTI4 131
+EQI4 $1466
+ADDRFP4 4
+INDIRI4
+CNSTI4 132
+NEI4 $1463
+LABELV $1466
+ADDRGP4 $1452
+JUMPV
+LABELV $1463
+LABELV $1460
+LABELV $1455
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1467
+ADDRGP4 $1452
+JUMPV
+LABELV $1467
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $1469
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2097152
+BANDI4
+ADDRLP4 16
+INDIRI4
+NEI4 $1469
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $1469
+ADDRGP4 $1471
+INDIRI4
+CNSTI4 0
+NEI4 $1472
+ADDRFP4 4
+INDIRI4
+CNSTI4 184
+EQI4 $1475
+ADDRFP4 4
+INDIRI4
+CNSTI4 185
+EQI4 $1475
+ADDRFP4 4
+INDIRI4
+CNSTI4 186
+NEI4 $1472
+LABELV $1475
+ADDRGP4 $1471
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Menus_HandleOOBClick
+CALLV
+pop
+ADDRGP4 $1471
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1452
+JUMPV
+LABELV $1472
+LABELV $1469
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1479
+JUMPV
+LABELV $1476
+ADDRLP4 32
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $1480
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1480
+LABELV $1477
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1479
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $1476
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1482
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 Item_HandleKey
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $1484
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Action
+CALLV
+pop
+ADDRGP4 $1452
+JUMPV
+LABELV $1484
+LABELV $1482
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1486
+ADDRGP4 $1452
+JUMPV
+LABELV $1486
+ADDRFP4 4
+INDIRI4
+CNSTI4 193
+EQI4 $1518
+ADDRLP4 36
+CNSTI4 194
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $1499
+ADDRFP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+GTI4 $1525
+LABELV $1524
+ADDRFP4 4
+INDIRI4
+CNSTI4 131
+EQI4 $1498
+ADDRLP4 44
+CNSTI4 132
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+EQI4 $1503
+ADDRFP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+GTI4 $1527
+LABELV $1526
+ADDRLP4 52
+CNSTI4 13
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $1518
+ADDRFP4 4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+GTI4 $1529
+LABELV $1528
+ADDRFP4 4
+INDIRI4
+CNSTI4 9
+EQI4 $1503
+ADDRGP4 $1488
+JUMPV
+LABELV $1529
+ADDRFP4 4
+INDIRI4
+CNSTI4 27
+EQI4 $1499
+ADDRGP4 $1488
+JUMPV
+LABELV $1527
+ADDRLP4 60
+CNSTI4 167
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $1498
+ADDRFP4 4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+GTI4 $1531
+LABELV $1530
+ADDRFP4 4
+INDIRI4
+CNSTI4 161
+EQI4 $1490
+ADDRFP4 4
+INDIRI4
+CNSTI4 162
+EQI4 $1494
+ADDRGP4 $1488
+JUMPV
+LABELV $1531
+ADDRLP4 72
+CNSTI4 173
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $1503
+ADDRFP4 4
+INDIRI4
+CNSTI4 175
+EQI4 $1518
+ADDRFP4 4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LTI4 $1488
+LABELV $1532
+ADDRFP4 4
+INDIRI4
+CNSTI4 184
+EQI4 $1504
+ADDRFP4 4
+INDIRI4
+CNSTI4 185
+EQI4 $1504
+ADDRGP4 $1488
+JUMPV
+LABELV $1525
+ADDRFP4 4
+INDIRI4
+CNSTI4 235
+EQI4 $1498
+ADDRLP4 84
+CNSTI4 237
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+EQI4 $1503
+ADDRFP4 4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+GTI4 $1534
+LABELV $1533
+ADDRFP4 4
+INDIRI4
+CNSTI4 210
+EQI4 $1498
+ADDRLP4 92
+CNSTI4 212
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 92
+INDIRI4
+EQI4 $1503
+ADDRFP4 4
+INDIRI4
+ADDRLP4 92
+INDIRI4
+GTI4 $1536
+LABELV $1535
+ADDRFP4 4
+INDIRI4
+CNSTI4 200
+EQI4 $1498
+ADDRFP4 4
+INDIRI4
+CNSTI4 202
+EQI4 $1503
+ADDRGP4 $1488
+JUMPV
+LABELV $1536
+ADDRLP4 104
+CNSTI4 218
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+EQI4 $1518
+ADDRFP4 4
+INDIRI4
+CNSTI4 219
+EQI4 $1499
+ADDRFP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+LTI4 $1488
+LABELV $1537
+ADDRFP4 4
+INDIRI4
+CNSTI4 225
+EQI4 $1498
+ADDRFP4 4
+INDIRI4
+CNSTI4 227
+EQI4 $1503
+ADDRGP4 $1488
+JUMPV
+LABELV $1534
+ADDRFP4 4
+INDIRI4
+CNSTI4 250
+EQI4 $1498
+ADDRLP4 116
+CNSTI4 252
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 116
+INDIRI4
+EQI4 $1503
+ADDRFP4 4
+INDIRI4
+ADDRLP4 116
+INDIRI4
+GTI4 $1539
+LABELV $1538
+ADDRFP4 4
+INDIRI4
+CNSTI4 243
+EQI4 $1518
+ADDRFP4 4
+INDIRI4
+CNSTI4 244
+EQI4 $1499
+ADDRGP4 $1488
+JUMPV
+LABELV $1539
+ADDRLP4 128
+CNSTI4 260
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 128
+INDIRI4
+EQI4 $1498
+ADDRFP4 4
+INDIRI4
+CNSTI4 262
+EQI4 $1503
+ADDRFP4 4
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LTI4 $1488
+LABELV $1540
+ADDRFP4 4
+INDIRI4
+CNSTI4 268
+LTI4 $1488
+ADDRFP4 4
+INDIRI4
+CNSTI4 308
+GTI4 $1488
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $1541-1072
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1541
+address $1518
+address $1499
+address $1488
+address $1488
+address $1488
+address $1488
+address $1488
+address $1498
+address $1488
+address $1503
+address $1488
+address $1488
+address $1488
+address $1488
+address $1488
+address $1488
+address $1488
+address $1498
+address $1488
+address $1503
+address $1488
+address $1488
+address $1488
+address $1488
+address $1488
+address $1518
+address $1518
+address $1518
+address $1518
+address $1518
+address $1518
+address $1518
+address $1518
+address $1518
+address $1518
+address $1518
+address $1518
+address $1518
+address $1518
+address $1518
+address $1518
+code
+LABELV $1490
+ADDRGP4 $1493
+ARGP4
+ADDRLP4 136
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+CNSTF4 0
+EQF4 $1489
+ADDRLP4 140
+ADDRGP4 debugMode
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRGP4 $1489
+JUMPV
+LABELV $1494
+ADDRGP4 $1493
+ARGP4
+ADDRLP4 140
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+CNSTF4 0
+EQF4 $1489
+CNSTI4 2
+ARGI4
+ADDRGP4 $1497
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1489
+JUMPV
+LABELV $1498
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_SetPrevCursorItem
+CALLP4
+pop
+ADDRGP4 $1489
+JUMPV
+LABELV $1499
+ADDRGP4 g_waitingForKey
+INDIRI4
+CNSTI4 0
+NEI4 $1489
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1489
+ADDRLP4 144+228
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 144
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_RunScript
+CALLV
+pop
+ADDRGP4 $1489
+JUMPV
+LABELV $1503
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_SetNextCursorItem
+CALLP4
+pop
+ADDRGP4 $1489
+JUMPV
+LABELV $1504
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1489
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1507
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 Item_CorrectedTextRect
+CALLP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 148
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 152
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $1489
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Action
+CALLV
+pop
+ADDRGP4 $1489
+JUMPV
+LABELV $1507
+ADDRLP4 144
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 4
+EQI4 $1513
+ADDRLP4 144
+INDIRI4
+CNSTI4 9
+NEI4 $1511
+LABELV $1513
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 148
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 152
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $1489
+ADDRLP4 4
+INDIRP4
+CNSTI4 532
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_editingField
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_editItem
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $1489
+JUMPV
+LABELV $1511
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 148
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 152
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $1489
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Action
+CALLV
+pop
+ADDRGP4 $1489
+JUMPV
+LABELV $1518
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1489
+ADDRLP4 144
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 4
+EQI4 $1523
+ADDRLP4 144
+INDIRI4
+CNSTI4 9
+NEI4 $1521
+LABELV $1523
+ADDRLP4 4
+INDIRP4
+CNSTI4 532
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_editingField
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_editItem
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $1489
+JUMPV
+LABELV $1521
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Action
+CALLV
+pop
+LABELV $1488
+LABELV $1489
+LABELV $1452
+endproc Menu_HandleKey 684 12
+export ToWindowCoords
+proc ToWindowCoords 8 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1544
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1544
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1543
+endproc ToWindowCoords 8 0
+export Rect_ToWindowCoords
+proc Rect_ToWindowCoords 4 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 ToWindowCoords
+CALLV
+pop
+LABELV $1546
+endproc Rect_ToWindowCoords 4 12
+export Item_SetTextExtents
+proc Item_SetTextExtents 296 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1549
+ADDRLP4 4
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $1550
+JUMPV
+LABELV $1549
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1550
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1551
+ADDRGP4 $1547
+JUMPV
+LABELV $1551
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1555
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1553
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1553
+LABELV $1555
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1556
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $1558
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+NEI4 $1556
+LABELV $1558
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 DC
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $1557
+JUMPV
+LABELV $1556
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $1559
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1559
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1559
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 292
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 292
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1559
+LABELV $1557
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+ADDRGP4 DC
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1561
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRGP4 $1562
+JUMPV
+LABELV $1561
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1563
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+SUBF4
+ASGNF4
+LABELV $1563
+LABELV $1562
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ToWindowCoords
+CALLV
+pop
+LABELV $1553
+LABELV $1547
+endproc Item_SetTextExtents 296 12
+export Item_TextColor
+proc Item_TextColor 60 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1566
+ADDRLP4 28
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 36
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1567
+JUMPV
+LABELV $1566
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $1571
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 200
+DIVI4
+ADDRLP4 28
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $1571
+ADDRLP4 32
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 40
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1572
+JUMPV
+LABELV $1571
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1572
+LABELV $1567
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTU4 0
+ASGNU4
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+ADDRLP4 40
+INDIRU4
+EQU4 $1576
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 44
+INDIRI4
+EQI4 $1576
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+ADDRLP4 40
+INDIRU4
+EQU4 $1576
+ADDRLP4 48
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 44
+INDIRI4
+EQI4 $1576
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $1578
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 56
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $1578
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1578
+LABELV $1576
+LABELV $1565
+endproc Item_TextColor 60 28
+export Item_Text_AutoWrapped_Paint
+proc Item_Text_AutoWrapped_Paint 2132 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+CNSTI4 0
+ASGNI4
+ADDRLP4 1044
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1581
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1583
+ADDRGP4 $1580
+JUMPV
+LABELV $1583
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1080
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1056
+ADDRLP4 1080
+ASGNP4
+ADDRGP4 $1582
+JUMPV
+LABELV $1581
+ADDRLP4 1056
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1582
+ADDRLP4 1056
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1585
+ADDRGP4 $1580
+JUMPV
+LABELV $1585
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ARGP4
+ADDRGP4 Item_TextColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1076
+ARGP4
+ADDRLP4 1052
+ARGP4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+ADDRGP4 Item_SetTextExtents
+CALLV
+pop
+ADDRLP4 1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 2104
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 2104
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1036
+ADDRLP4 2104
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 2104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRGP4 $1588
+JUMPV
+LABELV $1587
+ADDRLP4 2108
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2108
+INDIRI4
+CNSTI4 32
+EQI4 $1594
+ADDRLP4 2108
+INDIRI4
+CNSTI4 9
+EQI4 $1594
+ADDRLP4 2108
+INDIRI4
+CNSTI4 10
+EQI4 $1594
+ADDRLP4 2108
+INDIRI4
+CNSTI4 0
+NEI4 $1590
+LABELV $1594
+ADDRLP4 1036
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+LABELV $1590
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 2112
+ADDRGP4 DC
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 2112
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+EQI4 $1598
+ADDRLP4 1032
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+GTF4 $1599
+LABELV $1598
+ADDRLP4 2116
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2116
+INDIRI4
+CNSTI4 10
+EQI4 $1599
+ADDRLP4 2116
+INDIRI4
+CNSTI4 0
+NEI4 $1595
+LABELV $1599
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+EQI4 $1600
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1602
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1603
+JUMPV
+LABELV $1602
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1604
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRGP4 $1605
+JUMPV
+LABELV $1604
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1606
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+SUBF4
+ASGNF4
+LABELV $1606
+LABELV $1605
+LABELV $1603
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 1048
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ToWindowCoords
+CALLV
+pop
+ADDRLP4 1036
+INDIRI4
+ADDRLP4 4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1060
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1600
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1608
+ADDRGP4 $1589
+JUMPV
+LABELV $1608
+ADDRLP4 1048
+ADDRLP4 1048
+INDIRF4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 5
+ADDI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1044
+INDIRP4
+ASGNP4
+ADDRLP4 2120
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 2120
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 2120
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 2120
+INDIRI4
+ASGNI4
+ADDRGP4 $1588
+JUMPV
+LABELV $1595
+ADDRLP4 2120
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+ADDRLP4 2128
+CNSTI4 1
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 2120
+INDIRI4
+ADDRLP4 2128
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 2124
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2124
+INDIRP4
+ADDRLP4 2128
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2120
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 2124
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 1028
+INDIRI4
+ADDRLP4 4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $1588
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1587
+LABELV $1589
+LABELV $1580
+endproc Item_Text_AutoWrapped_Paint 2132 32
+export Item_Text_Wrapped_Paint
+proc Item_Text_Wrapped_Paint 2124 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1611
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1613
+ADDRGP4 $1610
+JUMPV
+LABELV $1613
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1060
+ADDRLP4 1068
+ASGNP4
+ADDRGP4 $1612
+JUMPV
+LABELV $1611
+ADDRLP4 1060
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1612
+ADDRLP4 1060
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1615
+ADDRGP4 $1610
+JUMPV
+LABELV $1615
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ARGP4
+ADDRGP4 Item_TextColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1064
+ARGP4
+ADDRLP4 1056
+ARGP4
+ADDRLP4 1060
+INDIRP4
+ARGP4
+ADDRGP4 Item_SetTextExtents
+CALLV
+pop
+ADDRLP4 1036
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1032
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 1060
+INDIRP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ARGP4
+CNSTI4 13
+ARGI4
+ADDRLP4 2100
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2100
+INDIRP4
+ASGNP4
+ADDRGP4 $1618
+JUMPV
+LABELV $1617
+ADDRLP4 8
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+CVIU4 4
+ARGU4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1036
+INDIRF4
+ARGF4
+ADDRLP4 1032
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRF4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 5
+ADDI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 13
+ARGI4
+ADDRLP4 2120
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2120
+INDIRP4
+ASGNP4
+LABELV $1618
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1620
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1617
+LABELV $1620
+ADDRLP4 1036
+INDIRF4
+ARGF4
+ADDRLP4 1032
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1610
+endproc Item_Text_Wrapped_Paint 2124 32
+export Item_Text_Paint
+proc Item_Text_Paint 1056 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 262144
+BANDI4
+CNSTI4 0
+EQI4 $1622
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Wrapped_Paint
+CALLV
+pop
+ADDRGP4 $1621
+JUMPV
+LABELV $1622
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $1624
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_AutoWrapped_Paint
+CALLV
+pop
+ADDRGP4 $1621
+JUMPV
+LABELV $1624
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1626
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1628
+ADDRGP4 $1621
+JUMPV
+LABELV $1628
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 28
+ASGNP4
+ADDRGP4 $1627
+JUMPV
+LABELV $1626
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1627
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_SetTextExtents
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1630
+ADDRGP4 $1621
+JUMPV
+LABELV $1630
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Item_TextColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1621
+endproc Item_Text_Paint 1056 32
+export Item_TextField_Paint
+proc Item_TextField_Paint 1100 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRLP4 8
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1633
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1633
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1635
+ADDRLP4 1068
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 1032
+ADDRLP4 1068
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 1032+4
+ADDRLP4 1068
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 1032+8
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 1032+12
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 1076
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+ADDRLP4 1048
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 1076
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1636
+JUMPV
+LABELV $1635
+ADDRLP4 1048
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1636
+ADDRLP4 1072
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1072
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1641
+ADDRLP4 1072
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1641
+ADDRLP4 1068
+CNSTI4 8
+ASGNI4
+ADDRGP4 $1642
+JUMPV
+LABELV $1641
+ADDRLP4 1068
+CNSTI4 0
+ASGNI4
+LABELV $1642
+ADDRLP4 1064
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 1076
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 1076
+INDIRI4
+EQI4 $1643
+ADDRGP4 g_editingField
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+EQI4 $1643
+ADDRLP4 1084
+ADDRGP4 DC
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+EQI4 $1645
+ADDRLP4 1080
+CNSTI4 11
+ASGNI4
+ADDRGP4 $1646
+JUMPV
+LABELV $1645
+ADDRLP4 1080
+CNSTI4 10
+ASGNI4
+LABELV $1646
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 1064
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1048
+ARGP4
+ADDRLP4 1096
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+ADDRLP4 8
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 1096
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 1080
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1644
+JUMPV
+LABELV $1643
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 1064
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 1048
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDRLP4 8
+ADDP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1644
+LABELV $1632
+endproc Item_TextField_Paint 1100 36
+export Item_YesNo_Paint
+proc Item_YesNo_Paint 60 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1649
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 DC
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 $1650
+JUMPV
+LABELV $1649
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+LABELV $1650
+ADDRLP4 36
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1651
+ADDRLP4 48
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+12
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 56
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1652
+JUMPV
+LABELV $1651
+ADDRLP4 20
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1652
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1656
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 36
+INDIRF4
+CNSTF4 0
+EQF4 $1661
+ADDRLP4 48
+ADDRGP4 $1658
+ASGNP4
+ADDRGP4 $1662
+JUMPV
+LABELV $1661
+ADDRLP4 48
+ADDRGP4 $1659
+ASGNP4
+LABELV $1662
+ADDRLP4 48
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1657
+JUMPV
+LABELV $1656
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 36
+INDIRF4
+CNSTF4 0
+EQF4 $1664
+ADDRLP4 48
+ADDRGP4 $1658
+ASGNP4
+ADDRGP4 $1665
+JUMPV
+LABELV $1664
+ADDRLP4 48
+ADDRGP4 $1659
+ASGNP4
+LABELV $1665
+ADDRLP4 48
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1657
+LABELV $1647
+endproc Item_YesNo_Paint 60 32
+export Item_Multi_Paint
+proc Item_Multi_Paint 52 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 $119
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1667
+ADDRLP4 40
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 8
+ADDRLP4 40
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8+12
+CNSTF4 1061997773
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 48
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1668
+JUMPV
+LABELV $1667
+ADDRLP4 24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1668
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Item_Multi_Setting
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1672
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1673
+JUMPV
+LABELV $1672
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1673
+LABELV $1666
+endproc Item_Multi_Paint 52 32
+data
+align 4
+LABELV g_bindings_ui_shared
+address $1675
+byte 4 9
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1676
+byte 4 13
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1677
+byte 4 139
+byte 4 140
+byte 4 -1
+byte 4 -1
+address $1678
+byte 4 131
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1679
+byte 4 132
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1680
+byte 4 44
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1681
+byte 4 46
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1682
+byte 4 32
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1683
+byte 4 99
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1684
+byte 4 133
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1685
+byte 4 134
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1686
+byte 4 135
+byte 4 136
+byte 4 -1
+byte 4 -1
+address $1687
+byte 4 147
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1688
+byte 4 146
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1689
+byte 4 47
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1690
+byte 4 150
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1691
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1692
+byte 4 49
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1693
+byte 4 50
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1694
+byte 4 51
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1695
+byte 4 52
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1696
+byte 4 53
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1697
+byte 4 54
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1698
+byte 4 55
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1699
+byte 4 56
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1700
+byte 4 57
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1701
+byte 4 48
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1702
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1703
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1704
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1705
+byte 4 137
+byte 4 138
+byte 4 -1
+byte 4 -1
+address $1706
+byte 4 91
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1707
+byte 4 93
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1708
+byte 4 186
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1709
+byte 4 187
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1710
+byte 4 119
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1711
+byte 4 114
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1712
+byte 4 116
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1713
+byte 4 121
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1714
+byte 4 110
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1715
+byte 4 111
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1716
+byte 4 100
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1717
+byte 4 112
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1718
+byte 4 99
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1719
+byte 4 102
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1720
+byte 4 118
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1721
+byte 4 101
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1722
+byte 4 105
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1723
+byte 4 107
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1724
+byte 4 151
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1725
+byte 4 152
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1726
+byte 4 153
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1727
+byte 4 154
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1728
+byte 4 155
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1729
+byte 4 168
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1730
+byte 4 174
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1731
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1732
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1733
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+address $1734
+byte 4 -1
+byte 4 -1
+byte 4 -1
+byte 4 -1
+lit
+align 4
+LABELV g_bindCount
+byte 4 60
+code
+proc Controls_GetKeyAssignment_ui_shared 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $1736
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 DC
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $1740
+ADDRGP4 $1738
+JUMPV
+LABELV $1740
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1737
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LTI4 $1736
+LABELV $1738
+LABELV $1735
+endproc Controls_GetKeyAssignment_ui_shared 24 8
+export Controls_GetConfig_ui_shared
+proc Controls_GetConfig_ui_shared 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1746
+JUMPV
+LABELV $1743
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Controls_GetKeyAssignment_ui_shared
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+16
+ADDP4
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $1744
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1746
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1743
+LABELV $1742
+endproc Controls_GetConfig_ui_shared 12 8
+export Controls_SetConfig_ui_shared
+proc Controls_SetConfig_ui_shared 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1754
+JUMPV
+LABELV $1751
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+12
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1755
+ADDRLP4 4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_bindings_ui_shared+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_bindings_ui_shared
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+16
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1759
+ADDRLP4 8
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings_ui_shared+16
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings_ui_shared
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1759
+LABELV $1755
+LABELV $1752
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1754
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1751
+CNSTI4 2
+ARGI4
+ADDRGP4 $1763
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1750
+endproc Controls_SetConfig_ui_shared 12 8
+export Controls_SetDefaults_ui_shared
+proc Controls_SetDefaults_ui_shared 12 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1768
+JUMPV
+LABELV $1765
+ADDRLP4 4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_bindings_ui_shared+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_bindings_ui_shared+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings_ui_shared+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings_ui_shared+8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1766
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1768
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1765
+LABELV $1764
+endproc Controls_SetDefaults_ui_shared 12 0
+export BindingIDFromName
+proc BindingIDFromName 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1777
+JUMPV
+LABELV $1774
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1778
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1773
+JUMPV
+LABELV $1778
+LABELV $1775
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1777
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1774
+CNSTI4 -1
+RETI4
+LABELV $1773
+endproc BindingIDFromName 8 8
+export BindingFromName
+proc BindingFromName 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1784
+JUMPV
+LABELV $1781
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1785
+ADDRLP4 4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $1788
+ADDRGP4 $1783
+JUMPV
+LABELV $1788
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 g_nameBind1
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 g_nameBind1
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 8
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+EQI4 $1780
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 g_nameBind2
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 g_nameBind2
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 g_nameBind1
+ARGP4
+ADDRGP4 $1793
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRGP4 g_nameBind1
+ARGP4
+ADDRGP4 g_nameBind2
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRGP4 $1780
+JUMPV
+LABELV $1785
+LABELV $1782
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1784
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1781
+LABELV $1783
+ADDRGP4 g_nameBind1
+ARGP4
+ADDRGP4 $1794
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $1780
+endproc BindingFromName 16 12
+export Item_Slider_Paint
+proc Item_Slider_Paint 60 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1796
+ADDRLP4 44
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 12
+ADDRLP4 44
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 1061997773
+ADDRLP4 4
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 1061997773
+ADDRLP4 4
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 52
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1797
+JUMPV
+LABELV $1796
+ADDRLP4 28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1797
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1801
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRGP4 $1802
+JUMPV
+LABELV $1801
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $1802
+ADDRLP4 28
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+CNSTF4 1119879168
+ARGF4
+CNSTF4 1098907648
+ARGF4
+ADDRLP4 48
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 61956
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Item_Slider_ThumbPosition
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ARGF4
+CNSTF4 1094713344
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 56
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 61960
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1795
+endproc Item_Slider_Paint 60 20
+export Item_Bind_Paint
+proc Item_Bind_Paint 52 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1804
+ADDRLP4 16
+ADDRLP4 24
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1804
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1806
+ADDRGP4 g_bindItem
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $1808
+ADDRLP4 0
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1061997773
+ASGNF4
+ADDRGP4 $1809
+JUMPV
+LABELV $1808
+ADDRLP4 44
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 48
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1061997773
+ADDRLP4 20
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1061997773
+ADDRLP4 20
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1809
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 44
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $1807
+JUMPV
+LABELV $1806
+ADDRLP4 28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $1807
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1816
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BindingFromName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 g_nameBind1
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1817
+JUMPV
+LABELV $1816
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ARGP4
+ADDRGP4 $1818
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1817
+LABELV $1803
+endproc Item_Bind_Paint 52 32
+export Display_KeyBindPending
+proc Display_KeyBindPending 0 0
+ADDRGP4 g_waitingForKey
+INDIRI4
+RETI4
+LABELV $1819
+endproc Display_KeyBindPending 0 0
+export Display_WantsBindKeys
+proc Display_WantsBindKeys 4 0
+ADDRGP4 g_waitingForKey
+INDIRI4
+CNSTI4 0
+EQI4 $1822
+ADDRGP4 g_bindItem
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1822
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1823
+JUMPV
+LABELV $1822
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1823
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1820
+endproc Display_WantsBindKeys 4 0
+export Item_Bind_HandleKey
+proc Item_Bind_HandleKey 20 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_waitingForKey
+INDIRI4
+CNSTI4 0
+NEI4 $1825
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1827
+ADDRFP4 4
+INDIRI4
+CNSTI4 184
+NEI4 $1830
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $1835
+LABELV $1830
+ADDRFP4 4
+INDIRI4
+CNSTI4 13
+EQI4 $1835
+ADDRFP4 4
+INDIRI4
+CNSTI4 175
+EQI4 $1835
+ADDRFP4 4
+INDIRI4
+CNSTI4 193
+EQI4 $1835
+ADDRFP4 4
+INDIRI4
+CNSTI4 218
+EQI4 $1835
+ADDRFP4 4
+INDIRI4
+CNSTI4 243
+EQI4 $1835
+ADDRFP4 4
+INDIRI4
+CNSTI4 268
+NEI4 $1827
+LABELV $1835
+ADDRGP4 g_waitingForKey
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_bindItem
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $1827
+CNSTI4 1
+RETI4
+ADDRGP4 $1824
+JUMPV
+LABELV $1825
+ADDRGP4 g_bindItem
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1836
+CNSTI4 1
+RETI4
+ADDRGP4 $1824
+JUMPV
+LABELV $1836
+ADDRFP4 4
+INDIRI4
+CNSTI4 2147483648
+BANDI4
+CNSTI4 0
+EQI4 $1838
+CNSTI4 1
+RETI4
+ADDRGP4 $1824
+JUMPV
+LABELV $1838
+ADDRLP4 12
+CNSTI4 96
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $1856
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GTI4 $1858
+LABELV $1857
+ADDRFP4 4
+INDIRI4
+CNSTI4 27
+EQI4 $1842
+ADDRGP4 $1840
+JUMPV
+LABELV $1858
+ADDRFP4 4
+INDIRI4
+CNSTI4 127
+EQI4 $1843
+ADDRGP4 $1840
+JUMPV
+LABELV $1842
+ADDRGP4 g_waitingForKey
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1824
+JUMPV
+LABELV $1843
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 BindingIDFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $1844
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+12
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1846
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $119
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+12
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1846
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+16
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1851
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $119
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+16
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1851
+LABELV $1844
+CNSTI4 1
+ARGI4
+ADDRGP4 Controls_SetConfig_ui_shared
+CALLV
+pop
+ADDRGP4 g_waitingForKey
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_bindItem
+CNSTP4 0
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $1824
+JUMPV
+LABELV $1856
+CNSTI4 1
+RETI4
+ADDRGP4 $1824
+JUMPV
+LABELV $1840
+ADDRFP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $1859
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1864
+JUMPV
+LABELV $1861
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+16
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1865
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+16
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1865
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+12
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1869
+ADDRLP4 8
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings_ui_shared+12
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_bindings_ui_shared+16
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 20
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+16
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1869
+LABELV $1862
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1864
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_bindCount
+INDIRI4
+LTI4 $1861
+LABELV $1859
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BindingIDFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $1875
+ADDRFP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $1877
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+12
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1879
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $119
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+12
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1879
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+16
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $1878
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $119
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+16
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $1878
+JUMPV
+LABELV $1877
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+12
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1889
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+12
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1890
+JUMPV
+LABELV $1889
+ADDRLP4 12
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_bindings_ui_shared+12
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $1893
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_bindings_ui_shared+16
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $1893
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+16
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $1894
+JUMPV
+LABELV $1893
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $119
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $119
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRP4
+CALLV
+pop
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+12
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 20
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_bindings_ui_shared+16
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $1894
+LABELV $1890
+LABELV $1878
+LABELV $1875
+CNSTI4 1
+ARGI4
+ADDRGP4 Controls_SetConfig_ui_shared
+CALLV
+pop
+ADDRGP4 g_waitingForKey
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $1824
+endproc Item_Bind_HandleKey 20 12
+export Item_Model_Paint
+proc Item_Model_Paint 772 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 676
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 676
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1903
+ADDRGP4 $1902
+JUMPV
+LABELV $1903
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 448
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 748
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 736
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 748
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 740
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 748
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 752
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 692
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 752
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 696
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 752
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 736
+ARGP4
+ADDRLP4 740
+ARGP4
+ADDRLP4 692
+ARGP4
+ADDRLP4 696
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 736
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 740
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 692
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+12
+ADDRLP4 696
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 712
+ARGP4
+ADDRLP4 724
+ARGP4
+ADDRLP4 756
+CNSTI4 0
+ASGNI4
+ADDRLP4 756
+INDIRI4
+ARGI4
+ADDRLP4 756
+INDIRI4
+ARGI4
+CNSTF4 0
+ARGF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+CALLI4
+pop
+ADDRLP4 680+8
+CNSTF4 3204448256
+ADDRLP4 712+8
+INDIRF4
+ADDRLP4 724+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 680+4
+CNSTF4 1056964608
+ADDRLP4 712+4
+INDIRF4
+ADDRLP4 724+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 760
+CNSTF4 1056964608
+ADDRLP4 724+8
+INDIRF4
+ADDRLP4 712+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 680
+ADDRLP4 760
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRGP4 $1917
+JUMPV
+LABELV $1916
+ADDRLP4 680
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $1917
+ADDRLP4 676
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1922
+ADDRLP4 760
+ADDRLP4 676
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1923
+JUMPV
+LABELV $1922
+ADDRLP4 760
+ADDRLP4 692
+INDIRF4
+ASGNF4
+LABELV $1923
+ADDRLP4 0+16
+ADDRLP4 760
+INDIRF4
+ASGNF4
+ADDRLP4 676
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1926
+ADDRLP4 764
+ADDRLP4 676
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1927
+JUMPV
+LABELV $1926
+ADDRLP4 764
+ADDRLP4 696
+INDIRF4
+ASGNF4
+LABELV $1927
+ADDRLP4 0+20
+ADDRLP4 764
+INDIRF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0+72
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 448
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 228
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 676
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1929
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+LEI4 $1931
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRLP4 676
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 676
+INDIRP4
+ADDRLP4 676
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 360
+MODI4
+ASGNI4
+LABELV $1931
+LABELV $1929
+ADDRLP4 700
+CNSTF4 0
+ASGNF4
+ADDRLP4 700+4
+ADDRLP4 676
+INDIRP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 700+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 700
+ARGP4
+ADDRLP4 448+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 448+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 448+68
+ADDRLP4 680
+INDIRB
+ASGNB 12
+ADDRLP4 448+12
+ADDRLP4 680
+INDIRB
+ASGNB 12
+ADDRLP4 448+4
+CNSTI4 192
+ASGNI4
+ADDRLP4 448+88
+ADDRLP4 448+68
+INDIRB
+ASGNB 12
+ADDRLP4 448
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1902
+endproc Item_Model_Paint 772 24
+export Item_Image_Paint
+proc Item_Image_Paint 16 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1943
+ADDRGP4 $1942
+JUMPV
+LABELV $1943
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 8
+CNSTI4 8
+ASGNI4
+ADDRLP4 12
+CNSTF4 1073741824
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1942
+endproc Item_Image_Paint 16 20
+export Item_ListBox_Paint
+proc Item_ListBox_Paint 116 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 DC
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1946
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 44
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 61928
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+CNSTF4 1097859072
+ADDF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 8
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+CNSTF4 1098907648
+ARGF4
+ADDRLP4 56
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 61936
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 60
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 61932
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 Item_ListBox_ThumbDrawPosition
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1065353216
+SUBF4
+LEF4 $1948
+ADDRLP4 32
+ADDRLP4 16
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $1948
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 76
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 61940
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1947
+ADDRLP4 88
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1955
+JUMPV
+LABELV $1952
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 DC
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $1956
+ADDRLP4 96
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 104
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 104
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 104
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1956
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+NEI4 $1958
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 100
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1958
+ADDRLP4 96
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 20
+INDIRF4
+ADDRLP4 96
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 96
+INDIRP4
+INDIRF4
+GEF4 $1960
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1947
+JUMPV
+LABELV $1960
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 104
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1953
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1955
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $1952
+ADDRGP4 $1947
+JUMPV
+LABELV $1946
+ADDRLP4 44
+CNSTI4 8
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 48
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 61920
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1097859072
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTF4 1098907648
+ARGF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 61936
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 64
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 61924
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 Item_ListBox_ThumbDrawPosition
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 72
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1065353216
+SUBF4
+LEF4 $1962
+ADDRLP4 32
+ADDRLP4 12
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $1962
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 76
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 80
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+CNSTI4 61940
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1964
+ADDRLP4 88
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1969
+JUMPV
+LABELV $1966
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 DC
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $1970
+ADDRLP4 96
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 104
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 104
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 104
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1970
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+NEI4 $1972
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 100
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 100
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1972
+ADDRLP4 96
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+GEF4 $1974
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1965
+JUMPV
+LABELV $1974
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1967
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1969
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $1966
+ADDRGP4 $1965
+JUMPV
+LABELV $1964
+ADDRLP4 88
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1979
+JUMPV
+LABELV $1976
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $1980
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1985
+JUMPV
+LABELV $1982
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 100
+ADDRGP4 DC
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRP4
+CALLP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $1986
+ADDRLP4 108
+CNSTI4 12
+ADDRLP4 96
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ADDRLP4 108
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ADDF4
+ARGF4
+ADDRLP4 112
+ADDRLP4 108
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $1987
+JUMPV
+LABELV $1986
+ADDRLP4 92
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1988
+ADDRLP4 108
+CNSTI4 12
+ADDRLP4 96
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ADDRLP4 108
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 108
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1988
+LABELV $1987
+LABELV $1983
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1985
+ADDRLP4 96
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+LTI4 $1982
+ADDRGP4 $1981
+JUMPV
+LABELV $1980
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 96
+ADDRGP4 DC
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRP4
+CALLP4
+ASGNP4
+ADDRLP4 92
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $1990
+ADDRGP4 $1991
+JUMPV
+LABELV $1990
+ADDRLP4 92
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1992
+ADDRLP4 16
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1992
+LABELV $1991
+LABELV $1981
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+NEI4 $1994
+ADDRLP4 96
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1994
+ADDRLP4 96
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 20
+INDIRF4
+ADDRLP4 96
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 96
+INDIRP4
+INDIRF4
+GEF4 $1996
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $1978
+JUMPV
+LABELV $1996
+ADDRLP4 100
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1977
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1979
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $1976
+LABELV $1978
+LABELV $1965
+LABELV $1947
+LABELV $1945
+endproc Item_ListBox_Paint 116 32
+export Item_OwnerDraw_Paint
+proc Item_OwnerDraw_Paint 64 56
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1999
+ADDRGP4 $1998
+JUMPV
+LABELV $1999
+ADDRGP4 DC
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2001
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Fade
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2003
+ADDRGP4 DC
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2003
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 DC
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRP4
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2008
+JUMPV
+LABELV $2005
+ADDRLP4 60
+CNSTI4 24
+ADDRLP4 44
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 60
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+LTF4 $2009
+ADDRLP4 48
+INDIRF4
+ADDRLP4 60
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+GTF4 $2009
+ADDRLP4 0
+ARGP4
+CNSTI4 24
+ADDRLP4 44
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $2007
+JUMPV
+LABELV $2009
+LABELV $2006
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2008
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+LTI4 $2005
+LABELV $2007
+LABELV $2003
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2011
+ADDRLP4 44
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 20
+ADDRLP4 44
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 1061997773
+ADDRLP4 16
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1061997773
+ADDRLP4 16
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 228
+ADDP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 52
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+ADDRGP4 $2012
+JUMPV
+LABELV $2011
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+NEI4 $2016
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CNSTI4 200
+DIVI4
+ADDRLP4 44
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $2016
+ADDRLP4 48
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 20
+ADDRLP4 48
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 48
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20+12
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1117126656
+DIVF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 56
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ARGF4
+ADDRGP4 LerpColor
+CALLV
+pop
+LABELV $2016
+LABELV $2012
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $2021
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 52
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $2021
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 244
+ADDP4
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $2021
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2023
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2025
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $2024
+JUMPV
+LABELV $2025
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 0
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $2024
+JUMPV
+LABELV $2023
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2024
+LABELV $2001
+LABELV $1998
+endproc Item_OwnerDraw_Paint 64 56
+export Item_Paint
+proc Item_Paint 88 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2031
+ADDRGP4 $2027
+JUMPV
+LABELV $2031
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $2033
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+LEI4 $2035
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 68
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 68
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 68
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1029076816
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 76
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_UpdatePosition
+CALLV
+pop
+LABELV $2035
+LABELV $2033
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $2037
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+LEI4 $2039
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEF4 $2041
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2042
+JUMPV
+LABELV $2041
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+GEF4 $2043
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+LEF4 $2044
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2044
+JUMPV
+LABELV $2043
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+GEF4 $2047
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2047
+LABELV $2044
+LABELV $2042
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEF4 $2049
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2050
+JUMPV
+LABELV $2049
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+GEF4 $2051
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+LEF4 $2052
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2052
+JUMPV
+LABELV $2051
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+GEF4 $2055
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2055
+LABELV $2052
+LABELV $2050
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+NEF4 $2057
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2058
+JUMPV
+LABELV $2057
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+GEF4 $2059
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+LEF4 $2060
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2060
+JUMPV
+LABELV $2059
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+GEF4 $2063
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2063
+LABELV $2060
+LABELV $2058
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+NEF4 $2065
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2066
+JUMPV
+LABELV $2065
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+GEF4 $2067
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+LEF4 $2068
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2068
+JUMPV
+LABELV $2067
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+GEF4 $2071
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2071
+LABELV $2068
+LABELV $2066
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_UpdatePosition
+CALLV
+pop
+ADDRLP4 32
+INDIRI4
+CNSTI4 4
+NEI4 $2073
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+LABELV $2073
+LABELV $2039
+LABELV $2037
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2075
+ADDRGP4 DC
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2075
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 DC
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $2077
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+ADDRGP4 $2078
+JUMPV
+LABELV $2077
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $2078
+LABELV $2075
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 12
+BANDI4
+CNSTI4 0
+EQI4 $2079
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 32
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $2081
+ADDRGP4 $2027
+JUMPV
+LABELV $2081
+LABELV $2079
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 8388608
+BANDI4
+CNSTI4 0
+EQI4 $2083
+LABELV $2083
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $2085
+ADDRGP4 $2027
+JUMPV
+LABELV $2085
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 Window_Paint
+CALLV
+pop
+ADDRGP4 debugMode
+INDIRI4
+CNSTI4 0
+EQI4 $2087
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 Item_CorrectedTextRect
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 60
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 40+12
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 40+4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 40+8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 40
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2087
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $2093
+ADDRLP4 36
+INDIRI4
+CNSTI4 13
+GTI4 $2093
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2107
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2107
+address $2096
+address $2096
+address $2093
+address $2093
+address $2099
+address $2093
+address $2101
+address $2102
+address $2095
+address $2099
+address $2106
+address $2103
+address $2104
+address $2105
+code
+LABELV $2095
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_OwnerDraw_Paint
+CALLV
+pop
+ADDRGP4 $2093
+JUMPV
+LABELV $2096
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Text_Paint
+CALLV
+pop
+ADDRGP4 $2093
+JUMPV
+LABELV $2099
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_TextField_Paint
+CALLV
+pop
+ADDRGP4 $2093
+JUMPV
+LABELV $2101
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ListBox_Paint
+CALLV
+pop
+ADDRGP4 $2093
+JUMPV
+LABELV $2102
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Model_Paint
+CALLV
+pop
+ADDRGP4 $2093
+JUMPV
+LABELV $2103
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_YesNo_Paint
+CALLV
+pop
+ADDRGP4 $2093
+JUMPV
+LABELV $2104
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Multi_Paint
+CALLV
+pop
+ADDRGP4 $2093
+JUMPV
+LABELV $2105
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Bind_Paint
+CALLV
+pop
+ADDRGP4 $2093
+JUMPV
+LABELV $2106
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_Slider_Paint
+CALLV
+pop
+LABELV $2093
+LABELV $2027
+endproc Item_Paint 88 24
+export Menu_Init
+proc Menu_Init 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 656
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 61988
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 61980
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 61984
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_Init
+CALLV
+pop
+LABELV $2108
+endproc Menu_Init 0 12
+export Menu_GetFocusedItem
+proc Menu_GetFocusedItem 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2110
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2115
+JUMPV
+LABELV $2112
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $2116
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $2109
+JUMPV
+LABELV $2116
+LABELV $2113
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2115
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $2112
+LABELV $2110
+CNSTP4 0
+RETP4
+LABELV $2109
+endproc Menu_GetFocusedItem 8 0
+export Menu_GetFocused
+proc Menu_GetFocused 12 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2122
+JUMPV
+LABELV $2119
+ADDRLP4 4
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $2123
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $2123
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+RETP4
+ADDRGP4 $2118
+JUMPV
+LABELV $2123
+LABELV $2120
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2122
+ADDRLP4 0
+INDIRI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104120
+ADDP4
+INDIRI4
+LTI4 $2119
+CNSTP4 0
+RETP4
+LABELV $2118
+endproc Menu_GetFocused 12 0
+export Menu_ScrollFeeder
+proc Menu_ScrollFeeder 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2126
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2131
+JUMPV
+LABELV $2128
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+NEF4 $2132
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2135
+ADDRLP4 4
+CNSTI4 132
+ASGNI4
+ADDRGP4 $2136
+JUMPV
+LABELV $2135
+ADDRLP4 4
+CNSTI4 131
+ASGNI4
+LABELV $2136
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Item_ListBox_HandleKey
+CALLI4
+pop
+ADDRGP4 $2125
+JUMPV
+LABELV $2132
+LABELV $2129
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2131
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $2128
+LABELV $2126
+LABELV $2125
+endproc Menu_ScrollFeeder 12 16
+export Menu_SetFeederSelection
+proc Menu_SetFeederSelection 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2138
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2140
+ADDRLP4 0
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $2141
+JUMPV
+LABELV $2140
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Menus_FindByName
+CALLP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $2141
+LABELV $2138
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2142
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2147
+JUMPV
+LABELV $2144
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+NEF4 $2148
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+NEI4 $2150
+ADDRGP4 $2137
+JUMPV
+LABELV $2150
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Item_ListBox_SetSelection
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $2137
+JUMPV
+LABELV $2148
+LABELV $2145
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2147
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $2144
+LABELV $2142
+LABELV $2137
+endproc Menu_SetFeederSelection 8 8
+export Menu_SetScreenPlacement
+proc Menu_SetScreenPlacement 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2153
+ADDRGP4 $2152
+JUMPV
+LABELV $2153
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $2152
+endproc Menu_SetScreenPlacement 0 0
+export Menus_AnyFullScreenVisible
+proc Menus_AnyFullScreenVisible 12 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2159
+JUMPV
+LABELV $2156
+ADDRLP4 4
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 8
+INDIRI4
+EQI4 $2160
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $2160
+CNSTI4 1
+RETI4
+ADDRGP4 $2155
+JUMPV
+LABELV $2160
+LABELV $2157
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2159
+ADDRLP4 0
+INDIRI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104120
+ADDP4
+INDIRI4
+LTI4 $2156
+CNSTI4 0
+RETI4
+LABELV $2155
+endproc Menus_AnyFullScreenVisible 12 0
+export Menus_ActivateByName
+proc Menus_ActivateByName 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2166
+JUMPV
+LABELV $2163
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2167
+ADDRLP4 4
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Menus_Activate
+CALLV
+pop
+ADDRGP4 $2168
+JUMPV
+LABELV $2167
+ADDRLP4 12
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $2168
+LABELV $2164
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2166
+ADDRLP4 0
+INDIRI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104120
+ADDP4
+INDIRI4
+LTI4 $2163
+ADDRGP4 Display_CloseCinematics
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $2162
+endproc Menus_ActivateByName 16 8
+export Item_Init
+proc Item_Init 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2170
+ADDRGP4 $2169
+JUMPV
+LABELV $2170
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 540
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+CNSTF4 1057803469
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_Init
+CALLV
+pop
+LABELV $2169
+endproc Item_Init 0 12
+export Menu_HandleMouseMove
+proc Menu_HandleMouseMove 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2173
+ADDRGP4 $2172
+JUMPV
+LABELV $2173
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1048580
+BANDI4
+CNSTI4 0
+NEI4 $2175
+ADDRGP4 $2172
+JUMPV
+LABELV $2175
+ADDRGP4 itemCapture
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2177
+ADDRGP4 $2172
+JUMPV
+LABELV $2177
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_waitingForKey
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $2181
+ADDRGP4 g_editingField
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $2179
+LABELV $2181
+ADDRGP4 $2172
+JUMPV
+LABELV $2179
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $2182
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2189
+JUMPV
+LABELV $2186
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1048580
+BANDI4
+CNSTI4 0
+NEI4 $2190
+ADDRGP4 $2187
+JUMPV
+LABELV $2190
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $2192
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $2192
+ADDRGP4 $2187
+JUMPV
+LABELV $2192
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 12
+BANDI4
+CNSTI4 0
+EQI4 $2194
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 32
+ADDRGP4 Item_EnableShowViaCvar
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $2194
+ADDRGP4 $2187
+JUMPV
+LABELV $2194
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $2196
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $2197
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2200
+ADDRLP4 4
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2200
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Item_CorrectedTextRect
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $2202
+ADDRGP4 $2187
+JUMPV
+LABELV $2202
+LABELV $2200
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 IsVisible
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $2197
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRGP4 Item_MouseEnter
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2197
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 Item_SetFocus
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $2197
+JUMPV
+LABELV $2196
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2208
+ADDRLP4 40
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $2208
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_MouseLeave
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 Item_SetMouseOver
+CALLV
+pop
+LABELV $2208
+LABELV $2197
+LABELV $2187
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2189
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $2186
+LABELV $2183
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LTI4 $2182
+LABELV $2172
+endproc Menu_HandleMouseMove 52 12
+export Menu_Paint
+proc Menu_Paint 48 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2211
+ADDRGP4 $2210
+JUMPV
+LABELV $2211
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2213
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $2213
+ADDRGP4 $2210
+JUMPV
+LABELV $2213
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2215
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2215
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $2215
+ADDRGP4 $2210
+JUMPV
+LABELV $2215
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2217
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1048576
+BORI4
+ASGNI4
+LABELV $2217
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2219
+ADDRFP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2219
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2221
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $2222
+JUMPV
+LABELV $2221
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2223
+LABELV $2223
+LABELV $2222
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 Window_Paint
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2228
+JUMPV
+LABELV $2225
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Paint
+CALLV
+pop
+LABELV $2226
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2228
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $2225
+ADDRGP4 debugMode
+INDIRI4
+CNSTI4 0
+EQI4 $2229
+ADDRLP4 40
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+12
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 24
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2229
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2234
+ADDRGP4 DC
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2234
+LABELV $2210
+endproc Menu_Paint 48 24
+export Item_ValidateTypeData
+proc Item_ValidateTypeData 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2237
+ADDRGP4 $2236
+JUMPV
+LABELV $2237
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $2239
+CNSTI4 232
+ARGI4
+ADDRLP4 0
+ADDRGP4 UI_Alloc_ui_shared
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 232
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $2240
+JUMPV
+LABELV $2239
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+EQI4 $2247
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+EQI4 $2247
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+EQI4 $2247
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+EQI4 $2247
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $2247
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2241
+LABELV $2247
+CNSTI4 28
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Alloc_ui_shared
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 28
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2242
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2242
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 256
+ASGNI4
+ADDRGP4 $2242
+JUMPV
+LABELV $2241
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $2252
+CNSTI4 396
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Alloc_ui_shared
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $2253
+JUMPV
+LABELV $2252
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $2254
+CNSTI4 28
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Alloc_ui_shared
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $2254
+LABELV $2253
+LABELV $2242
+LABELV $2240
+LABELV $2236
+endproc Item_ValidateTypeData 8 12
+export KeywordHash_Key
+proc KeywordHash_Key 24 0
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $2260
+JUMPV
+LABELV $2257
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 65
+LTI4 $2261
+ADDRLP4 12
+INDIRI4
+CNSTI4 90
+GTI4 $2261
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+ADDI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 119
+ADDI4
+MULI4
+ADDI4
+ASGNI4
+ADDRGP4 $2262
+JUMPV
+LABELV $2261
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+CNSTI4 119
+ADDI4
+MULI4
+ADDI4
+ASGNI4
+LABELV $2262
+LABELV $2258
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2260
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $2257
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+RSHI4
+BXORI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 20
+RSHI4
+BXORI4
+CNSTI4 511
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $2256
+endproc KeywordHash_Key 24 0
+export KeywordHash_Add
+proc KeywordHash_Add 8 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 KeywordHash_Key
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $2263
+endproc KeywordHash_Add 8 4
+export KeywordHash_Find
+proc KeywordHash_Find 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 KeywordHash_Key
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $2268
+JUMPV
+LABELV $2265
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2269
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $2264
+JUMPV
+LABELV $2269
+LABELV $2266
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $2268
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2265
+CNSTP4 0
+RETP4
+LABELV $2264
+endproc KeywordHash_Find 16 8
+export ItemParse_name
+proc ItemParse_name 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2272
+CNSTI4 0
+RETI4
+ADDRGP4 $2271
+JUMPV
+LABELV $2272
+CNSTI4 1
+RETI4
+LABELV $2271
+endproc ItemParse_name 4 8
+export ItemParse_focusSound
+proc ItemParse_focusSound 12 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2275
+CNSTI4 0
+RETI4
+ADDRGP4 $2274
+JUMPV
+LABELV $2275
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2274
+endproc ItemParse_focusSound 12 8
+export ItemParse_text
+proc ItemParse_text 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2278
+CNSTI4 0
+RETI4
+ADDRGP4 $2277
+JUMPV
+LABELV $2278
+CNSTI4 1
+RETI4
+LABELV $2277
+endproc ItemParse_text 4 8
+export ItemParse_group
+proc ItemParse_group 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2281
+CNSTI4 0
+RETI4
+ADDRGP4 $2280
+JUMPV
+LABELV $2281
+CNSTI4 1
+RETI4
+LABELV $2280
+endproc ItemParse_group 4 8
+export ItemParse_asset_model
+proc ItemParse_asset_model 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2284
+CNSTI4 0
+RETI4
+ADDRGP4 $2283
+JUMPV
+LABELV $2284
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 360
+MODI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2283
+endproc ItemParse_asset_model 20 8
+export ItemParse_asset_shader
+proc ItemParse_asset_shader 12 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2287
+CNSTI4 0
+RETI4
+ADDRGP4 $2286
+JUMPV
+LABELV $2287
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2286
+endproc ItemParse_asset_shader 12 8
+export ItemParse_model_origin
+proc ItemParse_model_origin 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2290
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2292
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2294
+CNSTI4 1
+RETI4
+ADDRGP4 $2289
+JUMPV
+LABELV $2294
+LABELV $2292
+LABELV $2290
+CNSTI4 0
+RETI4
+LABELV $2289
+endproc ItemParse_model_origin 16 8
+export ItemParse_model_fovx
+proc ItemParse_model_fovx 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2297
+CNSTI4 0
+RETI4
+ADDRGP4 $2296
+JUMPV
+LABELV $2297
+CNSTI4 1
+RETI4
+LABELV $2296
+endproc ItemParse_model_fovx 8 8
+export ItemParse_model_fovy
+proc ItemParse_model_fovy 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2300
+CNSTI4 0
+RETI4
+ADDRGP4 $2299
+JUMPV
+LABELV $2300
+CNSTI4 1
+RETI4
+LABELV $2299
+endproc ItemParse_model_fovy 8 8
+export ItemParse_model_rotation
+proc ItemParse_model_rotation 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2303
+CNSTI4 0
+RETI4
+ADDRGP4 $2302
+JUMPV
+LABELV $2303
+CNSTI4 1
+RETI4
+LABELV $2302
+endproc ItemParse_model_rotation 8 8
+export ItemParse_model_angle
+proc ItemParse_model_angle 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2306
+CNSTI4 0
+RETI4
+ADDRGP4 $2305
+JUMPV
+LABELV $2306
+CNSTI4 1
+RETI4
+LABELV $2305
+endproc ItemParse_model_angle 8 8
+export ItemParse_rect
+proc ItemParse_rect 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Rect_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2309
+CNSTI4 0
+RETI4
+ADDRGP4 $2308
+JUMPV
+LABELV $2309
+CNSTI4 1
+RETI4
+LABELV $2308
+endproc ItemParse_rect 4 8
+export ItemParse_style
+proc ItemParse_style 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2312
+CNSTI4 0
+RETI4
+ADDRGP4 $2311
+JUMPV
+LABELV $2312
+CNSTI4 1
+RETI4
+LABELV $2311
+endproc ItemParse_style 4 8
+export ItemParse_decoration
+proc ItemParse_decoration 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2314
+endproc ItemParse_decoration 4 0
+export ItemParse_notselectable
+proc ItemParse_notselectable 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $2316
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2316
+ADDRLP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $2316
+CNSTI4 1
+RETI4
+LABELV $2315
+endproc ItemParse_notselectable 4 4
+export ItemParse_wrapped
+proc ItemParse_wrapped 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 262144
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2318
+endproc ItemParse_wrapped 4 0
+export ItemParse_autowrapped
+proc ItemParse_autowrapped 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 524288
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2319
+endproc ItemParse_autowrapped 4 0
+export ItemParse_horizontalscroll
+proc ItemParse_horizontalscroll 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2320
+endproc ItemParse_horizontalscroll 4 0
+export ItemParse_type
+proc ItemParse_type 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2322
+CNSTI4 0
+RETI4
+ADDRGP4 $2321
+JUMPV
+LABELV $2322
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $2321
+endproc ItemParse_type 4 8
+export ItemParse_elementwidth
+proc ItemParse_elementwidth 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2325
+CNSTI4 0
+RETI4
+ADDRGP4 $2324
+JUMPV
+LABELV $2325
+CNSTI4 1
+RETI4
+LABELV $2324
+endproc ItemParse_elementwidth 8 8
+export ItemParse_elementheight
+proc ItemParse_elementheight 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2328
+CNSTI4 0
+RETI4
+ADDRGP4 $2327
+JUMPV
+LABELV $2328
+CNSTI4 1
+RETI4
+LABELV $2327
+endproc ItemParse_elementheight 8 8
+export ItemParse_feeder
+proc ItemParse_feeder 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2331
+CNSTI4 0
+RETI4
+ADDRGP4 $2330
+JUMPV
+LABELV $2331
+CNSTI4 1
+RETI4
+LABELV $2330
+endproc ItemParse_feeder 4 8
+export ItemParse_elementtype
+proc ItemParse_elementtype 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2334
+CNSTI4 0
+RETI4
+ADDRGP4 $2333
+JUMPV
+LABELV $2334
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2336
+CNSTI4 0
+RETI4
+ADDRGP4 $2333
+JUMPV
+LABELV $2336
+CNSTI4 1
+RETI4
+LABELV $2333
+endproc ItemParse_elementtype 8 8
+export ItemParse_columns
+proc ItemParse_columns 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2339
+CNSTI4 0
+RETI4
+ADDRGP4 $2338
+JUMPV
+LABELV $2339
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2341
+ADDRLP4 8
+INDIRI4
+CNSTI4 16
+LEI4 $2343
+ADDRLP4 8
+CNSTI4 16
+ASGNI4
+LABELV $2343
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2348
+JUMPV
+LABELV $2345
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2349
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $2349
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $2349
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $2350
+JUMPV
+LABELV $2349
+CNSTI4 0
+RETI4
+ADDRGP4 $2338
+JUMPV
+LABELV $2350
+LABELV $2346
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2348
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $2345
+ADDRGP4 $2342
+JUMPV
+LABELV $2341
+CNSTI4 0
+RETI4
+ADDRGP4 $2338
+JUMPV
+LABELV $2342
+CNSTI4 1
+RETI4
+LABELV $2338
+endproc ItemParse_columns 40 8
+export ItemParse_border
+proc ItemParse_border 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2352
+CNSTI4 0
+RETI4
+ADDRGP4 $2351
+JUMPV
+LABELV $2352
+CNSTI4 1
+RETI4
+LABELV $2351
+endproc ItemParse_border 4 8
+export ItemParse_bordersize
+proc ItemParse_bordersize 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2355
+CNSTI4 0
+RETI4
+ADDRGP4 $2354
+JUMPV
+LABELV $2355
+CNSTI4 1
+RETI4
+LABELV $2354
+endproc ItemParse_bordersize 4 8
+export ItemParse_visible
+proc ItemParse_visible 12 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2358
+CNSTI4 0
+RETI4
+ADDRGP4 $2357
+JUMPV
+LABELV $2358
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2360
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $2360
+CNSTI4 1
+RETI4
+LABELV $2357
+endproc ItemParse_visible 12 8
+export ItemParse_ownerdraw
+proc ItemParse_ownerdraw 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2363
+CNSTI4 0
+RETI4
+ADDRGP4 $2362
+JUMPV
+LABELV $2363
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTI4 8
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2362
+endproc ItemParse_ownerdraw 4 8
+export ItemParse_align
+proc ItemParse_align 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2366
+CNSTI4 0
+RETI4
+ADDRGP4 $2365
+JUMPV
+LABELV $2366
+CNSTI4 1
+RETI4
+LABELV $2365
+endproc ItemParse_align 4 8
+export ItemParse_textalign
+proc ItemParse_textalign 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2369
+CNSTI4 0
+RETI4
+ADDRGP4 $2368
+JUMPV
+LABELV $2369
+CNSTI4 1
+RETI4
+LABELV $2368
+endproc ItemParse_textalign 4 8
+export ItemParse_textalignx
+proc ItemParse_textalignx 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2372
+CNSTI4 0
+RETI4
+ADDRGP4 $2371
+JUMPV
+LABELV $2372
+CNSTI4 1
+RETI4
+LABELV $2371
+endproc ItemParse_textalignx 4 8
+export ItemParse_textaligny
+proc ItemParse_textaligny 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2375
+CNSTI4 0
+RETI4
+ADDRGP4 $2374
+JUMPV
+LABELV $2375
+CNSTI4 1
+RETI4
+LABELV $2374
+endproc ItemParse_textaligny 4 8
+export ItemParse_textscale
+proc ItemParse_textscale 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2378
+CNSTI4 0
+RETI4
+ADDRGP4 $2377
+JUMPV
+LABELV $2378
+CNSTI4 1
+RETI4
+LABELV $2377
+endproc ItemParse_textscale 4 8
+export ItemParse_textstyle
+proc ItemParse_textstyle 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2381
+CNSTI4 0
+RETI4
+ADDRGP4 $2380
+JUMPV
+LABELV $2381
+CNSTI4 1
+RETI4
+LABELV $2380
+endproc ItemParse_textstyle 4 8
+export ItemParse_backcolor
+proc ItemParse_backcolor 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2384
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2388
+CNSTI4 0
+RETI4
+ADDRGP4 $2383
+JUMPV
+LABELV $2388
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2385
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2384
+CNSTI4 1
+RETI4
+LABELV $2383
+endproc ItemParse_backcolor 12 8
+export ItemParse_forecolor
+proc ItemParse_forecolor 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2391
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2395
+CNSTI4 0
+RETI4
+ADDRGP4 $2390
+JUMPV
+LABELV $2395
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $2392
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2391
+CNSTI4 1
+RETI4
+LABELV $2390
+endproc ItemParse_forecolor 16 8
+export ItemParse_bordercolor
+proc ItemParse_bordercolor 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2398
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2402
+CNSTI4 0
+RETI4
+ADDRGP4 $2397
+JUMPV
+LABELV $2402
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2399
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2398
+CNSTI4 1
+RETI4
+LABELV $2397
+endproc ItemParse_bordercolor 12 8
+export ItemParse_outlinecolor
+proc ItemParse_outlinecolor 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2405
+CNSTI4 0
+RETI4
+ADDRGP4 $2404
+JUMPV
+LABELV $2405
+CNSTI4 1
+RETI4
+LABELV $2404
+endproc ItemParse_outlinecolor 4 8
+export ItemParse_background
+proc ItemParse_background 12 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2408
+CNSTI4 0
+RETI4
+ADDRGP4 $2407
+JUMPV
+LABELV $2408
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2407
+endproc ItemParse_background 12 8
+export ItemParse_cinematic
+proc ItemParse_cinematic 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2411
+CNSTI4 0
+RETI4
+ADDRGP4 $2410
+JUMPV
+LABELV $2411
+CNSTI4 1
+RETI4
+LABELV $2410
+endproc ItemParse_cinematic 4 8
+export ItemParse_doubleClick
+proc ItemParse_doubleClick 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2414
+CNSTI4 0
+RETI4
+ADDRGP4 $2413
+JUMPV
+LABELV $2414
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_CompiledScript_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2416
+CNSTI4 0
+RETI4
+ADDRGP4 $2413
+JUMPV
+LABELV $2416
+CNSTI4 1
+RETI4
+LABELV $2413
+endproc ItemParse_doubleClick 8 8
+export ItemParse_onFocus
+proc ItemParse_onFocus 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_CompiledScript_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2419
+CNSTI4 0
+RETI4
+ADDRGP4 $2418
+JUMPV
+LABELV $2419
+CNSTI4 1
+RETI4
+LABELV $2418
+endproc ItemParse_onFocus 4 8
+export ItemParse_leaveFocus
+proc ItemParse_leaveFocus 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_CompiledScript_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2422
+CNSTI4 0
+RETI4
+ADDRGP4 $2421
+JUMPV
+LABELV $2422
+CNSTI4 1
+RETI4
+LABELV $2421
+endproc ItemParse_leaveFocus 4 8
+export ItemParse_mouseEnter
+proc ItemParse_mouseEnter 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 244
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_CompiledScript_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2425
+CNSTI4 0
+RETI4
+ADDRGP4 $2424
+JUMPV
+LABELV $2425
+CNSTI4 1
+RETI4
+LABELV $2424
+endproc ItemParse_mouseEnter 4 8
+export ItemParse_mouseExit
+proc ItemParse_mouseExit 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_CompiledScript_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2428
+CNSTI4 0
+RETI4
+ADDRGP4 $2427
+JUMPV
+LABELV $2428
+CNSTI4 1
+RETI4
+LABELV $2427
+endproc ItemParse_mouseExit 4 8
+export ItemParse_mouseEnterText
+proc ItemParse_mouseEnterText 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_CompiledScript_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2431
+CNSTI4 0
+RETI4
+ADDRGP4 $2430
+JUMPV
+LABELV $2431
+CNSTI4 1
+RETI4
+LABELV $2430
+endproc ItemParse_mouseEnterText 4 8
+export ItemParse_mouseExitText
+proc ItemParse_mouseExitText 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_CompiledScript_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2434
+CNSTI4 0
+RETI4
+ADDRGP4 $2433
+JUMPV
+LABELV $2434
+CNSTI4 1
+RETI4
+LABELV $2433
+endproc ItemParse_mouseExitText 4 8
+export ItemParse_action
+proc ItemParse_action 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 252
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_CompiledScript_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2437
+CNSTI4 0
+RETI4
+ADDRGP4 $2436
+JUMPV
+LABELV $2437
+CNSTI4 1
+RETI4
+LABELV $2436
+endproc ItemParse_action 4 8
+export ItemParse_special
+proc ItemParse_special 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2440
+CNSTI4 0
+RETI4
+ADDRGP4 $2439
+JUMPV
+LABELV $2440
+CNSTI4 1
+RETI4
+LABELV $2439
+endproc ItemParse_special 4 8
+export ItemParse_cvarTest
+proc ItemParse_cvarTest 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2443
+CNSTI4 0
+RETI4
+ADDRGP4 $2442
+JUMPV
+LABELV $2443
+CNSTI4 1
+RETI4
+LABELV $2442
+endproc ItemParse_cvarTest 4 8
+export ItemParse_cvar
+proc ItemParse_cvar 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2446
+CNSTI4 0
+RETI4
+ADDRGP4 $2445
+JUMPV
+LABELV $2446
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2448
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+LABELV $2448
+CNSTI4 1
+RETI4
+LABELV $2445
+endproc ItemParse_cvar 8 8
+export ItemParse_maxChars
+proc ItemParse_maxChars 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2451
+CNSTI4 0
+RETI4
+ADDRGP4 $2450
+JUMPV
+LABELV $2451
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2453
+CNSTI4 0
+RETI4
+ADDRGP4 $2450
+JUMPV
+LABELV $2453
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2450
+endproc ItemParse_maxChars 12 8
+export ItemParse_maxPaintChars
+proc ItemParse_maxPaintChars 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2456
+CNSTI4 0
+RETI4
+ADDRGP4 $2455
+JUMPV
+LABELV $2456
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2458
+CNSTI4 0
+RETI4
+ADDRGP4 $2455
+JUMPV
+LABELV $2458
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2455
+endproc ItemParse_maxPaintChars 12 8
+export ItemParse_cvarFloat
+proc ItemParse_cvarFloat 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2461
+CNSTI4 0
+RETI4
+ADDRGP4 $2460
+JUMPV
+LABELV $2461
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2463
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2463
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2463
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $2463
+CNSTI4 1
+RETI4
+ADDRGP4 $2460
+JUMPV
+LABELV $2463
+CNSTI4 0
+RETI4
+LABELV $2460
+endproc ItemParse_cvarFloat 20 8
+export ItemParse_cvarStrList
+proc ItemParse_cvarStrList 1068 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2466
+CNSTI4 0
+RETI4
+ADDRGP4 $2465
+JUMPV
+LABELV $2466
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 388
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 392
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $2468
+CNSTI4 0
+RETI4
+ADDRGP4 $2465
+JUMPV
+LABELV $2468
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $2470
+CNSTI4 0
+RETI4
+ADDRGP4 $2465
+JUMPV
+LABELV $2470
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2474
+JUMPV
+LABELV $2473
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $2476
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2478
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2465
+JUMPV
+LABELV $2476
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $2479
+CNSTI4 1
+RETI4
+ADDRGP4 $2465
+JUMPV
+LABELV $2479
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 44
+EQI4 $2486
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 59
+NEI4 $2482
+LABELV $2486
+ADDRGP4 $2474
+JUMPV
+LABELV $2482
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $2487
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1056
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1040
+INDIRP4
+ADDP4
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2488
+JUMPV
+LABELV $2487
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1056
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ADDRLP4 1064
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1040
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2491
+CNSTI4 0
+RETI4
+ADDRGP4 $2465
+JUMPV
+LABELV $2491
+LABELV $2488
+LABELV $2474
+ADDRGP4 $2473
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $2465
+endproc ItemParse_cvarStrList 1068 8
+export ItemParse_cvarFloatList
+proc ItemParse_cvarFloatList 1072 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Item_ValidateTypeData
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2494
+CNSTI4 0
+RETI4
+ADDRGP4 $2493
+JUMPV
+LABELV $2494
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 388
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 392
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $2496
+CNSTI4 0
+RETI4
+ADDRGP4 $2493
+JUMPV
+LABELV $2496
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $2502
+CNSTI4 0
+RETI4
+ADDRGP4 $2493
+JUMPV
+LABELV $2501
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $2504
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2478
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2493
+JUMPV
+LABELV $2504
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $2506
+CNSTI4 1
+RETI4
+ADDRGP4 $2493
+JUMPV
+LABELV $2506
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 44
+EQI4 $2513
+ADDRLP4 4+16
+INDIRI1
+CVII4 1
+CNSTI4 59
+NEI4 $2509
+LABELV $2513
+ADDRGP4 $2502
+JUMPV
+LABELV $2509
+ADDRLP4 4+16
+ARGP4
+ADDRLP4 1052
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $2515
+CNSTI4 0
+RETI4
+ADDRGP4 $2493
+JUMPV
+LABELV $2515
+ADDRLP4 1068
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+ASGNP4
+ADDRLP4 1068
+INDIRP4
+ADDRLP4 1068
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2517
+CNSTI4 0
+RETI4
+ADDRGP4 $2493
+JUMPV
+LABELV $2517
+LABELV $2502
+ADDRGP4 $2501
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $2493
+endproc ItemParse_cvarFloatList 1072 8
+export ItemParse_addColorRange
+proc ItemParse_addColorRange 44 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 24
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $2520
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0+20
+ARGP4
+ADDRLP4 28
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $2520
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $2520
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+CNSTI4 10
+GEI4 $2524
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTI4 24
+ADDRLP4 36
+INDIRP4
+CNSTI4 284
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 288
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTU4 24
+ARGU4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2524
+CNSTI4 1
+RETI4
+ADDRGP4 $2519
+JUMPV
+LABELV $2520
+CNSTI4 0
+RETI4
+LABELV $2519
+endproc ItemParse_addColorRange 44 12
+export ItemParse_ownerdrawFlag
+proc ItemParse_ownerdrawFlag 12 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2527
+CNSTI4 0
+RETI4
+ADDRGP4 $2526
+JUMPV
+LABELV $2527
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2526
+endproc ItemParse_ownerdrawFlag 12 8
+export ItemParse_enableCvar
+proc ItemParse_enableCvar 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2530
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2529
+JUMPV
+LABELV $2530
+CNSTI4 0
+RETI4
+LABELV $2529
+endproc ItemParse_enableCvar 4 8
+export ItemParse_disableCvar
+proc ItemParse_disableCvar 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2533
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+CNSTI4 2
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2532
+JUMPV
+LABELV $2533
+CNSTI4 0
+RETI4
+LABELV $2532
+endproc ItemParse_disableCvar 4 8
+export ItemParse_showCvar
+proc ItemParse_showCvar 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2536
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+CNSTI4 4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2535
+JUMPV
+LABELV $2536
+CNSTI4 0
+RETI4
+LABELV $2535
+endproc ItemParse_showCvar 4 8
+export ItemParse_hideCvar
+proc ItemParse_hideCvar 4 8
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 PC_Script_Parse
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2539
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+CNSTI4 8
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2538
+JUMPV
+LABELV $2539
+CNSTI4 0
+RETI4
+LABELV $2538
+endproc ItemParse_hideCvar 4 8
+data
+export itemParseKeywords
+align 4
+LABELV itemParseKeywords
+address $2541
+address ItemParse_name
+byte 4 0
+address $2542
+address ItemParse_text
+byte 4 0
+address $2543
+address ItemParse_group
+byte 4 0
+address $2544
+address ItemParse_asset_model
+byte 4 0
+address $2545
+address ItemParse_asset_shader
+byte 4 0
+address $2546
+address ItemParse_model_origin
+byte 4 0
+address $2547
+address ItemParse_model_fovx
+byte 4 0
+address $2548
+address ItemParse_model_fovy
+byte 4 0
+address $2549
+address ItemParse_model_rotation
+byte 4 0
+address $2550
+address ItemParse_model_angle
+byte 4 0
+address $2551
+address ItemParse_rect
+byte 4 0
+address $2552
+address ItemParse_style
+byte 4 0
+address $2553
+address ItemParse_decoration
+byte 4 0
+address $2554
+address ItemParse_notselectable
+byte 4 0
+address $2555
+address ItemParse_wrapped
+byte 4 0
+address $2556
+address ItemParse_autowrapped
+byte 4 0
+address $2557
+address ItemParse_horizontalscroll
+byte 4 0
+address $2558
+address ItemParse_type
+byte 4 0
+address $2559
+address ItemParse_elementwidth
+byte 4 0
+address $2560
+address ItemParse_elementheight
+byte 4 0
+address $2561
+address ItemParse_feeder
+byte 4 0
+address $2562
+address ItemParse_elementtype
+byte 4 0
+address $2563
+address ItemParse_columns
+byte 4 0
+address $2564
+address ItemParse_border
+byte 4 0
+address $2565
+address ItemParse_bordersize
+byte 4 0
+address $2566
+address ItemParse_visible
+byte 4 0
+address $2567
+address ItemParse_ownerdraw
+byte 4 0
+address $2568
+address ItemParse_align
+byte 4 0
+address $2569
+address ItemParse_textalign
+byte 4 0
+address $2570
+address ItemParse_textalignx
+byte 4 0
+address $2571
+address ItemParse_textaligny
+byte 4 0
+address $2572
+address ItemParse_textscale
+byte 4 0
+address $2573
+address ItemParse_textstyle
+byte 4 0
+address $424
+address ItemParse_backcolor
+byte 4 0
+address $427
+address ItemParse_forecolor
+byte 4 0
+address $430
+address ItemParse_bordercolor
+byte 4 0
+address $2574
+address ItemParse_outlinecolor
+byte 4 0
+address $2575
+address ItemParse_background
+byte 4 0
+address $2576
+address ItemParse_onFocus
+byte 4 0
+address $2577
+address ItemParse_leaveFocus
+byte 4 0
+address $2578
+address ItemParse_mouseEnter
+byte 4 0
+address $2579
+address ItemParse_mouseExit
+byte 4 0
+address $2580
+address ItemParse_mouseEnterText
+byte 4 0
+address $2581
+address ItemParse_mouseExitText
+byte 4 0
+address $2582
+address ItemParse_action
+byte 4 0
+address $2583
+address ItemParse_special
+byte 4 0
+address $2584
+address ItemParse_cvar
+byte 4 0
+address $2585
+address ItemParse_maxChars
+byte 4 0
+address $2586
+address ItemParse_maxPaintChars
+byte 4 0
+address $2587
+address ItemParse_focusSound
+byte 4 0
+address $2588
+address ItemParse_cvarFloat
+byte 4 0
+address $2589
+address ItemParse_cvarStrList
+byte 4 0
+address $2590
+address ItemParse_cvarFloatList
+byte 4 0
+address $2591
+address ItemParse_addColorRange
+byte 4 0
+address $2592
+address ItemParse_ownerdrawFlag
+byte 4 0
+address $2593
+address ItemParse_enableCvar
+byte 4 0
+address $2594
+address ItemParse_cvarTest
+byte 4 0
+address $2595
+address ItemParse_disableCvar
+byte 4 0
+address $2596
+address ItemParse_showCvar
+byte 4 0
+address $2597
+address ItemParse_hideCvar
+byte 4 0
+address $2598
+address ItemParse_cinematic
+byte 4 0
+address $2599
+address ItemParse_doubleClick
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export Item_SetupKeywordHash
+code
+proc Item_SetupKeywordHash 4 12
+ADDRGP4 itemParseKeywordHash
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2048
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2604
+JUMPV
+LABELV $2601
+ADDRGP4 itemParseKeywordHash
+ARGP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 itemParseKeywords
+ADDP4
+ARGP4
+ADDRGP4 KeywordHash_Add
+CALLV
+pop
+LABELV $2602
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2604
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 itemParseKeywords
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2601
+LABELV $2600
+endproc Item_SetupKeywordHash 4 12
+data
+align 4
+LABELV builtinResolutions_ui_shared
+address $2605
+address $2606
+address $2607
+address $2608
+address $2609
+address $2610
+address $2611
+address $2612
+address $2613
+address $2614
+address $2615
+address $2616
+byte 4 0
+align 4
+LABELV knownRatios_ui_shared
+address $2617
+address $2618
+address $2619
+address $2620
+address $2621
+address $2622
+address $2623
+address $2624
+address $2625
+address $2626
+address $2627
+address $2628
+address $2629
+address $2630
+byte 4 0
+byte 4 0
+code
+proc UI_ResolutionToAspect 48 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRU4
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 28
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+CNSTU4 8
+GEU4 $2633
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CVIU4 4
+ASGNU4
+ADDRGP4 $2634
+JUMPV
+LABELV $2633
+ADDRLP4 24
+CNSTU4 8
+ASGNU4
+LABELV $2634
+ADDRLP4 24
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRGP4 $2635
+ARGP4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+DIVF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2639
+JUMPV
+LABELV $2636
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios_ui_shared
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $2640
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios_ui_shared+4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $2638
+JUMPV
+LABELV $2640
+LABELV $2637
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2639
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 knownRatios_ui_shared
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2636
+LABELV $2638
+LABELV $2631
+endproc UI_ResolutionToAspect 48 16
+proc Item_ApplyHacks 1164 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2644
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2644
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $2646
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2644
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 48
+GEI4 $2647
+ADDRGP4 $2649
+ARGP4
+ADDRGP4 Com_DPrintf
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 48
+ASGNI4
+LABELV $2647
+LABELV $2644
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $2650
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2650
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $2652
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $2654
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $2653
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $2650
+LABELV $2654
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 32
+GEI4 $2655
+ADDRLP4 32
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+LEI4 $2657
+ADDRLP4 36
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2657
+ADDRGP4 $2659
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Com_DPrintf
+CALLV
+pop
+ADDRLP4 28
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 32
+ASGNI4
+LABELV $2655
+LABELV $2650
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $2660
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2660
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 $1134
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $2660
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDRGP4 $2662
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 388
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 392
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 1116
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+ASGNP4
+ADDRLP4 1112
+ADDRLP4 1116
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 1116
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2663
+ARGP4
+ADDRLP4 88
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 88
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $2664
+ADDRLP4 1124
+ADDRLP4 88
+ASGNP4
+ADDRGP4 $2667
+JUMPV
+LABELV $2666
+ADDRLP4 1120
+ADDRLP4 1124
+INDIRP4
+ASGNP4
+ADDRLP4 1124
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 1132
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1124
+ADDRLP4 1132
+INDIRP4
+ASGNP4
+ADDRLP4 1124
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2669
+ADDRLP4 1136
+ADDRLP4 1124
+INDIRP4
+ASGNP4
+ADDRLP4 1124
+ADDRLP4 1136
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1136
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $2669
+ADDRLP4 1120
+INDIRP4
+ARGP4
+ADDRLP4 80
+ARGP4
+CNSTU4 8
+ARGU4
+ADDRGP4 UI_ResolutionToAspect
+CALLV
+pop
+ADDRLP4 48
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $2671
+ARGP4
+ADDRLP4 1120
+INDIRP4
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 48
+ARGP4
+ADDRLP4 1140
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 44
+INDIRP4
+ADDP4
+ADDRLP4 1140
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2675
+JUMPV
+LABELV $2672
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 builtinResolutions_ui_shared
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1120
+INDIRP4
+ARGP4
+ADDRLP4 1148
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1148
+INDIRI4
+CNSTI4 0
+NEI4 $2676
+ADDRLP4 1156
+CNSTI4 2
+ASGNI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+LSHI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+LSHI4
+ADDRGP4 builtinResolutions_ui_shared
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $2674
+JUMPV
+LABELV $2676
+LABELV $2673
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2675
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 builtinResolutions_ui_shared
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2672
+LABELV $2674
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 builtinResolutions_ui_shared
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2678
+ADDRLP4 1120
+INDIRP4
+ARGP4
+ADDRLP4 1148
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 1148
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+LABELV $2678
+ADDRLP4 1148
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+ASGNP4
+ADDRLP4 1148
+INDIRP4
+ADDRLP4 1148
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2667
+ADDRLP4 1124
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2680
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2666
+LABELV $2680
+ADDRGP4 $2665
+JUMPV
+LABELV $2664
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2684
+JUMPV
+LABELV $2681
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 builtinResolutions_ui_shared
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 80
+ARGP4
+CNSTU4 8
+ARGU4
+ADDRGP4 UI_ResolutionToAspect
+CALLV
+pop
+ADDRLP4 48
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $2671
+ARGP4
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 builtinResolutions_ui_shared
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 48
+ARGP4
+ADDRLP4 1120
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 44
+INDIRP4
+ADDP4
+ADDRLP4 1120
+INDIRP4
+ASGNP4
+ADDRLP4 1132
+CNSTI4 2
+ASGNI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+ADDRLP4 1132
+INDIRI4
+LSHI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 1132
+INDIRI4
+LSHI4
+ADDRGP4 builtinResolutions_ui_shared
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 1140
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+ASGNP4
+ADDRLP4 1140
+INDIRP4
+ADDRLP4 1140
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2682
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2684
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 builtinResolutions_ui_shared
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2685
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $2681
+LABELV $2685
+LABELV $2665
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 32
+GEI4 $2686
+ADDRLP4 1120
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 $2688
+ARGP4
+ADDRGP4 cgs+20100+35880
+INDIRI4
+ARGI4
+ADDRGP4 cgs+20100+35884
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2696
+JUMPV
+LABELV $2693
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1120
+ARGP4
+ADDRLP4 1140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1140
+INDIRI4
+CNSTI4 0
+NEI4 $2697
+ADDRGP4 $2695
+JUMPV
+LABELV $2697
+LABELV $2694
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2696
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+LTI4 $2693
+LABELV $2695
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+NEI4 $2699
+ADDRLP4 1120
+ARGP4
+ADDRLP4 80
+ARGP4
+CNSTU4 8
+ARGU4
+ADDRGP4 UI_ResolutionToAspect
+CALLV
+pop
+ADDRLP4 48
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $2671
+ARGP4
+ADDRLP4 1120
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 Com_sprintf
+CALLI4
+pop
+ADDRLP4 48
+ARGP4
+ADDRLP4 1140
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 44
+INDIRP4
+ADDP4
+ADDRLP4 1140
+INDIRP4
+ASGNP4
+ADDRLP4 1120
+ARGP4
+ADDRLP4 1148
+ADDRGP4 String_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 1148
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 256
+ADDP4
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 1160
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+ASGNP4
+ADDRLP4 1160
+INDIRP4
+ADDRLP4 1160
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2699
+LABELV $2686
+ADDRGP4 $2701
+ARGP4
+ADDRLP4 1112
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $2660
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $2702
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $2702
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1093664768
+EQF4 $2705
+ADDRLP4 44
+INDIRF4
+CNSTF4 1084227584
+EQF4 $2705
+ADDRLP4 44
+INDIRF4
+CNSTF4 1086324736
+NEF4 $2702
+LABELV $2705
+ADDRGP4 $2706
+ARGP4
+ADDRGP4 Com_DPrintf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTF4 1050253722
+ASGNF4
+LABELV $2702
+LABELV $2643
+endproc Item_ApplyHacks 1164 20
+export Item_Parse
+proc Item_Parse 1060 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $2708
+CNSTI4 0
+RETI4
+ADDRGP4 $2707
+JUMPV
+LABELV $2708
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $2714
+CNSTI4 0
+RETI4
+ADDRGP4 $2707
+JUMPV
+LABELV $2713
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $2716
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2478
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2707
+JUMPV
+LABELV $2716
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $2718
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Item_ApplyHacks
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2707
+JUMPV
+LABELV $2718
+ADDRGP4 itemParseKeywordHash
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1052
+ADDRGP4 KeywordHash_Find
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2722
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2724
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRGP4 $2714
+JUMPV
+LABELV $2722
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ADDRLP4 1040
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $2726
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2728
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2707
+JUMPV
+LABELV $2726
+LABELV $2714
+ADDRGP4 $2713
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $2707
+endproc Item_Parse 1060 12
+export Item_InitControls
+proc Item_InitControls 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2731
+ADDRGP4 $2730
+JUMPV
+LABELV $2731
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $2733
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2735
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2735
+LABELV $2733
+LABELV $2730
+endproc Item_InitControls 4 0
+export MenuParse_font
+proc MenuParse_font 12 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2738
+CNSTI4 0
+RETI4
+ADDRGP4 $2737
+JUMPV
+LABELV $2738
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62020
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2740
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 48
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 244
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62020
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $2740
+CNSTI4 1
+RETI4
+LABELV $2737
+endproc MenuParse_font 12 20
+export MenuParse_name
+proc MenuParse_name 12 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2743
+CNSTI4 0
+RETI4
+ADDRGP4 $2742
+JUMPV
+LABELV $2743
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $2747
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2745
+LABELV $2745
+CNSTI4 1
+RETI4
+LABELV $2742
+endproc MenuParse_name 12 8
+export MenuParse_fullscreen
+proc MenuParse_fullscreen 12 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2750
+CNSTI4 0
+RETI4
+ADDRGP4 $2748
+JUMPV
+LABELV $2750
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2748
+endproc MenuParse_fullscreen 12 8
+export MenuParse_rect
+proc MenuParse_rect 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Rect_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2753
+CNSTI4 0
+RETI4
+ADDRGP4 $2752
+JUMPV
+LABELV $2753
+CNSTI4 1
+RETI4
+LABELV $2752
+endproc MenuParse_rect 8 8
+export MenuParse_style
+proc MenuParse_style 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2756
+CNSTI4 0
+RETI4
+ADDRGP4 $2755
+JUMPV
+LABELV $2756
+CNSTI4 1
+RETI4
+LABELV $2755
+endproc MenuParse_style 8 8
+export MenuParse_visible
+proc MenuParse_visible 16 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2759
+CNSTI4 0
+RETI4
+ADDRGP4 $2758
+JUMPV
+LABELV $2759
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $2761
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $2761
+CNSTI4 1
+RETI4
+LABELV $2758
+endproc MenuParse_visible 16 8
+export MenuParse_onOpen
+proc MenuParse_onOpen 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_CompiledScript_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2764
+CNSTI4 0
+RETI4
+ADDRGP4 $2763
+JUMPV
+LABELV $2764
+CNSTI4 1
+RETI4
+LABELV $2763
+endproc MenuParse_onOpen 8 8
+export MenuParse_onClose
+proc MenuParse_onClose 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_CompiledScript_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2767
+CNSTI4 0
+RETI4
+ADDRGP4 $2766
+JUMPV
+LABELV $2767
+CNSTI4 1
+RETI4
+LABELV $2766
+endproc MenuParse_onClose 8 8
+export MenuParse_onESC
+proc MenuParse_onESC 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_CompiledScript_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2770
+CNSTI4 0
+RETI4
+ADDRGP4 $2769
+JUMPV
+LABELV $2770
+CNSTI4 1
+RETI4
+LABELV $2769
+endproc MenuParse_onESC 8 8
+export MenuParse_border
+proc MenuParse_border 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2773
+CNSTI4 0
+RETI4
+ADDRGP4 $2772
+JUMPV
+LABELV $2773
+CNSTI4 1
+RETI4
+LABELV $2772
+endproc MenuParse_border 8 8
+export MenuParse_borderSize
+proc MenuParse_borderSize 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2776
+CNSTI4 0
+RETI4
+ADDRGP4 $2775
+JUMPV
+LABELV $2776
+CNSTI4 1
+RETI4
+LABELV $2775
+endproc MenuParse_borderSize 8 8
+export MenuParse_backcolor
+proc MenuParse_backcolor 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2779
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2783
+CNSTI4 0
+RETI4
+ADDRGP4 $2778
+JUMPV
+LABELV $2783
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2780
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2779
+CNSTI4 1
+RETI4
+LABELV $2778
+endproc MenuParse_backcolor 16 8
+export MenuParse_forecolor
+proc MenuParse_forecolor 20 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2786
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2790
+CNSTI4 0
+RETI4
+ADDRGP4 $2785
+JUMPV
+LABELV $2790
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $2787
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2786
+CNSTI4 1
+RETI4
+LABELV $2785
+endproc MenuParse_forecolor 20 8
+export MenuParse_bordercolor
+proc MenuParse_bordercolor 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2793
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2797
+CNSTI4 0
+RETI4
+ADDRGP4 $2792
+JUMPV
+LABELV $2797
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2794
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2793
+CNSTI4 1
+RETI4
+LABELV $2792
+endproc MenuParse_bordercolor 16 8
+export MenuParse_focuscolor
+proc MenuParse_focuscolor 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2800
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2804
+CNSTI4 0
+RETI4
+ADDRGP4 $2799
+JUMPV
+LABELV $2804
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2801
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2800
+CNSTI4 1
+RETI4
+LABELV $2799
+endproc MenuParse_focuscolor 16 8
+export MenuParse_disablecolor
+proc MenuParse_disablecolor 16 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2807
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 12
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $2811
+CNSTI4 0
+RETI4
+ADDRGP4 $2806
+JUMPV
+LABELV $2811
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 244
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $2808
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $2807
+CNSTI4 1
+RETI4
+LABELV $2806
+endproc MenuParse_disablecolor 16 8
+export MenuParse_outlinecolor
+proc MenuParse_outlinecolor 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Color_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2814
+CNSTI4 0
+RETI4
+ADDRGP4 $2813
+JUMPV
+LABELV $2814
+CNSTI4 1
+RETI4
+LABELV $2813
+endproc MenuParse_outlinecolor 8 8
+export MenuParse_background
+proc MenuParse_background 16 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2817
+CNSTI4 0
+RETI4
+ADDRGP4 $2816
+JUMPV
+LABELV $2817
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 176
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2816
+endproc MenuParse_background 16 8
+export MenuParse_cinematic
+proc MenuParse_cinematic 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2820
+CNSTI4 0
+RETI4
+ADDRGP4 $2819
+JUMPV
+LABELV $2820
+CNSTI4 1
+RETI4
+LABELV $2819
+endproc MenuParse_cinematic 8 8
+export MenuParse_ownerdrawFlag
+proc MenuParse_ownerdrawFlag 16 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 8
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $2823
+CNSTI4 0
+RETI4
+ADDRGP4 $2822
+JUMPV
+LABELV $2823
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2822
+endproc MenuParse_ownerdrawFlag 16 8
+export MenuParse_ownerdraw
+proc MenuParse_ownerdraw 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2826
+CNSTI4 0
+RETI4
+ADDRGP4 $2825
+JUMPV
+LABELV $2826
+CNSTI4 1
+RETI4
+LABELV $2825
+endproc MenuParse_ownerdraw 8 8
+export MenuParse_popup
+proc MenuParse_popup 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 2097152
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2828
+endproc MenuParse_popup 8 0
+export MenuParse_outOfBounds
+proc MenuParse_outOfBounds 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 131072
+BORI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $2829
+endproc MenuParse_outOfBounds 8 0
+export MenuParse_soundLoop
+proc MenuParse_soundLoop 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_String_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2831
+CNSTI4 0
+RETI4
+ADDRGP4 $2830
+JUMPV
+LABELV $2831
+CNSTI4 1
+RETI4
+LABELV $2830
+endproc MenuParse_soundLoop 8 8
+export MenuParse_fadeClamp
+proc MenuParse_fadeClamp 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2834
+CNSTI4 0
+RETI4
+ADDRGP4 $2833
+JUMPV
+LABELV $2834
+CNSTI4 1
+RETI4
+LABELV $2833
+endproc MenuParse_fadeClamp 8 8
+export MenuParse_fadeAmount
+proc MenuParse_fadeAmount 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Float_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2837
+CNSTI4 0
+RETI4
+ADDRGP4 $2836
+JUMPV
+LABELV $2837
+CNSTI4 1
+RETI4
+LABELV $2836
+endproc MenuParse_fadeAmount 8 8
+export MenuParse_fadeCycle
+proc MenuParse_fadeCycle 8 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 PC_Int_Parse
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2840
+CNSTI4 0
+RETI4
+ADDRGP4 $2839
+JUMPV
+LABELV $2840
+CNSTI4 1
+RETI4
+LABELV $2839
+endproc MenuParse_fadeCycle 8 8
+export MenuParse_screenPlacement
+proc MenuParse_screenPlacement 1092 12
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $2843
+CNSTI4 0
+RETI4
+ADDRGP4 $2842
+JUMPV
+LABELV $2843
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $2848
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $2845
+ADDRLP4 1044
+CNSTI4 3
+ASGNI4
+ADDRGP4 $2846
+JUMPV
+LABELV $2845
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $2852
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $2849
+ADDRLP4 1044
+CNSTI4 2
+ASGNI4
+ADDRGP4 $2850
+JUMPV
+LABELV $2849
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $2856
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $2853
+ADDRLP4 1044
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2854
+JUMPV
+LABELV $2853
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $2860
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $2857
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2858
+JUMPV
+LABELV $2857
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2861
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2842
+JUMPV
+LABELV $2858
+LABELV $2854
+LABELV $2850
+LABELV $2846
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1072
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $2863
+CNSTI4 0
+RETI4
+ADDRGP4 $2842
+JUMPV
+LABELV $2863
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $2868
+ARGP4
+ADDRLP4 1076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 0
+NEI4 $2865
+ADDRLP4 1048
+CNSTI4 3
+ASGNI4
+ADDRGP4 $2866
+JUMPV
+LABELV $2865
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $2872
+ARGP4
+ADDRLP4 1080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1080
+INDIRI4
+CNSTI4 0
+NEI4 $2869
+ADDRLP4 1048
+CNSTI4 2
+ASGNI4
+ADDRGP4 $2870
+JUMPV
+LABELV $2869
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $2856
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $2873
+ADDRLP4 1048
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2874
+JUMPV
+LABELV $2873
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 $2860
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1088
+INDIRI4
+CNSTI4 0
+NEI4 $2876
+ADDRLP4 1048
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2877
+JUMPV
+LABELV $2876
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $2879
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2842
+JUMPV
+LABELV $2877
+LABELV $2874
+LABELV $2870
+LABELV $2866
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRI4
+ARGI4
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRGP4 Menu_SetScreenPlacement
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $2842
+endproc MenuParse_screenPlacement 1092 12
+export MenuParse_itemDef
+proc MenuParse_itemDef 44 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 96
+GEI4 $2882
+CNSTI4 540
+ARGI4
+ADDRLP4 4
+ADDRGP4 UI_Alloc_ui_shared
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2884
+CNSTI4 0
+RETI4
+ADDRGP4 $2881
+JUMPV
+LABELV $2884
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_Init
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Item_Parse
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $2886
+CNSTI4 0
+RETI4
+ADDRGP4 $2881
+JUMPV
+LABELV $2886
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_InitControls
+CALLV
+pop
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 36
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $2882
+CNSTI4 1
+RETI4
+LABELV $2881
+endproc MenuParse_itemDef 44 8
+data
+export menuParseKeywords
+align 4
+LABELV menuParseKeywords
+address $2888
+address MenuParse_font
+byte 4 0
+address $2541
+address MenuParse_name
+byte 4 0
+address $2889
+address MenuParse_fullscreen
+byte 4 0
+address $2551
+address MenuParse_rect
+byte 4 0
+address $2552
+address MenuParse_style
+byte 4 0
+address $2566
+address MenuParse_visible
+byte 4 0
+address $2890
+address MenuParse_onOpen
+byte 4 0
+address $2891
+address MenuParse_onClose
+byte 4 0
+address $2892
+address MenuParse_onESC
+byte 4 0
+address $2564
+address MenuParse_border
+byte 4 0
+address $2893
+address MenuParse_borderSize
+byte 4 0
+address $424
+address MenuParse_backcolor
+byte 4 0
+address $427
+address MenuParse_forecolor
+byte 4 0
+address $430
+address MenuParse_bordercolor
+byte 4 0
+address $2894
+address MenuParse_focuscolor
+byte 4 0
+address $2895
+address MenuParse_disablecolor
+byte 4 0
+address $2574
+address MenuParse_outlinecolor
+byte 4 0
+address $2575
+address MenuParse_background
+byte 4 0
+address $2567
+address MenuParse_ownerdraw
+byte 4 0
+address $2592
+address MenuParse_ownerdrawFlag
+byte 4 0
+address $2896
+address MenuParse_outOfBounds
+byte 4 0
+address $2897
+address MenuParse_soundLoop
+byte 4 0
+address $2898
+address MenuParse_itemDef
+byte 4 0
+address $2598
+address MenuParse_cinematic
+byte 4 0
+address $2899
+address MenuParse_popup
+byte 4 0
+address $2900
+address MenuParse_fadeClamp
+byte 4 0
+address $2901
+address MenuParse_fadeCycle
+byte 4 0
+address $2902
+address MenuParse_fadeAmount
+byte 4 0
+address $2903
+address MenuParse_screenPlacement
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+export Menu_SetupKeywordHash
+code
+proc Menu_SetupKeywordHash 4 12
+ADDRGP4 menuParseKeywordHash
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 2048
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2908
+JUMPV
+LABELV $2905
+ADDRGP4 menuParseKeywordHash
+ARGP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 menuParseKeywords
+ADDP4
+ARGP4
+ADDRGP4 KeywordHash_Add
+CALLV
+pop
+LABELV $2906
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2908
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 menuParseKeywords
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2905
+LABELV $2904
+endproc Menu_SetupKeywordHash 4 12
+export Menu_Parse
+proc Menu_Parse 1060 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $2910
+CNSTI4 0
+RETI4
+ADDRGP4 $2909
+JUMPV
+LABELV $2910
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 123
+EQI4 $2916
+CNSTI4 0
+RETI4
+ADDRGP4 $2909
+JUMPV
+LABELV $2915
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 1040
+ARGU4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1048
+ADDRGP4 trap_PC_ReadToken
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $2918
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2920
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2909
+JUMPV
+LABELV $2918
+ADDRLP4 0+16
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $2921
+CNSTI4 1
+RETI4
+ADDRGP4 $2909
+JUMPV
+LABELV $2921
+ADDRGP4 menuParseKeywordHash
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRLP4 1052
+ADDRGP4 KeywordHash_Find
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2925
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2927
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+ADDRGP4 $2916
+JUMPV
+LABELV $2925
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ADDRLP4 1040
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $2929
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $2931
+ARGP4
+ADDRLP4 0+16
+ARGP4
+ADDRGP4 PC_SourceError
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $2909
+JUMPV
+LABELV $2929
+LABELV $2916
+ADDRGP4 $2915
+JUMPV
+CNSTI4 0
+RETI4
+LABELV $2909
+endproc Menu_Parse 1060 12
+export Menu_New
+proc Menu_New 16 8
+ADDRLP4 4
+ADDRGP4 DC
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 656
+ADDRLP4 4
+INDIRP4
+CNSTI4 104120
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+ASGNP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104120
+ADDP4
+INDIRI4
+CNSTI4 64
+GEI4 $2934
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_Init
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Menu_Parse
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $2936
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_PostParse
+CALLV
+pop
+ADDRLP4 12
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104120
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2936
+LABELV $2934
+LABELV $2933
+endproc Menu_New 16 8
+export Menu_Count
+proc Menu_Count 0 0
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104120
+ADDP4
+INDIRI4
+RETI4
+LABELV $2938
+endproc Menu_Count 0 0
+lit
+align 4
+LABELV $2948
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export Menu_PaintAll
+code
+proc Menu_PaintAll 44 32
+ADDRLP4 4
+ADDRGP4 scriptExecutions
+ASGNP4
+ADDRGP4 scriptExecutionsLastFrame
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 captureFunc
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2940
+ADDRGP4 captureData
+INDIRP4
+ARGP4
+ADDRGP4 captureFunc
+INDIRP4
+CALLV
+pop
+LABELV $2940
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2945
+JUMPV
+LABELV $2942
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 Menu_Paint
+CALLV
+pop
+LABELV $2943
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2945
+ADDRLP4 8
+ADDRGP4 Menu_Count
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $2942
+ADDRGP4 debugMode
+INDIRI4
+CNSTI4 0
+EQI4 $2946
+ADDRLP4 12
+ADDRGP4 $2948
+INDIRB
+ASGNB 16
+ADDRGP4 $2949
+ARGP4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62132
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTF4 1084227584
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1056964608
+ARGF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $2950
+ARGP4
+ADDRGP4 scriptExecutionsLastFrame
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTF4 1084227584
+ARGF4
+CNSTF4 1110704128
+ARGF4
+CNSTF4 1056964608
+ARGF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2946
+LABELV $2939
+endproc Menu_PaintAll 44 32
+export Menu_Reset
+proc Menu_Reset 0 0
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104120
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2951
+endproc Menu_Reset 0 0
+export Display_ScriptExecutions
+proc Display_ScriptExecutions 0 0
+ADDRGP4 scriptExecutionsLastFrame
+INDIRI4
+RETI4
+LABELV $2952
+endproc Display_ScriptExecutions 0 0
+export Display_GetContext
+proc Display_GetContext 0 0
+ADDRGP4 DC
+INDIRP4
+RETP4
+LABELV $2953
+endproc Display_GetContext 0 0
+export Display_CaptureItem
+proc Display_CaptureItem 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2958
+JUMPV
+LABELV $2955
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2959
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+RETP4
+ADDRGP4 $2954
+JUMPV
+LABELV $2959
+LABELV $2956
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2958
+ADDRLP4 0
+INDIRI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104120
+ADDP4
+INDIRI4
+LTI4 $2955
+CNSTP4 0
+RETP4
+LABELV $2954
+endproc Display_CaptureItem 8 12
+export Display_MouseMove
+proc Display_MouseMove 16 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2962
+ADDRLP4 8
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2964
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2097152
+BANDI4
+CNSTI4 0
+EQI4 $2966
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2961
+JUMPV
+LABELV $2966
+LABELV $2964
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2971
+JUMPV
+LABELV $2968
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 Menu_HandleMouseMove
+CALLV
+pop
+LABELV $2969
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2971
+ADDRLP4 0
+INDIRI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104120
+ADDP4
+INDIRI4
+LTI4 $2968
+ADDRGP4 $2963
+JUMPV
+LABELV $2962
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Menu_UpdatePosition
+CALLV
+pop
+LABELV $2963
+CNSTI4 1
+RETI4
+LABELV $2961
+endproc Display_MouseMove 16 12
+export Display_CursorType
+proc Display_CursorType 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2976
+JUMPV
+LABELV $2973
+ADDRLP4 20
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1088421888
+ASGNF4
+ADDRLP4 4+12
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $2980
+CNSTI4 4
+RETI4
+ADDRGP4 $2972
+JUMPV
+LABELV $2980
+LABELV $2974
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $2976
+ADDRLP4 0
+INDIRI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104120
+ADDP4
+INDIRI4
+LTI4 $2973
+CNSTI4 2
+RETI4
+LABELV $2972
+endproc Display_CursorType 36 12
+export Display_HandleKey
+proc Display_HandleKey 12 12
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 Display_CaptureItem
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2983
+ADDRLP4 8
+ADDRGP4 Menu_GetFocused
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $2983
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2985
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Menu_HandleKey
+CALLV
+pop
+LABELV $2985
+LABELV $2982
+endproc Display_HandleKey 12 12
+proc Window_CacheContents 12 20
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2988
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2990
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 DC
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $2990
+LABELV $2988
+LABELV $2987
+endproc Window_CacheContents 12 20
+proc Item_CacheContents 0 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2993
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_CacheContents
+CALLV
+pop
+LABELV $2993
+LABELV $2992
+endproc Item_CacheContents 0 4
+proc Menu_CacheContents 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2996
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Window_CacheContents
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3001
+JUMPV
+LABELV $2998
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Item_CacheContents
+CALLV
+pop
+LABELV $2999
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3001
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $2998
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3002
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $3002
+ADDRFP4 0
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRP4
+CALLI4
+pop
+LABELV $3002
+LABELV $2996
+LABELV $2995
+endproc Menu_CacheContents 8 8
+export Display_CacheAll
+proc Display_CacheAll 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3008
+JUMPV
+LABELV $3005
+CNSTI4 656
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 62136
+ADDP4
+ADDP4
+ARGP4
+ADDRGP4 Menu_CacheContents
+CALLV
+pop
+LABELV $3006
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3008
+ADDRLP4 0
+INDIRI4
+ADDRGP4 DC
+INDIRP4
+CNSTI4 104120
+ADDP4
+INDIRI4
+LTI4 $3005
+LABELV $3004
+endproc Display_CacheAll 4 4
+proc Menu_OverActiveItem 32 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3010
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1048580
+BANDI4
+CNSTI4 0
+EQI4 $3010
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $3012
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $3017
+JUMPV
+LABELV $3014
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1048580
+BANDI4
+CNSTI4 0
+NEI4 $3018
+ADDRGP4 $3015
+JUMPV
+LABELV $3018
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $3020
+ADDRGP4 $3015
+JUMPV
+LABELV $3020
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $3022
+ADDRLP4 16
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $3024
+ADDRLP4 16
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $3024
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Item_CorrectedTextRect
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Rect_ContainsPoint
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $3015
+CNSTI4 1
+RETI4
+ADDRGP4 $3009
+JUMPV
+LABELV $3024
+CNSTI4 1
+RETI4
+ADDRGP4 $3009
+JUMPV
+LABELV $3022
+LABELV $3015
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $3017
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+LTI4 $3014
+LABELV $3012
+LABELV $3010
+CNSTI4 0
+RETI4
+LABELV $3009
+endproc Menu_OverActiveItem 32 12
+export Display_DebugMode
+proc Display_DebugMode 0 0
+ADDRGP4 debugMode
+INDIRI4
+RETI4
+LABELV $3028
+endproc Display_DebugMode 0 0
+bss
+export menuParseKeywordHash
+align 4
+LABELV menuParseKeywordHash
+skip 2048
+export itemParseKeywordHash
+align 4
+LABELV itemParseKeywordHash
+skip 2048
+export g_nameBind2
+align 1
+LABELV g_nameBind2
+skip 32
+export g_nameBind1
+align 1
+LABELV g_nameBind1
+skip 32
+align 4
+LABELV strHandle
+skip 8192
+align 1
+LABELV strPool
+skip 524288
+align 4
+LABELV outOfMemory_ui_shared
+skip 4
+align 4
+LABELV allocPoint_ui_shared
+skip 4
+align 4
+LABELV scriptHash
+skip 2048
+align 1
+LABELV memoryPool_ui_shared
+skip 1179648
+align 4
+LABELV scrollInfo
+skip 32
+import Script_Parse
+import Display_ExpandMacros
+import CG_DrawBBox
+import IN_Button14Up
+import IN_Button14Down
+import IN_Button13Up
+import IN_Button13Down
+import IN_Button12Up
+import IN_Button12Down
+import IN_Button11Up
+import IN_Button11Down
+import IN_Button10Up
+import IN_Button10Down
+import IN_Button9Up
+import IN_Button9Down
+import IN_Button8Up
+import IN_Button8Down
+import IN_Button7Up
+import IN_Button7Down
+import IN_Button6Up
+import IN_Button6Down
+import IN_Button5Up
+import IN_Button5Down
+import IN_Button4Up
+import IN_Button4Down
+import IN_Button3Up
+import IN_Button3Down
+import IN_Button2Up
+import IN_Button2Down
+import IN_Button1Up
+import IN_Button1Down
+import IN_Button0Up
+import IN_Button0Down
+import IN_StrafeUp
+import IN_StrafeDown
+import IN_SpeedUp
+import IN_SpeedDown
+import IN_MoverightUp
+import IN_MoverightDown
+import IN_MoveleftUp
+import IN_MoveleftDown
+import IN_LookdownUp
+import IN_LookdownDown
+import IN_LookupUp
+import IN_LookupDown
+import IN_BackUp
+import IN_BackDown
+import IN_ForwardUp
+import IN_ForwardDown
+import IN_RightUp
+import IN_RightDown
+import IN_LeftUp
+import IN_LeftDown
+import IN_DownUp
+import IN_DownDown
+import IN_UpUp
+import IN_UpDown
+import IN_MLookUp
+import IN_MLookDown
+import IN_CenterView
+import CG_CreateUserCmd
+import CG_UpdateInputCvars
+import CG_RegisterInputCvars
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import CG_PB_RenderPolyBuffers
+import CG_PB_ClearPolyBuffers
+import CG_PB_FindFreePolyBuffer
+import CG_AddAtmosphericEffects
+import CG_EffectParse
+import CG_CheckGameSounds
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_ReplaceCharacter
+import CG_LocalPlayerBitsForTeam
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_LoadVoiceChats
+import CG_ShaderStateChanged
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_StopCinematic_f
+import CG_InitConsoleCommands
+import CG_ConsoleCompleteArgument
+import CG_ConsoleCommand
+import Console_Key
+import CG_RunConsole
+import Con_ToggleConsole_f
+import Con_ClearConsole_f
+import CG_CloseConsole
+import CG_ConsolePrint
+import CG_ConsoleResized
+import CG_ConsoleInit
+import CG_DrawTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingPlayer
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ParseEntitiesFromString
+import CG_SpawnVector
+import CG_SpawnInt
+import CG_SpawnFloat
+import CG_SpawnString
+import CG_SurfaceText
+import CG_SurfaceBeam
+import CG_SurfaceLightningBolt
+import CG_SurfaceRailCore
+import CG_SurfaceRailRings
+import CG_SurfaceSprite
+import CG_AddCustomSurface
+import CG_NumLocalPlayers
+import CG_LocalPlayerState
+import CG_TransitionEntity
+import CG_RestoreSnapshot
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_LightningBoltBeam
+import CG_InvulnerabilityJuiced
+import CG_InvulnerabilityImpact
+import CG_ObeliskPain
+import CG_ObeliskExplode
+import CG_KamikazeEffect
+import CG_SpawnEffect
+import CG_SpawnBubbles
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_ShotgunPattern
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_WeaponToggle_f
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_AddRefEntityWithMinLight
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_PlayerColorFromIndex
+import CG_CachePlayerModels
+import CG_CachePlayerSounds
+import CG_CustomSound
+import CG_NewPlayerInfo
+import CG_RegisterSkin
+import CG_AddSkinToFrame
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint_Limit
+import CG_Text_PaintWithCursor
+import CG_Text_Paint
+import Text_Paint_AutoWrapped
+import Text_Paint_Limit
+import Text_PaintWithCursor
+import Text_Paint
+import Text_PaintGlyph
+import Text_Height
+import Text_Width
+import Text_GetGlyph
+import CG_FontForScale
+import CG_InitTrueTypeFont
+import CG_InitBitmapNumberFont
+import CG_InitBitmapFont
+import CG_HudTextInit
+import CG_AnyScoreboardShowing
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawScreen2D
+import CG_DrawActive
+import CG_DrawHead
+import CG_GlobalCenterPrint
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import sortedTeamPlayersTime
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_ClearViewport
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_KeysStringForBinding
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_MField_Draw
+import CG_DrawStringLineHeight
+import CG_DrawStrlen
+import CG_DrawStrlenMaxChars
+import CG_DrawStrlenCommon
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringCommon
+import CG_DrawStringAutoWrap
+import CG_DrawStringExt
+import CG_DrawStringWithCursor
+import CG_DrawString
+import CG_LerpColor
+import CG_ClearClipRegion
+import CG_SetClipRegion
+import CG_DrawNamedPic
+import CG_DrawPicColor
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_GetScreenVerticalPlacement
+import CG_GetScreenHorizontalPlacement
+import CG_PopScreenPlacement
+import CG_SetScreenPlacement
+import CG_DrawActiveFrame
+import CG_CullPointAndRadius
+import CG_CullPoint
+import CG_SetupFrustum
+import CG_CalcVrect
+import CG_StepOffset
+import CG_AddBufferedSound
+import CG_ZoomDown_f
+import CG_ZoomUp_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModelComplete
+import CG_TestModel_f
+import Key_SetCatcher
+import Key_GetCatcher
+import CG_UpdateMouseState
+import CG_KillServer
+import CG_SetupDlightstyles
+import CG_AddNotifyText
+import CG_RemoveNotifyLine
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_JoystickHatEvent
+import CG_JoystickButtonEvent
+import CG_JoystickAxisEvent
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_DistributeCharEvent
+import CG_DistributeKeyEvent
+import CG_HudMenuHacks
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_LocalPlayerRemoved
+import CG_LocalPlayerAdded
+import CG_NotifyBitsPrintf
+import CG_NotifyPrintf
+import CG_Error
+import CG_Printf
+import CG_DPrintf
+import CG_MaxSplitView
+import CG_Cvar_VariableString
+import CG_Argv
+import CG_ConfigString
+import cg_currentSelectedPlayerName
+import cg_currentSelectedPlayer
+import cg_thirdPersonSmooth
+import cg_thirdPersonHeight
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_thirdPerson
+import cg_drawGun
+import cg_cyclePastGauntlet
+import cg_autoswitch
+import cg_teampref
+import cg_teamtask
+import cg_handicap
+import cg_color2
+import cg_color1
+import cg_defaultFemaleTeamHeadModel
+import cg_defaultFemaleTeamModel
+import cg_defaultMaleTeamHeadModel
+import cg_defaultMaleTeamModel
+import cg_defaultTeamModelGender
+import cg_defaultFemaleHeadModel
+import cg_defaultFemaleModel
+import cg_defaultMaleHeadModel
+import cg_defaultMaleModel
+import cg_defaultModelGender
+import cg_obeliskRespawnDelay
+import cg_recordSPDemoName
+import cg_recordSPDemo
+import cg_enableBreath
+import cg_enableDust
+import cg_blueTeamName
+import cg_redTeamName
+import ui_stretch
+import cg_numberFontBorder
+import cg_numberFont
+import cg_hudFontBorder
+import cg_hudFont
+import cg_consoleFontSize
+import cg_consoleFont
+import cg_drawBBox
+import cg_drawGrappleHook
+import cg_forceBitmapFonts
+import cg_antiLag
+import cg_smoothBodySink
+import cg_oldBubbles
+import cg_drawPickupItems
+import cg_skybox
+import cg_fadeExplosions
+import cg_fovAspectAdjust
+import cg_coronas
+import cg_coronafardist
+import cg_drawShaderInfo
+import cg_consoleLatency
+import cg_voipShowCrosshairMeter
+import cg_voipShowMeter
+import cg_teamDmLeadAnnouncements
+import cg_atmosphericEffects
+import cg_railSegmentLength
+import cg_railCoreWidth
+import cg_railWidth
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import pmove_msec
+import pmove_fixed
+import pmove_overbounce
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_singlePlayer
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_drawLagometer
+import cg_hudTextScale
+import cg_splitviewTextScale
+import cg_splitviewThirdEqual
+import cg_splitviewVertical
+import cg_weaponFov
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showPolyBuffers
+import cg_showTraceTests
+import cg_optimizePrediction
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_viewkick
+import cg_viewbob
+import cg_centertime
+import cg_dedicated
+import con_autoclear
+import con_autochat
+import con_conspeed
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import MField_Draw
+import MField_Buffer
+import MField_SetText
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_LAN_ServerIsInFavoriteList
+import trap_LAN_CompareServers
+import trap_LAN_RemoveServer
+import trap_LAN_AddServer
+import trap_LAN_UpdateVisiblePings
+import trap_LAN_ServerIsVisible
+import trap_LAN_MarkServerVisible
+import trap_LAN_ResetPings
+import trap_LAN_LoadCachedServers
+import trap_LAN_SaveCachedServers
+import trap_LAN_ServerStatus
+import trap_LAN_GetServerPing
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_GetPingQueueCount
+import trap_JoyEventToString
+import trap_GetJoyEventForKey
+import trap_GetKeyForJoyEvent
+import trap_SetKeyForJoyEvent
+import trap_Mouse_SetState
+import trap_Mouse_GetState
+import trap_Key_SetRepeat
+import trap_Key_GetKey
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_GetNumLockMode
+import trap_Key_GetCapsLockMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_StopAllSounds
+import trap_S_SetStreamVolume
+import trap_S_GetStreamPlayCount
+import trap_S_QueueStreamingSound
+import trap_S_StopStreamingSound
+import trap_S_StartStreamingSound
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_SoundDuration
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StopLoopingSound
+import trap_S_StartLocalSound
+import trap_S_StartSound
+import trap_R_GetShaderName
+import trap_R_GetShaderFromModel
+import trap_R_GetSurfaceShader
+import trap_R_SetSurfaceShader
+import trap_R_GetViewFog
+import trap_R_GetGlobalFog
+import trap_R_inPVS
+import trap_R_RemapShader
+import trap_R_LerpTagTorso
+import trap_R_LerpTagFrameModel
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_Add2dPolys
+import trap_R_DrawStretchPicGradient
+import trap_R_DrawRotatedPic
+import trap_R_DrawStretchPic
+import trap_R_SetClipRegion
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddCoronaToScene
+import trap_R_AddDirectedLightToScene
+import trap_R_AddJuniorLightToScene
+import trap_R_AddVertexLightToScene
+import trap_R_AddAdditiveLightToScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyBufferToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddPolyRefEntityToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_AddSkinToFrame
+import trap_R_AllocSkinSurface
+import trap_R_RegisterFont
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterShaderEx
+import trap_R_RegisterModel
+import trap_GetEntityToken
+import trap_R_LoadWorldMap
+import trap_CM_MarkFragments
+import trap_CM_TransformedBiSphereTrace
+import trap_CM_BiSphereTrace
+import trap_CM_TransformedCapsuleTrace
+import trap_CM_TransformedBoxTrace
+import trap_CM_CapsuleTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempCapsuleModel
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_SV_Shutdown
+import trap_GetViewAngles
+import trap_SetViewAngles
+import trap_SetMapTitle
+import trap_GetConfigString
+import trap_GetClientState
+import trap_GetDemoFileInfo
+import trap_GetDemoLength
+import trap_GetDemoName
+import trap_GetDemoPos
+import trap_GetDemoState
+import trap_SetNetFields
+import trap_SendClientCommand
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_Cmd_AutoComplete
+import trap_GetVoipMuteAll
+import trap_GetVoipMute
+import trap_GetVoipGain
+import trap_GetVoipPower
+import trap_GetVoipTime
+import trap_MemoryRemaining
+import trap_UpdateScreen
+import trap_GetGlconfig
+import trap_GetClipboardData
+import trap_Field_CompleteList
+import trap_Field_CompleteCommand
+import trap_Field_CompleteFilename
+import trap_HeapFree
+import trap_HeapAvailable
+import trap_HeapMalloc
+import trap_PC_SourceFileAndLine
+import trap_PC_UnreadToken
+import trap_PC_ReadToken
+import trap_PC_AddDefine
+import trap_PC_FreeSource
+import trap_PC_LoadSource
+import trap_PC_RemoveAllGlobalDefines
+import trap_PC_RemoveGlobalDefine
+import trap_PC_AddGlobalDefine
+import trap_FS_Rename
+import trap_FS_Delete
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Tell
+import trap_FS_Seek
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cvar_CheckRange
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_DefaultVariableStringBuffer
+import trap_Cvar_LatchedVariableStringBuffer
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Cmd_ExecuteText
+import trap_RemoveCommand
+import trap_AddCommand
+import trap_LiteralArgs
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_SnapVector
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import PC_ReadStructure
+import PC_ExpectAnyToken
+import PC_ExpectTokenType
+import PC_ExpectTokenString
+import PC_CheckTokenString
+import PC_SourceError
+import PC_SourceWarning
+import etpro_FinalizeTracemapClamp
+import BG_GetTracemapGroundCeil
+import BG_GetTracemapGroundFloor
+import BG_GetGroundHeightAtPoint
+import BG_GetSkyGroundHeightAtPoint
+import BG_GetSkyHeightAtPoint
+import BG_LoadTraceMap
+import BG_GenerateTracemap
+import BG_CheckSpawnEntity
+import cmdcmp
+import SnapVectorTowards
+import BG_AddStringToList
+import BG_DecomposeUserCmdValue
+import BG_ComposeUserCmdValue
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForAmmo
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import bg_numPlayerStateFields
+import bg_playerStateFields
+import bg_numEntityStateFields
+import bg_entityStateFields
+import bg_displayGametypeNames
+import bg_netGametypeNames
+import Com_LocalPlayerBaseCvarName
+import Com_LocalPlayerForCvarName
+import Com_LocalPlayerCvarName
+import Com_DPrintf
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_Big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Swap_Init
+import LittleFloatPtr
+import BigFloatPtr
+import LittleLong64
+import BigLong64
+import LittleLong
+import BigLong
+import LittleShort
+import BigShort
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_ClientListParse
+import Com_ClientListString
+import Com_ClientListAll
+import Com_ClientListClear
+import Com_ClientListRemove
+import Com_ClientListAdd
+import Com_ClientListContains
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLineUntilBrace
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt2
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_SetExtension
+import COM_DefaultExtension
+import COM_CompareExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import DistanceBetweenLineSegmentsSquared
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisEmpty
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import IntAsFloat
+import FloatAsInt
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import VectorEmpty
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import Q_isnan
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Com_Memcpy2
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import CopyLongSwap
+import CopyShortSwap
+import rint
+import fabsf
+import fabs
+import abs
+import log10
+import log
+import exp
+import pow
+import atan
+import tan
+import atan2
+import Q_asin
+import Q_acos
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_vsnprintf
+import strtol
+import _atoi
+import atoi
+import strtod
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strrchr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import bsearch
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $2950
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $2949
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $2931
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2927
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2920
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 0
+align 1
+LABELV $2903
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $2902
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 65
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $2901
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2900
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $2899
+byte 1 112
+byte 1 111
+byte 1 112
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $2898
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $2897
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 76
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $2896
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 79
+byte 1 102
+byte 1 66
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $2895
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2894
+byte 1 102
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2893
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $2892
+byte 1 111
+byte 1 110
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 0
+align 1
+LABELV $2891
+byte 1 111
+byte 1 110
+byte 1 67
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $2890
+byte 1 111
+byte 1 110
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $2889
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $2888
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $2879
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2872
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 66
+byte 1 79
+byte 1 84
+byte 1 84
+byte 1 79
+byte 1 77
+byte 1 0
+align 1
+LABELV $2868
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 84
+byte 1 79
+byte 1 80
+byte 1 0
+align 1
+LABELV $2861
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 122
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2860
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 82
+byte 1 69
+byte 1 84
+byte 1 67
+byte 1 72
+byte 1 0
+align 1
+LABELV $2856
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 67
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $2852
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 76
+byte 1 69
+byte 1 70
+byte 1 84
+byte 1 0
+align 1
+LABELV $2848
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 95
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 0
+align 1
+LABELV $2747
+byte 1 109
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2728
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2724
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2706
+byte 1 77
+byte 1 97
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 98
+byte 1 111
+byte 1 120
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $2701
+byte 1 70
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2688
+byte 1 37
+byte 1 100
+byte 1 120
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $2671
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 0
+align 1
+LABELV $2663
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $2662
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $2659
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2653
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2652
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2649
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 73
+byte 1 80
+byte 1 118
+byte 1 54
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2646
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $2635
+byte 1 37
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $2630
+byte 1 49
+byte 1 54
+byte 1 58
+byte 1 57
+byte 1 0
+align 1
+LABELV $2629
+byte 1 49
+byte 1 46
+byte 1 55
+byte 1 56
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $2628
+byte 1 53
+byte 1 58
+byte 1 51
+byte 1 0
+align 1
+LABELV $2627
+byte 1 49
+byte 1 46
+byte 1 54
+byte 1 55
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $2626
+byte 1 49
+byte 1 54
+byte 1 58
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $2625
+byte 1 49
+byte 1 46
+byte 1 54
+byte 1 48
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $2624
+byte 1 49
+byte 1 52
+byte 1 58
+byte 1 57
+byte 1 0
+align 1
+LABELV $2623
+byte 1 49
+byte 1 46
+byte 1 53
+byte 1 54
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $2622
+byte 1 51
+byte 1 58
+byte 1 50
+byte 1 0
+align 1
+LABELV $2621
+byte 1 49
+byte 1 46
+byte 1 53
+byte 1 48
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $2620
+byte 1 52
+byte 1 58
+byte 1 51
+byte 1 0
+align 1
+LABELV $2619
+byte 1 49
+byte 1 46
+byte 1 51
+byte 1 51
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $2618
+byte 1 53
+byte 1 58
+byte 1 52
+byte 1 0
+align 1
+LABELV $2617
+byte 1 49
+byte 1 46
+byte 1 50
+byte 1 53
+byte 1 58
+byte 1 49
+byte 1 0
+align 1
+LABELV $2616
+byte 1 56
+byte 1 53
+byte 1 54
+byte 1 120
+byte 1 52
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $2615
+byte 1 50
+byte 1 48
+byte 1 52
+byte 1 56
+byte 1 120
+byte 1 49
+byte 1 53
+byte 1 51
+byte 1 54
+byte 1 0
+align 1
+LABELV $2614
+byte 1 49
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $2613
+byte 1 49
+byte 1 50
+byte 1 56
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 48
+byte 1 50
+byte 1 52
+byte 1 0
+align 1
+LABELV $2612
+byte 1 49
+byte 1 49
+byte 1 53
+byte 1 50
+byte 1 120
+byte 1 56
+byte 1 54
+byte 1 52
+byte 1 0
+align 1
+LABELV $2611
+byte 1 49
+byte 1 48
+byte 1 50
+byte 1 52
+byte 1 120
+byte 1 55
+byte 1 54
+byte 1 56
+byte 1 0
+align 1
+LABELV $2610
+byte 1 57
+byte 1 54
+byte 1 48
+byte 1 120
+byte 1 55
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $2609
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $2608
+byte 1 54
+byte 1 52
+byte 1 48
+byte 1 120
+byte 1 52
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $2607
+byte 1 53
+byte 1 49
+byte 1 50
+byte 1 120
+byte 1 51
+byte 1 56
+byte 1 52
+byte 1 0
+align 1
+LABELV $2606
+byte 1 52
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 51
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $2605
+byte 1 51
+byte 1 50
+byte 1 48
+byte 1 120
+byte 1 50
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $2599
+byte 1 100
+byte 1 111
+byte 1 117
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $2598
+byte 1 99
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 0
+align 1
+LABELV $2597
+byte 1 104
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 67
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $2596
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 67
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $2595
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 67
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $2594
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $2593
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 67
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $2592
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $2591
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $2590
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $2589
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 76
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $2588
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 70
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2587
+byte 1 102
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $2586
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $2585
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $2584
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $2583
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $2582
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $2581
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $2580
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $2579
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $2578
+byte 1 109
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2577
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $2576
+byte 1 111
+byte 1 110
+byte 1 70
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $2575
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $2574
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $2573
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2572
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2571
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $2570
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 120
+byte 1 0
+align 1
+LABELV $2569
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $2568
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 0
+align 1
+LABELV $2567
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 0
+align 1
+LABELV $2566
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2565
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $2564
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2563
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $2562
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2561
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2560
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $2559
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $2558
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2557
+byte 1 104
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 122
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $2556
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 119
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2555
+byte 1 119
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $2554
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2553
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $2552
+byte 1 115
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2551
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $2550
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2549
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $2548
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 121
+byte 1 0
+align 1
+LABELV $2547
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 120
+byte 1 0
+align 1
+LABELV $2546
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $2545
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $2544
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $2543
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $2542
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $2541
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2478
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $1818
+byte 1 70
+byte 1 73
+byte 1 88
+byte 1 77
+byte 1 69
+byte 1 0
+align 1
+LABELV $1794
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $1793
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 0
+align 1
+LABELV $1763
+byte 1 105
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1734
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 52
+byte 1 0
+align 1
+LABELV $1733
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $1732
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $1731
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $1730
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 68
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $1729
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 85
+byte 1 112
+byte 1 0
+align 1
+LABELV $1728
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1727
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 73
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $1726
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 84
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $1725
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1724
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 73
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $1723
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $1722
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 79
+byte 1 119
+byte 1 110
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $1721
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 69
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $1720
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 82
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $1719
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 70
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $1718
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 67
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $1717
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 80
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $1716
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1715
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1714
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 121
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1713
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1712
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 79
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1711
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1710
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1709
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 52
+byte 1 0
+align 1
+LABELV $1708
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $1707
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $1706
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 118
+byte 1 0
+align 1
+LABELV $1705
+byte 1 43
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $1704
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $1703
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $1702
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $1701
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $1700
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 57
+byte 1 0
+align 1
+LABELV $1699
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 56
+byte 1 0
+align 1
+LABELV $1698
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 55
+byte 1 0
+align 1
+LABELV $1697
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 54
+byte 1 0
+align 1
+LABELV $1696
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 53
+byte 1 0
+align 1
+LABELV $1695
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 52
+byte 1 0
+align 1
+LABELV $1694
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 51
+byte 1 0
+align 1
+LABELV $1693
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 50
+byte 1 0
+align 1
+LABELV $1692
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $1691
+byte 1 43
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $1690
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $1689
+byte 1 43
+byte 1 109
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $1688
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $1687
+byte 1 43
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $1686
+byte 1 43
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 102
+byte 1 101
+byte 1 0
+align 1
+LABELV $1685
+byte 1 43
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1684
+byte 1 43
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $1683
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $1682
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $1681
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1680
+byte 1 43
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 0
+align 1
+LABELV $1679
+byte 1 43
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $1678
+byte 1 43
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $1677
+byte 1 43
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1676
+byte 1 43
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 50
+byte 1 0
+align 1
+LABELV $1675
+byte 1 43
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1659
+byte 1 78
+byte 1 111
+byte 1 0
+align 1
+LABELV $1658
+byte 1 89
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $1497
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1493
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1328
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $1145
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $1140
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $1139
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $1138
+byte 1 45
+byte 1 49
+byte 1 0
+align 1
+LABELV $1134
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $1073
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $627
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $626
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $625
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $624
+byte 1 101
+byte 1 120
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $623
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $622
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $621
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $620
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $619
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $618
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $617
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $616
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 103
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $615
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $614
+byte 1 99
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $613
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $612
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $611
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $610
+byte 1 104
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $609
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $608
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $607
+byte 1 102
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $600
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 0
+align 1
+LABELV $593
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $589
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $430
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $427
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $424
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $261
+byte 1 32
+byte 1 0
+align 1
+LABELV $258
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $253
+byte 1 125
+byte 1 0
+align 1
+LABELV $244
+byte 1 123
+byte 1 0
+align 1
+LABELV $208
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $173
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $143
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 37
+byte 1 37
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $142
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 37
+byte 1 37
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $141
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $140
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 47
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 80
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 10
+byte 1 0
+align 1
+LABELV $119
+byte 1 0
+align 1
+LABELV $110
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 58
+byte 1 32
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 32
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 33
+byte 1 10
+byte 1 0
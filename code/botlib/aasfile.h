@@ -39,6 +39,14 @@ Suite 120, Rockville, Maryland 20850 USA.
 #define AASVERSION_OLD				4
 #define AASVERSION					5
 
+//compact aas file with naturally aligned little endian lumps that are used in place
+#define AASCOMPACTID				(('C'<<24)+('S'<<16)+('A'<<8)+'A')
+#define AASCOMPACTVERSION			2
+//alignment of the lumps in the compact aas file
+#define AASCOMPACT_LUMPALIGN		16
+//compact lump flags
+#define AASCOMPACTLUMP_PACKED		1		//delta coded variable length integers
+
 //presence types
 #define PRESENCE_NONE				1
 #define PRESENCE_NORMAL				2
@@ -255,6 +263,27 @@ typedef struct aas_header_s
 	aas_lump_t lumps[AAS_LUMPS];
 } aas_header_t;
 
+//compact aas file header lump
+typedef struct aas_compactlump_s
+{
+	int fileofs;
+	int filelen;						//length of the lump in the file
+	int count;							//number of elements in the lump
+	int flags;							//compact lump flags
+} aas_compactlump_t;
+
+//compact aas file header
+typedef struct aas_compactheader_s
+{
+	int ident;
+	int version;
+	int bspchecksum;
+	int filesize;						//size of the whole file
+	int aasstamp;						//stamp of the aas file the data was converted from
+	//data entries
+	aas_compactlump_t lumps[AAS_LUMPS];
+} aas_compactheader_t;
+
 
 //====== additional information ======
 /*
@@ -157,6 +157,7 @@ typedef struct aas_routingupdate_s
 	unsigned short int tmptraveltime;			//temporary travel time
 	unsigned short int *areatraveltimes;		//travel times within the area
 	qboolean inlist;							//true if the update is in the list
+	int bucket;									//routing queue bucket the update is in
 	struct aas_routingupdate_s *next;
 	struct aas_routingupdate_s *prev;
 } aas_routingupdate_t;
@@ -182,6 +183,23 @@ typedef struct aas_reachabilityareas_s
 	int firstarea, numareas;
 } aas_reachabilityareas_t;
 
+//precomputed routing tables for one set of travel flags
+typedef struct aas_routetable_s
+{
+	int travelflags;							//travel flags the tables were computed with
+	unsigned short int **clustertraveltimes;	//per cluster [goal * numreachabilityareas + start]
+	unsigned char **clusterreachabilities;		//per cluster reachability used from the start area
+	unsigned short int *portaltraveltimes;		//[goal portal * numportals + portal]
+} aas_routetable_t;
+
+//bsp tree node with the plane stored in the node, 32 bytes
+typedef struct aas_flatnode_s
+{
+	aas_plane_t plane;					//copy of the node plane
+	int planenum;						//number of the node plane
+	int children[2];					//child flat nodes, or areas as leaves when negative
+} aas_flatnode_t;
+
 typedef struct aas_s
 {
 	int loaded;									//true when an AAS file is loaded
@@ -194,6 +212,9 @@ typedef struct aas_s
 	//name of the aas file
 	char filename[MAX_QPATH];
 	char mapname[MAX_QPATH];
+	//compact aas file the lumps point into
+	char *filedata;
+	int filedatasize;
 	//bounding boxes
 	int numbboxes;
 	aas_bbox_t *bboxes;
@@ -227,6 +248,9 @@ typedef struct aas_s
 	//nodes of the bsp tree
 	int numnodes;
 	aas_node_t *nodes;
+	//nodes of the bsp tree as used by the sampling functions
+	int numflatnodes;
+	aas_flatnode_t *flatnodes;
 	//cluster portals
 	int numportals;
 	aas_portal_t *portals;
@@ -272,6 +296,19 @@ typedef struct aas_s
 	//areas the reachabilities go through
 	int *reachabilityareaindex;
 	aas_reachabilityareas_t *reachabilityareas;
+	//precomputed routing tables
+	int numroutetables;
+	aas_routetable_t *routetables;
+	//number of areas disabled for routing
+	int numdisabledareas;
+	//number of areas disabled for routing per cluster, portals count for both clusters
+	int *clusterdisabledareas;
+	//grid with the reachability areas overlapping each column of the map
+	float reachgridorigin[2];
+	float reachgridcellsize;
+	int reachgridsize[2];
+	int *reachgridfirst;
+	int *reachgridareas;
 } aas_t;
 
 #define AASINTERN
@@ -100,6 +100,34 @@ int AAS_UpdateEntity(int entnum, bot_entitystate_t *state)
 	return BLERR_NOERROR;
 } //end of the function AAS_UpdateEntity
 //===========================================================================
+// updates all the given entities in one pass, the entities that are not
+// in the list are not valid this frame and are unlinked
+//
+// Parameter:				numentities	: number of entities to update
+//								entnums		: entity numbers
+//								states		: entity states
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int AAS_UpdateEntities(int numentities, int *entnums, bot_entitystate_t *states)
+{
+	int i;
+
+	if (!aasworld.loaded)
+	{
+		botimport.Print(PRT_MESSAGE, "AAS_UpdateEntities: not loaded\n");
+		return BLERR_NOAASFILE;
+	} //end if
+
+	for (i = 0; i < numentities; i++)
+	{
+		AAS_UpdateEntity(entnums[i], &states[i]);
+	} //end for
+	//unlink all entities that were not updated
+	AAS_UnlinkInvalidEntities();
+	return BLERR_NOERROR;
+} //end of the function AAS_UpdateEntities
+//===========================================================================
 //
 // Parameter:				-
 // Returns:					-
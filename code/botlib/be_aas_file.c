@@ -49,6 +49,14 @@ Suite 120, Rockville, Maryland 20850 USA.
 
 //#define AASFILEDEBUG
 
+//AAS data of a file lump
+typedef struct aas_lumpinfo_s
+{
+	void **data;						//pointer to the lump data
+	int *count;							//pointer to the number of elements
+	int size;							//size of one element
+} aas_lumpinfo_t;
+
 //===========================================================================
 //
 // Parameter:				-
@@ -178,6 +186,24 @@ void AAS_SwapAASData(void)
 	} //end for
 } //end of the function AAS_SwapAASData
 //===========================================================================
+// the lumps of a compact aas file point into the file data which is freed
+// as a whole when the aas data is dumped
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void AAS_FreeAASLump(void *ptr)
+{
+	if (!ptr) return;
+	if (aasworld.filedata && (char *) ptr >= aasworld.filedata &&
+			(char *) ptr < aasworld.filedata + aasworld.filedatasize)
+	{
+		return;
+	} //end if
+	FreeMemory(ptr);
+} //end of the function AAS_FreeAASLump
+//===========================================================================
 // dump the current loaded aas file
 //
 // Parameter:				-
@@ -187,49 +213,56 @@ void AAS_SwapAASData(void)
 void AAS_DumpAASData(void)
 {
 	aasworld.numbboxes = 0;
-	if (aasworld.bboxes) FreeMemory(aasworld.bboxes);
+	AAS_FreeAASLump(aasworld.bboxes);
 	aasworld.bboxes = NULL;
 	aasworld.numvertexes = 0;
-	if (aasworld.vertexes) FreeMemory(aasworld.vertexes);
+	AAS_FreeAASLump(aasworld.vertexes);
 	aasworld.vertexes = NULL;
 	aasworld.numplanes = 0;
-	if (aasworld.planes) FreeMemory(aasworld.planes);
+	AAS_FreeAASLump(aasworld.planes);
 	aasworld.planes = NULL;
 	aasworld.numedges = 0;
-	if (aasworld.edges) FreeMemory(aasworld.edges);
+	AAS_FreeAASLump(aasworld.edges);
 	aasworld.edges = NULL;
 	aasworld.edgeindexsize = 0;
-	if (aasworld.edgeindex) FreeMemory(aasworld.edgeindex);
+	AAS_FreeAASLump(aasworld.edgeindex);
 	aasworld.edgeindex = NULL;
 	aasworld.numfaces = 0;
-	if (aasworld.faces) FreeMemory(aasworld.faces);
+	AAS_FreeAASLump(aasworld.faces);
 	aasworld.faces = NULL;
 	aasworld.faceindexsize = 0;
-	if (aasworld.faceindex) FreeMemory(aasworld.faceindex);
+	AAS_FreeAASLump(aasworld.faceindex);
 	aasworld.faceindex = NULL;
 	aasworld.numareas = 0;
-	if (aasworld.areas) FreeMemory(aasworld.areas);
+	AAS_FreeAASLump(aasworld.areas);
 	aasworld.areas = NULL;
 	aasworld.numareasettings = 0;
-	if (aasworld.areasettings) FreeMemory(aasworld.areasettings);
+	AAS_FreeAASLump(aasworld.areasettings);
 	aasworld.areasettings = NULL;
 	aasworld.reachabilitysize = 0;
-	if (aasworld.reachability) FreeMemory(aasworld.reachability);
+	AAS_FreeAASLump(aasworld.reachability);
 	aasworld.reachability = NULL;
 	aasworld.numnodes = 0;
-	if (aasworld.nodes) FreeMemory(aasworld.nodes);
+	AAS_FreeAASLump(aasworld.nodes);
 	aasworld.nodes = NULL;
+	AAS_FreeFlatNodes();
 	aasworld.numportals = 0;
-	if (aasworld.portals) FreeMemory(aasworld.portals);
+	AAS_FreeAASLump(aasworld.portals);
 	aasworld.portals = NULL;
 	aasworld.numportals = 0;
-	if (aasworld.portalindex) FreeMemory(aasworld.portalindex);
+	AAS_FreeAASLump(aasworld.portalindex);
 	aasworld.portalindex = NULL;
 	aasworld.portalindexsize = 0;
-	if (aasworld.clusters) FreeMemory(aasworld.clusters);
+	AAS_FreeAASLump(aasworld.clusters);
 	aasworld.clusters = NULL;
 	aasworld.numclusters = 0;
 	//
+	AAS_FreeReachabilityAreaGrid();
+	//
+	if (aasworld.filedata) FreeMemory(aasworld.filedata);
+	aasworld.filedata = NULL;
+	aasworld.filedatasize = 0;
+	//
 	aasworld.loaded = qfalse;
 	aasworld.initialized = qfalse;
 	aasworld.savefile = qfalse;
@@ -492,6 +525,294 @@ int AAS_LoadAASFile(char *filename)
 	return BLERR_NOERROR;
 } //end of the function AAS_LoadAASFile
 //===========================================================================
+// the AAS data lumps in the order of the file lumps
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static void AAS_LumpInfo(aas_lumpinfo_t *lumps)
+{
+	lumps[AASLUMP_BBOXES].data = (void **) &aasworld.bboxes;
+	lumps[AASLUMP_BBOXES].count = &aasworld.numbboxes;
+	lumps[AASLUMP_BBOXES].size = sizeof(aas_bbox_t);
+	lumps[AASLUMP_VERTEXES].data = (void **) &aasworld.vertexes;
+	lumps[AASLUMP_VERTEXES].count = &aasworld.numvertexes;
+	lumps[AASLUMP_VERTEXES].size = sizeof(aas_vertex_t);
+	lumps[AASLUMP_PLANES].data = (void **) &aasworld.planes;
+	lumps[AASLUMP_PLANES].count = &aasworld.numplanes;
+	lumps[AASLUMP_PLANES].size = sizeof(aas_plane_t);
+	lumps[AASLUMP_EDGES].data = (void **) &aasworld.edges;
+	lumps[AASLUMP_EDGES].count = &aasworld.numedges;
+	lumps[AASLUMP_EDGES].size = sizeof(aas_edge_t);
+	lumps[AASLUMP_EDGEINDEX].data = (void **) &aasworld.edgeindex;
+	lumps[AASLUMP_EDGEINDEX].count = &aasworld.edgeindexsize;
+	lumps[AASLUMP_EDGEINDEX].size = sizeof(aas_edgeindex_t);
+	lumps[AASLUMP_FACES].data = (void **) &aasworld.faces;
+	lumps[AASLUMP_FACES].count = &aasworld.numfaces;
+	lumps[AASLUMP_FACES].size = sizeof(aas_face_t);
+	lumps[AASLUMP_FACEINDEX].data = (void **) &aasworld.faceindex;
+	lumps[AASLUMP_FACEINDEX].count = &aasworld.faceindexsize;
+	lumps[AASLUMP_FACEINDEX].size = sizeof(aas_faceindex_t);
+	lumps[AASLUMP_AREAS].data = (void **) &aasworld.areas;
+	lumps[AASLUMP_AREAS].count = &aasworld.numareas;
+	lumps[AASLUMP_AREAS].size = sizeof(aas_area_t);
+	lumps[AASLUMP_AREASETTINGS].data = (void **) &aasworld.areasettings;
+	lumps[AASLUMP_AREASETTINGS].count = &aasworld.numareasettings;
+	lumps[AASLUMP_AREASETTINGS].size = sizeof(aas_areasettings_t);
+	lumps[AASLUMP_REACHABILITY].data = (void **) &aasworld.reachability;
+	lumps[AASLUMP_REACHABILITY].count = &aasworld.reachabilitysize;
+	lumps[AASLUMP_REACHABILITY].size = sizeof(aas_reachability_t);
+	lumps[AASLUMP_NODES].data = (void **) &aasworld.nodes;
+	lumps[AASLUMP_NODES].count = &aasworld.numnodes;
+	lumps[AASLUMP_NODES].size = sizeof(aas_node_t);
+	lumps[AASLUMP_PORTALS].data = (void **) &aasworld.portals;
+	lumps[AASLUMP_PORTALS].count = &aasworld.numportals;
+	lumps[AASLUMP_PORTALS].size = sizeof(aas_portal_t);
+	lumps[AASLUMP_PORTALINDEX].data = (void **) &aasworld.portalindex;
+	lumps[AASLUMP_PORTALINDEX].count = &aasworld.portalindexsize;
+	lumps[AASLUMP_PORTALINDEX].size = sizeof(aas_portalindex_t);
+	lumps[AASLUMP_CLUSTERS].data = (void **) &aasworld.clusters;
+	lumps[AASLUMP_CLUSTERS].count = &aasworld.numclusters;
+	lumps[AASLUMP_CLUSTERS].size = sizeof(aas_cluster_t);
+} //end of the function AAS_LumpInfo
+//===========================================================================
+// returns true if the lump is stored with delta coded variable length
+// integers in the compact aas file, the face and edge index lumps mostly
+// store ascending numbers so the deltas are small
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static int AAS_CompactLumpPacked(int lumpnum)
+{
+	return lumpnum == AASLUMP_EDGEINDEX || lumpnum == AASLUMP_FACEINDEX;
+} //end of the function AAS_CompactLumpPacked
+//===========================================================================
+// returns the number of bytes written to the buffer, the buffer should be
+// at least five bytes per integer
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static int AAS_PackIntegers(int *values, int count, unsigned char *buf)
+{
+	int i, length;
+	unsigned int zigzag, delta, prev;
+
+	length = 0;
+	prev = 0;
+	for (i = 0; i < count; i++)
+	{
+		delta = (unsigned int) values[i] - prev;
+		prev = (unsigned int) values[i];
+		zigzag = (delta << 1) ^ (unsigned int) ((int) delta >> 31);
+		while (zigzag >= 0x80)
+		{
+			buf[length++] = (unsigned char) (zigzag | 0x80);
+			zigzag >>= 7;
+		} //end while
+		buf[length++] = (unsigned char) zigzag;
+	} //end for
+	return length;
+} //end of the function AAS_PackIntegers
+//===========================================================================
+// the unpacked values are stored little endian like the other lumps
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static qboolean AAS_UnpackIntegers(unsigned char *buf, int length, int *values, int count)
+{
+	int i, pos, shift;
+	unsigned int zigzag, value;
+
+	pos = 0;
+	value = 0;
+	for (i = 0; i < count; i++)
+	{
+		zigzag = 0;
+		for (shift = 0; ; shift += 7)
+		{
+			if (pos >= length || shift > 28) return qfalse;
+			zigzag |= (unsigned int) (buf[pos] & 0x7F) << shift;
+			if (!(buf[pos++] & 0x80)) break;
+		} //end for
+		value += (zigzag >> 1) ^ (unsigned int) -(int) (zigzag & 1);
+		values[i] = LittleLong((int) value);
+	} //end for
+	return pos == length;
+} //end of the function AAS_UnpackIntegers
+//===========================================================================
+// stamp of the aas file of the map, a hash of the aas file header and
+// the file length, there are no file times so this is used to tell
+// whether the compact aas file was converted from the current aas file
+//
+// Parameter:			-
+// Returns:				qfalse if the map has no aas file
+// Changes Globals:		-
+//===========================================================================
+static qboolean AAS_AASFileStamp(int *stamp)
+{
+	fileHandle_t fp;
+	aas_header_t header;
+	char filename[MAX_QPATH];
+	unsigned char *ptr;
+	unsigned int hash;
+	int i, length;
+
+	Com_sprintf(filename, sizeof(filename), "maps/%s.aas", aasworld.mapname);
+	length = botimport.FS_FOpenFile( filename, &fp, FS_READ );
+	if (!fp) return qfalse;
+	Com_Memset(&header, 0, sizeof(aas_header_t));
+	botimport.FS_Read(&header, sizeof(aas_header_t), fp);
+	botimport.FS_FCloseFile(fp);
+	//FNV-1a over the raw header bytes and the file length
+	hash = 2166136261u;
+	ptr = (unsigned char *) &header;
+	for (i = 0; i < (int) sizeof(aas_header_t); i++)
+	{
+		hash = (hash ^ ptr[i]) * 16777619u;
+	} //end for
+	for (i = 0; i < 4; i++)
+	{
+		hash = (hash ^ ((length >> (i * 8)) & 0xFF)) * 16777619u;
+	} //end for
+	*stamp = (int) hash;
+	return qtrue;
+} //end of the function AAS_AASFileStamp
+//===========================================================================
+// load a compact aas file, the whole file is read in one block and the
+// lumps are used in place, only the packed index lumps are expanded
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+int AAS_LoadCompactAASFile(char *filename)
+{
+	fileHandle_t fp;
+	aas_compactheader_t *header;
+	aas_lumpinfo_t lumps[AAS_LUMPS];
+	int i, length, offset, filelen, count, flags, aasstamp;
+
+	botimport.Print(PRT_DEVELOPER, "trying to load %s\n", filename);
+	//dump current loaded aas file
+	AAS_DumpAASData();
+	//open the file
+	length = botimport.FS_FOpenFile( filename, &fp, FS_READ );
+	if (!fp)
+	{
+		return BLERR_CANNOTOPENAASFILE;
+	} //end if
+	if (length < (int) sizeof(aas_compactheader_t))
+	{
+		botimport.Print(PRT_WARNING, "%s is not a compact AAS file\n", filename);
+		botimport.FS_FCloseFile(fp);
+		return BLERR_WRONGAASFILEID;
+	} //end if
+	//read the whole file at once
+	aasworld.filedata = (char *) GetHunkMemory(length);
+	aasworld.filedatasize = length;
+	if (botimport.FS_Read(aasworld.filedata, length, fp) != length)
+	{
+		botimport.Print(PRT_WARNING, "can't read %s\n", filename);
+		AAS_DumpAASData();
+		botimport.FS_FCloseFile(fp);
+		return BLERR_CANNOTREADAASLUMP;
+	} //end if
+	botimport.FS_FCloseFile(fp);
+	header = (aas_compactheader_t *) aasworld.filedata;
+	//check header identification
+	if (LittleLong(header->ident) != AASCOMPACTID)
+	{
+		botimport.Print(PRT_WARNING, "%s is not a compact AAS file\n", filename);
+		AAS_DumpAASData();
+		return BLERR_WRONGAASFILEID;
+	} //end if
+	//check the version
+	if (LittleLong(header->version) != AASCOMPACTVERSION || LittleLong(header->filesize) != length)
+	{
+		botimport.Print(PRT_WARNING, "compact aas file %s is version %i, not %i\n", filename,
+							LittleLong(header->version), AASCOMPACTVERSION);
+		AAS_DumpAASData();
+		return BLERR_WRONGAASFILEVERSION;
+	} //end if
+	//
+	aasworld.bspchecksum = atoi(LibVarGetString( "sv_mapChecksum"));
+	if (LittleLong(header->bspchecksum) != aasworld.bspchecksum)
+	{
+		botimport.Print(PRT_WARNING, "compact aas file %s is out of date\n", filename);
+		AAS_DumpAASData();
+		return BLERR_WRONGAASFILEVERSION;
+	} //end if
+	//the aas file is used instead when it changed after the conversion
+	if (AAS_AASFileStamp(&aasstamp) && LittleLong(header->aasstamp) != aasstamp)
+	{
+		botimport.Print(PRT_WARNING, "compact aas file %s is older than the aas file\n", filename);
+		AAS_DumpAASData();
+		return BLERR_WRONGAASFILEVERSION;
+	} //end if
+	//load the lumps
+	AAS_LumpInfo(lumps);
+	for (i = 0; i < AAS_LUMPS; i++)
+	{
+		offset = LittleLong(header->lumps[i].fileofs);
+		filelen = LittleLong(header->lumps[i].filelen);
+		count = LittleLong(header->lumps[i].count);
+		flags = LittleLong(header->lumps[i].flags);
+		if (offset < (int) sizeof(aas_compactheader_t) || (offset & 3) ||
+				filelen < 0 || filelen > length - offset ||
+				count < 0 || count > 0x7FFFFFFF / lumps[i].size)
+		{
+			break;
+		} //end if
+		if (!count)
+		{
+			//just alloc a dummy
+			*lumps[i].data = GetClearedHunkMemory(lumps[i].size+1);
+		} //end if
+		else if (flags & AASCOMPACTLUMP_PACKED)
+		{
+			if (lumps[i].size != sizeof(int)) break;
+			*lumps[i].data = GetHunkMemory(count * sizeof(int));
+			if (!AAS_UnpackIntegers((unsigned char *) aasworld.filedata + offset, filelen,
+										(int *) *lumps[i].data, count))
+			{
+				break;
+			} //end if
+		} //end else if
+		else
+		{
+			if (filelen != count * lumps[i].size) break;
+			//use the lump in place
+			*lumps[i].data = aasworld.filedata + offset;
+		} //end else
+		*lumps[i].count = count;
+	} //end for
+	if (i < AAS_LUMPS)
+	{
+		botimport.Print(PRT_WARNING, "compact aas file %s has an invalid lump %d\n", filename, i);
+		AAS_DumpAASData();
+		return BLERR_CANNOTREADAASLUMP;
+	} //end if
+#ifdef Q3_BIG_ENDIAN
+	//the lumps are stored little endian
+	AAS_SwapAASData();
+#endif //Q3_BIG_ENDIAN
+	//aas file is loaded
+	aasworld.loaded = qtrue;
+	//
+#ifdef AASFILEDEBUG
+	AAS_FileInfo();
+#endif //AASFILEDEBUG
+	//
+	return BLERR_NOERROR;
+} //end of the function AAS_LoadCompactAASFile
+//===========================================================================
 //
 // Parameter:				-
 // Returns:					-
@@ -584,3 +905,104 @@ qboolean AAS_WriteAASFile(char *filename)
 	botimport.FS_FCloseFile(fp);
 	return qtrue;
 } //end of the function AAS_WriteAASFile
+//===========================================================================
+// converts the loaded aas data to a compact aas file, the aas data is
+// swapped back after writing so it stays valid
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+qboolean AAS_WriteCompactAASFile(char *filename)
+{
+	aas_compactheader_t header;
+	aas_lumpinfo_t lumps[AAS_LUMPS];
+	unsigned char *packed[AAS_LUMPS];
+	static char pad[AASCOMPACT_LUMPALIGN];
+	aas_areasettings_t *areasettings;
+	fileHandle_t fp;
+	int i, j, offset, length, aasstamp;
+
+	if (!aasworld.loaded)
+	{
+		botimport.Print(PRT_ERROR, "no AAS file loaded\n");
+		return qfalse;
+	} //end if
+	botimport.Print(PRT_MESSAGE, "writing %s\n", filename);
+	//open a new file
+	botimport.FS_FOpenFile( filename, &fp, FS_WRITE );
+	if (!fp)
+	{
+		botimport.Print(PRT_ERROR, "error opening %s\n", filename);
+		return qfalse;
+	} //end if
+	AAS_LumpInfo(lumps);
+	//pack the index lumps before the aas data is swapped
+	Com_Memset(&header, 0, sizeof(aas_compactheader_t));
+	offset = sizeof(aas_compactheader_t);
+	for (i = 0; i < AAS_LUMPS; i++)
+	{
+		packed[i] = NULL;
+		if (AAS_CompactLumpPacked(i) && *lumps[i].count)
+		{
+			packed[i] = (unsigned char *) GetMemory(*lumps[i].count * 5);
+			length = AAS_PackIntegers((int *) *lumps[i].data, *lumps[i].count, packed[i]);
+			header.lumps[i].flags = LittleLong(AASCOMPACTLUMP_PACKED);
+		} //end if
+		else
+		{
+			length = *lumps[i].count * lumps[i].size;
+		} //end else
+		header.lumps[i].fileofs = LittleLong(offset);
+		header.lumps[i].filelen = LittleLong(length);
+		header.lumps[i].count = LittleLong(*lumps[i].count);
+		offset += (length + AASCOMPACT_LUMPALIGN - 1) & ~(AASCOMPACT_LUMPALIGN - 1);
+	} //end for
+	header.ident = LittleLong(AASCOMPACTID);
+	header.version = LittleLong(AASCOMPACTVERSION);
+	header.bspchecksum = LittleLong(aasworld.bspchecksum);
+	header.filesize = LittleLong(offset);
+	if (!AAS_AASFileStamp(&aasstamp)) aasstamp = 0;
+	header.aasstamp = LittleLong(aasstamp);
+	//write the header
+	botimport.FS_Write(&header, sizeof(aas_compactheader_t), fp);
+#ifdef Q3_BIG_ENDIAN
+	AAS_SwapAASData();
+#endif //Q3_BIG_ENDIAN
+	//write the lumps
+	for (i = 0; i < AAS_LUMPS; i++)
+	{
+		length = LittleLong(header.lumps[i].filelen);
+		if (packed[i])
+		{
+			botimport.FS_Write(packed[i], length, fp);
+			FreeMemory(packed[i]);
+		} //end if
+		else if (i == AASLUMP_AREASETTINGS && length > 0)
+		{
+			//areas disabled at run time are enabled in the file like in the original aas file
+			areasettings = (aas_areasettings_t *) GetMemory(length);
+			Com_Memcpy(areasettings, *lumps[i].data, length);
+			for (j = 0; j < aasworld.numareasettings; j++)
+			{
+				areasettings[j].areaflags &= ~LittleLong(AREA_DISABLED);
+			} //end for
+			botimport.FS_Write(areasettings, length, fp);
+			FreeMemory(areasettings);
+		} //end else if
+		else if (length > 0)
+		{
+			botimport.FS_Write(*lumps[i].data, length, fp);
+		} //end else if
+		if (length & (AASCOMPACT_LUMPALIGN - 1))
+		{
+			botimport.FS_Write(pad, AASCOMPACT_LUMPALIGN - (length & (AASCOMPACT_LUMPALIGN - 1)), fp);
+		} //end if
+	} //end for
+#ifdef Q3_BIG_ENDIAN
+	AAS_SwapAASData();
+#endif //Q3_BIG_ENDIAN
+	//close the file
+	botimport.FS_FCloseFile(fp);
+	return qtrue;
+} //end of the function AAS_WriteCompactAASFile
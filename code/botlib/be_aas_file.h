@@ -40,8 +40,14 @@ Suite 120, Rockville, Maryland 20850 USA.
 #ifdef AASINTERN
 //loads the AAS file with the given name
 int AAS_LoadAASFile(char *filename);
+//loads the compact AAS file with the given name
+int AAS_LoadCompactAASFile(char *filename);
 //writes an AAS file with the given name
 qboolean AAS_WriteAASFile(char *filename);
+//writes the loaded AAS data to a compact AAS file with the given name
+qboolean AAS_WriteCompactAASFile(char *filename);
+//frees an AAS data lump unless it's part of the loaded compact AAS file
+void AAS_FreeAASLump(void *ptr);
 //dumps the loaded AAS data
 void AAS_DumpAASData(void);
 //print AAS file information
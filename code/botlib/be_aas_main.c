@@ -50,6 +50,9 @@ Suite 120, Rockville, Maryland 20850 USA.
 aas_t aasworld;
 
 libvar_t *saveroutingcache;
+libvar_t *bakeroutetables;
+libvar_t *writecompactaas;
+libvar_t *samplebenchmark;
 
 //===========================================================================
 //
@@ -105,6 +108,27 @@ void AAS_SetInitialized(void)
 #endif
 } //end of the function AAS_SetInitialized
 //===========================================================================
+// converts the loaded AAS data to the compact AAS file of the map
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void AAS_WriteCompactAAS(void)
+{
+	char filename[MAX_QPATH];
+
+	Com_sprintf(filename, sizeof(filename), "maps/%s.aasc", aasworld.mapname);
+	if (AAS_WriteCompactAASFile(filename))
+	{
+		botimport.Print(PRT_MESSAGE, "%s written successfully\n", filename);
+	} //end if
+	else
+	{
+		botimport.Print(PRT_ERROR, "couldn't write %s\n", filename);
+	} //end else
+} //end of the function AAS_WriteCompactAAS
+//===========================================================================
 //
 // Parameter:				-
 // Returns:					-
@@ -126,6 +150,9 @@ void AAS_ContinueInit(float time)
 	{
 		//optimize the AAS data
 		if ((int)LibVarValue("aasoptimize", "0")) AAS_Optimize();
+		//keep the compact AAS file in sync, written first because
+		//writing the AAS file swaps the AAS data
+		if (aasworld.filedata) AAS_WriteCompactAAS();
 		//save the AAS file
 		if (AAS_WriteAASFile(aasworld.filename))
 		{
@@ -136,6 +163,8 @@ void AAS_ContinueInit(float time)
 			botimport.Print(PRT_ERROR, "couldn't write %s\n", aasworld.filename);
 		} //end else
 	} //end if
+	//index the reachability areas for fast area lookups
+	AAS_InitReachabilityAreaGrid();
 	//initialize the routing
 	AAS_InitRouting();
 	//at this point AAS is initialized
@@ -179,12 +208,36 @@ int AAS_StartFrame(float time)
 		} //end if
 	} //end if
 	//
+	if (LibVarGetValue("routingcacheinfo"))
+	{
+		AAS_RoutingCacheInfo();
+		LibVarSet("routingcacheinfo", "0");
+	} //end if
+	//
 	if (saveroutingcache->value)
 	{
 		AAS_WriteRouteCache();
 		LibVarSet("saveroutingcache", "0");
 	} //end if
 	//
+	if (bakeroutetables->value)
+	{
+		AAS_WriteRouteTables();
+		LibVarSet("bakeroutetables", "0");
+	} //end if
+	//
+	if (writecompactaas->value && aasworld.initialized)
+	{
+		AAS_WriteCompactAAS();
+		LibVarSet("writecompactaas", "0");
+	} //end if
+	//
+	if (samplebenchmark->value && aasworld.loaded)
+	{
+		AAS_SampleBenchmark();
+		LibVarSet("samplebenchmark", "0");
+	} //end if
+	//
 	aasworld.numframes++;
 	return BLERR_NOERROR;
 } //end of the function AAS_StartFrame
@@ -233,14 +286,22 @@ int AAS_LoadFiles(const char *mapname)
 	// load bsp info
 	AAS_LoadBSPFile();
 
-	//load the aas file
-	Com_sprintf(aasfile, sizeof(aasfile), "maps/%s.aas", mapname);
-	errnum = AAS_LoadAASFile(aasfile);
+	//load the compact aas file if available, otherwise the aas file
+	Com_sprintf(aasfile, sizeof(aasfile), "maps/%s.aasc", mapname);
+	errnum = AAS_LoadCompactAASFile(aasfile);
 	if (errnum != BLERR_NOERROR)
-		return errnum;
+	{
+		Com_sprintf(aasfile, sizeof(aasfile), "maps/%s.aas", mapname);
+		errnum = AAS_LoadAASFile(aasfile);
+		if (errnum != BLERR_NOERROR)
+			return errnum;
+	} //end if
 
 	botimport.Print(PRT_DEVELOPER, "loaded %s\n", aasfile);
-	Q_strncpyz(aasworld.filename, aasfile, sizeof(aasworld.filename));
+	//lay out the bsp tree for the sampling functions
+	AAS_InitFlatNodes();
+	//the aas file is always written in the original format
+	Com_sprintf(aasworld.filename, sizeof(aasworld.filename), "maps/%s.aas", mapname);
 	return BLERR_NOERROR;
 } //end of the function AAS_LoadFiles
 //===========================================================================
@@ -298,6 +359,12 @@ int AAS_Setup(void)
 	aasworld.maxentities = (int) LibVarValue("maxentities", "1024");
 	// as soon as it's set to 1 the routing cache will be saved
 	saveroutingcache = LibVar("saveroutingcache", "0");
+	// as soon as it's set to 1 the route tables will be computed and saved
+	bakeroutetables = LibVar("bakeroutetables", "0");
+	// as soon as it's set to 1 the aas file is converted to a compact aas file
+	writecompactaas = LibVar("writecompactaas", "0");
+	// as soon as it's set to 1 the point and trace sampling is timed
+	samplebenchmark = LibVar("samplebenchmark", "0");
 	//allocate memory for the entities
 	if (aasworld.entities) FreeMemory(aasworld.entities);
 	aasworld.entities = (aas_entity_t *) GetClearedHunkMemory(aasworld.maxentities * sizeof(aas_entity_t));
@@ -49,6 +49,19 @@ Suite 120, Rockville, Maryland 20850 USA.
 #include "be_interface.h"
 #include "be_aas_def.h"
 
+//find the reachability candidates on worker threads when running as a shared library
+#if !defined(Q3_VM) && !defined(BSPC)
+#define REACHABILITY_THREADS
+#endif
+
+#ifdef REACHABILITY_THREADS
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+#endif //REACHABILITY_THREADS
+
 //#define REACH_DEBUG
 
 //NOTE: all travel times are in hundreth of a second
@@ -63,6 +76,10 @@ Suite 120, Rockville, Maryland 20850 USA.
 #define INSIDEUNITS_WATERJUMP				15
 //area flag used for weapon jumping
 #define AREA_WEAPONJUMP						8192	//valid area to weapon jump to
+
+#define MAX_REACHABILITYTHREADS				32
+#define REACHABILITYTHREADAREAS				512		//areas per batch of candidate tests
+#define REACHABILITYJUMPCANDIDATES			(REACHABILITYTHREADAREAS * 64)	//jump candidates stored per batch
 //number of reachabilities of each type
 int reach_swim;			//swim
 int reach_equalfloor;	//walk on floors with equal height
@@ -85,6 +102,7 @@ int reach_bfgjump;		//bfg jump
 int reach_jumppad;		//jump pads
 //if true grapple reachabilities are skipped
 int calcgrapplereach;
+int reachabilitythreads;	//number of threads used to calculate reachability
 //linked reachability
 typedef struct aas_lreachability_s
 {
@@ -104,6 +122,41 @@ aas_lreachability_t *nextreachability;	//next free reachability from the heap
 aas_lreachability_t **areareachability;	//reachability links for every area
 int numlreachabilities;
 
+//closest points on the ground of an area and an area it might jump to
+typedef struct aas_jumpcandidate_s
+{
+	int areanum;					//area that might be reached with a jump
+	float dist;						//distance between the closest points
+	vec3_t start;					//closest point on the ground of the start area
+	vec3_t end;						//closest point on the ground of the jump area
+} aas_jumpcandidate_t;
+
+//areas the reachability tests could link an area to
+typedef struct aas_areacandidates_s
+{
+	unsigned int *adjacent;			//candidate bits for the tests between adjacent areas
+	unsigned int *distant;			//candidate bits for the grapple and weapon jump tests
+	aas_jumpcandidate_t *jumps;		//jump candidates sorted on area number
+	int numjumps;					//number of jump candidates, -1 if they didn't fit
+} aas_areacandidates_t;
+
+#ifdef REACHABILITY_THREADS
+//batch of areas the reachability candidates are calculated for
+typedef struct aas_reachabilitybatch_s
+{
+	int firstarea;					//first area of the batch
+	int numareas;					//number of areas in the batch
+	int numthreads;					//number of threads working on the batch
+	int rowsize;					//size of the candidate bits per area in ints
+	unsigned int *candidates;		//adjacent and far candidate bits for every area in the batch
+	aas_areacandidates_t *areas;	//candidates of every area in the batch
+	aas_jumpcandidate_t *jumps;		//jump candidates, every thread fills its own range
+	int starttime;					//time the reachability calculation started
+} aas_reachabilitybatch_t;
+
+aas_reachabilitybatch_t reachabilitybatch;
+#endif //REACHABILITY_THREADS
+
 //===========================================================================
 // returns the surface area of the given face
 //
@@ -2092,58 +2145,28 @@ float AAS_ClosestEdgePoints(vec3_t v1, vec3_t v2, vec3_t v3, vec3_t v4,
 	return bestdist;
 } //end of the function AAS_ClosestEdgePoints
 //===========================================================================
-// creates possible jump reachabilities between the areas
-//
-// The two closest points on the ground of the areas are calculated
-// One of the points will be on an edge of a ground face of area1 and
-// one on an edge of a ground face of area2.
-// If there is a range of closest points the point in the middle of this range
-// is selected.
-// Between these two points there must be one or more gaps.
-// If the gaps exist a potential jump is predicted.
+// calculates the two closest points on the edges of the ground faces of
+// the areas, if there is a range of closest points the point in the
+// middle of this range is selected
 //
 // Parameter:				-
-// Returns:					-
+// Returns:					distance between the closest points
 // Changes Globals:		-
 //===========================================================================
-int AAS_Reachability_Jump(int area1num, int area2num)
+float AAS_ClosestGroundEdgePoints(int area1num, int area2num, vec3_t beststart, vec3_t bestend)
 {
-	int i, j, k, l, face1num, face2num, edge1num, edge2num, traveltype;
-	int stopevent, areas[10], numareas;
-	float phys_jumpvel, maxjumpdistance, maxjumpheight, height, bestdist, speed;
+	int i, j, k, l, face1num, face2num, edge1num, edge2num;
+	float bestdist;
 	vec_t *v1, *v2, *v3, *v4;
-	vec3_t beststart = {0}, beststart2 = {0}, bestend = {0}, bestend2 = {0};
-	vec3_t teststart, testend, dir, velocity, cmdmove, up = {0, 0, 1}, sidewards;
+	vec3_t beststart2 = {0}, bestend2 = {0};
 	aas_area_t *area1, *area2;
 	aas_face_t *face1, *face2;
 	aas_edge_t *edge1, *edge2;
-	aas_plane_t *plane1, *plane2, *plane;
-	aas_trace_t trace;
-	aas_clientmove_t move;
-	aas_lreachability_t *lreach;
+	aas_plane_t *plane1, *plane2;
 
-	if (!AAS_AreaGrounded(area1num) || !AAS_AreaGrounded(area2num)) return qfalse;
-	//cannot jump from or to a crouch area
-	if (AAS_AreaCrouch(area1num) || AAS_AreaCrouch(area2num)) return qfalse;
-	//
 	area1 = &aasworld.areas[area1num];
 	area2 = &aasworld.areas[area2num];
 	//
-	phys_jumpvel = aassettings.phys_jumpvel;
-	//maximum distance a player can jump
-	maxjumpdistance = 2 * AAS_MaxJumpDistance(phys_jumpvel);
-	//maximum height a player can jump with the given initial z velocity
-	maxjumpheight = AAS_MaxJumpHeight(phys_jumpvel);
-
-	//if the areas are not near enough in the x-y direction
-	for (i = 0; i < 2; i++)
-	{
-		if (area1->mins[i] > area2->maxs[i] + maxjumpdistance) return qfalse;
-		if (area1->maxs[i] < area2->mins[i] - maxjumpdistance) return qfalse;
-	} //end for
-	//if area2 is way to high to jump up to
-	if (area2->mins[2] > area1->maxs[2] + maxjumpheight) return qfalse;
-	//
 	bestdist = 999999;
 	//
 	for (i = 0; i < area1->numfaces; i++)
@@ -2186,189 +2209,273 @@ int AAS_Reachability_Jump(int area1num, int area2num)
 	} //end for
 	VectorMiddle(beststart, beststart2, beststart);
 	VectorMiddle(bestend, bestend2, bestend);
-	if (bestdist > 4 && bestdist < maxjumpdistance)
+	return bestdist;
+} //end of the function AAS_ClosestGroundEdgePoints
+//===========================================================================
+// calculates the two closest points on the ground of the areas for a jump
+// reachability, only reads the AAS data so it's safe to call from the
+// reachability worker threads
+//
+// Parameter:				-
+// Returns:					true if the areas are close enough to jump
+// Changes Globals:		-
+//===========================================================================
+int AAS_JumpEdgePoints(int area1num, int area2num, float *bestdist, vec3_t beststart, vec3_t bestend)
+{
+	int i;
+	float phys_jumpvel, maxjumpdistance, maxjumpheight;
+	aas_area_t *area1, *area2;
+
+	if (!AAS_AreaGrounded(area1num) || !AAS_AreaGrounded(area2num)) return qfalse;
+	//cannot jump from or to a crouch area
+	if (AAS_AreaCrouch(area1num) || AAS_AreaCrouch(area2num)) return qfalse;
+	//
+	area1 = &aasworld.areas[area1num];
+	area2 = &aasworld.areas[area2num];
+	//
+	phys_jumpvel = aassettings.phys_jumpvel;
+	//maximum distance a player can jump
+	maxjumpdistance = 2 * AAS_MaxJumpDistance(phys_jumpvel);
+	//maximum height a player can jump with the given initial z velocity
+	maxjumpheight = AAS_MaxJumpHeight(phys_jumpvel);
+
+	//if the areas are not near enough in the x-y direction
+	for (i = 0; i < 2; i++)
 	{
-//		Log_Write("shortest distance between %d and %d is %f\r\n", area1num, area2num, bestdist);
-		// if very close and almost no height difference then the bot can walk
-		if (bestdist <= 48 && fabs(beststart[2] - bestend[2]) < 8)
-		{
-			speed = 400;
-			traveltype = TRAVEL_WALKOFFLEDGE;
-		} //end if
-		else if (AAS_HorizontalVelocityForJump(0, beststart, bestend, &speed))
-		{
-			//FIXME: why multiply with 1.2???
-			speed *= 1.2f;
-			traveltype = TRAVEL_WALKOFFLEDGE;
-		} //end else if
-		else
-		{
-			//get the horizontal speed for the jump, if it isn't possible to calculate this
-			//speed (the jump is not possible) then there's no jump reachability created
-			if (!AAS_HorizontalVelocityForJump(phys_jumpvel, beststart, bestend, &speed))
-				return qfalse;
-			speed *= 1.05f;
-			traveltype = TRAVEL_JUMP;
-			//
-			//NOTE: test if the horizontal distance isn't too small
-			VectorSubtract(bestend, beststart, dir);
-			dir[2] = 0;
-			if (VectorLength(dir) < 10)
-				return qfalse;
-		} //end if
+		if (area1->mins[i] > area2->maxs[i] + maxjumpdistance) return qfalse;
+		if (area1->maxs[i] < area2->mins[i] - maxjumpdistance) return qfalse;
+	} //end for
+	//if area2 is way to high to jump up to
+	if (area2->mins[2] > area1->maxs[2] + maxjumpheight) return qfalse;
+	//
+	*bestdist = AAS_ClosestGroundEdgePoints(area1num, area2num, beststart, bestend);
+	return (*bestdist > 4 && *bestdist < maxjumpdistance);
+} //end of the function AAS_JumpEdgePoints
+//===========================================================================
+// creates a possible jump reachability between the closest points on the
+// ground of the areas
+//
+// Between these two points there must be one or more gaps.
+// If the gaps exist a potential jump is predicted.
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int AAS_Reachability_JumpEdgePoints(int area1num, int area2num, float bestdist, vec3_t beststart, vec3_t bestend)
+{
+	int i, j, traveltype;
+	int stopevent, areas[10], numareas;
+	float phys_jumpvel, height, speed;
+	vec3_t teststart, testend, dir, velocity, cmdmove, up = {0, 0, 1}, sidewards;
+	aas_plane_t *plane;
+	aas_trace_t trace;
+	aas_clientmove_t move;
+	aas_lreachability_t *lreach;
+
+	phys_jumpvel = aassettings.phys_jumpvel;
+	//
+//	Log_Write("shortest distance between %d and %d is %f\r\n", area1num, area2num, bestdist);
+	// if very close and almost no height difference then the bot can walk
+	if (bestdist <= 48 && fabs(beststart[2] - bestend[2]) < 8)
+	{
+		speed = 400;
+		traveltype = TRAVEL_WALKOFFLEDGE;
+	} //end if
+	else if (AAS_HorizontalVelocityForJump(0, beststart, bestend, &speed))
+	{
+		//FIXME: why multiply with 1.2???
+		speed *= 1.2f;
+		traveltype = TRAVEL_WALKOFFLEDGE;
+	} //end else if
+	else
+	{
+		//get the horizontal speed for the jump, if it isn't possible to calculate this
+		//speed (the jump is not possible) then there's no jump reachability created
+		if (!AAS_HorizontalVelocityForJump(phys_jumpvel, beststart, bestend, &speed))
+			return qfalse;
+		speed *= 1.05f;
+		traveltype = TRAVEL_JUMP;
 		//
+		//NOTE: test if the horizontal distance isn't too small
 		VectorSubtract(bestend, beststart, dir);
-		VectorNormalize(dir);
-		VectorMA(beststart, 1, dir, teststart);
-		//
-		VectorCopy(teststart, testend);
-		testend[2] -= 100;
-		trace = AAS_TracePlayerBBox(teststart, testend, PRESENCE_NORMAL, -1, BOTMASK_SOLID);
-		//
-		if (trace.startsolid)
+		dir[2] = 0;
+		if (VectorLength(dir) < 10)
 			return qfalse;
-		if (trace.fraction < 1)
+	} //end if
+	//
+	VectorSubtract(bestend, beststart, dir);
+	VectorNormalize(dir);
+	VectorMA(beststart, 1, dir, teststart);
+	//
+	VectorCopy(teststart, testend);
+	testend[2] -= 100;
+	trace = AAS_TracePlayerBBox(teststart, testend, PRESENCE_NORMAL, -1, BOTMASK_SOLID);
+	//
+	if (trace.startsolid)
+		return qfalse;
+	if (trace.fraction < 1)
+	{
+		plane = &aasworld.planes[trace.planenum];
+		// if the bot can stand on the surface
+		if (DotProduct(plane->normal, up) >= 0.7)
 		{
-			plane = &aasworld.planes[trace.planenum];
-			// if the bot can stand on the surface
-			if (DotProduct(plane->normal, up) >= 0.7)
+			// if no lava or slime below
+			if (!(AAS_PointContents(trace.endpos) & (CONTENTS_LAVA|CONTENTS_SLIME)))
 			{
-				// if no lava or slime below
-				if (!(AAS_PointContents(trace.endpos) & (CONTENTS_LAVA|CONTENTS_SLIME)))
-				{
-					if (teststart[2] - trace.endpos[2] <= aassettings.phys_maxbarrier)
-						return qfalse;
-				} //end if
+				if (teststart[2] - trace.endpos[2] <= aassettings.phys_maxbarrier)
+					return qfalse;
 			} //end if
 		} //end if
-		//
-		VectorMA(bestend, -1, dir, teststart);
-		//
-		VectorCopy(teststart, testend);
-		testend[2] -= 100;
-		trace = AAS_TracePlayerBBox(teststart, testend, PRESENCE_NORMAL, -1, BOTMASK_SOLID);
-		//
-		if (trace.startsolid)
-			return qfalse;
-		if (trace.fraction < 1)
+	} //end if
+	//
+	VectorMA(bestend, -1, dir, teststart);
+	//
+	VectorCopy(teststart, testend);
+	testend[2] -= 100;
+	trace = AAS_TracePlayerBBox(teststart, testend, PRESENCE_NORMAL, -1, BOTMASK_SOLID);
+	//
+	if (trace.startsolid)
+		return qfalse;
+	if (trace.fraction < 1)
+	{
+		plane = &aasworld.planes[trace.planenum];
+		// if the bot can stand on the surface
+		if (DotProduct(plane->normal, up) >= 0.7)
 		{
-			plane = &aasworld.planes[trace.planenum];
-			// if the bot can stand on the surface
-			if (DotProduct(plane->normal, up) >= 0.7)
+			// if no lava or slime below
+			if (!(AAS_PointContents(trace.endpos) & (CONTENTS_LAVA|CONTENTS_SLIME)))
 			{
-				// if no lava or slime below
-				if (!(AAS_PointContents(trace.endpos) & (CONTENTS_LAVA|CONTENTS_SLIME)))
-				{
-					if (teststart[2] - trace.endpos[2] <= aassettings.phys_maxbarrier)
-						return qfalse;
-				} //end if
+				if (teststart[2] - trace.endpos[2] <= aassettings.phys_maxbarrier)
+					return qfalse;
 			} //end if
 		} //end if
+	} //end if
+	//
+	// get command movement
+	VectorClear(cmdmove);
+	if ((traveltype & TRAVELTYPE_MASK) == TRAVEL_JUMP)
+		cmdmove[2] = aassettings.phys_jumpvel;
+	else
+		cmdmove[2] = 0;
+	//
+	VectorSubtract(bestend, beststart, dir);
+	dir[2] = 0;
+	VectorNormalize(dir);
+	CrossProduct(dir, up, sidewards);
+	//
+	stopevent = SE_HITGROUND|SE_ENTERWATER|SE_ENTERSLIME|SE_ENTERLAVA|SE_HITGROUNDDAMAGE;
+	if (!AAS_AreaClusterPortal(area1num) && !AAS_AreaClusterPortal(area2num))
+		stopevent |= SE_TOUCHCLUSTERPORTAL;
+	//
+	for (i = 0; i < 3; i++)
+	{
 		//
-		// get command movement
-		VectorClear(cmdmove);
-		if ((traveltype & TRAVELTYPE_MASK) == TRAVEL_JUMP)
-			cmdmove[2] = aassettings.phys_jumpvel;
+		if (i == 1)
+			VectorAdd(testend, sidewards, testend);
+		else if (i == 2)
+			VectorSubtract(bestend, sidewards, testend);
 		else
-			cmdmove[2] = 0;
-		//
-		VectorSubtract(bestend, beststart, dir);
+			VectorCopy(bestend, testend);
+		VectorSubtract(testend, beststart, dir);
 		dir[2] = 0;
 		VectorNormalize(dir);
-		CrossProduct(dir, up, sidewards);
+		VectorScale(dir, speed, velocity);
 		//
-		stopevent = SE_HITGROUND|SE_ENTERWATER|SE_ENTERSLIME|SE_ENTERLAVA|SE_HITGROUNDDAMAGE;
-		if (!AAS_AreaClusterPortal(area1num) && !AAS_AreaClusterPortal(area2num))
-			stopevent |= SE_TOUCHCLUSTERPORTAL;
-		//
-		for (i = 0; i < 3; i++)
+		AAS_PredictPlayerMovement(&move, -1, beststart, PRESENCE_NORMAL, qtrue,
+									velocity, cmdmove, 3, 30, 0.1f,
+									stopevent, 0, qfalse, BOTMASK_SOLID);
+		// if prediction time wasn't enough to fully predict the movement
+		if (move.frames >= 30)
+			return qfalse;
+		// don't enter slime or lava and don't fall from too high
+		if (move.stopevent & (SE_ENTERSLIME|SE_ENTERLAVA))
+			return qfalse;
+		// never jump or fall through a cluster portal
+		if (move.stopevent & SE_TOUCHCLUSTERPORTAL)
+			return qfalse;
+		//the end position should be in area2, also test a little bit back
+		//because the predicted jump could have rushed through the area
+		VectorMA(move.endpos, -64, dir, teststart);
+		teststart[2] += 1;
+		numareas = AAS_TraceAreas(move.endpos, teststart, areas, NULL, ARRAY_LEN(areas));
+		for (j = 0; j < numareas; j++)
 		{
-			//
-			if (i == 1)
-				VectorAdd(testend, sidewards, testend);
-			else if (i == 2)
-				VectorSubtract(bestend, sidewards, testend);
-			else
-				VectorCopy(bestend, testend);
-			VectorSubtract(testend, beststart, dir);
-			dir[2] = 0;
-			VectorNormalize(dir);
-			VectorScale(dir, speed, velocity);
-			//
-			AAS_PredictPlayerMovement(&move, -1, beststart, PRESENCE_NORMAL, qtrue,
-										velocity, cmdmove, 3, 30, 0.1f,
-										stopevent, 0, qfalse, BOTMASK_SOLID);
-			// if prediction time wasn't enough to fully predict the movement
-			if (move.frames >= 30)
-				return qfalse;
-			// don't enter slime or lava and don't fall from too high
-			if (move.stopevent & (SE_ENTERSLIME|SE_ENTERLAVA))
-				return qfalse;
-			// never jump or fall through a cluster portal
-			if (move.stopevent & SE_TOUCHCLUSTERPORTAL)
-				return qfalse;
-			//the end position should be in area2, also test a little bit back
-			//because the predicted jump could have rushed through the area
-			VectorMA(move.endpos, -64, dir, teststart);
-			teststart[2] += 1;
-			numareas = AAS_TraceAreas(move.endpos, teststart, areas, NULL, ARRAY_LEN(areas));
-			for (j = 0; j < numareas; j++)
-			{
-				if (areas[j] == area2num)
-					break;
-			} //end for
-			if (j < numareas)
+			if (areas[j] == area2num)
 				break;
-		}
-		if (i >= 3)
-			return qfalse;
-		//
+		} //end for
+		if (j < numareas)
+			break;
+	}
+	if (i >= 3)
+		return qfalse;
+	//
 #ifdef REACH_DEBUG
-		//create the reachability
-		Log_Write("jump reachability between %d and %d\r\n", area1num, area2num);
+	//create the reachability
+	Log_Write("jump reachability between %d and %d\r\n", area1num, area2num);
 #endif //REACH_DEBUG
-		//create a new reachability link
-		lreach = AAS_AllocReachability();
-		if (!lreach) return qfalse;
-		lreach->areanum = area2num;
-		lreach->facenum = 0;
-		lreach->edgenum = 0;
-		VectorCopy(beststart, lreach->start);
-		VectorCopy(bestend, lreach->end);
-		lreach->traveltype = traveltype;
+	//create a new reachability link
+	lreach = AAS_AllocReachability();
+	if (!lreach) return qfalse;
+	lreach->areanum = area2num;
+	lreach->facenum = 0;
+	lreach->edgenum = 0;
+	VectorCopy(beststart, lreach->start);
+	VectorCopy(bestend, lreach->end);
+	lreach->traveltype = traveltype;
 
-		VectorSubtract(bestend, beststart, dir);
-		height = dir[2];
-		dir[2] = 0;
-		if ((traveltype & TRAVELTYPE_MASK) == TRAVEL_WALKOFFLEDGE && height > VectorLength(dir))
-		{
-			lreach->traveltime = aassettings.rs_startwalkoffledge + height * 50 / aassettings.phys_gravity;
-		}
-		else
+	VectorSubtract(bestend, beststart, dir);
+	height = dir[2];
+	dir[2] = 0;
+	if ((traveltype & TRAVELTYPE_MASK) == TRAVEL_WALKOFFLEDGE && height > VectorLength(dir))
+	{
+		lreach->traveltime = aassettings.rs_startwalkoffledge + height * 50 / aassettings.phys_gravity;
+	}
+	else
+	{
+		lreach->traveltime = aassettings.rs_startjump + VectorDistance(bestend, beststart) * 240 / aassettings.phys_maxwalkvelocity;
+	} //end if
+	//
+	if (!AAS_AreaJumpPad(area2num))
+	{
+		if (AAS_FallDelta(beststart[2] - bestend[2]) > aassettings.phys_falldelta5)
 		{
-			lreach->traveltime = aassettings.rs_startjump + VectorDistance(bestend, beststart) * 240 / aassettings.phys_maxwalkvelocity;
+			lreach->traveltime += aassettings.rs_falldamage5;
 		} //end if
-		//
-		if (!AAS_AreaJumpPad(area2num))
+		else if (AAS_FallDelta(beststart[2] - bestend[2]) > aassettings.phys_falldelta10)
 		{
-			if (AAS_FallDelta(beststart[2] - bestend[2]) > aassettings.phys_falldelta5)
-			{
-				lreach->traveltime += aassettings.rs_falldamage5;
-			} //end if
-			else if (AAS_FallDelta(beststart[2] - bestend[2]) > aassettings.phys_falldelta10)
-			{
-				lreach->traveltime += aassettings.rs_falldamage10;
-			} //end if
+			lreach->traveltime += aassettings.rs_falldamage10;
 		} //end if
-		lreach->next = areareachability[area1num];
-		areareachability[area1num] = lreach;
-		//
-		if ((traveltype & TRAVELTYPE_MASK) == TRAVEL_JUMP)
-			reach_jump++;
-		else
-			reach_walkoffledge++;
 	} //end if
+	lreach->next = areareachability[area1num];
+	areareachability[area1num] = lreach;
+	//
+	if ((traveltype & TRAVELTYPE_MASK) == TRAVEL_JUMP)
+		reach_jump++;
+	else
+		reach_walkoffledge++;
 	return qfalse;
+} //end of the function AAS_Reachability_JumpEdgePoints
+//===========================================================================
+// creates possible jump reachabilities between the areas
+//
+// The two closest points on the ground of the areas are calculated
+// One of the points will be on an edge of a ground face of area1 and
+// one on an edge of a ground face of area2.
+// If there is a range of closest points the point in the middle of this range
+// is selected.
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int AAS_Reachability_Jump(int area1num, int area2num)
+{
+	float bestdist;
+	vec3_t beststart = {0}, bestend = {0};
+
+	if (!AAS_JumpEdgePoints(area1num, area2num, &bestdist, beststart, bestend)) return qfalse;
+	return AAS_Reachability_JumpEdgePoints(area1num, area2num, bestdist, beststart, bestend);
 } //end of the function AAS_Reachability_Jump
 //===========================================================================
 // create a possible ladder reachability from area1 to area2
@@ -3779,6 +3886,52 @@ void AAS_Reachability_JumpPad(void)
 	} //end for
 } //end of the function AAS_Reachability_JumpPad
 //===========================================================================
+// returns true if the grapple can be shot from the start point at the face,
+// only reads the AAS data so it's safe to call from the reachability
+// worker threads
+//
+// Parameter:				facenum		: face to grapple to
+//								areastart	: start point on the ground
+//								facecenter	: set to the center of the face
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int AAS_GrappleFace(int facenum, vec3_t areastart, vec3_t facecenter)
+{
+	float mingrappleangle, z, hordist;
+	aas_face_t *face;
+	vec3_t dir, down = {0, 0, -1};
+	vec_t *v;
+
+	face = &aasworld.faces[abs(facenum)];
+	//if it is not a solid face
+	if (!(face->faceflags & FACE_SOLID)) return qfalse;
+	//direction towards the first vertex of the face
+	v = aasworld.vertexes[aasworld.edges[abs(aasworld.edgeindex[face->firstedge])].v[0]];
+	VectorSubtract(v, areastart, dir);
+	//if the face plane is facing away
+	if (DotProduct(aasworld.planes[face->planenum].normal, dir) > 0) return qfalse;
+	//get the center of the face
+	AAS_FaceCenter(facenum, facecenter);
+	//only go higher up with the grapple
+	if (facecenter[2] < areastart[2] + 64) return qfalse;
+	//only use vertical faces or downward facing faces
+	if (DotProduct(aasworld.planes[face->planenum].normal, down) < 0) return qfalse;
+	//direction towards the face center
+	VectorSubtract(facecenter, areastart, dir);
+	//
+	z = dir[2];
+	dir[2] = 0;
+	hordist = VectorLength(dir);
+	if (!hordist) return qfalse;
+	//if too far
+	if (hordist > 2000) return qfalse;
+	//check the minimal angle of the movement
+	mingrappleangle = 15; //15 degrees
+	if (z / hordist < tan(2 * M_PI * mingrappleangle / 360)) return qfalse;
+	return qtrue;
+} //end of the function AAS_GrappleFace
+//===========================================================================
 // never point at ground faces
 // always a higher and pretty far area
 //
@@ -3789,14 +3942,12 @@ void AAS_Reachability_JumpPad(void)
 int AAS_Reachability_Grapple(int area1num, int area2num)
 {
 	int face2num, i, j, areanum, numareas, areas[20];
-	float mingrappleangle, z, hordist;
 	bsp_trace_t bsptrace;
 	aas_trace_t trace;
 	aas_face_t *face2;
 	aas_area_t *area1, *area2;
 	aas_lreachability_t *lreach;
-	vec3_t areastart = {0, 0, 0}, facecenter, start, end, dir, down = {0, 0, -1};
-	vec_t *v;
+	vec3_t areastart = {0, 0, 0}, facecenter, start, end, dir;
 
 	//only grapple when on the ground or swimming
 	if (!AAS_AreaGrounded(area1num) && !AAS_AreaSwim(area1num)) return qfalse;
@@ -3833,31 +3984,8 @@ int AAS_Reachability_Grapple(int area1num, int area2num)
 	{
 		face2num = aasworld.faceindex[area2->firstface + i];
 		face2 = &aasworld.faces[abs(face2num)];
-		//if it is not a solid face
-		if (!(face2->faceflags & FACE_SOLID)) continue;
-		//direction towards the first vertex of the face
-		v = aasworld.vertexes[aasworld.edges[abs(aasworld.edgeindex[face2->firstedge])].v[0]];
-		VectorSubtract(v, areastart, dir);
-		//if the face plane is facing away
-		if (DotProduct(aasworld.planes[face2->planenum].normal, dir) > 0) continue;
-		//get the center of the face
-		AAS_FaceCenter(face2num, facecenter);
-		//only go higher up with the grapple
-		if (facecenter[2] < areastart[2] + 64) continue;
-		//only use vertical faces or downward facing faces
-		if (DotProduct(aasworld.planes[face2->planenum].normal, down) < 0) continue;
-		//direction towards the face center
-		VectorSubtract(facecenter, areastart, dir);
-		//
-		z = dir[2];
-		dir[2] = 0;
-		hordist = VectorLength(dir);
-		if (!hordist) continue;
-		//if too far
-		if (hordist > 2000) continue;
-		//check the minimal angle of the movement
-		mingrappleangle = 15; //15 degrees
-		if (z / hordist < tan(2 * M_PI * mingrappleangle / 360)) continue;
+		//if the grapple can't be shot at the face
+		if (!AAS_GrappleFace(face2num, areastart, facecenter)) continue;
 		//
 		VectorCopy(facecenter, start);
 		VectorMA(facecenter, -500, aasworld.planes[face2->planenum].normal, end);
@@ -4314,7 +4442,7 @@ void AAS_StoreReachability(void)
 	aas_lreachability_t *lreach;
 	aas_reachability_t *reach;
 
-	if (aasworld.reachability) FreeMemory(aasworld.reachability);
+	AAS_FreeAASLump(aasworld.reachability);
 	aasworld.reachability = (aas_reachability_t *) GetClearedMemory((numlreachabilities + 10) * sizeof(aas_reachability_t));
 	aasworld.reachabilitysize = 1;
 	for (i = 0; i < aasworld.numareas; i++)
@@ -4340,6 +4468,344 @@ void AAS_StoreReachability(void)
 	} //end for
 } //end of the function AAS_StoreReachability
 //===========================================================================
+// calculates the reachabilities from the given area towards all other
+// areas, when candidates is not NULL only the candidate areas are tested
+//
+// Parameter:				areanum		: area to calculate the reachabilities for
+//								candidates	: candidate areas or NULL
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void AAS_AreaReachabilities(int areanum, aas_areacandidates_t *candidates)
+{
+	int j, jump;
+	aas_jumpcandidate_t *jc;
+
+	//only create jumppad reachabilities from jumppad areas
+	if (aasworld.areasettings[areanum].contents & AREACONTENTS_JUMPPAD)
+	{
+		return;
+	} //end if
+	jump = 0;
+	//loop over the areas
+	for (j = 1; j < aasworld.numareas; j++)
+	{
+		if (areanum == j) continue;
+		//if none of the tests below can create a reachability towards area j
+		if (candidates && !(candidates->adjacent[j >> 5] & (1 << (j & 31)))) continue;
+		//never create reachabilities from teleporter or jumppad areas to regular areas
+		if (aasworld.areasettings[areanum].contents & (AREACONTENTS_TELEPORTER|AREACONTENTS_JUMPPAD))
+		{
+			if (!(aasworld.areasettings[j].contents & (AREACONTENTS_TELEPORTER|AREACONTENTS_JUMPPAD)))
+			{
+				continue;
+			} //end if
+		} //end if
+		//if there already is a reachability link from area i to j
+		if (AAS_ReachabilityExists(areanum, j)) continue;
+		//check for a swim reachability
+		if (AAS_Reachability_Swim(areanum, j)) continue;
+		//check for a simple walk on equal floor height reachability
+		if (AAS_Reachability_EqualFloorHeight(areanum, j)) continue;
+		//check for step, barrier, waterjump and walk off ledge reachabilities
+		if (AAS_Reachability_Step_Barrier_WaterJump_WalkOffLedge(areanum, j)) continue;
+		//check for ladder reachabilities
+		if (AAS_Reachability_Ladder(areanum, j)) continue;
+		//check for a jump reachability
+		if (!candidates || candidates->numjumps < 0)
+		{
+			if (AAS_Reachability_Jump(areanum, j)) continue;
+		} //end if
+		else
+		{
+			//the closest ground points were already calculated for the jump candidates
+			while (jump < candidates->numjumps && candidates->jumps[jump].areanum < j) jump++;
+			if (jump >= candidates->numjumps || candidates->jumps[jump].areanum != j) continue;
+			jc = &candidates->jumps[jump];
+			if (AAS_Reachability_JumpEdgePoints(areanum, j, jc->dist, jc->start, jc->end)) continue;
+		} //end else
+	} //end for
+	//never create these reachabilities from teleporter or jumppad areas
+	if (aasworld.areasettings[areanum].contents & (AREACONTENTS_TELEPORTER|AREACONTENTS_JUMPPAD))
+	{
+		return;
+	} //end if
+	//loop over the areas
+	for (j = 1; j < aasworld.numareas; j++)
+	{
+		if (areanum == j) continue;
+		//if neither a grapple nor a weapon jump can reach area j
+		if (candidates && !(candidates->distant[j >> 5] & (1 << (j & 31)))) continue;
+		//
+		if (AAS_ReachabilityExists(areanum, j)) continue;
+		//check for a grapple hook reachability
+		if (calcgrapplereach) AAS_Reachability_Grapple(areanum, j);
+		//check for a weapon jump reachability
+		AAS_Reachability_WeaponJump(areanum, j);
+	} //end for
+} //end of the function AAS_AreaReachabilities
+#ifdef REACHABILITY_THREADS
+//===========================================================================
+// returns true if any of the swim, equal floor height, step, barrier,
+// waterjump, walk off ledge or ladder tests could create a reachability
+// from area1 to area2
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int AAS_AdjacentReachabilityCandidate(int area1num, int area2num)
+{
+	int i;
+	aas_area_t *area1, *area2;
+
+	//check for ladder reachabilities
+	if (AAS_AreaLadder(area1num) && AAS_AreaLadder(area2num)) return qtrue;
+	//
+	area1 = &aasworld.areas[area1num];
+	area2 = &aasworld.areas[area2num];
+	//swim, equal floor height, step, barrier, waterjump and walk off ledge
+	//reachabilities are only created between areas near each other
+	if ((AAS_AreaGrounded(area1num) || AAS_AreaSwim(area1num)) &&
+		(AAS_AreaGrounded(area2num) || AAS_AreaSwim(area2num)))
+	{
+		for (i = 0; i < 2; i++)
+		{
+			if (area1->mins[i] > area2->maxs[i] + 10) return qfalse;
+			if (area1->maxs[i] < area2->mins[i] - 10) return qfalse;
+		} //end for
+		return qtrue;
+	} //end if
+	return qfalse;
+} //end of the function AAS_AdjacentReachabilityCandidate
+//===========================================================================
+// sets the bits of the areas a grapple or weapon jump from the given area
+// could reach, same tests as AAS_Reachability_Grapple and
+// AAS_Reachability_WeaponJump before these trace through the engine
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void AAS_DistantReachabilityCandidates(int area1num, unsigned int *candidates)
+{
+	int j, i, facenum, grapple;
+	vec3_t start, end, areastart, facecenter;
+	aas_area_t *area1, *area2;
+	aas_face_t *face;
+	aas_trace_t trace;
+
+	if (!AAS_AreaGrounded(area1num) || AAS_AreaSwim(area1num)) return;
+	//only grapple when standing
+	grapple = calcgrapplereach && (AAS_AreaPresenceType(area1num) & PRESENCE_NORMAL);
+	//both tests start on the ground below the area center
+	VectorCopy(aasworld.areas[area1num].center, start);
+	VectorCopy(start, end);
+	end[2] -= 1000;
+	trace = AAS_TracePlayerBBox(start, end, PRESENCE_CROUCH, -1, BOTMASK_SOLID);
+	if (trace.startsolid) return;
+	VectorCopy(trace.endpos, areastart);
+	//
+	area1 = &aasworld.areas[area1num];
+	for (j = 1; j < aasworld.numareas; j++)
+	{
+		if (j == area1num) continue;
+		area2 = &aasworld.areas[j];
+		//never grapple or weapon jump towards way lower areas
+		if (area2->maxs[2] < area1->mins[2]) continue;
+		//
+		for (i = 0; i < area2->numfaces; i++)
+		{
+			facenum = aasworld.faceindex[area2->firstface + i];
+			face = &aasworld.faces[abs(facenum)];
+			//weapon jump towards ground faces of areas with interesting items
+			if ((face->faceflags & FACE_GROUND) && AAS_AreaGrounded(j) &&
+					(aasworld.areasettings[j].areaflags & AREA_WEAPONJUMP))
+			{
+				AAS_FaceCenter(facenum, facecenter);
+				if (facecenter[2] >= areastart[2] + 64) break;
+			} //end if
+			if (grapple && AAS_GrappleFace(facenum, areastart, facecenter)) break;
+		} //end for
+		if (i < area2->numfaces) candidates[j >> 5] |= 1 << (j & 31);
+	} //end for
+} //end of the function AAS_DistantReachabilityCandidates
+//===========================================================================
+// finds the reachability candidates for the areas of the current batch
+// assigned to the given thread, the closest ground points of the jump
+// candidates are stored in the range of the jump candidates of the thread
+//
+// only reads the AAS data and never calls into the engine so it's safe
+// to run on the reachability worker threads
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void AAS_ReachabilityCandidates(int threadnum)
+{
+	int n, i, j, numjumps, maxjumps;
+	float dist;
+	vec3_t start, end;
+	aas_areacandidates_t *candidates;
+	aas_jumpcandidate_t *jumps, *jc;
+
+	maxjumps = REACHABILITYJUMPCANDIDATES / reachabilitybatch.numthreads;
+	jumps = reachabilitybatch.jumps + threadnum * maxjumps;
+	numjumps = 0;
+	for (n = threadnum; n < reachabilitybatch.numareas; n += reachabilitybatch.numthreads)
+	{
+		i = reachabilitybatch.firstarea + n;
+		candidates = &reachabilitybatch.areas[n];
+		candidates->adjacent = reachabilitybatch.candidates + 2 * n * reachabilitybatch.rowsize;
+		candidates->distant = candidates->adjacent + reachabilitybatch.rowsize;
+		candidates->jumps = jumps + numjumps;
+		candidates->numjumps = 0;
+		Com_Memset(candidates->adjacent, 0, 2 * reachabilitybatch.rowsize * sizeof(unsigned int));
+		//
+		if (aasworld.areasettings[i].contents & AREACONTENTS_JUMPPAD) continue;
+		//
+		for (j = 1; j < aasworld.numareas; j++)
+		{
+			if (i == j) continue;
+			if (AAS_AdjacentReachabilityCandidate(i, j))
+			{
+				candidates->adjacent[j >> 5] |= 1 << (j & 31);
+			} //end if
+			if (AAS_JumpEdgePoints(i, j, &dist, start, end))
+			{
+				candidates->adjacent[j >> 5] |= 1 << (j & 31);
+				if (candidates->numjumps < 0) continue;
+				//if the jump candidates of this thread don't fit anymore the
+				//closest points are calculated again for this area
+				if (numjumps >= maxjumps)
+				{
+					candidates->numjumps = -1;
+					continue;
+				} //end if
+				jc = &jumps[numjumps++];
+				jc->areanum = j;
+				jc->dist = dist;
+				VectorCopy(start, jc->start);
+				VectorCopy(end, jc->end);
+				candidates->numjumps++;
+			} //end if
+		} //end for
+		//
+		if (aasworld.areasettings[i].contents & AREACONTENTS_TELEPORTER) continue;
+		AAS_DistantReachabilityCandidates(i, candidates->distant);
+	} //end for
+} //end of the function AAS_ReachabilityCandidates
+//===========================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+#ifdef _WIN32
+static DWORD WINAPI AAS_ReachabilityThread(LPVOID arg)
+{
+	AAS_ReachabilityCandidates(*(int *) arg);
+	return 0;
+} //end of the function AAS_ReachabilityThread
+#else
+static void *AAS_ReachabilityThread(void *arg)
+{
+	AAS_ReachabilityCandidates(*(int *) arg);
+	return NULL;
+} //end of the function AAS_ReachabilityThread
+#endif
+//===========================================================================
+// calculates the reachabilities for the next batch of areas
+//
+// the candidate areas of all the reachability tests and the closest ground
+// points for the jump tests are found on worker threads, the actual
+// reachability tests trace through the engine and always run on the
+// calling thread in area order so the reachabilities are identical to the
+// ones calculated by the incremental path
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void AAS_ThreadedReachabilityBatch(void)
+{
+	int n, numthreads, threadnums[MAX_REACHABILITYTHREADS];
+	qboolean started[MAX_REACHABILITYTHREADS];
+#ifdef _WIN32
+	HANDLE threads[MAX_REACHABILITYTHREADS];
+#else
+	pthread_t threads[MAX_REACHABILITYTHREADS];
+#endif
+
+	numthreads = reachabilitythreads;
+	if (numthreads > MAX_REACHABILITYTHREADS) numthreads = MAX_REACHABILITYTHREADS;
+	//allocate the candidate memory with the first batch
+	if (!reachabilitybatch.candidates)
+	{
+		reachabilitybatch.starttime = botimport.MilliSeconds();
+		reachabilitybatch.numthreads = numthreads;
+		reachabilitybatch.rowsize = (aasworld.numareas + 31) >> 5;
+		reachabilitybatch.candidates = (unsigned int *) GetMemory(REACHABILITYTHREADAREAS *
+									2 * reachabilitybatch.rowsize * sizeof(unsigned int));
+		reachabilitybatch.areas = (aas_areacandidates_t *) GetMemory(REACHABILITYTHREADAREAS *
+									sizeof(aas_areacandidates_t));
+		reachabilitybatch.jumps = (aas_jumpcandidate_t *) GetMemory(REACHABILITYJUMPCANDIDATES *
+									sizeof(aas_jumpcandidate_t));
+	} //end if
+	//
+	reachabilitybatch.firstarea = aasworld.numreachabilityareas;
+	reachabilitybatch.numareas = aasworld.numareas - reachabilitybatch.firstarea;
+	if (reachabilitybatch.numareas > REACHABILITYTHREADAREAS)
+		reachabilitybatch.numareas = REACHABILITYTHREADAREAS;
+	//start the worker threads, this thread does the share of thread 0
+	for (n = 1; n < numthreads; n++)
+	{
+		threadnums[n] = n;
+#ifdef _WIN32
+		threads[n] = CreateThread(NULL, 0, AAS_ReachabilityThread, &threadnums[n], 0, NULL);
+		started[n] = (threads[n] != NULL);
+#else
+		started[n] = (pthread_create(&threads[n], NULL, AAS_ReachabilityThread, &threadnums[n]) == 0);
+#endif
+	} //end for
+	AAS_ReachabilityCandidates(0);
+	//wait for the worker threads, do the share of a thread that failed to start
+	for (n = 1; n < numthreads; n++)
+	{
+		if (!started[n])
+		{
+			AAS_ReachabilityCandidates(n);
+			continue;
+		} //end if
+#ifdef _WIN32
+		WaitForSingleObject(threads[n], INFINITE);
+		CloseHandle(threads[n]);
+#else
+		pthread_join(threads[n], NULL);
+#endif
+	} //end for
+	//calculate the reachabilities in area order
+	for (n = 0; n < reachabilitybatch.numareas; n++)
+	{
+		AAS_AreaReachabilities(reachabilitybatch.firstarea + n, &reachabilitybatch.areas[n]);
+		aasworld.numreachabilityareas++;
+	} //end for
+	//free the candidate memory after the last batch
+	if (aasworld.numreachabilityareas >= aasworld.numareas)
+	{
+		FreeMemory(reachabilitybatch.candidates);
+		FreeMemory(reachabilitybatch.areas);
+		FreeMemory(reachabilitybatch.jumps);
+		reachabilitybatch.candidates = NULL;
+		reachabilitybatch.areas = NULL;
+		reachabilitybatch.jumps = NULL;
+		botimport.Print(PRT_MESSAGE, "\nreachability calculated with %d threads in %d msec\n",
+							numthreads, botimport.MilliSeconds() - reachabilitybatch.starttime);
+	} //end if
+} //end of the function AAS_ThreadedReachabilityBatch
+#endif //REACHABILITY_THREADS
+//===========================================================================
 //
 // TRAVEL_WALK					100%	equal floor height + steps
 // TRAVEL_CROUCH				100%
@@ -4366,7 +4832,7 @@ void AAS_StoreReachability(void)
 //===========================================================================
 int AAS_ContinueInitReachability(float time)
 {
-	int i, j, todo, start_time;
+	int i, todo, start_time;
 	static float framereachability, reachability_delay;
 	static int lastpercentage;
 
@@ -4381,64 +4847,30 @@ int AAS_ContinueInitReachability(float time)
 		framereachability = 2000;
 		reachability_delay = 1000;
 	} //end if
-	//number of areas to calculate reachability for this cycle
-	todo = aasworld.numreachabilityareas + (int) framereachability;
-	start_time = botimport.MilliSeconds();
-	//loop over the areas
-	for (i = aasworld.numreachabilityareas; i < aasworld.numareas && i < todo; i++)
+#ifdef REACHABILITY_THREADS
+	//calculate the reachability for a batch of areas on worker threads
+	if (reachabilitythreads > 0 && aasworld.numreachabilityareas < aasworld.numareas)
 	{
-		aasworld.numreachabilityareas++;
-		//only create jumppad reachabilities from jumppad areas
-		if (aasworld.areasettings[i].contents & AREACONTENTS_JUMPPAD)
-		{
-			continue;
-		} //end if
-		//loop over the areas
-		for (j = 1; j < aasworld.numareas; j++)
-		{
-			if (i == j) continue;
-			//never create reachabilities from teleporter or jumppad areas to regular areas
-			if (aasworld.areasettings[i].contents & (AREACONTENTS_TELEPORTER|AREACONTENTS_JUMPPAD))
-			{
-				if (!(aasworld.areasettings[j].contents & (AREACONTENTS_TELEPORTER|AREACONTENTS_JUMPPAD)))
-				{
-					continue;
-				} //end if
-			} //end if
-			//if there already is a reachability link from area i to j
-			if (AAS_ReachabilityExists(i, j)) continue;
-			//check for a swim reachability
-			if (AAS_Reachability_Swim(i, j)) continue;
-			//check for a simple walk on equal floor height reachability
-			if (AAS_Reachability_EqualFloorHeight(i, j)) continue;
-			//check for step, barrier, waterjump and walk off ledge reachabilities
-			if (AAS_Reachability_Step_Barrier_WaterJump_WalkOffLedge(i, j)) continue;
-			//check for ladder reachabilities
-			if (AAS_Reachability_Ladder(i, j)) continue;
-			//check for a jump reachability
-			if (AAS_Reachability_Jump(i, j)) continue;
-		} //end for
-		//never create these reachabilities from teleporter or jumppad areas
-		if (aasworld.areasettings[i].contents & (AREACONTENTS_TELEPORTER|AREACONTENTS_JUMPPAD))
-		{
-			continue;
-		} //end if
+		AAS_ThreadedReachabilityBatch();
+	} //end if
+	else
+#endif //REACHABILITY_THREADS
+	{
+		//number of areas to calculate reachability for this cycle
+		todo = aasworld.numreachabilityareas + (int) framereachability;
+		start_time = botimport.MilliSeconds();
 		//loop over the areas
-		for (j = 1; j < aasworld.numareas; j++)
+		for (i = aasworld.numreachabilityareas; i < aasworld.numareas && i < todo; i++)
 		{
-			if (i == j) continue;
+			aasworld.numreachabilityareas++;
+			//calculate the reachabilities from area i
+			AAS_AreaReachabilities(i, NULL);
+			//if the calculation took more time than the max reachability delay
+			if (botimport.MilliSeconds() - start_time > (int) reachability_delay) break;
 			//
-			if (AAS_ReachabilityExists(i, j)) continue;
-			//check for a grapple hook reachability
-			if (calcgrapplereach) AAS_Reachability_Grapple(i, j);
-			//check for a weapon jump reachability
-			AAS_Reachability_WeaponJump(i, j);
+			if (aasworld.numreachabilityareas * 1000 / aasworld.numareas > lastpercentage) break;
 		} //end for
-		//if the calculation took more time than the max reachability delay
-		if (botimport.MilliSeconds() - start_time > (int) reachability_delay) break;
-		//
-		if (aasworld.numreachabilityareas * 1000 / aasworld.numareas > lastpercentage) break;
-	} //end for
+	} //end else
 	//
 	if (aasworld.numreachabilityareas == aasworld.numareas)
 	{
@@ -4530,6 +4962,7 @@ void AAS_InitReachability(void)
 	} //end if
 #ifndef BSPC
 	calcgrapplereach = LibVarGetValue("grapplereach");
+	reachabilitythreads = LibVarValue("reachabilitythreads", "0");
 #endif
 	aasworld.savefile = qtrue;
 	//start with area 1 because area zero is a dummy
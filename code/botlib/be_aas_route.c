@@ -62,6 +62,35 @@ Suite 120, Rockville, Maryland 20850 USA.
 //maximum number of routing updates each frame
 #define MAX_FRAMEROUTINGUPDATES		10
 
+//smallest routing cache allocation
+#define ROUTINGCACHE_MINSIZE		64
+//number of routing cache size classes, four for every power of two
+#define ROUTINGCACHE_CLASSES		104
+//size of the memory chunks routing caches are allocated from
+#define ROUTINGCACHE_CHUNKSIZE		(64 * 1024)
+//fraction of the routing cache budget freed at once when over budget
+#define ROUTINGCACHE_EVICTFRACTION	8
+
+//number of buckets of the radix heap used to sort routing updates,
+//one for every bit of the unsigned short travel times plus one
+#define ROUTINGQUEUE_BUCKETS		17
+
+//serialize the routing cache updates when the bot AI runs route queries
+//on worker threads, only possible when running as a shared library, the
+//routing cache memory is also allocated and freed with the lock held so
+//the heap calls into the engine are serialized as well
+#if !defined(Q3_VM) && !defined(BSPC)
+#define ROUTING_LOCK
+#endif
+
+#ifdef ROUTING_LOCK
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+#endif //ROUTING_LOCK
+
 
 /*
 
@@ -80,13 +109,69 @@ Suite 120, Rockville, Maryland 20850 USA.
 
 */
 
+//queue with routing updates
+//when sorted the queue is a monotone radix heap on the travel time of the
+//updates, otherwise the updates are processed in first in first out order
+typedef struct aas_routingqueue_s
+{
+	int sorted;										//true when sorted on travel time
+	unsigned short int lasttraveltime;				//travel time of the last update taken from the heap
+	aas_routingupdate_t *start, *end;				//first in first out list
+	aas_routingupdate_t *buckets[ROUTINGQUEUE_BUCKETS];	//radix heap buckets
+} aas_routingqueue_t;
+
+//memory chunk routing caches of one size class are allocated from
+typedef struct aas_routingcachechunk_s
+{
+	int size;										//size of the chunk including this header
+	int numused;									//number of caches in use
+	aas_routingcache_t *freecaches;					//free caches linked through next
+	struct aas_routingcachechunk_s *prev, *next;	//chunks of the size class, the ones with free caches first
+} aas_routingcachechunk_t;
+
+//size of the chunk header, keeps the caches 16 byte aligned
+#define ROUTINGCACHE_CHUNKHEADERSIZE	(((int) sizeof(aas_routingcachechunk_t) + 15) & ~15)
+//every cache in a chunk is preceded by a pointer to the chunk
+#define ROUTINGCACHE_SLOTHEADERSIZE		16
+
+//size class of the routing cache slab allocator
+typedef struct aas_routingcacheclass_s
+{
+	int size;										//allocation size of the caches in this class
+	int numused;									//number of caches in use
+	int numfree;									//number of free caches in the chunks
+	aas_routingcachechunk_t *chunks;				//chunks of this size class
+} aas_routingcacheclass_t;
+
+aas_routingcacheclass_t routingcacheclasses[ROUTINGCACHE_CLASSES];
+
 #ifdef ROUTING_DEBUG
 int numareacacheupdates;
 int numportalcacheupdates;
+int numareacacherelaxations;
+int numportalcacherelaxations;
 #endif //ROUTING_DEBUG
 
+#ifdef ROUTING_LOCK
+#ifdef _WIN32
+CRITICAL_SECTION routingcachelock;
+int routingcachelockinitialized;
+#else
+pthread_mutex_t routingcachelock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+#endif //ROUTING_LOCK
+
 int routingcachesize;
 int max_routingcachesize;
+//memory allocated for routing cache chunks
+int routingcacheslabsize;
+//routing cache statistics
+int routingcachehits;
+int routingcachemisses;
+int routingcacheevictions;
+int routingcacheevictedbytes;
+//true when the routing updates are sorted on travel time
+int routingqueuesorted;
 
 //===========================================================================
 //
@@ -98,11 +183,229 @@ int max_routingcachesize;
 void AAS_RoutingInfo(void)
 {
 	botimport.Print(PRT_MESSAGE, "%d area cache updates\n", numareacacheupdates);
+	botimport.Print(PRT_MESSAGE, "%d area cache relaxations (%.1f per update)\n", numareacacherelaxations,
+					numareacacheupdates ? (float) numareacacherelaxations / numareacacheupdates : 0);
 	botimport.Print(PRT_MESSAGE, "%d portal cache updates\n", numportalcacheupdates);
+	botimport.Print(PRT_MESSAGE, "%d portal cache relaxations (%.1f per update)\n", numportalcacherelaxations,
+					numportalcacheupdates ? (float) numportalcacherelaxations / numportalcacheupdates : 0);
+	botimport.Print(PRT_MESSAGE, "routing updates %s\n", routingqueuesorted ? "sorted on travel time" : "first in first out");
 	botimport.Print(PRT_MESSAGE, "%d bytes routing cache\n", routingcachesize);
 } //end of the function AAS_RoutingInfo
 #endif //ROUTING_DEBUG
 //===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+void AAS_RoutingCacheInfo(void)
+{
+	int i, lookups;
+	aas_routingcacheclass_t *rcclass;
+
+	lookups = routingcachehits + routingcachemisses;
+	botimport.Print(PRT_MESSAGE, "routing cache hits: %d (%d%%)\n", routingcachehits,
+					lookups ? routingcachehits * 100 / lookups : 0);
+	botimport.Print(PRT_MESSAGE, "routing cache misses: %d\n", routingcachemisses);
+	botimport.Print(PRT_MESSAGE, "routing cache evictions: %d (%d KB)\n", routingcacheevictions,
+					routingcacheevictedbytes >> 10);
+	botimport.Print(PRT_MESSAGE, "routing cache in use: %d KB of %d KB budget\n",
+					routingcachesize >> 10, max_routingcachesize >> 10);
+	botimport.Print(PRT_MESSAGE, "routing cache slab memory: %d KB\n", routingcacheslabsize >> 10);
+	for (i = 0; i < ROUTINGCACHE_CLASSES; i++)
+	{
+		rcclass = &routingcacheclasses[i];
+		if (!rcclass->numused && !rcclass->numfree) continue;
+		botimport.Print(PRT_MESSAGE, "%8d bytes: %5d used %5d free\n",
+						rcclass->size, rcclass->numused, rcclass->numfree);
+	} //end for
+} //end of the function AAS_RoutingCacheInfo
+//===========================================================================
+// returns the size class for a routing cache of the given size
+// the classes are spaced a quarter of a power of two apart
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static int AAS_RoutingCacheClass(int size, int *classsize)
+{
+	int n, bits, shift;
+
+	if (size < ROUTINGCACHE_MINSIZE) size = ROUTINGCACHE_MINSIZE;
+	n = size - 1;
+	bits = 0;
+	while (n >> bits) bits++;
+	//keep the three highest bits and round up
+	shift = bits - 3;
+	n = (n >> shift) + 1;
+	*classsize = n << shift;
+	return (bits - 6) * 4 + n - 5;
+} //end of the function AAS_RoutingCacheClass
+//===========================================================================
+// links the chunk in the chunk list of the size class, chunks with free
+// caches are put at the start of the list and full chunks at the end
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static void AAS_LinkRoutingCacheChunk(aas_routingcacheclass_t *rcclass, aas_routingcachechunk_t *chunk)
+{
+	aas_routingcachechunk_t *last;
+
+	if (chunk->freecaches || !rcclass->chunks)
+	{
+		chunk->prev = NULL;
+		chunk->next = rcclass->chunks;
+		if (rcclass->chunks) rcclass->chunks->prev = chunk;
+		rcclass->chunks = chunk;
+	} //end if
+	else
+	{
+		for (last = rcclass->chunks; last->next; last = last->next) ;
+		chunk->prev = last;
+		chunk->next = NULL;
+		last->next = chunk;
+	} //end else
+} //end of the function AAS_LinkRoutingCacheChunk
+//===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static void AAS_UnlinkRoutingCacheChunk(aas_routingcacheclass_t *rcclass, aas_routingcachechunk_t *chunk)
+{
+	if (chunk->prev) chunk->prev->next = chunk->next;
+	else rcclass->chunks = chunk->next;
+	if (chunk->next) chunk->next->prev = chunk->prev;
+	chunk->prev = NULL;
+	chunk->next = NULL;
+} //end of the function AAS_UnlinkRoutingCacheChunk
+//===========================================================================
+// allocates a cleared routing cache of the given size from the slabs
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+aas_routingcache_t *AAS_AllocRoutingCacheMemory(int size)
+{
+	int i, classnum, classsize, chunksize, numcaches;
+	aas_routingcacheclass_t *rcclass;
+	aas_routingcachechunk_t *chunk;
+	aas_routingcache_t *cache;
+	byte *ptr;
+
+	classnum = AAS_RoutingCacheClass(size, &classsize);
+	rcclass = &routingcacheclasses[classnum];
+	rcclass->size = classsize;
+	chunk = rcclass->chunks;
+	//if there are no free caches allocate a new chunk
+	if (!chunk || !chunk->freecaches)
+	{
+		numcaches = (ROUTINGCACHE_CHUNKSIZE - ROUTINGCACHE_CHUNKHEADERSIZE) /
+								(ROUTINGCACHE_SLOTHEADERSIZE + classsize);
+		if (numcaches < 1) numcaches = 1;
+		chunksize = ROUTINGCACHE_CHUNKHEADERSIZE + numcaches * (ROUTINGCACHE_SLOTHEADERSIZE + classsize);
+		chunk = (aas_routingcachechunk_t *) GetMemory(chunksize);
+		chunk->size = chunksize;
+		chunk->numused = 0;
+		chunk->freecaches = NULL;
+		routingcacheslabsize += chunksize;
+		//put all the caches of the chunk on the free list
+		ptr = (byte *) chunk + ROUTINGCACHE_CHUNKHEADERSIZE;
+		for (i = 0; i < numcaches; i++, ptr += ROUTINGCACHE_SLOTHEADERSIZE + classsize)
+		{
+			*(aas_routingcachechunk_t **) ptr = chunk;
+			cache = (aas_routingcache_t *) (ptr + ROUTINGCACHE_SLOTHEADERSIZE);
+			cache->next = chunk->freecaches;
+			chunk->freecaches = cache;
+		} //end for
+		rcclass->numfree += numcaches;
+		AAS_LinkRoutingCacheChunk(rcclass, chunk);
+	} //end if
+	cache = chunk->freecaches;
+	chunk->freecaches = cache->next;
+	chunk->numused++;
+	rcclass->numfree--;
+	rcclass->numused++;
+	//move a full chunk to the end of the list
+	if (!chunk->freecaches && chunk->next)
+	{
+		AAS_UnlinkRoutingCacheChunk(rcclass, chunk);
+		AAS_LinkRoutingCacheChunk(rcclass, chunk);
+	} //end if
+	//
+	Com_Memset(cache, 0, size);
+	cache->size = size;
+	routingcachesize += size;
+	return cache;
+} //end of the function AAS_AllocRoutingCacheMemory
+//===========================================================================
+// returns the routing cache to the free list of it's chunk, a chunk
+// without any caches in use is given back to the heap
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+void AAS_FreeRoutingCacheMemory(aas_routingcache_t *cache)
+{
+	int classsize, wasfull;
+	aas_routingcacheclass_t *rcclass;
+	aas_routingcachechunk_t *chunk;
+
+	rcclass = &routingcacheclasses[AAS_RoutingCacheClass(cache->size, &classsize)];
+	chunk = *(aas_routingcachechunk_t **) ((byte *) cache - ROUTINGCACHE_SLOTHEADERSIZE);
+	routingcachesize -= cache->size;
+	wasfull = !chunk->freecaches;
+	cache->next = chunk->freecaches;
+	chunk->freecaches = cache;
+	chunk->numused--;
+	rcclass->numfree++;
+	rcclass->numused--;
+	//give the memory of an unused chunk back
+	if (!chunk->numused)
+	{
+		AAS_UnlinkRoutingCacheChunk(rcclass, chunk);
+		rcclass->numfree -= (chunk->size - ROUTINGCACHE_CHUNKHEADERSIZE) /
+								(ROUTINGCACHE_SLOTHEADERSIZE + classsize);
+		routingcacheslabsize -= chunk->size;
+		FreeMemory(chunk);
+	} //end if
+	//move a chunk that was full to the start of the list
+	else if (wasfull && chunk->prev)
+	{
+		AAS_UnlinkRoutingCacheChunk(rcclass, chunk);
+		AAS_LinkRoutingCacheChunk(rcclass, chunk);
+	} //end else if
+} //end of the function AAS_FreeRoutingCacheMemory
+//===========================================================================
+// frees all the routing cache chunks, all caches must be freed already
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+void AAS_FreeRoutingCacheChunks(void)
+{
+	int i;
+	aas_routingcachechunk_t *chunk, *nextchunk;
+
+	for (i = 0; i < ROUTINGCACHE_CLASSES; i++)
+	{
+		for (chunk = routingcacheclasses[i].chunks; chunk; chunk = nextchunk)
+		{
+			nextchunk = chunk->next;
+			FreeMemory(chunk);
+		} //end for
+	} //end for
+	routingcacheslabsize = 0;
+	Com_Memset(routingcacheclasses, 0, sizeof(routingcacheclasses));
+} //end of the function AAS_FreeRoutingCacheChunks
+//===========================================================================
 // returns the number of the area in the cluster
 // assumes the given area is in the given cluster or a portal of the cluster
 //
@@ -239,8 +542,7 @@ void AAS_LinkCache(aas_routingcache_t *cache)
 void AAS_FreeRoutingCache(aas_routingcache_t *cache)
 {
 	AAS_UnlinkCache(cache);
-	routingcachesize -= cache->size;
-	FreeMemory(cache);
+	AAS_FreeRoutingCacheMemory(cache);
 } //end of the function AAS_FreeRoutingCache
 //===========================================================================
 //
@@ -303,6 +605,32 @@ void AAS_RemoveRoutingCacheUsingArea( int areanum )
 	} //end for
 } //end of the function AAS_RemoveRoutingCacheUsingArea
 //===========================================================================
+// adds to the number of disabled areas of the cluster the area is in,
+// a portal area is counted for both the clusters it separates
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static void AAS_CountDisabledArea(int areanum, int count)
+{
+	int clusternum;
+	aas_portal_t *portal;
+
+	aasworld.numdisabledareas += count;
+	clusternum = aasworld.areasettings[areanum].cluster;
+	if (clusternum > 0)
+	{
+		aasworld.clusterdisabledareas[clusternum] += count;
+	} //end if
+	else
+	{
+		portal = &aasworld.portals[-clusternum];
+		aasworld.clusterdisabledareas[portal->frontcluster] += count;
+		aasworld.clusterdisabledareas[portal->backcluster] += count;
+	} //end else
+} //end of the function AAS_CountDisabledArea
+//===========================================================================
 //
 // Parameter:			-
 // Returns:				-
@@ -331,6 +659,8 @@ int AAS_EnableRoutingArea(int areanum, int enable)
 	// if the status of the area changed
 	if ( (flags & AREA_DISABLED) != (aasworld.areasettings[areanum].areaflags & AREA_DISABLED) )
 	{
+		//the precomputed routing tables are not used for clusters with disabled areas
+		AAS_CountDisabledArea(areanum, enable ? -1 : 1);
 		//remove all routing cache involving this area
 		AAS_RemoveRoutingCacheUsingArea( areanum );
 	} //end if
@@ -698,9 +1028,37 @@ int AAS_FreeOldestCache(void)
 // Returns:				-
 // Changes Globals:		-
 //===========================================================================
-int AAS_FreeOldestCache(void)
+static void AAS_EvictCache(aas_routingcache_t *cache)
 {
 	int clusterareanum;
+
+	// unlink the cache
+	if (cache->type == CACHETYPE_AREA) {
+		//number of the area in the cluster
+		clusterareanum = AAS_ClusterAreaNum(cache->cluster, cache->areanum);
+		// unlink from cluster area cache
+		if (cache->prev) cache->prev->next = cache->next;
+		else aasworld.clusterareacache[cache->cluster][clusterareanum] = cache->next;
+		if (cache->next) cache->next->prev = cache->prev;
+	}
+	else {
+		// unlink from portal cache
+		if (cache->prev) cache->prev->next = cache->next;
+		else aasworld.portalcache[cache->areanum] = cache->next;
+		if (cache->next) cache->next->prev = cache->prev;
+	}
+	routingcacheevictions++;
+	routingcacheevictedbytes += cache->size;
+	AAS_FreeRoutingCache(cache);
+} //end of the function AAS_EvictCache
+//===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+int AAS_FreeOldestCache(void)
+{
 	aas_routingcache_t *cache;
 
 	for (cache = aasworld.oldestcache; cache; cache = cache->time_next) {
@@ -711,27 +1069,37 @@ int AAS_FreeOldestCache(void)
 		break;
 	}
 	if (cache) {
-		// unlink the cache
-		if (cache->type == CACHETYPE_AREA) {
-			//number of the area in the cluster
-			clusterareanum = AAS_ClusterAreaNum(cache->cluster, cache->areanum);
-			// unlink from cluster area cache
-			if (cache->prev) cache->prev->next = cache->next;
-			else aasworld.clusterareacache[cache->cluster][clusterareanum] = cache->next;
-			if (cache->next) cache->next->prev = cache->prev;
-		}
-		else {
-			// unlink from portal cache
-			if (cache->prev) cache->prev->next = cache->next;
-			else aasworld.portalcache[cache->areanum] = cache->next;
-			if (cache->next) cache->next->prev = cache->prev;
-		}
-		AAS_FreeRoutingCache(cache);
+		AAS_EvictCache(cache);
 		return qtrue;
 	}
 	return qfalse;
 } //end of the function AAS_FreeOldestCache
 //===========================================================================
+// frees the least recently used caches in one pass over the cache list
+// until the routing cache is no larger than the given size
+//
+// Parameter:			-
+// Returns:				number of freed caches
+// Changes Globals:		-
+//===========================================================================
+int AAS_FreeOldestCaches(int size)
+{
+	int numfreed;
+	aas_routingcache_t *cache, *nextcache;
+
+	numfreed = 0;
+	for (cache = aasworld.oldestcache; cache && routingcachesize > size; cache = nextcache) {
+		nextcache = cache->time_next;
+		// never free area cache leading towards a portal
+		if (cache->type == CACHETYPE_AREA && aasworld.areasettings[cache->areanum].cluster < 0) {
+			continue;
+		}
+		AAS_EvictCache(cache);
+		numfreed++;
+	}
+	return numfreed;
+} //end of the function AAS_FreeOldestCaches
+//===========================================================================
 //
 // Parameter:			-
 // Returns:				-
@@ -747,12 +1115,9 @@ aas_routingcache_t *AAS_AllocRoutingCache(int numtraveltimes)
 						+ numtraveltimes * sizeof(unsigned short int)
 						+ numtraveltimes * sizeof(unsigned char);
 	//
-	routingcachesize += size;
-	//
-	cache = (aas_routingcache_t *) GetClearedMemory(size);
+	cache = AAS_AllocRoutingCacheMemory(size);
 	cache->reachabilities = (unsigned char *) cache + sizeof(aas_routingcache_t)
 								+ numtraveltimes * sizeof(unsigned short int);
-	cache->size = size;
 	return cache;
 } //end of the function AAS_AllocRoutingCache
 //===========================================================================
@@ -1042,8 +1407,7 @@ aas_routingcache_t *AAS_ReadCache(fileHandle_t fp)
 	aas_routingcache_t *cache;
 
 	botimport.FS_Read(&size, sizeof(size), fp);
-	cache = (aas_routingcache_t *) GetMemory(size);
-	cache->size = size;
+	cache = AAS_AllocRoutingCacheMemory(size);
 	botimport.FS_Read((unsigned char *)cache + sizeof(size), size - sizeof(size), fp);
 	cache->reachabilities = (unsigned char *) cache + sizeof(aas_routingcache_t) - sizeof(unsigned short) +
 		(size - sizeof(aas_routingcache_t) + sizeof(unsigned short)) / 3 * 2;
@@ -1222,6 +1586,15 @@ void AAS_InitReachabilityAreas(void)
 //===========================================================================
 void AAS_InitRouting(void)
 {
+	int i;
+
+#if defined(ROUTING_LOCK) && defined(_WIN32)
+	if (!routingcachelockinitialized)
+	{
+		InitializeCriticalSection(&routingcachelock);
+		routingcachelockinitialized = qtrue;
+	} //end if
+#endif //ROUTING_LOCK && _WIN32
 	AAS_InitTravelFlagFromType();
 	//
 	AAS_InitAreaContentsTravelFlags();
@@ -1243,12 +1616,29 @@ void AAS_InitRouting(void)
 #ifdef ROUTING_DEBUG
 	numareacacheupdates = 0;
 	numportalcacheupdates = 0;
+	numareacacherelaxations = 0;
+	numportalcacherelaxations = 0;
 #endif //ROUTING_DEBUG
 	//
 	routingcachesize = 0;
 	max_routingcachesize = 1024 * (int) LibVarValue("max_routingcache", "4096");
+	routingcachehits = 0;
+	routingcachemisses = 0;
+	routingcacheevictions = 0;
+	routingcacheevictedbytes = 0;
+	//sort the routing updates on travel time instead of first in first out
+	routingqueuesorted = (int) LibVarValue("routingqueue", "1");
+	//count the areas disabled for routing
+	aasworld.numdisabledareas = 0;
+	aasworld.clusterdisabledareas = (int *) GetClearedMemory(aasworld.numclusters * sizeof(int));
+	for (i = 1; i < aasworld.numareas; i++)
+	{
+		if (aasworld.areasettings[i].areaflags & AREA_DISABLED) AAS_CountDisabledArea(i, 1);
+	} //end for
 	// read any routing cache if available
 	AAS_ReadRouteCache();
+	// read the precomputed routing tables if available
+	if ((int) LibVarValue("routetables", "1")) AAS_ReadRouteTables();
 } //end of the function AAS_InitRouting
 //===========================================================================
 //
@@ -1262,6 +1652,8 @@ void AAS_FreeRoutingCaches(void)
 	AAS_FreeAllClusterAreaCache();
 	// free all the existing portal cache
 	AAS_FreeAllPortalCache();
+	// free the memory the routing caches were allocated from
+	AAS_FreeRoutingCacheChunks();
 	// free cached travel times within areas
 	if (aasworld.areatraveltimes) FreeMemory(aasworld.areatraveltimes);
 	aasworld.areatraveltimes = NULL;
@@ -1285,8 +1677,178 @@ void AAS_FreeRoutingCaches(void)
 	// free area contents travel flags look up table
 	if (aasworld.areacontentstravelflags) FreeMemory(aasworld.areacontentstravelflags);
 	aasworld.areacontentstravelflags = NULL;
+	// free the precomputed routing tables
+	if (aasworld.routetables) FreeMemory(aasworld.routetables);
+	aasworld.routetables = NULL;
+	aasworld.numroutetables = 0;
+	// free the number of disabled areas per cluster
+	if (aasworld.clusterdisabledareas) FreeMemory(aasworld.clusterdisabledareas);
+	aasworld.clusterdisabledareas = NULL;
 } //end of the function AAS_FreeRoutingCaches
 //===========================================================================
+// returns the radix heap bucket for the given travel time
+// bucket 0 stores the updates with the travel time of the last update
+// taken from the heap, bucket n stores the updates for which the highest
+// bit different from that travel time is bit n - 1
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static ID_INLINE int AAS_RoutingQueueBucket(aas_routingqueue_t *queue, unsigned short int traveltime)
+{
+	int bits, bucket;
+
+	//travel times can wrap around, so never sort below the last update
+	if (traveltime <= queue->lasttraveltime) return 0;
+	bits = traveltime ^ queue->lasttraveltime;
+	bucket = 1;
+	if (bits & 0xFF00) { bits >>= 8; bucket += 8; }
+	if (bits & 0xF0) { bits >>= 4; bucket += 4; }
+	if (bits & 0xC) { bits >>= 2; bucket += 2; }
+	if (bits & 0x2) bucket += 1;
+	return bucket;
+} //end of the function AAS_RoutingQueueBucket
+//===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static ID_INLINE void AAS_RoutingQueueLinkBucket(aas_routingqueue_t *queue, aas_routingupdate_t *update, int bucket)
+{
+	update->bucket = bucket;
+	update->prev = NULL;
+	update->next = queue->buckets[bucket];
+	if (queue->buckets[bucket]) queue->buckets[bucket]->prev = update;
+	queue->buckets[bucket] = update;
+} //end of the function AAS_RoutingQueueLinkBucket
+//===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static ID_INLINE void AAS_RoutingQueueUnlinkBucket(aas_routingqueue_t *queue, aas_routingupdate_t *update)
+{
+	if (update->prev) update->prev->next = update->next;
+	else queue->buckets[update->bucket] = update->next;
+	if (update->next) update->next->prev = update->prev;
+} //end of the function AAS_RoutingQueueUnlinkBucket
+//===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static void AAS_InitRoutingQueue(aas_routingqueue_t *queue, aas_routingupdate_t *first)
+{
+	Com_Memset(queue, 0, sizeof(aas_routingqueue_t));
+	queue->sorted = routingqueuesorted;
+	queue->lasttraveltime = first->tmptraveltime;
+	first->next = NULL;
+	first->prev = NULL;
+	first->bucket = 0;
+	first->inlist = qtrue;
+	if (queue->sorted)
+	{
+		queue->buckets[0] = first;
+	} //end if
+	else
+	{
+		queue->start = first;
+		queue->end = first;
+	} //end else
+} //end of the function AAS_InitRoutingQueue
+//===========================================================================
+// adds the update to the queue or when the update is already queued
+// moves it after the travel time of the update decreased
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static void AAS_RoutingQueueUpdate(aas_routingqueue_t *queue, aas_routingupdate_t *update)
+{
+	int bucket;
+
+	if (queue->sorted)
+	{
+		bucket = AAS_RoutingQueueBucket(queue, update->tmptraveltime);
+		if (update->inlist)
+		{
+			if (update->bucket == bucket) return;
+			AAS_RoutingQueueUnlinkBucket(queue, update);
+		} //end if
+		AAS_RoutingQueueLinkBucket(queue, update, bucket);
+		update->inlist = qtrue;
+		return;
+	} //end if
+	if (!update->inlist)
+	{
+		// we add the update to the end of the list
+		update->next = NULL;
+		update->prev = queue->end;
+		if (queue->end) queue->end->next = update;
+		else queue->start = update;
+		queue->end = update;
+		update->inlist = qtrue;
+	} //end if
+} //end of the function AAS_RoutingQueueUpdate
+//===========================================================================
+// removes and returns the first update from the queue, when sorted this
+// is the update with the smallest travel time
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static aas_routingupdate_t *AAS_RoutingQueueRemoveFirst(aas_routingqueue_t *queue)
+{
+	int i;
+	unsigned short int mintraveltime;
+	aas_routingupdate_t *update, *nextupdate;
+
+	if (queue->sorted)
+	{
+		if (!queue->buckets[0])
+		{
+			//find the first non-empty bucket
+			for (i = 1; i < ROUTINGQUEUE_BUCKETS; i++)
+			{
+				if (queue->buckets[i]) break;
+			} //end for
+			if (i >= ROUTINGQUEUE_BUCKETS) return NULL;
+			//the smallest travel time in the bucket becomes the new base
+			mintraveltime = queue->buckets[i]->tmptraveltime;
+			for (update = queue->buckets[i]->next; update; update = update->next)
+			{
+				if (update->tmptraveltime < mintraveltime) mintraveltime = update->tmptraveltime;
+			} //end for
+			queue->lasttraveltime = mintraveltime;
+			//redistribute the updates over the lower buckets
+			update = queue->buckets[i];
+			queue->buckets[i] = NULL;
+			for (; update; update = nextupdate)
+			{
+				nextupdate = update->next;
+				AAS_RoutingQueueLinkBucket(queue, update, AAS_RoutingQueueBucket(queue, update->tmptraveltime));
+			} //end for
+		} //end if
+		update = queue->buckets[0];
+		AAS_RoutingQueueUnlinkBucket(queue, update);
+		update->inlist = qfalse;
+		return update;
+	} //end if
+	update = queue->start;
+	if (!update) return NULL;
+	if (update->next) update->next->prev = NULL;
+	else queue->end = NULL;
+	queue->start = update->next;
+	update->inlist = qfalse;
+	return update;
+} //end of the function AAS_RoutingQueueRemoveFirst
+//===========================================================================
 // update the given routing cache
 //
 // Parameter:			areacache		: routing cache to update
@@ -1298,7 +1860,8 @@ void AAS_UpdateAreaRoutingCache(aas_routingcache_t *areacache)
 	int i, nextareanum, cluster, badtravelflags, clusterareanum, linknum;
 	int numreachabilityareas;
 	unsigned short int t, startareatraveltimes[128]; //NOTE: not more than 128 reachabilities per area allowed
-	aas_routingupdate_t *updateliststart, *updatelistend, *curupdate, *nextupdate;
+	aas_routingqueue_t queue;
+	aas_routingupdate_t *curupdate, *nextupdate;
 	aas_reachability_t *reach;
 	aas_reversedreachability_t *revreach;
 	aas_reversedlink_t *revlink;
@@ -1327,21 +1890,11 @@ void AAS_UpdateAreaRoutingCache(aas_routingcache_t *areacache)
 	curupdate->tmptraveltime = areacache->starttraveltime;
 	//
 	areacache->traveltimes[clusterareanum] = areacache->starttraveltime;
-	//put the area to start with in the current read list
-	curupdate->next = NULL;
-	curupdate->prev = NULL;
-	updateliststart = curupdate;
-	updatelistend = curupdate;
-	//while there are updates in the current list
-	while (updateliststart)
+	//put the area to start with in the routing queue
+	AAS_InitRoutingQueue(&queue, curupdate);
+	//while there are updates in the queue
+	while ((curupdate = AAS_RoutingQueueRemoveFirst(&queue)) != NULL)
 	{
-		curupdate = updateliststart;
-		//
-		if (curupdate->next) curupdate->next->prev = NULL;
-		else updatelistend = NULL;
-		updateliststart = curupdate->next;
-		//
-		curupdate->inlist = qfalse;
 		//check all reversed reachability links
 		revreach = &aasworld.reversedreachability[curupdate->areanum];
 		//
@@ -1374,6 +1927,9 @@ void AAS_UpdateAreaRoutingCache(aas_routingcache_t *areacache)
 			if (!areacache->traveltimes[clusterareanum] ||
 					areacache->traveltimes[clusterareanum] > t)
 			{
+#ifdef ROUTING_DEBUG
+				numareacacherelaxations++;
+#endif //ROUTING_DEBUG
 				areacache->traveltimes[clusterareanum] = t;
 				areacache->reachabilities[clusterareanum] = linknum - aasworld.areasettings[nextareanum].firstreachablearea;
 				nextupdate = &aasworld.areaupdate[clusterareanum];
@@ -1382,18 +1938,7 @@ void AAS_UpdateAreaRoutingCache(aas_routingcache_t *areacache)
 				//VectorCopy(reach->start, nextupdate->start);
 				nextupdate->areatraveltimes = aasworld.areatraveltimes[nextareanum][linknum -
 													aasworld.areasettings[nextareanum].firstreachablearea];
-				if (!nextupdate->inlist)
-				{
-					// we add the update to the end of the list
-					// we could also use a B+ tree to have a real sorted list
-					// on travel time which makes for faster routing updates
-					nextupdate->next = NULL;
-					nextupdate->prev = updatelistend;
-					if (updatelistend) updatelistend->next = nextupdate;
-					else updateliststart = nextupdate;
-					updatelistend = nextupdate;
-					nextupdate->inlist = qtrue;
-				} //end if
+				AAS_RoutingQueueUpdate(&queue, nextupdate);
 			} //end if
 		} //end for
 	} //end while
@@ -1433,10 +1978,12 @@ aas_routingcache_t *AAS_GetAreaRoutingCache(int clusternum, int areanum, int tra
 		if (clustercache) clustercache->prev = cache;
 		aasworld.clusterareacache[clusternum][clusterareanum] = cache;
 		AAS_UpdateAreaRoutingCache(cache);
+		routingcachemisses++;
 	} //end if
 	else
 	{
 		AAS_UnlinkCache(cache);
+		routingcachehits++;
 	} //end else
 	//the cache has been accessed
 	cache->time = AAS_RoutingTime();
@@ -1445,23 +1992,75 @@ aas_routingcache_t *AAS_GetAreaRoutingCache(int clusternum, int areanum, int tra
 	return cache;
 } //end of the function AAS_GetAreaRoutingCache
 //===========================================================================
+// returns the precomputed route table for the travel flags if available
 //
 // Parameter:			-
 // Returns:				-
 // Changes Globals:		-
 //===========================================================================
-void AAS_UpdatePortalRoutingCache(aas_routingcache_t *portalcache)
+static ID_INLINE aas_routetable_t *AAS_RouteTableForTravelFlags(int travelflags)
 {
-	int i, portalnum, clusterareanum, clusternum;
-	unsigned short int t;
-	aas_portal_t *portal;
-	aas_cluster_t *cluster;
+	int i;
+
+	for (i = 0; i < aasworld.numroutetables; i++)
+	{
+		if (aasworld.routetables[i].travelflags == travelflags) return &aasworld.routetables[i];
+	} //end for
+	return NULL;
+} //end of the function AAS_RouteTableForTravelFlags
+//===========================================================================
+// returns the travel times and reachabilities from all the reachability
+// areas of the cluster towards the given area, read from the precomputed
+// route table when the cluster has no disabled areas, the tables are
+// computed without any areas disabled
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static void AAS_ClusterAreaRoute(int clusternum, int areanum, int travelflags,
+									unsigned short int **traveltimes, unsigned char **reachabilities)
+{
+	int n, clusterareanum;
+	aas_routetable_t *table;
 	aas_routingcache_t *cache;
-	aas_routingupdate_t *updateliststart, *updatelistend, *curupdate, *nextupdate;
 
-#ifdef ROUTING_DEBUG
-	numportalcacheupdates++;
-#endif //ROUTING_DEBUG
+	table = AAS_RouteTableForTravelFlags(travelflags);
+	if (table && !aasworld.clusterdisabledareas[clusternum])
+	{
+		n = aasworld.clusters[clusternum].numreachabilityareas;
+		clusterareanum = AAS_ClusterAreaNum(clusternum, areanum);
+		if (clusterareanum < n)
+		{
+			*traveltimes = table->clustertraveltimes[clusternum] + clusterareanum * n;
+			*reachabilities = table->clusterreachabilities[clusternum] + clusterareanum * n;
+			return;
+		} //end if
+	} //end if
+	cache = AAS_GetAreaRoutingCache(clusternum, areanum, travelflags);
+	*traveltimes = cache->traveltimes;
+	*reachabilities = cache->reachabilities;
+} //end of the function AAS_ClusterAreaRoute
+//===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+void AAS_UpdatePortalRoutingCache(aas_routingcache_t *portalcache)
+{
+	int i, portalnum, clusterareanum, clusternum;
+	unsigned short int t;
+	aas_portal_t *portal;
+	unsigned short int *traveltimes;
+	unsigned char *reachabilities;
+	aas_cluster_t *cluster;
+	aas_routingqueue_t queue;
+	aas_routingupdate_t *curupdate, *nextupdate;
+
+#ifdef ROUTING_DEBUG
+	numportalcacheupdates++;
+#endif //ROUTING_DEBUG
 	//clear the routing update fields
 //	Com_Memset(aasworld.portalupdate, 0, (aasworld.numportals+1) * sizeof(aas_routingupdate_t));
 	//
@@ -1475,26 +2074,16 @@ void AAS_UpdatePortalRoutingCache(aas_routingcache_t *portalcache)
 	{
 		portalcache->traveltimes[-clusternum] = portalcache->starttraveltime;
 	} //end if
-	//put the area to start with in the current read list
-	curupdate->next = NULL;
-	curupdate->prev = NULL;
-	updateliststart = curupdate;
-	updatelistend = curupdate;
-	//while there are updates in the current list
-	while (updateliststart)
+	//put the area to start with in the routing queue
+	AAS_InitRoutingQueue(&queue, curupdate);
+	//while there are updates in the queue
+	while ((curupdate = AAS_RoutingQueueRemoveFirst(&queue)) != NULL)
 	{
-		curupdate = updateliststart;
-		//remove the current update from the list
-		if (curupdate->next) curupdate->next->prev = NULL;
-		else updatelistend = NULL;
-		updateliststart = curupdate->next;
-		//current update is removed from the list
-		curupdate->inlist = qfalse;
 		//
 		cluster = &aasworld.clusters[curupdate->cluster];
 		//
-		cache = AAS_GetAreaRoutingCache(curupdate->cluster,
-								curupdate->areanum, portalcache->travelflags);
+		AAS_ClusterAreaRoute(curupdate->cluster, curupdate->areanum,
+								portalcache->travelflags, &traveltimes, &reachabilities);
 		//take all portals of the cluster
 		for (i = 0; i < cluster->numportals; i++)
 		{
@@ -1506,13 +2095,16 @@ void AAS_UpdatePortalRoutingCache(aas_routingcache_t *portalcache)
 			clusterareanum = AAS_ClusterAreaNum(curupdate->cluster, portal->areanum);
 			if (clusterareanum >= cluster->numreachabilityareas) continue;
 			//
-			t = cache->traveltimes[clusterareanum];
+			t = traveltimes[clusterareanum];
 			if (!t) continue;
 			t += curupdate->tmptraveltime;
 			//
 			if (!portalcache->traveltimes[portalnum] ||
 					portalcache->traveltimes[portalnum] > t)
 			{
+#ifdef ROUTING_DEBUG
+				numportalcacherelaxations++;
+#endif //ROUTING_DEBUG
 				portalcache->traveltimes[portalnum] = t;
 				nextupdate = &aasworld.portalupdate[portalnum];
 				if (portal->frontcluster == curupdate->cluster)
@@ -1526,18 +2118,7 @@ void AAS_UpdatePortalRoutingCache(aas_routingcache_t *portalcache)
 				nextupdate->areanum = portal->areanum;
 				//add travel time through the actual portal area for the next update
 				nextupdate->tmptraveltime = t + aasworld.portalmaxtraveltimes[portalnum];
-				if (!nextupdate->inlist)
-				{
-					// we add the update to the end of the list
-					// we could also use a B+ tree to have a real sorted list
-					// on travel time which makes for faster routing updates
-					nextupdate->next = NULL;
-					nextupdate->prev = updatelistend;
-					if (updatelistend) updatelistend->next = nextupdate;
-					else updateliststart = nextupdate;
-					updatelistend = nextupdate;
-					nextupdate->inlist = qtrue;
-				} //end if
+				AAS_RoutingQueueUpdate(&queue, nextupdate);
 			} //end if
 		} //end for
 	} //end while
@@ -1573,10 +2154,12 @@ aas_routingcache_t *AAS_GetPortalRoutingCache(int clusternum, int areanum, int t
 		aasworld.portalcache[areanum] = cache;
 		//update the cache
 		AAS_UpdatePortalRoutingCache(cache);
+		routingcachemisses++;
 	} //end if
 	else
 	{
 		AAS_UnlinkCache(cache);
+		routingcachehits++;
 	} //end else
 	//the cache has been accessed
 	cache->time = AAS_RoutingTime();
@@ -1590,53 +2173,555 @@ aas_routingcache_t *AAS_GetPortalRoutingCache(int clusternum, int areanum, int t
 // Returns:				-
 // Changes Globals:		-
 //===========================================================================
-int AAS_AreaRouteToGoalArea(int areanum, vec3_t origin, int goalareanum, int travelflags, int *traveltime, int *reachnum)
+
+//the route table header
+//this header is followed by numtables travel flags and for every table
+//the area travel times and reachabilities of every cluster and the
+//travel times between all portals
+typedef struct routetableheader_s
 {
-	int clusternum, goalclusternum, portalnum, i, clusterareanum, bestreachnum;
-	unsigned short int t, besttime;
+	int ident;
+	int version;
+	int numareas;
+	int numclusters;
+	int numportals;
+	int areacrc;
+	int clustercrc;
+	int numtables;
+} routetableheader_t;
+
+#define RTID						(('B'<<24)+('A'<<16)+('T'<<8)+'R')
+#define RTVERSION					1
+
+//travel flags the routing tables are computed for
+static const int routetabletravelflags[] =
+{
+	TFL_DEFAULT,
+	TFL_DEFAULT|TFL_DONOTENTER
+};
+
+#define NUM_ROUTETABLES		ARRAY_LEN(routetabletravelflags)
+
+//===========================================================================
+// returns the size of the table data of one set of travel flags
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static int AAS_RouteTableSize(void)
+{
+	int i, n, size;
+
+	size = 0;
+	for (i = 1; i < aasworld.numclusters; i++)
+	{
+		n = aasworld.clusters[i].numreachabilityareas;
+		size += PAD(n * n * (sizeof(unsigned short int) + sizeof(unsigned char)), sizeof(int));
+	} //end for
+	size += PAD(aasworld.numportals * aasworld.numportals * sizeof(unsigned short int), sizeof(int));
+	return size;
+} //end of the function AAS_RouteTableSize
+//===========================================================================
+// stores the area number for every reachability area of the cluster
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static void AAS_ClusterReachabilityAreas(int clusternum, int *areas)
+{
+	int i, side, portalnum, clusterareanum;
+	aas_cluster_t *cluster;
+	aas_portal_t *portal;
+
+	cluster = &aasworld.clusters[clusternum];
+	for (i = 1; i < aasworld.numareas; i++)
+	{
+		if (aasworld.areasettings[i].cluster != clusternum) continue;
+		clusterareanum = aasworld.areasettings[i].clusterareanum;
+		if (clusterareanum < cluster->numreachabilityareas) areas[clusterareanum] = i;
+	} //end for
+	for (i = 0; i < cluster->numportals; i++)
+	{
+		portalnum = aasworld.portalindex[cluster->firstportal + i];
+		portal = &aasworld.portals[portalnum];
+		side = portal->frontcluster != clusternum;
+		clusterareanum = portal->clusterareanum[side];
+		if (clusterareanum < cluster->numreachabilityareas) areas[clusterareanum] = portal->areanum;
+	} //end for
+} //end of the function AAS_ClusterReachabilityAreas
+//===========================================================================
+// calculates the travel times from all portals towards the given portal
+// entering both clusters the portal separates
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static void AAS_PortalToPortalTravelTimes(int portalnum, int travelflags, unsigned short int *traveltimes)
+{
+	int i, side;
+	aas_portal_t *portal;
+	aas_routingcache_t *cache;
+
+	portal = &aasworld.portals[portalnum];
+	Com_Memset(traveltimes, 0, aasworld.numportals * sizeof(unsigned short int));
+	cache = AAS_AllocRoutingCache(aasworld.numportals);
+	for (side = 0; side < 2; side++)
+	{
+		Com_Memset(cache->traveltimes, 0, aasworld.numportals * sizeof(unsigned short int));
+		cache->cluster = side ? portal->backcluster : portal->frontcluster;
+		cache->areanum = portal->areanum;
+		VectorCopy(aasworld.areas[portal->areanum].center, cache->origin);
+		cache->starttraveltime = 1;
+		cache->travelflags = travelflags;
+		cache->type = CACHETYPE_PORTAL;
+		AAS_UpdatePortalRoutingCache(cache);
+		for (i = 0; i < aasworld.numportals; i++)
+		{
+			if (!cache->traveltimes[i]) continue;
+			if (!traveltimes[i] || cache->traveltimes[i] < traveltimes[i])
+			{
+				traveltimes[i] = cache->traveltimes[i];
+			} //end if
+		} //end for
+	} //end for
+	//the cache was never linked into the cache lists
+	AAS_FreeRoutingCacheMemory(cache);
+} //end of the function AAS_PortalToPortalTravelTimes
+//===========================================================================
+// computes the travel times between all areas of every cluster and
+// between all portals and writes them to the route table file
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+void AAS_WriteRouteTables(void)
+{
+	int i, j, n, t, size, totalsize, starttime;
+	int *areas;
+	byte *buf;
+	fileHandle_t fp;
+	char filename[MAX_QPATH];
+	routetableheader_t routetableheader;
+	aas_routingcache_t *cache;
+
+	if (!aasworld.initialized)
+	{
+		botimport.Print(PRT_ERROR, "AAS not initialized, can't write route tables\n");
+		return;
+	} //end if
+	if (aasworld.numdisabledareas)
+	{
+		botimport.Print(PRT_ERROR, "%d areas disabled for routing, can't write route tables\n", aasworld.numdisabledareas);
+		return;
+	} //end if
+	starttime = botimport.MilliSeconds();
+	// open the file for writing
+	Com_sprintf(filename, MAX_QPATH, "maps/%s.rtb", aasworld.mapname);
+	botimport.FS_FOpenFile( filename, &fp, FS_WRITE );
+	if (!fp)
+	{
+		AAS_Error("Unable to open file: %s\n", filename);
+		return;
+	} //end if
+	//create the header
+	routetableheader.ident = RTID;
+	routetableheader.version = RTVERSION;
+	routetableheader.numareas = aasworld.numareas;
+	routetableheader.numclusters = aasworld.numclusters;
+	routetableheader.numportals = aasworld.numportals;
+	routetableheader.areacrc = CRC_ProcessString( (unsigned char *)aasworld.areas, sizeof(aas_area_t) * aasworld.numareas );
+	routetableheader.clustercrc = CRC_ProcessString( (unsigned char *)aasworld.clusters, sizeof(aas_cluster_t) * aasworld.numclusters );
+	routetableheader.numtables = NUM_ROUTETABLES;
+	//write the header and the travel flags of the tables
+	botimport.FS_Write(&routetableheader, sizeof(routetableheader_t), fp);
+	botimport.FS_Write(routetabletravelflags, sizeof(routetabletravelflags), fp);
+	//
+	//buffer large enough for the tables of any cluster or the portal table
+	size = PAD(aasworld.numportals * aasworld.numportals * sizeof(unsigned short int), sizeof(int));
+	for (i = 1; i < aasworld.numclusters; i++)
+	{
+		n = aasworld.clusters[i].numreachabilityareas;
+		n = PAD(n * n * (sizeof(unsigned short int) + sizeof(unsigned char)), sizeof(int));
+		if (n > size) size = n;
+	} //end for
+	buf = (byte *) GetClearedMemory(size + aasworld.numareas * sizeof(int));
+	areas = (int *) (buf + size);
+	//
+	totalsize = 0;
+	for (t = 0; t < NUM_ROUTETABLES; t++)
+	{
+		//area to area travel times within every cluster
+		for (i = 1; i < aasworld.numclusters; i++)
+		{
+			n = aasworld.clusters[i].numreachabilityareas;
+			size = PAD(n * n * (sizeof(unsigned short int) + sizeof(unsigned char)), sizeof(int));
+			Com_Memset(buf, 0, size);
+			AAS_ClusterReachabilityAreas(i, areas);
+			for (j = 0; j < n; j++)
+			{
+				cache = AAS_GetAreaRoutingCache(i, areas[j], routetabletravelflags[t]);
+				Com_Memcpy(buf + j * n * sizeof(unsigned short int), cache->traveltimes, n * sizeof(unsigned short int));
+				Com_Memcpy(buf + n * n * sizeof(unsigned short int) + j * n, cache->reachabilities, n);
+			} //end for
+			botimport.FS_Write(buf, size, fp);
+			totalsize += size;
+			//don't keep all the cache of the cluster around
+			AAS_RemoveRoutingCacheInCluster(i);
+		} //end for
+		//travel times between all portals
+		for (i = 0; i < aasworld.numportals; i++)
+		{
+			AAS_PortalToPortalTravelTimes(i, routetabletravelflags[t],
+							(unsigned short int *) buf + i * aasworld.numportals);
+			// make sure the routing cache doesn't grow to large
+			if (routingcachesize > max_routingcachesize) {
+				AAS_FreeOldestCaches(max_routingcachesize - max_routingcachesize / ROUTINGCACHE_EVICTFRACTION);
+			}
+			while(AvailableMemory() < 1 * 1024 * 1024) {
+				if (!AAS_FreeOldestCache()) break;
+			}
+		} //end for
+		size = PAD(aasworld.numportals * aasworld.numportals * sizeof(unsigned short int), sizeof(int));
+		botimport.FS_Write(buf, size, fp);
+		totalsize += size;
+	} //end for
+	FreeMemory(buf);
+	//
+	botimport.FS_FCloseFile(fp);
+	botimport.Print(PRT_MESSAGE, "\nroute tables written to %s\n", filename);
+	botimport.Print(PRT_MESSAGE, "written %d bytes of route tables in %d msec\n", totalsize, botimport.MilliSeconds() - starttime);
+} //end of the function AAS_WriteRouteTables
+//===========================================================================
+// reads the precomputed route tables of the current map if available
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+int AAS_ReadRouteTables(void)
+{
+	int i, t, n, tablesize, size, filelen;
+	int travelflags[NUM_ROUTETABLES];
+	fileHandle_t fp;
+	char filename[MAX_QPATH];
+	routetableheader_t routetableheader;
+	aas_routetable_t *table;
+	byte *ptr;
+
+	Com_sprintf(filename, MAX_QPATH, "maps/%s.rtb", aasworld.mapname);
+	filelen = botimport.FS_FOpenFile( filename, &fp, FS_READ );
+	if (!fp)
+	{
+		return qfalse;
+	} //end if
+	botimport.FS_Read(&routetableheader, sizeof(routetableheader_t), fp );
+	if (routetableheader.ident != RTID)
+	{
+		AAS_Error("%s is not a route table file\n", filename);
+		botimport.FS_FCloseFile(fp);
+		return qfalse;
+	} //end if
+	if (routetableheader.version != RTVERSION)
+	{
+		AAS_Error("route table file has wrong version %d, should be %d\n", routetableheader.version, RTVERSION);
+		botimport.FS_FCloseFile(fp);
+		return qfalse;
+	} //end if
+	if (routetableheader.numareas != aasworld.numareas ||
+		routetableheader.numclusters != aasworld.numclusters ||
+		routetableheader.numportals != aasworld.numportals ||
+		routetableheader.numtables <= 0 || routetableheader.numtables > NUM_ROUTETABLES ||
+		routetableheader.areacrc !=
+			CRC_ProcessString( (unsigned char *)aasworld.areas, sizeof(aas_area_t) * aasworld.numareas ) ||
+		routetableheader.clustercrc !=
+			CRC_ProcessString( (unsigned char *)aasworld.clusters, sizeof(aas_cluster_t) * aasworld.numclusters ))
+	{
+		botimport.Print(PRT_WARNING, "%s is out of date\n", filename);
+		botimport.FS_FCloseFile(fp);
+		return qfalse;
+	} //end if
+	tablesize = AAS_RouteTableSize();
+	if (filelen != sizeof(routetableheader_t) + routetableheader.numtables * (sizeof(int) + tablesize))
+	{
+		botimport.Print(PRT_WARNING, "%s has wrong size\n", filename);
+		botimport.FS_FCloseFile(fp);
+		return qfalse;
+	} //end if
+	botimport.FS_Read(travelflags, routetableheader.numtables * sizeof(int), fp);
+	//allocate the tables, the pointers into the table data and the data in one block
+	size = routetableheader.numtables * (sizeof(aas_routetable_t) +
+				aasworld.numclusters * (sizeof(unsigned short int *) + sizeof(unsigned char *)));
+	size = PAD(size, sizeof(int));
+	ptr = (byte *) GetClearedMemory(size + routetableheader.numtables * tablesize);
+	//read all the table data at once
+	botimport.FS_Read(ptr + size, routetableheader.numtables * tablesize, fp);
+	botimport.FS_FCloseFile(fp);
+	//
+	aasworld.routetables = (aas_routetable_t *) ptr;
+	aasworld.numroutetables = routetableheader.numtables;
+	ptr += routetableheader.numtables * sizeof(aas_routetable_t);
+	for (t = 0; t < aasworld.numroutetables; t++)
+	{
+		table = &aasworld.routetables[t];
+		table->travelflags = travelflags[t];
+		table->clustertraveltimes = (unsigned short int **) ptr;
+		ptr += aasworld.numclusters * sizeof(unsigned short int *);
+		table->clusterreachabilities = (unsigned char **) ptr;
+		ptr += aasworld.numclusters * sizeof(unsigned char *);
+	} //end for
+	ptr = (byte *) aasworld.routetables + size;
+	for (t = 0; t < aasworld.numroutetables; t++)
+	{
+		table = &aasworld.routetables[t];
+		for (i = 1; i < aasworld.numclusters; i++)
+		{
+			n = aasworld.clusters[i].numreachabilityareas;
+			table->clustertraveltimes[i] = (unsigned short int *) ptr;
+			table->clusterreachabilities[i] = ptr + n * n * sizeof(unsigned short int);
+			ptr += PAD(n * n * (sizeof(unsigned short int) + sizeof(unsigned char)), sizeof(int));
+		} //end for
+		table->portaltraveltimes = (unsigned short int *) ptr;
+		ptr += PAD(aasworld.numportals * aasworld.numportals * sizeof(unsigned short int), sizeof(int));
+	} //end for
+	botimport.Print(PRT_DEVELOPER, "loaded %d route tables from %s\n", aasworld.numroutetables, filename);
+	return qtrue;
+} //end of the function AAS_ReadRouteTables
+//===========================================================================
+// returns the travel time from the portal towards the goal area
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static int AAS_RouteTablePortalTravelTime(aas_routetable_t *table, int goalclusternum, int goalareanum, int portalnum)
+{
+	int i, n, goalclusterareanum, clusterareanum, goalportalnum;
+	int t, besttime;
+	unsigned short int *traveltimes;
+	aas_cluster_t *cluster;
+
+	//if the goal area is a portal
+	if (aasworld.areasettings[goalareanum].cluster < 0)
+	{
+		return table->portaltraveltimes[-aasworld.areasettings[goalareanum].cluster * aasworld.numportals + portalnum];
+	} //end if
+	cluster = &aasworld.clusters[goalclusternum];
+	n = cluster->numreachabilityareas;
+	goalclusterareanum = AAS_ClusterAreaNum(goalclusternum, goalareanum);
+	if (goalclusterareanum >= n) return 0;
+	traveltimes = table->clustertraveltimes[goalclusternum] + goalclusterareanum * n;
+	besttime = 0;
+	//leave the goal cluster through any of it's portals
+	for (i = 0; i < cluster->numportals; i++)
+	{
+		goalportalnum = aasworld.portalindex[cluster->firstportal + i];
+		clusterareanum = AAS_ClusterAreaNum(goalclusternum, aasworld.portals[goalportalnum].areanum);
+		if (clusterareanum >= n) continue;
+		if (!traveltimes[clusterareanum]) continue;
+		t = traveltimes[clusterareanum] + 1;
+		if (goalportalnum != portalnum)
+		{
+			if (!table->portaltraveltimes[goalportalnum * aasworld.numportals + portalnum]) continue;
+			//add travel time through the portal area and between the portals
+			t += aasworld.portalmaxtraveltimes[goalportalnum] +
+					table->portaltraveltimes[goalportalnum * aasworld.numportals + portalnum] - 1;
+		} //end if
+		if (!besttime || t < besttime) besttime = t;
+	} //end for
+	return besttime;
+} //end of the function AAS_RouteTablePortalTravelTime
+//===========================================================================
+// finds the route from the area through the portals of the given cluster
+// towards the goal area in another cluster using the route tables
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static int AAS_RouteTableClusterExit(aas_routetable_t *table, int clusternum, int areanum, vec3_t origin,
+										int goalclusternum, int goalareanum, int *traveltime, int *reachnum)
+{
+	int portalnum, i, n, clusterareanum, goalclusterareanum;
+	int t, besttime, bestreachnum, reachoffset, portaltime;
 	aas_portal_t *portal;
 	aas_cluster_t *cluster;
-	aas_routingcache_t *areacache, *portalcache;
 	aas_reachability_t *reach;
 
-	if (!aasworld.initialized) return qfalse;
-
-	if (areanum == goalareanum)
+	besttime = 0;
+	bestreachnum = -1;
+	//the cluster the area is in
+	cluster = &aasworld.clusters[clusternum];
+	n = cluster->numreachabilityareas;
+	//current area inside the current cluster
+	clusterareanum = AAS_ClusterAreaNum(clusternum, areanum);
+	//if the area is NOT a reachability area
+	if (clusterareanum >= n) return qfalse;
+	//find the portal of the area cluster leading towards the goal area
+	for (i = 0; i < cluster->numportals; i++)
 	{
-		*traveltime = 1;
-		*reachnum = 0;
-		return qtrue;
+		portalnum = aasworld.portalindex[cluster->firstportal + i];
+		portal = &aasworld.portals[portalnum];
+		//if the area itself is this portal
+		if (portal->areanum == areanum) continue;
+		goalclusterareanum = AAS_ClusterAreaNum(clusternum, portal->areanum);
+		if (goalclusterareanum >= n) continue;
+		//if the portal is NOT reachable from this area
+		t = table->clustertraveltimes[clusternum][goalclusterareanum * n + clusterareanum];
+		if (!t) continue;
+		//if the goal area isn't reachable from the portal
+		portaltime = AAS_RouteTablePortalTravelTime(table, goalclusternum, goalareanum, portalnum);
+		if (!portaltime) continue;
+		//NOTE: for now we just add the largest travel time through the portal area
+		t += portaltime + aasworld.portalmaxtraveltimes[portalnum];
+		reachoffset = table->clusterreachabilities[clusternum][goalclusterareanum * n + clusterareanum];
+		if (origin)
+		{
+			reach = &aasworld.reachability[aasworld.areasettings[areanum].firstreachablearea + reachoffset];
+			t += AAS_AreaTravelTime(areanum, origin, reach->start);
+		} //end if
+		//if the time is better than the one already found
+		if (!besttime || t < besttime)
+		{
+			bestreachnum = aasworld.areasettings[areanum].firstreachablearea + reachoffset;
+			besttime = t;
+		} //end if
+	} //end for
+	if (bestreachnum < 0) {
+		return qfalse;
 	}
-	//check !AAS_AreaReachability(areanum) with custom developer-only debug message
-	if (areanum <= 0 || areanum >= aasworld.numareas)
+	*reachnum = bestreachnum;
+	*traveltime = besttime;
+	return qtrue;
+} //end of the function AAS_RouteTableClusterExit
+//===========================================================================
+// same as AAS_AreaRouteToGoalArea but using the precomputed route tables
+// returns -1 when the route can't be found with the tables because of
+// disabled areas
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static int AAS_RouteTableRouteToGoalArea(aas_routetable_t *table, int areanum, vec3_t origin, int goalareanum, int *traveltime, int *reachnum)
+{
+	int clusternum, goalclusternum, i, n, clusterareanum, goalclusterareanum;
+	int t, fronttime, frontreachnum;
+	aas_portal_t *portal;
+	aas_reachability_t *reach;
+
+	clusternum = aasworld.areasettings[areanum].cluster;
+	goalclusternum = aasworld.areasettings[goalareanum].cluster;
+	//check if the area is a portal of the goal area cluster
+	if (clusternum < 0 && goalclusternum > 0)
 	{
-		if (botDeveloper)
+		portal = &aasworld.portals[-clusternum];
+		if (portal->frontcluster == goalclusternum ||
+				portal->backcluster == goalclusternum)
 		{
-			botimport.Print(PRT_ERROR, "AAS_AreaTravelTimeToGoalArea: areanum %d out of range\n", areanum);
+			clusternum = goalclusternum;
 		} //end if
-		return qfalse;
 	} //end if
-	if (goalareanum <= 0 || goalareanum >= aasworld.numareas)
+	//check if the goalarea is a portal of the area cluster
+	else if (clusternum > 0 && goalclusternum < 0)
 	{
-		if (botDeveloper)
+		portal = &aasworld.portals[-goalclusternum];
+		if (portal->frontcluster == clusternum ||
+				portal->backcluster == clusternum)
 		{
-			botimport.Print(PRT_ERROR, "AAS_AreaTravelTimeToGoalArea: goalareanum %d out of range\n", goalareanum);
+			goalclusternum = clusternum;
 		} //end if
-		return qfalse;
 	} //end if
-	if (!aasworld.areasettings[areanum].numreachableareas || !aasworld.areasettings[goalareanum].numreachableareas)
+	//if both areas are in the same cluster
+	if (clusternum > 0 && goalclusternum > 0 && clusternum == goalclusternum)
 	{
-		return qfalse;
+		//the cluster table is computed without the disabled areas
+		if (aasworld.clusterdisabledareas[clusternum]) return -1;
+		n = aasworld.clusters[clusternum].numreachabilityareas;
+		clusterareanum = AAS_ClusterAreaNum(clusternum, areanum);
+		//if the area is NOT a reachability area
+		if (clusterareanum >= n) return qfalse;
+		goalclusterareanum = AAS_ClusterAreaNum(clusternum, goalareanum);
+		if (goalclusterareanum < n)
+		{
+			i = goalclusterareanum * n + clusterareanum;
+			t = table->clustertraveltimes[clusternum][i];
+			if (t)
+			{
+				*reachnum = aasworld.areasettings[areanum].firstreachablearea +
+								table->clusterreachabilities[clusternum][i];
+				if (origin)
+				{
+					reach = &aasworld.reachability[*reachnum];
+					t += AAS_AreaTravelTime(areanum, origin, reach->start);
+				} //end if
+				*traveltime = t;
+				return qtrue;
+			} //end if
+		} //end if
+	} //end if
+	//the portal table goes through all clusters so it can't be used with disabled areas
+	if (aasworld.numdisabledareas) return -1;
+	//
+	clusternum = aasworld.areasettings[areanum].cluster;
+	goalclusternum = aasworld.areasettings[goalareanum].cluster;
+	//if the goal area is a portal
+	if (goalclusternum < 0)
+	{
+		//just assume the goal area is part of the front cluster
+		portal = &aasworld.portals[-goalclusternum];
+		goalclusternum = portal->frontcluster;
+	} //end if
+	//if the area is a cluster portal leave through the best of both clusters
+	if (clusternum < 0)
+	{
+		portal = &aasworld.portals[-clusternum];
+		if (!AAS_RouteTableClusterExit(table, portal->frontcluster, areanum, origin,
+										goalclusternum, goalareanum, &fronttime, &frontreachnum))
+		{
+			return AAS_RouteTableClusterExit(table, portal->backcluster, areanum, origin,
+										goalclusternum, goalareanum, traveltime, reachnum);
+		} //end if
+		if (!AAS_RouteTableClusterExit(table, portal->backcluster, areanum, origin,
+										goalclusternum, goalareanum, traveltime, reachnum) ||
+				fronttime < *traveltime)
+		{
+			*traveltime = fronttime;
+			*reachnum = frontreachnum;
+		} //end if
+		return qtrue;
 	} //end if
+	return AAS_RouteTableClusterExit(table, clusternum, areanum, origin,
+										goalclusternum, goalareanum, traveltime, reachnum);
+} //end of the function AAS_RouteTableRouteToGoalArea
+//===========================================================================
+// returns the route to the goal area using the routing caches, updates the
+// caches when necessary so the routing cache lock must be held
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static int AAS_CacheRouteToGoalArea(int areanum, vec3_t origin, int goalareanum, int travelflags, int *traveltime, int *reachnum)
+{
+	int clusternum, goalclusternum, portalnum, i, clusterareanum, bestreachnum;
+	unsigned short int t, besttime, *traveltimes;
+	unsigned char *reachabilities;
+	aas_portal_t *portal;
+	aas_cluster_t *cluster;
+	aas_routingcache_t *portalcache;
+	aas_reachability_t *reach;
+
 	// make sure the routing cache doesn't grow to large
+	if (routingcachesize > max_routingcachesize) {
+		AAS_FreeOldestCaches(max_routingcachesize - max_routingcachesize / ROUTINGCACHE_EVICTFRACTION);
+	}
 	while(AvailableMemory() < 1 * 1024 * 1024) {
 		if (!AAS_FreeOldestCache()) break;
 	}
-	//
-	if (AAS_AreaDoNotEnter(areanum) || AAS_AreaDoNotEnter(goalareanum))
-	{
-		travelflags |= TFL_DONOTENTER;
-	} //end if
 	//NOTE: the number of routing updates is limited per frame
 	/*
 	if (aasworld.frameroutingupdates > MAX_FRAMEROUTINGUPDATES)
@@ -1675,7 +2760,7 @@ int AAS_AreaRouteToGoalArea(int areanum, vec3_t origin, int goalareanum, int tra
 	if (clusternum > 0 && goalclusternum > 0 && clusternum == goalclusternum)
 	{
 		//
-		areacache = AAS_GetAreaRoutingCache(clusternum, goalareanum, travelflags);
+		AAS_ClusterAreaRoute(clusternum, goalareanum, travelflags, &traveltimes, &reachabilities);
 		//the number of the area in the cluster
 		clusterareanum = AAS_ClusterAreaNum(clusternum, areanum);
 		//the cluster the area is in
@@ -1683,16 +2768,16 @@ int AAS_AreaRouteToGoalArea(int areanum, vec3_t origin, int goalareanum, int tra
 		//if the area is NOT a reachability area
 		if (clusterareanum >= cluster->numreachabilityareas) return 0;
 		//if it is possible to travel to the goal area through this cluster
-		if (areacache->traveltimes[clusterareanum] != 0)
+		if (traveltimes[clusterareanum] != 0)
 		{
 			*reachnum = aasworld.areasettings[areanum].firstreachablearea +
-							areacache->reachabilities[clusterareanum];
+							reachabilities[clusterareanum];
 			if (!origin) {
-				*traveltime = areacache->traveltimes[clusterareanum];
+				*traveltime = traveltimes[clusterareanum];
 				return qtrue;
 			}
 			reach = &aasworld.reachability[*reachnum];
-			*traveltime = areacache->traveltimes[clusterareanum] +
+			*traveltime = traveltimes[clusterareanum] +
 							AAS_AreaTravelTime(areanum, origin, reach->start);
 			//
 			return qtrue;
@@ -1732,16 +2817,16 @@ int AAS_AreaRouteToGoalArea(int areanum, vec3_t origin, int goalareanum, int tra
 		//
 		portal = &aasworld.portals[portalnum];
 		//get the cache of the portal area
-		areacache = AAS_GetAreaRoutingCache(clusternum, portal->areanum, travelflags);
+		AAS_ClusterAreaRoute(clusternum, portal->areanum, travelflags, &traveltimes, &reachabilities);
 		//current area inside the current cluster
 		clusterareanum = AAS_ClusterAreaNum(clusternum, areanum);
 		//if the area is NOT a reachability area
 		if (clusterareanum >= cluster->numreachabilityareas) continue;
 		//if the portal is NOT reachable from this area
-		if (!areacache->traveltimes[clusterareanum]) continue;
+		if (!traveltimes[clusterareanum]) continue;
 		//total travel time is the travel time the portal area is from
 		//the goal area plus the travel time towards the portal area
-		t = portalcache->traveltimes[portalnum] + areacache->traveltimes[clusterareanum];
+		t = portalcache->traveltimes[portalnum] + traveltimes[clusterareanum];
 		//FIXME: add the exact travel time through the actual portal area
 		//NOTE: for now we just add the largest travel time through the portal area
 		//		because we can't directly calculate the exact travel time
@@ -1752,7 +2837,7 @@ int AAS_AreaRouteToGoalArea(int areanum, vec3_t origin, int goalareanum, int tra
 		if (origin)
 		{
 			*reachnum = aasworld.areasettings[areanum].firstreachablearea +
-							areacache->reachabilities[clusterareanum];
+							reachabilities[clusterareanum];
 			reach = aasworld.reachability + *reachnum;
 			t += AAS_AreaTravelTime(areanum, origin, reach->start);
 		} //end if
@@ -1769,6 +2854,78 @@ int AAS_AreaRouteToGoalArea(int areanum, vec3_t origin, int goalareanum, int tra
 	*reachnum = bestreachnum;
 	*traveltime = besttime;
 	return qtrue;
+} //end of the function AAS_CacheRouteToGoalArea
+//===========================================================================
+// the route tables are never changed while the bots think so the table
+// lookup is safe for concurrent readers, the routing caches are shared and
+// updated on demand so cache lookups are serialized with the routing lock
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+int AAS_AreaRouteToGoalArea(int areanum, vec3_t origin, int goalareanum, int travelflags, int *traveltime, int *reachnum)
+{
+	int ret;
+	aas_routetable_t *table;
+
+	if (!aasworld.initialized) return qfalse;
+
+	if (areanum == goalareanum)
+	{
+		*traveltime = 1;
+		*reachnum = 0;
+		return qtrue;
+	}
+	//check !AAS_AreaReachability(areanum) with custom developer-only debug message
+	if (areanum <= 0 || areanum >= aasworld.numareas)
+	{
+		if (botDeveloper)
+		{
+			botimport.Print(PRT_ERROR, "AAS_AreaTravelTimeToGoalArea: areanum %d out of range\n", areanum);
+		} //end if
+		return qfalse;
+	} //end if
+	if (goalareanum <= 0 || goalareanum >= aasworld.numareas)
+	{
+		if (botDeveloper)
+		{
+			botimport.Print(PRT_ERROR, "AAS_AreaTravelTimeToGoalArea: goalareanum %d out of range\n", goalareanum);
+		} //end if
+		return qfalse;
+	} //end if
+	if (!aasworld.areasettings[areanum].numreachableareas || !aasworld.areasettings[goalareanum].numreachableareas)
+	{
+		return qfalse;
+	} //end if
+	if (AAS_AreaDoNotEnter(areanum) || AAS_AreaDoNotEnter(goalareanum))
+	{
+		travelflags |= TFL_DONOTENTER;
+	} //end if
+	//use the precomputed route tables if available
+	table = AAS_RouteTableForTravelFlags(travelflags);
+	if (table)
+	{
+		ret = AAS_RouteTableRouteToGoalArea(table, areanum, origin, goalareanum, traveltime, reachnum);
+		if (ret >= 0) return ret;
+	} //end if
+	//
+#ifdef ROUTING_LOCK
+#ifdef _WIN32
+	EnterCriticalSection(&routingcachelock);
+#else
+	pthread_mutex_lock(&routingcachelock);
+#endif
+#endif //ROUTING_LOCK
+	ret = AAS_CacheRouteToGoalArea(areanum, origin, goalareanum, travelflags, traveltime, reachnum);
+#ifdef ROUTING_LOCK
+#ifdef _WIN32
+	LeaveCriticalSection(&routingcachelock);
+#else
+	pthread_mutex_unlock(&routingcachelock);
+#endif
+#endif //ROUTING_LOCK
+	return ret;
 } //end of the function AAS_AreaRouteToGoalArea
 //===========================================================================
 //
@@ -47,8 +47,14 @@ unsigned short int AAS_AreaTravelTime(int areanum, vec3_t start, vec3_t end);
 //
 void AAS_CreateAllRoutingCache(void);
 void AAS_WriteRouteCache(void);
+//writes the precomputed route tables for the current map
+void AAS_WriteRouteTables(void);
+//reads the precomputed route tables for the current map
+int AAS_ReadRouteTables(void);
 //
 void AAS_RoutingInfo(void);
+//print routing cache statistics
+void AAS_RoutingCacheInfo(void);
 #endif //AASINTERN
 
 //returns the travel flag for the given travel type
@@ -58,6 +58,14 @@ Suite 120, Rockville, Maryland 20850 USA.
 
 #define TRACEPLANE_EPSILON			0.125
 
+#define REACHGRID_CELLSIZE			256
+#define REACHGRID_MAXSIZE			256
+#define REACHGRID_EPSILON			1
+
+#define INSIDEAREA_EPSILON			0.5
+
+#define SAMPLEBENCHMARK_POINTS		1000000
+
 typedef struct aas_tracestack_s
 {
 	vec3_t start;		//start point of the piece of line to trace
@@ -208,6 +216,174 @@ void AAS_FreeAASLinkedEntities(void)
 	aasworld.arealinkedentities = NULL;
 } //end of the function AAS_InitAASLinkedEntities
 //===========================================================================
+// copies the bsp tree into nodes with the plane stored in the node
+// unless aasnodelayout is 0 the nodes are stored breadth first so the
+// top levels of the tree share cache lines
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void AAS_InitFlatNodes(void)
+{
+	int i, j, nodenum, child, numqueued, *order, *flatnum;
+	aas_node_t *node;
+	aas_flatnode_t *flatnode;
+
+	AAS_FreeFlatNodes();
+	if (aasworld.numnodes <= 1) return;
+	//
+	order = (int *) GetClearedMemory(aasworld.numnodes * sizeof(int));
+	flatnum = (int *) GetClearedMemory(aasworld.numnodes * sizeof(int));
+	//node zero is a dummy used for solid leafs
+	numqueued = 1;
+	if ((int) LibVarValue("aasnodelayout", "1"))
+	{
+		//breadth first starting at the root
+		order[numqueued++] = 1;
+		for (i = 1; i < numqueued; i++)
+		{
+			node = &aasworld.nodes[order[i]];
+			for (j = 0; j < 2; j++)
+			{
+				child = node->children[j];
+				if (child <= 0 || flatnum[child] || child >= aasworld.numnodes) continue;
+				//mark the node as queued
+				flatnum[child] = -1;
+				order[numqueued++] = child;
+			} //end for
+		} //end for
+	} //end if
+	else
+	{
+		for (nodenum = 1; nodenum < aasworld.numnodes; nodenum++)
+		{
+			order[numqueued++] = nodenum;
+		} //end for
+	} //end else
+	for (i = 1; i < numqueued; i++)
+	{
+		flatnum[order[i]] = i;
+	} //end for
+	//
+	aasworld.flatnodes = (aas_flatnode_t *) GetClearedMemory(numqueued * sizeof(aas_flatnode_t));
+	aasworld.numflatnodes = numqueued;
+	for (i = 1; i < numqueued; i++)
+	{
+		node = &aasworld.nodes[order[i]];
+		flatnode = &aasworld.flatnodes[i];
+		flatnode->plane = aasworld.planes[node->planenum];
+		flatnode->planenum = node->planenum;
+		for (j = 0; j < 2; j++)
+		{
+			child = node->children[j];
+			if (child > 0) flatnode->children[j] = flatnum[child];
+			else flatnode->children[j] = child;
+		} //end for
+	} //end for
+	FreeMemory(order);
+	FreeMemory(flatnum);
+} //end of the function AAS_InitFlatNodes
+//===========================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void AAS_FreeFlatNodes(void)
+{
+	if (aasworld.flatnodes) FreeMemory(aasworld.flatnodes);
+	aasworld.flatnodes = NULL;
+	aasworld.numflatnodes = 0;
+} //end of the function AAS_FreeFlatNodes
+//===========================================================================
+// returns the AAS area the point is in using the bsp tree as stored in
+// the AAS file
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+static int AAS_FilePointAreaNum(vec3_t point)
+{
+	int nodenum;
+	vec_t dist;
+	aas_node_t *node;
+	aas_plane_t *plane;
+
+	nodenum = 1;
+	while (nodenum > 0)
+	{
+		node = &aasworld.nodes[nodenum];
+		plane = &aasworld.planes[node->planenum];
+		dist = DotProduct(point, plane->normal) - plane->dist;
+		if (dist > 0) nodenum = node->children[0];
+		else nodenum = node->children[1];
+	} //end while
+	return -nodenum;
+} //end of the function AAS_FilePointAreaNum
+//===========================================================================
+// times point lookups with the bsp tree as stored in the AAS file against
+// the flat nodes, and times area traces, at random points in the areas
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void AAS_SampleBenchmark(void)
+{
+	int i, j, seed, areanum, filetime, flattime, tracetime, mismatches, numareas;
+	int areas[32], *fileareas;
+	vec3_t *points, end;
+	aas_area_t *area;
+
+	if (aasworld.numareas <= 1 || !aasworld.flatnodes) return;
+	//
+	points = (vec3_t *) GetMemory(SAMPLEBENCHMARK_POINTS * sizeof(vec3_t));
+	fileareas = (int *) GetMemory(SAMPLEBENCHMARK_POINTS * sizeof(int));
+	seed = 1;
+	for (i = 0; i < SAMPLEBENCHMARK_POINTS; i++)
+	{
+		areanum = 1 + Q_rand(&seed) % (aasworld.numareas - 1);
+		area = &aasworld.areas[areanum];
+		for (j = 0; j < 3; j++)
+		{
+			points[i][j] = area->mins[j] + Q_random(&seed) * (area->maxs[j] - area->mins[j]);
+		} //end for
+	} //end for
+	//
+	filetime = botimport.MilliSeconds();
+	for (i = 0; i < SAMPLEBENCHMARK_POINTS; i++)
+	{
+		fileareas[i] = AAS_FilePointAreaNum(points[i]);
+	} //end for
+	filetime = botimport.MilliSeconds() - filetime;
+	//
+	mismatches = 0;
+	flattime = botimport.MilliSeconds();
+	for (i = 0; i < SAMPLEBENCHMARK_POINTS; i++)
+	{
+		if (AAS_PointAreaNum(points[i]) != fileareas[i]) mismatches++;
+	} //end for
+	flattime = botimport.MilliSeconds() - flattime;
+	//
+	numareas = 0;
+	tracetime = botimport.MilliSeconds();
+	for (i = 0; i + 1 < SAMPLEBENCHMARK_POINTS; i += 2)
+	{
+		VectorCopy(points[i + 1], end);
+		numareas += AAS_TraceAreas(points[i], end, areas, NULL, 32);
+	} //end for
+	tracetime = botimport.MilliSeconds() - tracetime;
+	FreeMemory(fileareas);
+	FreeMemory(points);
+	//
+	botimport.Print(PRT_MESSAGE, "%d point lookups: %d msec file nodes, %d msec flat nodes, %d mismatches\n",
+						SAMPLEBENCHMARK_POINTS, filetime, flattime, mismatches);
+	botimport.Print(PRT_MESSAGE, "%d area traces through %d areas: %d msec\n",
+						SAMPLEBENCHMARK_POINTS / 2, numareas, tracetime);
+} //end of the function AAS_SampleBenchmark
+//===========================================================================
 // returns the AAS area the point is in
 //
 // Parameter:				-
@@ -218,7 +394,7 @@ int AAS_PointAreaNum(vec3_t point)
 {
 	int nodenum;
 	vec_t	dist;
-	aas_node_t *node;
+	aas_flatnode_t *node;
 	aas_plane_t *plane;
 
 	if (!aasworld.loaded)
@@ -228,18 +404,19 @@ int AAS_PointAreaNum(vec3_t point)
 	} //end if
 
 	//start with node 1 because node zero is a dummy used for solid leafs
-	nodenum = 1;
+	//without a bsp tree there are no flat nodes and the point is in solid
+	nodenum = aasworld.flatnodes ? 1 : 0;
 	while (nodenum > 0)
 	{
 //		botimport.Print(PRT_MESSAGE, "[%d]", nodenum);
 #ifdef AAS_SAMPLE_DEBUG
-		if (nodenum >= aasworld.numnodes)
+		if (nodenum >= aasworld.numflatnodes)
 		{
-			botimport.Print(PRT_ERROR, "nodenum = %d >= aasworld.numnodes = %d\n", nodenum, aasworld.numnodes);
+			botimport.Print(PRT_ERROR, "nodenum = %d >= aasworld.numflatnodes = %d\n", nodenum, aasworld.numflatnodes);
 			return 0;
 		} //end if
 #endif //AAS_SAMPLE_DEBUG
-		node = &aasworld.nodes[nodenum];
+		node = &aasworld.flatnodes[nodenum];
 #ifdef AAS_SAMPLE_DEBUG
 		if (node->planenum < 0 || node->planenum >= aasworld.numplanes)
 		{
@@ -247,7 +424,7 @@ int AAS_PointAreaNum(vec3_t point)
 			return 0;
 		} //end if
 #endif //AAS_SAMPLE_DEBUG
-		plane = &aasworld.planes[node->planenum];
+		plane = &node->plane;
 		dist = DotProduct(point, plane->normal) - plane->dist;
 		if (dist > 0) nodenum = node->children[0];
 		else nodenum = node->children[1];
@@ -461,7 +638,7 @@ aas_trace_t AAS_TracePlayerBBox(vec3_t start, vec3_t end, int presencetype, int
 	vec3_t cur_start, cur_end, cur_mid, v1, v2;
 	aas_tracestack_t tracestack[127];
 	aas_tracestack_t *tstack_p;
-	aas_node_t *aasnode;
+	aas_flatnode_t *aasnode;
 	aas_plane_t *plane;
 	aas_trace_t trace;
 
@@ -476,7 +653,8 @@ aas_trace_t AAS_TracePlayerBBox(vec3_t start, vec3_t end, int presencetype, int
 	VectorCopy(end, tstack_p->end);
 	tstack_p->planenum = 0;
 	//start with node 1 because node zero is a dummy for a solid leaf
-	tstack_p->nodenum = 1;		//starting at the root of the tree
+	//without a bsp tree there are no flat nodes and the line is in solid
+	tstack_p->nodenum = aasworld.flatnodes ? 1 : 0;		//starting at the root of the tree
 	tstack_p++;
 	
 	while (1)
@@ -601,20 +779,20 @@ aas_trace_t AAS_TracePlayerBBox(vec3_t start, vec3_t end, int presencetype, int
 			return trace;
 		} //end if
 #ifdef AAS_SAMPLE_DEBUG
-		if (nodenum > aasworld.numnodes)
+		if (nodenum >= aasworld.numflatnodes)
 		{
 			botimport.Print(PRT_ERROR, "AAS_TraceBoundingBox: nodenum out of range\n");
 			return trace;
 		} //end if
 #endif //AAS_SAMPLE_DEBUG
 		//the node to test against
-		aasnode = &aasworld.nodes[nodenum];
+		aasnode = &aasworld.flatnodes[nodenum];
 		//start point of current line to test against node
 		VectorCopy(tstack_p->start, cur_start);
 		//end point of the current line to test against node
 		VectorCopy(tstack_p->end, cur_end);
 		//the current node plane
-		plane = &aasworld.planes[aasnode->planenum];
+		plane = &aasnode->plane;
 
 		switch(plane->type)
 		{/*FIXME: wtf doesn't this work? obviously the axial node planes aren't always facing positive!!!
@@ -742,7 +920,7 @@ int AAS_TraceAreas(vec3_t start, vec3_t end, int *areas, vec3_t *points, int max
 	vec3_t cur_start, cur_end, cur_mid;
 	aas_tracestack_t tracestack[127];
 	aas_tracestack_t *tstack_p;
-	aas_node_t *aasnode;
+	aas_flatnode_t *aasnode;
 	aas_plane_t *plane;
 
 	numareas = 0;
@@ -755,7 +933,8 @@ int AAS_TraceAreas(vec3_t start, vec3_t end, int *areas, vec3_t *points, int max
 	VectorCopy(end, tstack_p->end);
 	tstack_p->planenum = 0;
 	//start with node 1 because node zero is a dummy for a solid leaf
-	tstack_p->nodenum = 1;		//starting at the root of the tree
+	//without a bsp tree there are no flat nodes and the line is in solid
+	tstack_p->nodenum = aasworld.flatnodes ? 1 : 0;		//starting at the root of the tree
 	tstack_p++;
 
 	while (1)
@@ -793,20 +972,20 @@ int AAS_TraceAreas(vec3_t start, vec3_t end, int *areas, vec3_t *points, int max
 			continue;
 		} //end if
 #ifdef AAS_SAMPLE_DEBUG
-		if (nodenum > aasworld.numnodes)
+		if (nodenum >= aasworld.numflatnodes)
 		{
 			botimport.Print(PRT_ERROR, "AAS_TraceAreas: nodenum out of range\n");
 			return numareas;
 		} //end if
 #endif //AAS_SAMPLE_DEBUG
 		//the node to test against
-		aasnode = &aasworld.nodes[nodenum];
+		aasnode = &aasworld.flatnodes[nodenum];
 		//start point of current line to test against node
 		VectorCopy(tstack_p->start, cur_start);
 		//end point of the current line to test against node
 		VectorCopy(tstack_p->end, cur_end);
 		//the current node plane
-		plane = &aasworld.planes[aasnode->planenum];
+		plane = &aasnode->plane;
 
 		switch(plane->type)
 		{/*FIXME: wtf doesn't this work? obviously the node planes aren't always facing positive!!!
@@ -1237,7 +1416,7 @@ aas_link_t *AAS_AASLinkEntity(vec3_t absmins, vec3_t absmaxs, int entnum)
 	int side, nodenum;
 	aas_linkstack_t linkstack[128];
 	aas_linkstack_t *lstack_p;
-	aas_node_t *aasnode;
+	aas_flatnode_t *aasnode;
 	aas_plane_t *plane;
 	aas_link_t *link, *areas;
 
@@ -1252,7 +1431,8 @@ aas_link_t *AAS_AASLinkEntity(vec3_t absmins, vec3_t absmaxs, int entnum)
 	lstack_p = linkstack;
 	//we start with the whole line on the stack
 	//start with node 1 because node zero is a dummy used for solid leafs
-	lstack_p->nodenum = 1;		//starting at the root of the tree
+	//without a bsp tree there are no flat nodes and the entity isn't linked
+	lstack_p->nodenum = aasworld.flatnodes ? 1 : 0;		//starting at the root of the tree
 	lstack_p++;
 	
 	while (1)
@@ -1296,9 +1476,9 @@ aas_link_t *AAS_AASLinkEntity(vec3_t absmins, vec3_t absmaxs, int entnum)
 		//if solid leaf
 		if (!nodenum) continue;
 		//the node to test against
-		aasnode = &aasworld.nodes[nodenum];
+		aasnode = &aasworld.flatnodes[nodenum];
 		//the current node plane
-		plane = &aasworld.planes[aasnode->planenum];
+		plane = &aasnode->plane;
 		//get the side(s) the box is situated relative to the plane
 		side = AAS_BoxOnPlaneSide2(absmins, absmaxs, plane);
 		//if on the front side of the node
@@ -1372,6 +1552,210 @@ int AAS_BBoxAreas(vec3_t absmins, vec3_t absmaxs, int *areas, int maxareas)
 // Returns:					-
 // Changes Globals:		-
 //===========================================================================
+void AAS_FreeReachabilityAreaGrid(void)
+{
+	if (aasworld.reachgridfirst) FreeMemory(aasworld.reachgridfirst);
+	aasworld.reachgridfirst = NULL;
+	if (aasworld.reachgridareas) FreeMemory(aasworld.reachgridareas);
+	aasworld.reachgridareas = NULL;
+	aasworld.reachgridsize[0] = 0;
+	aasworld.reachgridsize[1] = 0;
+} //end of the function AAS_FreeReachabilityAreaGrid
+//===========================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+static void AAS_ReachabilityAreaGridCells(vec3_t mins, vec3_t maxs, int *cellmins, int *cellmaxs)
+{
+	int i;
+
+	for (i = 0; i < 2; i++)
+	{
+		cellmins[i] = (int) ((mins[i] - REACHGRID_EPSILON - aasworld.reachgridorigin[i]) / aasworld.reachgridcellsize);
+		cellmaxs[i] = (int) ((maxs[i] + REACHGRID_EPSILON - aasworld.reachgridorigin[i]) / aasworld.reachgridcellsize);
+		if (cellmins[i] < 0) cellmins[i] = 0;
+		if (cellmaxs[i] >= aasworld.reachgridsize[i]) cellmaxs[i] = aasworld.reachgridsize[i] - 1;
+	} //end for
+} //end of the function AAS_ReachabilityAreaGridCells
+//===========================================================================
+// stores for every column of the map the reachability areas that overlap it
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void AAS_InitReachabilityAreaGrid(void)
+{
+	int i, x, y, cell, numcells, numentries;
+	int cellmins[2], cellmaxs[2];
+	vec3_t mins, maxs;
+	aas_area_t *area;
+
+	AAS_FreeReachabilityAreaGrid();
+	//
+	ClearBounds(mins, maxs);
+	for (i = 1; i < aasworld.numareas; i++)
+	{
+		if (!aasworld.areasettings[i].numreachableareas) continue;
+		AddPointToBounds(aasworld.areas[i].mins, mins, maxs);
+		AddPointToBounds(aasworld.areas[i].maxs, mins, maxs);
+	} //end for
+	if (mins[0] > maxs[0]) return;
+	//
+	aasworld.reachgridcellsize = REACHGRID_CELLSIZE;
+	for (i = 0; i < 2; i++)
+	{
+		//grow the cells on huge maps
+		while ((maxs[i] - mins[i]) / aasworld.reachgridcellsize >= REACHGRID_MAXSIZE)
+			aasworld.reachgridcellsize *= 2;
+	} //end for
+	for (i = 0; i < 2; i++)
+	{
+		aasworld.reachgridorigin[i] = mins[i];
+		aasworld.reachgridsize[i] = (int) ((maxs[i] - mins[i]) / aasworld.reachgridcellsize) + 1;
+	} //end for
+	numcells = aasworld.reachgridsize[0] * aasworld.reachgridsize[1];
+	aasworld.reachgridfirst = (int *) GetClearedMemory((numcells + 1) * sizeof(int));
+	//count the areas in each cell
+	for (i = 1; i < aasworld.numareas; i++)
+	{
+		if (!aasworld.areasettings[i].numreachableareas) continue;
+		area = &aasworld.areas[i];
+		AAS_ReachabilityAreaGridCells(area->mins, area->maxs, cellmins, cellmaxs);
+		for (y = cellmins[1]; y <= cellmaxs[1]; y++)
+		{
+			for (x = cellmins[0]; x <= cellmaxs[0]; x++)
+			{
+				aasworld.reachgridfirst[y * aasworld.reachgridsize[0] + x + 1]++;
+			} //end for
+		} //end for
+	} //end for
+	for (cell = 0; cell < numcells; cell++)
+	{
+		aasworld.reachgridfirst[cell + 1] += aasworld.reachgridfirst[cell];
+	} //end for
+	numentries = aasworld.reachgridfirst[numcells];
+	aasworld.reachgridareas = (int *) GetClearedMemory((numentries + 1) * sizeof(int));
+	//fill the cells, the first index of every cell is used as fill position
+	for (i = 1; i < aasworld.numareas; i++)
+	{
+		if (!aasworld.areasettings[i].numreachableareas) continue;
+		area = &aasworld.areas[i];
+		AAS_ReachabilityAreaGridCells(area->mins, area->maxs, cellmins, cellmaxs);
+		for (y = cellmins[1]; y <= cellmaxs[1]; y++)
+		{
+			for (x = cellmins[0]; x <= cellmaxs[0]; x++)
+			{
+				cell = y * aasworld.reachgridsize[0] + x;
+				aasworld.reachgridareas[aasworld.reachgridfirst[cell]++] = i;
+			} //end for
+		} //end for
+	} //end for
+	//shift the first indexes back
+	for (cell = numcells; cell > 0; cell--)
+	{
+		aasworld.reachgridfirst[cell] = aasworld.reachgridfirst[cell - 1];
+	} //end for
+	aasworld.reachgridfirst[0] = 0;
+	//
+	botimport.Print(PRT_DEVELOPER, "%d reachability area grid cells with %d entries\n", numcells, numentries);
+} //end of the function AAS_InitReachabilityAreaGrid
+//===========================================================================
+// returns the reachability areas with bounds overlapping the bounding box
+// a trace or point inside the box can only be in one of these
+// reachability areas
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int AAS_BBoxReachabilityAreas(vec3_t absmins, vec3_t absmaxs, int *areas, int maxareas)
+{
+	int i, j, x, y, cell, areanum, num;
+	int cellmins[2], cellmaxs[2];
+	aas_area_t *area;
+
+	if (!aasworld.reachgridfirst) return 0;
+	//
+	AAS_ReachabilityAreaGridCells(absmins, absmaxs, cellmins, cellmaxs);
+	num = 0;
+	for (y = cellmins[1]; y <= cellmaxs[1]; y++)
+	{
+		for (x = cellmins[0]; x <= cellmaxs[0]; x++)
+		{
+			cell = y * aasworld.reachgridsize[0] + x;
+			for (i = aasworld.reachgridfirst[cell]; i < aasworld.reachgridfirst[cell + 1]; i++)
+			{
+				areanum = aasworld.reachgridareas[i];
+				area = &aasworld.areas[areanum];
+				for (j = 0; j < 3; j++)
+				{
+					if (area->mins[j] - REACHGRID_EPSILON > absmaxs[j]) break;
+					if (area->maxs[j] + REACHGRID_EPSILON < absmins[j]) break;
+				} //end for
+				if (j < 3) continue;
+				//the area can overlap several cells
+				for (j = 0; j < num; j++)
+				{
+					if (areas[j] == areanum) break;
+				} //end for
+				if (j < num) continue;
+				if (num >= maxareas) return num;
+				areas[num++] = areanum;
+			} //end for
+		} //end for
+	} //end for
+	return num;
+} //end of the function AAS_BBoxReachabilityAreas
+//===========================================================================
+// returns true if the point is inside the area and not close to any of
+// the area boundaries, in which case AAS_PointAreaNum returns the area
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int AAS_PointInsideArea(int areanum, vec3_t point)
+{
+	int i, facenum;
+	float dist;
+	aas_area_t *area;
+	aas_face_t *face;
+	aas_plane_t *plane;
+
+	if (!aasworld.loaded) return qfalse;
+	if (areanum <= 0 || areanum >= aasworld.numareas) return qfalse;
+	area = &aasworld.areas[areanum];
+	for (i = 0; i < 3; i++)
+	{
+		if (point[i] <= area->mins[i] || point[i] >= area->maxs[i]) return qfalse;
+	} //end for
+	//the area is convex so the point has to be at the area side of all faces
+	for (i = 0; i < area->numfaces; i++)
+	{
+		facenum = abs(aasworld.faceindex[area->firstface + i]);
+		face = &aasworld.faces[facenum];
+		plane = &aasworld.planes[face->planenum];
+		dist = DotProduct(point, plane->normal) - plane->dist;
+		if (face->frontarea == areanum)
+		{
+			if (dist < INSIDEAREA_EPSILON) return qfalse;
+		} //end if
+		else
+		{
+			if (dist > -INSIDEAREA_EPSILON) return qfalse;
+		} //end else
+	} //end for
+	return qtrue;
+} //end of the function AAS_PointInsideArea
+//===========================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
 int AAS_AreaInfo( int areanum, aas_areainfo_t *info )
 {
 	aas_areasettings_t *settings;
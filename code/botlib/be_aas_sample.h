@@ -50,6 +50,11 @@ aas_link_t *AAS_LinkEntityClientBBox(vec3_t absmins, vec3_t absmaxs, int entnum,
 qboolean AAS_PointInsideFace(int facenum, vec3_t point, float epsilon);
 qboolean AAS_InsideFace(aas_face_t *face, vec3_t pnormal, vec3_t point, float epsilon);
 void AAS_UnlinkFromAreas(aas_link_t *areas);
+void AAS_InitReachabilityAreaGrid(void);
+void AAS_FreeReachabilityAreaGrid(void);
+void AAS_InitFlatNodes(void);
+void AAS_FreeFlatNodes(void);
+void AAS_SampleBenchmark(void);
 #endif //AASINTERN
 
 //returns the mins and maxs of the bounding box for the given presence type
@@ -68,6 +73,10 @@ aas_trace_t AAS_TracePlayerBBox(vec3_t start, vec3_t end, int presencetype, int
 int AAS_TraceAreas(vec3_t start, vec3_t end, int *areas, vec3_t *points, int maxareas);
 //returns the areas the bounding box is in
 int AAS_BBoxAreas(vec3_t absmins, vec3_t absmaxs, int *areas, int maxareas);
+//returns the reachability areas with bounds overlapping the bounding box
+int AAS_BBoxReachabilityAreas(vec3_t absmins, vec3_t absmaxs, int *areas, int maxareas);
+//returns true if the point is well inside the area
+int AAS_PointInsideArea(int areanum, vec3_t point);
 //return area information
 int AAS_AreaInfo( int areanum, aas_areainfo_t *info );
 //returns the area the point is in
@@ -262,6 +262,24 @@ int Export_BotLibUpdateEntity(int ent, bot_entitystate_t *state)
 // Returns:					-
 // Changes Globals:		-
 //===========================================================================
+int Export_BotLibUpdateEntities(int numentities, int *entnums, bot_entitystate_t *states)
+{
+	int i;
+
+	if (!BotLibSetup("BotUpdateEntities")) return BLERR_LIBRARYNOTSETUP;
+	for (i = 0; i < numentities; i++)
+	{
+		if (!ValidEntityNumber(entnums[i], "BotUpdateEntities")) return BLERR_INVALIDENTITYNUMBER;
+	} //end for
+
+	return AAS_UpdateEntities(numentities, entnums, states);
+} //end of the function Export_BotLibUpdateEntities
+//===========================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
 void Export_AAS_TracePlayerBBox(struct aas_trace_s *trace, vec3_t start, vec3_t end, int presencetype, int passent, int contentmask)
 {
 	aas_trace_t tr;
@@ -312,6 +330,8 @@ static void Init_AAS_Export( aas_export_t *aas ) {
 	aas->AAS_TraceAreas = AAS_TraceAreas;
 	aas->AAS_BBoxAreas = AAS_BBoxAreas;
 	aas->AAS_AreaInfo = AAS_AreaInfo;
+	aas->AAS_BBoxReachabilityAreas = AAS_BBoxReachabilityAreas;
+	aas->AAS_PointInsideArea = AAS_PointInsideArea;
 	//--------------------------------------------
 	// be_aas_bspq3.c
 	//--------------------------------------------
@@ -394,6 +414,7 @@ botlib_export_t *GetBotLibAPI(int apiVersion, botlib_import_t *import) {
 	be_botlib_export.BotLibStartFrame = Export_BotLibStartFrame;
 	be_botlib_export.BotLibLoadMap = Export_BotLibLoadMap;
 	be_botlib_export.BotLibUpdateEntity = Export_BotLibUpdateEntity;
+	be_botlib_export.BotLibUpdateEntities = Export_BotLibUpdateEntities;
 
 	return &be_botlib_export;
 }
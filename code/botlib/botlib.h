@@ -37,7 +37,7 @@ Suite 120, Rockville, Maryland 20850 USA.
  *
  *****************************************************************************/
 
-#define	BOTLIB_API_VERSION		3
+#define	BOTLIB_API_VERSION		5
 
 struct aas_clientmove_s;
 struct aas_areainfo_s;
@@ -172,6 +172,8 @@ typedef struct aas_export_s
 	int			(*AAS_TraceAreas)(vec3_t start, vec3_t end, int *areas, vec3_t *points, int maxareas);
 	int			(*AAS_BBoxAreas)(vec3_t absmins, vec3_t absmaxs, int *areas, int maxareas);
 	int			(*AAS_AreaInfo)( int areanum, struct aas_areainfo_s *info );
+	int			(*AAS_BBoxReachabilityAreas)(vec3_t absmins, vec3_t absmaxs, int *areas, int maxareas);
+	int			(*AAS_PointInsideArea)(int areanum, vec3_t point);
 	//--------------------------------------------
 	// be_aas_bspq3.c
 	//--------------------------------------------
@@ -256,6 +258,8 @@ typedef struct botlib_export_s
 	int (*BotLibLoadMap)(const char *mapname);
 	//entity updates
 	int (*BotLibUpdateEntity)(int ent, bot_entitystate_t *state);
+	//updates the given entities in one call and unlinks all other entities
+	int (*BotLibUpdateEntities)(int numentities, int *entnums, bot_entitystate_t *states);
 } botlib_export_t;
 
 //linking of bot library
@@ -538,6 +538,9 @@ typedef struct
 // occurs, and they will have visible effects for #define STEP_TIME or whatever msec after
 
 #define MAX_PREDICTED_EVENTS	16
+
+// predicted player states kept for replaying commands that were already predicted
+#define NUM_SAVED_STATES		( CMD_BACKUP + 2 )
  
 typedef struct {
 
@@ -551,6 +554,12 @@ typedef struct {
 	int			predictedErrorTime;
 	vec3_t		predictedError;
 
+	// states after each predicted command, from stateHead up to stateTail
+	playerState_t	savedPmoveStates[NUM_SAVED_STATES];
+	int			stateHead, stateTail;
+	int			lastPredictedCommand;
+	int			lastServerTime;			// physicsTime of the last prediction
+
 	int			eventSequence;
 	int			predictableEvents[MAX_PREDICTED_EVENTS];
 
@@ -804,6 +813,7 @@ typedef struct {
 
 	// scoreboard
 	int			scoresRequestTime;
+	int			scoresVersion;		// server scoreboard version for delta updates, 0 if unknown
 	int			numScores;
 	int			intermissionSelectedScore;
 	int			teamScores[2];
@@ -1359,6 +1369,9 @@ extern	vmCvar_t		cg_errorDecay;
 extern	vmCvar_t		cg_nopredict;
 extern	vmCvar_t		cg_noPlayerAnims;
 extern	vmCvar_t		cg_showmiss;
+extern	vmCvar_t		cg_optimizePrediction;
+extern	vmCvar_t		cg_showTraceTests;
+extern	vmCvar_t		cg_showPolyBuffers;
 extern	vmCvar_t		cg_footsteps;
 extern	vmCvar_t		cg_addMarks;
 extern	vmCvar_t		cg_brassTime;
@@ -192,6 +192,9 @@ vmCvar_t	cg_errorDecay;
 vmCvar_t	cg_nopredict;
 vmCvar_t	cg_noPlayerAnims;
 vmCvar_t	cg_showmiss;
+vmCvar_t	cg_optimizePrediction;
+vmCvar_t	cg_showTraceTests;
+vmCvar_t	cg_showPolyBuffers;
 vmCvar_t	cg_footsteps;
 vmCvar_t	cg_addMarks;
 vmCvar_t	cg_brassTime;
@@ -415,7 +418,10 @@ static cvarTable_t cgameCvarTable[] = {
 	{ &cg_errorDecay, "cg_errordecay", "100", 0, RANGE_ALL },
 	{ &cg_nopredict, "cg_nopredict", "0", 0, RANGE_BOOL },
 	{ &cg_noPlayerAnims, "cg_noplayeranims", "0", CVAR_CHEAT, RANGE_BOOL },
-	{ &cg_showmiss, "cg_showmiss", "0", 0, RANGE_BOOL },
+	{ &cg_showmiss, "cg_showmiss", "0", 0, RANGE_INT( 0, 2 ) },
+	{ &cg_optimizePrediction, "cg_optimizePrediction", "1", 0, RANGE_BOOL },
+	{ &cg_showTraceTests, "cg_showTraceTests", "0", 0, RANGE_BOOL },
+	{ &cg_showPolyBuffers, "cg_showPolyBuffers", "0", 0, RANGE_BOOL },
 	{ &cg_footsteps, "cg_footsteps", "1", CVAR_CHEAT, RANGE_BOOL },
 	{ &cg_tracerChance, "cg_tracerchance", "0.4", CVAR_CHEAT, RANGE_ALL },
 	{ &cg_tracerWidth, "cg_tracerwidth", "1", CVAR_CHEAT, RANGE_ALL },
@@ -152,10 +152,38 @@ static float	shaderAnimSTRatio[MAX_SHADER_ANIMS] = {
 #define		MAX_PARTICLES 1024
 #endif
 
-cparticle_t	*active_particles, *free_particles;
+#define		PARTICLE_NEVER_EXPIRES	1.0e9f
+
+// simulation state of the active particles, packed in spawn order so the
+// per frame update runs straight through the arrays. cparticle_t keeps
+// the trajectory the particle was (re)spawned with and what is needed to
+// draw it.
+typedef struct
+{
+	int			numParticles;
+	int			numCommitted;		// particles from here on were spawned since the last update
+	cparticle_t	*particle[MAX_PARTICLES];
+
+	float		time[MAX_PARTICLES];
+	float		killtime[MAX_PARTICLES];
+	float		alpha[MAX_PARTICLES];
+	float		alphavel[MAX_PARTICLES];
+	float		org[3][MAX_PARTICLES];
+	float		vel[3][MAX_PARTICLES];
+	float		accel[3][MAX_PARTICLES];
+
+	// evaluated for cg.time by CG_AddParticles
+	float		curalpha[MAX_PARTICLES];
+	float		curorg[3][MAX_PARTICLES];
+	byte		alive[MAX_PARTICLES];
+} particleStore_t;
+
+cparticle_t	*free_particles;
 cparticle_t	particles[MAX_PARTICLES];
 int		cl_numparticles = MAX_PARTICLES;
 
+static particleStore_t	particleStore;
+
 qboolean		initparticles = qfalse;
 vec3_t			vforward, vright, vup;
 vec3_t			rforward, rright, rup;
@@ -174,7 +202,8 @@ void CG_ClearParticles (void)
 	memset( particles, 0, sizeof(particles) );
 
 	free_particles = &particles[0];
-	active_particles = NULL;
+	particleStore.numParticles = 0;
+	particleStore.numCommitted = 0;
 
 	for (i=0 ;i<cl_numparticles ; i++)
 	{
@@ -199,13 +228,111 @@ void CG_ClearParticles (void)
 	initparticles = qtrue;
 }
 
+/*
+===============
+CG_AllocParticle
+
+Takes a particle off the free list, callers must check free_particles first
+===============
+*/
+static cparticle_t *CG_AllocParticle (void)
+{
+	cparticle_t	*p;
+
+	p = free_particles;
+	free_particles = p->next;
+	p->next = NULL;
+
+	particleStore.particle[particleStore.numParticles] = p;
+	particleStore.numParticles++;
+
+	return p;
+}
+
+/*
+===============
+CG_CommitParticle
+
+Copies the trajectory of a spawned or respawned particle into the particle store
+===============
+*/
+static void CG_CommitParticle (int num)
+{
+	particleStore_t	*ps = &particleStore;
+	cparticle_t		*p = ps->particle[num];
+	int				j;
+
+	ps->time[num] = p->time;
+	ps->alpha[num] = p->alpha;
+	ps->alphavel[num] = p->alphavel;
+
+	for (j=0; j<3; j++)
+	{
+		ps->org[j][num] = p->org[j];
+		ps->vel[j][num] = p->vel[j];
+		ps->accel[j][num] = p->accel[j];
+	}
+
+	if (p->type == P_SMOKE || p->type == P_ANIM || p->type == P_BLEED || p->type == P_SMOKE_IMPACT
+		|| p->type == P_WEATHER_FLURRY || p->type == P_FLAT_SCALEUP_FADE)
+		ps->killtime[num] = p->endtime;
+	else
+		ps->killtime[num] = PARTICLE_NEVER_EXPIRES;
+}
+
+/*
+=====================
+CG_AddParticlePoly
+
+Batches a particle polygon into the poly buffer for its shader
+=====================
+*/
+static void CG_AddParticlePoly (qhandle_t shader, int numVerts, const polyVert_t *verts)
+{
+	polyBuffer_t	*pb;
+	int				firstVert, firstIndex;
+	int				i;
+
+	pb = CG_PB_FindFreePolyBuffer( shader, numVerts, ( numVerts - 2 ) * 3 );
+	if (!pb)
+	{
+		trap_R_AddPolyToScene( shader, numVerts, verts, 0, 0 );
+		return;
+	}
+
+	firstVert = pb->numVerts;
+	firstIndex = pb->numIndicies;
+
+	for (i=0; i<numVerts; i++)
+	{
+		VectorCopy( verts[i].xyz, pb->xyz[firstVert + i] );
+		pb->st[firstVert + i][0] = verts[i].st[0];
+		pb->st[firstVert + i][1] = verts[i].st[1];
+		pb->color[firstVert + i][0] = verts[i].modulate[0];
+		pb->color[firstVert + i][1] = verts[i].modulate[1];
+		pb->color[firstVert + i][2] = verts[i].modulate[2];
+		pb->color[firstVert + i][3] = verts[i].modulate[3];
+	}
+
+	// triangle fan
+	for (i=2; i<numVerts; i++)
+	{
+		pb->indicies[firstIndex++] = firstVert;
+		pb->indicies[firstIndex++] = firstVert + i - 1;
+		pb->indicies[firstIndex++] = firstVert + i;
+	}
+
+	pb->numVerts += numVerts;
+	pb->numIndicies = firstIndex;
+}
+
 
 /*
 =====================
 CG_AddParticleToScene
 =====================
 */
-void CG_AddParticleToScene (cparticle_t *p, vec3_t org, float alpha)
+void CG_AddParticleToScene (int num, cparticle_t *p, vec3_t org, float alpha)
 {
 
 	vec3_t		point;
@@ -240,7 +367,8 @@ void CG_AddParticleToScene (cparticle_t *p, vec3_t org, float alpha)
 						p->vel[0] = crandom() * 4;
 						p->vel[1] = crandom() * 4;
 					}
-				
+
+					CG_CommitParticle (num);
 				}
 			}
 			else
@@ -261,7 +389,8 @@ void CG_AddParticleToScene (cparticle_t *p, vec3_t org, float alpha)
 						p->vel[0] = crandom() * 16;
 						p->vel[1] = crandom() * 16;
 					}
-				
+
+					CG_CommitParticle (num);
 				}
 			}
 			
@@ -271,6 +400,7 @@ void CG_AddParticleToScene (cparticle_t *p, vec3_t org, float alpha)
 				return;
 
 			p->alpha = 1;
+			particleStore.alpha[num] = 1;
 		}
 		
 		// Ridah, had to do this or MAX_POLYS is being exceeded in village1.bsp
@@ -839,9 +969,9 @@ void CG_AddParticleToScene (cparticle_t *p, vec3_t org, float alpha)
 	}
 
 	if (p->type == P_WEATHER || p->type == P_WEATHER_TURBULENT || p->type == P_WEATHER_FLURRY)
-		trap_R_AddPolyToScene( p->pshader, 3, TRIverts, 0, 0 );
+		CG_AddParticlePoly( p->pshader, 3, TRIverts );
 	else
-		trap_R_AddPolyToScene( p->pshader, 4, verts, 0, 0 );
+		CG_AddParticlePoly( p->pshader, 4, verts );
 
 }
 
@@ -855,12 +985,13 @@ CG_AddParticles
 */
 void CG_AddParticles (void)
 {
-	cparticle_t		*p, *next;
-	float			alpha;
+	particleStore_t	*ps = &particleStore;
+	cparticle_t		*p;
 	float			time, time2;
+	float			now;
 	vec3_t			org;
-	cparticle_t		*active, *tail;
 	vec3_t			rotate_ang;
+	int				i, j, num;
 
 	if (!initparticles)
 		CG_ClearParticles ();
@@ -876,74 +1007,57 @@ void CG_AddParticles (void)
 	
 	oldtime = cg.time;
 
-	active = NULL;
-	tail = NULL;
+	// pick up the particles spawned since the last update
+	for (i=ps->numCommitted; i<ps->numParticles; i++)
+		CG_CommitParticle (i);
+	ps->numCommitted = ps->numParticles;
 
-	for (p=active_particles ; p ; p=next)
+	num = ps->numParticles;
+	now = cg.time;
+
+	// evaluate every trajectory, faded out or expired particles die
+	for (i=0; i<num; i++)
 	{
+		time = (now - ps->time[i])*0.001;
+		time2 = time*time;
 
-		next = p->next;
+		ps->curalpha[i] = ps->alpha[i] + time*ps->alphavel[i];
+		ps->alive[i] = ( ps->curalpha[i] > 0 && now <= ps->killtime[i] );
 
-		time = (cg.time - p->time)*0.001;
+		ps->curorg[0][i] = ps->org[0][i] + ps->vel[0][i]*time + ps->accel[0][i]*time2;
+		ps->curorg[1][i] = ps->org[1][i] + ps->vel[1][i]*time + ps->accel[1][i]*time2;
+		ps->curorg[2][i] = ps->org[2][i] + ps->vel[2][i]*time + ps->accel[2][i]*time2;
+	}
 
-		alpha = p->alpha + time*p->alphavel;
-		if (alpha <= 0)
-		{	// faded out
-			p->next = free_particles;
-			free_particles = p;
-			p->type = 0;
-			p->color = 0;
-			p->alpha = 0;
+	// newest first, like the old active list
+	for (i=num-1; i>=0; i--)
+	{
+		if (!ps->alive[i])
 			continue;
-		}
 
-		if (p->type == P_SMOKE || p->type == P_ANIM || p->type == P_BLEED || p->type == P_SMOKE_IMPACT)
-		{
-			if (cg.time > p->endtime)
-			{
-				p->next = free_particles;
-				free_particles = p;
-				p->type = 0;
-				p->color = 0;
-				p->alpha = 0;
-			
-				continue;
-			}
+		p = ps->particle[i];
 
+		if ((p->type == P_BAT || p->type == P_SPRITE) && p->endtime < 0)
+		{	// temporary sprite
+			CG_AddParticleToScene (i, p, p->org, ps->curalpha[i]);
+			ps->alive[i] = qfalse;
+			continue;
 		}
 
-		if (p->type == P_WEATHER_FLURRY)
-		{
-			if (cg.time > p->endtime)
-			{
-				p->next = free_particles;
-				free_particles = p;
-				p->type = 0;
-				p->color = 0;
-				p->alpha = 0;
-			
-				continue;
-			}
-		}
-
+		org[0] = ps->curorg[0][i];
+		org[1] = ps->curorg[1][i];
+		org[2] = ps->curorg[2][i];
 
-		if (p->type == P_FLAT_SCALEUP_FADE)
-		{
-			if (cg.time > p->endtime)
-			{
-				p->next = free_particles;
-				free_particles = p;
-				p->type = 0;
-				p->color = 0;
-				p->alpha = 0;
-				continue;
-			}
+		CG_AddParticleToScene (i, p, org, ps->curalpha[i] > 1.0 ? 1.0 : ps->curalpha[i]);
+	}
 
-		}
+	// compact the store, keeping spawn order
+	for (i=0, j=0; i<num; i++)
+	{
+		p = ps->particle[i];
 
-		if ((p->type == P_BAT || p->type == P_SPRITE) && p->endtime < 0) {
-			// temporary sprite
-			CG_AddParticleToScene (p, p->org, alpha);
+		if (!ps->alive[i])
+		{
 			p->next = free_particles;
 			free_particles = p;
 			p->type = 0;
@@ -952,28 +1066,27 @@ void CG_AddParticles (void)
 			continue;
 		}
 
-		p->next = NULL;
-		if (!tail)
-			active = tail = p;
-		else
+		if (i != j)
 		{
-			tail->next = p;
-			tail = p;
+			ps->particle[j] = p;
+			ps->time[j] = ps->time[i];
+			ps->killtime[j] = ps->killtime[i];
+			ps->alpha[j] = ps->alpha[i];
+			ps->alphavel[j] = ps->alphavel[i];
+			ps->org[0][j] = ps->org[0][i];
+			ps->org[1][j] = ps->org[1][i];
+			ps->org[2][j] = ps->org[2][i];
+			ps->vel[0][j] = ps->vel[0][i];
+			ps->vel[1][j] = ps->vel[1][i];
+			ps->vel[2][j] = ps->vel[2][i];
+			ps->accel[0][j] = ps->accel[0][i];
+			ps->accel[1][j] = ps->accel[1][i];
+			ps->accel[2][j] = ps->accel[2][i];
 		}
-
-		if (alpha > 1.0)
-			alpha = 1;
-
-		time2 = time*time;
-
-		org[0] = p->org[0] + p->vel[0]*time + p->accel[0]*time2;
-		org[1] = p->org[1] + p->vel[1]*time + p->accel[1]*time2;
-		org[2] = p->org[2] + p->vel[2]*time + p->accel[2]*time2;
-
-		CG_AddParticleToScene (p, org, alpha);
+		j++;
 	}
 
-	active_particles = active;
+	ps->numParticles = ps->numCommitted = j;
 }
 
 /*
@@ -991,10 +1104,7 @@ void CG_ParticleSnowFlurry (qhandle_t pshader, centity_t *cent)
 
 	if (!free_particles)
 		return;
-	p = free_particles;
-	free_particles = p->next;
-	p->next = active_particles;
-	active_particles = p;
+	p = CG_AllocParticle ();
 	p->time = cg.time;
 	p->color = 0;
 	p->alpha = 0.90f;
@@ -1054,10 +1164,7 @@ void CG_ParticleSnow (qhandle_t pshader, vec3_t origin, vec3_t origin2, int turb
 
 	if (!free_particles)
 		return;
-	p = free_particles;
-	free_particles = p->next;
-	p->next = active_particles;
-	active_particles = p;
+	p = CG_AllocParticle ();
 	p->time = cg.time;
 	p->color = 0;
 	p->alpha = 0.40f;
@@ -1112,10 +1219,7 @@ void CG_ParticleBubble (qhandle_t pshader, vec3_t origin, vec3_t origin2, int tu
 
 	if (!free_particles)
 		return;
-	p = free_particles;
-	free_particles = p->next;
-	p->next = active_particles;
-	active_particles = p;
+	p = CG_AllocParticle ();
 	p->time = cg.time;
 	p->color = 0;
 	p->alpha = 0.40f;
@@ -1175,10 +1279,7 @@ void CG_ParticleSmoke (qhandle_t pshader, centity_t *cent)
 
 	if (!free_particles)
 		return;
-	p = free_particles;
-	free_particles = p->next;
-	p->next = active_particles;
-	active_particles = p;
+	p = CG_AllocParticle ();
 	p->time = cg.time;
 	
 	p->endtime = cg.time + cent->currentState.time;
@@ -1218,10 +1319,7 @@ void CG_ParticleBulletDebris (vec3_t org, vec3_t vel, int duration)
 
 	if (!free_particles)
 		return;
-	p = free_particles;
-	free_particles = p->next;
-	p->next = active_particles;
-	active_particles = p;
+	p = CG_AllocParticle ();
 	p->time = cg.time;
 	
 	p->endtime = cg.time + duration;
@@ -1278,10 +1376,7 @@ void CG_ParticleExplosion (char *animStr, vec3_t origin, vec3_t vel, int duratio
 
 	if (!free_particles)
 		return;
-	p = free_particles;
-	free_particles = p->next;
-	p->next = active_particles;
-	active_particles = p;
+	p = CG_AllocParticle ();
 	p->time = cg.time;
 #ifdef WOLF_PARTICLES
 	p->alpha = 1.0;
@@ -1394,14 +1489,15 @@ int CG_NewParticleArea (int num)
 
 void	CG_SnowLink (centity_t *cent, qboolean particleOn)
 {
-	cparticle_t		*p, *next;
+	cparticle_t		*p;
 	int id;
+	int i;
 
 	id = cent->currentState.frame;
 
-	for (p=active_particles ; p ; p=next)
+	for (i=0 ; i<particleStore.numParticles ; i++)
 	{
-		next = p->next;
+		p = particleStore.particle[i];
 		
 		if (p->type == P_WEATHER || p->type == P_WEATHER_TURBULENT)
 		{
@@ -1426,10 +1522,7 @@ void CG_ParticleImpactSmokePuff (qhandle_t pshader, vec3_t origin)
 
 	if (!free_particles)
 		return;
-	p = free_particles;
-	free_particles = p->next;
-	p->next = active_particles;
-	active_particles = p;
+	p = CG_AllocParticle ();
 	p->time = cg.time;
 	p->alpha = 0.25;
 	p->alphavel = 0;
@@ -1466,10 +1559,7 @@ void CG_Particle_Bleed (qhandle_t pshader, vec3_t start, vec3_t dir, int fleshEn
 
 	if (!free_particles)
 		return;
-	p = free_particles;
-	free_particles = p->next;
-	p->next = active_particles;
-	active_particles = p;
+	p = CG_AllocParticle ();
 	p->time = cg.time;
 	p->alpha = 1.0;
 	p->alphavel = 0;
@@ -1527,10 +1617,7 @@ void CG_Particle_OilParticle (qhandle_t pshader, centity_t *cent)
 
 	if (!free_particles)
 		return;
-	p = free_particles;
-	free_particles = p->next;
-	p->next = active_particles;
-	active_particles = p;
+	p = CG_AllocParticle ();
 	p->time = cg.time;
 	p->alpha = 1.0;
 	p->alphavel = 0;
@@ -1580,10 +1667,7 @@ void CG_Particle_OilSlick (qhandle_t pshader, centity_t *cent)
 
 	if (!free_particles)
 		return;
-	p = free_particles;
-	free_particles = p->next;
-	p->next = active_particles;
-	active_particles = p;
+	p = CG_AllocParticle ();
 	p->time = cg.time;
 	
 	if (cent->currentState.angles2[2])
@@ -1639,17 +1723,18 @@ void CG_Particle_OilSlick (qhandle_t pshader, centity_t *cent)
 
 void CG_OilSlickRemove (centity_t *cent)
 {
-	cparticle_t		*p, *next;
+	cparticle_t		*p;
 	int				id;
+	int				i;
 
 	id = 1.0f;
 
 	if (!id)
 		CG_Printf ("CG_OilSlickRevove NULL id\n");
 
-	for (p=active_particles ; p ; p=next)
+	for (i=0 ; i<particleStore.numParticles ; i++)
 	{
-		next = p->next;
+		p = particleStore.particle[i];
 		
 		if (p->type == P_FLAT_SCALEUP)
 		{
@@ -1659,6 +1744,9 @@ void CG_OilSlickRemove (centity_t *cent)
 				p->startfade = p->endtime;
 				p->type = P_FLAT_SCALEUP_FADE;
 
+				if (i < particleStore.numCommitted)
+					CG_CommitParticle (i);
+
 			}
 		}
 
@@ -1730,10 +1818,7 @@ void CG_BloodPool (localEntity_t *le, qhandle_t pshader, trace_t *tr)
 	if (!legit) 
 		return;
 
-	p = free_particles;
-	free_particles = p->next;
-	p->next = active_particles;
-	active_particles = p;
+	p = CG_AllocParticle ();
 	p->time = cg.time;
 	
 	p->endtime = cg.time + 3000;
@@ -1807,10 +1892,7 @@ void CG_ParticleBloodCloud (centity_t *cent, vec3_t origin, vec3_t dir)
 		if (!free_particles)
 			return;
 
-		p = free_particles;
-		free_particles = p->next;
-		p->next = active_particles;
-		active_particles = p;
+		p = CG_AllocParticle ();
 
 		p->time = cg.time;
 		p->alpha = 1.0;
@@ -1857,10 +1939,7 @@ void CG_ParticleSparks (vec3_t org, vec3_t vel, int duration, float x, float y,
 
 	if (!free_particles)
 		return;
-	p = free_particles;
-	free_particles = p->next;
-	p->next = active_particles;
-	active_particles = p;
+	p = CG_AllocParticle ();
 	p->time = cg.time;
 	
 	p->endtime = cg.time + duration;
@@ -1933,10 +2012,7 @@ void CG_ParticleDust (centity_t *cent, vec3_t origin, vec3_t dir)
 		if (!free_particles)
 			return;
 
-		p = free_particles;
-		free_particles = p->next;
-		p->next = active_particles;
-		active_particles = p;
+		p = CG_AllocParticle ();
 
 		p->time = cg.time;
 		p->alpha = 5.0;
@@ -2005,10 +2081,7 @@ void CG_ParticleMisc (qhandle_t pshader, vec3_t origin, int size, int duration,
 	if (!free_particles)
 		return;
 
-	p = free_particles;
-	free_particles = p->next;
-	p->next = active_particles;
-	active_particles = p;
+	p = CG_AllocParticle ();
 	p->time = cg.time;
 	p->alpha = 1.0;
 	p->alphavel = 0;
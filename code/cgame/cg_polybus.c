@@ -31,64 +31,97 @@ Suite 120, Rockville, Maryland 20850 USA.
 #include "cg_local.h"
 
 #define MAX_PB_BUFFERS  128
+#define PB_HASH_SIZE    256 // must be a power of two larger than MAX_PB_BUFFERS
 
 polyBuffer_t cg_polyBuffers[MAX_PB_BUFFERS];
 int cg_polyBuffersInuse[MAX_PB_BUFFERS];
+int cg_numPolyBuffersInuse;
+
+// open addressing index of the buffer currently being filled for each
+// shader and local player, 1 + buffer number or 0 if the slot is empty
+static int cg_polyBufferHash[PB_HASH_SIZE];
+
+// cg_showPolyBuffers counters for the current frame
+static int cg_pbPolys;
+static int cg_pbChained;
+static int cg_pbDropped;
+
+static int CG_PB_HashKey( qhandle_t shader, int owner ) {
+	return ( shader * 31 + owner ) & ( PB_HASH_SIZE - 1 );
+}
 
 polyBuffer_t* CG_PB_FindFreePolyBuffer( qhandle_t shader, int numVerts, int numIndicies ) {
+	polyBuffer_t *pb;
+	int owner;
+	int hash;
 	int i;
-	int firstFree = -1;
-
-	// find one with the same shader if possible
-	for ( i = 0; i < MAX_PB_BUFFERS; i++ ) {
-		if ( !cg_polyBuffersInuse[i] ) {
-			if ( firstFree == -1 ) {
-				firstFree = i;
-			}
-			continue;
-		}
 
-		if ( cg_polyBuffersInuse[i] != 1+cg.cur_localPlayerNum ) {
-			continue;
-		}
+	owner = 1+cg.cur_localPlayerNum;
+	cg_pbPolys++;
 
-		if ( cg_polyBuffers[i].shader != shader ) {
-			continue;
-		}
+	// find the buffer being filled with this shader
+	for ( hash = CG_PB_HashKey( shader, owner ); cg_polyBufferHash[hash]; hash = ( hash + 1 ) & ( PB_HASH_SIZE - 1 ) ) {
+		i = cg_polyBufferHash[hash] - 1;
 
-		if ( cg_polyBuffers[i].numIndicies + numIndicies >= MAX_PB_INDICIES ) {
+		if ( cg_polyBuffersInuse[i] != owner || cg_polyBuffers[i].shader != shader ) {
 			continue;
 		}
 
-		if ( cg_polyBuffers[i].numVerts + numVerts >= MAX_PB_VERTS ) {
-			continue;
+		pb = &cg_polyBuffers[i];
+		if ( pb->numIndicies + numIndicies < MAX_PB_INDICIES && pb->numVerts + numVerts < MAX_PB_VERTS ) {
+			return pb;
 		}
 
-		return &cg_polyBuffers[i];
+		// full, chain a new buffer for the shader in its place
+		cg_pbChained++;
+		break;
+	}
+
+	if ( cg_numPolyBuffersInuse >= MAX_PB_BUFFERS ) {
+		cg_pbDropped++;
+		return NULL;
 	}
 
 	// return new poly buffer
-	if ( firstFree != -1 ) {
-		cg_polyBuffersInuse[firstFree] =        1+cg.cur_localPlayerNum;
-		cg_polyBuffers[firstFree].shader =      shader;
-		cg_polyBuffers[firstFree].numIndicies = 0;
-		cg_polyBuffers[firstFree].numVerts =    0;
+	i = cg_numPolyBuffersInuse++;
+	cg_polyBufferHash[hash] = 1+i;
 
-		return &cg_polyBuffers[firstFree];
-	}
+	cg_polyBuffersInuse[i] =        owner;
+	cg_polyBuffers[i].shader =      shader;
+	cg_polyBuffers[i].numIndicies = 0;
+	cg_polyBuffers[i].numVerts =    0;
 
-	return NULL;
+	return &cg_polyBuffers[i];
 }
 
 void CG_PB_ClearPolyBuffers( void ) {
+	int verts, indicies;
+	int i;
+
+	if ( cg_showPolyBuffers.integer && cg_pbPolys ) {
+		verts = indicies = 0;
+		for ( i = 0; i < cg_numPolyBuffersInuse; i++ ) {
+			verts += cg_polyBuffers[i].numVerts;
+			indicies += cg_polyBuffers[i].numIndicies;
+		}
+
+		CG_Printf( "%i polys, %i/%i buffers (%i chained, %i dropped), %i verts, %i indicies\n",
+			cg_pbPolys, cg_numPolyBuffersInuse, MAX_PB_BUFFERS, cg_pbChained, cg_pbDropped, verts, indicies );
+	}
+	cg_pbPolys = 0;
+	cg_pbChained = 0;
+	cg_pbDropped = 0;
+
 	// Gordon: changed numIndicies and numVerts to be reset in CG_PB_FindFreePolyBuffer, not here (should save the cache misses we were prolly getting)
 	memset( cg_polyBuffersInuse, 0, sizeof( cg_polyBuffersInuse ) );
+	memset( cg_polyBufferHash, 0, sizeof( cg_polyBufferHash ) );
+	cg_numPolyBuffersInuse = 0;
 }
 
 void CG_PB_RenderPolyBuffers( void ) {
 	int i;
 
-	for ( i = 0; i < MAX_PB_BUFFERS; i++ ) {
+	for ( i = 0; i < cg_numPolyBuffersInuse; i++ ) {
 		if ( cg_polyBuffersInuse[i] == 1+cg.cur_localPlayerNum ) {
 			trap_R_AddPolyBufferToScene( &cg_polyBuffers[i] );
 		}
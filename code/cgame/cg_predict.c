@@ -37,11 +37,224 @@ Suite 120, Rockville, Maryland 20850 USA.
 
 static	pmove_t		cg_pmove;
 
+#define	MAX_SOLID_ENTITIES		(MAX_ENTITIES_IN_SNAPSHOT+MAX_SPLITVIEW)
+
 static	int			cg_numSolidEntities;
-static	centity_t	*cg_solidEntities[MAX_ENTITIES_IN_SNAPSHOT+MAX_SPLITVIEW];
+static	centity_t	*cg_solidEntities[MAX_SOLID_ENTITIES];
 static	int			cg_numTriggerEntities;
 static	centity_t	*cg_triggerEntities[MAX_ENTITIES_IN_SNAPSHOT];
 
+// broad-phase grid over the solid entities that can't move until the next
+// snapshot, a 2D spatial hash of SOLID_GRID_CELL sized columns
+#define	SOLID_GRID_CELL			256
+#define	SOLID_GRID_SIZE			32		// must be a power of two
+#define	SOLID_GRID_MAX_CELLS	64		// entities covering more cells are always tested
+#define	SOLID_GRID_MAX_LINKS	4096
+#define	SOLID_BOUNDS_EPSILON	1
+
+static	vec3_t		cg_solidAbsMins[MAX_SOLID_ENTITIES];
+static	vec3_t		cg_solidAbsMaxs[MAX_SOLID_ENTITIES];
+static	qboolean	cg_solidFixed[MAX_SOLID_ENTITIES];	// absmins / absmaxs hold for the whole snapshot
+static	int			cg_solidTraceNum[MAX_SOLID_ENTITIES];	// last trace that considered the entity
+static	int			cg_numLooseSolids;
+static	int			cg_looseSolids[MAX_SOLID_ENTITIES];	// entities that are not linked into the grid
+
+static	int			cg_solidGridHeads[SOLID_GRID_SIZE*SOLID_GRID_SIZE];
+static	int			cg_numSolidGridLinks;
+static	int			cg_solidGridLinkNext[SOLID_GRID_MAX_LINKS];
+static	int			cg_solidGridLinkSolid[SOLID_GRID_MAX_LINKS];
+
+static	int			cg_traceNum;
+
+// cg_showTraceTests counters, reset each time the solid list is rebuilt
+static	int			cg_traceCount;
+static	int			cg_traceCandidates;
+static	int			cg_traceClips;
+
+/*
+====================
+CG_SolidStateBounds
+
+Adds the world bounds of a submodel entity state to absmin / absmax.
+Returns qfalse if the state doesn't hold the submodel still.
+====================
+*/
+static qboolean CG_SolidStateBounds( const entityState_t *ent, qboolean rotated, vec3_t absmin, vec3_t absmax ) {
+	vec3_t		mins, maxs;
+	float		radius;
+	int			i;
+
+	if ( ent->collisionType != CT_SUBMODEL || ent->pos.trType != TR_STATIONARY || ent->apos.trType != TR_STATIONARY ) {
+		return qfalse;
+	}
+
+	// inline model bounds are only unknown if the server didn't set them
+	if ( VectorCompare( ent->mins, ent->maxs ) ) {
+		return qfalse;
+	}
+
+	if ( rotated ) {
+		radius = RadiusFromBounds( ent->mins, ent->maxs );
+		for ( i = 0 ; i < 3 ; i++ ) {
+			mins[i] = ent->pos.trBase[i] - radius;
+			maxs[i] = ent->pos.trBase[i] + radius;
+		}
+	} else {
+		VectorAdd( ent->pos.trBase, ent->mins, mins );
+		VectorAdd( ent->pos.trBase, ent->maxs, maxs );
+	}
+
+	AddPointToBounds( mins, absmin, absmax );
+	AddPointToBounds( maxs, absmin, absmax );
+	return qtrue;
+}
+
+/*
+====================
+CG_SolidFixedBounds
+
+Submodels that are stationary in both the current and next entity state
+can't move until the solid list is rebuilt, so their bounds are computed
+once per snapshot. Rotated submodels use a sphere as lerpAngles is
+interpolated between the two states.
+====================
+*/
+static qboolean CG_SolidFixedBounds( const centity_t *cent, vec3_t absmin, vec3_t absmax ) {
+	qboolean	rotated;
+
+	rotated = !VectorCompare( cent->currentState.apos.trBase, vec3_origin )
+			|| !VectorCompare( cent->nextState.apos.trBase, vec3_origin );
+
+	ClearBounds( absmin, absmax );
+
+	if ( !CG_SolidStateBounds( &cent->currentState, rotated, absmin, absmax ) ) {
+		return qfalse;
+	}
+	if ( !CG_SolidStateBounds( &cent->nextState, rotated, absmin, absmax ) ) {
+		return qfalse;
+	}
+
+	absmin[0] -= SOLID_BOUNDS_EPSILON;
+	absmin[1] -= SOLID_BOUNDS_EPSILON;
+	absmin[2] -= SOLID_BOUNDS_EPSILON;
+	absmax[0] += SOLID_BOUNDS_EPSILON;
+	absmax[1] += SOLID_BOUNDS_EPSILON;
+	absmax[2] += SOLID_BOUNDS_EPSILON;
+	return qtrue;
+}
+
+/*
+====================
+CG_SolidCurrentBounds
+
+World bounds of a solid entity where CG_ClipMoveToEntities will place it
+for this trace. Returns qfalse if the bounds are unknown.
+====================
+*/
+static qboolean CG_SolidCurrentBounds( const centity_t *cent, vec3_t absmin, vec3_t absmax ) {
+	const entityState_t	*ent;
+	vec3_t		origin;
+	float		radius;
+	int			i;
+
+	ent = &cent->currentState;
+
+	if ( ent->collisionType == CT_SUBMODEL ) {
+		if ( VectorCompare( ent->mins, ent->maxs ) ) {
+			return qfalse;
+		}
+
+		BG_EvaluateTrajectory( &ent->pos, cg.physicsTime, origin );
+		radius = RadiusFromBounds( ent->mins, ent->maxs ) + SOLID_BOUNDS_EPSILON;
+		for ( i = 0 ; i < 3 ; i++ ) {
+			absmin[i] = origin[i] - radius;
+			absmax[i] = origin[i] + radius;
+		}
+	} else {
+		for ( i = 0 ; i < 3 ; i++ ) {
+			absmin[i] = cent->lerpOrigin[i] + ent->mins[i] - SOLID_BOUNDS_EPSILON;
+			absmax[i] = cent->lerpOrigin[i] + ent->maxs[i] + SOLID_BOUNDS_EPSILON;
+		}
+	}
+
+	return qtrue;
+}
+
+/*
+====================
+CG_SolidGridCoord
+====================
+*/
+static int CG_SolidGridCoord( float f ) {
+	return (int)floor( f / SOLID_GRID_CELL );
+}
+
+#define	CG_SolidGridCell( x, y ) ( ( ( (x) & ( SOLID_GRID_SIZE - 1 ) ) * SOLID_GRID_SIZE ) + ( (y) & ( SOLID_GRID_SIZE - 1 ) ) )
+
+/*
+====================
+CG_LinkSolidGrid
+
+Links a solid entity into every grid cell its bounds touch.
+Returns qfalse if it covers too many cells to be worth linking.
+====================
+*/
+static qboolean CG_LinkSolidGrid( int solidNum ) {
+	int			x, y, x0, y0, x1, y1;
+	int			cell, link;
+
+	x0 = CG_SolidGridCoord( cg_solidAbsMins[solidNum][0] );
+	y0 = CG_SolidGridCoord( cg_solidAbsMins[solidNum][1] );
+	x1 = CG_SolidGridCoord( cg_solidAbsMaxs[solidNum][0] );
+	y1 = CG_SolidGridCoord( cg_solidAbsMaxs[solidNum][1] );
+
+	if ( x1 - x0 >= SOLID_GRID_SIZE || y1 - y0 >= SOLID_GRID_SIZE
+		|| ( x1 - x0 + 1 ) * ( y1 - y0 + 1 ) > SOLID_GRID_MAX_CELLS
+		|| cg_numSolidGridLinks + ( x1 - x0 + 1 ) * ( y1 - y0 + 1 ) > SOLID_GRID_MAX_LINKS ) {
+		return qfalse;
+	}
+
+	for ( x = x0 ; x <= x1 ; x++ ) {
+		for ( y = y0 ; y <= y1 ; y++ ) {
+			cell = CG_SolidGridCell( x, y );
+			link = cg_numSolidGridLinks++;
+			cg_solidGridLinkSolid[link] = solidNum;
+			cg_solidGridLinkNext[link] = cg_solidGridHeads[cell];
+			cg_solidGridHeads[cell] = link;
+		}
+	}
+
+	return qtrue;
+}
+
+/*
+====================
+CG_BuildSolidGrid
+
+Sorts the solid entities into the broad-phase grid and the loose list
+of entities that move between snapshots.
+====================
+*/
+static void CG_BuildSolidGrid( void ) {
+	int			i;
+
+	for ( i = 0 ; i < SOLID_GRID_SIZE*SOLID_GRID_SIZE ; i++ ) {
+		cg_solidGridHeads[i] = -1;
+	}
+	cg_numSolidGridLinks = 0;
+	cg_numLooseSolids = 0;
+
+	for ( i = 0 ; i < cg_numSolidEntities ; i++ ) {
+		cg_solidTraceNum[i] = cg_traceNum;
+		cg_solidFixed[i] = CG_SolidFixedBounds( cg_solidEntities[i], cg_solidAbsMins[i], cg_solidAbsMaxs[i] );
+
+		if ( !cg_solidFixed[i] || !CG_LinkSolidGrid( i ) ) {
+			cg_looseSolids[cg_numLooseSolids] = i;
+			cg_numLooseSolids++;
+		}
+	}
+}
+
 /*
 ====================
 CG_BuildSolidList
@@ -58,6 +271,15 @@ void CG_BuildSolidList( void ) {
 	entityState_t	*ent;
 	playerState_t	*ps;
 
+	if ( cg_showTraceTests.integer && cg_traceCount > 0 ) {
+		CG_Printf( "%i traces: %.2f candidates, %.2f clips per trace (%i solid, %i loose)\n",
+			cg_traceCount, (float)cg_traceCandidates / cg_traceCount, (float)cg_traceClips / cg_traceCount,
+			cg_numSolidEntities, cg_numLooseSolids );
+	}
+	cg_traceCount = 0;
+	cg_traceCandidates = 0;
+	cg_traceClips = 0;
+
 	cg_numSolidEntities = 0;
 	cg_numTriggerEntities = 0;
 
@@ -96,80 +318,178 @@ void CG_BuildSolidList( void ) {
 			cg_numSolidEntities++;
 		}
 	}
+
+	CG_BuildSolidGrid();
 }
 
 /*
 ====================
-CG_ClipMoveToEntities
+CG_ClipMoveToSolid
 
+Returns qtrue once the trace is allsolid and no more entities need to be tested
 ====================
 */
-static void CG_ClipMoveToEntities ( const vec3_t start, const vec3_t mins,
-		const vec3_t maxs, const vec3_t end, int skipNumber,
-		int mask, trace_t *tr, traceType_t traceType )
+static qboolean CG_ClipMoveToSolid( int solidNum, const vec3_t start, const vec3_t mins,
+		const vec3_t maxs, const vec3_t end, const vec3_t traceMins, const vec3_t traceMaxs,
+		int skipNumber, int mask, trace_t *tr, traceType_t traceType )
 {
-	int			i;
 	trace_t		trace;
 	entityState_t	*ent;
 	clipHandle_t 	cmodel;
 	vec3_t		origin, angles;
+	vec3_t		absmin, absmax;
+	qboolean	bounded;
 	centity_t	*cent;
 
-	for ( i = 0 ; i < cg_numSolidEntities ; i++ ) {
-		cent = cg_solidEntities[ i ];
-		ent = &cent->currentState;
+	// already tested from another grid cell
+	if ( cg_solidTraceNum[solidNum] == cg_traceNum ) {
+		return qfalse;
+	}
+	cg_solidTraceNum[solidNum] = cg_traceNum;
 
-		if ( ent->number == skipNumber ) {
-			continue;
+	cent = cg_solidEntities[ solidNum ];
+	ent = &cent->currentState;
+
+	if ( ent->number == skipNumber ) {
+		return qfalse;
+	}
+
+	// if it doesn't have any brushes of a type we
+	// are looking for, ignore it
+	if ( !(mask & ent->contents) ) {
+		return qfalse;
+	}
+
+	cg_traceCandidates++;
+
+	if ( cg_solidFixed[solidNum] ) {
+		VectorCopy( cg_solidAbsMins[solidNum], absmin );
+		VectorCopy( cg_solidAbsMaxs[solidNum], absmax );
+		bounded = qtrue;
+	} else {
+		bounded = CG_SolidCurrentBounds( cent, absmin, absmax );
+	}
+
+	if ( bounded && ( absmin[0] > traceMaxs[0] || absmin[1] > traceMaxs[1] || absmin[2] > traceMaxs[2]
+		|| absmax[0] < traceMins[0] || absmax[1] < traceMins[1] || absmax[2] < traceMins[2] ) ) {
+		return qfalse;
+	}
+
+	cg_traceClips++;
+
+	if ( ent->collisionType == CT_SUBMODEL ) {
+		cmodel = trap_CM_InlineModel( ent->modelindex );
+		VectorCopy( cent->lerpAngles, angles );
+		BG_EvaluateTrajectory( &cent->currentState.pos, cg.physicsTime, origin );
+	} else if ( ent->collisionType == CT_CAPSULE ) {
+		cmodel = trap_CM_TempCapsuleModel( ent->mins, ent->maxs, ent->contents );
+		VectorCopy( vec3_origin, angles );
+		VectorCopy( cent->lerpOrigin, origin );
+	} else /* if ( ent->collisionType == CT_AABB ) */ {
+		cmodel = trap_CM_TempBoxModel( ent->mins, ent->maxs, ent->contents );
+		VectorCopy( vec3_origin, angles );
+		VectorCopy( cent->lerpOrigin, origin );
+	}
+
+
+	if ( traceType == TT_BISPHERE ) {
+		trap_CM_TransformedBiSphereTrace( &trace, start, end,
+				mins[ 0 ], maxs[ 0 ], cmodel, mask, origin );
+	} else if ( traceType == TT_CAPSULE ) {
+		trap_CM_TransformedCapsuleTrace ( &trace, start, end,
+				mins, maxs, cmodel,  mask, origin, angles );
+	} else /* if ( traceType == TT_AABB ) */ {
+		trap_CM_TransformedBoxTrace ( &trace, start, end,
+				mins, maxs, cmodel,  mask, origin, angles );
+	}
+
+	if (trace.allsolid || trace.fraction < tr->fraction) {
+		trace.entityNum = ent->number;
+		if( tr->lateralFraction < trace.lateralFraction )
+		{
+			float oldLateralFraction = tr->lateralFraction;
+			*tr = trace;
+			tr->lateralFraction = oldLateralFraction;
+		} else {
+			*tr = trace;
 		}
+	} else if (trace.startsolid) {
+		tr->startsolid = qtrue;
+		tr->entityNum = ent->number;
+	}
 
-		// if it doesn't have any brushes of a type we
-		// are looking for, ignore it
-		if ( !(mask & ent->contents) ) {
-			continue;
+	return tr->allsolid;
+}
+
+/*
+====================
+CG_ClipMoveToEntities
+
+Only clips against the solid entities whose bounds touch the swept
+bounds of the trace, found through the grid and the loose list.
+====================
+*/
+static void CG_ClipMoveToEntities ( const vec3_t start, const vec3_t mins,
+		const vec3_t maxs, const vec3_t end, int skipNumber,
+		int mask, trace_t *tr, traceType_t traceType )
+{
+	int			i, x, y, x0, y0, x1, y1;
+	int			link;
+	float		radius;
+	vec3_t		traceMins, traceMaxs;
+
+	cg_traceNum++;
+	cg_traceCount++;
+
+	for ( i = 0 ; i < 3 ; i++ ) {
+		if ( start[i] < end[i] ) {
+			traceMins[i] = start[i];
+			traceMaxs[i] = end[i];
+		} else {
+			traceMins[i] = end[i];
+			traceMaxs[i] = start[i];
 		}
+	}
 
-		if ( ent->collisionType == CT_SUBMODEL ) {
-			cmodel = trap_CM_InlineModel( ent->modelindex );
-			VectorCopy( cent->lerpAngles, angles );
-			BG_EvaluateTrajectory( &cent->currentState.pos, cg.physicsTime, origin );
-		} else if ( ent->collisionType == CT_CAPSULE ) {
-			cmodel = trap_CM_TempCapsuleModel( ent->mins, ent->maxs, ent->contents );
-			VectorCopy( vec3_origin, angles );
-			VectorCopy( cent->lerpOrigin, origin );
-		} else /* if ( ent->collisionType == CT_AABB ) */ {
-			cmodel = trap_CM_TempBoxModel( ent->mins, ent->maxs, ent->contents );
-			VectorCopy( vec3_origin, angles );
-			VectorCopy( cent->lerpOrigin, origin );
-		}
-
-
-		if ( traceType == TT_BISPHERE ) {
-			trap_CM_TransformedBiSphereTrace( &trace, start, end,
-					mins[ 0 ], maxs[ 0 ], cmodel, mask, origin );
-		} else if ( traceType == TT_CAPSULE ) {
-			trap_CM_TransformedCapsuleTrace ( &trace, start, end,
-					mins, maxs, cmodel,  mask, origin, angles );
-		} else /* if ( traceType == TT_AABB ) */ {
-			trap_CM_TransformedBoxTrace ( &trace, start, end,
-					mins, maxs, cmodel,  mask, origin, angles );
-		}
-
-		if (trace.allsolid || trace.fraction < tr->fraction) {
-			trace.entityNum = ent->number;
-			if( tr->lateralFraction < trace.lateralFraction )
-			{
-				float oldLateralFraction = tr->lateralFraction;
-				*tr = trace;
-				tr->lateralFraction = oldLateralFraction;
-			} else {
-				*tr = trace;
+	if ( traceType == TT_BISPHERE ) {
+		radius = MAX( mins[0], maxs[0] );
+		for ( i = 0 ; i < 3 ; i++ ) {
+			traceMins[i] -= radius;
+			traceMaxs[i] += radius;
+		}
+	} else if ( mins && maxs ) {
+		VectorAdd( traceMins, mins, traceMins );
+		VectorAdd( traceMaxs, maxs, traceMaxs );
+	}
+
+	x0 = CG_SolidGridCoord( traceMins[0] );
+	y0 = CG_SolidGridCoord( traceMins[1] );
+	x1 = CG_SolidGridCoord( traceMaxs[0] );
+	y1 = CG_SolidGridCoord( traceMaxs[1] );
+
+	// long traces are cheaper to test against every entity
+	if ( x1 - x0 >= SOLID_GRID_SIZE || y1 - y0 >= SOLID_GRID_SIZE
+		|| ( x1 - x0 + 1 ) * ( y1 - y0 + 1 ) > SOLID_GRID_MAX_CELLS ) {
+		for ( i = 0 ; i < cg_numSolidEntities ; i++ ) {
+			if ( CG_ClipMoveToSolid( i, start, mins, maxs, end, traceMins, traceMaxs, skipNumber, mask, tr, traceType ) ) {
+				return;
 			}
-		} else if (trace.startsolid) {
-			tr->startsolid = qtrue;
-			tr->entityNum = ent->number;
 		}
-		if ( tr->allsolid ) {
+		return;
+	}
+
+	for ( x = x0 ; x <= x1 ; x++ ) {
+		for ( y = y0 ; y <= y1 ; y++ ) {
+			for ( link = cg_solidGridHeads[ CG_SolidGridCell( x, y ) ] ; link != -1 ; link = cg_solidGridLinkNext[link] ) {
+				if ( CG_ClipMoveToSolid( cg_solidGridLinkSolid[link], start, mins, maxs, end, traceMins, traceMaxs, skipNumber, mask, tr, traceType ) ) {
+					return;
+				}
+			}
+		}
+	}
+
+	for ( i = 0 ; i < cg_numLooseSolids ; i++ ) {
+		if ( CG_ClipMoveToSolid( cg_looseSolids[i], start, mins, maxs, end, traceMins, traceMaxs, skipNumber, mask, tr, traceType ) ) {
 			return;
 		}
 	}
@@ -475,6 +795,138 @@ static void CG_TouchTriggerPrediction( void ) {
 
 
 
+/*
+=================
+CG_CopyPmoveState
+
+Copies the fields written by Pmove and the trigger prediction from a
+saved predicted state. Fields only the server sets, like persistant[],
+the damage feedback and external events, are kept from ps.
+=================
+*/
+static void CG_CopyPmoveState( playerState_t *ps, const playerState_t *saved ) {
+	int		i;
+
+	ps->commandTime = saved->commandTime;
+	VectorCopy( saved->origin, ps->origin );
+	VectorCopy( saved->velocity, ps->velocity );
+	VectorCopy( saved->viewangles, ps->viewangles );
+	VectorCopy( saved->delta_angles, ps->delta_angles );
+	VectorCopy( saved->mins, ps->mins );
+	VectorCopy( saved->maxs, ps->maxs );
+	ps->viewheight = saved->viewheight;
+	ps->bobCycle = saved->bobCycle;
+	ps->pm_flags = saved->pm_flags;
+	ps->pm_time = saved->pm_time;
+	ps->weaponTime = saved->weaponTime;
+	ps->groundEntityNum = saved->groundEntityNum;
+	ps->legsTimer = saved->legsTimer;
+	ps->legsAnim = saved->legsAnim;
+	ps->torsoTimer = saved->torsoTimer;
+	ps->torsoAnim = saved->torsoAnim;
+	ps->movementDir = saved->movementDir;
+	ps->eFlags = ( ps->eFlags & ~( EF_TALK | EF_FIRING ) ) | ( saved->eFlags & ( EF_TALK | EF_FIRING ) );
+	ps->weapon = saved->weapon;
+	ps->weaponstate = saved->weaponstate;
+	ps->stats[STAT_HOLDABLE_ITEM] = saved->stats[STAT_HOLDABLE_ITEM];
+
+	for ( i = 0; i < MAX_WEAPONS; i++ ) {
+		ps->ammo[i] = saved->ammo[i];
+	}
+
+	ps->eventSequence = saved->eventSequence;
+	for ( i = 0; i < MAX_PS_EVENTS; i++ ) {
+		ps->events[i] = saved->events[i];
+		ps->eventParms[i] = saved->eventParms[i];
+	}
+	ps->entityEventSequence = saved->entityEventSequence;
+
+	ps->jumppad_ent = saved->jumppad_ent;
+	ps->jumppad_frame = saved->jumppad_frame;
+	ps->pmove_framecount = saved->pmove_framecount;
+}
+
+/*
+=================
+CG_PredictedStateMatches
+
+Returns qtrue if the snapshot player state is close enough to the state
+predicted for the same command to keep using the predictions after it.
+=================
+*/
+static qboolean CG_PredictedStateMatches( const playerState_t *ps, const playerState_t *saved ) {
+	vec3_t	delta;
+	int		i;
+
+	if ( ps->commandTime != saved->commandTime
+		|| ps->pm_type != saved->pm_type
+		|| ps->pm_flags != saved->pm_flags
+		|| ps->pm_time != saved->pm_time
+		|| ps->bobCycle != saved->bobCycle
+		|| ps->weaponTime != saved->weaponTime
+		|| ps->gravity != saved->gravity
+		|| ps->speed != saved->speed
+		|| ps->groundEntityNum != saved->groundEntityNum
+		|| ps->movementDir != saved->movementDir
+		|| ps->legsTimer != saved->legsTimer
+		|| ps->legsAnim != saved->legsAnim
+		|| ps->torsoTimer != saved->torsoTimer
+		|| ps->torsoAnim != saved->torsoAnim
+		|| ps->eFlags != saved->eFlags
+		|| ps->contents != saved->contents
+		|| ps->collisionType != saved->collisionType
+		|| ps->eventSequence != saved->eventSequence
+		|| ps->weapon != saved->weapon
+		|| ps->weaponstate != saved->weaponstate
+		|| ps->viewheight != saved->viewheight ) {
+		return qfalse;
+	}
+
+	for ( i = 0; i < 3; i++ ) {
+		if ( ps->delta_angles[i] != saved->delta_angles[i]
+			|| ps->mins[i] != saved->mins[i] || ps->maxs[i] != saved->maxs[i] ) {
+			return qfalse;
+		}
+	}
+
+	for ( i = 0; i < MAX_PS_EVENTS; i++ ) {
+		if ( ps->events[i] != saved->events[i] || ps->eventParms[i] != saved->eventParms[i] ) {
+			return qfalse;
+		}
+	}
+
+	for ( i = 0; i < MAX_STATS; i++ ) {
+		if ( ps->stats[i] != saved->stats[i] ) {
+			return qfalse;
+		}
+	}
+
+	for ( i = 0; i < MAX_POWERUPS; i++ ) {
+		if ( ps->powerups[i] != saved->powerups[i] ) {
+			return qfalse;
+		}
+	}
+
+	for ( i = 0; i < MAX_WEAPONS; i++ ) {
+		if ( ps->ammo[i] != saved->ammo[i] ) {
+			return qfalse;
+		}
+	}
+
+	// same tolerance as the prediction error check
+	VectorSubtract( ps->origin, saved->origin, delta );
+	if ( VectorLengthSquared( delta ) > 0.1f * 0.1f ) {
+		return qfalse;
+	}
+
+	VectorSubtract( ps->velocity, saved->velocity, delta );
+	if ( VectorLengthSquared( delta ) > 0.1f * 0.1f ) {
+		return qfalse;
+	}
+
+	return qtrue;
+}
+
 /*
 =================
 CG_PredictPlayerState
@@ -493,20 +945,24 @@ but we simulate all unacknowledged commands each time, not just the new ones.
 This means that on an internet connection, quite a few pmoves may be issued
 each frame.
 
-OPTIMIZE: don't re-simulate unless the newly arrived snapshot playerState_t
-differs from the predicted one.  Would require saving all intermediate
-playerState_t during prediction.
+The state after every predicted command is saved. Frames without a new
+snapshot only predict the new commands and replay the saved states for
+the others. When a new snapshot arrives and its playerState_t matches the
+saved state for the same command, prediction resumes from there too. Only
+a prediction error or a teleport causes all commands to be run again.
 
 We detect prediction errors and allow them to be decayed off over several frames
 to ease the jerk.
 =================
 */
 void CG_PredictPlayerState( void ) {
-	int			cmdNum, current;
+	int			cmdNum, current, predictCmd, stateIndex, i;
+	int			numPredicted, numPlayedBack;
 	playerState_t	oldPlayerState;
 	qboolean	moved;
 	usercmd_t	oldestCmd;
 	usercmd_t	latestCmd;
+	localPlayer_t	*lc;
 
 	cg.cur_lc->hyperspace = qfalse;	// will be set if touching a trigger_teleport
 
@@ -516,6 +972,9 @@ void CG_PredictPlayerState( void ) {
 	if ( !cg.cur_lc->validPPS ) {
 		cg.cur_lc->validPPS = qtrue;
 		cg.cur_lc->predictedPlayerState = *cg.cur_ps;
+		cg.cur_lc->stateTail = cg.cur_lc->stateHead;
+		cg.cur_lc->lastPredictedCommand = 0;
+		cg.cur_lc->lastServerTime = -1;
 	}
 
 
@@ -598,6 +1057,48 @@ void CG_PredictPlayerState( void ) {
 
 	cg_pmove.pmove_overbounce = pmove_overbounce.integer;
 
+	lc = cg.cur_lc;
+	predictCmd = current - CMD_BACKUP + 1;
+	if ( cg_optimizePrediction.integer ) {
+		if ( cg.nextFrameTeleport || cg.thisFrameTeleport ) {
+			// predict all commands
+			lc->lastPredictedCommand = 0;
+			lc->stateTail = lc->stateHead;
+		} else if ( cg.physicsTime == lc->lastServerTime ) {
+			// no new snapshot, only predict the new commands
+			predictCmd = lc->lastPredictedCommand + 1;
+		} else {
+			// find the saved state for the command the new snapshot ends at
+			for ( i = lc->stateHead; i != lc->stateTail; i = ( i + 1 ) % NUM_SAVED_STATES ) {
+				if ( lc->savedPmoveStates[i].commandTime == lc->predictedPlayerState.commandTime ) {
+					break;
+				}
+			}
+
+			if ( i != lc->stateTail && CG_PredictedStateMatches( &lc->predictedPlayerState, &lc->savedPmoveStates[i] ) ) {
+				// continue from the saved state, keeping the fields only the server sets
+				CG_CopyPmoveState( &lc->predictedPlayerState, &lc->savedPmoveStates[i] );
+				lc->stateHead = ( i + 1 ) % NUM_SAVED_STATES;
+				predictCmd = lc->lastPredictedCommand + 1;
+			} else {
+				if ( cg_showmiss.integer && i != lc->stateTail ) {
+					CG_Printf( "saved state mismatch\n" );
+				}
+				// predict all commands
+				lc->lastPredictedCommand = 0;
+				lc->stateTail = lc->stateHead;
+			}
+		}
+		lc->lastServerTime = cg.physicsTime;
+	} else {
+		lc->lastPredictedCommand = 0;
+		lc->stateTail = lc->stateHead;
+		lc->lastServerTime = -1;
+	}
+	stateIndex = lc->stateHead;
+	numPredicted = 0;
+	numPlayedBack = 0;
+
 	// run cmds
 	moved = qfalse;
 	for ( cmdNum = current - CMD_BACKUP + 1 ; cmdNum <= current ; cmdNum++ ) {
@@ -680,7 +1181,33 @@ void CG_PredictPlayerState( void ) {
 			cg_pmove.cmd.serverTime = ((cg_pmove.cmd.serverTime + pmove_msec.integer-1) / pmove_msec.integer) * pmove_msec.integer;
 		}
 
-		Pmove (&cg_pmove);
+		if ( cmdNum < predictCmd && stateIndex != lc->stateTail
+			&& lc->savedPmoveStates[stateIndex].commandTime == cg_pmove.cmd.serverTime ) {
+			// play back the state predicted on an earlier frame
+			CG_CopyPmoveState( cg_pmove.ps, &lc->savedPmoveStates[stateIndex] );
+			stateIndex = ( stateIndex + 1 ) % NUM_SAVED_STATES;
+			numPlayedBack++;
+		} else {
+			if ( cmdNum < predictCmd ) {
+				// the saved states are out of sync, predict the rest
+				if ( cg_showmiss.integer ) {
+					CG_Printf( "saved state miss\n" );
+				}
+				predictCmd = cmdNum;
+			}
+
+			Pmove (&cg_pmove);
+			numPredicted++;
+
+			lc->lastPredictedCommand = cmdNum;
+
+			// save the state unless the queue is full
+			if ( cg_optimizePrediction.integer && ( stateIndex + 1 ) % NUM_SAVED_STATES != lc->stateHead ) {
+				lc->savedPmoveStates[stateIndex] = *cg_pmove.ps;
+				stateIndex = ( stateIndex + 1 ) % NUM_SAVED_STATES;
+			}
+			lc->stateTail = stateIndex;
+		}
 
 		moved = qtrue;
 
@@ -692,7 +1219,7 @@ void CG_PredictPlayerState( void ) {
 	}
 
 	if ( cg_showmiss.integer > 1 ) {
-		CG_Printf( "[%i : %i] ", cg_pmove.cmd.serverTime, cg.time );
+		CG_Printf( "[%i : %i] predicted %i, played back %i ", cg_pmove.cmd.serverTime, cg.time, numPredicted, numPlayedBack );
 	}
 
 	if ( !moved ) {
@@ -490,7 +490,7 @@ void CG_DrawTourneyScoreboard( void ) {
 	// request more scores regularly
 	if ( cg.scoresRequestTime + 2000 < cg.time ) {
 		cg.scoresRequestTime = cg.time;
-		trap_SendClientCommand( "score" );
+		trap_SendClientCommand( va( "score %i", cg.scoresVersion ) );
 	}
 
 	// draw the dialog background
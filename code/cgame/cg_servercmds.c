@@ -68,14 +68,44 @@ static int CG_ValidOrder(const char *p) {
 
 /*
 =================
-CG_ParseScores
+CG_ParseScore
 
+Reads one scoreboard entry from the server command arguments
 =================
 */
-static void CG_ParseScores( int start ) {
-	int		i, powerups;
+static void CG_ParseScore( int i, int arg ) {
+	int		powerups;
+
+	cg.scores[i].playerNum = atoi( CG_Argv( arg ) );
+	cg.scores[i].score = atoi( CG_Argv( arg + 1 ) );
+	cg.scores[i].ping = atoi( CG_Argv( arg + 2 ) );
+	cg.scores[i].time = atoi( CG_Argv( arg + 3 ) );
+	cg.scores[i].scoreFlags = atoi( CG_Argv( arg + 4 ) );
+	powerups = atoi( CG_Argv( arg + 5 ) );
+	cg.scores[i].accuracy = atoi(CG_Argv(arg + 6));
+	cg.scores[i].impressiveCount = atoi(CG_Argv(arg + 7));
+	cg.scores[i].excellentCount = atoi(CG_Argv(arg + 8));
+	cg.scores[i].guantletCount = atoi(CG_Argv(arg + 9));
+	cg.scores[i].defendCount = atoi(CG_Argv(arg + 10));
+	cg.scores[i].assistCount = atoi(CG_Argv(arg + 11));
+	cg.scores[i].perfect = atoi(CG_Argv(arg + 12));
+	cg.scores[i].captures = atoi(CG_Argv(arg + 13));
+
+	if ( cg.scores[i].playerNum < 0 || cg.scores[i].playerNum >= MAX_CLIENTS ) {
+		cg.scores[i].playerNum = 0;
+	}
+	cgs.playerinfo[ cg.scores[i].playerNum ].score = cg.scores[i].score;
+	cgs.playerinfo[ cg.scores[i].playerNum ].powerups = powerups;
+}
+
 #ifdef MISSIONPACK_HUD
-	int		j, selectedPlayerNum[MAX_SPLITVIEW];
+/*
+=================
+CG_SaveSelectedScores
+=================
+*/
+static void CG_SaveSelectedScores( int *selectedPlayerNum ) {
+	int		i;
 
 	for ( i = 0; i < CG_MaxSplitView(); i++ ) {
 		if ( cg.numScores > 0 ) {
@@ -85,6 +115,43 @@ static void CG_ParseScores( int start ) {
 		}
 		cg.localPlayers[i].selectedScore = 0;
 	}
+}
+
+/*
+=================
+CG_RestoreSelectedScores
+
+Restore score select, select own score if previous score player not present
+=================
+*/
+static void CG_RestoreSelectedScores( int *selectedPlayerNum ) {
+	int		i, j;
+
+	for ( i = 0 ; i < cg.numScores ; i++ ) {
+		for ( j = 0; j < CG_MaxSplitView(); j++ ) {
+			if ( selectedPlayerNum[j] == cg.scores[i].playerNum ) {
+				selectedPlayerNum[j] = -1; // found it, don't override with their player score
+				cg.localPlayers[j].selectedScore = i;
+			} else if ( selectedPlayerNum[j] != -1 && cg.snap->pss[j].playerNum == cg.scores[i].playerNum ) {
+				cg.localPlayers[j].selectedScore = i;
+			}
+		}
+	}
+}
+#endif
+
+/*
+=================
+CG_ParseScores
+
+=================
+*/
+static void CG_ParseScores( int start ) {
+	int		i;
+#ifdef MISSIONPACK_HUD
+	int		selectedPlayerNum[MAX_SPLITVIEW];
+
+	CG_SaveSelectedScores( selectedPlayerNum );
 #endif
 
 	cg.numScores = atoi( CG_Argv( 1 + start) );
@@ -97,42 +164,109 @@ static void CG_ParseScores( int start ) {
 
 	memset( cg.scores, 0, sizeof( cg.scores ) );
 	for ( i = 0 ; i < cg.numScores ; i++ ) {
-		//
-		cg.scores[i].playerNum = atoi( CG_Argv( i * 14 + 4 + start) );
-		cg.scores[i].score = atoi( CG_Argv( i * 14 + 5 + start) );
-		cg.scores[i].ping = atoi( CG_Argv( i * 14 + 6 + start) );
-		cg.scores[i].time = atoi( CG_Argv( i * 14 + 7 + start) );
-		cg.scores[i].scoreFlags = atoi( CG_Argv( i * 14 + 8 + start) );
-		powerups = atoi( CG_Argv( i * 14 + 9 + start) );
-		cg.scores[i].accuracy = atoi(CG_Argv(i * 14 + 10 + start));
-		cg.scores[i].impressiveCount = atoi(CG_Argv(i * 14 + 11 + start));
-		cg.scores[i].excellentCount = atoi(CG_Argv(i * 14 + 12 + start));
-		cg.scores[i].guantletCount = atoi(CG_Argv(i * 14 + 13 + start));
-		cg.scores[i].defendCount = atoi(CG_Argv(i * 14 + 14 + start));
-		cg.scores[i].assistCount = atoi(CG_Argv(i * 14 + 15 + start));
-		cg.scores[i].perfect = atoi(CG_Argv(i * 14 + 16 + start));
-		cg.scores[i].captures = atoi(CG_Argv(i * 14 + 17 + start));
-
-		if ( cg.scores[i].playerNum < 0 || cg.scores[i].playerNum >= MAX_CLIENTS ) {
-			cg.scores[i].playerNum = 0;
-		}
-		cgs.playerinfo[ cg.scores[i].playerNum ].score = cg.scores[i].score;
-		cgs.playerinfo[ cg.scores[i].playerNum ].powerups = powerups;
+		CG_ParseScore( i, i * 14 + 4 + start );
 
 		cg.scores[i].team = cgs.playerinfo[cg.scores[i].playerNum].team;
+	}
+
+	// servers that cache the scoreboard send its version last
+	cg.scoresVersion = atoi( CG_Argv( cg.numScores * 14 + 4 + start ) );
 
 #ifdef MISSIONPACK_HUD
-		// restore score select, select own score if previous score player not present
-		for ( j = 0; j < CG_MaxSplitView(); j++ ) {
-			if ( selectedPlayerNum[j] == cg.scores[i].playerNum ) {
-				selectedPlayerNum[j] = -1; // found it, don't override with their player score
-				cg.localPlayers[j].selectedScore = i;
-			} else if ( selectedPlayerNum[j] != -1 && cg.snap->pss[j].playerNum == cg.scores[i].playerNum ) {
-				cg.localPlayers[j].selectedScore = i;
-			}
+	CG_RestoreSelectedScores( selectedPlayerNum );
+#endif
+}
+
+/*
+=================
+CG_ParseScoresDelta
+
+Applies the entries that changed since the scoreboard version we hold
+=================
+*/
+static void CG_ParseScoresDelta( int start ) {
+	int		i, numChanged, score;
+	int		base, version;
+	int		arg;
+#ifdef MISSIONPACK_HUD
+	int		selectedPlayerNum[MAX_SPLITVIEW];
+#endif
+
+	base = atoi( CG_Argv( 1 + start ) );
+	version = atoi( CG_Argv( 2 + start ) );
+
+	if ( base != cg.scoresVersion ) {
+		// another local player already got this version
+		if ( version == cg.scoresVersion ) {
+			return;
+		}
+
+		// lost track, ask for the whole scoreboard
+		cg.scoresVersion = 0;
+		cg.scoresRequestTime = cg.time;
+		trap_SendClientCommand( "score" );
+		return;
+	}
+
+#ifdef MISSIONPACK_HUD
+	CG_SaveSelectedScores( selectedPlayerNum );
+#endif
+
+	cg.numScores = atoi( CG_Argv( 3 + start ) );
+	if ( cg.numScores > MAX_CLIENTS ) {
+		cg.numScores = MAX_CLIENTS;
+	}
+
+	cg.teamScores[0] = atoi( CG_Argv( 4 + start ) );
+	cg.teamScores[1] = atoi( CG_Argv( 5 + start ) );
+
+	numChanged = atoi( CG_Argv( 6 + start ) );
+	for ( i = 0 ; i < numChanged ; i++ ) {
+		arg = i * 15 + 7 + start;
+		score = atoi( CG_Argv( arg ) );
+		if ( score < 0 || score >= cg.numScores ) {
+			continue;
 		}
+		CG_ParseScore( score, arg + 1 );
+	}
+
+	// team changes come through the player configstrings
+	for ( i = 0 ; i < cg.numScores ; i++ ) {
+		cg.scores[i].team = cgs.playerinfo[cg.scores[i].playerNum].team;
+	}
+
+	cg.scoresVersion = version;
+
+#ifdef MISSIONPACK_HUD
+	CG_RestoreSelectedScores( selectedPlayerNum );
 #endif
+}
+
+static int teamInfoVersion[TEAM_NUM_TEAMS];
+
+/*
+=================
+CG_ParseTeamInfoEntry
+=================
+*/
+static qboolean CG_ParseTeamInfoEntry( int team, int i, int arg ) {
+	int		playerNum;
+
+	playerNum = atoi( CG_Argv( arg ) );
+	if( playerNum < 0 || playerNum >= MAX_CLIENTS )
+	{
+		CG_Error( "CG_ParseTeamInfo: bad player number: %d", playerNum );
+		return qfalse;
 	}
+
+	sortedTeamPlayers[team][i] = playerNum;
+
+	cgs.playerinfo[ playerNum ].location = atoi( CG_Argv( arg + 1 ) );
+	cgs.playerinfo[ playerNum ].health = atoi( CG_Argv( arg + 2 ) );
+	cgs.playerinfo[ playerNum ].armor = atoi( CG_Argv( arg + 3 ) );
+	cgs.playerinfo[ playerNum ].curWeapon = atoi( CG_Argv( arg + 4 ) );
+	cgs.playerinfo[ playerNum ].powerups = atoi( CG_Argv( arg + 5 ) );
+	return qtrue;
 }
 
 /*
@@ -144,11 +278,12 @@ Format:
 
 Each string is "playerNum location health armor weapon powerups"
 
+Servers that send deltas put the version after the strings
+
 =================
 */
 static void CG_ParseTeamInfo( int start ) {
 	int		i;
-	int		playerNum;
 	int		team;
 
 	team = atoi( CG_Argv( 1 + start ) );
@@ -170,21 +305,67 @@ static void CG_ParseTeamInfo( int start ) {
 	}
 
 	for ( i = 0 ; i < numSortedTeamPlayers[team] ; i++ ) {
-		playerNum = atoi( CG_Argv( i * 6 + 3 + start ) );
-		if( playerNum < 0 || playerNum >= MAX_CLIENTS )
-		{
-			CG_Error( "CG_ParseTeamInfo: bad player number: %d", playerNum );
+		if ( !CG_ParseTeamInfoEntry( team, i, i * 6 + 3 + start ) ) {
 			return;
 		}
+	}
+
+	// servers that only send changes put the version last
+	teamInfoVersion[team] = atoi( CG_Argv( numSortedTeamPlayers[team] * 6 + 3 + start ) );
+}
 
-		sortedTeamPlayers[team][i] = playerNum;
+/*
+=================
+CG_ParseTeamInfoDelta
+
+"tinfod" base version team numstrings numchanged string(there are numchanged strings)
+
+Each string is "index playerNum location health armor weapon powerups"
+=================
+*/
+static void CG_ParseTeamInfoDelta( int start ) {
+	int		i, index;
+	int		base, version;
+	int		team, numChanged;
+
+	base = atoi( CG_Argv( 1 + start ) );
+	version = atoi( CG_Argv( 2 + start ) );
+
+	team = atoi( CG_Argv( 3 + start ) );
+	if( team < 0 || team >= TEAM_NUM_TEAMS )
+	{
+		CG_Error( "CG_ParseTeamInfoDelta: team out of range (%d)",
+				team );
+		return;
+	}
 
-		cgs.playerinfo[ playerNum ].location = atoi( CG_Argv( i * 6 + 4 + start ) );
-		cgs.playerinfo[ playerNum ].health = atoi( CG_Argv( i * 6 + 5 + start ) );
-		cgs.playerinfo[ playerNum ].armor = atoi( CG_Argv( i * 6 + 6 + start ) );
-		cgs.playerinfo[ playerNum ].curWeapon = atoi( CG_Argv( i * 6 + 7 + start ) );
-		cgs.playerinfo[ playerNum ].powerups = atoi( CG_Argv( i * 6 + 8 + start ) );
+	// the server sends a full tinfo every few seconds if we lost track
+	if ( base != teamInfoVersion[team] ) {
+		return;
 	}
+
+	sortedTeamPlayersTime[team] = cg.time;
+
+	numSortedTeamPlayers[team] = atoi( CG_Argv( 4 + start ) );
+	if( numSortedTeamPlayers[team] < 0 || numSortedTeamPlayers[team] > TEAM_MAXOVERLAY )
+	{
+		CG_Error( "CG_ParseTeamInfoDelta: numSortedTeamPlayers out of range (%d)",
+				numSortedTeamPlayers[team] );
+		return;
+	}
+
+	numChanged = atoi( CG_Argv( 5 + start ) );
+	for ( i = 0 ; i < numChanged ; i++ ) {
+		index = atoi( CG_Argv( i * 7 + 6 + start ) );
+		if ( index < 0 || index >= numSortedTeamPlayers[team] ) {
+			continue;
+		}
+		if ( !CG_ParseTeamInfoEntry( team, index, i * 7 + 7 + start ) ) {
+			return;
+		}
+	}
+
+	teamInfoVersion[team] = version;
 }
 
 
@@ -1350,11 +1531,21 @@ static void CG_ServerCommand( void ) {
 		return;
 	}
 
+	if ( !strcmp( cmd, "dscores" ) ) {
+		CG_ParseScoresDelta(start);
+		return;
+	}
+
 	if ( !strcmp( cmd, "tinfo" ) ) {
 		CG_ParseTeamInfo(start);
 		return;
 	}
 
+	if ( !strcmp( cmd, "tinfod" ) ) {
+		CG_ParseTeamInfoDelta(start);
+		return;
+	}
+
 	if ( !strcmp( cmd, "map_restart" ) ) {
 		if ( localPlayerBits != -1 ) {
 			return;
@@ -165,9 +165,31 @@ typedef struct bot_matchtemplate_s
 	int type;
 	int subtype;
 	bot_matchpiece_t *first;
+	int *required;						//match strings required in the message
 	struct bot_matchtemplate_s *next;
 } bot_matchtemplate_t;
 
+//node of the match string automaton
+typedef struct bot_matchnode_s
+{
+	int c;								//upper case character leading to this node
+	int child;							//first child node
+	int sibling;						//next node with the same parent
+	int fail;							//node of the longest proper suffix
+	int output;							//nearest node on the fail chain a match string ends at
+	int found;							//last search the match string ending here was found
+} bot_matchnode_t;
+
+//automaton finding all the match strings of the match templates in one pass
+typedef struct bot_matchautomaton_s
+{
+	int numnodes;
+	bot_matchnode_t *nodes;
+	int numrequired;
+	int *required;
+	int search;							//number of the last search
+} bot_matchautomaton_t;
+
 //reply chat key
 typedef struct bot_replychatkey_s
 {
@@ -235,6 +257,8 @@ int consolemessagescount = 0;
 #endif
 //list with match strings
 bot_matchtemplate_t *matchtemplates = NULL;
+//automaton for the match strings of the match templates
+bot_matchautomaton_t *matchautomaton = NULL;
 //list with synonyms
 bot_synonymlist_t *synonyms = NULL;
 //list with random strings
@@ -1361,6 +1385,168 @@ void BotFreeMatchTemplates(bot_matchtemplate_t *mt)
 // Returns:					-
 // Changes Globals:		-
 //===========================================================================
+// returns the node the string ends at, the node is added if needed
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int BotMatchAutomatonAddString(bot_matchautomaton_t *ma, char *string)
+{
+	int node, child, c;
+
+	node = 0;
+	for (; *string; string++)
+	{
+		c = toupper(*string);
+		for (child = ma->nodes[node].child; child; child = ma->nodes[child].sibling)
+		{
+			if (ma->nodes[child].c == c) break;
+		} //end for
+		if (!child)
+		{
+			child = ma->numnodes++;
+			ma->nodes[child].c = c;
+			ma->nodes[child].child = 0;
+			ma->nodes[child].fail = 0;
+			ma->nodes[child].output = -1;
+			ma->nodes[child].found = 0;
+			ma->nodes[child].sibling = ma->nodes[node].child;
+			ma->nodes[node].child = child;
+		} //end if
+		node = child;
+	} //end for
+	ma->nodes[node].output = node;
+	return node;
+} //end of the function BotMatchAutomatonAddString
+//===========================================================================
+// returns the node reached from the given node with the given character
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int BotMatchAutomatonNextNode(bot_matchautomaton_t *ma, int node, int c)
+{
+	int child;
+
+	while(1)
+	{
+		for (child = ma->nodes[node].child; child; child = ma->nodes[child].sibling)
+		{
+			if (ma->nodes[child].c == c) return child;
+		} //end for
+		if (!node) break;
+		node = ma->nodes[node].fail;
+	} //end while
+	return 0;
+} //end of the function BotMatchAutomatonNextNode
+//===========================================================================
+// a match template can only match if for every match piece without an
+// empty string at least one of the strings is found in the message, so
+// these strings are stored for every template as a list of
+// number of pieces followed by the number of strings and the string end
+// nodes for every piece
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+bot_matchautomaton_t *BotCompileMatchTemplates(bot_matchtemplate_t *matches)
+{
+	int maxnodes, numrequired, numpieces, node, head, tail, child, *queue, *req;
+	bot_matchtemplate_t *mt;
+	bot_matchpiece_t *mp;
+	bot_matchstring_t *ms;
+	bot_matchautomaton_t *ma;
+
+	//count the nodes and required strings
+	maxnodes = 1;
+	numrequired = 0;
+	for (mt = matches; mt; mt = mt->next)
+	{
+		numrequired++;
+		for (mp = mt->first; mp; mp = mp->next)
+		{
+			if (mp->type != MT_STRING) continue;
+			numrequired += 1;
+			for (ms = mp->firststring; ms; ms = ms->next)
+			{
+				maxnodes += strlen(ms->string);
+				numrequired++;
+			} //end for
+		} //end for
+	} //end for
+	ma = (bot_matchautomaton_t *) GetClearedMemory(sizeof(bot_matchautomaton_t));
+	ma->nodes = (bot_matchnode_t *) GetClearedMemory(maxnodes * sizeof(bot_matchnode_t));
+	ma->required = (int *) GetClearedMemory(numrequired * sizeof(int));
+	ma->numnodes = 1;
+	ma->nodes[0].output = -1;
+	ma->search = 0;
+	//add the match strings
+	req = ma->required;
+	for (mt = matches; mt; mt = mt->next)
+	{
+		mt->required = req;
+		numpieces = 0;
+		req++;
+		for (mp = mt->first; mp; mp = mp->next)
+		{
+			if (mp->type != MT_STRING) continue;
+			for (ms = mp->firststring; ms; ms = ms->next)
+			{
+				if (!strlen(ms->string)) break;
+			} //end for
+			//a piece with an empty string matches anything
+			if (ms) continue;
+			req[0] = 0;
+			for (ms = mp->firststring; ms; ms = ms->next)
+			{
+				req[++req[0]] = BotMatchAutomatonAddString(ma, ms->string);
+			} //end for
+			req += req[0] + 1;
+			numpieces++;
+		} //end for
+		mt->required[0] = numpieces;
+	} //end for
+	ma->numrequired = req - ma->required;
+	//set the fail and output links breadth first
+	queue = (int *) GetClearedMemory(ma->numnodes * sizeof(int));
+	head = tail = 0;
+	for (child = ma->nodes[0].child; child; child = ma->nodes[child].sibling)
+	{
+		ma->nodes[child].fail = 0;
+		queue[tail++] = child;
+	} //end for
+	while(head < tail)
+	{
+		node = queue[head++];
+		//the output link points to the node itself if a string ends here
+		if (ma->nodes[node].output == -1)
+			ma->nodes[node].output = ma->nodes[ma->nodes[node].fail].output;
+		for (child = ma->nodes[node].child; child; child = ma->nodes[child].sibling)
+		{
+			ma->nodes[child].fail = BotMatchAutomatonNextNode(ma, ma->nodes[node].fail, ma->nodes[child].c);
+			queue[tail++] = child;
+		} //end for
+	} //end while
+	FreeMemory(queue);
+	return ma;
+} //end of the function BotCompileMatchTemplates
+//===========================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void BotFreeMatchAutomaton(bot_matchautomaton_t *ma)
+{
+	if (!ma) return;
+	FreeMemory(ma->nodes);
+	FreeMemory(ma->required);
+	FreeMemory(ma);
+} //end of the function BotFreeMatchAutomaton
+//===========================================================================
 bot_matchtemplate_t *BotLoadMatchTemplates(char *matchfile)
 {
 	int source;
@@ -1453,6 +1639,9 @@ bot_matchtemplate_t *BotLoadMatchTemplates(char *matchfile)
 	BotAI_Print(PRT_DEVELOPER, "loaded %s\n", matchfile);
 	//
 	//BotDumpMatchTemplates(matches);
+	//compile the match strings for fast matching
+	BotFreeMatchAutomaton(matchautomaton);
+	matchautomaton = BotCompileMatchTemplates(matches);
 	//
 	return matches;
 } //end of the function BotLoadMatchTemplates
@@ -1539,11 +1728,64 @@ int StringsMatch(bot_matchpiece_t *pieces, bot_match_t *match)
 // Returns:					-
 // Changes Globals:		-
 //===========================================================================
-int BotFindMatch(char *str, bot_match_t *match, unsigned long int context)
+// marks all the match strings found in the string
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void BotMatchAutomatonSearch(bot_matchautomaton_t *ma, char *str)
 {
-	int i;
-	bot_matchtemplate_t *ms;
+	int node, out;
+
+	ma->search++;
+	node = 0;
+	for (; *str; str++)
+	{
+		node = BotMatchAutomatonNextNode(ma, node, toupper(*str));
+		for (out = ma->nodes[node].output; out > 0; out = ma->nodes[ma->nodes[out].fail].output)
+		{
+			//the rest of the chain was marked together with this node
+			if (ma->nodes[out].found == ma->search) break;
+			ma->nodes[out].found = ma->search;
+		} //end for
+	} //end for
+} //end of the function BotMatchAutomatonSearch
+//===========================================================================
+// returns true if all the strings required by the match template were
+// found in the last search
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int BotMatchTemplateCandidate(bot_matchautomaton_t *ma, bot_matchtemplate_t *mt)
+{
+	int numpieces, numstrings, i, *req;
 
+	req = mt->required;
+	if (!req) return qtrue;
+	numpieces = *req++;
+	for (; numpieces > 0; numpieces--)
+	{
+		numstrings = *req++;
+		for (i = 0; i < numstrings; i++)
+		{
+			if (ma->nodes[req[i]].found == ma->search) break;
+		} //end for
+		if (i >= numstrings) return qfalse;
+		req += numstrings;
+	} //end for
+	return qtrue;
+} //end of the function BotMatchTemplateCandidate
+//===========================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void BotPrepareMatchString(char *str, bot_match_t *match)
+{
 	strncpy(match->string, str, MAX_MESSAGE_SIZE);
 	//remove any trailing enters
 	while(strlen(match->string) &&
@@ -1551,10 +1793,28 @@ int BotFindMatch(char *str, bot_match_t *match, unsigned long int context)
 	{
 		match->string[strlen(match->string)-1] = '\0';
 	} //end while
-	//compare the string with all the match strings
+} //end of the function BotPrepareMatchString
+//===========================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int BotFindMatch(char *str, bot_match_t *match, unsigned long int context)
+{
+	int i;
+	bot_matchtemplate_t *ms;
+
+	if (!matchautomaton)
+		return BotFindMatchLinear(str, match, context);
+	BotPrepareMatchString(str, match);
+	//find all the match strings in one pass over the string
+	BotMatchAutomatonSearch(matchautomaton, match->string);
+	//compare the string with the match templates that can match
 	for (ms = matchtemplates; ms; ms = ms->next)
 	{
 		if (!(ms->context & context)) continue;
+		if (!BotMatchTemplateCandidate(matchautomaton, ms)) continue;
 		//reset the match variable offsets
 		for (i = 0; i < MAX_MATCHVARIABLES; i++) match->variables[i].offset = -1;
 		//
@@ -1568,6 +1828,35 @@ int BotFindMatch(char *str, bot_match_t *match, unsigned long int context)
 	return qfalse;
 } //end of the function BotFindMatch
 //===========================================================================
+// tries all the match templates one after the other
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int BotFindMatchLinear(char *str, bot_match_t *match, unsigned long int context)
+{
+	int i;
+	bot_matchtemplate_t *ms;
+
+	BotPrepareMatchString(str, match);
+	//compare the string with all the match strings
+	for (ms = matchtemplates; ms; ms = ms->next)
+	{
+		if (!(ms->context & context)) continue;
+		//reset the match variable offsets
+		for (i = 0; i < MAX_MATCHVARIABLES; i++) match->variables[i].offset = -1;
+		//
+		if (StringsMatch(ms->first, match))
+		{
+			match->type = ms->type;
+			match->subtype = ms->subtype;
+			return qtrue;
+		} //end if
+	} //end for
+	return qfalse;
+} //end of the function BotFindMatchLinear
+//===========================================================================
 //
 // Check if string is exists in any match template
 //
@@ -3150,6 +3439,8 @@ void BotShutdownChatAI(void)
 	freeconsolemessages = NULL;
 	if (matchtemplates) BotFreeMatchTemplates(matchtemplates);
 	matchtemplates = NULL;
+	BotFreeMatchAutomaton(matchautomaton);
+	matchautomaton = NULL;
 	if (randomstrings) FreeMemory(randomstrings);
 	randomstrings = NULL;
 	if (synonyms) FreeMemory(synonyms);
@@ -111,6 +111,8 @@ void BotGetChatMessage(int chatstate, char *buf, int size);
 int StringContains(char *str1, char *str2, int casesensitive);
 //finds a match for the given string using the match templates
 int BotFindMatch(char *str, bot_match_t *match, unsigned long int context);
+//finds a match trying every match template, BotFindMatch only tries the templates that can match
+int BotFindMatchLinear(char *str, bot_match_t *match, unsigned long int context);
 //returns a variable from a match
 void BotMatchVariable(bot_match_t *match, int variable, char *buf, int size);
 //unify all the white spaces in the string
@@ -345,7 +345,7 @@ int BotGetLongTermGoal(bot_state_t *bs, int tfl, int retreat, bot_goal_t *goal)
 	char buf[MAX_MESSAGE_SIZE];
 	int areanum, teammates;
 	float croucher;
-	aas_entityinfo_t entinfo;
+	bot_sense_t *sense;
 	bot_waypoint_t *wp;
 
 	if (bs->ltgtype == LTG_TEAMHELP && !retreat) {
@@ -362,12 +362,12 @@ int BotGetLongTermGoal(bot_state_t *bs, int tfl, int retreat, bot_goal_t *goal)
 			bs->ltgtype = 0;
 		//if the team mate IS visible for quite some time
 		if (bs->teammatevisible_time < FloatTime() - 10) bs->ltgtype = 0;
-		//get entity information of the companion
-		BotEntityInfo(bs->teammate, &entinfo);
+		//get the record of the companion
+		sense = BotSense(bs->teammate);
 		//if the team mate is visible
 		if (BotEntityVisible(bs->entitynum, bs->eye, bs->viewangles, 360, bs->teammate)) {
 			//if close just stand still there
-			VectorSubtract(entinfo.origin, bs->origin, dir);
+			VectorSubtract(sense->origin, bs->origin, dir);
 			if (VectorLengthSquared(dir) < Square(100)) {
 				BotResetAvoidReach(bs->ms);
 				//check blocked teammates
@@ -380,13 +380,13 @@ int BotGetLongTermGoal(bot_state_t *bs, int tfl, int retreat, bot_goal_t *goal)
 			bs->teammatevisible_time = FloatTime();
 		}
 		//if the entity information is valid (entity in PVS)
-		if (entinfo.valid) {
-			areanum = BotPointAreaNum(entinfo.origin);
+		if (sense->valid) {
+			areanum = sense->areanum;
 			if (areanum && trap_AAS_AreaReachability(areanum)) {
 				//update team goal
 				bs->teamgoal.entitynum = bs->teammate;
 				bs->teamgoal.areanum = areanum;
-				VectorCopy(entinfo.origin, bs->teamgoal.origin);
+				VectorCopy(sense->origin, bs->teamgoal.origin);
 				VectorSet(bs->teamgoal.mins, -8, -8, -8);
 				VectorSet(bs->teamgoal.maxs, 8, 8, 8);
 			}
@@ -410,9 +410,9 @@ int BotGetLongTermGoal(bot_state_t *bs, int tfl, int retreat, bot_goal_t *goal)
 			BotEnterChat(bs->cs, bs->teammate, CHAT_TELL);
 			bs->ltgtype = 0;
 		}
-		//get entity information of the companion
-		BotEntityInfo(bs->teammate, &entinfo);
-		VectorSubtract(entinfo.origin, bs->origin, dir);
+		//get the record of the companion
+		sense = BotSense(bs->teammate);
+		VectorSubtract(sense->origin, bs->origin, dir);
 		teammates = BotCountTeamMates(bs, 256);
 
 		if (VectorLengthSquared(dir) < Square(bs->formation_dist + (teammates * bs->formation_dist))) {
@@ -453,7 +453,7 @@ int BotGetLongTermGoal(bot_state_t *bs, int tfl, int retreat, bot_goal_t *goal)
 				}
 				//if just arrived look at the companion
 				if (bs->arrive_time > FloatTime() - 2) {
-					VectorSubtract(entinfo.origin, bs->origin, dir);
+					VectorSubtract(sense->origin, bs->origin, dir);
 					vectoangles(dir, bs->ideal_viewangles);
 					bs->ideal_viewangles[2] *= 0.5;
 				}
@@ -484,13 +484,13 @@ int BotGetLongTermGoal(bot_state_t *bs, int tfl, int retreat, bot_goal_t *goal)
 			return qfalse;
 		}
 		//if the entity information is valid (entity in PVS)
-		if (entinfo.valid) {
-			areanum = BotPointAreaNum(entinfo.origin);
+		if (sense->valid) {
+			areanum = sense->areanum;
 			if (areanum && trap_AAS_AreaReachability(areanum)) {
 				//update team goal
 				bs->teamgoal.entitynum = bs->teammate;
 				bs->teamgoal.areanum = areanum;
-				VectorCopy(entinfo.origin, bs->teamgoal.origin);
+				VectorCopy(sense->origin, bs->teamgoal.origin);
 				VectorSet(bs->teamgoal.mins, -8, -8, -8);
 				VectorSet(bs->teamgoal.maxs, 8, 8, 8);
 			}
@@ -1035,7 +1035,7 @@ BotLongTermGoal
 ==================
 */
 int BotLongTermGoal(bot_state_t *bs, int tfl, int retreat, bot_goal_t *goal) {
-	aas_entityinfo_t entinfo;
+	bot_sense_t *sense;
 	char teammate[MAX_MESSAGE_SIZE];
 	float squaredist;
 	int areanum;
@@ -1057,16 +1057,16 @@ int BotLongTermGoal(bot_state_t *bs, int tfl, int retreat, bot_goal_t *goal) {
 			BotEnterChat(bs->cs, bs->teammate, CHAT_TELL);
 			bs->leadmessage_time = FloatTime();
 		}
-		//get entity information of the companion
-		BotEntityInfo(bs->lead_teammate, &entinfo);
+		//get the record of the companion
+		sense = BotSense(bs->lead_teammate);
 		//
-		if (entinfo.valid) {
-			areanum = BotPointAreaNum(entinfo.origin);
+		if (sense->valid) {
+			areanum = sense->areanum;
 			if (areanum && trap_AAS_AreaReachability(areanum)) {
 				//update team goal
 				bs->lead_teamgoal.entitynum = bs->lead_teammate;
 				bs->lead_teamgoal.areanum = areanum;
-				VectorCopy(entinfo.origin, bs->lead_teamgoal.origin);
+				VectorCopy(sense->origin, bs->lead_teamgoal.origin);
 				VectorSet(bs->lead_teamgoal.mins, -8, -8, -8);
 				VectorSet(bs->lead_teamgoal.maxs, 8, 8, 8);
 			}
@@ -1106,7 +1106,7 @@ int BotLongTermGoal(bot_state_t *bs, int tfl, int retreat, bot_goal_t *goal) {
 					bs->leadmessage_time = FloatTime();
 				}
 				//look at the team mate
-				VectorSubtract(entinfo.origin, bs->origin, dir);
+				VectorSubtract(sense->origin, bs->origin, dir);
 				vectoangles(dir, bs->ideal_viewangles);
 				bs->ideal_viewangles[2] *= 0.5;
 				//just wait for the team mate
@@ -117,6 +117,36 @@ int red_numaltroutegoals;
 aas_altroutegoal_t blue_altroutegoals[MAX_ALTROUTEGOALS];
 int blue_numaltroutegoals;
 
+//line of sight cache shared by the bot thinks of a single frame, the bots
+//with their eye in the same cell and the same convex AAS area share the
+//line of sight to an entity
+#define BOTVIS_CACHESIZE		4096
+#define BOTVIS_EYECELL			32
+
+typedef struct botviscache_s
+{
+	int frame;
+	int viewer;
+	int ent;
+	int area;
+	int cell[3];
+	float vis;
+} botviscache_t;
+
+typedef struct botvisstats_s
+{
+	int checks;			//line of sight checks after the field of vision test
+	int cached;			//checks answered from the cache
+	int shared;			//cached checks answered with the line of sight of another bot
+	int pvsculled;		//bounding box points skipped because they're not in the PVS
+	int traces;			//traces issued
+} botvisstats_t;
+
+botviscache_t botviscache[BOTVIS_CACHESIZE];
+int botvisframe;
+qboolean botvisframeactive;
+botvisstats_t botvisstats;
+
 
 /*
 ==================
@@ -213,15 +243,25 @@ EntityIsDead
 ==================
 */
 qboolean EntityIsDead(aas_entityinfo_t *entinfo) {
-	playerState_t ps;
+	return PlayerIsDead(entinfo->number);
+}
+
+/*
+==================
+PlayerIsDead
+==================
+*/
+qboolean PlayerIsDead(int playernum) {
+	gentity_t *ent;
 
-	if (entinfo->number >= 0 && entinfo->number < MAX_CLIENTS) {
-		//retrieve the current player state
-		if (!BotAI_GetPlayerState( entinfo->number, &ps )) {
+	if (playernum >= 0 && playernum < MAX_CLIENTS) {
+		//check the current player state without copying it
+		ent = &g_entities[playernum];
+		if (!ent->inuse || !ent->player) {
 			return qfalse;
 		}
 
-		if (ps.pm_type != PM_NORMAL) return qtrue;
+		if (ent->player->ps.pm_type != PM_NORMAL) return qtrue;
 	}
 	return qfalse;
 }
@@ -232,12 +272,30 @@ EntityCarriesFlag
 ==================
 */
 qboolean EntityCarriesFlag(aas_entityinfo_t *entinfo) {
-	if ( entinfo->powerups & ( 1 << PW_REDFLAG ) )
+	return PowerupsCarryFlag(entinfo->powerups);
+}
+
+/*
+==================
+PlayerCarriesFlag
+==================
+*/
+qboolean PlayerCarriesFlag(int playernum) {
+	return PowerupsCarryFlag(g_entities[playernum].s.powerups);
+}
+
+/*
+==================
+PowerupsCarryFlag
+==================
+*/
+qboolean PowerupsCarryFlag(int powerups) {
+	if ( powerups & ( 1 << PW_REDFLAG ) )
 		return qtrue;
-	if ( entinfo->powerups & ( 1 << PW_BLUEFLAG ) )
+	if ( powerups & ( 1 << PW_BLUEFLAG ) )
 		return qtrue;
 #ifdef MISSIONPACK
-	if ( entinfo->powerups & ( 1 << PW_NEUTRALFLAG ) )
+	if ( powerups & ( 1 << PW_NEUTRALFLAG ) )
 		return qtrue;
 #endif
 	return qfalse;
@@ -298,13 +356,18 @@ EntityCarriesCubes
 ==================
 */
 qboolean EntityCarriesCubes(aas_entityinfo_t *entinfo) {
-	entityState_t state;
+	return SenseCarriesCubes(BotSense(entinfo->number));
+}
 
+/*
+==================
+SenseCarriesCubes
+==================
+*/
+qboolean SenseCarriesCubes(bot_sense_t *sense) {
 	if (gametype != GT_HARVESTER)
 		return qfalse;
-	//FIXME: get this info from the aas_entityinfo_t ?
-	BotAI_GetEntityState(entinfo->number, &state);
-	if (state.tokens > 0)
+	if (sense->tokens > 0)
 		return qtrue;
 	return qfalse;
 }
@@ -340,6 +403,40 @@ qboolean EntityIsInvisible(aas_entityinfo_t *entinfo) {
 	}
 	return qfalse;
 }
+
+/*
+==================
+SenseIsInvisible
+
+same as EntityIsInvisible for the compact entity record
+==================
+*/
+qboolean SenseIsInvisible(bot_sense_t *sense) {
+	// if player is invisible
+	if (sense->powerups & (1 << PW_INVIS)) {
+		// a shooting player is always visible
+		if (sense->flags & EF_FIRING) {
+			return qfalse;
+		}
+		// the flag is always visible
+		if (PowerupsCarryFlag(sense->powerups)) {
+			return qfalse;
+		}
+#ifdef MISSIONPACK
+		// cubes are always visible
+		if (SenseCarriesCubes(sense)) {
+			return qfalse;
+		}
+		// kamikaze are always visible
+		if (sense->flags & EF_KAMIKAZE) {
+			return qfalse;
+		}
+#endif
+		// invisible
+		return qtrue;
+	}
+	return qfalse;
+}
 #ifdef MISSIONPACK
 /*
 ==================
@@ -390,7 +487,6 @@ BotSetTeamStatus
 void BotSetTeamStatus(bot_state_t *bs) {
 #ifdef MISSIONPACK
 	int teamtask;
-	aas_entityinfo_t entinfo;
 
 	teamtask = TEAMTASK_PATROL;
 
@@ -398,9 +494,8 @@ void BotSetTeamStatus(bot_state_t *bs) {
 		case LTG_TEAMHELP:
 			break;
 		case LTG_TEAMACCOMPANY:
-			BotEntityInfo(bs->teammate, &entinfo);
-			if ( ( (gametype == GT_CTF || gametype == GT_1FCTF) && EntityCarriesFlag(&entinfo))
-				|| ( gametype == GT_HARVESTER && EntityCarriesCubes(&entinfo)) ) {
+			if ( ( (gametype == GT_CTF || gametype == GT_1FCTF) && PowerupsCarryFlag(BotSense(bs->teammate)->powerups))
+				|| ( gametype == GT_HARVESTER && SenseCarriesCubes(BotSense(bs->teammate))) ) {
 				teamtask = TEAMTASK_ESCORT;
 			}
 			else {
@@ -1179,7 +1274,6 @@ BotHarvesterSeekGoals
 ==================
 */
 void BotHarvesterSeekGoals(bot_state_t *bs) {
-	aas_entityinfo_t entinfo;
 	float rnd, l1, l2;
 	int c;
 
@@ -1207,8 +1301,7 @@ void BotHarvesterSeekGoals(bot_state_t *bs) {
 	// if the bot decided to follow someone
 	if ( bs->ltgtype == LTG_TEAMACCOMPANY && !bs->ordered ) {
 		// if the team mate being accompanied no longer carries the flag
-		BotEntityInfo(bs->teammate, &entinfo);
-		if (!EntityCarriesCubes(&entinfo)) {
+		if (!SenseCarriesCubes(BotSense(bs->teammate))) {
 			bs->ltgtype = 0;
 		}
 	}
@@ -1754,79 +1847,90 @@ void BotCheckItemPickup(bot_state_t *bs, int *oldinventory) {
 
 /*
 ==================
-BotUpdateInventory
+BotPlayerStateInventory
+
+fills the inventory from the player state, only reads the bot state
 ==================
 */
-void BotUpdateInventory(bot_state_t *bs) {
-	int oldinventory[MAX_ITEMS];
-
-	memcpy(oldinventory, bs->inventory, sizeof(oldinventory));
+void BotPlayerStateInventory(bot_state_t *bs, playerState_t *ps, int *inventory) {
 	//armor
-	bs->inventory[INVENTORY_ARMOR] = bs->cur_ps.stats[STAT_ARMOR];
+	inventory[INVENTORY_ARMOR] = ps->stats[STAT_ARMOR];
 	//weapons
-	bs->inventory[INVENTORY_GAUNTLET] = (bs->cur_ps.stats[STAT_WEAPONS] & (1 << WP_GAUNTLET)) != 0;
-	bs->inventory[INVENTORY_SHOTGUN] = (bs->cur_ps.stats[STAT_WEAPONS] & (1 << WP_SHOTGUN)) != 0;
-	bs->inventory[INVENTORY_MACHINEGUN] = (bs->cur_ps.stats[STAT_WEAPONS] & (1 << WP_MACHINEGUN)) != 0;
-	bs->inventory[INVENTORY_GRENADELAUNCHER] = (bs->cur_ps.stats[STAT_WEAPONS] & (1 << WP_GRENADE_LAUNCHER)) != 0;
-	bs->inventory[INVENTORY_ROCKETLAUNCHER] = (bs->cur_ps.stats[STAT_WEAPONS] & (1 << WP_ROCKET_LAUNCHER)) != 0;
-	bs->inventory[INVENTORY_LIGHTNING] = (bs->cur_ps.stats[STAT_WEAPONS] & (1 << WP_LIGHTNING)) != 0;
-	bs->inventory[INVENTORY_RAILGUN] = (bs->cur_ps.stats[STAT_WEAPONS] & (1 << WP_RAILGUN)) != 0;
-	bs->inventory[INVENTORY_PLASMAGUN] = (bs->cur_ps.stats[STAT_WEAPONS] & (1 << WP_PLASMAGUN)) != 0;
-	bs->inventory[INVENTORY_BFG10K] = (bs->cur_ps.stats[STAT_WEAPONS] & (1 << WP_BFG)) != 0;
-	bs->inventory[INVENTORY_GRAPPLINGHOOK] = (bs->cur_ps.stats[STAT_WEAPONS] & (1 << WP_GRAPPLING_HOOK)) != 0;
+	inventory[INVENTORY_GAUNTLET] = (ps->stats[STAT_WEAPONS] & (1 << WP_GAUNTLET)) != 0;
+	inventory[INVENTORY_SHOTGUN] = (ps->stats[STAT_WEAPONS] & (1 << WP_SHOTGUN)) != 0;
+	inventory[INVENTORY_MACHINEGUN] = (ps->stats[STAT_WEAPONS] & (1 << WP_MACHINEGUN)) != 0;
+	inventory[INVENTORY_GRENADELAUNCHER] = (ps->stats[STAT_WEAPONS] & (1 << WP_GRENADE_LAUNCHER)) != 0;
+	inventory[INVENTORY_ROCKETLAUNCHER] = (ps->stats[STAT_WEAPONS] & (1 << WP_ROCKET_LAUNCHER)) != 0;
+	inventory[INVENTORY_LIGHTNING] = (ps->stats[STAT_WEAPONS] & (1 << WP_LIGHTNING)) != 0;
+	inventory[INVENTORY_RAILGUN] = (ps->stats[STAT_WEAPONS] & (1 << WP_RAILGUN)) != 0;
+	inventory[INVENTORY_PLASMAGUN] = (ps->stats[STAT_WEAPONS] & (1 << WP_PLASMAGUN)) != 0;
+	inventory[INVENTORY_BFG10K] = (ps->stats[STAT_WEAPONS] & (1 << WP_BFG)) != 0;
+	inventory[INVENTORY_GRAPPLINGHOOK] = (ps->stats[STAT_WEAPONS] & (1 << WP_GRAPPLING_HOOK)) != 0;
 #ifdef MISSIONPACK
-	bs->inventory[INVENTORY_NAILGUN] = (bs->cur_ps.stats[STAT_WEAPONS] & (1 << WP_NAILGUN)) != 0;;
-	bs->inventory[INVENTORY_PROXLAUNCHER] = (bs->cur_ps.stats[STAT_WEAPONS] & (1 << WP_PROX_LAUNCHER)) != 0;;
-	bs->inventory[INVENTORY_CHAINGUN] = (bs->cur_ps.stats[STAT_WEAPONS] & (1 << WP_CHAINGUN)) != 0;;
+	inventory[INVENTORY_NAILGUN] = (ps->stats[STAT_WEAPONS] & (1 << WP_NAILGUN)) != 0;;
+	inventory[INVENTORY_PROXLAUNCHER] = (ps->stats[STAT_WEAPONS] & (1 << WP_PROX_LAUNCHER)) != 0;;
+	inventory[INVENTORY_CHAINGUN] = (ps->stats[STAT_WEAPONS] & (1 << WP_CHAINGUN)) != 0;;
 #endif
 	//ammo
-	bs->inventory[INVENTORY_SHELLS] = bs->cur_ps.ammo[WP_SHOTGUN];
-	bs->inventory[INVENTORY_BULLETS] = bs->cur_ps.ammo[WP_MACHINEGUN];
-	bs->inventory[INVENTORY_GRENADES] = bs->cur_ps.ammo[WP_GRENADE_LAUNCHER];
-	bs->inventory[INVENTORY_CELLS] = bs->cur_ps.ammo[WP_PLASMAGUN];
-	bs->inventory[INVENTORY_LIGHTNINGAMMO] = bs->cur_ps.ammo[WP_LIGHTNING];
-	bs->inventory[INVENTORY_ROCKETS] = bs->cur_ps.ammo[WP_ROCKET_LAUNCHER];
-	bs->inventory[INVENTORY_SLUGS] = bs->cur_ps.ammo[WP_RAILGUN];
-	bs->inventory[INVENTORY_BFGAMMO] = bs->cur_ps.ammo[WP_BFG];
+	inventory[INVENTORY_SHELLS] = ps->ammo[WP_SHOTGUN];
+	inventory[INVENTORY_BULLETS] = ps->ammo[WP_MACHINEGUN];
+	inventory[INVENTORY_GRENADES] = ps->ammo[WP_GRENADE_LAUNCHER];
+	inventory[INVENTORY_CELLS] = ps->ammo[WP_PLASMAGUN];
+	inventory[INVENTORY_LIGHTNINGAMMO] = ps->ammo[WP_LIGHTNING];
+	inventory[INVENTORY_ROCKETS] = ps->ammo[WP_ROCKET_LAUNCHER];
+	inventory[INVENTORY_SLUGS] = ps->ammo[WP_RAILGUN];
+	inventory[INVENTORY_BFGAMMO] = ps->ammo[WP_BFG];
 #ifdef MISSIONPACK
-	bs->inventory[INVENTORY_NAILS] = bs->cur_ps.ammo[WP_NAILGUN];
-	bs->inventory[INVENTORY_MINES] = bs->cur_ps.ammo[WP_PROX_LAUNCHER];
-	bs->inventory[INVENTORY_BELT] = bs->cur_ps.ammo[WP_CHAINGUN];
+	inventory[INVENTORY_NAILS] = ps->ammo[WP_NAILGUN];
+	inventory[INVENTORY_MINES] = ps->ammo[WP_PROX_LAUNCHER];
+	inventory[INVENTORY_BELT] = ps->ammo[WP_CHAINGUN];
 #endif
 	//powerups
-	bs->inventory[INVENTORY_HEALTH] = bs->cur_ps.stats[STAT_HEALTH];
-	bs->inventory[INVENTORY_TELEPORTER] = bs->cur_ps.stats[STAT_HOLDABLE_ITEM] == MODELINDEX_TELEPORTER;
-	bs->inventory[INVENTORY_MEDKIT] = bs->cur_ps.stats[STAT_HOLDABLE_ITEM] == MODELINDEX_MEDKIT;
+	inventory[INVENTORY_HEALTH] = ps->stats[STAT_HEALTH];
+	inventory[INVENTORY_TELEPORTER] = ps->stats[STAT_HOLDABLE_ITEM] == MODELINDEX_TELEPORTER;
+	inventory[INVENTORY_MEDKIT] = ps->stats[STAT_HOLDABLE_ITEM] == MODELINDEX_MEDKIT;
 #ifdef MISSIONPACK
-	bs->inventory[INVENTORY_KAMIKAZE] = bs->cur_ps.stats[STAT_HOLDABLE_ITEM] == MODELINDEX_KAMIKAZE;
-	bs->inventory[INVENTORY_PORTAL] = bs->cur_ps.stats[STAT_HOLDABLE_ITEM] == MODELINDEX_PORTAL;
-	bs->inventory[INVENTORY_INVULNERABILITY] = bs->cur_ps.stats[STAT_HOLDABLE_ITEM] == MODELINDEX_INVULNERABILITY;
+	inventory[INVENTORY_KAMIKAZE] = ps->stats[STAT_HOLDABLE_ITEM] == MODELINDEX_KAMIKAZE;
+	inventory[INVENTORY_PORTAL] = ps->stats[STAT_HOLDABLE_ITEM] == MODELINDEX_PORTAL;
+	inventory[INVENTORY_INVULNERABILITY] = ps->stats[STAT_HOLDABLE_ITEM] == MODELINDEX_INVULNERABILITY;
 #endif
-	bs->inventory[INVENTORY_QUAD] = bs->cur_ps.powerups[PW_QUAD] != 0;
-	bs->inventory[INVENTORY_ENVIRONMENTSUIT] = bs->cur_ps.powerups[PW_BATTLESUIT] != 0;
-	bs->inventory[INVENTORY_HASTE] = bs->cur_ps.powerups[PW_HASTE] != 0;
-	bs->inventory[INVENTORY_INVISIBILITY] = bs->cur_ps.powerups[PW_INVIS] != 0;
-	bs->inventory[INVENTORY_REGEN] = bs->cur_ps.powerups[PW_REGEN] != 0;
-	bs->inventory[INVENTORY_FLIGHT] = bs->cur_ps.powerups[PW_FLIGHT] != 0;
+	inventory[INVENTORY_QUAD] = ps->powerups[PW_QUAD] != 0;
+	inventory[INVENTORY_ENVIRONMENTSUIT] = ps->powerups[PW_BATTLESUIT] != 0;
+	inventory[INVENTORY_HASTE] = ps->powerups[PW_HASTE] != 0;
+	inventory[INVENTORY_INVISIBILITY] = ps->powerups[PW_INVIS] != 0;
+	inventory[INVENTORY_REGEN] = ps->powerups[PW_REGEN] != 0;
+	inventory[INVENTORY_FLIGHT] = ps->powerups[PW_FLIGHT] != 0;
 #ifdef MISSIONPACK
-	bs->inventory[INVENTORY_SCOUT] = bs->cur_ps.stats[STAT_PERSISTANT_POWERUP] == MODELINDEX_SCOUT;
-	bs->inventory[INVENTORY_GUARD] = bs->cur_ps.stats[STAT_PERSISTANT_POWERUP] == MODELINDEX_GUARD;
-	bs->inventory[INVENTORY_DOUBLER] = bs->cur_ps.stats[STAT_PERSISTANT_POWERUP] == MODELINDEX_DOUBLER;
-	bs->inventory[INVENTORY_AMMOREGEN] = bs->cur_ps.stats[STAT_PERSISTANT_POWERUP] == MODELINDEX_AMMOREGEN;
+	inventory[INVENTORY_SCOUT] = ps->stats[STAT_PERSISTANT_POWERUP] == MODELINDEX_SCOUT;
+	inventory[INVENTORY_GUARD] = ps->stats[STAT_PERSISTANT_POWERUP] == MODELINDEX_GUARD;
+	inventory[INVENTORY_DOUBLER] = ps->stats[STAT_PERSISTANT_POWERUP] == MODELINDEX_DOUBLER;
+	inventory[INVENTORY_AMMOREGEN] = ps->stats[STAT_PERSISTANT_POWERUP] == MODELINDEX_AMMOREGEN;
 #endif
-	bs->inventory[INVENTORY_REDFLAG] = bs->cur_ps.powerups[PW_REDFLAG] != 0;
-	bs->inventory[INVENTORY_BLUEFLAG] = bs->cur_ps.powerups[PW_BLUEFLAG] != 0;
+	inventory[INVENTORY_REDFLAG] = ps->powerups[PW_REDFLAG] != 0;
+	inventory[INVENTORY_BLUEFLAG] = ps->powerups[PW_BLUEFLAG] != 0;
 #ifdef MISSIONPACK
-	bs->inventory[INVENTORY_NEUTRALFLAG] = bs->cur_ps.powerups[PW_NEUTRALFLAG] != 0;
+	inventory[INVENTORY_NEUTRALFLAG] = ps->powerups[PW_NEUTRALFLAG] != 0;
 	if (BotTeam(bs) == TEAM_RED) {
-		bs->inventory[INVENTORY_REDCUBE] = bs->cur_ps.tokens;
-		bs->inventory[INVENTORY_BLUECUBE] = 0;
+		inventory[INVENTORY_REDCUBE] = ps->tokens;
+		inventory[INVENTORY_BLUECUBE] = 0;
 	}
 	else {
-		bs->inventory[INVENTORY_REDCUBE] = 0;
-		bs->inventory[INVENTORY_BLUECUBE] = bs->cur_ps.tokens;
+		inventory[INVENTORY_REDCUBE] = 0;
+		inventory[INVENTORY_BLUECUBE] = ps->tokens;
 	}
 #endif
+}
+
+/*
+==================
+BotUpdateInventory
+==================
+*/
+void BotUpdateInventory(bot_state_t *bs) {
+	int oldinventory[MAX_ITEMS];
+
+	memcpy(oldinventory, bs->inventory, sizeof(oldinventory));
+	BotPlayerStateInventory(bs, &bs->cur_ps, bs->inventory);
 	BotCheckItemPickup(bs, oldinventory);
 }
 
@@ -2385,7 +2489,7 @@ int BotWantsToRetreat(bot_state_t *bs) {
 		if (EntityCarriesFlag(&entinfo)) return qfalse;
 #ifdef MISSIONPACK
 		// if the enemy is carrying cubes
-		if (EntityCarriesCubes(&entinfo)) return qfalse;
+		if (SenseCarriesCubes(BotSense(bs->enemy))) return qfalse;
 #endif
 	}
 	//if the bot is getting the flag
@@ -2437,9 +2541,8 @@ int BotWantsToChase(bot_state_t *bs) {
 		//never chase if carrying cubes
 		if (BotHarvesterCarryingCubes(bs)) return qfalse;
 
-		BotEntityInfo(bs->enemy, &entinfo);
 		// always chase if the enemy is carrying cubes
-		if (EntityCarriesCubes(&entinfo)) return qtrue;
+		if (SenseCarriesCubes(BotSense(bs->enemy))) return qtrue;
 	}
 #endif
 	//if the bot is getting the flag
@@ -2924,40 +3027,42 @@ qboolean InFieldOfVision(vec3_t viewangles, float fov, vec3_t angles)
 
 /*
 ==================
-BotEntityVisible
+BotEntityLineOfSight
 
 returns visibility in the range [0, 1] taking fog and water surfaces into account
+the field of vision isn't checked
 ==================
 */
-float BotEntityVisible(int viewer, vec3_t eye, vec3_t viewangles, float fov, int ent) {
+static float BotEntityLineOfSight(int viewer, vec3_t eye, int ent, bot_sense_t *sense, qboolean *hitplayer) {
 	int i, contents_mask, passent, hitent, infog, inwater, otherinfog, pc;
 	float squaredfogdist, waterfactor, vis, bestvis;
 	bsp_trace_t trace;
-	aas_entityinfo_t entinfo;
-	vec3_t dir, entangles, start, end, middle;
-
-	BotEntityInfo(ent, &entinfo);
-	if (!entinfo.valid) {
-		return 0;
-	}
+	vec3_t dir, start, end, middle, points[3];
 
 	//calculate middle of bounding box
-	VectorAdd(entinfo.mins, entinfo.maxs, middle);
+	VectorAdd(sense->mins, sense->maxs, middle);
 	VectorScale(middle, 0.5, middle);
-	VectorAdd(entinfo.origin, middle, middle);
-	//check if entity is within field of vision
-	VectorSubtract(middle, eye, dir);
-	vectoangles(dir, entangles);
-	if (!InFieldOfVision(viewangles, fov, entangles)) return 0;
+	VectorAdd(sense->origin, middle, middle);
+	//check the middle, bottom and top of the bounding box
+	VectorCopy(middle, points[0]);
+	VectorCopy(middle, points[1]);
+	points[1][2] += sense->mins[2];
+	VectorCopy(points[1], points[2]);
+	points[2][2] += sense->maxs[2] - sense->mins[2];
 	//
 	pc = trap_AAS_PointContents(eye);
 	infog = (pc & CONTENTS_FOG);
 	inwater = (pc & (CONTENTS_LAVA|CONTENTS_SLIME|CONTENTS_WATER));
 	//
 	bestvis = 0;
+	*hitplayer = qfalse;
 	for (i = 0; i < 3; i++) {
+		VectorCopy(points[i], middle);
 		//if the point is not in potential visible sight
-		//if (!AAS_inPVS(eye, middle)) continue;
+		if (!trap_InPVS(eye, middle)) {
+			botvisstats.pvsculled++;
+			continue;
+		}
 		//
 		contents_mask = CONTENTS_SOLID|CONTENTS_PLAYERCLIP;
 		passent = viewer;
@@ -2980,6 +3085,11 @@ float BotEntityVisible(int viewer, vec3_t eye, vec3_t viewangles, float fov, int
 		}
 		//trace from start to end
 		BotAI_Trace(&trace, start, NULL, NULL, end, passent, contents_mask);
+		botvisstats.traces++;
+		//the result depends on who is looking if the trace ended on a player other than the entity
+		if (trace.fraction < 1 && trace.entityNum != ent && trace.entityNum < MAX_CLIENTS) {
+			*hitplayer = qtrue;
+		}
 		//if water was hit
 		waterfactor = 1.0;
 #if 0 // FIXME?: bsp_trace_t::contents was always 0 in quake3, now it's actually set
@@ -3005,12 +3115,14 @@ float BotEntityVisible(int viewer, vec3_t eye, vec3_t viewangles, float fov, int
 			else if (infog) {
 				VectorCopy(trace.endpos, start);
 				BotAI_Trace(&trace, start, NULL, NULL, eye, viewer, CONTENTS_FOG);
+				botvisstats.traces++;
 				VectorSubtract(eye, trace.endpos, dir);
 				squaredfogdist = VectorLengthSquared(dir);
 			}
 			else if (otherinfog) {
 				VectorCopy(trace.endpos, end);
 				BotAI_Trace(&trace, eye, NULL, NULL, end, viewer, CONTENTS_FOG);
+				botvisstats.traces++;
 				VectorSubtract(end, trace.endpos, dir);
 				squaredfogdist = VectorLengthSquared(dir);
 			}
@@ -3027,13 +3139,114 @@ float BotEntityVisible(int viewer, vec3_t eye, vec3_t viewangles, float fov, int
 			//if pretty much no fog
 			if (bestvis >= 0.95) return bestvis;
 		}
-		//check bottom and top of bounding box as well
-		if (i == 0) middle[2] += entinfo.mins[2];
-		else if (i == 1) middle[2] += entinfo.maxs[2] - entinfo.mins[2];
 	}
 	return bestvis;
 }
 
+/*
+==================
+BotBeginVisibilityFrame
+
+the visibility cache is only used while the bots think, the entities
+don't move in between
+==================
+*/
+void BotBeginVisibilityFrame(void) {
+	botvisframe++;
+	botvisframeactive = qtrue;
+}
+
+/*
+==================
+BotEndVisibilityFrame
+==================
+*/
+void BotEndVisibilityFrame(void) {
+	botvisframeactive = qfalse;
+}
+
+/*
+==================
+BotVisibilityStats
+==================
+*/
+void BotVisibilityStats(qboolean reset) {
+	if (reset) {
+		memset(&botvisstats, 0, sizeof(botvisstats));
+		return;
+	}
+	BotAI_Print(PRT_MESSAGE, "%d visibility checks, %d cached (%d from other bots), %d points outside PVS, %d traces\n",
+		botvisstats.checks, botvisstats.cached, botvisstats.shared, botvisstats.pvsculled, botvisstats.traces);
+}
+
+/*
+==================
+BotEntityVisible
+
+returns visibility in the range [0, 1] taking fog and water surfaces into account
+==================
+*/
+float BotEntityVisible(int viewer, vec3_t eye, vec3_t viewangles, float fov, int ent) {
+	bot_sense_t *sense;
+	botviscache_t *cache;
+	vec3_t dir, entangles, middle;
+	float vis;
+	int i, area, cell[3];
+	qboolean hitplayer;
+
+	if (ent < 0 || ent >= level.num_entities) {
+		BotAI_Print(PRT_FATAL, "BotEntityVisible: entnum %d out of range\n", ent);
+		return 0;
+	}
+	sense = BotSense(ent);
+	if (!sense->valid) {
+		return 0;
+	}
+
+	//calculate middle of bounding box
+	VectorAdd(sense->mins, sense->maxs, middle);
+	VectorScale(middle, 0.5, middle);
+	VectorAdd(sense->origin, middle, middle);
+	//check if entity is within field of vision
+	VectorSubtract(middle, eye, dir);
+	vectoangles(dir, entangles);
+	if (!InFieldOfVision(viewangles, fov, entangles)) return 0;
+	//
+	botvisstats.checks++;
+	if (!botvisframeactive) {
+		return BotEntityLineOfSight(viewer, eye, ent, sense, &hitplayer);
+	}
+	//a cell can straddle a wall, the eyes are only in sight of each other
+	//when they're also in the same convex area
+	area = trap_AAS_PointAreaNum(eye);
+	if (!area) {
+		return BotEntityLineOfSight(viewer, eye, ent, sense, &hitplayer);
+	}
+	//the line of sight to the entity is shared by all the eyes in the same cell and area this frame
+	for (i = 0; i < 3; i++) {
+		cell[i] = floor(eye[i] / BOTVIS_EYECELL);
+	}
+	cache = &botviscache[(((cell[0] * 73856093) ^ (cell[1] * 19349663) ^ (cell[2] * 83492791)) + area * 31 + ent * 67) & (BOTVIS_CACHESIZE - 1)];
+	if (cache->frame == botvisframe && cache->ent == ent && cache->area == area &&
+			cache->cell[0] == cell[0] && cache->cell[1] == cell[1] && cache->cell[2] == cell[2]) {
+		botvisstats.cached++;
+		if (cache->viewer != viewer) botvisstats.shared++;
+		return cache->vis;
+	}
+	vis = BotEntityLineOfSight(viewer, eye, ent, sense, &hitplayer);
+	//don't share a line of sight that ended on a player, another viewer could see past it
+	if (hitplayer) {
+		return vis;
+	}
+	cache->frame = botvisframe;
+	cache->viewer = viewer;
+	cache->ent = ent;
+	cache->area = area;
+	VectorCopy(cell, cache->cell);
+	cache->vis = vis;
+	return cache->vis;
+}
+
 /*
 ==================
 BotFindEnemy
@@ -3043,7 +3256,7 @@ int BotFindEnemy(bot_state_t *bs, int curenemy) {
 	int i, healthdecrease;
 	float f, alertness, easyfragger, vis;
 	float squaredist, cursquaredist;
-	aas_entityinfo_t entinfo, curenemyinfo, curbotinfo;
+	bot_sense_t *sense, *cursense;
 	vec3_t dir, angles;
 
 	alertness = Characteristic_BFloat(bs->character, CHARACTERISTIC_ALERTNESS, 0, 1);
@@ -3054,14 +3267,14 @@ int BotFindEnemy(bot_state_t *bs, int curenemy) {
 	bs->lasthealth = bs->inventory[INVENTORY_HEALTH];
 	//
 	if (curenemy >= 0) {
-		BotEntityInfo(curenemy, &curenemyinfo);
+		cursense = BotSense(curenemy);
 		// only concentrate on flag carrier if not carrying a flag
-		if (EntityCarriesFlag(&curenemyinfo) && !BotCTFCarryingFlag(bs)) {
+		if (PowerupsCarryFlag(cursense->powerups) && !BotCTFCarryingFlag(bs)) {
 			return qfalse;
 		}
 #ifdef MISSIONPACK
 		// only concentrate on cube carrier if not carrying cubes
-		if (EntityCarriesCubes(&curenemyinfo) && !BotHarvesterCarryingCubes(bs)) {
+		if (SenseCarriesCubes(cursense) && !BotHarvesterCarryingCubes(bs)) {
 			return qfalse;
 		}
 #endif
@@ -3070,7 +3283,7 @@ int BotFindEnemy(bot_state_t *bs, int curenemy) {
 			return qfalse;
 		}
 		//
-		VectorSubtract(curenemyinfo.origin, bs->origin, dir);
+		VectorSubtract(cursense->origin, bs->origin, dir);
 		cursquaredist = VectorLengthSquared(dir);
 	}
 	else {
@@ -3118,39 +3331,41 @@ int BotFindEnemy(bot_state_t *bs, int curenemy) {
 			continue;
 		}
 		//
-		BotEntityInfo(i, &entinfo);
-		//
-		if (!entinfo.valid) continue;
-		//if the enemy isn't dead and the enemy isn't the bot self
-		if (EntityIsDead(&entinfo) || entinfo.number == bs->entitynum) continue;
+		sense = BotSense(i);
+		if (!sense->valid) continue;
+		//if the enemy is dead
+		if (PlayerIsDead(i)) continue;
+		//if the enemy is out of range
+		VectorSubtract(sense->origin, bs->origin, dir);
+		if (VectorLengthSquared(dir) > Square(900.0 + alertness * 4000.0)) continue;
+		//if the enemy is the bot self
+		if (i == bs->entitynum) continue;
 		//if the enemy is invisible
-		if (EntityIsInvisible(&entinfo)) {
+		if (SenseIsInvisible(sense)) {
 			continue;
 		}
 		//if not an easy fragger don't shoot at chatting players
-		if (easyfragger < 0.5 && EntityIsChatting(&entinfo)) continue;
+		if (easyfragger < 0.5 && (sense->flags & EF_TALK)) continue;
 		//
 		if (lastteleport_time > FloatTime() - 3) {
-			VectorSubtract(entinfo.origin, lastteleport_origin, dir);
+			VectorSubtract(sense->origin, lastteleport_origin, dir);
 			if (VectorLengthSquared(dir) < Square(70)) continue;
 		}
 		//calculate the distance towards the enemy
-		VectorSubtract(entinfo.origin, bs->origin, dir);
+		VectorSubtract(sense->origin, bs->origin, dir);
 		squaredist = VectorLengthSquared(dir);
 		//if this entity is not carrying a flag or cubes
-		if (!EntityCarriesFlag(&entinfo)
+		if (!PowerupsCarryFlag(sense->powerups)
 #ifdef MISSIONPACK
-			&& !EntityCarriesCubes(&entinfo)
+			&& !SenseCarriesCubes(sense)
 #endif
 			)
 		{
 			//if this enemy is further away than the current one
 			if (curenemy >= 0 && squaredist > cursquaredist) continue;
 		} //end if
-		//if the bot has no
-		if (squaredist > Square(900.0 + alertness * 4000.0)) continue;
 		//if the bot's health decreased or the enemy is shooting
-		if (curenemy < 0 && (healthdecrease || EntityIsShooting(&entinfo)))
+		if (curenemy < 0 && (healthdecrease || (sense->flags & EF_FIRING)))
 			f = 360;
 		else
 			f = 160;
@@ -3158,14 +3373,13 @@ int BotFindEnemy(bot_state_t *bs, int curenemy) {
 		vis = BotEntityVisible(bs->entitynum, bs->eye, bs->viewangles, f, i);
 		if (vis <= 0) continue;
 		// if the enemy is quite far away and doesn't have a flag or cubes and the bot is not damaged try to ignore this enemy
-		if (curenemy < 0 && squaredist > Square(100) && !healthdecrease && !EntityCarriesFlag(&entinfo)
+		if (curenemy < 0 && squaredist > Square(100) && !healthdecrease && !PowerupsCarryFlag(sense->powerups)
 #ifdef MISSIONPACK
-			&& !EntityCarriesCubes(&entinfo)
+			&& !SenseCarriesCubes(sense)
 #endif
 			) {
-			BotEntityInfo(bs->playernum, &curbotinfo);
 			// if the bot is invisible and want to get the flag, ignore enemies
-			if (EntityIsInvisible(&curbotinfo) && bs->ltgtype == LTG_GETFLAG) {
+			if (SenseIsInvisible(BotSense(bs->playernum)) && bs->ltgtype == LTG_GETFLAG) {
 				continue;
 			}
 			// if trying to activate an entity, ignore enemies
@@ -3173,10 +3387,10 @@ int BotFindEnemy(bot_state_t *bs, int curenemy) {
 				continue;
 			}
 			//check if we can avoid this enemy
-			VectorSubtract(bs->origin, entinfo.origin, dir);
+			VectorSubtract(bs->origin, sense->origin, dir);
 			vectoangles(dir, angles);
 			//if the bot isn't in the fov of the enemy
-			if (!InFieldOfVision(entinfo.angles, 90, angles)) {
+			if (!InFieldOfVision(sense->angles, 90, angles)) {
 				//update some stuff for this enemy
 				BotUpdateBattleInventory(bs, i);
 				//if the bot doesn't really want to fight
@@ -3184,7 +3398,7 @@ int BotFindEnemy(bot_state_t *bs, int curenemy) {
 			}
 		}
 		//found an enemy
-		bs->enemy = entinfo.number;
+		bs->enemy = i;
 		if (curenemy >= 0) bs->enemysight_time = FloatTime() - 2;
 		else bs->enemysight_time = FloatTime();
 		bs->enemysuicide = qfalse;
@@ -3203,18 +3417,15 @@ BotTeamFlagCarrierVisible
 int BotTeamFlagCarrierVisible(bot_state_t *bs) {
 	int i;
 	float vis;
-	aas_entityinfo_t entinfo;
 
 	for (i = 0; i < level.maxplayers; i++) {
 		if (i == bs->playernum)
 			continue;
-		//
-		BotEntityInfo(i, &entinfo);
 		//if this player is active
-		if (!entinfo.valid)
+		if (!BotSense(i)->valid)
 			continue;
 		//if this player is carrying a flag
-		if (!EntityCarriesFlag(&entinfo))
+		if (!PlayerCarriesFlag(i))
 			continue;
 		//if the flag carrier is not on the same team
 		if (!BotSameTeam(bs, i))
@@ -3236,18 +3447,15 @@ BotTeamFlagCarrier
 */
 int BotTeamFlagCarrier(bot_state_t *bs) {
 	int i;
-	aas_entityinfo_t entinfo;
 
 	for (i = 0; i < level.maxplayers; i++) {
 		if (i == bs->playernum)
 			continue;
-		//
-		BotEntityInfo(i, &entinfo);
 		//if this player is active
-		if (!entinfo.valid)
+		if (!BotSense(i)->valid)
 			continue;
 		//if this player is carrying a flag
-		if (!EntityCarriesFlag(&entinfo))
+		if (!PlayerCarriesFlag(i))
 			continue;
 		//if the flag carrier is not on the same team
 		if (!BotSameTeam(bs, i))
@@ -3266,18 +3474,15 @@ BotEnemyFlagCarrierVisible
 int BotEnemyFlagCarrierVisible(bot_state_t *bs) {
 	int i;
 	float vis;
-	aas_entityinfo_t entinfo;
 
 	for (i = 0; i < level.maxplayers; i++) {
 		if (i == bs->playernum)
 			continue;
-		//
-		BotEntityInfo(i, &entinfo);
 		//if this player is active
-		if (!entinfo.valid)
+		if (!BotSense(i)->valid)
 			continue;
 		//if this player is carrying a flag
-		if (!EntityCarriesFlag(&entinfo))
+		if (!PlayerCarriesFlag(i))
 			continue;
 		//if the flag carrier is on the same team
 		if (BotSameTeam(bs, i))
@@ -3300,7 +3505,6 @@ BotVisibleTeamMatesAndEnemies
 void BotVisibleTeamMatesAndEnemies(bot_state_t *bs, int *teammates, int *enemies, float range) {
 	int i;
 	float vis;
-	aas_entityinfo_t entinfo;
 	vec3_t dir;
 
 	if (teammates)
@@ -3310,16 +3514,14 @@ void BotVisibleTeamMatesAndEnemies(bot_state_t *bs, int *teammates, int *enemies
 	for (i = 0; i < level.maxplayers; i++) {
 		if (i == bs->playernum)
 			continue;
-		//
-		BotEntityInfo(i, &entinfo);
 		//if this player is active
-		if (!entinfo.valid)
+		if (!BotSense(i)->valid)
 			continue;
 		//if this player is carrying a flag
-		if (!EntityCarriesFlag(&entinfo))
+		if (!PlayerCarriesFlag(i))
 			continue;
 		//if not within range
-		VectorSubtract(entinfo.origin, bs->origin, dir);
+		VectorSubtract(BotSense(i)->origin, bs->origin, dir);
 		if (VectorLengthSquared(dir) > Square(range))
 			continue;
 		//if the flag carrier is not visible
@@ -3347,7 +3549,7 @@ Counts all teammates inside a specific range, regardless if they are visible or
 */
 int BotCountTeamMates(bot_state_t *bs, float range) {
 	int i;
-	aas_entityinfo_t entinfo;
+	bot_sense_t *sense;
 	vec3_t dir;
 	int teammates;
 
@@ -3358,13 +3560,13 @@ int BotCountTeamMates(bot_state_t *bs, float range) {
 			continue;
 		}
 
-		BotEntityInfo(i, &entinfo);
+		sense = BotSense(i);
 		// if this player is active
-		if (!entinfo.valid) {
+		if (!sense->valid) {
 			continue;
 		}
 		// if not within range
-		VectorSubtract(entinfo.origin, bs->origin, dir);
+		VectorSubtract(sense->origin, bs->origin, dir);
 
 		if (VectorLengthSquared(dir) > Square(range)) {
 			continue;
@@ -3386,16 +3588,14 @@ BotTeamCubeCarrierVisible
 int BotTeamCubeCarrierVisible(bot_state_t *bs) {
 	int i;
 	float vis;
-	aas_entityinfo_t entinfo;
 
 	for (i = 0; i < level.maxplayers; i++) {
 		if (i == bs->playernum) continue;
-		//
-		BotEntityInfo(i, &entinfo);
 		//if this player is active
-		if (!entinfo.valid) continue;
-		//if this player is carrying a flag
-		if (!EntityCarriesCubes(&entinfo)) continue;
+		if (!BotSense(i)->valid) continue;
+		//
+		//if this player is carrying cubes
+		if (!SenseCarriesCubes(BotSense(i))) continue;
 		//if the flag carrier is not on the same team
 		if (!BotSameTeam(bs, i)) continue;
 		//if the flag carrier is not visible
@@ -3415,18 +3615,16 @@ BotEnemyCubeCarrierVisible
 int BotEnemyCubeCarrierVisible(bot_state_t *bs) {
 	int i;
 	float vis;
-	aas_entityinfo_t entinfo;
 
 	for (i = 0; i < level.maxplayers; i++) {
 		if (i == bs->playernum)
 			continue;
-		//
-		BotEntityInfo(i, &entinfo);
 		//if this player is active
-		if (!entinfo.valid)
+		if (!BotSense(i)->valid)
 			continue;
-		//if this player is carrying a flag
-		if (!EntityCarriesCubes(&entinfo)) continue;
+		//
+		//if this player is carrying cubes
+		if (!SenseCarriesCubes(BotSense(i))) continue;
 		//if the flag carrier is on the same team
 		if (BotSameTeam(bs, i))
 			continue;
@@ -4295,8 +4493,12 @@ void BotEnableActivateGoalAreas(bot_activategoal_t *activategoal, int enable) {
 
 	if (activategoal->areasdisabled == !enable)
 		return;
-	for (i = 0; i < activategoal->numareas; i++)
-		trap_AAS_EnableRoutingArea( activategoal->areas[i], enable );
+	for (i = 0; i < activategoal->numareas; i++) {
+		//if the routing status of the area changed
+		if (trap_AAS_EnableRoutingArea( activategoal->areas[i], enable ) != enable) {
+			BotRoutingAreaChanged( activategoal->areas[i], enable );
+		}
+	}
 	activategoal->areasdisabled = !enable;
 }
 
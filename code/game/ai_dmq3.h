@@ -50,6 +50,8 @@ void BotFreeWaypoints(bot_waypoint_t *wp);
 void BotChooseWeapon(bot_state_t *bs);
 //setup movement stuff
 void BotSetupForMovement(bot_state_t *bs);
+//fill the inventory from the player state
+void BotPlayerStateInventory(bot_state_t *bs, playerState_t *ps, int *inventory);
 //update the inventory
 void BotUpdateInventory(bot_state_t *bs);
 //update the inventory during battle
@@ -66,8 +68,18 @@ qboolean BotIntermission(bot_state_t *bs);
 qboolean BotInLavaOrSlime(bot_state_t *bs);
 //returns true if the entity is dead
 qboolean EntityIsDead(aas_entityinfo_t *entinfo);
+//returns true if the player is dead
+qboolean PlayerIsDead(int playernum);
+//returns true if the player carries a flag
+qboolean PlayerCarriesFlag(int playernum);
+//returns true if the powerups include a flag
+qboolean PowerupsCarryFlag(int powerups);
 //returns true if the entity is invisible
 qboolean EntityIsInvisible(aas_entityinfo_t *entinfo);
+//returns true if the entity of the record is invisible
+qboolean SenseIsInvisible(bot_sense_t *sense);
+//returns true if the entity of the record carries cubes
+qboolean SenseCarriesCubes(bot_sense_t *sense);
 //returns true if the entity is shooting
 qboolean EntityIsShooting(aas_entityinfo_t *entinfo);
 #ifdef MISSIONPACK
@@ -132,6 +144,11 @@ int BotFindEnemy(bot_state_t *bs, int curenemy);
 void BotRoamGoal(bot_state_t *bs, vec3_t goal);
 //returns entity visibility in the range [0, 1]
 float BotEntityVisible(int viewer, vec3_t eye, vec3_t viewangles, float fov, int ent);
+//begin and end the frame during which line of sight checks are cached
+void BotBeginVisibilityFrame(void);
+void BotEndVisibilityFrame(void);
+//print or reset the line of sight statistics
+void BotVisibilityStats(qboolean reset);
 //the bot will aim at the current enemy
 void BotAimAtEnemy(bot_state_t *bs);
 //check if the bot should attack
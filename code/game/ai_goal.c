@@ -39,6 +39,7 @@ Suite 120, Rockville, Maryland 20850 USA.
 
 #include "g_local.h"
 #include "../botlib/botlib.h"
+#include "../botlib/aasfile.h"
 #include "../botlib/be_aas.h"
 //
 #include "ai_char.h"
@@ -76,6 +77,12 @@ Suite 120, Rockville, Maryland 20850 USA.
 #define AVOID_DROPPED_TIME		10
 //
 #define TRAVELTIME_SCALE		0.01
+//fastest travel time per unit distance through an area (botlib DISTANCEFACTOR_WALK)
+#define TRAVELTIME_MINFACTOR	0.33
+//number of ways the minimum travel time through an area is split when bounding the travel time
+#define TRAVELTIME_SPLITS		16
+//reachabilities end this close to the bounding box of the area they lead to
+#define TRAVELTIME_AREAEPSILON	8
 //item flags
 #define IFL_NOTFREE				1		//not in free for all
 #define IFL_NOTTEAM				2		//not in team play
@@ -104,6 +111,8 @@ typedef struct levelitem_s
 	float weight;						//fixed roam weight
 	vec3_t origin;						//origin of the item
 	int goalareanum;					//area the item is in
+	int goalcluster;					//cluster the goal area is in
+	vec3_t goalmins, goalmaxs;			//bounding box of the goal area
 	vec3_t goalorigin;					//goal origin within the area
 	int entitynum;						//entity number
 	float timeout;						//item is removed after this time
@@ -159,6 +168,12 @@ levelitem_t *levelitemheap = NULL;
 levelitem_t *freelevelitems = NULL;
 levelitem_t *levelitems = NULL;
 int numlevelitems = 0;
+//level items sorted on the cluster of their goal area
+levelitem_t *clustereditems[MAX_ITEMS];
+int numclustereditems = 0;
+int clustereditemsvalid = qfalse;
+//lower bound for the travel time per unit distance, -1 if not yet calculated
+float leveltraveltimefactor = -1;
 //camp spots
 campspot_t *campspots = NULL;
 
@@ -203,6 +218,7 @@ void BotInterbreedGoalFuzzyLogic(int parent1, int parent2, int child)
 
 	InterbreedWeightConfigs(p1->itemweightconfig, p2->itemweightconfig,
 									c->itemweightconfig);
+	c->itemweightsvalid = qfalse;
 } //end of the function BotInterbreedingGoalFuzzyLogic
 //===========================================================================
 //
@@ -231,6 +247,7 @@ void BotMutateGoalFuzzyLogic(int goalstate, float range)
 	gs = BotGoalStateFromHandle(goalstate);
 	if (!gs) return;
 	EvolveWeightConfig(gs->itemweightconfig);
+	gs->itemweightsvalid = qfalse;
 } //end of the function BotMutateGoalFuzzyLogic
 //===========================================================================
 //
@@ -386,6 +403,7 @@ void AddLevelItemToList(levelitem_t *li)
 	li->prev = NULL;
 	li->next = levelitems;
 	levelitems = li;
+	clustereditemsvalid = qfalse;
 } //end of the function AddLevelItemToList
 //===========================================================================
 //
@@ -397,9 +415,257 @@ void RemoveLevelItemFromList(levelitem_t *li)
 {
 	if (li->prev) li->prev->next = li->next;
 	else levelitems = li->next;
+	clustereditemsvalid = qfalse;
 	if (li->next) li->next->prev = li->prev;
 } //end of the function RemoveLevelItemFromList
 //===========================================================================
+// stores the cluster and bounding box of the goal area of the level item
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void BotLevelItemGoalAreaInfo(levelitem_t *li)
+{
+	aas_areainfo_t info;
+
+	if (li->goalareanum)
+	{
+		trap_AAS_AreaInfo(li->goalareanum, &info);
+		li->goalcluster = info.cluster;
+		VectorCopy(info.mins, li->goalmins);
+		VectorCopy(info.maxs, li->goalmaxs);
+	} //end if
+	else
+	{
+		li->goalcluster = 0;
+		VectorCopy(li->goalorigin, li->goalmins);
+		VectorCopy(li->goalorigin, li->goalmaxs);
+	} //end else
+	clustereditemsvalid = qfalse;
+} //end of the function BotLevelItemGoalAreaInfo
+//===========================================================================
+// sorts the level items on the cluster of their goal area, items within
+// the same cluster stay in level item list order
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void BotClusterLevelItems(void)
+{
+	int i, j;
+	levelitem_t *li;
+
+	numclustereditems = 0;
+	for (li = levelitems; li && numclustereditems < MAX_ITEMS; li = li->next)
+	{
+		//insertion sort, there are never many level items
+		for (i = numclustereditems; i > 0; i--)
+		{
+			if (clustereditems[i-1]->goalcluster <= li->goalcluster) break;
+		} //end for
+		for (j = numclustereditems; j > i; j--)
+		{
+			clustereditems[j] = clustereditems[j-1];
+		} //end for
+		clustereditems[i] = li;
+		numclustereditems++;
+	} //end for
+	clustereditemsvalid = qtrue;
+} //end of the function BotClusterLevelItems
+//===========================================================================
+// returns the index of the first clustered level item in the given cluster
+// or the first item in a higher cluster if there are no items in the cluster
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int BotFirstClusterLevelItem(int cluster)
+{
+	int low, high, mid;
+
+	if (!clustereditemsvalid)
+		BotClusterLevelItems();
+	low = 0;
+	high = numclustereditems;
+	while (low < high)
+	{
+		mid = (low + high) >> 1;
+		if (clustereditems[mid]->goalcluster < cluster) low = mid + 1;
+		else high = mid;
+	} //end while
+	if (low >= numclustereditems) return 0;
+	return low;
+} //end of the function BotFirstClusterLevelItem
+//===========================================================================
+// returns a lower bound for the travel time per unit of straight line
+// distance, no route through the AAS can be faster than this
+//
+// a route is the walk from the origin to the start of the first
+// reachability followed by pairs of a reachability and the walk through the
+// area it leads to up to the start of the next reachability, the last pair
+// ends in the goal area with a start travel time of 1
+//
+// a walk of length d through an area takes max(1, (int) (d * f)) with
+// f >= TRAVELTIME_MINFACTOR, for every split s in [0, 1] that is at least
+// s + (1 - s) * d * TRAVELTIME_MINFACTOR / 2, so a pair with a reachability
+// of travel time t and length r takes at least
+// (t + s) + (1 - s) * d * TRAVELTIME_MINFACTOR / 2
+// which bounds the travel time per unit distance of every pair by
+// min((1 - s) * TRAVELTIME_MINFACTOR / 2, (t + s) / r)
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+float BotTravelTimeFactor(void)
+{
+	int num, i;
+	float split, factor, dist, reachfactor[TRAVELTIME_SPLITS];
+	aas_reachability_t reach;
+
+	if (leveltraveltimefactor >= 0)
+		return leveltraveltimefactor;
+	if (!trap_AAS_Initialized())
+		return 0;
+	for (i = 0; i < TRAVELTIME_SPLITS; i++)
+	{
+		split = (float) i / TRAVELTIME_SPLITS;
+		reachfactor[i] = (1 - split) * TRAVELTIME_MINFACTOR * 0.5;
+	} //end for
+	for (num = 1; ; num++)
+	{
+		trap_AAS_ReachabilityFromNum(num, &reach);
+		if (!reach.areanum) break;
+		dist = Distance(reach.start, reach.end);
+		if (dist <= 0)
+			continue;
+		for (i = 0; i < TRAVELTIME_SPLITS; i++)
+		{
+			split = (float) i / TRAVELTIME_SPLITS;
+			factor = (reach.traveltime + split) / dist;
+			if (factor < reachfactor[i])
+				reachfactor[i] = factor;
+		} //end for
+	} //end for
+	//use the split that gives the highest bound
+	factor = 0;
+	for (i = 0; i < TRAVELTIME_SPLITS; i++)
+	{
+		if (reachfactor[i] > factor)
+			factor = reachfactor[i];
+	} //end for
+	//leave a little room for floating point rounding
+	leveltraveltimefactor = factor * 0.99;
+	return leveltraveltimefactor;
+} //end of the function BotTravelTimeFactor
+//===========================================================================
+// returns a lower bound for the travel time from the origin to the level item
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int BotLevelItemMinTravelTime(levelitem_t *li, vec3_t origin, float factor)
+{
+	int i, t;
+	vec3_t v;
+
+	for (i = 0; i < 3; i++)
+	{
+		if (origin[i] < li->goalmins[i] - TRAVELTIME_AREAEPSILON)
+			v[i] = li->goalmins[i] - TRAVELTIME_AREAEPSILON - origin[i];
+		else if (origin[i] > li->goalmaxs[i] + TRAVELTIME_AREAEPSILON)
+			v[i] = origin[i] - li->goalmaxs[i] - TRAVELTIME_AREAEPSILON;
+		else v[i] = 0;
+	} //end for
+	t = (int) (VectorLength(v) * factor);
+	if (t < 1) t = 1;
+	return t;
+} //end of the function BotLevelItemMinTravelTime
+//===========================================================================
+// calculates the fuzzy weights of all item infos for the inventory, the
+// weights only depend on the inventory so they are cached in the goal state
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void BotUpdateItemWeights(bot_goalstate_t *gs, int *inventory)
+{
+	int i, weightnum;
+	float weights[MAX_WEIGHTS];
+
+	if (gs->itemweightsvalid)
+	{
+		for (i = 0; i < MAX_ITEMS; i++)
+		{
+			if (gs->itemweightinventory[i] != inventory[i]) break;
+		} //end for
+		if (i >= MAX_ITEMS) return;
+	} //end if
+	FuzzyWeights(inventory, gs->itemweightconfig, weights);
+	for (i = 0; i < itemconfig->numiteminfo; i++)
+	{
+		weightnum = gs->itemweightindex[itemconfig->iteminfo[i].number];
+		if (weightnum < 0) gs->itemweights[i] = 0;
+		else gs->itemweights[i] = weights[weightnum];
+	} //end for
+	Com_Memcpy(gs->itemweightinventory, inventory, sizeof(gs->itemweightinventory));
+	gs->itemweightsvalid = qtrue;
+} //end of the function BotUpdateItemWeights
+//===========================================================================
+// only touches the goal state so it can be called for several bots at
+// the same time
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void BotPrepareItemWeights(int goalstate, int *inventory)
+{
+#ifndef UNDECIDEDFUZZY
+	bot_goalstate_t *gs;
+
+	gs = BotGoalStateFromHandle(goalstate);
+	if (!gs || !gs->itemweightconfig || !itemconfig) return;
+	BotUpdateItemWeights(gs, inventory);
+#endif //UNDECIDEDFUZZY
+} //end of the function BotPrepareItemWeights
+//===========================================================================
+// returns the fuzzy weight for the level item, BotUpdateItemWeights
+// should be called for the inventory first
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+float BotLevelItemWeight(bot_goalstate_t *gs, int *inventory, levelitem_t *li)
+{
+#ifdef UNDECIDEDFUZZY
+	int weightnum;
+#endif //UNDECIDEDFUZZY
+	float weight;
+
+#ifdef UNDECIDEDFUZZY
+	weightnum = gs->itemweightindex[itemconfig->iteminfo[li->iteminfo].number];
+	weight = FuzzyWeightUndecided(inventory, gs->itemweightconfig, weightnum);
+#else
+	//the item weights are updated for the inventory before the items are weighed
+	weight = gs->itemweights[li->iteminfo];
+#endif //UNDECIDEDFUZZY
+#ifdef DROPPEDWEIGHT
+	//HACK: to make dropped items more attractive
+	if (li->timeout)
+		weight += bot_droppedweight.value;
+#endif //DROPPEDWEIGHT
+	//use weight scale for item_botroam
+	if (li->flags & IFL_ROAM) weight *= li->weight;
+	return weight;
+} //end of the function BotLevelItemWeight
+//===========================================================================
 //
 // Parameter:			-
 // Returns:				-
@@ -505,6 +771,9 @@ void BotInitLevelItems(void)
 	InitLevelItemHeap();
 	levelitems = NULL;
 	numlevelitems = 0;
+	numclustereditems = 0;
+	clustereditemsvalid = qfalse;
+	leveltraveltimefactor = -1;
 	//
 	ic = itemconfig;
 	if (!ic) return;
@@ -628,6 +897,7 @@ void BotInitLevelItems(void)
 												classname, origin[0], origin[1], origin[2]);
 			} //end if
 		} //end else
+		BotLevelItemGoalAreaInfo(li);
 		//
 		AddLevelItemToList(li);
 	} //end for
@@ -1049,6 +1319,7 @@ void BotUpdateEntityItems(void)
 						li->goalareanum = trap_AAS_BestReachableArea(li->origin,
 										ic->iteminfo[li->iteminfo].mins, ic->iteminfo[li->iteminfo].maxs,
 										li->goalorigin);
+						BotLevelItemGoalAreaInfo(li);
 					} //end if
 					break;
 				} //end else
@@ -1090,6 +1361,7 @@ void BotUpdateEntityItems(void)
 						li->goalareanum = trap_AAS_BestReachableArea(li->origin,
 										ic->iteminfo[li->iteminfo].mins, ic->iteminfo[li->iteminfo].maxs,
 										li->goalorigin);
+						BotLevelItemGoalAreaInfo(li);
 					} //end if
 					//BotAI_Print(PRT_DEVELOPER, "linked item %s to an entity\n", ic->iteminfo[li->iteminfo].classname);
 					break;
@@ -1123,6 +1395,7 @@ void BotUpdateEntityItems(void)
 		li->goalareanum = trap_AAS_BestReachableArea(li->origin,
 									ic->iteminfo[i].mins, ic->iteminfo[i].maxs,
 									li->goalorigin);
+		BotLevelItemGoalAreaInfo(li);
 		//never go for items dropped into jumppads
 		if (trap_AAS_AreaJumpPad(li->goalareanum))
 		{
@@ -1255,13 +1528,14 @@ int BotGetSecondGoal(int goalstate, bot_goal_t *goal)
 //===========================================================================
 int BotChooseLTGItem(int goalstate, vec3_t origin, int *inventory, int travelflags)
 {
-	int areanum, t, weightnum;
-	float weight, bestweight, avoidtime;
+	int areanum, t, weightnum, i, first;
+	float weight, bestweight, avoidtime, factor;
 	iteminfo_t *iteminfo;
 	itemconfig_t *ic;
 	levelitem_t *li, *bestitem;
 	bot_goal_t goal;
 	bot_goalstate_t *gs;
+	aas_areainfo_t areainfo;
 
 	gs = BotGoalStateFromHandle(goalstate);
 	if (!gs)
@@ -1285,13 +1559,24 @@ int BotChooseLTGItem(int goalstate, vec3_t origin, int *inventory, int travelfla
 	ic = itemconfig;
 	if (!itemconfig)
 		return qfalse;
+#ifndef UNDECIDEDFUZZY
+	//update the item weights once for all the items
+	BotUpdateItemWeights(gs, inventory);
+#endif //UNDECIDEDFUZZY
 	//best weight and item so far
 	bestweight = 0;
 	bestitem = NULL;
 	Com_Memset(&goal, 0, sizeof(bot_goal_t));
+	//start with the items in the cluster the bot is in, these are most likely
+	//the closest and set a high best weight early so more items can be skipped
+	trap_AAS_AreaInfo(areanum, &areainfo);
+	first = BotFirstClusterLevelItem(areainfo.cluster);
+	factor = BotTravelTimeFactor();
 	//go through the items in the level
-	for (li = levelitems; li; li = li->next)
+	for (i = 0; i < numclustereditems; i++)
 	{
+		li = clustereditems[(first + i) % numclustereditems];
+		//
 		if (g_gametype.integer == GT_SINGLE_PLAYER) {
 			if (li->flags & IFL_NOTSINGLE)
 				continue;
@@ -1317,22 +1602,16 @@ int BotChooseLTGItem(int goalstate, vec3_t origin, int *inventory, int travelfla
 		weightnum = gs->itemweightindex[iteminfo->number];
 		if (weightnum < 0)
 			continue;
-
-#ifdef UNDECIDEDFUZZY
-		weight = FuzzyWeightUndecided(inventory, gs->itemweightconfig, weightnum);
-#else
-		weight = FuzzyWeight(inventory, gs->itemweightconfig, weightnum);
-#endif //UNDECIDEDFUZZY
-#ifdef DROPPEDWEIGHT
-		//HACK: to make dropped items more attractive
-		if (li->timeout)
-			weight += bot_droppedweight.value;
-#endif //DROPPEDWEIGHT
-		//use weight scale for item_botroam
-		if (li->flags & IFL_ROAM) weight *= li->weight;
+		//
+		weight = BotLevelItemWeight(gs, inventory, li);
 		//
 		if (weight > 0)
 		{
+			//skip the item without a routing query if it can't beat the best item
+			//even when the travel time would be as short as possible
+			t = BotLevelItemMinTravelTime(li, origin, factor);
+			if (weight / ((float) t * TRAVELTIME_SCALE) <= bestweight)
+				continue;
 			//get the travel time towards the goal area
 			t = trap_AAS_AreaTravelTimeToGoalArea(areanum, origin, li->goalareanum, travelflags);
 			//if the goal is reachable
@@ -1421,13 +1700,14 @@ int BotChooseLTGItem(int goalstate, vec3_t origin, int *inventory, int travelfla
 int BotChooseNBGItem(int goalstate, vec3_t origin, int *inventory, int travelflags,
 														bot_goal_t *ltg, float maxtime)
 {
-	int areanum, t, weightnum, ltg_time;
-	float weight, bestweight, avoidtime;
+	int areanum, t, weightnum, ltg_time, i, first;
+	float weight, bestweight, avoidtime, factor;
 	iteminfo_t *iteminfo;
 	itemconfig_t *ic;
 	levelitem_t *li, *bestitem;
 	bot_goal_t goal;
 	bot_goalstate_t *gs;
+	aas_areainfo_t areainfo;
 
 	gs = BotGoalStateFromHandle(goalstate);
 	if (!gs)
@@ -1454,13 +1734,24 @@ int BotChooseNBGItem(int goalstate, vec3_t origin, int *inventory, int travelfla
 	ic = itemconfig;
 	if (!itemconfig)
 		return qfalse;
+#ifndef UNDECIDEDFUZZY
+	//update the item weights once for all the items
+	BotUpdateItemWeights(gs, inventory);
+#endif //UNDECIDEDFUZZY
 	//best weight and item so far
 	bestweight = 0;
 	bestitem = NULL;
 	Com_Memset(&goal, 0, sizeof(bot_goal_t));
+	//start with the items in the cluster the bot is in, these are most likely
+	//the closest and set a high best weight early so more items can be skipped
+	trap_AAS_AreaInfo(areanum, &areainfo);
+	first = BotFirstClusterLevelItem(areainfo.cluster);
+	factor = BotTravelTimeFactor();
 	//go through the items in the level
-	for (li = levelitems; li; li = li->next)
+	for (i = 0; i < numclustereditems; i++)
 	{
+		li = clustereditems[(first + i) % numclustereditems];
+		//
 		if (g_gametype.integer == GT_SINGLE_PLAYER) {
 			if (li->flags & IFL_NOTSINGLE)
 				continue;
@@ -1487,21 +1778,17 @@ int BotChooseNBGItem(int goalstate, vec3_t origin, int *inventory, int travelfla
 		if (weightnum < 0)
 			continue;
 		//
-#ifdef UNDECIDEDFUZZY
-		weight = FuzzyWeightUndecided(inventory, gs->itemweightconfig, weightnum);
-#else
-		weight = FuzzyWeight(inventory, gs->itemweightconfig, weightnum);
-#endif //UNDECIDEDFUZZY
-#ifdef DROPPEDWEIGHT
-		//HACK: to make dropped items more attractive
-		if (li->timeout)
-			weight += bot_droppedweight.value;
-#endif //DROPPEDWEIGHT
-		//use weight scale for item_botroam
-		if (li->flags & IFL_ROAM) weight *= li->weight;
+		weight = BotLevelItemWeight(gs, inventory, li);
 		//
 		if (weight > 0)
 		{
+			//skip the item without a routing query if it can't beat the best item
+			//even when the travel time would be as short as possible
+			t = BotLevelItemMinTravelTime(li, origin, factor);
+			if (t >= maxtime)
+				continue;
+			if (weight / ((float) t * TRAVELTIME_SCALE) <= bestweight)
+				continue;
 			//get the travel time towards the goal area
 			t = trap_AAS_AreaTravelTimeToGoalArea(areanum, origin, li->goalareanum, travelflags);
 			//if the goal is reachable
@@ -1678,6 +1965,7 @@ int BotLoadItemWeights(int goalstate, char *filename)
 	}
 	//create the item weight index
 	ItemWeightIndex(itemconfig, gs->itemweightconfig, gs->itemweightindex);
+	gs->itemweightsvalid = qfalse;
 	//everything went ok
 	return BLERR_NOERROR;
 } //end of the function BotLoadItemWeights
@@ -1754,4 +2042,6 @@ void BotShutdownGoalAI(void)
 	freelevelitems = NULL;
 	levelitems = NULL;
 	numlevelitems = 0;
+	numclustereditems = 0;
+	clustereditemsvalid = qfalse;
 } //end of the function BotShutdownGoalAI
@@ -72,6 +72,10 @@ typedef struct bot_goalstate_s
 	//
 	int avoidgoals[MAX_AVOIDGOALS];				//goals to avoid
 	float avoidgoaltimes[MAX_AVOIDGOALS];		//times to avoid the goals
+	//
+	int itemweightsvalid;						//true if the cached item weights are valid
+	int itemweightinventory[MAX_ITEMS];			//inventory the cached item weights are calculated for
+	float itemweights[MAX_ITEMS];				//cached weight for every item info
 } bot_goalstate_t;
 
 //reset the whole goal state, but keep the item weights
@@ -96,6 +100,8 @@ void BotGoalName(int number, char *name, int size);
 int BotGetTopGoal(int goalstate, bot_goal_t *goal);
 //get the second goal on the stack
 int BotGetSecondGoal(int goalstate, bot_goal_t *goal);
+//calculate the cached item weights of the goal state for the inventory
+void BotPrepareItemWeights(int goalstate, int *inventory);
 //choose the best long term goal item for the bot
 int BotChooseLTGItem(int goalstate, vec3_t origin, int *inventory, int travelflags);
 //choose the best nearby goal item for the bot
@@ -65,6 +65,21 @@ Suite 120, Rockville, Maryland 20850 USA.
 #include "syn.h"				//synonyms
 #include "match.h"				//string matching types and vars
 
+//run the read only part of the bot thinks on worker threads when the game
+//is running as a shared library
+#ifndef Q3_VM
+#define BOT_THINK_THREADS
+#endif
+
+#ifdef BOT_THINK_THREADS
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+#endif //BOT_THINK_THREADS
+
+#define MAX_BOTTHINK_THREADS	16
 
 //bot states
 bot_state_t	*botstates[MAX_CLIENTS];
@@ -74,13 +89,34 @@ int numbots;
 float floattime;
 //time to do a regular update
 float regularupdate_time;
+//entities updated in the botlib this frame
+int numbotentities;
+int botentitynums[MAX_GENTITIES];
+bot_entitystate_t botentitystates[MAX_GENTITIES];
+//compact entity records of the last botlib frame
+bot_sense_t botsenses[MAX_GENTITIES];
+int numbotsenses;
 //
 int bot_interbreed;
 int bot_interbreedmatchcount;
+//msec between the last two bot AI frames
+int botframe_msec;
+//bot to start the AI thinks with, set when thinks are deferred
+int botthink_first;
+//number of frames the bot think budget was used up
+int botthink_overbudget;
+//number of bot thinks prepared on the bot think threads
+int botthink_prethinks;
 //
 vmCvar_t bot_thinktime;
+vmCvar_t bot_thinkbudget;			//max msec per frame spent in the bot AI
+vmCvar_t bot_thinkthreads;			//number of threads preparing the bot thinks
 vmCvar_t bot_memorydump;
 vmCvar_t bot_saveroutingcache;
+vmCvar_t bot_bakeroutetables;
+vmCvar_t bot_writecompactaas;
+vmCvar_t bot_samplebenchmark;
+vmCvar_t bot_routingcacheinfo;
 vmCvar_t bot_pause;
 vmCvar_t bot_report;
 vmCvar_t bot_testsolid;
@@ -847,6 +883,459 @@ void Svcmd_BotTeamplayReport_f(void) {
 	}
 }
 
+#ifdef BOT_THINK_THREADS
+//worker threads that prepare the bot thinks
+typedef struct botthinkpool_s
+{
+	int numrequested;						//number of worker threads requested
+	int numthreads;							//number of worker threads running
+	int shutdown;							//true when the workers should exit
+	int numbots;							//number of bots to prepare the think for
+	int bots[MAX_CLIENTS];					//bots to prepare the think for
+	int shares[MAX_BOTTHINK_THREADS];		//share of the bots every worker prepares
+#ifdef _WIN32
+	HANDLE threads[MAX_BOTTHINK_THREADS];
+	HANDLE startevents[MAX_BOTTHINK_THREADS];
+	HANDLE doneevents[MAX_BOTTHINK_THREADS];
+#else
+	pthread_t threads[MAX_BOTTHINK_THREADS];
+	pthread_mutex_t lock;
+	pthread_cond_t start;
+	pthread_cond_t done;
+	int generation;							//increased every time the workers are started
+	int busy;								//number of workers still busy
+#endif
+} botthinkpool_t;
+
+static botthinkpool_t botthinkpool;
+
+/*
+==================
+BotPrethink
+
+Prepares the think of the bot. Runs on the bot think threads and on the
+server thread at the same time so it may only read the game state and write
+to the bot state of this bot. The AAS queries used are read only except for
+the routing cache which is serialized in the botlib.
+
+The only engine calls made are the heap calls of the botlib memory, these
+are made with the botlib routing cache lock held. While the prethinks run
+the engine is blocked in the game frame and every prethink reaches the heap
+through that same lock, so the heap is never used by two threads at once.
+
+Enemy selection uses engine traces that aren't safe to run concurrently and
+the goal choice is made by the AI nodes together with the enemy decisions,
+so both stay in the serial BotAI.
+==================
+*/
+static void BotPrethink(bot_state_t *bs) {
+	playerState_t ps;
+	int inventory[MAX_ITEMS];
+	int areanum;
+	bot_goal_t goal;
+
+	if (!BotAI_GetPlayerState(bs->playernum, &ps)) {
+		return;
+	}
+	areanum = BotPointAreaNum(ps.origin);
+	//calculate the item weights for the inventory the bot will think with
+	memcpy(inventory, bs->inventory, sizeof(inventory));
+	BotPlayerStateInventory(bs, &ps, inventory);
+	BotPrepareItemWeights(bs->gs, inventory);
+	//update the routing cache towards the current goal
+	if (areanum && BotGetTopGoal(bs->gs, &goal)) {
+		trap_AAS_AreaTravelTimeToGoalArea(areanum, ps.origin, goal.areanum, bs->tfl);
+	}
+	//
+	VectorCopy(ps.origin, bs->prethinkorigin);
+	bs->prethinkareanum = areanum;
+	bs->prethinkvalid = qtrue;
+}
+
+/*
+==================
+BotPrethinkShare
+==================
+*/
+static void BotPrethinkShare(int share) {
+	int i;
+
+	for (i = share; i < botthinkpool.numbots; i += botthinkpool.numthreads + 1) {
+		BotPrethink(botstates[botthinkpool.bots[i]]);
+	}
+}
+
+/*
+==================
+BotThinkThread
+==================
+*/
+#ifdef _WIN32
+static DWORD WINAPI BotThinkThread(LPVOID arg) {
+	int share = *(int *) arg;
+
+	while (1) {
+		WaitForSingleObject(botthinkpool.startevents[share - 1], INFINITE);
+		if (botthinkpool.shutdown) {
+			break;
+		}
+		BotPrethinkShare(share);
+		SetEvent(botthinkpool.doneevents[share - 1]);
+	}
+	return 0;
+}
+#else
+static void *BotThinkThread(void *arg) {
+	int share = *(int *) arg;
+	int generation = 0;
+
+	pthread_mutex_lock(&botthinkpool.lock);
+	while (1) {
+		while (botthinkpool.generation == generation && !botthinkpool.shutdown) {
+			pthread_cond_wait(&botthinkpool.start, &botthinkpool.lock);
+		}
+		if (botthinkpool.shutdown) {
+			break;
+		}
+		generation = botthinkpool.generation;
+		pthread_mutex_unlock(&botthinkpool.lock);
+		BotPrethinkShare(share);
+		pthread_mutex_lock(&botthinkpool.lock);
+		if (--botthinkpool.busy <= 0) {
+			pthread_cond_signal(&botthinkpool.done);
+		}
+	}
+	pthread_mutex_unlock(&botthinkpool.lock);
+	return NULL;
+}
+#endif
+
+/*
+==================
+BotStopThinkThreads
+==================
+*/
+static void BotStopThinkThreads(void) {
+	int i;
+
+	if (!botthinkpool.numthreads) {
+		return;
+	}
+#ifdef _WIN32
+	botthinkpool.shutdown = qtrue;
+	for (i = 0; i < botthinkpool.numthreads; i++) {
+		SetEvent(botthinkpool.startevents[i]);
+	}
+	WaitForMultipleObjects(botthinkpool.numthreads, botthinkpool.threads, TRUE, INFINITE);
+	for (i = 0; i < botthinkpool.numthreads; i++) {
+		CloseHandle(botthinkpool.threads[i]);
+		CloseHandle(botthinkpool.startevents[i]);
+		CloseHandle(botthinkpool.doneevents[i]);
+	}
+#else
+	pthread_mutex_lock(&botthinkpool.lock);
+	botthinkpool.shutdown = qtrue;
+	pthread_cond_broadcast(&botthinkpool.start);
+	pthread_mutex_unlock(&botthinkpool.lock);
+	for (i = 0; i < botthinkpool.numthreads; i++) {
+		pthread_join(botthinkpool.threads[i], NULL);
+	}
+	pthread_cond_destroy(&botthinkpool.start);
+	pthread_cond_destroy(&botthinkpool.done);
+	pthread_mutex_destroy(&botthinkpool.lock);
+#endif
+	botthinkpool.numthreads = 0;
+	botthinkpool.shutdown = qfalse;
+}
+
+/*
+==================
+BotStartThinkThreads
+==================
+*/
+static void BotStartThinkThreads(int numthreads) {
+	int i;
+
+	BotStopThinkThreads();
+	if (numthreads > MAX_BOTTHINK_THREADS) {
+		numthreads = MAX_BOTTHINK_THREADS;
+	}
+	if (numthreads <= 0) {
+		return;
+	}
+#ifndef _WIN32
+	pthread_mutex_init(&botthinkpool.lock, NULL);
+	pthread_cond_init(&botthinkpool.start, NULL);
+	pthread_cond_init(&botthinkpool.done, NULL);
+	botthinkpool.generation = 0;
+	botthinkpool.busy = 0;
+#endif
+	//the server thread prepares share zero
+	for (i = 0; i < numthreads; i++) {
+		botthinkpool.shares[i] = i + 1;
+#ifdef _WIN32
+		botthinkpool.startevents[i] = CreateEvent(NULL, FALSE, FALSE, NULL);
+		botthinkpool.doneevents[i] = CreateEvent(NULL, FALSE, FALSE, NULL);
+		botthinkpool.threads[i] = CreateThread(NULL, 0, BotThinkThread, &botthinkpool.shares[i], 0, NULL);
+		if (!botthinkpool.threads[i]) {
+			CloseHandle(botthinkpool.startevents[i]);
+			CloseHandle(botthinkpool.doneevents[i]);
+			break;
+		}
+#else
+		if (pthread_create(&botthinkpool.threads[i], NULL, BotThinkThread, &botthinkpool.shares[i]) != 0) {
+			break;
+		}
+#endif
+		botthinkpool.numthreads++;
+	}
+	if (botthinkpool.numthreads < numthreads) {
+		BotAI_Print(PRT_WARNING, "only started %d of %d bot think threads\n", botthinkpool.numthreads, numthreads);
+	}
+#ifndef _WIN32
+	if (!botthinkpool.numthreads) {
+		pthread_cond_destroy(&botthinkpool.start);
+		pthread_cond_destroy(&botthinkpool.done);
+		pthread_mutex_destroy(&botthinkpool.lock);
+	}
+#endif
+}
+
+/*
+==================
+BotRunPrethinks
+
+prepares the thinks of the queued bots on the bot think threads, the server
+thread prepares share zero concurrently with the workers and then waits for
+all of them to finish, the results are merged in the serial BotAI
+==================
+*/
+static void BotRunPrethinks(void) {
+#ifdef _WIN32
+	int i;
+#endif
+
+	if (!botthinkpool.numthreads || !botthinkpool.numbots) {
+		return;
+	}
+#ifdef _WIN32
+	for (i = 0; i < botthinkpool.numthreads; i++) {
+		SetEvent(botthinkpool.startevents[i]);
+	}
+	BotPrethinkShare(0);
+	WaitForMultipleObjects(botthinkpool.numthreads, botthinkpool.doneevents, TRUE, INFINITE);
+#else
+	pthread_mutex_lock(&botthinkpool.lock);
+	botthinkpool.busy = botthinkpool.numthreads;
+	botthinkpool.generation++;
+	pthread_cond_broadcast(&botthinkpool.start);
+	pthread_mutex_unlock(&botthinkpool.lock);
+	BotPrethinkShare(0);
+	pthread_mutex_lock(&botthinkpool.lock);
+	while (botthinkpool.busy > 0) {
+		pthread_cond_wait(&botthinkpool.done, &botthinkpool.lock);
+	}
+	pthread_mutex_unlock(&botthinkpool.lock);
+#endif
+	botthink_prethinks += botthinkpool.numbots;
+}
+#endif //BOT_THINK_THREADS
+
+/*
+==================
+Svcmd_BotThinkReport_f
+==================
+*/
+void Svcmd_BotThinkReport_f(void) {
+	int i;
+	char netname[MAX_MESSAGE_SIZE];
+	char arg[MAX_TOKEN_CHARS];
+	bot_state_t *bs;
+
+	trap_Argv(1, arg, sizeof(arg));
+	if (!Q_stricmp(arg, "reset")) {
+		for (i = 0; i < MAX_CLIENTS; i++) {
+			bs = botstates[i];
+			if ( !bs || !bs->inuse ) continue;
+			bs->thinkcount = 0;
+			bs->thinkcost = 0;
+			bs->thinkcostmax = 0;
+			bs->thinkdeferred = 0;
+		}
+		botthink_overbudget = 0;
+		botthink_prethinks = 0;
+		BotVisibilityStats(qtrue);
+		BotAI_Print(PRT_MESSAGE, "bot think statistics reset\n");
+		return;
+	}
+
+	BotAI_Print(PRT_MESSAGE, "name                 thinks  avg msec  max msec  deferred\n");
+	for (i = 0; i < MAX_CLIENTS; i++) {
+		bs = botstates[i];
+		//
+		if ( !bs || !bs->inuse ) continue;
+		//
+		PlayerName(bs->playernum, netname, sizeof(netname));
+		BotAI_Print(PRT_MESSAGE, "%-20s %6d  %8.2f  %8d  %8d\n", netname, bs->thinkcount,
+			bs->thinkcount ? (float) bs->thinkcost / bs->thinkcount : 0.0f,
+			bs->thinkcostmax, bs->thinkdeferred);
+	}
+	BotAI_Print(PRT_MESSAGE, "bot think budget %d msec used up in %d frames\n",
+		bot_thinkbudget.integer, botthink_overbudget);
+#ifdef BOT_THINK_THREADS
+	BotAI_Print(PRT_MESSAGE, "%d bot thinks prepared on %d bot think threads\n",
+		botthink_prethinks, botthinkpool.numthreads);
+#endif
+	BotVisibilityStats(qfalse);
+}
+
+/*
+==================
+Svcmd_BotWeightBench_f
+
+compares the compiled fuzzy weights with the seperator trees
+==================
+*/
+void Svcmd_BotWeightBench_f(void) {
+	int i, j, n, pass, iterations, mismatches, starttime;
+	unsigned int seed;
+	int inventory[MAX_ITEMS], time[2];
+	float treeweights[MAX_WEIGHTS], nodeweights[MAX_WEIGHTS], sum[2];
+	char filename[MAX_QPATH], arg[MAX_TOKEN_CHARS];
+	weightconfig_t *wc;
+
+	if (trap_Argc() < 2) {
+		BotAI_Print(PRT_MESSAGE, "usage: botweightbench <weightfile> [iterations]\n");
+		return;
+	}
+	trap_Argv(1, filename, sizeof(filename));
+	trap_Argv(2, arg, sizeof(arg));
+	iterations = atoi(arg);
+	if (iterations <= 0) iterations = 10000;
+
+	wc = ReadWeightConfig(filename);
+	if (!wc) return;
+
+	// time both evaluators on the same pseudo random inventories
+	for (pass = 0; pass < 2; pass++) {
+		seed = 0x1234;
+		sum[pass] = 0;
+		starttime = trap_Milliseconds();
+		for (i = 0; i < iterations; i++) {
+			for (j = 0; j < MAX_ITEMS; j++) {
+				seed = seed * 1103515245 + 12345;
+				inventory[j] = (seed >> 16) & 255;
+			}
+			if (pass == 0) {
+				for (n = 0; n < wc->numweights; n++) {
+					sum[pass] += FuzzyWeightTree(inventory, wc, n);
+				}
+			} else {
+				FuzzyWeights(inventory, wc, nodeweights);
+				for (n = 0; n < wc->numweights; n++) {
+					sum[pass] += nodeweights[n];
+				}
+			}
+		}
+		time[pass] = trap_Milliseconds() - starttime;
+	}
+	// check the compiled weights against the trees
+	mismatches = 0;
+	seed = 0x1234;
+	for (i = 0; i < iterations; i++) {
+		for (j = 0; j < MAX_ITEMS; j++) {
+			seed = seed * 1103515245 + 12345;
+			inventory[j] = (seed >> 16) & 255;
+		}
+		FuzzyWeights(inventory, wc, nodeweights);
+		for (n = 0; n < wc->numweights; n++) {
+			treeweights[n] = FuzzyWeightTree(inventory, wc, n);
+			if (fabs(treeweights[n] - nodeweights[n]) > 0.001f * (1 + fabs(treeweights[n]))) {
+				mismatches++;
+			}
+		}
+	}
+	BotAI_Print(PRT_MESSAGE, "%s: %d weights, %d nodes, %d iterations\n", filename, wc->numweights, wc->numnodes, iterations);
+	BotAI_Print(PRT_MESSAGE, "tree %d msec (sum %f), compiled %d msec (sum %f), %d mismatches\n",
+		time[0], sum[0], time[1], sum[1], mismatches);
+	FreeWeightConfig(wc);
+}
+
+/*
+==================
+Svcmd_BotMatchBench_f
+
+replays a chat log through the compiled and the linear match template search
+==================
+*/
+void Svcmd_BotMatchBench_f(void) {
+	int i, len, numlines, repeat, pass, found[2], starttime, time[2], mismatches;
+	int r1, r2;
+	unsigned long int context;
+	char filename[MAX_QPATH], arg[MAX_TOKEN_CHARS];
+	char *buf, *ptr, *line;
+	bot_match_t match1, match2;
+	fileHandle_t f;
+
+	if (trap_Argc() < 2) {
+		BotAI_Print(PRT_MESSAGE, "usage: botmatchbench <chatlog> [context] [repeat]\n");
+		return;
+	}
+	trap_Argv(1, filename, sizeof(filename));
+	trap_Argv(2, arg, sizeof(arg));
+	context = arg[0] ? atoi(arg) : 0xFFFFFFFF;
+	trap_Argv(3, arg, sizeof(arg));
+	repeat = atoi(arg);
+	if (repeat <= 0) repeat = 10;
+
+	len = trap_FS_FOpenFile(filename, &f, FS_READ);
+	if (!f) {
+		BotAI_Print(PRT_ERROR, "file not found: %s\n", filename);
+		return;
+	}
+	buf = trap_HeapMalloc(len + 1);
+	trap_FS_Read(buf, len, f);
+	buf[len] = '\0';
+	trap_FS_FCloseFile(f);
+	// one console message per line
+	numlines = 0;
+	for (ptr = buf; *ptr; ptr++) {
+		if (*ptr == '\n' || *ptr == '\r') {
+			*ptr = '\0';
+			numlines++;
+		}
+	}
+
+	for (pass = 0; pass < 2; pass++) {
+		found[pass] = 0;
+		starttime = trap_Milliseconds();
+		for (i = 0; i < repeat; i++) {
+			for (line = buf; line < buf + len; line += strlen(line) + 1) {
+				if (!*line) continue;
+				if (pass == 0) r1 = BotFindMatchLinear(line, &match1, context);
+				else r1 = BotFindMatch(line, &match1, context);
+				if (r1) found[pass]++;
+			}
+		}
+		time[pass] = trap_Milliseconds() - starttime;
+	}
+	// compare the results of both searches
+	mismatches = 0;
+	for (line = buf; line < buf + len; line += strlen(line) + 1) {
+		if (!*line) continue;
+		r1 = BotFindMatchLinear(line, &match1, context);
+		r2 = BotFindMatch(line, &match2, context);
+		if (r1 != r2 || (r1 && (match1.type != match2.type || match1.subtype != match2.subtype))) {
+			BotAI_Print(PRT_MESSAGE, "mismatch: %s\n", line);
+			mismatches++;
+		}
+	}
+	trap_HeapFree(buf);
+	BotAI_Print(PRT_MESSAGE, "%s: %d lines replayed %d times\n", filename, numlines, repeat);
+	BotAI_Print(PRT_MESSAGE, "linear %d msec (%d matches), compiled %d msec (%d matches), %d mismatches\n",
+		time[0], found[0], time[1], found[1], mismatches);
+}
+
 /*
 ==================
 BotSetInfoConfigString
@@ -1178,6 +1667,75 @@ void BotEntityInfo(int entnum, aas_entityinfo_t *info) {
 	info->torsoAnim = ent->s.torsoAnim;
 }
 
+/*
+==============
+BotSense
+==============
+*/
+bot_sense_t *BotSense(int entnum) {
+	return &botsenses[entnum];
+}
+
+/*
+==============
+BotUpdateSenses
+
+fills the position in the compact entity records after the entities are
+updated in the botlib
+==============
+*/
+static void BotUpdateSenses(void) {
+	int i;
+	gentity_t *ent;
+	bot_sense_t *sense;
+
+	for (i = 0; i < level.num_entities; i++) {
+		ent = &g_entities[i];
+		sense = &botsenses[i];
+		sense->valid = ent->botvalid;
+		VectorCopy(ent->visorigin, sense->origin);
+		VectorCopy(ent->lastAngles, sense->angles);
+		if (sense->valid && i < MAX_CLIENTS) {
+			sense->areanum = BotPointAreaNum(sense->origin);
+		}
+		else {
+			sense->areanum = 0;
+		}
+	}
+	//entities freed since the last update
+	for (; i < numbotsenses; i++) {
+		memset(&botsenses[i], 0, sizeof(bot_sense_t));
+	}
+	numbotsenses = level.num_entities;
+}
+
+/*
+==============
+BotUpdateSenseStates
+
+fills the state in the compact entity records before the bots think, the
+entity flags, powerups and bounds change in between botlib frames while the
+bots keep thinking
+==============
+*/
+static void BotUpdateSenseStates(void) {
+	int i;
+	gentity_t *ent;
+	bot_sense_t *sense;
+
+	for (i = 0; i < numbotsenses; i++) {
+		ent = &g_entities[i];
+		sense = &botsenses[i];
+		//freed entities are no longer valid
+		sense->valid = ent->botvalid;
+		VectorCopy(ent->s.mins, sense->mins);
+		VectorCopy(ent->s.maxs, sense->maxs);
+		sense->flags = ent->s.eFlags;
+		sense->powerups = ent->s.powerups;
+		sense->tokens = ent->s.tokens;
+	}
+}
+
 /*
 ==============
 BotLibVarGetValue
@@ -1559,8 +2117,13 @@ int BotAI(int playernum, float thinktime) {
 	//eye coordinates of the bot
 	VectorCopy(bs->cur_ps.origin, bs->eye);
 	bs->eye[2] += bs->cur_ps.viewheight;
-	//get the area the bot is in
-	bs->areanum = BotPointAreaNum(bs->origin);
+	//get the area the bot is in, use the area from the prethink when still valid
+	if (bs->prethinkvalid && VectorCompare(bs->prethinkorigin, bs->origin)) {
+		bs->areanum = bs->prethinkareanum;
+	} else {
+		bs->areanum = BotPointAreaNum(bs->origin);
+	}
+	bs->prethinkvalid = qfalse;
 	//the real AI
 	BotDeathmatchAI(bs, thinktime);
 	//set the weapon selection every AI frame
@@ -1579,17 +2142,52 @@ BotScheduleBotThink
 ==================
 */
 void BotScheduleBotThink(void) {
-	int i, botnum;
-
-	botnum = 0;
+	int i, j, n, numslots, slot, cost;
+	int bots[MAX_CLIENTS], botcost[MAX_CLIENTS], numscheduled;
+	int slotcost[MAX_BOTTHINKSLOTS];
 
+	//sort the bots on their average think cost, most expensive first
+	numscheduled = 0;
 	for( i = 0; i < MAX_CLIENTS; i++ ) {
 		if( !botstates[i] || !botstates[i]->inuse ) {
 			continue;
 		}
+		cost = 1;
+		if (botstates[i]->thinkcount) {
+			cost += botstates[i]->thinkcost * 1000 / botstates[i]->thinkcount;
+		}
+		for (j = numscheduled; j > 0 && botcost[j-1] < cost; j--) {
+			bots[j] = bots[j-1];
+			botcost[j] = botcost[j-1];
+		}
+		bots[j] = i;
+		botcost[j] = cost;
+		numscheduled++;
+	}
+	if (!numscheduled) {
+		return;
+	}
+	//one think slot for every frame within the bot think time
+	if (botframe_msec > 0 && botframe_msec <= bot_thinktime.integer) {
+		numslots = bot_thinktime.integer / botframe_msec;
+	}
+	else {
+		numslots = numscheduled;
+	}
+	if (numslots > MAX_BOTTHINKSLOTS) numslots = MAX_BOTTHINKSLOTS;
+	if (numslots < 1) numslots = 1;
+	//put every bot in the think slot with the lowest total cost
+	memset(slotcost, 0, sizeof(slotcost));
+	for (n = 0; n < numscheduled; n++) {
+		slot = 0;
+		for (j = 1; j < numslots; j++) {
+			if (slotcost[j] < slotcost[slot]) {
+				slot = j;
+			}
+		}
+		slotcost[slot] += botcost[n];
 		//initialize the bot think residual time
-		botstates[i]->botthink_residual = bot_thinktime.integer * botnum / numbots;
-		botnum++;
+		botstates[bots[n]]->botthink_residual = bot_thinktime.integer * slot / numslots;
 	}
 }
 
@@ -1917,9 +2515,10 @@ BotAIStartFrame
 ==================
 */
 int BotAIStartFrame(int time) {
-	int i;
+	int i, n, firstbot, numthinks, start_time, think_time;
+	qboolean deferred;
 	gentity_t	*ent;
-	bot_entitystate_t state;
+	bot_entitystate_t *state;
 	int elapsed_time, thinktime;
 	static int local_time;
 	static int botlib_residual;
@@ -1933,8 +2532,14 @@ int BotAIStartFrame(int time) {
 	trap_Cvar_Update(&bot_nochat);
 	trap_Cvar_Update(&bot_testrchat);
 	trap_Cvar_Update(&bot_thinktime);
+	trap_Cvar_Update(&bot_thinkbudget);
+	trap_Cvar_Update(&bot_thinkthreads);
 	trap_Cvar_Update(&bot_memorydump);
 	trap_Cvar_Update(&bot_saveroutingcache);
+	trap_Cvar_Update(&bot_bakeroutetables);
+	trap_Cvar_Update(&bot_writecompactaas);
+	trap_Cvar_Update(&bot_samplebenchmark);
+	trap_Cvar_Update(&bot_routingcacheinfo);
 	trap_Cvar_Update(&bot_pause);
 	trap_Cvar_Update(&bot_report);
 	trap_Cvar_Update(&bot_droppedweight);
@@ -1981,6 +2586,22 @@ int BotAIStartFrame(int time) {
 		trap_BotLibVarSet("saveroutingcache", "1");
 		trap_Cvar_SetValue("bot_saveroutingcache", 0);
 	}
+	if (bot_bakeroutetables.integer) {
+		trap_BotLibVarSet("bakeroutetables", "1");
+		trap_Cvar_SetValue("bot_bakeroutetables", 0);
+	}
+	if (bot_writecompactaas.integer) {
+		trap_BotLibVarSet("writecompactaas", "1");
+		trap_Cvar_SetValue("bot_writecompactaas", 0);
+	}
+	if (bot_samplebenchmark.integer) {
+		trap_BotLibVarSet("samplebenchmark", "1");
+		trap_Cvar_SetValue("bot_samplebenchmark", 0);
+	}
+	if (bot_routingcacheinfo.integer) {
+		trap_BotLibVarSet("routingcacheinfo", "1");
+		trap_Cvar_SetValue("bot_routingcacheinfo", 0);
+	}
 	//check if bot interbreeding is activated
 	BotInterbreeding();
 	//cap the bot think time
@@ -1995,6 +2616,7 @@ int BotAIStartFrame(int time) {
 
 	elapsed_time = time - local_time;
 	local_time = time;
+	botframe_msec = elapsed_time;
 
 	botlib_residual += elapsed_time;
 
@@ -2010,36 +2632,31 @@ int BotAIStartFrame(int time) {
 		if (!trap_AAS_Initialized()) return qfalse;
 
 		//update entities in the botlib
-		for (i = 0; i < MAX_GENTITIES; i++) {
+		numbotentities = 0;
+		for (i = 0; i < level.num_entities; i++) {
 			ent = &g_entities[i];
 			ent->botvalid = qfalse;
 			if (!ent->inuse) {
-				trap_BotLibUpdateEntity(i, NULL);
 				continue;
 			}
 			if (!ent->r.linked) {
-				trap_BotLibUpdateEntity(i, NULL);
 				continue;
 			}
 			if (ent->r.svFlags & SVF_NOCLIENT) {
-				trap_BotLibUpdateEntity(i, NULL);
 				continue;
 			}
 			// do not update missiles
 			if (ent->s.eType == ET_MISSILE && ent->s.weapon != WP_GRAPPLING_HOOK) {
-				trap_BotLibUpdateEntity(i, NULL);
 				continue;
 			}
 			// do not update event only entities
 			if (ent->s.eType > ET_EVENTS) {
-				trap_BotLibUpdateEntity(i, NULL);
 				continue;
 			}
 #ifdef MISSIONPACK
 			// never link prox mine triggers
 			if (ent->s.contents == CONTENTS_TRIGGER) {
 				if (ent->touch == ProximityMine_Trigger) {
-					trap_BotLibUpdateEntity(i, NULL);
 					continue;
 				}
 			}
@@ -2049,36 +2666,37 @@ int BotAIStartFrame(int time) {
 			ent->update_time = trap_AAS_Time() - ent->ltime;
 			ent->ltime = trap_AAS_Time();
 			//
-			memset(&state, 0, sizeof(bot_entitystate_t));
+			state = &botentitystates[numbotentities];
+			memset(state, 0, sizeof(bot_entitystate_t));
 			//
-			VectorCopy(ent->r.currentOrigin, state.origin);
+			VectorCopy(ent->r.currentOrigin, state->origin);
 			if (i < MAX_CLIENTS) {
-				VectorCopy(ent->s.apos.trBase, state.angles);
+				VectorCopy(ent->s.apos.trBase, state->angles);
 			} else {
-				VectorCopy(ent->r.currentAngles, state.angles);
+				VectorCopy(ent->r.currentAngles, state->angles);
 			}
-			VectorCopy( ent->r.absmin, state.absmins );
-			VectorCopy( ent->r.absmax, state.absmaxs );
-			state.type = ent->s.eType;
-			state.flags = ent->s.eFlags;
+			VectorCopy( ent->r.absmin, state->absmins );
+			VectorCopy( ent->r.absmax, state->absmaxs );
+			state->type = ent->s.eType;
+			state->flags = ent->s.eFlags;
 			//
 			if (ent->s.collisionType == CT_SUBMODEL) {
-				state.solid = SOLID_BSP;
+				state->solid = SOLID_BSP;
 				//if the angles of the model changed
-				if ( !VectorCompare( state.angles, ent->lastAngles ) ) {
-					VectorCopy(state.angles, ent->lastAngles);
-					state.relink = qtrue;
+				if ( !VectorCompare( state->angles, ent->lastAngles ) ) {
+					VectorCopy(state->angles, ent->lastAngles);
+					state->relink = qtrue;
 				}
 			} else {
-				state.solid = SOLID_BBOX;
-				VectorCopy(state.angles, ent->lastAngles);
+				state->solid = SOLID_BBOX;
+				VectorCopy(state->angles, ent->lastAngles);
 			}
 			//previous frame visorigin
 			VectorCopy( ent->visorigin, ent->lastvisorigin );
 			//if the origin changed
-			if ( !VectorCompare( state.origin, ent->visorigin ) ) {
-				VectorCopy( state.origin, ent->visorigin );
-				state.relink = qtrue;
+			if ( !VectorCompare( state->origin, ent->visorigin ) ) {
+				VectorCopy( state->origin, ent->visorigin );
+				state->relink = qtrue;
 			}
 			//if the bounding box size changed
 			if (!VectorCompare(ent->s.mins, ent->lastMins) ||
@@ -2086,19 +2704,61 @@ int BotAIStartFrame(int time) {
 			{
 				VectorCopy( ent->s.mins, ent->lastMins );
 				VectorCopy( ent->s.maxs, ent->lastMaxs );
-				state.relink = qtrue;
+				state->relink = qtrue;
 			}
 			//
-			trap_BotLibUpdateEntity(i, &state);
+			botentitynums[numbotentities++] = i;
 		}
+		//update the linked entities in one call, all other entities are unlinked
+		trap_BotLibUpdateEntities(numbotentities, botentitynums, botentitystates);
+		//the bots look at the entities through the compact records
+		BotUpdateSenses();
 
 		BotAIRegularUpdate();
 	}
 
 	floattime = trap_AAS_Time();
 
+#ifdef BOT_THINK_THREADS
+	//start or stop the bot think threads when the number of threads changed
+	if (bot_thinkthreads.integer > MAX_BOTTHINK_THREADS) {
+		trap_Cvar_SetValue("bot_thinkthreads", MAX_BOTTHINK_THREADS);
+		bot_thinkthreads.integer = MAX_BOTTHINK_THREADS;
+	}
+	if (bot_thinkthreads.integer != botthinkpool.numrequested) {
+		botthinkpool.numrequested = bot_thinkthreads.integer;
+		BotStartThinkThreads(bot_thinkthreads.integer);
+	}
+	//prepare the thinks of the bots that will think this frame in parallel
+	if (botthinkpool.numthreads && trap_AAS_Initialized()) {
+		botthinkpool.numbots = 0;
+		for( i = 0; i < MAX_CLIENTS; i++ ) {
+			if( !botstates[i] || !botstates[i]->inuse ) {
+				continue;
+			}
+			if( g_entities[i].player->pers.connected != CON_CONNECTED ) {
+				continue;
+			}
+			if ( botstates[i]->botthink_residual + elapsed_time < thinktime ) {
+				continue;
+			}
+			botthinkpool.bots[botthinkpool.numbots++] = i;
+		}
+		BotRunPrethinks();
+	}
+#endif //BOT_THINK_THREADS
+
 	// execute scheduled bot AI
-	for( i = 0; i < MAX_CLIENTS; i++ ) {
+	start_time = trap_Milliseconds();
+	numthinks = 0;
+	deferred = qfalse;
+	firstbot = botthink_first;
+	botthink_first = 0;
+	//the bots share line of sight checks while they think
+	BotBeginVisibilityFrame();
+	BotUpdateSenseStates();
+	for( n = 0; n < MAX_CLIENTS; n++ ) {
+		i = (firstbot + n) % MAX_CLIENTS;
 		if( !botstates[i] || !botstates[i]->inuse ) {
 			continue;
 		}
@@ -2106,15 +2766,44 @@ int BotAIStartFrame(int time) {
 		botstates[i]->botthink_residual += elapsed_time;
 		//
 		if ( botstates[i]->botthink_residual >= thinktime ) {
+			//if the bot think budget for this frame is used up
+			if ( bot_thinkbudget.integer > 0 && numthinks > 0 &&
+					trap_Milliseconds() - start_time >= bot_thinkbudget.integer ) {
+				//defer the think to the next frame and start with this bot
+				if (!deferred) {
+					deferred = qtrue;
+					botthink_first = i;
+					botthink_overbudget++;
+				}
+				botstates[i]->thinkdeferred++;
+				continue;
+			}
 			botstates[i]->botthink_residual -= thinktime;
+			//don't catch up on thinks missed while deferred
+			if ( botstates[i]->botthink_residual >= thinktime ) {
+				botstates[i]->botthink_residual %= thinktime;
+			}
 
-			if (!trap_AAS_Initialized()) return qfalse;
+			if (!trap_AAS_Initialized()) {
+				BotEndVisibilityFrame();
+				return qfalse;
+			}
 
 			if (g_entities[i].player->pers.connected == CON_CONNECTED) {
+				think_time = trap_Milliseconds();
 				BotAI(i, (float) thinktime / 1000);
+				think_time = trap_Milliseconds() - think_time;
+				//
+				botstates[i]->thinkcount++;
+				botstates[i]->thinkcost += think_time;
+				if (think_time > botstates[i]->thinkcostmax) {
+					botstates[i]->thinkcostmax = think_time;
+				}
+				numthinks++;
 			}
 		}
 	}
+	BotEndVisibilityFrame();
 
 
 	// execute bot user commands every frame
@@ -2154,6 +2843,9 @@ int BotInitLibrary(void) {
 	//maximum number of aas links
 	trap_Cvar_VariableStringBuffer("max_aaslinks", buf, sizeof(buf));
 	if (strlen(buf)) trap_BotLibVarSet("max_aaslinks", buf);
+	//maximum size of the routing cache in KB
+	trap_Cvar_VariableStringBuffer("max_routingcache", buf, sizeof(buf));
+	if (strlen(buf)) trap_BotLibVarSet("max_routingcache", buf);
 	//bot developer mode and log file
 	trap_BotLibVarSet("bot_developer", bot_developer.string);
 	trap_Cvar_VariableStringBuffer("logfile", buf, sizeof(buf));
@@ -2176,6 +2868,12 @@ int BotInitLibrary(void) {
 	//
 	trap_Cvar_VariableStringBuffer("bot_saveroutingcache", buf, sizeof(buf));
 	if (strlen(buf)) trap_BotLibVarSet("saveroutingcache", buf);
+	//sort routing updates on travel time
+	trap_Cvar_VariableStringBuffer("bot_routingqueue", buf, sizeof(buf));
+	if (strlen(buf)) trap_BotLibVarSet("routingqueue", buf);
+	//number of threads used to calculate reachability
+	trap_Cvar_VariableStringBuffer("bot_reachabilitythreads", buf, sizeof(buf));
+	if (strlen(buf)) trap_BotLibVarSet("reachabilitythreads", buf);
 	//
 #ifdef MISSIONPACK
 	trap_PC_AddGlobalDefine("MISSIONPACK");
@@ -2193,8 +2891,14 @@ int BotAISetup( int restart ) {
 	int			errnum;
 
 	trap_Cvar_Register(&bot_thinktime, "bot_thinktime", "100", CVAR_CHEAT);
+	trap_Cvar_Register(&bot_thinkbudget, "bot_thinkbudget", "0", 0);
+	trap_Cvar_Register(&bot_thinkthreads, "bot_thinkthreads", "0", CVAR_ARCHIVE);
 	trap_Cvar_Register(&bot_memorydump, "bot_memorydump", "0", CVAR_CHEAT);
 	trap_Cvar_Register(&bot_saveroutingcache, "bot_saveroutingcache", "0", CVAR_CHEAT);
+	trap_Cvar_Register(&bot_bakeroutetables, "bot_bakeroutetables", "0", CVAR_CHEAT);
+	trap_Cvar_Register(&bot_writecompactaas, "bot_writecompactaas", "0", CVAR_CHEAT);
+	trap_Cvar_Register(&bot_samplebenchmark, "bot_samplebenchmark", "0", CVAR_CHEAT);
+	trap_Cvar_Register(&bot_routingcacheinfo, "bot_routingcacheinfo", "0", 0);
 	trap_Cvar_Register(&bot_pause, "bot_pause", "0", CVAR_CHEAT);
 	trap_Cvar_Register(&bot_report, "bot_report", "0", CVAR_CHEAT);
 	trap_Cvar_Register(&bot_testsolid, "bot_testsolid", "0", CVAR_CHEAT);
@@ -2258,6 +2962,10 @@ int BotAIShutdown( int restart ) {
 		}
 	}
 
+#ifdef BOT_THINK_THREADS
+	BotStopThinkThreads();
+	botthinkpool.numrequested = 0;
+#endif
 	trap_BotLibShutdown();
 
 	//
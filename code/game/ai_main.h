@@ -41,6 +41,8 @@ Suite 120, Rockville, Maryland 20850 USA.
 #define BOTFILESBASEFOLDER		"botfiles"
 
 #define MAX_ITEMS					256
+//max number of frames the bot thinks are spread over (bot_thinktime is at most 200 msec)
+#define MAX_BOTTHINKSLOTS			200
 //bot flags
 #define BFL_STRAFERIGHT				1	//strafe to the right
 #define BFL_ATTACKED				2	//bot has attacked last ai frame
@@ -133,6 +135,13 @@ typedef struct bot_state_s
 {
 	int inuse;										//true if this state is used by a bot client
 	int botthink_residual;							//residual for the bot thinks
+	int thinkcount;									//number of AI thinks
+	int thinkcost;									//total msec spent in the AI thinks
+	int thinkcostmax;								//most msec spent in a single AI think
+	int thinkdeferred;								//number of AI thinks deferred to a later frame
+	int prethinkvalid;								//true when the prethink area is valid
+	int prethinkareanum;							//area calculated on a bot think thread
+	vec3_t prethinkorigin;							//origin the prethink area was calculated for
 	int playernum;										//player number of the bot
 	int entitynum;									//entity number of the bot
 	playerState_t cur_ps;							//current player state
@@ -313,12 +322,29 @@ typedef struct aas_entityinfo_s
 	int		torsoAnim;		// mask off ANIM_TOGGLEBIT
 } aas_entityinfo_t;
 
+//compact entity record for the bot perception, the position is filled once
+//per botlib frame and the state once per frame before the bots think
+typedef struct bot_sense_s
+{
+	int		valid;			// true if updated this botlib frame
+	int		areanum;		// area a valid player is in
+	vec3_t	origin;			// origin of the entity
+	vec3_t	angles;			// angles of the entity
+	vec3_t	mins;			// bounding box minimums
+	vec3_t	maxs;			// bounding box maximums
+	int		flags;			// entity flags (EF_*)
+	int		powerups;		// bit flags
+	int		tokens;			// harvester skulls
+} bot_sense_t;
+
 //resets the whole bot state
 void BotResetState(bot_state_t *bs);
 //returns the number of bots in the game
 int NumBots(void);
 //returns info about the entity
 void BotEntityInfo(int entnum, aas_entityinfo_t *info);
+//returns the compact entity record of this botlib frame
+bot_sense_t *BotSense(int entnum);
 //returns next entity number that's valid for bot AI or 0 if no more entities left
 int BotNextEntity(int entnum);
 //returns float valud of a libvar
@@ -85,11 +85,17 @@ Suite 120, Rockville, Maryland 20850 USA.
 #define MODELTYPE_FUNC_STATIC	4
 #define MODELTYPE_FUNC_BUTTON	5
 
+#define MAX_FUZZYAREAS			32
+
 float phys_maxbarrier;
 //type of model, func_plat or func_bobbing
 int modeltypes[MAX_SUBMODELS];
 
 static bot_movestate_t botmovestates[MAX_CLIENTS+1];
+//increased every time a routing area is enabled, invalidates all path corridors
+static int botcorridorrouting;
+//area the origin of each player was in the last time it was looked up
+static int botpointareas[MAX_CLIENTS];
 
 //========================================================================
 //
@@ -189,27 +195,87 @@ float AngleDiff(float ang1, float ang2)
 // Returns:				-
 // Changes Globals:		-
 //===========================================================================
-int BotFuzzyPointReachabilityArea(vec3_t origin)
+// returns true if the trace from start to end can pass through one of the
+// given area bounds, a negative number of areas means all areas
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+static qboolean BotFuzzyTraceNearAreas(vec3_t start, vec3_t end, vec3_t *mins, vec3_t *maxs, int numareas)
 {
-	int firstareanum, j, x, y, z;
+	int i, j;
+
+	if (numareas < 0) return qtrue;
+	for (i = 0; i < numareas; i++)
+	{
+		for (j = 0; j < 3; j++)
+		{
+			if (start[j] < mins[i][j] - 1 && end[j] < mins[i][j] - 1) break;
+			if (start[j] > maxs[i][j] + 1 && end[j] > maxs[i][j] + 1) break;
+		} //end for
+		if (j >= 3) return qtrue;
+	} //end for
+	return qfalse;
+} //end of the function BotFuzzyTraceNearAreas
+//===========================================================================
+static int BotPlayerFuzzyPointReachabilityArea(vec3_t origin, int playernum)
+{
+	int firstareanum, i, j, x, y, z;
 	int areas[10], numareas, areanum, bestareanum;
+	int nearareas[MAX_FUZZYAREAS], numnearareas;
 	float dist, bestdist;
-	vec3_t points[10], v, end;
+	vec3_t points[10], v, end, absmins, absmaxs;
+	vec3_t nearmins[MAX_FUZZYAREAS], nearmaxs[MAX_FUZZYAREAS];
+	aas_areainfo_t areainfo;
 
 	firstareanum = 0;
-	areanum = trap_AAS_PointAreaNum(origin);
+	//the player is usually still in the area it was in last time
+	if (playernum >= 0 && playernum < MAX_CLIENTS &&
+			trap_AAS_PointInsideArea(botpointareas[playernum], origin))
+	{
+		areanum = botpointareas[playernum];
+	} //end if
+	else
+	{
+		areanum = trap_AAS_PointAreaNum(origin);
+		if (playernum >= 0 && playernum < MAX_CLIENTS) botpointareas[playernum] = areanum;
+	} //end else
 	if (areanum)
 	{
 		firstareanum = areanum;
 		if (trap_AAS_AreaReachability(areanum)) return areanum;
 	} //end if
+	//get the reachability areas the traces below can run into
+	VectorSet(absmins, origin[0] - 8, origin[1] - 8, origin[2] - 12);
+	VectorSet(absmaxs, origin[0] + 8, origin[1] + 8, origin[2] + 12);
+	numnearareas = trap_AAS_BBoxReachabilityAreas(absmins, absmaxs, nearareas, MAX_FUZZYAREAS);
+	if (numnearareas >= MAX_FUZZYAREAS)
+	{
+		//too many areas to check, trace everything
+		numnearareas = -1;
+	} //end if
+	else
+	{
+		//if there are no reachability areas nearby
+		if (!numnearareas && firstareanum) return firstareanum;
+		for (i = 0; i < numnearareas; i++)
+		{
+			trap_AAS_AreaInfo(nearareas[i], &areainfo);
+			VectorCopy(areainfo.mins, nearmins[i]);
+			VectorCopy(areainfo.maxs, nearmaxs[i]);
+		} //end for
+	} //end else
 	VectorCopy(origin, end);
 	end[2] += 4;
-	numareas = trap_AAS_TraceAreas(origin, end, areas, points, 10);
-	for (j = 0; j < numareas; j++)
+	if (BotFuzzyTraceNearAreas(origin, end, nearmins, nearmaxs, numnearareas))
 	{
-		if (trap_AAS_AreaReachability(areas[j])) return areas[j];
-	} //end for
+		numareas = trap_AAS_TraceAreas(origin, end, areas, points, 10);
+		for (j = 0; j < numareas; j++)
+		{
+			if (trap_AAS_AreaReachability(areas[j])) return areas[j];
+		} //end for
+	} //end if
 	bestdist = 999999;
 	bestareanum = 0;
 	for (z = 1; z >= -1; z -= 1)
@@ -222,6 +288,12 @@ int BotFuzzyPointReachabilityArea(vec3_t origin)
 				end[0] += x * 8;
 				end[1] += y * 8;
 				end[2] += z * 12;
+				//once the first area is known only traces that can pass through
+				//a reachability area matter
+				if (firstareanum && !BotFuzzyTraceNearAreas(origin, end, nearmins, nearmaxs, numnearareas))
+				{
+					continue;
+				} //end if
 				numareas = trap_AAS_TraceAreas(origin, end, areas, points, 10);
 				for (j = 0; j < numareas; j++)
 				{
@@ -242,6 +314,16 @@ int BotFuzzyPointReachabilityArea(vec3_t origin)
 		if (bestareanum) return bestareanum;
 	} //end for
 	return firstareanum;
+} //end of the function BotPlayerFuzzyPointReachabilityArea
+//===========================================================================
+//
+// Parameter:			-
+// Returns:				-
+// Changes Globals:		-
+//===========================================================================
+int BotFuzzyPointReachabilityArea(vec3_t origin)
+{
+	return BotPlayerFuzzyPointReachabilityArea(origin, -1);
 } //end of the function BotFuzzyPointReachabilityArea
 //===========================================================================
 //
@@ -266,7 +348,7 @@ int BotReachabilityArea(vec3_t origin, int passEnt)
 		//if standing on the world the bot should be in a valid area
 		if (bsptrace.entityNum == ENTITYNUM_WORLD)
 		{
-			return BotFuzzyPointReachabilityArea(origin);
+			return BotPlayerFuzzyPointReachabilityArea(origin, passEnt);
 		} //end if
 
 		modelnum = g_entities[bsptrace.entityNum].s.modelindex;
@@ -287,10 +369,10 @@ int BotReachabilityArea(vec3_t origin, int passEnt)
 		//if the bot is swimming the bot should be in a valid area
 		if (trap_AAS_Swimming(origin))
 		{
-			return BotFuzzyPointReachabilityArea(origin);
+			return BotPlayerFuzzyPointReachabilityArea(origin, passEnt);
 		} //end if
 		//
-		areanum = BotFuzzyPointReachabilityArea(origin);
+		areanum = BotPlayerFuzzyPointReachabilityArea(origin, passEnt);
 		//if the bot is in an area with reachabilities
 		if (areanum && trap_AAS_AreaReachability(areanum)) return areanum;
 		//trace down till the ground is hit because the bot is standing on some other entity
@@ -303,10 +385,10 @@ int BotReachabilityArea(vec3_t origin, int passEnt)
 			VectorCopy(trace.endpos, org);
 		} //end if
 		//
-		return BotFuzzyPointReachabilityArea(org);
+		return BotPlayerFuzzyPointReachabilityArea(org, passEnt);
 	} //end if
 	//
-	return BotFuzzyPointReachabilityArea(origin);
+	return BotPlayerFuzzyPointReachabilityArea(origin, passEnt);
 } //end of the function BotReachabilityArea
 //===========================================================================
 // returns the reachability area the bot is in
@@ -764,14 +846,17 @@ int BotGetReachabilityToGoal(vec3_t origin, int areanum,
 	{
 #ifdef AVOIDREACH
 		//check if it isn't a reachability to avoid
-		for (i = 0; i < MAX_AVOIDREACH; i++)
-		{
-			if (avoidreach[i] == reachnum && avoidreachtimes[i] >= trap_AAS_Time()) break;
-		} //end for
-		if (i != MAX_AVOIDREACH && avoidreachtries[i] > AVOIDREACH_TRIES)
+		if (avoidreach)
 		{
-			//BotAI_Print(PRT_DEVELOPER, "avoiding reachability %d\n", avoidreach[i]);
-			continue;
+			for (i = 0; i < MAX_AVOIDREACH; i++)
+			{
+				if (avoidreach[i] == reachnum && avoidreachtimes[i] >= trap_AAS_Time()) break;
+			} //end for
+			if (i != MAX_AVOIDREACH && avoidreachtries[i] > AVOIDREACH_TRIES)
+			{
+				//BotAI_Print(PRT_DEVELOPER, "avoiding reachability %d\n", avoidreach[i]);
+				continue;
+			} //end if
 		} //end if
 #endif //AVOIDREACH
 		//get the reachability from the number
@@ -806,6 +891,193 @@ int BotGetReachabilityToGoal(vec3_t origin, int areanum,
 	return bestreachnum;
 } //end of the function BotGetReachabilityToGoal
 //===========================================================================
+// recalculates the path corridor from the given index on, the corridor
+// entries before the index must be valid, stops as soon as the corridor
+// continues the same way as before
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void BotContinueCorridor(bot_movestate_t *ms, int n, bot_goal_t *goal, int travelflags)
+{
+	int reachnum, lastareanum, oldlength;
+	aas_reachability_t reach;
+
+	oldlength = ms->corridorlength;
+	for (; n < MAX_CORRIDOR; n++)
+	{
+		trap_AAS_ReachabilityFromNum(ms->corridorreachnums[n-1], &reach);
+		if (reach.areanum == goal->areanum) break;
+		lastareanum = ms->corridorareas[n-1];
+		reachnum = BotGetReachabilityToGoal(reach.end, reach.areanum,
+								goal->areanum, lastareanum, NULL, NULL, NULL,
+										goal, travelflags, NULL, 0, NULL);
+		if (!reachnum) break;
+		//the rest of the corridor is still valid if it continues the same way
+		if (n < oldlength && ms->corridorareas[n] == reach.areanum &&
+				ms->corridorlastareas[n] == lastareanum && ms->corridorreachnums[n] == reachnum)
+		{
+			return;
+		} //end if
+		ms->corridorareas[n] = reach.areanum;
+		ms->corridorreachnums[n] = reachnum;
+		ms->corridorlastareas[n] = lastareanum;
+	} //end for
+	ms->corridorlength = n;
+} //end of the function BotContinueCorridor
+//===========================================================================
+// the path corridor is the chain of reachabilities towards the goal, when
+// the bot moves along the corridor the reachabilities don't have to be
+// looked up again
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int BotCorridorValid(bot_movestate_t *ms, bot_goal_t *goal, int travelflags)
+{
+	return ms->corridorlength > 0 &&
+			ms->corridorgoalareanum == goal->areanum &&
+			ms->corridortravelflags == travelflags &&
+			ms->corridorrouting == botcorridorrouting;
+} //end of the function BotCorridorValid
+//===========================================================================
+// returns the corridor reachability for the area the bot is in, only when
+// BotGetReachabilityToGoal would choose the same reachability, otherwise
+// zero is returned
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int BotCorridorReachability(bot_movestate_t *ms, bot_goal_t *goal, int travelflags)
+{
+	int i, reachnum, lastareanum;
+	aas_reachability_t reach;
+
+	if (!BotCorridorValid(ms, goal, travelflags)) return 0;
+	//the avoid spots depend on the origin of the bot
+	if (ms->numavoidspots) return 0;
+	//find the area the bot is in further along the corridor
+	for (i = ms->corridorindex; i < ms->corridorlength; i++)
+	{
+		if (ms->corridorareas[i] == ms->areanum) break;
+	} //end for
+	if (i >= ms->corridorlength) return 0;
+	ms->corridorindex = i;
+	//the reachability must have been chosen for the same last area
+	lastareanum = (ms->lastgoalareanum == goal->areanum) ? ms->lastareanum : -1;
+	if (ms->corridorlastareas[i] != lastareanum) return 0;
+	reachnum = ms->corridorreachnums[i];
+#ifdef AVOIDREACH
+	for (i = 0; i < MAX_AVOIDREACH; i++)
+	{
+		if (ms->avoidreach[i] == reachnum && ms->avoidreachtimes[i] >= trap_AAS_Time()) break;
+	} //end for
+	if (i != MAX_AVOIDREACH && ms->avoidreachtries[i] > AVOIDREACH_TRIES) return 0;
+#endif //AVOIDREACH
+	trap_AAS_ReachabilityFromNum(reachnum, &reach);
+	if (!BotValidTravel(ms->origin, &reach, travelflags)) return 0;
+	return reachnum;
+} //end of the function BotCorridorReachability
+//===========================================================================
+// repairs the path corridor after a new reachability has been chosen in
+// the area the bot is in, if the reachability leads back into the corridor
+// the remainder of the corridor is reused
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void BotRepairCorridor(bot_movestate_t *ms, int reachnum, bot_goal_t *goal, int travelflags)
+{
+	int i, n;
+	aas_reachability_t reach;
+
+	if (!reachnum || ms->numavoidspots)
+	{
+		ms->corridorlength = 0;
+		return;
+	} //end if
+	trap_AAS_ReachabilityFromNum(reachnum, &reach);
+	n = 0;
+	if (BotCorridorValid(ms, goal, travelflags))
+	{
+		for (i = ms->corridorindex; i < ms->corridorlength; i++)
+		{
+			if (ms->corridorareas[i] == reach.areanum) break;
+		} //end for
+		//move the rest of the corridor to the front
+		if (i < ms->corridorlength)
+		{
+			n = ms->corridorlength - i;
+			//the reachability in front takes one entry, drop the end of the corridor if it doesn't fit
+			if (n > MAX_CORRIDOR - 1) n = MAX_CORRIDOR - 1;
+			memmove(&ms->corridorareas[1], &ms->corridorareas[i], n * sizeof(int));
+			memmove(&ms->corridorreachnums[1], &ms->corridorreachnums[i], n * sizeof(int));
+			memmove(&ms->corridorlastareas[1], &ms->corridorlastareas[i], n * sizeof(int));
+		} //end if
+	} //end if
+	ms->corridorgoalareanum = goal->areanum;
+	ms->corridortravelflags = travelflags;
+	ms->corridorrouting = botcorridorrouting;
+	ms->corridorindex = 0;
+	ms->corridorareas[0] = ms->areanum;
+	ms->corridorreachnums[0] = reachnum;
+	ms->corridorlastareas[0] = (ms->lastgoalareanum == goal->areanum) ? ms->lastareanum : -1;
+	ms->corridorlength = n + 1;
+	BotContinueCorridor(ms, 1, goal, travelflags);
+} //end of the function BotRepairCorridor
+//===========================================================================
+// enabling an area can make a shorter route available for every corridor,
+// disabling an area only affects the corridors through that area and the
+// corridors that don't reach their goal, their route past the last
+// corridor area might go through the disabled area
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void BotRoutingAreaChanged(int areanum, int enable)
+{
+	int i, j;
+	bot_movestate_t *ms;
+
+	if (enable)
+	{
+		botcorridorrouting++;
+		return;
+	} //end if
+	for (i = 1; i <= MAX_CLIENTS; i++)
+	{
+		ms = &botmovestates[i];
+		for (j = 0; j < ms->corridorlength; j++)
+		{
+			if (ms->corridorareas[j] == areanum) break;
+		} //end for
+		if (j < ms->corridorlength)
+		{
+			ms->corridorlength = 0;
+			continue;
+		} //end if
+		//the route continues past a full corridor
+		if (ms->corridorlength >= MAX_CORRIDOR)
+		{
+			ms->corridorlength = 0;
+			continue;
+		} //end if
+		//the corridor could end with a reachability into the area
+		if (ms->corridorlength)
+		{
+			aas_reachability_t reach;
+
+			trap_AAS_ReachabilityFromNum(ms->corridorreachnums[ms->corridorlength-1], &reach);
+			if (reach.areanum == areanum) ms->corridorlength = 0;
+		} //end if
+	} //end for
+} //end of the function BotRoutingAreaChanged
+//===========================================================================
 //
 // Parameter:				-
 // Returns:					-
@@ -3199,7 +3471,7 @@ void BotMoveToGoal(bot_moveresult_t *result, int movestate, bot_goal_t *goal, in
 				else if (modeltype == MODELTYPE_FUNC_STATIC || modeltype == MODELTYPE_FUNC_DOOR)
 				{
 					// check if ontop of a door bridge ?
-					ms->areanum = BotFuzzyPointReachabilityArea(ms->origin);
+					ms->areanum = BotPlayerFuzzyPointReachabilityArea(ms->origin, ms->playernum);
 					// if not in a reachability area
 					if (!trap_AAS_AreaReachability(ms->areanum))
 					{
@@ -3235,7 +3507,7 @@ void BotMoveToGoal(bot_moveresult_t *result, int movestate, bot_goal_t *goal, in
 		trap_AAS_ReachabilityFromNum(ms->lastreachnum, &lastreach);
 		//reachability area the bot is in
 		//ms->areanum = BotReachabilityArea(ms->origin, ((lastreach.traveltype & TRAVELTYPE_MASK) != TRAVEL_ELEVATOR));
-		ms->areanum = BotFuzzyPointReachabilityArea(ms->origin);
+		ms->areanum = BotPlayerFuzzyPointReachabilityArea(ms->origin, ms->playernum);
 		//
 		if ( !ms->areanum )
 		{
@@ -3323,12 +3595,19 @@ void BotMoveToGoal(bot_moveresult_t *result, int movestate, bot_goal_t *goal, in
 			{
 				BotAI_Print(PRT_DEVELOPER, "area %d no reachability\n", ms->areanum);
 			} //end if
-			//get a new reachability leading towards the goal
-			reachnum = BotGetReachabilityToGoal(ms->origin, ms->areanum,
-								ms->lastgoalareanum, ms->lastareanum,
-											ms->avoidreach, ms->avoidreachtimes, ms->avoidreachtries,
-														goal, travelflags,
-																ms->avoidspots, ms->numavoidspots, &resultflags);
+			//use the path corridor when the bot moved along it
+			reachnum = BotCorridorReachability(ms, goal, travelflags);
+			if (!reachnum)
+			{
+				//get a new reachability leading towards the goal
+				reachnum = BotGetReachabilityToGoal(ms->origin, ms->areanum,
+									ms->lastgoalareanum, ms->lastareanum,
+												ms->avoidreach, ms->avoidreachtimes, ms->avoidreachtries,
+															goal, travelflags,
+																	ms->avoidspots, ms->numavoidspots, &resultflags);
+				//repair the corridor from the area the bot is in
+				BotRepairCorridor(ms, reachnum, goal, travelflags);
+			} //end if
 			//the area number the reachability starts in
 			ms->reachareanum = ms->areanum;
 			//reset some state variables
@@ -3608,6 +3887,9 @@ void BotResetMoveState(int movestate)
 int BotSetupMoveAI(void)
 {
 	BotSetBrushModelTypes();
+	//the path corridors are only valid on the map they were calculated for
+	botcorridorrouting++;
+	memset(botpointareas, 0, sizeof(botpointareas));
 
 	return BLERR_NOERROR;
 } //end of the function BotSetupMoveAI
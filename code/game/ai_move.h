@@ -71,6 +71,7 @@ Suite 120, Rockville, Maryland 20850 USA.
 //
 #define MAX_AVOIDREACH					1
 #define MAX_AVOIDSPOTS					32
+#define MAX_CORRIDOR					64
 // avoid spot types
 #define AVOID_CLEAR						0		//clear all avoid spots
 #define AVOID_ALWAYS					1		//avoid always
@@ -151,10 +152,21 @@ typedef struct bot_movestate_s
 	//
 	bot_avoidspot_t avoidspots[MAX_AVOIDSPOTS];	//spots to avoid
 	int numavoidspots;
+	//
+	int corridorgoalareanum;					//goal area of the path corridor
+	int corridortravelflags;					//travel flags the corridor was calculated with
+	int corridorrouting;						//routing changes when the corridor was calculated
+	int corridorlength;							//number of areas in the corridor
+	int corridorindex;							//corridor area the bot was last in
+	int corridorareas[MAX_CORRIDOR];			//areas along the route towards the goal
+	int corridorreachnums[MAX_CORRIDOR];		//reachability used in every corridor area
+	int corridorlastareas[MAX_CORRIDOR];		//last area the reachability was chosen for, -1 if any
 } bot_movestate_t;
 
 //resets the whole move state
 void BotResetMoveState(int movestate);
+//invalidates the path corridors affected by enabling or disabling a routing area
+void BotRoutingAreaChanged(int areanum, int enable);
 //moves the bot to the given goal
 void BotMoveToGoal(bot_moveresult_t *result, int movestate, bot_goal_t *goal, int travelflags);
 //moves the bot in the specified direction using the specified type of movement
@@ -65,7 +65,8 @@ Suite 120, Rockville, Maryland 20850 USA.
 
 
 #define MAX_INVENTORYVALUE			999999
-#define EVALUATERECURSIVELY
+//maximum number of pending sub switches while evaluating a compiled weight
+#define MAX_FUZZYSTACK				64
 
 #define MAX_WEIGHT_FILES			128
 weightconfig_t	*weightFileList[MAX_WEIGHT_FILES];
@@ -158,6 +159,7 @@ void FreeWeightConfig2(weightconfig_t *config)
 		FreeFuzzySeperators_r(config->weights[i].firstseperator);
 		if (config->weights[i].name) trap_HeapFree(config->weights[i].name);
 	} //end for
+	if (config->nodes) trap_HeapFree(config->nodes);
 	trap_HeapFree(config);
 } //end of the function FreeWeightConfig2
 //===========================================================================
@@ -350,6 +352,8 @@ weightconfig_t *ReadWeightConfig(char *filename)
 	//
 	config = (weightconfig_t *) trap_HeapMalloc(sizeof(weightconfig_t));
 	config->numweights = 0;
+	config->numnodes = 0;
+	config->nodes = NULL;
 	Q_strncpyz( config->filename, filename, sizeof(config->filename) );
 	//parse the item config file
 	while(trap_PC_ReadToken(source, &token))
@@ -441,6 +445,8 @@ weightconfig_t *ReadWeightConfig(char *filename)
 	} //end while
 	//free the source at the end of a pass
 	trap_PC_FreeSource(source);
+	//compile the seperator trees for fast evaluation
+	CompileWeightConfig(config);
 	//if the file was located in a pak file
 	BotAI_Print(PRT_DEVELOPER, "loaded %s\n", filename);
 	BotAI_Print(PRT_DEVELOPER, "weights loaded in %d msec\n", trap_Milliseconds() - starttime);
@@ -452,6 +458,100 @@ weightconfig_t *ReadWeightConfig(char *filename)
 	//
 	return config;
 } //end of the function ReadWeightConfig
+//===========================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int NumFuzzySeperators_r(fuzzyseperator_t *fs)
+{
+	int num;
+
+	for (num = 0; fs; fs = fs->next)
+	{
+		num++;
+		if (fs->child) num += NumFuzzySeperators_r(fs->child);
+	} //end for
+	return num;
+} //end of the function NumFuzzySeperators_r
+//===========================================================================
+// stores the cases of the switch starting at node firstnode and the cases
+// of all the child switches after them, returns the next free node
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+int CompileFuzzySeperators_r(fuzzyseperator_t *firstfs, fuzzynode_t *nodes, int firstnode)
+{
+	int nextnode;
+	fuzzyseperator_t *fs;
+	fuzzynode_t *node;
+
+	//the cases of the switch are consecutive
+	nextnode = firstnode;
+	for (fs = firstfs; fs; fs = fs->next)
+	{
+		node = &nodes[nextnode++];
+		node->index = fs->index;
+		node->value = fs->value;
+		node->child = -1;
+		node->last = (fs->next == NULL);
+		node->weight = fs->weight;
+		node->minweight = fs->minweight;
+		node->maxweight = fs->maxweight;
+	} //end for
+	//the child switches follow
+	node = &nodes[firstnode];
+	for (fs = firstfs; fs; fs = fs->next, node++)
+	{
+		if (!fs->child) continue;
+		node->child = nextnode;
+		nextnode = CompileFuzzySeperators_r(fs->child, nodes, nextnode);
+	} //end for
+	return nextnode;
+} //end of the function CompileFuzzySeperators_r
+//===========================================================================
+// the seperator trees are kept for writing and evolving the weights, after
+// changing the trees the config has to be compiled again
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void CompileWeightConfig(weightconfig_t *config)
+{
+	int i, numnodes;
+
+	numnodes = 0;
+	for (i = 0; i < config->numweights; i++)
+	{
+		numnodes += NumFuzzySeperators_r(config->weights[i].firstseperator);
+	} //end for
+	//the tree layout never changes so the nodes can be re-used
+	if (config->nodes && config->numnodes != numnodes)
+	{
+		trap_HeapFree(config->nodes);
+		config->nodes = NULL;
+	} //end if
+	if (!config->nodes && numnodes)
+	{
+		config->nodes = (fuzzynode_t *) trap_HeapMalloc(numnodes * sizeof(fuzzynode_t));
+	} //end if
+	config->numnodes = numnodes;
+	numnodes = 0;
+	for (i = 0; i < config->numweights; i++)
+	{
+		if (!config->weights[i].firstseperator)
+		{
+			config->firstnode[i] = -1;
+			continue;
+		} //end if
+		config->firstnode[i] = numnodes;
+		numnodes = CompileFuzzySeperators_r(config->weights[i].firstseperator, config->nodes, numnodes);
+	} //end for
+} //end of the function CompileWeightConfig
 #if 0
 //===========================================================================
 //
@@ -622,42 +722,112 @@ float FuzzyWeight_r(int *inventory, fuzzyseperator_t *fs)
 	return fs->weight;
 } //end of the function FuzzyWeight_r
 //===========================================================================
+// evaluates the compiled switch nodes without recursion, the weight is a
+// linear combination of leaf weights so the cases that are interpolated
+// are pushed on a stack together with their share of the weight
 //
 // Parameter:				-
 // Returns:					-
 // Changes Globals:		-
 //===========================================================================
-float FuzzyWeightUndecided_r(int *inventory, fuzzyseperator_t *fs)
+float FuzzyWeightNodes(int *inventory, fuzzynode_t *nodes, int firstnode, int undecided)
 {
-	float scale, w1, w2;
+	int stacknode[MAX_FUZZYSTACK], stackundecided[MAX_FUZZYSTACK];
+	int numstack, n, inv, rnd;
+	float stackscale[MAX_FUZZYSTACK];
+	float weight, scale, w;
+	fuzzynode_t *node, *next;
 
-	if (inventory[fs->index] < fs->value)
-	{
-		if (fs->child) return FuzzyWeightUndecided_r(inventory, fs->child);
-		else return fs->minweight + random() * (fs->maxweight - fs->minweight);
-	} //end if
-	else if (fs->next)
+	if (firstnode < 0) return 0;
+	weight = 0;
+	stacknode[0] = firstnode;
+	stackscale[0] = 1;
+	stackundecided[0] = undecided;
+	numstack = 1;
+	while(numstack > 0)
 	{
-		if (inventory[fs->index] < fs->next->value)
+		numstack--;
+		n = stacknode[numstack];
+		scale = stackscale[numstack];
+		rnd = stackundecided[numstack];
+		//find the case for the inventory value
+		while(1)
 		{
+			node = &nodes[n];
+			inv = inventory[node->index];
+			if (inv < node->value)
+			{
+				if (node->child >= 0)
+				{
+					n = node->child;
+					continue;
+				} //end if
+				if (rnd) w = node->minweight + random() * (node->maxweight - node->minweight);
+				else w = node->weight;
+				weight += scale * w;
+				break;
+			} //end if
+			if (node->last)
+			{
+				weight += scale * node->weight;
+				break;
+			} //end if
+			next = node + 1;
+			if (inv >= next->value)
+			{
+				n++;
+				continue;
+			} //end if
+			//can't interpolate with the default case
+			if (next->value == MAX_INVENTORYVALUE)
+			{
+				if (next->child >= 0)
+				{
+					//NOTE: undecided weights always used the decided weight here
+					n = next->child;
+					rnd = qfalse;
+					continue;
+				} //end if
+				if (rnd) w = next->minweight + random() * (next->maxweight - next->minweight);
+				else w = next->weight;
+				weight += scale * w;
+				break;
+			} //end if
+			if (numstack + 2 > MAX_FUZZYSTACK)
+			{
+				BotAI_Print(PRT_ERROR, "fuzzy weight nested too deep\n");
+				break;
+			} //end if
+			w = (float) (inv - node->value) / (next->value - node->value);
+			//second weight, evaluated after the first
+			if (next->child >= 0)
+			{
+				stacknode[numstack] = next->child;
+				stackscale[numstack] = scale * w;
+				stackundecided[numstack] = qfalse;
+				numstack++;
+			} //end if
+			else
+			{
+				weight += scale * w * (rnd ? next->minweight + random() * (next->maxweight - next->minweight) : next->weight);
+			} //end else
 			//first weight
-			if (fs->child) w1 = FuzzyWeightUndecided_r(inventory, fs->child);
-			else w1 = fs->minweight + random() * (fs->maxweight - fs->minweight);
-			//second weight
-			if (fs->next->child) w2 = FuzzyWeight_r(inventory, fs->next->child);
-			else w2 = fs->next->minweight + random() * (fs->next->maxweight - fs->next->minweight);
-			//the scale factor
-			if(fs->next->value == MAX_INVENTORYVALUE) // is fs->next the default case?
-        		return w2;      // can't interpolate, return default weight
+			if (node->child >= 0)
+			{
+				stacknode[numstack] = node->child;
+				stackscale[numstack] = scale * (1 - w);
+				stackundecided[numstack] = rnd;
+				numstack++;
+			} //end if
 			else
-				scale = (float) (inventory[fs->index] - fs->value) / (fs->next->value - fs->value);
-			//scale between the two weights
-			return (1 - scale) * w1 + scale * w2;
-		} //end if
-		return FuzzyWeightUndecided_r(inventory, fs->next);
-	} //end else if
-	return fs->weight;
-} //end of the function FuzzyWeightUndecided_r
+			{
+				weight += scale * (1 - w) * (rnd ? node->minweight + random() * (node->maxweight - node->minweight) : node->weight);
+			} //end else
+			break;
+		} //end while
+	} //end while
+	return weight;
+} //end of the function FuzzyWeightNodes
 //===========================================================================
 //
 // Parameter:				-
@@ -666,28 +836,7 @@ float FuzzyWeightUndecided_r(int *inventory, fuzzyseperator_t *fs)
 //===========================================================================
 float FuzzyWeight(int *inventory, weightconfig_t *wc, int weightnum)
 {
-#ifdef EVALUATERECURSIVELY
-	return FuzzyWeight_r(inventory, wc->weights[weightnum].firstseperator);
-#else
-	fuzzyseperator_t *s;
-
-	s = wc->weights[weightnum].firstseperator;
-	if (!s) return 0;
-	while(1)
-	{
-		if (inventory[s->index] < s->value)
-		{
-			if (s->child) s = s->child;
-			else return s->weight;
-		} //end if
-		else
-		{
-			if (s->next) s = s->next;
-			else return s->weight;
-		} //end else
-	} //end if
-	return 0;
-#endif
+	return FuzzyWeightNodes(inventory, wc->nodes, wc->firstnode[weightnum], qfalse);
 } //end of the function FuzzyWeight
 //===========================================================================
 //
@@ -697,29 +846,34 @@ float FuzzyWeight(int *inventory, weightconfig_t *wc, int weightnum)
 //===========================================================================
 float FuzzyWeightUndecided(int *inventory, weightconfig_t *wc, int weightnum)
 {
-#ifdef EVALUATERECURSIVELY
-	return FuzzyWeightUndecided_r(inventory, wc->weights[weightnum].firstseperator);
-#else
-	fuzzyseperator_t *s;
+	return FuzzyWeightNodes(inventory, wc->nodes, wc->firstnode[weightnum], qtrue);
+} //end of the function FuzzyWeightUndecided
+//===========================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+void FuzzyWeights(int *inventory, weightconfig_t *wc, float *weights)
+{
+	int i;
 
-	s = wc->weights[weightnum].firstseperator;
-	if (!s) return 0;
-	while(1)
+	for (i = 0; i < wc->numweights; i++)
 	{
-		if (inventory[s->index] < s->value)
-		{
-			if (s->child) s = s->child;
-			else return s->minweight + random() * (s->maxweight - s->minweight);
-		} //end if
-		else
-		{
-			if (s->next) s = s->next;
-			else return s->minweight + random() * (s->maxweight - s->minweight);
-		} //end else
-	} //end if
-	return 0;
-#endif
-} //end of the function FuzzyWeightUndecided
+		weights[i] = FuzzyWeightNodes(inventory, wc->nodes, wc->firstnode[i], qfalse);
+	} //end for
+} //end of the function FuzzyWeights
+//===========================================================================
+//
+// Parameter:				-
+// Returns:					-
+// Changes Globals:		-
+//===========================================================================
+float FuzzyWeightTree(int *inventory, weightconfig_t *wc, int weightnum)
+{
+	if (!wc->weights[weightnum].firstseperator) return 0;
+	return FuzzyWeight_r(inventory, wc->weights[weightnum].firstseperator);
+} //end of the function FuzzyWeightTree
 //===========================================================================
 //
 // Parameter:				-
@@ -757,6 +911,7 @@ void EvolveWeightConfig(weightconfig_t *config)
 	{
 		EvolveFuzzySeperator_r(config->weights[i].firstseperator);
 	} //end for
+	CompileWeightConfig(config);
 } //end of the function EvolveWeightConfig
 //===========================================================================
 //
@@ -800,6 +955,7 @@ void ScaleWeight(weightconfig_t *config, char *name, float scale)
 			break;
 		} //end if
 	} //end for
+	CompileWeightConfig(config);
 } //end of the function ScaleWeight
 //===========================================================================
 //
@@ -842,6 +998,7 @@ void ScaleFuzzyBalanceRange(weightconfig_t *config, float scale)
 	{
 		ScaleFuzzySeperatorBalanceRange_r(config->weights[i].firstseperator, scale);
 	} //end for
+	CompileWeightConfig(config);
 } //end of the function ScaleFuzzyBalanceRange
 //===========================================================================
 //
@@ -913,6 +1070,7 @@ void InterbreedWeightConfigs(weightconfig_t *config1, weightconfig_t *config2,
 									config2->weights[i].firstseperator,
 									configout->weights[i].firstseperator);
 	} //end for
+	CompileWeightConfig(configout);
 } //end of the function InterbreedWeightConfigs
 //===========================================================================
 //
@@ -53,6 +53,18 @@ typedef struct fuzzyseperator_s
 	struct fuzzyseperator_s *next;
 } fuzzyseperator_t;
 
+//compiled fuzzy seperator, the cases of a switch are stored consecutively
+typedef struct fuzzynode_s
+{
+	int index;							//inventory index the switch is on
+	int value;							//upper bound of the case
+	int child;							//first case of the child switch, -1 if none
+	int last;							//true for the last case of the switch
+	float weight;
+	float minweight;
+	float maxweight;
+} fuzzynode_t;
+
 //fuzzy weight
 typedef struct weight_s
 {
@@ -66,6 +78,10 @@ typedef struct weightconfig_s
 	int numweights;
 	weight_t weights[MAX_WEIGHTS];
 	char		filename[MAX_QPATH];
+	//the seperator trees compiled into one array
+	int numnodes;
+	fuzzynode_t *nodes;
+	int firstnode[MAX_WEIGHTS];
 } weightconfig_t;
 
 //reads a weight configuration
@@ -79,6 +95,12 @@ int FindFuzzyWeight(weightconfig_t *wc, const char *name);
 //returns the fuzzy weight for the given inventory and weight
 float FuzzyWeight(int *inventory, weightconfig_t *wc, int weightnum);
 float FuzzyWeightUndecided(int *inventory, weightconfig_t *wc, int weightnum);
+//stores the fuzzy weights of all weights in the config for the given inventory
+void FuzzyWeights(int *inventory, weightconfig_t *wc, float *weights);
+//returns the fuzzy weight evaluated on the seperator tree instead of the compiled nodes
+float FuzzyWeightTree(int *inventory, weightconfig_t *wc, int weightnum);
+//compiles the seperator trees of the weight config into flat nodes
+void CompileWeightConfig(weightconfig_t *config);
 //scales the weight with the given name
 void ScaleWeight(weightconfig_t *config, char *name, float scale);
 //scale the balance range
@@ -219,6 +219,10 @@ int trap_BotLibUpdateEntity(int ent, void /* struct bot_updateentity_s */ *bue)
 	return botlib_export->BotLibUpdateEntity( ent, bue );
 }
 
+int trap_BotLibUpdateEntities(int numents, int *entnums, void /* struct bot_entitystate_s */ *states) {
+	return botlib_export->BotLibUpdateEntities( numents, entnums, states );
+}
+
 int trap_AAS_Loaded(void) {
 	return botlib_export->aas.AAS_Loaded();
 }
@@ -310,6 +314,14 @@ int trap_AAS_AreaInfo( int areanum, void /* struct aas_areainfo_s */ *info ) {
 	return botlib_export->aas.AAS_AreaInfo( areanum, info );
 }
 
+int trap_AAS_BBoxReachabilityAreas(vec3_t absmins, vec3_t absmaxs, int *areas, int maxareas) {
+	return botlib_export->aas.AAS_BBoxReachabilityAreas( absmins, absmaxs, areas, maxareas );
+}
+
+int trap_AAS_PointInsideArea(int areanum, vec3_t point) {
+	return botlib_export->aas.AAS_PointInsideArea( areanum, point );
+}
+
 int trap_AAS_PointContents(vec3_t point) {
 	return botlib_export->aas.AAS_PointContents( point );
 }
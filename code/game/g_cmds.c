@@ -37,28 +37,77 @@ Suite 120, Rockville, Maryland 20850 USA.
 #include "../../ui/menudef.h"			// for the voice chats
 #endif
 
+#define	SCORE_FIELDS		14
+#define	SCOREBOARD_BACKUP	8		// old scoreboards kept to send deltas against
+
+typedef struct {
+	int			version;
+	int			numScores;			// entries that fit in the full scores message
+	int			teamScores[2];
+	int			fields[MAX_CLIENTS][SCORE_FIELDS];
+	int			stringlength;
+	char		string[1000];
+} scoreboard_t;
+
+static scoreboard_t	scoreboards[SCOREBOARD_BACKUP];
+static int			scoreboardVersion;		// newest scoreboard, 0 if none has been built
+static int			scoreboardTime;
+static int			scoreboardGeneration;
+static int			scoreboardBuiltGeneration;
+static int			scoreboardSentVersion[MAX_CLIENTS];	// version each player is known to hold
+
 /*
 ==================
-DeathmatchScoreboardMessage
+G_ScoreboardChanged
 
+Called by CalculateRanks so the scoreboard is rebuilt even if it was
+already built this frame
 ==================
 */
-void DeathmatchScoreboardMessage( gentity_t *ent ) {
+void G_ScoreboardChanged( void ) {
+	scoreboardGeneration++;
+}
+
+/*
+==================
+G_BuildScoreboard
+
+Formats the scoreboard at most once per frame, it only gets a new
+version if something in it changed
+==================
+*/
+static scoreboard_t *G_BuildScoreboard( void ) {
+	scoreboard_t	*cur, *sb;
 	char		entry[1024];
-	char		string[1000];
-	int			stringlength;
 	int			i, j;
+	int			*f;
 	gplayer_t	*cl;
 	int			numSorted, scoreFlags, accuracy, perfect;
 
-	// don't send scores to bots (bots don't parse them)
-	if ( ent->r.svFlags & SVF_BOT ) {
-		return;
+	cur = &scoreboards[scoreboardVersion % SCOREBOARD_BACKUP];
+
+	if ( scoreboardVersion && scoreboardTime == level.time && scoreboardBuiltGeneration == scoreboardGeneration ) {
+		return cur;
+	}
+	scoreboardTime = level.time;
+	scoreboardBuiltGeneration = scoreboardGeneration;
+
+	// versions keep increasing over game module restarts
+	if ( !scoreboardVersion ) {
+		scoreboardVersion = trap_Milliseconds();
+		cur = &scoreboards[scoreboardVersion % SCOREBOARD_BACKUP];
+		cur->version = 0;
 	}
 
+	// build in place of the oldest scoreboard
+	sb = &scoreboards[( scoreboardVersion + 1 ) % SCOREBOARD_BACKUP];
+	sb->version = 0;
+
 	// send the latest information on all clients
-	string[0] = 0;
-	stringlength = 0;
+	sb->string[0] = 0;
+	sb->stringlength = 0;
+	sb->teamScores[0] = level.teamScores[TEAM_RED];
+	sb->teamScores[1] = level.teamScores[TEAM_BLUE];
 	scoreFlags = 0;
 
 	numSorted = level.numConnectedPlayers;
@@ -82,27 +131,148 @@ void DeathmatchScoreboardMessage( gentity_t *ent ) {
 		}
 		perfect = ( cl->ps.persistant[PERS_RANK] == 0 && cl->ps.persistant[PERS_KILLED] == 0 ) ? 1 : 0;
 
+		f = sb->fields[i];
+		f[0] = level.sortedPlayers[i];
+		f[1] = cl->ps.persistant[PERS_SCORE];
+		f[2] = ping;
+		f[3] = (level.time - cl->pers.enterTime)/60000;
+		f[4] = scoreFlags;
+		f[5] = g_entities[level.sortedPlayers[i]].s.powerups;
+		f[6] = accuracy;
+		f[7] = cl->ps.persistant[PERS_IMPRESSIVE_COUNT];
+		f[8] = cl->ps.persistant[PERS_EXCELLENT_COUNT];
+		f[9] = cl->ps.persistant[PERS_GAUNTLET_FRAG_COUNT];
+		f[10] = cl->ps.persistant[PERS_DEFEND_COUNT];
+		f[11] = cl->ps.persistant[PERS_ASSIST_COUNT];
+		f[12] = perfect;
+		f[13] = cl->ps.persistant[PERS_CAPTURES];
+
 		Com_sprintf (entry, sizeof(entry),
-			" %i %i %i %i %i %i %i %i %i %i %i %i %i %i", level.sortedPlayers[i],
-			cl->ps.persistant[PERS_SCORE], ping, (level.time - cl->pers.enterTime)/60000,
-			scoreFlags, g_entities[level.sortedPlayers[i]].s.powerups, accuracy, 
-			cl->ps.persistant[PERS_IMPRESSIVE_COUNT],
-			cl->ps.persistant[PERS_EXCELLENT_COUNT],
-			cl->ps.persistant[PERS_GAUNTLET_FRAG_COUNT], 
-			cl->ps.persistant[PERS_DEFEND_COUNT], 
-			cl->ps.persistant[PERS_ASSIST_COUNT], 
-			perfect,
-			cl->ps.persistant[PERS_CAPTURES]);
+			" %i %i %i %i %i %i %i %i %i %i %i %i %i %i",
+			f[0], f[1], f[2], f[3], f[4], f[5], f[6], f[7], f[8], f[9], f[10], f[11], f[12], f[13]);
 		j = strlen(entry);
-		if (stringlength + j >= sizeof(string))
+		// leave room for the version at the end of the message
+		if (sb->stringlength + j >= sizeof(sb->string) - 12)
 			break;
-		strcpy (string + stringlength, entry);
-		stringlength += j;
+		strcpy (sb->string + sb->stringlength, entry);
+		sb->stringlength += j;
+	}
+	sb->numScores = i;
+
+	// keep the current version if nothing changed
+	if ( cur->version == scoreboardVersion && cur->numScores == sb->numScores
+		&& cur->teamScores[0] == sb->teamScores[0] && cur->teamScores[1] == sb->teamScores[1] ) {
+		for ( i = 0 ; i < sb->numScores ; i++ ) {
+			for ( j = 0 ; j < SCORE_FIELDS ; j++ ) {
+				if ( cur->fields[i][j] != sb->fields[i][j] ) {
+					break;
+				}
+			}
+			if ( j < SCORE_FIELDS ) {
+				break;
+			}
+		}
+		if ( i == sb->numScores ) {
+			return cur;
+		}
+	}
+
+	scoreboardVersion++;
+	sb->version = scoreboardVersion;
+	return sb;
+}
+
+/*
+==================
+G_ScoreboardDeltaMessage
+
+Only the entries that changed since a scoreboard the player holds.
+Returns qfalse if the delta wouldn't be smaller than the full message
+or doesn't fit in the string.
+==================
+*/
+static qboolean G_ScoreboardDeltaMessage( const scoreboard_t *from, const scoreboard_t *to, char *string, int size ) {
+	char		entry[1024];
+	char		changes[1000];
+	char		header[128];
+	int			length, numChanged;
+	int			i, j, len;
+	const int	*f;
+
+	changes[0] = 0;
+	length = 0;
+	numChanged = 0;
+
+	for ( i = 0 ; i < to->numScores ; i++ ) {
+		f = to->fields[i];
+
+		if ( i < from->numScores ) {
+			for ( j = 0 ; j < SCORE_FIELDS ; j++ ) {
+				if ( from->fields[i][j] != f[j] ) {
+					break;
+				}
+			}
+			if ( j == SCORE_FIELDS ) {
+				continue;
+			}
+		}
+
+		Com_sprintf (entry, sizeof(entry),
+			" %i %i %i %i %i %i %i %i %i %i %i %i %i %i %i", i,
+			f[0], f[1], f[2], f[3], f[4], f[5], f[6], f[7], f[8], f[9], f[10], f[11], f[12], f[13]);
+		len = strlen(entry);
+		if (length + len >= to->stringlength || length + len >= sizeof(changes)) {
+			return qfalse;
+		}
+		strcpy (changes + length, entry);
+		length += len;
+		numChanged++;
+	}
+
+	Com_sprintf( header, sizeof( header ), "dscores %i %i %i %i %i %i", from->version, to->version,
+		to->numScores, to->teamScores[0], to->teamScores[1], numChanged );
+	// send the full message if the delta would be truncated
+	if ( strlen( header ) + length >= size ) {
+		return qfalse;
+	}
+	Com_sprintf( string, size, "%s%s", header, changes );
+	return qtrue;
+}
+
+/*
+==================
+DeathmatchScoreboardMessage
+
+==================
+*/
+void DeathmatchScoreboardMessage( gentity_t *ent ) {
+	char		string[1024];
+	scoreboard_t	*sb, *from;
+	int			playerNum, base;
+
+	// don't send scores to bots (bots don't parse them)
+	if ( ent->r.svFlags & SVF_BOT ) {
+		return;
 	}
 
-	trap_SendServerCommand( ent-g_entities, va("scores %i %i %i%s", i, 
-		level.teamScores[TEAM_RED], level.teamScores[TEAM_BLUE],
-		string ) );
+	sb = G_BuildScoreboard();
+
+	playerNum = ent - g_entities;
+	base = scoreboardSentVersion[playerNum];
+	scoreboardSentVersion[playerNum] = sb->version;
+
+	// players holding a recent scoreboard only get the changes
+	if ( base > 0 ) {
+		from = &scoreboards[base % SCOREBOARD_BACKUP];
+		if ( from->version == base && G_ScoreboardDeltaMessage( from, sb, string, sizeof( string ) ) ) {
+			trap_SendServerCommand( playerNum, string );
+			return;
+		}
+	}
+
+	trap_SendServerCommand( playerNum, va("scores %i %i %i%s %i", sb->numScores,
+		sb->teamScores[0], sb->teamScores[1],
+		sb->string, sb->version ) );
 }
 
 
@@ -110,10 +280,16 @@ void DeathmatchScoreboardMessage( gentity_t *ent ) {
 ==================
 Cmd_Score_f
 
-Request current scoreboard information
+Request current scoreboard information, with the scoreboard version the
+player already has if any
 ==================
 */
 void Cmd_Score_f( gentity_t *ent ) {
+	char		arg[MAX_TOKEN_CHARS];
+
+	trap_Argv( 1, arg, sizeof( arg ) );
+	scoreboardSentVersion[ent - g_entities] = atoi( arg );
+
 	DeathmatchScoreboardMessage( ent );
 }
 
@@ -662,7 +662,7 @@ void player_die( gentity_t *self, gentity_t *inflictor, gentity_t *attacker, int
 	}
 #endif
 
-	Cmd_Score_f( self );		// show scores
+	DeathmatchScoreboardMessage( self );		// show scores
 	// send updated scores to any clients that are following this one,
 	// or they would get stale scoreboards
 	for ( i = 0 ; i < level.maxplayers ; i++ ) {
@@ -676,7 +676,7 @@ void player_die( gentity_t *self, gentity_t *inflictor, gentity_t *attacker, int
 			continue;
 		}
 		if ( player->sess.spectatorPlayer == self->s.number ) {
-			Cmd_Score_f( g_entities + i );
+			DeathmatchScoreboardMessage( g_entities + i );
 		}
 	}
 
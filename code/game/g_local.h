@@ -656,6 +656,7 @@ void G_StartKamikaze( gentity_t *ent );
 // g_cmds.c
 //
 void DeathmatchScoreboardMessage( gentity_t *ent );
+void G_ScoreboardChanged( void );
 char *ConcatArgs( int start );
 qboolean StringIsInteger( const char * s );
 
@@ -753,6 +754,9 @@ int BotAIShutdownPlayer( int playernum, qboolean restart );
 int BotAIStartFrame( int time );
 void BotTestAAS(vec3_t origin);
 void Svcmd_BotTeamplayReport_f( void );
+void Svcmd_BotMatchBench_f( void );
+void Svcmd_BotThinkReport_f( void );
+void Svcmd_BotWeightBench_f( void );
 
 #include "g_team.h" // teamplay specific stuff
 #include "g_syscalls.h"
@@ -1087,6 +1087,8 @@ void CalculateRanks( void ) {
 		}
 	}
 
+	G_ScoreboardChanged();
+
 	// see if it is time to end the level
 	CheckExitRules();
 
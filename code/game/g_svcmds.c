@@ -639,12 +639,16 @@ struct svcmd
   { "addbot", qfalse, Svcmd_AddBot_f, Svcmd_AddBotComplete },
   { "addip", qfalse, Svcmd_AddIP_f },
   { "botlist", qfalse, Svcmd_BotList_f },
+  { "botmatchbench", qfalse, Svcmd_BotMatchBench_f },
   { "botreport", qfalse, Svcmd_BotTeamplayReport_f },
+  { "botthinkreport", qfalse, Svcmd_BotThinkReport_f },
+  { "botweightbench", qfalse, Svcmd_BotWeightBench_f },
   { "entityList", qfalse, Svcmd_EntityList_f },
   { "forceTeam", qfalse, Svcmd_ForceTeam_f, Svcmd_ForceTeamComplete },
   { "listip", qfalse, Svcmd_ListIPs_f },
   { "removeip", qfalse, Svcmd_RemoveIP_f },
   { "say", qtrue, Svcmd_Say_f },
+  { "teaminfostats", qfalse, Svcmd_TeamInfoStats_f },
   { "teleport", qfalse, Svcmd_Teleport_f, Svcmd_TeleportComplete },
   { "tell", qtrue, Svcmd_Tell_f, Svcmd_TellComplete },
 };
@@ -98,6 +98,7 @@ int		trap_BotLibVarGet(const char *var_name, char *value, int size);
 int		trap_BotLibStartFrame(float time);
 int		trap_BotLibLoadMap(const char *mapname);
 int		trap_BotLibUpdateEntity(int ent, void /* struct bot_updateentity_s */ *bue);
+int		trap_BotLibUpdateEntities(int numents, int *entnums, void /* struct bot_entitystate_s */ *states);
 
 int		trap_BotGetSnapshotEntity( int playerNum, int sequence );
 int		trap_BotGetServerCommand(int playerNum, char *message, int size);
@@ -105,6 +106,8 @@ void	trap_BotUserCommand(int playerNum, usercmd_t *ucmd);
 
 int		trap_AAS_BBoxAreas(vec3_t absmins, vec3_t absmaxs, int *areas, int maxareas);
 int		trap_AAS_AreaInfo( int areanum, void /* struct aas_areainfo_s */ *info );
+int		trap_AAS_BBoxReachabilityAreas(vec3_t absmins, vec3_t absmaxs, int *areas, int maxareas);
+int		trap_AAS_PointInsideArea(int areanum, vec3_t point);
 
 int		trap_AAS_Loaded(void);
 int		trap_AAS_Initialized(void);
@@ -476,6 +476,8 @@ static void target_location_linkup(gentity_t *ent)
 		}
 	}
 
+	Team_BuildLocationTree();
+
 	// All linked together now
 }
 
@@ -883,6 +883,157 @@ int Pickup_Team( gentity_t *ent, gentity_t *other ) {
 	return Team_TouchEnemyFlag( ent, other, team );
 }
 
+#define LOCATION_CACHE_CELL		64		// players are assumed to keep their location within a cell
+
+typedef struct {
+	vec3_t		origin;
+	int			axis;			// splitting axis of the subtree this node is the median of
+	gentity_t	*ent;
+} locationNode_t;
+
+typedef struct {
+	int			treeCount;		// tree the location was found in
+	int			cell[3];
+	gentity_t	*location;
+} locationCache_t;
+
+static locationNode_t	locationNodes[MAX_GENTITIES];
+static int				numLocationNodes;
+static int				locationTreeCount;
+static int				locationSortAxis;
+
+static locationCache_t	locationCache[MAX_CLIENTS];
+
+/*
+===========
+Team_LocationCompare
+============
+*/
+static int QDECL Team_LocationCompare( const void *a, const void *b ) {
+	const locationNode_t *la = a, *lb = b;
+
+	if ( la->origin[locationSortAxis] < lb->origin[locationSortAxis] ) {
+		return -1;
+	}
+	if ( la->origin[locationSortAxis] > lb->origin[locationSortAxis] ) {
+		return 1;
+	}
+	return la->ent->s.number - lb->ent->s.number;
+}
+
+/*
+===========
+Team_BuildLocationTree_r
+
+Sorts the nodes so the median of each range splits it on the axis with the
+largest extent
+============
+*/
+static void Team_BuildLocationTree_r( int lo, int hi ) {
+	vec3_t		mins, maxs;
+	int			i, mid, axis;
+
+	if ( hi - lo <= 1 ) {
+		if ( hi > lo ) {
+			locationNodes[lo].axis = 0;
+		}
+		return;
+	}
+
+	ClearBounds( mins, maxs );
+	for ( i = lo; i < hi; i++ ) {
+		AddPointToBounds( locationNodes[i].origin, mins, maxs );
+	}
+
+	axis = 0;
+	for ( i = 1; i < 3; i++ ) {
+		if ( maxs[i] - mins[i] > maxs[axis] - mins[axis] ) {
+			axis = i;
+		}
+	}
+
+	locationSortAxis = axis;
+	qsort( &locationNodes[lo], hi - lo, sizeof( locationNode_t ), Team_LocationCompare );
+
+	mid = ( lo + hi ) / 2;
+	locationNodes[mid].axis = axis;
+
+	Team_BuildLocationTree_r( lo, mid );
+	Team_BuildLocationTree_r( mid + 1, hi );
+}
+
+/*
+===========
+Team_BuildLocationTree
+
+Builds a k-d tree over the linked target_location entities
+============
+*/
+void Team_BuildLocationTree( void ) {
+	gentity_t	*eloc;
+
+	numLocationNodes = 0;
+	for ( eloc = level.locationHead; eloc; eloc = eloc->nextTrain ) {
+		VectorCopy( eloc->r.currentOrigin, locationNodes[numLocationNodes].origin );
+		locationNodes[numLocationNodes].ent = eloc;
+		numLocationNodes++;
+	}
+
+	Team_BuildLocationTree_r( 0, numLocationNodes );
+
+	// forget the cached player locations
+	locationTreeCount++;
+}
+
+/*
+===========
+Team_NearestLocation_r
+
+Visits the side of each split the origin is on first, so the closest
+location in the PVS is usually found after a few trap_InPVS calls and
+prunes the rest of the tree
+============
+*/
+static void Team_NearestLocation_r( int lo, int hi, const vec3_t origin, gentity_t **best, float *bestlen ) {
+	locationNode_t	*node;
+	float			d, len;
+	int				mid;
+
+	if ( lo >= hi ) {
+		return;
+	}
+
+	mid = ( lo + hi ) / 2;
+	node = &locationNodes[mid];
+	d = origin[node->axis] - node->origin[node->axis];
+
+	if ( d < 0 ) {
+		Team_NearestLocation_r( lo, mid, origin, best, bestlen );
+	} else {
+		Team_NearestLocation_r( mid + 1, hi, origin, best, bestlen );
+	}
+
+	len = ( origin[0] - node->origin[0] ) * ( origin[0] - node->origin[0] )
+		+ ( origin[1] - node->origin[1] ) * ( origin[1] - node->origin[1] )
+		+ ( origin[2] - node->origin[2] ) * ( origin[2] - node->origin[2] );
+
+	// equally close locations go to the lowest entity number like the old list walk
+	if ( len < *bestlen || ( len == *bestlen && ( !*best || node->ent->s.number < (*best)->s.number ) ) ) {
+		if ( trap_InPVS( origin, node->origin ) ) {
+			*bestlen = len;
+			*best = node->ent;
+		}
+	}
+
+	if ( d * d <= *bestlen ) {
+		if ( d < 0 ) {
+			Team_NearestLocation_r( mid + 1, hi, origin, best, bestlen );
+		} else {
+			Team_NearestLocation_r( lo, mid, origin, best, bestlen );
+		}
+	}
+}
+
 /*
 ===========
 Team_GetLocation
@@ -892,34 +1043,46 @@ Report a location for the player. Uses placed nearby target_location entities
 */
 gentity_t *Team_GetLocation(gentity_t *ent)
 {
-	gentity_t		*eloc, *best;
-	float			bestlen, len;
+	gentity_t		*best;
+	float			bestlen;
 	vec3_t			origin;
+	locationCache_t	*cache;
+	int				cell[3];
+	int				i;
 
 	if ( !ent ) {
 		return NULL;
 	}
 
-	best = NULL;
-	bestlen = 3*8192.0*8192.0;
+	if ( !level.locationLinked ) {
+		return NULL;
+	}
 
 	VectorCopy( ent->r.currentOrigin, origin );
 
-	for (eloc = level.locationHead; eloc; eloc = eloc->nextTrain) {
-		len = ( origin[0] - eloc->r.currentOrigin[0] ) * ( origin[0] - eloc->r.currentOrigin[0] )
-			+ ( origin[1] - eloc->r.currentOrigin[1] ) * ( origin[1] - eloc->r.currentOrigin[1] )
-			+ ( origin[2] - eloc->r.currentOrigin[2] ) * ( origin[2] - eloc->r.currentOrigin[2] );
+	for ( i = 0; i < 3; i++ ) {
+		cell[i] = (int)floor( origin[i] / LOCATION_CACHE_CELL );
+	}
 
-		if ( len > bestlen ) {
-			continue;
-		}
+	cache = NULL;
+	if ( ent->s.number < MAX_CLIENTS ) {
+		cache = &locationCache[ent->s.number];
 
-		if ( !trap_InPVS( origin, eloc->r.currentOrigin ) ) {
-			continue;
+		if ( cache->treeCount == locationTreeCount && cache->cell[0] == cell[0]
+			&& cache->cell[1] == cell[1] && cache->cell[2] == cell[2] ) {
+			return cache->location;
 		}
+	}
+
+	best = NULL;
+	bestlen = 3*8192.0*8192.0;
+
+	Team_NearestLocation_r( 0, numLocationNodes, origin, &best, &bestlen );
 
-		bestlen = len;
-		best = eloc;
+	if ( cache ) {
+		cache->treeCount = locationTreeCount;
+		VectorCopy( cell, cache->cell );
+		cache->location = best;
 	}
 
 	return best;
@@ -1033,30 +1196,195 @@ gentity_t *SelectCTFSpawnPoint ( team_t team, int teamstate, vec3_t origin, vec3
 
 /*---------------------------------------------------------------------------*/
 
-static int QDECL SortPlayers( const void *a, const void *b ) {
-	return *(int *)a - *(int *)b;
-}
+#define TEAMINFO_FIELDS			6
+#define TEAMINFO_KEEPALIVE_TIME	3000	// the cgame drops the team overlay after 5 seconds without tinfo
+
+typedef struct {
+	int			version;
+	int			count;
+	int			fields[TEAM_MAXOVERLAY][TEAMINFO_FIELDS];
+	int			stringlength;
+	char		string[8192];
+} teamInfoPayload_t;
+
+typedef struct {
+	int					buildTime;
+	teamInfoPayload_t	payloads[2];	// current and previous version
+	int					current;
+} teamInfo_t;
 
+static teamInfo_t	teamInfos[TEAM_NUM_TEAMS];
+static int			teamInfoVersion;
+
+// what each player was last sent
+static int			teamInfoSentVersion[MAX_CLIENTS];
+static int			teamInfoSentTime[MAX_CLIENTS];
+
+// svcmd teaminfostats counters
+static int			teamInfoFullCommands;
+static int			teamInfoDeltaCommands;
+static int			teamInfoSkippedCommands;
+static int			teamInfoBytesSent;
+static int			teamInfoBytesFull;
 
 /*
 ==================
-TeamplayLocationsMessage
+Team_BuildTeamInfo
+
+Formats the team overlay of a team once per update, it only gets a new
+version if something in it changed
 
 Format:
 	playerNum location health armor weapon powerups
-
 ==================
 */
-void TeamplayInfoMessage( gentity_t *ent ) {
+static teamInfoPayload_t *Team_BuildTeamInfo( int team ) {
+	teamInfo_t			*ti;
+	teamInfoPayload_t	*cur, *pl;
 	char		entry[1024];
-	char		string[8192];
-	int			stringlength;
 	int			i, j;
+	int			*f;
 	gentity_t	*player;
 	int			cnt;
 	int			h, a;
-	int			players[TEAM_MAXOVERLAY];
-	int			team;
+
+	ti = &teamInfos[team];
+	cur = &ti->payloads[ti->current];
+
+	if ( ti->buildTime == level.time && cur->version ) {
+		return cur;
+	}
+	ti->buildTime = level.time;
+
+	// versions keep increasing over game module restarts
+	if ( !teamInfoVersion ) {
+		teamInfoVersion = trap_Milliseconds();
+	}
+
+	// build in place of the previous version, it no longer matches what was
+	// sent with that version so deltas against it must not be made
+	pl = &ti->payloads[ti->current ^ 1];
+	pl->version = 0;
+
+	// send the latest information on all players
+	pl->string[0] = 0;
+	pl->stringlength = 0;
+
+	for (i = 0, cnt = 0; i < g_maxplayers.integer && cnt < TEAM_MAXOVERLAY; i++) {
+		player = g_entities + i;
+		if (player->inuse && player->player->sess.sessionTeam == team ) {
+
+			h = player->player->ps.stats[STAT_HEALTH];
+			a = player->player->ps.stats[STAT_ARMOR];
+			if (h < 0) h = 0;
+			if (a < 0) a = 0;
+
+			f = pl->fields[cnt];
+			f[0] = i;
+			f[1] = player->player->pers.teamState.location;
+			f[2] = h;
+			f[3] = a;
+			f[4] = player->player->ps.weapon;
+			f[5] = player->s.powerups;
+
+			Com_sprintf (entry, sizeof(entry),
+				" %i %i %i %i %i %i", f[0], f[1], f[2], f[3], f[4], f[5]);
+			j = strlen(entry);
+			if (pl->stringlength + j >= sizeof(pl->string))
+				break;
+			strcpy (pl->string + pl->stringlength, entry);
+			pl->stringlength += j;
+			cnt++;
+		}
+	}
+	pl->count = cnt;
+
+	// keep the current version if nothing changed
+	if ( cur->version && cur->count == pl->count ) {
+		for ( i = 0; i < pl->count; i++ ) {
+			for ( j = 0; j < TEAMINFO_FIELDS; j++ ) {
+				if ( cur->fields[i][j] != pl->fields[i][j] ) {
+					break;
+				}
+			}
+			if ( j < TEAMINFO_FIELDS ) {
+				break;
+			}
+		}
+		if ( i == pl->count ) {
+			return cur;
+		}
+	}
+
+	pl->version = ++teamInfoVersion;
+	ti->current ^= 1;
+	return pl;
+}
+
+/*
+==================
+Team_TeamInfoDeltaMessage
+
+Only the overlay entries that changed since the previous version.
+Returns qfalse if the delta wouldn't be smaller than the full message.
+==================
+*/
+static qboolean Team_TeamInfoDeltaMessage( int team, const teamInfoPayload_t *from, const teamInfoPayload_t *to, char *string, int size ) {
+	char		entry[1024];
+	char		changes[1024];
+	int			length, numChanged;
+	int			i, j, len;
+	const int	*f;
+
+	changes[0] = 0;
+	length = 0;
+	numChanged = 0;
+
+	for ( i = 0; i < to->count; i++ ) {
+		f = to->fields[i];
+
+		if ( i < from->count ) {
+			for ( j = 0; j < TEAMINFO_FIELDS; j++ ) {
+				if ( from->fields[i][j] != f[j] ) {
+					break;
+				}
+			}
+			if ( j == TEAMINFO_FIELDS ) {
+				continue;
+			}
+		}
+
+		Com_sprintf (entry, sizeof(entry),
+			" %i %i %i %i %i %i %i", i, f[0], f[1], f[2], f[3], f[4], f[5]);
+		len = strlen(entry);
+		if (length + len >= to->stringlength || length + len >= sizeof(changes)) {
+			return qfalse;
+		}
+		strcpy (changes + length, entry);
+		length += len;
+		numChanged++;
+	}
+
+	Com_sprintf( string, size, "tinfod %i %i %i %i %i%s", from->version, to->version,
+		team, to->count, numChanged, changes );
+	return qtrue;
+}
+
+/*
+==================
+TeamplayInfoMessage
+
+Sends the overlay of the player's team, or of the followed player's team
+to spectators. Nothing is sent if the player already has the current
+version and got a message recently.
+==================
+*/
+void TeamplayInfoMessage( gentity_t *ent ) {
+	char		string[1024];
+	char		*cmd;
+	teamInfo_t	*ti;
+	teamInfoPayload_t	*pl, *prev;
+	int			playerNum, base, team;
 
 	if ( ! ent->player->pers.teamInfo )
 		return;
@@ -1076,47 +1404,53 @@ void TeamplayInfoMessage( gentity_t *ent ) {
 		return;
 	}
 
-	// figure out what player should be on the display
-	// we are limited to 8, but we want to use the top eight players
-	// but in player order (so they don't keep changing position on the overlay)
-	for (i = 0, cnt = 0; i < g_maxplayers.integer && cnt < TEAM_MAXOVERLAY; i++) {
-		player = g_entities + level.sortedPlayers[i];
-		if (player->inuse && player->player->sess.sessionTeam == team ) {
-			players[cnt++] = level.sortedPlayers[i];
-		}
-	}
+	pl = Team_BuildTeamInfo( team );
+	ti = &teamInfos[team];
+	prev = &ti->payloads[ti->current ^ 1];
 
-	// We have the top eight players, sort them by playerNum
-	qsort( players, cnt, sizeof( players[0] ), SortPlayers );
+	playerNum = ent - g_entities;
+	base = teamInfoSentVersion[playerNum];
 
-	// send the latest information on all players
-	string[0] = 0;
-	stringlength = 0;
+	cmd = va("tinfo %i %i %s %i", team, pl->count, pl->string, pl->version);
+	teamInfoBytesFull += strlen( cmd );
 
-	for (i = 0, cnt = 0; i < g_maxplayers.integer && cnt < TEAM_MAXOVERLAY; i++) {
-		player = g_entities + i;
-		if (player->inuse && player->player->sess.sessionTeam == team ) {
+	if ( base == pl->version && level.time - teamInfoSentTime[playerNum] < TEAMINFO_KEEPALIVE_TIME ) {
+		teamInfoSkippedCommands++;
+		return;
+	}
 
-			h = player->player->ps.stats[STAT_HEALTH];
-			a = player->player->ps.stats[STAT_ARMOR];
-			if (h < 0) h = 0;
-			if (a < 0) a = 0;
+	teamInfoSentVersion[playerNum] = pl->version;
 
-			Com_sprintf (entry, sizeof(entry),
-				" %i %i %i %i %i %i", 
-//				level.sortedPlayers[i], player->player->pers.teamState.location, h, a, 
-				i, player->player->pers.teamState.location, h, a, 
-				player->player->ps.weapon, player->s.powerups);
-			j = strlen(entry);
-			if (stringlength + j >= sizeof(string))
-				break;
-			strcpy (string + stringlength, entry);
-			stringlength += j;
-			cnt++;
-		}
+	// a full message now and then in case the cgame lost track
+	if ( level.time - teamInfoSentTime[playerNum] < TEAMINFO_KEEPALIVE_TIME
+		&& base && base == prev->version && Team_TeamInfoDeltaMessage( team, prev, pl, string, sizeof( string ) ) ) {
+		teamInfoDeltaCommands++;
+		teamInfoBytesSent += strlen( string );
+		trap_SendServerCommand( playerNum, string );
+		return;
 	}
 
-	trap_SendServerCommand( ent-g_entities, va("tinfo %i %i %s", team, cnt, string) );
+	teamInfoSentTime[playerNum] = level.time;
+	teamInfoFullCommands++;
+	teamInfoBytesSent += strlen( cmd );
+	trap_SendServerCommand( playerNum, cmd );
+}
+
+/*
+==================
+Svcmd_TeamInfoStats_f
+
+Reports how much team overlay traffic the payload cache saved
+==================
+*/
+void Svcmd_TeamInfoStats_f( void ) {
+	int		commands;
+
+	commands = teamInfoFullCommands + teamInfoDeltaCommands + teamInfoSkippedCommands;
+
+	G_Printf( "team overlay updates: %i\n", commands );
+	G_Printf( "  full: %i, delta: %i, skipped: %i\n", teamInfoFullCommands, teamInfoDeltaCommands, teamInfoSkippedCommands );
+	G_Printf( "  bytes sent: %i of %i (%i saved)\n", teamInfoBytesSent, teamInfoBytesFull, teamInfoBytesFull - teamInfoBytesSent );
 }
 
 void CheckTeamStatus(void) {
@@ -69,6 +69,7 @@ static qboolean debugMode = qfalse;
 static int lastListBoxClickTime = 0;
 
 void Item_RunScript(itemDef_t *item, const char *s);
+void Item_RunScriptText(itemDef_t *item, const char *s);
 void Item_SetupKeywordHash(void);
 void Menu_SetupKeywordHash(void);
 int BindingIDFromName(const char *name);
@@ -80,6 +81,13 @@ static qboolean Menu_OverActiveItem(menuDef_t *menu, float x, float y);
 #define MEM_POOL_SIZE  ( 1024 + 128 ) * 1024
 
 static char		memoryPool[MEM_POOL_SIZE];
+
+// compiled scripts hashed on the address of the interned script string,
+// allocated from the memory pool
+#define SCRIPT_HASH_SIZE 512
+static compiledScript_t *scriptHash[SCRIPT_HASH_SIZE];
+static int scriptExecutions = 0;
+static int scriptExecutionsLastFrame = 0;
 static int		allocPoint, outOfMemory;
 
 
@@ -115,6 +123,7 @@ UI_InitMemory
 void UI_InitMemory( void ) {
 	allocPoint = 0;
 	outOfMemory = qfalse;
+	memset(scriptHash, 0, sizeof(scriptHash));
 }
 
 qboolean UI_OutOfMemory( void ) {
@@ -496,6 +505,21 @@ qboolean PC_Script_Parse(int handle, const char **out) {
 	return qfalse;
 }
 
+/*
+=================
+PC_CompiledScript_Parse
+
+parses a command script and compiles it so running it never re-tokenizes the commands
+=================
+*/
+qboolean PC_CompiledScript_Parse(int handle, const char **out) {
+	if (!PC_Script_Parse(handle, out)) {
+		return qfalse;
+	}
+	Script_Compile(*out);
+	return qtrue;
+}
+
 // display, window, menu, item code
 // 
 
@@ -1225,7 +1249,157 @@ commandDef_t commandList[] =
 int scriptCommandCount = ARRAY_LEN(commandList);
 
 
+/*
+=================
+Script_CompileOps
+
+stores the commands of the script in ops if not NULL, returns the number of
+commands or -1 if out of memory
+=================
+*/
+static int Script_CompileOps(const char *s, scriptOp_t *ops) {
+  char buf[1024];
+  char *p, *argStart, *argEnd;
+  const char *command, *token;
+  int i, count;
+
+  count = 0;
+  p = (char *)s;
+  while (1) {
+    // expect command then arguments, ; ends command, NULL ends script
+    command = COM_ParseExt(&p, qfalse);
+    if (!command[0]) {
+      break;
+    }
+    if (command[0] == ';' && command[1] == '\0') {
+      continue;
+    }
+    if (ops) {
+      ops[count].handler = NULL;
+      for (i = 0; i < scriptCommandCount; i++) {
+        if (Q_stricmp(command, commandList[i].name) == 0) {
+          ops[count].handler = commandList[i].handler;
+          break;
+        }
+      }
+    }
+    // the arguments run up to the next ;
+    argStart = argEnd = p;
+    while (1) {
+      token = COM_ParseExt(&p, qfalse);
+      if (!token[0] || (token[0] == ';' && token[1] == '\0')) {
+        break;
+      }
+      argEnd = p;
+    }
+    if (ops) {
+      Q_strncpyz(buf, argStart, MIN(argEnd - argStart + 1, sizeof(buf)));
+      ops[count].args = String_Alloc(buf);
+      if (!ops[count].args) {
+        return -1;
+      }
+    }
+    count++;
+    if (!token[0]) {
+      break;
+    }
+  }
+  return count;
+}
+
+/*
+=================
+Script_Compile
+
+splits the script into commands with their handlers looked up once, the
+script has to be an interned string from String_Alloc
+
+returns NULL if the script couldn't be compiled, a script that failed to
+compile is remembered with a negative opCount so it isn't compiled again
+=================
+*/
+compiledScript_t *Script_Compile(const char *s) {
+  int hash;
+  compiledScript_t *script;
+
+  hash = ((size_t)s >> 2) & (SCRIPT_HASH_SIZE - 1);
+  for (script = scriptHash[hash]; script; script = script->next) {
+    if (script->source == s) {
+      return script->opCount < 0 ? NULL : script;
+    }
+  }
+
+  // don't try again for every script once the memory pool ran out
+  if (outOfMemory) {
+    return NULL;
+  }
+  script = UI_Alloc(sizeof(compiledScript_t));
+  if (!script) {
+    return NULL;
+  }
+  script->source = s;
+  script->opCount = Script_CompileOps(s, NULL);
+  script->ops = NULL;
+  if (script->opCount > 0) {
+    script->ops = UI_Alloc(script->opCount * sizeof(scriptOp_t));
+    if (!script->ops || Script_CompileOps(s, script->ops) < 0) {
+      script->opCount = -1;
+      script->ops = NULL;
+    }
+  }
+
+  script->next = scriptHash[hash];
+  scriptHash[hash] = script;
+  return script->opCount < 0 ? NULL : script;
+}
+
+/*
+=================
+Item_RunScript
+=================
+*/
 void Item_RunScript(itemDef_t *item, const char *s) {
+  int i;
+  char *p;
+  compiledScript_t *script;
+
+  if (!item || !s || !s[0]) {
+    return;
+  }
+  scriptExecutions++;
+
+  script = Script_Compile(s);
+  if (!script) {
+    Item_RunScriptText(item, s);
+    return;
+  }
+
+  for (i = 0; i < script->opCount; i++) {
+    p = (char *)script->ops[i].args;
+    if (script->ops[i].handler) {
+      script->ops[i].handler(item, &p);
+    } else {
+      // not in our auto list, pass to handler
+      DC->runScript(&p);
+    }
+    // arguments the command didn't use are commands themselves
+    while (*p && *p <= ' ') {
+      p++;
+    }
+    if (*p) {
+      Item_RunScriptText(item, p);
+    }
+  }
+}
+
+/*
+=================
+Item_RunScriptText
+
+tokenizes and runs the script text
+=================
+*/
+void Item_RunScriptText(itemDef_t *item, const char *s) {
   char script[1024], *p;
   int i;
   qboolean bRan;
@@ -4897,56 +5071,56 @@ qboolean ItemParse_doubleClick( itemDef_t *item, int handle ) {
 
 	listPtr = (listBoxDef_t*)item->typeData;
 
-	if (!PC_Script_Parse(handle, &listPtr->doubleClick)) {
+	if (!PC_CompiledScript_Parse(handle, &listPtr->doubleClick)) {
 		return qfalse;
 	}
 	return qtrue;
 }
 
 qboolean ItemParse_onFocus( itemDef_t *item, int handle ) {
-	if (!PC_Script_Parse(handle, &item->onFocus)) {
+	if (!PC_CompiledScript_Parse(handle, &item->onFocus)) {
 		return qfalse;
 	}
 	return qtrue;
 }
 
 qboolean ItemParse_leaveFocus( itemDef_t *item, int handle ) {
-	if (!PC_Script_Parse(handle, &item->leaveFocus)) {
+	if (!PC_CompiledScript_Parse(handle, &item->leaveFocus)) {
 		return qfalse;
 	}
 	return qtrue;
 }
 
 qboolean ItemParse_mouseEnter( itemDef_t *item, int handle ) {
-	if (!PC_Script_Parse(handle, &item->mouseEnter)) {
+	if (!PC_CompiledScript_Parse(handle, &item->mouseEnter)) {
 		return qfalse;
 	}
 	return qtrue;
 }
 
 qboolean ItemParse_mouseExit( itemDef_t *item, int handle ) {
-	if (!PC_Script_Parse(handle, &item->mouseExit)) {
+	if (!PC_CompiledScript_Parse(handle, &item->mouseExit)) {
 		return qfalse;
 	}
 	return qtrue;
 }
 
 qboolean ItemParse_mouseEnterText( itemDef_t *item, int handle ) {
-	if (!PC_Script_Parse(handle, &item->mouseEnterText)) {
+	if (!PC_CompiledScript_Parse(handle, &item->mouseEnterText)) {
 		return qfalse;
 	}
 	return qtrue;
 }
 
 qboolean ItemParse_mouseExitText( itemDef_t *item, int handle ) {
-	if (!PC_Script_Parse(handle, &item->mouseExitText)) {
+	if (!PC_CompiledScript_Parse(handle, &item->mouseExitText)) {
 		return qfalse;
 	}
 	return qtrue;
 }
 
 qboolean ItemParse_action( itemDef_t *item, int handle ) {
-	if (!PC_Script_Parse(handle, &item->action)) {
+	if (!PC_CompiledScript_Parse(handle, &item->action)) {
 		return qfalse;
 	}
 	return qtrue;
@@ -5583,7 +5757,7 @@ qboolean MenuParse_visible( itemDef_t *item, int handle ) {
 
 qboolean MenuParse_onOpen( itemDef_t *item, int handle ) {
 	menuDef_t *menu = (menuDef_t*)item;
-	if (!PC_Script_Parse(handle, &menu->onOpen)) {
+	if (!PC_CompiledScript_Parse(handle, &menu->onOpen)) {
 		return qfalse;
 	}
 	return qtrue;
@@ -5591,7 +5765,7 @@ qboolean MenuParse_onOpen( itemDef_t *item, int handle ) {
 
 qboolean MenuParse_onClose( itemDef_t *item, int handle ) {
 	menuDef_t *menu = (menuDef_t*)item;
-	if (!PC_Script_Parse(handle, &menu->onClose)) {
+	if (!PC_CompiledScript_Parse(handle, &menu->onClose)) {
 		return qfalse;
 	}
 	return qtrue;
@@ -5599,7 +5773,7 @@ qboolean MenuParse_onClose( itemDef_t *item, int handle ) {
 
 qboolean MenuParse_onESC( itemDef_t *item, int handle ) {
 	menuDef_t *menu = (menuDef_t*)item;
-	if (!PC_Script_Parse(handle, &menu->onESC)) {
+	if (!PC_CompiledScript_Parse(handle, &menu->onESC)) {
 		return qfalse;
 	}
 	return qtrue;
@@ -5968,6 +6142,10 @@ int Menu_Count(void) {
 
 void Menu_PaintAll(void) {
 	int i;
+
+	scriptExecutionsLastFrame = scriptExecutions;
+	scriptExecutions = 0;
+
 	if (captureFunc) {
 		captureFunc(captureData);
 	}
@@ -5979,6 +6157,7 @@ void Menu_PaintAll(void) {
 	if (debugMode) {
 		vec4_t v = {1, 1, 1, 1};
 		DC->drawText(5, 25, .5, v, va("fps: %f", DC->FPS), 0, 0, 0);
+		DC->drawText(5, 45, .5, v, va("scripts: %i", scriptExecutionsLastFrame), 0, 0, 0);
 	}
 }
 
@@ -5986,6 +6165,10 @@ void Menu_Reset(void) {
 	DC->menuCount = 0;
 }
 
+int Display_ScriptExecutions(void) {
+	return scriptExecutionsLastFrame;
+}
+
 displayContextDef_t *Display_GetContext(void) {
 	return DC;
 }
@@ -349,6 +349,19 @@ typedef struct {
   void (*handler) (itemDef_t *item, char** args);
 } commandDef_t;
 
+// a script command with its handler resolved at parse time
+typedef struct {
+  void (*handler) (itemDef_t *item, char** args);	// NULL passes the arguments to DC->runScript
+  const char *args;									// arguments up to the next ;
+} scriptOp_t;
+
+typedef struct compiledScript_s {
+  const char *source;
+  int opCount;
+  scriptOp_t *ops;
+  struct compiledScript_s *next;
+} compiledScript_t;
+
 typedef struct {
   qhandle_t (*registerShaderNoMip) (const char *p);
   void (*setColor) (const vec4_t v);
@@ -446,6 +459,8 @@ qboolean PC_Int_Parse(int handle, int *i);
 qboolean PC_Rect_Parse(int handle, rectDef_t *r);
 qboolean PC_String_Parse(int handle, const char **out);
 qboolean PC_Script_Parse(int handle, const char **out);
+qboolean PC_CompiledScript_Parse(int handle, const char **out);
+compiledScript_t *Script_Compile(const char *s);
 int Menu_Count( void );
 void Menu_New(int handle);
 void Menu_PaintAll( void );
@@ -473,6 +488,7 @@ void Menu_SetFeederSelection(menuDef_t *menu, int feeder, int index, const char
 void Menu_SetScreenPlacement(menuDef_t *menu, screenPlacement_e hpos, screenPlacement_e vpos );
 void Display_CacheAll( void );
 qboolean Display_DebugMode( void );
+int Display_ScriptExecutions( void );
 
 itemDef_t *Menu_FindItemByName(menuDef_t *menu, const char *p);
 